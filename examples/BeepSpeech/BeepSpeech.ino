@@ -4,7 +4,9 @@
 // When BOOTSEL preseed, say "beep" using speech synthesis
 // Hook up an earphone to pins 0, 1, and GND to hear the PWM output.
 //
-// Intended as a simple demonstration of BackgroundAudio usage.
+// Intended as a simple demonstration of BackgroundAudio usage.  Because the
+// same phrase is repeated, a phrase cache lets every beep after the first
+// play back without running the speech synthesizer at all.
 
 #include <BackgroundAudioSpeech.h>
 #include <libespeak-ng/voice/en.h>
@@ -17,6 +19,7 @@ ESP32I2SAudio audio(4, 5, 6); // BCLK, LRCLK, DOUT (,MCLK)
 PWMAudio audio(0);
 #endif
 BackgroundAudioSpeech BMP(audio);
+BackgroundAudioSpeechCache cache(16 * 1024);
 
 void setup() {
   Serial.begin(115200);
@@ -27,6 +30,7 @@ void setup() {
 
   // Start the background player
   BMP.setVoice(voice_en);
+  BMP.setCache(&cache);
   BMP.begin();
 }
 
@@ -47,7 +51,7 @@ void loop() {
       /* wait for button release */
       delay(1);
     }
-    Serial.printf("BEEP!\r\n");
+    Serial.printf("BEEP! Cache hits %lu, misses %lu\r\n", cache.hits(), cache.misses());
   }
   if (millis() - last > 1000) {
     Serial.printf("Runtime: %lu\r\n", millis());
@@ -0,0 +1,52 @@
+// SamplerSFX - Earle F. Philhower, III <earlephilhower@yahoo.com>
+// Released to the public domain 2025.
+//
+// Plays overlapping copies of a beep at random pitches every time a
+// character comes in over Serial (or BOOTSEL is pressed on the Pico).
+// Hook up an earphone to pins 0, 1, and GND to hear the PWM output.
+//
+// All voices are mixed by one BackgroundAudioSampler, so there is no
+// per-sound decoder or buffer, and a trigger is heard within one
+// 128-sample output block (as soon as the one playing finishes).
+//
+// Intended as a simple demonstration of BackgroundAudio usage.
+
+#include <BackgroundAudioSampler.h>
+#include <__example_beepwav.h>
+
+#ifdef ESP32
+#include <ESP32I2SAudio.h>
+ESP32I2SAudio audio(4, 5, 6); // BCLK, LRCLK, DOUT (,MCLK)
+#else
+#include <PWMAudio.h>
+PWMAudio audio(0);
+#endif
+BackgroundAudioSampler sfx(audio);
+BackgroundAudioClip beep(beepwav, sizeof(beepwav));
+
+void setup() {
+  Serial.begin(115200);
+  sfx.begin();
+}
+
+void fire() {
+  float pitch = 0.5 + random(1000) / 1000.0; // 0.5x...1.5x
+  sfx.play(beep, 0.5, pitch);
+  Serial.printf("Active voices: %d, stolen: %lu\r\n", (int)sfx.active(), (unsigned long)sfx.steals());
+}
+
+void loop() {
+  while (Serial.available()) {
+    Serial.read();
+    fire();
+  }
+#ifndef ESP32
+  if (BOOTSEL) {
+    fire();
+    while (BOOTSEL) {
+      /* wait for button release */
+      delay(1);
+    }
+  }
+#endif
+}
@@ -7,39 +7,37 @@
 
 #include <BackgroundAudioSpeech.h>
 
+// Each language's dictionary is kept in flash, so both can be included and switched between.
+// Up to 8 different voices can be used at once.
 #define ENGLISH 1
-#define FRENCH !ENGLISH // Many wars have been fought over this...
+#define FRENCH 1 // Many wars have been fought over this...
 
 #if ENGLISH
 #include <libespeak-ng/voice/en_029.h>
 #include <libespeak-ng/voice/en_gb_scotland.h>
-#include <libespeak-ng/voice/en_gb_x_gbclan.h>
-#include <libespeak-ng/voice/en_gb_x_gbcwmd.h>
-#include <libespeak-ng/voice/en_gb_x_rp.h>
 #include <libespeak-ng/voice/en.h>
-#include <libespeak-ng/voice/en_shaw.h>
 #include <libespeak-ng/voice/en_us.h>
 #include <libespeak-ng/voice/en_us_nyc.h>
+#endif
+#if FRENCH
+#include <libespeak-ng/voice/fr_be.h>
+#include <libespeak-ng/voice/fr_ch.h>
+#include <libespeak-ng/voice/fr.h>
+#endif
 BackgroundAudioVoice v[] = {
+#if ENGLISH
   voice_en_029,
   voice_en_gb_scotland,
-  voice_en_gb_x_gbclan,
-  voice_en_gb_x_gbcwmd,
   voice_en,
-  voice_en_shaw,
   voice_en_us,
-  voice_en_us_nyc
-};
-#else // If you're not English, you're French
-#include <libespeak-ng/voice/fr_be.h>
-#include <libespeak-ng/voice/fr_ch.h>
-#include <libespeak-ng/voice/fr.h>
-BackgroundAudioVoice v[] = {
+  voice_en_us_nyc,
+#endif
+#if FRENCH
   voice_fr_be,
   voice_fr_ch,
   voice_fr
-};
 #endif
+};
 
 
 #ifdef ESP32
@@ -89,12 +87,12 @@ void loop() {
     } else if (s[0] == '*') {
       int voice = s.substring(1, 2).toInt();
       if ((voice >= 0) && (voice < (int) sizeof(v) / (int) sizeof(v[0]))) {
-        BMP.flush();
-        while (!BMP.done()) {
-          delay(1); // Busy-wait because it's not safe to change voices while producing samples...
+        // Anything already typed is still spoken with the old voice, the new one starts with the next line
+        if (BMP.setVoice(v[voice])) {
+          Serial.printf("Changed voice to '%s'\r\n", v[voice].name);
+        } else {
+          Serial.printf("Error: Unable to load voice '%s'\r\n", v[voice].name);
         }
-        BMP.setVoice(v[voice]);
-        Serial.printf("Changed voice to '%s'\r\n", v[voice].name);
       } else {
         Serial.printf("Error: Voice number %d out of bounds\r\n", voice);
       }
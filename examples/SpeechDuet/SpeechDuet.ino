@@ -0,0 +1,48 @@
+// SpeechDuet - Earle F. Philhower, III <earlephilhower@yahoo.com>
+// Released to the public domain 2025
+//
+// Two speakers talking over each other, each with its own voice and rate,
+// mixed onto a single output.
+// Hook up an earphone to pins 0, 1, and GND to hear the PWM output.
+
+#include <BackgroundAudioSpeech.h>
+#include <BackgroundAudioMixer.h>
+#include <libespeak-ng/voice/en.h>
+#include <libespeak-ng/voice/en_gb_scotland.h>
+
+#ifdef ESP32
+#include <ESP32I2SAudio.h>
+ESP32I2SAudio audio(4, 5, 6); // BCLK, LRCLK, DOUT (,MCLK)
+#else
+#include <PWMAudio.h>
+PWMAudio audio(0);
+#endif
+
+// Speech is always generated at 22050Hz
+BackgroundAudioMixer<640> mixer(audio, 22050);
+BackgroundAudioSpeech alice;
+BackgroundAudioSpeech bob;
+
+void setup() {
+  alice.setDevice(mixer.add());
+  bob.setDevice(mixer.add());
+  alice.setVoice(voice_en);
+  bob.setVoice(voice_en_gb_scotland);
+
+  // The first speaker started sets up ESpeak-NG, the second gets its own context
+  mixer.begin();
+  alice.begin();
+  bob.begin();
+  bob.setRate(140);
+  bob.setPitch(30);
+}
+
+void loop() {
+  if (alice.done()) {
+    alice.speak("I can talk and talk, and nobody ever stops me.");
+  }
+  if (bob.done()) {
+    bob.speak("Aye, and I can talk at the very same time.");
+  }
+  delay(100);
+}
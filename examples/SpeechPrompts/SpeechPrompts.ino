@@ -0,0 +1,54 @@
+// SpeechPrompts - Earle F. Philhower, III <earlephilhower@yahoo.com>
+// Released to the public domain 2025.
+//
+// Counts down "Three, two, one, lift off!" every time a character comes in
+// over Serial (or BOOTSEL is pressed on the Pico).
+// Hook up an earphone to pins 0, 1, and GND to hear the PWM output.
+//
+// The prompts in count.h were rendered on a PC by tools/speech2rom using the
+// same ESpeak-NG voice as BackgroundAudioSpeech, so no dictionary or speech
+// synthesis is needed on the device.  See tools/README.md to make your own.
+//
+// Intended as a simple demonstration of BackgroundAudio usage.
+
+#include <BackgroundAudioPrompts.h>
+#include "count.h"
+
+#ifdef ESP32
+#include <ESP32I2SAudio.h>
+ESP32I2SAudio audio(4, 5, 6); // BCLK, LRCLK, DOUT (,MCLK)
+#else
+#include <PWMAudio.h>
+PWMAudio audio(0);
+#endif
+BackgroundAudioPrompts prompts(audio);
+
+void setup() {
+  Serial.begin(115200);
+  prompts.setPrompts(prompts_count);
+  prompts.begin();
+}
+
+void countdown() {
+  prompts.flush(); // Start over if already counting
+  prompts.play(COUNT_THREE);
+  prompts.play(COUNT_TWO);
+  prompts.play(COUNT_ONE);
+  prompts.play(COUNT_LIFTOFF);
+}
+
+void loop() {
+  while (Serial.available()) {
+    Serial.read();
+    countdown();
+  }
+#ifndef ESP32
+  if (BOOTSEL) {
+    countdown();
+    while (BOOTSEL) {
+      /* wait for button release */
+      delay(1);
+    }
+  }
+#endif
+}
@@ -0,0 +1,1536 @@
+// Auto-generated by tools/speech2rom, do not edit!
+#pragma once
+#include <BackgroundAudioPrompts.h>
+
+const unsigned char __prompts_count_data[] __attribute__((aligned((4)))) = {
+  0x77, 0x25, 0x32, 0x32, 0x33, 0x33, 0x43, 0x22, 0x12, 0x10, 0x98, 0xc9,
+  0xeb, 0xcb, 0xbc, 0xbd, 0xbc, 0xbc, 0xbc, 0xbc, 0xbb, 0xbc, 0xba, 0xbc,
+  0xbb, 0xab, 0x8a, 0x89, 0xa9, 0xaa, 0x50, 0x46, 0x13, 0x98, 0x28, 0x47,
+  0x33, 0x81, 0x09, 0x63, 0x25, 0x33, 0x22, 0x21, 0x65, 0x44, 0x23, 0x11,
+  0x22, 0x47, 0x23, 0x02, 0x10, 0x32, 0x15, 0x12, 0xaa, 0xeb, 0x9a, 0xaa,
+  0xfa, 0xbd, 0xad, 0xa9, 0x99, 0xcc, 0xbb, 0x9a, 0x98, 0x99, 0xab, 0x9a,
+  0x30, 0x62, 0x13, 0x11, 0x30, 0x47, 0x23, 0x02, 0x10, 0x42, 0x33, 0x13,
+  0x01, 0x11, 0x33, 0x54, 0x21, 0x00, 0x20, 0x63, 0x33, 0x02, 0x10, 0x31,
+  0x35, 0x01, 0x98, 0xaa, 0xb9, 0xdb, 0xcc, 0xcc, 0xbb, 0xbc, 0xbb, 0xbc,
+  0xbc, 0xbb, 0xab, 0xbb, 0xbb, 0xab, 0x9b, 0x89, 0x10, 0x21, 0x52, 0x63,
+  0x33, 0x35, 0x34, 0x43, 0x34, 0x43, 0x24, 0x33, 0x53, 0x42, 0x22, 0x32,
+  0x32, 0x33, 0x34, 0x22, 0x12, 0x11, 0x01, 0xa0, 0xfb, 0xbc, 0xbd, 0xbc,
+  0xdc, 0xcb, 0xbc, 0xbb, 0xdb, 0xcb, 0xcb, 0xaa, 0xab, 0xa9, 0xab, 0xab,
+  0x1b, 0x44, 0x34, 0x11, 0x50, 0x55, 0x33, 0x13, 0x11, 0x44, 0x34, 0x22,
+  0x13, 0x00, 0x63, 0x44, 0x23, 0x00, 0x20, 0x47, 0x43, 0x81, 0x00, 0x32,
+  0x25, 0x11, 0xa9, 0xdb, 0x8a, 0x9a, 0xfb, 0xbe, 0xbc, 0x99, 0xa9, 0xcd,
+  0xba, 0x8a, 0x89, 0x98, 0x9b, 0x8a, 0x21, 0x63, 0x13, 0x00, 0x28, 0x46,
+  0x23, 0x81, 0x08, 0x41, 0x33, 0x13, 0x10, 0x21, 0x44, 0x35, 0x23, 0x12,
+  0x42, 0x44, 0x33, 0x11, 0x01, 0x11, 0x23, 0xa0, 0xbc, 0xbd, 0xcb, 0xcb,
+  0xdb, 0xbb, 0xbc, 0xba, 0xbb, 0xbb, 0xbc, 0xaa, 0xa9, 0x99, 0x9a, 0x09,
+  0x00, 0x10, 0x21, 0x34, 0x44, 0x43, 0x53, 0x34, 0x42, 0x34, 0x33, 0x35,
+  0x33, 0x25, 0x33, 0x33, 0x24, 0x32, 0x32, 0x32, 0x22, 0x21, 0x11, 0x81,
+  0xbb, 0xaf, 0xcb, 0xbc, 0xcd, 0xcc, 0xbc, 0xbb, 0xcc, 0xcc, 0xcb, 0xba,
+  0xab, 0xbc, 0xcb, 0xab, 0x8b, 0x10, 0x11, 0x88, 0x71, 0x46, 0x33, 0x23,
+  0x32, 0x36, 0x25, 0x23, 0x12, 0x10, 0x42, 0x44, 0x12, 0x88, 0x19, 0x46,
+  0x24, 0x80, 0x08, 0x51, 0x23, 0x12, 0xa9, 0xbc, 0x8b, 0x9a, 0xfb, 0xdf,
+  0xab, 0x8a, 0xa9, 0xdc, 0xba, 0x89, 0x98, 0x90, 0x9b, 0x89, 0x30, 0x53,
+  0x22, 0x90, 0x18, 0x55, 0x23, 0x80, 0x88, 0x41, 0x34, 0x23, 0x12, 0x43,
+  0x36, 0x43, 0x33, 0x22, 0x23, 0x34, 0x33, 0x80, 0xb8, 0xaa, 0xb9, 0xce,
+  0xbd, 0xbb, 0xcb, 0xaa, 0x9d, 0xaa, 0x9a, 0x89, 0x8a, 0x88, 0x88, 0x80,
+  0x18, 0x11, 0x00, 0x00, 0x14, 0x10, 0x32, 0x33, 0x57, 0x21, 0x22, 0x33,
+  0x27, 0x11, 0x12, 0x32, 0x23, 0x23, 0x32, 0x54, 0x3a, 0x32, 0x33, 0x34,
+  0x5b, 0x34, 0x43, 0x53, 0x41, 0x34, 0x34, 0x43, 0x16, 0x12, 0x22, 0x12,
+  0x86, 0xaa, 0xbc, 0xcd, 0xc8, 0xbd, 0xcc, 0xcb, 0xb9, 0xca, 0xcb, 0xba,
+  0x9a, 0x08, 0x08, 0x08, 0x68, 0x44, 0x34, 0x33, 0x42, 0x42, 0x44, 0x23,
+  0x22, 0x11, 0x62, 0x43, 0x23, 0x10, 0x32, 0x54, 0x22, 0x02, 0x98, 0xbb,
+  0xb0, 0xbd, 0xee, 0xbc, 0xac, 0x9a, 0xbb, 0xbe, 0xba, 0x99, 0x89, 0xa8,
+  0x0a, 0x08, 0x33, 0x54, 0x22, 0x12, 0x41, 0x44, 0x14, 0x12, 0x21, 0x53,
+  0x24, 0x23, 0x32, 0x42, 0x23, 0x23, 0x02, 0xa8, 0xca, 0xbb, 0xcd, 0xcc,
+  0xbc, 0xba, 0xab, 0xcb, 0xbb, 0xaa, 0xa9, 0x88, 0x09, 0x00, 0x21, 0x34,
+  0x53, 0x34, 0x43, 0x43, 0x34, 0x43, 0x33, 0x24, 0x24, 0x22, 0x22, 0x12,
+  0x01, 0x98, 0xbb, 0xbe, 0xbd, 0xcc, 0xbb, 0xbc, 0xac, 0xbb, 0xac, 0xaa,
+  0x9a, 0x99, 0x88, 0x21, 0x52, 0x53, 0x34, 0x53, 0x32, 0x34, 0x34, 0x33,
+  0x42, 0x33, 0x34, 0x33, 0x32, 0x33, 0x34, 0x23, 0x03, 0xb0, 0xcf, 0xbc,
+  0xe9, 0xcc, 0xbc, 0xbc, 0xbb, 0xbc, 0xbc, 0xbb, 0x9a, 0x89, 0x00, 0x33,
+  0x51, 0x54, 0x44, 0x33, 0x22, 0x43, 0x44, 0x43, 0x22, 0x31, 0x43, 0x24,
+  0x32, 0x03, 0x81, 0x99, 0xc8, 0xbc, 0xdf, 0xcb, 0xbb, 0xbb, 0xcc, 0xcb,
+  0xaa, 0x99, 0x89, 0x88, 0x18, 0x30, 0x25, 0x53, 0x23, 0x23, 0x53, 0x43,
+  0x24, 0x21, 0x32, 0x33, 0x35, 0x21, 0x00, 0x80, 0xb8, 0xdb, 0xbc, 0xcd,
+  0xac, 0xab, 0xab, 0xbb, 0xac, 0x89, 0x18, 0x10, 0x31, 0x43, 0x43, 0x24,
+  0x25, 0x22, 0x22, 0x33, 0x26, 0x21, 0x11, 0x02, 0x03, 0x98, 0xba, 0xcc,
+  0xae, 0xbb, 0xcb, 0xab, 0x9e, 0x89, 0x88, 0x01, 0x20, 0x33, 0x35, 0x34,
+  0x43, 0x22, 0x22, 0x01, 0x94, 0xba, 0xbe, 0xcd, 0xc9, 0xcb, 0xba, 0xcb,
+  0xaa, 0x9a, 0x88, 0x18, 0x38, 0x45, 0x34, 0x34, 0x52, 0x43, 0x43, 0x43,
+  0x32, 0x24, 0x33, 0x33, 0x13, 0x90, 0xdb, 0xcc, 0xeb, 0xbc, 0xbd, 0xba,
+  0xcb, 0xab, 0xaa, 0x9b, 0x89, 0x31, 0x53, 0x24, 0x52, 0x53, 0x34, 0x33,
+  0x42, 0x34, 0x43, 0x23, 0x14, 0x11, 0x80, 0xa1, 0xba, 0xde, 0xcc, 0xbb,
+  0xbb, 0xbc, 0xad, 0xab, 0x99, 0x89, 0x80, 0x11, 0x51, 0x43, 0x43, 0x33,
+  0x24, 0x42, 0x42, 0x23, 0x22, 0x21, 0x22, 0x22, 0x81, 0xda, 0xcb, 0xcc,
+  0xcb, 0xbc, 0xcb, 0xbb, 0xab, 0xa9, 0x88, 0x08, 0x32, 0x44, 0x34, 0x33,
+  0x24, 0x43, 0x32, 0x32, 0x33, 0x24, 0x33, 0x23, 0x22, 0x80, 0xdb, 0xdc,
+  0xbc, 0xcc, 0xbb, 0xbc, 0xaa, 0x9b, 0x8a, 0x08, 0x22, 0x53, 0x33, 0x34,
+  0x34, 0x43, 0x33, 0x34, 0x33, 0x34, 0x32, 0x12, 0x90, 0xeb, 0xdc, 0xdb,
+  0xcb, 0xcb, 0xba, 0xba, 0xa9, 0x88, 0x10, 0x42, 0x43, 0x33, 0x34, 0x43,
+  0x43, 0x43, 0x34, 0x43, 0x44, 0x43, 0x22, 0x12, 0x00, 0xa8, 0xfb, 0xdc,
+  0xbb, 0xbc, 0xac, 0xab, 0xaa, 0x9a, 0x19, 0x41, 0x24, 0x23, 0x32, 0x54,
+  0x35, 0x22, 0x22, 0x44, 0x34, 0x24, 0x33, 0x12, 0x02, 0x01, 0x9a, 0xfd,
+  0xcc, 0xac, 0xaa, 0xba, 0xae, 0xaa, 0x89, 0x08, 0x80, 0x21, 0x41, 0x24,
+  0x43, 0x23, 0x13, 0x21, 0x53, 0x24, 0x11, 0x11, 0x32, 0x43, 0x12, 0xa8,
+  0xcb, 0xbc, 0xbe, 0xcc, 0xbb, 0xac, 0x9b, 0x89, 0x00, 0x10, 0x43, 0x34,
+  0x34, 0x22, 0x12, 0x21, 0x11, 0x01, 0x12, 0x33, 0x45, 0x43, 0x32, 0x11,
+  0xa8, 0xdc, 0xcc, 0xdb, 0xbb, 0xbb, 0xab, 0x89, 0x28, 0x32, 0x35, 0x24,
+  0x23, 0x11, 0x01, 0x09, 0x88, 0x32, 0x45, 0x44, 0x43, 0x33, 0x12, 0x98,
+  0xdc, 0xbd, 0xbd, 0xbc, 0xba, 0xaa, 0x89, 0x20, 0x42, 0x34, 0x23, 0x13,
+  0x01, 0x88, 0x18, 0x32, 0x54, 0x46, 0x55, 0x33, 0x24, 0x21, 0x10, 0x88,
+  0xfa, 0xbc, 0xad, 0xbb, 0xbb, 0x9b, 0x9a, 0x8a, 0x41, 0x44, 0x33, 0x01,
+  0x10, 0x73, 0x24, 0x81, 0x30, 0x54, 0x34, 0x43, 0x23, 0x12, 0x11, 0x82,
+  0xa0, 0xef, 0xbc, 0xac, 0xa9, 0xcb, 0xad, 0x8a, 0x88, 0x18, 0x00, 0x12,
+  0x43, 0x34, 0x33, 0x33, 0x82, 0x10, 0x63, 0x03, 0x80, 0x10, 0x44, 0x43,
+  0x11, 0x98, 0xa9, 0xda, 0xcc, 0xbc, 0xbc, 0xac, 0x8a, 0x08, 0x10, 0x32,
+  0x44, 0x34, 0x23, 0x02, 0x01, 0x88, 0xa9, 0xaa, 0x99, 0x20, 0x45, 0x34,
+  0x33, 0x13, 0x90, 0xfb, 0xcc, 0xdb, 0xba, 0xaa, 0x8a, 0x10, 0x43, 0x35,
+  0x33, 0x33, 0x01, 0xa9, 0xcc, 0xbd, 0xba, 0x99, 0x38, 0x45, 0x35, 0x33,
+  0x24, 0x81, 0xa8, 0xcc, 0xcc, 0xbb, 0xbb, 0x9a, 0x00, 0x42, 0x53, 0x33,
+  0x13, 0x90, 0xda, 0xcc, 0xab, 0x8a, 0x08, 0x52, 0x74, 0x43, 0x24, 0x21,
+  0x01, 0x00, 0xb9, 0xdd, 0xbb, 0xbb, 0xbb, 0x89, 0x90, 0x98, 0x20, 0x35,
+  0x24, 0xc9, 0xbc, 0x48, 0x34, 0x02, 0x61, 0x35, 0x44, 0x32, 0x13, 0x01,
+  0x89, 0xa8, 0x99, 0xcf, 0xcd, 0x8a, 0x89, 0xd9, 0xab, 0x9b, 0x98, 0x88,
+  0x99, 0x10, 0x64, 0x33, 0x25, 0x33, 0x01, 0x11, 0x24, 0xa0, 0xac, 0x8a,
+  0x11, 0x11, 0x80, 0x09, 0x20, 0xc8, 0xcf, 0xcb, 0xbc, 0xab, 0x88, 0x11,
+  0x31, 0x46, 0x34, 0x24, 0x11, 0x80, 0x98, 0xba, 0xbc, 0xbb, 0x99, 0x08,
+  0x43, 0x43, 0x23, 0x22, 0x98, 0xcc, 0xcc, 0xcb, 0x9a, 0x89, 0x20, 0x53,
+  0x44, 0x32, 0x22, 0x12, 0x99, 0xdb, 0xbc, 0xbc, 0xaa, 0x9b, 0x08, 0x32,
+  0x45, 0x43, 0x43, 0x12, 0x00, 0xa8, 0xcb, 0xbd, 0xba, 0x9b, 0x08, 0x42,
+  0x53, 0x34, 0x22, 0x80, 0xda, 0xcd, 0xbc, 0xaa, 0x9a, 0x08, 0x52, 0x46,
+  0x53, 0x12, 0x11, 0x01, 0x90, 0xcb, 0xcc, 0xba, 0x9a, 0x18, 0x12, 0x00,
+  0x80, 0x20, 0x93, 0xff, 0xaf, 0x08, 0x21, 0x10, 0x52, 0x34, 0x25, 0x23,
+  0x01, 0xa8, 0x9a, 0x9c, 0xb9, 0xdd, 0x9c, 0x00, 0x01, 0xcc, 0xaa, 0x8a,
+  0xb9, 0xb9, 0x8b, 0x41, 0x46, 0x53, 0x22, 0x12, 0x10, 0x11, 0xa0, 0xbe,
+  0xaa, 0x10, 0x00, 0x80, 0x10, 0x11, 0x91, 0xdc, 0xbc, 0xac, 0x99, 0x20,
+  0x33, 0x43, 0x55, 0x23, 0x02, 0x90, 0x99, 0xba, 0xcb, 0xba, 0x8a, 0x18,
+  0x23, 0x22, 0x11, 0x88, 0xaa, 0xda, 0xbb, 0xab, 0x11, 0x42, 0x33, 0x43,
+  0x34, 0x33, 0x23, 0x01, 0x09, 0xa9, 0xbf, 0xcc, 0xac, 0xab, 0x8a, 0x08,
+  0x12, 0x43, 0x35, 0x33, 0x13, 0x42, 0x44, 0x33, 0x80, 0xdb, 0xbb, 0xba,
+  0xea, 0x9b, 0x30, 0x67, 0x22, 0x90, 0xdd, 0xcc, 0xba, 0xbb, 0xbe, 0x19,
+  0x65, 0x24, 0x12, 0x33, 0x33, 0x81, 0xeb, 0xbc, 0xac, 0x89, 0x18, 0x02,
+  0x08, 0x50, 0x25, 0xfa, 0xbd, 0x89, 0x10, 0x08, 0x42, 0x55, 0x33, 0x24,
+  0x11, 0xa8, 0xba, 0x9c, 0xb9, 0xec, 0x8b, 0x22, 0x82, 0xbe, 0xaa, 0x98,
+  0xcb, 0xb9, 0x18, 0x72, 0x34, 0x33, 0x13, 0x01, 0x08, 0x90, 0xfb, 0x9c,
+  0x18, 0x02, 0x00, 0x08, 0x81, 0xa8, 0xdb, 0xcb, 0x9b, 0x18, 0x44, 0x33,
+  0x22, 0x33, 0x33, 0xb1, 0xbf, 0x99, 0x80, 0x90, 0x00, 0x00, 0x80, 0x98,
+  0xdb, 0xbb, 0x0a, 0x31, 0x35, 0x23, 0x22, 0x01, 0xba, 0xbe, 0xac, 0x09,
+  0x31, 0x44, 0x23, 0x23, 0x80, 0xcb, 0xbd, 0xbb, 0x9a, 0x30, 0x53, 0x34,
+  0x24, 0x03, 0xa8, 0xbe, 0xcb, 0x8a, 0x18, 0x42, 0x73, 0x43, 0x12, 0xa8,
+  0xcc, 0xab, 0x9b, 0x09, 0x00, 0x10, 0x74, 0x03, 0xfc, 0xad, 0x09, 0x11,
+  0x21, 0x63, 0x45, 0x33, 0x81, 0xb9, 0xdb, 0xac, 0x8a, 0x90, 0xb9, 0x71,
+  0x26, 0xb0, 0xad, 0x9a, 0x80, 0x8a, 0x20, 0x57, 0x53, 0x22, 0x01, 0x98,
+  0xca, 0x89, 0xba, 0xdd, 0x19, 0x32, 0xd1, 0xbb, 0x99, 0xb8, 0xac, 0x89,
+  0x33, 0x75, 0x32, 0x12, 0x80, 0x98, 0x88, 0xb9, 0xbd, 0x29, 0x53, 0x81,
+  0x99, 0x88, 0xb9, 0xbc, 0x9a, 0x08, 0x62, 0x44, 0x12, 0x80, 0x80, 0x88,
+  0xb9, 0xbb, 0x28, 0x34, 0x02, 0xa9, 0xb9, 0xdb, 0xbb, 0x89, 0x31, 0x45,
+  0x25, 0x01, 0xa8, 0xb9, 0xbb, 0xab, 0x09, 0x32, 0x25, 0x23, 0x01, 0xa9,
+  0xab, 0x18, 0x31, 0x41, 0x42, 0x11, 0xeb, 0xac, 0x08, 0x63, 0x44, 0x33,
+  0x03, 0xda, 0xbd, 0xbd, 0xbb, 0x09, 0x64, 0x34, 0x23, 0x01, 0xb8, 0xbd,
+  0xbc, 0xac, 0x8a, 0x54, 0x24, 0xa0, 0xcb, 0x8a, 0x98, 0xcc, 0x49, 0x47,
+  0x33, 0x11, 0x00, 0xcb, 0x9d, 0x89, 0xda, 0x8a, 0x54, 0x13, 0xba, 0xac,
+  0x89, 0xaa, 0xb9, 0x70, 0x46, 0x24, 0x21, 0x80, 0xb8, 0x9c, 0x98, 0xfb,
+  0x8b, 0x32, 0x83, 0xcd, 0x99, 0x98, 0xca, 0x98, 0x31, 0x53, 0x35, 0x22,
+  0x90, 0x98, 0x89, 0xb8, 0xcb, 0x0a, 0x45, 0x02, 0xaa, 0x8a, 0x99, 0xbc,
+  0x0a, 0x20, 0x42, 0x36, 0x13, 0xa0, 0x99, 0x80, 0xaa, 0xab, 0x30, 0x36,
+  0x82, 0xa9, 0xbb, 0xcb, 0xab, 0x09, 0x41, 0x44, 0x24, 0x02, 0xa9, 0xba,
+  0xbb, 0xbb, 0x09, 0x41, 0x43, 0x12, 0x02, 0xa8, 0xba, 0x8a, 0x32, 0x43,
+  0x32, 0x33, 0xa0, 0xcf, 0x99, 0x20, 0x63, 0x44, 0x32, 0x91, 0xdc, 0xdb,
+  0xbb, 0xbb, 0x20, 0x57, 0x33, 0x22, 0x81, 0xda, 0xcb, 0xbb, 0xbc, 0x29,
+  0x46, 0x13, 0xa8, 0xbc, 0x98, 0xc8, 0xac, 0x70, 0x45, 0x22, 0x11, 0x90,
+  0xdb, 0xaa, 0xa8, 0xdc, 0x29, 0x45, 0x92, 0xba, 0x9b, 0xa8, 0xaa, 0xab,
+  0x75, 0x45, 0x23, 0x12, 0x80, 0xda, 0x8a, 0xb8, 0xdc, 0x1b, 0x43, 0xa1,
+  0xad, 0x8a, 0xa8, 0xbb, 0x88, 0x52, 0x63, 0x24, 0x12, 0x98, 0x98, 0x88,
+  0xb9, 0xca, 0x39, 0x35, 0x92, 0xbb, 0x89, 0xba, 0xad, 0x09, 0x21, 0x73,
+  0x43, 0x01, 0x98, 0x89, 0x98, 0xa9, 0x8a, 0x41, 0x24, 0x81, 0xba, 0xba,
+  0xcb, 0xab, 0x18, 0x42, 0x35, 0x24, 0x81, 0xa8, 0xba, 0xbb, 0xab, 0x09,
+  0x41, 0x43, 0x01, 0x10, 0x80, 0xa9, 0x9b, 0x22, 0x33, 0x42, 0x34, 0xb1,
+  0xae, 0x0a, 0x11, 0x51, 0x56, 0x43, 0x00, 0xca, 0xcc, 0xac, 0xbb, 0x09,
+  0x73, 0x35, 0x33, 0x11, 0xb9, 0xcd, 0xba, 0xdb, 0x8a, 0x62, 0x43, 0x80,
+  0xba, 0x9b, 0x98, 0xcd, 0x1a, 0x57, 0x33, 0x22, 0x01, 0xca, 0xbc, 0x99,
+  0xdb, 0x9c, 0x63, 0x23, 0xb9, 0xbb, 0x8a, 0xca, 0xb9, 0x79, 0x55, 0x24,
+  0x12, 0x81, 0xb8, 0x9c, 0x98, 0xeb, 0x9c, 0x31, 0x13, 0xdc, 0x99, 0x09,
+  0xbb, 0x99, 0x40, 0x52, 0x44, 0x12, 0x91, 0x98, 0x09, 0xa8, 0xbb, 0x0b,
+  0x36, 0x13, 0xbb, 0x9a, 0xa9, 0xbd, 0x8a, 0x21, 0x52, 0x54, 0x12, 0x98,
+  0x99, 0x08, 0x99, 0xaa, 0x20, 0x35, 0x02, 0xb9, 0xba, 0xcb, 0xbb, 0x0a,
+  0x32, 0x45, 0x34, 0x02, 0x98, 0xab, 0xbb, 0xac, 0x89, 0x20, 0x33, 0x23,
+  0x11, 0x80, 0xc8, 0xaa, 0x28, 0x34, 0x11, 0x43, 0x02, 0xeb, 0x9a, 0x00,
+  0x20, 0x65, 0x35, 0x02, 0xa9, 0xcd, 0xbc, 0xac, 0x9a, 0x62, 0x44, 0x23,
+  0x12, 0xa0, 0xcc, 0xac, 0xcb, 0x9a, 0x41, 0x36, 0x81, 0xaa, 0x9b, 0x98,
+  0xec, 0x0a, 0x65, 0x43, 0x11, 0x01, 0xb8, 0xbc, 0x9a, 0xdb, 0xac, 0x63,
+  0x23, 0xb8, 0xbb, 0x0b, 0xca, 0xaa, 0x6a, 0x56, 0x24, 0x12, 0x01, 0xa9,
+  0x9c, 0xa8, 0xdb, 0x9d, 0x31, 0x13, 0xbd, 0x9b, 0x89, 0xcb, 0x99, 0x40,
+  0x52, 0x44, 0x12, 0x91, 0x98, 0x89, 0x98, 0xba, 0x0c, 0x44, 0x12, 0xba,
+  0x9a, 0xa8, 0xbc, 0x89, 0x20, 0x43, 0x36, 0x23, 0xa8, 0x9a, 0x80, 0xa9,
+  0x9b, 0x30, 0x36, 0x02, 0xb9, 0xcb, 0xbb, 0xab, 0x19, 0x41, 0x44, 0x34,
+  0x01, 0xa8, 0xbb, 0xbb, 0xab, 0x09, 0x41, 0x43, 0x12, 0x01, 0xa8, 0xbb,
+  0x0a, 0x32, 0x24, 0x34, 0x24, 0x98, 0xbe, 0x8c, 0x38, 0x54, 0x34, 0x13,
+  0xa0, 0xcd, 0xcc, 0xcb, 0x9a, 0x51, 0x44, 0x23, 0x12, 0xa0, 0xdb, 0xbc,
+  0xbc, 0x8b, 0x62, 0x24, 0x81, 0xba, 0x8a, 0xa8, 0xce, 0x1a, 0x57, 0x23,
+  0x12, 0x01, 0xc9, 0xbc, 0x99, 0xdb, 0x8c, 0x63, 0x13, 0xb9, 0xbb, 0x88,
+  0xca, 0xaa, 0x78, 0x36, 0x25, 0x12, 0x81, 0xb9, 0x8c, 0xa8, 0xdc, 0x8b,
+  0x42, 0x82, 0xbd, 0x99, 0x98, 0xac, 0x89, 0x41, 0x52, 0x34, 0x22, 0x90,
+  0x99, 0x09, 0xa9, 0xcb, 0x2a, 0x45, 0x82, 0xba, 0x99, 0xb9, 0xac, 0x89,
+  0x21, 0x53, 0x45, 0x11, 0x99, 0x89, 0x08, 0x99, 0x8a, 0x30, 0x25, 0x82,
+  0xba, 0xac, 0xab, 0x9a, 0x18, 0x42, 0x35, 0x33, 0x81, 0xca, 0xbb, 0xab,
+  0x9a, 0x10, 0x43, 0x34, 0x02, 0x98, 0xab, 0x9a, 0x00, 0x53, 0x24, 0x11,
+  0x89, 0xca, 0xac, 0x19, 0x65, 0x33, 0x22, 0x98, 0xcc, 0xcd, 0xcb, 0x8a,
+  0x52, 0x34, 0x24, 0x01, 0xa8, 0xcb, 0xcc, 0xcb, 0x0a, 0x63, 0x23, 0xa0,
+  0xba, 0x89, 0xb8, 0xcf, 0x49, 0x46, 0x23, 0x11, 0x81, 0xdb, 0xab, 0xa9,
+  0xcd, 0x1a, 0x45, 0x02, 0xaa, 0xab, 0x98, 0xbb, 0xbb, 0x74, 0x46, 0x14,
+  0x21, 0x90, 0xb9, 0x8b, 0xa9, 0xed, 0x0a, 0x23, 0xa2, 0xbd, 0x99, 0xa8,
+  0xac, 0x89, 0x43, 0x63, 0x24, 0x12, 0x98, 0x98, 0x09, 0xb9, 0xca, 0x38,
+  0x35, 0x92, 0xbb, 0x9a, 0xca, 0xac, 0x08, 0x21, 0x63, 0x34, 0x82, 0x99,
+  0x8a, 0x80, 0xa9, 0x89, 0x51, 0x24, 0x80, 0xbb, 0xbb, 0xbb, 0x9a, 0x20,
+  0x44, 0x44, 0x22, 0x90, 0xbb, 0xac, 0x9a, 0x09, 0x20, 0x43, 0x33, 0x82,
+  0xb9, 0xaa, 0x99, 0x18, 0x63, 0x14, 0x80, 0xa9, 0xdb, 0xbb, 0x62, 0x45,
+  0x23, 0x11, 0xa9, 0xec, 0xdb, 0xab, 0x19, 0x54, 0x24, 0x13, 0x01, 0xba,
+  0xcc, 0xcc, 0xbb, 0x28, 0x36, 0x13, 0xb8, 0x9a, 0x88, 0xfb, 0x9d, 0x61,
+  0x44, 0x12, 0x11, 0x90, 0xbc, 0x9b, 0xcb, 0xbe, 0x30, 0x36, 0x91, 0xab,
+  0x8b, 0xa8, 0xbb, 0x0d, 0x56, 0x44, 0x22, 0x12, 0x98, 0xdb, 0x88, 0xba,
+  0xdd, 0x28, 0x23, 0xd8, 0xaa, 0x89, 0xb9, 0x8c, 0x08, 0x24, 0x45, 0x23,
+  0x01, 0x89, 0xa9, 0x80, 0xba, 0xbb, 0x72, 0x14, 0xa0, 0x9b, 0x99, 0xca,
+  0x9a, 0x10, 0x22, 0x45, 0x24, 0x90, 0xa9, 0x88, 0x90, 0xa8, 0x18, 0x63,
+  0x12, 0xa8, 0xcb, 0xaa, 0x9a, 0x09, 0x30, 0x44, 0x33, 0x03, 0xb9, 0xbc,
+  0xbb, 0x9a, 0x00, 0x42, 0x53, 0x22, 0x88, 0xba, 0x99, 0x89, 0x20, 0x34,
+  0x22, 0x80, 0xba, 0xce, 0x9b, 0x51, 0x45, 0x13, 0x02, 0xa8, 0xdc, 0xcc,
+  0xbb, 0x28, 0x45, 0x24, 0x23, 0x81, 0xba, 0xcd, 0xcc, 0xab, 0x38, 0x45,
+  0x02, 0xa8, 0x89, 0x80, 0xdc, 0x9c, 0x72, 0x34, 0x12, 0x12, 0xa8, 0xcc,
+  0x9a, 0xcb, 0xae, 0x31, 0x35, 0xa0, 0xaa, 0x8a, 0xb8, 0xcb, 0x2b, 0x67,
+  0x34, 0x13, 0x03, 0x99, 0xbc, 0x89, 0xdb, 0xae, 0x20, 0x33, 0xea, 0x9a,
+  0x89, 0xc9, 0x99, 0x10, 0x43, 0x45, 0x22, 0x81, 0x99, 0x99, 0x80, 0xba,
+  0x9a, 0x64, 0x12, 0xb8, 0xab, 0xa9, 0xcb, 0x8a, 0x21, 0x42, 0x54, 0x13,
+  0xa0, 0x9a, 0x88, 0x90, 0x89, 0x38, 0x54, 0x02, 0xb9, 0xac, 0xab, 0xa9,
+  0x00, 0x32, 0x44, 0x33, 0x02, 0xca, 0xac, 0x9a, 0x89, 0x18, 0x32, 0x53,
+  0x12, 0xa8, 0xaa, 0x89, 0x09, 0x30, 0x34, 0x04, 0x89, 0xc9, 0xbd, 0x0b,
+  0x64, 0x34, 0x32, 0x01, 0xc9, 0xcd, 0xcc, 0x9b, 0x30, 0x36, 0x24, 0x22,
+  0x90, 0xcb, 0xdc, 0xdb, 0x8a, 0x41, 0x33, 0x82, 0x9a, 0x00, 0xc8, 0xbf,
+  0x2b, 0x47, 0x33, 0x22, 0x11, 0xda, 0xac, 0xa9, 0xcd, 0x8a, 0x44, 0x13,
+  0xaa, 0xaa, 0x88, 0xbb, 0xdb, 0x71, 0x54, 0x33, 0x22, 0x80, 0xd9, 0x9a,
+  0xb8, 0xfb, 0x0b, 0x33, 0x92, 0xaf, 0x99, 0x98, 0xab, 0x88, 0x33, 0x55,
+  0x24, 0x12, 0x89, 0x99, 0x09, 0xa8, 0xba, 0x48, 0x35, 0x92, 0xbc, 0x9a,
+  0xb9, 0xbb, 0x28, 0x32, 0x55, 0x43, 0x81, 0xa9, 0x8a, 0x00, 0x98, 0x08,
+  0x53, 0x33, 0xa0, 0xbd, 0xab, 0xab, 0x09, 0x21, 0x44, 0x33, 0x13, 0xb8,
+  0xcc, 0xab, 0x89, 0x18, 0x31, 0x44, 0x12, 0x98, 0xaa, 0x99, 0x99, 0x30,
+  0x35, 0x03, 0xa8, 0xb9, 0xcd, 0x9a, 0x63, 0x35, 0x22, 0x00, 0xa8, 0xde,
+  0xac, 0x8b, 0x41, 0x44, 0x32, 0x12, 0xb0, 0xeb, 0xbc, 0xbd, 0x0a, 0x63,
+  0x22, 0x80, 0x89, 0x10, 0xfa, 0xac, 0x40, 0x45, 0x22, 0x22, 0x80, 0xcc,
+  0xaa, 0xca, 0xbd, 0x39, 0x45, 0x81, 0x9a, 0x8a, 0xb0, 0xba, 0x0d, 0x64,
+  0x35, 0x23, 0x13, 0x98, 0xcc, 0x88, 0xca, 0xcc, 0x28, 0x33, 0xe8, 0x9b,
+  0x99, 0xb8, 0x9b, 0x18, 0x35, 0x64, 0x22, 0x81, 0x98, 0x99, 0x80, 0xa9,
+  0x9a, 0x72, 0x23, 0xb9, 0xbb, 0x9a, 0xcb, 0x8b, 0x21, 0x33, 0x46, 0x23,
+  0xa0, 0xaa, 0x09, 0x80, 0x88, 0x30, 0x45, 0x02, 0xc9, 0xbb, 0xbb, 0x9a,
+  0x28, 0x52, 0x33, 0x33, 0x82, 0xcc, 0xbb, 0x9a, 0x08, 0x20, 0x25, 0x23,
+  0x81, 0xa9, 0xaa, 0x9b, 0x29, 0x45, 0x23, 0x98, 0xdb, 0xbb, 0xab, 0x71,
+  0x54, 0x23, 0x11, 0xa8, 0xec, 0xbc, 0x9b, 0x31, 0x45, 0x24, 0x22, 0xa0,
+  0xda, 0xcc, 0xcc, 0x89, 0x42, 0x23, 0x80, 0x08, 0x01, 0xf9, 0xbc, 0x38,
+  0x47, 0x13, 0x22, 0x82, 0xbc, 0xac, 0xca, 0xcd, 0x29, 0x53, 0x82, 0x9a,
+  0x89, 0xa0, 0xba, 0x9d, 0x54, 0x55, 0x12, 0x12, 0x88, 0xca, 0x89, 0xaa,
+  0xce, 0x29, 0x32, 0xd1, 0xab, 0x8a, 0xb8, 0x9c, 0x18, 0x43, 0x73, 0x23,
+  0x01, 0x99, 0x99, 0x00, 0x98, 0xa9, 0x62, 0x24, 0xb0, 0xbc, 0x9a, 0xaa,
+  0x9a, 0x20, 0x33, 0x44, 0x33, 0xa1, 0xbc, 0x09, 0x21, 0x21, 0x31, 0x54,
+  0x12, 0xc9, 0xbc, 0x9b, 0x99, 0x10, 0x32, 0x23, 0x22, 0x90, 0xdb, 0xac,
+  0x89, 0x20, 0x32, 0x43, 0x12, 0x88, 0xaa, 0xab, 0xaa, 0x19, 0x34, 0x33,
+  0x81, 0xda, 0xbc, 0xbb, 0x9b, 0x72, 0x44, 0x34, 0x31, 0x90, 0xdd, 0xac,
+  0x89, 0x10, 0x43, 0x35, 0x22, 0xa1, 0xed, 0xbd, 0xab, 0x28, 0x34, 0x43,
+  0x42, 0x34, 0x92, 0xec, 0x8a, 0x30, 0x33, 0x32, 0x34, 0xc0, 0xbd, 0xbc,
+  0xcf, 0x9b, 0x31, 0x15, 0x80, 0x10, 0x21, 0xa8, 0xc9, 0x3a, 0x57, 0x24,
+  0x22, 0x02, 0xa9, 0xac, 0xb9, 0xfb, 0xac, 0x21, 0x13, 0xeb, 0xaa, 0x89,
+  0xba, 0x8a, 0x38, 0x44, 0x44, 0x22, 0x81, 0x99, 0x89, 0x22, 0x11, 0x00,
+  0x64, 0x13, 0xc9, 0xbc, 0xa9, 0x99, 0x89, 0x12, 0x02, 0x10, 0x02, 0xea,
+  0xac, 0x18, 0x42, 0x33, 0x21, 0x12, 0x01, 0xca, 0xac, 0x0a, 0x20, 0x33,
+  0x23, 0x90, 0xbb, 0xdb, 0xab, 0x89, 0x30, 0x34, 0x12, 0x98, 0xbb, 0xbb,
+  0x39, 0x36, 0x23, 0x01, 0xb9, 0xcb, 0xa9, 0x42, 0x37, 0x24, 0x91, 0xcb,
+  0xbb, 0x8b, 0x73, 0x34, 0x12, 0xb9, 0xdc, 0xdc, 0xab, 0x0a, 0x53, 0x44,
+  0x22, 0xa0, 0xcc, 0x8a, 0x11, 0x31, 0x65, 0x54, 0x23, 0x90, 0xcc, 0x9a,
+  0x89, 0xa9, 0x28, 0x33, 0xa9, 0xcc, 0xfd, 0xcc, 0x89, 0x31, 0x14, 0x11,
+  0x33, 0x25, 0x90, 0xaa, 0x48, 0x64, 0x43, 0x21, 0x82, 0xb9, 0xad, 0xa9,
+  0xcd, 0xab, 0x21, 0x03, 0xdd, 0x9a, 0x8a, 0xca, 0x88, 0x28, 0x23, 0x36,
+  0x20, 0x80, 0x89, 0x18, 0x42, 0x33, 0x10, 0x44, 0x38, 0xb8, 0xbc, 0x89,
+  0x89, 0x09, 0x31, 0x81, 0xab, 0xa9, 0xec, 0xac, 0x20, 0x34, 0x11, 0x98,
+  0x8b, 0x21, 0x23, 0x43, 0x17, 0x02, 0x00, 0x10, 0x32, 0x35, 0x23, 0x91,
+  0xb9, 0x99, 0x10, 0x22, 0xa1, 0xed, 0xbc, 0xbb, 0xab, 0x89, 0xb9, 0xce,
+  0xcc, 0xba, 0x9a, 0x88, 0xa8, 0xeb, 0xcb, 0xba, 0x89, 0x10, 0x11, 0x90,
+  0xdb, 0x9b, 0x72, 0x44, 0x33, 0x12, 0x80, 0x31, 0x45, 0x34, 0x43, 0x23,
+  0x80, 0xcb, 0x8b, 0x74, 0x13, 0xa8, 0xcb, 0xbc, 0x19, 0x35, 0x90, 0x8a,
+  0x34, 0xb1, 0x0c, 0x65, 0x34, 0x42, 0x02, 0x88, 0x59, 0x36, 0x32, 0x80,
+  0x98, 0x40, 0xb1, 0xaa, 0x2a, 0xf2, 0x9c, 0xbc, 0xfc, 0x8a, 0x00, 0xc0,
+  0xac, 0xa9, 0x98, 0x0b, 0x91, 0x99, 0x0a, 0x04, 0x09, 0x89, 0x46, 0x43,
+  0x02, 0x88, 0x28, 0x24, 0x43, 0x23, 0x90, 0x0a, 0x32, 0xa0, 0x0a, 0x35,
+  0x92, 0xcb, 0xcb, 0x8a, 0x41, 0x24, 0xa0, 0xaa, 0x08, 0x42, 0x34, 0x43,
+  0x23, 0x12, 0x00, 0x31, 0x36, 0x44, 0x02, 0x98, 0x99, 0x89, 0x20, 0x01,
+  0xc8, 0xcd, 0xcb, 0xab, 0x99, 0x99, 0xdb, 0xbd, 0xcb, 0xab, 0x8a, 0x99,
+  0xcb, 0xbd, 0xcb, 0x9a, 0x08, 0x02, 0x80, 0xcb, 0xbb, 0x61, 0x45, 0x43,
+  0x21, 0x00, 0x20, 0x44, 0x34, 0x34, 0x32, 0x81, 0xbb, 0x0c, 0x64, 0x23,
+  0xa0, 0xbc, 0xbc, 0x1a, 0x36, 0xa1, 0x0b, 0x63, 0xb1, 0x0b, 0x55, 0x34,
+  0x43, 0x02, 0x98, 0x58, 0x27, 0x23, 0x90, 0x90, 0x30, 0xb1, 0xba, 0x4b,
+  0xf0, 0xab, 0xbc, 0xee, 0x8a, 0x01, 0xc8, 0xac, 0x99, 0x99, 0x0a, 0x91,
+  0x99, 0x0a, 0x04, 0x89, 0x88, 0x46, 0x53, 0x81, 0x88, 0x20, 0x32, 0x43,
+  0x23, 0x98, 0x1a, 0x22, 0xb0, 0x1a, 0x36, 0x91, 0xbb, 0xbc, 0x8a, 0x52,
+  0x24, 0x90, 0xa9, 0x18, 0x52, 0x43, 0x33, 0x43, 0x11, 0x11, 0x31, 0x44,
+  0x24, 0x13, 0x98, 0xaa, 0x09, 0x00, 0x90, 0xcc, 0xdc, 0xbb, 0xbb, 0xbb,
+  0xbd, 0xcc, 0xbb, 0xcb, 0xaa, 0xab, 0xbc, 0xcc, 0xba, 0x99, 0x09, 0x00,
+  0xb9, 0xad, 0x29, 0x46, 0x34, 0x23, 0x12, 0x21, 0x54, 0x34, 0x34, 0x43,
+  0x12, 0xa0, 0xba, 0x61, 0x35, 0x82, 0xbb, 0xbc, 0xab, 0x72, 0x03, 0xba,
+  0x30, 0x06, 0xba, 0x48, 0x47, 0x22, 0x23, 0x80, 0x8a, 0x57, 0x32, 0x02,
+  0x09, 0x09, 0x04, 0xaa, 0x9b, 0x83, 0xbf, 0xda, 0xeb, 0xad, 0x00, 0x80,
+  0xbd, 0xaa, 0x99, 0xaa, 0x10, 0x99, 0xb9, 0x51, 0x90, 0x98, 0x60, 0x34,
+  0x24, 0x98, 0x08, 0x42, 0x32, 0x33, 0x02, 0xab, 0x31, 0x82, 0xbb, 0x71,
+  0x13, 0xb9, 0xac, 0xab, 0x38, 0x37, 0x01, 0xa8, 0x08, 0x31, 0x35, 0x24,
+  0x24, 0x23, 0x01, 0x11, 0x32, 0x45, 0x33, 0x81, 0xa9, 0xaa, 0x9a, 0x99,
+  0xb9, 0xce, 0xbc, 0xbd, 0xac, 0xbb, 0xba, 0xbb, 0xbd, 0xdb, 0xcb, 0xab,
+  0xab, 0x99, 0x88, 0xa9, 0xcb, 0xcb, 0x09, 0x55, 0x34, 0x23, 0x11, 0x20,
+  0x73, 0x34, 0x43, 0x33, 0x23, 0x91, 0xaa, 0x68, 0x45, 0x12, 0xb9, 0xcb,
+  0xab, 0x50, 0x14, 0xb8, 0x29, 0x24, 0xcb, 0x29, 0x57, 0x32, 0x33, 0x81,
+  0xaa, 0x74, 0x34, 0x13, 0x09, 0x89, 0x23, 0xaa, 0xbc, 0x32, 0xce, 0xba,
+  0xbd, 0xdf, 0x08, 0x00, 0xca, 0x9b, 0x9a, 0xa9, 0x18, 0xa0, 0xa9, 0x49,
+  0x92, 0x89, 0x39, 0x57, 0x23, 0x91, 0x88, 0x31, 0x43, 0x43, 0x02, 0xa9,
+  0x18, 0x03, 0xb9, 0x38, 0x26, 0xa0, 0xac, 0xab, 0x29, 0x54, 0x13, 0x90,
+  0x99, 0x31, 0x44, 0x43, 0x43, 0x23, 0x11, 0x00, 0x31, 0x35, 0x34, 0x01,
+  0xb8, 0xba, 0xaa, 0x89, 0xb8, 0xcc, 0xcd, 0xcc, 0xbb, 0xbb, 0xaa, 0xab,
+  0xcc, 0xcc, 0xbb, 0xbb, 0xaa, 0x89, 0x89, 0xb9, 0xbd, 0xac, 0x20, 0x46,
+  0x24, 0x13, 0x10, 0x20, 0x45, 0x34, 0x34, 0x33, 0x12, 0xa0, 0x9a, 0x72,
+  0x26, 0x01, 0xaa, 0xcb, 0x9a, 0x62, 0x02, 0xaa, 0x30, 0x84, 0xbc, 0x51,
+  0x45, 0x32, 0x24, 0x88, 0x8a, 0x47, 0x33, 0x82, 0x88, 0x19, 0x85, 0x9a,
+  0x8b, 0x83, 0xaf, 0xcb, 0xfb, 0x9d, 0x08, 0x81, 0xcc, 0x9a, 0x99, 0xa9,
+  0x10, 0x99, 0x99, 0x40, 0x90, 0x98, 0x60, 0x34, 0x24, 0x98, 0x88, 0x33,
+  0x43, 0x43, 0x81, 0xa9, 0x20, 0x82, 0xaa, 0x51, 0x13, 0xb9, 0xad, 0x9a,
+  0x38, 0x45, 0x12, 0x99, 0x09, 0x32, 0x45, 0x42, 0x32, 0x23, 0x01, 0x20,
+  0x42, 0x34, 0x24, 0x01, 0xaa, 0xbb, 0x99, 0x89, 0xb9, 0xdd, 0xcc, 0xbc,
+  0xcb, 0xaa, 0xa9, 0xba, 0xcc, 0xbc, 0xac, 0xaa, 0x99, 0x09, 0x98, 0xba,
+  0xbd, 0x99, 0x62, 0x44, 0x23, 0x11, 0x01, 0x42, 0x45, 0x43, 0x33, 0x33,
+  0x01, 0xa9, 0x19, 0x57, 0x23, 0x98, 0xca, 0xcb, 0x29, 0x44, 0xa0, 0x0a,
+  0x43, 0xc0, 0x8b, 0x64, 0x34, 0x42, 0x02, 0x99, 0x69, 0x25, 0x24, 0x88,
+  0x88, 0x30, 0xa0, 0xba, 0x3a, 0xf1, 0x9c, 0xbc, 0xed, 0x0b, 0x10, 0xc8,
+  0x9d, 0xa9, 0x98, 0x89, 0x81, 0x99, 0x0a, 0x13, 0x8a, 0x09, 0x47, 0x43,
+  0x82, 0x89, 0x28, 0x24, 0x42, 0x22, 0xa0, 0x0a, 0x12, 0xa0, 0x0a, 0x35,
+  0x92, 0xcb, 0xab, 0x8a, 0x63, 0x25, 0x80, 0x89, 0x18, 0x43, 0x53, 0x32,
+  0x24, 0x11, 0x00, 0x21, 0x43, 0x34, 0x13, 0xa8, 0xcb, 0xaa, 0x89, 0x88,
+  0xca, 0xdd, 0xdb, 0xbb, 0xab, 0x9b, 0xba, 0xcc, 0xcc, 0xbb, 0xbb, 0xa9,
+  0x88, 0x88, 0xca, 0xbc, 0x9b, 0x51, 0x35, 0x34, 0x12, 0x00, 0x32, 0x37,
+  0x44, 0x32, 0x14, 0x01, 0x99, 0x19, 0x46, 0x23, 0xa0, 0xba, 0xad, 0x2a,
+  0x45, 0x90, 0x8a, 0x42, 0xc0, 0x0b, 0x73, 0x34, 0x42, 0x82, 0xa8, 0x58,
+  0x36, 0x23, 0x90, 0x98, 0x40, 0xa0, 0xaa, 0x3a, 0xf0, 0xbb, 0xcc, 0xde,
+  0x0a, 0x00, 0xc0, 0x9d, 0x99, 0xa8, 0x09, 0x91, 0x98, 0x1a, 0x02, 0x89,
+  0x09, 0x56, 0x43, 0x81, 0x88, 0x28, 0x33, 0x53, 0x22, 0xa8, 0x89, 0x22,
+  0xa0, 0x1b, 0x45, 0x81, 0xbb, 0xba, 0x0a, 0x73, 0x24, 0x81, 0x99, 0x10,
+  0x43, 0x34, 0x24, 0x33, 0x12, 0x00, 0x21, 0x44, 0x43, 0x12, 0xa9, 0xcb,
+  0x9b, 0x89, 0x88, 0xda, 0xcd, 0xbc, 0xac, 0xaa, 0x99, 0xaa, 0xcd, 0xbb,
+  0xbc, 0x9a, 0x88, 0x90, 0xa9, 0xcc, 0x9b, 0x30, 0x55, 0x32, 0x21, 0x00,
+  0x41, 0x54, 0x43, 0x33, 0x43, 0x01, 0x99, 0x19, 0x56, 0x23, 0x98, 0xaa,
+  0xbc, 0x29, 0x45, 0x91, 0x8b, 0x42, 0xb1, 0x8d, 0x63, 0x25, 0x32, 0x03,
+  0xa9, 0x59, 0x37, 0x23, 0x80, 0x98, 0x48, 0xa1, 0xab, 0x2a, 0xf2, 0xab,
+  0xbd, 0xed, 0x8b, 0x10, 0xb0, 0xaf, 0x99, 0x98, 0x89, 0x81, 0x99, 0x89,
+  0x03, 0x89, 0x99, 0x65, 0x43, 0x82, 0x88, 0x08, 0x24, 0x32, 0x23, 0xa1,
+  0x8a, 0x32, 0xb0, 0x0c, 0x44, 0x02, 0xba, 0xbb, 0x9a, 0x73, 0x34, 0x01,
+  0x98, 0x10, 0x42, 0x34, 0x34, 0x24, 0x02, 0x01, 0x20, 0x42, 0x43, 0x13,
+  0xa9, 0xbc, 0xaa, 0x8a, 0x98, 0xeb, 0xcd, 0xbc, 0xab, 0x9b, 0xab, 0xcb,
+  0xcc, 0xbc, 0xba, 0x99, 0x88, 0x98, 0xcb, 0xac, 0x0a, 0x53, 0x34, 0x22,
+  0x02, 0x21, 0x54, 0x35, 0x34, 0x33, 0x23, 0x80, 0x99, 0x71, 0x45, 0x01,
+  0xa8, 0xba, 0xaa, 0x52, 0x15, 0xb8, 0x19, 0x23, 0xda, 0x29, 0x47, 0x33,
+  0x43, 0x80, 0x9a, 0x72, 0x26, 0x12, 0x89, 0x88, 0x21, 0xa9, 0xba, 0x31,
+  0xfc, 0xb9, 0xcc, 0xbe, 0x09, 0x10, 0xfa, 0xaa, 0x99, 0xa8, 0x08, 0x90,
+  0xa8, 0x29, 0x82, 0x99, 0x39, 0x57, 0x43, 0x80, 0x98, 0x30, 0x32, 0x53,
+  0x12, 0xa8, 0x19, 0x02, 0xa9, 0x39, 0x35, 0x91, 0xbb, 0xbc, 0x09, 0x55,
+  0x23, 0x81, 0x89, 0x20, 0x34, 0x44, 0x33, 0x24, 0x11, 0x18, 0x20, 0x34,
+  0x34, 0x82, 0xc9, 0xbb, 0xaa, 0x88, 0x99, 0xcd, 0xbe, 0xbc, 0xbb, 0xaa,
+  0xa9, 0xbc, 0xcd, 0xbb, 0xbb, 0x89, 0x88, 0xa9, 0xcb, 0xad, 0x0a, 0x53,
+  0x34, 0x13, 0x11, 0x00, 0x54, 0x35, 0x34, 0x33, 0x22, 0x80, 0x99, 0x71,
+  0x35, 0x03, 0xa9, 0xcb, 0xab, 0x41, 0x26, 0xa8, 0x0a, 0x23, 0xd8, 0x1a,
+  0x56, 0x23, 0x34, 0x91, 0xa9, 0x70, 0x35, 0x13, 0x88, 0x99, 0x31, 0xb0,
+  0xba, 0x49, 0xf9, 0xba, 0xbd, 0xde, 0x0a, 0x10, 0xc8, 0x9d, 0x99, 0x99,
+  0x09, 0x80, 0x99, 0x09, 0x03, 0x99, 0x89, 0x66, 0x23, 0x83, 0x99, 0x10,
+  0x24, 0x43, 0x22, 0x90, 0x89, 0x21, 0xb8, 0x0a, 0x46, 0x01, 0xba, 0xba,
+  0x8a, 0x62, 0x24, 0x01, 0x89, 0x18, 0x32, 0x45, 0x42, 0x23, 0x12, 0x00,
+  0x28, 0x52, 0x43, 0x22, 0x99, 0xcb, 0xaa, 0x89, 0x89, 0xa9, 0xce, 0xbd,
+  0xbc, 0xaa, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x77, 0x47, 0x8b, 0xbd, 0xff, 0x47, 0xc0, 0x3b,
+  0x11, 0x8b, 0x01, 0xa0, 0x00, 0x81, 0x09, 0x28, 0x81, 0x1b, 0x1b, 0x19,
+  0xb3, 0xd1, 0x81, 0x91, 0x3d, 0x3b, 0xaa, 0x4b, 0xf7, 0x4f, 0x04, 0x9e,
+  0x32, 0xb1, 0x9e, 0x05, 0x88, 0x10, 0xa8, 0x3a, 0x11, 0xc9, 0x92, 0xf1,
+  0x19, 0x21, 0x88, 0x20, 0x89, 0xe2, 0x28, 0x29, 0xa8, 0x93, 0x1b, 0x25,
+  0xe0, 0x5b, 0x19, 0x99, 0x5a, 0xd2, 0xb3, 0x38, 0x10, 0x9c, 0x41, 0xc0,
+  0x88, 0x00, 0xe3, 0xa3, 0x92, 0x88, 0x70, 0x1a, 0xaa, 0xa7, 0xa2, 0x01,
+  0x09, 0x2a, 0xcc, 0x24, 0xa0, 0x91, 0xa1, 0x20, 0xf2, 0x92, 0x49, 0x1b,
+  0xc0, 0x83, 0x29, 0x29, 0xd8, 0x82, 0xb3, 0x89, 0x78, 0xa8, 0x81, 0xa2,
+  0x7e, 0x8a, 0xa2, 0x92, 0x00, 0x18, 0x4f, 0xc0, 0xa2, 0x13, 0x4f, 0x8a,
+  0xc3, 0x81, 0x10, 0x1b, 0xb2, 0xa4, 0x5a, 0x2b, 0xa8, 0x12, 0x9b, 0x04,
+  0x2b, 0xf6, 0x11, 0x99, 0x40, 0x8a, 0x18, 0xb1, 0x81, 0xb2, 0xc1, 0x72,
+  0x8b, 0x92, 0x81, 0x1b, 0x11, 0x3a, 0x3c, 0xbb, 0x87, 0x09, 0xd2, 0x14,
+  0x3f, 0x8a, 0xb4, 0x00, 0x7a, 0x1b, 0xa0, 0xb3, 0xa2, 0x02, 0x4c, 0x09,
+  0x91, 0x09, 0xb3, 0x11, 0xd0, 0xe2, 0xa6, 0x00, 0x4a, 0x89, 0xc1, 0x41,
+  0x9a, 0x81, 0x00, 0xd0, 0x03, 0x4f, 0xb8, 0x12, 0x98, 0x88, 0xb5, 0x01,
+  0x6b, 0x9a, 0xb4, 0x21, 0x3c, 0xca, 0xa7, 0x81, 0x18, 0x89, 0x81, 0x80,
+  0x6b, 0x89, 0x80, 0xa2, 0x18, 0x88, 0x39, 0xb1, 0x10, 0x7f, 0x2c, 0xc0,
+  0x03, 0x3c, 0xb8, 0xb6, 0x82, 0x4a, 0x2b, 0xd1, 0x31, 0x0c, 0x80, 0x01,
+  0x99, 0x91, 0x82, 0x00, 0x2e, 0xc3, 0x00, 0x4a, 0xc0, 0xb3, 0x30, 0x4b,
+  0x9a, 0x11, 0x18, 0x2f, 0xc2, 0xa0, 0x52, 0xca, 0x23, 0xf8, 0x31, 0xa9,
+  0x49, 0xa8, 0x10, 0x09, 0x00, 0xb2, 0x7b, 0xb0, 0x28, 0x90, 0xd3, 0xb3,
+  0x7c, 0x88, 0x3a, 0xa0, 0x28, 0xa8, 0x02, 0x19, 0x9c, 0x86, 0x90, 0xb3,
+  0x3b, 0xd3, 0x20, 0x0c, 0xc7, 0x7a, 0x09, 0xb0, 0x83, 0x29, 0x2b, 0xd1,
+  0x11, 0x98, 0xb4, 0x81, 0x48, 0x3d, 0xaa, 0x83, 0x58, 0x0d, 0x92, 0xa0,
+  0x42, 0x8c, 0x00, 0xc2, 0x21, 0x0a, 0x1a, 0x31, 0x1f, 0xc1, 0xa3, 0x4a,
+  0xa0, 0x01, 0x3a, 0xc8, 0x22, 0x2d, 0xc2, 0x28, 0x1a, 0xa1, 0xd1, 0x95,
+  0x18, 0xd1, 0x81, 0x31, 0x1f, 0x39, 0xa0, 0x6c, 0x89, 0x00, 0x09, 0x91,
+  0x92, 0x1b, 0xb7, 0x3a, 0x91, 0x80, 0x00, 0x6b, 0xa9, 0x10, 0x09, 0x38,
+  0xf1, 0x49, 0xc8, 0x31, 0xa0, 0x18, 0x80, 0x1e, 0x93, 0x4b, 0x00, 0xcb,
+  0x07, 0x8a, 0x82, 0x08, 0xb1, 0x20, 0x8c, 0x83, 0x7c, 0xa8, 0x91, 0x88,
+  0x14, 0x0f, 0xa3, 0x08, 0x4a, 0x08, 0xaa, 0x84, 0x91, 0x39, 0xca, 0x06,
+  0xb8, 0x48, 0x80, 0x1b, 0x92, 0x5b, 0x88, 0xe8, 0x95, 0x3a, 0x2a, 0xf3,
+  0xa1, 0x30, 0x0a, 0xa0, 0x04, 0x89, 0x2a, 0x81, 0xb3, 0x7f, 0x89, 0x90,
+  0x81, 0x18, 0x18, 0x2b, 0xc5, 0x89, 0x81, 0x30, 0x9a, 0x1a, 0x01, 0x9a,
+  0x85, 0x28, 0xad, 0x06, 0x99, 0x83, 0x4a, 0xc0, 0x88, 0x31, 0xab, 0x70,
+  0xb8, 0xb3, 0x48, 0xc8, 0x01, 0x43, 0xfa, 0x11, 0x89, 0x00, 0x18, 0x1a,
+  0x09, 0x08, 0x88, 0x08, 0x80, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x32,
+  0x45, 0x34, 0x02, 0xa9, 0xab, 0xab, 0x41, 0x47, 0xa2, 0xcd, 0xab, 0xb9,
+  0xcc, 0x0a, 0x12, 0xc9, 0x9d, 0x80, 0xea, 0x9d, 0x30, 0x35, 0x12, 0x11,
+  0x90, 0x99, 0x71, 0x36, 0x33, 0x14, 0x81, 0x09, 0x31, 0x82, 0x9e, 0x52,
+  0x14, 0xd9, 0xaa, 0xb9, 0xce, 0x0b, 0x32, 0xb2, 0xbe, 0x9a, 0xa9, 0xbb,
+  0x30, 0x24, 0xb0, 0x1a, 0x32, 0x91, 0x0b, 0x54, 0x36, 0x34, 0x22, 0x98,
+  0x89, 0x10, 0x31, 0x37, 0x13, 0xc8, 0x9a, 0x08, 0xb9, 0xab, 0x30, 0x91,
+  0xbc, 0xaa, 0xdc, 0xad, 0x0a, 0x31, 0x02, 0x80, 0xa9, 0xaa, 0x18, 0x63,
+  0x33, 0x23, 0x22, 0x12, 0x80, 0x08, 0x10, 0x23, 0x24, 0x01, 0xc8, 0xcd,
+  0xac, 0x9a, 0x09, 0x21, 0x32, 0x14, 0x91, 0x99, 0x41, 0x47, 0x44, 0x53,
+  0x43, 0x02, 0xb8, 0xac, 0x09, 0x31, 0x56, 0x03, 0xfb, 0xae, 0x89, 0x88,
+  0x8a, 0x20, 0xa2, 0xbf, 0x8a, 0x80, 0xdc, 0x1a, 0x55, 0x22, 0x00, 0x90,
+  0xa9, 0x2a, 0x67, 0x33, 0x22, 0x80, 0xaa, 0x20, 0x24, 0xd8, 0x39, 0x45,
+  0xa1, 0xad, 0x99, 0xdc, 0x9c, 0x40, 0x12, 0xda, 0x9a, 0x89, 0xba, 0x1a,
+  0x24, 0x81, 0x8b, 0x32, 0x82, 0xcb, 0x19, 0x73, 0x44, 0x23, 0x80, 0x99,
+  0x88, 0x18, 0x63, 0x33, 0x90, 0x9b, 0x00, 0xb8, 0xaf, 0x09, 0x11, 0x88,
+  0x08, 0xc0, 0xbf, 0x9a, 0x10, 0x11, 0x11, 0x80, 0x99, 0x8a, 0x08, 0x31,
+  0x34, 0x25, 0x23, 0x02, 0xa0, 0xaa, 0x10, 0x24, 0x33, 0x01, 0xd9, 0xcd,
+  0xab, 0x89, 0x22, 0x34, 0x24, 0xb0, 0xbc, 0x29, 0x46, 0x45, 0x33, 0x13,
+  0x01, 0x99, 0xbc, 0x8b, 0x53, 0x25, 0x34, 0xb2, 0xff, 0x9e, 0x08, 0x00,
+  0x08, 0x11, 0xc9, 0xcd, 0x19, 0x01, 0xb9, 0x39, 0x57, 0x11, 0x88, 0x89,
+  0xaa, 0x48, 0x47, 0x33, 0x01, 0xa8, 0xab, 0x31, 0x25, 0xc9, 0x20, 0x45,
+  0xc0, 0x9b, 0xa9, 0xed, 0x8b, 0x43, 0x03, 0xcc, 0x8a, 0x89, 0xba, 0x38,
+  0x23, 0xa8, 0x2a, 0x25, 0x91, 0xad, 0x09, 0x52, 0x35, 0x23, 0x98, 0x89,
+  0x89, 0x19, 0x54, 0x13, 0xa9, 0x28, 0x03, 0xfa, 0xab, 0x08, 0x80, 0x20,
+  0x12, 0xe9, 0xbc, 0x9a, 0x00, 0x10, 0x10, 0x01, 0x00, 0x88, 0x9a, 0x89,
+  0x52, 0x44, 0x24, 0x02, 0x90, 0xa9, 0x88, 0x31, 0x22, 0x82, 0xb8, 0xdc,
+  0xbb, 0x9a, 0x19, 0x42, 0x24, 0x81, 0xca, 0xac, 0x40, 0x47, 0x34, 0x23,
+  0x80, 0xaa, 0x8a, 0x11, 0x42, 0x34, 0x23, 0x11, 0xe0, 0xff, 0xaf, 0x08,
+  0x21, 0x00, 0x00, 0xc9, 0xbf, 0x8a, 0x42, 0x81, 0x8a, 0x62, 0x23, 0xa8,
+  0x99, 0x99, 0x2b, 0x77, 0x25, 0x01, 0x99, 0xba, 0x10, 0x53, 0x90, 0x0a,
+  0x53, 0x92, 0x9e, 0x99, 0xda, 0x9e, 0x31, 0x14, 0xc9, 0x9a, 0x89, 0xb9,
+  0x09, 0x14, 0x90, 0x1a, 0x44, 0x00, 0xda, 0x99, 0x28, 0x45, 0x23, 0x80,
+  0x88, 0x98, 0x89, 0x51, 0x13, 0x99, 0x30, 0x25, 0xc8, 0xbc, 0x99, 0x88,
+  0x10, 0x33, 0xb1, 0xce, 0x9a, 0x88, 0x98, 0x08, 0x21, 0x22, 0x02, 0xa8,
+  0xaa, 0x8a, 0x63, 0x45, 0x22, 0x01, 0x80, 0x98, 0x89, 0x10, 0x11, 0x12,
+  0x98, 0xdc, 0xbd, 0xab, 0x08, 0x20, 0x23, 0x81, 0xca, 0x9b, 0x19, 0x74,
+  0x57, 0x43, 0x12, 0x90, 0xb9, 0xaa, 0x51, 0x35, 0x13, 0x81, 0xcb, 0xbc,
+  0xcb, 0xde, 0xab, 0x41, 0x14, 0x98, 0xaa, 0xed, 0xac, 0x38, 0x34, 0xa0,
+  0x08, 0x34, 0xa1, 0xa9, 0x88, 0xa9, 0x74, 0x57, 0x12, 0x98, 0xba, 0x0b,
+  0x51, 0x13, 0xa9, 0x20, 0x25, 0xdb, 0x8a, 0xb9, 0xdf, 0x29, 0x53, 0x91,
+  0xac, 0x88, 0x98, 0x9b, 0x22, 0x81, 0xa9, 0x72, 0x12, 0xb8, 0xac, 0x89,
+  0x62, 0x33, 0x02, 0x88, 0x80, 0xa8, 0x18, 0x14, 0xa8, 0x4a, 0x37, 0x91,
+  0xbb, 0xaa, 0xba, 0x09, 0x53, 0x81, 0xba, 0x9a, 0xa8, 0xcb, 0xab, 0x0a,
+  0x52, 0x34, 0x11, 0x99, 0xaa, 0x09, 0x53, 0x24, 0x23, 0x32, 0x11, 0x80,
+  0xa9, 0x99, 0x18, 0x32, 0x80, 0xfb, 0xbe, 0xba, 0x9a, 0x19, 0x21, 0x80,
+  0xa9, 0xcb, 0x0b, 0x74, 0x44, 0x33, 0x45, 0x33, 0x90, 0xab, 0x9b, 0x40,
+  0x57, 0x24, 0x90, 0xca, 0xac, 0x9a, 0x98, 0xdb, 0x0a, 0x54, 0x81, 0xcb,
+  0xdb, 0xcc, 0x8b, 0x73, 0x23, 0xa9, 0x09, 0x13, 0xa8, 0x8b, 0x23, 0x28,
+  0x77, 0x27, 0x80, 0xa9, 0xab, 0x18, 0x35, 0x92, 0x99, 0x41, 0xb2, 0xad,
+  0x98, 0xfa, 0x8e, 0x31, 0x14, 0xba, 0x9a, 0x98, 0xb9, 0x29, 0x03, 0xa9,
+  0x5a, 0x26, 0x81, 0xbb, 0x9c, 0x29, 0x36, 0x13, 0x80, 0x01, 0x98, 0x89,
+  0x32, 0xb0, 0x8d, 0x73, 0x14, 0xa8, 0xaa, 0xa9, 0xaa, 0x20, 0x12, 0xa8,
+  0x9b, 0x88, 0xca, 0xcc, 0xaa, 0x18, 0x53, 0x22, 0x01, 0x99, 0x99, 0x18,
+  0x53, 0x33, 0x34, 0x23, 0x02, 0x80, 0xaa, 0x89, 0x10, 0x12, 0x90, 0xeb,
+  0xdd, 0xcb, 0x9b, 0x99, 0x00, 0x20, 0x91, 0xd9, 0xab, 0x20, 0x56, 0x44,
+  0x34, 0x32, 0x33, 0x91, 0xca, 0x8a, 0x62, 0x46, 0x23, 0xa1, 0xcc, 0xbc,
+  0x9a, 0x90, 0xca, 0x8c, 0x63, 0x82, 0xcc, 0xac, 0xcb, 0x9b, 0x74, 0x13,
+  0xa9, 0x09, 0x13, 0xa8, 0x0a, 0x12, 0x30, 0x77, 0x26, 0x80, 0xb9, 0xab,
+  0x10, 0x45, 0x91, 0x89, 0x40, 0x91, 0x9d, 0x98, 0xea, 0x9d, 0x51, 0x22,
+  0xca, 0x99, 0x88, 0xa9, 0x29, 0x02, 0x99, 0x3a, 0x37, 0x00, 0xca, 0x9b,
+  0x29, 0x45, 0x13, 0x80, 0x10, 0x98, 0x09, 0x32, 0xb0, 0x8e, 0x62, 0x13,
+  0xa8, 0xaa, 0xba, 0xab, 0x28, 0x14, 0xa9, 0x9a, 0x88, 0xc9, 0xbc, 0xbb,
+  0x1a, 0x53, 0x14, 0x02, 0x88, 0x99, 0x18, 0x43, 0x33, 0x53, 0x24, 0x12,
+  0x00, 0x88, 0x99, 0x88, 0x21, 0x00, 0xca, 0xcc, 0xcc, 0xba, 0xaa, 0x9a,
+  0x09, 0x11, 0x80, 0xaa, 0xa9, 0x09, 0x77, 0x35, 0x24, 0x23, 0x34, 0x03,
+  0xa9, 0x8a, 0x30, 0x67, 0x24, 0x82, 0xca, 0xbc, 0xbb, 0x88, 0xb9, 0xbe,
+  0x49, 0x34, 0xe9, 0xbc, 0xba, 0xcc, 0x38, 0x37, 0x92, 0xab, 0x21, 0x83,
+  0xb9, 0x38, 0x02, 0x72, 0x67, 0x12, 0x98, 0xca, 0x0a, 0x41, 0x14, 0xa8,
+  0x88, 0x43, 0xc9, 0x9a, 0xa9, 0xee, 0x1a, 0x34, 0x92, 0xbc, 0x89, 0x98,
+  0xaa, 0x31, 0x91, 0xba, 0x71, 0x15, 0x88, 0xab, 0xaa, 0x41, 0x35, 0x02,
+  0x00, 0x00, 0x98, 0x18, 0x23, 0xe9, 0x0a, 0x45, 0x83, 0xa9, 0xaa, 0xba,
+  0x9b, 0x31, 0x82, 0xbb, 0x8b, 0x98, 0xdb, 0xcc, 0xba, 0x18, 0x34, 0x23,
+  0x01, 0x98, 0x99, 0x32, 0x35, 0x34, 0x42, 0x33, 0x33, 0x02, 0x98, 0x88,
+  0x00, 0x80, 0x90, 0xca, 0xce, 0xbc, 0xcb, 0xcb, 0xbb, 0xaa, 0x99, 0x00,
+  0x10, 0x90, 0xab, 0x48, 0x67, 0x53, 0x43, 0x33, 0x43, 0x24, 0x82, 0xa9,
+  0x09, 0x62, 0x45, 0x33, 0xb0, 0xdc, 0xbb, 0xaa, 0x88, 0xea, 0xac, 0x40,
+  0x13, 0xfb, 0xac, 0xba, 0xac, 0x50, 0x26, 0xa1, 0xaa, 0x31, 0x02, 0xaa,
+  0x38, 0x02, 0x74, 0x46, 0x03, 0xa8, 0xcb, 0x09, 0x51, 0x05, 0x98, 0x89,
+  0x33, 0xca, 0x9a, 0xa9, 0xef, 0x1a, 0x34, 0x91, 0xac, 0x89, 0x98, 0xaa,
+  0x31, 0x91, 0xab, 0x71, 0x14, 0x90, 0xba, 0xaa, 0x51, 0x25, 0x11, 0x00,
+  0x81, 0x98, 0x28, 0x23, 0xea, 0x1a, 0x44, 0x02, 0xa9, 0x9a, 0xcb, 0x9b,
+  0x21, 0x82, 0xba, 0x8b, 0x89, 0xba, 0xcd, 0xab, 0x19, 0x42, 0x33, 0x12,
+  0x98, 0x99, 0x31, 0x45, 0x33, 0x34, 0x33, 0x23, 0x13, 0x00, 0x10, 0x32,
+  0x01, 0x88, 0xc9, 0xce, 0xbc, 0xab, 0xbb, 0xbb, 0xbc, 0xcc, 0xbb, 0x8a,
+  0x89, 0x10, 0x42, 0x23, 0x01, 0x62, 0x44, 0x54, 0x34, 0x24, 0x33, 0x24,
+  0x81, 0xa9, 0x18, 0x45, 0x54, 0x22, 0xb8, 0xcd, 0xba, 0xa9, 0x98, 0xeb,
+  0xac, 0x50, 0x02, 0xfb, 0xac, 0xa9, 0x9b, 0x71, 0x24, 0xa8, 0x8b, 0x42,
+  0x81, 0xa9, 0x20, 0x12, 0x65, 0x45, 0x02, 0xa9, 0xbb, 0x19, 0x64, 0x03,
+  0xaa, 0x19, 0x24, 0xcb, 0x8a, 0xb9, 0xff, 0x29, 0x33, 0xb1, 0xad, 0x88,
+  0x98, 0x8a, 0x22, 0x98, 0xab, 0x73, 0x13, 0x90, 0xac, 0x99, 0x61, 0x23,
+  0x02, 0x10, 0x81, 0x99, 0x31, 0x05, 0xdb, 0x29, 0x34, 0x82, 0xa9, 0xb9,
+  0xcc, 0x8a, 0x11, 0x91, 0xba, 0x89, 0x90, 0xb9, 0xdc, 0xab, 0x09, 0x33,
+  0x24, 0x12, 0x98, 0x88, 0x30, 0x26, 0x22, 0x42, 0x43, 0x23, 0x02, 0x00,
+  0x00, 0x11, 0x31, 0x22, 0xc0, 0xcc, 0xaa, 0xcb, 0xdb, 0xaa, 0xb9, 0xcc,
+  0xbb, 0xaa, 0xeb, 0x9a, 0x10, 0x33, 0x12, 0x11, 0x00, 0x73, 0x56, 0x34,
+  0x24, 0x12, 0x32, 0x43, 0x01, 0xaa, 0x40, 0x46, 0x43, 0x12, 0xda, 0xcd,
+  0x9a, 0x88, 0x80, 0xc9, 0xac, 0x30, 0x93, 0xef, 0xab, 0xa9, 0x9a, 0x73,
+  0x16, 0xa8, 0x9a, 0x22, 0x81, 0x99, 0x43, 0x11, 0x74, 0x44, 0x81, 0xa9,
+  0xac, 0x10, 0x63, 0x83, 0x9a, 0x19, 0x05, 0xbb, 0x8a, 0xba, 0xff, 0x28,
+  0x23, 0xc1, 0x9c, 0x88, 0x98, 0x8a, 0x12, 0x98, 0x9a, 0x64, 0x12, 0x98,
+  0xab, 0x9b, 0x63, 0x33, 0x11, 0x20, 0x82, 0x89, 0x51, 0x92, 0xbd, 0x39,
+  0x35, 0x82, 0x99, 0xa9, 0xcc, 0x8a, 0x10, 0x98, 0x9a, 0x09, 0x00, 0x98,
+  0xcd, 0xcb, 0x09, 0x11, 0x32, 0x22, 0x81, 0x88, 0x31, 0x23, 0x32, 0x63,
+  0x34, 0x34, 0x23, 0x02, 0x00, 0x00, 0x08, 0x21, 0x02, 0xcc, 0x9c, 0x9a,
+  0xeb, 0xcb, 0xa9, 0xba, 0xac, 0x8a, 0xaa, 0xad, 0x00, 0x13, 0x91, 0x08,
+  0x10, 0x72, 0x56, 0x34, 0x33, 0x23, 0x21, 0x32, 0x25, 0x80, 0x20, 0x57,
+  0x33, 0x32, 0xb0, 0xef, 0xbb, 0x89, 0x10, 0x81, 0xda, 0xab, 0x28, 0xf9,
+  0xce, 0x8a, 0x99, 0x18, 0x47, 0x02, 0xca, 0x0a, 0x22, 0x90, 0x28, 0x35,
+  0x20, 0x55, 0x25, 0xa0, 0xba, 0xab, 0x33, 0x47, 0x91, 0x99, 0x38, 0xb2,
+  0x9e, 0x89, 0xea, 0x9d, 0x41, 0x13, 0xca, 0x9a, 0x88, 0xc9, 0x29, 0x81,
+  0xa8, 0x3a, 0x27, 0x12, 0xb9, 0xbb, 0x2b, 0x45, 0x13, 0x01, 0x32, 0x80,
+  0x18, 0x43, 0xd0, 0xac, 0x30, 0x16, 0x81, 0x88, 0xa9, 0xbb, 0x8a, 0x90,
+  0xaa, 0x9b, 0x28, 0x21, 0xb0, 0xdf, 0xab, 0x09, 0x10, 0x12, 0x33, 0x01,
+  0x11, 0x33, 0x11, 0x00, 0x53, 0x45, 0x33, 0x24, 0x01, 0x01, 0x88, 0x98,
+  0x10, 0x81, 0xd9, 0x8b, 0xa0, 0xfc, 0x9b, 0xaa, 0xea, 0x9b, 0x98, 0xa8,
+  0xab, 0x20, 0x91, 0xa9, 0x18, 0x33, 0x67, 0x55, 0x33, 0x24, 0x22, 0x08,
+  0x20, 0x53, 0x23, 0x42, 0x45, 0x22, 0x02, 0xb0, 0xff, 0xbb, 0x89, 0x21,
+  0x02, 0xc8, 0xbd, 0x9a, 0xc8, 0xce, 0x9b, 0x88, 0x19, 0x66, 0x13, 0xd9,
+  0x8b, 0x21, 0x01, 0x08, 0x35, 0x12, 0x62, 0x44, 0x92, 0xbb, 0xac, 0x30,
+  0x45, 0x83, 0x99, 0x09, 0x84, 0xad, 0x99, 0xb9, 0xef, 0x20, 0x23, 0xb0,
+  0x9d, 0x88, 0x99, 0x8b, 0x12, 0x99, 0x9a, 0x46, 0x22, 0x90, 0xcb, 0x9a,
+  0x51, 0x23, 0x01, 0x31, 0x13, 0x00, 0x31, 0x94, 0xbf, 0x1a, 0x34, 0x02,
+  0x80, 0x98, 0xbb, 0x9c, 0x89, 0xbb, 0xac, 0x08, 0x22, 0x02, 0xdb, 0xbd,
+  0x8b, 0x88, 0x10, 0x21, 0x32, 0x33, 0x24, 0x11, 0x81, 0x10, 0x63, 0x34,
+  0x34, 0x12, 0x22, 0x11, 0x88, 0x89, 0x89, 0x88, 0x88, 0xbb, 0xcd, 0xbc,
+  0xbc, 0xbc, 0xca, 0xba, 0xaa, 0x9a, 0x89, 0x88, 0xa8, 0xba, 0xab, 0x72,
+  0x46, 0x53, 0x53, 0x34, 0x23, 0x11, 0x81, 0x08, 0x64, 0x34, 0x33, 0x33,
+  0x12, 0x98, 0xdb, 0xdf, 0xcc, 0x89, 0x22, 0x12, 0xb8, 0xce, 0xab, 0xa9,
+  0xcc, 0xab, 0x88, 0x09, 0x74, 0x27, 0xa8, 0xac, 0x28, 0x11, 0x18, 0x63,
+  0x03, 0x20, 0x54, 0x04, 0xb9, 0xcb, 0x29, 0x52, 0x25, 0x98, 0x99, 0x21,
+  0xd9, 0x9b, 0xa8, 0xfb, 0x0e, 0x32, 0x03, 0xcc, 0x89, 0x88, 0xb9, 0x18,
+  0x90, 0x99, 0x59, 0x25, 0x12, 0xb9, 0xbb, 0x1a, 0x45, 0x02, 0x10, 0x43,
+  0x02, 0x10, 0x22, 0xe8, 0xac, 0x30, 0x23, 0x81, 0x00, 0xa8, 0xbb, 0xaa,
+  0xea, 0xac, 0x9a, 0x18, 0x22, 0x82, 0xeb, 0xab, 0x99, 0x98, 0x88, 0x21,
+  0x32, 0x44, 0x33, 0x12, 0x80, 0x08, 0x41, 0x34, 0x24, 0x43, 0x22, 0x01,
+  0x80, 0x00, 0x98, 0x9a, 0x89, 0xa9, 0xba, 0xfa, 0xca, 0xac, 0xbb, 0xdb,
+  0xac, 0xa9, 0x99, 0x9a, 0x88, 0xc8, 0xba, 0x19, 0x90, 0x29, 0x77, 0x27,
+  0x22, 0x53, 0x23, 0x00, 0x00, 0x00, 0x62, 0x45, 0x24, 0x12, 0x02, 0xa0,
+  0xbc, 0xbb, 0xed, 0xac, 0x19, 0x43, 0x02, 0xda, 0xcd, 0xbb, 0x9a, 0xba,
+  0x9a, 0x01, 0x08, 0x77, 0x24, 0xd8, 0xbb, 0x28, 0x13, 0x21, 0x55, 0x03,
+  0x10, 0x63, 0x13, 0xda, 0xba, 0x29, 0x44, 0x34, 0x98, 0x99, 0x20, 0xf9,
+  0x9a, 0x99, 0xfa, 0x0d, 0x32, 0x03, 0xbc, 0x99, 0x98, 0xca, 0x18, 0x90,
+  0x9a, 0x58, 0x25, 0x12, 0xb8, 0xbb, 0x2b, 0x35, 0x12, 0x18, 0x45, 0x11,
+  0x11, 0x23, 0xe9, 0xbb, 0x20, 0x14, 0x81, 0x00, 0x80, 0x99, 0x99, 0xeb,
+  0xcb, 0x9b, 0x08, 0x21, 0x02, 0xc9, 0xaa, 0x89, 0xb9, 0xaa, 0x89, 0x32,
+  0x46, 0x33, 0x13, 0x81, 0x80, 0x21, 0x33, 0x22, 0x42, 0x44, 0x23, 0x82,
+  0x00, 0xa8, 0xcb, 0x19, 0x12, 0xcb, 0x9c, 0x09, 0x88, 0x08, 0xca, 0xaf,
+  0x8a, 0x88, 0x00, 0x88, 0xdb, 0x9c, 0x21, 0xb1, 0xbf, 0x8a, 0x01, 0x22,
+  0x57, 0x23, 0x22, 0x41, 0x33, 0x01, 0x21, 0x42, 0x56, 0x55, 0x23, 0x12,
+  0x88, 0xba, 0xbd, 0x8a, 0xc9, 0xbe, 0x19, 0x44, 0x82, 0xfb, 0xcc, 0xab,
+  0x9a, 0x98, 0x08, 0x10, 0x08, 0x73, 0x37, 0xd8, 0xbc, 0x28, 0x23, 0x31,
+  0x54, 0x23, 0x09, 0x53, 0x14, 0xca, 0xab, 0x29, 0x45, 0x34, 0x98, 0x99,
+  0x28, 0xf9, 0x9a, 0x98, 0xfb, 0x0c, 0x42, 0x02, 0xcb, 0x89, 0x98, 0xba,
+  0x19, 0x98, 0xa9, 0x68, 0x25, 0x12, 0xa8, 0xca, 0x1a, 0x24, 0x82, 0x18,
+  0x35, 0x12, 0x31, 0x33, 0xe8, 0xac, 0x18, 0x13, 0x81, 0x08, 0x00, 0x80,
+  0x98, 0xfb, 0xcb, 0xaa, 0x8a, 0x11, 0x12, 0xa9, 0x9a, 0x08, 0xb9, 0xbc,
+  0x9a, 0x18, 0x63, 0x34, 0x23, 0x12, 0x11, 0x10, 0x01, 0x11, 0x22, 0x23,
+  0x34, 0x34, 0x02, 0x98, 0xb8, 0xdb, 0xaa, 0xa9, 0x9a, 0x12, 0x01, 0x9d,
+  0x21, 0xe1, 0xca, 0x29, 0x00, 0xbb, 0x30, 0xa2, 0xeb, 0xcb, 0xeb, 0xcb,
+  0x9a, 0x8a, 0x62, 0x45, 0x22, 0x33, 0x34, 0x11, 0x42, 0x33, 0x35, 0x56,
+  0x44, 0x24, 0x13, 0x90, 0xba, 0xbe, 0x8a, 0x10, 0xda, 0xab, 0x63, 0x03,
+  0xeb, 0xdd, 0xcb, 0x9a, 0x08, 0x00, 0x10, 0x90, 0x19, 0x57, 0x92, 0xdd,
+  0x8b, 0x33, 0x23, 0x52, 0x35, 0x80, 0x18, 0x44, 0xa2, 0xbc, 0x9a, 0x53,
+  0x44, 0x03, 0x99, 0x99, 0x91, 0xaf, 0x99, 0xa9, 0xcf, 0x38, 0x43, 0xb0,
+  0x9c, 0x89, 0xa8, 0x9c, 0x81, 0x99, 0x99, 0x55, 0x22, 0x01, 0xaa, 0xab,
+  0x50, 0x12, 0x88, 0x50, 0x33, 0x12, 0x43, 0x83, 0xeb, 0x8b, 0x21, 0x01,
+  0x88, 0x08, 0x01, 0x01, 0xb0, 0xce, 0xcb, 0xaa, 0x88, 0x10, 0x91, 0xa9,
+  0x10, 0x81, 0xca, 0xba, 0xa9, 0x10, 0x53, 0x34, 0x23, 0x22, 0x23, 0x21,
+  0x01, 0x11, 0x32, 0x25, 0x21, 0x20, 0x01, 0xa0, 0xba, 0xbb, 0xbc, 0xab,
+  0x00, 0xa1, 0xda, 0x80, 0x15, 0x92, 0xb8, 0x11, 0x17, 0x91, 0xbb, 0x3b,
+  0x06, 0xfb, 0x9b, 0x00, 0xda, 0x8a, 0x31, 0x83, 0x51, 0x56, 0x22, 0x01,
+  0x31, 0x73, 0x53, 0x43, 0x42, 0x53, 0x33, 0x01, 0xa9, 0xcd, 0xac, 0x29,
+  0x23, 0xda, 0x8c, 0x31, 0xc0, 0xde, 0xcc, 0xbb, 0x8b, 0x20, 0x21, 0x01,
+  0xa8, 0x0a, 0x57, 0xb1, 0xdf, 0x09, 0x33, 0x23, 0x34, 0x26, 0x90, 0x18,
+  0x34, 0xb1, 0x9e, 0x0a, 0x44, 0x53, 0x92, 0x98, 0x89, 0xb0, 0xae, 0x99,
+  0xb9, 0xcf, 0x30, 0x24, 0xc0, 0x9b, 0x88, 0xb9, 0x9b, 0x90, 0x9a, 0x0a,
+  0x47, 0x32, 0x82, 0xa9, 0x9c, 0x41, 0x02, 0x99, 0x41, 0x25, 0x21, 0x32,
+  0x04, 0xcb, 0x8b, 0x11, 0x81, 0x89, 0x08, 0x20, 0x22, 0xa0, 0xbf, 0xbc,
+  0xab, 0x9a, 0x10, 0xa8, 0xaa, 0x21, 0x04, 0xb8, 0xba, 0xab, 0x09, 0x53,
+  0x24, 0x23, 0x33, 0x53, 0x23, 0x13, 0x00, 0x10, 0x31, 0x13, 0x01, 0xa9,
+  0x08, 0xa8, 0xbb, 0x80, 0xfb, 0x9e, 0x8a, 0x31, 0x83, 0xba, 0x29, 0x35,
+  0x18, 0x61, 0x11, 0xd8, 0x28, 0x23, 0xa9, 0xbc, 0xbc, 0xba, 0x9c, 0x8b,
+  0x99, 0x05, 0x90, 0x52, 0x55, 0x23, 0x08, 0x54, 0x46, 0x34, 0x34, 0x32,
+  0x42, 0x24, 0x12, 0xba, 0xcc, 0xac, 0x0a, 0x45, 0x83, 0xcc, 0x9a, 0x91,
+  0xfc, 0xbc, 0xbc, 0xac, 0x19, 0x32, 0x13, 0x98, 0xcc, 0x29, 0x25, 0xfa,
+  0x9e, 0x38, 0x24, 0x32, 0x63, 0x03, 0x8a, 0x20, 0x25, 0xc9, 0xaa, 0x38,
+  0x27, 0x34, 0x91, 0xa8, 0x0a, 0xe9, 0x9c, 0x98, 0xd9, 0x9d, 0x32, 0x24,
+  0xda, 0x99, 0x88, 0xb9, 0x8b, 0x98, 0x9a, 0x29, 0x47, 0x22, 0x92, 0xa9,
+  0x8b, 0x34, 0x81, 0x9a, 0x72, 0x22, 0x22, 0x34, 0x82, 0xcb, 0x0a, 0x01,
+  0x90, 0x9a, 0x09, 0x21, 0x24, 0xa1, 0xcd, 0xba, 0xac, 0x9a, 0x88, 0xa9,
+  0xab, 0x41, 0x12, 0x90, 0xaa, 0xaa, 0x08, 0x22, 0x33, 0x43, 0x44, 0x34,
+  0x24, 0x12, 0x80, 0x10, 0x20, 0x08, 0x89, 0x19, 0x91, 0x00, 0x01, 0xfb,
+  0xac, 0x9a, 0x19, 0x32, 0x93, 0xba, 0x72, 0x27, 0x98, 0x98, 0x91, 0xb9,
+  0x30, 0x27, 0x90, 0x89, 0x31, 0x11, 0xa8, 0xcc, 0xbc, 0x19, 0x32, 0x81,
+  0x08, 0x99, 0x1b, 0x72, 0x14, 0x01, 0x52, 0x57, 0x34, 0x43, 0x32, 0x11,
+  0x22, 0x22, 0xa1, 0xcc, 0xbb, 0x8c, 0x74, 0x15, 0xd8, 0xbb, 0x8a, 0xeb,
+  0xbd, 0xbb, 0xcb, 0x0a, 0x52, 0x13, 0xa0, 0xeb, 0xaa, 0x21, 0xc2, 0xcf,
+  0x29, 0x45, 0x22, 0x32, 0x25, 0xb0, 0x09, 0x63, 0xa1, 0xab, 0x18, 0x46,
+  0x53, 0x82, 0x98, 0x9a, 0xb0, 0xaf, 0x89, 0xa9, 0xce, 0x20, 0x24, 0xb0,
+  0x9c, 0x98, 0xa8, 0x9d, 0x88, 0x99, 0x89, 0x63, 0x32, 0x13, 0x98, 0xba,
+  0x51, 0x02, 0xa9, 0x39, 0x27, 0x22, 0x42, 0x23, 0xb8, 0x9b, 0x10, 0x90,
+  0xbb, 0xab, 0x28, 0x44, 0x83, 0xca, 0xbb, 0xbc, 0xbc, 0x89, 0xba, 0xad,
+  0x18, 0x22, 0x00, 0x98, 0x88, 0x08, 0x01, 0x10, 0x11, 0x43, 0x34, 0x35,
+  0x33, 0x13, 0x22, 0x22, 0x98, 0xbb, 0x01, 0x01, 0xb9, 0x00, 0x22, 0xab,
+  0x19, 0x1a, 0x00, 0x99, 0x01, 0x47, 0x13, 0xa8, 0x28, 0x23, 0xfc, 0x8c,
+  0x21, 0x90, 0x0a, 0x43, 0x23, 0x10, 0x11, 0x08, 0xa9, 0x93, 0x9b, 0x53,
+  0xa0, 0xbc, 0x4b, 0x92, 0xbf, 0x29, 0x45, 0x33, 0x54, 0x44, 0x34, 0x32,
+  0x13, 0x01, 0x10, 0x33, 0x02, 0xa9, 0x9a, 0x71, 0x77, 0x93, 0xce, 0xbb,
+  0xa9, 0xcc, 0xac, 0xaa, 0xab, 0x48, 0x35, 0x81, 0xdb, 0xad, 0x8a, 0x12,
+  0xd9, 0x8d, 0x72, 0x33, 0x22, 0x34, 0x83, 0xac, 0x30, 0x25, 0xc9, 0x09,
+  0x71, 0x33, 0x24, 0x90, 0xb9, 0x8a, 0xec, 0x8b, 0x99, 0xfa, 0x0b, 0x34,
+  0x02, 0xad, 0x89, 0x89, 0xcb, 0x89, 0xaa, 0xa8, 0x50, 0x24, 0x24, 0x81,
+  0xa9, 0x28, 0x14, 0xa0, 0x0c, 0x33, 0x34, 0x32, 0x36, 0x81, 0xaa, 0x18,
+  0x00, 0xba, 0xac, 0x9a, 0x31, 0x14, 0xa0, 0xaa, 0xb9, 0xcd, 0x9a, 0xaa,
+  0xcc, 0x9a, 0x11, 0x11, 0x88, 0x08, 0x10, 0x11, 0x11, 0x00, 0x11, 0x43,
+  0x32, 0x34, 0x24, 0x32, 0x32, 0x22, 0x01, 0x21, 0xa0, 0xcc, 0xaa, 0xa9,
+  0x80, 0x73, 0x33, 0x22, 0x33, 0x33, 0xc8, 0x00, 0xfb, 0x9c, 0x19, 0x80,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x7f, 0xff, 0x97, 0x29, 0xac, 0x17, 0x2d, 0xa1, 0x39, 0x98, 0x23, 0x9c,
+  0x49, 0xc1, 0x5a, 0xa8, 0x81, 0x39, 0x2b, 0xf4, 0x00, 0x28, 0x1b, 0xa1,
+  0x92, 0xb1, 0x07, 0x0d, 0x94, 0x3c, 0x91, 0x5a, 0xa9, 0x82, 0x91, 0xc8,
+  0x52, 0xbb, 0x15, 0x8b, 0x90, 0x11, 0x01, 0x1c, 0x2a, 0x29, 0x88, 0x41,
+  0xdd, 0x16, 0x8a, 0xa1, 0x20, 0x08, 0x2c, 0xd2, 0x11, 0x0b, 0xb4, 0x39,
+  0x58, 0xbd, 0x86, 0x98, 0x11, 0x1b, 0x49, 0x08, 0xbb, 0x87, 0x3d, 0xb2,
+  0x28, 0x18, 0x2b, 0x88, 0xf5, 0x21, 0x9a, 0x03, 0x0d, 0x12, 0xbb, 0x13,
+  0xe2, 0x48, 0xa9, 0x03, 0x1b, 0xa2, 0x5c, 0xa8, 0x03, 0xaa, 0x04, 0x4d,
+  0xb8, 0x12, 0x8b, 0xa7, 0x2a, 0x82, 0x0a, 0x11, 0x1d, 0xb2, 0x08, 0xb1,
+  0x62, 0x0a, 0x99, 0x50, 0xd1, 0x3a, 0xc1, 0x84, 0x1b, 0xa4, 0x39, 0x9b,
+  0x85, 0x2b, 0x80, 0x90, 0xb7, 0x6b, 0xa0, 0x10, 0x1b, 0xb2, 0x90, 0xa5,
+  0x81, 0x4a, 0x0c, 0x31, 0x8c, 0xb2, 0x05, 0x8b, 0x94, 0xd8, 0x05, 0x2c,
+  0x18, 0xd1, 0x10, 0x88, 0x28, 0xd0, 0x21, 0x8a, 0x30, 0xca, 0x02, 0xa4,
+  0x4d, 0xa1, 0x3d, 0xb3, 0x3d, 0x91, 0x88, 0x11, 0xaa, 0x51, 0xd0, 0x68,
+  0x9a, 0x92, 0x91, 0x28, 0xc8, 0x10, 0x11, 0x3a, 0x8c, 0xa1, 0x86, 0x99,
+  0xb4, 0x38, 0x3b, 0x9a, 0x11, 0x7b, 0x1c, 0xb6, 0x88, 0x11, 0x0a, 0x31,
+  0x0d, 0xa8, 0x91, 0x03, 0x4d, 0x09, 0x99, 0x33, 0x2d, 0xca, 0x07, 0x0b,
+  0xa1, 0x83, 0x19, 0x9b, 0x87, 0x2a, 0x98, 0x04, 0xaa, 0x71, 0x8a, 0xa0,
+  0xa3, 0x3d, 0xa4, 0x1a, 0xb3, 0x4e, 0xb2, 0x2a, 0xf3, 0x10, 0x82, 0x8c,
+  0x82, 0x00, 0x5c, 0xb8, 0x12, 0xb8, 0x61, 0xba, 0x13, 0x2b, 0xb0, 0x95,
+  0x0a, 0xa3, 0x1a, 0x71, 0x8d, 0xa4, 0x91, 0x08, 0x92, 0x08, 0x39, 0x1a,
+  0xba, 0xa7, 0xa3, 0x59, 0xab, 0x73, 0x9c, 0x13, 0x9a, 0xa3, 0xd2, 0x48,
+  0xb1, 0x7b, 0xb8, 0x12, 0xa8, 0x81, 0x3a, 0x18, 0x88, 0xe6, 0x10, 0x90,
+  0x92, 0x2a, 0x29, 0x01, 0xe8, 0xa2, 0x92, 0x1b, 0xa7, 0x3c, 0xb3, 0x6b,
+  0xa0, 0x88, 0x41, 0xbb, 0x72, 0xab, 0x24, 0xbb, 0x04, 0x2a, 0xb8, 0x24,
+  0x1f, 0x01, 0xaa, 0xa6, 0x00, 0x29, 0xb1, 0x5c, 0xa0, 0x08, 0xb3, 0x38,
+  0x1c, 0x80, 0x48, 0x0c, 0xb3, 0x90, 0x70, 0x8b, 0x11, 0xb0, 0x03, 0xf0,
+  0x82, 0x39, 0x9a, 0x93, 0x29, 0xe2, 0x48, 0x90, 0x2e, 0x90, 0x83, 0x2f,
+  0x91, 0x89, 0x04, 0x8c, 0x01, 0xc2, 0x02, 0xb8, 0x48, 0xa1, 0x5a, 0xd9,
+  0x23, 0x8b, 0x93, 0xb1, 0x7c, 0x90, 0x1b, 0xa5, 0x2a, 0xb3, 0x88, 0x38,
+  0x99, 0xa1, 0x10, 0x1a, 0x3c, 0xa6, 0x4d, 0x00, 0xe0, 0x41, 0xf9, 0x31,
+  0x8a, 0x20, 0x0b, 0xa3, 0x89, 0xa3, 0xc3, 0x5a, 0x09, 0xa8, 0xa5, 0x49,
+  0xf1, 0x11, 0x98, 0x39, 0xb0, 0x40, 0xb9, 0x20, 0xb3, 0x2f, 0x81, 0xa8,
+  0xa7, 0x29, 0xd2, 0x21, 0x0b, 0xa1, 0x61, 0x8d, 0x22, 0xba, 0x42, 0x9c,
+  0x84, 0x89, 0x20, 0x0b, 0x11, 0x1b, 0x98, 0xc4, 0x48, 0xc0, 0x39, 0xf3,
+  0x40, 0xa9, 0x00, 0xa2, 0x4a, 0xb1, 0x18, 0x81, 0xd1, 0x12, 0x9b, 0x61,
+  0xc9, 0x03, 0xc8, 0x21, 0xd1, 0x11, 0x2a, 0x0a, 0x94, 0x2c, 0x29, 0x0a,
+  0x50, 0x1e, 0x00, 0x98, 0x81, 0x3a, 0xf5, 0x38, 0xf1, 0x20, 0xb0, 0x11,
+  0x80, 0x0a, 0x82, 0x89, 0x92, 0x2c, 0x22, 0x9f, 0x85, 0x1b, 0x83, 0x0c,
+  0xa6, 0x3a, 0xc1, 0x20, 0xc0, 0x59, 0x09, 0xa8, 0x04, 0x1d, 0x93, 0x8b,
+  0x14, 0x9c, 0x23, 0x0f, 0x93, 0x2b, 0x01, 0xc0, 0x10, 0xa2, 0x4c, 0xb1,
+  0x38, 0xa9, 0x41, 0xea, 0x84, 0x4a, 0xb8, 0x20, 0x08, 0x3b, 0x28, 0xf9,
+  0x70, 0xb9, 0x12, 0xa8, 0x21, 0xaa, 0x22, 0x1a, 0x1d, 0x82, 0xc8, 0x05,
+  0xab, 0x26, 0x8c, 0x01, 0x99, 0x03, 0xba, 0x34, 0xdb, 0x11, 0xb3, 0x5c,
+  0xc0, 0x21, 0xb9, 0x42, 0x1c, 0xa1, 0x00, 0xc1, 0x41, 0xbb, 0x87, 0x8a,
+  0x21, 0x0a, 0x98, 0x04, 0x9a, 0x93, 0x2a, 0x91, 0x4f, 0x80, 0xaa, 0x03,
+  0xe3, 0x02, 0x4c, 0x89, 0x3a, 0x08, 0xf2, 0x21, 0x8a, 0x38, 0xe9, 0x14,
+  0xca, 0x43, 0x9c, 0x23, 0x0f, 0x00, 0xb2, 0x00, 0xd2, 0x30, 0xb8, 0x21,
+  0xb9, 0x78, 0xb0, 0x49, 0x88, 0x3b, 0xc3, 0x18, 0x28, 0x1d, 0x91, 0x18,
+  0x4a, 0xf8, 0x03, 0x08, 0x0a, 0x81, 0x0a, 0x02, 0xe0, 0x21, 0xc0, 0x50,
+  0x9a, 0x4a, 0x90, 0x21, 0xf9, 0x82, 0x01, 0x0c, 0x95, 0x0b, 0x03, 0x1b,
+  0x10, 0x1d, 0xe3, 0x92, 0xa4, 0x2a, 0x90, 0x4a, 0x59, 0xba, 0x32, 0xe9,
+  0x85, 0x1d, 0x93, 0x99, 0x22, 0xba, 0x40, 0x80, 0x1f, 0xa4, 0x4a, 0xb0,
+  0x20, 0x0a, 0x08, 0x00, 0xc8, 0xa7, 0x18, 0x28, 0x2b, 0xc8, 0x32, 0x8a,
+  0x98, 0x13, 0x8d, 0xb3, 0x11, 0x20, 0x1f, 0x10, 0x0b, 0x58, 0xac, 0x97,
+  0x39, 0x2a, 0xb9, 0x13, 0x2c, 0x98, 0xc4, 0x21, 0x2e, 0x91, 0x19, 0xb0,
+  0xa3, 0x93, 0xa8, 0x33, 0x8f, 0xa7, 0x2a, 0xb3, 0x8a, 0x61, 0x0b, 0xc2,
+  0xa3, 0x00, 0x18, 0x98, 0x99, 0x74, 0xba, 0x22, 0xda, 0x53, 0xca, 0x42,
+  0x1d, 0x80, 0xa1, 0x6a, 0x98, 0x29, 0xe3, 0x28, 0xa0, 0x28, 0x2a, 0xa8,
+  0x95, 0x89, 0x95, 0x1b, 0xb5, 0x6c, 0x98, 0xa1, 0xa3, 0x49, 0xa9, 0x40,
+  0xb8, 0x01, 0xa1, 0xd1, 0x24, 0x8d, 0x83, 0x89, 0x88, 0xa3, 0xa2, 0x59,
+  0x0c, 0x02, 0xa8, 0x82, 0x08, 0x38, 0x8b, 0x4f, 0xb0, 0x81, 0x97, 0x2c,
+  0xb2, 0x59, 0xa9, 0x92, 0x02, 0x8c, 0x04, 0x0d, 0x83, 0x1b, 0x02, 0x0b,
+  0xa5, 0x3a, 0x3d, 0xa9, 0xa5, 0xa1, 0x32, 0xcb, 0x62, 0x0d, 0x01, 0xb0,
+  0x11, 0x19, 0x8a, 0xb6, 0x38, 0x2a, 0x98, 0x18, 0xa9, 0x54, 0x9c, 0x21,
+  0xfa, 0x96, 0x98, 0x11, 0x89, 0x38, 0xb8, 0x31, 0xd9, 0x79, 0xc0, 0x30,
+  0xa8, 0x09, 0x84, 0x8b, 0x95, 0x38, 0x0b, 0x08, 0x1a, 0xa0, 0x13, 0xda,
+  0x97, 0x3b, 0xa1, 0x30, 0xba, 0x68, 0xc6, 0x3a, 0x90, 0x8a, 0x86, 0x99,
+  0x40, 0xa9, 0x68, 0x0b, 0x00, 0xa0, 0x11, 0x2a, 0xc2, 0x4a, 0x08, 0x1c,
+  0x84, 0x8a, 0x10, 0x09, 0xc5, 0x29, 0x00, 0xc9, 0x87, 0x2d, 0x38, 0x9b,
+  0x22, 0xba, 0x78, 0xc9, 0x32, 0x0a, 0x39, 0xd3, 0x3b, 0x91, 0x2d, 0xb5,
+  0x3a, 0xc4, 0xa0, 0x23, 0x0f, 0x02, 0x9a, 0x31, 0xaa, 0xc4, 0x01, 0x49,
+  0xb8, 0x39, 0x83, 0x0c, 0xc3, 0x6b, 0x1a, 0xc3, 0x18, 0x18, 0x90, 0x90,
+  0x58, 0x3c, 0xa9, 0x03, 0x8a, 0xa4, 0xf0, 0x70, 0x9a, 0x82, 0x80, 0x89,
+  0xc3, 0x20, 0xc0, 0x20, 0xd3, 0x00, 0x11, 0xae, 0x25, 0x1c, 0x88, 0x80,
+  0x81, 0x09, 0x18, 0xc1, 0x4a, 0x00, 0x10, 0x10, 0x11, 0x01, 0x80, 0xb9,
+  0xcb, 0xbb, 0xab, 0x99, 0x10, 0x11, 0x90, 0xce, 0xdb, 0xba, 0x9b, 0x30,
+  0x46, 0x44, 0x34, 0x22, 0x11, 0x98, 0xeb, 0xbb, 0x8a, 0x11, 0x32, 0x45,
+  0x82, 0xdc, 0xcc, 0xcb, 0xab, 0x19, 0x31, 0x63, 0x44, 0x12, 0x01, 0x22,
+  0x03, 0x18, 0x63, 0x34, 0x42, 0x34, 0x15, 0x01, 0x90, 0xdc, 0xbc, 0xbb,
+  0xba, 0x9b, 0x11, 0x91, 0xbe, 0xbc, 0xcc, 0xbc, 0x99, 0x00, 0x21, 0x34,
+  0x23, 0x22, 0x24, 0x11, 0x08, 0x42, 0x11, 0x32, 0x46, 0x24, 0x21, 0x01,
+  0xa9, 0xbd, 0xcb, 0xba, 0x09, 0x21, 0x22, 0x21, 0x81, 0xdb, 0xbc, 0x9a,
+  0x88, 0x41, 0x44, 0x43, 0x22, 0x12, 0x80, 0xaa, 0xbb, 0xbc, 0x9a, 0x08,
+  0x00, 0x01, 0xb8, 0xdd, 0xcb, 0xbb, 0x9a, 0x19, 0x42, 0x53, 0x43, 0x32,
+  0x43, 0x43, 0x33, 0x33, 0x02, 0xa0, 0xdc, 0xcc, 0xba, 0x9a, 0x18, 0x11,
+  0x11, 0xc9, 0xcf, 0xcb, 0xab, 0x9a, 0x31, 0x37, 0x45, 0x33, 0x13, 0x81,
+  0xc9, 0xcc, 0xac, 0x09, 0x21, 0x43, 0x25, 0x81, 0xdc, 0xbc, 0xbc, 0xaa,
+  0x10, 0x43, 0x35, 0x34, 0x13, 0x00, 0x22, 0x81, 0x29, 0x72, 0x05, 0x53,
+  0x72, 0x01, 0x01, 0x99, 0xeb, 0xab, 0xbb, 0xc9, 0x29, 0x00, 0xc1, 0x9c,
+  0xcc, 0xcb, 0x9b, 0x99, 0x80, 0x30, 0x23, 0x13, 0x90, 0x02, 0x00, 0x70,
+  0x84, 0x34, 0x63, 0x33, 0x23, 0x32, 0x22, 0x21, 0x01, 0x12, 0x33, 0x34,
+  0x23, 0x81, 0xda, 0xdc, 0xbc, 0xbb, 0xbb, 0xaa, 0xa9, 0xab, 0xcc, 0xbc,
+  0xbc, 0xac, 0x9a, 0x98, 0x20, 0x11, 0x22, 0x01, 0x10, 0x88, 0x20, 0x54,
+  0x45, 0x24, 0x24, 0x22, 0x21, 0x11, 0x11, 0x43, 0x34, 0x35, 0x34, 0x23,
+  0x02, 0x00, 0x88, 0x00, 0x12, 0x36, 0x34, 0x12, 0xc8, 0xcd, 0xcd, 0xbb,
+  0xac, 0xab, 0x9a, 0x9a, 0xba, 0xce, 0xcd, 0xbb, 0xac, 0x8a, 0x18, 0x33,
+  0x35, 0x23, 0x11, 0x08, 0x31, 0x65, 0x45, 0x34, 0x34, 0x24, 0x23, 0x12,
+  0x12, 0x08, 0x92, 0x42, 0x21, 0x27, 0x30, 0xb0, 0xdc, 0xaf, 0xcb, 0xaa,
+  0x9a, 0x80, 0x09, 0xd9, 0xca, 0xbd, 0xca, 0x8a, 0x89, 0x11, 0x21, 0x11,
+  0x11, 0x00, 0x81, 0x31, 0x63, 0x35, 0x44, 0x43, 0x33, 0x23, 0x01, 0x80,
+  0x88, 0x10, 0x42, 0x34, 0x22, 0x90, 0xeb, 0xcb, 0xac, 0xaa, 0x99, 0x98,
+  0x98, 0xa9, 0xba, 0xbd, 0xcb, 0xa9, 0x09, 0x11, 0x44, 0x32, 0x23, 0x11,
+  0x20, 0x11, 0x22, 0x35, 0x54, 0x21, 0x10, 0x00, 0x08, 0x89, 0x89, 0x89,
+  0xa1, 0x32, 0x46, 0x35, 0x14, 0x22, 0x12, 0x11, 0x13, 0x57, 0x44, 0x33,
+  0x23, 0x82, 0xca, 0xdc, 0xba, 0xaa, 0xaa, 0x9a, 0x0b, 0xeb, 0xdd, 0xbd,
+  0xcb, 0xcb, 0x9a, 0x20, 0x34, 0x34, 0x12, 0x98, 0xaa, 0x0b, 0x74, 0x37,
+  0x34, 0x24, 0x21, 0x02, 0x80, 0x19, 0x12, 0x33, 0x20, 0x17, 0x62, 0x90,
+  0xda, 0xbd, 0xdb, 0xaa, 0x9a, 0x02, 0x11, 0xeb, 0xca, 0xac, 0xca, 0x89,
+  0x08, 0x12, 0x20, 0x00, 0x13, 0x21, 0xb0, 0x10, 0x72, 0x34, 0x45, 0x43,
+  0x22, 0x80, 0x99, 0x88, 0x18, 0x22, 0x43, 0x12, 0xa0, 0xdc, 0xba, 0xba,
+  0xbc, 0x9a, 0x09, 0x08, 0x88, 0xb9, 0xeb, 0xbb, 0x9a, 0x31, 0x46, 0x33,
+  0x33, 0x12, 0x10, 0x10, 0x53, 0x24, 0x33, 0x13, 0x81, 0xcb, 0xad, 0xbb,
+  0x9a, 0x89, 0xa9, 0xbd, 0xbe, 0xbc, 0x9b, 0x10, 0x44, 0x44, 0x23, 0x13,
+  0x01, 0x20, 0x54, 0x44, 0x35, 0x33, 0x12, 0xb9, 0xbd, 0xbc, 0x99, 0x08,
+  0x32, 0xa1, 0xef, 0xac, 0xbb, 0xdb, 0xaa, 0x09, 0x22, 0x33, 0x34, 0x23,
+  0xe8, 0xcc, 0x19, 0x56, 0x24, 0x23, 0x24, 0x01, 0xa9, 0x1a, 0x32, 0x15,
+  0x28, 0x22, 0x35, 0x98, 0xfc, 0xbb, 0xcc, 0xba, 0x1a, 0x22, 0xa3, 0xbe,
+  0xbc, 0xab, 0xad, 0x88, 0x30, 0x11, 0x01, 0x40, 0x23, 0x92, 0xae, 0x10,
+  0x54, 0x33, 0x34, 0x33, 0x91, 0xab, 0x89, 0x21, 0x23, 0x21, 0x22, 0x02,
+  0xec, 0xbd, 0xbb, 0xbc, 0xaa, 0x20, 0x23, 0x90, 0xeb, 0xbb, 0xba, 0x09,
+  0x43, 0x45, 0x23, 0x22, 0x12, 0x00, 0x88, 0x21, 0x45, 0x43, 0x22, 0x81,
+  0xca, 0xbc, 0xac, 0x99, 0x88, 0x80, 0x99, 0xeb, 0xdb, 0xab, 0x8a, 0x21,
+  0x44, 0x34, 0x23, 0x80, 0x88, 0x21, 0x54, 0x54, 0x43, 0x23, 0x01, 0x98,
+  0xcb, 0xcc, 0xbb, 0x18, 0x35, 0x81, 0xcc, 0xbd, 0xdc, 0xaa, 0x09, 0x12,
+  0x01, 0x00, 0x32, 0x05, 0xd9, 0xac, 0x41, 0x45, 0x33, 0x36, 0x23, 0xb9,
+  0x8c, 0x20, 0x24, 0x28, 0x01, 0x35, 0x80, 0xfb, 0x9b, 0xdb, 0xeb, 0x0a,
+  0x32, 0x02, 0xbd, 0xbb, 0xa9, 0xcb, 0x88, 0x31, 0x02, 0x21, 0x48, 0x14,
+  0xb8, 0xaf, 0x31, 0x46, 0x12, 0x01, 0x01, 0xa8, 0x99, 0x31, 0x14, 0x01,
+  0x00, 0x11, 0xc8, 0xdd, 0xaa, 0x08, 0x01, 0x08, 0x88, 0xdb, 0xbc, 0x0a,
+  0x20, 0x11, 0x10, 0x22, 0x01, 0x90, 0x18, 0x73, 0x34, 0x24, 0x12, 0x81,
+  0xa8, 0x89, 0x18, 0x11, 0x91, 0xc9, 0xcd, 0xbc, 0x9d, 0xaa, 0x89, 0x09,
+  0x80, 0x22, 0x82, 0x98, 0x70, 0x24, 0x54, 0x35, 0x24, 0x12, 0x80, 0x00,
+  0x99, 0xad, 0x29, 0x47, 0x92, 0xda, 0xdb, 0xbc, 0xac, 0x28, 0x24, 0xa0,
+  0xad, 0x9a, 0x88, 0xb9, 0x0b, 0x76, 0x24, 0x01, 0x10, 0x90, 0xbc, 0x70,
+  0x45, 0x03, 0x99, 0x89, 0x01, 0x08, 0x99, 0x42, 0x12, 0xc0, 0x8b, 0xec,
+  0xdd, 0x8a, 0x33, 0x03, 0xbd, 0xbb, 0x09, 0x9a, 0x10, 0x41, 0xa1, 0x89,
+  0x19, 0x92, 0xad, 0x49, 0x77, 0x02, 0x99, 0x89, 0x11, 0x11, 0x22, 0x13,
+  0xa8, 0x9a, 0x00, 0x01, 0x99, 0x28, 0x25, 0xe0, 0xcd, 0x99, 0x11, 0x00,
+  0x80, 0xb9, 0xcb, 0x9a, 0x31, 0x12, 0x01, 0x81, 0xb9, 0x9a, 0x48, 0x54,
+  0x14, 0x81, 0x98, 0x99, 0x20, 0x22, 0x13, 0x80, 0xba, 0x99, 0x99, 0x09,
+  0x44, 0x36, 0x33, 0x81, 0x3a, 0x0b, 0x66, 0x35, 0x32, 0x01, 0x98, 0xfa,
+  0xdb, 0x1a, 0x54, 0x82, 0xda, 0xcb, 0xbd, 0x0a, 0x43, 0x83, 0xcd, 0x9c,
+  0x18, 0x80, 0x89, 0x41, 0x25, 0xa0, 0xaa, 0x10, 0x01, 0x77, 0x35, 0xa1,
+  0xac, 0x39, 0x35, 0x01, 0x88, 0x01, 0x98, 0xca, 0x19, 0x31, 0xa2, 0x4b,
+  0xd2, 0xff, 0x8c, 0x32, 0x83, 0xeb, 0x99, 0x18, 0x88, 0x00, 0x01, 0xa8,
+  0x8a, 0x08, 0x81, 0x28, 0x74, 0x14, 0xb9, 0x9c, 0x62, 0x23, 0x98, 0x88,
+  0x08, 0x00, 0x31, 0x13, 0xa8, 0x8a, 0x80, 0xc9, 0x1b, 0x62, 0x82, 0xec,
+  0xab, 0x20, 0x02, 0x98, 0xbb, 0xab, 0x89, 0x21, 0x02, 0xaa, 0xac, 0x89,
+  0x20, 0x34, 0x23, 0x00, 0xba, 0x50, 0x35, 0x25, 0x02, 0x11, 0x20, 0x31,
+  0x46, 0x43, 0x23, 0x01, 0x0a, 0x09, 0x54, 0x33, 0x81, 0xb8, 0xdd, 0xbc,
+  0x8a, 0x11, 0x10, 0xf9, 0xef, 0xab, 0x30, 0x14, 0xda, 0xbb, 0x09, 0x01,
+  0x98, 0x30, 0x14, 0xea, 0x8a, 0x31, 0x52, 0x66, 0x13, 0xea, 0x9b, 0x55,
+  0x03, 0xb8, 0x89, 0x21, 0x02, 0x28, 0x11, 0x91, 0xae, 0x98, 0x00, 0xaa,
+  0x47, 0xb1, 0xff, 0x19, 0x32, 0xb1, 0xad, 0x08, 0x02, 0x88, 0x88, 0x88,
+  0xa9, 0x00, 0x20, 0x02, 0x32, 0x12, 0xfc, 0x1b, 0x47, 0x02, 0xbb, 0x19,
+  0x34, 0x81, 0x88, 0x80, 0x88, 0x10, 0x22, 0x91, 0xa9, 0x99, 0xba, 0x19,
+  0x73, 0xc0, 0xbe, 0x0a, 0x42, 0xa0, 0xcb, 0x99, 0x10, 0x80, 0x98, 0xa9,
+  0xaa, 0x10, 0x22, 0x23, 0xa0, 0x08, 0x61, 0x44, 0x33, 0x22, 0x22, 0x32,
+  0x54, 0x33, 0x32, 0x22, 0x31, 0x80, 0x19, 0x54, 0x02, 0xea, 0xcc, 0xba,
+  0xac, 0x41, 0xb3, 0xff, 0x9c, 0x20, 0x11, 0xba, 0xbd, 0x09, 0x11, 0x00,
+  0x01, 0xda, 0xab, 0x62, 0x02, 0x61, 0x15, 0xe9, 0x0c, 0x64, 0x02, 0xca,
+  0x09, 0x43, 0x01, 0x89, 0x88, 0x80, 0x10, 0x21, 0x83, 0xad, 0x88, 0xa9,
+  0xaf, 0x74, 0x81, 0xce, 0x2a, 0x43, 0xa0, 0xad, 0x10, 0x02, 0x99, 0x80,
+  0x88, 0x99, 0x20, 0x10, 0x81, 0x18, 0xa8, 0x9a, 0x71, 0x47, 0xa8, 0x9c,
+  0x51, 0x12, 0xa9, 0x09, 0x11, 0x01, 0x18, 0x00, 0xa8, 0x09, 0x00, 0x01,
+  0x00, 0xc9, 0xcd, 0x09, 0x33, 0xb1, 0xbf, 0x8a, 0x12, 0x91, 0xba, 0xaa,
+  0x88, 0x10, 0x10, 0x98, 0xba, 0x09, 0x55, 0x23, 0x00, 0x10, 0x53, 0x33,
+  0x33, 0x44, 0x53, 0x12, 0x80, 0x30, 0x46, 0x12, 0x99, 0xaa, 0x9a, 0x42,
+  0x13, 0xfa, 0xbe, 0xac, 0x10, 0x15, 0xe9, 0xad, 0x09, 0x23, 0xa0, 0xbd,
+  0x8a, 0x00, 0x10, 0x12, 0xc0, 0xbc, 0x31, 0x03, 0x72, 0x57, 0xc8, 0x9c,
+  0x73, 0x03, 0xb9, 0x0b, 0x43, 0x03, 0x98, 0x88, 0x00, 0x19, 0x22, 0x24,
+  0xbc, 0x99, 0xa8, 0xcf, 0x71, 0x03, 0xfd, 0x1a, 0x32, 0xb2, 0xad, 0x18,
+  0x12, 0x99, 0x88, 0x08, 0xa9, 0x20, 0x11, 0x80, 0x08, 0x98, 0x98, 0x71,
+  0x37, 0xb0, 0x9d, 0x41, 0x14, 0xb8, 0x89, 0x22, 0x81, 0x00, 0x01, 0xa9,
+  0x09, 0x21, 0x80, 0x00, 0xca, 0xbd, 0x19, 0x24, 0xc0, 0xcd, 0x09, 0x21,
+  0x90, 0xbb, 0x9a, 0x08, 0x10, 0x88, 0xa9, 0x9a, 0x10, 0x33, 0x35, 0x01,
+  0x88, 0x73, 0x35, 0x22, 0x80, 0x20, 0x35, 0x24, 0x81, 0x08, 0x31, 0x33,
+  0x13, 0x91, 0xdd, 0xaa, 0x10, 0x12, 0xe0, 0xdf, 0xac, 0x30, 0x13, 0xfb,
+  0xad, 0x18, 0x12, 0xb8, 0xac, 0x89, 0x88, 0x20, 0x15, 0xc9, 0x8b, 0x33,
+  0x88, 0x76, 0x16, 0xda, 0x1b, 0x46, 0x81, 0xba, 0x18, 0x43, 0x01, 0x89,
+  0x08, 0x90, 0x20, 0x31, 0xa4, 0xac, 0x98, 0xe9, 0x0d, 0x46, 0xb0, 0xcf,
+  0x20, 0x23, 0xd9, 0x8b, 0x21, 0x91, 0x89, 0x08, 0x98, 0x0a, 0x11, 0x11,
+  0x88, 0x80, 0x99, 0x18, 0x77, 0x02, 0xd9, 0x1a, 0x44, 0x82, 0xab, 0x18,
+  0x13, 0x81, 0x08, 0x81, 0x9a, 0x10, 0x12, 0x98, 0x88, 0xeb, 0xab, 0x41,
+  0x03, 0xec, 0xab, 0x20, 0x02, 0xb9, 0xad, 0x88, 0x10, 0x08, 0x99, 0xa9,
+  0x09, 0x21, 0x23, 0x02, 0x00, 0x31, 0x56, 0x43, 0x22, 0x11, 0x31, 0x54,
+  0x43, 0x22, 0x01, 0x08, 0x21, 0x44, 0x13, 0xc9, 0xbc, 0xab, 0x28, 0x25,
+  0xfa, 0xcf, 0x8a, 0x22, 0x92, 0xce, 0xab, 0x21, 0x02, 0xcb, 0xaa, 0x99,
+  0x8a, 0x54, 0x82, 0xcb, 0x20, 0xa1, 0x6a, 0x77, 0x91, 0xbc, 0x40, 0x26,
+  0xa0, 0xaa, 0x30, 0x33, 0x00, 0x99, 0x10, 0x99, 0x12, 0x73, 0xb0, 0x9b,
+  0x88, 0xfc, 0x4a, 0x26, 0xea, 0x8d, 0x31, 0x83, 0xcc, 0x09, 0x12, 0x90,
+  0x89, 0x80, 0x99, 0x18, 0x11, 0x00, 0x89, 0x91, 0x89, 0x60, 0x36, 0x91,
+  0xbd, 0x48, 0x35, 0xa0, 0xaa, 0x30, 0x23, 0x98, 0x00, 0x80, 0x8a, 0x31,
+  0x03, 0xaa, 0xaa, 0xdb, 0x0a, 0x24, 0xc1, 0xbf, 0x0a, 0x21, 0x90, 0xcb,
+  0xab, 0x00, 0x01, 0xa8, 0xab, 0x9b, 0x20, 0x24, 0x01, 0x98, 0x18, 0x65,
+  0x33, 0x11, 0x18, 0x63, 0x24, 0x02, 0x00, 0x32, 0x35, 0x12, 0x88, 0x88,
+  0x31, 0x44, 0x81, 0xcc, 0xbc, 0x9a, 0x31, 0x82, 0xff, 0xae, 0x18, 0x22,
+  0xc8, 0xcd, 0x09, 0x21, 0xa0, 0xa9, 0xa9, 0xbb, 0x51, 0x15, 0xa8, 0x19,
+  0x92, 0xad, 0x75, 0x17, 0xc9, 0x0a, 0x63, 0x02, 0xaa, 0x09, 0x32, 0x03,
+  0x00, 0x09, 0xa0, 0x19, 0x62, 0x84, 0x9c, 0x89, 0xb8, 0xaf, 0x45, 0x92,
+  0xdf, 0x29, 0x23, 0xc0, 0x9c, 0x10, 0x02, 0x99, 0x88, 0x88, 0x99, 0x21,
+  0x10, 0x98, 0x18, 0xa8, 0x10, 0x75, 0x12, 0xb9, 0x9c, 0x64, 0x03, 0xb9,
+  0x0a, 0x43, 0x01, 0x99, 0x10, 0x98, 0x18, 0x22, 0x90, 0x9b, 0x99, 0xaa,
+  0x38, 0x05, 0xfb, 0x9d, 0x18, 0x02, 0xc8, 0xab, 0x09, 0x21, 0x98, 0xbb,
+  0x8b, 0x20, 0x11, 0x98, 0x89, 0x22, 0x24, 0x21, 0x53, 0x36, 0x02, 0x09,
+  0x73, 0x13, 0x23, 0x23, 0x22, 0x22, 0x43, 0x35, 0x04, 0xa0, 0x9a, 0x30,
+  0x25, 0x93, 0xee, 0xac, 0x09, 0x33, 0xc0, 0xef, 0x9a, 0x21, 0x02, 0xdc,
+  0xab, 0x10, 0x81, 0x99, 0x88, 0xeb, 0x8b, 0x53, 0x12, 0x9a, 0x31, 0xf9,
+  0x2c, 0x77, 0x81, 0xbb, 0x39, 0x37, 0x80, 0x9b, 0x18, 0x24, 0x81, 0x80,
+  0x18, 0xb8, 0x10, 0x63, 0xb2, 0x8c, 0x98, 0xfb, 0x2b, 0x47, 0xc8, 0x9f,
+  0x30, 0x03, 0xda, 0x8a, 0x31, 0x90, 0x89, 0x88, 0x98, 0x19, 0x12, 0x80,
+  0x89, 0x81, 0x09, 0x30, 0x67, 0x81, 0xbb, 0x3a, 0x47, 0x81, 0xbb, 0x20,
+  0x24, 0x90, 0x89, 0x00, 0x80, 0x20, 0x02, 0xaa, 0x8b, 0x00, 0xa9, 0x20,
+  0xb1, 0xff, 0x89, 0x21, 0x90, 0xbb, 0xab, 0x20, 0x02, 0xb9, 0xad, 0x89,
+  0x22, 0x81, 0x98, 0xaa, 0x30, 0x25, 0x12, 0x10, 0x21, 0x43, 0x52, 0x33,
+  0x14, 0x12, 0x22, 0x43, 0x24, 0x23, 0x24, 0x02, 0x80, 0x64, 0x33, 0x82,
+  0xcb, 0x8c, 0x51, 0x23, 0xd9, 0xcd, 0x9a, 0x28, 0x13, 0xf9, 0xbf, 0x0a,
+  0x22, 0xa1, 0xce, 0x8a, 0x00, 0x88, 0x10, 0xb0, 0xcf, 0x18, 0x24, 0x80,
+  0x21, 0xe8, 0x9d, 0x74, 0x13, 0xc9, 0x8c, 0x53, 0x03, 0xa9, 0x8a, 0x32,
+  0x04, 0x80, 0x08, 0xa2, 0x9a, 0x50, 0x05, 0xb9, 0x89, 0xc9, 0xaf, 0x54,
+  0x82, 0xcf, 0x19, 0x43, 0xb0, 0x9d, 0x10, 0x02, 0x99, 0x88, 0x88, 0x89,
+  0x21, 0x00, 0x99, 0x18, 0x80, 0x18, 0x73, 0x14, 0xba, 0x0d, 0x73, 0x12,
+  0xba, 0x0a, 0x34, 0x82, 0x9a, 0x18, 0x80, 0x10, 0x22, 0xb8, 0x9c, 0x10,
+  0x88, 0x08, 0x80, 0xfc, 0x9a, 0x30, 0x82, 0xdb, 0xab, 0x18, 0x22, 0xb8,
+  0xcc, 0x09, 0x11, 0x02, 0xa9, 0x8a, 0x28, 0x32, 0x12, 0x00, 0x10, 0x23,
+  0x53, 0x45, 0x12, 0x98, 0x10, 0x46, 0x13, 0x80, 0x08, 0x63, 0x22, 0x21,
+  0x12, 0x02, 0x09, 0x73, 0x25, 0x02, 0xcc, 0x9b, 0x52, 0x14, 0xd9, 0xbc,
+  0x9b, 0x41, 0x03, 0xfc, 0xbc, 0x18, 0x23, 0xc9, 0xad, 0x89, 0x90, 0x19,
+  0x32, 0xf8, 0x9e, 0x20, 0x13, 0x11, 0x02, 0xfd, 0x1a, 0x57, 0x81, 0xcb,
+  0x18, 0x35, 0x91, 0xaa, 0x28, 0x23, 0x01, 0x80, 0x20, 0xca, 0x89, 0x74,
+  0xa1, 0x99, 0x89, 0xec, 0x39, 0x27, 0xe8, 0x9d, 0x41, 0x02, 0xcb, 0x89,
+  0x22, 0x90, 0x89, 0x88, 0x98, 0x18, 0x03, 0x98, 0x8a, 0x02, 0x08, 0x40,
+  0x36, 0xa0, 0xbd, 0x50, 0x26, 0xa0, 0x9c, 0x21, 0x14, 0xa8, 0x88, 0x00,
+  0x00, 0x11, 0x91, 0xab, 0x08, 0x12, 0x98, 0x88, 0xca, 0xbc, 0x28, 0x23,
+  0xfa, 0xac, 0x08, 0x12, 0xa0, 0xcb, 0x89, 0x11, 0x01, 0x99, 0x9a, 0x19,
+  0x41, 0x22, 0x90, 0x88, 0x30, 0x44, 0x33, 0x82, 0x99, 0x61, 0x35, 0x81,
+  0x99, 0x30, 0x45, 0x01, 0x98, 0x10, 0x53, 0x23, 0x02, 0xa0, 0x19, 0x55,
+  0x04, 0x01, 0xba, 0xbd, 0x39, 0x37, 0xb1, 0xef, 0x8a, 0x31, 0x02, 0xec,
+  0x9c, 0x28, 0x12, 0xba, 0x9d, 0x98, 0xa8, 0x30, 0x16, 0xeb, 0x8b, 0x41,
+  0x12, 0x31, 0xb1, 0xff, 0x30, 0x27, 0xb0, 0x9c, 0x31, 0x25, 0xa8, 0x8a,
+  0x30, 0x12, 0x00, 0x00, 0x82, 0x9e, 0x18, 0x26, 0xa9, 0x89, 0xb9, 0xbf,
+  0x72, 0x04, 0xec, 0x0a, 0x24, 0xa1, 0xbc, 0x10, 0x13, 0xa9, 0x88, 0x88,
+  0x99, 0x32, 0x00, 0xaa, 0x29, 0x00, 0x01, 0x72, 0x13, 0xd9, 0x9b, 0x65,
+  0x03, 0xd9, 0x89, 0x33, 0x83, 0xaa, 0x08, 0x01, 0x20, 0x02, 0xc8, 0x9b,
+  0x32, 0x81, 0x9a, 0x99, 0xd9, 0x9a, 0x31, 0x81, 0xde, 0x9a, 0x20, 0x11,
+  0xca, 0x9b, 0x08, 0x21, 0x81, 0xba, 0xab, 0x41, 0x24, 0x90, 0x8a, 0x21,
+  0x32, 0x32, 0x33, 0x80, 0x39, 0x55, 0x22, 0x20, 0x02, 0x32, 0x22, 0x44,
+  0x36, 0x22, 0x08, 0x51, 0x33, 0x43, 0x36, 0x92, 0x9d, 0x48, 0x35, 0x92,
+  0xbc, 0x9c, 0x18, 0x44, 0xa1, 0xdf, 0x9b, 0x30, 0x04, 0xfa, 0xab, 0x19,
+  0x12, 0xa9, 0xab, 0xca, 0xbe, 0x50, 0x15, 0xc9, 0xab, 0x31, 0x33, 0x44,
+  0xb1, 0xef, 0x48, 0x25, 0xa0, 0xac, 0x30, 0x25, 0x98, 0x9a, 0x21, 0x02,
+  0x80, 0x11, 0x83, 0xbd, 0x09, 0x37, 0x98, 0x9a, 0xb8, 0xcf, 0x71, 0x03,
+  0xec, 0x0a, 0x43, 0x91, 0xad, 0x18, 0x12, 0x98, 0x89, 0x88, 0x88, 0x30,
+  0x91, 0xa9, 0x19, 0x02, 0x00, 0x31, 0x26, 0xc8, 0xac, 0x73, 0x14, 0xb9,
+  0x8c, 0x43, 0x02, 0xb9, 0x88, 0x11, 0x11, 0x11, 0xb9, 0x9c, 0x32, 0x03,
+  0xba, 0x9b, 0x98, 0x99, 0x32, 0xb1, 0xef, 0x8a, 0x21, 0x81, 0xba, 0x9c,
+  0x10, 0x11, 0x90, 0xba, 0x8b, 0x42, 0x23, 0xa8, 0x9c, 0x41, 0x23, 0x00,
+  0x80, 0x02, 0x21, 0x63, 0x02, 0x99, 0x30, 0x35, 0x90, 0x8b, 0x53, 0x14,
+  0x98, 0x0a, 0x52, 0x43, 0xa3, 0x01, 0x18, 0x65, 0x14, 0xa0, 0xab, 0x30,
+  0x36, 0x13, 0xeb, 0xbc, 0x09, 0x44, 0x92, 0xed, 0xbb, 0x30, 0x14, 0xe8,
+  0xcb, 0x09, 0x02, 0x90, 0x88, 0xfa, 0xac, 0x50, 0x24, 0xc9, 0x9c, 0x11,
+  0x22, 0x42, 0x92, 0xdf, 0x39, 0x46, 0x90, 0xac, 0x20, 0x15, 0x90, 0x8a,
+  0x20, 0x01, 0x08, 0x20, 0x83, 0xad, 0x0b, 0x27, 0x90, 0x99, 0xb8, 0xbf,
+  0x71, 0x04, 0xfa, 0x0b, 0x43, 0xa2, 0xbc, 0x18, 0x13, 0x98, 0x89, 0x98,
+  0x88, 0x30, 0x82, 0xba, 0x1a, 0x23, 0x00, 0x28, 0x26, 0xc1, 0xac, 0x71,
+  0x15, 0xc8, 0x8a, 0x42, 0x02, 0xa9, 0x89, 0x11, 0x11, 0x11, 0xb9, 0x8c,
+  0x31, 0x04, 0xaa, 0x9a, 0x80, 0x08, 0x11, 0xb8, 0xbe, 0x8a, 0x32, 0x91,
+  0xdc, 0x9a, 0x10, 0x12, 0xa9, 0xbb, 0x1a, 0x31, 0x13, 0xb8, 0x9c, 0x28,
+  0x45, 0x82, 0x98, 0x18, 0x32, 0x23, 0x21, 0x83, 0x98, 0x51, 0x35, 0x81,
+  0x28, 0x20, 0x18, 0x71, 0x14, 0x21, 0x12, 0x92, 0x00, 0x57, 0x34, 0x91,
+  0xaa, 0x20, 0x46, 0x33, 0xa0, 0xbe, 0x0b, 0x46, 0x12, 0xeb, 0xbc, 0x28,
+  0x34, 0xa0, 0xcf, 0x8b, 0x31, 0x03, 0xcc, 0xac, 0x08, 0x11, 0x00, 0xa8,
+  0xfc, 0xab, 0x73, 0x04, 0xc9, 0x9a, 0x31, 0x33, 0x24, 0xf9, 0x9d, 0x72,
+  0x03, 0xc9, 0x8a, 0x53, 0x01, 0x9a, 0x18, 0x11, 0x88, 0x20, 0x32, 0xf0,
+  0x9a, 0x58, 0x02, 0xa8, 0x99, 0xdc, 0x2b, 0x57, 0xb0, 0xbe, 0x30, 0x15,
+  0xc9, 0x9a, 0x22, 0x81, 0x99, 0x88, 0x89, 0x18, 0x23, 0xa9, 0xab, 0x31,
+  0x12, 0x90, 0x51, 0x12, 0xdc, 0x3a, 0x47, 0x91, 0xbc, 0x30, 0x25, 0x98,
+  0x9a, 0x10, 0x11, 0x02, 0xa8, 0x9c, 0x31, 0x23, 0xb9, 0xab, 0x00, 0x00,
+  0x10, 0xa1, 0xdd, 0x9b, 0x31, 0x03, 0xdb, 0xac, 0x08, 0x22, 0x91, 0xeb,
+  0x8a, 0x20, 0x13, 0xa8, 0xab, 0x09, 0x42, 0x23, 0xc0, 0x88, 0x10, 0x21,
+  0x43, 0x80, 0xa9, 0x10, 0x35, 0x34, 0x80, 0xbc, 0x0a, 0x47, 0x02, 0xa9,
+  0x9a, 0x31, 0x44, 0x12, 0xb9, 0xab, 0x61, 0x34, 0x12, 0xb8, 0xad, 0x30,
+  0x36, 0x13, 0xda, 0xbc, 0x18, 0x31, 0x15, 0xb8, 0xcf, 0x8a, 0x41, 0x02,
+  0xfb, 0xac, 0x28, 0x23, 0xb9, 0xbe, 0x89, 0x10, 0x21, 0x02, 0xfd, 0xac,
+  0x62, 0x23, 0xca, 0x8c, 0x30, 0x33, 0x14, 0xf9, 0xab, 0x73, 0x05, 0xb9,
+  0x8a, 0x43, 0x83, 0xa9, 0x18, 0x11, 0x98, 0x31, 0x43, 0xf0, 0xaa, 0x48,
+  0x04, 0x98, 0x9a, 0xeb, 0x2b, 0x57, 0xb0, 0xbe, 0x30, 0x15, 0xc9, 0x8a,
+  0x21, 0x81, 0x99, 0x98, 0x88, 0x28, 0x13, 0xaa, 0xab, 0x23, 0x22, 0x98,
+  0x31, 0x03, 0xde, 0x59, 0x35, 0xb0, 0xad, 0x41, 0x14, 0x99, 0x8a, 0x10,
+  0x21, 0x02, 0xb8, 0x9c, 0x41, 0x13, 0xa9, 0x9b, 0x18, 0x11, 0x10, 0xa8,
+  0xbd, 0x9a, 0x42, 0x82, 0xfa, 0x9a, 0x20, 0x01, 0xa8, 0xac, 0x09, 0x22,
+  0x81, 0xba, 0x8b, 0x20, 0x13, 0x01, 0xa9, 0x9a, 0x41, 0x34, 0x11, 0x80,
+  0x99, 0x30, 0x46, 0x14, 0x90, 0xbb, 0x69, 0x36, 0xa1, 0xac, 0x38, 0x26,
+  0xa1, 0x09, 0x00, 0x08, 0x43, 0x23, 0xb9, 0x0a, 0x33, 0x35, 0x33, 0xa1,
+  0xce, 0x1a, 0x64, 0x12, 0xda, 0xad, 0x08, 0x34, 0xa1, 0xde, 0xaa, 0x21,
+  0x23, 0xf9, 0xad, 0x09, 0x32, 0xa1, 0xcc, 0xaa, 0x09, 0x52, 0x23, 0xf9,
+  0xbd, 0x40, 0x26, 0xa8, 0xbb, 0x30, 0x34, 0x14, 0xc0, 0xae, 0x60, 0x24,
+  0xb9, 0x8c, 0x42, 0x02, 0x99, 0x08, 0x01, 0x98, 0x31, 0x34, 0xf8, 0xaa,
+  0x48, 0x14, 0xa8, 0x9b, 0xbc, 0x4b, 0x57, 0xb8, 0xaf, 0x31, 0x13, 0xea,
+  0x0a, 0x21, 0x80, 0x98, 0x98, 0x09, 0x38, 0x83, 0xaa, 0x8c, 0x22, 0x21,
+  0x99, 0x10, 0x83, 0xeb, 0x68, 0x25, 0xb8, 0x9d, 0x42, 0x03, 0xa9, 0x8a,
+  0x21, 0x32, 0x01, 0xdb, 0x0a, 0x53, 0x82, 0xb9, 0x8a, 0x21, 0x11, 0x90,
+  0xba, 0xab, 0x28, 0x25, 0xb8, 0xbe, 0x09, 0x31, 0x81, 0xcb, 0x9c, 0x10,
+  0x22, 0x99, 0xbb, 0x89, 0x20, 0x43, 0xa0, 0xad, 0x38, 0x13, 0x90, 0x08,
+  0x98, 0x08, 0x55, 0x02, 0xaa, 0x19, 0x42, 0x43, 0x91, 0xcb, 0x41, 0x00,
+  0x77, 0x27, 0x10, 0x89, 0x88, 0x18, 0x53, 0x22, 0x21, 0x33, 0xe0, 0xbf,
+  0xac, 0x09, 0x90, 0xdb, 0x39, 0x05, 0xdd, 0x8b, 0x80, 0xbb, 0x50, 0x13,
+  0x18, 0x57, 0x91, 0xaa, 0x73, 0x02, 0x80, 0x73, 0x13, 0x02, 0x18, 0x80,
+  0x05, 0x1a, 0x09, 0x17, 0x09, 0x90, 0xf0, 0x9d, 0x00, 0xc8, 0x8e, 0x01,
+  0xa1, 0x9d, 0x80, 0xa0, 0x8d, 0x88, 0x00, 0x29, 0x82, 0x80, 0x29, 0x82,
+  0x11, 0x39, 0x36, 0x37, 0x81, 0x08, 0x34, 0x90, 0x8b, 0x42, 0x02, 0x19,
+  0x13, 0xb8, 0x9b, 0xb8, 0xbf, 0x0a, 0x01, 0x99, 0x8a, 0x98, 0xdb, 0xac,
+  0x9b, 0x18, 0x31, 0x33, 0x32, 0x22, 0x02, 0xb8, 0x5a, 0x67, 0x23, 0x32,
+  0x16, 0x01, 0x80, 0x88, 0x21, 0x53, 0x22, 0x32, 0x05, 0xda, 0xbd, 0xaa,
+  0x88, 0xb9, 0x8b, 0x43, 0xfa, 0xbf, 0x99, 0xc9, 0x09, 0x23, 0xa8, 0x72,
+  0x06, 0xba, 0x39, 0x26, 0x98, 0x41, 0x36, 0x10, 0x80, 0x11, 0x30, 0xb8,
+  0x41, 0x62, 0xb0, 0x32, 0xa0, 0xff, 0x1a, 0x91, 0xbe, 0x28, 0x03, 0xcd,
+  0x08, 0x00, 0xcb, 0x09, 0x10, 0x98, 0x12, 0x12, 0x99, 0x02, 0x41, 0x88,
+  0x22, 0x77, 0x11, 0x98, 0x31, 0x02, 0xca, 0x39, 0x23, 0xa8, 0x20, 0x83,
+  0xeb, 0x8a, 0xaa, 0xac, 0x08, 0x81, 0xa9, 0x9a, 0xba, 0xcc, 0xac, 0x18,
+  0x41, 0x11, 0x21, 0x32, 0x80, 0x88, 0x73, 0x35, 0x33, 0x44, 0x22, 0x81,
+  0x80, 0x20, 0x34, 0x21, 0x35, 0x04, 0xe9, 0xcb, 0xa9, 0xa9, 0xbb, 0x29,
+  0x82, 0xef, 0xab, 0xc9, 0xbd, 0x28, 0x83, 0xab, 0x74, 0x84, 0xcb, 0x38,
+  0x24, 0xa9, 0x61, 0x34, 0x81, 0x00, 0x22, 0x80, 0xa0, 0x72, 0x21, 0xb8,
+  0x54, 0xa0, 0xdf, 0x10, 0x80, 0xbd, 0x28, 0x13, 0xcd, 0x19, 0x01, 0xcb,
+  0x89, 0x21, 0x98, 0x01, 0x22, 0x88, 0x90, 0x42, 0x11, 0x08, 0x67, 0x12,
+  0x98, 0x30, 0x13, 0xda, 0x19, 0x43, 0x98, 0x09, 0x12, 0xc9, 0x9c, 0x89,
+  0xba, 0x89, 0x10, 0xb9, 0xbb, 0xaa, 0xeb, 0xac, 0x19, 0x23, 0x02, 0x21,
+  0x43, 0x01, 0x21, 0x55, 0x43, 0x24, 0x33, 0x12, 0x10, 0x31, 0x24, 0x11,
+  0x54, 0x13, 0xea, 0xac, 0x9a, 0xca, 0x9c, 0x19, 0x90, 0xbe, 0x9c, 0xda,
+  0xae, 0x28, 0x82, 0xbb, 0x73, 0x05, 0xca, 0x28, 0x14, 0xa8, 0x48, 0x36,
+  0x81, 0x00, 0x21, 0x80, 0xa8, 0x61, 0x12, 0xb8, 0x72, 0x82, 0xde, 0x2a,
+  0x02, 0xec, 0x19, 0x22, 0xd8, 0x8b, 0x12, 0xc8, 0x8b, 0x20, 0x91, 0x08,
+  0x21, 0x92, 0x98, 0x28, 0x14, 0x80, 0x71, 0x27, 0x90, 0x09, 0x33, 0xb0,
+  0x8d, 0x42, 0x82, 0x99, 0x20, 0x90, 0xcb, 0x9a, 0x98, 0x89, 0x88, 0x90,
+  0xcb, 0xac, 0xab, 0xcb, 0x89, 0x42, 0x12, 0x00, 0x11, 0x01, 0x20, 0x73,
+  0x45, 0x33, 0x14, 0x11, 0x00, 0x10, 0x00, 0x20, 0x36, 0x03, 0xda, 0xcb,
+  0xcc, 0xbb, 0x9b, 0x88, 0x9a, 0x8a, 0xea, 0xef, 0x9a, 0x21, 0xb0, 0x8c,
+  0x66, 0x82, 0xbb, 0x40, 0x04, 0xaa, 0x50, 0x34, 0x80, 0x10, 0x12, 0xb8,
+  0x88, 0x62, 0x80, 0x99, 0x65, 0xa1, 0xdd, 0x29, 0x02, 0xcd, 0x2a, 0x24,
+  0xd9, 0x8a, 0x21, 0xb8, 0x9c, 0x20, 0x82, 0x88, 0x28, 0x01, 0xa9, 0x2a,
+  0x33, 0x82, 0x78, 0x37, 0x90, 0x8a, 0x43, 0xa1, 0x9c, 0x52, 0x02, 0x99,
+  0x08, 0x01, 0xb9, 0x9c, 0x18, 0x81, 0x99, 0x8a, 0x98, 0xcd, 0x9a, 0x98,
+  0x98, 0x31, 0x22, 0x98, 0x08, 0x02, 0x01, 0x54, 0x45, 0x24, 0x13, 0x01,
+  0x10, 0x00, 0xa9, 0x40, 0x25, 0x90, 0x9a, 0xf9, 0xbf, 0x9a, 0x90, 0xdb,
+  0x2a, 0x43, 0xe8, 0xad, 0x18, 0x83, 0xeb, 0x39, 0x47, 0x90, 0x8b, 0x43,
+  0xa2, 0xab, 0x73, 0x13, 0x08, 0x32, 0x82, 0x9d, 0x18, 0x04, 0xaa, 0x39,
+  0x67, 0xb8, 0xad, 0x30, 0xa2, 0xcf, 0x20, 0x13, 0xea, 0x09, 0x11, 0xc8,
+  0x8a, 0x30, 0x81, 0x98, 0x18, 0x01, 0xb8, 0x1b, 0x34, 0x92, 0x68, 0x25,
+  0xa0, 0x8b, 0x34, 0xa1, 0x9b, 0x64, 0x02, 0xa9, 0x09, 0x12, 0xa9, 0x9c,
+  0x21, 0x03, 0xbb, 0x0b, 0x91, 0xcc, 0x9a, 0x01, 0x90, 0x00, 0x01, 0xa9,
+  0x88, 0x22, 0x10, 0x42, 0x37, 0x24, 0x00, 0x20, 0x00, 0xc9, 0x8a, 0x31,
+  0xb9, 0x3a, 0x17, 0xff, 0x9b, 0x10, 0xea, 0x8c, 0x52, 0x92, 0xdb, 0x18,
+  0x23, 0xea, 0x8b, 0x55, 0x02, 0xab, 0x50, 0x13, 0xda, 0x19, 0x43, 0x00,
+  0x38, 0x24, 0xa8, 0x08, 0x91, 0xbd, 0x29, 0x77, 0x81, 0xca, 0x1a, 0x02,
+  0xfc, 0x0a, 0x43, 0xa1, 0xac, 0x18, 0x91, 0xbb, 0x29, 0x44, 0x01, 0xa9,
+  0x8a, 0x08, 0x21, 0x34, 0x22, 0x42, 0x14, 0xea, 0x8b, 0x53, 0x02, 0xa9,
+  0x18, 0x82, 0xcc, 0x9b, 0x20, 0x03, 0xa9, 0xab, 0x9a, 0xaa, 0x89, 0x21,
+  0x42, 0x25, 0xb0, 0xab, 0x50, 0x24, 0x01, 0x10, 0x12, 0x91, 0x89, 0x51,
+  0x23, 0x88, 0x09, 0x52, 0x12, 0x52, 0x57, 0x12, 0xb9, 0x0a, 0x53, 0x81,
+  0x10, 0x24, 0xb8, 0xcf, 0xcc, 0x8a, 0x21, 0x83, 0xdc, 0x9c, 0x08, 0xd8,
+  0xad, 0x72, 0x23, 0xb9, 0x0b, 0x33, 0x81, 0x29, 0x47, 0x33, 0x90, 0xba,
+  0x8c, 0x41, 0x35, 0x80, 0xcc, 0x28, 0xa0, 0xef, 0x19, 0x33, 0xc0, 0x9c,
+  0x08, 0x80, 0xaa, 0x10, 0x23, 0x02, 0xba, 0xab, 0x39, 0x57, 0x23, 0x98,
+  0x19, 0x34, 0xc8, 0x0b, 0x54, 0x02, 0xb9, 0x8a, 0x88, 0x88, 0x88, 0x98,
+  0x98, 0xba, 0xdc, 0xab, 0x28, 0x34, 0xa0, 0xac, 0x18, 0x03, 0x09, 0x51,
+  0x24, 0x01, 0x88, 0x09, 0x21, 0x24, 0x23, 0x53, 0x12, 0x81, 0x99, 0x41,
+  0x57, 0x12, 0x00, 0x42, 0x94, 0xcd, 0x1a, 0x53, 0x91, 0xcb, 0x9a, 0xb9,
+  0xcd, 0x9b, 0x11, 0x81, 0xb9, 0xee, 0xac, 0x50, 0x24, 0xb8, 0x39, 0x35,
+  0xb0, 0x0c, 0x73, 0x33, 0x91, 0x99, 0x19, 0x00, 0x33, 0x12, 0xfc, 0x19,
+  0x92, 0xff, 0x0a, 0x32, 0xb1, 0xad, 0x09, 0x81, 0x9a, 0x10, 0x10, 0x81,
+  0x81, 0xaa, 0x0a, 0x77, 0x32, 0x98, 0x8b, 0x42, 0x03, 0x99, 0x40, 0x13,
+  0xba, 0x9a, 0xa9, 0x19, 0x43, 0xd8, 0xbe, 0x89, 0x10, 0x98, 0xaa, 0x10,
+  0x91, 0xdb, 0x09, 0x43, 0x12, 0x01, 0xa8, 0x19, 0x73, 0x23, 0x81, 0x10,
+  0x22, 0x00, 0x41, 0x46, 0x14, 0x90, 0x89, 0x20, 0x44, 0x33, 0xb1, 0xad,
+  0x10, 0xc9, 0xaf, 0x19, 0x24, 0xfb, 0xae, 0x09, 0x11, 0xa9, 0x89, 0xa0,
+  0xac, 0x41, 0x82, 0x1b, 0x77, 0x04, 0xaa, 0x29, 0x45, 0x02, 0x90, 0x08,
+  0x12, 0x88, 0x08, 0x12, 0xcc, 0x20, 0xf0, 0xdf, 0x18, 0x22, 0xc9, 0x8c,
+  0x08, 0x90, 0x09, 0x01, 0x89, 0x08, 0x13, 0x88, 0x1a, 0x67, 0x13, 0xa8,
+  0x8a, 0x44, 0x02, 0x08, 0x00, 0x98, 0x0a, 0x12, 0xd0, 0x9b, 0x11, 0xd8,
+  0xbd, 0x09, 0x11, 0x98, 0xca, 0x9a, 0x09, 0x11, 0x11, 0x90, 0x0a, 0x52,
+  0x12, 0x01, 0x53, 0x34, 0x21, 0x12, 0x23, 0x53, 0x35, 0x13, 0x01, 0x73,
+  0x14, 0xa8, 0x8a, 0x31, 0x25, 0xa0, 0xec, 0xcb, 0x99, 0x11, 0xd0, 0xce,
+  0x89, 0x01, 0xeb, 0x8a, 0x32, 0x90, 0xab, 0x00, 0x89, 0x75, 0x27, 0xa0,
+  0x99, 0x52, 0x33, 0x80, 0x88, 0x52, 0x81, 0xb9, 0x28, 0xa2, 0x8c, 0x02,
+  0xfc, 0xcf, 0x11, 0x02, 0xbc, 0x8a, 0x00, 0x98, 0x18, 0x90, 0x99, 0x48,
+  0x04, 0x88, 0x38, 0x47, 0x02, 0xa9, 0x29, 0x35, 0x02, 0x09, 0x80, 0xaa,
+  0x28, 0x14, 0xea, 0x9a, 0x01, 0xc9, 0xbb, 0x18, 0x01, 0xb9, 0xbc, 0x9a,
+  0x10, 0x43, 0x01, 0xba, 0x09, 0x45, 0x22, 0x10, 0x21, 0x11, 0x31, 0x53,
+  0x33, 0x23, 0x22, 0x33, 0x33, 0x75, 0x35, 0x02, 0xcb, 0x09, 0x54, 0x12,
+  0xa8, 0xcd, 0xab, 0x19, 0x22, 0xfb, 0xaf, 0x09, 0x91, 0xcc, 0x09, 0x23,
+  0xb8, 0x8c, 0x81, 0x19, 0x77, 0x13, 0xa9, 0x1a, 0x64, 0x12, 0x80, 0x19,
+  0x23, 0x80, 0xab, 0x31, 0xc8, 0x1a, 0x92, 0xff, 0x9f, 0x21, 0xa1, 0xbc,
+  0x88, 0x00, 0x89, 0x10, 0x98, 0x89, 0x41, 0x83, 0x09, 0x61, 0x45, 0x81,
+  0x9a, 0x48, 0x24, 0x80, 0x80, 0x90, 0x9a, 0x21, 0x93, 0xdc, 0x89, 0x81,
+  0xcb, 0x9c, 0x10, 0x81, 0xa9, 0xbb, 0x99, 0x31, 0x25, 0x82, 0xaa, 0x29,
+  0x35, 0x12, 0x21, 0x12, 0x90, 0x09, 0x62, 0x33, 0x12, 0xa0, 0x0a, 0x54,
+  0x32, 0x73, 0x34, 0x91, 0x9c, 0x38, 0x46, 0x02, 0xb8, 0xcc, 0xab, 0x30,
+  0x03, 0xfd, 0xad, 0x00, 0xa0, 0xad, 0x29, 0x13, 0xbb, 0x0b, 0x80, 0x69,
+  0x57, 0x03, 0xba, 0x28, 0x37, 0x12, 0x88, 0x28, 0x23, 0xa8, 0x8b, 0x33,
+  0xdb, 0x19, 0xe1, 0xff, 0x1a, 0x12, 0xc0, 0x9c, 0x08, 0x88, 0x88, 0x01,
+  0x99, 0x08, 0x42, 0x91, 0x08, 0x73, 0x25, 0x90, 0x9a, 0x42, 0x23, 0x80,
+  0x08, 0xa8, 0x9a, 0x33, 0xc1, 0xae, 0x18, 0xa0, 0xbd, 0x8a, 0x11, 0x80,
+  0xba, 0xab, 0x09, 0x52, 0x14, 0x81, 0x99, 0x30, 0x24, 0x21, 0x31, 0x12,
+  0xb8, 0xab, 0x41, 0x44, 0x02, 0xba, 0xab, 0x62, 0x33, 0x43, 0x55, 0x02,
+  0xa9, 0x29, 0x46, 0x24, 0x90, 0xcb, 0xac, 0x19, 0x33, 0xf8, 0xbf, 0x09,
+  0x81, 0xeb, 0x0a, 0x22, 0xa8, 0x8c, 0x00, 0x09, 0x66, 0x24, 0xb8, 0x0a,
+  0x54, 0x23, 0x80, 0x08, 0x33, 0x80, 0xbb, 0x41, 0xb0, 0x8c, 0x82, 0xff,
+  0x8f, 0x11, 0x91, 0xac, 0x09, 0x80, 0x89, 0x10, 0xa0, 0x09, 0x40, 0x02,
+  0x89, 0x51, 0x36, 0x82, 0xaa, 0x48, 0x24, 0x01, 0x08, 0x90, 0xaa, 0x30,
+  0x93, 0xcd, 0x1a, 0x00, 0xcc, 0x9b, 0x18, 0x82, 0xb8, 0xbb, 0x8b, 0x31,
+  0x26, 0x82, 0x99, 0x18, 0x33, 0x23, 0x33, 0x25, 0x91, 0xab, 0x29, 0x55,
+  0x22, 0x91, 0xba, 0x39, 0x46, 0x12, 0x42, 0x34, 0x90, 0xab, 0x61, 0x35,
+  0x03, 0xda, 0xbc, 0x9b, 0x30, 0x03, 0xff, 0xab, 0x18, 0xb0, 0xbd, 0x30,
+  0x03, 0xcb, 0x09, 0x91, 0x71, 0x47, 0x82, 0xaa, 0x38, 0x46, 0x01, 0x98,
+  0x20, 0x12, 0xa9, 0x0a, 0x03, 0xcb, 0x28, 0xf8, 0xff, 0x18, 0x11, 0xb9,
+  0x9c, 0x00, 0x88, 0x09, 0x82, 0xa9, 0x18, 0x33, 0x98, 0x19, 0x67, 0x13,
+  0xa8, 0x8a, 0x44, 0x12, 0x80, 0x00, 0x99, 0x09, 0x33, 0xc8, 0xac, 0x20,
+  0xb8, 0xbf, 0x09, 0x11, 0x98, 0xba, 0xab, 0x0a, 0x42, 0x22, 0xa8, 0x9b,
+  0x41, 0x32, 0x31, 0x44, 0x13, 0x98, 0x89, 0x53, 0x26, 0x13, 0x80, 0x99,
+  0x42, 0x44, 0x11, 0x32, 0x15, 0xb9, 0xab, 0x63, 0x43, 0x90, 0xcd, 0xbc,
+  0x8b, 0x31, 0xb2, 0xff, 0x9a, 0x11, 0xb9, 0x8c, 0x42, 0x81, 0x9b, 0x10,
+  0x80, 0x74, 0x27, 0x91, 0xaa, 0x41, 0x25, 0x81, 0x89, 0x21, 0x82, 0xba,
+  0x3a, 0x93, 0xad, 0x21, 0xfc, 0xcf, 0x20, 0x02, 0xda, 0x8a, 0x80, 0x98,
+  0x00, 0x81, 0x9a, 0x28, 0x14, 0x99, 0x19, 0x47, 0x13, 0xa8, 0x0a, 0x53,
+  0x22, 0x00, 0x01, 0xa8, 0x0a, 0x32, 0xc0, 0xac, 0x20, 0xa1, 0xce, 0xaa,
+  0x80, 0x01, 0x98, 0xbb, 0xaa, 0x88, 0x21, 0x12, 0x11, 0x30, 0x53, 0x01,
+  0x80, 0x72, 0x44, 0x02, 0x81, 0x00, 0x00, 0x30, 0x47, 0x22, 0x80, 0x98,
+  0x30, 0x24, 0x11, 0x32, 0x23, 0xd9, 0xcd, 0xcb, 0x09, 0x11, 0xc0, 0xef,
+  0xac, 0x19, 0x21, 0xc9, 0x9c, 0x10, 0xa1, 0xab, 0x63, 0x12, 0x51, 0x44,
+  0x90, 0x9b, 0x73, 0x26, 0x80, 0x98, 0x10, 0x12, 0x89, 0x89, 0x12, 0xda,
+  0x0a, 0xb0, 0xff, 0x0c, 0x21, 0xa0, 0xbc, 0x09, 0x90, 0x99, 0x28, 0x90,
+  0x88, 0x41, 0x03, 0xa9, 0x19, 0x67, 0x33, 0x90, 0x09, 0x31, 0x12, 0x18,
+  0x32, 0x81, 0x9a, 0x31, 0xf9, 0xae, 0x09, 0x11, 0xa8, 0xbb, 0x9c, 0x99,
+  0x98, 0x88, 0x00, 0x08, 0x11, 0x22, 0x98, 0x0a, 0x47, 0x24, 0x01, 0x00,
+  0x01, 0x11, 0x11, 0x21, 0x13, 0x21, 0x33, 0x15, 0x48, 0x65, 0x43, 0x01,
+  0x9a, 0x30, 0x44, 0x11, 0x08, 0xa8, 0xcb, 0xbd, 0xbd, 0xbd, 0xac, 0x18,
+  0xa2, 0xff, 0x9a, 0x18, 0x01, 0x99, 0x21, 0x12, 0x18, 0x55, 0x03, 0x88,
+  0x65, 0x34, 0x02, 0x98, 0x19, 0x43, 0x02, 0x88, 0x19, 0xb0, 0xbe, 0x98,
+  0xec, 0xcd, 0x19, 0x02, 0xd9, 0xab, 0x88, 0xa8, 0x99, 0x00, 0x80, 0x08,
+  0x35, 0x23, 0xa0, 0x09, 0x47, 0x24, 0x12, 0x08, 0x22, 0x03, 0x80, 0x10,
+  0x80, 0xaa, 0x30, 0x03, 0xef, 0xba, 0x89, 0x99, 0xa9, 0x9a, 0x8a, 0x89,
+  0x90, 0x98, 0x89, 0x08, 0x27, 0x33, 0x23, 0x21, 0x24, 0x12, 0x12, 0x11,
+  0x11, 0x20, 0x73, 0x77, 0x52, 0x1b, 0x20, 0x4a, 0x3a, 0xf1, 0x21, 0xc9,
+  0x12, 0x01, 0x2f, 0x99, 0x69, 0xf2, 0x92, 0x10, 0x1b, 0x28, 0x2e, 0x08,
+  0xb0, 0xa4, 0xb2, 0x18, 0x11, 0x3f, 0x19, 0x09, 0xc9, 0xa7, 0x82, 0x18,
+  0x89, 0x92, 0xa0, 0x86, 0x88, 0x88, 0xa8, 0x60, 0xd9, 0x92, 0x68, 0x98,
+  0x90, 0x90, 0x5b, 0x98, 0x18, 0x98, 0x97, 0x19, 0x0b, 0x69, 0x90, 0x89,
+  0x21, 0x28, 0x8b, 0x1b, 0x86, 0x5c, 0x09, 0x19, 0x39, 0xe1, 0x11, 0x90,
+  0xe0, 0x93, 0x5a, 0xc2, 0xa0, 0x31, 0x0b, 0x3b, 0xd2, 0x93, 0xb3, 0xc0,
+  0x59, 0x4e, 0x88, 0x09, 0x38, 0x99, 0x80, 0x1a, 0x41, 0xe9, 0x01, 0x09,
+  0x21, 0x19, 0x3f, 0xa0, 0xc4, 0x11, 0x1c, 0x30, 0x3a, 0x3f, 0x8a, 0x91,
+  0xb3, 0x39, 0x88, 0xf1, 0x40, 0x1b, 0x91, 0x1a, 0x00, 0x3b, 0x8b, 0x02,
+  0xf3, 0x21, 0x2f, 0xb2, 0xb1, 0x11, 0x6b, 0x09, 0x03, 0xca, 0xb5, 0x31,
+  0x6b, 0x0d, 0x08, 0x91, 0xb4, 0x11, 0x1c, 0x5a, 0x19, 0x1b, 0x49, 0xb9,
+  0x83, 0xa8, 0x09, 0xa5, 0x40, 0x3c, 0x0b, 0x29, 0xe3, 0x80, 0x6a, 0x09,
+  0x11, 0x2d, 0xc1, 0x81, 0x39, 0x59, 0x9b, 0xa3, 0x39, 0xd2, 0xc3, 0xa5,
+  0x39, 0x99, 0x03, 0x1e, 0x89, 0xb3, 0x04, 0x2c, 0x89, 0xa2, 0x3b, 0x19,
+  0xa3, 0x4f, 0xa9, 0x00, 0xa7, 0x09, 0x81, 0x28, 0x38, 0xac, 0x61, 0x1d,
+  0xb3, 0x29, 0xa3, 0x0b, 0xa5, 0x91, 0x21, 0x2e, 0x2a, 0xc0, 0xb4, 0x28,
+  0x9a, 0x12, 0xc0, 0x83, 0x2e, 0x08, 0x99, 0xb2, 0x58, 0x88, 0xc5, 0x30,
+  0x9c, 0x33, 0x3d, 0x1a, 0x95, 0x4c, 0x0b, 0xb1, 0x33, 0x3a, 0x1f, 0xb1,
+  0x28, 0xb2, 0x4a, 0x4f, 0x1b, 0x00, 0x99, 0xb3, 0x82, 0xb9, 0xa7, 0x91,
+  0x10, 0x89, 0x31, 0xf3, 0x3a, 0x3b, 0x13, 0x8c, 0x2a, 0x13, 0xcc, 0x17,
+  0x0b, 0xd2, 0x01, 0xd2, 0x01, 0x00, 0x9a, 0x22, 0x1f, 0xb8, 0xa4, 0xa4,
+  0x18, 0x88, 0xb4, 0x39, 0x3a, 0x99, 0x2d, 0x10, 0x82, 0x1a, 0x7d, 0x88,
+  0xa8, 0x49, 0xa3, 0xaa, 0x73, 0x1c, 0x90, 0xa2, 0x69, 0xc8, 0x93, 0x08,
+  0x3a, 0x89, 0xe3, 0x30, 0x5b, 0x8b, 0xa2, 0x91, 0x29, 0xe4, 0x10, 0x10,
+  0xf1, 0x01, 0x80, 0x89, 0xb4, 0x80, 0x40, 0xc8, 0x81, 0x81, 0x9a, 0x71,
+  0xb9, 0x31, 0x89, 0xe4, 0x81, 0x10, 0x6c, 0xc0, 0x02, 0x2a, 0xc8, 0x03,
+  0x2a, 0x88, 0xa0, 0x29, 0x21, 0x9e, 0x84, 0x08, 0x19, 0xf0, 0x12, 0x2d,
+  0xd1, 0x01, 0x5a, 0x89, 0x90, 0x10, 0xd2, 0xa1, 0x20, 0x5c, 0x08, 0x19,
+  0x4b, 0x88, 0xc2, 0x20, 0x4c, 0xc0, 0x21, 0x89, 0xa2, 0x5c, 0x3a, 0xa9,
+  0x11, 0x5d, 0xa8, 0x80, 0x10, 0xb1, 0xc0, 0xa5, 0x10, 0x1b, 0x11, 0xa0,
+  0x9a, 0x87, 0x09, 0x19, 0xaa, 0x07, 0x1a, 0x98, 0x28, 0x29, 0x2c, 0xac,
+  0x07, 0x2a, 0x89, 0x09, 0x95, 0x2b, 0xa1, 0x79, 0x8b, 0x97, 0x29, 0xb8,
+  0x96, 0x08, 0x3a, 0x89, 0x94, 0x08, 0x29, 0xe2, 0xa2, 0x29, 0x82, 0x2b,
+  0xf0, 0xb2, 0x96, 0x98, 0x00, 0x4b, 0x1a, 0x90, 0x89, 0x96, 0x4b, 0xb9,
+  0x20, 0x38, 0xf0, 0xa4, 0x00, 0xa1, 0x23, 0x1f, 0x81, 0x88, 0x3a, 0x4b,
+  0x4b, 0xc8, 0x93, 0x18, 0xc0, 0x18, 0x8a, 0x14, 0xf3, 0x00, 0x29, 0x49,
+  0x98, 0x90, 0x00, 0xb7, 0xa2, 0x3c, 0x00, 0x7a, 0x89, 0xc1, 0xa3, 0x92,
+  0x18, 0x1c, 0x20, 0xe0, 0xa2, 0x39, 0x89, 0x3b, 0x98, 0x97, 0x2d, 0x91,
+  0x6a, 0xa0, 0xc1, 0x38, 0x09, 0x84, 0x1c, 0x18, 0x80, 0x40, 0x0d, 0x88,
+  0xa3, 0x02, 0xd2, 0x7b, 0x09, 0x81, 0x2a, 0xc8, 0x81, 0x61, 0x8c, 0x00,
+  0xd3, 0x2a, 0xd3, 0x01, 0x4b, 0xca, 0x17, 0x89, 0x89, 0x82, 0xb0, 0x41,
+  0x8a, 0x20, 0x80, 0x0a, 0x69, 0x1c, 0x28, 0xd1, 0x10, 0x1a, 0xc9, 0x04,
+  0x09, 0xa9, 0x97, 0x1a, 0x18, 0xb1, 0xb1, 0x33, 0xc9, 0x21, 0x0a, 0x4c,
+  0x00, 0xf0, 0x51, 0xb0, 0x59, 0x09, 0xb0, 0x28, 0x91, 0xc8, 0x50, 0x9b,
+  0x54, 0x9b, 0x93, 0x00, 0xdb, 0x15, 0x0b, 0x88, 0x42, 0x8e, 0x02, 0xc8,
+  0x01, 0x90, 0x21, 0xa0, 0xab, 0x70, 0xd1, 0x02, 0x2a, 0x09, 0x81, 0x15,
+  0x0f, 0xa1, 0x82, 0x49, 0xb8, 0xa1, 0x42, 0xab, 0x95, 0x19, 0x19, 0xd2,
+  0x10, 0x1e, 0x82, 0x09, 0x81, 0x9a, 0x85, 0x2b, 0x9a, 0x17, 0xa9, 0x10,
+  0xd4, 0x38, 0x88, 0x9a, 0x23, 0xa8, 0x8e, 0xa7, 0x18, 0x10, 0x9a, 0xc2,
+  0x32, 0xab, 0x82, 0xc2, 0x6d, 0xa0, 0x00, 0x18, 0xb0, 0x13, 0x4a, 0x0f,
+  0x02, 0x29, 0x00, 0x2c, 0xd9, 0x84, 0x08, 0x88, 0xc3, 0x22, 0x0a, 0xaa,
+  0x20, 0x95, 0x0d, 0x91, 0x01, 0x3d, 0xc1, 0x88, 0x49, 0x29, 0x1a, 0xf4,
+  0x18, 0x82, 0x09, 0x89, 0x21, 0x99, 0x33, 0xae, 0x4a, 0x12, 0x4b, 0xa9,
+  0x38, 0x1c, 0x28, 0xd0, 0x07, 0x0e, 0x81, 0x01, 0x88, 0x11, 0x0c, 0x18,
+  0x86, 0x0b, 0x98, 0xb8, 0x06, 0x18, 0x0c, 0xe3, 0x02, 0x3b, 0xc9, 0x08,
+  0xb2, 0x92, 0xbf, 0x15, 0x80, 0x30, 0x98, 0x84, 0x2a, 0xf3, 0x20, 0x98,
+  0x70, 0xb9, 0x82, 0x20, 0x0f, 0x93, 0x10, 0x99, 0xa0, 0x28, 0xb8, 0x4b,
+  0xe2, 0x00, 0x02, 0x1b, 0xf2, 0x00, 0x82, 0x08, 0xa9, 0x61, 0x8a, 0x91,
+  0xc2, 0x4a, 0x08, 0x92, 0x80, 0xb1, 0x80, 0x97, 0xbb, 0x07, 0x1b, 0x18,
+  0xa3, 0x1b, 0x85, 0x8a, 0x30, 0x8f, 0x82, 0x02, 0x1a, 0xc3, 0x80, 0x1d,
+  0x02, 0x9c, 0x78, 0x2c, 0xd4, 0x00, 0x29, 0xa0, 0x18, 0x09, 0x20, 0x80,
+  0x0c, 0xb2, 0x92, 0x33, 0x8d, 0x9c, 0x52, 0x94, 0x0a, 0xa0, 0x43, 0xb0,
+  0x8c, 0x10, 0x23, 0x1f, 0x95, 0x0b, 0x5b, 0x90, 0x08, 0x80, 0x0a, 0x82,
+  0xb9, 0x7a, 0x28, 0xab, 0xa7, 0x91, 0x11, 0xac, 0x62, 0x89, 0x99, 0x20,
+  0xf3, 0x00, 0x00, 0xa0, 0x6b, 0x20, 0xa9, 0xa1, 0x81, 0x8a, 0x97, 0x81,
+  0x19, 0x90, 0x2a, 0xa7, 0x88, 0x08, 0xc5, 0x40, 0x9a, 0xb2, 0xd2, 0x03,
+  0x7c, 0x0b, 0xb2, 0x84, 0x19, 0xb8, 0x20, 0x49, 0x1c, 0xa0, 0x84, 0x3b,
+  0x39, 0x92, 0x8d, 0x08, 0xe2, 0x42, 0x89, 0x8c, 0x01, 0x29, 0x08, 0xcb,
+  0x24, 0x88, 0x68, 0xb9, 0x88, 0x48, 0x91, 0x99, 0x61, 0x0e, 0x08, 0x08,
+  0x08, 0x08, 0x88, 0x00, 0x08, 0x88, 0x80, 0x00, 0x88, 0x00, 0x88, 0x00,
+  0x08, 0x08, 0x08, 0x08, 0x88, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x70, 0x77, 0xb4, 0xd8, 0xfb, 0x7f, 0x04, 0xbc, 0x13, 0xb1, 0x18,
+  0x00, 0x0a, 0x10, 0x98, 0x80, 0x12, 0xb8, 0xb1, 0x91, 0x31, 0x1b, 0x1d,
+  0x18, 0xd9, 0xb3, 0xa3, 0xba, 0x74, 0xff, 0x44, 0xe0, 0x29, 0x13, 0xeb,
+  0x59, 0x80, 0x08, 0x81, 0xaa, 0x13, 0x91, 0x2c, 0x19, 0x9f, 0x11, 0x82,
+  0x08, 0x92, 0x28, 0x8e, 0x92, 0x82, 0x3a, 0xb9, 0x51, 0x02, 0xbe, 0x95,
+  0x91, 0xa9, 0x25, 0x3d, 0x8b, 0x03, 0xc1, 0x19, 0x04, 0x8c, 0x08, 0x30,
+  0x3e, 0x2a, 0x89, 0x08, 0xa7, 0xa1, 0x7a, 0x2a, 0x1a, 0x90, 0xa0, 0xc2,
+  0x4c, 0x02, 0x1a, 0x19, 0x0a, 0x22, 0x2f, 0x99, 0xb4, 0x01, 0x3c, 0x98,
+  0x92, 0x82, 0x2d, 0x38, 0x9b, 0x88, 0x87, 0x1a, 0x28, 0xea, 0xa7, 0x28,
+  0x2a, 0x09, 0x80, 0xf1, 0x04, 0x2c, 0x3a, 0xf1, 0xa4, 0x38, 0x1c, 0x08,
+  0xb1, 0x21, 0x4b, 0xaa, 0xb5, 0x82, 0x2a, 0xb1, 0x49, 0xb0, 0x62, 0x1f,
+  0x91, 0x09, 0xa4, 0x88, 0x11, 0x1b, 0x28, 0x1b, 0x2c, 0xb7, 0x28, 0x19,
+  0xb8, 0x11, 0xa1, 0xc3, 0xb3, 0x7b, 0x98, 0x20, 0x4d, 0xf1, 0xa3, 0x48,
+  0x0b, 0xa0, 0xb7, 0x01, 0x3a, 0x2b, 0x2a, 0xc0, 0x94, 0x10, 0x99, 0x30,
+  0x1b, 0x01, 0x2d, 0x6e, 0x0a, 0xa0, 0x94, 0x18, 0x1c, 0xa4, 0x19, 0x08,
+  0x00, 0x3d, 0xf0, 0x84, 0x2b, 0x81, 0x89, 0x58, 0x1b, 0xb0, 0xa6, 0x49,
+  0x1b, 0xc2, 0xa3, 0x7c, 0x1a, 0x88, 0x91, 0x18, 0x08, 0xb8, 0x96, 0x08,
+  0x28, 0x8a, 0x81, 0x98, 0x13, 0x0b, 0xf1, 0xc7, 0x02, 0x3c, 0xc0, 0x83,
+  0x6b, 0x2b, 0xa8, 0xb4, 0x12, 0x1d, 0xc3, 0x00, 0x18, 0x90, 0x19, 0x29,
+  0x08, 0xe0, 0x32, 0x0c, 0xa0, 0x04, 0x3c, 0x0b, 0xb3, 0xa4, 0x19, 0x81,
+  0xf1, 0x22, 0x0c, 0x2a, 0xa5, 0x3c, 0x82, 0x1f, 0x93, 0x9a, 0x84, 0x0a,
+  0x91, 0x00, 0x20, 0xbb, 0x07, 0x8b, 0x02, 0x39, 0x3d, 0xcb, 0x87, 0xa8,
+  0x03, 0x8a, 0x82, 0x2a, 0x90, 0xc1, 0x69, 0x08, 0x39, 0xbb, 0x33, 0x0d,
+  0xc2, 0x70, 0xac, 0x97, 0x00, 0x3b, 0x98, 0xb2, 0x12, 0x1d, 0x81, 0x49,
+  0x1b, 0x88, 0xd4, 0xa3, 0x3a, 0x88, 0xd5, 0x20, 0x09, 0x2a, 0xc4, 0x08,
+  0x20, 0x1c, 0xa2, 0xa0, 0x11, 0xf3, 0x11, 0x3c, 0xaa, 0x04, 0x1a, 0xa0,
+  0x83, 0x2c, 0xd2, 0x22, 0x8c, 0xa2, 0x11, 0x1a, 0x5d, 0x89, 0x11, 0x1d,
+  0x18, 0xf3, 0x91, 0x03, 0xca, 0x96, 0x08, 0x90, 0x10, 0x29, 0xb9, 0x71,
+  0xab, 0x13, 0x09, 0x08, 0xb0, 0x96, 0x0a, 0x91, 0x80, 0x13, 0x9f, 0x84,
+  0x1c, 0x03, 0x8a, 0x01, 0xe8, 0x31, 0xb9, 0x04, 0xb0, 0x7c, 0xa0, 0x28,
+  0x88, 0x10, 0x0b, 0xc2, 0x38, 0xc8, 0x87, 0x1a, 0x89, 0x48, 0xf1, 0x30,
+  0x8a, 0xa0, 0x84, 0xa0, 0x4a, 0x18, 0x99, 0xa3, 0x6c, 0x80, 0x8b, 0x04,
+  0xb8, 0x21, 0xb9, 0x85, 0x88, 0x5e, 0xa9, 0xa3, 0x32, 0x1f, 0x0a, 0xa3,
+  0x00, 0x4a, 0x90, 0xa8, 0x12, 0x38, 0xfb, 0x97, 0x08, 0x19, 0x88, 0x81,
+  0xb1, 0x52, 0x9c, 0x18, 0x08, 0xa3, 0xa9, 0x11, 0xa0, 0x59, 0x88, 0xd2,
+  0x6a, 0x90, 0x39, 0xa8, 0x04, 0x8c, 0x18, 0xb3, 0x0a, 0x87, 0x3b, 0x8b,
+  0x84, 0x1c, 0x30, 0xa4, 0x1f, 0x91, 0x08, 0x80, 0xa1, 0x91, 0x00, 0x80,
+  0x80, 0x88, 0x88, 0x08, 0x00, 0x22, 0x43, 0x32, 0x91, 0xdd, 0xac, 0x99,
+  0x99, 0x8a, 0x31, 0x02, 0xdc, 0xaa, 0xcc, 0x1a, 0x77, 0x23, 0x12, 0x21,
+  0x13, 0xfa, 0xbc, 0x8a, 0x08, 0x00, 0x08, 0xaa, 0x98, 0xca, 0xce, 0x20,
+  0x47, 0x33, 0x34, 0x02, 0xb9, 0x9b, 0xa9, 0xcf, 0x8c, 0x31, 0x92, 0xcc,
+  0x9a, 0x98, 0xca, 0x09, 0x43, 0x25, 0x43, 0x12, 0x98, 0x99, 0x98, 0x98,
+  0x8a, 0x08, 0x12, 0xa0, 0xdf, 0xac, 0x08, 0x11, 0x10, 0x52, 0x35, 0x01,
+  0x88, 0x98, 0x99, 0x9a, 0x18, 0x80, 0x09, 0x10, 0xd9, 0xcc, 0x9a, 0x10,
+  0x20, 0x32, 0x43, 0x22, 0x88, 0xaa, 0xac, 0x09, 0x21, 0x32, 0x22, 0x90,
+  0xdc, 0xad, 0x89, 0x52, 0x35, 0x24, 0x12, 0x00, 0xc9, 0xcf, 0xaa, 0x20,
+  0x02, 0x98, 0x88, 0xfb, 0xbe, 0x9a, 0x98, 0x40, 0x67, 0x33, 0x01, 0x08,
+  0x01, 0xda, 0xcc, 0x89, 0x20, 0x02, 0x98, 0xcd, 0xa9, 0x99, 0xca, 0x50,
+  0x55, 0x33, 0x24, 0x02, 0xc9, 0x9b, 0x90, 0xdc, 0x9c, 0x32, 0x03, 0xcd,
+  0x99, 0x88, 0xca, 0x89, 0x31, 0x44, 0x43, 0x23, 0x80, 0x99, 0x98, 0xba,
+  0xac, 0x09, 0x22, 0x22, 0xfa, 0xac, 0x08, 0x90, 0x9a, 0x61, 0x35, 0x12,
+  0x01, 0x01, 0xa9, 0xbb, 0xba, 0xba, 0x8a, 0x53, 0x02, 0x9a, 0x0a, 0x98,
+  0xba, 0x0a, 0x53, 0x34, 0x32, 0x81, 0xa8, 0x9a, 0x88, 0x90, 0x18, 0xa8,
+  0xbb, 0xbc, 0x9c, 0x68, 0x47, 0x34, 0x23, 0xa8, 0xcd, 0x89, 0x11, 0xa8,
+  0x68, 0x37, 0xa1, 0xbf, 0xcb, 0xcb, 0xaa, 0x30, 0x25, 0x52, 0x55, 0x12,
+  0xa8, 0x9a, 0x01, 0xa9, 0x9d, 0x38, 0x33, 0xa1, 0xde, 0xad, 0x9a, 0x08,
+  0x09, 0x55, 0x44, 0x23, 0x22, 0x90, 0xbd, 0x0a, 0xa8, 0xdd, 0x1a, 0x24,
+  0xa1, 0xac, 0x89, 0xa8, 0xad, 0x89, 0x33, 0x44, 0x34, 0x13, 0x00, 0x08,
+  0xb9, 0xdc, 0xaa, 0x08, 0x11, 0x01, 0xa9, 0x19, 0x12, 0xfb, 0x9b, 0x52,
+  0x33, 0x12, 0x43, 0x13, 0xa8, 0xba, 0xbd, 0xad, 0x0a, 0x00, 0x80, 0x21,
+  0x43, 0x01, 0xa9, 0x89, 0x89, 0x98, 0x88, 0x22, 0x24, 0x01, 0x10, 0x9a,
+  0x99, 0xa9, 0x89, 0x53, 0x36, 0x14, 0x91, 0xba, 0xbc, 0xda, 0xcc, 0x39,
+  0x77, 0x23, 0x00, 0x88, 0xa0, 0xdf, 0xac, 0xaa, 0x99, 0x31, 0x36, 0x13,
+  0x41, 0x44, 0x91, 0xcc, 0x18, 0x22, 0x00, 0x0a, 0x23, 0x92, 0xef, 0xcc,
+  0x9b, 0x09, 0x11, 0x41, 0x46, 0x33, 0x32, 0x01, 0xca, 0xae, 0x00, 0xa9,
+  0xae, 0x30, 0x24, 0xc9, 0x9b, 0x00, 0xd9, 0xab, 0x08, 0x33, 0x54, 0x43,
+  0x02, 0x01, 0x01, 0xba, 0xbe, 0xaa, 0x88, 0x00, 0x80, 0x19, 0x63, 0x02,
+  0xbb, 0x1a, 0x33, 0x92, 0x30, 0x37, 0x22, 0x80, 0xa0, 0xdc, 0xbb, 0x99,
+  0xaa, 0x8a, 0x42, 0x34, 0x22, 0x01, 0x01, 0x90, 0xcb, 0xac, 0x89, 0x00,
+  0x00, 0x11, 0x12, 0x23, 0x34, 0x24, 0x32, 0x00, 0x90, 0xef, 0xdc, 0x9a,
+  0x09, 0x22, 0x44, 0x63, 0x43, 0x13, 0xc9, 0xbc, 0xba, 0xcd, 0xab, 0x18,
+  0x10, 0x63, 0x34, 0xa0, 0x8a, 0x73, 0x81, 0xbb, 0x71, 0x35, 0x01, 0x98,
+  0x98, 0xbb, 0xdf, 0xdb, 0x8a, 0x10, 0x22, 0x42, 0x35, 0x15, 0x11, 0x81,
+  0xca, 0x9d, 0x00, 0xb8, 0xad, 0x41, 0x23, 0xca, 0x8b, 0x00, 0xea, 0xab,
+  0x08, 0x12, 0x63, 0x24, 0x12, 0x22, 0x12, 0xb9, 0xbe, 0xbb, 0x9a, 0xa9,
+  0x99, 0x28, 0x37, 0x03, 0x88, 0x21, 0x13, 0xb9, 0x8a, 0x22, 0x02, 0x20,
+  0x02, 0xeb, 0xaa, 0xc9, 0xcd, 0x9b, 0x10, 0x22, 0x21, 0x44, 0x33, 0x11,
+  0xa8, 0xbb, 0xcb, 0xbc, 0xab, 0x08, 0x31, 0x54, 0x33, 0x33, 0x12, 0x81,
+  0xdb, 0xcd, 0xaa, 0xab, 0xab, 0x30, 0x47, 0x34, 0x12, 0x22, 0x23, 0xe8,
+  0xbe, 0xaa, 0x98, 0xbb, 0x19, 0x13, 0x10, 0x62, 0x93, 0xdf, 0x29, 0x35,
+  0x82, 0x39, 0x67, 0x12, 0x98, 0xa9, 0xba, 0xcd, 0xdb, 0xab, 0x08, 0x34,
+  0x32, 0x44, 0x25, 0x12, 0x01, 0xa9, 0xce, 0x09, 0x80, 0xda, 0x2a, 0x53,
+  0x91, 0x9c, 0x08, 0xa0, 0xbd, 0x99, 0x10, 0x31, 0x45, 0x23, 0x22, 0x33,
+  0x91, 0xeb, 0xbb, 0xac, 0x99, 0x9a, 0x8a, 0x52, 0x24, 0x81, 0x18, 0x32,
+  0x92, 0xab, 0x28, 0x22, 0x00, 0x22, 0xa0, 0xae, 0xaa, 0xdc, 0xbc, 0x09,
+  0x11, 0x21, 0x53, 0x33, 0x33, 0x81, 0xa9, 0xbc, 0xcb, 0xcb, 0xaa, 0x08,
+  0x11, 0x43, 0x34, 0x34, 0x23, 0x23, 0x80, 0xea, 0xcc, 0xac, 0xbb, 0xbb,
+  0x09, 0x54, 0x45, 0x33, 0x22, 0x32, 0x82, 0xfb, 0xaf, 0x9a, 0x98, 0xaa,
+  0x18, 0x22, 0x21, 0x54, 0x91, 0xbc, 0x50, 0x26, 0x98, 0x48, 0x36, 0x03,
+  0xb9, 0xba, 0xdb, 0xdc, 0xcb, 0x9b, 0x28, 0x25, 0x32, 0x45, 0x23, 0x02,
+  0x01, 0xea, 0xac, 0x19, 0x90, 0xbd, 0x49, 0x34, 0xb8, 0xab, 0x10, 0xd8,
+  0xbc, 0x89, 0x10, 0x51, 0x34, 0x32, 0x31, 0x14, 0x80, 0xcc, 0xba, 0x9b,
+  0x9a, 0xaa, 0x0a, 0x54, 0x23, 0x98, 0x10, 0x24, 0xa0, 0x9a, 0x42, 0x12,
+  0x11, 0x12, 0xc9, 0xab, 0xcb, 0xdd, 0xab, 0x08, 0x11, 0x21, 0x34, 0x34,
+  0x23, 0x01, 0xa9, 0xba, 0xbc, 0xbd, 0xaa, 0x89, 0x18, 0x21, 0x53, 0x43,
+  0x23, 0x33, 0x22, 0x00, 0xb8, 0xde, 0xbc, 0xac, 0xaa, 0x9b, 0x18, 0x55,
+  0x44, 0x33, 0x22, 0x22, 0x81, 0xfc, 0xbc, 0xaa, 0xb9, 0xba, 0x10, 0x33,
+  0x63, 0x44, 0x81, 0xbb, 0x71, 0x13, 0xb9, 0x50, 0x36, 0x82, 0xa9, 0xba,
+  0xdb, 0xbd, 0xbd, 0x9b, 0x30, 0x25, 0x33, 0x36, 0x34, 0x10, 0x80, 0xda,
+  0xad, 0x08, 0x90, 0xbd, 0x40, 0x24, 0xb8, 0x8b, 0x00, 0xe8, 0xbb, 0x89,
+  0x10, 0x52, 0x34, 0x23, 0x22, 0x14, 0x90, 0xcc, 0xab, 0xaa, 0x99, 0xaa,
+  0x19, 0x54, 0x13, 0x99, 0x28, 0x23, 0xa9, 0x09, 0x44, 0x22, 0x32, 0x13,
+  0xca, 0xac, 0xdb, 0xcc, 0xab, 0x88, 0x01, 0x22, 0x44, 0x43, 0x22, 0x01,
+  0x90, 0xa9, 0xcb, 0xcb, 0xab, 0xab, 0x99, 0x20, 0x32, 0x35, 0x45, 0x33,
+  0x32, 0x22, 0x81, 0xca, 0xdc, 0xdb, 0xcb, 0xba, 0x99, 0x09, 0x41, 0x46,
+  0x43, 0x33, 0x13, 0x02, 0xa0, 0xee, 0xcb, 0x9a, 0xb9, 0x99, 0x20, 0x33,
+  0x63, 0x34, 0x81, 0xaa, 0x62, 0x03, 0xba, 0x78, 0x35, 0x81, 0xab, 0xaa,
+  0xdb, 0xcd, 0xcb, 0x8a, 0x31, 0x25, 0x42, 0x34, 0x24, 0x10, 0x90, 0xdc,
+  0xab, 0x00, 0xb8, 0xae, 0x52, 0x23, 0xba, 0x8b, 0x01, 0xfb, 0xab, 0x09,
+  0x01, 0x53, 0x43, 0x22, 0x31, 0x23, 0xb8, 0xbe, 0xba, 0xa9, 0x99, 0xba,
+  0x18, 0x36, 0x83, 0xa9, 0x30, 0x23, 0xba, 0x39, 0x37, 0x23, 0x32, 0x02,
+  0xc9, 0xcb, 0xeb, 0xbc, 0xab, 0x88, 0x10, 0x31, 0x54, 0x33, 0x32, 0x11,
+  0x00, 0x99, 0xcb, 0xcc, 0xab, 0xab, 0xaa, 0x89, 0x20, 0x34, 0x45, 0x33,
+  0x24, 0x22, 0x11, 0x98, 0xbb, 0xbe, 0xcc, 0xcb, 0xaa, 0x9a, 0x80, 0x32,
+  0x47, 0x53, 0x33, 0x13, 0x11, 0x88, 0xfb, 0xcd, 0xaa, 0xa9, 0xa9, 0x19,
+  0x33, 0x34, 0x35, 0x14, 0xb8, 0x28, 0x35, 0xc8, 0x8a, 0x46, 0x13, 0xb9,
+  0xaa, 0xbb, 0xce, 0xcc, 0xab, 0x28, 0x44, 0x32, 0x34, 0x26, 0x11, 0x80,
+  0xb9, 0xbf, 0x09, 0x80, 0xdb, 0x29, 0x35, 0x92, 0xac, 0x00, 0xa0, 0xbe,
+  0x8a, 0x18, 0x20, 0x35, 0x33, 0x22, 0x34, 0x81, 0xda, 0xab, 0xab, 0x9a,
+  0xaa, 0x9a, 0x71, 0x23, 0xa8, 0x0b, 0x42, 0x90, 0x89, 0x53, 0x33, 0x43,
+  0x22, 0xa1, 0xbb, 0xdb, 0xcd, 0xbc, 0x99, 0x08, 0x18, 0x32, 0x44, 0x33,
+  0x23, 0x12, 0x00, 0xa0, 0xca, 0xcc, 0xbb, 0xcb, 0xab, 0x9a, 0x09, 0x42,
+  0x54, 0x33, 0x44, 0x32, 0x12, 0x80, 0xaa, 0xcc, 0xbc, 0xbc, 0xcb, 0xaa,
+  0x89, 0x18, 0x43, 0x54, 0x34, 0x44, 0x22, 0x11, 0x08, 0xb9, 0xde, 0xbc,
+  0xaa, 0xaa, 0x99, 0x30, 0x34, 0x44, 0x44, 0x01, 0x99, 0x20, 0x04, 0xca,
+  0x1b, 0x45, 0x83, 0xb9, 0xab, 0xba, 0xbf, 0xcd, 0x9b, 0x30, 0x35, 0x32,
+  0x44, 0x25, 0x10, 0x80, 0xda, 0xbc, 0x1a, 0x80, 0xcc, 0x38, 0x36, 0xa1,
+  0x9b, 0x18, 0xc0, 0xbd, 0x8a, 0x18, 0x20, 0x35, 0x23, 0x23, 0x34, 0x91,
+  0xda, 0xba, 0xaa, 0x98, 0xa9, 0x9b, 0x72, 0x12, 0xb9, 0x9a, 0x32, 0xa0,
+  0x0a, 0x55, 0x24, 0x23, 0x23, 0x80, 0xaa, 0xdb, 0xdc, 0xcb, 0x99, 0x88,
+  0x09, 0x20, 0x43, 0x33, 0x43, 0x22, 0x22, 0x11, 0x90, 0xb9, 0xbd, 0xbd,
+  0xbc, 0xac, 0xaa, 0x8a, 0x11, 0x43, 0x35, 0x25, 0x23, 0x23, 0x11, 0x90,
+  0xca, 0xdb, 0xbc, 0xcb, 0xaa, 0x9a, 0x89, 0x10, 0x53, 0x53, 0x43, 0x43,
+  0x34, 0x32, 0x01, 0xa8, 0xba, 0xdf, 0xcc, 0xba, 0x99, 0x99, 0x18, 0x44,
+  0x33, 0x35, 0x24, 0x90, 0x89, 0x12, 0xd8, 0xad, 0x30, 0x24, 0xa8, 0xaa,
+  0x99, 0xdb, 0xcd, 0xbc, 0x19, 0x63, 0x22, 0x43, 0x44, 0x12, 0x00, 0xa9,
+  0xce, 0x8c, 0x00, 0xa8, 0x8c, 0x53, 0x14, 0xa9, 0x89, 0x81, 0xea, 0xab,
+  0x89, 0x00, 0x32, 0x26, 0x12, 0x32, 0x13, 0xa0, 0xcc, 0x9a, 0x99, 0x88,
+  0xa9, 0x19, 0x64, 0xa0, 0xbb, 0x19, 0x91, 0xba, 0x40, 0x36, 0x43, 0x43,
+  0x12, 0x80, 0x88, 0xca, 0xcd, 0xab, 0x9a, 0x99, 0x8a, 0x10, 0x33, 0x34,
+  0x43, 0x42, 0x33, 0x32, 0x12, 0x80, 0xa9, 0xcc, 0xcd, 0xcb, 0xba, 0xba,
+  0x99, 0x08, 0x41, 0x34, 0x35, 0x34, 0x43, 0x22, 0x12, 0x98, 0xba, 0xcd,
+  0xbc, 0xbc, 0xbb, 0xaa, 0x8a, 0x10, 0x33, 0x46, 0x34, 0x43, 0x32, 0x43,
+  0x23, 0x12, 0xb9, 0xdc, 0xcb, 0xcd, 0xbc, 0xbb, 0x89, 0x80, 0x31, 0x47,
+  0x33, 0x33, 0x25, 0x90, 0xab, 0x00, 0xd8, 0xbd, 0x19, 0x34, 0xa0, 0x9a,
+  0x89, 0xb8, 0xbe, 0xbe, 0x09, 0x73, 0x23, 0x42, 0x53, 0x02, 0x80, 0xb8,
+  0xde, 0x9b, 0x18, 0x98, 0x8d, 0x63, 0x23, 0xa9, 0x89, 0x01, 0xfa, 0xab,
+  0x89, 0x08, 0x30, 0x34, 0x22, 0x42, 0x23, 0x90, 0xcb, 0x9a, 0x89, 0x80,
+  0xa9, 0x1a, 0x36, 0xa2, 0xbf, 0x8a, 0x80, 0xba, 0x1a, 0x45, 0x33, 0x44,
+  0x22, 0x01, 0x81, 0xb0, 0xdc, 0xab, 0xaa, 0xba, 0xba, 0x89, 0x00, 0x22,
+  0x33, 0x54, 0x34, 0x34, 0x33, 0x22, 0x12, 0x90, 0xdb, 0xcc, 0xcb, 0xbb,
+  0xcb, 0xaa, 0x89, 0x10, 0x31, 0x44, 0x44, 0x33, 0x33, 0x23, 0x22, 0x01,
+  0xa9, 0xcd, 0xcc, 0xbb, 0xad, 0xbb, 0xab, 0x88, 0x21, 0x63, 0x43, 0x44,
+  0x33, 0x32, 0x21, 0x12, 0x01, 0xa8, 0xed, 0xcb, 0xbb, 0xdc, 0xbc, 0x9b,
+  0x00, 0x10, 0x62, 0x44, 0x33, 0x43, 0x22, 0xa8, 0xac, 0x88, 0xfa, 0xac,
+  0x28, 0x13, 0xa0, 0x89, 0x00, 0xb0, 0xcd, 0xcc, 0x10, 0x45, 0x13, 0x43,
+  0x43, 0x02, 0x98, 0xdb, 0xce, 0x8b, 0x01, 0xb8, 0x2b, 0x47, 0x03, 0xa9,
+  0x08, 0x81, 0xcd, 0xaa, 0x89, 0x88, 0x42, 0x22, 0x22, 0x53, 0x12, 0xa8,
+  0xab, 0x99, 0x00, 0x80, 0xaa, 0x50, 0x25, 0xc9, 0xae, 0x88, 0xa8, 0xaa,
+  0x28, 0x44, 0x33, 0x44, 0x22, 0x10, 0x00, 0xa8, 0xbd, 0xab, 0xba, 0xbb,
+  0xac, 0x99, 0x88, 0x00, 0x11, 0x53, 0x35, 0x34, 0x33, 0x34, 0x22, 0x01,
+  0xa8, 0xeb, 0xcb, 0xcb, 0xbb, 0xac, 0x9a, 0x89, 0x18, 0x41, 0x53, 0x43,
+  0x43, 0x43, 0x32, 0x12, 0x01, 0x99, 0xcb, 0xcd, 0xbc, 0xcb, 0xbb, 0xbb,
+  0x99, 0x18, 0x53, 0x35, 0x44, 0x32, 0x24, 0x22, 0x01, 0x80, 0x90, 0xa9,
+  0xdd, 0xcc, 0xba, 0xca, 0xbd, 0x9c, 0x18, 0x11, 0x42, 0x36, 0x34, 0x23,
+  0x33, 0xa8, 0xae, 0x89, 0xca, 0xae, 0x09, 0x23, 0x91, 0x89, 0x10, 0x81,
+  0xbc, 0xbf, 0x18, 0x64, 0x13, 0x32, 0x44, 0x02, 0x98, 0xda, 0xdd, 0x9a,
+  0x00, 0xa0, 0x8b, 0x47, 0x13, 0x99, 0x09, 0x81, 0xfb, 0xaa, 0x89, 0x88,
+  0x31, 0x32, 0x22, 0x53, 0x13, 0x90, 0x9c, 0x99, 0x10, 0x00, 0xa9, 0x40,
+  0x26, 0xc8, 0xad, 0x89, 0x99, 0xac, 0x18, 0x33, 0x34, 0x35, 0x23, 0x12,
+  0x11, 0x98, 0xbd, 0xbb, 0xab, 0xbc, 0xab, 0xaa, 0x99, 0x88, 0x08, 0x31,
+  0x46, 0x44, 0x33, 0x43, 0x32, 0x22, 0x80, 0xaa, 0xbd, 0xbd, 0xcb, 0xbb,
+  0xac, 0x99, 0x89, 0x10, 0x42, 0x34, 0x34, 0x25, 0x32, 0x22, 0x13, 0x01,
+  0xa8, 0xcb, 0xcd, 0xbc, 0xcb, 0xcb, 0xaa, 0x9a, 0x18, 0x32, 0x36, 0x44,
+  0x33, 0x43, 0x22, 0x02, 0x00, 0x99, 0xa9, 0xdb, 0xcd, 0xbc, 0xbb, 0xcc,
+  0xbd, 0x8a, 0x11, 0x22, 0x45, 0x45, 0x32, 0x22, 0x03, 0xc9, 0xac, 0x99,
+  0xeb, 0xac, 0x28, 0x22, 0x80, 0x09, 0x21, 0x91, 0xeb, 0xad, 0x38, 0x46,
+  0x22, 0x32, 0x34, 0x82, 0xa8, 0xfc, 0xcc, 0x8a, 0x10, 0xa9, 0x2b, 0x57,
+  0x12, 0xa9, 0x18, 0x80, 0xcc, 0xaa, 0x89, 0x09, 0x31, 0x23, 0x22, 0x54,
+  0x12, 0xa8, 0xaa, 0x88, 0x20, 0x01, 0x99, 0x61, 0x24, 0xd8, 0xad, 0x89,
+  0xa9, 0xbb, 0x19, 0x43, 0x53, 0x43, 0x23, 0x12, 0x21, 0x90, 0xdb, 0x9b,
+  0xaa, 0xbc, 0xab, 0xaa, 0xa9, 0xa9, 0x99, 0x10, 0x44, 0x44, 0x53, 0x33,
+  0x24, 0x13, 0x02, 0x81, 0xb9, 0xcc, 0xdb, 0xbb, 0xbc, 0xba, 0xab, 0x99,
+  0x10, 0x32, 0x45, 0x44, 0x33, 0x25, 0x23, 0x22, 0x12, 0x80, 0xcb, 0xcc,
+  0xdb, 0xbb, 0xbc, 0xac, 0xaa, 0x89, 0x18, 0x41, 0x44, 0x34, 0x34, 0x24,
+  0x23, 0x12, 0x01, 0xaa, 0xcb, 0xcb, 0xdb, 0xbc, 0xad, 0xaa, 0xca, 0xbc,
+  0x8a, 0x42, 0x43, 0x44, 0x44, 0x33, 0x23, 0x12, 0xe9, 0xbc, 0x99, 0xca,
+  0xae, 0x18, 0x32, 0x81, 0x08, 0x31, 0x82, 0xc9, 0xbe, 0x28, 0x55, 0x13,
+  0x31, 0x44, 0x81, 0xa8, 0xeb, 0xcd, 0x9b, 0x11, 0xa8, 0x1b, 0x57, 0x13,
+  0x99, 0x08, 0x81, 0xeb, 0xab, 0x89, 0x89, 0x21, 0x23, 0x12, 0x53, 0x23,
+  0x98, 0xbb, 0x89, 0x31, 0x23, 0x90, 0x71, 0x35, 0xb8, 0xbe, 0x9a, 0xa9,
+  0xcc, 0x09, 0x21, 0x32, 0x44, 0x23, 0x12, 0x32, 0x81, 0xba, 0xab, 0xa9,
+  0xeb, 0xba, 0xab, 0xbb, 0xbc, 0xcb, 0x99, 0x10, 0x42, 0x44, 0x53, 0x42,
+  0x22, 0x22, 0x11, 0x10, 0x99, 0xba, 0xcc, 0xdb, 0xcb, 0xca, 0xaa, 0xaa,
+  0x99, 0x08, 0x32, 0x45, 0x53, 0x33, 0x33, 0x43, 0x22, 0x01, 0x90, 0xba,
+  0xcc, 0xcc, 0xcb, 0xab, 0xba, 0xcb, 0x9a, 0x08, 0x21, 0x52, 0x44, 0x34,
+  0x34, 0x43, 0x12, 0x12, 0x10, 0xa9, 0xbc, 0xbc, 0xcb, 0xcb, 0xbd, 0xbc,
+  0xbb, 0xba, 0xad, 0x19, 0x46, 0x24, 0x53, 0x43, 0x12, 0x11, 0x90, 0xdc,
+  0xac, 0x98, 0xb9, 0xbc, 0x30, 0x25, 0x91, 0x89, 0x10, 0x81, 0xc9, 0xbb,
+  0x71, 0x37, 0x23, 0x21, 0x33, 0xa1, 0xcc, 0xcc, 0xcd, 0xab, 0x11, 0x90,
+  0x8a, 0x57, 0x23, 0xa0, 0x08, 0x11, 0xda, 0xcb, 0x9a, 0x99, 0x09, 0x21,
+  0x21, 0x52, 0x34, 0x02, 0x88, 0x88, 0x08, 0x00, 0xc9, 0x8b, 0x53, 0x13,
+  0xdb, 0x9a, 0x00, 0xcc, 0xac, 0x89, 0x08, 0x21, 0x44, 0x33, 0x43, 0x34,
+  0x11, 0x88, 0x99, 0xba, 0xcc, 0xac, 0xab, 0xaa, 0x99, 0x8a, 0x09, 0x21,
+  0x32, 0x34, 0x35, 0x44, 0x33, 0x33, 0x33, 0x22, 0x11, 0xa8, 0xec, 0xcb,
+  0xbb, 0xbd, 0xcb, 0xaa, 0xaa, 0x8a, 0x09, 0x32, 0x54, 0x34, 0x34, 0x34,
+  0x34, 0x23, 0x12, 0x01, 0xb9, 0xdb, 0xcc, 0xdb, 0xbb, 0xbb, 0xbb, 0xbb,
+  0x8a, 0x21, 0x53, 0x53, 0x34, 0x34, 0x34, 0x24, 0x23, 0x23, 0x23, 0x81,
+  0xca, 0xdc, 0xeb, 0xcb, 0xbc, 0xbb, 0x9a, 0x89, 0x80, 0x52, 0x46, 0x32,
+  0x21, 0x32, 0x13, 0x80, 0x18, 0xc9, 0xad, 0x48, 0x03, 0xfc, 0x8b, 0x10,
+  0xe9, 0xcc, 0x8a, 0x08, 0x01, 0x31, 0x54, 0x45, 0x33, 0x12, 0x01, 0x80,
+  0xda, 0xad, 0xbc, 0xbd, 0x9a, 0x21, 0x80, 0x19, 0x57, 0x33, 0x90, 0x18,
+  0x11, 0xd8, 0xcb, 0xab, 0xba, 0x9b, 0x08, 0x00, 0x51, 0x35, 0x24, 0x22,
+  0x11, 0x11, 0x00, 0xb9, 0xcd, 0x9b, 0x88, 0xba, 0xac, 0x08, 0x02, 0x80,
+  0x10, 0x33, 0x22, 0x44, 0x33, 0x11, 0x52, 0x43, 0x01, 0x88, 0x99, 0xa9,
+  0xcc, 0xcc, 0xbb, 0xbb, 0xbb, 0xbb, 0x0a, 0x28, 0x52, 0x53, 0x34, 0x53,
+  0x32, 0x33, 0x23, 0x13, 0x02, 0x90, 0xeb, 0xcb, 0xbc, 0xdb, 0xbb, 0xcb,
+  0xaa, 0x9a, 0x09, 0x10, 0x43, 0x54, 0x33, 0x25, 0x23, 0x33, 0x23, 0x12,
+  0x80, 0xaa, 0xdc, 0xcb, 0xbc, 0xac, 0xbb, 0xcb, 0xaa, 0x8a, 0x08, 0x21,
+  0x53, 0x44, 0x53, 0x33, 0x43, 0x33, 0x22, 0x23, 0x01, 0xa9, 0xcc, 0xcb,
+  0xcc, 0xbc, 0xbc, 0xbb, 0xcb, 0xba, 0xbc, 0x8a, 0x33, 0x34, 0x53, 0x47,
+  0x24, 0x33, 0x34, 0x13, 0x81, 0x08, 0xe9, 0xdd, 0xac, 0xaa, 0xba, 0xad,
+  0x8a, 0x21, 0x34, 0x44, 0x43, 0x53, 0x23, 0x13, 0x88, 0x99, 0xdb, 0xcc,
+  0xbb, 0xbc, 0xac, 0x19, 0x12, 0x81, 0x70, 0x44, 0x12, 0x00, 0x10, 0x01,
+  0xc9, 0xbc, 0xbb, 0xbc, 0xbb, 0x99, 0x89, 0x20, 0x55, 0x43, 0x23, 0x33,
+  0x33, 0x33, 0x82, 0xda, 0xac, 0xba, 0xeb, 0xcb, 0x9a, 0x89, 0x89, 0x00,
+  0x32, 0x43, 0x34, 0x34, 0x32, 0x22, 0x12, 0x01, 0x99, 0xbc, 0xcb, 0xbc,
+  0xcb, 0xbb, 0xba, 0x9b, 0x9a, 0x09, 0x10, 0x33, 0x36, 0x34, 0x44, 0x33,
+  0x33, 0x24, 0x23, 0x21, 0x80, 0xa8, 0xcc, 0xbc, 0xcc, 0xcb, 0xbb, 0xcb,
+  0xaa, 0x9a, 0x09, 0x20, 0x42, 0x44, 0x34, 0x34, 0x22, 0x17, 0x0c, 0xaa,
+  0x29, 0xb1, 0xcd, 0x42, 0x48, 0x00, 0x85, 0x8c, 0x98, 0xd9, 0x5a, 0x11,
+  0x01, 0x00, 0xb1, 0x9c, 0xb1, 0x0b, 0x17, 0x01, 0x09, 0x0a, 0x98, 0x33,
+  0xfa, 0x2a, 0x08, 0x72, 0x0a, 0xb0, 0x21, 0x2a, 0xd3, 0xab, 0x59, 0x3f,
+  0x22, 0xd0, 0x2a, 0xa8, 0x40, 0x88, 0x18, 0x91, 0x98, 0x1b, 0x84, 0x0c,
+  0xc9, 0x27, 0x98, 0x11, 0xdd, 0x21, 0x01, 0x0a, 0x28, 0x91, 0x0e, 0x3a,
+  0x03, 0xb5, 0xca, 0x01, 0x92, 0x08, 0xb2, 0x89, 0xa7, 0x22, 0x79, 0x2c,
+  0xd8, 0x0a, 0x06, 0x09, 0xa0, 0x28, 0xb2, 0x18, 0x89, 0x3a, 0x1a, 0x05,
+  0xc1, 0x23, 0x8e, 0xa8, 0x2a, 0x05, 0xc1, 0x80, 0x05, 0x1a, 0xae, 0x01,
+  0x22, 0x81, 0xa1, 0x69, 0xc8, 0x91, 0x0c, 0x98, 0x41, 0x95, 0x98, 0xf2,
+  0x30, 0x29, 0x1a, 0xb9, 0x40, 0x88, 0x90, 0xc1, 0x3d, 0x19, 0x86, 0x18,
+  0x90, 0x0e, 0x10, 0x19, 0x09, 0x20, 0x4c, 0x92, 0xd9, 0xa3, 0xb0, 0x78,
+  0x99, 0x83, 0x81, 0x8c, 0x92, 0x82, 0x79, 0x2b, 0x98, 0x4c, 0x90, 0x31,
+  0xb9, 0xae, 0x83, 0x3b, 0x07, 0x90, 0x81, 0x1d, 0x82, 0xb8, 0x2a, 0xa4,
+  0x12, 0x99, 0xb9, 0xd4, 0x19, 0x96, 0x91, 0x52, 0xd8, 0x19, 0x02, 0x9b,
+  0x08, 0x4a, 0x02, 0xba, 0x72, 0xc8, 0x88, 0x83, 0x91, 0x51, 0x1d, 0x88,
+  0xb0, 0x82, 0x48, 0x20, 0x8e, 0x8b, 0xc2, 0x17, 0x88, 0xb8, 0x15, 0x09,
+  0xa9, 0x1d, 0x98, 0x23, 0x81, 0xa6, 0xa2, 0x1c, 0x39, 0xa9, 0x08, 0x98,
+  0x6f, 0x93, 0x09, 0xa9, 0x20, 0x98, 0x0d, 0x32, 0x12, 0x9d, 0xa8, 0x10,
+  0x17, 0x8a, 0xbb, 0x41, 0x03, 0x2b, 0x2f, 0xe3, 0x00, 0x91, 0x09, 0x91,
+  0x6a, 0x81, 0xa1, 0xe8, 0x11, 0xb9, 0x86, 0x91, 0x88, 0x00, 0x20, 0xb8,
+  0xca, 0x23, 0xf2, 0x24, 0xac, 0x10, 0x50, 0x1a, 0xab, 0x83, 0xe3, 0x2a,
+  0x82, 0x01, 0x4b, 0xc2, 0x02, 0x8b, 0x8b, 0x3c, 0x79, 0x83, 0x8d, 0xa1,
+  0x21, 0x90, 0xa2, 0x49, 0xa0, 0x2c, 0x84, 0xf9, 0x2c, 0x82, 0x71, 0xb8,
+  0x10, 0x98, 0x18, 0x93, 0xac, 0x0c, 0x17, 0x8a, 0x88, 0x59, 0x11, 0x8a,
+  0xb1, 0x40, 0xbc, 0x02, 0x4b, 0x3a, 0x39, 0xc1, 0x90, 0xa3, 0x2d, 0x95,
+  0x90, 0x60, 0xb8, 0x0b, 0x82, 0x0a, 0x94, 0x3d, 0x00, 0xa5, 0x0d, 0x83,
+  0x10, 0x58, 0xba, 0x99, 0x03, 0x3d, 0x4b, 0xd9, 0x33, 0x90, 0x9f, 0x34,
+  0x0c, 0x91, 0x18, 0x90, 0xc1, 0x4b, 0x08, 0xa8, 0x27, 0xb9, 0x39, 0x88,
+  0x29, 0xf8, 0x28, 0x93, 0x01, 0xa1, 0x08, 0x8b, 0xa0, 0x6c, 0x99, 0x2e,
+  0x52, 0x89, 0xc2, 0x1a, 0x83, 0x0a, 0x4a, 0x3c, 0x91, 0xc0, 0xa4, 0x93,
+  0x8b, 0xa9, 0x33, 0x6d, 0x90, 0x10, 0x18, 0xc8, 0x91, 0x94, 0xbc, 0x97,
+  0xa1, 0x68, 0x99, 0x10, 0x19, 0x8a, 0x22, 0xad, 0x43, 0xa2, 0xd8, 0x31,
+  0x9c, 0x0a, 0x70, 0xb0, 0xb3, 0x00, 0x11, 0xd0, 0x19, 0x02, 0x59, 0x2a,
+  0x0a, 0xe0, 0x04, 0x8c, 0x80, 0x48, 0x90, 0xb9, 0x07, 0x89, 0x10, 0x4b,
+  0xa0, 0x81, 0xc1, 0x12, 0xcd, 0x41, 0x89, 0xa0, 0x41, 0x98, 0x12, 0xd2,
+  0x29, 0xa0, 0x3d, 0x50, 0xad, 0x93, 0x10, 0x0b, 0xa4, 0x41, 0xc1, 0x09,
+  0x00, 0x7a, 0xa9, 0x58, 0x0b, 0x01, 0xa0, 0x99, 0x62, 0xc8, 0x18, 0x81,
+  0x2a, 0x96, 0x28, 0xaa, 0xd2, 0x2a, 0x32, 0x8e, 0x18, 0x28, 0x88, 0xa7,
+  0x80, 0x40, 0xc8, 0x00, 0xbc, 0x20, 0x34, 0x8a, 0x31, 0xad, 0x30, 0xf0,
+  0x00, 0x02, 0x39, 0x99, 0x19, 0xd8, 0x92, 0x4d, 0x90, 0x49, 0xa1, 0x49,
+  0xd3, 0xa0, 0x12, 0xcb, 0x92, 0x32, 0x2f, 0x09, 0xa1, 0x05, 0x2c, 0xb1,
+  0x80, 0x29, 0xf9, 0x04, 0xa9, 0x61, 0x99, 0x00, 0xa8, 0x11, 0x08, 0xc0,
+  0x21, 0xd5, 0x28, 0xa1, 0x2a, 0x8a, 0x13, 0x1f, 0x08, 0x92, 0x92, 0x91,
+  0xac, 0x37, 0x0c, 0x09, 0x8a, 0x4a, 0x03, 0xf8, 0x22, 0xaa, 0x13, 0x4b,
+  0x0c, 0x00, 0xb0, 0xa8, 0x25, 0x98, 0x05, 0x9c, 0x10, 0x8a, 0x89, 0x97,
+  0x01, 0x30, 0xcc, 0x02, 0x19, 0x2a, 0xa4, 0xb3, 0xd1, 0x8c, 0x20, 0x30,
+  0xb2, 0x54, 0xb8, 0x3b, 0xb0, 0x1e, 0xeb, 0x25, 0x81, 0x80, 0x8d, 0x10,
+  0xb9, 0x22, 0xb5, 0x83, 0xa8, 0x81, 0x9d, 0x22, 0x08, 0x29, 0x73, 0x9d,
+  0x08, 0x9a, 0x35, 0xb9, 0x21, 0xb9, 0x33, 0x02, 0x8f, 0x48, 0xab, 0xc1,
+  0x78, 0x89, 0xb2, 0x49, 0x93, 0xa2, 0xb9, 0xc9, 0x86, 0x20, 0x18, 0xd9,
+  0x91, 0x4a, 0x80, 0x5b, 0x9b, 0x84, 0x58, 0x80, 0x0a, 0xc9, 0x87, 0x09,
+  0x0c, 0x01, 0xb0, 0x24, 0x91, 0xe0, 0x89, 0x32, 0x95, 0x8c, 0xa2, 0x81,
+  0xc0, 0x11, 0x90, 0x19, 0x61, 0x99, 0x90, 0x39, 0x88, 0xc1, 0x31, 0xb5,
+  0x8f, 0x30, 0x8c, 0x85, 0x28, 0x99, 0x39, 0xb8, 0xa0, 0x7b, 0xc4, 0x00,
+  0x80, 0xa2, 0x99, 0x38, 0xa3, 0x2f, 0x85, 0x0c, 0x88, 0x83, 0x19, 0x08,
+  0x19, 0x99, 0xe3, 0x14, 0x8f, 0x91, 0x39, 0xa6, 0x81, 0x09, 0x08, 0x3a,
+  0x90, 0x1c, 0x09, 0x98, 0x87, 0x10, 0xb9, 0x91, 0x93, 0x94, 0x0f, 0x04,
+  0xc0, 0x91, 0x08, 0x39, 0x09, 0x92, 0xe8, 0x85, 0x4b, 0xaa, 0x97, 0x49,
+  0xb0, 0x49, 0xc9, 0x20, 0x11, 0xaa, 0x12, 0x1a, 0x1a, 0x00, 0xca, 0x65,
+  0x8a, 0xa0, 0xa9, 0x14, 0xb3, 0x9d, 0x05, 0x18, 0x8a, 0x11, 0x39, 0xeb,
+  0x12, 0xe1, 0x91, 0xc2, 0x12, 0x29, 0xaa, 0x17, 0x8c, 0x01, 0x80, 0x99,
+  0x87, 0xaa, 0x92, 0x28, 0x40, 0x1a, 0x98, 0x3a, 0x5d, 0xb8, 0x91, 0x09,
+  0x07, 0x19, 0x9a, 0x30, 0x1f, 0x91, 0x80, 0x11, 0xa8, 0x20, 0x28, 0xbf,
+  0x16, 0x1c, 0x80, 0x80, 0x88, 0x91, 0x18, 0x38, 0xcb, 0x78, 0xb8, 0x02,
+  0x24, 0xcc, 0x10, 0x82, 0xd0, 0x38, 0x1a, 0x18, 0xd9, 0xa4, 0x21, 0xb3,
+  0x28, 0xcd, 0x43, 0xb1, 0xb9, 0x81, 0x5d, 0x18, 0xc1, 0x28, 0xa1, 0x01,
+  0x02, 0xe9, 0x30, 0xba, 0x94, 0x2f, 0x02, 0xb0, 0x81, 0x1d, 0x11, 0x12,
+  0xe9, 0x11, 0x8a, 0x10, 0xa0, 0x1e, 0xa7, 0x28, 0x19, 0x9a, 0x05, 0xf0,
+  0x10, 0x91, 0x90, 0x91, 0x48, 0x3b, 0xb9, 0x23, 0xac, 0x90, 0x26, 0x1b,
+  0x1b, 0x91, 0xa0, 0x33, 0xfb, 0x81, 0x51, 0x2a, 0x3b, 0xa0, 0xae, 0xd2,
+  0x52, 0x81, 0x1d, 0x81, 0xc1, 0x5a, 0x90, 0x81, 0x2a, 0x0b, 0x83, 0x2d,
+  0xc4, 0x29, 0x80, 0x11, 0x91, 0xc2, 0x1a, 0x0a, 0x0d, 0x42, 0xd9, 0x58,
+  0x21, 0xd8, 0xa8, 0x04, 0x3d, 0xa0, 0x80, 0x10, 0x29, 0xa4, 0xab, 0xb3,
+  0x84, 0x2b, 0x3b, 0x72, 0x1b, 0xd1, 0xb5, 0x29, 0x29, 0x2b, 0x92, 0xfa,
+  0x62, 0x89, 0x8a, 0x22, 0x98, 0x09, 0x89, 0x50, 0xab, 0x78, 0x88, 0x83,
+  0xa9, 0xdb, 0x72, 0x98, 0x29, 0xb0, 0x82, 0x20, 0xf3, 0x10, 0xa0, 0x5d,
+  0xb1, 0xa8, 0x12, 0x00, 0x94, 0xcb, 0x03, 0x82, 0x0f, 0x38, 0xc3, 0x21,
+  0x9c, 0x08, 0x23, 0x1f, 0xa0, 0x00, 0x20, 0x2b, 0x0b, 0x22, 0x02, 0x1f,
+  0x0b, 0x84, 0xd1, 0x19, 0xe3, 0x41, 0x3b, 0x8a, 0x99, 0x83, 0x7d, 0xa8,
+  0x93, 0x89, 0x10, 0x98, 0x84, 0x9b, 0xc1, 0x07, 0x98, 0x19, 0x58, 0x2c,
+  0x98, 0x10, 0xa2, 0xab, 0xa4, 0x20, 0x0a, 0x94, 0x2a, 0x7b, 0x10, 0xd8,
+  0x3a, 0xe1, 0x11, 0x01, 0x1b, 0xd0, 0x11, 0x5c, 0x88, 0x89, 0x94, 0x11,
+  0xd1, 0x4b, 0xaa, 0x95, 0x81, 0x18, 0x99, 0x01, 0x79, 0x08, 0x98, 0x8c,
+  0x21, 0x31, 0xad, 0xe0, 0x32, 0x19, 0x21, 0x0d, 0x89, 0x81, 0xe0, 0x83,
+  0x11, 0x1a, 0xe9, 0x03, 0x18, 0xab, 0x42, 0x19, 0x0d, 0x10, 0x97, 0x8a,
+  0x02, 0x1e, 0xd3, 0x80, 0x59, 0x90, 0x00, 0x98, 0x00, 0x3a, 0xb9, 0x44,
+  0x0d, 0xb1, 0x83, 0x09, 0x82, 0x4a, 0x0b, 0xf3, 0xb4, 0x09, 0x84, 0x19,
+  0x38, 0x3e, 0xa0, 0x1c, 0x90, 0x83, 0x83, 0xb8, 0x09, 0x4c, 0xb9, 0x14,
+  0xa0, 0x27, 0x8e, 0x81, 0x81, 0x1c, 0x30, 0xbb, 0x11, 0x42, 0xe9, 0x92,
+  0x93, 0x2c, 0x30, 0xa1, 0x1c, 0x9e, 0x05, 0x98, 0x18, 0x89, 0x28, 0x06,
+  0xaa, 0x20, 0x6c, 0x8a, 0x38, 0xbb, 0x95, 0xc2, 0x22, 0x3b, 0x1c, 0x39,
+  0xba, 0x06, 0x08, 0x89, 0x9c, 0x52, 0x88, 0xa8, 0x22, 0xd0, 0x11, 0xb9,
+  0xf1, 0x12, 0x70, 0xa9, 0x00, 0xb2, 0x88, 0x1f, 0x93, 0x23, 0xaa, 0x0c,
+  0x5a, 0x98, 0xa4, 0xb2, 0x21, 0x3b, 0xe1, 0x4a, 0x8a, 0xc2, 0x42, 0x00,
+  0xb9, 0xc8, 0x63, 0xa9, 0x80, 0x81, 0x00, 0x00
+};
+
+const BackgroundAudioPrompt __prompts_count_index[] = {
+    { 0, 8165 },
+    { 4084, 7192 },
+    { 7680, 7606 },
+    { 11484, 13212 },
+};
+
+const BackgroundAudioPromptSet prompts_count = {
+    22050,
+    true,
+    4,
+    __prompts_count_index,
+    __prompts_count_data
+};
+
+enum {
+    COUNT_ONE = 0, // "One"
+    COUNT_TWO = 1, // "Two"
+    COUNT_THREE = 2, // "Three"
+    COUNT_LIFTOFF = 3, // "Lift off!"
+};
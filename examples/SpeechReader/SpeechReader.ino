@@ -0,0 +1,72 @@
+// SpeechReader - Earle F. Philhower, III <earlephilhower@yahoo.com>
+// Released to the public domain 2025
+//
+// Reads a long passage aloud, much longer than the speaker's 1KB text buffer.
+// The ROM speaker reads it in place from flash with a single `speak`, and the
+// normal speaker has it streamed in by the app as buffer space frees up.
+// Hook up an earphone to pins 0, 1, and GND to hear the PWM output.
+
+#include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/voice/en.h>
+
+#ifdef ESP32
+#include <ESP32I2SAudio.h>
+ESP32I2SAudio audio(4, 5, 6); // BCLK, LRCLK, DOUT (,MCLK)
+#else
+#include <PWMAudio.h>
+PWMAudio audio(0);
+#endif
+
+// Set to 0 to stream the text through the normal speaker's RAM buffer instead
+#define USE_ROM 1
+
+#if USE_ROM
+ROMBackgroundAudioSpeech BMP(audio);
+#else
+BackgroundAudioSpeech BMP(audio);
+#endif
+
+const char story[] =
+  "Once upon a time, in a land far away, there lived a very small robot named Pico.  "
+  "Pico could not walk, and it could not fly, but it could talk, and it loved to tell stories.  "
+  "Every evening the children of the village gathered around the little robot, and every evening "
+  "Pico told them a new tale.  Some were about dragons, some were about pirates, and some were about "
+  "nothing at all, but the children listened to every word.\n\n"
+  "One day a traveler came to the village.  She had heard of the talking robot, and she wanted to "
+  "know how such a tiny thing could hold so many stories.  Pico thought for a moment, and then said: "
+  "I do not hold them all at once.  I read them one sentence at a time, and when a sentence is spoken, "
+  "I let it go, and make room for the next one.  That way, even a very small robot can tell a very long story.\n\n"
+  "The traveler laughed, sat down with the children, and listened until the stars came out.  "
+  "And when the last story was done, Pico said good night, and the village went to sleep.  The end.";
+
+#if !USE_ROM
+// Rest of the story still to be written into the speaker
+const char *next;
+size_t left = 0;
+#endif
+
+void setup() {
+  BMP.setVoice(voice_en);
+  BMP.begin();
+}
+
+void loop() {
+#if USE_ROM
+  if (BMP.done()) {
+    // Only the pointer is kept, the text is read straight from flash
+    BMP.speak(story);
+  }
+#else
+  if (!left && BMP.done()) {
+    next = story;
+    left = sizeof(story); // Including the NUL which ends the string
+  }
+  if (left) {
+    // Write as much as fits now, and more as spoken clauses free up space
+    size_t n = BMP.write(next, left);
+    next += n;
+    left -= n;
+  }
+#endif
+  delay(100);
+}
@@ -7,11 +7,15 @@
 // Useful to see how effective different -Ox optimizations are and different CPU archs.
 
 // Note that this is NOT how you use the library!  Only for low-level performance testing
+//
+// After the first report the whole playback path (decoders, speech, mixer) is run through StageBench.h
+// and the results dumped as JSON, which tests/host/benchcheck.py can compare against a saved baseline.
+// Build the library with -DBACKGROUNDAUDIO_PROFILE to have each case broken down by decoder stage.
 
 #include <BackgroundAudio.h>
-#include "aac.h"
-#include "aache.h"
-#include "mp3.h"
+#include <libespeak-ng/voice/en.h>
+#define STAGEBENCH_VOICE voice_en
+#include "StageBench.h"
 
 HAACDecoder _hAACDecoder;
 int16_t _outSample[2048][2];
@@ -123,10 +127,21 @@ void report(const char *name, int frames, uint64_t cyclesttl, int samplesperfram
   Serial.printf("%s decode cycles: %llu, frames %d, cycles/sample %0.2f, MHZ %0.0f\r\n", name, cyclesttl, frames, cyclesPerSample, mhzUsed);
 }
 
+void emitSerial(const char *s) {
+  Serial.print(s);
+}
+
+bool stagesReported = false;
+
 void loop() {
   report("HE-AAC", aacheframes, cyclesAACHE, 2048);
   report("AAC", aacframes, cyclesAAC, 1024);
   report("MP3", mp3frames, cyclesMP3, 1152);
   Serial.println("-------------------------------------\r\n");
+  if (!stagesReported) {
+    stageBench(emitSerial);
+    Serial.println("-------------------------------------\r\n");
+    stagesReported = true;
+  }
   delay(1000);
 }
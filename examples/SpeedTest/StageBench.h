@@ -0,0 +1,267 @@
+// StageBench - Earle F. Philhower, III <earlephilhower@yahoo.com>
+// Released to the public domain 2025
+//
+// Runs the full BackgroundAudio playback path (ROM players, speech, and the mixer) as fast as possible
+// into a dummy output and reports what each output block cost as JSON.  When the whole library is
+// built with -DBACKGROUNDAUDIO_PROFILE the cost is also broken down by decoder stage (see
+// BackgroundAudioProfile.h).
+//
+// Shared by SpeedTest.ino on the device and tests/host/stagebench.cpp on a PC, whose output can be
+// checked against a saved baseline by tests/host/benchcheck.py.
+//
+// Define STAGEBENCH_VOICE to a voice (i.e. voice_en) before including this to benchmark speech.
+
+#pragma once
+#include <BackgroundAudio.h>
+#include <BackgroundAudioProfile.h>
+#ifdef STAGEBENCH_VOICE
+#include <BackgroundAudioSpeech.h>
+#endif
+#include <__example_beepwav.h>
+#include "aac.h"
+#include "aache.h"
+#include "mp3.h"
+
+// Accepts one block of samples each time it's pumped, as a DMA callback would, and throws them away
+class StageBenchOutput : public AudioOutputBase {
+public:
+    bool setBuffers(size_t buffers, size_t bufferWords, int32_t silenceSample = 0) override {
+        (void) buffers;
+        (void) silenceSample;
+        _blockBytes = bufferWords * 4;
+        return true;
+    }
+    bool setBitsPerSample(int bps) override {
+        return bps == 16;
+    }
+    bool setFrequency(int freq) override {
+        (void) freq;
+        return true;
+    }
+    bool setStereo(bool stereo = true) override {
+        return stereo;
+    }
+    bool begin() override {
+        return true;
+    }
+    bool end() override {
+        return true;
+    }
+    bool getUnderflow() override {
+        return false;
+    }
+    void onTransmit(void (*cb)(void *), void *cbData) override {
+        _cb = cb;
+        _cbData = cbData;
+    }
+    size_t write(const uint8_t *buffer, size_t size) override {
+        (void) buffer;
+        size = std::min(size, _avail);
+        _avail -= size;
+        samples += size / 4;
+        return size;
+    }
+    int availableForWrite() override {
+        return _avail;
+    }
+
+    // Let the source generate one block and return how long it took
+    uint32_t pump() {
+        _avail = _blockBytes;
+        uint32_t start = ba_profile_now();
+        _cb(_cbData);
+        return (ba_profile_now() - start) & BA_PROFILE_MASK;
+    }
+
+    uint32_t samples = 0;
+
+private:
+    size_t _blockBytes = 0;
+    size_t _avail = 0;
+    void (*_cb)(void *) = nullptr;
+    void *_cbData = nullptr;
+};
+
+typedef struct {
+    uint32_t samples;
+    uint32_t blocks;
+    uint32_t maxBlock;      // Most expensive single output block
+    uint64_t cycles;
+#ifdef BACKGROUNDAUDIO_PROFILE
+    ba_profile_stat_t stage[BA_PROFILE_STAGES];
+#endif
+} StageBenchResult;
+
+// Pump a started source until it reports done, timing every block
+template<class Source>
+static void stageBenchRun(Source &src, StageBenchOutput &out, StageBenchResult *r) {
+    memset(r, 0, sizeof(*r));
+    ba_profile_reset();
+    out.samples = 0;
+    while (!src.done() && (r->blocks < 100000)) {
+        uint32_t c = out.pump();
+        r->cycles += c;
+        r->maxBlock = std::max(r->maxBlock, c);
+        r->blocks++;
+    }
+    r->samples = out.samples;
+#ifdef BACKGROUNDAUDIO_PROFILE
+    memcpy(r->stage, ba_profile_stat, sizeof(r->stage));
+#endif
+}
+
+template<class Player>
+static void stageBenchROM(const uint8_t *data, size_t len, StageBenchResult *r) {
+    StageBenchOutput out;
+    Player p(out);
+    p.write(data, len);
+    p.begin();
+    stageBenchRun(p, out, r);
+    p.end();
+}
+
+// The normal (RAM buffered) MP3 player, with the data written in by the app between blocks
+class StageBenchStream {
+public:
+    // Top up the player as a sketch's loop() would, then see if it's all been played
+    bool done() {
+        size_t n = std::min(_left, (size_t)_p.availableForWrite());
+        n = _p.write(mp3 + sizeof(mp3) - _left, n);
+        _left -= n;
+        return !_left && _p.done();
+    }
+    static void run(StageBenchResult *r) {
+        StageBenchOutput out;
+        StageBenchStream s;
+        s._p.setDevice(&out);
+        s._p.begin();
+        stageBenchRun(s, out, r);
+        s._p.end();
+    }
+private:
+    BackgroundAudioMP3 _p;
+    size_t _left = sizeof(mp3);
+};
+
+#ifdef STAGEBENCH_VOICE
+static const char stageBenchText[] = "It was a dark and stormy night; the rain fell in torrents, except at occasional intervals, "
+                                     "when it was checked by a violent gust of wind which swept up the streets.  Is it 3:45 PM "
+                                     "already?  The 27 lamps rattled along the housetops, and fiercely agitated the scanty flame.";
+
+static void stageBenchSpeech(StageBenchResult *r) {
+    StageBenchOutput out;
+    ROMBackgroundAudioSpeech p(out);
+    p.setVoice(STAGEBENCH_VOICE);
+    p.begin();
+    p.speak(stageBenchText);
+    stageBenchRun(p, out, r);
+    p.end();
+}
+#endif
+
+// Two legs, AAC and MP3, both at 44.1KHz so the mixer's summing and limiting aren't hidden behind resampling
+class StageBenchMix {
+public:
+    bool done() {
+        return _aac.done() && _mp3.done();
+    }
+    static void run(StageBenchResult *r) {
+        StageBenchOutput out;
+        BackgroundAudioMixer<256> mixer(out, 44100);
+        StageBenchMix m;
+        m._aac.setDevice(mixer.add());
+        m._mp3.setDevice(mixer.add());
+        m._aac.write(aac, sizeof(aac));
+        m._mp3.write(mp3, sizeof(mp3));
+        mixer.begin();
+        m._aac.begin();
+        m._mp3.begin();
+        m._mp3.setGain(0.5);
+        stageBenchRun(m, out, r);
+        m._aac.end();
+        m._mp3.end();
+    }
+private:
+    ROMBackgroundAudioAAC _aac;
+    ROMBackgroundAudioMP3 _mp3;
+};
+
+// Keep the fastest of several runs to filter out interrupts and, on a PC, the rest of the system
+template<class F>
+static void stageBenchBest(F f, int repeats, StageBenchResult *best) {
+    StageBenchResult r;
+    for (int i = 0; i < repeats; i++) {
+        f(&r);
+        if (!i || (r.cycles < best->cycles)) {
+            *best = r;
+        }
+    }
+}
+
+static void stageBenchEmit(void (*emit)(const char *), const char *name, const StageBenchResult *r, bool last) {
+    char buff[160];
+    double samples = r->samples ? r->samples : 1;
+    snprintf(buff, sizeof(buff), "    \"%s\": {\"samples\": %lu, \"blocks\": %lu, \"cycles\": %llu, \"max_block\": %lu, "
+             "\"cycles_per_sample\": %.2f", name, (unsigned long)r->samples, (unsigned long)r->blocks,
+             (unsigned long long)r->cycles, (unsigned long)r->maxBlock, r->cycles / samples);
+    emit(buff);
+#ifdef BACKGROUNDAUDIO_PROFILE
+    emit(", \"stages\": {");
+    bool first = true;
+    for (int i = 0; i < BA_PROFILE_STAGES; i++) {
+        if (!r->stage[i].calls) {
+            continue;
+        }
+        snprintf(buff, sizeof(buff), "%s\n      \"%s\": {\"calls\": %lu, \"cycles\": %llu, \"max\": %lu, \"cycles_per_sample\": %.2f}",
+                 first ? "" : ",", ba_profile_name[i], (unsigned long)r->stage[i].calls,
+                 (unsigned long long)r->stage[i].cycles, (unsigned long)r->stage[i].max, r->stage[i].cycles / samples);
+        emit(buff);
+        first = false;
+    }
+    emit("}");
+#endif
+    emit(last ? "}\n" : "},\n");
+}
+
+/**
+    @brief Run every benchmark case and write the results as a JSON object
+
+    @param [in] emit Called with each successive piece of the JSON text
+    @param [in] repeats Number of times to run each case, keeping the fastest
+*/
+static void stageBench(void (*emit)(const char *), int repeats = 1) {
+    StageBenchResult r = {};
+    char buff[96];
+#ifdef BACKGROUNDAUDIO_PROFILE
+    const char *profile = "true";
+#else
+    const char *profile = "false";
+#endif
+    snprintf(buff, sizeof(buff), "{\n  \"clock\": \"%s\",\n  \"profile\": %s,\n  \"cases\": {\n", ba_profile_clock, profile);
+    emit(buff);
+    stageBenchBest([](StageBenchResult * x) {
+        stageBenchROM<ROMBackgroundAudioAAC>(aache, sizeof(aache), x);
+    }, repeats, &r);
+    stageBenchEmit(emit, "he-aac", &r, false);
+    stageBenchBest([](StageBenchResult * x) {
+        stageBenchROM<ROMBackgroundAudioAAC>(aac, sizeof(aac), x);
+    }, repeats, &r);
+    stageBenchEmit(emit, "aac", &r, false);
+    stageBenchBest([](StageBenchResult * x) {
+        stageBenchROM<ROMBackgroundAudioMP3>(mp3, sizeof(mp3), x);
+    }, repeats, &r);
+    stageBenchEmit(emit, "mp3", &r, false);
+    stageBenchBest(StageBenchStream::run, repeats, &r);
+    stageBenchEmit(emit, "mp3-stream", &r, false);
+    stageBenchBest([](StageBenchResult * x) {
+        stageBenchROM<ROMBackgroundAudioWAV>(beepwav, sizeof(beepwav), x);
+    }, repeats, &r);
+    stageBenchEmit(emit, "wav", &r, false);
+#ifdef STAGEBENCH_VOICE
+    stageBenchBest(stageBenchSpeech, repeats, &r);
+    stageBenchEmit(emit, "speech", &r, false);
+#endif
+    stageBenchBest(StageBenchMix::run, repeats, &r);
+    stageBenchEmit(emit, "mixer", &r, true);
+    emit("  }\n}\n");
+}
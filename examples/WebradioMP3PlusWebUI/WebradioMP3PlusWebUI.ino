@@ -37,6 +37,7 @@ I2S audio(OUTPUT, 0, 2);
 #define STREAMBUFF (32 * 1024)
 #else
 // Pico and PicoW work well with much smaller compressed/raw buffer...
+// (tests/host/schedsim can estimate the size needed for a given network's throughput and stalls)
 #define STREAMBUFF (16 * 1024)
 #endif
 
@@ -39,7 +39,7 @@ cp ../../lib/espeak-ng-arduino/src/ucd-tools/src/include/ucd/ucd.h ucd/.
 cp ../../lib/espeak-ng-arduino/COPYING* .
 
 # espeak-ng files
-for i in common.c common.h compiledict.h config.h dictionary.c dictionary.h \
+for i in common.c common.h compiledict.h config.h context.c context.h dictionary.c dictionary.h \
   encoding.c error.c error.h espeak_api.c espeak_command.h \
   event.h fifo.c fifo.h ieee80.c ieee80.h intonation.c intonation.h \
   klatt.h langopts.c langopts.h local_endian.h mbrola.h mnemonics.c \
@@ -55,10 +55,22 @@ done
 # Build header for each dictionary, align on 4 byte boundary
 mkdir -p dict
 for i in /tmp/espeak/share/espeak-ng-data/*_dict; do
+    d=$(basename $i _dict)
+    # Index so word lookups don't walk the whole hash chain in flash
+    ../../tools/dictindex/dictindex.py $i dict/$(basename $i)_index.h
     echo "#pragma once" > dict/$(basename $i).h
-    echo "const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {" >> dict/$(basename $i).h
-    xxd -i $i | grep -v "unsigned char" >> dict/$(basename $i).h
-    sed -i 's/unsigned int.* =/size_t __espeakng_dictlen =/' dict/$(basename $i).h
+    echo "#include <BackgroundAudioSpeech.h>" >> dict/$(basename $i).h
+    echo "#include <libespeak-ng/dict/$(basename $i)_index.h>" >> dict/$(basename $i).h
+    echo "const unsigned char __espeakng_dict_$d[] __attribute__((aligned((4)))) = {" >> dict/$(basename $i).h
+    xxd -i $i | grep -v "unsigned char" | grep -v "unsigned int" >> dict/$(basename $i).h
+    echo "" >> dict/$(basename $i).h
+    echo "BackgroundAudioDictionary dict_$d = {" >> dict/$(basename $i).h
+    echo "    \"$d\"," >> dict/$(basename $i).h
+    echo "    $(stat -c %s $i)," >> dict/$(basename $i).h
+    echo "    __espeakng_dict_$d," >> dict/$(basename $i).h
+    echo "    $(grep -o 0x dict/$(basename $i)_index.h | wc -l)," >> dict/$(basename $i).h
+    echo "    __espeakng_dictindex_$d" >> dict/$(basename $i).h
+    echo "};" >> dict/$(basename $i).h
 done
 
 # The phoneme database, also needs alignment
@@ -77,19 +89,21 @@ for i in `find /tmp/espeak/share/espeak-ng-data/lang/ -type f -print`; do
     if [ "$n" == "" ]; then n=$(echo $i | cut -f7- -d/ | sed 's/\//_/'); fi
     out=$(echo $n | sed s/-/_/g | tr /A-Z/ /a-z/)
     m=$(grep ^name $i | head -1 | cut -f2- -d" " | sed 's/\/\/.*//')
+    # The dictionary is named by the voice, else it's the one for its first language (as LoadVoice picks it)
+    assocdict=$(grep "^dictionary" $i | tail -1 | awk '{print $2}')
+    if [ "$assocdict" == "" ]; then assocdict=$(grep "^language" $i | cut -f2 -d" " | head -1 | cut -f1 -d-); fi
     echo "// Auto-generated, do not edit!  See lib/update_lib.sh" > voice/$out.h
     echo "#pragma once" >> voice/$out.h
     echo "#include <BackgroundAudioSpeech.h>" >> voice/$out.h
+    echo "#include <libespeak-ng/dict/$assocdict""_dict.h>" >> voice/$out.h
     xxd -i $i | sed 's/unsigned char.*/const unsigned char __rawdata_'$out'[] = {/' | grep -v 'unsigned int' >> voice/$out.h 
     echo "" >> voice/$out.h
     echo "BackgroundAudioVoice voice_$out = {" >> voice/$out.h
     echo "    \"$m\"," >> voice/$out.h
     echo "    $(stat -c %s $i)," >> voice/$out.h
-    echo "    __rawdata_$out" >> voice/$out.h
+    echo "    __rawdata_$out," >> voice/$out.h
+    echo "    &dict_$assocdict" >> voice/$out.h
     echo "};"  >> voice/$out.h
-    langs=$(grep "^language" $i | cut -f2 -d" " | paste -s -d, | sed 's/,/, /g')
-    assocdict=$(grep "^language" $i | cut -f2 -d" " | head -1 | cut -f1 -d-)
-    echo "#include <libespeak-ng/dict/$assocdict""_dict.h>" >> voice/$out.h
     echo "| $m | \`#include <libespeak-ng/voice/$out.h>\` | \`BackgroundAudioSpeech::setVoice(voice_$out)\` |" >> ../../LANGUAGES.md
 done
 sort < ../../LANGUAGES.md > ../../LANGUAGES.md1
@@ -24,6 +24,9 @@
 #include "BackgroundAudioMP3.h"
 #include "BackgroundAudioWAV.h"
 #include "BackgroundAudioMixer.h"
+#include "BackgroundAudioSampler.h"
+#include "BackgroundAudioPrompts.h"
+#include "BackgroundAudioPipeline.h"
 
 /**
     @mainpage
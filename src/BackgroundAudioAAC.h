@@ -24,6 +24,10 @@
 #include "WrappedAudioOutputBase.h"
 #include "BackgroundAudioGain.h"
 #include "BackgroundAudioBuffers.h"
+#include "BackgroundAudioInstrument.h"
+#include "BackgroundAudioTrace.h"
+#include "BackgroundAudioDispatch.h"
+#include "BackgroundAudioCommand.h"
 #include "libhelix-aac/aacdec.h"
 
 /**
@@ -51,6 +55,17 @@ public:
         setDevice(&d);
     }
 
+    /**
+        @brief Construct an AAC decoder which will decode directly into the output's buffers
+
+        @param [in] d ZeroCopyAudioOutputBase device (i.e. MixerInput) to decode to
+    */
+    BackgroundAudioAACClass(ZeroCopyAudioOutputBase &d) {
+        _playing = false;
+        _paused = false;
+        setDevice(&d);
+    }
+
     ~BackgroundAudioAACClass() {}
 
     /**
@@ -63,18 +78,35 @@ public:
     bool setDevice(AudioOutputBase *d) {
         if (!_playing) {
             _out = d;
+            _zc = nullptr;
             return true;
         }
         return false;
     }
 
     /**
-                @brief Set the gain multiplier (volume) for the stream.  Takes effect immediately.
+           @brief Set an output device before `begin` which supports decoding in place
+
+           @param [in] d Pointer to `ZeroCopyAudioOutputBase` to decode data into
+
+           @return True on success
+    */
+    bool setDevice(ZeroCopyAudioOutputBase *d) {
+        if (!_playing) {
+            _out = d;
+            _zc = d;
+            return true;
+        }
+        return false;
+    }
+
+    /**
+                @brief Set the gain multiplier (volume) for the stream.  Ramps to it over the next frame decoded.
 
                 @param [in] scale Floating point value from 0.0....16.0 to multiply all audio data by
     */
     void setGain(float scale) {
-        _gain = (int32_t)(scale * (1 << 16));
+        command(BA_COMMAND_GAIN, (int32_t)(scale * (1 << 16)));
     }
 
     /**
@@ -91,30 +123,28 @@ public:
             return false;
         }
 
-#ifdef ARDUINO_ARCH_RP2040
-        _workIRQ = user_irq_claim_unused(true);
-        _workObj = this;
-        irq_set_exclusive_handler(_workIRQ, _irqStub);
-        irq_set_priority(_workIRQ, 0xc0); // Lowest prio
-        irq_set_enabled(_workIRQ, true);
-#endif
-
-        _hAACDecoder = AACInitDecoderPre(_private, sizeof(_private));
-        if (!_hAACDecoder) {
+        if (!initDecoder()) {
             return false;
         }
 
+#ifdef ARDUINO_ARCH_RP2040
+        BackgroundAudioDispatcher::attach(&_work, _out, 5 * framelen * 4);
+#endif
+
         // We will use natural frame size to minimize mismatch
         _out->setBuffers(5, framelen);  // Framelen is in samples, but buffers takes words, which means 2 samples per word so we're good!
+        BA_INSTRUMENT(_instr.setOutput(5, framelen));
+        BA_TRACE_NAME(this, "AAC");
         _out->onTransmit(&_cb, (void *)this); // The pump we will use to generate our audio
         _out->setBitsPerSample(16);
         _out->setStereo(true);
         _out->setFrequency(44100);
         _out->begin();
 
-        // Stuff with silence to start
+        // Stuff with silence to start.  Zero-copy outputs (mixer legs) already play silence when empty,
+        // and leaving them untouched keeps their buffers frame-aligned so we can decode in place.
         uint16_t zeros[32] __attribute__((aligned(4))) = {};
-        while (_out->availableForWrite() > 32) {
+        while (!_zc && (_out->availableForWrite() > 32)) {
             _out->write((uint8_t *)zeros, sizeof(zeros));
         }
         _playing = true;
@@ -128,8 +158,7 @@ public:
     void end() {
         if (_playing) {
 #ifdef ARDUINO_ARCH_RP2040
-            irq_set_enabled(_workIRQ, false);
-            user_irq_unclaim(_workIRQ);
+            BackgroundAudioDispatcher::detach(&_work);
 #endif
             _out->end();
         }
@@ -162,7 +191,9 @@ public:
                @return Number of bytes written
     */
     size_t write(const void *data, size_t len) {
-        return _ib.write((const uint8_t *)data, len);
+        size_t ret = _ib.write((const uint8_t *)data, len);
+        BA_TRACE(BA_TRACE_WRITE, this, ret);
+        return ret;
     }
 
     /**
@@ -192,10 +223,11 @@ public:
     /**
              @brief Determine if no more AAC file is present in the buffer
 
-             @return True if no raw AAC data is still left to process
+             @return True if no raw AAC data is still left to process, other than the start of a frame waiting on the rest
     */
     bool done() {
-        return available() <= 16; // Some minimum framesize
+        // Some minimum framesize, or only the start of a frame which is still waiting on the rest
+        return (available() <= 16) || (_partial && (available() == _partial));
     }
 
     /**
@@ -248,78 +280,235 @@ public:
 
                 @details
                 This is only needed to abort a currently playing AAC file (i.e. skipping a track in the middle).
-                Multiple AAC files can just be concatenated together in the input buffer with `write`
+                Multiple AAC files can just be concatenated together in the input buffer with `write`.  Waits for
+                the decoder to finish its current frame, so data `write`n afterwards is kept.
+
+                Call it from the app (`loop`, a task, or a pipeline's worker), not from an interrupt or an output's
+                `onTransmit` callback, where the decoder can't run until the caller returns.  There it returns false at
+                once rather than hang, and on the RP2040 with the work IRQ masked it gives up after `timeoutMs`.
+
+                @param [in] timeoutMs Longest to wait for the decoder
+
+                @return True once flushed, false if it hadn't been by `timeoutMs` (it's still queued unless the queue was full)
     */
-    void flush() {
-        noInterrupts();
-        _ib.flush();
-        _accumShift = 0;
-        interrupts();
+    bool flush(uint32_t timeoutMs = BackgroundAudioCommandQueue::defaultTimeoutMs) {
+        uint32_t ticket = command(BA_COMMAND_FLUSH);
+        return ticket && _cmd.wait(ticket, timeoutMs);
     }
 
     /**
-              @brief Pause the decoder.  Won't process raw input data and will transmit silence
+        @brief Jump to another place in the AAC data.  Only for `ROMBackgroundAudioAAC`
+
+        @details
+        The RAM buffered player throws its data away as it decodes, so only the ROM player can seek.  Decoding
+        carries on from the first ADTS frame header at or after `pos`.  Like `flush` it waits for the decoder to
+        finish its current frame, and mustn't be called from an interrupt.
+
+        @param [in] pos Byte offset into the data given to `write`
+        @param [in] timeoutMs Longest to wait for the decoder
+
+        @return True if the decoder moved there, false if it can't seek, `pos` is past the end, or it timed out
+    */
+    bool seek(size_t pos, uint32_t timeoutMs = BackgroundAudioCommandQueue::defaultTimeoutMs) {
+        if (pos > INT32_MAX) {
+            return false;
+        }
+        uint32_t ticket = command(BA_COMMAND_SEEK, pos);
+        return ticket && _cmd.wait(ticket, timeoutMs) && _seekOK;
+    }
+
+    /**
+        @brief Sleep until every `setGain`, `pause`, `unpause`, `flush`, and `seek` so far has taken effect
+
+        @details
+        Control calls are queued for the decoder to apply between frames, so they never race with a frame
+        being decoded in the background.  This waits on them without spinning.
+
+        @param [in] timeoutMs Longest to wait
+
+        @return True if they were all applied, false on timeout
+    */
+    bool waitCommands(uint32_t timeoutMs = UINT32_MAX) {
+        return _cmd.wait(_cmd.last(), timeoutMs);
+    }
+
+    /**
+        @brief Start playing the next data written at an exact mixer sample time
+
+        @details
+        Only supported when decoding to a `BackgroundAudioMixerInput` leg.  Any audio already queued on the
+        leg is dropped and the leg stays silent until `sampleTime`, when the first decoded sample is spliced
+        in.  Typically called after `flush` and before `write`ing the new AAC file.
+
+        @param [in] sampleTime Mixer sample clock value, see `BackgroundAudioMixer::sampleTime`
+
+        @return True if the start was scheduled
+    */
+    bool startAt(uint64_t sampleTime) {
+        return _zc && _zc->startAt(sampleTime);
+    }
+
+    /**
+              @brief Pause the decoder.  Fades out over the next frame, then won't process raw input data and will transmit silence
     */
     void pause() {
-        _paused = true;
+        _pauseReq = true;
+        command(BA_COMMAND_PAUSE);
     }
 
     /**
             @brief Determine if the playback is paused
 
-            @return True of WAV playback has been paused
+            @return True of AAC playback has been paused, even if the fade out hasn't happened yet
     */
     bool paused() {
-        return _paused;
+        return _pauseReq;
     }
 
     /**
-           @brief Unpause previously paused playback.  Will start processing input data again
+           @brief Unpause previously paused playback.  Will start processing input data again, fading in
     */
     void unpause() {
-        _paused = false;
+        _pauseReq = false;
+        command(BA_COMMAND_UNPAUSE);
     }
 
+    /**
+        @brief Decode straight into a buffer as fast as the CPU allows, with no output device or callbacks
+
+        @details
+        For transcoding, pre-rendering audio into flash or PSRAM, and tests.  Use instead of `begin`, not
+        alongside it: `write` the AAC data (a RAM buffer can be topped up between calls) and call `render`
+        until it returns fewer samples than asked for.  The output is exactly what the player would have sent
+        to its output device, with the gain applied, as interleaved 16-bit stereo at `sampleRate`.
+
+        @param [out] dest Buffer for `samples` stereo samples, i.e. `samples * 2` int16_t
+        @param [in] samples Number of stereo samples wanted
+
+        @return Number of stereo samples written, fewer than `samples` only when the input ran out or playback is paused
+    */
+    size_t render(int16_t *dest, size_t samples) {
+        if (_playing) {
+            return 0; // The background pump owns the decoder
+        }
+        if (!_rendering) {
+            if (!initDecoder()) {
+                return 0;
+            }
+            _rendering = true;
+        }
+        size_t ret = 0;
+        while (ret < samples) {
+            if (_renderPos == _renderLen) {
+                applyCommands(true);
+                if (_paused || done()) {
+                    break;
+                }
+                generateOneFrame(_outSample);
+                if (_partial) {
+                    break; // The next frame isn't all here, so return what there is and let the app write more
+                }
+                _renderPos = 0;
+                _renderLen = _outSamples;
+            }
+            size_t n = std::min(samples - ret, _renderLen - _renderPos);
+            memcpy(dest + ret * 2, _outSample[_renderPos], n * 2 * sizeof(int16_t));
+            _renderPos += n;
+            ret += n;
+        }
+        return ret;
+    }
+
+    /**
+        @brief Get the sample rate of the decoded audio, known once the first frame is decoded
+
+        @return Sample rate in hertz
+    */
+    int sampleRate() {
+        return _sampleRate;
+    }
+
+#ifdef BACKGROUNDAUDIO_INSTRUMENT
+    /**
+        @brief Get the pump and frame timing statistics.  Only built with BACKGROUNDAUDIO_INSTRUMENT defined
+
+        @param [out] t Filled in with a consistent snapshot of the statistics
+    */
+    void getTiming(BackgroundAudioTiming *t) {
+        _instr.read(t);
+    }
+
+    /**
+        @brief Clear the timing statistics, taking effect at the start of the next pump
+    */
+    void resetTiming() {
+        _instr.reset();
+    }
+#endif
+
 private:
 #ifdef ARDUINO_ARCH_RP2040
-    static void _irqStub() {
-        BackgroundAudioAACClass<DataBuffer>::_workObj->pump();
+    static void _irqStub(void *ptr) {
+        ((BackgroundAudioAACClass *)ptr)->pump();
     }
 
     static void _cb(void *ptr) {
+        BA_TRACE(BA_TRACE_CALLBACK, ptr, 0);
         // Don't actually do work in the DMA interrupt, do it in the work IRQ context (low prio)
-        irq_set_pending(BackgroundAudioAACClass<DataBuffer>::_workIRQ);
+        BackgroundAudioDispatcher::post(&((BackgroundAudioAACClass *)ptr)->_work);
     }
 #else
     static void _cb(void *ptr) {
+        BA_TRACE(BA_TRACE_CALLBACK, ptr, 0);
         ((BackgroundAudioAACClass*)ptr)->pump();
     }
 #endif
 
-    void generateOneFrame() {
+    bool initDecoder() {
+        _hAACDecoder = AACInitDecoderPre(_private, sizeof(_private));
+        return _hAACDecoder != nullptr;
+    }
+
+    void generateOneFrame(int16_t (*out)[2]) {
         // Every frame requires shifting all remaining data (6K?) before processing.
         // We're not decoding AACs, we're shifting data!  Instead, scroll down and only
         // shift when we're > 1/2 of the total buffer size.  We'll still shift to
         // allow new data to be written, but we'll do it much less frequently.
 
+        BA_PROFILE_BEGIN(BA_PROFILE_SYNC);
         int nextFrame = AACFindSyncWord((uint8_t *)_ib.buffer() + _accumShift, _ib.available() - _accumShift);
+        BA_PROFILE_END(BA_PROFILE_SYNC);
         if (nextFrame == -1) {
             // Could not find a sync word but we need to send a frame now do dump entire buffer and play silence
+            BA_TRACE(BA_TRACE_SHIFT_BEGIN, this, _ib.available());
             _ib.shiftUp(_ib.available());
+            BA_TRACE(BA_TRACE_SHIFT_END, this, 0);
             _accumShift = 0;
-            bzero(_outSample, sizeof(_outSample));
+            bzero(out, framelen * 2 * sizeof(int16_t));
             _errors++;
             _dumps++;
         } else {
             _accumShift += nextFrame;
             const unsigned char *inBuff = _ib.buffer() + _accumShift;
             int bytesLeft = _ib.available() - _accumShift;
-            int ret = AACDecode(_hAACDecoder, (unsigned char **)&inBuff, &bytesLeft, (int16_t *)_outSample);
-            if (ret) {
+            int ret = AACDecode(_hAACDecoder, (unsigned char **)&inBuff, &bytesLeft, (int16_t *)out);
+            _partial = 0;
+            if (ret == ERR_AAC_INDATA_UNDERFLOW) {
+                // The frame isn't all here yet, so play silence and try it again once more has been written
+                if (_ib.availableForWrite()) {
+                    _partial = _ib.available() - _accumShift;
+                    _underflows++;
+                    BA_TRACE(BA_TRACE_UNDERFLOW, this, 0);
+                } else {
+                    _accumShift = _ib.available(); // ROM data never gets the rest, so the cut off frame ends it
+                    _errors++;
+                }
+                bzero(out, framelen * 2 * sizeof(int16_t));
+            } else if (ret) {
                 // Error in decode, play silence and skip
                 _accumShift++; // Just go one past the current bad sync and try again
                 _errors++;
-                bzero(_outSample, sizeof(_outSample));
+                bzero(out, framelen * 2 * sizeof(int16_t));
             } else {
                 AACFrameInfo fi;
                 AACGetLastFrameInfo(_hAACDecoder, &fi);
@@ -328,8 +517,13 @@ private:
                 _accumShift = inBuff - _ib.buffer();
                 _frames++;
                 if (fi.nChans == 1) {
-                    for (int i = 0; i < _outSamples; i++) {
-                        _outSample[i][1] = _outSample[1][0];
+                    // Mono comes out packed, so spread it over both channels from the end, where nothing unread is overwritten
+                    _outSamples = fi.outputSamps;
+                    const int16_t *mono = (const int16_t *)out;
+                    for (int i = _outSamples - 1; i >= 0; i--) {
+                        int16_t s = mono[i];
+                        out[i][0] = s;
+                        out[i][1] = s;
                     }
                 }
             }
@@ -337,52 +531,160 @@ private:
 
         // If we accumulate too large of a shift, actually do the shift so more space for writer
         if (_accumShift > _ib.size() / 2) {
+            BA_TRACE(BA_TRACE_SHIFT_BEGIN, this, _accumShift);
             _ib.shiftUp(_accumShift);
+            BA_TRACE(BA_TRACE_SHIFT_END, this, 0);
             _accumShift = 0;
             _shifts++;
         }
 
-        ApplyGain((int16_t *)_outSample, _outSamples * 2, _gain);
+        applyGain((int16_t *)out, _outSamples * 2);
+    }
+
+    // Queue a control call for the pump, or apply it now when nothing else is decoding: not started, rendering
+    // offline, or called on a pipeline's worker between frames.  Returns 0 if the queue stayed full
+    uint32_t command(uint8_t op, int32_t arg = 0) {
+        uint32_t ticket;
+        while (!(ticket = _cmd.post(op, arg))) {
+            if (_playing || _cmd.drainedElsewhere()) {
+                // The pump or a pipeline's worker will make room, unless this is an IRQ it can't preempt
+                if (!_cmd.wait(_cmd.last(), BackgroundAudioCommandQueue::defaultTimeoutMs)) {
+                    return 0;
+                }
+            } else {
+                applyCommands(false);
+            }
+        }
+        if (!_playing && !_cmd.drainedElsewhere()) {
+            applyCommands(_rendering);
+        }
+        return ticket;
+    }
+
+    // Between frames, apply what the app asked for.  With `ramp` gain and pause changes fade over the next frame
+    void applyCommands(bool ramp) {
+        _cmd.drain([this, ramp](uint8_t op, int32_t arg) {
+            switch (op) {
+            case BA_COMMAND_FLUSH:
+                _ib.flush();
+                _accumShift = 0;
+                _partial = 0;
+                _renderPos = _renderLen;
+                break;
+            case BA_COMMAND_SEEK:
+                _seekOK = _ib.seek(arg);
+                if (_seekOK) {
+                    _accumShift = 0;
+                    _partial = 0;
+                    _renderPos = _renderLen;
+                    if (_playing || _rendering) {
+                        AACFlushCodec(_hAACDecoder); // No overlap from the frames before
+                    }
+                }
+                break;
+            case BA_COMMAND_PAUSE:
+                if (ramp && !_paused) {
+                    _pausing = true;
+                } else {
+                    _paused = true;
+                    _rampFrom = 0;
+                }
+                break;
+            case BA_COMMAND_UNPAUSE:
+                _paused = false;
+                _pausing = false;
+                if (!ramp) {
+                    _rampFrom = _gain;
+                }
+                break;
+            case BA_COMMAND_GAIN:
+                _gain = arg;
+                if (!ramp && !_paused) {
+                    _rampFrom = arg;
+                }
+                break;
+            }
+        });
+    }
+
+    // Gain for this frame, sliding from the last frame's after a change or pause so it doesn't click
+    void applyGain(int16_t *samples, size_t count) {
+        int32_t to = _pausing ? 0 : _gain;
+        ApplyGainRamp(samples, count, _rampFrom, to);
+        _rampFrom = to;
+        if (_pausing) {
+            _pausing = false;
+            _paused = true;
+        }
     }
 
 #ifdef ARDUINO_ARCH_RP2040
 public:
 #endif
     void pump() {
+        BA_INSTRUMENT(_instr.pumpBegin(_out->availableForWrite(), _sampleRate));
+        BA_TRACE(BA_TRACE_PUMP_BEGIN, this, _out->availableForWrite());
         while (_out->availableForWrite() >= (int)(framelen * 2 * sizeof(int16_t))) {
+            applyCommands(true);
+            // Decode straight into the output's buffer when it has room for the largest (HE-AAC) frame.  With
+            // AAC-LC that's only the first of every two frames in a buffer, the second is copied
+            size_t words = 0;
+            int16_t (*out)[2] = _zc ? (int16_t (*)[2])_zc->acquireWriteBuffer(&words) : nullptr;
+            if (words < framelen) {
+                out = _outSample;
+            }
             if (_paused) {
-                bzero((uint8_t *)_outSample, _outSamples * 2 * sizeof(int16_t));
+                bzero((uint8_t *)out, _outSamples * 2 * sizeof(int16_t));
             } else {
-                generateOneFrame();
+                BA_INSTRUMENT(_instr.frameBegin());
+                BA_TRACE(BA_TRACE_FRAME_BEGIN, this, 0);
+                generateOneFrame(out);
+                BA_TRACE(BA_TRACE_FRAME_END, this, 0);
+                BA_INSTRUMENT(_instr.frameEnd());
                 if (_sampleRate) {
                     _out->setFrequency(_sampleRate);
                 }
             }
-            assert(_out->write((uint8_t *)_outSample, _outSamples * 2 * sizeof(int16_t)) == _outSamples * 2 * sizeof(int16_t));
+            if (out == _outSample) {
+                assert(_out->write((uint8_t *)_outSample, _outSamples * 2 * sizeof(int16_t)) == _outSamples * 2 * sizeof(int16_t));
+            } else {
+                _zc->commitWriteBuffer(_outSamples);
+            }
         }
-#ifdef ARDUINO_ARCH_RP2040
-        irq_clear(_workIRQ);
-#endif
+        BA_TRACE(BA_TRACE_PUMP_END, this, 0);
+        BA_INSTRUMENT(_instr.pumpEnd());
     }
 
 #ifdef ARDUINO_ARCH_RP2040
-    static uint8_t _workIRQ;
-    static BackgroundAudioAACClass<DataBuffer> *_workObj;
+    BackgroundAudioWork _work{_irqStub, this};
 #endif
 
 private:
     AudioOutputBase *_out = nullptr;
+    ZeroCopyAudioOutputBase *_zc = nullptr;
     HAACDecoder _hAACDecoder;
-    uint8_t _private[/*sizeof(AACDecInfo)*/ 96 + /*sizeof(PSInfoBase)*/ 28752 + /*sizeof(PSInfoSBR)*/ 50788 + 16];
+    uint8_t _private[/*sizeof(AACDecInfo), 5 pointers*/ ((96 + 5 * (sizeof(void *) - 4) + 7) & ~7) + /*sizeof(PSInfoBase)*/ 28752 + /*sizeof(PSInfoSBR)*/ 50788 + 16];
     bool _playing = false;
     bool _paused = false;
+    bool _pausing = false;      // Fading out for a pause over the next frame
+    bool _pauseReq = false;     // What the app last asked for
+    bool _rendering = false;
+    volatile bool _seekOK = false;
+    size_t _renderPos = 0;      // Next sample of the last rendered frame to return
+    size_t _renderLen = 0;
+    BackgroundAudioCommandQueue _cmd;
     static const size_t framelen = 2048;
     int16_t _outSample[framelen][2] __attribute__((aligned(4)));
     int _outSamples = 1024;
     int _sampleRate = 44000;
     DataBuffer _ib;
     int32_t _gain = 1 << 16;
+    int32_t _rampFrom = 1 << 16;  // Gain the last frame ended at
     uint32_t _accumShift = 0;
+    uint32_t _partial = 0;        // Bytes left when the next frame was found cut short, 0 if it wasn't
+#ifdef BACKGROUNDAUDIO_INSTRUMENT
+    BackgroundAudioInstrument _instr;
+#endif
 
     // AAC quality stats, cumulative
     uint32_t _frames = 0;
@@ -392,11 +694,6 @@ private:
     uint32_t _dumps = 0;
 };
 
-#ifdef ARDUINO_ARCH_RP2040
-template<class DataBuffer> uint8_t BackgroundAudioAACClass<DataBuffer>::_workIRQ;
-template<class DataBuffer> BackgroundAudioAACClass<DataBuffer> *BackgroundAudioAACClass<DataBuffer>::_workObj;
-#endif
-
 /**
     @brief General purpose AAC background player with an 8KB buffer.  Needs to have `write` called repeatedly with data.
 */
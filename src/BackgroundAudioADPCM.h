@@ -0,0 +1,196 @@
+/*
+    BackgroundAudio
+    Plays an audio file using IRQ driven decompression.  Main loop() writes
+    data to the buffer but isn't blocked while playing
+
+    Copyright (c) 2025 Earle F. Philhower, III <earlephilhower@yahoo.com>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+#include <stdint.h>
+
+/**
+    @brief Tables shared by the IMA-ADPCM encoder and decoder
+*/
+class IMAADPCM {
+public:
+    /**
+        @brief Quantizer step size for each of the 89 step indexes
+    */
+    static inline int32_t step(int index) {
+        static const uint16_t _step[89] = {
+            7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45, 50, 55, 60, 66, 73, 80, 88, 97,
+            107, 118, 130, 143, 157, 173, 190, 209, 230, 253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658, 724,
+            796, 876, 963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024, 3327, 3660, 4026,
+            4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487, 12635, 13899, 15289, 16818, 18500,
+            20350, 22385, 24623, 27086, 29794, 32767
+        };
+        return _step[index];
+    }
+
+    /**
+        @brief Apply the step index adjustment for a just-processed 4-bit code, clamping to the table
+    */
+    static inline int adjust(int index, uint8_t code) {
+        static const int8_t _adjust[8] = { -1, -1, -1, -1, 2, 4, 6, 8 };
+        index += _adjust[code & 7];
+        if (index < 0) {
+            return 0;
+        } else if (index > 88) {
+            return 88;
+        }
+        return index;
+    }
+
+    /**
+        @brief Reconstruct the next sample from the prior one and a 4-bit code, as done identically by encoder and decoder
+    */
+    static inline int32_t reconstruct(int32_t predictor, int index, uint8_t code) {
+        int32_t s = step(index);
+        int32_t diff = s >> 3;
+        if (code & 4) {
+            diff += s;
+        }
+        if (code & 2) {
+            diff += s >> 1;
+        }
+        if (code & 1) {
+            diff += s >> 2;
+        }
+        predictor += (code & 8) ? -diff : diff;
+        if (predictor > 32767) {
+            return 32767;
+        } else if (predictor < -32768) {
+            return -32768;
+        }
+        return predictor;
+    }
+};
+
+/**
+    @brief Streaming IMA-ADPCM (4 bits/sample) decoder, one nibble at a time
+*/
+class IMAADPCMDecoder {
+public:
+    IMAADPCMDecoder() {
+        reset();
+    }
+
+    /**
+        @brief Restart the decoder, i.e. at the start of a new WAV block
+
+        @param [in] predictor Initial sample value
+        @param [in] index Initial step index, 0...88
+    */
+    inline void reset(int16_t predictor = 0, int index = 0) {
+        _predictor = predictor;
+        _index = (index < 0) ? 0 : (index > 88) ? 88 : index;
+    }
+
+    /**
+        @brief Decode a single 4-bit code into a 16-bit sample
+
+        @param [in] code ADPCM nibble (only the low 4 bits are used)
+
+        @return Decoded sample
+    */
+    inline int16_t decode(uint8_t code) {
+        _predictor = IMAADPCM::reconstruct(_predictor, _index, code);
+        _index = IMAADPCM::adjust(_index, code);
+        return (int16_t)_predictor;
+    }
+
+private:
+    int32_t _predictor;
+    int _index;
+};
+
+/**
+    @brief Streaming IMA-ADPCM (4 bits/sample) encoder, one sample at a time
+*/
+class IMAADPCMEncoder {
+public:
+    IMAADPCMEncoder() {
+        reset();
+    }
+
+    /**
+        @brief Restart the encoder.  A decoder must be `reset` with the same values to track it
+
+        @param [in] predictor Initial sample value
+        @param [in] index Initial step index, 0...88
+    */
+    inline void reset(int16_t predictor = 0, int index = 0) {
+        _predictor = predictor;
+        _index = (index < 0) ? 0 : (index > 88) ? 88 : index;
+    }
+
+    /**
+        @brief Encode a 16-bit sample into a 4-bit code
+
+        @param [in] sample Sample to encode
+
+        @return ADPCM nibble in the low 4 bits
+    */
+    inline uint8_t encode(int16_t sample) {
+        int32_t diff = sample - _predictor;
+        uint8_t code = 0;
+        if (diff < 0) {
+            code = 8;
+            diff = -diff;
+        }
+        int32_t s = IMAADPCM::step(_index);
+        if (diff >= s) {
+            code |= 4;
+            diff -= s;
+        }
+        s >>= 1;
+        if (diff >= s) {
+            code |= 2;
+            diff -= s;
+        }
+        s >>= 1;
+        if (diff >= s) {
+            code |= 1;
+        }
+        // Track exactly what the decoder will reconstruct so errors don't accumulate
+        _predictor = IMAADPCM::reconstruct(_predictor, _index, code);
+        _index = IMAADPCM::adjust(_index, code);
+        return code;
+    }
+
+    /**
+        @brief Get the current predictor, i.e. to write a WAV block header
+
+        @return Predicted (last reconstructed) sample
+    */
+    inline int16_t predictor() {
+        return (int16_t)_predictor;
+    }
+
+    /**
+        @brief Get the current step index, i.e. to write a WAV block header
+
+        @return Step index 0...88
+    */
+    inline int index() {
+        return _index;
+    }
+
+private:
+    int32_t _predictor;
+    int _index;
+};
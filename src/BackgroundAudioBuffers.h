@@ -21,6 +21,7 @@
 
 #pragma once
 #include <Arduino.h>
+#include "BackgroundAudioProfile.h"
 
 /**
     @brief Interrupt-safe, multicore-safe biftable buffer for libmad raw data.
@@ -146,6 +147,7 @@ public:
         In general decoders want to call this function ad *infrequently* as possible.
     */
     inline void shiftUp(size_t cnt) {
+        BA_PROFILE_BEGIN(BA_PROFILE_SHIFTUP);
 #if defined(ESP32)
         taskENTER_CRITICAL(&_mtx);
 #else
@@ -165,6 +167,7 @@ public:
         mutex_exit(&_mtx);
         interrupts();
 #endif
+        BA_PROFILE_END(BA_PROFILE_SHIFTUP);
     }
 
     /**
@@ -174,6 +177,27 @@ public:
         _len  = 0;
     }
 
+    /**
+        @brief Move the read point to another place in the data written, but fail because it's shifted away as it's read
+
+        @param [in] pos Byte offset from the start of the data
+
+        @return False due to unsupported
+    */
+    inline bool seek(size_t pos) {
+        (void) pos;
+        return false;
+    }
+
+    /**
+        @brief Get the offset of `buffer` from the start of the data, which isn't tracked here
+
+        @return 0 due to unsupported
+    */
+    inline size_t position() {
+        return 0;
+    }
+
 private:
     static const size_t count = bytes;
     uint8_t _buff[count];
@@ -192,6 +216,7 @@ private:
 class ROMDataBuffer {
 public:
     ROMDataBuffer() {
+        _start = nullptr;
         _buff = nullptr;
         _len = 0;
         _count = 0;
@@ -257,6 +282,7 @@ public:
         @return Number of bytes actually written
     */
     inline size_t write(const uint8_t *data, size_t cnt) {
+        _start = data;
         _buff = data;
         _len = cnt;
         _count = cnt;
@@ -317,7 +343,49 @@ public:
         _len  = 0;
     }
 
+    /**
+        @brief Move the read point to another place in the data written, forward or back
+
+        @details
+        The whole block is still in ROM, so the data already read can be returned to.  `buffer` then points
+        `pos` bytes into what was last `write`n.
+
+        @param [in] pos Byte offset from the start of the data
+
+        @return True on success, false if past the end
+    */
+    inline bool seek(size_t pos) {
+        if (!_start || (pos > _count)) {
+            return false;
+        }
+#if defined(ESP32)
+        taskENTER_CRITICAL(&_mtx);
+#else
+        noInterrupts();
+        mutex_enter_blocking(&_mtx);
+#endif
+        _buff = _start + pos;
+        _len = _count - pos;
+#if defined(ESP32)
+        taskEXIT_CRITICAL(&_mtx);
+#else
+        mutex_exit(&_mtx);
+        interrupts();
+#endif
+        return true;
+    }
+
+    /**
+        @brief Get the offset of `buffer` from the start of the data last `write`n
+
+        @return Bytes already shifted out
+    */
+    inline size_t position() {
+        return _buff - _start;
+    }
+
 private:
+    const uint8_t *_start;
     const uint8_t *_buff;
     size_t _len;
     size_t _count;
@@ -0,0 +1,171 @@
+/*
+    BackgroundAudio
+    Lock-free queue of control commands from the app to a decoder's pump
+
+    Copyright (c) 2025 Earle F. Philhower, III <earlephilhower@yahoo.com>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+#include <Arduino.h>
+#include <atomic>
+#include "BackgroundAudioPlatform.h"
+
+/**
+    @brief Control operations the app can ask a decoder to perform
+*/
+enum {
+    BA_COMMAND_FLUSH,       // Throw out the input and start on a new file
+    BA_COMMAND_PAUSE,       // Fade out over the next frame, then send silence
+    BA_COMMAND_UNPAUSE,     // Fade back in over the next frame
+    BA_COMMAND_GAIN,        // arg = new 16.16 gain, ramped to over the next frame
+    BA_COMMAND_SEEK         // arg = byte offset in the ROM data to carry on decoding from
+};
+
+/**
+    @brief Single producer, single consumer queue of commands, applied by the pump between frames
+
+    @details
+    The app `post`s and the decoder's pump (in the work IRQ, the ESP32's I2S task, or on the other core
+    in a `BackgroundAudioPipeline`) `drain`s before each frame, so a command never lands in the middle of
+    decoding and nothing needs interrupts masked.  Only plain atomic loads and stores are used, as on the
+    M0+.  Each `post` returns a ticket which `wait` sleeps on until the pump has applied it.  In an interrupt
+    handler the pump can't run until it returns, so there `wait` doesn't sleep and only reports if it's done.
+
+    When a pipeline's worker drains the queue, `wait` called on the worker itself (i.e. from `loop1()` on
+    the RP2040) can't sleep, as nothing else would run the pump, so it returns at once.  The decoders check
+    `drainedElsewhere` and apply commands given there right away instead, as nothing is mid-frame.
+*/
+class BackgroundAudioCommandQueue {
+public:
+    BackgroundAudioCommandQueue() {
+    }
+
+    static constexpr uint32_t defaultTimeoutMs = 1000;  // How long `flush` and `seek` wait, many times any pump's period
+
+    /**
+        @brief Queue a command.  App side only
+
+        @param [in] op BA_COMMAND_xxx
+        @param [in] arg Command argument
+
+        @return Ticket for `done` and `wait`, or 0 if the queue is full
+    */
+    uint32_t post(uint8_t op, int32_t arg = 0) {
+        uint32_t wr = _wr.load(std::memory_order_relaxed);
+        if (wr - _rd.load(std::memory_order_acquire) == count) {
+            return 0;
+        }
+        _op[wr & (count - 1)] = op;
+        _arg[wr & (count - 1)] = arg;
+        _wr.store(wr + 1, std::memory_order_release);
+        return wr + 1;
+    }
+
+    /**
+        @brief Apply every queued command, in order.  Pump side only
+
+        @param [in] apply Called with each command's op and arg
+
+        @return True if any commands were applied
+    */
+    template<typename F>
+    bool drain(F apply) {
+        _byWorker = BackgroundAudioWorker::onWorker();
+        uint32_t rd = _rd.load(std::memory_order_relaxed);
+        uint32_t wr = _wr.load(std::memory_order_acquire);
+        if (rd == wr) {
+            return false;
+        }
+        while (rd != wr) {
+            apply(_op[rd & (count - 1)], _arg[rd & (count - 1)]);
+            _rd.store(++rd, std::memory_order_release);
+        }
+        _event.notify();
+        return true;
+    }
+
+    /**
+        @brief Determine if a command has been applied
+
+        @param [in] ticket Returned by `post`
+
+        @return True once the pump has applied it
+    */
+    bool done(uint32_t ticket) {
+        return (int32_t)(_rd.load(std::memory_order_acquire) - ticket) >= 0;
+    }
+
+    /**
+        @brief Determine if the queue has room for another command
+    */
+    bool full() {
+        return _wr.load(std::memory_order_relaxed) - _rd.load(std::memory_order_acquire) == count;
+    }
+
+    /**
+        @brief Determine if the pump runs on a worker other than the caller, so commands can't be applied here
+
+        @return True if the last `drain` was on a pipeline's worker and the caller isn't that worker
+    */
+    bool drainedElsewhere() {
+        return _byWorker && !BackgroundAudioWorker::onWorker();
+    }
+
+    /**
+        @brief Ticket of the last command posted, to wait on everything queued so far
+    */
+    uint32_t last() {
+        return _wr.load(std::memory_order_relaxed);
+    }
+
+    /**
+        @brief Sleep, without spinning, until a command has been applied
+
+        @param [in] ticket Returned by `post`
+        @param [in] timeoutMs Longest to wait
+
+        @return True if it was applied, false on timeout or when called on the worker or in an IRQ which would
+                have to return before it could be
+    */
+    bool wait(uint32_t ticket, uint32_t timeoutMs = UINT32_MAX) {
+        if ((_byWorker && BackgroundAudioWorker::onWorker()) || !BackgroundAudioEvent::canWait()) {
+            return done(ticket); // Sleeping here would stop the pump which is being waited on
+        }
+        uint32_t start = millis();
+        bool ok = true;
+        _event.arm(); // Before checking, so a drain in between still wakes us
+        while (!done(ticket)) {
+            uint32_t waited = millis() - start;
+            if (waited >= timeoutMs) {
+                ok = false;
+                break;
+            }
+            // Short slices so a second task waiting on the same queue, which takes over the wakeup, can't sleep forever
+            _event.wait(std::min(timeoutMs - waited, (uint32_t)5));
+        }
+        _event.disarm();
+        return ok;
+    }
+
+private:
+    static constexpr uint32_t count = 8;     // Power of 2
+    uint8_t _op[count];
+    int32_t _arg[count];
+    std::atomic<uint32_t> _wr{0};            // Written only by the app
+    std::atomic<uint32_t> _rd{0};            // Written only by the pump
+    volatile bool _byWorker = false;         // Last drained on a pipeline's worker
+    BackgroundAudioEvent _event;
+};
@@ -0,0 +1,169 @@
+/*
+    BackgroundAudio
+    Shared work IRQ which runs every decoder's pump, most urgent first
+
+    Copyright (c) 2025 Earle F. Philhower, III <earlephilhower@yahoo.com>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+#include <Arduino.h>
+#include "WrappedAudioOutputBase.h"
+#include "BackgroundAudioTrace.h"
+
+#ifdef ARDUINO_ARCH_RP2040
+
+/**
+    @brief One decoder's pump, as registered with the `BackgroundAudioDispatcher`
+*/
+class BackgroundAudioWork {
+public:
+    /**
+        @brief Create a work item, normally a member of the decoder
+
+        @param [in] pump Called in the work IRQ with `obj` to fill the output
+        @param [in] obj Decoder object
+    */
+    BackgroundAudioWork(void (*pump)(void *), void *obj) : _pump(pump), _obj(obj) {
+    }
+
+    /**
+        @brief Bytes waiting in the output to be played, the smaller the sooner this pump needs to run
+    */
+    int fill() const {
+        return _capacity - _out->availableForWrite();
+    }
+
+private:
+    friend class BackgroundAudioDispatcher;
+
+    void (*_pump)(void *);
+    void *_obj;
+    AudioOutputBase *_out = nullptr;
+    int _capacity = 0;
+    uint8_t _core = 0;
+    volatile bool _pending = false;
+    BackgroundAudioWork *_next = nullptr;
+};
+
+/**
+    @brief Runs the pumps of any number of decoders from a single low priority user IRQ per core
+
+    @details
+    The output's DMA callback only `post`s its decoder's work, as the pump can take milliseconds.  The one
+    work IRQ on that core then runs every posted pump, always picking the one whose output has the least
+    audio queued (the earliest deadline) next, until none are left.  So any number of objects, even of the
+    same class, can play at once while only one user IRQ is claimed per core, and a slow decoder won't make
+    a nearly empty output wait behind one with plenty left.
+
+    `attach` and `detach` must be called from the core the decoder plays on, and `post` from its output's
+    callback on that same core.
+*/
+class BackgroundAudioDispatcher {
+public:
+    /**
+        @brief Register a decoder's work on this core, claiming the user IRQ for the first one
+
+        @param [in] w Work item
+        @param [in] out Output device the pump writes to
+        @param [in] capacity Bytes of buffering in the output, as set with `setBuffers`
+    */
+    static void attach(BackgroundAudioWork *w, AudioOutputBase *out, int capacity) {
+        int core = get_core_num();
+        w->_out = out;
+        w->_capacity = capacity;
+        w->_core = core;
+        w->_pending = false;
+        if (!_head[core]) {
+            _irq[core] = user_irq_claim_unused(true);
+            irq_set_exclusive_handler(_irq[core], runPending);
+            irq_set_priority(_irq[core], 0xc0); // Lowest prio
+            irq_set_enabled(_irq[core], true);
+        }
+        noInterrupts();
+        w->_next = _head[core];
+        _head[core] = w;
+        interrupts();
+    }
+
+    /**
+        @brief Remove a decoder's work, releasing the user IRQ after the last one
+
+        @param [in] w Work item previously `attach`ed
+    */
+    static void detach(BackgroundAudioWork *w) {
+        int core = w->_core;
+        bool found = false;
+        noInterrupts();
+        for (BackgroundAudioWork **p = &_head[core]; *p; p = &(*p)->_next) {
+            if (*p == w) {
+                *p = w->_next;
+                found = true;
+                break;
+            }
+        }
+        w->_next = nullptr;
+        w->_pending = false;
+        interrupts();
+        if (found && !_head[core]) {
+            irq_set_enabled(_irq[core], false);
+            user_irq_unclaim(_irq[core]);
+        }
+    }
+
+    /**
+        @brief Ask for a decoder's pump to be run in the work IRQ.  Called from the output's callback
+
+        @param [in] w Work item
+    */
+    static void post(BackgroundAudioWork *w) {
+        w->_pending = true;
+        irq_set_pending(_irq[w->_core]);
+    }
+
+    /**
+        @brief Run every posted pump on this core, least output fill first.  The work IRQ handler
+    */
+    static void runPending() {
+        int core = get_core_num();
+        while (true) {
+            // A post after this re-raises the IRQ, one before it is found in the scan, so none are lost
+            irq_clear(_irq[core]);
+            BackgroundAudioWork *next = nullptr;
+            int nextFill = 0;
+            for (BackgroundAudioWork *w = _head[core]; w; w = w->_next) {
+                if (w->_pending) {
+                    int f = w->fill();
+                    if (!next || (f < nextFill)) {
+                        next = w;
+                        nextFill = f;
+                    }
+                }
+            }
+            if (!next) {
+                return;
+            }
+            next->_pending = false;
+            BA_TRACE(BA_TRACE_IRQ, next->_obj, nextFill);
+            next->_pump(next->_obj);
+        }
+    }
+
+private:
+    static inline uint8_t _irq[NUM_CORES];
+    static inline BackgroundAudioWork *_head[NUM_CORES];
+};
+
+#endif
@@ -21,6 +21,7 @@
 
 #pragma once
 #include <stdint.h>
+#include "BackgroundAudioProfile.h"
 
 /**
     @brief Potentially scale output signal in-situ with saturation.
@@ -35,6 +36,7 @@ static inline void ApplyGain(int16_t *samples, size_t count, int32_t gain) {
         return;
     }
 
+    BA_PROFILE_BEGIN(BA_PROFILE_GAIN);
     if (gain > 1 << 16) { // May clip
         for (size_t i = 0; i < count; i++) {
             int32_t x = samples[i];
@@ -55,4 +57,37 @@ static inline void ApplyGain(int16_t *samples, size_t count, int32_t gain) {
             samples[i] = x;
         }
     }
+    BA_PROFILE_END(BA_PROFILE_GAIN);
+}
+
+/**
+    @brief Scale the signal by a gain which slides linearly from one value to another, so a change doesn't click
+
+    @param [in, out] samples 16-bit stereo samples to be modified.  Will be overwritten by scaled output
+    @param [in] count Number of 16-bit quantities to scale (i.e. 2x number of stereo samples)
+    @param [in] from Fixed point 16.16 gain at the first sample
+    @param [in] to Fixed point 16.16 gain reached at the last sample
+*/
+static inline void ApplyGainRamp(int16_t *samples, size_t count, int32_t from, int32_t to) {
+    if ((from == to) || (count < 2)) {
+        ApplyGain(samples, count, to);
+        return;
+    }
+
+    BA_PROFILE_BEGIN(BA_PROFILE_GAIN);
+    int32_t step = (to - from) / (int32_t)(count / 2);
+    int32_t gain = from;
+    for (size_t i = 0; i < count; i += 2) {
+        gain += step;
+        for (size_t c = 0; c < 2; c++) {
+            int32_t x = (int32_t)(((int64_t)samples[i + c] * gain) >> 16); // Only one frame, so no fast paths
+            if (x < -32767) {
+                x = -32767;
+            } else if (x > 32767) {
+                x = 32767;
+            }
+            samples[i + c] = x;
+        }
+    }
+    BA_PROFILE_END(BA_PROFILE_GAIN);
 }
@@ -0,0 +1,241 @@
+/*
+    BackgroundAudio
+    Optional pump and frame timing statistics for the players and mixer
+
+    Copyright (c) 2025 Earle F. Philhower, III <earlephilhower@yahoo.com>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+#include <Arduino.h>
+
+// Define BACKGROUNDAUDIO_INSTRUMENT before including any BackgroundAudio header (in every file which
+// includes one) to have each player and the mixer time their pump() calls and frames.  Otherwise none
+// of this is built and the hooks cost nothing.
+#ifdef BACKGROUNDAUDIO_INSTRUMENT
+#include <atomic>
+#define BA_INSTRUMENT(x) x
+#else
+#define BA_INSTRUMENT(x)
+#endif
+
+#define BA_INSTRUMENT_BUCKETS 16
+
+/**
+    @brief Distribution of the CPU cycles taken by one kind of work
+*/
+typedef struct {
+    uint32_t count;
+    uint32_t min;
+    uint32_t max;
+    uint32_t ewma;              // Exponentially weighted moving average, each new sample weighted 1/16
+    uint32_t hist[BA_INSTRUMENT_BUCKETS]; // hist[n] counts 2^(n+8) <= cycles < 2^(n+9), hist[0] and hist[15] open ended
+} BackgroundAudioCycleStats;
+
+/**
+    @brief Timing of a player or mixer's pump, as returned by `getTiming`
+
+    @details
+    A pump runs whenever the output has room for more samples.  Its deadline is the moment the output
+    runs dry, i.e. the audio still queued in the output when it starts.  Slack is the time left over
+    when it finishes, and when it goes negative the output underflowed while the pump was working.
+    All times are in CPU cycles.
+*/
+typedef struct {
+    BackgroundAudioCycleStats pump;     // Each pump call
+    BackgroundAudioCycleStats frame;    // Each frame decoded or generated by a pump
+    uint32_t period;            // Cycles of audio in one output buffer at the current sample rate
+    int32_t slack;              // Slack of the most recent pump
+    int32_t minSlack;           // Smallest slack seen
+    uint32_t overruns;          // Pumps which finished after their deadline
+    uint32_t fill;              // Bytes queued in the output at the start of the most recent pump
+    uint32_t minFill;           // Smallest number of bytes queued at the start of a pump
+} BackgroundAudioTiming;
+
+#ifdef BACKGROUNDAUDIO_INSTRUMENT
+
+/**
+    @brief Collects `BackgroundAudioTiming` from inside a pump and lets the app read it consistently at any time
+
+    @details
+    Only the pump, running in the work IRQ or task, ever writes the statistics.  Every update is wrapped
+    in a sequence count (a seqlock) so `read` from `loop`, even on the other core, can simply retry
+    instead of ever having to block the pump.
+*/
+class BackgroundAudioInstrument {
+public:
+    BackgroundAudioInstrument() {
+        clear();
+    }
+
+    /**
+        @brief Set the output buffering used to calculate the fill and deadline, called from the owner's `begin`
+
+        @param [in] buffers Number of buffers in the output
+        @param [in] bufferWords Size of each buffer in 32-bit (one stereo sample) words
+    */
+    void setOutput(size_t buffers, size_t bufferWords) {
+        _capacity = buffers * bufferWords * 4;
+        _bufferWords = bufferWords;
+        _rate = 0;
+    }
+
+    /**
+        @brief Clear all the statistics at the start of the next pump.  Safe to call from the app at any time
+    */
+    void reset() {
+        _resetPending = true;
+    }
+
+    /**
+        @brief Get a consistent copy of the statistics
+
+        @param [out] t Filled in with the current statistics
+    */
+    void read(BackgroundAudioTiming *t) const {
+        uint32_t s;
+        do {
+            while ((s = _seq.load(std::memory_order_acquire)) & 1) {
+                /* Pump is updating, wait for it */
+            }
+            memcpy(t, &_t, sizeof(*t));
+            std::atomic_thread_fence(std::memory_order_acquire);
+        } while (_seq.load(std::memory_order_relaxed) != s);
+    }
+
+    /**
+        @brief Start timing a pump
+
+        @param [in] availableForWrite The output's free space, in bytes
+        @param [in] rate The current sample rate
+    */
+    inline void pumpBegin(int availableForWrite, int rate) {
+        if (_resetPending) {
+            _resetPending = false;
+            clear();
+        }
+        _pumpStart = cycles();
+        rate = rate > 0 ? rate : 44100; // Before the first frame is decoded
+        if (rate != _rate) {
+            _rate = rate;
+            _hz = cpuHz();
+            _period = (uint32_t)(((uint64_t)_bufferWords * _hz) / _rate);
+        }
+        _fill = _capacity > (size_t)availableForWrite ? _capacity - availableForWrite : 0;
+    }
+
+    /**
+        @brief Finish timing a pump and publish the results
+    */
+    inline void pumpEnd() {
+        uint32_t c = cycles() - _pumpStart;
+        int64_t deadline = ((uint64_t)(_fill / 4) * _hz) / _rate;
+        int64_t slack = deadline - c;
+        slack = std::max((int64_t)INT32_MIN, std::min((int64_t)INT32_MAX, slack));
+        writeBegin();
+        add(&_t.pump, c);
+        _t.period = _period;
+        _t.slack = (int32_t)slack;
+        _t.minSlack = std::min(_t.minSlack, (int32_t)slack);
+        if (slack < 0) {
+            _t.overruns++;
+        }
+        _t.fill = _fill;
+        _t.minFill = std::min(_t.minFill, (uint32_t)_fill);
+        writeEnd();
+    }
+
+    /**
+        @brief Start timing one frame inside a pump
+    */
+    inline void frameBegin() {
+        _frameStart = cycles();
+    }
+
+    /**
+        @brief Finish timing one frame inside a pump
+    */
+    inline void frameEnd() {
+        uint32_t c = cycles() - _frameStart;
+        writeBegin();
+        add(&_t.frame, c);
+        writeEnd();
+    }
+
+private:
+    // Only the pump writes, so the sequence count doesn't need an atomic increment (which the M0+ lacks)
+    inline void writeBegin() {
+        _seq.store(_seq.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+    }
+
+    inline void writeEnd() {
+        _seq.store(_seq.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+    void clear() {
+        writeBegin();
+        memset(&_t, 0, sizeof(_t));
+        _t.pump.min = UINT32_MAX;
+        _t.frame.min = UINT32_MAX;
+        _t.minSlack = INT32_MAX;
+        _t.minFill = UINT32_MAX;
+        _t.period = _period;
+        writeEnd();
+    }
+
+    static inline uint32_t cycles() {
+#ifdef ESP32
+        return ESP.getCycleCount();
+#else
+        return rp2040.getCycleCount();
+#endif
+    }
+
+    static uint32_t cpuHz() {
+#ifdef ESP32
+        return ESP.getCpuFreqMHz() * 1000000;
+#else
+        return rp2040.f_cpu();
+#endif
+    }
+
+    static inline void add(BackgroundAudioCycleStats *s, uint32_t c) {
+        if (!s->count) {
+            s->ewma = c;
+        } else {
+            s->ewma = (uint32_t)(s->ewma + (((int64_t)c - s->ewma) >> 4));
+        }
+        s->count++;
+        s->min = std::min(s->min, c);
+        s->max = std::max(s->max, c);
+        int b = (32 - __builtin_clz(c | 1)) - 9; // 2^(n+8) <= c < 2^(n+9)
+        s->hist[std::max(0, std::min(BA_INSTRUMENT_BUCKETS - 1, b))]++;
+    }
+
+    BackgroundAudioTiming _t;
+    std::atomic<uint32_t> _seq{0};
+    volatile bool _resetPending = false;
+    size_t _capacity = 0;
+    size_t _bufferWords = 0;
+    int _rate = 0;
+    uint32_t _hz = 1;
+    uint32_t _period = 0;
+    uint32_t _pumpStart = 0;
+    uint32_t _frameStart = 0;
+    size_t _fill = 0;
+};
+
+#endif
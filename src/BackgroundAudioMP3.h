@@ -24,6 +24,10 @@
 #include "WrappedAudioOutputBase.h"
 #include "BackgroundAudioGain.h"
 #include "BackgroundAudioBuffers.h"
+#include "BackgroundAudioInstrument.h"
+#include "BackgroundAudioTrace.h"
+#include "BackgroundAudioDispatch.h"
+#include "BackgroundAudioCommand.h"
 #include "libmad/config.h"
 #include "libmad/mad.h"
 
@@ -52,6 +56,17 @@ public:
         setDevice(&d);
     }
 
+    /**
+        @brief Construct an MP3 output device which will decode directly into the output's buffers
+
+        @param [in] d ZeroCopyAudioOutputBase device to send data to (i.e. AudioMixerInput)
+    */
+    BackgroundAudioMP3Class(ZeroCopyAudioOutputBase &d) {
+        _playing = false;
+        _paused = false;
+        setDevice(&d);
+    }
+
     ~BackgroundAudioMP3Class() {}
 
     /**
@@ -64,18 +79,35 @@ public:
     bool setDevice(AudioOutputBase *d) {
         if (!_playing) {
             _out = d;
+            _zc = nullptr;
+            return true;
+        }
+        return false;
+    }
+
+    /**
+        @brief Set an output device before `begin` which supports decoding in place
+
+        @param [in] d Pointer to `ZeroCopyAudioOutputBase` to synthesize decoded data into
+
+        @return True on success
+    */
+    bool setDevice(ZeroCopyAudioOutputBase *d) {
+        if (!_playing) {
+            _out = d;
+            _zc = d;
             return true;
         }
         return false;
     }
 
     /**
-            @brief Set the gain multiplier (volume) for the stream.  Takes effect immediately.
+            @brief Set the gain multiplier (volume) for the stream.  Ramps to it over the next frame decoded.
 
             @param [in] scale Floating point value from 0.0....16.0 to multiply all audio data by
     */
     void setGain(float scale) {
-        _gain = (int32_t)(scale * (1 << 16));
+        command(BA_COMMAND_GAIN, (int32_t)(scale * (1 << 16)));
     }
 
 
@@ -92,30 +124,25 @@ public:
         }
 
 #ifdef ARDUINO_ARCH_RP2040
-        _workIRQ = user_irq_claim_unused(true);
-        _workObj = this;
-        irq_set_exclusive_handler(_workIRQ, _irqStub);
-        irq_set_priority(_workIRQ, 0xc0); // Lowest prio
-        irq_set_enabled(_workIRQ, true);
+        BackgroundAudioDispatcher::attach(&_work, _out, 5 * framelen * 4);
 #endif
 
-        // MP3 processing init
-        mad_stream_init(&_stream);
-        mad_frame_init(&_frame);
-        mad_synth_init(&_synth);
-        mad_stream_options(&_stream, 0);
+        initDecoder();
 
         // We will use natural frame size to minimize mismatch
         _out->setBuffers(5, framelen);  // Framelen is in samples, but buffers takes words, which means 2 samples per word so we're good!
+        BA_INSTRUMENT(_instr.setOutput(5, framelen));
+        BA_TRACE_NAME(this, "MP3");
         _out->onTransmit(&_cb, (void *)this); // The pump we will use to generate our audio
         _out->setBitsPerSample(16);
         _out->setStereo(true);
         _out->setFrequency(44100);
         _out->begin();
 
-        // Stuff with silence to start
+        // Stuff with silence to start.  Zero-copy outputs (mixer legs) already play silence when empty,
+        // and leaving them untouched keeps their buffers frame-aligned so we can decode in place.
         uint16_t zeros[32] __attribute__((aligned(4))) = {};
-        while (_out->availableForWrite() > 32) {
+        while (!_zc && (_out->availableForWrite() > 32)) {
             _out->write((uint8_t *)zeros, sizeof(zeros));
         }
 
@@ -130,8 +157,7 @@ public:
     void end() {
         if (_playing) {
 #ifdef ARDUINO_ARCH_RP2040
-            irq_set_enabled(_workIRQ, false);
-            user_irq_unclaim(_workIRQ);
+            BackgroundAudioDispatcher::detach(&_work);
 #endif
             _out->end();
         }
@@ -166,7 +192,9 @@ public:
            @return Number of bytes written
     */
     size_t write(const void *data, size_t len) {
-        return _ib.write((const uint8_t *)data, len);
+        size_t ret = _ib.write((const uint8_t *)data, len);
+        BA_TRACE(BA_TRACE_WRITE, this, ret);
+        return ret;
     }
 
     /**
@@ -248,27 +276,45 @@ public:
     }
 
     /**
-           @brief Pause the decoder.  Won't process raw input data and will transmit silence
+        @brief Start playing the next data written at an exact mixer sample time
+
+        @details
+        Only supported when decoding to a `BackgroundAudioMixerInput` leg.  Any audio already queued on the
+        leg is dropped and the leg stays silent until `sampleTime`, when the first decoded sample is spliced
+        in.  Typically called after `flush` and before `write`ing the new MP3 file.
+
+        @param [in] sampleTime Mixer sample clock value, see `BackgroundAudioMixer::sampleTime`
+
+        @return True if the start was scheduled
+    */
+    bool startAt(uint64_t sampleTime) {
+        return _zc && _zc->startAt(sampleTime);
+    }
+
+    /**
+           @brief Pause the decoder.  Fades out over the next frame, then won't process raw input data and will transmit silence
     */
     void pause() {
-        _paused = true;
+        _pauseReq = true;
+        command(BA_COMMAND_PAUSE);
     }
 
     /**
         @brief Determine if the playback is paused
 
-        @return True of WAV playback has been paused
+        @return True of MP3 playback has been paused, even if the fade out hasn't happened yet
     */
     bool paused() {
-        return _paused;
+        return _pauseReq;
     }
 
 
     /**
-        @brief Unpause previously paused playback.  Will start processing input data again
+        @brief Unpause previously paused playback.  Will start processing input data again, fading in
     */
     void unpause() {
-        _paused = false;
+        _pauseReq = false;
+        command(BA_COMMAND_UNPAUSE);
     }
 
     /**
@@ -276,31 +322,153 @@ public:
 
             @details
             This is only needed to abort a currently playing MP3 file (i.e. skipping a track in the middle).
-            Multiple MP3 files can just be concatenated together in the input buffer with `write`
+            Multiple MP3 files can just be concatenated together in the input buffer with `write`.  Waits for
+            the decoder to finish its current frame, so data `write`n afterwards is kept.
+
+            Call it from the app (`loop`, a task, or a pipeline's worker), not from an interrupt or an output's
+            `onTransmit` callback, where the decoder can't run until the caller returns.  There it returns false at
+            once rather than hang, and on the RP2040 with the work IRQ masked it gives up after `timeoutMs`.
+
+            @param [in] timeoutMs Longest to wait for the decoder
+
+            @return True once flushed, false if it hadn't been by `timeoutMs` (it's still queued unless the queue was full)
     */
-    void flush() {
-        noInterrupts();
-        _ib.flush();
-        _accumShift = 0;
-        interrupts();
+    bool flush(uint32_t timeoutMs = BackgroundAudioCommandQueue::defaultTimeoutMs) {
+        uint32_t ticket = command(BA_COMMAND_FLUSH);
+        return ticket && _cmd.wait(ticket, timeoutMs);
     }
 
+    /**
+        @brief Jump to another place in the MP3 data.  Only for `ROMBackgroundAudioMP3`
+
+        @details
+        The RAM buffered player throws its data away as it decodes, so only the ROM player can seek.  Decoding
+        carries on from the first frame header at or after `pos`.  The frame or two after it may be silent, as
+        MP3 frames can borrow bits from the ones before them.  Like `flush` it waits for the decoder to finish its
+        current frame, and mustn't be called from an interrupt.
+
+        @param [in] pos Byte offset into the data given to `write`
+        @param [in] timeoutMs Longest to wait for the decoder
+
+        @return True if the decoder moved there, false if it can't seek, `pos` is past the end, or it timed out
+    */
+    bool seek(size_t pos, uint32_t timeoutMs = BackgroundAudioCommandQueue::defaultTimeoutMs) {
+        if (pos > INT32_MAX) {
+            return false;
+        }
+        uint32_t ticket = command(BA_COMMAND_SEEK, pos);
+        return ticket && _cmd.wait(ticket, timeoutMs) && _seekOK;
+    }
+
+    /**
+        @brief Sleep until every `setGain`, `pause`, `unpause`, `flush`, and `seek` so far has taken effect
+
+        @details
+        Control calls are queued for the decoder to apply between frames, so they never race with a frame
+        being decoded in the background.  This waits on them without spinning.
+
+        @param [in] timeoutMs Longest to wait
+
+        @return True if they were all applied, false on timeout
+    */
+    bool waitCommands(uint32_t timeoutMs = UINT32_MAX) {
+        return _cmd.wait(_cmd.last(), timeoutMs);
+    }
+
+    /**
+        @brief Decode straight into a buffer as fast as the CPU allows, with no output device or callbacks
+
+        @details
+        For transcoding, pre-rendering audio into flash or PSRAM, and tests.  Use instead of `begin`, not
+        alongside it: `write` the MP3 data (a RAM buffer can be topped up between calls) and call `render`
+        until it returns fewer samples than asked for.  The output is exactly what the player would have sent
+        to its output device, with the gain applied, as interleaved 16-bit stereo at `sampleRate`.
+
+        @param [out] dest Buffer for `samples` stereo samples, i.e. `samples * 2` int16_t
+        @param [in] samples Number of stereo samples wanted
+
+        @return Number of stereo samples written, fewer than `samples` only when the input ran out or playback is paused
+    */
+    size_t render(int16_t *dest, size_t samples) {
+        if (_playing) {
+            return 0; // The background pump owns the decoder
+        }
+        if (!_rendering) {
+            initDecoder();
+            _rendering = true;
+        }
+        size_t ret = 0;
+        while (ret < samples) {
+            if (_renderPos == _renderLen) {
+                applyCommands(true);
+                if (_paused || done()) {
+                    break;
+                }
+                _synth.pcm.out = _synth.pcm.samplesX;
+                generateOneFrame();
+                _renderPos = 0;
+                _renderLen = _synth.pcm.length;
+            }
+            size_t n = std::min(samples - ret, _renderLen - _renderPos);
+            memcpy(dest + ret * 2, _synth.pcm.samplesX[_renderPos], n * 2 * sizeof(int16_t));
+            _renderPos += n;
+            ret += n;
+        }
+        return ret;
+    }
+
+    /**
+        @brief Get the sample rate of the decoded audio, known once the first frame is decoded
+
+        @return Sample rate in hertz
+    */
+    int sampleRate() {
+        return _synth.pcm.samplerate;
+    }
+
+#ifdef BACKGROUNDAUDIO_INSTRUMENT
+    /**
+        @brief Get the pump and frame timing statistics.  Only built with BACKGROUNDAUDIO_INSTRUMENT defined
+
+        @param [out] t Filled in with a consistent snapshot of the statistics
+    */
+    void getTiming(BackgroundAudioTiming *t) {
+        _instr.read(t);
+    }
+
+    /**
+        @brief Clear the timing statistics, taking effect at the start of the next pump
+    */
+    void resetTiming() {
+        _instr.reset();
+    }
+#endif
+
 private:
 #ifdef ARDUINO_ARCH_RP2040
-    static void _irqStub() {
-        BackgroundAudioMP3Class<DataBuffer>::_workObj->pump();
+    static void _irqStub(void *ptr) {
+        ((BackgroundAudioMP3Class *)ptr)->pump();
     }
 
     static void _cb(void *ptr) {
+        BA_TRACE(BA_TRACE_CALLBACK, ptr, 0);
         // Don't actually do work in the DMA interrupt, do it in the work IRQ context (low prio)
-        irq_set_pending(BackgroundAudioMP3Class<DataBuffer>::_workIRQ);
+        BackgroundAudioDispatcher::post(&((BackgroundAudioMP3Class *)ptr)->_work);
     }
 #else
     static void _cb(void *ptr) {
+        BA_TRACE(BA_TRACE_CALLBACK, ptr, 0);
         ((BackgroundAudioMP3Class*)ptr)->pump();
     }
 #endif
 
+    void initDecoder() {
+        mad_stream_init(&_stream);
+        mad_frame_init(&_frame);
+        mad_synth_init(&_synth);
+        mad_stream_options(&_stream, 0);
+    }
+
     void generateOneFrame() {
         // Every frame requires shifting all remaining data (6K?) before processing.
         // We're not decoding MP3s, we're shifting data!  Instead, scroll down and only
@@ -318,6 +486,7 @@ private:
         }
 
         // Try and find a frame header to send in.  Should be a single check in most cases since we should be aligned after the 1st frame
+        BA_PROFILE_BEGIN(BA_PROFILE_SYNC);
         int ptr = 0;
         int pend = _ib.available() - 1 - _accumShift;
         const uint8_t *b = _ib.buffer() + _accumShift;
@@ -329,16 +498,21 @@ private:
                 break;
             }
         }
+        BA_PROFILE_END(BA_PROFILE_SYNC);
         if (!found) {
             // Couldn't find a header at all, the entire buffer is junk so dump it
             _accumShift = 0;
+            BA_TRACE(BA_TRACE_SHIFT_BEGIN, this, _ib.available());
             _ib.shiftUp(_ib.available());
+            BA_TRACE(BA_TRACE_SHIFT_END, this, 0);
             _dumps++;
         }
 
         // If we accumulate too large of a shift, actually do the shift so more space for writer
         if (_accumShift > _ib.size() / 2) {
+            BA_TRACE(BA_TRACE_SHIFT_BEGIN, this, _accumShift);
             _ib.shiftUp(_accumShift);
+            BA_TRACE(BA_TRACE_SHIFT_END, this, 0);
             _accumShift = 0;
             _shifts++;
         }
@@ -347,6 +521,7 @@ private:
         if (_ib.available() - _accumShift < MAD_BUFFER_GUARD) {
             _ib.write0(MAD_BUFFER_GUARD);
             _underflows++;
+            BA_TRACE(BA_TRACE_UNDERFLOW, this, 0);
         }
 
         // Pass the new buffer information to libmad.
@@ -363,42 +538,143 @@ private:
         // Only stereo for sanity
         if (_synth.pcm.channels == 1) {
             for (size_t i = 0; i < framelen; i++) {
-                _synth.pcm.samplesX[i][1] = _synth.pcm.samplesX[i][0];
+                _synth.pcm.out[i][1] = _synth.pcm.out[i][0];
+            }
+        }
+
+        applyGain((int16_t*)_synth.pcm.out, framelen * 2);
+    }
+
+    // Queue a control call for the pump, or apply it now when nothing else is decoding: not started, rendering
+    // offline, or called on a pipeline's worker between frames.  Returns 0 if the queue stayed full
+    uint32_t command(uint8_t op, int32_t arg = 0) {
+        uint32_t ticket;
+        while (!(ticket = _cmd.post(op, arg))) {
+            if (_playing || _cmd.drainedElsewhere()) {
+                // The pump or a pipeline's worker will make room, unless this is an IRQ it can't preempt
+                if (!_cmd.wait(_cmd.last(), BackgroundAudioCommandQueue::defaultTimeoutMs)) {
+                    return 0;
+                }
+            } else {
+                applyCommands(false);
             }
         }
+        if (!_playing && !_cmd.drainedElsewhere()) {
+            applyCommands(_rendering);
+        }
+        return ticket;
+    }
 
-        ApplyGain((int16_t*)_synth.pcm.samplesX, framelen * 2, _gain);
+    // Between frames, apply what the app asked for.  With `ramp` gain and pause changes fade over the next frame
+    void applyCommands(bool ramp) {
+        _cmd.drain([this, ramp](uint8_t op, int32_t arg) {
+            switch (op) {
+            case BA_COMMAND_FLUSH:
+                _ib.flush();
+                _accumShift = 0;
+                _renderPos = _renderLen;
+                break;
+            case BA_COMMAND_SEEK:
+                _seekOK = _ib.seek(arg);
+                if (_seekOK) {
+                    _accumShift = 0;
+                    _renderPos = _renderLen;
+                    // Start over from there, with no borrowed bits or filter state from the frames before
+                    _stream.buffer = nullptr;
+                    _stream.md_len = 0;
+                    mad_frame_mute(&_frame);
+                    mad_synth_mute(&_synth);
+                    _synth.phase = 0;
+                }
+                break;
+            case BA_COMMAND_PAUSE:
+                if (ramp && !_paused) {
+                    _pausing = true;
+                } else {
+                    _paused = true;
+                    _rampFrom = 0;
+                }
+                break;
+            case BA_COMMAND_UNPAUSE:
+                _paused = false;
+                _pausing = false;
+                if (!ramp) {
+                    _rampFrom = _gain;
+                }
+                break;
+            case BA_COMMAND_GAIN:
+                _gain = arg;
+                if (!ramp && !_paused) {
+                    _rampFrom = arg;
+                }
+                break;
+            }
+        });
+    }
+
+    // Gain for this frame, sliding from the last frame's after a change or pause so it doesn't click
+    void applyGain(int16_t *samples, size_t count) {
+        int32_t to = _pausing ? 0 : _gain;
+        ApplyGainRamp(samples, count, _rampFrom, to);
+        _rampFrom = to;
+        if (_pausing) {
+            _pausing = false;
+            _paused = true;
+        }
     }
 
 #ifdef ARDUINO_ARCH_RP2040
 public:
 #endif
     void pump() {
+        BA_INSTRUMENT(_instr.pumpBegin(_out->availableForWrite(), _synth.pcm.samplerate));
+        BA_TRACE(BA_TRACE_PUMP_BEGIN, this, _out->availableForWrite());
         while (_out->availableForWrite() >= (int)(framelen * 4)) {
+            applyCommands(true);
+            // Synthesize straight into the output's buffer when it has room for a full frame
+            size_t words = 0;
+            _synth.pcm.out = _zc ? (int16_t (*)[2])_zc->acquireWriteBuffer(&words) : nullptr;
+            if (words < framelen) {
+                _synth.pcm.out = _synth.pcm.samplesX;
+            }
             if (_paused) {
-                bzero(_synth.pcm.samplesX, _synth.pcm.length * 4);
+                bzero(_synth.pcm.out, _synth.pcm.length * 4);
             } else {
+                BA_INSTRUMENT(_instr.frameBegin());
+                BA_TRACE(BA_TRACE_FRAME_BEGIN, this, 0);
                 generateOneFrame();
+                BA_TRACE(BA_TRACE_FRAME_END, this, 0);
+                BA_INSTRUMENT(_instr.frameEnd());
                 if (_synth.pcm.samplerate) {
                     _out->setFrequency(_synth.pcm.samplerate);
                 }
             }
-            assert(_out->write((uint8_t *)_synth.pcm.samplesX, _synth.pcm.length * 4) == _synth.pcm.length * 4);
+            if (_synth.pcm.out == _synth.pcm.samplesX) {
+                assert(_out->write((uint8_t *)_synth.pcm.samplesX, _synth.pcm.length * 4) == _synth.pcm.length * 4);
+            } else {
+                _zc->commitWriteBuffer(_synth.pcm.length);
+            }
         }
-#ifdef ARDUINO_ARCH_RP2040
-        irq_clear(_workIRQ);
-#endif
+        BA_TRACE(BA_TRACE_PUMP_END, this, 0);
+        BA_INSTRUMENT(_instr.pumpEnd());
     }
 
 #ifdef ARDUINO_ARCH_RP2040
-    static uint8_t _workIRQ;
-    static BackgroundAudioMP3Class<DataBuffer> *_workObj;
+    BackgroundAudioWork _work{_irqStub, this};
 #endif
 
 private:
     AudioOutputBase *_out;
+    ZeroCopyAudioOutputBase *_zc = nullptr;
     bool _playing = false;
     bool _paused = false;
+    bool _pausing = false;      // Fading out for a pause over the next frame
+    bool _pauseReq = false;     // What the app last asked for
+    bool _rendering = false;
+    volatile bool _seekOK = false;
+    size_t _renderPos = 0;      // Next sample of the last rendered frame to return
+    size_t _renderLen = 0;
+    BackgroundAudioCommandQueue _cmd;
 
     static const size_t framelen = 1152;
     static const size_t maxFrameSize = 2881;
@@ -407,7 +683,11 @@ private:
     struct mad_frame _frame;
     struct mad_synth _synth;
     int32_t _gain = 1 << 16;
+    int32_t _rampFrom = 1 << 16;  // Gain the last frame ended at
     uint32_t _accumShift = 0;
+#ifdef BACKGROUNDAUDIO_INSTRUMENT
+    BackgroundAudioInstrument _instr;
+#endif
 
     // MP3 quality stats, cumulative
     uint32_t _frames = 0;
@@ -417,11 +697,6 @@ private:
     uint32_t _dumps = 0;
 };
 
-#ifdef ARDUINO_ARCH_RP2040
-template<class DataBuffer> uint8_t BackgroundAudioMP3Class<DataBuffer>::_workIRQ;
-template<class DataBuffer> BackgroundAudioMP3Class<DataBuffer> *BackgroundAudioMP3Class<DataBuffer>::_workObj;
-#endif
-
 /**
     @brief General purpose MP3 background player with an 8KB buffer.  Needs to have `write` called repeatedly with data.
 */
@@ -22,7 +22,11 @@
 #pragma once
 #include <Arduino.h>
 #include "WrappedAudioOutputBase.h"
+#include "BackgroundAudioProfile.h"
+#include "BackgroundAudioInstrument.h"
+#include "BackgroundAudioTrace.h"
 #include <vector>
+#include <math.h>
 
 /**
     @brief Implements an emulated AudioOutputBase and feeds resampled data from it up to an input of an `AudioOutputMixer` object.
@@ -36,7 +40,7 @@
 
     In general an end user never need use this class directly and can just treat the input leg of the mixer as an ordinary audio output.
 */
-class BackgroundAudioMixerInput : public AudioOutputBase {
+class BackgroundAudioMixerInput : public ZeroCopyAudioOutputBase {
 private:
     // Forward definitions
     template<size_t> friend class BackgroundAudioMixer;
@@ -56,6 +60,21 @@ public:
         _inputRate = outputRate;
         _running = false;
         _cb = nullptr;
+        _gain = 1.0f;
+        _pan = 0.0f;
+        _rampMS = 20;
+        for (int c = 0; c < 2; c++) {
+            _gainTarget[c] = 1 << 16;
+            _gainNow[c] = 1 << 16;
+            _mixGain[c] = 1 << 16;
+        }
+        _gainStep = 1 << 16;
+        _duckGain = 1 << 16;
+        _active = false;
+        _scheduled = false;
+        _startPending = false;
+        _acquired = false;
+        _startTime = 0;
     }
 
     virtual ~BackgroundAudioMixerInput() {
@@ -165,6 +184,7 @@ public:
         // The offset in the filled buffer to use next for sending to mixer
         _readOff = 0;
         setFrequency(_outputRate);
+        BA_TRACE_NAME(this, "Mixer input");
 
         _running = true;
 
@@ -228,6 +248,9 @@ public:
         if (!_running) {
             return 0;
         }
+        if (_release()) {
+            return size; // The frame that was to go in the abandoned region is from before the start, drop it too
+        }
         size_t words = size / sizeof(uint32_t);
         while (words) {
             AudioBuffer **volatile p = &_empty;
@@ -239,16 +262,77 @@ public:
             memcpy(&((*p)->buff[_userOff]), buffer, toWrite * sizeof(uint32_t));
             buffer += toWrite * sizeof(uint32_t);
             written += toWrite;
-            _userOff += toWrite;
             words -= toWrite;
-            if (_userOff == _wordsPerBuffer) {
-                _addToList(&_filled, _takeFromList(p));
-                _userOff = 0;
-            }
+            _advanceUserOff(toWrite);
         }
         return written * sizeof(uint32_t);
     }
 
+    /**
+        @brief Get direct access to the remainder of the resample buffer currently being filled
+
+        @details
+        Allows a decoder to render its output in place instead of using `write`, saving a copy of every sample.
+
+        @param [out] words Number of 32-bit words which can be written contiguously at the returned pointer
+
+        @return Pointer into the resample buffer, or `nullptr` if no buffers are empty
+    */
+    virtual uint32_t *acquireWriteBuffer(size_t *words) override {
+        _release(); // Only one region at a time, so any earlier one was abandoned
+        if (!_running || !_empty) {
+            *words = 0;
+            return nullptr;
+        }
+        *words = _wordsPerBuffer - _userOff;
+        _acquired = true;
+        return &_empty->buff[_userOff];
+    }
+
+    /**
+        @brief Hand samples rendered into the region from `acquireWriteBuffer` over to the mixer
+
+        @param [in] words Number of 32-bit words actually written
+    */
+    virtual void commitWriteBuffer(size_t words) override {
+        if (_running && _empty && _acquired) {
+            _advanceUserOff(std::min(words, _wordsPerBuffer - _userOff));
+        }
+        _release();
+    }
+
+    /**
+        @brief Start playing the next data written at an exact mixer sample time
+
+        @details
+        Any data already queued on this leg is thrown away and the leg outputs silence, without asking its
+        source for more data, until the mixer block containing `sampleTime`.  The first new sample is then
+        spliced in at exactly that offset in the block.  Legs started at the same time stay in lockstep.
+
+        Call this before writing the data to be scheduled, and write it at least one mixer block before
+        `sampleTime` so it can be generated in time.  A time already in the past starts on the next block.
+        If a decoder on another core has a region from `acquireWriteBuffer` it is still writing, the buffers
+        aren't touched until it's committed, and that frame is then dropped along with the rest.
+
+        @param [in] sampleTime Mixer sample clock value, see `BackgroundAudioMixer::sampleTime`
+
+        @return True if the start was scheduled
+    */
+    virtual bool startAt(uint64_t sampleTime) override {
+        if (!_running) {
+            return false;
+        }
+        noInterrupts();
+        _startTime = sampleTime;
+        if (_acquired) {
+            _startPending = true;
+        } else {
+            _restart();
+        }
+        interrupts();
+        return true;
+    }
+
     /**
         @brief Determine the number of bytes we can write to the resample buffers at this instant
 
@@ -268,10 +352,117 @@ public:
             avail += _wordsPerBuffer;
             x = x->next;
         }
-        return avail;
+        return avail * sizeof(uint32_t);
+    }
+
+    /**
+        @brief Set the mix level of this input leg.  Can be called while running.
+
+        @details
+        The change is not applied instantly, but ramped linearly over the time set by `setRampTime` inside
+        the mixer's summing loop, so there is no zipper noise or click.  Boosting a quiet source should be
+        done with the decoder's own `setGain`, the mixer leg level only attenuates.
+
+        @param [in] scale Linear level from 0.0 (mute) to 1.0 (full level)
+    */
+    void setGain(float scale) {
+        _gain = std::min(1.0f, std::max(0.0f, scale));
+        _updateGainTarget();
+    }
+
+    /**
+        @brief Set the left/right balance of this input leg.  Can be called while running.
+
+        @details
+        A balance law is used, so the center position plays both channels at full level (identical to
+        an unpanned leg) and moving to one side progressively attenuates the opposite channel.  Changes
+        are ramped just like `setGain`.
+
+        @param [in] pan -1.0 for full left, 0.0 for center, 1.0 for full right
+    */
+    void setPan(float pan) {
+        _pan = std::min(1.0f, std::max(-1.0f, pan));
+        _updateGainTarget();
+    }
+
+    /**
+        @brief Set the ramp time used for subsequent `setGain` and `setPan` changes
+
+        @param [in] ms Time in milliseconds to go from the current level to the new one
+    */
+    void setRampTime(int ms) {
+        _rampMS = std::max(0, ms);
     }
 
 private:
+    // Drop everything queued and wait for _startTime.  Called with interrupts disabled
+    void _restart() {
+        while (_filled) {
+            auto x = _filled;
+            _filled = x->next;
+            x->next = _empty;
+            _empty = x;
+        }
+        _userOff = 0;
+        _readOff = 0;
+        _scheduled = true;
+        _startPending = false;
+    }
+
+    // The acquired region is done with, so apply any start that was waiting on it.  Returns true if one was
+    bool _release() {
+        noInterrupts();
+        bool pending = _startPending;
+        _acquired = false;
+        if (pending) {
+            _restart();
+        }
+        interrupts();
+        return pending;
+    }
+
+    void _advanceUserOff(size_t words) {
+        _userOff += words;
+        if (_userOff == _wordsPerBuffer) {
+            _addToList(&_filled, _takeFromList(&_empty));
+            _userOff = 0;
+        }
+    }
+
+    void _updateGainTarget() {
+        int32_t l = (int32_t)(_gain * (_pan > 0.0f ? 1.0f - _pan : 1.0f) * (1 << 16));
+        int32_t r = (int32_t)(_gain * (_pan < 0.0f ? 1.0f + _pan : 1.0f) * (1 << 16));
+        int32_t blocks = (int32_t)(((int64_t)_rampMS * _outputRate) / (1000 * (int64_t)_outputBufferWords));
+        // The mixer reads the targets and step together in its IRQ, so they're published as one
+        noInterrupts();
+        // Step so the larger of the two channel moves completes in _rampMS, in per-mixer-block units
+        int32_t delta = std::max(abs(l - _gainNow[0]), abs(r - _gainNow[1]));
+        _gainStep = std::max(1, delta / std::max(1, (int)blocks));
+        _gainTarget[0] = l;
+        _gainTarget[1] = r;
+        interrupts();
+        if (!_running) {
+            // Nothing playing yet, so start directly at the requested level
+            for (int c = 0; c < 2; c++) {
+                _gainNow[c] = _gainTarget[c];
+                _mixGain[c] = _gainTarget[c];
+            }
+        }
+    }
+
+    /**
+        @brief Move the user level one mixer block closer to its target.  Called by the mixer from the pump context
+    */
+    void _advanceGain() {
+        for (int c = 0; c < 2; c++) {
+            if (_gainNow[c] < _gainTarget[c]) {
+                _gainNow[c] = std::min(_gainTarget[c], _gainNow[c] + _gainStep);
+            } else if (_gainNow[c] > _gainTarget[c]) {
+                _gainNow[c] = std::max(_gainTarget[c], _gainNow[c] - _gainStep);
+            }
+        }
+    }
+
     void _addToList(AudioBuffer **list, AudioBuffer *element) {
         noInterrupts();
         // Find end of list, if any
@@ -302,13 +493,35 @@ private:
         delete ab;
     }
 
-    uint32_t *getResampledBuffer() {
+    uint32_t *getResampledBuffer(uint64_t when) {
+        size_t start = 0;
+        if (_scheduled) {
+            if (_startTime >= when + _outputBufferWords) {
+                // Not this block yet.  Hold silence without consuming anything, but give sources which
+                // decode in a deferred IRQ one block's time to have the start of their data ready
+                if (!_filled && _cb && (_startTime < when + 2 * _outputBufferWords)) {
+                    _cb(_cbData);
+                }
+                for (size_t i = 0; i < _outputBufferWords; i++) {
+                    _outputBuffer[i] = _silenceSample;
+                }
+                return _outputBuffer;
+            }
+            // Splice the first sample in at the requested offset
+            start = (_startTime > when) ? (size_t)(_startTime - when) : 0;
+            for (size_t i = 0; i < start; i++) {
+                _outputBuffer[i] = _silenceSample;
+            }
+            _scheduled = false;
+        }
+
         // Prime the pump when we're all out of frames
         if (!_filled && _cb) {
             _cb(_cbData);
         }
 
         if (!_filled) {
+            BA_TRACE(BA_TRACE_UNDERFLOW, this, _outputBufferWords);
             for (size_t i = 0; i < _outputBufferWords; i++) {
                 _outputBuffer[i] = _silenceSample;
                 _underflow = true;
@@ -316,9 +529,9 @@ private:
             return _outputBuffer;  // Nothing to send in but the sound of silence...
         }
 
-        uint32_t *p = _outputBuffer;
+        uint32_t *p = _outputBuffer + start;
         if (_outputRate == _inputRate) {
-            for (size_t i = 0; i < _outputBufferWords; i++) {
+            for (size_t i = start; i < _outputBufferWords; i++) {
                 if (_readOff == _wordsPerBuffer) {
                     _addToList(&_empty, _takeFromList(&_filled));
                     _readOff = 0;
@@ -331,9 +544,12 @@ private:
                 }
                 *(p++) = _filled ? _filled->buff[_readOff++] : _silenceSample;
             }
+            if (!_filled) {
+                BA_TRACE(BA_TRACE_UNDERFLOW, this, 0);
+            }
         } else {
             // _readOff will be a 16p16 fixed point
-            for (size_t i = 0; i < _outputBufferWords; i++) {
+            for (size_t i = start; i < _outputBufferWords; i++) {
                 while (_readOff >= _wordsPerBuffer << 16) {
                     _addToList(&_empty, _takeFromList(&_filled));
                     _readOff -= _wordsPerBuffer << 16;
@@ -349,6 +565,9 @@ private:
                     _readOff += _resample16p16;
                 }
             }
+            if (!_filled) {
+                BA_TRACE(BA_TRACE_UNDERFLOW, this, 0);
+            }
         }
         return _outputBuffer;
     }
@@ -375,6 +594,23 @@ private:
     uint32_t *_outputBuffer;
     void (*_cb)(void *);
     void *_cbData;
+
+    // Leg level control, all evaluated by the mixer once per output block
+    float _gain;
+    float _pan;
+    int _rampMS;
+    int32_t _gainTarget[2]; // User-requested L/R level, 16.16
+    int32_t _gainNow[2];    // User L/R level at the end of the current block, ramping towards _gainTarget
+    int32_t _gainStep;      // Per-block ramp increment of _gainNow
+    int32_t _duckGain;      // Product of all active ducking rules targeting this leg, 16.16
+    int32_t _mixGain[2];    // Final L/R level applied at the start of the next block
+    bool _active;           // True if the last mixed block was not digital silence
+
+    // Scheduled start, see startAt
+    bool _scheduled;
+    bool _startPending;     // startAt called while a region was acquired, applied when it's released
+    bool _acquired;         // A region from acquireWriteBuffer hasn't been committed yet
+    uint64_t _startTime;
 };
 
 
@@ -392,6 +628,11 @@ private:
     `BackgroundAudioMixer` so all the mixer here has to do is sum up all its legs and send the result
     out to the real hardware (I2S or PWM).
 
+    The legs are summed into a 32-bit headroom bus which is then passed through a lookahead peak
+    limiter before conversion to 16 bits, so several loud legs will be smoothly turned down instead
+    of hard clipping.  The limiter adds `limiterLookahead` samples of latency.  Defining
+    `BACKGROUNDAUDIO_MIXER_HARDCLIP` before including this header restores the cheaper hard clip.
+
     @tparam _outWords Number of 32-bit (one stereo 16-bit sample) words to use for the summing buffer
 */
 template<size_t _outWords = 512>
@@ -408,6 +649,12 @@ public:
         _out = &d;
         _outRate = outputRate;
         _running = false;
+        _sampleTime = 0;
+#ifndef BACKGROUNDAUDIO_MIXER_HARDCLIP
+        bzero(_bus, sizeof(_bus));
+        _limitGain = 1 << 16;
+        setLimiterRelease(100);
+#endif
     }
 
     ~BackgroundAudioMixer() { /* Noop */
@@ -427,6 +674,81 @@ public:
         return x;
     }
 
+    /**
+        @brief Automatically lower (duck) one leg while another is producing sound.  Only legal before `begin`
+
+        @details
+        Whenever the `trigger` leg outputs anything but digital silence the `target` leg is ramped down
+        by `dB` over `rampMS` milliseconds.  Once the trigger has been silent for `holdMS` milliseconds the
+        target ramps back up over the same time.  This is typically used to lower music under a spoken
+        announcement.  Ramps are evaluated inside the mixer summing loop so no additional passes over the
+        audio data are required.  Multiple rules may target the same leg, their attenuations multiply.
+
+        @param [in] trigger Leg whose activity causes the ducking
+        @param [in] target Leg to be attenuated
+        @param [in] dB Attenuation to apply, i.e. -12.0
+        @param [in] rampMS Time in milliseconds to ramp down (and back up)
+        @param [in] holdMS Time in milliseconds the trigger must be silent before the target is restored
+
+        @return True on success
+    */
+    bool duck(BackgroundAudioMixerInput *trigger, BackgroundAudioMixerInput *target, float dB, int rampMS = 50, int holdMS = 250) {
+        if (_running || !trigger || !target || (trigger == target)) {
+            return false;
+        }
+        DuckRule d;
+        d.trigger = trigger;
+        d.target = target;
+        d.depth = (int32_t)(powf(10.0f, std::min(0.0f, dB) / 20.0f) * (1 << 16));
+        int32_t blocks = std::max(1, (int)(((int64_t)rampMS * _outRate) / (1000 * (int64_t)_outWords)));
+        d.step = std::max(1, (int)(((1 << 16) - d.depth) / blocks));
+        d.hold = ((int64_t)holdMS * _outRate) / (1000 * (int64_t)_outWords);
+        d.holdCount = 0;
+        d.level = 1 << 16;
+        _duck.push_back(d);
+        return true;
+    }
+
+    /**
+        @brief Get the mixer's sample clock, used to schedule legs with `BackgroundAudioMixerInput::startAt`
+
+        @details
+        The clock counts stereo samples at the mixer output rate since `begin`.  The value returned is the
+        time of the first sample of the next block to be mixed, so any time at or after it can still be
+        hit exactly.  Everything mixed is heard after the same fixed output latency, so legs scheduled
+        against this clock are synchronized with each other.
+
+        @return Sample time of the next block to be mixed
+    */
+    uint64_t sampleTime() {
+        noInterrupts();
+        uint64_t t = _sampleTime;
+        interrupts();
+        return t;
+    }
+
+#ifndef BACKGROUNDAUDIO_MIXER_HARDCLIP
+    /**
+        @brief Set the time the output limiter takes to recover after a peak
+
+        @details
+        The limiter attack always completes within its lookahead window, so no samples exceed full scale.
+        The release is a linear ramp back to unity gain.  Shorter times recover loudness faster but can
+        cause audible "pumping" on dense mixes.
+
+        @param [in] ms Time in milliseconds to ramp from fully limited back to unity gain
+    */
+    void setLimiterRelease(int ms) {
+        int32_t blocks = (int32_t)(((int64_t)std::max(1, ms) * _outRate) / (1000 * (int64_t)limiterLookahead));
+        _limitRelease = std::max(1, (int)((1 << 16) / std::max(1, (int)blocks)));
+    }
+
+    /**
+        @brief Number of stereo samples of lookahead (and added latency) in the output limiter
+    */
+    static constexpr size_t limiterLookahead = 32;
+#endif
+
     /**
           @brief Start the mixer and attached physical interface
 
@@ -444,6 +766,8 @@ public:
 
         // We will use natural frame size to minimize mismatch
         _out->setBuffers(4, _outWords);        // Framelen is in samples, but buffers takes words, which means 2 samples per word so we're good!
+        BA_INSTRUMENT(_instr.setOutput(4, _outWords));
+        BA_TRACE_NAME(this, "Mixer");
         _out->onTransmit(&_cb, (void *)this);  // The pump we will use to generate our audio
         _out->setBitsPerSample(16);
         _out->setStereo(true);
@@ -461,52 +785,261 @@ public:
         return true;
     }
 
+#ifdef BACKGROUNDAUDIO_INSTRUMENT
+    /**
+        @brief Get the pump and frame timing statistics.  Only built with BACKGROUNDAUDIO_INSTRUMENT defined
+
+        @param [out] t Filled in with a consistent snapshot of the statistics
+    */
+    void getTiming(BackgroundAudioTiming *t) {
+        _instr.read(t);
+    }
+
+    /**
+        @brief Clear the timing statistics, taking effect at the start of the next pump
+    */
+    void resetTiming() {
+        _instr.reset();
+    }
+#endif
+
 private:
     /**
         @brief C-language shim to convert to an object-based callback
     */
     static void _cb(void *ptr) {
+        BA_TRACE(BA_TRACE_CALLBACK, ptr, 0);
         ((BackgroundAudioMixer *)ptr)->pump();
     }
 
     /**
         @brief Generate a single frame worth of stereo samples by combining all inputs
+
+        @details
+        Per-leg levels (user gain, pan, and ducking) are computed once per block and linearly
+        interpolated across it inside the summing loop, so level changes never need a separate pass.
     */
     void generateOneFrame() {
+        const size_t legs = _input.size();
+#ifdef BACKGROUNDAUDIO_MIXER_HARDCLIP
+        int16_t *dest = _outBuff;
+#else
+        int32_t *dest = &_bus[limiterLookahead * 2]; // Newest data goes after the lookahead tail of the last block
+#endif
+
         // Collect all the input leg buffers
-        int16_t *leg[_input.size()];
-        for (size_t i = 0; i < _input.size(); i++) {
-            leg[i] = (int16_t *)_input[i]->getResampledBuffer();
+        int16_t *leg[legs];
+        for (size_t i = 0; i < legs; i++) {
+            leg[i] = (int16_t *)_input[i]->getResampledBuffer(_sampleTime);
+            _input[i]->_advanceGain();
+            _input[i]->_duckGain = 1 << 16;
+        }
+
+        // Evaluate the ducking rules based on the trigger's activity in the prior block
+        for (auto &d : _duck) {
+            if (d.trigger->_active) {
+                d.holdCount = d.hold;
+            } else if (d.holdCount) {
+                d.holdCount--;
+            }
+            int32_t want = (d.trigger->_active || d.holdCount) ? d.depth : 1 << 16;
+            if (d.level > want) {
+                d.level = std::max(want, d.level - d.step);
+            } else if (d.level < want) {
+                d.level = std::min(want, d.level + d.step);
+            }
+            d.target->_duckGain = ((int64_t)d.target->_duckGain * d.level) >> 16;
+        }
+
+        // Calculate the start level and per-sample increment for every leg in this block
+        int32_t gain[legs][2];
+        int32_t step[legs][2];
+        int32_t nonzero[legs];
+        bool unity = true;
+        for (size_t j = 0; j < legs; j++) {
+            auto in = _input[j];
+            for (int c = 0; c < 2; c++) {
+                int32_t end = ((int64_t)in->_gainNow[c] * in->_duckGain) >> 16;
+                gain[j][c] = in->_mixGain[c];
+                step[j][c] = (end - in->_mixGain[c]) / (int32_t)_outWords;
+                in->_mixGain[c] = end;
+                if ((gain[j][c] != 1 << 16) || (end != 1 << 16)) {
+                    unity = false;
+                }
+            }
+            nonzero[j] = 0;
+        }
+
+        BA_PROFILE_BEGIN(BA_PROFILE_MIX);
+        if (unity) {
+            // Sum them up onto the bus
+            for (size_t i = 0; i < _outWords * 2; i++) {
+                int32_t sum = 0;
+                for (size_t j = 0; j < legs; j++) {
+                    sum += leg[j][i];
+                    nonzero[j] |= leg[j][i];
+                }
+                _store(dest, i, sum);
+            }
+        } else {
+            // Scale, sum, and ramp levels one stereo sample at a time
+            for (size_t i = 0; i < _outWords * 2; i += 2) {
+                int32_t sumL = 0;
+                int32_t sumR = 0;
+                for (size_t j = 0; j < legs; j++) {
+                    int32_t l = leg[j][i];
+                    int32_t r = leg[j][i + 1];
+                    nonzero[j] |= l | r;
+                    sumL += (l * gain[j][0]) >> 16;
+                    sumR += (r * gain[j][1]) >> 16;
+                    gain[j][0] += step[j][0];
+                    gain[j][1] += step[j][1];
+                }
+                _store(dest, i, sumL);
+                _store(dest, i + 1, sumR);
+            }
+        }
+        BA_PROFILE_END(BA_PROFILE_MIX);
+
+        for (size_t j = 0; j < legs; j++) {
+            _input[j]->_active = nonzero[j] != 0;
         }
+        _sampleTime += _outWords;
 
-        // Sum them up with saturating arithmetic
-        for (size_t i = 0; i < _outWords * 2; i++) {
-            int32_t sum = 0;
-            for (size_t j = 0; j < _input.size(); j++) {
-                sum += leg[j][i];
+#ifndef BACKGROUNDAUDIO_MIXER_HARDCLIP
+        BA_PROFILE_BEGIN(BA_PROFILE_LIMIT);
+        _limit();
+        BA_PROFILE_END(BA_PROFILE_LIMIT);
+#endif
+    }
+
+    /**
+        @brief Store a summed sample directly to the 16-bit output with saturating arithmetic
+    */
+    static inline void _store(int16_t *dest, size_t i, int32_t sum) {
+        if (sum > 32767) {
+            sum = 32767;
+        } else if (sum < -32767) {
+            sum = -32767;
+        }
+        dest[i] = (int16_t)sum;
+    }
+
+    /**
+        @brief Store a summed sample on the 32-bit headroom bus for the limiter to process
+    */
+    static inline void _store(int32_t *dest, size_t i, int32_t sum) {
+        dest[i] = sum;
+    }
+
+#ifndef BACKGROUNDAUDIO_MIXER_HARDCLIP
+    /**
+        @brief Block-based lookahead peak limiter converting the headroom bus into 16-bit output
+
+        @details
+        The bus holds `limiterLookahead` stereo samples left over from the prior frame followed by the
+        new frame.  The `_outWords` samples to output are split into blocks of `limiterLookahead` samples
+        (the last one short if the frame isn't a multiple of it), followed by the lookahead tail which is
+        always exactly the last `limiterLookahead` samples on the bus.  That tail becomes block 0 of the
+        next frame, so every sample is checked before it is output.  The gain needed to keep each block's
+        peak at full scale is calculated.  While outputting a block the gain is ramped linearly
+        to the lower of its own and the following block's requirement, so the attack is complete before
+        any peak is output.  Release is a linear ramp of `_limitRelease` per block back towards unity.
+        Because the applied gain never exceeds what the block's own peak allows, the products always fit
+        in 32 bits and no final clipping is needed.
+    */
+    void _limit() {
+        const size_t blocks = (_outWords + limiterLookahead - 1) / limiterLookahead;
+        int32_t need[blocks + 1];
+
+        // Gain computer, one required gain per block (plus the lookahead tail, whatever the frame size)
+        bool over = false;
+        for (size_t b = 0; b <= blocks; b++) {
+            size_t start = (b == blocks) ? _outWords : b * limiterLookahead;
+            size_t end = (b == blocks) ? _outWords + limiterLookahead : std::min(start + limiterLookahead, _outWords);
+            int32_t peak = 0;
+            for (size_t i = start * 2; i < end * 2; i++) {
+                int32_t a = abs(_bus[i]);
+                peak = std::max(peak, a);
             }
-            if (sum > 32767) {
-                sum = 32767;
-            } else if (sum < -32767) {
-                sum = -32767;
+            if (peak > 32767) {
+                need[b] = (32767 << 16) / peak;
+                over = true;
+            } else {
+                need[b] = 1 << 16;
             }
-            _outBuff[i] = (int16_t)sum;
         }
+
+        if (!over && (_limitGain == 1 << 16)) {
+            // Nothing to limit, just narrow the data
+            for (size_t i = 0; i < _outWords * 2; i++) {
+                _outBuff[i] = (int16_t)_bus[i];
+            }
+        } else {
+            for (size_t b = 0; b < blocks; b++) {
+                size_t start = b * limiterLookahead;
+                size_t len = std::min(limiterLookahead, _outWords - start);
+                int32_t target = std::min(need[b], need[b + 1]);
+                int32_t next = (target < _limitGain) ? target : std::min(target, _limitGain + _limitRelease);
+                int32_t g = _limitGain;
+                int32_t step = (next - g) / (int32_t)len;
+                int32_t *in = &_bus[start * 2];
+                int16_t *out = &_outBuff[start * 2];
+                for (size_t i = 0; i < len; i++) {
+                    *out++ = (int16_t)((*in++ * g) >> 16);
+                    *out++ = (int16_t)((*in++ * g) >> 16);
+                    g += step;
+                }
+                _limitGain = next;
+            }
+        }
+
+        // Save the lookahead tail for the next frame
+        memmove(_bus, &_bus[_outWords * 2], limiterLookahead * 2 * sizeof(int32_t));
     }
+#endif
 
     /**
         @brief Pumps all inputs to get their next block of data or silence and sends it to the real output device
     */
     void pump() {
+        BA_INSTRUMENT(_instr.pumpBegin(_out->availableForWrite(), _outRate));
+        BA_TRACE(BA_TRACE_PUMP_BEGIN, this, _out->availableForWrite());
         while (_out->availableForWrite() >= (int)(_outWords * 4)) {
+            BA_INSTRUMENT(_instr.frameBegin());
+            BA_TRACE(BA_TRACE_FRAME_BEGIN, this, 0);
             generateOneFrame();
+            BA_TRACE(BA_TRACE_FRAME_END, this, 0);
+            BA_INSTRUMENT(_instr.frameEnd());
             assert(_out->write((uint8_t *)_outBuff, _outWords * 4) == _outWords * 4);
         }
+        BA_TRACE(BA_TRACE_PUMP_END, this, 0);
+        BA_INSTRUMENT(_instr.pumpEnd());
     }
 
     bool _running;
     AudioOutputBase *_out;
     int _outRate;
+    uint64_t _sampleTime;   // Sample clock at the start of the next block to mix
     int16_t _outBuff[_outWords * 2];
     std::vector<BackgroundAudioMixerInput *> _input;
+#ifdef BACKGROUNDAUDIO_INSTRUMENT
+    BackgroundAudioInstrument _instr;
+#endif
+#ifndef BACKGROUNDAUDIO_MIXER_HARDCLIP
+    int32_t _bus[(_outWords + limiterLookahead) * 2]; // Headroom bus, lookahead tail followed by the current frame
+    int32_t _limitGain;                               // Limiter gain at the start of the next block, 16.16
+    int32_t _limitRelease;                            // Limiter release increment per block, 16.16
+#endif
+
+    typedef struct {
+        BackgroundAudioMixerInput *trigger;
+        BackgroundAudioMixerInput *target;
+        int32_t depth;      // Ducked level, 16.16
+        int32_t step;       // Per-block ramp increment
+        int32_t level;      // Current ducking level, 16.16
+        uint32_t hold;      // Blocks of trigger silence before releasing
+        uint32_t holdCount;
+    } DuckRule;
+    std::vector<DuckRule> _duck;
 };
@@ -0,0 +1,322 @@
+/*
+    BackgroundAudio
+    Decodes on the other core into a PCM queue which the output only copies from
+
+    Copyright (c) 2025 Earle F. Philhower, III <earlephilhower@yahoo.com>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+#include <Arduino.h>
+#include <atomic>
+#include "WrappedAudioOutputBase.h"
+#include "BackgroundAudioPlatform.h"
+
+/**
+    @brief Single producer, single consumer queue of 16-bit stereo samples tagged with their sample rate
+
+    @details
+    One side only ever writes and the other only ever reads, so the read and write counts are plain atomic
+    loads and stores with no locks or read-modify-write instructions, which the RP2040's M0+ doesn't have.
+    The producer writes straight into the queue's memory from `writeSpan` and then `commit`s.  Rate changes
+    are kept in a small side queue with the sample count they start at, so the consumer can switch the
+    output's frequency exactly where the new audio begins.
+
+    @tparam depth Stereo samples of storage, a power of 2
+*/
+template<size_t depth>
+class BackgroundAudioPCMQueue {
+    static_assert((depth & (depth - 1)) == 0, "depth must be a power of 2");
+public:
+    BackgroundAudioPCMQueue() {
+    }
+
+    /**
+        @brief Empty the queue.  Only when neither side is running
+    */
+    void reset() {
+        _wr = 0;
+        _rd = 0;
+        _rateWr = 0;
+        _rateRd = 0;
+        _lastRate = 0;
+        _rate = 0;
+    }
+
+    /**
+        @brief Number of samples waiting to be read
+    */
+    size_t available() {
+        return _wr.load(std::memory_order_acquire) - _rd.load(std::memory_order_acquire);
+    }
+
+    /**
+        @brief Number of samples which could be written
+    */
+    size_t availableForWrite() {
+        return depth - available();
+    }
+
+    /**
+        @brief Producer: get the contiguous free space to write samples into
+
+        @param [out] n Number of stereo samples which may be written at the returned pointer
+
+        @return Pointer to `n * 2` int16_t's
+    */
+    int16_t *writeSpan(size_t &n) {
+        uint32_t wr = _wr.load(std::memory_order_relaxed);
+        n = std::min(depth - (wr - _rd.load(std::memory_order_acquire)), depth - (wr & (depth - 1)));
+        if (_rateWr.load(std::memory_order_relaxed) - _rateRd.load(std::memory_order_acquire) == rates) {
+            n = 0; // No room to tag a rate change, unlikely with any sane amount of audio
+        }
+        return _pcm + (wr & (depth - 1)) * 2;
+    }
+
+    /**
+        @brief Producer: make the samples written to `writeSpan` visible to the consumer
+
+        @param [in] n Number of stereo samples written
+        @param [in] rate Their sample rate
+    */
+    void commit(size_t n, int rate) {
+        if (!n) {
+            return;
+        }
+        uint32_t wr = _wr.load(std::memory_order_relaxed);
+        if (rate != _lastRate) {
+            uint32_t r = _rateWr.load(std::memory_order_relaxed);
+            _rateAt[r & (rates - 1)] = wr;
+            _rateHz[r & (rates - 1)] = rate;
+            _rateWr.store(r + 1, std::memory_order_release);
+            _lastRate = rate;
+        }
+        _wr.store(wr + n, std::memory_order_release);
+    }
+
+    /**
+        @brief Consumer: get the contiguous queued samples, all of one sample rate
+
+        @param [out] n Number of stereo samples readable at the returned pointer
+        @param [out] rate Their sample rate, 0 if none has been committed yet
+
+        @return Pointer to `n * 2` int16_t's
+    */
+    const int16_t *readSpan(size_t &n, int &rate) {
+        uint32_t rd = _rd.load(std::memory_order_relaxed);
+        uint32_t wr = _wr.load(std::memory_order_acquire);
+        n = std::min((size_t)(wr - rd), depth - (rd & (depth - 1)));
+        uint32_t r = _rateRd.load(std::memory_order_relaxed);
+        uint32_t rw = _rateWr.load(std::memory_order_acquire);
+        while ((r != rw) && (_rateAt[r & (rates - 1)] == rd)) {
+            _rate = _rateHz[r & (rates - 1)];
+            r++;
+        }
+        _rateRd.store(r, std::memory_order_release);
+        if (r != rw) {
+            n = std::min(n, (size_t)(_rateAt[r & (rates - 1)] - rd)); // Stop where the next rate starts
+        }
+        rate = _rate;
+        return _pcm + (rd & (depth - 1)) * 2;
+    }
+
+    /**
+        @brief Consumer: release samples returned by `readSpan`
+
+        @param [in] n Number of stereo samples used
+    */
+    void consume(size_t n) {
+        _rd.store(_rd.load(std::memory_order_relaxed) + n, std::memory_order_release);
+    }
+
+private:
+    static constexpr uint32_t rates = 8;
+    int16_t _pcm[depth * 2];
+    std::atomic<uint32_t> _wr{0};           // Written only by the producer
+    std::atomic<uint32_t> _rd{0};           // Written only by the consumer
+    uint32_t _rateAt[rates];
+    int _rateHz[rates];
+    std::atomic<uint32_t> _rateWr{0};
+    std::atomic<uint32_t> _rateRd{0};
+    int _lastRate = 0;                      // Producer's
+    int _rate = 0;                          // Consumer's
+};
+
+/**
+    @brief Runs a decoder on the other core, the output's callback only copying out already decoded audio
+
+    @details
+    Normally all decoding happens in the background on the core which called `begin`, which then has that
+    much less time for WiFi or the app.  In a pipeline the decoder's `render` is called by a
+    `BackgroundAudioWorker` on the other core, keeping a `BackgroundAudioPCMQueue` of up to `depth`
+    samples decoded ahead, and the output's callback on this core only copies from it into the output.
+    A deeper queue rides out longer decode hiccups at the cost of RAM and latency.
+
+    Use it instead of the decoder's `begin`.  The decoder is created without an output, its `write`,
+    `setGain`, and `done` work as usual, and the output is given to the pipeline:
+    ````
+    BackgroundAudioMP3 mp3;
+    BackgroundAudioPipeline<BackgroundAudioMP3> pipe(mp3, i2s);
+    void setup() {
+        pipe.begin();
+    }
+    void loop1() {
+        pipe.loop(); // Decodes on core 1 of the RP2040.  Not needed on the ESP32
+    }
+    ````
+    The decoder's `flush`, `seek`, `pause`, and `setGain` called from `loop1()` are applied right away, since
+    the worker isn't in the middle of a frame while `loop1()` runs anything else.
+
+    @tparam Decoder Player class with `render`, `sampleRate`, and `done`, i.e. the MP3, AAC, or WAV ones
+    @tparam depth Stereo samples to decode ahead, a power of 2
+*/
+template<class Decoder, size_t depth = 4096>
+class BackgroundAudioPipeline {
+public:
+    /**
+        @brief Construct a pipeline
+
+        @param [in] decoder Player to run on the other core, whose own `begin` must not be called
+        @param [in] output Output device to play to
+    */
+    BackgroundAudioPipeline(Decoder &decoder, AudioOutputBase &output) : _dec(&decoder), _out(&output) {
+    }
+
+    ~BackgroundAudioPipeline() {
+        end();
+    }
+
+    /**
+        @brief Start the output on this core and decoding on the other
+
+        @return True on success
+    */
+    bool begin() {
+        if (_worker.running()) {
+            return false;
+        }
+        _queue.reset();
+        _dry = false;
+        _rate = 44100;
+        _out->setBuffers(4, outputWords);
+        _out->setBitsPerSample(16);
+        _out->setStereo(true);
+        _out->setFrequency(_rate);
+        _out->onTransmit(&_cb, (void *)this);
+        if (!_out->begin()) {
+            return false;
+        }
+        if (!_worker.start(&_step, (void *)this)) {
+            _out->end();
+            return false;
+        }
+        return true;
+    }
+
+    /**
+        @brief Stop decoding and the output
+    */
+    void end() {
+        if (_worker.running()) {
+            _worker.stop();
+            _out->end();
+        }
+    }
+
+    /**
+        @brief Decode on this core.  On the RP2040 call from `loop1()`, elsewhere the worker runs itself
+    */
+    void loop() {
+#if defined(ARDUINO_ARCH_RP2040) && !defined(BACKGROUNDAUDIO_STD_THREAD)
+        while (_worker.poll()) {
+            /* Fill the queue */
+        }
+#endif
+    }
+
+    /**
+        @brief Number of decoded stereo samples waiting to be played
+    */
+    size_t queued() {
+        return _queue.available();
+    }
+
+    /**
+        @brief Determine if the decoder ran out of input and everything decoded has been sent to the output
+
+        @return True when done
+    */
+    bool done() {
+        return _dry && !_queue.available();
+    }
+
+    /**
+        @brief Determine if the output ran dry since the last call, i.e. the queue was empty
+
+        @return True if an underflow occurred
+    */
+    bool getUnderflow() {
+        return _out->getUnderflow();
+    }
+
+private:
+    static constexpr size_t outputWords = 256;      // Small DMA buffers, the queue does the buffering
+
+    // Worker on the other core: top up the queue a slice at a time so the output sees audio promptly
+    static bool _step(void *ptr) {
+        BackgroundAudioPipeline *p = (BackgroundAudioPipeline *)ptr;
+        size_t n;
+        int16_t *dest = p->_queue.writeSpan(n);
+        n = std::min(n, depth / 4);
+        if (!n) {
+            return false;
+        }
+        size_t got = p->_dec->render(dest, n);
+        p->_queue.commit(got, p->_dec->sampleRate());
+        // Short because it ran out of input, not because it's paused
+        p->_dry = (got < n) && p->_dec->done();
+        return got > 0;
+    }
+
+    // Output callback on this core, copies only
+    static void _cb(void *ptr) {
+        BackgroundAudioPipeline *p = (BackgroundAudioPipeline *)ptr;
+        while (true) {
+            size_t room = p->_out->availableForWrite() / 4;
+            size_t n;
+            int rate;
+            const int16_t *src = p->_queue.readSpan(n, rate);
+            if (!room || !n) {
+                return;
+            }
+            if (rate && (rate != p->_rate)) {
+                p->_rate = rate;
+                p->_out->setFrequency(rate);
+            }
+            size_t wrote = p->_out->write((const uint8_t *)src, std::min(n, room) * 4) / 4;
+            p->_queue.consume(wrote);
+            if (!wrote) {
+                return;
+            }
+        }
+    }
+
+    Decoder *_dec;
+    AudioOutputBase *_out;
+    BackgroundAudioWorker _worker;
+    BackgroundAudioPCMQueue<depth> _queue;
+    std::atomic<bool> _dry{false};
+    int _rate = 44100;
+};
@@ -0,0 +1,277 @@
+/*
+    BackgroundAudio
+    Runs a work loop on the other CPU core, or in a thread on the host
+
+    Copyright (c) 2025 Earle F. Philhower, III <earlephilhower@yahoo.com>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+#include <Arduino.h>
+#include <atomic>
+
+// Define BACKGROUNDAUDIO_STD_THREAD to run the worker in a std::thread, as the host build does.  Otherwise
+// the ESP32 gets a FreeRTOS task pinned to the other core and the RP2040 runs it from the app's loop1().
+#ifdef BACKGROUNDAUDIO_STD_THREAD
+#include <thread>
+#include <chrono>
+#endif
+
+/**
+    @brief Calls a step function over and over on the other core until stopped
+
+    @details
+    The step function does a bounded amount of work and returns true, or returns false when there was
+    nothing to do so the worker can let something else run for a moment.
+
+    On the ESP32 it is a FreeRTOS task pinned to the core `start` wasn't called on.  With
+    BACKGROUNDAUDIO_STD_THREAD it is a `std::thread`.  Arduino-Pico starts core 1 itself and uses it to
+    pause the core during flash writes, so on the RP2040 the app calls `poll` from `loop1()` instead.
+*/
+class BackgroundAudioWorker {
+public:
+    BackgroundAudioWorker() {
+    }
+
+    ~BackgroundAudioWorker() {
+        stop();
+    }
+
+    /**
+        @brief Start calling `step` on the other core
+
+        @param [in] step Work function, returns false when idle
+        @param [in] data Passed to `step`
+
+        @return True on success
+    */
+    bool start(bool (*step)(void *), void *data) {
+        if (_running) {
+            return false;
+        }
+        _step = step;
+        _data = data;
+        _running = true;
+#if defined(BACKGROUNDAUDIO_STD_THREAD)
+        _thread = std::thread([this]() {
+            _isWorker = true;
+            while (_running) {
+                if (!poll()) {
+                    std::this_thread::sleep_for(std::chrono::microseconds(100));
+                }
+            }
+        });
+#elif defined(ESP32)
+        _exited = false;
+        // Single core chips (S2, C3, C6) just get a task of their own
+        BaseType_t core = (portNUM_PROCESSORS > 1) ? 1 - xPortGetCoreID() : tskNO_AFFINITY;
+        if (pdPASS != xTaskCreatePinnedToCore(_taskShim, "BackgroundAudioWorker", 8192, (void *)this, 1, &_taskHandle, core)) {
+            _running = false;
+            return false;
+        }
+#endif
+        return true;
+    }
+
+    /**
+        @brief Stop the worker, waiting for any step in progress to finish
+
+        @details
+        Called on the worker itself (from `loop1()` or inside a step) it can't wait and returns at once, the
+        step in progress being the caller's.  Otherwise on the RP2040 it spins until `loop1()` leaves its
+        step, which takes forever if core 1 is stopped or never gets back from `poll`.
+    */
+    void stop() {
+        if (!_running) {
+            return;
+        }
+        _running = false;
+        if (onWorker()) {
+#if defined(BACKGROUNDAUDIO_STD_THREAD)
+            _thread.detach();
+#endif
+            return;
+        }
+#if defined(BACKGROUNDAUDIO_STD_THREAD)
+        _thread.join();
+#elif defined(ESP32)
+        while (!_exited) {
+            vTaskDelay(1);
+        }
+#else
+        while (_busy) {
+            /* Wait for loop1() to leave the step */
+        }
+#endif
+    }
+
+    /**
+        @brief Run one step if started.  On the RP2040 call this from `loop1()`
+
+        @return True if the step did some work
+    */
+    bool poll() {
+#if defined(ARDUINO_ARCH_RP2040) && !defined(BACKGROUNDAUDIO_STD_THREAD)
+        _workerCore = get_core_num() + 1;
+#endif
+        // Flag busy before checking running so `stop` either sees us busy or we see it stopped
+        _busy = true;
+        bool ret = _running && _step(_data);
+        _busy = false;
+        return ret;
+    }
+
+    /**
+        @brief Determine if the worker has been started
+
+        @return True between `start` and `stop`
+    */
+    bool running() {
+        return _running;
+    }
+
+    /**
+        @brief Determine if the caller is running as a worker, so mustn't sleep waiting on one
+
+        @return True in a worker's thread or task, or on the RP2040 on the core calling `poll` outside an interrupt
+    */
+    static bool onWorker() {
+#if defined(BACKGROUNDAUDIO_STD_THREAD) || defined(ESP32)
+        return _isWorker;
+#elif defined(ARDUINO_ARCH_RP2040)
+        return !__get_current_exception() && (_workerCore == (int)get_core_num() + 1);
+#else
+        return false;
+#endif
+    }
+
+private:
+#if defined(ESP32) && !defined(BACKGROUNDAUDIO_STD_THREAD)
+    static void _taskShim(void *pvParameters) {
+        BackgroundAudioWorker *w = (BackgroundAudioWorker *)pvParameters;
+        _isWorker = true;
+        while (w->_running) {
+            if (!w->poll()) {
+                vTaskDelay(1);
+            }
+        }
+        w->_exited = true;
+        vTaskDelete(nullptr);
+    }
+
+    TaskHandle_t _taskHandle;
+    std::atomic<bool> _exited{false};
+#endif
+#ifdef BACKGROUNDAUDIO_STD_THREAD
+    std::thread _thread;
+#endif
+#if defined(BACKGROUNDAUDIO_STD_THREAD) || defined(ESP32)
+    static inline thread_local bool _isWorker = false;
+#elif defined(ARDUINO_ARCH_RP2040)
+    static inline volatile int _workerCore = 0;   // 1 + core number `poll` is called on, 0 if never
+#endif
+    bool (*_step)(void *) = nullptr;
+    void *_data = nullptr;
+    std::atomic<bool> _running{false};
+    std::atomic<bool> _busy{false};
+};
+
+/**
+    @brief Lets the app sleep until a background context signals it, instead of spinning
+
+    @details
+    On the RP2040 this is the core's WFE instruction, woken by `__sev` from either core or by any interrupt,
+    so the wait lasts at most until the next output IRQ.  On the ESP32 it is a FreeRTOS task notification.
+    Either way `wait` can return early, so callers re-check what they're waiting for in a loop.
+
+    A `notify` between the caller's check and its `wait` must not be lost.  WFE returns at once if an event
+    was signalled since the last one, and on the ESP32 the caller `arm`s before its first check so the
+    notification is counted against the task even when it isn't asleep yet.
+    ````
+    e.arm();
+    while (!ready()) {
+        e.wait(5);
+    }
+    e.disarm();
+    ````
+*/
+class BackgroundAudioEvent {
+public:
+    /**
+        @brief Have `notify` wake the calling task from now on.  Call before the first check of what's waited for
+    */
+    void arm() {
+#if defined(ESP32) && !defined(BACKGROUNDAUDIO_STD_THREAD)
+        _waiter = xTaskGetCurrentTaskHandle();
+#endif
+    }
+
+    /**
+        @brief Stop `notify` waking the task which `arm`ed
+    */
+    void disarm() {
+#if defined(ESP32) && !defined(BACKGROUNDAUDIO_STD_THREAD)
+        _waiter = nullptr;
+#endif
+    }
+
+    /**
+        @brief Sleep until `notify` is called, or has been since `arm`, or about `ms` milliseconds pass
+    */
+    void wait(uint32_t ms) {
+#if defined(ESP32) && !defined(BACKGROUNDAUDIO_STD_THREAD)
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(ms) ? pdMS_TO_TICKS(ms) : 1);
+#elif defined(ARDUINO_ARCH_RP2040)
+        (void) ms;
+        __wfe();
+#else
+        delay(std::min(ms, (uint32_t)1));
+#endif
+    }
+
+    /**
+        @brief Determine if the caller can sleep here until a pump runs
+
+        @return False in an interrupt handler (i.e. an output's `onTransmit`), which the pump can't preempt
+    */
+    static bool canWait() {
+#if defined(ESP32) && !defined(BACKGROUNDAUDIO_STD_THREAD)
+        return !xPortInIsrContext();
+#elif defined(ARDUINO_ARCH_RP2040)
+        return !__get_current_exception();
+#else
+        return true;
+#endif
+    }
+
+    /**
+        @brief Wake anything in `wait`.  Safe from the pump, in an IRQ or on the other core
+    */
+    void notify() {
+#if defined(ESP32) && !defined(BACKGROUNDAUDIO_STD_THREAD)
+        TaskHandle_t t = _waiter;
+        if (t) {
+            xTaskNotifyGive(t);
+        }
+#elif defined(ARDUINO_ARCH_RP2040)
+        __sev();
+#endif
+    }
+
+private:
+#if defined(ESP32) && !defined(BACKGROUNDAUDIO_STD_THREAD)
+    TaskHandle_t volatile _waiter = nullptr;
+#endif
+};
@@ -0,0 +1,101 @@
+/*
+    BackgroundAudio
+    Per-stage cycle accounting for the decoders, speech synthesizer, and playback glue
+
+    Copyright (c) 2025 Earle F. Philhower, III <earlephilhower@yahoo.com>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "BackgroundAudioProfile.h"
+
+#if defined(ESP32)
+#include <esp_cpu.h>
+#elif defined(ARDUINO_ARCH_RP2040) && defined(__arm__)
+#include <hardware/structs/systick.h>
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#else
+#include <time.h>
+#endif
+
+#ifdef BACKGROUNDAUDIO_PROFILE
+ba_profile_stat_t ba_profile_stat[BA_PROFILE_STAGES];
+uint32_t ba_profile_start[BA_PROFILE_STAGES];
+#endif
+
+const char * const ba_profile_name[BA_PROFILE_STAGES] = {
+    "mp3.huffdecode",
+    "mp3.exponents",
+    "mp3.stereo",
+    "mp3.imdct",
+    "mp3.synth",
+    "aac.huffman",
+    "aac.dequant",
+    "aac.stereo",
+    "aac.tnspns",
+    "aac.imdct",
+    "aac.sbr_bitstream",
+    "aac.sbr_data",
+    "speech.wavegen",
+    "glue.sync",
+    "glue.shiftup",
+    "glue.gain",
+    "mixer.sum",
+    "mixer.limit"
+};
+
+#if defined(ESP32) || (defined(ARDUINO_ARCH_RP2040) && (defined(__arm__) || defined(__riscv)))
+const char * const ba_profile_clock = "cycles";
+#elif defined(__x86_64__) || defined(__i386__)
+const char * const ba_profile_clock = "tsc";
+#else
+const char * const ba_profile_clock = "ns";
+#endif
+
+uint32_t ba_profile_now(void) {
+#if defined(ESP32)
+    return (uint32_t)esp_cpu_get_cycle_count();
+#elif defined(ARDUINO_ARCH_RP2040) && defined(__arm__)
+    return (BA_PROFILE_MASK + 1 - systick_hw->cvr) & BA_PROFILE_MASK; // Counts down
+#elif defined(ARDUINO_ARCH_RP2040) && defined(__riscv)
+    uint32_t c;
+    asm volatile("csrr %0, mcycle" : "=r"(c));
+    return c;
+#elif defined(__x86_64__) || defined(__i386__)
+    return (uint32_t)__rdtsc();
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)(ts.tv_sec * 1000000000ull + ts.tv_nsec);
+#endif
+}
+
+void ba_profile_reset(void) {
+#if defined(ARDUINO_ARCH_RP2040) && defined(__arm__)
+    if (!(systick_hw->csr & 1)) {
+        // Free-running from the CPU clock, no interrupt.  Leave it alone if the core already set it up.
+        systick_hw->rvr = BA_PROFILE_MASK;
+        systick_hw->cvr = 0;
+        systick_hw->csr = 5;
+    }
+#endif
+#ifdef BACKGROUNDAUDIO_PROFILE
+    for (int i = 0; i < BA_PROFILE_STAGES; i++) {
+        ba_profile_stat[i].calls = 0;
+        ba_profile_stat[i].max = 0;
+        ba_profile_stat[i].cycles = 0;
+    }
+#endif
+}
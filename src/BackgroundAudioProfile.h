@@ -0,0 +1,114 @@
+/*
+    BackgroundAudio
+    Per-stage cycle accounting for the decoders, speech synthesizer, and playback glue
+
+    Copyright (c) 2025 Earle F. Philhower, III <earlephilhower@yahoo.com>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// Included from both the C codecs and the C++ classes.  The stage hooks compile away unless
+// BACKGROUNDAUDIO_PROFILE is defined for the *whole* build (i.e. -DBACKGROUNDAUDIO_PROFILE in the
+// build flags, not just in the sketch) because they live inside the codec sources.  The cycle
+// counter is always available.
+
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+    @brief Each separately timed piece of work.  Keep `ba_profile_name` in BackgroundAudioProfile.c in the same order
+*/
+enum {
+    BA_PROFILE_MP3_HUFFDECODE,      // III_huffdecode, including the requantization folded into it
+    BA_PROFILE_MP3_EXPONENTS,       // III_exponents (called from inside III_huffdecode)
+    BA_PROFILE_MP3_STEREO,          // III_stereo, MS and intensity
+    BA_PROFILE_MP3_IMDCT,           // Reorder, alias reduction, III_imdct_l/imdct36/III_imdct_s, overlap
+    BA_PROFILE_MP3_SYNTH,           // synth_full/synth_half polyphase filterbank
+    BA_PROFILE_AAC_HUFFMAN,         // DecodeNoiselessData
+    BA_PROFILE_AAC_DEQUANT,         // Dequantize
+    BA_PROFILE_AAC_STEREO,          // StereoProcess
+    BA_PROFILE_AAC_TNSPNS,          // PNS, short block deinterleave, and TNSFilter
+    BA_PROFILE_AAC_IMDCT,           // IMDCT
+    BA_PROFILE_AAC_SBR_BITSTREAM,   // DecodeSBRBitstream
+    BA_PROFILE_AAC_SBR_DATA,        // DecodeSBRData
+    BA_PROFILE_SPEECH_WAVEGEN,      // ESpeak-NG WavegenFill
+    BA_PROFILE_SYNC,                // Searching the input for the next frame header
+    BA_PROFILE_SHIFTUP,             // Input buffer shiftUp
+    BA_PROFILE_GAIN,                // ApplyGain
+    BA_PROFILE_MIX,                 // Mixer leg summing
+    BA_PROFILE_LIMIT,               // Mixer peak limiter
+    BA_PROFILE_STAGES
+};
+
+/**
+    @brief Accumulated cost of one stage
+*/
+typedef struct {
+    uint32_t calls;
+    uint32_t max;                   // Longest single call
+    uint64_t cycles;                // Total of all calls
+} ba_profile_stat_t;
+
+extern const char * const ba_profile_name[BA_PROFILE_STAGES];
+extern const char * const ba_profile_clock;     // Units of ba_profile_now: "cycles", "tsc", or "ns"
+
+/**
+    @brief Read the free-running cycle counter.  Only differences masked with `BA_PROFILE_MASK` are meaningful
+*/
+uint32_t ba_profile_now(void);
+
+/**
+    @brief Clear all the stage totals and make sure the cycle counter is running
+*/
+void ba_profile_reset(void);
+
+#if defined(ARDUINO_ARCH_RP2040) && defined(__arm__)
+#define BA_PROFILE_MASK 0xffffffu   // 24-bit SysTick
+#else
+#define BA_PROFILE_MASK 0xffffffffu
+#endif
+
+#ifdef BACKGROUNDAUDIO_PROFILE
+
+extern ba_profile_stat_t ba_profile_stat[BA_PROFILE_STAGES];
+extern uint32_t ba_profile_start[BA_PROFILE_STAGES];
+
+static inline void ba_profile_end(int stage) {
+    uint32_t d = (ba_profile_now() - ba_profile_start[stage]) & BA_PROFILE_MASK;
+    ba_profile_stat_t *s = &ba_profile_stat[stage];
+    s->calls++;
+    s->cycles += d;
+    if (d > s->max) {
+        s->max = d;
+    }
+}
+
+#define BA_PROFILE_BEGIN(stage) do { ba_profile_start[stage] = ba_profile_now(); } while (0)
+#define BA_PROFILE_END(stage) ba_profile_end(stage)
+
+#else
+
+#define BA_PROFILE_BEGIN(stage) do { } while (0)
+#define BA_PROFILE_END(stage) do { } while (0)
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,358 @@
+/*
+    BackgroundAudio
+    Plays an audio file using IRQ driven decompression.  Main loop() writes
+    data to the buffer but isn't blocked while playing
+
+    Copyright (c) 2025 Earle F. Philhower, III <earlephilhower@yahoo.com>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+#include <Arduino.h>
+#include <atomic>
+#include "WrappedAudioOutputBase.h"
+#include "BackgroundAudioGain.h"
+#include "BackgroundAudioADPCM.h"
+#include "BackgroundAudioInstrument.h"
+#include "BackgroundAudioTrace.h"
+
+/**
+    @brief Location of a single prompt in a `BackgroundAudioPromptSet`
+*/
+typedef struct {
+    /** Byte offset of the prompt's first sample in the set's data */
+    uint32_t offset;
+    /** Number of mono samples */
+    uint32_t samples;
+} BackgroundAudioPrompt;
+
+/**
+    @brief Structure to collect a set of pre-rendered speech prompts, as generated by `tools/speech2rom`
+*/
+typedef struct {
+    /** Sample rate in hertz */
+    int sampleRate;
+    /** True for 4-bit IMA-ADPCM data, false for 16-bit little-endian PCM */
+    bool adpcm;
+    /** Number of prompts */
+    size_t count;
+    /** Start and length of each prompt */
+    const BackgroundAudioPrompt *index;
+    /** Sample data pointer in ROM/flash */
+    const unsigned char *data;
+} BackgroundAudioPromptSet;
+
+/**
+    @brief Plays speech prompts rendered ahead of time by `tools/speech2rom`, by ID
+
+    @details
+    The prompts are generated on a PC with the same ESpeak-NG sources, voice, and dictionary as
+    `BackgroundAudioSpeech`, so in PCM form they are sample-for-sample what the device would have said,
+    but playing them needs no dictionary, phoneme tables, or synthesis.  Prompts can be queued back to back
+    (i.e. "Now serving", "4", "2") and play without gaps.
+
+    @tparam queueLen Number of prompts which may be waiting to play
+    @tparam framelen Number of stereo samples generated per output block
+*/
+template<size_t queueLen = 8, size_t framelen = 256>
+class BackgroundAudioPromptsClass {
+public:
+    BackgroundAudioPromptsClass() {
+        _out = nullptr;
+    }
+
+    /**
+        @brief Construct a prompt player with a given AudioOutputBase
+
+        @param [in] d AudioOutputBase device (MixerInput or I2S or PWM, etc.) to play to
+    */
+    BackgroundAudioPromptsClass(AudioOutputBase &d) {
+        setDevice(&d);
+    }
+
+    ~BackgroundAudioPromptsClass() {}
+
+    /**
+        @brief Set an output device before `begin`
+
+        @param [in] d Pointer to `AudioOutputDevice` to send decoded data to
+
+        @return True on success
+    */
+    bool setDevice(AudioOutputBase *d) {
+        if (!_running) {
+            _out = d;
+            return true;
+        }
+        return false;
+    }
+
+    /**
+        @brief Set the prompts to play before `begin`
+
+        @param [in] p Prompt set included from a `tools/speech2rom` generated header
+
+        @return True on success
+    */
+    bool setPrompts(const BackgroundAudioPromptSet &p) {
+        if (!_running) {
+            _set = &p;
+            return true;
+        }
+        return false;
+    }
+
+    /**
+        @brief Set the gain multiplier (volume) for the stream.  Takes effect immediately.
+
+        @param [in] scale Floating point value from 0.0....16.0 to multiply all audio data by
+    */
+    void setGain(float scale) {
+        _gain = (int32_t)(scale * (1 << 16));
+    }
+
+    /**
+        @brief Starts the player at the prompts' sample rate.  Will initialize the output device and start sending silence immediately.
+
+        @return True on success, false if already started or no prompts were set.
+    */
+    bool begin() {
+        if (!_out || !_set || _running) {
+            return false;
+        }
+        _out->setBuffers(4, framelen);
+        BA_INSTRUMENT(_instr.setOutput(4, framelen));
+        BA_TRACE_NAME(this, "Prompts");
+        _out->onTransmit(&_cb, (void *)this);
+        _out->setBitsPerSample(16);
+        _out->setStereo(true);
+        _out->setFrequency(_set->sampleRate);
+        _out->begin();
+        _running = true;
+        pump();
+        return true;
+    }
+
+    /**
+        @brief Stops the process and the calls the output device's end to shut it down, too.
+    */
+    void end() {
+        if (_running) {
+            _out->end();
+        }
+        _running = false;
+    }
+
+    /**
+        @brief Determines if the player has been started
+
+        @returns True if running
+    */
+    bool playing() {
+        return _running;
+    }
+
+    /**
+        @brief Get the number of prompts in the set
+
+        @return Highest valid prompt ID plus 1
+    */
+    size_t count() {
+        return _set ? _set->count : 0;
+    }
+
+    /**
+        @brief Queue a prompt to play after any already playing or queued
+
+        @param [in] id Prompt number, i.e. one of the names from the generated header
+
+        @return True if queued, false if the ID is invalid or the queue is full
+    */
+    bool play(size_t id) {
+        if (!_set || (id >= _set->count)) {
+            return false;
+        }
+        size_t head = _head.load(std::memory_order_relaxed);
+        size_t next = (head + 1) % (queueLen + 1);
+        if (next == _tail.load(std::memory_order_acquire)) {
+            return false;
+        }
+        _queue[head] = id;
+        _head.store(next, std::memory_order_release);
+        return true;
+    }
+
+    /**
+        @brief Determine if all queued prompts have been played
+
+        @return True if nothing is playing or waiting to play
+    */
+    bool done() {
+        return !_left && (_head.load() == _tail.load());
+    }
+
+    /**
+        @brief Stop the current prompt immediately and drop any queued ones
+    */
+    void flush() {
+        noInterrupts();
+        _left = 0;
+        _tail.store(_head.load());
+        interrupts();
+    }
+
+    /**
+           @brief Pause the player.  Will transmit silence until unpaused
+    */
+    void pause() {
+        _paused = true;
+    }
+
+    /**
+        @brief Determine if the playback is paused
+
+        @return True of playback has been paused
+    */
+    bool paused() {
+        return _paused;
+    }
+
+    /**
+        @brief Unpause previously paused playback.  Will continue where it left off
+    */
+    void unpause() {
+        _paused = false;
+    }
+
+    /**
+          @brief Get number of "frames" played
+
+          @return Number of frames, where frames are `framelen` stereo samples in size
+    */
+    uint32_t frames() {
+        return _frames;
+    }
+
+#ifdef BACKGROUNDAUDIO_INSTRUMENT
+    /**
+        @brief Get the pump and frame timing statistics.  Only built with BACKGROUNDAUDIO_INSTRUMENT defined
+
+        @param [out] t Filled in with a consistent snapshot of the statistics
+    */
+    void getTiming(BackgroundAudioTiming *t) {
+        _instr.read(t);
+    }
+
+    /**
+        @brief Clear the timing statistics, taking effect at the start of the next pump
+    */
+    void resetTiming() {
+        _instr.reset();
+    }
+#endif
+
+private:
+    static void _cb(void *ptr) {
+        BA_TRACE(BA_TRACE_CALLBACK, ptr, 0);
+        ((BackgroundAudioPromptsClass*)ptr)->pump();
+    }
+
+    // Start the next queued prompt, if any
+    bool _next() {
+        size_t tail = _tail.load(std::memory_order_relaxed);
+        if (tail == _head.load(std::memory_order_acquire)) {
+            return false;
+        }
+        const BackgroundAudioPrompt *p = &_set->index[_queue[tail]];
+        _ptr = _set->data + p->offset;
+        _left = p->samples;
+        _high = false;
+        _adpcm.reset();
+        _tail.store((tail + 1) % (queueLen + 1), std::memory_order_release);
+        return true;
+    }
+
+    int16_t _fetch() {
+        if (!_set->adpcm) {
+            int16_t s = (int16_t)(_ptr[0] | (_ptr[1] << 8));
+            _ptr += 2;
+            return s;
+        }
+        // Low nibble first, as in IMA-ADPCM WAV files
+        if (!_high) {
+            _high = true;
+            return _adpcm.decode(*_ptr & 0x0f);
+        }
+        _high = false;
+        return _adpcm.decode(*_ptr++ >> 4);
+    }
+
+    void generateOneFrame() {
+        size_t i = 0;
+        while (!_paused && (i < framelen) && (_left || _next())) {
+            int16_t s = _fetch();
+            _frame[i * 2] = s;
+            _frame[i * 2 + 1] = s;
+            _left--;
+            i++;
+        }
+        ApplyGain(_frame, i * 2, _gain);
+        bzero(&_frame[i * 2], (framelen - i) * 2 * sizeof(int16_t));
+        _frames++;
+    }
+
+    void pump() {
+        BA_INSTRUMENT(_instr.pumpBegin(_out->availableForWrite(), _set->sampleRate));
+        BA_TRACE(BA_TRACE_PUMP_BEGIN, this, _out->availableForWrite());
+        while (_out->availableForWrite() >= (int)sizeof(_frame)) {
+            BA_INSTRUMENT(_instr.frameBegin());
+            BA_TRACE(BA_TRACE_FRAME_BEGIN, this, 0);
+            generateOneFrame();
+            BA_TRACE(BA_TRACE_FRAME_END, this, 0);
+            BA_INSTRUMENT(_instr.frameEnd());
+            assert(_out->write((uint8_t *)_frame, sizeof(_frame)) == sizeof(_frame));
+        }
+        BA_TRACE(BA_TRACE_PUMP_END, this, 0);
+        BA_INSTRUMENT(_instr.pumpEnd());
+    }
+
+    AudioOutputBase *_out;
+    const BackgroundAudioPromptSet *_set = nullptr;
+    bool _running = false;
+    bool _paused = false;
+    int32_t _gain = 1 << 16;
+    int16_t _frame[framelen * 2] __attribute__((aligned(4)));
+
+    // Queued prompt IDs.  Head is only written by the app, tail only by the audio context
+    size_t _queue[queueLen + 1];
+    std::atomic<size_t> _head{0};
+    std::atomic<size_t> _tail{0};
+
+    // Prompt being played
+    const uint8_t *_ptr = nullptr;
+    volatile uint32_t _left = 0;
+    bool _high = false;
+    IMAADPCMDecoder _adpcm;
+
+    uint32_t _frames = 0;
+#ifdef BACKGROUNDAUDIO_INSTRUMENT
+    BackgroundAudioInstrument _instr;
+#endif
+};
+
+/**
+    @brief Prompt player queueing up to 8 prompts, generating 256-sample blocks
+*/
+using BackgroundAudioPrompts = BackgroundAudioPromptsClass<8, 256>;
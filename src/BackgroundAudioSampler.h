@@ -0,0 +1,651 @@
+/*
+    BackgroundAudio
+    Plays an audio file using IRQ driven decompression.  Main loop() writes
+    data to the buffer but isn't blocked while playing
+
+    Copyright (c) 2025 Earle F. Philhower, III <earlephilhower@yahoo.com>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+#include <Arduino.h>
+#include "WrappedAudioOutputBase.h"
+#include "BackgroundAudioADPCM.h"
+#include "BackgroundAudioInstrument.h"
+#include "BackgroundAudioTrace.h"
+
+template<size_t voices, size_t framelen> class BackgroundAudioSamplerClass;
+
+/**
+    @brief A mono sound effect living in ROM (or RAM that will not change while playing), either 16-bit PCM or IMA-ADPCM
+
+    @details
+    Clips never copy sample data, they only point at it.  Construct one from a complete WAV image
+    (i.e. an `xxd -i` generated header) or from bare sample data.
+*/
+class BackgroundAudioClip {
+public:
+    BackgroundAudioClip() {
+    }
+
+    /**
+        @brief Create a clip from raw 16-bit little-endian PCM samples
+
+        @param [in] pcm Sample data
+        @param [in] samples Number of samples
+        @param [in] sampleRate Sample rate in hertz the clip was recorded at
+    */
+    BackgroundAudioClip(const int16_t *pcm, size_t samples, int sampleRate = 44100) {
+        _data = (const uint8_t *)pcm;
+        _samples = samples;
+        _sampleRate = sampleRate;
+    }
+
+    /**
+        @brief Create a clip from raw IMA-ADPCM blocks, as stored in the `data` chunk of a mono IMA-ADPCM WAV file
+
+        @param [in] adpcm ADPCM blocks, each starting with a 4-byte predictor/index header
+        @param [in] len Length of the data in bytes
+        @param [in] blockAlign Size of each ADPCM block in bytes
+        @param [in] sampleRate Sample rate in hertz the clip was recorded at
+    */
+    BackgroundAudioClip(const uint8_t *adpcm, size_t len, size_t blockAlign, int sampleRate) {
+        _setADPCM(adpcm, len, blockAlign);
+        _sampleRate = sampleRate;
+    }
+
+    /**
+        @brief Create a clip from a complete mono WAV file image.  Check `valid` for success.
+
+        @param [in] wav Complete WAV file contents
+        @param [in] len Length of the WAV file in bytes
+    */
+    BackgroundAudioClip(const void *wav, size_t len) {
+        parseWAV(wav, len);
+    }
+
+    /**
+        @brief Point this clip at a complete WAV file image.  Only mono 16-bit PCM and 4-bit IMA-ADPCM are supported.
+
+        @param [in] wav Complete WAV file contents
+        @param [in] len Length of the WAV file in bytes
+
+        @return True if the file was a supported format
+    */
+    bool parseWAV(const void *wav, size_t len) {
+        const uint8_t *b = (const uint8_t *)wav;
+        const uint8_t *end = b + len;
+        _data = nullptr;
+        _samples = 0;
+        if ((len < 12) || memcmp(b, "RIFF", 4) || memcmp(b + 8, "WAVE", 4)) {
+            return false;
+        }
+        b += 12;
+        int format = 0;
+        int bps = 0;
+        size_t blockAlign = 0;
+        while (b + 8 <= end) {
+            uint32_t chunk = b[4] | (b[5] << 8) | (b[6] << 16) | (b[7] << 24);
+            const uint8_t *p = b + 8;
+            if (chunk > (uint32_t)(end - p)) {
+                chunk = end - p;  // Truncated file, play what we have
+            }
+            if (!memcmp(b, "fmt ", 4) && (chunk >= 16)) {
+                format = p[0] | (p[1] << 8);
+                int channels = p[2] | (p[3] << 8);
+                _sampleRate = p[4] | (p[5] << 8) | (p[6] << 16) | (p[7] << 24);
+                blockAlign = p[12] | (p[13] << 8);
+                bps = p[14] | (p[15] << 8);
+                if ((channels != 1) || (_sampleRate < 4000) || (_sampleRate > 48000)) {
+                    return false;
+                }
+                if (!((format == 1) && (bps == 16)) && !((format == 0x11) && (bps == 4) && (blockAlign > 4))) {
+                    return false;
+                }
+            } else if (!memcmp(b, "data", 4) && format) {
+                if (format == 1) {
+                    _data = p;
+                    _samples = chunk / 2;
+                    _blockAlign = 0;
+                } else {
+                    _setADPCM(p, chunk, blockAlign);
+                }
+                return true;
+            }
+            b = p + chunk + (chunk & 1);  // RIFF chunks are padded to even sizes
+        }
+        return false;
+    }
+
+    /**
+        @brief Determine if the clip points to playable data
+
+        @return True if the clip can be played
+    */
+    bool valid() const {
+        return _data && _samples;
+    }
+
+    /**
+        @brief Get the length of the clip
+
+        @return Number of samples
+    */
+    size_t samples() const {
+        return _samples;
+    }
+
+    /**
+        @brief Get the native sample rate of the clip
+
+        @return Sample rate in hertz
+    */
+    int sampleRate() const {
+        return _sampleRate;
+    }
+
+private:
+    template<size_t, size_t> friend class BackgroundAudioSamplerClass;
+
+    void _setADPCM(const uint8_t *adpcm, size_t len, size_t blockAlign) {
+        _data = adpcm;
+        _blockAlign = blockAlign;
+        _samplesPerBlock = (blockAlign - 4) * 2 + 1;
+        _samples = (len / blockAlign) * _samplesPerBlock;
+        size_t partial = len % blockAlign;
+        if (partial > 4) {
+            _samples += (partial - 4) * 2 + 1;
+        }
+    }
+
+    const uint8_t *_data = nullptr;
+    size_t _samples = 0;
+    int _sampleRate = 44100;
+    size_t _blockAlign = 0;        // 0 for PCM
+    size_t _samplesPerBlock = 0;
+};
+
+/**
+    @brief Polyphonic one-shot sample player for sound effects.  Mixes up to `voices` ROM clips in a single pass per output block.
+
+    @details
+    Each voice references a `BackgroundAudioClip` directly, so there is no per-sound decoder, raw buffer, or
+    mixer leg.  Every voice has its own pitch, gain, and loop setting.  When all voices are busy a new trigger
+    steals the oldest one.
+
+    Output is generated in `framelen` sample blocks right in the output's callback, one block per callback,
+    so the output only ever holds the block it is playing.  A `play` is mixed into the very next block, so it
+    is heard once the playing block finishes, i.e. within one output block (2.9ms at the default 128 samples
+    and 44.1kHz).  The sampler can feed an I2S/PWM device directly or be one leg of a `BackgroundAudioMixer`,
+    which adds its own buffering.
+
+    @tparam voices Number of simultaneous sounds
+    @tparam framelen Number of stereo samples generated per output block.  Smaller values lower trigger latency.
+*/
+template<size_t voices = 8, size_t framelen = 128>
+class BackgroundAudioSamplerClass {
+    static_assert(voices <= 256, "Voice handles only encode 256 voices");
+public:
+    BackgroundAudioSamplerClass() {
+        _out = nullptr;
+    }
+
+    /**
+        @brief Construct a sampler with a given AudioOutputBase
+
+        @param [in] d AudioOutputBase device (MixerInput or I2S or PWM, etc.) to play to
+    */
+    BackgroundAudioSamplerClass(AudioOutputBase &d) {
+        setDevice(&d);
+    }
+
+    /**
+        @brief Construct a sampler which will mix directly into the output's buffers
+
+        @param [in] d ZeroCopyAudioOutputBase device (i.e. MixerInput) to play to
+    */
+    BackgroundAudioSamplerClass(ZeroCopyAudioOutputBase &d) {
+        setDevice(&d);
+    }
+
+    ~BackgroundAudioSamplerClass() {}
+
+    /**
+        @brief Configure the output device before `begin`
+
+        @return True if successful
+    */
+    bool setDevice(AudioOutputBase *d) {
+        if (!_running) {
+            _out = d;
+            _zc = nullptr;
+            return true;
+        }
+        return false;
+    }
+
+    /**
+        @brief Configure an output device before `begin` which supports mixing in place
+
+        @return True if successful
+    */
+    bool setDevice(ZeroCopyAudioOutputBase *d) {
+        if (!_running) {
+            _out = d;
+            _zc = d;
+            return true;
+        }
+        return false;
+    }
+
+    /**
+        @brief Set the overall gain multiplier (volume) of the sampler.  Takes effect immediately.
+
+        @param [in] scale Floating point value from 0.0....16.0 to multiply the mix by
+    */
+    void setGain(float scale) {
+        _gain = (int32_t)(scale * (1 << 16));
+    }
+
+    /**
+        @brief Starts the sampler.  Will initialize the output device and start sending silence immediately.
+
+        @param [in] sampleRate Output sample rate in hertz.  Clips at other rates are resampled as they play.
+
+        @return True on success, false if already started.
+    */
+    bool begin(int sampleRate = 44100) {
+        if (!_out || _running) {
+            return false;
+        }
+        _sampleRate = sampleRate;
+        _out->setBuffers(_buffers, framelen);  // Framelen is in samples, but buffers takes words, which means 2 samples per word so we're good!
+        BA_INSTRUMENT(_instr.setOutput(_buffers, framelen));
+        BA_TRACE_NAME(this, "Sampler");
+        _out->onTransmit(&_cb, (void *)this);
+        _out->setBitsPerSample(16);
+        _out->setStereo(true);
+        _out->setFrequency(_sampleRate);
+        _out->begin();
+        _running = true;
+        pump();
+        return true;
+    }
+
+    /**
+        @brief Stops all voices and the calls the output device's end to shut it down, too.
+    */
+    void end() {
+        stopAll();
+        _out->end();
+        _running = false;
+    }
+
+    /**
+        @brief Start playing a clip on a free voice, stealing the oldest voice if none are free
+
+        @param [in] clip Clip to play.  The clip's sample data must remain valid while playing.
+        @param [in] gain Linear volume from 0.0 to 1.0
+        @param [in] pitch Playback speed multiplier, 1.0 is the natural pitch.  Limited to 0.0625...8.0
+        @param [in] loop True to repeat the clip until `stop` is called
+
+        @return Voice handle for `stop`, `setPitch`, etc., or -1 if the clip is not playable
+    */
+    int play(const BackgroundAudioClip &clip, float gain = 1.0, float pitch = 1.0, bool loop = false) {
+        if (!clip.valid()) {
+            return -1;
+        }
+
+        // Find a free voice, or failing that the oldest one
+        size_t idx = 0;
+        for (size_t i = 0; i < voices; i++) {
+            if (!_voice[i].active) {
+                idx = i;
+                break;
+            }
+            if ((int32_t)(_voice[i].age - _voice[idx].age) < 0) {
+                idx = i;
+            }
+        }
+
+        Voice *v = &_voice[idx];
+        noInterrupts();
+        if (v->active) {
+            _steals++;
+        }
+        v->clip = clip;
+        v->loop = loop;
+        v->gain = _toGain(gain);
+        v->step = _toStep(clip, pitch);
+        v->age = _age++;
+        v->gen++;
+        _restart(v);
+        v->frac = 0;
+        v->cur = _fetch(v);
+        v->next = _fetch(v);
+        v->active = true;
+        interrupts();
+        return (int)(((v->gen << 8) | idx) & 0x7fffffff);
+    }
+
+    /**
+        @brief Stop a voice immediately.  Handles of voices which have finished or been stolen are ignored.
+
+        @param [in] handle Voice handle returned by `play`
+    */
+    void stop(int handle) {
+        noInterrupts();
+        Voice *v = _find(handle);
+        if (v) {
+            v->active = false;
+        }
+        interrupts();
+    }
+
+    /**
+        @brief Stop all voices immediately
+    */
+    void stopAll() {
+        noInterrupts();
+        for (size_t i = 0; i < voices; i++) {
+            _voice[i].active = false;
+        }
+        interrupts();
+    }
+
+    /**
+        @brief Change a playing voice's gain.  Takes effect at the next output block.
+
+        @param [in] handle Voice handle returned by `play`
+        @param [in] gain Linear volume from 0.0 to 1.0
+    */
+    void setGain(int handle, float gain) {
+        noInterrupts();
+        Voice *v = _find(handle);
+        if (v) {
+            v->gain = _toGain(gain);
+        }
+        interrupts();
+    }
+
+    /**
+        @brief Change a playing voice's pitch.  Takes effect at the next output block.
+
+        @param [in] handle Voice handle returned by `play`
+        @param [in] pitch Playback speed multiplier, 1.0 is the natural pitch
+    */
+    void setPitch(int handle, float pitch) {
+        noInterrupts();
+        Voice *v = _find(handle);
+        if (v) {
+            v->step = _toStep(v->clip, pitch);
+        }
+        interrupts();
+    }
+
+    /**
+        @brief Change whether a playing voice loops.  Clearing it lets a looping sound finish its current pass.
+
+        @param [in] handle Voice handle returned by `play`
+        @param [in] loop True to repeat the clip
+    */
+    void setLoop(int handle, bool loop) {
+        noInterrupts();
+        Voice *v = _find(handle);
+        if (v) {
+            v->loop = loop;
+        }
+        interrupts();
+    }
+
+    /**
+        @brief Determine if a voice is still sounding
+
+        @param [in] handle Voice handle returned by `play`
+
+        @return True if the voice has not finished, been stopped, or been stolen
+    */
+    bool playing(int handle) {
+        noInterrupts();
+        bool ret = _find(handle) != nullptr;
+        interrupts();
+        return ret;
+    }
+
+    /**
+        @brief Get the number of voices currently sounding
+
+        @return Active voice count
+    */
+    size_t active() {
+        size_t cnt = 0;
+        for (size_t i = 0; i < voices; i++) {
+            cnt += _voice[i].active ? 1 : 0;
+        }
+        return cnt;
+    }
+
+    /**
+        @brief Get number of "frames" generated by the sampler
+
+        @return Number of frames, where frames are `framelen` stereo samples in size
+    */
+    uint32_t frames() {
+        return _frames;
+    }
+
+    /**
+        @brief Get the number of times a playing voice was cut off to start a new one since `begin`
+
+        @return Number of voices stolen
+    */
+    uint32_t steals() {
+        return _steals;
+    }
+
+#ifdef BACKGROUNDAUDIO_INSTRUMENT
+    /**
+        @brief Get the pump and frame timing statistics.  Only built with BACKGROUNDAUDIO_INSTRUMENT defined
+
+        @param [out] t Filled in with a consistent snapshot of the statistics
+    */
+    void getTiming(BackgroundAudioTiming *t) {
+        _instr.read(t);
+    }
+
+    /**
+        @brief Clear the timing statistics, taking effect at the start of the next pump
+    */
+    void resetTiming() {
+        _instr.reset();
+    }
+#endif
+
+private:
+    typedef struct Voice {
+        BackgroundAudioClip clip;
+        bool active = false;
+        bool loop;
+        int32_t gain;            // 16.16, <= 1.0
+        uint32_t step;           // 16.16 source samples per output sample
+        uint32_t frac;           // 16.16 fraction between cur and next
+        uint32_t age;            // Trigger order, for stealing
+        uint32_t gen = 0;        // Bumped every trigger so stale handles don't match
+        int16_t cur;
+        int16_t next;
+        size_t pos;              // Index of the next sample to fetch
+        const uint8_t *block;    // ADPCM block being decoded
+        size_t inBlock;          // ADPCM sample index within the block
+        IMAADPCMDecoder adpcm;
+    } Voice;
+
+    static void _cb(void *ptr) {
+        BA_TRACE(BA_TRACE_CALLBACK, ptr, 0);
+        ((BackgroundAudioSamplerClass*)ptr)->pump();
+    }
+
+    Voice *_find(int handle) {
+        if (handle < 0) {
+            return nullptr;
+        }
+        size_t idx = handle & 0xff;
+        if ((idx >= voices) || !_voice[idx].active || (((_voice[idx].gen << 8) & 0x7fffff00) != ((uint32_t)handle & 0x7fffff00))) {
+            return nullptr;
+        }
+        return &_voice[idx];
+    }
+
+    static int32_t _toGain(float gain) {
+        if (gain <= 0.0f) {
+            return 0;
+        } else if (gain >= 1.0f) {
+            return 1 << 16;
+        }
+        return (int32_t)(gain * (1 << 16));
+    }
+
+    uint32_t _toStep(const BackgroundAudioClip &clip, float pitch) {
+        if (pitch < 0.0625f) {
+            pitch = 0.0625f;
+        } else if (pitch > 8.0f) {
+            pitch = 8.0f;
+        }
+        return (uint32_t)(pitch * clip._sampleRate * 65536.0f / _sampleRate);
+    }
+
+    static void _restart(Voice *v) {
+        v->pos = 0;
+        v->block = v->clip._data;
+        v->inBlock = 0;
+    }
+
+    // Returns the next sample of the clip in order, looping or returning silence past the end
+    static int16_t _fetch(Voice *v) {
+        if (v->pos >= v->clip._samples) {
+            if (!v->loop) {
+                v->pos++;
+                return 0;
+            }
+            _restart(v);
+        }
+        v->pos++;
+        if (!v->clip._blockAlign) {
+            const uint8_t *b = v->clip._data + (v->pos - 1) * 2;
+            return (int16_t)(b[0] | (b[1] << 8));
+        }
+        if (v->inBlock == v->clip._samplesPerBlock) {
+            v->block += v->clip._blockAlign;
+            v->inBlock = 0;
+        }
+        const uint8_t *b = v->block;
+        size_t n = v->inBlock++;
+        if (!n) {
+            // The block header holds the first sample directly
+            int16_t s = (int16_t)(b[0] | (b[1] << 8));
+            v->adpcm.reset(s, b[2]);
+            return s;
+        }
+        n--;
+        uint8_t code = b[4 + (n >> 1)];
+        return v->adpcm.decode((n & 1) ? (code >> 4) : (code & 0x0f));
+    }
+
+    void _mixVoice(Voice *v, int32_t *acc) {
+        for (size_t i = 0; i < framelen; i++) {
+            int32_t s = v->cur + (((v->next - v->cur) * (int32_t)(v->frac >> 1)) >> 15);
+            acc[i] += (s * v->gain) >> 16;
+            v->frac += v->step;
+            while (v->frac >= (1 << 16)) {
+                v->frac -= 1 << 16;
+                v->cur = v->next;
+                v->next = _fetch(v);
+            }
+            if (v->pos > v->clip._samples + 1) {
+                // Interpolated all the way out to the silence after the last sample
+                v->active = false;
+                return;
+            }
+        }
+    }
+
+    void generateOneFrame(int16_t *dest) {
+        int32_t acc[framelen];
+        bzero(acc, sizeof(acc));
+        for (size_t i = 0; i < voices; i++) {
+            if (_voice[i].active) {
+                _mixVoice(&_voice[i], acc);
+            }
+        }
+        for (size_t i = 0; i < framelen; i++) {
+            int32_t s = (int32_t)(((int64_t)acc[i] * _gain) >> 16);
+            if (s > 32767) {
+                s = 32767;
+            } else if (s < -32767) {
+                s = -32767;
+            }
+            dest[i * 2] = s;
+            dest[i * 2 + 1] = s;
+        }
+        _frames++;
+    }
+
+    void pump() {
+        // Only replace the block that was just played, so nothing is queued behind the one playing and a
+        // trigger is never stuck behind an already rendered block
+        BA_INSTRUMENT(_instr.pumpBegin(_out->availableForWrite(), _sampleRate));
+        BA_TRACE(BA_TRACE_PUMP_BEGIN, this, _out->availableForWrite());
+        if (_out->availableForWrite() >= (int)(framelen * 2 * sizeof(int16_t))) {
+            size_t words = 0;
+            int16_t *dest = _zc ? (int16_t *)_zc->acquireWriteBuffer(&words) : nullptr;
+            if (words < framelen) {
+                dest = _outSample;
+            }
+            BA_INSTRUMENT(_instr.frameBegin());
+            BA_TRACE(BA_TRACE_FRAME_BEGIN, this, 0);
+            generateOneFrame(dest);
+            BA_TRACE(BA_TRACE_FRAME_END, this, 0);
+            BA_INSTRUMENT(_instr.frameEnd());
+            if (dest == _outSample) {
+                assert(_out->write((uint8_t *)_outSample, framelen * 2 * sizeof(int16_t)) == framelen * 2 * sizeof(int16_t));
+            } else {
+                _zc->commitWriteBuffer(framelen);
+            }
+        }
+        BA_TRACE(BA_TRACE_PUMP_END, this, 0);
+        BA_INSTRUMENT(_instr.pumpEnd());
+    }
+
+private:
+    AudioOutputBase *_out;
+    ZeroCopyAudioOutputBase *_zc = nullptr;
+    bool _running = false;
+    static const size_t _buffers = 2;           // The one playing and the one being rendered
+    int _sampleRate = 44100;
+    int32_t _gain = 1 << 16;
+    Voice _voice[voices];
+    uint32_t _age = 0;
+    int16_t _outSample[framelen * 2] __attribute__((aligned(4)));
+
+    uint32_t _frames = 0;
+    uint32_t _steals = 0;
+#ifdef BACKGROUNDAUDIO_INSTRUMENT
+    BackgroundAudioInstrument _instr;
+#endif
+};
+
+/**
+    @brief General purpose 8-voice sampler generating 128-sample blocks
+*/
+using BackgroundAudioSampler = BackgroundAudioSamplerClass<8, 128>;
@@ -21,18 +21,36 @@
 
 #pragma once
 #include <Arduino.h>
+#include <atomic>
+#include <type_traits>
 #include "WrappedAudioOutputBase.h"
 #include "BackgroundAudioGain.h"
 #include "BackgroundAudioBuffers.h"
+#include "BackgroundAudioInstrument.h"
+#include "BackgroundAudioTrace.h"
+#include "BackgroundAudioDispatch.h"
+#include "BackgroundAudioSpeechCache.h"
 #include "libespeak-ng/espeak-ng/speak_lib.h"
 #include "libespeak-ng/phoneme/phonindex.h"
 #include "libespeak-ng/phoneme/phontab.h"
 #include "libespeak-ng/phoneme/phondata.h"
 #include "libespeak-ng/phoneme/intonations.h"
 
-// These will be defined by including a language
-extern const unsigned char __espeakng_dict[];
-extern size_t __espeakng_dictlen;
+/**
+    @brief Structure to collect a compiled ESpeak-NG dictionary with its lookup index from tools/dictindex
+*/
+typedef struct {
+    /** Dictionary name used by ESpeak-NG voices ("en", "fr", ...) */
+    const char *name;
+    /** Size of the dictionary */
+    size_t len;
+    /** Dictionary pointer in ROM/flash */
+    const unsigned char *data;
+    /** Size of the index, or 0 if there is none */
+    size_t indexLen;
+    /** Index pointer in ROM/flash */
+    const unsigned char *index;
+} BackgroundAudioDictionary;
 
 /**
     @brief Structure to collect a ESpeak-NG voice with its human-readable name
@@ -44,16 +62,140 @@ typedef struct {
     size_t len; // Size of binary data
     /** Binary data pointer in ROM/flash */
     const unsigned char *data;
+    /** Dictionary the voice translates with */
+    const BackgroundAudioDictionary *dict;
 } BackgroundAudioVoice;
 
+/**
+    @brief ESpeak-NG state shared by every `BackgroundAudioSpeechClass` instance, whatever its template parameters
+
+    @details
+    Only one context may translate at a time.  On the RP2040 the audio context is a work IRQ on the app's core,
+    which never translates while `_translating` is held and puts back any ESpeak-NG state it changes before
+    returning, so interrupts only need masking for the handoff of the flag itself.  On the ESP32 the audio context
+    is a task which can run on the other core at the same time as the app, so every use of ESpeak-NG is also
+    serialized by a mutex, held by the app while it has the translator and by the pump while it works.
+*/
+class BackgroundAudioSpeechShared {
+protected:
+    /**
+        @brief Take the translator, and on the ESP32 ESpeak-NG as a whole
+
+        @param [in] fromAudio True from inside the pump, which on the ESP32 already holds the mutex
+
+        @return False if another context is translating
+    */
+    static bool _claim(bool fromAudio = false) {
+        if (!fromAudio) {
+            _lock();
+        }
+#ifndef ESP32
+        noInterrupts();
+#endif
+        bool busy = _translating;
+        _translating = true;
+#ifndef ESP32
+        interrupts();
+#endif
+        if (busy && !fromAudio) {
+            _unlock();
+        }
+        return !busy;
+    }
+
+    /**
+        @brief Give back the translator taken by `_claim`
+    */
+    static void _release(bool fromAudio = false) {
+        _translating = false;
+        if (!fromAudio) {
+            _doneContext();
+            _unlock();
+        }
+    }
+
+    /**
+        @brief The app is finished with the ESpeak-NG calls it started with `_useContext`
+    */
+    static void _doneContext() {
+        _appInside = false;
+    }
+
+    /**
+        @brief Keep the audio context on the other core out of ESpeak-NG.  Only needed, and only does anything, on the ESP32
+    */
+    static void _lock() {
+#ifdef ESP32
+        xSemaphoreTake(_mutex(), portMAX_DELAY);
+#endif
+    }
+
+    static void _unlock() {
+#ifdef ESP32
+        xSemaphoreGive(_mutex());
+#endif
+    }
+
+#ifdef ESP32
+    static SemaphoreHandle_t _mutex() {
+        static StaticSemaphore_t buff;
+        static SemaphoreHandle_t m = xSemaphoreCreateMutexStatic(&buff);
+        return m;
+    }
+#endif
+
+    static inline bool _initialized = false;          // ESpeak-NG's data has been loaded
+    static inline bool _defaultInUse = false;         // An instance is using ESpeak-NG's default context
+    static inline volatile bool _translating = false; // Only one instance may be translating at a time
+    static inline void * volatile _listOwner = nullptr; // Instance whose clause is held in ESpeak-NG's phoneme list
+    static inline volatile bool _appInside = false;   // The app is part way through ESpeak-NG calls in its instance's context
+    static inline int _sampleRate = 0;
+};
 
 /**
     @brief Interrupt-driven ESpeak-NG instance.  Generates a full frame of samples each cycle and uses the RawBuffer to safely hand data from the app to the decompressor.
 
+    @details
+    Speech is generated in two stages.  Text to phoneme translation (clause splitting, dictionary lookups,
+    number expansion, and intonation) runs in the application's context from `speak`, `write`, `done`,
+    or `update`, and the resulting phoneme lists are stored in a bounded clause queue.  The audio context
+    only turns queued phoneme lists into samples, so its worst-case time does not depend on the text.
+
+    If the queue runs dry while text is still waiting because the app has not called in, a single
+    clause is translated in the audio context as a fallback, counted by `fallbacks`.  On the ESP32, where
+    the audio task may run on the other core, it waits for the app to finish translating instead of running
+    alongside it, with the output's buffers covering the wait.
+
+    Calling `setVoice` while speaking switches voices and languages at the start of the next string, in order with
+    everything already queued, so nothing needs to be flushed or waited on.  Each voice is parsed only the first time
+    it is used and kept, along with its translator and dictionary, for later switches.  Every included dictionary stays
+    in flash and is used in place, so any number of languages can be mixed.
+
+    With a `BackgroundAudioSpeechCache` attached by `setCache`, strings which have been spoken before with the
+    same settings are played from the cache instead of being translated and synthesized again.
+
+    Several instances can take turns speaking, for example into different inputs of a `BackgroundAudioMixer`.  Each
+    one after the first gets its own ESpeak-NG context (around 30KB) holding its voice, settings, and wave generator.
+    ESpeak-NG keeps that state in globals, so switching from one instance to another copies several KB out and back
+    in.  A context stays current until another instance is worked on, so a lone speaker never switches, but two
+    speakers whose buffers are refilled alternately switch on every refill.  The loaded data, dictionaries, voice
+    cache, and arena are shared, as is the translator itself, so instances take turns translating clauses.  Nothing
+    runs in parallel: all instances must be pumped from the same core, and one synthesizes while the others wait.
+
+    Text is read a clause at a time, and the buffer space of each clause is freed as soon as it has been translated.
+    A string longer than the buffer can be written in pieces as room is made, with clauses spoken once a break
+    (punctuation and a space) has arrived after them.  With `ROMBackgroundAudioSpeech` text in flash is spoken in
+    place, with no copy at all.
+
     @tparam DataBuffer The type of raw data buffer, either normal `RawDataBuffer` or `ROMDataBuffer` as appropriate.
+    @tparam clauseBytes Size of the translated clause queue.  Each phoneme takes 32 bytes, so ordinary clauses are around 700 to
+    1400 bytes and the default holds two or three of them ahead.  Clauses over half this size (around 60 phonemes, i.e. a long
+    unpunctuated run of words) aren't copied but are generated straight from ESpeak-NG's own phoneme list, which keeps any other
+    instances from translating until the clause has been spoken.  Raise it if several instances often speak long sentences at
+    once, lower it to save RAM at the cost of more clauses taking that path.
 */
-template<class DataBuffer>
-class BackgroundAudioSpeechClass {
+template<class DataBuffer, size_t clauseBytes = 4096>
+class BackgroundAudioSpeechClass : protected BackgroundAudioSpeechShared {
 public:
     BackgroundAudioSpeechClass() {
         _playing = false;
@@ -102,11 +244,62 @@ public:
     /**
         @brief Sets the voice parameters (language customization)
 
-        @param [in] v Voice (voice_xxx) included from in libespeak-ng/dict folder
+        @details
+        Before `begin` this selects the starting voice.  Afterwards the change is queued and takes effect with the
+        next string given to `speak` or `write`, while anything already written is still spoken with the old
+        voice.  The first use of each voice parses it and keeps the result (around 10KB) so switching back to it
+        later costs nothing.  Up to 8 different voices can be used.
+
+        @param [in] v Voice (voice_xxx) included from in libespeak-ng/voice folder
+
+        @return True on success, false if the voice could not be loaded
     */
-    void setVoice(BackgroundAudioVoice &v) {
-        _voice = v.data;
-        _voiceLen = v.len;
+    bool setVoice(BackgroundAudioVoice &v) {
+        if (!_playing) {
+            _voice = v.data;
+            _voiceLen = v.len;
+            _dict = v.dict;
+            return true;
+        }
+
+        // Parse the voice now, in the app's context, unless the audio context happens to be translating
+        if (!_claim()) {
+            return false;
+        }
+        _useContext();
+        int id = -1;
+        if (!espeak_RegisterDict(v.dict->name, v.dict->data, v.dict->len, v.dict->index, v.dict->indexLen)) {
+            id = espeak_CacheVoice(v.data, v.len);
+        }
+        if (id >= 0) {
+            _nextVoice = (id == _voiceId) ? -1 : id;
+            _nextVoiceData = v.data;
+            _nextVoiceLen = v.len;
+        }
+        _release();
+        return id >= 0;
+    }
+
+    /**
+        @brief Makes another dictionary available for words the current voice marks as foreign
+
+        @details
+        Some languages speak certain words (English words in a Spanish text, for example) with another language's
+        rules.  Those words are only translated that way if the other language's dictionary (dict_xxx, included from
+        the libespeak-ng/dict folder) has been added, otherwise they are spoken with the current voice's rules.
+        Dictionaries of voices given to `setVoice` are added automatically.  Up to 16 dictionaries can be in use.
+
+        @param [in] d Dictionary to add
+
+        @return True on success
+    */
+    bool addDictionary(BackgroundAudioDictionary &d) {
+        if (!_claim()) {
+            return false;
+        }
+        bool ok = !espeak_RegisterDict(d.name, d.data, d.len, d.index, d.indexLen);
+        _release();
+        return ok;
     }
 
     /**
@@ -115,7 +308,12 @@ public:
         @param [in] rate WPM rate
     */
     void setRate(int rate) {
+        _lock();
+        _useContext();
         espeak_SetParameter(espeakRATE, rate, 0);
+        _doneContext();
+        _unlock();
+        _rate = rate;
     }
 
     /**
@@ -124,7 +322,12 @@ public:
         @param [in] pitch Pitch setting
     */
     void setPitch(int pitch) {
+        _lock();
+        _useContext();
         espeak_SetParameter(espeakPITCH, pitch, 0);
+        _doneContext();
+        _unlock();
+        _pitch = pitch;
     }
 
     /**
@@ -133,7 +336,49 @@ public:
         @param [in] gap Gap in ~10ms units at normal rate
     */
     void setWordGap(int gap) {
+        _lock();
+        _useContext();
         espeak_SetParameter(espeakWORDGAP, gap, 0);
+        _doneContext();
+        _unlock();
+        _wordGap = gap;
+    }
+
+    /**
+        @brief Play repeated phrases from a phrase cache instead of synthesizing them each time.  Before `begin`
+
+        @param [in] c Cache to use, or `nullptr` to stop caching
+        @return True on success
+    */
+    bool setCache(BackgroundAudioSpeechCache *c) {
+        if (!_playing) {
+            _cache = c;
+            return true;
+        }
+        return false;
+    }
+
+    /**
+        @brief Give ESpeak-NG a fixed block of memory for its working buffers instead of the heap.  Before `begin`
+
+        @details
+        Translating a clause needs up to around 50KB of temporary buffers, which are all released when the clause is
+        done.  With an arena they are carved out of it instead of being allocated and freed on the heap, so heap
+        fragmentation can't cause a failure mid-sentence.  Use `arenaHighWater` to size it for the text being spoken.
+        Any buffer which doesn't fit is still taken from the heap, counted by `arenaOverflows`.
+        With several instances only the arena of the first one to `begin` is used, and is shared by all of them.
+
+        @param [in] mem Memory to use, or `nullptr` to use the heap
+        @param [in] len Size of the memory in bytes
+        @return True on success
+    */
+    bool setArena(void *mem, size_t len) {
+        if (!_playing) {
+            _arena = mem;
+            _arenaLen = len;
+            return true;
+        }
+        return false;
     }
 
     /**
@@ -142,36 +387,63 @@ public:
         @return True on success, false if already started.
     */
     bool begin() {
-        if (_playing || !_voice || !_voiceLen || !_out) {
+        if (_playing || !_voice || !_voiceLen || !_dict || !_out) {
             return false;
         }
 
-#ifdef ARDUINO_ARCH_RP2040
-        _workIRQ = user_irq_claim_unused(true);
-        _workObj = this;
-        irq_set_exclusive_handler(_workIRQ, _irqStub);
-        irq_set_priority(_workIRQ, 0xc0); // Lowest prio
-        irq_set_enabled(_workIRQ, true);
-#endif
+        if (!_claim()) {
+            return false;
+        }
 
-        espeak_EnableSingleStep();
-        espeak_InstallDict(__espeakng_dict, __espeakng_dictlen);
-        espeak_InstallPhonIndex(_phonindex, sizeof(_phonindex));
-        espeak_InstallPhonTab(_phontab, sizeof(_phontab));
-        espeak_InstallPhonData(_phondata, sizeof(_phondata));
-        espeak_InstallIntonations(_intonations, sizeof(_intonations));
-        espeak_InstallVoice(_voice, _voiceLen);
+        if (!_initialized) {
+            // The first instance loads everything, and its arena is the one used by all instances
+            espeak_EnableSingleStep();
+            espeak_SetArena(_arena, _arenaLen);
+            espeak_RegisterDict(_dict->name, _dict->data, _dict->len, _dict->index, _dict->indexLen);
+            espeak_InstallPhonIndex(_phonindex, sizeof(_phonindex));
+            espeak_InstallPhonTab(_phontab, sizeof(_phontab));
+            espeak_InstallPhonData(_phondata, sizeof(_phondata));
+            espeak_InstallIntonations(_intonations, sizeof(_intonations));
+            espeak_InstallVoice(_voice, _voiceLen);
+            _sampleRate = espeak_Initialize(AUDIO_OUTPUT_SYNCH_PLAYBACK, 20, nullptr, 0);
+            espeak_SetSynthCallback(_speechCB);
+            _initialized = true;
+        } else {
+            espeak_RegisterDict(_dict->name, _dict->data, _dict->len, _dict->index, _dict->indexLen);
+        }
+        if (_defaultInUse) {
+            // Other instances are speaking, so this one needs a context of its own
+            noInterrupts();
+            _ctx = espeak_CreateContext();
+            interrupts();
+            if (!_ctx) {
+                _release();
+                return false;
+            }
+        } else {
+            _ctx = nullptr;
+            _defaultInUse = true;
+        }
+        _useContext();
+        espeak_AbortSynthesis(_ctx); // In case the default context was left speaking by an ended instance
+        _voiceId = espeak_CacheVoice(_voice, _voiceLen);
+        _nextVoice = -1;
+        espeak_SelectVoice(_ctx, _voiceId);
+        espeak_GenerateVoice(_ctx, _voiceId);
+        _release();
 
-        int samplerate = espeak_Initialize(AUDIO_OUTPUT_SYNCH_PLAYBACK, 20, nullptr, 0);
-        espeak_SetVoiceByFile("INTERNAL");
-        espeak_SetSynthCallback(_speechCB);
+#ifdef ARDUINO_ARCH_RP2040
+        BackgroundAudioDispatcher::attach(&_work, _out, 5 * framelen * 4);
+#endif
 
         // We will use natural frame size to minimize mismatch
         _out->setBuffers(5, framelen);
+        BA_INSTRUMENT(_instr.setOutput(5, framelen));
+        BA_TRACE_NAME(this, "Speech");
         _out->onTransmit(&_cb, (void *)this); // The pump we will use to generate our audio
         _out->setBitsPerSample(16);
         _out->setStereo(true);
-        _out->setFrequency(samplerate);
+        _out->setFrequency(_sampleRate);
         _out->begin();
 
         // Stuff with silence to start
@@ -191,10 +463,22 @@ public:
     void end() {
         if (_playing) {
 #ifdef ARDUINO_ARCH_RP2040
-            irq_set_enabled(_workIRQ, false);
-            user_irq_unclaim(_workIRQ);
+            BackgroundAudioDispatcher::detach(&_work);
 #endif
             _out->end();
+            _lock();
+            noInterrupts();
+            if (_listOwner == this) {
+                _listOwner = nullptr;
+            }
+            if (_ctx) {
+                espeak_DeleteContext(_ctx);
+                _ctx = nullptr;
+            } else {
+                _defaultInUse = false;
+            }
+            interrupts();
+            _unlock();
         }
         _playing = false;
     }
@@ -216,6 +500,10 @@ public:
            and can write less fewer than the number of bytes requested if there is not enough space.
            Will not block.
 
+           Each string ends with a NUL, but it does not need to be written all at once.  Whole clauses are
+           translated as they arrive and their space is freed, so a long document can be streamed through
+           the buffer by writing the rest of it as `availableForWrite` allows.
+
            For ROM buffers this does not actually copy data, only the pointer.  Therefore, for ROM
            buffers you cannot concatenate data by calling multiple writes because the second write
            will throw out all the data from the first one.  Use `flush` and `write` when ready for
@@ -227,20 +515,43 @@ public:
            @return Number of bytes written
     */
     size_t write(const void *data, size_t len) {
-        return _ib.write((const uint8_t *)data, len);
+        size_t ret = _ib.write((const uint8_t *)data, len);
+        BA_TRACE(BA_TRACE_WRITE, this, ret);
+        update();
+        return ret;
+    }
+
+    /**
+        @brief Translate waiting text into phonemes for the audio context, in the caller's context
+
+        @details
+        Translates clauses until all text written so far has been translated or the clause queue is full.
+        This is called by `speak`, `write`, and `done`, so applications which poll those do not need to
+        call it.  An app which speaks long passages without calling them should call `update` from `loop`
+        to keep the translation work out of the audio context.
+    */
+    void update() {
+        if (_playing) {
+            _translate(false);
+        }
     }
 
     /**
         @brief Speaks a C-String
 
+        @details
+        For ROM speakers the string is not copied, so it needs to stay valid (in flash) until it is spoken, and it
+        is only accepted once all the text given before has been translated.
+
         @param [in] string The string to speak.  Data is copied so this string can disappear afterwards
         @returns Number of bytes actually written to the buffer, or 0 on error (out of space)
     */
     size_t speak(const char *string) {
-        if (availableForWrite() < strlen(string)) {
+        size_t len = strlen(string) + 1;
+        if (std::is_same<DataBuffer, ROMDataBuffer>::value ? available() : (availableForWrite() < len)) {
             return 0; // All or nothing
         }
-        return write((const void *)string, strlen(string) + 1);
+        return write((const void *)string, len);
     }
 
     /**
@@ -284,7 +595,8 @@ public:
           @return True if no raw strings still left to process
     */
     bool done() {
-        return !available() && !_generatingSpeech;
+        update();
+        return !available() && !_generatingSpeech && !_pendingClause && !_globalClause && !_mark && (_playEntry < 0) && (_clauseHead.load() == _clauseTail.load());
     }
 
     /**
@@ -332,6 +644,33 @@ public:
         return _dumps;
     }
 
+    /**
+        @brief Get the number of clauses which had to be translated in the audio context since `begin`
+
+        @return Number of clauses translated in the audio context because the queue ran dry
+    */
+    uint32_t fallbacks() {
+        return _fallbacks;
+    }
+
+    /**
+        @brief Get the most working buffer memory ESpeak-NG has needed at once, whether from the arena or the heap
+
+        @return Bytes needed for `setArena` to hold all the buffers used so far
+    */
+    size_t arenaHighWater() {
+        return espeak_ArenaHighWater();
+    }
+
+    /**
+        @brief Get the number of working buffers which did not fit in the `setArena` memory
+
+        @return Number of buffers taken from the heap instead
+    */
+    uint32_t arenaOverflows() {
+        return espeak_ArenaOverflows();
+    }
+
     /**
            @brief Pause the decoder.  Won't process raw input data and will transmit silence
     */
@@ -364,27 +703,75 @@ public:
             in one after the other with `write` or `speak`
     */
     void flush() {
-        noInterrupts();
+        // Only the handoff masks interrupts.  While _flushing is set the audio context sends silence and leaves
+        // this instance's state alone, so the reset itself can take as long as it needs
+        while (!_claim()) {
+            delay(1); // Another instance's audio context is translating a clause
+        }
+        _flushing = true;
+        _useContext();
         _ib.flush();
         _generatingSpeech = false;
+        _frameLen = 0;
         short *mono;
-        espeak_SynthesizeOneStep(&mono); // Thrown out
-        espeak_AbortSynthesis();
-        interrupts();
+        espeak_SynthesizeOneStep(_ctx, &mono); // Thrown out
+        espeak_AbortSynthesis(_ctx);
+        espeak_GenerateVoice(_ctx, _voiceId); // Any queued voice change was thrown out with the clauses
+        _textLen = 0;
+        _inText = false;
+        _textEnd = false;
+        _scanned = 0;
+        _breakEnd = 0;
+        _pendingClause = 0;
+        _globalClause = false;
+        if (_listOwner == this) {
+            _listOwner = nullptr;
+        }
+        _clauseHead.store(0);
+        _clauseTail.store(0);
+        _mark = 0;
+        _recordingText = false;
+        _recEntry = -1;
+        _playEntry = -1;
+        if (_cache) {
+            _cache->_reset();
+        }
+        _flushing = false;
+        _release();
+    }
+
+#ifdef BACKGROUNDAUDIO_INSTRUMENT
+    /**
+        @brief Get the pump and frame timing statistics.  Only built with BACKGROUNDAUDIO_INSTRUMENT defined
+
+        @param [out] t Filled in with a consistent snapshot of the statistics
+    */
+    void getTiming(BackgroundAudioTiming *t) {
+        _instr.read(t);
+    }
+
+    /**
+        @brief Clear the timing statistics, taking effect at the start of the next pump
+    */
+    void resetTiming() {
+        _instr.reset();
     }
+#endif
 
 private:
 #ifdef ARDUINO_ARCH_RP2040
-    static void _irqStub() {
-        BackgroundAudioSpeechClass<DataBuffer>::_workObj->pump();
+    static void _irqStub(void *ptr) {
+        ((BackgroundAudioSpeechClass *)ptr)->pump();
     }
 
     static void _cb(void *ptr) {
+        BA_TRACE(BA_TRACE_CALLBACK, ptr, 0);
         // Don't actually do work in the DMA interrupt, do it in the work IRQ context (low prio)
-        irq_set_pending(BackgroundAudioSpeechClass<DataBuffer>::_workIRQ);
+        BackgroundAudioDispatcher::post(&((BackgroundAudioSpeechClass *)ptr)->_work);
     }
 #else
     static void _cb(void *ptr) {
+        BA_TRACE(BA_TRACE_CALLBACK, ptr, 0);
         ((BackgroundAudioSpeechClass*)ptr)->pump();
     }
 #endif
@@ -393,27 +780,332 @@ private:
         return 0; // Should never really be called by ESpeak internals
     }
 
+    /**
+        @brief Make this instance's ESpeak-NG context the current one, for calls which don't take a context
+
+        @details
+        Contexts are only switched when needed and are left in place afterwards, so a lone speaker never switches
+        at all.  From the app this marks it as inside ESpeak-NG until `_doneContext`, so an audio context which
+        interrupts it puts the app's context back before returning.
+
+        @param [in] fromAudio True from inside the pump, which has switched to this instance's context already
+    */
+    void _useContext(bool fromAudio = false) {
+        noInterrupts();
+        espeak_SetContext(_ctx);
+        if (!fromAudio) {
+            _appInside = true;
+        }
+        interrupts();
+    }
+
+    /**
+        @brief Translate text into the clause queue.  In the audio context only translates one clause, and only if nobody else is.
+
+        @return Number of clauses translated
+    */
+    int _translate(bool fromAudio) {
+        if (!_claim(fromAudio)) {
+            return 0;
+        }
+        _useContext(fromAudio);
+
+        int clauses = 0;
+        // ESpeak-NG's phoneme list is in use by the audio context until it's done, or by another instance's clause
+        while (!_globalClause && (!_listOwner || (_listOwner == this))) {
+            if (_mark) {
+                if (!_pushMark()) {
+                    break;
+                }
+                continue;
+            }
+            if (!_textEnd && !_pendingClause) {
+                // Take in as much of the string as has been written
+                const uint8_t *b = _ib.buffer();
+                size_t avail = _ib.available();
+                if (!avail && !_inText) {
+                    break;
+                }
+                _scanText(b, avail);
+                size_t len = avail;
+                if (_scanned < avail) {
+                    len = _scanned + 1; // Up to and including the NUL
+                    _textEnd = true;
+                } else if (!_breakEnd && !_ib.availableForWrite()) {
+                    _textEnd = true; // Full (or ROM) with no end or clause break, so speak what's here as a whole string
+                } else if (!_breakEnd) {
+                    break; // Wait until at least one whole clause is here
+                }
+                if (!_inText) {
+                    if (_nextVoice >= 0) {
+                        // Switch voices between strings, and have the audio context follow once it gets here
+                        espeak_SelectVoice(_ctx, _nextVoice);
+                        _voiceId = _nextVoice;
+                        _voice = _nextVoiceData;
+                        _voiceLen = _nextVoiceLen;
+                        _nextVoice = -1;
+                        _mark = _clauseVoice;
+                        _markEntry = _voiceId;
+                        _textEnd = false;
+                        continue;
+                    }
+                    if (_cache && _textEnd) {
+                        // Only strings which are all here can be looked up
+                        bool hit;
+                        int e = _cache->_lookup(_voice, _settings(), b, _scanned, &hit);
+                        if (hit) {
+                            // Play the stored phrase instead, the text is no longer needed
+                            _consumeText(len);
+                            _textEnd = false;
+                            _mark = _clauseCached;
+                            _markEntry = e;
+                            continue;
+                        } else if (e >= 0) {
+                            _mark = _clauseRecord;
+                            _markEntry = e;
+                            _recordingText = true;
+                        }
+                    }
+                    espeak_SynthDeferred(_ctx, b, len, espeakCHARS_AUTO);
+                    _inText = true;
+                } else if (len != _textLen) {
+                    espeak_ContinueText(_ctx, b, len);
+                }
+                _textLen = len;
+                if (_mark) {
+                    continue; // Queue the recording marker ahead of the string's clauses
+                }
+            }
+            if (!_pendingClause) {
+                if (fromAudio && clauses) {
+                    break;
+                }
+                _pendingClause = espeak_TranslateNextClause(_ctx);
+                if (_pendingClause) {
+                    _listOwner = this;
+                    // The text this clause was read from isn't needed any more, so make room for more
+                    size_t left = espeak_TextRemaining(_ctx);
+                    if (left < _textLen) {
+                        _consumeText(_textLen - left);
+                        _textLen = left;
+                        espeak_ContinueText(_ctx, _ib.buffer(), left);
+                    }
+                } else {
+                    // All of this string is now phonemes
+                    _consumeText(_textLen);
+                    _textLen = 0;
+                    _inText = false;
+                    _textEnd = false;
+                    if (_recordingText) {
+                        _mark = _clauseRecordEnd;
+                        _recordingText = false;
+                    }
+                    continue;
+                }
+                clauses++;
+            }
+            if (!_pushClause()) {
+                break;  // Queue full, the translated clause will wait in ESpeak-NG's phoneme list
+            }
+        }
+
+        _release(fromAudio);
+        return clauses;
+    }
+
+    /**
+        @brief Scan newly written text for the end of the string and for clause breaks, without rescanning what was already seen
+    */
+    void _scanText(const uint8_t *b, size_t avail) {
+        while ((_scanned < avail) && b[_scanned]) {
+            // A break is punctuation and whitespace followed by another word, plus a byte ESpeak-NG may peek at.
+            // A dot followed by a lower case word is left alone, since ESpeak-NG reads it as an abbreviation.
+            size_t i = _scanned++;
+            if ((i >= 2) && !isspace(b[i - 1]) && isspace(b[i - 2])) {
+                size_t p = i - 2;
+                while (p && isspace(b[p])) {
+                    p--;
+                }
+                if (strchr(".!?,;:", b[p]) && ((b[p] != '.') || !islower(b[i - 1]))) {
+                    _breakEnd = p + 1;
+                }
+            }
+        }
+    }
+
+    /**
+        @brief Throw away text ESpeak-NG has finished reading, making room for more
+    */
+    void _consumeText(size_t n) {
+        BA_TRACE(BA_TRACE_SHIFT_BEGIN, this, n);
+        _ib.shiftUp(n);
+        BA_TRACE(BA_TRACE_SHIFT_END, this, 0);
+        _shifts++;
+        _scanned = (_scanned > n) ? _scanned - n : 0;
+        _breakEnd = (_breakEnd > n) ? _breakEnd - n : 0;
+    }
+
+    /**
+        @brief Find room for `need` bytes at the head of the clause queue.  Only called by the translating context
+
+        @return Offset to store at, or -1 if the queue is full
+    */
+    int _queueSpace(size_t need) {
+        size_t head = _clauseHead.load(std::memory_order_relaxed);
+        size_t tail = _clauseTail.load(std::memory_order_acquire);
+        if (head >= tail) {
+            if ((clauseBytes - head > need) || ((clauseBytes - head == need) && tail)) {
+                return head;
+            } else if (tail > need) {
+                *(uint32_t *)&_clauseBuff[head] = _clauseWrap;
+                return 0;
+            }
+        } else if (tail - head > need) {
+            return head;
+        }
+        return -1;
+    }
+
+    /**
+        @brief Move the last translated clause into the queue.  Only called by the translating context
+    */
+    bool _pushClause() {
+        bool global = _pendingClause + _clauseHdr > clauseBytes / 2;
+        size_t need = _clauseHdr + (global ? 0 : (_pendingClause + 7) & ~7);
+        int at = _queueSpace(need);
+        if (at < 0) {
+            return false;
+        }
+        if (global) {
+            // Too big to copy, generate straight from ESpeak-NG's list and stop translating until done
+            *(uint32_t *)&_clauseBuff[at] = _clauseGlobal;
+            _globalClause = true;
+        } else {
+            *(uint32_t *)&_clauseBuff[at] = _pendingClause;
+            espeak_StoreClause(&_clauseBuff[at + _clauseHdr]);
+            _listOwner = nullptr;
+        }
+        _pendingClause = 0;
+        _clauseHead.store((at + need) % clauseBytes, std::memory_order_release);
+        return true;
+    }
+
+    /**
+        @brief Queue a phrase cache or voice change marker in order with the clauses.  Only called by the translating context
+    */
+    bool _pushMark() {
+        int at = _queueSpace(_clauseHdr);
+        if (at < 0) {
+            return false;
+        }
+        uint32_t *hdr = (uint32_t *)&_clauseBuff[at];
+        hdr[0] = _mark;
+        hdr[1] = _markEntry;
+        _mark = 0;
+        _clauseHead.store((at + _clauseHdr) % clauseBytes, std::memory_order_release);
+        return true;
+    }
+
+    /**
+        @brief Pack the settings which change the synthesized audio, for the phrase cache key
+    */
+    uint32_t _settings() {
+        return ((_rate & 0xfff) << 20) | ((_pitch & 0xff) << 12) | (_wordGap & 0xfff);
+    }
+
+    /**
+        @brief Get the oldest queued clause without removing it, or `nullptr` if empty.  Only called by the audio context
+    */
+    uint32_t *_peekClause() {
+        size_t tail = _clauseTail.load(std::memory_order_relaxed);
+        size_t head = _clauseHead.load(std::memory_order_acquire);
+        if (tail == head) {
+            return nullptr;
+        }
+        uint32_t *hdr = (uint32_t *)&_clauseBuff[tail];
+        if (*hdr == _clauseWrap) {
+            _clauseTail.store(0, std::memory_order_release);
+            hdr = (uint32_t *)_clauseBuff;
+        }
+        return hdr;
+    }
+
+    /**
+        @brief Remove the oldest queued clause once it has been generated.  Only called by the audio context
+    */
+    void _popClause() {
+        size_t tail = _clauseTail.load(std::memory_order_relaxed);
+        uint32_t hdr = *(uint32_t *)&_clauseBuff[tail];
+        size_t need = _clauseHdr + ((hdr >= _clauseMarks) ? 0 : (hdr + 7) & ~7);
+        _clauseTail.store((tail + need) % clauseBytes, std::memory_order_release);
+        if (hdr == _clauseGlobal) {
+            _globalClause = false;
+            _listOwner = nullptr;
+        }
+    }
+
     void generateOneFrame() {
         _frameLen = 0;
 
-        // If we're not currently synthesizng speech, is there another string we can say?
-        if (!_generatingSpeech) {
-            if (_ib.available()) {
-                const uint8_t *b = _ib.buffer();
-                for (int i = 0; i < (int)_ib.available(); i++) {
-                    if (!b[i]) {
-                        espeak_Synth(_ib.buffer(), i, 0, (espeak_POSITION_TYPE)0, 0, espeakCHARS_AUTO, 0, this);
-                        _generatingSpeech = true;
-                        break;
+        // If we're not currently synthesizng speech, is there another clause we can say?
+        while (!_generatingSpeech && (_playEntry < 0)) {
+            uint32_t *c = _peekClause();
+            if (!c && _translate(true)) {
+                _fallbacks++;
+                c = _peekClause();
+            }
+            if (!c) {
+                break;
+            } else if (*c == _clauseCached) {
+                _playEntry = c[1];
+                _cache->_open(_playEntry, &_reader);
+            } else if (*c == _clauseRecord) {
+                _recEntry = c[1];
+                _recSamples = 0;
+                _recEncoder.reset();
+                _popClause();
+            } else if (*c == _clauseVoice) {
+                espeak_GenerateVoice(_ctx, c[1]);
+                _popClause();
+            } else if (*c == _clauseRecordEnd) {
+                if (_recEntry >= 0) {
+                    if (_recSamples & 1) {
+                        _recCodes[0] = _recNibble;
+                        _cache->_append(_recEntry, _recCodes, 1);
                     }
+                    _cache->_finish(_recEntry, _recSamples);
+                    _recEntry = -1;
                 }
+                _popClause();
+            } else {
+                espeak_GenerateClause(_ctx, (*c == _clauseGlobal) ? nullptr : (c + _clauseHdr / sizeof(uint32_t)));
+                _generatingSpeech = true;
+            }
+        }
+
+        if (_playEntry >= 0) {
+            // Decode the cached phrase into the back half of the frame, then spread it to stereo
+            int16_t *mono = &_frame[framelen];
+            _frameLen = _cache->_read(&_reader, mono, framelen);
+            for (int i = 0; i < _frameLen; i++) {
+                _frame[i * 2] = mono[i];
+                _frame[i * 2 + 1] = mono[i];
+            }
+            ApplyGain(_frame, _frameLen * 2, _gain);
+            if (!_reader.left) {
+                _cache->_unpin(_playEntry);
+                _playEntry = -1;
+                _popClause();
             }
         }
 
         if (_generatingSpeech && !_frameLen) {
             // Generate the raw samples
             short *mono;
-            _frameLen = std::min(espeak_SynthesizeOneStep(&mono), framelen);
+            _frameLen = std::min(espeak_SynthesizeOneStep(_ctx, &mono), framelen);
+            if (_recEntry >= 0) {
+                _record(mono, _frameLen);
+            }
             // Now convert to stereo by duplicating channels, store in frame buffer
             int16_t *ptr = _frame;
             for (int i = 0; i < _frameLen; i++) {
@@ -422,24 +1114,60 @@ private:
             }
             // Amplify if requested
             ApplyGain(_frame, _frameLen * 2, _gain);
-            // Advance synthesis state and check if done
-            if (!espeak_SynthesisGenerateNext()) {
+            // Advance synthesis state and check if this clause is done
+            if (!espeak_ClauseGenerateNext(_ctx)) {
                 _generatingSpeech = false;
-                _ib.shiftUp(strlen((const char *)_ib.buffer()) + 1); // Only shift out the speech once it's done speaking, easier to track
-                _shifts++;
+                _popClause();
+            }
+        }
+    }
+
+    /**
+        @brief Compress newly synthesized samples into the phrase being recorded
+    */
+    void _record(const short *mono, int count) {
+        size_t n = 0;
+        for (int i = 0; i < count; i++) {
+            uint8_t code = _recEncoder.encode(mono[i]);
+            if (!(_recSamples++ & 1)) {
+                _recNibble = code;
+            } else {
+                _recCodes[n++] = _recNibble | (code << 4);
+                if (n == sizeof(_recCodes)) {
+                    if (!_cache->_append(_recEntry, _recCodes, n)) {
+                        _recEntry = -1; // Out of space, the cache dropped the phrase
+                        return;
+                    }
+                    n = 0;
+                }
             }
         }
+        if (n && !_cache->_append(_recEntry, _recCodes, n)) {
+            _recEntry = -1;
+        }
     }
 
 #ifdef ARDUINO_ARCH_RP2040
 public:
 #endif
     void pump() {
+        BA_INSTRUMENT(_instr.pumpBegin(_out->availableForWrite(), _sampleRate));
+        BA_TRACE(BA_TRACE_PUMP_BEGIN, this, _out->availableForWrite());
+        _lock();
+        bool flushing = _flushing; // Being reset by the app, so don't touch ESpeak-NG or the clauses
+        // Each switch copies all of ESpeak-NG's per-context state, so only switch back if the app was interrupted
+        // in the middle of using its own.  Otherwise this context stays current until another instance needs its own
+        bool restore = !flushing && _appInside;
+        espeak_CONTEXT *prev = flushing ? nullptr : espeak_SetContext(_ctx);
         while (_out->availableForWrite() >= (int)(framelen * 4)) {
-            if (!_frameLen && !_paused) {
+            if (!_frameLen && !_paused && !flushing) {
+                BA_INSTRUMENT(_instr.frameBegin());
+                BA_TRACE(BA_TRACE_FRAME_BEGIN, this, 0);
                 generateOneFrame();
+                BA_TRACE(BA_TRACE_FRAME_END, this, 0);
+                BA_INSTRUMENT(_instr.frameEnd());
             }
-            if (_paused || !_frameLen) {
+            if (_paused || flushing || !_frameLen) {
                 bzero(_frame, sizeof(_frame));
                 assert(_out->write((uint8_t *)_frame, sizeof(_frame)) == sizeof(_frame));
             } else {
@@ -447,31 +1175,81 @@ public:
                 _frameLen = 0;
             }
         }
-#ifdef ARDUINO_ARCH_RP2040
-        irq_clear(_workIRQ);
-#endif
+        if (restore) {
+            espeak_SetContext(prev);
+        }
+        _unlock();
+        BA_TRACE(BA_TRACE_PUMP_END, this, 0);
+        BA_INSTRUMENT(_instr.pumpEnd());
     }
 
 #ifdef ARDUINO_ARCH_RP2040
-    static uint8_t _workIRQ;
-    static BackgroundAudioSpeechClass<DataBuffer> *_workObj;
+    BackgroundAudioWork _work{_irqStub, this};
 #endif
 
 private:
     AudioOutputBase *_out;
     bool _playing = false;
     bool _paused = false;
+    volatile bool _flushing = false; // The app is resetting this instance in `flush`
     DataBuffer _ib;
     int32_t _gain = 1 << 16;
     bool _generatingSpeech = false;
     static constexpr int framelen = 1324; // From the 22050 normal samplerate and 20 length
     int16_t _frame[framelen * 2]; // Overprovision in case we get a long speech frame
     int _frameLen = 0;
+#ifdef BACKGROUNDAUDIO_INSTRUMENT
+    BackgroundAudioInstrument _instr;
+#endif
 
-    const unsigned char *_dict;
-    size_t _dictLen;
+    espeak_CONTEXT *_ctx = nullptr;  // ESpeak-NG context this instance speaks with, nullptr for the default one
+    const BackgroundAudioDictionary *_dict = nullptr;
     const unsigned char *_voice;
     size_t _voiceLen;
+    int _voiceId = -1;              // Cached voice being translated with
+    int _nextVoice = -1;            // Cached voice to switch to at the next string, if any
+    const unsigned char *_nextVoiceData = nullptr;
+    size_t _nextVoiceLen = 0;
+    int _rate = 0;
+    int _pitch = 0;
+    int _wordGap = 0;
+
+    // Text being translated, and the queue of translated clauses waiting for the audio context
+    size_t _textLen = 0;            // Bytes of _ib (including any NUL) handed to ESpeak-NG for translation
+    bool _inText = false;           // A string is being translated
+    bool _textEnd = false;          // The end of the string is in the text handed to ESpeak-NG
+    size_t _scanned = 0;            // Bytes of _ib already checked for the NUL and clause breaks
+    size_t _breakEnd = 0;           // Bytes of _ib up to the last clause break found, 0 if none
+    int _pendingClause = 0;         // Bytes needed to store the clause sitting in ESpeak-NG's phoneme list
+    volatile bool _globalClause = false;
+    static constexpr size_t _clauseHdr = 8;
+    static constexpr uint32_t _clauseWrap = 0xffffffff;    // Rest of the queue unused, continue at the start
+    static constexpr uint32_t _clauseGlobal = 0xfffffffe;  // Clause is in ESpeak-NG's own phoneme list
+    static constexpr uint32_t _clauseCached = 0xfffffffd;  // Play phrase cache entry instead of a clause
+    static constexpr uint32_t _clauseRecord = 0xfffffffc;  // Following clauses are recorded into a phrase cache entry
+    static constexpr uint32_t _clauseRecordEnd = 0xfffffffb;  // End of the recorded phrase
+    static constexpr uint32_t _clauseVoice = 0xfffffffa;   // Generate following clauses with another cached voice
+    static constexpr uint32_t _clauseMarks = 0xfffffffa;   // Headers from here up carry no phonemes
+    uint8_t _clauseBuff[clauseBytes] __attribute__((aligned(8)));
+    std::atomic<size_t> _clauseHead{0};  // Written only by the translating context
+    std::atomic<size_t> _clauseTail{0};  // Written only by the audio context
+
+    // Optional phrase cache and voice changes.  Markers are queued in order with the clauses to play or record phrases
+    BackgroundAudioSpeechCache *_cache = nullptr;
+    uint32_t _mark = 0;             // Marker waiting to be queued, if any
+    uint32_t _markEntry = 0;
+    bool _recordingText = false;    // String being translated is to be recorded
+    int _recEntry = -1;             // Entry being recorded by the audio context
+    uint32_t _recSamples = 0;
+    uint8_t _recNibble = 0;
+    uint8_t _recCodes[64];
+    IMAADPCMEncoder _recEncoder;
+    int _playEntry = -1;            // Entry being played by the audio context
+    BackgroundAudioSpeechCache::Reader _reader;
+
+    // Optional fixed memory for ESpeak-NG's per-clause working buffers
+    void *_arena = nullptr;
+    size_t _arenaLen = 0;
 
     // Quality stats, cumulative
     uint32_t _frames = 0;
@@ -479,14 +1257,15 @@ private:
     uint32_t _underflows = 0;
     uint32_t _errors = 0;
     uint32_t _dumps = 0;
+    uint32_t _fallbacks = 0;
 };
 
-#ifdef ARDUINO_ARCH_RP2040
-template<class DataBuffer> uint8_t BackgroundAudioSpeechClass<DataBuffer>::_workIRQ;
-template<class DataBuffer> BackgroundAudioSpeechClass<DataBuffer> *BackgroundAudioSpeechClass<DataBuffer>::_workObj;
-#endif
-
 /**
-    @brief General purpose speaker background player with an 8KB buffer.  Needs to have `write` called repeatedly with data.
+    @brief General purpose speaker background player with a 1KB text buffer.  Needs to have `write` called repeatedly with data.
 */
 using BackgroundAudioSpeech = BackgroundAudioSpeechClass<RawDataBuffer<1024>>;
+
+/**
+    @brief Special purpose speaker for use with text in ROM or already completely in RAM. Does not copy any data, speaks from the single written data pointer directly.
+*/
+using ROMBackgroundAudioSpeech = BackgroundAudioSpeechClass<ROMDataBuffer>;
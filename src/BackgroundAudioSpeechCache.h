@@ -0,0 +1,406 @@
+/*
+    BackgroundAudio
+    Plays an audio file using IRQ driven decompression.  Main loop() writes
+    data to the buffer but isn't blocked while playing
+
+    Copyright (c) 2025 Earle F. Philhower, III <earlephilhower@yahoo.com>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+#include <Arduino.h>
+#include "BackgroundAudioADPCM.h"
+
+template<class DataBuffer, size_t clauseBytes> class BackgroundAudioSpeechClass;
+
+/**
+    @brief Least-recently-used cache of synthesized phrases for `BackgroundAudioSpeech`
+
+    @details
+    Attach to a speaker with `setCache` before `begin`.  Each complete string given to `speak` or `write`
+    is looked up by its text and the voice, rate, pitch, and word gap in effect.  On a miss the string is
+    translated and synthesized as usual, and its output is compressed into the cache while it plays.  On a
+    hit the stored phrase is played directly, skipping translation and synthesis entirely.
+
+    Phrases are stored as 4-bit IMA-ADPCM at the speech sample rate, about 11KB per second of speech, in
+    fixed-size blocks so phrases of any length can share the memory without fragmenting it.  When space
+    runs out the least recently used phrases which are not waiting to be played are dropped.
+
+    A cache can only be attached to one speaker at a time.
+*/
+class BackgroundAudioSpeechCache {
+public:
+    /**
+        @brief Create a phrase cache
+
+        @param [in] bytes Memory to allocate for phrase text and compressed audio
+        @param [in] phrases Maximum number of phrases to hold
+    */
+    BackgroundAudioSpeechCache(size_t bytes, size_t phrases = 32) {
+        _blocks = std::min(bytes / blockBytes, (size_t)_none);
+        _mem = new uint8_t[_blocks * blockBytes];
+        _next = new uint16_t[_blocks];
+        _entries = phrases;
+        _entry = new Entry[_entries];
+        clear();
+    }
+
+    ~BackgroundAudioSpeechCache() {
+        delete[] _entry;
+        delete[] _next;
+        delete[] _mem;
+    }
+
+    /**
+        @brief Drop all cached phrases.  Only call while the attached speaker is idle or flushed
+    */
+    void clear() {
+        noInterrupts();
+        for (size_t i = 0; i < _entries; i++) {
+            _entry[i].state = _unused;
+        }
+        _free = _none;
+        for (size_t i = _blocks; i > 0; i--) {
+            _next[i - 1] = _free;
+            _free = i - 1;
+        }
+        interrupts();
+    }
+
+    /**
+        @brief Get the number of strings played from the cache
+
+        @return Cache hits since creation
+    */
+    uint32_t hits() {
+        return _hits;
+    }
+
+    /**
+        @brief Get the number of strings which had to be synthesized
+
+        @return Cache misses since creation
+    */
+    uint32_t misses() {
+        return _misses;
+    }
+
+    /**
+        @brief Get the number of phrases dropped to make room for new ones
+
+        @return Evictions since creation
+    */
+    uint32_t evictions() {
+        return _evictions;
+    }
+
+    /**
+        @brief Get the number of phrases ready to be played from the cache
+
+        @return Complete phrases currently held
+    */
+    size_t phrases() {
+        size_t cnt = 0;
+        for (size_t i = 0; i < _entries; i++) {
+            cnt += (_entry[i].state == _ready) ? 1 : 0;
+        }
+        return cnt;
+    }
+
+    /**
+        @brief Size of each allocation unit of the cache memory
+    */
+    static constexpr size_t blockBytes = 256;
+
+private:
+    template<class DataBuffer, size_t clauseBytes> friend class BackgroundAudioSpeechClass;
+
+    /**
+        @brief Position and decoder state for playing a cached phrase
+    */
+    typedef struct {
+        uint16_t block;
+        uint16_t off;
+        uint32_t left;
+        bool high;
+        IMAADPCMDecoder dec;
+    } Reader;
+
+    /**
+        @brief Look up a phrase, pinning it until `_unpin` on a hit or starting a new recording on a miss
+
+        @param [in] voice Voice data pointer in effect
+        @param [in] settings Packed rate, pitch, and other parameters in effect
+        @param [in] text Phrase text, not including the NUL
+        @param [in] len Length of the text
+        @param [out] hit True if the phrase can be played from the cache
+
+        @return Entry to play or to record to, or -1 if the phrase can't be recorded
+    */
+    int _lookup(const void *voice, uint32_t settings, const uint8_t *text, size_t len, bool *hit) {
+        uint32_t hash = _hash(text, len);
+        *hit = false;
+        noInterrupts();
+        for (size_t i = 0; i < _entries; i++) {
+            Entry *e = &_entry[i];
+            if ((e->state != _unused) && (e->hash == hash) && (e->voice == voice) && (e->settings == settings) && (e->textLen == len) && _matches(e, text)) {
+                int ret = -1;
+                if (e->state == _ready) {
+                    e->pins++;
+                    e->used = ++_clock;
+                    *hit = true;
+                    _hits++;
+                    ret = i;
+                } else {
+                    _misses++; // Still being recorded, so just synthesize it again
+                }
+                interrupts();
+                return ret;
+            }
+        }
+        _misses++;
+        int ret = _record(voice, settings, hash, text, len);
+        interrupts();
+        return ret;
+    }
+
+    /**
+        @brief Add compressed audio to a phrase being recorded, dropping the phrase if no space can be found
+
+        @return True on success
+    */
+    bool _append(int idx, const uint8_t *data, size_t len) {
+        Entry *e = &_entry[idx];
+        while (len--) {
+            if (!_put(e, *data++)) {
+                _drop(e);
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+        @brief Mark a recorded phrase as playable
+    */
+    void _finish(int idx, uint32_t samples) {
+        _entry[idx].samples = samples;
+        _entry[idx].used = ++_clock;
+        _entry[idx].state = _ready;
+    }
+
+    /**
+        @brief Release a phrase pinned by `_lookup` once it has been played (or will not be)
+    */
+    void _unpin(int idx) {
+        if (_entry[idx].pins) {
+            _entry[idx].pins--;
+        }
+    }
+
+    /**
+        @brief Drop partial recordings and release all pins, when the speaker is flushed
+    */
+    void _reset() {
+        for (size_t i = 0; i < _entries; i++) {
+            if (_entry[i].state == _recording) {
+                _drop(&_entry[i]);
+            }
+            _entry[i].pins = 0;
+        }
+    }
+
+    /**
+        @brief Start playing a pinned phrase
+    */
+    void _open(int idx, Reader *r) {
+        Entry *e = &_entry[idx];
+        r->block = e->first;
+        r->off = e->textLen;
+        while (r->off >= blockBytes) {
+            r->block = _next[r->block];
+            r->off -= blockBytes;
+        }
+        r->left = e->samples;
+        r->high = false;
+        r->dec.reset();
+    }
+
+    /**
+        @brief Decode up to `count` samples of a phrase
+
+        @return Number of samples decoded, 0 at the end of the phrase
+    */
+    size_t _read(Reader *r, int16_t *dest, size_t count) {
+        count = std::min(count, (size_t)r->left);
+        for (size_t i = 0; i < count; i++) {
+            uint8_t b = _mem[r->block * blockBytes + r->off];
+            if (!r->high) {
+                dest[i] = r->dec.decode(b & 0x0f);
+            } else {
+                dest[i] = r->dec.decode(b >> 4);
+                if (++r->off == blockBytes) {
+                    r->block = _next[r->block];
+                    r->off = 0;
+                }
+            }
+            r->high = !r->high;
+        }
+        r->left -= count;
+        return count;
+    }
+
+    typedef struct {
+        uint8_t state;
+        uint8_t pins;           // Number of times queued to play
+        uint16_t first;         // Block chain holding the text followed by the ADPCM data
+        uint16_t last;
+        uint16_t textLen;
+        uint32_t len;           // Bytes stored in the chain
+        uint32_t samples;
+        uint32_t hash;
+        uint32_t settings;
+        const void *voice;
+        uint32_t used;          // LRU clock at last use
+    } Entry;
+
+    static constexpr uint8_t _unused = 0;
+    static constexpr uint8_t _recording = 1;
+    static constexpr uint8_t _ready = 2;
+    static constexpr uint16_t _none = 0xffff;
+
+    static uint32_t _hash(const uint8_t *text, size_t len) {
+        uint32_t h = 2166136261UL; // FNV-1a
+        while (len--) {
+            h = (h ^ *text++) * 16777619UL;
+        }
+        return h;
+    }
+
+    bool _matches(Entry *e, const uint8_t *text) {
+        uint16_t b = e->first;
+        for (size_t i = 0; i < e->textLen; i++) {
+            if ((i % blockBytes == 0) && i) {
+                b = _next[b];
+            }
+            if (_mem[b * blockBytes + i % blockBytes] != text[i]) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    int _record(const void *voice, uint32_t settings, uint32_t hash, const uint8_t *text, size_t len) {
+        if (len > _none) {
+            return -1;
+        }
+        int slot = -1;
+        for (size_t i = 0; (i < _entries) && (slot < 0); i++) {
+            if (_entry[i].state == _unused) {
+                slot = i;
+            }
+        }
+        if ((slot < 0) && !_evict()) {
+            return -1;
+        }
+        for (size_t i = 0; (i < _entries) && (slot < 0); i++) {
+            if (_entry[i].state == _unused) {
+                slot = i;
+            }
+        }
+        uint16_t b = _alloc();
+        if (b == _none) {
+            return -1;
+        }
+        Entry *e = &_entry[slot];
+        e->state = _recording;
+        e->pins = 0;
+        e->first = b;
+        e->last = b;
+        e->textLen = len;
+        e->len = 0;
+        e->samples = 0;
+        e->hash = hash;
+        e->settings = settings;
+        e->voice = voice;
+        if (!_append(slot, text, len)) {
+            return -1;
+        }
+        return slot;
+    }
+
+    bool _put(Entry *e, uint8_t b) {
+        size_t off = e->len % blockBytes;
+        if (!off && e->len) {
+            uint16_t n = _alloc();
+            if (n == _none) {
+                return false;
+            }
+            _next[e->last] = n;
+            e->last = n;
+        }
+        _mem[e->last * blockBytes + off] = b;
+        e->len++;
+        return true;
+    }
+
+    uint16_t _alloc() {
+        if ((_free == _none) && !_evict()) {
+            return _none;
+        }
+        uint16_t b = _free;
+        _free = _next[b];
+        _next[b] = _none;
+        return b;
+    }
+
+    bool _evict() {
+        Entry *lru = nullptr;
+        for (size_t i = 0; i < _entries; i++) {
+            Entry *e = &_entry[i];
+            if ((e->state == _ready) && !e->pins && (!lru || (int32_t)(e->used - lru->used) < 0)) {
+                lru = e;
+            }
+        }
+        if (!lru) {
+            return false;
+        }
+        _drop(lru);
+        _evictions++;
+        return true;
+    }
+
+    void _drop(Entry *e) {
+        if (e->state == _unused) {
+            return;
+        }
+        _next[e->last] = _free;
+        _free = e->first;
+        e->state = _unused;
+        e->pins = 0;
+    }
+
+    uint8_t *_mem;
+    uint16_t *_next;
+    size_t _blocks;
+    uint16_t _free;
+    Entry *_entry;
+    size_t _entries;
+    uint32_t _clock = 0;
+
+    uint32_t _hits = 0;
+    uint32_t _misses = 0;
+    uint32_t _evictions = 0;
+};
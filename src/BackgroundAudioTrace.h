@@ -0,0 +1,234 @@
+/*
+    BackgroundAudio
+    Optional event trace of the audio callbacks, pumps, and app writes
+
+    Copyright (c) 2025 Earle F. Philhower, III <earlephilhower@yahoo.com>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+#include <Arduino.h>
+
+// Define BACKGROUNDAUDIO_TRACE before including any BackgroundAudio header (in every file which includes
+// one) to record when each output callback, work IRQ, pump, frame, input buffer shift, app write, and
+// underflow happened.  Otherwise the BA_TRACE hooks compile to nothing.
+#ifdef BACKGROUNDAUDIO_TRACE
+#include <atomic>
+#define BA_TRACE(event, src, arg) BackgroundAudioTrace::add(event, src, arg)
+#define BA_TRACE_NAME(src, str) BackgroundAudioTrace::name(src, str)
+#else
+#define BA_TRACE(event, src, arg) do { } while (0)
+#define BA_TRACE_NAME(src, str) do { } while (0)
+#endif
+
+#ifndef BACKGROUNDAUDIO_TRACE_ENTRIES
+#define BACKGROUNDAUDIO_TRACE_ENTRIES 256   // Per core, must be a power of 2
+#endif
+
+/**
+    @brief Each kind of trace event.  Keep `BackgroundAudioTrace::_event` in the same order
+*/
+enum {
+    BA_TRACE_CALLBACK,      // Output's onTransmit callback fired
+    BA_TRACE_IRQ,           // RP2040 work IRQ picked this object's pump, arg = output bytes queued
+    BA_TRACE_PUMP_BEGIN,    // arg = output's availableForWrite
+    BA_TRACE_PUMP_END,
+    BA_TRACE_FRAME_BEGIN,
+    BA_TRACE_FRAME_END,
+    BA_TRACE_WRITE,         // App wrote to a player, arg = bytes accepted
+    BA_TRACE_SHIFT_BEGIN,   // Input buffer shiftUp, arg = bytes
+    BA_TRACE_SHIFT_END,
+    BA_TRACE_UNDERFLOW,     // Player ran out of input or mixer input ran out of samples, arg = samples of silence if known
+    BA_TRACE_MARK,          // Free for the app's own use
+    BA_TRACE_EVENTS
+};
+
+/**
+    @brief One recorded event
+*/
+typedef struct {
+    uint32_t tag;           // (Sequence number << 8) | event, written last so a half-written entry is never read
+    uint32_t time;          // micros() when it happened
+    uint32_t src;           // Address of the player or mixer it happened in
+    uint32_t arg;
+} BackgroundAudioTraceEntry;
+
+#ifdef BACKGROUNDAUDIO_TRACE
+
+/**
+    @brief Fixed size trace rings, one per core, which can be written from any context without locking
+
+    @details
+    Each event claims the next slot in its core's ring and the oldest events are overwritten.  `dump`
+    writes out what's in the rings as text, which `tools/trace2chrome/trace2chrome.py` turns into a Chrome
+    `trace_event` JSON file to view in chrome://tracing or Perfetto.  To catch a dropout, `freeze` the
+    trace from the app as soon as it notices an underflow and dump it afterwards at leisure.
+*/
+class BackgroundAudioTrace {
+public:
+    /**
+        @brief Record an event.  Use the BA_TRACE macro instead so it compiles away when tracing is disabled
+
+        @param [in] event BA_TRACE_xxx event
+        @param [in] src Object the event happened in
+        @param [in] arg Event specific value
+    */
+    static inline void add(int event, const void *src, uint32_t arg) {
+        if (_frozen) {
+            return;
+        }
+        int core = _core();
+#if defined(ARDUINO_ARCH_RP2040) && defined(__ARM_ARCH_6M__)
+        // The M0+ has no atomic increment, but the ring is per-core so only local interrupts can race
+        uint32_t irqs = save_and_disable_interrupts();
+        uint32_t seq = _head[core].load(std::memory_order_relaxed);
+        _head[core].store(seq + 1, std::memory_order_relaxed);
+        restore_interrupts(irqs);
+#else
+        uint32_t seq = _head[core].fetch_add(1, std::memory_order_relaxed);
+#endif
+        BackgroundAudioTraceEntry *e = &_ring[core][seq & (BACKGROUNDAUDIO_TRACE_ENTRIES - 1)];
+        __atomic_store_n(&e->tag, _invalid, __ATOMIC_RELAXED);
+        std::atomic_thread_fence(std::memory_order_release);
+        e->time = micros();
+        e->src = (uint32_t)(uintptr_t)src;
+        e->arg = arg;
+        __atomic_store_n(&e->tag, (seq << 8) | event, __ATOMIC_RELEASE);
+    }
+
+    /**
+        @brief Give an object a name in the trace output.  Called from `begin` of each player and mixer
+
+        @param [in] src Object being named
+        @param [in] name Constant string to show for it
+    */
+    static void name(const void *src, const char *name) {
+        for (auto &n : _names) {
+            if (!n.src || (n.src == src)) {
+                n.name = name;
+                n.src = src;
+                return;
+            }
+        }
+    }
+
+    /**
+        @brief Stop (or restart) recording, leaving the events leading up to now in the rings
+
+        @param [in] frozen True to stop recording
+    */
+    static void freeze(bool frozen = true) {
+        _frozen = frozen;
+    }
+
+    /**
+        @brief Forget all events recorded so far
+    */
+    static void clear() {
+        for (int i = 0; i < _cores; i++) {
+            _start[i] = _head[i].load(std::memory_order_acquire);
+        }
+    }
+
+    /**
+        @brief Write the names and events as text, oldest first for each core
+
+        @details
+        Each line is either `N <src> <name>` or `E <core> <sequence> <time> <src> <phase> <event> <arg>`,
+        with the Chrome phase (B, E, or i) included so the converter needs no knowledge of the events.
+        Lines starting with `#` are comments.  Events being written during the dump are skipped.
+
+        @param [in] emit Called with each line of text in turn, i.e. to print it to Serial
+    */
+    static void dump(void (*emit)(const char *)) {
+        char buff[96];
+        snprintf(buff, sizeof(buff), "# BackgroundAudio trace, %d core(s), %d entries each\n", _cores, BACKGROUNDAUDIO_TRACE_ENTRIES);
+        emit(buff);
+        for (auto &n : _names) {
+            if (n.src) {
+                snprintf(buff, sizeof(buff), "N %08lx %s\n", (unsigned long)(uint32_t)(uintptr_t)n.src, n.name);
+                emit(buff);
+            }
+        }
+        for (int core = 0; core < _cores; core++) {
+            uint32_t head = _head[core].load(std::memory_order_acquire);
+            uint32_t seq = head - std::min(head - _start[core], (uint32_t)BACKGROUNDAUDIO_TRACE_ENTRIES);
+            for (; seq != head; seq++) {
+                const BackgroundAudioTraceEntry *e = &_ring[core][seq & (BACKGROUNDAUDIO_TRACE_ENTRIES - 1)];
+                uint32_t tag = __atomic_load_n(&e->tag, __ATOMIC_ACQUIRE);
+                BackgroundAudioTraceEntry copy = *e;
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if ((tag == _invalid) || (tag != __atomic_load_n(&e->tag, __ATOMIC_RELAXED)) || ((tag >> 8) != (seq & 0xffffff))) {
+                    continue; // Being rewritten right now, or already overwritten by a newer event
+                }
+                int ev = tag & 0xff;
+                snprintf(buff, sizeof(buff), "E %d %lu %lu %08lx %c %s %lu\n", core, (unsigned long)seq, (unsigned long)copy.time,
+                         (unsigned long)copy.src, _event[ev].phase, _event[ev].name, (unsigned long)copy.arg);
+                emit(buff);
+            }
+        }
+    }
+
+private:
+    static inline int _core() {
+#if defined(ESP32)
+        return xPortGetCoreID();
+#elif defined(ARDUINO_ARCH_RP2040)
+        return get_core_num();
+#else
+        return 0;
+#endif
+    }
+
+#if defined(ESP32)
+    static constexpr int _cores = portNUM_PROCESSORS;
+#elif defined(ARDUINO_ARCH_RP2040)
+    static constexpr int _cores = NUM_CORES;
+#else
+    static constexpr int _cores = 1;
+#endif
+    static constexpr uint32_t _invalid = 0xffffffff;
+
+    typedef struct {
+        const char *name;
+        char phase;
+    } EventInfo;
+    static constexpr EventInfo _event[BA_TRACE_EVENTS] = {
+        { "callback", 'i' },
+        { "irq", 'i' },
+        { "pump", 'B' },
+        { "pump", 'E' },
+        { "frame", 'B' },
+        { "frame", 'E' },
+        { "write", 'i' },
+        { "shiftUp", 'B' },
+        { "shiftUp", 'E' },
+        { "underflow", 'i' },
+        { "mark", 'i' }
+    };
+
+    typedef struct {
+        const void *src;
+        const char *name;
+    } Name;
+
+    static inline BackgroundAudioTraceEntry _ring[_cores][BACKGROUNDAUDIO_TRACE_ENTRIES];
+    static inline std::atomic<uint32_t> _head[_cores];
+    static inline uint32_t _start[_cores];
+    static inline volatile bool _frozen = false;
+    static inline Name _names[16];
+};
+
+#endif
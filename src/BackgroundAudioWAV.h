@@ -24,6 +24,9 @@
 #include "WrappedAudioOutputBase.h"
 #include "BackgroundAudioBuffers.h"
 #include "BackgroundAudioGain.h"
+#include "BackgroundAudioInstrument.h"
+#include "BackgroundAudioTrace.h"
+#include "BackgroundAudioCommand.h"
 
 /**
     @brief Interrupt-driven WAV decoder.  Generates a full frame of samples each cycle and uses the RawBuffer to safely hand data from the app to the decompressor.
@@ -50,6 +53,17 @@ public:
         setDevice(&d);
     }
 
+    /**
+        @brief Construct a WAV decoder which will convert samples directly into the output's buffers
+
+        @param [in] d ZeroCopyAudioOutputBase device (i.e. MixerInput) to decode to
+    */
+    BackgroundAudioWAVClass(ZeroCopyAudioOutputBase &d) {
+        _playing = false;
+        _paused = false;
+        setDevice(&d);
+    }
+
     ~BackgroundAudioWAVClass() {}
 
     /**
@@ -60,18 +74,33 @@ public:
     bool setDevice(AudioOutputBase *d) {
         if (!_playing) {
             _out = d;
+            _zc = nullptr;
+            return true;
+        }
+        return false;
+    }
+
+    /**
+        @brief Configure an output device before `begin` which supports decoding in place
+
+        @return True if successful
+    */
+    bool setDevice(ZeroCopyAudioOutputBase *d) {
+        if (!_playing) {
+            _out = d;
+            _zc = d;
             return true;
         }
         return false;
     }
 
     /**
-        @brief Set the gain multiplier (volume) for the stream.  Takes effect immediately.
+        @brief Set the gain multiplier (volume) for the stream.  Ramps to it over the next frame decoded.
 
         @param [in] scale Floating point value from 0.0....16.0 to multiply all audio data by
     */
     void setGain(float scale) {
-        _gain = (int32_t)(scale * (1 << 16));
+        command(BA_COMMAND_GAIN, (int32_t)(scale * (1 << 16)));
     }
 
     /**
@@ -89,15 +118,18 @@ public:
 
         // We will use natural frame size to minimize mismatch
         _out->setBuffers(5, framelen);  // Framelen is in samples, but buffers takes words, which means 2 samples per word so we're good!
+        BA_INSTRUMENT(_instr.setOutput(5, framelen));
+        BA_TRACE_NAME(this, "WAV");
         _out->onTransmit(&_cb, (void *)this); // The pump we will use to generate our audio
         _out->setBitsPerSample(16);
         _out->setStereo(true);
         _out->setFrequency(44100);
         _out->begin();
 
-        // Stuff with silence to start
+        // Stuff with silence to start.  Zero-copy outputs (mixer legs) already play silence when empty,
+        // and leaving them untouched keeps their buffers frame-aligned so we can decode in place.
         uint32_t zeros[32] = {};
-        while (_out->availableForWrite() > 32) {
+        while (!_zc && (_out->availableForWrite() > 32)) {
             _out->write((uint8_t *)zeros, sizeof(zeros));
         }
         _playing = true;
@@ -140,7 +172,9 @@ public:
         @return Number of bytes written
     */
     size_t write(const void *data, size_t len) {
-        return _ib.write((const uint8_t *)data, len);
+        size_t ret = _ib.write((const uint8_t *)data, len);
+        BA_TRACE(BA_TRACE_WRITE, this, ret);
+        return ret;
     }
 
     /**
@@ -226,55 +260,185 @@ public:
 
         @details
         This is only needed if the current WAV file was corrupted or to stop playing one WAV
-        file and immediately start on a new one.
+        file and immediately start on a new one.  Waits for the decoder to finish its current frame, so
+        data `write`n afterwards is kept.
+
+        Call it from the app (`loop`, a task, or a pipeline's worker), not from an interrupt or an output's
+        `onTransmit` callback, where the decoder can't run until the caller returns.  There it returns false at
+        once rather than hang, and on the RP2040 with the work IRQ masked it gives up after `timeoutMs`.
+
+        @param [in] timeoutMs Longest to wait for the decoder
+
+        @return True once flushed, false if it hadn't been by `timeoutMs` (it's still queued unless the queue was full)
     */
-    void flush() {
-        noInterrupts();
-        _ib.flush();
-        _seenRIFF = false;
-        _seenFMT = false;
-        _seenDATA = false;
-        _dataSkipped = 0;
-        _dataRemaining = 0;
-        _accumShift = 0;
-        interrupts();
+    bool flush(uint32_t timeoutMs = BackgroundAudioCommandQueue::defaultTimeoutMs) {
+        uint32_t ticket = command(BA_COMMAND_FLUSH);
+        return ticket && _cmd.wait(ticket, timeoutMs);
     }
 
     /**
-        @brief Pause the decoder.  Won't process raw input data and will transmit silence
+        @brief Jump to another place in the WAV data.  Only for `ROMBackgroundAudioWAV`
+
+        @details
+        The RAM buffered player throws its data away as it decodes, so only the ROM player can seek.  Within
+        the data chunk being played `pos` is rounded down to a whole sample, so going back to replay part of
+        it works even after it's finished.  Anywhere else the headers are looked for again from `pos`, so 0
+        restarts the file.  Like `flush` it waits for the decoder to finish its current frame, and mustn't be
+        called from an interrupt.
+
+        @param [in] pos Byte offset into the data given to `write`
+        @param [in] timeoutMs Longest to wait for the decoder
+
+        @return True if the decoder moved there, false if it can't seek, `pos` is past the end, or it timed out
+    */
+    bool seek(size_t pos, uint32_t timeoutMs = BackgroundAudioCommandQueue::defaultTimeoutMs) {
+        if (pos > INT32_MAX) {
+            return false;
+        }
+        uint32_t ticket = command(BA_COMMAND_SEEK, pos);
+        return ticket && _cmd.wait(ticket, timeoutMs) && _seekOK;
+    }
+
+    /**
+        @brief Sleep until every `setGain`, `pause`, `unpause`, `flush`, and `seek` so far has taken effect
+
+        @details
+        Control calls are queued for the decoder to apply between frames, so they never race with a frame
+        being decoded in the background.  This waits on them without spinning.
+
+        @param [in] timeoutMs Longest to wait
+
+        @return True if they were all applied, false on timeout
+    */
+    bool waitCommands(uint32_t timeoutMs = UINT32_MAX) {
+        return _cmd.wait(_cmd.last(), timeoutMs);
+    }
+
+    /**
+        @brief Start playing the next data written at an exact mixer sample time
+
+        @details
+        Only supported when decoding to a `BackgroundAudioMixerInput` leg.  Any audio already queued on the
+        leg is dropped and the leg stays silent until `sampleTime`, when the first decoded sample is spliced
+        in.  Typically called after `flush` and before `write`ing the new WAV file.
+
+        @param [in] sampleTime Mixer sample clock value, see `BackgroundAudioMixer::sampleTime`
+
+        @return True if the start was scheduled
+    */
+    bool startAt(uint64_t sampleTime) {
+        return _zc && _zc->startAt(sampleTime);
+    }
+
+    /**
+        @brief Pause the decoder.  Fades out over the next frame, then won't process raw input data and will transmit silence
     */
     void pause() {
-        _paused = true;
+        _pauseReq = true;
+        command(BA_COMMAND_PAUSE);
     }
 
     /**
         @brief Determine if the WAV playback is paused
 
-        @return True of WAV playback has been paused
+        @return True of WAV playback has been paused, even if the fade out hasn't happened yet
     */
     bool paused() {
-        return _paused;
+        return _pauseReq;
     }
 
     /**
-        @brief Unpause previously paused WAV playback.  Will start processing input data again
+        @brief Unpause previously paused WAV playback.  Will start processing input data again, fading in
     */
     void unpause() {
-        _paused = false;
+        _pauseReq = false;
+        command(BA_COMMAND_UNPAUSE);
+    }
+
+    /**
+        @brief Decode straight into a buffer as fast as the CPU allows, with no output device or callbacks
+
+        @details
+        For transcoding, pre-rendering audio into flash or PSRAM, and tests.  Use instead of `begin`, not
+        alongside it: `write` the WAV data (a RAM buffer can be topped up between calls) and call `render`
+        until it returns fewer samples than asked for.  The output is exactly what the player would have sent
+        to its output device, with the gain applied, as interleaved 16-bit stereo at `sampleRate`.
+
+        @param [out] dest Buffer for `samples` stereo samples, i.e. `samples * 2` int16_t
+        @param [in] samples Number of stereo samples wanted
+
+        @return Number of stereo samples written, fewer than `samples` only when the input ran out or playback is paused
+    */
+    size_t render(int16_t *dest, size_t samples) {
+        if (_playing) {
+            return 0; // The background pump owns the decoder
+        }
+        if (!_rendering) {
+            _seenRIFF = false;
+            _seenFMT = false;
+            _seenDATA = false;
+            _rendering = true;
+        }
+        size_t ret = 0;
+        while (ret < samples) {
+            if (_renderPos == framelen) {
+                applyCommands(true);
+                if (_paused || done()) {
+                    break;
+                }
+                generateOneFrame(_outSample);
+                _renderPos = 0;
+            }
+            size_t n = std::min(samples - ret, framelen - _renderPos);
+            memcpy(dest + ret * 2, _outSample + _renderPos * 2, n * 2 * sizeof(int16_t));
+            _renderPos += n;
+            ret += n;
+        }
+        return ret;
+    }
+
+    /**
+        @brief Get the sample rate of the decoded audio, known once the first frame is decoded
+
+        @return Sample rate in hertz
+    */
+    int sampleRate() {
+        return _sampleRate;
+    }
+
+#ifdef BACKGROUNDAUDIO_INSTRUMENT
+    /**
+        @brief Get the pump and frame timing statistics.  Only built with BACKGROUNDAUDIO_INSTRUMENT defined
+
+        @param [out] t Filled in with a consistent snapshot of the statistics
+    */
+    void getTiming(BackgroundAudioTiming *t) {
+        _instr.read(t);
     }
 
+    /**
+        @brief Clear the timing statistics, taking effect at the start of the next pump
+    */
+    void resetTiming() {
+        _instr.reset();
+    }
+#endif
+
 private:
     static void _cb(void *ptr) {
+        BA_TRACE(BA_TRACE_CALLBACK, ptr, 0);
         ((BackgroundAudioWAVClass*)ptr)->pump();
     }
 
-    void generateOneFrame() {
-        int16_t *out = (int16_t *)_outSample;
-        int16_t *end = &_outSample[framelen * 2];
+    void generateOneFrame(int16_t *dest) {
+        int16_t *out = dest;
+        int16_t *end = &dest[framelen * 2];
         while (out < end) {
             // If we accumulate too large of a shift, actually do the shift so more space for writer
             if (_accumShift > _ib.size() / 2) {
+                BA_TRACE(BA_TRACE_SHIFT_BEGIN, this, _accumShift);
                 _ib.shiftUp(_accumShift);
+                BA_TRACE(BA_TRACE_SHIFT_END, this, 0);
                 _accumShift = 0;
                 _shifts++;
             }
@@ -377,6 +541,7 @@ private:
                     }
                     _accumShift += 24;
                     _seenFMT = true;
+                    continue;
                 } else if (_seenRIFF && _seenFMT && !_seenDATA && !memcmp(b, "data", 4)) {
                     if (avail < 8) {
                         goto underflow;
@@ -384,6 +549,8 @@ private:
                     _dataRemaining = b[4] | (b[5] << 8) | (b[6] << 16) | (b[7] << 24); // in bytes
                     _dataRemaining /= _bps / 8;
                     _dataRemaining /= _channels; // Now in samples
+                    _dataTotal = _dataRemaining;
+                    _dataStart = _ib.position() + _accumShift + 8;
                     _seenDATA = true;
                     _seenRIFF = false;
                     _seenFMT = false;
@@ -401,8 +568,11 @@ private:
             }
 underflow:
             _underflows++;
+            BA_TRACE(BA_TRACE_UNDERFLOW, this, 0);
             if (_accumShift) {
+                BA_TRACE(BA_TRACE_SHIFT_BEGIN, this, _accumShift);
                 _ib.shiftUp(_accumShift);
+                BA_TRACE(BA_TRACE_SHIFT_END, this, 0);
                 _accumShift = 0;
                 _shifts++;
             }
@@ -414,39 +584,172 @@ underflow:
             continue;
         } // while(out < end-of-outsamples)
 
-        ApplyGain(_outSample, framelen * 2, _gain);
+        applyGain(dest, framelen * 2);
+    }
+
+    // Move the ROM read point, staying in step with the data chunk when it lands inside it
+    void seekTo(size_t pos) {
+        size_t block = _channels * _bps / 8;
+        size_t end = _dataStart + _dataTotal * block;
+        bool inData = _dataTotal && (pos >= _dataStart) && (pos < end);
+        if (inData) {
+            pos -= (pos - _dataStart) % block;
+        }
+        _seekOK = _ib.seek(pos);
+        if (!_seekOK) {
+            return;
+        }
+        _accumShift = 0;
+        _renderPos = framelen;
+        _dataSkipped = 0;
+        if (inData) {
+            _dataRemaining = (end - pos) / block;
+            _seenDATA = true;
+        } else {
+            _seenRIFF = false;
+            _seenFMT = false;
+            _seenDATA = false;
+            _dataRemaining = 0;
+            _dataTotal = 0;
+        }
+    }
+
+    // Queue a control call for the pump, or apply it now when nothing else is decoding: not started, rendering
+    // offline, or called on a pipeline's worker between frames.  Returns 0 if the queue stayed full
+    uint32_t command(uint8_t op, int32_t arg = 0) {
+        uint32_t ticket;
+        while (!(ticket = _cmd.post(op, arg))) {
+            if (_playing || _cmd.drainedElsewhere()) {
+                // The pump or a pipeline's worker will make room, unless this is an IRQ it can't preempt
+                if (!_cmd.wait(_cmd.last(), BackgroundAudioCommandQueue::defaultTimeoutMs)) {
+                    return 0;
+                }
+            } else {
+                applyCommands(false);
+            }
+        }
+        if (!_playing && !_cmd.drainedElsewhere()) {
+            applyCommands(_rendering);
+        }
+        return ticket;
+    }
+
+    // Between frames, apply what the app asked for.  With `ramp` gain and pause changes fade over the next frame
+    void applyCommands(bool ramp) {
+        _cmd.drain([this, ramp](uint8_t op, int32_t arg) {
+            switch (op) {
+            case BA_COMMAND_FLUSH:
+                _ib.flush();
+                _seenRIFF = false;
+                _seenFMT = false;
+                _seenDATA = false;
+                _dataSkipped = 0;
+                _dataRemaining = 0;
+                _dataTotal = 0;
+                _accumShift = 0;
+                _renderPos = framelen;
+                break;
+            case BA_COMMAND_SEEK:
+                seekTo(arg);
+                break;
+            case BA_COMMAND_PAUSE:
+                if (ramp && !_paused) {
+                    _pausing = true;
+                } else {
+                    _paused = true;
+                    _rampFrom = 0;
+                }
+                break;
+            case BA_COMMAND_UNPAUSE:
+                _paused = false;
+                _pausing = false;
+                if (!ramp) {
+                    _rampFrom = _gain;
+                }
+                break;
+            case BA_COMMAND_GAIN:
+                _gain = arg;
+                if (!ramp && !_paused) {
+                    _rampFrom = arg;
+                }
+                break;
+            }
+        });
+    }
+
+    // Gain for this frame, sliding from the last frame's after a change or pause so it doesn't click
+    void applyGain(int16_t *samples, size_t count) {
+        int32_t to = _pausing ? 0 : _gain;
+        ApplyGainRamp(samples, count, _rampFrom, to);
+        _rampFrom = to;
+        if (_pausing) {
+            _pausing = false;
+            _paused = true;
+        }
     }
 
 
 
     void pump() {
+        BA_INSTRUMENT(_instr.pumpBegin(_out->availableForWrite(), _sampleRate));
+        BA_TRACE(BA_TRACE_PUMP_BEGIN, this, _out->availableForWrite());
         while (_out->availableForWrite() >= (int)(framelen * 2 * sizeof(int16_t))) {
+            applyCommands(true);
+            // Convert straight into the output's buffer when it has room for a full frame
+            size_t words = 0;
+            int16_t *dest = _zc ? (int16_t *)_zc->acquireWriteBuffer(&words) : nullptr;
+            if (words < framelen) {
+                dest = _outSample;
+            }
             if (_paused) {
-                bzero((uint8_t *)_outSample, framelen * 2 * sizeof(int16_t));
+                bzero((uint8_t *)dest, framelen * 2 * sizeof(int16_t));
             } else {
-                generateOneFrame();
+                BA_INSTRUMENT(_instr.frameBegin());
+                BA_TRACE(BA_TRACE_FRAME_BEGIN, this, 0);
+                generateOneFrame(dest);
+                BA_TRACE(BA_TRACE_FRAME_END, this, 0);
+                BA_INSTRUMENT(_instr.frameEnd());
                 if (_sampleRate) {
                     _out->setFrequency(_sampleRate);
                 }
             }
-            assert(_out->write((uint8_t *)_outSample, framelen * 2 * sizeof(int16_t)) == framelen * 2 * sizeof(int16_t));
+            if (dest == _outSample) {
+                assert(_out->write((uint8_t *)_outSample, framelen * 2 * sizeof(int16_t)) == framelen * 2 * sizeof(int16_t));
+            } else {
+                _zc->commitWriteBuffer(framelen);
+            }
         }
+        BA_TRACE(BA_TRACE_PUMP_END, this, 0);
+        BA_INSTRUMENT(_instr.pumpEnd());
     }
 
 private:
     AudioOutputBase *_out;
+    ZeroCopyAudioOutputBase *_zc = nullptr;
     bool _playing = false;
     bool _paused = false;
+    bool _pausing = false;      // Fading out for a pause over the next frame
+    bool _pauseReq = false;     // What the app last asked for
+    bool _rendering = false;
+    volatile bool _seekOK = false;
+    size_t _renderPos = framelen; // Next sample of the last rendered frame to return
+    BackgroundAudioCommandQueue _cmd;
     static const size_t framelen = 512;
     DataBuffer _ib;
     int16_t _outSample[framelen * 2] __attribute__((aligned(4)));
     int32_t _gain = 1 << 16;
+    int32_t _rampFrom = 1 << 16;  // Gain the last frame ended at
     uint32_t _accumShift = 0;
+#ifdef BACKGROUNDAUDIO_INSTRUMENT
+    BackgroundAudioInstrument _instr;
+#endif
     bool _seenRIFF = false;
     bool _seenFMT = false;
     bool _seenDATA = false;
     int _dataRemaining = 0;
     int _dataSkipped = 0;
+    int _dataTotal = 0;         // Samples in the last data chunk found
+    size_t _dataStart = 0;      // Where they start in the ROM data
 
     int _sampleRate = 44100;
     int _channels = 2;
@@ -49,3 +49,59 @@ public:
 #include <AudioOutputBase.h>
 
 #endif
+
+/**
+    @brief Optional extension of `AudioOutputBase` for outputs which can hand out their internal sample buffers
+
+    @details
+    Generators normally render into their own frame buffer and then `write` it, which copies every sample
+    into the output's buffers.  When the output implements this interface a generator can instead ask for
+    a pointer to the output's next free region with `acquireWriteBuffer`, render its final samples
+    directly into it, and then hand them over with `commitWriteBuffer`, saving one full copy per frame.
+
+    The region only runs to the end of the output's current buffer, and a generator only renders in place
+    when its largest possible frame fits there, falling back to `write` otherwise.  The decoders size mixer
+    leg buffers to their frame length, so MP3 (1152 or 576 sample), HE-AAC, and WAV frames tile them and are
+    always done in place.  AAC-LC frames are 1024 samples in buffers sized for 2048 sample HE-AAC ones, so
+    only every other frame has room for the worst case and about half are still copied.
+
+    Only one region may be acquired at a time and it must be committed (or abandoned by not committing)
+    before calling `write` or `acquireWriteBuffer` again.
+*/
+class ZeroCopyAudioOutputBase : public AudioOutputBase {
+public:
+    virtual ~ZeroCopyAudioOutputBase() { }
+
+    /**
+        @brief Get a pointer to the next contiguous free region of the output buffers
+
+        @param [out] words Number of 32-bit (one stereo 16-bit sample) words which may be written at the pointer
+
+        @return Pointer to write samples to, or `nullptr` (and `words` set to 0) if no space is available
+    */
+    virtual uint32_t *acquireWriteBuffer(size_t *words) = 0;
+
+    /**
+        @brief Mark samples written into the acquired region as ready for output
+
+        @param [in] words Number of 32-bit words actually written, no more than returned by `acquireWriteBuffer`
+    */
+    virtual void commitWriteBuffer(size_t words) = 0;
+
+    /**
+        @brief Schedule the next data written to begin playing at an exact output sample time
+
+        @details
+        Outputs driven by a sample clock (i.e. `BackgroundAudioMixer` legs) drop any queued data and then hold
+        silence until `sampleTime`, splicing the first new sample in at exactly that point.  Outputs without a
+        sample clock do not support this.
+
+        @param [in] sampleTime Output sample clock value at which to start
+
+        @return True if the start was scheduled
+    */
+    virtual bool startAt(uint64_t sampleTime) {
+        (void) sampleTime;
+        return false;
+    }
+};
@@ -354,3 +354,101 @@ espeak_ng_SetRandSeed(long seed) {
 	return ENS_OK;
 }
 #pragma GCC visibility pop
+
+// Working buffers for translating a clause (EFP3 moved them off the stack) are taken from a
+// caller-provided arena when there is one, else from the heap.  Blocks are kept as a stack so
+// arena_release() can drop everything taken since an arena_mark() at once, heap blocks included.
+typedef struct ARENA_BLOCK {
+	struct ARENA_BLOCK *prev;
+	size_t top; // arena_top before this block was taken
+	size_t size;
+	uint32_t heap;
+	uint32_t pad;
+} ARENA_BLOCK;
+
+#define ARENA_ALIGN(x) (((x) + 7) & ~(size_t)7)
+
+static uint8_t *arena_mem = NULL;
+static size_t arena_size = 0;
+static size_t arena_top = 0;
+static ARENA_BLOCK *arena_last = NULL;
+static size_t arena_blocks = 0;
+static size_t arena_used = 0;
+static size_t arena_high = 0;
+static int arena_overflows = 0;
+
+void *arena_alloc(size_t size)
+{
+	ARENA_BLOCK *b;
+	size_t need = ARENA_ALIGN(sizeof(ARENA_BLOCK)) + ARENA_ALIGN(size);
+
+	if ((arena_mem != NULL) && (arena_top + need <= arena_size)) {
+		b = (ARENA_BLOCK *)&arena_mem[arena_top];
+		b->heap = 0;
+	} else {
+		if (arena_mem != NULL)
+			arena_overflows++;
+		if ((b = (ARENA_BLOCK *)malloc(need)) == NULL)
+			return NULL;
+		b->heap = 1;
+	}
+	b->prev = arena_last;
+	b->top = arena_top;
+	b->size = need;
+	if (!b->heap)
+		arena_top += need;
+	arena_last = b;
+	arena_blocks++;
+
+	arena_used += need;
+	if (arena_used > arena_high)
+		arena_high = arena_used;
+
+	return (uint8_t *)b + ARENA_ALIGN(sizeof(ARENA_BLOCK));
+}
+
+size_t arena_mark(void)
+{
+	return arena_blocks;
+}
+
+void arena_release(size_t mark)
+{
+	while (arena_blocks > mark) {
+		ARENA_BLOCK *b = arena_last;
+		arena_last = b->prev;
+		arena_top = b->top;
+		arena_used -= b->size;
+		arena_blocks--;
+		if (b->heap)
+			free(b);
+	}
+}
+
+#pragma GCC visibility push(default)
+ESPEAK_NG_API int espeak_SetArena(void *mem, size_t size)
+{
+	size_t skip;
+
+	if (arena_blocks)
+		return -1; // in the middle of a clause
+
+	skip = (mem == NULL) ? 0 : ARENA_ALIGN((uintptr_t)mem) - (uintptr_t)mem;
+	if (size < skip)
+		mem = NULL;
+	arena_mem = (mem == NULL) ? NULL : (uint8_t *)mem + skip;
+	arena_size = (mem == NULL) ? 0 : size - skip;
+	arena_top = 0;
+	return 0;
+}
+
+ESPEAK_NG_API size_t espeak_ArenaHighWater(void)
+{
+	return arena_high;
+}
+
+ESPEAK_NG_API int espeak_ArenaOverflows(void)
+{
+	return arena_overflows;
+}
+#pragma GCC visibility pop
@@ -29,6 +29,10 @@ extern ESPEAK_NG_API void strncpy0(char *to, const char *from, int size);
 void espeak_srand(long seed);
 long espeak_rand(long min, long max);
 
+void *arena_alloc(size_t size);
+size_t arena_mark(void);
+void arena_release(size_t mark); // drops everything allocated since arena_mark() returned mark
+
 int IsAlpha(unsigned int c);
 int IsBracket(int c);
 int IsDigit(unsigned int c);
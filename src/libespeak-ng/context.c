@@ -0,0 +1,201 @@
+/*
+ * Copyright (C) 2025 Earle F. Philhower, III
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, see: <http://www.gnu.org/licenses/>.
+ */
+
+// Speech contexts.  The state which carries over from one call to the next (the text being
+// translated, the voice and parameters, and everything the wave generator is in the middle of)
+// is listed by each module.  Switching contexts saves those variables and loads another set,
+// so several speakers can be stepped in turn.  That copies a few KB each way, so callers only
+// switch when a different speaker needs to run.  Each context also has its own copy of the
+// wave generator's buffers, which are switched by pointer rather than copied.
+
+#include "config.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef ARDUINO
+#include <espeak-ng/espeak_ng.h>
+#include <espeak-ng/speak_lib.h>
+#include <espeak-ng/encoding.h>
+#else
+#include "espeak-ng/espeak_ng.h"
+#include "espeak-ng/speak_lib.h"
+#include "espeak-ng/encoding.h"
+#endif
+
+#include "context.h"
+#include "translate.h"                // for p_decoder
+
+struct espeak_CONTEXT {
+	unsigned char *state; // saved values of all the context variables
+};
+
+static const CONTEXT_VAR *const context_vars[] = {
+	wavegen_context_vars,
+	synthesize_context_vars,
+	synthdata_context_vars,
+	translate_context_vars,
+	readclause_context_vars,
+	setlengths_context_vars,
+	dictionary_context_vars,
+	voices_context_vars,
+	NULL
+};
+
+static const CONTEXT_BUFFER *const context_buffers[] = {
+	wavegen_context_buffers,
+	synthesize_context_buffers,
+	synthdata_context_buffers,
+	NULL
+};
+
+static espeak_CONTEXT default_context; // the state before any other context was created
+static espeak_CONTEXT *current_context = &default_context;
+static size_t state_size = 0;
+
+#define CONTEXT_ALIGN(n) (((n) + 7) & ~(size_t)7)
+
+static size_t StateSize(void)
+{
+	if (state_size == 0) {
+		for (int ix = 0; context_vars[ix] != NULL; ix++) {
+			for (const CONTEXT_VAR *v = context_vars[ix]; v->var != NULL; v++)
+				state_size += v->size;
+		}
+	}
+	return state_size;
+}
+
+static void SaveState(espeak_CONTEXT *ctx)
+{
+	unsigned char *p = ctx->state;
+
+	for (int ix = 0; context_vars[ix] != NULL; ix++) {
+		for (const CONTEXT_VAR *v = context_vars[ix]; v->var != NULL; v++) {
+			memcpy(p, v->var, v->size);
+			p += v->size;
+		}
+	}
+}
+
+static void LoadState(const espeak_CONTEXT *ctx)
+{
+	const unsigned char *p = ctx->state;
+
+	for (int ix = 0; context_vars[ix] != NULL; ix++) {
+		for (const CONTEXT_VAR *v = context_vars[ix]; v->var != NULL; v++) {
+			memcpy(v->var, p, v->size);
+			p += v->size;
+		}
+	}
+}
+
+static void *SavedVar(espeak_CONTEXT *ctx, const void *var)
+{
+	// Where the saved value of a context variable is kept
+	unsigned char *p = ctx->state;
+
+	for (int ix = 0; context_vars[ix] != NULL; ix++) {
+		for (const CONTEXT_VAR *v = context_vars[ix]; v->var != NULL; v++) {
+			if (v->var == var)
+				return p;
+			p += v->size;
+		}
+	}
+	return NULL;
+}
+
+#pragma GCC visibility push(default)
+
+ESPEAK_API espeak_CONTEXT *espeak_SetContext(espeak_CONTEXT *ctx)
+{
+	espeak_CONTEXT *prev = current_context;
+
+	if (ctx == NULL)
+		ctx = &default_context;
+	if (ctx != current_context) {
+		SaveState(current_context);
+		LoadState(ctx);
+		current_context = ctx;
+	}
+	return (prev == &default_context) ? NULL : prev;
+}
+
+ESPEAK_API espeak_CONTEXT *espeak_CreateContext(void)
+{
+	espeak_CONTEXT *ctx;
+	espeak_CONTEXT *prev = current_context;
+	size_t size = CONTEXT_ALIGN(sizeof(espeak_CONTEXT)) + CONTEXT_ALIGN(StateSize());
+	unsigned char *buf;
+	int ix;
+
+	if (default_context.state == NULL) {
+		if ((default_context.state = (unsigned char *)malloc(StateSize())) == NULL)
+			return NULL;
+	}
+	for (ix = 0; context_buffers[ix] != NULL; ix++) {
+		for (const CONTEXT_BUFFER *b = context_buffers[ix]; b->ptr != NULL; b++)
+			size += CONTEXT_ALIGN(b->size);
+	}
+	if ((ctx = (espeak_CONTEXT *)calloc(1, size)) == NULL)
+		return NULL;
+	ctx->state = (unsigned char *)ctx + CONTEXT_ALIGN(sizeof(espeak_CONTEXT));
+
+	// Start from a copy of the current context, with its own buffers, and nothing in progress
+	SaveState(prev);
+	current_context = ctx;
+	buf = ctx->state + CONTEXT_ALIGN(StateSize());
+	for (ix = 0; context_buffers[ix] != NULL; ix++) {
+		for (const CONTEXT_BUFFER *b = context_buffers[ix]; b->ptr != NULL; b++) {
+			memcpy(b->ptr, &buf, sizeof(buf));
+			buf += CONTEXT_ALIGN(b->size);
+		}
+	}
+	WavegenResetContext();
+	SynthesizeResetContext();
+	SynthdataResetContext();
+	TranslateResetContext();
+	ReadclauseResetContext();
+	SpeechResetContext();
+
+	SaveState(ctx);
+	LoadState(prev);
+	current_context = prev;
+	return ctx;
+}
+
+ESPEAK_API void espeak_DeleteContext(espeak_CONTEXT *ctx)
+{
+	espeak_ng_TEXT_DECODER *decoder = NULL;
+	void *saved;
+
+	if ((ctx == NULL) || (ctx == &default_context))
+		return;
+	if (ctx == current_context)
+		espeak_SetContext(NULL);
+
+	// The saved copy may not be aligned
+	if ((saved = SavedVar(ctx, &p_decoder)) != NULL)
+		memcpy(&decoder, saved, sizeof(decoder));
+	if (decoder != NULL)
+		destroy_text_decoder(decoder);
+	free(ctx);
+}
+
+#pragma GCC visibility pop
@@ -0,0 +1,67 @@
+/*
+ * Copyright (C) 2025 Earle F. Philhower, III
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, see: <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ESPEAK_NG_CONTEXT_H
+#define ESPEAK_NG_CONTEXT_H
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+// A variable which belongs to a speech context, saved and restored when switching contexts
+typedef struct {
+	void *var;
+	size_t size;
+} CONTEXT_VAR;
+
+// A buffer each context has its own copy of, reached through a pointer variable which is also a CONTEXT_VAR
+typedef struct {
+	void *ptr;  // address of the pointer variable
+	size_t size;
+} CONTEXT_BUFFER;
+
+#define CONTEXT_VAR_ITEM(v) { &(v), sizeof(v) }
+#define CONTEXT_VAR_END { NULL, 0 }
+
+extern const CONTEXT_VAR wavegen_context_vars[];
+extern const CONTEXT_BUFFER wavegen_context_buffers[];
+extern const CONTEXT_VAR synthesize_context_vars[];
+extern const CONTEXT_BUFFER synthesize_context_buffers[];
+extern const CONTEXT_VAR synthdata_context_vars[];
+extern const CONTEXT_BUFFER synthdata_context_buffers[];
+extern const CONTEXT_VAR translate_context_vars[];
+extern const CONTEXT_VAR readclause_context_vars[];
+extern const CONTEXT_VAR setlengths_context_vars[];
+extern const CONTEXT_VAR dictionary_context_vars[];
+extern const CONTEXT_VAR voices_context_vars[];
+
+// Set up the variables of a new context, after its buffers have been switched in
+void WavegenResetContext(void);
+void SynthesizeResetContext(void);
+void SynthdataResetContext(void);
+void TranslateResetContext(void);
+void ReadclauseResetContext(void);
+void SpeechResetContext(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
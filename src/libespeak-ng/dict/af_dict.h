@@ -1,5 +1,7 @@
 #pragma once
-const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
+#include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/af_dict_index.h>
+const unsigned char __espeakng_dict_af[] __attribute__((aligned((4)))) = {
   0x00, 0x04, 0x00, 0x00, 0x7e, 0xea, 0x00, 0x00, 0x00, 0x40, 0x19, 0xf0,
   0x9f, 0x91, 0xa9, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xe2, 0x80,
   0x8d, 0xf0, 0x9f, 0x91, 0xa7, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa7,
@@ -10124,4 +10126,11 @@ const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
   0x22, 0x0d, 0x00, 0xc3, 0xaa, 0x03, 0x82, 0x00, 0xc3, 0xb4, 0x03, 0x83,
   0x00, 0xc3, 0xae, 0x65, 0x03, 0x84, 0x00, 0x07, 0x00
 };
-size_t __espeakng_dictlen = 121473;
+
+BackgroundAudioDictionary dict_af = {
+    "af",
+    121473,
+    __espeakng_dict_af,
+    11738,
+    __espeakng_dictindex_af
+};
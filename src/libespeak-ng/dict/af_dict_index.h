@@ -0,0 +1,982 @@
+#pragma once
+const unsigned char __espeakng_dictindex_af[] __attribute__((aligned((4)))) = {
+  0x45, 0x44, 0x58, 0x31, 0x81, 0xda, 0x01, 0x00, 0x7e, 0xea, 0x00, 0x00,
+  0x97, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x0c, 0x00,
+  0x0d, 0x00, 0x0d, 0x00, 0x0e, 0x00, 0x11, 0x00, 0x15, 0x00, 0x16, 0x00,
+  0x19, 0x00, 0x1a, 0x00, 0x1e, 0x00, 0x20, 0x00, 0x23, 0x00, 0x24, 0x00,
+  0x25, 0x00, 0x25, 0x00, 0x26, 0x00, 0x27, 0x00, 0x27, 0x00, 0x2c, 0x00,
+  0x2e, 0x00, 0x30, 0x00, 0x30, 0x00, 0x31, 0x00, 0x36, 0x00, 0x36, 0x00,
+  0x36, 0x00, 0x39, 0x00, 0x3c, 0x00, 0x3d, 0x00, 0x40, 0x00, 0x43, 0x00,
+  0x44, 0x00, 0x44, 0x00, 0x45, 0x00, 0x46, 0x00, 0x48, 0x00, 0x4d, 0x00,
+  0x51, 0x00, 0x53, 0x00, 0x55, 0x00, 0x55, 0x00, 0x58, 0x00, 0x5d, 0x00,
+  0x60, 0x00, 0x60, 0x00, 0x61, 0x00, 0x64, 0x00, 0x66, 0x00, 0x69, 0x00,
+  0x6b, 0x00, 0x6c, 0x00, 0x6f, 0x00, 0x72, 0x00, 0x72, 0x00, 0x74, 0x00,
+  0x77, 0x00, 0x77, 0x00, 0x79, 0x00, 0x7d, 0x00, 0x82, 0x00, 0x85, 0x00,
+  0x86, 0x00, 0x87, 0x00, 0x8a, 0x00, 0x8d, 0x00, 0x8f, 0x00, 0x90, 0x00,
+  0x93, 0x00, 0x94, 0x00, 0x96, 0x00, 0x99, 0x00, 0x99, 0x00, 0xa2, 0x00,
+  0xa3, 0x00, 0xaf, 0x00, 0xb0, 0x00, 0xb3, 0x00, 0xb4, 0x00, 0xb4, 0x00,
+  0xb5, 0x00, 0xb7, 0x00, 0xb7, 0x00, 0xb8, 0x00, 0xbb, 0x00, 0xbc, 0x00,
+  0xbc, 0x00, 0xbd, 0x00, 0xbf, 0x00, 0xc8, 0x00, 0xc9, 0x00, 0xd0, 0x00,
+  0xd4, 0x00, 0xd4, 0x00, 0xd6, 0x00, 0xd6, 0x00, 0xd9, 0x00, 0xda, 0x00,
+  0xdb, 0x00, 0xdc, 0x00, 0xde, 0x00, 0xe0, 0x00, 0xe2, 0x00, 0xe4, 0x00,
+  0xe6, 0x00, 0xf0, 0x00, 0xf5, 0x00, 0xff, 0x00, 0x02, 0x01, 0x06, 0x01,
+  0x0b, 0x01, 0x0e, 0x01, 0x11, 0x01, 0x14, 0x01, 0x17, 0x01, 0x1a, 0x01,
+  0x1d, 0x01, 0x1e, 0x01, 0x23, 0x01, 0x28, 0x01, 0x2a, 0x01, 0x31, 0x01,
+  0x33, 0x01, 0x3a, 0x01, 0x3d, 0x01, 0x41, 0x01, 0x44, 0x01, 0x46, 0x01,
+  0x47, 0x01, 0x4c, 0x01, 0x4e, 0x01, 0x4e, 0x01, 0x4e, 0x01, 0x4e, 0x01,
+  0x4f, 0x01, 0x51, 0x01, 0x53, 0x01, 0x59, 0x01, 0x5c, 0x01, 0x64, 0x01,
+  0x67, 0x01, 0x6b, 0x01, 0x6f, 0x01, 0x71, 0x01, 0x73, 0x01, 0x75, 0x01,
+  0x79, 0x01, 0x80, 0x01, 0x82, 0x01, 0x85, 0x01, 0x89, 0x01, 0x91, 0x01,
+  0x96, 0x01, 0x99, 0x01, 0x9b, 0x01, 0x9f, 0x01, 0xa1, 0x01, 0xaa, 0x01,
+  0xaf, 0x01, 0xb0, 0x01, 0xb3, 0x01, 0xb7, 0x01, 0xb9, 0x01, 0xbb, 0x01,
+  0xbc, 0x01, 0xbc, 0x01, 0xc0, 0x01, 0xca, 0x01, 0xcb, 0x01, 0xce, 0x01,
+  0xd1, 0x01, 0xd3, 0x01, 0xd3, 0x01, 0xd7, 0x01, 0xd8, 0x01, 0xda, 0x01,
+  0xdb, 0x01, 0xdc, 0x01, 0xde, 0x01, 0xde, 0x01, 0xdf, 0x01, 0xe1, 0x01,
+  0xe5, 0x01, 0xe6, 0x01, 0xe8, 0x01, 0xec, 0x01, 0xee, 0x01, 0xee, 0x01,
+  0xf0, 0x01, 0xf2, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf5, 0x01, 0xf6, 0x01,
+  0xf9, 0x01, 0xf9, 0x01, 0xfa, 0x01, 0xfa, 0x01, 0xfb, 0x01, 0xff, 0x01,
+  0xff, 0x01, 0xff, 0x01, 0x01, 0x02, 0x02, 0x02, 0x04, 0x02, 0x05, 0x02,
+  0x06, 0x02, 0x06, 0x02, 0x08, 0x02, 0x0d, 0x02, 0x0d, 0x02, 0x0e, 0x02,
+  0x0e, 0x02, 0x10, 0x02, 0x10, 0x02, 0x13, 0x02, 0x13, 0x02, 0x1f, 0x02,
+  0x20, 0x02, 0x21, 0x02, 0x21, 0x02, 0x22, 0x02, 0x23, 0x02, 0x23, 0x02,
+  0x23, 0x02, 0x25, 0x02, 0x26, 0x02, 0x26, 0x02, 0x26, 0x02, 0x29, 0x02,
+  0x31, 0x02, 0x31, 0x02, 0x32, 0x02, 0x37, 0x02, 0x41, 0x02, 0x41, 0x02,
+  0x43, 0x02, 0x46, 0x02, 0x49, 0x02, 0x4a, 0x02, 0x4a, 0x02, 0x4a, 0x02,
+  0x4c, 0x02, 0x4d, 0x02, 0x4e, 0x02, 0x4f, 0x02, 0x4f, 0x02, 0x52, 0x02,
+  0x53, 0x02, 0x54, 0x02, 0x55, 0x02, 0x56, 0x02, 0x57, 0x02, 0x57, 0x02,
+  0x57, 0x02, 0x57, 0x02, 0x58, 0x02, 0x59, 0x02, 0x5e, 0x02, 0x5f, 0x02,
+  0x63, 0x02, 0x68, 0x02, 0x6a, 0x02, 0x6b, 0x02, 0x6c, 0x02, 0x78, 0x02,
+  0x78, 0x02, 0x7b, 0x02, 0x7b, 0x02, 0x7b, 0x02, 0x7c, 0x02, 0x7f, 0x02,
+  0x81, 0x02, 0x82, 0x02, 0x84, 0x02, 0x85, 0x02, 0x89, 0x02, 0x8d, 0x02,
+  0x8e, 0x02, 0x8f, 0x02, 0x91, 0x02, 0x91, 0x02, 0x91, 0x02, 0x92, 0x02,
+  0x92, 0x02, 0x95, 0x02, 0x96, 0x02, 0x97, 0x02, 0x97, 0x02, 0x97, 0x02,
+  0x98, 0x02, 0x9b, 0x02, 0x9b, 0x02, 0x9c, 0x02, 0x9d, 0x02, 0x9f, 0x02,
+  0x9f, 0x02, 0xa2, 0x02, 0xa3, 0x02, 0xa4, 0x02, 0xa5, 0x02, 0xa7, 0x02,
+  0xa9, 0x02, 0xac, 0x02, 0xac, 0x02, 0xaf, 0x02, 0xb1, 0x02, 0xb3, 0x02,
+  0xb3, 0x02, 0xb8, 0x02, 0xb8, 0x02, 0xb9, 0x02, 0xbb, 0x02, 0xbe, 0x02,
+  0xbf, 0x02, 0xc1, 0x02, 0xc1, 0x02, 0xc1, 0x02, 0xc2, 0x02, 0xc4, 0x02,
+  0xc6, 0x02, 0xc6, 0x02, 0xc7, 0x02, 0xc8, 0x02, 0xc8, 0x02, 0xca, 0x02,
+  0xca, 0x02, 0xcb, 0x02, 0xcc, 0x02, 0xcf, 0x02, 0xcf, 0x02, 0xd2, 0x02,
+  0xd3, 0x02, 0xd4, 0x02, 0xd5, 0x02, 0xd7, 0x02, 0xd9, 0x02, 0xda, 0x02,
+  0xdc, 0x02, 0xdd, 0x02, 0xde, 0x02, 0xe2, 0x02, 0xe3, 0x02, 0xe4, 0x02,
+  0xe4, 0x02, 0xe4, 0x02, 0xe7, 0x02, 0xe8, 0x02, 0xea, 0x02, 0xeb, 0x02,
+  0xec, 0x02, 0xee, 0x02, 0xef, 0x02, 0xef, 0x02, 0xf0, 0x02, 0xf1, 0x02,
+  0xf1, 0x02, 0xf4, 0x02, 0xf7, 0x02, 0xf8, 0x02, 0xfe, 0x02, 0x00, 0x03,
+  0x04, 0x03, 0x08, 0x03, 0x0a, 0x03, 0x0c, 0x03, 0x0f, 0x03, 0x11, 0x03,
+  0x16, 0x03, 0x18, 0x03, 0x19, 0x03, 0x1b, 0x03, 0x1d, 0x03, 0x1e, 0x03,
+  0x1f, 0x03, 0x21, 0x03, 0x23, 0x03, 0x24, 0x03, 0x26, 0x03, 0x28, 0x03,
+  0x28, 0x03, 0x2a, 0x03, 0x2a, 0x03, 0x2b, 0x03, 0x2b, 0x03, 0x2c, 0x03,
+  0x2e, 0x03, 0x31, 0x03, 0x38, 0x03, 0x3b, 0x03, 0x3b, 0x03, 0x3b, 0x03,
+  0x3c, 0x03, 0x3c, 0x03, 0x3f, 0x03, 0x41, 0x03, 0x44, 0x03, 0x46, 0x03,
+  0x48, 0x03, 0x4a, 0x03, 0x4a, 0x03, 0x4a, 0x03, 0x4b, 0x03, 0x4e, 0x03,
+  0x4e, 0x03, 0x4e, 0x03, 0x4e, 0x03, 0x51, 0x03, 0x52, 0x03, 0x56, 0x03,
+  0x58, 0x03, 0x59, 0x03, 0x5e, 0x03, 0x62, 0x03, 0x63, 0x03, 0x66, 0x03,
+  0x69, 0x03, 0x6c, 0x03, 0x6e, 0x03, 0x73, 0x03, 0x75, 0x03, 0x78, 0x03,
+  0x7a, 0x03, 0x7c, 0x03, 0x80, 0x03, 0x80, 0x03, 0x85, 0x03, 0x87, 0x03,
+  0x88, 0x03, 0x8a, 0x03, 0x8a, 0x03, 0x8b, 0x03, 0x8e, 0x03, 0x8f, 0x03,
+  0x90, 0x03, 0x90, 0x03, 0x91, 0x03, 0x92, 0x03, 0x93, 0x03, 0x94, 0x03,
+  0x95, 0x03, 0x99, 0x03, 0x99, 0x03, 0x9a, 0x03, 0x9c, 0x03, 0x9c, 0x03,
+  0x9f, 0x03, 0x9f, 0x03, 0xa0, 0x03, 0xa1, 0x03, 0xa3, 0x03, 0xa6, 0x03,
+  0xac, 0x03, 0xae, 0x03, 0xb2, 0x03, 0xb2, 0x03, 0xb4, 0x03, 0xb5, 0x03,
+  0xb6, 0x03, 0xb9, 0x03, 0xba, 0x03, 0xbb, 0x03, 0xbb, 0x03, 0xbd, 0x03,
+  0xc0, 0x03, 0xc0, 0x03, 0xc3, 0x03, 0xc4, 0x03, 0xc5, 0x03, 0xc8, 0x03,
+  0xc9, 0x03, 0xc9, 0x03, 0xcb, 0x03, 0xcb, 0x03, 0xcf, 0x03, 0xd1, 0x03,
+  0xd2, 0x03, 0xd2, 0x03, 0xd4, 0x03, 0xd6, 0x03, 0xd7, 0x03, 0xda, 0x03,
+  0xdc, 0x03, 0xdf, 0x03, 0xe1, 0x03, 0xea, 0x03, 0xed, 0x03, 0xf1, 0x03,
+  0xf5, 0x03, 0xfb, 0x03, 0xfc, 0x03, 0x02, 0x04, 0x03, 0x04, 0x06, 0x04,
+  0x07, 0x04, 0x09, 0x04, 0x0b, 0x04, 0x0c, 0x04, 0x0c, 0x04, 0x10, 0x04,
+  0x11, 0x04, 0x14, 0x04, 0x15, 0x04, 0x16, 0x04, 0x16, 0x04, 0x17, 0x04,
+  0x1d, 0x04, 0x22, 0x04, 0x25, 0x04, 0x25, 0x04, 0x2b, 0x04, 0x2c, 0x04,
+  0x30, 0x04, 0x34, 0x04, 0x37, 0x04, 0x3d, 0x04, 0x3d, 0x04, 0x40, 0x04,
+  0x44, 0x04, 0x49, 0x04, 0x52, 0x04, 0x54, 0x04, 0x55, 0x04, 0x56, 0x04,
+  0x60, 0x04, 0x63, 0x04, 0x66, 0x04, 0x6a, 0x04, 0x6e, 0x04, 0x6f, 0x04,
+  0x71, 0x04, 0x73, 0x04, 0x75, 0x04, 0x78, 0x04, 0x79, 0x04, 0x7a, 0x04,
+  0x7e, 0x04, 0x84, 0x04, 0x86, 0x04, 0x8b, 0x04, 0x91, 0x04, 0x91, 0x04,
+  0x97, 0x04, 0x9f, 0x04, 0xa3, 0x04, 0xa5, 0x04, 0xa8, 0x04, 0xa9, 0x04,
+  0xab, 0x04, 0xac, 0x04, 0xad, 0x04, 0xad, 0x04, 0xaf, 0x04, 0xb0, 0x04,
+  0xb0, 0x04, 0xb2, 0x04, 0xb3, 0x04, 0xb4, 0x04, 0xb7, 0x04, 0xb9, 0x04,
+  0xbb, 0x04, 0xbd, 0x04, 0xbe, 0x04, 0xc1, 0x04, 0xc4, 0x04, 0xc6, 0x04,
+  0xc6, 0x04, 0xc7, 0x04, 0xcb, 0x04, 0xcc, 0x04, 0xcf, 0x04, 0xd3, 0x04,
+  0xd3, 0x04, 0xd4, 0x04, 0xd6, 0x04, 0xd6, 0x04, 0xd8, 0x04, 0xd8, 0x04,
+  0xdd, 0x04, 0xdf, 0x04, 0xdf, 0x04, 0xe0, 0x04, 0xe2, 0x04, 0xe4, 0x04,
+  0xe4, 0x04, 0xe5, 0x04, 0xe6, 0x04, 0xe6, 0x04, 0xe6, 0x04, 0xe6, 0x04,
+  0xe7, 0x04, 0xe8, 0x04, 0xeb, 0x04, 0xec, 0x04, 0xef, 0x04, 0xf0, 0x04,
+  0xf2, 0x04, 0xf4, 0x04, 0xfb, 0x04, 0xfd, 0x04, 0xfe, 0x04, 0xff, 0x04,
+  0x02, 0x05, 0x03, 0x05, 0x03, 0x05, 0x04, 0x05, 0x07, 0x05, 0x08, 0x05,
+  0x09, 0x05, 0x09, 0x05, 0x0f, 0x05, 0x11, 0x05, 0x12, 0x05, 0x13, 0x05,
+  0x14, 0x05, 0x16, 0x05, 0x18, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05,
+  0x1a, 0x05, 0x1c, 0x05, 0x20, 0x05, 0x22, 0x05, 0x22, 0x05, 0x22, 0x05,
+  0x23, 0x05, 0x23, 0x05, 0x23, 0x05, 0x24, 0x05, 0x26, 0x05, 0x2b, 0x05,
+  0x2b, 0x05, 0x2d, 0x05, 0x2e, 0x05, 0x2f, 0x05, 0x2f, 0x05, 0x31, 0x05,
+  0x31, 0x05, 0x31, 0x05, 0x34, 0x05, 0x36, 0x05, 0x38, 0x05, 0x3c, 0x05,
+  0x3d, 0x05, 0x40, 0x05, 0x42, 0x05, 0x46, 0x05, 0x48, 0x05, 0x4b, 0x05,
+  0x4c, 0x05, 0x4e, 0x05, 0x4f, 0x05, 0x55, 0x05, 0x59, 0x05, 0x5a, 0x05,
+  0x5a, 0x05, 0x5a, 0x05, 0x5a, 0x05, 0x5a, 0x05, 0x5a, 0x05, 0x5b, 0x05,
+  0x5b, 0x05, 0x63, 0x05, 0x65, 0x05, 0x67, 0x05, 0x69, 0x05, 0x6c, 0x05,
+  0x6d, 0x05, 0x74, 0x05, 0x79, 0x05, 0x7a, 0x05, 0x7c, 0x05, 0x7e, 0x05,
+  0x7f, 0x05, 0x83, 0x05, 0x85, 0x05, 0x8a, 0x05, 0x8c, 0x05, 0x91, 0x05,
+  0x94, 0x05, 0x9b, 0x05, 0xa1, 0x05, 0xa6, 0x05, 0xa9, 0x05, 0xaf, 0x05,
+  0xb2, 0x05, 0xb4, 0x05, 0xb7, 0x05, 0xb9, 0x05, 0xbc, 0x05, 0xc4, 0x05,
+  0xca, 0x05, 0xce, 0x05, 0xd3, 0x05, 0xde, 0x05, 0xe4, 0x05, 0xef, 0x05,
+  0xf5, 0x05, 0xfc, 0x05, 0xff, 0x05, 0x02, 0x06, 0x06, 0x06, 0x09, 0x06,
+  0x10, 0x06, 0x15, 0x06, 0x19, 0x06, 0x1f, 0x06, 0x26, 0x06, 0x2e, 0x06,
+  0x35, 0x06, 0x3d, 0x06, 0x44, 0x06, 0x50, 0x06, 0x59, 0x06, 0x64, 0x06,
+  0x6c, 0x06, 0x75, 0x06, 0x7c, 0x06, 0x81, 0x06, 0x88, 0x06, 0x8e, 0x06,
+  0x99, 0x06, 0xa2, 0x06, 0xac, 0x06, 0xbb, 0x06, 0xc7, 0x06, 0xd9, 0x06,
+  0xe3, 0x06, 0xec, 0x06, 0xf5, 0x06, 0xfd, 0x06, 0x05, 0x07, 0x0d, 0x07,
+  0x14, 0x07, 0x1b, 0x07, 0x23, 0x07, 0x29, 0x07, 0x31, 0x07, 0x3a, 0x07,
+  0x42, 0x07, 0x49, 0x07, 0x53, 0x07, 0x5d, 0x07, 0x6c, 0x07, 0x76, 0x07,
+  0x7f, 0x07, 0x8d, 0x07, 0x9a, 0x07, 0xa1, 0x07, 0xa9, 0x07, 0xb1, 0x07,
+  0xba, 0x07, 0xc1, 0x07, 0xcb, 0x07, 0xd3, 0x07, 0xdc, 0x07, 0xed, 0x07,
+  0xf3, 0x07, 0x05, 0x08, 0x0e, 0x08, 0x16, 0x08, 0x1c, 0x08, 0x28, 0x08,
+  0x30, 0x08, 0x39, 0x08, 0x43, 0x08, 0x4c, 0x08, 0x54, 0x08, 0x5d, 0x08,
+  0x64, 0x08, 0x6a, 0x08, 0x6f, 0x08, 0x76, 0x08, 0x7c, 0x08, 0x86, 0x08,
+  0x8d, 0x08, 0x96, 0x08, 0x9f, 0x08, 0xad, 0x08, 0xb7, 0x08, 0xbf, 0x08,
+  0xc7, 0x08, 0xcd, 0x08, 0xd5, 0x08, 0xdd, 0x08, 0xe5, 0x08, 0xea, 0x08,
+  0xf1, 0x08, 0xf7, 0x08, 0xfc, 0x08, 0x01, 0x09, 0x06, 0x09, 0x0c, 0x09,
+  0x12, 0x09, 0x19, 0x09, 0x1f, 0x09, 0x26, 0x09, 0x2c, 0x09, 0x30, 0x09,
+  0x3a, 0x09, 0x41, 0x09, 0x46, 0x09, 0x4a, 0x09, 0x51, 0x09, 0x57, 0x09,
+  0x5a, 0x09, 0x5e, 0x09, 0x63, 0x09, 0x6a, 0x09, 0x70, 0x09, 0x76, 0x09,
+  0x7c, 0x09, 0x81, 0x09, 0x88, 0x09, 0x8b, 0x09, 0x8e, 0x09, 0x93, 0x09,
+  0x98, 0x09, 0x9d, 0x09, 0xa3, 0x09, 0xa8, 0x09, 0xae, 0x09, 0xb0, 0x09,
+  0xb4, 0x09, 0xb6, 0x09, 0xba, 0x09, 0xbd, 0x09, 0xc2, 0x09, 0xc7, 0x09,
+  0xd5, 0x09, 0xd9, 0x09, 0xde, 0x09, 0xe1, 0x09, 0xe7, 0x09, 0xe8, 0x09,
+  0xea, 0x09, 0xee, 0x09, 0xf1, 0x09, 0xf3, 0x09, 0xf4, 0x09, 0xf5, 0x09,
+  0xf8, 0x09, 0xfc, 0x09, 0xfe, 0x09, 0x02, 0x0a, 0x08, 0x0a, 0x0b, 0x0a,
+  0x11, 0x0a, 0x15, 0x0a, 0x1a, 0x0a, 0x1b, 0x0a, 0x1c, 0x0a, 0x20, 0x0a,
+  0x23, 0x0a, 0x27, 0x0a, 0x27, 0x0a, 0x2e, 0x0a, 0x2f, 0x0a, 0x31, 0x0a,
+  0x35, 0x0a, 0x38, 0x0a, 0x3e, 0x0a, 0x3f, 0x0a, 0x41, 0x0a, 0x45, 0x0a,
+  0x48, 0x0a, 0x49, 0x0a, 0x4b, 0x0a, 0x4e, 0x0a, 0x4f, 0x0a, 0x50, 0x0a,
+  0x5b, 0x0a, 0x5d, 0x0a, 0x64, 0x0a, 0x69, 0x0a, 0x72, 0x0a, 0x77, 0x0a,
+  0x7b, 0x0a, 0x7f, 0x0a, 0x82, 0x0a, 0x89, 0x0a, 0x8c, 0x0a, 0x92, 0x0a,
+  0x99, 0x0a, 0xa0, 0x0a, 0xa4, 0x0a, 0xa9, 0x0a, 0xaf, 0x0a, 0xb5, 0x0a,
+  0xba, 0x0a, 0xbe, 0x0a, 0xc0, 0x0a, 0xc5, 0x0a, 0xcb, 0x0a, 0xce, 0x0a,
+  0xd2, 0x0a, 0xd5, 0x0a, 0xd6, 0x0a, 0xda, 0x0a, 0xe0, 0x0a, 0xe5, 0x0a,
+  0xec, 0x0a, 0xf3, 0x0a, 0xfe, 0x0a, 0x06, 0x0b, 0x11, 0x0b, 0x1b, 0x0b,
+  0x24, 0x0b, 0x2c, 0x0b, 0x33, 0x0b, 0x3b, 0x0b, 0x42, 0x0b, 0x4b, 0x0b,
+  0x53, 0x0b, 0x59, 0x0b, 0x62, 0x0b, 0x67, 0x0b, 0x72, 0x0b, 0x77, 0x0b,
+  0x7b, 0x0b, 0x80, 0x0b, 0x85, 0x0b, 0x8b, 0x0b, 0x91, 0x0b, 0x97, 0x0b,
+  0xa1, 0x0b, 0xa6, 0x0b, 0xad, 0x0b, 0xb2, 0x0b, 0xb7, 0x0b, 0xbb, 0x0b,
+  0xbf, 0x0b, 0xc4, 0x0b, 0xc8, 0x0b, 0xcd, 0x0b, 0xd2, 0x0b, 0xd7, 0x0b,
+  0xda, 0x0b, 0xdc, 0x0b, 0xe4, 0x0b, 0xe8, 0x0b, 0xea, 0x0b, 0xee, 0x0b,
+  0xf1, 0x0b, 0xf5, 0x0b, 0xfb, 0x0b, 0xfc, 0x0b, 0x00, 0x0c, 0x02, 0x0c,
+  0x05, 0x0c, 0x07, 0x0c, 0x0c, 0x0c, 0x0f, 0x0c, 0x13, 0x0c, 0x16, 0x0c,
+  0x18, 0x0c, 0x1c, 0x0c, 0x21, 0x0c, 0x23, 0x0c, 0x23, 0x0c, 0x25, 0x0c,
+  0x26, 0x0c, 0x27, 0x0c, 0x29, 0x0c, 0x2a, 0x0c, 0x2d, 0x0c, 0x2e, 0x0c,
+  0x32, 0x0c, 0x34, 0x0c, 0x38, 0x0c, 0x3d, 0x0c, 0x45, 0x0c, 0x47, 0x0c,
+  0x48, 0x0c, 0x48, 0x0c, 0x48, 0x0c, 0x49, 0x0c, 0x49, 0x0c, 0x4a, 0x0c,
+  0x4b, 0x0c, 0x4b, 0x0c, 0x4b, 0x0c, 0x4b, 0x0c, 0x4f, 0x0c, 0x50, 0x0c,
+  0x52, 0x0c, 0x52, 0x0c, 0x54, 0x0c, 0x57, 0x0c, 0x5a, 0x0c, 0x5c, 0x0c,
+  0x5d, 0x0c, 0x60, 0x0c, 0x61, 0x0c, 0x61, 0x0c, 0x61, 0x0c, 0x61, 0x0c,
+  0x62, 0x0c, 0x63, 0x0c, 0x64, 0x0c, 0x65, 0x0c, 0x6a, 0x0c, 0x73, 0x0c,
+  0x74, 0x0c, 0x74, 0x0c, 0x74, 0x0c, 0x77, 0x0c, 0x79, 0x0c, 0x7b, 0x0c,
+  0x7b, 0x0c, 0x7b, 0x0c, 0x7e, 0x0c, 0x7f, 0x0c, 0x82, 0x0c, 0x83, 0x0c,
+  0x85, 0x0c, 0x8a, 0x0c, 0x92, 0x0c, 0x94, 0x0c, 0x95, 0x0c, 0x95, 0x0c,
+  0x97, 0x0c, 0x00, 0x00, 0x8c, 0x02, 0x63, 0xea, 0x16, 0x31, 0x3e, 0xc6,
+  0x70, 0x35, 0x0b, 0x76, 0xc5, 0x17, 0x19, 0x36, 0x36, 0x51, 0x5d, 0x51,
+  0xa5, 0x00, 0x94, 0x67, 0x4d, 0x4e, 0x02, 0x86, 0x70, 0xdd, 0x27, 0x00,
+  0x67, 0xf0, 0xbb, 0x8f, 0x88, 0x67, 0x79, 0x93, 0x9f, 0xee, 0xaf, 0x65,
+  0x97, 0x3d, 0x44, 0x8e, 0xd1, 0xfe, 0xa0, 0x37, 0x37, 0x94, 0x82, 0xa5,
+  0x4c, 0xfe, 0xd9, 0x42, 0x05, 0xbf, 0xa5, 0xa4, 0x3a, 0xe9, 0x7c, 0x6e,
+  0x53, 0x53, 0xe5, 0xc4, 0x3b, 0xe3, 0xc2, 0x41, 0x3c, 0xd8, 0x4a, 0xaf,
+  0x12, 0x0f, 0xd3, 0xe6, 0x13, 0x7a, 0x65, 0x6a, 0xee, 0x2e, 0xbb, 0x6c,
+  0xd0, 0x2a, 0x98, 0xa9, 0x33, 0xa2, 0x05, 0xae, 0xbe, 0x35, 0x41, 0x85,
+  0x25, 0x07, 0x83, 0x53, 0xc5, 0x78, 0xe3, 0x1f, 0xec, 0x86, 0xa6, 0xe9,
+  0x84, 0xbc, 0x99, 0x03, 0x54, 0xd9, 0x00, 0x25, 0x3e, 0xe0, 0x7c, 0x5e,
+  0x8d, 0x30, 0x78, 0xbe, 0x90, 0x8c, 0xc5, 0x26, 0xf9, 0x85, 0xcc, 0x06,
+  0x64, 0x11, 0xd0, 0x21, 0x9e, 0x57, 0xf3, 0x92, 0xad, 0xe2, 0x30, 0xf3,
+  0x05, 0xb8, 0xa5, 0x89, 0xb3, 0xd6, 0x07, 0xa9, 0xfb, 0xc8, 0xcb, 0x48,
+  0x9a, 0xa1, 0xde, 0xe3, 0xe4, 0x05, 0x68, 0x82, 0xa6, 0x54, 0xa8, 0x40,
+  0x51, 0x2f, 0xaf, 0x73, 0x4c, 0x22, 0xfe, 0x54, 0x1d, 0x9a, 0xdb, 0x72,
+  0x3d, 0x5b, 0x31, 0x74, 0xff, 0xde, 0xef, 0xac, 0x58, 0xbe, 0x26, 0x45,
+  0xa4, 0x53, 0x17, 0x8d, 0xc4, 0x93, 0x7f, 0x9d, 0x0c, 0xab, 0xa3, 0x6f,
+  0x3b, 0xf2, 0x43, 0x7d, 0x0b, 0xd1, 0x15, 0xa1, 0xef, 0xa1, 0x46, 0xfd,
+  0x1f, 0x5e, 0x1e, 0x0a, 0x6c, 0xff, 0xd2, 0xae, 0x45, 0xa5, 0xf5, 0x61,
+  0x61, 0xfb, 0x0f, 0x08, 0xa1, 0x49, 0xe9, 0x71, 0xb3, 0xe7, 0x7a, 0x2c,
+  0x84, 0xde, 0x0a, 0x1a, 0x58, 0xf2, 0x10, 0x39, 0x16, 0xcf, 0x35, 0x5e,
+  0x91, 0x06, 0x1e, 0xa8, 0x94, 0xa6, 0x8b, 0x1d, 0x90, 0x89, 0x80, 0xee,
+  0x0e, 0x36, 0x4c, 0x78, 0x9d, 0x20, 0x75, 0xd4, 0x96, 0xea, 0x22, 0x09,
+  0x8d, 0x81, 0x6f, 0x81, 0xb6, 0xcb, 0xc5, 0x4d, 0xa4, 0xba, 0x66, 0x81,
+  0xfe, 0x49, 0xfc, 0xdf, 0x8e, 0x6a, 0xb0, 0xdf, 0x49, 0x12, 0xb2, 0x27,
+  0x38, 0xf5, 0x13, 0x7d, 0xe4, 0x8c, 0x80, 0x17, 0x65, 0xbe, 0x89, 0x0f,
+  0x25, 0xd5, 0x32, 0x6e, 0x9c, 0xb3, 0x2e, 0xb9, 0xfb, 0x14, 0x8c, 0xe6,
+  0x72, 0x9d, 0xf2, 0x36, 0x8b, 0xbe, 0x5f, 0xc3, 0x91, 0xb0, 0x41, 0x1a,
+  0x5e, 0xc8, 0x57, 0x24, 0x65, 0x79, 0x02, 0x16, 0x8b, 0xf4, 0x5e, 0x80,
+  0x09, 0xcc, 0xb3, 0x27, 0xbd, 0x02, 0x82, 0xf2, 0xed, 0xd8, 0x5f, 0xe3,
+  0x9b, 0xe2, 0x74, 0xa1, 0x81, 0x24, 0x34, 0x56, 0xf3, 0x24, 0x09, 0xd5,
+  0xbe, 0x86, 0x5b, 0xcb, 0x9a, 0x49, 0x32, 0xfe, 0x72, 0xaf, 0x62, 0x1a,
+  0x0e, 0x1e, 0x7b, 0x25, 0x8f, 0xc0, 0xf8, 0xa4, 0xe3, 0xaa, 0xb4, 0x02,
+  0xa0, 0x49, 0x75, 0x5a, 0xf9, 0x81, 0xdf, 0xff, 0x90, 0x7b, 0x1d, 0x6c,
+  0x48, 0x3b, 0x10, 0xbb, 0x48, 0x85, 0x56, 0x8a, 0xbf, 0xc7, 0xf7, 0x08,
+  0xd0, 0xe9, 0xd1, 0x09, 0x9d, 0x74, 0xfd, 0x37, 0x98, 0xbe, 0x72, 0x0d,
+  0x8a, 0x05, 0x1b, 0xf2, 0xf2, 0xd8, 0x06, 0x1c, 0x41, 0xbf, 0x45, 0xe3,
+  0x40, 0x88, 0x13, 0xa1, 0x12, 0xb0, 0xc8, 0xd4, 0x0f, 0x5b, 0xd7, 0xd2,
+  0x6c, 0x37, 0x59, 0xde, 0x11, 0xbc, 0x27, 0x29, 0xd8, 0xac, 0x31, 0x2b,
+  0x14, 0xb3, 0xf2, 0xbd, 0xdd, 0xeb, 0xac, 0xd8, 0x62, 0x4a, 0x0a, 0x75,
+  0xe8, 0x92, 0x08, 0xc9, 0xc7, 0xad, 0x16, 0x69, 0x8b, 0xf5, 0x22, 0x71,
+  0xa3, 0x6c, 0x63, 0x31, 0x51, 0x80, 0x2d, 0x4e, 0x44, 0xa2, 0x43, 0xf9,
+  0xbf, 0x33, 0xa4, 0x11, 0xd9, 0x82, 0xa0, 0x2a, 0x17, 0xfa, 0xfa, 0xfa,
+  0xfa, 0xff, 0xca, 0x80, 0xc4, 0x6d, 0x22, 0x1b, 0x30, 0x5c, 0x90, 0xde,
+  0xb5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0x9e, 0x85, 0xd1, 0x4f, 0x07,
+  0xa5, 0xcf, 0xda, 0x98, 0x6f, 0xfb, 0xa1, 0xdb, 0x1a, 0x2d, 0xe9, 0x0b,
+  0x7b, 0x82, 0x1c, 0xca, 0xff, 0x9d, 0x6c, 0xe6, 0x16, 0xf5, 0x62, 0xa0,
+  0xb7, 0xe3, 0x63, 0x18, 0x53, 0xf3, 0xe8, 0x12, 0xd7, 0xcb, 0xd5, 0x8c,
+  0x97, 0x7f, 0x01, 0x80, 0x8b, 0xa0, 0xcc, 0x51, 0xb2, 0x7c, 0xf8, 0xd8,
+  0xa3, 0x00, 0x3e, 0xd2, 0xbc, 0xda, 0x6d, 0x7c, 0x8a, 0xfb, 0x4f, 0xff,
+  0x3e, 0x87, 0x3e, 0x0c, 0x40, 0xf7, 0xdd, 0xd7, 0x83, 0xac, 0xb5, 0x26,
+  0x06, 0x89, 0xa8, 0x35, 0xc9, 0x46, 0x81, 0x30, 0x18, 0x5b, 0xfa, 0xeb,
+  0xa9, 0x81, 0xe4, 0x7e, 0x16, 0x56, 0x51, 0x6c, 0xdd, 0x2d, 0x63, 0xf0,
+  0x93, 0x0d, 0x89, 0x82, 0x44, 0xfb, 0x5b, 0x90, 0x99, 0xd7, 0xb8, 0x42,
+  0xfc, 0xa8, 0x03, 0xdb, 0xef, 0x9d, 0xdc, 0xe6, 0xd2, 0xcd, 0xa2, 0x22,
+  0xc3, 0x5e, 0x98, 0xd5, 0x85, 0x7f, 0xb9, 0x11, 0xce, 0xcf, 0x04, 0x92,
+  0x96, 0x6c, 0xae, 0x28, 0x47, 0xf9, 0x74, 0x4d, 0xbe, 0x87, 0xd7, 0x3a,
+  0x14, 0x5c, 0xc5, 0x23, 0xb5, 0x17, 0x77, 0xaf, 0x52, 0x1c, 0x1e, 0x67,
+  0x6d, 0x99, 0x79, 0x5a, 0x75, 0xfa, 0x52, 0x60, 0xe4, 0x84, 0x19, 0x24,
+  0x1a, 0x9f, 0x66, 0x47, 0x3b, 0xce, 0x8a, 0x0b, 0x2e, 0x7f, 0xf6, 0xf5,
+  0x7a, 0x15, 0xa2, 0x6e, 0xdb, 0x85, 0x51, 0x58, 0x9a, 0xf8, 0xb2, 0xa7,
+  0x3e, 0x91, 0x33, 0x77, 0x88, 0x16, 0x92, 0xca, 0xf4, 0x56, 0xc3, 0x3d,
+  0x12, 0x1f, 0x1b, 0x79, 0xdb, 0xab, 0x61, 0x26, 0x1a, 0x0e, 0xe5, 0x4b,
+  0x69, 0xb2, 0x1b, 0xd6, 0x88, 0xc6, 0x69, 0x23, 0xc1, 0xbb, 0x2c, 0x7c,
+  0x33, 0xa8, 0x44, 0x1d, 0x07, 0x8a, 0x2e, 0xa9, 0x63, 0x34, 0x3d, 0x37,
+  0x74, 0x3e, 0x4e, 0xa9, 0xf3, 0x65, 0x19, 0xd0, 0x61, 0x4a, 0x3c, 0x03,
+  0xbb, 0xf1, 0xfd, 0x04, 0xf5, 0xbe, 0x39, 0x40, 0xfe, 0xe7, 0x60, 0x68,
+  0x63, 0x9f, 0x1b, 0x30, 0x6c, 0xc0, 0xd8, 0x6c, 0x9a, 0x96, 0x94, 0x33,
+  0xe7, 0x89, 0xca, 0x34, 0xa9, 0x0d, 0xcd, 0x13, 0xcc, 0x0d, 0x7c, 0xdd,
+  0x96, 0x67, 0x79, 0xcf, 0x7c, 0x2d, 0x54, 0xb9, 0x30, 0xf9, 0xcc, 0xc8,
+  0x75, 0x6e, 0xe2, 0xe6, 0xcc, 0x82, 0x92, 0xe0, 0x7a, 0x05, 0x45, 0x34,
+  0xae, 0x8f, 0x45, 0xb3, 0x7d, 0x19, 0x0e, 0xc9, 0xcd, 0xbb, 0xbe, 0x2c,
+  0xd5, 0x4a, 0x9f, 0x57, 0x31, 0xa3, 0xa4, 0xb4, 0x89, 0xb6, 0xf7, 0x36,
+  0xf6, 0x70, 0xcd, 0x2f, 0x71, 0x7a, 0x16, 0x13, 0xc0, 0xa7, 0x03, 0x44,
+  0xb6, 0x48, 0xbc, 0x7e, 0x6c, 0x1f, 0x53, 0xda, 0xfd, 0x9a, 0xae, 0x19,
+  0x3d, 0xf2, 0x84, 0xee, 0x36, 0x42, 0x15, 0xdc, 0x35, 0xc9, 0x23, 0x5c,
+  0xdc, 0x15, 0x49, 0x34, 0x70, 0x00, 0xd4, 0x41, 0xd3, 0x00, 0x6b, 0x1f,
+  0xfe, 0x2d, 0x35, 0x06, 0x22, 0x3a, 0x90, 0xbb, 0x45, 0xc6, 0x0a, 0x89,
+  0x1b, 0x1d, 0x74, 0x78, 0x96, 0x19, 0x48, 0x4a, 0xd1, 0x88, 0x24, 0xc9,
+  0xfa, 0xd1, 0xb7, 0x4b, 0x0e, 0xed, 0x29, 0x35, 0x10, 0xc8, 0x5d, 0x06,
+  0xba, 0xbf, 0xea, 0xc4, 0xcf, 0x40, 0xe5, 0xee, 0xa6, 0x5c, 0xef, 0x2c,
+  0x8b, 0xe1, 0xe0, 0xa7, 0x4c, 0x37, 0xad, 0xa3, 0xc1, 0x59, 0x77, 0x51,
+  0x98, 0xe2, 0x0e, 0xce, 0xb3, 0xf9, 0xa3, 0xde, 0x36, 0x37, 0x6b, 0x09,
+  0xb2, 0xec, 0xee, 0x21, 0xcf, 0x98, 0x2e, 0xe3, 0x3c, 0x08, 0xbf, 0x4a,
+  0xc9, 0xdd, 0x68, 0x2e, 0x85, 0xc4, 0x41, 0xb2, 0x35, 0xb1, 0x76, 0x5f,
+  0x7f, 0xac, 0x18, 0x83, 0xe1, 0x10, 0x7d, 0x78, 0xae, 0x7a, 0xfa, 0xf0,
+  0x71, 0xd3, 0xcb, 0x58, 0x7a, 0x4d, 0xd0, 0x76, 0xb7, 0xb8, 0x96, 0xed,
+  0x0a, 0x11, 0x02, 0x03, 0x5e, 0x2a, 0x51, 0xc8, 0x92, 0xe1, 0x7c, 0x4d,
+  0xef, 0x97, 0xf8, 0x70, 0xe7, 0x01, 0x4a, 0x65, 0x95, 0xae, 0xac, 0x6b,
+  0x0e, 0xfa, 0x81, 0x08, 0x08, 0x08, 0x08, 0x08, 0x2e, 0xa7, 0xd5, 0xde,
+  0x1d, 0xd9, 0x30, 0xfd, 0xb5, 0xa5, 0xec, 0x92, 0x04, 0xe0, 0xf2, 0x9d,
+  0xec, 0x82, 0xdf, 0x4d, 0xd8, 0xae, 0x6e, 0x65, 0x2e, 0xf9, 0x56, 0x6e,
+  0x1c, 0x35, 0x20, 0xd5, 0xe1, 0x6e, 0x8c, 0x3d, 0xc4, 0x95, 0x41, 0xb2,
+  0x57, 0x44, 0x2f, 0xeb, 0xf9, 0x59, 0x95, 0x31, 0x5b, 0x95, 0x0a, 0xaf,
+  0x26, 0x41, 0x49, 0x23, 0x3c, 0xad, 0x2d, 0x6f, 0x44, 0x12, 0xdb, 0x23,
+  0x50, 0x45, 0x94, 0x62, 0xfb, 0x50, 0x8b, 0xba, 0x74, 0x13, 0x0a, 0x35,
+  0x72, 0x07, 0xd3, 0x4c, 0x8d, 0xc4, 0x65, 0x11, 0xb0, 0x51, 0xcb, 0x7e,
+  0x5e, 0x5e, 0xde, 0x3f, 0xc0, 0x65, 0x6b, 0xd6, 0x09, 0xe9, 0xe6, 0x02,
+  0x08, 0xaa, 0x96, 0x7a, 0xe3, 0xf8, 0x33, 0x71, 0x9e, 0x05, 0x8a, 0xb0,
+  0x73, 0x74, 0x4f, 0xeb, 0xb9, 0x25, 0x28, 0x6e, 0xf2, 0xeb, 0x2b, 0x39,
+  0x23, 0xe9, 0xbb, 0x7a, 0x89, 0xa2, 0x13, 0x1f, 0xd1, 0x13, 0xf3, 0xd4,
+  0xd6, 0x36, 0xd2, 0x16, 0x12, 0xb9, 0x53, 0x51, 0x98, 0x83, 0x08, 0x13,
+  0x96, 0x7f, 0xa1, 0x66, 0x7d, 0x90, 0x01, 0x39, 0x18, 0x09, 0xa4, 0xa0,
+  0x51, 0xa7, 0x6f, 0x77, 0xa8, 0x79, 0x4e, 0x70, 0xd6, 0xef, 0x84, 0xb7,
+  0xc2, 0xb5, 0xd8, 0x09, 0x6c, 0xc0, 0xf1, 0xe0, 0x2f, 0x51, 0x9c, 0xc0,
+  0x5a, 0xbc, 0x7a, 0xfb, 0x1d, 0x82, 0x66, 0x35, 0x81, 0x47, 0x43, 0xb0,
+  0x5e, 0x69, 0xe6, 0xf2, 0x48, 0xe1, 0x30, 0x24, 0x8f, 0x4c, 0xfb, 0x76,
+  0x1a, 0x73, 0x55, 0xd4, 0x4c, 0x72, 0x26, 0x59, 0x12, 0x55, 0xf2, 0xf6,
+  0xb9, 0xab, 0x9c, 0x82, 0xb9, 0x00, 0x93, 0x80, 0xae, 0xaf, 0xba, 0x48,
+  0xab, 0x3b, 0xe6, 0xda, 0x07, 0x4e, 0xd9, 0x5b, 0x5f, 0xac, 0x6c, 0xee,
+  0x96, 0xbe, 0x3c, 0x32, 0x9d, 0xe7, 0x3d, 0x75, 0x21, 0xd0, 0x77, 0xf6,
+  0x45, 0x29, 0x67, 0x3d, 0x40, 0xa8, 0x6b, 0x05, 0x46, 0x90, 0x8b, 0x61,
+  0x4a, 0x61, 0x97, 0xfe, 0x78, 0xbb, 0x77, 0x01, 0x9e, 0x85, 0x65, 0x9e,
+  0x65, 0xbe, 0x0f, 0x29, 0x12, 0xae, 0xfb, 0xa7, 0xd0, 0x3a, 0xcc, 0x8c,
+  0x40, 0xfb, 0xa8, 0x79, 0x0e, 0x64, 0x1d, 0x98, 0x6d, 0xe5, 0xad, 0x8d,
+  0xf1, 0xc2, 0xab, 0x6c, 0x3d, 0xd3, 0xba, 0xaf, 0x1d, 0xfd, 0xaf, 0x9d,
+  0xe7, 0xaf, 0x2a, 0xa9, 0x89, 0x28, 0xdd, 0x49, 0xd5, 0x36, 0x6a, 0x6b,
+  0xa3, 0x05, 0x1b, 0x56, 0xe1, 0xdb, 0x9a, 0xf4, 0xc0, 0x2c, 0x9b, 0xbf,
+  0xd5, 0xb5, 0x2a, 0xf3, 0x47, 0xb6, 0x54, 0x06, 0x30, 0xdd, 0x40, 0xd4,
+  0xc2, 0x0a, 0x7c, 0x6c, 0x97, 0x61, 0xad, 0x6c, 0xd7, 0xce, 0xe6, 0x2a,
+  0x2a, 0x58, 0xed, 0x60, 0x7b, 0x42, 0x32, 0xc9, 0x2a, 0x8d, 0xbb, 0xff,
+  0x50, 0x11, 0xf7, 0xba, 0x01, 0x48, 0x24, 0xc4, 0x1a, 0x0f, 0x9c, 0xcc,
+  0xcc, 0xac, 0xa8, 0xac, 0x84, 0x9b, 0x02, 0x7c, 0xbc, 0x3f, 0x75, 0xd6,
+  0xef, 0xe1, 0xe7, 0x67, 0x5d, 0x8d, 0x92, 0xc3, 0xb5, 0xd6, 0x35, 0x9e,
+  0xaa, 0xa6, 0x35, 0xc3, 0xf0, 0xdc, 0x76, 0x4a, 0xac, 0xa6, 0x02, 0xb3,
+  0x3f, 0x94, 0x3e, 0x5e, 0xf1, 0xf4, 0x0e, 0x09, 0xee, 0x2b, 0x34, 0x51,
+  0x21, 0x8f, 0xcf, 0x5d, 0x7d, 0xad, 0xe9, 0x63, 0xed, 0x3b, 0xdf, 0xd2,
+  0x40, 0x60, 0x0f, 0xe8, 0x03, 0xa4, 0x03, 0xf0, 0x18, 0x97, 0x17, 0x62,
+  0x89, 0x81, 0xcb, 0x79, 0x38, 0x38, 0xd9, 0x38, 0x32, 0xbd, 0xd2, 0x1f,
+  0x47, 0xac, 0x23, 0x4a, 0x2b, 0xd1, 0x78, 0x8c, 0x31, 0xa0, 0xb6, 0x60,
+  0xe6, 0x32, 0x80, 0x59, 0x27, 0x96, 0xf4, 0x49, 0x61, 0x4e, 0xfb, 0x92,
+  0xc2, 0xad, 0x80, 0xc7, 0x17, 0xdd, 0x68, 0x3e, 0x5b, 0xb7, 0xb6, 0xe2,
+  0x7f, 0x1a, 0xa9, 0xac, 0x64, 0x22, 0x25, 0x70, 0xe2, 0x80, 0x5d, 0xd4,
+  0x8a, 0x97, 0xa7, 0x35, 0xc4, 0xb0, 0xd4, 0xaa, 0x0b, 0xe6, 0x23, 0xf3,
+  0x79, 0x0e, 0x55, 0x9b, 0x7c, 0xcb, 0x76, 0x81, 0x21, 0xfc, 0x39, 0xba,
+  0x3f, 0x78, 0x60, 0xcb, 0xf5, 0x37, 0xa6, 0x8b, 0x14, 0xd6, 0x0f, 0xb5,
+  0xe9, 0xb2, 0xb2, 0x35, 0xa3, 0x0e, 0x5a, 0x4e, 0x4d, 0xb3, 0x2d, 0x66,
+  0x39, 0x33, 0x9b, 0x2a, 0xdc, 0xd2, 0x23, 0x24, 0x32, 0x6f, 0x61, 0x69,
+  0xa6, 0xd1, 0x46, 0xda, 0xc9, 0x1f, 0x32, 0x4f, 0xd9, 0x44, 0x18, 0x89,
+  0x9b, 0x43, 0x65, 0xf9, 0x94, 0x3e, 0x53, 0x05, 0x52, 0x52, 0x0e, 0x2d,
+  0x2c, 0x68, 0x03, 0x36, 0x1f, 0x73, 0x98, 0xeb, 0xfe, 0x65, 0xf9, 0x9c,
+  0xaa, 0xed, 0xe8, 0x0f, 0x70, 0x0d, 0xe5, 0xfd, 0x5c, 0xd3, 0x42, 0x4e,
+  0xec, 0xe5, 0xaf, 0x03, 0xef, 0x1d, 0x40, 0x58, 0x48, 0xa2, 0x95, 0xac,
+  0x79, 0x89, 0xce, 0xcd, 0x34, 0x53, 0x34, 0x17, 0x2d, 0x57, 0x5b, 0x21,
+  0xea, 0x7f, 0x6f, 0x95, 0xca, 0x56, 0xe3, 0x5d, 0xac, 0xcd, 0xa9, 0x61,
+  0xc5, 0x40, 0x9d, 0x36, 0x12, 0xe6, 0x97, 0xf6, 0x5b, 0xbb, 0x5f, 0xd9,
+  0x7a, 0xd4, 0xab, 0xf2, 0x2e, 0xf3, 0x2e, 0x9e, 0x06, 0xec, 0x6f, 0xd4,
+  0xcb, 0x7a, 0xb3, 0x62, 0x94, 0x3c, 0xf6, 0x92, 0xfb, 0xe4, 0x75, 0x9b,
+  0x20, 0x9d, 0x66, 0x2a, 0x8f, 0x54, 0x1d, 0x0a, 0x8d, 0xf4, 0xec, 0x9a,
+  0x09, 0x87, 0x89, 0xf4, 0xc4, 0x71, 0xf1, 0x3d, 0x2f, 0x7f, 0x34, 0x63,
+  0x72, 0x22, 0xc7, 0x89, 0xbe, 0x2b, 0x5a, 0x56, 0xeb, 0x50, 0x1d, 0x12,
+  0xbf, 0xe8, 0xc3, 0x47, 0xb6, 0xa0, 0xb1, 0x41, 0x5e, 0x43, 0x3b, 0x03,
+  0x48, 0xd6, 0xce, 0x29, 0xa0, 0x91, 0xdf, 0x92, 0x0c, 0x1f, 0x6d, 0xa3,
+  0xa8, 0x82, 0x26, 0x5a, 0x42, 0xb9, 0x8b, 0x9c, 0xd7, 0x55, 0xfe, 0xb4,
+  0xa7, 0x36, 0x16, 0x7a, 0xf5, 0x66, 0xde, 0x7f, 0x03, 0xa2, 0xa5, 0x2b,
+  0x3e, 0xd5, 0x55, 0xc4, 0x93, 0x05, 0xae, 0x51, 0x37, 0x1d, 0x1a, 0x38,
+  0x64, 0x90, 0x68, 0xf6, 0x14, 0x45, 0x8e, 0x8c, 0xb0, 0xf2, 0x06, 0xf0,
+  0xc2, 0x24, 0x70, 0xae, 0xd7, 0xe6, 0x15, 0x79, 0x64, 0xe8, 0x34, 0xc7,
+  0x5f, 0x05, 0x35, 0x41, 0xdc, 0x47, 0x10, 0x76, 0xa1, 0x78, 0xef, 0x93,
+  0x9a, 0xdd, 0x39, 0xde, 0x8f, 0xce, 0xe2, 0xc4, 0x6d, 0x0f, 0x95, 0xb1,
+  0x32, 0x95, 0xfa, 0xc5, 0xac, 0x53, 0x21, 0x61, 0x51, 0x64, 0x3c, 0xf1,
+  0xa2, 0x7e, 0x62, 0xca, 0xe0, 0x10, 0x3e, 0x68, 0x15, 0xb3, 0xbb, 0xed,
+  0x18, 0xa6, 0x1a, 0x81, 0xc9, 0x59, 0x80, 0x9f, 0x37, 0x19, 0x09, 0x84,
+  0xb0, 0x12, 0x37, 0xa0, 0xc0, 0x89, 0x9b, 0x33, 0x2f, 0xaa, 0x7e, 0xa7,
+  0xaa, 0x0b, 0x48, 0xda, 0xab, 0x99, 0xf1, 0x0b, 0xd3, 0xa8, 0xfc, 0xb4,
+  0x5a, 0x70, 0x8f, 0x9a, 0x66, 0x88, 0x33, 0x34, 0xf6, 0x76, 0x9a, 0x5c,
+  0x78, 0xcc, 0xd2, 0x41, 0xe5, 0x0e, 0xce, 0xe7, 0x7b, 0x7e, 0x5f, 0x48,
+  0xfe, 0xaa, 0x3a, 0x85, 0xc3, 0x2d, 0xd8, 0xd9, 0x05, 0x21, 0xdd, 0x5f,
+  0xbd, 0x79, 0x0f, 0x95, 0x3a, 0xa9, 0xce, 0xd1, 0xeb, 0x9e, 0x1c, 0xcb,
+  0xb3, 0xef, 0xe2, 0x0b, 0x42, 0xb5, 0xf4, 0xc0, 0x10, 0x38, 0x38, 0x94,
+  0x0e, 0x91, 0x3b, 0x76, 0x43, 0x95, 0xa8, 0xaf, 0x25, 0x78, 0x29, 0x89,
+  0x2a, 0x02, 0x5f, 0x01, 0xff, 0x3b, 0x45, 0x1c, 0x42, 0xd9, 0xcf, 0x4f,
+  0x08, 0xa5, 0xd0, 0x5a, 0x7f, 0x6a, 0x89, 0x39, 0x54, 0xc7, 0x69, 0x2f,
+  0xed, 0xed, 0xd9, 0x38, 0x8c, 0xfe, 0x1f, 0xca, 0xe6, 0x6b, 0xf7, 0xbb,
+  0x9e, 0xaa, 0x10, 0x31, 0xfa, 0x4a, 0xc4, 0x4b, 0x63, 0x2d, 0xf8, 0xad,
+  0xa3, 0x0a, 0xd0, 0x57, 0x03, 0x17, 0xa8, 0xbd, 0x93, 0xf0, 0x87, 0x3d,
+  0xd7, 0x95, 0x69, 0x84, 0x44, 0x20, 0x80, 0x30, 0xac, 0x26, 0x74, 0x56,
+  0x18, 0xd0, 0xba, 0xf3, 0x73, 0x10, 0xb0, 0xb2, 0x7c, 0x63, 0x4b, 0x5b,
+  0x1d, 0x83, 0x1f, 0x01, 0x92, 0xa0, 0x90, 0x65, 0x47, 0x06, 0x32, 0x1e,
+  0x22, 0xd5, 0xe5, 0x73, 0x51, 0xf3, 0x58, 0x70, 0x57, 0x84, 0xe6, 0x3f,
+  0xe4, 0x05, 0xb4, 0x86, 0xf0, 0xd2, 0x62, 0xda, 0x03, 0x91, 0x6e, 0x53,
+  0x8b, 0x4b, 0x44, 0x40, 0x03, 0xd1, 0x64, 0x04, 0x8c, 0x99, 0x8b, 0xff,
+  0xa3, 0x25, 0xf7, 0xaa, 0x09, 0x21, 0x58, 0x69, 0x61, 0x62, 0xb4, 0x66,
+  0xd0, 0xe9, 0x5d, 0xfd, 0xa7, 0xc7, 0x8b, 0x60, 0x81, 0xd2, 0x9e, 0x54,
+  0xcd, 0x25, 0x92, 0xde, 0x06, 0x81, 0x36, 0x72, 0xff, 0xd2, 0x10, 0x39,
+  0x70, 0xbb, 0xd5, 0xd6, 0xb2, 0xb0, 0x01, 0xd4, 0xaf, 0xbf, 0x65, 0x6a,
+  0x24, 0xf3, 0x4b, 0x1a, 0x01, 0x95, 0x0a, 0x5c, 0xd1, 0x2a, 0xbf, 0x2d,
+  0x3d, 0xcb, 0x41, 0xb4, 0x2a, 0xbb, 0xae, 0xbd, 0x5a, 0x1d, 0xae, 0xf6,
+  0xc3, 0x82, 0xc9, 0xe5, 0x7e, 0xac, 0xc0, 0x66, 0x54, 0xfa, 0x64, 0x4f,
+  0x63, 0xf3, 0x46, 0xd9, 0x7a, 0x0c, 0xe9, 0x37, 0x25, 0xe5, 0xce, 0xad,
+  0x77, 0x13, 0x8e, 0xfa, 0x9a, 0x80, 0x7d, 0x86, 0x24, 0x2f, 0x4a, 0x0c,
+  0x49, 0x9d, 0x78, 0x3a, 0xbd, 0xd9, 0x37, 0xc9, 0x2f, 0x07, 0x72, 0xaa,
+  0x80, 0x38, 0xfc, 0xe3, 0x82, 0xd4, 0xee, 0x8a, 0x4e, 0xea, 0x1f, 0x15,
+  0x01, 0x41, 0x0c, 0x28, 0x14, 0xb3, 0xe2, 0x9f, 0x46, 0xea, 0x8e, 0x28,
+  0x22, 0x4c, 0xb7, 0xf4, 0xd1, 0xad, 0x44, 0xbb, 0xed, 0xe6, 0x63, 0x27,
+  0x57, 0xb6, 0x57, 0x42, 0x25, 0x0a, 0x21, 0xb0, 0x9e, 0xfe, 0xe4, 0x2d,
+  0x4a, 0x39, 0x91, 0x74, 0xef, 0x76, 0x2f, 0x31, 0x93, 0x06, 0xcd, 0x1f,
+  0xc8, 0xbd, 0x1d, 0x33, 0x04, 0xf8, 0xb0, 0xc2, 0x97, 0x1d, 0x4d, 0xb4,
+  0x10, 0xcd, 0x3a, 0x02, 0x8f, 0x6e, 0xe8, 0xe6, 0x4c, 0xa9, 0x5b, 0x85,
+  0xc5, 0x5b, 0xce, 0x13, 0x51, 0x98, 0xc6, 0x31, 0x70, 0x54, 0xe0, 0x5a,
+  0x73, 0x12, 0x5d, 0xeb, 0xf3, 0x70, 0x61, 0xa1, 0xe2, 0x0a, 0x98, 0x17,
+  0x30, 0xfe, 0xb5, 0x1c, 0x9b, 0x61, 0xe3, 0x8a, 0x0d, 0x8f, 0x5b, 0x3e,
+  0x74, 0x3f, 0xe4, 0x39, 0xa0, 0xdc, 0x81, 0xe7, 0x38, 0xdc, 0x31, 0xab,
+  0x4a, 0xc0, 0xc5, 0xed, 0x70, 0x8d, 0xb6, 0x77, 0x6b, 0xe3, 0x20, 0x46,
+  0x9a, 0x54, 0x6b, 0x41, 0x83, 0x36, 0xf8, 0xdb, 0x7c, 0xc7, 0x17, 0xc1,
+  0x81, 0xb8, 0xcf, 0xf8, 0x13, 0xd1, 0x89, 0xc4, 0xca, 0xb4, 0x12, 0xad,
+  0xe5, 0x5b, 0xf0, 0x6d, 0x7f, 0x92, 0xaf, 0xc2, 0x38, 0xfe, 0x0f, 0xb9,
+  0x26, 0xfe, 0x23, 0x94, 0x6e, 0x9d, 0x62, 0x55, 0xae, 0x51, 0x13, 0x39,
+  0x0c, 0x65, 0x60, 0x56, 0xc8, 0x60, 0x80, 0x96, 0xcd, 0xc0, 0x34, 0x8b,
+  0xf3, 0xd7, 0xe9, 0xfa, 0x63, 0x61, 0x56, 0x00, 0x0f, 0xc8, 0x9c, 0x8c,
+  0x01, 0x0c, 0x0e, 0x7f, 0x1f, 0xcf, 0x7d, 0x53, 0xbd, 0x38, 0x72, 0xc6,
+  0x28, 0xb5, 0xba, 0x9a, 0x4c, 0xa9, 0x15, 0x3c, 0x46, 0xd8, 0x46, 0x39,
+  0x54, 0xd7, 0x1c, 0x2c, 0x6a, 0x8d, 0xfc, 0xc4, 0xcd, 0x63, 0x17, 0x07,
+  0x72, 0x24, 0x49, 0x78, 0xfe, 0xee, 0x6e, 0x0e, 0x78, 0xff, 0x34, 0x2b,
+  0xaa, 0x95, 0xcb, 0x3f, 0xa5, 0x25, 0x45, 0xa4, 0x93, 0xef, 0x91, 0x62,
+  0x01, 0x33, 0xad, 0xf7, 0xbb, 0xb8, 0x4f, 0xbb, 0xdc, 0xeb, 0x80, 0xc2,
+  0xdd, 0x1f, 0x09, 0x57, 0x3a, 0x5b, 0xd1, 0xae, 0x30, 0x05, 0x31, 0x2b,
+  0x42, 0x8d, 0x9b, 0x99, 0xb7, 0xfb, 0x37, 0x34, 0x0e, 0xd9, 0x05, 0x7f,
+  0xe1, 0xd1, 0x38, 0x57, 0xe3, 0x5c, 0xdf, 0x11, 0x6e, 0xdf, 0xb9, 0x01,
+  0x61, 0xbd, 0xf2, 0x20, 0xf3, 0x8d, 0x73, 0x97, 0x66, 0x54, 0x18, 0x74,
+  0x5b, 0x0b, 0x74, 0x5b, 0xf3, 0xe4, 0x24, 0x50, 0x60, 0x3c, 0x92, 0x56,
+  0x31, 0xdb, 0xf7, 0xd3, 0xb0, 0xa4, 0xa1, 0x43, 0x59, 0x79, 0xec, 0xce,
+  0x40, 0x38, 0x17, 0x12, 0x82, 0x57, 0x54, 0x7f, 0x92, 0x36, 0xfb, 0xbe,
+  0x0d, 0x6d, 0x4d, 0x2f, 0xbd, 0xa9, 0x34, 0x32, 0x3e, 0x20, 0xba, 0x76,
+  0xd3, 0xef, 0xae, 0x85, 0x63, 0xff, 0xcc, 0x55, 0x47, 0x50, 0x6e, 0x59,
+  0x4c, 0xe0, 0xd0, 0xe6, 0xbc, 0xe9, 0xf8, 0x7a, 0x66, 0xb9, 0x96, 0x91,
+  0x0c, 0xfb, 0xc7, 0xc0, 0x74, 0x97, 0xbe, 0x9e, 0x4e, 0xe2, 0x39, 0x16,
+  0x2f, 0x31, 0xf2, 0xcc, 0xd9, 0xe7, 0xd8, 0xd2, 0x7e, 0x56, 0x29, 0x74,
+  0xa0, 0x77, 0xf0, 0x61, 0x15, 0x98, 0x89, 0x44, 0x7e, 0x68, 0x0b, 0x97,
+  0x26, 0xb3, 0xe0, 0x98, 0x50, 0x2d, 0x70, 0x2a, 0xce, 0xad, 0x89, 0xbb,
+  0xeb, 0x70, 0x4d, 0xd1, 0x7a, 0xde, 0x8e, 0x8c, 0x9d, 0x6c, 0xac, 0x7d,
+  0x1e, 0xe9, 0xfd, 0xd2, 0xdd, 0xa1, 0x8c, 0x4d, 0xa7, 0xc7, 0x4c, 0x2b,
+  0x3c, 0xda, 0xab, 0x93, 0x11, 0x4f, 0xde, 0xf7, 0xb5, 0x91, 0xc2, 0x22,
+  0xc8, 0x3f, 0x70, 0x1f, 0x3b, 0xc2, 0xb1, 0x49, 0x8b, 0x91, 0x41, 0xeb,
+  0x30, 0xab, 0xe3, 0xde, 0xea, 0xc9, 0xd6, 0x79, 0x7e, 0xa7, 0x16, 0x9d,
+  0x42, 0x18, 0xda, 0x2a, 0x4b, 0x55, 0xe8, 0x52, 0xe9, 0xc9, 0x35, 0xb1,
+  0x49, 0xf9, 0xf2, 0xb1, 0xfc, 0x21, 0xe2, 0x43, 0x5e, 0xa4, 0x48, 0x1a,
+  0xb5, 0xcf, 0x41, 0x2d, 0x90, 0xf5, 0x55, 0x40, 0x8c, 0x7d, 0x39, 0x98,
+  0x61, 0x43, 0x97, 0x19, 0xa4, 0xa1, 0x3d, 0x30, 0x0a, 0xa3, 0x9c, 0x8e,
+  0xff, 0x38, 0x9c, 0xf5, 0x1c, 0x62, 0xfc, 0x41, 0x6c, 0x2f, 0x6f, 0x43,
+  0xb3, 0xf8, 0x3d, 0x6a, 0xfd, 0x92, 0xc3, 0xe2, 0x37, 0x01, 0x4f, 0xdf,
+  0x4e, 0x0b, 0xbb, 0xc7, 0xe6, 0xf9, 0xb2, 0xd4, 0xf9, 0x56, 0x35, 0xe2,
+  0x94, 0x8e, 0x72, 0x5a, 0x32, 0xa8, 0xc7, 0x01, 0xbf, 0x28, 0x86, 0x12,
+  0x75, 0xcb, 0x31, 0x87, 0xbc, 0x9f, 0xc0, 0x48, 0x7e, 0xcc, 0xac, 0x53,
+  0x00, 0xa0, 0x52, 0xaa, 0xf0, 0x17, 0x95, 0x00, 0x23, 0x6f, 0xa4, 0x03,
+  0x4e, 0xa8, 0x0f, 0x66, 0xc3, 0x30, 0x43, 0x5d, 0xc8, 0x3b, 0xba, 0x71,
+  0xc8, 0x5d, 0xec, 0x55, 0x66, 0x54, 0x08, 0xe9, 0xb5, 0xe9, 0xf3, 0xc7,
+  0xca, 0x56, 0xe9, 0x8a, 0x4a, 0x48, 0x6a, 0x19, 0x71, 0x29, 0xbf, 0x54,
+  0x98, 0xe5, 0xec, 0x25, 0xbe, 0x74, 0xe6, 0x98, 0x46, 0xbc, 0xdc, 0x68,
+  0x08, 0xd7, 0xdf, 0xdd, 0x7a, 0x15, 0xaf, 0x69, 0xec, 0xb8, 0xb3, 0x8a,
+  0xae, 0xb7, 0x91, 0xa1, 0x1e, 0x39, 0x64, 0xb7, 0x72, 0x7f, 0x1b, 0x8b,
+  0x45, 0xec, 0xcc, 0xa8, 0x66, 0x6c, 0x0c, 0x38, 0xf0, 0xfd, 0x40, 0x9d,
+  0x48, 0x43, 0x49, 0x60, 0x1f, 0xe7, 0x9d, 0xeb, 0x31, 0x9f, 0x3d, 0xb2,
+  0x5e, 0xfd, 0x23, 0x7d, 0x4a, 0xd0, 0x35, 0x23, 0xbf, 0x5c, 0xb1, 0x2f,
+  0xb1, 0x55, 0x5b, 0xe0, 0x62, 0xc0, 0xfe, 0x9e, 0xf4, 0x9e, 0x57, 0xfa,
+  0xa3, 0xc9, 0x0b, 0x64, 0xcb, 0x28, 0x21, 0x6a, 0xa9, 0xb0, 0x74, 0x6b,
+  0xce, 0xe2, 0x8d, 0xd1, 0x9f, 0x5f, 0xcf, 0x52, 0x2e, 0x1a, 0x00, 0xee,
+  0x2e, 0x6c, 0x05, 0x0d, 0x9e, 0x57, 0x02, 0x73, 0x0c, 0xd5, 0x94, 0x59,
+  0x11, 0x42, 0x3a, 0x99, 0xaa, 0xa3, 0x4d, 0x6b, 0x12, 0x3c, 0xa1, 0xa2,
+  0xd7, 0xcd, 0xeb, 0xba, 0xcd, 0x61, 0x01, 0xd3, 0xa6, 0x95, 0x3e, 0x8b,
+  0x4b, 0x4b, 0xb3, 0x8c, 0xea, 0x86, 0xce, 0x51, 0x7e, 0x6f, 0xc4, 0x8b,
+  0x84, 0xea, 0x50, 0xc8, 0x90, 0xd3, 0x11, 0xfb, 0x7d, 0x9d, 0x23, 0x31,
+  0x57, 0xdf, 0x70, 0x7c, 0xdb, 0xd4, 0x12, 0xd8, 0x02, 0xde, 0x4d, 0xe2,
+  0xe6, 0x1b, 0xd1, 0x93, 0xd7, 0x04, 0xab, 0xf1, 0x39, 0xda, 0xb0, 0x8c,
+  0xb8, 0x02, 0x23, 0x93, 0xd2, 0x49, 0x00, 0x3c, 0x8a, 0x36, 0xc1, 0x6a,
+  0xc5, 0xeb, 0x37, 0xb1, 0xb3, 0xbe, 0xb9, 0x2a, 0xd1, 0x6b, 0xa0, 0xce,
+  0x7a, 0xe7, 0x3e, 0x38, 0xf7, 0x40, 0x12, 0x47, 0xb3, 0xe3, 0xfd, 0x6b,
+  0xa6, 0x34, 0xef, 0x22, 0xc9, 0x24, 0x6e, 0xb9, 0x90, 0xec, 0xc2, 0x00,
+  0x00, 0x00, 0x40, 0x00, 0x7e, 0x00, 0xbd, 0x00, 0xd6, 0x00, 0x00, 0x00,
+  0x3c, 0x00, 0x7a, 0x00, 0xb4, 0x00, 0xf0, 0x00, 0x2b, 0x01, 0x68, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x23, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x19, 0x00, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x15, 0x00, 0x1b, 0x00,
+  0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x16, 0x00, 0x1f, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x1b, 0x00,
+  0x28, 0x00, 0x39, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x11, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x21, 0x00, 0x32, 0x00, 0x43, 0x00,
+  0x00, 0x00, 0x2f, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x31, 0x00, 0x43, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x07, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x19, 0x00, 0x25, 0x00, 0x30, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x23, 0x00, 0x31, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x00, 0x00, 0x08, 0x00, 0x11, 0x00, 0x00, 0x00, 0x2c, 0x00,
+  0x37, 0x00, 0x44, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x10, 0x00, 0x21, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x19, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x00, 0x00, 0x1f, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x23, 0x00, 0x00, 0x00, 0x09, 0x00, 0x21, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x12, 0x00, 0x21, 0x00, 0x00, 0x00,
+  0x1e, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x1c, 0x00, 0x2e, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x15, 0x00, 0x23, 0x00, 0x30, 0x00, 0x00, 0x00, 0x06, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x1a, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x19, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1c, 0x00, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00,
+  0x00, 0x00, 0x0a, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x3a, 0x00,
+  0x60, 0x00, 0x7f, 0x00, 0x99, 0x00, 0xb7, 0x00, 0xd2, 0x00, 0xf2, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x38, 0x00, 0x5d, 0x00, 0x7b, 0x00,
+  0x94, 0x00, 0xad, 0x00, 0xd3, 0x00, 0xdd, 0x00, 0xeb, 0x00, 0xfa, 0x00,
+  0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x36, 0x00, 0x55, 0x00, 0x79, 0x00, 0x99, 0x00, 0xae, 0x00,
+  0xcc, 0x00, 0xd5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x34, 0x00,
+  0x52, 0x00, 0x75, 0x00, 0x94, 0x00, 0xa9, 0x00, 0x00, 0x00, 0x22, 0x00,
+  0x33, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x11, 0x00,
+  0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x18, 0x00,
+  0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x35, 0x00, 0x4c, 0x00,
+  0x64, 0x00, 0x84, 0x00, 0xa0, 0x00, 0xb9, 0x00, 0xd4, 0x00, 0xe0, 0x00,
+  0x00, 0x00, 0x1c, 0x00, 0x37, 0x00, 0x4a, 0x00, 0x55, 0x00, 0x00, 0x00,
+  0x1b, 0x00, 0x33, 0x00, 0x49, 0x00, 0x60, 0x00, 0x7f, 0x00, 0x9a, 0x00,
+  0xb2, 0x00, 0xce, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x25, 0x00, 0x3e, 0x00,
+  0x00, 0x00, 0x1b, 0x00, 0x2f, 0x00, 0x39, 0x00, 0x00, 0x00, 0x24, 0x00,
+  0x3e, 0x00, 0x57, 0x00, 0x62, 0x00, 0x00, 0x00, 0x21, 0x00, 0x3a, 0x00,
+  0x00, 0x00, 0x27, 0x00, 0x33, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x35, 0x00,
+  0x00, 0x00, 0x1d, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x34, 0x00,
+  0x00, 0x00, 0x16, 0x00, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x00,
+  0x28, 0x00, 0x3b, 0x00, 0x46, 0x00, 0x00, 0x00, 0x16, 0x00, 0x32, 0x00,
+  0x3e, 0x00, 0x55, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x23, 0x00,
+  0x3c, 0x00, 0x59, 0x00, 0x78, 0x00, 0x89, 0x00, 0x9d, 0x00, 0x00, 0x00,
+  0x1d, 0x00, 0x00, 0x00, 0x22, 0x00, 0x3a, 0x00, 0x56, 0x00, 0x7f, 0x00,
+  0x97, 0x00, 0xb3, 0x00, 0x00, 0x00, 0x17, 0x00, 0x30, 0x00, 0x00, 0x00,
+  0x17, 0x00, 0x33, 0x00, 0x55, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x47, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x3c, 0x00,
+  0x53, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x18, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x18, 0x00, 0x30, 0x00,
+  0x51, 0x00, 0x5c, 0x00, 0x70, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x36, 0x00,
+  0x00, 0x00, 0x17, 0x00, 0x34, 0x00, 0x4d, 0x00, 0x54, 0x00, 0x63, 0x00,
+  0x6c, 0x00, 0x7b, 0x00, 0x00, 0x00, 0x24, 0x00, 0x4d, 0x00, 0x00, 0x00,
+  0x1b, 0x00, 0x2e, 0x00, 0x38, 0x00, 0x00, 0x00, 0x18, 0x00, 0x35, 0x00,
+  0x4e, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x18, 0x00, 0x32, 0x00, 0x4c, 0x00, 0x00, 0x00,
+  0x18, 0x00, 0x31, 0x00, 0x4b, 0x00, 0x66, 0x00, 0x75, 0x00, 0x7f, 0x00,
+  0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x3a, 0x00, 0x00, 0x00,
+  0x1a, 0x00, 0x33, 0x00, 0x58, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x35, 0x00,
+  0x50, 0x00, 0x5c, 0x00, 0x6d, 0x00, 0x7f, 0x00, 0x85, 0x00, 0x00, 0x00,
+  0x1d, 0x00, 0x37, 0x00, 0x48, 0x00, 0x52, 0x00, 0x00, 0x00, 0x1b, 0x00,
+  0x36, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x3c, 0x00,
+  0x47, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x17, 0x00, 0x31, 0x00,
+  0x48, 0x00, 0x5f, 0x00, 0x6e, 0x00, 0x7f, 0x00, 0x8e, 0x00, 0x9c, 0x00,
+  0x00, 0x00, 0x22, 0x00, 0x41, 0x00, 0x4b, 0x00, 0x60, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1b, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x3d, 0x00,
+  0x57, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1c, 0x00, 0x32, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x1c, 0x00,
+  0x36, 0x00, 0x4e, 0x00, 0x5e, 0x00, 0x67, 0x00, 0x78, 0x00, 0x81, 0x00,
+  0x8f, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x19, 0x00,
+  0x00, 0x00, 0x1e, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00,
+  0x19, 0x00, 0x2f, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x19, 0x00, 0x00, 0x00, 0x15, 0x00, 0x27, 0x00, 0x38, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x10, 0x00, 0x1f, 0x00, 0x27, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0f, 0x00,
+  0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x20, 0x00,
+  0x29, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x1c, 0x00,
+  0x2b, 0x00, 0x3b, 0x00, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x1f, 0x00,
+  0x32, 0x00, 0x37, 0x00, 0x4a, 0x00, 0x54, 0x00, 0x64, 0x00, 0x77, 0x00,
+  0x89, 0x00, 0xa0, 0x00, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00,
+  0x13, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1c, 0x00, 0x29, 0x00, 0x39, 0x00,
+  0x43, 0x00, 0x51, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00,
+  0x27, 0x00, 0x3d, 0x00, 0x46, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x1a, 0x00,
+  0x26, 0x00, 0x36, 0x00, 0x45, 0x00, 0x4d, 0x00, 0x5a, 0x00, 0x69, 0x00,
+  0x78, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x36, 0x00,
+  0x00, 0x00, 0x1d, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x12, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x23, 0x00, 0x33, 0x00, 0x41, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x1c, 0x00, 0x29, 0x00, 0x00, 0x00,
+  0x16, 0x00, 0x25, 0x00, 0x34, 0x00, 0x41, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1c, 0x00, 0x2a, 0x00,
+  0x3d, 0x00, 0x4b, 0x00, 0x55, 0x00, 0x5e, 0x00, 0x66, 0x00, 0x73, 0x00,
+  0x80, 0x00, 0x8e, 0x00, 0x00, 0x00, 0x22, 0x00, 0x2a, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0a, 0x00, 0x15, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x35, 0x00,
+  0x3f, 0x00, 0x00, 0x00, 0x22, 0x00, 0x32, 0x00, 0x39, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x06, 0x00, 0x10, 0x00,
+  0x00, 0x00, 0x20, 0x00, 0x29, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x25, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x1f, 0x00, 0x2a, 0x00, 0x35, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x14, 0x00, 0x29, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x1d, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x10, 0x00, 0x21, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x1e, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x1a, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00,
+  0x19, 0x00, 0x24, 0x00, 0x34, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x16, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x18, 0x00, 0x29, 0x00, 0x00, 0x00, 0x19, 0x00,
+  0x25, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x0d, 0x00,
+  0x00, 0x00, 0x13, 0x00, 0x21, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00,
+  0x23, 0x00, 0x31, 0x00, 0x3a, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x0f, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x0a, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x0f, 0x00,
+  0x19, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x17, 0x00, 0x24, 0x00, 0x31, 0x00,
+  0x3b, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x1d, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0b, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x2b, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x1e, 0x00, 0x29, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x20, 0x00, 0x31, 0x00, 0x40, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x20, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x2c, 0x00,
+  0x00, 0x00, 0x0a, 0x00, 0x16, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x19, 0x00,
+  0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x35, 0x00, 0x3e, 0x00,
+  0x53, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x21, 0x00, 0x34, 0x00,
+  0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x19, 0x00,
+  0x26, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x15, 0x00, 0x1e, 0x00, 0x2d, 0x00,
+  0x3e, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x1c, 0x00, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x23, 0x00, 0x00, 0x00, 0x14, 0x00,
+  0x20, 0x00, 0x2d, 0x00, 0x39, 0x00, 0x45, 0x00, 0x00, 0x00, 0x15, 0x00,
+  0x00, 0x00, 0x11, 0x00, 0x1a, 0x00, 0x23, 0x00, 0x00, 0x00, 0x0d, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x1b, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x20, 0x00,
+  0x00, 0x00, 0x14, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x20, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x18, 0x00,
+  0x2e, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x10, 0x00, 0x2b, 0x00,
+  0x37, 0x00, 0x43, 0x00, 0x53, 0x00, 0x5b, 0x00, 0x69, 0x00, 0x78, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x25, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x23, 0x00,
+  0x2d, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x23, 0x00, 0x32, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x2d, 0x00, 0x3c, 0x00, 0x46, 0x00, 0x53, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x13, 0x00, 0x2a, 0x00, 0x32, 0x00, 0x3c, 0x00, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00,
+  0x1b, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x30, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x2c, 0x00,
+  0x41, 0x00, 0x4e, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x15, 0x00, 0x2f, 0x00,
+  0x4b, 0x00, 0x56, 0x00, 0x00, 0x00, 0x13, 0x00, 0x21, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x20, 0x00, 0x30, 0x00, 0x41, 0x00, 0x54, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x11, 0x00, 0x27, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x16, 0x00,
+  0x28, 0x00, 0x37, 0x00, 0x00, 0x00, 0x16, 0x00, 0x27, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x26, 0x00, 0x37, 0x00, 0x4d, 0x00, 0x52, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x1d, 0x00, 0x34, 0x00,
+  0x00, 0x00, 0x18, 0x00, 0x24, 0x00, 0x2b, 0x00, 0x37, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x19, 0x00, 0x28, 0x00, 0x4c, 0x00, 0x5a, 0x00, 0x6a, 0x00,
+  0x7b, 0x00, 0x89, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0f, 0x00, 0x1e, 0x00, 0x2d, 0x00, 0x35, 0x00, 0x44, 0x00,
+  0x52, 0x00, 0x60, 0x00, 0x6f, 0x00, 0x7d, 0x00, 0x00, 0x00, 0x0f, 0x00,
+  0x1b, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x15, 0x00,
+  0x28, 0x00, 0x36, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x1a, 0x00, 0x27, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x00, 0x00, 0x13, 0x00, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x1c, 0x00, 0x29, 0x00, 0x00, 0x00, 0x14, 0x00,
+  0x27, 0x00, 0x41, 0x00, 0x4a, 0x00, 0x54, 0x00, 0x00, 0x00, 0x0f, 0x00,
+  0x00, 0x00, 0x14, 0x00, 0x1d, 0x00, 0x2d, 0x00, 0x39, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x23, 0x00, 0x3a, 0x00, 0x4a, 0x00, 0x51, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x2a, 0x00, 0x3a, 0x00, 0x4d, 0x00, 0x5c, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x2a, 0x00, 0x3b, 0x00, 0x4f, 0x00, 0x60, 0x00, 0x6b, 0x00,
+  0x75, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x29, 0x00, 0x33, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00,
+  0x25, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00,
+  0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x28, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x20, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x15, 0x00, 0x1f, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x1d, 0x00, 0x26, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x1a, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0a, 0x00, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00,
+  0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1d, 0x00, 0x24, 0x00,
+  0x2b, 0x00, 0x3d, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x15, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x1a, 0x00, 0x24, 0x00, 0x2d, 0x00, 0x36, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00,
+  0x00, 0x00, 0x11, 0x00, 0x22, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x1b, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x13, 0x00, 0x1e, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x15, 0x00, 0x1e, 0x00,
+  0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x1b, 0x00,
+  0x2f, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x1c, 0x00,
+  0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x12, 0x00, 0x20, 0x00, 0x2a, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x12, 0x00, 0x1a, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x1f, 0x00,
+  0x2e, 0x00, 0x36, 0x00, 0x40, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x2c, 0x00,
+  0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x2d, 0x00,
+  0x3d, 0x00, 0x4a, 0x00, 0x58, 0x00, 0x67, 0x00, 0x72, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0x27, 0x00, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x00, 0x49, 0x00,
+  0x5c, 0x00, 0x6e, 0x00, 0x7c, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x21, 0x00,
+  0x34, 0x00, 0x46, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x2d, 0x00,
+  0x47, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x10, 0x00, 0x1f, 0x00,
+  0x34, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x19, 0x00,
+  0x2b, 0x00, 0x43, 0x00, 0x53, 0x00, 0x00, 0x00, 0x13, 0x00, 0x28, 0x00,
+  0x00, 0x00, 0x0f, 0x00, 0x2b, 0x00, 0x3b, 0x00, 0x4b, 0x00, 0x5a, 0x00,
+  0x69, 0x00, 0x00, 0x00, 0x10, 0x00, 0x22, 0x00, 0x36, 0x00, 0x40, 0x00,
+  0x4b, 0x00, 0x00, 0x00, 0x16, 0x00, 0x38, 0x00, 0x41, 0x00, 0x49, 0x00,
+  0x00, 0x00, 0x25, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x17, 0x00, 0x20, 0x00,
+  0x31, 0x00, 0x41, 0x00, 0x52, 0x00, 0x00, 0x00, 0x15, 0x00, 0x1f, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x28, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x0f, 0x00,
+  0x25, 0x00, 0x39, 0x00, 0x54, 0x00, 0x73, 0x00, 0x7d, 0x00, 0x83, 0x00,
+  0x00, 0x00, 0x15, 0x00, 0x2b, 0x00, 0x3c, 0x00, 0x56, 0x00, 0x72, 0x00,
+  0x00, 0x00, 0x1b, 0x00, 0x27, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00,
+  0x30, 0x00, 0x3e, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x13, 0x00, 0x24, 0x00,
+  0x31, 0x00, 0x4a, 0x00, 0x69, 0x00, 0x7c, 0x00, 0x8e, 0x00, 0x97, 0x00,
+  0xa6, 0x00, 0xb0, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1f, 0x00, 0x37, 0x00,
+  0x51, 0x00, 0x6d, 0x00, 0x00, 0x00, 0x13, 0x00, 0x23, 0x00, 0x37, 0x00,
+  0x50, 0x00, 0x6c, 0x00, 0x81, 0x00, 0x8f, 0x00, 0x9f, 0x00, 0xad, 0x00,
+  0xb9, 0x00, 0x00, 0x00, 0x12, 0x00, 0x23, 0x00, 0x34, 0x00, 0x43, 0x00,
+  0x62, 0x00, 0x00, 0x00, 0x16, 0x00, 0x25, 0x00, 0x34, 0x00, 0x44, 0x00,
+  0x4f, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x11, 0x00, 0x1f, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x10, 0x00, 0x1e, 0x00, 0x36, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x24, 0x00, 0x00, 0x00, 0x15, 0x00, 0x2c, 0x00,
+  0x50, 0x00, 0x6e, 0x00, 0x80, 0x00, 0x92, 0x00, 0x00, 0x00, 0x18, 0x00,
+  0x29, 0x00, 0x38, 0x00, 0x42, 0x00, 0x00, 0x00, 0x14, 0x00, 0x21, 0x00,
+  0x42, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x19, 0x00, 0x2e, 0x00, 0x41, 0x00,
+  0x4f, 0x00, 0x00, 0x00, 0x15, 0x00, 0x28, 0x00, 0x3f, 0x00, 0x5a, 0x00,
+  0x70, 0x00, 0x79, 0x00, 0x00, 0x00, 0x26, 0x00, 0x31, 0x00, 0x3e, 0x00,
+  0x51, 0x00, 0x5f, 0x00, 0x78, 0x00, 0x8d, 0x00, 0x00, 0x00, 0x25, 0x00,
+  0x31, 0x00, 0x3d, 0x00, 0x55, 0x00, 0x64, 0x00, 0x76, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x21, 0x00, 0x37, 0x00, 0x50, 0x00, 0x5b, 0x00, 0x7b, 0x00,
+  0x86, 0x00, 0x00, 0x00, 0x11, 0x00, 0x1d, 0x00, 0x2c, 0x00, 0x43, 0x00,
+  0x55, 0x00, 0x6b, 0x00, 0x00, 0x00, 0x14, 0x00, 0x20, 0x00, 0x2f, 0x00,
+  0x3d, 0x00, 0x59, 0x00, 0x6d, 0x00, 0x7b, 0x00, 0x8b, 0x00, 0x99, 0x00,
+  0xa8, 0x00, 0xb8, 0x00, 0x00, 0x00, 0x12, 0x00, 0x1e, 0x00, 0x33, 0x00,
+  0x45, 0x00, 0x61, 0x00, 0x73, 0x00, 0x7c, 0x00, 0x86, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x28, 0x00, 0x3b, 0x00, 0x47, 0x00, 0x5c, 0x00, 0x7e, 0x00,
+  0x89, 0x00, 0x94, 0x00, 0xa5, 0x00, 0xb0, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x1f, 0x00, 0x33, 0x00, 0x41, 0x00, 0x65, 0x00, 0x81, 0x00, 0x88, 0x00,
+  0x00, 0x00, 0x0b, 0x00, 0x1a, 0x00, 0x28, 0x00, 0x3f, 0x00, 0x5a, 0x00,
+  0x7f, 0x00, 0x90, 0x00, 0x9b, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x19, 0x00,
+  0x31, 0x00, 0x3e, 0x00, 0x4f, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x23, 0x00,
+  0x3e, 0x00, 0x53, 0x00, 0x67, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x51, 0x00,
+  0x64, 0x00, 0x76, 0x00, 0x89, 0x00, 0x9f, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x25, 0x00, 0x3b, 0x00, 0x54, 0x00, 0x78, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x1b, 0x00, 0x32, 0x00, 0x4f, 0x00, 0x68, 0x00, 0x6e, 0x00, 0x78, 0x00,
+  0x82, 0x00, 0x97, 0x00, 0xac, 0x00, 0x00, 0x00, 0x14, 0x00, 0x28, 0x00,
+  0x3a, 0x00, 0x45, 0x00, 0x5a, 0x00, 0x6d, 0x00, 0x7e, 0x00, 0x95, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x21, 0x00, 0x30, 0x00, 0x3c, 0x00, 0x49, 0x00,
+  0x58, 0x00, 0x74, 0x00, 0x8f, 0x00, 0xa7, 0x00, 0x00, 0x00, 0x1a, 0x00,
+  0x37, 0x00, 0x5d, 0x00, 0x77, 0x00, 0x97, 0x00, 0xb0, 0x00, 0xcd, 0x00,
+  0xe5, 0x00, 0xf4, 0x00, 0x02, 0x01, 0x11, 0x01, 0x1e, 0x01, 0x34, 0x01,
+  0x4c, 0x01, 0x00, 0x00, 0x18, 0x00, 0x3c, 0x00, 0x4a, 0x00, 0x57, 0x00,
+  0x6b, 0x00, 0x7d, 0x00, 0x95, 0x00, 0xa5, 0x00, 0xb8, 0x00, 0xc9, 0x00,
+  0xdc, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x39, 0x00, 0x60, 0x00, 0x7b, 0x00,
+  0x9c, 0x00, 0xb6, 0x00, 0xd4, 0x00, 0xe6, 0x00, 0xfc, 0x00, 0x0c, 0x01,
+  0x18, 0x01, 0x32, 0x01, 0x42, 0x01, 0x66, 0x01, 0x79, 0x01, 0x87, 0x01,
+  0x91, 0x01, 0x00, 0x00, 0x26, 0x00, 0x35, 0x00, 0x44, 0x00, 0x59, 0x00,
+  0x69, 0x00, 0x80, 0x00, 0x8f, 0x00, 0xa4, 0x00, 0xb0, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x24, 0x00, 0x33, 0x00, 0x42, 0x00, 0x59, 0x00, 0x6a, 0x00,
+  0x7c, 0x00, 0x8c, 0x00, 0x00, 0x00, 0x27, 0x00, 0x3f, 0x00, 0x4e, 0x00,
+  0x59, 0x00, 0x65, 0x00, 0x74, 0x00, 0x8a, 0x00, 0xa6, 0x00, 0x00, 0x00,
+  0x16, 0x00, 0x27, 0x00, 0x37, 0x00, 0x4b, 0x00, 0x5c, 0x00, 0x6b, 0x00,
+  0x7a, 0x00, 0x00, 0x00, 0x17, 0x00, 0x23, 0x00, 0x31, 0x00, 0x4b, 0x00,
+  0x61, 0x00, 0x7c, 0x00, 0x87, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x1c, 0x00,
+  0x27, 0x00, 0x33, 0x00, 0x43, 0x00, 0x59, 0x00, 0x70, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x1f, 0x00, 0x2c, 0x00, 0x41, 0x00, 0x59, 0x00, 0x6a, 0x00,
+  0x00, 0x00, 0x17, 0x00, 0x23, 0x00, 0x2f, 0x00, 0x3b, 0x00, 0x4f, 0x00,
+  0x5b, 0x00, 0x00, 0x00, 0x13, 0x00, 0x1e, 0x00, 0x29, 0x00, 0x3a, 0x00,
+  0x52, 0x00, 0x61, 0x00, 0x70, 0x00, 0x00, 0x00, 0x14, 0x00, 0x1f, 0x00,
+  0x2b, 0x00, 0x3d, 0x00, 0x50, 0x00, 0x00, 0x00, 0x10, 0x00, 0x1e, 0x00,
+  0x2b, 0x00, 0x3c, 0x00, 0x5f, 0x00, 0x73, 0x00, 0x84, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x28, 0x00, 0x35, 0x00, 0x42, 0x00, 0x4f, 0x00, 0x63, 0x00,
+  0x71, 0x00, 0x84, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x30, 0x00, 0x42, 0x00,
+  0x5b, 0x00, 0x7f, 0x00, 0x9a, 0x00, 0xb0, 0x00, 0x00, 0x00, 0x1e, 0x00,
+  0x2f, 0x00, 0x3d, 0x00, 0x48, 0x00, 0x5c, 0x00, 0x6c, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x20, 0x00, 0x33, 0x00, 0x4f, 0x00, 0x5b, 0x00, 0x6d, 0x00,
+  0x80, 0x00, 0x8f, 0x00, 0x97, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x23, 0x00,
+  0x3d, 0x00, 0x59, 0x00, 0x6f, 0x00, 0x80, 0x00, 0x9e, 0x00, 0xb0, 0x00,
+  0xb8, 0x00, 0x00, 0x00, 0x16, 0x00, 0x24, 0x00, 0x3d, 0x00, 0x53, 0x00,
+  0x63, 0x00, 0x7a, 0x00, 0x8a, 0x00, 0x96, 0x00, 0xa1, 0x00, 0xaf, 0x00,
+  0xbd, 0x00, 0xc9, 0x00, 0xd3, 0x00, 0xe3, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x2a, 0x00, 0x39, 0x00, 0x50, 0x00, 0x72, 0x00, 0x85, 0x00, 0xa2, 0x00,
+  0xb9, 0x00, 0xca, 0x00, 0x00, 0x00, 0x10, 0x00, 0x22, 0x00, 0x35, 0x00,
+  0x4a, 0x00, 0x6d, 0x00, 0x7b, 0x00, 0x92, 0x00, 0xa4, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x18, 0x00, 0x2b, 0x00, 0x3f, 0x00, 0x51, 0x00, 0x61, 0x00,
+  0x68, 0x00, 0x75, 0x00, 0x7f, 0x00, 0x8a, 0x00, 0x91, 0x00, 0x9e, 0x00,
+  0xa6, 0x00, 0x00, 0x00, 0x10, 0x00, 0x20, 0x00, 0x31, 0x00, 0x3e, 0x00,
+  0x59, 0x00, 0x69, 0x00, 0x7a, 0x00, 0x89, 0x00, 0x91, 0x00, 0xa0, 0x00,
+  0xa7, 0x00, 0xb4, 0x00, 0x00, 0x00, 0x17, 0x00, 0x2a, 0x00, 0x3e, 0x00,
+  0x4d, 0x00, 0x5c, 0x00, 0x73, 0x00, 0x00, 0x00, 0x18, 0x00, 0x2a, 0x00,
+  0x3e, 0x00, 0x4c, 0x00, 0x58, 0x00, 0x64, 0x00, 0x72, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x21, 0x00, 0x2d, 0x00, 0x41, 0x00, 0x57, 0x00, 0x66, 0x00,
+  0x6d, 0x00, 0x00, 0x00, 0x12, 0x00, 0x1e, 0x00, 0x2c, 0x00, 0x37, 0x00,
+  0x45, 0x00, 0x55, 0x00, 0x61, 0x00, 0x68, 0x00, 0x00, 0x00, 0x1f, 0x00,
+  0x33, 0x00, 0x48, 0x00, 0x54, 0x00, 0x71, 0x00, 0x81, 0x00, 0x00, 0x00,
+  0x21, 0x00, 0x35, 0x00, 0x41, 0x00, 0x58, 0x00, 0x69, 0x00, 0x76, 0x00,
+  0x90, 0x00, 0x9e, 0x00, 0xae, 0x00, 0x00, 0x00, 0x23, 0x00, 0x31, 0x00,
+  0x3d, 0x00, 0x61, 0x00, 0x75, 0x00, 0x85, 0x00, 0x97, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x21, 0x00, 0x47, 0x00, 0x52, 0x00, 0x5f, 0x00, 0x77, 0x00,
+  0x84, 0x00, 0x90, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x34, 0x00, 0x4c, 0x00,
+  0x6d, 0x00, 0x8c, 0x00, 0xaf, 0x00, 0xcc, 0x00, 0xeb, 0x00, 0x0a, 0x01,
+  0x22, 0x01, 0x32, 0x01, 0x4e, 0x01, 0x67, 0x01, 0x81, 0x01, 0x90, 0x01,
+  0xa1, 0x01, 0x00, 0x00, 0x0f, 0x00, 0x1e, 0x00, 0x35, 0x00, 0x46, 0x00,
+  0x58, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x36, 0x00, 0x4f, 0x00, 0x71, 0x00,
+  0x91, 0x00, 0xb5, 0x00, 0xd3, 0x00, 0xf3, 0x00, 0x13, 0x01, 0x29, 0x01,
+  0x39, 0x01, 0x49, 0x01, 0x57, 0x01, 0x6c, 0x01, 0x8b, 0x01, 0x9c, 0x01,
+  0xac, 0x01, 0x00, 0x00, 0x1d, 0x00, 0x2c, 0x00, 0x3a, 0x00, 0x4b, 0x00,
+  0x5a, 0x00, 0x68, 0x00, 0x79, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x1f, 0x00, 0x41, 0x00, 0x4c, 0x00, 0x5e, 0x00, 0x6f, 0x00, 0x7a, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x24, 0x00, 0x44, 0x00, 0x53, 0x00, 0x6f, 0x00,
+  0x00, 0x00, 0x1c, 0x00, 0x2c, 0x00, 0x44, 0x00, 0x63, 0x00, 0x78, 0x00,
+  0x93, 0x00, 0xa1, 0x00, 0xb0, 0x00, 0xc7, 0x00, 0xcd, 0x00, 0xda, 0x00,
+  0x00, 0x00, 0x16, 0x00, 0x25, 0x00, 0x34, 0x00, 0x44, 0x00, 0x58, 0x00,
+  0x6f, 0x00, 0x8e, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x21, 0x00, 0x34, 0x00,
+  0x4b, 0x00, 0x63, 0x00, 0x70, 0x00, 0x7e, 0x00, 0x8b, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x27, 0x00, 0x3f, 0x00, 0x53, 0x00, 0x72, 0x00, 0x80, 0x00,
+  0x92, 0x00, 0x9f, 0x00, 0xaf, 0x00, 0x00, 0x00, 0x10, 0x00, 0x2c, 0x00,
+  0x3a, 0x00, 0x55, 0x00, 0x61, 0x00, 0x72, 0x00, 0x80, 0x00, 0x90, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x22, 0x00, 0x2f, 0x00, 0x45, 0x00, 0x5e, 0x00,
+  0x6f, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x14, 0x00, 0x22, 0x00, 0x39, 0x00,
+  0x4a, 0x00, 0x5e, 0x00, 0x6c, 0x00, 0x7a, 0x00, 0x8c, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x2b, 0x00, 0x3b, 0x00, 0x53, 0x00, 0x62, 0x00, 0x73, 0x00,
+  0x00, 0x00, 0x2d, 0x00, 0x54, 0x00, 0x6a, 0x00, 0x77, 0x00, 0x8b, 0x00,
+  0x00, 0x00, 0x1c, 0x00, 0x3f, 0x00, 0x54, 0x00, 0x65, 0x00, 0x00, 0x00,
+  0x1b, 0x00, 0x49, 0x00, 0x67, 0x00, 0x7a, 0x00, 0x8d, 0x00, 0x9a, 0x00,
+  0x00, 0x00, 0x1b, 0x00, 0x34, 0x00, 0x62, 0x00, 0x7d, 0x00, 0x95, 0x00,
+  0x00, 0x00, 0x15, 0x00, 0x3f, 0x00, 0x4b, 0x00, 0x5e, 0x00, 0x6e, 0x00,
+  0x82, 0x00, 0x91, 0x00, 0x99, 0x00, 0xa7, 0x00, 0x00, 0x00, 0x19, 0x00,
+  0x50, 0x00, 0x69, 0x00, 0x7d, 0x00, 0x8a, 0x00, 0x9e, 0x00, 0x00, 0x00,
+  0x19, 0x00, 0x4e, 0x00, 0x60, 0x00, 0x74, 0x00, 0x80, 0x00, 0x99, 0x00,
+  0xaf, 0x00, 0xb8, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x4f, 0x00, 0x8a, 0x00,
+  0x9d, 0x00, 0xba, 0x00, 0xcd, 0x00, 0xe0, 0x00, 0xed, 0x00, 0x00, 0x00,
+  0x18, 0x00, 0x2f, 0x00, 0x3d, 0x00, 0x4d, 0x00, 0x5d, 0x00, 0x72, 0x00,
+  0x82, 0x00, 0x93, 0x00, 0x9d, 0x00, 0xac, 0x00, 0xb6, 0x00, 0xbe, 0x00,
+  0xcd, 0x00, 0x00, 0x00, 0x20, 0x00, 0x37, 0x00, 0x42, 0x00, 0x51, 0x00,
+  0x60, 0x00, 0x77, 0x00, 0x8d, 0x00, 0x9e, 0x00, 0xb0, 0x00, 0x00, 0x00,
+  0x1e, 0x00, 0x34, 0x00, 0x44, 0x00, 0x54, 0x00, 0x63, 0x00, 0x72, 0x00,
+  0x86, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x29, 0x00, 0x3d, 0x00, 0x4c, 0x00,
+  0x5b, 0x00, 0x6d, 0x00, 0x82, 0x00, 0x00, 0x00, 0x18, 0x00, 0x27, 0x00,
+  0x43, 0x00, 0x51, 0x00, 0x66, 0x00, 0x00, 0x00, 0x10, 0x00, 0x22, 0x00,
+  0x42, 0x00, 0x56, 0x00, 0x66, 0x00, 0x7a, 0x00, 0x85, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x1e, 0x00, 0x2d, 0x00, 0x3b, 0x00, 0x52, 0x00, 0x64, 0x00,
+  0x74, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x2d, 0x00, 0x3d, 0x00, 0x51, 0x00,
+  0x63, 0x00, 0x77, 0x00, 0x89, 0x00, 0x00, 0x00, 0x17, 0x00, 0x28, 0x00,
+  0x44, 0x00, 0x60, 0x00, 0x00, 0x00, 0x12, 0x00, 0x29, 0x00, 0x39, 0x00,
+  0x57, 0x00, 0x60, 0x00, 0x69, 0x00, 0x00, 0x00, 0x12, 0x00, 0x2f, 0x00,
+  0x40, 0x00, 0x5b, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x25, 0x00,
+  0x3f, 0x00, 0x53, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x1b, 0x00, 0x31, 0x00,
+  0x49, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x2c, 0x00, 0x43, 0x00, 0x5f, 0x00,
+  0x00, 0x00, 0x13, 0x00, 0x29, 0x00, 0x3f, 0x00, 0x54, 0x00, 0x67, 0x00,
+  0x00, 0x00, 0x16, 0x00, 0x27, 0x00, 0x3e, 0x00, 0x53, 0x00, 0x66, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x33, 0x00, 0x48, 0x00, 0x53, 0x00, 0x63, 0x00,
+  0x78, 0x00, 0x00, 0x00, 0x16, 0x00, 0x45, 0x00, 0x57, 0x00, 0x66, 0x00,
+  0x6f, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x24, 0x00, 0x30, 0x00, 0x44, 0x00,
+  0x64, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x17, 0x00, 0x3d, 0x00, 0x52, 0x00,
+  0x5f, 0x00, 0x76, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x2b, 0x00, 0x46, 0x00,
+  0x00, 0x00, 0x26, 0x00, 0x35, 0x00, 0x47, 0x00, 0x57, 0x00, 0x66, 0x00,
+  0x77, 0x00, 0x88, 0x00, 0x9a, 0x00, 0xa3, 0x00, 0x00, 0x00, 0x17, 0x00,
+  0x45, 0x00, 0x55, 0x00, 0x66, 0x00, 0x76, 0x00, 0x7c, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x29, 0x00, 0x49, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x14, 0x00,
+  0x2c, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x13, 0x00, 0x29, 0x00, 0x3d, 0x00,
+  0x4d, 0x00, 0x5c, 0x00, 0x65, 0x00, 0x00, 0x00, 0x24, 0x00, 0x34, 0x00,
+  0x4b, 0x00, 0x5f, 0x00, 0x69, 0x00, 0x00, 0x00, 0x20, 0x00, 0x2f, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x23, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x17, 0x00,
+  0x3b, 0x00, 0x52, 0x00, 0x66, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x3a, 0x00,
+  0x64, 0x00, 0x7d, 0x00, 0x86, 0x00, 0x91, 0x00, 0x00, 0x00, 0x2d, 0x00,
+  0x4c, 0x00, 0x6c, 0x00, 0x80, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x31, 0x00, 0x50, 0x00, 0x70, 0x00, 0x7d, 0x00, 0x00, 0x00, 0x15, 0x00,
+  0x21, 0x00, 0x43, 0x00, 0x63, 0x00, 0x70, 0x00, 0x00, 0x00, 0x11, 0x00,
+  0x1f, 0x00, 0x4a, 0x00, 0x64, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x39, 0x00,
+  0x4f, 0x00, 0x72, 0x00, 0x81, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x28, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x16, 0x00,
+  0x49, 0x00, 0x5a, 0x00, 0x6a, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x3d, 0x00,
+  0x4e, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x19, 0x00, 0x29, 0x00, 0x3f, 0x00,
+  0x48, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x23, 0x00, 0x2e, 0x00, 0x3f, 0x00,
+  0x4d, 0x00, 0x00, 0x00, 0x17, 0x00, 0x29, 0x00, 0x47, 0x00, 0x55, 0x00,
+  0x00, 0x00, 0x16, 0x00, 0x3e, 0x00, 0x4e, 0x00, 0x5e, 0x00, 0x73, 0x00,
+  0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x36, 0x00, 0x3d, 0x00,
+  0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x16, 0x00, 0x26, 0x00, 0x3d, 0x00,
+  0x00, 0x00, 0x0f, 0x00, 0x26, 0x00, 0x00, 0x00, 0x10, 0x00, 0x25, 0x00,
+  0x37, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x28, 0x00, 0x40, 0x00,
+  0x50, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x3c, 0x00, 0x5a, 0x00, 0x78, 0x00,
+  0x96, 0x00, 0xb4, 0x00, 0xd2, 0x00, 0xf0, 0x00, 0x0e, 0x01, 0x2a, 0x01,
+  0x42, 0x01, 0x54, 0x01, 0x63, 0x01, 0x00, 0x00, 0x11, 0x00, 0x27, 0x00,
+  0x30, 0x00, 0x00, 0x00, 0x16, 0x00, 0x30, 0x00, 0x3c, 0x00, 0x4c, 0x00,
+  0x00, 0x00, 0x11, 0x00, 0x28, 0x00, 0x00, 0x00, 0x12, 0x00, 0x21, 0x00,
+  0x38, 0x00, 0x4e, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x00,
+  0x00, 0x00, 0x24, 0x00, 0x37, 0x00, 0x51, 0x00, 0x00, 0x00, 0x19, 0x00,
+  0x30, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x15, 0x00, 0x24, 0x00, 0x55, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x18, 0x00, 0x3e, 0x00, 0x50, 0x00,
+  0x00, 0x00, 0x11, 0x00, 0x2c, 0x00, 0x5d, 0x00, 0x68, 0x00, 0x70, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x2d, 0x00,
+  0x47, 0x00, 0x58, 0x00, 0x69, 0x00, 0x00, 0x00, 0x11, 0x00, 0x25, 0x00,
+  0x4e, 0x00, 0x00, 0x00, 0x11, 0x00, 0x1d, 0x00, 0x3f, 0x00, 0x59, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x1b, 0x00, 0x2d, 0x00,
+  0x00, 0x00, 0x11, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x09, 0x00, 0x10, 0x00,
+  0x1a, 0x00, 0x00, 0x00, 0x21, 0x00, 0x2f, 0x00, 0x3f, 0x00, 0x47, 0x00,
+  0x4f, 0x00, 0x5e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00,
+  0x25, 0x00, 0x3c, 0x00, 0x50, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x33, 0x00,
+  0x00, 0x00, 0x15, 0x00, 0x33, 0x00, 0x51, 0x00, 0x6f, 0x00, 0x88, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1f, 0x00,
+  0x2e, 0x00, 0x00, 0x00, 0x13, 0x00, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x15, 0x00, 0x00, 0x00, 0x14, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1a, 0x00, 0x2a, 0x00, 0x3a, 0x00, 0x4a, 0x00, 0x5a, 0x00,
+  0x64, 0x00, 0x71, 0x00, 0x82, 0x00, 0x93, 0x00, 0xa3, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x00, 0x00, 0x18, 0x00, 0x3c, 0x00, 0x49, 0x00, 0x5a, 0x00,
+  0x6b, 0x00, 0x75, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x2f, 0x00, 0x35, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x19, 0x00, 0x45, 0x00, 0x57, 0x00, 0x63, 0x00,
+  0x70, 0x00, 0x81, 0x00, 0x8c, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x1c, 0x00,
+  0x35, 0x00, 0x41, 0x00, 0x52, 0x00, 0x00, 0x00, 0x23, 0x00, 0x44, 0x00,
+  0x59, 0x00, 0x00, 0x00, 0x16, 0x00, 0x33, 0x00, 0x46, 0x00, 0x00, 0x00,
+  0x16, 0x00, 0x32, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x16, 0x00, 0x28, 0x00,
+  0x31, 0x00, 0x3b, 0x00, 0x44, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x44, 0x00,
+  0x00, 0x00, 0x1b, 0x00, 0x3d, 0x00, 0x55, 0x00, 0x64, 0x00, 0x75, 0x00,
+  0x00, 0x00, 0x34, 0x00, 0x50, 0x00, 0x6a, 0x00, 0x7b, 0x00, 0x87, 0x00,
+  0xa1, 0x00, 0x00, 0x00, 0x18, 0x00, 0x32, 0x00, 0x43, 0x00, 0x4f, 0x00,
+  0x69, 0x00, 0x7b, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x1a, 0x00, 0x3b, 0x00,
+  0x00, 0x00, 0x22, 0x00, 0x32, 0x00, 0x42, 0x00, 0x5f, 0x00, 0x00, 0x00,
+  0x16, 0x00, 0x22, 0x00, 0x36, 0x00, 0x48, 0x00, 0x54, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x1d, 0x00, 0x39, 0x00, 0x43, 0x00, 0x4b, 0x00, 0x00, 0x00,
+  0x16, 0x00, 0x2c, 0x00, 0x42, 0x00, 0x52, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x19, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x1b, 0x00,
+  0x2d, 0x00, 0x3c, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x24, 0x00, 0x32, 0x00,
+  0x43, 0x00, 0x54, 0x00, 0x64, 0x00, 0x00, 0x00, 0x12, 0x00, 0x23, 0x00,
+  0x00, 0x00, 0x1b, 0x00, 0x2b, 0x00, 0x39, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1c, 0x00, 0x30, 0x00,
+  0x00, 0x00, 0x18, 0x00, 0x27, 0x00, 0x39, 0x00, 0x4c, 0x00, 0x5e, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x1b, 0x00, 0x2c, 0x00, 0x41, 0x00, 0x00, 0x00,
+  0x1a, 0x00, 0x3e, 0x00, 0x4d, 0x00, 0x5c, 0x00, 0x79, 0x00, 0x81, 0x00,
+  0x00, 0x00, 0x1a, 0x00, 0x28, 0x00, 0x35, 0x00, 0x42, 0x00, 0x58, 0x00,
+  0x71, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x35, 0x00, 0x46, 0x00, 0x53, 0x00,
+  0x63, 0x00, 0x73, 0x00, 0x83, 0x00, 0x94, 0x00, 0xa5, 0x00, 0xaf, 0x00,
+  0x00, 0x00, 0x1a, 0x00, 0x31, 0x00, 0x4e, 0x00, 0x59, 0x00, 0x6a, 0x00,
+  0x77, 0x00, 0x8c, 0x00, 0x00, 0x00, 0x24, 0x00, 0x3e, 0x00, 0x5c, 0x00,
+  0x81, 0x00, 0x94, 0x00, 0xa7, 0x00, 0xba, 0x00, 0xd0, 0x00, 0xda, 0x00,
+  0xe6, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x4d, 0x00, 0x64, 0x00, 0x77, 0x00,
+  0x8f, 0x00, 0xa1, 0x00, 0xaa, 0x00, 0xb5, 0x00, 0xbe, 0x00, 0x00, 0x00,
+  0x1a, 0x00, 0x34, 0x00, 0x4f, 0x00, 0x5b, 0x00, 0x6a, 0x00, 0x7d, 0x00,
+  0x8c, 0x00, 0x95, 0x00, 0x00, 0x00, 0x19, 0x00, 0x4f, 0x00, 0x61, 0x00,
+  0x6c, 0x00, 0x82, 0x00, 0x95, 0x00, 0xa0, 0x00, 0x00, 0x00, 0x17, 0x00,
+  0x35, 0x00, 0x4e, 0x00, 0x5a, 0x00, 0x6f, 0x00, 0x82, 0x00, 0x00, 0x00,
+  0x21, 0x00, 0x3b, 0x00, 0x57, 0x00, 0x73, 0x00, 0x8f, 0x00, 0x9f, 0x00,
+  0xad, 0x00, 0x00, 0x00, 0x29, 0x00, 0x3f, 0x00, 0x63, 0x00, 0x80, 0x00,
+  0x8f, 0x00, 0x9f, 0x00, 0x00, 0x00, 0x16, 0x00, 0x32, 0x00, 0x54, 0x00,
+  0x6c, 0x00, 0x7b, 0x00, 0x8c, 0x00, 0x9c, 0x00, 0xac, 0x00, 0x00, 0x00,
+  0x1a, 0x00, 0x42, 0x00, 0x5d, 0x00, 0x75, 0x00, 0x85, 0x00, 0xa1, 0x00,
+  0xb2, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x37, 0x00, 0x4f, 0x00, 0x66, 0x00,
+  0x79, 0x00, 0x00, 0x00, 0x30, 0x00, 0x49, 0x00, 0x63, 0x00, 0x7d, 0x00,
+  0x8e, 0x00, 0x9b, 0x00, 0xaf, 0x00, 0xcb, 0x00, 0x00, 0x00, 0x1b, 0x00,
+  0x32, 0x00, 0x42, 0x00, 0x4f, 0x00, 0x00, 0x00, 0x24, 0x00, 0x3f, 0x00,
+  0x5c, 0x00, 0x6b, 0x00, 0x7a, 0x00, 0x8e, 0x00, 0x97, 0x00, 0xa7, 0x00,
+  0xb7, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x37, 0x00, 0x54, 0x00,
+  0x66, 0x00, 0x00, 0x00, 0x19, 0x00, 0x28, 0x00, 0x39, 0x00, 0x00, 0x00,
+  0x1f, 0x00, 0x2d, 0x00, 0x3e, 0x00, 0x50, 0x00, 0x00, 0x00, 0x17, 0x00,
+  0x22, 0x00, 0x39, 0x00, 0x46, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x1b, 0x00,
+  0x32, 0x00, 0x48, 0x00, 0x57, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x36, 0x00,
+  0x4a, 0x00, 0x55, 0x00, 0x66, 0x00, 0x00, 0x00, 0x19, 0x00, 0x31, 0x00,
+  0x4c, 0x00, 0x62, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x45, 0x00,
+  0x68, 0x00, 0x75, 0x00, 0x85, 0x00, 0xae, 0x00, 0xd1, 0x00, 0xe4, 0x00,
+  0xee, 0x00, 0x00, 0x00, 0x25, 0x00, 0x3f, 0x00, 0x53, 0x00, 0x62, 0x00,
+  0x00, 0x00, 0x18, 0x00, 0x30, 0x00, 0x58, 0x00, 0x67, 0x00, 0x74, 0x00,
+  0x86, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x1a, 0x00, 0x2c, 0x00, 0x4f, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x22, 0x00, 0x35, 0x00, 0x56, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x21, 0x00, 0x36, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1b, 0x00,
+  0x24, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x1d, 0x00, 0x31, 0x00, 0x3b, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x23, 0x00, 0x33, 0x00, 0x00, 0x00, 0x17, 0x00,
+  0x2e, 0x00, 0x48, 0x00, 0x54, 0x00, 0x00, 0x00, 0x19, 0x00, 0x32, 0x00,
+  0x43, 0x00, 0x4f, 0x00, 0x00, 0x00, 0x19, 0x00, 0x26, 0x00, 0x32, 0x00,
+  0x46, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x26, 0x00, 0x00, 0x00, 0x1e, 0x00,
+  0x00, 0x00, 0x18, 0x00, 0x31, 0x00, 0x40, 0x00, 0x4d, 0x00, 0x5d, 0x00,
+  0x6f, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x30, 0x00, 0x40, 0x00,
+  0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x35, 0x00, 0x46, 0x00,
+  0x00, 0x00, 0x25, 0x00, 0x30, 0x00, 0x00, 0x00, 0x17, 0x00, 0x25, 0x00,
+  0x36, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x3b, 0x00, 0x55, 0x00, 0x6a, 0x00,
+  0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x36, 0x00, 0x4f, 0x00,
+  0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x21, 0x00, 0x2f, 0x00, 0x00, 0x00,
+  0x1b, 0x00, 0x00, 0x00, 0x18, 0x00, 0x30, 0x00, 0x49, 0x00, 0x59, 0x00,
+  0x00, 0x00, 0x1c, 0x00, 0x28, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x39, 0x00,
+  0x53, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x16, 0x00,
+  0x00, 0x00, 0x1b, 0x00, 0x34, 0x00, 0x46, 0x00, 0x00, 0x00, 0x40, 0x00,
+  0x59, 0x00, 0x6a, 0x00, 0x74, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00,
+  0x1f, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x1c, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1e, 0x00, 0x2e, 0x00,
+  0x3b, 0x00, 0x00, 0x00, 0x09, 0x00, 0x1a, 0x00, 0x29, 0x00, 0x37, 0x00,
+  0x46, 0x00, 0x54, 0x00, 0x63, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x1a, 0x00,
+  0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x08, 0x00,
+  0x00, 0x00, 0x11, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x13, 0x00, 0x25, 0x00,
+  0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x1c, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x1f, 0x00, 0x2b, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x14, 0x00,
+  0x23, 0x00, 0x33, 0x00, 0x42, 0x00, 0x50, 0x00, 0x5e, 0x00, 0x68, 0x00,
+  0x7b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x19, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x07, 0x00, 0x10, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x00, 0x00, 0x33, 0x00, 0x65, 0x00, 0x94, 0x00, 0xc4, 0x00,
+  0x00, 0x00, 0x31, 0x00, 0x60, 0x00, 0x90, 0x00, 0xbe, 0x00, 0xeb, 0x00,
+  0x19, 0x01, 0x28, 0x01, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x11, 0x00
+};
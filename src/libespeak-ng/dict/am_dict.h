@@ -1,5 +1,7 @@
 #pragma once
-const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
+#include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/am_dict_index.h>
+const unsigned char __espeakng_dict_am[] __attribute__((aligned((4)))) = {
   0x00, 0x04, 0x00, 0x00, 0x15, 0xf2, 0x00, 0x00, 0x00, 0x61, 0x19, 0xf0,
   0x9f, 0x91, 0xa9, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xe2, 0x80,
   0x8d, 0xf0, 0x9f, 0x91, 0xa7, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa7,
@@ -5325,4 +5327,11 @@ const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
   0x00, 0x07, 0x06, 0x00, 0x24, 0x03, 0x49, 0x27, 0x37, 0x23, 0x22, 0x00,
   0x07, 0x00
 };
-size_t __espeakng_dictlen = 63878;
+
+BackgroundAudioDictionary dict_am = {
+    "am",
+    63878,
+    __espeakng_dict_am,
+    7078,
+    __espeakng_dictindex_am
+};
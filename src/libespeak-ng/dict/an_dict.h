@@ -1,5 +1,7 @@
 #pragma once
-const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
+#include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/an_dict_index.h>
+const unsigned char __espeakng_dict_an[] __attribute__((aligned((4)))) = {
   0x00, 0x04, 0x00, 0x00, 0x6b, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x04, 0xc1, 0x04, 0x4c, 0x00, 0x0c, 0x44, 0x05, 0x04, 0x0c, 0x14,
   0x06, 0x23, 0x30, 0x6d, 0x37, 0x00, 0x05, 0xc2, 0x05, 0x00, 0x0d, 0x00,
@@ -559,4 +561,11 @@ const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
   0x20, 0x0f, 0x03, 0x42, 0x06, 0x24, 0x32, 0x27, 0x5a, 0x00, 0x2d, 0x08,
   0x20, 0x02, 0x20, 0x0f, 0x00, 0x07, 0x00
 };
-size_t __espeakng_dictlen = 6691;
+
+BackgroundAudioDictionary dict_an = {
+    "an",
+    6691,
+    __espeakng_dict_an,
+    3520,
+    __espeakng_dictindex_an
+};
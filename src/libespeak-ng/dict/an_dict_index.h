@@ -0,0 +1,297 @@
+#pragma once
+const unsigned char __espeakng_dictindex_an[] __attribute__((aligned((4)))) = {
+  0x45, 0x44, 0x58, 0x31, 0x23, 0x1a, 0x00, 0x00, 0x6b, 0x15, 0x00, 0x00,
+  0xe4, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x03, 0x00, 0x05, 0x00, 0x05, 0x00,
+  0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x07, 0x00, 0x07, 0x00,
+  0x08, 0x00, 0x08, 0x00, 0x09, 0x00, 0x09, 0x00, 0x0b, 0x00, 0x0c, 0x00,
+  0x0e, 0x00, 0x0e, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x10, 0x00, 0x10, 0x00,
+  0x10, 0x00, 0x10, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+  0x12, 0x00, 0x13, 0x00, 0x13, 0x00, 0x14, 0x00, 0x18, 0x00, 0x1c, 0x00,
+  0x20, 0x00, 0x20, 0x00, 0x21, 0x00, 0x21, 0x00, 0x24, 0x00, 0x25, 0x00,
+  0x27, 0x00, 0x27, 0x00, 0x28, 0x00, 0x29, 0x00, 0x2c, 0x00, 0x2e, 0x00,
+  0x2e, 0x00, 0x2e, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00,
+  0x33, 0x00, 0x33, 0x00, 0x33, 0x00, 0x33, 0x00, 0x34, 0x00, 0x36, 0x00,
+  0x37, 0x00, 0x37, 0x00, 0x39, 0x00, 0x39, 0x00, 0x39, 0x00, 0x39, 0x00,
+  0x3a, 0x00, 0x3a, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3c, 0x00, 0x3c, 0x00,
+  0x3c, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3e, 0x00,
+  0x3f, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x41, 0x00, 0x42, 0x00,
+  0x43, 0x00, 0x43, 0x00, 0x44, 0x00, 0x45, 0x00, 0x47, 0x00, 0x49, 0x00,
+  0x4c, 0x00, 0x4d, 0x00, 0x4f, 0x00, 0x50, 0x00, 0x51, 0x00, 0x52, 0x00,
+  0x52, 0x00, 0x52, 0x00, 0x54, 0x00, 0x55, 0x00, 0x57, 0x00, 0x57, 0x00,
+  0x58, 0x00, 0x59, 0x00, 0x5b, 0x00, 0x5b, 0x00, 0x5b, 0x00, 0x5c, 0x00,
+  0x5c, 0x00, 0x5c, 0x00, 0x5c, 0x00, 0x5d, 0x00, 0x5d, 0x00, 0x5d, 0x00,
+  0x5d, 0x00, 0x5d, 0x00, 0x5e, 0x00, 0x5f, 0x00, 0x5f, 0x00, 0x5f, 0x00,
+  0x60, 0x00, 0x60, 0x00, 0x61, 0x00, 0x61, 0x00, 0x63, 0x00, 0x64, 0x00,
+  0x64, 0x00, 0x64, 0x00, 0x65, 0x00, 0x65, 0x00, 0x65, 0x00, 0x66, 0x00,
+  0x66, 0x00, 0x66, 0x00, 0x66, 0x00, 0x66, 0x00, 0x66, 0x00, 0x66, 0x00,
+  0x67, 0x00, 0x67, 0x00, 0x68, 0x00, 0x69, 0x00, 0x69, 0x00, 0x69, 0x00,
+  0x69, 0x00, 0x69, 0x00, 0x6a, 0x00, 0x6a, 0x00, 0x6b, 0x00, 0x6b, 0x00,
+  0x6b, 0x00, 0x6c, 0x00, 0x6d, 0x00, 0x6d, 0x00, 0x6d, 0x00, 0x6d, 0x00,
+  0x6d, 0x00, 0x6d, 0x00, 0x6d, 0x00, 0x6d, 0x00, 0x6e, 0x00, 0x6e, 0x00,
+  0x6f, 0x00, 0x6f, 0x00, 0x6f, 0x00, 0x6f, 0x00, 0x6f, 0x00, 0x6f, 0x00,
+  0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00,
+  0x70, 0x00, 0x71, 0x00, 0x71, 0x00, 0x71, 0x00, 0x71, 0x00, 0x72, 0x00,
+  0x73, 0x00, 0x73, 0x00, 0x74, 0x00, 0x74, 0x00, 0x74, 0x00, 0x74, 0x00,
+  0x74, 0x00, 0x74, 0x00, 0x75, 0x00, 0x75, 0x00, 0x75, 0x00, 0x77, 0x00,
+  0x79, 0x00, 0x79, 0x00, 0x79, 0x00, 0x7a, 0x00, 0x7a, 0x00, 0x7a, 0x00,
+  0x7a, 0x00, 0x7b, 0x00, 0x7d, 0x00, 0x7d, 0x00, 0x7f, 0x00, 0x7f, 0x00,
+  0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x82, 0x00, 0x82, 0x00, 0x82, 0x00,
+  0x82, 0x00, 0x84, 0x00, 0x85, 0x00, 0x86, 0x00, 0x86, 0x00, 0x87, 0x00,
+  0x87, 0x00, 0x87, 0x00, 0x87, 0x00, 0x87, 0x00, 0x88, 0x00, 0x88, 0x00,
+  0x88, 0x00, 0x89, 0x00, 0x89, 0x00, 0x89, 0x00, 0x89, 0x00, 0x89, 0x00,
+  0x8a, 0x00, 0x8a, 0x00, 0x8a, 0x00, 0x8b, 0x00, 0x8c, 0x00, 0x8c, 0x00,
+  0x8c, 0x00, 0x8c, 0x00, 0x8e, 0x00, 0x8e, 0x00, 0x8e, 0x00, 0x8e, 0x00,
+  0x8f, 0x00, 0x8f, 0x00, 0x8f, 0x00, 0x90, 0x00, 0x91, 0x00, 0x91, 0x00,
+  0x91, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00,
+  0x92, 0x00, 0x92, 0x00, 0x93, 0x00, 0x93, 0x00, 0x93, 0x00, 0x96, 0x00,
+  0x96, 0x00, 0x96, 0x00, 0x97, 0x00, 0x98, 0x00, 0x98, 0x00, 0x98, 0x00,
+  0x98, 0x00, 0x98, 0x00, 0x98, 0x00, 0x98, 0x00, 0x98, 0x00, 0x98, 0x00,
+  0x98, 0x00, 0x99, 0x00, 0x99, 0x00, 0x99, 0x00, 0x99, 0x00, 0x99, 0x00,
+  0x99, 0x00, 0x9a, 0x00, 0x9a, 0x00, 0x9a, 0x00, 0x9a, 0x00, 0x9b, 0x00,
+  0x9b, 0x00, 0x9c, 0x00, 0x9c, 0x00, 0x9c, 0x00, 0x9c, 0x00, 0x9c, 0x00,
+  0x9d, 0x00, 0x9d, 0x00, 0x9d, 0x00, 0x9f, 0x00, 0x9f, 0x00, 0xa0, 0x00,
+  0xa0, 0x00, 0xa0, 0x00, 0xa0, 0x00, 0xa1, 0x00, 0xa1, 0x00, 0xa1, 0x00,
+  0xa1, 0x00, 0xa1, 0x00, 0xa1, 0x00, 0xa1, 0x00, 0xa1, 0x00, 0xa1, 0x00,
+  0xa1, 0x00, 0xa3, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa5, 0x00,
+  0xa5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xa6, 0x00, 0xa6, 0x00, 0xa6, 0x00,
+  0xa6, 0x00, 0xa7, 0x00, 0xa7, 0x00, 0xa7, 0x00, 0xa7, 0x00, 0xa8, 0x00,
+  0xa8, 0x00, 0xa9, 0x00, 0xaa, 0x00, 0xab, 0x00, 0xab, 0x00, 0xae, 0x00,
+  0xae, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
+  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xb0, 0x00, 0xb0, 0x00, 0xb0, 0x00,
+  0xb0, 0x00, 0xb0, 0x00, 0xb1, 0x00, 0xb1, 0x00, 0xb1, 0x00, 0xb3, 0x00,
+  0xb3, 0x00, 0xb3, 0x00, 0xb3, 0x00, 0xb3, 0x00, 0xb4, 0x00, 0xb7, 0x00,
+  0xb7, 0x00, 0xb7, 0x00, 0xb7, 0x00, 0xb9, 0x00, 0xb9, 0x00, 0xb9, 0x00,
+  0xba, 0x00, 0xba, 0x00, 0xbb, 0x00, 0xbc, 0x00, 0xbd, 0x00, 0xbd, 0x00,
+  0xbd, 0x00, 0xbe, 0x00, 0xbf, 0x00, 0xbf, 0x00, 0xbf, 0x00, 0xc0, 0x00,
+  0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc2, 0x00, 0xc3, 0x00,
+  0xc3, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00,
+  0xc5, 0x00, 0xc6, 0x00, 0xc8, 0x00, 0xc8, 0x00, 0xc8, 0x00, 0xc8, 0x00,
+  0xc8, 0x00, 0xc8, 0x00, 0xc8, 0x00, 0xca, 0x00, 0xcb, 0x00, 0xcb, 0x00,
+  0xcb, 0x00, 0xcb, 0x00, 0xcb, 0x00, 0xcb, 0x00, 0xcd, 0x00, 0xcd, 0x00,
+  0xce, 0x00, 0xcf, 0x00, 0xcf, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00,
+  0xd1, 0x00, 0xd2, 0x00, 0xd4, 0x00, 0xd5, 0x00, 0xd6, 0x00, 0xd7, 0x00,
+  0xd7, 0x00, 0xd7, 0x00, 0xd8, 0x00, 0xd9, 0x00, 0xd9, 0x00, 0xd9, 0x00,
+  0xd9, 0x00, 0xd9, 0x00, 0xdb, 0x00, 0xdb, 0x00, 0xdb, 0x00, 0xdc, 0x00,
+  0xdc, 0x00, 0xdc, 0x00, 0xdc, 0x00, 0xde, 0x00, 0xde, 0x00, 0xde, 0x00,
+  0xde, 0x00, 0xdf, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00,
+  0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe1, 0x00, 0xe2, 0x00, 0xe3, 0x00,
+  0xe3, 0x00, 0xe3, 0x00, 0xe3, 0x00, 0xe4, 0x00, 0xe4, 0x00, 0xe5, 0x00,
+  0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe9, 0x00, 0xe9, 0x00,
+  0xe9, 0x00, 0xeb, 0x00, 0xec, 0x00, 0xec, 0x00, 0xec, 0x00, 0xee, 0x00,
+  0xee, 0x00, 0xee, 0x00, 0xef, 0x00, 0xf1, 0x00, 0xf1, 0x00, 0xf2, 0x00,
+  0xf2, 0x00, 0xf2, 0x00, 0xf3, 0x00, 0xf3, 0x00, 0xf3, 0x00, 0xf4, 0x00,
+  0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf5, 0x00, 0xf5, 0x00, 0xf5, 0x00,
+  0xf5, 0x00, 0xf5, 0x00, 0xf5, 0x00, 0xf5, 0x00, 0xf5, 0x00, 0xf5, 0x00,
+  0xf7, 0x00, 0xf8, 0x00, 0xf9, 0x00, 0xfa, 0x00, 0xfa, 0x00, 0xfa, 0x00,
+  0xfa, 0x00, 0xfb, 0x00, 0xfb, 0x00, 0xfc, 0x00, 0xfd, 0x00, 0xfe, 0x00,
+  0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
+  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x03, 0x01, 0x04, 0x01, 0x04, 0x01, 0x04, 0x01, 0x05, 0x01, 0x05, 0x01,
+  0x05, 0x01, 0x05, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01,
+  0x08, 0x01, 0x08, 0x01, 0x08, 0x01, 0x08, 0x01, 0x09, 0x01, 0x09, 0x01,
+  0x09, 0x01, 0x0c, 0x01, 0x0c, 0x01, 0x0c, 0x01, 0x0c, 0x01, 0x0c, 0x01,
+  0x0c, 0x01, 0x0c, 0x01, 0x0c, 0x01, 0x10, 0x01, 0x10, 0x01, 0x11, 0x01,
+  0x11, 0x01, 0x13, 0x01, 0x13, 0x01, 0x13, 0x01, 0x14, 0x01, 0x15, 0x01,
+  0x15, 0x01, 0x15, 0x01, 0x15, 0x01, 0x15, 0x01, 0x16, 0x01, 0x17, 0x01,
+  0x17, 0x01, 0x17, 0x01, 0x1a, 0x01, 0x1a, 0x01, 0x1a, 0x01, 0x1a, 0x01,
+  0x1a, 0x01, 0x1a, 0x01, 0x1a, 0x01, 0x1b, 0x01, 0x1c, 0x01, 0x1c, 0x01,
+  0x1d, 0x01, 0x1d, 0x01, 0x1e, 0x01, 0x1f, 0x01, 0x1f, 0x01, 0x1f, 0x01,
+  0x21, 0x01, 0x21, 0x01, 0x22, 0x01, 0x22, 0x01, 0x22, 0x01, 0x22, 0x01,
+  0x22, 0x01, 0x23, 0x01, 0x24, 0x01, 0x24, 0x01, 0x24, 0x01, 0x24, 0x01,
+  0x26, 0x01, 0x26, 0x01, 0x26, 0x01, 0x26, 0x01, 0x28, 0x01, 0x28, 0x01,
+  0x28, 0x01, 0x28, 0x01, 0x29, 0x01, 0x2a, 0x01, 0x2a, 0x01, 0x2d, 0x01,
+  0x31, 0x01, 0x32, 0x01, 0x32, 0x01, 0x32, 0x01, 0x32, 0x01, 0x32, 0x01,
+  0x32, 0x01, 0x33, 0x01, 0x34, 0x01, 0x35, 0x01, 0x35, 0x01, 0x35, 0x01,
+  0x35, 0x01, 0x35, 0x01, 0x35, 0x01, 0x35, 0x01, 0x37, 0x01, 0x37, 0x01,
+  0x37, 0x01, 0x37, 0x01, 0x3a, 0x01, 0x3a, 0x01, 0x3a, 0x01, 0x3a, 0x01,
+  0x3c, 0x01, 0x3c, 0x01, 0x3c, 0x01, 0x3c, 0x01, 0x3d, 0x01, 0x3d, 0x01,
+  0x3e, 0x01, 0x3f, 0x01, 0x40, 0x01, 0x40, 0x01, 0x40, 0x01, 0x40, 0x01,
+  0x40, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x42, 0x01, 0x42, 0x01,
+  0x42, 0x01, 0x42, 0x01, 0x42, 0x01, 0x42, 0x01, 0x42, 0x01, 0x42, 0x01,
+  0x43, 0x01, 0x43, 0x01, 0x43, 0x01, 0x43, 0x01, 0x44, 0x01, 0x45, 0x01,
+  0x45, 0x01, 0x45, 0x01, 0x45, 0x01, 0x45, 0x01, 0x45, 0x01, 0x45, 0x01,
+  0x45, 0x01, 0x45, 0x01, 0x46, 0x01, 0x48, 0x01, 0x49, 0x01, 0x49, 0x01,
+  0x49, 0x01, 0x49, 0x01, 0x49, 0x01, 0x49, 0x01, 0x49, 0x01, 0x4a, 0x01,
+  0x4b, 0x01, 0x4b, 0x01, 0x4b, 0x01, 0x4b, 0x01, 0x4b, 0x01, 0x4b, 0x01,
+  0x4b, 0x01, 0x4b, 0x01, 0x4c, 0x01, 0x4d, 0x01, 0x4d, 0x01, 0x4f, 0x01,
+  0x50, 0x01, 0x50, 0x01, 0x50, 0x01, 0x50, 0x01, 0x51, 0x01, 0x51, 0x01,
+  0x52, 0x01, 0x52, 0x01, 0x52, 0x01, 0x52, 0x01, 0x53, 0x01, 0x55, 0x01,
+  0x56, 0x01, 0x57, 0x01, 0x58, 0x01, 0x58, 0x01, 0x58, 0x01, 0x59, 0x01,
+  0x59, 0x01, 0x5a, 0x01, 0x5b, 0x01, 0x5c, 0x01, 0x5c, 0x01, 0x5c, 0x01,
+  0x5c, 0x01, 0x5c, 0x01, 0x5e, 0x01, 0x5f, 0x01, 0x5f, 0x01, 0x5f, 0x01,
+  0x5f, 0x01, 0x60, 0x01, 0x60, 0x01, 0x60, 0x01, 0x61, 0x01, 0x61, 0x01,
+  0x61, 0x01, 0x62, 0x01, 0x62, 0x01, 0x62, 0x01, 0x64, 0x01, 0x64, 0x01,
+  0x66, 0x01, 0x67, 0x01, 0x67, 0x01, 0x67, 0x01, 0x68, 0x01, 0x69, 0x01,
+  0x69, 0x01, 0x69, 0x01, 0x69, 0x01, 0x6a, 0x01, 0x6d, 0x01, 0x6d, 0x01,
+  0x6d, 0x01, 0x6e, 0x01, 0x6e, 0x01, 0x6e, 0x01, 0x6f, 0x01, 0x6f, 0x01,
+  0x70, 0x01, 0x70, 0x01, 0x70, 0x01, 0x70, 0x01, 0x71, 0x01, 0x71, 0x01,
+  0x71, 0x01, 0x71, 0x01, 0x72, 0x01, 0x72, 0x01, 0x72, 0x01, 0x72, 0x01,
+  0x73, 0x01, 0x73, 0x01, 0x73, 0x01, 0x74, 0x01, 0x74, 0x01, 0x74, 0x01,
+  0x74, 0x01, 0x75, 0x01, 0x75, 0x01, 0x76, 0x01, 0x76, 0x01, 0x76, 0x01,
+  0x78, 0x01, 0x78, 0x01, 0x79, 0x01, 0x79, 0x01, 0x79, 0x01, 0x79, 0x01,
+  0x79, 0x01, 0x7a, 0x01, 0x7a, 0x01, 0x7c, 0x01, 0x7c, 0x01, 0x7e, 0x01,
+  0x7e, 0x01, 0x7f, 0x01, 0x7f, 0x01, 0x80, 0x01, 0x81, 0x01, 0x83, 0x01,
+  0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01,
+  0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x84, 0x01, 0x84, 0x01, 0x84, 0x01,
+  0x85, 0x01, 0x85, 0x01, 0x85, 0x01, 0x86, 0x01, 0x86, 0x01, 0x86, 0x01,
+  0x86, 0x01, 0x87, 0x01, 0x87, 0x01, 0x88, 0x01, 0x89, 0x01, 0x8a, 0x01,
+  0x8a, 0x01, 0x8b, 0x01, 0x8b, 0x01, 0x8d, 0x01, 0x90, 0x01, 0x91, 0x01,
+  0x92, 0x01, 0x94, 0x01, 0x95, 0x01, 0x96, 0x01, 0x97, 0x01, 0x98, 0x01,
+  0x98, 0x01, 0x99, 0x01, 0x9b, 0x01, 0x9c, 0x01, 0x9c, 0x01, 0x9c, 0x01,
+  0x9c, 0x01, 0x9c, 0x01, 0x9c, 0x01, 0x9e, 0x01, 0x9e, 0x01, 0x9e, 0x01,
+  0x9e, 0x01, 0x9e, 0x01, 0x9e, 0x01, 0x9e, 0x01, 0x9e, 0x01, 0x9e, 0x01,
+  0x9f, 0x01, 0xa1, 0x01, 0xa1, 0x01, 0xa1, 0x01, 0xa2, 0x01, 0xa4, 0x01,
+  0xa4, 0x01, 0xa4, 0x01, 0xa5, 0x01, 0xa5, 0x01, 0xa5, 0x01, 0xa6, 0x01,
+  0xa6, 0x01, 0xa7, 0x01, 0xa8, 0x01, 0xa9, 0x01, 0xaa, 0x01, 0xab, 0x01,
+  0xab, 0x01, 0xac, 0x01, 0xac, 0x01, 0xad, 0x01, 0xad, 0x01, 0xad, 0x01,
+  0xae, 0x01, 0xae, 0x01, 0xae, 0x01, 0xae, 0x01, 0xaf, 0x01, 0xb0, 0x01,
+  0xb0, 0x01, 0xb0, 0x01, 0xb0, 0x01, 0xb3, 0x01, 0xb3, 0x01, 0xb3, 0x01,
+  0xb3, 0x01, 0xb4, 0x01, 0xb4, 0x01, 0xb5, 0x01, 0xb5, 0x01, 0xb5, 0x01,
+  0xb5, 0x01, 0xb5, 0x01, 0xb5, 0x01, 0xb6, 0x01, 0xb6, 0x01, 0xb8, 0x01,
+  0xba, 0x01, 0xba, 0x01, 0xba, 0x01, 0xbc, 0x01, 0xbd, 0x01, 0xbe, 0x01,
+  0xbe, 0x01, 0xbf, 0x01, 0xbf, 0x01, 0xbf, 0x01, 0xbf, 0x01, 0xc0, 0x01,
+  0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc1, 0x01, 0xc1, 0x01, 0xc1, 0x01,
+  0xc1, 0x01, 0xc1, 0x01, 0xc1, 0x01, 0xc1, 0x01, 0xc1, 0x01, 0xc1, 0x01,
+  0xc1, 0x01, 0xc1, 0x01, 0xc1, 0x01, 0xc1, 0x01, 0xc2, 0x01, 0xc3, 0x01,
+  0xc3, 0x01, 0xc3, 0x01, 0xc3, 0x01, 0xc4, 0x01, 0xc5, 0x01, 0xc5, 0x01,
+  0xc5, 0x01, 0xc5, 0x01, 0xc5, 0x01, 0xc5, 0x01, 0xc5, 0x01, 0xc7, 0x01,
+  0xc7, 0x01, 0xc7, 0x01, 0xc7, 0x01, 0xc7, 0x01, 0xc7, 0x01, 0xc7, 0x01,
+  0xc7, 0x01, 0xc8, 0x01, 0xc9, 0x01, 0xc9, 0x01, 0xc9, 0x01, 0xcb, 0x01,
+  0xcb, 0x01, 0xcb, 0x01, 0xcb, 0x01, 0xcc, 0x01, 0xcc, 0x01, 0xcc, 0x01,
+  0xcc, 0x01, 0xcd, 0x01, 0xce, 0x01, 0xce, 0x01, 0xce, 0x01, 0xce, 0x01,
+  0xce, 0x01, 0xce, 0x01, 0xce, 0x01, 0xce, 0x01, 0xce, 0x01, 0xcf, 0x01,
+  0xcf, 0x01, 0xcf, 0x01, 0xcf, 0x01, 0xd0, 0x01, 0xd0, 0x01, 0xd1, 0x01,
+  0xd1, 0x01, 0xd1, 0x01, 0xd1, 0x01, 0xd3, 0x01, 0xd3, 0x01, 0xd3, 0x01,
+  0xd3, 0x01, 0xd4, 0x01, 0xd4, 0x01, 0xd4, 0x01, 0xd4, 0x01, 0xd7, 0x01,
+  0xd7, 0x01, 0xd7, 0x01, 0xd7, 0x01, 0xd8, 0x01, 0xd8, 0x01, 0xd8, 0x01,
+  0xd8, 0x01, 0xd8, 0x01, 0xd8, 0x01, 0xd8, 0x01, 0xd8, 0x01, 0xda, 0x01,
+  0xda, 0x01, 0xdb, 0x01, 0xdb, 0x01, 0xdb, 0x01, 0xdb, 0x01, 0xdc, 0x01,
+  0xdc, 0x01, 0xdd, 0x01, 0xdd, 0x01, 0xdd, 0x01, 0xdd, 0x01, 0xde, 0x01,
+  0xde, 0x01, 0xde, 0x01, 0xde, 0x01, 0xde, 0x01, 0xde, 0x01, 0xdf, 0x01,
+  0xe0, 0x01, 0xe1, 0x01, 0xe1, 0x01, 0xe1, 0x01, 0xe1, 0x01, 0xe1, 0x01,
+  0xe1, 0x01, 0xe1, 0x01, 0xe1, 0x01, 0xe1, 0x01, 0xe1, 0x01, 0xe1, 0x01,
+  0xe1, 0x01, 0xe1, 0x01, 0xe2, 0x01, 0xe3, 0x01, 0xe3, 0x01, 0xe3, 0x01,
+  0xe4, 0x01, 0x00, 0x00, 0x17, 0x75, 0x32, 0x16, 0x47, 0x4d, 0xbb, 0xef,
+  0x67, 0xf2, 0xd3, 0x65, 0x3d, 0x13, 0xc2, 0x94, 0x42, 0x6e, 0x7e, 0x53,
+  0xc4, 0xc4, 0xc4, 0x42, 0xea, 0x78, 0xd1, 0x3c, 0x25, 0x91, 0xaf, 0x12,
+  0x13, 0xc8, 0x0b, 0x65, 0xd0, 0x91, 0xa9, 0xab, 0xae, 0xf5, 0x35, 0xbe,
+  0x85, 0x85, 0x0d, 0xe3, 0xa8, 0x17, 0x99, 0x30, 0x78, 0x90, 0x29, 0xf9,
+  0x85, 0xf3, 0x02, 0x2a, 0xa8, 0x40, 0x4c, 0xe3, 0x9a, 0x9f, 0x5f, 0x31,
+  0x26, 0x45, 0x0b, 0x03, 0x74, 0xb1, 0xa3, 0x6f, 0xdf, 0xca, 0x0c, 0xd7,
+  0x0b, 0x5f, 0xa1, 0xa1, 0xce, 0xc1, 0x5e, 0xff, 0x99, 0xd5, 0x21, 0x2c,
+  0x82, 0xc5, 0x5d, 0x8d, 0x51, 0x2f, 0x1d, 0xb3, 0x69, 0x2c, 0x6c, 0x9b,
+  0xb9, 0x9c, 0x13, 0x94, 0x84, 0xe6, 0x23, 0x0c, 0x45, 0xdd, 0x8e, 0x83,
+  0x89, 0xba, 0xfe, 0x95, 0x6b, 0x3f, 0x98, 0xa8, 0xfc, 0x3b, 0xc1, 0x7b,
+  0x13, 0xfa, 0xbb, 0xe5, 0x00, 0x40, 0x6e, 0xa1, 0xe6, 0x62, 0xa2, 0xe9,
+  0xad, 0x97, 0x35, 0x0b, 0xf1, 0x00, 0xd2, 0xef, 0xf7, 0xa7, 0x38, 0x81,
+  0x4f, 0xdf, 0x46, 0xdd, 0xf4, 0xa0, 0xe3, 0x65, 0x2d, 0xf4, 0x4a, 0x49,
+  0xe4, 0x05, 0x8c, 0x22, 0x66, 0xad, 0x66, 0x0e, 0x38, 0xce, 0x5d, 0xf8,
+  0x0f, 0x60, 0x1e, 0x6d, 0x93, 0xf0, 0x81, 0xa7, 0x32, 0x23, 0xca, 0x28,
+  0x2e, 0xb2, 0x99, 0xd4, 0xcc, 0x24, 0x31, 0xa2, 0x9f, 0x6c, 0x8c, 0x33,
+  0x5b, 0x44, 0x09, 0x82, 0x51, 0xd0, 0xc8, 0x75, 0xe0, 0x7a, 0x58, 0x8f,
+  0x19, 0x0e, 0xbb, 0xaa, 0xf7, 0xeb, 0x72, 0x69, 0xc5, 0xae, 0x60, 0xa4,
+  0x15, 0x5a, 0x49, 0x1d, 0x94, 0xc3, 0x94, 0x86, 0x78, 0x9a, 0xd1, 0xf6,
+  0xc4, 0xd9, 0x29, 0x40, 0x35, 0x06, 0xea, 0xa6, 0x2c, 0x3c, 0x7f, 0x83,
+  0x56, 0xb1, 0x30, 0x1d, 0x42, 0xf0, 0x66, 0xf4, 0xf1, 0x5c, 0x65, 0x6b,
+  0xd1, 0xcb, 0x5f, 0x2c, 0x4f, 0x9e, 0xdb, 0x56, 0x43, 0x43, 0xd3, 0x07,
+  0xef, 0xe9, 0xe6, 0x71, 0x6e, 0xfc, 0x93, 0x12, 0xca, 0x28, 0xb6, 0x40,
+  0xd8, 0x76, 0xda, 0x0f, 0x7b, 0x45, 0x85, 0xc0, 0x20, 0xea, 0xd9, 0x47,
+  0x85, 0x09, 0x66, 0x23, 0x16, 0x48, 0x27, 0x39, 0x6c, 0x0f, 0x68, 0x63,
+  0xf2, 0xb1, 0x85, 0x10, 0xe7, 0x0a, 0x9b, 0x64, 0x81, 0x39, 0xe2, 0x3d,
+  0xda, 0x74, 0x9c, 0x60, 0xbc, 0xd9, 0x4b, 0x00, 0x59, 0xb9, 0x74, 0x58,
+  0x1a, 0xba, 0xd5, 0xe7, 0x0e, 0xe2, 0xfe, 0xf8, 0xac, 0x81, 0x6a, 0x92,
+  0xba, 0xc9, 0xd4, 0x86, 0x8f, 0xab, 0x91, 0x64, 0x67, 0x3c, 0x47, 0xf8,
+  0xf2, 0x94, 0x65, 0x93, 0x88, 0x75, 0x81, 0xd6, 0x4f, 0xef, 0x70, 0x1b,
+  0xbf, 0xd0, 0xa4, 0xe0, 0x01, 0xf0, 0xd5, 0x07, 0x06, 0xba, 0xfb, 0x50,
+  0x7c, 0x50, 0xbb, 0x50, 0xba, 0x93, 0x64, 0x11, 0x1c, 0x4a, 0xb5, 0xf8,
+  0x10, 0x6e, 0x5b, 0xae, 0x12, 0xfd, 0xf3, 0xa1, 0xfe, 0x8a, 0x24, 0x74,
+  0xe7, 0x31, 0xc0, 0x10, 0x83, 0x41, 0x17, 0xf8, 0x61, 0x88, 0xce, 0xf3,
+  0xf1, 0xd0, 0x61, 0x1e, 0x95, 0x2b, 0xa5, 0x8a, 0x9d, 0x77, 0xcf, 0x80,
+  0x84, 0xee, 0x86, 0xb7, 0xc1, 0x82, 0x84, 0x6e, 0xb0, 0xd3, 0x9c, 0xec,
+  0xab, 0x5f, 0xd6, 0x4e, 0xce, 0xd7, 0x98, 0x05, 0x78, 0x40, 0xb5, 0x06,
+  0xf9, 0xda, 0x79, 0x1c, 0x79, 0x7e, 0x60, 0x88, 0xc5, 0x4b, 0x31, 0x4e,
+  0x1c, 0x84, 0xb8, 0x16, 0x34, 0x2a, 0xa5, 0x32, 0x92, 0x43, 0x53, 0x47,
+  0x87, 0x25, 0x92, 0x69, 0x11, 0x7b, 0xf1, 0x48, 0x00, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x1e, 0x00, 0x22, 0x00, 0x00, 0x00, 0x06, 0x00,
+  0x0c, 0x00, 0x11, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0c, 0x00, 0x19, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x0f, 0x00,
+  0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x11, 0x00,
+  0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00,
+  0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x06, 0x00, 0x10, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x05, 0x00, 0x0a, 0x00, 0x18, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x06, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x0c, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0c, 0x00,
+  0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00,
+  0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x06, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00,
+  0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00
+};
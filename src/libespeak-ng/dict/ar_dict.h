@@ -1,5 +1,7 @@
 #pragma once
-const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
+#include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/ar_dict_index.h>
+const unsigned char __espeakng_dict_ar[] __attribute__((aligned((4)))) = {
   0x00, 0x04, 0x00, 0x00, 0xd3, 0x3a, 0x07, 0x00, 0x0d, 0x43, 0xc2, 0x82,
   0x70, 0x49, 0x23, 0x0c, 0x3a, 0x28, 0x0c, 0x49, 0x00, 0x0b, 0x41, 0xe8,
   0x6e, 0x14, 0x23, 0x0c, 0x39, 0x32, 0x00, 0x31, 0x0e, 0x44, 0xaf, 0x6e,
@@ -39849,4 +39851,11 @@ const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
   0x00, 0xd9, 0x8f, 0xd9, 0x8a, 0x01, 0x11, 0x46, 0x11, 0x45, 0x00, 0x07,
   0x00
 };
-size_t __espeakng_dictlen = 478165;
+
+BackgroundAudioDictionary dict_ar = {
+    "ar",
+    478165,
+    __espeakng_dict_ar,
+    98008,
+    __espeakng_dictindex_ar
+};
@@ -0,0 +1,8171 @@
+#pragma once
+const unsigned char __espeakng_dictindex_ar[] __attribute__((aligned((4)))) = {
+  0x45, 0x44, 0x58, 0x31, 0xd5, 0x4b, 0x07, 0x00, 0xd3, 0x3a, 0x07, 0x00,
+  0xec, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x25, 0x00, 0x3b, 0x00, 0x60, 0x00,
+  0x74, 0x00, 0xb2, 0x00, 0xc2, 0x00, 0xd9, 0x00, 0xe7, 0x00, 0xfa, 0x00,
+  0x0f, 0x01, 0x26, 0x01, 0x46, 0x01, 0x60, 0x01, 0x84, 0x01, 0xac, 0x01,
+  0xd7, 0x01, 0x1f, 0x02, 0x5d, 0x02, 0x8b, 0x02, 0xb8, 0x02, 0xd9, 0x02,
+  0xf0, 0x02, 0x12, 0x03, 0x31, 0x03, 0x3f, 0x03, 0x56, 0x03, 0x7a, 0x03,
+  0x9c, 0x03, 0xc4, 0x03, 0xe7, 0x03, 0x19, 0x04, 0x43, 0x04, 0x70, 0x04,
+  0x94, 0x04, 0xad, 0x04, 0xd3, 0x04, 0xef, 0x04, 0x0c, 0x05, 0x29, 0x05,
+  0x4e, 0x05, 0x72, 0x05, 0x83, 0x05, 0x9c, 0x05, 0xc3, 0x05, 0xdf, 0x05,
+  0xf8, 0x05, 0x12, 0x06, 0x33, 0x06, 0x5f, 0x06, 0x7e, 0x06, 0x92, 0x06,
+  0xc4, 0x06, 0xe6, 0x06, 0x18, 0x07, 0x35, 0x07, 0x65, 0x07, 0x79, 0x07,
+  0x9e, 0x07, 0xb4, 0x07, 0xd9, 0x07, 0xf2, 0x07, 0x21, 0x08, 0x4a, 0x08,
+  0x6c, 0x08, 0x97, 0x08, 0xb9, 0x08, 0xd1, 0x08, 0xf0, 0x08, 0x04, 0x09,
+  0x25, 0x09, 0x3a, 0x09, 0x5a, 0x09, 0x6e, 0x09, 0x86, 0x09, 0xac, 0x09,
+  0xc7, 0x09, 0xf6, 0x09, 0x23, 0x0a, 0x49, 0x0a, 0x77, 0x0a, 0xab, 0x0a,
+  0xbd, 0x0a, 0xf4, 0x0a, 0x1f, 0x0b, 0x44, 0x0b, 0x70, 0x0b, 0x8b, 0x0b,
+  0xb2, 0x0b, 0xc4, 0x0b, 0xe1, 0x0b, 0xf6, 0x0b, 0x16, 0x0c, 0x27, 0x0c,
+  0x41, 0x0c, 0x5e, 0x0c, 0x8d, 0x0c, 0xaf, 0x0c, 0xe0, 0x0c, 0x02, 0x0d,
+  0x31, 0x0d, 0x57, 0x0d, 0x85, 0x0d, 0x98, 0x0d, 0xc3, 0x0d, 0xe7, 0x0d,
+  0x0a, 0x0e, 0x2a, 0x0e, 0x64, 0x0e, 0x8a, 0x0e, 0xbd, 0x0e, 0xda, 0x0e,
+  0x0e, 0x0f, 0x43, 0x0f, 0x7d, 0x0f, 0x9f, 0x0f, 0xd2, 0x0f, 0xfc, 0x0f,
+  0x34, 0x10, 0x56, 0x10, 0x95, 0x10, 0xb1, 0x10, 0xce, 0x10, 0xe2, 0x10,
+  0x0f, 0x11, 0x21, 0x11, 0x43, 0x11, 0x65, 0x11, 0x89, 0x11, 0xa8, 0x11,
+  0xd8, 0x11, 0x01, 0x12, 0x34, 0x12, 0x57, 0x12, 0x7b, 0x12, 0x93, 0x12,
+  0xce, 0x12, 0xee, 0x12, 0x0d, 0x13, 0x22, 0x13, 0x4a, 0x13, 0x6c, 0x13,
+  0xa1, 0x13, 0xcb, 0x13, 0xf0, 0x13, 0x1f, 0x14, 0x48, 0x14, 0x74, 0x14,
+  0xa0, 0x14, 0xda, 0x14, 0x0e, 0x15, 0x31, 0x15, 0x64, 0x15, 0x95, 0x15,
+  0xb4, 0x15, 0xd4, 0x15, 0xed, 0x15, 0xfb, 0x15, 0x1a, 0x16, 0x38, 0x16,
+  0x66, 0x16, 0x7e, 0x16, 0x99, 0x16, 0xae, 0x16, 0xd0, 0x16, 0xe8, 0x16,
+  0x07, 0x17, 0x1c, 0x17, 0x3d, 0x17, 0x4e, 0x17, 0x61, 0x17, 0x70, 0x17,
+  0x8d, 0x17, 0x9c, 0x17, 0xb0, 0x17, 0xc6, 0x17, 0xe1, 0x17, 0x08, 0x18,
+  0x2f, 0x18, 0x63, 0x18, 0x93, 0x18, 0xba, 0x18, 0xef, 0x18, 0x26, 0x19,
+  0x5d, 0x19, 0x81, 0x19, 0xac, 0x19, 0xcc, 0x19, 0xf4, 0x19, 0x10, 0x1a,
+  0x33, 0x1a, 0x55, 0x1a, 0x7b, 0x1a, 0x94, 0x1a, 0xb8, 0x1a, 0xc9, 0x1a,
+  0xe4, 0x1a, 0xf0, 0x1a, 0x0a, 0x1b, 0x14, 0x1b, 0x3f, 0x1b, 0x4f, 0x1b,
+  0x6e, 0x1b, 0x7d, 0x1b, 0x92, 0x1b, 0xa7, 0x1b, 0xb1, 0x1b, 0xd0, 0x1b,
+  0xe7, 0x1b, 0x02, 0x1c, 0x26, 0x1c, 0x64, 0x1c, 0x90, 0x1c, 0xc8, 0x1c,
+  0xfb, 0x1c, 0x28, 0x1d, 0x59, 0x1d, 0x76, 0x1d, 0xa0, 0x1d, 0xb2, 0x1d,
+  0xd2, 0x1d, 0xee, 0x1d, 0x04, 0x1e, 0x22, 0x1e, 0x42, 0x1e, 0x52, 0x1e,
+  0x61, 0x1e, 0x7d, 0x1e, 0xa2, 0x1e, 0xb3, 0x1e, 0xca, 0x1e, 0xd5, 0x1e,
+  0xfc, 0x1e, 0x03, 0x1f, 0x16, 0x1f, 0x1f, 0x1f, 0x2a, 0x1f, 0x3f, 0x1f,
+  0x46, 0x1f, 0x69, 0x1f, 0x90, 0x1f, 0xc1, 0x1f, 0xeb, 0x1f, 0x18, 0x20,
+  0x4f, 0x20, 0x7b, 0x20, 0x9d, 0x20, 0xc5, 0x20, 0x07, 0x21, 0x33, 0x21,
+  0x55, 0x21, 0x7b, 0x21, 0xb4, 0x21, 0xd5, 0x21, 0xf9, 0x21, 0x15, 0x22,
+  0x30, 0x22, 0x46, 0x22, 0x5d, 0x22, 0x84, 0x22, 0x9c, 0x22, 0xaf, 0x22,
+  0xcd, 0x22, 0xdb, 0x22, 0xf4, 0x22, 0xfe, 0x22, 0x0f, 0x23, 0x1f, 0x23,
+  0x25, 0x23, 0x36, 0x23, 0x47, 0x23, 0x6b, 0x23, 0x88, 0x23, 0xaa, 0x23,
+  0xd7, 0x23, 0x22, 0x24, 0x40, 0x24, 0x65, 0x24, 0x91, 0x24, 0xd2, 0x24,
+  0xf9, 0x24, 0x1c, 0x25, 0x54, 0x25, 0x83, 0x25, 0xb2, 0x25, 0xe9, 0x25,
+  0x03, 0x26, 0x37, 0x26, 0x63, 0x26, 0x87, 0x26, 0xa7, 0x26, 0xcd, 0x26,
+  0xe5, 0x26, 0xff, 0x26, 0x10, 0x27, 0x22, 0x27, 0x30, 0x27, 0x41, 0x27,
+  0x4a, 0x27, 0x5f, 0x27, 0x6a, 0x27, 0x78, 0x27, 0x85, 0x27, 0x9d, 0x27,
+  0xb8, 0x27, 0xdf, 0x27, 0x0b, 0x28, 0x4a, 0x28, 0x73, 0x28, 0xae, 0x28,
+  0xdc, 0x28, 0x1a, 0x29, 0x45, 0x29, 0x79, 0x29, 0xb7, 0x29, 0xf0, 0x29,
+  0x18, 0x2a, 0x35, 0x2a, 0x59, 0x2a, 0x81, 0x2a, 0xa3, 0x2a, 0xba, 0x2a,
+  0xd3, 0x2a, 0xee, 0x2a, 0xfa, 0x2a, 0x0d, 0x2b, 0x1a, 0x2b, 0x52, 0x2b,
+  0x5e, 0x2b, 0x6e, 0x2b, 0x71, 0x2b, 0x86, 0x2b, 0x97, 0x2b, 0xab, 0x2b,
+  0xbb, 0x2b, 0xd1, 0x2b, 0xfc, 0x2b, 0x26, 0x2c, 0x53, 0x2c, 0xa0, 0x2c,
+  0xdd, 0x2c, 0x14, 0x2d, 0x52, 0x2d, 0x84, 0x2d, 0xcd, 0x2d, 0xef, 0x2d,
+  0x38, 0x2e, 0x57, 0x2e, 0x7b, 0x2e, 0x99, 0x2e, 0xb1, 0x2e, 0xd3, 0x2e,
+  0xf3, 0x2e, 0x00, 0x2f, 0x17, 0x2f, 0x3f, 0x2f, 0x54, 0x2f, 0x6c, 0x2f,
+  0x7f, 0x2f, 0x95, 0x2f, 0x9e, 0x2f, 0xb5, 0x2f, 0xc0, 0x2f, 0xd2, 0x2f,
+  0xd9, 0x2f, 0xee, 0x2f, 0xfe, 0x2f, 0x1e, 0x30, 0x3c, 0x30, 0x60, 0x30,
+  0x98, 0x30, 0xc7, 0x30, 0xfb, 0x30, 0x3b, 0x31, 0x73, 0x31, 0xc7, 0x31,
+  0xfd, 0x31, 0x25, 0x32, 0x55, 0x32, 0x89, 0x32, 0xa6, 0x32, 0xe8, 0x32,
+  0x0d, 0x33, 0x31, 0x33, 0x4d, 0x33, 0x66, 0x33, 0x8c, 0x33, 0xb2, 0x33,
+  0xca, 0x33, 0xf5, 0x33, 0x0b, 0x34, 0x30, 0x34, 0x3a, 0x34, 0x4f, 0x34,
+  0x5a, 0x34, 0x6b, 0x34, 0x7e, 0x34, 0x83, 0x34, 0x9e, 0x34, 0xb5, 0x34,
+  0xd0, 0x34, 0xea, 0x34, 0x14, 0x35, 0x4e, 0x35, 0x7f, 0x35, 0xae, 0x35,
+  0xd6, 0x35, 0x01, 0x36, 0x23, 0x36, 0x43, 0x36, 0x60, 0x36, 0x7b, 0x36,
+  0x9a, 0x36, 0xcb, 0x36, 0xe8, 0x36, 0x0c, 0x37, 0x33, 0x37, 0x4e, 0x37,
+  0x63, 0x37, 0x8e, 0x37, 0xa0, 0x37, 0xc6, 0x37, 0xdb, 0x37, 0xf5, 0x37,
+  0xfb, 0x37, 0x10, 0x38, 0x16, 0x38, 0x24, 0x38, 0x35, 0x38, 0x3d, 0x38,
+  0x57, 0x38, 0x63, 0x38, 0x7b, 0x38, 0x97, 0x38, 0xab, 0x38, 0xd2, 0x38,
+  0xf9, 0x38, 0x17, 0x39, 0x3a, 0x39, 0x65, 0x39, 0x84, 0x39, 0xb4, 0x39,
+  0xc5, 0x39, 0xe0, 0x39, 0x02, 0x3a, 0x19, 0x3a, 0x44, 0x3a, 0x59, 0x3a,
+  0x77, 0x3a, 0x8a, 0x3a, 0xa5, 0x3a, 0xbe, 0x3a, 0xd5, 0x3a, 0xe9, 0x3a,
+  0xf2, 0x3a, 0x15, 0x3b, 0x25, 0x3b, 0x34, 0x3b, 0x3c, 0x3b, 0x4b, 0x3b,
+  0x57, 0x3b, 0x5d, 0x3b, 0x71, 0x3b, 0x8c, 0x3b, 0xa1, 0x3b, 0xd4, 0x3b,
+  0xf6, 0x3b, 0x30, 0x3c, 0x5d, 0x3c, 0x8a, 0x3c, 0xa8, 0x3c, 0xcf, 0x3c,
+  0xdf, 0x3c, 0x0f, 0x3d, 0x1b, 0x3d, 0x35, 0x3d, 0x53, 0x3d, 0x70, 0x3d,
+  0x84, 0x3d, 0x9e, 0x3d, 0xb0, 0x3d, 0xcb, 0x3d, 0xdf, 0x3d, 0xfc, 0x3d,
+  0x10, 0x3e, 0x25, 0x3e, 0x35, 0x3e, 0x5e, 0x3e, 0x69, 0x3e, 0x7b, 0x3e,
+  0x82, 0x3e, 0x8d, 0x3e, 0x9b, 0x3e, 0xa7, 0x3e, 0xbe, 0x3e, 0xd2, 0x3e,
+  0xe8, 0x3e, 0x12, 0x3f, 0x35, 0x3f, 0x77, 0x3f, 0xa0, 0x3f, 0xc4, 0x3f,
+  0xe9, 0x3f, 0x18, 0x40, 0x36, 0x40, 0x59, 0x40, 0x66, 0x40, 0x8a, 0x40,
+  0xac, 0x40, 0xc1, 0x40, 0xe4, 0x40, 0xf6, 0x40, 0x0d, 0x41, 0x34, 0x41,
+  0x41, 0x41, 0x5d, 0x41, 0x6c, 0x41, 0x7c, 0x41, 0x82, 0x41, 0x9a, 0x41,
+  0xa1, 0x41, 0xb5, 0x41, 0xc6, 0x41, 0xe3, 0x41, 0xf3, 0x41, 0x05, 0x42,
+  0x1e, 0x42, 0x39, 0x42, 0x41, 0x42, 0x61, 0x42, 0x86, 0x42, 0x99, 0x42,
+  0xd2, 0x42, 0xf4, 0x42, 0x54, 0x43, 0x70, 0x43, 0x9d, 0x43, 0xbf, 0x43,
+  0xda, 0x43, 0xf3, 0x43, 0x12, 0x44, 0x2e, 0x44, 0x4e, 0x44, 0x6c, 0x44,
+  0x85, 0x44, 0x94, 0x44, 0xb7, 0x44, 0xc9, 0x44, 0xdf, 0x44, 0xea, 0x44,
+  0x2d, 0x45, 0x39, 0x45, 0x54, 0x45, 0x68, 0x45, 0x75, 0x45, 0x8b, 0x45,
+  0x9d, 0x45, 0xaf, 0x45, 0xc5, 0x45, 0xd5, 0x45, 0xda, 0x45, 0xf4, 0x45,
+  0x10, 0x46, 0x26, 0x46, 0x53, 0x46, 0x65, 0x46, 0x9d, 0x46, 0xbc, 0x46,
+  0xe4, 0x46, 0x10, 0x47, 0x34, 0x47, 0x5a, 0x47, 0x72, 0x47, 0x85, 0x47,
+  0xab, 0x47, 0xb9, 0x47, 0xc9, 0x47, 0xd2, 0x47, 0xe1, 0x47, 0xeb, 0x47,
+  0x07, 0x48, 0x13, 0x48, 0x3c, 0x48, 0x48, 0x48, 0x5c, 0x48, 0x6a, 0x48,
+  0x78, 0x48, 0x8d, 0x48, 0x94, 0x48, 0xaf, 0x48, 0xc6, 0x48, 0xd4, 0x48,
+  0xdd, 0x48, 0xf8, 0x48, 0x0e, 0x49, 0x26, 0x49, 0x46, 0x49, 0x57, 0x49,
+  0x9d, 0x49, 0xb6, 0x49, 0xd3, 0x49, 0xf8, 0x49, 0x09, 0x4a, 0x26, 0x4a,
+  0x4e, 0x4a, 0x67, 0x4a, 0x7d, 0x4a, 0x8b, 0x4a, 0x96, 0x4a, 0xa4, 0x4a,
+  0xb5, 0x4a, 0xc0, 0x4a, 0xd4, 0x4a, 0xe3, 0x4a, 0x19, 0x4b, 0x21, 0x4b,
+  0x37, 0x4b, 0x49, 0x4b, 0x6b, 0x4b, 0x80, 0x4b, 0x8c, 0x4b, 0xb2, 0x4b,
+  0xc7, 0x4b, 0xea, 0x4b, 0xf3, 0x4b, 0x0d, 0x4c, 0x28, 0x4c, 0x4c, 0x4c,
+  0x6e, 0x4c, 0x89, 0x4c, 0xb6, 0x4c, 0xd6, 0x4c, 0xf2, 0x4c, 0x0f, 0x4d,
+  0x2b, 0x4d, 0x45, 0x4d, 0x7b, 0x4d, 0x96, 0x4d, 0xbe, 0x4d, 0xd1, 0x4d,
+  0xe0, 0x4d, 0xed, 0x4d, 0xf6, 0x4d, 0xf9, 0x4d, 0x0d, 0x4e, 0x16, 0x4e,
+  0x34, 0x4e, 0x37, 0x4e, 0x4a, 0x4e, 0x5a, 0x4e, 0x67, 0x4e, 0x8b, 0x4e,
+  0x94, 0x4e, 0xa6, 0x4e, 0xb0, 0x4e, 0xc0, 0x4e, 0xcb, 0x4e, 0xe6, 0x4e,
+  0xfe, 0x4e, 0x2a, 0x4f, 0x62, 0x4f, 0x87, 0x4f, 0xca, 0x4f, 0xf5, 0x4f,
+  0x1b, 0x50, 0x3f, 0x50, 0x62, 0x50, 0x80, 0x50, 0xa7, 0x50, 0xce, 0x50,
+  0xed, 0x50, 0x01, 0x51, 0x18, 0x51, 0x31, 0x51, 0x41, 0x51, 0x4f, 0x51,
+  0x67, 0x51, 0x76, 0x51, 0x9d, 0x51, 0xa7, 0x51, 0xb6, 0x51, 0xc5, 0x51,
+  0xd4, 0x51, 0xe6, 0x51, 0xf3, 0x51, 0x02, 0x52, 0x0d, 0x52, 0x21, 0x52,
+  0x29, 0x52, 0x52, 0x52, 0x6c, 0x52, 0x90, 0x52, 0xc1, 0x52, 0xed, 0x52,
+  0x25, 0x53, 0x53, 0x53, 0x84, 0x53, 0xa3, 0x53, 0xd7, 0x53, 0x0a, 0x54,
+  0x2c, 0x54, 0x49, 0x54, 0x6c, 0x54, 0x7b, 0x54, 0x9c, 0x54, 0xaa, 0x54,
+  0xb9, 0x54, 0xc5, 0x54, 0xd9, 0x54, 0xea, 0x54, 0x12, 0x55, 0x27, 0x55,
+  0x3f, 0x55, 0x51, 0x55, 0x5d, 0x55, 0x7d, 0x55, 0x89, 0x55, 0xa7, 0x55,
+  0xbf, 0x55, 0xda, 0x55, 0xf0, 0x55, 0x21, 0x56, 0x4a, 0x56, 0x7e, 0x56,
+  0xb6, 0x56, 0xe1, 0x56, 0x19, 0x57, 0x54, 0x57, 0x7e, 0x57, 0xae, 0x57,
+  0xd7, 0x57, 0xf5, 0x57, 0x22, 0x58, 0x44, 0x58, 0x61, 0x58, 0x78, 0x58,
+  0x89, 0x58, 0xa4, 0x58, 0xc6, 0x58, 0xd6, 0x58, 0xfb, 0x58, 0x11, 0x59,
+  0x2c, 0x59, 0x38, 0x59, 0x4b, 0x59, 0x5e, 0x59, 0x89, 0x59, 0xaf, 0x59,
+  0xc5, 0x59, 0xe5, 0x59, 0xf5, 0x59, 0x14, 0x5a, 0x1e, 0x5a, 0x46, 0x5a,
+  0x64, 0x5a, 0x9a, 0x5a, 0xd8, 0x5a, 0x0d, 0x5b, 0x4e, 0x5b, 0x8a, 0x5b,
+  0xc6, 0x5b, 0xfd, 0x5b, 0x38, 0x5c, 0x52, 0x5c, 0x84, 0x5c, 0xb2, 0x5c,
+  0xd7, 0x5c, 0xf3, 0x5c, 0x14, 0x5d, 0x34, 0x5d, 0x48, 0x5d, 0x64, 0x5d,
+  0x85, 0x5d, 0x9a, 0x5d, 0xb9, 0x5d, 0xca, 0x5d, 0xe1, 0x5d, 0xf4, 0x5d,
+  0x22, 0x5e, 0x31, 0x5e, 0x5d, 0x5e, 0x72, 0x5e, 0x91, 0x5e, 0x9e, 0x5e,
+  0xb9, 0x5e, 0xcf, 0x5e, 0xf3, 0x5e, 0x2f, 0x5f, 0x54, 0x5f, 0x9c, 0x5f,
+  0xcc, 0x5f, 0x0a, 0x60, 0x40, 0x60, 0x71, 0x60, 0x8d, 0x60, 0xc8, 0x60,
+  0xe6, 0x60, 0x0b, 0x61, 0x2a, 0x61, 0x50, 0x61, 0x67, 0x61, 0x90, 0x61,
+  0xa4, 0x61, 0xcd, 0x61, 0xe7, 0x61, 0x27, 0x62, 0x37, 0x62, 0x52, 0x62,
+  0x5f, 0x62, 0x7e, 0x62, 0x98, 0x62, 0xb9, 0x62, 0xda, 0x62, 0xef, 0x62,
+  0x06, 0x63, 0x1e, 0x63, 0x3c, 0x63, 0x5a, 0x63, 0x74, 0x63, 0x96, 0x63,
+  0xb2, 0x63, 0xdd, 0x63, 0xf9, 0x63, 0x29, 0x64, 0x55, 0x64, 0x8d, 0x64,
+  0xbb, 0x64, 0xe2, 0x64, 0x09, 0x65, 0x2f, 0x65, 0x46, 0x65, 0x64, 0x65,
+  0x7f, 0x65, 0x8c, 0x65, 0x9e, 0x65, 0xb6, 0x65, 0xcc, 0x65, 0xfa, 0x65,
+  0x02, 0x66, 0x1c, 0x66, 0x2a, 0x66, 0x3f, 0x66, 0x4f, 0x66, 0x5e, 0x66,
+  0x76, 0x66, 0x80, 0x66, 0x9d, 0x66, 0xa7, 0x66, 0xcf, 0x66, 0xe3, 0x66,
+  0xfd, 0x66, 0x28, 0x67, 0x4b, 0x67, 0x81, 0x67, 0x9e, 0x67, 0xbf, 0x67,
+  0xda, 0x67, 0xf4, 0x67, 0x08, 0x68, 0x30, 0x68, 0x48, 0x68, 0x69, 0x68,
+  0x85, 0x68, 0x97, 0x68, 0xb0, 0x68, 0xbd, 0x68, 0xc8, 0x68, 0xe5, 0x68,
+  0xf0, 0x68, 0x37, 0x69, 0x3c, 0x69, 0x55, 0x69, 0x67, 0x69, 0x79, 0x69,
+  0x8d, 0x69, 0x9b, 0x69, 0xab, 0x69, 0xb7, 0x69, 0xc6, 0x69, 0xd3, 0x69,
+  0xec, 0x69, 0x00, 0x6a, 0x16, 0x6a, 0x3b, 0x6a, 0x65, 0x6a, 0xa9, 0x6a,
+  0xce, 0x6a, 0xf5, 0x6a, 0x08, 0x6b, 0x32, 0x6b, 0x52, 0x6b, 0x7d, 0x6b,
+  0x9a, 0x6b, 0xb4, 0x6b, 0xee, 0x6b, 0x04, 0x6c, 0x25, 0x6c, 0x2f, 0x6c,
+  0x3f, 0x6c, 0x4f, 0x6c, 0x5b, 0x6c, 0x94, 0x6c, 0x9d, 0x6c, 0xb1, 0x6c,
+  0xbc, 0x6c, 0xe1, 0x6c, 0xfa, 0x6c, 0x0b, 0x6d, 0x2c, 0x6d, 0x43, 0x6d,
+  0x56, 0x6d, 0x5f, 0x6d, 0x7a, 0x6d, 0x8b, 0x6d, 0xb4, 0x6d, 0xf7, 0x6d,
+  0x51, 0x6e, 0x8e, 0x6e, 0xcf, 0x6e, 0x0f, 0x6f, 0x59, 0x6f, 0x87, 0x6f,
+  0xbe, 0x6f, 0xe5, 0x6f, 0x05, 0x70, 0x28, 0x70, 0x52, 0x70, 0x66, 0x70,
+  0x84, 0x70, 0x9f, 0x70, 0xb2, 0x70, 0xc7, 0x70, 0xd8, 0x70, 0x01, 0x71,
+  0x0e, 0x71, 0x27, 0x71, 0x33, 0x71, 0x45, 0x71, 0x56, 0x71, 0x62, 0x71,
+  0x7b, 0x71, 0x87, 0x71, 0x96, 0x71, 0xb8, 0x71, 0xca, 0x71, 0x06, 0x72,
+  0x31, 0x72, 0x79, 0x72, 0xe2, 0x72, 0x21, 0x73, 0x51, 0x73, 0x86, 0x73,
+  0xc2, 0x73, 0xf7, 0x73, 0x22, 0x74, 0x4f, 0x74, 0x7d, 0x74, 0xad, 0x74,
+  0xc3, 0x74, 0xdd, 0x74, 0xef, 0x74, 0x08, 0x75, 0x13, 0x75, 0x38, 0x75,
+  0x45, 0x75, 0x74, 0x75, 0x7d, 0x75, 0x90, 0x75, 0x94, 0x75, 0xa7, 0x75,
+  0xbc, 0x75, 0xc7, 0x75, 0xd5, 0x75, 0xed, 0x75, 0x01, 0x76, 0x16, 0x76,
+  0x27, 0x76, 0x51, 0x76, 0x75, 0x76, 0xaa, 0x76, 0xe4, 0x76, 0x21, 0x77,
+  0x55, 0x77, 0x78, 0x77, 0xa6, 0x77, 0xcd, 0x77, 0xec, 0x77, 0x0f, 0x78,
+  0x2e, 0x78, 0x60, 0x78, 0x83, 0x78, 0xa0, 0x78, 0xb7, 0x78, 0xe8, 0x78,
+  0x02, 0x79, 0x2a, 0x79, 0x37, 0x79, 0x73, 0x79, 0x7f, 0x79, 0x99, 0x79,
+  0xab, 0x79, 0xba, 0x79, 0xc9, 0x79, 0xd0, 0x79, 0xde, 0x79, 0xea, 0x79,
+  0xf9, 0x79, 0x03, 0x7a, 0x0c, 0x7a, 0x24, 0x7a, 0x4e, 0x7a, 0x89, 0x7a,
+  0xba, 0x7a, 0xf2, 0x7a, 0x30, 0x7b, 0x75, 0x7b, 0xbb, 0x7b, 0xf2, 0x7b,
+  0x25, 0x7c, 0x44, 0x7c, 0x68, 0x7c, 0x91, 0x7c, 0xb2, 0x7c, 0xdb, 0x7c,
+  0xec, 0x7c, 0x00, 0x00, 0x71, 0xc0, 0x6f, 0x3b, 0x6c, 0xf2, 0x04, 0x35,
+  0x0e, 0x4c, 0xa9, 0x6f, 0x54, 0x39, 0xbd, 0x88, 0x68, 0xc8, 0x04, 0x8d,
+  0x40, 0xfa, 0x0a, 0x02, 0x91, 0x82, 0xc8, 0xa6, 0x9e, 0x87, 0x54, 0xf0,
+  0x07, 0x3e, 0xe6, 0xd0, 0xd5, 0x8c, 0x02, 0x63, 0x6a, 0x05, 0xb2, 0xd9,
+  0x8a, 0xe7, 0x82, 0x8d, 0xf3, 0x56, 0x13, 0xd9, 0xc6, 0x57, 0x49, 0x5a,
+  0x72, 0x98, 0x08, 0x31, 0x3e, 0xc6, 0x70, 0x35, 0x0b, 0xda, 0xac, 0xd5,
+  0x4f, 0x94, 0xfa, 0x40, 0x43, 0x5c, 0xd4, 0xc2, 0xdf, 0x54, 0x21, 0x56,
+  0x0c, 0xe7, 0x71, 0xe3, 0xba, 0x5c, 0x6d, 0x5f, 0xe3, 0x13, 0xf0, 0xa0,
+  0x07, 0xb8, 0x49, 0x12, 0xaf, 0xe0, 0x0d, 0x35, 0x50, 0xe9, 0x8f, 0x54,
+  0xc6, 0x06, 0xfd, 0x56, 0xac, 0x68, 0x67, 0x13, 0xcc, 0x09, 0x8f, 0x0e,
+  0x55, 0xb0, 0xbb, 0x3d, 0x66, 0x8a, 0x27, 0x0f, 0xc6, 0xf0, 0xb6, 0x4a,
+  0x15, 0x26, 0x24, 0x69, 0x09, 0x32, 0x36, 0x1e, 0x6d, 0xbf, 0xa3, 0x8a,
+  0x45, 0x90, 0xe8, 0x1f, 0xb6, 0x6e, 0xbc, 0x5f, 0x4b, 0x8e, 0xb8, 0xd3,
+  0x32, 0x7e, 0xe4, 0x33, 0xc2, 0x2b, 0xd3, 0x2d, 0x81, 0x7c, 0x41, 0x64,
+  0x3e, 0xa4, 0x96, 0xaa, 0xbc, 0xdc, 0xce, 0xe0, 0x4f, 0x4d, 0x5e, 0x35,
+  0xe6, 0xa9, 0x52, 0x28, 0x44, 0xa3, 0x10, 0x7c, 0xfd, 0xc2, 0x35, 0x3c,
+  0x84, 0x3f, 0x6c, 0x7a, 0xd9, 0x95, 0xda, 0x1f, 0xe9, 0x19, 0x4e, 0x82,
+  0x53, 0x3a, 0x28, 0x5d, 0x6c, 0x6c, 0x6a, 0xa4, 0xfe, 0x84, 0xc0, 0x53,
+  0x1d, 0x8e, 0x02, 0x8c, 0x36, 0x27, 0xf9, 0xe2, 0x49, 0x4a, 0x14, 0x5a,
+  0xcc, 0x57, 0xb0, 0x67, 0xe0, 0x42, 0xf0, 0x40, 0x9f, 0x11, 0xde, 0x1d,
+  0x15, 0xc5, 0x62, 0x5d, 0x98, 0x76, 0x95, 0xaf, 0x06, 0x78, 0xfd, 0x1f,
+  0x2d, 0x85, 0xe5, 0xac, 0x8b, 0xb2, 0xd0, 0x19, 0x66, 0xb9, 0xf8, 0x13,
+  0x36, 0xc8, 0xe5, 0x79, 0x6e, 0x52, 0xb0, 0x7b, 0x0a, 0x96, 0xb8, 0x3d,
+  0x15, 0xf7, 0x1c, 0x6b, 0x0b, 0xa3, 0xa7, 0xb4, 0x75, 0xfa, 0x36, 0xfc,
+  0x0a, 0x7b, 0x64, 0x1b, 0xd5, 0xec, 0xd7, 0x04, 0xb7, 0x6b, 0x50, 0xd3,
+  0x1d, 0x0c, 0x66, 0x2a, 0xa4, 0xc7, 0x7d, 0xda, 0x5f, 0x5e, 0x05, 0xb7,
+  0x2f, 0xd9, 0xe8, 0x82, 0x3d, 0x8e, 0xc6, 0xda, 0x2c, 0x1d, 0x27, 0x91,
+  0x90, 0xd6, 0x99, 0x42, 0xb5, 0x5f, 0x36, 0x1b, 0xff, 0x0d, 0xef, 0x94,
+  0xd1, 0x08, 0xb9, 0x14, 0x34, 0xec, 0x6b, 0xa1, 0x23, 0x84, 0xd0, 0xf9,
+  0xf9, 0x08, 0x1d, 0xfe, 0x0d, 0xc0, 0x87, 0xf9, 0x0d, 0x04, 0xf1, 0x0b,
+  0x39, 0xc2, 0x05, 0x63, 0x70, 0xd7, 0xea, 0xe7, 0xe2, 0x48, 0x0d, 0xba,
+  0x01, 0x1f, 0x5a, 0xe9, 0xe7, 0x28, 0x43, 0xb6, 0x8f, 0x53, 0x02, 0x9f,
+  0x96, 0x26, 0xe2, 0x44, 0xbd, 0x85, 0x52, 0xe2, 0xa9, 0x9f, 0x90, 0xcb,
+  0x99, 0x76, 0x00, 0x6c, 0xb7, 0xfc, 0x37, 0x7b, 0xca, 0x49, 0x16, 0x14,
+  0x21, 0xe4, 0x0b, 0xdb, 0xd1, 0x35, 0x7b, 0x16, 0x08, 0xdd, 0x10, 0xb8,
+  0x2b, 0x05, 0x7a, 0x9a, 0xcb, 0x5f, 0xac, 0x02, 0xd2, 0x0e, 0x48, 0x9d,
+  0x19, 0x86, 0x8c, 0x80, 0x24, 0x7c, 0x09, 0x88, 0xac, 0xb8, 0xeb, 0xf9,
+  0xc8, 0x9b, 0xed, 0xe0, 0x52, 0xa0, 0xdf, 0xfe, 0x8f, 0xf4, 0x9c, 0x0c,
+  0x0b, 0x09, 0x22, 0x65, 0x5f, 0xcd, 0x54, 0x75, 0x21, 0xbd, 0x26, 0xe0,
+  0x99, 0x29, 0x0a, 0x46, 0x59, 0x19, 0xa6, 0x17, 0xa5, 0x8f, 0x16, 0xf0,
+  0x23, 0xeb, 0x4b, 0xaa, 0x1c, 0x1f, 0x99, 0x19, 0x8a, 0x1e, 0xdc, 0xe4,
+  0x6e, 0x91, 0x08, 0xd9, 0xe4, 0xbb, 0x6d, 0x56, 0x70, 0x09, 0x0b, 0x37,
+  0x53, 0x89, 0x56, 0x70, 0x09, 0xf9, 0xa6, 0xdd, 0x6b, 0x1b, 0x9d, 0xd4,
+  0x14, 0xf8, 0x48, 0xe9, 0xc1, 0xa3, 0xf1, 0x6d, 0xab, 0x98, 0xc3, 0x4a,
+  0x3a, 0x69, 0xb9, 0x53, 0x47, 0x61, 0x85, 0xc3, 0xae, 0x0f, 0xcf, 0xd0,
+  0x16, 0xc1, 0x55, 0x28, 0x2e, 0xf2, 0x64, 0x21, 0xdf, 0x77, 0x35, 0x21,
+  0x47, 0xf4, 0xda, 0x3c, 0x39, 0xb2, 0x4c, 0x29, 0x83, 0xf9, 0x77, 0x71,
+  0x53, 0x9b, 0x81, 0xad, 0xf9, 0x8e, 0x72, 0x1b, 0xb5, 0xca, 0xf0, 0xc5,
+  0xb4, 0xdf, 0x8d, 0xa2, 0xe8, 0xc6, 0x9a, 0x07, 0x89, 0xb3, 0xa4, 0xa9,
+  0xa2, 0xa5, 0x78, 0xaa, 0xbd, 0x75, 0x38, 0x50, 0x5e, 0x11, 0x95, 0x85,
+  0x38, 0x96, 0x47, 0x80, 0x3d, 0xd4, 0xdc, 0x75, 0xe4, 0x48, 0xaa, 0x56,
+  0x2f, 0x35, 0x81, 0xd7, 0x22, 0x2c, 0x3c, 0x68, 0x96, 0x49, 0xb3, 0x50,
+  0x3f, 0x68, 0xe9, 0x7a, 0x9a, 0x68, 0x47, 0x88, 0xc1, 0x83, 0x0a, 0x92,
+  0xb4, 0xef, 0x68, 0x82, 0xd9, 0x2d, 0xb6, 0x4b, 0xd5, 0x7a, 0xff, 0x70,
+  0x6f, 0x07, 0x67, 0x54, 0x28, 0xca, 0xbc, 0xf6, 0xa8, 0x30, 0xa3, 0x1e,
+  0x42, 0x8e, 0xaf, 0x80, 0x46, 0xbf, 0x97, 0xce, 0x70, 0x48, 0x64, 0x2c,
+  0x56, 0xe8, 0xed, 0xb0, 0x69, 0x17, 0x73, 0xd6, 0x9f, 0x12, 0x7e, 0xf3,
+  0x49, 0x40, 0x73, 0xd4, 0x9e, 0x9a, 0xb8, 0x96, 0x59, 0x61, 0xa0, 0xc5,
+  0x83, 0x5b, 0x7c, 0x92, 0x65, 0x7e, 0x42, 0x85, 0xac, 0x69, 0x0f, 0x60,
+  0xba, 0xfa, 0xc6, 0x0e, 0x7f, 0x0e, 0x4e, 0x9b, 0xdd, 0xe6, 0xd8, 0xc5,
+  0x88, 0xbd, 0x12, 0x0c, 0x2d, 0xe3, 0x45, 0x55, 0x02, 0xb3, 0x6c, 0x26,
+  0x5e, 0xa5, 0xfa, 0x40, 0x1e, 0x18, 0xfc, 0xb0, 0xf4, 0x86, 0xad, 0x78,
+  0x52, 0xcb, 0x40, 0x1f, 0xf2, 0x62, 0x50, 0xd5, 0x9f, 0x5b, 0x60, 0x3e,
+  0x5f, 0x06, 0x7c, 0x71, 0x80, 0x5d, 0xde, 0x1a, 0x8b, 0x36, 0x10, 0xd0,
+  0x40, 0xd9, 0xd9, 0xce, 0xa2, 0xc5, 0x26, 0x32, 0xd7, 0xc9, 0x9e, 0xbb,
+  0x4c, 0x51, 0x2a, 0x69, 0x47, 0x48, 0x96, 0x98, 0x2b, 0x47, 0xae, 0x00,
+  0xe1, 0xaf, 0x73, 0x15, 0x36, 0xe0, 0x4c, 0x33, 0x5b, 0xa7, 0x49, 0x09,
+  0x73, 0xc6, 0x13, 0xd4, 0xac, 0xd8, 0x59, 0xe7, 0x5c, 0x9c, 0xa2, 0x1c,
+  0x27, 0x99, 0x2c, 0x4e, 0x1a, 0x6d, 0x4a, 0xd3, 0x4c, 0xca, 0xb7, 0x65,
+  0x47, 0x2d, 0x48, 0x57, 0x78, 0x4a, 0x53, 0xc3, 0x2a, 0x15, 0xe1, 0xf8,
+  0x17, 0xc5, 0xe5, 0xce, 0x4a, 0x76, 0xc6, 0x3b, 0xe3, 0xd9, 0xdf, 0x0b,
+  0xa6, 0x51, 0x03, 0xc9, 0x09, 0x20, 0xe1, 0xd2, 0xe6, 0xd3, 0xc7, 0x95,
+  0x13, 0xde, 0x66, 0x4a, 0xc0, 0x06, 0x23, 0x36, 0xde, 0x45, 0x51, 0xcf,
+  0x16, 0x20, 0xa1, 0x11, 0x54, 0xc0, 0x48, 0xa4, 0x12, 0x4b, 0x99, 0x5f,
+  0x0c, 0x48, 0xa3, 0x00, 0x4e, 0x5e, 0x49, 0x46, 0x5c, 0x8f, 0xe2, 0x2b,
+  0x6c, 0x3d, 0xa7, 0x39, 0x86, 0x78, 0xdc, 0xe0, 0xfb, 0x6e, 0xc4, 0x24,
+  0xb5, 0xe5, 0x25, 0xcf, 0xf3, 0x35, 0xe0, 0xe2, 0x1b, 0x24, 0x56, 0x9d,
+  0xe9, 0xa1, 0x8e, 0x18, 0x82, 0xb6, 0xdb, 0x13, 0x85, 0x8f, 0x31, 0xea,
+  0x26, 0x8d, 0xb1, 0x50, 0x0a, 0xdd, 0x18, 0x66, 0x95, 0x88, 0x20, 0xec,
+  0xff, 0x44, 0x4a, 0xb7, 0xcd, 0x27, 0x9e, 0x36, 0x2a, 0x88, 0x51, 0x53,
+  0xc8, 0x3c, 0x9b, 0xad, 0x7b, 0x19, 0xcc, 0xed, 0xfe, 0xb7, 0xbc, 0x64,
+  0xe7, 0xad, 0x45, 0x7d, 0x38, 0x39, 0xef, 0x9f, 0x9f, 0x0b, 0x17, 0xe5,
+  0xff, 0x72, 0xeb, 0x0d, 0x70, 0xc0, 0xb8, 0x3f, 0x5f, 0x8f, 0x06, 0x44,
+  0x8e, 0x3f, 0xea, 0x07, 0x6f, 0x38, 0x56, 0x62, 0x50, 0x91, 0xae, 0xb3,
+  0x2c, 0x4a, 0x71, 0x3d, 0xbf, 0x87, 0x7f, 0x10, 0xb1, 0xe1, 0xc9, 0x7c,
+  0x58, 0x67, 0xdb, 0xf4, 0x91, 0xf8, 0x4e, 0xf0, 0xaa, 0x35, 0xc9, 0x76,
+  0x16, 0x28, 0x39, 0xfe, 0x94, 0xb5, 0x32, 0x17, 0x5f, 0x1d, 0x74, 0x63,
+  0xf7, 0xff, 0x29, 0xb9, 0x52, 0xa0, 0x12, 0xfd, 0xed, 0xe1, 0x4a, 0x51,
+  0x79, 0x8e, 0xf9, 0x5f, 0x3b, 0x4c, 0x40, 0x73, 0xed, 0xa8, 0x48, 0xf2,
+  0xf9, 0x7b, 0x84, 0xc1, 0xf6, 0x25, 0xf3, 0x34, 0xa0, 0x84, 0xe7, 0xe4,
+  0xf2, 0xfc, 0x66, 0x2f, 0x2f, 0x20, 0x04, 0xa6, 0xf9, 0x1b, 0x1d, 0x71,
+  0xc8, 0xae, 0x00, 0x0b, 0x67, 0x2a, 0x8a, 0x45, 0x5b, 0xa8, 0x4b, 0x59,
+  0xd3, 0x74, 0x2d, 0xb0, 0x78, 0x1b, 0x3e, 0x80, 0x28, 0x05, 0xd0, 0xd9,
+  0x63, 0x1c, 0x62, 0xbb, 0x84, 0x0b, 0xe8, 0x95, 0x82, 0xee, 0x75, 0x6b,
+  0x94, 0x25, 0x02, 0xd2, 0xd2, 0xa3, 0x6d, 0x7b, 0xab, 0xdb, 0xab, 0x4b,
+  0x12, 0x36, 0xff, 0x76, 0x05, 0x94, 0xe0, 0x1c, 0x8a, 0xf7, 0x45, 0xe7,
+  0x21, 0x33, 0x03, 0x6b, 0x9b, 0x40, 0xf8, 0x1a, 0x3a, 0xbf, 0x8d, 0x36,
+  0xab, 0x5c, 0x31, 0xf6, 0xed, 0x67, 0x1f, 0x47, 0x79, 0x0d, 0x7a, 0xe3,
+  0x19, 0x58, 0x5c, 0x80, 0x79, 0x19, 0x94, 0xa4, 0xde, 0x56, 0xc8, 0xf3,
+  0x4e, 0xa3, 0xd5, 0x30, 0x6b, 0x29, 0x04, 0x04, 0x47, 0xde, 0x5e, 0xa6,
+  0x4f, 0x90, 0xc3, 0x0c, 0x8e, 0xc3, 0x9f, 0x89, 0xa9, 0x6d, 0x0b, 0x23,
+  0xb6, 0xc2, 0x6a, 0xca, 0x6e, 0xc8, 0x5a, 0x3e, 0xa9, 0x0b, 0x7c, 0x45,
+  0x6e, 0xc3, 0xd7, 0x71, 0xde, 0xa3, 0xba, 0x0c, 0x7b, 0x48, 0x26, 0x94,
+  0xaa, 0xaa, 0x32, 0x56, 0xe8, 0x10, 0x0d, 0xf9, 0xfd, 0xfd, 0x55, 0x15,
+  0x7b, 0xa5, 0xe3, 0xe0, 0x93, 0x12, 0x54, 0xcd, 0xe0, 0x0e, 0xcd, 0x16,
+  0xab, 0xba, 0x4e, 0xf0, 0x35, 0xbc, 0x32, 0xe5, 0x42, 0x7d, 0x01, 0x85,
+  0xb1, 0xb9, 0x44, 0xcf, 0x8d, 0xc9, 0xcf, 0x1a, 0xb0, 0x81, 0xce, 0x4e,
+  0x9e, 0x8c, 0x39, 0x14, 0x48, 0x8f, 0x73, 0x63, 0x07, 0x50, 0xbb, 0xab,
+  0xbb, 0x2d, 0x78, 0x61, 0x50, 0x5b, 0x0f, 0x6c, 0x1c, 0xc2, 0x19, 0x2e,
+  0xdf, 0xde, 0x6e, 0xde, 0x9d, 0xd1, 0x0d, 0x10, 0xac, 0x6a, 0x71, 0x67,
+  0xdf, 0xc6, 0xa0, 0x77, 0xa3, 0xa6, 0x99, 0x0c, 0x76, 0x2a, 0xfd, 0x14,
+  0x2a, 0xa4, 0xd7, 0xaf, 0x50, 0x1c, 0x4b, 0x2c, 0xde, 0x10, 0xed, 0x2e,
+  0x85, 0x17, 0xda, 0x65, 0x20, 0xef, 0xe2, 0xba, 0x06, 0xb1, 0x5e, 0xcd,
+  0xdb, 0xc1, 0xd5, 0x62, 0x20, 0xe7, 0x41, 0x88, 0xc0, 0x2b, 0x82, 0xcb,
+  0xc3, 0xc6, 0x6e, 0x36, 0xd1, 0x99, 0x3f, 0xbb, 0xe0, 0xde, 0x88, 0x7a,
+  0x8d, 0xd6, 0xb9, 0x1a, 0xed, 0x9b, 0x27, 0x29, 0xc5, 0x1c, 0xd8, 0xf3,
+  0x10, 0x5f, 0xd6, 0xb8, 0x91, 0xa7, 0xcb, 0x23, 0xdc, 0xef, 0x13, 0x7a,
+  0xe6, 0x0b, 0x7d, 0x97, 0xb1, 0xd7, 0xc1, 0x4b, 0x97, 0x6d, 0xaf, 0x24,
+  0xc9, 0x86, 0x3f, 0x95, 0xe8, 0xcd, 0xe1, 0xd1, 0x0c, 0xb2, 0xcc, 0xf5,
+  0x22, 0xf9, 0x4b, 0x3f, 0xb3, 0xc3, 0x86, 0x5c, 0x90, 0x37, 0x74, 0xf5,
+  0x56, 0x85, 0xbf, 0x02, 0x29, 0xda, 0xdd, 0xda, 0x4d, 0xad, 0x0d, 0x56,
+  0x9d, 0xb2, 0x4b, 0x2c, 0x19, 0xd9, 0x13, 0x8e, 0x1f, 0xb9, 0x57, 0x51,
+  0xc7, 0x7d, 0x5a, 0x44, 0xa2, 0xda, 0x5c, 0x69, 0x9c, 0xb9, 0x86, 0x5d,
+  0xef, 0x4a, 0x47, 0xee, 0x3b, 0x34, 0xd4, 0xc2, 0x9e, 0xa1, 0x38, 0xbd,
+  0x81, 0x62, 0xc0, 0x18, 0x1a, 0xbb, 0x7d, 0x5b, 0x92, 0xa0, 0x0d, 0x4e,
+  0xb6, 0x25, 0xbf, 0x7b, 0xc0, 0xa0, 0xca, 0xb6, 0x92, 0x99, 0x33, 0x03,
+  0xb6, 0xf7, 0xc7, 0x38, 0xcd, 0xed, 0xeb, 0x15, 0x49, 0x66, 0x87, 0xa2,
+  0xd4, 0x2a, 0x65, 0x62, 0xc8, 0xdf, 0xe1, 0x44, 0x13, 0x71, 0xdc, 0x40,
+  0xfa, 0x42, 0x9a, 0x64, 0x38, 0x80, 0x5a, 0xa2, 0xaf, 0xf7, 0x37, 0xb2,
+  0x0e, 0xc1, 0x92, 0x10, 0xb6, 0x58, 0xe9, 0x56, 0x71, 0x65, 0x33, 0x41,
+  0xf8, 0xa6, 0x19, 0xdb, 0x15, 0xe7, 0x71, 0xe0, 0xb1, 0x2c, 0x00, 0x5a,
+  0x83, 0xf6, 0xa3, 0x7d, 0x73, 0x8d, 0xdf, 0xe4, 0x5b, 0x94, 0x2e, 0xdb,
+  0xa1, 0x87, 0x7b, 0x83, 0x7b, 0xc7, 0x82, 0x18, 0xf3, 0x83, 0x45, 0x8c,
+  0xe0, 0xe9, 0x9e, 0xbb, 0x48, 0xb0, 0xbb, 0x69, 0xcf, 0xca, 0xe4, 0x00,
+  0xae, 0xc0, 0xa7, 0x16, 0x6a, 0x21, 0x5e, 0x08, 0x55, 0x24, 0x08, 0xb7,
+  0x2c, 0x2b, 0x12, 0xbd, 0x8e, 0x06, 0x87, 0x6c, 0x78, 0xf3, 0xe1, 0xcd,
+  0xd6, 0xab, 0x26, 0x84, 0x3a, 0xd2, 0x8b, 0x4a, 0x53, 0x8a, 0x3f, 0x46,
+  0xf2, 0x7c, 0x27, 0xe3, 0x61, 0xdd, 0x50, 0x89, 0xef, 0x64, 0xbc, 0xb7,
+  0x9d, 0x78, 0xf8, 0x47, 0xb0, 0x57, 0xb3, 0x11, 0xa1, 0x99, 0x41, 0x72,
+  0x31, 0x47, 0x0b, 0x2d, 0x2a, 0x7e, 0xe0, 0xb3, 0x9f, 0xfc, 0x24, 0x3d,
+  0x3c, 0xca, 0x93, 0x70, 0x95, 0x45, 0x18, 0x61, 0xbd, 0x81, 0x88, 0x03,
+  0xa0, 0x7e, 0x07, 0xe5, 0x24, 0x5c, 0x00, 0x0b, 0x94, 0xe6, 0x1b, 0x2a,
+  0x70, 0x64, 0x0d, 0x14, 0xee, 0x48, 0x58, 0xc4, 0x0b, 0xdc, 0x61, 0x9b,
+  0xd4, 0x13, 0x8d, 0xce, 0xbd, 0x05, 0xba, 0x92, 0xf8, 0xff, 0x6a, 0x77,
+  0x6c, 0x99, 0xc0, 0x07, 0xb7, 0xdc, 0x06, 0x6a, 0x93, 0xbf, 0xdb, 0x59,
+  0xb8, 0x6c, 0xcf, 0x47, 0x10, 0xa8, 0x4a, 0x51, 0xa3, 0x74, 0x0b, 0x05,
+  0x01, 0x02, 0xcf, 0x7c, 0xb0, 0xaf, 0x9f, 0x0e, 0xe5, 0x21, 0x4a, 0xea,
+  0x4b, 0xf8, 0x22, 0x5a, 0xa0, 0xd9, 0xe8, 0xe9, 0x30, 0x75, 0x29, 0x83,
+  0xc4, 0x8b, 0x85, 0x1c, 0x53, 0xf0, 0xdc, 0x10, 0xd0, 0x58, 0xac, 0xdd,
+  0xf3, 0xa4, 0xad, 0xa6, 0xa7, 0x61, 0x31, 0xd0, 0x1d, 0xb4, 0x52, 0xc8,
+  0xf5, 0x23, 0x1a, 0xd4, 0x67, 0x6a, 0x0d, 0x28, 0x22, 0xea, 0xdd, 0xaa,
+  0x0c, 0x99, 0x3b, 0xf0, 0xe5, 0xd7, 0xc4, 0xde, 0xa5, 0xcc, 0xb5, 0xce,
+  0x83, 0x4a, 0x37, 0xc8, 0x71, 0x22, 0x69, 0x52, 0x12, 0xb0, 0x8e, 0xa7,
+  0x53, 0x33, 0x22, 0xc3, 0xa8, 0xf2, 0xd6, 0x6c, 0xa5, 0xea, 0xc1, 0x38,
+  0xee, 0x55, 0x2a, 0x1c, 0x59, 0x4a, 0xdf, 0x14, 0x72, 0x4a, 0x94, 0x9b,
+  0x91, 0xd5, 0x2a, 0xa7, 0x66, 0xf2, 0x43, 0x35, 0xf3, 0xdd, 0x4f, 0xaa,
+  0xe1, 0x4f, 0x17, 0xf9, 0xde, 0x03, 0xf8, 0xaa, 0x80, 0x3b, 0xd5, 0x6b,
+  0x60, 0x8c, 0xaa, 0x9e, 0xad, 0xea, 0xef, 0x75, 0x9a, 0x9c, 0x4e, 0x0b,
+  0x6a, 0x80, 0x25, 0x17, 0xf9, 0xe8, 0x15, 0x09, 0xb2, 0x49, 0xdf, 0xcf,
+  0x7f, 0x73, 0x63, 0x29, 0xd2, 0xc9, 0x70, 0x43, 0x01, 0xc7, 0x0b, 0x34,
+  0x89, 0xae, 0x07, 0xf7, 0x2a, 0x81, 0x8f, 0xc4, 0x8b, 0xfa, 0x93, 0xb4,
+  0x72, 0xa6, 0x53, 0xbb, 0x7c, 0x34, 0xa4, 0x7e, 0x16, 0x40, 0x7e, 0xe2,
+  0x9f, 0xfa, 0x2f, 0x4e, 0xa6, 0x71, 0x6c, 0xe2, 0xa1, 0x28, 0x3b, 0x14,
+  0xf5, 0x1a, 0xf3, 0xd9, 0x40, 0x4f, 0x63, 0x47, 0x16, 0xb5, 0x72, 0x5e,
+  0xd5, 0x3d, 0xdf, 0x3d, 0x64, 0x06, 0x12, 0x29, 0x03, 0x49, 0x93, 0xf9,
+  0x33, 0xaa, 0xe5, 0x83, 0x3e, 0x7a, 0x0c, 0x11, 0x7f, 0x6c, 0xfe, 0x44,
+  0x98, 0xca, 0x47, 0x62, 0xe7, 0xda, 0xb4, 0xd9, 0x13, 0x2b, 0x02, 0x81,
+  0xe2, 0x1f, 0xdc, 0x6e, 0x4a, 0xed, 0xb7, 0xe6, 0x58, 0x58, 0xfa, 0x5a,
+  0xc3, 0xb7, 0xf5, 0x38, 0x88, 0x28, 0xc2, 0xc7, 0xa8, 0x33, 0x0f, 0x32,
+  0x38, 0x0c, 0x10, 0xcc, 0x17, 0xcf, 0x36, 0x46, 0x34, 0xca, 0x62, 0x75,
+  0x8a, 0x02, 0x94, 0xe7, 0x59, 0x22, 0x4d, 0x3b, 0x7e, 0x74, 0x0a, 0xd8,
+  0x33, 0x08, 0xb5, 0x61, 0x55, 0xaa, 0x9d, 0xe0, 0x52, 0x79, 0x9f, 0xbd,
+  0x3b, 0x20, 0x5e, 0xbf, 0x76, 0xc2, 0x7e, 0x2a, 0x7e, 0xe4, 0x63, 0xcc,
+  0xc7, 0x6d, 0xe4, 0x67, 0xcb, 0x28, 0x80, 0x9e, 0xe4, 0xb1, 0x84, 0x89,
+  0x28, 0x60, 0xed, 0xec, 0xd6, 0x48, 0x93, 0xb1, 0x8b, 0xfb, 0x22, 0x3f,
+  0xcf, 0xb9, 0x23, 0xf7, 0xb1, 0xe3, 0x3c, 0xf3, 0xdc, 0x19, 0xf5, 0xb1,
+  0x74, 0xb5, 0xd9, 0x45, 0xc6, 0x25, 0xa4, 0x88, 0xb6, 0x64, 0x05, 0x61,
+  0x00, 0x8e, 0x51, 0xb5, 0x8e, 0x83, 0x8f, 0xb0, 0xad, 0xd9, 0x06, 0x7e,
+  0x54, 0x11, 0xed, 0x22, 0x59, 0x6a, 0x52, 0xc4, 0xc4, 0x00, 0x82, 0x18,
+  0x2c, 0x03, 0x85, 0xeb, 0x97, 0xf7, 0xfb, 0xe2, 0x9c, 0x17, 0xca, 0x95,
+  0x55, 0x33, 0x03, 0x54, 0xdd, 0x5b, 0x5a, 0x0d, 0xcb, 0xe5, 0x45, 0x0b,
+  0xb7, 0xeb, 0xc6, 0x69, 0x02, 0xd1, 0xb4, 0x8a, 0x3e, 0x62, 0xa6, 0x95,
+  0xf0, 0x21, 0x69, 0x06, 0x20, 0x6c, 0x38, 0x0d, 0x4d, 0xf7, 0xf5, 0x42,
+  0xaa, 0xcc, 0x51, 0xba, 0x63, 0x2b, 0x1c, 0xf5, 0xfe, 0x62, 0xc5, 0x15,
+  0xa8, 0xbb, 0x05, 0x3e, 0x66, 0x58, 0x54, 0x9a, 0x10, 0xdf, 0x11, 0x9c,
+  0x2f, 0x00, 0x6b, 0x7c, 0x39, 0xf4, 0xd1, 0x77, 0xc8, 0x3d, 0xb2, 0x3c,
+  0xe9, 0xa3, 0xed, 0x42, 0xd1, 0x3a, 0x94, 0x41, 0x24, 0x23, 0x38, 0x1c,
+  0xab, 0x1e, 0x8c, 0x05, 0xe3, 0x06, 0x0c, 0xe4, 0xd3, 0xb0, 0x46, 0x61,
+  0x85, 0x38, 0xac, 0x64, 0x33, 0xb2, 0x08, 0x8b, 0xa3, 0x54, 0x5e, 0x4a,
+  0xcb, 0x03, 0x2b, 0x66, 0x50, 0x23, 0x27, 0xf0, 0xc4, 0xd0, 0xc5, 0xe0,
+  0xb9, 0x02, 0x16, 0xde, 0xe2, 0x3f, 0xeb, 0x1c, 0x3e, 0x52, 0x92, 0x53,
+  0x8b, 0xf4, 0x08, 0xfe, 0xfc, 0x94, 0x97, 0xf5, 0xe0, 0xba, 0x18, 0x7c,
+  0x4f, 0xe9, 0x4e, 0x4f, 0xe6, 0x61, 0xa9, 0x45, 0x9e, 0x31, 0x0c, 0x48,
+  0xec, 0xc1, 0x18, 0xfa, 0x61, 0x65, 0x7f, 0x4e, 0x43, 0x4e, 0xb5, 0x76,
+  0x8f, 0x4b, 0x75, 0x88, 0xda, 0xe6, 0xcd, 0x86, 0xc2, 0xe9, 0xbc, 0x12,
+  0x6f, 0xf1, 0x82, 0x28, 0x19, 0x3c, 0xa5, 0x87, 0xdc, 0xbd, 0x4f, 0x65,
+  0xcd, 0x23, 0x5c, 0xef, 0x1e, 0xb7, 0xa0, 0x24, 0xf5, 0x1a, 0x84, 0xa8,
+  0x65, 0x39, 0xad, 0x7e, 0x4f, 0xa4, 0x0e, 0x34, 0x9f, 0x0b, 0xba, 0x01,
+  0xc7, 0xbe, 0xa6, 0x9e, 0x87, 0x99, 0xc4, 0xa4, 0xdf, 0x3a, 0x52, 0xeb,
+  0xd2, 0x4f, 0x5b, 0xfc, 0x45, 0x62, 0xe3, 0x17, 0x68, 0x9b, 0x5a, 0xcd,
+  0x02, 0xf5, 0x0f, 0x13, 0xef, 0x51, 0x45, 0xfc, 0x6a, 0xd0, 0xe1, 0x3e,
+  0x11, 0x27, 0x37, 0x33, 0x91, 0x7d, 0x52, 0xe9, 0x01, 0x1e, 0x7b, 0x58,
+  0xd1, 0xa9, 0x08, 0x5b, 0x14, 0x3e, 0x6c, 0x7f, 0x3b, 0x69, 0xe7, 0x7c,
+  0x21, 0xb6, 0x9d, 0xd5, 0xa0, 0x07, 0xb8, 0xa5, 0x89, 0xb3, 0xd6, 0x07,
+  0xa9, 0xfb, 0xb3, 0x20, 0xc4, 0x4a, 0xad, 0xaa, 0x33, 0xe6, 0x6a, 0x8a,
+  0xee, 0x29, 0x75, 0x62, 0xa9, 0xbe, 0x2c, 0x24, 0xa1, 0x74, 0xe4, 0xc7,
+  0x8a, 0x09, 0xc4, 0xdc, 0xed, 0x7e, 0xf8, 0x54, 0x07, 0x9b, 0xfe, 0x19,
+  0x04, 0x08, 0xfe, 0x79, 0x01, 0x7f, 0x32, 0x16, 0x68, 0x15, 0x8a, 0x97,
+  0x80, 0x46, 0x31, 0xee, 0x09, 0xe7, 0x1b, 0xcc, 0x8d, 0x41, 0x75, 0x48,
+  0x9a, 0xa1, 0xde, 0xe3, 0xe4, 0x05, 0x31, 0x3e, 0x19, 0xad, 0xbf, 0xe6,
+  0x42, 0x07, 0xe2, 0xe2, 0x13, 0x36, 0x7b, 0x6f, 0x93, 0xc9, 0x7d, 0xc4,
+  0xc5, 0xcd, 0x18, 0x54, 0x5d, 0xee, 0xba, 0x3d, 0x4b, 0xf0, 0x16, 0xaa,
+  0x48, 0x27, 0x48, 0xd2, 0x25, 0xa1, 0xbb, 0x28, 0x0b, 0xcc, 0xc7, 0x5c,
+  0x64, 0x5c, 0x15, 0x93, 0xf6, 0x4d, 0x87, 0xb6, 0x99, 0xc3, 0x8c, 0x0d,
+  0x82, 0x6f, 0xb0, 0xe6, 0x9e, 0xfc, 0x6c, 0xa6, 0xaf, 0xea, 0x62, 0x2c,
+  0x34, 0x76, 0xd5, 0x5d, 0xe9, 0xca, 0x24, 0x79, 0xb2, 0xe8, 0xf1, 0x52,
+  0xf5, 0x26, 0x82, 0x1e, 0x92, 0x60, 0x66, 0xae, 0xd9, 0xc9, 0xb3, 0xe2,
+  0x29, 0x3d, 0x56, 0x30, 0x91, 0x27, 0x1e, 0xe9, 0x82, 0x07, 0x01, 0x2f,
+  0x54, 0x89, 0x1f, 0xd4, 0x86, 0xca, 0xd4, 0x15, 0x43, 0x40, 0x27, 0xcb,
+  0x6d, 0x0b, 0x34, 0x3c, 0x49, 0x7a, 0x73, 0xdf, 0xc1, 0xe8, 0x47, 0xa3,
+  0xd3, 0xbb, 0x70, 0xd4, 0xae, 0x52, 0x6c, 0xcf, 0x0b, 0x63, 0x7a, 0x1a,
+  0x52, 0xae, 0xeb, 0x57, 0x49, 0x4e, 0x17, 0x37, 0x7b, 0x21, 0x83, 0xba,
+  0xfa, 0x22, 0x26, 0xbe, 0xbf, 0x0b, 0x32, 0xb1, 0x73, 0xf7, 0xcf, 0x3f,
+  0x66, 0x13, 0xf8, 0x96, 0x72, 0x28, 0x6b, 0x13, 0x9a, 0x42, 0x1f, 0x01,
+  0xce, 0x95, 0xf7, 0x7c, 0xef, 0x67, 0x27, 0x42, 0xc7, 0x75, 0xf5, 0x6a,
+  0xfe, 0xc0, 0xf6, 0xbb, 0xdc, 0x90, 0xd7, 0x10, 0x75, 0x8a, 0x4b, 0x9b,
+  0x23, 0xdc, 0xe9, 0xeb, 0x89, 0x4a, 0xcf, 0x9e, 0xc8, 0xa1, 0xd4, 0x34,
+  0xe3, 0xa9, 0x77, 0xe7, 0xd7, 0x27, 0x3f, 0xaf, 0x8f, 0x4e, 0x92, 0x25,
+  0xb2, 0xb9, 0x9b, 0x94, 0xe4, 0xb7, 0x63, 0xd4, 0x10, 0x30, 0xab, 0x2c,
+  0xf1, 0xc8, 0x5e, 0xa1, 0xba, 0x22, 0x2f, 0x3e, 0xd7, 0xcd, 0x78, 0x9a,
+  0x84, 0x79, 0xe4, 0x57, 0x3b, 0x0b, 0xa3, 0xe8, 0x9e, 0x7e, 0x4f, 0x0e,
+  0x4d, 0x21, 0x89, 0x6d, 0x03, 0xf3, 0xef, 0xe9, 0x44, 0x57, 0x29, 0xf9,
+  0x46, 0x72, 0xf2, 0x95, 0x11, 0xfa, 0x2b, 0xd0, 0xe4, 0x2d, 0x20, 0x6d,
+  0x73, 0xe0, 0x28, 0xf7, 0xbd, 0xff, 0x7e, 0x37, 0xc4, 0xd7, 0xce, 0xad,
+  0xcc, 0x94, 0xa2, 0x0a, 0x4d, 0xf1, 0x22, 0xca, 0xbf, 0x8e, 0xf4, 0x9c,
+  0xf4, 0x0c, 0xdc, 0xa3, 0x5f, 0xb4, 0xdf, 0x29, 0x96, 0xbc, 0x31, 0x4b,
+  0x4e, 0x1a, 0x5c, 0xd0, 0xbb, 0x87, 0xbd, 0x14, 0xef, 0x6b, 0x1e, 0xfe,
+  0xb6, 0xad, 0x3f, 0xb2, 0xcd, 0xcc, 0x04, 0x14, 0x5c, 0x87, 0xf5, 0x63,
+  0x99, 0x02, 0x79, 0x65, 0x00, 0x57, 0x39, 0xdf, 0xe2, 0xb2, 0x81, 0xb8,
+  0x3c, 0x94, 0xf3, 0xe3, 0xf8, 0xdb, 0xac, 0x75, 0x2b, 0xab, 0xf4, 0x83,
+  0xd0, 0x05, 0xfb, 0x98, 0xbf, 0xc3, 0x11, 0x5b, 0x9b, 0x05, 0xdf, 0x6e,
+  0xa7, 0xbe, 0xd3, 0x5f, 0x23, 0x6e, 0x5a, 0x01, 0xc6, 0x03, 0xd8, 0x90,
+  0x64, 0x7d, 0xf0, 0x8f, 0x0c, 0x92, 0xd9, 0xea, 0xe4, 0xa4, 0x87, 0x3a,
+  0x2a, 0xa1, 0x10, 0x25, 0x94, 0xa9, 0x5a, 0x38, 0x9f, 0x56, 0x3d, 0xa7,
+  0xc2, 0x3d, 0x4b, 0xc9, 0x16, 0x85, 0x0e, 0xbc, 0x40, 0x0e, 0x8f, 0xf9,
+  0x10, 0x96, 0x83, 0x9b, 0x23, 0x1d, 0x70, 0xd8, 0x09, 0xd0, 0x99, 0x7f,
+  0xa7, 0x7f, 0xaf, 0xd4, 0xa6, 0x9d, 0x76, 0xe8, 0xb4, 0x1c, 0x92, 0x82,
+  0x50, 0xee, 0x59, 0x29, 0xf0, 0xff, 0x3f, 0x00, 0x33, 0xca, 0x41, 0x2a,
+  0x59, 0xc4, 0x78, 0xa9, 0x5d, 0xc6, 0x52, 0x88, 0x5e, 0xf9, 0x4d, 0xe3,
+  0xdd, 0x75, 0xc7, 0x80, 0x67, 0xb8, 0xe9, 0x68, 0x76, 0x5a, 0x93, 0x37,
+  0x95, 0x1f, 0x0a, 0x0a, 0x87, 0x6b, 0x0d, 0x78, 0xc7, 0x86, 0x8e, 0xe4,
+  0xfd, 0x2f, 0xa2, 0x32, 0x5b, 0xf9, 0xf6, 0xef, 0x88, 0xe6, 0x2b, 0xe2,
+  0xaf, 0x9c, 0xc1, 0x77, 0x4e, 0xa8, 0xa0, 0x1b, 0x93, 0x95, 0x30, 0xd6,
+  0x95, 0xb6, 0xfa, 0x2e, 0x68, 0x75, 0xc6, 0x27, 0x58, 0x74, 0xff, 0xde,
+  0xef, 0xac, 0x58, 0xbe, 0x71, 0xd5, 0x1f, 0x6d, 0x3e, 0x62, 0xf1, 0x07,
+  0xfd, 0xbd, 0x2e, 0x5e, 0xd9, 0x5a, 0xa4, 0x22, 0x85, 0x11, 0xbf, 0x02,
+  0x12, 0xcb, 0xb3, 0x4f, 0x83, 0xa5, 0xa0, 0xf4, 0x93, 0x95, 0x7c, 0xa7,
+  0xa7, 0x17, 0xbe, 0x92, 0x81, 0x37, 0xf1, 0x4a, 0x31, 0xee, 0x84, 0x61,
+  0x32, 0xda, 0x53, 0x17, 0x8d, 0xc4, 0x93, 0x7f, 0x9d, 0xbd, 0x57, 0xbf,
+  0xbe, 0xc5, 0x2d, 0xcd, 0xfd, 0x49, 0xee, 0x0c, 0x2b, 0xa0, 0x25, 0xbc,
+  0x62, 0x35, 0x1e, 0xf2, 0x46, 0xe6, 0xfe, 0xd0, 0xbc, 0xb0, 0x04, 0xc1,
+  0xda, 0xec, 0x0d, 0x22, 0x15, 0xf6, 0x58, 0xa0, 0x95, 0xa1, 0xbd, 0x7e,
+  0x7d, 0x2d, 0xb3, 0x82, 0x73, 0xc1, 0x9d, 0x1c, 0x5b, 0xfa, 0x14, 0xf0,
+  0xb2, 0xd4, 0x91, 0x67, 0x31, 0xc5, 0xb8, 0x96, 0xfd, 0xc2, 0x94, 0x78,
+  0x73, 0x57, 0x3b, 0xc8, 0xd6, 0x2e, 0x03, 0x99, 0x63, 0xe5, 0x91, 0x7e,
+  0x58, 0x17, 0x64, 0x38, 0xab, 0x88, 0x8b, 0x86, 0x2b, 0xdc, 0xe0, 0x55,
+  0xe8, 0x14, 0xdb, 0x55, 0xca, 0x40, 0xdd, 0x66, 0x3b, 0x72, 0x70, 0xfc,
+  0x19, 0x4d, 0xb4, 0xd9, 0xeb, 0xf6, 0x9e, 0x50, 0x84, 0xb1, 0x7e, 0x92,
+  0x4d, 0xe2, 0x82, 0xa9, 0x4f, 0xf3, 0x45, 0xf9, 0xf1, 0x08, 0x5d, 0x80,
+  0x0f, 0x05, 0x77, 0x2d, 0x18, 0x84, 0x90, 0xd6, 0xc2, 0x4b, 0x90, 0x4f,
+  0x3a, 0xb7, 0x32, 0xcb, 0x8f, 0x40, 0xf6, 0x09, 0xc3, 0x71, 0x96, 0x1a,
+  0x18, 0x37, 0xf4, 0xc9, 0x39, 0xd2, 0x6d, 0x64, 0x10, 0x03, 0x2b, 0x90,
+  0x34, 0xae, 0xfb, 0x8c, 0x11, 0xba, 0xec, 0x58, 0xf5, 0xb8, 0x00, 0x5e,
+  0x8c, 0x74, 0x5b, 0x38, 0x77, 0xbd, 0xe3, 0x9e, 0xe0, 0x41, 0x84, 0x59,
+  0x9f, 0x7e, 0x61, 0xb1, 0xf6, 0x42, 0xc5, 0x6c, 0x38, 0xd7, 0x17, 0x4e,
+  0x5f, 0xab, 0x93, 0x55, 0xf3, 0x23, 0x44, 0xec, 0x94, 0x9b, 0x4d, 0x5f,
+  0x3b, 0x30, 0xdc, 0x2f, 0xea, 0x83, 0x85, 0xef, 0x08, 0x1d, 0x30, 0x7b,
+  0x2f, 0xad, 0x07, 0x14, 0xf6, 0x4e, 0x78, 0x13, 0x21, 0xba, 0x2b, 0xd5,
+  0x17, 0x22, 0xff, 0x45, 0xaf, 0xca, 0x0c, 0x36, 0x6b, 0x58, 0xc8, 0x80,
+  0x53, 0xaf, 0x59, 0xd2, 0xed, 0x06, 0xaa, 0x86, 0xb3, 0xcc, 0x86, 0x24,
+  0xb4, 0x22, 0x45, 0x6c, 0x8e, 0x1f, 0xd1, 0x98, 0x5b, 0x2f, 0x3c, 0x15,
+  0xc1, 0xe3, 0xab, 0x32, 0xe1, 0x20, 0x29, 0x70, 0x08, 0xbb, 0x7a, 0x36,
+  0x69, 0xe2, 0x6d, 0x83, 0x15, 0x4c, 0x25, 0x36, 0xfb, 0x03, 0x54, 0x6d,
+  0xdc, 0xf7, 0xf3, 0x05, 0xd7, 0x44, 0xe1, 0xb3, 0x2a, 0x9f, 0x0a, 0x83,
+  0x53, 0x4b, 0x2c, 0x99, 0x1f, 0x18, 0xb5, 0xf9, 0x6c, 0x6e, 0xfd, 0x35,
+  0x8b, 0xd2, 0xa0, 0x2b, 0x98, 0x80, 0xbe, 0xdd, 0xee, 0x5e, 0xed, 0xd5,
+  0xcf, 0x5b, 0x01, 0x38, 0x9e, 0x65, 0xd5, 0x06, 0xf1, 0xa3, 0x6c, 0x4f,
+  0xff, 0x01, 0x06, 0x7f, 0x60, 0xf3, 0xd1, 0xee, 0x84, 0xa6, 0xc7, 0x15,
+  0x4e, 0xba, 0x84, 0x46, 0x2a, 0xa2, 0xe8, 0x7f, 0x17, 0xad, 0xd7, 0xde,
+  0x18, 0x05, 0x65, 0x5d, 0x4b, 0xf3, 0x51, 0xdb, 0x71, 0x0c, 0x1f, 0x65,
+  0x67, 0xe6, 0x3a, 0x2d, 0xfc, 0x27, 0x7a, 0x0b, 0x81, 0x08, 0x6d, 0xbc,
+  0x87, 0xde, 0x82, 0xb7, 0x57, 0x55, 0x16, 0xea, 0x29, 0x01, 0x36, 0xe6,
+  0xbb, 0x66, 0x1e, 0xb1, 0x2a, 0xca, 0x96, 0x0e, 0xe5, 0x29, 0x09, 0xa4,
+  0x50, 0x4e, 0xe3, 0x20, 0x38, 0xa8, 0xdd, 0x18, 0xef, 0x2c, 0xef, 0x1e,
+  0x77, 0x12, 0x75, 0x23, 0x25, 0x22, 0x63, 0xba, 0x47, 0xaa, 0x5a, 0x91,
+  0x2f, 0xca, 0x61, 0x45, 0xa4, 0xd6, 0xc1, 0x28, 0x50, 0x78, 0x2c, 0xd3,
+  0x67, 0x96, 0x35, 0x41, 0xd3, 0x3f, 0x33, 0x9b, 0x13, 0xb7, 0xaa, 0x6c,
+  0xdf, 0x5e, 0xce, 0x34, 0xf0, 0x39, 0x70, 0x09, 0x8c, 0x4d, 0x5b, 0x6d,
+  0x2f, 0xa6, 0x72, 0xbd, 0x25, 0x84, 0xd7, 0xc1, 0x87, 0x72, 0x29, 0x90,
+  0x65, 0xe4, 0xfc, 0xdc, 0x41, 0xeb, 0xd6, 0x8a, 0x02, 0x7d, 0xd2, 0xae,
+  0x45, 0xa5, 0xf5, 0x61, 0x61, 0xfb, 0x46, 0x35, 0x63, 0xf7, 0x7e, 0x60,
+  0x5e, 0x1e, 0x62, 0x53, 0x31, 0x72, 0xe3, 0xb2, 0x38, 0xc4, 0x3f, 0xa9,
+  0xeb, 0x33, 0x3f, 0x16, 0x65, 0x7c, 0xa1, 0x49, 0x18, 0x03, 0xfc, 0x42,
+  0x8e, 0xc1, 0xce, 0xc1, 0x54, 0xbb, 0x8c, 0xb6, 0x39, 0x30, 0xc5, 0x44,
+  0x68, 0xf7, 0x8a, 0x5d, 0xbd, 0x0a, 0x03, 0xc5, 0x21, 0xd4, 0x2f, 0x3b,
+  0x19, 0x10, 0x9a, 0x0d, 0x76, 0x4a, 0x8b, 0xbb, 0x48, 0x44, 0xc7, 0x50,
+  0x53, 0x43, 0x4d, 0x10, 0xb8, 0x99, 0x9b, 0x4b, 0xa3, 0xb9, 0x36, 0x04,
+  0x1a, 0x66, 0xbb, 0xdf, 0xe7, 0x7a, 0x2c, 0x84, 0xde, 0x0a, 0x1a, 0x58,
+  0x23, 0x2e, 0x68, 0x95, 0xa0, 0x37, 0xab, 0xd3, 0x77, 0x6d, 0x7d, 0xc2,
+  0x44, 0x4a, 0x3f, 0x72, 0x29, 0x32, 0x66, 0x13, 0x96, 0xd9, 0x3c, 0x58,
+  0xfd, 0x19, 0xda, 0x4f, 0xf9, 0x74, 0x39, 0x16, 0xcf, 0xf0, 0x6f, 0x48,
+  0xf1, 0xd8, 0xe6, 0x2f, 0x70, 0xb7, 0x4f, 0x08, 0xec, 0x59, 0xc9, 0xe7,
+  0x37, 0x45, 0x8f, 0xc8, 0x79, 0x96, 0xe9, 0xf0, 0x85, 0xa8, 0x0f, 0xbf,
+  0x6b, 0x95, 0x78, 0xe1, 0x8b, 0x50, 0xbd, 0xaf, 0xfa, 0x89, 0xf3, 0xb5,
+  0x72, 0x19, 0xcd, 0xc1, 0xf7, 0x0f, 0x52, 0x40, 0xf6, 0x35, 0x2a, 0x82,
+  0xc0, 0x22, 0xe1, 0xc5, 0x7a, 0x50, 0x49, 0x55, 0x4f, 0x6a, 0xbc, 0xa7,
+  0x19, 0xea, 0x9c, 0x3e, 0x50, 0xdb, 0xc6, 0x6d, 0xc0, 0xf4, 0xca, 0x2b,
+  0xe6, 0x86, 0x1e, 0xa8, 0x94, 0x62, 0xc4, 0x8a, 0x22, 0x92, 0x60, 0x85,
+  0xf6, 0x09, 0x37, 0x0e, 0x42, 0x7a, 0x11, 0x84, 0xc8, 0xa4, 0xf1, 0x19,
+  0x82, 0x5b, 0x09, 0x2d, 0x2b, 0x57, 0x9b, 0xea, 0xc7, 0xc6, 0x3b, 0x31,
+  0xab, 0x33, 0xa9, 0x38, 0xc9, 0x34, 0x42, 0xa5, 0xc0, 0xb8, 0xa8, 0x89,
+  0x61, 0x80, 0x8b, 0xbd, 0x49, 0xc4, 0x1d, 0x90, 0x7c, 0xfa, 0x1c, 0x91,
+  0x40, 0x21, 0xc2, 0x3c, 0x6c, 0xd8, 0xc5, 0x57, 0xbc, 0xd5, 0x3a, 0x5b,
+  0x2f, 0xe8, 0xea, 0x27, 0x8c, 0xf7, 0x17, 0x35, 0x0f, 0xfd, 0x21, 0x8d,
+  0xef, 0x16, 0xc9, 0x50, 0x13, 0x92, 0x13, 0xda, 0xa5, 0x20, 0x9a, 0xd7,
+  0x66, 0x17, 0x74, 0x32, 0x0c, 0xf5, 0xd4, 0x21, 0x91, 0xff, 0xed, 0x80,
+  0x42, 0xa3, 0xfb, 0xae, 0xdd, 0xd0, 0xb2, 0x85, 0x28, 0xf9, 0x42, 0xe9,
+  0x8d, 0x62, 0x6a, 0xfc, 0x9a, 0x17, 0xdf, 0x13, 0x9c, 0x8e, 0x3a, 0x11,
+  0x92, 0xea, 0x48, 0x42, 0x62, 0xc9, 0x31, 0xcf, 0x1c, 0xa9, 0x4d, 0x59,
+  0xc0, 0xa5, 0x47, 0x55, 0xd5, 0x34, 0xc9, 0xe3, 0x1f, 0x66, 0x8f, 0x2a,
+  0x0e, 0x7a, 0xd4, 0x88, 0x04, 0x86, 0x64, 0x55, 0x60, 0x36, 0x4c, 0x21,
+  0xd0, 0xef, 0x65, 0xe9, 0xd3, 0x5a, 0x5b, 0xe4, 0xad, 0x1a, 0xe4, 0xe1,
+  0x53, 0xd3, 0x43, 0xc3, 0xd4, 0x13, 0x70, 0x12, 0xf1, 0xd1, 0x89, 0x63,
+  0x91, 0xd2, 0x99, 0xe5, 0x63, 0x44, 0xab, 0x9d, 0xa5, 0x1a, 0x4c, 0xdb,
+  0xd3, 0xa7, 0x83, 0xd5, 0xab, 0xb0, 0x25, 0x04, 0x2f, 0x2d, 0x79, 0x29,
+  0x63, 0xd2, 0x2e, 0xd7, 0xdb, 0xb2, 0x61, 0x86, 0xa8, 0x70, 0x83, 0xdb,
+  0x22, 0x3a, 0xe0, 0xe7, 0xc5, 0x71, 0x74, 0x9d, 0x5a, 0xd6, 0x07, 0x1e,
+  0x9c, 0xce, 0x7c, 0x46, 0x7c, 0x58, 0xf4, 0xdd, 0x1b, 0xe1, 0xd4, 0x96,
+  0x7a, 0x7a, 0x5a, 0x2a, 0x0e, 0xb0, 0x01, 0x55, 0xd8, 0x3e, 0xdb, 0x7b,
+  0xd3, 0x89, 0xfd, 0x7e, 0x84, 0x07, 0x74, 0x99, 0x7f, 0x21, 0x43, 0x5c,
+  0xd0, 0xf6, 0xe9, 0x58, 0x4e, 0xc9, 0x09, 0x65, 0x69, 0xe5, 0x4d, 0x13,
+  0x17, 0xc6, 0xdc, 0x2e, 0x22, 0x09, 0x81, 0x72, 0xe8, 0xeb, 0x09, 0x50,
+  0x59, 0x42, 0x8a, 0x67, 0xc3, 0x1b, 0xd9, 0xf9, 0x5d, 0x82, 0x20, 0x8f,
+  0xb9, 0x25, 0xd4, 0x3a, 0x85, 0x05, 0x91, 0x9e, 0xfb, 0xf0, 0x06, 0x3e,
+  0x2f, 0x5e, 0xe9, 0x64, 0x79, 0x61, 0x7b, 0x34, 0x78, 0x88, 0x86, 0xc8,
+  0x88, 0xc4, 0xc0, 0xe3, 0x81, 0x2c, 0x70, 0x40, 0x2a, 0xdd, 0xb8, 0x4c,
+  0x81, 0x72, 0x6f, 0xb0, 0x79, 0xaf, 0x09, 0x5d, 0xd1, 0x11, 0x62, 0x57,
+  0x06, 0x2a, 0xb5, 0x6e, 0x24, 0x12, 0xf0, 0xd4, 0x07, 0xbf, 0x2b, 0xe0,
+  0x1d, 0x76, 0xc0, 0xdc, 0x4d, 0x8b, 0x5b, 0x1a, 0x65, 0xd9, 0x6f, 0x86,
+  0x45, 0xbf, 0xbc, 0x1b, 0xa3, 0x29, 0xeb, 0xde, 0x38, 0x27, 0xd6, 0x80,
+  0x22, 0x08, 0x1a, 0xea, 0xe5, 0x99, 0x99, 0xbf, 0x68, 0x62, 0x48, 0xaa,
+  0x96, 0x0c, 0x6f, 0xcb, 0xaf, 0xc8, 0x17, 0x65, 0xa8, 0x9c, 0xdb, 0xf7,
+  0xe6, 0x95, 0xed, 0xd3, 0x28, 0xba, 0xe8, 0x24, 0xf9, 0xf5, 0x0f, 0xf2,
+  0x41, 0x6b, 0x8d, 0x6c, 0xb9, 0x68, 0x76, 0x8c, 0xc7, 0xed, 0x9f, 0x03,
+  0x89, 0x4d, 0xa4, 0x5b, 0xce, 0xcc, 0x0f, 0x7f, 0x0d, 0x5f, 0x36, 0x67,
+  0x75, 0xe5, 0x65, 0xd7, 0x69, 0xbf, 0x03, 0x55, 0x64, 0x64, 0xe7, 0x24,
+  0x36, 0x49, 0xd7, 0x46, 0xc7, 0xfe, 0x49, 0xd2, 0xd6, 0x82, 0x5c, 0x81,
+  0x80, 0xf8, 0x16, 0xd4, 0x79, 0x90, 0x2f, 0xf5, 0xa5, 0xf0, 0x27, 0x89,
+  0xc1, 0x0c, 0xad, 0x08, 0x0e, 0x05, 0x2f, 0x8c, 0xb1, 0x91, 0xfc, 0xdf,
+  0x8e, 0x6a, 0x39, 0xf7, 0xb5, 0x55, 0x06, 0x49, 0xe4, 0x3d, 0x3c, 0x19,
+  0x62, 0x84, 0xc5, 0x7e, 0x81, 0x34, 0x12, 0xab, 0x72, 0x92, 0x0d, 0x1f,
+  0xc2, 0x95, 0x24, 0x32, 0xe2, 0x0f, 0x3a, 0xc6, 0x79, 0x28, 0xee, 0xd4,
+  0x86, 0x28, 0x77, 0x79, 0xbd, 0x00, 0x1b, 0x5e, 0x91, 0xbe, 0x3f, 0x27,
+  0x6b, 0x73, 0x56, 0x5b, 0x1d, 0xd9, 0x99, 0x1c, 0x62, 0xdf, 0x11, 0x37,
+  0x07, 0xac, 0xad, 0x27, 0x38, 0xf5, 0x13, 0x7d, 0xe4, 0xc5, 0x77, 0x9e,
+  0x85, 0x6d, 0x3b, 0x24, 0xbd, 0x48, 0xba, 0x28, 0x2b, 0x80, 0x17, 0xe9,
+  0x72, 0x97, 0x87, 0x58, 0x76, 0x06, 0xf9, 0xab, 0xeb, 0x12, 0x4a, 0xc3,
+  0xb4, 0x20, 0x4f, 0xf4, 0xa1, 0xfd, 0xc5, 0xe3, 0x75, 0xfe, 0xae, 0x53,
+  0x83, 0x89, 0x7a, 0x60, 0x10, 0x16, 0xb1, 0xbe, 0x89, 0x0f, 0x11, 0x8c,
+  0x74, 0xf8, 0xd7, 0xe1, 0xf8, 0x1f, 0xf9, 0x31, 0xfa, 0xfe, 0x72, 0x73,
+  0xab, 0xfa, 0x98, 0xa1, 0x0c, 0x66, 0x77, 0xcd, 0xbb, 0x1c, 0x33, 0x9f,
+  0xb7, 0xa8, 0x46, 0xc5, 0xe2, 0xd5, 0x32, 0x10, 0x77, 0x74, 0x39, 0x7e,
+  0x95, 0xe6, 0x95, 0x02, 0x2b, 0xc5, 0xc2, 0x4c, 0xca, 0xf2, 0xb7, 0xbe,
+  0x34, 0x9e, 0xc2, 0x6a, 0x26, 0x65, 0xb7, 0x0c, 0x0f, 0xf4, 0xdb, 0x13,
+  0xc9, 0x1f, 0xd4, 0x15, 0x5b, 0x12, 0xab, 0x3d, 0x92, 0xbd, 0x88, 0xb5,
+  0xe9, 0x9f, 0x66, 0xd9, 0x23, 0xf2, 0x6e, 0x01, 0x5e, 0xa7, 0x5d, 0x27,
+  0xab, 0x6f, 0x39, 0xf3, 0xa5, 0x57, 0xda, 0x9f, 0x0f, 0x47, 0xd2, 0xd4,
+  0xd8, 0xde, 0x13, 0x64, 0x1a, 0xe4, 0x9f, 0xdf, 0x5c, 0x8e, 0x76, 0x2c,
+  0xf8, 0x8f, 0xa9, 0x1c, 0x3f, 0xa8, 0xe3, 0x75, 0xf1, 0x47, 0xea, 0xd7,
+  0x2e, 0x4f, 0xd2, 0x64, 0xa3, 0x8c, 0x3a, 0xd4, 0x63, 0x0d, 0x61, 0xce,
+  0x8b, 0x02, 0x9f, 0xab, 0x85, 0xc9, 0xcc, 0xd7, 0x80, 0x42, 0x89, 0xd1,
+  0xb9, 0xfb, 0x14, 0x8c, 0xe6, 0x2b, 0x4e, 0x93, 0x73, 0xe1, 0x5c, 0x2c,
+  0xbe, 0x37, 0x27, 0x46, 0x10, 0x6d, 0x2a, 0xd0, 0x0d, 0xf4, 0xa1, 0xeb,
+  0xc9, 0xc9, 0x22, 0x9c, 0x40, 0x35, 0xb2, 0x34, 0x84, 0xbe, 0xf7, 0x15,
+  0x98, 0x53, 0x6c, 0xc4, 0x79, 0x72, 0xdd, 0xd8, 0x69, 0x77, 0x37, 0x83,
+  0xad, 0xc2, 0xfe, 0x1b, 0x5a, 0x39, 0xb0, 0x92, 0xf5, 0xbf, 0x62, 0x85,
+  0x46, 0x53, 0x28, 0xb7, 0xaa, 0xb2, 0x38, 0xeb, 0xa2, 0x5f, 0x1f, 0x67,
+  0x02, 0x2a, 0x90, 0xae, 0x88, 0x5e, 0x4a, 0xe6, 0x9d, 0x4d, 0x19, 0x79,
+  0xf7, 0x5e, 0xe1, 0x09, 0xd9, 0x66, 0xcf, 0x43, 0xe2, 0xff, 0x2c, 0xd6,
+  0x9f, 0x82, 0xf0, 0xb0, 0x75, 0x36, 0x3e, 0x64, 0x23, 0x14, 0xfb, 0x57,
+  0x53, 0x0b, 0x2a, 0x0d, 0x00, 0x82, 0x18, 0x87, 0x98, 0x58, 0x85, 0x26,
+  0xd0, 0x7b, 0x1f, 0x1f, 0x08, 0x97, 0xa0, 0x29, 0xc6, 0x00, 0x1a, 0xec,
+  0xc7, 0xb4, 0x6b, 0x33, 0xce, 0x9e, 0xc2, 0x37, 0x75, 0x05, 0xa3, 0x39,
+  0x89, 0x7e, 0x3f, 0xdd, 0xe9, 0x74, 0xa2, 0x50, 0xc8, 0x64, 0x63, 0x03,
+  0x8a, 0xaf, 0x4e, 0x92, 0x00, 0x43, 0x26, 0x0e, 0x60, 0x52, 0xb4, 0xe1,
+  0x66, 0xc8, 0x04, 0x00, 0xb6, 0x69, 0x08, 0xba, 0x9a, 0x29, 0x44, 0xda,
+  0x7a, 0x84, 0x93, 0xb6, 0x9a, 0x21, 0x57, 0x92, 0xa4, 0x21, 0x39, 0x51,
+  0x9a, 0xff, 0x8c, 0xa8, 0xad, 0xfe, 0xb5, 0x74, 0x22, 0x7c, 0x5d, 0xc4,
+  0xda, 0x5f, 0xfc, 0x0e, 0x19, 0xcb, 0x17, 0x21, 0x02, 0x24, 0x42, 0x42,
+  0x94, 0x1c, 0xd2, 0x7a, 0xcd, 0x0c, 0xb1, 0x6f, 0x6b, 0x0f, 0x6c, 0x6d,
+  0x86, 0x16, 0x76, 0xff, 0x9b, 0xf7, 0xc1, 0x95, 0x9e, 0xfe, 0x3b, 0xeb,
+  0x7c, 0xb4, 0x84, 0xd3, 0xdc, 0x7d, 0x36, 0x8b, 0x58, 0xda, 0xd3, 0x2f,
+  0x68, 0xe2, 0xa7, 0x02, 0x9d, 0xe2, 0xe6, 0xd3, 0xe8, 0x57, 0x3f, 0x7c,
+  0x52, 0x9f, 0x04, 0xa6, 0x61, 0x09, 0x19, 0xb7, 0x71, 0x18, 0x85, 0x66,
+  0x4c, 0x0b, 0xbe, 0xae, 0x21, 0x29, 0x0f, 0xae, 0x44, 0x2b, 0xd5, 0xec,
+  0xd9, 0xe4, 0x4e, 0x35, 0xbf, 0x88, 0x05, 0xef, 0x30, 0xb8, 0x76, 0x83,
+  0x05, 0xd8, 0xf4, 0x2b, 0x61, 0xe9, 0xe9, 0xe2, 0x30, 0xc3, 0x91, 0xb0,
+  0xd0, 0x09, 0x95, 0x35, 0x0d, 0x05, 0x0a, 0x0c, 0x82, 0xd7, 0x8e, 0x3f,
+  0x4a, 0xd2, 0xff, 0xa6, 0x2b, 0xa0, 0xc8, 0x57, 0x24, 0x50, 0x6e, 0xe8,
+  0xff, 0xe1, 0x30, 0x4f, 0x14, 0x44, 0x3b, 0xb5, 0xce, 0xea, 0xe8, 0x8b,
+  0x87, 0x7f, 0xbb, 0x11, 0x02, 0x7b, 0x02, 0x13, 0x58, 0x28, 0x91, 0x59,
+  0x60, 0x39, 0x84, 0x29, 0xc1, 0xf3, 0xff, 0xfb, 0x74, 0x9f, 0x65, 0x79,
+  0x02, 0x9b, 0x4d, 0xbd, 0xb2, 0x58, 0xc1, 0xf5, 0xbb, 0xfd, 0x1d, 0x52,
+  0x9c, 0x67, 0x9e, 0x93, 0xf8, 0xcf, 0xae, 0xbf, 0x54, 0xd9, 0xd7, 0x83,
+  0x6c, 0x51, 0xe5, 0xf0, 0xf8, 0x6b, 0x93, 0xc7, 0x09, 0xcc, 0xb3, 0x7a,
+  0x4a, 0x4c, 0x89, 0xbd, 0xdf, 0x85, 0x21, 0x44, 0xb7, 0xea, 0xb9, 0xac,
+  0x05, 0x3f, 0x12, 0x70, 0x82, 0xa4, 0xdb, 0x24, 0x23, 0x3b, 0x36, 0x9a,
+  0x5d, 0x58, 0xb0, 0x2f, 0x86, 0x7e, 0x98, 0x1c, 0x41, 0x22, 0xb3, 0xb7,
+  0x90, 0xf8, 0x52, 0x49, 0xfa, 0xf5, 0x04, 0xa4, 0x5a, 0x86, 0x5d, 0x98,
+  0x95, 0x27, 0x5b, 0xcf, 0x89, 0xba, 0x43, 0x10, 0xe0, 0xac, 0xd7, 0xe5,
+  0xf4, 0x2a, 0x55, 0x22, 0xa3, 0x47, 0x68, 0xc7, 0x83, 0xe7, 0x94, 0x9c,
+  0xe3, 0xe2, 0xc0, 0x15, 0xf5, 0xab, 0x16, 0x31, 0xf6, 0x8e, 0x77, 0x13,
+  0xac, 0x12, 0x65, 0xc9, 0xdd, 0xda, 0xd9, 0xf2, 0xed, 0xd8, 0x6c, 0x04,
+  0x0b, 0x7d, 0x14, 0x22, 0x56, 0xe2, 0xb9, 0x74, 0xd8, 0xa7, 0xde, 0x54,
+  0x0e, 0x02, 0x06, 0x18, 0xad, 0xb0, 0xd0, 0x7f, 0xaa, 0x9a, 0x11, 0x50,
+  0x9d, 0x0f, 0x83, 0x5b, 0xbd, 0x6f, 0x78, 0xaa, 0xe3, 0x9b, 0xa3, 0x8f,
+  0xc3, 0x19, 0xd7, 0x72, 0x66, 0x3c, 0xcc, 0xd4, 0x5f, 0x10, 0xf0, 0xca,
+  0x49, 0x78, 0x86, 0x7c, 0xd9, 0xbe, 0x69, 0x19, 0x43, 0x33, 0x01, 0x08,
+  0x00, 0xe9, 0xbd, 0x0a, 0xe3, 0x55, 0xb4, 0xbe, 0x4f, 0xe7, 0xd4, 0x66,
+  0xb4, 0x76, 0x6c, 0xdd, 0xb1, 0x76, 0x55, 0xe2, 0xcb, 0xe1, 0x2f, 0x8b,
+  0x2a, 0x6d, 0x70, 0xba, 0xba, 0x0a, 0x5f, 0x26, 0xea, 0x19, 0x6b, 0x30,
+  0x0e, 0x56, 0xc7, 0x0e, 0x0f, 0xf2, 0x30, 0x5d, 0x18, 0xd5, 0x0f, 0xca,
+  0x45, 0xf7, 0xfc, 0xca, 0x47, 0x73, 0xbc, 0x2f, 0x1a, 0xb8, 0x11, 0x7a,
+  0x8f, 0x9c, 0x68, 0x5a, 0x8e, 0x2a, 0xcc, 0x5a, 0x78, 0xf3, 0x79, 0x30,
+  0x9c, 0x8a, 0x63, 0x95, 0x88, 0xf9, 0xff, 0x42, 0x35, 0xcc, 0xbc, 0x96,
+  0xb5, 0x3f, 0xad, 0x9d, 0x81, 0x98, 0x77, 0xc5, 0x38, 0x59, 0x6e, 0x02,
+  0x04, 0xbb, 0x50, 0x26, 0xa7, 0x2c, 0xf6, 0x3c, 0x24, 0x34, 0x56, 0xf3,
+  0xde, 0x74, 0x5e, 0xbd, 0x31, 0xa4, 0x7e, 0x12, 0x11, 0x8b, 0xa3, 0x65,
+  0x5d, 0x73, 0x7d, 0xa0, 0x9f, 0xf8, 0x9c, 0xac, 0x0d, 0x40, 0xa8, 0x37,
+  0x0c, 0xf7, 0x1a, 0x7e, 0x8c, 0x5b, 0x35, 0xbb, 0x5f, 0x1b, 0x87, 0xa5,
+  0xba, 0xa9, 0xd3, 0x81, 0x24, 0x09, 0xd5, 0xbe, 0x65, 0x25, 0xbd, 0xb9,
+  0xe0, 0x34, 0x9b, 0xb9, 0x2d, 0x8c, 0xe0, 0x14, 0xb1, 0x8c, 0x78, 0x8d,
+  0x54, 0x8e, 0x9a, 0x9c, 0xf3, 0x01, 0x00, 0xf2, 0x82, 0x86, 0x1b, 0xaa,
+  0x7a, 0x26, 0x53, 0xd9, 0xb8, 0x02, 0x41, 0x9d, 0x40, 0x84, 0x73, 0x61,
+  0xf1, 0x59, 0xe5, 0xb4, 0x7b, 0x67, 0x6f, 0x2a, 0xcb, 0xbb, 0x85, 0xfd,
+  0x7d, 0x70, 0x9a, 0x49, 0x04, 0x2e, 0xb5, 0x60, 0xb8, 0x36, 0x8a, 0x9a,
+  0x0d, 0xd9, 0x79, 0xb1, 0x50, 0xdf, 0x2d, 0xba, 0xc7, 0x9b, 0xfc, 0xdf,
+  0x1e, 0x06, 0xdf, 0x16, 0x86, 0x68, 0x81, 0xaf, 0xf4, 0xd6, 0x1e, 0x8c,
+  0x53, 0x5e, 0xf9, 0x13, 0xd6, 0x4b, 0x17, 0xd7, 0x18, 0xcc, 0x69, 0xc9,
+  0xc4, 0xe7, 0x75, 0x65, 0x5e, 0xcc, 0x32, 0xfe, 0x72, 0x31, 0x73, 0x5f,
+  0x3c, 0x40, 0xab, 0x78, 0x66, 0x95, 0x82, 0x06, 0x89, 0x5b, 0xbf, 0x96,
+  0xb0, 0x10, 0x9b, 0x1d, 0xef, 0x39, 0x63, 0x27, 0x2b, 0x3f, 0xa8, 0xd2,
+  0xe9, 0xbe, 0x9c, 0x25, 0x81, 0xaf, 0x62, 0x1a, 0x2e, 0xf8, 0x27, 0xb4,
+  0x63, 0x01, 0x4a, 0xc4, 0xc3, 0xdd, 0xe8, 0x4a, 0x9d, 0xf6, 0x7b, 0xb9,
+  0x4c, 0xef, 0xb2, 0xc9, 0x08, 0x65, 0x31, 0x3b, 0x11, 0xb7, 0x3c, 0x1a,
+  0x69, 0xd0, 0xa3, 0x04, 0xff, 0xc5, 0x8c, 0xa7, 0x88, 0x6f, 0xc3, 0x4f,
+  0x20, 0x00, 0xd4, 0xc6, 0xa9, 0x21, 0xa6, 0xfd, 0x1e, 0x7b, 0x25, 0x4c,
+  0x27, 0x7d, 0x8a, 0x68, 0x3d, 0x98, 0xb9, 0x1a, 0x35, 0xad, 0x51, 0x53,
+  0xff, 0x06, 0xf9, 0xe5, 0x8a, 0x2e, 0x87, 0xd2, 0x24, 0x4d, 0x3d, 0x3c,
+  0x7a, 0x3f, 0x3c, 0xc4, 0xc8, 0xde, 0xdf, 0x4d, 0x7b, 0xe3, 0x72, 0x2c,
+  0xac, 0xab, 0xec, 0x5c, 0xd2, 0xa8, 0xc3, 0x95, 0x89, 0xaa, 0xb4, 0x82,
+  0xe3, 0x3a, 0xdf, 0x95, 0x0c, 0x6a, 0x46, 0xb4, 0x27, 0xd8, 0x5d, 0x29,
+  0x4f, 0x79, 0xa4, 0x60, 0xf8, 0xd5, 0x5d, 0x18, 0xc4, 0x39, 0xe9, 0x5c,
+  0xdd, 0x45, 0x02, 0xfd, 0x75, 0x5a, 0xf9, 0x75, 0xf7, 0xee, 0xe9, 0xb1,
+  0x53, 0xcd, 0xb6, 0x71, 0x32, 0x62, 0x49, 0x1d, 0xd9, 0x59, 0x2f, 0x93,
+  0x0d, 0x30, 0x9c, 0xbe, 0x78, 0x30, 0xe9, 0x7a, 0x5c, 0xee, 0x07, 0x0d,
+  0x81, 0x81, 0x84, 0x13, 0x2a, 0x0d, 0xef, 0xb0, 0x9e, 0x83, 0x2b, 0xcd,
+  0x13, 0x02, 0x4e, 0x96, 0xcf, 0xa8, 0x19, 0x32, 0x87, 0xf4, 0xb7, 0x65,
+  0x2e, 0xff, 0x90, 0x77, 0xfc, 0x9a, 0x2d, 0xe4, 0x0f, 0x95, 0x14, 0x75,
+  0xab, 0xdd, 0xf6, 0x6c, 0x47, 0x6a, 0xb7, 0x1a, 0x81, 0x60, 0x22, 0x40,
+  0x98, 0xe3, 0x24, 0xb3, 0x28, 0x70, 0x94, 0x94, 0x49, 0xea, 0xee, 0xb1,
+  0x59, 0x0b, 0xea, 0x2b, 0x60, 0x10, 0x65, 0x2b, 0x8f, 0x3d, 0x3b, 0x10,
+  0xbb, 0x48, 0xa6, 0xf4, 0x70, 0xe4, 0x7f, 0x74, 0xeb, 0x37, 0x2c, 0x2e,
+  0xc2, 0x40, 0x0b, 0x28, 0xf9, 0xa5, 0x7f, 0x3e, 0x87, 0xf2, 0x27, 0xc3,
+  0x7f, 0x1f, 0x0c, 0x54, 0xf7, 0x08, 0x53, 0x60, 0x13, 0x2d, 0xca, 0x6c,
+  0xca, 0x5f, 0x4e, 0xc0, 0xeb, 0xaa, 0x67, 0xbb, 0x3b, 0xa7, 0xf9, 0x4d,
+  0xd4, 0x65, 0xc7, 0x89, 0xfd, 0x03, 0xdd, 0xc3, 0x20, 0x1c, 0x10, 0xb9,
+  0xa0, 0x4a, 0xd4, 0x03, 0x35, 0x80, 0xd3, 0xd6, 0xde, 0xd7, 0xa5, 0xca,
+  0x09, 0x9c, 0x09, 0x96, 0x5f, 0x3e, 0x16, 0x89, 0xff, 0xa6, 0x0c, 0xcb,
+  0x2b, 0x4b, 0x63, 0x38, 0x77, 0x2d, 0x77, 0x72, 0x4b, 0x41, 0x08, 0x2e,
+  0x52, 0xe2, 0x9d, 0x07, 0xda, 0x54, 0xdd, 0x11, 0xa7, 0xd9, 0xfa, 0xd2,
+  0x01, 0xc8, 0xb7, 0xc0, 0x23, 0x52, 0x14, 0xf9, 0x31, 0xcd, 0xf0, 0xc7,
+  0xbb, 0x36, 0xbb, 0x95, 0x9a, 0x37, 0x98, 0xbe, 0x72, 0xff, 0x17, 0x18,
+  0x04, 0x7d, 0xaa, 0xf6, 0xf7, 0x5b, 0xc1, 0xff, 0x35, 0x00, 0x30, 0x5f,
+  0x27, 0x4d, 0x0d, 0x6a, 0xe1, 0x3c, 0x24, 0x23, 0xbf, 0x8f, 0x19, 0xa0,
+  0x13, 0x66, 0x53, 0xfb, 0x0a, 0x2b, 0xc4, 0xcb, 0x2b, 0x61, 0x59, 0xba,
+  0x88, 0x34, 0xe0, 0x68, 0x4b, 0x2e, 0xf1, 0x39, 0x3e, 0xd8, 0x94, 0x26,
+  0x5c, 0x5d, 0x23, 0x2c, 0x07, 0x95, 0x95, 0x3f, 0xfa, 0xe8, 0xe0, 0x24,
+  0x68, 0x11, 0x56, 0xd0, 0x4a, 0xe8, 0xe1, 0x71, 0x74, 0x65, 0xe7, 0xfb,
+  0x17, 0xe4, 0x3d, 0xab, 0x48, 0x46, 0x79, 0x2e, 0x8b, 0x60, 0x31, 0x19,
+  0x2d, 0x7a, 0xcf, 0x82, 0xd4, 0xff, 0xf3, 0x72, 0xc4, 0xd5, 0xb8, 0xe1,
+  0x16, 0x3a, 0xe9, 0xb3, 0x77, 0xc0, 0xc4, 0xc6, 0x7d, 0x92, 0xb3, 0x7b,
+  0xd5, 0x0d, 0xe6, 0xb4, 0x7e, 0x1b, 0x8f, 0x61, 0xdf, 0xd0, 0xa0, 0xa9,
+  0x71, 0x7c, 0xf7, 0x93, 0xf2, 0x1e, 0x8c, 0xba, 0x2d, 0x9a, 0x3b, 0x48,
+  0x94, 0x5b, 0x6b, 0x93, 0x39, 0xa4, 0xe1, 0x94, 0x7e, 0x0e, 0x4d, 0xda,
+  0x70, 0xc8, 0x50, 0xe2, 0xf1, 0x32, 0x91, 0xf1, 0xad, 0x93, 0x1c, 0xd8,
+  0x2b, 0x41, 0xbf, 0x45, 0xd4, 0x86, 0xbd, 0xb3, 0x6d, 0x4a, 0xd7, 0x72,
+  0x99, 0xe1, 0xea, 0x7b, 0x1b, 0x41, 0x57, 0x35, 0x1c, 0x47, 0x3e, 0x1e,
+  0x4b, 0x0c, 0x9f, 0x66, 0xc8, 0x63, 0xa7, 0x40, 0xde, 0xf7, 0x03, 0x7f,
+  0x20, 0xbc, 0x86, 0x86, 0x16, 0xdc, 0xf4, 0xb6, 0x47, 0x49, 0x9b, 0x69,
+  0x3d, 0x92, 0x0c, 0xec, 0xd7, 0x0b, 0x82, 0x5b, 0x75, 0xbd, 0xb2, 0xa4,
+  0x5b, 0xaa, 0xc5, 0xe6, 0xfb, 0x94, 0x79, 0xfd, 0xa3, 0x5d, 0x08, 0x44,
+  0x56, 0x97, 0xca, 0x53, 0xf0, 0x2a, 0xd3, 0x68, 0xea, 0x37, 0x36, 0x2c,
+  0x89, 0x66, 0xc4, 0xab, 0xac, 0xfc, 0x05, 0xec, 0xd5, 0x74, 0x84, 0x15,
+  0xf4, 0x3a, 0x8f, 0x84, 0x86, 0x26, 0xd2, 0xc6, 0x35, 0x7e, 0x5d, 0x3c,
+  0xc3, 0x1d, 0xab, 0xee, 0xd7, 0x50, 0x86, 0x41, 0xde, 0x11, 0x75, 0xdc,
+  0x2b, 0x02, 0xd8, 0xb0, 0x25, 0xd7, 0xcc, 0x86, 0x91, 0x5b, 0xbc, 0x19,
+  0x23, 0xbd, 0x1a, 0x83, 0xaa, 0x6e, 0x0d, 0xf2, 0x60, 0xbd, 0x7e, 0xd9,
+  0x91, 0x92, 0x45, 0x2c, 0x21, 0xf0, 0xcb, 0x82, 0xb7, 0xa3, 0x72, 0xd4,
+  0x19, 0xb9, 0x59, 0xc9, 0x9d, 0x0c, 0x0f, 0x92, 0xf2, 0xd8, 0xac, 0xf2,
+  0xb3, 0xd4, 0x9e, 0x5b, 0x11, 0x29, 0x89, 0xde, 0xa1, 0xda, 0x1b, 0x53,
+  0xa8, 0x9a, 0xfc, 0x1c, 0xe6, 0x16, 0x2b, 0x3a, 0x3a, 0xf6, 0xdc, 0x34,
+  0x9e, 0x0b, 0xb4, 0x38, 0x0c, 0x60, 0x04, 0x5d, 0xab, 0x32, 0xe2, 0xb1,
+  0x31, 0x55, 0x6f, 0x46, 0xd6, 0x51, 0x72, 0xcb, 0x96, 0x8a, 0xc9, 0x6c,
+  0x47, 0x48, 0xf3, 0x73, 0xcf, 0xc0, 0x73, 0xeb, 0x7e, 0x50, 0x3f, 0x0e,
+  0x85, 0x9e, 0x2a, 0x1e, 0x47, 0x24, 0x57, 0x59, 0x46, 0x9a, 0x15, 0x5a,
+  0x5a, 0xd1, 0x62, 0x42, 0x67, 0xfe, 0x59, 0x58, 0xfb, 0xd9, 0xf8, 0xfc,
+  0xab, 0x11, 0x89, 0x9e, 0xbe, 0x9a, 0xe9, 0x0f, 0x41, 0xcd, 0x9a, 0x8f,
+  0xf7, 0x5b, 0x47, 0x85, 0xe5, 0xb1, 0xac, 0xbe, 0x4c, 0x78, 0x1e, 0x77,
+  0xff, 0x41, 0x9d, 0x42, 0x6a, 0xda, 0x14, 0xb6, 0xbe, 0x3b, 0x1d, 0x7b,
+  0xd7, 0xf3, 0x3e, 0x07, 0xb3, 0x80, 0x8f, 0x14, 0x95, 0xcc, 0xfe, 0xd0,
+  0x1b, 0xbc, 0xc2, 0xf5, 0xa3, 0x6d, 0x42, 0x15, 0xe1, 0x55, 0xcf, 0xe1,
+  0xca, 0xb9, 0xec, 0x57, 0xed, 0x2d, 0xb2, 0x46, 0xce, 0x35, 0x1f, 0xe2,
+  0x51, 0xe0, 0xe2, 0x37, 0x47, 0x85, 0x2a, 0xc3, 0x60, 0x8d, 0x26, 0xd3,
+  0xe0, 0xf9, 0xd9, 0xc3, 0xbe, 0xe7, 0xf8, 0xd5, 0xf9, 0xaf, 0x81, 0xa5,
+  0x6f, 0xc9, 0xe5, 0x4c, 0x72, 0x89, 0x88, 0x11, 0xc8, 0x68, 0x99, 0x47,
+  0xda, 0xda, 0x93, 0xb2, 0x86, 0xa6, 0x86, 0x9b, 0x2a, 0x9e, 0x54, 0xce,
+  0xfe, 0x30, 0x7b, 0xed, 0x13, 0x3c, 0xe0, 0x78, 0x7c, 0x17, 0xf2, 0x57,
+  0x40, 0x7a, 0x3b, 0x48, 0x55, 0xf7, 0x8a, 0x80, 0xc1, 0xfe, 0x5b, 0x62,
+  0x6d, 0xa8, 0x1b, 0x80, 0x7a, 0xb4, 0xbf, 0x2e, 0xbc, 0x53, 0xa4, 0x66,
+  0x32, 0xba, 0x40, 0x21, 0x19, 0x57, 0x73, 0xfa, 0x10, 0x83, 0xde, 0xf8,
+  0xa6, 0xe6, 0xb4, 0x83, 0x31, 0x1c, 0xa9, 0x53, 0x52, 0x0a, 0xc5, 0x63,
+  0x00, 0x4d, 0x08, 0xbd, 0x0d, 0x59, 0x4a, 0x83, 0x93, 0x2c, 0x47, 0x64,
+  0x69, 0x9c, 0xc7, 0xc4, 0x43, 0xa1, 0xa0, 0xa9, 0xa8, 0x8f, 0x53, 0x7f,
+  0xcb, 0xff, 0x31, 0x1e, 0xa1, 0x68, 0xa1, 0x70, 0x1f, 0xe1, 0x53, 0x28,
+  0xc4, 0xd0, 0x52, 0xb8, 0xec, 0x17, 0x31, 0x50, 0xb5, 0xd0, 0x63, 0x92,
+  0x05, 0xe8, 0x51, 0x12, 0x0a, 0xf7, 0xf6, 0x47, 0xd9, 0xed, 0x12, 0x87,
+  0x23, 0xab, 0x06, 0x3e, 0x42, 0xd0, 0xc4, 0xc2, 0x82, 0xca, 0x3b, 0x1d,
+  0xce, 0xf8, 0xd9, 0xb5, 0x3e, 0xf3, 0xf0, 0x26, 0x08, 0x12, 0x08, 0x2e,
+  0x2b, 0xc2, 0x58, 0x52, 0xda, 0xd5, 0x13, 0x87, 0xa4, 0xe2, 0xc2, 0x63,
+  0xbc, 0x75, 0xae, 0xb0, 0xa6, 0x6a, 0xe8, 0xf8, 0x0e, 0x24, 0x8d, 0x7e,
+  0x53, 0x53, 0x14, 0x17, 0x3a, 0x9e, 0xb0, 0xa0, 0xe8, 0xe3, 0xcd, 0x8d,
+  0x3d, 0xf7, 0x82, 0x71, 0xfa, 0x46, 0xc4, 0x29, 0x99, 0x61, 0x13, 0x9b,
+  0x84, 0x06, 0xdb, 0x08, 0x7d, 0xb9, 0x31, 0xc0, 0x18, 0x10, 0x57, 0xb5,
+  0xeb, 0x24, 0xfc, 0x4c, 0xe6, 0x0f, 0xbd, 0xcd, 0x90, 0xf9, 0xa8, 0xc0,
+  0x52, 0x35, 0xc5, 0xda, 0x43, 0x5e, 0x4e, 0x08, 0x4a, 0x90, 0x03, 0x75,
+  0x83, 0xbe, 0x07, 0xfe, 0xa9, 0xaf, 0x32, 0x83, 0x77, 0x24, 0x82, 0x1b,
+  0xd3, 0x6e, 0x46, 0x47, 0xbd, 0x32, 0xc2, 0x25, 0xd0, 0xa6, 0x9b, 0x7b,
+  0xac, 0x00, 0x7b, 0x34, 0xbd, 0xda, 0x01, 0x4d, 0xa7, 0x0f, 0x3e, 0x2b,
+  0x67, 0x65, 0x76, 0xe0, 0xbe, 0x40, 0x53, 0xb6, 0xc6, 0xdc, 0x68, 0xde,
+  0x08, 0x73, 0x9d, 0x2f, 0x47, 0x26, 0x83, 0xbb, 0xa8, 0xbc, 0x5d, 0xcc,
+  0xcd, 0x91, 0xcd, 0x6e, 0x44, 0x33, 0xd7, 0xcf, 0x8b, 0x71, 0x46, 0x03,
+  0xe6, 0x33, 0xbd, 0x3a, 0x54, 0x8e, 0x52, 0xd1, 0xe9, 0xa3, 0x44, 0x13,
+  0xd9, 0x29, 0x5f, 0x73, 0x0c, 0x02, 0x9b, 0x92, 0x6e, 0x2e, 0xf4, 0xc7,
+  0xb4, 0xb3, 0x5e, 0xfe, 0xeb, 0x2e, 0x5a, 0x60, 0x86, 0xc9, 0xac, 0xc9,
+  0x13, 0xe8, 0xcb, 0xe2, 0xd1, 0xa3, 0x56, 0xaa, 0x23, 0xe7, 0x16, 0x04,
+  0xe1, 0x73, 0xee, 0x53, 0x0b, 0x87, 0xab, 0x1f, 0x3a, 0xd0, 0x24, 0x49,
+  0x91, 0x81, 0x04, 0x7b, 0xf4, 0xb1, 0x28, 0xd7, 0x5a, 0x1d, 0x99, 0xda,
+  0x5d, 0xe3, 0xb2, 0xe6, 0x03, 0x98, 0x43, 0x15, 0x1b, 0x89, 0x10, 0x57,
+  0x51, 0xd3, 0x5e, 0xa2, 0x5d, 0xe5, 0xc2, 0xde, 0xdb, 0x1c, 0xf2, 0x66,
+  0xc7, 0x30, 0x92, 0xc5, 0x04, 0xaf, 0xe5, 0x7f, 0x4a, 0xac, 0x22, 0x0b,
+  0xb7, 0x3d, 0x62, 0x25, 0x26, 0xf3, 0xff, 0xc0, 0x79, 0xe2, 0xe3, 0x14,
+  0x0e, 0x22, 0xa6, 0x72, 0xf6, 0xd6, 0x48, 0x61, 0x1f, 0x6b, 0x2b, 0x1d,
+  0xd3, 0x12, 0x45, 0x2d, 0x2e, 0x69, 0x9a, 0xbf, 0xac, 0xfd, 0x1a, 0xef,
+  0x01, 0x94, 0xb4, 0xaf, 0x36, 0xe3, 0xa6, 0xd5, 0xe3, 0xe1, 0xab, 0xea,
+  0x66, 0x0c, 0xf3, 0x4d, 0x58, 0x04, 0x59, 0xbe, 0xb4, 0x27, 0xbc, 0x42,
+  0xed, 0xca, 0x09, 0xe7, 0xe8, 0x9f, 0xf1, 0x28, 0x5a, 0xaa, 0xb5, 0x10,
+  0x68, 0x10, 0x3b, 0x79, 0xd2, 0xa8, 0xe5, 0x30, 0x00, 0xea, 0x34, 0xcf,
+  0x41, 0x96, 0x47, 0xab, 0xed, 0xa7, 0x8c, 0xc8, 0x9d, 0x2f, 0x9f, 0xfd,
+  0x5f, 0xfb, 0x1b, 0xb6, 0x16, 0xeb, 0x65, 0xfe, 0xc9, 0xb3, 0x80, 0x06,
+  0x0b, 0xfd, 0x54, 0xf3, 0x31, 0x14, 0x3b, 0x4f, 0x84, 0x83, 0xb0, 0x4a,
+  0x56, 0x37, 0x47, 0xec, 0x4d, 0x81, 0xb4, 0xa7, 0xf1, 0x4d, 0x61, 0x7b,
+  0xd5, 0x26, 0x21, 0xdc, 0x5c, 0x5c, 0x3c, 0xc6, 0x73, 0x7e, 0xf6, 0x1a,
+  0x40, 0x18, 0xa3, 0x17, 0xda, 0x58, 0x99, 0x4f, 0xa2, 0x09, 0xbe, 0x75,
+  0x09, 0x02, 0x18, 0x67, 0x19, 0x18, 0x99, 0x65, 0xd8, 0xff, 0x30, 0x1b,
+  0x34, 0x36, 0xe6, 0x3a, 0x14, 0xe2, 0xfe, 0xe7, 0x01, 0xe9, 0xfc, 0x78,
+  0x3e, 0xd2, 0xd5, 0x68, 0x49, 0x7d, 0x5e, 0x11, 0xfb, 0x04, 0x51, 0x97,
+  0xaf, 0xa3, 0xcd, 0xed, 0x57, 0xf8, 0x13, 0x19, 0xa7, 0xc3, 0x52, 0x16,
+  0xdb, 0x89, 0xfc, 0x3b, 0xf7, 0x8e, 0x8a, 0x63, 0x5d, 0x54, 0x22, 0xb5,
+  0xbf, 0xb6, 0x97, 0x94, 0x1f, 0x6c, 0xea, 0xe6, 0x1c, 0xb9, 0xd7, 0x9c,
+  0x05, 0x37, 0x79, 0x24, 0x5b, 0xc6, 0xff, 0x2a, 0x06, 0x3b, 0x4b, 0x1c,
+  0x2a, 0x5a, 0x2d, 0x3b, 0x53, 0x3c, 0x2c, 0xd2, 0xe8, 0xb2, 0xef, 0x1d,
+  0x2b, 0xe8, 0x65, 0xc7, 0xc1, 0xf9, 0x4d, 0xdd, 0xcd, 0xd4, 0xec, 0x53,
+  0x2a, 0xf7, 0xc2, 0x8f, 0x87, 0x60, 0x99, 0xd5, 0x71, 0x80, 0xcc, 0xdc,
+  0x8a, 0x93, 0x10, 0xd4, 0xc6, 0xdf, 0x6e, 0x09, 0xa0, 0x66, 0x6f, 0xec,
+  0x36, 0x52, 0x45, 0xc1, 0x77, 0x2f, 0xae, 0x3a, 0x34, 0x5d, 0xcb, 0xd0,
+  0xbe, 0x2f, 0xf2, 0x31, 0x83, 0x7b, 0x14, 0x48, 0xe1, 0x96, 0x15, 0x0c,
+  0x32, 0x1c, 0x36, 0x37, 0x3c, 0x17, 0x28, 0x4a, 0xdf, 0x72, 0xc2, 0xc2,
+  0xec, 0xde, 0xeb, 0x6e, 0x46, 0x5d, 0xb2, 0x7f, 0xe9, 0x46, 0xea, 0xfb,
+  0x7a, 0x21, 0xa6, 0x9c, 0x67, 0xe0, 0x96, 0x0e, 0x4c, 0xbd, 0xc2, 0xfd,
+  0x03, 0x4c, 0x6d, 0xe2, 0x6a, 0xdd, 0xd3, 0x7b, 0x8e, 0x68, 0xf4, 0xad,
+  0x69, 0x16, 0xec, 0xd0, 0x1f, 0xcc, 0xf0, 0xb3, 0x62, 0x9e, 0x9a, 0x4f,
+  0x3c, 0x63, 0xeb, 0x4a, 0xb0, 0x9f, 0x5c, 0x16, 0xf6, 0x30, 0x7b, 0xb8,
+  0x83, 0x13, 0x55, 0xae, 0xf9, 0x40, 0x9d, 0x74, 0x3c, 0x69, 0x55, 0x2c,
+  0xbe, 0xaa, 0xc5, 0x28, 0x8e, 0xc7, 0x29, 0x4b, 0x3d, 0xd3, 0xe9, 0xb2,
+  0x10, 0xad, 0x66, 0xd5, 0x43, 0xe3, 0xc2, 0x84, 0x2c, 0x2c, 0x8f, 0x48,
+  0xe4, 0xaa, 0x9e, 0x62, 0xd5, 0xd6, 0x63, 0x7e, 0x5a, 0xa4, 0xde, 0xfa,
+  0x0f, 0x93, 0xcc, 0x43, 0xb4, 0x32, 0x12, 0x71, 0xa6, 0x79, 0xa0, 0xb6,
+  0xd0, 0x24, 0x10, 0xc9, 0xaa, 0x15, 0x5f, 0xbd, 0x9e, 0x86, 0x9e, 0xa9,
+  0x03, 0xd7, 0xa0, 0xd0, 0x9c, 0x33, 0x02, 0x81, 0xc0, 0x32, 0xfb, 0x5a,
+  0x2d, 0x2b, 0xaa, 0x99, 0xa0, 0x6f, 0xec, 0x6f, 0x4a, 0x3a, 0x17, 0x01,
+  0x44, 0x14, 0x93, 0x1e, 0xa2, 0x8f, 0xab, 0x20, 0x4a, 0x61, 0xb0, 0xfd,
+  0xf0, 0x27, 0x5f, 0x48, 0x37, 0x1b, 0xf0, 0xb8, 0xb0, 0xb8, 0xf9, 0x16,
+  0x40, 0x41, 0xfa, 0x11, 0xe9, 0x64, 0x01, 0x60, 0xce, 0x74, 0xa6, 0xb0,
+  0x96, 0x4b, 0x0b, 0xd8, 0x27, 0x4f, 0x44, 0xc2, 0x5a, 0x60, 0x96, 0x81,
+  0x09, 0x60, 0x77, 0xad, 0x58, 0xc9, 0xba, 0x07, 0xad, 0xf5, 0xe7, 0xc4,
+  0xc4, 0xbc, 0x35, 0x8d, 0xbe, 0x4c, 0xb7, 0xd5, 0x3a, 0x7c, 0x92, 0x7d,
+  0x0d, 0xc1, 0x92, 0x8b, 0x5b, 0x74, 0x0b, 0xf1, 0x78, 0x8b, 0x35, 0x9c,
+  0xd2, 0x6e, 0x94, 0xa7, 0x00, 0xe1, 0x9f, 0x98, 0x13, 0x01, 0x06, 0x15,
+  0xa1, 0x75, 0xea, 0xe1, 0xfe, 0xae, 0x96, 0xf8, 0xff, 0xff, 0xd9, 0xeb,
+  0xd1, 0x95, 0x7a, 0x28, 0x82, 0x02, 0x7d, 0x20, 0x69, 0xa3, 0x11, 0x4b,
+  0x08, 0xf9, 0x9d, 0xbf, 0xb4, 0x1d, 0xdc, 0x60, 0xa6, 0x3d, 0x73, 0x1e,
+  0x3e, 0x45, 0xb2, 0xf4, 0x50, 0x06, 0x63, 0xd7, 0xc9, 0x86, 0xa8, 0xda,
+  0xd8, 0xac, 0x75, 0x77, 0x65, 0xbb, 0xc3, 0xbe, 0x2a, 0xc8, 0x4e, 0x90,
+  0x06, 0x1d, 0xd3, 0x5f, 0x19, 0x59, 0xdd, 0x77, 0xdb, 0xda, 0xbc, 0xd1,
+  0xf8, 0x22, 0x2a, 0xce, 0x76, 0x00, 0x03, 0x63, 0x9a, 0x50, 0xd1, 0xbb,
+  0x87, 0xcb, 0xc1, 0x51, 0x37, 0x52, 0x0e, 0x8a, 0xa9, 0xd9, 0x17, 0xdf,
+  0x6d, 0x90, 0xa9, 0xdc, 0x9f, 0xcc, 0x42, 0xa9, 0xcc, 0xfd, 0x77, 0x7a,
+  0x03, 0xda, 0x72, 0x61, 0x89, 0x63, 0x59, 0x53, 0x0f, 0x9a, 0x06, 0x96,
+  0x8e, 0x38, 0xf6, 0x26, 0xe5, 0x63, 0xa1, 0x63, 0xc2, 0x3b, 0x45, 0xa9,
+  0x58, 0xa5, 0xd8, 0xf9, 0xfd, 0x64, 0x61, 0x0a, 0xea, 0x7f, 0xd7, 0x62,
+  0x75, 0x82, 0xd4, 0xd3, 0x68, 0x51, 0xc3, 0xbf, 0x27, 0xa1, 0x0d, 0x0c,
+  0xd3, 0x96, 0xff, 0x65, 0xa7, 0xff, 0x9b, 0xf0, 0x15, 0x7a, 0xba, 0x39,
+  0xb9, 0x0f, 0x45, 0xb6, 0xd9, 0x9a, 0xa4, 0x2b, 0x04, 0x25, 0x7e, 0x27,
+  0x34, 0xbc, 0x2e, 0x74, 0xff, 0xc7, 0x0a, 0xe6, 0x97, 0x23, 0x7e, 0x11,
+  0xa5, 0x8b, 0xd9, 0xbc, 0x29, 0xa5, 0x75, 0x8b, 0xd6, 0x8d, 0x3c, 0xfc,
+  0xa8, 0xb5, 0x4a, 0x45, 0x4e, 0xee, 0x3d, 0x44, 0x70, 0x7d, 0xa0, 0x69,
+  0x3e, 0x4d, 0x3e, 0x71, 0x2a, 0xd8, 0x52, 0xfa, 0x64, 0x1b, 0x88, 0xd8,
+  0x49, 0x92, 0xcf, 0x09, 0xec, 0x23, 0x8c, 0xa5, 0x9f, 0x65, 0x51, 0x0a,
+  0x3b, 0x42, 0xb6, 0xe5, 0x0f, 0x79, 0xaa, 0x6c, 0x62, 0x59, 0xc3, 0x38,
+  0x73, 0x24, 0x82, 0x0d, 0x83, 0x77, 0xe4, 0x72, 0x80, 0x3b, 0xb6, 0x3b,
+  0xc5, 0x66, 0xb2, 0xed, 0x82, 0x54, 0x4c, 0xbe, 0x63, 0x0c, 0x61, 0xa7,
+  0xee, 0x3c, 0x23, 0x25, 0xbd, 0xff, 0x4c, 0x05, 0xf0, 0xd2, 0x41, 0xe0,
+  0x2f, 0x7a, 0xa4, 0x30, 0x13, 0x07, 0x4f, 0x10, 0xfb, 0x6f, 0xfc, 0xfe,
+  0x1a, 0xd4, 0x5c, 0xda, 0x29, 0x8d, 0xe7, 0x12, 0xf3, 0xb1, 0x10, 0xce,
+  0x91, 0x93, 0xf7, 0xee, 0xe6, 0x5a, 0x2d, 0x45, 0x62, 0x3b, 0xe3, 0x22,
+  0x3d, 0xc9, 0x67, 0xf2, 0x2d, 0x63, 0x6b, 0x56, 0x72, 0xa4, 0xb5, 0xa2,
+  0xe2, 0xe0, 0x18, 0x40, 0x78, 0xd0, 0x7d, 0x8a, 0x02, 0xae, 0x45, 0x9f,
+  0x5f, 0xa5, 0xdb, 0x9a, 0x63, 0x59, 0x5b, 0x00, 0x9f, 0xe7, 0x08, 0xf6,
+  0x71, 0x67, 0xff, 0x77, 0x06, 0xcd, 0xe9, 0x40, 0x1d, 0x1b, 0xf2, 0x7b,
+  0xf0, 0x9e, 0x7d, 0x8c, 0x0f, 0x96, 0x63, 0x0a, 0xbc, 0x33, 0x26, 0xfb,
+  0x76, 0x46, 0x36, 0xf0, 0x8f, 0x02, 0x64, 0x77, 0x32, 0x6e, 0xdd, 0xe8,
+  0x53, 0xdd, 0xbe, 0xb7, 0x13, 0xc4, 0x28, 0xa3, 0xb7, 0x16, 0x55, 0xd0,
+  0x45, 0xbb, 0x21, 0x64, 0x83, 0x2d, 0x95, 0xc4, 0x88, 0xd2, 0xad, 0x94,
+  0x31, 0x2e, 0xdb, 0x9c, 0x76, 0x17, 0xa9, 0x07, 0xa8, 0x74, 0x04, 0x4a,
+  0x08, 0x4c, 0x1d, 0xa6, 0x90, 0x52, 0xe1, 0xf0, 0xd3, 0x38, 0x38, 0x1f,
+  0xda, 0xc2, 0x23, 0x4f, 0xe2, 0xe8, 0x4f, 0x6f, 0x7d, 0xbc, 0x72, 0x8b,
+  0xdb, 0x34, 0xba, 0x0b, 0xe4, 0x0f, 0x72, 0xc7, 0xf8, 0xe8, 0x73, 0x9e,
+  0xf3, 0x08, 0x1c, 0xc9, 0xe6, 0x0a, 0xc1, 0xef, 0xb7, 0x1a, 0x37, 0x4f,
+  0x0c, 0xa0, 0x0a, 0x2a, 0xfa, 0xa7, 0xa2, 0xde, 0xb6, 0x15, 0x6e, 0x05,
+  0xdc, 0x70, 0x18, 0x90, 0x4b, 0x27, 0x46, 0x55, 0x1a, 0x6a, 0xb4, 0xf5,
+  0x86, 0x10, 0xe8, 0x08, 0xe6, 0x56, 0x5f, 0x7e, 0xbb, 0xea, 0xa7, 0xd4,
+  0xdf, 0x5a, 0x3b, 0x71, 0xa0, 0x78, 0x19, 0x44, 0xf8, 0xb6, 0x1d, 0x0c,
+  0x18, 0xa5, 0xff, 0xb0, 0x62, 0xe3, 0x6b, 0xf8, 0x43, 0x76, 0xbb, 0xda,
+  0xfd, 0x34, 0xa4, 0xf3, 0x1f, 0x75, 0x50, 0x0f, 0x31, 0xd5, 0x97, 0xd0,
+  0x67, 0x2c, 0x04, 0x6d, 0x62, 0x4f, 0x7b, 0x58, 0xcf, 0xd1, 0x3b, 0xa5,
+  0xa4, 0x89, 0x0b, 0x72, 0xdd, 0x51, 0x5d, 0x95, 0xcd, 0xca, 0xb2, 0xb2,
+  0xf2, 0xc6, 0xfd, 0x78, 0x7e, 0xfd, 0x79, 0xec, 0x5b, 0xc0, 0xe9, 0x20,
+  0x29, 0x08, 0x97, 0xf5, 0xab, 0x43, 0x66, 0x7c, 0xfa, 0xab, 0xb5, 0xc0,
+  0xe6, 0xb2, 0x18, 0x18, 0xd2, 0x5e, 0x6c, 0x04, 0xeb, 0x5d, 0x7f, 0xa7,
+  0x01, 0x58, 0xf9, 0xbb, 0x46, 0xfb, 0x0c, 0xac, 0x2a, 0x0b, 0x65, 0x36,
+  0x4b, 0x1b, 0x93, 0xdc, 0x9e, 0xa2, 0x48, 0x9a, 0xe6, 0x62, 0x41, 0x38,
+  0x0d, 0xaf, 0x75, 0x91, 0x46, 0xc7, 0x62, 0xcd, 0xba, 0x8d, 0x7f, 0x89,
+  0x1a, 0xc0, 0xc6, 0xe6, 0x01, 0xa4, 0xd6, 0xa6, 0x14, 0xb0, 0x3d, 0xd8,
+  0x9d, 0x81, 0x2a, 0xa8, 0x18, 0x41, 0xcb, 0x4f, 0xbb, 0x68, 0x12, 0xa0,
+  0x61, 0x89, 0x26, 0x9f, 0x20, 0x7b, 0x2c, 0x69, 0x7d, 0x7e, 0x60, 0x37,
+  0x20, 0xab, 0xae, 0x0e, 0xa2, 0x00, 0x91, 0xf5, 0x67, 0x99, 0x80, 0x76,
+  0xa1, 0x59, 0x8c, 0x99, 0xc7, 0xe0, 0x12, 0x2f, 0xcc, 0xa4, 0xd0, 0x7b,
+  0x16, 0x0e, 0x8e, 0x20, 0x20, 0xd2, 0x0d, 0x1a, 0x90, 0x24, 0xfe, 0xfa,
+  0x25, 0xb5, 0x24, 0x4a, 0x9e, 0x51, 0x19, 0x85, 0x4c, 0x5d, 0x5c, 0x56,
+  0x2a, 0x65, 0x35, 0xb1, 0x72, 0xd5, 0x71, 0xaa, 0x2b, 0xc6, 0x70, 0xde,
+  0x4d, 0xd7, 0x35, 0x02, 0x2b, 0x66, 0x45, 0x1b, 0x2b, 0x40, 0x09, 0x1c,
+  0x53, 0xd0, 0x19, 0xe3, 0xa1, 0x8d, 0xd9, 0x31, 0xfe, 0xdd, 0xa5, 0x51,
+  0x62, 0xac, 0x00, 0xb0, 0x16, 0x22, 0x7e, 0x3b, 0x7f, 0x99, 0x4e, 0xdf,
+  0x11, 0x7b, 0x11, 0x0a, 0x69, 0xd6, 0x31, 0xff, 0x35, 0xa9, 0x97, 0xef,
+  0xfa, 0x91, 0x4c, 0xef, 0x90, 0xb3, 0xc0, 0x3e, 0xb9, 0xe6, 0x0f, 0x26,
+  0x85, 0xae, 0xfa, 0xc3, 0xfa, 0x3c, 0x40, 0xf9, 0x03, 0x6d, 0xe3, 0xa9,
+  0x5b, 0x5a, 0x24, 0xc7, 0xfb, 0x95, 0xc5, 0xd4, 0x5a, 0x40, 0x97, 0xd0,
+  0xd4, 0x42, 0x55, 0xb1, 0x98, 0x7e, 0x94, 0x21, 0xb3, 0x5c, 0xcb, 0xb3,
+  0x35, 0x4f, 0x39, 0x29, 0x3e, 0xac, 0x85, 0xa6, 0x9c, 0x1e, 0x61, 0x09,
+  0x51, 0xc3, 0xcb, 0x3d, 0x20, 0x09, 0xe3, 0xc0, 0x0d, 0x83, 0x35, 0x1f,
+  0x57, 0x37, 0xfe, 0xe5, 0x44, 0x48, 0x81, 0xfd, 0x75, 0x02, 0xf3, 0x7b,
+  0xc9, 0x1b, 0x5e, 0xe3, 0xdc, 0x29, 0xb0, 0xc4, 0x53, 0xc1, 0x26, 0x52,
+  0xd7, 0x7d, 0xa0, 0xd5, 0x48, 0x05, 0xfb, 0x0e, 0x30, 0x0b, 0x0e, 0xd0,
+  0x0a, 0xb6, 0x29, 0x32, 0x4a, 0x0b, 0xa3, 0x70, 0xd7, 0x20, 0x5c, 0x75,
+  0x01, 0x80, 0xd6, 0x69, 0x60, 0xa4, 0xeb, 0x5b, 0x22, 0x02, 0x83, 0xab,
+  0x90, 0xfd, 0x05, 0x84, 0x73, 0xc2, 0x3e, 0x13, 0x69, 0xd7, 0xfd, 0x17,
+  0xda, 0x41, 0xf4, 0x02, 0xb9, 0x2a, 0x12, 0xf8, 0x27, 0x30, 0x97, 0x5d,
+  0x16, 0x63, 0x6a, 0x86, 0xe9, 0xa3, 0xf1, 0xdd, 0xd0, 0x22, 0x7a, 0x09,
+  0x5b, 0x16, 0x3e, 0x36, 0x77, 0xb7, 0x50, 0x27, 0x66, 0x7b, 0xa0, 0xcb,
+  0xaa, 0xd3, 0xac, 0x31, 0xe8, 0x4e, 0x54, 0x98, 0xa6, 0xe7, 0x29, 0xde,
+  0x0b, 0xe7, 0xa7, 0x3c, 0x81, 0xde, 0xe3, 0x62, 0x40, 0x01, 0xa5, 0x9f,
+  0x4c, 0x81, 0xa9, 0xdc, 0xcd, 0xe6, 0xf2, 0x95, 0xe2, 0xbf, 0x86, 0x30,
+  0xe9, 0x0c, 0x79, 0x89, 0x69, 0xa2, 0xe3, 0x53, 0x81, 0x20, 0x6b, 0x8b,
+  0x9f, 0xa2, 0x95, 0xf4, 0x0d, 0x12, 0x4b, 0x79, 0x6c, 0xd6, 0x88, 0x86,
+  0x82, 0x1a, 0x29, 0xad, 0xb7, 0xe9, 0x49, 0xc9, 0xa1, 0x40, 0x0e, 0x32,
+  0x91, 0xf4, 0x0f, 0x41, 0x2c, 0x2b, 0xc0, 0xd8, 0xd0, 0x4b, 0x3d, 0x7e,
+  0x5a, 0x7e, 0xce, 0x97, 0x0d, 0x62, 0xc2, 0xee, 0xbd, 0xa4, 0x7d, 0xe6,
+  0x3d, 0x50, 0x96, 0x6b, 0x3f, 0x48, 0x19, 0x4e, 0x42, 0x33, 0xb7, 0x94,
+  0x58, 0x42, 0x20, 0x14, 0x8c, 0xdc, 0xd9, 0xd2, 0x12, 0x09, 0x17, 0x84,
+  0x14, 0x14, 0xc8, 0x69, 0x9c, 0x20, 0x7b, 0xbb, 0x56, 0xf9, 0x51, 0x92,
+  0x4e, 0xb9, 0xae, 0x92, 0xe5, 0x40, 0x6b, 0x8b, 0xe1, 0x14, 0x33, 0x5a,
+  0xb5, 0x52, 0x60, 0x95, 0x08, 0xa8, 0xec, 0x74, 0x45, 0xf4, 0xff, 0xfb,
+  0x15, 0x83, 0x09, 0x4d, 0xee, 0x00, 0x99, 0x3d, 0x8c, 0xcc, 0x04, 0x45,
+  0x10, 0xba, 0xdc, 0xc6, 0xa2, 0x65, 0x48, 0xd3, 0x2b, 0xde, 0xaf, 0xb5,
+  0x0c, 0xf5, 0xe1, 0x6c, 0xaa, 0xee, 0x52, 0x5b, 0xf4, 0xf9, 0x06, 0x21,
+  0x76, 0x18, 0xfb, 0xc4, 0x13, 0xba, 0x5c, 0xea, 0xe1, 0xda, 0xaa, 0xae,
+  0x29, 0xb2, 0x8b, 0xa0, 0x88, 0x3f, 0x44, 0x9f, 0x73, 0xaa, 0xce, 0x4a,
+  0x18, 0x7e, 0xbd, 0xef, 0xf7, 0x97, 0xe2, 0x36, 0xfe, 0x30, 0x42, 0x04,
+  0x49, 0x7c, 0x07, 0x90, 0xdb, 0x5a, 0xa5, 0x4d, 0x13, 0x7d, 0xb3, 0xa1,
+  0x6b, 0xa5, 0x09, 0xb1, 0x9f, 0x92, 0x52, 0xdc, 0xd4, 0x34, 0xa3, 0xcc,
+  0x00, 0x94, 0x35, 0x71, 0x58, 0x8a, 0x31, 0xb5, 0x15, 0xd0, 0x11, 0x01,
+  0x55, 0xe3, 0xc0, 0xaa, 0x1c, 0xa3, 0x79, 0x67, 0x75, 0xb0, 0x38, 0x74,
+  0x46, 0xa1, 0x23, 0x08, 0x18, 0xbb, 0xfd, 0x2f, 0xe0, 0xee, 0xd3, 0x71,
+  0xd1, 0x95, 0x8a, 0x30, 0x7c, 0x1f, 0x7b, 0x13, 0xc4, 0x60, 0xf9, 0xd5,
+  0x1a, 0x07, 0xf7, 0x73, 0x3b, 0x7d, 0xc7, 0x53, 0x75, 0xa1, 0xe5, 0xa0,
+  0xf0, 0x3a, 0xb6, 0x72, 0xb0, 0x68, 0x37, 0x28, 0x28, 0x5b, 0x59, 0x26,
+  0xec, 0x0f, 0x0b, 0x5c, 0x7d, 0xce, 0x7b, 0x4d, 0x61, 0x70, 0xb6, 0x10,
+  0xf6, 0x79, 0x37, 0x3e, 0xff, 0xdb, 0xb7, 0x1e, 0xa2, 0x86, 0xf0, 0x70,
+  0xfa, 0x52, 0x81, 0xdf, 0xbd, 0x28, 0x33, 0x1c, 0x3e, 0xd8, 0xff, 0xbd,
+  0x21, 0x88, 0x6b, 0x67, 0x99, 0xe4, 0x59, 0x57, 0xee, 0x6d, 0x46, 0x81,
+  0xe1, 0x02, 0xa0, 0x01, 0x9a, 0xa3, 0xc8, 0x34, 0x60, 0x66, 0xe9, 0xf4,
+  0x06, 0x6f, 0x41, 0xcd, 0xef, 0x9c, 0x83, 0x9c, 0x3c, 0x05, 0x2f, 0x99,
+  0x1b, 0x3b, 0x59, 0x6c, 0x9c, 0x3a, 0x0e, 0x9a, 0xfb, 0x52, 0xaa, 0xf1,
+  0x97, 0x51, 0x80, 0xa1, 0x40, 0xa8, 0x1e, 0xe0, 0xdb, 0x2d, 0xba, 0xe3,
+  0xab, 0x34, 0x3d, 0xd6, 0x97, 0xe8, 0xcb, 0x3a, 0xa7, 0xb9, 0x62, 0x3a,
+  0xbd, 0xc7, 0xea, 0x4b, 0xb1, 0x7f, 0x12, 0x4c, 0x2d, 0x5d, 0x97, 0x32,
+  0x39, 0x94, 0xae, 0xa4, 0xc3, 0x7e, 0xd7, 0x98, 0x3d, 0x2c, 0x57, 0x86,
+  0xf6, 0x94, 0x0e, 0xbc, 0x47, 0xe0, 0x38, 0x60, 0x8a, 0x26, 0x90, 0x76,
+  0x61, 0x34, 0x87, 0xdd, 0xc2, 0xc7, 0x0b, 0xa4, 0x37, 0x37, 0xed, 0xc2,
+  0x13, 0x03, 0x36, 0xca, 0x12, 0xb4, 0xc8, 0x3b, 0xc8, 0x93, 0x17, 0x37,
+  0xe9, 0x99, 0x3e, 0xdc, 0xc1, 0x13, 0xab, 0x42, 0x89, 0xb9, 0xc8, 0x21,
+  0xfc, 0x37, 0x73, 0xe4, 0x95, 0x53, 0x42, 0x84, 0x2e, 0x7a, 0x3f, 0xdd,
+  0x7d, 0xa5, 0x7f, 0x02, 0xa5, 0xbc, 0x90, 0x0b, 0x7a, 0x41, 0x50, 0xc5,
+  0x98, 0xb7, 0x2b, 0xaf, 0x82, 0x48, 0xfa, 0x0b, 0x10, 0x1a, 0x54, 0x49,
+  0x91, 0x8f, 0x23, 0xdb, 0x13, 0xf7, 0x8c, 0x66, 0x46, 0x4e, 0x0c, 0x3c,
+  0x41, 0x7d, 0x28, 0x65, 0x2b, 0x2a, 0xcf, 0xe7, 0xda, 0xe5, 0xce, 0xab,
+  0x41, 0xb6, 0x63, 0x12, 0xa3, 0x0f, 0x90, 0xa7, 0x7a, 0x1c, 0x3d, 0x3f,
+  0x34, 0x7d, 0x69, 0x7e, 0x8b, 0x87, 0x66, 0x1f, 0x4f, 0x67, 0x8c, 0x88,
+  0x57, 0x6e, 0xe7, 0x32, 0x7e, 0x1a, 0x0c, 0x6f, 0x9e, 0x6a, 0x01, 0x5a,
+  0x97, 0x6d, 0x96, 0xff, 0x98, 0x4d, 0x28, 0xf8, 0x8d, 0xfd, 0xf5, 0xad,
+  0xe4, 0x3d, 0x6a, 0xe3, 0x2f, 0x5a, 0x7c, 0x28, 0x8f, 0x35, 0x0e, 0x38,
+  0x3e, 0xab, 0x88, 0x2d, 0x42, 0x8c, 0x7e, 0xca, 0x24, 0x0c, 0x4f, 0x10,
+  0x64, 0xe3, 0x04, 0x6a, 0xd8, 0xac, 0xe0, 0x7d, 0x5d, 0x75, 0x4b, 0x28,
+  0x55, 0x36, 0x9f, 0x33, 0x42, 0xf5, 0x4e, 0x3e, 0x66, 0xdc, 0x45, 0x04,
+  0x41, 0xa4, 0x25, 0x1f, 0x63, 0xaa, 0x8f, 0xcd, 0x1e, 0x78, 0x76, 0xbb,
+  0x76, 0x5e, 0xe7, 0xbc, 0x3a, 0x9a, 0x9e, 0x92, 0xbe, 0xbb, 0x6c, 0x9d,
+  0x0b, 0xac, 0x73, 0x04, 0xb0, 0x2d, 0x51, 0x8c, 0xb8, 0xfd, 0xe1, 0xb7,
+  0x5a, 0x0b, 0xe9, 0xda, 0xee, 0x87, 0x43, 0x3e, 0x58, 0xde, 0xe5, 0xe9,
+  0x72, 0xc5, 0x8f, 0x1d, 0xae, 0xe2, 0x18, 0x1a, 0xee, 0x00, 0x85, 0x58,
+  0xe9, 0xa9, 0x90, 0x27, 0x5f, 0x39, 0x22, 0x54, 0xc7, 0xf3, 0x9c, 0x75,
+  0xa3, 0x25, 0x65, 0x83, 0x51, 0x6d, 0x79, 0xca, 0xdf, 0x5a, 0x7b, 0x4e,
+  0xda, 0x6c, 0x60, 0xbc, 0xf2, 0xfa, 0x31, 0xea, 0xab, 0x80, 0x58, 0x60,
+  0x17, 0x94, 0x24, 0x25, 0x67, 0x07, 0xc2, 0x79, 0x87, 0x91, 0xf9, 0x49,
+  0x12, 0x16, 0x50, 0xb2, 0x02, 0x7d, 0x37, 0x49, 0x60, 0x82, 0x6c, 0x33,
+  0x70, 0xd1, 0x0c, 0x7c, 0x20, 0x66, 0x2c, 0x5f, 0x21, 0x61, 0x1b, 0x1e,
+  0x18, 0x24, 0x4c, 0x83, 0xb0, 0x08, 0x4f, 0xf7, 0x0e, 0xfe, 0xcf, 0xca,
+  0xdd, 0xd4, 0x48, 0x68, 0x65, 0x19, 0x61, 0x2c, 0x1f, 0xbe, 0x11, 0x12,
+  0xbb, 0x57, 0xd5, 0x3a, 0xc2, 0x83, 0x19, 0xd1, 0x43, 0xe4, 0x6e, 0x55,
+  0x51, 0xc0, 0xe8, 0x1e, 0x90, 0x16, 0x3e, 0x7a, 0x6b, 0x07, 0x76, 0xfa,
+  0xff, 0x12, 0x8c, 0x11, 0x70, 0x5e, 0x22, 0x8c, 0x87, 0xcb, 0xec, 0x4f,
+  0xea, 0x4d, 0x99, 0x24, 0xd7, 0xdd, 0x4b, 0x18, 0x63, 0xd2, 0xfd, 0xda,
+  0x21, 0xdc, 0xf3, 0x1f, 0xcf, 0x1b, 0x43, 0x22, 0xa7, 0xd3, 0xc5, 0x73,
+  0x47, 0x8d, 0x6d, 0x62, 0x02, 0xaf, 0xa8, 0x43, 0x5c, 0x27, 0xeb, 0x14,
+  0xfd, 0x08, 0x88, 0x9e, 0xa3, 0x26, 0xe9, 0xc7, 0x46, 0x1a, 0x65, 0x17,
+  0x8d, 0x78, 0x10, 0x9d, 0xf7, 0x3d, 0xd6, 0x3e, 0x69, 0x65, 0x86, 0x3f,
+  0xa3, 0xfe, 0x7a, 0xd3, 0x84, 0xa5, 0x4e, 0x11, 0x2e, 0x87, 0xd1, 0x54,
+  0x63, 0xb2, 0x7d, 0x6e, 0x8c, 0xa8, 0x1f, 0x63, 0xdd, 0xb7, 0x39, 0x64,
+  0xe0, 0xfa, 0x9b, 0x3f, 0x66, 0x22, 0x71, 0x56, 0xe9, 0xe5, 0x83, 0x85,
+  0x29, 0x20, 0xf2, 0xe7, 0x50, 0x9b, 0xb2, 0xf2, 0x8b, 0x90, 0xef, 0xc7,
+  0x52, 0x4b, 0x57, 0x60, 0xc8, 0x1a, 0x90, 0xa2, 0x5d, 0x1e, 0xce, 0x4f,
+  0xa4, 0xe8, 0x82, 0x1f, 0xcd, 0x28, 0xf2, 0xb9, 0x40, 0x39, 0x84, 0x85,
+  0xf4, 0xa2, 0xf8, 0x03, 0x53, 0xb7, 0x99, 0xf0, 0xf3, 0x39, 0x3a, 0x48,
+  0x58, 0x88, 0xcc, 0xb3, 0x9e, 0xa4, 0xcb, 0x6d, 0x0b, 0x6e, 0x08, 0x4c,
+  0x33, 0xdc, 0x93, 0x13, 0x3f, 0x52, 0xfe, 0xfa, 0x87, 0xb9, 0x62, 0xa3,
+  0xad, 0x53, 0x23, 0xd3, 0x60, 0x79, 0xc7, 0x52, 0x71, 0x5b, 0x78, 0x0f,
+  0x2c, 0x63, 0x97, 0x76, 0x97, 0x61, 0xd1, 0x07, 0xb8, 0x0d, 0x83, 0x9e,
+  0x25, 0xae, 0xf3, 0x5c, 0x5e, 0xda, 0x70, 0x77, 0x06, 0x83, 0xc5, 0x2c,
+  0x1a, 0x83, 0xa8, 0xdd, 0x4a, 0x9a, 0x96, 0x53, 0x46, 0x0c, 0x2b, 0x78,
+  0x3a, 0xc3, 0xd3, 0x5e, 0x50, 0xc0, 0x66, 0xbe, 0x8b, 0xcc, 0x1a, 0x43,
+  0xf2, 0xc6, 0xde, 0x3a, 0x65, 0xfb, 0x34, 0x93, 0x3a, 0xe6, 0xac, 0x6a,
+  0xb9, 0x33, 0x91, 0xb0, 0x90, 0x99, 0x1f, 0x9c, 0xef, 0x1b, 0xed, 0xd3,
+  0xae, 0xec, 0x2a, 0x7f, 0x7f, 0x82, 0x59, 0x29, 0x16, 0x26, 0x68, 0x4e,
+  0xeb, 0x89, 0x9a, 0x29, 0xca, 0x1b, 0x22, 0x18, 0x57, 0x35, 0x66, 0x0f,
+  0x56, 0xca, 0xd9, 0xe0, 0x6e, 0x36, 0x79, 0xe1, 0x9e, 0x04, 0x14, 0xf1,
+  0x60, 0x18, 0x76, 0x91, 0xd2, 0xf6, 0x89, 0x4c, 0xb8, 0x56, 0xfe, 0xa2,
+  0x2a, 0xa6, 0x6b, 0x28, 0xb0, 0x22, 0xdc, 0x7b, 0xdf, 0x2b, 0x76, 0xf0,
+  0x09, 0x47, 0xa7, 0x2a, 0xf3, 0xab, 0x56, 0x2d, 0x1d, 0xbb, 0x39, 0xee,
+  0x78, 0x09, 0x74, 0x3f, 0x99, 0xc9, 0x4d, 0x90, 0xad, 0xca, 0x87, 0x02,
+  0x74, 0x84, 0x8c, 0x0a, 0xa9, 0xa1, 0xf1, 0x3a, 0xa0, 0xf6, 0x69, 0x92,
+  0x78, 0x1c, 0x47, 0xe6, 0x79, 0xac, 0xce, 0xe6, 0xa8, 0x83, 0x13, 0xa3,
+  0xc6, 0x1b, 0xd8, 0x80, 0x49, 0x7b, 0xcf, 0xb5, 0x6e, 0x1a, 0xf9, 0x43,
+  0xcc, 0x38, 0x3e, 0x73, 0x64, 0x56, 0x3c, 0x10, 0x2f, 0x1c, 0x3c, 0xe4,
+  0xea, 0x3c, 0x04, 0x0d, 0x68, 0x41, 0x8f, 0x86, 0x6c, 0x66, 0x8e, 0xd2,
+  0xbc, 0xa8, 0xa1, 0x05, 0x85, 0xb7, 0xae, 0x7c, 0x0d, 0xb5, 0x89, 0x45,
+  0x53, 0x87, 0x6e, 0x62, 0x32, 0x66, 0xd3, 0x34, 0x39, 0x45, 0xa2, 0x9b,
+  0x73, 0x7b, 0x22, 0x18, 0x3e, 0x18, 0x33, 0x76, 0x2f, 0x11, 0xcb, 0x56,
+  0xe8, 0x3e, 0x2a, 0xcb, 0xa2, 0xfd, 0xa4, 0xd9, 0xe2, 0xd7, 0xd3, 0x17,
+  0xe0, 0xac, 0x86, 0x59, 0xd5, 0xa6, 0x41, 0x47, 0xf0, 0xc1, 0xee, 0xcf,
+  0xa6, 0xe1, 0xd9, 0x9e, 0xa5, 0x18, 0xd1, 0x00, 0x2f, 0x9d, 0x9f, 0x56,
+  0xe6, 0x45, 0xef, 0x43, 0x4c, 0xa8, 0x21, 0x5c, 0x22, 0x33, 0xb3, 0xd1,
+  0xbd, 0x90, 0x9f, 0x23, 0x05, 0x68, 0x42, 0x07, 0x1b, 0x73, 0xc6, 0xa7,
+  0x44, 0xd1, 0x94, 0xd7, 0xfa, 0x67, 0xb7, 0x87, 0x5d, 0xd4, 0xc4, 0xc4,
+  0x32, 0x59, 0x0f, 0xd2, 0x61, 0xc3, 0x05, 0xe1, 0x72, 0x8c, 0xc8, 0x36,
+  0x6b, 0x79, 0x98, 0x8e, 0x0f, 0x6f, 0x51, 0x24, 0x96, 0x4a, 0x5f, 0x91,
+  0xef, 0x73, 0xf4, 0x12, 0x72, 0xc9, 0xd4, 0xe6, 0x78, 0xa5, 0x03, 0x6b,
+  0x6a, 0x3b, 0x56, 0xfa, 0x6f, 0x8a, 0x49, 0x76, 0x75, 0xd4, 0x81, 0xd8,
+  0xf5, 0xb8, 0xca, 0xe9, 0x59, 0x48, 0xad, 0x9e, 0x45, 0x07, 0xc5, 0xf7,
+  0xb2, 0x7c, 0x78, 0xa8, 0x65, 0x0c, 0x38, 0x82, 0xec, 0x0c, 0x5b, 0xab,
+  0x66, 0x7e, 0xbb, 0x0a, 0xb3, 0x12, 0x1f, 0x4b, 0x73, 0xc2, 0xc8, 0x63,
+  0x2e, 0x52, 0x4b, 0x6c, 0xa5, 0x9c, 0xa2, 0x71, 0xb6, 0xbe, 0xc9, 0x3d,
+  0x82, 0xaf, 0x2f, 0x18, 0xb7, 0x57, 0x75, 0xf2, 0x15, 0xda, 0x8c, 0xe0,
+  0x5e, 0x04, 0x37, 0x2b, 0xde, 0xe4, 0x3f, 0xd4, 0x53, 0xa9, 0xc9, 0x8c,
+  0xf4, 0x5d, 0x28, 0x04, 0xe2, 0x46, 0x58, 0x71, 0xc3, 0x91, 0x56, 0x53,
+  0x19, 0x78, 0x10, 0xeb, 0x35, 0xaa, 0xab, 0xcd, 0xf0, 0x55, 0x88, 0x87,
+  0xca, 0xef, 0x8e, 0x7a, 0xee, 0xc3, 0x05, 0x4a, 0x40, 0x6d, 0xea, 0x6e,
+  0x29, 0xed, 0x99, 0x98, 0x4a, 0x4c, 0x25, 0x36, 0x8f, 0x68, 0x83, 0xc8,
+  0x71, 0x36, 0x49, 0xb8, 0xe1, 0x94, 0xde, 0x13, 0xd7, 0x2f, 0x21, 0x67,
+  0xc9, 0xd2, 0x3a, 0xd1, 0x3c, 0xc7, 0xbf, 0xd8, 0xb3, 0x70, 0x4e, 0xa0,
+  0xe0, 0xee, 0xf0, 0x41, 0xa9, 0x6b, 0x3c, 0x4c, 0xb4, 0xaa, 0x14, 0x54,
+  0x1c, 0x81, 0x2c, 0x9e, 0xfa, 0xd5, 0xb1, 0x4c, 0xb2, 0x5f, 0x95, 0xcb,
+  0xf1, 0x59, 0x4f, 0xca, 0xf0, 0xbe, 0x23, 0x91, 0xee, 0x66, 0xa0, 0xea,
+  0x3f, 0x2f, 0x27, 0xfe, 0x0c, 0x02, 0xa3, 0xbf, 0x64, 0x2c, 0x30, 0xd4,
+  0xaf, 0x73, 0xda, 0x0b, 0x33, 0x24, 0x18, 0xc7, 0x08, 0x47, 0xba, 0x58,
+  0x1f, 0x49, 0x34, 0xb0, 0x33, 0x57, 0x11, 0x88, 0x88, 0x83, 0x8e, 0x62,
+  0xe5, 0x1a, 0xd5, 0x5d, 0x23, 0xa2, 0xfe, 0xc2, 0x80, 0xf2, 0x00, 0x34,
+  0xa3, 0xb0, 0x57, 0x0e, 0x49, 0x20, 0x87, 0xac, 0x5b, 0x78, 0xf2, 0xb1,
+  0x6a, 0xe7, 0x14, 0xda, 0x9b, 0xa0, 0x92, 0x18, 0x11, 0xcf, 0x0f, 0x30,
+  0x8d, 0x17, 0x3c, 0xe4, 0xf5, 0xb4, 0x83, 0x12, 0x79, 0x76, 0x79, 0x09,
+  0xa8, 0xa7, 0xa7, 0xf9, 0x95, 0xea, 0x5c, 0xda, 0x35, 0x0e, 0xfc, 0x42,
+  0x24, 0xb1, 0x93, 0x62, 0xc5, 0xc2, 0x34, 0x20, 0xe9, 0x39, 0x20, 0xbf,
+  0x50, 0x08, 0xf2, 0xf5, 0xcd, 0x8e, 0xd0, 0x51, 0xe5, 0x99, 0xea, 0x6b,
+  0xbe, 0x9c, 0xe7, 0xcc, 0x8c, 0xc7, 0xb5, 0x85, 0x54, 0x18, 0x14, 0xff,
+  0xfa, 0xb8, 0xa5, 0x5b, 0x34, 0x37, 0xe1, 0x68, 0xa6, 0x58, 0x7c, 0x7a,
+  0x7c, 0xb2, 0x11, 0x16, 0x11, 0x7d, 0xbb, 0xd2, 0x90, 0x3f, 0x7a, 0xdc,
+  0x2a, 0xd5, 0xc3, 0x3d, 0x1b, 0x99, 0x88, 0xf2, 0x70, 0x6d, 0x31, 0x58,
+  0x40, 0x1b, 0xae, 0x19, 0x28, 0xea, 0xfa, 0xee, 0xa0, 0x63, 0x8c, 0x71,
+  0x65, 0x1b, 0x69, 0xa0, 0x57, 0xbb, 0x31, 0x99, 0xa9, 0xfa, 0xb7, 0x36,
+  0x5e, 0x1d, 0xc3, 0x2a, 0x8f, 0x8e, 0xd5, 0xbd, 0xd1, 0x4b, 0x22, 0x3d,
+  0x94, 0xa3, 0x27, 0xbc, 0x7a, 0x3d, 0x50, 0x52, 0x99, 0x39, 0x8c, 0xd7,
+  0xd9, 0xb6, 0xa6, 0xe3, 0xa7, 0xe1, 0x37, 0x9b, 0xdd, 0x8c, 0x50, 0x61,
+  0x3f, 0xa3, 0x3a, 0x17, 0xc1, 0x32, 0x86, 0x56, 0xa1, 0xe3, 0xcd, 0xd7,
+  0x44, 0x84, 0x73, 0xc0, 0x6c, 0xd0, 0xb3, 0x8a, 0x4c, 0x46, 0xb5, 0xaa,
+  0x64, 0xee, 0x0f, 0xe8, 0x92, 0x34, 0x95, 0xeb, 0x0f, 0x9b, 0x06, 0xa3,
+  0xfe, 0x5e, 0x8e, 0xbc, 0x93, 0x9d, 0x6e, 0x87, 0x7f, 0x06, 0x57, 0x11,
+  0x07, 0xb3, 0x1a, 0xca, 0x9d, 0x92, 0x86, 0x3c, 0x6c, 0x46, 0x61, 0x56,
+  0xc1, 0x45, 0xda, 0x93, 0xd2, 0x90, 0x78, 0xd4, 0x3b, 0x06, 0xe7, 0x26,
+  0x19, 0x32, 0x97, 0xba, 0x56, 0x0d, 0x57, 0x6b, 0x20, 0x3e, 0xb0, 0x21,
+  0x7b, 0x80, 0xc5, 0x85, 0xce, 0x05, 0x92, 0x9c, 0x84, 0x60, 0x49, 0x1f,
+  0xc8, 0xd3, 0x13, 0xc9, 0x30, 0x6d, 0xd1, 0xc0, 0x1d, 0xa6, 0xda, 0xd5,
+  0x09, 0x86, 0xe7, 0x86, 0x3a, 0x6e, 0x05, 0xf6, 0x8b, 0x64, 0x10, 0xbc,
+  0x2f, 0xf0, 0x47, 0x7d, 0x48, 0xdb, 0x13, 0xe4, 0xb4, 0xc2, 0xdd, 0x03,
+  0x2f, 0xc5, 0xba, 0x8d, 0xf5, 0x54, 0x8c, 0x8f, 0xd2, 0x20, 0x3c, 0x8b,
+  0x15, 0xd8, 0x78, 0x77, 0xc2, 0x6f, 0x95, 0x11, 0xec, 0x2d, 0x79, 0x52,
+  0x41, 0x5c, 0x9c, 0x0f, 0xfc, 0xfb, 0xbf, 0x47, 0x3d, 0xbe, 0xf4, 0xd5,
+  0x0a, 0xbe, 0x7c, 0xcd, 0xbe, 0x73, 0x3a, 0x42, 0x52, 0x8f, 0x4d, 0x0e,
+  0x3f, 0xdf, 0xa6, 0x1a, 0xda, 0xf3, 0x1e, 0x48, 0x63, 0x55, 0x23, 0x09,
+  0x32, 0x46, 0x71, 0xcf, 0xa4, 0x32, 0x00, 0x70, 0xc8, 0x9b, 0x34, 0x75,
+  0x7a, 0x0f, 0xcf, 0x29, 0x78, 0x26, 0x9e, 0x7c, 0x12, 0x35, 0x7c, 0xa9,
+  0x1c, 0xde, 0xa3, 0x9d, 0x55, 0xf4, 0xa6, 0xd8, 0x86, 0x6c, 0xf8, 0xa9,
+  0x70, 0x4a, 0xa4, 0xb7, 0x00, 0x13, 0xe6, 0x0a, 0x50, 0x9e, 0x4d, 0x03,
+  0xad, 0xe7, 0x2b, 0x4f, 0xd4, 0xc1, 0x68, 0x18, 0x38, 0xea, 0x0a, 0x81,
+  0x13, 0x9e, 0xc8, 0xda, 0x62, 0x57, 0xd8, 0x92, 0x6e, 0x15, 0xac, 0x50,
+  0xeb, 0x8d, 0x66, 0x87, 0xe9, 0x1a, 0x8d, 0x8d, 0x48, 0x9b, 0x45, 0x42,
+  0xaf, 0xf4, 0xfd, 0xcc, 0xc8, 0x9d, 0x97, 0xcc, 0x4d, 0x8f, 0x54, 0xca,
+  0xdb, 0x30, 0x11, 0xd4, 0xbd, 0xf9, 0x44, 0xdc, 0xed, 0x55, 0xf5, 0xac,
+  0x2c, 0x09, 0x8f, 0x3d, 0xb9, 0x4a, 0x8b, 0x6d, 0x39, 0xbc, 0x6f, 0xae,
+  0x41, 0xc7, 0xa6, 0x04, 0x96, 0xa6, 0xd8, 0x38, 0x4e, 0xe4, 0x8c, 0x28,
+  0xa3, 0x23, 0x0b, 0x38, 0xe6, 0x34, 0xdf, 0x38, 0x85, 0x49, 0xb5, 0xcc,
+  0x33, 0x8d, 0xc0, 0xe1, 0x18, 0x53, 0x98, 0x9a, 0x0a, 0x54, 0x6b, 0x05,
+  0xd4, 0xa8, 0x39, 0xb4, 0x44, 0x22, 0x20, 0x1e, 0xf2, 0x5e, 0x98, 0x7c,
+  0xfc, 0x98, 0xd6, 0xc6, 0x42, 0x0a, 0x81, 0xeb, 0xec, 0x38, 0x2a, 0x51,
+  0xcc, 0x23, 0x83, 0x93, 0x1a, 0xff, 0x2a, 0x1b, 0xa7, 0x6d, 0x50, 0xfb,
+  0x3d, 0x8a, 0xb1, 0xac, 0xe1, 0x03, 0x30, 0x72, 0x3a, 0x37, 0x06, 0xa6,
+  0xf4, 0x62, 0x35, 0x8d, 0xd0, 0x61, 0x52, 0x7d, 0xcb, 0x89, 0x5b, 0x11,
+  0xaf, 0xbf, 0xd4, 0x51, 0x3c, 0xe2, 0x4b, 0x87, 0x32, 0x58, 0xc2, 0xb3,
+  0x8d, 0x5a, 0x36, 0xe9, 0x31, 0x2c, 0x49, 0x5e, 0x2f, 0x23, 0x0a, 0x4d,
+  0x1c, 0xa4, 0xcc, 0xf7, 0x11, 0xf6, 0x36, 0x34, 0xa0, 0xe7, 0x46, 0x5c,
+  0x7d, 0x69, 0xd9, 0x1c, 0xd9, 0x2a, 0x3f, 0xf6, 0x47, 0xc6, 0x0e, 0x6e,
+  0xd5, 0x42, 0xe8, 0x23, 0xb8, 0xf1, 0xe7, 0x1f, 0x3d, 0x33, 0x3a, 0xc6,
+  0xba, 0xcd, 0x02, 0x42, 0x33, 0x08, 0x73, 0x46, 0x36, 0xe0, 0xe9, 0xba,
+  0x23, 0x53, 0x23, 0xf5, 0xde, 0x08, 0xba, 0xcb, 0xf9, 0x0a, 0xf9, 0x0a,
+  0x62, 0x88, 0x1e, 0xe0, 0x67, 0x64, 0xac, 0x41, 0x9e, 0x4f, 0x59, 0xcb,
+  0xd0, 0xfd, 0xc9, 0x89, 0xf7, 0xf0, 0xac, 0xac, 0xe7, 0x0f, 0xcb, 0xe6,
+  0x32, 0xfc, 0x9b, 0xf3, 0x68, 0x48, 0x52, 0x1c, 0xff, 0x89, 0x13, 0x91,
+  0xb5, 0x17, 0x5d, 0x20, 0x40, 0x5a, 0x01, 0xec, 0x3f, 0x53, 0xa8, 0xa7,
+  0xad, 0x02, 0xe1, 0x88, 0xaf, 0xe0, 0xe8, 0x5b, 0xda, 0xd0, 0xa9, 0x21,
+  0xf3, 0xdc, 0x50, 0xce, 0x44, 0xbc, 0x71, 0x47, 0xcf, 0x33, 0x47, 0x1f,
+  0x95, 0x53, 0x8f, 0x0b, 0x7b, 0xe7, 0x7e, 0x20, 0xfa, 0xe9, 0x49, 0xe8,
+  0x65, 0x54, 0xb2, 0xd8, 0xe7, 0x4f, 0x3c, 0x0c, 0xae, 0xe3, 0x9c, 0x7c,
+  0xbe, 0xf1, 0x62, 0x61, 0x2b, 0xc1, 0xf6, 0x22, 0xfd, 0x2b, 0xa2, 0xe7,
+  0x06, 0x9c, 0xd1, 0x81, 0xaf, 0xaf, 0x72, 0xbd, 0x63, 0x57, 0x3d, 0xa1,
+  0xaf, 0x34, 0x63, 0x50, 0x70, 0x3f, 0x61, 0xae, 0x9c, 0x3c, 0x10, 0xe5,
+  0x10, 0xd1, 0xce, 0xef, 0x23, 0x60, 0xab, 0xd1, 0x0d, 0x79, 0xc8, 0x6f,
+  0x6e, 0x89, 0xb7, 0x3c, 0xb8, 0xb2, 0x34, 0x5b, 0x23, 0xf4, 0xe9, 0x8c,
+  0x9c, 0x1c, 0xeb, 0xa4, 0x05, 0x90, 0x42, 0xdc, 0x1c, 0x06, 0x56, 0xf7,
+  0x74, 0x27, 0xfb, 0x20, 0x77, 0x2c, 0xf1, 0x13, 0xa4, 0x9f, 0x37, 0x6e,
+  0x10, 0xc0, 0xfe, 0x17, 0xa6, 0x71, 0xbd, 0x46, 0xc0, 0xf1, 0xc8, 0x6e,
+  0x2a, 0x8d, 0x61, 0xe6, 0x16, 0x4d, 0x14, 0x1d, 0xa1, 0xf1, 0xb6, 0xc3,
+  0x9d, 0x8d, 0xe5, 0x1c, 0xb3, 0x67, 0x8f, 0x9f, 0xaa, 0x2f, 0xe9, 0xe6,
+  0x82, 0x07, 0xd9, 0xca, 0x79, 0xb4, 0x4c, 0x84, 0xad, 0xa0, 0xbb, 0x7d,
+  0x7c, 0x84, 0x62, 0xa0, 0x4b, 0x0a, 0xa5, 0xcc, 0x0c, 0x62, 0x39, 0xfb,
+  0x61, 0x23, 0xb1, 0x95, 0x3d, 0x33, 0x90, 0xc2, 0x9b, 0xad, 0xec, 0xd5,
+  0x6d, 0xe1, 0xaf, 0x1d, 0x75, 0x94, 0x6d, 0x8b, 0xf4, 0x21, 0xc4, 0xf5,
+  0xe5, 0xb3, 0x39, 0x82, 0x85, 0x68, 0x48, 0x20, 0x0f, 0xee, 0x68, 0x46,
+  0x04, 0xb2, 0xcf, 0x2d, 0x84, 0xeb, 0x6d, 0x23, 0x75, 0x36, 0x11, 0x3f,
+  0xdf, 0x4b, 0xd9, 0x1e, 0x86, 0x6a, 0xdf, 0xde, 0x59, 0xa2, 0x50, 0x3e,
+  0xf8, 0x99, 0x70, 0x88, 0x35, 0xd0, 0xca, 0x12, 0x36, 0xfb, 0xa5, 0x6c,
+  0x33, 0x9d, 0x29, 0xd7, 0x14, 0xa7, 0x3d, 0xb9, 0x0a, 0x66, 0xb9, 0xdf,
+  0xa5, 0xa7, 0x93, 0xac, 0x11, 0x89, 0x8e, 0xf2, 0xf1, 0xa2, 0x94, 0x79,
+  0xdd, 0x31, 0x64, 0x40, 0x08, 0xe5, 0x3f, 0xf1, 0x9a, 0x51, 0x2c, 0x53,
+  0x61, 0x7a, 0xb2, 0x31, 0xad, 0x7a, 0xed, 0xad, 0x3b, 0x78, 0x38, 0x4a,
+  0x27, 0xe9, 0x47, 0x4b, 0x59, 0x13, 0x48, 0x44, 0xb3, 0x8b, 0x99, 0xbd,
+  0xfc, 0x5e, 0x5d, 0x16, 0xbf, 0xa2, 0x17, 0x8b, 0xff, 0x20, 0x69, 0x8f,
+  0x86, 0x6c, 0x5d, 0xa0, 0x14, 0x85, 0xa9, 0x42, 0x6f, 0x44, 0xe6, 0x71,
+  0x2e, 0x87, 0xcf, 0xaf, 0x22, 0xad, 0x97, 0x41, 0x9c, 0xf6, 0xad, 0x26,
+  0x7e, 0x23, 0x66, 0x76, 0x09, 0x60, 0x0b, 0x45, 0x30, 0xe4, 0xdf, 0x6b,
+  0x1e, 0xc4, 0x69, 0xcb, 0x2c, 0x38, 0xd5, 0x94, 0x5a, 0x07, 0x24, 0xb0,
+  0xce, 0x3c, 0x6f, 0x76, 0xb9, 0x96, 0x39, 0x43, 0xdc, 0xb2, 0xcf, 0x33,
+  0x0d, 0xe9, 0x60, 0xdb, 0xe5, 0x81, 0x0b, 0x5d, 0x2d, 0x73, 0xa9, 0xb7,
+  0x94, 0x9b, 0x73, 0x80, 0x7a, 0x33, 0x63, 0x28, 0x43, 0xed, 0x0d, 0xa5,
+  0x8c, 0xd8, 0x82, 0x1c, 0x60, 0xd5, 0x56, 0xb4, 0xc8, 0x07, 0x8b, 0x13,
+  0x1e, 0xd7, 0x50, 0x35, 0x91, 0x04, 0xa8, 0xce, 0x9b, 0x5f, 0x43, 0x98,
+  0xb8, 0xc6, 0x96, 0x81, 0xc9, 0xc0, 0x59, 0x96, 0xd6, 0x5f, 0x19, 0xcc,
+  0xe1, 0xd2, 0x29, 0x9c, 0x9c, 0x0e, 0xb1, 0xf8, 0x5b, 0x6d, 0x6e, 0xaa,
+  0xc4, 0xdb, 0x8c, 0xa7, 0x22, 0xc9, 0x64, 0x7c, 0x96, 0xeb, 0x56, 0xc3,
+  0xb8, 0x03, 0x5d, 0x51, 0xfa, 0xb5, 0x61, 0xea, 0x7c, 0xa0, 0xb2, 0x29,
+  0xe3, 0x29, 0xb9, 0x33, 0x80, 0x9b, 0xf3, 0x5b, 0x27, 0x01, 0x63, 0x98,
+  0x4d, 0x37, 0xfb, 0x24, 0x34, 0x7c, 0x5e, 0xb8, 0xec, 0xf5, 0x02, 0x49,
+  0x1d, 0xf7, 0x02, 0x8e, 0x3b, 0xc6, 0x07, 0x7c, 0x49, 0xbb, 0x32, 0x7c,
+  0x16, 0x57, 0xa1, 0xce, 0xc5, 0xa8, 0xaf, 0x00, 0x78, 0x01, 0x32, 0x4a,
+  0x22, 0x13, 0xff, 0x33, 0xe2, 0x61, 0xb0, 0x66, 0x52, 0x64, 0xa5, 0xcc,
+  0x5e, 0x75, 0xd2, 0xd0, 0x6d, 0x88, 0x0a, 0x9a, 0x4c, 0x70, 0x90, 0x6c,
+  0xf7, 0xbc, 0xdf, 0xb9, 0x9d, 0x4d, 0x09, 0x9f, 0x22, 0x55, 0xa3, 0xc6,
+  0xc3, 0xbc, 0xd7, 0x85, 0x4a, 0x03, 0xa6, 0xb7, 0x0b, 0x87, 0x7a, 0x9f,
+  0xbd, 0x2e, 0x92, 0x09, 0x71, 0x96, 0xad, 0x78, 0xd4, 0x1f, 0x8c, 0xd7,
+  0x5c, 0x13, 0x1e, 0x29, 0x28, 0xf1, 0x5f, 0xf4, 0x76, 0x47, 0x7d, 0x6b,
+  0x72, 0xb6, 0xd0, 0x34, 0x60, 0x94, 0xf5, 0xc2, 0x9a, 0xe0, 0xea, 0x8d,
+  0x15, 0xdd, 0x49, 0x21, 0xa0, 0xff, 0xcf, 0x27, 0xaf, 0x32, 0x28, 0x1a,
+  0x9e, 0xb1, 0xc2, 0x02, 0xc1, 0x5f, 0xab, 0xe4, 0x48, 0xc1, 0x99, 0x72,
+  0x54, 0xe7, 0x6d, 0x08, 0x83, 0x34, 0x66, 0x2f, 0xc8, 0x3a, 0x38, 0x74,
+  0x72, 0x53, 0x94, 0x75, 0x3a, 0x64, 0xe3, 0x60, 0x31, 0x09, 0x5d, 0xe5,
+  0xa9, 0x69, 0xa6, 0xb7, 0xb7, 0xbf, 0xea, 0x5b, 0x85, 0x5b, 0x19, 0x6d,
+  0xfd, 0xc0, 0xf2, 0x7c, 0x55, 0xd5, 0x29, 0xe9, 0x4c, 0x14, 0xa5, 0xe9,
+  0xdf, 0x5a, 0x31, 0x81, 0xef, 0x5f, 0x01, 0x57, 0x62, 0x6e, 0x78, 0x13,
+  0x9d, 0x7b, 0xbe, 0x20, 0x33, 0x64, 0xec, 0x5c, 0xb9, 0x84, 0x83, 0x1d,
+  0xb9, 0x2d, 0x25, 0x5b, 0xe8, 0x59, 0xa9, 0x4b, 0xbb, 0x44, 0x95, 0x09,
+  0x72, 0x4d, 0xe5, 0xbb, 0x24, 0x99, 0x7d, 0xa3, 0x05, 0x23, 0x26, 0xd1,
+  0xab, 0xa3, 0x72, 0xf6, 0x00, 0xec, 0xb4, 0x35, 0x7c, 0xbe, 0x24, 0x07,
+  0x62, 0x87, 0xcb, 0x98, 0x1c, 0xac, 0x02, 0xae, 0xc8, 0x39, 0x53, 0x44,
+  0xb7, 0x12, 0xc3, 0x9e, 0x1d, 0x79, 0xdb, 0x22, 0x18, 0x99, 0xb2, 0x08,
+  0xef, 0x51, 0xac, 0xfe, 0x30, 0x15, 0x36, 0xed, 0x1e, 0xfc, 0x4c, 0x76,
+  0x27, 0x53, 0xe1, 0xf2, 0x83, 0x3f, 0xd6, 0x94, 0x81, 0x6f, 0xb2, 0xf8,
+  0x78, 0xb0, 0x5f, 0x1c, 0x0b, 0xd6, 0x00, 0x5c, 0x19, 0x7e, 0x14, 0x9f,
+  0xc0, 0xbd, 0xb8, 0x87, 0xab, 0xac, 0x5e, 0x74, 0x00, 0xa1, 0xb2, 0x9c,
+  0x77, 0xad, 0xdc, 0x42, 0x41, 0x83, 0x67, 0xe4, 0x63, 0x04, 0x40, 0x33,
+  0x48, 0x06, 0x34, 0x7a, 0xa0, 0x96, 0x0f, 0xf3, 0xb5, 0xac, 0xda, 0x0b,
+  0x2b, 0x9d, 0x20, 0xc2, 0x96, 0xd0, 0x2d, 0xc9, 0x4a, 0xcd, 0x95, 0xba,
+  0xbc, 0xc6, 0x94, 0xdc, 0x04, 0xe2, 0x2d, 0xd6, 0x1e, 0x16, 0xe0, 0xa8,
+  0xaa, 0x99, 0x4b, 0x60, 0x75, 0x6a, 0x01, 0x59, 0x87, 0xd8, 0x92, 0x55,
+  0x4c, 0xf5, 0xc2, 0xca, 0x92, 0xd8, 0x41, 0xa1, 0x46, 0x2c, 0x16, 0xb4,
+  0x41, 0x07, 0x26, 0xd7, 0x4a, 0x76, 0x4a, 0xa1, 0x44, 0x90, 0xb1, 0x14,
+  0x85, 0x75, 0x5e, 0x75, 0x3c, 0xa0, 0x87, 0x82, 0x88, 0x44, 0x94, 0x22,
+  0x18, 0xf6, 0x47, 0xc7, 0x95, 0xf6, 0xdf, 0x47, 0xb8, 0xe6, 0x5b, 0x64,
+  0x0d, 0xaa, 0xd1, 0xa1, 0xcd, 0x8d, 0x98, 0xae, 0x6e, 0x91, 0xce, 0x4b,
+  0xd0, 0xa6, 0xf4, 0x4e, 0x47, 0xe2, 0xb3, 0x37, 0xee, 0x3c, 0x79, 0x28,
+  0x3c, 0x0a, 0xb7, 0x1f, 0xcc, 0x69, 0x11, 0xf4, 0x70, 0x99, 0xc2, 0x8a,
+  0x48, 0x11, 0xd9, 0xb6, 0x99, 0x09, 0x3b, 0x52, 0x55, 0x4b, 0x5b, 0x75,
+  0xf7, 0x51, 0xc1, 0x2e, 0x5a, 0x82, 0x7f, 0xfe, 0xac, 0xf6, 0x38, 0xfa,
+  0x2f, 0x41, 0x48, 0x8a, 0x74, 0xfe, 0xb2, 0xbc, 0x7f, 0xfd, 0x08, 0xf3,
+  0xd5, 0x72, 0x6d, 0x85, 0xab, 0xa7, 0x5c, 0x4f, 0x81, 0xda, 0x4c, 0x68,
+  0x83, 0xbf, 0x1d, 0x06, 0x3c, 0x35, 0xad, 0xb8, 0xdd, 0x56, 0x2e, 0xec,
+  0x7a, 0x3f, 0xc7, 0x2a, 0xfd, 0x76, 0x02, 0xc3, 0x1b, 0xf1, 0xc2, 0x87,
+  0x6d, 0xfa, 0xfb, 0x26, 0x8b, 0x1a, 0xa7, 0xdc, 0xb1, 0x6a, 0x7d, 0xea,
+  0xd7, 0xd0, 0xbd, 0x8f, 0x5d, 0x2a, 0xf7, 0x5a, 0xa8, 0x78, 0x72, 0x07,
+  0x3c, 0x58, 0x3e, 0xb0, 0x3f, 0xd6, 0xe2, 0xcb, 0x4b, 0x7a, 0xb0, 0x33,
+  0x56, 0xb4, 0x7b, 0xdd, 0x70, 0x89, 0x80, 0x42, 0xb1, 0x98, 0xf2, 0xf9,
+  0xa0, 0x74, 0x70, 0x69, 0xb1, 0x1f, 0x0b, 0x00, 0x86, 0xe9, 0xab, 0x8f,
+  0xe3, 0x24, 0x3c, 0xd6, 0xa1, 0x28, 0xb0, 0x51, 0xdc, 0x1a, 0x40, 0x6a,
+  0x57, 0xaa, 0x61, 0x98, 0x7c, 0x67, 0x3a, 0xc2, 0xb7, 0x23, 0x6c, 0x15,
+  0x27, 0xd3, 0x3a, 0x93, 0x7e, 0x28, 0xac, 0x56, 0x93, 0x22, 0x33, 0x9b,
+  0xd3, 0x06, 0x91, 0xf6, 0xdb, 0xbc, 0x89, 0x00, 0x7d, 0x90, 0x38, 0x30,
+  0x0c, 0xe2, 0xac, 0xcd, 0x9b, 0xc0, 0x32, 0xfa, 0x58, 0x6e, 0x79, 0x77,
+  0xf7, 0x12, 0xc6, 0xaa, 0xd2, 0x30, 0x73, 0xcf, 0x6e, 0x22, 0x44, 0xf4,
+  0x63, 0x61, 0x84, 0x9b, 0xf8, 0xfa, 0x81, 0xa7, 0xed, 0x1a, 0xee, 0x92,
+  0x2d, 0xfa, 0x17, 0x07, 0x48, 0xc2, 0xed, 0xe6, 0x65, 0x3b, 0x12, 0x77,
+  0xa8, 0x3f, 0xde, 0x3e, 0x8a, 0x12, 0xac, 0xe0, 0xeb, 0x7b, 0x96, 0x12,
+  0x32, 0x1b, 0x86, 0x84, 0x83, 0x0d, 0x94, 0xb4, 0xf6, 0x6a, 0x34, 0xa9,
+  0x6f, 0xe4, 0x2f, 0x3b, 0xfd, 0xfb, 0x31, 0x13, 0x5f, 0xf4, 0x85, 0xcc,
+  0xb6, 0xe3, 0x50, 0x72, 0x1e, 0xbc, 0x4a, 0x23, 0xd2, 0x31, 0xc1, 0x1a,
+  0x98, 0xf0, 0xe5, 0x69, 0x20, 0xf4, 0xa4, 0xcd, 0xac, 0x37, 0xd2, 0x73,
+  0x7e, 0xa3, 0xb8, 0xaf, 0x0a, 0x05, 0x88, 0x91, 0x7b, 0x98, 0x4b, 0x41,
+  0xf2, 0x12, 0x90, 0xbf, 0x13, 0x32, 0x3a, 0x52, 0xc6, 0x1f, 0x2d, 0xee,
+  0x8a, 0x0c, 0xc9, 0x18, 0x97, 0xb1, 0x3c, 0x39, 0xbc, 0xa5, 0xa8, 0x57,
+  0x4e, 0xbc, 0xfa, 0xc3, 0x46, 0x33, 0x4f, 0x96, 0x4b, 0x1c, 0xc2, 0x4c,
+  0x0c, 0xcb, 0x3e, 0xb2, 0x43, 0xde, 0xe5, 0xb5, 0xfe, 0xcd, 0x98, 0x2a,
+  0x64, 0xce, 0xed, 0x0c, 0x6e, 0x32, 0x10, 0x60, 0x22, 0xc8, 0x32, 0x19,
+  0xc1, 0xea, 0x87, 0xc4, 0x2e, 0xf8, 0x30, 0x21, 0x45, 0xc7, 0xd0, 0x25,
+  0x68, 0x60, 0x03, 0x21, 0xf6, 0xf8, 0x53, 0xe1, 0xd7, 0x46, 0x83, 0x70,
+  0xfe, 0x7d, 0x57, 0x71, 0xa9, 0xda, 0x93, 0x45, 0x38, 0x91, 0x61, 0x05,
+  0xfd, 0x0e, 0x9f, 0xb4, 0x70, 0xcc, 0x2e, 0x32, 0xa0, 0xea, 0x33, 0x3e,
+  0xc3, 0xac, 0xb6, 0xb5, 0xf0, 0x0b, 0x71, 0x49, 0xa6, 0xc3, 0x81, 0x05,
+  0xff, 0xef, 0xbf, 0xd9, 0x9f, 0xe1, 0x4a, 0x15, 0x12, 0x78, 0x65, 0xd8,
+  0xde, 0x0a, 0x67, 0x5d, 0x93, 0x3a, 0x7f, 0x43, 0x3f, 0x8c, 0xd3, 0xaf,
+  0xab, 0xdd, 0x93, 0x9c, 0xf3, 0xd4, 0x8d, 0xe7, 0xac, 0xeb, 0xd3, 0xd8,
+  0xdc, 0xdc, 0x0f, 0x7a, 0x12, 0xba, 0xc2, 0xe0, 0x9e, 0x0d, 0x1b, 0x57,
+  0x0d, 0xca, 0x56, 0x5a, 0xf8, 0x2e, 0x3b, 0xf4, 0x8b, 0xf1, 0xfb, 0xeb,
+  0xe4, 0xfc, 0x10, 0x9f, 0x05, 0x07, 0x22, 0x48, 0x44, 0x1e, 0xf9, 0x4e,
+  0xd8, 0x1e, 0x88, 0x48, 0x42, 0xe8, 0xde, 0x52, 0xb6, 0xc4, 0x51, 0xa0,
+  0x35, 0x03, 0xd2, 0x12, 0x9d, 0xde, 0x7e, 0x99, 0x8d, 0xc3, 0x8c, 0x65,
+  0xdb, 0xb3, 0xba, 0x87, 0x12, 0xfa, 0x5d, 0x79, 0xaa, 0x5f, 0xb0, 0xbb,
+  0x70, 0xe4, 0x1c, 0x26, 0x59, 0x14, 0xfe, 0x79, 0x36, 0x65, 0xfc, 0x63,
+  0x8c, 0x6f, 0x02, 0x48, 0x82, 0x11, 0xe2, 0x4e, 0x88, 0x10, 0xa2, 0xb3,
+  0xee, 0x9f, 0x8a, 0xb4, 0x82, 0x00, 0xe3, 0x72, 0x50, 0xe5, 0x80, 0x1c,
+  0x8b, 0x4d, 0x6d, 0x63, 0xfd, 0x4c, 0xf7, 0xf9, 0x32, 0xc9, 0xba, 0x27,
+  0x18, 0x24, 0x06, 0x42, 0xa4, 0xdb, 0xcc, 0xfb, 0x13, 0x8d, 0xae, 0x5a,
+  0x25, 0x82, 0x26, 0x67, 0x35, 0xf2, 0xdf, 0xb7, 0xd8, 0xc0, 0x4d, 0xa5,
+  0x71, 0xaa, 0x0e, 0x22, 0xf2, 0xb4, 0x21, 0x40, 0xdf, 0x57, 0x81, 0xfc,
+  0xab, 0x42, 0x03, 0x7d, 0xd3, 0xf9, 0x51, 0xd2, 0x93, 0x3a, 0xcb, 0x5f,
+  0x1b, 0x69, 0x59, 0x96, 0xa9, 0x51, 0x47, 0x5b, 0x1b, 0xfb, 0x5f, 0x74,
+  0xeb, 0xd0, 0x03, 0xbd, 0x88, 0x09, 0x66, 0x65, 0x7b, 0x27, 0x27, 0xb3,
+  0x1c, 0xc1, 0x3e, 0x06, 0x17, 0xbe, 0x2d, 0xb0, 0x5d, 0x48, 0x0a, 0x62,
+  0x03, 0xda, 0x7f, 0x5f, 0xbd, 0x2b, 0x15, 0xee, 0xea, 0xd3, 0x77, 0xc4,
+  0x78, 0x46, 0x7e, 0x67, 0x50, 0x24, 0x5d, 0xbe, 0xe5, 0x50, 0x0d, 0x23,
+  0xa8, 0x90, 0x7c, 0x2c, 0x32, 0x61, 0xea, 0x22, 0xbd, 0xf3, 0x0a, 0x9c,
+  0x58, 0xda, 0x56, 0x53, 0x94, 0xfc, 0xc5, 0x23, 0xc6, 0xe5, 0x61, 0xc9,
+  0xe6, 0x96, 0xe2, 0x9b, 0x5a, 0x8b, 0x09, 0x47, 0x49, 0x09, 0x07, 0x0d,
+  0xca, 0x08, 0xbf, 0xee, 0x95, 0x2e, 0x02, 0xc7, 0x8d, 0x9e, 0xab, 0x0d,
+  0xc6, 0x6e, 0x3d, 0x39, 0x02, 0x73, 0x5a, 0x2a, 0x90, 0x4d, 0xb6, 0xce,
+  0xd8, 0xfc, 0xee, 0xe9, 0xa9, 0x06, 0x37, 0xbc, 0x76, 0xe2, 0x04, 0xd0,
+  0xa3, 0xfd, 0xfc, 0x2c, 0x54, 0xd4, 0x9e, 0x6a, 0xcd, 0x68, 0x53, 0xd5,
+  0x4a, 0x5d, 0x45, 0xad, 0x62, 0x9b, 0x2e, 0x76, 0xef, 0xb4, 0xc8, 0xdb,
+  0x38, 0xfe, 0x85, 0xf2, 0x34, 0x3d, 0x61, 0xbc, 0xe7, 0x2c, 0x2b, 0x31,
+  0x96, 0xee, 0xb3, 0xd1, 0x70, 0x0a, 0x5a, 0x8a, 0x32, 0x0a, 0x97, 0x90,
+  0x29, 0x19, 0x67, 0xae, 0xcc, 0xef, 0x98, 0x77, 0x06, 0x10, 0x5e, 0xf3,
+  0xb5, 0x25, 0x37, 0xc8, 0xbf, 0xae, 0xf4, 0xae, 0x0d, 0xff, 0xde, 0x2f,
+  0x78, 0xf1, 0xee, 0xff, 0x94, 0x09, 0xe4, 0x0d, 0xb4, 0xc1, 0xfe, 0xb9,
+  0x4e, 0xa9, 0xeb, 0x28, 0xe0, 0x34, 0xb0, 0x73, 0x21, 0x6f, 0x32, 0xda,
+  0x76, 0xa8, 0x67, 0xbc, 0x8c, 0xa2, 0x17, 0xc0, 0x20, 0x2a, 0x1d, 0x3e,
+  0x9e, 0xc1, 0x0c, 0xfd, 0x47, 0x3f, 0xbc, 0x3d, 0x85, 0x06, 0x11, 0x40,
+  0xc9, 0x85, 0x85, 0xe8, 0xd5, 0x61, 0xea, 0xff, 0xde, 0x7a, 0x2c, 0xf3,
+  0xdb, 0x3a, 0x08, 0x6b, 0xb4, 0xb5, 0x8e, 0x70, 0xba, 0x5b, 0x6a, 0x62,
+  0x23, 0xaf, 0x77, 0xa9, 0xd3, 0x51, 0xbc, 0x2a, 0x46, 0x25, 0x2c, 0x92,
+  0xb3, 0x82, 0x19, 0x75, 0x3e, 0xf8, 0x62, 0x7d, 0x0b, 0x45, 0x35, 0xcd,
+  0xe5, 0x67, 0xb4, 0x2a, 0x14, 0x6d, 0x63, 0x72, 0xc5, 0x46, 0xea, 0xe6,
+  0x5d, 0x33, 0xe7, 0x65, 0x7d, 0xe9, 0x82, 0xc1, 0x3f, 0x24, 0xb4, 0x8a,
+  0xb6, 0x73, 0x77, 0xf1, 0xaa, 0xcf, 0x9d, 0xbc, 0xb3, 0x1f, 0x56, 0x36,
+  0x69, 0xb9, 0x8f, 0xfc, 0x90, 0xe8, 0xd9, 0xbb, 0x66, 0xed, 0xe5, 0xf0,
+  0x1d, 0x60, 0x25, 0xc9, 0x99, 0xe7, 0xb6, 0x8c, 0x6f, 0xd0, 0x0b, 0x95,
+  0x22, 0xec, 0xff, 0x9d, 0xde, 0x8b, 0x08, 0x00, 0xa9, 0x5a, 0xbf, 0xe5,
+  0xc2, 0x2b, 0xb4, 0xcf, 0xd8, 0x69, 0x34, 0xd0, 0xd9, 0x5d, 0xb8, 0x83,
+  0xd6, 0x15, 0xb9, 0x8f, 0x98, 0xa9, 0xbc, 0x69, 0xa6, 0x3d, 0x6a, 0x3f,
+  0xbc, 0x2b, 0xa2, 0x01, 0x6b, 0xcf, 0x8b, 0x1a, 0xc1, 0xb9, 0xe9, 0x9e,
+  0x4c, 0x26, 0x53, 0x63, 0x6b, 0xdb, 0x0e, 0x5f, 0x87, 0x06, 0xb7, 0x9b,
+  0x18, 0x77, 0xb2, 0x52, 0xb1, 0x48, 0xdc, 0xcf, 0xb0, 0xaa, 0xbd, 0x93,
+  0x4d, 0xdf, 0x86, 0x4a, 0x33, 0x5d, 0x5c, 0x6a, 0xfe, 0x90, 0x29, 0x9b,
+  0x8a, 0x7e, 0x81, 0x39, 0x41, 0x11, 0xcb, 0x44, 0xf6, 0xba, 0xc0, 0x35,
+  0x88, 0x46, 0x47, 0x9e, 0xf7, 0x57, 0x18, 0x46, 0xc4, 0x9d, 0x40, 0x80,
+  0x8b, 0x87, 0xda, 0x31, 0xa3, 0x1f, 0x59, 0xcb, 0x9a, 0x41, 0xa3, 0xb6,
+  0x1a, 0xa5, 0x5c, 0x98, 0x23, 0xd7, 0xdb, 0x47, 0xff, 0x20, 0x92, 0xfd,
+  0xa4, 0xec, 0xcf, 0xbf, 0xd3, 0x19, 0x9a, 0x1a, 0x89, 0x18, 0xe3, 0xba,
+  0x90, 0x9d, 0xbf, 0xc2, 0x7c, 0xc0, 0xcb, 0xc6, 0x45, 0xc8, 0xaf, 0x8d,
+  0xdf, 0x98, 0xf5, 0x3c, 0xb5, 0x67, 0x9f, 0x16, 0x34, 0xaa, 0x7c, 0x72,
+  0xcc, 0xf7, 0x0b, 0x80, 0x95, 0x95, 0x41, 0x6c, 0x93, 0x49, 0xe8, 0x35,
+  0x84, 0x42, 0x0a, 0xa0, 0xce, 0x0f, 0x1c, 0x82, 0x62, 0xcd, 0x47, 0xfd,
+  0x4c, 0x84, 0x59, 0x03, 0x64, 0x39, 0x46, 0xc8, 0xa4, 0x34, 0xe5, 0x9e,
+  0x61, 0x46, 0xa9, 0xb6, 0xcb, 0xba, 0xe8, 0x76, 0xaa, 0x91, 0x92, 0xeb,
+  0x17, 0xb9, 0xec, 0xcc, 0x52, 0x98, 0xbf, 0x56, 0x1b, 0xb3, 0x30, 0x31,
+  0xf4, 0x7b, 0x98, 0x5e, 0x9f, 0xd3, 0x96, 0xe5, 0x51, 0xd5, 0x35, 0xe8,
+  0x7e, 0xd8, 0x99, 0x0d, 0xb8, 0x7a, 0x42, 0x3e, 0xab, 0xe3, 0x31, 0x8e,
+  0x51, 0xf1, 0xde, 0x2c, 0xa2, 0x62, 0xe5, 0x0a, 0x05, 0x96, 0xd6, 0x71,
+  0x66, 0xbe, 0x6b, 0x36, 0xce, 0x2f, 0xa7, 0xc1, 0x59, 0xb0, 0xd5, 0xe0,
+  0x2c, 0x2e, 0x9b, 0xfd, 0x02, 0x10, 0xe6, 0x4d, 0x83, 0x78, 0xff, 0xd4,
+  0x5f, 0x80, 0xfe, 0xf5, 0xdc, 0x05, 0xd0, 0x0c, 0x74, 0xbe, 0xae, 0x45,
+  0xc6, 0x04, 0xaf, 0xb8, 0xe3, 0x8c, 0x59, 0xec, 0x79, 0xf7, 0x18, 0x07,
+  0x32, 0xbd, 0xa0, 0x98, 0xb1, 0x2b, 0x0d, 0x4e, 0x5c, 0x28, 0x9b, 0xe9,
+  0x7b, 0x73, 0xff, 0x8f, 0x62, 0xbc, 0x06, 0x9f, 0x54, 0xeb, 0xbe, 0xea,
+  0x33, 0xd1, 0xc0, 0x58, 0x61, 0x51, 0x09, 0xfd, 0x7f, 0x68, 0xb0, 0xb2,
+  0xed, 0xa8, 0x10, 0x5f, 0x54, 0x7c, 0xa6, 0x7a, 0x55, 0xeb, 0x8a, 0x29,
+  0xeb, 0x90, 0x86, 0xb8, 0xb3, 0xe1, 0xf3, 0x3e, 0xdc, 0x29, 0x49, 0x31,
+  0xfc, 0x94, 0x93, 0x57, 0xea, 0xdb, 0x52, 0x08, 0x31, 0xb9, 0xc7, 0x00,
+  0x00, 0xf9, 0xd7, 0xfa, 0xee, 0x84, 0x8b, 0xd3, 0xcf, 0x5e, 0xb9, 0xba,
+  0x27, 0x09, 0x30, 0x49, 0x48, 0x6d, 0x72, 0x8b, 0xfd, 0x31, 0xdc, 0x24,
+  0xc0, 0x97, 0x59, 0x8b, 0xa0, 0x75, 0x40, 0xa9, 0x20, 0x48, 0xc8, 0x0e,
+  0x89, 0xd1, 0x86, 0x52, 0x84, 0x38, 0x5f, 0x6e, 0xc1, 0xdf, 0xad, 0x32,
+  0x1a, 0xcc, 0x30, 0xf5, 0x6e, 0x7c, 0xa3, 0xce, 0x13, 0xc6, 0xd6, 0x7e,
+  0x9b, 0x20, 0x39, 0x19, 0x22, 0x65, 0x41, 0x2d, 0x3c, 0x95, 0x14, 0xb6,
+  0x88, 0x98, 0x3a, 0x2c, 0x4d, 0x9b, 0x55, 0xcd, 0xe8, 0x0a, 0x46, 0xbe,
+  0x36, 0xdb, 0xbc, 0x98, 0x98, 0xe3, 0xa8, 0x9b, 0x4f, 0x6e, 0x86, 0x01,
+  0x1d, 0xf3, 0xf3, 0xe3, 0x20, 0xc5, 0x7f, 0xcf, 0xb9, 0xb8, 0x39, 0xed,
+  0x21, 0x25, 0x96, 0x7d, 0x84, 0xdc, 0x0a, 0xab, 0xcc, 0xd5, 0xda, 0x6d,
+  0x51, 0x66, 0x81, 0x39, 0xeb, 0xf4, 0xac, 0x92, 0xf8, 0xe1, 0x1d, 0x9c,
+  0x1f, 0x26, 0x5d, 0x61, 0x17, 0xf2, 0xc3, 0x7e, 0xdd, 0xf4, 0xd2, 0x5c,
+  0x38, 0xed, 0xae, 0xfa, 0x01, 0xb0, 0xf4, 0x29, 0xc1, 0xe0, 0x7f, 0xdd,
+  0xe4, 0x26, 0xc3, 0xcd, 0xd8, 0xf1, 0x38, 0x4a, 0xbc, 0xf3, 0x14, 0x0c,
+  0x07, 0x91, 0xc7, 0x91, 0x66, 0x55, 0xf9, 0x59, 0x9c, 0xcd, 0x6b, 0xdc,
+  0xef, 0x58, 0x02, 0x5f, 0xe8, 0xbc, 0x4e, 0x70, 0xe0, 0xab, 0xb7, 0xe2,
+  0x46, 0x2b, 0xc5, 0x44, 0x06, 0xff, 0x04, 0x5a, 0x9e, 0x60, 0x6f, 0xa7,
+  0x9e, 0xd2, 0xaa, 0x1d, 0x64, 0x47, 0xf4, 0xf9, 0xdb, 0x36, 0x8f, 0x81,
+  0x22, 0x48, 0x34, 0xec, 0xad, 0xc6, 0x21, 0xde, 0x22, 0xe5, 0x4d, 0x53,
+  0x98, 0xf8, 0xaa, 0x4d, 0xed, 0x9b, 0x85, 0xb2, 0x73, 0xaa, 0x95, 0x44,
+  0x53, 0x99, 0x76, 0xb2, 0x62, 0x38, 0x86, 0x16, 0xdd, 0xb6, 0x41, 0x13,
+  0xfd, 0x47, 0x48, 0x2c, 0x8a, 0x7b, 0xf8, 0x73, 0xa6, 0x1d, 0x9d, 0xfa,
+  0x1e, 0x10, 0x6a, 0xd4, 0x4f, 0xd6, 0xcc, 0x2e, 0x38, 0xba, 0xe8, 0x59,
+  0x2e, 0x86, 0x55, 0x9b, 0x8e, 0x94, 0xa6, 0x10, 0x62, 0x64, 0x16, 0x50,
+  0xb5, 0x7b, 0x6c, 0x03, 0x4d, 0x4a, 0xce, 0xc2, 0x72, 0x18, 0xba, 0xc6,
+  0x4a, 0xa1, 0xf0, 0x9f, 0x1e, 0x7c, 0x68, 0xf4, 0xfe, 0xe2, 0x36, 0x95,
+  0xac, 0xed, 0xdb, 0xc2, 0x35, 0x47, 0xbd, 0x94, 0x7d, 0x1a, 0x8c, 0x40,
+  0x7d, 0x47, 0xf2, 0x75, 0xa7, 0x5f, 0xb7, 0x6e, 0x50, 0x33, 0x75, 0xc3,
+  0x98, 0x3d, 0x57, 0xa9, 0x9f, 0x93, 0xfe, 0x6a, 0xd6, 0x52, 0x67, 0x13,
+  0x5c, 0xdd, 0x1e, 0xda, 0x5e, 0x9d, 0x9a, 0x7b, 0x79, 0xf0, 0x05, 0xfe,
+  0x06, 0xc4, 0x13, 0xb3, 0x81, 0xc6, 0xba, 0x43, 0x25, 0x42, 0x46, 0xa7,
+  0x0f, 0x1b, 0xc0, 0x61, 0xf6, 0x71, 0xdf, 0xe7, 0x9f, 0x2b, 0xee, 0xda,
+  0xd7, 0xee, 0xe5, 0xe9, 0xd2, 0x8a, 0x34, 0x07, 0xf2, 0x93, 0x06, 0x1c,
+  0x58, 0x9a, 0x68, 0xff, 0xb7, 0x71, 0x6e, 0xb0, 0x29, 0x4c, 0x7e, 0x32,
+  0x0c, 0x28, 0x5b, 0xa1, 0x6f, 0x7d, 0x7d, 0x37, 0xd0, 0x4f, 0x0b, 0xc2,
+  0x82, 0xc2, 0xee, 0xb0, 0x9d, 0xc6, 0x69, 0x7b, 0xee, 0xe8, 0x19, 0x38,
+  0x72, 0xa8, 0x1d, 0x0e, 0x9e, 0xde, 0x5b, 0xb2, 0x1a, 0xfa, 0x8f, 0xbe,
+  0x4b, 0x58, 0x26, 0xc0, 0xd9, 0x26, 0x98, 0x90, 0xa0, 0x2b, 0x59, 0x50,
+  0x6c, 0xdd, 0x47, 0x66, 0x23, 0x3d, 0x0c, 0xb3, 0xe9, 0xc3, 0xf3, 0xf9,
+  0xb0, 0xd9, 0x19, 0x14, 0x54, 0xdf, 0x8f, 0x09, 0x13, 0xba, 0xa1, 0xb0,
+  0x0b, 0xc1, 0xad, 0x5d, 0x26, 0x36, 0x87, 0x2e, 0xac, 0xc1, 0x7d, 0xb0,
+  0xa7, 0xe5, 0x43, 0xa7, 0x61, 0x7c, 0x01, 0x83, 0x6c, 0xac, 0x3f, 0x6d,
+  0xa6, 0x7a, 0x45, 0x97, 0xef, 0xbd, 0xa7, 0x74, 0x4d, 0x71, 0xbc, 0x26,
+  0xbd, 0x9c, 0xf7, 0xea, 0xd9, 0x69, 0xe9, 0x1b, 0xf6, 0xcf, 0xcd, 0xa1,
+  0xf6, 0xab, 0xb8, 0x5f, 0x92, 0xfb, 0x50, 0x88, 0x04, 0x08, 0xce, 0x07,
+  0x0e, 0x2d, 0xb7, 0xe0, 0x99, 0x89, 0x5c, 0x81, 0x02, 0x6c, 0xcc, 0x0e,
+  0xe5, 0x19, 0x1b, 0xfb, 0x0f, 0x97, 0xf9, 0x21, 0x87, 0xe7, 0xb9, 0xd2,
+  0xd6, 0x46, 0xb6, 0x36, 0x36, 0x73, 0x28, 0xa0, 0xf7, 0x90, 0xc0, 0x2d,
+  0x4b, 0xf9, 0xde, 0x3f, 0x9a, 0x83, 0xbc, 0x41, 0x3c, 0x49, 0x63, 0x8b,
+  0xa1, 0x28, 0x9a, 0x32, 0x05, 0x59, 0x7d, 0x7c, 0x0f, 0xab, 0xdb, 0xaf,
+  0xe9, 0xd5, 0xb4, 0xe3, 0x48, 0x8b, 0x07, 0x60, 0x4c, 0x34, 0xf0, 0xe8,
+  0x01, 0xba, 0x69, 0x16, 0x84, 0x42, 0x16, 0x32, 0x8a, 0xea, 0xec, 0x0c,
+  0x80, 0xf4, 0x1f, 0x89, 0xd4, 0x37, 0x63, 0x35, 0xeb, 0xb2, 0x7d, 0x44,
+  0x20, 0xc3, 0x57, 0xa5, 0x27, 0xaa, 0x08, 0x86, 0xf5, 0x5c, 0x36, 0x5b,
+  0x03, 0x91, 0xd0, 0x6d, 0xd2, 0x84, 0x7d, 0x32, 0x37, 0x17, 0x7b, 0xdd,
+  0x57, 0x4f, 0x19, 0xc2, 0x86, 0x4a, 0x15, 0x7b, 0x6a, 0xdb, 0xae, 0xb8,
+  0xde, 0xc9, 0x34, 0xdd, 0x6b, 0x41, 0x54, 0xe4, 0xa1, 0x28, 0x19, 0x68,
+  0x25, 0x0b, 0x31, 0x4c, 0xf5, 0xe6, 0x01, 0x9a, 0xa6, 0x1e, 0x90, 0x0e,
+  0x45, 0xed, 0xf1, 0xce, 0x74, 0x45, 0x45, 0x61, 0x33, 0x82, 0xed, 0x8c,
+  0x36, 0x86, 0x6c, 0xe0, 0x44, 0xbc, 0x79, 0xad, 0xd2, 0xc7, 0x69, 0xae,
+  0x89, 0x59, 0x96, 0xc9, 0xc3, 0x5b, 0x3c, 0xf9, 0x7f, 0x87, 0x93, 0x72,
+  0x53, 0x78, 0x27, 0x92, 0x82, 0xf4, 0x6f, 0x46, 0xfd, 0x12, 0x15, 0xe8,
+  0xf6, 0xae, 0xbf, 0x3f, 0x07, 0xe2, 0x3d, 0x35, 0xe0, 0x70, 0x75, 0xed,
+  0x4c, 0x50, 0xcb, 0x6b, 0x52, 0xe8, 0xc5, 0x58, 0xb9, 0x7a, 0x95, 0x84,
+  0x72, 0xf3, 0x06, 0xbe, 0x54, 0x2a, 0xd0, 0xcb, 0x6b, 0x5b, 0x95, 0xf1,
+  0xc3, 0x5e, 0x04, 0x76, 0x20, 0x96, 0x8b, 0x75, 0xba, 0x05, 0x36, 0x05,
+  0x52, 0xcc, 0x09, 0x7f, 0x4e, 0xa5, 0x4f, 0x59, 0xd0, 0x59, 0x26, 0x8a,
+  0x0f, 0x89, 0xc7, 0x29, 0x3b, 0x23, 0x07, 0x27, 0x86, 0xcf, 0xf2, 0x56,
+  0xb1, 0x6a, 0x23, 0x3e, 0x3c, 0x0d, 0xba, 0x19, 0xa9, 0xb5, 0x1e, 0x06,
+  0x2b, 0xce, 0x04, 0xf8, 0xad, 0xcd, 0xfc, 0x6f, 0x3f, 0x95, 0x5c, 0x92,
+  0x55, 0xf0, 0x5b, 0xf0, 0x61, 0xb2, 0xcd, 0x12, 0x05, 0xda, 0x47, 0xc6,
+  0xf0, 0x7c, 0xa5, 0x53, 0x74, 0xb3, 0x78, 0x21, 0xc2, 0x1d, 0xbb, 0xf1,
+  0x84, 0x55, 0x08, 0x81, 0x39, 0xed, 0x96, 0x55, 0x39, 0x0f, 0x0c, 0x76,
+  0xf9, 0x25, 0x7e, 0x32, 0xbf, 0x6e, 0x98, 0xa6, 0xec, 0x4d, 0x8c, 0x8c,
+  0xd1, 0xb9, 0x23, 0x9f, 0x85, 0x75, 0x32, 0x94, 0x9b, 0x27, 0xdc, 0xc7,
+  0x6c, 0xdc, 0xdb, 0x66, 0x81, 0xf7, 0x7a, 0xce, 0x31, 0x85, 0x63, 0xa9,
+  0xcd, 0xf6, 0xb9, 0x5a, 0x9f, 0xf9, 0x50, 0x1e, 0x3a, 0x74, 0xe2, 0x89,
+  0x86, 0x02, 0x03, 0x86, 0xcc, 0xab, 0x05, 0x69, 0x41, 0x14, 0xd6, 0x3d,
+  0x29, 0x6f, 0x19, 0x06, 0x07, 0xfa, 0x20, 0xd0, 0xbd, 0x5e, 0x31, 0x37,
+  0xae, 0x11, 0x62, 0x01, 0x6b, 0x38, 0x6e, 0x73, 0x98, 0x0c, 0x4b, 0x2f,
+  0xa6, 0x2d, 0x21, 0x3a, 0x9c, 0xba, 0x66, 0x37, 0x0c, 0xee, 0xcd, 0xc2,
+  0x25, 0xfc, 0x5f, 0x73, 0xae, 0xd9, 0x11, 0xe0, 0xe3, 0xbd, 0xc1, 0x36,
+  0xcc, 0x1c, 0x2e, 0xae, 0x20, 0xc6, 0xc8, 0xb6, 0x6e, 0x7a, 0xd4, 0x2a,
+  0xcf, 0x4c, 0x63, 0x7a, 0x62, 0x62, 0x63, 0x5c, 0x5d, 0xc3, 0x91, 0xb3,
+  0xa9, 0x38, 0x65, 0x7a, 0x8b, 0x8a, 0x22, 0x5d, 0x53, 0x65, 0x89, 0x7f,
+  0x3a, 0x5a, 0x9b, 0x26, 0x53, 0x63, 0x22, 0xdf, 0x44, 0x42, 0x71, 0x8f,
+  0x37, 0x0c, 0x5c, 0x69, 0xa5, 0x2e, 0xe7, 0x31, 0x09, 0xdf, 0x00, 0xa3,
+  0x37, 0x47, 0xfe, 0xce, 0xcb, 0xf0, 0x65, 0xc4, 0x83, 0x1f, 0x23, 0x45,
+  0x36, 0x42, 0xb1, 0x58, 0x8f, 0x97, 0x78, 0xf1, 0xd0, 0xa2, 0xc1, 0x7c,
+  0x7f, 0x8c, 0xf2, 0x4e, 0x71, 0x20, 0x22, 0x84, 0x68, 0xc0, 0x89, 0x70,
+  0xc8, 0x59, 0xc5, 0x47, 0xd6, 0x34, 0xe8, 0x8f, 0x19, 0xa8, 0xf1, 0x7b,
+  0xc9, 0xc3, 0x5b, 0x12, 0xeb, 0x9e, 0x8e, 0x0d, 0x8b, 0x49, 0xdf, 0xcd,
+  0xbe, 0xda, 0x28, 0x06, 0x01, 0xb0, 0x64, 0xe0, 0x55, 0x8d, 0x7d, 0xe2,
+  0xdc, 0x9b, 0x9f, 0x87, 0xef, 0x5d, 0x1f, 0xef, 0x0e, 0xe0, 0x57, 0xe5,
+  0xeb, 0x44, 0x9a, 0xeb, 0xb4, 0x45, 0x9e, 0xbd, 0x07, 0x5d, 0x98, 0x7a,
+  0x65, 0xa9, 0x32, 0x9a, 0x5b, 0x3d, 0xeb, 0x64, 0xda, 0x9e, 0x70, 0xa7,
+  0xfd, 0x24, 0x09, 0x01, 0x17, 0x30, 0x28, 0xa6, 0x87, 0xdd, 0x23, 0xc9,
+  0xcd, 0xac, 0xbb, 0xd2, 0x43, 0xa5, 0x1a, 0xe6, 0x89, 0xaa, 0x51, 0x4e,
+  0x15, 0xcd, 0xbe, 0x98, 0xdc, 0x09, 0xec, 0xf3, 0x4b, 0xbb, 0x2d, 0x13,
+  0x5d, 0x16, 0xd5, 0x4b, 0x8d, 0x11, 0x9d, 0x17, 0x39, 0x1c, 0x61, 0x99,
+  0xed, 0xc4, 0x9c, 0x1c, 0x60, 0x17, 0x70, 0x1e, 0x03, 0x80, 0x85, 0x8b,
+  0x57, 0xd3, 0x61, 0xca, 0x59, 0x28, 0x50, 0x06, 0x71, 0xbf, 0xf4, 0x9b,
+  0xf5, 0x55, 0x33, 0x35, 0x14, 0x3c, 0x8a, 0x1b, 0x60, 0x31, 0xd0, 0x90,
+  0xb2, 0x5b, 0x06, 0x1e, 0x80, 0xef, 0xc3, 0x55, 0x33, 0x27, 0xd3, 0x3a,
+  0x19, 0xa3, 0xa2, 0x4d, 0xb6, 0x68, 0x31, 0xf3, 0xc4, 0x83, 0x61, 0xfb,
+  0x38, 0x53, 0x8d, 0x48, 0xf5, 0x0c, 0x79, 0x41, 0xa0, 0xb7, 0xfa, 0x7a,
+  0xa4, 0xb4, 0xf7, 0x36, 0x4c, 0x60, 0x7c, 0x5b, 0x0f, 0x36, 0xec, 0x69,
+  0x29, 0x54, 0x1d, 0xda, 0x97, 0xa1, 0x6a, 0xaf, 0x6a, 0x17, 0x22, 0x48,
+  0x01, 0x26, 0xed, 0xba, 0xb4, 0x33, 0x9f, 0xf9, 0x7d, 0xb1, 0x98, 0x69,
+  0x1e, 0xbb, 0x36, 0x28, 0x5e, 0x85, 0x99, 0x43, 0xe4, 0x85, 0x25, 0xf8,
+  0xe1, 0x6c, 0xa8, 0x12, 0x03, 0xa4, 0x22, 0x4d, 0x65, 0x2e, 0xdd, 0x70,
+  0xcd, 0xa6, 0xc6, 0x52, 0x0b, 0xdd, 0xcf, 0xe7, 0xb2, 0xac, 0xd0, 0x8d,
+  0x55, 0x1c, 0x2f, 0x38, 0xae, 0x5a, 0x2e, 0x38, 0xbe, 0x55, 0xb6, 0x50,
+  0xda, 0x4e, 0x27, 0x56, 0x01, 0x86, 0xbe, 0x9f, 0xdf, 0xb3, 0x3d, 0x69,
+  0xd4, 0x95, 0xc0, 0x4b, 0x1d, 0xa1, 0x67, 0x39, 0x51, 0xf5, 0x7f, 0x81,
+  0x30, 0x36, 0x3a, 0x37, 0xc0, 0x96, 0x4e, 0x33, 0xf3, 0xbe, 0x62, 0x50,
+  0xca, 0x53, 0x5a, 0x1b, 0xdf, 0xa2, 0xc6, 0x38, 0x41, 0x30, 0xb1, 0x11,
+  0xb6, 0xc4, 0xc4, 0xbb, 0xf4, 0x85, 0xf9, 0x5c, 0x14, 0xc7, 0x7c, 0x69,
+  0x21, 0x66, 0xd7, 0x52, 0x80, 0x5f, 0x76, 0x59, 0x80, 0x77, 0x5b, 0x53,
+  0x32, 0xc6, 0x3c, 0x04, 0xe6, 0xa6, 0x19, 0xa5, 0xb9, 0xd6, 0x60, 0xb3,
+  0x69, 0x24, 0xde, 0xdb, 0x73, 0xbe, 0x8a, 0x85, 0xcd, 0x3d, 0x8b, 0x9b,
+  0x90, 0x03, 0x7d, 0xab, 0xcf, 0x91, 0x5d, 0xb2, 0xb4, 0x44, 0x57, 0x5a,
+  0x12, 0xc9, 0x5a, 0xa7, 0x63, 0x49, 0x93, 0xea, 0xe9, 0xba, 0xeb, 0xad,
+  0x52, 0xe8, 0x14, 0xb4, 0x82, 0xad, 0x0c, 0x18, 0x2b, 0x13, 0x9a, 0xf9,
+  0xd5, 0x4e, 0xc6, 0x0d, 0xc5, 0x12, 0x35, 0x69, 0xe1, 0x75, 0xd2, 0x4d,
+  0xe6, 0x9d, 0x9b, 0x44, 0x28, 0x19, 0xdc, 0xaf, 0x82, 0xd4, 0xfb, 0xc1,
+  0x7a, 0x68, 0xa0, 0xd8, 0xa6, 0x5b, 0x27, 0x19, 0x52, 0xd3, 0xb3, 0xb8,
+  0x01, 0x81, 0x93, 0x1d, 0x3b, 0x9d, 0xbb, 0xb0, 0x5c, 0x1e, 0xd3, 0xf4,
+  0xec, 0x7b, 0x3f, 0x84, 0x22, 0x4a, 0xaf, 0xcb, 0xe9, 0xcc, 0x80, 0x1c,
+  0x34, 0xa7, 0xf1, 0x89, 0x47, 0xf0, 0x17, 0xee, 0xb4, 0xb1, 0xba, 0x80,
+  0xdc, 0x0c, 0x7c, 0x30, 0xe6, 0xcf, 0xce, 0x83, 0xfb, 0x1c, 0xe8, 0x8d,
+  0xe3, 0x3b, 0x57, 0x62, 0xed, 0x79, 0x4e, 0xb0, 0xbd, 0x95, 0xb1, 0x9b,
+  0x90, 0x9a, 0x48, 0xfb, 0xf5, 0x1a, 0x0d, 0xca, 0x6b, 0x3c, 0x7a, 0x84,
+  0x21, 0xdc, 0xff, 0x02, 0x09, 0xe0, 0xff, 0x9c, 0x45, 0x1e, 0x68, 0xb1,
+  0x38, 0x76, 0xd3, 0xfd, 0x2a, 0x65, 0x52, 0x3a, 0x73, 0xd3, 0xe6, 0x8c,
+  0x08, 0x86, 0x76, 0xa2, 0x02, 0x81, 0x89, 0xea, 0xa0, 0x9a, 0x46, 0xa2,
+  0xd5, 0xab, 0x54, 0x8e, 0xa3, 0xe9, 0x81, 0x92, 0x03, 0x48, 0x87, 0x59,
+  0xe1, 0xd9, 0x35, 0xa4, 0xe2, 0xea, 0x9b, 0x4e, 0x65, 0xa3, 0x91, 0xda,
+  0x8c, 0x82, 0x82, 0x6e, 0xe9, 0xd7, 0x06, 0x22, 0x1f, 0xed, 0x92, 0x33,
+  0x97, 0x51, 0xe0, 0x4f, 0x73, 0x83, 0x62, 0x7e, 0xec, 0xad, 0xed, 0xab,
+  0x7e, 0xb5, 0x9e, 0xf6, 0xbd, 0x16, 0xcb, 0x56, 0x1b, 0x29, 0x59, 0x2f,
+  0x18, 0x25, 0x29, 0xcf, 0x00, 0x49, 0x84, 0x3f, 0xcd, 0x4b, 0xca, 0x11,
+  0x2f, 0x26, 0x02, 0x2c, 0xd2, 0x99, 0xe5, 0xd5, 0xcf, 0x95, 0xec, 0xd4,
+  0x7f, 0x33, 0x49, 0xdf, 0x4d, 0x89, 0xc5, 0x8d, 0x6f, 0x61, 0x26, 0xc3,
+  0x0e, 0x67, 0xf3, 0x4f, 0xea, 0x0d, 0x06, 0x69, 0xba, 0xf8, 0x82, 0xdb,
+  0xef, 0x24, 0x3e, 0xc2, 0xb8, 0x1b, 0xa3, 0xc3, 0x20, 0x3a, 0xb5, 0xe5,
+  0x34, 0xdb, 0x54, 0x75, 0xdc, 0x7b, 0x2d, 0x5e, 0x4d, 0xc0, 0x21, 0x19,
+  0x6b, 0xd8, 0xac, 0x66, 0x5d, 0x6f, 0x19, 0x60, 0x03, 0xc1, 0x30, 0x23,
+  0x99, 0x4b, 0x94, 0xab, 0x94, 0xf4, 0x57, 0x4f, 0x59, 0xeb, 0x3f, 0x35,
+  0xf7, 0xcf, 0x1f, 0x7a, 0x59, 0x7a, 0x19, 0xd3, 0x95, 0xb5, 0x04, 0x9b,
+  0xef, 0x54, 0xd2, 0x11, 0x2a, 0xfb, 0xbc, 0xe0, 0x02, 0x73, 0x25, 0xee,
+  0x9d, 0x9d, 0xb5, 0x27, 0x33, 0x12, 0xb3, 0xe4, 0x5f, 0x57, 0xec, 0x75,
+  0xe6, 0x5e, 0x32, 0x65, 0x61, 0x49, 0x9a, 0xce, 0x3a, 0x23, 0xb0, 0x27,
+  0x4c, 0x53, 0x53, 0xb7, 0x36, 0xb2, 0xdc, 0x35, 0x52, 0x39, 0x3c, 0x18,
+  0x2a, 0x4d, 0x78, 0x89, 0xe2, 0x76, 0x67, 0xa9, 0x07, 0xe1, 0x9a, 0xbc,
+  0x26, 0xa3, 0x25, 0xc6, 0xa9, 0x66, 0x72, 0x97, 0x2f, 0xcf, 0xeb, 0x48,
+  0x0b, 0x46, 0xe2, 0x3b, 0xc2, 0x8e, 0x21, 0x25, 0x57, 0x24, 0x15, 0x25,
+  0x12, 0x12, 0x72, 0xcd, 0x5f, 0x15, 0x61, 0x56, 0xcd, 0xf1, 0x08, 0xa9,
+  0x6b, 0xcd, 0x59, 0x9b, 0x1c, 0xef, 0x43, 0x61, 0xf8, 0x5a, 0xa9, 0xd9,
+  0xb7, 0x69, 0xec, 0xc0, 0x9a, 0xfb, 0xe2, 0x54, 0x69, 0xcf, 0x96, 0x11,
+  0xed, 0x71, 0xfc, 0x0c, 0xe9, 0x6c, 0x8c, 0x25, 0x09, 0x78, 0x52, 0xde,
+  0x89, 0x4d, 0x0b, 0x57, 0x3e, 0xe4, 0xd6, 0x64, 0xfe, 0x6d, 0x95, 0x7d,
+  0xe1, 0x58, 0x20, 0xcf, 0x1e, 0xfe, 0x0e, 0xf6, 0xa1, 0x4b, 0x75, 0xce,
+  0x55, 0x38, 0x16, 0x8e, 0x9c, 0x33, 0x31, 0x6b, 0x3b, 0x67, 0x00, 0xba,
+  0x88, 0x78, 0xea, 0x7a, 0xe5, 0x3a, 0x73, 0x66, 0x00, 0x52, 0x8f, 0x3f,
+  0x2b, 0xce, 0x69, 0x8d, 0x88, 0xf1, 0x84, 0x8e, 0xe8, 0xf9, 0xed, 0xb9,
+  0x59, 0x5c, 0x60, 0x78, 0xc6, 0xe7, 0x06, 0xa5, 0xc4, 0x78, 0x5f, 0xcd,
+  0xe2, 0x11, 0x03, 0x71, 0x2e, 0xef, 0xd7, 0x3e, 0xbf, 0x6c, 0x7a, 0xf6,
+  0x48, 0xd2, 0x58, 0x68, 0x20, 0x2c, 0x90, 0xf5, 0xa7, 0xa7, 0x15, 0x97,
+  0x49, 0x37, 0xd5, 0x1e, 0x6b, 0x15, 0x40, 0xef, 0xec, 0x69, 0x2e, 0x9a,
+  0xaf, 0xba, 0x30, 0xeb, 0x98, 0x59, 0x3d, 0x9d, 0x4e, 0x8c, 0x6a, 0xac,
+  0xae, 0x40, 0x68, 0x39, 0xad, 0xb6, 0xad, 0x99, 0x3c, 0x1c, 0xc6, 0xd1,
+  0xa9, 0xae, 0x73, 0x74, 0xc9, 0x50, 0x00, 0x6b, 0x97, 0x26, 0xdb, 0x92,
+  0xd4, 0xbc, 0x87, 0xd5, 0xf7, 0x77, 0xbb, 0xc2, 0xf5, 0x9c, 0x03, 0x4c,
+  0x88, 0xea, 0xe4, 0x36, 0x29, 0x1f, 0xbf, 0xee, 0x75, 0xd1, 0x4e, 0xf2,
+  0xb9, 0x2b, 0x04, 0xb6, 0xba, 0xde, 0xc6, 0x65, 0x5c, 0x28, 0x5a, 0xfe,
+  0xa9, 0x35, 0xc3, 0x91, 0x61, 0x69, 0x0d, 0xd3, 0xc6, 0x98, 0x45, 0xc6,
+  0xb1, 0xb2, 0xdc, 0x0a, 0x1e, 0xd8, 0xb5, 0x09, 0x3c, 0x2f, 0xc7, 0xdb,
+  0x37, 0x21, 0xa1, 0x03, 0x52, 0x2f, 0xe5, 0x5b, 0xf3, 0x30, 0x2c, 0x96,
+  0xb5, 0xe5, 0xb3, 0x33, 0xf8, 0xd1, 0x16, 0x00, 0x92, 0x06, 0x9e, 0x0f,
+  0x6e, 0x76, 0x44, 0xca, 0x62, 0x60, 0xaf, 0x47, 0x63, 0xf9, 0x6a, 0x23,
+  0x68, 0x83, 0x94, 0xe8, 0xbd, 0x48, 0x9a, 0x6b, 0x61, 0x7a, 0x2c, 0x35,
+  0x30, 0xad, 0x9c, 0x5c, 0x10, 0x71, 0xeb, 0xc8, 0xfe, 0x43, 0xbc, 0x2b,
+  0x96, 0x13, 0x6f, 0x27, 0xe1, 0x92, 0x8c, 0xf5, 0x6b, 0x0b, 0xea, 0x67,
+  0x63, 0x6d, 0x30, 0x7c, 0x1d, 0xa9, 0xb0, 0xa0, 0xc7, 0x63, 0xed, 0x2d,
+  0x55, 0x20, 0x3d, 0x48, 0xd1, 0x78, 0xa4, 0x92, 0xb2, 0x88, 0xf6, 0xc8,
+  0x48, 0xb6, 0x2c, 0x4e, 0xe0, 0x65, 0x57, 0x9b, 0x65, 0x01, 0x57, 0x5a,
+  0x72, 0xe7, 0x00, 0xa5, 0xc1, 0xe6, 0x90, 0xb8, 0x0e, 0xf7, 0x40, 0xdf,
+  0x42, 0xf3, 0xdd, 0x59, 0x77, 0x1a, 0x3d, 0x46, 0x2a, 0xaa, 0xf8, 0xd6,
+  0x07, 0x5a, 0xc1, 0xe1, 0x8d, 0x38, 0x9c, 0x76, 0x8f, 0xf8, 0xea, 0x0a,
+  0x89, 0xda, 0x65, 0x16, 0x63, 0x8e, 0x1e, 0xba, 0x63, 0xca, 0x59, 0x62,
+  0x72, 0xed, 0x79, 0x05, 0xde, 0x02, 0x83, 0xe8, 0x10, 0x54, 0x24, 0x62,
+  0x46, 0x17, 0x86, 0x7d, 0x5b, 0x0e, 0x28, 0x79, 0x58, 0xca, 0x8f, 0x1d,
+  0x0e, 0x2a, 0x64, 0x1a, 0x33, 0x3d, 0x09, 0xfe, 0x46, 0x6e, 0xc1, 0x9c,
+  0xc0, 0x02, 0x44, 0x44, 0xc6, 0x84, 0xae, 0x3b, 0x17, 0xa0, 0xf7, 0x65,
+  0xac, 0xc4, 0x56, 0x15, 0xd5, 0x57, 0xdb, 0x4b, 0x1f, 0x80, 0xca, 0xdd,
+  0x5d, 0x0f, 0x52, 0xf5, 0x75, 0x18, 0xc1, 0x81, 0x97, 0x22, 0x5f, 0x96,
+  0xb4, 0x8f, 0xb5, 0xa0, 0x1e, 0x10, 0x67, 0x66, 0x25, 0xaf, 0x20, 0xa7,
+  0x98, 0x3c, 0xaf, 0x89, 0x80, 0x2b, 0x27, 0xb1, 0x4a, 0xd5, 0x2b, 0x67,
+  0xf4, 0xa7, 0x5c, 0x6a, 0x34, 0xa6, 0xa5, 0x5b, 0x77, 0xf8, 0xd4, 0x78,
+  0x59, 0xc8, 0x05, 0x2d, 0x82, 0x86, 0x47, 0x68, 0x45, 0xe7, 0xc9, 0x0a,
+  0x7e, 0x54, 0x46, 0x24, 0xbf, 0x51, 0x47, 0x71, 0xe7, 0xc8, 0xf6, 0x26,
+  0x02, 0x51, 0xff, 0xf9, 0xc7, 0xca, 0xe6, 0xd7, 0x26, 0xbe, 0xec, 0x1b,
+  0xbd, 0x4f, 0x85, 0x61, 0xdc, 0xe1, 0x41, 0xce, 0xed, 0xed, 0xb3, 0x7e,
+  0x33, 0xf3, 0x96, 0xea, 0xdb, 0x9d, 0xcc, 0xd7, 0x60, 0xe2, 0x41, 0xe9,
+  0x3b, 0x4c, 0xdf, 0xb6, 0x40, 0x6f, 0x4c, 0x01, 0x95, 0x1d, 0xa0, 0x4b,
+  0xb2, 0xe9, 0x66, 0x67, 0x1d, 0xc9, 0x89, 0x06, 0xa2, 0x6c, 0x27, 0x95,
+  0xc4, 0x35, 0xaa, 0x75, 0x10, 0xd7, 0x52, 0x33, 0xed, 0xf7, 0xf6, 0x6e,
+  0x70, 0xe8, 0x9d, 0x80, 0x4d, 0x86, 0x4d, 0xba, 0x0f, 0xd9, 0x37, 0xbf,
+  0xb1, 0x44, 0x01, 0x3e, 0x96, 0x95, 0x9f, 0x1a, 0x76, 0x54, 0x0c, 0x1a,
+  0x83, 0xff, 0xf7, 0xce, 0xec, 0xdc, 0x8f, 0xe8, 0x88, 0xdd, 0x31, 0x5e,
+  0xeb, 0x29, 0x6e, 0x69, 0xe7, 0x61, 0x7e, 0xe7, 0x0b, 0x24, 0x02, 0x52,
+  0x9f, 0x66, 0x7e, 0xc4, 0x4a, 0xca, 0x43, 0xcb, 0xe3, 0x02, 0x91, 0x38,
+  0xbf, 0xb4, 0x66, 0xc6, 0x0f, 0x73, 0xc1, 0x91, 0xf2, 0xd8, 0xa3, 0xb8,
+  0x46, 0xc8, 0x09, 0xef, 0xdc, 0x37, 0xfe, 0xfa, 0x30, 0x9f, 0xa2, 0x57,
+  0x54, 0xeb, 0x9c, 0x07, 0xf9, 0xfc, 0x5e, 0xd9, 0xf9, 0x02, 0xd0, 0x44,
+  0x96, 0x43, 0x02, 0xca, 0x47, 0x6e, 0x32, 0x8a, 0x74, 0xea, 0x54, 0x33,
+  0x1f, 0x82, 0xb2, 0x36, 0x6a, 0x9e, 0x05, 0x5b, 0xcf, 0xfb, 0xe9, 0xf3,
+  0xbe, 0xbd, 0x42, 0x4e, 0x16, 0xa5, 0x2c, 0x60, 0x05, 0xaa, 0x31, 0x7f,
+  0xa8, 0x65, 0x35, 0x2c, 0x1e, 0x0a, 0xd1, 0xf2, 0xfc, 0xde, 0x78, 0x9d,
+  0x72, 0x73, 0x5c, 0x50, 0xae, 0x4c, 0x9e, 0x17, 0x58, 0x85, 0x4a, 0x4f,
+  0xfd, 0x71, 0x61, 0x11, 0xa8, 0xbc, 0x10, 0x82, 0x67, 0x28, 0x2a, 0x5e,
+  0x6f, 0xcb, 0x36, 0xd5, 0xf6, 0x95, 0x2e, 0xfd, 0x4f, 0x68, 0xf1, 0x13,
+  0xa8, 0x2d, 0x77, 0xc2, 0xe5, 0xc4, 0xe0, 0x2b, 0xbd, 0xaf, 0xd3, 0x5b,
+  0xd2, 0x14, 0x32, 0x71, 0xa3, 0xdf, 0xc0, 0x35, 0xf3, 0x81, 0xb0, 0x89,
+  0x3b, 0xfd, 0x86, 0xe0, 0x1c, 0xb4, 0xf7, 0x63, 0x3d, 0x87, 0xac, 0x1e,
+  0xeb, 0x67, 0xb3, 0x34, 0x38, 0xa9, 0xa7, 0xed, 0xbb, 0x95, 0x37, 0xc4,
+  0x54, 0x54, 0xf0, 0x82, 0xc1, 0x64, 0x61, 0xa6, 0x14, 0x79, 0xb8, 0x53,
+  0x9c, 0x35, 0x2b, 0xe9, 0x41, 0xf1, 0x7f, 0x67, 0xf8, 0x99, 0x7b, 0x3e,
+  0x66, 0x2e, 0xde, 0x19, 0xf2, 0xa1, 0x45, 0x73, 0x3e, 0x9c, 0xbb, 0x46,
+  0x13, 0xca, 0xa2, 0x46, 0x41, 0xff, 0x5b, 0xef, 0xc8, 0xa8, 0x34, 0x72,
+  0x69, 0x59, 0xaa, 0xd9, 0x69, 0xa5, 0x96, 0xa8, 0x9d, 0x4d, 0xa3, 0x7b,
+  0x80, 0x32, 0xb8, 0x79, 0xd5, 0x81, 0xef, 0xeb, 0xaa, 0x01, 0xda, 0x78,
+  0x50, 0x4b, 0x2d, 0xfd, 0x22, 0xfe, 0x1d, 0x3d, 0xaa, 0x00, 0xef, 0x1f,
+  0xe7, 0x69, 0x6a, 0x94, 0x18, 0xc5, 0x19, 0x2f, 0xc1, 0x4a, 0xd9, 0x21,
+  0xd5, 0x27, 0x61, 0x37, 0xa1, 0x82, 0x85, 0x31, 0x30, 0x87, 0x74, 0xe0,
+  0xf9, 0xa3, 0x08, 0xcb, 0x59, 0x67, 0x76, 0xe3, 0x13, 0x90, 0xbb, 0x44,
+  0xac, 0x76, 0x42, 0x9a, 0xe6, 0x9e, 0x60, 0x68, 0xe4, 0x82, 0xeb, 0x88,
+  0x44, 0xc1, 0x49, 0x6a, 0x9d, 0x49, 0xac, 0x88, 0xab, 0x10, 0xbf, 0x63,
+  0xa7, 0xf5, 0x9f, 0x4d, 0x6e, 0x04, 0x70, 0xb1, 0xd6, 0x2e, 0x38, 0xc7,
+  0x46, 0x40, 0xf3, 0x56, 0x95, 0x7f, 0x71, 0xec, 0x37, 0x7a, 0xf8, 0xd0,
+  0x44, 0x89, 0xba, 0x24, 0xa2, 0x36, 0xc8, 0x1a, 0xad, 0xa3, 0x3d, 0x06,
+  0xf7, 0xa1, 0x6c, 0xb6, 0x53, 0xfc, 0xae, 0x57, 0x1a, 0x47, 0x0b, 0x51,
+  0xff, 0xe3, 0xb8, 0x93, 0xc1, 0x59, 0x77, 0xdb, 0x4a, 0x5b, 0xf6, 0x01,
+  0x31, 0xb2, 0xa8, 0xca, 0xfe, 0xf6, 0xe3, 0x35, 0x54, 0x7a, 0xdc, 0x64,
+  0x23, 0x51, 0x98, 0x78, 0x4a, 0x3d, 0xa1, 0xfb, 0xbe, 0xf8, 0x29, 0xf0,
+  0xec, 0xc0, 0xeb, 0xe9, 0xcc, 0xe2, 0x0e, 0xc2, 0x24, 0xad, 0x58, 0xe2,
+  0x80, 0x3f, 0x06, 0x0c, 0x1a, 0x90, 0xc1, 0x67, 0x67, 0xe3, 0xa0, 0x8a,
+  0x28, 0xde, 0x6e, 0xa6, 0x9e, 0x02, 0x47, 0xe6, 0x97, 0xaa, 0x47, 0xbf,
+  0x88, 0xe1, 0x8f, 0x2e, 0x6e, 0x19, 0xef, 0x85, 0x53, 0x05, 0x6b, 0x09,
+  0xb2, 0xcc, 0x9b, 0xba, 0x08, 0xde, 0xdd, 0x5b, 0x69, 0xec, 0xee, 0x21,
+  0xed, 0x62, 0x84, 0x82, 0x8a, 0x6f, 0xb7, 0x54, 0x57, 0x69, 0xbc, 0x51,
+  0x62, 0x73, 0x12, 0x98, 0x2e, 0xe3, 0xb8, 0x5f, 0xa3, 0xc1, 0x08, 0xbf,
+  0x4a, 0x87, 0x3f, 0x6a, 0xf0, 0x8b, 0x6d, 0xc2, 0xc0, 0x2e, 0x6a, 0x93,
+  0xbf, 0x0f, 0x5c, 0xf6, 0x4a, 0xd1, 0x21, 0x69, 0x65, 0x05, 0x66, 0x85,
+  0xc4, 0xb1, 0xe6, 0xc3, 0x0e, 0x73, 0x04, 0xdd, 0x8d, 0xf9, 0x0a, 0xa9,
+  0x81, 0xcf, 0x5f, 0xfb, 0xda, 0x4e, 0xd5, 0xd6, 0x8a, 0xd6, 0xad, 0x80,
+  0xb2, 0x47, 0xa7, 0x60, 0xba, 0x12, 0x64, 0x65, 0xa3, 0xcc, 0x65, 0xaa,
+  0x5d, 0x03, 0x98, 0xee, 0x04, 0x78, 0x35, 0xde, 0xc3, 0x6d, 0xcd, 0xfe,
+  0x97, 0x14, 0x83, 0x16, 0xa4, 0x17, 0x18, 0xfd, 0x12, 0xe9, 0x61, 0x70,
+  0xaa, 0xd2, 0xf4, 0xce, 0x9f, 0x18, 0x21, 0x02, 0x6a, 0x3b, 0x1f, 0x14,
+  0x92, 0xe4, 0x74, 0x5c, 0x83, 0x44, 0xb8, 0x3e, 0x98, 0xc6, 0x19, 0xa7,
+  0x5b, 0xbf, 0x89, 0x67, 0x90, 0x53, 0xeb, 0x2d, 0x81, 0x81, 0x72, 0x40,
+  0xb3, 0xdb, 0x3b, 0x31, 0xbf, 0x80, 0x31, 0x40, 0x46, 0x8b, 0x9d, 0xe4,
+  0x14, 0x9f, 0x9a, 0x2f, 0x7e, 0xea, 0x92, 0xbe, 0xd5, 0x5f, 0x10, 0x7d,
+  0x1e, 0xd1, 0x8f, 0x58, 0x40, 0x81, 0xdd, 0x5b, 0x74, 0xa1, 0xdd, 0x1e,
+  0xf7, 0xe3, 0x77, 0xa2, 0x3b, 0xbb, 0x03, 0x84, 0xff, 0xc8, 0x61, 0xe6,
+  0x6e, 0xb3, 0xd8, 0x79, 0xe7, 0x32, 0xa7, 0x43, 0xfe, 0x78, 0x30, 0x3e,
+  0xc8, 0x84, 0x91, 0xbd, 0x3f, 0x54, 0x9c, 0x8b, 0x0e, 0xb3, 0xee, 0xa7,
+  0x73, 0xb4, 0x4c, 0x75, 0x06, 0x2a, 0x77, 0x9e, 0x59, 0x7f, 0x8b, 0x82,
+  0x67, 0xac, 0x5e, 0xaa, 0x5d, 0x09, 0xa9, 0x8b, 0x44, 0x84, 0xcd, 0xe0,
+  0x74, 0x10, 0x81, 0xc3, 0x99, 0x78, 0x4a, 0x05, 0xbd, 0x44, 0xa0, 0xae,
+  0x66, 0x43, 0xd6, 0xee, 0x1f, 0x6f, 0x92, 0x7a, 0xd6, 0x5e, 0xa5, 0xde,
+  0x93, 0x96, 0x8d, 0x71, 0x06, 0x0b, 0x40, 0x8d, 0x08, 0x53, 0x13, 0x9b,
+  0x78, 0x12, 0xd8, 0x46, 0x9b, 0x19, 0x3d, 0x7e, 0x48, 0x29, 0x02, 0x6a,
+  0xdb, 0x8f, 0xb3, 0x43, 0xce, 0x9e, 0xe5, 0x0a, 0xc7, 0xc6, 0x41, 0x52,
+  0x29, 0xe2, 0x52, 0xef, 0x2f, 0x75, 0x9f, 0x38, 0xae, 0xf0, 0x8a, 0x0c,
+  0xdf, 0xb3, 0x1b, 0x1f, 0xef, 0x6d, 0x56, 0x27, 0x75, 0xf7, 0x88, 0x79,
+  0xbf, 0xbd, 0x56, 0x22, 0x87, 0xe1, 0x8d, 0x3f, 0xa1, 0x86, 0x3f, 0x27,
+  0x10, 0xf0, 0xed, 0x7e, 0x42, 0xa7, 0x53, 0x98, 0x71, 0x41, 0xa4, 0x61,
+  0xd8, 0x0b, 0xd0, 0x45, 0xe3, 0xdf, 0x19, 0xfa, 0x19, 0xa0, 0xa5, 0x73,
+  0x61, 0x02, 0x3a, 0x83, 0xc8, 0xbf, 0x15, 0x34, 0x7a, 0x8d, 0x78, 0x53,
+  0x31, 0xab, 0xa3, 0x3f, 0xcc, 0x0c, 0xd6, 0x9b, 0x28, 0xd3, 0xcb, 0xc3,
+  0x0d, 0x44, 0x12, 0xeb, 0x4d, 0xa4, 0xf0, 0xae, 0x85, 0xa4, 0xf7, 0x62,
+  0x36, 0xf9, 0xa2, 0x87, 0x3e, 0x08, 0xde, 0xb8, 0x4d, 0xfb, 0xfd, 0x8c,
+  0xf1, 0x11, 0x6a, 0x56, 0x23, 0x4b, 0x92, 0xc8, 0xdb, 0xc8, 0xc4, 0x7b,
+  0xa5, 0xde, 0x4b, 0x9f, 0x6e, 0xa6, 0xad, 0x84, 0x7a, 0xd0, 0x25, 0x8e,
+  0xbc, 0x63, 0xa8, 0x83, 0x95, 0x3c, 0x70, 0x44, 0x8f, 0x50, 0x90, 0x19,
+  0x41, 0xcc, 0xc0, 0xd3, 0x87, 0x16, 0xb5, 0x5f, 0xce, 0x70, 0x4e, 0xe0,
+  0x7a, 0x56, 0x4d, 0x32, 0x23, 0xb6, 0xbc, 0xcb, 0x87, 0x68, 0x0d, 0x3b,
+  0xc5, 0xaf, 0x81, 0x85, 0x5e, 0x0a, 0xc4, 0xc8, 0xec, 0xeb, 0x1c, 0x05,
+  0x79, 0xf6, 0x33, 0x90, 0xa3, 0x5e, 0xba, 0xf8, 0x54, 0x41, 0x3d, 0xbe,
+  0x82, 0x5c, 0x57, 0x3d, 0x31, 0x69, 0x09, 0x29, 0x5e, 0x9d, 0xf1, 0xb2,
+  0x79, 0x69, 0xd0, 0x51, 0xd9, 0xe2, 0x4d, 0xbb, 0x15, 0x82, 0xaa, 0xa8,
+  0xd2, 0x1f, 0xa1, 0x0a, 0x1e, 0x59, 0xed, 0xa1, 0xa1, 0x8d, 0xc5, 0x17,
+  0xa1, 0x1d, 0x84, 0x58, 0xbc, 0x60, 0x4e, 0x36, 0xd1, 0x60, 0x1c, 0xb6,
+  0xab, 0xc9, 0x76, 0xb7, 0xb8, 0x7a, 0xc7, 0xd4, 0xaf, 0x5f, 0x1a, 0x3c,
+  0x87, 0xab, 0xb5, 0xaf, 0x57, 0x9c, 0x23, 0x2e, 0x66, 0x97, 0xcb, 0xeb,
+  0xc0, 0x08, 0x37, 0x15, 0xc4, 0xdc, 0xde, 0xfe, 0x73, 0xcb, 0x69, 0x6b,
+  0x11, 0x02, 0x03, 0xb3, 0x65, 0x50, 0x5d, 0x00, 0x0d, 0x71, 0x10, 0x4a,
+  0x26, 0x33, 0x9a, 0xd0, 0xf1, 0xf8, 0x11, 0x56, 0xac, 0x51, 0xc8, 0xa0,
+  0x17, 0xdd, 0xdd, 0xc2, 0x47, 0xb0, 0x24, 0xb1, 0x94, 0x29, 0x58, 0x52,
+  0x10, 0x3e, 0x58, 0x8e, 0xcb, 0x69, 0xee, 0x6c, 0xb0, 0xe6, 0x8f, 0x39,
+  0xb5, 0xc7, 0x8c, 0x71, 0x57, 0xa6, 0x38, 0x8b, 0x65, 0x70, 0xb0, 0x7b,
+  0x8e, 0x55, 0xc1, 0x7d, 0xee, 0x46, 0x60, 0x7b, 0x92, 0xdd, 0x42, 0x63,
+  0xf2, 0xa1, 0xe1, 0x7e, 0x90, 0xb3, 0x65, 0x55, 0xc3, 0x06, 0xd8, 0xe1,
+  0x53, 0x36, 0x94, 0xb5, 0x0c, 0xf0, 0x14, 0xcd, 0x5f, 0xb0, 0x0d, 0x54,
+  0xc3, 0x70, 0xe6, 0x4a, 0x9a, 0x02, 0x31, 0x2b, 0xef, 0xd3, 0xf6, 0xd2,
+  0x2e, 0x40, 0xce, 0x0d, 0x71, 0x01, 0x2b, 0xf8, 0x64, 0xe3, 0x59, 0x6f,
+  0x1b, 0xb2, 0x74, 0xbd, 0xc2, 0x84, 0xa1, 0x53, 0x1d, 0x88, 0x50, 0x71,
+  0xbd, 0x92, 0x82, 0x02, 0xe7, 0x01, 0x3f, 0x34, 0x6b, 0x2a, 0x43, 0x06,
+  0x0a, 0x56, 0x8d, 0x51, 0xea, 0x95, 0xaf, 0x0a, 0xf6, 0x1d, 0xef, 0x7a,
+  0x7c, 0xfa, 0x00, 0xcf, 0x8f, 0xba, 0x5f, 0x40, 0x7b, 0x55, 0x4c, 0xbf,
+  0xa4, 0x9a, 0x85, 0xe2, 0x97, 0x80, 0xc3, 0x4b, 0x55, 0x0e, 0xae, 0xe5,
+  0x5d, 0x43, 0xb2, 0x56, 0x8e, 0x21, 0x74, 0x89, 0x14, 0x7a, 0x92, 0x3c,
+  0x93, 0x18, 0x08, 0xfd, 0x84, 0x21, 0x6a, 0xf8, 0xba, 0x5f, 0xa9, 0x1b,
+  0xf9, 0x4c, 0x23, 0x53, 0xbf, 0x3e, 0xd1, 0x01, 0xba, 0xd2, 0xa7, 0xaf,
+  0x1e, 0x81, 0x65, 0x07, 0x84, 0xf0, 0xf0, 0x2b, 0x04, 0x12, 0x08, 0x2a,
+  0x33, 0xd5, 0xb4, 0x02, 0x14, 0xbb, 0x57, 0x45, 0x9f, 0xb5, 0x1d, 0xd9,
+  0x0f, 0xd1, 0xfe, 0x1f, 0x61, 0xb5, 0xc8, 0x26, 0xa3, 0x36, 0xd9, 0x1d,
+  0x65, 0x4c, 0x07, 0xe2, 0x89, 0x6a, 0x28, 0x5e, 0x03, 0xf2, 0x59, 0x29,
+  0x3d, 0xe0, 0xf2, 0x9d, 0xec, 0xd9, 0x7e, 0x1c, 0x26, 0x0b, 0x08, 0x0f,
+  0xac, 0xd9, 0x9a, 0x4f, 0x87, 0xd2, 0x6e, 0x65, 0x1a, 0x77, 0x43, 0x7c,
+  0xa0, 0x58, 0x4a, 0xdc, 0x73, 0xec, 0x32, 0x50, 0x41, 0xd5, 0x17, 0x23,
+  0xf3, 0x40, 0xcf, 0xca, 0x30, 0x46, 0xfc, 0xea, 0xc0, 0x77, 0xd3, 0x2e,
+  0x35, 0xaa, 0x8e, 0xfb, 0x41, 0x78, 0x73, 0x12, 0xe6, 0x25, 0xf8, 0x72,
+  0x04, 0xd2, 0x89, 0xf9, 0x72, 0xab, 0x51, 0x3a, 0x52, 0x01, 0xd7, 0xb1,
+  0x2e, 0xc2, 0xcf, 0x44, 0x48, 0xd3, 0x3a, 0xb3, 0x88, 0x56, 0xfa, 0x72,
+  0x31, 0x3c, 0x54, 0x4f, 0x8b, 0xd2, 0x18, 0x6b, 0xb2, 0x7b, 0x82, 0x08,
+  0x9f, 0x06, 0xbc, 0x77, 0x9d, 0x37, 0xab, 0xae, 0xa4, 0x18, 0xc4, 0x95,
+  0x41, 0xd3, 0xa2, 0xf9, 0xae, 0x89, 0x54, 0x49, 0xaa, 0x47, 0xfe, 0xeb,
+  0xff, 0x34, 0x55, 0x74, 0x86, 0x89, 0x82, 0x78, 0x44, 0x3b, 0x0d, 0x2f,
+  0xa0, 0xb2, 0x57, 0x4f, 0xba, 0x86, 0x90, 0x46, 0x97, 0x2f, 0xeb, 0xf9,
+  0x1e, 0x46, 0x7e, 0x40, 0xf4, 0xb3, 0x0b, 0x82, 0x18, 0x87, 0xe8, 0x65,
+  0xac, 0x5e, 0xd7, 0x36, 0x72, 0x4a, 0x10, 0xc4, 0x6e, 0xaf, 0xf3, 0x2f,
+  0x57, 0xa9, 0x07, 0x73, 0x42, 0x95, 0x31, 0x5b, 0x30, 0xfc, 0xc4, 0x6e,
+  0xcf, 0xaf, 0xdc, 0x49, 0x14, 0x72, 0xb8, 0x00, 0xad, 0x5c, 0x8c, 0x6f,
+  0xea, 0x25, 0x56, 0xbd, 0xbe, 0x34, 0x86, 0xd2, 0x8a, 0xe9, 0xbf, 0x28,
+  0xed, 0xfd, 0x73, 0xdc, 0xda, 0xe3, 0x0a, 0x53, 0x62, 0x69, 0xbf, 0x13,
+  0x92, 0x69, 0xbf, 0x7d, 0xb0, 0xe5, 0xd8, 0x1e, 0x56, 0xb6, 0xca, 0x08,
+  0x4a, 0xda, 0xa5, 0x1c, 0x55, 0x22, 0x19, 0x65, 0x33, 0xca, 0xcd, 0x50,
+  0x36, 0xff, 0x40, 0x33, 0x6d, 0x5a, 0xe4, 0xd0, 0xe1, 0x6f, 0x8b, 0x45,
+  0xe3, 0x0f, 0x57, 0x17, 0x84, 0xa1, 0x10, 0x39, 0x1d, 0xbe, 0x0f, 0x20,
+  0x30, 0xc8, 0x5f, 0x74, 0x64, 0xf8, 0x9e, 0xcb, 0x5b, 0x04, 0x9e, 0xe1,
+  0x57, 0x52, 0x7e, 0x22, 0x59, 0x12, 0x54, 0xae, 0x1f, 0x10, 0x41, 0x7b,
+  0x94, 0x59, 0xa3, 0x12, 0xd6, 0x47, 0xc0, 0x01, 0xac, 0xe7, 0x42, 0x9d,
+  0xb6, 0xee, 0xac, 0x9e, 0x23, 0x17, 0x5d, 0xbe, 0x68, 0xfd, 0xa7, 0x77,
+  0xfb, 0xec, 0x0c, 0xba, 0xe4, 0x1f, 0x94, 0xc0, 0x23, 0x3c, 0x57, 0x8d,
+  0xc2, 0xdb, 0x7c, 0x10, 0x62, 0x95, 0xb4, 0x80, 0x6d, 0x3a, 0xd6, 0x38,
+  0x34, 0x9f, 0x1c, 0xb2, 0xd8, 0x11, 0x95, 0xfb, 0xff, 0x71, 0x0d, 0x07,
+  0x9a, 0x08, 0xd1, 0xc4, 0xe3, 0xfb, 0x7c, 0xbc, 0x8a, 0x06, 0xac, 0x94,
+  0x62, 0x9e, 0xa5, 0xe3, 0x8f, 0x47, 0x7a, 0x90, 0xad, 0xb3, 0xe6, 0x8c,
+  0x5e, 0x75, 0xb2, 0xfe, 0x03, 0x23, 0x28, 0x20, 0xc3, 0x12, 0xc1, 0xc7,
+  0xab, 0xf8, 0x93, 0x07, 0xc0, 0x44, 0x2c, 0x58, 0x51, 0xf7, 0x94, 0xaf,
+  0x28, 0x98, 0xae, 0xdf, 0x05, 0x8e, 0x74, 0x03, 0x34, 0xe3, 0x29, 0xb3,
+  0xf8, 0x01, 0xf8, 0xc0, 0x5e, 0x2d, 0xb1, 0xa1, 0xad, 0x68, 0x1f, 0xfe,
+  0xb2, 0x99, 0x58, 0x81, 0xd9, 0x0c, 0x9d, 0x9b, 0xc1, 0x30, 0xdb, 0xf5,
+  0x3f, 0x63, 0x90, 0x72, 0x15, 0x7f, 0x46, 0xb8, 0x99, 0x63, 0xa7, 0x5f,
+  0x44, 0x25, 0x84, 0x4a, 0x22, 0x60, 0x86, 0x94, 0x92, 0xc1, 0x39, 0x4d,
+  0x1f, 0x84, 0x6e, 0xa9, 0x0d, 0x7c, 0x76, 0xab, 0xcf, 0x7c, 0x8c, 0x34,
+  0x85, 0xbb, 0x79, 0x15, 0x44, 0xda, 0x44, 0x3f, 0x3b, 0x8e, 0x64, 0x34,
+  0xe2, 0xd8, 0x66, 0xdf, 0xd3, 0xb7, 0x3c, 0x8b, 0xe9, 0x12, 0x25, 0xdc,
+  0x25, 0x06, 0xe7, 0x66, 0x67, 0xfa, 0x4e, 0x7f, 0x7c, 0xbc, 0x58, 0xea,
+  0xbc, 0x54, 0xbb, 0x17, 0xda, 0x96, 0x50, 0xc6, 0xfc, 0xb1, 0x23, 0x88,
+  0x27, 0xd6, 0x9f, 0x59, 0xfe, 0xd7, 0x5c, 0xdb, 0x28, 0x53, 0xf9, 0xa3,
+  0x0c, 0xdf, 0x40, 0xa2, 0xc8, 0xe1, 0x09, 0x0c, 0xcb, 0xbd, 0x4f, 0x9d,
+  0x6e, 0x06, 0x2f, 0xa4, 0x54, 0x4a, 0x2b, 0x30, 0x23, 0x61, 0x94, 0x62,
+  0xfb, 0x4b, 0x84, 0xa7, 0x9f, 0x89, 0x8d, 0x00, 0xc1, 0xd8, 0x74, 0x30,
+  0xc5, 0xaa, 0x28, 0xe4, 0xa9, 0x40, 0xb8, 0x74, 0x7b, 0x6f, 0x96, 0x74,
+  0xb2, 0x09, 0x62, 0xb9, 0xb1, 0x50, 0x0e, 0x02, 0xff, 0x11, 0x0b, 0x67,
+  0xa4, 0xaa, 0x3d, 0x51, 0xb2, 0xef, 0x7a, 0x34, 0xc5, 0xde, 0x06, 0x47,
+  0x5a, 0x71, 0x83, 0x6f, 0x86, 0x70, 0x0a, 0x75, 0x41, 0xb4, 0xe7, 0xdb,
+  0x34, 0x8e, 0x5d, 0x9d, 0xfa, 0x11, 0xc4, 0xfd, 0xa2, 0x41, 0x93, 0x34,
+  0x19, 0x18, 0xdf, 0x50, 0x20, 0xa6, 0x8f, 0xd7, 0xfd, 0x41, 0x4c, 0xef,
+  0x0b, 0xfe, 0x1c, 0x2e, 0x65, 0x30, 0x4b, 0xdd, 0x24, 0x1a, 0x59, 0x2e,
+  0x5d, 0x46, 0xc1, 0x5c, 0x53, 0xfc, 0xa0, 0xb5, 0x38, 0x8c, 0x26, 0x5b,
+  0x2d, 0x57, 0x84, 0xd2, 0x16, 0x7c, 0x1f, 0x61, 0xba, 0x01, 0xa6, 0x68,
+  0x4d, 0x3b, 0xd3, 0x4a, 0x67, 0x07, 0xbc, 0xf8, 0x4e, 0x05, 0xc0, 0xa5,
+  0x04, 0x5d, 0x6a, 0x82, 0x6a, 0x6a, 0x5e, 0xa7, 0xc8, 0x70, 0xfc, 0x9a,
+  0x51, 0x11, 0x74, 0x61, 0x3f, 0xfd, 0xe5, 0x64, 0x5e, 0x9c, 0xe4, 0x76,
+  0x1c, 0x3a, 0x90, 0x17, 0x48, 0x5d, 0x43, 0x40, 0xa7, 0xd7, 0x7c, 0x43,
+  0xc4, 0x3f, 0xc0, 0xe6, 0xec, 0x09, 0xa2, 0xfc, 0x2d, 0x12, 0xbc, 0x2b,
+  0x64, 0xa2, 0x37, 0xad, 0x02, 0x08, 0x96, 0x7a, 0x8c, 0x8c, 0x55, 0xc3,
+  0xa4, 0x2c, 0x9a, 0x03, 0x94, 0x87, 0xe3, 0x49, 0xd8, 0x8a, 0xe7, 0x66,
+  0x1a, 0x2a, 0x3c, 0x0a, 0x65, 0x76, 0x34, 0xbb, 0x50, 0x4f, 0x5a, 0xfd,
+  0x87, 0x2b, 0x88, 0x7a, 0xe3, 0xe1, 0x99, 0x36, 0xee, 0x7e, 0x66, 0x91,
+  0xd6, 0x15, 0x9f, 0xd4, 0x9f, 0x00, 0x87, 0x07, 0xd3, 0x71, 0x42, 0xc1,
+  0x57, 0x63, 0xe8, 0x2c, 0x3c, 0xe4, 0xb6, 0xeb, 0x40, 0x0c, 0x76, 0x22,
+  0x39, 0x88, 0xd0, 0x3f, 0xef, 0xb8, 0x46, 0xfa, 0x08, 0xf3, 0x84, 0x61,
+  0x24, 0x73, 0x22, 0xbc, 0x52, 0xee, 0x12, 0x4f, 0x39, 0xcd, 0x81, 0x9d,
+  0x37, 0x0b, 0x24, 0xf2, 0x74, 0x2b, 0x11, 0x24, 0x9b, 0x27, 0xa6, 0xbc,
+  0x26, 0xd5, 0x4b, 0xb6, 0x04, 0x77, 0xab, 0x6b, 0xe8, 0x4d, 0x60, 0x59,
+  0x94, 0x90, 0xba, 0x7f, 0x1a, 0x93, 0x5e, 0xae, 0x2c, 0xe4, 0xcf, 0x76,
+  0xd1, 0xc8, 0x00, 0x05, 0xce, 0xd3, 0x40, 0xdf, 0x46, 0x52, 0x92, 0x22,
+  0xc1, 0x55, 0xe3, 0x76, 0xfd, 0x61, 0xc6, 0xf3, 0xb9, 0xf5, 0x5c, 0x43,
+  0xa0, 0xfc, 0x1a, 0x34, 0x29, 0x60, 0x49, 0x08, 0x37, 0x9d, 0x1b, 0x32,
+  0x4a, 0xb5, 0x43, 0x8b, 0x5e, 0xe7, 0xc9, 0xd9, 0x4c, 0x7c, 0x79, 0xcc,
+  0xcf, 0x50, 0xfc, 0xcb, 0xb4, 0xed, 0x19, 0x7e, 0x61, 0x31, 0xd9, 0x27,
+  0x30, 0x1f, 0x9f, 0x21, 0xd6, 0xbd, 0x34, 0x5e, 0x88, 0x29, 0xfa, 0x42,
+  0xef, 0x1c, 0xa1, 0xd3, 0xaa, 0x26, 0xca, 0x8f, 0xdc, 0xf0, 0x80, 0xd0,
+  0x5f, 0xa9, 0x6b, 0x73, 0x86, 0x43, 0x4f, 0x59, 0xa4, 0x31, 0xd0, 0xf8,
+  0xf8, 0x1b, 0x01, 0xf4, 0x90, 0x5c, 0x41, 0x75, 0xb6, 0xca, 0x76, 0xf6,
+  0x49, 0x3e, 0xe9, 0xd5, 0x99, 0x49, 0x84, 0x4c, 0xa3, 0xed, 0x5d, 0xfd,
+  0xd5, 0xeb, 0x01, 0x33, 0x9b, 0x16, 0x6a, 0x02, 0xe1, 0xce, 0x2e, 0x24,
+  0x6b, 0xea, 0x8a, 0x06, 0x89, 0xdc, 0x1c, 0xc7, 0x27, 0xa5, 0x13, 0x2b,
+  0x1a, 0x0e, 0xa5, 0x8d, 0x0b, 0x88, 0xec, 0xbc, 0xc8, 0x41, 0x1f, 0xa7,
+  0xb9, 0x95, 0xaf, 0x44, 0xd5, 0x63, 0xc1, 0xe4, 0xea, 0x72, 0xad, 0x18,
+  0x97, 0x9b, 0xd5, 0x81, 0xe7, 0x2d, 0x33, 0xab, 0xa2, 0x51, 0x3a, 0xbc,
+  0x6c, 0xc0, 0x49, 0x3f, 0xf9, 0x6a, 0x03, 0x86, 0x22, 0x54, 0x2c, 0xa4,
+  0x89, 0xf2, 0xfe, 0x60, 0x9c, 0xe4, 0xe3, 0xe3, 0xad, 0x99, 0xb0, 0x02,
+  0x54, 0xf9, 0xd2, 0xbc, 0x71, 0xf8, 0xe5, 0xd5, 0x4c, 0xae, 0xba, 0x04,
+  0x32, 0xc4, 0x0c, 0x77, 0x6a, 0xb4, 0xad, 0xf6, 0xe9, 0x94, 0x16, 0xc0,
+  0x5d, 0xaa, 0xe4, 0x76, 0xd4, 0x44, 0x77, 0x18, 0x7b, 0x9c, 0x7c, 0x29,
+  0x5a, 0xf0, 0x42, 0xd2, 0x79, 0x7b, 0xaa, 0x1e, 0x32, 0x85, 0x9f, 0x52,
+  0x7a, 0xdf, 0xae, 0xb6, 0x0f, 0x0c, 0xec, 0x6d, 0xba, 0xe0, 0x2b, 0x45,
+  0x3d, 0x73, 0x79, 0xd5, 0xb3, 0xf5, 0xde, 0xe1, 0xc4, 0x59, 0xa2, 0x7a,
+  0x23, 0x6b, 0xcc, 0x12, 0xe5, 0x9a, 0x1c, 0x95, 0x13, 0x69, 0xfc, 0xc4,
+  0x84, 0x35, 0x1b, 0x21, 0x0b, 0xb3, 0x37, 0xd2, 0xa4, 0x0c, 0x97, 0x89,
+  0xd7, 0xab, 0x48, 0x4e, 0xf7, 0x88, 0x9d, 0x67, 0xfc, 0x42, 0xfd, 0x90,
+  0x6b, 0xb4, 0x6c, 0x2b, 0xcb, 0x08, 0x63, 0x13, 0xfb, 0x22, 0xb5, 0x79,
+  0x12, 0x0b, 0x75, 0xd1, 0xe3, 0x17, 0x5b, 0x5a, 0xdc, 0xb0, 0x63, 0x8d,
+  0x52, 0xcc, 0x27, 0xce, 0xa1, 0x25, 0x16, 0xf2, 0x70, 0x5f, 0x13, 0xbb,
+  0xc3, 0x05, 0x72, 0xca, 0x6d, 0xd0, 0x98, 0x34, 0xc4, 0x27, 0x36, 0x0b,
+  0xd3, 0xb5, 0xc0, 0x87, 0x37, 0x5d, 0x6c, 0xdb, 0x44, 0x8f, 0x28, 0x77,
+  0x50, 0xc3, 0x55, 0xa9, 0x90, 0x25, 0xc3, 0x92, 0x4a, 0x20, 0xfe, 0xad,
+  0xa9, 0xcf, 0x40, 0x1c, 0x92, 0x53, 0x84, 0x06, 0x25, 0x84, 0xcd, 0x3e,
+  0xb3, 0xbe, 0x30, 0x85, 0x14, 0xbd, 0xac, 0xca, 0xf6, 0x64, 0x0c, 0x2d,
+  0x47, 0xa4, 0x75, 0x69, 0xfa, 0xc2, 0xb9, 0x68, 0xb6, 0x18, 0x62, 0x05,
+  0xa2, 0x10, 0xfa, 0x4d, 0x17, 0xab, 0x8d, 0x39, 0xea, 0x6f, 0x25, 0xaf,
+  0x26, 0xd5, 0x72, 0xb7, 0xf0, 0xd9, 0x6f, 0x94, 0x1c, 0x48, 0x97, 0x08,
+  0xf0, 0xbd, 0x47, 0x54, 0x30, 0x2f, 0x6d, 0x9c, 0x27, 0x47, 0xab, 0x86,
+  0xab, 0xfe, 0xcb, 0xa4, 0x9a, 0x4e, 0xd3, 0xff, 0xd2, 0x9b, 0x5d, 0x38,
+  0x65, 0x81, 0xa4, 0xe5, 0x2b, 0x60, 0x06, 0x9c, 0x2a, 0x66, 0x7d, 0xa1,
+  0x83, 0x94, 0xa1, 0xba, 0xad, 0x2a, 0x72, 0x19, 0x37, 0xaa, 0x9b, 0x5f,
+  0xe1, 0xeb, 0x43, 0x22, 0xa3, 0x1a, 0xea, 0x75, 0x0a, 0xae, 0x38, 0xcc,
+  0x24, 0x2b, 0xb1, 0x78, 0x53, 0x63, 0xff, 0xa8, 0x07, 0x05, 0x4e, 0xf4,
+  0x63, 0x41, 0x16, 0xb1, 0xd8, 0xd0, 0xcf, 0x22, 0x52, 0xd9, 0xda, 0xd3,
+  0xf3, 0x05, 0x73, 0x22, 0x83, 0x91, 0xfb, 0x7b, 0x8b, 0x2d, 0xf3, 0x59,
+  0xbd, 0x71, 0x47, 0x5e, 0xa4, 0x04, 0xd7, 0x6e, 0x64, 0xcf, 0x82, 0xce,
+  0x0f, 0x3d, 0x21, 0x07, 0x0a, 0x26, 0xda, 0x36, 0x7b, 0x75, 0x06, 0x0d,
+  0x00, 0x16, 0x37, 0xcc, 0x9d, 0xd7, 0x7c, 0x39, 0x50, 0x54, 0xff, 0x30,
+  0xb6, 0x90, 0xbf, 0xaa, 0xe6, 0xcc, 0x98, 0x83, 0x93, 0xa6, 0x4c, 0xed,
+  0x0d, 0x43, 0xac, 0x2c, 0x28, 0xe3, 0xb2, 0x15, 0x03, 0xbd, 0x29, 0xe5,
+  0xba, 0x5e, 0x6d, 0xa2, 0x7f, 0x64, 0x13, 0x9a, 0x3c, 0xee, 0x04, 0x14,
+  0xb6, 0x7b, 0x0e, 0xad, 0xda, 0x42, 0xeb, 0x8b, 0xe2, 0x7d, 0xe6, 0x31,
+  0x87, 0xc2, 0x03, 0x04, 0x66, 0x95, 0x63, 0x8b, 0xe9, 0xb5, 0x97, 0x4e,
+  0x66, 0x9a, 0x44, 0x64, 0x8e, 0x1d, 0x45, 0x91, 0x88, 0x3b, 0x94, 0xbc,
+  0xe5, 0x80, 0x9d, 0xb1, 0x9d, 0x86, 0xb2, 0xb8, 0xef, 0x95, 0x98, 0x41,
+  0x66, 0x22, 0xcf, 0x66, 0x56, 0xd0, 0x15, 0x05, 0x96, 0xa6, 0xd7, 0xe0,
+  0x79, 0xca, 0x47, 0xe6, 0x37, 0x7d, 0x28, 0xfe, 0x4a, 0x26, 0xac, 0xfc,
+  0x94, 0x5e, 0x46, 0x29, 0x7a, 0x10, 0xad, 0x38, 0x9c, 0xfd, 0xd3, 0x41,
+  0x2f, 0xea, 0x1d, 0x1e, 0x3b, 0xb3, 0xa3, 0x1a, 0xcc, 0xa9, 0x16, 0x6a,
+  0x88, 0x96, 0x90, 0xb6, 0xe3, 0x51, 0x6d, 0x0c, 0x19, 0xf6, 0x7d, 0x13,
+  0x80, 0xbc, 0x4a, 0x17, 0xe0, 0x4b, 0x3d, 0x18, 0x52, 0x29, 0x35, 0xdd,
+  0x74, 0x5f, 0xbf, 0xa4, 0x51, 0x5a, 0xc9, 0x35, 0xd9, 0x11, 0x64, 0x45,
+  0xbf, 0x03, 0xc9, 0xf3, 0x36, 0x40, 0x1f, 0xed, 0x30, 0x21, 0xc7, 0xa7,
+  0x2c, 0x7c, 0xb1, 0x2c, 0x55, 0xa0, 0xe1, 0xd8, 0x3f, 0xdc, 0x42, 0x8e,
+  0x84, 0xd4, 0xfe, 0xbe, 0xdc, 0x3d, 0xb3, 0x62, 0xe0, 0x51, 0x29, 0x30,
+  0x5d, 0x92, 0x15, 0x9f, 0x99, 0x54, 0xe8, 0x90, 0xe0, 0x9d, 0xc0, 0x82,
+  0xee, 0x6f, 0x5e, 0x20, 0xf7, 0x83, 0x30, 0x07, 0x2c, 0x66, 0xbd, 0x69,
+  0x50, 0x81, 0x10, 0x20, 0x77, 0xed, 0x65, 0xad, 0x2f, 0x9b, 0x8f, 0x10,
+  0x9f, 0xe1, 0x6d, 0x27, 0x1c, 0x93, 0x58, 0xeb, 0xfa, 0x05, 0x93, 0xbc,
+  0xfe, 0x23, 0x9b, 0x99, 0x33, 0x28, 0xd1, 0x76, 0xbc, 0xde, 0x0a, 0x3c,
+  0x7e, 0x67, 0xae, 0x6f, 0x5d, 0xb0, 0xd8, 0xc9, 0x3f, 0xda, 0x87, 0x57,
+  0xf5, 0x3d, 0x04, 0x79, 0xb4, 0xd8, 0x5d, 0xf0, 0x9e, 0xa3, 0x6f, 0x0a,
+  0x38, 0x05, 0x35, 0x55, 0xd6, 0xfa, 0x9f, 0x76, 0x48, 0x38, 0x66, 0x29,
+  0x4f, 0xbe, 0x33, 0xbd, 0x72, 0xe1, 0x8a, 0xac, 0xd1, 0xbe, 0xe6, 0x56,
+  0x82, 0xf7, 0xf8, 0x09, 0x4c, 0x76, 0xc4, 0x89, 0xe8, 0xd4, 0xf2, 0xb9,
+  0x3d, 0xd4, 0x2c, 0x40, 0x43, 0xf9, 0xc0, 0x85, 0xf1, 0xcd, 0x29, 0x69,
+  0x17, 0x02, 0xc3, 0x6c, 0x11, 0x95, 0x6b, 0x98, 0x2d, 0x5b, 0x34, 0x41,
+  0xc2, 0x73, 0xdf, 0x9a, 0xeb, 0xd0, 0x01, 0xd2, 0xdf, 0xc4, 0x42, 0x2a,
+  0xf3, 0x3d, 0x4e, 0x3e, 0xe7, 0x36, 0x4f, 0x29, 0x92, 0xb2, 0xdf, 0xfe,
+  0xef, 0x31, 0x4a, 0x30, 0x55, 0xad, 0x7d, 0x78, 0x70, 0x4a, 0x85, 0x52,
+  0xf3, 0xbf, 0x94, 0xd6, 0x4c, 0x17, 0x57, 0xb7, 0xcb, 0xa9, 0xcb, 0xdc,
+  0x43, 0xf7, 0x06, 0x05, 0x76, 0x95, 0x83, 0x14, 0x2d, 0x3c, 0xbc, 0x9b,
+  0x56, 0x51, 0x2b, 0x11, 0x03, 0x0d, 0xc4, 0x10, 0x52, 0x77, 0x71, 0x3a,
+  0x99, 0xc7, 0x08, 0x7f, 0xb3, 0x12, 0x42, 0x20, 0x87, 0xdc, 0x32, 0x4e,
+  0x21, 0xa9, 0xc2, 0xa5, 0xe6, 0xb9, 0xe3, 0xaf, 0x6c, 0xdc, 0xe6, 0x4e,
+  0xc5, 0x57, 0xf7, 0x98, 0x02, 0xa6, 0xe5, 0x0a, 0xa4, 0xa1, 0x3f, 0x5a,
+  0x91, 0xd9, 0x16, 0xd5, 0x48, 0x78, 0xf3, 0x9b, 0xfe, 0x0d, 0xfd, 0x70,
+  0xfc, 0x5a, 0x11, 0xa9, 0x4e, 0xf2, 0x38, 0x58, 0xc6, 0x85, 0x78, 0x58,
+  0xa0, 0xba, 0x47, 0xdd, 0xf7, 0xe7, 0x8c, 0x48, 0xfb, 0x83, 0x14, 0xee,
+  0xbb, 0xd3, 0xde, 0x05, 0xe8, 0xce, 0xc2, 0xf5, 0x03, 0xd0, 0x3e, 0x85,
+  0x43, 0x1a, 0xeb, 0xc6, 0x54, 0x67, 0x53, 0x3a, 0xc2, 0x71, 0x9f, 0x2f,
+  0x3d, 0x9a, 0x6a, 0x6c, 0x2a, 0xf1, 0x9b, 0x3c, 0x48, 0xf2, 0xc3, 0xb9,
+  0x27, 0xe8, 0xc1, 0x57, 0xb9, 0x26, 0x96, 0xc1, 0x1e, 0xbd, 0x88, 0x4a,
+  0x31, 0xa5, 0x32, 0x81, 0xb0, 0xdb, 0x89, 0x6f, 0x84, 0xf1, 0x02, 0x66,
+  0xb8, 0xdc, 0xef, 0xb5, 0x2f, 0x68, 0xc7, 0x38, 0x9d, 0x34, 0x9b, 0xd9,
+  0x51, 0xe8, 0xc6, 0x06, 0x46, 0xfb, 0xa9, 0xd4, 0xad, 0x76, 0x31, 0x73,
+  0x85, 0x82, 0x9d, 0x3e, 0x98, 0x0b, 0xf0, 0x85, 0x31, 0x9c, 0x7e, 0x78,
+  0x60, 0x21, 0x5f, 0x57, 0xd0, 0xfc, 0x84, 0xf7, 0xfa, 0x99, 0xbe, 0x54,
+  0xbc, 0x49, 0x92, 0x1f, 0x69, 0xce, 0xd2, 0x30, 0x67, 0x59, 0x1b, 0x8f,
+  0x4e, 0x0a, 0xd3, 0x5b, 0x89, 0x4b, 0x0d, 0xc6, 0x8d, 0xf8, 0x90, 0x90,
+  0xd8, 0x49, 0x41, 0xb5, 0x57, 0x7e, 0x2a, 0xc6, 0x6d, 0xc5, 0x6b, 0x3c,
+  0xc0, 0x77, 0x87, 0xbc, 0x35, 0x32, 0xfe, 0x07, 0xeb, 0x1f, 0xc8, 0x1b,
+  0x81, 0x4a, 0x9f, 0x9d, 0xd8, 0x58, 0xf7, 0x90, 0x0b, 0xc4, 0xe5, 0xcb,
+  0xc7, 0x1d, 0x1d, 0xc3, 0x88, 0xac, 0xbf, 0xb9, 0xb3, 0x4e, 0xdf, 0xdc,
+  0x84, 0x2b, 0x56, 0x97, 0x47, 0xb7, 0xcd, 0x41, 0x82, 0x7c, 0x1d, 0x55,
+  0xee, 0x01, 0x43, 0x8b, 0x47, 0x86, 0x94, 0x21, 0xff, 0x6d, 0x3f, 0xcc,
+  0xbf, 0xec, 0x71, 0xab, 0x96, 0xde, 0x6d, 0x79, 0xb5, 0x74, 0x89, 0xb6,
+  0xd5, 0xbf, 0x44, 0x33, 0x4f, 0x17, 0x03, 0x7c, 0x65, 0x6e, 0xfe, 0x55,
+  0x9b, 0x39, 0x1b, 0xac, 0x8a, 0xf3, 0xa3, 0x51, 0x14, 0x7e, 0x0a, 0x85,
+  0x49, 0x8b, 0x9c, 0xa4, 0x69, 0x7c, 0x18, 0x3c, 0xbb, 0xa3, 0xda, 0x2f,
+  0xea, 0x24, 0x69, 0xc0, 0xb3, 0xf3, 0x15, 0x98, 0xc2, 0x9e, 0x20, 0xb6,
+  0xa8, 0xc3, 0x33, 0x3e, 0x4c, 0xd3, 0x5a, 0x24, 0x31, 0x43, 0x14, 0x3e,
+  0x0d, 0x54, 0x26, 0x0e, 0xb0, 0x01, 0x73, 0x1d, 0xe4, 0x9e, 0xb8, 0x94,
+  0xe4, 0x4c, 0xcc, 0x46, 0xd8, 0x5e, 0xaa, 0x36, 0xe9, 0x56, 0xd2, 0xdb,
+  0x7f, 0x39, 0x00, 0xe6, 0xa8, 0x7b, 0x30, 0x41, 0x8c, 0xe3, 0xe4, 0xb5,
+  0x3a, 0x47, 0x29, 0x56, 0x13, 0x2d, 0x80, 0x6d, 0x1d, 0x66, 0xda, 0x19,
+  0xae, 0xe3, 0x1c, 0x26, 0xbd, 0xaf, 0x91, 0xfd, 0x49, 0x21, 0xcd, 0xa5,
+  0x55, 0x87, 0xe3, 0x43, 0x80, 0xa8, 0x39, 0xe7, 0xe9, 0x21, 0xb0, 0x9b,
+  0x5f, 0xe1, 0x99, 0x5f, 0x0b, 0x08, 0x80, 0xa1, 0xa4, 0x2e, 0x4d, 0x66,
+  0x5a, 0xc1, 0xd8, 0xcc, 0x9a, 0xcf, 0xee, 0x06, 0xa3, 0x0d, 0x8a, 0x0a,
+  0xf4, 0xcf, 0x2a, 0xa6, 0x52, 0x69, 0x35, 0xc8, 0x62, 0x98, 0x7f, 0xd3,
+  0x8b, 0x1b, 0x84, 0xad, 0x63, 0x86, 0x24, 0x37, 0x31, 0x10, 0xcf, 0x20,
+  0xbe, 0x8a, 0xa7, 0x9e, 0x5a, 0x49, 0x99, 0x3e, 0x19, 0x5a, 0x2a, 0x3b,
+  0x40, 0xf0, 0xb7, 0xca, 0xfc, 0xf8, 0xe1, 0xbf, 0x57, 0x89, 0x86, 0x74,
+  0x10, 0x98, 0x81, 0x90, 0x10, 0x4d, 0x74, 0xea, 0x76, 0xe7, 0xb3, 0x19,
+  0x07, 0x61, 0xee, 0x04, 0x28, 0xbb, 0x69, 0x3c, 0x06, 0xeb, 0x6f, 0x76,
+  0x5a, 0xa5, 0xaa, 0x32, 0xf4, 0x39, 0x2c, 0x4f, 0xba, 0x01, 0xc9, 0xec,
+  0x46, 0x60, 0xa6, 0x77, 0x29, 0x2e, 0x85, 0xe1, 0x54, 0xb5, 0xf3, 0x55,
+  0x8b, 0xd8, 0x14, 0x13, 0x6f, 0x73, 0x42, 0xe3, 0x3a, 0x7e, 0xe4, 0xa5,
+  0x2c, 0xc3, 0xac, 0x02, 0xd6, 0xef, 0xd7, 0xce, 0x55, 0xb7, 0x2e, 0x17,
+  0x06, 0x9a, 0x6d, 0xc0, 0x54, 0xb0, 0xf1, 0xb3, 0xdd, 0x24, 0x55, 0x6b,
+  0xe4, 0xb0, 0x99, 0x2c, 0x3b, 0x9c, 0x76, 0x70, 0x75, 0xc5, 0x81, 0x80,
+  0xa5, 0x46, 0x80, 0x8a, 0x01, 0x91, 0x32, 0xf0, 0x4e, 0x71, 0x83, 0x33,
+  0xd1, 0x4f, 0xb2, 0x45, 0x26, 0xa4, 0xdd, 0xf6, 0x58, 0x43, 0xd2, 0x05,
+  0x4c, 0x65, 0x71, 0x1c, 0xc1, 0xae, 0x96, 0xcb, 0xc0, 0x4d, 0xbf, 0x2b,
+  0x2a, 0x89, 0x10, 0xf7, 0x4c, 0xa5, 0x60, 0x2c, 0xfd, 0x23, 0x2e, 0x89,
+  0x0f, 0x52, 0x05, 0x67, 0x89, 0x08, 0xf6, 0x12, 0xb8, 0x4d, 0x9d, 0xb1,
+  0x5c, 0xa4, 0xc1, 0x84, 0x2a, 0xa7, 0x1f, 0xce, 0x77, 0x11, 0x64, 0x58,
+  0x27, 0xa1, 0x40, 0x8e, 0xf8, 0x1c, 0xef, 0xcb, 0xa3, 0xae, 0xd1, 0x47,
+  0x00, 0xbe, 0xe8, 0xf6, 0x33, 0xa0, 0x12, 0x7e, 0x50, 0x95, 0xc1, 0xe3,
+  0x4e, 0x8f, 0x71, 0x79, 0xe3, 0x0f, 0x33, 0xa2, 0x07, 0x87, 0xe6, 0x98,
+  0xbe, 0x86, 0xab, 0xa2, 0x0a, 0x93, 0x9e, 0xd8, 0xfb, 0xba, 0x5a, 0xb7,
+  0x6b, 0xfd, 0xe5, 0x09, 0x56, 0x68, 0xdd, 0x8c, 0xfe, 0x17, 0xc4, 0x30,
+  0xdc, 0xfe, 0xc3, 0x22, 0x82, 0x7a, 0x82, 0x52, 0x2b, 0x07, 0x85, 0xdf,
+  0x56, 0x8d, 0x94, 0xcc, 0x65, 0x93, 0xe3, 0xce, 0x1f, 0x4d, 0x78, 0xcf,
+  0xf2, 0xfe, 0xce, 0xd2, 0xb5, 0x92, 0xf6, 0x57, 0xc3, 0x34, 0x30, 0x7f,
+  0x23, 0x30, 0x1a, 0x4b, 0xa4, 0x43, 0x84, 0xae, 0x31, 0x84, 0xaa, 0xb5,
+  0xa5, 0xa5, 0xb0, 0xd4, 0x5f, 0x18, 0xc2, 0x94, 0x87, 0x73, 0xeb, 0x32,
+  0xdc, 0xaf, 0x5e, 0xcd, 0x1d, 0xab, 0x78, 0x92, 0xae, 0x3f, 0xa0, 0xb7,
+  0xe6, 0x33, 0x7b, 0x21, 0x91, 0x3b, 0xce, 0x13, 0xfe, 0x8b, 0x97, 0x68,
+  0x77, 0x63, 0xb7, 0xd7, 0xb1, 0x0d, 0x36, 0x82, 0x5a, 0x0c, 0x27, 0x78,
+  0x20, 0x51, 0xe1, 0x48, 0x8e, 0x55, 0x97, 0xa6, 0x06, 0xc1, 0xe3, 0x7a,
+  0x41, 0xcf, 0x84, 0xbf, 0x74, 0x2b, 0x5a, 0xc6, 0x5d, 0xae, 0x7d, 0x5e,
+  0xd4, 0xb6, 0xcf, 0x76, 0xa2, 0xff, 0x00, 0x10, 0x28, 0x1a, 0x5a, 0x51,
+  0xfe, 0xeb, 0x5e, 0xb4, 0xfc, 0xb3, 0xb6, 0x7a, 0x41, 0xa4, 0xa3, 0x0b,
+  0x1e, 0xcd, 0x8a, 0x13, 0x1b, 0x00, 0xb1, 0xb9, 0x9f, 0xa4, 0x6a, 0x20,
+  0x4a, 0x2c, 0x52, 0x6c, 0xae, 0x7f, 0x57, 0xf1, 0x8d, 0x50, 0x9b, 0x7f,
+  0x8d, 0x6e, 0xc0, 0x4f, 0x05, 0x28, 0x12, 0x59, 0x43, 0xc8, 0xb6, 0x04,
+  0x3b, 0x3b, 0x29, 0x82, 0x3d, 0x37, 0x69, 0x6f, 0x1a, 0xf9, 0x71, 0x4c,
+  0x5f, 0xba, 0xc4, 0x5e, 0xa3, 0xa6, 0x83, 0x6b, 0x0e, 0x67, 0xbc, 0xcb,
+  0x82, 0x8b, 0xaf, 0xa0, 0x87, 0x66, 0x78, 0xf4, 0x54, 0x3f, 0xa1, 0xa0,
+  0x54, 0x7a, 0xf5, 0xb3, 0x2d, 0x6f, 0xf0, 0x42, 0x49, 0x0c, 0xd6, 0x9e,
+  0x7b, 0x72, 0x53, 0x2b, 0x35, 0x94, 0x74, 0xc5, 0x51, 0xdb, 0x2e, 0x79,
+  0xc0, 0xf4, 0xa5, 0x84, 0xc7, 0x56, 0x55, 0x36, 0xa7, 0x00, 0x03, 0xbc,
+  0x28, 0x2f, 0x6c, 0x87, 0xf9, 0xb9, 0xa5, 0x81, 0xde, 0xc9, 0xcf, 0x90,
+  0x3f, 0x43, 0x99, 0x34, 0x29, 0x70, 0x4b, 0xf0, 0xe0, 0xd1, 0xfa, 0xf1,
+  0xe5, 0x65, 0x8d, 0xf2, 0x45, 0x2d, 0xd2, 0x05, 0x62, 0x2a, 0x86, 0xc6,
+  0x86, 0xfe, 0x32, 0x4d, 0xc1, 0xb3, 0xe7, 0x23, 0x85, 0xa2, 0xf9, 0x1d,
+  0x1d, 0x80, 0xcf, 0x0a, 0x68, 0x35, 0xa6, 0x28, 0x4f, 0xb9, 0xd5, 0xdd,
+  0xd5, 0x34, 0xf0, 0xb3, 0xcf, 0x56, 0x3e, 0x4f, 0xd8, 0x9d, 0x8b, 0x2f,
+  0x0e, 0xee, 0xb9, 0xe2, 0xeb, 0x37, 0x41, 0xd2, 0x6e, 0x62, 0xa3, 0x6c,
+  0xab, 0xa7, 0x20, 0xed, 0x23, 0xa2, 0xc4, 0x70, 0x90, 0x09, 0x25, 0x1b,
+  0xb3, 0xcd, 0x84, 0x2d, 0xf1, 0x2d, 0xbe, 0xeb, 0x61, 0x71, 0xe6, 0x0f,
+  0x70, 0x90, 0x26, 0xce, 0xb8, 0xaf, 0xd9, 0xac, 0xa4, 0x76, 0x52, 0xdb,
+  0x33, 0x5d, 0x88, 0xc5, 0x26, 0x5f, 0xf0, 0xbb, 0xbe, 0x68, 0x22, 0x85,
+  0xcd, 0xf1, 0x5c, 0xf5, 0xba, 0x38, 0x72, 0x84, 0x30, 0xfe, 0x8a, 0x7e,
+  0x50, 0x68, 0x22, 0x49, 0x22, 0x4c, 0x00, 0x04, 0xdc, 0x69, 0x25, 0x66,
+  0x80, 0xb9, 0x66, 0xf3, 0x9c, 0xc2, 0x1c, 0xd2, 0x75, 0x60, 0x35, 0xeb,
+  0x9f, 0xba, 0xb7, 0x46, 0x3c, 0x27, 0xcd, 0xed, 0xed, 0x2e, 0x94, 0x9c,
+  0xed, 0xab, 0x18, 0x06, 0x71, 0x9b, 0x62, 0x5e, 0x12, 0x53, 0x80, 0xd4,
+  0xf6, 0x8d, 0x01, 0xbe, 0xde, 0xfb, 0x4c, 0x47, 0xd3, 0x14, 0xa7, 0x2b,
+  0x83, 0x91, 0x47, 0xc3, 0x85, 0xb5, 0x54, 0xcd, 0xc0, 0x83, 0x09, 0xe7,
+  0x3b, 0x55, 0xf6, 0x27, 0x66, 0x6e, 0x90, 0x87, 0x24, 0xd2, 0x57, 0xda,
+  0x8b, 0x87, 0xd5, 0xee, 0x9e, 0x28, 0x20, 0xb5, 0x7e, 0x6d, 0x19, 0xb0,
+  0x2e, 0x3f, 0x53, 0xdd, 0x07, 0x98, 0xcb, 0xde, 0xb8, 0x85, 0xee, 0xc6,
+  0x5a, 0xb2, 0xb1, 0xfc, 0xd5, 0xd7, 0x69, 0x52, 0x12, 0x95, 0xcb, 0x7b,
+  0x52, 0x1f, 0xe7, 0x0c, 0xea, 0x96, 0x6b, 0x9d, 0xae, 0xe5, 0xbb, 0x75,
+  0x35, 0xea, 0x02, 0x55, 0xa9, 0xd1, 0x44, 0x5b, 0x7d, 0x8b, 0xe6, 0x32,
+  0x90, 0xd0, 0x6d, 0xd4, 0x56, 0x5d, 0x33, 0x39, 0xab, 0xbe, 0xfc, 0xc2,
+  0xd5, 0x1c, 0x4b, 0xfb, 0x82, 0x6d, 0xdf, 0x5d, 0xf8, 0x7c, 0xcc, 0xe3,
+  0x09, 0xc7, 0xd2, 0xcf, 0x41, 0x7e, 0x3d, 0x4b, 0xa5, 0xc2, 0x0d, 0x62,
+  0xc2, 0x18, 0x20, 0x56, 0x5c, 0x21, 0xd0, 0x05, 0xb4, 0xc2, 0xd9, 0x5e,
+  0xb8, 0x6c, 0x45, 0x6c, 0xfd, 0x7a, 0x99, 0x60, 0x56, 0xb8, 0x3e, 0xaa,
+  0x3f, 0x18, 0x4c, 0x7b, 0x1e, 0x5c, 0x2d, 0x91, 0xf2, 0x9b, 0xd4, 0x9c,
+  0xc7, 0xa9, 0xd5, 0xd7, 0xc9, 0x54, 0x77, 0x71, 0xa0, 0xd7, 0xd1, 0x40,
+  0xa8, 0xec, 0x59, 0xa0, 0x16, 0x88, 0xd6, 0x49, 0x25, 0xd6, 0x7b, 0x57,
+  0xbf, 0xdb, 0xe4, 0x1c, 0x68, 0xbc, 0x6b, 0xa0, 0xdc, 0x66, 0x29, 0xa1,
+  0x36, 0x51, 0x90, 0x53, 0x78, 0xbf, 0xd7, 0xa2, 0x81, 0x62, 0x8b, 0x4b,
+  0xd6, 0x97, 0x90, 0x86, 0xd4, 0xc6, 0xcb, 0xe9, 0xac, 0xb7, 0xdd, 0x4a,
+  0x78, 0x7d, 0x82, 0x6f, 0x95, 0xc9, 0x67, 0x74, 0x14, 0xa7, 0x71, 0xe2,
+  0x5c, 0xaa, 0x3e, 0xae, 0x99, 0x41, 0xa9, 0x2a, 0xd0, 0x5e, 0x83, 0x5a,
+  0x41, 0x68, 0x8c, 0x70, 0x74, 0x91, 0xc0, 0xac, 0x82, 0x6d, 0x8e, 0xfe,
+  0x99, 0x4b, 0x5a, 0x39, 0x83, 0xd4, 0x0f, 0xb5, 0x6a, 0x22, 0xa7, 0x5a,
+  0xa0, 0x49, 0xdf, 0x9b, 0xff, 0x6e, 0xae, 0x6e, 0x60, 0xe0, 0xeb, 0xf2,
+  0xb1, 0x3f, 0x0c, 0x5d, 0x76, 0x3f, 0x4f, 0xe7, 0x57, 0xae, 0x19, 0x57,
+  0x61, 0x20, 0xb2, 0x70, 0x65, 0xb6, 0x2c, 0x5e, 0x1d, 0x37, 0x87, 0xb4,
+  0xea, 0xb6, 0xf1, 0x09, 0xbe, 0x85, 0x04, 0xab, 0xb9, 0x1d, 0xc9, 0xe8,
+  0xf2, 0xe1, 0xd5, 0xae, 0x68, 0x86, 0x2d, 0xfc, 0x74, 0xa0, 0x90, 0xc1,
+  0x1c, 0x7e, 0xdf, 0x3e, 0x64, 0x15, 0xc8, 0x94, 0x74, 0xa3, 0x39, 0x37,
+  0xf0, 0x66, 0xd4, 0xa3, 0x78, 0x3c, 0x4a, 0x95, 0x79, 0xac, 0x2b, 0xe1,
+  0x67, 0xfc, 0x74, 0xaa, 0x51, 0x27, 0xc7, 0x9f, 0xe8, 0xe3, 0x8e, 0x54,
+  0x3c, 0x73, 0x1c, 0x6f, 0x06, 0x25, 0x7e, 0x0b, 0x38, 0xbb, 0xa1, 0xd3,
+  0xfa, 0x8d, 0x92, 0x35, 0x01, 0xa2, 0x96, 0x97, 0xda, 0x15, 0xd5, 0x41,
+  0x86, 0x80, 0x82, 0x08, 0x40, 0xec, 0x9b, 0x55, 0xc6, 0xfd, 0x7f, 0xed,
+  0x59, 0x42, 0x98, 0x38, 0x86, 0x41, 0x79, 0xf2, 0x85, 0xe4, 0xb1, 0x44,
+  0x7d, 0xf8, 0xaa, 0x66, 0x44, 0xda, 0xfb, 0x74, 0x9a, 0xa8, 0x20, 0x44,
+  0xaf, 0x1d, 0x63, 0xbc, 0xae, 0x61, 0xfc, 0xd5, 0xe1, 0x58, 0x73, 0xec,
+  0xb2, 0x47, 0xa9, 0x30, 0x8e, 0x57, 0xd2, 0x26, 0xf3, 0xd4, 0x6b, 0x68,
+  0x69, 0xfa, 0x89, 0x3b, 0xcd, 0x54, 0x64, 0x1f, 0x82, 0x6b, 0x6d, 0xa1,
+  0x1f, 0x71, 0xdf, 0xff, 0x98, 0xd0, 0xa3, 0xeb, 0x9b, 0x60, 0x26, 0x2d,
+  0x2c, 0x18, 0x19, 0xab, 0x9f, 0xb3, 0xd6, 0xe7, 0x9d, 0x17, 0xe3, 0xd2,
+  0xb4, 0x0b, 0x69, 0x15, 0x6a, 0xe0, 0xeb, 0xdf, 0xa0, 0xe1, 0x2a, 0x75,
+  0xff, 0xc0, 0x4e, 0xb2, 0xab, 0x7d, 0x70, 0x61, 0xef, 0x58, 0xec, 0x32,
+  0x01, 0xa5, 0x05, 0x8d, 0xb5, 0x48, 0x29, 0xa6, 0x79, 0x49, 0xa9, 0x25,
+  0x81, 0x64, 0x4c, 0x7c, 0x25, 0x9c, 0x98, 0x1b, 0xe6, 0x03, 0x05, 0xb0,
+  0x2f, 0xbc, 0x7e, 0x24, 0xa8, 0x0c, 0xc8, 0x80, 0xe3, 0xbe, 0xf3, 0x5a,
+  0xcf, 0xb8, 0x00, 0x0d, 0x66, 0x4d, 0x0f, 0xb3, 0x45, 0x07, 0x0c, 0xac,
+  0xc3, 0xc3, 0xc2, 0x38, 0x8c, 0x23, 0x87, 0xbf, 0xc5, 0x41, 0xb9, 0x57,
+  0xc4, 0xf9, 0x01, 0x64, 0xc8, 0x1b, 0x1d, 0x8e, 0xea, 0x25, 0x98, 0xa1,
+  0xfc, 0xda, 0x4b, 0xe6, 0xc4, 0xb0, 0x82, 0x1f, 0xff, 0xda, 0x4e, 0x33,
+  0x58, 0x00, 0x14, 0xc0, 0x34, 0x78, 0x08, 0x39, 0xdb, 0x84, 0xd5, 0x1a,
+  0x98, 0xd8, 0x56, 0xb9, 0x4f, 0xf3, 0xd1, 0x5a, 0xb0, 0xea, 0x05, 0x4f,
+  0xc4, 0x12, 0x05, 0xa2, 0x1a, 0x51, 0xf0, 0x00, 0x08, 0xbe, 0xf9, 0xa0,
+  0x8a, 0xe2, 0x00, 0xe5, 0xac, 0xda, 0x6e, 0x22, 0xea, 0xfa, 0xb8, 0x07,
+  0xb7, 0xac, 0x94, 0xe7, 0x47, 0x60, 0x23, 0xb9, 0x2d, 0xb9, 0x96, 0xaa,
+  0x5c, 0x29, 0x13, 0xa7, 0xd0, 0xaa, 0x07, 0x3f, 0x75, 0x0f, 0x5e, 0xda,
+  0xa1, 0x1c, 0xbd, 0x4b, 0x02, 0xa5, 0x97, 0xf3, 0x07, 0xd0, 0xf3, 0x07,
+  0xb0, 0x5b, 0xa6, 0x0b, 0xe2, 0x98, 0x7e, 0x7d, 0x29, 0x50, 0x40, 0x41,
+  0x66, 0xdf, 0xf7, 0x79, 0x19, 0x8f, 0x07, 0xcf, 0x95, 0xb3, 0x9b, 0x53,
+  0x1f, 0xb0, 0x75, 0x0e, 0xaf, 0x4b, 0x04, 0xb6, 0x3c, 0x74, 0x08, 0x4f,
+  0x26, 0xa2, 0x33, 0x12, 0xe6, 0x76, 0x94, 0x26, 0xda, 0x45, 0x75, 0x16,
+  0x76, 0x9b, 0x64, 0xaa, 0xd8, 0x42, 0xca, 0x93, 0x97, 0x5c, 0x06, 0x10,
+  0x2d, 0xb9, 0x64, 0x8b, 0x8b, 0x02, 0xf5, 0x03, 0xf1, 0x30, 0x96, 0xae,
+  0x9d, 0x26, 0x14, 0x89, 0x5a, 0x72, 0x7e, 0x64, 0xeb, 0x27, 0x4e, 0xb4,
+  0x0e, 0xa3, 0xab, 0x35, 0xef, 0xca, 0x55, 0xff, 0xfd, 0x80, 0x97, 0xeb,
+  0xf3, 0x38, 0x1a, 0xe0, 0x7f, 0x0e, 0xd0, 0xe6, 0x5b, 0xce, 0x3a, 0x4a,
+  0xd3, 0xf4, 0xe7, 0x39, 0xad, 0xab, 0x3d, 0xd1, 0x36, 0x69, 0x95, 0xe5,
+  0xad, 0xde, 0xb2, 0x66, 0x63, 0x0b, 0x76, 0xe9, 0xa9, 0xfc, 0x03, 0x5f,
+  0xaf, 0x94, 0xd7, 0x41, 0x08, 0x9a, 0x4a, 0xac, 0x29, 0xca, 0x06, 0x5a,
+  0x4f, 0x2c, 0x84, 0xf7, 0xd5, 0x0d, 0xcc, 0xf9, 0x53, 0x31, 0x37, 0xc7,
+  0xd7, 0x09, 0x6d, 0x0a, 0x8e, 0x82, 0x6a, 0x1c, 0xfe, 0xbf, 0x32, 0x96,
+  0xc7, 0x1a, 0x90, 0xd8, 0xa6, 0xa3, 0x3c, 0x89, 0xd8, 0x68, 0xb0, 0xff,
+  0x1e, 0x65, 0x47, 0x08, 0xb5, 0xb7, 0xa7, 0x7b, 0xd6, 0xc2, 0xab, 0x6c,
+  0x3d, 0x97, 0x44, 0xf9, 0xce, 0x3a, 0xd9, 0x9e, 0x2c, 0x8f, 0x49, 0x5f,
+  0x39, 0x5a, 0xca, 0xa8, 0x19, 0x1d, 0xfd, 0xaf, 0x00, 0xf2, 0xa7, 0xde,
+  0x09, 0xdf, 0x2d, 0xd2, 0xaf, 0x7b, 0x17, 0x80, 0x8d, 0xd2, 0xa9, 0xa9,
+  0x8a, 0x68, 0x7a, 0x69, 0xf6, 0xcb, 0xf8, 0xb3, 0x1d, 0x16, 0xce, 0x0b,
+  0xa6, 0x15, 0x6f, 0xc9, 0x4c, 0xa8, 0xe7, 0xb2, 0xb8, 0xc1, 0x7f, 0x0d,
+  0x9f, 0x7d, 0x83, 0x2e, 0x26, 0x2a, 0x84, 0x25, 0x94, 0x87, 0x99, 0x21,
+  0xe6, 0xf3, 0x98, 0x7b, 0xa4, 0x5f, 0xae, 0xe3, 0xc5, 0x20, 0xe7, 0x41,
+  0x8d, 0xad, 0x7f, 0xb7, 0x4a, 0x32, 0xb4, 0x73, 0x54, 0x95, 0x62, 0x4c,
+  0xb2, 0xab, 0xa3, 0x54, 0xd2, 0x80, 0x6a, 0xb6, 0xe4, 0x6c, 0xb5, 0xd4,
+  0x8b, 0x27, 0xbe, 0xa4, 0x9c, 0x7c, 0xec, 0x10, 0x89, 0x44, 0xa2, 0x49,
+  0xd5, 0x36, 0x3d, 0x41, 0xb3, 0xb5, 0xc0, 0xdf, 0x13, 0xb0, 0x68, 0x2b,
+  0xaf, 0xd2, 0x6b, 0xa3, 0xe3, 0xf7, 0xcc, 0xb1, 0xfb, 0x09, 0x99, 0x82,
+  0xd5, 0xc9, 0xda, 0xf3, 0x8e, 0xdd, 0x70, 0x92, 0x71, 0x2b, 0xab, 0x97,
+  0xed, 0xd1, 0x20, 0x31, 0xd6, 0xbc, 0x07, 0x4b, 0x03, 0xf4, 0x9a, 0xc1,
+  0xbc, 0xf0, 0x5f, 0x30, 0xa0, 0x05, 0x1b, 0xd5, 0xa9, 0xcb, 0xe4, 0xbf,
+  0x3d, 0x77, 0xc9, 0x9a, 0xf4, 0xef, 0xf0, 0xdc, 0xa8, 0xbd, 0xa4, 0x18,
+  0xd2, 0x2b, 0x63, 0x00, 0x43, 0xfc, 0xc0, 0x2c, 0x9b, 0xa7, 0x5a, 0x39,
+  0x8d, 0xfb, 0x9c, 0xc7, 0x4a, 0x02, 0xff, 0x5a, 0x93, 0xb5, 0x2a, 0x3e,
+  0xb4, 0x88, 0xbe, 0x8f, 0x0f, 0x7e, 0xfb, 0xff, 0x3c, 0x36, 0x3d, 0x6d,
+  0x47, 0xb6, 0xe5, 0xf8, 0x98, 0x19, 0x1a, 0xa4, 0x7c, 0x29, 0x26, 0x88,
+  0xb9, 0xfa, 0x7e, 0x32, 0xc6, 0x0f, 0xd4, 0xc2, 0xce, 0xce, 0xe6, 0x6c,
+  0x35, 0x65, 0x9a, 0x88, 0x0e, 0x92, 0xfe, 0x61, 0xad, 0x28, 0xe3, 0x17,
+  0xf9, 0x15, 0x97, 0xd3, 0xc1, 0xfe, 0x29, 0x2e, 0xaa, 0x67, 0xe6, 0x98,
+  0xd6, 0xe4, 0x53, 0x25, 0xb1, 0x19, 0xad, 0x14, 0xee, 0x58, 0x7c, 0x45,
+  0x69, 0xde, 0x38, 0x68, 0xd1, 0x7f, 0xc7, 0xd4, 0x9e, 0xa8, 0x2f, 0x47,
+  0x66, 0xa8, 0x57, 0x9b, 0xf0, 0xc9, 0x90, 0xe5, 0x68, 0x19, 0xd9, 0xe0,
+  0xb5, 0xbb, 0xa4, 0x57, 0xf4, 0x3b, 0xa0, 0x9d, 0x20, 0xd5, 0x8f, 0x5a,
+  0x7b, 0x48, 0x26, 0x29, 0xd7, 0xbf, 0xdd, 0xbd, 0x88, 0xc8, 0x77, 0x17,
+  0x3d, 0x4c, 0xbb, 0xce, 0x88, 0x7a, 0x52, 0x94, 0x7a, 0x00, 0x5c, 0x8f,
+  0x34, 0x50, 0x3c, 0x50, 0x3f, 0x69, 0x50, 0x11, 0xcd, 0xef, 0x05, 0xd4,
+  0xdd, 0x2c, 0xb7, 0x24, 0x98, 0xad, 0x47, 0x07, 0x60, 0x39, 0xbc, 0xc8,
+  0x6e, 0xf7, 0xdf, 0xe7, 0x47, 0xc9, 0xaf, 0xb1, 0xba, 0xb6, 0x7c, 0xda,
+  0x77, 0xcb, 0xb6, 0x62, 0x83, 0x5b, 0xc3, 0x96, 0x87, 0xd3, 0xb1, 0xb9,
+  0xbb, 0xa3, 0x0e, 0xdb, 0x3e, 0x7e, 0x9f, 0x1c, 0x37, 0x6a, 0x5b, 0x61,
+  0xe6, 0x25, 0xa3, 0xdd, 0x08, 0x75, 0x0e, 0xdf, 0x48, 0xc2, 0x82, 0x8a,
+  0x46, 0x2c, 0x69, 0x07, 0xea, 0xb8, 0xa9, 0x55, 0x79, 0x5d, 0x15, 0x85,
+  0xf7, 0x3f, 0x06, 0xe7, 0xb0, 0x87, 0x4d, 0x28, 0x59, 0x25, 0x81, 0xf1,
+  0x64, 0x79, 0x5b, 0xb6, 0xd9, 0x9d, 0x55, 0x46, 0xd2, 0x8f, 0x7f, 0xaf,
+  0x9a, 0x6d, 0x23, 0x13, 0x99, 0x56, 0xea, 0x5d, 0xcd, 0x1a, 0x0f, 0x9c,
+  0xcc, 0xcc, 0xf3, 0xf2, 0x4c, 0x1f, 0xd9, 0xb0, 0x1b, 0xad, 0x5a, 0xe4,
+  0x2f, 0x0e, 0x61, 0xb5, 0xb4, 0x12, 0x90, 0xf2, 0x7e, 0xfe, 0x76, 0x6a,
+  0x25, 0xab, 0xc7, 0x53, 0x59, 0xd4, 0x9b, 0x96, 0x8f, 0x8b, 0x3f, 0xbb,
+  0x94, 0xc2, 0x90, 0x12, 0x78, 0x84, 0x9b, 0x02, 0x7c, 0xbc, 0x3f, 0x9d,
+  0x66, 0x1e, 0x5c, 0x9a, 0x14, 0x49, 0xfe, 0x36, 0x4a, 0xbe, 0x23, 0x65,
+  0x42, 0x0b, 0x88, 0xa4, 0x2a, 0x69, 0xff, 0x9d, 0x99, 0xe5, 0xbd, 0xd7,
+  0xa3, 0x36, 0x47, 0xf9, 0x50, 0xa5, 0x3b, 0x67, 0xec, 0x06, 0x4f, 0xdf,
+  0x49, 0xf0, 0x65, 0x23, 0xa9, 0x5a, 0xc1, 0xca, 0x11, 0x76, 0xde, 0x82,
+  0xf6, 0x75, 0xd6, 0xef, 0xe1, 0x5b, 0x90, 0x13, 0x46, 0x3d, 0xd4, 0x50,
+  0x0c, 0xbc, 0x72, 0xf3, 0x0e, 0x8e, 0xa0, 0x38, 0xf2, 0x60, 0x58, 0x7f,
+  0x61, 0xda, 0x5f, 0xa0, 0xdc, 0x31, 0x42, 0xa5, 0x83, 0x0c, 0xfb, 0x7f,
+  0x84, 0x73, 0x04, 0x68, 0x1b, 0x93, 0xc6, 0xa7, 0xaa, 0x2a, 0x65, 0xe7,
+  0x67, 0x5d, 0x8d, 0x92, 0x21, 0xe1, 0xf8, 0x45, 0x68, 0xfc, 0x20, 0x35,
+  0xcd, 0xb7, 0x46, 0x9f, 0xad, 0xfd, 0x44, 0x3f, 0x10, 0xb8, 0xef, 0x62,
+  0x0f, 0xeb, 0xd9, 0x8a, 0x8c, 0x1f, 0x3e, 0x6b, 0x85, 0xd0, 0x01, 0x5d,
+  0x74, 0x61, 0x60, 0xd8, 0xc0, 0x23, 0xf2, 0xa1, 0xf8, 0x5e, 0x24, 0xf1,
+  0xc3, 0xb5, 0xd6, 0x35, 0x9e, 0x7d, 0xfa, 0x40, 0x63, 0xf2, 0xce, 0xc3,
+  0x28, 0x6e, 0xb6, 0x0a, 0x2c, 0x8a, 0x77, 0x94, 0x20, 0x74, 0xaf, 0x69,
+  0x4f, 0x38, 0x0d, 0xc9, 0x6b, 0x48, 0xf1, 0x76, 0x4a, 0xac, 0xa6, 0x02,
+  0xec, 0x0a, 0x17, 0x0f, 0x78, 0x05, 0x5a, 0x5e, 0xd8, 0x46, 0xa9, 0x2e,
+  0xe3, 0xf8, 0x6f, 0xd1, 0xa4, 0x03, 0xc2, 0x1b, 0xd6, 0x1e, 0x49, 0x78,
+  0x27, 0x84, 0x4c, 0xb1, 0x98, 0xc2, 0x77, 0x23, 0x60, 0xae, 0x6a, 0x46,
+  0xdf, 0x44, 0x69, 0x0b, 0x29, 0x07, 0x9f, 0xb9, 0x99, 0x40, 0x0c, 0x3f,
+  0x94, 0x3e, 0x5e, 0xf1, 0xf4, 0x4a, 0xd5, 0x15, 0x8e, 0x1f, 0x69, 0x66,
+  0x21, 0xbd, 0xfc, 0x3a, 0x07, 0x10, 0xb4, 0x1c, 0x75, 0x3e, 0x30, 0x9d,
+  0xcf, 0xe3, 0x75, 0x62, 0xeb, 0x16, 0x3a, 0x04, 0x87, 0x78, 0x1a, 0x82,
+  0x04, 0x4c, 0x8f, 0xb5, 0x2e, 0xfb, 0x7b, 0xb7, 0x31, 0xd1, 0x96, 0xce,
+  0x94, 0x8e, 0x51, 0x21, 0x8f, 0xcf, 0x5d, 0xab, 0x77, 0xff, 0x08, 0x0a,
+  0x15, 0x3f, 0x19, 0x0d, 0xf4, 0xa1, 0xfa, 0x17, 0x05, 0x03, 0x49, 0x9b,
+  0x72, 0x72, 0xcf, 0x2e, 0x03, 0xed, 0x5d, 0x1b, 0x70, 0x22, 0xdd, 0x64,
+  0xad, 0xe9, 0x63, 0x9e, 0x12, 0x1a, 0xd2, 0x55, 0x7d, 0x28, 0x87, 0x50,
+  0x13, 0xba, 0x12, 0xd3, 0x76, 0x71, 0x29, 0x19, 0xa1, 0xd2, 0x02, 0x19,
+  0x97, 0x8d, 0x11, 0xd5, 0x51, 0x40, 0x60, 0x0f, 0x13, 0xa5, 0xe0, 0x30,
+  0x63, 0x04, 0x7a, 0x81, 0x0a, 0xa9, 0x80, 0x00, 0xb7, 0x1d, 0xfb, 0x96,
+  0x4c, 0x2e, 0xb4, 0xc9, 0x21, 0x2b, 0x3f, 0x21, 0xbe, 0xd0, 0x48, 0xad,
+  0x1e, 0x14, 0x3c, 0x3e, 0xe8, 0x03, 0xa4, 0x77, 0x49, 0xd0, 0x09, 0xe7,
+  0xc2, 0x3b, 0x5c, 0xa8, 0x68, 0x31, 0xf5, 0x03, 0xf0, 0x18, 0xde, 0x05,
+  0x80, 0x01, 0x15, 0x7b, 0xda, 0x1a, 0x0a, 0xb4, 0xfa, 0x2d, 0x6d, 0x8b,
+  0x63, 0x2a, 0x43, 0xe6, 0x0b, 0xf0, 0x82, 0x2f, 0x79, 0x42, 0x74, 0xe0,
+  0xce, 0x21, 0x54, 0x3e, 0x17, 0x62, 0x89, 0xc4, 0x78, 0xc4, 0xfd, 0xd3,
+  0xe5, 0x70, 0x49, 0x54, 0x86, 0xf9, 0x81, 0xcb, 0x79, 0x38, 0x38, 0x63,
+  0x0d, 0x84, 0x32, 0xad, 0x6c, 0xe4, 0xe8, 0xb7, 0x78, 0x32, 0xbd, 0xd2,
+  0xfe, 0x8e, 0x2b, 0xf2, 0xe4, 0xa4, 0xe6, 0xfe, 0x14, 0xac, 0x23, 0x4a,
+  0xf9, 0x73, 0x53, 0xfb, 0xeb, 0x52, 0x41, 0xa2, 0xc0, 0x33, 0xdd, 0xec,
+  0x1d, 0xf6, 0x0b, 0x9a, 0xe0, 0xd1, 0x78, 0x8c, 0x31, 0xa0, 0x9d, 0x1d,
+  0x58, 0x4e, 0x58, 0x09, 0x59, 0xa0, 0x31, 0x1e, 0x69, 0x4a, 0x60, 0xe6,
+  0x32, 0x80, 0x59, 0x6b, 0x3e, 0x46, 0x03, 0x85, 0xa3, 0xea, 0x99, 0xfe,
+  0x0c, 0xdb, 0x3a, 0x1e, 0x20, 0xc7, 0xf8, 0xb6, 0xd5, 0x8f, 0xcf, 0x5c,
+  0x30, 0x46, 0xbe, 0x7d, 0x2e, 0xce, 0x17, 0xd5, 0xdb, 0x93, 0x3e, 0xd4,
+  0x4d, 0x03, 0xf4, 0x49, 0x61, 0x4e, 0xfb, 0x92, 0xdb, 0x02, 0xde, 0xee,
+  0xbc, 0x8e, 0x4b, 0xd3, 0xc0, 0x5e, 0x60, 0xd7, 0xc3, 0x63, 0xb0, 0x80,
+  0xc7, 0x17, 0xdd, 0x68, 0x3e, 0x05, 0x49, 0xdb, 0xab, 0x4f, 0x9c, 0xe9,
+  0xdc, 0xda, 0xa6, 0x93, 0x1b, 0x6c, 0x05, 0xfc, 0x53, 0x70, 0xe0, 0xb7,
+  0xb6, 0xe2, 0x7f, 0x1a, 0xa9, 0x5b, 0xe6, 0xfe, 0x4e, 0x8b, 0x7e, 0xb1,
+  0xa7, 0x12, 0x00, 0x8e, 0x89, 0x22, 0x25, 0x70, 0xe2, 0x80, 0x5d, 0xf9,
+  0x8d, 0x6a, 0x6d, 0x02, 0x2c, 0x8a, 0x97, 0xa7, 0x35, 0xc4, 0x9d, 0xf9,
+  0x77, 0xae, 0x94, 0x1d, 0xb0, 0xbf, 0x6f, 0x25, 0x17, 0x1d, 0x12, 0x09,
+  0x32, 0x54, 0xe1, 0x0b, 0x7f, 0xd8, 0xd9, 0xb8, 0xd3, 0xbf, 0xf1, 0x65,
+  0xd5, 0x79, 0x0e, 0x55, 0x9b, 0x7c, 0x6f, 0xef, 0x03, 0xfd, 0xc6, 0x81,
+  0xf0, 0xfc, 0x39, 0xba, 0x3f, 0x78, 0x60, 0x30, 0x18, 0xa5, 0x49, 0x27,
+  0xdb, 0xd2, 0x9e, 0xde, 0xe7, 0x7b, 0x01, 0x00, 0x3b, 0x79, 0x84, 0xf8,
+  0xbc, 0x89, 0x44, 0x6e, 0x62, 0xe0, 0x5a, 0x14, 0xd6, 0x0f, 0xb5, 0xe9,
+  0x4f, 0xac, 0x3a, 0x0e, 0x61, 0xfd, 0x31, 0x7b, 0x8f, 0xef, 0xb4, 0xa5,
+  0x63, 0x70, 0xad, 0x74, 0x9f, 0xa5, 0x90, 0xa3, 0x0e, 0x5a, 0x4e, 0x4d,
+  0xb3, 0xcc, 0x77, 0xe5, 0x78, 0x08, 0xce, 0xb9, 0x7f, 0xd1, 0x6f, 0x88,
+  0x70, 0x6a, 0xfb, 0x8e, 0xf6, 0x2f, 0xf4, 0x32, 0x26, 0x5a, 0x33, 0x9b,
+  0x2a, 0xdc, 0xd2, 0x23, 0xa2, 0x5e, 0xd1, 0x44, 0x02, 0xb6, 0x49, 0x30,
+  0xe6, 0x62, 0xc1, 0x48, 0x7d, 0x97, 0xdc, 0x3b, 0x32, 0x6f, 0x61, 0x69,
+  0xa6, 0x14, 0xce, 0x9d, 0x09, 0x06, 0x2c, 0xea, 0xd3, 0x85, 0xed, 0xd3,
+  0x1f, 0x7f, 0x98, 0x9c, 0x96, 0x49, 0x05, 0x5b, 0xb6, 0x18, 0xd7, 0x58,
+  0xe0, 0x7f, 0xb7, 0x0e, 0xc3, 0x18, 0x02, 0x47, 0xf8, 0xee, 0x9b, 0x0f,
+  0x47, 0x6a, 0x46, 0xff, 0xae, 0xf9, 0xf0, 0x76, 0xae, 0xd1, 0x46, 0xda,
+  0xc9, 0x1f, 0x32, 0xd2, 0x82, 0x37, 0xf5, 0x4f, 0x5b, 0x44, 0x87, 0x54,
+  0xbe, 0x1f, 0x67, 0xea, 0x49, 0xfe, 0x7a, 0x9d, 0xf2, 0xee, 0xa6, 0x48,
+  0x7f, 0xfa, 0x62, 0x76, 0xc3, 0x80, 0xd5, 0x86, 0x2e, 0xa4, 0x85, 0x36,
+  0xd1, 0x5d, 0xd9, 0x44, 0x18, 0x89, 0x9b, 0x91, 0x91, 0xb6, 0x29, 0x3e,
+  0x53, 0x5f, 0x54, 0xcd, 0xe1, 0x29, 0x90, 0x45, 0x51, 0x6c, 0x9d, 0xfb,
+  0x27, 0xb1, 0xaf, 0xb9, 0xca, 0x65, 0xe3, 0xae, 0x83, 0x65, 0xf9, 0xab,
+  0x45, 0x40, 0xe9, 0x99, 0x95, 0x7c, 0x4c, 0xcd, 0xbf, 0x99, 0x09, 0x5a,
+  0x91, 0xc1, 0x01, 0x4c, 0x05, 0xdd, 0x65, 0xf9, 0x94, 0x3e, 0x53, 0x66,
+  0x01, 0xf4, 0x55, 0x8f, 0x7d, 0x77, 0x94, 0x65, 0x4e, 0xfc, 0x65, 0x3a,
+  0xed, 0x2d, 0x38, 0xaf, 0xd8, 0xae, 0xc9, 0x18, 0xf4, 0x49, 0x13, 0xae,
+  0x49, 0x44, 0x44, 0x1a, 0xf4, 0xaa, 0x30, 0x05, 0x2d, 0x8b, 0x78, 0x8b,
+  0x95, 0x73, 0xc3, 0x83, 0x1f, 0x7e, 0x01, 0x8f, 0xd6, 0x67, 0xb8, 0x8f,
+  0x45, 0xa9, 0x68, 0x03, 0x36, 0x1f, 0x73, 0x98, 0xeb, 0xfe, 0xd4, 0xa3,
+  0x0a, 0xa1, 0x5e, 0x65, 0x14, 0x72, 0xab, 0x04, 0x46, 0xb5, 0xea, 0xee,
+  0xbd, 0xa6, 0x26, 0x02, 0x39, 0x15, 0xa9, 0xa4, 0x79, 0xdf, 0xe7, 0xbd,
+  0x00, 0xc0, 0xb5, 0x52, 0xfa, 0x4a, 0x83, 0x7d, 0x65, 0xf9, 0x9c, 0xaa,
+  0xed, 0xe8, 0x0f, 0x70, 0x0d, 0x2a, 0x4c, 0xd8, 0x68, 0xf6, 0x11, 0x10,
+  0x4e, 0xee, 0xa7, 0xaa, 0xd8, 0x9a, 0xbc, 0x06, 0xe9, 0xb1, 0xf9, 0xc0,
+  0x58, 0xcf, 0xce, 0xf2, 0x3f, 0x9b, 0x50, 0xf3, 0xf8, 0x8d, 0x4b, 0x0f,
+  0x9c, 0x4c, 0x42, 0x9b, 0x06, 0x0b, 0x07, 0x69, 0xdf, 0x38, 0x5b, 0x3e,
+  0xf6, 0x71, 0x9f, 0xee, 0xa5, 0x5c, 0xd3, 0x42, 0x4e, 0xec, 0xe5, 0xaf,
+  0x03, 0xef, 0x1d, 0x40, 0x58, 0x48, 0xa2, 0x95, 0xc0, 0x03, 0x97, 0xf5,
+  0x1e, 0xc5, 0xd9, 0x3b, 0xd9, 0xa3, 0xac, 0x07, 0x4b, 0xf9, 0x19, 0x26,
+  0xee, 0xab, 0xb5, 0x64, 0xa2, 0x45, 0xb2, 0xcd, 0x14, 0xfe, 0x5b, 0x3d,
+  0x7b, 0x17, 0xd3, 0x53, 0xf3, 0x2d, 0x3d, 0x33, 0xf1, 0xec, 0xc1, 0x69,
+  0x39, 0x9d, 0xfa, 0x4d, 0xac, 0x79, 0x89, 0xce, 0xcd, 0x34, 0x53, 0x34,
+  0xda, 0xaa, 0x70, 0xb5, 0x1a, 0xb3, 0x7b, 0xba, 0xa2, 0xf3, 0x38, 0x42,
+  0xf5, 0x44, 0x4c, 0x3a, 0x08, 0x77, 0x67, 0xae, 0x7a, 0x6d, 0x0a, 0x8b,
+  0xda, 0xe1, 0xdc, 0x99, 0x0d, 0x23, 0x13, 0x45, 0xc5, 0x12, 0x21, 0xea,
+  0x7f, 0x6f, 0x95, 0xca, 0x56, 0xe3, 0x5d, 0xac, 0xcd, 0xa9, 0x61, 0xc5,
+  0x40, 0xa4, 0x94, 0x17, 0xcd, 0x48, 0x37, 0xd3, 0xfe, 0x32, 0x7f, 0x06,
+  0x83, 0xaf, 0xd4, 0x75, 0xab, 0x04, 0x4e, 0x99, 0xec, 0xa8, 0x7f, 0x78,
+  0x5a, 0x6e, 0x10, 0x4a, 0xe5, 0xce, 0x25, 0x18, 0x41, 0x82, 0xe6, 0x97,
+  0xf6, 0x5b, 0xbb, 0x5f, 0xd9, 0x7a, 0xd4, 0x26, 0x29, 0x86, 0x1d, 0xdf,
+  0x0b, 0x95, 0xb1, 0x3e, 0xbc, 0xa2, 0xad, 0xbc, 0x0b, 0x32, 0x1a, 0x6c,
+  0x97, 0xed, 0x68, 0x61, 0x07, 0xda, 0x7c, 0xf2, 0x3a, 0x24, 0x04, 0x99,
+  0xb3, 0x56, 0x5b, 0xf2, 0x2e, 0xf3, 0x2e, 0x9e, 0x06, 0xec, 0x6f, 0x73,
+  0x15, 0xbe, 0xf4, 0xee, 0x08, 0xdf, 0xb6, 0xd7, 0xb0, 0xb6, 0x9c, 0x73,
+  0xc7, 0x55, 0x8d, 0xdd, 0x35, 0x1f, 0x0a, 0xc9, 0xb9, 0xcb, 0x7a, 0xb3,
+  0x62, 0x94, 0x3c, 0xf6, 0x92, 0xfb, 0x1a, 0x49, 0xfc, 0x71, 0x2b, 0x40,
+  0xc7, 0x9f, 0xc1, 0x43, 0x63, 0x47, 0x74, 0xe8, 0x7b, 0xb7, 0xe2, 0xd7,
+  0xa0, 0x31, 0xef, 0x28, 0x86, 0x1c, 0x96, 0xbe, 0xac, 0xe6, 0xe9, 0xbe,
+  0x8c, 0x3b, 0x37, 0xe5, 0x7c, 0x68, 0xe4, 0x75, 0x9b, 0x20, 0x9d, 0x66,
+  0x2a, 0xc0, 0xe8, 0x07, 0x28, 0x02, 0xdf, 0xaa, 0x79, 0x16, 0x29, 0xe3,
+  0x39, 0x63, 0x32, 0x4e, 0x5b, 0x5a, 0x75, 0x40, 0xa1, 0x47, 0x33, 0x7c,
+  0x4e, 0x12, 0x7d, 0x14, 0x54, 0x1d, 0x0a, 0x8d, 0xf4, 0xec, 0x9a, 0x7b,
+  0x48, 0x9a, 0x56, 0xa5, 0x0a, 0x15, 0xfc, 0x53, 0x9b, 0x8f, 0x66, 0x74,
+  0xf0, 0xf9, 0x1b, 0xe8, 0xb3, 0x1e, 0x12, 0x90, 0x19, 0x87, 0x89, 0xf4,
+  0xc4, 0x71, 0xf1, 0xab, 0x88, 0x86, 0x31, 0x1e, 0xef, 0x45, 0xfa, 0xf1,
+  0x70, 0x42, 0x9a, 0x73, 0x2a, 0xef, 0x7b, 0x72, 0x7f, 0x34, 0x63, 0x72,
+  0x22, 0xc7, 0x89, 0xf9, 0x7d, 0x03, 0x8c, 0x09, 0x16, 0x44, 0x2b, 0x14,
+  0x9c, 0xbe, 0x2b, 0x5a, 0x56, 0xeb, 0x50, 0x1d, 0x83, 0x0a, 0xd7, 0x7f,
+  0x19, 0xaa, 0xc1, 0xc1, 0x52, 0xd5, 0xfb, 0xd3, 0xda, 0x1f, 0xc2, 0x65,
+  0x24, 0x56, 0x21, 0x41, 0x12, 0xbf, 0xe8, 0xc3, 0x47, 0xb6, 0xa0, 0x3e,
+  0x40, 0x97, 0xf9, 0x88, 0x7c, 0xc7, 0xac, 0xb8, 0x03, 0xb9, 0x49, 0xfa,
+  0xd9, 0x10, 0xab, 0xf9, 0xb3, 0xec, 0x12, 0x37, 0x69, 0x99, 0x85, 0x5b,
+  0xee, 0x79, 0x41, 0x5e, 0x43, 0x3b, 0x03, 0x48, 0x8e, 0xb2, 0x43, 0xbc,
+  0x5a, 0x41, 0x33, 0xfb, 0x77, 0xfb, 0xd6, 0xce, 0x29, 0xa0, 0x91, 0xdf,
+  0x3e, 0x17, 0x5d, 0xfa, 0x10, 0xfd, 0x29, 0xdb, 0x99, 0xb9, 0x67, 0xe9,
+  0x66, 0xbf, 0x7d, 0xe6, 0x50, 0x68, 0x9a, 0x50, 0x83, 0x43, 0xe8, 0x36,
+  0x1f, 0x18, 0xcb, 0xc6, 0x0c, 0x06, 0x4b, 0x1f, 0x6d, 0xa3, 0xa8, 0x82,
+  0x26, 0x5a, 0x42, 0x00, 0xa6, 0x67, 0x99, 0xbe, 0xa1, 0xf0, 0x37, 0x68,
+  0xfb, 0x40, 0x8f, 0x2b, 0xe4, 0x8b, 0x9c, 0xd7, 0x55, 0xfe, 0xb4, 0xa7,
+  0x36, 0x65, 0x9b, 0x86, 0x67, 0xe7, 0xe3, 0x87, 0x54, 0xaa, 0xb6, 0xe3,
+  0x31, 0xab, 0x32, 0x3c, 0x8f, 0xff, 0xc8, 0xa7, 0x16, 0x7a, 0xf5, 0x66,
+  0xde, 0x7f, 0x03, 0x11, 0xf8, 0xe8, 0x1c, 0xd8, 0xa2, 0xa5, 0x2b, 0x3e,
+  0xd5, 0x55, 0xc4, 0x93, 0xf5, 0x15, 0x28, 0xd4, 0x9e, 0x7b, 0xbd, 0x3d,
+  0xa6, 0xdc, 0x4b, 0x51, 0x37, 0x1d, 0x1a, 0x38, 0x64, 0x90, 0x68, 0xba,
+  0x0c, 0x1a, 0xc3, 0x8e, 0xbe, 0xc6, 0x21, 0x53, 0xa3, 0x92, 0x45, 0x8e,
+  0x8c, 0xb0, 0xf2, 0x06, 0xf0, 0x93, 0x2c, 0x24, 0xe8, 0x25, 0x70, 0xf1,
+  0x21, 0x59, 0xa5, 0x88, 0xbc, 0xb6, 0x52, 0xac, 0x23, 0x85, 0x7b, 0x65,
+  0x7e, 0x44, 0x1e, 0x2d, 0x2e, 0xa0, 0xb3, 0xf5, 0xeb, 0x6e, 0x7a, 0x76,
+  0x35, 0x12, 0x5c, 0x35, 0x22, 0x64, 0xe8, 0x34, 0xc7, 0x5f, 0x05, 0x35,
+  0x41, 0x39, 0x88, 0x86, 0x7d, 0x33, 0xf8, 0xfa, 0xb7, 0xf7, 0x4b, 0x57,
+  0x6d, 0x45, 0xda, 0x3d, 0xfe, 0xd3, 0x91, 0x3f, 0xa9, 0x8b, 0xbc, 0x70,
+  0x47, 0x5d, 0xdc, 0xe3, 0x20, 0x31, 0x84, 0x10, 0x76, 0xa1, 0x78, 0xef,
+  0x93, 0x9a, 0xdd, 0xbb, 0x1e, 0x32, 0xce, 0x30, 0xeb, 0xc4, 0xaf, 0x2a,
+  0x19, 0xbb, 0x6e, 0x27, 0x7a, 0xde, 0x8f, 0xce, 0xe2, 0xc4, 0x6d, 0x53,
+  0x45, 0x96, 0xa7, 0x0a, 0x9e, 0xab, 0x1f, 0x38, 0xc4, 0x6b, 0xcd, 0xf6,
+  0xca, 0x63, 0xa9, 0x8a, 0xac, 0x41, 0xcf, 0xac, 0xe4, 0x0a, 0xf6, 0x93,
+  0xf5, 0x53, 0x21, 0x61, 0x51, 0x64, 0x3c, 0xf1, 0x99, 0x63, 0x0d, 0xd7,
+  0x3d, 0xff, 0x46, 0x5c, 0x6b, 0x3e, 0x68, 0x15, 0xb3, 0xbb, 0xed, 0x18,
+  0x83, 0x6b, 0xe9, 0x82, 0x38, 0xf0, 0x75, 0xf2, 0xec, 0xc8, 0x34, 0x0d,
+  0x70, 0x25, 0x14, 0x1a, 0xb4, 0xe3, 0xaa, 0x51, 0x69, 0x13, 0xbc, 0x67,
+  0xa6, 0x1a, 0x81, 0xc9, 0x59, 0x80, 0x43, 0x48, 0x46, 0x63, 0x19, 0x09,
+  0x84, 0xb0, 0x12, 0x37, 0x64, 0xc3, 0x12, 0x8a, 0xcb, 0x6f, 0xb3, 0xe8,
+  0xcd, 0xb5, 0x8b, 0x33, 0x97, 0x47, 0x01, 0x8c, 0xf9, 0xef, 0x2c, 0x5c,
+  0xf4, 0x30, 0x71, 0xfc, 0x2f, 0xaa, 0xef, 0x63, 0x1e, 0xea, 0xda, 0x7c,
+  0x1a, 0xcf, 0x89, 0x9b, 0x33, 0x2f, 0xaa, 0x7e, 0xa7, 0xd3, 0x3a, 0x07,
+  0x7a, 0x0f, 0x72, 0x63, 0x78, 0x67, 0x45, 0x2b, 0x36, 0x20, 0x85, 0x4c,
+  0x78, 0x16, 0xa9, 0x5f, 0xb3, 0x61, 0x06, 0x0c, 0x48, 0xda, 0xab, 0x99,
+  0xf1, 0x0b, 0xd3, 0x40, 0x5e, 0xfd, 0xb5, 0x05, 0x2b, 0x08, 0x54, 0x33,
+  0x1c, 0x48, 0x06, 0xd3, 0xc9, 0x44, 0x9a, 0x90, 0x48, 0x65, 0x5d, 0x1c,
+  0x0d, 0x10, 0xa3, 0x6d, 0x95, 0x78, 0x7e, 0x22, 0x66, 0x00, 0xd1, 0x24,
+  0xb4, 0x88, 0xd4, 0x74, 0x11, 0xb7, 0xca, 0x49, 0x95, 0x76, 0x93, 0x8f,
+  0xf2, 0xb5, 0xa8, 0xfc, 0xb4, 0x5a, 0x70, 0x8f, 0x9a, 0x66, 0x76, 0x54,
+  0x49, 0x30, 0xee, 0xff, 0x80, 0xbc, 0xb7, 0x84, 0xe0, 0xf3, 0xdd, 0x4a,
+  0xc9, 0xc8, 0x65, 0xb6, 0x16, 0x3d, 0x1d, 0x02, 0x6a, 0x86, 0x9f, 0x69,
+  0x57, 0x08, 0xa7, 0x9e, 0x8c, 0xba, 0x9d, 0xc8, 0x74, 0x53, 0xf5, 0x5b,
+  0x5e, 0x45, 0xe4, 0x51, 0xda, 0xf3, 0x47, 0x87, 0xf1, 0x49, 0xd9, 0x31,
+  0x97, 0x56, 0x5e, 0xf0, 0x34, 0xf6, 0x76, 0x9a, 0x5c, 0x78, 0xcc, 0x3a,
+  0x31, 0x63, 0xb0, 0x6f, 0x42, 0xe5, 0x2d, 0x1c, 0xf8, 0xdd, 0xd9, 0xcd,
+  0xa7, 0x2f, 0xaf, 0x14, 0xf7, 0x50, 0xc2, 0xcf, 0xf8, 0x86, 0xd4, 0x14,
+  0x3e, 0x54, 0xf6, 0x48, 0x1e, 0x50, 0xe5, 0xf0, 0x34, 0x2f, 0xbb, 0xa1,
+  0x94, 0x60, 0x3b, 0xdf, 0x46, 0x3e, 0x0e, 0xc1, 0xcb, 0x41, 0xe5, 0x0e,
+  0xce, 0xe7, 0x7b, 0x77, 0xa5, 0x8f, 0x1a, 0x90, 0x5c, 0x7c, 0x20, 0x42,
+  0x14, 0xd7, 0xc9, 0x35, 0xb3, 0xbc, 0x2e, 0xa3, 0xba, 0x0c, 0x45, 0xb0,
+  0x86, 0x2d, 0x0e, 0x9e, 0x44, 0x13, 0xb9, 0x4a, 0xbb, 0xc2, 0x2f, 0xe7,
+  0x11, 0x1a, 0x2b, 0xe0, 0x98, 0x8e, 0xb5, 0x90, 0x57, 0xd8, 0xd0, 0xb8,
+  0x14, 0x27, 0x21, 0xdb, 0x7f, 0x4a, 0x82, 0xf9, 0xff, 0x21, 0xa7, 0xf5,
+  0x5c, 0x8b, 0xfe, 0xaa, 0x3a, 0x85, 0xc3, 0x2d, 0xd8, 0xd9, 0x05, 0x21,
+  0xdd, 0x5f, 0xbd, 0x79, 0x0f, 0x95, 0x91, 0xba, 0xdb, 0xd9, 0xca, 0x0b,
+  0x0c, 0x51, 0x64, 0x9c, 0x6b, 0x42, 0x5a, 0x87, 0xf8, 0x18, 0xa9, 0x31,
+  0x83, 0x3d, 0x38, 0x65, 0xff, 0xec, 0x65, 0x4d, 0x24, 0x1f, 0xc3, 0x88,
+  0xb7, 0xd9, 0x9c, 0xfa, 0x6c, 0x72, 0x70, 0xcc, 0x71, 0x94, 0x25, 0x58,
+  0x48, 0x81, 0xa9, 0xce, 0xd1, 0xeb, 0x9e, 0x1c, 0xc1, 0x37, 0x6f, 0x7b,
+  0x4b, 0x1f, 0x55, 0xa9, 0x60, 0x29, 0xf2, 0x8d, 0x9c, 0x2d, 0x25, 0x11,
+  0x97, 0x96, 0xfe, 0xf1, 0x8b, 0xa8, 0x33, 0x45, 0x36, 0xb0, 0x8c, 0x54,
+  0x92, 0x1b, 0xef, 0x17, 0xc5, 0x25, 0x43, 0xc7, 0x2c, 0x80, 0x64, 0x59,
+  0xb0, 0x89, 0x75, 0x43, 0x67, 0xf3, 0x9f, 0xfd, 0xeb, 0xa2, 0xd8, 0xa8,
+  0x74, 0x88, 0xcb, 0xb3, 0xef, 0xe2, 0x0b, 0x42, 0xb5, 0xf4, 0xc0, 0x10,
+  0x38, 0x38, 0x94, 0x0e, 0x91, 0x3b, 0x66, 0xa3, 0x8e, 0xc4, 0x0a, 0xa8,
+  0x53, 0x68, 0x28, 0xce, 0x3c, 0x32, 0x01, 0x4f, 0x87, 0xb6, 0x0b, 0x14,
+  0x32, 0xf2, 0xdb, 0x93, 0xb5, 0xb3, 0xbc, 0xc9, 0x52, 0x4a, 0x73, 0xaf,
+  0x07, 0xd9, 0x4d, 0x79, 0x0b, 0xe4, 0x24, 0xdd, 0xda, 0x95, 0xa8, 0xaf,
+  0x25, 0x78, 0x29, 0x89, 0x72, 0xc0, 0x8f, 0xb4, 0x01, 0xa7, 0x6c, 0x91,
+  0xa2, 0x2c, 0xf0, 0xd9, 0x45, 0x48, 0x4a, 0x76, 0xf5, 0xf3, 0xfb, 0x10,
+  0x9e, 0xad, 0x3f, 0x67, 0x07, 0x23, 0x5a, 0xa8, 0xc9, 0xa1, 0xd1, 0xc5,
+  0xe5, 0x6a, 0x9a, 0x80, 0xd0, 0x56, 0x8c, 0x6f, 0x3f, 0xdd, 0x16, 0xb3,
+  0x03, 0x78, 0xdc, 0x5c, 0x94, 0x61, 0x1d, 0xf4, 0x5f, 0x01, 0xff, 0x3b,
+  0x45, 0x1c, 0x49, 0x8d, 0x50, 0xbe, 0xb6, 0xc4, 0xc2, 0x34, 0xd5, 0x0b,
+  0xf3, 0xf6, 0x6c, 0xaf, 0x92, 0x38, 0x50, 0x94, 0x26, 0x67, 0xcf, 0x4f,
+  0x08, 0xa5, 0xd0, 0x5a, 0x8d, 0x97, 0xb5, 0xd8, 0xbc, 0x41, 0xfb, 0xdf,
+  0xee, 0x01, 0x7e, 0x67, 0xbd, 0xbb, 0x24, 0xff, 0x2d, 0x24, 0x39, 0x0a,
+  0xad, 0xc0, 0xf9, 0x3f, 0x26, 0xaa, 0x34, 0x7c, 0x98, 0x87, 0x16, 0x14,
+  0x5d, 0x32, 0x5e, 0x21, 0xdf, 0xb8, 0x33, 0xa9, 0x2d, 0xf6, 0x6e, 0x26,
+  0x7f, 0x6a, 0x89, 0x39, 0x54, 0xc7, 0x69, 0x2f, 0x35, 0x2a, 0x07, 0x14,
+  0x5d, 0xef, 0x22, 0x23, 0xbf, 0x49, 0xb7, 0xc8, 0x04, 0x52, 0xbb, 0x0f,
+  0xd8, 0xc0, 0x97, 0xfe, 0x08, 0x36, 0x46, 0x9a, 0x1e, 0xcd, 0xa8, 0x01,
+  0xbe, 0xfe, 0x12, 0xa7, 0xd1, 0xbc, 0xf6, 0x58, 0x7e, 0x29, 0x8c, 0xfe,
+  0x1f, 0xca, 0xe6, 0x6b, 0xf7, 0xbb, 0xe9, 0x33, 0x96, 0x99, 0x53, 0x10,
+  0x91, 0x94, 0x97, 0x2c, 0x80, 0xac, 0x82, 0x06, 0x54, 0x36, 0x17, 0x70,
+  0x89, 0xdc, 0x6e, 0x7c, 0x12, 0x38, 0xd2, 0x3d, 0x0d, 0xa0, 0x80, 0x9e,
+  0xaa, 0x10, 0x31, 0xfa, 0x4a, 0xc4, 0x9e, 0xde, 0x0f, 0x06, 0x88, 0x1e,
+  0x14, 0x48, 0xec, 0xec, 0x4f, 0x8d, 0x60, 0x95, 0x29, 0x9a, 0x69, 0x52,
+  0xb1, 0x14, 0xa6, 0x2d, 0xf8, 0xad, 0xa3, 0x0a, 0xd0, 0x57, 0x26, 0x02,
+  0x0e, 0xe2, 0x49, 0x54, 0x40, 0xcd, 0xf7, 0xb9, 0xa9, 0xfb, 0x05, 0xd1,
+  0xf6, 0x6e, 0xa6, 0xba, 0xf3, 0xad, 0x0a, 0x6b, 0xc8, 0xd6, 0x03, 0xd6,
+  0xbd, 0x93, 0xf0, 0x87, 0x3d, 0xd7, 0x95, 0x10, 0xf4, 0x67, 0x98, 0x3e,
+  0xb6, 0x34, 0x0f, 0xf3, 0xb8, 0x8d, 0x41, 0x70, 0x24, 0x0b, 0xd4, 0x7a,
+  0x0f, 0x90, 0x72, 0x15, 0x7b, 0xff, 0x24, 0xbf, 0x44, 0x20, 0x80, 0x30,
+  0xac, 0x26, 0x74, 0xd6, 0xf6, 0x00, 0x9f, 0x92, 0x9e, 0x6a, 0x7d, 0x09,
+  0xd4, 0xbf, 0x90, 0x2a, 0x18, 0xd0, 0xba, 0xf3, 0x73, 0x10, 0xb0, 0xb2,
+  0x74, 0x44, 0x28, 0x9e, 0xc9, 0xf1, 0xb2, 0x97, 0x11, 0x84, 0x81, 0xce,
+  0x9f, 0x1a, 0x3b, 0x75, 0x1b, 0xe4, 0xcd, 0x1e, 0x63, 0x4b, 0x5b, 0x1d,
+  0x83, 0x1f, 0x01, 0xa4, 0xae, 0x02, 0x2a, 0x88, 0x18, 0x67, 0x20, 0x67,
+  0xa1, 0x34, 0x9d, 0x95, 0x98, 0x53, 0x61, 0xcf, 0xe5, 0xa4, 0xcc, 0xe7,
+  0x75, 0x88, 0x66, 0xf0, 0xd2, 0x92, 0xa0, 0x90, 0x65, 0x47, 0x38, 0xde,
+  0xba, 0x3b, 0x00, 0x48, 0xc5, 0x2c, 0x8b, 0x78, 0x78, 0x09, 0xbf, 0xeb,
+  0x6a, 0x80, 0x32, 0x1e, 0x22, 0xd5, 0xe5, 0xf9, 0x87, 0x66, 0x07, 0x89,
+  0x78, 0x4d, 0x59, 0xf2, 0x6e, 0x50, 0x80, 0xbc, 0x0f, 0x4e, 0xe0, 0x3f,
+  0x25, 0x93, 0x0f, 0xa5, 0xba, 0xe8, 0x1a, 0x87, 0xb2, 0x73, 0x51, 0xf3,
+  0x58, 0x70, 0x09, 0x3e, 0x3f, 0x03, 0x1c, 0xd6, 0x0c, 0xa6, 0x91, 0x0e,
+  0x94, 0xca, 0xe6, 0x3f, 0xe4, 0x05, 0xb4, 0x86, 0x1f, 0xaf, 0xfe, 0xe0,
+  0xe6, 0xcc, 0x12, 0x3d, 0xf6, 0x1b, 0xcf, 0x0b, 0x4d, 0x3f, 0xab, 0x76,
+  0x1b, 0xf0, 0xd2, 0x62, 0xda, 0x03, 0x91, 0x8e, 0x9b, 0x09, 0x7a, 0x2e,
+  0xd8, 0xe8, 0xbd, 0x6e, 0xcc, 0xcc, 0xf1, 0xd0, 0x44, 0x40, 0x03, 0xd1,
+  0x64, 0x04, 0x30, 0x30, 0x52, 0xec, 0x86, 0x59, 0x4b, 0x69, 0x02, 0x74,
+  0x24, 0x29, 0xf7, 0x83, 0x16, 0x98, 0xe1, 0x4b, 0x24, 0x3d, 0x65, 0xe7,
+  0x71, 0x5c, 0x7c, 0x69, 0x0c, 0x95, 0x90, 0x7b, 0x58, 0x78, 0xe4, 0xde,
+  0x1b, 0x88, 0xd5, 0xef, 0xb6, 0xf5, 0x99, 0x8b, 0xff, 0xa3, 0x25, 0xf7,
+  0xaa, 0xaf, 0xa7, 0x0c, 0x5e, 0x2d, 0xd0, 0x09, 0xfb, 0x58, 0x69, 0x61,
+  0x62, 0xb4, 0x66, 0xd0, 0x18, 0x18, 0x28, 0xd5, 0x51, 0xb7, 0x39, 0x9e,
+  0x10, 0xa0, 0x93, 0x98, 0xe7, 0xc0, 0xf4, 0xfa, 0xbe, 0x50, 0x4b, 0x95,
+  0x80, 0xef, 0x7b, 0x4f, 0x58, 0x57, 0xd4, 0x3e, 0xbb, 0xc0, 0x44, 0x58,
+  0x6f, 0x6c, 0x44, 0x97, 0xb3, 0xfd, 0xa7, 0xc7, 0x8b, 0x60, 0x81, 0xd2,
+  0x9e, 0x8b, 0xfe, 0xf5, 0x16, 0xc5, 0x30, 0xd9, 0x5c, 0xb4, 0x06, 0x45,
+  0x1f, 0xcb, 0x81, 0x36, 0x72, 0xff, 0xd2, 0x10, 0x39, 0x70, 0x7d, 0xba,
+  0xb9, 0x63, 0x69, 0x47, 0xef, 0xcc, 0x87, 0x47, 0xd0, 0x01, 0xeb, 0x92,
+  0xea, 0xbc, 0xd2, 0xe3, 0x28, 0x57, 0x28, 0x88, 0x87, 0xd6, 0xb2, 0xb0,
+  0x01, 0xd4, 0xaf, 0xbf, 0xe4, 0xd3, 0x46, 0xf8, 0x81, 0x4a, 0x6a, 0x24,
+  0xf3, 0x4b, 0x1a, 0x01, 0xd2, 0xc5, 0x4f, 0x9c, 0xd7, 0xf2, 0x64, 0xa1,
+  0x99, 0xb8, 0x88, 0xd6, 0x94, 0xa6, 0xd9, 0xca, 0xdf, 0x28, 0x72, 0x2e,
+  0x56, 0x5c, 0xd1, 0x2a, 0xbf, 0x2d, 0x3d, 0x62, 0x49, 0xbb, 0xfd, 0x4c,
+  0x34, 0x09, 0xbb, 0xfb, 0x72, 0xd7, 0x7d, 0x45, 0x5e, 0x4e, 0x3f, 0xcb,
+  0x41, 0xb4, 0x2a, 0xbb, 0xae, 0x37, 0x34, 0x11, 0xf1, 0xa1, 0xc9, 0xeb,
+  0x22, 0xca, 0xd1, 0xa2, 0x0a, 0xbd, 0xcc, 0x00, 0x87, 0x35, 0x9c, 0x0e,
+  0xa8, 0xc0, 0x04, 0xfa, 0x7f, 0xe1, 0xdf, 0x34, 0x8e, 0x0d, 0xe1, 0x1d,
+  0xae, 0xf6, 0xc3, 0x82, 0xc9, 0xe5, 0x5b, 0x2f, 0x6b, 0xef, 0x94, 0xc2,
+  0x19, 0x9e, 0x46, 0x84, 0x23, 0xb2, 0xd6, 0x37, 0xca, 0xa1, 0xac, 0x32,
+  0x2d, 0x26, 0xf3, 0x3e, 0xd5, 0xa6, 0xfb, 0xff, 0x42, 0xa5, 0x97, 0x79,
+  0x6d, 0x7b, 0x8f, 0xd3, 0xf9, 0xee, 0x47, 0xef, 0x88, 0x85, 0xf4, 0x81,
+  0x09, 0x7b, 0x3a, 0xdf, 0x77, 0x90, 0xdb, 0xbd, 0x81, 0x13, 0xbf, 0xac,
+  0xc0, 0x66, 0x54, 0xfa, 0x64, 0x4f, 0x2e, 0x8d, 0x93, 0x7d, 0xd0, 0xb8,
+  0xcb, 0xb2, 0x06, 0xae, 0x1d, 0xa5, 0xba, 0x99, 0x1f, 0x8c, 0xc6, 0x08,
+  0x80, 0x82, 0xfc, 0xb3, 0x2d, 0x4c, 0xbf, 0x76, 0xfa, 0xcf, 0x77, 0x80,
+  0xf3, 0x46, 0xd9, 0x7a, 0xc2, 0x48, 0x19, 0x47, 0xb0, 0xe5, 0x8b, 0x39,
+  0x00, 0xbe, 0x46, 0xba, 0xc4, 0xc5, 0x93, 0x7f, 0x73, 0xbf, 0xf4, 0x5d,
+  0x48, 0x8b, 0xa8, 0x00, 0xab, 0xa4, 0x65, 0x33, 0x82, 0xb9, 0xc4, 0x3f,
+  0xf2, 0x05, 0x8f, 0x20, 0x69, 0x37, 0xbb, 0x64, 0xbb, 0xb8, 0x7f, 0xd1,
+  0x4c, 0xf0, 0xaa, 0xea, 0x0e, 0xf4, 0x60, 0xaf, 0x20, 0x3f, 0x97, 0xb3,
+  0x1b, 0x6a, 0xd3, 0x27, 0xac, 0x5e, 0xbb, 0x57, 0x42, 0x12, 0xb7, 0x0a,
+  0xe9, 0x37, 0x25, 0xe5, 0xac, 0x9d, 0xa9, 0xcd, 0x6b, 0x86, 0x51, 0x3a,
+  0xed, 0xaa, 0x60, 0x2e, 0x99, 0x14, 0x55, 0x4f, 0xca, 0x16, 0x4d, 0x03,
+  0x1e, 0xfc, 0x3e, 0x61, 0xf3, 0x6e, 0x75, 0x3f, 0x7e, 0x22, 0x64, 0x20,
+  0x27, 0x57, 0x38, 0x90, 0x5a, 0xb1, 0x5f, 0x27, 0x6b, 0x7c, 0xc9, 0xe6,
+  0x13, 0x8e, 0xfa, 0x9a, 0x82, 0xfd, 0x41, 0x1f, 0x93, 0x8a, 0xdf, 0xa6,
+  0xe4, 0xd4, 0x8d, 0x41, 0x52, 0xfc, 0x07, 0xf2, 0x3c, 0x6c, 0x6c, 0xab,
+  0x79, 0x92, 0xc2, 0xa5, 0x29, 0x2f, 0xf4, 0x15, 0x49, 0x66, 0xb9, 0x93,
+  0xd5, 0xae, 0xff, 0x5b, 0x4c, 0x5a, 0x98, 0x58, 0x1d, 0x1d, 0xcb, 0xf1,
+  0x16, 0x8d, 0x91, 0xee, 0xf3, 0xd9, 0x9a, 0x5c, 0x85, 0x89, 0x84, 0xfb,
+  0x79, 0x7e, 0x86, 0x24, 0x2f, 0x4a, 0x0c, 0x08, 0x8a, 0x64, 0x9a, 0x26,
+  0x3d, 0xa5, 0x5a, 0xe9, 0xb1, 0x8d, 0x89, 0x3b, 0xdb, 0xaf, 0x34, 0x57,
+  0xb8, 0xd4, 0xb4, 0x9f, 0xa4, 0x57, 0xb4, 0xa0, 0x91, 0x02, 0x7c, 0x5b,
+  0xbd, 0xe8, 0x86, 0xf4, 0xfc, 0xdb, 0x96, 0x43, 0x28, 0xc4, 0xdd, 0xda,
+  0x5d, 0x19, 0xb4, 0x91, 0x21, 0xbb, 0xc8, 0xc3, 0x49, 0x9d, 0x78, 0x3a,
+  0xbd, 0x28, 0xdf, 0xa1, 0x35, 0x2a, 0x56, 0x7b, 0xc3, 0xbf, 0x5e, 0xaf,
+  0x94, 0x31, 0xca, 0x49, 0x0d, 0xb8, 0x99, 0x18, 0x70, 0x68, 0x4c, 0x8c,
+  0x53, 0x5d, 0x17, 0x2b, 0x52, 0x30, 0x1d, 0xef, 0x06, 0x25, 0x67, 0xda,
+  0x48, 0x4c, 0x12, 0x6d, 0xc2, 0xcd, 0xfe, 0x06, 0x6c, 0xd9, 0x37, 0xc9,
+  0x2f, 0x27, 0xda, 0x57, 0x16, 0x3d, 0x7b, 0x17, 0x30, 0x4a, 0x9a, 0x8f,
+  0xce, 0x81, 0x82, 0x0b, 0x7c, 0x1f, 0x38, 0x4f, 0xdf, 0xa7, 0x3a, 0x26,
+  0xc8, 0x72, 0xaa, 0x80, 0x38, 0xfc, 0x43, 0xc3, 0x27, 0x09, 0xd3, 0x3f,
+  0x28, 0xf1, 0x8b, 0x7e, 0x14, 0x2e, 0xcb, 0xf4, 0xc4, 0xfb, 0x1d, 0xac,
+  0x12, 0xda, 0x06, 0xcd, 0xc0, 0x07, 0x84, 0x34, 0xb4, 0x5f, 0x0c, 0xb8,
+  0xb7, 0xfa, 0x3a, 0x25, 0x67, 0xab, 0x1c, 0x76, 0x55, 0x23, 0xb7, 0xb5,
+  0x40, 0x45, 0x0f, 0x49, 0x94, 0xdc, 0x3c, 0x8f, 0x92, 0xc2, 0x0d, 0xa5,
+  0x82, 0xd4, 0xee, 0x8a, 0x4e, 0x86, 0x24, 0x03, 0x5d, 0x34, 0xb5, 0x3b,
+  0xd5, 0x11, 0x92, 0xe9, 0x1c, 0x27, 0x03, 0x7a, 0xe1, 0x64, 0x06, 0xa8,
+  0x36, 0x64, 0x64, 0x2f, 0xa0, 0x1b, 0x1f, 0x15, 0x01, 0x41, 0x0c, 0x28,
+  0x14, 0xd2, 0xae, 0xb4, 0x45, 0x71, 0x19, 0x2c, 0x0d, 0x4c, 0xc5, 0x72,
+  0xdc, 0xa7, 0xd9, 0x96, 0x51, 0xcb, 0x3a, 0x51, 0x2f, 0x98, 0x48, 0xa2,
+  0xcb, 0x96, 0x4f, 0xd8, 0x91, 0x43, 0xbe, 0xb3, 0xe2, 0x9f, 0x46, 0x9b,
+  0xf9, 0xfa, 0xa5, 0xdf, 0x97, 0x6a, 0x01, 0x81, 0xa8, 0x40, 0x8d, 0x25,
+  0xfd, 0x19, 0xed, 0x61, 0x60, 0x00, 0x7d, 0x14, 0x5d, 0xe1, 0x30, 0xed,
+  0x8f, 0xd4, 0x28, 0x22, 0x4c, 0xb7, 0xf4, 0x1a, 0x85, 0xd8, 0x42, 0xea,
+  0x9d, 0x1a, 0xa6, 0x71, 0xc1, 0x1a, 0x77, 0x73, 0xed, 0x64, 0x4c, 0x9e,
+  0xa7, 0x9b, 0x06, 0x80, 0xbe, 0x12, 0x59, 0x06, 0x2c, 0xc4, 0xd5, 0xf8,
+  0xa9, 0x5f, 0x26, 0xe8, 0x44, 0xbb, 0xed, 0xe6, 0x63, 0x2b, 0x65, 0x3f,
+  0x85, 0x30, 0x86, 0xc8, 0xb3, 0xe0, 0x8d, 0xed, 0x46, 0x41, 0xba, 0x32,
+  0x87, 0xe4, 0x1a, 0x57, 0xb6, 0x57, 0x42, 0x56, 0x88, 0x15, 0x5e, 0xde,
+  0x7b, 0x36, 0x95, 0xd8, 0xa6, 0x8d, 0x70, 0xc2, 0x60, 0x23, 0x32, 0x3b,
+  0x90, 0x11, 0xbf, 0x3e, 0x82, 0x24, 0x93, 0xf7, 0x71, 0x04, 0x4c, 0x82,
+  0x52, 0xc6, 0x8e, 0xcc, 0x53, 0x6e, 0x7c, 0x91, 0x25, 0x0a, 0x21, 0xb0,
+  0x3a, 0x3f, 0x69, 0x4b, 0xc7, 0x99, 0xfc, 0xb1, 0x50, 0xdb, 0xd5, 0xcd,
+  0xbf, 0x6b, 0x9c, 0xf1, 0x91, 0x74, 0xef, 0x76, 0x2f, 0x5d, 0x76, 0xeb,
+  0x98, 0x08, 0x06, 0x5b, 0xf1, 0x12, 0x0f, 0xf4, 0x21, 0x1f, 0x17, 0x92,
+  0x17, 0x3c, 0xb8, 0x6c, 0x8f, 0xfa, 0x2f, 0x1a, 0x6a, 0x65, 0xe1, 0x3d,
+  0x0f, 0xe1, 0x01, 0x02, 0xa7, 0x2e, 0x5d, 0xb9, 0x91, 0x06, 0xcd, 0x1f,
+  0xc8, 0xbd, 0x2f, 0x55, 0x71, 0xd0, 0x6d, 0xd3, 0xce, 0xfd, 0xd6, 0x01,
+  0x43, 0x50, 0x0f, 0x5d, 0xaa, 0xf9, 0xfc, 0x16, 0x25, 0xa8, 0xc5, 0x1d,
+  0x33, 0x04, 0xf8, 0xf8, 0x09, 0xd1, 0x07, 0xe7, 0x3e, 0xe9, 0x0a, 0x64,
+  0x52, 0x40, 0xfa, 0x9e, 0x73, 0x4d, 0xbe, 0x6d, 0x04, 0x3e, 0xce, 0xa7,
+  0x7b, 0xf8, 0x57, 0x50, 0x44, 0xa7, 0x73, 0x8d, 0xad, 0x59, 0x0a, 0x63,
+  0xc6, 0xb3, 0xc7, 0x2c, 0xe3, 0x87, 0x14, 0x3c, 0xc7, 0x71, 0xef, 0x7e,
+  0x8d, 0x61, 0xa5, 0xcd, 0xe1, 0x06, 0xa7, 0x2b, 0x1c, 0xf8, 0x58, 0x63,
+  0x4a, 0x6f, 0x9e, 0xb0, 0xc2, 0x97, 0x1d, 0x10, 0xb9, 0x84, 0x28, 0x64,
+  0xe7, 0xb9, 0xe2, 0x1e, 0x24, 0xc3, 0xab, 0xcd, 0x3a, 0x02, 0x8f, 0x23,
+  0x17, 0xc7, 0x4f, 0x3d, 0xb1, 0x1b, 0x16, 0x0d, 0xa6, 0x61, 0xa3, 0xc3,
+  0x5d, 0xea, 0xac, 0x9b, 0xd3, 0x77, 0x9a, 0x40, 0x39, 0x22, 0xe6, 0x4c,
+  0xa9, 0x0f, 0x17, 0xf5, 0x0e, 0x3c, 0x33, 0x27, 0x2a, 0x81, 0x7b, 0x5b,
+  0x85, 0xc5, 0x5b, 0xba, 0x1a, 0xe9, 0xe2, 0xc5, 0x91, 0xc2, 0xcb, 0xee,
+  0x3f, 0x91, 0x8f, 0x42, 0xd9, 0xcc, 0xab, 0xab, 0xfc, 0x9d, 0x2b, 0x0a,
+  0xb5, 0xef, 0x24, 0x52, 0xf0, 0xa6, 0xce, 0x13, 0x51, 0x62, 0x5a, 0x86,
+  0xe4, 0x82, 0x79, 0x49, 0xe2, 0xf2, 0x14, 0x88, 0xe7, 0x60, 0x45, 0xea,
+  0x49, 0x20, 0x45, 0x8b, 0xbe, 0x1c, 0x1c, 0xad, 0x31, 0x70, 0x54, 0xe0,
+  0x12, 0x7c, 0xa4, 0x06, 0xdb, 0xb7, 0x1c, 0x20, 0xfb, 0x3e, 0xf4, 0x5b,
+  0x48, 0x7b, 0x8a, 0x4d, 0x41, 0xb8, 0xc1, 0x76, 0x80, 0x73, 0xc6, 0xb4,
+  0x6f, 0x1e, 0x12, 0xbe, 0x69, 0x5d, 0xeb, 0xf3, 0x70, 0x0e, 0xa1, 0x74,
+  0x54, 0x7c, 0xad, 0xf1, 0xcf, 0x7d, 0x2e, 0xba, 0x8d, 0xdd, 0xcd, 0x35,
+  0x5d, 0x9e, 0x51, 0x3c, 0x9d, 0x61, 0x6c, 0x46, 0xdd, 0xc1, 0x2e, 0xa8,
+  0xd0, 0x69, 0xe2, 0x0a, 0x98, 0x17, 0xfe, 0xab, 0x43, 0x64, 0x06, 0xdd,
+  0x15, 0xda, 0x35, 0x93, 0x11, 0x63, 0x9a, 0x20, 0x46, 0x6d, 0x52, 0xb5,
+  0x1c, 0x9b, 0x61, 0x8a, 0x7b, 0x64, 0x08, 0x70, 0x77, 0x87, 0xdb, 0xeb,
+  0x6e, 0x54, 0xe9, 0xa5, 0x76, 0xa1, 0x9c, 0x33, 0xe6, 0x1d, 0x0d, 0x8f,
+  0x5b, 0x3e, 0x74, 0x9f, 0x31, 0x29, 0xcf, 0xb9, 0xb6, 0x89, 0xce, 0xb3,
+  0x58, 0x59, 0x70, 0x8c, 0x2c, 0x21, 0xf4, 0x0f, 0xeb, 0xeb, 0x3f, 0xe4,
+  0x39, 0xa0, 0xdc, 0x81, 0xe7, 0xc7, 0x8b, 0x8a, 0xd7, 0xf5, 0x16, 0x86,
+  0x75, 0x99, 0xe9, 0x3f, 0x14, 0x55, 0x8a, 0x8e, 0xf4, 0x92, 0xc2, 0x7d,
+  0x31, 0x53, 0x56, 0xac, 0x38, 0xdc, 0x31, 0x10, 0x72, 0xa9, 0x4b, 0x36,
+  0x2b, 0x80, 0xc3, 0x6a, 0xca, 0xfb, 0x46, 0xc6, 0x72, 0x69, 0xe1, 0xe4,
+  0x08, 0x02, 0x7f, 0x61, 0xf9, 0x54, 0x50, 0x61, 0xb0, 0xf2, 0xab, 0x4a,
+  0xc0, 0x26, 0x5c, 0x40, 0x75, 0x46, 0x39, 0x92, 0x83, 0x5b, 0x1e, 0xcf,
+  0x99, 0x8e, 0x56, 0x2b, 0x82, 0x2e, 0x96, 0xe9, 0x82, 0x2f, 0x2f, 0x16,
+  0xc5, 0xed, 0x70, 0xa5, 0x78, 0x8e, 0x55, 0xc1, 0x0e, 0x00, 0x08, 0x8e,
+  0x6e, 0xe5, 0x76, 0xae, 0xf6, 0xd3, 0x67, 0x45, 0xb3, 0x7b, 0xc2, 0xab,
+  0xef, 0x19, 0x4b, 0xf1, 0xde, 0xab, 0x23, 0xbf, 0xd3, 0x8b, 0x77, 0x6b,
+  0xe3, 0xd7, 0x0b, 0xaf, 0x0f, 0x7e, 0x6c, 0xd8, 0x4f, 0xcd, 0xe5, 0x6d,
+  0x21, 0x32, 0xda, 0x5c, 0x47, 0x82, 0x76, 0x2c, 0x36, 0x6e, 0xd8, 0x1e,
+  0x8d, 0xa7, 0x9a, 0x54, 0x6b, 0x83, 0x9c, 0x83, 0x10, 0xf0, 0xdc, 0x47,
+  0x7a, 0xd2, 0x9c, 0xeb, 0x9b, 0xcc, 0xe5, 0x82, 0x49, 0x5e, 0x1a, 0xe5,
+  0x07, 0xf1, 0x9f, 0x19, 0x7b, 0x19, 0x2c, 0x47, 0x3d, 0xb0, 0x13, 0x64,
+  0xd7, 0x00, 0xb8, 0x16, 0xb3, 0x9b, 0x66, 0x25, 0x5a, 0x36, 0xf8, 0x17,
+  0xbd, 0x39, 0x8c, 0x7a, 0x6c, 0x2a, 0xf1, 0xf9, 0x0c, 0x14, 0x4c, 0x0c,
+  0xf2, 0x65, 0x4d, 0x41, 0x30, 0xd3, 0x87, 0x7d, 0x6d, 0xc1, 0xc1, 0xd8,
+  0x33, 0xc1, 0x81, 0xb8, 0x14, 0xab, 0xcb, 0xbf, 0xf3, 0x68, 0xcc, 0x0e,
+  0x64, 0x06, 0xb4, 0xae, 0x50, 0x7a, 0xd5, 0xfb, 0x59, 0x97, 0x9c, 0x21,
+  0x2c, 0xd3, 0x22, 0x8a, 0xfd, 0x0c, 0xa4, 0x01, 0x22, 0x98, 0xb4, 0x5a,
+  0x08, 0x08, 0xee, 0xe4, 0x50, 0x72, 0xf8, 0x5b, 0xea, 0x18, 0xf2, 0x65,
+  0x07, 0x13, 0xd1, 0x34, 0xb4, 0x4f, 0x7c, 0x90, 0x6e, 0x4e, 0x3f, 0xb9,
+  0xc8, 0x88, 0xa4, 0xc5, 0x2e, 0x5a, 0xd7, 0x72, 0xb1, 0x86, 0x89, 0x5c,
+  0x37, 0x4a, 0x28, 0x42, 0xcb, 0xc2, 0xcc, 0xf6, 0xdb, 0xd3, 0x32, 0x33,
+  0x11, 0xdf, 0xa9, 0x46, 0x3d, 0xfa, 0xd6, 0x62, 0x9b, 0x12, 0xad, 0xf1,
+  0xd5, 0xef, 0x61, 0x8d, 0x69, 0x41, 0x0f, 0x39, 0x57, 0x59, 0x0c, 0x3a,
+  0x30, 0x06, 0x2c, 0xc5, 0xa0, 0x85, 0x25, 0x74, 0x71, 0x58, 0xde, 0xfb,
+  0xe9, 0xd4, 0x18, 0x9c, 0xee, 0x33, 0x91, 0x84, 0x5a, 0xcb, 0x67, 0x8f,
+  0xfa, 0x18, 0x5e, 0xcf, 0x25, 0x26, 0xa9, 0xd3, 0xc0, 0xf5, 0xb8, 0xa4,
+  0x77, 0x38, 0xd8, 0x44, 0xdd, 0xe5, 0x5b, 0x6d, 0x6b, 0x4d, 0xf4, 0xaa,
+  0x3e, 0x37, 0xb0, 0xfc, 0x17, 0xdf, 0x86, 0x37, 0x19, 0xb0, 0xfb, 0x13,
+  0xca, 0x5a, 0xb8, 0x35, 0x16, 0x63, 0xc4, 0xbb, 0xcb, 0xcf, 0x27, 0x50,
+  0x12, 0xae, 0x48, 0xb9, 0x6a, 0x63, 0x54, 0x94, 0xc7, 0x8b, 0xef, 0xd2,
+  0xdb, 0x49, 0xf1, 0x7f, 0x92, 0x38, 0xc7, 0x01, 0xa0, 0xf8, 0xb0, 0xfc,
+  0x92, 0x22, 0x50, 0x9f, 0x23, 0xc4, 0xd5, 0x13, 0xc6, 0xfe, 0x41, 0xa9,
+  0xf1, 0x20, 0x08, 0x66, 0xc9, 0x3d, 0xff, 0xeb, 0xc0, 0xfb, 0x14, 0x17,
+  0x66, 0xaa, 0x3a, 0x45, 0x81, 0xa9, 0xaf, 0xc2, 0x38, 0xfa, 0x67, 0xac,
+  0xec, 0x98, 0xdd, 0x03, 0xf6, 0x07, 0x86, 0x08, 0x40, 0x13, 0xb7, 0xb3,
+  0x17, 0x5c, 0xf0, 0x53, 0x97, 0xb1, 0x2c, 0x0c, 0x83, 0x4e, 0x9e, 0x9c,
+  0xc1, 0x69, 0x81, 0xcd, 0xff, 0xa9, 0x55, 0x02, 0xed, 0x0f, 0xb9, 0x26,
+  0x05, 0x98, 0xe3, 0x75, 0x3b, 0x8d, 0x61, 0xa7, 0xff, 0xa5, 0x19, 0xae,
+  0xf5, 0x70, 0x92, 0xd3, 0x71, 0xea, 0xd2, 0x33, 0x7a, 0x7c, 0x98, 0xc1,
+  0xf1, 0x55, 0xf4, 0xd7, 0xbe, 0x69, 0xa9, 0x57, 0x7f, 0x86, 0xbf, 0xfe,
+  0x23, 0x94, 0x43, 0xf0, 0x00, 0xfc, 0x38, 0xe4, 0xdd, 0x21, 0x82, 0xae,
+  0xc9, 0x0b, 0xf9, 0x57, 0x09, 0xba, 0xc3, 0xc8, 0x15, 0x09, 0x62, 0x55,
+  0xae, 0x72, 0x65, 0x65, 0x4b, 0xc7, 0xc5, 0x39, 0x17, 0x36, 0x52, 0x11,
+  0xb9, 0x0e, 0x4b, 0x1c, 0xad, 0xcb, 0x40, 0xe5, 0xf9, 0x17, 0xce, 0x4c,
+  0x82, 0x48, 0xa0, 0x9a, 0x39, 0x0c, 0x65, 0x60, 0x56, 0xc8, 0x60, 0x80,
+  0x96, 0xcd, 0xc0, 0x34, 0x1e, 0x53, 0x24, 0x1d, 0x6d, 0xc8, 0x02, 0x91,
+  0x6d, 0xf2, 0x57, 0x0f, 0x30, 0xaa, 0x8f, 0xd7, 0xe9, 0x88, 0x36, 0x3e,
+  0x2e, 0x9c, 0x22, 0x85, 0xd1, 0xb1, 0xd9, 0xd2, 0x61, 0x56, 0x4e, 0x0d,
+  0xe4, 0x42, 0x36, 0xa5, 0x40, 0x31, 0x99, 0x1e, 0x4d, 0x9a, 0x42, 0x98,
+  0xd4, 0x79, 0x9c, 0x8c, 0x01, 0xa1, 0xf4, 0x5e, 0x72, 0xcc, 0xd5, 0xa4,
+  0x0e, 0x90, 0xd2, 0xaf, 0xf8, 0xfd, 0x23, 0x84, 0xd8, 0x54, 0xb3, 0x90,
+  0x4b, 0x4d, 0x0c, 0x0e, 0x7f, 0x1f, 0xb2, 0xb8, 0x68, 0xcf, 0xe4, 0xb4,
+  0xe4, 0xad, 0x35, 0xc5, 0xd6, 0x9b, 0x5d, 0x37, 0x9c, 0x5b, 0x28, 0x19,
+  0x53, 0xe9, 0x2e, 0x8b, 0x07, 0xaf, 0x92, 0x6c, 0x79, 0x29, 0xf6, 0x76,
+  0x07, 0xe3, 0x8b, 0x36, 0x8f, 0xf6, 0xb0, 0xcb, 0xa6, 0x42, 0x94, 0x11,
+  0x01, 0xb7, 0x5a, 0xc7, 0xa1, 0xec, 0x16, 0xab, 0x22, 0xe1, 0xb3, 0xb9,
+  0xff, 0xcc, 0xe3, 0x8b, 0xd2, 0x77, 0x9c, 0x4a, 0x42, 0xf5, 0xbd, 0x86,
+  0x16, 0xc9, 0x47, 0xce, 0x69, 0x6a, 0x72, 0xc6, 0x28, 0x9d, 0xe0, 0x7c,
+  0x0c, 0x11, 0xcf, 0x2d, 0x50, 0x08, 0x1d, 0xa5, 0x2a, 0x5a, 0x24, 0x4e,
+  0xe1, 0x26, 0xf5, 0x54, 0xa6, 0xe3, 0x9f, 0x49, 0xba, 0x9a, 0x3b, 0x75,
+  0x94, 0xc9, 0x9e, 0xfd, 0xe1, 0xd5, 0x15, 0x16, 0x4a, 0x9e, 0xa9, 0x75,
+  0x51, 0xef, 0x12, 0xd9, 0x37, 0x80, 0xb9, 0xa7, 0x3b, 0x9f, 0xe5, 0xc3,
+  0x78, 0xc9, 0xf9, 0xfa, 0xc7, 0x27, 0xa1, 0x3c, 0x9c, 0xd0, 0xd0, 0x0b,
+  0xa8, 0xa2, 0x51, 0xd2, 0x5e, 0x23, 0x9f, 0x34, 0xa0, 0x71, 0x07, 0x46,
+  0x6a, 0x98, 0x37, 0xd7, 0xbf, 0x89, 0x2f, 0xfc, 0x0b, 0x98, 0xb5, 0xf5,
+  0xec, 0x1d, 0xd8, 0x09, 0x59, 0x5b, 0xe6, 0x39, 0x55, 0xa6, 0x28, 0xad,
+  0x7e, 0xb7, 0x3f, 0x62, 0x4e, 0xba, 0xc3, 0x34, 0x93, 0xfa, 0x86, 0xe1,
+  0x3f, 0x12, 0x54, 0xd7, 0x1c, 0xbd, 0xad, 0x99, 0xb0, 0x39, 0x01, 0x1e,
+  0x6a, 0x8d, 0x68, 0xa3, 0x0b, 0xa4, 0xa3, 0x5c, 0xd8, 0x06, 0x5c, 0xe2,
+  0xcd, 0x48, 0xb9, 0xe9, 0x12, 0xe6, 0xca, 0xee, 0x1e, 0xaf, 0x8b, 0x20,
+  0x11, 0xb3, 0x4c, 0x28, 0x95, 0xfc, 0xc4, 0x6e, 0xc7, 0x02, 0x0d, 0xa1,
+  0xab, 0x37, 0x88, 0x17, 0x07, 0x72, 0x29, 0x59, 0xc4, 0x07, 0x79, 0x6d,
+  0xb2, 0x8d, 0x41, 0x42, 0xf3, 0x69, 0x6e, 0x42, 0x65, 0x9e, 0x3d, 0xb9,
+  0xf4, 0x25, 0xc2, 0x46, 0x1f, 0x6c, 0xbd, 0xa1, 0x2a, 0x96, 0x5f, 0xde,
+  0x3f, 0xf9, 0x8d, 0xd5, 0x16, 0x50, 0xe6, 0xfe, 0xee, 0x6e, 0xeb, 0xaf,
+  0xa7, 0x79, 0x8e, 0x53, 0x0f, 0x16, 0x21, 0x13, 0x41, 0x2e, 0xcd, 0x0a,
+  0xac, 0x2b, 0x92, 0x0e, 0x78, 0xff, 0xe8, 0x77, 0xc3, 0xe3, 0x2e, 0xd8,
+  0x8c, 0x5f, 0x20, 0xd2, 0x54, 0xc3, 0x5d, 0x84, 0x8c, 0x98, 0xb4, 0x1f,
+  0xbf, 0xf1, 0x16, 0xe7, 0xba, 0x95, 0xcb, 0x3f, 0xa5, 0x7b, 0x87, 0x39,
+  0xe9, 0x68, 0x19, 0x57, 0xb8, 0x11, 0xb8, 0x26, 0xb3, 0x85, 0x45, 0x0b,
+  0x6c, 0x83, 0xfe, 0x9a, 0x99, 0x32, 0xe2, 0x0d, 0x34, 0x15, 0x62, 0x62,
+  0x28, 0xc4, 0xe7, 0x3c, 0x75, 0xf4, 0x65, 0x0b, 0x37, 0x68, 0xe0, 0x74,
+  0x25, 0x45, 0xa4, 0x5b, 0x5f, 0x08, 0x48, 0x40, 0x2a, 0x34, 0x6f, 0xc9,
+  0xd4, 0x23, 0x24, 0x1a, 0x5a, 0xb7, 0x03, 0x34, 0xa2, 0x8a, 0xd2, 0xf9,
+  0x7c, 0x7b, 0xac, 0xa3, 0x8d, 0xc5, 0x7c, 0x52, 0x97, 0xe1, 0x21, 0xf1,
+  0x4b, 0xb1, 0xd3, 0xcc, 0xc0, 0x24, 0x95, 0x3e, 0xa1, 0x36, 0xae, 0xf8,
+  0xc4, 0x1b, 0xe6, 0x41, 0x38, 0x6c, 0x6c, 0x3c, 0x4d, 0x2c, 0x0e, 0x2b,
+  0xc0, 0xdf, 0xb9, 0x00, 0x9a, 0x46, 0x5c, 0x4b, 0x31, 0xf4, 0x1a, 0x97,
+  0x0a, 0x62, 0xce, 0x08, 0xe1, 0xb5, 0xac, 0xe9, 0xa6, 0x3c, 0x40, 0xc6,
+  0xca, 0xfa, 0x72, 0xb7, 0x92, 0xcd, 0x32, 0x81, 0xd4, 0x81, 0xe9, 0x1b,
+  0x23, 0x4f, 0xdd, 0x9b, 0x7e, 0xbd, 0xee, 0x0c, 0x74, 0xcb, 0x6c, 0x6a,
+  0x1a, 0xee, 0xf0, 0x9b, 0x36, 0xbc, 0xbe, 0x67, 0xe2, 0x81, 0xcc, 0x45,
+  0x3e, 0x6e, 0x32, 0x22, 0xc8, 0x44, 0xe8, 0xfd, 0x8e, 0x39, 0xc4, 0xef,
+  0x2d, 0x13, 0x1a, 0xe8, 0x41, 0x99, 0xed, 0x0e, 0x5d, 0xcc, 0x5b, 0x80,
+  0x35, 0x4e, 0x7e, 0x4f, 0x36, 0x9c, 0x89, 0xb0, 0x3d, 0xa0, 0xfd, 0x0d,
+  0xb8, 0x0c, 0x07, 0x90, 0x27, 0x61, 0xa4, 0x59, 0x82, 0xc3, 0x76, 0x63,
+  0x0d, 0x48, 0x3a, 0xdf, 0xb7, 0x84, 0x30, 0x96, 0x96, 0x71, 0x80, 0x23,
+  0xa0, 0x1b, 0x66, 0xed, 0x80, 0xc7, 0xb8, 0xde, 0x7b, 0xc6, 0x21, 0xa7,
+  0x59, 0x2d, 0x26, 0x97, 0x76, 0x2a, 0x0b, 0x05, 0x50, 0xa3, 0xda, 0x31,
+  0x9b, 0x3d, 0x69, 0x3d, 0x27, 0x30, 0x0c, 0x50, 0xa0, 0x05, 0x9a, 0xad,
+  0xf3, 0xee, 0x5b, 0xd6, 0x78, 0x19, 0x44, 0xff, 0xc2, 0x0e, 0xe0, 0x81,
+  0x6b, 0xbc, 0x54, 0xdf, 0xc5, 0xb8, 0x2a, 0x1c, 0x03, 0xec, 0xc4, 0x5a,
+  0xf4, 0x97, 0xca, 0x00, 0x64, 0x56, 0xcf, 0x8a, 0x1a, 0x9c, 0x7d, 0xe5,
+  0x21, 0x09, 0x4f, 0x3c, 0x96, 0xa7, 0xae, 0xee, 0xae, 0x04, 0x0e, 0x93,
+  0x1a, 0xc9, 0xdb, 0xed, 0x13, 0x24, 0x20, 0xe3, 0xb6, 0x9b, 0x64, 0xb5,
+  0xb1, 0x7c, 0x49, 0xe4, 0x7c, 0x56, 0x68, 0xa5, 0x1a, 0x24, 0x10, 0x14,
+  0xae, 0x64, 0x10, 0x75, 0x1a, 0x67, 0x15, 0x3a, 0x77, 0xc8, 0x1c, 0x4d,
+  0xf3, 0xba, 0x35, 0x0b, 0x1b, 0x19, 0xaf, 0xb8, 0x56, 0x9d, 0x4c, 0xce,
+  0x14, 0x0a, 0xfe, 0x12, 0xba, 0x47, 0x9b, 0x7c, 0x45, 0x05, 0x31, 0xcd,
+  0xa1, 0xfb, 0xad, 0x8d, 0x1f, 0x19, 0x78, 0x80, 0x3a, 0xbc, 0x73, 0xac,
+  0xb8, 0x36, 0xe7, 0x6e, 0xd5, 0xfe, 0x20, 0xda, 0xad, 0xc5, 0x1c, 0xca,
+  0xee, 0x8d, 0x9b, 0x80, 0x52, 0x9a, 0x37, 0xa9, 0xba, 0x0b, 0x56, 0x5a,
+  0x33, 0x3f, 0x92, 0x6b, 0xbe, 0xa9, 0xae, 0xb7, 0xfb, 0x37, 0x34, 0x0e,
+  0xac, 0xff, 0x53, 0x2a, 0x33, 0x66, 0x41, 0x4d, 0x69, 0x57, 0x2c, 0x3c,
+  0x4d, 0xce, 0x49, 0xc3, 0x41, 0x56, 0x7e, 0x4b, 0x05, 0x06, 0xf9, 0x8f,
+  0x20, 0x67, 0xee, 0x59, 0x98, 0x32, 0x52, 0xfb, 0x9f, 0x7f, 0xf7, 0x30,
+  0x9b, 0x26, 0xb1, 0xfe, 0x09, 0x0c, 0xc3, 0xe1, 0xd1, 0x41, 0x51, 0xcb,
+  0x76, 0xd1, 0x93, 0xa0, 0xe2, 0x0b, 0x3c, 0x09, 0xa1, 0x03, 0xd0, 0x0f,
+  0x27, 0xc4, 0x2b, 0x59, 0x58, 0xfa, 0xb9, 0x42, 0xf7, 0x46, 0xe1, 0xfe,
+  0x37, 0x5c, 0xf5, 0xbe, 0x00, 0x4b, 0xc3, 0xf7, 0x79, 0xf6, 0xf1, 0xce,
+  0x6e, 0x98, 0xe4, 0xc8, 0x2d, 0x9d, 0x04, 0x5d, 0x9c, 0xa9, 0xaf, 0xea,
+  0x82, 0x54, 0xac, 0xe1, 0x81, 0x44, 0x20, 0x4e, 0x9e, 0x79, 0x8b, 0x66,
+  0x2d, 0xa5, 0x0e, 0x08, 0x0d, 0xb6, 0xa4, 0xf0, 0xd0, 0x54, 0x9f, 0x91,
+  0xc0, 0xdc, 0x2d, 0xb5, 0x99, 0x55, 0xb3, 0x34, 0x0f, 0x1b, 0x8e, 0xc3,
+  0x68, 0xce, 0xbb, 0xf0, 0x1f, 0x67, 0xe1, 0xba, 0xdd, 0xf1, 0xaf, 0x9f,
+  0xda, 0xed, 0x35, 0xa1, 0xd9, 0xb6, 0x64, 0x6a, 0xcb, 0x37, 0xee, 0xdf,
+  0x26, 0x90, 0x61, 0x99, 0x01, 0xb6, 0x50, 0xa8, 0xf7, 0x8e, 0x9e, 0x49,
+  0x21, 0x2c, 0x55, 0xa3, 0x16, 0x36, 0xb6, 0x10, 0x22, 0xb7, 0x5e, 0x97,
+  0x34, 0xcf, 0x22, 0xf0, 0xff, 0xf2, 0xc4, 0x0d, 0x0b, 0x1b, 0x5f, 0x02,
+  0xb3, 0x96, 0x5d, 0xb0, 0x2e, 0x8e, 0x8f, 0xaa, 0x5c, 0x3f, 0x37, 0x20,
+  0xda, 0x51, 0x9c, 0xcc, 0x05, 0xfe, 0x6f, 0x83, 0xf3, 0x74, 0x17, 0x51,
+  0xce, 0x92, 0x2c, 0x44, 0xa2, 0xf3, 0x8d, 0xf0, 0xec, 0xd8, 0x77, 0xba,
+  0x32, 0x5c, 0xb4, 0x15, 0xe3, 0x18, 0x0d, 0x91, 0x8b, 0x3c, 0xba, 0x9a,
+  0xfd, 0x0f, 0xc2, 0x02, 0xd9, 0xd5, 0xcb, 0xde, 0x39, 0xd6, 0x6b, 0xbc,
+  0x04, 0x25, 0x51, 0xe4, 0x24, 0x50, 0xd8, 0x70, 0xa6, 0x01, 0xe8, 0xe2,
+  0xd2, 0x1f, 0x5a, 0xf6, 0x9b, 0x7b, 0x4e, 0x31, 0xdb, 0xce, 0xd8, 0x31,
+  0x15, 0xe0, 0x4e, 0x6b, 0xdf, 0x80, 0xe4, 0xa4, 0xa1, 0x43, 0xb6, 0x39,
+  0x88, 0x6f, 0xf4, 0xf8, 0x7b, 0xb1, 0xe5, 0x0b, 0x2c, 0x83, 0x17, 0x12,
+  0x82, 0xc3, 0x95, 0x06, 0x4d, 0xe6, 0xd8, 0x23, 0x2b, 0x48, 0xc3, 0x7f,
+  0x92, 0x36, 0xb6, 0x68, 0xee, 0x29, 0xbe, 0x41, 0x1d, 0x65, 0x29, 0x6e,
+  0x92, 0x5c, 0x61, 0xbc, 0x3b, 0x93, 0x0a, 0xf2, 0x0d, 0x95, 0x94, 0x87,
+  0xbe, 0x0d, 0x6d, 0xcf, 0x44, 0xba, 0xe3, 0x64, 0xbf, 0x6a, 0xee, 0xf2,
+  0x60, 0xab, 0x50, 0xe9, 0xe5, 0x94, 0x84, 0xf5, 0x2f, 0xbd, 0x9f, 0x61,
+  0x78, 0x46, 0x80, 0xca, 0xca, 0xc9, 0x3f, 0x0c, 0xf1, 0x8d, 0x79, 0x07,
+  0x65, 0xaf, 0x0c, 0xa9, 0x01, 0x64, 0x34, 0xd3, 0x87, 0xf1, 0xe4, 0x22,
+  0x7b, 0xe2, 0xe5, 0xae, 0x70, 0xa4, 0x75, 0x16, 0x3c, 0x34, 0xd4, 0xac,
+  0x5a, 0xd7, 0xd8, 0xce, 0xc2, 0x64, 0x2b, 0xd2, 0x75, 0x2f, 0x75, 0x36,
+  0x07, 0x1b, 0x85, 0x1b, 0xba, 0x6e, 0x48, 0xef, 0xae, 0x85, 0xc8, 0xd2,
+  0xba, 0xe5, 0x24, 0xf6, 0x2e, 0x49, 0xfe, 0x81, 0x45, 0xf9, 0xf7, 0xab,
+  0x4a, 0x26, 0x15, 0x4a, 0x31, 0xf0, 0x3c, 0x8c, 0x17, 0xe3, 0xfc, 0x0f,
+  0x0d, 0xfb, 0x83, 0x13, 0xe7, 0x6e, 0x8d, 0xfc, 0x5f, 0xff, 0xa2, 0xb0,
+  0xfa, 0x63, 0xff, 0xcc, 0x55, 0x47, 0x50, 0x7b, 0xbc, 0xc3, 0x12, 0xf0,
+  0x0d, 0xe5, 0x31, 0x75, 0x06, 0xbc, 0x4f, 0x5e, 0xee, 0x98, 0xd7, 0x3f,
+  0xd0, 0xf6, 0x84, 0xd3, 0xf1, 0x4c, 0x5d, 0x78, 0xc7, 0x3b, 0x8a, 0xce,
+  0xe1, 0x3b, 0x20, 0x6f, 0xc4, 0xc9, 0xf0, 0x95, 0x3f, 0xbe, 0x8c, 0xf5,
+  0x5e, 0x98, 0x3d, 0x18, 0xe7, 0x70, 0xb6, 0x23, 0x2e, 0x8a, 0xb0, 0xc2,
+  0xe6, 0xcd, 0xa7, 0x67, 0x1c, 0x00, 0x7f, 0x1d, 0x73, 0x6e, 0x59, 0x4c,
+  0xe0, 0xd0, 0xe6, 0x21, 0x52, 0x6c, 0xaa, 0xe5, 0x16, 0x65, 0x9a, 0x06,
+  0xb1, 0x22, 0xbc, 0x11, 0x3d, 0x49, 0x2a, 0x9a, 0xfb, 0x93, 0x75, 0x46,
+  0x0b, 0x5d, 0x70, 0x90, 0x85, 0xf9, 0xea, 0x8d, 0x4b, 0xcb, 0xe9, 0xf8,
+  0x7a, 0x66, 0xb9, 0x9d, 0xc3, 0x3c, 0x8a, 0x44, 0x66, 0x6e, 0xed, 0xc6,
+  0x95, 0xe0, 0x2f, 0xd3, 0xe1, 0x62, 0x17, 0xf4, 0x5d, 0x26, 0x46, 0xb1,
+  0x77, 0x41, 0x97, 0x37, 0x29, 0xce, 0xab, 0xa0, 0x7a, 0xee, 0xc9, 0x00,
+  0x24, 0x0c, 0xfb, 0xc7, 0x8e, 0x89, 0xfa, 0x29, 0xfb, 0xb0, 0x73, 0x44,
+  0x36, 0xc4, 0x39, 0x7f, 0xfc, 0xb2, 0x49, 0xd8, 0x74, 0x97, 0xbe, 0x9e,
+  0x4e, 0x4e, 0xec, 0x06, 0x77, 0xbf, 0xb8, 0x38, 0xea, 0xd7, 0x07, 0x43,
+  0xbd, 0x90, 0x5a, 0x02, 0x61, 0x48, 0x52, 0xf9, 0xb6, 0x21, 0x05, 0x67,
+  0xf3, 0x8c, 0xf5, 0xed, 0x09, 0x36, 0x41, 0x47, 0xb6, 0x79, 0x8d, 0xd6,
+  0x2f, 0x60, 0xe2, 0x39, 0x16, 0x2f, 0xe4, 0xc1, 0x55, 0x55, 0x73, 0x54,
+  0x3a, 0x0d, 0xb1, 0xb3, 0xc7, 0x6d, 0x38, 0x8c, 0x69, 0x7d, 0x5e, 0x28,
+  0x54, 0x90, 0x16, 0x4c, 0x21, 0x3d, 0x24, 0x84, 0x7c, 0x5e, 0xcc, 0xd9,
+  0xe7, 0x73, 0xdf, 0x27, 0xe1, 0x09, 0xcc, 0x1b, 0xa4, 0x43, 0xfb, 0xad,
+  0x69, 0x1b, 0x59, 0xe4, 0x0f, 0xd0, 0xad, 0x67, 0xad, 0xe4, 0xe1, 0xef,
+  0x47, 0xdb, 0x7a, 0xec, 0x75, 0x24, 0x7b, 0xb4, 0x43, 0xb2, 0xb8, 0x75,
+  0x42, 0xf5, 0x16, 0x8e, 0x50, 0x56, 0x29, 0x74, 0x8c, 0x02, 0xa3, 0x96,
+  0xfb, 0x32, 0x61, 0xce, 0x20, 0x29, 0xdd, 0x91, 0xdf, 0xaa, 0x02, 0xde,
+  0x30, 0xc7, 0x14, 0x1a, 0x7c, 0xc0, 0xa5, 0x24, 0x1d, 0xff, 0xf0, 0x98,
+  0x10, 0x9c, 0x15, 0x32, 0xd8, 0x21, 0xf9, 0x48, 0xc8, 0x54, 0xfc, 0x58,
+  0x3d, 0xb3, 0x1e, 0x63, 0x11, 0x8c, 0x57, 0x5a, 0xc0, 0x69, 0xa9, 0xa1,
+  0x89, 0x44, 0x51, 0x64, 0x36, 0x2a, 0x2c, 0x54, 0xd9, 0x90, 0xd2, 0x82,
+  0xfc, 0xe1, 0xe5, 0x15, 0x76, 0x0a, 0xe6, 0x07, 0x31, 0x0b, 0xca, 0x30,
+  0xe3, 0xd8, 0x3f, 0xab, 0xde, 0x44, 0x80, 0xed, 0x31, 0xcd, 0x98, 0x35,
+  0xe3, 0x3e, 0xe8, 0x65, 0x26, 0x12, 0x8a, 0xb3, 0xa4, 0x55, 0xb2, 0x73,
+  0xb1, 0x32, 0x83, 0xec, 0xbd, 0xde, 0xa8, 0x22, 0x77, 0xac, 0x7e, 0x68,
+  0x0b, 0xcd, 0x9b, 0x87, 0xf3, 0xe1, 0xac, 0xe4, 0x37, 0x8e, 0x28, 0x89,
+  0xd7, 0xf9, 0x51, 0x16, 0x8e, 0x84, 0x3f, 0xc8, 0xb3, 0xe0, 0x98, 0xc0,
+  0x28, 0x19, 0xa4, 0xc0, 0x5c, 0x8b, 0xa6, 0xf2, 0x60, 0x35, 0x8c, 0x5b,
+  0x4a, 0xa1, 0xdb, 0xa3, 0xef, 0xd6, 0x5c, 0x35, 0xa9, 0x6d, 0xc2, 0x8c,
+  0x33, 0x2f, 0xe2, 0xa4, 0xef, 0x2a, 0xa2, 0xdc, 0x13, 0xea, 0xbc, 0x0b,
+  0x36, 0x91, 0xa3, 0x89, 0xbb, 0xf9, 0x2e, 0x8c, 0x4e, 0xfd, 0x8c, 0x96,
+  0x78, 0x31, 0xde, 0x43, 0xd5, 0x24, 0x00, 0x4d, 0x10, 0xff, 0x39, 0x55,
+  0x9e, 0xbb, 0x90, 0x8a, 0x6c, 0x1d, 0xea, 0x61, 0xb3, 0xc8, 0x6f, 0xde,
+  0x53, 0xfb, 0xb7, 0x15, 0x68, 0xa5, 0x97, 0x9a, 0xe7, 0x4a, 0x04, 0x8e,
+  0x8c, 0x9d, 0x6c, 0x02, 0x44, 0x74, 0x2e, 0xe5, 0x38, 0xa9, 0xd5, 0x51,
+  0x5c, 0x9f, 0x57, 0xcb, 0xd6, 0xfd, 0xd6, 0xfd, 0x1a, 0x3d, 0xd3, 0x98,
+  0x6f, 0x65, 0x13, 0xea, 0xb5, 0xfd, 0xa9, 0xf6, 0x4d, 0x90, 0xb4, 0x50,
+  0x52, 0xdc, 0x5a, 0x32, 0x23, 0x0b, 0x61, 0x0e, 0x7f, 0x1e, 0x11, 0xf2,
+  0xcd, 0x0d, 0x47, 0xc4, 0x0b, 0xbb, 0x2b, 0xab, 0xac, 0x7d, 0x1e, 0xe9,
+  0xfd, 0x08, 0xfa, 0xa7, 0xe4, 0xdd, 0xa1, 0x8c, 0x4d, 0x0a, 0x17, 0xe2,
+  0x2a, 0xe4, 0x55, 0xd7, 0x75, 0xce, 0x1b, 0x44, 0x24, 0x50, 0x0b, 0xb4,
+  0x95, 0xc7, 0x4c, 0x2b, 0x3c, 0xda, 0xd5, 0xbd, 0x7a, 0x67, 0x05, 0x4d,
+  0x11, 0x4f, 0xde, 0xf7, 0xb5, 0x3b, 0x85, 0x33, 0x46, 0x8a, 0x21, 0xbe,
+  0x82, 0x30, 0x89, 0x2d, 0xdd, 0xad, 0xd5, 0xaf, 0x90, 0x9a, 0x05, 0x3c,
+  0x33, 0x53, 0xa5, 0x7a, 0x7d, 0xbe, 0x1c, 0xd0, 0xda, 0x04, 0xb7, 0x3c,
+  0xab, 0x22, 0xc8, 0x3f, 0x70, 0x1f, 0x3b, 0x6f, 0x90, 0x1f, 0x3b, 0x39,
+  0xc3, 0xfe, 0x5d, 0x54, 0xd2, 0x86, 0x47, 0xe1, 0x24, 0xa4, 0xf7, 0x4e,
+  0xac, 0xec, 0x41, 0xeb, 0x30, 0xab, 0xe3, 0xde, 0xea, 0x5e, 0xe8, 0xd2,
+  0x87, 0x07, 0xcd, 0xfb, 0x7b, 0x09, 0x98, 0xd6, 0x79, 0x7e, 0xa7, 0x16,
+  0x9d, 0x42, 0x18, 0xd3, 0xf7, 0x8a, 0x29, 0x09, 0x4a, 0x03, 0x16, 0x7b,
+  0xa4, 0x37, 0xac, 0x9d, 0xc7, 0x62, 0x52, 0xb8, 0x82, 0x5b, 0x38, 0xee,
+  0x4f, 0xb7, 0x8f, 0x7c, 0x55, 0xe8, 0x52, 0xe9, 0xc9, 0x35, 0xcb, 0x6d,
+  0x7a, 0xae, 0x9e, 0x18, 0x3b, 0x75, 0x54, 0x91, 0x38, 0x14, 0x44, 0x39,
+  0xd5, 0x9a, 0x2a, 0xb1, 0xfc, 0x21, 0xe2, 0x43, 0x5e, 0xa4, 0x18, 0xb0,
+  0x66, 0x47, 0xb9, 0x7a, 0xe1, 0x40, 0xf4, 0x3a, 0x97, 0x4d, 0xb5, 0xcf,
+  0x41, 0x2d, 0x90, 0xf5, 0x22, 0xf0, 0xd6, 0x8c, 0x7d, 0x39, 0x98, 0x61,
+  0x43, 0x4a, 0xf9, 0xe8, 0x1b, 0xfa, 0xf4, 0x57, 0x68, 0x69, 0x4c, 0xa5,
+  0xd0, 0x26, 0x70, 0x5d, 0xe1, 0x55, 0x3b, 0xf0, 0xf9, 0x89, 0x19, 0xa4,
+  0xa1, 0x3d, 0x30, 0x0a, 0xa3, 0x9c, 0xf4, 0xff, 0x13, 0xf8, 0x4d, 0x8f,
+  0x36, 0x58, 0xff, 0x8e, 0xff, 0x38, 0x9c, 0xf5, 0x1c, 0x62, 0x9c, 0xbe,
+  0xa4, 0x3f, 0x5b, 0xa1, 0xc8, 0x5c, 0xb5, 0xb8, 0xa3, 0x33, 0x65, 0x26,
+  0xe8, 0xa2, 0x89, 0xdc, 0x06, 0x65, 0x3d, 0x2b, 0x5b, 0x66, 0xb0, 0x6c,
+  0x52, 0x2c, 0x32, 0x7a, 0xb6, 0x76, 0x82, 0xb5, 0xfc, 0x41, 0x6c, 0x2f,
+  0x6f, 0x43, 0xb3, 0x97, 0xef, 0x14, 0x7c, 0xf0, 0x1c, 0x85, 0xa0, 0xeb,
+  0xfc, 0x36, 0x52, 0x62, 0xf1, 0xf5, 0x6b, 0xbd, 0x49, 0x72, 0x84, 0x23,
+  0x92, 0xab, 0x8d, 0x15, 0xf0, 0x9e, 0xb0, 0xfc, 0xf2, 0x6e, 0xb4, 0x6d,
+  0x71, 0x41, 0x94, 0x10, 0x9b, 0x23, 0x00, 0x8a, 0x87, 0x01, 0x6c, 0x80,
+  0x64, 0x24, 0xf1, 0x35, 0xa4, 0x09, 0x92, 0x38, 0xe5, 0x92, 0xa0, 0x9e,
+  0xfd, 0x2f, 0x9f, 0x6a, 0xfd, 0x92, 0xc3, 0xe2, 0x37, 0x01, 0x11, 0x4d,
+  0xc4, 0x1e, 0x2b, 0x9e, 0xae, 0xb5, 0x33, 0xae, 0x50, 0x90, 0x28, 0xa1,
+  0x34, 0x8b, 0xd2, 0x79, 0x4b, 0x26, 0x39, 0x91, 0x74, 0x46, 0xa7, 0x74,
+  0x25, 0x21, 0x90, 0x91, 0xda, 0xe3, 0xb3, 0xec, 0x8c, 0x4c, 0x6e, 0x27,
+  0x37, 0x19, 0x25, 0xc1, 0x62, 0xf0, 0x81, 0x4e, 0x34, 0x9c, 0x25, 0x91,
+  0x88, 0x74, 0xbf, 0x62, 0x65, 0x51, 0x57, 0xae, 0x9d, 0x29, 0x50, 0x10,
+  0x77, 0xab, 0xb2, 0xbe, 0x78, 0x58, 0x9f, 0xda, 0xf4, 0x71, 0x44, 0xec,
+  0xf3, 0xb9, 0x28, 0xd1, 0xf7, 0x15, 0x79, 0x52, 0x41, 0xdf, 0x4e, 0x0b,
+  0xbb, 0xc7, 0xe6, 0x22, 0x9c, 0x1b, 0x80, 0x74, 0x5f, 0x8d, 0x35, 0xe1,
+  0x67, 0xbf, 0xea, 0x31, 0x5b, 0xc4, 0x39, 0x9c, 0x98, 0x73, 0xc3, 0xdb,
+  0x2b, 0x60, 0x1c, 0x64, 0xe4, 0xd8, 0x56, 0xb4, 0x46, 0x42, 0xbe, 0x37,
+  0xde, 0x34, 0xf3, 0xf6, 0x5a, 0xdd, 0x7b, 0xef, 0x01, 0x00, 0xd4, 0x36,
+  0xed, 0x7f, 0x04, 0x39, 0xe3, 0xd4, 0xb1, 0xf1, 0x46, 0xd5, 0xf9, 0xb2,
+  0xd4, 0xf9, 0x56, 0x35, 0xe2, 0x94, 0xd4, 0xcd, 0x38, 0x44, 0x3b, 0xbe,
+  0x1f, 0xa0, 0x50, 0x60, 0x97, 0xa3, 0x6a, 0xe4, 0x4f, 0xaf, 0x9d, 0x40,
+  0x78, 0x37, 0x72, 0x1a, 0x4b, 0x35, 0xc7, 0xab, 0x21, 0x17, 0x7f, 0x4f,
+  0x67, 0x1f, 0xc0, 0xba, 0x9c, 0x43, 0xc0, 0xe2, 0x90, 0xaf, 0x51, 0x0b,
+  0x09, 0x38, 0x63, 0x59, 0x83, 0x7f, 0x32, 0xb9, 0x6b, 0xe6, 0xef, 0x62,
+  0xa6, 0x12, 0xb4, 0x72, 0x5a, 0x32, 0xa8, 0xc7, 0x06, 0xaa, 0x3c, 0x30,
+  0xfc, 0xdb, 0xdd, 0x61, 0xea, 0x1d, 0x4a, 0x5f, 0xdb, 0x30, 0x26, 0xfd,
+  0xe3, 0xdb, 0x5c, 0xe7, 0x72, 0x8b, 0x8c, 0xb3, 0x5d, 0xa1, 0x9c, 0xc7,
+  0x41, 0x79, 0xa6, 0xbc, 0xb4, 0xd2, 0xde, 0x45, 0xbf, 0x3a, 0x57, 0xc7,
+  0x69, 0xb3, 0x9a, 0xd9, 0x4a, 0xa2, 0x55, 0x73, 0x67, 0xc1, 0x45, 0x17,
+  0xcd, 0xc2, 0xf4, 0xbf, 0x9b, 0xeb, 0xbf, 0x01, 0xbf, 0x28, 0x86, 0x12,
+  0x75, 0x3a, 0x91, 0x1a, 0xcb, 0xd6, 0x46, 0xf4, 0x8a, 0x11, 0x8a, 0x5a,
+  0xd3, 0xc9, 0x5b, 0xd8, 0x42, 0x84, 0xba, 0x11, 0xe1, 0x5b, 0xe6, 0x18,
+  0x81, 0x48, 0x85, 0xfe, 0xd0, 0xf1, 0x5a, 0xbc, 0x14, 0x65, 0xf2, 0x86,
+  0x82, 0x53, 0x04, 0xa7, 0xd2, 0x96, 0x3f, 0x14, 0xc4, 0x63, 0x3d, 0x56,
+  0x06, 0x26, 0x67, 0xe8, 0xf5, 0x0c, 0xcc, 0x68, 0x43, 0xd8, 0xe0, 0x8a,
+  0xe7, 0xe4, 0x9e, 0x90, 0xbc, 0x8b, 0x6a, 0xe5, 0xe2, 0xc0, 0x48, 0x7e,
+  0xcc, 0xac, 0xc2, 0x7a, 0x46, 0x17, 0x00, 0x43, 0x2d, 0xa6, 0xca, 0xb2,
+  0x48, 0xf1, 0x1f, 0x45, 0x6b, 0x18, 0xab, 0x50, 0x22, 0x9c, 0x37, 0xcc,
+  0xf4, 0xed, 0x3a, 0xfb, 0x3e, 0x79, 0x1e, 0xa2, 0x5d, 0x02, 0x67, 0x9b,
+  0xdc, 0xc1, 0x7f, 0xc2, 0xed, 0x08, 0xfa, 0x53, 0x00, 0xa0, 0x52, 0xdf,
+  0x9c, 0xbf, 0xb5, 0x5d, 0x48, 0x51, 0xa6, 0x87, 0x18, 0x64, 0xe5, 0xd1,
+  0xeb, 0x24, 0x11, 0xf0, 0x24, 0x89, 0x1e, 0x76, 0x41, 0x88, 0x64, 0x3f,
+  0xc4, 0xcf, 0x7e, 0xff, 0x1d, 0xb4, 0xdc, 0x31, 0x1f, 0xc0, 0x43, 0x14,
+  0x48, 0xfe, 0x11, 0x46, 0x45, 0xf4, 0xfb, 0xbe, 0x96, 0xf7, 0x1a, 0xaf,
+  0x92, 0x64, 0xaa, 0xf0, 0x17, 0x95, 0xcb, 0xef, 0x4e, 0x1e, 0xb9, 0x0c,
+  0xf4, 0xe5, 0x6c, 0xaf, 0x1f, 0x91, 0xfb, 0x61, 0xf4, 0x2c, 0xf7, 0xcd,
+  0x2a, 0x60, 0xca, 0x28, 0x10, 0x6e, 0xec, 0x13, 0xcb, 0xd1, 0xce, 0x8e,
+  0x28, 0xec, 0xd0, 0x60, 0x02, 0x23, 0x6f, 0xa4, 0x03, 0x8b, 0x59, 0x34,
+  0x1b, 0x3b, 0x20, 0x02, 0x4b, 0x88, 0x29, 0xcf, 0x4e, 0xa7, 0xe9, 0xf2,
+  0x4c, 0x49, 0xe1, 0x49, 0x03, 0x35, 0xfb, 0x9e, 0x8c, 0x8e, 0x68, 0xb7,
+  0xf9, 0xa8, 0x0f, 0x66, 0xc3, 0xc8, 0x6a, 0xd5, 0x77, 0xfc, 0x50, 0xca,
+  0x22, 0x02, 0x4a, 0x73, 0x2c, 0xef, 0x24, 0xd1, 0xba, 0x39, 0xab, 0x20,
+  0x3e, 0x54, 0x8b, 0x79, 0x19, 0x9a, 0x08, 0xf1, 0x33, 0xaf, 0x29, 0x98,
+  0x5d, 0xc8, 0x3b, 0xba, 0x71, 0x8c, 0x3d, 0xb8, 0xe7, 0xc9, 0x80, 0x6e,
+  0x98, 0x52, 0x95, 0xd4, 0xd5, 0x39, 0x56, 0xa0, 0x4a, 0xda, 0x37, 0x29,
+  0xb0, 0xf9, 0x79, 0xc3, 0x19, 0x7e, 0x84, 0xf5, 0xc1, 0x3e, 0x1c, 0x71,
+  0x0f, 0x6a, 0x1d, 0xeb, 0x1b, 0x19, 0x5d, 0xec, 0x55, 0x66, 0x54, 0x08,
+  0x5a, 0x4e, 0xa7, 0xb7, 0xb6, 0x69, 0x98, 0x84, 0xb6, 0x95, 0x89, 0xee,
+  0xce, 0xa9, 0xe9, 0xb5, 0xe9, 0xf3, 0xc7, 0xca, 0x56, 0xb7, 0xc2, 0xaf,
+  0x92, 0x56, 0x33, 0xae, 0x81, 0xd8, 0xb4, 0x1b, 0xf4, 0x1a, 0xba, 0xbc,
+  0x9d, 0x3a, 0x85, 0x0a, 0xf8, 0x22, 0x9c, 0xdf, 0x48, 0x6a, 0x19, 0x71,
+  0x29, 0xd7, 0xe0, 0x84, 0xf4, 0x1f, 0xbc, 0xb0, 0x96, 0xa8, 0x7d, 0x9b,
+  0x36, 0x41, 0x69, 0xa7, 0xbe, 0x3b, 0x8c, 0x4b, 0xb8, 0x99, 0x04, 0xbf,
+  0x54, 0x98, 0xe5, 0xec, 0x25, 0xbe, 0x6c, 0xb8, 0x0a, 0xbc, 0x8d, 0x1d,
+  0x22, 0xf0, 0x67, 0x90, 0xd1, 0xb2, 0x74, 0xe6, 0x98, 0x46, 0xbb, 0xf7,
+  0x1b, 0x94, 0xde, 0xbc, 0x8d, 0xdb, 0x4e, 0xf3, 0x36, 0x6a, 0x11, 0xa0,
+  0x80, 0x5e, 0x09, 0xdc, 0x68, 0x08, 0xd7, 0x5c, 0x64, 0x1c, 0x2f, 0xd9,
+  0x97, 0x39, 0x40, 0xfd, 0x6c, 0x6a, 0xf1, 0x8c, 0xdd, 0x7a, 0xcc, 0x5e,
+  0x31, 0x7d, 0x55, 0xb9, 0x76, 0x3b, 0x93, 0x06, 0xb8, 0x4a, 0x96, 0xcf,
+  0x98, 0x7a, 0xa5, 0x83, 0x39, 0x9a, 0x55, 0x47, 0x08, 0x1a, 0xf1, 0xfa,
+  0x47, 0xed, 0x46, 0x21, 0x89, 0x62, 0x65, 0x1a, 0x71, 0x55, 0x10, 0xba,
+  0xba, 0x69, 0xec, 0xec, 0xf7, 0xea, 0x26, 0x68, 0x9c, 0xc8, 0xb5, 0xb7,
+  0x4c, 0x9b, 0x8a, 0xae, 0x3d, 0xcd, 0x35, 0xc3, 0x6b, 0x45, 0x11, 0x93,
+  0x71, 0xd2, 0x6e, 0x98, 0xb3, 0x40, 0x14, 0x56, 0x81, 0x85, 0xd3, 0xf6,
+  0x21, 0x5a, 0x76, 0x1e, 0x39, 0xa7, 0xbf, 0x59, 0xae, 0xa1, 0xc4, 0xc9,
+  0x26, 0x6a, 0xc2, 0x72, 0x7f, 0x1b, 0x8b, 0x26, 0x1f, 0xc5, 0x6b, 0xbf,
+  0x95, 0x13, 0x15, 0xb4, 0x22, 0xb5, 0xed, 0x39, 0x40, 0xec, 0xcc, 0xa8,
+  0x66, 0xf3, 0xa5, 0x22, 0x28, 0x17, 0x72, 0x81, 0x00, 0x8b, 0x5c, 0x3c,
+  0xe5, 0xa1, 0x0c, 0x38, 0xf0, 0x96, 0x73, 0x08, 0x60, 0x97, 0x73, 0x87,
+  0xf9, 0x65, 0x9d, 0x48, 0x43, 0x8f, 0x20, 0x06, 0x24, 0x3b, 0xd8, 0x07,
+  0x08, 0x34, 0x00, 0x2b, 0xa0, 0x24, 0xd3, 0x8e, 0x67, 0x6d, 0x7d, 0x0a,
+  0x81, 0x42, 0x3f, 0x49, 0x60, 0x95, 0x96, 0x93, 0xe2, 0x3f, 0x8e, 0x35,
+  0x47, 0x43, 0xc1, 0x1f, 0xe7, 0x9d, 0xeb, 0x32, 0x93, 0xb1, 0x79, 0xbc,
+  0x6a, 0x19, 0x90, 0x2e, 0x5d, 0x22, 0x5e, 0xfd, 0x23, 0xc4, 0x10, 0xbc,
+  0xba, 0x62, 0x54, 0x72, 0xb4, 0x0c, 0x78, 0x0f, 0xa3, 0x63, 0xe3, 0x55,
+  0xdc, 0x62, 0xb7, 0x9b, 0x48, 0x55, 0xa5, 0xa2, 0x2f, 0xab, 0x05, 0xb4,
+  0x6d, 0xf5, 0xa7, 0x58, 0x4a, 0xd0, 0x0b, 0xae, 0x7d, 0x05, 0x1a, 0xb9,
+  0xf1, 0xfd, 0xda, 0xe7, 0xbb, 0xef, 0xda, 0x92, 0x9f, 0x44, 0x35, 0x23,
+  0xbf, 0xd8, 0x99, 0xbd, 0xe8, 0x9e, 0x52, 0xfa, 0xf3, 0xee, 0x1b, 0x42,
+  0xb1, 0xdd, 0xe4, 0xbe, 0xb6, 0x71, 0x12, 0xcf, 0xf4, 0x1f, 0xb7, 0x07,
+  0x6f, 0xd7, 0x99, 0x33, 0x32, 0x3c, 0x08, 0x00, 0x31, 0x03, 0xcd, 0x11,
+  0x72, 0xed, 0x02, 0x43, 0x15, 0x6c, 0x84, 0x4b, 0xf5, 0x7f, 0x7a, 0x03,
+  0x33, 0x94, 0xc8, 0xd1, 0xe8, 0xe0, 0x82, 0x73, 0xe9, 0x91, 0xb1, 0x2f,
+  0xb1, 0xc8, 0x6f, 0xb2, 0x2b, 0x17, 0x69, 0x99, 0x00, 0x5c, 0x36, 0x75,
+  0x85, 0xf8, 0x85, 0x9d, 0xe3, 0xf0, 0x8d, 0x58, 0x1a, 0x9e, 0x0e, 0xcc,
+  0x2e, 0xc4, 0x70, 0x11, 0x49, 0x2d, 0xcf, 0xa0, 0x3f, 0x5a, 0x8f, 0x4c,
+  0xa1, 0x2e, 0x22, 0x3a, 0x3b, 0x55, 0x5b, 0xe0, 0xdd, 0xfd, 0x3d, 0xca,
+  0x82, 0x1d, 0x4d, 0x58, 0x16, 0x47, 0xb5, 0x08, 0x8d, 0x10, 0x22, 0x84,
+  0x94, 0x1f, 0x10, 0xad, 0x3b, 0x7f, 0x4c, 0xa5, 0x46, 0x56, 0x63, 0xcc,
+  0xab, 0xae, 0x3a, 0xd4, 0xae, 0x10, 0xbd, 0xc1, 0x47, 0xda, 0xd9, 0xcc,
+  0x33, 0x5b, 0x8d, 0x4b, 0x01, 0x51, 0xfd, 0x65, 0x76, 0x86, 0x06, 0x60,
+  0x18, 0x3a, 0x73, 0x56, 0xfe, 0x24, 0xa5, 0x15, 0xd6, 0xe1, 0xa5, 0xe5,
+  0x55, 0x90, 0x92, 0x48, 0x38, 0xc0, 0xfe, 0x9e, 0xf4, 0x9e, 0xa9, 0x6c,
+  0xf6, 0xef, 0x5f, 0x12, 0xc3, 0x95, 0x03, 0x21, 0xa8, 0x4d, 0x42, 0xd0,
+  0x64, 0xf4, 0xb6, 0xa8, 0x49, 0xcf, 0xb3, 0x5c, 0xe3, 0xf4, 0x4a, 0xab,
+  0x55, 0xe9, 0x1c, 0x0d, 0x0b, 0x03, 0x9f, 0xb8, 0x99, 0xd4, 0x56, 0xc5,
+  0x77, 0x9e, 0xac, 0xd4, 0xd8, 0x44, 0x2b, 0xe0, 0x4e, 0xbc, 0x61, 0x0a,
+  0x76, 0xb6, 0x4b, 0xaf, 0x01, 0x4f, 0x8c, 0x10, 0xc0, 0xe2, 0xea, 0xc5,
+  0x25, 0xa2, 0xda, 0xdd, 0x54, 0x37, 0x75, 0x77, 0xef, 0x2b, 0xb1, 0x23,
+  0xb2, 0x82, 0xd8, 0x8d, 0x9d, 0xe9, 0x03, 0xeb, 0x85, 0xfe, 0x13, 0x1c,
+  0x05, 0x75, 0x99, 0x04, 0xb8, 0x99, 0x5e, 0x37, 0x19, 0xc1, 0x20, 0x02,
+  0xaf, 0x3e, 0xfa, 0xd7, 0xf9, 0xc9, 0xfe, 0x42, 0x63, 0x25, 0x90, 0xf1,
+  0xb4, 0x86, 0x7b, 0xd3, 0x14, 0xad, 0x5e, 0x02, 0x9f, 0xb2, 0x99, 0xff,
+  0xee, 0x92, 0x73, 0xb9, 0x4c, 0xee, 0x97, 0xfc, 0xd8, 0xe7, 0xaf, 0x04,
+  0xed, 0x87, 0xa4, 0x40, 0xca, 0x31, 0x32, 0x37, 0x68, 0x09, 0x79, 0xb4,
+  0xf6, 0xbf, 0xb8, 0xd1, 0x33, 0x5e, 0xa1, 0x8e, 0x4a, 0x78, 0xd4, 0x02,
+  0x52, 0x43, 0x2f, 0x33, 0x8c, 0xa3, 0xc9, 0x0b, 0xfc, 0xe5, 0xfa, 0xcb,
+  0xa2, 0x79, 0x39, 0x95, 0x50, 0xaa, 0x7c, 0x3f, 0xa8, 0x2e, 0xa4, 0x2b,
+  0x11, 0x11, 0x0d, 0x13, 0x16, 0x23, 0xe3, 0x07, 0xe5, 0xab, 0x60, 0x31,
+  0xa9, 0xed, 0x52, 0x40, 0xb1, 0xfd, 0x61, 0x20, 0xad, 0xd9, 0xaa, 0x34,
+  0x2a, 0x37, 0x7a, 0x30, 0xe5, 0xcb, 0xac, 0xbc, 0x7e, 0xd7, 0xa0, 0xc7,
+  0x24, 0xcc, 0x10, 0x13, 0xd7, 0x28, 0x94, 0xea, 0x15, 0xcb, 0xc5, 0xb3,
+  0x9e, 0x4d, 0xe1, 0x3d, 0x03, 0x66, 0xbb, 0xc6, 0x9d, 0x87, 0xfc, 0xa5,
+  0xce, 0x5e, 0xe0, 0x4c, 0xe5, 0xe4, 0xfc, 0xfb, 0xd0, 0x1f, 0x2a, 0xdd,
+  0x65, 0x52, 0xf9, 0xf5, 0x3f, 0xce, 0xe2, 0x92, 0xd9, 0xfc, 0x21, 0xe6,
+  0xa5, 0xea, 0x95, 0x03, 0x74, 0x64, 0xc7, 0x10, 0xa8, 0x1f, 0x8a, 0x38,
+  0x80, 0x90, 0xba, 0x83, 0x6f, 0x8e, 0x68, 0x5a, 0xe8, 0xbd, 0x90, 0x03,
+  0xe1, 0xc9, 0x4d, 0xb4, 0xa2, 0x90, 0xa7, 0xbc, 0x88, 0x92, 0x20, 0x21,
+  0x14, 0x4b, 0xbf, 0x81, 0x7d, 0x42, 0x52, 0x2e, 0x00, 0xaa, 0x90, 0x45,
+  0x87, 0x07, 0x55, 0x23, 0x3c, 0x07, 0x42, 0x54, 0xfe, 0xdb, 0xb0, 0x74,
+  0x15, 0x60, 0x0a, 0xdd, 0xe6, 0x87, 0x94, 0x9a, 0x1d, 0x73, 0x0c, 0x30,
+  0xcf, 0xb9, 0x4b, 0x4f, 0x99, 0xf4, 0xbc, 0x75, 0xbd, 0x16, 0xae, 0x09,
+  0xbe, 0xc8, 0x56, 0xeb, 0x61, 0xf5, 0x6d, 0xb2, 0xfc, 0x29, 0x9b, 0xd0,
+  0x55, 0xf6, 0xad, 0xe9, 0x04, 0xb0, 0x71, 0x16, 0x04, 0xb4, 0x98, 0x19,
+  0x1b, 0xd6, 0x29, 0x6b, 0xce, 0xe2, 0x1c, 0xf8, 0x42, 0x84, 0x12, 0xab,
+  0xb2, 0xa6, 0xa1, 0x72, 0xd7, 0xae, 0xfd, 0x65, 0x5f, 0xa3, 0xa9, 0xda,
+  0x17, 0xb2, 0xc6, 0x40, 0xe7, 0x27, 0xb9, 0x3e, 0xd6, 0x65, 0x8b, 0xe9,
+  0xf7, 0x25, 0x3e, 0x84, 0x76, 0x24, 0xc1, 0x06, 0xf9, 0x77, 0x9f, 0x6b,
+  0xea, 0xe7, 0xdc, 0x11, 0x21, 0x0d, 0x35, 0xf0, 0xe0, 0x0d, 0x5e, 0x02,
+  0x5d, 0x73, 0x22, 0xf8, 0xc9, 0x12, 0x26, 0x6b, 0xf9, 0xc9, 0x9f, 0x72,
+  0x0c, 0xd3, 0xe8, 0x95, 0x69, 0x79, 0x00, 0xe7, 0x67, 0xc6, 0xa2, 0xce,
+  0xc5, 0x08, 0x96, 0x9a, 0xf1, 0x91, 0x2f, 0x52, 0x2e, 0x1a, 0x21, 0x0d,
+  0xe4, 0x7e, 0x43, 0x0b, 0xb2, 0x22, 0x83, 0x4c, 0x7f, 0xf8, 0xb6, 0xa5,
+  0x13, 0x99, 0x35, 0x5f, 0x7d, 0xe3, 0x9a, 0x94, 0xa8, 0xcb, 0x7b, 0x7b,
+  0xeb, 0xd2, 0xad, 0xe1, 0x32, 0x45, 0xac, 0xb7, 0xf9, 0x42, 0xe3, 0xe7,
+  0x61, 0xab, 0xfe, 0x16, 0xad, 0xee, 0x2e, 0x82, 0x7a, 0x62, 0xef, 0x3d,
+  0x2b, 0x78, 0x3c, 0x9a, 0x49, 0x04, 0x56, 0xcb, 0x15, 0x6d, 0x86, 0x7f,
+  0xef, 0x2f, 0x51, 0x28, 0x8b, 0x45, 0x8a, 0x97, 0xa3, 0x9d, 0x16, 0x96,
+  0x1f, 0xfc, 0x14, 0x1f, 0x9f, 0xb7, 0xb0, 0xe0, 0xce, 0x8f, 0x78, 0x00,
+  0x6c, 0x30, 0xcb, 0x36, 0xfa, 0x05, 0x0d, 0xf0, 0x46, 0xa8, 0x3f, 0x4b,
+  0x00, 0xec, 0xf3, 0xbf, 0x93, 0xe0, 0x15, 0x90, 0x68, 0x64, 0x18, 0xd9,
+  0x58, 0xfa, 0x3a, 0x9e, 0x57, 0x02, 0xe5, 0x4b, 0xe8, 0xcf, 0xe1, 0xee,
+  0xf8, 0x4e, 0x32, 0xf5, 0x39, 0x8c, 0x93, 0x69, 0x55, 0x7b, 0xb9, 0xdc,
+  0x65, 0xba, 0xe9, 0x22, 0x72, 0x0c, 0xd5, 0x94, 0x2f, 0x28, 0x3b, 0x09,
+  0x7d, 0x40, 0x02, 0x5b, 0xe7, 0xa9, 0x5b, 0xa6, 0x8f, 0x38, 0x31, 0x4c,
+  0xae, 0xcd, 0x77, 0x79, 0xcc, 0x1e, 0x2d, 0x46, 0x95, 0xad, 0x8c, 0x81,
+  0xa5, 0x31, 0x86, 0x59, 0xaa, 0xd8, 0xb4, 0x66, 0x08, 0x32, 0x88, 0x64,
+  0xe0, 0x4f, 0x81, 0xb1, 0x89, 0xd8, 0xeb, 0xb0, 0x3f, 0xaa, 0x4b, 0xb7,
+  0x23, 0x1c, 0xa8, 0xd4, 0xf5, 0xe1, 0x25, 0x8e, 0x8e, 0x88, 0x47, 0xa2,
+  0xa9, 0x4d, 0xc8, 0x47, 0x42, 0x7d, 0x1b, 0xf6, 0x5f, 0x11, 0xca, 0x04,
+  0x3c, 0xbe, 0x61, 0x0d, 0x95, 0x7b, 0xa0, 0xc3, 0xf3, 0x2e, 0xa7, 0xcf,
+  0xf2, 0x8e, 0x78, 0x0b, 0x05, 0xa4, 0x66, 0x37, 0x8c, 0x38, 0xab, 0x97,
+  0x97, 0x19, 0xe0, 0xb6, 0x38, 0x81, 0x6d, 0xc9, 0xa9, 0x92, 0xb9, 0x56,
+  0x31, 0x59, 0xe3, 0xec, 0xff, 0xda, 0x20, 0x98, 0x69, 0xcf, 0xb3, 0xc5,
+  0xbd, 0xba, 0x82, 0x12, 0x97, 0x45, 0xd1, 0x17, 0x1d, 0x75, 0x99, 0x78,
+  0x80, 0x96, 0x12, 0xbc, 0x82, 0xb3, 0xaf, 0xad, 0x21, 0x95, 0x98, 0x78,
+  0xb3, 0xbe, 0xf3, 0x73, 0xb1, 0x10, 0xf8, 0x16, 0xa2, 0x4f, 0x46, 0x8e,
+  0xda, 0xae, 0xd8, 0x21, 0xd6, 0xc6, 0xda, 0xdf, 0xbf, 0x9a, 0x87, 0x9a,
+  0xba, 0x99, 0x08, 0x0d, 0x5c, 0x50, 0xf9, 0xc7, 0x7a, 0x48, 0xf6, 0xe1,
+  0x83, 0x1b, 0x38, 0x4f, 0x6d, 0x23, 0xa1, 0xc7, 0x98, 0xce, 0x84, 0x8d,
+  0xa3, 0x7a, 0x9c, 0xca, 0x3f, 0x16, 0x3b, 0x37, 0xc9, 0xeb, 0xe0, 0xa1,
+  0xc6, 0x4f, 0xde, 0x56, 0xf3, 0x2f, 0xd1, 0x44, 0x81, 0x52, 0x8b, 0xe3,
+  0x66, 0xfb, 0x67, 0x38, 0xe4, 0x34, 0xcb, 0x2f, 0x12, 0x60, 0xaa, 0x00,
+  0x1b, 0xea, 0x7b, 0xa3, 0xc0, 0x19, 0xdb, 0x57, 0x7c, 0x6a, 0xce, 0x40,
+  0xbe, 0x13, 0xb1, 0x9c, 0x01, 0x7f, 0x47, 0x9d, 0x84, 0xef, 0xb7, 0x56,
+  0x89, 0x36, 0xe8, 0xd0, 0x20, 0xf1, 0x1e, 0xbd, 0x7c, 0x0f, 0xe1, 0xa2,
+  0xbb, 0xb2, 0xa9, 0xee, 0x57, 0xa0, 0xab, 0x16, 0xf9, 0x4a, 0x55, 0x60,
+  0x2c, 0xd1, 0x82, 0xcf, 0xcb, 0xd0, 0xe6, 0xd7, 0x01, 0x80, 0xac, 0x54,
+  0xf8, 0x57, 0xae, 0x28, 0x0d, 0x45, 0x9f, 0xf4, 0x68, 0x6d, 0x54, 0xf9,
+  0x95, 0xf8, 0x8d, 0xc8, 0xac, 0x56, 0x6d, 0x5e, 0xd4, 0x76, 0xee, 0xa8,
+  0x82, 0x7a, 0x08, 0xd5, 0x80, 0x82, 0x29, 0xee, 0x06, 0x48, 0x03, 0x05,
+  0x9f, 0x1e, 0x2e, 0x32, 0x61, 0x0e, 0x6d, 0x43, 0x3d, 0xf3, 0x79, 0x45,
+  0x75, 0x53, 0x2f, 0x8f, 0x83, 0xa6, 0xcf, 0x46, 0xa9, 0xd1, 0x72, 0x41,
+  0xfc, 0x27, 0x18, 0x73, 0x38, 0x22, 0xc6, 0x65, 0x80, 0xbc, 0x72, 0x9a,
+  0xab, 0x40, 0x34, 0x23, 0x87, 0x82, 0x3d, 0xfd, 0xd4, 0xa9, 0x4f, 0x2d,
+  0xd7, 0x6a, 0x0c, 0x1f, 0x81, 0x65, 0x9e, 0x96, 0x52, 0x81, 0xb0, 0xed,
+  0x05, 0xf9, 0xf3, 0x95, 0x61, 0x72, 0x74, 0xe3, 0xa8, 0x09, 0x27, 0x6c,
+  0x13, 0x2b, 0x2f, 0x4f, 0x67, 0x59, 0x66, 0x70, 0x1b, 0x4b, 0x0f, 0x3a,
+  0x14, 0x05, 0xce, 0xc9, 0x98, 0x1d, 0x02, 0x18, 0x7e, 0xeb, 0xcf, 0xb0,
+  0x63, 0xf2, 0x8d, 0x4b, 0xa1, 0xeb, 0x29, 0x64, 0xc3, 0x5f, 0xe5, 0xdf,
+  0xca, 0x2f, 0x7d, 0x9b, 0x36, 0xef, 0x87, 0x96, 0xf2, 0x5e, 0x32, 0x7d,
+  0x6c, 0x4c, 0xd2, 0xf5, 0x34, 0x28, 0xe6, 0xf1, 0x80, 0xcf, 0x75, 0xea,
+  0x08, 0x47, 0x01, 0xb9, 0x98, 0xd1, 0x4f, 0x2f, 0x09, 0xeb, 0xa1, 0xc1,
+  0x1d, 0x03, 0x83, 0x91, 0x45, 0x00, 0x19, 0x33, 0x34, 0xb7, 0x2b, 0xce,
+  0xea, 0x64, 0xb3, 0xe0, 0x43, 0x89, 0x59, 0x0c, 0x2c, 0x1a, 0x85, 0x57,
+  0xf5, 0x3a, 0x44, 0x34, 0x8d, 0x88, 0x79, 0x63, 0xeb, 0x98, 0x3d, 0x98,
+  0xc4, 0xd6, 0x69, 0xd2, 0x4c, 0x0c, 0xc7, 0x55, 0xa6, 0xa6, 0xa7, 0x93,
+  0x82, 0xa4, 0x0a, 0xee, 0x5a, 0x33, 0xd6, 0x93, 0xcf, 0x5a, 0xe6, 0x40,
+  0x46, 0x16, 0x61, 0xb1, 0xdf, 0x82, 0x20, 0x33, 0xae, 0x1e, 0x1c, 0xe8,
+  0x5e, 0xdc, 0xbb, 0x4f, 0xed, 0x94, 0x27, 0xd7, 0x08, 0xfe, 0xa2, 0x15,
+  0xa4, 0x22, 0x3a, 0xc8, 0x82, 0x40, 0x87, 0x65, 0x6e, 0x53, 0x5a, 0x9a,
+  0x07, 0x31, 0x43, 0xb4, 0x42, 0xbc, 0x1f, 0xc8, 0xd7, 0xc6, 0x89, 0xc1,
+  0x2b, 0x00, 0x1a, 0x66, 0x5a, 0xc0, 0x4e, 0xfc, 0x48, 0xf2, 0x64, 0x61,
+  0x99, 0x32, 0xf4, 0x62, 0xd6, 0x20, 0x80, 0x57, 0x14, 0xaf, 0x99, 0x4d,
+  0x47, 0x8e, 0xac, 0x53, 0x39, 0x16, 0xf6, 0xe7, 0x6f, 0x29, 0x86, 0x62,
+  0x67, 0x36, 0xa1, 0x6e, 0xce, 0x14, 0x2a, 0x6b, 0xf6, 0xe7, 0x0f, 0x4b,
+  0xc1, 0x88, 0x07, 0xfe, 0x66, 0x2e, 0xe1, 0x78, 0xdf, 0x67, 0x71, 0xc2,
+  0x5b, 0xfa, 0x0b, 0x19, 0xfa, 0x4f, 0xe2, 0x33, 0x34, 0x42, 0x91, 0xbd,
+  0x17, 0xd6, 0x15, 0x02, 0x66, 0xfe, 0xb1, 0x62, 0xe9, 0xbc, 0x6d, 0x11,
+  0x68, 0x87, 0x9d, 0xfb, 0x09, 0x42, 0x6e, 0xf8, 0x16, 0x77, 0x62, 0xe2,
+  0x7b, 0x4a, 0xa5, 0xcf, 0x17, 0x8c, 0x46, 0x55, 0x28, 0x95, 0x9c, 0x27,
+  0x13, 0xac, 0xf5, 0x62, 0x66, 0x83, 0xfa, 0xa8, 0x94, 0x96, 0x43, 0x34,
+  0x6b, 0x4e, 0x10, 0x2b, 0x61, 0x0d, 0x03, 0x2d, 0x85, 0x32, 0xa0, 0x6f,
+  0xef, 0x80, 0x4c, 0x5f, 0x67, 0x32, 0x8a, 0xf1, 0xc0, 0x64, 0xf0, 0x15,
+  0xb0, 0x24, 0xc5, 0x99, 0x09, 0xd1, 0x85, 0xc1, 0x88, 0x01, 0x73, 0xf6,
+  0x8f, 0xe6, 0xff, 0x00, 0x8d, 0x77, 0xed, 0xe8, 0x1a, 0xb7, 0x14, 0xdd,
+  0x35, 0x99, 0x1b, 0x21, 0x5e, 0xbb, 0x97, 0xe9, 0x56, 0x71, 0x2c, 0x19,
+  0xde, 0xf4, 0x9b, 0x4a, 0x68, 0x41, 0x98, 0x01, 0x9e, 0x78, 0x1c, 0xce,
+  0x11, 0x2d, 0x60, 0x38, 0x5b, 0xeb, 0x5e, 0x04, 0xb9, 0x37, 0xd9, 0x49,
+  0x80, 0xfe, 0x37, 0xeb, 0x7a, 0xff, 0x2d, 0x60, 0x7a, 0xc3, 0x3b, 0x34,
+  0x62, 0x7e, 0x9a, 0x37, 0x28, 0x5a, 0x32, 0x89, 0x88, 0x81, 0x2e, 0xe4,
+  0xae, 0x97, 0x05, 0x71, 0x32, 0xde, 0x8b, 0xc9, 0x91, 0xef, 0x14, 0x87,
+  0x91, 0x26, 0x99, 0xe5, 0x47, 0x9d, 0x61, 0x30, 0x14, 0xd8, 0x7c, 0xad,
+  0x6b, 0x1f, 0x9d, 0x09, 0xe5, 0xb7, 0x90, 0x0f, 0x2f, 0x3b, 0xa2, 0xa2,
+  0x02, 0x62, 0x70, 0x1e, 0x74, 0xb9, 0xb0, 0xcc, 0xc1, 0x96, 0xfc, 0x6a,
+  0x8d, 0xfd, 0x86, 0x08, 0x27, 0x9a, 0x48, 0xf5, 0x8e, 0x6a, 0x71, 0x28,
+  0x88, 0xb4, 0x46, 0xf0, 0x5e, 0x17, 0xd0, 0xa8, 0xc8, 0x85, 0x47, 0xbc,
+  0x9a, 0x29, 0x53, 0x67, 0x13, 0x7c, 0x80, 0xf8, 0xdb, 0x57, 0x30, 0x24,
+  0x0a, 0x62, 0x0e, 0x6f, 0xdf, 0xf7, 0x01, 0x15, 0xd6, 0x4c, 0xf2, 0xca,
+  0xd7, 0xac, 0x06, 0x0a, 0x8a, 0xe5, 0x3a, 0x68, 0x12, 0xbc, 0x14, 0x2e,
+  0x71, 0xe7, 0xc4, 0xa1, 0xf1, 0x70, 0x0c, 0xed, 0xb4, 0xdc, 0x84, 0x93,
+  0x1b, 0x59, 0xd7, 0x97, 0x6a, 0x09, 0xeb, 0x75, 0xec, 0xcd, 0xd2, 0x39,
+  0xc0, 0x4b, 0x68, 0x14, 0x63, 0xfe, 0x0d, 0xb8, 0x9e, 0xe6, 0x0f, 0xdb,
+  0x0a, 0xe7, 0xe6, 0xb2, 0x36, 0xaa, 0xd2, 0x11, 0x3f, 0xa6, 0x97, 0x30,
+  0x64, 0xd5, 0x03, 0x39, 0x82, 0x47, 0xda, 0x32, 0x0c, 0x75, 0xa0, 0x90,
+  0xff, 0xc0, 0x7a, 0x66, 0x73, 0x1a, 0x0a, 0x4d, 0xc6, 0x72, 0x90, 0x74,
+  0x0f, 0x52, 0xb5, 0x10, 0x73, 0x56, 0xe8, 0x26, 0xf7, 0x93, 0x36, 0xdf,
+  0x52, 0x3c, 0x88, 0x9f, 0xd7, 0x38, 0x43, 0xf2, 0x68, 0x71, 0xb4, 0x93,
+  0x3f, 0xc7, 0x19, 0x27, 0x96, 0x2a, 0x8c, 0x6c, 0x88, 0x97, 0xb2, 0x51,
+  0x74, 0x5b, 0x46, 0x67, 0xfb, 0x54, 0xf8, 0xe9, 0x6a, 0x12, 0x03, 0xa8,
+  0x23, 0x49, 0x45, 0xb3, 0x4e, 0x42, 0xd2, 0xd0, 0xe9, 0x56, 0x8b, 0xf0,
+  0x4f, 0xdc, 0xf6, 0xdc, 0x71, 0x05, 0x62, 0x7f, 0x51, 0xbc, 0x52, 0xeb,
+  0xcb, 0x59, 0xfe, 0x37, 0xc8, 0x9a, 0xe7, 0x20, 0x16, 0x50, 0x8f, 0x27,
+  0x9d, 0x19, 0x41, 0x30, 0xd5, 0x94, 0xc8, 0xe0, 0x5d, 0x4e, 0x8e, 0xb1,
+  0x10, 0x4a, 0xcf, 0xc5, 0x73, 0x95, 0x07, 0xdd, 0xc5, 0x4a, 0xe7, 0xd3,
+  0xd4, 0xa8, 0x1f, 0x65, 0xde, 0x90, 0x87, 0x97, 0x14, 0xcd, 0xcf, 0xe1,
+  0x76, 0x8f, 0x42, 0xa6, 0x75, 0x4f, 0x78, 0x21, 0x3e, 0x6e, 0xcb, 0x7b,
+  0x13, 0xf8, 0xa6, 0x1e, 0x02, 0xd7, 0xe9, 0x5d, 0xf7, 0xec, 0xed, 0xa9,
+  0x12, 0x50, 0xda, 0xc3, 0x54, 0x12, 0x4a, 0x2e, 0xdd, 0x68, 0x86, 0xd2,
+  0xfd, 0x89, 0x15, 0x3b, 0x41, 0x4f, 0xd6, 0x7e, 0x99, 0xc9, 0xa9, 0x11,
+  0x8a, 0x00, 0x00, 0x69, 0xbd, 0xd2, 0x30, 0x97, 0xc8, 0x52, 0x43, 0xf8,
+  0x77, 0x62, 0xfa, 0x59, 0xb5, 0x14, 0x4f, 0x41, 0x81, 0xfd, 0x8f, 0x05,
+  0x69, 0x86, 0xa8, 0xe0, 0xd9, 0xb0, 0x83, 0x30, 0xae, 0x5e, 0x51, 0xd0,
+  0x4c, 0x37, 0x18, 0xd4, 0x6a, 0x00, 0x51, 0xb1, 0x07, 0x38, 0xc9, 0xaa,
+  0x11, 0x24, 0x3d, 0xd5, 0x4c, 0xb4, 0x85, 0xec, 0x78, 0xcc, 0xd1, 0x04,
+  0x81, 0xa2, 0xb3, 0x94, 0x16, 0xfa, 0x16, 0xd4, 0xb4, 0xf4, 0x28, 0xaf,
+  0x9e, 0xa7, 0x80, 0x6c, 0x2a, 0x08, 0x60, 0xc5, 0x5e, 0xbd, 0x5e, 0x62,
+  0x9a, 0x0d, 0x17, 0x66, 0x9b, 0xec, 0xa7, 0xa9, 0x2d, 0x3f, 0x7c, 0x69,
+  0x1e, 0xe7, 0xdb, 0x0f, 0x4c, 0x80, 0x82, 0x1e, 0x13, 0x2e, 0xf1, 0x1f,
+  0x77, 0x48, 0x97, 0x32, 0x49, 0xa3, 0xa4, 0x66, 0xb5, 0x25, 0xc0, 0x08,
+  0x4b, 0x36, 0x15, 0xc3, 0xdd, 0xd4, 0xa2, 0x3f, 0xdd, 0xd1, 0x4b, 0xa4,
+  0xc3, 0x18, 0xbb, 0xee, 0x13, 0x11, 0xbd, 0xf8, 0xd1, 0x82, 0x95, 0xc1,
+  0xc3, 0x3d, 0x7b, 0xe1, 0xe7, 0x36, 0x27, 0xa4, 0x56, 0xfd, 0x82, 0x61,
+  0x4f, 0xe7, 0x91, 0xe8, 0x9d, 0xaf, 0x95, 0xa9, 0xeb, 0xd7, 0x42, 0x4e,
+  0xf6, 0xf5, 0x5c, 0xa5, 0xe7, 0x89, 0x81, 0x57, 0x7a, 0x26, 0x3d, 0x45,
+  0xde, 0xe5, 0xa1, 0xf6, 0x1e, 0x83, 0xc5, 0x4f, 0xa1, 0xfe, 0x7f, 0xc8,
+  0xf1, 0xaf, 0x9d, 0xad, 0x5a, 0x42, 0x28, 0x1b, 0x36, 0x20, 0xd4, 0xa7,
+  0xd2, 0x27, 0x22, 0x39, 0x99, 0x90, 0x78, 0x86, 0x3b, 0xa6, 0xe0, 0xe4,
+  0xe9, 0xad, 0x8e, 0x7a, 0x57, 0xd5, 0xda, 0xcb, 0xd3, 0x57, 0xbb, 0x56,
+  0xd5, 0xdd, 0x2f, 0x7c, 0xea, 0xe0, 0xad, 0x75, 0x1b, 0x78, 0x75, 0x67,
+  0x22, 0x5c, 0x04, 0x68, 0xd2, 0x5b, 0x1c, 0x2a, 0xf6, 0xae, 0x72, 0xda,
+  0xd7, 0xe9, 0xc6, 0x29, 0x3b, 0x83, 0x11, 0x41, 0xe9, 0xdf, 0xc5, 0x51,
+  0xf1, 0x74, 0x6b, 0xe7, 0x9e, 0x73, 0xfc, 0x48, 0x7e, 0x8a, 0xf4, 0x5c,
+  0x07, 0x7b, 0x01, 0xd8, 0x6a, 0x0f, 0x83, 0x7d, 0xc1, 0xd1, 0xfa, 0x91,
+  0xad, 0xfa, 0xb3, 0x8b, 0xda, 0xab, 0x01, 0xf2, 0xd2, 0x28, 0xba, 0xc2,
+  0x49, 0x22, 0x24, 0xcc, 0xe3, 0xd9, 0xa8, 0xb1, 0xd7, 0x9c, 0xc4, 0x44,
+  0x13, 0x8e, 0xb0, 0x5e, 0x7d, 0xd8, 0x89, 0x8b, 0x69, 0xa5, 0xd9, 0xe9,
+  0xd2, 0x9e, 0xb6, 0xbb, 0xb7, 0xa3, 0x56, 0xa7, 0x2c, 0xda, 0xf1, 0x3a,
+  0xf9, 0xee, 0x61, 0x1c, 0x78, 0x33, 0x4b, 0xab, 0x4b, 0x48, 0x2c, 0xad,
+  0xfe, 0x6e, 0xc3, 0x1b, 0x3f, 0x73, 0x8c, 0x81, 0xc0, 0x21, 0x11, 0x8d,
+  0xe1, 0xf8, 0xc0, 0x3b, 0x91, 0x52, 0x2b, 0x3e, 0xe5, 0x5d, 0xea, 0x02,
+  0x4d, 0xaf, 0x6c, 0xd8, 0xa3, 0x8d, 0xad, 0x9d, 0x38, 0x44, 0xbd, 0x2b,
+  0xe8, 0x56, 0x38, 0x38, 0xe5, 0xb8, 0x0e, 0xea, 0x8e, 0x82, 0x1f, 0x40,
+  0x6b, 0xa7, 0xae, 0xdb, 0xbf, 0xd1, 0x95, 0x7a, 0xc1, 0xcd, 0xbb, 0x3e,
+  0x84, 0xc1, 0x68, 0x76, 0x16, 0x7f, 0x2d, 0xad, 0xee, 0xca, 0x12, 0x85,
+  0xba, 0xc2, 0xa0, 0xea, 0x5b, 0x67, 0x49, 0x2a, 0xb9, 0x89, 0x1d, 0x61,
+  0xf1, 0x5f, 0x81, 0x03, 0x65, 0xd4, 0x56, 0xe3, 0x24, 0x15, 0x54, 0x59,
+  0x21, 0xd3, 0x02, 0xc9, 0x57, 0x68, 0x56, 0x4a, 0x1c, 0xc6, 0x51, 0xd7,
+  0xa3, 0x6c, 0xe5, 0x7f, 0x18, 0xb6, 0xa3, 0xec, 0x4f, 0x34, 0x68, 0xe7,
+  0x09, 0x1d, 0x32, 0xda, 0x25, 0xb4, 0xf5, 0x77, 0xa7, 0xfe, 0xda, 0xa9,
+  0x09, 0xdf, 0x25, 0x36, 0xc5, 0xcf, 0x78, 0x93, 0x39, 0x5d, 0x49, 0x40,
+  0xf0, 0x32, 0xc8, 0xe7, 0xfb, 0x10, 0x96, 0xc2, 0xf8, 0x5b, 0xb9, 0xcc,
+  0x3c, 0xe0, 0xf1, 0xfe, 0xac, 0xdf, 0x16, 0x7e, 0xae, 0x77, 0x65, 0x15,
+  0x8c, 0x8b, 0xfd, 0x17, 0x64, 0x1c, 0x95, 0xba, 0x8e, 0x78, 0x79, 0x34,
+  0xea, 0xce, 0xe7, 0xfe, 0x61, 0x0c, 0xfa, 0xa0, 0x33, 0xe9, 0xe9, 0x96,
+  0xc3, 0x6a, 0xf6, 0x1d, 0x61, 0xac, 0xbc, 0x74, 0xd5, 0x18, 0x37, 0xc6,
+  0x03, 0x15, 0x0d, 0x47, 0x45, 0x9c, 0xc1, 0x24, 0x9d, 0xd6, 0xd7, 0xcb,
+  0x53, 0x6f, 0x38, 0x32, 0x4c, 0xe0, 0xfb, 0x7f, 0xd2, 0x99, 0x25, 0x5b,
+  0x91, 0xf3, 0x38, 0xb5, 0xa1, 0xb9, 0x49, 0x71, 0xa9, 0x60, 0x73, 0x9a,
+  0xfe, 0x8f, 0x85, 0xbf, 0xb9, 0x8f, 0x5f, 0x94, 0x98, 0x68, 0x12, 0x3e,
+  0xa8, 0xfe, 0xd4, 0xab, 0x8f, 0xf0, 0x03, 0xc3, 0x87, 0xeb, 0x6f, 0xfd,
+  0x77, 0x9a, 0x9e, 0x7b, 0xd6, 0x18, 0xb6, 0xd3, 0x13, 0x28, 0x19, 0xc9,
+  0x41, 0xb7, 0xff, 0x82, 0xf7, 0xba, 0xb3, 0xc0, 0x8f, 0xbe, 0xac, 0x3c,
+  0x3b, 0xc0, 0x0b, 0x6c, 0x9f, 0xdb, 0xc5, 0xbb, 0x46, 0xaa, 0x7b, 0xcc,
+  0xce, 0xdc, 0x3a, 0x82, 0xd6, 0x04, 0x0d, 0xf9, 0xa8, 0x76, 0x47, 0xc5,
+  0xeb, 0x48, 0x76, 0x67, 0x1e, 0x04, 0x8f, 0x56, 0x7c, 0x7c, 0xc1, 0x9b,
+  0x46, 0x7a, 0xb2, 0xe4, 0xf6, 0x21, 0x75, 0xb2, 0x33, 0xf0, 0xfa, 0x25,
+  0x1a, 0x79, 0xe8, 0x63, 0x80, 0xaa, 0xe0, 0x96, 0x73, 0x71, 0xa4, 0x73,
+  0x81, 0x3c, 0x9e, 0x8f, 0x83, 0x36, 0x5e, 0xc3, 0x50, 0x40, 0x12, 0x47,
+  0xb3, 0xa4, 0x93, 0xc6, 0xfd, 0x59, 0xeb, 0x9b, 0x9c, 0x0f, 0xbb, 0xf6,
+  0x76, 0x7c, 0x93, 0xc7, 0x2f, 0xb7, 0xf3, 0xac, 0x1b, 0x03, 0xd7, 0xcf,
+  0xb3, 0x6a, 0x23, 0xef, 0xfd, 0x6b, 0xa6, 0x34, 0xef, 0x22, 0x5e, 0xca,
+  0x4f, 0xf7, 0x55, 0x9b, 0x59, 0xdc, 0x7b, 0x97, 0xc0, 0xbd, 0x56, 0xb4,
+  0x26, 0x96, 0x57, 0x99, 0xc2, 0xb9, 0xc9, 0xb1, 0xb4, 0x08, 0x36, 0x8d,
+  0xe4, 0xf0, 0x06, 0x7b, 0x67, 0x8d, 0xd4, 0x97, 0x36, 0x41, 0xf4, 0x90,
+  0x90, 0x07, 0xca, 0xa2, 0x43, 0x64, 0xbc, 0x63, 0x61, 0xb4, 0x5e, 0xac,
+  0xe7, 0x89, 0x13, 0x40, 0xa9, 0x8c, 0xd9, 0x41, 0x4c, 0x3e, 0x0c, 0x26,
+  0x7d, 0x8e, 0x12, 0x09, 0xb7, 0x9f, 0x4c, 0xfd, 0xd7, 0xac, 0xf8, 0x13,
+  0x73, 0x86, 0xfe, 0x60, 0xf4, 0x47, 0x1a, 0x54, 0xf6, 0x3e, 0xb3, 0xec,
+  0xb5, 0xbf, 0x4c, 0xae, 0xfb, 0x69, 0x46, 0x40, 0x82, 0x0f, 0x6f, 0x2d,
+  0xd8, 0xcc, 0xe5, 0x7c, 0x4b, 0xee, 0xc2, 0x3b, 0x72, 0x9d, 0x0a, 0xa4,
+  0xcd, 0x9f, 0x6b, 0x44, 0x0d, 0x8d, 0x78, 0x70, 0x89, 0x66, 0x69, 0xea,
+  0xf4, 0x20, 0x7b, 0xb0, 0x90, 0x8b, 0x68, 0xdd, 0x99, 0xa2, 0x1b, 0xdb,
+  0x27, 0x5e, 0x1f, 0xcb, 0x4c, 0xea, 0xf0, 0xe3, 0x33, 0xbd, 0x2d, 0xda,
+  0xef, 0x0d, 0x49, 0xb3, 0x7e, 0x94, 0xe3, 0x04, 0x0e, 0xd2, 0x79, 0xd4,
+  0x53, 0xf5, 0xb9, 0x3b, 0x00, 0x00, 0x0d, 0x00, 0x18, 0x00, 0x26, 0x00,
+  0x3d, 0x00, 0x4b, 0x00, 0x5c, 0x00, 0x6d, 0x00, 0x7b, 0x00, 0x89, 0x00,
+  0x98, 0x00, 0xa4, 0x00, 0xb2, 0x00, 0xc3, 0x00, 0xd1, 0x00, 0xdf, 0x00,
+  0xf6, 0x00, 0x06, 0x01, 0x14, 0x01, 0x22, 0x01, 0x30, 0x01, 0x3c, 0x01,
+  0x4a, 0x01, 0x58, 0x01, 0x68, 0x01, 0x7c, 0x01, 0x93, 0x01, 0xa1, 0x01,
+  0xad, 0x01, 0xbc, 0x01, 0xca, 0x01, 0xd6, 0x01, 0xe4, 0x01, 0xf0, 0x01,
+  0xff, 0x01, 0x0d, 0x02, 0x1a, 0x02, 0x00, 0x00, 0x56, 0x00, 0xa8, 0x00,
+  0xfc, 0x00, 0x08, 0x01, 0x16, 0x01, 0x24, 0x01, 0x32, 0x01, 0x40, 0x01,
+  0x52, 0x01, 0x68, 0x01, 0x78, 0x01, 0x8a, 0x01, 0x9f, 0x01, 0xb0, 0x01,
+  0xc0, 0x01, 0xd5, 0x01, 0xde, 0x01, 0xf2, 0x01, 0x04, 0x02, 0x17, 0x02,
+  0x27, 0x02, 0x00, 0x00, 0x52, 0x00, 0xa6, 0x00, 0xf4, 0x00, 0x44, 0x01,
+  0x94, 0x01, 0xe6, 0x01, 0xf1, 0x01, 0xfd, 0x01, 0x0d, 0x02, 0x1a, 0x02,
+  0x2e, 0x02, 0x39, 0x02, 0x47, 0x02, 0x57, 0x02, 0x64, 0x02, 0x72, 0x02,
+  0x7f, 0x02, 0x8d, 0x02, 0x9a, 0x02, 0xa6, 0x02, 0xba, 0x02, 0xca, 0x02,
+  0xd5, 0x02, 0xe5, 0x02, 0xf3, 0x02, 0x03, 0x03, 0x16, 0x03, 0x22, 0x03,
+  0x32, 0x03, 0x40, 0x03, 0x54, 0x03, 0x64, 0x03, 0x72, 0x03, 0x7d, 0x03,
+  0x8d, 0x03, 0x99, 0x03, 0x00, 0x00, 0x17, 0x00, 0x25, 0x00, 0x31, 0x00,
+  0x47, 0x00, 0x55, 0x00, 0x6a, 0x00, 0x76, 0x00, 0x83, 0x00, 0x9b, 0x00,
+  0xa6, 0x00, 0xb9, 0x00, 0xc7, 0x00, 0xd0, 0x00, 0xe1, 0x00, 0xf4, 0x00,
+  0xff, 0x00, 0x0b, 0x01, 0x19, 0x01, 0x25, 0x01, 0x00, 0x00, 0x0f, 0x00,
+  0x1d, 0x00, 0x2b, 0x00, 0x3b, 0x00, 0x49, 0x00, 0x57, 0x00, 0x65, 0x00,
+  0x73, 0x00, 0x82, 0x00, 0x94, 0x00, 0xa0, 0x00, 0xae, 0x00, 0xbd, 0x00,
+  0xcb, 0x00, 0xdb, 0x00, 0xe9, 0x00, 0xf7, 0x00, 0x05, 0x01, 0x13, 0x01,
+  0x21, 0x01, 0x2f, 0x01, 0x3d, 0x01, 0x48, 0x01, 0x54, 0x01, 0x62, 0x01,
+  0x74, 0x01, 0x7f, 0x01, 0x8a, 0x01, 0x98, 0x01, 0xa7, 0x01, 0xb6, 0x01,
+  0xc5, 0x01, 0xd3, 0x01, 0xe2, 0x01, 0xf0, 0x01, 0xfb, 0x01, 0x0a, 0x02,
+  0x1d, 0x02, 0x2b, 0x02, 0x36, 0x02, 0x43, 0x02, 0x51, 0x02, 0x5f, 0x02,
+  0x6d, 0x02, 0x7f, 0x02, 0x89, 0x02, 0x97, 0x02, 0xa3, 0x02, 0xb3, 0x02,
+  0xc1, 0x02, 0xcf, 0x02, 0xe0, 0x02, 0xe9, 0x02, 0xf7, 0x02, 0x05, 0x03,
+  0x13, 0x03, 0x21, 0x03, 0x2e, 0x03, 0x38, 0x03, 0x4a, 0x03, 0x57, 0x03,
+  0x00, 0x00, 0x1c, 0x00, 0x2a, 0x00, 0x40, 0x00, 0x51, 0x00, 0x60, 0x00,
+  0x6e, 0x00, 0x78, 0x00, 0x87, 0x00, 0x95, 0x00, 0xa1, 0x00, 0xac, 0x00,
+  0xb6, 0x00, 0xc2, 0x00, 0xcc, 0x00, 0xd8, 0x00, 0x00, 0x00, 0x1b, 0x00,
+  0x27, 0x00, 0x32, 0x00, 0x43, 0x00, 0x50, 0x00, 0x60, 0x00, 0x70, 0x00,
+  0x81, 0x00, 0x92, 0x00, 0x9e, 0x00, 0xaf, 0x00, 0xbe, 0x00, 0xcf, 0x00,
+  0xe0, 0x00, 0xf1, 0x00, 0x01, 0x01, 0x0a, 0x01, 0x16, 0x01, 0x22, 0x01,
+  0x31, 0x01, 0x42, 0x01, 0x4a, 0x01, 0x00, 0x00, 0x1c, 0x00, 0x28, 0x00,
+  0x38, 0x00, 0x44, 0x00, 0x52, 0x00, 0x5e, 0x00, 0x6b, 0x00, 0x79, 0x00,
+  0x86, 0x00, 0x94, 0x00, 0xa0, 0x00, 0xb2, 0x00, 0xba, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x18, 0x00, 0x27, 0x00, 0x39, 0x00, 0x44, 0x00, 0x52, 0x00,
+  0x5e, 0x00, 0x75, 0x00, 0x83, 0x00, 0x8c, 0x00, 0x95, 0x00, 0xa3, 0x00,
+  0xae, 0x00, 0xb7, 0x00, 0xc5, 0x00, 0xda, 0x00, 0xe6, 0x00, 0xf4, 0x00,
+  0x00, 0x00, 0x0f, 0x00, 0x1e, 0x00, 0x2c, 0x00, 0x3b, 0x00, 0x49, 0x00,
+  0x57, 0x00, 0x62, 0x00, 0x70, 0x00, 0x84, 0x00, 0x97, 0x00, 0xa4, 0x00,
+  0xb3, 0x00, 0xc3, 0x00, 0xce, 0x00, 0xdb, 0x00, 0xe6, 0x00, 0xf3, 0x00,
+  0x01, 0x01, 0x0e, 0x01, 0x21, 0x01, 0x00, 0x00, 0x11, 0x00, 0x22, 0x00,
+  0x30, 0x00, 0x3e, 0x00, 0x4a, 0x00, 0x5b, 0x00, 0x64, 0x00, 0x70, 0x00,
+  0x7c, 0x00, 0x93, 0x00, 0x9d, 0x00, 0xab, 0x00, 0xb7, 0x00, 0xc3, 0x00,
+  0xd4, 0x00, 0xdd, 0x00, 0xeb, 0x00, 0xf7, 0x00, 0x08, 0x01, 0x14, 0x01,
+  0x1e, 0x01, 0x2e, 0x01, 0x00, 0x00, 0x0e, 0x00, 0x1c, 0x00, 0x2a, 0x00,
+  0x38, 0x00, 0x43, 0x00, 0x52, 0x00, 0x61, 0x00, 0x6f, 0x00, 0x7f, 0x00,
+  0x8d, 0x00, 0x9b, 0x00, 0xaa, 0x00, 0xb6, 0x00, 0xc5, 0x00, 0xd3, 0x00,
+  0xdd, 0x00, 0xe9, 0x00, 0xf4, 0x00, 0x02, 0x01, 0x10, 0x01, 0x1e, 0x01,
+  0x29, 0x01, 0x37, 0x01, 0x45, 0x01, 0x50, 0x01, 0x62, 0x01, 0x70, 0x01,
+  0x7e, 0x01, 0x8c, 0x01, 0x9a, 0x01, 0xa8, 0x01, 0x00, 0x00, 0x0d, 0x00,
+  0x18, 0x00, 0x24, 0x00, 0x35, 0x00, 0x43, 0x00, 0x4f, 0x00, 0x63, 0x00,
+  0x6f, 0x00, 0x7b, 0x00, 0x86, 0x00, 0x92, 0x00, 0x9f, 0x00, 0xa9, 0x00,
+  0xb5, 0x00, 0xbf, 0x00, 0xd2, 0x00, 0xdf, 0x00, 0xe9, 0x00, 0xf6, 0x00,
+  0x00, 0x01, 0x0c, 0x01, 0x16, 0x01, 0x24, 0x01, 0x31, 0x01, 0x3b, 0x01,
+  0x00, 0x00, 0x11, 0x00, 0x1d, 0x00, 0x2b, 0x00, 0x3d, 0x00, 0x4f, 0x00,
+  0x61, 0x00, 0x73, 0x00, 0x85, 0x00, 0x93, 0x00, 0xa5, 0x00, 0xb5, 0x00,
+  0xc1, 0x00, 0xd3, 0x00, 0xdf, 0x00, 0xee, 0x00, 0x00, 0x01, 0x0f, 0x01,
+  0x1b, 0x01, 0x2c, 0x01, 0x38, 0x01, 0x41, 0x01, 0x4f, 0x01, 0x5e, 0x01,
+  0x70, 0x01, 0x7e, 0x01, 0x91, 0x01, 0xa3, 0x01, 0xac, 0x01, 0xb8, 0x01,
+  0xca, 0x01, 0xd6, 0x01, 0xe7, 0x01, 0xf3, 0x01, 0x07, 0x02, 0x19, 0x02,
+  0x00, 0x00, 0x07, 0x00, 0x15, 0x00, 0x23, 0x00, 0x30, 0x00, 0x3e, 0x00,
+  0x49, 0x00, 0x58, 0x00, 0x66, 0x00, 0x71, 0x00, 0x81, 0x00, 0x8c, 0x00,
+  0x98, 0x00, 0xa9, 0x00, 0xb3, 0x00, 0xc2, 0x00, 0xcf, 0x00, 0xe2, 0x00,
+  0xee, 0x00, 0xfb, 0x00, 0x0b, 0x01, 0x16, 0x01, 0x20, 0x01, 0x2a, 0x01,
+  0x36, 0x01, 0x40, 0x01, 0x4e, 0x01, 0x58, 0x01, 0x6a, 0x01, 0x77, 0x01,
+  0x83, 0x01, 0x91, 0x01, 0x9f, 0x01, 0xaa, 0x01, 0xb4, 0x01, 0xc0, 0x01,
+  0xcd, 0x01, 0xd9, 0x01, 0xe3, 0x01, 0xed, 0x01, 0x00, 0x00, 0x0f, 0x00,
+  0x1f, 0x00, 0x2d, 0x00, 0x3c, 0x00, 0x47, 0x00, 0x52, 0x00, 0x66, 0x00,
+  0x72, 0x00, 0x7c, 0x00, 0x8a, 0x00, 0x96, 0x00, 0xa5, 0x00, 0xb1, 0x00,
+  0xbf, 0x00, 0xcb, 0x00, 0xd6, 0x00, 0xe8, 0x00, 0xf6, 0x00, 0x00, 0x01,
+  0x14, 0x01, 0x20, 0x01, 0x2c, 0x01, 0x3a, 0x01, 0x4b, 0x01, 0x57, 0x01,
+  0x63, 0x01, 0x71, 0x01, 0x7b, 0x01, 0x8b, 0x01, 0x95, 0x01, 0xa3, 0x01,
+  0xae, 0x01, 0xbc, 0x01, 0xc8, 0x01, 0xd4, 0x01, 0xdf, 0x01, 0xea, 0x01,
+  0xfa, 0x01, 0x06, 0x02, 0x16, 0x02, 0x22, 0x02, 0x2e, 0x02, 0x00, 0x00,
+  0x0f, 0x00, 0x1f, 0x00, 0x2f, 0x00, 0x39, 0x00, 0x45, 0x00, 0x55, 0x00,
+  0x63, 0x00, 0x72, 0x00, 0x82, 0x00, 0x92, 0x00, 0xa0, 0x00, 0xab, 0x00,
+  0xb9, 0x00, 0xc9, 0x00, 0xd9, 0x00, 0xe9, 0x00, 0xf5, 0x00, 0xff, 0x00,
+  0x0a, 0x01, 0x1a, 0x01, 0x2a, 0x01, 0x3a, 0x01, 0x46, 0x01, 0x54, 0x01,
+  0x64, 0x01, 0x73, 0x01, 0x7d, 0x01, 0x8b, 0x01, 0x9b, 0x01, 0xa9, 0x01,
+  0xb9, 0x01, 0xc9, 0x01, 0xd7, 0x01, 0xe7, 0x01, 0xf7, 0x01, 0x05, 0x02,
+  0x11, 0x02, 0x1c, 0x02, 0x2c, 0x02, 0x3a, 0x02, 0x48, 0x02, 0x56, 0x02,
+  0x62, 0x02, 0x72, 0x02, 0x7c, 0x02, 0x8c, 0x02, 0x98, 0x02, 0xa6, 0x02,
+  0xb4, 0x02, 0xc2, 0x02, 0xce, 0x02, 0xde, 0x02, 0xee, 0x02, 0xf9, 0x02,
+  0x08, 0x03, 0x18, 0x03, 0x28, 0x03, 0x38, 0x03, 0x48, 0x03, 0x52, 0x03,
+  0x5c, 0x03, 0x6a, 0x03, 0x7a, 0x03, 0x8a, 0x03, 0x98, 0x03, 0xa6, 0x03,
+  0xb6, 0x03, 0xc4, 0x03, 0xd2, 0x03, 0xe0, 0x03, 0xea, 0x03, 0x00, 0x00,
+  0x0e, 0x00, 0x1e, 0x00, 0x2a, 0x00, 0x36, 0x00, 0x4b, 0x00, 0x59, 0x00,
+  0x65, 0x00, 0x71, 0x00, 0x7d, 0x00, 0x8a, 0x00, 0x98, 0x00, 0xad, 0x00,
+  0xbb, 0x00, 0xc9, 0x00, 0xd7, 0x00, 0xe8, 0x00, 0xf4, 0x00, 0x04, 0x01,
+  0x10, 0x01, 0x1c, 0x01, 0x28, 0x01, 0x34, 0x01, 0x42, 0x01, 0x50, 0x01,
+  0x5c, 0x01, 0x68, 0x01, 0x76, 0x01, 0x86, 0x01, 0x97, 0x01, 0xa4, 0x01,
+  0xb0, 0x01, 0xbc, 0x01, 0xc8, 0x01, 0xd6, 0x01, 0xe6, 0x01, 0xf2, 0x01,
+  0x00, 0x02, 0x0f, 0x02, 0x1b, 0x02, 0x27, 0x02, 0x35, 0x02, 0x41, 0x02,
+  0x4d, 0x02, 0x5b, 0x02, 0x6b, 0x02, 0x77, 0x02, 0x83, 0x02, 0x8f, 0x02,
+  0xa0, 0x02, 0xac, 0x02, 0xb8, 0x02, 0xc7, 0x02, 0xd5, 0x02, 0xe3, 0x02,
+  0xef, 0x02, 0xfd, 0x02, 0x0a, 0x03, 0x1a, 0x03, 0x28, 0x03, 0x34, 0x03,
+  0x40, 0x03, 0x00, 0x00, 0x0c, 0x00, 0x17, 0x00, 0x23, 0x00, 0x35, 0x00,
+  0x41, 0x00, 0x4d, 0x00, 0x5b, 0x00, 0x6c, 0x00, 0x78, 0x00, 0x84, 0x00,
+  0x8f, 0x00, 0x9b, 0x00, 0xad, 0x00, 0xb9, 0x00, 0xc7, 0x00, 0xd5, 0x00,
+  0xe7, 0x00, 0xf3, 0x00, 0xfd, 0x00, 0x0b, 0x01, 0x17, 0x01, 0x2b, 0x01,
+  0x3e, 0x01, 0x4f, 0x01, 0x5d, 0x01, 0x6e, 0x01, 0x7a, 0x01, 0x86, 0x01,
+  0x98, 0x01, 0xa9, 0x01, 0xbb, 0x01, 0xcd, 0x01, 0xdf, 0x01, 0xf1, 0x01,
+  0xfe, 0x01, 0x0e, 0x02, 0x1f, 0x02, 0x31, 0x02, 0x3d, 0x02, 0x4b, 0x02,
+  0x5d, 0x02, 0x70, 0x02, 0x82, 0x02, 0x8e, 0x02, 0x99, 0x02, 0x00, 0x00,
+  0x0e, 0x00, 0x21, 0x00, 0x30, 0x00, 0x3e, 0x00, 0x4a, 0x00, 0x58, 0x00,
+  0x67, 0x00, 0x72, 0x00, 0x7f, 0x00, 0x8e, 0x00, 0xa6, 0x00, 0xb1, 0x00,
+  0xbf, 0x00, 0xcd, 0x00, 0xd8, 0x00, 0xe6, 0x00, 0xf4, 0x00, 0x02, 0x01,
+  0x10, 0x01, 0x1e, 0x01, 0x33, 0x01, 0x3f, 0x01, 0x4d, 0x01, 0x62, 0x01,
+  0x70, 0x01, 0x7e, 0x01, 0x8c, 0x01, 0x9a, 0x01, 0xaa, 0x01, 0xb5, 0x01,
+  0xc3, 0x01, 0xd8, 0x01, 0xed, 0x01, 0x01, 0x02, 0x0f, 0x02, 0x1d, 0x02,
+  0x2b, 0x02, 0x3f, 0x02, 0x54, 0x02, 0x63, 0x02, 0x71, 0x02, 0x7f, 0x02,
+  0x8d, 0x02, 0x98, 0x02, 0x00, 0x00, 0x0d, 0x00, 0x17, 0x00, 0x26, 0x00,
+  0x34, 0x00, 0x42, 0x00, 0x51, 0x00, 0x5c, 0x00, 0x68, 0x00, 0x7a, 0x00,
+  0x89, 0x00, 0x9c, 0x00, 0xac, 0x00, 0xb8, 0x00, 0xc6, 0x00, 0xd2, 0x00,
+  0xdd, 0x00, 0xeb, 0x00, 0xf9, 0x00, 0x09, 0x01, 0x17, 0x01, 0x25, 0x01,
+  0x3a, 0x01, 0x46, 0x01, 0x52, 0x01, 0x5e, 0x01, 0x6d, 0x01, 0x76, 0x01,
+  0x82, 0x01, 0x90, 0x01, 0xa5, 0x01, 0xb1, 0x01, 0xbf, 0x01, 0x00, 0x00,
+  0x11, 0x00, 0x1c, 0x00, 0x29, 0x00, 0x37, 0x00, 0x48, 0x00, 0x54, 0x00,
+  0x60, 0x00, 0x6d, 0x00, 0x7e, 0x00, 0x8a, 0x00, 0x95, 0x00, 0xa0, 0x00,
+  0xae, 0x00, 0xba, 0x00, 0xc8, 0x00, 0xd4, 0x00, 0xe5, 0x00, 0xef, 0x00,
+  0xfd, 0x00, 0x0e, 0x01, 0x1c, 0x01, 0x27, 0x01, 0x00, 0x00, 0x0e, 0x00,
+  0x1c, 0x00, 0x2b, 0x00, 0x37, 0x00, 0x43, 0x00, 0x4f, 0x00, 0x5b, 0x00,
+  0x66, 0x00, 0x74, 0x00, 0x80, 0x00, 0x8b, 0x00, 0x97, 0x00, 0xae, 0x00,
+  0xc4, 0x00, 0xd4, 0x00, 0xe0, 0x00, 0xec, 0x00, 0xfa, 0x00, 0x06, 0x01,
+  0x14, 0x01, 0x20, 0x01, 0x2c, 0x01, 0x3c, 0x01, 0x48, 0x01, 0x58, 0x01,
+  0x6e, 0x01, 0x84, 0x01, 0x92, 0x01, 0xa0, 0x01, 0xac, 0x01, 0xba, 0x01,
+  0xc8, 0x01, 0xd6, 0x01, 0x00, 0x00, 0x0f, 0x00, 0x1d, 0x00, 0x29, 0x00,
+  0x37, 0x00, 0x45, 0x00, 0x53, 0x00, 0x62, 0x00, 0x6d, 0x00, 0x7b, 0x00,
+  0x89, 0x00, 0x97, 0x00, 0xa3, 0x00, 0xb2, 0x00, 0xbd, 0x00, 0xcb, 0x00,
+  0xd6, 0x00, 0xe5, 0x00, 0xf3, 0x00, 0x01, 0x01, 0x0d, 0x01, 0x1b, 0x01,
+  0x29, 0x01, 0x35, 0x01, 0x43, 0x01, 0x51, 0x01, 0x5f, 0x01, 0x6b, 0x01,
+  0x79, 0x01, 0x87, 0x01, 0x95, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x1a, 0x00,
+  0x29, 0x00, 0x35, 0x00, 0x41, 0x00, 0x4d, 0x00, 0x5b, 0x00, 0x6a, 0x00,
+  0x73, 0x00, 0x81, 0x00, 0x8b, 0x00, 0x93, 0x00, 0xa1, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x19, 0x00, 0x25, 0x00, 0x35, 0x00, 0x41, 0x00, 0x4e, 0x00,
+  0x5e, 0x00, 0x6a, 0x00, 0x7b, 0x00, 0x8c, 0x00, 0x98, 0x00, 0xa9, 0x00,
+  0xba, 0x00, 0xcc, 0x00, 0xd8, 0x00, 0xe4, 0x00, 0xf4, 0x00, 0x08, 0x01,
+  0x18, 0x01, 0x24, 0x01, 0x33, 0x01, 0x42, 0x01, 0x00, 0x00, 0x0a, 0x00,
+  0x16, 0x00, 0x28, 0x00, 0x39, 0x00, 0x45, 0x00, 0x4f, 0x00, 0x59, 0x00,
+  0x64, 0x00, 0x72, 0x00, 0x7e, 0x00, 0x91, 0x00, 0xa5, 0x00, 0xb8, 0x00,
+  0xc4, 0x00, 0xcf, 0x00, 0xe3, 0x00, 0xf3, 0x00, 0x01, 0x01, 0x15, 0x01,
+  0x21, 0x01, 0x34, 0x01, 0x48, 0x01, 0x53, 0x01, 0x66, 0x01, 0x84, 0x01,
+  0x92, 0x01, 0x9d, 0x01, 0xa8, 0x01, 0xb9, 0x01, 0xc5, 0x01, 0xd1, 0x01,
+  0xdd, 0x01, 0xe7, 0x01, 0xf1, 0x01, 0xfb, 0x01, 0x00, 0x00, 0x0b, 0x00,
+  0x22, 0x00, 0x31, 0x00, 0x3d, 0x00, 0x4b, 0x00, 0x57, 0x00, 0x6b, 0x00,
+  0x77, 0x00, 0x85, 0x00, 0x98, 0x00, 0xa3, 0x00, 0xb7, 0x00, 0xc4, 0x00,
+  0xd2, 0x00, 0xe9, 0x00, 0xf6, 0x00, 0x08, 0x01, 0x1d, 0x01, 0x29, 0x01,
+  0x37, 0x01, 0x4b, 0x01, 0x59, 0x01, 0x69, 0x01, 0x79, 0x01, 0x8e, 0x01,
+  0x9c, 0x01, 0xaa, 0x01, 0xb4, 0x01, 0xc5, 0x01, 0xd3, 0x01, 0xe4, 0x01,
+  0xef, 0x01, 0xfd, 0x01, 0x00, 0x00, 0x40, 0x00, 0x4c, 0x00, 0x56, 0x00,
+  0x63, 0x00, 0x71, 0x00, 0x7e, 0x00, 0x8c, 0x00, 0x98, 0x00, 0xa4, 0x00,
+  0xb1, 0x00, 0xbd, 0x00, 0xc9, 0x00, 0xd6, 0x00, 0xe8, 0x00, 0xf6, 0x00,
+  0x02, 0x01, 0x0e, 0x01, 0x1b, 0x01, 0x29, 0x01, 0x33, 0x01, 0x40, 0x01,
+  0x4e, 0x01, 0x5a, 0x01, 0x65, 0x01, 0x71, 0x01, 0x7f, 0x01, 0x89, 0x01,
+  0x95, 0x01, 0xa3, 0x01, 0xaf, 0x01, 0xbb, 0x01, 0xcb, 0x01, 0xd9, 0x01,
+  0xeb, 0x01, 0xfb, 0x01, 0x07, 0x02, 0x10, 0x02, 0x1b, 0x02, 0x26, 0x02,
+  0x00, 0x00, 0x42, 0x00, 0x4e, 0x00, 0x5c, 0x00, 0x68, 0x00, 0x76, 0x00,
+  0x82, 0x00, 0x8f, 0x00, 0x9d, 0x00, 0xa9, 0x00, 0xb5, 0x00, 0xc8, 0x00,
+  0xd4, 0x00, 0xe1, 0x00, 0xef, 0x00, 0xfc, 0x00, 0x08, 0x01, 0x14, 0x01,
+  0x1d, 0x01, 0x29, 0x01, 0x36, 0x01, 0x42, 0x01, 0x4b, 0x01, 0x58, 0x01,
+  0x66, 0x01, 0x74, 0x01, 0x82, 0x01, 0x8e, 0x01, 0x9c, 0x01, 0xaf, 0x01,
+  0xbc, 0x01, 0xca, 0x01, 0xd8, 0x01, 0xe4, 0x01, 0xf0, 0x01, 0x00, 0x00,
+  0x0e, 0x00, 0x1c, 0x00, 0x28, 0x00, 0x35, 0x00, 0x43, 0x00, 0x4f, 0x00,
+  0x5b, 0x00, 0x68, 0x00, 0x76, 0x00, 0x83, 0x00, 0x8e, 0x00, 0x9c, 0x00,
+  0xa6, 0x00, 0xb4, 0x00, 0xc2, 0x00, 0xcf, 0x00, 0xdd, 0x00, 0xe9, 0x00,
+  0xf6, 0x00, 0x03, 0x01, 0x0d, 0x01, 0x19, 0x01, 0x25, 0x01, 0x32, 0x01,
+  0x40, 0x01, 0x4e, 0x01, 0x5c, 0x01, 0x66, 0x01, 0x76, 0x01, 0x80, 0x01,
+  0x8c, 0x01, 0x96, 0x01, 0xa5, 0x01, 0xb1, 0x01, 0xbf, 0x01, 0xcb, 0x01,
+  0xd7, 0x01, 0xe5, 0x01, 0xf3, 0x01, 0x01, 0x02, 0x0e, 0x02, 0x1a, 0x02,
+  0x27, 0x02, 0x33, 0x02, 0x41, 0x02, 0x4f, 0x02, 0x5b, 0x02, 0x69, 0x02,
+  0x75, 0x02, 0x00, 0x00, 0x0e, 0x00, 0x1d, 0x00, 0x2b, 0x00, 0x36, 0x00,
+  0x45, 0x00, 0x55, 0x00, 0x63, 0x00, 0x71, 0x00, 0x7c, 0x00, 0x8b, 0x00,
+  0x99, 0x00, 0xa7, 0x00, 0xb5, 0x00, 0xc1, 0x00, 0xd0, 0x00, 0xde, 0x00,
+  0xea, 0x00, 0xf8, 0x00, 0x03, 0x01, 0x0f, 0x01, 0x1d, 0x01, 0x2b, 0x01,
+  0x35, 0x01, 0x46, 0x01, 0x53, 0x01, 0x61, 0x01, 0x6f, 0x01, 0x7b, 0x01,
+  0x8d, 0x01, 0x9b, 0x01, 0xa7, 0x01, 0xb2, 0x01, 0xc0, 0x01, 0xcc, 0x01,
+  0xdd, 0x01, 0xe9, 0x01, 0xf4, 0x01, 0x02, 0x02, 0x10, 0x02, 0x1b, 0x02,
+  0x26, 0x02, 0x00, 0x00, 0x0f, 0x00, 0x1e, 0x00, 0x29, 0x00, 0x37, 0x00,
+  0x45, 0x00, 0x53, 0x00, 0x63, 0x00, 0x72, 0x00, 0x80, 0x00, 0x8c, 0x00,
+  0x98, 0x00, 0xa5, 0x00, 0xb0, 0x00, 0xbc, 0x00, 0xcb, 0x00, 0xd6, 0x00,
+  0xe5, 0x00, 0xf5, 0x00, 0x05, 0x01, 0x14, 0x01, 0x24, 0x01, 0x33, 0x01,
+  0x4e, 0x01, 0x5c, 0x01, 0x6e, 0x01, 0x7c, 0x01, 0x8a, 0x01, 0x9b, 0x01,
+  0xa9, 0x01, 0xb7, 0x01, 0xc5, 0x01, 0xd3, 0x01, 0xe1, 0x01, 0xea, 0x01,
+  0xf8, 0x01, 0x04, 0x02, 0x0e, 0x02, 0x1d, 0x02, 0x2b, 0x02, 0x35, 0x02,
+  0x3f, 0x02, 0x4d, 0x02, 0x5b, 0x02, 0x69, 0x02, 0x00, 0x00, 0x15, 0x00,
+  0x25, 0x00, 0x31, 0x00, 0x41, 0x00, 0x4f, 0x00, 0x5b, 0x00, 0x67, 0x00,
+  0x7f, 0x00, 0x90, 0x00, 0x9d, 0x00, 0xa9, 0x00, 0xb5, 0x00, 0xc5, 0x00,
+  0xd5, 0x00, 0xe1, 0x00, 0xf1, 0x00, 0xfd, 0x00, 0x09, 0x01, 0x15, 0x01,
+  0x22, 0x01, 0x30, 0x01, 0x40, 0x01, 0x4c, 0x01, 0x58, 0x01, 0x64, 0x01,
+  0x70, 0x01, 0x81, 0x01, 0x92, 0x01, 0xa2, 0x01, 0xb0, 0x01, 0xbf, 0x01,
+  0xcd, 0x01, 0xd9, 0x01, 0xe5, 0x01, 0xf3, 0x01, 0x00, 0x00, 0x11, 0x00,
+  0x1e, 0x00, 0x29, 0x00, 0x33, 0x00, 0x3f, 0x00, 0x53, 0x00, 0x60, 0x00,
+  0x6d, 0x00, 0x7d, 0x00, 0x88, 0x00, 0x98, 0x00, 0xa6, 0x00, 0xb7, 0x00,
+  0xca, 0x00, 0xd5, 0x00, 0xe2, 0x00, 0xf3, 0x00, 0x06, 0x01, 0x18, 0x01,
+  0x29, 0x01, 0x34, 0x01, 0x45, 0x01, 0x50, 0x01, 0x60, 0x01, 0x00, 0x00,
+  0x07, 0x00, 0x13, 0x00, 0x1e, 0x00, 0x2c, 0x00, 0x3a, 0x00, 0x48, 0x00,
+  0x56, 0x00, 0x62, 0x00, 0x6e, 0x00, 0x7c, 0x00, 0x8d, 0x00, 0x9b, 0x00,
+  0xa9, 0x00, 0xb2, 0x00, 0xbd, 0x00, 0xcb, 0x00, 0xd6, 0x00, 0xe4, 0x00,
+  0xf0, 0x00, 0x00, 0x01, 0x0e, 0x01, 0x22, 0x01, 0x2d, 0x01, 0x38, 0x01,
+  0x46, 0x01, 0x52, 0x01, 0x60, 0x01, 0x73, 0x01, 0x81, 0x01, 0x91, 0x01,
+  0x9f, 0x01, 0xab, 0x01, 0xbb, 0x01, 0xcc, 0x01, 0xd8, 0x01, 0xe6, 0x01,
+  0xf4, 0x01, 0x00, 0x00, 0x0e, 0x00, 0x23, 0x00, 0x36, 0x00, 0x48, 0x00,
+  0x5b, 0x00, 0x6f, 0x00, 0x7f, 0x00, 0x92, 0x00, 0xa2, 0x00, 0xb0, 0x00,
+  0xc4, 0x00, 0xd4, 0x00, 0xe9, 0x00, 0xf2, 0x00, 0x02, 0x01, 0x15, 0x01,
+  0x29, 0x01, 0x3b, 0x01, 0x4c, 0x01, 0x58, 0x01, 0x6a, 0x01, 0x79, 0x01,
+  0x86, 0x01, 0x99, 0x01, 0xaa, 0x01, 0xbe, 0x01, 0xd1, 0x01, 0x00, 0x00,
+  0x35, 0x00, 0x40, 0x00, 0x50, 0x00, 0x5c, 0x00, 0x6a, 0x00, 0x75, 0x00,
+  0x81, 0x00, 0x92, 0x00, 0xa4, 0x00, 0xaf, 0x00, 0xbd, 0x00, 0xcb, 0x00,
+  0xd9, 0x00, 0xe7, 0x00, 0xf2, 0x00, 0xfe, 0x00, 0x09, 0x01, 0x15, 0x01,
+  0x23, 0x01, 0x35, 0x01, 0x41, 0x01, 0x4f, 0x01, 0x5b, 0x01, 0x69, 0x01,
+  0x77, 0x01, 0x84, 0x01, 0x90, 0x01, 0x9e, 0x01, 0x00, 0x00, 0x0b, 0x00,
+  0x16, 0x00, 0x21, 0x00, 0x2c, 0x00, 0x3f, 0x00, 0x51, 0x00, 0x5d, 0x00,
+  0x6f, 0x00, 0x7c, 0x00, 0x8a, 0x00, 0x9f, 0x00, 0xa9, 0x00, 0xb9, 0x00,
+  0xc5, 0x00, 0xd1, 0x00, 0xdf, 0x00, 0xf2, 0x00, 0xff, 0x00, 0x0d, 0x01,
+  0x16, 0x01, 0x2a, 0x01, 0x34, 0x01, 0x40, 0x01, 0x4f, 0x01, 0x5b, 0x01,
+  0x66, 0x01, 0x78, 0x01, 0x86, 0x01, 0x00, 0x00, 0x0b, 0x00, 0x16, 0x00,
+  0x22, 0x00, 0x30, 0x00, 0x3e, 0x00, 0x4a, 0x00, 0x56, 0x00, 0x69, 0x00,
+  0x79, 0x00, 0x88, 0x00, 0x96, 0x00, 0xa4, 0x00, 0xb0, 0x00, 0xbf, 0x00,
+  0xd6, 0x00, 0xe6, 0x00, 0xf1, 0x00, 0xff, 0x00, 0x0b, 0x01, 0x19, 0x01,
+  0x23, 0x01, 0x31, 0x01, 0x40, 0x01, 0x4b, 0x01, 0x5f, 0x01, 0x6b, 0x01,
+  0x7d, 0x01, 0x8b, 0x01, 0x97, 0x01, 0xa2, 0x01, 0xac, 0x01, 0xbb, 0x01,
+  0xce, 0x01, 0xdc, 0x01, 0xe8, 0x01, 0xf0, 0x01, 0x00, 0x00, 0x0d, 0x00,
+  0x1a, 0x00, 0x25, 0x00, 0x30, 0x00, 0x3b, 0x00, 0x47, 0x00, 0x5a, 0x00,
+  0x67, 0x00, 0x72, 0x00, 0x7d, 0x00, 0x88, 0x00, 0x94, 0x00, 0xa0, 0x00,
+  0xac, 0x00, 0xb8, 0x00, 0xc2, 0x00, 0xd0, 0x00, 0xda, 0x00, 0xe6, 0x00,
+  0xf2, 0x00, 0xfe, 0x00, 0x0c, 0x01, 0x18, 0x01, 0x24, 0x01, 0x36, 0x01,
+  0x4d, 0x01, 0x59, 0x01, 0x66, 0x01, 0x74, 0x01, 0x7f, 0x01, 0x8b, 0x01,
+  0x94, 0x01, 0xa0, 0x01, 0xaa, 0x01, 0xbe, 0x01, 0x00, 0x00, 0x10, 0x00,
+  0x20, 0x00, 0x30, 0x00, 0x40, 0x00, 0x4b, 0x00, 0x57, 0x00, 0x62, 0x00,
+  0x70, 0x00, 0x7c, 0x00, 0x87, 0x00, 0x93, 0x00, 0x9f, 0x00, 0xab, 0x00,
+  0xb7, 0x00, 0xc4, 0x00, 0xd1, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x18, 0x00,
+  0x27, 0x00, 0x34, 0x00, 0x41, 0x00, 0x4f, 0x00, 0x62, 0x00, 0x70, 0x00,
+  0x86, 0x00, 0x97, 0x00, 0xa2, 0x00, 0xad, 0x00, 0xb7, 0x00, 0xc1, 0x00,
+  0xce, 0x00, 0xd8, 0x00, 0xe6, 0x00, 0xf0, 0x00, 0xfd, 0x00, 0x09, 0x01,
+  0x16, 0x01, 0x23, 0x01, 0x34, 0x01, 0x40, 0x01, 0x00, 0x00, 0x0e, 0x00,
+  0x1c, 0x00, 0x30, 0x00, 0x44, 0x00, 0x51, 0x00, 0x5d, 0x00, 0x6b, 0x00,
+  0x75, 0x00, 0x81, 0x00, 0x90, 0x00, 0x9e, 0x00, 0xaa, 0x00, 0xb8, 0x00,
+  0xc6, 0x00, 0xd3, 0x00, 0xde, 0x00, 0xea, 0x00, 0xf5, 0x00, 0x04, 0x01,
+  0x12, 0x01, 0x20, 0x01, 0x30, 0x01, 0x3c, 0x01, 0x4b, 0x01, 0x59, 0x01,
+  0x68, 0x01, 0x76, 0x01, 0x82, 0x01, 0x8e, 0x01, 0x9c, 0x01, 0xac, 0x01,
+  0xba, 0x01, 0xcd, 0x01, 0xd9, 0x01, 0xe7, 0x01, 0xf3, 0x01, 0x04, 0x02,
+  0x12, 0x02, 0x00, 0x00, 0x35, 0x00, 0x40, 0x00, 0x4c, 0x00, 0x5a, 0x00,
+  0x64, 0x00, 0x74, 0x00, 0x82, 0x00, 0x8d, 0x00, 0x99, 0x00, 0xa4, 0x00,
+  0xb2, 0x00, 0xc0, 0x00, 0xd8, 0x00, 0xe6, 0x00, 0xf0, 0x00, 0xfc, 0x00,
+  0x0c, 0x01, 0x1a, 0x01, 0x2a, 0x01, 0x36, 0x01, 0x43, 0x01, 0x4f, 0x01,
+  0x5b, 0x01, 0x6b, 0x01, 0x77, 0x01, 0x83, 0x01, 0x93, 0x01, 0x00, 0x00,
+  0x0c, 0x00, 0x18, 0x00, 0x25, 0x00, 0x35, 0x00, 0x41, 0x00, 0x4d, 0x00,
+  0x5a, 0x00, 0x66, 0x00, 0x74, 0x00, 0x80, 0x00, 0x8d, 0x00, 0x9b, 0x00,
+  0xa9, 0x00, 0xb7, 0x00, 0xc4, 0x00, 0xd0, 0x00, 0xe1, 0x00, 0xee, 0x00,
+  0xfc, 0x00, 0x13, 0x01, 0x20, 0x01, 0x31, 0x01, 0x3d, 0x01, 0x4d, 0x01,
+  0x00, 0x00, 0x12, 0x00, 0x22, 0x00, 0x33, 0x00, 0x41, 0x00, 0x52, 0x00,
+  0x5f, 0x00, 0x6d, 0x00, 0x80, 0x00, 0x93, 0x00, 0xa1, 0x00, 0xb3, 0x00,
+  0xc1, 0x00, 0xcf, 0x00, 0xdd, 0x00, 0xea, 0x00, 0xf7, 0x00, 0x05, 0x01,
+  0x13, 0x01, 0x21, 0x01, 0x2f, 0x01, 0x3d, 0x01, 0x4a, 0x01, 0x56, 0x01,
+  0x64, 0x01, 0x72, 0x01, 0x00, 0x00, 0x11, 0x00, 0x1f, 0x00, 0x2b, 0x00,
+  0x37, 0x00, 0x45, 0x00, 0x56, 0x00, 0x61, 0x00, 0x70, 0x00, 0x80, 0x00,
+  0x93, 0x00, 0x9f, 0x00, 0xad, 0x00, 0xbe, 0x00, 0xca, 0x00, 0xd6, 0x00,
+  0xe1, 0x00, 0xed, 0x00, 0xfb, 0x00, 0x09, 0x01, 0x17, 0x01, 0x28, 0x01,
+  0x36, 0x01, 0x42, 0x01, 0x4f, 0x01, 0x5b, 0x01, 0x6d, 0x01, 0x79, 0x01,
+  0x85, 0x01, 0x91, 0x01, 0x9d, 0x01, 0xa7, 0x01, 0xb3, 0x01, 0x00, 0x00,
+  0x10, 0x00, 0x1f, 0x00, 0x2d, 0x00, 0x3b, 0x00, 0x4a, 0x00, 0x5c, 0x00,
+  0x6c, 0x00, 0x78, 0x00, 0x86, 0x00, 0x96, 0x00, 0xa2, 0x00, 0xb0, 0x00,
+  0xc0, 0x00, 0xd1, 0x00, 0xdd, 0x00, 0xe9, 0x00, 0xf7, 0x00, 0x07, 0x01,
+  0x16, 0x01, 0x24, 0x01, 0x32, 0x01, 0x44, 0x01, 0x50, 0x01, 0x60, 0x01,
+  0x70, 0x01, 0x82, 0x01, 0x90, 0x01, 0x9c, 0x01, 0xab, 0x01, 0xbb, 0x01,
+  0xcb, 0x01, 0xd9, 0x01, 0xe5, 0x01, 0xf4, 0x01, 0xff, 0x01, 0x0d, 0x02,
+  0x18, 0x02, 0x24, 0x02, 0x33, 0x02, 0x3f, 0x02, 0x4e, 0x02, 0x5a, 0x02,
+  0x6a, 0x02, 0x00, 0x00, 0x0c, 0x00, 0x18, 0x00, 0x26, 0x00, 0x32, 0x00,
+  0x3e, 0x00, 0x4a, 0x00, 0x56, 0x00, 0x67, 0x00, 0x73, 0x00, 0x83, 0x00,
+  0x8f, 0x00, 0x9d, 0x00, 0xad, 0x00, 0xbb, 0x00, 0xcb, 0x00, 0xd7, 0x00,
+  0xe3, 0x00, 0xf3, 0x00, 0x03, 0x01, 0x13, 0x01, 0x21, 0x01, 0x2d, 0x01,
+  0x3b, 0x01, 0x4b, 0x01, 0x57, 0x01, 0x63, 0x01, 0x6f, 0x01, 0x7f, 0x01,
+  0x8b, 0x01, 0x9b, 0x01, 0x00, 0x00, 0x19, 0x00, 0x30, 0x00, 0x42, 0x00,
+  0x54, 0x00, 0x6e, 0x00, 0x7a, 0x00, 0x86, 0x00, 0x95, 0x00, 0xa6, 0x00,
+  0xb9, 0x00, 0xcb, 0x00, 0xd9, 0x00, 0xeb, 0x00, 0xf9, 0x00, 0x0c, 0x01,
+  0x1d, 0x01, 0x2f, 0x01, 0x3d, 0x01, 0x4f, 0x01, 0x00, 0x00, 0x0c, 0x00,
+  0x1a, 0x00, 0x28, 0x00, 0x39, 0x00, 0x46, 0x00, 0x52, 0x00, 0x60, 0x00,
+  0x6c, 0x00, 0x76, 0x00, 0x82, 0x00, 0x92, 0x00, 0xa0, 0x00, 0xae, 0x00,
+  0xbc, 0x00, 0xca, 0x00, 0xd8, 0x00, 0xe7, 0x00, 0xf5, 0x00, 0x04, 0x01,
+  0x12, 0x01, 0x20, 0x01, 0x2e, 0x01, 0x3e, 0x01, 0x4a, 0x01, 0x58, 0x01,
+  0x63, 0x01, 0x71, 0x01, 0x7f, 0x01, 0x8a, 0x01, 0x95, 0x01, 0xa9, 0x01,
+  0xb7, 0x01, 0xc5, 0x01, 0xd0, 0x01, 0xdb, 0x01, 0xe5, 0x01, 0xf3, 0x01,
+  0x01, 0x02, 0x0f, 0x02, 0x1e, 0x02, 0x2d, 0x02, 0x37, 0x02, 0x46, 0x02,
+  0x57, 0x02, 0x65, 0x02, 0x73, 0x02, 0x7d, 0x02, 0x88, 0x02, 0x94, 0x02,
+  0x00, 0x00, 0x0f, 0x00, 0x19, 0x00, 0x26, 0x00, 0x32, 0x00, 0x3d, 0x00,
+  0x4b, 0x00, 0x5c, 0x00, 0x6d, 0x00, 0x78, 0x00, 0x84, 0x00, 0x96, 0x00,
+  0xa2, 0x00, 0xac, 0x00, 0xbd, 0x00, 0xce, 0x00, 0xda, 0x00, 0xe6, 0x00,
+  0xfb, 0x00, 0x07, 0x01, 0x13, 0x01, 0x21, 0x01, 0x2d, 0x01, 0x3b, 0x01,
+  0x53, 0x01, 0x61, 0x01, 0x6c, 0x01, 0x76, 0x01, 0x81, 0x01, 0x8f, 0x01,
+  0xa3, 0x01, 0xad, 0x01, 0xb8, 0x01, 0xc6, 0x01, 0x00, 0x00, 0x11, 0x00,
+  0x1f, 0x00, 0x2b, 0x00, 0x38, 0x00, 0x43, 0x00, 0x4e, 0x00, 0x5c, 0x00,
+  0x6a, 0x00, 0x75, 0x00, 0x80, 0x00, 0x8c, 0x00, 0x98, 0x00, 0xa9, 0x00,
+  0xb4, 0x00, 0xc4, 0x00, 0xd1, 0x00, 0xdf, 0x00, 0xee, 0x00, 0xf9, 0x00,
+  0x0a, 0x01, 0x19, 0x01, 0x25, 0x01, 0x30, 0x01, 0x3e, 0x01, 0x4a, 0x01,
+  0x55, 0x01, 0x61, 0x01, 0x71, 0x01, 0x81, 0x01, 0x93, 0x01, 0xa1, 0x01,
+  0xad, 0x01, 0xb8, 0x01, 0xc3, 0x01, 0xd1, 0x01, 0xdf, 0x01, 0xef, 0x01,
+  0x00, 0x02, 0x10, 0x02, 0x1c, 0x02, 0x28, 0x02, 0x34, 0x02, 0x41, 0x02,
+  0x4d, 0x02, 0x5e, 0x02, 0x6c, 0x02, 0x78, 0x02, 0x89, 0x02, 0x95, 0x02,
+  0x00, 0x00, 0x0e, 0x00, 0x1e, 0x00, 0x2c, 0x00, 0x38, 0x00, 0x44, 0x00,
+  0x4f, 0x00, 0x59, 0x00, 0x63, 0x00, 0x71, 0x00, 0x7f, 0x00, 0x8d, 0x00,
+  0x9b, 0x00, 0xa7, 0x00, 0xb8, 0x00, 0xc4, 0x00, 0xd0, 0x00, 0xe3, 0x00,
+  0xed, 0x00, 0xf7, 0x00, 0x06, 0x01, 0x12, 0x01, 0x21, 0x01, 0x2d, 0x01,
+  0x3b, 0x01, 0x49, 0x01, 0x57, 0x01, 0x65, 0x01, 0x6f, 0x01, 0x00, 0x00,
+  0x0e, 0x00, 0x1a, 0x00, 0x25, 0x00, 0x31, 0x00, 0x3c, 0x00, 0x47, 0x00,
+  0x54, 0x00, 0x62, 0x00, 0x6e, 0x00, 0x80, 0x00, 0x8f, 0x00, 0x9d, 0x00,
+  0xa8, 0x00, 0xb6, 0x00, 0xc5, 0x00, 0xd1, 0x00, 0xdd, 0x00, 0xec, 0x00,
+  0xfa, 0x00, 0x08, 0x01, 0x1c, 0x01, 0x28, 0x01, 0x37, 0x01, 0x45, 0x01,
+  0x53, 0x01, 0x66, 0x01, 0x72, 0x01, 0x7d, 0x01, 0x8b, 0x01, 0x9c, 0x01,
+  0xaa, 0x01, 0xbb, 0x01, 0xcd, 0x01, 0xd7, 0x01, 0xe5, 0x01, 0xf4, 0x01,
+  0x03, 0x02, 0x11, 0x02, 0x1c, 0x02, 0x2b, 0x02, 0x35, 0x02, 0x43, 0x02,
+  0x51, 0x02, 0x5f, 0x02, 0x6e, 0x02, 0x7c, 0x02, 0x8a, 0x02, 0x00, 0x00,
+  0x0e, 0x00, 0x18, 0x00, 0x23, 0x00, 0x2e, 0x00, 0x3f, 0x00, 0x4b, 0x00,
+  0x5b, 0x00, 0x65, 0x00, 0x73, 0x00, 0x7d, 0x00, 0x8c, 0x00, 0x97, 0x00,
+  0xa5, 0x00, 0xb1, 0x00, 0xbf, 0x00, 0xc9, 0x00, 0xd5, 0x00, 0xec, 0x00,
+  0xf6, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1f, 0x00, 0x2f, 0x00, 0x3c, 0x00,
+  0x48, 0x00, 0x59, 0x00, 0x66, 0x00, 0x72, 0x00, 0x7f, 0x00, 0x8b, 0x00,
+  0x97, 0x00, 0xa8, 0x00, 0xb4, 0x00, 0xc4, 0x00, 0xd2, 0x00, 0xdf, 0x00,
+  0xec, 0x00, 0xf8, 0x00, 0x09, 0x01, 0x15, 0x01, 0x28, 0x01, 0x34, 0x01,
+  0x43, 0x01, 0x4f, 0x01, 0x5b, 0x01, 0x67, 0x01, 0x75, 0x01, 0x81, 0x01,
+  0x8d, 0x01, 0x99, 0x01, 0xa6, 0x01, 0xb8, 0x01, 0xc4, 0x01, 0xd0, 0x01,
+  0xdc, 0x01, 0xed, 0x01, 0x00, 0x00, 0x0d, 0x00, 0x20, 0x00, 0x2c, 0x00,
+  0x3c, 0x00, 0x48, 0x00, 0x55, 0x00, 0x66, 0x00, 0x72, 0x00, 0x7f, 0x00,
+  0x89, 0x00, 0x96, 0x00, 0xa4, 0x00, 0xb0, 0x00, 0xbc, 0x00, 0xca, 0x00,
+  0xd8, 0x00, 0xe9, 0x00, 0xf6, 0x00, 0x0f, 0x01, 0x1b, 0x01, 0x2d, 0x01,
+  0x00, 0x00, 0x19, 0x00, 0x29, 0x00, 0x36, 0x00, 0x46, 0x00, 0x54, 0x00,
+  0x60, 0x00, 0x6e, 0x00, 0x81, 0x00, 0x98, 0x00, 0xa5, 0x00, 0xb6, 0x00,
+  0xc1, 0x00, 0xcf, 0x00, 0xe0, 0x00, 0xeb, 0x00, 0xf6, 0x00, 0x00, 0x01,
+  0x0b, 0x01, 0x1e, 0x01, 0x2c, 0x01, 0x39, 0x01, 0x44, 0x01, 0x55, 0x01,
+  0x60, 0x01, 0x6c, 0x01, 0x78, 0x01, 0x82, 0x01, 0x8c, 0x01, 0x96, 0x01,
+  0xa2, 0x01, 0xad, 0x01, 0xbd, 0x01, 0xce, 0x01, 0xd9, 0x01, 0xe7, 0x01,
+  0xf3, 0x01, 0x00, 0x00, 0x0e, 0x00, 0x1e, 0x00, 0x2a, 0x00, 0x38, 0x00,
+  0x46, 0x00, 0x54, 0x00, 0x62, 0x00, 0x6e, 0x00, 0x7a, 0x00, 0x87, 0x00,
+  0x94, 0x00, 0xa0, 0x00, 0xac, 0x00, 0xb8, 0x00, 0xc3, 0x00, 0xd1, 0x00,
+  0xde, 0x00, 0xec, 0x00, 0xf8, 0x00, 0x06, 0x01, 0x13, 0x01, 0x20, 0x01,
+  0x2c, 0x01, 0x38, 0x01, 0x00, 0x00, 0x0e, 0x00, 0x1a, 0x00, 0x26, 0x00,
+  0x32, 0x00, 0x3e, 0x00, 0x4c, 0x00, 0x5a, 0x00, 0x66, 0x00, 0x72, 0x00,
+  0x7e, 0x00, 0x8c, 0x00, 0x98, 0x00, 0xa4, 0x00, 0xb0, 0x00, 0xbc, 0x00,
+  0xc8, 0x00, 0xd5, 0x00, 0xe1, 0x00, 0xed, 0x00, 0xf9, 0x00, 0x05, 0x01,
+  0x13, 0x01, 0x20, 0x01, 0x2c, 0x01, 0x38, 0x01, 0x46, 0x01, 0x52, 0x01,
+  0x61, 0x01, 0x6d, 0x01, 0x7d, 0x01, 0x8d, 0x01, 0x9b, 0x01, 0xa7, 0x01,
+  0xb5, 0x01, 0xc1, 0x01, 0xcd, 0x01, 0xda, 0x01, 0xe6, 0x01, 0xf4, 0x01,
+  0x02, 0x02, 0x12, 0x02, 0x1e, 0x02, 0x2c, 0x02, 0x38, 0x02, 0x46, 0x02,
+  0x52, 0x02, 0x00, 0x00, 0x0e, 0x00, 0x1c, 0x00, 0x2e, 0x00, 0x3c, 0x00,
+  0x48, 0x00, 0x55, 0x00, 0x61, 0x00, 0x6d, 0x00, 0x7a, 0x00, 0x87, 0x00,
+  0x94, 0x00, 0xa1, 0x00, 0xaf, 0x00, 0xbb, 0x00, 0xc8, 0x00, 0xd4, 0x00,
+  0xe1, 0x00, 0xee, 0x00, 0xfb, 0x00, 0x08, 0x01, 0x14, 0x01, 0x21, 0x01,
+  0x2e, 0x01, 0x3e, 0x01, 0x4a, 0x01, 0x57, 0x01, 0x67, 0x01, 0x74, 0x01,
+  0x80, 0x01, 0x8d, 0x01, 0x99, 0x01, 0xa5, 0x01, 0xb1, 0x01, 0xbe, 0x01,
+  0xcb, 0x01, 0xd9, 0x01, 0xe6, 0x01, 0xf3, 0x01, 0x01, 0x02, 0x0e, 0x02,
+  0x00, 0x00, 0x0e, 0x00, 0x1a, 0x00, 0x28, 0x00, 0x36, 0x00, 0x44, 0x00,
+  0x53, 0x00, 0x61, 0x00, 0x6f, 0x00, 0x7d, 0x00, 0x89, 0x00, 0x97, 0x00,
+  0xa7, 0x00, 0xb5, 0x00, 0xc3, 0x00, 0xd1, 0x00, 0xdf, 0x00, 0xeb, 0x00,
+  0xfb, 0x00, 0x09, 0x01, 0x1a, 0x01, 0x27, 0x01, 0x35, 0x01, 0x43, 0x01,
+  0x51, 0x01, 0x5f, 0x01, 0x6e, 0x01, 0x7a, 0x01, 0x88, 0x01, 0x96, 0x01,
+  0xa4, 0x01, 0xb3, 0x01, 0xc3, 0x01, 0xd0, 0x01, 0x00, 0x00, 0x0e, 0x00,
+  0x1e, 0x00, 0x2e, 0x00, 0x3e, 0x00, 0x4e, 0x00, 0x5c, 0x00, 0x6c, 0x00,
+  0x7a, 0x00, 0x88, 0x00, 0x97, 0x00, 0xa5, 0x00, 0xb3, 0x00, 0xbf, 0x00,
+  0xcb, 0x00, 0xdb, 0x00, 0xe9, 0x00, 0xf7, 0x00, 0x07, 0x01, 0x11, 0x01,
+  0x1f, 0x01, 0x2f, 0x01, 0x41, 0x01, 0x4d, 0x01, 0x59, 0x01, 0x69, 0x01,
+  0x77, 0x01, 0x81, 0x01, 0x8f, 0x01, 0x9d, 0x01, 0xaf, 0x01, 0xbe, 0x01,
+  0xca, 0x01, 0xd8, 0x01, 0xe6, 0x01, 0xf6, 0x01, 0x00, 0x02, 0x0a, 0x02,
+  0x16, 0x02, 0x27, 0x02, 0x35, 0x02, 0x43, 0x02, 0x53, 0x02, 0x00, 0x00,
+  0x0f, 0x00, 0x1b, 0x00, 0x27, 0x00, 0x34, 0x00, 0x41, 0x00, 0x4d, 0x00,
+  0x5a, 0x00, 0x66, 0x00, 0x76, 0x00, 0x82, 0x00, 0x8f, 0x00, 0xa6, 0x00,
+  0xb2, 0x00, 0xbf, 0x00, 0xcd, 0x00, 0xda, 0x00, 0xe6, 0x00, 0xf2, 0x00,
+  0xfe, 0x00, 0x0b, 0x01, 0x17, 0x01, 0x23, 0x01, 0x30, 0x01, 0x42, 0x01,
+  0x52, 0x01, 0x5e, 0x01, 0x6a, 0x01, 0x76, 0x01, 0x82, 0x01, 0x8f, 0x01,
+  0x9c, 0x01, 0xa8, 0x01, 0xb4, 0x01, 0x00, 0x00, 0x12, 0x00, 0x24, 0x00,
+  0x36, 0x00, 0x42, 0x00, 0x54, 0x00, 0x66, 0x00, 0x77, 0x00, 0x8a, 0x00,
+  0x9b, 0x00, 0xab, 0x00, 0xb7, 0x00, 0xc4, 0x00, 0xd4, 0x00, 0xe6, 0x00,
+  0xf8, 0x00, 0x09, 0x01, 0x1c, 0x01, 0x28, 0x01, 0x3a, 0x01, 0x4c, 0x01,
+  0x5f, 0x01, 0x6c, 0x01, 0x7f, 0x01, 0x00, 0x00, 0x10, 0x00, 0x1e, 0x00,
+  0x2c, 0x00, 0x3a, 0x00, 0x4a, 0x00, 0x56, 0x00, 0x60, 0x00, 0x70, 0x00,
+  0x83, 0x00, 0x90, 0x00, 0x9c, 0x00, 0xaa, 0x00, 0xb3, 0x00, 0xc1, 0x00,
+  0xcf, 0x00, 0xdb, 0x00, 0xe9, 0x00, 0xf9, 0x00, 0x0b, 0x01, 0x19, 0x01,
+  0x27, 0x01, 0x35, 0x01, 0x41, 0x01, 0x4d, 0x01, 0x5e, 0x01, 0x6a, 0x01,
+  0x76, 0x01, 0x84, 0x01, 0x90, 0x01, 0xa0, 0x01, 0x00, 0x00, 0x0f, 0x00,
+  0x23, 0x00, 0x31, 0x00, 0x3d, 0x00, 0x47, 0x00, 0x53, 0x00, 0x5e, 0x00,
+  0x6a, 0x00, 0x77, 0x00, 0x89, 0x00, 0x97, 0x00, 0xa6, 0x00, 0xb2, 0x00,
+  0xbc, 0x00, 0xc8, 0x00, 0xd6, 0x00, 0xe4, 0x00, 0xf0, 0x00, 0xfe, 0x00,
+  0x00, 0x00, 0x1b, 0x00, 0x2e, 0x00, 0x3c, 0x00, 0x47, 0x00, 0x5b, 0x00,
+  0x67, 0x00, 0x86, 0x00, 0x95, 0x00, 0xa0, 0x00, 0xb1, 0x00, 0xbe, 0x00,
+  0xcf, 0x00, 0xdd, 0x00, 0xed, 0x00, 0xf8, 0x00, 0x09, 0x01, 0x14, 0x01,
+  0x22, 0x01, 0x2f, 0x01, 0x3a, 0x01, 0x45, 0x01, 0x57, 0x01, 0x63, 0x01,
+  0x6e, 0x01, 0x7f, 0x01, 0x8a, 0x01, 0x99, 0x01, 0xa4, 0x01, 0xaf, 0x01,
+  0xc0, 0x01, 0xd0, 0x01, 0xdb, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x1c, 0x00,
+  0x28, 0x00, 0x39, 0x00, 0x48, 0x00, 0x54, 0x00, 0x68, 0x00, 0x77, 0x00,
+  0x8b, 0x00, 0x9a, 0x00, 0xac, 0x00, 0xba, 0x00, 0xc8, 0x00, 0xd5, 0x00,
+  0xe3, 0x00, 0xf2, 0x00, 0x06, 0x01, 0x14, 0x01, 0x24, 0x01, 0x36, 0x01,
+  0x00, 0x00, 0x19, 0x00, 0x28, 0x00, 0x36, 0x00, 0x44, 0x00, 0x52, 0x00,
+  0x60, 0x00, 0x6e, 0x00, 0x7d, 0x00, 0x8b, 0x00, 0x9a, 0x00, 0xa8, 0x00,
+  0xb7, 0x00, 0xc5, 0x00, 0xd3, 0x00, 0xe6, 0x00, 0xf5, 0x00, 0x03, 0x01,
+  0x12, 0x01, 0x27, 0x01, 0x35, 0x01, 0x43, 0x01, 0x51, 0x01, 0x60, 0x01,
+  0x76, 0x01, 0x89, 0x01, 0x98, 0x01, 0xa6, 0x01, 0xb4, 0x01, 0xc2, 0x01,
+  0xd0, 0x01, 0xde, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x1a, 0x00, 0x26, 0x00,
+  0x33, 0x00, 0x3f, 0x00, 0x4b, 0x00, 0x58, 0x00, 0x6b, 0x00, 0x79, 0x00,
+  0x86, 0x00, 0x98, 0x00, 0xa6, 0x00, 0xb2, 0x00, 0xbc, 0x00, 0xcf, 0x00,
+  0xdb, 0x00, 0xe7, 0x00, 0xf3, 0x00, 0xff, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x1e, 0x00, 0x2f, 0x00, 0x3b, 0x00, 0x4d, 0x00, 0x59, 0x00, 0x65, 0x00,
+  0x76, 0x00, 0x82, 0x00, 0x8e, 0x00, 0x9a, 0x00, 0xab, 0x00, 0xb7, 0x00,
+  0xc2, 0x00, 0xd0, 0x00, 0xdf, 0x00, 0xeb, 0x00, 0xfa, 0x00, 0x05, 0x01,
+  0x11, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x35, 0x01, 0x00, 0x00, 0x28, 0x00,
+  0x50, 0x00, 0x76, 0x00, 0x9e, 0x00, 0xc1, 0x00, 0xd9, 0x00, 0xf2, 0x00,
+  0x08, 0x01, 0x16, 0x01, 0x20, 0x01, 0x2c, 0x01, 0x39, 0x01, 0x45, 0x01,
+  0x52, 0x01, 0x5e, 0x01, 0x6a, 0x01, 0x76, 0x01, 0x82, 0x01, 0x90, 0x01,
+  0x9c, 0x01, 0xa6, 0x01, 0xb2, 0x01, 0xbe, 0x01, 0xce, 0x01, 0xdc, 0x01,
+  0xe9, 0x01, 0xf7, 0x01, 0x03, 0x02, 0x0f, 0x02, 0x1d, 0x02, 0x25, 0x02,
+  0x33, 0x02, 0x3f, 0x02, 0x54, 0x02, 0x60, 0x02, 0x6e, 0x02, 0x7c, 0x02,
+  0x00, 0x00, 0x0c, 0x00, 0x16, 0x00, 0x24, 0x00, 0x32, 0x00, 0x40, 0x00,
+  0x4c, 0x00, 0x5e, 0x00, 0x6c, 0x00, 0x7a, 0x00, 0x88, 0x00, 0x96, 0x00,
+  0xa0, 0x00, 0xaa, 0x00, 0xb8, 0x00, 0xc6, 0x00, 0xd6, 0x00, 0xe6, 0x00,
+  0xf4, 0x00, 0x07, 0x01, 0x11, 0x01, 0x1b, 0x01, 0x29, 0x01, 0x37, 0x01,
+  0x45, 0x01, 0x4f, 0x01, 0x5b, 0x01, 0x00, 0x00, 0x24, 0x00, 0x4a, 0x00,
+  0x6e, 0x00, 0x98, 0x00, 0xbe, 0x00, 0xd4, 0x00, 0xf6, 0x00, 0x01, 0x01,
+  0x0d, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x38, 0x01, 0x46, 0x01, 0x52, 0x01,
+  0x5f, 0x01, 0x6b, 0x01, 0x77, 0x01, 0x83, 0x01, 0x8e, 0x01, 0x9d, 0x01,
+  0xab, 0x01, 0xb5, 0x01, 0xbf, 0x01, 0xcd, 0x01, 0xe5, 0x01, 0xf1, 0x01,
+  0xfd, 0x01, 0x09, 0x02, 0x15, 0x02, 0x25, 0x02, 0x31, 0x02, 0x3d, 0x02,
+  0x4c, 0x02, 0x5a, 0x02, 0x6a, 0x02, 0x78, 0x02, 0x86, 0x02, 0x94, 0x02,
+  0x9f, 0x02, 0xab, 0x02, 0xb9, 0x02, 0xc9, 0x02, 0xda, 0x02, 0xe8, 0x02,
+  0xf4, 0x02, 0x00, 0x03, 0x00, 0x00, 0x0d, 0x00, 0x1d, 0x00, 0x2e, 0x00,
+  0x3a, 0x00, 0x48, 0x00, 0x55, 0x00, 0x61, 0x00, 0x6d, 0x00, 0x7b, 0x00,
+  0x87, 0x00, 0x9d, 0x00, 0xae, 0x00, 0xba, 0x00, 0xcf, 0x00, 0xdb, 0x00,
+  0xe7, 0x00, 0xf3, 0x00, 0x01, 0x01, 0x12, 0x01, 0x1e, 0x01, 0x2a, 0x01,
+  0x36, 0x01, 0x42, 0x01, 0x4e, 0x01, 0x5a, 0x01, 0x66, 0x01, 0x72, 0x01,
+  0x81, 0x01, 0x8f, 0x01, 0x9c, 0x01, 0xa8, 0x01, 0xb4, 0x01, 0xc3, 0x01,
+  0xcf, 0x01, 0xdb, 0x01, 0xe9, 0x01, 0xf5, 0x01, 0x03, 0x02, 0x0f, 0x02,
+  0x1b, 0x02, 0x2a, 0x02, 0x3b, 0x02, 0x4c, 0x02, 0x58, 0x02, 0x00, 0x00,
+  0x0e, 0x00, 0x1c, 0x00, 0x29, 0x00, 0x3b, 0x00, 0x4c, 0x00, 0x57, 0x00,
+  0x64, 0x00, 0x76, 0x00, 0x83, 0x00, 0x91, 0x00, 0x9f, 0x00, 0xa9, 0x00,
+  0xb5, 0x00, 0xc2, 0x00, 0xcf, 0x00, 0xdd, 0x00, 0xe9, 0x00, 0xf7, 0x00,
+  0x05, 0x01, 0x13, 0x01, 0x1f, 0x01, 0x2d, 0x01, 0x39, 0x01, 0x45, 0x01,
+  0x53, 0x01, 0x5e, 0x01, 0x6d, 0x01, 0x7a, 0x01, 0x86, 0x01, 0x94, 0x01,
+  0xa2, 0x01, 0xb0, 0x01, 0xbc, 0x01, 0xc8, 0x01, 0xd6, 0x01, 0xe4, 0x01,
+  0xf0, 0x01, 0x00, 0x00, 0x0e, 0x00, 0x1b, 0x00, 0x29, 0x00, 0x37, 0x00,
+  0x43, 0x00, 0x4d, 0x00, 0x57, 0x00, 0x64, 0x00, 0x72, 0x00, 0x80, 0x00,
+  0x8b, 0x00, 0x97, 0x00, 0xa5, 0x00, 0xb8, 0x00, 0xc6, 0x00, 0xd3, 0x00,
+  0xde, 0x00, 0xf0, 0x00, 0xfe, 0x00, 0x0c, 0x01, 0x1a, 0x01, 0x28, 0x01,
+  0x32, 0x01, 0x3e, 0x01, 0x4d, 0x01, 0x59, 0x01, 0x64, 0x01, 0x72, 0x01,
+  0x7d, 0x01, 0x87, 0x01, 0x95, 0x01, 0xa6, 0x01, 0xb0, 0x01, 0xbb, 0x01,
+  0xc9, 0x01, 0xd7, 0x01, 0xe5, 0x01, 0xf1, 0x01, 0xfb, 0x01, 0x07, 0x02,
+  0x1a, 0x02, 0x24, 0x02, 0x2e, 0x02, 0x39, 0x02, 0x43, 0x02, 0x00, 0x00,
+  0x0e, 0x00, 0x1a, 0x00, 0x29, 0x00, 0x33, 0x00, 0x3f, 0x00, 0x50, 0x00,
+  0x60, 0x00, 0x6b, 0x00, 0x79, 0x00, 0x8c, 0x00, 0x9d, 0x00, 0xa7, 0x00,
+  0xb3, 0x00, 0xbf, 0x00, 0xcd, 0x00, 0xdd, 0x00, 0xeb, 0x00, 0xfe, 0x00,
+  0x0a, 0x01, 0x18, 0x01, 0x24, 0x01, 0x32, 0x01, 0x41, 0x01, 0x4d, 0x01,
+  0x5d, 0x01, 0x6d, 0x01, 0x7b, 0x01, 0x89, 0x01, 0x97, 0x01, 0xa7, 0x01,
+  0xb7, 0x01, 0xc5, 0x01, 0xd1, 0x01, 0xdf, 0x01, 0xef, 0x01, 0xff, 0x01,
+  0x0d, 0x02, 0x19, 0x02, 0x29, 0x02, 0x3a, 0x02, 0x44, 0x02, 0x52, 0x02,
+  0x5d, 0x02, 0x69, 0x02, 0x79, 0x02, 0x89, 0x02, 0x98, 0x02, 0xa2, 0x02,
+  0xac, 0x02, 0xb8, 0x02, 0xc6, 0x02, 0x00, 0x00, 0x0c, 0x00, 0x1a, 0x00,
+  0x26, 0x00, 0x32, 0x00, 0x3e, 0x00, 0x4c, 0x00, 0x5c, 0x00, 0x68, 0x00,
+  0x77, 0x00, 0x83, 0x00, 0x91, 0x00, 0x9d, 0x00, 0xaa, 0x00, 0xb6, 0x00,
+  0xc2, 0x00, 0xce, 0x00, 0xde, 0x00, 0x00, 0x00, 0x19, 0x00, 0x24, 0x00,
+  0x3a, 0x00, 0x4c, 0x00, 0x58, 0x00, 0x66, 0x00, 0x74, 0x00, 0x7f, 0x00,
+  0x92, 0x00, 0xa6, 0x00, 0xb5, 0x00, 0xc1, 0x00, 0xd2, 0x00, 0xe0, 0x00,
+  0xef, 0x00, 0x03, 0x01, 0x12, 0x01, 0x20, 0x01, 0x32, 0x01, 0x40, 0x01,
+  0x51, 0x01, 0x5f, 0x01, 0x69, 0x01, 0x7a, 0x01, 0x89, 0x01, 0x97, 0x01,
+  0xa5, 0x01, 0xb3, 0x01, 0xc1, 0x01, 0xd3, 0x01, 0xe2, 0x01, 0xf0, 0x01,
+  0xfb, 0x01, 0x07, 0x02, 0x18, 0x02, 0x2a, 0x02, 0x36, 0x02, 0x41, 0x02,
+  0x4f, 0x02, 0x59, 0x02, 0x68, 0x02, 0x76, 0x02, 0x84, 0x02, 0x92, 0x02,
+  0xa4, 0x02, 0xb1, 0x02, 0xc4, 0x02, 0xd2, 0x02, 0xe3, 0x02, 0xef, 0x02,
+  0xfe, 0x02, 0x0c, 0x03, 0x1a, 0x03, 0x28, 0x03, 0x00, 0x00, 0x12, 0x00,
+  0x21, 0x00, 0x2c, 0x00, 0x3a, 0x00, 0x4c, 0x00, 0x58, 0x00, 0x63, 0x00,
+  0x72, 0x00, 0x87, 0x00, 0x95, 0x00, 0xa3, 0x00, 0xb1, 0x00, 0xbf, 0x00,
+  0xcd, 0x00, 0xd8, 0x00, 0xe7, 0x00, 0xf2, 0x00, 0x00, 0x01, 0x0e, 0x01,
+  0x1e, 0x01, 0x29, 0x01, 0x37, 0x01, 0x45, 0x01, 0x51, 0x01, 0x5d, 0x01,
+  0x6b, 0x01, 0x76, 0x01, 0x80, 0x01, 0x8e, 0x01, 0x9c, 0x01, 0xaa, 0x01,
+  0xbb, 0x01, 0xc9, 0x01, 0xd7, 0x01, 0xe4, 0x01, 0xf2, 0x01, 0xfe, 0x01,
+  0x0a, 0x02, 0x14, 0x02, 0x1e, 0x02, 0x32, 0x02, 0x3d, 0x02, 0x00, 0x00,
+  0x0d, 0x00, 0x22, 0x00, 0x30, 0x00, 0x41, 0x00, 0x50, 0x00, 0x5e, 0x00,
+  0x71, 0x00, 0x80, 0x00, 0x8b, 0x00, 0x96, 0x00, 0xa6, 0x00, 0xb4, 0x00,
+  0xc8, 0x00, 0xd6, 0x00, 0xe2, 0x00, 0xf3, 0x00, 0xfd, 0x00, 0x0b, 0x01,
+  0x1f, 0x01, 0x2c, 0x01, 0x40, 0x01, 0x55, 0x01, 0x63, 0x01, 0x72, 0x01,
+  0x80, 0x01, 0x8e, 0x01, 0x9a, 0x01, 0xa5, 0x01, 0xb3, 0x01, 0xc8, 0x01,
+  0xd6, 0x01, 0xe9, 0x01, 0xf7, 0x01, 0x05, 0x02, 0x13, 0x02, 0x21, 0x02,
+  0x00, 0x00, 0x0c, 0x00, 0x17, 0x00, 0x25, 0x00, 0x30, 0x00, 0x3e, 0x00,
+  0x4e, 0x00, 0x5a, 0x00, 0x66, 0x00, 0x74, 0x00, 0x7f, 0x00, 0x8a, 0x00,
+  0x95, 0x00, 0xa1, 0x00, 0xac, 0x00, 0xbb, 0x00, 0xc8, 0x00, 0xdb, 0x00,
+  0xe6, 0x00, 0xf1, 0x00, 0x01, 0x01, 0x0c, 0x01, 0x17, 0x01, 0x25, 0x01,
+  0x36, 0x01, 0x44, 0x01, 0x52, 0x01, 0x5d, 0x01, 0x6d, 0x01, 0x78, 0x01,
+  0x88, 0x01, 0x9d, 0x01, 0xad, 0x01, 0xbb, 0x01, 0xc3, 0x01, 0xd3, 0x01,
+  0xde, 0x01, 0xee, 0x01, 0xfe, 0x01, 0x0e, 0x02, 0x19, 0x02, 0x2a, 0x02,
+  0x3b, 0x02, 0x48, 0x02, 0x00, 0x00, 0x0e, 0x00, 0x19, 0x00, 0x2f, 0x00,
+  0x44, 0x00, 0x56, 0x00, 0x69, 0x00, 0x75, 0x00, 0x81, 0x00, 0x94, 0x00,
+  0x9e, 0x00, 0xaf, 0x00, 0xc3, 0x00, 0xd3, 0x00, 0xe6, 0x00, 0xf0, 0x00,
+  0xfa, 0x00, 0x0a, 0x01, 0x1b, 0x01, 0x29, 0x01, 0x40, 0x01, 0x55, 0x01,
+  0x63, 0x01, 0x75, 0x01, 0x83, 0x01, 0x92, 0x01, 0x9c, 0x01, 0x00, 0x00,
+  0x0e, 0x00, 0x18, 0x00, 0x26, 0x00, 0x30, 0x00, 0x40, 0x00, 0x4f, 0x00,
+  0x5d, 0x00, 0x70, 0x00, 0x82, 0x00, 0x91, 0x00, 0x9f, 0x00, 0xb3, 0x00,
+  0xc1, 0x00, 0xcf, 0x00, 0xdb, 0x00, 0xe5, 0x00, 0xfb, 0x00, 0x0e, 0x01,
+  0x1c, 0x01, 0x2a, 0x01, 0x38, 0x01, 0x45, 0x01, 0x56, 0x01, 0x64, 0x01,
+  0x78, 0x01, 0x88, 0x01, 0x94, 0x01, 0xa7, 0x01, 0xbf, 0x01, 0xcd, 0x01,
+  0xd7, 0x01, 0xe3, 0x01, 0xf1, 0x01, 0xff, 0x01, 0x0b, 0x02, 0x19, 0x02,
+  0x29, 0x02, 0x34, 0x02, 0x00, 0x00, 0x0e, 0x00, 0x1d, 0x00, 0x2b, 0x00,
+  0x37, 0x00, 0x49, 0x00, 0x5b, 0x00, 0x69, 0x00, 0x75, 0x00, 0x88, 0x00,
+  0x94, 0x00, 0xa2, 0x00, 0xb6, 0x00, 0xc1, 0x00, 0xd4, 0x00, 0xe8, 0x00,
+  0xfc, 0x00, 0x0a, 0x01, 0x00, 0x00, 0x1e, 0x00, 0x2e, 0x00, 0x3b, 0x00,
+  0x49, 0x00, 0x57, 0x00, 0x65, 0x00, 0x71, 0x00, 0x7d, 0x00, 0x8a, 0x00,
+  0x9b, 0x00, 0xa7, 0x00, 0xb4, 0x00, 0xc5, 0x00, 0xd9, 0x00, 0xe7, 0x00,
+  0xf4, 0x00, 0x04, 0x01, 0x15, 0x01, 0x26, 0x01, 0x36, 0x01, 0x42, 0x01,
+  0x53, 0x01, 0x61, 0x01, 0x72, 0x01, 0x7e, 0x01, 0x8e, 0x01, 0x9f, 0x01,
+  0xb0, 0x01, 0x00, 0x00, 0x1a, 0x00, 0x3b, 0x00, 0x60, 0x00, 0x90, 0x00,
+  0xb3, 0x00, 0xd2, 0x00, 0xf5, 0x00, 0x01, 0x01, 0x0d, 0x01, 0x1f, 0x01,
+  0x31, 0x01, 0x4a, 0x01, 0x56, 0x01, 0x6b, 0x01, 0x7f, 0x01, 0x90, 0x01,
+  0x9b, 0x01, 0xa8, 0x01, 0xbc, 0x01, 0xc8, 0x01, 0x00, 0x00, 0x1c, 0x00,
+  0x2a, 0x00, 0x3a, 0x00, 0x45, 0x00, 0x53, 0x00, 0x63, 0x00, 0x71, 0x00,
+  0x7e, 0x00, 0x8c, 0x00, 0x96, 0x00, 0xa6, 0x00, 0xb2, 0x00, 0xc0, 0x00,
+  0xca, 0x00, 0xda, 0x00, 0xec, 0x00, 0xfa, 0x00, 0x05, 0x01, 0x13, 0x01,
+  0x1d, 0x01, 0x2b, 0x01, 0x39, 0x01, 0x42, 0x01, 0x50, 0x01, 0x5e, 0x01,
+  0x6c, 0x01, 0x7b, 0x01, 0x8a, 0x01, 0x98, 0x01, 0xa1, 0x01, 0xac, 0x01,
+  0x00, 0x00, 0x18, 0x00, 0x37, 0x00, 0x5a, 0x00, 0x88, 0x00, 0xa9, 0x00,
+  0xe6, 0x00, 0x05, 0x01, 0x16, 0x01, 0x24, 0x01, 0x30, 0x01, 0x3a, 0x01,
+  0x46, 0x01, 0x54, 0x01, 0x62, 0x01, 0x7b, 0x01, 0x89, 0x01, 0x00, 0x00,
+  0x1d, 0x00, 0x31, 0x00, 0x46, 0x00, 0x56, 0x00, 0x62, 0x00, 0x70, 0x00,
+  0x7c, 0x00, 0x88, 0x00, 0x96, 0x00, 0xa6, 0x00, 0xb4, 0x00, 0xc0, 0x00,
+  0xce, 0x00, 0xdc, 0x00, 0xe8, 0x00, 0xf8, 0x00, 0x04, 0x01, 0x12, 0x01,
+  0x20, 0x01, 0x31, 0x01, 0x41, 0x01, 0x4d, 0x01, 0x5c, 0x01, 0x6a, 0x01,
+  0x76, 0x01, 0x00, 0x00, 0x0f, 0x00, 0x19, 0x00, 0x2c, 0x00, 0x3c, 0x00,
+  0x49, 0x00, 0x55, 0x00, 0x63, 0x00, 0x6d, 0x00, 0x7a, 0x00, 0x8b, 0x00,
+  0x99, 0x00, 0xa5, 0x00, 0xb3, 0x00, 0xbf, 0x00, 0xcd, 0x00, 0xdb, 0x00,
+  0xe5, 0x00, 0xf3, 0x00, 0x01, 0x01, 0x0d, 0x01, 0x1b, 0x01, 0x29, 0x01,
+  0x37, 0x01, 0x45, 0x01, 0x50, 0x01, 0x5d, 0x01, 0x6a, 0x01, 0x76, 0x01,
+  0x00, 0x00, 0x1b, 0x00, 0x25, 0x00, 0x33, 0x00, 0x3f, 0x00, 0x4b, 0x00,
+  0x5c, 0x00, 0x6c, 0x00, 0x7b, 0x00, 0x8a, 0x00, 0x99, 0x00, 0xa7, 0x00,
+  0xb5, 0x00, 0xcb, 0x00, 0xde, 0x00, 0xed, 0x00, 0xf9, 0x00, 0x05, 0x01,
+  0x13, 0x01, 0x25, 0x01, 0x33, 0x01, 0x45, 0x01, 0x56, 0x01, 0x61, 0x01,
+  0x6c, 0x01, 0x77, 0x01, 0x8d, 0x01, 0x97, 0x01, 0xa1, 0x01, 0xb3, 0x01,
+  0xc1, 0x01, 0xcf, 0x01, 0xdf, 0x01, 0xf1, 0x01, 0xfb, 0x01, 0x06, 0x02,
+  0x14, 0x02, 0x1f, 0x02, 0x29, 0x02, 0x34, 0x02, 0x40, 0x02, 0x4c, 0x02,
+  0x5e, 0x02, 0x6c, 0x02, 0x77, 0x02, 0x85, 0x02, 0x96, 0x02, 0x00, 0x00,
+  0x03, 0x00, 0x13, 0x00, 0x2e, 0x00, 0x3c, 0x00, 0x4a, 0x00, 0x58, 0x00,
+  0x68, 0x00, 0x7a, 0x00, 0x88, 0x00, 0x98, 0x00, 0xa8, 0x00, 0xb4, 0x00,
+  0xc5, 0x00, 0xcf, 0x00, 0xda, 0x00, 0xe7, 0x00, 0xf3, 0x00, 0x01, 0x01,
+  0x11, 0x01, 0x1d, 0x01, 0x28, 0x01, 0x34, 0x01, 0x43, 0x01, 0x51, 0x01,
+  0x5d, 0x01, 0x6b, 0x01, 0x79, 0x01, 0x87, 0x01, 0x97, 0x01, 0xa5, 0x01,
+  0xb0, 0x01, 0xc1, 0x01, 0xd0, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x1a, 0x00,
+  0x26, 0x00, 0x35, 0x00, 0x43, 0x00, 0x51, 0x00, 0x5d, 0x00, 0x6a, 0x00,
+  0x7a, 0x00, 0x86, 0x00, 0x92, 0x00, 0x9e, 0x00, 0xaa, 0x00, 0xb6, 0x00,
+  0xc3, 0x00, 0xcf, 0x00, 0xdb, 0x00, 0xf2, 0x00, 0xfe, 0x00, 0x0b, 0x01,
+  0x19, 0x01, 0x28, 0x01, 0x35, 0x01, 0x42, 0x01, 0x4e, 0x01, 0x5b, 0x01,
+  0x72, 0x01, 0x7e, 0x01, 0x8a, 0x01, 0x96, 0x01, 0xa2, 0x01, 0xae, 0x01,
+  0xbb, 0x01, 0xc7, 0x01, 0xd3, 0x01, 0xdf, 0x01, 0xec, 0x01, 0xfb, 0x01,
+  0x0f, 0x02, 0x1b, 0x02, 0x28, 0x02, 0x36, 0x02, 0x43, 0x02, 0x4f, 0x02,
+  0x5b, 0x02, 0x67, 0x02, 0x73, 0x02, 0x80, 0x02, 0x00, 0x00, 0x0f, 0x00,
+  0x20, 0x00, 0x30, 0x00, 0x42, 0x00, 0x4f, 0x00, 0x5b, 0x00, 0x6c, 0x00,
+  0x7d, 0x00, 0x8f, 0x00, 0xa0, 0x00, 0xb0, 0x00, 0xbc, 0x00, 0xcc, 0x00,
+  0xde, 0x00, 0xf1, 0x00, 0x03, 0x01, 0x14, 0x01, 0x25, 0x01, 0x35, 0x01,
+  0x47, 0x01, 0x59, 0x01, 0x68, 0x01, 0x78, 0x01, 0x83, 0x01, 0x8e, 0x01,
+  0x9e, 0x01, 0xae, 0x01, 0xbe, 0x01, 0xc8, 0x01, 0xd5, 0x01, 0xe0, 0x01,
+  0xea, 0x01, 0xf6, 0x01, 0x00, 0x00, 0x0e, 0x00, 0x1a, 0x00, 0x27, 0x00,
+  0x35, 0x00, 0x43, 0x00, 0x51, 0x00, 0x5f, 0x00, 0x6d, 0x00, 0x7a, 0x00,
+  0x85, 0x00, 0x94, 0x00, 0xa2, 0x00, 0xb1, 0x00, 0xbf, 0x00, 0xcb, 0x00,
+  0xdc, 0x00, 0xea, 0x00, 0xf6, 0x00, 0x01, 0x01, 0x0c, 0x01, 0x19, 0x01,
+  0x23, 0x01, 0x32, 0x01, 0x3d, 0x01, 0x4b, 0x01, 0x55, 0x01, 0x60, 0x01,
+  0x6b, 0x01, 0x76, 0x01, 0x89, 0x01, 0x97, 0x01, 0xa4, 0x01, 0xb2, 0x01,
+  0xc0, 0x01, 0xce, 0x01, 0xd9, 0x01, 0xe7, 0x01, 0xf3, 0x01, 0x01, 0x02,
+  0x0f, 0x02, 0x23, 0x02, 0x2e, 0x02, 0x3b, 0x02, 0x4f, 0x02, 0x5a, 0x02,
+  0x67, 0x02, 0x00, 0x00, 0x0d, 0x00, 0x19, 0x00, 0x29, 0x00, 0x3e, 0x00,
+  0x4c, 0x00, 0x5d, 0x00, 0x6e, 0x00, 0x79, 0x00, 0x89, 0x00, 0x96, 0x00,
+  0xa6, 0x00, 0xb3, 0x00, 0xc3, 0x00, 0xd3, 0x00, 0xe0, 0x00, 0xed, 0x00,
+  0xfc, 0x00, 0x0b, 0x01, 0x17, 0x01, 0x24, 0x01, 0x36, 0x01, 0x45, 0x01,
+  0x55, 0x01, 0x61, 0x01, 0x72, 0x01, 0x82, 0x01, 0x95, 0x01, 0xa5, 0x01,
+  0xb9, 0x01, 0xc9, 0x01, 0xd9, 0x01, 0xe7, 0x01, 0xf5, 0x01, 0x02, 0x02,
+  0x12, 0x02, 0x22, 0x02, 0x32, 0x02, 0x00, 0x00, 0x10, 0x00, 0x20, 0x00,
+  0x2e, 0x00, 0x39, 0x00, 0x47, 0x00, 0x52, 0x00, 0x60, 0x00, 0x6c, 0x00,
+  0x7c, 0x00, 0x89, 0x00, 0x94, 0x00, 0x9f, 0x00, 0xaa, 0x00, 0xb5, 0x00,
+  0xc0, 0x00, 0xcb, 0x00, 0xd6, 0x00, 0xe2, 0x00, 0xee, 0x00, 0xfc, 0x00,
+  0x13, 0x01, 0x27, 0x01, 0x32, 0x01, 0x3d, 0x01, 0x48, 0x01, 0x53, 0x01,
+  0x5e, 0x01, 0x6e, 0x01, 0x7b, 0x01, 0x86, 0x01, 0x91, 0x01, 0xa1, 0x01,
+  0xac, 0x01, 0xb7, 0x01, 0xc7, 0x01, 0xd2, 0x01, 0xdd, 0x01, 0xe9, 0x01,
+  0xf9, 0x01, 0x0e, 0x02, 0x1e, 0x02, 0x29, 0x02, 0x39, 0x02, 0x49, 0x02,
+  0x54, 0x02, 0x00, 0x00, 0x0c, 0x00, 0x17, 0x00, 0x22, 0x00, 0x31, 0x00,
+  0x3c, 0x00, 0x50, 0x00, 0x5e, 0x00, 0x70, 0x00, 0x81, 0x00, 0x8c, 0x00,
+  0x9a, 0x00, 0xad, 0x00, 0xb9, 0x00, 0xc5, 0x00, 0xd1, 0x00, 0xdb, 0x00,
+  0xeb, 0x00, 0xf6, 0x00, 0x00, 0x00, 0x12, 0x00, 0x20, 0x00, 0x2e, 0x00,
+  0x39, 0x00, 0x47, 0x00, 0x59, 0x00, 0x6b, 0x00, 0x79, 0x00, 0x88, 0x00,
+  0x96, 0x00, 0xa1, 0x00, 0xaf, 0x00, 0xbd, 0x00, 0xcb, 0x00, 0xda, 0x00,
+  0xe8, 0x00, 0xf6, 0x00, 0x04, 0x01, 0x14, 0x01, 0x28, 0x01, 0x36, 0x01,
+  0x41, 0x01, 0x50, 0x01, 0x5e, 0x01, 0x6e, 0x01, 0x7c, 0x01, 0x8a, 0x01,
+  0x97, 0x01, 0xa7, 0x01, 0xb5, 0x01, 0xc3, 0x01, 0xd1, 0x01, 0xdf, 0x01,
+  0xf0, 0x01, 0xfe, 0x01, 0x09, 0x02, 0x20, 0x02, 0x2b, 0x02, 0x39, 0x02,
+  0x44, 0x02, 0x54, 0x02, 0x5e, 0x02, 0x00, 0x00, 0x1e, 0x00, 0x2a, 0x00,
+  0x38, 0x00, 0x44, 0x00, 0x51, 0x00, 0x5f, 0x00, 0x6a, 0x00, 0x77, 0x00,
+  0x84, 0x00, 0x94, 0x00, 0xa0, 0x00, 0xab, 0x00, 0xb7, 0x00, 0xc2, 0x00,
+  0xcf, 0x00, 0xdb, 0x00, 0xe7, 0x00, 0xf3, 0x00, 0xfe, 0x00, 0x0b, 0x01,
+  0x17, 0x01, 0x25, 0x01, 0x36, 0x01, 0x42, 0x01, 0x4c, 0x01, 0x60, 0x01,
+  0x6b, 0x01, 0x79, 0x01, 0x85, 0x01, 0x91, 0x01, 0x9d, 0x01, 0xaa, 0x01,
+  0xb6, 0x01, 0xc4, 0x01, 0xd0, 0x01, 0x00, 0x00, 0x22, 0x00, 0x2e, 0x00,
+  0x3c, 0x00, 0x4a, 0x00, 0x55, 0x00, 0x63, 0x00, 0x6c, 0x00, 0x77, 0x00,
+  0x88, 0x00, 0x98, 0x00, 0xa3, 0x00, 0xae, 0x00, 0xbe, 0x00, 0xc9, 0x00,
+  0xd5, 0x00, 0xe1, 0x00, 0xec, 0x00, 0x03, 0x01, 0x12, 0x01, 0x1d, 0x01,
+  0x2b, 0x01, 0x38, 0x01, 0x46, 0x01, 0x53, 0x01, 0x64, 0x01, 0x70, 0x01,
+  0x7b, 0x01, 0x87, 0x01, 0x93, 0x01, 0xa0, 0x01, 0xad, 0x01, 0xb9, 0x01,
+  0xca, 0x01, 0xd7, 0x01, 0x00, 0x00, 0x2c, 0x00, 0x4d, 0x00, 0x65, 0x00,
+  0x8e, 0x00, 0xa6, 0x00, 0xc7, 0x00, 0xdf, 0x00, 0x01, 0x01, 0x0f, 0x01,
+  0x1b, 0x01, 0x2e, 0x01, 0x42, 0x01, 0x5c, 0x01, 0x6a, 0x01, 0x80, 0x01,
+  0x8a, 0x01, 0x97, 0x01, 0xa7, 0x01, 0xbd, 0x01, 0xcd, 0x01, 0xde, 0x01,
+  0xec, 0x01, 0xf8, 0x01, 0x06, 0x02, 0x12, 0x02, 0x29, 0x02, 0x34, 0x02,
+  0x3f, 0x02, 0x4d, 0x02, 0x65, 0x02, 0x73, 0x02, 0x00, 0x00, 0x27, 0x00,
+  0x49, 0x00, 0x57, 0x00, 0x61, 0x00, 0x6d, 0x00, 0x79, 0x00, 0x88, 0x00,
+  0x96, 0x00, 0xa3, 0x00, 0xad, 0x00, 0xbb, 0x00, 0xca, 0x00, 0xd8, 0x00,
+  0xe4, 0x00, 0xf2, 0x00, 0x01, 0x01, 0x0d, 0x01, 0x1b, 0x01, 0x27, 0x01,
+  0x36, 0x01, 0x44, 0x01, 0x54, 0x01, 0x63, 0x01, 0x6e, 0x01, 0x7c, 0x01,
+  0x8a, 0x01, 0x99, 0x01, 0xa7, 0x01, 0xb1, 0x01, 0xbb, 0x01, 0xc9, 0x01,
+  0xd8, 0x01, 0xe8, 0x01, 0xf4, 0x01, 0x02, 0x02, 0x0c, 0x02, 0x1a, 0x02,
+  0x25, 0x02, 0x34, 0x02, 0x43, 0x02, 0x51, 0x02, 0x5f, 0x02, 0x6a, 0x02,
+  0x74, 0x02, 0x82, 0x02, 0x90, 0x02, 0x9e, 0x02, 0xa8, 0x02, 0xb2, 0x02,
+  0xc0, 0x02, 0xcf, 0x02, 0xdd, 0x02, 0xeb, 0x02, 0xf4, 0x02, 0x02, 0x03,
+  0x11, 0x03, 0x1f, 0x03, 0x00, 0x00, 0x2a, 0x00, 0x47, 0x00, 0x5d, 0x00,
+  0x82, 0x00, 0x98, 0x00, 0xb7, 0x00, 0xcd, 0x00, 0xf1, 0x00, 0x05, 0x01,
+  0x1a, 0x01, 0x24, 0x01, 0x32, 0x01, 0x4b, 0x01, 0x57, 0x01, 0x63, 0x01,
+  0x6f, 0x01, 0x88, 0x01, 0x97, 0x01, 0xa5, 0x01, 0xb1, 0x01, 0xbd, 0x01,
+  0xd0, 0x01, 0xdc, 0x01, 0xeb, 0x01, 0xf9, 0x01, 0x07, 0x02, 0x15, 0x02,
+  0x21, 0x02, 0x2b, 0x02, 0x37, 0x02, 0x43, 0x02, 0x4f, 0x02, 0x59, 0x02,
+  0x63, 0x02, 0x71, 0x02, 0x7d, 0x02, 0x89, 0x02, 0x00, 0x00, 0x24, 0x00,
+  0x42, 0x00, 0x60, 0x00, 0x72, 0x00, 0x7e, 0x00, 0x8f, 0x00, 0x9f, 0x00,
+  0xae, 0x00, 0xc0, 0x00, 0xcc, 0x00, 0xdf, 0x00, 0xeb, 0x00, 0xf7, 0x00,
+  0x03, 0x01, 0x0f, 0x01, 0x21, 0x01, 0x2e, 0x01, 0x41, 0x01, 0x4d, 0x01,
+  0x59, 0x01, 0x65, 0x01, 0x77, 0x01, 0x85, 0x01, 0x93, 0x01, 0xa1, 0x01,
+  0xb3, 0x01, 0xbf, 0x01, 0xcd, 0x01, 0xdf, 0x01, 0xed, 0x01, 0xff, 0x01,
+  0x11, 0x02, 0x23, 0x02, 0x2f, 0x02, 0x3b, 0x02, 0x4d, 0x02, 0x59, 0x02,
+  0x67, 0x02, 0x79, 0x02, 0x87, 0x02, 0x99, 0x02, 0xa5, 0x02, 0xb1, 0x02,
+  0xbd, 0x02, 0xcf, 0x02, 0xdc, 0x02, 0xee, 0x02, 0xfa, 0x02, 0x06, 0x03,
+  0x19, 0x03, 0x00, 0x00, 0x24, 0x00, 0x32, 0x00, 0x44, 0x00, 0x56, 0x00,
+  0x62, 0x00, 0x6e, 0x00, 0x7c, 0x00, 0x8a, 0x00, 0x96, 0x00, 0xa4, 0x00,
+  0xb2, 0x00, 0xbe, 0x00, 0xca, 0x00, 0xd7, 0x00, 0xe3, 0x00, 0xf0, 0x00,
+  0xfe, 0x00, 0x0a, 0x01, 0x18, 0x01, 0x26, 0x01, 0x32, 0x01, 0x44, 0x01,
+  0x52, 0x01, 0x60, 0x01, 0x6e, 0x01, 0x7f, 0x01, 0x8e, 0x01, 0x9d, 0x01,
+  0x00, 0x00, 0x22, 0x00, 0x4d, 0x00, 0x6f, 0x00, 0x7b, 0x00, 0x8f, 0x00,
+  0xa3, 0x00, 0xaf, 0x00, 0xbd, 0x00, 0xcb, 0x00, 0xda, 0x00, 0xe6, 0x00,
+  0xf4, 0x00, 0x00, 0x01, 0x10, 0x01, 0x25, 0x01, 0x39, 0x01, 0x4b, 0x01,
+  0x5d, 0x01, 0x72, 0x01, 0x80, 0x01, 0x8e, 0x01, 0x9a, 0x01, 0xa6, 0x01,
+  0xb4, 0x01, 0xc2, 0x01, 0xd0, 0x01, 0xe4, 0x01, 0xf0, 0x01, 0xfa, 0x01,
+  0x09, 0x02, 0x17, 0x02, 0x26, 0x02, 0x32, 0x02, 0x3e, 0x02, 0x4c, 0x02,
+  0x5a, 0x02, 0x68, 0x02, 0x7d, 0x02, 0x8b, 0x02, 0x97, 0x02, 0xaa, 0x02,
+  0xb8, 0x02, 0xc7, 0x02, 0xd5, 0x02, 0xe3, 0x02, 0xf4, 0x02, 0x00, 0x03,
+  0x0c, 0x03, 0x1a, 0x03, 0x26, 0x03, 0x32, 0x03, 0x00, 0x00, 0x4e, 0x00,
+  0x74, 0x00, 0x85, 0x00, 0x91, 0x00, 0x9d, 0x00, 0xac, 0x00, 0xba, 0x00,
+  0xcb, 0x00, 0xd7, 0x00, 0xe7, 0x00, 0xf3, 0x00, 0xff, 0x00, 0x0b, 0x01,
+  0x17, 0x01, 0x25, 0x01, 0x31, 0x01, 0x3d, 0x01, 0x49, 0x01, 0x57, 0x01,
+  0x65, 0x01, 0x73, 0x01, 0x83, 0x01, 0x94, 0x01, 0xa2, 0x01, 0xb0, 0x01,
+  0xbc, 0x01, 0xca, 0x01, 0xd8, 0x01, 0xe8, 0x01, 0xf7, 0x01, 0x03, 0x02,
+  0x11, 0x02, 0x1c, 0x02, 0x28, 0x02, 0x34, 0x02, 0x42, 0x02, 0x53, 0x02,
+  0x63, 0x02, 0x71, 0x02, 0x7d, 0x02, 0x89, 0x02, 0x9b, 0x02, 0xac, 0x02,
+  0xba, 0x02, 0xc6, 0x02, 0xd5, 0x02, 0xe1, 0x02, 0xef, 0x02, 0xfb, 0x02,
+  0x07, 0x03, 0x13, 0x03, 0x1d, 0x03, 0x00, 0x00, 0x3a, 0x00, 0x47, 0x00,
+  0x55, 0x00, 0x61, 0x00, 0x6d, 0x00, 0x79, 0x00, 0x85, 0x00, 0x93, 0x00,
+  0xa1, 0x00, 0xaf, 0x00, 0xc4, 0x00, 0xd0, 0x00, 0xdc, 0x00, 0xe9, 0x00,
+  0xf5, 0x00, 0x03, 0x01, 0x12, 0x01, 0x1e, 0x01, 0x2a, 0x01, 0x38, 0x01,
+  0x44, 0x01, 0x5c, 0x01, 0x6a, 0x01, 0x76, 0x01, 0x84, 0x01, 0x90, 0x01,
+  0x9e, 0x01, 0xac, 0x01, 0xba, 0x01, 0xc8, 0x01, 0xd4, 0x01, 0xec, 0x01,
+  0xfa, 0x01, 0x06, 0x02, 0x17, 0x02, 0x23, 0x02, 0x2f, 0x02, 0x3d, 0x02,
+  0x4a, 0x02, 0x56, 0x02, 0x64, 0x02, 0x72, 0x02, 0x7e, 0x02, 0x8a, 0x02,
+  0x96, 0x02, 0xa4, 0x02, 0xb0, 0x02, 0xbc, 0x02, 0xc8, 0x02, 0xd4, 0x02,
+  0xe0, 0x02, 0xee, 0x02, 0xfc, 0x02, 0x0a, 0x03, 0x16, 0x03, 0x22, 0x03,
+  0x2e, 0x03, 0x00, 0x00, 0x2f, 0x00, 0x51, 0x00, 0x62, 0x00, 0x75, 0x00,
+  0x83, 0x00, 0x91, 0x00, 0x9f, 0x00, 0xab, 0x00, 0xb9, 0x00, 0xc5, 0x00,
+  0xd1, 0x00, 0xda, 0x00, 0xe6, 0x00, 0xf2, 0x00, 0x04, 0x01, 0x10, 0x01,
+  0x1f, 0x01, 0x2e, 0x01, 0x3d, 0x01, 0x49, 0x01, 0x57, 0x01, 0x66, 0x01,
+  0x72, 0x01, 0x80, 0x01, 0x8e, 0x01, 0x9a, 0x01, 0xa8, 0x01, 0xb4, 0x01,
+  0xc2, 0x01, 0xd1, 0x01, 0xdf, 0x01, 0xed, 0x01, 0xfb, 0x01, 0x00, 0x00,
+  0x26, 0x00, 0x34, 0x00, 0x42, 0x00, 0x51, 0x00, 0x5f, 0x00, 0x75, 0x00,
+  0x83, 0x00, 0x91, 0x00, 0x9f, 0x00, 0xad, 0x00, 0xbb, 0x00, 0xc9, 0x00,
+  0xd7, 0x00, 0xe3, 0x00, 0xf0, 0x00, 0xfe, 0x00, 0x0c, 0x01, 0x1a, 0x01,
+  0x28, 0x01, 0x36, 0x01, 0x41, 0x01, 0x4f, 0x01, 0x5e, 0x01, 0x6c, 0x01,
+  0x77, 0x01, 0x85, 0x01, 0x93, 0x01, 0xa1, 0x01, 0xaf, 0x01, 0xc0, 0x01,
+  0xd4, 0x01, 0xe4, 0x01, 0xf2, 0x01, 0xfd, 0x01, 0x12, 0x02, 0x20, 0x02,
+  0x2e, 0x02, 0x3c, 0x02, 0x4a, 0x02, 0x5f, 0x02, 0x6d, 0x02, 0x7c, 0x02,
+  0x8b, 0x02, 0x99, 0x02, 0xa8, 0x02, 0xb6, 0x02, 0xc4, 0x02, 0xd2, 0x02,
+  0xe0, 0x02, 0xee, 0x02, 0x00, 0x00, 0x22, 0x00, 0x3c, 0x00, 0x4a, 0x00,
+  0x55, 0x00, 0x63, 0x00, 0x6e, 0x00, 0x79, 0x00, 0x84, 0x00, 0x92, 0x00,
+  0x9c, 0x00, 0xa8, 0x00, 0xb6, 0x00, 0xcc, 0x00, 0xd6, 0x00, 0xe7, 0x00,
+  0xfa, 0x00, 0x09, 0x01, 0x15, 0x01, 0x25, 0x01, 0x31, 0x01, 0x3b, 0x01,
+  0x4f, 0x01, 0x5a, 0x01, 0x68, 0x01, 0x76, 0x01, 0x84, 0x01, 0x95, 0x01,
+  0xa3, 0x01, 0xb1, 0x01, 0xbf, 0x01, 0xcb, 0x01, 0xd9, 0x01, 0xed, 0x01,
+  0xfb, 0x01, 0x09, 0x02, 0x17, 0x02, 0x23, 0x02, 0x2d, 0x02, 0x3b, 0x02,
+  0x45, 0x02, 0x53, 0x02, 0x00, 0x00, 0x1c, 0x00, 0x4d, 0x00, 0x5b, 0x00,
+  0x67, 0x00, 0x75, 0x00, 0x80, 0x00, 0x8c, 0x00, 0x99, 0x00, 0xae, 0x00,
+  0xbc, 0x00, 0xca, 0x00, 0xd6, 0x00, 0xe1, 0x00, 0xed, 0x00, 0xfb, 0x00,
+  0x06, 0x01, 0x1e, 0x01, 0x2f, 0x01, 0x3e, 0x01, 0x4c, 0x01, 0x5a, 0x01,
+  0x6c, 0x01, 0x78, 0x01, 0x84, 0x01, 0x92, 0x01, 0xa0, 0x01, 0xac, 0x01,
+  0xb8, 0x01, 0xc6, 0x01, 0xd2, 0x01, 0xde, 0x01, 0xeb, 0x01, 0xf9, 0x01,
+  0x04, 0x02, 0x12, 0x02, 0x23, 0x02, 0x2f, 0x02, 0x3d, 0x02, 0x48, 0x02,
+  0x54, 0x02, 0x62, 0x02, 0x7a, 0x02, 0x8b, 0x02, 0x96, 0x02, 0xa2, 0x02,
+  0xb0, 0x02, 0xbc, 0x02, 0xc4, 0x02, 0xd0, 0x02, 0xdb, 0x02, 0xe7, 0x02,
+  0xf5, 0x02, 0x00, 0x03, 0x0d, 0x03, 0x1b, 0x03, 0x00, 0x00, 0x2f, 0x00,
+  0x40, 0x00, 0x4c, 0x00, 0x5d, 0x00, 0x68, 0x00, 0x74, 0x00, 0x85, 0x00,
+  0x91, 0x00, 0xa1, 0x00, 0xaf, 0x00, 0xbd, 0x00, 0xcb, 0x00, 0xde, 0x00,
+  0xee, 0x00, 0xfc, 0x00, 0x0a, 0x01, 0x1a, 0x01, 0x2d, 0x01, 0x40, 0x01,
+  0x4e, 0x01, 0x5a, 0x01, 0x6a, 0x01, 0x7a, 0x01, 0x86, 0x01, 0x92, 0x01,
+  0xa3, 0x01, 0xb6, 0x01, 0xc4, 0x01, 0xd2, 0x01, 0xe0, 0x01, 0xec, 0x01,
+  0xf8, 0x01, 0x04, 0x02, 0x00, 0x00, 0x22, 0x00, 0x31, 0x00, 0x4a, 0x00,
+  0x55, 0x00, 0x5f, 0x00, 0x6d, 0x00, 0x79, 0x00, 0x87, 0x00, 0x95, 0x00,
+  0xa8, 0x00, 0xb6, 0x00, 0xc4, 0x00, 0xd7, 0x00, 0xeb, 0x00, 0xf9, 0x00,
+  0x07, 0x01, 0x13, 0x01, 0x24, 0x01, 0x2e, 0x01, 0x3c, 0x01, 0x4b, 0x01,
+  0x5b, 0x01, 0x6a, 0x01, 0x78, 0x01, 0x88, 0x01, 0x96, 0x01, 0xa9, 0x01,
+  0xb4, 0x01, 0xc0, 0x01, 0xd0, 0x01, 0xde, 0x01, 0xee, 0x01, 0xfd, 0x01,
+  0x09, 0x02, 0x17, 0x02, 0x26, 0x02, 0x36, 0x02, 0x45, 0x02, 0x53, 0x02,
+  0x61, 0x02, 0x6f, 0x02, 0x7d, 0x02, 0x8b, 0x02, 0x99, 0x02, 0xa9, 0x02,
+  0xb5, 0x02, 0xc3, 0x02, 0xd4, 0x02, 0xe5, 0x02, 0xf3, 0x02, 0xfd, 0x02,
+  0x0d, 0x03, 0x1b, 0x03, 0x29, 0x03, 0x37, 0x03, 0x41, 0x03, 0x4f, 0x03,
+  0x5d, 0x03, 0x69, 0x03, 0x77, 0x03, 0x83, 0x03, 0x8f, 0x03, 0x00, 0x00,
+  0x1c, 0x00, 0x3c, 0x00, 0x4f, 0x00, 0x62, 0x00, 0x6c, 0x00, 0x85, 0x00,
+  0x94, 0x00, 0xa2, 0x00, 0xae, 0x00, 0xba, 0x00, 0xc6, 0x00, 0xd4, 0x00,
+  0xe2, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0x08, 0x01, 0x1b, 0x01, 0x29, 0x01,
+  0x3c, 0x01, 0x4a, 0x01, 0x5a, 0x01, 0x6b, 0x01, 0x7e, 0x01, 0x90, 0x01,
+  0xa3, 0x01, 0xb3, 0x01, 0xc0, 0x01, 0x00, 0x00, 0x22, 0x00, 0x49, 0x00,
+  0x57, 0x00, 0x63, 0x00, 0x6f, 0x00, 0x7d, 0x00, 0x8b, 0x00, 0x9f, 0x00,
+  0xac, 0x00, 0xba, 0x00, 0xcc, 0x00, 0xdc, 0x00, 0xec, 0x00, 0xfd, 0x00,
+  0x09, 0x01, 0x17, 0x01, 0x28, 0x01, 0x38, 0x01, 0x4a, 0x01, 0x5b, 0x01,
+  0x67, 0x01, 0x77, 0x01, 0x83, 0x01, 0x8f, 0x01, 0x9b, 0x01, 0xa7, 0x01,
+  0xb3, 0x01, 0xc5, 0x01, 0x00, 0x00, 0x27, 0x00, 0x5c, 0x00, 0x7f, 0x00,
+  0xa7, 0x00, 0xc0, 0x00, 0xcc, 0x00, 0xe0, 0x00, 0xf0, 0x00, 0x00, 0x01,
+  0x14, 0x01, 0x20, 0x01, 0x2c, 0x01, 0x3a, 0x01, 0x44, 0x01, 0x52, 0x01,
+  0x5d, 0x01, 0x6e, 0x01, 0x80, 0x01, 0x8c, 0x01, 0x00, 0x00, 0x26, 0x00,
+  0x38, 0x00, 0x48, 0x00, 0x56, 0x00, 0x68, 0x00, 0x78, 0x00, 0x86, 0x00,
+  0x97, 0x00, 0xab, 0x00, 0xb6, 0x00, 0xc4, 0x00, 0xd2, 0x00, 0xe0, 0x00,
+  0xeb, 0x00, 0xf6, 0x00, 0x14, 0x01, 0x25, 0x01, 0x31, 0x01, 0x3d, 0x01,
+  0x48, 0x01, 0x5b, 0x01, 0x67, 0x01, 0x73, 0x01, 0x83, 0x01, 0x90, 0x01,
+  0xa3, 0x01, 0xb1, 0x01, 0xc3, 0x01, 0xd7, 0x01, 0xe5, 0x01, 0xf3, 0x01,
+  0x0a, 0x02, 0x14, 0x02, 0x20, 0x02, 0x2a, 0x02, 0x34, 0x02, 0x3e, 0x02,
+  0x4c, 0x02, 0x60, 0x02, 0x6e, 0x02, 0x7c, 0x02, 0x8d, 0x02, 0x98, 0x02,
+  0xa3, 0x02, 0x00, 0x00, 0x21, 0x00, 0x54, 0x00, 0x73, 0x00, 0xa7, 0x00,
+  0xc7, 0x00, 0xee, 0x00, 0xfc, 0x00, 0x0a, 0x01, 0x18, 0x01, 0x23, 0x01,
+  0x2f, 0x01, 0x3a, 0x01, 0x46, 0x01, 0x54, 0x01, 0x62, 0x01, 0x6f, 0x01,
+  0x7e, 0x01, 0x00, 0x00, 0x1c, 0x00, 0x3e, 0x00, 0x54, 0x00, 0x60, 0x00,
+  0x6e, 0x00, 0x86, 0x00, 0x9b, 0x00, 0xa7, 0x00, 0xb3, 0x00, 0xc1, 0x00,
+  0xd6, 0x00, 0xe2, 0x00, 0xee, 0x00, 0xfc, 0x00, 0x0a, 0x01, 0x16, 0x01,
+  0x22, 0x01, 0x2e, 0x01, 0x3c, 0x01, 0x4a, 0x01, 0x56, 0x01, 0x62, 0x01,
+  0x72, 0x01, 0x88, 0x01, 0x94, 0x01, 0xa2, 0x01, 0xae, 0x01, 0xbc, 0x01,
+  0xcc, 0x01, 0xd8, 0x01, 0xe6, 0x01, 0xf4, 0x01, 0x02, 0x02, 0x00, 0x00,
+  0x1e, 0x00, 0x49, 0x00, 0x76, 0x00, 0x84, 0x00, 0x90, 0x00, 0x9d, 0x00,
+  0xa9, 0x00, 0xb7, 0x00, 0xc5, 0x00, 0xd3, 0x00, 0xe1, 0x00, 0xf0, 0x00,
+  0xff, 0x00, 0x0d, 0x01, 0x1b, 0x01, 0x28, 0x01, 0x36, 0x01, 0x45, 0x01,
+  0x53, 0x01, 0x5f, 0x01, 0x6d, 0x01, 0x7b, 0x01, 0x87, 0x01, 0x95, 0x01,
+  0xa3, 0x01, 0xb2, 0x01, 0xc0, 0x01, 0xce, 0x01, 0xdc, 0x01, 0xea, 0x01,
+  0xf6, 0x01, 0x02, 0x02, 0x0d, 0x02, 0x00, 0x00, 0x46, 0x00, 0x6b, 0x00,
+  0x7e, 0x00, 0x8c, 0x00, 0xa0, 0x00, 0xab, 0x00, 0xbe, 0x00, 0xcf, 0x00,
+  0xdd, 0x00, 0xe8, 0x00, 0xf3, 0x00, 0x04, 0x01, 0x10, 0x01, 0x1e, 0x01,
+  0x2c, 0x01, 0x3b, 0x01, 0x4a, 0x01, 0x5b, 0x01, 0x69, 0x01, 0x7e, 0x01,
+  0x8c, 0x01, 0x9b, 0x01, 0xa9, 0x01, 0xc0, 0x01, 0xce, 0x01, 0xdc, 0x01,
+  0xea, 0x01, 0xf4, 0x01, 0x03, 0x02, 0x11, 0x02, 0x20, 0x02, 0x2b, 0x02,
+  0x3a, 0x02, 0x48, 0x02, 0x56, 0x02, 0x00, 0x00, 0x10, 0x00, 0x1e, 0x00,
+  0x2c, 0x00, 0x3a, 0x00, 0x48, 0x00, 0x56, 0x00, 0x65, 0x00, 0x75, 0x00,
+  0x84, 0x00, 0x93, 0x00, 0xa3, 0x00, 0xae, 0x00, 0xbc, 0x00, 0xc6, 0x00,
+  0xd4, 0x00, 0xe2, 0x00, 0xee, 0x00, 0xfc, 0x00, 0x06, 0x01, 0x12, 0x01,
+  0x21, 0x01, 0x2f, 0x01, 0x3b, 0x01, 0x49, 0x01, 0x57, 0x01, 0x61, 0x01,
+  0x72, 0x01, 0x82, 0x01, 0x90, 0x01, 0x9e, 0x01, 0x00, 0x00, 0x0d, 0x00,
+  0x19, 0x00, 0x25, 0x00, 0x35, 0x00, 0x41, 0x00, 0x51, 0x00, 0x5d, 0x00,
+  0x6d, 0x00, 0x79, 0x00, 0x8a, 0x00, 0x97, 0x00, 0xa3, 0x00, 0xb0, 0x00,
+  0xbc, 0x00, 0xc9, 0x00, 0xd6, 0x00, 0xe3, 0x00, 0xef, 0x00, 0xfb, 0x00,
+  0x07, 0x01, 0x13, 0x01, 0x20, 0x01, 0x2d, 0x01, 0x39, 0x01, 0x45, 0x01,
+  0x53, 0x01, 0x5f, 0x01, 0x6b, 0x01, 0x77, 0x01, 0x84, 0x01, 0x90, 0x01,
+  0x9c, 0x01, 0xac, 0x01, 0xb8, 0x01, 0xc4, 0x01, 0xd4, 0x01, 0xe0, 0x01,
+  0xec, 0x01, 0xf8, 0x01, 0x0a, 0x02, 0x16, 0x02, 0x30, 0x02, 0x3c, 0x02,
+  0x48, 0x02, 0x54, 0x02, 0x63, 0x02, 0x6f, 0x02, 0x00, 0x00, 0x21, 0x00,
+  0x51, 0x00, 0x6b, 0x00, 0x8b, 0x00, 0xa7, 0x00, 0xb9, 0x00, 0xc7, 0x00,
+  0xe8, 0x00, 0xf8, 0x00, 0x06, 0x01, 0x14, 0x01, 0x22, 0x01, 0x2f, 0x01,
+  0x3a, 0x01, 0x4b, 0x01, 0x5b, 0x01, 0x67, 0x01, 0x77, 0x01, 0x87, 0x01,
+  0x97, 0x01, 0xa9, 0x01, 0xb7, 0x01, 0xc6, 0x01, 0xd4, 0x01, 0xe3, 0x01,
+  0xf0, 0x01, 0xfe, 0x01, 0x0e, 0x02, 0x1b, 0x02, 0x2d, 0x02, 0x3b, 0x02,
+  0x4e, 0x02, 0x5c, 0x02, 0x6b, 0x02, 0x77, 0x02, 0x8a, 0x02, 0x9a, 0x02,
+  0xa8, 0x02, 0xb5, 0x02, 0xc6, 0x02, 0x00, 0x00, 0x1e, 0x00, 0x2f, 0x00,
+  0x43, 0x00, 0x4d, 0x00, 0x5b, 0x00, 0x66, 0x00, 0x71, 0x00, 0x7d, 0x00,
+  0x8c, 0x00, 0x9a, 0x00, 0xa9, 0x00, 0xc3, 0x00, 0xd1, 0x00, 0xdf, 0x00,
+  0xf3, 0x00, 0x01, 0x01, 0x0f, 0x01, 0x1b, 0x01, 0x29, 0x01, 0x38, 0x01,
+  0x44, 0x01, 0x50, 0x01, 0x5e, 0x01, 0x6c, 0x01, 0x78, 0x01, 0x86, 0x01,
+  0x92, 0x01, 0x9e, 0x01, 0xaa, 0x01, 0xbc, 0x01, 0xc8, 0x01, 0xd9, 0x01,
+  0xe7, 0x01, 0xf5, 0x01, 0x03, 0x02, 0x1e, 0x02, 0x2a, 0x02, 0x37, 0x02,
+  0x45, 0x02, 0x51, 0x02, 0x5f, 0x02, 0x6d, 0x02, 0x79, 0x02, 0x85, 0x02,
+  0x93, 0x02, 0xa1, 0x02, 0xaf, 0x02, 0xbb, 0x02, 0xc9, 0x02, 0xd5, 0x02,
+  0x00, 0x00, 0x10, 0x00, 0x24, 0x00, 0x33, 0x00, 0x44, 0x00, 0x4f, 0x00,
+  0x5f, 0x00, 0x6f, 0x00, 0x7f, 0x00, 0x92, 0x00, 0xa0, 0x00, 0xab, 0x00,
+  0xb7, 0x00, 0xc8, 0x00, 0xd3, 0x00, 0xe2, 0x00, 0xf2, 0x00, 0xfe, 0x00,
+  0x0e, 0x01, 0x1e, 0x01, 0x2e, 0x01, 0x41, 0x01, 0x51, 0x01, 0x61, 0x01,
+  0x6d, 0x01, 0x79, 0x01, 0x89, 0x01, 0x9c, 0x01, 0xac, 0x01, 0xbf, 0x01,
+  0xd0, 0x01, 0xdc, 0x01, 0xec, 0x01, 0xfc, 0x01, 0x0c, 0x02, 0x00, 0x00,
+  0x0b, 0x00, 0x16, 0x00, 0x21, 0x00, 0x2c, 0x00, 0x37, 0x00, 0x48, 0x00,
+  0x54, 0x00, 0x5f, 0x00, 0x6a, 0x00, 0x77, 0x00, 0x85, 0x00, 0x91, 0x00,
+  0x9e, 0x00, 0xa9, 0x00, 0xb6, 0x00, 0xc6, 0x00, 0xd7, 0x00, 0xe7, 0x00,
+  0xf3, 0x00, 0x01, 0x01, 0x0f, 0x01, 0x1b, 0x01, 0x2b, 0x01, 0x39, 0x01,
+  0x44, 0x01, 0x52, 0x01, 0x5d, 0x01, 0x6a, 0x01, 0x78, 0x01, 0x88, 0x01,
+  0x93, 0x01, 0x9f, 0x01, 0xaa, 0x01, 0xb5, 0x01, 0xc1, 0x01, 0x00, 0x00,
+  0x12, 0x00, 0x1c, 0x00, 0x2d, 0x00, 0x39, 0x00, 0x4b, 0x00, 0x5f, 0x00,
+  0x70, 0x00, 0x7a, 0x00, 0x87, 0x00, 0x9b, 0x00, 0xad, 0x00, 0xb9, 0x00,
+  0xc3, 0x00, 0xce, 0x00, 0xe2, 0x00, 0xf6, 0x00, 0x05, 0x01, 0x17, 0x01,
+  0x22, 0x01, 0x37, 0x01, 0x49, 0x01, 0x53, 0x01, 0x5d, 0x01, 0x00, 0x00,
+  0x0e, 0x00, 0x1c, 0x00, 0x2a, 0x00, 0x38, 0x00, 0x46, 0x00, 0x52, 0x00,
+  0x60, 0x00, 0x6e, 0x00, 0x7c, 0x00, 0x8a, 0x00, 0x98, 0x00, 0xa6, 0x00,
+  0xb8, 0x00, 0xc6, 0x00, 0xd6, 0x00, 0xe5, 0x00, 0xf3, 0x00, 0xff, 0x00,
+  0x13, 0x01, 0x21, 0x01, 0x2f, 0x01, 0x3d, 0x01, 0x4c, 0x01, 0x5a, 0x01,
+  0x65, 0x01, 0x73, 0x01, 0x82, 0x01, 0x8d, 0x01, 0x9c, 0x01, 0xaa, 0x01,
+  0xb9, 0x01, 0xc9, 0x01, 0xd7, 0x01, 0xe5, 0x01, 0xf0, 0x01, 0x05, 0x02,
+  0x13, 0x02, 0x21, 0x02, 0x31, 0x02, 0x42, 0x02, 0x4e, 0x02, 0x5c, 0x02,
+  0x67, 0x02, 0x7a, 0x02, 0x89, 0x02, 0x99, 0x02, 0xa8, 0x02, 0xb8, 0x02,
+  0xc7, 0x02, 0xd5, 0x02, 0xe3, 0x02, 0xfa, 0x02, 0x05, 0x03, 0x15, 0x03,
+  0x24, 0x03, 0x32, 0x03, 0x40, 0x03, 0x4a, 0x03, 0x00, 0x00, 0x20, 0x00,
+  0x40, 0x00, 0x57, 0x00, 0x63, 0x00, 0x77, 0x00, 0x85, 0x00, 0x9d, 0x00,
+  0xa9, 0x00, 0xb7, 0x00, 0xc3, 0x00, 0xcf, 0x00, 0xe6, 0x00, 0xf2, 0x00,
+  0x07, 0x01, 0x13, 0x01, 0x21, 0x01, 0x2d, 0x01, 0x39, 0x01, 0x45, 0x01,
+  0x59, 0x01, 0x6b, 0x01, 0x78, 0x01, 0x86, 0x01, 0x94, 0x01, 0xa0, 0x01,
+  0xb4, 0x01, 0xc0, 0x01, 0xd5, 0x01, 0xe3, 0x01, 0xef, 0x01, 0x04, 0x02,
+  0x00, 0x00, 0x27, 0x00, 0x33, 0x00, 0x44, 0x00, 0x4f, 0x00, 0x61, 0x00,
+  0x6e, 0x00, 0x7e, 0x00, 0x89, 0x00, 0x9c, 0x00, 0xa7, 0x00, 0xb2, 0x00,
+  0xbd, 0x00, 0xc9, 0x00, 0xd4, 0x00, 0xdf, 0x00, 0xea, 0x00, 0xf5, 0x00,
+  0x02, 0x01, 0x0d, 0x01, 0x1a, 0x01, 0x27, 0x01, 0x32, 0x01, 0x3f, 0x01,
+  0x4a, 0x01, 0x5b, 0x01, 0x66, 0x01, 0x73, 0x01, 0x84, 0x01, 0x96, 0x01,
+  0xa4, 0x01, 0x00, 0x00, 0x1e, 0x00, 0x3c, 0x00, 0x63, 0x00, 0x73, 0x00,
+  0x81, 0x00, 0x8f, 0x00, 0xa5, 0x00, 0xb3, 0x00, 0xc2, 0x00, 0xd7, 0x00,
+  0xe3, 0x00, 0xf1, 0x00, 0x01, 0x01, 0x0d, 0x01, 0x1b, 0x01, 0x28, 0x01,
+  0x36, 0x01, 0x44, 0x01, 0x52, 0x01, 0x62, 0x01, 0x00, 0x00, 0x22, 0x00,
+  0x48, 0x00, 0x6e, 0x00, 0x7d, 0x00, 0x8c, 0x00, 0x9a, 0x00, 0xae, 0x00,
+  0xb8, 0x00, 0xc4, 0x00, 0xd3, 0x00, 0xde, 0x00, 0xec, 0x00, 0xfb, 0x00,
+  0x0a, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x38, 0x01, 0x43, 0x01, 0x52, 0x01,
+  0x60, 0x01, 0x6a, 0x01, 0x78, 0x01, 0x84, 0x01, 0x92, 0x01, 0x9c, 0x01,
+  0xa8, 0x01, 0xbc, 0x01, 0xcc, 0x01, 0xdf, 0x01, 0xea, 0x01, 0xf8, 0x01,
+  0x03, 0x02, 0x11, 0x02, 0x1f, 0x02, 0x2d, 0x02, 0x3b, 0x02, 0x4a, 0x02,
+  0x56, 0x02, 0x66, 0x02, 0x00, 0x00, 0x1e, 0x00, 0x49, 0x00, 0x69, 0x00,
+  0x79, 0x00, 0x87, 0x00, 0x94, 0x00, 0xa2, 0x00, 0xae, 0x00, 0xbd, 0x00,
+  0xc9, 0x00, 0xe1, 0x00, 0xf9, 0x00, 0x05, 0x01, 0x12, 0x01, 0x1f, 0x01,
+  0x2b, 0x01, 0x36, 0x01, 0x44, 0x01, 0x52, 0x01, 0x5c, 0x01, 0x68, 0x01,
+  0x76, 0x01, 0x8f, 0x01, 0x9b, 0x01, 0xa6, 0x01, 0xb5, 0x01, 0xc2, 0x01,
+  0xd0, 0x01, 0xe8, 0x01, 0xf5, 0x01, 0x00, 0x02, 0x0c, 0x02, 0x1c, 0x02,
+  0x00, 0x00, 0x33, 0x00, 0x69, 0x00, 0x8d, 0x00, 0x99, 0x00, 0xac, 0x00,
+  0xb8, 0x00, 0xca, 0x00, 0xdc, 0x00, 0xe8, 0x00, 0xfa, 0x00, 0x0e, 0x01,
+  0x20, 0x01, 0x2d, 0x01, 0x39, 0x01, 0x4b, 0x01, 0x5d, 0x01, 0x6c, 0x01,
+  0x7e, 0x01, 0x8a, 0x01, 0x9c, 0x01, 0xab, 0x01, 0xbb, 0x01, 0xc7, 0x01,
+  0xd9, 0x01, 0xe5, 0x01, 0xf1, 0x01, 0x03, 0x02, 0x0f, 0x02, 0x1b, 0x02,
+  0x29, 0x02, 0x37, 0x02, 0x44, 0x02, 0x50, 0x02, 0x5c, 0x02, 0x6e, 0x02,
+  0x7d, 0x02, 0x89, 0x02, 0x9b, 0x02, 0xad, 0x02, 0xbf, 0x02, 0xcb, 0x02,
+  0xdd, 0x02, 0xe9, 0x02, 0xfb, 0x02, 0x0a, 0x03, 0x19, 0x03, 0x27, 0x03,
+  0x33, 0x03, 0x45, 0x03, 0x57, 0x03, 0x6a, 0x03, 0x78, 0x03, 0x00, 0x00,
+  0x26, 0x00, 0x34, 0x00, 0x3f, 0x00, 0x49, 0x00, 0x5d, 0x00, 0x68, 0x00,
+  0x79, 0x00, 0x86, 0x00, 0x98, 0x00, 0xa9, 0x00, 0xbb, 0x00, 0xc8, 0x00,
+  0xd4, 0x00, 0xdf, 0x00, 0xec, 0x00, 0xf8, 0x00, 0x06, 0x01, 0x12, 0x01,
+  0x1e, 0x01, 0x2a, 0x01, 0x38, 0x01, 0x48, 0x01, 0x59, 0x01, 0x65, 0x01,
+  0x70, 0x01, 0x7b, 0x01, 0x88, 0x01, 0x96, 0x01, 0xa2, 0x01, 0xae, 0x01,
+  0xba, 0x01, 0xc6, 0x01, 0xd2, 0x01, 0xe4, 0x01, 0xf2, 0x01, 0xfe, 0x01,
+  0x0a, 0x02, 0x15, 0x02, 0x22, 0x02, 0x2f, 0x02, 0x3b, 0x02, 0x00, 0x00,
+  0x20, 0x00, 0x46, 0x00, 0x66, 0x00, 0x7a, 0x00, 0x85, 0x00, 0x8f, 0x00,
+  0xa3, 0x00, 0xb7, 0x00, 0xc3, 0x00, 0xcf, 0x00, 0xe4, 0x00, 0xf9, 0x00,
+  0x0d, 0x01, 0x2b, 0x01, 0x37, 0x01, 0x42, 0x01, 0x52, 0x01, 0x5d, 0x01,
+  0x6b, 0x01, 0x77, 0x01, 0x83, 0x01, 0x8f, 0x01, 0x9a, 0x01, 0xae, 0x01,
+  0xb9, 0x01, 0xc7, 0x01, 0xd2, 0x01, 0xe6, 0x01, 0xf0, 0x01, 0x01, 0x02,
+  0x0c, 0x02, 0x21, 0x02, 0x2f, 0x02, 0x39, 0x02, 0x44, 0x02, 0x4e, 0x02,
+  0x00, 0x00, 0x1e, 0x00, 0x40, 0x00, 0x4c, 0x00, 0x5f, 0x00, 0x70, 0x00,
+  0x7c, 0x00, 0x87, 0x00, 0x9a, 0x00, 0xaa, 0x00, 0xc8, 0x00, 0xd6, 0x00,
+  0xe6, 0x00, 0xf4, 0x00, 0x04, 0x01, 0x0f, 0x01, 0x18, 0x01, 0x28, 0x01,
+  0x38, 0x01, 0x48, 0x01, 0x58, 0x01, 0x68, 0x01, 0x73, 0x01, 0x83, 0x01,
+  0x8d, 0x01, 0x9b, 0x01, 0xa6, 0x01, 0xb2, 0x01, 0xc5, 0x01, 0xd1, 0x01,
+  0xdd, 0x01, 0xed, 0x01, 0xfb, 0x01, 0x05, 0x02, 0x13, 0x02, 0x22, 0x02,
+  0x30, 0x02, 0x3c, 0x02, 0x46, 0x02, 0x56, 0x02, 0x6a, 0x02, 0x76, 0x02,
+  0x80, 0x02, 0x90, 0x02, 0x9c, 0x02, 0xa8, 0x02, 0xb4, 0x02, 0x00, 0x00,
+  0x2f, 0x00, 0x3d, 0x00, 0x49, 0x00, 0x55, 0x00, 0x63, 0x00, 0x6f, 0x00,
+  0x7b, 0x00, 0x89, 0x00, 0x95, 0x00, 0xa2, 0x00, 0xaf, 0x00, 0xbb, 0x00,
+  0xc7, 0x00, 0xd5, 0x00, 0xe3, 0x00, 0xef, 0x00, 0xfd, 0x00, 0x0c, 0x01,
+  0x18, 0x01, 0x24, 0x01, 0x31, 0x01, 0x3f, 0x01, 0x4c, 0x01, 0x5a, 0x01,
+  0x66, 0x01, 0x72, 0x01, 0x7e, 0x01, 0x8c, 0x01, 0x98, 0x01, 0xa4, 0x01,
+  0xb9, 0x01, 0xc5, 0x01, 0xd3, 0x01, 0xdf, 0x01, 0xed, 0x01, 0xf9, 0x01,
+  0x05, 0x02, 0x13, 0x02, 0x21, 0x02, 0x2d, 0x02, 0x00, 0x00, 0x0c, 0x00,
+  0x17, 0x00, 0x2a, 0x00, 0x39, 0x00, 0x43, 0x00, 0x4f, 0x00, 0x71, 0x00,
+  0x7c, 0x00, 0x86, 0x00, 0x91, 0x00, 0x9f, 0x00, 0xb1, 0x00, 0xc3, 0x00,
+  0xcf, 0x00, 0xdc, 0x00, 0xea, 0x00, 0xf5, 0x00, 0x00, 0x01, 0x16, 0x01,
+  0x20, 0x01, 0x2c, 0x01, 0x3d, 0x01, 0x4b, 0x01, 0x59, 0x01, 0x65, 0x01,
+  0x77, 0x01, 0x83, 0x01, 0x8f, 0x01, 0x99, 0x01, 0xaa, 0x01, 0xb6, 0x01,
+  0xc4, 0x01, 0xda, 0x01, 0xe6, 0x01, 0xfc, 0x01, 0x0e, 0x02, 0x20, 0x02,
+  0x2d, 0x02, 0x3b, 0x02, 0x47, 0x02, 0x53, 0x02, 0x5f, 0x02, 0x6b, 0x02,
+  0x00, 0x00, 0x1e, 0x00, 0x40, 0x00, 0x62, 0x00, 0x91, 0x00, 0x9c, 0x00,
+  0xb7, 0x00, 0xc2, 0x00, 0xce, 0x00, 0xd8, 0x00, 0xe3, 0x00, 0xee, 0x00,
+  0xfc, 0x00, 0x0a, 0x01, 0x17, 0x01, 0x28, 0x01, 0x34, 0x01, 0x3f, 0x01,
+  0x4d, 0x01, 0x62, 0x01, 0x70, 0x01, 0x7f, 0x01, 0x92, 0x01, 0xa0, 0x01,
+  0xae, 0x01, 0xbc, 0x01, 0xc6, 0x01, 0xd4, 0x01, 0xe2, 0x01, 0xed, 0x01,
+  0x02, 0x02, 0x10, 0x02, 0x25, 0x02, 0x30, 0x02, 0x3e, 0x02, 0x4c, 0x02,
+  0x5a, 0x02, 0x68, 0x02, 0x76, 0x02, 0x80, 0x02, 0x8c, 0x02, 0x9a, 0x02,
+  0xa8, 0x02, 0xb3, 0x02, 0x00, 0x00, 0x20, 0x00, 0x40, 0x00, 0x64, 0x00,
+  0x88, 0x00, 0x96, 0x00, 0xa4, 0x00, 0xb0, 0x00, 0xbe, 0x00, 0xca, 0x00,
+  0xd9, 0x00, 0xee, 0x00, 0xfc, 0x00, 0x0a, 0x01, 0x1e, 0x01, 0x2a, 0x01,
+  0x3f, 0x01, 0x4b, 0x01, 0x59, 0x01, 0x64, 0x01, 0x70, 0x01, 0x7c, 0x01,
+  0x8b, 0x01, 0x97, 0x01, 0xa4, 0x01, 0xb0, 0x01, 0xbb, 0x01, 0xc9, 0x01,
+  0xdd, 0x01, 0xeb, 0x01, 0xfa, 0x01, 0x04, 0x02, 0x10, 0x02, 0x1b, 0x02,
+  0x2a, 0x02, 0x33, 0x02, 0x3f, 0x02, 0x4d, 0x02, 0x5b, 0x02, 0x70, 0x02,
+  0x7c, 0x02, 0x88, 0x02, 0x94, 0x02, 0x9e, 0x02, 0xad, 0x02, 0xb9, 0x02,
+  0xc5, 0x02, 0xd1, 0x02, 0xdf, 0x02, 0xf1, 0x02, 0xfd, 0x02, 0x09, 0x03,
+  0x17, 0x03, 0x25, 0x03, 0x2f, 0x03, 0x3d, 0x03, 0x4d, 0x03, 0x59, 0x03,
+  0x00, 0x00, 0x2a, 0x00, 0x4e, 0x00, 0x5a, 0x00, 0x72, 0x00, 0x83, 0x00,
+  0x8f, 0x00, 0xa6, 0x00, 0xb4, 0x00, 0xbf, 0x00, 0xcb, 0x00, 0xd7, 0x00,
+  0xe5, 0x00, 0xf3, 0x00, 0xff, 0x00, 0x0b, 0x01, 0x17, 0x01, 0x22, 0x01,
+  0x3a, 0x01, 0x46, 0x01, 0x51, 0x01, 0x5f, 0x01, 0x6b, 0x01, 0x7c, 0x01,
+  0x94, 0x01, 0xa2, 0x01, 0xae, 0x01, 0xbc, 0x01, 0xcd, 0x01, 0xe5, 0x01,
+  0xfd, 0x01, 0x08, 0x02, 0x16, 0x02, 0x2e, 0x02, 0x3a, 0x02, 0x48, 0x02,
+  0x55, 0x02, 0x63, 0x02, 0x71, 0x02, 0x7f, 0x02, 0x8b, 0x02, 0x99, 0x02,
+  0xa8, 0x02, 0xb6, 0x02, 0xc1, 0x02, 0xcd, 0x02, 0xdb, 0x02, 0xe6, 0x02,
+  0xfe, 0x02, 0x15, 0x03, 0x21, 0x03, 0x39, 0x03, 0x00, 0x00, 0x28, 0x00,
+  0x4f, 0x00, 0x74, 0x00, 0x82, 0x00, 0x8e, 0x00, 0x9c, 0x00, 0xa8, 0x00,
+  0xb4, 0x00, 0xc2, 0x00, 0xce, 0x00, 0xdc, 0x00, 0xe8, 0x00, 0xf4, 0x00,
+  0x02, 0x01, 0x10, 0x01, 0x1c, 0x01, 0x2b, 0x01, 0x37, 0x01, 0x4a, 0x01,
+  0x58, 0x01, 0x65, 0x01, 0x76, 0x01, 0x82, 0x01, 0x8e, 0x01, 0x9c, 0x01,
+  0xa8, 0x01, 0xb4, 0x01, 0xc4, 0x01, 0xd6, 0x01, 0xe2, 0x01, 0xf0, 0x01,
+  0xfe, 0x01, 0x0c, 0x02, 0x1d, 0x02, 0x00, 0x00, 0x1c, 0x00, 0x3e, 0x00,
+  0x70, 0x00, 0x7e, 0x00, 0x8d, 0x00, 0x9b, 0x00, 0xa9, 0x00, 0xb7, 0x00,
+  0xc6, 0x00, 0xe0, 0x00, 0xee, 0x00, 0xf9, 0x00, 0x07, 0x01, 0x12, 0x01,
+  0x21, 0x01, 0x2f, 0x01, 0x3b, 0x01, 0x4b, 0x01, 0x59, 0x01, 0x65, 0x01,
+  0x73, 0x01, 0x81, 0x01, 0x8d, 0x01, 0x9b, 0x01, 0xa7, 0x01, 0xb5, 0x01,
+  0xc3, 0x01, 0xd1, 0x01, 0xe0, 0x01, 0xeb, 0x01, 0xf9, 0x01, 0x05, 0x02,
+  0x13, 0x02, 0x22, 0x02, 0x39, 0x02, 0x43, 0x02, 0x4e, 0x02, 0x58, 0x02,
+  0x67, 0x02, 0x76, 0x02, 0x84, 0x02, 0x93, 0x02, 0xa1, 0x02, 0xaf, 0x02,
+  0xba, 0x02, 0xc8, 0x02, 0xd4, 0x02, 0xe2, 0x02, 0xf1, 0x02, 0x0b, 0x03,
+  0x00, 0x00, 0x24, 0x00, 0x46, 0x00, 0x6e, 0x00, 0x7c, 0x00, 0x88, 0x00,
+  0x97, 0x00, 0xa6, 0x00, 0xb6, 0x00, 0xc4, 0x00, 0xd2, 0x00, 0xe0, 0x00,
+  0xee, 0x00, 0xfc, 0x00, 0x0a, 0x01, 0x18, 0x01, 0x27, 0x01, 0x36, 0x01,
+  0x42, 0x01, 0x4c, 0x01, 0x5a, 0x01, 0x6b, 0x01, 0x7a, 0x01, 0x88, 0x01,
+  0x96, 0x01, 0xa2, 0x01, 0xb0, 0x01, 0xbe, 0x01, 0xcc, 0x01, 0xdd, 0x01,
+  0xeb, 0x01, 0xf9, 0x01, 0x07, 0x02, 0x13, 0x02, 0x21, 0x02, 0x2f, 0x02,
+  0x3d, 0x02, 0x4b, 0x02, 0x59, 0x02, 0x67, 0x02, 0x75, 0x02, 0x83, 0x02,
+  0x93, 0x02, 0xa1, 0x02, 0xaf, 0x02, 0xbd, 0x02, 0xcc, 0x02, 0xda, 0x02,
+  0xe9, 0x02, 0x00, 0x00, 0x29, 0x00, 0x4b, 0x00, 0x5b, 0x00, 0x6d, 0x00,
+  0x7d, 0x00, 0x89, 0x00, 0x99, 0x00, 0xaa, 0x00, 0xb6, 0x00, 0xc8, 0x00,
+  0xd6, 0x00, 0xe4, 0x00, 0xf4, 0x00, 0x00, 0x01, 0x0c, 0x01, 0x18, 0x01,
+  0x2a, 0x01, 0x36, 0x01, 0x44, 0x01, 0x52, 0x01, 0x5e, 0x01, 0x6f, 0x01,
+  0x7c, 0x01, 0x88, 0x01, 0x98, 0x01, 0xa4, 0x01, 0xb2, 0x01, 0xbe, 0x01,
+  0xcf, 0x01, 0xdd, 0x01, 0x00, 0x00, 0x24, 0x00, 0x4a, 0x00, 0x6e, 0x00,
+  0x82, 0x00, 0x90, 0x00, 0x9e, 0x00, 0xaa, 0x00, 0xc1, 0x00, 0xcd, 0x00,
+  0xd9, 0x00, 0xef, 0x00, 0xfb, 0x00, 0x0c, 0x01, 0x17, 0x01, 0x28, 0x01,
+  0x35, 0x01, 0x43, 0x01, 0x51, 0x01, 0x5d, 0x01, 0x6b, 0x01, 0x77, 0x01,
+  0x84, 0x01, 0x98, 0x01, 0xa8, 0x01, 0xb9, 0x01, 0xc5, 0x01, 0xd2, 0x01,
+  0xe4, 0x01, 0xf2, 0x01, 0xff, 0x01, 0x0d, 0x02, 0x00, 0x00, 0x36, 0x00,
+  0x44, 0x00, 0x50, 0x00, 0x5e, 0x00, 0x72, 0x00, 0x88, 0x00, 0x96, 0x00,
+  0xa5, 0x00, 0xb6, 0x00, 0xc2, 0x00, 0xd4, 0x00, 0xe2, 0x00, 0xf0, 0x00,
+  0x04, 0x01, 0x12, 0x01, 0x26, 0x01, 0x31, 0x01, 0x44, 0x01, 0x55, 0x01,
+  0x68, 0x01, 0x76, 0x01, 0x84, 0x01, 0x92, 0x01, 0xa1, 0x01, 0x00, 0x00,
+  0x1c, 0x00, 0x51, 0x00, 0x5f, 0x00, 0x6e, 0x00, 0x7e, 0x00, 0x92, 0x00,
+  0xa0, 0x00, 0xad, 0x00, 0xc0, 0x00, 0xc9, 0x00, 0xd9, 0x00, 0xea, 0x00,
+  0xf8, 0x00, 0x00, 0x00, 0x22, 0x00, 0x30, 0x00, 0x46, 0x00, 0x5d, 0x00,
+  0x6b, 0x00, 0x82, 0x00, 0x90, 0x00, 0x9c, 0x00, 0xaa, 0x00, 0xb6, 0x00,
+  0xc2, 0x00, 0xce, 0x00, 0xda, 0x00, 0xe8, 0x00, 0xf8, 0x00, 0x04, 0x01,
+  0x10, 0x01, 0x1c, 0x01, 0x28, 0x01, 0x34, 0x01, 0x40, 0x01, 0x4e, 0x01,
+  0x5a, 0x01, 0x6c, 0x01, 0x78, 0x01, 0x84, 0x01, 0x90, 0x01, 0x9c, 0x01,
+  0xa8, 0x01, 0xb4, 0x01, 0x00, 0x00, 0x20, 0x00, 0x42, 0x00, 0x62, 0x00,
+  0x80, 0x00, 0x8c, 0x00, 0x9f, 0x00, 0xa9, 0x00, 0xb7, 0x00, 0xca, 0x00,
+  0xdd, 0x00, 0xeb, 0x00, 0xf7, 0x00, 0x09, 0x01, 0x15, 0x01, 0x27, 0x01,
+  0x33, 0x01, 0x3e, 0x01, 0x4f, 0x01, 0x61, 0x01, 0x74, 0x01, 0x87, 0x01,
+  0x99, 0x01, 0xa8, 0x01, 0xb6, 0x01, 0xc4, 0x01, 0xce, 0x01, 0xda, 0x01,
+  0xe6, 0x01, 0xf8, 0x01, 0x00, 0x00, 0x32, 0x00, 0x5f, 0x00, 0x6d, 0x00,
+  0x7b, 0x00, 0x8f, 0x00, 0x9d, 0x00, 0xac, 0x00, 0xc1, 0x00, 0xcf, 0x00,
+  0xde, 0x00, 0xec, 0x00, 0xfa, 0x00, 0x08, 0x01, 0x16, 0x01, 0x24, 0x01,
+  0x33, 0x01, 0x41, 0x01, 0x4d, 0x01, 0x62, 0x01, 0x70, 0x01, 0x7d, 0x01,
+  0x8b, 0x01, 0x95, 0x01, 0xa1, 0x01, 0xaf, 0x01, 0xc6, 0x01, 0xd4, 0x01,
+  0xe2, 0x01, 0xec, 0x01, 0x04, 0x02, 0x13, 0x02, 0x1f, 0x02, 0x2d, 0x02,
+  0x3b, 0x02, 0x45, 0x02, 0x53, 0x02, 0x61, 0x02, 0x6d, 0x02, 0x7b, 0x02,
+  0x85, 0x02, 0x90, 0x02, 0x9e, 0x02, 0xac, 0x02, 0xba, 0x02, 0xc8, 0x02,
+  0x00, 0x00, 0x22, 0x00, 0x3c, 0x00, 0x51, 0x00, 0x61, 0x00, 0x6b, 0x00,
+  0x79, 0x00, 0x87, 0x00, 0x99, 0x00, 0xad, 0x00, 0xbb, 0x00, 0xd1, 0x00,
+  0xe5, 0x00, 0xf3, 0x00, 0x01, 0x01, 0x0c, 0x01, 0x21, 0x01, 0x2d, 0x01,
+  0x41, 0x01, 0x4f, 0x01, 0x5f, 0x01, 0x6d, 0x01, 0x80, 0x01, 0x97, 0x01,
+  0x00, 0x00, 0x22, 0x00, 0x31, 0x00, 0x49, 0x00, 0x55, 0x00, 0x66, 0x00,
+  0x74, 0x00, 0x85, 0x00, 0x91, 0x00, 0x9f, 0x00, 0xb0, 0x00, 0xc1, 0x00,
+  0xcf, 0x00, 0xdd, 0x00, 0xe9, 0x00, 0xfb, 0x00, 0x0d, 0x01, 0x1c, 0x01,
+  0x2d, 0x01, 0x3d, 0x01, 0x4d, 0x01, 0x5b, 0x01, 0x69, 0x01, 0x77, 0x01,
+  0x85, 0x01, 0x91, 0x01, 0x9f, 0x01, 0x00, 0x00, 0x2b, 0x00, 0x6d, 0x00,
+  0x8f, 0x00, 0xc2, 0x00, 0xd3, 0x00, 0xe0, 0x00, 0xeb, 0x00, 0x05, 0x01,
+  0x17, 0x01, 0x23, 0x01, 0x30, 0x01, 0x47, 0x01, 0x52, 0x01, 0x66, 0x01,
+  0x78, 0x01, 0x8e, 0x01, 0x9d, 0x01, 0xb1, 0x01, 0xbe, 0x01, 0xca, 0x01,
+  0x00, 0x00, 0x27, 0x00, 0x38, 0x00, 0x46, 0x00, 0x5a, 0x00, 0x65, 0x00,
+  0x70, 0x00, 0x7e, 0x00, 0x8a, 0x00, 0x98, 0x00, 0xa3, 0x00, 0xae, 0x00,
+  0xbc, 0x00, 0xca, 0x00, 0xd6, 0x00, 0xed, 0x00, 0xf9, 0x00, 0x0a, 0x01,
+  0x18, 0x01, 0x22, 0x01, 0x31, 0x01, 0x41, 0x01, 0x52, 0x01, 0x66, 0x01,
+  0x72, 0x01, 0x80, 0x01, 0x94, 0x01, 0xa7, 0x01, 0xb5, 0x01, 0xc3, 0x01,
+  0xce, 0x01, 0xdc, 0x01, 0xeb, 0x01, 0xf7, 0x01, 0x00, 0x00, 0x0c, 0x00,
+  0x1c, 0x00, 0x2c, 0x00, 0x40, 0x00, 0x4e, 0x00, 0x5b, 0x00, 0x68, 0x00,
+  0x76, 0x00, 0x8a, 0x00, 0x9d, 0x00, 0xad, 0x00, 0xbe, 0x00, 0xc9, 0x00,
+  0xd5, 0x00, 0xe5, 0x00, 0xf4, 0x00, 0x04, 0x01, 0x0f, 0x01, 0x1b, 0x01,
+  0x2b, 0x01, 0x37, 0x01, 0x47, 0x01, 0x57, 0x01, 0x00, 0x00, 0x0e, 0x00,
+  0x19, 0x00, 0x24, 0x00, 0x35, 0x00, 0x45, 0x00, 0x53, 0x00, 0x61, 0x00,
+  0x6e, 0x00, 0x79, 0x00, 0x87, 0x00, 0x96, 0x00, 0xa3, 0x00, 0xae, 0x00,
+  0xba, 0x00, 0xc8, 0x00, 0xd3, 0x00, 0xe1, 0x00, 0xee, 0x00, 0xfe, 0x00,
+  0x09, 0x01, 0x17, 0x01, 0x22, 0x01, 0x2d, 0x01, 0x3b, 0x01, 0x49, 0x01,
+  0x57, 0x01, 0x65, 0x01, 0x73, 0x01, 0x7f, 0x01, 0x8a, 0x01, 0x00, 0x00,
+  0x0c, 0x00, 0x1e, 0x00, 0x2c, 0x00, 0x38, 0x00, 0x44, 0x00, 0x53, 0x00,
+  0x5f, 0x00, 0x71, 0x00, 0x7c, 0x00, 0x8e, 0x00, 0x9c, 0x00, 0xad, 0x00,
+  0xbb, 0x00, 0xcd, 0x00, 0xd7, 0x00, 0xe5, 0x00, 0xfa, 0x00, 0x05, 0x01,
+  0x13, 0x01, 0x25, 0x01, 0x00, 0x00, 0x2c, 0x00, 0x37, 0x00, 0x45, 0x00,
+  0x53, 0x00, 0x61, 0x00, 0x70, 0x00, 0x7e, 0x00, 0x88, 0x00, 0x96, 0x00,
+  0xa4, 0x00, 0xb4, 0x00, 0xc3, 0x00, 0xd3, 0x00, 0xe3, 0x00, 0xf1, 0x00,
+  0x02, 0x01, 0x16, 0x01, 0x2d, 0x01, 0x3b, 0x01, 0x46, 0x01, 0x55, 0x01,
+  0x63, 0x01, 0x71, 0x01, 0x80, 0x01, 0x8e, 0x01, 0x9d, 0x01, 0xac, 0x01,
+  0xbb, 0x01, 0xc9, 0x01, 0xd7, 0x01, 0xe5, 0x01, 0xf3, 0x01, 0x00, 0x00,
+  0x16, 0x00, 0x3a, 0x00, 0x5a, 0x00, 0x6b, 0x00, 0x7c, 0x00, 0x8a, 0x00,
+  0x9c, 0x00, 0xaa, 0x00, 0xbf, 0x00, 0xca, 0x00, 0xd6, 0x00, 0xe4, 0x00,
+  0xf9, 0x00, 0x05, 0x01, 0x13, 0x01, 0x1f, 0x01, 0x00, 0x00, 0x18, 0x00,
+  0x23, 0x00, 0x2f, 0x00, 0x3d, 0x00, 0x4b, 0x00, 0x5e, 0x00, 0x70, 0x00,
+  0x7c, 0x00, 0x88, 0x00, 0x93, 0x00, 0xa5, 0x00, 0xb2, 0x00, 0xc4, 0x00,
+  0xd4, 0x00, 0xe2, 0x00, 0xf4, 0x00, 0x06, 0x01, 0x25, 0x01, 0x00, 0x00,
+  0x11, 0x00, 0x1f, 0x00, 0x2c, 0x00, 0x3a, 0x00, 0x46, 0x00, 0x56, 0x00,
+  0x64, 0x00, 0x71, 0x00, 0x82, 0x00, 0x90, 0x00, 0x9c, 0x00, 0xaa, 0x00,
+  0xb6, 0x00, 0xc2, 0x00, 0x00, 0x00, 0x26, 0x00, 0x34, 0x00, 0x4b, 0x00,
+  0x57, 0x00, 0x6c, 0x00, 0x7a, 0x00, 0x88, 0x00, 0x96, 0x00, 0xa1, 0x00,
+  0xac, 0x00, 0xb7, 0x00, 0xc6, 0x00, 0xd4, 0x00, 0xeb, 0x00, 0xf9, 0x00,
+  0x05, 0x01, 0x11, 0x01, 0x1f, 0x01, 0x34, 0x01, 0x45, 0x01, 0x54, 0x01,
+  0x60, 0x01, 0x6e, 0x01, 0x7a, 0x01, 0x88, 0x01, 0x94, 0x01, 0xa0, 0x01,
+  0xaf, 0x01, 0x00, 0x00, 0x1e, 0x00, 0x28, 0x00, 0x32, 0x00, 0x40, 0x00,
+  0x4c, 0x00, 0x5a, 0x00, 0x6a, 0x00, 0x78, 0x00, 0x82, 0x00, 0x8e, 0x00,
+  0x97, 0x00, 0xa7, 0x00, 0xb8, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x20, 0x00, 0x32, 0x00, 0x42, 0x00, 0x4e, 0x00, 0x5c, 0x00, 0x6a, 0x00,
+  0x7c, 0x00, 0x88, 0x00, 0x9a, 0x00, 0xaa, 0x00, 0xc1, 0x00, 0xd0, 0x00,
+  0xe0, 0x00, 0xec, 0x00, 0xf8, 0x00, 0x06, 0x01, 0x15, 0x01, 0x21, 0x01,
+  0x00, 0x00, 0x1e, 0x00, 0x3a, 0x00, 0x43, 0x00, 0x50, 0x00, 0x5e, 0x00,
+  0x6b, 0x00, 0x78, 0x00, 0x85, 0x00, 0x92, 0x00, 0x9c, 0x00, 0xae, 0x00,
+  0xbc, 0x00, 0xc8, 0x00, 0xd5, 0x00, 0xdf, 0x00, 0xed, 0x00, 0xfd, 0x00,
+  0x0a, 0x01, 0x16, 0x01, 0x22, 0x01, 0x2f, 0x01, 0x00, 0x00, 0x0b, 0x00,
+  0x17, 0x00, 0x23, 0x00, 0x37, 0x00, 0x4c, 0x00, 0x62, 0x00, 0x7a, 0x00,
+  0x8b, 0x00, 0x9f, 0x00, 0xab, 0x00, 0xb5, 0x00, 0xbf, 0x00, 0xd3, 0x00,
+  0xe5, 0x00, 0xf0, 0x00, 0xff, 0x00, 0x0c, 0x01, 0x1a, 0x01, 0x2d, 0x01,
+  0x3e, 0x01, 0x48, 0x01, 0x59, 0x01, 0x65, 0x01, 0x70, 0x01, 0x7b, 0x01,
+  0x85, 0x01, 0x00, 0x00, 0x22, 0x00, 0x44, 0x00, 0x50, 0x00, 0x5f, 0x00,
+  0x71, 0x00, 0x81, 0x00, 0x92, 0x00, 0x9e, 0x00, 0xad, 0x00, 0xbb, 0x00,
+  0xca, 0x00, 0xd6, 0x00, 0xe6, 0x00, 0xf4, 0x00, 0x04, 0x01, 0x19, 0x01,
+  0x27, 0x01, 0x37, 0x01, 0x43, 0x01, 0x52, 0x01, 0x66, 0x01, 0x76, 0x01,
+  0x84, 0x01, 0x92, 0x01, 0xa1, 0x01, 0xb2, 0x01, 0xbd, 0x01, 0xc9, 0x01,
+  0xd9, 0x01, 0xe9, 0x01, 0xf9, 0x01, 0x07, 0x02, 0x12, 0x02, 0x1d, 0x02,
+  0x2d, 0x02, 0x3b, 0x02, 0x4a, 0x02, 0x5f, 0x02, 0x00, 0x00, 0x1e, 0x00,
+  0x2a, 0x00, 0x35, 0x00, 0x41, 0x00, 0x4d, 0x00, 0x59, 0x00, 0x66, 0x00,
+  0x72, 0x00, 0x7e, 0x00, 0x8d, 0x00, 0x98, 0x00, 0xa3, 0x00, 0xb1, 0x00,
+  0xbd, 0x00, 0xc9, 0x00, 0xd6, 0x00, 0xe3, 0x00, 0xee, 0x00, 0xf9, 0x00,
+  0x05, 0x01, 0x11, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x35, 0x01, 0x40, 0x01,
+  0x4b, 0x01, 0x57, 0x01, 0x62, 0x01, 0x6e, 0x01, 0x7a, 0x01, 0x86, 0x01,
+  0x94, 0x01, 0xa0, 0x01, 0xae, 0x01, 0xb9, 0x01, 0xc4, 0x01, 0xdc, 0x01,
+  0xe8, 0x01, 0x00, 0x00, 0x12, 0x00, 0x2b, 0x00, 0x3e, 0x00, 0x50, 0x00,
+  0x5d, 0x00, 0x6b, 0x00, 0x77, 0x00, 0x86, 0x00, 0x92, 0x00, 0xa4, 0x00,
+  0xb3, 0x00, 0xc0, 0x00, 0xd5, 0x00, 0xe2, 0x00, 0xed, 0x00, 0xfa, 0x00,
+  0x06, 0x01, 0x15, 0x01, 0x28, 0x01, 0x35, 0x01, 0x42, 0x01, 0x4c, 0x01,
+  0x5a, 0x01, 0x68, 0x01, 0x77, 0x01, 0x85, 0x01, 0x91, 0x01, 0x9e, 0x01,
+  0xab, 0x01, 0xbd, 0x01, 0xcb, 0x01, 0xd5, 0x01, 0xdf, 0x01, 0xeb, 0x01,
+  0xfa, 0x01, 0x07, 0x02, 0x1d, 0x02, 0x29, 0x02, 0x35, 0x02, 0x47, 0x02,
+  0x55, 0x02, 0x67, 0x02, 0x73, 0x02, 0x84, 0x02, 0x95, 0x02, 0xa8, 0x02,
+  0xb7, 0x02, 0xc1, 0x02, 0xd0, 0x02, 0xdf, 0x02, 0xea, 0x02, 0x00, 0x00,
+  0x1e, 0x00, 0x29, 0x00, 0x37, 0x00, 0x4b, 0x00, 0x59, 0x00, 0x67, 0x00,
+  0x76, 0x00, 0x84, 0x00, 0x92, 0x00, 0xa0, 0x00, 0xac, 0x00, 0xba, 0x00,
+  0xc8, 0x00, 0xd7, 0x00, 0xe5, 0x00, 0xf4, 0x00, 0x02, 0x01, 0x0d, 0x01,
+  0x1b, 0x01, 0x26, 0x01, 0x34, 0x01, 0x3f, 0x01, 0x4a, 0x01, 0x54, 0x01,
+  0x5f, 0x01, 0x6d, 0x01, 0x79, 0x01, 0x87, 0x01, 0x92, 0x01, 0x9e, 0x01,
+  0xaf, 0x01, 0xbb, 0x01, 0xca, 0x01, 0xd8, 0x01, 0xed, 0x01, 0xfc, 0x01,
+  0x0a, 0x02, 0x16, 0x02, 0x22, 0x02, 0x2e, 0x02, 0x3a, 0x02, 0x44, 0x02,
+  0x52, 0x02, 0x60, 0x02, 0x6e, 0x02, 0x79, 0x02, 0x83, 0x02, 0x00, 0x00,
+  0x10, 0x00, 0x1e, 0x00, 0x2a, 0x00, 0x38, 0x00, 0x43, 0x00, 0x58, 0x00,
+  0x64, 0x00, 0x6f, 0x00, 0x7a, 0x00, 0x89, 0x00, 0x94, 0x00, 0xa4, 0x00,
+  0xb1, 0x00, 0xbb, 0x00, 0xc9, 0x00, 0xd7, 0x00, 0xe4, 0x00, 0xf1, 0x00,
+  0x05, 0x01, 0x11, 0x01, 0x1e, 0x01, 0x2c, 0x01, 0x39, 0x01, 0x45, 0x01,
+  0x52, 0x01, 0x5e, 0x01, 0x6a, 0x01, 0x78, 0x01, 0x83, 0x01, 0x8d, 0x01,
+  0x97, 0x01, 0xa2, 0x01, 0xb2, 0x01, 0xbd, 0x01, 0xc9, 0x01, 0xd4, 0x01,
+  0xe0, 0x01, 0xed, 0x01, 0x00, 0x00, 0x20, 0x00, 0x2c, 0x00, 0x3a, 0x00,
+  0x48, 0x00, 0x59, 0x00, 0x67, 0x00, 0x73, 0x00, 0x83, 0x00, 0x91, 0x00,
+  0x9d, 0x00, 0xad, 0x00, 0xbb, 0x00, 0xc6, 0x00, 0xd2, 0x00, 0xdf, 0x00,
+  0xea, 0x00, 0xf9, 0x00, 0x07, 0x01, 0x13, 0x01, 0x1f, 0x01, 0x2d, 0x01,
+  0x3e, 0x01, 0x4a, 0x01, 0x55, 0x01, 0x61, 0x01, 0x71, 0x01, 0x7d, 0x01,
+  0x8f, 0x01, 0xa0, 0x01, 0xac, 0x01, 0xb7, 0x01, 0xc2, 0x01, 0xce, 0x01,
+  0xdf, 0x01, 0xea, 0x01, 0xf6, 0x01, 0x02, 0x02, 0x13, 0x02, 0x1f, 0x02,
+  0x2b, 0x02, 0x37, 0x02, 0x43, 0x02, 0x50, 0x02, 0x5e, 0x02, 0x69, 0x02,
+  0x7a, 0x02, 0x85, 0x02, 0x91, 0x02, 0x9c, 0x02, 0xad, 0x02, 0xb9, 0x02,
+  0xc5, 0x02, 0x00, 0x00, 0x20, 0x00, 0x2e, 0x00, 0x3d, 0x00, 0x4a, 0x00,
+  0x58, 0x00, 0x62, 0x00, 0x6e, 0x00, 0x7a, 0x00, 0x89, 0x00, 0x97, 0x00,
+  0xa5, 0x00, 0xb3, 0x00, 0xbf, 0x00, 0xcb, 0x00, 0xd7, 0x00, 0xe3, 0x00,
+  0xf1, 0x00, 0xfb, 0x00, 0x07, 0x01, 0x13, 0x01, 0x24, 0x01, 0x32, 0x01,
+  0x42, 0x01, 0x4d, 0x01, 0x5b, 0x01, 0x67, 0x01, 0x71, 0x01, 0x7f, 0x01,
+  0x8c, 0x01, 0x97, 0x01, 0xa5, 0x01, 0xb2, 0x01, 0xc1, 0x01, 0xcf, 0x01,
+  0xdb, 0x01, 0xeb, 0x01, 0xf9, 0x01, 0x03, 0x02, 0x14, 0x02, 0x1f, 0x02,
+  0x2d, 0x02, 0x3d, 0x02, 0x4c, 0x02, 0x59, 0x02, 0x65, 0x02, 0x6f, 0x02,
+  0x7d, 0x02, 0x8b, 0x02, 0x97, 0x02, 0xa2, 0x02, 0xad, 0x02, 0xb9, 0x02,
+  0xc5, 0x02, 0xd3, 0x02, 0x00, 0x00, 0x11, 0x00, 0x1f, 0x00, 0x30, 0x00,
+  0x3e, 0x00, 0x52, 0x00, 0x5d, 0x00, 0x6d, 0x00, 0x7c, 0x00, 0x8a, 0x00,
+  0x98, 0x00, 0xa6, 0x00, 0xb4, 0x00, 0xc2, 0x00, 0xd0, 0x00, 0xde, 0x00,
+  0xec, 0x00, 0xfb, 0x00, 0x09, 0x01, 0x19, 0x01, 0x25, 0x01, 0x33, 0x01,
+  0x3f, 0x01, 0x4b, 0x01, 0x59, 0x01, 0x67, 0x01, 0x77, 0x01, 0x85, 0x01,
+  0x90, 0x01, 0x9e, 0x01, 0xae, 0x01, 0xbc, 0x01, 0xca, 0x01, 0xda, 0x01,
+  0xef, 0x01, 0xfb, 0x01, 0x09, 0x02, 0x15, 0x02, 0x23, 0x02, 0x31, 0x02,
+  0x3d, 0x02, 0x48, 0x02, 0x59, 0x02, 0x67, 0x02, 0x75, 0x02, 0x7f, 0x02,
+  0x8b, 0x02, 0xa0, 0x02, 0xaf, 0x02, 0xbd, 0x02, 0xcb, 0x02, 0xd7, 0x02,
+  0xe3, 0x02, 0xf1, 0x02, 0xff, 0x02, 0x00, 0x00, 0x0c, 0x00, 0x1a, 0x00,
+  0x28, 0x00, 0x36, 0x00, 0x44, 0x00, 0x55, 0x00, 0x63, 0x00, 0x71, 0x00,
+  0x80, 0x00, 0x8e, 0x00, 0x9c, 0x00, 0xa7, 0x00, 0xb5, 0x00, 0xc3, 0x00,
+  0xd4, 0x00, 0xe3, 0x00, 0xf1, 0x00, 0x03, 0x01, 0x12, 0x01, 0x20, 0x01,
+  0x32, 0x01, 0x45, 0x01, 0x5e, 0x01, 0x6c, 0x01, 0x7b, 0x01, 0x89, 0x01,
+  0x98, 0x01, 0xa8, 0x01, 0xb6, 0x01, 0xc4, 0x01, 0xd4, 0x01, 0xe2, 0x01,
+  0xf0, 0x01, 0x00, 0x02, 0x0e, 0x02, 0x00, 0x00, 0x10, 0x00, 0x1e, 0x00,
+  0x2a, 0x00, 0x38, 0x00, 0x46, 0x00, 0x57, 0x00, 0x68, 0x00, 0x74, 0x00,
+  0x83, 0x00, 0x8f, 0x00, 0x9c, 0x00, 0xad, 0x00, 0xb9, 0x00, 0xcb, 0x00,
+  0xd7, 0x00, 0xe3, 0x00, 0xef, 0x00, 0xfd, 0x00, 0x0b, 0x01, 0x17, 0x01,
+  0x28, 0x01, 0x3c, 0x01, 0x49, 0x01, 0x55, 0x01, 0x61, 0x01, 0x72, 0x01,
+  0x7e, 0x01, 0x8a, 0x01, 0x9a, 0x01, 0xa8, 0x01, 0xbf, 0x01, 0xcc, 0x01,
+  0xdc, 0x01, 0xe8, 0x01, 0xf6, 0x01, 0x04, 0x02, 0x16, 0x02, 0x26, 0x02,
+  0x32, 0x02, 0x43, 0x02, 0x52, 0x02, 0x5e, 0x02, 0x00, 0x00, 0x0e, 0x00,
+  0x23, 0x00, 0x34, 0x00, 0x45, 0x00, 0x57, 0x00, 0x63, 0x00, 0x74, 0x00,
+  0x82, 0x00, 0x90, 0x00, 0x9c, 0x00, 0xac, 0x00, 0xba, 0x00, 0xc6, 0x00,
+  0xd4, 0x00, 0xe2, 0x00, 0xec, 0x00, 0xf6, 0x00, 0x02, 0x01, 0x14, 0x01,
+  0x20, 0x01, 0x30, 0x01, 0x3e, 0x01, 0x49, 0x01, 0x53, 0x01, 0x61, 0x01,
+  0x77, 0x01, 0x85, 0x01, 0x93, 0x01, 0xa3, 0x01, 0xb0, 0x01, 0xc2, 0x01,
+  0x00, 0x00, 0x0b, 0x00, 0x17, 0x00, 0x26, 0x00, 0x30, 0x00, 0x3b, 0x00,
+  0x47, 0x00, 0x52, 0x00, 0x5d, 0x00, 0x71, 0x00, 0x7e, 0x00, 0x8a, 0x00,
+  0x98, 0x00, 0xb0, 0x00, 0xba, 0x00, 0xce, 0x00, 0xdc, 0x00, 0xec, 0x00,
+  0xfa, 0x00, 0x05, 0x01, 0x0f, 0x01, 0x1a, 0x01, 0x25, 0x01, 0x37, 0x01,
+  0x41, 0x01, 0x4c, 0x01, 0x57, 0x01, 0x62, 0x01, 0x70, 0x01, 0x84, 0x01,
+  0x8e, 0x01, 0xa2, 0x01, 0xb4, 0x01, 0xc5, 0x01, 0xd0, 0x01, 0xe2, 0x01,
+  0xf6, 0x01, 0x01, 0x02, 0x0f, 0x02, 0x1d, 0x02, 0x00, 0x00, 0x0b, 0x00,
+  0x17, 0x00, 0x2b, 0x00, 0x38, 0x00, 0x44, 0x00, 0x4f, 0x00, 0x63, 0x00,
+  0x73, 0x00, 0x7f, 0x00, 0x8a, 0x00, 0x94, 0x00, 0xa5, 0x00, 0xb1, 0x00,
+  0xbc, 0x00, 0xc7, 0x00, 0xd7, 0x00, 0xe5, 0x00, 0xf7, 0x00, 0x01, 0x01,
+  0x0b, 0x01, 0x1e, 0x01, 0x29, 0x01, 0x39, 0x01, 0x45, 0x01, 0x53, 0x01,
+  0x63, 0x01, 0x70, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x1a, 0x00, 0x26, 0x00,
+  0x34, 0x00, 0x40, 0x00, 0x50, 0x00, 0x5d, 0x00, 0x6b, 0x00, 0x79, 0x00,
+  0x87, 0x00, 0x95, 0x00, 0xa1, 0x00, 0xad, 0x00, 0xbb, 0x00, 0xc7, 0x00,
+  0xd3, 0x00, 0xe1, 0x00, 0xed, 0x00, 0xfb, 0x00, 0x07, 0x01, 0x13, 0x01,
+  0x1f, 0x01, 0x2d, 0x01, 0x39, 0x01, 0x45, 0x01, 0x55, 0x01, 0x61, 0x01,
+  0x6d, 0x01, 0x79, 0x01, 0x85, 0x01, 0x9f, 0x01, 0xab, 0x01, 0xb9, 0x01,
+  0xca, 0x01, 0x00, 0x00, 0x0e, 0x00, 0x1a, 0x00, 0x28, 0x00, 0x3a, 0x00,
+  0x4c, 0x00, 0x5a, 0x00, 0x6b, 0x00, 0x79, 0x00, 0x86, 0x00, 0x94, 0x00,
+  0xa2, 0x00, 0xb4, 0x00, 0xc2, 0x00, 0xcf, 0x00, 0xd9, 0x00, 0xe5, 0x00,
+  0xf2, 0x00, 0x09, 0x01, 0x18, 0x01, 0x2b, 0x01, 0x38, 0x01, 0x4a, 0x01,
+  0x55, 0x01, 0x62, 0x01, 0x6e, 0x01, 0x7a, 0x01, 0x89, 0x01, 0x97, 0x01,
+  0xa3, 0x01, 0xb1, 0x01, 0xbd, 0x01, 0xc9, 0x01, 0xd5, 0x01, 0x00, 0x00,
+  0x22, 0x00, 0x2e, 0x00, 0x3d, 0x00, 0x47, 0x00, 0x55, 0x00, 0x63, 0x00,
+  0x71, 0x00, 0x7f, 0x00, 0x8d, 0x00, 0x99, 0x00, 0xa5, 0x00, 0xb8, 0x00,
+  0xc6, 0x00, 0xd4, 0x00, 0xe2, 0x00, 0xf0, 0x00, 0xfe, 0x00, 0x08, 0x01,
+  0x16, 0x01, 0x24, 0x01, 0x2e, 0x01, 0x3b, 0x01, 0x49, 0x01, 0x57, 0x01,
+  0x65, 0x01, 0x73, 0x01, 0x7e, 0x01, 0x8c, 0x01, 0x9b, 0x01, 0xa9, 0x01,
+  0xb7, 0x01, 0xc3, 0x01, 0xd4, 0x01, 0xe3, 0x01, 0xf1, 0x01, 0xff, 0x01,
+  0x0b, 0x02, 0x00, 0x00, 0x11, 0x00, 0x1d, 0x00, 0x2b, 0x00, 0x3b, 0x00,
+  0x48, 0x00, 0x59, 0x00, 0x67, 0x00, 0x77, 0x00, 0x83, 0x00, 0x94, 0x00,
+  0x9f, 0x00, 0xaf, 0x00, 0xbb, 0x00, 0xcb, 0x00, 0xd4, 0x00, 0xe5, 0x00,
+  0xf1, 0x00, 0x03, 0x01, 0x16, 0x01, 0x24, 0x01, 0x34, 0x01, 0x3e, 0x01,
+  0x53, 0x01, 0x61, 0x01, 0x00, 0x00, 0x0e, 0x00, 0x1a, 0x00, 0x2b, 0x00,
+  0x37, 0x00, 0x45, 0x00, 0x51, 0x00, 0x5d, 0x00, 0x6b, 0x00, 0x79, 0x00,
+  0x84, 0x00, 0x8f, 0x00, 0x9d, 0x00, 0xab, 0x00, 0xbc, 0x00, 0xcd, 0x00,
+  0xdb, 0x00, 0xf2, 0x00, 0x03, 0x01, 0x13, 0x01, 0x21, 0x01, 0x2d, 0x01,
+  0x3d, 0x01, 0x4b, 0x01, 0x57, 0x01, 0x65, 0x01, 0x73, 0x01, 0x81, 0x01,
+  0x91, 0x01, 0x9f, 0x01, 0xb0, 0x01, 0xbe, 0x01, 0xce, 0x01, 0xdc, 0x01,
+  0xe8, 0x01, 0xf4, 0x01, 0x00, 0x00, 0x12, 0x00, 0x20, 0x00, 0x32, 0x00,
+  0x40, 0x00, 0x4e, 0x00, 0x5f, 0x00, 0x6d, 0x00, 0x7f, 0x00, 0x91, 0x00,
+  0xa3, 0x00, 0xaf, 0x00, 0xc2, 0x00, 0xd5, 0x00, 0xe7, 0x00, 0xf1, 0x00,
+  0xff, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x19, 0x00, 0x29, 0x00, 0x35, 0x00,
+  0x43, 0x00, 0x56, 0x00, 0x64, 0x00, 0x75, 0x00, 0x86, 0x00, 0x94, 0x00,
+  0xa2, 0x00, 0xb3, 0x00, 0xc1, 0x00, 0xd2, 0x00, 0xdd, 0x00, 0xeb, 0x00,
+  0xff, 0x00, 0x0e, 0x01, 0x19, 0x01, 0x27, 0x01, 0x36, 0x01, 0x42, 0x01,
+  0x4e, 0x01, 0x5c, 0x01, 0x66, 0x01, 0x72, 0x01, 0x00, 0x00, 0x11, 0x00,
+  0x21, 0x00, 0x32, 0x00, 0x3e, 0x00, 0x4c, 0x00, 0x58, 0x00, 0x63, 0x00,
+  0x6f, 0x00, 0x7b, 0x00, 0x86, 0x00, 0x98, 0x00, 0x00, 0x00, 0x0d, 0x00,
+  0x1b, 0x00, 0x2d, 0x00, 0x38, 0x00, 0x43, 0x00, 0x51, 0x00, 0x5c, 0x00,
+  0x67, 0x00, 0x72, 0x00, 0x7d, 0x00, 0x8e, 0x00, 0x99, 0x00, 0xa7, 0x00,
+  0xb5, 0x00, 0xc6, 0x00, 0xd1, 0x00, 0xe3, 0x00, 0xee, 0x00, 0xfe, 0x00,
+  0x0c, 0x01, 0x21, 0x01, 0x30, 0x01, 0x44, 0x01, 0x51, 0x01, 0x5e, 0x01,
+  0x00, 0x00, 0x0f, 0x00, 0x1d, 0x00, 0x32, 0x00, 0x3d, 0x00, 0x47, 0x00,
+  0x5b, 0x00, 0x69, 0x00, 0x75, 0x00, 0x89, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x1e, 0x00, 0x2c, 0x00, 0x3a, 0x00, 0x48, 0x00, 0x56, 0x00, 0x65, 0x00,
+  0x71, 0x00, 0x7f, 0x00, 0x8d, 0x00, 0x99, 0x00, 0xa7, 0x00, 0xb7, 0x00,
+  0xc5, 0x00, 0xd3, 0x00, 0xe3, 0x00, 0xf1, 0x00, 0xfd, 0x00, 0x0b, 0x01,
+  0x17, 0x01, 0x25, 0x01, 0x33, 0x01, 0x41, 0x01, 0x51, 0x01, 0x62, 0x01,
+  0x6c, 0x01, 0x7f, 0x01, 0x8e, 0x01, 0x9d, 0x01, 0xab, 0x01, 0xb9, 0x01,
+  0xc5, 0x01, 0xd1, 0x01, 0xdf, 0x01, 0xed, 0x01, 0xff, 0x01, 0x0e, 0x02,
+  0x1a, 0x02, 0x28, 0x02, 0x36, 0x02, 0x45, 0x02, 0x53, 0x02, 0x00, 0x00,
+  0x1b, 0x00, 0x2b, 0x00, 0x40, 0x00, 0x51, 0x00, 0x5e, 0x00, 0x74, 0x00,
+  0x82, 0x00, 0x90, 0x00, 0x9f, 0x00, 0xac, 0x00, 0xb8, 0x00, 0xc0, 0x00,
+  0xca, 0x00, 0xe2, 0x00, 0xee, 0x00, 0x00, 0x00, 0x11, 0x00, 0x22, 0x00,
+  0x2e, 0x00, 0x3e, 0x00, 0x4a, 0x00, 0x56, 0x00, 0x67, 0x00, 0x73, 0x00,
+  0x7f, 0x00, 0x90, 0x00, 0x9c, 0x00, 0xae, 0x00, 0xc6, 0x00, 0xd2, 0x00,
+  0xe3, 0x00, 0xef, 0x00, 0xfe, 0x00, 0x0a, 0x01, 0x16, 0x01, 0x22, 0x01,
+  0x34, 0x01, 0x42, 0x01, 0x51, 0x01, 0x5d, 0x01, 0x6e, 0x01, 0x81, 0x01,
+  0x8d, 0x01, 0x9a, 0x01, 0xa6, 0x01, 0xb2, 0x01, 0x00, 0x00, 0x11, 0x00,
+  0x1f, 0x00, 0x2d, 0x00, 0x3d, 0x00, 0x49, 0x00, 0x55, 0x00, 0x64, 0x00,
+  0x6d, 0x00, 0x79, 0x00, 0x88, 0x00, 0x99, 0x00, 0xa2, 0x00, 0xab, 0x00,
+  0xb9, 0x00, 0x00, 0x00, 0x12, 0x00, 0x20, 0x00, 0x2e, 0x00, 0x41, 0x00,
+  0x4d, 0x00, 0x57, 0x00, 0x62, 0x00, 0x77, 0x00, 0x8c, 0x00, 0x9b, 0x00,
+  0xa9, 0x00, 0xbb, 0x00, 0xc7, 0x00, 0xd3, 0x00, 0xe1, 0x00, 0xef, 0x00,
+  0x02, 0x01, 0x10, 0x01, 0x1e, 0x01, 0x28, 0x01, 0x00, 0x00, 0x0f, 0x00,
+  0x20, 0x00, 0x30, 0x00, 0x40, 0x00, 0x4f, 0x00, 0x59, 0x00, 0x6a, 0x00,
+  0x74, 0x00, 0x7c, 0x00, 0x8d, 0x00, 0xa9, 0x00, 0xb5, 0x00, 0xc5, 0x00,
+  0xce, 0x00, 0xd9, 0x00, 0xe3, 0x00, 0xec, 0x00, 0xfc, 0x00, 0x0c, 0x01,
+  0x14, 0x01, 0x00, 0x00, 0x10, 0x00, 0x20, 0x00, 0x2c, 0x00, 0x3d, 0x00,
+  0x4b, 0x00, 0x57, 0x00, 0x67, 0x00, 0x73, 0x00, 0x87, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x20, 0x00, 0x32, 0x00, 0x44, 0x00, 0x56, 0x00, 0x61, 0x00,
+  0x74, 0x00, 0x7f, 0x00, 0x8c, 0x00, 0x97, 0x00, 0xa9, 0x00, 0xb2, 0x00,
+  0xc4, 0x00, 0xd6, 0x00, 0xe2, 0x00, 0xec, 0x00, 0xf9, 0x00, 0x0b, 0x01,
+  0x15, 0x01, 0x21, 0x01, 0x33, 0x01, 0x3c, 0x01, 0x4f, 0x01, 0x5a, 0x01,
+  0x68, 0x01, 0x73, 0x01, 0x85, 0x01, 0x8f, 0x01, 0x98, 0x01, 0xa3, 0x01,
+  0x00, 0x00, 0x0c, 0x00, 0x17, 0x00, 0x23, 0x00, 0x2d, 0x00, 0x3b, 0x00,
+  0x47, 0x00, 0x53, 0x00, 0x65, 0x00, 0x76, 0x00, 0x89, 0x00, 0x9b, 0x00,
+  0xa6, 0x00, 0xb0, 0x00, 0xb9, 0x00, 0xc4, 0x00, 0xd2, 0x00, 0xdc, 0x00,
+  0xee, 0x00, 0xf9, 0x00, 0x03, 0x01, 0x0d, 0x01, 0x17, 0x01, 0x00, 0x00,
+  0x0b, 0x00, 0x16, 0x00, 0x22, 0x00, 0x2e, 0x00, 0x3e, 0x00, 0x4b, 0x00,
+  0x57, 0x00, 0x64, 0x00, 0x74, 0x00, 0x80, 0x00, 0x8c, 0x00, 0x98, 0x00,
+  0xa9, 0x00, 0xb5, 0x00, 0xc4, 0x00, 0xd0, 0x00, 0xe5, 0x00, 0xf3, 0x00,
+  0xff, 0x00, 0x0f, 0x01, 0x1b, 0x01, 0x29, 0x01, 0x35, 0x01, 0x41, 0x01,
+  0x4c, 0x01, 0x58, 0x01, 0x00, 0x00, 0x22, 0x00, 0x2e, 0x00, 0x3a, 0x00,
+  0x46, 0x00, 0x54, 0x00, 0x5f, 0x00, 0x6b, 0x00, 0x76, 0x00, 0x81, 0x00,
+  0x8d, 0x00, 0x9b, 0x00, 0xa9, 0x00, 0xc1, 0x00, 0xcc, 0x00, 0xd7, 0x00,
+  0xe2, 0x00, 0xee, 0x00, 0xfa, 0x00, 0x06, 0x01, 0x12, 0x01, 0x1b, 0x01,
+  0x27, 0x01, 0x34, 0x01, 0x3f, 0x01, 0x48, 0x01, 0x53, 0x01, 0x5e, 0x01,
+  0x66, 0x01, 0x81, 0x01, 0x8d, 0x01, 0x99, 0x01, 0xa5, 0x01, 0xb1, 0x01,
+  0xbf, 0x01, 0xca, 0x01, 0x00, 0x00, 0x18, 0x00, 0x24, 0x00, 0x33, 0x00,
+  0x3d, 0x00, 0x49, 0x00, 0x55, 0x00, 0x61, 0x00, 0x73, 0x00, 0x7f, 0x00,
+  0x92, 0x00, 0xa0, 0x00, 0xb2, 0x00, 0xbe, 0x00, 0xd0, 0x00, 0xe3, 0x00,
+  0xee, 0x00, 0x00, 0x01, 0x0c, 0x01, 0x1e, 0x01, 0x29, 0x01, 0x34, 0x01,
+  0x46, 0x01, 0x4f, 0x01, 0x5b, 0x01, 0x66, 0x01, 0x78, 0x01, 0x84, 0x01,
+  0x90, 0x01, 0xa6, 0x01, 0xb8, 0x01, 0xc4, 0x01, 0xd5, 0x01, 0xe3, 0x01,
+  0xef, 0x01, 0x00, 0x02, 0x12, 0x02, 0x20, 0x02, 0x2a, 0x02, 0x38, 0x02,
+  0x41, 0x02, 0x55, 0x02, 0x61, 0x02, 0x73, 0x02, 0x7f, 0x02, 0x89, 0x02,
+  0x9b, 0x02, 0xae, 0x02, 0xbd, 0x02, 0xc7, 0x02, 0xd3, 0x02, 0xdf, 0x02,
+  0xeb, 0x02, 0xfc, 0x02, 0x08, 0x03, 0x1a, 0x03, 0x24, 0x03, 0x30, 0x03,
+  0x3a, 0x03, 0x4c, 0x03, 0x5e, 0x03, 0x6a, 0x03, 0x00, 0x00, 0x0e, 0x00,
+  0x1c, 0x00, 0x28, 0x00, 0x36, 0x00, 0x44, 0x00, 0x53, 0x00, 0x5e, 0x00,
+  0x69, 0x00, 0x75, 0x00, 0x83, 0x00, 0x91, 0x00, 0x9e, 0x00, 0xac, 0x00,
+  0xb8, 0x00, 0xc6, 0x00, 0xd2, 0x00, 0xdd, 0x00, 0xe8, 0x00, 0xf7, 0x00,
+  0x05, 0x01, 0x13, 0x01, 0x1a, 0x01, 0x28, 0x01, 0x33, 0x01, 0x41, 0x01,
+  0x4c, 0x01, 0x57, 0x01, 0x61, 0x01, 0x6c, 0x01, 0x78, 0x01, 0x83, 0x01,
+  0x91, 0x01, 0x9f, 0x01, 0xad, 0x01, 0xb8, 0x01, 0xc7, 0x01, 0xd3, 0x01,
+  0xdf, 0x01, 0xec, 0x01, 0xfb, 0x01, 0x09, 0x02, 0x13, 0x02, 0x1d, 0x02,
+  0x00, 0x00, 0x16, 0x00, 0x21, 0x00, 0x36, 0x00, 0x47, 0x00, 0x58, 0x00,
+  0x6d, 0x00, 0x78, 0x00, 0x86, 0x00, 0x91, 0x00, 0x9d, 0x00, 0xac, 0x00,
+  0xb8, 0x00, 0xc4, 0x00, 0xd2, 0x00, 0xdd, 0x00, 0xf1, 0x00, 0x05, 0x01,
+  0x1a, 0x01, 0x26, 0x01, 0x3b, 0x01, 0x49, 0x01, 0x55, 0x01, 0x60, 0x01,
+  0x6c, 0x01, 0x78, 0x01, 0x82, 0x01, 0x90, 0x01, 0x9e, 0x01, 0xae, 0x01,
+  0xba, 0x01, 0xc5, 0x01, 0xd1, 0x01, 0xdf, 0x01, 0xf4, 0x01, 0x04, 0x02,
+  0x12, 0x02, 0x20, 0x02, 0x2a, 0x02, 0x3f, 0x02, 0x4b, 0x02, 0x57, 0x02,
+  0x61, 0x02, 0x6d, 0x02, 0x7b, 0x02, 0x8a, 0x02, 0x98, 0x02, 0xa2, 0x02,
+  0xae, 0x02, 0xbc, 0x02, 0xca, 0x02, 0xd8, 0x02, 0xe4, 0x02, 0xf0, 0x02,
+  0xf9, 0x02, 0x05, 0x03, 0x00, 0x00, 0x0d, 0x00, 0x18, 0x00, 0x26, 0x00,
+  0x36, 0x00, 0x46, 0x00, 0x52, 0x00, 0x5e, 0x00, 0x6e, 0x00, 0x7c, 0x00,
+  0x87, 0x00, 0x93, 0x00, 0x9e, 0x00, 0xaa, 0x00, 0xb7, 0x00, 0xc8, 0x00,
+  0xd6, 0x00, 0xe6, 0x00, 0xf3, 0x00, 0xff, 0x00, 0x0d, 0x01, 0x19, 0x01,
+  0x24, 0x01, 0x2f, 0x01, 0x3d, 0x01, 0x48, 0x01, 0x56, 0x01, 0x64, 0x01,
+  0x74, 0x01, 0x87, 0x01, 0x95, 0x01, 0xa0, 0x01, 0xac, 0x01, 0xb8, 0x01,
+  0xc4, 0x01, 0xd0, 0x01, 0xdc, 0x01, 0xe8, 0x01, 0xf5, 0x01, 0x01, 0x02,
+  0x0c, 0x02, 0x1c, 0x02, 0x27, 0x02, 0x37, 0x02, 0x45, 0x02, 0x53, 0x02,
+  0x61, 0x02, 0x6c, 0x02, 0x78, 0x02, 0x83, 0x02, 0x8e, 0x02, 0x00, 0x00,
+  0x0c, 0x00, 0x1a, 0x00, 0x25, 0x00, 0x38, 0x00, 0x46, 0x00, 0x52, 0x00,
+  0x60, 0x00, 0x6c, 0x00, 0x78, 0x00, 0x89, 0x00, 0x97, 0x00, 0xa3, 0x00,
+  0xb5, 0x00, 0xc3, 0x00, 0xcf, 0x00, 0xd9, 0x00, 0xe7, 0x00, 0xf5, 0x00,
+  0x03, 0x01, 0x11, 0x01, 0x1d, 0x01, 0x2c, 0x01, 0x39, 0x01, 0x47, 0x01,
+  0x54, 0x01, 0x66, 0x01, 0x72, 0x01, 0x80, 0x01, 0x90, 0x01, 0x9c, 0x01,
+  0xb1, 0x01, 0xbf, 0x01, 0xcb, 0x01, 0xd7, 0x01, 0xe8, 0x01, 0xf6, 0x01,
+  0x05, 0x02, 0x15, 0x02, 0x22, 0x02, 0x2e, 0x02, 0x44, 0x02, 0x59, 0x02,
+  0x67, 0x02, 0x76, 0x02, 0x00, 0x00, 0x0f, 0x00, 0x1d, 0x00, 0x2e, 0x00,
+  0x3d, 0x00, 0x48, 0x00, 0x54, 0x00, 0x60, 0x00, 0x6e, 0x00, 0x7c, 0x00,
+  0x88, 0x00, 0x96, 0x00, 0xa1, 0x00, 0xaf, 0x00, 0xc0, 0x00, 0xce, 0x00,
+  0xd9, 0x00, 0xe9, 0x00, 0xf7, 0x00, 0x05, 0x01, 0x13, 0x01, 0x22, 0x01,
+  0x2d, 0x01, 0x3b, 0x01, 0x46, 0x01, 0x54, 0x01, 0x5f, 0x01, 0x69, 0x01,
+  0x77, 0x01, 0x83, 0x01, 0x90, 0x01, 0x9c, 0x01, 0xa7, 0x01, 0xb5, 0x01,
+  0xc3, 0x01, 0xd1, 0x01, 0xdf, 0x01, 0xed, 0x01, 0xf9, 0x01, 0x07, 0x02,
+  0x12, 0x02, 0x1c, 0x02, 0x29, 0x02, 0x38, 0x02, 0x46, 0x02, 0x54, 0x02,
+  0x62, 0x02, 0x70, 0x02, 0x85, 0x02, 0x00, 0x00, 0x10, 0x00, 0x1e, 0x00,
+  0x2a, 0x00, 0x36, 0x00, 0x45, 0x00, 0x5a, 0x00, 0x6d, 0x00, 0x78, 0x00,
+  0x88, 0x00, 0xa0, 0x00, 0xae, 0x00, 0xb9, 0x00, 0xc7, 0x00, 0xd7, 0x00,
+  0xe5, 0x00, 0xef, 0x00, 0xf9, 0x00, 0x07, 0x01, 0x13, 0x01, 0x21, 0x01,
+  0x2d, 0x01, 0x42, 0x01, 0x53, 0x01, 0x64, 0x01, 0x72, 0x01, 0x84, 0x01,
+  0x8d, 0x01, 0xa5, 0x01, 0x00, 0x00, 0x11, 0x00, 0x1d, 0x00, 0x29, 0x00,
+  0x35, 0x00, 0x42, 0x00, 0x51, 0x00, 0x61, 0x00, 0x6e, 0x00, 0x7a, 0x00,
+  0x86, 0x00, 0x94, 0x00, 0xa7, 0x00, 0xb3, 0x00, 0xc1, 0x00, 0xce, 0x00,
+  0xdb, 0x00, 0xe8, 0x00, 0xf4, 0x00, 0x00, 0x01, 0x10, 0x01, 0x1c, 0x01,
+  0x28, 0x01, 0x35, 0x01, 0x46, 0x01, 0x53, 0x01, 0x60, 0x01, 0x6c, 0x01,
+  0x7a, 0x01, 0x87, 0x01, 0x93, 0x01, 0x9f, 0x01, 0xab, 0x01, 0xba, 0x01,
+  0xc6, 0x01, 0xd2, 0x01, 0xde, 0x01, 0xec, 0x01, 0xf8, 0x01, 0x04, 0x02,
+  0x15, 0x02, 0x21, 0x02, 0x00, 0x00, 0x0e, 0x00, 0x1a, 0x00, 0x2c, 0x00,
+  0x3d, 0x00, 0x4a, 0x00, 0x5a, 0x00, 0x6b, 0x00, 0x79, 0x00, 0x86, 0x00,
+  0x92, 0x00, 0xa2, 0x00, 0xb5, 0x00, 0xc6, 0x00, 0xd2, 0x00, 0xe2, 0x00,
+  0xf0, 0x00, 0x01, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x1a, 0x00, 0x29, 0x00,
+  0x36, 0x00, 0x44, 0x00, 0x50, 0x00, 0x63, 0x00, 0x72, 0x00, 0x80, 0x00,
+  0x8e, 0x00, 0x9b, 0x00, 0xb1, 0x00, 0xbd, 0x00, 0xc9, 0x00, 0xd7, 0x00,
+  0xe2, 0x00, 0xee, 0x00, 0xfc, 0x00, 0x08, 0x01, 0x14, 0x01, 0x2d, 0x01,
+  0x3a, 0x01, 0x48, 0x01, 0x57, 0x01, 0x63, 0x01, 0x70, 0x01, 0x7f, 0x01,
+  0x8d, 0x01, 0x98, 0x01, 0xaa, 0x01, 0xb5, 0x01, 0x00, 0x00, 0x11, 0x00,
+  0x21, 0x00, 0x3e, 0x00, 0x4e, 0x00, 0x6b, 0x00, 0x7b, 0x00, 0x87, 0x00,
+  0x99, 0x00, 0xac, 0x00, 0xb7, 0x00, 0xc5, 0x00, 0xd3, 0x00, 0xdf, 0x00,
+  0xf1, 0x00, 0xfd, 0x00, 0x08, 0x01, 0x14, 0x01, 0x20, 0x01, 0x29, 0x01,
+  0x3c, 0x01, 0x47, 0x01, 0x56, 0x01, 0x61, 0x01, 0x71, 0x01, 0x7d, 0x01,
+  0x8d, 0x01, 0x9b, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x18, 0x00, 0x24, 0x00,
+  0x30, 0x00, 0x3d, 0x00, 0x49, 0x00, 0x5a, 0x00, 0x68, 0x00, 0x76, 0x00,
+  0x84, 0x00, 0x90, 0x00, 0x9e, 0x00, 0xac, 0x00, 0xba, 0x00, 0xcb, 0x00,
+  0xd9, 0x00, 0xe7, 0x00, 0xf3, 0x00, 0xff, 0x00, 0x0f, 0x01, 0x1b, 0x01,
+  0x00, 0x00, 0x0b, 0x00, 0x19, 0x00, 0x23, 0x00, 0x31, 0x00, 0x3e, 0x00,
+  0x4c, 0x00, 0x63, 0x00, 0x71, 0x00, 0x83, 0x00, 0x90, 0x00, 0x9d, 0x00,
+  0xa7, 0x00, 0xb6, 0x00, 0xc1, 0x00, 0xcb, 0x00, 0xd7, 0x00, 0xe5, 0x00,
+  0xf2, 0x00, 0xfc, 0x00, 0x09, 0x01, 0x16, 0x01, 0x23, 0x01, 0x2e, 0x01,
+  0x3a, 0x01, 0x44, 0x01, 0x52, 0x01, 0x5c, 0x01, 0x69, 0x01, 0x75, 0x01,
+  0x00, 0x00, 0x0e, 0x00, 0x19, 0x00, 0x27, 0x00, 0x33, 0x00, 0x42, 0x00,
+  0x4e, 0x00, 0x5f, 0x00, 0x6b, 0x00, 0x7a, 0x00, 0x85, 0x00, 0x91, 0x00,
+  0x9b, 0x00, 0xa5, 0x00, 0xb5, 0x00, 0xc8, 0x00, 0xd4, 0x00, 0xe0, 0x00,
+  0xec, 0x00, 0xfa, 0x00, 0x06, 0x01, 0x17, 0x01, 0x22, 0x01, 0x36, 0x01,
+  0x40, 0x01, 0x4b, 0x01, 0x59, 0x01, 0x65, 0x01, 0x77, 0x01, 0x83, 0x01,
+  0x8e, 0x01, 0x9a, 0x01, 0x00, 0x00, 0x10, 0x00, 0x22, 0x00, 0x2e, 0x00,
+  0x39, 0x00, 0x44, 0x00, 0x50, 0x00, 0x5b, 0x00, 0x6e, 0x00, 0x78, 0x00,
+  0x88, 0x00, 0x94, 0x00, 0xa0, 0x00, 0xae, 0x00, 0xb9, 0x00, 0xc3, 0x00,
+  0x00, 0x00, 0x1a, 0x00, 0x26, 0x00, 0x31, 0x00, 0x41, 0x00, 0x4c, 0x00,
+  0x58, 0x00, 0x64, 0x00, 0x70, 0x00, 0x7e, 0x00, 0x8a, 0x00, 0x97, 0x00,
+  0xa3, 0x00, 0xaf, 0x00, 0xbd, 0x00, 0x00, 0x00, 0x19, 0x00, 0x25, 0x00,
+  0x31, 0x00, 0x3c, 0x00, 0x4b, 0x00, 0x57, 0x00, 0x62, 0x00, 0x74, 0x00,
+  0x85, 0x00, 0x95, 0x00, 0x9f, 0x00, 0xb1, 0x00, 0xc1, 0x00, 0xcf, 0x00,
+  0xe1, 0x00, 0xeb, 0x00, 0xf7, 0x00, 0x09, 0x01, 0x1b, 0x01, 0x2a, 0x01,
+  0x36, 0x01, 0x48, 0x01, 0x53, 0x01, 0x62, 0x01, 0x70, 0x01, 0x7a, 0x01,
+  0x85, 0x01, 0x00, 0x00, 0x1a, 0x00, 0x29, 0x00, 0x35, 0x00, 0x43, 0x00,
+  0x4f, 0x00, 0x5d, 0x00, 0x6c, 0x00, 0x7a, 0x00, 0x85, 0x00, 0x94, 0x00,
+  0xa3, 0x00, 0xb1, 0x00, 0xbc, 0x00, 0xca, 0x00, 0xda, 0x00, 0xe9, 0x00,
+  0xf7, 0x00, 0x03, 0x01, 0x10, 0x01, 0x1e, 0x01, 0x2a, 0x01, 0x35, 0x01,
+  0x43, 0x01, 0x51, 0x01, 0x5f, 0x01, 0x6d, 0x01, 0x77, 0x01, 0x85, 0x01,
+  0x98, 0x01, 0xa3, 0x01, 0xae, 0x01, 0xbc, 0x01, 0xc7, 0x01, 0xd2, 0x01,
+  0xe0, 0x01, 0xec, 0x01, 0x00, 0x00, 0x0a, 0x00, 0x14, 0x00, 0x20, 0x00,
+  0x2c, 0x00, 0x37, 0x00, 0x42, 0x00, 0x4e, 0x00, 0x58, 0x00, 0x64, 0x00,
+  0x6f, 0x00, 0x7b, 0x00, 0x87, 0x00, 0x97, 0x00, 0xae, 0x00, 0xb9, 0x00,
+  0xc7, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x16, 0x00, 0x27, 0x00, 0x32, 0x00,
+  0x3d, 0x00, 0x48, 0x00, 0x63, 0x00, 0x6f, 0x00, 0x7b, 0x00, 0x86, 0x00,
+  0x91, 0x00, 0x9d, 0x00, 0xa9, 0x00, 0xb5, 0x00, 0xc0, 0x00, 0xcb, 0x00,
+  0xd6, 0x00, 0xe1, 0x00, 0xec, 0x00, 0xf7, 0x00, 0x08, 0x01, 0x14, 0x01,
+  0x00, 0x00, 0x0e, 0x00, 0x19, 0x00, 0x28, 0x00, 0x36, 0x00, 0x41, 0x00,
+  0x50, 0x00, 0x62, 0x00, 0x73, 0x00, 0x7f, 0x00, 0x8e, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x15, 0x00, 0x23, 0x00, 0x31, 0x00, 0x3f, 0x00, 0x4d, 0x00,
+  0x5a, 0x00, 0x69, 0x00, 0x77, 0x00, 0x85, 0x00, 0x91, 0x00, 0x9c, 0x00,
+  0xaa, 0x00, 0xb8, 0x00, 0xc2, 0x00, 0xd0, 0x00, 0xde, 0x00, 0xec, 0x00,
+  0xfa, 0x00, 0x06, 0x01, 0x12, 0x01, 0x20, 0x01, 0x2b, 0x01, 0x39, 0x01,
+  0x45, 0x01, 0x54, 0x01, 0x62, 0x01, 0x70, 0x01, 0x82, 0x01, 0x90, 0x01,
+  0x9f, 0x01, 0xad, 0x01, 0xbf, 0x01, 0xd1, 0x01, 0xdd, 0x01, 0xeb, 0x01,
+  0xf9, 0x01, 0x05, 0x02, 0x00, 0x00, 0x12, 0x00, 0x1d, 0x00, 0x28, 0x00,
+  0x33, 0x00, 0x3e, 0x00, 0x57, 0x00, 0x00, 0x00, 0x10, 0x00, 0x1c, 0x00,
+  0x2c, 0x00, 0x3c, 0x00, 0x4a, 0x00, 0x56, 0x00, 0x66, 0x00, 0x77, 0x00,
+  0x87, 0x00, 0x95, 0x00, 0xa7, 0x00, 0xb7, 0x00, 0xc8, 0x00, 0xd4, 0x00,
+  0xe2, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0x0a, 0x01, 0x00, 0x00, 0x0e, 0x00,
+  0x1a, 0x00, 0x29, 0x00, 0x37, 0x00, 0x44, 0x00, 0x51, 0x00, 0x5f, 0x00,
+  0x67, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x1b, 0x00, 0x26, 0x00, 0x32, 0x00,
+  0x43, 0x00, 0x4d, 0x00, 0x59, 0x00, 0x65, 0x00, 0x71, 0x00, 0x7d, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x1a, 0x00, 0x25, 0x00, 0x34, 0x00, 0x44, 0x00,
+  0x53, 0x00, 0x62, 0x00, 0x72, 0x00, 0x7b, 0x00, 0x8b, 0x00, 0x95, 0x00,
+  0xa6, 0x00, 0xaf, 0x00, 0xbf, 0x00, 0xc8, 0x00, 0xd9, 0x00, 0xe2, 0x00,
+  0xea, 0x00, 0xf3, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x17, 0x00,
+  0x20, 0x00, 0x2f, 0x00, 0x38, 0x00, 0x47, 0x00, 0x00, 0x00, 0x21, 0x00,
+  0x29, 0x00, 0x31, 0x00, 0x43, 0x00, 0x55, 0x00, 0x67, 0x00, 0x72, 0x00,
+  0x85, 0x00, 0x97, 0x00, 0xa9, 0x00, 0xbb, 0x00, 0xcd, 0x00, 0xdf, 0x00,
+  0xf1, 0x00, 0x03, 0x01, 0x0c, 0x01, 0x1e, 0x01, 0x30, 0x01, 0x42, 0x01,
+  0x4b, 0x01, 0x5d, 0x01, 0x6f, 0x01, 0x7d, 0x01, 0x8f, 0x01, 0xa1, 0x01,
+  0xab, 0x01, 0xb5, 0x01, 0xc3, 0x01, 0xd5, 0x01, 0xe7, 0x01, 0xf0, 0x01,
+  0xfc, 0x01, 0x0e, 0x02, 0x18, 0x02, 0x00, 0x00, 0x2e, 0x00, 0x3a, 0x00,
+  0x45, 0x00, 0x50, 0x00, 0x5a, 0x00, 0x66, 0x00, 0x72, 0x00, 0x7c, 0x00,
+  0x87, 0x00, 0x92, 0x00, 0x9c, 0x00, 0xa5, 0x00, 0xb6, 0x00, 0xc1, 0x00,
+  0xcc, 0x00, 0xd5, 0x00, 0xe3, 0x00, 0xed, 0x00, 0xf7, 0x00, 0x02, 0x01,
+  0x0e, 0x01, 0x19, 0x01, 0x25, 0x01, 0x30, 0x01, 0x3d, 0x01, 0x48, 0x01,
+  0x53, 0x01, 0x5f, 0x01, 0x6a, 0x01, 0x76, 0x01, 0x81, 0x01, 0x92, 0x01,
+  0x9d, 0x01, 0xa8, 0x01, 0xb0, 0x01, 0xba, 0x01, 0xc8, 0x01, 0xd2, 0x01,
+  0x00, 0x00, 0x18, 0x00, 0x24, 0x00, 0x30, 0x00, 0x3b, 0x00, 0x4e, 0x00,
+  0x5a, 0x00, 0x65, 0x00, 0x74, 0x00, 0x85, 0x00, 0x91, 0x00, 0x9d, 0x00,
+  0xa9, 0x00, 0xb5, 0x00, 0xc1, 0x00, 0xd1, 0x00, 0xdc, 0x00, 0xf1, 0x00,
+  0xfd, 0x00, 0x09, 0x01, 0x14, 0x01, 0x20, 0x01, 0x2a, 0x01, 0x34, 0x01,
+  0x40, 0x01, 0x53, 0x01, 0x5f, 0x01, 0x6b, 0x01, 0x7c, 0x01, 0x85, 0x01,
+  0x9a, 0x01, 0xa6, 0x01, 0xb1, 0x01, 0xbc, 0x01, 0xc7, 0x01, 0xd1, 0x01,
+  0xdf, 0x01, 0xeb, 0x01, 0xf6, 0x01, 0x02, 0x02, 0x0e, 0x02, 0x22, 0x02,
+  0x2e, 0x02, 0x3c, 0x02, 0x4b, 0x02, 0x55, 0x02, 0x61, 0x02, 0x6d, 0x02,
+  0x79, 0x02, 0x00, 0x00, 0x0c, 0x00, 0x18, 0x00, 0x23, 0x00, 0x2f, 0x00,
+  0x41, 0x00, 0x4c, 0x00, 0x5b, 0x00, 0x67, 0x00, 0x72, 0x00, 0x7e, 0x00,
+  0x89, 0x00, 0x95, 0x00, 0xa1, 0x00, 0xac, 0x00, 0xb8, 0x00, 0xc3, 0x00,
+  0xce, 0x00, 0xdc, 0x00, 0xe8, 0x00, 0xf4, 0x00, 0x01, 0x01, 0x0a, 0x01,
+  0x16, 0x01, 0x23, 0x01, 0x2f, 0x01, 0x3a, 0x01, 0x43, 0x01, 0x4f, 0x01,
+  0x5b, 0x01, 0x67, 0x01, 0x72, 0x01, 0x7e, 0x01, 0x8a, 0x01, 0x96, 0x01,
+  0xa1, 0x01, 0xad, 0x01, 0xb8, 0x01, 0xc1, 0x01, 0xcd, 0x01, 0xd9, 0x01,
+  0xe6, 0x01, 0x00, 0x00, 0x0f, 0x00, 0x1b, 0x00, 0x24, 0x00, 0x32, 0x00,
+  0x3e, 0x00, 0x4c, 0x00, 0x5e, 0x00, 0x73, 0x00, 0x82, 0x00, 0x8e, 0x00,
+  0xa6, 0x00, 0xb9, 0x00, 0xc7, 0x00, 0xd5, 0x00, 0xe3, 0x00, 0xef, 0x00,
+  0x05, 0x01, 0x16, 0x01, 0x24, 0x01, 0x36, 0x01, 0x42, 0x01, 0x4b, 0x01,
+  0x59, 0x01, 0x64, 0x01, 0x76, 0x01, 0x8c, 0x01, 0x9a, 0x01, 0xa8, 0x01,
+  0xbe, 0x01, 0xd2, 0x01, 0xdc, 0x01, 0xea, 0x01, 0xf8, 0x01, 0x07, 0x02,
+  0x13, 0x02, 0x1f, 0x02, 0x2d, 0x02, 0x3b, 0x02, 0x49, 0x02, 0x57, 0x02,
+  0x62, 0x02, 0x6e, 0x02, 0x78, 0x02, 0x8e, 0x02, 0x00, 0x00, 0x1b, 0x00,
+  0x53, 0x00, 0x5e, 0x00, 0x6c, 0x00, 0x7a, 0x00, 0x88, 0x00, 0x96, 0x00,
+  0xa4, 0x00, 0xb1, 0x00, 0xbf, 0x00, 0xca, 0x00, 0xd9, 0x00, 0xe3, 0x00,
+  0xf1, 0x00, 0xff, 0x00, 0x0d, 0x01, 0x1c, 0x01, 0x2a, 0x01, 0x38, 0x01,
+  0x44, 0x01, 0x55, 0x01, 0x63, 0x01, 0x71, 0x01, 0x86, 0x01, 0x94, 0x01,
+  0xa2, 0x01, 0xb1, 0x01, 0xc5, 0x01, 0xd3, 0x01, 0xdf, 0x01, 0xed, 0x01,
+  0xff, 0x01, 0x0d, 0x02, 0x1e, 0x02, 0x2c, 0x02, 0x3a, 0x02, 0x48, 0x02,
+  0x56, 0x02, 0x64, 0x02, 0x75, 0x02, 0x83, 0x02, 0x95, 0x02, 0xa3, 0x02,
+  0xaf, 0x02, 0xbd, 0x02, 0xcb, 0x02, 0xd9, 0x02, 0xe5, 0x02, 0xf3, 0x02,
+  0x01, 0x03, 0x0f, 0x03, 0x1d, 0x03, 0x27, 0x03, 0x33, 0x03, 0x00, 0x00,
+  0x0f, 0x00, 0x1d, 0x00, 0x29, 0x00, 0x39, 0x00, 0x45, 0x00, 0x51, 0x00,
+  0x66, 0x00, 0x78, 0x00, 0x84, 0x00, 0x94, 0x00, 0xa2, 0x00, 0xac, 0x00,
+  0xb8, 0x00, 0xc4, 0x00, 0xd4, 0x00, 0xe0, 0x00, 0xf1, 0x00, 0xff, 0x00,
+  0x0d, 0x01, 0x17, 0x01, 0x23, 0x01, 0x2f, 0x01, 0x3d, 0x01, 0x52, 0x01,
+  0x5d, 0x01, 0x68, 0x01, 0x7d, 0x01, 0x8b, 0x01, 0x9c, 0x01, 0xaa, 0x01,
+  0xb9, 0x01, 0xc7, 0x01, 0xd5, 0x01, 0xdf, 0x01, 0xed, 0x01, 0xf7, 0x01,
+  0x05, 0x02, 0x13, 0x02, 0x21, 0x02, 0x2e, 0x02, 0x3a, 0x02, 0x46, 0x02,
+  0x54, 0x02, 0x00, 0x00, 0x0e, 0x00, 0x1a, 0x00, 0x2b, 0x00, 0x3c, 0x00,
+  0x48, 0x00, 0x55, 0x00, 0x67, 0x00, 0x76, 0x00, 0x87, 0x00, 0x93, 0x00,
+  0xa2, 0x00, 0xb0, 0x00, 0xbc, 0x00, 0xc7, 0x00, 0xd3, 0x00, 0xe1, 0x00,
+  0xed, 0x00, 0xff, 0x00, 0x0b, 0x01, 0x19, 0x01, 0x25, 0x01, 0x33, 0x01,
+  0x3f, 0x01, 0x4a, 0x01, 0x56, 0x01, 0x64, 0x01, 0x70, 0x01, 0x7b, 0x01,
+  0x8b, 0x01, 0x9d, 0x01, 0xa9, 0x01, 0xb4, 0x01, 0xbf, 0x01, 0x00, 0x00,
+  0x0e, 0x00, 0x1c, 0x00, 0x2a, 0x00, 0x36, 0x00, 0x45, 0x00, 0x53, 0x00,
+  0x62, 0x00, 0x70, 0x00, 0x7c, 0x00, 0x8a, 0x00, 0x96, 0x00, 0xa2, 0x00,
+  0xb0, 0x00, 0xbe, 0x00, 0xcc, 0x00, 0xdc, 0x00, 0xe8, 0x00, 0xf6, 0x00,
+  0x0b, 0x01, 0x17, 0x01, 0x27, 0x01, 0x34, 0x01, 0x42, 0x01, 0x50, 0x01,
+  0x5e, 0x01, 0x6e, 0x01, 0x7c, 0x01, 0x8a, 0x01, 0x98, 0x01, 0xa2, 0x01,
+  0xb0, 0x01, 0xbc, 0x01, 0xcb, 0x01, 0xdb, 0x01, 0xe9, 0x01, 0xfa, 0x01,
+  0x08, 0x02, 0x16, 0x02, 0x24, 0x02, 0x00, 0x00, 0x0b, 0x00, 0x19, 0x00,
+  0x27, 0x00, 0x34, 0x00, 0x42, 0x00, 0x50, 0x00, 0x5e, 0x00, 0x6c, 0x00,
+  0x7a, 0x00, 0x88, 0x00, 0x96, 0x00, 0xa1, 0x00, 0xb0, 0x00, 0xc0, 0x00,
+  0xcc, 0x00, 0xda, 0x00, 0xe9, 0x00, 0xf8, 0x00, 0x02, 0x01, 0x10, 0x01,
+  0x1c, 0x01, 0x2b, 0x01, 0x37, 0x01, 0x45, 0x01, 0x4f, 0x01, 0x5b, 0x01,
+  0x6a, 0x01, 0x75, 0x01, 0x84, 0x01, 0x92, 0x01, 0xa0, 0x01, 0xae, 0x01,
+  0xbc, 0x01, 0xca, 0x01, 0xd5, 0x01, 0xe3, 0x01, 0xed, 0x01, 0xfb, 0x01,
+  0x11, 0x02, 0x24, 0x02, 0x37, 0x02, 0x45, 0x02, 0x53, 0x02, 0x5f, 0x02,
+  0x6d, 0x02, 0x7b, 0x02, 0x86, 0x02, 0x94, 0x02, 0xa2, 0x02, 0xad, 0x02,
+  0xb9, 0x02, 0xc7, 0x02, 0xd5, 0x02, 0xdf, 0x02, 0xe9, 0x02, 0xf7, 0x02,
+  0x0d, 0x03, 0x1b, 0x03, 0x29, 0x03, 0x37, 0x03, 0x41, 0x03, 0x4f, 0x03,
+  0x5d, 0x03, 0x67, 0x03, 0x72, 0x03, 0x00, 0x00, 0x0e, 0x00, 0x1c, 0x00,
+  0x2f, 0x00, 0x42, 0x00, 0x50, 0x00, 0x5b, 0x00, 0x69, 0x00, 0x77, 0x00,
+  0x88, 0x00, 0x93, 0x00, 0x9e, 0x00, 0xac, 0x00, 0xbc, 0x00, 0xc7, 0x00,
+  0xd3, 0x00, 0xe1, 0x00, 0xef, 0x00, 0xfe, 0x00, 0x0d, 0x01, 0x1b, 0x01,
+  0x29, 0x01, 0x37, 0x01, 0x45, 0x01, 0x57, 0x01, 0x69, 0x01, 0x78, 0x01,
+  0x83, 0x01, 0x9b, 0x01, 0xa9, 0x01, 0xb3, 0x01, 0xc1, 0x01, 0xcd, 0x01,
+  0xe0, 0x01, 0xe8, 0x01, 0xf4, 0x01, 0x00, 0x02, 0x0e, 0x02, 0x19, 0x02,
+  0x27, 0x02, 0x2f, 0x02, 0x3c, 0x02, 0x46, 0x02, 0x51, 0x02, 0x00, 0x00,
+  0x0c, 0x00, 0x1c, 0x00, 0x2c, 0x00, 0x39, 0x00, 0x45, 0x00, 0x51, 0x00,
+  0x65, 0x00, 0x71, 0x00, 0x7f, 0x00, 0x8f, 0x00, 0x9b, 0x00, 0xa9, 0x00,
+  0xbc, 0x00, 0xc8, 0x00, 0xd4, 0x00, 0xe0, 0x00, 0xf1, 0x00, 0x03, 0x01,
+  0x10, 0x01, 0x21, 0x01, 0x2d, 0x01, 0x39, 0x01, 0x49, 0x01, 0x57, 0x01,
+  0x65, 0x01, 0x73, 0x01, 0x81, 0x01, 0x8d, 0x01, 0x99, 0x01, 0xa7, 0x01,
+  0xb5, 0x01, 0xc3, 0x01, 0xcf, 0x01, 0x00, 0x00, 0x11, 0x00, 0x1d, 0x00,
+  0x2b, 0x00, 0x37, 0x00, 0x4e, 0x00, 0x5b, 0x00, 0x66, 0x00, 0x71, 0x00,
+  0x7c, 0x00, 0x86, 0x00, 0x94, 0x00, 0xab, 0x00, 0xb5, 0x00, 0xc2, 0x00,
+  0xd6, 0x00, 0xe3, 0x00, 0xf0, 0x00, 0x00, 0x01, 0x0a, 0x01, 0x16, 0x01,
+  0x22, 0x01, 0x2f, 0x01, 0x3d, 0x01, 0x45, 0x01, 0x4f, 0x01, 0x5d, 0x01,
+  0x6b, 0x01, 0x79, 0x01, 0x86, 0x01, 0x92, 0x01, 0x9e, 0x01, 0xab, 0x01,
+  0xb5, 0x01, 0xc2, 0x01, 0xca, 0x01, 0xd7, 0x01, 0xe1, 0x01, 0x00, 0x00,
+  0x0c, 0x00, 0x20, 0x00, 0x2b, 0x00, 0x37, 0x00, 0x45, 0x00, 0x53, 0x00,
+  0x61, 0x00, 0x6f, 0x00, 0x7d, 0x00, 0x89, 0x00, 0x95, 0x00, 0xa8, 0x00,
+  0xb9, 0x00, 0xc7, 0x00, 0xd6, 0x00, 0xe4, 0x00, 0xf2, 0x00, 0x01, 0x01,
+  0x0c, 0x01, 0x1b, 0x01, 0x27, 0x01, 0x32, 0x01, 0x3e, 0x01, 0x4c, 0x01,
+  0x5b, 0x01, 0x67, 0x01, 0x76, 0x01, 0x84, 0x01, 0x90, 0x01, 0x9b, 0x01,
+  0xaa, 0x01, 0xbb, 0x01, 0xc6, 0x01, 0xd2, 0x01, 0xe0, 0x01, 0xee, 0x01,
+  0xfc, 0x01, 0x06, 0x02, 0x14, 0x02, 0x20, 0x02, 0x2c, 0x02, 0x3a, 0x02,
+  0x48, 0x02, 0x56, 0x02, 0x61, 0x02, 0x6f, 0x02, 0x79, 0x02, 0x85, 0x02,
+  0x90, 0x02, 0xa2, 0x02, 0xae, 0x02, 0xbe, 0x02, 0xcd, 0x02, 0xd9, 0x02,
+  0xe5, 0x02, 0xf0, 0x02, 0x00, 0x00, 0x0f, 0x00, 0x25, 0x00, 0x2e, 0x00,
+  0x3a, 0x00, 0x45, 0x00, 0x58, 0x00, 0x68, 0x00, 0x78, 0x00, 0x83, 0x00,
+  0x8f, 0x00, 0x9a, 0x00, 0xa5, 0x00, 0xb1, 0x00, 0xc4, 0x00, 0xce, 0x00,
+  0xd9, 0x00, 0xe7, 0x00, 0xf2, 0x00, 0xfc, 0x00, 0x0c, 0x01, 0x16, 0x01,
+  0x24, 0x01, 0x37, 0x01, 0x41, 0x01, 0x4d, 0x01, 0x57, 0x01, 0x66, 0x01,
+  0x74, 0x01, 0x83, 0x01, 0x8f, 0x01, 0x9a, 0x01, 0xa3, 0x01, 0x00, 0x00,
+  0x0e, 0x00, 0x1f, 0x00, 0x2d, 0x00, 0x41, 0x00, 0x4f, 0x00, 0x5b, 0x00,
+  0x69, 0x00, 0x75, 0x00, 0x85, 0x00, 0x91, 0x00, 0x9d, 0x00, 0xa9, 0x00,
+  0xb9, 0x00, 0xc7, 0x00, 0xd9, 0x00, 0xe3, 0x00, 0xf1, 0x00, 0xff, 0x00,
+  0x0d, 0x01, 0x1d, 0x01, 0x2d, 0x01, 0x39, 0x01, 0x47, 0x01, 0x55, 0x01,
+  0x65, 0x01, 0x71, 0x01, 0x7f, 0x01, 0x8a, 0x01, 0xa0, 0x01, 0xae, 0x01,
+  0xbe, 0x01, 0xcb, 0x01, 0xd7, 0x01, 0xe2, 0x01, 0xee, 0x01, 0x00, 0x00,
+  0x19, 0x00, 0x28, 0x00, 0x37, 0x00, 0x45, 0x00, 0x53, 0x00, 0x5e, 0x00,
+  0x6a, 0x00, 0x7c, 0x00, 0x8a, 0x00, 0x96, 0x00, 0xa1, 0x00, 0xb2, 0x00,
+  0xc0, 0x00, 0xcc, 0x00, 0xde, 0x00, 0xf1, 0x00, 0xfd, 0x00, 0x08, 0x01,
+  0x15, 0x01, 0x27, 0x01, 0x30, 0x01, 0x3a, 0x01, 0x4b, 0x01, 0x58, 0x01,
+  0x6a, 0x01, 0x76, 0x01, 0x82, 0x01, 0x00, 0x00, 0x19, 0x00, 0x25, 0x00,
+  0x31, 0x00, 0x3f, 0x00, 0x52, 0x00, 0x5d, 0x00, 0x74, 0x00, 0x8a, 0x00,
+  0x98, 0x00, 0xa3, 0x00, 0xb5, 0x00, 0xc5, 0x00, 0xd3, 0x00, 0xe1, 0x00,
+  0xeb, 0x00, 0xfd, 0x00, 0x0d, 0x01, 0x18, 0x01, 0x29, 0x01, 0x38, 0x01,
+  0x42, 0x01, 0x4c, 0x01, 0x5e, 0x01, 0x6c, 0x01, 0x7a, 0x01, 0x88, 0x01,
+  0x00, 0x00, 0x0a, 0x00, 0x1a, 0x00, 0x34, 0x00, 0x43, 0x00, 0x51, 0x00,
+  0x65, 0x00, 0x71, 0x00, 0x81, 0x00, 0x91, 0x00, 0x9d, 0x00, 0xab, 0x00,
+  0xb7, 0x00, 0xc1, 0x00, 0xd1, 0x00, 0xe2, 0x00, 0xee, 0x00, 0xfc, 0x00,
+  0x0a, 0x01, 0x1a, 0x01, 0x2e, 0x01, 0x3f, 0x01, 0x00, 0x00, 0x0b, 0x00,
+  0x19, 0x00, 0x29, 0x00, 0x38, 0x00, 0x46, 0x00, 0x51, 0x00, 0x62, 0x00,
+  0x6e, 0x00, 0x7d, 0x00, 0x8d, 0x00, 0x9b, 0x00, 0xab, 0x00, 0xb7, 0x00,
+  0xc9, 0x00, 0xd5, 0x00, 0xe0, 0x00, 0xec, 0x00, 0xf8, 0x00, 0x05, 0x01,
+  0x13, 0x01, 0x21, 0x01, 0x2d, 0x01, 0x00, 0x00, 0x25, 0x00, 0x35, 0x00,
+  0x48, 0x00, 0x59, 0x00, 0x6b, 0x00, 0x7d, 0x00, 0x8b, 0x00, 0x96, 0x00,
+  0xa8, 0x00, 0xba, 0x00, 0xc8, 0x00, 0xde, 0x00, 0xf1, 0x00, 0x05, 0x01,
+  0x16, 0x01, 0x25, 0x01, 0x37, 0x01, 0x45, 0x01, 0x51, 0x01, 0x63, 0x01,
+  0x75, 0x01, 0x88, 0x01, 0x9a, 0x01, 0xac, 0x01, 0xbe, 0x01, 0xcc, 0x01,
+  0xde, 0x01, 0xf0, 0x01, 0xfb, 0x01, 0x0d, 0x02, 0x1f, 0x02, 0x2e, 0x02,
+  0x40, 0x02, 0x52, 0x02, 0x64, 0x02, 0x70, 0x02, 0x82, 0x02, 0x90, 0x02,
+  0x00, 0x00, 0x23, 0x00, 0x2f, 0x00, 0x3b, 0x00, 0x49, 0x00, 0x57, 0x00,
+  0x65, 0x00, 0x71, 0x00, 0x7f, 0x00, 0x8d, 0x00, 0x9b, 0x00, 0xa7, 0x00,
+  0xb3, 0x00, 0xc1, 0x00, 0xcf, 0x00, 0xdd, 0x00, 0xe6, 0x00, 0xf4, 0x00,
+  0x02, 0x01, 0x10, 0x01, 0x1e, 0x01, 0x2c, 0x01, 0x3a, 0x01, 0x48, 0x01,
+  0x00, 0x00, 0x29, 0x00, 0x33, 0x00, 0x43, 0x00, 0x51, 0x00, 0x66, 0x00,
+  0x7b, 0x00, 0x8f, 0x00, 0x9d, 0x00, 0xa7, 0x00, 0xbc, 0x00, 0xc8, 0x00,
+  0xd4, 0x00, 0xe9, 0x00, 0xf7, 0x00, 0x09, 0x01, 0x15, 0x01, 0x25, 0x01,
+  0x34, 0x01, 0x00, 0x00, 0x25, 0x00, 0x3a, 0x00, 0x4c, 0x00, 0x5c, 0x00,
+  0x67, 0x00, 0x75, 0x00, 0x81, 0x00, 0x8c, 0x00, 0x97, 0x00, 0xa2, 0x00,
+  0xb2, 0x00, 0xc4, 0x00, 0xd1, 0x00, 0xdc, 0x00, 0xe8, 0x00, 0xf3, 0x00,
+  0xfe, 0x00, 0x0a, 0x01, 0x17, 0x01, 0x22, 0x01, 0x2f, 0x01, 0x3a, 0x01,
+  0x49, 0x01, 0x57, 0x01, 0x62, 0x01, 0x6d, 0x01, 0x78, 0x01, 0x83, 0x01,
+  0x8e, 0x01, 0x00, 0x00, 0x25, 0x00, 0x3b, 0x00, 0x51, 0x00, 0x67, 0x00,
+  0x75, 0x00, 0x80, 0x00, 0x8c, 0x00, 0x97, 0x00, 0xa3, 0x00, 0xad, 0x00,
+  0xbb, 0x00, 0xc6, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1c, 0x00,
+  0x28, 0x00, 0x36, 0x00, 0x4a, 0x00, 0x58, 0x00, 0x66, 0x00, 0x75, 0x00,
+  0x86, 0x00, 0x94, 0x00, 0xa3, 0x00, 0xb2, 0x00, 0xc0, 0x00, 0xce, 0x00,
+  0xd8, 0x00, 0xe6, 0x00, 0xf4, 0x00, 0x00, 0x01, 0x0f, 0x01, 0x1e, 0x01,
+  0x2c, 0x01, 0x38, 0x01, 0x46, 0x01, 0x52, 0x01, 0x00, 0x00, 0x0c, 0x00,
+  0x18, 0x00, 0x24, 0x00, 0x32, 0x00, 0x42, 0x00, 0x56, 0x00, 0x62, 0x00,
+  0x6c, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x15, 0x00, 0x27, 0x00,
+  0x3b, 0x00, 0x47, 0x00, 0x59, 0x00, 0x6b, 0x00, 0x7b, 0x00, 0x87, 0x00,
+  0x97, 0x00, 0xa6, 0x00, 0xb5, 0x00, 0xc3, 0x00, 0xcf, 0x00, 0xe0, 0x00,
+  0xea, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1a, 0x00, 0x29, 0x00, 0x33, 0x00,
+  0x3f, 0x00, 0x4b, 0x00, 0x56, 0x00, 0x60, 0x00, 0x70, 0x00, 0x7a, 0x00,
+  0x88, 0x00, 0x99, 0x00, 0xa4, 0x00, 0xb3, 0x00, 0xc1, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x1e, 0x00, 0x30, 0x00, 0x3a, 0x00, 0x4d, 0x00, 0x00, 0x00,
+  0x2e, 0x00, 0x3a, 0x00, 0x43, 0x00, 0x61, 0x00, 0x6a, 0x00, 0x75, 0x00,
+  0x7e, 0x00, 0x8a, 0x00, 0x98, 0x00, 0xab, 0x00, 0xb6, 0x00, 0xc2, 0x00,
+  0xd3, 0x00, 0xdf, 0x00, 0xe8, 0x00, 0xf4, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x17, 0x00, 0x20, 0x00, 0x2e, 0x00, 0x3a, 0x00, 0x4a, 0x00, 0x5b, 0x00,
+  0x6b, 0x00, 0x7b, 0x00, 0x8b, 0x00, 0x94, 0x00, 0x9f, 0x00, 0xa8, 0x00,
+  0xb4, 0x00, 0xc2, 0x00, 0xcb, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x28, 0x00,
+  0x33, 0x00, 0x3e, 0x00, 0x4c, 0x00, 0x56, 0x00, 0x60, 0x00, 0x6e, 0x00,
+  0x78, 0x00, 0x82, 0x00, 0x8f, 0x00, 0x9a, 0x00, 0xa4, 0x00, 0xaf, 0x00,
+  0xba, 0x00, 0xc5, 0x00, 0xd1, 0x00, 0xdc, 0x00, 0xed, 0x00, 0x01, 0x01,
+  0x0d, 0x01, 0x18, 0x01, 0x26, 0x01, 0x30, 0x01, 0x3a, 0x01, 0x4d, 0x01,
+  0x58, 0x01, 0x63, 0x01, 0x6f, 0x01, 0x79, 0x01, 0x8a, 0x01, 0x93, 0x01,
+  0x9d, 0x01, 0xa9, 0x01, 0xb3, 0x01, 0x00, 0x00, 0x12, 0x00, 0x24, 0x00,
+  0x34, 0x00, 0x46, 0x00, 0x51, 0x00, 0x5d, 0x00, 0x69, 0x00, 0x75, 0x00,
+  0x81, 0x00, 0x8e, 0x00, 0xa0, 0x00, 0xaa, 0x00, 0xb7, 0x00, 0xc0, 0x00,
+  0xd2, 0x00, 0xe0, 0x00, 0xf2, 0x00, 0xfd, 0x00, 0x09, 0x01, 0x14, 0x01,
+  0x26, 0x01, 0x31, 0x01, 0x43, 0x01, 0x50, 0x01, 0x5d, 0x01, 0x69, 0x01,
+  0x72, 0x01, 0x7f, 0x01, 0x00, 0x00, 0x0b, 0x00, 0x16, 0x00, 0x24, 0x00,
+  0x30, 0x00, 0x44, 0x00, 0x50, 0x00, 0x5e, 0x00, 0x6c, 0x00, 0x7a, 0x00,
+  0x85, 0x00, 0x91, 0x00, 0x9d, 0x00, 0xa9, 0x00, 0xb7, 0x00, 0xc4, 0x00,
+  0xd0, 0x00, 0xde, 0x00, 0xe9, 0x00, 0xf7, 0x00, 0x03, 0x01, 0x0f, 0x01,
+  0x1b, 0x01, 0x2b, 0x01, 0x37, 0x01, 0x43, 0x01, 0x51, 0x01, 0x5d, 0x01,
+  0x66, 0x01, 0x75, 0x01, 0x84, 0x01, 0x93, 0x01, 0x9e, 0x01, 0xa9, 0x01,
+  0x00, 0x00, 0x0c, 0x00, 0x1c, 0x00, 0x28, 0x00, 0x33, 0x00, 0x41, 0x00,
+  0x4f, 0x00, 0x5b, 0x00, 0x6b, 0x00, 0x77, 0x00, 0x85, 0x00, 0x91, 0x00,
+  0x9e, 0x00, 0xa9, 0x00, 0xb9, 0x00, 0xc7, 0x00, 0xd3, 0x00, 0xe4, 0x00,
+  0xf4, 0x00, 0x00, 0x01, 0x09, 0x01, 0x19, 0x01, 0x27, 0x01, 0x33, 0x01,
+  0x43, 0x01, 0x53, 0x01, 0x62, 0x01, 0x6e, 0x01, 0x7e, 0x01, 0x88, 0x01,
+  0x92, 0x01, 0x9d, 0x01, 0xa9, 0x01, 0xb5, 0x01, 0xc5, 0x01, 0xd1, 0x01,
+  0xdb, 0x01, 0xe7, 0x01, 0xfb, 0x01, 0x07, 0x02, 0x13, 0x02, 0x21, 0x02,
+  0x2d, 0x02, 0x39, 0x02, 0x44, 0x02, 0x00, 0x00, 0x0e, 0x00, 0x1d, 0x00,
+  0x2b, 0x00, 0x36, 0x00, 0x44, 0x00, 0x52, 0x00, 0x60, 0x00, 0x6e, 0x00,
+  0x7c, 0x00, 0x88, 0x00, 0x93, 0x00, 0xa1, 0x00, 0xaf, 0x00, 0xbd, 0x00,
+  0xcb, 0x00, 0xd9, 0x00, 0xe7, 0x00, 0xf6, 0x00, 0x07, 0x01, 0x13, 0x01,
+  0x1d, 0x01, 0x28, 0x01, 0x32, 0x01, 0x3d, 0x01, 0x4b, 0x01, 0x59, 0x01,
+  0x64, 0x01, 0x6f, 0x01, 0x7d, 0x01, 0x88, 0x01, 0x96, 0x01, 0xa1, 0x01,
+  0xad, 0x01, 0xbb, 0x01, 0xcb, 0x01, 0xdb, 0x01, 0xe5, 0x01, 0xf6, 0x01,
+  0x01, 0x02, 0x0c, 0x02, 0x1a, 0x02, 0x28, 0x02, 0x36, 0x02, 0x44, 0x02,
+  0x52, 0x02, 0x68, 0x02, 0x72, 0x02, 0x81, 0x02, 0x8d, 0x02, 0x98, 0x02,
+  0xa6, 0x02, 0xb4, 0x02, 0xc2, 0x02, 0xd1, 0x02, 0xdb, 0x02, 0xe6, 0x02,
+  0xf4, 0x02, 0x00, 0x03, 0x0e, 0x03, 0x18, 0x03, 0x23, 0x03, 0x30, 0x03,
+  0x3c, 0x03, 0x46, 0x03, 0x56, 0x03, 0x64, 0x03, 0x6e, 0x03, 0x79, 0x03,
+  0x83, 0x03, 0x8d, 0x03, 0x99, 0x03, 0xaa, 0x03, 0xb5, 0x03, 0xbf, 0x03,
+  0x00, 0x00, 0x0c, 0x00, 0x1a, 0x00, 0x26, 0x00, 0x30, 0x00, 0x3b, 0x00,
+  0x4d, 0x00, 0x58, 0x00, 0x61, 0x00, 0x6b, 0x00, 0x7e, 0x00, 0x89, 0x00,
+  0x93, 0x00, 0x9f, 0x00, 0xb5, 0x00, 0xc0, 0x00, 0xca, 0x00, 0xd5, 0x00,
+  0xe8, 0x00, 0xf2, 0x00, 0xff, 0x00, 0x0d, 0x01, 0x24, 0x01, 0x30, 0x01,
+  0x3f, 0x01, 0x4c, 0x01, 0x57, 0x01, 0x6a, 0x01, 0x76, 0x01, 0x85, 0x01,
+  0x00, 0x00, 0x10, 0x00, 0x27, 0x00, 0x33, 0x00, 0x43, 0x00, 0x53, 0x00,
+  0x64, 0x00, 0x70, 0x00, 0x7c, 0x00, 0x8a, 0x00, 0x96, 0x00, 0xa6, 0x00,
+  0xb1, 0x00, 0xbf, 0x00, 0xca, 0x00, 0xd6, 0x00, 0xe4, 0x00, 0xf2, 0x00,
+  0xff, 0x00, 0x0d, 0x01, 0x19, 0x01, 0x26, 0x01, 0x3a, 0x01, 0x4c, 0x01,
+  0x5e, 0x01, 0x6c, 0x01, 0x78, 0x01, 0x88, 0x01, 0x95, 0x01, 0xa1, 0x01,
+  0xaf, 0x01, 0xbd, 0x01, 0xcb, 0x01, 0xdc, 0x01, 0xe8, 0x01, 0xf3, 0x01,
+  0xff, 0x01, 0x00, 0x00, 0x2c, 0x00, 0x3d, 0x00, 0x4b, 0x00, 0x59, 0x00,
+  0x65, 0x00, 0x71, 0x00, 0x7c, 0x00, 0x89, 0x00, 0x9a, 0x00, 0xa8, 0x00,
+  0xb4, 0x00, 0xc3, 0x00, 0xcf, 0x00, 0xe7, 0x00, 0xf3, 0x00, 0x0a, 0x01,
+  0x19, 0x01, 0x23, 0x01, 0x2f, 0x01, 0x48, 0x01, 0x57, 0x01, 0x67, 0x01,
+  0x73, 0x01, 0x81, 0x01, 0x8f, 0x01, 0x9b, 0x01, 0xa7, 0x01, 0xb5, 0x01,
+  0xc2, 0x01, 0xd0, 0x01, 0xe0, 0x01, 0xef, 0x01, 0xfb, 0x01, 0x0a, 0x02,
+  0x19, 0x02, 0x23, 0x02, 0x32, 0x02, 0x3c, 0x02, 0x4a, 0x02, 0x54, 0x02,
+  0x60, 0x02, 0x6c, 0x02, 0x7b, 0x02, 0x00, 0x00, 0x2a, 0x00, 0x37, 0x00,
+  0x43, 0x00, 0x52, 0x00, 0x60, 0x00, 0x6e, 0x00, 0x7c, 0x00, 0x8a, 0x00,
+  0x99, 0x00, 0xa8, 0x00, 0xb6, 0x00, 0xc2, 0x00, 0xd0, 0x00, 0xde, 0x00,
+  0xed, 0x00, 0xfb, 0x00, 0x09, 0x01, 0x1a, 0x01, 0x28, 0x01, 0x37, 0x01,
+  0x45, 0x01, 0x58, 0x01, 0x64, 0x01, 0x72, 0x01, 0x80, 0x01, 0x9a, 0x01,
+  0xa6, 0x01, 0xb3, 0x01, 0xbd, 0x01, 0xcb, 0x01, 0xe1, 0x01, 0xf3, 0x01,
+  0x08, 0x02, 0x14, 0x02, 0x23, 0x02, 0x32, 0x02, 0x40, 0x02, 0x4e, 0x02,
+  0x61, 0x02, 0x6f, 0x02, 0x7d, 0x02, 0x89, 0x02, 0x95, 0x02, 0xa9, 0x02,
+  0xb7, 0x02, 0xc9, 0x02, 0xd7, 0x02, 0xe9, 0x02, 0xfc, 0x02, 0x0a, 0x03,
+  0x1a, 0x03, 0x29, 0x03, 0x35, 0x03, 0x44, 0x03, 0x52, 0x03, 0x60, 0x03,
+  0x6c, 0x03, 0x7c, 0x03, 0x88, 0x03, 0x94, 0x03, 0x9f, 0x03, 0xae, 0x03,
+  0xbe, 0x03, 0xcd, 0x03, 0x00, 0x00, 0x0f, 0x00, 0x1b, 0x00, 0x29, 0x00,
+  0x38, 0x00, 0x44, 0x00, 0x52, 0x00, 0x60, 0x00, 0x71, 0x00, 0x7d, 0x00,
+  0x8e, 0x00, 0x9a, 0x00, 0xa9, 0x00, 0xc0, 0x00, 0xce, 0x00, 0xdc, 0x00,
+  0xea, 0x00, 0xf8, 0x00, 0x06, 0x01, 0x14, 0x01, 0x22, 0x01, 0x30, 0x01,
+  0x40, 0x01, 0x4f, 0x01, 0x66, 0x01, 0x74, 0x01, 0x83, 0x01, 0x8f, 0x01,
+  0x9d, 0x01, 0xab, 0x01, 0xb9, 0x01, 0xc8, 0x01, 0xd6, 0x01, 0xe6, 0x01,
+  0xf2, 0x01, 0x03, 0x02, 0x10, 0x02, 0x21, 0x02, 0x2f, 0x02, 0x00, 0x00,
+  0x0e, 0x00, 0x1c, 0x00, 0x28, 0x00, 0x39, 0x00, 0x49, 0x00, 0x55, 0x00,
+  0x61, 0x00, 0x6d, 0x00, 0x79, 0x00, 0x87, 0x00, 0x93, 0x00, 0xa1, 0x00,
+  0xb0, 0x00, 0xbf, 0x00, 0xce, 0x00, 0xe5, 0x00, 0xf3, 0x00, 0xff, 0x00,
+  0x0f, 0x01, 0x1b, 0x01, 0x29, 0x01, 0x35, 0x01, 0x43, 0x01, 0x53, 0x01,
+  0x61, 0x01, 0x73, 0x01, 0x83, 0x01, 0x9b, 0x01, 0xaa, 0x01, 0xb6, 0x01,
+  0xc6, 0x01, 0xd2, 0x01, 0xe3, 0x01, 0xf3, 0x01, 0x00, 0x00, 0x0b, 0x00,
+  0x17, 0x00, 0x26, 0x00, 0x35, 0x00, 0x45, 0x00, 0x53, 0x00, 0x66, 0x00,
+  0x74, 0x00, 0x82, 0x00, 0x90, 0x00, 0x9e, 0x00, 0xad, 0x00, 0xbb, 0x00,
+  0xc9, 0x00, 0xd7, 0x00, 0xe5, 0x00, 0xf4, 0x00, 0x02, 0x01, 0x10, 0x01,
+  0x1b, 0x01, 0x29, 0x01, 0x39, 0x01, 0x47, 0x01, 0x55, 0x01, 0x62, 0x01,
+  0x70, 0x01, 0x80, 0x01, 0x8e, 0x01, 0x9e, 0x01, 0xae, 0x01, 0xba, 0x01,
+  0xc8, 0x01, 0xd6, 0x01, 0xe4, 0x01, 0xf4, 0x01, 0x02, 0x02, 0x10, 0x02,
+  0x20, 0x02, 0x2e, 0x02, 0x3e, 0x02, 0x4d, 0x02, 0x5d, 0x02, 0x6b, 0x02,
+  0x79, 0x02, 0x89, 0x02, 0x92, 0x02, 0xa3, 0x02, 0xaf, 0x02, 0xb7, 0x02,
+  0xc5, 0x02, 0xd1, 0x02, 0xdf, 0x02, 0xed, 0x02, 0xfb, 0x02, 0x0d, 0x03,
+  0x00, 0x00, 0x0c, 0x00, 0x18, 0x00, 0x23, 0x00, 0x2f, 0x00, 0x3b, 0x00,
+  0x4a, 0x00, 0x56, 0x00, 0x64, 0x00, 0x70, 0x00, 0x82, 0x00, 0x96, 0x00,
+  0xa7, 0x00, 0xc1, 0x00, 0xcf, 0x00, 0xdd, 0x00, 0xe7, 0x00, 0xf3, 0x00,
+  0xfe, 0x00, 0x08, 0x01, 0x14, 0x01, 0x23, 0x01, 0x32, 0x01, 0x46, 0x01,
+  0x54, 0x01, 0x62, 0x01, 0x6e, 0x01, 0x7c, 0x01, 0x8a, 0x01, 0x96, 0x01,
+  0xa4, 0x01, 0xb6, 0x01, 0xc4, 0x01, 0xd2, 0x01, 0xe1, 0x01, 0xeb, 0x01,
+  0xf9, 0x01, 0x08, 0x02, 0x1c, 0x02, 0x2a, 0x02, 0x38, 0x02, 0x48, 0x02,
+  0x57, 0x02, 0x62, 0x02, 0x71, 0x02, 0x82, 0x02, 0x90, 0x02, 0x00, 0x00,
+  0x0d, 0x00, 0x19, 0x00, 0x25, 0x00, 0x35, 0x00, 0x48, 0x00, 0x55, 0x00,
+  0x62, 0x00, 0x72, 0x00, 0x82, 0x00, 0x8f, 0x00, 0xa0, 0x00, 0xb1, 0x00,
+  0xc2, 0x00, 0xd0, 0x00, 0xdf, 0x00, 0xf0, 0x00, 0x01, 0x01, 0x0c, 0x01,
+  0x1c, 0x01, 0x2a, 0x01, 0x3a, 0x01, 0x48, 0x01, 0x58, 0x01, 0x65, 0x01,
+  0x75, 0x01, 0x82, 0x01, 0x92, 0x01, 0xa2, 0x01, 0xb0, 0x01, 0xc1, 0x01,
+  0xce, 0x01, 0xe0, 0x01, 0xee, 0x01, 0xfa, 0x01, 0x07, 0x02, 0x15, 0x02,
+  0x20, 0x02, 0x2f, 0x02, 0x3b, 0x02, 0x4b, 0x02, 0x58, 0x02, 0x61, 0x02,
+  0x6d, 0x02, 0x7f, 0x02, 0x88, 0x02, 0x98, 0x02, 0x00, 0x00, 0x11, 0x00,
+  0x1d, 0x00, 0x2b, 0x00, 0x37, 0x00, 0x43, 0x00, 0x59, 0x00, 0x65, 0x00,
+  0x73, 0x00, 0x81, 0x00, 0x8d, 0x00, 0xa3, 0x00, 0xb0, 0x00, 0xbc, 0x00,
+  0xc8, 0x00, 0xd4, 0x00, 0xe2, 0x00, 0xf7, 0x00, 0x05, 0x01, 0x1a, 0x01,
+  0x26, 0x01, 0x32, 0x01, 0x3e, 0x01, 0x4a, 0x01, 0x56, 0x01, 0x63, 0x01,
+  0x71, 0x01, 0x7d, 0x01, 0x8e, 0x01, 0x9b, 0x01, 0xb1, 0x01, 0xbd, 0x01,
+  0xca, 0x01, 0xd8, 0x01, 0xe6, 0x01, 0xf2, 0x01, 0x03, 0x02, 0x0f, 0x02,
+  0x1b, 0x02, 0x27, 0x02, 0x3b, 0x02, 0x49, 0x02, 0x52, 0x02, 0x5e, 0x02,
+  0x70, 0x02, 0x7e, 0x02, 0x8c, 0x02, 0xa2, 0x02, 0xb8, 0x02, 0xc4, 0x02,
+  0xd0, 0x02, 0xde, 0x02, 0xec, 0x02, 0xfa, 0x02, 0x08, 0x03, 0x00, 0x00,
+  0x0e, 0x00, 0x1c, 0x00, 0x2c, 0x00, 0x3a, 0x00, 0x48, 0x00, 0x58, 0x00,
+  0x69, 0x00, 0x80, 0x00, 0x8c, 0x00, 0x9b, 0x00, 0xab, 0x00, 0xb7, 0x00,
+  0xc0, 0x00, 0xd0, 0x00, 0xda, 0x00, 0xed, 0x00, 0xfd, 0x00, 0x0e, 0x01,
+  0x1e, 0x01, 0x30, 0x01, 0x3d, 0x01, 0x49, 0x01, 0x59, 0x01, 0x68, 0x01,
+  0x78, 0x01, 0x00, 0x00, 0x0f, 0x00, 0x1d, 0x00, 0x27, 0x00, 0x33, 0x00,
+  0x41, 0x00, 0x4b, 0x00, 0x59, 0x00, 0x69, 0x00, 0x77, 0x00, 0x85, 0x00,
+  0x93, 0x00, 0xa1, 0x00, 0xaf, 0x00, 0xbe, 0x00, 0xc9, 0x00, 0xd7, 0x00,
+  0xe3, 0x00, 0xfa, 0x00, 0x05, 0x01, 0x13, 0x01, 0x1e, 0x01, 0x29, 0x01,
+  0x37, 0x01, 0x45, 0x01, 0x53, 0x01, 0x62, 0x01, 0x6e, 0x01, 0x84, 0x01,
+  0x92, 0x01, 0x9c, 0x01, 0xaa, 0x01, 0xb8, 0x01, 0xc4, 0x01, 0xd0, 0x01,
+  0xda, 0x01, 0xe8, 0x01, 0xf8, 0x01, 0x04, 0x02, 0x12, 0x02, 0x20, 0x02,
+  0x30, 0x02, 0x3a, 0x02, 0x48, 0x02, 0x56, 0x02, 0x64, 0x02, 0x6f, 0x02,
+  0x79, 0x02, 0x87, 0x02, 0x95, 0x02, 0xa7, 0x02, 0xb6, 0x02, 0x00, 0x00,
+  0x0c, 0x00, 0x1e, 0x00, 0x29, 0x00, 0x35, 0x00, 0x47, 0x00, 0x54, 0x00,
+  0x67, 0x00, 0x72, 0x00, 0x7c, 0x00, 0x89, 0x00, 0x9b, 0x00, 0xac, 0x00,
+  0xbe, 0x00, 0xd0, 0x00, 0xe1, 0x00, 0xf3, 0x00, 0x05, 0x01, 0x12, 0x01,
+  0x24, 0x01, 0x32, 0x01, 0x3e, 0x01, 0x50, 0x01, 0x62, 0x01, 0x6e, 0x01,
+  0x80, 0x01, 0x92, 0x01, 0xa4, 0x01, 0xb6, 0x01, 0xc8, 0x01, 0xd5, 0x01,
+  0xe6, 0x01, 0xf2, 0x01, 0x00, 0x02, 0x09, 0x02, 0x14, 0x02, 0x1e, 0x02,
+  0x30, 0x02, 0x42, 0x02, 0x54, 0x02, 0x66, 0x02, 0x70, 0x02, 0x7a, 0x02,
+  0x84, 0x02, 0x00, 0x00, 0x0c, 0x00, 0x1c, 0x00, 0x28, 0x00, 0x33, 0x00,
+  0x43, 0x00, 0x57, 0x00, 0x65, 0x00, 0x72, 0x00, 0x7f, 0x00, 0x90, 0x00,
+  0x9b, 0x00, 0xa6, 0x00, 0xb1, 0x00, 0xc0, 0x00, 0xcb, 0x00, 0xe6, 0x00,
+  0xf4, 0x00, 0x02, 0x01, 0x10, 0x01, 0x1e, 0x01, 0x29, 0x01, 0x35, 0x01,
+  0x43, 0x01, 0x50, 0x01, 0x5c, 0x01, 0x6a, 0x01, 0x76, 0x01, 0x81, 0x01,
+  0x92, 0x01, 0xa6, 0x01, 0xb4, 0x01, 0xc7, 0x01, 0xd5, 0x01, 0xe3, 0x01,
+  0xf1, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x18, 0x00, 0x24, 0x00, 0x34, 0x00,
+  0x47, 0x00, 0x55, 0x00, 0x6a, 0x00, 0x76, 0x00, 0x80, 0x00, 0x8c, 0x00,
+  0xa0, 0x00, 0xae, 0x00, 0xb7, 0x00, 0xcc, 0x00, 0xd8, 0x00, 0xe3, 0x00,
+  0xf3, 0x00, 0x08, 0x01, 0x17, 0x01, 0x23, 0x01, 0x35, 0x01, 0x41, 0x01,
+  0x4d, 0x01, 0x5d, 0x01, 0x71, 0x01, 0x80, 0x01, 0x89, 0x01, 0x97, 0x01,
+  0xa3, 0x01, 0xb1, 0x01, 0xbf, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x1a, 0x00,
+  0x28, 0x00, 0x3f, 0x00, 0x4a, 0x00, 0x58, 0x00, 0x66, 0x00, 0x74, 0x00,
+  0x84, 0x00, 0x92, 0x00, 0xa0, 0x00, 0xac, 0x00, 0xb5, 0x00, 0xc1, 0x00,
+  0xd1, 0x00, 0xdf, 0x00, 0xeb, 0x00, 0xf7, 0x00, 0x05, 0x01, 0x13, 0x01,
+  0x21, 0x01, 0x2d, 0x01, 0x3b, 0x01, 0x49, 0x01, 0x57, 0x01, 0x67, 0x01,
+  0x75, 0x01, 0x83, 0x01, 0x96, 0x01, 0xa2, 0x01, 0xb0, 0x01, 0xbb, 0x01,
+  0xc7, 0x01, 0xd7, 0x01, 0xe2, 0x01, 0xf0, 0x01, 0xfe, 0x01, 0x00, 0x00,
+  0x13, 0x00, 0x26, 0x00, 0x32, 0x00, 0x3d, 0x00, 0x53, 0x00, 0x64, 0x00,
+  0x6e, 0x00, 0x81, 0x00, 0x8a, 0x00, 0x9d, 0x00, 0xa9, 0x00, 0xb5, 0x00,
+  0xbf, 0x00, 0xd1, 0x00, 0xe3, 0x00, 0xfa, 0x00, 0x0e, 0x01, 0x1c, 0x01,
+  0x26, 0x01, 0x35, 0x01, 0x43, 0x01, 0x51, 0x01, 0x59, 0x01, 0x00, 0x00,
+  0x0e, 0x00, 0x1a, 0x00, 0x2c, 0x00, 0x3b, 0x00, 0x47, 0x00, 0x55, 0x00,
+  0x66, 0x00, 0x74, 0x00, 0x84, 0x00, 0x90, 0x00, 0x9c, 0x00, 0xa8, 0x00,
+  0xb4, 0x00, 0xc4, 0x00, 0xcf, 0x00, 0xe1, 0x00, 0xf3, 0x00, 0x00, 0x01,
+  0x0c, 0x01, 0x18, 0x01, 0x25, 0x01, 0x37, 0x01, 0x42, 0x01, 0x4e, 0x01,
+  0x62, 0x01, 0x00, 0x00, 0x0f, 0x00, 0x20, 0x00, 0x2c, 0x00, 0x3e, 0x00,
+  0x4c, 0x00, 0x5d, 0x00, 0x67, 0x00, 0x7c, 0x00, 0x88, 0x00, 0xa5, 0x00,
+  0xb5, 0x00, 0xc9, 0x00, 0xd7, 0x00, 0xeb, 0x00, 0xf7, 0x00, 0x05, 0x01,
+  0x00, 0x00, 0x0b, 0x00, 0x19, 0x00, 0x27, 0x00, 0x35, 0x00, 0x43, 0x00,
+  0x52, 0x00, 0x60, 0x00, 0x74, 0x00, 0x88, 0x00, 0x96, 0x00, 0xa4, 0x00,
+  0xb3, 0x00, 0xc1, 0x00, 0xcf, 0x00, 0xde, 0x00, 0xec, 0x00, 0xfa, 0x00,
+  0x00, 0x00, 0x20, 0x00, 0x2a, 0x00, 0x38, 0x00, 0x55, 0x00, 0x66, 0x00,
+  0x80, 0x00, 0x8e, 0x00, 0x99, 0x00, 0xa3, 0x00, 0xb1, 0x00, 0xbc, 0x00,
+  0xca, 0x00, 0xd6, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x2b, 0x00, 0x39, 0x00,
+  0x49, 0x00, 0x5d, 0x00, 0x69, 0x00, 0x7a, 0x00, 0x88, 0x00, 0x99, 0x00,
+  0xaa, 0x00, 0xb8, 0x00, 0xcf, 0x00, 0xe0, 0x00, 0xf1, 0x00, 0x03, 0x01,
+  0x0f, 0x01, 0x00, 0x00, 0x0e, 0x00, 0x25, 0x00, 0x34, 0x00, 0x51, 0x00,
+  0x63, 0x00, 0x71, 0x00, 0x7b, 0x00, 0x89, 0x00, 0x00, 0x00, 0x29, 0x00,
+  0x3a, 0x00, 0x48, 0x00, 0x52, 0x00, 0x61, 0x00, 0x6c, 0x00, 0x84, 0x00,
+  0x92, 0x00, 0x9e, 0x00, 0xaa, 0x00, 0xbe, 0x00, 0xcc, 0x00, 0xd7, 0x00,
+  0xe6, 0x00, 0xf4, 0x00, 0x00, 0x01, 0x0e, 0x01, 0x1c, 0x01, 0x28, 0x01,
+  0x36, 0x01, 0x00, 0x00, 0x0e, 0x00, 0x21, 0x00, 0x2e, 0x00, 0x3c, 0x00,
+  0x49, 0x00, 0x55, 0x00, 0x63, 0x00, 0x6f, 0x00, 0x7b, 0x00, 0x87, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x1a, 0x00, 0x28, 0x00, 0x38, 0x00, 0x43, 0x00,
+  0x53, 0x00, 0x64, 0x00, 0x79, 0x00, 0x84, 0x00, 0x90, 0x00, 0xa0, 0x00,
+  0xb0, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x18, 0x00, 0x28, 0x00,
+  0x33, 0x00, 0x3e, 0x00, 0x49, 0x00, 0x54, 0x00, 0x62, 0x00, 0x73, 0x00,
+  0x7e, 0x00, 0x8e, 0x00, 0x97, 0x00, 0x00, 0x00, 0x11, 0x00, 0x23, 0x00,
+  0x2e, 0x00, 0x3a, 0x00, 0x4c, 0x00, 0x56, 0x00, 0x62, 0x00, 0x6e, 0x00,
+  0x79, 0x00, 0x83, 0x00, 0x8d, 0x00, 0x9e, 0x00, 0xa9, 0x00, 0xb3, 0x00,
+  0xbe, 0x00, 0xc9, 0x00, 0xdb, 0x00, 0xe5, 0x00, 0xf1, 0x00, 0xfc, 0x00,
+  0x07, 0x01, 0x13, 0x01, 0x23, 0x01, 0x00, 0x00, 0x2e, 0x00, 0x40, 0x00,
+  0x4b, 0x00, 0x55, 0x00, 0x60, 0x00, 0x72, 0x00, 0x7e, 0x00, 0x8a, 0x00,
+  0x94, 0x00, 0xa7, 0x00, 0xb4, 0x00, 0xc6, 0x00, 0xd4, 0x00, 0xe2, 0x00,
+  0xed, 0x00, 0xf8, 0x00, 0x05, 0x01, 0x12, 0x01, 0x1f, 0x01, 0x2b, 0x01,
+  0x35, 0x01, 0x42, 0x01, 0x50, 0x01, 0x5b, 0x01, 0x65, 0x01, 0x6e, 0x01,
+  0x00, 0x00, 0x0f, 0x00, 0x1c, 0x00, 0x28, 0x00, 0x36, 0x00, 0x42, 0x00,
+  0x50, 0x00, 0x5d, 0x00, 0x69, 0x00, 0x75, 0x00, 0x82, 0x00, 0x8d, 0x00,
+  0x9a, 0x00, 0xa5, 0x00, 0xb3, 0x00, 0xbe, 0x00, 0xca, 0x00, 0xd8, 0x00,
+  0xe3, 0x00, 0xef, 0x00, 0xfa, 0x00, 0x07, 0x01, 0x13, 0x01, 0x27, 0x01,
+  0x33, 0x01, 0x42, 0x01, 0x5c, 0x01, 0x67, 0x01, 0x73, 0x01, 0x86, 0x01,
+  0x92, 0x01, 0x9e, 0x01, 0xac, 0x01, 0xb8, 0x01, 0xcc, 0x01, 0xd7, 0x01,
+  0xe4, 0x01, 0xf1, 0x01, 0xfd, 0x01, 0x00, 0x00, 0x0a, 0x00, 0x1b, 0x00,
+  0x2b, 0x00, 0x36, 0x00, 0x42, 0x00, 0x58, 0x00, 0x62, 0x00, 0x72, 0x00,
+  0x82, 0x00, 0x8e, 0x00, 0x97, 0x00, 0xa1, 0x00, 0xaf, 0x00, 0xba, 0x00,
+  0xca, 0x00, 0xd5, 0x00, 0xdf, 0x00, 0xea, 0x00, 0xf5, 0x00, 0x00, 0x01,
+  0x0f, 0x01, 0x1c, 0x01, 0x26, 0x01, 0x36, 0x01, 0x41, 0x01, 0x52, 0x01,
+  0x64, 0x01, 0x75, 0x01, 0x84, 0x01, 0x90, 0x01, 0x9e, 0x01, 0xaa, 0x01,
+  0xb4, 0x01, 0xc0, 0x01, 0xd0, 0x01, 0xdc, 0x01, 0xe8, 0x01, 0xf6, 0x01,
+  0x02, 0x02, 0x0e, 0x02, 0x1e, 0x02, 0x28, 0x02, 0x33, 0x02, 0x00, 0x00,
+  0x2e, 0x00, 0x3c, 0x00, 0x4b, 0x00, 0x57, 0x00, 0x65, 0x00, 0x73, 0x00,
+  0x84, 0x00, 0x92, 0x00, 0xa0, 0x00, 0xae, 0x00, 0xbc, 0x00, 0xcc, 0x00,
+  0xd7, 0x00, 0xe3, 0x00, 0xee, 0x00, 0xfc, 0x00, 0x0a, 0x01, 0x17, 0x01,
+  0x22, 0x01, 0x30, 0x01, 0x40, 0x01, 0x4e, 0x01, 0x5c, 0x01, 0x6a, 0x01,
+  0x76, 0x01, 0x84, 0x01, 0x8f, 0x01, 0x9c, 0x01, 0xaa, 0x01, 0xb7, 0x01,
+  0xc5, 0x01, 0xd2, 0x01, 0xe0, 0x01, 0xee, 0x01, 0xfc, 0x01, 0x0a, 0x02,
+  0x16, 0x02, 0x24, 0x02, 0x32, 0x02, 0x40, 0x02, 0x4c, 0x02, 0x5a, 0x02,
+  0x68, 0x02, 0x72, 0x02, 0x7f, 0x02, 0x8c, 0x02, 0x9b, 0x02, 0xa7, 0x02,
+  0xb3, 0x02, 0xc1, 0x02, 0xcb, 0x02, 0xd9, 0x02, 0xe8, 0x02, 0xf2, 0x02,
+  0x00, 0x03, 0x0c, 0x03, 0x16, 0x03, 0x25, 0x03, 0x33, 0x03, 0x41, 0x03,
+  0x4a, 0x03, 0x56, 0x03, 0x00, 0x00, 0x0a, 0x00, 0x18, 0x00, 0x26, 0x00,
+  0x32, 0x00, 0x3e, 0x00, 0x49, 0x00, 0x5b, 0x00, 0x6a, 0x00, 0x74, 0x00,
+  0x85, 0x00, 0x91, 0x00, 0x9d, 0x00, 0xab, 0x00, 0xb7, 0x00, 0xc3, 0x00,
+  0xcf, 0x00, 0xe1, 0x00, 0xf4, 0x00, 0x02, 0x01, 0x0e, 0x01, 0x20, 0x01,
+  0x2c, 0x01, 0x3d, 0x01, 0x4f, 0x01, 0x5a, 0x01, 0x67, 0x01, 0x75, 0x01,
+  0x80, 0x01, 0x8a, 0x01, 0x9c, 0x01, 0xa6, 0x01, 0xb8, 0x01, 0xc6, 0x01,
+  0xd2, 0x01, 0xe0, 0x01, 0xec, 0x01, 0xf8, 0x01, 0x05, 0x02, 0x10, 0x02,
+  0x1b, 0x02, 0x00, 0x00, 0x19, 0x00, 0x2a, 0x00, 0x36, 0x00, 0x47, 0x00,
+  0x53, 0x00, 0x5f, 0x00, 0x6d, 0x00, 0x7d, 0x00, 0x8e, 0x00, 0x99, 0x00,
+  0xa4, 0x00, 0xb1, 0x00, 0xbd, 0x00, 0xc9, 0x00, 0xd4, 0x00, 0xe2, 0x00,
+  0xf2, 0x00, 0x03, 0x01, 0x0f, 0x01, 0x1b, 0x01, 0x26, 0x01, 0x37, 0x01,
+  0x43, 0x01, 0x4f, 0x01, 0x5a, 0x01, 0x66, 0x01, 0x72, 0x01, 0x7e, 0x01,
+  0x8e, 0x01, 0x9a, 0x01, 0xaa, 0x01, 0xb6, 0x01, 0xc2, 0x01, 0xd0, 0x01,
+  0xdb, 0x01, 0xe7, 0x01, 0xf8, 0x01, 0x04, 0x02, 0x10, 0x02, 0x1c, 0x02,
+  0x2c, 0x02, 0x3a, 0x02, 0x47, 0x02, 0x53, 0x02, 0x5f, 0x02, 0x6b, 0x02,
+  0x79, 0x02, 0x85, 0x02, 0x91, 0x02, 0xa1, 0x02, 0xaf, 0x02, 0xbb, 0x02,
+  0xcc, 0x02, 0xd8, 0x02, 0xe4, 0x02, 0xf0, 0x02, 0xfc, 0x02, 0x0c, 0x03,
+  0x00, 0x00, 0x0c, 0x00, 0x1a, 0x00, 0x28, 0x00, 0x36, 0x00, 0x4a, 0x00,
+  0x58, 0x00, 0x64, 0x00, 0x70, 0x00, 0x7c, 0x00, 0x86, 0x00, 0x93, 0x00,
+  0x9f, 0x00, 0xab, 0x00, 0xbd, 0x00, 0xc8, 0x00, 0xd6, 0x00, 0xe1, 0x00,
+  0xeb, 0x00, 0xf7, 0x00, 0x03, 0x01, 0x17, 0x01, 0x25, 0x01, 0x31, 0x01,
+  0x3f, 0x01, 0x49, 0x01, 0x5d, 0x01, 0x69, 0x01, 0x75, 0x01, 0x81, 0x01,
+  0x8c, 0x01, 0x98, 0x01, 0xa7, 0x01, 0xb1, 0x01, 0xc5, 0x01, 0xd0, 0x01,
+  0xde, 0x01, 0xec, 0x01, 0xf9, 0x01, 0x01, 0x02, 0x0d, 0x02, 0x19, 0x02,
+  0x25, 0x02, 0x31, 0x02, 0x3b, 0x02, 0x4f, 0x02, 0x00, 0x00, 0x0e, 0x00,
+  0x1c, 0x00, 0x2a, 0x00, 0x38, 0x00, 0x46, 0x00, 0x54, 0x00, 0x61, 0x00,
+  0x71, 0x00, 0x7f, 0x00, 0x8e, 0x00, 0x9a, 0x00, 0xa4, 0x00, 0xb2, 0x00,
+  0xc0, 0x00, 0xcc, 0x00, 0xd8, 0x00, 0xe5, 0x00, 0xf4, 0x00, 0x04, 0x01,
+  0x15, 0x01, 0x24, 0x01, 0x2f, 0x01, 0x3f, 0x01, 0x4e, 0x01, 0x5c, 0x01,
+  0x68, 0x01, 0x79, 0x01, 0x85, 0x01, 0x8f, 0x01, 0x9d, 0x01, 0xa9, 0x01,
+  0xb7, 0x01, 0xc3, 0x01, 0xcf, 0x01, 0xdd, 0x01, 0xe9, 0x01, 0xf7, 0x01,
+  0x03, 0x02, 0x12, 0x02, 0x20, 0x02, 0x2e, 0x02, 0x3a, 0x02, 0x48, 0x02,
+  0x56, 0x02, 0x64, 0x02, 0x70, 0x02, 0x7e, 0x02, 0x90, 0x02, 0x9e, 0x02,
+  0xac, 0x02, 0xb8, 0x02, 0xc4, 0x02, 0xcd, 0x02, 0xdd, 0x02, 0xe7, 0x02,
+  0xf3, 0x02, 0xfd, 0x02, 0x07, 0x03, 0x16, 0x03, 0x24, 0x03, 0x36, 0x03,
+  0x00, 0x00, 0x0e, 0x00, 0x1c, 0x00, 0x2a, 0x00, 0x38, 0x00, 0x4e, 0x00,
+  0x5a, 0x00, 0x6a, 0x00, 0x7a, 0x00, 0x88, 0x00, 0x98, 0x00, 0xa9, 0x00,
+  0xb3, 0x00, 0xc8, 0x00, 0xd4, 0x00, 0xe2, 0x00, 0xf0, 0x00, 0xfc, 0x00,
+  0x09, 0x01, 0x15, 0x01, 0x25, 0x01, 0x32, 0x01, 0x3e, 0x01, 0x48, 0x01,
+  0x57, 0x01, 0x63, 0x01, 0x71, 0x01, 0x7c, 0x01, 0x8a, 0x01, 0x9a, 0x01,
+  0xaa, 0x01, 0xb8, 0x01, 0xc6, 0x01, 0xd4, 0x01, 0xe2, 0x01, 0xee, 0x01,
+  0xfa, 0x01, 0x06, 0x02, 0x12, 0x02, 0x1b, 0x02, 0x27, 0x02, 0x35, 0x02,
+  0x41, 0x02, 0x00, 0x00, 0x0c, 0x00, 0x18, 0x00, 0x26, 0x00, 0x32, 0x00,
+  0x3e, 0x00, 0x4e, 0x00, 0x5c, 0x00, 0x6a, 0x00, 0x77, 0x00, 0x85, 0x00,
+  0x93, 0x00, 0xa2, 0x00, 0xae, 0x00, 0xba, 0x00, 0xc7, 0x00, 0xd7, 0x00,
+  0xe4, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0x08, 0x01, 0x14, 0x01, 0x22, 0x01,
+  0x2e, 0x01, 0x3a, 0x01, 0x46, 0x01, 0x52, 0x01, 0x5e, 0x01, 0x6c, 0x01,
+  0x7a, 0x01, 0x8a, 0x01, 0x96, 0x01, 0xa6, 0x01, 0xb2, 0x01, 0xc2, 0x01,
+  0xd2, 0x01, 0xe4, 0x01, 0xf4, 0x01, 0x00, 0x02, 0x11, 0x02, 0x21, 0x02,
+  0x31, 0x02, 0x3d, 0x02, 0x4d, 0x02, 0x59, 0x02, 0x67, 0x02, 0x73, 0x02,
+  0x84, 0x02, 0x90, 0x02, 0x99, 0x02, 0xa5, 0x02, 0xb2, 0x02, 0x00, 0x00,
+  0x2e, 0x00, 0x3c, 0x00, 0x4a, 0x00, 0x5b, 0x00, 0x69, 0x00, 0x77, 0x00,
+  0x85, 0x00, 0x94, 0x00, 0xa0, 0x00, 0xae, 0x00, 0xba, 0x00, 0xc9, 0x00,
+  0xd7, 0x00, 0xe5, 0x00, 0xf3, 0x00, 0x01, 0x01, 0x14, 0x01, 0x22, 0x01,
+  0x2f, 0x01, 0x3e, 0x01, 0x4d, 0x01, 0x5b, 0x01, 0x69, 0x01, 0x79, 0x01,
+  0x87, 0x01, 0x98, 0x01, 0xa9, 0x01, 0xb2, 0x01, 0xc5, 0x01, 0xd3, 0x01,
+  0xe2, 0x01, 0xf0, 0x01, 0xfe, 0x01, 0x0c, 0x02, 0x1a, 0x02, 0x2a, 0x02,
+  0x38, 0x02, 0x46, 0x02, 0x51, 0x02, 0x5c, 0x02, 0x68, 0x02, 0x76, 0x02,
+  0x84, 0x02, 0x92, 0x02, 0xa0, 0x02, 0xae, 0x02, 0xbd, 0x02, 0xcb, 0x02,
+  0xdb, 0x02, 0xea, 0x02, 0xf8, 0x02, 0x08, 0x03, 0x16, 0x03, 0x24, 0x03,
+  0x34, 0x03, 0x43, 0x03, 0x51, 0x03, 0x5c, 0x03, 0x6a, 0x03, 0x7a, 0x03,
+  0x84, 0x03, 0x00, 0x00, 0x0c, 0x00, 0x18, 0x00, 0x23, 0x00, 0x2e, 0x00,
+  0x38, 0x00, 0x42, 0x00, 0x4c, 0x00, 0x5f, 0x00, 0x6e, 0x00, 0x7c, 0x00,
+  0x87, 0x00, 0x92, 0x00, 0x9e, 0x00, 0xa9, 0x00, 0xb6, 0x00, 0xc1, 0x00,
+  0xcf, 0x00, 0xdc, 0x00, 0xe8, 0x00, 0xf2, 0x00, 0x00, 0x01, 0x0c, 0x01,
+  0x16, 0x01, 0x25, 0x01, 0x33, 0x01, 0x3d, 0x01, 0x48, 0x01, 0x5b, 0x01,
+  0x65, 0x01, 0x73, 0x01, 0x81, 0x01, 0x8b, 0x01, 0x95, 0x01, 0xa4, 0x01,
+  0xae, 0x01, 0xc0, 0x01, 0xce, 0x01, 0xd8, 0x01, 0xe6, 0x01, 0xf1, 0x01,
+  0xfb, 0x01, 0x06, 0x02, 0x17, 0x02, 0x23, 0x02, 0x2f, 0x02, 0x41, 0x02,
+  0x4f, 0x02, 0x5a, 0x02, 0x65, 0x02, 0x6f, 0x02, 0x7b, 0x02, 0x86, 0x02,
+  0x95, 0x02, 0x9f, 0x02, 0xaa, 0x02, 0xb5, 0x02, 0x00, 0x00, 0x0c, 0x00,
+  0x1f, 0x00, 0x30, 0x00, 0x3c, 0x00, 0x48, 0x00, 0x54, 0x00, 0x64, 0x00,
+  0x71, 0x00, 0x82, 0x00, 0x93, 0x00, 0x9f, 0x00, 0xa9, 0x00, 0xb4, 0x00,
+  0xc5, 0x00, 0xd0, 0x00, 0xda, 0x00, 0xe6, 0x00, 0xf1, 0x00, 0xfe, 0x00,
+  0x0f, 0x01, 0x1b, 0x01, 0x29, 0x01, 0x39, 0x01, 0x47, 0x01, 0x55, 0x01,
+  0x5e, 0x01, 0x71, 0x01, 0x7f, 0x01, 0x89, 0x01, 0x99, 0x01, 0xab, 0x01,
+  0xbc, 0x01, 0xcc, 0x01, 0xdc, 0x01, 0xee, 0x01, 0xfa, 0x01, 0x08, 0x02,
+  0x19, 0x02, 0x2a, 0x02, 0x00, 0x00, 0x0e, 0x00, 0x1a, 0x00, 0x26, 0x00,
+  0x36, 0x00, 0x44, 0x00, 0x53, 0x00, 0x61, 0x00, 0x6d, 0x00, 0x77, 0x00,
+  0x83, 0x00, 0x91, 0x00, 0x9f, 0x00, 0xab, 0x00, 0xb7, 0x00, 0xc5, 0x00,
+  0xd1, 0x00, 0xdd, 0x00, 0xeb, 0x00, 0xf9, 0x00, 0x08, 0x01, 0x14, 0x01,
+  0x20, 0x01, 0x2c, 0x01, 0x38, 0x01, 0x49, 0x01, 0x55, 0x01, 0x61, 0x01,
+  0x73, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x18, 0x00, 0x22, 0x00, 0x2e, 0x00,
+  0x39, 0x00, 0x47, 0x00, 0x5c, 0x00, 0x6a, 0x00, 0x7a, 0x00, 0x88, 0x00,
+  0x93, 0x00, 0xa3, 0x00, 0xaf, 0x00, 0xbb, 0x00, 0xc9, 0x00, 0xd5, 0x00,
+  0xe5, 0x00, 0xf2, 0x00, 0x00, 0x01, 0x10, 0x01, 0x20, 0x01, 0x30, 0x01,
+  0x3c, 0x01, 0x4c, 0x01, 0x5b, 0x01, 0x6a, 0x01, 0x73, 0x01, 0x81, 0x01,
+  0x94, 0x01, 0xa7, 0x01, 0xb4, 0x01, 0xc4, 0x01, 0xd6, 0x01, 0xe4, 0x01,
+  0xf4, 0x01, 0x00, 0x00, 0x0e, 0x00, 0x1c, 0x00, 0x2a, 0x00, 0x3b, 0x00,
+  0x4b, 0x00, 0x59, 0x00, 0x65, 0x00, 0x7b, 0x00, 0x89, 0x00, 0x98, 0x00,
+  0xa4, 0x00, 0xb5, 0x00, 0xc4, 0x00, 0xd0, 0x00, 0xe1, 0x00, 0xed, 0x00,
+  0xf8, 0x00, 0x03, 0x01, 0x11, 0x01, 0x1d, 0x01, 0x2c, 0x01, 0x37, 0x01,
+  0x41, 0x01, 0x51, 0x01, 0x62, 0x01, 0x74, 0x01, 0x84, 0x01, 0x8e, 0x01,
+  0xa0, 0x01, 0xac, 0x01, 0xb6, 0x01, 0xc4, 0x01, 0xd3, 0x01, 0xe1, 0x01,
+  0xef, 0x01, 0xfb, 0x01, 0x09, 0x02, 0x13, 0x02, 0x1f, 0x02, 0x00, 0x00,
+  0x25, 0x00, 0x31, 0x00, 0x3d, 0x00, 0x4d, 0x00, 0x5d, 0x00, 0x6f, 0x00,
+  0x7b, 0x00, 0x8f, 0x00, 0x9f, 0x00, 0xad, 0x00, 0xbf, 0x00, 0xcb, 0x00,
+  0xdd, 0x00, 0xea, 0x00, 0xf8, 0x00, 0x0e, 0x01, 0x20, 0x01, 0x2a, 0x01,
+  0x38, 0x01, 0x46, 0x01, 0x5a, 0x01, 0x67, 0x01, 0x74, 0x01, 0x86, 0x01,
+  0x92, 0x01, 0x9f, 0x01, 0xae, 0x01, 0xc1, 0x01, 0xd5, 0x01, 0xe1, 0x01,
+  0xec, 0x01, 0xf8, 0x01, 0x05, 0x02, 0x00, 0x00, 0x25, 0x00, 0x30, 0x00,
+  0x3c, 0x00, 0x47, 0x00, 0x52, 0x00, 0x5d, 0x00, 0x68, 0x00, 0x76, 0x00,
+  0x81, 0x00, 0x95, 0x00, 0xa1, 0x00, 0xac, 0x00, 0xb8, 0x00, 0xc3, 0x00,
+  0xcf, 0x00, 0xda, 0x00, 0xe5, 0x00, 0xf7, 0x00, 0x02, 0x01, 0x12, 0x01,
+  0x20, 0x01, 0x2c, 0x01, 0x00, 0x00, 0x0e, 0x00, 0x1e, 0x00, 0x2c, 0x00,
+  0x40, 0x00, 0x4e, 0x00, 0x5e, 0x00, 0x6c, 0x00, 0x76, 0x00, 0x82, 0x00,
+  0x8d, 0x00, 0xa2, 0x00, 0xac, 0x00, 0xb6, 0x00, 0xc8, 0x00, 0xd1, 0x00,
+  0xe5, 0x00, 0xf1, 0x00, 0x03, 0x01, 0x11, 0x01, 0x1e, 0x01, 0x2a, 0x01,
+  0x3f, 0x01, 0x4f, 0x01, 0x5b, 0x01, 0x00, 0x00, 0x0b, 0x00, 0x19, 0x00,
+  0x24, 0x00, 0x32, 0x00, 0x40, 0x00, 0x4e, 0x00, 0x5c, 0x00, 0x67, 0x00,
+  0x75, 0x00, 0x80, 0x00, 0x8e, 0x00, 0x9c, 0x00, 0xaa, 0x00, 0xb6, 0x00,
+  0xc4, 0x00, 0xd4, 0x00, 0xe2, 0x00, 0xf0, 0x00, 0xfb, 0x00, 0x07, 0x01,
+  0x15, 0x01, 0x21, 0x01, 0x2f, 0x01, 0x3d, 0x01, 0x4b, 0x01, 0x5d, 0x01,
+  0x00, 0x00, 0x1a, 0x00, 0x32, 0x00, 0x44, 0x00, 0x56, 0x00, 0x66, 0x00,
+  0x72, 0x00, 0x87, 0x00, 0x9a, 0x00, 0xa9, 0x00, 0xb5, 0x00, 0xc3, 0x00,
+  0x00, 0x00, 0x18, 0x00, 0x23, 0x00, 0x33, 0x00, 0x44, 0x00, 0x52, 0x00,
+  0x62, 0x00, 0x6d, 0x00, 0x7a, 0x00, 0x8b, 0x00, 0x96, 0x00, 0xa1, 0x00,
+  0xac, 0x00, 0xb8, 0x00, 0xc6, 0x00, 0xd4, 0x00, 0xe0, 0x00, 0xeb, 0x00,
+  0xf9, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x1a, 0x00, 0x2a, 0x00, 0x36, 0x00,
+  0x42, 0x00, 0x50, 0x00, 0x5c, 0x00, 0x67, 0x00, 0x73, 0x00, 0x8b, 0x00,
+  0x97, 0x00, 0xa7, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x18, 0x00, 0x22, 0x00,
+  0x2c, 0x00, 0x3a, 0x00, 0x48, 0x00, 0x53, 0x00, 0x61, 0x00, 0x6b, 0x00,
+  0x7e, 0x00, 0x89, 0x00, 0x97, 0x00, 0xa6, 0x00, 0xb4, 0x00, 0xc0, 0x00,
+  0xcf, 0x00, 0xdd, 0x00, 0xeb, 0x00, 0xf7, 0x00, 0x0c, 0x01, 0x16, 0x01,
+  0x21, 0x01, 0x2c, 0x01, 0x40, 0x01, 0x4e, 0x01, 0x62, 0x01, 0x70, 0x01,
+  0x7b, 0x01, 0x86, 0x01, 0x9a, 0x01, 0xa8, 0x01, 0xb6, 0x01, 0xc6, 0x01,
+  0xd0, 0x01, 0xda, 0x01, 0xe8, 0x01, 0xf2, 0x01, 0xfe, 0x01, 0x0d, 0x02,
+  0x17, 0x02, 0x2b, 0x02, 0x36, 0x02, 0x45, 0x02, 0x52, 0x02, 0x5e, 0x02,
+  0x69, 0x02, 0x75, 0x02, 0x82, 0x02, 0x8e, 0x02, 0x9c, 0x02, 0xaa, 0x02,
+  0xbe, 0x02, 0xcc, 0x02, 0xd6, 0x02, 0xe2, 0x02, 0x00, 0x00, 0x0f, 0x00,
+  0x26, 0x00, 0x3c, 0x00, 0x48, 0x00, 0x52, 0x00, 0x5e, 0x00, 0x6a, 0x00,
+  0x78, 0x00, 0x8a, 0x00, 0x98, 0x00, 0xa8, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x23, 0x00, 0x2f, 0x00, 0x3f, 0x00, 0x4d, 0x00, 0x5d, 0x00, 0x69, 0x00,
+  0x7a, 0x00, 0x86, 0x00, 0x92, 0x00, 0xa4, 0x00, 0xb0, 0x00, 0xbc, 0x00,
+  0xc8, 0x00, 0xd9, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x20, 0x00, 0x2f, 0x00, 0x39, 0x00, 0x47, 0x00, 0x53, 0x00,
+  0x68, 0x00, 0x76, 0x00, 0x84, 0x00, 0x92, 0x00, 0xa0, 0x00, 0xae, 0x00,
+  0xbd, 0x00, 0xcb, 0x00, 0xd7, 0x00, 0xe5, 0x00, 0xf3, 0x00, 0x01, 0x01,
+  0x0d, 0x01, 0x1b, 0x01, 0x00, 0x00, 0x0d, 0x00, 0x1a, 0x00, 0x24, 0x00,
+  0x30, 0x00, 0x3c, 0x00, 0x49, 0x00, 0x54, 0x00, 0x61, 0x00, 0x6a, 0x00,
+  0x78, 0x00, 0x86, 0x00, 0x94, 0x00, 0xa2, 0x00, 0xaa, 0x00, 0xb2, 0x00,
+  0xbf, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x1d, 0x00, 0x2e, 0x00, 0x3f, 0x00,
+  0x4b, 0x00, 0x59, 0x00, 0x69, 0x00, 0x75, 0x00, 0x84, 0x00, 0x94, 0x00,
+  0x9d, 0x00, 0xad, 0x00, 0xbd, 0x00, 0xd3, 0x00, 0xe1, 0x00, 0xea, 0x00,
+  0xf6, 0x00, 0x01, 0x01, 0x0d, 0x01, 0x00, 0x00, 0x12, 0x00, 0x22, 0x00,
+  0x32, 0x00, 0x42, 0x00, 0x4e, 0x00, 0x57, 0x00, 0x62, 0x00, 0x6d, 0x00,
+  0x7d, 0x00, 0x8b, 0x00, 0x96, 0x00, 0xa2, 0x00, 0xab, 0x00, 0xb6, 0x00,
+  0xc6, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1d, 0x00, 0x27, 0x00, 0x39, 0x00,
+  0x50, 0x00, 0x5c, 0x00, 0x66, 0x00, 0x70, 0x00, 0x79, 0x00, 0x83, 0x00,
+  0x95, 0x00, 0x9f, 0x00, 0xaa, 0x00, 0xbb, 0x00, 0xcd, 0x00, 0xd6, 0x00,
+  0xe0, 0x00, 0xf2, 0x00, 0xfd, 0x00, 0x08, 0x01, 0x12, 0x01, 0x00, 0x00,
+  0x1e, 0x00, 0x31, 0x00, 0x3f, 0x00, 0x4a, 0x00, 0x56, 0x00, 0x65, 0x00,
+  0x72, 0x00, 0x7e, 0x00, 0x87, 0x00, 0x99, 0x00, 0xab, 0x00, 0xb5, 0x00,
+  0xc7, 0x00, 0xd2, 0x00, 0xe0, 0x00, 0xea, 0x00, 0xf5, 0x00, 0x01, 0x01,
+  0x0b, 0x01, 0x17, 0x01, 0x23, 0x01, 0x2d, 0x01, 0x37, 0x01, 0x4a, 0x01,
+  0x55, 0x01, 0x67, 0x01, 0x7a, 0x01, 0x86, 0x01, 0x93, 0x01, 0xa7, 0x01,
+  0xb0, 0x01, 0xbd, 0x01, 0xcb, 0x01, 0xd9, 0x01, 0xeb, 0x01, 0xf7, 0x01,
+  0x04, 0x02, 0x17, 0x02, 0x23, 0x02, 0x2e, 0x02, 0x38, 0x02, 0x42, 0x02,
+  0x00, 0x00, 0x0e, 0x00, 0x19, 0x00, 0x24, 0x00, 0x32, 0x00, 0x3e, 0x00,
+  0x49, 0x00, 0x57, 0x00, 0x64, 0x00, 0x6f, 0x00, 0x7b, 0x00, 0x87, 0x00,
+  0x95, 0x00, 0xa2, 0x00, 0xb0, 0x00, 0xbe, 0x00, 0xca, 0x00, 0xd3, 0x00,
+  0xde, 0x00, 0xe9, 0x00, 0xf5, 0x00, 0x01, 0x01, 0x0c, 0x01, 0x18, 0x01,
+  0x24, 0x01, 0x30, 0x01, 0x3c, 0x01, 0x4a, 0x01, 0x55, 0x01, 0x63, 0x01,
+  0x6e, 0x01, 0x7a, 0x01, 0x86, 0x01, 0x92, 0x01, 0x9e, 0x01, 0xad, 0x01,
+  0xb9, 0x01, 0xc1, 0x01, 0xcd, 0x01, 0xd6, 0x01, 0xe2, 0x01, 0xf0, 0x01,
+  0x00, 0x00, 0x12, 0x00, 0x1e, 0x00, 0x33, 0x00, 0x41, 0x00, 0x50, 0x00,
+  0x5c, 0x00, 0x6a, 0x00, 0x76, 0x00, 0x81, 0x00, 0x8c, 0x00, 0xa0, 0x00,
+  0xac, 0x00, 0xc3, 0x00, 0xd0, 0x00, 0xdc, 0x00, 0xea, 0x00, 0xf4, 0x00,
+  0x02, 0x01, 0x0c, 0x01, 0x1a, 0x01, 0x28, 0x01, 0x38, 0x01, 0x44, 0x01,
+  0x52, 0x01, 0x5d, 0x01, 0x70, 0x01, 0x80, 0x01, 0x91, 0x01, 0x9d, 0x01,
+  0xa8, 0x01, 0xb9, 0x01, 0xc6, 0x01, 0xd2, 0x01, 0xe0, 0x01, 0xec, 0x01,
+  0xf8, 0x01, 0x07, 0x02, 0x14, 0x02, 0x24, 0x02, 0x30, 0x02, 0x3c, 0x02,
+  0x47, 0x02, 0x53, 0x02, 0x5e, 0x02, 0x00, 0x00, 0x0f, 0x00, 0x1e, 0x00,
+  0x2c, 0x00, 0x3a, 0x00, 0x45, 0x00, 0x54, 0x00, 0x5e, 0x00, 0x6c, 0x00,
+  0x7a, 0x00, 0x8a, 0x00, 0x96, 0x00, 0xa4, 0x00, 0xb1, 0x00, 0xbf, 0x00,
+  0xcd, 0x00, 0xdb, 0x00, 0xe6, 0x00, 0xf1, 0x00, 0xff, 0x00, 0x10, 0x01,
+  0x1e, 0x01, 0x2a, 0x01, 0x3f, 0x01, 0x4d, 0x01, 0x58, 0x01, 0x66, 0x01,
+  0x74, 0x01, 0x82, 0x01, 0x90, 0x01, 0x9e, 0x01, 0xac, 0x01, 0xbb, 0x01,
+  0xc7, 0x01, 0xd5, 0x01, 0xe1, 0x01, 0xef, 0x01, 0xfd, 0x01, 0x0b, 0x02,
+  0x19, 0x02, 0x24, 0x02, 0x2f, 0x02, 0x3e, 0x02, 0x49, 0x02, 0x56, 0x02,
+  0x62, 0x02, 0x70, 0x02, 0x7d, 0x02, 0x8b, 0x02, 0x96, 0x02, 0xa1, 0x02,
+  0xaf, 0x02, 0xbd, 0x02, 0xc7, 0x02, 0xd5, 0x02, 0xdf, 0x02, 0xe9, 0x02,
+  0xf4, 0x02, 0x02, 0x03, 0x0f, 0x03, 0x1b, 0x03, 0x25, 0x03, 0x31, 0x03,
+  0x3b, 0x03, 0x49, 0x03, 0x57, 0x03, 0x62, 0x03, 0x6c, 0x03, 0x76, 0x03,
+  0x84, 0x03, 0x90, 0x03, 0x9b, 0x03, 0xaa, 0x03, 0xb4, 0x03, 0xc0, 0x03,
+  0xcf, 0x03, 0xde, 0x03, 0x00, 0x00, 0x0e, 0x00, 0x1c, 0x00, 0x2a, 0x00,
+  0x38, 0x00, 0x44, 0x00, 0x50, 0x00, 0x5a, 0x00, 0x66, 0x00, 0x78, 0x00,
+  0x84, 0x00, 0x90, 0x00, 0x9c, 0x00, 0xae, 0x00, 0xbc, 0x00, 0xca, 0x00,
+  0xd4, 0x00, 0xde, 0x00, 0xec, 0x00, 0xfe, 0x00, 0x0a, 0x01, 0x15, 0x01,
+  0x21, 0x01, 0x2f, 0x01, 0x3e, 0x01, 0x4b, 0x01, 0x57, 0x01, 0x65, 0x01,
+  0x6f, 0x01, 0x7b, 0x01, 0x87, 0x01, 0x93, 0x01, 0xa2, 0x01, 0xaf, 0x01,
+  0xbd, 0x01, 0xcb, 0x01, 0xdd, 0x01, 0xe9, 0x01, 0xf5, 0x01, 0x09, 0x02,
+  0x18, 0x02, 0x24, 0x02, 0x36, 0x02, 0x48, 0x02, 0x5d, 0x02, 0x69, 0x02,
+  0x75, 0x02, 0x81, 0x02, 0x8f, 0x02, 0x9d, 0x02, 0xa8, 0x02, 0xb3, 0x02,
+  0xc1, 0x02, 0xd0, 0x02, 0xe2, 0x02, 0xeb, 0x02, 0xfa, 0x02, 0x08, 0x03,
+  0x1b, 0x03, 0x26, 0x03, 0x32, 0x03, 0x00, 0x00, 0x10, 0x00, 0x1c, 0x00,
+  0x2c, 0x00, 0x37, 0x00, 0x47, 0x00, 0x53, 0x00, 0x5f, 0x00, 0x6d, 0x00,
+  0x79, 0x00, 0x84, 0x00, 0x8f, 0x00, 0xa0, 0x00, 0xab, 0x00, 0xb7, 0x00,
+  0xc3, 0x00, 0xd3, 0x00, 0xe4, 0x00, 0xf1, 0x00, 0x04, 0x01, 0x10, 0x01,
+  0x1c, 0x01, 0x28, 0x01, 0x34, 0x01, 0x40, 0x01, 0x4d, 0x01, 0x58, 0x01,
+  0x69, 0x01, 0x75, 0x01, 0x81, 0x01, 0x8d, 0x01, 0x99, 0x01, 0xa6, 0x01,
+  0xb2, 0x01, 0xbe, 0x01, 0xca, 0x01, 0xd5, 0x01, 0xe1, 0x01, 0xf2, 0x01,
+  0xfd, 0x01, 0x09, 0x02, 0x16, 0x02, 0x22, 0x02, 0x2f, 0x02, 0x3a, 0x02,
+  0x4a, 0x02, 0x56, 0x02, 0x66, 0x02, 0x76, 0x02, 0x81, 0x02, 0x95, 0x02,
+  0xa1, 0x02, 0xad, 0x02, 0xb9, 0x02, 0xc6, 0x02, 0x00, 0x00, 0x16, 0x00,
+  0x22, 0x00, 0x30, 0x00, 0x3f, 0x00, 0x4b, 0x00, 0x59, 0x00, 0x67, 0x00,
+  0x75, 0x00, 0x81, 0x00, 0x8e, 0x00, 0x9a, 0x00, 0xa6, 0x00, 0xb4, 0x00,
+  0xc0, 0x00, 0xcc, 0x00, 0xe1, 0x00, 0xed, 0x00, 0xfb, 0x00, 0x07, 0x01,
+  0x15, 0x01, 0x22, 0x01, 0x30, 0x01, 0x3c, 0x01, 0x48, 0x01, 0x5b, 0x01,
+  0x65, 0x01, 0x74, 0x01, 0x7f, 0x01, 0x8e, 0x01, 0x9b, 0x01, 0xa9, 0x01,
+  0xb4, 0x01, 0xc2, 0x01, 0xd7, 0x01, 0xe4, 0x01, 0xee, 0x01, 0xff, 0x01,
+  0x0b, 0x02, 0x19, 0x02, 0x25, 0x02, 0x33, 0x02, 0x40, 0x02, 0x4c, 0x02,
+  0x5a, 0x02, 0x66, 0x02, 0x70, 0x02, 0x7c, 0x02, 0x8c, 0x02, 0x98, 0x02,
+  0xa6, 0x02, 0xb2, 0x02, 0xc0, 0x02, 0xd0, 0x02, 0xde, 0x02, 0xec, 0x02,
+  0xf8, 0x02, 0x06, 0x03, 0x12, 0x03, 0x20, 0x03, 0x2c, 0x03, 0x39, 0x03,
+  0x00, 0x00, 0x0c, 0x00, 0x1b, 0x00, 0x29, 0x00, 0x37, 0x00, 0x45, 0x00,
+  0x53, 0x00, 0x5e, 0x00, 0x6f, 0x00, 0x7e, 0x00, 0x8c, 0x00, 0x9a, 0x00,
+  0xa7, 0x00, 0xb3, 0x00, 0xc1, 0x00, 0xcf, 0x00, 0xdd, 0x00, 0xec, 0x00,
+  0xfa, 0x00, 0x07, 0x01, 0x17, 0x01, 0x24, 0x01, 0x32, 0x01, 0x44, 0x01,
+  0x52, 0x01, 0x60, 0x01, 0x72, 0x01, 0x80, 0x01, 0x8e, 0x01, 0xa0, 0x01,
+  0xae, 0x01, 0xbb, 0x01, 0xc9, 0x01, 0xd8, 0x01, 0xe6, 0x01, 0xf1, 0x01,
+  0xff, 0x01, 0x0d, 0x02, 0x1b, 0x02, 0x25, 0x02, 0x33, 0x02, 0x44, 0x02,
+  0x53, 0x02, 0x61, 0x02, 0x6b, 0x02, 0x79, 0x02, 0x87, 0x02, 0x93, 0x02,
+  0xa1, 0x02, 0xad, 0x02, 0x00, 0x00, 0x0d, 0x00, 0x1b, 0x00, 0x27, 0x00,
+  0x33, 0x00, 0x41, 0x00, 0x4d, 0x00, 0x5e, 0x00, 0x6c, 0x00, 0x7f, 0x00,
+  0x92, 0x00, 0xa0, 0x00, 0xad, 0x00, 0xba, 0x00, 0xc8, 0x00, 0xd4, 0x00,
+  0xe0, 0x00, 0xf3, 0x00, 0xff, 0x00, 0x0d, 0x01, 0x1b, 0x01, 0x28, 0x01,
+  0x3b, 0x01, 0x47, 0x01, 0x53, 0x01, 0x65, 0x01, 0x73, 0x01, 0x84, 0x01,
+  0x92, 0x01, 0x9e, 0x01, 0xac, 0x01, 0xba, 0x01, 0xc6, 0x01, 0xd4, 0x01,
+  0xe0, 0x01, 0xf1, 0x01, 0xfc, 0x01, 0x0c, 0x02, 0x19, 0x02, 0x27, 0x02,
+  0x33, 0x02, 0x3f, 0x02, 0x4c, 0x02, 0x58, 0x02, 0x63, 0x02, 0x70, 0x02,
+  0x7e, 0x02, 0x8e, 0x02, 0x9c, 0x02, 0xa8, 0x02, 0xb5, 0x02, 0xc1, 0x02,
+  0xd1, 0x02, 0xdd, 0x02, 0xed, 0x02, 0xf8, 0x02, 0x04, 0x03, 0x14, 0x03,
+  0x26, 0x03, 0x35, 0x03, 0x45, 0x03, 0x53, 0x03, 0x63, 0x03, 0x73, 0x03,
+  0x82, 0x03, 0x90, 0x03, 0xa3, 0x03, 0xb0, 0x03, 0xc4, 0x03, 0xd0, 0x03,
+  0xdf, 0x03, 0xeb, 0x03, 0xf7, 0x03, 0x00, 0x00, 0x0e, 0x00, 0x1a, 0x00,
+  0x26, 0x00, 0x34, 0x00, 0x42, 0x00, 0x50, 0x00, 0x5e, 0x00, 0x72, 0x00,
+  0x7e, 0x00, 0x8a, 0x00, 0x98, 0x00, 0xa4, 0x00, 0xb5, 0x00, 0xc6, 0x00,
+  0xd4, 0x00, 0xe0, 0x00, 0xec, 0x00, 0xf8, 0x00, 0x06, 0x01, 0x13, 0x01,
+  0x20, 0x01, 0x34, 0x01, 0x40, 0x01, 0x4c, 0x01, 0x58, 0x01, 0x69, 0x01,
+  0x75, 0x01, 0x81, 0x01, 0x8d, 0x01, 0x9b, 0x01, 0xa7, 0x01, 0xb5, 0x01,
+  0xc2, 0x01, 0x00, 0x00, 0x10, 0x00, 0x1e, 0x00, 0x31, 0x00, 0x44, 0x00,
+  0x52, 0x00, 0x5d, 0x00, 0x6b, 0x00, 0x79, 0x00, 0x87, 0x00, 0x95, 0x00,
+  0xa9, 0x00, 0xb7, 0x00, 0xc6, 0x00, 0xd4, 0x00, 0xe2, 0x00, 0xf0, 0x00,
+  0xfe, 0x00, 0x0c, 0x01, 0x1a, 0x01, 0x28, 0x01, 0x36, 0x01, 0x45, 0x01,
+  0x54, 0x01, 0x62, 0x01, 0x70, 0x01, 0x7e, 0x01, 0x8c, 0x01, 0x9a, 0x01,
+  0xae, 0x01, 0xbc, 0x01, 0xca, 0x01, 0xd8, 0x01, 0xe6, 0x01, 0xf9, 0x01,
+  0x03, 0x02, 0x11, 0x02, 0x21, 0x02, 0x2f, 0x02, 0x3c, 0x02, 0x4a, 0x02,
+  0x58, 0x02, 0x66, 0x02, 0x74, 0x02, 0x85, 0x02, 0x93, 0x02, 0xa1, 0x02,
+  0xaf, 0x02, 0xc3, 0x02, 0xd1, 0x02, 0xdf, 0x02, 0xea, 0x02, 0xf9, 0x02,
+  0x07, 0x03, 0x15, 0x03, 0x23, 0x03, 0x2f, 0x03, 0x3d, 0x03, 0x49, 0x03,
+  0x57, 0x03, 0x68, 0x03, 0x76, 0x03, 0x81, 0x03, 0x8f, 0x03, 0x9f, 0x03,
+  0xb3, 0x03, 0xc4, 0x03, 0xd2, 0x03, 0xe0, 0x03, 0xee, 0x03, 0xfe, 0x03,
+  0x0c, 0x04, 0x1c, 0x04, 0x00, 0x00, 0x0c, 0x00, 0x18, 0x00, 0x26, 0x00,
+  0x36, 0x00, 0x4d, 0x00, 0x5c, 0x00, 0x66, 0x00, 0x75, 0x00, 0x81, 0x00,
+  0x92, 0x00, 0xa0, 0x00, 0xae, 0x00, 0xbc, 0x00, 0xca, 0x00, 0xd8, 0x00,
+  0xe6, 0x00, 0xfa, 0x00, 0x08, 0x01, 0x1f, 0x01, 0x2b, 0x01, 0x39, 0x01,
+  0x4d, 0x01, 0x5b, 0x01, 0x65, 0x01, 0x71, 0x01, 0x7d, 0x01, 0x8b, 0x01,
+  0x9b, 0x01, 0xa7, 0x01, 0xb5, 0x01, 0x00, 0x00, 0x11, 0x00, 0x22, 0x00,
+  0x32, 0x00, 0x43, 0x00, 0x54, 0x00, 0x61, 0x00, 0x72, 0x00, 0x82, 0x00,
+  0x93, 0x00, 0xa4, 0x00, 0xb4, 0x00, 0xc5, 0x00, 0xd6, 0x00, 0xe1, 0x00,
+  0xf6, 0x00, 0x06, 0x01, 0x12, 0x01, 0x23, 0x01, 0x2f, 0x01, 0x3f, 0x01,
+  0x4f, 0x01, 0x5b, 0x01, 0x6d, 0x01, 0x7f, 0x01, 0x91, 0x01, 0x9f, 0x01,
+  0xaf, 0x01, 0xc0, 0x01, 0xd1, 0x01, 0xe2, 0x01, 0xf0, 0x01, 0x00, 0x02,
+  0x10, 0x02, 0x25, 0x02, 0x35, 0x02, 0x00, 0x00, 0x10, 0x00, 0x1e, 0x00,
+  0x2a, 0x00, 0x37, 0x00, 0x45, 0x00, 0x56, 0x00, 0x64, 0x00, 0x74, 0x00,
+  0x89, 0x00, 0x9f, 0x00, 0xaf, 0x00, 0xbd, 0x00, 0xcb, 0x00, 0xdb, 0x00,
+  0xea, 0x00, 0xf6, 0x00, 0x04, 0x01, 0x12, 0x01, 0x20, 0x01, 0x2a, 0x01,
+  0x3a, 0x01, 0x46, 0x01, 0x52, 0x01, 0x62, 0x01, 0x70, 0x01, 0x80, 0x01,
+  0x90, 0x01, 0x9e, 0x01, 0xaa, 0x01, 0x00, 0x00, 0x11, 0x00, 0x24, 0x00,
+  0x31, 0x00, 0x3f, 0x00, 0x57, 0x00, 0x62, 0x00, 0x70, 0x00, 0x81, 0x00,
+  0x91, 0x00, 0xa2, 0x00, 0xb0, 0x00, 0xc7, 0x00, 0xd8, 0x00, 0xe6, 0x00,
+  0xf1, 0x00, 0x03, 0x01, 0x1a, 0x01, 0x2a, 0x01, 0x3c, 0x01, 0x49, 0x01,
+  0x57, 0x01, 0x66, 0x01, 0x74, 0x01, 0x00, 0x00, 0x0d, 0x00, 0x1a, 0x00,
+  0x26, 0x00, 0x39, 0x00, 0x45, 0x00, 0x50, 0x00, 0x60, 0x00, 0x70, 0x00,
+  0x7c, 0x00, 0x8c, 0x00, 0x9d, 0x00, 0xac, 0x00, 0xbb, 0x00, 0xc7, 0x00,
+  0xd6, 0x00, 0xe7, 0x00, 0xf2, 0x00, 0xfc, 0x00, 0x07, 0x01, 0x12, 0x01,
+  0x20, 0x01, 0x30, 0x01, 0x3e, 0x01, 0x55, 0x01, 0x65, 0x01, 0x77, 0x01,
+  0x83, 0x01, 0x92, 0x01, 0x9d, 0x01, 0xab, 0x01, 0xbd, 0x01, 0xcd, 0x01,
+  0xdf, 0x01, 0x00, 0x00, 0x14, 0x00, 0x21, 0x00, 0x33, 0x00, 0x41, 0x00,
+  0x50, 0x00, 0x64, 0x00, 0x7b, 0x00, 0x88, 0x00, 0x9a, 0x00, 0xa7, 0x00,
+  0xb8, 0x00, 0xc3, 0x00, 0xd0, 0x00, 0xde, 0x00, 0xe8, 0x00, 0xf2, 0x00,
+  0x06, 0x01, 0x18, 0x01, 0x24, 0x01, 0x2e, 0x01, 0x3e, 0x01, 0x4a, 0x01,
+  0x55, 0x01, 0x5f, 0x01, 0x74, 0x01, 0x7e, 0x01, 0x89, 0x01, 0x99, 0x01,
+  0xa6, 0x01, 0xb6, 0x01, 0xc3, 0x01, 0x00, 0x00, 0x18, 0x00, 0x26, 0x00,
+  0x32, 0x00, 0x40, 0x00, 0x4c, 0x00, 0x57, 0x00, 0x63, 0x00, 0x70, 0x00,
+  0x7b, 0x00, 0x86, 0x00, 0x9a, 0x00, 0xa9, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x22, 0x00, 0x30, 0x00, 0x40, 0x00, 0x50, 0x00, 0x5b, 0x00, 0x6b, 0x00,
+  0x77, 0x00, 0x81, 0x00, 0x8d, 0x00, 0x9d, 0x00, 0xaa, 0x00, 0xb7, 0x00,
+  0xc3, 0x00, 0xd1, 0x00, 0xe8, 0x00, 0xf2, 0x00, 0x02, 0x01, 0x0c, 0x01,
+  0x1c, 0x01, 0x2c, 0x01, 0x3c, 0x01, 0x00, 0x00, 0x18, 0x00, 0x34, 0x00,
+  0x42, 0x00, 0x50, 0x00, 0x5f, 0x00, 0x6a, 0x00, 0x78, 0x00, 0x87, 0x00,
+  0x95, 0x00, 0xa0, 0x00, 0xab, 0x00, 0xb9, 0x00, 0xc7, 0x00, 0xd5, 0x00,
+  0xe3, 0x00, 0xf1, 0x00, 0xff, 0x00, 0x16, 0x01, 0x21, 0x01, 0x2c, 0x01,
+  0x37, 0x01, 0x46, 0x01, 0x51, 0x01, 0x60, 0x01, 0x6e, 0x01, 0x7c, 0x01,
+  0x8a, 0x01, 0x95, 0x01, 0xaf, 0x01, 0xbd, 0x01, 0xcb, 0x01, 0xd9, 0x01,
+  0xe7, 0x01, 0xf5, 0x01, 0x01, 0x02, 0x0f, 0x02, 0x1d, 0x02, 0x2b, 0x02,
+  0x39, 0x02, 0x00, 0x00, 0x17, 0x00, 0x23, 0x00, 0x31, 0x00, 0x3c, 0x00,
+  0x54, 0x00, 0x62, 0x00, 0x73, 0x00, 0x81, 0x00, 0x8f, 0x00, 0x9a, 0x00,
+  0xac, 0x00, 0xbb, 0x00, 0xc7, 0x00, 0xd7, 0x00, 0xe1, 0x00, 0xf2, 0x00,
+  0x00, 0x01, 0x0a, 0x01, 0x15, 0x01, 0x1f, 0x01, 0x00, 0x00, 0x0b, 0x00,
+  0x18, 0x00, 0x29, 0x00, 0x35, 0x00, 0x40, 0x00, 0x4b, 0x00, 0x5a, 0x00,
+  0x65, 0x00, 0x79, 0x00, 0x8d, 0x00, 0x9e, 0x00, 0xae, 0x00, 0xb9, 0x00,
+  0xcd, 0x00, 0xd8, 0x00, 0xeb, 0x00, 0xf6, 0x00, 0x01, 0x01, 0x12, 0x01,
+  0x23, 0x01, 0x34, 0x01, 0x3f, 0x01, 0x4a, 0x01, 0x00, 0x00, 0x10, 0x00,
+  0x1b, 0x00, 0x27, 0x00, 0x37, 0x00, 0x47, 0x00, 0x52, 0x00, 0x5e, 0x00,
+  0x69, 0x00, 0x79, 0x00, 0x8a, 0x00, 0x98, 0x00, 0xa8, 0x00, 0xb5, 0x00,
+  0xc1, 0x00, 0xcf, 0x00, 0xdf, 0x00, 0xf3, 0x00, 0xff, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x1f, 0x00, 0x2d, 0x00, 0x46, 0x00, 0x53, 0x00, 0x5f, 0x00,
+  0x6d, 0x00, 0x7b, 0x00, 0x87, 0x00, 0x91, 0x00, 0x9e, 0x00, 0xa9, 0x00,
+  0xb3, 0x00, 0xc1, 0x00, 0xcc, 0x00, 0xda, 0x00, 0xeb, 0x00, 0xf7, 0x00,
+  0x03, 0x01, 0x11, 0x01, 0x23, 0x01, 0x00, 0x00, 0x16, 0x00, 0x22, 0x00,
+  0x30, 0x00, 0x3b, 0x00, 0x4c, 0x00, 0x5e, 0x00, 0x6d, 0x00, 0x7b, 0x00,
+  0x00, 0x00, 0x1f, 0x00, 0x2c, 0x00, 0x38, 0x00, 0x44, 0x00, 0x50, 0x00,
+  0x5c, 0x00, 0x68, 0x00, 0x74, 0x00, 0x80, 0x00, 0x8c, 0x00, 0x98, 0x00,
+  0xa4, 0x00, 0xb1, 0x00, 0xbd, 0x00, 0xcb, 0x00, 0xd7, 0x00, 0xe8, 0x00,
+  0xf9, 0x00, 0x09, 0x01, 0x15, 0x01, 0x21, 0x01, 0x2d, 0x01, 0x00, 0x00,
+  0x0a, 0x00, 0x1d, 0x00, 0x29, 0x00, 0x3b, 0x00, 0x4a, 0x00, 0x61, 0x00,
+  0x6d, 0x00, 0x77, 0x00, 0x87, 0x00, 0x97, 0x00, 0x00, 0x00, 0x16, 0x00,
+  0x24, 0x00, 0x32, 0x00, 0x40, 0x00, 0x4e, 0x00, 0x5c, 0x00, 0x6a, 0x00,
+  0x77, 0x00, 0x85, 0x00, 0x93, 0x00, 0xa0, 0x00, 0xac, 0x00, 0xba, 0x00,
+  0xc8, 0x00, 0xd6, 0x00, 0xe4, 0x00, 0xf2, 0x00, 0x00, 0x00, 0x0d, 0x00,
+  0x1a, 0x00, 0x28, 0x00, 0x34, 0x00, 0x4f, 0x00, 0x67, 0x00, 0x00, 0x00,
+  0x1a, 0x00, 0x28, 0x00, 0x34, 0x00, 0x42, 0x00, 0x4e, 0x00, 0x5e, 0x00,
+  0x6a, 0x00, 0x7b, 0x00, 0x8b, 0x00, 0x97, 0x00, 0xa7, 0x00, 0xb0, 0x00,
+  0xc0, 0x00, 0xc9, 0x00, 0xd2, 0x00, 0xe2, 0x00, 0xf0, 0x00, 0x00, 0x01,
+  0x0c, 0x01, 0x1c, 0x01, 0x00, 0x00, 0x10, 0x00, 0x20, 0x00, 0x33, 0x00,
+  0x44, 0x00, 0x4e, 0x00, 0x5f, 0x00, 0x6a, 0x00, 0x73, 0x00, 0x83, 0x00,
+  0x8c, 0x00, 0x95, 0x00, 0xa5, 0x00, 0xb4, 0x00, 0xc4, 0x00, 0xd4, 0x00,
+  0x00, 0x00, 0x0b, 0x00, 0x16, 0x00, 0x21, 0x00, 0x2d, 0x00, 0x3c, 0x00,
+  0x48, 0x00, 0x52, 0x00, 0x5d, 0x00, 0x68, 0x00, 0x76, 0x00, 0x80, 0x00,
+  0x89, 0x00, 0x93, 0x00, 0x9d, 0x00, 0xae, 0x00, 0xc0, 0x00, 0xc9, 0x00,
+  0xda, 0x00, 0xe4, 0x00, 0xee, 0x00, 0xfa, 0x00, 0x08, 0x01, 0x13, 0x01,
+  0x1d, 0x01, 0x27, 0x01, 0x33, 0x01, 0x41, 0x01, 0x52, 0x01, 0x5e, 0x01,
+  0x69, 0x01, 0x7b, 0x01, 0x00, 0x00, 0x18, 0x00, 0x2a, 0x00, 0x3c, 0x00,
+  0x4f, 0x00, 0x62, 0x00, 0x6e, 0x00, 0x78, 0x00, 0x87, 0x00, 0x92, 0x00,
+  0xa0, 0x00, 0xad, 0x00, 0xba, 0x00, 0xc6, 0x00, 0xd2, 0x00, 0xde, 0x00,
+  0xe8, 0x00, 0xf6, 0x00, 0x00, 0x01, 0x0a, 0x01, 0x1c, 0x01, 0x25, 0x01,
+  0x31, 0x01, 0x3a, 0x01, 0x4c, 0x01, 0x55, 0x01, 0x5f, 0x01, 0x6b, 0x01,
+  0x76, 0x01, 0x80, 0x01, 0x00, 0x00, 0x18, 0x00, 0x34, 0x00, 0x3f, 0x00,
+  0x4b, 0x00, 0x57, 0x00, 0x66, 0x00, 0x72, 0x00, 0x80, 0x00, 0x8e, 0x00,
+  0x9a, 0x00, 0xa8, 0x00, 0xb4, 0x00, 0xc0, 0x00, 0xcc, 0x00, 0xd8, 0x00,
+  0xe4, 0x00, 0xf0, 0x00, 0xf9, 0x00, 0x05, 0x01, 0x11, 0x01, 0x1f, 0x01,
+  0x2b, 0x01, 0x37, 0x01, 0x44, 0x01, 0x4d, 0x01, 0x56, 0x01, 0x63, 0x01,
+  0x71, 0x01, 0x7d, 0x01, 0x89, 0x01, 0x95, 0x01, 0xa1, 0x01, 0xa9, 0x01,
+  0xb5, 0x01, 0xc1, 0x01, 0x00, 0x00, 0x2a, 0x00, 0x4d, 0x00, 0x59, 0x00,
+  0x6d, 0x00, 0x79, 0x00, 0x85, 0x00, 0x8f, 0x00, 0x9b, 0x00, 0xa6, 0x00,
+  0xb5, 0x00, 0xc1, 0x00, 0xcd, 0x00, 0xd9, 0x00, 0xe5, 0x00, 0xf1, 0x00,
+  0xfc, 0x00, 0x07, 0x01, 0x13, 0x01, 0x1f, 0x01, 0x2f, 0x01, 0x43, 0x01,
+  0x4f, 0x01, 0x59, 0x01, 0x65, 0x01, 0x75, 0x01, 0x81, 0x01, 0x95, 0x01,
+  0xa2, 0x01, 0xae, 0x01, 0xba, 0x01, 0xca, 0x01, 0xd5, 0x01, 0xe3, 0x01,
+  0xf1, 0x01, 0xfd, 0x01, 0x08, 0x02, 0x14, 0x02, 0x21, 0x02, 0x2d, 0x02,
+  0x40, 0x02, 0x4b, 0x02, 0x54, 0x02, 0x60, 0x02, 0x6a, 0x02, 0x7a, 0x02,
+  0x88, 0x02, 0x99, 0x02, 0xa7, 0x02, 0xb1, 0x02, 0xc1, 0x02, 0xcd, 0x02,
+  0xdb, 0x02, 0xe7, 0x02, 0xf2, 0x02, 0x00, 0x03, 0x00, 0x00, 0x18, 0x00,
+  0x27, 0x00, 0x35, 0x00, 0x41, 0x00, 0x4f, 0x00, 0x5d, 0x00, 0x6b, 0x00,
+  0x79, 0x00, 0x8a, 0x00, 0x95, 0x00, 0xa1, 0x00, 0xb0, 0x00, 0xbe, 0x00,
+  0xc9, 0x00, 0xd7, 0x00, 0xe5, 0x00, 0xf1, 0x00, 0xfd, 0x00, 0x0b, 0x01,
+  0x19, 0x01, 0x27, 0x01, 0x35, 0x01, 0x41, 0x01, 0x4b, 0x01, 0x59, 0x01,
+  0x62, 0x01, 0x70, 0x01, 0x7c, 0x01, 0x8b, 0x01, 0x99, 0x01, 0xa3, 0x01,
+  0xb0, 0x01, 0xbb, 0x01, 0xc6, 0x01, 0xd1, 0x01, 0xdf, 0x01, 0xea, 0x01,
+  0xf8, 0x01, 0x05, 0x02, 0x13, 0x02, 0x1e, 0x02, 0x2c, 0x02, 0x36, 0x02,
+  0x40, 0x02, 0x4e, 0x02, 0x5c, 0x02, 0x00, 0x00, 0x18, 0x00, 0x24, 0x00,
+  0x36, 0x00, 0x42, 0x00, 0x50, 0x00, 0x5c, 0x00, 0x68, 0x00, 0x77, 0x00,
+  0x83, 0x00, 0x8f, 0x00, 0x9b, 0x00, 0xaa, 0x00, 0xb4, 0x00, 0xcd, 0x00,
+  0xdc, 0x00, 0xf2, 0x00, 0x00, 0x01, 0x0c, 0x01, 0x1e, 0x01, 0x2c, 0x01,
+  0x35, 0x01, 0x41, 0x01, 0x4d, 0x01, 0x59, 0x01, 0x65, 0x01, 0x6e, 0x01,
+  0x7d, 0x01, 0x8c, 0x01, 0x98, 0x01, 0xa4, 0x01, 0xb0, 0x01, 0xbf, 0x01,
+  0xd1, 0x01, 0xdd, 0x01, 0xeb, 0x01, 0x01, 0x02, 0x0d, 0x02, 0x19, 0x02,
+  0x25, 0x02, 0x2e, 0x02, 0x3d, 0x02, 0x47, 0x02, 0x55, 0x02, 0x63, 0x02,
+  0x6f, 0x02, 0x7a, 0x02, 0x86, 0x02, 0x92, 0x02, 0x9b, 0x02, 0xaa, 0x02,
+  0xb4, 0x02, 0x00, 0x00, 0x1f, 0x00, 0x2d, 0x00, 0x3a, 0x00, 0x45, 0x00,
+  0x51, 0x00, 0x5c, 0x00, 0x68, 0x00, 0x73, 0x00, 0x7e, 0x00, 0x8f, 0x00,
+  0x9d, 0x00, 0xa9, 0x00, 0xb7, 0x00, 0xc3, 0x00, 0xcf, 0x00, 0xdb, 0x00,
+  0xe6, 0x00, 0xf1, 0x00, 0xfd, 0x00, 0x08, 0x01, 0x13, 0x01, 0x25, 0x01,
+  0x33, 0x01, 0x3f, 0x01, 0x4a, 0x01, 0x56, 0x01, 0x62, 0x01, 0x70, 0x01,
+  0x7c, 0x01, 0x8d, 0x01, 0x99, 0x01, 0xa6, 0x01, 0xb1, 0x01, 0xbd, 0x01,
+  0xc8, 0x01, 0xd4, 0x01, 0xe5, 0x01, 0xf6, 0x01, 0x02, 0x02, 0x0d, 0x02,
+  0x1d, 0x02, 0x29, 0x02, 0x35, 0x02, 0x41, 0x02, 0x51, 0x02, 0x62, 0x02,
+  0x6f, 0x02, 0x7c, 0x02, 0x88, 0x02, 0x94, 0x02, 0xa0, 0x02, 0xab, 0x02,
+  0xb7, 0x02, 0xc9, 0x02, 0xd4, 0x02, 0xdf, 0x02, 0xef, 0x02, 0xfb, 0x02,
+  0x0b, 0x03, 0x17, 0x03, 0x29, 0x03, 0x35, 0x03, 0x41, 0x03, 0x00, 0x00,
+  0x2f, 0x00, 0x40, 0x00, 0x4e, 0x00, 0x5a, 0x00, 0x6f, 0x00, 0x7d, 0x00,
+  0x89, 0x00, 0x97, 0x00, 0xa5, 0x00, 0xb3, 0x00, 0xc0, 0x00, 0xcc, 0x00,
+  0xd8, 0x00, 0xe3, 0x00, 0xf2, 0x00, 0xff, 0x00, 0x0d, 0x01, 0x19, 0x01,
+  0x27, 0x01, 0x3b, 0x01, 0x4a, 0x01, 0x58, 0x01, 0x65, 0x01, 0x71, 0x01,
+  0x80, 0x01, 0x8e, 0x01, 0x99, 0x01, 0xa5, 0x01, 0xb1, 0x01, 0xc5, 0x01,
+  0xd3, 0x01, 0xe1, 0x01, 0xeb, 0x01, 0xf6, 0x01, 0x04, 0x02, 0x15, 0x02,
+  0x21, 0x02, 0x2d, 0x02, 0x3d, 0x02, 0x4e, 0x02, 0x5d, 0x02, 0x69, 0x02,
+  0x75, 0x02, 0x81, 0x02, 0x8d, 0x02, 0x9b, 0x02, 0xa8, 0x02, 0xb6, 0x02,
+  0xc7, 0x02, 0xd7, 0x02, 0xe3, 0x02, 0xee, 0x02, 0xfc, 0x02, 0x09, 0x03,
+  0x18, 0x03, 0x00, 0x00, 0x1b, 0x00, 0x29, 0x00, 0x3d, 0x00, 0x4b, 0x00,
+  0x57, 0x00, 0x63, 0x00, 0x71, 0x00, 0x7f, 0x00, 0x8d, 0x00, 0x9e, 0x00,
+  0xac, 0x00, 0xba, 0x00, 0xc9, 0x00, 0xd9, 0x00, 0xe7, 0x00, 0xfb, 0x00,
+  0x0b, 0x01, 0x19, 0x01, 0x25, 0x01, 0x39, 0x01, 0x45, 0x01, 0x53, 0x01,
+  0x5f, 0x01, 0x6d, 0x01, 0x7b, 0x01, 0x89, 0x01, 0x96, 0x01, 0xa4, 0x01,
+  0xb2, 0x01, 0xbe, 0x01, 0xca, 0x01, 0xd5, 0x01, 0xdf, 0x01, 0xed, 0x01,
+  0xfb, 0x01, 0x06, 0x02, 0x17, 0x02, 0x25, 0x02, 0x2f, 0x02, 0x3e, 0x02,
+  0x48, 0x02, 0x56, 0x02, 0x62, 0x02, 0x6d, 0x02, 0x78, 0x02, 0x84, 0x02,
+  0x92, 0x02, 0xa6, 0x02, 0xb5, 0x02, 0xc3, 0x02, 0xd1, 0x02, 0xdf, 0x02,
+  0xed, 0x02, 0xf9, 0x02, 0x05, 0x03, 0x11, 0x03, 0x1d, 0x03, 0x2b, 0x03,
+  0x36, 0x03, 0x41, 0x03, 0x4f, 0x03, 0x5b, 0x03, 0x66, 0x03, 0x70, 0x03,
+  0x7a, 0x03, 0x85, 0x03, 0x8f, 0x03, 0x99, 0x03, 0xa7, 0x03, 0xb2, 0x03,
+  0xbe, 0x03, 0xc9, 0x03, 0xd5, 0x03, 0xe1, 0x03, 0xef, 0x03, 0xf9, 0x03,
+  0x03, 0x04, 0x0d, 0x04, 0x1c, 0x04, 0x26, 0x04, 0x30, 0x04, 0x3a, 0x04,
+  0x47, 0x04, 0x00, 0x00, 0x1f, 0x00, 0x2d, 0x00, 0x3c, 0x00, 0x48, 0x00,
+  0x54, 0x00, 0x5f, 0x00, 0x6b, 0x00, 0x75, 0x00, 0x81, 0x00, 0x8d, 0x00,
+  0x97, 0x00, 0xa2, 0x00, 0xb2, 0x00, 0xc2, 0x00, 0xd0, 0x00, 0xdc, 0x00,
+  0xe8, 0x00, 0xf6, 0x00, 0x04, 0x01, 0x10, 0x01, 0x1e, 0x01, 0x31, 0x01,
+  0x3d, 0x01, 0x4a, 0x01, 0x56, 0x01, 0x62, 0x01, 0x6e, 0x01, 0x80, 0x01,
+  0x91, 0x01, 0xa2, 0x01, 0xb2, 0x01, 0xc8, 0x01, 0xd2, 0x01, 0xe0, 0x01,
+  0xf1, 0x01, 0xfd, 0x01, 0x0e, 0x02, 0x21, 0x02, 0x31, 0x02, 0x3e, 0x02,
+  0x4a, 0x02, 0x56, 0x02, 0x64, 0x02, 0x7a, 0x02, 0x8c, 0x02, 0x98, 0x02,
+  0xa8, 0x02, 0xb4, 0x02, 0xc4, 0x02, 0xd2, 0x02, 0xde, 0x02, 0xe9, 0x02,
+  0xf7, 0x02, 0x00, 0x00, 0x11, 0x00, 0x23, 0x00, 0x32, 0x00, 0x40, 0x00,
+  0x4c, 0x00, 0x5d, 0x00, 0x69, 0x00, 0x75, 0x00, 0x88, 0x00, 0x96, 0x00,
+  0xa4, 0x00, 0xb5, 0x00, 0xc3, 0x00, 0xd4, 0x00, 0xe1, 0x00, 0xf0, 0x00,
+  0x00, 0x01, 0x0d, 0x01, 0x19, 0x01, 0x2f, 0x01, 0x3c, 0x01, 0x4c, 0x01,
+  0x58, 0x01, 0x64, 0x01, 0x70, 0x01, 0x83, 0x01, 0x95, 0x01, 0xa3, 0x01,
+  0xb8, 0x01, 0xc5, 0x01, 0xd3, 0x01, 0xe5, 0x01, 0xf2, 0x01, 0x0a, 0x02,
+  0x18, 0x02, 0x29, 0x02, 0x37, 0x02, 0x45, 0x02, 0x51, 0x02, 0x00, 0x00,
+  0x1f, 0x00, 0x29, 0x00, 0x35, 0x00, 0x41, 0x00, 0x4f, 0x00, 0x5b, 0x00,
+  0x69, 0x00, 0x77, 0x00, 0x86, 0x00, 0x91, 0x00, 0xa2, 0x00, 0xb1, 0x00,
+  0xc3, 0x00, 0xd3, 0x00, 0xdf, 0x00, 0xed, 0x00, 0xfb, 0x00, 0x0e, 0x01,
+  0x1a, 0x01, 0x28, 0x01, 0x34, 0x01, 0x42, 0x01, 0x52, 0x01, 0x60, 0x01,
+  0x6d, 0x01, 0x77, 0x01, 0x8a, 0x01, 0x9c, 0x01, 0xaa, 0x01, 0xb8, 0x01,
+  0xcb, 0x01, 0xd7, 0x01, 0xe1, 0x01, 0xed, 0x01, 0xfe, 0x01, 0x0a, 0x02,
+  0x15, 0x02, 0x29, 0x02, 0x37, 0x02, 0x49, 0x02, 0x57, 0x02, 0x61, 0x02,
+  0x6f, 0x02, 0x7b, 0x02, 0x89, 0x02, 0x92, 0x02, 0xa4, 0x02, 0x00, 0x00,
+  0x1f, 0x00, 0x34, 0x00, 0x3e, 0x00, 0x4b, 0x00, 0x59, 0x00, 0x69, 0x00,
+  0x74, 0x00, 0x82, 0x00, 0x8d, 0x00, 0x9b, 0x00, 0xb2, 0x00, 0xc0, 0x00,
+  0xcd, 0x00, 0xd9, 0x00, 0xe3, 0x00, 0xf1, 0x00, 0xff, 0x00, 0x19, 0x01,
+  0x2a, 0x01, 0x34, 0x01, 0x42, 0x01, 0x50, 0x01, 0x5e, 0x01, 0x6c, 0x01,
+  0x7a, 0x01, 0x88, 0x01, 0x93, 0x01, 0xa1, 0x01, 0xaf, 0x01, 0xc1, 0x01,
+  0xcf, 0x01, 0xdb, 0x01, 0xe9, 0x01, 0xf3, 0x01, 0xfd, 0x01, 0x0b, 0x02,
+  0x19, 0x02, 0x25, 0x02, 0x34, 0x02, 0x4b, 0x02, 0x57, 0x02, 0x61, 0x02,
+  0x6f, 0x02, 0x7c, 0x02, 0x86, 0x02, 0x94, 0x02, 0x9e, 0x02, 0xa8, 0x02,
+  0xb6, 0x02, 0xc4, 0x02, 0xcf, 0x02, 0x00, 0x00, 0x0c, 0x00, 0x21, 0x00,
+  0x31, 0x00, 0x3d, 0x00, 0x4e, 0x00, 0x58, 0x00, 0x65, 0x00, 0x6f, 0x00,
+  0x80, 0x00, 0x96, 0x00, 0xa3, 0x00, 0xb2, 0x00, 0xbc, 0x00, 0xc6, 0x00,
+  0xd0, 0x00, 0xe0, 0x00, 0xea, 0x00, 0xf8, 0x00, 0x09, 0x01, 0x17, 0x01,
+  0x23, 0x01, 0x30, 0x01, 0x3a, 0x01, 0x47, 0x01, 0x53, 0x01, 0x61, 0x01,
+  0x6a, 0x01, 0x75, 0x01, 0x00, 0x00, 0x0e, 0x00, 0x1c, 0x00, 0x28, 0x00,
+  0x34, 0x00, 0x42, 0x00, 0x4f, 0x00, 0x5b, 0x00, 0x68, 0x00, 0x76, 0x00,
+  0x84, 0x00, 0x92, 0x00, 0xa0, 0x00, 0xac, 0x00, 0xb8, 0x00, 0xc6, 0x00,
+  0xdb, 0x00, 0xe7, 0x00, 0xf7, 0x00, 0x07, 0x01, 0x15, 0x01, 0x26, 0x01,
+  0x32, 0x01, 0x47, 0x01, 0x53, 0x01, 0x5f, 0x01, 0x6d, 0x01, 0x7b, 0x01,
+  0x87, 0x01, 0x93, 0x01, 0xa3, 0x01, 0xaf, 0x01, 0xb8, 0x01, 0xc6, 0x01,
+  0xd6, 0x01, 0xe4, 0x01, 0xf0, 0x01, 0xfe, 0x01, 0x0a, 0x02, 0x16, 0x02,
+  0x22, 0x02, 0x2f, 0x02, 0x3b, 0x02, 0x4b, 0x02, 0x59, 0x02, 0x65, 0x02,
+  0x71, 0x02, 0x82, 0x02, 0x8e, 0x02, 0x9a, 0x02, 0xa6, 0x02, 0xb2, 0x02,
+  0xbe, 0x02, 0xca, 0x02, 0xd6, 0x02, 0xe4, 0x02, 0xf2, 0x02, 0xfe, 0x02,
+  0x0a, 0x03, 0x18, 0x03, 0x24, 0x03, 0x30, 0x03, 0x3c, 0x03, 0x48, 0x03,
+  0x58, 0x03, 0x64, 0x03, 0x00, 0x00, 0x12, 0x00, 0x1c, 0x00, 0x2f, 0x00,
+  0x3c, 0x00, 0x4c, 0x00, 0x5e, 0x00, 0x69, 0x00, 0x75, 0x00, 0x83, 0x00,
+  0x91, 0x00, 0xa1, 0x00, 0xae, 0x00, 0xc1, 0x00, 0xcc, 0x00, 0xd8, 0x00,
+  0xe1, 0x00, 0xee, 0x00, 0xfe, 0x00, 0x0a, 0x01, 0x1a, 0x01, 0x28, 0x01,
+  0x36, 0x01, 0x3f, 0x01, 0x4d, 0x01, 0x62, 0x01, 0x6f, 0x01, 0x7f, 0x01,
+  0x8b, 0x01, 0x9b, 0x01, 0xa6, 0x01, 0xb4, 0x01, 0xc2, 0x01, 0xd2, 0x01,
+  0xe1, 0x01, 0xeb, 0x01, 0xf8, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x20, 0x00,
+  0x2c, 0x00, 0x3a, 0x00, 0x46, 0x00, 0x57, 0x00, 0x66, 0x00, 0x76, 0x00,
+  0x84, 0x00, 0x96, 0x00, 0xa2, 0x00, 0xad, 0x00, 0xbf, 0x00, 0xcf, 0x00,
+  0xdd, 0x00, 0xe9, 0x00, 0xf7, 0x00, 0x03, 0x01, 0x0f, 0x01, 0x19, 0x01,
+  0x27, 0x01, 0x35, 0x01, 0x4b, 0x01, 0x55, 0x01, 0x64, 0x01, 0x76, 0x01,
+  0x82, 0x01, 0x8d, 0x01, 0x99, 0x01, 0xa3, 0x01, 0xb2, 0x01, 0xbe, 0x01,
+  0xca, 0x01, 0xd6, 0x01, 0xe8, 0x01, 0x00, 0x00, 0x12, 0x00, 0x20, 0x00,
+  0x33, 0x00, 0x41, 0x00, 0x4d, 0x00, 0x57, 0x00, 0x62, 0x00, 0x6c, 0x00,
+  0x7e, 0x00, 0x88, 0x00, 0x93, 0x00, 0x9d, 0x00, 0xa7, 0x00, 0xb5, 0x00,
+  0xc7, 0x00, 0xd3, 0x00, 0xe5, 0x00, 0xf3, 0x00, 0xff, 0x00, 0x0a, 0x01,
+  0x16, 0x01, 0x28, 0x01, 0x32, 0x01, 0x3f, 0x01, 0x4b, 0x01, 0x56, 0x01,
+  0x60, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x17, 0x00, 0x22, 0x00, 0x2f, 0x00,
+  0x3f, 0x00, 0x53, 0x00, 0x5f, 0x00, 0x6c, 0x00, 0x7c, 0x00, 0x88, 0x00,
+  0x98, 0x00, 0xa6, 0x00, 0xb2, 0x00, 0xc3, 0x00, 0xd3, 0x00, 0xe2, 0x00,
+  0xef, 0x00, 0xfb, 0x00, 0x06, 0x01, 0x11, 0x01, 0x1c, 0x01, 0x2a, 0x01,
+  0x36, 0x01, 0x43, 0x01, 0x00, 0x00, 0x10, 0x00, 0x1c, 0x00, 0x26, 0x00,
+  0x3a, 0x00, 0x47, 0x00, 0x5c, 0x00, 0x6a, 0x00, 0x79, 0x00, 0x85, 0x00,
+  0x91, 0x00, 0xa1, 0x00, 0xae, 0x00, 0xba, 0x00, 0xc4, 0x00, 0xce, 0x00,
+  0xdc, 0x00, 0xe7, 0x00, 0xf1, 0x00, 0x01, 0x01, 0x11, 0x01, 0x1e, 0x01,
+  0x2f, 0x01, 0x3c, 0x01, 0x4a, 0x01, 0x56, 0x01, 0x62, 0x01, 0x72, 0x01,
+  0x80, 0x01, 0x8e, 0x01, 0x9e, 0x01, 0xaa, 0x01, 0xba, 0x01, 0xca, 0x01,
+  0xd6, 0x01, 0xe2, 0x01, 0xee, 0x01, 0xf9, 0x01, 0x00, 0x00, 0x0e, 0x00,
+  0x1c, 0x00, 0x2a, 0x00, 0x38, 0x00, 0x46, 0x00, 0x56, 0x00, 0x64, 0x00,
+  0x72, 0x00, 0x84, 0x00, 0x92, 0x00, 0xa0, 0x00, 0xae, 0x00, 0xbc, 0x00,
+  0xd4, 0x00, 0xdd, 0x00, 0xed, 0x00, 0x05, 0x01, 0x13, 0x01, 0x21, 0x01,
+  0x2d, 0x01, 0x3b, 0x01, 0x49, 0x01, 0x53, 0x01, 0x5f, 0x01, 0x6e, 0x01,
+  0x7c, 0x01, 0x88, 0x01, 0x98, 0x01, 0xaa, 0x01, 0xba, 0x01, 0xc7, 0x01,
+  0xd5, 0x01, 0xe5, 0x01, 0xf4, 0x01, 0x04, 0x02, 0x10, 0x02, 0x1c, 0x02,
+  0x00, 0x00, 0x16, 0x00, 0x22, 0x00, 0x30, 0x00, 0x40, 0x00, 0x59, 0x00,
+  0x6f, 0x00, 0x7b, 0x00, 0x91, 0x00, 0x9f, 0x00, 0xab, 0x00, 0xbd, 0x00,
+  0xce, 0x00, 0xde, 0x00, 0xee, 0x00, 0xff, 0x00, 0x0b, 0x01, 0x21, 0x01,
+  0x30, 0x01, 0x3c, 0x01, 0x4f, 0x01, 0x61, 0x01, 0x77, 0x01, 0x8c, 0x01,
+  0x00, 0x00, 0x10, 0x00, 0x22, 0x00, 0x2d, 0x00, 0x38, 0x00, 0x48, 0x00,
+  0x57, 0x00, 0x69, 0x00, 0x74, 0x00, 0x7f, 0x00, 0x91, 0x00, 0x9c, 0x00,
+  0xa7, 0x00, 0xb9, 0x00, 0xcb, 0x00, 0xd9, 0x00, 0xe5, 0x00, 0xf0, 0x00,
+  0xfb, 0x00, 0x0b, 0x01, 0x16, 0x01, 0x28, 0x01, 0x33, 0x01, 0x43, 0x01,
+  0x50, 0x01, 0x60, 0x01, 0x6b, 0x01, 0x76, 0x01, 0x81, 0x01, 0x8f, 0x01,
+  0xa1, 0x01, 0xad, 0x01, 0xbb, 0x01, 0xc7, 0x01, 0xd9, 0x01, 0xe4, 0x01,
+  0xf4, 0x01, 0x06, 0x02, 0x16, 0x02, 0x24, 0x02, 0x2f, 0x02, 0x3b, 0x02,
+  0x4b, 0x02, 0x00, 0x00, 0x0b, 0x00, 0x25, 0x00, 0x3d, 0x00, 0x4d, 0x00,
+  0x59, 0x00, 0x6a, 0x00, 0x75, 0x00, 0x81, 0x00, 0x8d, 0x00, 0xa2, 0x00,
+  0xae, 0x00, 0xbc, 0x00, 0xd5, 0x00, 0xe3, 0x00, 0xef, 0x00, 0x01, 0x01,
+  0x15, 0x01, 0x25, 0x01, 0x2f, 0x01, 0x3a, 0x01, 0x46, 0x01, 0x00, 0x00,
+  0x0e, 0x00, 0x1c, 0x00, 0x2a, 0x00, 0x34, 0x00, 0x43, 0x00, 0x51, 0x00,
+  0x5f, 0x00, 0x6b, 0x00, 0x77, 0x00, 0x85, 0x00, 0x93, 0x00, 0xa2, 0x00,
+  0xb4, 0x00, 0xc3, 0x00, 0xd5, 0x00, 0xe0, 0x00, 0xee, 0x00, 0xfd, 0x00,
+  0x0d, 0x01, 0x17, 0x01, 0x25, 0x01, 0x33, 0x01, 0x41, 0x01, 0x4f, 0x01,
+  0x5d, 0x01, 0x6b, 0x01, 0x79, 0x01, 0x85, 0x01, 0x91, 0x01, 0x9b, 0x01,
+  0xa3, 0x01, 0xb3, 0x01, 0xbf, 0x01, 0xc7, 0x01, 0xd7, 0x01, 0xe3, 0x01,
+  0x00, 0x00, 0x11, 0x00, 0x1d, 0x00, 0x29, 0x00, 0x37, 0x00, 0x45, 0x00,
+  0x53, 0x00, 0x65, 0x00, 0x73, 0x00, 0x82, 0x00, 0x00, 0x00, 0x0a, 0x00,
+  0x18, 0x00, 0x26, 0x00, 0x32, 0x00, 0x45, 0x00, 0x55, 0x00, 0x65, 0x00,
+  0x79, 0x00, 0x8a, 0x00, 0x96, 0x00, 0xa2, 0x00, 0xb3, 0x00, 0xc4, 0x00,
+  0xd2, 0x00, 0xe2, 0x00, 0xee, 0x00, 0xfc, 0x00, 0x08, 0x01, 0x19, 0x01,
+  0x26, 0x01, 0x00, 0x00, 0x11, 0x00, 0x1c, 0x00, 0x27, 0x00, 0x33, 0x00,
+  0x40, 0x00, 0x53, 0x00, 0x65, 0x00, 0x77, 0x00, 0x83, 0x00, 0x90, 0x00,
+  0x00, 0x00, 0x14, 0x00, 0x1f, 0x00, 0x33, 0x00, 0x42, 0x00, 0x55, 0x00,
+  0x63, 0x00, 0x77, 0x00, 0x85, 0x00, 0x94, 0x00, 0x9f, 0x00, 0xb3, 0x00,
+  0xc1, 0x00, 0xcb, 0x00, 0xd5, 0x00, 0xe7, 0x00, 0xf2, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x19, 0x00, 0x25, 0x00, 0x32, 0x00, 0x3f, 0x00, 0x4c, 0x00,
+  0x67, 0x00, 0x74, 0x00, 0x82, 0x00, 0x92, 0x00, 0xa0, 0x00, 0xae, 0x00,
+  0xba, 0x00, 0xc8, 0x00, 0xd6, 0x00, 0xe2, 0x00, 0xf0, 0x00, 0xfd, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x1a, 0x00, 0x28, 0x00, 0x36, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x15, 0x00, 0x25, 0x00, 0x31, 0x00, 0x41, 0x00, 0x51, 0x00,
+  0x60, 0x00, 0x73, 0x00, 0x83, 0x00, 0x94, 0x00, 0xa4, 0x00, 0xaf, 0x00,
+  0xc0, 0x00, 0xcd, 0x00, 0xdc, 0x00, 0xec, 0x00, 0xfe, 0x00, 0x0a, 0x01,
+  0x1a, 0x01, 0x2a, 0x01, 0x33, 0x01, 0x43, 0x01, 0x53, 0x01, 0x5f, 0x01,
+  0x6f, 0x01, 0x78, 0x01, 0x00, 0x00, 0x1a, 0x00, 0x25, 0x00, 0x2f, 0x00,
+  0x3a, 0x00, 0x44, 0x00, 0x4f, 0x00, 0x5d, 0x00, 0x68, 0x00, 0x73, 0x00,
+  0x85, 0x00, 0x98, 0x00, 0xa2, 0x00, 0xb0, 0x00, 0xbb, 0x00, 0xc5, 0x00,
+  0xd3, 0x00, 0xde, 0x00, 0xe8, 0x00, 0xf4, 0x00, 0xfe, 0x00, 0x0a, 0x01,
+  0x16, 0x01, 0x00, 0x00, 0x0a, 0x00, 0x1d, 0x00, 0x2f, 0x00, 0x3a, 0x00,
+  0x4c, 0x00, 0x6b, 0x00, 0x76, 0x00, 0x81, 0x00, 0x93, 0x00, 0xa6, 0x00,
+  0xb8, 0x00, 0xc0, 0x00, 0xd3, 0x00, 0xe0, 0x00, 0xeb, 0x00, 0xfd, 0x00,
+  0x0f, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x37, 0x01, 0x41, 0x01, 0x52, 0x01,
+  0x5c, 0x01, 0x6e, 0x01, 0x7a, 0x01, 0x84, 0x01, 0x00, 0x00, 0x0c, 0x00,
+  0x18, 0x00, 0x26, 0x00, 0x32, 0x00, 0x3d, 0x00, 0x49, 0x00, 0x55, 0x00,
+  0x61, 0x00, 0x6f, 0x00, 0x86, 0x00, 0x92, 0x00, 0x9e, 0x00, 0xac, 0x00,
+  0xbb, 0x00, 0xc9, 0x00, 0xd5, 0x00, 0xe5, 0x00, 0xf3, 0x00, 0xfe, 0x00,
+  0x0c, 0x01, 0x18, 0x01, 0x23, 0x01, 0x2f, 0x01, 0x3a, 0x01, 0x48, 0x01,
+  0x00, 0x00, 0x0e, 0x00, 0x19, 0x00, 0x25, 0x00, 0x31, 0x00, 0x43, 0x00,
+  0x4f, 0x00, 0x5d, 0x00, 0x69, 0x00, 0x77, 0x00, 0x85, 0x00, 0x91, 0x00,
+  0x9d, 0x00, 0xae, 0x00, 0xbe, 0x00, 0xca, 0x00, 0xd6, 0x00, 0xe2, 0x00,
+  0xf2, 0x00, 0x02, 0x01, 0x12, 0x01, 0x1e, 0x01, 0x2a, 0x01, 0x3a, 0x01,
+  0x46, 0x01, 0x56, 0x01, 0x66, 0x01, 0x7a, 0x01, 0x8a, 0x01, 0x9a, 0x01,
+  0xa8, 0x01, 0xbc, 0x01, 0xc7, 0x01, 0xd9, 0x01, 0xe5, 0x01, 0xf9, 0x01,
+  0x0d, 0x02, 0x1d, 0x02, 0x29, 0x02, 0x33, 0x02, 0x3c, 0x02, 0x48, 0x02,
+  0x00, 0x00, 0x0e, 0x00, 0x1c, 0x00, 0x27, 0x00, 0x35, 0x00, 0x43, 0x00,
+  0x52, 0x00, 0x61, 0x00, 0x6f, 0x00, 0x7d, 0x00, 0x89, 0x00, 0x97, 0x00,
+  0xa0, 0x00, 0xab, 0x00, 0xb7, 0x00, 0xc5, 0x00, 0xd3, 0x00, 0xdf, 0x00,
+  0xed, 0x00, 0xf9, 0x00, 0x05, 0x01, 0x13, 0x01, 0x28, 0x01, 0x33, 0x01,
+  0x3f, 0x01, 0x4d, 0x01, 0x58, 0x01, 0x6a, 0x01, 0x74, 0x01, 0x7f, 0x01,
+  0x89, 0x01, 0x97, 0x01, 0xa2, 0x01, 0xae, 0x01, 0xb9, 0x01, 0xca, 0x01,
+  0xdb, 0x01, 0xe5, 0x01, 0xf3, 0x01, 0xfd, 0x01, 0x0e, 0x02, 0x1d, 0x02,
+  0x2b, 0x02, 0x37, 0x02, 0x43, 0x02, 0x51, 0x02, 0x5b, 0x02, 0x69, 0x02,
+  0x77, 0x02, 0x88, 0x02, 0x93, 0x02, 0xa4, 0x02, 0xb0, 0x02, 0xbf, 0x02,
+  0xca, 0x02, 0xd8, 0x02, 0xe3, 0x02, 0xef, 0x02, 0x00, 0x00, 0x16, 0x00,
+  0x25, 0x00, 0x33, 0x00, 0x3f, 0x00, 0x4d, 0x00, 0x56, 0x00, 0x60, 0x00,
+  0x6b, 0x00, 0x74, 0x00, 0x80, 0x00, 0x8b, 0x00, 0x97, 0x00, 0xa3, 0x00,
+  0xae, 0x00, 0xc0, 0x00, 0xcb, 0x00, 0xdd, 0x00, 0xe9, 0x00, 0xf3, 0x00,
+  0x05, 0x01, 0x11, 0x01, 0x1d, 0x01, 0x28, 0x01, 0x33, 0x01, 0x3f, 0x01,
+  0x4a, 0x01, 0x54, 0x01, 0x5f, 0x01, 0x6b, 0x01, 0x75, 0x01, 0x81, 0x01,
+  0x8d, 0x01, 0x98, 0x01, 0xa4, 0x01, 0xb2, 0x01, 0xbc, 0x01, 0xc6, 0x01,
+  0xd2, 0x01, 0xdd, 0x01, 0xe7, 0x01, 0xf8, 0x01, 0x04, 0x02, 0x12, 0x02,
+  0x1c, 0x02, 0x26, 0x02, 0x32, 0x02, 0x3e, 0x02, 0x49, 0x02, 0x00, 0x00,
+  0x19, 0x00, 0x27, 0x00, 0x33, 0x00, 0x3e, 0x00, 0x4a, 0x00, 0x55, 0x00,
+  0x63, 0x00, 0x6f, 0x00, 0x7b, 0x00, 0x89, 0x00, 0x94, 0x00, 0x9f, 0x00,
+  0xac, 0x00, 0xb8, 0x00, 0xc6, 0x00, 0xd4, 0x00, 0xdf, 0x00, 0xeb, 0x00,
+  0xf7, 0x00, 0x02, 0x01, 0x0e, 0x01, 0x1b, 0x01, 0x27, 0x01, 0x39, 0x01,
+  0x46, 0x01, 0x56, 0x01, 0x62, 0x01, 0x6e, 0x01, 0x7c, 0x01, 0x87, 0x01,
+  0x93, 0x01, 0x9e, 0x01, 0xa9, 0x01, 0xb5, 0x01, 0xc1, 0x01, 0xd3, 0x01,
+  0xe2, 0x01, 0xee, 0x01, 0xfc, 0x01, 0x07, 0x02, 0x12, 0x02, 0x1e, 0x02,
+  0x2a, 0x02, 0x36, 0x02, 0x47, 0x02, 0x55, 0x02, 0x00, 0x00, 0x0f, 0x00,
+  0x1b, 0x00, 0x27, 0x00, 0x33, 0x00, 0x42, 0x00, 0x50, 0x00, 0x5b, 0x00,
+  0x67, 0x00, 0x73, 0x00, 0x7f, 0x00, 0x8a, 0x00, 0x9b, 0x00, 0xa7, 0x00,
+  0xb2, 0x00, 0xc2, 0x00, 0xce, 0x00, 0xe2, 0x00, 0xf0, 0x00, 0x05, 0x01,
+  0x13, 0x01, 0x1f, 0x01, 0x2b, 0x01, 0x39, 0x01, 0x44, 0x01, 0x52, 0x01,
+  0x5e, 0x01, 0x68, 0x01, 0x7c, 0x01, 0x8f, 0x01, 0xa3, 0x01, 0xac, 0x01,
+  0xbd, 0x01, 0xc9, 0x01, 0xd3, 0x01, 0xde, 0x01, 0xea, 0x01, 0xfe, 0x01,
+  0x0c, 0x02, 0x1a, 0x02, 0x00, 0x00, 0x0e, 0x00, 0x1c, 0x00, 0x2b, 0x00,
+  0x39, 0x00, 0x47, 0x00, 0x55, 0x00, 0x64, 0x00, 0x72, 0x00, 0x81, 0x00,
+  0x8f, 0x00, 0xa9, 0x00, 0xb8, 0x00, 0xc4, 0x00, 0xd2, 0x00, 0xe0, 0x00,
+  0xee, 0x00, 0xfd, 0x00, 0x0d, 0x01, 0x27, 0x01, 0x35, 0x01, 0x44, 0x01,
+  0x5c, 0x01, 0x6a, 0x01, 0x78, 0x01, 0x86, 0x01, 0x94, 0x01, 0xa0, 0x01,
+  0xba, 0x01, 0xc6, 0x01, 0xd5, 0x01, 0xe3, 0x01, 0xef, 0x01, 0xfd, 0x01,
+  0x12, 0x02, 0x21, 0x02, 0x2d, 0x02, 0x39, 0x02, 0x47, 0x02, 0x56, 0x02,
+  0x62, 0x02, 0x70, 0x02, 0x7c, 0x02, 0x00, 0x00, 0x0e, 0x00, 0x1a, 0x00,
+  0x2c, 0x00, 0x3c, 0x00, 0x57, 0x00, 0x65, 0x00, 0x73, 0x00, 0x7f, 0x00,
+  0x8b, 0x00, 0x9c, 0x00, 0xaa, 0x00, 0xb6, 0x00, 0xc2, 0x00, 0xcb, 0x00,
+  0xd6, 0x00, 0xe2, 0x00, 0xee, 0x00, 0xfc, 0x00, 0x0a, 0x01, 0x18, 0x01,
+  0x24, 0x01, 0x30, 0x01, 0x3c, 0x01, 0x51, 0x01, 0x6a, 0x01, 0x78, 0x01,
+  0x86, 0x01, 0x92, 0x01, 0xa3, 0x01, 0xaf, 0x01, 0xbe, 0x01, 0xcc, 0x01,
+  0xdc, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x20, 0x00, 0x31, 0x00, 0x48, 0x00,
+  0x58, 0x00, 0x64, 0x00, 0x74, 0x00, 0x81, 0x00, 0x93, 0x00, 0x9f, 0x00,
+  0xb1, 0x00, 0xc1, 0x00, 0xcd, 0x00, 0xde, 0x00, 0xea, 0x00, 0xf6, 0x00,
+  0x04, 0x01, 0x10, 0x01, 0x1c, 0x01, 0x2a, 0x01, 0x3a, 0x01, 0x46, 0x01,
+  0x4f, 0x01, 0x5b, 0x01, 0x67, 0x01, 0x79, 0x01, 0x82, 0x01, 0x8e, 0x01,
+  0x9a, 0x01, 0xa6, 0x01, 0xb2, 0x01, 0x00, 0x00, 0x0f, 0x00, 0x1b, 0x00,
+  0x27, 0x00, 0x33, 0x00, 0x3f, 0x00, 0x4d, 0x00, 0x58, 0x00, 0x66, 0x00,
+  0x74, 0x00, 0x85, 0x00, 0x93, 0x00, 0x9f, 0x00, 0xaa, 0x00, 0xb9, 0x00,
+  0xd1, 0x00, 0xe0, 0x00, 0xee, 0x00, 0xfe, 0x00, 0x0f, 0x01, 0x1b, 0x01,
+  0x2a, 0x01, 0x3c, 0x01, 0x4d, 0x01, 0x5e, 0x01, 0x70, 0x01, 0x81, 0x01,
+  0x91, 0x01, 0xa2, 0x01, 0x00, 0x00, 0x0e, 0x00, 0x22, 0x00, 0x2f, 0x00,
+  0x3d, 0x00, 0x4c, 0x00, 0x58, 0x00, 0x64, 0x00, 0x72, 0x00, 0x7e, 0x00,
+  0x8c, 0x00, 0x9a, 0x00, 0xa8, 0x00, 0xb4, 0x00, 0xc0, 0x00, 0xd2, 0x00,
+  0xde, 0x00, 0xea, 0x00, 0xf8, 0x00, 0x07, 0x01, 0x15, 0x01, 0x23, 0x01,
+  0x30, 0x01, 0x3e, 0x01, 0x4a, 0x01, 0x58, 0x01, 0x64, 0x01, 0x00, 0x00,
+  0x14, 0x00, 0x20, 0x00, 0x2e, 0x00, 0x3f, 0x00, 0x4f, 0x00, 0x5c, 0x00,
+  0x68, 0x00, 0x78, 0x00, 0x85, 0x00, 0x91, 0x00, 0x9d, 0x00, 0xab, 0x00,
+  0xb9, 0x00, 0xc5, 0x00, 0xd5, 0x00, 0xf2, 0x00, 0x00, 0x01, 0x0c, 0x01,
+  0x18, 0x01, 0x25, 0x01, 0x31, 0x01, 0x3e, 0x01, 0x4a, 0x01, 0x56, 0x01,
+  0x63, 0x01, 0x6f, 0x01, 0x7b, 0x01, 0x83, 0x01, 0x8d, 0x01, 0x99, 0x01,
+  0x00, 0x00, 0x15, 0x00, 0x23, 0x00, 0x39, 0x00, 0x45, 0x00, 0x51, 0x00,
+  0x5f, 0x00, 0x6b, 0x00, 0x79, 0x00, 0x85, 0x00, 0x91, 0x00, 0x9f, 0x00,
+  0xad, 0x00, 0xbb, 0x00, 0xc8, 0x00, 0xd4, 0x00, 0xe0, 0x00, 0xf7, 0x00,
+  0x05, 0x01, 0x11, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3c, 0x01, 0x4c, 0x01,
+  0x58, 0x01, 0x66, 0x01, 0x72, 0x01, 0x7e, 0x01, 0x8f, 0x01, 0x9d, 0x01,
+  0xa9, 0x01, 0xb7, 0x01, 0xc5, 0x01, 0xd5, 0x01, 0xe1, 0x01, 0xf4, 0x01,
+  0x02, 0x02, 0x0e, 0x02, 0x1c, 0x02, 0x28, 0x02, 0x36, 0x02, 0x43, 0x02,
+  0x51, 0x02, 0x5f, 0x02, 0x6b, 0x02, 0x79, 0x02, 0x87, 0x02, 0x93, 0x02,
+  0xa1, 0x02, 0x00, 0x00, 0x12, 0x00, 0x29, 0x00, 0x35, 0x00, 0x41, 0x00,
+  0x51, 0x00, 0x61, 0x00, 0x71, 0x00, 0x7d, 0x00, 0x8b, 0x00, 0x9e, 0x00,
+  0xb1, 0x00, 0xbc, 0x00, 0xd6, 0x00, 0xe0, 0x00, 0xe9, 0x00, 0xf9, 0x00,
+  0x03, 0x01, 0x0f, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x37, 0x01, 0x46, 0x01,
+  0x54, 0x01, 0x60, 0x01, 0x70, 0x01, 0x79, 0x01, 0x87, 0x01, 0x98, 0x01,
+  0x00, 0x00, 0x15, 0x00, 0x24, 0x00, 0x32, 0x00, 0x41, 0x00, 0x4d, 0x00,
+  0x59, 0x00, 0x67, 0x00, 0x75, 0x00, 0x81, 0x00, 0x8f, 0x00, 0x9d, 0x00,
+  0xab, 0x00, 0xba, 0x00, 0xc8, 0x00, 0xd3, 0x00, 0xdf, 0x00, 0xea, 0x00,
+  0xf6, 0x00, 0x02, 0x01, 0x10, 0x01, 0x1c, 0x01, 0x2b, 0x01, 0x38, 0x01,
+  0x43, 0x01, 0x51, 0x01, 0x5f, 0x01, 0x6c, 0x01, 0x7a, 0x01, 0x88, 0x01,
+  0x96, 0x01, 0xa1, 0x01, 0xab, 0x01, 0xb9, 0x01, 0xc3, 0x01, 0xd3, 0x01,
+  0x00, 0x00, 0x15, 0x00, 0x23, 0x00, 0x35, 0x00, 0x46, 0x00, 0x52, 0x00,
+  0x5e, 0x00, 0x69, 0x00, 0x7b, 0x00, 0x87, 0x00, 0x95, 0x00, 0xa7, 0x00,
+  0xb5, 0x00, 0xc1, 0x00, 0xcc, 0x00, 0xde, 0x00, 0xf0, 0x00, 0x02, 0x01,
+  0x10, 0x01, 0x1c, 0x01, 0x2e, 0x01, 0x38, 0x01, 0x44, 0x01, 0x56, 0x01,
+  0x60, 0x01, 0x69, 0x01, 0x75, 0x01, 0x82, 0x01, 0x93, 0x01, 0xa5, 0x01,
+  0xb3, 0x01, 0xc0, 0x01, 0xce, 0x01, 0xd9, 0x01, 0xec, 0x01, 0xfa, 0x01,
+  0x09, 0x02, 0x1e, 0x02, 0x31, 0x02, 0x00, 0x00, 0x16, 0x00, 0x32, 0x00,
+  0x4a, 0x00, 0x62, 0x00, 0x70, 0x00, 0x7e, 0x00, 0x8c, 0x00, 0x9b, 0x00,
+  0xac, 0x00, 0xb7, 0x00, 0xc3, 0x00, 0xd2, 0x00, 0xe3, 0x00, 0xef, 0x00,
+  0xfa, 0x00, 0x08, 0x01, 0x16, 0x01, 0x24, 0x01, 0x32, 0x01, 0x42, 0x01,
+  0x50, 0x01, 0x5e, 0x01, 0x6f, 0x01, 0x7c, 0x01, 0x88, 0x01, 0x96, 0x01,
+  0x00, 0x00, 0x16, 0x00, 0x27, 0x00, 0x31, 0x00, 0x3d, 0x00, 0x49, 0x00,
+  0x55, 0x00, 0x60, 0x00, 0x73, 0x00, 0x7e, 0x00, 0x8c, 0x00, 0x97, 0x00,
+  0xa3, 0x00, 0xba, 0x00, 0xc8, 0x00, 0xd4, 0x00, 0xe3, 0x00, 0xef, 0x00,
+  0xff, 0x00, 0x0f, 0x01, 0x1d, 0x01, 0x00, 0x00, 0x18, 0x00, 0x2d, 0x00,
+  0x3b, 0x00, 0x4b, 0x00, 0x59, 0x00, 0x6c, 0x00, 0x7a, 0x00, 0x87, 0x00,
+  0x95, 0x00, 0xa3, 0x00, 0xb1, 0x00, 0xbf, 0x00, 0xd0, 0x00, 0xda, 0x00,
+  0xe9, 0x00, 0xf5, 0x00, 0x03, 0x01, 0x12, 0x01, 0x23, 0x01, 0x33, 0x01,
+  0x41, 0x01, 0x4f, 0x01, 0x5a, 0x01, 0x6b, 0x01, 0x7a, 0x01, 0x8a, 0x01,
+  0x96, 0x01, 0xa5, 0x01, 0xb3, 0x01, 0xc4, 0x01, 0xd0, 0x01, 0xe2, 0x01,
+  0xf9, 0x01, 0x08, 0x02, 0x16, 0x02, 0x26, 0x02, 0x34, 0x02, 0x3d, 0x02,
+  0x47, 0x02, 0x52, 0x02, 0x5e, 0x02, 0x6c, 0x02, 0x00, 0x00, 0x2c, 0x00,
+  0x43, 0x00, 0x4f, 0x00, 0x5a, 0x00, 0x6e, 0x00, 0x7f, 0x00, 0x8b, 0x00,
+  0x95, 0x00, 0xa7, 0x00, 0xbd, 0x00, 0xce, 0x00, 0xda, 0x00, 0xec, 0x00,
+  0xfa, 0x00, 0x06, 0x01, 0x11, 0x01, 0x1f, 0x01, 0x00, 0x00, 0x23, 0x00,
+  0x36, 0x00, 0x45, 0x00, 0x4f, 0x00, 0x64, 0x00, 0x77, 0x00, 0x83, 0x00,
+  0x8f, 0x00, 0x9b, 0x00, 0xa7, 0x00, 0xb2, 0x00, 0xc0, 0x00, 0xcb, 0x00,
+  0xd6, 0x00, 0xe2, 0x00, 0xf5, 0x00, 0x07, 0x01, 0x12, 0x01, 0x1d, 0x01,
+  0x28, 0x01, 0x39, 0x01, 0x45, 0x01, 0x51, 0x01, 0x5c, 0x01, 0x68, 0x01,
+  0x73, 0x01, 0x7f, 0x01, 0x8d, 0x01, 0x99, 0x01, 0xa9, 0x01, 0xb5, 0x01,
+  0xc0, 0x01, 0xcd, 0x01, 0xe2, 0x01, 0xed, 0x01, 0xfe, 0x01, 0x09, 0x02,
+  0x00, 0x00, 0x35, 0x00, 0x48, 0x00, 0x5d, 0x00, 0x75, 0x00, 0x81, 0x00,
+  0x96, 0x00, 0xa8, 0x00, 0xb6, 0x00, 0xc2, 0x00, 0xd0, 0x00, 0xe5, 0x00,
+  0xf3, 0x00, 0xff, 0x00, 0x0b, 0x01, 0x19, 0x01, 0x2e, 0x01, 0x3a, 0x01,
+  0x52, 0x01, 0x61, 0x01, 0x76, 0x01, 0x00, 0x00, 0x2c, 0x00, 0x42, 0x00,
+  0x51, 0x00, 0x5f, 0x00, 0x6f, 0x00, 0x7e, 0x00, 0x8c, 0x00, 0x9a, 0x00,
+  0xa5, 0x00, 0xb3, 0x00, 0xbf, 0x00, 0xcd, 0x00, 0xdc, 0x00, 0xeb, 0x00,
+  0xf9, 0x00, 0x07, 0x01, 0x16, 0x01, 0x24, 0x01, 0x38, 0x01, 0x46, 0x01,
+  0x56, 0x01, 0x64, 0x01, 0x72, 0x01, 0x80, 0x01, 0x8e, 0x01, 0x00, 0x00,
+  0x18, 0x00, 0x24, 0x00, 0x32, 0x00, 0x40, 0x00, 0x4b, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x1c, 0x00, 0x2e, 0x00, 0x40, 0x00, 0x53, 0x00, 0x65, 0x00,
+  0x77, 0x00, 0x85, 0x00, 0x9a, 0x00, 0xab, 0x00, 0xbd, 0x00, 0xd3, 0x00,
+  0xe9, 0x00, 0xf7, 0x00, 0x09, 0x01, 0x17, 0x01, 0x25, 0x01, 0x37, 0x01,
+  0x43, 0x01, 0x56, 0x01, 0x00, 0x00, 0x23, 0x00, 0x40, 0x00, 0x51, 0x00,
+  0x5d, 0x00, 0x77, 0x00, 0x00, 0x00, 0x14, 0x00, 0x23, 0x00, 0x32, 0x00,
+  0x3e, 0x00, 0x49, 0x00, 0x58, 0x00, 0x66, 0x00, 0x70, 0x00, 0x7f, 0x00,
+  0x8b, 0x00, 0x97, 0x00, 0xa6, 0x00, 0xb2, 0x00, 0x00, 0x00, 0x0f, 0x00,
+  0x16, 0x00, 0x20, 0x00, 0x2d, 0x00, 0x3d, 0x00, 0x4a, 0x00, 0x58, 0x00,
+  0x65, 0x00, 0x73, 0x00, 0x81, 0x00, 0x8e, 0x00, 0x9b, 0x00, 0xa7, 0x00,
+  0xb3, 0x00, 0xc1, 0x00, 0xcf, 0x00, 0x00, 0x00, 0x10, 0x00, 0x1f, 0x00,
+  0x2d, 0x00, 0x3b, 0x00, 0x49, 0x00, 0x55, 0x00, 0x63, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x22, 0x00, 0x32, 0x00, 0x42, 0x00, 0x51, 0x00, 0x61, 0x00,
+  0x71, 0x00, 0x82, 0x00, 0x92, 0x00, 0x9d, 0x00, 0xad, 0x00, 0xb8, 0x00,
+  0xc8, 0x00, 0xd8, 0x00, 0xe8, 0x00, 0xf8, 0x00, 0x08, 0x01, 0x16, 0x01,
+  0x24, 0x01, 0x30, 0x01, 0x3f, 0x01, 0x4f, 0x01, 0x5f, 0x01, 0x6f, 0x01,
+  0x7f, 0x01, 0x00, 0x00, 0x18, 0x00, 0x2f, 0x00, 0x3b, 0x00, 0x47, 0x00,
+  0x53, 0x00, 0x5e, 0x00, 0x69, 0x00, 0x75, 0x00, 0x7f, 0x00, 0x89, 0x00,
+  0x9a, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x17, 0x00, 0x24, 0x00, 0x36, 0x00,
+  0x49, 0x00, 0x5d, 0x00, 0x6f, 0x00, 0x7b, 0x00, 0x8d, 0x00, 0xa0, 0x00,
+  0xb2, 0x00, 0xbf, 0x00, 0xcc, 0x00, 0xd8, 0x00, 0xe3, 0x00, 0xf5, 0x00,
+  0x06, 0x01, 0x18, 0x01, 0x24, 0x01, 0x36, 0x01, 0x42, 0x01, 0x4c, 0x01,
+  0x58, 0x01, 0x00, 0x00, 0x17, 0x00, 0x21, 0x00, 0x2d, 0x00, 0x3b, 0x00,
+  0x46, 0x00, 0x51, 0x00, 0x5c, 0x00, 0x67, 0x00, 0x76, 0x00, 0x81, 0x00,
+  0x8d, 0x00, 0x98, 0x00, 0xa4, 0x00, 0xaf, 0x00, 0xba, 0x00, 0xc8, 0x00,
+  0xd7, 0x00, 0xe2, 0x00, 0xed, 0x00, 0xfb, 0x00, 0x07, 0x01, 0x14, 0x01,
+  0x1f, 0x01, 0x2d, 0x01, 0x3b, 0x01, 0x46, 0x01, 0x53, 0x01, 0x00, 0x00,
+  0x21, 0x00, 0x2d, 0x00, 0x3d, 0x00, 0x49, 0x00, 0x57, 0x00, 0x61, 0x00,
+  0x6d, 0x00, 0x79, 0x00, 0x8a, 0x00, 0x96, 0x00, 0xa2, 0x00, 0xae, 0x00,
+  0xc2, 0x00, 0xd0, 0x00, 0xde, 0x00, 0xea, 0x00, 0xfe, 0x00, 0x09, 0x01,
+  0x17, 0x01, 0x00, 0x00, 0x21, 0x00, 0x2d, 0x00, 0x3c, 0x00, 0x4a, 0x00,
+  0x58, 0x00, 0x66, 0x00, 0x74, 0x00, 0x82, 0x00, 0x90, 0x00, 0x9e, 0x00,
+  0xad, 0x00, 0xbb, 0x00, 0xc9, 0x00, 0xd7, 0x00, 0xe6, 0x00, 0xf1, 0x00,
+  0xff, 0x00, 0x0d, 0x01, 0x19, 0x01, 0x27, 0x01, 0x3c, 0x01, 0x4d, 0x01,
+  0x5b, 0x01, 0x69, 0x01, 0x74, 0x01, 0x82, 0x01, 0x93, 0x01, 0x9e, 0x01,
+  0xac, 0x01, 0xbc, 0x01, 0xca, 0x01, 0xd8, 0x01, 0xe9, 0x01, 0xf7, 0x01,
+  0x05, 0x02, 0x11, 0x02, 0x1f, 0x02, 0x2d, 0x02, 0x00, 0x00, 0x0e, 0x00,
+  0x22, 0x00, 0x39, 0x00, 0x45, 0x00, 0x54, 0x00, 0x62, 0x00, 0x6e, 0x00,
+  0x7a, 0x00, 0x86, 0x00, 0x92, 0x00, 0xa0, 0x00, 0xb3, 0x00, 0xc9, 0x00,
+  0xd7, 0x00, 0xe3, 0x00, 0xef, 0x00, 0xf9, 0x00, 0x05, 0x01, 0x14, 0x01,
+  0x20, 0x01, 0x2f, 0x01, 0x3b, 0x01, 0x47, 0x01, 0x53, 0x01, 0x61, 0x01,
+  0x6d, 0x01, 0x80, 0x01, 0x8c, 0x01, 0x9e, 0x01, 0xad, 0x01, 0xbb, 0x01,
+  0xc9, 0x01, 0xd5, 0x01, 0xea, 0x01, 0xf6, 0x01, 0x08, 0x02, 0x1a, 0x02,
+  0x26, 0x02, 0x00, 0x00, 0x0c, 0x00, 0x1c, 0x00, 0x28, 0x00, 0x38, 0x00,
+  0x43, 0x00, 0x4f, 0x00, 0x5b, 0x00, 0x64, 0x00, 0x75, 0x00, 0x83, 0x00,
+  0x90, 0x00, 0x9e, 0x00, 0xaa, 0x00, 0xb6, 0x00, 0xc2, 0x00, 0xd3, 0x00,
+  0xdf, 0x00, 0xeb, 0x00, 0xf9, 0x00, 0x07, 0x01, 0x10, 0x01, 0x1c, 0x01,
+  0x2c, 0x01, 0x3a, 0x01, 0x48, 0x01, 0x56, 0x01, 0x62, 0x01, 0x6e, 0x01,
+  0x7c, 0x01, 0x00, 0x00, 0x10, 0x00, 0x1c, 0x00, 0x2b, 0x00, 0x37, 0x00,
+  0x41, 0x00, 0x4d, 0x00, 0x59, 0x00, 0x65, 0x00, 0x71, 0x00, 0x82, 0x00,
+  0x94, 0x00, 0xa2, 0x00, 0xae, 0x00, 0xbc, 0x00, 0xc8, 0x00, 0xd1, 0x00,
+  0xdd, 0x00, 0xe9, 0x00, 0xf4, 0x00, 0x05, 0x01, 0x11, 0x01, 0x1f, 0x01,
+  0x2d, 0x01, 0x39, 0x01, 0x4b, 0x01, 0x56, 0x01, 0x62, 0x01, 0x6d, 0x01,
+  0x79, 0x01, 0x87, 0x01, 0x91, 0x01, 0x9f, 0x01, 0xab, 0x01, 0xb7, 0x01,
+  0x00, 0x00, 0x12, 0x00, 0x20, 0x00, 0x2b, 0x00, 0x3a, 0x00, 0x46, 0x00,
+  0x54, 0x00, 0x5f, 0x00, 0x6d, 0x00, 0x7c, 0x00, 0x8b, 0x00, 0x98, 0x00,
+  0xa4, 0x00, 0xaf, 0x00, 0xbb, 0x00, 0xc9, 0x00, 0xd7, 0x00, 0xe8, 0x00,
+  0xf4, 0x00, 0x03, 0x01, 0x11, 0x01, 0x1f, 0x01, 0x2b, 0x01, 0x39, 0x01,
+  0x44, 0x01, 0x50, 0x01, 0x62, 0x01, 0x6e, 0x01, 0x78, 0x01, 0x84, 0x01,
+  0x90, 0x01, 0x9b, 0x01, 0xa7, 0x01, 0xb3, 0x01, 0xc1, 0x01, 0xcc, 0x01,
+  0xd7, 0x01, 0xe7, 0x01, 0xfc, 0x01, 0x0a, 0x02, 0x1a, 0x02, 0x29, 0x02,
+  0x37, 0x02, 0x00, 0x00, 0x17, 0x00, 0x26, 0x00, 0x3b, 0x00, 0x47, 0x00,
+  0x53, 0x00, 0x62, 0x00, 0x70, 0x00, 0x7f, 0x00, 0x8d, 0x00, 0x9b, 0x00,
+  0xa7, 0x00, 0xb0, 0x00, 0xbc, 0x00, 0xca, 0x00, 0xd4, 0x00, 0xdd, 0x00,
+  0xeb, 0x00, 0xfa, 0x00, 0x04, 0x01, 0x10, 0x01, 0x1c, 0x01, 0x31, 0x01,
+  0x40, 0x01, 0x4f, 0x01, 0x5b, 0x01, 0x67, 0x01, 0x73, 0x01, 0x81, 0x01,
+  0x8f, 0x01, 0x9e, 0x01, 0x00, 0x00, 0x1a, 0x00, 0x26, 0x00, 0x37, 0x00,
+  0x44, 0x00, 0x5b, 0x00, 0x67, 0x00, 0x73, 0x00, 0x7f, 0x00, 0x8b, 0x00,
+  0x9d, 0x00, 0xa9, 0x00, 0xb9, 0x00, 0xca, 0x00, 0xe1, 0x00, 0xed, 0x00,
+  0xfe, 0x00, 0x0c, 0x01, 0x18, 0x01, 0x24, 0x01, 0x32, 0x01, 0x3e, 0x01,
+  0x4a, 0x01, 0x59, 0x01, 0x68, 0x01, 0x75, 0x01, 0x81, 0x01, 0x8d, 0x01,
+  0x99, 0x01, 0xa5, 0x01, 0xb1, 0x01, 0xbd, 0x01, 0xcb, 0x01, 0xd7, 0x01,
+  0xe7, 0x01, 0xf3, 0x01, 0xff, 0x01, 0x0c, 0x02, 0x1e, 0x02, 0x2c, 0x02,
+  0x35, 0x02, 0x41, 0x02, 0x4d, 0x02, 0x61, 0x02, 0x73, 0x02, 0x7f, 0x02,
+  0x90, 0x02, 0x9c, 0x02, 0x00, 0x00, 0x09, 0x00, 0x14, 0x00, 0x20, 0x00,
+  0x2b, 0x00, 0x3a, 0x00, 0x46, 0x00, 0x4f, 0x00, 0x5d, 0x00, 0x6a, 0x00,
+  0x78, 0x00, 0x87, 0x00, 0x95, 0x00, 0x9e, 0x00, 0xaa, 0x00, 0xbc, 0x00,
+  0xc9, 0x00, 0x00, 0x00, 0x16, 0x00, 0x28, 0x00, 0x36, 0x00, 0x45, 0x00,
+  0x51, 0x00, 0x61, 0x00, 0x6d, 0x00, 0x7c, 0x00, 0x87, 0x00, 0x95, 0x00,
+  0xa0, 0x00, 0xab, 0x00, 0xb6, 0x00, 0xc5, 0x00, 0xd0, 0x00, 0xda, 0x00,
+  0xe8, 0x00, 0xf4, 0x00, 0x03, 0x01, 0x0f, 0x01, 0x1b, 0x01, 0x24, 0x01,
+  0x30, 0x01, 0x3b, 0x01, 0x49, 0x01, 0x53, 0x01, 0x00, 0x00, 0x0e, 0x00,
+  0x1a, 0x00, 0x25, 0x00, 0x39, 0x00, 0x43, 0x00, 0x54, 0x00, 0x64, 0x00,
+  0x75, 0x00, 0x82, 0x00, 0x8c, 0x00, 0x9a, 0x00, 0xa8, 0x00, 0xb6, 0x00,
+  0xc2, 0x00, 0xcc, 0x00, 0xd6, 0x00, 0xe3, 0x00, 0xef, 0x00, 0xfb, 0x00,
+  0x05, 0x01, 0x11, 0x01, 0x1f, 0x01, 0x29, 0x01, 0x37, 0x01, 0x43, 0x01,
+  0x50, 0x01, 0x5d, 0x01, 0x66, 0x01, 0x81, 0x01, 0x8f, 0x01, 0x9c, 0x01,
+  0xa9, 0x01, 0xb8, 0x01, 0x00, 0x00, 0x0e, 0x00, 0x1a, 0x00, 0x2c, 0x00,
+  0x3a, 0x00, 0x46, 0x00, 0x52, 0x00, 0x5e, 0x00, 0x6a, 0x00, 0x76, 0x00,
+  0x84, 0x00, 0x94, 0x00, 0xa2, 0x00, 0xb3, 0x00, 0xbf, 0x00, 0xcb, 0x00,
+  0xd7, 0x00, 0xe7, 0x00, 0xf3, 0x00, 0x04, 0x01, 0x15, 0x01, 0x23, 0x01,
+  0x2f, 0x01, 0x00, 0x00, 0x11, 0x00, 0x1d, 0x00, 0x2f, 0x00, 0x3f, 0x00,
+  0x4f, 0x00, 0x5f, 0x00, 0x6f, 0x00, 0x7b, 0x00, 0x84, 0x00, 0x95, 0x00,
+  0xa4, 0x00, 0xb6, 0x00, 0xc6, 0x00, 0xd6, 0x00, 0xe5, 0x00, 0xf6, 0x00,
+  0x02, 0x01, 0x12, 0x01, 0x22, 0x01, 0x2d, 0x01, 0x3d, 0x01, 0x55, 0x01,
+  0x64, 0x01, 0x74, 0x01, 0x80, 0x01, 0x8b, 0x01, 0x9c, 0x01, 0xaa, 0x01,
+  0xb5, 0x01, 0xc6, 0x01, 0xd0, 0x01, 0xe0, 0x01, 0xeb, 0x01, 0xf9, 0x01,
+  0x03, 0x02, 0x0d, 0x02, 0x17, 0x02, 0x25, 0x02, 0x35, 0x02, 0x45, 0x02,
+  0x53, 0x02, 0x63, 0x02, 0x00, 0x00, 0x0c, 0x00, 0x1d, 0x00, 0x29, 0x00,
+  0x34, 0x00, 0x42, 0x00, 0x4f, 0x00, 0x5e, 0x00, 0x6a, 0x00, 0x7b, 0x00,
+  0x87, 0x00, 0x95, 0x00, 0xa3, 0x00, 0xaf, 0x00, 0xbd, 0x00, 0xcb, 0x00,
+  0xda, 0x00, 0xe5, 0x00, 0xf1, 0x00, 0xfd, 0x00, 0x07, 0x01, 0x00, 0x00,
+  0x0c, 0x00, 0x1d, 0x00, 0x2b, 0x00, 0x3d, 0x00, 0x4f, 0x00, 0x62, 0x00,
+  0x6e, 0x00, 0x7a, 0x00, 0x86, 0x00, 0x99, 0x00, 0xab, 0x00, 0xb7, 0x00,
+  0xc5, 0x00, 0xd1, 0x00, 0xde, 0x00, 0xea, 0x00, 0xf8, 0x00, 0x04, 0x01,
+  0x16, 0x01, 0x29, 0x01, 0x37, 0x01, 0x41, 0x01, 0x53, 0x01, 0x60, 0x01,
+  0x72, 0x01, 0x7e, 0x01, 0x8c, 0x01, 0x98, 0x01, 0xa6, 0x01, 0x00, 0x00,
+  0x0d, 0x00, 0x19, 0x00, 0x24, 0x00, 0x2f, 0x00, 0x3b, 0x00, 0x46, 0x00,
+  0x52, 0x00, 0x5d, 0x00, 0x6e, 0x00, 0x7e, 0x00, 0x92, 0x00, 0x9f, 0x00,
+  0xad, 0x00, 0xba, 0x00, 0xc5, 0x00, 0xd2, 0x00, 0xde, 0x00, 0xe9, 0x00,
+  0x00, 0x00, 0x15, 0x00, 0x29, 0x00, 0x37, 0x00, 0x43, 0x00, 0x4d, 0x00,
+  0x5f, 0x00, 0x6e, 0x00, 0x82, 0x00, 0x8c, 0x00, 0xa0, 0x00, 0xae, 0x00,
+  0xc0, 0x00, 0xd4, 0x00, 0xe5, 0x00, 0xf3, 0x00, 0x07, 0x01, 0x15, 0x01,
+  0x25, 0x01, 0x33, 0x01, 0x41, 0x01, 0x55, 0x01, 0x61, 0x01, 0x71, 0x01,
+  0x7c, 0x01, 0x88, 0x01, 0x97, 0x01, 0x00, 0x00, 0x10, 0x00, 0x22, 0x00,
+  0x2e, 0x00, 0x3c, 0x00, 0x51, 0x00, 0x5f, 0x00, 0x6d, 0x00, 0x79, 0x00,
+  0x88, 0x00, 0x96, 0x00, 0xa4, 0x00, 0xbb, 0x00, 0xc7, 0x00, 0xd6, 0x00,
+  0xe0, 0x00, 0xef, 0x00, 0xfd, 0x00, 0x0b, 0x01, 0x1f, 0x01, 0x2d, 0x01,
+  0x38, 0x01, 0x4c, 0x01, 0x5a, 0x01, 0x66, 0x01, 0x00, 0x00, 0x1b, 0x00,
+  0x45, 0x00, 0x51, 0x00, 0x67, 0x00, 0x79, 0x00, 0x84, 0x00, 0x96, 0x00,
+  0xa2, 0x00, 0xb5, 0x00, 0xc5, 0x00, 0xd6, 0x00, 0xe7, 0x00, 0xf3, 0x00,
+  0x08, 0x01, 0x1d, 0x01, 0x2f, 0x01, 0x41, 0x01, 0x4f, 0x01, 0x5d, 0x01,
+  0x6f, 0x01, 0x81, 0x01, 0x8d, 0x01, 0x00, 0x00, 0x13, 0x00, 0x1f, 0x00,
+  0x30, 0x00, 0x3c, 0x00, 0x4c, 0x00, 0x5c, 0x00, 0x68, 0x00, 0x74, 0x00,
+  0x85, 0x00, 0x95, 0x00, 0xa0, 0x00, 0xb0, 0x00, 0xc2, 0x00, 0xd4, 0x00,
+  0xdf, 0x00, 0xea, 0x00, 0xf6, 0x00, 0x01, 0x01, 0x0c, 0x01, 0x00, 0x00,
+  0x1d, 0x00, 0x2f, 0x00, 0x42, 0x00, 0x55, 0x00, 0x61, 0x00, 0x6b, 0x00,
+  0x77, 0x00, 0x8c, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x3c, 0x00, 0x4a, 0x00,
+  0x58, 0x00, 0x6c, 0x00, 0x80, 0x00, 0x8e, 0x00, 0x9a, 0x00, 0xa9, 0x00,
+  0xb5, 0x00, 0xc3, 0x00, 0xd1, 0x00, 0xe0, 0x00, 0xec, 0x00, 0xfa, 0x00,
+  0x08, 0x01, 0x18, 0x01, 0x2a, 0x01, 0x39, 0x01, 0x47, 0x01, 0x55, 0x01,
+  0x60, 0x01, 0x6e, 0x01, 0x7c, 0x01, 0x8a, 0x01, 0x95, 0x01, 0xa4, 0x01,
+  0xb3, 0x01, 0xc1, 0x01, 0xcf, 0x01, 0xda, 0x01, 0xee, 0x01, 0xfc, 0x01,
+  0x06, 0x02, 0x00, 0x00, 0x15, 0x00, 0x24, 0x00, 0x2f, 0x00, 0x3d, 0x00,
+  0x4c, 0x00, 0x58, 0x00, 0x75, 0x00, 0x85, 0x00, 0x91, 0x00, 0xa5, 0x00,
+  0xb5, 0x00, 0xcb, 0x00, 0xd5, 0x00, 0xe1, 0x00, 0xf0, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x1e, 0x00, 0x2e, 0x00, 0x3a, 0x00, 0x46, 0x00, 0x56, 0x00,
+  0x61, 0x00, 0x73, 0x00, 0x7f, 0x00, 0x8d, 0x00, 0x9c, 0x00, 0xaa, 0x00,
+  0xb8, 0x00, 0xca, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x22, 0x00, 0x33, 0x00,
+  0x40, 0x00, 0x4c, 0x00, 0x57, 0x00, 0x62, 0x00, 0x00, 0x00, 0x0d, 0x00,
+  0x24, 0x00, 0x36, 0x00, 0x40, 0x00, 0x4b, 0x00, 0x59, 0x00, 0x71, 0x00,
+  0x7c, 0x00, 0x8a, 0x00, 0x96, 0x00, 0xa2, 0x00, 0xb2, 0x00, 0xc0, 0x00,
+  0xcb, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x19, 0x00, 0x33, 0x00, 0x44, 0x00,
+  0x52, 0x00, 0x5f, 0x00, 0x69, 0x00, 0x76, 0x00, 0x83, 0x00, 0x8f, 0x00,
+  0x9c, 0x00, 0x00, 0x00, 0x16, 0x00, 0x27, 0x00, 0x35, 0x00, 0x43, 0x00,
+  0x59, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x20, 0x00, 0x30, 0x00, 0x40, 0x00,
+  0x50, 0x00, 0x5e, 0x00, 0x6e, 0x00, 0x7d, 0x00, 0x88, 0x00, 0x98, 0x00,
+  0xa8, 0x00, 0xb7, 0x00, 0xc5, 0x00, 0xd5, 0x00, 0xe5, 0x00, 0xf5, 0x00,
+  0x08, 0x01, 0x13, 0x01, 0x23, 0x01, 0x00, 0x00, 0x11, 0x00, 0x1d, 0x00,
+  0x2b, 0x00, 0x37, 0x00, 0x42, 0x00, 0x52, 0x00, 0x5e, 0x00, 0x68, 0x00,
+  0x74, 0x00, 0x80, 0x00, 0x8c, 0x00, 0x97, 0x00, 0xa3, 0x00, 0xb4, 0x00,
+  0xbf, 0x00, 0xca, 0x00, 0xd3, 0x00, 0xdf, 0x00, 0xeb, 0x00, 0xf6, 0x00,
+  0x00, 0x01, 0x0b, 0x01, 0x17, 0x01, 0x23, 0x01, 0x2e, 0x01, 0x38, 0x01,
+  0x00, 0x00, 0x0a, 0x00, 0x1d, 0x00, 0x2f, 0x00, 0x42, 0x00, 0x55, 0x00,
+  0x67, 0x00, 0x72, 0x00, 0x7f, 0x00, 0x90, 0x00, 0x9c, 0x00, 0xa8, 0x00,
+  0xb6, 0x00, 0xc5, 0x00, 0xd8, 0x00, 0xe3, 0x00, 0xed, 0x00, 0xff, 0x00,
+  0x11, 0x01, 0x1c, 0x01, 0x29, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x17, 0x00,
+  0x23, 0x00, 0x2f, 0x00, 0x3a, 0x00, 0x48, 0x00, 0x53, 0x00, 0x5e, 0x00,
+  0x6a, 0x00, 0x75, 0x00, 0x81, 0x00, 0x94, 0x00, 0x9f, 0x00, 0xab, 0x00,
+  0xb7, 0x00, 0xc2, 0x00, 0xcd, 0x00, 0xdb, 0x00, 0xe6, 0x00, 0xf2, 0x00,
+  0x06, 0x01, 0x11, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x34, 0x01, 0x3f, 0x01,
+  0x4b, 0x01, 0x57, 0x01, 0x63, 0x01, 0x71, 0x01, 0x7d, 0x01, 0x88, 0x01,
+  0x94, 0x01, 0x9f, 0x01, 0xab, 0x01, 0xb6, 0x01, 0xc4, 0x01, 0xd3, 0x01,
+  0xde, 0x01, 0xec, 0x01, 0xfa, 0x01, 0x06, 0x02, 0x12, 0x02, 0x1e, 0x02,
+  0x29, 0x02, 0x37, 0x02, 0x42, 0x02, 0x4e, 0x02, 0x5a, 0x02, 0x65, 0x02,
+  0x00, 0x00, 0x09, 0x00, 0x14, 0x00, 0x26, 0x00, 0x31, 0x00, 0x3c, 0x00,
+  0x48, 0x00, 0x53, 0x00, 0x63, 0x00, 0x6f, 0x00, 0x7b, 0x00, 0x88, 0x00,
+  0x9d, 0x00, 0xa8, 0x00, 0xb4, 0x00, 0xc0, 0x00, 0xcc, 0x00, 0xd8, 0x00,
+  0xe3, 0x00, 0xef, 0x00, 0xfb, 0x00, 0x0b, 0x01, 0x17, 0x01, 0x27, 0x01,
+  0x33, 0x01, 0x40, 0x01, 0x4c, 0x01, 0x56, 0x01, 0x6a, 0x01, 0x7a, 0x01,
+  0x88, 0x01, 0x93, 0x01, 0x9f, 0x01, 0xaf, 0x01, 0x00, 0x00, 0x0e, 0x00,
+  0x1c, 0x00, 0x27, 0x00, 0x38, 0x00, 0x46, 0x00, 0x54, 0x00, 0x62, 0x00,
+  0x70, 0x00, 0x7e, 0x00, 0x8c, 0x00, 0x9a, 0x00, 0xa8, 0x00, 0xb6, 0x00,
+  0xc2, 0x00, 0xce, 0x00, 0xd9, 0x00, 0xe7, 0x00, 0xf3, 0x00, 0x02, 0x01,
+  0x11, 0x01, 0x1f, 0x01, 0x2b, 0x01, 0x3b, 0x01, 0x4a, 0x01, 0x58, 0x01,
+  0x66, 0x01, 0x74, 0x01, 0x81, 0x01, 0x94, 0x01, 0xa2, 0x01, 0xad, 0x01,
+  0xbb, 0x01, 0xc9, 0x01, 0xd3, 0x01, 0xe1, 0x01, 0xef, 0x01, 0x04, 0x02,
+  0x12, 0x02, 0x20, 0x02, 0x31, 0x02, 0x3f, 0x02, 0x4d, 0x02, 0x5b, 0x02,
+  0x66, 0x02, 0x70, 0x02, 0x7e, 0x02, 0x89, 0x02, 0x93, 0x02, 0x9e, 0x02,
+  0xa8, 0x02, 0xb6, 0x02, 0xc4, 0x02, 0xce, 0x02, 0xd9, 0x02, 0xe7, 0x02,
+  0xf5, 0x02, 0x04, 0x03, 0x00, 0x00, 0x15, 0x00, 0x20, 0x00, 0x32, 0x00,
+  0x44, 0x00, 0x50, 0x00, 0x63, 0x00, 0x6f, 0x00, 0x7b, 0x00, 0x87, 0x00,
+  0x93, 0x00, 0x9f, 0x00, 0xab, 0x00, 0xb6, 0x00, 0xc1, 0x00, 0xcc, 0x00,
+  0xd8, 0x00, 0xe3, 0x00, 0xee, 0x00, 0xff, 0x00, 0x0d, 0x01, 0x17, 0x01,
+  0x25, 0x01, 0x33, 0x01, 0x46, 0x01, 0x56, 0x01, 0x60, 0x01, 0x72, 0x01,
+  0x7e, 0x01, 0x88, 0x01, 0x94, 0x01, 0xa0, 0x01, 0xae, 0x01, 0xbf, 0x01,
+  0xd1, 0x01, 0xdd, 0x01, 0xe9, 0x01, 0xfa, 0x01, 0x04, 0x02, 0x16, 0x02,
+  0x22, 0x02, 0x2e, 0x02, 0x39, 0x02, 0x45, 0x02, 0x50, 0x02, 0x00, 0x00,
+  0x0e, 0x00, 0x1e, 0x00, 0x2d, 0x00, 0x39, 0x00, 0x45, 0x00, 0x50, 0x00,
+  0x60, 0x00, 0x70, 0x00, 0x7d, 0x00, 0x8e, 0x00, 0x9a, 0x00, 0xa7, 0x00,
+  0xb2, 0x00, 0xc3, 0x00, 0xcf, 0x00, 0xe0, 0x00, 0xee, 0x00, 0xf9, 0x00,
+  0x09, 0x01, 0x1a, 0x01, 0x2a, 0x01, 0x35, 0x01, 0x40, 0x01, 0x4b, 0x01,
+  0x57, 0x01, 0x67, 0x01, 0x78, 0x01, 0x89, 0x01, 0x95, 0x01, 0xa1, 0x01,
+  0xac, 0x01, 0xb8, 0x01, 0xc6, 0x01, 0xd1, 0x01, 0xdd, 0x01, 0xf1, 0x01,
+  0x02, 0x02, 0x0e, 0x02, 0x1a, 0x02, 0x25, 0x02, 0x33, 0x02, 0x3f, 0x02,
+  0x4a, 0x02, 0x58, 0x02, 0x00, 0x00, 0x0c, 0x00, 0x1b, 0x00, 0x27, 0x00,
+  0x32, 0x00, 0x42, 0x00, 0x4d, 0x00, 0x60, 0x00, 0x6b, 0x00, 0x79, 0x00,
+  0x84, 0x00, 0x92, 0x00, 0x9e, 0x00, 0xac, 0x00, 0xb8, 0x00, 0xc3, 0x00,
+  0xcf, 0x00, 0xd9, 0x00, 0xec, 0x00, 0xf7, 0x00, 0x03, 0x01, 0x11, 0x01,
+  0x24, 0x01, 0x2e, 0x01, 0x3d, 0x01, 0x49, 0x01, 0x58, 0x01, 0x64, 0x01,
+  0x74, 0x01, 0x80, 0x01, 0x00, 0x00, 0x15, 0x00, 0x23, 0x00, 0x31, 0x00,
+  0x3d, 0x00, 0x4c, 0x00, 0x5b, 0x00, 0x69, 0x00, 0x77, 0x00, 0x85, 0x00,
+  0x94, 0x00, 0xa0, 0x00, 0xae, 0x00, 0xbe, 0x00, 0xd3, 0x00, 0xdf, 0x00,
+  0xed, 0x00, 0xf8, 0x00, 0x08, 0x01, 0x14, 0x01, 0x22, 0x01, 0x30, 0x01,
+  0x3c, 0x01, 0x4a, 0x01, 0x58, 0x01, 0x63, 0x01, 0x71, 0x01, 0x7f, 0x01,
+  0x90, 0x01, 0x9c, 0x01, 0xaa, 0x01, 0xba, 0x01, 0xc8, 0x01, 0xd3, 0x01,
+  0xe1, 0x01, 0xef, 0x01, 0xfd, 0x01, 0x09, 0x02, 0x15, 0x02, 0x00, 0x00,
+  0x0c, 0x00, 0x18, 0x00, 0x27, 0x00, 0x35, 0x00, 0x44, 0x00, 0x50, 0x00,
+  0x5c, 0x00, 0x68, 0x00, 0x77, 0x00, 0x83, 0x00, 0x90, 0x00, 0x9b, 0x00,
+  0xb0, 0x00, 0xbc, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x10, 0x00, 0x1c, 0x00,
+  0x2b, 0x00, 0x3b, 0x00, 0x48, 0x00, 0x54, 0x00, 0x65, 0x00, 0x71, 0x00,
+  0x7f, 0x00, 0x8d, 0x00, 0x9b, 0x00, 0xa7, 0x00, 0xb5, 0x00, 0xc1, 0x00,
+  0xcf, 0x00, 0xdd, 0x00, 0xeb, 0x00, 0xf7, 0x00, 0x03, 0x01, 0x11, 0x01,
+  0x1d, 0x01, 0x29, 0x01, 0x35, 0x01, 0x45, 0x01, 0x51, 0x01, 0x5d, 0x01,
+  0x69, 0x01, 0x7a, 0x01, 0x86, 0x01, 0x92, 0x01, 0xa5, 0x01, 0xb1, 0x01,
+  0xc0, 0x01, 0xcc, 0x01, 0xd8, 0x01, 0xe4, 0x01, 0xf3, 0x01, 0x03, 0x02,
+  0x14, 0x02, 0x20, 0x02, 0x30, 0x02, 0x3c, 0x02, 0x48, 0x02, 0x5b, 0x02,
+  0x69, 0x02, 0x75, 0x02, 0x86, 0x02, 0x00, 0x00, 0x0c, 0x00, 0x1b, 0x00,
+  0x2a, 0x00, 0x38, 0x00, 0x4a, 0x00, 0x59, 0x00, 0x6a, 0x00, 0x7c, 0x00,
+  0x8a, 0x00, 0x99, 0x00, 0xa5, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1d, 0x00,
+  0x2c, 0x00, 0x3b, 0x00, 0x4c, 0x00, 0x5e, 0x00, 0x6d, 0x00, 0x7b, 0x00,
+  0x87, 0x00, 0x96, 0x00, 0xa1, 0x00, 0xb0, 0x00, 0xbc, 0x00, 0xca, 0x00,
+  0xd6, 0x00, 0xe4, 0x00, 0xf3, 0x00, 0x0a, 0x01, 0x18, 0x01, 0x26, 0x01,
+  0x34, 0x01, 0x43, 0x01, 0x4e, 0x01, 0x5c, 0x01, 0x6c, 0x01, 0x00, 0x00,
+  0x0e, 0x00, 0x1a, 0x00, 0x2f, 0x00, 0x3d, 0x00, 0x4b, 0x00, 0x62, 0x00,
+  0x6f, 0x00, 0x7b, 0x00, 0x87, 0x00, 0x94, 0x00, 0xa0, 0x00, 0xb3, 0x00,
+  0xc1, 0x00, 0xce, 0x00, 0xd9, 0x00, 0xe6, 0x00, 0xf4, 0x00, 0x00, 0x01,
+  0x0e, 0x01, 0x1a, 0x01, 0x26, 0x01, 0x33, 0x01, 0x41, 0x01, 0x4e, 0x01,
+  0x5c, 0x01, 0x68, 0x01, 0x72, 0x01, 0x7e, 0x01, 0x8a, 0x01, 0x00, 0x00,
+  0x0e, 0x00, 0x1b, 0x00, 0x27, 0x00, 0x38, 0x00, 0x44, 0x00, 0x53, 0x00,
+  0x61, 0x00, 0x6e, 0x00, 0x7a, 0x00, 0x86, 0x00, 0x93, 0x00, 0x9e, 0x00,
+  0xac, 0x00, 0xb8, 0x00, 0xc4, 0x00, 0xd0, 0x00, 0xdf, 0x00, 0xeb, 0x00,
+  0xf9, 0x00, 0x07, 0x01, 0x15, 0x01, 0x21, 0x01, 0x2f, 0x01, 0x3e, 0x01,
+  0x4e, 0x01, 0x5e, 0x01, 0x6c, 0x01, 0x78, 0x01, 0x00, 0x00, 0x09, 0x00,
+  0x15, 0x00, 0x25, 0x00, 0x35, 0x00, 0x41, 0x00, 0x51, 0x00, 0x61, 0x00,
+  0x71, 0x00, 0x83, 0x00, 0x93, 0x00, 0xa3, 0x00, 0xb4, 0x00, 0xbf, 0x00,
+  0xce, 0x00, 0xdf, 0x00, 0xf4, 0x00, 0x04, 0x01, 0x11, 0x01, 0x21, 0x01,
+  0x00, 0x00, 0x0e, 0x00, 0x1d, 0x00, 0x2b, 0x00, 0x39, 0x00, 0x44, 0x00,
+  0x4f, 0x00, 0x63, 0x00, 0x6e, 0x00, 0x7c, 0x00, 0x8b, 0x00, 0x97, 0x00,
+  0xa2, 0x00, 0xb2, 0x00, 0xbb, 0x00, 0xc6, 0x00, 0xd8, 0x00, 0xe2, 0x00,
+  0xed, 0x00, 0xf8, 0x00, 0x02, 0x01, 0x15, 0x01, 0x27, 0x01, 0x38, 0x01,
+  0x43, 0x01, 0x4d, 0x01, 0x00, 0x00, 0x2b, 0x00, 0x3d, 0x00, 0x50, 0x00,
+  0x5c, 0x00, 0x69, 0x00, 0x74, 0x00, 0x81, 0x00, 0x8e, 0x00, 0x9a, 0x00,
+  0xa9, 0x00, 0xbc, 0x00, 0xce, 0x00, 0xde, 0x00, 0xf1, 0x00, 0xfe, 0x00,
+  0x10, 0x01, 0x1c, 0x01, 0x00, 0x00, 0x19, 0x00, 0x25, 0x00, 0x33, 0x00,
+  0x3e, 0x00, 0x49, 0x00, 0x54, 0x00, 0x60, 0x00, 0x6c, 0x00, 0x7b, 0x00,
+  0x87, 0x00, 0x92, 0x00, 0x9d, 0x00, 0xae, 0x00, 0xbf, 0x00, 0xd3, 0x00,
+  0xe0, 0x00, 0xec, 0x00, 0xf7, 0x00, 0x05, 0x01, 0x19, 0x01, 0x2b, 0x01,
+  0x3b, 0x01, 0x48, 0x01, 0x53, 0x01, 0x5f, 0x01, 0x6a, 0x01, 0x00, 0x00,
+  0x10, 0x00, 0x1c, 0x00, 0x28, 0x00, 0x3c, 0x00, 0x4b, 0x00, 0x57, 0x00,
+  0x65, 0x00, 0x7a, 0x00, 0x84, 0x00, 0x92, 0x00, 0xa4, 0x00, 0xb4, 0x00,
+  0xc6, 0x00, 0xd2, 0x00, 0xed, 0x00, 0xfd, 0x00, 0x09, 0x01, 0x15, 0x01,
+  0x21, 0x01, 0x00, 0x00, 0x18, 0x00, 0x26, 0x00, 0x34, 0x00, 0x42, 0x00,
+  0x50, 0x00, 0x60, 0x00, 0x72, 0x00, 0x80, 0x00, 0x8e, 0x00, 0xa3, 0x00,
+  0xb1, 0x00, 0xc0, 0x00, 0xd0, 0x00, 0xde, 0x00, 0xec, 0x00, 0xfa, 0x00,
+  0x04, 0x01, 0x0d, 0x01, 0x1b, 0x01, 0x27, 0x01, 0x31, 0x01, 0x3c, 0x01,
+  0x4b, 0x01, 0x5a, 0x01, 0x6c, 0x01, 0x7a, 0x01, 0x86, 0x01, 0x94, 0x01,
+  0x00, 0x00, 0x14, 0x00, 0x29, 0x00, 0x40, 0x00, 0x52, 0x00, 0x5e, 0x00,
+  0x6d, 0x00, 0x7b, 0x00, 0x8d, 0x00, 0x9c, 0x00, 0xaf, 0x00, 0xbb, 0x00,
+  0xcd, 0x00, 0xdf, 0x00, 0xea, 0x00, 0xf5, 0x00, 0x07, 0x01, 0x19, 0x01,
+  0x2b, 0x01, 0x37, 0x01, 0x00, 0x00, 0x22, 0x00, 0x33, 0x00, 0x44, 0x00,
+  0x55, 0x00, 0x5f, 0x00, 0x6b, 0x00, 0x76, 0x00, 0x87, 0x00, 0x98, 0x00,
+  0xa3, 0x00, 0xb3, 0x00, 0xbf, 0x00, 0xce, 0x00, 0xda, 0x00, 0xee, 0x00,
+  0x01, 0x01, 0x14, 0x01, 0x1f, 0x01, 0x2e, 0x01, 0x3f, 0x01, 0x00, 0x00,
+  0x11, 0x00, 0x24, 0x00, 0x39, 0x00, 0x45, 0x00, 0x57, 0x00, 0x63, 0x00,
+  0x6e, 0x00, 0x7a, 0x00, 0x86, 0x00, 0x92, 0x00, 0xa3, 0x00, 0xb9, 0x00,
+  0xc3, 0x00, 0xcf, 0x00, 0xdd, 0x00, 0x00, 0x00, 0x11, 0x00, 0x26, 0x00,
+  0x34, 0x00, 0x42, 0x00, 0x51, 0x00, 0x5f, 0x00, 0x6d, 0x00, 0x7b, 0x00,
+  0x89, 0x00, 0x98, 0x00, 0xa7, 0x00, 0xb5, 0x00, 0xc4, 0x00, 0xd2, 0x00,
+  0xe0, 0x00, 0xeb, 0x00, 0xf9, 0x00, 0x07, 0x01, 0x13, 0x01, 0x28, 0x01,
+  0x34, 0x01, 0x42, 0x01, 0x51, 0x01, 0x5d, 0x01, 0x6b, 0x01, 0x79, 0x01,
+  0x87, 0x01, 0x96, 0x01, 0xa5, 0x01, 0xb3, 0x01, 0xc1, 0x01, 0xcf, 0x01,
+  0xde, 0x01, 0xec, 0x01, 0xfa, 0x01, 0x08, 0x02, 0x17, 0x02, 0x25, 0x02,
+  0x33, 0x02, 0x41, 0x02, 0x00, 0x00, 0x1a, 0x00, 0x2b, 0x00, 0x3c, 0x00,
+  0x48, 0x00, 0x57, 0x00, 0x66, 0x00, 0x75, 0x00, 0x84, 0x00, 0x93, 0x00,
+  0xa2, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x20, 0x00, 0x2d, 0x00, 0x39, 0x00,
+  0x47, 0x00, 0x58, 0x00, 0x68, 0x00, 0x76, 0x00, 0x86, 0x00, 0x92, 0x00,
+  0xa1, 0x00, 0xaf, 0x00, 0xc0, 0x00, 0xd1, 0x00, 0xdf, 0x00, 0xea, 0x00,
+  0xf6, 0x00, 0x00, 0x00, 0x11, 0x00, 0x26, 0x00, 0x3a, 0x00, 0x45, 0x00,
+  0x50, 0x00, 0x66, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x33, 0x00, 0x44, 0x00,
+  0x4f, 0x00, 0x63, 0x00, 0x6f, 0x00, 0x7d, 0x00, 0x8b, 0x00, 0x97, 0x00,
+  0xa3, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x28, 0x00, 0x35, 0x00, 0x41, 0x00,
+  0x4e, 0x00, 0x5b, 0x00, 0x69, 0x00, 0x75, 0x00, 0x82, 0x00, 0x90, 0x00,
+  0x9c, 0x00, 0xa8, 0x00, 0xb5, 0x00, 0x00, 0x00, 0x16, 0x00, 0x34, 0x00,
+  0x44, 0x00, 0x54, 0x00, 0x63, 0x00, 0x6f, 0x00, 0x7f, 0x00, 0x8f, 0x00,
+  0x9f, 0x00, 0xaf, 0x00, 0xbd, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x1a, 0x00,
+  0x2a, 0x00, 0x3a, 0x00, 0x45, 0x00, 0x55, 0x00, 0x65, 0x00, 0x74, 0x00,
+  0x84, 0x00, 0x96, 0x00, 0xa8, 0x00, 0xb3, 0x00, 0xc3, 0x00, 0xd3, 0x00,
+  0xe3, 0x00, 0xf3, 0x00, 0x03, 0x01, 0x13, 0x01, 0x23, 0x01, 0x33, 0x01,
+  0x42, 0x01, 0x52, 0x01, 0x00, 0x00, 0x14, 0x00, 0x24, 0x00, 0x35, 0x00,
+  0x40, 0x00, 0x50, 0x00, 0x5b, 0x00, 0x65, 0x00, 0x6f, 0x00, 0x7d, 0x00,
+  0x88, 0x00, 0x94, 0x00, 0xa2, 0x00, 0xb7, 0x00, 0xc1, 0x00, 0xd2, 0x00,
+  0xdd, 0x00, 0xe7, 0x00, 0xf3, 0x00, 0xfd, 0x00, 0x00, 0x00, 0x21, 0x00,
+  0x32, 0x00, 0x43, 0x00, 0x4e, 0x00, 0x59, 0x00, 0x65, 0x00, 0x71, 0x00,
+  0x83, 0x00, 0x94, 0x00, 0xa6, 0x00, 0xb2, 0x00, 0xbd, 0x00, 0xc7, 0x00,
+  0xd9, 0x00, 0xeb, 0x00, 0xf5, 0x00, 0x07, 0x01, 0x13, 0x01, 0x26, 0x01,
+  0x38, 0x01, 0x4a, 0x01, 0x00, 0x00, 0x16, 0x00, 0x22, 0x00, 0x2e, 0x00,
+  0x3c, 0x00, 0x47, 0x00, 0x53, 0x00, 0x60, 0x00, 0x6b, 0x00, 0x78, 0x00,
+  0x83, 0x00, 0x8e, 0x00, 0x99, 0x00, 0xa5, 0x00, 0xb1, 0x00, 0xbd, 0x00,
+  0xc9, 0x00, 0xd7, 0x00, 0xe3, 0x00, 0xf1, 0x00, 0xfc, 0x00, 0x0a, 0x01,
+  0x15, 0x01, 0x22, 0x01, 0x2e, 0x01, 0x3a, 0x01, 0x46, 0x01, 0x51, 0x01,
+  0x5c, 0x01, 0x6a, 0x01, 0x75, 0x01, 0x81, 0x01, 0x8c, 0x01, 0x97, 0x01,
+  0xa3, 0x01, 0xae, 0x01, 0xb9, 0x01, 0xc4, 0x01, 0xcf, 0x01, 0xda, 0x01,
+  0xe5, 0x01, 0xf0, 0x01, 0x00, 0x00, 0x2f, 0x00, 0x40, 0x00, 0x4e, 0x00,
+  0x5a, 0x00, 0x66, 0x00, 0x72, 0x00, 0x87, 0x00, 0x9b, 0x00, 0xa7, 0x00,
+  0xb3, 0x00, 0xbf, 0x00, 0xcb, 0x00, 0xd5, 0x00, 0xe5, 0x00, 0xfa, 0x00,
+  0x06, 0x01, 0x10, 0x01, 0x24, 0x01, 0x38, 0x01, 0x42, 0x01, 0x4c, 0x01,
+  0x56, 0x01, 0x64, 0x01, 0x6e, 0x01, 0x78, 0x01, 0x82, 0x01, 0x8c, 0x01,
+  0x9c, 0x01, 0xa8, 0x01, 0xb2, 0x01, 0xbc, 0x01, 0xcc, 0x01, 0xd8, 0x01,
+  0xed, 0x01, 0x00, 0x00, 0x14, 0x00, 0x22, 0x00, 0x30, 0x00, 0x3e, 0x00,
+  0x4c, 0x00, 0x5a, 0x00, 0x68, 0x00, 0x78, 0x00, 0x86, 0x00, 0x94, 0x00,
+  0xa0, 0x00, 0xac, 0x00, 0xba, 0x00, 0xc6, 0x00, 0xd2, 0x00, 0xe0, 0x00,
+  0xea, 0x00, 0xf9, 0x00, 0x04, 0x01, 0x12, 0x01, 0x1e, 0x01, 0x2c, 0x01,
+  0x36, 0x01, 0x43, 0x01, 0x51, 0x01, 0x5f, 0x01, 0x70, 0x01, 0x7b, 0x01,
+  0x89, 0x01, 0x96, 0x01, 0xa5, 0x01, 0xb3, 0x01, 0xc1, 0x01, 0xcb, 0x01,
+  0xd9, 0x01, 0xe7, 0x01, 0xf5, 0x01, 0x0b, 0x02, 0x15, 0x02, 0x21, 0x02,
+  0x2f, 0x02, 0x39, 0x02, 0x43, 0x02, 0x4d, 0x02, 0x5b, 0x02, 0x65, 0x02,
+  0x74, 0x02, 0x82, 0x02, 0x90, 0x02, 0x9a, 0x02, 0xa8, 0x02, 0xb2, 0x02,
+  0xc0, 0x02, 0xcc, 0x02, 0xda, 0x02, 0xe5, 0x02, 0xf1, 0x02, 0xfb, 0x02,
+  0x09, 0x03, 0x1b, 0x03, 0x29, 0x03, 0x37, 0x03, 0x45, 0x03, 0x50, 0x03,
+  0x5f, 0x03, 0x00, 0x00, 0x0c, 0x00, 0x22, 0x00, 0x2c, 0x00, 0x3b, 0x00,
+  0x4d, 0x00, 0x5b, 0x00, 0x6a, 0x00, 0x76, 0x00, 0x87, 0x00, 0x93, 0x00,
+  0xa2, 0x00, 0xb0, 0x00, 0xc5, 0x00, 0xd1, 0x00, 0xdf, 0x00, 0xea, 0x00,
+  0xf6, 0x00, 0x02, 0x01, 0x0e, 0x01, 0x1c, 0x01, 0x2a, 0x01, 0x34, 0x01,
+  0x43, 0x01, 0x51, 0x01, 0x5d, 0x01, 0x70, 0x01, 0x80, 0x01, 0x8f, 0x01,
+  0xa5, 0x01, 0xb0, 0x01, 0xc2, 0x01, 0xce, 0x01, 0xda, 0x01, 0xe8, 0x01,
+  0xfb, 0x01, 0x11, 0x02, 0x20, 0x02, 0x2e, 0x02, 0x38, 0x02, 0x46, 0x02,
+  0x00, 0x00, 0x16, 0x00, 0x25, 0x00, 0x33, 0x00, 0x3e, 0x00, 0x4c, 0x00,
+  0x5c, 0x00, 0x74, 0x00, 0x80, 0x00, 0x8c, 0x00, 0x97, 0x00, 0xa3, 0x00,
+  0xaf, 0x00, 0xbf, 0x00, 0xcb, 0x00, 0xd6, 0x00, 0xe4, 0x00, 0xf5, 0x00,
+  0x01, 0x01, 0x12, 0x01, 0x1e, 0x01, 0x29, 0x01, 0x39, 0x01, 0x45, 0x01,
+  0x53, 0x01, 0x65, 0x01, 0x70, 0x01, 0x79, 0x01, 0x85, 0x01, 0x94, 0x01,
+  0xa2, 0x01, 0xae, 0x01, 0xba, 0x01, 0xc8, 0x01, 0xd6, 0x01, 0xe2, 0x01,
+  0x00, 0x00, 0x0d, 0x00, 0x1b, 0x00, 0x29, 0x00, 0x3e, 0x00, 0x4a, 0x00,
+  0x61, 0x00, 0x6f, 0x00, 0x7b, 0x00, 0x8e, 0x00, 0x9c, 0x00, 0xa7, 0x00,
+  0xb3, 0x00, 0xbf, 0x00, 0xcb, 0x00, 0xd5, 0x00, 0xe1, 0x00, 0xeb, 0x00,
+  0xf7, 0x00, 0x03, 0x01, 0x0d, 0x01, 0x1b, 0x01, 0x25, 0x01, 0x2f, 0x01,
+  0x39, 0x01, 0x4a, 0x01, 0x58, 0x01, 0x64, 0x01, 0x70, 0x01, 0x7c, 0x01,
+  0x8a, 0x01, 0x94, 0x01, 0xa2, 0x01, 0xac, 0x01, 0xb8, 0x01, 0xc6, 0x01,
+  0xd0, 0x01, 0x00, 0x00, 0x23, 0x00, 0x36, 0x00, 0x45, 0x00, 0x53, 0x00,
+  0x61, 0x00, 0x71, 0x00, 0x7c, 0x00, 0x88, 0x00, 0x96, 0x00, 0xa1, 0x00,
+  0xaf, 0x00, 0xbe, 0x00, 0xcb, 0x00, 0xda, 0x00, 0xe8, 0x00, 0xf6, 0x00,
+  0x04, 0x01, 0x12, 0x01, 0x21, 0x01, 0x2c, 0x01, 0x3b, 0x01, 0x4c, 0x01,
+  0x58, 0x01, 0x64, 0x01, 0x72, 0x01, 0x81, 0x01, 0x8d, 0x01, 0x9b, 0x01,
+  0xa9, 0x01, 0xb7, 0x01, 0xc5, 0x01, 0xcf, 0x01, 0xdc, 0x01, 0xea, 0x01,
+  0xf5, 0x01, 0x03, 0x02, 0x11, 0x02, 0x1c, 0x02, 0x2a, 0x02, 0x38, 0x02,
+  0x47, 0x02, 0x52, 0x02, 0x5e, 0x02, 0x6a, 0x02, 0x78, 0x02, 0x83, 0x02,
+  0x00, 0x00, 0x1a, 0x00, 0x28, 0x00, 0x33, 0x00, 0x3f, 0x00, 0x4b, 0x00,
+  0x55, 0x00, 0x6b, 0x00, 0x81, 0x00, 0x8f, 0x00, 0x99, 0x00, 0xa5, 0x00,
+  0xb1, 0x00, 0xbd, 0x00, 0xcb, 0x00, 0xd4, 0x00, 0xe2, 0x00, 0xeb, 0x00,
+  0xf5, 0x00, 0xff, 0x00, 0x0e, 0x01, 0x21, 0x01, 0x2b, 0x01, 0x36, 0x01,
+  0x47, 0x01, 0x56, 0x01, 0x60, 0x01, 0x6e, 0x01, 0x7f, 0x01, 0x8e, 0x01,
+  0x00, 0x00, 0x23, 0x00, 0x31, 0x00, 0x41, 0x00, 0x4d, 0x00, 0x59, 0x00,
+  0x65, 0x00, 0x73, 0x00, 0x81, 0x00, 0x8d, 0x00, 0x9e, 0x00, 0xae, 0x00,
+  0xbc, 0x00, 0xca, 0x00, 0xd6, 0x00, 0xe7, 0x00, 0xf5, 0x00, 0x03, 0x01,
+  0x14, 0x01, 0x22, 0x01, 0x2e, 0x01, 0x3c, 0x01, 0x4a, 0x01, 0x5c, 0x01,
+  0x6a, 0x01, 0x7b, 0x01, 0x89, 0x01, 0x95, 0x01, 0xa3, 0x01, 0xb1, 0x01,
+  0xbd, 0x01, 0xc9, 0x01, 0xd7, 0x01, 0xe3, 0x01, 0xef, 0x01, 0x00, 0x00,
+  0x0e, 0x00, 0x1c, 0x00, 0x27, 0x00, 0x35, 0x00, 0x44, 0x00, 0x59, 0x00,
+  0x63, 0x00, 0x6f, 0x00, 0x7b, 0x00, 0x87, 0x00, 0x92, 0x00, 0xa0, 0x00,
+  0x00, 0x00, 0x1b, 0x00, 0x27, 0x00, 0x35, 0x00, 0x43, 0x00, 0x4f, 0x00,
+  0x5d, 0x00, 0x6e, 0x00, 0x7b, 0x00, 0x86, 0x00, 0x92, 0x00, 0xa0, 0x00,
+  0xaf, 0x00, 0xbe, 0x00, 0xca, 0x00, 0xd9, 0x00, 0xe8, 0x00, 0xf4, 0x00,
+  0x12, 0x01, 0x1e, 0x01, 0x29, 0x01, 0x35, 0x01, 0x43, 0x01, 0x51, 0x01,
+  0x5d, 0x01, 0x6c, 0x01, 0x78, 0x01, 0x83, 0x01, 0x92, 0x01, 0x9c, 0x01,
+  0xa6, 0x01, 0xb1, 0x01, 0xba, 0x01, 0xc5, 0x01, 0xd0, 0x01, 0xe1, 0x01,
+  0x00, 0x00, 0x28, 0x00, 0x3c, 0x00, 0x5b, 0x00, 0x67, 0x00, 0x76, 0x00,
+  0x81, 0x00, 0x8f, 0x00, 0x9c, 0x00, 0xa8, 0x00, 0xb4, 0x00, 0xc1, 0x00,
+  0xcb, 0x00, 0xe4, 0x00, 0xf1, 0x00, 0xfe, 0x00, 0x0b, 0x01, 0x17, 0x01,
+  0x24, 0x01, 0x32, 0x01, 0x3f, 0x01, 0x4c, 0x01, 0x59, 0x01, 0x65, 0x01,
+  0x6f, 0x01, 0x7b, 0x01, 0x88, 0x01, 0x92, 0x01, 0x9c, 0x01, 0xa9, 0x01,
+  0xb6, 0x01, 0xc2, 0x01, 0xd0, 0x01, 0xdc, 0x01, 0x00, 0x00, 0x2b, 0x00,
+  0x47, 0x00, 0x78, 0x00, 0x87, 0x00, 0x93, 0x00, 0xa2, 0x00, 0xc3, 0x00,
+  0xe4, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0x0c, 0x01, 0x1a, 0x01, 0x28, 0x01,
+  0x34, 0x01, 0x45, 0x01, 0x51, 0x01, 0x60, 0x01, 0x6e, 0x01, 0x7f, 0x01,
+  0x8e, 0x01, 0x00, 0x00, 0x1d, 0x00, 0x33, 0x00, 0x3f, 0x00, 0x4a, 0x00,
+  0x58, 0x00, 0x68, 0x00, 0x74, 0x00, 0x84, 0x00, 0x90, 0x00, 0xa0, 0x00,
+  0xb0, 0x00, 0xc0, 0x00, 0xcf, 0x00, 0xdf, 0x00, 0xea, 0x00, 0xf6, 0x00,
+  0x06, 0x01, 0x16, 0x01, 0x26, 0x01, 0x31, 0x01, 0x3f, 0x01, 0x4f, 0x01,
+  0x5f, 0x01, 0x76, 0x01, 0x86, 0x01, 0x96, 0x01, 0xa9, 0x01, 0xb4, 0x01,
+  0xc2, 0x01, 0xce, 0x01, 0xdd, 0x01, 0xee, 0x01, 0xfd, 0x01, 0x07, 0x02,
+  0x00, 0x00, 0x0f, 0x00, 0x1d, 0x00, 0x29, 0x00, 0x40, 0x00, 0x52, 0x00,
+  0x60, 0x00, 0x6f, 0x00, 0x7d, 0x00, 0x8c, 0x00, 0x98, 0x00, 0xa4, 0x00,
+  0xb0, 0x00, 0xbe, 0x00, 0xce, 0x00, 0xdc, 0x00, 0xe8, 0x00, 0xf7, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x1e, 0x00, 0x30, 0x00, 0x3c, 0x00, 0x48, 0x00,
+  0x59, 0x00, 0x67, 0x00, 0x75, 0x00, 0x85, 0x00, 0x97, 0x00, 0xa3, 0x00,
+  0xb5, 0x00, 0xc1, 0x00, 0xcd, 0x00, 0xd9, 0x00, 0xeb, 0x00, 0xf9, 0x00,
+  0x05, 0x01, 0x11, 0x01, 0x23, 0x01, 0x2f, 0x01, 0x44, 0x01, 0x00, 0x00,
+  0x11, 0x00, 0x20, 0x00, 0x2e, 0x00, 0x3e, 0x00, 0x4a, 0x00, 0x55, 0x00,
+  0x60, 0x00, 0x73, 0x00, 0x7f, 0x00, 0x8b, 0x00, 0x96, 0x00, 0xa4, 0x00,
+  0xb0, 0x00, 0xbb, 0x00, 0xc7, 0x00, 0xd2, 0x00, 0xdd, 0x00, 0xea, 0x00,
+  0xf5, 0x00, 0x01, 0x01, 0x0c, 0x01, 0x17, 0x01, 0x22, 0x01, 0x2f, 0x01,
+  0x3d, 0x01, 0x51, 0x01, 0x5c, 0x01, 0x67, 0x01, 0x72, 0x01, 0x7d, 0x01,
+  0x88, 0x01, 0x93, 0x01, 0x9e, 0x01, 0xa9, 0x01, 0xb4, 0x01, 0xbf, 0x01,
+  0xca, 0x01, 0xd8, 0x01, 0x00, 0x00, 0x20, 0x00, 0x38, 0x00, 0x4a, 0x00,
+  0x5b, 0x00, 0x6c, 0x00, 0x81, 0x00, 0x90, 0x00, 0x9b, 0x00, 0xa7, 0x00,
+  0xb6, 0x00, 0xca, 0x00, 0xd8, 0x00, 0x00, 0x00, 0x21, 0x00, 0x2f, 0x00,
+  0x3d, 0x00, 0x4b, 0x00, 0x59, 0x00, 0x67, 0x00, 0x75, 0x00, 0x83, 0x00,
+  0x92, 0x00, 0xa0, 0x00, 0xae, 0x00, 0xbc, 0x00, 0xca, 0x00, 0xdb, 0x00,
+  0xea, 0x00, 0xf8, 0x00, 0x09, 0x01, 0x17, 0x01, 0x2c, 0x01, 0x37, 0x01,
+  0x45, 0x01, 0x53, 0x01, 0x61, 0x01, 0x6f, 0x01, 0x7b, 0x01, 0x89, 0x01,
+  0x93, 0x01, 0x00, 0x00, 0x20, 0x00, 0x2e, 0x00, 0x43, 0x00, 0x59, 0x00,
+  0x6e, 0x00, 0x7a, 0x00, 0x8f, 0x00, 0xa1, 0x00, 0xb5, 0x00, 0xc7, 0x00,
+  0xd9, 0x00, 0xeb, 0x00, 0x01, 0x01, 0x13, 0x01, 0x00, 0x00, 0x10, 0x00,
+  0x1d, 0x00, 0x2a, 0x00, 0x35, 0x00, 0x41, 0x00, 0x4d, 0x00, 0x5a, 0x00,
+  0x66, 0x00, 0x76, 0x00, 0x82, 0x00, 0x90, 0x00, 0x9d, 0x00, 0xac, 0x00,
+  0xbd, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1a, 0x00, 0x26, 0x00,
+  0x32, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x18, 0x00, 0x24, 0x00, 0x32, 0x00,
+  0x40, 0x00, 0x4e, 0x00, 0x59, 0x00, 0x68, 0x00, 0x77, 0x00, 0x86, 0x00,
+  0x94, 0x00, 0xa2, 0x00, 0xaf, 0x00, 0xbd, 0x00, 0xcb, 0x00, 0xd9, 0x00,
+  0xe3, 0x00, 0xf1, 0x00, 0xff, 0x00, 0x0a, 0x01, 0x18, 0x01, 0x26, 0x01,
+  0x39, 0x01, 0x46, 0x01, 0x00, 0x00, 0x0f, 0x00, 0x20, 0x00, 0x31, 0x00,
+  0x3f, 0x00, 0x50, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x22, 0x00, 0x30, 0x00,
+  0x3a, 0x00, 0x4c, 0x00, 0x59, 0x00, 0x65, 0x00, 0x71, 0x00, 0x7d, 0x00,
+  0x89, 0x00, 0x95, 0x00, 0xa4, 0x00, 0xb0, 0x00, 0xbe, 0x00, 0xcd, 0x00,
+  0xd9, 0x00, 0xe6, 0x00, 0xf4, 0x00, 0x04, 0x01, 0x11, 0x01, 0x00, 0x00,
+  0x18, 0x00, 0x29, 0x00, 0x47, 0x00, 0x7a, 0x00, 0x86, 0x00, 0x92, 0x00,
+  0xa0, 0x00, 0xac, 0x00, 0xba, 0x00, 0xc8, 0x00, 0xd8, 0x00, 0xe4, 0x00,
+  0xf0, 0x00, 0xfc, 0x00, 0x0c, 0x01, 0x18, 0x01, 0x00, 0x00, 0x16, 0x00,
+  0x2e, 0x00, 0x40, 0x00, 0x50, 0x00, 0x60, 0x00, 0x70, 0x00, 0x84, 0x00,
+  0x94, 0x00, 0xa0, 0x00, 0xb0, 0x00, 0xc0, 0x00, 0xd1, 0x00, 0xe1, 0x00,
+  0xed, 0x00, 0xf8, 0x00, 0x02, 0x01, 0x12, 0x01, 0x1e, 0x01, 0x2e, 0x01,
+  0x3e, 0x01, 0x4e, 0x01, 0x58, 0x01, 0x66, 0x01, 0x79, 0x01, 0x85, 0x01,
+  0x95, 0x01, 0xa5, 0x01, 0xb5, 0x01, 0x00, 0x00, 0x28, 0x00, 0x37, 0x00,
+  0x45, 0x00, 0x51, 0x00, 0x5d, 0x00, 0x6c, 0x00, 0x7a, 0x00, 0x86, 0x00,
+  0x94, 0x00, 0xa0, 0x00, 0xac, 0x00, 0xb8, 0x00, 0xcc, 0x00, 0xd8, 0x00,
+  0xe4, 0x00, 0x00, 0x00, 0x25, 0x00, 0x35, 0x00, 0x47, 0x00, 0x58, 0x00,
+  0x64, 0x00, 0x76, 0x00, 0x88, 0x00, 0x9a, 0x00, 0xac, 0x00, 0xba, 0x00,
+  0xcc, 0x00, 0xde, 0x00, 0xea, 0x00, 0xf4, 0x00, 0x01, 0x01, 0x0e, 0x01,
+  0x1c, 0x01, 0x00, 0x00, 0x13, 0x00, 0x1d, 0x00, 0x28, 0x00, 0x32, 0x00,
+  0x3d, 0x00, 0x49, 0x00, 0x5a, 0x00, 0x69, 0x00, 0x78, 0x00, 0x84, 0x00,
+  0x8f, 0x00, 0x9d, 0x00, 0xab, 0x00, 0xb6, 0x00, 0xc2, 0x00, 0xd0, 0x00,
+  0xde, 0x00, 0xec, 0x00, 0xf7, 0x00, 0x03, 0x01, 0x10, 0x01, 0x23, 0x01,
+  0x35, 0x01, 0x3f, 0x01, 0x00, 0x00, 0x1a, 0x00, 0x39, 0x00, 0x5e, 0x00,
+  0x68, 0x00, 0x78, 0x00, 0x88, 0x00, 0x93, 0x00, 0xa7, 0x00, 0xb7, 0x00,
+  0xc2, 0x00, 0xd7, 0x00, 0xe3, 0x00, 0xee, 0x00, 0xf9, 0x00, 0x08, 0x01,
+  0x19, 0x01, 0x29, 0x01, 0x39, 0x01, 0x45, 0x01, 0x4f, 0x01, 0x64, 0x01,
+  0x73, 0x01, 0x7d, 0x01, 0x89, 0x01, 0x98, 0x01, 0xa8, 0x01, 0x00, 0x00,
+  0x13, 0x00, 0x2f, 0x00, 0x3e, 0x00, 0x4d, 0x00, 0x59, 0x00, 0x6c, 0x00,
+  0x78, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x39, 0x00, 0x61, 0x00, 0x6c, 0x00,
+  0x78, 0x00, 0x84, 0x00, 0x90, 0x00, 0xa3, 0x00, 0xb5, 0x00, 0xc1, 0x00,
+  0xcd, 0x00, 0xd9, 0x00, 0xe5, 0x00, 0xf1, 0x00, 0x03, 0x01, 0x0e, 0x01,
+  0x1a, 0x01, 0x2c, 0x01, 0x3f, 0x01, 0x4b, 0x01, 0x57, 0x01, 0x6e, 0x01,
+  0x84, 0x01, 0x90, 0x01, 0x9a, 0x01, 0xa6, 0x01, 0xb7, 0x01, 0xc2, 0x01,
+  0xce, 0x01, 0xdc, 0x01, 0xe8, 0x01, 0x00, 0x00, 0x0d, 0x00, 0x2d, 0x00,
+  0x47, 0x00, 0x52, 0x00, 0x5d, 0x00, 0x68, 0x00, 0x74, 0x00, 0x7f, 0x00,
+  0x8a, 0x00, 0x98, 0x00, 0xa3, 0x00, 0xae, 0x00, 0xb8, 0x00, 0xce, 0x00,
+  0xd9, 0x00, 0xed, 0x00, 0xf7, 0x00, 0x02, 0x01, 0x0e, 0x01, 0x1a, 0x01,
+  0x24, 0x01, 0x37, 0x01, 0x4b, 0x01, 0x5c, 0x01, 0x66, 0x01, 0x77, 0x01,
+  0x81, 0x01, 0x8d, 0x01, 0x98, 0x01, 0xa2, 0x01, 0xae, 0x01, 0xbf, 0x01,
+  0xc9, 0x01, 0xd3, 0x01, 0xdf, 0x01, 0xed, 0x01, 0x00, 0x00, 0x23, 0x00,
+  0x32, 0x00, 0x40, 0x00, 0x4c, 0x00, 0x58, 0x00, 0x63, 0x00, 0x6d, 0x00,
+  0x78, 0x00, 0x84, 0x00, 0x90, 0x00, 0x9b, 0x00, 0xa9, 0x00, 0xb7, 0x00,
+  0xc5, 0x00, 0xd4, 0x00, 0xdf, 0x00, 0xe9, 0x00, 0xf4, 0x00, 0x00, 0x00,
+  0x23, 0x00, 0x2e, 0x00, 0x3a, 0x00, 0x46, 0x00, 0x51, 0x00, 0x5c, 0x00,
+  0x6a, 0x00, 0x78, 0x00, 0x84, 0x00, 0x9c, 0x00, 0xa8, 0x00, 0xb4, 0x00,
+  0xc0, 0x00, 0xcc, 0x00, 0xd7, 0x00, 0xe2, 0x00, 0xee, 0x00, 0xfc, 0x00,
+  0x07, 0x01, 0x13, 0x01, 0x1e, 0x01, 0x29, 0x01, 0x34, 0x01, 0x42, 0x01,
+  0x4e, 0x01, 0x5a, 0x01, 0x68, 0x01, 0x80, 0x01, 0x8b, 0x01, 0x96, 0x01,
+  0xa4, 0x01, 0xb0, 0x01, 0xbe, 0x01, 0xca, 0x01, 0xd5, 0x01, 0xe2, 0x01,
+  0xf1, 0x01, 0xff, 0x01, 0x0a, 0x02, 0x15, 0x02, 0x20, 0x02, 0x2c, 0x02,
+  0x38, 0x02, 0x43, 0x02, 0x4f, 0x02, 0x5a, 0x02, 0x69, 0x02, 0x75, 0x02,
+  0x80, 0x02, 0x8c, 0x02, 0x98, 0x02, 0xa3, 0x02, 0xaf, 0x02, 0xba, 0x02,
+  0xc6, 0x02, 0xd4, 0x02, 0x00, 0x00, 0x0f, 0x00, 0x1b, 0x00, 0x27, 0x00,
+  0x33, 0x00, 0x49, 0x00, 0x54, 0x00, 0x62, 0x00, 0x6e, 0x00, 0x7c, 0x00,
+  0x88, 0x00, 0x94, 0x00, 0x9f, 0x00, 0xab, 0x00, 0xb9, 0x00, 0xc5, 0x00,
+  0xd1, 0x00, 0xe4, 0x00, 0xed, 0x00, 0xf6, 0x00, 0x08, 0x01, 0x16, 0x01,
+  0x24, 0x01, 0x2e, 0x01, 0x3a, 0x01, 0x50, 0x01, 0x5c, 0x01, 0x6a, 0x01,
+  0x76, 0x01, 0x7f, 0x01, 0x8e, 0x01, 0x9a, 0x01, 0xa6, 0x01, 0xb1, 0x01,
+  0x00, 0x00, 0x23, 0x00, 0x48, 0x00, 0x57, 0x00, 0x65, 0x00, 0x73, 0x00,
+  0x81, 0x00, 0x8f, 0x00, 0x9d, 0x00, 0xab, 0x00, 0xb9, 0x00, 0xc8, 0x00,
+  0xd6, 0x00, 0xe4, 0x00, 0xf2, 0x00, 0x00, 0x01, 0x0e, 0x01, 0x1c, 0x01,
+  0x2a, 0x01, 0x38, 0x01, 0x43, 0x01, 0x51, 0x01, 0x5f, 0x01, 0x6d, 0x01,
+  0x7b, 0x01, 0x87, 0x01, 0x98, 0x01, 0xa6, 0x01, 0xb0, 0x01, 0xbe, 0x01,
+  0xd8, 0x01, 0xe6, 0x01, 0xf2, 0x01, 0x00, 0x02, 0x0e, 0x02, 0x1a, 0x02,
+  0x28, 0x02, 0x36, 0x02, 0x44, 0x02, 0x52, 0x02, 0x5e, 0x02, 0x6c, 0x02,
+  0x78, 0x02, 0x84, 0x02, 0x92, 0x02, 0x9e, 0x02, 0xa8, 0x02, 0xb6, 0x02,
+  0xc3, 0x02, 0xd1, 0x02, 0xda, 0x02, 0xe6, 0x02, 0xf4, 0x02, 0xfd, 0x02,
+  0x0b, 0x03, 0x16, 0x03, 0x2b, 0x03, 0x36, 0x03, 0x44, 0x03, 0x52, 0x03,
+  0x60, 0x03, 0x6e, 0x03, 0x7c, 0x03, 0x8a, 0x03, 0x98, 0x03, 0xa6, 0x03,
+  0xb0, 0x03, 0xbe, 0x03, 0xcc, 0x03, 0xda, 0x03, 0xe8, 0x03, 0xf6, 0x03,
+  0x00, 0x04, 0x0a, 0x04, 0x18, 0x04, 0x22, 0x04, 0x30, 0x04, 0x3e, 0x04,
+  0x4a, 0x04, 0x58, 0x04, 0x66, 0x04, 0x75, 0x04, 0x83, 0x04, 0x91, 0x04,
+  0x9f, 0x04, 0xad, 0x04, 0xbb, 0x04, 0xc6, 0x04, 0xd4, 0x04, 0xe1, 0x04,
+  0xef, 0x04, 0xfd, 0x04, 0x08, 0x05, 0x14, 0x05, 0x23, 0x05, 0x31, 0x05,
+  0x00, 0x00, 0x1a, 0x00, 0x26, 0x00, 0x34, 0x00, 0x47, 0x00, 0x53, 0x00,
+  0x65, 0x00, 0x71, 0x00, 0x7d, 0x00, 0x89, 0x00, 0x94, 0x00, 0xa0, 0x00,
+  0xac, 0x00, 0xb7, 0x00, 0xc3, 0x00, 0xcf, 0x00, 0xe1, 0x00, 0xf3, 0x00,
+  0x02, 0x01, 0x0e, 0x01, 0x1a, 0x01, 0x26, 0x01, 0x30, 0x01, 0x3e, 0x01,
+  0x4c, 0x01, 0x58, 0x01, 0x67, 0x01, 0x76, 0x01, 0x00, 0x00, 0x11, 0x00,
+  0x1f, 0x00, 0x2d, 0x00, 0x3e, 0x00, 0x4c, 0x00, 0x55, 0x00, 0x61, 0x00,
+  0x6d, 0x00, 0x79, 0x00, 0x87, 0x00, 0x92, 0x00, 0xa0, 0x00, 0xac, 0x00,
+  0xbc, 0x00, 0xc9, 0x00, 0xd4, 0x00, 0xe0, 0x00, 0xec, 0x00, 0xf5, 0x00,
+  0x01, 0x01, 0x0c, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x38, 0x01, 0x44, 0x01,
+  0x52, 0x01, 0x5e, 0x01, 0x6a, 0x01, 0x76, 0x01, 0x82, 0x01, 0x92, 0x01,
+  0xa1, 0x01, 0xad, 0x01, 0xb9, 0x01, 0xcb, 0x01, 0xd9, 0x01, 0xe7, 0x01,
+  0xf7, 0x01, 0x08, 0x02, 0x13, 0x02, 0x24, 0x02, 0x30, 0x02, 0x39, 0x02,
+  0x47, 0x02, 0x00, 0x00, 0x1c, 0x00, 0x27, 0x00, 0x35, 0x00, 0x41, 0x00,
+  0x52, 0x00, 0x60, 0x00, 0x6c, 0x00, 0x75, 0x00, 0x7e, 0x00, 0x8e, 0x00,
+  0x9c, 0x00, 0xab, 0x00, 0xba, 0x00, 0xc7, 0x00, 0xd3, 0x00, 0xdc, 0x00,
+  0xe9, 0x00, 0xf8, 0x00, 0x06, 0x01, 0x14, 0x01, 0x25, 0x01, 0x34, 0x01,
+  0x41, 0x01, 0x4f, 0x01, 0x5c, 0x01, 0x6d, 0x01, 0x7c, 0x01, 0x8a, 0x01,
+  0x97, 0x01, 0xa0, 0x01, 0xb5, 0x01, 0xc4, 0x01, 0xd1, 0x01, 0x00, 0x00,
+  0x1c, 0x00, 0x28, 0x00, 0x34, 0x00, 0x40, 0x00, 0x52, 0x00, 0x5e, 0x00,
+  0x69, 0x00, 0x74, 0x00, 0x80, 0x00, 0x8c, 0x00, 0x9d, 0x00, 0xa9, 0x00,
+  0xbc, 0x00, 0xc8, 0x00, 0xd6, 0x00, 0xe1, 0x00, 0xef, 0x00, 0xf9, 0x00,
+  0x07, 0x01, 0x10, 0x01, 0x1a, 0x01, 0x28, 0x01, 0x34, 0x01, 0x42, 0x01,
+  0x4e, 0x01, 0x5a, 0x01, 0x00, 0x00, 0x0f, 0x00, 0x33, 0x00, 0x58, 0x00,
+  0x61, 0x00, 0x71, 0x00, 0x81, 0x00, 0x90, 0x00, 0xa2, 0x00, 0xb4, 0x00,
+  0xc0, 0x00, 0xcc, 0x00, 0xd8, 0x00, 0xe9, 0x00, 0xf1, 0x00, 0xfd, 0x00,
+  0x0c, 0x01, 0x15, 0x01, 0x21, 0x01, 0x31, 0x01, 0x41, 0x01, 0x53, 0x01,
+  0x5c, 0x01, 0x69, 0x01, 0x72, 0x01, 0x00, 0x00, 0x18, 0x00, 0x2a, 0x00,
+  0x36, 0x00, 0x44, 0x00, 0x56, 0x00, 0x62, 0x00, 0x74, 0x00, 0x83, 0x00,
+  0x8f, 0x00, 0xa1, 0x00, 0xad, 0x00, 0xbe, 0x00, 0xcf, 0x00, 0xdd, 0x00,
+  0xeb, 0x00, 0xf7, 0x00, 0x05, 0x01, 0x16, 0x01, 0x27, 0x01, 0x35, 0x01,
+  0x43, 0x01, 0x4c, 0x01, 0x59, 0x01, 0x65, 0x01, 0x71, 0x01, 0x7d, 0x01,
+  0x8b, 0x01, 0x97, 0x01, 0xa3, 0x01, 0xaf, 0x01, 0x00, 0x00, 0x1c, 0x00,
+  0x2a, 0x00, 0x39, 0x00, 0x4b, 0x00, 0x59, 0x00, 0x6a, 0x00, 0x7c, 0x00,
+  0x88, 0x00, 0x96, 0x00, 0xa2, 0x00, 0xb4, 0x00, 0xbe, 0x00, 0xca, 0x00,
+  0xd7, 0x00, 0xe9, 0x00, 0xfb, 0x00, 0x07, 0x01, 0x19, 0x01, 0x25, 0x01,
+  0x37, 0x01, 0x43, 0x01, 0x55, 0x01, 0x5f, 0x01, 0x71, 0x01, 0x7f, 0x01,
+  0x89, 0x01, 0x95, 0x01, 0x00, 0x00, 0x11, 0x00, 0x20, 0x00, 0x2e, 0x00,
+  0x3c, 0x00, 0x4a, 0x00, 0x58, 0x00, 0x66, 0x00, 0x7a, 0x00, 0x86, 0x00,
+  0x92, 0x00, 0x9d, 0x00, 0xa9, 0x00, 0xb5, 0x00, 0xc1, 0x00, 0xd5, 0x00,
+  0xe1, 0x00, 0xf5, 0x00, 0x01, 0x01, 0x15, 0x01, 0x23, 0x01, 0x37, 0x01,
+  0x41, 0x01, 0x50, 0x01, 0x5b, 0x01, 0x65, 0x01, 0x75, 0x01, 0x84, 0x01,
+  0x90, 0x01, 0x9c, 0x01, 0xa6, 0x01, 0xb5, 0x01, 0x00, 0x00, 0x10, 0x00,
+  0x19, 0x00, 0x2d, 0x00, 0x38, 0x00, 0x4c, 0x00, 0x56, 0x00, 0x66, 0x00,
+  0x74, 0x00, 0x84, 0x00, 0x94, 0x00, 0xa3, 0x00, 0xb4, 0x00, 0xcb, 0x00,
+  0xd8, 0x00, 0xe2, 0x00, 0xee, 0x00, 0xfa, 0x00, 0x09, 0x01, 0x14, 0x01,
+  0x1e, 0x01, 0x29, 0x01, 0x34, 0x01, 0x41, 0x01, 0x50, 0x01, 0x62, 0x01,
+  0x6e, 0x01, 0x82, 0x01, 0x96, 0x01, 0xad, 0x01, 0x00, 0x00, 0x11, 0x00,
+  0x1f, 0x00, 0x31, 0x00, 0x3d, 0x00, 0x4c, 0x00, 0x58, 0x00, 0x6e, 0x00,
+  0x7a, 0x00, 0x86, 0x00, 0x92, 0x00, 0x9e, 0x00, 0xaa, 0x00, 0xb8, 0x00,
+  0xc4, 0x00, 0xd2, 0x00, 0xde, 0x00, 0xed, 0x00, 0xfc, 0x00, 0x08, 0x01,
+  0x14, 0x01, 0x20, 0x01, 0x31, 0x01, 0x43, 0x01, 0x54, 0x01, 0x00, 0x00,
+  0x0f, 0x00, 0x20, 0x00, 0x30, 0x00, 0x44, 0x00, 0x53, 0x00, 0x65, 0x00,
+  0x71, 0x00, 0x7b, 0x00, 0x86, 0x00, 0x90, 0x00, 0xa3, 0x00, 0xaf, 0x00,
+  0xb9, 0x00, 0xc7, 0x00, 0x00, 0x00, 0x11, 0x00, 0x22, 0x00, 0x30, 0x00,
+  0x3e, 0x00, 0x4d, 0x00, 0x5c, 0x00, 0x6a, 0x00, 0x78, 0x00, 0x87, 0x00,
+  0x95, 0x00, 0xa4, 0x00, 0xb2, 0x00, 0xca, 0x00, 0xd8, 0x00, 0xe3, 0x00,
+  0xed, 0x00, 0xf7, 0x00, 0x06, 0x01, 0x1c, 0x01, 0x26, 0x01, 0x38, 0x01,
+  0x49, 0x01, 0x58, 0x01, 0x63, 0x01, 0x6e, 0x01, 0x7c, 0x01, 0x90, 0x01,
+  0x9b, 0x01, 0xac, 0x01, 0xb8, 0x01, 0xc4, 0x01, 0xd2, 0x01, 0xe0, 0x01,
+  0xee, 0x01, 0x00, 0x00, 0x0d, 0x00, 0x1e, 0x00, 0x2c, 0x00, 0x38, 0x00,
+  0x44, 0x00, 0x4f, 0x00, 0x5b, 0x00, 0x69, 0x00, 0x7e, 0x00, 0x89, 0x00,
+  0x95, 0x00, 0x9f, 0x00, 0xa9, 0x00, 0xb7, 0x00, 0xc3, 0x00, 0xcd, 0x00,
+  0xd7, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x17, 0x00, 0x22, 0x00, 0x2e, 0x00,
+  0x3e, 0x00, 0x4c, 0x00, 0x58, 0x00, 0x64, 0x00, 0x75, 0x00, 0x80, 0x00,
+  0x8b, 0x00, 0x97, 0x00, 0xa2, 0x00, 0xad, 0x00, 0xb8, 0x00, 0xd2, 0x00,
+  0xe0, 0x00, 0xee, 0x00, 0xff, 0x00, 0x0a, 0x01, 0x15, 0x01, 0x00, 0x00,
+  0x0b, 0x00, 0x16, 0x00, 0x25, 0x00, 0x34, 0x00, 0x3f, 0x00, 0x54, 0x00,
+  0x60, 0x00, 0x6a, 0x00, 0x75, 0x00, 0x84, 0x00, 0x00, 0x00, 0x0f, 0x00,
+  0x1d, 0x00, 0x2b, 0x00, 0x39, 0x00, 0x44, 0x00, 0x52, 0x00, 0x60, 0x00,
+  0x6f, 0x00, 0x7d, 0x00, 0x8b, 0x00, 0x99, 0x00, 0xa8, 0x00, 0xb6, 0x00,
+  0xc4, 0x00, 0xd2, 0x00, 0xe0, 0x00, 0xeb, 0x00, 0xfa, 0x00, 0x08, 0x01,
+  0x19, 0x01, 0x28, 0x01, 0x36, 0x01, 0x44, 0x01, 0x4e, 0x01, 0x5c, 0x01,
+  0x6a, 0x01, 0x78, 0x01, 0x86, 0x01, 0x94, 0x01, 0xa2, 0x01, 0xb0, 0x01,
+  0xbe, 0x01, 0xcf, 0x01, 0xdd, 0x01, 0xeb, 0x01, 0xf9, 0x01, 0x07, 0x02,
+  0x16, 0x02, 0x24, 0x02, 0x30, 0x02, 0x3f, 0x02, 0x4b, 0x02, 0x59, 0x02,
+  0x67, 0x02, 0x75, 0x02, 0x83, 0x02, 0x91, 0x02, 0x9b, 0x02, 0xae, 0x02,
+  0xbd, 0x02, 0xcb, 0x02, 0xd9, 0x02, 0xed, 0x02, 0xfb, 0x02, 0x09, 0x03,
+  0x15, 0x03, 0x23, 0x03, 0x31, 0x03, 0x3f, 0x03, 0x4b, 0x03, 0x59, 0x03,
+  0x64, 0x03, 0x71, 0x03, 0x7f, 0x03, 0x8d, 0x03, 0x98, 0x03, 0x00, 0x00,
+  0x10, 0x00, 0x1e, 0x00, 0x2e, 0x00, 0x4c, 0x00, 0x5d, 0x00, 0x69, 0x00,
+  0x75, 0x00, 0x80, 0x00, 0x96, 0x00, 0xa1, 0x00, 0xad, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x1c, 0x00, 0x2c, 0x00, 0x3d, 0x00, 0x4d, 0x00, 0x58, 0x00,
+  0x69, 0x00, 0x74, 0x00, 0x80, 0x00, 0x91, 0x00, 0x9d, 0x00, 0xa9, 0x00,
+  0xba, 0x00, 0xcb, 0x00, 0xdc, 0x00, 0xed, 0x00, 0xfb, 0x00, 0x09, 0x01,
+  0x15, 0x01, 0x21, 0x01, 0x2d, 0x01, 0x3e, 0x01, 0x4f, 0x01, 0x5c, 0x01,
+  0x6a, 0x01, 0x7b, 0x01, 0x00, 0x00, 0x0b, 0x00, 0x16, 0x00, 0x26, 0x00,
+  0x43, 0x00, 0x4f, 0x00, 0x5e, 0x00, 0x70, 0x00, 0x7e, 0x00, 0x8c, 0x00,
+  0x9a, 0x00, 0xab, 0x00, 0xb9, 0x00, 0xc7, 0x00, 0xd4, 0x00, 0xe0, 0x00,
+  0xed, 0x00, 0xf9, 0x00, 0x06, 0x01, 0x13, 0x01, 0x00, 0x00, 0x10, 0x00,
+  0x1e, 0x00, 0x29, 0x00, 0x37, 0x00, 0x4a, 0x00, 0x59, 0x00, 0x67, 0x00,
+  0x75, 0x00, 0x81, 0x00, 0x8f, 0x00, 0xa1, 0x00, 0xaf, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x1f, 0x00, 0x2f, 0x00, 0x3a, 0x00, 0x4a, 0x00, 0x5a, 0x00,
+  0x69, 0x00, 0x79, 0x00, 0x86, 0x00, 0x91, 0x00, 0xa1, 0x00, 0xb0, 0x00,
+  0xc0, 0x00, 0xd1, 0x00, 0xdf, 0x00, 0xef, 0x00, 0xff, 0x00, 0x0b, 0x01,
+  0x1c, 0x01, 0x2c, 0x01, 0x3c, 0x01, 0x00, 0x00, 0x10, 0x00, 0x21, 0x00,
+  0x2d, 0x00, 0x3b, 0x00, 0x4a, 0x00, 0x56, 0x00, 0x64, 0x00, 0x72, 0x00,
+  0x7e, 0x00, 0x90, 0x00, 0x9f, 0x00, 0xb1, 0x00, 0xbf, 0x00, 0xd0, 0x00,
+  0xdc, 0x00, 0xea, 0x00, 0xfb, 0x00, 0x00, 0x00, 0x12, 0x00, 0x23, 0x00,
+  0x31, 0x00, 0x43, 0x00, 0x56, 0x00, 0x62, 0x00, 0x74, 0x00, 0x86, 0x00,
+  0x93, 0x00, 0xa1, 0x00, 0xae, 0x00, 0xbb, 0x00, 0xcd, 0x00, 0xe0, 0x00,
+  0xec, 0x00, 0xf8, 0x00, 0x02, 0x01, 0x00, 0x00, 0x10, 0x00, 0x1c, 0x00,
+  0x27, 0x00, 0x35, 0x00, 0x49, 0x00, 0x55, 0x00, 0x69, 0x00, 0x75, 0x00,
+  0x89, 0x00, 0x95, 0x00, 0xa0, 0x00, 0xaa, 0x00, 0xbf, 0x00, 0xd3, 0x00,
+  0xdf, 0x00, 0xed, 0x00, 0x00, 0x01, 0x14, 0x01, 0x28, 0x01, 0x34, 0x01,
+  0x42, 0x01, 0x00, 0x00, 0x11, 0x00, 0x2c, 0x00, 0x3c, 0x00, 0x47, 0x00,
+  0x51, 0x00, 0x5d, 0x00, 0x6c, 0x00, 0x77, 0x00, 0x82, 0x00, 0x96, 0x00,
+  0xa6, 0x00, 0xba, 0x00, 0xc3, 0x00, 0xd4, 0x00, 0xe8, 0x00, 0x00, 0x00,
+  0x18, 0x00, 0x22, 0x00, 0x32, 0x00, 0x40, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x1d, 0x00, 0x29, 0x00, 0x35, 0x00, 0x41, 0x00, 0x4d, 0x00, 0x59, 0x00,
+  0x65, 0x00, 0x71, 0x00, 0x7d, 0x00, 0x92, 0x00, 0xa1, 0x00, 0xad, 0x00,
+  0xc2, 0x00, 0xce, 0x00, 0xda, 0x00, 0xe6, 0x00, 0xf2, 0x00, 0xfe, 0x00,
+  0x0c, 0x01, 0x1e, 0x01, 0x30, 0x01, 0x3e, 0x01, 0x4a, 0x01, 0x53, 0x01,
+  0x00, 0x00, 0x0f, 0x00, 0x23, 0x00, 0x2e, 0x00, 0x39, 0x00, 0x4d, 0x00,
+  0x59, 0x00, 0x64, 0x00, 0x70, 0x00, 0x7e, 0x00, 0x8a, 0x00, 0x95, 0x00,
+  0xa1, 0x00, 0xaf, 0x00, 0xc0, 0x00, 0xcc, 0x00, 0xd7, 0x00, 0xe2, 0x00,
+  0xf0, 0x00, 0xfc, 0x00, 0x15, 0x01, 0x26, 0x01, 0x32, 0x01, 0x4a, 0x01,
+  0x55, 0x01, 0x61, 0x01, 0x72, 0x01, 0x7d, 0x01, 0x00, 0x00, 0x16, 0x00,
+  0x25, 0x00, 0x31, 0x00, 0x3d, 0x00, 0x4b, 0x00, 0x57, 0x00, 0x65, 0x00,
+  0x6f, 0x00, 0x7b, 0x00, 0x87, 0x00, 0x95, 0x00, 0xa1, 0x00, 0xb0, 0x00,
+  0xc8, 0x00, 0xd4, 0x00, 0xe5, 0x00, 0xf0, 0x00, 0xff, 0x00, 0x0b, 0x01,
+  0x17, 0x01, 0x25, 0x01, 0x00, 0x00, 0x1a, 0x00, 0x26, 0x00, 0x34, 0x00,
+  0x40, 0x00, 0x4e, 0x00, 0x5c, 0x00, 0x67, 0x00, 0x75, 0x00, 0x81, 0x00,
+  0x8d, 0x00, 0x98, 0x00, 0xa3, 0x00, 0xb4, 0x00, 0xc5, 0x00, 0xd3, 0x00,
+  0xe2, 0x00, 0xee, 0x00, 0xf9, 0x00, 0x07, 0x01, 0x12, 0x01, 0x1e, 0x01,
+  0x2c, 0x01, 0x37, 0x01, 0x43, 0x01, 0x4e, 0x01, 0x5a, 0x01, 0x65, 0x01,
+  0x70, 0x01, 0x7b, 0x01, 0x86, 0x01, 0x92, 0x01, 0x9d, 0x01, 0xa8, 0x01,
+  0xb5, 0x01, 0xc1, 0x01, 0xcc, 0x01, 0xd7, 0x01, 0xe3, 0x01, 0xef, 0x01,
+  0xfb, 0x01, 0x09, 0x02, 0x14, 0x02, 0x21, 0x02, 0x2d, 0x02, 0x00, 0x00,
+  0x1a, 0x00, 0x26, 0x00, 0x32, 0x00, 0x3e, 0x00, 0x4c, 0x00, 0x65, 0x00,
+  0x76, 0x00, 0x83, 0x00, 0x8f, 0x00, 0xa0, 0x00, 0xac, 0x00, 0xb8, 0x00,
+  0xc9, 0x00, 0xd5, 0x00, 0xe7, 0x00, 0xf7, 0x00, 0x01, 0x01, 0x00, 0x00,
+  0x0e, 0x00, 0x1c, 0x00, 0x2b, 0x00, 0x39, 0x00, 0x47, 0x00, 0x53, 0x00,
+  0x61, 0x00, 0x70, 0x00, 0x7c, 0x00, 0x87, 0x00, 0x96, 0x00, 0xa4, 0x00,
+  0xb0, 0x00, 0xbc, 0x00, 0xc8, 0x00, 0xd6, 0x00, 0xe4, 0x00, 0xf2, 0x00,
+  0x00, 0x01, 0x0e, 0x01, 0x1c, 0x01, 0x30, 0x01, 0x3c, 0x01, 0x47, 0x01,
+  0x52, 0x01, 0x60, 0x01, 0x6e, 0x01, 0x7c, 0x01, 0x8a, 0x01, 0x98, 0x01,
+  0xa4, 0x01, 0xb3, 0x01, 0xc0, 0x01, 0xcf, 0x01, 0xda, 0x01, 0xe8, 0x01,
+  0xf6, 0x01, 0x02, 0x02, 0x10, 0x02, 0x1e, 0x02, 0x2c, 0x02, 0x3a, 0x02,
+  0x48, 0x02, 0x56, 0x02, 0x64, 0x02, 0x72, 0x02, 0x7c, 0x02, 0x88, 0x02,
+  0x98, 0x02, 0xa4, 0x02, 0xb0, 0x02, 0xbe, 0x02, 0xcc, 0x02, 0xda, 0x02,
+  0xe8, 0x02, 0x00, 0x00, 0x1b, 0x00, 0x27, 0x00, 0x36, 0x00, 0x44, 0x00,
+  0x53, 0x00, 0x62, 0x00, 0x71, 0x00, 0x7b, 0x00, 0x8a, 0x00, 0x98, 0x00,
+  0xa4, 0x00, 0xb0, 0x00, 0xbc, 0x00, 0xc6, 0x00, 0xd4, 0x00, 0xe0, 0x00,
+  0xec, 0x00, 0xf9, 0x00, 0x08, 0x01, 0x15, 0x01, 0x22, 0x01, 0x2c, 0x01,
+  0x3e, 0x01, 0x4c, 0x01, 0x58, 0x01, 0x62, 0x01, 0x6e, 0x01, 0x7d, 0x01,
+  0x87, 0x01, 0x91, 0x01, 0x00, 0x00, 0x10, 0x00, 0x1c, 0x00, 0x2c, 0x00,
+  0x37, 0x00, 0x42, 0x00, 0x4e, 0x00, 0x5a, 0x00, 0x68, 0x00, 0x74, 0x00,
+  0x80, 0x00, 0x8b, 0x00, 0x99, 0x00, 0xa5, 0x00, 0xb1, 0x00, 0xbd, 0x00,
+  0xc9, 0x00, 0xd5, 0x00, 0xe5, 0x00, 0xf0, 0x00, 0x01, 0x01, 0x0f, 0x01,
+  0x1a, 0x01, 0x2b, 0x01, 0x39, 0x01, 0x47, 0x01, 0x57, 0x01, 0x62, 0x01,
+  0x79, 0x01, 0x84, 0x01, 0x90, 0x01, 0x9c, 0x01, 0xad, 0x01, 0xbd, 0x01,
+  0xc9, 0x01, 0xd7, 0x01, 0xe8, 0x01, 0xf6, 0x01, 0x05, 0x02, 0x11, 0x02,
+  0x00, 0x00, 0x18, 0x00, 0x2a, 0x00, 0x35, 0x00, 0x40, 0x00, 0x52, 0x00,
+  0x60, 0x00, 0x71, 0x00, 0x7a, 0x00, 0x89, 0x00, 0x95, 0x00, 0xa3, 0x00,
+  0xb1, 0x00, 0xc0, 0x00, 0xd1, 0x00, 0xdd, 0x00, 0xea, 0x00, 0xf4, 0x00,
+  0x02, 0x01, 0x0f, 0x01, 0x1a, 0x01, 0x27, 0x01, 0x34, 0x01, 0x41, 0x01,
+  0x4f, 0x01, 0x60, 0x01, 0x6c, 0x01, 0x79, 0x01, 0x85, 0x01, 0x91, 0x01,
+  0x9e, 0x01, 0xac, 0x01, 0xb9, 0x01, 0xc8, 0x01, 0xd4, 0x01, 0xe3, 0x01,
+  0xf5, 0x01, 0x00, 0x02, 0x10, 0x02, 0x1d, 0x02, 0x2b, 0x02, 0x37, 0x02,
+  0x43, 0x02, 0x50, 0x02, 0x00, 0x00, 0x0c, 0x00, 0x18, 0x00, 0x24, 0x00,
+  0x32, 0x00, 0x41, 0x00, 0x4f, 0x00, 0x5d, 0x00, 0x69, 0x00, 0x74, 0x00,
+  0x7f, 0x00, 0x89, 0x00, 0x95, 0x00, 0xa3, 0x00, 0xb2, 0x00, 0xbd, 0x00,
+  0xc7, 0x00, 0xd1, 0x00, 0xdf, 0x00, 0xeb, 0x00, 0xf5, 0x00, 0x03, 0x01,
+  0x11, 0x01, 0x1d, 0x01, 0x2f, 0x01, 0x3e, 0x01, 0x4d, 0x01, 0x59, 0x01,
+  0x65, 0x01, 0x6f, 0x01, 0x7d, 0x01, 0x88, 0x01, 0x97, 0x01, 0xa2, 0x01,
+  0xac, 0x01, 0xb6, 0x01, 0x00, 0x00, 0x10, 0x00, 0x22, 0x00, 0x32, 0x00,
+  0x43, 0x00, 0x54, 0x00, 0x5f, 0x00, 0x69, 0x00, 0x78, 0x00, 0x86, 0x00,
+  0x96, 0x00, 0xa6, 0x00, 0xb2, 0x00, 0xbd, 0x00, 0xcd, 0x00, 0xdf, 0x00,
+  0xea, 0x00, 0xfc, 0x00, 0x0c, 0x01, 0x1c, 0x01, 0x2a, 0x01, 0x35, 0x01,
+  0x44, 0x01, 0x54, 0x01, 0x64, 0x01, 0x74, 0x01, 0x82, 0x01, 0x92, 0x01,
+  0xa2, 0x01, 0xb1, 0x01, 0xbb, 0x01, 0xca, 0x01, 0xd6, 0x01, 0xe2, 0x01,
+  0xee, 0x01, 0xf8, 0x01, 0x08, 0x02, 0x12, 0x02, 0x00, 0x00, 0x13, 0x00,
+  0x29, 0x00, 0x36, 0x00, 0x42, 0x00, 0x52, 0x00, 0x5e, 0x00, 0x6a, 0x00,
+  0x7b, 0x00, 0x87, 0x00, 0x98, 0x00, 0xa4, 0x00, 0xb0, 0x00, 0xbe, 0x00,
+  0xca, 0x00, 0xd6, 0x00, 0xe4, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0x0c, 0x01,
+  0x1a, 0x01, 0x26, 0x01, 0x32, 0x01, 0x3e, 0x01, 0x00, 0x00, 0x22, 0x00,
+  0x2e, 0x00, 0x3d, 0x00, 0x49, 0x00, 0x55, 0x00, 0x61, 0x00, 0x73, 0x00,
+  0x82, 0x00, 0x8c, 0x00, 0x98, 0x00, 0xa2, 0x00, 0xae, 0x00, 0xbd, 0x00,
+  0xc9, 0x00, 0xd5, 0x00, 0xe5, 0x00, 0xf1, 0x00, 0x03, 0x01, 0x00, 0x00,
+  0x0f, 0x00, 0x19, 0x00, 0x24, 0x00, 0x32, 0x00, 0x41, 0x00, 0x4e, 0x00,
+  0x59, 0x00, 0x64, 0x00, 0x6e, 0x00, 0x79, 0x00, 0x85, 0x00, 0x91, 0x00,
+  0x9c, 0x00, 0xa6, 0x00, 0xb4, 0x00, 0xbf, 0x00, 0xca, 0x00, 0xd5, 0x00,
+  0xe1, 0x00, 0xec, 0x00, 0xf6, 0x00, 0x06, 0x01, 0x11, 0x01, 0x1b, 0x01,
+  0x28, 0x01, 0x39, 0x01, 0x44, 0x01, 0x4f, 0x01, 0x5b, 0x01, 0x66, 0x01,
+  0x74, 0x01, 0x82, 0x01, 0x8c, 0x01, 0x9e, 0x01, 0xa8, 0x01, 0xb4, 0x01,
+  0xc2, 0x01, 0x00, 0x00, 0x14, 0x00, 0x20, 0x00, 0x31, 0x00, 0x42, 0x00,
+  0x50, 0x00, 0x5c, 0x00, 0x6c, 0x00, 0x7c, 0x00, 0x8d, 0x00, 0x9f, 0x00,
+  0xae, 0x00, 0xbe, 0x00, 0xca, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x29, 0x00,
+  0x37, 0x00, 0x46, 0x00, 0x56, 0x00, 0x6b, 0x00, 0x77, 0x00, 0x81, 0x00,
+  0x8d, 0x00, 0x9e, 0x00, 0xaa, 0x00, 0xba, 0x00, 0xc6, 0x00, 0xd2, 0x00,
+  0xe0, 0x00, 0x00, 0x00, 0x18, 0x00, 0x2a, 0x00, 0x3c, 0x00, 0x4e, 0x00,
+  0x5a, 0x00, 0x68, 0x00, 0x7a, 0x00, 0x8c, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x21, 0x00, 0x30, 0x00, 0x3e, 0x00, 0x49, 0x00, 0x54, 0x00, 0x64, 0x00,
+  0x73, 0x00, 0x8a, 0x00, 0x99, 0x00, 0xa4, 0x00, 0xb1, 0x00, 0xbf, 0x00,
+  0xcd, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1a, 0x00, 0x26, 0x00, 0x32, 0x00,
+  0x3e, 0x00, 0x53, 0x00, 0x5f, 0x00, 0x6d, 0x00, 0x7b, 0x00, 0x00, 0x00,
+  0x18, 0x00, 0x23, 0x00, 0x2f, 0x00, 0x3a, 0x00, 0x45, 0x00, 0x51, 0x00,
+  0x5c, 0x00, 0x6f, 0x00, 0x7a, 0x00, 0x8a, 0x00, 0x96, 0x00, 0xa2, 0x00,
+  0xae, 0x00, 0xb9, 0x00, 0xc4, 0x00, 0xd0, 0x00, 0xdb, 0x00, 0xe6, 0x00,
+  0xf1, 0x00, 0xfc, 0x00, 0x07, 0x01, 0x12, 0x01, 0x1e, 0x01, 0x29, 0x01,
+  0x34, 0x01, 0x3f, 0x01, 0x53, 0x01, 0x00, 0x00, 0x18, 0x00, 0x2a, 0x00,
+  0x40, 0x00, 0x50, 0x00, 0x5b, 0x00, 0x6b, 0x00, 0x77, 0x00, 0x8a, 0x00,
+  0x95, 0x00, 0xa6, 0x00, 0xb9, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1e, 0x00,
+  0x2c, 0x00, 0x3a, 0x00, 0x46, 0x00, 0x54, 0x00, 0x62, 0x00, 0x6e, 0x00,
+  0x7c, 0x00, 0x8d, 0x00, 0x9b, 0x00, 0xa9, 0x00, 0xb7, 0x00, 0xc2, 0x00,
+  0xd1, 0x00, 0xe0, 0x00, 0xee, 0x00, 0xfc, 0x00, 0x0a, 0x01, 0x16, 0x01,
+  0x24, 0x01, 0x32, 0x01, 0x40, 0x01, 0x4c, 0x01, 0x5b, 0x01, 0x67, 0x01,
+  0x75, 0x01, 0x83, 0x01, 0x91, 0x01, 0xa2, 0x01, 0xb1, 0x01, 0xbf, 0x01,
+  0xcd, 0x01, 0xdb, 0x01, 0xe9, 0x01, 0xf7, 0x01, 0x05, 0x02, 0x13, 0x02,
+  0x21, 0x02, 0x2c, 0x02, 0x00, 0x00, 0x1a, 0x00, 0x29, 0x00, 0x35, 0x00,
+  0x40, 0x00, 0x4c, 0x00, 0x59, 0x00, 0x67, 0x00, 0x77, 0x00, 0x81, 0x00,
+  0x8d, 0x00, 0x99, 0x00, 0x00, 0x00, 0x10, 0x00, 0x1b, 0x00, 0x2b, 0x00,
+  0x3b, 0x00, 0x4c, 0x00, 0x58, 0x00, 0x69, 0x00, 0x79, 0x00, 0x85, 0x00,
+  0x91, 0x00, 0xa2, 0x00, 0xae, 0x00, 0xbf, 0x00, 0xca, 0x00, 0xd5, 0x00,
+  0xe0, 0x00, 0xec, 0x00, 0xf8, 0x00, 0x03, 0x01, 0x00, 0x00, 0x0d, 0x00,
+  0x1c, 0x00, 0x29, 0x00, 0x36, 0x00, 0x43, 0x00, 0x4d, 0x00, 0x5c, 0x00,
+  0x6b, 0x00, 0x78, 0x00, 0x85, 0x00, 0x94, 0x00, 0xa1, 0x00, 0xb0, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x1f, 0x00, 0x2d, 0x00, 0x39, 0x00, 0x44, 0x00,
+  0x50, 0x00, 0x5e, 0x00, 0x69, 0x00, 0x77, 0x00, 0x82, 0x00, 0x8f, 0x00,
+  0x9a, 0x00, 0xa5, 0x00, 0x00, 0x00, 0x26, 0x00, 0x36, 0x00, 0x46, 0x00,
+  0x57, 0x00, 0x63, 0x00, 0x73, 0x00, 0x7e, 0x00, 0x8c, 0x00, 0x9c, 0x00,
+  0xac, 0x00, 0xbc, 0x00, 0xcb, 0x00, 0xdc, 0x00, 0xec, 0x00, 0xfc, 0x00,
+  0x0c, 0x01, 0x18, 0x01, 0x24, 0x01, 0x30, 0x01, 0x3d, 0x01, 0x00, 0x00,
+  0x0c, 0x00, 0x18, 0x00, 0x29, 0x00, 0x37, 0x00, 0x48, 0x00, 0x58, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x13, 0x00, 0x26, 0x00, 0x38, 0x00, 0x4a, 0x00,
+  0x5c, 0x00, 0x6d, 0x00, 0x80, 0x00, 0x92, 0x00, 0xa4, 0x00, 0xb0, 0x00,
+  0xba, 0x00, 0xcc, 0x00, 0xde, 0x00, 0xe9, 0x00, 0xfb, 0x00, 0x0d, 0x01,
+  0x1c, 0x01, 0x2e, 0x01, 0x40, 0x01, 0x51, 0x01, 0x5f, 0x01, 0x69, 0x01,
+  0x75, 0x01, 0x7f, 0x01, 0x8d, 0x01, 0x00, 0x00, 0x13, 0x00, 0x22, 0x00,
+  0x2e, 0x00, 0x3a, 0x00, 0x46, 0x00, 0x51, 0x00, 0x5d, 0x00, 0x6b, 0x00,
+  0x76, 0x00, 0x80, 0x00, 0x8e, 0x00, 0x9a, 0x00, 0xa5, 0x00, 0xaf, 0x00,
+  0xbd, 0x00, 0xc8, 0x00, 0xd4, 0x00, 0xe3, 0x00, 0xf7, 0x00, 0x02, 0x01,
+  0x0e, 0x01, 0x19, 0x01, 0x00, 0x00, 0x12, 0x00, 0x1c, 0x00, 0x27, 0x00,
+  0x35, 0x00, 0x3f, 0x00, 0x4f, 0x00, 0x58, 0x00, 0x68, 0x00, 0x76, 0x00,
+  0x80, 0x00, 0x91, 0x00, 0x9a, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x1c, 0x00, 0x2b, 0x00, 0x3a, 0x00, 0x4a, 0x00, 0x59, 0x00, 0x68, 0x00,
+  0x79, 0x00, 0x00, 0x00, 0x14, 0x00, 0x20, 0x00, 0x2f, 0x00, 0x40, 0x00,
+  0x4c, 0x00, 0x57, 0x00, 0x63, 0x00, 0x6e, 0x00, 0x7a, 0x00, 0x88, 0x00,
+  0x94, 0x00, 0x9f, 0x00, 0xab, 0x00, 0xb5, 0x00, 0xc0, 0x00, 0xd6, 0x00,
+  0xe2, 0x00, 0xf8, 0x00, 0x0e, 0x01, 0x18, 0x01, 0x22, 0x01, 0x34, 0x01,
+  0x40, 0x01, 0x51, 0x01, 0x5b, 0x01, 0x72, 0x01, 0x00, 0x00, 0x0f, 0x00,
+  0x1a, 0x00, 0x26, 0x00, 0x3a, 0x00, 0x44, 0x00, 0x4f, 0x00, 0x59, 0x00,
+  0x6a, 0x00, 0x75, 0x00, 0x80, 0x00, 0x8a, 0x00, 0x97, 0x00, 0xa8, 0x00,
+  0xb2, 0x00, 0xc3, 0x00, 0xd4, 0x00, 0xdf, 0x00, 0xeb, 0x00, 0xfb, 0x00,
+  0x07, 0x01, 0x11, 0x01, 0x00, 0x00, 0x0e, 0x00, 0x1d, 0x00, 0x30, 0x00,
+  0x45, 0x00, 0x53, 0x00, 0x64, 0x00, 0x70, 0x00, 0x7f, 0x00, 0x8f, 0x00,
+  0x9b, 0x00, 0xa7, 0x00, 0xb3, 0x00, 0xc0, 0x00, 0xca, 0x00, 0xd6, 0x00,
+  0xe3, 0x00, 0xef, 0x00, 0xfb, 0x00, 0x07, 0x01, 0x12, 0x01, 0x1e, 0x01,
+  0x2b, 0x01, 0x35, 0x01, 0x00, 0x00, 0x0b, 0x00, 0x17, 0x00, 0x25, 0x00,
+  0x30, 0x00, 0x3b, 0x00, 0x47, 0x00, 0x53, 0x00, 0x5e, 0x00, 0x6a, 0x00,
+  0x78, 0x00, 0x83, 0x00, 0x91, 0x00, 0xa2, 0x00, 0xae, 0x00, 0xb9, 0x00,
+  0xc5, 0x00, 0xd0, 0x00, 0xdb, 0x00, 0xec, 0x00, 0xf8, 0x00, 0x06, 0x01,
+  0x11, 0x01, 0x1c, 0x01, 0x28, 0x01, 0x33, 0x01, 0x40, 0x01, 0x4c, 0x01,
+  0x57, 0x01, 0x62, 0x01, 0x6e, 0x01, 0x79, 0x01, 0x00, 0x00, 0x15, 0x00,
+  0x21, 0x00, 0x2d, 0x00, 0x38, 0x00, 0x47, 0x00, 0x55, 0x00, 0x5f, 0x00,
+  0x6d, 0x00, 0x7b, 0x00, 0x86, 0x00, 0x98, 0x00, 0xa6, 0x00, 0xb2, 0x00,
+  0xbd, 0x00, 0xc7, 0x00, 0xd5, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x39, 0x00,
+  0x47, 0x00, 0x56, 0x00, 0x63, 0x00, 0x71, 0x00, 0x7f, 0x00, 0x8e, 0x00,
+  0x9c, 0x00, 0xa8, 0x00, 0xb4, 0x00, 0xc3, 0x00, 0xd1, 0x00, 0xdf, 0x00,
+  0xed, 0x00, 0xfb, 0x00, 0x09, 0x01, 0x18, 0x01, 0x26, 0x01, 0x34, 0x01,
+  0x43, 0x01, 0x51, 0x01, 0x5b, 0x01, 0x66, 0x01, 0x74, 0x01, 0x82, 0x01,
+  0x90, 0x01, 0x9e, 0x01, 0xac, 0x01, 0xb8, 0x01, 0xc6, 0x01, 0xd2, 0x01,
+  0xe0, 0x01, 0xee, 0x01, 0xfc, 0x01, 0x0a, 0x02, 0x18, 0x02, 0x26, 0x02,
+  0x34, 0x02, 0x47, 0x02, 0x55, 0x02, 0x63, 0x02, 0x6f, 0x02, 0x7d, 0x02,
+  0x8b, 0x02, 0xa0, 0x02, 0xac, 0x02, 0xbb, 0x02, 0xc9, 0x02, 0xd7, 0x02,
+  0xe5, 0x02, 0xf1, 0x02, 0xff, 0x02, 0x0b, 0x03, 0x19, 0x03, 0x28, 0x03,
+  0x32, 0x03, 0x40, 0x03, 0x4e, 0x03, 0x5c, 0x03, 0x6a, 0x03, 0x78, 0x03,
+  0x86, 0x03, 0x91, 0x03, 0xa0, 0x03, 0xae, 0x03, 0xbc, 0x03, 0xcc, 0x03,
+  0xd8, 0x03, 0x00, 0x00, 0x2a, 0x00, 0x39, 0x00, 0x47, 0x00, 0x55, 0x00,
+  0x61, 0x00, 0x6c, 0x00, 0x77, 0x00, 0x83, 0x00, 0x8f, 0x00, 0x9c, 0x00,
+  0xab, 0x00, 0xb9, 0x00, 0xcb, 0x00, 0xd7, 0x00, 0xe1, 0x00, 0xef, 0x00,
+  0x04, 0x01, 0x10, 0x01, 0x1c, 0x01, 0x2a, 0x01, 0x38, 0x01, 0x47, 0x01,
+  0x53, 0x01, 0x61, 0x01, 0x00, 0x00, 0x11, 0x00, 0x20, 0x00, 0x31, 0x00,
+  0x42, 0x00, 0x4e, 0x00, 0x5f, 0x00, 0x77, 0x00, 0x86, 0x00, 0x92, 0x00,
+  0xa2, 0x00, 0xae, 0x00, 0xc0, 0x00, 0xcb, 0x00, 0xd8, 0x00, 0xe4, 0x00,
+  0xf0, 0x00, 0xfb, 0x00, 0x12, 0x01, 0x1e, 0x01, 0x2c, 0x01, 0x3a, 0x01,
+  0x4a, 0x01, 0x5b, 0x01, 0x6c, 0x01, 0x7d, 0x01, 0x89, 0x01, 0x95, 0x01,
+  0xa3, 0x01, 0x00, 0x00, 0x11, 0x00, 0x1e, 0x00, 0x2d, 0x00, 0x3c, 0x00,
+  0x4b, 0x00, 0x57, 0x00, 0x66, 0x00, 0x74, 0x00, 0x81, 0x00, 0x8e, 0x00,
+  0x9a, 0x00, 0xad, 0x00, 0xbe, 0x00, 0xcd, 0x00, 0xdb, 0x00, 0xe9, 0x00,
+  0xf8, 0x00, 0x09, 0x01, 0x15, 0x01, 0x21, 0x01, 0x2d, 0x01, 0x3b, 0x01,
+  0x4a, 0x01, 0x56, 0x01, 0x65, 0x01, 0x76, 0x01, 0x8d, 0x01, 0x99, 0x01,
+  0xa5, 0x01, 0xb3, 0x01, 0xc2, 0x01, 0xdc, 0x01, 0xe8, 0x01, 0xf7, 0x01,
+  0x03, 0x02, 0x0f, 0x02, 0x00, 0x00, 0x10, 0x00, 0x1f, 0x00, 0x2d, 0x00,
+  0x3b, 0x00, 0x49, 0x00, 0x55, 0x00, 0x64, 0x00, 0x6f, 0x00, 0x7b, 0x00,
+  0x87, 0x00, 0x91, 0x00, 0xa2, 0x00, 0xb0, 0x00, 0xbe, 0x00, 0xcc, 0x00,
+  0xd8, 0x00, 0x00, 0x00, 0x10, 0x00, 0x20, 0x00, 0x2c, 0x00, 0x3b, 0x00,
+  0x4b, 0x00, 0x5b, 0x00, 0x67, 0x00, 0x79, 0x00, 0x89, 0x00, 0x99, 0x00,
+  0xa7, 0x00, 0xb6, 0x00, 0xc2, 0x00, 0xd4, 0x00, 0xe4, 0x00, 0xf0, 0x00,
+  0x00, 0x01, 0x12, 0x01, 0x1e, 0x01, 0x2e, 0x01, 0x3e, 0x01, 0x4e, 0x01,
+  0x5e, 0x01, 0x6e, 0x01, 0x78, 0x01, 0x88, 0x01, 0x98, 0x01, 0xa8, 0x01,
+  0x00, 0x00, 0x0c, 0x00, 0x1c, 0x00, 0x28, 0x00, 0x37, 0x00, 0x43, 0x00,
+  0x51, 0x00, 0x5f, 0x00, 0x6b, 0x00, 0x77, 0x00, 0x83, 0x00, 0x94, 0x00,
+  0xa0, 0x00, 0xac, 0x00, 0xb8, 0x00, 0xc6, 0x00, 0xd6, 0x00, 0xe4, 0x00,
+  0xf0, 0x00, 0xfc, 0x00, 0x08, 0x01, 0x19, 0x01, 0x27, 0x01, 0x33, 0x01,
+  0x41, 0x01, 0x53, 0x01, 0x5f, 0x01, 0x6b, 0x01, 0x7a, 0x01, 0x86, 0x01,
+  0x92, 0x01, 0xa0, 0x01, 0xac, 0x01, 0xb8, 0x01, 0xc4, 0x01, 0xd0, 0x01,
+  0xde, 0x01, 0xea, 0x01, 0xf6, 0x01, 0x02, 0x02, 0x00, 0x00, 0x13, 0x00,
+  0x25, 0x00, 0x32, 0x00, 0x3e, 0x00, 0x50, 0x00, 0x62, 0x00, 0x6e, 0x00,
+  0x7a, 0x00, 0x8d, 0x00, 0x99, 0x00, 0xa5, 0x00, 0xb7, 0x00, 0xc9, 0x00,
+  0xda, 0x00, 0xec, 0x00, 0xfd, 0x00, 0x0b, 0x01, 0x1d, 0x01, 0x30, 0x01,
+  0x3c, 0x01, 0x47, 0x01, 0x53, 0x01, 0x5e, 0x01, 0x6c, 0x01, 0x00, 0x00,
+  0x0f, 0x00, 0x1e, 0x00, 0x2c, 0x00, 0x3a, 0x00, 0x48, 0x00, 0x54, 0x00,
+  0x63, 0x00, 0x74, 0x00, 0x82, 0x00, 0x91, 0x00, 0xa2, 0x00, 0xb1, 0x00,
+  0xbd, 0x00, 0xcc, 0x00, 0xda, 0x00, 0xe9, 0x00, 0xf7, 0x00, 0x06, 0x01,
+  0x15, 0x01, 0x23, 0x01, 0x32, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x1a, 0x00,
+  0x26, 0x00, 0x34, 0x00, 0x4b, 0x00, 0x56, 0x00, 0x62, 0x00, 0x6e, 0x00,
+  0x7e, 0x00, 0x8e, 0x00, 0x9e, 0x00, 0xaf, 0x00, 0xc3, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x1e, 0x00, 0x29, 0x00, 0x37, 0x00, 0x47, 0x00, 0x53, 0x00,
+  0x63, 0x00, 0x6f, 0x00, 0x7d, 0x00, 0x8d, 0x00, 0x00, 0x00, 0x17, 0x00,
+  0x26, 0x00, 0x38, 0x00, 0x4e, 0x00, 0x5a, 0x00, 0x65, 0x00, 0x6f, 0x00,
+  0x82, 0x00, 0x93, 0x00, 0xa5, 0x00, 0xb1, 0x00, 0xc4, 0x00, 0xd0, 0x00,
+  0x00, 0x00, 0x18, 0x00, 0x26, 0x00, 0x3d, 0x00, 0x49, 0x00, 0x5c, 0x00,
+  0x68, 0x00, 0x76, 0x00, 0x81, 0x00, 0x8f, 0x00, 0x9a, 0x00, 0xa8, 0x00,
+  0xb6, 0x00, 0xc1, 0x00, 0xcf, 0x00, 0xda, 0x00, 0xe5, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x18, 0x00, 0x2d, 0x00, 0x39, 0x00, 0x47, 0x00, 0x60, 0x00,
+  0x78, 0x00, 0x84, 0x00, 0x99, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x19, 0x00,
+  0x25, 0x00, 0x35, 0x00, 0x47, 0x00, 0x53, 0x00, 0x5e, 0x00, 0x69, 0x00,
+  0x74, 0x00, 0x86, 0x00, 0x99, 0x00, 0xa6, 0x00, 0xb1, 0x00, 0xc5, 0x00,
+  0xd0, 0x00, 0xdb, 0x00, 0xe6, 0x00, 0xf1, 0x00, 0xfc, 0x00, 0x09, 0x01,
+  0x00, 0x00, 0x0b, 0x00, 0x16, 0x00, 0x2b, 0x00, 0x3c, 0x00, 0x49, 0x00,
+  0x53, 0x00, 0x69, 0x00, 0x75, 0x00, 0x7f, 0x00, 0x90, 0x00, 0xa3, 0x00,
+  0xb6, 0x00, 0xcd, 0x00, 0xd9, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1d, 0x00,
+  0x2b, 0x00, 0x39, 0x00, 0x47, 0x00, 0x55, 0x00, 0x60, 0x00, 0x6e, 0x00,
+  0x7a, 0x00, 0x88, 0x00, 0x96, 0x00, 0xa2, 0x00, 0xb0, 0x00, 0xbc, 0x00,
+  0xca, 0x00, 0xd5, 0x00, 0xe3, 0x00, 0xf1, 0x00, 0xff, 0x00, 0x0d, 0x01,
+  0x20, 0x01, 0x2e, 0x01, 0x3c, 0x01, 0x47, 0x01, 0x55, 0x01, 0x63, 0x01,
+  0x71, 0x01, 0x7c, 0x01, 0x8a, 0x01, 0x98, 0x01, 0xa7, 0x01, 0xb5, 0x01,
+  0xc3, 0x01, 0xd1, 0x01, 0xdf, 0x01, 0xed, 0x01, 0xfb, 0x01, 0x07, 0x02,
+  0x17, 0x02, 0x25, 0x02, 0x30, 0x02, 0x3f, 0x02, 0x4d, 0x02, 0x5b, 0x02,
+  0x69, 0x02, 0x77, 0x02, 0x85, 0x02, 0x93, 0x02, 0xa1, 0x02, 0xaf, 0x02,
+  0xbd, 0x02, 0xcb, 0x02, 0xd6, 0x02, 0x00, 0x00, 0x0e, 0x00, 0x19, 0x00,
+  0x24, 0x00, 0x32, 0x00, 0x40, 0x00, 0x50, 0x00, 0x5b, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x1f, 0x00, 0x30, 0x00, 0x3b, 0x00, 0x4b, 0x00, 0x56, 0x00,
+  0x61, 0x00, 0x72, 0x00, 0x83, 0x00, 0x90, 0x00, 0x9b, 0x00, 0xab, 0x00,
+  0xb6, 0x00, 0xc7, 0x00, 0xd8, 0x00, 0xe9, 0x00, 0xf4, 0x00, 0x00, 0x01,
+  0x0f, 0x01, 0x1a, 0x01, 0x27, 0x01, 0x00, 0x00, 0x0e, 0x00, 0x1c, 0x00,
+  0x2b, 0x00, 0x39, 0x00, 0x45, 0x00, 0x52, 0x00, 0x5f, 0x00, 0x6c, 0x00,
+  0x78, 0x00, 0x86, 0x00, 0x92, 0x00, 0xa0, 0x00, 0xac, 0x00, 0xb8, 0x00,
+  0xc6, 0x00, 0xd3, 0x00, 0xe1, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1d, 0x00,
+  0x2b, 0x00, 0x37, 0x00, 0x45, 0x00, 0x51, 0x00, 0x5c, 0x00, 0x6a, 0x00,
+  0x79, 0x00, 0x84, 0x00, 0x92, 0x00, 0xa0, 0x00, 0xae, 0x00, 0xbc, 0x00,
+  0xca, 0x00, 0xd8, 0x00, 0xe6, 0x00, 0xf4, 0x00, 0x00, 0x01, 0x0e, 0x01,
+  0x1c, 0x01, 0x2a, 0x01, 0x34, 0x01, 0x42, 0x01, 0x50, 0x01, 0x5e, 0x01,
+  0x6c, 0x01, 0x7a, 0x01, 0x86, 0x01, 0x94, 0x01, 0xa6, 0x01, 0xb2, 0x01,
+  0xc0, 0x01, 0x00, 0x00, 0x10, 0x00, 0x21, 0x00, 0x31, 0x00, 0x3c, 0x00,
+  0x4c, 0x00, 0x5c, 0x00, 0x6b, 0x00, 0x7c, 0x00, 0x8c, 0x00, 0x9c, 0x00,
+  0xac, 0x00, 0xbc, 0x00, 0xcb, 0x00, 0xdb, 0x00, 0xec, 0x00, 0xfd, 0x00,
+  0x0c, 0x01, 0x1c, 0x01, 0x2c, 0x01, 0x3d, 0x01, 0x00, 0x00, 0x10, 0x00,
+  0x20, 0x00, 0x35, 0x00, 0x43, 0x00, 0x54, 0x00, 0x62, 0x00, 0x70, 0x00,
+  0x7e, 0x00, 0x8e, 0x00, 0x9a, 0x00, 0xa6, 0x00, 0x00, 0x00, 0x0d, 0x00,
+  0x1f, 0x00, 0x2c, 0x00, 0x3e, 0x00, 0x50, 0x00, 0x63, 0x00, 0x75, 0x00,
+  0x87, 0x00, 0x98, 0x00, 0xa9, 0x00, 0xbc, 0x00, 0xcd, 0x00, 0xdf, 0x00,
+  0xf1, 0x00, 0xff, 0x00, 0x12, 0x01, 0x24, 0x01, 0x36, 0x01, 0x42, 0x01,
+  0x4e, 0x01, 0x58, 0x01, 0x6a, 0x01, 0x7c, 0x01, 0x8e, 0x01, 0xa1, 0x01,
+  0xb3, 0x01, 0xc5, 0x01, 0xd8, 0x01, 0xea, 0x01, 0xfc, 0x01, 0x0e, 0x02,
+  0x20, 0x02, 0x32, 0x02, 0x43, 0x02, 0x56, 0x02, 0x62, 0x02, 0x74, 0x02,
+  0x00, 0x00, 0x21, 0x00, 0x2b, 0x00, 0x3a, 0x00, 0x48, 0x00, 0x52, 0x00,
+  0x60, 0x00, 0x6e, 0x00, 0x7c, 0x00, 0x90, 0x00, 0xa1, 0x00, 0xac, 0x00,
+  0xb8, 0x00, 0xc9, 0x00, 0xd7, 0x00, 0xe6, 0x00, 0xf7, 0x00, 0x03, 0x01,
+  0x12, 0x01, 0x26, 0x01, 0x35, 0x01, 0x00, 0x00, 0x0b, 0x00, 0x20, 0x00,
+  0x2b, 0x00, 0x40, 0x00, 0x4b, 0x00, 0x60, 0x00, 0x75, 0x00, 0x80, 0x00,
+  0x95, 0x00, 0x9f, 0x00, 0xab, 0x00, 0xc0, 0x00, 0xd2, 0x00, 0xe5, 0x00,
+  0xf9, 0x00, 0x04, 0x01, 0x15, 0x01, 0x20, 0x01, 0x2b, 0x01, 0x3a, 0x01,
+  0x4a, 0x01, 0x54, 0x01, 0x60, 0x01, 0x75, 0x01, 0x89, 0x01, 0x9e, 0x01,
+  0xb2, 0x01, 0xc6, 0x01, 0xdb, 0x01, 0xf0, 0x01, 0xfb, 0x01, 0x05, 0x02,
+  0x1a, 0x02, 0x24, 0x02, 0x00, 0x00, 0x0c, 0x00, 0x1c, 0x00, 0x27, 0x00,
+  0x35, 0x00, 0x40, 0x00, 0x51, 0x00, 0x5f, 0x00, 0x6f, 0x00, 0x00, 0x00,
+  0x21, 0x00, 0x2f, 0x00, 0x3b, 0x00, 0x47, 0x00, 0x59, 0x00, 0x65, 0x00,
+  0x7a, 0x00, 0x86, 0x00, 0x92, 0x00, 0x9e, 0x00, 0xaa, 0x00, 0xc0, 0x00,
+  0xcc, 0x00, 0xda, 0x00, 0xe6, 0x00, 0xf2, 0x00, 0x04, 0x01, 0x10, 0x01,
+  0x1a, 0x01, 0x24, 0x01, 0x33, 0x01, 0x45, 0x01, 0x4f, 0x01, 0x5b, 0x01,
+  0x6d, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x1f, 0x00, 0x2a, 0x00, 0x38, 0x00,
+  0x45, 0x00, 0x56, 0x00, 0x64, 0x00, 0x72, 0x00, 0x7d, 0x00, 0x8b, 0x00,
+  0x97, 0x00, 0xa1, 0x00, 0xad, 0x00, 0xb7, 0x00, 0xc1, 0x00, 0xcd, 0x00,
+  0xde, 0x00, 0xe8, 0x00, 0xf4, 0x00, 0xfe, 0x00, 0x0a, 0x01, 0x14, 0x01,
+  0x1e, 0x01, 0x29, 0x01, 0x35, 0x01, 0x3f, 0x01, 0x00, 0x00, 0x0e, 0x00,
+  0x1a, 0x00, 0x26, 0x00, 0x34, 0x00, 0x42, 0x00, 0x4e, 0x00, 0x58, 0x00,
+  0x66, 0x00, 0x75, 0x00, 0x89, 0x00, 0x9a, 0x00, 0xa8, 0x00, 0xb4, 0x00,
+  0xcd, 0x00, 0xd9, 0x00, 0xe8, 0x00, 0xf4, 0x00, 0x00, 0x01, 0x0c, 0x01,
+  0x18, 0x01, 0x24, 0x01, 0x30, 0x01, 0x41, 0x01, 0x4b, 0x01, 0x59, 0x01,
+  0x64, 0x01, 0x70, 0x01, 0x84, 0x01, 0x90, 0x01, 0x9c, 0x01, 0xa8, 0x01,
+  0xb3, 0x01, 0xbf, 0x01, 0xc9, 0x01, 0xd5, 0x01, 0x00, 0x00, 0x0e, 0x00,
+  0x1c, 0x00, 0x28, 0x00, 0x34, 0x00, 0x3f, 0x00, 0x4b, 0x00, 0x57, 0x00,
+  0x62, 0x00, 0x6e, 0x00, 0x79, 0x00, 0x84, 0x00, 0x90, 0x00, 0x9b, 0x00,
+  0xaa, 0x00, 0xb6, 0x00, 0xc1, 0x00, 0xcd, 0x00, 0xd9, 0x00, 0xe7, 0x00,
+  0xf6, 0x00, 0x02, 0x01, 0x0e, 0x01, 0x19, 0x01, 0x25, 0x01, 0x31, 0x01,
+  0x3c, 0x01, 0x48, 0x01, 0x54, 0x01, 0x64, 0x01, 0x6f, 0x01, 0x7d, 0x01,
+  0x8b, 0x01, 0x96, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x17, 0x00, 0x23, 0x00,
+  0x31, 0x00, 0x40, 0x00, 0x4c, 0x00, 0x5c, 0x00, 0x6d, 0x00, 0x7b, 0x00,
+  0x85, 0x00, 0xa0, 0x00, 0xba, 0x00, 0xcb, 0x00, 0xd9, 0x00, 0xf4, 0x00,
+  0x02, 0x01, 0x0e, 0x01, 0x18, 0x01, 0x32, 0x01, 0x40, 0x01, 0x51, 0x01,
+  0x62, 0x01, 0x6e, 0x01, 0x78, 0x01, 0x89, 0x01, 0x94, 0x01, 0x00, 0x00,
+  0x0c, 0x00, 0x18, 0x00, 0x23, 0x00, 0x31, 0x00, 0x41, 0x00, 0x4f, 0x00,
+  0x5b, 0x00, 0x69, 0x00, 0x77, 0x00, 0x85, 0x00, 0x92, 0x00, 0xa2, 0x00,
+  0xae, 0x00, 0xb9, 0x00, 0xc6, 0x00, 0xd4, 0x00, 0xe0, 0x00, 0xec, 0x00,
+  0xf8, 0x00, 0x06, 0x01, 0x17, 0x01, 0x23, 0x01, 0x2f, 0x01, 0x3d, 0x01,
+  0x4b, 0x01, 0x57, 0x01, 0x65, 0x01, 0x73, 0x01, 0x81, 0x01, 0x8d, 0x01,
+  0x9b, 0x01, 0xa7, 0x01, 0xb3, 0x01, 0xbe, 0x01, 0xc9, 0x01, 0xd3, 0x01,
+  0xdd, 0x01, 0xe7, 0x01, 0xf7, 0x01, 0x06, 0x02, 0x14, 0x02, 0x1f, 0x02,
+  0x29, 0x02, 0x37, 0x02, 0x00, 0x00, 0x0c, 0x00, 0x1b, 0x00, 0x37, 0x00,
+  0x43, 0x00, 0x4f, 0x00, 0x5a, 0x00, 0x6a, 0x00, 0x79, 0x00, 0x88, 0x00,
+  0x99, 0x00, 0xa5, 0x00, 0xb1, 0x00, 0xbd, 0x00, 0xcf, 0x00, 0xe8, 0x00,
+  0xf3, 0x00, 0xff, 0x00, 0x0b, 0x01, 0x17, 0x01, 0x25, 0x01, 0x31, 0x01,
+  0x3e, 0x01, 0x4c, 0x01, 0x5a, 0x01, 0x66, 0x01, 0x72, 0x01, 0x7e, 0x01,
+  0x88, 0x01, 0x94, 0x01, 0xa2, 0x01, 0xae, 0x01, 0x00, 0x00, 0x17, 0x00,
+  0x25, 0x00, 0x36, 0x00, 0x42, 0x00, 0x53, 0x00, 0x5f, 0x00, 0x6f, 0x00,
+  0x7b, 0x00, 0x88, 0x00, 0x97, 0x00, 0xa3, 0x00, 0xb3, 0x00, 0xc4, 0x00,
+  0xd0, 0x00, 0xe1, 0x00, 0xed, 0x00, 0xf9, 0x00, 0x0a, 0x01, 0x16, 0x01,
+  0x22, 0x01, 0x32, 0x01, 0x43, 0x01, 0x54, 0x01, 0x64, 0x01, 0x70, 0x01,
+  0x81, 0x01, 0x8d, 0x01, 0x00, 0x00, 0x0d, 0x00, 0x1a, 0x00, 0x26, 0x00,
+  0x35, 0x00, 0x43, 0x00, 0x4f, 0x00, 0x5e, 0x00, 0x6d, 0x00, 0x7b, 0x00,
+  0x89, 0x00, 0x95, 0x00, 0xa1, 0x00, 0xad, 0x00, 0xbe, 0x00, 0xcb, 0x00,
+  0xda, 0x00, 0xe6, 0x00, 0xf3, 0x00, 0xfe, 0x00, 0x0c, 0x01, 0x1a, 0x01,
+  0x26, 0x01, 0x32, 0x01, 0x41, 0x01, 0x4e, 0x01, 0x5a, 0x01, 0x67, 0x01,
+  0x74, 0x01, 0x00, 0x00, 0x0d, 0x00, 0x1c, 0x00, 0x28, 0x00, 0x33, 0x00,
+  0x3f, 0x00, 0x4a, 0x00, 0x56, 0x00, 0x62, 0x00, 0x70, 0x00, 0x83, 0x00,
+  0x8e, 0x00, 0x99, 0x00, 0xa5, 0x00, 0xb1, 0x00, 0xbf, 0x00, 0xca, 0x00,
+  0xdb, 0x00, 0xe9, 0x00, 0xf3, 0x00, 0x01, 0x01, 0x0d, 0x01, 0x1b, 0x01,
+  0x25, 0x01, 0x33, 0x01, 0x3d, 0x01, 0x48, 0x01, 0x56, 0x01, 0x00, 0x00,
+  0x0f, 0x00, 0x21, 0x00, 0x2d, 0x00, 0x3d, 0x00, 0x4e, 0x00, 0x5f, 0x00,
+  0x69, 0x00, 0x73, 0x00, 0x94, 0x00, 0xa0, 0x00, 0xaa, 0x00, 0xba, 0x00,
+  0xca, 0x00, 0xda, 0x00, 0xea, 0x00, 0xfa, 0x00, 0x06, 0x01, 0x18, 0x01,
+  0x25, 0x01, 0x33, 0x01, 0x3f, 0x01, 0x4e, 0x01, 0x5b, 0x01, 0x67, 0x01,
+  0x77, 0x01, 0x00, 0x00, 0x0e, 0x00, 0x1a, 0x00, 0x26, 0x00, 0x32, 0x00,
+  0x42, 0x00, 0x4e, 0x00, 0x5a, 0x00, 0x67, 0x00, 0x75, 0x00, 0x81, 0x00,
+  0x8d, 0x00, 0x99, 0x00, 0xa5, 0x00, 0xb1, 0x00, 0xbf, 0x00, 0xcb, 0x00,
+  0xda, 0x00, 0xe6, 0x00, 0xf5, 0x00, 0x01, 0x01, 0x12, 0x01, 0x1e, 0x01,
+  0x2a, 0x01, 0x38, 0x01, 0x49, 0x01, 0x55, 0x01, 0x63, 0x01, 0x6f, 0x01,
+  0x7d, 0x01, 0x8b, 0x01, 0x97, 0x01, 0xa3, 0x01, 0xaf, 0x01, 0xbb, 0x01,
+  0xcc, 0x01, 0xd8, 0x01, 0xe4, 0x01, 0xf0, 0x01, 0xfc, 0x01, 0x08, 0x02,
+  0x14, 0x02, 0x20, 0x02, 0x2c, 0x02, 0x38, 0x02, 0x45, 0x02, 0x51, 0x02,
+  0x62, 0x02, 0x6e, 0x02, 0x7a, 0x02, 0x88, 0x02, 0x94, 0x02, 0xa0, 0x02,
+  0xae, 0x02, 0x00, 0x00, 0x12, 0x00, 0x24, 0x00, 0x30, 0x00, 0x42, 0x00,
+  0x54, 0x00, 0x61, 0x00, 0x6e, 0x00, 0x81, 0x00, 0x8f, 0x00, 0x9d, 0x00,
+  0xaf, 0x00, 0xc1, 0x00, 0xd3, 0x00, 0xe5, 0x00, 0xf7, 0x00, 0x03, 0x01,
+  0x15, 0x01, 0x27, 0x01, 0x33, 0x01, 0x3f, 0x01, 0x49, 0x01, 0x54, 0x01,
+  0x61, 0x01, 0x6b, 0x01, 0x7b, 0x01, 0x88, 0x01, 0x00, 0x00, 0x0b, 0x00,
+  0x1a, 0x00, 0x29, 0x00, 0x35, 0x00, 0x41, 0x00, 0x4b, 0x00, 0x56, 0x00,
+  0x64, 0x00, 0x6f, 0x00, 0x7b, 0x00, 0x87, 0x00, 0x9b, 0x00, 0xa7, 0x00,
+  0xb3, 0x00, 0xbe, 0x00, 0xca, 0x00, 0xd6, 0x00, 0xea, 0x00, 0xf6, 0x00,
+  0x00, 0x01, 0x0c, 0x01, 0x1a, 0x01, 0x29, 0x01, 0x38, 0x01, 0x44, 0x01,
+  0x55, 0x01, 0x63, 0x01, 0x6f, 0x01, 0x7b, 0x01, 0x86, 0x01, 0x90, 0x01,
+  0x9f, 0x01, 0xab, 0x01, 0xb9, 0x01, 0xc4, 0x01, 0xcf, 0x01, 0xda, 0x01,
+  0xe5, 0x01, 0xf0, 0x01, 0x00, 0x00, 0x27, 0x00, 0x34, 0x00, 0x45, 0x00,
+  0x51, 0x00, 0x66, 0x00, 0x7a, 0x00, 0x89, 0x00, 0x99, 0x00, 0xa4, 0x00,
+  0xb4, 0x00, 0xc0, 0x00, 0xcb, 0x00, 0xdb, 0x00, 0xf0, 0x00, 0x01, 0x01,
+  0x0d, 0x01, 0x1f, 0x01, 0x2b, 0x01, 0x00, 0x00, 0x0e, 0x00, 0x1e, 0x00,
+  0x2a, 0x00, 0x36, 0x00, 0x42, 0x00, 0x54, 0x00, 0x60, 0x00, 0x6c, 0x00,
+  0x78, 0x00, 0x84, 0x00, 0x94, 0x00, 0xa2, 0x00, 0xae, 0x00, 0xba, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x1d, 0x00, 0x2b, 0x00, 0x40, 0x00, 0x4f, 0x00,
+  0x59, 0x00, 0x63, 0x00, 0x6d, 0x00, 0x79, 0x00, 0x8e, 0x00, 0xa2, 0x00,
+  0xb1, 0x00, 0x00, 0x00, 0x21, 0x00, 0x2c, 0x00, 0x3b, 0x00, 0x46, 0x00,
+  0x57, 0x00, 0x62, 0x00, 0x72, 0x00, 0x83, 0x00, 0x00, 0x00, 0x14, 0x00,
+  0x28, 0x00, 0x00, 0x00, 0x11, 0x00, 0x1d, 0x00, 0x28, 0x00, 0x35, 0x00,
+  0x41, 0x00, 0x4d, 0x00, 0x58, 0x00, 0x63, 0x00, 0x6e, 0x00, 0x80, 0x00,
+  0x8c, 0x00, 0x9c, 0x00, 0xa7, 0x00, 0xb3, 0x00, 0xc4, 0x00, 0xcf, 0x00,
+  0xda, 0x00, 0xe5, 0x00, 0xf1, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x5d, 0x00,
+  0x70, 0x00, 0x7f, 0x00, 0x89, 0x00, 0x9f, 0x00, 0xb2, 0x00, 0xbc, 0x00,
+  0x00, 0x00, 0x17, 0x00, 0x25, 0x00, 0x33, 0x00, 0x41, 0x00, 0x4f, 0x00,
+  0x5e, 0x00, 0x6c, 0x00, 0x78, 0x00, 0x84, 0x00, 0x92, 0x00, 0xa0, 0x00,
+  0xae, 0x00, 0xbc, 0x00, 0xc8, 0x00, 0xd3, 0x00, 0xe1, 0x00, 0xef, 0x00,
+  0xff, 0x00, 0x0e, 0x01, 0x1c, 0x01, 0x2a, 0x01, 0x38, 0x01, 0x46, 0x01,
+  0x51, 0x01, 0x5f, 0x01, 0x6e, 0x01, 0x7a, 0x01, 0x88, 0x01, 0x96, 0x01,
+  0x00, 0x00, 0x0d, 0x00, 0x19, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x4f, 0x00,
+  0x5f, 0x00, 0x6a, 0x00, 0x75, 0x00, 0x85, 0x00, 0x95, 0x00, 0xa0, 0x00,
+  0xb1, 0x00, 0xbd, 0x00, 0xce, 0x00, 0xda, 0x00, 0xe5, 0x00, 0xf2, 0x00,
+  0x03, 0x01, 0x13, 0x01, 0x1e, 0x01, 0x29, 0x01, 0x00, 0x00, 0x1a, 0x00,
+  0x39, 0x00, 0x54, 0x00, 0x62, 0x00, 0x6f, 0x00, 0x7d, 0x00, 0x87, 0x00,
+  0x94, 0x00, 0xa1, 0x00, 0xad, 0x00, 0xbb, 0x00, 0xc7, 0x00, 0xd4, 0x00,
+  0xe2, 0x00, 0xee, 0x00, 0x00, 0x00, 0x17, 0x00, 0x22, 0x00, 0x2e, 0x00,
+  0x40, 0x00, 0x4b, 0x00, 0x57, 0x00, 0x61, 0x00, 0x6f, 0x00, 0x7d, 0x00,
+  0x8b, 0x00, 0x97, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x26, 0x00, 0x30, 0x00,
+  0x40, 0x00, 0x4a, 0x00, 0x55, 0x00, 0x65, 0x00, 0x75, 0x00, 0x84, 0x00,
+  0x96, 0x00, 0xa6, 0x00, 0xb1, 0x00, 0xc1, 0x00, 0xd1, 0x00, 0xe3, 0x00,
+  0xfb, 0x00, 0x0b, 0x01, 0x16, 0x01, 0x21, 0x01, 0x2f, 0x01, 0x3d, 0x01,
+  0x4d, 0x01, 0x5d, 0x01, 0x67, 0x01, 0x73, 0x01, 0x82, 0x01, 0x8f, 0x01,
+  0xa1, 0x01, 0xb1, 0x01, 0xc1, 0x01, 0xd1, 0x01, 0xde, 0x01, 0xee, 0x01,
+  0xfe, 0x01, 0x0e, 0x02, 0x18, 0x02, 0x00, 0x00, 0x15, 0x00, 0x26, 0x00,
+  0x32, 0x00, 0x42, 0x00, 0x4e, 0x00, 0x5e, 0x00, 0x6d, 0x00, 0x79, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x1e, 0x00, 0x35, 0x00, 0x41, 0x00, 0x4f, 0x00,
+  0x5b, 0x00, 0x66, 0x00, 0x71, 0x00, 0x7d, 0x00, 0x87, 0x00, 0x94, 0x00,
+  0xa6, 0x00, 0xb0, 0x00, 0xbd, 0x00, 0xcf, 0x00, 0xdc, 0x00, 0xe8, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x1b, 0x00, 0x27, 0x00, 0x35, 0x00, 0x40, 0x00,
+  0x4c, 0x00, 0x5f, 0x00, 0x6e, 0x00, 0x79, 0x00, 0x00, 0x00, 0x0a, 0x00,
+  0x1e, 0x00, 0x2e, 0x00, 0x3e, 0x00, 0x49, 0x00, 0x54, 0x00, 0x68, 0x00,
+  0x78, 0x00, 0x8c, 0x00, 0x9c, 0x00, 0xae, 0x00, 0xbe, 0x00, 0xce, 0x00,
+  0xe2, 0x00, 0xec, 0x00, 0x00, 0x00, 0x20, 0x00, 0x2b, 0x00, 0x3a, 0x00,
+  0x4a, 0x00, 0x58, 0x00, 0x66, 0x00, 0x75, 0x00, 0x83, 0x00, 0x92, 0x00,
+  0x9d, 0x00, 0x00, 0x00, 0x21, 0x00, 0x32, 0x00, 0x3e, 0x00, 0x4c, 0x00,
+  0x58, 0x00, 0x6a, 0x00, 0x76, 0x00, 0x80, 0x00, 0x92, 0x00, 0xa5, 0x00,
+  0xb1, 0x00, 0xbd, 0x00, 0xc9, 0x00, 0xdb, 0x00, 0xe8, 0x00, 0xf6, 0x00,
+  0x00, 0x01, 0x0c, 0x01, 0x16, 0x01, 0x23, 0x01, 0x2e, 0x01, 0x3a, 0x01,
+  0x4c, 0x01, 0x5e, 0x01, 0x69, 0x01, 0x75, 0x01, 0x00, 0x00, 0x0c, 0x00,
+  0x1a, 0x00, 0x28, 0x00, 0x32, 0x00, 0x3e, 0x00, 0x4a, 0x00, 0x56, 0x00,
+  0x61, 0x00, 0x6d, 0x00, 0x78, 0x00, 0x8d, 0x00, 0x99, 0x00, 0xa5, 0x00,
+  0xb1, 0x00, 0xbb, 0x00, 0xcc, 0x00, 0xd8, 0x00, 0xe2, 0x00, 0xec, 0x00,
+  0xfa, 0x00, 0x06, 0x01, 0x10, 0x01, 0x24, 0x01, 0x00, 0x00, 0x0e, 0x00,
+  0x1c, 0x00, 0x27, 0x00, 0x33, 0x00, 0x41, 0x00, 0x4f, 0x00, 0x5b, 0x00,
+  0x67, 0x00, 0x71, 0x00, 0x7d, 0x00, 0x8b, 0x00, 0x99, 0x00, 0xa7, 0x00,
+  0xbf, 0x00, 0xcb, 0x00, 0xda, 0x00, 0xe5, 0x00, 0xf3, 0x00, 0xff, 0x00,
+  0x0b, 0x01, 0x18, 0x01, 0x24, 0x01, 0x32, 0x01, 0x3d, 0x01, 0x4b, 0x01,
+  0x59, 0x01, 0x67, 0x01, 0x74, 0x01, 0x82, 0x01, 0x8d, 0x01, 0xa0, 0x01,
+  0xae, 0x01, 0xbc, 0x01, 0xca, 0x01, 0xd6, 0x01, 0xe5, 0x01, 0xf4, 0x01,
+  0x00, 0x02, 0x0c, 0x02, 0x1a, 0x02, 0x27, 0x02, 0x33, 0x02, 0x3f, 0x02,
+  0x00, 0x00, 0x0c, 0x00, 0x1a, 0x00, 0x25, 0x00, 0x30, 0x00, 0x3c, 0x00,
+  0x47, 0x00, 0x52, 0x00, 0x5e, 0x00, 0x69, 0x00, 0x74, 0x00, 0x7f, 0x00,
+  0x8b, 0x00, 0x96, 0x00, 0xa2, 0x00, 0xb0, 0x00, 0xbe, 0x00, 0xcc, 0x00,
+  0xd7, 0x00, 0xe3, 0x00, 0xee, 0x00, 0xf9, 0x00, 0x05, 0x01, 0x11, 0x01,
+  0x1d, 0x01, 0x29, 0x01, 0x35, 0x01, 0x41, 0x01, 0x4f, 0x01, 0x5c, 0x01,
+  0x67, 0x01, 0x72, 0x01, 0x7d, 0x01, 0x8a, 0x01, 0x96, 0x01, 0xa4, 0x01,
+  0xaf, 0x01, 0xbd, 0x01, 0xc8, 0x01, 0xd5, 0x01, 0xe1, 0x01, 0xec, 0x01,
+  0xf8, 0x01, 0x04, 0x02, 0x0f, 0x02, 0x1b, 0x02, 0x29, 0x02, 0x34, 0x02,
+  0x40, 0x02, 0x4c, 0x02, 0x57, 0x02, 0x62, 0x02, 0x6d, 0x02, 0x79, 0x02,
+  0x84, 0x02, 0x93, 0x02, 0x00, 0x00, 0x0a, 0x00, 0x1b, 0x00, 0x29, 0x00,
+  0x37, 0x00, 0x48, 0x00, 0x54, 0x00, 0x6a, 0x00, 0x78, 0x00, 0x84, 0x00,
+  0x92, 0x00, 0x9f, 0x00, 0xab, 0x00, 0xc4, 0x00, 0xce, 0x00, 0xda, 0x00,
+  0xe5, 0x00, 0xf3, 0x00, 0xff, 0x00, 0x0d, 0x01, 0x1b, 0x01, 0x2a, 0x01,
+  0x34, 0x01, 0x45, 0x01, 0x55, 0x01, 0x63, 0x01, 0x71, 0x01, 0x86, 0x01,
+  0x94, 0x01, 0xa2, 0x01, 0xb1, 0x01, 0xbd, 0x01, 0xc7, 0x01, 0xd3, 0x01,
+  0xe9, 0x01, 0xf7, 0x01, 0x05, 0x02, 0x00, 0x00, 0x0e, 0x00, 0x1c, 0x00,
+  0x2b, 0x00, 0x39, 0x00, 0x47, 0x00, 0x55, 0x00, 0x63, 0x00, 0x71, 0x00,
+  0x7f, 0x00, 0x8e, 0x00, 0x9c, 0x00, 0xa6, 0x00, 0xb4, 0x00, 0xc1, 0x00,
+  0xcf, 0x00, 0xdd, 0x00, 0xeb, 0x00, 0xf9, 0x00, 0x07, 0x01, 0x15, 0x01,
+  0x23, 0x01, 0x32, 0x01, 0x42, 0x01, 0x50, 0x01, 0x5e, 0x01, 0x6c, 0x01,
+  0x7a, 0x01, 0x86, 0x01, 0x91, 0x01, 0x9f, 0x01, 0xa9, 0x01, 0xb7, 0x01,
+  0xc5, 0x01, 0xd0, 0x01, 0xdc, 0x01, 0xe6, 0x01, 0xf5, 0x01, 0x03, 0x02,
+  0x0d, 0x02, 0x1b, 0x02, 0x31, 0x02, 0x3f, 0x02, 0x4a, 0x02, 0x58, 0x02,
+  0x64, 0x02, 0x72, 0x02, 0x80, 0x02, 0x8e, 0x02, 0x99, 0x02, 0xa7, 0x02,
+  0xb6, 0x02, 0xc4, 0x02, 0xd0, 0x02, 0xda, 0x02, 0xe8, 0x02, 0xf6, 0x02,
+  0x04, 0x03, 0x12, 0x03, 0x27, 0x03, 0x35, 0x03, 0x43, 0x03, 0x51, 0x03,
+  0x5c, 0x03, 0x6c, 0x03, 0x76, 0x03, 0x80, 0x03, 0x00, 0x00, 0x0b, 0x00,
+  0x19, 0x00, 0x27, 0x00, 0x35, 0x00, 0x41, 0x00, 0x4f, 0x00, 0x5b, 0x00,
+  0x69, 0x00, 0x75, 0x00, 0x85, 0x00, 0x93, 0x00, 0xa1, 0x00, 0xad, 0x00,
+  0xb9, 0x00, 0xc8, 0x00, 0xd4, 0x00, 0xe1, 0x00, 0xed, 0x00, 0xf9, 0x00,
+  0x08, 0x01, 0x14, 0x01, 0x22, 0x01, 0x2e, 0x01, 0x3a, 0x01, 0x48, 0x01,
+  0x54, 0x01, 0x5e, 0x01, 0x6d, 0x01, 0x79, 0x01, 0x83, 0x01, 0x8f, 0x01,
+  0x9b, 0x01, 0xa7, 0x01, 0xb3, 0x01, 0xc1, 0x01, 0xcf, 0x01, 0xe2, 0x01,
+  0xf2, 0x01, 0x02, 0x02, 0x10, 0x02, 0x1c, 0x02, 0x2e, 0x02, 0x00, 0x00,
+  0x0c, 0x00, 0x1c, 0x00, 0x27, 0x00, 0x32, 0x00, 0x40, 0x00, 0x4c, 0x00,
+  0x58, 0x00, 0x69, 0x00, 0x75, 0x00, 0x86, 0x00, 0x91, 0x00, 0x9d, 0x00,
+  0xae, 0x00, 0xba, 0x00, 0xca, 0x00, 0xd5, 0x00, 0xe3, 0x00, 0xf1, 0x00,
+  0xff, 0x00, 0x0f, 0x01, 0x1b, 0x01, 0x27, 0x01, 0x36, 0x01, 0x46, 0x01,
+  0x54, 0x01, 0x64, 0x01, 0x75, 0x01, 0x85, 0x01, 0x90, 0x01, 0xa1, 0x01,
+  0xb1, 0x01, 0xbe, 0x01, 0xc9, 0x01, 0xd5, 0x01, 0xe3, 0x01, 0xef, 0x01,
+  0xfa, 0x01, 0x00, 0x00, 0x22, 0x00, 0x31, 0x00, 0x3d, 0x00, 0x49, 0x00,
+  0x57, 0x00, 0x65, 0x00, 0x76, 0x00, 0x83, 0x00, 0x90, 0x00, 0x9f, 0x00,
+  0xb2, 0x00, 0xbf, 0x00, 0xcb, 0x00, 0xd7, 0x00, 0xea, 0x00, 0xf8, 0x00,
+  0x06, 0x01, 0x13, 0x01, 0x24, 0x01, 0x30, 0x01, 0x3c, 0x01, 0x4a, 0x01,
+  0x58, 0x01, 0x66, 0x01, 0x73, 0x01, 0x81, 0x01, 0x8d, 0x01, 0x9b, 0x01,
+  0xae, 0x01, 0xbc, 0x01, 0xc9, 0x01, 0xd7, 0x01, 0xe5, 0x01, 0xf4, 0x01,
+  0x02, 0x02, 0x00, 0x00, 0x22, 0x00, 0x35, 0x00, 0x43, 0x00, 0x4e, 0x00,
+  0x5a, 0x00, 0x66, 0x00, 0x74, 0x00, 0x87, 0x00, 0x95, 0x00, 0xa1, 0x00,
+  0xad, 0x00, 0xbb, 0x00, 0xc9, 0x00, 0xd5, 0x00, 0xe4, 0x00, 0xf2, 0x00,
+  0xfe, 0x00, 0x0c, 0x01, 0x1c, 0x01, 0x26, 0x01, 0x36, 0x01, 0x42, 0x01,
+  0x50, 0x01, 0x62, 0x01, 0x6e, 0x01, 0x7a, 0x01, 0x84, 0x01, 0x92, 0x01,
+  0xa4, 0x01, 0xb3, 0x01, 0xbd, 0x01, 0xc7, 0x01, 0xd5, 0x01, 0xe4, 0x01,
+  0x00, 0x00, 0x41, 0x00, 0x54, 0x00, 0x6b, 0x00, 0x7b, 0x00, 0x88, 0x00,
+  0x99, 0x00, 0xa5, 0x00, 0xb5, 0x00, 0xc5, 0x00, 0xd5, 0x00, 0xe6, 0x00,
+  0xf2, 0x00, 0xfe, 0x00, 0x10, 0x01, 0x1f, 0x01, 0x2f, 0x01, 0x40, 0x01,
+  0x50, 0x01, 0x5f, 0x01, 0x69, 0x01, 0x7a, 0x01, 0x84, 0x01, 0x93, 0x01,
+  0xa3, 0x01, 0xb3, 0x01, 0xc4, 0x01, 0xd5, 0x01, 0xdf, 0x01, 0xf0, 0x01,
+  0x00, 0x00, 0x0c, 0x00, 0x18, 0x00, 0x26, 0x00, 0x32, 0x00, 0x40, 0x00,
+  0x4c, 0x00, 0x5a, 0x00, 0x68, 0x00, 0x74, 0x00, 0x80, 0x00, 0x91, 0x00,
+  0xa1, 0x00, 0xaf, 0x00, 0xbb, 0x00, 0xc7, 0x00, 0xd7, 0x00, 0xe3, 0x00,
+  0xf1, 0x00, 0xff, 0x00, 0x11, 0x01, 0x1f, 0x01, 0x2b, 0x01, 0x37, 0x01,
+  0x43, 0x01, 0x51, 0x01, 0x62, 0x01, 0x6f, 0x01, 0x7d, 0x01, 0x89, 0x01,
+  0x97, 0x01, 0xa6, 0x01, 0xb0, 0x01, 0xbc, 0x01, 0xcb, 0x01, 0xd9, 0x01,
+  0xe5, 0x01, 0xf1, 0x01, 0xfd, 0x01, 0x00, 0x00, 0x54, 0x00, 0x60, 0x00,
+  0x6c, 0x00, 0x7e, 0x00, 0x8a, 0x00, 0x9c, 0x00, 0xb5, 0x00, 0xc8, 0x00,
+  0xda, 0x00, 0xe5, 0x00, 0xf7, 0x00, 0x09, 0x01, 0x1c, 0x01, 0x2b, 0x01,
+  0x37, 0x01, 0x49, 0x01, 0x5b, 0x01, 0x6e, 0x01, 0x80, 0x01, 0x92, 0x01,
+  0xa4, 0x01, 0xb5, 0x01, 0xbf, 0x01, 0xcc, 0x01, 0xde, 0x01, 0xf0, 0x01,
+  0x02, 0x02, 0x14, 0x02, 0x1e, 0x02, 0x2c, 0x02, 0x3e, 0x02, 0x4a, 0x02,
+  0x5d, 0x02, 0x70, 0x02, 0x7c, 0x02, 0x8e, 0x02, 0xa0, 0x02, 0xad, 0x02,
+  0x00, 0x00, 0x0c, 0x00, 0x1b, 0x00, 0x2a, 0x00, 0x3b, 0x00, 0x46, 0x00,
+  0x52, 0x00, 0x60, 0x00, 0x6c, 0x00, 0x7d, 0x00, 0x8b, 0x00, 0x95, 0x00,
+  0xa4, 0x00, 0xb2, 0x00, 0xc0, 0x00, 0xcc, 0x00, 0xdc, 0x00, 0xe6, 0x00,
+  0xf4, 0x00, 0x06, 0x01, 0x10, 0x01, 0x1a, 0x01, 0x2a, 0x01, 0x34, 0x01,
+  0x3e, 0x01, 0x50, 0x01, 0x5e, 0x01, 0x6c, 0x01, 0x7b, 0x01, 0x85, 0x01,
+  0x8f, 0x01, 0x00, 0x00, 0x3a, 0x00, 0x6a, 0x00, 0x81, 0x00, 0x90, 0x00,
+  0x9c, 0x00, 0xae, 0x00, 0xbc, 0x00, 0xcc, 0x00, 0xe0, 0x00, 0xef, 0x00,
+  0xfa, 0x00, 0x05, 0x01, 0x10, 0x01, 0x24, 0x01, 0x30, 0x01, 0x3c, 0x01,
+  0x51, 0x01, 0x65, 0x01, 0x70, 0x01, 0x00, 0x00, 0x32, 0x00, 0x42, 0x00,
+  0x51, 0x00, 0x5d, 0x00, 0x6e, 0x00, 0x7e, 0x00, 0x8c, 0x00, 0x9a, 0x00,
+  0xa8, 0x00, 0xb6, 0x00, 0xc4, 0x00, 0xd4, 0x00, 0xe5, 0x00, 0xf1, 0x00,
+  0x03, 0x01, 0x12, 0x01, 0x20, 0x01, 0x2c, 0x01, 0x3a, 0x01, 0x48, 0x01,
+  0x59, 0x01, 0x67, 0x01, 0x00, 0x00, 0x0f, 0x00, 0x25, 0x00, 0x3e, 0x00,
+  0x4a, 0x00, 0x56, 0x00, 0x66, 0x00, 0x75, 0x00, 0x87, 0x00, 0x92, 0x00,
+  0x9d, 0x00, 0xab, 0x00, 0xba, 0x00, 0xc5, 0x00, 0xd8, 0x00, 0xeb, 0x00,
+  0xf7, 0x00, 0x01, 0x01, 0x16, 0x01, 0x28, 0x01, 0x36, 0x01, 0x40, 0x01,
+  0x4b, 0x01, 0x5d, 0x01, 0x69, 0x01, 0x00, 0x00, 0x20, 0x00, 0x2f, 0x00,
+  0x3e, 0x00, 0x4c, 0x00, 0x58, 0x00, 0x67, 0x00, 0x71, 0x00, 0x7b, 0x00,
+  0x8a, 0x00, 0x9d, 0x00, 0xa9, 0x00, 0xb7, 0x00, 0xc6, 0x00, 0xd5, 0x00,
+  0xdf, 0x00, 0x00, 0x00, 0x19, 0x00, 0x25, 0x00, 0x33, 0x00, 0x41, 0x00,
+  0x58, 0x00, 0x71, 0x00, 0x7f, 0x00, 0x8b, 0x00, 0x97, 0x00, 0xb0, 0x00,
+  0xba, 0x00, 0xc6, 0x00, 0xd4, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x17, 0x00,
+  0x23, 0x00, 0x35, 0x00, 0x40, 0x00, 0x4b, 0x00, 0x58, 0x00, 0x63, 0x00,
+  0x6e, 0x00, 0x79, 0x00, 0x89, 0x00, 0x95, 0x00, 0xa2, 0x00, 0xad, 0x00,
+  0xb9, 0x00, 0xc4, 0x00, 0xd5, 0x00, 0xe0, 0x00, 0xec, 0x00, 0xfc, 0x00,
+  0x08, 0x01, 0x19, 0x01, 0x25, 0x01, 0x00, 0x00, 0x26, 0x00, 0x38, 0x00,
+  0x58, 0x00, 0x67, 0x00, 0x76, 0x00, 0x86, 0x00, 0x94, 0x00, 0x9f, 0x00,
+  0xba, 0x00, 0xc4, 0x00, 0xce, 0x00, 0xd9, 0x00, 0xe7, 0x00, 0xf2, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x31, 0x00, 0x3f, 0x00, 0x4d, 0x00, 0x5b, 0x00,
+  0x69, 0x00, 0x75, 0x00, 0x80, 0x00, 0x8e, 0x00, 0x9c, 0x00, 0xab, 0x00,
+  0xb9, 0x00, 0xc7, 0x00, 0xd5, 0x00, 0xe3, 0x00, 0xf2, 0x00, 0x00, 0x01,
+  0x13, 0x01, 0x21, 0x01, 0x2b, 0x01, 0x37, 0x01, 0x43, 0x01, 0x51, 0x01,
+  0x5c, 0x01, 0x6a, 0x01, 0x75, 0x01, 0x81, 0x01, 0x8f, 0x01, 0x9e, 0x01,
+  0xaa, 0x01, 0xb9, 0x01, 0xc7, 0x01, 0xd5, 0x01, 0xe3, 0x01, 0xf1, 0x01,
+  0xfd, 0x01, 0x10, 0x02, 0x1a, 0x02, 0x00, 0x00, 0x10, 0x00, 0x22, 0x00,
+  0x34, 0x00, 0x44, 0x00, 0x57, 0x00, 0x6f, 0x00, 0x81, 0x00, 0x8b, 0x00,
+  0xa0, 0x00, 0x00, 0x00, 0x10, 0x00, 0x20, 0x00, 0x2b, 0x00, 0x3b, 0x00,
+  0x4b, 0x00, 0x5b, 0x00, 0x6b, 0x00, 0x7b, 0x00, 0x86, 0x00, 0x96, 0x00,
+  0xa6, 0x00, 0xb6, 0x00, 0xc6, 0x00, 0xd5, 0x00, 0x00, 0x00, 0x22, 0x00,
+  0x3b, 0x00, 0x56, 0x00, 0x62, 0x00, 0x70, 0x00, 0x7d, 0x00, 0x8b, 0x00,
+  0x99, 0x00, 0xa6, 0x00, 0xb5, 0x00, 0xc2, 0x00, 0xcf, 0x00, 0xdd, 0x00,
+  0xea, 0x00, 0x00, 0x00, 0x19, 0x00, 0x27, 0x00, 0x35, 0x00, 0x43, 0x00,
+  0x52, 0x00, 0x5e, 0x00, 0x69, 0x00, 0x7b, 0x00, 0x89, 0x00, 0x97, 0x00,
+  0xa3, 0x00, 0xad, 0x00, 0xbb, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x2c, 0x00, 0x3c, 0x00, 0x47, 0x00, 0x57, 0x00, 0x67, 0x00, 0x77, 0x00,
+  0x87, 0x00, 0x97, 0x00, 0xa7, 0x00, 0xb9, 0x00, 0xc9, 0x00, 0xd4, 0x00,
+  0xe4, 0x00, 0xf4, 0x00, 0x04, 0x01, 0x14, 0x01, 0x00, 0x00, 0x14, 0x00,
+  0x24, 0x00, 0x34, 0x00, 0x3e, 0x00, 0x4a, 0x00, 0x5c, 0x00, 0x68, 0x00,
+  0x76, 0x00, 0x84, 0x00, 0x90, 0x00, 0x9c, 0x00, 0xa8, 0x00, 0x00, 0x00,
+  0x21, 0x00, 0x55, 0x00, 0x68, 0x00, 0x72, 0x00, 0x7d, 0x00, 0x8f, 0x00,
+  0xa1, 0x00, 0xb4, 0x00, 0xbf, 0x00, 0xd0, 0x00, 0xe1, 0x00, 0xee, 0x00,
+  0x01, 0x01, 0x13, 0x01, 0x00, 0x00, 0x1f, 0x00, 0x2a, 0x00, 0x34, 0x00,
+  0x42, 0x00, 0x4c, 0x00, 0x5c, 0x00, 0x6b, 0x00, 0x7c, 0x00, 0x8c, 0x00,
+  0x9f, 0x00, 0x00, 0x00, 0x28, 0x00, 0x32, 0x00, 0x46, 0x00, 0x50, 0x00,
+  0x60, 0x00, 0x6b, 0x00, 0x76, 0x00, 0x80, 0x00, 0x94, 0x00, 0x9f, 0x00,
+  0xb3, 0x00, 0xc3, 0x00, 0xd7, 0x00, 0xe1, 0x00, 0xf1, 0x00, 0xfd, 0x00,
+  0x12, 0x01, 0x1c, 0x01, 0x26, 0x01, 0x00, 0x00, 0x27, 0x00, 0x33, 0x00,
+  0x3e, 0x00, 0x4e, 0x00, 0x5d, 0x00, 0x6b, 0x00, 0x77, 0x00, 0x00, 0x00,
+  0x16, 0x00, 0x2a, 0x00, 0x37, 0x00, 0x45, 0x00, 0x50, 0x00, 0x5c, 0x00,
+  0x68, 0x00, 0x76, 0x00, 0x81, 0x00, 0x8d, 0x00, 0x99, 0x00, 0xa5, 0x00,
+  0xb2, 0x00, 0xbe, 0x00, 0xd0, 0x00, 0xdd, 0x00, 0xea, 0x00, 0xf6, 0x00,
+  0x08, 0x01, 0x12, 0x01, 0x1e, 0x01, 0x2c, 0x01, 0x38, 0x01, 0x46, 0x01,
+  0x54, 0x01, 0x5e, 0x01, 0x68, 0x01, 0x73, 0x01, 0x7e, 0x01, 0x90, 0x01,
+  0x9a, 0x01, 0xa6, 0x01, 0xb1, 0x01, 0xbb, 0x01, 0xcd, 0x01, 0xd7, 0x01,
+  0xe3, 0x01, 0xef, 0x01, 0xfb, 0x01, 0x06, 0x02, 0x00, 0x00, 0x20, 0x00,
+  0x2e, 0x00, 0x3d, 0x00, 0x4b, 0x00, 0x59, 0x00, 0x65, 0x00, 0x73, 0x00,
+  0x81, 0x00, 0x8c, 0x00, 0x99, 0x00, 0xa5, 0x00, 0xb0, 0x00, 0xbe, 0x00,
+  0xc9, 0x00, 0xd5, 0x00, 0xdf, 0x00, 0xed, 0x00, 0xfb, 0x00, 0x0c, 0x01,
+  0x1f, 0x01, 0x2d, 0x01, 0x39, 0x01, 0x45, 0x01, 0x51, 0x01, 0x5c, 0x01,
+  0x00, 0x00, 0x1b, 0x00, 0x29, 0x00, 0x33, 0x00, 0x3e, 0x00, 0x4a, 0x00,
+  0x55, 0x00, 0x64, 0x00, 0x6f, 0x00, 0x7d, 0x00, 0x8b, 0x00, 0x97, 0x00,
+  0xa2, 0x00, 0xb0, 0x00, 0xbd, 0x00, 0xc9, 0x00, 0xe1, 0x00, 0xee, 0x00,
+  0xfd, 0x00, 0x09, 0x01, 0x14, 0x01, 0x1f, 0x01, 0x2b, 0x01, 0x39, 0x01,
+  0x4a, 0x01, 0x56, 0x01, 0x64, 0x01, 0x71, 0x01, 0x80, 0x01, 0x90, 0x01,
+  0x9c, 0x01, 0xaa, 0x01, 0xb6, 0x01, 0xc4, 0x01, 0xd2, 0x01, 0xdd, 0x01,
+  0x00, 0x00, 0x12, 0x00, 0x20, 0x00, 0x2c, 0x00, 0x38, 0x00, 0x46, 0x00,
+  0x53, 0x00, 0x5f, 0x00, 0x6a, 0x00, 0x75, 0x00, 0x80, 0x00, 0x8d, 0x00,
+  0x9b, 0x00, 0xaa, 0x00, 0xb6, 0x00, 0xc3, 0x00, 0xcf, 0x00, 0xdc, 0x00,
+  0xe7, 0x00, 0xf2, 0x00, 0xfd, 0x00, 0x0b, 0x01, 0x17, 0x01, 0x24, 0x01,
+  0x31, 0x01, 0x3c, 0x01, 0x48, 0x01, 0x56, 0x01, 0x61, 0x01, 0x6c, 0x01,
+  0x78, 0x01, 0x83, 0x01, 0x8f, 0x01, 0x9d, 0x01, 0xaa, 0x01, 0xc1, 0x01,
+  0xcc, 0x01, 0xdc, 0x01, 0xe8, 0x01, 0xf4, 0x01, 0x01, 0x02, 0x0d, 0x02,
+  0x19, 0x02, 0x25, 0x02, 0x32, 0x02, 0x44, 0x02, 0x52, 0x02, 0x5e, 0x02,
+  0x6c, 0x02, 0x00, 0x00, 0x17, 0x00, 0x39, 0x00, 0x52, 0x00, 0x78, 0x00,
+  0xaa, 0x00, 0xb5, 0x00, 0xc6, 0x00, 0xd2, 0x00, 0xe0, 0x00, 0xee, 0x00,
+  0xfa, 0x00, 0x0a, 0x01, 0x19, 0x01, 0x25, 0x01, 0x31, 0x01, 0x3f, 0x01,
+  0x4d, 0x01, 0x5c, 0x01, 0x65, 0x01, 0x71, 0x01, 0x80, 0x01, 0x8f, 0x01,
+  0x9d, 0x01, 0xac, 0x01, 0xb9, 0x01, 0xcc, 0x01, 0xd8, 0x01, 0xe4, 0x01,
+  0xf1, 0x01, 0xfd, 0x01, 0x0b, 0x02, 0x19, 0x02, 0x29, 0x02, 0x36, 0x02,
+  0x44, 0x02, 0x52, 0x02, 0x60, 0x02, 0x70, 0x02, 0x80, 0x02, 0x8b, 0x02,
+  0x95, 0x02, 0xa2, 0x02, 0xaf, 0x02, 0x00, 0x00, 0x22, 0x00, 0x36, 0x00,
+  0x4f, 0x00, 0x68, 0x00, 0x98, 0x00, 0xa3, 0x00, 0xb4, 0x00, 0xc2, 0x00,
+  0xd0, 0x00, 0xde, 0x00, 0xec, 0x00, 0xfb, 0x00, 0x09, 0x01, 0x18, 0x01,
+  0x2b, 0x01, 0x35, 0x01, 0x44, 0x01, 0x53, 0x01, 0x5d, 0x01, 0x6d, 0x01,
+  0x7b, 0x01, 0x8a, 0x01, 0x98, 0x01, 0xa2, 0x01, 0xb0, 0x01, 0xbf, 0x01,
+  0xce, 0x01, 0xdc, 0x01, 0xea, 0x01, 0xf7, 0x01, 0x05, 0x02, 0x13, 0x02,
+  0x22, 0x02, 0x30, 0x02, 0x3c, 0x02, 0x4e, 0x02, 0x5d, 0x02, 0x69, 0x02,
+  0x75, 0x02, 0x83, 0x02, 0x91, 0x02, 0xa1, 0x02, 0xb0, 0x02, 0xbb, 0x02,
+  0xc9, 0x02, 0xda, 0x02, 0xe8, 0x02, 0xf4, 0x02, 0x02, 0x03, 0x10, 0x03,
+  0x1e, 0x03, 0x29, 0x03, 0x37, 0x03, 0x45, 0x03, 0x54, 0x03, 0x00, 0x00,
+  0x24, 0x00, 0x34, 0x00, 0x51, 0x00, 0x7c, 0x00, 0x88, 0x00, 0x96, 0x00,
+  0xa0, 0x00, 0xab, 0x00, 0xb7, 0x00, 0xc3, 0x00, 0xd6, 0x00, 0xe4, 0x00,
+  0xf2, 0x00, 0x00, 0x01, 0x0a, 0x01, 0x16, 0x01, 0x22, 0x01, 0x30, 0x01,
+  0x3c, 0x01, 0x48, 0x01, 0x54, 0x01, 0x5f, 0x01, 0x6d, 0x01, 0x7a, 0x01,
+  0x85, 0x01, 0x91, 0x01, 0xa4, 0x01, 0xb0, 0x01, 0xba, 0x01, 0xc4, 0x01,
+  0xd5, 0x01, 0xe5, 0x01, 0xf8, 0x01, 0x04, 0x02, 0x10, 0x02, 0x1c, 0x02,
+  0x2a, 0x02, 0x36, 0x02, 0x42, 0x02, 0x50, 0x02, 0x5c, 0x02, 0x6a, 0x02,
+  0x74, 0x02, 0x80, 0x02, 0x8e, 0x02, 0x00, 0x00, 0x17, 0x00, 0x34, 0x00,
+  0x49, 0x00, 0x59, 0x00, 0x64, 0x00, 0x76, 0x00, 0x86, 0x00, 0x96, 0x00,
+  0xa6, 0x00, 0xb2, 0x00, 0xbe, 0x00, 0xcf, 0x00, 0xdf, 0x00, 0xed, 0x00,
+  0xf9, 0x00, 0x04, 0x01, 0x10, 0x01, 0x22, 0x01, 0x2f, 0x01, 0x3d, 0x01,
+  0x4a, 0x01, 0x58, 0x01, 0x65, 0x01, 0x73, 0x01, 0x7f, 0x01, 0x8b, 0x01,
+  0x99, 0x01, 0xa7, 0x01, 0xb3, 0x01, 0xbf, 0x01, 0xcc, 0x01, 0xd9, 0x01,
+  0xe5, 0x01, 0xf7, 0x01, 0x03, 0x02, 0x15, 0x02, 0x22, 0x02, 0x2e, 0x02,
+  0x3b, 0x02, 0x4c, 0x02, 0x5a, 0x02, 0x65, 0x02, 0x76, 0x02, 0x84, 0x02,
+  0x90, 0x02, 0xa2, 0x02, 0xb6, 0x02, 0xc2, 0x02, 0x00, 0x00, 0x1b, 0x00,
+  0x38, 0x00, 0x46, 0x00, 0x6d, 0x00, 0xa6, 0x00, 0xb2, 0x00, 0xc1, 0x00,
+  0xcc, 0x00, 0xdb, 0x00, 0xea, 0x00, 0xf8, 0x00, 0x0d, 0x01, 0x1a, 0x01,
+  0x27, 0x01, 0x36, 0x01, 0x43, 0x01, 0x53, 0x01, 0x62, 0x01, 0x6f, 0x01,
+  0x80, 0x01, 0x8e, 0x01, 0x9d, 0x01, 0xaa, 0x01, 0xb4, 0x01, 0xc0, 0x01,
+  0xcf, 0x01, 0xdb, 0x01, 0xea, 0x01, 0xf8, 0x01, 0x06, 0x02, 0x00, 0x00,
+  0x14, 0x00, 0x2f, 0x00, 0x4c, 0x00, 0x65, 0x00, 0x9e, 0x00, 0xac, 0x00,
+  0xba, 0x00, 0xc8, 0x00, 0xd7, 0x00, 0xe7, 0x00, 0xf3, 0x00, 0xff, 0x00,
+  0x09, 0x01, 0x15, 0x01, 0x21, 0x01, 0x2c, 0x01, 0x3a, 0x01, 0x46, 0x01,
+  0x57, 0x01, 0x60, 0x01, 0x6f, 0x01, 0x7a, 0x01, 0x88, 0x01, 0x97, 0x01,
+  0xa5, 0x01, 0xaf, 0x01, 0xba, 0x01, 0xd4, 0x01, 0xe3, 0x01, 0xef, 0x01,
+  0xfa, 0x01, 0x05, 0x02, 0x14, 0x02, 0x1f, 0x02, 0x2a, 0x02, 0x33, 0x02,
+  0x41, 0x02, 0x4c, 0x02, 0x5b, 0x02, 0x67, 0x02, 0x71, 0x02, 0x80, 0x02,
+  0x8a, 0x02, 0x94, 0x02, 0x9e, 0x02, 0xa8, 0x02, 0xb6, 0x02, 0xc2, 0x02,
+  0xcd, 0x02, 0xdb, 0x02, 0xec, 0x02, 0x00, 0x00, 0x20, 0x00, 0x46, 0x00,
+  0x6c, 0x00, 0x93, 0x00, 0xd0, 0x00, 0xe2, 0x00, 0xf1, 0x00, 0xfc, 0x00,
+  0x0f, 0x01, 0x1f, 0x01, 0x2f, 0x01, 0x42, 0x01, 0x4d, 0x01, 0x5d, 0x01,
+  0x68, 0x01, 0x76, 0x01, 0x80, 0x01, 0x93, 0x01, 0x9f, 0x01, 0xaa, 0x01,
+  0xb4, 0x01, 0xc5, 0x01, 0xd5, 0x01, 0xdf, 0x01, 0xef, 0x01, 0xff, 0x01,
+  0x13, 0x02, 0x1f, 0x02, 0x2e, 0x02, 0x38, 0x02, 0x48, 0x02, 0x54, 0x02,
+  0x64, 0x02, 0x70, 0x02, 0x7f, 0x02, 0x8e, 0x02, 0x9a, 0x02, 0xa4, 0x02,
+  0xaf, 0x02, 0xc1, 0x02, 0xcb, 0x02, 0xdb, 0x02, 0xeb, 0x02, 0xf5, 0x02,
+  0x03, 0x03, 0x13, 0x03, 0x25, 0x03, 0x32, 0x03, 0x41, 0x03, 0x50, 0x03,
+  0x00, 0x00, 0x1f, 0x00, 0x38, 0x00, 0x4c, 0x00, 0x5a, 0x00, 0x91, 0x00,
+  0x9d, 0x00, 0xab, 0x00, 0xb9, 0x00, 0xc9, 0x00, 0xd5, 0x00, 0xe1, 0x00,
+  0xf7, 0x00, 0x03, 0x01, 0x18, 0x01, 0x28, 0x01, 0x34, 0x01, 0x40, 0x01,
+  0x4c, 0x01, 0x58, 0x01, 0x68, 0x01, 0x76, 0x01, 0x82, 0x01, 0x90, 0x01,
+  0x9e, 0x01, 0xaf, 0x01, 0xb7, 0x01, 0xc3, 0x01, 0xcf, 0x01, 0xdb, 0x01,
+  0xe7, 0x01, 0xf8, 0x01, 0x04, 0x02, 0x10, 0x02, 0x00, 0x00, 0x12, 0x00,
+  0x20, 0x00, 0x30, 0x00, 0x3c, 0x00, 0x48, 0x00, 0x55, 0x00, 0x67, 0x00,
+  0x79, 0x00, 0x85, 0x00, 0x97, 0x00, 0xa8, 0x00, 0xb5, 0x00, 0xc7, 0x00,
+  0xd1, 0x00, 0xdd, 0x00, 0xe7, 0x00, 0xf8, 0x00, 0x02, 0x01, 0x12, 0x01,
+  0x1f, 0x01, 0x2c, 0x01, 0x38, 0x01, 0x45, 0x01, 0x4f, 0x01, 0x5c, 0x01,
+  0x6e, 0x01, 0x7a, 0x01, 0x8d, 0x01, 0x00, 0x00, 0x1a, 0x00, 0x2e, 0x00,
+  0x40, 0x00, 0x4e, 0x00, 0x5c, 0x00, 0x6b, 0x00, 0x79, 0x00, 0x85, 0x00,
+  0x99, 0x00, 0xa4, 0x00, 0xb3, 0x00, 0xc2, 0x00, 0xce, 0x00, 0xdd, 0x00,
+  0xf5, 0x00, 0x03, 0x01, 0x0e, 0x01, 0x1c, 0x01, 0x28, 0x01, 0x37, 0x01,
+  0x45, 0x01, 0x4f, 0x01, 0x5e, 0x01, 0x6a, 0x01, 0x79, 0x01, 0x84, 0x01,
+  0x95, 0x01, 0xa5, 0x01, 0xaf, 0x01, 0xbb, 0x01, 0xc5, 0x01, 0xcf, 0x01,
+  0xda, 0x01, 0xe5, 0x01, 0x00, 0x00, 0x15, 0x00, 0x27, 0x00, 0x44, 0x00,
+  0x53, 0x00, 0x67, 0x00, 0x73, 0x00, 0x80, 0x00, 0x8a, 0x00, 0x97, 0x00,
+  0xab, 0x00, 0xbb, 0x00, 0xc6, 0x00, 0xdb, 0x00, 0xec, 0x00, 0x00, 0x00,
+  0x1b, 0x00, 0x29, 0x00, 0x47, 0x00, 0x53, 0x00, 0x60, 0x00, 0x6c, 0x00,
+  0x7c, 0x00, 0x8b, 0x00, 0x99, 0x00, 0xa9, 0x00, 0xb5, 0x00, 0xc5, 0x00,
+  0xd1, 0x00, 0xdd, 0x00, 0xe9, 0x00, 0xf9, 0x00, 0x0c, 0x01, 0x18, 0x01,
+  0x27, 0x01, 0x35, 0x01, 0x41, 0x01, 0x52, 0x01, 0x64, 0x01, 0x75, 0x01,
+  0x81, 0x01, 0x92, 0x01, 0x9e, 0x01, 0xac, 0x01, 0xb8, 0x01, 0xc7, 0x01,
+  0xd3, 0x01, 0xe3, 0x01, 0x00, 0x00, 0x0e, 0x00, 0x28, 0x00, 0x62, 0x00,
+  0x71, 0x00, 0x83, 0x00, 0x91, 0x00, 0x9f, 0x00, 0xae, 0x00, 0xbb, 0x00,
+  0xd1, 0x00, 0xe3, 0x00, 0xf9, 0x00, 0x05, 0x01, 0x00, 0x00, 0x19, 0x00,
+  0x32, 0x00, 0x73, 0x00, 0xa5, 0x00, 0xc5, 0x00, 0xd0, 0x00, 0xde, 0x00,
+  0xef, 0x00, 0xf9, 0x00, 0x07, 0x01, 0x12, 0x01, 0x1d, 0x01, 0x2b, 0x01,
+  0x3c, 0x01, 0x00, 0x00, 0x25, 0x00, 0x39, 0x00, 0x56, 0x00, 0x61, 0x00,
+  0x6f, 0x00, 0x7b, 0x00, 0x89, 0x00, 0x9f, 0x00, 0xad, 0x00, 0xbb, 0x00,
+  0xc7, 0x00, 0x00, 0x00, 0x23, 0x00, 0x35, 0x00, 0x78, 0x00, 0x85, 0x00,
+  0x93, 0x00, 0x9e, 0x00, 0xa9, 0x00, 0xb4, 0x00, 0xc0, 0x00, 0xcb, 0x00,
+  0xd6, 0x00, 0xe1, 0x00, 0xec, 0x00, 0xf7, 0x00, 0x03, 0x01, 0x10, 0x01,
+  0x1d, 0x01, 0x28, 0x01, 0x33, 0x01, 0x00, 0x00, 0x15, 0x00, 0x23, 0x00,
+  0x3e, 0x00, 0x5b, 0x00, 0x6b, 0x00, 0x86, 0x00, 0x9b, 0x00, 0xaa, 0x00,
+  0xb8, 0x00, 0xc4, 0x00, 0xcf, 0x00, 0xe4, 0x00, 0xf4, 0x00, 0x04, 0x01,
+  0x0e, 0x01, 0x18, 0x01, 0x00, 0x00, 0x1d, 0x00, 0x38, 0x00, 0x51, 0x00,
+  0x6a, 0x00, 0x8c, 0x00, 0x9a, 0x00, 0xa8, 0x00, 0xb6, 0x00, 0xc4, 0x00,
+  0xd2, 0x00, 0xe0, 0x00, 0xf3, 0x00, 0xfe, 0x00, 0x0c, 0x01, 0x1a, 0x01,
+  0x28, 0x01, 0x36, 0x01, 0x41, 0x01, 0x4f, 0x01, 0x5d, 0x01, 0x6b, 0x01,
+  0x79, 0x01, 0x87, 0x01, 0x95, 0x01, 0xa3, 0x01, 0xae, 0x01, 0xbc, 0x01,
+  0xc8, 0x01, 0xd6, 0x01, 0xe4, 0x01, 0xf2, 0x01, 0x00, 0x02, 0x0e, 0x02,
+  0x18, 0x02, 0x26, 0x02, 0x33, 0x02, 0x41, 0x02, 0x4f, 0x02, 0x5c, 0x02,
+  0x00, 0x00, 0x1d, 0x00, 0x34, 0x00, 0x46, 0x00, 0x5f, 0x00, 0x76, 0x00,
+  0x86, 0x00, 0x94, 0x00, 0xae, 0x00, 0xc2, 0x00, 0xcf, 0x00, 0xe2, 0x00,
+  0xed, 0x00, 0xfb, 0x00, 0x07, 0x01, 0x12, 0x01, 0x1c, 0x01, 0x27, 0x01,
+  0x33, 0x01, 0x3f, 0x01, 0x4b, 0x01, 0x00, 0x00, 0x1d, 0x00, 0x2b, 0x00,
+  0x48, 0x00, 0x72, 0x00, 0x8d, 0x00, 0xa3, 0x00, 0xae, 0x00, 0xba, 0x00,
+  0xc5, 0x00, 0xd2, 0x00, 0xe3, 0x00, 0xf3, 0x00, 0x01, 0x01, 0x11, 0x01,
+  0x1e, 0x01, 0x2f, 0x01, 0x3f, 0x01, 0x4f, 0x01, 0x5f, 0x01, 0x70, 0x01,
+  0x84, 0x01, 0x92, 0x01, 0x9d, 0x01, 0x00, 0x00, 0x0e, 0x00, 0x1c, 0x00,
+  0x39, 0x00, 0x5c, 0x00, 0x79, 0x00, 0xa2, 0x00, 0xae, 0x00, 0xbd, 0x00,
+  0xca, 0x00, 0xd7, 0x00, 0xe1, 0x00, 0xed, 0x00, 0xfa, 0x00, 0x07, 0x01,
+  0x13, 0x01, 0x20, 0x01, 0x2c, 0x01, 0x00, 0x00, 0x1d, 0x00, 0x2d, 0x00,
+  0x3f, 0x00, 0x5c, 0x00, 0x71, 0x00, 0x8c, 0x00, 0x9a, 0x00, 0xa6, 0x00,
+  0xb1, 0x00, 0xc9, 0x00, 0xd7, 0x00, 0x00, 0x00, 0x26, 0x00, 0x36, 0x00,
+  0x48, 0x00, 0x58, 0x00, 0x83, 0x00, 0x93, 0x00, 0xa2, 0x00, 0xb2, 0x00,
+  0xc2, 0x00, 0xcd, 0x00, 0xdd, 0x00, 0xed, 0x00, 0xfc, 0x00, 0x06, 0x01,
+  0x16, 0x01, 0x20, 0x01, 0x30, 0x01, 0x3e, 0x01, 0x4d, 0x01, 0x5d, 0x01,
+  0x6c, 0x01, 0x7c, 0x01, 0x8c, 0x01, 0x98, 0x01, 0xa8, 0x01, 0xb8, 0x01,
+  0xc8, 0x01, 0xd8, 0x01, 0xe8, 0x01, 0xf8, 0x01, 0x08, 0x02, 0x00, 0x00,
+  0x10, 0x00, 0x1e, 0x00, 0x3f, 0x00, 0x51, 0x00, 0x7c, 0x00, 0x88, 0x00,
+  0x97, 0x00, 0xa8, 0x00, 0xb4, 0x00, 0xc5, 0x00, 0xd5, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x2e, 0x00, 0x52, 0x00, 0x6b, 0x00, 0x82, 0x00, 0xb0, 0x00,
+  0xc3, 0x00, 0xd5, 0x00, 0xdf, 0x00, 0xf1, 0x00, 0x03, 0x01, 0x11, 0x01,
+  0x23, 0x01, 0x35, 0x01, 0x3f, 0x01, 0x52, 0x01, 0x5c, 0x01, 0x6f, 0x01,
+  0x7f, 0x01, 0x91, 0x01, 0x9f, 0x01, 0xb1, 0x01, 0xc3, 0x01, 0xd3, 0x01,
+  0xe5, 0x01, 0xf3, 0x01, 0x05, 0x02, 0x17, 0x02, 0x29, 0x02, 0x00, 0x00,
+  0x0e, 0x00, 0x2e, 0x00, 0x4b, 0x00, 0x5b, 0x00, 0x7b, 0x00, 0x8f, 0x00,
+  0xa3, 0x00, 0xae, 0x00, 0xb9, 0x00, 0xc9, 0x00, 0xd5, 0x00, 0xe1, 0x00,
+  0xf2, 0x00, 0x01, 0x01, 0x0d, 0x01, 0x19, 0x01, 0x24, 0x01, 0x32, 0x01,
+  0x46, 0x01, 0x59, 0x01, 0x6a, 0x01, 0x7d, 0x01, 0x8c, 0x01, 0x00, 0x00,
+  0x12, 0x00, 0x2b, 0x00, 0x40, 0x00, 0x66, 0x00, 0x88, 0x00, 0xba, 0x00,
+  0xd1, 0x00, 0xe1, 0x00, 0xf4, 0x00, 0xff, 0x00, 0x0a, 0x01, 0x1e, 0x01,
+  0x29, 0x01, 0x34, 0x01, 0x44, 0x01, 0x52, 0x01, 0x67, 0x01, 0x7c, 0x01,
+  0x91, 0x01, 0xa1, 0x01, 0xb1, 0x01, 0xc5, 0x01, 0xd2, 0x01, 0xe6, 0x01,
+  0xf7, 0x01, 0x07, 0x02, 0x00, 0x00, 0x0e, 0x00, 0x27, 0x00, 0x42, 0x00,
+  0x64, 0x00, 0x74, 0x00, 0xa2, 0x00, 0xb0, 0x00, 0xbc, 0x00, 0xc8, 0x00,
+  0xdf, 0x00, 0xeb, 0x00, 0xf7, 0x00, 0x03, 0x01, 0x0f, 0x01, 0x1b, 0x01,
+  0x27, 0x01, 0x33, 0x01, 0x3f, 0x01, 0x4b, 0x01, 0x57, 0x01, 0x63, 0x01,
+  0x00, 0x00, 0x1b, 0x00, 0x38, 0x00, 0x5f, 0x00, 0x82, 0x00, 0x9b, 0x00,
+  0xad, 0x00, 0xb9, 0x00, 0xc5, 0x00, 0xd7, 0x00, 0xe9, 0x00, 0xf5, 0x00,
+  0x01, 0x01, 0x0c, 0x01, 0x1e, 0x01, 0x2a, 0x01, 0x38, 0x01, 0x43, 0x01,
+  0x55, 0x01, 0x61, 0x01, 0x6d, 0x01, 0x78, 0x01, 0x8b, 0x01, 0x97, 0x01,
+  0xa1, 0x01, 0xad, 0x01, 0xbb, 0x01, 0xc7, 0x01, 0xd9, 0x01, 0xe9, 0x01,
+  0xf5, 0x01, 0x01, 0x02, 0x13, 0x02, 0x28, 0x02, 0x38, 0x02, 0x44, 0x02,
+  0x50, 0x02, 0x5f, 0x02, 0x6c, 0x02, 0x78, 0x02, 0x87, 0x02, 0x96, 0x02,
+  0xa4, 0x02, 0xb9, 0x02, 0xc3, 0x02, 0xcf, 0x02, 0xdb, 0x02, 0xe6, 0x02,
+  0xf3, 0x02, 0x00, 0x00, 0x36, 0x00, 0x51, 0x00, 0x67, 0x00, 0x86, 0x00,
+  0xab, 0x00, 0xc2, 0x00, 0xcc, 0x00, 0xd8, 0x00, 0xe5, 0x00, 0xf1, 0x00,
+  0xfb, 0x00, 0x07, 0x01, 0x12, 0x01, 0x1e, 0x01, 0x2a, 0x01, 0x38, 0x01,
+  0x44, 0x01, 0x4e, 0x01, 0x5a, 0x01, 0x66, 0x01, 0x72, 0x01, 0x7d, 0x01,
+  0x89, 0x01, 0x95, 0x01, 0xa0, 0x01, 0xab, 0x01, 0xb5, 0x01, 0xc1, 0x01,
+  0xcf, 0x01, 0xdd, 0x01, 0xea, 0x01, 0xfb, 0x01, 0x07, 0x02, 0x11, 0x02,
+  0x1d, 0x02, 0x28, 0x02, 0x33, 0x02, 0x3f, 0x02, 0x4b, 0x02, 0x55, 0x02,
+  0x00, 0x00, 0x0c, 0x00, 0x2e, 0x00, 0x51, 0x00, 0x6c, 0x00, 0x8e, 0x00,
+  0x9a, 0x00, 0xaa, 0x00, 0xb8, 0x00, 0xc4, 0x00, 0xdc, 0x00, 0xe7, 0x00,
+  0xf5, 0x00, 0x01, 0x01, 0x12, 0x01, 0x26, 0x01, 0x34, 0x01, 0x40, 0x01,
+  0x4c, 0x01, 0x60, 0x01, 0x75, 0x01, 0x81, 0x01, 0x8f, 0x01, 0x9d, 0x01,
+  0xae, 0x01, 0xc6, 0x01, 0xd2, 0x01, 0xde, 0x01, 0xec, 0x01, 0x05, 0x02,
+  0x13, 0x02, 0x21, 0x02, 0x2e, 0x02, 0x3c, 0x02, 0x48, 0x02, 0x56, 0x02,
+  0x65, 0x02, 0x73, 0x02, 0x7e, 0x02, 0x8c, 0x02, 0x9a, 0x02, 0xa8, 0x02,
+  0xbe, 0x02, 0xca, 0x02, 0xd8, 0x02, 0xe3, 0x02, 0xf4, 0x02, 0x02, 0x03,
+  0x11, 0x03, 0x1f, 0x03, 0x2b, 0x03, 0x39, 0x03, 0x00, 0x00, 0x10, 0x00,
+  0x22, 0x00, 0x3f, 0x00, 0x6c, 0x00, 0x85, 0x00, 0x90, 0x00, 0x9b, 0x00,
+  0xa9, 0x00, 0xb5, 0x00, 0xc0, 0x00, 0xcc, 0x00, 0xd8, 0x00, 0xe5, 0x00,
+  0xf1, 0x00, 0xfd, 0x00, 0x08, 0x01, 0x16, 0x01, 0x22, 0x01, 0x2e, 0x01,
+  0x39, 0x01, 0x47, 0x01, 0x53, 0x01, 0x5f, 0x01, 0x6c, 0x01, 0x77, 0x01,
+  0x83, 0x01, 0x8f, 0x01, 0x9d, 0x01, 0xa9, 0x01, 0xb4, 0x01, 0xbf, 0x01,
+  0xcb, 0x01, 0xd7, 0x01, 0xe3, 0x01, 0xf1, 0x01, 0x02, 0x02, 0x10, 0x02,
+  0x1b, 0x02, 0x26, 0x02, 0x34, 0x02, 0x3f, 0x02, 0x4c, 0x02, 0x58, 0x02,
+  0x63, 0x02, 0x6f, 0x02, 0x7a, 0x02, 0x88, 0x02, 0x96, 0x02, 0xa2, 0x02,
+  0xb0, 0x02, 0xbb, 0x02, 0xc6, 0x02, 0xd2, 0x02, 0xe0, 0x02, 0xec, 0x02,
+  0x00, 0x00, 0x26, 0x00, 0x36, 0x00, 0x53, 0x00, 0x61, 0x00, 0x7c, 0x00,
+  0x97, 0x00, 0xae, 0x00, 0xd6, 0x00, 0xe1, 0x00, 0xed, 0x00, 0xf9, 0x00,
+  0x04, 0x01, 0x0f, 0x01, 0x20, 0x01, 0x30, 0x01, 0x43, 0x01, 0x4f, 0x01,
+  0x5d, 0x01, 0x6b, 0x01, 0x79, 0x01, 0x87, 0x01, 0x93, 0x01, 0xa1, 0x01,
+  0xad, 0x01, 0xb9, 0x01, 0xc4, 0x01, 0xd0, 0x01, 0xdc, 0x01, 0xea, 0x01,
+  0xf8, 0x01, 0x04, 0x02, 0x10, 0x02, 0x21, 0x02, 0x2d, 0x02, 0x39, 0x02,
+  0x44, 0x02, 0x54, 0x02, 0x60, 0x02, 0x6c, 0x02, 0x76, 0x02, 0x82, 0x02,
+  0x8e, 0x02, 0x00, 0x00, 0x24, 0x00, 0x36, 0x00, 0x4d, 0x00, 0x5b, 0x00,
+  0x6d, 0x00, 0x86, 0x00, 0x9f, 0x00, 0xc7, 0x00, 0xd2, 0x00, 0xe0, 0x00,
+  0xee, 0x00, 0xff, 0x00, 0x0d, 0x01, 0x18, 0x01, 0x26, 0x01, 0x31, 0x01,
+  0x3d, 0x01, 0x4b, 0x01, 0x59, 0x01, 0x67, 0x01, 0x73, 0x01, 0x7e, 0x01,
+  0x8a, 0x01, 0x98, 0x01, 0xa6, 0x01, 0xb0, 0x01, 0xc1, 0x01, 0xcd, 0x01,
+  0xdc, 0x01, 0xea, 0x01, 0xf9, 0x01, 0x07, 0x02, 0x15, 0x02, 0x21, 0x02,
+  0x2f, 0x02, 0x39, 0x02, 0x46, 0x02, 0x54, 0x02, 0x62, 0x02, 0x70, 0x02,
+  0x7c, 0x02, 0x8a, 0x02, 0x99, 0x02, 0xa5, 0x02, 0xaf, 0x02, 0xbd, 0x02,
+  0xcb, 0x02, 0xd9, 0x02, 0xe7, 0x02, 0xf5, 0x02, 0x06, 0x03, 0x14, 0x03,
+  0x22, 0x03, 0x31, 0x03, 0x42, 0x03, 0x00, 0x00, 0x28, 0x00, 0x3e, 0x00,
+  0x5f, 0x00, 0x75, 0x00, 0x9b, 0x00, 0xba, 0x00, 0xe4, 0x00, 0x01, 0x01,
+  0x13, 0x01, 0x34, 0x01, 0x44, 0x01, 0x54, 0x01, 0x73, 0x01, 0x97, 0x01,
+  0xab, 0x01, 0xc8, 0x01, 0xd6, 0x01, 0xe7, 0x01, 0xf5, 0x01, 0x08, 0x02,
+  0x16, 0x02, 0x24, 0x02, 0x30, 0x02, 0x43, 0x02, 0x51, 0x02, 0x5e, 0x02,
+  0x6f, 0x02, 0x85, 0x02, 0x91, 0x02, 0x9f, 0x02, 0xad, 0x02, 0xb9, 0x02,
+  0xc5, 0x02, 0xd3, 0x02, 0xdf, 0x02, 0xec, 0x02, 0x00, 0x03, 0x0e, 0x03,
+  0x1e, 0x03, 0x2a, 0x03, 0x38, 0x03, 0x45, 0x03, 0x53, 0x03, 0x62, 0x03,
+  0x6e, 0x03, 0x7f, 0x03, 0x92, 0x03, 0xa0, 0x03, 0xac, 0x03, 0xbc, 0x03,
+  0xcd, 0x03, 0xdc, 0x03, 0xe8, 0x03, 0xf3, 0x03, 0x01, 0x04, 0x0f, 0x04,
+  0x1a, 0x04, 0x2d, 0x04, 0x00, 0x00, 0x26, 0x00, 0x49, 0x00, 0x66, 0x00,
+  0x76, 0x00, 0x8b, 0x00, 0xa9, 0x00, 0xca, 0x00, 0xda, 0x00, 0xe9, 0x00,
+  0xf5, 0x00, 0x03, 0x01, 0x11, 0x01, 0x1f, 0x01, 0x2b, 0x01, 0x3b, 0x01,
+  0x47, 0x01, 0x53, 0x01, 0x62, 0x01, 0x6e, 0x01, 0x79, 0x01, 0x85, 0x01,
+  0x96, 0x01, 0xa4, 0x01, 0xb0, 0x01, 0xc1, 0x01, 0xcd, 0x01, 0xdb, 0x01,
+  0xe7, 0x01, 0xf7, 0x01, 0x07, 0x02, 0x18, 0x02, 0x26, 0x02, 0x37, 0x02,
+  0x46, 0x02, 0x51, 0x02, 0x5d, 0x02, 0x6e, 0x02, 0x7a, 0x02, 0x86, 0x02,
+  0x94, 0x02, 0x9f, 0x02, 0x00, 0x00, 0x2a, 0x00, 0x46, 0x00, 0x69, 0x00,
+  0x81, 0x00, 0xa4, 0x00, 0xbc, 0x00, 0xe8, 0x00, 0xff, 0x00, 0x26, 0x01,
+  0x41, 0x01, 0x53, 0x01, 0x7a, 0x01, 0x8c, 0x01, 0xbb, 0x01, 0xd2, 0x01,
+  0xdc, 0x01, 0xee, 0x01, 0xfe, 0x01, 0x0c, 0x02, 0x1d, 0x02, 0x2a, 0x02,
+  0x38, 0x02, 0x45, 0x02, 0x53, 0x02, 0x60, 0x02, 0x6d, 0x02, 0x86, 0x02,
+  0x94, 0x02, 0xa0, 0x02, 0xaf, 0x02, 0xbe, 0x02, 0xcb, 0x02, 0xe7, 0x02,
+  0xf4, 0x02, 0x00, 0x03, 0x0c, 0x03, 0x18, 0x03, 0x26, 0x03, 0x33, 0x03,
+  0x3f, 0x03, 0x4b, 0x03, 0x5e, 0x03, 0x6b, 0x03, 0x78, 0x03, 0x85, 0x03,
+  0x91, 0x03, 0xa1, 0x03, 0x00, 0x00, 0x24, 0x00, 0x36, 0x00, 0x59, 0x00,
+  0x74, 0x00, 0x8d, 0x00, 0xac, 0x00, 0xc5, 0x00, 0xd5, 0x00, 0xf7, 0x00,
+  0x05, 0x01, 0x13, 0x01, 0x29, 0x01, 0x35, 0x01, 0x41, 0x01, 0x50, 0x01,
+  0x5e, 0x01, 0x6b, 0x01, 0x77, 0x01, 0x85, 0x01, 0x93, 0x01, 0xa1, 0x01,
+  0xb0, 0x01, 0xbc, 0x01, 0xcb, 0x01, 0xd9, 0x01, 0xe5, 0x01, 0xf3, 0x01,
+  0xff, 0x01, 0x0c, 0x02, 0x16, 0x02, 0x21, 0x02, 0x2f, 0x02, 0x42, 0x02,
+  0x50, 0x02, 0x5a, 0x02, 0x65, 0x02, 0x73, 0x02, 0x83, 0x02, 0x95, 0x02,
+  0xa3, 0x02, 0x00, 0x00, 0x17, 0x00, 0x30, 0x00, 0x45, 0x00, 0x57, 0x00,
+  0x70, 0x00, 0x88, 0x00, 0xa9, 0x00, 0xb9, 0x00, 0xc9, 0x00, 0xd9, 0x00,
+  0xe9, 0x00, 0xfc, 0x00, 0x0c, 0x01, 0x1e, 0x01, 0x2a, 0x01, 0x3b, 0x01,
+  0x4b, 0x01, 0x5b, 0x01, 0x6c, 0x01, 0x7c, 0x01, 0x92, 0x01, 0xa1, 0x01,
+  0xb1, 0x01, 0xc1, 0x01, 0xcf, 0x01, 0xdd, 0x01, 0xf0, 0x01, 0xff, 0x01,
+  0x0b, 0x02, 0x00, 0x00, 0x26, 0x00, 0x43, 0x00, 0x5e, 0x00, 0x75, 0x00,
+  0x83, 0x00, 0x93, 0x00, 0xb2, 0x00, 0xd8, 0x00, 0xe8, 0x00, 0xf4, 0x00,
+  0x02, 0x01, 0x0e, 0x01, 0x1a, 0x01, 0x2a, 0x01, 0x36, 0x01, 0x42, 0x01,
+  0x52, 0x01, 0x5e, 0x01, 0x6a, 0x01, 0x76, 0x01, 0x83, 0x01, 0x8f, 0x01,
+  0x9b, 0x01, 0xaa, 0x01, 0xb6, 0x01, 0xc4, 0x01, 0xd0, 0x01, 0xe1, 0x01,
+  0xed, 0x01, 0xf9, 0x01, 0x09, 0x02, 0x15, 0x02, 0x21, 0x02, 0x2c, 0x02,
+  0x3a, 0x02, 0x48, 0x02, 0x54, 0x02, 0x60, 0x02, 0x6c, 0x02, 0x7a, 0x02,
+  0x88, 0x02, 0x94, 0x02, 0xa0, 0x02, 0xad, 0x02, 0x00, 0x00, 0x1b, 0x00,
+  0x36, 0x00, 0x48, 0x00, 0x63, 0x00, 0x7e, 0x00, 0x9a, 0x00, 0xac, 0x00,
+  0xbd, 0x00, 0xcf, 0x00, 0xdc, 0x00, 0xef, 0x00, 0xfb, 0x00, 0x10, 0x01,
+  0x22, 0x01, 0x34, 0x01, 0x3e, 0x01, 0x4a, 0x01, 0x57, 0x01, 0x70, 0x01,
+  0x82, 0x01, 0x8e, 0x01, 0x9c, 0x01, 0xa9, 0x01, 0xbe, 0x01, 0xcc, 0x01,
+  0xd9, 0x01, 0xe9, 0x01, 0xf3, 0x01, 0xfd, 0x01, 0x07, 0x02, 0x11, 0x02,
+  0x1f, 0x02, 0x2b, 0x02, 0x00, 0x00, 0x1d, 0x00, 0x2f, 0x00, 0x3d, 0x00,
+  0x63, 0x00, 0x7e, 0x00, 0x90, 0x00, 0xa2, 0x00, 0xb0, 0x00, 0xbd, 0x00,
+  0xcc, 0x00, 0xd8, 0x00, 0xe6, 0x00, 0xf1, 0x00, 0xfc, 0x00, 0x0b, 0x01,
+  0x17, 0x01, 0x26, 0x01, 0x36, 0x01, 0x44, 0x01, 0x5b, 0x01, 0x69, 0x01,
+  0x75, 0x01, 0x83, 0x01, 0x8d, 0x01, 0x98, 0x01, 0xa5, 0x01, 0xaf, 0x01,
+  0xb9, 0x01, 0x00, 0x00, 0x12, 0x00, 0x33, 0x00, 0x41, 0x00, 0x51, 0x00,
+  0x74, 0x00, 0x8f, 0x00, 0x9b, 0x00, 0xad, 0x00, 0xbc, 0x00, 0xc8, 0x00,
+  0xd4, 0x00, 0xe5, 0x00, 0xf4, 0x00, 0xff, 0x00, 0x0a, 0x01, 0x16, 0x01,
+  0x26, 0x01, 0x31, 0x01, 0x3d, 0x01, 0x48, 0x01, 0x56, 0x01, 0x66, 0x01,
+  0x00, 0x00, 0x1b, 0x00, 0x29, 0x00, 0x39, 0x00, 0x56, 0x00, 0x7d, 0x00,
+  0x96, 0x00, 0xb1, 0x00, 0xbd, 0x00, 0xcd, 0x00, 0xda, 0x00, 0xe8, 0x00,
+  0xf4, 0x00, 0x04, 0x01, 0x0e, 0x01, 0x1b, 0x01, 0x25, 0x01, 0x00, 0x00,
+  0x2a, 0x00, 0x4a, 0x00, 0x5a, 0x00, 0x68, 0x00, 0x87, 0x00, 0xa6, 0x00,
+  0xb9, 0x00, 0xcc, 0x00, 0xd6, 0x00, 0xeb, 0x00, 0xfa, 0x00, 0x06, 0x01,
+  0x12, 0x01, 0x28, 0x01, 0x40, 0x01, 0x4c, 0x01, 0x62, 0x01, 0x6c, 0x01,
+  0x77, 0x01, 0x82, 0x01, 0x95, 0x01, 0xa0, 0x01, 0xac, 0x01, 0xb6, 0x01,
+  0xc8, 0x01, 0xdf, 0x01, 0x00, 0x00, 0x1d, 0x00, 0x2f, 0x00, 0x3d, 0x00,
+  0x6a, 0x00, 0x87, 0x00, 0x9e, 0x00, 0xb2, 0x00, 0xc0, 0x00, 0xcb, 0x00,
+  0xd6, 0x00, 0xe4, 0x00, 0xf4, 0x00, 0x08, 0x01, 0x16, 0x01, 0x24, 0x01,
+  0x35, 0x01, 0x43, 0x01, 0x4f, 0x01, 0x59, 0x01, 0x67, 0x01, 0x75, 0x01,
+  0x84, 0x01, 0x9a, 0x01, 0xac, 0x01, 0xb7, 0x01, 0xc5, 0x01, 0xd9, 0x01,
+  0xe8, 0x01, 0xf6, 0x01, 0x0a, 0x02, 0x18, 0x02, 0x22, 0x02, 0x31, 0x02,
+  0x00, 0x00, 0x12, 0x00, 0x2b, 0x00, 0x3d, 0x00, 0x56, 0x00, 0x73, 0x00,
+  0x83, 0x00, 0x92, 0x00, 0x9e, 0x00, 0xb6, 0x00, 0xc2, 0x00, 0xce, 0x00,
+  0xda, 0x00, 0xee, 0x00, 0xfa, 0x00, 0x06, 0x01, 0x00, 0x00, 0x12, 0x00,
+  0x27, 0x00, 0x39, 0x00, 0x4d, 0x00, 0x7b, 0x00, 0x90, 0x00, 0x9b, 0x00,
+  0xa6, 0x00, 0xb1, 0x00, 0xbc, 0x00, 0xc8, 0x00, 0xda, 0x00, 0xe5, 0x00,
+  0xf1, 0x00, 0xfe, 0x00, 0x09, 0x01, 0x15, 0x01, 0x20, 0x01, 0x2b, 0x01,
+  0x3d, 0x01, 0x51, 0x01, 0x5c, 0x01, 0x67, 0x01, 0x77, 0x01, 0x87, 0x01,
+  0x98, 0x01, 0xa3, 0x01, 0xae, 0x01, 0xbb, 0x01, 0xc6, 0x01, 0xd2, 0x01,
+  0xe0, 0x01, 0xec, 0x01, 0xf8, 0x01, 0x04, 0x02, 0x12, 0x02, 0x00, 0x00,
+  0x12, 0x00, 0x3b, 0x00, 0x49, 0x00, 0x64, 0x00, 0x74, 0x00, 0x88, 0x00,
+  0x96, 0x00, 0xa4, 0x00, 0xaf, 0x00, 0xba, 0x00, 0xc9, 0x00, 0xd3, 0x00,
+  0xe2, 0x00, 0xed, 0x00, 0x08, 0x01, 0x14, 0x01, 0x26, 0x01, 0x31, 0x01,
+  0x3d, 0x01, 0x48, 0x01, 0x57, 0x01, 0x00, 0x00, 0x14, 0x00, 0x50, 0x00,
+  0x67, 0x00, 0x7e, 0x00, 0xba, 0x00, 0xe2, 0x00, 0x04, 0x01, 0x18, 0x01,
+  0x2b, 0x01, 0x36, 0x01, 0x44, 0x01, 0x52, 0x01, 0x60, 0x01, 0x6b, 0x01,
+  0x79, 0x01, 0x87, 0x01, 0x98, 0x01, 0xa6, 0x01, 0xb5, 0x01, 0xc3, 0x01,
+  0xd3, 0x01, 0xdd, 0x01, 0xe8, 0x01, 0xf4, 0x01, 0x02, 0x02, 0x10, 0x02,
+  0x00, 0x00, 0x24, 0x00, 0x3d, 0x00, 0x56, 0x00, 0x64, 0x00, 0x85, 0x00,
+  0xa0, 0x00, 0xb9, 0x00, 0xc7, 0x00, 0xd7, 0x00, 0xe3, 0x00, 0xef, 0x00,
+  0x00, 0x00, 0x1b, 0x00, 0x32, 0x00, 0x51, 0x00, 0x68, 0x00, 0x78, 0x00,
+  0x95, 0x00, 0xac, 0x00, 0xc5, 0x00, 0xd6, 0x00, 0xea, 0x00, 0xfb, 0x00,
+  0x0c, 0x01, 0x17, 0x01, 0x28, 0x01, 0x39, 0x01, 0x45, 0x01, 0x50, 0x01,
+  0x5e, 0x01, 0x00, 0x00, 0x31, 0x00, 0x51, 0x00, 0x6c, 0x00, 0x83, 0x00,
+  0x9c, 0x00, 0xac, 0x00, 0xe6, 0x00, 0x07, 0x01, 0x16, 0x01, 0x24, 0x01,
+  0x32, 0x01, 0x3f, 0x01, 0x4d, 0x01, 0x5b, 0x01, 0x68, 0x01, 0x75, 0x01,
+  0x82, 0x01, 0x8f, 0x01, 0x00, 0x00, 0x1f, 0x00, 0x3f, 0x00, 0x56, 0x00,
+  0x75, 0x00, 0x87, 0x00, 0xa9, 0x00, 0xbf, 0x00, 0xcd, 0x00, 0xdb, 0x00,
+  0xe9, 0x00, 0xf7, 0x00, 0x05, 0x01, 0x13, 0x01, 0x22, 0x01, 0x2f, 0x01,
+  0x3d, 0x01, 0x49, 0x01, 0x57, 0x01, 0x65, 0x01, 0x74, 0x01, 0x80, 0x01,
+  0x8e, 0x01, 0x9c, 0x01, 0xaa, 0x01, 0xb8, 0x01, 0xcb, 0x01, 0xd6, 0x01,
+  0xe4, 0x01, 0xf4, 0x01, 0x02, 0x02, 0x10, 0x02, 0x1b, 0x02, 0x29, 0x02,
+  0x37, 0x02, 0x43, 0x02, 0x52, 0x02, 0x60, 0x02, 0x6b, 0x02, 0x79, 0x02,
+  0x85, 0x02, 0x93, 0x02, 0x9f, 0x02, 0x00, 0x00, 0x10, 0x00, 0x46, 0x00,
+  0x63, 0x00, 0x7c, 0x00, 0xb2, 0x00, 0xcd, 0x00, 0xfc, 0x00, 0x17, 0x01,
+  0x27, 0x01, 0x37, 0x01, 0x41, 0x01, 0x51, 0x01, 0x5f, 0x01, 0x70, 0x01,
+  0x7c, 0x01, 0x8c, 0x01, 0x9c, 0x01, 0xab, 0x01, 0xbb, 0x01, 0xcd, 0x01,
+  0xdd, 0x01, 0xed, 0x01, 0xff, 0x01, 0x0f, 0x02, 0x1f, 0x02, 0x2f, 0x02,
+  0x3e, 0x02, 0x4a, 0x02, 0x59, 0x02, 0x69, 0x02, 0x79, 0x02, 0x89, 0x02,
+  0x99, 0x02, 0xa9, 0x02, 0xba, 0x02, 0xcb, 0x02, 0xd6, 0x02, 0x00, 0x00,
+  0x1b, 0x00, 0x3b, 0x00, 0x4d, 0x00, 0x5f, 0x00, 0x99, 0x00, 0xcd, 0x00,
+  0xf1, 0x00, 0x10, 0x01, 0x1e, 0x01, 0x2a, 0x01, 0x3b, 0x01, 0x4b, 0x01,
+  0x57, 0x01, 0x68, 0x01, 0x76, 0x01, 0x86, 0x01, 0x92, 0x01, 0xa2, 0x01,
+  0xb3, 0x01, 0xbf, 0x01, 0xd0, 0x01, 0x00, 0x00, 0x10, 0x00, 0x20, 0x00,
+  0x4f, 0x00, 0x71, 0x00, 0x8d, 0x00, 0xa1, 0x00, 0xb3, 0x00, 0xbe, 0x00,
+  0xd0, 0x00, 0xe2, 0x00, 0xf4, 0x00, 0xfe, 0x00, 0x11, 0x01, 0x1c, 0x01,
+  0x2d, 0x01, 0x3c, 0x01, 0x4c, 0x01, 0x5c, 0x01, 0x6e, 0x01, 0x80, 0x01,
+  0x92, 0x01, 0xa4, 0x01, 0xb6, 0x01, 0xc1, 0x01, 0xd3, 0x01, 0xdd, 0x01,
+  0xe9, 0x01, 0xfb, 0x01, 0x09, 0x02, 0x17, 0x02, 0x2a, 0x02, 0x00, 0x00,
+  0x1f, 0x00, 0x3a, 0x00, 0x53, 0x00, 0x5f, 0x00, 0x81, 0x00, 0x93, 0x00,
+  0xae, 0x00, 0xb9, 0x00, 0xc5, 0x00, 0xd7, 0x00, 0xe5, 0x00, 0xf4, 0x00,
+  0x00, 0x01, 0x0c, 0x01, 0x1b, 0x01, 0x00, 0x00, 0x1d, 0x00, 0x36, 0x00,
+  0x58, 0x00, 0x66, 0x00, 0x76, 0x00, 0x9e, 0x00, 0xbc, 0x00, 0xc7, 0x00,
+  0xda, 0x00, 0xeb, 0x00, 0xf7, 0x00, 0x09, 0x01, 0x19, 0x01, 0x24, 0x01,
+  0x2f, 0x01, 0x39, 0x01, 0x43, 0x01, 0x4e, 0x01, 0x59, 0x01, 0x6e, 0x01,
+  0x7a, 0x01, 0x8b, 0x01, 0x96, 0x01, 0xab, 0x01, 0xb6, 0x01, 0xc3, 0x01,
+  0xcf, 0x01, 0xe0, 0x01, 0xeb, 0x01, 0xfb, 0x01, 0x00, 0x00, 0x35, 0x00,
+  0x4f, 0x00, 0x6a, 0x00, 0x7e, 0x00, 0x9c, 0x00, 0xac, 0x00, 0xb8, 0x00,
+  0xc7, 0x00, 0xd6, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x2d, 0x00, 0x3b, 0x00,
+  0x4f, 0x00, 0x6a, 0x00, 0x8d, 0x00, 0xa3, 0x00, 0xae, 0x00, 0xbc, 0x00,
+  0xce, 0x00, 0xe0, 0x00, 0xec, 0x00, 0xf8, 0x00, 0x0c, 0x01, 0x18, 0x01,
+  0x24, 0x01, 0x30, 0x01, 0x3f, 0x01, 0x4b, 0x01, 0x5d, 0x01, 0x69, 0x01,
+  0x7d, 0x01, 0x91, 0x01, 0x9f, 0x01, 0xb5, 0x01, 0xc1, 0x01, 0xcd, 0x01,
+  0xd9, 0x01, 0xe5, 0x01, 0xf0, 0x01, 0xfe, 0x01, 0x0a, 0x02, 0x16, 0x02,
+  0x22, 0x02, 0x2d, 0x02, 0x39, 0x02, 0x46, 0x02, 0x55, 0x02, 0x61, 0x02,
+  0x00, 0x00, 0x19, 0x00, 0x29, 0x00, 0x39, 0x00, 0x49, 0x00, 0x59, 0x00,
+  0x69, 0x00, 0x77, 0x00, 0x88, 0x00, 0x93, 0x00, 0x9e, 0x00, 0xb2, 0x00,
+  0xbe, 0x00, 0xca, 0x00, 0xd5, 0x00, 0xe0, 0x00, 0xeb, 0x00, 0xf6, 0x00,
+  0x00, 0x01, 0x0b, 0x01, 0x20, 0x01, 0x2b, 0x01, 0x3c, 0x01, 0x48, 0x01,
+  0x54, 0x01, 0x5f, 0x01, 0x6d, 0x01, 0x78, 0x01, 0x84, 0x01, 0x99, 0x01,
+  0x00, 0x00, 0x19, 0x00, 0x2e, 0x00, 0x47, 0x00, 0x57, 0x00, 0x79, 0x00,
+  0x8d, 0x00, 0xa0, 0x00, 0xac, 0x00, 0xb7, 0x00, 0xc5, 0x00, 0xd6, 0x00,
+  0xe2, 0x00, 0xee, 0x00, 0xfd, 0x00, 0x0b, 0x01, 0x17, 0x01, 0x23, 0x01,
+  0x2f, 0x01, 0x3b, 0x01, 0x49, 0x01, 0x58, 0x01, 0x66, 0x01, 0x71, 0x01,
+  0x7f, 0x01, 0x8a, 0x01, 0x98, 0x01, 0xa6, 0x01, 0xb1, 0x01, 0xbd, 0x01,
+  0xc9, 0x01, 0xd5, 0x01, 0xe6, 0x01, 0xf4, 0x01, 0x0c, 0x02, 0x18, 0x02,
+  0x27, 0x02, 0x35, 0x02, 0x43, 0x02, 0x4f, 0x02, 0x5e, 0x02, 0x6b, 0x02,
+  0x75, 0x02, 0x81, 0x02, 0x96, 0x02, 0xa2, 0x02, 0xae, 0x02, 0xbc, 0x02,
+  0xc7, 0x02, 0xd1, 0x02, 0xdc, 0x02, 0xe8, 0x02, 0xf6, 0x02, 0x02, 0x03,
+  0x00, 0x00, 0x28, 0x00, 0x41, 0x00, 0x51, 0x00, 0x72, 0x00, 0x82, 0x00,
+  0x94, 0x00, 0xab, 0x00, 0xb9, 0x00, 0xc7, 0x00, 0xd5, 0x00, 0xe0, 0x00,
+  0xeb, 0x00, 0xf6, 0x00, 0x01, 0x01, 0x0c, 0x01, 0x17, 0x01, 0x22, 0x01,
+  0x2e, 0x01, 0x39, 0x01, 0x44, 0x01, 0x52, 0x01, 0x5e, 0x01, 0x6c, 0x01,
+  0x78, 0x01, 0x83, 0x01, 0x91, 0x01, 0x9d, 0x01, 0xab, 0x01, 0xb9, 0x01,
+  0xc5, 0x01, 0xd0, 0x01, 0xdc, 0x01, 0xe8, 0x01, 0xf3, 0x01, 0x01, 0x02,
+  0x0d, 0x02, 0x1b, 0x02, 0x26, 0x02, 0x34, 0x02, 0x3f, 0x02, 0x4a, 0x02,
+  0x58, 0x02, 0x66, 0x02, 0x74, 0x02, 0x80, 0x02, 0x8c, 0x02, 0x98, 0x02,
+  0xa4, 0x02, 0xb0, 0x02, 0xbb, 0x02, 0xc6, 0x02, 0xd1, 0x02, 0xdc, 0x02,
+  0xe7, 0x02, 0xf5, 0x02, 0x03, 0x03, 0x10, 0x03, 0x1b, 0x03, 0x29, 0x03,
+  0x34, 0x03, 0x42, 0x03, 0x00, 0x00, 0x2a, 0x00, 0x56, 0x00, 0x64, 0x00,
+  0xa0, 0x00, 0xb9, 0x00, 0xcb, 0x00, 0xe2, 0x00, 0xf1, 0x00, 0xfc, 0x00,
+  0x08, 0x01, 0x13, 0x01, 0x1f, 0x01, 0x36, 0x01, 0x44, 0x01, 0x5e, 0x01,
+  0x6d, 0x01, 0x7b, 0x01, 0x89, 0x01, 0x95, 0x01, 0xa1, 0x01, 0xaf, 0x01,
+  0xb9, 0x01, 0xc5, 0x01, 0xd1, 0x01, 0xe3, 0x01, 0xf9, 0x01, 0x0a, 0x02,
+  0x18, 0x02, 0x26, 0x02, 0x34, 0x02, 0x40, 0x02, 0x4e, 0x02, 0x5f, 0x02,
+  0x6e, 0x02, 0x7c, 0x02, 0x8c, 0x02, 0x96, 0x02, 0xa0, 0x02, 0xae, 0x02,
+  0xbc, 0x02, 0xc7, 0x02, 0xd1, 0x02, 0xdf, 0x02, 0xee, 0x02, 0xfc, 0x02,
+  0x08, 0x03, 0x14, 0x03, 0x22, 0x03, 0x30, 0x03, 0x3e, 0x03, 0x4b, 0x03,
+  0x56, 0x03, 0x00, 0x00, 0x2c, 0x00, 0x45, 0x00, 0x83, 0x00, 0x95, 0x00,
+  0xa3, 0x00, 0xc0, 0x00, 0xce, 0x00, 0xdf, 0x00, 0xed, 0x00, 0xfb, 0x00,
+  0x09, 0x01, 0x18, 0x01, 0x26, 0x01, 0x34, 0x01, 0x42, 0x01, 0x52, 0x01,
+  0x60, 0x01, 0x6e, 0x01, 0x7c, 0x01, 0x8a, 0x01, 0x98, 0x01, 0xa6, 0x01,
+  0xb2, 0x01, 0xc0, 0x01, 0xce, 0x01, 0xd9, 0x01, 0xe5, 0x01, 0xee, 0x01,
+  0xfa, 0x01, 0x08, 0x02, 0x16, 0x02, 0x24, 0x02, 0x32, 0x02, 0x40, 0x02,
+  0x4e, 0x02, 0x63, 0x02, 0x70, 0x02, 0x7c, 0x02, 0x8a, 0x02, 0x98, 0x02,
+  0xa8, 0x02, 0xb3, 0x02, 0xc4, 0x02, 0xd2, 0x02, 0xe0, 0x02, 0xee, 0x02,
+  0xf9, 0x02, 0x07, 0x03, 0x11, 0x03, 0x1b, 0x03, 0x2c, 0x03, 0x3b, 0x03,
+  0x49, 0x03, 0x57, 0x03, 0x65, 0x03, 0x77, 0x03, 0x86, 0x03, 0x96, 0x03,
+  0xa4, 0x03, 0xb2, 0x03, 0xc1, 0x03, 0xcf, 0x03, 0xdb, 0x03, 0xe9, 0x03,
+  0x00, 0x00, 0x24, 0x00, 0x54, 0x00, 0x6c, 0x00, 0x8d, 0x00, 0xba, 0x00,
+  0xdc, 0x00, 0xf9, 0x00, 0x1a, 0x01, 0x3e, 0x01, 0x5b, 0x01, 0x7e, 0x01,
+  0xa2, 0x01, 0xbb, 0x01, 0xd9, 0x01, 0xeb, 0x01, 0x02, 0x02, 0x0e, 0x02,
+  0x1c, 0x02, 0x2a, 0x02, 0x38, 0x02, 0x44, 0x02, 0x55, 0x02, 0x61, 0x02,
+  0x6f, 0x02, 0x7d, 0x02, 0x89, 0x02, 0x9a, 0x02, 0xa6, 0x02, 0xb4, 0x02,
+  0xc0, 0x02, 0xce, 0x02, 0xdc, 0x02, 0xe8, 0x02, 0xf6, 0x02, 0x04, 0x03,
+  0x10, 0x03, 0x1e, 0x03, 0x2c, 0x03, 0x3d, 0x03, 0x49, 0x03, 0x55, 0x03,
+  0x61, 0x03, 0x6d, 0x03, 0x7b, 0x03, 0x88, 0x03, 0x9b, 0x03, 0xa7, 0x03,
+  0xb5, 0x03, 0xc1, 0x03, 0xcd, 0x03, 0xdb, 0x03, 0xe7, 0x03, 0xf5, 0x03,
+  0x00, 0x04, 0x12, 0x04, 0x20, 0x04, 0x34, 0x04, 0x40, 0x04, 0x4c, 0x04,
+  0x00, 0x00, 0x23, 0x00, 0x35, 0x00, 0x4e, 0x00, 0x69, 0x00, 0x77, 0x00,
+  0x8c, 0x00, 0x9a, 0x00, 0xa6, 0x00, 0xb5, 0x00, 0xc4, 0x00, 0xd5, 0x00,
+  0xe1, 0x00, 0xef, 0x00, 0xff, 0x00, 0x0e, 0x01, 0x1a, 0x01, 0x23, 0x01,
+  0x3b, 0x01, 0x47, 0x01, 0x55, 0x01, 0x62, 0x01, 0x71, 0x01, 0x7d, 0x01,
+  0x8d, 0x01, 0x9b, 0x01, 0xa9, 0x01, 0xb7, 0x01, 0xc5, 0x01, 0xd6, 0x01,
+  0xe1, 0x01, 0xf3, 0x01, 0x00, 0x02, 0x18, 0x02, 0x24, 0x02, 0x31, 0x02,
+  0x3f, 0x02, 0x50, 0x02, 0x5e, 0x02, 0x6a, 0x02, 0x79, 0x02, 0x87, 0x02,
+  0x93, 0x02, 0xab, 0x02, 0xb6, 0x02, 0xc5, 0x02, 0xd5, 0x02, 0xe1, 0x02,
+  0xed, 0x02, 0xfc, 0x02, 0x08, 0x03, 0x13, 0x03, 0x1f, 0x03, 0x2b, 0x03,
+  0x37, 0x03, 0x45, 0x03, 0x51, 0x03, 0x60, 0x03, 0x6d, 0x03, 0x7a, 0x03,
+  0x00, 0x00, 0x26, 0x00, 0x58, 0x00, 0x72, 0x00, 0x97, 0x00, 0xc8, 0x00,
+  0xec, 0x00, 0x0b, 0x01, 0x2e, 0x01, 0x4f, 0x01, 0x72, 0x01, 0x95, 0x01,
+  0xbb, 0x01, 0xd6, 0x01, 0xef, 0x01, 0x06, 0x02, 0x1b, 0x02, 0x29, 0x02,
+  0x39, 0x02, 0x4d, 0x02, 0x5c, 0x02, 0x6a, 0x02, 0x78, 0x02, 0x8d, 0x02,
+  0x99, 0x02, 0xa5, 0x02, 0xb0, 0x02, 0xbc, 0x02, 0xc8, 0x02, 0xd4, 0x02,
+  0xe1, 0x02, 0xeb, 0x02, 0xf6, 0x02, 0x03, 0x03, 0x11, 0x03, 0x1f, 0x03,
+  0x2b, 0x03, 0x39, 0x03, 0x48, 0x03, 0x56, 0x03, 0x64, 0x03, 0x71, 0x03,
+  0x7d, 0x03, 0x8b, 0x03, 0x99, 0x03, 0xaa, 0x03, 0xb6, 0x03, 0xc4, 0x03,
+  0xcf, 0x03, 0xe1, 0x03, 0xef, 0x03, 0xfe, 0x03, 0x11, 0x04, 0x1e, 0x04,
+  0x2c, 0x04, 0x00, 0x00, 0x22, 0x00, 0x45, 0x00, 0x60, 0x00, 0x77, 0x00,
+  0x87, 0x00, 0xae, 0x00, 0xc7, 0x00, 0xd0, 0x00, 0xdf, 0x00, 0xf0, 0x00,
+  0xfe, 0x00, 0x0c, 0x01, 0x1a, 0x01, 0x28, 0x01, 0x36, 0x01, 0x42, 0x01,
+  0x51, 0x01, 0x5f, 0x01, 0x6d, 0x01, 0x78, 0x01, 0x82, 0x01, 0x90, 0x01,
+  0x9e, 0x01, 0xac, 0x01, 0xb8, 0x01, 0xc4, 0x01, 0xd4, 0x01, 0xdf, 0x01,
+  0xee, 0x01, 0xfe, 0x01, 0x0d, 0x02, 0x1c, 0x02, 0x28, 0x02, 0x34, 0x02,
+  0x42, 0x02, 0x50, 0x02, 0x61, 0x02, 0x74, 0x02, 0x83, 0x02, 0x91, 0x02,
+  0x9d, 0x02, 0xab, 0x02, 0xbd, 0x02, 0xce, 0x02, 0xd8, 0x02, 0xe6, 0x02,
+  0xee, 0x02, 0xf8, 0x02, 0x03, 0x03, 0x16, 0x03, 0x22, 0x03, 0x31, 0x03,
+  0x3f, 0x03, 0x4e, 0x03, 0x5c, 0x03, 0x6a, 0x03, 0x7c, 0x03, 0x86, 0x03,
+  0x00, 0x00, 0x23, 0x00, 0x31, 0x00, 0x71, 0x00, 0x83, 0x00, 0x9a, 0x00,
+  0xb1, 0x00, 0xc2, 0x00, 0xd5, 0x00, 0xe8, 0x00, 0xf8, 0x00, 0x04, 0x01,
+  0x0e, 0x01, 0x1e, 0x01, 0x2e, 0x01, 0x3e, 0x01, 0x4c, 0x01, 0x59, 0x01,
+  0x69, 0x01, 0x79, 0x01, 0x89, 0x01, 0x99, 0x01, 0xa5, 0x01, 0xb4, 0x01,
+  0xc4, 0x01, 0xd0, 0x01, 0x00, 0x00, 0x23, 0x00, 0x4f, 0x00, 0x8d, 0x00,
+  0x9f, 0x00, 0xba, 0x00, 0xcf, 0x00, 0xe1, 0x00, 0xf3, 0x00, 0x01, 0x01,
+  0x11, 0x01, 0x23, 0x01, 0x31, 0x01, 0x3d, 0x01, 0x4a, 0x01, 0x58, 0x01,
+  0x66, 0x01, 0x7b, 0x01, 0x89, 0x01, 0x97, 0x01, 0xab, 0x01, 0xb7, 0x01,
+  0xc9, 0x01, 0xd5, 0x01, 0xe2, 0x01, 0xf0, 0x01, 0xfc, 0x01, 0x08, 0x02,
+  0x14, 0x02, 0x26, 0x02, 0x32, 0x02, 0x40, 0x02, 0x4e, 0x02, 0x5a, 0x02,
+  0x68, 0x02, 0x7a, 0x02, 0x8c, 0x02, 0x9e, 0x02, 0xaa, 0x02, 0xb6, 0x02,
+  0xc8, 0x02, 0xd4, 0x02, 0xe0, 0x02, 0xec, 0x02, 0xf8, 0x02, 0x09, 0x03,
+  0x12, 0x03, 0x20, 0x03, 0x2c, 0x03, 0x38, 0x03, 0x00, 0x00, 0x1d, 0x00,
+  0x40, 0x00, 0x67, 0x00, 0x7e, 0x00, 0x95, 0x00, 0xbb, 0x00, 0xdf, 0x00,
+  0xf4, 0x00, 0x00, 0x01, 0x0c, 0x01, 0x18, 0x01, 0x24, 0x01, 0x33, 0x01,
+  0x3e, 0x01, 0x50, 0x01, 0x5b, 0x01, 0x68, 0x01, 0x7a, 0x01, 0x84, 0x01,
+  0x96, 0x01, 0xa8, 0x01, 0xb4, 0x01, 0xc6, 0x01, 0xd4, 0x01, 0xe1, 0x01,
+  0xf0, 0x01, 0xfc, 0x01, 0x0b, 0x02, 0x16, 0x02, 0x28, 0x02, 0x38, 0x02,
+  0x44, 0x02, 0x52, 0x02, 0x64, 0x02, 0x72, 0x02, 0x84, 0x02, 0x96, 0x02,
+  0xa7, 0x02, 0xb9, 0x02, 0xc5, 0x02, 0xd8, 0x02, 0xe4, 0x02, 0xf6, 0x02,
+  0x03, 0x03, 0x0e, 0x03, 0x00, 0x00, 0x1f, 0x00, 0x42, 0x00, 0x56, 0x00,
+  0x74, 0x00, 0x8b, 0x00, 0xa6, 0x00, 0xcc, 0x00, 0xdc, 0x00, 0xe7, 0x00,
+  0xf2, 0x00, 0xff, 0x00, 0x0a, 0x01, 0x1e, 0x01, 0x2a, 0x01, 0x35, 0x01,
+  0x41, 0x01, 0x4f, 0x01, 0x5d, 0x01, 0x6b, 0x01, 0x76, 0x01, 0x85, 0x01,
+  0x91, 0x01, 0x9e, 0x01, 0xae, 0x01, 0xbc, 0x01, 0xc6, 0x01, 0xd3, 0x01,
+  0xe1, 0x01, 0xef, 0x01, 0xfb, 0x01, 0x05, 0x02, 0x13, 0x02, 0x21, 0x02,
+  0x30, 0x02, 0x3a, 0x02, 0x44, 0x02, 0x00, 0x00, 0x23, 0x00, 0x4a, 0x00,
+  0x5a, 0x00, 0x71, 0x00, 0x8c, 0x00, 0xa3, 0x00, 0xb5, 0x00, 0xc1, 0x00,
+  0xd2, 0x00, 0xdd, 0x00, 0xea, 0x00, 0xf6, 0x00, 0x02, 0x01, 0x0e, 0x01,
+  0x21, 0x01, 0x2c, 0x01, 0x3b, 0x01, 0x45, 0x01, 0x51, 0x01, 0x5d, 0x01,
+  0x72, 0x01, 0x80, 0x01, 0x8e, 0x01, 0x9c, 0x01, 0xb0, 0x01, 0xc1, 0x01,
+  0xd5, 0x01, 0x00, 0x00, 0x23, 0x00, 0x3c, 0x00, 0x5c, 0x00, 0x73, 0x00,
+  0x8a, 0x00, 0x9a, 0x00, 0xac, 0x00, 0xb8, 0x00, 0xc5, 0x00, 0xd3, 0x00,
+  0xe0, 0x00, 0xed, 0x00, 0xfb, 0x00, 0x09, 0x01, 0x15, 0x01, 0x25, 0x01,
+  0x32, 0x01, 0x40, 0x01, 0x4f, 0x01, 0x5b, 0x01, 0x67, 0x01, 0x73, 0x01,
+  0x89, 0x01, 0x97, 0x01, 0xa3, 0x01, 0xaf, 0x01, 0xbb, 0x01, 0xc7, 0x01,
+  0xd3, 0x01, 0xdf, 0x01, 0xeb, 0x01, 0xf8, 0x01, 0x00, 0x00, 0x23, 0x00,
+  0x59, 0x00, 0x67, 0x00, 0x92, 0x00, 0xa2, 0x00, 0xb9, 0x00, 0xc7, 0x00,
+  0xdd, 0x00, 0xf0, 0x00, 0x02, 0x01, 0x15, 0x01, 0x27, 0x01, 0x3d, 0x01,
+  0x53, 0x01, 0x68, 0x01, 0x7d, 0x01, 0x90, 0x01, 0xa5, 0x01, 0xb4, 0x01,
+  0xc7, 0x01, 0xda, 0x01, 0xf0, 0x01, 0x05, 0x02, 0x13, 0x02, 0x29, 0x02,
+  0x3b, 0x02, 0x51, 0x02, 0x62, 0x02, 0x75, 0x02, 0x83, 0x02, 0x92, 0x02,
+  0x00, 0x00, 0x23, 0x00, 0x43, 0x00, 0x64, 0x00, 0x7d, 0x00, 0xa6, 0x00,
+  0xbb, 0x00, 0xcb, 0x00, 0xe2, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0x08, 0x01,
+  0x16, 0x01, 0x24, 0x01, 0x3d, 0x01, 0x49, 0x01, 0x59, 0x01, 0x67, 0x01,
+  0x75, 0x01, 0x81, 0x01, 0x00, 0x00, 0x1d, 0x00, 0x40, 0x00, 0x5d, 0x00,
+  0x78, 0x00, 0x95, 0x00, 0xac, 0x00, 0xc0, 0x00, 0xe1, 0x00, 0xed, 0x00,
+  0xf9, 0x00, 0x05, 0x01, 0x12, 0x01, 0x27, 0x01, 0x36, 0x01, 0x42, 0x01,
+  0x4e, 0x01, 0x63, 0x01, 0x77, 0x01, 0x85, 0x01, 0x90, 0x01, 0xa6, 0x01,
+  0xb2, 0x01, 0xbc, 0x01, 0xc8, 0x01, 0xd4, 0x01, 0xe2, 0x01, 0xf7, 0x01,
+  0x00, 0x00, 0x23, 0x00, 0x59, 0x00, 0x74, 0x00, 0x97, 0x00, 0xb0, 0x00,
+  0xc5, 0x00, 0xe3, 0x00, 0xef, 0x00, 0xff, 0x00, 0x0a, 0x01, 0x17, 0x01,
+  0x24, 0x01, 0x31, 0x01, 0x3c, 0x01, 0x48, 0x01, 0x56, 0x01, 0x61, 0x01,
+  0x6c, 0x01, 0x7d, 0x01, 0x89, 0x01, 0x97, 0x01, 0xa3, 0x01, 0xae, 0x01,
+  0xbb, 0x01, 0xc8, 0x01, 0xd6, 0x01, 0xe1, 0x01, 0xec, 0x01, 0xf9, 0x01,
+  0x05, 0x02, 0x10, 0x02, 0x1d, 0x02, 0x00, 0x00, 0x21, 0x00, 0x56, 0x00,
+  0x66, 0x00, 0x78, 0x00, 0x97, 0x00, 0xa3, 0x00, 0xb9, 0x00, 0xc7, 0x00,
+  0xd5, 0x00, 0xe0, 0x00, 0xf1, 0x00, 0x06, 0x01, 0x1d, 0x01, 0x2b, 0x01,
+  0x39, 0x01, 0x49, 0x01, 0x54, 0x01, 0x62, 0x01, 0x6c, 0x01, 0x78, 0x01,
+  0x00, 0x00, 0x24, 0x00, 0x44, 0x00, 0x56, 0x00, 0x6e, 0x00, 0x8b, 0x00,
+  0x9b, 0x00, 0xa9, 0x00, 0xb7, 0x00, 0xc5, 0x00, 0xd3, 0x00, 0xe1, 0x00,
+  0xef, 0x00, 0xfd, 0x00, 0x07, 0x01, 0x18, 0x01, 0x26, 0x01, 0x34, 0x01,
+  0x42, 0x01, 0x50, 0x01, 0x60, 0x01, 0x6e, 0x01, 0x7c, 0x01, 0x8a, 0x01,
+  0x9a, 0x01, 0xa8, 0x01, 0xb6, 0x01, 0xc0, 0x01, 0xce, 0x01, 0xd9, 0x01,
+  0xe3, 0x01, 0x00, 0x00, 0x22, 0x00, 0x55, 0x00, 0x70, 0x00, 0x8f, 0x00,
+  0xa6, 0x00, 0xb6, 0x00, 0xc9, 0x00, 0xd5, 0x00, 0xe3, 0x00, 0xef, 0x00,
+  0x02, 0x01, 0x0e, 0x01, 0x1a, 0x01, 0x26, 0x01, 0x36, 0x01, 0x44, 0x01,
+  0x00, 0x00, 0x22, 0x00, 0x4c, 0x00, 0x7f, 0x00, 0x9a, 0x00, 0xb9, 0x00,
+  0xd4, 0x00, 0xe4, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0x0e, 0x01, 0x19, 0x01,
+  0x2a, 0x01, 0x35, 0x01, 0x42, 0x01, 0x4d, 0x01, 0x59, 0x01, 0x6a, 0x01,
+  0x7a, 0x01, 0x8b, 0x01, 0x96, 0x01, 0xa2, 0x01, 0xb3, 0x01, 0x00, 0x00,
+  0x21, 0x00, 0x48, 0x00, 0x58, 0x00, 0x71, 0x00, 0x8c, 0x00, 0xa5, 0x00,
+  0xb0, 0x00, 0xbe, 0x00, 0xcc, 0x00, 0xd7, 0x00, 0xe4, 0x00, 0xf0, 0x00,
+  0xfe, 0x00, 0x0f, 0x01, 0x22, 0x01, 0x33, 0x01, 0x41, 0x01, 0x4d, 0x01,
+  0x00, 0x00, 0x1c, 0x00, 0x51, 0x00, 0x6e, 0x00, 0x8b, 0x00, 0xa2, 0x00,
+  0xbb, 0x00, 0xc6, 0x00, 0xdd, 0x00, 0xeb, 0x00, 0xf9, 0x00, 0x07, 0x01,
+  0x15, 0x01, 0x22, 0x01, 0x2f, 0x01, 0x43, 0x01, 0x51, 0x01, 0x5f, 0x01,
+  0x6d, 0x01, 0x7d, 0x01, 0x8a, 0x01, 0x97, 0x01, 0xa5, 0x01, 0xb1, 0x01,
+  0xbd, 0x01, 0xc7, 0x01, 0xd4, 0x01, 0xe4, 0x01, 0xf2, 0x01, 0x01, 0x02,
+  0x0b, 0x02, 0x1a, 0x02, 0x24, 0x02, 0x32, 0x02, 0x3e, 0x02, 0x4b, 0x02,
+  0x58, 0x02, 0x65, 0x02, 0x71, 0x02, 0x7d, 0x02, 0x89, 0x02, 0x93, 0x02,
+  0xa0, 0x02, 0xae, 0x02, 0xbc, 0x02, 0xc9, 0x02, 0x00, 0x00, 0x17, 0x00,
+  0x54, 0x00, 0x6f, 0x00, 0x8c, 0x00, 0x9c, 0x00, 0xbe, 0x00, 0xd9, 0x00,
+  0xe4, 0x00, 0xf0, 0x00, 0xff, 0x00, 0x0a, 0x01, 0x19, 0x01, 0x2c, 0x01,
+  0x3b, 0x01, 0x00, 0x00, 0x1f, 0x00, 0x31, 0x00, 0x66, 0x00, 0x7b, 0x00,
+  0x9e, 0x00, 0xb9, 0x00, 0xce, 0x00, 0xd9, 0x00, 0xeb, 0x00, 0xfd, 0x00,
+  0x10, 0x01, 0x22, 0x01, 0x32, 0x01, 0x42, 0x01, 0x4d, 0x01, 0x58, 0x01,
+  0x68, 0x01, 0x78, 0x01, 0x8a, 0x01, 0x99, 0x01, 0xa9, 0x01, 0xbb, 0x01,
+  0xd0, 0x01, 0xe2, 0x01, 0xec, 0x01, 0xfc, 0x01, 0x0e, 0x02, 0x20, 0x02,
+  0x2a, 0x02, 0x3a, 0x02, 0x4a, 0x02, 0x5a, 0x02, 0x6a, 0x02, 0x7b, 0x02,
+  0x86, 0x02, 0x97, 0x02, 0xa6, 0x02, 0xb8, 0x02, 0xc5, 0x02, 0xd6, 0x02,
+  0xe6, 0x02, 0xf6, 0x02, 0x06, 0x03, 0x00, 0x00, 0x19, 0x00, 0x38, 0x00,
+  0x4d, 0x00, 0x70, 0x00, 0x89, 0x00, 0xa4, 0x00, 0xb4, 0x00, 0xc7, 0x00,
+  0xd2, 0x00, 0xe0, 0x00, 0xea, 0x00, 0xfb, 0x00, 0x0a, 0x01, 0x18, 0x01,
+  0x27, 0x01, 0x39, 0x01, 0x45, 0x01, 0x54, 0x01, 0x65, 0x01, 0x6f, 0x01,
+  0x00, 0x00, 0x2a, 0x00, 0x49, 0x00, 0x57, 0x00, 0x7a, 0x00, 0x97, 0x00,
+  0xbf, 0x00, 0xdc, 0x00, 0xf1, 0x00, 0xfc, 0x00, 0x09, 0x01, 0x1e, 0x01,
+  0x28, 0x01, 0x3c, 0x01, 0x54, 0x01, 0x60, 0x01, 0x73, 0x01, 0x7e, 0x01,
+  0x8a, 0x01, 0x97, 0x01, 0xa9, 0x01, 0xbb, 0x01, 0xc9, 0x01, 0xdb, 0x01,
+  0xef, 0x01, 0x01, 0x02, 0x15, 0x02, 0x29, 0x02, 0x37, 0x02, 0x49, 0x02,
+  0x55, 0x02, 0x00, 0x00, 0x24, 0x00, 0x3f, 0x00, 0x62, 0x00, 0x79, 0x00,
+  0x95, 0x00, 0xa7, 0x00, 0xd2, 0x00, 0xdd, 0x00, 0xeb, 0x00, 0xf9, 0x00,
+  0x07, 0x01, 0x17, 0x01, 0x00, 0x00, 0x21, 0x00, 0x44, 0x00, 0x5d, 0x00,
+  0x6f, 0x00, 0x8c, 0x00, 0xa3, 0x00, 0xae, 0x00, 0xbe, 0x00, 0xc8, 0x00,
+  0xdd, 0x00, 0xe8, 0x00, 0xf8, 0x00, 0x0b, 0x01, 0x1b, 0x01, 0x2b, 0x01,
+  0x36, 0x01, 0x4a, 0x01, 0x5b, 0x01, 0x6f, 0x01, 0x80, 0x01, 0x93, 0x01,
+  0x9e, 0x01, 0xa8, 0x01, 0xbd, 0x01, 0xd1, 0x01, 0xe1, 0x01, 0x00, 0x00,
+  0x2a, 0x00, 0x56, 0x00, 0x6c, 0x00, 0x80, 0x00, 0x94, 0x00, 0xa6, 0x00,
+  0xb1, 0x00, 0xbb, 0x00, 0xc5, 0x00, 0xd0, 0x00, 0xdf, 0x00, 0xe9, 0x00,
+  0xf5, 0x00, 0x00, 0x01, 0x11, 0x01, 0x22, 0x01, 0x2c, 0x01, 0x3a, 0x01,
+  0x49, 0x01, 0x55, 0x01, 0x5f, 0x01, 0x00, 0x00, 0x1f, 0x00, 0x45, 0x00,
+  0x73, 0x00, 0x92, 0x00, 0xad, 0x00, 0xcb, 0x00, 0xd6, 0x00, 0xe2, 0x00,
+  0xfa, 0x00, 0x06, 0x01, 0x1d, 0x01, 0x28, 0x01, 0x35, 0x01, 0x40, 0x01,
+  0x55, 0x01, 0x5f, 0x01, 0x69, 0x01, 0x7b, 0x01, 0x87, 0x01, 0x93, 0x01,
+  0x9f, 0x01, 0xa9, 0x01, 0xb4, 0x01, 0xc0, 0x01, 0xcd, 0x01, 0xd6, 0x01,
+  0xe4, 0x01, 0xee, 0x01, 0x01, 0x02, 0x16, 0x02, 0x2c, 0x02, 0x36, 0x02,
+  0x40, 0x02, 0x4a, 0x02, 0x56, 0x02, 0x00, 0x00, 0x1c, 0x00, 0x3a, 0x00,
+  0x5d, 0x00, 0x7a, 0x00, 0xb5, 0x00, 0xd2, 0x00, 0xeb, 0x00, 0xf9, 0x00,
+  0x08, 0x01, 0x15, 0x01, 0x21, 0x01, 0x2f, 0x01, 0x3a, 0x01, 0x46, 0x01,
+  0x52, 0x01, 0x60, 0x01, 0x6c, 0x01, 0x78, 0x01, 0x84, 0x01, 0x90, 0x01,
+  0x9b, 0x01, 0xa7, 0x01, 0xbf, 0x01, 0xcb, 0x01, 0xd6, 0x01, 0xe1, 0x01,
+  0xec, 0x01, 0xf8, 0x01, 0x04, 0x02, 0x0f, 0x02, 0x1a, 0x02, 0x26, 0x02,
+  0x31, 0x02, 0x3d, 0x02, 0x48, 0x02, 0x5b, 0x02, 0x66, 0x02, 0x74, 0x02,
+  0x7f, 0x02, 0x8d, 0x02, 0x99, 0x02, 0xa5, 0x02, 0xae, 0x02, 0xb9, 0x02,
+  0xc5, 0x02, 0xd1, 0x02, 0xdd, 0x02, 0xe8, 0x02, 0xf3, 0x02, 0xfe, 0x02,
+  0x0c, 0x03, 0x18, 0x03, 0x23, 0x03, 0x2f, 0x03, 0x3a, 0x03, 0x48, 0x03,
+  0x56, 0x03, 0x61, 0x03, 0x6d, 0x03, 0x00, 0x00, 0x28, 0x00, 0x45, 0x00,
+  0x68, 0x00, 0x8e, 0x00, 0xad, 0x00, 0xc8, 0x00, 0xe1, 0x00, 0xed, 0x00,
+  0xf9, 0x00, 0x07, 0x01, 0x13, 0x01, 0x21, 0x01, 0x2d, 0x01, 0x3b, 0x01,
+  0x49, 0x01, 0x56, 0x01, 0x65, 0x01, 0x71, 0x01, 0x7d, 0x01, 0x88, 0x01,
+  0x9f, 0x01, 0xae, 0x01, 0xc1, 0x01, 0xd0, 0x01, 0xde, 0x01, 0xe9, 0x01,
+  0xf5, 0x01, 0xff, 0x01, 0x0e, 0x02, 0x1a, 0x02, 0x28, 0x02, 0x34, 0x02,
+  0x40, 0x02, 0x4e, 0x02, 0x5a, 0x02, 0x68, 0x02, 0x00, 0x00, 0x1d, 0x00,
+  0x36, 0x00, 0x56, 0x00, 0x74, 0x00, 0x83, 0x00, 0x91, 0x00, 0x9f, 0x00,
+  0xa9, 0x00, 0xb7, 0x00, 0xc5, 0x00, 0xd3, 0x00, 0xe1, 0x00, 0xeb, 0x00,
+  0xf6, 0x00, 0x04, 0x01, 0x12, 0x01, 0x1d, 0x01, 0x32, 0x01, 0x40, 0x01,
+  0x4e, 0x01, 0x5c, 0x01, 0x67, 0x01, 0x72, 0x01, 0x83, 0x01, 0x91, 0x01,
+  0xa0, 0x01, 0xaf, 0x01, 0xbd, 0x01, 0xcb, 0x01, 0xd9, 0x01, 0xe7, 0x01,
+  0xf5, 0x01, 0x06, 0x02, 0x11, 0x02, 0x1f, 0x02, 0x29, 0x02, 0x3e, 0x02,
+  0x4c, 0x02, 0x5a, 0x02, 0x69, 0x02, 0x77, 0x02, 0x85, 0x02, 0x93, 0x02,
+  0x9d, 0x02, 0xab, 0x02, 0xb9, 0x02, 0xc2, 0x02, 0xce, 0x02, 0xdc, 0x02,
+  0xec, 0x02, 0xf7, 0x02, 0x06, 0x03, 0x14, 0x03, 0x22, 0x03, 0x30, 0x03,
+  0x3c, 0x03, 0x4a, 0x03, 0x58, 0x03, 0x64, 0x03, 0x70, 0x03, 0x7e, 0x03,
+  0x8c, 0x03, 0x9a, 0x03, 0xa6, 0x03, 0xb4, 0x03, 0xc2, 0x03, 0xd3, 0x03,
+  0xe1, 0x03, 0xeb, 0x03, 0xf9, 0x03, 0x08, 0x04, 0x00, 0x00, 0x19, 0x00,
+  0x3e, 0x00, 0x55, 0x00, 0x73, 0x00, 0x8e, 0x00, 0x99, 0x00, 0xa9, 0x00,
+  0xb4, 0x00, 0xbe, 0x00, 0xcc, 0x00, 0xd8, 0x00, 0xe6, 0x00, 0xf2, 0x00,
+  0xfe, 0x00, 0x0a, 0x01, 0x15, 0x01, 0x20, 0x01, 0x2e, 0x01, 0x37, 0x01,
+  0x48, 0x01, 0x54, 0x01, 0x63, 0x01, 0x6e, 0x01, 0x7a, 0x01, 0x85, 0x01,
+  0x91, 0x01, 0x9b, 0x01, 0xa6, 0x01, 0xb9, 0x01, 0xc5, 0x01, 0xcf, 0x01,
+  0xdd, 0x01, 0xe7, 0x01, 0xf2, 0x01, 0xfe, 0x01, 0x0d, 0x02, 0x1a, 0x02,
+  0x24, 0x02, 0x30, 0x02, 0x39, 0x02, 0x43, 0x02, 0x4f, 0x02, 0x5a, 0x02,
+  0x6a, 0x02, 0x78, 0x02, 0x84, 0x02, 0x91, 0x02, 0x00, 0x00, 0x18, 0x00,
+  0x3a, 0x00, 0x53, 0x00, 0x77, 0x00, 0x84, 0x00, 0x98, 0x00, 0xa4, 0x00,
+  0xaf, 0x00, 0xbf, 0x00, 0xce, 0x00, 0xd9, 0x00, 0xe5, 0x00, 0xf5, 0x00,
+  0x03, 0x01, 0x0f, 0x01, 0x1b, 0x01, 0x29, 0x01, 0x34, 0x01, 0x3f, 0x01,
+  0x4b, 0x01, 0x5a, 0x01, 0x66, 0x01, 0x77, 0x01, 0x87, 0x01, 0x99, 0x01,
+  0xab, 0x01, 0xb8, 0x01, 0xc4, 0x01, 0xd1, 0x01, 0xe3, 0x01, 0xef, 0x01,
+  0xfc, 0x01, 0x0d, 0x02, 0x1d, 0x02, 0x26, 0x02, 0x38, 0x02, 0x50, 0x02,
+  0x5e, 0x02, 0x6a, 0x02, 0x77, 0x02, 0x82, 0x02, 0x90, 0x02, 0xa0, 0x02,
+  0xb1, 0x02, 0xc2, 0x02, 0xce, 0x02, 0xdc, 0x02, 0xe9, 0x02, 0xf4, 0x02,
+  0x04, 0x03, 0x11, 0x03, 0x1e, 0x03, 0x2a, 0x03, 0x35, 0x03, 0x46, 0x03,
+  0x57, 0x03, 0x65, 0x03, 0x76, 0x03, 0x83, 0x03, 0x8e, 0x03, 0x9e, 0x03,
+  0x00, 0x00, 0x12, 0x00, 0x2b, 0x00, 0x4f, 0x00, 0x6c, 0x00, 0x94, 0x00,
+  0x9e, 0x00, 0xac, 0x00, 0xba, 0x00, 0xce, 0x00, 0xe1, 0x00, 0xef, 0x00,
+  0xfb, 0x00, 0x0f, 0x01, 0x1c, 0x01, 0x25, 0x01, 0x31, 0x01, 0x40, 0x01,
+  0x4c, 0x01, 0x55, 0x01, 0x67, 0x01, 0x80, 0x01, 0x97, 0x01, 0xa8, 0x01,
+  0xb3, 0x01, 0xc1, 0x01, 0xcd, 0x01, 0xdb, 0x01, 0xe7, 0x01, 0xf3, 0x01,
+  0xff, 0x01, 0x0b, 0x02, 0x23, 0x02, 0x2f, 0x02, 0x3e, 0x02, 0x4c, 0x02,
+  0x5a, 0x02, 0x66, 0x02, 0x78, 0x02, 0x86, 0x02, 0x92, 0x02, 0xaa, 0x02,
+  0xb4, 0x02, 0xc0, 0x02, 0xce, 0x02, 0xda, 0x02, 0xe8, 0x02, 0xf7, 0x02,
+  0x03, 0x03, 0x0f, 0x03, 0x1b, 0x03, 0x27, 0x03, 0x33, 0x03, 0x3f, 0x03,
+  0x00, 0x00, 0x10, 0x00, 0x20, 0x00, 0x39, 0x00, 0x5b, 0x00, 0x81, 0x00,
+  0x90, 0x00, 0x9c, 0x00, 0xa8, 0x00, 0xb4, 0x00, 0xc2, 0x00, 0xd7, 0x00,
+  0xe3, 0x00, 0xf7, 0x00, 0x03, 0x01, 0x13, 0x01, 0x21, 0x01, 0x2f, 0x01,
+  0x42, 0x01, 0x51, 0x01, 0x60, 0x01, 0x6f, 0x01, 0x83, 0x01, 0x93, 0x01,
+  0x9f, 0x01, 0xae, 0x01, 0xba, 0x01, 0xc5, 0x01, 0xd1, 0x01, 0xdd, 0x01,
+  0xeb, 0x01, 0xf7, 0x01, 0x05, 0x02, 0x0e, 0x02, 0x1c, 0x02, 0x2a, 0x02,
+  0x34, 0x02, 0x42, 0x02, 0x4e, 0x02, 0x5c, 0x02, 0x6d, 0x02, 0x7c, 0x02,
+  0x8b, 0x02, 0x97, 0x02, 0xb1, 0x02, 0xc2, 0x02, 0xce, 0x02, 0xdb, 0x02,
+  0xe7, 0x02, 0x00, 0x00, 0x17, 0x00, 0x27, 0x00, 0x40, 0x00, 0x6a, 0x00,
+  0x78, 0x00, 0x88, 0x00, 0x96, 0x00, 0xa4, 0x00, 0xb5, 0x00, 0xc5, 0x00,
+  0xd1, 0x00, 0xe1, 0x00, 0xed, 0x00, 0xfe, 0x00, 0x0b, 0x01, 0x17, 0x01,
+  0x24, 0x01, 0x31, 0x01, 0x42, 0x01, 0x51, 0x01, 0x60, 0x01, 0x6d, 0x01,
+  0x7b, 0x01, 0x8b, 0x01, 0x98, 0x01, 0xa4, 0x01, 0xb0, 0x01, 0x00, 0x00,
+  0x1b, 0x00, 0x46, 0x00, 0x5d, 0x00, 0x73, 0x00, 0x90, 0x00, 0x9e, 0x00,
+  0xac, 0x00, 0xbe, 0x00, 0xca, 0x00, 0xd6, 0x00, 0xe2, 0x00, 0xee, 0x00,
+  0xfc, 0x00, 0x0a, 0x01, 0x16, 0x01, 0x1f, 0x01, 0x2d, 0x01, 0x3d, 0x01,
+  0x49, 0x01, 0x55, 0x01, 0x5e, 0x01, 0x6a, 0x01, 0x73, 0x01, 0x7f, 0x01,
+  0x8c, 0x01, 0x9e, 0x01, 0xa7, 0x01, 0xb3, 0x01, 0xc7, 0x01, 0xd3, 0x01,
+  0xe2, 0x01, 0xf5, 0x01, 0x01, 0x02, 0x0d, 0x02, 0x19, 0x02, 0x26, 0x02,
+  0x38, 0x02, 0x49, 0x02, 0x55, 0x02, 0x61, 0x02, 0x6f, 0x02, 0x7b, 0x02,
+  0x8b, 0x02, 0x98, 0x02, 0xa6, 0x02, 0xb2, 0x02, 0xbe, 0x02, 0xd0, 0x02,
+  0xdc, 0x02, 0xea, 0x02, 0xf8, 0x02, 0x09, 0x03, 0x15, 0x03, 0x26, 0x03,
+  0x37, 0x03, 0x40, 0x03, 0x4e, 0x03, 0x5f, 0x03, 0x00, 0x00, 0x1e, 0x00,
+  0x37, 0x00, 0x50, 0x00, 0x67, 0x00, 0x84, 0x00, 0x94, 0x00, 0xa4, 0x00,
+  0xb3, 0x00, 0xc3, 0x00, 0xd3, 0x00, 0xe3, 0x00, 0xf1, 0x00, 0xff, 0x00,
+  0x10, 0x01, 0x21, 0x01, 0x2b, 0x01, 0x37, 0x01, 0x40, 0x01, 0x4a, 0x01,
+  0x54, 0x01, 0x5e, 0x01, 0x72, 0x01, 0x82, 0x01, 0x92, 0x01, 0xa1, 0x01,
+  0xb3, 0x01, 0xbf, 0x01, 0xcd, 0x01, 0xe0, 0x01, 0x00, 0x00, 0x12, 0x00,
+  0x3a, 0x00, 0x53, 0x00, 0x61, 0x00, 0x71, 0x00, 0x95, 0x00, 0xac, 0x00,
+  0xba, 0x00, 0xce, 0x00, 0xdc, 0x00, 0xe8, 0x00, 0xf3, 0x00, 0x01, 0x01,
+  0x0f, 0x01, 0x1a, 0x01, 0x2e, 0x01, 0x3c, 0x01, 0x4b, 0x01, 0x59, 0x01,
+  0x65, 0x01, 0x75, 0x01, 0x83, 0x01, 0x94, 0x01, 0x9e, 0x01, 0xac, 0x01,
+  0xb8, 0x01, 0xc2, 0x01, 0xd0, 0x01, 0xda, 0x01, 0xe8, 0x01, 0xf7, 0x01,
+  0x08, 0x02, 0x14, 0x02, 0x22, 0x02, 0x30, 0x02, 0x3b, 0x02, 0x00, 0x00,
+  0x2c, 0x00, 0x5f, 0x00, 0x76, 0x00, 0x86, 0x00, 0x95, 0x00, 0xa8, 0x00,
+  0xb5, 0x00, 0xc3, 0x00, 0xd6, 0x00, 0xe8, 0x00, 0xfa, 0x00, 0x06, 0x01,
+  0x14, 0x01, 0x27, 0x01, 0x33, 0x01, 0x3d, 0x01, 0x4d, 0x01, 0x5a, 0x01,
+  0x6d, 0x01, 0x77, 0x01, 0x8a, 0x01, 0x96, 0x01, 0xa2, 0x01, 0xb5, 0x01,
+  0xc2, 0x01, 0xd0, 0x01, 0xde, 0x01, 0xe8, 0x01, 0xfa, 0x01, 0x04, 0x02,
+  0x00, 0x00, 0x1d, 0x00, 0x34, 0x00, 0x44, 0x00, 0x65, 0x00, 0xa4, 0x00,
+  0xb5, 0x00, 0xc3, 0x00, 0xcf, 0x00, 0xdb, 0x00, 0xf1, 0x00, 0xff, 0x00,
+  0x0b, 0x01, 0x21, 0x01, 0x2d, 0x01, 0x39, 0x01, 0x4d, 0x01, 0x59, 0x01,
+  0x67, 0x01, 0x73, 0x01, 0x7f, 0x01, 0x8b, 0x01, 0x99, 0x01, 0xa5, 0x01,
+  0xb3, 0x01, 0xc4, 0x01, 0xd0, 0x01, 0xe0, 0x01, 0xec, 0x01, 0xf8, 0x01,
+  0x06, 0x02, 0x15, 0x02, 0x26, 0x02, 0x32, 0x02, 0x41, 0x02, 0x52, 0x02,
+  0x5f, 0x02, 0x6d, 0x02, 0x00, 0x00, 0x1c, 0x00, 0x45, 0x00, 0x5e, 0x00,
+  0x73, 0x00, 0x8e, 0x00, 0xa0, 0x00, 0xb0, 0x00, 0xbc, 0x00, 0xc7, 0x00,
+  0xd9, 0x00, 0xe9, 0x00, 0xfa, 0x00, 0x06, 0x01, 0x1a, 0x01, 0x2e, 0x01,
+  0x39, 0x01, 0x4e, 0x01, 0x58, 0x01, 0x68, 0x01, 0x73, 0x01, 0x7d, 0x01,
+  0x87, 0x01, 0x00, 0x00, 0x2f, 0x00, 0x43, 0x00, 0x60, 0x00, 0x71, 0x00,
+  0x7e, 0x00, 0x98, 0x00, 0xa3, 0x00, 0xaf, 0x00, 0xba, 0x00, 0xc5, 0x00,
+  0xd3, 0x00, 0xe1, 0x00, 0xf4, 0x00, 0x02, 0x01, 0x0c, 0x01, 0x1a, 0x01,
+  0x28, 0x01, 0x36, 0x01, 0x40, 0x01, 0x4c, 0x01, 0x5a, 0x01, 0x66, 0x01,
+  0x71, 0x01, 0x7d, 0x01, 0x89, 0x01, 0x94, 0x01, 0xa2, 0x01, 0xad, 0x01,
+  0xc1, 0x01, 0xcf, 0x01, 0xdd, 0x01, 0xee, 0x01, 0x01, 0x02, 0x0c, 0x02,
+  0x1a, 0x02, 0x28, 0x02, 0x32, 0x02, 0x3e, 0x02, 0x50, 0x02, 0x5b, 0x02,
+  0x00, 0x00, 0x30, 0x00, 0x49, 0x00, 0x66, 0x00, 0x7b, 0x00, 0x87, 0x00,
+  0xa0, 0x00, 0xaf, 0x00, 0xc1, 0x00, 0xd0, 0x00, 0xdd, 0x00, 0xef, 0x00,
+  0x01, 0x01, 0x11, 0x01, 0x27, 0x01, 0x37, 0x01, 0x49, 0x01, 0x5a, 0x01,
+  0x68, 0x01, 0x76, 0x01, 0x00, 0x00, 0x12, 0x00, 0x50, 0x00, 0x69, 0x00,
+  0x7f, 0x00, 0x9f, 0x00, 0xba, 0x00, 0xc5, 0x00, 0xd2, 0x00, 0xdd, 0x00,
+  0xe9, 0x00, 0xf4, 0x00, 0x02, 0x01, 0x0d, 0x01, 0x18, 0x01, 0x28, 0x01,
+  0x35, 0x01, 0x40, 0x01, 0x4b, 0x01, 0x59, 0x01, 0x64, 0x01, 0x74, 0x01,
+  0x82, 0x01, 0x91, 0x01, 0x9e, 0x01, 0xac, 0x01, 0xc0, 0x01, 0xcb, 0x01,
+  0xd7, 0x01, 0xe7, 0x01, 0xf2, 0x01, 0x00, 0x02, 0x0c, 0x02, 0x1c, 0x02,
+  0x2d, 0x02, 0x38, 0x02, 0x44, 0x02, 0x52, 0x02, 0x61, 0x02, 0x6c, 0x02,
+  0x80, 0x02, 0x00, 0x00, 0x25, 0x00, 0x3e, 0x00, 0x62, 0x00, 0x7c, 0x00,
+  0x95, 0x00, 0xa0, 0x00, 0xab, 0x00, 0xb6, 0x00, 0xc4, 0x00, 0xd7, 0x00,
+  0xe2, 0x00, 0xee, 0x00, 0x01, 0x01, 0x0f, 0x01, 0x1b, 0x01, 0x29, 0x01,
+  0x35, 0x01, 0x41, 0x01, 0x52, 0x01, 0x5e, 0x01, 0x6a, 0x01, 0x76, 0x01,
+  0x82, 0x01, 0x93, 0x01, 0x9f, 0x01, 0x00, 0x00, 0x1b, 0x00, 0x30, 0x00,
+  0x47, 0x00, 0x57, 0x00, 0x73, 0x00, 0x81, 0x00, 0x90, 0x00, 0x9e, 0x00,
+  0xac, 0x00, 0xba, 0x00, 0xc8, 0x00, 0xd7, 0x00, 0xe5, 0x00, 0xf3, 0x00,
+  0x01, 0x01, 0x10, 0x01, 0x1e, 0x01, 0x2c, 0x01, 0x38, 0x01, 0x47, 0x01,
+  0x51, 0x01, 0x5f, 0x01, 0x6d, 0x01, 0x79, 0x01, 0x87, 0x01, 0x95, 0x01,
+  0xa3, 0x01, 0xb1, 0x01, 0xbf, 0x01, 0xce, 0x01, 0xdc, 0x01, 0xe8, 0x01,
+  0xf7, 0x01, 0x06, 0x02, 0x14, 0x02, 0x22, 0x02, 0x2d, 0x02, 0x3b, 0x02,
+  0x47, 0x02, 0x52, 0x02, 0x60, 0x02, 0x77, 0x02, 0x8a, 0x02, 0x98, 0x02,
+  0xa6, 0x02, 0xb2, 0x02, 0xc0, 0x02, 0xce, 0x02, 0xdc, 0x02, 0xea, 0x02,
+  0xf5, 0x02, 0x03, 0x03, 0x11, 0x03, 0x1f, 0x03, 0x2d, 0x03, 0x37, 0x03,
+  0x41, 0x03, 0x51, 0x03, 0x63, 0x03, 0x71, 0x03, 0x7f, 0x03, 0x8d, 0x03,
+  0x98, 0x03, 0x00, 0x00, 0x1d, 0x00, 0x34, 0x00, 0x53, 0x00, 0x6a, 0x00,
+  0x7b, 0x00, 0x98, 0x00, 0xa4, 0x00, 0xb5, 0x00, 0xca, 0x00, 0xdb, 0x00,
+  0xeb, 0x00, 0xf8, 0x00, 0x04, 0x01, 0x19, 0x01, 0x2d, 0x01, 0x00, 0x00,
+  0x17, 0x00, 0x34, 0x00, 0x58, 0x00, 0x68, 0x00, 0x84, 0x00, 0x94, 0x00,
+  0xa4, 0x00, 0xb3, 0x00, 0xc4, 0x00, 0xd5, 0x00, 0xe7, 0x00, 0xf3, 0x00,
+  0x03, 0x01, 0x13, 0x01, 0x1e, 0x01, 0x30, 0x01, 0x3e, 0x01, 0x51, 0x01,
+  0x61, 0x01, 0x6c, 0x01, 0x7e, 0x01, 0x8f, 0x01, 0x9a, 0x01, 0xab, 0x01,
+  0xbc, 0x01, 0xc8, 0x01, 0x00, 0x00, 0x2a, 0x00, 0x47, 0x00, 0x5e, 0x00,
+  0x7a, 0x00, 0x84, 0x00, 0x90, 0x00, 0xa2, 0x00, 0xb2, 0x00, 0xbd, 0x00,
+  0xd5, 0x00, 0xe0, 0x00, 0xf3, 0x00, 0x00, 0x00, 0x12, 0x00, 0x2b, 0x00,
+  0x3d, 0x00, 0x48, 0x00, 0x53, 0x00, 0x61, 0x00, 0x6f, 0x00, 0x83, 0x00,
+  0x91, 0x00, 0xa0, 0x00, 0xb4, 0x00, 0xc2, 0x00, 0xd1, 0x00, 0xe0, 0x00,
+  0xf1, 0x00, 0x08, 0x01, 0x17, 0x01, 0x25, 0x01, 0x2f, 0x01, 0x3f, 0x01,
+  0x53, 0x01, 0x62, 0x01, 0x70, 0x01, 0x84, 0x01, 0x96, 0x01, 0xaa, 0x01,
+  0xbe, 0x01, 0xcd, 0x01, 0xdb, 0x01, 0xea, 0x01, 0x00, 0x00, 0x1d, 0x00,
+  0x49, 0x00, 0x6a, 0x00, 0x76, 0x00, 0x85, 0x00, 0x91, 0x00, 0x9d, 0x00,
+  0xaa, 0x00, 0xb7, 0x00, 0xc4, 0x00, 0xd1, 0x00, 0xdd, 0x00, 0xe9, 0x00,
+  0xf6, 0x00, 0x02, 0x01, 0x0f, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x39, 0x01,
+  0x47, 0x01, 0x54, 0x01, 0x60, 0x01, 0x6c, 0x01, 0x78, 0x01, 0x85, 0x01,
+  0x00, 0x00, 0x39, 0x00, 0x4b, 0x00, 0x69, 0x00, 0x88, 0x00, 0x95, 0x00,
+  0xa9, 0x00, 0xb5, 0x00, 0xc7, 0x00, 0xd3, 0x00, 0xdf, 0x00, 0xf1, 0x00,
+  0xfd, 0x00, 0x0f, 0x01, 0x20, 0x01, 0x2c, 0x01, 0x38, 0x01, 0x4b, 0x01,
+  0x57, 0x01, 0x64, 0x01, 0x71, 0x01, 0x7d, 0x01, 0x89, 0x01, 0x99, 0x01,
+  0xab, 0x01, 0xbd, 0x01, 0xd2, 0x01, 0xe9, 0x01, 0xfa, 0x01, 0x06, 0x02,
+  0x12, 0x02, 0x1f, 0x02, 0x2b, 0x02, 0x00, 0x00, 0x37, 0x00, 0x5f, 0x00,
+  0x8c, 0x00, 0xa5, 0x00, 0xbf, 0x00, 0xcc, 0x00, 0xd7, 0x00, 0xe8, 0x00,
+  0xf8, 0x00, 0x08, 0x01, 0x18, 0x01, 0x28, 0x01, 0x38, 0x01, 0x48, 0x01,
+  0x58, 0x01, 0x68, 0x01, 0x76, 0x01, 0x85, 0x01, 0x95, 0x01, 0xb1, 0x01,
+  0xc1, 0x01, 0xcb, 0x01, 0xdb, 0x01, 0xeb, 0x01, 0xfa, 0x01, 0x0a, 0x02,
+  0x1a, 0x02, 0x2a, 0x02, 0x3a, 0x02, 0x4a, 0x02, 0x59, 0x02, 0x68, 0x02,
+  0x00, 0x00, 0x1b, 0x00, 0x42, 0x00, 0x79, 0x00, 0x9d, 0x00, 0xa9, 0x00,
+  0xbd, 0x00, 0xcb, 0x00, 0xdf, 0x00, 0xee, 0x00, 0x02, 0x01, 0x0c, 0x01,
+  0x24, 0x01, 0x33, 0x01, 0x47, 0x01, 0x51, 0x01, 0x60, 0x01, 0x74, 0x01,
+  0x83, 0x01, 0x8f, 0x01, 0x9e, 0x01, 0x00, 0x00, 0x1d, 0x00, 0x2d, 0x00,
+  0x62, 0x00, 0x86, 0x00, 0x91, 0x00, 0xa3, 0x00, 0xb5, 0x00, 0xcc, 0x00,
+  0xde, 0x00, 0xf1, 0x00, 0xff, 0x00, 0x11, 0x01, 0x2b, 0x01, 0x3e, 0x01,
+  0x50, 0x01, 0x6b, 0x01, 0x79, 0x01, 0x8b, 0x01, 0x97, 0x01, 0xa9, 0x01,
+  0xbb, 0x01, 0xc6, 0x01, 0x00, 0x00, 0x1b, 0x00, 0x34, 0x00, 0x69, 0x00,
+  0x8f, 0x00, 0x9b, 0x00, 0xa7, 0x00, 0xb7, 0x00, 0xc4, 0x00, 0xd0, 0x00,
+  0xe6, 0x00, 0xf3, 0x00, 0x07, 0x01, 0x13, 0x01, 0x23, 0x01, 0x39, 0x01,
+  0x50, 0x01, 0x61, 0x01, 0x70, 0x01, 0x7c, 0x01, 0x8b, 0x01, 0x99, 0x01,
+  0xae, 0x01, 0xba, 0x01, 0x00, 0x00, 0x17, 0x00, 0x32, 0x00, 0x49, 0x00,
+  0x69, 0x00, 0x7b, 0x00, 0xa5, 0x00, 0xb0, 0x00, 0xc4, 0x00, 0xd8, 0x00,
+  0xe8, 0x00, 0xfd, 0x00, 0x0d, 0x01, 0x16, 0x01, 0x21, 0x01, 0x30, 0x01,
+  0x45, 0x01, 0x57, 0x01, 0x6a, 0x01, 0x7e, 0x01, 0x8e, 0x01, 0x9a, 0x01,
+  0xa5, 0x01, 0xb5, 0x01, 0xc0, 0x01, 0xd0, 0x01, 0xdb, 0x01, 0xe6, 0x01,
+  0xf1, 0x01, 0x01, 0x02, 0x00, 0x00, 0x1d, 0x00, 0x32, 0x00, 0x3d, 0x00,
+  0x49, 0x00, 0x55, 0x00, 0x61, 0x00, 0x74, 0x00, 0x80, 0x00, 0x96, 0x00,
+  0xa9, 0x00, 0xb4, 0x00, 0xc0, 0x00, 0xcc, 0x00, 0xd8, 0x00, 0xe4, 0x00,
+  0xf0, 0x00, 0x01, 0x01, 0x0c, 0x01, 0x18, 0x01, 0x23, 0x01, 0x2f, 0x01,
+  0x40, 0x01, 0x4e, 0x01, 0x5a, 0x01, 0x66, 0x01, 0x72, 0x01, 0x7e, 0x01,
+  0x8d, 0x01, 0x99, 0x01, 0x00, 0x00, 0x1f, 0x00, 0x36, 0x00, 0x44, 0x00,
+  0x50, 0x00, 0x5d, 0x00, 0x72, 0x00, 0x85, 0x00, 0x91, 0x00, 0x9d, 0x00,
+  0xa9, 0x00, 0xb4, 0x00, 0xc1, 0x00, 0xd1, 0x00, 0xdd, 0x00, 0xe9, 0x00,
+  0xf5, 0x00, 0x0a, 0x01, 0x1c, 0x01, 0x31, 0x01, 0x3c, 0x01, 0x48, 0x01,
+  0x55, 0x01, 0x6a, 0x01, 0x7d, 0x01, 0x89, 0x01, 0x00, 0x00, 0x22, 0x00,
+  0x62, 0x00, 0x79, 0x00, 0x85, 0x00, 0x91, 0x00, 0x9c, 0x00, 0xa7, 0x00,
+  0xb5, 0x00, 0xc0, 0x00, 0xcc, 0x00, 0xd8, 0x00, 0xe3, 0x00, 0xf1, 0x00,
+  0xfc, 0x00, 0x08, 0x01, 0x14, 0x01, 0x20, 0x01, 0x2c, 0x01, 0x38, 0x01,
+  0x44, 0x01, 0x4f, 0x01, 0x5a, 0x01, 0x65, 0x01, 0x71, 0x01, 0x80, 0x01,
+  0x8b, 0x01, 0x97, 0x01, 0xa3, 0x01, 0xaf, 0x01, 0xbb, 0x01, 0xcf, 0x01,
+  0xda, 0x01, 0xe5, 0x01, 0x00, 0x00, 0x15, 0x00, 0x4d, 0x00, 0x64, 0x00,
+  0x73, 0x00, 0x81, 0x00, 0x8d, 0x00, 0x9c, 0x00, 0xa7, 0x00, 0xb6, 0x00,
+  0xc2, 0x00, 0xce, 0x00, 0xdc, 0x00, 0xf4, 0x00, 0x01, 0x01, 0x14, 0x01,
+  0x23, 0x01, 0x2f, 0x01, 0x43, 0x01, 0x4f, 0x01, 0x5b, 0x01, 0x67, 0x01,
+  0x75, 0x01, 0x81, 0x01, 0x90, 0x01, 0x9e, 0x01, 0xaa, 0x01, 0xb6, 0x01,
+  0x00, 0x00, 0x1f, 0x00, 0x47, 0x00, 0x60, 0x00, 0x6c, 0x00, 0x7a, 0x00,
+  0x88, 0x00, 0x97, 0x00, 0xa5, 0x00, 0xb3, 0x00, 0xbe, 0x00, 0xc9, 0x00,
+  0xd7, 0x00, 0xe5, 0x00, 0xf0, 0x00, 0xfe, 0x00, 0x0d, 0x01, 0x1b, 0x01,
+  0x29, 0x01, 0x38, 0x01, 0x47, 0x01, 0x55, 0x01, 0x64, 0x01, 0x73, 0x01,
+  0x82, 0x01, 0x94, 0x01, 0xa6, 0x01, 0xb2, 0x01, 0xbb, 0x01, 0xc9, 0x01,
+  0xd7, 0x01, 0xe3, 0x01, 0xee, 0x01, 0xfc, 0x01, 0x0a, 0x02, 0x18, 0x02,
+  0x26, 0x02, 0x35, 0x02, 0x43, 0x02, 0x51, 0x02, 0x5f, 0x02, 0x6d, 0x02,
+  0x79, 0x02, 0x00, 0x00, 0x12, 0x00, 0x2b, 0x00, 0x3a, 0x00, 0x46, 0x00,
+  0x54, 0x00, 0x5e, 0x00, 0x6e, 0x00, 0x7e, 0x00, 0x8a, 0x00, 0x9f, 0x00,
+  0xab, 0x00, 0xb9, 0x00, 0xc5, 0x00, 0xd3, 0x00, 0xdf, 0x00, 0xe8, 0x00,
+  0xf5, 0x00, 0x01, 0x01, 0x0c, 0x01, 0x1a, 0x01, 0x28, 0x01, 0x3f, 0x01,
+  0x4b, 0x01, 0x58, 0x01, 0x65, 0x01, 0x71, 0x01, 0x7d, 0x01, 0x00, 0x00,
+  0x1d, 0x00, 0x41, 0x00, 0x64, 0x00, 0x6e, 0x00, 0x7e, 0x00, 0x8e, 0x00,
+  0x9a, 0x00, 0xa5, 0x00, 0xb6, 0x00, 0xc1, 0x00, 0xcd, 0x00, 0xdb, 0x00,
+  0xe6, 0x00, 0xf2, 0x00, 0xfe, 0x00, 0x0f, 0x01, 0x1b, 0x01, 0x27, 0x01,
+  0x32, 0x01, 0x43, 0x01, 0x55, 0x01, 0x5e, 0x01, 0x6c, 0x01, 0x78, 0x01,
+  0x86, 0x01, 0x92, 0x01, 0xa4, 0x01, 0xb0, 0x01, 0xbc, 0x01, 0xcd, 0x01,
+  0xde, 0x01, 0xec, 0x01, 0xfa, 0x01, 0x08, 0x02, 0x14, 0x02, 0x26, 0x02,
+  0x2f, 0x02, 0x3b, 0x02, 0x47, 0x02, 0x5e, 0x02, 0x6a, 0x02, 0x76, 0x02,
+  0x84, 0x02, 0x90, 0x02, 0xa1, 0x02, 0xb2, 0x02, 0xbe, 0x02, 0x00, 0x00,
+  0x19, 0x00, 0x4e, 0x00, 0x61, 0x00, 0x70, 0x00, 0x7c, 0x00, 0x89, 0x00,
+  0x98, 0x00, 0xa4, 0x00, 0xb3, 0x00, 0xbc, 0x00, 0xcb, 0x00, 0xd7, 0x00,
+  0xe7, 0x00, 0xf3, 0x00, 0x02, 0x01, 0x0e, 0x01, 0x1c, 0x01, 0x2a, 0x01,
+  0x36, 0x01, 0x42, 0x01, 0x4e, 0x01, 0x5a, 0x01, 0x66, 0x01, 0x74, 0x01,
+  0x80, 0x01, 0x8c, 0x01, 0x9a, 0x01, 0xa8, 0x01, 0xb4, 0x01, 0xc0, 0x01,
+  0xcd, 0x01, 0xe1, 0x01, 0xef, 0x01, 0xfa, 0x01, 0x08, 0x02, 0x16, 0x02,
+  0x20, 0x02, 0x2c, 0x02, 0x3a, 0x02, 0x48, 0x02, 0x54, 0x02, 0x61, 0x02,
+  0x6d, 0x02, 0x00, 0x00, 0x1d, 0x00, 0x38, 0x00, 0x49, 0x00, 0x56, 0x00,
+  0x64, 0x00, 0x74, 0x00, 0x82, 0x00, 0x90, 0x00, 0x9c, 0x00, 0xac, 0x00,
+  0xbb, 0x00, 0xc9, 0x00, 0xd7, 0x00, 0xe5, 0x00, 0xf4, 0x00, 0xff, 0x00,
+  0x0b, 0x01, 0x19, 0x01, 0x22, 0x01, 0x2d, 0x01, 0x3b, 0x01, 0x45, 0x01,
+  0x56, 0x01, 0x65, 0x01, 0x74, 0x01, 0x7f, 0x01, 0x90, 0x01, 0x9c, 0x01,
+  0xa7, 0x01, 0xb5, 0x01, 0xc4, 0x01, 0xd6, 0x01, 0xe2, 0x01, 0xed, 0x01,
+  0xf9, 0x01, 0x05, 0x02, 0x16, 0x02, 0x22, 0x02, 0x30, 0x02, 0x39, 0x02,
+  0x45, 0x02, 0x51, 0x02, 0x60, 0x02, 0x6e, 0x02, 0x7d, 0x02, 0x8b, 0x02,
+  0x9d, 0x02, 0xa7, 0x02, 0xb3, 0x02, 0xbd, 0x02, 0xcb, 0x02, 0xd5, 0x02,
+  0xe3, 0x02, 0xf1, 0x02, 0xff, 0x02, 0x00, 0x00, 0x26, 0x00, 0x42, 0x00,
+  0x51, 0x00, 0x5f, 0x00, 0x6d, 0x00, 0x81, 0x00, 0x8b, 0x00, 0x98, 0x00,
+  0xab, 0x00, 0xb4, 0x00, 0xc2, 0x00, 0xd2, 0x00, 0xe0, 0x00, 0xf1, 0x00,
+  0xff, 0x00, 0x14, 0x01, 0x22, 0x01, 0x2f, 0x01, 0x3e, 0x01, 0x4b, 0x01,
+  0x56, 0x01, 0x65, 0x01, 0x6e, 0x01, 0x81, 0x01, 0x8e, 0x01, 0x98, 0x01,
+  0xa9, 0x01, 0xbf, 0x01, 0xcd, 0x01, 0xdb, 0x01, 0xea, 0x01, 0xf4, 0x01,
+  0x05, 0x02, 0x11, 0x02, 0x1e, 0x02, 0x32, 0x02, 0x3c, 0x02, 0x4d, 0x02,
+  0x5b, 0x02, 0x68, 0x02, 0x76, 0x02, 0x84, 0x02, 0x90, 0x02, 0x9a, 0x02,
+  0xa8, 0x02, 0x00, 0x00, 0x26, 0x00, 0x3d, 0x00, 0x4b, 0x00, 0x5b, 0x00,
+  0x67, 0x00, 0x78, 0x00, 0x84, 0x00, 0x90, 0x00, 0x9c, 0x00, 0xa8, 0x00,
+  0xb6, 0x00, 0xc2, 0x00, 0xd2, 0x00, 0xe0, 0x00, 0xec, 0x00, 0xf8, 0x00,
+  0x04, 0x01, 0x12, 0x01, 0x23, 0x01, 0x2f, 0x01, 0x3b, 0x01, 0x4a, 0x01,
+  0x58, 0x01, 0x61, 0x01, 0x6f, 0x01, 0x78, 0x01, 0x84, 0x01, 0x90, 0x01,
+  0x9c, 0x01, 0xab, 0x01, 0xbc, 0x01, 0xc5, 0x01, 0xd3, 0x01, 0xdf, 0x01,
+  0xeb, 0x01, 0xf7, 0x01, 0x08, 0x02, 0x11, 0x02, 0x00, 0x00, 0x1b, 0x00,
+  0x34, 0x00, 0x4e, 0x00, 0x5c, 0x00, 0x68, 0x00, 0x79, 0x00, 0x87, 0x00,
+  0x96, 0x00, 0xa7, 0x00, 0xb7, 0x00, 0xc1, 0x00, 0xcb, 0x00, 0xdb, 0x00,
+  0xea, 0x00, 0xfa, 0x00, 0x04, 0x01, 0x10, 0x01, 0x1a, 0x01, 0x2c, 0x01,
+  0x3b, 0x01, 0x4e, 0x01, 0x5d, 0x01, 0x6c, 0x01, 0x7b, 0x01, 0x8b, 0x01,
+  0x9b, 0x01, 0xae, 0x01, 0xbb, 0x01, 0xc5, 0x01, 0xce, 0x01, 0xd8, 0x01,
+  0xe1, 0x01, 0xf4, 0x01, 0x00, 0x02, 0x10, 0x02, 0x1e, 0x02, 0x28, 0x02,
+  0x32, 0x02, 0x00, 0x00, 0x19, 0x00, 0x29, 0x00, 0x43, 0x00, 0x51, 0x00,
+  0x5b, 0x00, 0x69, 0x00, 0x77, 0x00, 0x86, 0x00, 0x94, 0x00, 0xa2, 0x00,
+  0xae, 0x00, 0xbc, 0x00, 0xca, 0x00, 0xd8, 0x00, 0xe6, 0x00, 0xf5, 0x00,
+  0x00, 0x01, 0x0e, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x39, 0x01, 0x47, 0x01,
+  0x51, 0x01, 0x5f, 0x01, 0x6b, 0x01, 0x76, 0x01, 0x80, 0x01, 0x8f, 0x01,
+  0x9b, 0x01, 0xa5, 0x01, 0xaf, 0x01, 0xbe, 0x01, 0xcd, 0x01, 0xd7, 0x01,
+  0xe3, 0x01, 0xf2, 0x01, 0x00, 0x02, 0x00, 0x00, 0x19, 0x00, 0x41, 0x00,
+  0x5b, 0x00, 0x6e, 0x00, 0x80, 0x00, 0x8c, 0x00, 0x99, 0x00, 0xac, 0x00,
+  0xba, 0x00, 0xcc, 0x00, 0xdd, 0x00, 0xe7, 0x00, 0xf9, 0x00, 0x03, 0x01,
+  0x16, 0x01, 0x28, 0x01, 0x3a, 0x01, 0x4d, 0x01, 0x61, 0x01, 0x6f, 0x01,
+  0x7b, 0x01, 0x8b, 0x01, 0x00, 0x00, 0x0e, 0x00, 0x30, 0x00, 0x4a, 0x00,
+  0x59, 0x00, 0x67, 0x00, 0x75, 0x00, 0x85, 0x00, 0x91, 0x00, 0x9f, 0x00,
+  0xab, 0x00, 0xbb, 0x00, 0xcb, 0x00, 0xd7, 0x00, 0xe8, 0x00, 0xf6, 0x00,
+  0x03, 0x01, 0x11, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x33, 0x01, 0x3f, 0x01,
+  0x4d, 0x01, 0x5e, 0x01, 0x6c, 0x01, 0x78, 0x01, 0x86, 0x01, 0x94, 0x01,
+  0xa2, 0x01, 0xae, 0x01, 0x00, 0x00, 0x18, 0x00, 0x30, 0x00, 0x48, 0x00,
+  0x60, 0x00, 0x78, 0x00, 0x90, 0x00, 0xa8, 0x00, 0xc0, 0x00, 0xd8, 0x00,
+  0xf7, 0x00, 0x16, 0x01, 0x30, 0x01, 0x3c, 0x01, 0x50, 0x01, 0x5c, 0x01,
+  0x6f, 0x01, 0x7b, 0x01, 0x8b, 0x01, 0x9c, 0x01, 0xaf, 0x01, 0xbb, 0x01,
+  0xcb, 0x01, 0xe2, 0x01, 0xf2, 0x01, 0xfc, 0x01, 0x0f, 0x02, 0x00, 0x00,
+  0x22, 0x00, 0x46, 0x00, 0x53, 0x00, 0x62, 0x00, 0x71, 0x00, 0x7f, 0x00,
+  0x90, 0x00, 0x9c, 0x00, 0xaa, 0x00, 0xb8, 0x00, 0xc5, 0x00, 0xd3, 0x00,
+  0x00, 0x00, 0x22, 0x00, 0x42, 0x00, 0x4e, 0x00, 0x62, 0x00, 0x77, 0x00,
+  0x83, 0x00, 0x91, 0x00, 0xa0, 0x00, 0xae, 0x00, 0xbc, 0x00, 0xd2, 0x00,
+  0xe1, 0x00, 0xef, 0x00, 0xfb, 0x00, 0x07, 0x01, 0x15, 0x01, 0x23, 0x01,
+  0x00, 0x00, 0x1b, 0x00, 0x42, 0x00, 0x73, 0x00, 0x7f, 0x00, 0x8a, 0x00,
+  0x95, 0x00, 0xa0, 0x00, 0xab, 0x00, 0xb7, 0x00, 0xc3, 0x00, 0xce, 0x00,
+  0xd9, 0x00, 0xe9, 0x00, 0xf7, 0x00, 0x02, 0x01, 0x13, 0x01, 0x1e, 0x01,
+  0x29, 0x01, 0x35, 0x01, 0x43, 0x01, 0x4e, 0x01, 0x62, 0x01, 0x6e, 0x01,
+  0x00, 0x00, 0x17, 0x00, 0x27, 0x00, 0x40, 0x00, 0x5b, 0x00, 0x71, 0x00,
+  0x7f, 0x00, 0x8d, 0x00, 0xa3, 0x00, 0xb0, 0x00, 0xbd, 0x00, 0xd4, 0x00,
+  0xde, 0x00, 0xec, 0x00, 0xfa, 0x00, 0x05, 0x01, 0x15, 0x01, 0x20, 0x01,
+  0x2c, 0x01, 0x3a, 0x01, 0x46, 0x01, 0x54, 0x01, 0x00, 0x00, 0x2c, 0x00,
+  0x3a, 0x00, 0x48, 0x00, 0x56, 0x00, 0x64, 0x00, 0x78, 0x00, 0x86, 0x00,
+  0x97, 0x00, 0xa5, 0x00, 0xb3, 0x00, 0xc1, 0x00, 0xd0, 0x00, 0xda, 0x00,
+  0xe8, 0x00, 0xf7, 0x00, 0x04, 0x01, 0x13, 0x01, 0x21, 0x01, 0x32, 0x01,
+  0x3e, 0x01, 0x4d, 0x01, 0x5a, 0x01, 0x68, 0x01, 0x76, 0x01, 0x85, 0x01,
+  0x93, 0x01, 0xa2, 0x01, 0xb1, 0x01, 0xc2, 0x01, 0xcd, 0x01, 0xdb, 0x01,
+  0xe9, 0x01, 0xf7, 0x01, 0x05, 0x02, 0x15, 0x02, 0x22, 0x02, 0x2e, 0x02,
+  0x3c, 0x02, 0x4b, 0x02, 0x5a, 0x02, 0x68, 0x02, 0x76, 0x02, 0x89, 0x02,
+  0x9a, 0x02, 0xa8, 0x02, 0x00, 0x00, 0x12, 0x00, 0x1e, 0x00, 0x2c, 0x00,
+  0x38, 0x00, 0x53, 0x00, 0x68, 0x00, 0x72, 0x00, 0x00, 0x00, 0x17, 0x00,
+  0x32, 0x00, 0x5f, 0x00, 0x6b, 0x00, 0x7e, 0x00, 0x8a, 0x00, 0x9a, 0x00,
+  0xa9, 0x00, 0xb7, 0x00, 0xc8, 0x00, 0xd6, 0x00, 0xe1, 0x00, 0xec, 0x00,
+  0xfc, 0x00, 0x08, 0x01, 0x1a, 0x01, 0x28, 0x01, 0x34, 0x01, 0x40, 0x01,
+  0x50, 0x01, 0x5d, 0x01, 0x6d, 0x01, 0x7d, 0x01, 0x89, 0x01, 0x94, 0x01,
+  0x00, 0x00, 0x17, 0x00, 0x3d, 0x00, 0x4b, 0x00, 0x57, 0x00, 0x61, 0x00,
+  0x6c, 0x00, 0x79, 0x00, 0x96, 0x00, 0xa1, 0x00, 0xaf, 0x00, 0xbb, 0x00,
+  0xcf, 0x00, 0xdb, 0x00, 0x00, 0x00, 0x26, 0x00, 0x34, 0x00, 0x40, 0x00,
+  0x4f, 0x00, 0x61, 0x00, 0x70, 0x00, 0x7e, 0x00, 0x8c, 0x00, 0x9a, 0x00,
+  0xa8, 0x00, 0xb7, 0x00, 0xc2, 0x00, 0xd6, 0x00, 0xe2, 0x00, 0xf0, 0x00,
+  0xfc, 0x00, 0x0a, 0x01, 0x18, 0x01, 0x23, 0x01, 0x2e, 0x01, 0x00, 0x00,
+  0x1a, 0x00, 0x28, 0x00, 0x36, 0x00, 0x47, 0x00, 0x62, 0x00, 0x70, 0x00,
+  0x7e, 0x00, 0x98, 0x00, 0xa6, 0x00, 0xb0, 0x00, 0xc0, 0x00, 0xce, 0x00,
+  0xdb, 0x00, 0xe7, 0x00, 0xf5, 0x00, 0x00, 0x00, 0x34, 0x00, 0x44, 0x00,
+  0x50, 0x00, 0x65, 0x00, 0x76, 0x00, 0x88, 0x00, 0x9d, 0x00, 0xa9, 0x00,
+  0xb6, 0x00, 0xca, 0x00, 0xd6, 0x00, 0xe8, 0x00, 0xf4, 0x00, 0x02, 0x01,
+  0x00, 0x00, 0x22, 0x00, 0x31, 0x00, 0x43, 0x00, 0x4e, 0x00, 0x5e, 0x00,
+  0x6e, 0x00, 0x79, 0x00, 0x8a, 0x00, 0x99, 0x00, 0xa5, 0x00, 0xaf, 0x00,
+  0xc0, 0x00, 0xcb, 0x00, 0xdb, 0x00, 0xe8, 0x00, 0xf8, 0x00, 0x04, 0x01,
+  0x14, 0x01, 0x24, 0x01, 0x2f, 0x01, 0x3b, 0x01, 0x48, 0x01, 0x58, 0x01,
+  0x00, 0x00, 0x1b, 0x00, 0x2d, 0x00, 0x6f, 0x00, 0x81, 0x00, 0x8d, 0x00,
+  0x9c, 0x00, 0xb0, 0x00, 0xbf, 0x00, 0xd0, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x40, 0x00, 0x52, 0x00, 0x64, 0x00, 0x76, 0x00, 0x84, 0x00, 0x96, 0x00,
+  0xa8, 0x00, 0xba, 0x00, 0xc4, 0x00, 0xd1, 0x00, 0xe3, 0x00, 0xf5, 0x00,
+  0x07, 0x01, 0x12, 0x01, 0x20, 0x01, 0x32, 0x01, 0x44, 0x01, 0x57, 0x01,
+  0x69, 0x01, 0x7b, 0x01, 0x8e, 0x01, 0xa0, 0x01, 0xb2, 0x01, 0xc4, 0x01,
+  0xd0, 0x01, 0xe3, 0x01, 0xf0, 0x01, 0x00, 0x00, 0x17, 0x00, 0x3e, 0x00,
+  0x4e, 0x00, 0x59, 0x00, 0x67, 0x00, 0x73, 0x00, 0x81, 0x00, 0x8f, 0x00,
+  0xa0, 0x00, 0x00, 0x00, 0x19, 0x00, 0x4a, 0x00, 0x86, 0x00, 0x90, 0x00,
+  0xa1, 0x00, 0xb6, 0x00, 0xc6, 0x00, 0xd0, 0x00, 0xdb, 0x00, 0xf0, 0x00,
+  0x04, 0x01, 0x14, 0x01, 0x23, 0x01, 0x38, 0x01, 0x43, 0x01, 0x53, 0x01,
+  0x64, 0x01, 0x77, 0x01, 0x83, 0x01, 0x92, 0x01, 0x9d, 0x01, 0xa8, 0x01,
+  0xbb, 0x01, 0xd0, 0x01, 0xe0, 0x01, 0xed, 0x01, 0x02, 0x02, 0x0d, 0x02,
+  0x18, 0x02, 0x29, 0x02, 0x3e, 0x02, 0x48, 0x02, 0x58, 0x02, 0x6b, 0x02,
+  0x7c, 0x02, 0x8c, 0x02, 0x9c, 0x02, 0xac, 0x02, 0xbc, 0x02, 0x00, 0x00,
+  0x12, 0x00, 0x3c, 0x00, 0x5a, 0x00, 0x6b, 0x00, 0x76, 0x00, 0x82, 0x00,
+  0x8d, 0x00, 0x9e, 0x00, 0xb2, 0x00, 0xbe, 0x00, 0xcf, 0x00, 0xe1, 0x00,
+  0xeb, 0x00, 0xf8, 0x00, 0x06, 0x01, 0x10, 0x01, 0x1c, 0x01, 0x27, 0x01,
+  0x34, 0x01, 0x00, 0x00, 0x10, 0x00, 0x3e, 0x00, 0x5c, 0x00, 0x68, 0x00,
+  0x74, 0x00, 0x80, 0x00, 0x92, 0x00, 0x9e, 0x00, 0xb4, 0x00, 0xc2, 0x00,
+  0xce, 0x00, 0xdc, 0x00, 0xe7, 0x00, 0xf5, 0x00, 0x0a, 0x01, 0x14, 0x01,
+  0x26, 0x01, 0x34, 0x01, 0x3e, 0x01, 0x4a, 0x01, 0x58, 0x01, 0x62, 0x01,
+  0x6c, 0x01, 0x76, 0x01, 0x8c, 0x01, 0x00, 0x00, 0x1d, 0x00, 0x3e, 0x00,
+  0x5e, 0x00, 0x74, 0x00, 0x7f, 0x00, 0x8d, 0x00, 0x98, 0x00, 0xa4, 0x00,
+  0xb2, 0x00, 0xc0, 0x00, 0xcb, 0x00, 0xd6, 0x00, 0xe1, 0x00, 0xec, 0x00,
+  0xf8, 0x00, 0x03, 0x01, 0x0e, 0x01, 0x1c, 0x01, 0x28, 0x01, 0x33, 0x01,
+  0x3e, 0x01, 0x4d, 0x01, 0x59, 0x01, 0x65, 0x01, 0x71, 0x01, 0x7d, 0x01,
+  0x88, 0x01, 0x93, 0x01, 0x9e, 0x01, 0xaa, 0x01, 0xb6, 0x01, 0xc4, 0x01,
+  0xd0, 0x01, 0xdc, 0x01, 0xe8, 0x01, 0xf5, 0x01, 0x01, 0x02, 0x0f, 0x02,
+  0x1d, 0x02, 0x29, 0x02, 0x34, 0x02, 0x40, 0x02, 0x00, 0x00, 0x24, 0x00,
+  0x38, 0x00, 0x6b, 0x00, 0x77, 0x00, 0x82, 0x00, 0x90, 0x00, 0x9c, 0x00,
+  0xa8, 0x00, 0xb6, 0x00, 0xc5, 0x00, 0xcf, 0x00, 0xe0, 0x00, 0xec, 0x00,
+  0xf8, 0x00, 0x04, 0x01, 0x10, 0x01, 0x1f, 0x01, 0x2f, 0x01, 0x3b, 0x01,
+  0x49, 0x01, 0x57, 0x01, 0x63, 0x01, 0x77, 0x01, 0x85, 0x01, 0x93, 0x01,
+  0x9f, 0x01, 0xab, 0x01, 0xc0, 0x01, 0xcc, 0x01, 0xda, 0x01, 0xe6, 0x01,
+  0xf4, 0x01, 0x00, 0x02, 0x0e, 0x02, 0x00, 0x00, 0x0b, 0x00, 0x16, 0x00,
+  0x24, 0x00, 0x33, 0x00, 0x44, 0x00, 0x52, 0x00, 0x61, 0x00, 0x70, 0x00,
+  0x7e, 0x00, 0x8a, 0x00, 0x98, 0x00, 0xa7, 0x00, 0xb5, 0x00, 0xc4, 0x00,
+  0xd5, 0x00, 0xe0, 0x00, 0xee, 0x00, 0x03, 0x01, 0x12, 0x01, 0x20, 0x01,
+  0x2e, 0x01, 0x3c, 0x01, 0x4b, 0x01, 0x57, 0x01, 0x65, 0x01, 0x79, 0x01,
+  0x8e, 0x01, 0x9c, 0x01, 0xaa, 0x01, 0xb6, 0x01, 0xc4, 0x01, 0xd3, 0x01,
+  0xe1, 0x01, 0xef, 0x01, 0xfd, 0x01, 0x0c, 0x02, 0x1a, 0x02, 0x24, 0x02,
+  0x32, 0x02, 0x40, 0x02, 0x4f, 0x02, 0x59, 0x02, 0x69, 0x02, 0x77, 0x02,
+  0x81, 0x02, 0x8f, 0x02, 0x99, 0x02, 0xa7, 0x02, 0xb5, 0x02, 0xc3, 0x02,
+  0xd1, 0x02, 0xdf, 0x02, 0xee, 0x02, 0x00, 0x00, 0x0a, 0x00, 0x15, 0x00,
+  0x21, 0x00, 0x30, 0x00, 0x3c, 0x00, 0x48, 0x00, 0x54, 0x00, 0x60, 0x00,
+  0x6e, 0x00, 0x7a, 0x00, 0x87, 0x00, 0x92, 0x00, 0x9e, 0x00, 0xad, 0x00,
+  0xc8, 0x00, 0xd4, 0x00, 0xe2, 0x00, 0xf5, 0x00, 0xff, 0x00, 0x0e, 0x01,
+  0x1a, 0x01, 0x2a, 0x01, 0x36, 0x01, 0x42, 0x01, 0x50, 0x01, 0x60, 0x01,
+  0x6e, 0x01, 0x7c, 0x01, 0x00, 0x00, 0x0b, 0x00, 0x18, 0x00, 0x24, 0x00,
+  0x30, 0x00, 0x41, 0x00, 0x51, 0x00, 0x5d, 0x00, 0x74, 0x00, 0x7f, 0x00,
+  0x8b, 0x00, 0x99, 0x00, 0xa7, 0x00, 0xb5, 0x00, 0xc3, 0x00, 0xd0, 0x00,
+  0xdd, 0x00, 0xe9, 0x00, 0xfa, 0x00, 0x0a, 0x01, 0x21, 0x01, 0x31, 0x01,
+  0x3d, 0x01, 0x49, 0x01, 0x57, 0x01, 0x68, 0x01, 0x76, 0x01, 0x86, 0x01,
+  0x92, 0x01, 0x9e, 0x01, 0xae, 0x01, 0xbe, 0x01, 0xcd, 0x01, 0x00, 0x00,
+  0x0b, 0x00, 0x17, 0x00, 0x23, 0x00, 0x2f, 0x00, 0x3b, 0x00, 0x47, 0x00,
+  0x53, 0x00, 0x5f, 0x00, 0x71, 0x00, 0x7e, 0x00, 0x90, 0x00, 0x9c, 0x00,
+  0xaa, 0x00, 0xb6, 0x00, 0xc2, 0x00, 0xce, 0x00, 0xd9, 0x00, 0xe7, 0x00,
+  0xf5, 0x00, 0x01, 0x01, 0x0d, 0x01, 0x19, 0x01, 0x29, 0x01, 0x37, 0x01,
+  0x45, 0x01, 0x53, 0x01, 0x00, 0x00, 0x15, 0x00, 0x20, 0x00, 0x2b, 0x00,
+  0x3b, 0x00, 0x49, 0x00, 0x57, 0x00, 0x63, 0x00, 0x6f, 0x00, 0x80, 0x00,
+  0x8e, 0x00, 0x9c, 0x00, 0xa8, 0x00, 0xb8, 0x00, 0xc6, 0x00, 0xd5, 0x00,
+  0xe4, 0x00, 0xf0, 0x00, 0xfa, 0x00, 0x06, 0x01, 0x11, 0x01, 0x1f, 0x01,
+  0x2d, 0x01, 0x3c, 0x01, 0x54, 0x01, 0x5e, 0x01, 0x00, 0x00, 0x0b, 0x00,
+  0x18, 0x00, 0x26, 0x00, 0x33, 0x00, 0x40, 0x00, 0x4f, 0x00, 0x60, 0x00,
+  0x6f, 0x00, 0x7e, 0x00, 0x8b, 0x00, 0x98, 0x00, 0xa6, 0x00, 0xb4, 0x00,
+  0xc3, 0x00, 0xd5, 0x00, 0xe1, 0x00, 0xf0, 0x00, 0xff, 0x00, 0x0c, 0x01,
+  0x00, 0x00, 0x17, 0x00, 0x22, 0x00, 0x2e, 0x00, 0x3d, 0x00, 0x4b, 0x00,
+  0x5a, 0x00, 0x6d, 0x00, 0x7b, 0x00, 0x87, 0x00, 0x93, 0x00, 0xa1, 0x00,
+  0xaf, 0x00, 0xbd, 0x00, 0xd4, 0x00, 0xe1, 0x00, 0xed, 0x00, 0xfd, 0x00,
+  0x0c, 0x01, 0x18, 0x01, 0x26, 0x01, 0x32, 0x01, 0x3e, 0x01, 0x4c, 0x01,
+  0x5a, 0x01, 0x66, 0x01, 0x74, 0x01, 0x82, 0x01, 0x94, 0x01, 0xa2, 0x01,
+  0xaf, 0x01, 0xc0, 0x01, 0xcd, 0x01, 0xd9, 0x01, 0xe5, 0x01, 0xf1, 0x01,
+  0xff, 0x01, 0x0b, 0x02, 0x17, 0x02, 0x26, 0x02, 0x00, 0x00, 0x0b, 0x00,
+  0x1a, 0x00, 0x26, 0x00, 0x37, 0x00, 0x43, 0x00, 0x4d, 0x00, 0x59, 0x00,
+  0x6e, 0x00, 0x7e, 0x00, 0x8e, 0x00, 0x9c, 0x00, 0xac, 0x00, 0xbc, 0x00,
+  0xc7, 0x00, 0xd1, 0x00, 0xdb, 0x00, 0xe7, 0x00, 0xf7, 0x00, 0x02, 0x01,
+  0x12, 0x01, 0x1d, 0x01, 0x2d, 0x01, 0x3e, 0x01, 0x00, 0x00, 0x19, 0x00,
+  0x23, 0x00, 0x32, 0x00, 0x40, 0x00, 0x4c, 0x00, 0x5a, 0x00, 0x69, 0x00,
+  0x75, 0x00, 0x83, 0x00, 0x92, 0x00, 0xa3, 0x00, 0xae, 0x00, 0xbd, 0x00,
+  0xcb, 0x00, 0xd9, 0x00, 0xe8, 0x00, 0xf6, 0x00, 0x05, 0x01, 0x14, 0x01,
+  0x26, 0x01, 0x33, 0x01, 0x41, 0x01, 0x50, 0x01, 0x5e, 0x01, 0x6a, 0x01,
+  0x79, 0x01, 0x85, 0x01, 0x94, 0x01, 0xa3, 0x01, 0xb1, 0x01, 0xc0, 0x01,
+  0xd0, 0x01, 0x00, 0x00, 0x20, 0x00, 0x36, 0x00, 0x41, 0x00, 0x4d, 0x00,
+  0x5b, 0x00, 0x6d, 0x00, 0x7b, 0x00, 0x8d, 0x00, 0x9f, 0x00, 0xa9, 0x00,
+  0xbc, 0x00, 0xc8, 0x00, 0xda, 0x00, 0xe7, 0x00, 0xf9, 0x00, 0x0b, 0x01,
+  0x17, 0x01, 0x29, 0x01, 0x3b, 0x01, 0x47, 0x01, 0x59, 0x01, 0x65, 0x01,
+  0x72, 0x01, 0x84, 0x01, 0x96, 0x01, 0xa3, 0x01, 0xaf, 0x01, 0x00, 0x00,
+  0x17, 0x00, 0x2b, 0x00, 0x36, 0x00, 0x44, 0x00, 0x52, 0x00, 0x60, 0x00,
+  0x6c, 0x00, 0x78, 0x00, 0x85, 0x00, 0x93, 0x00, 0xa5, 0x00, 0xb2, 0x00,
+  0xbe, 0x00, 0xcd, 0x00, 0xdb, 0x00, 0xe9, 0x00, 0xf6, 0x00, 0x00, 0x00,
+  0x17, 0x00, 0x2f, 0x00, 0x47, 0x00, 0x5f, 0x00, 0x7a, 0x00, 0x85, 0x00,
+  0x90, 0x00, 0xa4, 0x00, 0xb2, 0x00, 0xc5, 0x00, 0xd3, 0x00, 0xe7, 0x00,
+  0xf6, 0x00, 0x02, 0x01, 0x0e, 0x01, 0x22, 0x01, 0x30, 0x01, 0x40, 0x01,
+  0x52, 0x01, 0x62, 0x01, 0x77, 0x01, 0x88, 0x01, 0x98, 0x01, 0xa4, 0x01,
+  0x00, 0x00, 0x0e, 0x00, 0x19, 0x00, 0x24, 0x00, 0x30, 0x00, 0x3c, 0x00,
+  0x4b, 0x00, 0x5d, 0x00, 0x69, 0x00, 0x77, 0x00, 0x85, 0x00, 0x90, 0x00,
+  0x9e, 0x00, 0x00, 0x00, 0x10, 0x00, 0x25, 0x00, 0x42, 0x00, 0x54, 0x00,
+  0x66, 0x00, 0x72, 0x00, 0x85, 0x00, 0x91, 0x00, 0xa7, 0x00, 0xb7, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x1d, 0x00, 0x28, 0x00, 0x34, 0x00, 0x3f, 0x00,
+  0x4b, 0x00, 0x56, 0x00, 0x62, 0x00, 0x6e, 0x00, 0x7a, 0x00, 0x86, 0x00,
+  0x92, 0x00, 0xa6, 0x00, 0xb1, 0x00, 0xbd, 0x00, 0xca, 0x00, 0xdf, 0x00,
+  0xec, 0x00, 0xf7, 0x00, 0x04, 0x01, 0x0f, 0x01, 0x1b, 0x01, 0x2a, 0x01,
+  0x35, 0x01, 0x40, 0x01, 0x4c, 0x01, 0x57, 0x01, 0x62, 0x01, 0x00, 0x00,
+  0x19, 0x00, 0x24, 0x00, 0x3c, 0x00, 0x4a, 0x00, 0x56, 0x00, 0x62, 0x00,
+  0x79, 0x00, 0x85, 0x00, 0x93, 0x00, 0xa1, 0x00, 0x00, 0x00, 0x22, 0x00,
+  0x30, 0x00, 0x3e, 0x00, 0x4c, 0x00, 0x5a, 0x00, 0x68, 0x00, 0x76, 0x00,
+  0x85, 0x00, 0x93, 0x00, 0xa3, 0x00, 0xb1, 0x00, 0xbf, 0x00, 0xcd, 0x00,
+  0xdb, 0x00, 0xe9, 0x00, 0xf7, 0x00, 0x05, 0x01, 0x13, 0x01, 0x21, 0x01,
+  0x2f, 0x01, 0x3d, 0x01, 0x4b, 0x01, 0x59, 0x01, 0x67, 0x01, 0x76, 0x01,
+  0x84, 0x01, 0x92, 0x01, 0xa0, 0x01, 0xae, 0x01, 0xbd, 0x01, 0xcb, 0x01,
+  0xda, 0x01, 0xe8, 0x01, 0xf7, 0x01, 0x05, 0x02, 0x13, 0x02, 0x21, 0x02,
+  0x2d, 0x02, 0x3b, 0x02, 0x47, 0x02, 0x51, 0x02, 0x5f, 0x02, 0x6d, 0x02,
+  0x79, 0x02, 0x87, 0x02, 0x95, 0x02, 0xa3, 0x02, 0xb1, 0x02, 0xc3, 0x02,
+  0xce, 0x02, 0xda, 0x02, 0xe9, 0x02, 0xf7, 0x02, 0x06, 0x03, 0x15, 0x03,
+  0x21, 0x03, 0x2d, 0x03, 0x3c, 0x03, 0x4a, 0x03, 0x58, 0x03, 0x66, 0x03,
+  0x74, 0x03, 0x82, 0x03, 0x8d, 0x03, 0x9b, 0x03, 0xa9, 0x03, 0xb5, 0x03,
+  0xc3, 0x03, 0xd1, 0x03, 0xdf, 0x03, 0x00, 0x00, 0x1d, 0x00, 0x2b, 0x00,
+  0x3b, 0x00, 0x56, 0x00, 0x00, 0x00, 0x28, 0x00, 0x36, 0x00, 0x47, 0x00,
+  0x58, 0x00, 0x66, 0x00, 0x76, 0x00, 0x81, 0x00, 0x95, 0x00, 0xa2, 0x00,
+  0xb0, 0x00, 0xbb, 0x00, 0xcb, 0x00, 0xd7, 0x00, 0xe7, 0x00, 0xf7, 0x00,
+  0x08, 0x01, 0x13, 0x01, 0x23, 0x01, 0x2f, 0x01, 0x3d, 0x01, 0x4d, 0x01,
+  0x5a, 0x01, 0x64, 0x01, 0x75, 0x01, 0x00, 0x00, 0x28, 0x00, 0x34, 0x00,
+  0x40, 0x00, 0x5d, 0x00, 0x69, 0x00, 0x76, 0x00, 0x86, 0x00, 0x9a, 0x00,
+  0xa6, 0x00, 0xb7, 0x00, 0xc4, 0x00, 0xd0, 0x00, 0xdd, 0x00, 0xe9, 0x00,
+  0xf5, 0x00, 0x00, 0x01, 0x0c, 0x01, 0x00, 0x00, 0x17, 0x00, 0x26, 0x00,
+  0x35, 0x00, 0x43, 0x00, 0x52, 0x00, 0x62, 0x00, 0x70, 0x00, 0x7e, 0x00,
+  0x8c, 0x00, 0x9e, 0x00, 0xad, 0x00, 0xbd, 0x00, 0xcf, 0x00, 0xdd, 0x00,
+  0xeb, 0x00, 0xf9, 0x00, 0x07, 0x01, 0x00, 0x00, 0x22, 0x00, 0x3b, 0x00,
+  0x49, 0x00, 0x57, 0x00, 0x64, 0x00, 0x72, 0x00, 0x7f, 0x00, 0x8e, 0x00,
+  0x9b, 0x00, 0xa9, 0x00, 0xb6, 0x00, 0xc4, 0x00, 0xd2, 0x00, 0xe3, 0x00,
+  0xef, 0x00, 0xfd, 0x00, 0x0b, 0x01, 0x19, 0x01, 0x25, 0x01, 0x00, 0x00,
+  0x0e, 0x00, 0x1f, 0x00, 0x2b, 0x00, 0x3b, 0x00, 0x4b, 0x00, 0x5b, 0x00,
+  0x67, 0x00, 0x73, 0x00, 0x7f, 0x00, 0x8b, 0x00, 0xa2, 0x00, 0xae, 0x00,
+  0xbf, 0x00, 0x00, 0x00, 0x20, 0x00, 0x51, 0x00, 0x79, 0x00, 0x89, 0x00,
+  0x95, 0x00, 0xa5, 0x00, 0xb6, 0x00, 0xc6, 0x00, 0xd6, 0x00, 0xe6, 0x00,
+  0xf7, 0x00, 0x07, 0x01, 0x17, 0x01, 0x28, 0x01, 0x38, 0x01, 0x00, 0x00,
+  0x26, 0x00, 0x3f, 0x00, 0x4b, 0x00, 0x56, 0x00, 0x67, 0x00, 0x73, 0x00,
+  0x84, 0x00, 0x95, 0x00, 0xa4, 0x00, 0xb3, 0x00, 0xbd, 0x00, 0x00, 0x00,
+  0x22, 0x00, 0x64, 0x00, 0x85, 0x00, 0x90, 0x00, 0xa3, 0x00, 0xaf, 0x00,
+  0xbc, 0x00, 0xce, 0x00, 0xe0, 0x00, 0xf2, 0x00, 0xfd, 0x00, 0x0f, 0x01,
+  0x1c, 0x01, 0x2b, 0x01, 0x00, 0x00, 0x26, 0x00, 0x46, 0x00, 0x56, 0x00,
+  0x67, 0x00, 0x76, 0x00, 0x8f, 0x00, 0x9f, 0x00, 0xae, 0x00, 0xb8, 0x00,
+  0xc8, 0x00, 0xd1, 0x00, 0xd9, 0x00, 0x00, 0x00, 0x29, 0x00, 0x58, 0x00,
+  0x73, 0x00, 0x87, 0x00, 0x9c, 0x00, 0xac, 0x00, 0xb8, 0x00, 0xca, 0x00,
+  0xd5, 0x00, 0xe9, 0x00, 0xf3, 0x00, 0xfe, 0x00, 0x09, 0x01, 0x13, 0x01,
+  0x27, 0x01, 0x32, 0x01, 0x3d, 0x01, 0x4d, 0x01, 0x58, 0x01, 0x68, 0x01,
+  0x7d, 0x01, 0x8d, 0x01, 0x98, 0x01, 0xa2, 0x01, 0x00, 0x00, 0x1e, 0x00,
+  0x44, 0x00, 0x6a, 0x00, 0x78, 0x00, 0x84, 0x00, 0x8f, 0x00, 0x9d, 0x00,
+  0xaa, 0x00, 0xb5, 0x00, 0xc1, 0x00, 0xcd, 0x00, 0xd9, 0x00, 0xe3, 0x00,
+  0xed, 0x00, 0xf8, 0x00, 0x03, 0x01, 0x0d, 0x01, 0x17, 0x01, 0x23, 0x01,
+  0x00, 0x00, 0x20, 0x00, 0x48, 0x00, 0x54, 0x00, 0x60, 0x00, 0x6c, 0x00,
+  0x7e, 0x00, 0x8a, 0x00, 0x96, 0x00, 0xa2, 0x00, 0xae, 0x00, 0xbc, 0x00,
+  0xcf, 0x00, 0xe1, 0x00, 0xf3, 0x00, 0x04, 0x01, 0x12, 0x01, 0x1f, 0x01,
+  0x2b, 0x01, 0x34, 0x01, 0x3e, 0x01, 0x47, 0x01, 0x00, 0x00, 0x1d, 0x00,
+  0x34, 0x00, 0x3f, 0x00, 0x4a, 0x00, 0x55, 0x00, 0x63, 0x00, 0x6f, 0x00,
+  0x7b, 0x00, 0x87, 0x00, 0x93, 0x00, 0x9f, 0x00, 0xad, 0x00, 0xbb, 0x00,
+  0xc7, 0x00, 0xd3, 0x00, 0xdf, 0x00, 0xeb, 0x00, 0xf6, 0x00, 0x01, 0x01,
+  0x0d, 0x01, 0x1b, 0x01, 0x24, 0x01, 0x34, 0x01, 0x42, 0x01, 0x4e, 0x01,
+  0x5a, 0x01, 0x66, 0x01, 0x71, 0x01, 0x7c, 0x01, 0x87, 0x01, 0x9b, 0x01,
+  0xaa, 0x01, 0xb6, 0x01, 0xc3, 0x01, 0xcc, 0x01, 0xd5, 0x01, 0x00, 0x00,
+  0x54, 0x00, 0x74, 0x00, 0x86, 0x00, 0x94, 0x00, 0xa3, 0x00, 0xb1, 0x00,
+  0xbd, 0x00, 0xd0, 0x00, 0xde, 0x00, 0xfe, 0x00, 0x0a, 0x01, 0x1d, 0x01,
+  0x2b, 0x01, 0x37, 0x01, 0x45, 0x01, 0x51, 0x01, 0x64, 0x01, 0x71, 0x01,
+  0x7f, 0x01, 0x8d, 0x01, 0x99, 0x01, 0xa7, 0x01, 0xb5, 0x01, 0xc1, 0x01,
+  0xd0, 0x01, 0xde, 0x01, 0xe8, 0x01, 0xf2, 0x01, 0xfb, 0x01, 0x09, 0x02,
+  0x14, 0x02, 0x20, 0x02, 0x2e, 0x02, 0x3a, 0x02, 0x46, 0x02, 0x55, 0x02,
+  0x61, 0x02, 0x6f, 0x02, 0x78, 0x02, 0x89, 0x02, 0x93, 0x02, 0x00, 0x00,
+  0x19, 0x00, 0x46, 0x00, 0x64, 0x00, 0x7b, 0x00, 0x92, 0x00, 0xab, 0x00,
+  0xb5, 0x00, 0xc3, 0x00, 0xce, 0x00, 0xda, 0x00, 0xe8, 0x00, 0xf4, 0x00,
+  0x02, 0x01, 0x10, 0x01, 0x1b, 0x01, 0x28, 0x01, 0x33, 0x01, 0x42, 0x01,
+  0x4f, 0x01, 0x5d, 0x01, 0x6b, 0x01, 0x79, 0x01, 0x84, 0x01, 0x90, 0x01,
+  0x9e, 0x01, 0xab, 0x01, 0xb7, 0x01, 0xc6, 0x01, 0xd4, 0x01, 0xe3, 0x01,
+  0xf1, 0x01, 0xfd, 0x01, 0x08, 0x02, 0x19, 0x02, 0x27, 0x02, 0x32, 0x02,
+  0x3e, 0x02, 0x4c, 0x02, 0x57, 0x02, 0x65, 0x02, 0x73, 0x02, 0x88, 0x02,
+  0x93, 0x02, 0xa1, 0x02, 0xae, 0x02, 0xbd, 0x02, 0xcb, 0x02, 0xd6, 0x02,
+  0xe4, 0x02, 0xf8, 0x02, 0x0d, 0x03, 0x1b, 0x03, 0x29, 0x03, 0x3e, 0x03,
+  0x4c, 0x03, 0x5a, 0x03, 0x69, 0x03, 0x74, 0x03, 0x82, 0x03, 0x90, 0x03,
+  0xa1, 0x03, 0xb2, 0x03, 0xc0, 0x03, 0xce, 0x03, 0xdc, 0x03, 0xea, 0x03,
+  0xf8, 0x03, 0x00, 0x00, 0x49, 0x00, 0x6e, 0x00, 0x90, 0x00, 0xa0, 0x00,
+  0xae, 0x00, 0xcd, 0x00, 0xde, 0x00, 0xea, 0x00, 0xf8, 0x00, 0x06, 0x01,
+  0x12, 0x01, 0x1e, 0x01, 0x2c, 0x01, 0x3c, 0x01, 0x4d, 0x01, 0x58, 0x01,
+  0x67, 0x01, 0x75, 0x01, 0x81, 0x01, 0x90, 0x01, 0x9f, 0x01, 0xab, 0x01,
+  0xb4, 0x01, 0xc0, 0x01, 0xd7, 0x01, 0xe3, 0x01, 0xef, 0x01, 0x00, 0x02,
+  0x0c, 0x02, 0x1a, 0x02, 0x28, 0x02, 0x43, 0x02, 0x4d, 0x02, 0x59, 0x02,
+  0x63, 0x02, 0x71, 0x02, 0x00, 0x00, 0x22, 0x00, 0x44, 0x00, 0x59, 0x00,
+  0x7b, 0x00, 0xa0, 0x00, 0xb0, 0x00, 0xbc, 0x00, 0xc8, 0x00, 0xd4, 0x00,
+  0xe0, 0x00, 0xec, 0x00, 0xfc, 0x00, 0x07, 0x01, 0x15, 0x01, 0x20, 0x01,
+  0x2e, 0x01, 0x3c, 0x01, 0x48, 0x01, 0x53, 0x01, 0x5f, 0x01, 0x70, 0x01,
+  0x7c, 0x01, 0x88, 0x01, 0x96, 0x01, 0xa2, 0x01, 0xad, 0x01, 0xb8, 0x01,
+  0xc4, 0x01, 0xdc, 0x01, 0xe5, 0x01, 0xf3, 0x01, 0x04, 0x02, 0x12, 0x02,
+  0x1d, 0x02, 0x28, 0x02, 0x34, 0x02, 0x42, 0x02, 0x50, 0x02, 0x00, 0x00,
+  0x12, 0x00, 0x3f, 0x00, 0x5d, 0x00, 0x69, 0x00, 0x82, 0x00, 0x96, 0x00,
+  0xa1, 0x00, 0xaf, 0x00, 0xbb, 0x00, 0xc6, 0x00, 0xd4, 0x00, 0xe0, 0x00,
+  0xee, 0x00, 0xfd, 0x00, 0x09, 0x01, 0x14, 0x01, 0x20, 0x01, 0x2a, 0x01,
+  0x00, 0x00, 0x37, 0x00, 0x47, 0x00, 0x66, 0x00, 0x90, 0x00, 0xa6, 0x00,
+  0xb5, 0x00, 0xc3, 0x00, 0xd1, 0x00, 0xdf, 0x00, 0xed, 0x00, 0xfb, 0x00,
+  0x0a, 0x01, 0x18, 0x01, 0x23, 0x01, 0x32, 0x01, 0x40, 0x01, 0x4c, 0x01,
+  0x5b, 0x01, 0x66, 0x01, 0x74, 0x01, 0x82, 0x01, 0x8e, 0x01, 0x9e, 0x01,
+  0xac, 0x01, 0xba, 0x01, 0xc5, 0x01, 0xd3, 0x01, 0xde, 0x01, 0xec, 0x01,
+  0x01, 0x02, 0x0f, 0x02, 0x1e, 0x02, 0x2a, 0x02, 0x33, 0x02, 0x41, 0x02,
+  0x4c, 0x02, 0x5a, 0x02, 0x68, 0x02, 0x72, 0x02, 0x80, 0x02, 0x8e, 0x02,
+  0x00, 0x00, 0x1c, 0x00, 0x2a, 0x00, 0x3c, 0x00, 0x55, 0x00, 0x6c, 0x00,
+  0x79, 0x00, 0x85, 0x00, 0x93, 0x00, 0xa2, 0x00, 0xae, 0x00, 0xbc, 0x00,
+  0xc7, 0x00, 0xd2, 0x00, 0xdf, 0x00, 0xeb, 0x00, 0xf5, 0x00, 0x00, 0x01,
+  0x0c, 0x01, 0x1a, 0x01, 0x24, 0x01, 0x33, 0x01, 0x40, 0x01, 0x4e, 0x01,
+  0x5d, 0x01, 0x6b, 0x01, 0x7a, 0x01, 0x86, 0x01, 0x94, 0x01, 0xa2, 0x01,
+  0xb3, 0x01, 0xbe, 0x01, 0x00, 0x00, 0x0e, 0x00, 0x1e, 0x00, 0x40, 0x00,
+  0x4b, 0x00, 0x5b, 0x00, 0x69, 0x00, 0x77, 0x00, 0x86, 0x00, 0x92, 0x00,
+  0xa2, 0x00, 0xb3, 0x00, 0xbf, 0x00, 0xd3, 0x00, 0xdf, 0x00, 0xeb, 0x00,
+  0xf7, 0x00, 0x03, 0x01, 0x0f, 0x01, 0x1d, 0x01, 0x26, 0x01, 0x32, 0x01,
+  0x41, 0x01, 0x4d, 0x01, 0x59, 0x01, 0x65, 0x01, 0x71, 0x01, 0x7f, 0x01,
+  0x8d, 0x01, 0x99, 0x01, 0xaa, 0x01, 0xb7, 0x01, 0xc3, 0x01, 0xd5, 0x01,
+  0xe1, 0x01, 0xed, 0x01, 0xfb, 0x01, 0x08, 0x02, 0x14, 0x02, 0x24, 0x02,
+  0x35, 0x02, 0x41, 0x02, 0x4f, 0x02, 0x00, 0x00, 0x20, 0x00, 0x3b, 0x00,
+  0x55, 0x00, 0x66, 0x00, 0x7b, 0x00, 0x8b, 0x00, 0x9b, 0x00, 0xaa, 0x00,
+  0xb9, 0x00, 0xc6, 0x00, 0xd6, 0x00, 0xe3, 0x00, 0xf5, 0x00, 0xfe, 0x00,
+  0x17, 0x01, 0x27, 0x01, 0x37, 0x01, 0x47, 0x01, 0x51, 0x01, 0x60, 0x01,
+  0x70, 0x01, 0x7c, 0x01, 0x8b, 0x01, 0x9d, 0x01, 0xa8, 0x01, 0xb8, 0x01,
+  0xc4, 0x01, 0xd5, 0x01, 0x00, 0x00, 0x17, 0x00, 0x21, 0x00, 0x2d, 0x00,
+  0x44, 0x00, 0x50, 0x00, 0x5c, 0x00, 0x6b, 0x00, 0x7a, 0x00, 0x8e, 0x00,
+  0x9c, 0x00, 0xaa, 0x00, 0xb9, 0x00, 0xc8, 0x00, 0xd3, 0x00, 0xe1, 0x00,
+  0xf5, 0x00, 0x00, 0x01, 0x0e, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x38, 0x01,
+  0x49, 0x01, 0x57, 0x01, 0x67, 0x01, 0x75, 0x01, 0x00, 0x00, 0x0e, 0x00,
+  0x1e, 0x00, 0x30, 0x00, 0x3c, 0x00, 0x4f, 0x00, 0x61, 0x00, 0x73, 0x00,
+  0x85, 0x00, 0x97, 0x00, 0xa9, 0x00, 0xbb, 0x00, 0xc9, 0x00, 0xdb, 0x00,
+  0xed, 0x00, 0xf8, 0x00, 0x09, 0x01, 0x17, 0x01, 0x24, 0x01, 0x30, 0x01,
+  0x42, 0x01, 0x50, 0x01, 0x62, 0x01, 0x6d, 0x01, 0x7e, 0x01, 0x88, 0x01,
+  0x95, 0x01, 0xa7, 0x01, 0xb2, 0x01, 0xbc, 0x01, 0xce, 0x01, 0xdf, 0x01,
+  0xf1, 0x01, 0x03, 0x02, 0x0c, 0x02, 0x16, 0x02, 0x24, 0x02, 0x36, 0x02,
+  0x43, 0x02, 0x51, 0x02, 0x63, 0x02, 0x76, 0x02, 0x89, 0x02, 0x96, 0x02,
+  0xa8, 0x02, 0xba, 0x02, 0xc7, 0x02, 0xd9, 0x02, 0xeb, 0x02, 0xf5, 0x02,
+  0x01, 0x03, 0x13, 0x03, 0x25, 0x03, 0x37, 0x03, 0x49, 0x03, 0x5b, 0x03,
+  0x68, 0x03, 0x74, 0x03, 0x00, 0x00, 0x22, 0x00, 0x3d, 0x00, 0x53, 0x00,
+  0x61, 0x00, 0x71, 0x00, 0x7d, 0x00, 0x8d, 0x00, 0x99, 0x00, 0xa5, 0x00,
+  0xbe, 0x00, 0xcb, 0x00, 0xd7, 0x00, 0xe3, 0x00, 0xf6, 0x00, 0x02, 0x01,
+  0x0e, 0x01, 0x1a, 0x01, 0x26, 0x01, 0x32, 0x01, 0x47, 0x01, 0x55, 0x01,
+  0x00, 0x00, 0x38, 0x00, 0x4f, 0x00, 0x65, 0x00, 0x79, 0x00, 0x87, 0x00,
+  0x93, 0x00, 0x9f, 0x00, 0xab, 0x00, 0xb7, 0x00, 0xc6, 0x00, 0xd0, 0x00,
+  0xe1, 0x00, 0xed, 0x00, 0xf9, 0x00, 0x0a, 0x01, 0x1a, 0x01, 0x2a, 0x01,
+  0x3f, 0x01, 0x4f, 0x01, 0x5d, 0x01, 0x67, 0x01, 0x7c, 0x01, 0x8d, 0x01,
+  0x9c, 0x01, 0xb0, 0x01, 0xbc, 0x01, 0xca, 0x01, 0xda, 0x01, 0xea, 0x01,
+  0xfa, 0x01, 0x0e, 0x02, 0x1a, 0x02, 0x00, 0x00, 0x1b, 0x00, 0x2f, 0x00,
+  0x3b, 0x00, 0x47, 0x00, 0x52, 0x00, 0x66, 0x00, 0x78, 0x00, 0x88, 0x00,
+  0x97, 0x00, 0x00, 0x00, 0x24, 0x00, 0x48, 0x00, 0x5b, 0x00, 0x6c, 0x00,
+  0x7a, 0x00, 0x8d, 0x00, 0x9b, 0x00, 0xab, 0x00, 0xba, 0x00, 0xc6, 0x00,
+  0xdb, 0x00, 0xe7, 0x00, 0xfd, 0x00, 0x0f, 0x01, 0x21, 0x01, 0x00, 0x00,
+  0x0e, 0x00, 0x1a, 0x00, 0x27, 0x00, 0x32, 0x00, 0x3e, 0x00, 0x49, 0x00,
+  0x54, 0x00, 0x5f, 0x00, 0x6b, 0x00, 0x78, 0x00, 0x8c, 0x00, 0x97, 0x00,
+  0xa2, 0x00, 0xad, 0x00, 0xbe, 0x00, 0x00, 0x00, 0x12, 0x00, 0x1d, 0x00,
+  0x2c, 0x00, 0x38, 0x00, 0x44, 0x00, 0x5c, 0x00, 0x71, 0x00, 0x7d, 0x00,
+  0x87, 0x00, 0x9b, 0x00, 0xa7, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x34, 0x00,
+  0x4f, 0x00, 0x85, 0x00, 0x93, 0x00, 0xa1, 0x00, 0xaf, 0x00, 0xbd, 0x00,
+  0xcb, 0x00, 0xd9, 0x00, 0xe7, 0x00, 0xf5, 0x00, 0x02, 0x01, 0x10, 0x01,
+  0x1e, 0x01, 0x2c, 0x01, 0x43, 0x01, 0x51, 0x01, 0x5f, 0x01, 0x6d, 0x01,
+  0x78, 0x01, 0x86, 0x01, 0x91, 0x01, 0x9f, 0x01, 0xaa, 0x01, 0xb7, 0x01,
+  0xc3, 0x01, 0xd1, 0x01, 0xdc, 0x01, 0xe7, 0x01, 0xf5, 0x01, 0x00, 0x02,
+  0x0e, 0x02, 0x1c, 0x02, 0x27, 0x02, 0x35, 0x02, 0x40, 0x02, 0x4c, 0x02,
+  0x5d, 0x02, 0x68, 0x02, 0x76, 0x02, 0x85, 0x02, 0x93, 0x02, 0xa1, 0x02,
+  0xb4, 0x02, 0xbf, 0x02, 0xc9, 0x02, 0xd7, 0x02, 0xe2, 0x02, 0xf0, 0x02,
+  0xfc, 0x02, 0x0a, 0x03, 0x18, 0x03, 0x23, 0x03, 0x2e, 0x03, 0x3c, 0x03,
+  0x00, 0x00, 0x1c, 0x00, 0x3b, 0x00, 0x4d, 0x00, 0x63, 0x00, 0x7c, 0x00,
+  0x8d, 0x00, 0x9c, 0x00, 0xaf, 0x00, 0x00, 0x00, 0x10, 0x00, 0x20, 0x00,
+  0x37, 0x00, 0x4e, 0x00, 0x5e, 0x00, 0x6e, 0x00, 0x7e, 0x00, 0x89, 0x00,
+  0x9a, 0x00, 0xab, 0x00, 0xb7, 0x00, 0xc8, 0x00, 0xd9, 0x00, 0xe4, 0x00,
+  0xf5, 0x00, 0x00, 0x01, 0x13, 0x01, 0x24, 0x01, 0x30, 0x01, 0x00, 0x00,
+  0x17, 0x00, 0x32, 0x00, 0x44, 0x00, 0x58, 0x00, 0x81, 0x00, 0x8c, 0x00,
+  0x97, 0x00, 0xa2, 0x00, 0xae, 0x00, 0xb9, 0x00, 0x00, 0x00, 0x20, 0x00,
+  0x32, 0x00, 0x42, 0x00, 0x5d, 0x00, 0x74, 0x00, 0x82, 0x00, 0x90, 0x00,
+  0x9e, 0x00, 0xb0, 0x00, 0xbe, 0x00, 0xcc, 0x00, 0xdb, 0x00, 0xe6, 0x00,
+  0xf4, 0x00, 0x07, 0x01, 0x15, 0x01, 0x23, 0x01, 0x31, 0x01, 0x3f, 0x01,
+  0x4d, 0x01, 0x5b, 0x01, 0x67, 0x01, 0x75, 0x01, 0x87, 0x01, 0x99, 0x01,
+  0xa4, 0x01, 0xb2, 0x01, 0xc0, 0x01, 0xd7, 0x01, 0xe5, 0x01, 0xf1, 0x01,
+  0x01, 0x02, 0x0f, 0x02, 0x1d, 0x02, 0x2b, 0x02, 0x39, 0x02, 0x00, 0x00,
+  0x23, 0x00, 0x4a, 0x00, 0x63, 0x00, 0x81, 0x00, 0x9c, 0x00, 0xb6, 0x00,
+  0xc0, 0x00, 0xcf, 0x00, 0xde, 0x00, 0xeb, 0x00, 0xf5, 0x00, 0x03, 0x01,
+  0x0f, 0x01, 0x1b, 0x01, 0x26, 0x01, 0x30, 0x01, 0x3c, 0x01, 0x54, 0x01,
+  0x60, 0x01, 0x6d, 0x01, 0x7a, 0x01, 0x89, 0x01, 0x96, 0x01, 0xa2, 0x01,
+  0x00, 0x00, 0x24, 0x00, 0x40, 0x00, 0x60, 0x00, 0x79, 0x00, 0xa0, 0x00,
+  0xb2, 0x00, 0xc9, 0x00, 0xd9, 0x00, 0xe9, 0x00, 0xf5, 0x00, 0x01, 0x01,
+  0x12, 0x01, 0x1e, 0x01, 0x2a, 0x01, 0x36, 0x01, 0x47, 0x01, 0x00, 0x00,
+  0x37, 0x00, 0x57, 0x00, 0x82, 0x00, 0xb7, 0x00, 0xf6, 0x00, 0x06, 0x01,
+  0x1f, 0x01, 0x41, 0x01, 0x51, 0x01, 0x6d, 0x01, 0x7d, 0x01, 0x89, 0x01,
+  0x99, 0x01, 0xa9, 0x01, 0xb9, 0x01, 0xc9, 0x01, 0xd9, 0x01, 0xe9, 0x01,
+  0xf9, 0x01, 0x04, 0x02, 0x14, 0x02, 0x2c, 0x02, 0x3c, 0x02, 0x4c, 0x02,
+  0x5c, 0x02, 0x6a, 0x02, 0x79, 0x02, 0x83, 0x02, 0x8d, 0x02, 0x9d, 0x02,
+  0xaa, 0x02, 0xb4, 0x02, 0x00, 0x00, 0x31, 0x00, 0x6f, 0x00, 0x96, 0x00,
+  0xa8, 0x00, 0xc3, 0x00, 0xe0, 0x00, 0xf7, 0x00, 0x03, 0x01, 0x13, 0x01,
+  0x1f, 0x01, 0x2a, 0x01, 0x36, 0x01, 0x45, 0x01, 0x53, 0x01, 0x62, 0x01,
+  0x6d, 0x01, 0x7f, 0x01, 0x8b, 0x01, 0x96, 0x01, 0xa1, 0x01, 0xac, 0x01,
+  0xb7, 0x01, 0x00, 0x00, 0x24, 0x00, 0x44, 0x00, 0x66, 0x00, 0x74, 0x00,
+  0x8b, 0x00, 0xa8, 0x00, 0xcb, 0x00, 0xd5, 0x00, 0xe7, 0x00, 0xf9, 0x00,
+  0x0b, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x3b, 0x01, 0x4e, 0x01, 0x5c, 0x01,
+  0x69, 0x01, 0x75, 0x01, 0x00, 0x00, 0x22, 0x00, 0x55, 0x00, 0x65, 0x00,
+  0x75, 0x00, 0x9b, 0x00, 0xbc, 0x00, 0xcc, 0x00, 0xda, 0x00, 0x00, 0x00,
+  0x1e, 0x00, 0x52, 0x00, 0x84, 0x00, 0x9b, 0x00, 0xb4, 0x00, 0xcf, 0x00,
+  0xdd, 0x00, 0xe8, 0x00, 0xf2, 0x00, 0xfd, 0x00, 0x12, 0x01, 0x26, 0x01,
+  0x31, 0x01, 0x3d, 0x01, 0x49, 0x01, 0x5a, 0x01, 0x65, 0x01, 0x70, 0x01,
+  0x84, 0x01, 0x8f, 0x01, 0x99, 0x01, 0xa8, 0x01, 0xbc, 0x01, 0xca, 0x01,
+  0xde, 0x01, 0xe8, 0x01, 0x00, 0x00, 0x29, 0x00, 0x4b, 0x00, 0x6d, 0x00,
+  0x93, 0x00, 0xae, 0x00, 0xc9, 0x00, 0xdb, 0x00, 0xf6, 0x00, 0x01, 0x01,
+  0x0f, 0x01, 0x1b, 0x01, 0x26, 0x01, 0x32, 0x01, 0x3c, 0x01, 0x4a, 0x01,
+  0x54, 0x01, 0x00, 0x00, 0x34, 0x00, 0x52, 0x00, 0x85, 0x00, 0xac, 0x00,
+  0xbe, 0x00, 0xd4, 0x00, 0xf1, 0x00, 0xff, 0x00, 0x0b, 0x01, 0x16, 0x01,
+  0x20, 0x01, 0x2c, 0x01, 0x38, 0x01, 0x44, 0x01, 0x4f, 0x01, 0x5b, 0x01,
+  0x67, 0x01, 0x73, 0x01, 0x7f, 0x01, 0x8b, 0x01, 0x97, 0x01, 0xa1, 0x01,
+  0xae, 0x01, 0xba, 0x01, 0xd0, 0x01, 0xde, 0x01, 0xea, 0x01, 0xf4, 0x01,
+  0x01, 0x02, 0x0d, 0x02, 0x18, 0x02, 0x24, 0x02, 0x2e, 0x02, 0x3c, 0x02,
+  0x48, 0x02, 0x5e, 0x02, 0x6a, 0x02, 0x76, 0x02, 0x82, 0x02, 0x8e, 0x02,
+  0x00, 0x00, 0x20, 0x00, 0x42, 0x00, 0x73, 0x00, 0x92, 0x00, 0xa6, 0x00,
+  0xbf, 0x00, 0xd3, 0x00, 0xde, 0x00, 0xec, 0x00, 0xfa, 0x00, 0x05, 0x01,
+  0x11, 0x01, 0x1f, 0x01, 0x2a, 0x01, 0x35, 0x01, 0x41, 0x01, 0x4d, 0x01,
+  0x59, 0x01, 0x65, 0x01, 0x70, 0x01, 0x7c, 0x01, 0x8b, 0x01, 0x98, 0x01,
+  0xa7, 0x01, 0xb3, 0x01, 0xc0, 0x01, 0xce, 0x01, 0xd9, 0x01, 0xe6, 0x01,
+  0xf1, 0x01, 0xfd, 0x01, 0x0b, 0x02, 0x17, 0x02, 0x22, 0x02, 0x2e, 0x02,
+  0x3a, 0x02, 0x47, 0x02, 0x53, 0x02, 0x61, 0x02, 0x6d, 0x02, 0x79, 0x02,
+  0x85, 0x02, 0x91, 0x02, 0x9d, 0x02, 0xa9, 0x02, 0xb6, 0x02, 0xc2, 0x02,
+  0xce, 0x02, 0xdd, 0x02, 0xe9, 0x02, 0xf5, 0x02, 0x01, 0x03, 0x0c, 0x03,
+  0x18, 0x03, 0x24, 0x03, 0x31, 0x03, 0x3c, 0x03, 0x48, 0x03, 0x54, 0x03,
+  0x68, 0x03, 0x79, 0x03, 0x85, 0x03, 0x91, 0x03, 0x9d, 0x03, 0xa8, 0x03,
+  0xb5, 0x03, 0x00, 0x00, 0x22, 0x00, 0x5b, 0x00, 0x7f, 0x00, 0x98, 0x00,
+  0xa8, 0x00, 0xca, 0x00, 0xe7, 0x00, 0xf1, 0x00, 0xfd, 0x00, 0x0b, 0x01,
+  0x17, 0x01, 0x25, 0x01, 0x33, 0x01, 0x41, 0x01, 0x4f, 0x01, 0x5e, 0x01,
+  0x6d, 0x01, 0x7b, 0x01, 0x89, 0x01, 0x97, 0x01, 0xa6, 0x01, 0xb3, 0x01,
+  0xbf, 0x01, 0xce, 0x01, 0xda, 0x01, 0xe5, 0x01, 0xf3, 0x01, 0x01, 0x02,
+  0x10, 0x02, 0x1e, 0x02, 0x2a, 0x02, 0x36, 0x02, 0x44, 0x02, 0x52, 0x02,
+  0x60, 0x02, 0x6f, 0x02, 0x7e, 0x02, 0x8c, 0x02, 0x96, 0x02, 0xa4, 0x02,
+  0xb2, 0x02, 0xc1, 0x02, 0xcb, 0x02, 0xd7, 0x02, 0xe5, 0x02, 0xf3, 0x02,
+  0x01, 0x03, 0x0e, 0x03, 0x1c, 0x03, 0x2a, 0x03, 0x38, 0x03, 0x44, 0x03,
+  0x50, 0x03, 0x5e, 0x03, 0x68, 0x03, 0x77, 0x03, 0x85, 0x03, 0x93, 0x03,
+  0x9f, 0x03, 0xaa, 0x03, 0xb8, 0x03, 0xc6, 0x03, 0xd7, 0x03, 0xe5, 0x03,
+  0xf4, 0x03, 0x02, 0x04, 0x11, 0x04, 0x20, 0x04, 0x2c, 0x04, 0x38, 0x04,
+  0x45, 0x04, 0x53, 0x04, 0x60, 0x04, 0x6e, 0x04, 0x78, 0x04, 0x84, 0x04,
+  0x92, 0x04, 0xa0, 0x04, 0xae, 0x04, 0xbc, 0x04, 0xcb, 0x04, 0xd5, 0x04,
+  0xe4, 0x04, 0xf1, 0x04, 0xfd, 0x04, 0x09, 0x05, 0x15, 0x05, 0x23, 0x05,
+  0x31, 0x05, 0x00, 0x00, 0x26, 0x00, 0x48, 0x00, 0x66, 0x00, 0x84, 0x00,
+  0x9d, 0x00, 0xb8, 0x00, 0xc7, 0x00, 0xd5, 0x00, 0xe3, 0x00, 0xf3, 0x00,
+  0x01, 0x01, 0x0f, 0x01, 0x1d, 0x01, 0x2c, 0x01, 0x3a, 0x01, 0x48, 0x01,
+  0x56, 0x01, 0x61, 0x01, 0x6d, 0x01, 0x7b, 0x01, 0x86, 0x01, 0x94, 0x01,
+  0xa2, 0x01, 0xad, 0x01, 0xbb, 0x01, 0xca, 0x01, 0xd8, 0x01, 0xe6, 0x01,
+  0xf4, 0x01, 0x02, 0x02, 0x0d, 0x02, 0x1b, 0x02, 0x25, 0x02, 0x33, 0x02,
+  0x41, 0x02, 0x50, 0x02, 0x5b, 0x02, 0x69, 0x02, 0x74, 0x02, 0x7f, 0x02,
+  0x8b, 0x02, 0x99, 0x02, 0xa7, 0x02, 0xb2, 0x02, 0xc0, 0x02, 0xce, 0x02,
+  0xd9, 0x02, 0xe5, 0x02, 0xf3, 0x02, 0x01, 0x03, 0x0c, 0x03, 0x1e, 0x03,
+  0x2d, 0x03, 0x36, 0x03, 0x42, 0x03, 0x50, 0x03, 0x5a, 0x03, 0x68, 0x03,
+  0x76, 0x03, 0x7f, 0x03, 0x00, 0x00, 0x43, 0x00, 0x63, 0x00, 0x87, 0x00,
+  0xad, 0x00, 0xcc, 0x00, 0xdc, 0x00, 0xf5, 0x00, 0x1a, 0x01, 0x26, 0x01,
+  0x36, 0x01, 0x47, 0x01, 0x55, 0x01, 0x61, 0x01, 0x6d, 0x01, 0x7e, 0x01,
+  0x8f, 0x01, 0x9b, 0x01, 0xa9, 0x01, 0xba, 0x01, 0xcb, 0x01, 0xd5, 0x01,
+  0xe3, 0x01, 0xf4, 0x01, 0x0a, 0x02, 0x17, 0x02, 0x28, 0x02, 0x36, 0x02,
+  0x44, 0x02, 0x52, 0x02, 0x65, 0x02, 0x76, 0x02, 0x82, 0x02, 0x93, 0x02,
+  0x9c, 0x02, 0xab, 0x02, 0xbf, 0x02, 0xd0, 0x02, 0xde, 0x02, 0xec, 0x02,
+  0xfb, 0x02, 0x0b, 0x03, 0x17, 0x03, 0x26, 0x03, 0x36, 0x03, 0x41, 0x03,
+  0x52, 0x03, 0x5c, 0x03, 0x6d, 0x03, 0x79, 0x03, 0x89, 0x03, 0x9b, 0x03,
+  0xa7, 0x03, 0xb5, 0x03, 0xbe, 0x03, 0xce, 0x03, 0xdc, 0x03, 0xe6, 0x03,
+  0xf7, 0x03, 0x03, 0x04, 0x0f, 0x04, 0x19, 0x04, 0x27, 0x04, 0x31, 0x04,
+  0x3f, 0x04, 0x00, 0x00, 0x24, 0x00, 0x42, 0x00, 0x70, 0x00, 0x80, 0x00,
+  0x92, 0x00, 0x9e, 0x00, 0xab, 0x00, 0xb6, 0x00, 0xc4, 0x00, 0xd4, 0x00,
+  0xe1, 0x00, 0xef, 0x00, 0x00, 0x01, 0x0e, 0x01, 0x1e, 0x01, 0x2a, 0x01,
+  0x38, 0x01, 0x49, 0x01, 0x57, 0x01, 0x64, 0x01, 0x72, 0x01, 0x82, 0x01,
+  0x8e, 0x01, 0x9e, 0x01, 0xac, 0x01, 0xbd, 0x01, 0xce, 0x01, 0xdb, 0x01,
+  0xeb, 0x01, 0xf6, 0x01, 0x01, 0x02, 0x0d, 0x02, 0x1b, 0x02, 0x29, 0x02,
+  0x35, 0x02, 0x45, 0x02, 0x51, 0x02, 0x63, 0x02, 0x74, 0x02, 0x84, 0x02,
+  0x90, 0x02, 0xa0, 0x02, 0xac, 0x02, 0xba, 0x02, 0xc6, 0x02, 0xd1, 0x02,
+  0xdc, 0x02, 0xe7, 0x02, 0xf4, 0x02, 0x05, 0x03, 0x15, 0x03, 0x23, 0x03,
+  0x2f, 0x03, 0x38, 0x03, 0x44, 0x03, 0x50, 0x03, 0x5e, 0x03, 0x67, 0x03,
+  0x73, 0x03, 0x7e, 0x03, 0x89, 0x03, 0x9a, 0x03, 0xab, 0x03, 0x00, 0x00,
+  0x57, 0x00, 0x7b, 0x00, 0x9c, 0x00, 0xb2, 0x00, 0xc6, 0x00, 0xe1, 0x00,
+  0xef, 0x00, 0xfd, 0x00, 0x0d, 0x01, 0x16, 0x01, 0x22, 0x01, 0x32, 0x01,
+  0x40, 0x01, 0x4e, 0x01, 0x5a, 0x01, 0x6d, 0x01, 0x80, 0x01, 0x90, 0x01,
+  0x9b, 0x01, 0xa7, 0x01, 0xb2, 0x01, 0xc2, 0x01, 0xce, 0x01, 0xdc, 0x01,
+  0xe8, 0x01, 0xf6, 0x01, 0x02, 0x02, 0x0e, 0x02, 0x1a, 0x02, 0x2d, 0x02,
+  0x39, 0x02, 0x47, 0x02, 0x5a, 0x02, 0x6a, 0x02, 0x77, 0x02, 0x87, 0x02,
+  0x95, 0x02, 0xa1, 0x02, 0xb4, 0x02, 0xc0, 0x02, 0xd0, 0x02, 0xe1, 0x02,
+  0xf4, 0x02, 0x02, 0x03, 0x0e, 0x03, 0x22, 0x03, 0x2e, 0x03, 0x3b, 0x03,
+  0x4b, 0x03, 0x5e, 0x03, 0x6c, 0x03, 0x7a, 0x03, 0x88, 0x03, 0x96, 0x03,
+  0xa6, 0x03, 0xb4, 0x03, 0xc4, 0x03, 0xd7, 0x03, 0xe7, 0x03, 0xf5, 0x03,
+  0x05, 0x04, 0x13, 0x04, 0x1f, 0x04, 0x2e, 0x04, 0x39, 0x04, 0x4a, 0x04,
+  0x5a, 0x04, 0x68, 0x04, 0x7b, 0x04, 0x89, 0x04, 0x98, 0x04, 0xa6, 0x04,
+  0xb6, 0x04, 0x00, 0x00, 0x26, 0x00, 0x48, 0x00, 0x6c, 0x00, 0x97, 0x00,
+  0xb0, 0x00, 0xbd, 0x00, 0xcf, 0x00, 0xdb, 0x00, 0xe9, 0x00, 0xfb, 0x00,
+  0x09, 0x01, 0x15, 0x01, 0x2e, 0x01, 0x3c, 0x01, 0x4a, 0x01, 0x58, 0x01,
+  0x66, 0x01, 0x75, 0x01, 0x83, 0x01, 0x91, 0x01, 0x9d, 0x01, 0xab, 0x01,
+  0xbe, 0x01, 0xcc, 0x01, 0xd9, 0x01, 0xeb, 0x01, 0xfa, 0x01, 0x08, 0x02,
+  0x12, 0x02, 0x20, 0x02, 0x29, 0x02, 0x36, 0x02, 0x44, 0x02, 0x52, 0x02,
+  0x60, 0x02, 0x72, 0x02, 0x83, 0x02, 0x8c, 0x02, 0x9a, 0x02, 0xab, 0x02,
+  0xb9, 0x02, 0xc7, 0x02, 0xd5, 0x02, 0xe7, 0x02, 0xf7, 0x02, 0x00, 0x00,
+  0x22, 0x00, 0x34, 0x00, 0x5c, 0x00, 0x80, 0x00, 0x8e, 0x00, 0x9a, 0x00,
+  0xa8, 0x00, 0xb5, 0x00, 0xc2, 0x00, 0xd6, 0x00, 0xe4, 0x00, 0xef, 0x00,
+  0xfe, 0x00, 0x0b, 0x01, 0x17, 0x01, 0x24, 0x01, 0x35, 0x01, 0x44, 0x01,
+  0x54, 0x01, 0x60, 0x01, 0x6e, 0x01, 0x7c, 0x01, 0x89, 0x01, 0x9c, 0x01,
+  0xa9, 0x01, 0xb6, 0x01, 0xca, 0x01, 0xdf, 0x01, 0xeb, 0x01, 0xf4, 0x01,
+  0x01, 0x02, 0x10, 0x02, 0x20, 0x02, 0x30, 0x02, 0x45, 0x02, 0x51, 0x02,
+  0x61, 0x02, 0x6e, 0x02, 0x7c, 0x02, 0x88, 0x02, 0x94, 0x02, 0xa2, 0x02,
+  0xaf, 0x02, 0xbd, 0x02, 0xca, 0x02, 0xd5, 0x02, 0xe2, 0x02, 0xee, 0x02,
+  0xf7, 0x02, 0x07, 0x03, 0x1a, 0x03, 0x2c, 0x03, 0x3e, 0x03, 0x50, 0x03,
+  0x00, 0x00, 0x25, 0x00, 0x37, 0x00, 0x54, 0x00, 0x7b, 0x00, 0x8c, 0x00,
+  0x98, 0x00, 0xa4, 0x00, 0xb0, 0x00, 0xbe, 0x00, 0xce, 0x00, 0xdc, 0x00,
+  0xe9, 0x00, 0xfe, 0x00, 0x0c, 0x01, 0x1a, 0x01, 0x29, 0x01, 0x37, 0x01,
+  0x45, 0x01, 0x51, 0x01, 0x60, 0x01, 0x6c, 0x01, 0x78, 0x01, 0x81, 0x01,
+  0x8d, 0x01, 0x9d, 0x01, 0xad, 0x01, 0xbc, 0x01, 0xcc, 0x01, 0xda, 0x01,
+  0xe6, 0x01, 0xef, 0x01, 0xfe, 0x01, 0x07, 0x02, 0x17, 0x02, 0x23, 0x02,
+  0x37, 0x02, 0x48, 0x02, 0x54, 0x02, 0x00, 0x00, 0x1e, 0x00, 0x3f, 0x00,
+  0x5a, 0x00, 0x6a, 0x00, 0x78, 0x00, 0x83, 0x00, 0x94, 0x00, 0xa3, 0x00,
+  0xb6, 0x00, 0xbf, 0x00, 0xcf, 0x00, 0xe1, 0x00, 0xea, 0x00, 0xf8, 0x00,
+  0x09, 0x01, 0x18, 0x01, 0x28, 0x01, 0x38, 0x01, 0x41, 0x01, 0x4f, 0x01,
+  0x5f, 0x01, 0x71, 0x01, 0x82, 0x01, 0x8c, 0x01, 0x9c, 0x01, 0xa8, 0x01,
+  0xb5, 0x01, 0xcb, 0x01, 0xe1, 0x01, 0xf1, 0x01, 0x01, 0x02, 0x00, 0x00,
+  0x10, 0x00, 0x29, 0x00, 0x42, 0x00, 0x64, 0x00, 0x70, 0x00, 0x7e, 0x00,
+  0x8c, 0x00, 0x98, 0x00, 0xa6, 0x00, 0xb2, 0x00, 0xc1, 0x00, 0xcd, 0x00,
+  0xe1, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0x07, 0x01, 0x13, 0x01, 0x1f, 0x01,
+  0x2b, 0x01, 0x39, 0x01, 0x4b, 0x01, 0x57, 0x01, 0x65, 0x01, 0x73, 0x01,
+  0x7e, 0x01, 0x88, 0x01, 0x97, 0x01, 0xa2, 0x01, 0xb4, 0x01, 0xc2, 0x01,
+  0xd3, 0x01, 0xdf, 0x01, 0xef, 0x01, 0xfa, 0x01, 0x00, 0x00, 0x22, 0x00,
+  0x46, 0x00, 0x63, 0x00, 0x75, 0x00, 0x97, 0x00, 0xaa, 0x00, 0xb5, 0x00,
+  0xc7, 0x00, 0xd5, 0x00, 0xe1, 0x00, 0xfa, 0x00, 0x04, 0x01, 0x12, 0x01,
+  0x22, 0x01, 0x2c, 0x01, 0x3d, 0x01, 0x47, 0x01, 0x59, 0x01, 0x65, 0x01,
+  0x78, 0x01, 0x8a, 0x01, 0x97, 0x01, 0xa9, 0x01, 0xbb, 0x01, 0xcd, 0x01,
+  0xdf, 0x01, 0xec, 0x01, 0xfe, 0x01, 0x11, 0x02, 0x22, 0x02, 0x2f, 0x02,
+  0x39, 0x02, 0x4b, 0x02, 0x5d, 0x02, 0x73, 0x02, 0x87, 0x02, 0x94, 0x02,
+  0xa6, 0x02, 0xb5, 0x02, 0xbc, 0x02, 0xce, 0x02, 0x00, 0x00, 0x22, 0x00,
+  0x40, 0x00, 0x60, 0x00, 0x7d, 0x00, 0x8d, 0x00, 0xbf, 0x00, 0xcf, 0x00,
+  0xdb, 0x00, 0xeb, 0x00, 0xf7, 0x00, 0x03, 0x01, 0x13, 0x01, 0x1f, 0x01,
+  0x2b, 0x01, 0x39, 0x01, 0x4d, 0x01, 0x59, 0x01, 0x65, 0x01, 0x71, 0x01,
+  0x00, 0x00, 0x33, 0x00, 0x55, 0x00, 0x86, 0x00, 0x96, 0x00, 0xa6, 0x00,
+  0xd8, 0x00, 0xfc, 0x00, 0x08, 0x01, 0x14, 0x01, 0x22, 0x01, 0x31, 0x01,
+  0x41, 0x01, 0x4f, 0x01, 0x59, 0x01, 0x63, 0x01, 0x6d, 0x01, 0x79, 0x01,
+  0x88, 0x01, 0x92, 0x01, 0x9c, 0x01, 0xa8, 0x01, 0xbe, 0x01, 0xcd, 0x01,
+  0xe1, 0x01, 0xeb, 0x01, 0xf5, 0x01, 0x09, 0x02, 0x14, 0x02, 0x24, 0x02,
+  0x00, 0x00, 0x31, 0x00, 0x53, 0x00, 0x82, 0x00, 0x94, 0x00, 0xb6, 0x00,
+  0xc4, 0x00, 0xce, 0x00, 0xdc, 0x00, 0xea, 0x00, 0xf8, 0x00, 0x07, 0x01,
+  0x13, 0x01, 0x22, 0x01, 0x2d, 0x01, 0x39, 0x01, 0x48, 0x01, 0x57, 0x01,
+  0x62, 0x01, 0x71, 0x01, 0x7f, 0x01, 0x8b, 0x01, 0x96, 0x01, 0xa0, 0x01,
+  0xac, 0x01, 0xbb, 0x01, 0xc6, 0x01, 0x00, 0x00, 0x22, 0x00, 0x3e, 0x00,
+  0x6f, 0x00, 0x7f, 0x00, 0x91, 0x00, 0xa8, 0x00, 0xc3, 0x00, 0xd4, 0x00,
+  0xe6, 0x00, 0xf2, 0x00, 0x06, 0x01, 0x18, 0x01, 0x23, 0x01, 0x2f, 0x01,
+  0x46, 0x01, 0x52, 0x01, 0x5d, 0x01, 0x73, 0x01, 0x00, 0x00, 0x10, 0x00,
+  0x22, 0x00, 0x37, 0x00, 0x6c, 0x00, 0x77, 0x00, 0x82, 0x00, 0x8d, 0x00,
+  0x98, 0x00, 0xaa, 0x00, 0xb5, 0x00, 0xc2, 0x00, 0xcd, 0x00, 0xdb, 0x00,
+  0xe7, 0x00, 0xf3, 0x00, 0x07, 0x01, 0x12, 0x01, 0x1e, 0x01, 0x29, 0x01,
+  0x35, 0x01, 0x00, 0x00, 0x16, 0x00, 0x28, 0x00, 0x4a, 0x00, 0x76, 0x00,
+  0x84, 0x00, 0x92, 0x00, 0xa0, 0x00, 0xab, 0x00, 0xb7, 0x00, 0xc5, 0x00,
+  0xd9, 0x00, 0xf1, 0x00, 0xfb, 0x00, 0x12, 0x01, 0x20, 0x01, 0x2e, 0x01,
+  0x00, 0x00, 0x15, 0x00, 0x2c, 0x00, 0x3a, 0x00, 0x49, 0x00, 0x59, 0x00,
+  0x67, 0x00, 0x75, 0x00, 0x83, 0x00, 0x91, 0x00, 0x9f, 0x00, 0xad, 0x00,
+  0xbb, 0x00, 0xc9, 0x00, 0xd7, 0x00, 0xe5, 0x00, 0xf4, 0x00, 0x02, 0x01,
+  0x10, 0x01, 0x1e, 0x01, 0x2c, 0x01, 0x3a, 0x01, 0x49, 0x01, 0x57, 0x01,
+  0x65, 0x01, 0x70, 0x01, 0x7e, 0x01, 0x8c, 0x01, 0x97, 0x01, 0xa5, 0x01,
+  0xb3, 0x01, 0xc1, 0x01, 0xcf, 0x01, 0xdd, 0x01, 0xeb, 0x01, 0xf5, 0x01,
+  0x03, 0x02, 0x0e, 0x02, 0x1c, 0x02, 0x2a, 0x02, 0x36, 0x02, 0x00, 0x00,
+  0x0e, 0x00, 0x1e, 0x00, 0x2a, 0x00, 0x35, 0x00, 0x41, 0x00, 0x54, 0x00,
+  0x6a, 0x00, 0x7f, 0x00, 0x8b, 0x00, 0x97, 0x00, 0xa2, 0x00, 0xb1, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x29, 0x00, 0x38, 0x00, 0x49, 0x00, 0x5a, 0x00,
+  0x69, 0x00, 0x74, 0x00, 0x84, 0x00, 0x94, 0x00, 0xa9, 0x00, 0xb4, 0x00,
+  0xc5, 0x00, 0xd0, 0x00, 0xe1, 0x00, 0xf2, 0x00, 0xfe, 0x00, 0x09, 0x01,
+  0x17, 0x01, 0x26, 0x01, 0x34, 0x01, 0x43, 0x01, 0x52, 0x01, 0x63, 0x01,
+  0x71, 0x01, 0x00, 0x00, 0x29, 0x00, 0x40, 0x00, 0x4e, 0x00, 0x66, 0x00,
+  0x72, 0x00, 0x80, 0x00, 0x98, 0x00, 0xa3, 0x00, 0xae, 0x00, 0xb9, 0x00,
+  0xd1, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x38, 0x00, 0x5b, 0x00, 0x67, 0x00,
+  0x75, 0x00, 0x83, 0x00, 0x92, 0x00, 0xa3, 0x00, 0xb1, 0x00, 0xbd, 0x00,
+  0xcb, 0x00, 0xd9, 0x00, 0xe7, 0x00, 0xfe, 0x00, 0x0c, 0x01, 0x1b, 0x01,
+  0x2a, 0x01, 0x00, 0x00, 0x20, 0x00, 0x42, 0x00, 0x54, 0x00, 0x62, 0x00,
+  0x70, 0x00, 0x7e, 0x00, 0x8b, 0x00, 0x9c, 0x00, 0xaa, 0x00, 0xc4, 0x00,
+  0xd2, 0x00, 0xe0, 0x00, 0xee, 0x00, 0xfb, 0x00, 0x0a, 0x01, 0x17, 0x01,
+  0x00, 0x00, 0x22, 0x00, 0x36, 0x00, 0x44, 0x00, 0x50, 0x00, 0x5e, 0x00,
+  0x6c, 0x00, 0x7c, 0x00, 0x88, 0x00, 0x94, 0x00, 0xa2, 0x00, 0xb0, 0x00,
+  0x00, 0x00, 0x22, 0x00, 0x34, 0x00, 0x44, 0x00, 0x54, 0x00, 0x64, 0x00,
+  0x74, 0x00, 0x8c, 0x00, 0x97, 0x00, 0xa6, 0x00, 0xb6, 0x00, 0xc6, 0x00,
+  0xd9, 0x00, 0xe9, 0x00, 0xf9, 0x00, 0x09, 0x01, 0x19, 0x01, 0x29, 0x01,
+  0x39, 0x01, 0x49, 0x01, 0x59, 0x01, 0x69, 0x01, 0x79, 0x01, 0x8a, 0x01,
+  0x9a, 0x01, 0x00, 0x00, 0x2b, 0x00, 0x48, 0x00, 0x5e, 0x00, 0x6a, 0x00,
+  0x7b, 0x00, 0x8b, 0x00, 0x97, 0x00, 0xa1, 0x00, 0xad, 0x00, 0xb9, 0x00,
+  0xcc, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x3e, 0x00, 0x54, 0x00, 0x66, 0x00,
+  0x72, 0x00, 0x80, 0x00, 0x92, 0x00, 0xa4, 0x00, 0xb7, 0x00, 0xc7, 0x00,
+  0xd3, 0x00, 0xe5, 0x00, 0xf4, 0x00, 0xff, 0x00, 0x00, 0x00, 0x24, 0x00,
+  0x34, 0x00, 0x6e, 0x00, 0x7b, 0x00, 0x87, 0x00, 0x93, 0x00, 0x9f, 0x00,
+  0xab, 0x00, 0xb7, 0x00, 0xc6, 0x00, 0xd2, 0x00, 0xdf, 0x00, 0xeb, 0x00,
+  0xfb, 0x00, 0x07, 0x01, 0x13, 0x01, 0x1f, 0x01, 0x2b, 0x01, 0x38, 0x01,
+  0x46, 0x01, 0x52, 0x01, 0x5e, 0x01, 0x6a, 0x01, 0x76, 0x01, 0x85, 0x01,
+  0x91, 0x01, 0x9f, 0x01, 0xab, 0x01, 0xb7, 0x01, 0xc6, 0x01, 0xd2, 0x01,
+  0xde, 0x01, 0xea, 0x01, 0x00, 0x00, 0x1d, 0x00, 0x4d, 0x00, 0x60, 0x00,
+  0x6a, 0x00, 0x76, 0x00, 0x81, 0x00, 0x8d, 0x00, 0xa0, 0x00, 0xaa, 0x00,
+  0xb4, 0x00, 0xbf, 0x00, 0xc9, 0x00, 0xd4, 0x00, 0xde, 0x00, 0xe8, 0x00,
+  0xf2, 0x00, 0x06, 0x01, 0x00, 0x00, 0x1e, 0x00, 0x42, 0x00, 0x5b, 0x00,
+  0x69, 0x00, 0x77, 0x00, 0x82, 0x00, 0x90, 0x00, 0x9e, 0x00, 0xac, 0x00,
+  0xba, 0x00, 0xc5, 0x00, 0xd0, 0x00, 0xde, 0x00, 0xe9, 0x00, 0xf7, 0x00,
+  0x02, 0x01, 0x16, 0x01, 0x24, 0x01, 0x2f, 0x01, 0x3f, 0x01, 0x49, 0x01,
+  0x54, 0x01, 0x62, 0x01, 0x6e, 0x01, 0x7c, 0x01, 0x8a, 0x01, 0x96, 0x01,
+  0xa4, 0x01, 0xb2, 0x01, 0xc0, 0x01, 0xca, 0x01, 0xd8, 0x01, 0xe5, 0x01,
+  0xf3, 0x01, 0xfd, 0x01, 0x0b, 0x02, 0x16, 0x02, 0x24, 0x02, 0x32, 0x02,
+  0x3d, 0x02, 0x4b, 0x02, 0x5a, 0x02, 0x68, 0x02, 0x76, 0x02, 0x84, 0x02,
+  0x8f, 0x02, 0x9d, 0x02, 0xa9, 0x02, 0xb5, 0x02, 0xbf, 0x02, 0xcc, 0x02,
+  0xda, 0x02, 0xe7, 0x02, 0xf6, 0x02, 0x00, 0x03, 0x0e, 0x03, 0x1c, 0x03,
+  0x2a, 0x03, 0x36, 0x03, 0x00, 0x00, 0x33, 0x00, 0x4c, 0x00, 0x72, 0x00,
+  0x7c, 0x00, 0x86, 0x00, 0x91, 0x00, 0x9d, 0x00, 0xab, 0x00, 0xb6, 0x00,
+  0xc1, 0x00, 0xcd, 0x00, 0xd8, 0x00, 0xe3, 0x00, 0xf8, 0x00, 0x04, 0x01,
+  0x12, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x34, 0x01, 0x40, 0x01, 0x4b, 0x01,
+  0x56, 0x01, 0x63, 0x01, 0x6f, 0x01, 0x7b, 0x01, 0x85, 0x01, 0x92, 0x01,
+  0x9e, 0x01, 0xb3, 0x01, 0xbf, 0x01, 0xca, 0x01, 0xd4, 0x01, 0xde, 0x01,
+  0xea, 0x01, 0xf4, 0x01, 0x09, 0x02, 0x15, 0x02, 0x1f, 0x02, 0x2d, 0x02,
+  0x37, 0x02, 0x44, 0x02, 0x4e, 0x02, 0x00, 0x00, 0x22, 0x00, 0x39, 0x00,
+  0x61, 0x00, 0x6b, 0x00, 0x7a, 0x00, 0x86, 0x00, 0x97, 0x00, 0xa3, 0x00,
+  0xb4, 0x00, 0xc0, 0x00, 0xd0, 0x00, 0xdc, 0x00, 0xe8, 0x00, 0xf3, 0x00,
+  0x01, 0x01, 0x0c, 0x01, 0x17, 0x01, 0x26, 0x01, 0x32, 0x01, 0x40, 0x01,
+  0x4c, 0x01, 0x59, 0x01, 0x65, 0x01, 0x71, 0x01, 0x7c, 0x01, 0x88, 0x01,
+  0x9f, 0x01, 0xaf, 0x01, 0xba, 0x01, 0xc6, 0x01, 0xd3, 0x01, 0xdf, 0x01,
+  0xef, 0x01, 0xff, 0x01, 0x0b, 0x02, 0x18, 0x02, 0x24, 0x02, 0x30, 0x02,
+  0x3d, 0x02, 0x4d, 0x02, 0x5d, 0x02, 0x69, 0x02, 0x74, 0x02, 0x7f, 0x02,
+  0x8f, 0x02, 0x9e, 0x02, 0xae, 0x02, 0xb9, 0x02, 0xc7, 0x02, 0xd5, 0x02,
+  0xe2, 0x02, 0xee, 0x02, 0xf9, 0x02, 0x05, 0x03, 0x11, 0x03, 0x21, 0x03,
+  0x2e, 0x03, 0x3a, 0x03, 0x4a, 0x03, 0x56, 0x03, 0x61, 0x03, 0x71, 0x03,
+  0x7d, 0x03, 0x89, 0x03, 0x94, 0x03, 0xa4, 0x03, 0xb0, 0x03, 0xc0, 0x03,
+  0xcc, 0x03, 0xdb, 0x03, 0xe7, 0x03, 0x00, 0x00, 0x20, 0x00, 0x43, 0x00,
+  0x65, 0x00, 0x80, 0x00, 0x96, 0x00, 0xa4, 0x00, 0xb0, 0x00, 0xbe, 0x00,
+  0xcb, 0x00, 0xd7, 0x00, 0xe6, 0x00, 0xf4, 0x00, 0x02, 0x01, 0x11, 0x01,
+  0x20, 0x01, 0x2e, 0x01, 0x3c, 0x01, 0x4a, 0x01, 0x59, 0x01, 0x68, 0x01,
+  0x75, 0x01, 0x83, 0x01, 0x91, 0x01, 0x9f, 0x01, 0xab, 0x01, 0xb6, 0x01,
+  0xc1, 0x01, 0xcf, 0x01, 0xda, 0x01, 0xe8, 0x01, 0xf4, 0x01, 0x02, 0x02,
+  0x0f, 0x02, 0x1d, 0x02, 0x29, 0x02, 0x35, 0x02, 0x42, 0x02, 0x4e, 0x02,
+  0x5b, 0x02, 0x68, 0x02, 0x76, 0x02, 0x81, 0x02, 0x8e, 0x02, 0x9c, 0x02,
+  0xa8, 0x02, 0xb7, 0x02, 0xc3, 0x02, 0xcf, 0x02, 0xdc, 0x02, 0xe6, 0x02,
+  0xf5, 0x02, 0x03, 0x03, 0x0d, 0x03, 0x1b, 0x03, 0x27, 0x03, 0x31, 0x03,
+  0x40, 0x03, 0x4f, 0x03, 0x5d, 0x03, 0x69, 0x03, 0x77, 0x03, 0x85, 0x03,
+  0x93, 0x03, 0x9e, 0x03, 0xad, 0x03, 0xb7, 0x03, 0xc4, 0x03, 0xd2, 0x03,
+  0xe0, 0x03, 0xec, 0x03, 0xfa, 0x03, 0x08, 0x04, 0x17, 0x04, 0x26, 0x04,
+  0x30, 0x04, 0x3e, 0x04, 0x4a, 0x04, 0x58, 0x04, 0x62, 0x04, 0x70, 0x04,
+  0x7e, 0x04, 0x8a, 0x04, 0x98, 0x04, 0xa2, 0x04, 0xb0, 0x04, 0xbc, 0x04,
+  0xc8, 0x04, 0xd2, 0x04, 0xe0, 0x04, 0xec, 0x04, 0xf6, 0x04, 0x04, 0x05,
+  0x0f, 0x05, 0x19, 0x05, 0x23, 0x05, 0x2f, 0x05, 0x3d, 0x05, 0x4b, 0x05,
+  0x57, 0x05, 0x63, 0x05, 0x6f, 0x05, 0x7e, 0x05, 0x88, 0x05, 0x96, 0x05,
+  0x00, 0x00, 0x20, 0x00, 0x2e, 0x00, 0x44, 0x00, 0x52, 0x00, 0x60, 0x00,
+  0x6e, 0x00, 0x7c, 0x00, 0x8b, 0x00, 0x9b, 0x00, 0xa9, 0x00, 0xb7, 0x00,
+  0xc5, 0x00, 0xd3, 0x00, 0xe2, 0x00, 0xf0, 0x00, 0xff, 0x00, 0x0d, 0x01,
+  0x1c, 0x01, 0x2a, 0x01, 0x35, 0x01, 0x43, 0x01, 0x51, 0x01, 0x5e, 0x01,
+  0x73, 0x01, 0x81, 0x01, 0x8f, 0x01, 0x9b, 0x01, 0xaa, 0x01, 0xb8, 0x01,
+  0xc6, 0x01, 0xd4, 0x01, 0xe2, 0x01, 0xf1, 0x01, 0xff, 0x01, 0x11, 0x02,
+  0x1f, 0x02, 0x2d, 0x02, 0x3b, 0x02, 0x49, 0x02, 0x57, 0x02, 0x65, 0x02,
+  0x73, 0x02, 0x85, 0x02, 0x91, 0x02, 0x9d, 0x02, 0xab, 0x02, 0xbd, 0x02,
+  0xcd, 0x02, 0xd8, 0x02, 0xe8, 0x02, 0xf6, 0x02, 0x02, 0x03, 0x11, 0x03,
+  0x1e, 0x03, 0x33, 0x03, 0x41, 0x03, 0x4f, 0x03, 0x5e, 0x03, 0x69, 0x03,
+  0x7a, 0x03, 0x88, 0x03, 0x96, 0x03, 0x00, 0x00, 0x22, 0x00, 0x4a, 0x00,
+  0x6a, 0x00, 0x7c, 0x00, 0x8d, 0x00, 0x9b, 0x00, 0xa9, 0x00, 0xb5, 0x00,
+  0xc3, 0x00, 0xcd, 0x00, 0xd9, 0x00, 0xe6, 0x00, 0xf7, 0x00, 0x04, 0x01,
+  0x10, 0x01, 0x1d, 0x01, 0x2a, 0x01, 0x3b, 0x01, 0x4c, 0x01, 0x5a, 0x01,
+  0x66, 0x01, 0x77, 0x01, 0x83, 0x01, 0x94, 0x01, 0xa2, 0x01, 0xb2, 0x01,
+  0xbe, 0x01, 0xcf, 0x01, 0xdf, 0x01, 0xf0, 0x01, 0xfe, 0x01, 0x0e, 0x02,
+  0x1a, 0x02, 0x26, 0x02, 0x31, 0x02, 0x42, 0x02, 0x50, 0x02, 0x5f, 0x02,
+  0x6d, 0x02, 0x79, 0x02, 0x88, 0x02, 0x96, 0x02, 0xa2, 0x02, 0xae, 0x02,
+  0xb8, 0x02, 0xc7, 0x02, 0xd8, 0x02, 0x00, 0x00, 0x2b, 0x00, 0x36, 0x00,
+  0x4e, 0x00, 0x5e, 0x00, 0x6e, 0x00, 0x7e, 0x00, 0x8e, 0x00, 0x9b, 0x00,
+  0xab, 0x00, 0xb7, 0x00, 0xc3, 0x00, 0xd1, 0x00, 0xe1, 0x00, 0xf2, 0x00,
+  0xfd, 0x00, 0x09, 0x01, 0x15, 0x01, 0x21, 0x01, 0x2e, 0x01, 0x3a, 0x01,
+  0x46, 0x01, 0x51, 0x01, 0x5d, 0x01, 0x69, 0x01, 0x73, 0x01, 0x7f, 0x01,
+  0x8e, 0x01, 0x9a, 0x01, 0xaa, 0x01, 0xb7, 0x01, 0xc3, 0x01, 0xd3, 0x01,
+  0xe1, 0x01, 0xed, 0x01, 0x05, 0x02, 0x11, 0x02, 0x1d, 0x02, 0x2b, 0x02,
+  0x3b, 0x02, 0x4c, 0x02, 0x55, 0x02, 0x61, 0x02, 0x72, 0x02, 0x7d, 0x02,
+  0x8a, 0x02, 0x96, 0x02, 0xa2, 0x02, 0xb0, 0x02, 0xc0, 0x02, 0xd1, 0x02,
+  0xe1, 0x02, 0xf0, 0x02, 0x00, 0x00, 0x29, 0x00, 0x3a, 0x00, 0x4d, 0x00,
+  0x5b, 0x00, 0x6c, 0x00, 0x78, 0x00, 0x86, 0x00, 0x92, 0x00, 0xa0, 0x00,
+  0xb0, 0x00, 0xbe, 0x00, 0xd0, 0x00, 0xe0, 0x00, 0xec, 0x00, 0xf6, 0x00,
+  0x03, 0x01, 0x0f, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x37, 0x01, 0x45, 0x01,
+  0x55, 0x01, 0x66, 0x01, 0x76, 0x01, 0x84, 0x01, 0x8e, 0x01, 0x9a, 0x01,
+  0xaa, 0x01, 0xbb, 0x01, 0xc9, 0x01, 0xd4, 0x01, 0xe5, 0x01, 0xfe, 0x01,
+  0x09, 0x02, 0x14, 0x02, 0x25, 0x02, 0x31, 0x02, 0x3b, 0x02, 0x49, 0x02,
+  0x57, 0x02, 0x63, 0x02, 0x6f, 0x02, 0x81, 0x02, 0x8a, 0x02, 0x96, 0x02,
+  0xa7, 0x02, 0xb5, 0x02, 0xc3, 0x02, 0xd4, 0x02, 0xe4, 0x02, 0xf4, 0x02,
+  0xff, 0x02, 0x0f, 0x03, 0x1f, 0x03, 0x30, 0x03, 0x3c, 0x03, 0x46, 0x03,
+  0x56, 0x03, 0x62, 0x03, 0x00, 0x00, 0x20, 0x00, 0x3c, 0x00, 0x4a, 0x00,
+  0x58, 0x00, 0x66, 0x00, 0x75, 0x00, 0x7f, 0x00, 0x8e, 0x00, 0xa0, 0x00,
+  0xaa, 0x00, 0xb8, 0x00, 0xc6, 0x00, 0xd1, 0x00, 0xdf, 0x00, 0xe9, 0x00,
+  0xfc, 0x00, 0x08, 0x01, 0x13, 0x01, 0x1f, 0x01, 0x33, 0x01, 0x3e, 0x01,
+  0x48, 0x01, 0x5c, 0x01, 0x6e, 0x01, 0x7c, 0x01, 0x90, 0x01, 0x9a, 0x01,
+  0xae, 0x01, 0xc2, 0x01, 0xcc, 0x01, 0xd8, 0x01, 0xe3, 0x01, 0xed, 0x01,
+  0x01, 0x02, 0x0f, 0x02, 0x1e, 0x02, 0x2a, 0x02, 0x38, 0x02, 0x46, 0x02,
+  0x50, 0x02, 0x60, 0x02, 0x74, 0x02, 0x84, 0x02, 0x8e, 0x02, 0x98, 0x02,
+  0xa7, 0x02, 0xb1, 0x02, 0xbb, 0x02, 0xca, 0x02, 0xd8, 0x02, 0xe3, 0x02,
+  0xed, 0x02, 0x00, 0x00, 0x1e, 0x00, 0x3a, 0x00, 0x5c, 0x00, 0x6b, 0x00,
+  0x7e, 0x00, 0x91, 0x00, 0x9f, 0x00, 0xad, 0x00, 0xbd, 0x00, 0xc7, 0x00,
+  0xd8, 0x00, 0xe2, 0x00, 0xef, 0x00, 0xfe, 0x00, 0x09, 0x01, 0x15, 0x01,
+  0x22, 0x01, 0x2e, 0x01, 0x3c, 0x01, 0x4a, 0x01, 0x5a, 0x01, 0x6e, 0x01,
+  0x7b, 0x01, 0x89, 0x01, 0x99, 0x01, 0xa7, 0x01, 0xb1, 0x01, 0xbf, 0x01,
+  0xcd, 0x01, 0xe0, 0x01, 0xea, 0x01, 0xf8, 0x01, 0x05, 0x02, 0x11, 0x02,
+  0x1e, 0x02, 0x2a, 0x02, 0x37, 0x02, 0x40, 0x02, 0x52, 0x02, 0x60, 0x02,
+  0x6d, 0x02, 0x7c, 0x02, 0x00, 0x00, 0x2d, 0x00, 0x3b, 0x00, 0x4a, 0x00,
+  0x58, 0x00, 0x64, 0x00, 0x75, 0x00, 0x81, 0x00, 0x91, 0x00, 0xa5, 0x00,
+  0xb1, 0x00, 0xc2, 0x00, 0xce, 0x00, 0xde, 0x00, 0xef, 0x00, 0xfd, 0x00,
+  0x0a, 0x01, 0x18, 0x01, 0x24, 0x01, 0x30, 0x01, 0x3d, 0x01, 0x4b, 0x01,
+  0x5c, 0x01, 0x6a, 0x01, 0x78, 0x01, 0x89, 0x01, 0x95, 0x01, 0xa3, 0x01,
+  0xb1, 0x01, 0xc1, 0x01, 0xcd, 0x01, 0xdb, 0x01, 0xec, 0x01, 0xfa, 0x01,
+  0x0b, 0x02, 0x17, 0x02, 0x24, 0x02, 0x32, 0x02, 0x42, 0x02, 0x52, 0x02,
+  0x60, 0x02, 0x69, 0x02, 0x79, 0x02, 0x89, 0x02, 0x92, 0x02, 0x00, 0x00,
+  0x29, 0x00, 0x4b, 0x00, 0x6f, 0x00, 0x7b, 0x00, 0x89, 0x00, 0x94, 0x00,
+  0xa6, 0x00, 0xb6, 0x00, 0xc3, 0x00, 0xd3, 0x00, 0xe3, 0x00, 0xfb, 0x00,
+  0x0f, 0x01, 0x1c, 0x01, 0x2a, 0x01, 0x3d, 0x01, 0x4d, 0x01, 0x5f, 0x01,
+  0x73, 0x01, 0x7f, 0x01, 0x96, 0x01, 0xa4, 0x01, 0xb4, 0x01, 0xca, 0x01,
+  0xda, 0x01, 0xea, 0x01, 0xff, 0x01, 0x12, 0x02, 0x26, 0x02, 0x36, 0x02,
+  0x48, 0x02, 0x5c, 0x02, 0x68, 0x02, 0x77, 0x02, 0x86, 0x02, 0x9c, 0x02,
+  0xa7, 0x02, 0xb7, 0x02, 0xc5, 0x02, 0xd7, 0x02, 0xe1, 0x02, 0xea, 0x02,
+  0xfa, 0x02, 0x07, 0x03, 0x17, 0x03, 0x00, 0x00, 0x2b, 0x00, 0x54, 0x00,
+  0x61, 0x00, 0x6d, 0x00, 0x7c, 0x00, 0x8b, 0x00, 0x96, 0x00, 0xa4, 0x00,
+  0xaf, 0x00, 0xba, 0x00, 0xc6, 0x00, 0xd5, 0x00, 0xe4, 0x00, 0xf0, 0x00,
+  0xfb, 0x00, 0x0d, 0x01, 0x18, 0x01, 0x26, 0x01, 0x35, 0x01, 0x44, 0x01,
+  0x50, 0x01, 0x5e, 0x01, 0x6c, 0x01, 0x7b, 0x01, 0x87, 0x01, 0x97, 0x01,
+  0xa3, 0x01, 0xad, 0x01, 0xbb, 0x01, 0xc5, 0x01, 0xd4, 0x01, 0xe2, 0x01,
+  0xef, 0x01, 0xfd, 0x01, 0x0d, 0x02, 0x19, 0x02, 0x29, 0x02, 0x37, 0x02,
+  0x4f, 0x02, 0x5a, 0x02, 0x6c, 0x02, 0x7e, 0x02, 0x88, 0x02, 0x96, 0x02,
+  0xa0, 0x02, 0xb2, 0x02, 0xc2, 0x02, 0x00, 0x00, 0x1c, 0x00, 0x38, 0x00,
+  0x4b, 0x00, 0x5a, 0x00, 0x6c, 0x00, 0x7f, 0x00, 0x91, 0x00, 0xa3, 0x00,
+  0xb3, 0x00, 0xbf, 0x00, 0xcc, 0x00, 0xde, 0x00, 0xf0, 0x00, 0xfe, 0x00,
+  0x10, 0x01, 0x22, 0x01, 0x34, 0x01, 0x41, 0x01, 0x4e, 0x01, 0x60, 0x01,
+  0x70, 0x01, 0x00, 0x00, 0x26, 0x00, 0x44, 0x00, 0x5d, 0x00, 0x69, 0x00,
+  0x77, 0x00, 0x85, 0x00, 0x95, 0x00, 0xac, 0x00, 0xb9, 0x00, 0xcd, 0x00,
+  0xd9, 0x00, 0xe7, 0x00, 0xf3, 0x00, 0xff, 0x00, 0x0b, 0x01, 0x18, 0x01,
+  0x26, 0x01, 0x34, 0x01, 0x40, 0x01, 0x4e, 0x01, 0x5a, 0x01, 0x6a, 0x01,
+  0x76, 0x01, 0x84, 0x01, 0x90, 0x01, 0x00, 0x00, 0x5c, 0x00, 0x7e, 0x00,
+  0x95, 0x00, 0xae, 0x00, 0xbc, 0x00, 0xca, 0x00, 0xdc, 0x00, 0xe8, 0x00,
+  0xfc, 0x00, 0x0b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3f, 0x01, 0x4a, 0x01,
+  0x55, 0x01, 0x69, 0x01, 0x74, 0x01, 0x00, 0x00, 0x0e, 0x00, 0x1c, 0x00,
+  0x2a, 0x00, 0x38, 0x00, 0x47, 0x00, 0x53, 0x00, 0x63, 0x00, 0x71, 0x00,
+  0x80, 0x00, 0x8c, 0x00, 0x96, 0x00, 0xa4, 0x00, 0xb2, 0x00, 0xc0, 0x00,
+  0xce, 0x00, 0xd9, 0x00, 0xe7, 0x00, 0xf9, 0x00, 0x08, 0x01, 0x18, 0x01,
+  0x28, 0x01, 0x36, 0x01, 0x40, 0x01, 0x4c, 0x01, 0x00, 0x00, 0x10, 0x00,
+  0x20, 0x00, 0x39, 0x00, 0x49, 0x00, 0x57, 0x00, 0x65, 0x00, 0x77, 0x00,
+  0x87, 0x00, 0x93, 0x00, 0xa5, 0x00, 0x00, 0x00, 0x13, 0x00, 0x1e, 0x00,
+  0x2e, 0x00, 0x3c, 0x00, 0x4a, 0x00, 0x5b, 0x00, 0x68, 0x00, 0x74, 0x00,
+  0x84, 0x00, 0x8f, 0x00, 0x9a, 0x00, 0xa5, 0x00, 0xb0, 0x00, 0xbe, 0x00,
+  0xce, 0x00, 0xda, 0x00, 0xea, 0x00, 0xf6, 0x00, 0x01, 0x01, 0x11, 0x01,
+  0x1a, 0x01, 0x28, 0x01, 0x35, 0x01, 0x43, 0x01, 0x55, 0x01, 0x62, 0x01,
+  0x6e, 0x01, 0x79, 0x01, 0x89, 0x01, 0x97, 0x01, 0xa2, 0x01, 0xb3, 0x01,
+  0xc0, 0x01, 0xcc, 0x01, 0xda, 0x01, 0xe6, 0x01, 0x00, 0x00, 0x0e, 0x00,
+  0x1c, 0x00, 0x26, 0x00, 0x33, 0x00, 0x3d, 0x00, 0x4b, 0x00, 0x57, 0x00,
+  0x61, 0x00, 0x6b, 0x00, 0x79, 0x00, 0x85, 0x00, 0x98, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x1c, 0x00, 0x2a, 0x00, 0x38, 0x00, 0x46, 0x00, 0x54, 0x00,
+  0x62, 0x00, 0x70, 0x00, 0x7e, 0x00, 0x8c, 0x00, 0x9a, 0x00, 0xa8, 0x00,
+  0xb4, 0x00, 0xc3, 0x00, 0xcf, 0x00, 0xdd, 0x00, 0xeb, 0x00, 0xf8, 0x00,
+  0x06, 0x01, 0x14, 0x01, 0x22, 0x01, 0x30, 0x01, 0x3e, 0x01, 0x4c, 0x01,
+  0x5a, 0x01, 0x68, 0x01, 0x74, 0x01, 0x7f, 0x01, 0x96, 0x01, 0xa4, 0x01,
+  0xb3, 0x01, 0xc1, 0x01, 0xcf, 0x01, 0xe1, 0x01, 0xef, 0x01, 0x04, 0x02,
+  0x12, 0x02, 0x20, 0x02, 0x2e, 0x02, 0x41, 0x02, 0x4f, 0x02, 0x5d, 0x02,
+  0x6b, 0x02, 0x7b, 0x02, 0x89, 0x02, 0x97, 0x02, 0x00, 0x00, 0x0f, 0x00,
+  0x1d, 0x00, 0x28, 0x00, 0x42, 0x00, 0x4e, 0x00, 0x59, 0x00, 0x67, 0x00,
+  0x76, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x1d, 0x00, 0x28, 0x00, 0x3a, 0x00,
+  0x4b, 0x00, 0x56, 0x00, 0x66, 0x00, 0x76, 0x00, 0x86, 0x00, 0x96, 0x00,
+  0xa2, 0x00, 0xae, 0x00, 0xba, 0x00, 0xca, 0x00, 0xd6, 0x00, 0xe2, 0x00,
+  0xf3, 0x00, 0xff, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x1c, 0x00, 0x2f, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x1c, 0x00, 0x2b, 0x00, 0x37, 0x00, 0x45, 0x00,
+  0x5c, 0x00, 0x68, 0x00, 0x77, 0x00, 0x85, 0x00, 0x93, 0x00, 0xa1, 0x00,
+  0xb3, 0x00, 0xc1, 0x00, 0xce, 0x00, 0xd9, 0x00, 0xe7, 0x00, 0xf5, 0x00,
+  0x04, 0x01, 0x00, 0x00, 0x0e, 0x00, 0x19, 0x00, 0x27, 0x00, 0x35, 0x00,
+  0x43, 0x00, 0x51, 0x00, 0x65, 0x00, 0x72, 0x00, 0x7e, 0x00, 0x88, 0x00,
+  0x96, 0x00, 0xa3, 0x00, 0xb2, 0x00, 0xbf, 0x00, 0xcc, 0x00, 0xda, 0x00,
+  0xe7, 0x00, 0xf5, 0x00, 0x02, 0x01, 0x0c, 0x01, 0x00, 0x00, 0x10, 0x00,
+  0x1c, 0x00, 0x28, 0x00, 0x34, 0x00, 0x45, 0x00, 0x51, 0x00, 0x5d, 0x00,
+  0x6e, 0x00, 0x7a, 0x00, 0x86, 0x00, 0x00, 0x00, 0x10, 0x00, 0x20, 0x00,
+  0x30, 0x00, 0x40, 0x00, 0x4b, 0x00, 0x5b, 0x00, 0x67, 0x00, 0x74, 0x00,
+  0x80, 0x00, 0x8d, 0x00, 0x98, 0x00, 0xa8, 0x00, 0xb4, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x14, 0x00, 0x1e, 0x00, 0x2a, 0x00, 0x34, 0x00, 0x40, 0x00,
+  0x4a, 0x00, 0x54, 0x00, 0x5e, 0x00, 0x68, 0x00, 0x73, 0x00, 0x7e, 0x00,
+  0x8a, 0x00, 0x94, 0x00, 0x9e, 0x00, 0xaa, 0x00, 0xb4, 0x00, 0xbe, 0x00,
+  0xca, 0x00, 0xd6, 0x00, 0xe1, 0x00, 0xeb, 0x00, 0xf6, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x26, 0x00, 0x38, 0x00, 0x4a, 0x00, 0x54, 0x00, 0x60, 0x00,
+  0x6d, 0x00, 0x77, 0x00, 0x89, 0x00, 0x93, 0x00, 0xa5, 0x00, 0xb7, 0x00,
+  0xc0, 0x00, 0xd2, 0x00, 0xe4, 0x00, 0xf6, 0x00, 0x08, 0x01, 0x16, 0x01,
+  0x21, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x19, 0x00, 0x25, 0x00, 0x31, 0x00,
+  0x3d, 0x00, 0x49, 0x00, 0x55, 0x00, 0x63, 0x00, 0x6f, 0x00, 0x7b, 0x00,
+  0x8b, 0x00, 0x97, 0x00, 0xa0, 0x00, 0xac, 0x00, 0xbb, 0x00, 0xc7, 0x00,
+  0xd3, 0x00, 0xdf, 0x00, 0xe8, 0x00, 0xf5, 0x00, 0x00, 0x00, 0x0f, 0x00,
+  0x1f, 0x00, 0x29, 0x00, 0x39, 0x00, 0x49, 0x00, 0x5d, 0x00, 0x6e, 0x00,
+  0x78, 0x00, 0x84, 0x00, 0x91, 0x00, 0xa1, 0x00, 0xb2, 0x00, 0xbe, 0x00,
+  0xd2, 0x00, 0xdd, 0x00, 0xee, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1b, 0x00,
+  0x28, 0x00, 0x36, 0x00, 0x43, 0x00, 0x4f, 0x00, 0x60, 0x00, 0x6e, 0x00,
+  0x7c, 0x00, 0x8a, 0x00, 0x95, 0x00, 0xa3, 0x00, 0xb1, 0x00, 0xbf, 0x00,
+  0xcd, 0x00, 0xdb, 0x00, 0xe7, 0x00, 0xf4, 0x00, 0x02, 0x01, 0x10, 0x01,
+  0x1e, 0x01, 0x2c, 0x01, 0x3a, 0x01, 0x45, 0x01, 0x54, 0x01, 0x60, 0x01,
+  0x6a, 0x01, 0x78, 0x01, 0x80, 0x01, 0x8a, 0x01, 0x97, 0x01, 0xa5, 0x01,
+  0xb1, 0x01, 0xbd, 0x01, 0xca, 0x01, 0xd6, 0x01, 0xe2, 0x01, 0xf0, 0x01,
+  0xfc, 0x01, 0x0a, 0x02, 0x18, 0x02, 0x00, 0x00, 0x0c, 0x00, 0x18, 0x00,
+  0x22, 0x00, 0x34, 0x00, 0x40, 0x00, 0x52, 0x00, 0x65, 0x00, 0x71, 0x00,
+  0x7d, 0x00, 0x8f, 0x00, 0x9d, 0x00, 0xaa, 0x00, 0xb8, 0x00, 0xca, 0x00,
+  0xd6, 0x00, 0xe1, 0x00, 0xed, 0x00, 0xf9, 0x00, 0x05, 0x01, 0x0f, 0x01,
+  0x1b, 0x01, 0x27, 0x01, 0x35, 0x01, 0x41, 0x01, 0x4c, 0x01, 0x58, 0x01,
+  0x63, 0x01, 0x6f, 0x01, 0x7b, 0x01, 0x8a, 0x01, 0x98, 0x01, 0xab, 0x01,
+  0xb7, 0x01, 0xc3, 0x01, 0xcc, 0x01, 0x00, 0x00, 0x11, 0x00, 0x1c, 0x00,
+  0x2c, 0x00, 0x37, 0x00, 0x42, 0x00, 0x50, 0x00, 0x5b, 0x00, 0x6b, 0x00,
+  0x79, 0x00, 0x85, 0x00, 0x90, 0x00, 0x9c, 0x00, 0xad, 0x00, 0xb9, 0x00,
+  0xc4, 0x00, 0xd0, 0x00, 0xe0, 0x00, 0xeb, 0x00, 0xfc, 0x00, 0x0c, 0x01,
+  0x18, 0x01, 0x24, 0x01, 0x2d, 0x01, 0x39, 0x01, 0x44, 0x01, 0x4f, 0x01,
+  0x58, 0x01, 0x65, 0x01, 0x71, 0x01, 0x7d, 0x01, 0x8a, 0x01, 0x96, 0x01,
+  0xa4, 0x01, 0xb0, 0x01, 0xbb, 0x01, 0xc6, 0x01, 0xd6, 0x01, 0xe4, 0x01,
+  0xf0, 0x01, 0x02, 0x02, 0x0d, 0x02, 0x1c, 0x02, 0x28, 0x02, 0x38, 0x02,
+  0x43, 0x02, 0x51, 0x02, 0x5e, 0x02, 0x6a, 0x02, 0x76, 0x02, 0x82, 0x02,
+  0x8e, 0x02, 0x9f, 0x02, 0x00, 0x00, 0x15, 0x00, 0x21, 0x00, 0x2d, 0x00,
+  0x3b, 0x00, 0x47, 0x00, 0x53, 0x00, 0x61, 0x00, 0x76, 0x00, 0x84, 0x00,
+  0x92, 0x00, 0xa6, 0x00, 0xb0, 0x00, 0xbe, 0x00, 0xca, 0x00, 0xd4, 0x00,
+  0xe0, 0x00, 0xec, 0x00, 0xfa, 0x00, 0x06, 0x01, 0x12, 0x01, 0x1e, 0x01,
+  0x2c, 0x01, 0x3a, 0x01, 0x46, 0x01, 0x54, 0x01, 0x62, 0x01, 0x6e, 0x01,
+  0x7a, 0x01, 0x91, 0x01, 0x9d, 0x01, 0xab, 0x01, 0xb9, 0x01, 0xc7, 0x01,
+  0xd1, 0x01, 0xdd, 0x01, 0xeb, 0x01, 0xf7, 0x01, 0x05, 0x02, 0x11, 0x02,
+  0x1d, 0x02, 0x29, 0x02, 0x32, 0x02, 0x41, 0x02, 0x4b, 0x02, 0x57, 0x02,
+  0x65, 0x02, 0x71, 0x02, 0x7d, 0x02, 0x87, 0x02, 0x93, 0x02, 0xa8, 0x02,
+  0xb4, 0x02, 0xc0, 0x02, 0xcc, 0x02, 0xd8, 0x02, 0xe4, 0x02, 0xed, 0x02,
+  0x00, 0x00, 0x0e, 0x00, 0x1c, 0x00, 0x2a, 0x00, 0x38, 0x00, 0x48, 0x00,
+  0x56, 0x00, 0x64, 0x00, 0x70, 0x00, 0x7e, 0x00, 0x8c, 0x00, 0x9a, 0x00,
+  0xa7, 0x00, 0xb6, 0x00, 0xc2, 0x00, 0xd0, 0x00, 0xdc, 0x00, 0xea, 0x00,
+  0xf8, 0x00, 0x0a, 0x01, 0x18, 0x01, 0x2a, 0x01, 0x38, 0x01, 0x48, 0x01,
+  0x56, 0x01, 0x64, 0x01, 0x72, 0x01, 0x7f, 0x01, 0x8a, 0x01, 0x98, 0x01,
+  0xa3, 0x01, 0xb5, 0x01, 0xbf, 0x01, 0xce, 0x01, 0xdc, 0x01, 0xea, 0x01,
+  0xf6, 0x01, 0x00, 0x02, 0x0e, 0x02, 0x18, 0x02, 0x26, 0x02, 0x32, 0x02,
+  0x3e, 0x02, 0x48, 0x02, 0x54, 0x02, 0x66, 0x02, 0x74, 0x02, 0x82, 0x02,
+  0x91, 0x02, 0xa5, 0x02, 0xaf, 0x02, 0xbd, 0x02, 0xcb, 0x02, 0xdd, 0x02,
+  0xeb, 0x02, 0xf9, 0x02, 0x07, 0x03, 0x16, 0x03, 0x24, 0x03, 0x32, 0x03,
+  0x40, 0x03, 0x00, 0x00, 0x0c, 0x00, 0x17, 0x00, 0x22, 0x00, 0x2e, 0x00,
+  0x3a, 0x00, 0x4b, 0x00, 0x59, 0x00, 0x67, 0x00, 0x75, 0x00, 0x84, 0x00,
+  0x8e, 0x00, 0x9e, 0x00, 0xaa, 0x00, 0xb5, 0x00, 0xc1, 0x00, 0xd2, 0x00,
+  0xe0, 0x00, 0xee, 0x00, 0xfa, 0x00, 0x06, 0x01, 0x12, 0x01, 0x1e, 0x01,
+  0x2d, 0x01, 0x39, 0x01, 0x44, 0x01, 0x50, 0x01, 0x5b, 0x01, 0x69, 0x01,
+  0x73, 0x01, 0x83, 0x01, 0x8f, 0x01, 0xa0, 0x01, 0xac, 0x01, 0xbd, 0x01,
+  0xc9, 0x01, 0xd9, 0x01, 0xe7, 0x01, 0xfe, 0x01, 0x0e, 0x02, 0x1a, 0x02,
+  0x28, 0x02, 0x33, 0x02, 0x3f, 0x02, 0x4d, 0x02, 0x59, 0x02, 0x65, 0x02,
+  0x6f, 0x02, 0x79, 0x02, 0x87, 0x02, 0x95, 0x02, 0xa3, 0x02, 0x00, 0x00,
+  0x0c, 0x00, 0x1c, 0x00, 0x28, 0x00, 0x34, 0x00, 0x42, 0x00, 0x53, 0x00,
+  0x61, 0x00, 0x6d, 0x00, 0x7b, 0x00, 0x8c, 0x00, 0x99, 0x00, 0xa5, 0x00,
+  0xb1, 0x00, 0xbc, 0x00, 0xcd, 0x00, 0xd9, 0x00, 0xe6, 0x00, 0xf2, 0x00,
+  0x03, 0x01, 0x0f, 0x01, 0x1b, 0x01, 0x27, 0x01, 0x33, 0x01, 0x41, 0x01,
+  0x52, 0x01, 0x5e, 0x01, 0x6a, 0x01, 0x76, 0x01, 0x82, 0x01, 0x8e, 0x01,
+  0x99, 0x01, 0xaa, 0x01, 0xb6, 0x01, 0xc2, 0x01, 0x00, 0x00, 0x19, 0x00,
+  0x25, 0x00, 0x33, 0x00, 0x41, 0x00, 0x52, 0x00, 0x60, 0x00, 0x70, 0x00,
+  0x7f, 0x00, 0x8b, 0x00, 0x9c, 0x00, 0xab, 0x00, 0xb7, 0x00, 0xc3, 0x00,
+  0xd2, 0x00, 0xdd, 0x00, 0xe8, 0x00, 0xf4, 0x00, 0x02, 0x01, 0x0e, 0x01,
+  0x1d, 0x01, 0x2b, 0x01, 0x42, 0x01, 0x4c, 0x01, 0x5a, 0x01, 0x6d, 0x01,
+  0x7b, 0x01, 0x89, 0x01, 0x96, 0x01, 0xa7, 0x01, 0xb5, 0x01, 0xc2, 0x01,
+  0xd5, 0x01, 0xe3, 0x01, 0xf1, 0x01, 0x02, 0x02, 0x15, 0x02, 0x23, 0x02,
+  0x35, 0x02, 0x43, 0x02, 0x4f, 0x02, 0x5b, 0x02, 0x6e, 0x02, 0x7c, 0x02,
+  0x8a, 0x02, 0x96, 0x02, 0x00, 0x00, 0x0e, 0x00, 0x1e, 0x00, 0x2c, 0x00,
+  0x39, 0x00, 0x45, 0x00, 0x53, 0x00, 0x61, 0x00, 0x6f, 0x00, 0x7d, 0x00,
+  0x8c, 0x00, 0x9a, 0x00, 0xaa, 0x00, 0xb8, 0x00, 0xcb, 0x00, 0xde, 0x00,
+  0xec, 0x00, 0xfa, 0x00, 0x08, 0x01, 0x16, 0x01, 0x26, 0x01, 0x36, 0x01,
+  0x44, 0x01, 0x51, 0x01, 0x62, 0x01, 0x70, 0x01, 0x7b, 0x01, 0x8a, 0x01,
+  0x98, 0x01, 0xa8, 0x01, 0xb5, 0x01, 0xc3, 0x01, 0xcf, 0x01, 0xda, 0x01,
+  0xe8, 0x01, 0xf6, 0x01, 0x04, 0x02, 0x10, 0x02, 0x1e, 0x02, 0x00, 0x00,
+  0x11, 0x00, 0x1e, 0x00, 0x2c, 0x00, 0x3a, 0x00, 0x4a, 0x00, 0x58, 0x00,
+  0x69, 0x00, 0x76, 0x00, 0x86, 0x00, 0x94, 0x00, 0xa2, 0x00, 0xaf, 0x00,
+  0xbc, 0x00, 0xc9, 0x00, 0xd7, 0x00, 0xe3, 0x00, 0xf4, 0x00, 0x02, 0x01,
+  0x0f, 0x01, 0x1c, 0x01, 0x2d, 0x01, 0x39, 0x01, 0x46, 0x01, 0x53, 0x01,
+  0x65, 0x01, 0x75, 0x01, 0x83, 0x01, 0x94, 0x01, 0xa2, 0x01, 0xb1, 0x01,
+  0x00, 0x00, 0x0c, 0x00, 0x1a, 0x00, 0x27, 0x00, 0x3b, 0x00, 0x47, 0x00,
+  0x55, 0x00, 0x61, 0x00, 0x6d, 0x00, 0x7c, 0x00, 0x8a, 0x00, 0x96, 0x00,
+  0xa7, 0x00, 0xb8, 0x00, 0xc6, 0x00, 0xd2, 0x00, 0xe0, 0x00, 0xee, 0x00,
+  0xff, 0x00, 0x15, 0x01, 0x21, 0x01, 0x2d, 0x01, 0x39, 0x01, 0x45, 0x01,
+  0x53, 0x01, 0x67, 0x01, 0x75, 0x01, 0x86, 0x01, 0x97, 0x01, 0xa8, 0x01,
+  0xb8, 0x01, 0xc4, 0x01, 0xd4, 0x01, 0xe2, 0x01, 0xee, 0x01, 0x00, 0x00,
+  0x0b, 0x00, 0x1e, 0x00, 0x2b, 0x00, 0x35, 0x00, 0x40, 0x00, 0x51, 0x00,
+  0x5d, 0x00, 0x6d, 0x00, 0x7d, 0x00, 0x89, 0x00, 0x9b, 0x00, 0xa6, 0x00,
+  0xbd, 0x00, 0xc7, 0x00, 0xd7, 0x00, 0xe1, 0x00, 0xeb, 0x00, 0xfb, 0x00,
+  0x0d, 0x01, 0x1f, 0x01, 0x2f, 0x01, 0x3f, 0x01, 0x4f, 0x01, 0x5f, 0x01,
+  0x69, 0x01, 0x79, 0x01, 0x89, 0x01, 0x99, 0x01, 0xa9, 0x01, 0xb9, 0x01,
+  0x00, 0x00, 0x0b, 0x00, 0x17, 0x00, 0x22, 0x00, 0x2f, 0x00, 0x3c, 0x00,
+  0x4a, 0x00, 0x55, 0x00, 0x61, 0x00, 0x70, 0x00, 0x80, 0x00, 0x8b, 0x00,
+  0x99, 0x00, 0xa8, 0x00, 0xb9, 0x00, 0xc7, 0x00, 0xd2, 0x00, 0xe0, 0x00,
+  0xeb, 0x00, 0x02, 0x01, 0x0e, 0x01, 0x18, 0x01, 0x28, 0x01, 0x34, 0x01,
+  0x3e, 0x01, 0x48, 0x01, 0x52, 0x01, 0x5c, 0x01, 0x68, 0x01, 0x73, 0x01,
+  0x86, 0x01, 0x92, 0x01, 0x9e, 0x01, 0xb0, 0x01, 0xbe, 0x01, 0xc8, 0x01,
+  0xd3, 0x01, 0xdd, 0x01, 0xeb, 0x01, 0xf6, 0x01, 0x00, 0x02, 0x0e, 0x02,
+  0x19, 0x02, 0x29, 0x02, 0x36, 0x02, 0x40, 0x02, 0x4c, 0x02, 0x56, 0x02,
+  0x60, 0x02, 0x6c, 0x02, 0x00, 0x00, 0x0d, 0x00, 0x1d, 0x00, 0x30, 0x00,
+  0x44, 0x00, 0x51, 0x00, 0x64, 0x00, 0x78, 0x00, 0x8a, 0x00, 0x9d, 0x00,
+  0xb0, 0x00, 0xbd, 0x00, 0xc9, 0x00, 0xd4, 0x00, 0xe7, 0x00, 0xf9, 0x00,
+  0x06, 0x01, 0x14, 0x01, 0x1f, 0x01, 0x2b, 0x01, 0x39, 0x01, 0x45, 0x01,
+  0x52, 0x01, 0x5e, 0x01, 0x70, 0x01, 0x7b, 0x01, 0x87, 0x01, 0x95, 0x01,
+  0x9f, 0x01, 0xab, 0x01, 0xb5, 0x01, 0xc7, 0x01, 0xdc, 0x01, 0xee, 0x01,
+  0x00, 0x02, 0x00, 0x00, 0x0e, 0x00, 0x1e, 0x00, 0x2a, 0x00, 0x37, 0x00,
+  0x44, 0x00, 0x50, 0x00, 0x5c, 0x00, 0x69, 0x00, 0x77, 0x00, 0x8b, 0x00,
+  0x98, 0x00, 0xa6, 0x00, 0xb3, 0x00, 0xc7, 0x00, 0xdb, 0x00, 0xe8, 0x00,
+  0xf6, 0x00, 0x02, 0x01, 0x0c, 0x01, 0x19, 0x01, 0x25, 0x01, 0x31, 0x01,
+  0x3d, 0x01, 0x49, 0x01, 0x56, 0x01, 0x64, 0x01, 0x71, 0x01, 0x7d, 0x01,
+  0x00, 0x00, 0x0c, 0x00, 0x1d, 0x00, 0x32, 0x00, 0x41, 0x00, 0x4e, 0x00,
+  0x5f, 0x00, 0x70, 0x00, 0x7c, 0x00, 0x8c, 0x00, 0x9c, 0x00, 0xac, 0x00,
+  0xbb, 0x00, 0xc9, 0x00, 0xd7, 0x00, 0xe8, 0x00, 0xf6, 0x00, 0x06, 0x01,
+  0x11, 0x01, 0x1f, 0x01, 0x2e, 0x01, 0x3d, 0x01, 0x4b, 0x01, 0x00, 0x00,
+  0x30, 0x00, 0x3f, 0x00, 0x56, 0x00, 0x63, 0x00, 0x76, 0x00, 0x86, 0x00,
+  0x91, 0x00, 0x9f, 0x00, 0xb0, 0x00, 0xbe, 0x00, 0xcc, 0x00, 0xd7, 0x00,
+  0xe5, 0x00, 0xf4, 0x00, 0x02, 0x01, 0x10, 0x01, 0x1e, 0x01, 0x2c, 0x01,
+  0x37, 0x01, 0x43, 0x01, 0x4d, 0x01, 0x5b, 0x01, 0x69, 0x01, 0x77, 0x01,
+  0x85, 0x01, 0x95, 0x01, 0xa3, 0x01, 0xb1, 0x01, 0xbf, 0x01, 0xcd, 0x01,
+  0xda, 0x01, 0xe5, 0x01, 0xf3, 0x01, 0x01, 0x02, 0x0f, 0x02, 0x1f, 0x02,
+  0x2b, 0x02, 0x39, 0x02, 0x47, 0x02, 0x57, 0x02, 0x67, 0x02, 0x75, 0x02,
+  0x85, 0x02, 0x8f, 0x02, 0x9d, 0x02, 0xab, 0x02, 0xb8, 0x02, 0xc6, 0x02,
+  0x00, 0x00, 0x0a, 0x00, 0x16, 0x00, 0x24, 0x00, 0x34, 0x00, 0x42, 0x00,
+  0x55, 0x00, 0x65, 0x00, 0x70, 0x00, 0x7a, 0x00, 0x8a, 0x00, 0x95, 0x00,
+  0xa8, 0x00, 0xb8, 0x00, 0xca, 0x00, 0xd6, 0x00, 0xe1, 0x00, 0xf3, 0x00,
+  0x03, 0x01, 0x0e, 0x01, 0x1c, 0x01, 0x2c, 0x01, 0x3c, 0x01, 0x50, 0x01,
+  0x5e, 0x01, 0x6c, 0x01, 0x00, 0x00, 0x10, 0x00, 0x1c, 0x00, 0x27, 0x00,
+  0x37, 0x00, 0x44, 0x00, 0x54, 0x00, 0x64, 0x00, 0x6f, 0x00, 0x7b, 0x00,
+  0x86, 0x00, 0x92, 0x00, 0xa2, 0x00, 0xb1, 0x00, 0xc2, 0x00, 0xcf, 0x00,
+  0xdf, 0x00, 0xea, 0x00, 0x03, 0x01, 0x13, 0x01, 0x24, 0x01, 0x30, 0x01,
+  0x3b, 0x01, 0x4b, 0x01, 0x58, 0x01, 0x66, 0x01, 0x76, 0x01, 0x86, 0x01,
+  0x96, 0x01, 0xa6, 0x01, 0xb1, 0x01, 0xbd, 0x01, 0xcd, 0x01, 0xdd, 0x01,
+  0xe8, 0x01, 0xf8, 0x01, 0x06, 0x02, 0x14, 0x02, 0x24, 0x02, 0x2f, 0x02,
+  0x00, 0x00, 0x0e, 0x00, 0x1a, 0x00, 0x2e, 0x00, 0x3a, 0x00, 0x44, 0x00,
+  0x4f, 0x00, 0x5b, 0x00, 0x66, 0x00, 0x70, 0x00, 0x7a, 0x00, 0x84, 0x00,
+  0x96, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1d, 0x00, 0x2b, 0x00, 0x39, 0x00,
+  0x47, 0x00, 0x55, 0x00, 0x63, 0x00, 0x71, 0x00, 0x7d, 0x00, 0x8b, 0x00,
+  0x99, 0x00, 0xa7, 0x00, 0xb5, 0x00, 0xc3, 0x00, 0xd1, 0x00, 0xe0, 0x00,
+  0xee, 0x00, 0xfc, 0x00, 0x08, 0x01, 0x16, 0x01, 0x24, 0x01, 0x32, 0x01,
+  0x41, 0x01, 0x4f, 0x01, 0x5d, 0x01, 0x68, 0x01, 0x76, 0x01, 0x84, 0x01,
+  0x8f, 0x01, 0x9d, 0x01, 0xad, 0x01, 0xbb, 0x01, 0xc9, 0x01, 0xd3, 0x01,
+  0xe1, 0x01, 0xed, 0x01, 0xfc, 0x01, 0x0a, 0x02, 0x14, 0x02, 0x22, 0x02,
+  0x30, 0x02, 0x3e, 0x02, 0x48, 0x02, 0x56, 0x02, 0x69, 0x02, 0x7b, 0x02,
+  0x8f, 0x02, 0xa2, 0x02, 0xb4, 0x02, 0xc2, 0x02, 0xd0, 0x02, 0xde, 0x02,
+  0xe8, 0x02, 0xf2, 0x02, 0x02, 0x03, 0x14, 0x03, 0x22, 0x03, 0x30, 0x03,
+  0x3e, 0x03, 0x00, 0x00, 0x1c, 0x00, 0x28, 0x00, 0x37, 0x00, 0x43, 0x00,
+  0x4f, 0x00, 0x5c, 0x00, 0x6d, 0x00, 0x76, 0x00, 0x7e, 0x00, 0x8d, 0x00,
+  0x9b, 0x00, 0x00, 0x00, 0x10, 0x00, 0x20, 0x00, 0x30, 0x00, 0x40, 0x00,
+  0x4c, 0x00, 0x60, 0x00, 0x6e, 0x00, 0x7c, 0x00, 0x8c, 0x00, 0x98, 0x00,
+  0xac, 0x00, 0xb8, 0x00, 0xcf, 0x00, 0xe0, 0x00, 0xf0, 0x00, 0x01, 0x01,
+  0x0d, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x38, 0x01, 0x47, 0x01, 0x53, 0x01,
+  0x64, 0x01, 0x73, 0x01, 0x83, 0x01, 0x00, 0x00, 0x0e, 0x00, 0x1a, 0x00,
+  0x26, 0x00, 0x35, 0x00, 0x42, 0x00, 0x4f, 0x00, 0x5b, 0x00, 0x67, 0x00,
+  0x79, 0x00, 0x86, 0x00, 0x92, 0x00, 0xa2, 0x00, 0xaf, 0x00, 0xbb, 0x00,
+  0xc6, 0x00, 0xd6, 0x00, 0xe3, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1c, 0x00,
+  0x2a, 0x00, 0x35, 0x00, 0x43, 0x00, 0x51, 0x00, 0x5f, 0x00, 0x6c, 0x00,
+  0x78, 0x00, 0x86, 0x00, 0x96, 0x00, 0xa4, 0x00, 0xb2, 0x00, 0xbb, 0x00,
+  0x00, 0x00, 0x11, 0x00, 0x26, 0x00, 0x34, 0x00, 0x42, 0x00, 0x4f, 0x00,
+  0x5d, 0x00, 0x6b, 0x00, 0x79, 0x00, 0x87, 0x00, 0x95, 0x00, 0xa6, 0x00,
+  0xb3, 0x00, 0xc0, 0x00, 0xce, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x18, 0x00,
+  0x27, 0x00, 0x35, 0x00, 0x41, 0x00, 0x4d, 0x00, 0x00, 0x00, 0x14, 0x00,
+  0x23, 0x00, 0x33, 0x00, 0x43, 0x00, 0x4d, 0x00, 0x5d, 0x00, 0x6c, 0x00,
+  0x7c, 0x00, 0x8c, 0x00, 0x9c, 0x00, 0xac, 0x00, 0xbd, 0x00, 0xcc, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x17, 0x00, 0x23, 0x00, 0x2d, 0x00, 0x3f, 0x00,
+  0x4b, 0x00, 0x5c, 0x00, 0x6d, 0x00, 0x79, 0x00, 0x8a, 0x00, 0x9b, 0x00,
+  0x00, 0x00, 0x17, 0x00, 0x28, 0x00, 0x3a, 0x00, 0x45, 0x00, 0x51, 0x00,
+  0x68, 0x00, 0x74, 0x00, 0x80, 0x00, 0x8c, 0x00, 0x9e, 0x00, 0xb0, 0x00,
+  0xb9, 0x00, 0xcb, 0x00, 0xd7, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1b, 0x00,
+  0x2b, 0x00, 0x37, 0x00, 0x4b, 0x00, 0x5e, 0x00, 0x69, 0x00, 0x75, 0x00,
+  0x81, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x15, 0x00, 0x21, 0x00, 0x2c, 0x00,
+  0x38, 0x00, 0x43, 0x00, 0x51, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x15, 0x00,
+  0x1f, 0x00, 0x2a, 0x00, 0x39, 0x00, 0x45, 0x00, 0x55, 0x00, 0x61, 0x00,
+  0x6d, 0x00, 0x78, 0x00, 0x83, 0x00, 0x8f, 0x00, 0x99, 0x00, 0xa5, 0x00,
+  0xb3, 0x00, 0xbf, 0x00, 0xcb, 0x00, 0xd9, 0x00, 0xe4, 0x00, 0xf0, 0x00,
+  0xfa, 0x00, 0x06, 0x01, 0x11, 0x01, 0x1d, 0x01, 0x00, 0x00, 0x12, 0x00,
+  0x20, 0x00, 0x2c, 0x00, 0x38, 0x00, 0x46, 0x00, 0x52, 0x00, 0x5e, 0x00,
+  0x69, 0x00, 0x77, 0x00, 0x83, 0x00, 0x8d, 0x00, 0x98, 0x00, 0xa4, 0x00,
+  0xb0, 0x00, 0xbd, 0x00, 0xc6, 0x00, 0xd2, 0x00, 0xdb, 0x00, 0xe7, 0x00,
+  0xf3, 0x00, 0xff, 0x00, 0x0a, 0x01, 0x16, 0x01, 0x22, 0x01, 0x30, 0x01,
+  0x3b, 0x01, 0x47, 0x01, 0x53, 0x01, 0x5f, 0x01, 0x6b, 0x01, 0x77, 0x01,
+  0x83, 0x01, 0x8d, 0x01, 0x9a, 0x01, 0xa5, 0x01, 0xae, 0x01, 0xb9, 0x01,
+  0xc5, 0x01, 0xcd, 0x01, 0xd9, 0x01, 0xe4, 0x01, 0x00, 0x00, 0x0e, 0x00,
+  0x1a, 0x00, 0x26, 0x00, 0x34, 0x00, 0x42, 0x00, 0x4d, 0x00, 0x5c, 0x00,
+  0x6a, 0x00, 0x77, 0x00, 0x83, 0x00, 0x8f, 0x00, 0x9b, 0x00, 0xa6, 0x00,
+  0xb4, 0x00, 0xbf, 0x00, 0xd0, 0x00, 0xd9, 0x00, 0xe7, 0x00, 0xf3, 0x00,
+  0xff, 0x00, 0x0b, 0x01, 0x16, 0x01, 0x22, 0x01, 0x2d, 0x01, 0x3b, 0x01,
+  0x46, 0x01, 0x54, 0x01, 0x60, 0x01, 0x6b, 0x01, 0x77, 0x01, 0x82, 0x01,
+  0x8d, 0x01, 0x98, 0x01, 0xa4, 0x01, 0xaf, 0x01, 0xbb, 0x01, 0xc9, 0x01,
+  0xd7, 0x01, 0xe3, 0x01, 0xef, 0x01, 0xfd, 0x01, 0x09, 0x02, 0x14, 0x02,
+  0x20, 0x02, 0x2b, 0x02, 0x37, 0x02, 0x45, 0x02, 0x53, 0x02, 0x5f, 0x02,
+  0x6b, 0x02, 0x79, 0x02, 0x87, 0x02, 0x95, 0x02, 0xa1, 0x02, 0xaf, 0x02,
+  0xbb, 0x02, 0xc7, 0x02, 0xd3, 0x02, 0x00, 0x00, 0x0e, 0x00, 0x1c, 0x00,
+  0x2a, 0x00, 0x39, 0x00, 0x47, 0x00, 0x60, 0x00, 0x6e, 0x00, 0x7a, 0x00,
+  0x8b, 0x00, 0x99, 0x00, 0xa7, 0x00, 0xb3, 0x00, 0xc1, 0x00, 0xcf, 0x00,
+  0xdd, 0x00, 0xeb, 0x00, 0xf9, 0x00, 0x07, 0x01, 0x15, 0x01, 0x21, 0x01,
+  0x2e, 0x01, 0x3a, 0x01, 0x48, 0x01, 0x56, 0x01, 0x64, 0x01, 0x72, 0x01,
+  0x80, 0x01, 0x89, 0x01, 0x98, 0x01, 0xaf, 0x01, 0xbb, 0x01, 0xc9, 0x01,
+  0xd5, 0x01, 0xe1, 0x01, 0xef, 0x01, 0xfd, 0x01, 0x06, 0x02, 0x12, 0x02,
+  0x20, 0x02, 0x30, 0x02, 0x3e, 0x02, 0x4a, 0x02, 0x58, 0x02, 0x66, 0x02,
+  0x70, 0x02, 0x7e, 0x02, 0x8a, 0x02, 0x96, 0x02, 0x00, 0x00, 0x0e, 0x00,
+  0x1d, 0x00, 0x2b, 0x00, 0x39, 0x00, 0x47, 0x00, 0x59, 0x00, 0x64, 0x00,
+  0x6f, 0x00, 0x7d, 0x00, 0x8b, 0x00, 0x9a, 0x00, 0xa8, 0x00, 0xb4, 0x00,
+  0xc2, 0x00, 0xd1, 0x00, 0xdf, 0x00, 0xea, 0x00, 0xf5, 0x00, 0x00, 0x01,
+  0x0e, 0x01, 0x1c, 0x01, 0x2a, 0x01, 0x38, 0x01, 0x46, 0x01, 0x50, 0x01,
+  0x5e, 0x01, 0x6c, 0x01, 0x7a, 0x01, 0x88, 0x01, 0x97, 0x01, 0xac, 0x01,
+  0xba, 0x01, 0xc5, 0x01, 0xd3, 0x01, 0xe2, 0x01, 0xf0, 0x01, 0xfb, 0x01,
+  0x09, 0x02, 0x17, 0x02, 0x25, 0x02, 0x30, 0x02, 0x3b, 0x02, 0x49, 0x02,
+  0x57, 0x02, 0x62, 0x02, 0x72, 0x02, 0x7e, 0x02, 0x89, 0x02, 0x95, 0x02,
+  0xa3, 0x02, 0xb1, 0x02, 0xbf, 0x02, 0xcb, 0x02, 0xd5, 0x02, 0xe3, 0x02,
+  0x00, 0x00, 0x0e, 0x00, 0x1c, 0x00, 0x2c, 0x00, 0x3a, 0x00, 0x48, 0x00,
+  0x58, 0x00, 0x66, 0x00, 0x72, 0x00, 0x80, 0x00, 0x8e, 0x00, 0x9a, 0x00,
+  0xa6, 0x00, 0xb6, 0x00, 0xcb, 0x00, 0xd9, 0x00, 0xe7, 0x00, 0xf5, 0x00,
+  0x01, 0x01, 0x0f, 0x01, 0x1b, 0x01, 0x27, 0x01, 0x37, 0x01, 0x45, 0x01,
+  0x55, 0x01, 0x64, 0x01, 0x72, 0x01, 0x82, 0x01, 0x8e, 0x01, 0x9a, 0x01,
+  0xa8, 0x01, 0xb3, 0x01, 0xbf, 0x01, 0xcf, 0x01, 0xe0, 0x01, 0xf1, 0x01,
+  0xff, 0x01, 0x10, 0x02, 0x1f, 0x02, 0x2d, 0x02, 0x39, 0x02, 0x47, 0x02,
+  0x55, 0x02, 0x63, 0x02, 0x73, 0x02, 0x81, 0x02, 0x8f, 0x02, 0x9d, 0x02,
+  0xa9, 0x02, 0xb2, 0x02, 0xc0, 0x02, 0xce, 0x02, 0xd8, 0x02, 0xe4, 0x02,
+  0xf0, 0x02, 0xff, 0x02, 0x0d, 0x03, 0x1b, 0x03, 0x29, 0x03, 0x37, 0x03,
+  0x43, 0x03, 0x4f, 0x03, 0x00, 0x00, 0x0c, 0x00, 0x17, 0x00, 0x24, 0x00,
+  0x30, 0x00, 0x3c, 0x00, 0x48, 0x00, 0x58, 0x00, 0x64, 0x00, 0x70, 0x00,
+  0x7c, 0x00, 0x88, 0x00, 0x94, 0x00, 0xa0, 0x00, 0xac, 0x00, 0xb8, 0x00,
+  0xc4, 0x00, 0xd1, 0x00, 0xdd, 0x00, 0xee, 0x00, 0xfb, 0x00, 0x09, 0x01,
+  0x19, 0x01, 0x25, 0x01, 0x31, 0x01, 0x3d, 0x01, 0x4b, 0x01, 0x57, 0x01,
+  0x67, 0x01, 0x74, 0x01, 0x85, 0x01, 0x91, 0x01, 0x9d, 0x01, 0xac, 0x01,
+  0xb7, 0x01, 0xc5, 0x01, 0xd0, 0x01, 0xe0, 0x01, 0xef, 0x01, 0xfa, 0x01,
+  0x06, 0x02, 0x17, 0x02, 0x28, 0x02, 0x36, 0x02, 0x43, 0x02, 0x4f, 0x02,
+  0x5c, 0x02, 0x6c, 0x02, 0x78, 0x02, 0x83, 0x02, 0x8e, 0x02, 0x9a, 0x02,
+  0xa6, 0x02, 0xb6, 0x02, 0xc2, 0x02, 0xd0, 0x02, 0xde, 0x02, 0xec, 0x02,
+  0xfd, 0x02, 0x0b, 0x03, 0x17, 0x03, 0x23, 0x03, 0x2e, 0x03, 0x3d, 0x03,
+  0x49, 0x03, 0x55, 0x03, 0x60, 0x03, 0x6b, 0x03, 0x79, 0x03, 0x00, 0x00,
+  0x39, 0x00, 0x4a, 0x00, 0x5d, 0x00, 0x6c, 0x00, 0x80, 0x00, 0x8e, 0x00,
+  0x9a, 0x00, 0xa8, 0x00, 0xb6, 0x00, 0xc4, 0x00, 0xd5, 0x00, 0xe7, 0x00,
+  0xf3, 0x00, 0x01, 0x01, 0x0c, 0x01, 0x18, 0x01, 0x24, 0x01, 0x30, 0x01,
+  0x3e, 0x01, 0x4a, 0x01, 0x5c, 0x01, 0x68, 0x01, 0x74, 0x01, 0x82, 0x01,
+  0x90, 0x01, 0x9c, 0x01, 0xa8, 0x01, 0xb9, 0x01, 0xc7, 0x01, 0xd3, 0x01,
+  0xe5, 0x01, 0xf1, 0x01, 0xff, 0x01, 0x0d, 0x02, 0x1e, 0x02, 0x2a, 0x02,
+  0x38, 0x02, 0x47, 0x02, 0x53, 0x02, 0x5f, 0x02, 0x6d, 0x02, 0x7b, 0x02,
+  0x89, 0x02, 0x97, 0x02, 0xa5, 0x02, 0xb3, 0x02, 0xbf, 0x02, 0xcb, 0x02,
+  0xd7, 0x02, 0xe3, 0x02, 0xef, 0x02, 0xfb, 0x02, 0x07, 0x03, 0x15, 0x03,
+  0x26, 0x03, 0x31, 0x03, 0x3f, 0x03, 0x4d, 0x03, 0x59, 0x03, 0x65, 0x03,
+  0x71, 0x03, 0x7d, 0x03, 0x8b, 0x03, 0x97, 0x03, 0xa1, 0x03, 0xaf, 0x03,
+  0xb7, 0x03, 0xc2, 0x03, 0xd1, 0x03, 0x00, 0x00, 0x37, 0x00, 0x45, 0x00,
+  0x53, 0x00, 0x61, 0x00, 0x6f, 0x00, 0x7a, 0x00, 0x85, 0x00, 0x92, 0x00,
+  0xa0, 0x00, 0xac, 0x00, 0xba, 0x00, 0xc4, 0x00, 0xd2, 0x00, 0xdf, 0x00,
+  0xe9, 0x00, 0xf7, 0x00, 0x04, 0x01, 0x10, 0x01, 0x21, 0x01, 0x2c, 0x01,
+  0x36, 0x01, 0x44, 0x01, 0x50, 0x01, 0x5e, 0x01, 0x6b, 0x01, 0x7f, 0x01,
+  0x89, 0x01, 0x9c, 0x01, 0xaa, 0x01, 0xb8, 0x01, 0xc6, 0x01, 0xd2, 0x01,
+  0xe0, 0x01, 0xed, 0x01, 0xff, 0x01, 0x0d, 0x02, 0x17, 0x02, 0x2b, 0x02,
+  0x36, 0x02, 0x44, 0x02, 0x52, 0x02, 0x61, 0x02, 0x6f, 0x02, 0x81, 0x02,
+  0x8c, 0x02, 0x97, 0x02, 0xa2, 0x02, 0xac, 0x02, 0xbf, 0x02, 0xcb, 0x02,
+  0xd7, 0x02, 0xe3, 0x02, 0xf1, 0x02, 0xfb, 0x02, 0x00, 0x00, 0x0d, 0x00,
+  0x19, 0x00, 0x28, 0x00, 0x36, 0x00, 0x4c, 0x00, 0x59, 0x00, 0x64, 0x00,
+  0x6e, 0x00, 0x7f, 0x00, 0x8d, 0x00, 0x9c, 0x00, 0xad, 0x00, 0xb8, 0x00,
+  0xc3, 0x00, 0xd1, 0x00, 0xdf, 0x00, 0xed, 0x00, 0x01, 0x01, 0x0f, 0x01,
+  0x1f, 0x01, 0x2d, 0x01, 0x3e, 0x01, 0x4f, 0x01, 0x5e, 0x01, 0x6c, 0x01,
+  0x79, 0x01, 0x83, 0x01, 0x91, 0x01, 0xa1, 0x01, 0xad, 0x01, 0xbb, 0x01,
+  0xc9, 0x01, 0xd5, 0x01, 0xdf, 0x01, 0xed, 0x01, 0x01, 0x02, 0x0c, 0x02,
+  0x17, 0x02, 0x27, 0x02, 0x35, 0x02, 0x43, 0x02, 0x52, 0x02, 0x60, 0x02,
+  0x70, 0x02, 0x82, 0x02, 0x90, 0x02, 0x9e, 0x02, 0xb0, 0x02, 0xc3, 0x02,
+  0xcf, 0x02, 0x00, 0x00, 0x42, 0x00, 0x82, 0x00, 0xc0, 0x00, 0x00, 0x01,
+  0x0c, 0x01, 0x1a, 0x01, 0x26, 0x01, 0x32, 0x01, 0x3e, 0x01, 0x4c, 0x01,
+  0x5a, 0x01, 0x68, 0x01, 0x76, 0x01, 0x85, 0x01, 0x96, 0x01, 0xa4, 0x01,
+  0xbb, 0x01, 0xcb, 0x01, 0xd7, 0x01, 0xe7, 0x01, 0xf9, 0x01, 0x08, 0x02,
+  0x16, 0x02, 0x22, 0x02, 0x30, 0x02, 0x3f, 0x02, 0x51, 0x02, 0x63, 0x02,
+  0x75, 0x02, 0x81, 0x02, 0x00, 0x00, 0x40, 0x00, 0x7e, 0x00, 0xbc, 0x00,
+  0xf8, 0x00, 0x34, 0x01, 0x72, 0x01, 0x7e, 0x01, 0x8a, 0x01, 0x98, 0x01,
+  0xa8, 0x01, 0xb8, 0x01, 0xc8, 0x01, 0xda, 0x01, 0xed, 0x01, 0xf7, 0x01,
+  0x07, 0x02, 0x13, 0x02, 0x25, 0x02, 0x35, 0x02, 0x48, 0x02, 0x57, 0x02,
+  0x69, 0x02, 0x76, 0x02, 0x82, 0x02, 0x94, 0x02, 0xa9, 0x02, 0xb4, 0x02,
+  0xc0, 0x02, 0xce, 0x02, 0xde, 0x02, 0xea, 0x02, 0xf8, 0x02, 0x06, 0x03,
+  0x15, 0x03, 0x22, 0x03, 0x00, 0x00, 0x11, 0x00, 0x20, 0x00, 0x2c, 0x00,
+  0x38, 0x00, 0x50, 0x00, 0x5c, 0x00, 0x6a, 0x00, 0x76, 0x00, 0x82, 0x00,
+  0x8c, 0x00, 0x98, 0x00, 0xac, 0x00, 0xbb, 0x00, 0xca, 0x00, 0xd8, 0x00,
+  0xe5, 0x00, 0xf9, 0x00, 0x0d, 0x01, 0x1b, 0x01, 0x27, 0x01, 0x36, 0x01,
+  0x42, 0x01, 0x4e, 0x01, 0x5d, 0x01, 0x69, 0x01, 0x78, 0x01, 0x84, 0x01,
+  0x96, 0x01, 0xa0, 0x01, 0xad, 0x01, 0xb7, 0x01, 0xc2, 0x01, 0xd0, 0x01,
+  0xde, 0x01, 0xec, 0x01, 0xf7, 0x01, 0x04, 0x02, 0x0f, 0x02, 0x1d, 0x02,
+  0x27, 0x02, 0x00, 0x00, 0x0d, 0x00, 0x1e, 0x00, 0x2b, 0x00, 0x38, 0x00,
+  0x45, 0x00, 0x56, 0x00, 0x62, 0x00, 0x77, 0x00, 0x84, 0x00, 0x90, 0x00,
+  0x9c, 0x00, 0xa6, 0x00, 0xb2, 0x00, 0xc4, 0x00, 0xd0, 0x00, 0xe2, 0x00,
+  0xf4, 0x00, 0x00, 0x01, 0x0b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x42, 0x01,
+  0x56, 0x01, 0x66, 0x01, 0x76, 0x01, 0x86, 0x01, 0x96, 0x01, 0xae, 0x01,
+  0xc1, 0x01, 0xcd, 0x01, 0xdd, 0x01, 0xef, 0x01, 0x00, 0x00, 0x0e, 0x00,
+  0x24, 0x00, 0x32, 0x00, 0x3f, 0x00, 0x4c, 0x00, 0x58, 0x00, 0x64, 0x00,
+  0x6e, 0x00, 0x78, 0x00, 0x88, 0x00, 0x94, 0x00, 0xa1, 0x00, 0xad, 0x00,
+  0xb9, 0x00, 0xc6, 0x00, 0xd2, 0x00, 0xde, 0x00, 0xea, 0x00, 0xf6, 0x00,
+  0x03, 0x01, 0x10, 0x01, 0x1e, 0x01, 0x2f, 0x01, 0x3d, 0x01, 0x49, 0x01,
+  0x55, 0x01, 0x63, 0x01, 0x73, 0x01, 0x7f, 0x01, 0x8d, 0x01, 0x99, 0x01,
+  0xa3, 0x01, 0xaf, 0x01, 0xc3, 0x01, 0xd1, 0x01, 0xde, 0x01, 0xec, 0x01,
+  0xf8, 0x01, 0x04, 0x02, 0x10, 0x02, 0x00, 0x00, 0x0d, 0x00, 0x1e, 0x00,
+  0x35, 0x00, 0x45, 0x00, 0x58, 0x00, 0x6a, 0x00, 0x7a, 0x00, 0x8a, 0x00,
+  0x9a, 0x00, 0xa3, 0x00, 0xb6, 0x00, 0xc6, 0x00, 0xd4, 0x00, 0xe3, 0x00,
+  0xf1, 0x00, 0x00, 0x01
+};
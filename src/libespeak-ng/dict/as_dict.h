@@ -1,5 +1,7 @@
 #pragma once
-const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
+#include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/as_dict_index.h>
+const unsigned char __espeakng_dict_as[] __attribute__((aligned((4)))) = {
   0x00, 0x04, 0x00, 0x00, 0x98, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x12, 0x04, 0x5f, 0x64, 0x70, 0x74, 0x0a, 0x49,
@@ -419,4 +421,11 @@ const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
   0x3a, 0x23, 0x6d, 0x00, 0x02, 0x11, 0x42, 0x03, 0x3a, 0x79, 0x00, 0x07,
   0x00
 };
-size_t __espeakng_dictlen = 5005;
+
+BackgroundAudioDictionary dict_as = {
+    "as",
+    5005,
+    __espeakng_dict_as,
+    2696,
+    __espeakng_dictindex_as
+};
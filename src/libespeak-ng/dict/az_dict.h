@@ -1,5 +1,7 @@
 #pragma once
-const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
+#include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/az_dict_index.h>
+const unsigned char __espeakng_dict_az[] __attribute__((aligned((4)))) = {
   0x00, 0x04, 0x00, 0x00, 0x3d, 0xa9, 0x00, 0x00, 0x00, 0x50, 0x19, 0xf0,
   0x9f, 0x91, 0xa9, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xe2, 0x80,
   0x8d, 0xf0, 0x9f, 0x91, 0xa7, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa7,
@@ -3649,4 +3651,11 @@ const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
   0x00, 0x03, 0x39, 0x00, 0x07, 0x06, 0x7a, 0x00, 0x03, 0x59, 0x00, 0x07,
   0x06, 0x00, 0xc3, 0xa4, 0x03, 0x7d, 0x00, 0x07, 0x00
 };
-size_t __espeakng_dictlen = 43773;
+
+BackgroundAudioDictionary dict_az = {
+    "az",
+    43773,
+    __espeakng_dict_az,
+    7238,
+    __espeakng_dictindex_az
+};
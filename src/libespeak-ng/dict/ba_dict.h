@@ -1,5 +1,7 @@
 #pragma once
-const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
+#include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/ba_dict_index.h>
+const unsigned char __espeakng_dict_ba[] __attribute__((aligned((4)))) = {
   0x00, 0x04, 0x00, 0x00, 0x9a, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x0e, 0x04, 0x5f, 0x64, 0x70, 0x74, 0x0a, 0x48,
@@ -176,4 +178,11 @@ const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
   0x00, 0x07, 0x06, 0xd3, 0xa9, 0x00, 0x03, 0x6d, 0x00, 0x07, 0x06, 0x00,
   0x24, 0x03, 0x49, 0x27, 0x37, 0x70, 0x33, 0x00, 0x07, 0x00
 };
-size_t __espeakng_dictlen = 2098;
+
+BackgroundAudioDictionary dict_ba = {
+    "ba",
+    2098,
+    __espeakng_dict_ba,
+    2278,
+    __espeakng_dictindex_ba
+};
@@ -1,5 +1,7 @@
 #pragma once
-const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
+#include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/be_dict_index.h>
+const unsigned char __espeakng_dict_be[] __attribute__((aligned((4)))) = {
   0x00, 0x04, 0x00, 0x00, 0x6c, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -222,4 +224,11 @@ const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
   0x00, 0x01, 0x11, 0x43, 0x03, 0x26, 0x25, 0x00, 0x07, 0x06, 0x01, 0x3f,
   0x00, 0x03, 0x3a, 0x00, 0x07, 0x06, 0x27, 0x00, 0x03, 0x00, 0x07, 0x00
 };
-size_t __espeakng_dictlen = 2652;
+
+BackgroundAudioDictionary dict_be = {
+    "be",
+    2652,
+    __espeakng_dict_be,
+    2300,
+    __espeakng_dictindex_be
+};
@@ -1,5 +1,7 @@
 #pragma once
-const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
+#include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/bg_dict_index.h>
+const unsigned char __espeakng_dict_bg[] __attribute__((aligned((4)))) = {
   0x00, 0x04, 0x00, 0x00, 0x6b, 0x4e, 0x01, 0x00, 0x00, 0x5f, 0x19, 0xf0,
   0x9f, 0x91, 0xa9, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xe2, 0x80,
   0x8d, 0xf0, 0x9f, 0x91, 0xa7, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa7,
@@ -7256,4 +7258,11 @@ const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
   0x80, 0x03, 0x08, 0x00, 0x24, 0x03, 0x49, 0x06, 0x27, 0x40, 0x23, 0x22,
   0x00, 0x07, 0x00
 };
-size_t __espeakng_dictlen = 87051;
+
+BackgroundAudioDictionary dict_bg = {
+    "bg",
+    87051,
+    __espeakng_dict_bg,
+    16048,
+    __espeakng_dictindex_bg
+};
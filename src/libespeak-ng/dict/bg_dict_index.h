@@ -0,0 +1,1341 @@
+#pragma once
+const unsigned char __espeakng_dictindex_bg[] __attribute__((aligned((4)))) = {
+  0x45, 0x44, 0x58, 0x31, 0x0b, 0x54, 0x01, 0x00, 0x6b, 0x4e, 0x01, 0x00,
+  0x34, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x0a, 0x00,
+  0x0a, 0x00, 0x0a, 0x00, 0x0c, 0x00, 0x0e, 0x00, 0x0f, 0x00, 0x0f, 0x00,
+  0x12, 0x00, 0x13, 0x00, 0x14, 0x00, 0x14, 0x00, 0x16, 0x00, 0x16, 0x00,
+  0x18, 0x00, 0x19, 0x00, 0x1a, 0x00, 0x1e, 0x00, 0x1e, 0x00, 0x22, 0x00,
+  0x23, 0x00, 0x25, 0x00, 0x2a, 0x00, 0x33, 0x00, 0x34, 0x00, 0x49, 0x00,
+  0x4a, 0x00, 0x55, 0x00, 0x56, 0x00, 0x60, 0x00, 0x61, 0x00, 0x69, 0x00,
+  0x6a, 0x00, 0x6f, 0x00, 0x6f, 0x00, 0x75, 0x00, 0x76, 0x00, 0x77, 0x00,
+  0x78, 0x00, 0x78, 0x00, 0x78, 0x00, 0x7b, 0x00, 0x7c, 0x00, 0x7f, 0x00,
+  0x7f, 0x00, 0x80, 0x00, 0x80, 0x00, 0x82, 0x00, 0x82, 0x00, 0x84, 0x00,
+  0x84, 0x00, 0x85, 0x00, 0x85, 0x00, 0x8d, 0x00, 0x8e, 0x00, 0x9d, 0x00,
+  0x9e, 0x00, 0xa5, 0x00, 0xa6, 0x00, 0xb2, 0x00, 0xb4, 0x00, 0xc2, 0x00,
+  0xc5, 0x00, 0xc8, 0x00, 0xc9, 0x00, 0xcf, 0x00, 0xcf, 0x00, 0xd1, 0x00,
+  0xd2, 0x00, 0xd2, 0x00, 0xd5, 0x00, 0xd6, 0x00, 0xd6, 0x00, 0xdf, 0x00,
+  0xdf, 0x00, 0xe7, 0x00, 0xe7, 0x00, 0xe9, 0x00, 0xe9, 0x00, 0xeb, 0x00,
+  0xed, 0x00, 0xef, 0x00, 0xfa, 0x00, 0xfd, 0x00, 0x09, 0x01, 0x15, 0x01,
+  0x1d, 0x01, 0x2d, 0x01, 0x3d, 0x01, 0x48, 0x01, 0x51, 0x01, 0x5f, 0x01,
+  0x6c, 0x01, 0x71, 0x01, 0x77, 0x01, 0x7d, 0x01, 0x82, 0x01, 0x87, 0x01,
+  0x8b, 0x01, 0x8c, 0x01, 0x90, 0x01, 0x90, 0x01, 0x95, 0x01, 0x96, 0x01,
+  0x9c, 0x01, 0xa7, 0x01, 0xb1, 0x01, 0xbb, 0x01, 0xbf, 0x01, 0xc0, 0x01,
+  0xc7, 0x01, 0xcb, 0x01, 0xce, 0x01, 0xd3, 0x01, 0xdd, 0x01, 0xe2, 0x01,
+  0xef, 0x01, 0xf4, 0x01, 0x02, 0x02, 0x12, 0x02, 0x1d, 0x02, 0x2f, 0x02,
+  0x37, 0x02, 0x4c, 0x02, 0x55, 0x02, 0x66, 0x02, 0x75, 0x02, 0x80, 0x02,
+  0x80, 0x02, 0x88, 0x02, 0x8b, 0x02, 0x95, 0x02, 0x97, 0x02, 0x9a, 0x02,
+  0x9c, 0x02, 0x9f, 0x02, 0xa3, 0x02, 0xa6, 0x02, 0xaa, 0x02, 0xad, 0x02,
+  0xb4, 0x02, 0xb5, 0x02, 0xba, 0x02, 0xbc, 0x02, 0xbd, 0x02, 0xc4, 0x02,
+  0xc8, 0x02, 0xcd, 0x02, 0xcf, 0x02, 0xd6, 0x02, 0xdc, 0x02, 0xe4, 0x02,
+  0xe9, 0x02, 0xf9, 0x02, 0xfb, 0x02, 0x00, 0x03, 0x04, 0x03, 0x0b, 0x03,
+  0x0d, 0x03, 0x13, 0x03, 0x15, 0x03, 0x1b, 0x03, 0x1f, 0x03, 0x20, 0x03,
+  0x22, 0x03, 0x23, 0x03, 0x24, 0x03, 0x28, 0x03, 0x29, 0x03, 0x29, 0x03,
+  0x2b, 0x03, 0x2d, 0x03, 0x2d, 0x03, 0x2f, 0x03, 0x30, 0x03, 0x34, 0x03,
+  0x35, 0x03, 0x35, 0x03, 0x38, 0x03, 0x39, 0x03, 0x3e, 0x03, 0x42, 0x03,
+  0x45, 0x03, 0x48, 0x03, 0x49, 0x03, 0x4f, 0x03, 0x50, 0x03, 0x58, 0x03,
+  0x58, 0x03, 0x65, 0x03, 0x68, 0x03, 0x6a, 0x03, 0x6d, 0x03, 0x6f, 0x03,
+  0x72, 0x03, 0x74, 0x03, 0x75, 0x03, 0x76, 0x03, 0x78, 0x03, 0x79, 0x03,
+  0x7d, 0x03, 0x7e, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03,
+  0x81, 0x03, 0x81, 0x03, 0x83, 0x03, 0x88, 0x03, 0x8a, 0x03, 0x91, 0x03,
+  0x94, 0x03, 0x96, 0x03, 0x9a, 0x03, 0x9e, 0x03, 0xa1, 0x03, 0xaa, 0x03,
+  0xae, 0x03, 0xb1, 0x03, 0xb4, 0x03, 0xb7, 0x03, 0xb8, 0x03, 0xb8, 0x03,
+  0xba, 0x03, 0xbb, 0x03, 0xc3, 0x03, 0xc5, 0x03, 0xc9, 0x03, 0xcc, 0x03,
+  0xd3, 0x03, 0xd5, 0x03, 0xd9, 0x03, 0xda, 0x03, 0xdb, 0x03, 0xdb, 0x03,
+  0xdc, 0x03, 0xdd, 0x03, 0xdf, 0x03, 0xe0, 0x03, 0xe1, 0x03, 0xe3, 0x03,
+  0xe6, 0x03, 0xea, 0x03, 0xeb, 0x03, 0xf0, 0x03, 0xf1, 0x03, 0xf4, 0x03,
+  0xf5, 0x03, 0xf6, 0x03, 0xf7, 0x03, 0xf8, 0x03, 0xf8, 0x03, 0xfa, 0x03,
+  0xfa, 0x03, 0xfb, 0x03, 0xfc, 0x03, 0x01, 0x04, 0x02, 0x04, 0x05, 0x04,
+  0x07, 0x04, 0x09, 0x04, 0x0c, 0x04, 0x0e, 0x04, 0x0e, 0x04, 0x12, 0x04,
+  0x13, 0x04, 0x15, 0x04, 0x17, 0x04, 0x19, 0x04, 0x1b, 0x04, 0x1b, 0x04,
+  0x1c, 0x04, 0x1f, 0x04, 0x20, 0x04, 0x23, 0x04, 0x2b, 0x04, 0x2e, 0x04,
+  0x33, 0x04, 0x36, 0x04, 0x38, 0x04, 0x38, 0x04, 0x3b, 0x04, 0x3c, 0x04,
+  0x44, 0x04, 0x46, 0x04, 0x49, 0x04, 0x49, 0x04, 0x4a, 0x04, 0x4b, 0x04,
+  0x4c, 0x04, 0x4c, 0x04, 0x51, 0x04, 0x51, 0x04, 0x53, 0x04, 0x54, 0x04,
+  0x54, 0x04, 0x55, 0x04, 0x57, 0x04, 0x57, 0x04, 0x58, 0x04, 0x58, 0x04,
+  0x59, 0x04, 0x5b, 0x04, 0x5d, 0x04, 0x5e, 0x04, 0x60, 0x04, 0x63, 0x04,
+  0x64, 0x04, 0x67, 0x04, 0x6e, 0x04, 0x70, 0x04, 0x76, 0x04, 0x77, 0x04,
+  0x78, 0x04, 0x79, 0x04, 0x7f, 0x04, 0x80, 0x04, 0x83, 0x04, 0x84, 0x04,
+  0x85, 0x04, 0x85, 0x04, 0x87, 0x04, 0x87, 0x04, 0x8b, 0x04, 0x8d, 0x04,
+  0x8e, 0x04, 0x91, 0x04, 0x91, 0x04, 0x92, 0x04, 0x93, 0x04, 0x94, 0x04,
+  0x94, 0x04, 0x94, 0x04, 0x95, 0x04, 0x96, 0x04, 0x96, 0x04, 0x96, 0x04,
+  0x98, 0x04, 0x9f, 0x04, 0xa3, 0x04, 0xa6, 0x04, 0xba, 0x04, 0xbf, 0x04,
+  0xcf, 0x04, 0xd3, 0x04, 0xe9, 0x04, 0xeb, 0x04, 0xfb, 0x04, 0xfe, 0x04,
+  0x03, 0x05, 0x04, 0x05, 0x07, 0x05, 0x0a, 0x05, 0x0e, 0x05, 0x12, 0x05,
+  0x15, 0x05, 0x18, 0x05, 0x1b, 0x05, 0x22, 0x05, 0x24, 0x05, 0x27, 0x05,
+  0x28, 0x05, 0x2b, 0x05, 0x2c, 0x05, 0x2d, 0x05, 0x2e, 0x05, 0x32, 0x05,
+  0x35, 0x05, 0x3a, 0x05, 0x3c, 0x05, 0x3f, 0x05, 0x48, 0x05, 0x4e, 0x05,
+  0x60, 0x05, 0x6a, 0x05, 0x79, 0x05, 0x82, 0x05, 0x98, 0x05, 0x99, 0x05,
+  0xae, 0x05, 0xb2, 0x05, 0xbc, 0x05, 0xbe, 0x05, 0xc9, 0x05, 0xcb, 0x05,
+  0xd0, 0x05, 0xd5, 0x05, 0xdb, 0x05, 0xde, 0x05, 0xe2, 0x05, 0xe4, 0x05,
+  0xe6, 0x05, 0xe7, 0x05, 0xea, 0x05, 0xea, 0x05, 0xf2, 0x05, 0xf3, 0x05,
+  0xf8, 0x05, 0xf9, 0x05, 0xfd, 0x05, 0xfe, 0x05, 0x06, 0x06, 0x0a, 0x06,
+  0x12, 0x06, 0x18, 0x06, 0x20, 0x06, 0x23, 0x06, 0x2e, 0x06, 0x31, 0x06,
+  0x39, 0x06, 0x41, 0x06, 0x4c, 0x06, 0x4d, 0x06, 0x5b, 0x06, 0x62, 0x06,
+  0x68, 0x06, 0x6c, 0x06, 0x70, 0x06, 0x74, 0x06, 0x75, 0x06, 0x77, 0x06,
+  0x79, 0x06, 0x7a, 0x06, 0x7d, 0x06, 0x7f, 0x06, 0x80, 0x06, 0x83, 0x06,
+  0x83, 0x06, 0x83, 0x06, 0x83, 0x06, 0x83, 0x06, 0x84, 0x06, 0x87, 0x06,
+  0x8b, 0x06, 0x8d, 0x06, 0x95, 0x06, 0x96, 0x06, 0x9c, 0x06, 0xa0, 0x06,
+  0xad, 0x06, 0xaf, 0x06, 0xb7, 0x06, 0xb9, 0x06, 0xbe, 0x06, 0xc1, 0x06,
+  0xc8, 0x06, 0xc9, 0x06, 0xcc, 0x06, 0xce, 0x06, 0xd4, 0x06, 0xd7, 0x06,
+  0xda, 0x06, 0xdc, 0x06, 0xdf, 0x06, 0xe0, 0x06, 0xe4, 0x06, 0xe6, 0x06,
+  0xe7, 0x06, 0xea, 0x06, 0xec, 0x06, 0xec, 0x06, 0xed, 0x06, 0xed, 0x06,
+  0xed, 0x06, 0xf5, 0x06, 0xfb, 0x06, 0x07, 0x07, 0x07, 0x07, 0x12, 0x07,
+  0x15, 0x07, 0x1e, 0x07, 0x22, 0x07, 0x2d, 0x07, 0x34, 0x07, 0x3a, 0x07,
+  0x3b, 0x07, 0x3e, 0x07, 0x40, 0x07, 0x44, 0x07, 0x49, 0x07, 0x53, 0x07,
+  0x56, 0x07, 0x62, 0x07, 0x66, 0x07, 0x70, 0x07, 0x73, 0x07, 0x84, 0x07,
+  0x88, 0x07, 0x96, 0x07, 0x9c, 0x07, 0xa8, 0x07, 0xac, 0x07, 0xad, 0x07,
+  0xae, 0x07, 0xb1, 0x07, 0xb3, 0x07, 0xb9, 0x07, 0xb9, 0x07, 0xc0, 0x07,
+  0xc3, 0x07, 0xc9, 0x07, 0xcb, 0x07, 0xd5, 0x07, 0xd7, 0x07, 0xde, 0x07,
+  0xe5, 0x07, 0xed, 0x07, 0xef, 0x07, 0xf1, 0x07, 0xf4, 0x07, 0xf6, 0x07,
+  0xfc, 0x07, 0x01, 0x08, 0x08, 0x08, 0x0d, 0x08, 0x12, 0x08, 0x18, 0x08,
+  0x1d, 0x08, 0x23, 0x08, 0x29, 0x08, 0x2f, 0x08, 0x32, 0x08, 0x39, 0x08,
+  0x3b, 0x08, 0x43, 0x08, 0x48, 0x08, 0x50, 0x08, 0x53, 0x08, 0x54, 0x08,
+  0x56, 0x08, 0x5b, 0x08, 0x5e, 0x08, 0x66, 0x08, 0x67, 0x08, 0x6d, 0x08,
+  0x71, 0x08, 0x7b, 0x08, 0x81, 0x08, 0x86, 0x08, 0x88, 0x08, 0x8c, 0x08,
+  0x90, 0x08, 0x95, 0x08, 0x98, 0x08, 0x9a, 0x08, 0x9c, 0x08, 0x9d, 0x08,
+  0x9e, 0x08, 0xa0, 0x08, 0xa0, 0x08, 0xa0, 0x08, 0xa1, 0x08, 0xa1, 0x08,
+  0xa2, 0x08, 0xa4, 0x08, 0xa4, 0x08, 0xa5, 0x08, 0xa7, 0x08, 0xaa, 0x08,
+  0xac, 0x08, 0xaf, 0x08, 0xb0, 0x08, 0xb7, 0x08, 0xb8, 0x08, 0xc4, 0x08,
+  0xcd, 0x08, 0xd1, 0x08, 0xd8, 0x08, 0xda, 0x08, 0xdf, 0x08, 0xe5, 0x08,
+  0xe7, 0x08, 0xea, 0x08, 0xee, 0x08, 0xf1, 0x08, 0xf4, 0x08, 0xf6, 0x08,
+  0xf7, 0x08, 0xf9, 0x08, 0xfa, 0x08, 0xfd, 0x08, 0xfd, 0x08, 0x00, 0x09,
+  0x00, 0x09, 0x01, 0x09, 0x04, 0x09, 0x04, 0x09, 0x04, 0x09, 0x04, 0x09,
+  0x04, 0x09, 0x05, 0x09, 0x05, 0x09, 0x0c, 0x09, 0x0d, 0x09, 0x14, 0x09,
+  0x17, 0x09, 0x1e, 0x09, 0x23, 0x09, 0x2c, 0x09, 0x33, 0x09, 0x3d, 0x09,
+  0x42, 0x09, 0x4a, 0x09, 0x52, 0x09, 0x56, 0x09, 0x61, 0x09, 0x64, 0x09,
+  0x66, 0x09, 0x6c, 0x09, 0x6d, 0x09, 0x6f, 0x09, 0x71, 0x09, 0x77, 0x09,
+  0x7a, 0x09, 0x7c, 0x09, 0x81, 0x09, 0x83, 0x09, 0x85, 0x09, 0x87, 0x09,
+  0x8c, 0x09, 0x8e, 0x09, 0x8f, 0x09, 0x91, 0x09, 0x92, 0x09, 0x92, 0x09,
+  0x94, 0x09, 0x98, 0x09, 0x9b, 0x09, 0xa1, 0x09, 0xa2, 0x09, 0xae, 0x09,
+  0xb4, 0x09, 0xbb, 0x09, 0xc2, 0x09, 0xc6, 0x09, 0xcd, 0x09, 0xd5, 0x09,
+  0xd9, 0x09, 0xdf, 0x09, 0xe4, 0x09, 0xeb, 0x09, 0xec, 0x09, 0xf1, 0x09,
+  0xf5, 0x09, 0x01, 0x0a, 0x07, 0x0a, 0x15, 0x0a, 0x18, 0x0a, 0x1f, 0x0a,
+  0x22, 0x0a, 0x28, 0x0a, 0x28, 0x0a, 0x2b, 0x0a, 0x32, 0x0a, 0x37, 0x0a,
+  0x37, 0x0a, 0x3c, 0x0a, 0x3d, 0x0a, 0x40, 0x0a, 0x41, 0x0a, 0x48, 0x0a,
+  0x48, 0x0a, 0x52, 0x0a, 0x54, 0x0a, 0x57, 0x0a, 0x59, 0x0a, 0x5d, 0x0a,
+  0x5d, 0x0a, 0x64, 0x0a, 0x67, 0x0a, 0x68, 0x0a, 0x6a, 0x0a, 0x6c, 0x0a,
+  0x6c, 0x0a, 0x70, 0x0a, 0x72, 0x0a, 0x75, 0x0a, 0x78, 0x0a, 0x7d, 0x0a,
+  0x80, 0x0a, 0x84, 0x0a, 0x87, 0x0a, 0x89, 0x0a, 0x8b, 0x0a, 0x8c, 0x0a,
+  0x8e, 0x0a, 0x8f, 0x0a, 0x91, 0x0a, 0x94, 0x0a, 0x95, 0x0a, 0x9f, 0x0a,
+  0xa4, 0x0a, 0xaf, 0x0a, 0xb5, 0x0a, 0xc0, 0x0a, 0xc5, 0x0a, 0xd0, 0x0a,
+  0xd7, 0x0a, 0xde, 0x0a, 0xe1, 0x0a, 0xe5, 0x0a, 0xec, 0x0a, 0xf1, 0x0a,
+  0xf7, 0x0a, 0xfc, 0x0a, 0xff, 0x0a, 0x05, 0x0b, 0x0d, 0x0b, 0x14, 0x0b,
+  0x1a, 0x0b, 0x21, 0x0b, 0x28, 0x0b, 0x2e, 0x0b, 0x35, 0x0b, 0x3b, 0x0b,
+  0x40, 0x0b, 0x46, 0x0b, 0x4d, 0x0b, 0x53, 0x0b, 0x59, 0x0b, 0x62, 0x0b,
+  0x67, 0x0b, 0x77, 0x0b, 0x84, 0x0b, 0x95, 0x0b, 0x9d, 0x0b, 0xae, 0x0b,
+  0xba, 0x0b, 0xc7, 0x0b, 0xd2, 0x0b, 0xd9, 0x0b, 0xe3, 0x0b, 0xeb, 0x0b,
+  0xf3, 0x0b, 0xfb, 0x0b, 0x02, 0x0c, 0x0a, 0x0c, 0x11, 0x0c, 0x1c, 0x0c,
+  0x27, 0x0c, 0x2e, 0x0c, 0x3a, 0x0c, 0x44, 0x0c, 0x4c, 0x0c, 0x55, 0x0c,
+  0x64, 0x0c, 0x6a, 0x0c, 0x75, 0x0c, 0x7c, 0x0c, 0x86, 0x0c, 0x8c, 0x0c,
+  0x94, 0x0c, 0x9d, 0x0c, 0xa5, 0x0c, 0xae, 0x0c, 0xb7, 0x0c, 0xc9, 0x0c,
+  0xd3, 0x0c, 0xe4, 0x0c, 0xf6, 0x0c, 0xff, 0x0c, 0x10, 0x0d, 0x1b, 0x0d,
+  0x28, 0x0d, 0x2f, 0x0d, 0x38, 0x0d, 0x42, 0x0d, 0x4b, 0x0d, 0x55, 0x0d,
+  0x5e, 0x0d, 0x63, 0x0d, 0x6e, 0x0d, 0x73, 0x0d, 0x7e, 0x0d, 0x85, 0x0d,
+  0x91, 0x0d, 0x9b, 0x0d, 0xa5, 0x0d, 0xad, 0x0d, 0xb7, 0x0d, 0xbf, 0x0d,
+  0xc7, 0x0d, 0xce, 0x0d, 0xd7, 0x0d, 0xe1, 0x0d, 0xea, 0x0d, 0xf0, 0x0d,
+  0xfc, 0x0d, 0x02, 0x0e, 0x0c, 0x0e, 0x14, 0x0e, 0x1d, 0x0e, 0x26, 0x0e,
+  0x31, 0x0e, 0x3a, 0x0e, 0x45, 0x0e, 0x4d, 0x0e, 0x54, 0x0e, 0x5a, 0x0e,
+  0x60, 0x0e, 0x65, 0x0e, 0x6d, 0x0e, 0x71, 0x0e, 0x77, 0x0e, 0x7b, 0x0e,
+  0x80, 0x0e, 0x84, 0x0e, 0x89, 0x0e, 0x8f, 0x0e, 0x94, 0x0e, 0x99, 0x0e,
+  0x9e, 0x0e, 0xa3, 0x0e, 0xaa, 0x0e, 0xad, 0x0e, 0xb0, 0x0e, 0xb4, 0x0e,
+  0xbc, 0x0e, 0xc0, 0x0e, 0xc9, 0x0e, 0xce, 0x0e, 0xdb, 0x0e, 0xe0, 0x0e,
+  0xef, 0x0e, 0xf2, 0x0e, 0xfb, 0x0e, 0x02, 0x0f, 0x0a, 0x0f, 0x0d, 0x0f,
+  0x1b, 0x0f, 0x1f, 0x0f, 0x24, 0x0f, 0x29, 0x0f, 0x2d, 0x0f, 0x2e, 0x0f,
+  0x31, 0x0f, 0x35, 0x0f, 0x39, 0x0f, 0x3b, 0x0f, 0x40, 0x0f, 0x41, 0x0f,
+  0x42, 0x0f, 0x45, 0x0f, 0x49, 0x0f, 0x4b, 0x0f, 0x4f, 0x0f, 0x52, 0x0f,
+  0x55, 0x0f, 0x5b, 0x0f, 0x5f, 0x0f, 0x61, 0x0f, 0x69, 0x0f, 0x6c, 0x0f,
+  0x76, 0x0f, 0x79, 0x0f, 0x80, 0x0f, 0x85, 0x0f, 0x8d, 0x0f, 0x93, 0x0f,
+  0x9e, 0x0f, 0xa1, 0x0f, 0xaa, 0x0f, 0xad, 0x0f, 0xb4, 0x0f, 0xb6, 0x0f,
+  0xba, 0x0f, 0xbc, 0x0f, 0xbf, 0x0f, 0xc3, 0x0f, 0xc7, 0x0f, 0xcd, 0x0f,
+  0xd0, 0x0f, 0xd0, 0x0f, 0xd3, 0x0f, 0xd6, 0x0f, 0xd9, 0x0f, 0xde, 0x0f,
+  0xe1, 0x0f, 0xe4, 0x0f, 0xe8, 0x0f, 0xec, 0x0f, 0xf7, 0x0f, 0xff, 0x0f,
+  0x11, 0x10, 0x1c, 0x10, 0x28, 0x10, 0x30, 0x10, 0x3f, 0x10, 0x47, 0x10,
+  0x50, 0x10, 0x54, 0x10, 0x5e, 0x10, 0x65, 0x10, 0x6e, 0x10, 0x72, 0x10,
+  0x7d, 0x10, 0x81, 0x10, 0x85, 0x10, 0x8d, 0x10, 0x97, 0x10, 0xa0, 0x10,
+  0xaa, 0x10, 0xb6, 0x10, 0xbe, 0x10, 0xcd, 0x10, 0xd8, 0x10, 0xe0, 0x10,
+  0xf0, 0x10, 0xf7, 0x10, 0x02, 0x11, 0x0b, 0x11, 0x14, 0x11, 0x1f, 0x11,
+  0x28, 0x11, 0x32, 0x11, 0x3f, 0x11, 0x46, 0x11, 0x4e, 0x11, 0x54, 0x11,
+  0x59, 0x11, 0x5f, 0x11, 0x68, 0x11, 0x6f, 0x11, 0x74, 0x11, 0x7a, 0x11,
+  0x84, 0x11, 0x8c, 0x11, 0x97, 0x11, 0x9e, 0x11, 0xa5, 0x11, 0xa8, 0x11,
+  0xab, 0x11, 0xaf, 0x11, 0xb1, 0x11, 0xb7, 0x11, 0xbb, 0x11, 0xbf, 0x11,
+  0xc3, 0x11, 0xc5, 0x11, 0xcb, 0x11, 0xce, 0x11, 0xd1, 0x11, 0xd5, 0x11,
+  0xd8, 0x11, 0xdb, 0x11, 0xe1, 0x11, 0xe3, 0x11, 0xe8, 0x11, 0xea, 0x11,
+  0xeb, 0x11, 0xef, 0x11, 0xf2, 0x11, 0xf3, 0x11, 0xf7, 0x11, 0xfa, 0x11,
+  0xfd, 0x11, 0x00, 0x12, 0x03, 0x12, 0x04, 0x12, 0x07, 0x12, 0x07, 0x12,
+  0x08, 0x12, 0x08, 0x12, 0x09, 0x12, 0x0a, 0x12, 0x0b, 0x12, 0x0b, 0x12,
+  0x0b, 0x12, 0x0b, 0x12, 0x0b, 0x12, 0x0e, 0x12, 0x0e, 0x12, 0x0f, 0x12,
+  0x0f, 0x12, 0x0f, 0x12, 0x0f, 0x12, 0x0f, 0x12, 0x0f, 0x12, 0x0f, 0x12,
+  0x0f, 0x12, 0x10, 0x12, 0x11, 0x12, 0x12, 0x12, 0x13, 0x12, 0x13, 0x12,
+  0x15, 0x12, 0x16, 0x12, 0x18, 0x12, 0x18, 0x12, 0x18, 0x12, 0x19, 0x12,
+  0x19, 0x12, 0x19, 0x12, 0x19, 0x12, 0x19, 0x12, 0x1b, 0x12, 0x1b, 0x12,
+  0x1d, 0x12, 0x1d, 0x12, 0x1d, 0x12, 0x1d, 0x12, 0x1e, 0x12, 0x1e, 0x12,
+  0x1e, 0x12, 0x1e, 0x12, 0x1e, 0x12, 0x1e, 0x12, 0x1f, 0x12, 0x1f, 0x12,
+  0x1f, 0x12, 0x1f, 0x12, 0x21, 0x12, 0x22, 0x12, 0x23, 0x12, 0x24, 0x12,
+  0x25, 0x12, 0x29, 0x12, 0x31, 0x12, 0x31, 0x12, 0x33, 0x12, 0x34, 0x12,
+  0x34, 0x12, 0x00, 0x00, 0x8c, 0x02, 0x63, 0x31, 0x3e, 0xc6, 0x70, 0x35,
+  0x0b, 0xd5, 0x71, 0x50, 0x32, 0x95, 0xb7, 0xbd, 0x89, 0x0c, 0xaa, 0x8c,
+  0x04, 0x81, 0x2f, 0x6f, 0xe6, 0x6d, 0xb3, 0xa7, 0xd7, 0xd5, 0x65, 0xbd,
+  0xaa, 0xc5, 0x14, 0x22, 0x05, 0x96, 0xee, 0x0d, 0xc7, 0xec, 0xeb, 0xfe,
+  0xe8, 0xf9, 0xcc, 0x45, 0x6d, 0x82, 0xf9, 0xb4, 0x7e, 0x58, 0xc1, 0xff,
+  0x34, 0xdc, 0x7b, 0xa5, 0x0c, 0xbc, 0x74, 0xd8, 0x9f, 0xb5, 0xae, 0x56,
+  0xb7, 0x75, 0x38, 0x7d, 0xb9, 0x25, 0x82, 0x91, 0xf7, 0x74, 0xa8, 0x4d,
+  0x92, 0x9b, 0x57, 0x6c, 0xc4, 0xfe, 0xe9, 0x4b, 0x7e, 0xa0, 0x5a, 0x68,
+  0x91, 0x5b, 0x60, 0xce, 0x89, 0x82, 0x29, 0x24, 0x33, 0x25, 0x0f, 0xec,
+  0x62, 0x7e, 0x97, 0xc3, 0xe1, 0x00, 0xd3, 0x53, 0x48, 0x19, 0xd9, 0x63,
+  0x40, 0xe5, 0x3c, 0xaf, 0x48, 0xfb, 0x6c, 0x65, 0xee, 0xd0, 0x89, 0x39,
+  0xae, 0x52, 0x41, 0x00, 0xaa, 0x2f, 0xb4, 0xd3, 0xd5, 0x31, 0xb7, 0x95,
+  0xb5, 0x0f, 0x03, 0xe3, 0xf1, 0xde, 0x41, 0x38, 0xe8, 0xfa, 0x64, 0x65,
+  0x3a, 0x0b, 0xf2, 0xce, 0xf4, 0xd9, 0x22, 0x5f, 0x08, 0xbf, 0xee, 0x2c,
+  0xdb, 0x03, 0xc7, 0x35, 0xff, 0xa3, 0xa2, 0xfd, 0x39, 0x0b, 0x3c, 0x48,
+  0x91, 0x97, 0x45, 0xc1, 0x90, 0x85, 0x64, 0xbd, 0xdd, 0xb4, 0x22, 0x7e,
+  0x68, 0xc5, 0x9a, 0x24, 0x20, 0xc0, 0x42, 0x56, 0x07, 0xb9, 0x63, 0x86,
+  0xf9, 0x4b, 0xaf, 0x33, 0xb5, 0x3e, 0x50, 0xfb, 0x53, 0x9e, 0xad, 0x45,
+  0xd3, 0x99, 0xb8, 0xa5, 0x89, 0xb3, 0xd6, 0x07, 0xa9, 0xfb, 0xe5, 0x48,
+  0x9a, 0xa1, 0xde, 0xe3, 0xe4, 0x05, 0x38, 0x79, 0x72, 0x23, 0xdb, 0x84,
+  0x05, 0x22, 0xd6, 0xb6, 0x0e, 0xda, 0x78, 0x32, 0x34, 0x67, 0x9e, 0x8d,
+  0x01, 0x23, 0x73, 0xda, 0xe1, 0x11, 0xe3, 0x1e, 0xa5, 0xdc, 0xbe, 0x8e,
+  0x4b, 0xf9, 0x4e, 0x64, 0x8b, 0xf7, 0x06, 0xbb, 0x0e, 0xef, 0xda, 0x64,
+  0x14, 0x99, 0xc2, 0x6c, 0xa4, 0x9b, 0x3f, 0xa9, 0x75, 0x00, 0x28, 0xcc,
+  0x05, 0x16, 0xb1, 0xd0, 0x60, 0xe9, 0xcb, 0xd1, 0x62, 0x27, 0x83, 0xe4,
+  0x30, 0xa9, 0x88, 0xeb, 0xbc, 0x5b, 0x30, 0x41, 0x06, 0x21, 0xac, 0x1d,
+  0x6c, 0x02, 0x10, 0xb0, 0x45, 0x3e, 0x1a, 0xcc, 0x45, 0x74, 0xff, 0xde,
+  0xef, 0xac, 0x58, 0xbe, 0x79, 0x5e, 0xee, 0xcb, 0xa4, 0xb7, 0x01, 0x77,
+  0xc1, 0x03, 0x28, 0xdc, 0x56, 0x53, 0x17, 0x8d, 0xc4, 0x93, 0x7f, 0x9d,
+  0x74, 0xc2, 0xb7, 0x30, 0x25, 0x0e, 0x19, 0x0c, 0xa3, 0x5f, 0xfa, 0x87,
+  0x5d, 0x20, 0x0a, 0xb5, 0x08, 0x33, 0x53, 0xfb, 0x16, 0x6a, 0xa2, 0xfb,
+  0x04, 0x3b, 0x58, 0x16, 0xc8, 0xeb, 0x8d, 0xb6, 0xc3, 0xba, 0xa5, 0x56,
+  0xf4, 0x1a, 0xb7, 0x5c, 0x41, 0x16, 0x8a, 0x43, 0x5f, 0xbc, 0xfc, 0x2b,
+  0x12, 0x41, 0xb8, 0xc1, 0x23, 0xe7, 0x81, 0x93, 0x00, 0x57, 0x46, 0xc1,
+  0xf7, 0x1e, 0x6c, 0x8b, 0xed, 0x94, 0x87, 0xe8, 0xd2, 0xae, 0x45, 0xa5,
+  0xf5, 0x61, 0x61, 0xfb, 0x73, 0xfe, 0xa3, 0xa1, 0x49, 0xc2, 0xf4, 0x95,
+  0x2a, 0xa4, 0x1b, 0x60, 0xc7, 0xe7, 0x7a, 0x2c, 0x84, 0xde, 0x0a, 0x1a,
+  0x58, 0x99, 0xd7, 0x39, 0x16, 0xcf, 0xfe, 0x35, 0x1e, 0xa8, 0x94, 0xae,
+  0x62, 0x5b, 0x80, 0x1d, 0x90, 0xdf, 0x7f, 0x80, 0x47, 0x6c, 0x36, 0x4c,
+  0x03, 0x8e, 0xa4, 0x9d, 0x97, 0x0d, 0x97, 0x48, 0x0d, 0x23, 0xfe, 0xce,
+  0xba, 0xd4, 0x96, 0xc8, 0x97, 0x2f, 0x22, 0x09, 0xa4, 0x95, 0x64, 0x68,
+  0xbb, 0x42, 0x1c, 0x3a, 0xcc, 0xa2, 0x09, 0x81, 0xd6, 0xc8, 0x4e, 0x97,
+  0x6f, 0x4a, 0x67, 0x69, 0xcb, 0xe4, 0xe2, 0xf8, 0xb9, 0x0f, 0x54, 0x0b,
+  0xab, 0x2d, 0x4d, 0xa4, 0x55, 0x8b, 0x17, 0x32, 0x7a, 0x70, 0x7f, 0x1f,
+  0x78, 0xce, 0xb3, 0x35, 0xf1, 0x4d, 0xfe, 0x49, 0xfa, 0xc3, 0x76, 0x1b,
+  0x17, 0x86, 0xf4, 0x8a, 0xe2, 0xfc, 0xdf, 0x8e, 0x6a, 0xac, 0xce, 0xbd,
+  0xee, 0x27, 0xcf, 0x7e, 0xb4, 0xfb, 0x8c, 0x1c, 0x46, 0x61, 0x91, 0x12,
+  0x1f, 0x9b, 0xd6, 0x08, 0x0a, 0x79, 0x29, 0x27, 0x38, 0xf5, 0x13, 0x7d,
+  0xe4, 0xc4, 0x31, 0xe4, 0x55, 0xd0, 0x86, 0x89, 0x03, 0xd2, 0xd5, 0x0e,
+  0x8b, 0x31, 0x9d, 0xda, 0x80, 0x17, 0xba, 0xda, 0x18, 0x90, 0xb1, 0xd9,
+  0x85, 0xbe, 0x89, 0x0f, 0x7f, 0x7e, 0x2b, 0xe2, 0x9f, 0x3a, 0x46, 0x61,
+  0x64, 0x1b, 0xf6, 0x0f, 0xa7, 0x4e, 0xd5, 0x32, 0xd9, 0x25, 0x9c, 0x02,
+  0xfd, 0xd1, 0x0b, 0x11, 0x39, 0x27, 0x65, 0xa1, 0xd8, 0x1e, 0x79, 0x8e,
+  0xab, 0x55, 0xd7, 0xab, 0xdc, 0x21, 0xfa, 0xd6, 0xb9, 0xfb, 0x14, 0x8c,
+  0xe6, 0xc0, 0xb2, 0xf1, 0x72, 0x98, 0x66, 0xab, 0x98, 0xd1, 0x1f, 0xad,
+  0x66, 0xbe, 0x24, 0x2a, 0x8c, 0xa6, 0xe7, 0xd8, 0xd2, 0x5f, 0xce, 0x89,
+  0x36, 0x8b, 0xf9, 0xbe, 0x64, 0x97, 0xc0, 0xc3, 0x91, 0xb0, 0xc8, 0x57,
+  0x24, 0x2f, 0x65, 0x79, 0x02, 0x09, 0xcc, 0xb3, 0xe2, 0xf8, 0xd3, 0x18,
+  0x27, 0xf2, 0xed, 0xd8, 0x9a, 0x35, 0xe3, 0x9b, 0xe2, 0xaf, 0x00, 0x72,
+  0x25, 0x07, 0x48, 0xe7, 0x24, 0x34, 0x56, 0xf3, 0x24, 0x09, 0xd5, 0xbe,
+  0x61, 0x9a, 0x49, 0x32, 0xfe, 0x72, 0x2f, 0x60, 0xf0, 0x9a, 0xaf, 0x62,
+  0x1a, 0xfc, 0x20, 0xab, 0x1e, 0x7b, 0x25, 0x3f, 0xd8, 0x19, 0x6f, 0x51,
+  0xaa, 0xb4, 0xba, 0xa4, 0xe3, 0x75, 0x5a, 0xf9, 0xa9, 0x37, 0xb5, 0xb4,
+  0xa2, 0x32, 0xa6, 0xef, 0x14, 0x3a, 0x2a, 0x42, 0xa5, 0x81, 0x71, 0xff,
+  0x90, 0x85, 0x8c, 0xa6, 0x6c, 0x9a, 0xf1, 0x1f, 0x3b, 0x10, 0xbb, 0x48,
+  0xb5, 0x73, 0x16, 0xf7, 0x08, 0x09, 0x4a, 0x3c, 0x28, 0x2b, 0x9d, 0x9d,
+  0x07, 0x37, 0x98, 0xbe, 0x72, 0xff, 0xbd, 0x0d, 0x6a, 0xdc, 0xa7, 0x9c,
+  0xf7, 0x01, 0x69, 0xf2, 0x41, 0xbf, 0x45, 0x16, 0x65, 0xd7, 0x5e, 0x37,
+  0x70, 0xde, 0x11, 0x72, 0xd8, 0xac, 0xd5, 0x15, 0x31, 0x14, 0xac, 0xc3,
+  0xc6, 0xf2, 0x1c, 0x20, 0x06, 0x20, 0xbd, 0xc5, 0x42, 0xab, 0x5e, 0xb2,
+  0x06, 0x63, 0x58, 0x68, 0x7d, 0x33, 0x7b, 0x55, 0xfa, 0xff, 0x0d, 0xfd,
+  0x56, 0xe3, 0xbd, 0x30, 0xfb, 0xec, 0xbf, 0xa5, 0x95, 0x19, 0xbe, 0xcf,
+  0xa6, 0xbd, 0xd3, 0x16, 0x92, 0x3d, 0x9e, 0x28, 0xc9, 0x22, 0xb0, 0x68,
+  0x5f, 0x3f, 0x7e, 0x5a, 0x1f, 0xc9, 0x1e, 0x1c, 0x8b, 0x4b, 0x0f, 0xa1,
+  0x97, 0xbb, 0xd8, 0x52, 0xe0, 0xc9, 0xc7, 0x0b, 0xd6, 0x74, 0xbc, 0x21,
+  0x02, 0xa0, 0xf8, 0x17, 0x17, 0x17, 0x17, 0x2e, 0xd6, 0x26, 0xff, 0xd4,
+  0xfe, 0xd0, 0x6d, 0x54, 0x76, 0x30, 0x53, 0x33, 0x86, 0x81, 0x4b, 0xb2,
+  0xfb, 0xfa, 0x2d, 0xeb, 0xf8, 0x81, 0x99, 0x75, 0xa2, 0x20, 0x66, 0x43,
+  0xc9, 0x93, 0xe7, 0xaa, 0x98, 0x40, 0xaf, 0x61, 0x98, 0xb7, 0x9a, 0x7a,
+  0x87, 0x9e, 0x34, 0x53, 0x10, 0x69, 0x5f, 0x46, 0x52, 0x83, 0x52, 0xc8,
+  0x95, 0x3c, 0xba, 0x45, 0xcc, 0x0b, 0xc7, 0x08, 0x19, 0x49, 0x48, 0x5a,
+  0xd0, 0xbe, 0x61, 0x9a, 0xfb, 0x73, 0xf2, 0x88, 0x98, 0x43, 0xb0, 0xc4,
+  0x02, 0x0c, 0x51, 0xab, 0x60, 0x00, 0x21, 0xec, 0x12, 0xd5, 0x25, 0x7f,
+  0x92, 0x51, 0x25, 0x01, 0x80, 0x4d, 0x67, 0x9f, 0x4d, 0x1a, 0xd9, 0x56,
+  0x1d, 0xb6, 0x0c, 0x63, 0x1f, 0x30, 0xf8, 0x12, 0x31, 0x7d, 0x72, 0xe0,
+  0x04, 0x33, 0xb6, 0x7c, 0xbc, 0xc3, 0x14, 0xec, 0x74, 0xda, 0x4f, 0x7f,
+  0x3a, 0xff, 0x7b, 0x0c, 0xef, 0xa6, 0x6b, 0xe0, 0x77, 0x4e, 0xd7, 0x7c,
+  0xb5, 0x7a, 0xb4, 0xa9, 0x92, 0x59, 0xb5, 0x19, 0x70, 0xa1, 0x78, 0x47,
+  0xae, 0x71, 0x26, 0xb1, 0xa0, 0xca, 0x8b, 0x0d, 0xbb, 0xbb, 0xa8, 0x9e,
+  0xd4, 0x2e, 0x64, 0xfb, 0x62, 0x22, 0xea, 0x77, 0x55, 0x80, 0xf0, 0x19,
+  0x9a, 0x12, 0x5a, 0xb0, 0x7e, 0xaa, 0xfa, 0x60, 0x51, 0x73, 0x55, 0x99,
+  0x5e, 0xab, 0x02, 0x72, 0xca, 0x30, 0x5e, 0xbf, 0x26, 0x8c, 0x46, 0xbf,
+  0x0f, 0xdf, 0x80, 0x8c, 0x1e, 0xc3, 0xe4, 0x79, 0xd5, 0x74, 0x68, 0x94,
+  0x92, 0x40, 0xf0, 0xd4, 0x22, 0x47, 0x6d, 0xac, 0x87, 0x67, 0x06, 0x63,
+  0x6f, 0x8a, 0xd1, 0x2e, 0xeb, 0xa6, 0xd6, 0xc6, 0xc4, 0xa0, 0x18, 0xf9,
+  0x17, 0x0f, 0x8f, 0x6a, 0x2c, 0xb1, 0xcb, 0x7c, 0x22, 0x4b, 0xe7, 0x74,
+  0x1f, 0xd2, 0xa9, 0xc5, 0x99, 0xd7, 0x18, 0x79, 0xa6, 0xf0, 0x7b, 0xf1,
+  0x83, 0xdd, 0xbd, 0x39, 0xdb, 0x3f, 0x5d, 0x02, 0x5d, 0xbe, 0x98, 0xf2,
+  0x2e, 0xc6, 0x0b, 0x68, 0x2e, 0xbb, 0xc3, 0x34, 0xa1, 0x42, 0xa3, 0x85,
+  0xdb, 0x13, 0xdc, 0x3c, 0x81, 0x74, 0x3d, 0xa0, 0xd6, 0xea, 0x22, 0xde,
+  0x8d, 0x8f, 0x0a, 0x37, 0xf5, 0x36, 0x21, 0xc7, 0x6a, 0xc5, 0x85, 0xc6,
+  0xd0, 0x0e, 0x2b, 0x0d, 0xd1, 0x46, 0x70, 0x64, 0xa0, 0x0d, 0xf8, 0x50,
+  0xc2, 0x71, 0x16, 0x32, 0x3b, 0x52, 0xc9, 0xf7, 0xe4, 0x60, 0x77, 0x63,
+  0x22, 0x22, 0x3d, 0x43, 0xac, 0x29, 0x04, 0x18, 0x4f, 0x38, 0x63, 0xa2,
+  0x9c, 0x61, 0x55, 0xb3, 0xc7, 0xfd, 0xa0, 0xaf, 0xe7, 0x07, 0xd9, 0xb9,
+  0x76, 0x88, 0x4c, 0xb4, 0x61, 0x24, 0x3f, 0xb9, 0xf4, 0x21, 0x22, 0xe5,
+  0xb7, 0x23, 0x64, 0x0c, 0x9b, 0xb3, 0x87, 0x35, 0xda, 0x97, 0xed, 0x73,
+  0xe0, 0x4c, 0xae, 0x93, 0x8f, 0x5b, 0x5a, 0x86, 0x40, 0x7d, 0xbb, 0xf6,
+  0x73, 0xc1, 0xe9, 0x78, 0x30, 0xce, 0x85, 0x1c, 0xc7, 0xc4, 0x37, 0x20,
+  0xdb, 0x7a, 0xa1, 0x26, 0x5b, 0x3c, 0x4d, 0xbf, 0xf9, 0x75, 0xda, 0x19,
+  0x1b, 0x30, 0xe3, 0x66, 0xc1, 0x47, 0xfb, 0xb6, 0x4b, 0x07, 0xa9, 0x8a,
+  0xfa, 0x0d, 0x34, 0x3d, 0x01, 0x4e, 0xa9, 0x49, 0xa9, 0xcf, 0xf3, 0x78,
+  0x65, 0xe3, 0xe8, 0xd0, 0x1a, 0xf0, 0x6c, 0xc9, 0x44, 0xea, 0xf3, 0x35,
+  0x4a, 0x94, 0x8d, 0x52, 0xbe, 0xa1, 0x3c, 0x2e, 0x8f, 0xfa, 0xc8, 0xa4,
+  0xb6, 0x43, 0xe1, 0xe8, 0xfc, 0x6d, 0x34, 0x7f, 0x03, 0x23, 0xee, 0xe1,
+  0x35, 0x03, 0x62, 0x12, 0x6e, 0xef, 0x69, 0x7e, 0x1f, 0x3f, 0xf1, 0x29,
+  0x26, 0x07, 0x10, 0x1a, 0xfe, 0x52, 0xaa, 0xa5, 0x40, 0xaa, 0x77, 0x32,
+  0x72, 0x04, 0x0d, 0x45, 0x33, 0x7d, 0x9a, 0xef, 0x62, 0x8c, 0xca, 0x47,
+  0x9f, 0x9e, 0xdc, 0xef, 0xc3, 0x62, 0x2e, 0x9b, 0xcb, 0xd9, 0xbf, 0xf9,
+  0x68, 0xa5, 0xcd, 0x97, 0x14, 0x66, 0x0c, 0x7e, 0xfd, 0x17, 0xfb, 0x02,
+  0xf8, 0xb8, 0xbb, 0x6a, 0xc1, 0x95, 0xab, 0x51, 0x30, 0xcf, 0xdd, 0x3c,
+  0x86, 0x75, 0xb6, 0x8a, 0xfe, 0x9e, 0x0a, 0x11, 0xe1, 0x36, 0x34, 0xa9,
+  0x36, 0x50, 0xde, 0xa0, 0xea, 0x45, 0x49, 0xf9, 0xf9, 0x4e, 0x65, 0xa8,
+  0xe9, 0xa7, 0x69, 0x56, 0x67, 0x3b, 0xa3, 0xe9, 0x6f, 0xcc, 0x5f, 0x75,
+  0x18, 0x77, 0x38, 0x8b, 0x6c, 0x1e, 0xbe, 0xad, 0xdb, 0x33, 0x9d, 0x32,
+  0xe4, 0x6e, 0x4e, 0x41, 0x72, 0x1b, 0xe4, 0xec, 0xed, 0xdf, 0xa0, 0x1c,
+  0x46, 0xa8, 0x1a, 0xc1, 0x72, 0xda, 0x09, 0x28, 0xde, 0xf9, 0xf9, 0xc3,
+  0x7b, 0x5a, 0x81, 0x2c, 0x43, 0x24, 0xfc, 0xcf, 0xbf, 0xd8, 0x2c, 0x30,
+  0x0c, 0xc3, 0x54, 0x51, 0xb9, 0x71, 0xa4, 0x46, 0x56, 0x7e, 0xf9, 0x71,
+  0xc8, 0x54, 0xd0, 0x63, 0x58, 0x79, 0x01, 0xf5, 0x28, 0x6f, 0x06, 0x5b,
+  0xd9, 0x29, 0x6d, 0x30, 0x6c, 0x6a, 0x6c, 0xc0, 0x55, 0x9b, 0xfa, 0xb9,
+  0x10, 0x76, 0xf6, 0x28, 0x42, 0xa7, 0x82, 0x00, 0xe5, 0x6d, 0x58, 0x92,
+  0x6e, 0x0e, 0x83, 0x4a, 0xe8, 0xa1, 0xe0, 0x65, 0x8c, 0xc7, 0x46, 0x9a,
+  0x64, 0x7a, 0x5a, 0x25, 0xc9, 0xeb, 0x8c, 0x32, 0x82, 0x88, 0x6b, 0x9d,
+  0x58, 0x8f, 0x35, 0xec, 0x47, 0x33, 0x6d, 0xf3, 0x19, 0x0f, 0x0e, 0x33,
+  0x63, 0x1c, 0x7e, 0xaf, 0x1d, 0xda, 0xb2, 0x3d, 0x1b, 0xe8, 0xd1, 0xc9,
+  0xcd, 0xbb, 0x28, 0x2e, 0xbe, 0x60, 0xd5, 0x70, 0x6a, 0xb0, 0xbb, 0x64,
+  0x57, 0x90, 0x32, 0xc4, 0x31, 0xd8, 0x49, 0x71, 0xa4, 0xb4, 0xf7, 0x2c,
+  0x36, 0x70, 0xcd, 0xfd, 0xf3, 0x94, 0xc0, 0x6b, 0xdf, 0x1d, 0x6d, 0xb6,
+  0xf7, 0x2c, 0x82, 0x19, 0x84, 0x61, 0x2c, 0xd4, 0x0f, 0xb3, 0xc4, 0x36,
+  0x0f, 0x37, 0x61, 0xf8, 0xd9, 0xf2, 0x78, 0xe9, 0xb1, 0x7a, 0xdf, 0xba,
+  0x66, 0xb7, 0x6b, 0x1d, 0xdc, 0x6e, 0x34, 0x2f, 0xee, 0x6e, 0x83, 0x51,
+  0xf0, 0x9c, 0xb7, 0xf8, 0x78, 0xd3, 0x08, 0x1d, 0xc5, 0x5d, 0x2b, 0xfd,
+  0x2c, 0x71, 0xab, 0xa7, 0x5a, 0x74, 0xf6, 0x15, 0x32, 0xb4, 0x6e, 0xd4,
+  0xcd, 0x0b, 0x71, 0xed, 0x1b, 0x27, 0x4b, 0xfc, 0xfe, 0x65, 0xac, 0x35,
+  0xc3, 0x83, 0x85, 0xd3, 0xb0, 0xbb, 0x00, 0x6b, 0xbd, 0x7f, 0x80, 0x31,
+  0x1f, 0xe4, 0xf7, 0x35, 0x54, 0xc3, 0x45, 0xc6, 0x9e, 0x3b, 0x98, 0x96,
+  0x78, 0xa7, 0x52, 0xee, 0x96, 0x5d, 0x7a, 0x48, 0xd1, 0x47, 0x88, 0xbc,
+  0xa1, 0xd6, 0xb6, 0x84, 0xf9, 0xe5, 0xa0, 0xec, 0x94, 0x9b, 0x2d, 0x2b,
+  0xf0, 0x1f, 0x94, 0x35, 0xce, 0xc5, 0xe6, 0xa4, 0x8e, 0xb4, 0x98, 0xd9,
+  0xa5, 0x84, 0x36, 0xd8, 0x56, 0xfb, 0xee, 0x20, 0x04, 0xc7, 0xc1, 0xa3,
+  0x08, 0xf7, 0x42, 0x42, 0x47, 0xd7, 0x85, 0x6d, 0xd4, 0xfe, 0x78, 0xa4,
+  0x0c, 0x81, 0x84, 0xe7, 0x43, 0xf0, 0x19, 0xca, 0xef, 0x22, 0xbc, 0xa6,
+  0xac, 0x7f, 0xed, 0xa4, 0x80, 0xc4, 0x85, 0x73, 0x65, 0x4c, 0xa1, 0x3b,
+  0xa6, 0x01, 0xa2, 0x12, 0xa3, 0xed, 0xa4, 0x5a, 0x97, 0x8c, 0xef, 0x93,
+  0xbb, 0xeb, 0xf3, 0xb6, 0x9e, 0x6e, 0x78, 0x63, 0x9e, 0x8a, 0x83, 0x7a,
+  0xf5, 0x28, 0x8f, 0x9f, 0x3b, 0x69, 0x04, 0xad, 0xa3, 0x5a, 0xc1, 0x59,
+  0x77, 0x70, 0xc0, 0xfc, 0xd8, 0xcc, 0xe1, 0xdd, 0x66, 0xc3, 0x51, 0x98,
+  0xcf, 0x06, 0xe2, 0x0e, 0x62, 0x02, 0x9b, 0x46, 0xab, 0xdd, 0x69, 0xca,
+  0x6b, 0x09, 0xb2, 0xec, 0xee, 0x21, 0xf8, 0x9d, 0xdc, 0xae, 0x52, 0x39,
+  0xe3, 0x61, 0x62, 0xf7, 0xf6, 0x45, 0xb7, 0x5c, 0x98, 0x2e, 0xe3, 0x94,
+  0x08, 0xbf, 0x4a, 0x27, 0xfd, 0x02, 0x1c, 0x53, 0xf9, 0xea, 0x3c, 0x5f,
+  0x5c, 0xc1, 0x2e, 0x5c, 0x9f, 0x61, 0xc2, 0xed, 0x85, 0xc4, 0xb1, 0x68,
+  0x31, 0x45, 0x9a, 0x23, 0x9e, 0x1f, 0x02, 0xfd, 0xd9, 0x85, 0x31, 0xcf,
+  0x32, 0x18, 0x83, 0xcb, 0x1a, 0x10, 0x7d, 0x78, 0x49, 0x1f, 0x2e, 0xcc,
+  0x70, 0xae, 0xf0, 0xa8, 0x5e, 0x14, 0x57, 0x29, 0x71, 0x72, 0x57, 0xd3,
+  0xcb, 0xcd, 0xda, 0xd0, 0x1f, 0x7a, 0x1e, 0x4d, 0xd7, 0x04, 0xf3, 0xda,
+  0x7e, 0xe6, 0x47, 0x05, 0xb3, 0xc2, 0x25, 0xd0, 0x13, 0xd6, 0x4e, 0xc5,
+  0x59, 0x35, 0x76, 0xb7, 0xb8, 0x0a, 0x27, 0xa4, 0x77, 0x11, 0x02, 0x03,
+  0xc0, 0x44, 0xcd, 0x0e, 0x7c, 0x51, 0xc8, 0x96, 0xb0, 0xe1, 0xef, 0x36,
+  0x70, 0x21, 0xe7, 0x01, 0x18, 0xd7, 0x07, 0x95, 0x95, 0x22, 0xb3, 0x4a,
+  0x07, 0x0e, 0x3d, 0x56, 0x8f, 0x12, 0x44, 0xa3, 0xcd, 0xef, 0x97, 0xf1,
+  0x02, 0x27, 0x48, 0xde, 0x49, 0x6a, 0xa7, 0x7e, 0xe6, 0x09, 0xff, 0xbf,
+  0x1d, 0xd9, 0xaa, 0xce, 0xdb, 0xb5, 0xf1, 0x49, 0xe4, 0x57, 0x20, 0xe0,
+  0xf2, 0x9d, 0xec, 0x60, 0x42, 0x6e, 0x65, 0xbe, 0xb8, 0xb0, 0xa7, 0x2e,
+  0xc4, 0x4d, 0xf9, 0xe6, 0x07, 0x49, 0xa8, 0x4e, 0x3e, 0x56, 0x87, 0xc4,
+  0x95, 0x41, 0x19, 0xa9, 0x6b, 0xa5, 0x3d, 0xb2, 0x57, 0xb9, 0xef, 0x52,
+  0x2f, 0xeb, 0xf9, 0x1e, 0x6b, 0x34, 0xae, 0x89, 0x95, 0x31, 0x5b, 0x0a,
+  0x64, 0x68, 0x41, 0xd7, 0x06, 0x5a, 0xd8, 0x23, 0x3c, 0x9d, 0xad, 0x5d,
+  0x0c, 0xcb, 0xb7, 0x0f, 0xd2, 0x99, 0x44, 0x12, 0x6c, 0x2a, 0xaa, 0xc4,
+  0x87, 0xdb, 0x27, 0xf1, 0x2a, 0x94, 0x62, 0xfb, 0xa9, 0x0f, 0x21, 0x51,
+  0x59, 0x59, 0xb0, 0x74, 0xdb, 0x96, 0xa1, 0x75, 0x12, 0x0a, 0x5e, 0x5e,
+  0x44, 0x17, 0x4c, 0xc0, 0x06, 0xf0, 0x99, 0x11, 0x51, 0x42, 0x35, 0x19,
+  0x3f, 0xc0, 0xe6, 0xad, 0x9a, 0x02, 0x08, 0x96, 0x7a, 0xe3, 0x71, 0x1f,
+  0x93, 0x59, 0xc2, 0xff, 0x4d, 0xa0, 0x47, 0x80, 0x1e, 0xf2, 0x3c, 0x11,
+  0x91, 0x8d, 0xe9, 0xc6, 0x7a, 0x2a, 0x3c, 0xa2, 0x13, 0x62, 0x85, 0x90,
+  0x9d, 0x0c, 0x59, 0xa0, 0x16, 0x86, 0xd8, 0x40, 0x15, 0xee, 0xec, 0xe4,
+  0x9b, 0x8d, 0x91, 0x15, 0x4a, 0xb7, 0xf5, 0x1d, 0xda, 0x64, 0x93, 0x1d,
+  0x76, 0xd2, 0xfd, 0x98, 0x03, 0xb5, 0x5d, 0x20, 0x02, 0xc7, 0xc0, 0x00,
+  0x3f, 0x7d, 0x98, 0x83, 0x35, 0x1a, 0x28, 0x13, 0x74, 0x15, 0xe6, 0x34,
+  0x78, 0x2d, 0x4a, 0x66, 0x46, 0x12, 0x7d, 0x21, 0xf4, 0xab, 0x9d, 0x92,
+  0x4a, 0x75, 0x4c, 0x20, 0x88, 0xb7, 0x18, 0xa7, 0xb7, 0xdc, 0x77, 0x7e,
+  0x1c, 0x74, 0x32, 0x23, 0xd6, 0xb6, 0xa5, 0x9d, 0xf5, 0x03, 0xe3, 0x09,
+  0x82, 0x7e, 0x33, 0x51, 0x08, 0xc4, 0xd3, 0x3a, 0xc9, 0x7c, 0x4e, 0x42,
+  0x2f, 0xea, 0x13, 0x9c, 0xf2, 0x56, 0xf0, 0xfa, 0x2b, 0xdb, 0x62, 0xa6,
+  0x2b, 0x2f, 0x9f, 0xa8, 0xf4, 0x79, 0x4b, 0x75, 0x61, 0x3a, 0x69, 0x80,
+  0x47, 0xad, 0xbb, 0xef, 0x25, 0x79, 0xab, 0x5a, 0xeb, 0xb0, 0x3d, 0xbe,
+  0x4b, 0x2d, 0xca, 0x98, 0x25, 0xe9, 0xd6, 0x51, 0xb6, 0x44, 0x5b, 0x01,
+  0x8b, 0xb8, 0xa8, 0x8a, 0x16, 0xc2, 0x83, 0xde, 0xca, 0xc9, 0xdb, 0xcf,
+  0x45, 0xaf, 0xce, 0xfe, 0x2c, 0x6d, 0xe1, 0x0a, 0xe1, 0x00, 0xc7, 0xc1,
+  0x15, 0xcf, 0xe1, 0xf6, 0x39, 0xe3, 0xba, 0x43, 0x10, 0x60, 0xd2, 0x4d,
+  0xcd, 0x7d, 0xba, 0xe7, 0x4e, 0x02, 0xa8, 0xc2, 0xd6, 0x74, 0x3c, 0x2a,
+  0x5a, 0x07, 0xc5, 0xa4, 0x84, 0xdd, 0xfe, 0x4e, 0x13, 0xd8, 0x91, 0x14,
+  0xa1, 0xc6, 0x56, 0x08, 0x0f, 0x45, 0x34, 0xab, 0x07, 0x39, 0x18, 0xc7,
+  0x3b, 0xe7, 0xf3, 0xae, 0x86, 0x07, 0xb6, 0x40, 0xb8, 0xdd, 0xbb, 0x2d,
+  0x4b, 0x44, 0x3f, 0x8f, 0xd0, 0x09, 0xbc, 0x00, 0x86, 0x61, 0x05, 0xda,
+  0x9a, 0x28, 0xc2, 0xa0, 0x7a, 0x81, 0x09, 0x13, 0x98, 0x7b, 0x12, 0xfe,
+  0x06, 0x00, 0x73, 0x84, 0x3f, 0xbf, 0x35, 0x38, 0xf0, 0x7d, 0xf4, 0xbf,
+  0xb6, 0xe9, 0x14, 0x66, 0x1c, 0x3f, 0xa6, 0x2b, 0x14, 0x4f, 0xe4, 0xac,
+  0xb9, 0x7d, 0x97, 0xee, 0xb0, 0xee, 0x6a, 0x48, 0xd5, 0x00, 0x73, 0x45,
+  0xf7, 0x0b, 0x77, 0x69, 0xf6, 0x90, 0x38, 0x07, 0x03, 0x5c, 0x7b, 0xbe,
+  0x99, 0x57, 0xff, 0x52, 0x21, 0xdf, 0xb9, 0xd8, 0xa5, 0xe5, 0x2d, 0x17,
+  0x21, 0xd0, 0x07, 0x4c, 0xd9, 0x45, 0xf7, 0xfd, 0x94, 0x87, 0x14, 0x64,
+  0x65, 0xc6, 0x41, 0x81, 0x33, 0xcb, 0x5f, 0x7a, 0xb1, 0x40, 0xa8, 0x24,
+  0x3f, 0x43, 0xbb, 0x6b, 0x96, 0xc5, 0x4e, 0xb2, 0xd4, 0xa8, 0x9d, 0x9c,
+  0x01, 0xa7, 0x52, 0x50, 0x6f, 0x8b, 0x95, 0x8c, 0x4a, 0x19, 0x76, 0xbb,
+  0xb7, 0x76, 0x8c, 0xfe, 0xeb, 0x03, 0x4a, 0x7f, 0x6d, 0x52, 0xde, 0x47,
+  0x9e, 0x1f, 0xe5, 0xbe, 0x0e, 0x7b, 0xf4, 0x7c, 0x58, 0xee, 0xae, 0x6f,
+  0x1d, 0x33, 0x63, 0x8c, 0x44, 0xdb, 0x76, 0xb2, 0x64, 0x78, 0x27, 0x95,
+  0x35, 0xf4, 0x98, 0xbb, 0xa4, 0x71, 0x66, 0x91, 0xa7, 0xd0, 0xc4, 0xa6,
+  0xf2, 0x0d, 0x63, 0xf1, 0x9f, 0x79, 0x79, 0x63, 0x64, 0x1e, 0x3b, 0x67,
+  0x05, 0xe5, 0xad, 0x78, 0x12, 0xc2, 0xab, 0x6c, 0x3d, 0x4d, 0x3a, 0x7f,
+  0x1d, 0xfd, 0xaf, 0x48, 0x2a, 0x6a, 0xff, 0x5c, 0x49, 0xd5, 0x36, 0xf3,
+  0x6b, 0xa3, 0x05, 0x1b, 0x12, 0x9a, 0xf4, 0x84, 0xc0, 0x2c, 0x9b, 0x4d,
+  0x19, 0xb5, 0x2a, 0x0d, 0x47, 0xb6, 0xca, 0x21, 0xd4, 0xc2, 0xbb, 0x61,
+  0xad, 0xe6, 0x88, 0x58, 0xc9, 0x6e, 0xbb, 0x50, 0x11, 0xba, 0xcb, 0x1c,
+  0x48, 0x1a, 0x0f, 0x9c, 0xcc, 0xcc, 0xa4, 0x36, 0x68, 0x86, 0x0f, 0x84,
+  0x9b, 0x02, 0x7c, 0xbc, 0x75, 0xd6, 0xef, 0xe1, 0x2e, 0x7d, 0x05, 0xdb,
+  0x35, 0x73, 0x41, 0xe7, 0x67, 0x5d, 0x8d, 0xe4, 0x4d, 0xc3, 0xb5, 0xd6,
+  0x35, 0x9e, 0x5b, 0xe5, 0x74, 0x0c, 0x53, 0x7f, 0x76, 0x4a, 0xac, 0xa6,
+  0x02, 0x3f, 0x94, 0x3e, 0x5e, 0xf1, 0xf4, 0xbe, 0x21, 0xdf, 0xe1, 0xa7,
+  0x51, 0x21, 0x8f, 0xcf, 0x5d, 0x40, 0x89, 0xad, 0xe9, 0x63, 0xc9, 0x51,
+  0x60, 0x9c, 0x40, 0x60, 0x0f, 0xe8, 0x03, 0xa4, 0xe1, 0x03, 0xf0, 0x18,
+  0x85, 0xd9, 0xc1, 0x2b, 0x17, 0x62, 0x89, 0x71, 0xf8, 0x81, 0xcb, 0x79,
+  0x38, 0x38, 0x17, 0x32, 0xbd, 0xd2, 0x52, 0x3b, 0xac, 0x23, 0x4a, 0xd1,
+  0x78, 0x8c, 0x31, 0xa0, 0x78, 0x60, 0xe6, 0x32, 0x80, 0x59, 0x2a, 0x2a,
+  0x09, 0xf4, 0x49, 0x61, 0x4e, 0xfb, 0x92, 0x36, 0x80, 0xc7, 0x17, 0xdd,
+  0x68, 0x3e, 0xb7, 0xb6, 0xe2, 0x7f, 0x1a, 0xa9, 0x77, 0x22, 0x25, 0x70,
+  0xe2, 0x80, 0x5d, 0x9b, 0x8a, 0x97, 0xa7, 0x35, 0xc4, 0xe0, 0x79, 0x0e,
+  0x55, 0x9b, 0x7c, 0x8c, 0xca, 0xfc, 0x39, 0xba, 0x3f, 0x78, 0x60, 0x14,
+  0xd6, 0x0f, 0xb5, 0xe9, 0xa3, 0x0e, 0x5a, 0x4e, 0x4d, 0xb3, 0x33, 0x9b,
+  0x2a, 0xdc, 0xd2, 0x23, 0x6f, 0x32, 0x6f, 0x61, 0x69, 0xa6, 0x41, 0xd1,
+  0x46, 0xda, 0xc9, 0x1f, 0x32, 0xd9, 0x44, 0x18, 0x89, 0x9b, 0x6d, 0x2c,
+  0x0c, 0xee, 0x65, 0xf9, 0x94, 0x3e, 0x53, 0x68, 0x03, 0x36, 0x1f, 0x73,
+  0x98, 0xeb, 0xfe, 0x9b, 0x17, 0xc2, 0x74, 0x7b, 0x73, 0x24, 0xec, 0xf9,
+  0x9c, 0xaa, 0xed, 0xe8, 0x0f, 0x70, 0x0d, 0xad, 0xe1, 0x1f, 0x7d, 0x8e,
+  0x5c, 0xd3, 0x42, 0x4e, 0xec, 0xe5, 0xaf, 0x03, 0xef, 0x1d, 0x40, 0x58,
+  0x48, 0xa2, 0x95, 0xc4, 0x94, 0xac, 0x79, 0x89, 0xce, 0xcd, 0x34, 0x53,
+  0x34, 0x21, 0xea, 0x7f, 0x6f, 0x95, 0xca, 0x56, 0xe3, 0x5d, 0xac, 0xcd,
+  0xa9, 0x61, 0xc5, 0x40, 0x53, 0x79, 0xe6, 0x97, 0xf6, 0x5b, 0xbb, 0x5f,
+  0xd9, 0x7a, 0xd4, 0x81, 0xd3, 0xa5, 0xf2, 0x2e, 0xf3, 0x2e, 0x9e, 0x06,
+  0xec, 0x6f, 0xdc, 0xc8, 0xcf, 0x98, 0xe3, 0xcb, 0x7a, 0xb3, 0x62, 0x94,
+  0x3c, 0xf6, 0x92, 0xfb, 0x56, 0xb2, 0xe4, 0x75, 0x9b, 0x20, 0x9d, 0x66,
+  0x2a, 0x54, 0x1d, 0x0a, 0x8d, 0xf4, 0xec, 0x9a, 0xad, 0x4b, 0x1f, 0x87,
+  0x89, 0xf4, 0xc4, 0x71, 0xf1, 0x47, 0xca, 0x7f, 0x34, 0x63, 0x72, 0x22,
+  0xc7, 0x89, 0x86, 0xbe, 0x2b, 0x5a, 0x56, 0xeb, 0x50, 0x1d, 0x6c, 0x12,
+  0xbf, 0xe8, 0xc3, 0x47, 0xb6, 0xa0, 0x41, 0x5e, 0x43, 0x3b, 0x03, 0x48,
+  0x40, 0xcb, 0xd6, 0xce, 0x29, 0xa0, 0x91, 0xdf, 0xb8, 0x1f, 0x6d, 0xa3,
+  0xa8, 0x82, 0x26, 0x5a, 0x42, 0x63, 0xad, 0x07, 0x8b, 0x9c, 0xd7, 0x55,
+  0xfe, 0xb4, 0xa7, 0x36, 0xc8, 0xc5, 0xfb, 0x16, 0x7a, 0xf5, 0x66, 0xde,
+  0x7f, 0x03, 0xa2, 0xa5, 0x2b, 0x3e, 0xd5, 0x55, 0xc4, 0x93, 0xd7, 0xad,
+  0xce, 0xe3, 0x51, 0x37, 0x1d, 0x1a, 0x38, 0x64, 0x90, 0x68, 0xfa, 0x50,
+  0x45, 0x8e, 0x8c, 0xb0, 0xf2, 0x06, 0xf0, 0x30, 0x64, 0xe8, 0x34, 0xc7,
+  0x5f, 0x05, 0x35, 0x41, 0x63, 0x10, 0x76, 0xa1, 0x78, 0xef, 0x93, 0x9a,
+  0xdd, 0x0c, 0x38, 0xcb, 0xca, 0x70, 0x87, 0xbf, 0xde, 0x8f, 0xce, 0xe2,
+  0xc4, 0x6d, 0x53, 0x21, 0x61, 0x51, 0x64, 0x3c, 0xf1, 0x53, 0xe4, 0x89,
+  0x7a, 0x3e, 0x68, 0x15, 0xb3, 0xbb, 0xed, 0x18, 0xa6, 0x1a, 0x81, 0xc9,
+  0x59, 0x80, 0xd6, 0xf7, 0xe5, 0x76, 0x19, 0x09, 0x84, 0xb0, 0x12, 0x37,
+  0x89, 0x9b, 0x33, 0x2f, 0xaa, 0x7e, 0xa7, 0x5b, 0x48, 0xda, 0xab, 0x99,
+  0xf1, 0x0b, 0xd3, 0x82, 0xfb, 0xa8, 0xfc, 0xb4, 0x5a, 0x70, 0x8f, 0x9a,
+  0x66, 0x34, 0xf6, 0x76, 0x9a, 0x5c, 0x78, 0xcc, 0x29, 0x7f, 0x41, 0xe5,
+  0x0e, 0xce, 0xe7, 0x7b, 0xcb, 0xf2, 0x93, 0xfe, 0xaa, 0x3a, 0x85, 0xc3,
+  0x2d, 0xd8, 0xd9, 0x05, 0x21, 0xdd, 0x5f, 0xbd, 0x79, 0x0f, 0x95, 0x67,
+  0x3c, 0xa9, 0xce, 0xd1, 0xeb, 0x9e, 0x1c, 0xe6, 0x2d, 0x6a, 0x72, 0xcb,
+  0xb3, 0xef, 0xe2, 0x0b, 0x42, 0xb5, 0xf4, 0xc0, 0x10, 0x38, 0x38, 0x94,
+  0x0e, 0x91, 0x3b, 0x21, 0x95, 0xa8, 0xaf, 0x25, 0x78, 0x29, 0x89, 0xa1,
+  0x62, 0xf4, 0x72, 0x8d, 0x25, 0x6e, 0x9e, 0x7c, 0x60, 0x99, 0x5f, 0x01,
+  0xff, 0x3b, 0x45, 0x1c, 0x06, 0x03, 0xca, 0xcf, 0x4f, 0x08, 0xa5, 0xd0,
+  0x5a, 0x70, 0xa0, 0x6b, 0xbe, 0x1c, 0x35, 0xbb, 0xdc, 0x64, 0xcc, 0x3d,
+  0x7f, 0x6a, 0x89, 0x39, 0x54, 0xc7, 0x69, 0x2f, 0x79, 0x7e, 0x82, 0x8c,
+  0xfe, 0x1f, 0xca, 0xe6, 0x6b, 0xf7, 0xbb, 0xa1, 0xf4, 0x51, 0xa5, 0x5e,
+  0x9e, 0xaa, 0x10, 0x31, 0xfa, 0x4a, 0xc4, 0x2d, 0xf8, 0xad, 0xa3, 0x0a,
+  0xd0, 0x57, 0x90, 0x4a, 0xbd, 0x93, 0xf0, 0x87, 0x3d, 0xd7, 0x95, 0xa7,
+  0x54, 0xc1, 0x44, 0x20, 0x80, 0x30, 0xac, 0x26, 0x74, 0x01, 0x47, 0x18,
+  0xd0, 0xba, 0xf3, 0x73, 0x10, 0xb0, 0xb2, 0xd3, 0x4c, 0x63, 0x4b, 0x5b,
+  0x1d, 0x83, 0x1f, 0x01, 0x87, 0x74, 0x92, 0xa0, 0x90, 0x65, 0x47, 0x32,
+  0x1e, 0x22, 0xd5, 0xe5, 0x64, 0x19, 0xad, 0xf8, 0x02, 0x6a, 0x73, 0x51,
+  0xf3, 0x58, 0x70, 0xe6, 0x3f, 0xe4, 0x05, 0xb4, 0x86, 0x3f, 0x05, 0x98,
+  0x4f, 0xe5, 0xf0, 0xd2, 0x62, 0xda, 0x03, 0x91, 0x99, 0x44, 0x40, 0x03,
+  0xd1, 0x64, 0x04, 0x5f, 0x57, 0x3b, 0xcf, 0xbe, 0x80, 0x99, 0x8b, 0xff,
+  0xa3, 0x25, 0xf7, 0xaa, 0xf2, 0xd6, 0x59, 0x58, 0x69, 0x61, 0x62, 0xb4,
+  0x66, 0xd0, 0x1d, 0x4c, 0xe8, 0xfd, 0xa7, 0xc7, 0x8b, 0x60, 0x81, 0xd2,
+  0x9e, 0x81, 0x36, 0x72, 0xff, 0xd2, 0x10, 0x39, 0x70, 0xc0, 0x11, 0xd6,
+  0xb2, 0xb0, 0x01, 0xd4, 0xaf, 0xbf, 0x6b, 0x6a, 0x24, 0xf3, 0x4b, 0x1a,
+  0x01, 0x9b, 0xa2, 0x5c, 0xd1, 0x2a, 0xbf, 0x2d, 0x3d, 0x54, 0xcb, 0x41,
+  0xb4, 0x2a, 0xbb, 0xae, 0x7b, 0x2b, 0xf6, 0x1d, 0xae, 0xf6, 0xc3, 0x82,
+  0xc9, 0xe5, 0xc1, 0xf8, 0xfa, 0xac, 0xc0, 0x66, 0x54, 0xfa, 0x64, 0x4f,
+  0x21, 0x2e, 0xf3, 0x46, 0xd9, 0x7a, 0xf8, 0x1a, 0xe9, 0x37, 0x25, 0xe5,
+  0x2e, 0xdf, 0xc3, 0x6b, 0x9a, 0x3f, 0xdc, 0x6a, 0x13, 0x8e, 0xfa, 0x9a,
+  0xde, 0x9f, 0x86, 0x24, 0x2f, 0x4a, 0x0c, 0xc8, 0x5c, 0x05, 0x81, 0xba,
+  0x49, 0x9d, 0x78, 0x3a, 0xbd, 0x5f, 0xd8, 0xdc, 0xd9, 0x37, 0xc9, 0x2f,
+  0x11, 0x4c, 0x1e, 0xd5, 0x1c, 0x72, 0xaa, 0x80, 0x38, 0xfc, 0x22, 0xfe,
+  0x37, 0x05, 0x82, 0xd4, 0xee, 0x8a, 0x4e, 0xea, 0xf6, 0xd1, 0xfa, 0x1b,
+  0x77, 0x1f, 0x15, 0x01, 0x41, 0x0c, 0x28, 0x14, 0x17, 0xa0, 0xb3, 0xe2,
+  0x9f, 0x46, 0x94, 0x65, 0x07, 0x89, 0x96, 0x90, 0xda, 0x28, 0x22, 0x4c,
+  0xb7, 0xf4, 0xad, 0x66, 0xd7, 0x44, 0xbb, 0xed, 0xe6, 0x63, 0x19, 0x51,
+  0x57, 0xb6, 0x57, 0x42, 0x31, 0x5e, 0x25, 0x0a, 0x21, 0xb0, 0xe4, 0xcc,
+  0x91, 0x74, 0xef, 0x76, 0x2f, 0x06, 0xcd, 0x1f, 0xc8, 0xbd, 0x24, 0x0b,
+  0x18, 0x1d, 0x33, 0x04, 0xf8, 0xb0, 0xc2, 0x97, 0x1d, 0x10, 0x74, 0xcd,
+  0x3a, 0x02, 0x8f, 0xe6, 0x4c, 0xa9, 0xed, 0x05, 0x5b, 0x85, 0xc5, 0x5b,
+  0xce, 0x13, 0x51, 0xc6, 0x9a, 0x31, 0x70, 0x54, 0xe0, 0x12, 0x3e, 0x5d,
+  0xeb, 0xf3, 0x70, 0xa1, 0xe2, 0x0a, 0x98, 0x17, 0xfe, 0xb5, 0x1c, 0x9b,
+  0x61, 0x8a, 0x0d, 0x8f, 0x5b, 0x3e, 0x74, 0x3f, 0xe4, 0x39, 0xa0, 0xdc,
+  0x81, 0xe7, 0x38, 0xdc, 0x31, 0xab, 0x4a, 0xc0, 0xc5, 0xed, 0x70, 0xb6,
+  0x77, 0x6b, 0xe3, 0x46, 0x49, 0x01, 0xbf, 0x47, 0x9a, 0x54, 0x6b, 0x83,
+  0x36, 0xf8, 0x17, 0xfe, 0x14, 0x58, 0x84, 0x2f, 0x47, 0xc1, 0x81, 0xb8,
+  0xf8, 0x5d, 0x13, 0xd1, 0x5d, 0xb4, 0xaa, 0x21, 0xf1, 0x33, 0x55, 0xdb,
+  0x2c, 0x1d, 0x60, 0x12, 0xad, 0x04, 0xfc, 0x0c, 0xe5, 0x5b, 0x6d, 0x14,
+  0xb9, 0x88, 0xe2, 0xec, 0xc1, 0xd9, 0x01, 0x1b, 0x89, 0xc7, 0x71, 0x7f,
+  0x92, 0x50, 0xaf, 0xc2, 0x38, 0xde, 0xc9, 0x4f, 0x83, 0xb5, 0x37, 0x0f,
+  0xb9, 0x26, 0xe2, 0xeb, 0x9f, 0xbc, 0xfe, 0x23, 0x94, 0xdc, 0xf2, 0x59,
+  0xe8, 0xb5, 0x62, 0x55, 0xae, 0x39, 0x0c, 0x65, 0x60, 0x56, 0xc8, 0x60,
+  0x80, 0x96, 0xcd, 0xc0, 0x34, 0x24, 0xce, 0xd7, 0xe9, 0x3f, 0xa8, 0x61,
+  0x56, 0x81, 0x71, 0xea, 0x9c, 0x8c, 0x01, 0xf0, 0xd0, 0x0c, 0x0e, 0x7f,
+  0x1f, 0x53, 0xbd, 0x0e, 0x46, 0x72, 0xc6, 0x28, 0xf2, 0xba, 0x9a, 0x66,
+  0xe6, 0xa9, 0x31, 0x3c, 0xd7, 0xea, 0x0e, 0xbe, 0x46, 0xd8, 0x54, 0xd7,
+  0x1c, 0x6a, 0x8d, 0x6c, 0x7f, 0xfc, 0xc4, 0x17, 0x07, 0x72, 0x32, 0xfe,
+  0xee, 0x6e, 0x0e, 0x78, 0xff, 0x95, 0xcb, 0x3f, 0xa5, 0xef, 0x7f, 0x25,
+  0x45, 0xa4, 0x5b, 0x91, 0x14, 0xc8, 0xf9, 0x05, 0x3b, 0x03, 0xa4, 0x51,
+  0xdf, 0xf7, 0x1f, 0x6f, 0x48, 0x0c, 0x5a, 0x47, 0xbb, 0xd2, 0x39, 0x43,
+  0xdd, 0xdf, 0x80, 0xc1, 0xb6, 0xcd, 0xed, 0x60, 0xd1, 0xfe, 0x96, 0xc2,
+  0xc2, 0xed, 0xe1, 0x9a, 0xcb, 0xab, 0x6d, 0x21, 0x6a, 0x30, 0x11, 0x1c,
+  0x8c, 0xae, 0xe5, 0xc0, 0xbc, 0xe4, 0xb2, 0x05, 0x31, 0xa8, 0x17, 0xc2,
+  0x0b, 0xe6, 0x49, 0x51, 0x9c, 0xa5, 0x8d, 0x9b, 0x27, 0xb7, 0xfb, 0x37,
+  0x34, 0x0e, 0x5d, 0xdc, 0x6c, 0x67, 0x05, 0x50, 0xbf, 0x7f, 0xa7, 0xd6,
+  0x6c, 0x1c, 0xd3, 0x3e, 0xd1, 0xfc, 0x5c, 0xe3, 0xb2, 0xc6, 0x6e, 0x1f,
+  0xdf, 0xdb, 0x44, 0x01, 0xac, 0x41, 0x89, 0xf2, 0x6f, 0x34, 0x1c, 0x20,
+  0x53, 0xe7, 0x5d, 0x7f, 0x77, 0xf3, 0x8d, 0x4e, 0xe4, 0x24, 0x50, 0x31,
+  0xdb, 0x8f, 0xa4, 0xa1, 0x43, 0x17, 0x12, 0x82, 0x92, 0xee, 0x7f, 0x92,
+  0x36, 0xbe, 0x0d, 0x6d, 0x2f, 0xbd, 0x98, 0xc9, 0x34, 0xd3, 0x99, 0x8a,
+  0xef, 0xae, 0x85, 0xc3, 0x83, 0x14, 0x13, 0xdd, 0x89, 0xf8, 0x52, 0x63,
+  0xff, 0xcc, 0x55, 0x47, 0x50, 0x4a, 0x87, 0x6e, 0x59, 0x4c, 0xe0, 0xd0,
+  0xe6, 0x37, 0x3c, 0x72, 0x53, 0xa0, 0x74, 0xf4, 0x7c, 0x3c, 0x9b, 0x96,
+  0x0b, 0xe9, 0xf8, 0x7a, 0x66, 0xb9, 0x0c, 0xde, 0x0e, 0xf8, 0x98, 0x5d,
+  0x0c, 0xfb, 0xc7, 0xc1, 0xfe, 0x91, 0xb6, 0xda, 0xd0, 0x0f, 0xc7, 0xeb,
+  0x74, 0x97, 0xbe, 0x9e, 0x4e, 0x8a, 0x50, 0xbe, 0xe2, 0x39, 0x16, 0x2f,
+  0xf2, 0x1a, 0xf1, 0x47, 0x1c, 0x94, 0xd9, 0xcb, 0x95, 0xd8, 0xb2, 0xcc,
+  0xd9, 0xe7, 0x27, 0x8a, 0x12, 0x20, 0x3d, 0x56, 0x29, 0x74, 0xb7, 0x15,
+  0x14, 0xc5, 0x25, 0x62, 0xf0, 0x98, 0xd1, 0xc4, 0x89, 0x44, 0xb6, 0x71,
+  0x80, 0xe8, 0x2c, 0x13, 0xc4, 0x26, 0x7e, 0x68, 0x0b, 0x54, 0xe4, 0x32,
+  0x16, 0xb3, 0xe0, 0x98, 0xa2, 0x79, 0xe2, 0x7e, 0x5f, 0x70, 0x2a, 0xb3,
+  0x35, 0xc6, 0x89, 0xbb, 0x11, 0x91, 0x33, 0xaf, 0x05, 0xf1, 0x3b, 0x54,
+  0x42, 0x4d, 0x9b, 0xd6, 0x04, 0xde, 0xbb, 0x45, 0xe2, 0x8e, 0x8c, 0x9d,
+  0x6c, 0xf0, 0xac, 0xbc, 0xf2, 0xac, 0x7d, 0x1e, 0xe9, 0xfd, 0x7b, 0x05,
+  0x11, 0x65, 0xe1, 0xdd, 0xa1, 0x8c, 0x4d, 0x0b, 0xd2, 0x61, 0x95, 0x24,
+  0xc7, 0x4c, 0x2b, 0x3c, 0xda, 0xd6, 0x7e, 0xe5, 0x99, 0x28, 0x11, 0x4f,
+  0xde, 0xf7, 0xb5, 0x1a, 0x06, 0xed, 0x43, 0xf9, 0xf1, 0xa0, 0x22, 0xc8,
+  0x3f, 0x70, 0x1f, 0x3b, 0x8e, 0x27, 0x41, 0xeb, 0x30, 0xab, 0xe3, 0xde,
+  0xea, 0x7d, 0xd3, 0xa3, 0xb0, 0xbe, 0x9e, 0xf6, 0x56, 0xd6, 0x79, 0x7e,
+  0xa7, 0x16, 0x9d, 0x42, 0x18, 0xe1, 0xd2, 0x90, 0x55, 0xe8, 0x52, 0xe9,
+  0xc9, 0x35, 0x00, 0x72, 0xb1, 0xfc, 0x21, 0xe2, 0x43, 0x5e, 0xa4, 0xa5,
+  0x2a, 0x11, 0xee, 0x98, 0x3f, 0xbf, 0x61, 0x3b, 0xb5, 0xcf, 0x41, 0x2d,
+  0x90, 0xf5, 0x3b, 0x8c, 0x7d, 0x39, 0x98, 0x61, 0x43, 0x3c, 0x9d, 0x1f,
+  0x07, 0x20, 0x19, 0xa4, 0xa1, 0x3d, 0x30, 0x0a, 0xa3, 0x9c, 0xc9, 0x8e,
+  0xff, 0x38, 0x9c, 0xf5, 0x1c, 0x62, 0x79, 0x55, 0xfc, 0x41, 0x6c, 0x2f,
+  0x6f, 0x43, 0xb3, 0x21, 0x9b, 0x84, 0xc0, 0x6a, 0xfd, 0x92, 0xc3, 0xe2,
+  0x37, 0x01, 0x84, 0x4d, 0xdf, 0x4e, 0x0b, 0xbb, 0xc7, 0xe6, 0x7f, 0x4d,
+  0x97, 0xa6, 0xf9, 0xb2, 0xd4, 0xf9, 0x56, 0x35, 0xe2, 0x94, 0x76, 0x0a,
+  0x43, 0xb1, 0xf6, 0x72, 0x5a, 0x32, 0xa8, 0xc7, 0x1f, 0x66, 0x01, 0xbf,
+  0x28, 0x86, 0x12, 0x75, 0x64, 0x9b, 0xc0, 0x48, 0x7e, 0xcc, 0xac, 0x41,
+  0x53, 0x00, 0xa0, 0x52, 0xda, 0xaa, 0xf0, 0x17, 0x95, 0x7b, 0x36, 0x23,
+  0x6f, 0xa4, 0x03, 0xf4, 0x2d, 0x9d, 0x3c, 0x09, 0xa8, 0x0f, 0x66, 0xc3,
+  0xb1, 0x48, 0x80, 0x5d, 0xc8, 0x3b, 0xba, 0x71, 0x5d, 0xec, 0x55, 0x66,
+  0x54, 0x08, 0xe9, 0xb5, 0xe9, 0xf3, 0xc7, 0xca, 0x56, 0x88, 0xb3, 0x58,
+  0x48, 0x6a, 0x19, 0x71, 0x29, 0xa2, 0x11, 0x2c, 0xbf, 0x54, 0x98, 0xe5,
+  0xec, 0x25, 0xbe, 0x88, 0xf2, 0x66, 0x64, 0x74, 0xe6, 0x98, 0x46, 0xdf,
+  0x31, 0xac, 0xdc, 0x68, 0x08, 0xd7, 0x72, 0xa8, 0x1f, 0xdd, 0x7a, 0x40,
+  0x69, 0xec, 0xf7, 0x8a, 0xae, 0x84, 0x6f, 0x1e, 0x39, 0x72, 0x7f, 0x1b,
+  0x8b, 0x8c, 0x80, 0xec, 0xcc, 0xa8, 0x66, 0x0c, 0x38, 0xf0, 0x7f, 0x9d,
+  0x48, 0x43, 0xfe, 0x49, 0x60, 0x1f, 0xe7, 0x9d, 0xeb, 0xa1, 0x98, 0x5e,
+  0xfd, 0x23, 0x4a, 0xd0, 0x84, 0x35, 0x23, 0xbf, 0xfc, 0xb1, 0x2f, 0xb1,
+  0x55, 0x5b, 0xe0, 0xc0, 0xfe, 0x9e, 0xf4, 0x9e, 0xf7, 0xfa, 0xc2, 0xa3,
+  0xc9, 0x0b, 0xd2, 0x93, 0xcb, 0xa2, 0x21, 0xb0, 0x74, 0xaf, 0x36, 0x6b,
+  0xce, 0xe2, 0x9f, 0x52, 0x2e, 0x1a, 0x24, 0xee, 0x2e, 0x45, 0x05, 0x0d,
+  0xa4, 0x9e, 0x57, 0x02, 0x0c, 0xd5, 0x94, 0x25, 0x7c, 0xbd, 0x81, 0xf0,
+  0x2d, 0xec, 0x40, 0xff, 0x67, 0x10, 0xf5, 0xd8, 0x45, 0x08, 0xfb, 0x55,
+  0xca, 0xba, 0x36, 0x65, 0x4d, 0xa3, 0xd7, 0x2b, 0x62, 0x36, 0xe2, 0xe7,
+  0x51, 0x4b, 0xce, 0x3e, 0x1d, 0x40, 0x12, 0x47, 0xb3, 0xfd, 0x6b, 0xa6,
+  0x34, 0xef, 0x22, 0x8b, 0x9b, 0x27, 0x00, 0x47, 0x00, 0x00, 0x5f, 0x00,
+  0xba, 0x00, 0x00, 0x00, 0x5b, 0x00, 0xb8, 0x00, 0x0f, 0x01, 0x68, 0x01,
+  0xc1, 0x01, 0x1c, 0x02, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x11, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x06, 0x00, 0x0c, 0x00, 0x12, 0x00, 0x00, 0x00, 0x11, 0x00,
+  0x17, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x0e, 0x00, 0x15, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x06, 0x00,
+  0x0f, 0x00, 0x15, 0x00, 0x1b, 0x00, 0x22, 0x00, 0x28, 0x00, 0x2f, 0x00,
+  0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x12, 0x00, 0x1a, 0x00,
+  0x24, 0x00, 0x2c, 0x00, 0x33, 0x00, 0x3b, 0x00, 0x43, 0x00, 0x4c, 0x00,
+  0x55, 0x00, 0x5c, 0x00, 0x65, 0x00, 0x6b, 0x00, 0x74, 0x00, 0x7b, 0x00,
+  0x82, 0x00, 0x8b, 0x00, 0x94, 0x00, 0x9b, 0x00, 0xa4, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x48, 0x00, 0x50, 0x00, 0x58, 0x00, 0x5f, 0x00, 0x66, 0x00,
+  0x6f, 0x00, 0x78, 0x00, 0x80, 0x00, 0x89, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x12, 0x00, 0x1a, 0x00, 0x23, 0x00, 0x2b, 0x00,
+  0x34, 0x00, 0x40, 0x00, 0x49, 0x00, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x12, 0x00, 0x1b, 0x00, 0x24, 0x00, 0x30, 0x00, 0x39, 0x00,
+  0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x16, 0x00, 0x20, 0x00,
+  0x29, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x16, 0x00, 0x21, 0x00, 0x2b, 0x00,
+  0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x00,
+  0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x45, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x0f, 0x00, 0x15, 0x00, 0x1b, 0x00, 0x21, 0x00, 0x2a, 0x00,
+  0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0f, 0x00, 0x18, 0x00,
+  0x21, 0x00, 0x2a, 0x00, 0x33, 0x00, 0x3c, 0x00, 0x43, 0x00, 0x4c, 0x00,
+  0x55, 0x00, 0x5c, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x75, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x13, 0x00, 0x1d, 0x00, 0x25, 0x00, 0x2d, 0x00,
+  0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x13, 0x00, 0x1b, 0x00,
+  0x21, 0x00, 0x29, 0x00, 0x30, 0x00, 0x3a, 0x00, 0x42, 0x00, 0x4d, 0x00,
+  0x54, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x19, 0x00, 0x21, 0x00, 0x2c, 0x00, 0x34, 0x00, 0x3c, 0x00, 0x45, 0x00,
+  0x4e, 0x00, 0x56, 0x00, 0x61, 0x00, 0x6a, 0x00, 0x73, 0x00, 0x7c, 0x00,
+  0x00, 0x00, 0x07, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x08, 0x00, 0x11, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x14, 0x00, 0x21, 0x00, 0x2b, 0x00,
+  0x35, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x00,
+  0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x00, 0x85, 0x00, 0xc1, 0x00,
+  0xe3, 0x00, 0x00, 0x01, 0x1d, 0x01, 0x3c, 0x01, 0x54, 0x01, 0x00, 0x00,
+  0x3c, 0x00, 0x7d, 0x00, 0xb5, 0x00, 0xd3, 0x00, 0xee, 0x00, 0x09, 0x01,
+  0x3a, 0x01, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0c, 0x00,
+  0x12, 0x00, 0x18, 0x00, 0x1e, 0x00, 0x24, 0x00, 0x2a, 0x00, 0x30, 0x00,
+  0x36, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x07, 0x00, 0x0e, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x0d, 0x00, 0x13, 0x00, 0x19, 0x00, 0x20, 0x00, 0x27, 0x00,
+  0x2d, 0x00, 0x33, 0x00, 0x39, 0x00, 0x3f, 0x00, 0x46, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x0e, 0x00, 0x15, 0x00, 0x1d, 0x00, 0x25, 0x00, 0x2c, 0x00,
+  0x35, 0x00, 0x3d, 0x00, 0x43, 0x00, 0x49, 0x00, 0x4f, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x13, 0x00, 0x19, 0x00, 0x21, 0x00, 0x29, 0x00, 0x2f, 0x00,
+  0x36, 0x00, 0x00, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x14, 0x00, 0x1a, 0x00,
+  0x23, 0x00, 0x2a, 0x00, 0x30, 0x00, 0x37, 0x00, 0x3d, 0x00, 0x45, 0x00,
+  0x4c, 0x00, 0x55, 0x00, 0x5c, 0x00, 0x62, 0x00, 0x68, 0x00, 0x00, 0x00,
+  0x23, 0x00, 0x2b, 0x00, 0x33, 0x00, 0x3b, 0x00, 0x43, 0x00, 0x49, 0x00,
+  0x50, 0x00, 0x58, 0x00, 0x5e, 0x00, 0x65, 0x00, 0x6d, 0x00, 0x75, 0x00,
+  0x7c, 0x00, 0x85, 0x00, 0x8c, 0x00, 0x00, 0x00, 0x29, 0x00, 0x62, 0x00,
+  0x8a, 0x00, 0xcb, 0x00, 0xf5, 0x00, 0x11, 0x01, 0x34, 0x01, 0x3b, 0x01,
+  0x43, 0x01, 0x49, 0x01, 0x00, 0x00, 0x21, 0x00, 0x27, 0x00, 0x2d, 0x00,
+  0x34, 0x00, 0x3d, 0x00, 0x43, 0x00, 0x49, 0x00, 0x52, 0x00, 0x00, 0x00,
+  0x25, 0x00, 0x5a, 0x00, 0x82, 0x00, 0xc1, 0x00, 0xed, 0x00, 0x10, 0x01,
+  0x31, 0x01, 0x3a, 0x01, 0x43, 0x01, 0x4a, 0x01, 0x51, 0x01, 0x5a, 0x01,
+  0x63, 0x01, 0x00, 0x00, 0x2a, 0x00, 0x48, 0x00, 0x50, 0x00, 0x5a, 0x00,
+  0x61, 0x00, 0x6d, 0x00, 0x75, 0x00, 0x7b, 0x00, 0x82, 0x00, 0x89, 0x00,
+  0x91, 0x00, 0x97, 0x00, 0x00, 0x00, 0x08, 0x00, 0x11, 0x00, 0x1a, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x28, 0x00, 0x34, 0x00, 0x3c, 0x00, 0x44, 0x00,
+  0x4b, 0x00, 0x00, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x17, 0x00, 0x1f, 0x00,
+  0x28, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x14, 0x00, 0x1b, 0x00, 0x23, 0x00,
+  0x00, 0x00, 0x06, 0x00, 0x10, 0x00, 0x24, 0x00, 0x2d, 0x00, 0x00, 0x00,
+  0x15, 0x00, 0x1b, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00,
+  0x0d, 0x00, 0x14, 0x00, 0x00, 0x00, 0x08, 0x00, 0x0f, 0x00, 0x18, 0x00,
+  0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x2c, 0x00, 0x32, 0x00,
+  0x38, 0x00, 0x41, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x61, 0x00, 0x84, 0x00,
+  0xd1, 0x00, 0xf0, 0x00, 0x2c, 0x01, 0x4c, 0x01, 0x72, 0x01, 0x79, 0x01,
+  0x83, 0x01, 0x00, 0x00, 0x2d, 0x00, 0x53, 0x00, 0x59, 0x00, 0x60, 0x00,
+  0x69, 0x00, 0x72, 0x00, 0x7b, 0x00, 0x84, 0x00, 0x8d, 0x00, 0x00, 0x00,
+  0x38, 0x00, 0x5b, 0x00, 0x7a, 0x00, 0xc1, 0x00, 0xde, 0x00, 0x11, 0x01,
+  0x2d, 0x01, 0x55, 0x01, 0x5c, 0x01, 0x00, 0x00, 0x32, 0x00, 0x52, 0x00,
+  0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x52, 0x00, 0x76, 0x00,
+  0x7e, 0x00, 0x86, 0x00, 0x8e, 0x00, 0x00, 0x00, 0x38, 0x00, 0x5c, 0x00,
+  0x61, 0x00, 0x00, 0x00, 0x46, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x28, 0x00,
+  0x4c, 0x00, 0x52, 0x00, 0x58, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x33, 0x00,
+  0x39, 0x00, 0x3f, 0x00, 0x45, 0x00, 0x4b, 0x00, 0x51, 0x00, 0x57, 0x00,
+  0x5d, 0x00, 0x00, 0x00, 0x28, 0x00, 0x4a, 0x00, 0x51, 0x00, 0x58, 0x00,
+  0x00, 0x00, 0x1e, 0x00, 0x4f, 0x00, 0x56, 0x00, 0x5d, 0x00, 0x63, 0x00,
+  0x69, 0x00, 0x74, 0x00, 0x7b, 0x00, 0x81, 0x00, 0x88, 0x00, 0x8f, 0x00,
+  0x98, 0x00, 0x00, 0x00, 0x31, 0x00, 0x36, 0x00, 0x3c, 0x00, 0x42, 0x00,
+  0x00, 0x00, 0x26, 0x00, 0x30, 0x00, 0x3e, 0x00, 0x44, 0x00, 0x4a, 0x00,
+  0x52, 0x00, 0x58, 0x00, 0x5d, 0x00, 0x65, 0x00, 0x6c, 0x00, 0x73, 0x00,
+  0x78, 0x00, 0x80, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x48, 0x00, 0x4f, 0x00,
+  0x56, 0x00, 0x5c, 0x00, 0x65, 0x00, 0x6b, 0x00, 0x72, 0x00, 0x79, 0x00,
+  0x7f, 0x00, 0x88, 0x00, 0x8f, 0x00, 0x96, 0x00, 0x9e, 0x00, 0xa6, 0x00,
+  0x00, 0x00, 0x24, 0x00, 0x5b, 0x00, 0x61, 0x00, 0x67, 0x00, 0x6e, 0x00,
+  0x79, 0x00, 0x7f, 0x00, 0x85, 0x00, 0x8d, 0x00, 0x93, 0x00, 0x00, 0x00,
+  0x2d, 0x00, 0x4d, 0x00, 0x6e, 0x00, 0x98, 0x00, 0x9f, 0x00, 0xa6, 0x00,
+  0xad, 0x00, 0xb6, 0x00, 0xbd, 0x00, 0xc5, 0x00, 0xcd, 0x00, 0xd3, 0x00,
+  0xdb, 0x00, 0xe3, 0x00, 0xe9, 0x00, 0xf0, 0x00, 0xf8, 0x00, 0x00, 0x00,
+  0x2c, 0x00, 0x35, 0x00, 0x3b, 0x00, 0x42, 0x00, 0x48, 0x00, 0x4e, 0x00,
+  0x55, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x47, 0x00, 0x66, 0x00, 0xa5, 0x00,
+  0xc7, 0x00, 0xf2, 0x00, 0xfa, 0x00, 0x01, 0x01, 0x09, 0x01, 0x11, 0x01,
+  0x19, 0x01, 0x20, 0x01, 0x27, 0x01, 0x2f, 0x01, 0x37, 0x01, 0x3f, 0x01,
+  0x45, 0x01, 0x4d, 0x01, 0x54, 0x01, 0x5c, 0x01, 0x00, 0x00, 0x1c, 0x00,
+  0x40, 0x00, 0x48, 0x00, 0x4e, 0x00, 0x55, 0x00, 0x5d, 0x00, 0x64, 0x00,
+  0x6b, 0x00, 0x00, 0x00, 0x20, 0x00, 0x49, 0x00, 0x77, 0x00, 0x7d, 0x00,
+  0x83, 0x00, 0x8c, 0x00, 0x95, 0x00, 0x9d, 0x00, 0xa5, 0x00, 0xac, 0x00,
+  0xb5, 0x00, 0xbe, 0x00, 0xc6, 0x00, 0xcf, 0x00, 0xd8, 0x00, 0xe1, 0x00,
+  0x00, 0x00, 0x40, 0x00, 0x69, 0x00, 0x72, 0x00, 0x7a, 0x00, 0x81, 0x00,
+  0x8a, 0x00, 0x91, 0x00, 0x98, 0x00, 0x9f, 0x00, 0xa8, 0x00, 0xb0, 0x00,
+  0xb7, 0x00, 0xbe, 0x00, 0xc5, 0x00, 0x00, 0x00, 0x05, 0x00, 0x0f, 0x00,
+  0x17, 0x00, 0x20, 0x00, 0x26, 0x00, 0x2f, 0x00, 0x38, 0x00, 0x41, 0x00,
+  0x4b, 0x00, 0x54, 0x00, 0x00, 0x00, 0x27, 0x00, 0x59, 0x00, 0x79, 0x00,
+  0x9b, 0x00, 0xb9, 0x00, 0xc2, 0x00, 0xcb, 0x00, 0x00, 0x00, 0x20, 0x00,
+  0x26, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x15, 0x00, 0x1f, 0x00, 0x2a, 0x00,
+  0x35, 0x00, 0x3f, 0x00, 0x49, 0x00, 0x53, 0x00, 0x5c, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x09, 0x00, 0x14, 0x00, 0x00, 0x00, 0x06, 0x00,
+  0x00, 0x00, 0x22, 0x00, 0x44, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x31, 0x00,
+  0x39, 0x00, 0x00, 0x00, 0x20, 0x00, 0x40, 0x00, 0x00, 0x00, 0x26, 0x00,
+  0x4e, 0x00, 0x76, 0x00, 0x00, 0x00, 0x20, 0x00, 0x49, 0x00, 0x00, 0x00,
+  0x36, 0x00, 0x6f, 0x00, 0x8f, 0x00, 0x9f, 0x00, 0xa7, 0x00, 0xb0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x48, 0x00, 0x6a, 0x00, 0x73, 0x00,
+  0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0c, 0x00,
+  0x13, 0x00, 0x19, 0x00, 0x1f, 0x00, 0x26, 0x00, 0x00, 0x00, 0x22, 0x00,
+  0x46, 0x00, 0x6a, 0x00, 0x00, 0x00, 0x22, 0x00, 0x46, 0x00, 0x6c, 0x00,
+  0x93, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x57, 0x00,
+  0x8c, 0x00, 0x93, 0x00, 0x9b, 0x00, 0xa3, 0x00, 0x00, 0x00, 0x20, 0x00,
+  0x44, 0x00, 0x7b, 0x00, 0x83, 0x00, 0x89, 0x00, 0x00, 0x00, 0x26, 0x00,
+  0x4a, 0x00, 0x74, 0x00, 0x7b, 0x00, 0x82, 0x00, 0x89, 0x00, 0x90, 0x00,
+  0x00, 0x00, 0x2b, 0x00, 0x51, 0x00, 0x59, 0x00, 0x61, 0x00, 0x00, 0x00,
+  0x26, 0x00, 0x4e, 0x00, 0x74, 0x00, 0x7c, 0x00, 0x84, 0x00, 0x8b, 0x00,
+  0x92, 0x00, 0x9b, 0x00, 0xa3, 0x00, 0xab, 0x00, 0xb2, 0x00, 0xbb, 0x00,
+  0xc4, 0x00, 0xcc, 0x00, 0xd4, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00,
+  0x24, 0x00, 0x55, 0x00, 0x5c, 0x00, 0x65, 0x00, 0x00, 0x00, 0x20, 0x00,
+  0x27, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x22, 0x00, 0x46, 0x00, 0x66, 0x00,
+  0x86, 0x00, 0x8f, 0x00, 0x96, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
+  0x24, 0x00, 0x2c, 0x00, 0x34, 0x00, 0x39, 0x00, 0x41, 0x00, 0x00, 0x00,
+  0x24, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x60, 0x00, 0x84, 0x00, 0xb7, 0x00,
+  0xcb, 0x00, 0x00, 0x00, 0x39, 0x00, 0x4e, 0x00, 0x54, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00,
+  0x3e, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00,
+  0x22, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00,
+  0x4a, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x27, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x32, 0x00, 0x3a, 0x00, 0x40, 0x00,
+  0x00, 0x00, 0x22, 0x00, 0x29, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x08, 0x00,
+  0x0e, 0x00, 0x00, 0x00, 0x08, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x15, 0x00, 0x1e, 0x00, 0x27, 0x00, 0x2f, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x00, 0x10, 0x00, 0x17, 0x00, 0x1f, 0x00, 0x26, 0x00,
+  0x2c, 0x00, 0x35, 0x00, 0x00, 0x00, 0x07, 0x00, 0x0f, 0x00, 0x16, 0x00,
+  0x1f, 0x00, 0x26, 0x00, 0x2d, 0x00, 0x35, 0x00, 0x3c, 0x00, 0x44, 0x00,
+  0x4b, 0x00, 0x53, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x31, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x09, 0x00, 0x0f, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x08, 0x00, 0x12, 0x00, 0x00, 0x00, 0x07, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x0e, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x22, 0x00, 0x2d, 0x00,
+  0x38, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x27, 0x00,
+  0x2d, 0x00, 0x34, 0x00, 0x3b, 0x00, 0x41, 0x00, 0x48, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x13, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x08, 0x00,
+  0x0e, 0x00, 0x16, 0x00, 0x00, 0x00, 0x09, 0x00, 0x11, 0x00, 0x19, 0x00,
+  0x00, 0x00, 0x07, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x07, 0x00, 0x0f, 0x00,
+  0x18, 0x00, 0x21, 0x00, 0x28, 0x00, 0x30, 0x00, 0x39, 0x00, 0x40, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x12, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x12, 0x00, 0x00, 0x00, 0x08, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x0d, 0x00, 0x15, 0x00, 0x1d, 0x00, 0x25, 0x00, 0x2e, 0x00,
+  0x37, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x13, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x07, 0x00, 0x11, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x12, 0x00, 0x1c, 0x00, 0x25, 0x00, 0x2d, 0x00, 0x36, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x13, 0x00, 0x1a, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x20, 0x00, 0x5c, 0x00,
+  0x00, 0x00, 0x07, 0x00, 0x0f, 0x00, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x0f, 0x00, 0x16, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00,
+  0x29, 0x00, 0x32, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00,
+  0x3d, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x0b, 0x00,
+  0x13, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0a, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00,
+  0x0f, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x42, 0x00, 0x46, 0x00, 0x4d, 0x00,
+  0x53, 0x00, 0x5a, 0x00, 0x61, 0x00, 0x00, 0x00, 0x39, 0x00, 0x41, 0x00,
+  0x00, 0x00, 0x06, 0x00, 0x0e, 0x00, 0x16, 0x00, 0x1d, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x10, 0x00, 0x18, 0x00,
+  0x21, 0x00, 0x28, 0x00, 0x31, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x0b, 0x00,
+  0x00, 0x00, 0x08, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0a, 0x00, 0x15, 0x00, 0x1f, 0x00, 0x26, 0x00, 0x00, 0x00,
+  0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x3b, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x13, 0x00, 0x00, 0x00, 0x08, 0x00, 0x0e, 0x00,
+  0x15, 0x00, 0x1b, 0x00, 0x22, 0x00, 0x29, 0x00, 0x00, 0x00, 0x08, 0x00,
+  0x00, 0x00, 0x47, 0x00, 0x50, 0x00, 0x57, 0x00, 0x5f, 0x00, 0x67, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x10, 0x00,
+  0x19, 0x00, 0x1f, 0x00, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x00,
+  0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x10, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x08, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x07, 0x00,
+  0x0e, 0x00, 0x15, 0x00, 0x1b, 0x00, 0x22, 0x00, 0x28, 0x00, 0x00, 0x00,
+  0x29, 0x00, 0x32, 0x00, 0x39, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0e, 0x00,
+  0x00, 0x00, 0x06, 0x00, 0x0d, 0x00, 0x13, 0x00, 0x1a, 0x00, 0x20, 0x00,
+  0x27, 0x00, 0x2e, 0x00, 0x34, 0x00, 0x3c, 0x00, 0x45, 0x00, 0x4d, 0x00,
+  0x53, 0x00, 0x5b, 0x00, 0x62, 0x00, 0x68, 0x00, 0x6e, 0x00, 0x77, 0x00,
+  0x7e, 0x00, 0x86, 0x00, 0x00, 0x00, 0x08, 0x00, 0x0e, 0x00, 0x15, 0x00,
+  0x1e, 0x00, 0x00, 0x00, 0x08, 0x00, 0x10, 0x00, 0x17, 0x00, 0x1f, 0x00,
+  0x26, 0x00, 0x2d, 0x00, 0x36, 0x00, 0x3c, 0x00, 0x42, 0x00, 0x4a, 0x00,
+  0x50, 0x00, 0x57, 0x00, 0x5d, 0x00, 0x65, 0x00, 0x6c, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x0f, 0x00, 0x16, 0x00, 0x00, 0x00, 0x07, 0x00, 0x0f, 0x00,
+  0x16, 0x00, 0x1e, 0x00, 0x25, 0x00, 0x2c, 0x00, 0x33, 0x00, 0x3b, 0x00,
+  0x42, 0x00, 0x49, 0x00, 0x51, 0x00, 0x5a, 0x00, 0x63, 0x00, 0x69, 0x00,
+  0x70, 0x00, 0x77, 0x00, 0x7f, 0x00, 0x86, 0x00, 0x8d, 0x00, 0x94, 0x00,
+  0x9a, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x08, 0x00, 0x11, 0x00,
+  0x1a, 0x00, 0x22, 0x00, 0x2a, 0x00, 0x32, 0x00, 0x39, 0x00, 0x41, 0x00,
+  0x4a, 0x00, 0x53, 0x00, 0x5a, 0x00, 0x62, 0x00, 0x6b, 0x00, 0x72, 0x00,
+  0x79, 0x00, 0x00, 0x00, 0x05, 0x00, 0x11, 0x00, 0x00, 0x00, 0x08, 0x00,
+  0x0f, 0x00, 0x18, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x0b, 0x00,
+  0x14, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0c, 0x00, 0x12, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x15, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x10, 0x00,
+  0x00, 0x00, 0x1f, 0x00, 0x27, 0x00, 0x00, 0x00, 0x21, 0x00, 0x29, 0x00,
+  0x32, 0x00, 0x3c, 0x00, 0x43, 0x00, 0x4a, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x00, 0x00, 0x21, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00,
+  0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00,
+  0x20, 0x00, 0x29, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x65, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x35, 0x00, 0x3e, 0x00, 0x47, 0x00, 0x00, 0x00, 0x34, 0x00,
+  0x00, 0x00, 0x30, 0x00, 0x39, 0x00, 0x00, 0x00, 0x37, 0x00, 0x3d, 0x00,
+  0x44, 0x00, 0x4b, 0x00, 0x52, 0x00, 0x59, 0x00, 0x5f, 0x00, 0x65, 0x00,
+  0x00, 0x00, 0x34, 0x00, 0x38, 0x00, 0x3f, 0x00, 0x46, 0x00, 0x4c, 0x00,
+  0x00, 0x00, 0x38, 0x00, 0x3f, 0x00, 0x46, 0x00, 0x4e, 0x00, 0x54, 0x00,
+  0x5c, 0x00, 0x62, 0x00, 0x6a, 0x00, 0x71, 0x00, 0x77, 0x00, 0x7f, 0x00,
+  0x87, 0x00, 0x8f, 0x00, 0x97, 0x00, 0x9d, 0x00, 0xa4, 0x00, 0xab, 0x00,
+  0x00, 0x00, 0x06, 0x00, 0x0c, 0x00, 0x12, 0x00, 0x18, 0x00, 0x1f, 0x00,
+  0x26, 0x00, 0x2d, 0x00, 0x35, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x34, 0x00,
+  0x3d, 0x00, 0x44, 0x00, 0x4b, 0x00, 0x52, 0x00, 0x59, 0x00, 0x61, 0x00,
+  0x6a, 0x00, 0x72, 0x00, 0x79, 0x00, 0x82, 0x00, 0x8b, 0x00, 0x93, 0x00,
+  0x9b, 0x00, 0x00, 0x00, 0x36, 0x00, 0x3d, 0x00, 0x46, 0x00, 0x4d, 0x00,
+  0x54, 0x00, 0x5c, 0x00, 0x64, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x08, 0x00,
+  0x10, 0x00, 0x17, 0x00, 0x1d, 0x00, 0x25, 0x00, 0x2d, 0x00, 0x35, 0x00,
+  0x3c, 0x00, 0x44, 0x00, 0x4c, 0x00, 0x54, 0x00, 0x5c, 0x00, 0x63, 0x00,
+  0x6c, 0x00, 0x73, 0x00, 0x7a, 0x00, 0x82, 0x00, 0x8a, 0x00, 0x93, 0x00,
+  0x9a, 0x00, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x11, 0x00,
+  0x1a, 0x00, 0x23, 0x00, 0x2a, 0x00, 0x34, 0x00, 0x3d, 0x00, 0x46, 0x00,
+  0x4e, 0x00, 0x57, 0x00, 0x5e, 0x00, 0x66, 0x00, 0x6e, 0x00, 0x75, 0x00,
+  0x7d, 0x00, 0x86, 0x00, 0x8f, 0x00, 0x98, 0x00, 0xa0, 0x00, 0xa9, 0x00,
+  0x00, 0x00, 0x07, 0x00, 0x10, 0x00, 0x19, 0x00, 0x00, 0x00, 0x08, 0x00,
+  0x11, 0x00, 0x1a, 0x00, 0x23, 0x00, 0x2b, 0x00, 0x33, 0x00, 0x3c, 0x00,
+  0x45, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x04, 0x00,
+  0x0d, 0x00, 0x14, 0x00, 0x1d, 0x00, 0x25, 0x00, 0x2e, 0x00, 0x38, 0x00,
+  0x41, 0x00, 0x49, 0x00, 0x51, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x11, 0x00, 0x1b, 0x00, 0x25, 0x00, 0x00, 0x00, 0x0f, 0x00,
+  0x1a, 0x00, 0x20, 0x00, 0x28, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x16, 0x00,
+  0x1f, 0x00, 0x25, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x13, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x10, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x07, 0x00,
+  0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x11, 0x00,
+  0x00, 0x00, 0x0a, 0x00, 0x12, 0x00, 0x1b, 0x00, 0x23, 0x00, 0x2b, 0x00,
+  0x34, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x11, 0x00,
+  0x1b, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0f, 0x00,
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x1a, 0x00, 0x25, 0x00,
+  0x2e, 0x00, 0x35, 0x00, 0x3f, 0x00, 0x45, 0x00, 0x00, 0x00, 0x13, 0x00,
+  0x1a, 0x00, 0x23, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x13, 0x00, 0x1a, 0x00,
+  0x25, 0x00, 0x2f, 0x00, 0x35, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x07, 0x00,
+  0x10, 0x00, 0x18, 0x00, 0x21, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x06, 0x00,
+  0x0c, 0x00, 0x12, 0x00, 0x1a, 0x00, 0x21, 0x00, 0x29, 0x00, 0x2f, 0x00,
+  0x00, 0x00, 0x07, 0x00, 0x10, 0x00, 0x00, 0x00, 0x05, 0x00, 0x0b, 0x00,
+  0x12, 0x00, 0x1a, 0x00, 0x22, 0x00, 0x2a, 0x00, 0x30, 0x00, 0x39, 0x00,
+  0x3f, 0x00, 0x47, 0x00, 0x00, 0x00, 0x07, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x19, 0x00, 0x21, 0x00, 0x27, 0x00, 0x2e, 0x00, 0x36, 0x00,
+  0x3d, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x14, 0x00, 0x1d, 0x00, 0x25, 0x00,
+  0x2e, 0x00, 0x36, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x08, 0x00, 0x10, 0x00,
+  0x17, 0x00, 0x24, 0x00, 0x35, 0x00, 0x3e, 0x00, 0x46, 0x00, 0x4e, 0x00,
+  0x58, 0x00, 0x5e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x18, 0x00,
+  0x20, 0x00, 0x28, 0x00, 0x31, 0x00, 0x39, 0x00, 0x42, 0x00, 0x49, 0x00,
+  0x50, 0x00, 0x58, 0x00, 0x5e, 0x00, 0x67, 0x00, 0x6f, 0x00, 0x00, 0x00,
+  0x25, 0x00, 0x40, 0x00, 0x55, 0x00, 0x5e, 0x00, 0x66, 0x00, 0x6e, 0x00,
+  0x00, 0x00, 0x14, 0x00, 0x1d, 0x00, 0x29, 0x00, 0x34, 0x00, 0x3a, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x1b, 0x00, 0x23, 0x00, 0x00, 0x00, 0x41, 0x00,
+  0x48, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x4f, 0x00, 0x60, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x37, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x00,
+  0x34, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0c, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0x07, 0x00, 0x0e, 0x00, 0x15, 0x00, 0x1b, 0x00,
+  0x22, 0x00, 0x29, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00,
+  0x0c, 0x00, 0x13, 0x00, 0x19, 0x00, 0x20, 0x00, 0x00, 0x00, 0x28, 0x00,
+  0x2e, 0x00, 0x36, 0x00, 0x00, 0x00, 0x07, 0x00, 0x0f, 0x00, 0x16, 0x00,
+  0x1f, 0x00, 0x27, 0x00, 0x2e, 0x00, 0x34, 0x00, 0x3a, 0x00, 0x40, 0x00,
+  0x46, 0x00, 0x4c, 0x00, 0x52, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x11, 0x00, 0x18, 0x00, 0x21, 0x00, 0x29, 0x00, 0x30, 0x00,
+  0x38, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x08, 0x00, 0x0e, 0x00,
+  0x16, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x09, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x11, 0x00, 0x18, 0x00, 0x1f, 0x00, 0x28, 0x00, 0x30, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00,
+  0x00, 0x00, 0x29, 0x00, 0x68, 0x00, 0x71, 0x00, 0x7b, 0x00, 0x83, 0x00,
+  0x00, 0x00, 0x15, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x34, 0x00, 0x3e, 0x00,
+  0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x12, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0a, 0x00, 0x10, 0x00, 0x16, 0x00, 0x00, 0x00, 0x13, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x29, 0x00, 0x00, 0x00, 0x11, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x11, 0x00, 0x17, 0x00, 0x1d, 0x00,
+  0x23, 0x00, 0x29, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0c, 0x00,
+  0x13, 0x00, 0x1a, 0x00, 0x21, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x15, 0x00,
+  0x1c, 0x00, 0x22, 0x00, 0x2a, 0x00, 0x31, 0x00, 0x37, 0x00, 0x3d, 0x00,
+  0x44, 0x00, 0x4a, 0x00, 0x50, 0x00, 0x00, 0x00, 0x08, 0x00, 0x0e, 0x00,
+  0x16, 0x00, 0x1c, 0x00, 0x22, 0x00, 0x29, 0x00, 0x2f, 0x00, 0x35, 0x00,
+  0x3c, 0x00, 0x44, 0x00, 0x00, 0x00, 0x07, 0x00, 0x0e, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x0e, 0x00, 0x17, 0x00, 0x1e, 0x00, 0x25, 0x00, 0x2b, 0x00,
+  0x32, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x08, 0x00, 0x10, 0x00, 0x18, 0x00,
+  0x00, 0x00, 0x07, 0x00, 0x14, 0x00, 0x1c, 0x00, 0x23, 0x00, 0x2b, 0x00,
+  0x33, 0x00, 0x3b, 0x00, 0x43, 0x00, 0x4b, 0x00, 0x52, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x0c, 0x00, 0x13, 0x00, 0x19, 0x00, 0x22, 0x00, 0x29, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x17, 0x00, 0x21, 0x00, 0x28, 0x00, 0x30, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x10, 0x00, 0x00, 0x00, 0x35, 0x00,
+  0x00, 0x00, 0x08, 0x00, 0x0e, 0x00, 0x16, 0x00, 0x00, 0x00, 0x08, 0x00,
+  0x0e, 0x00, 0x15, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x09, 0x00, 0x0f, 0x00,
+  0x15, 0x00, 0x1d, 0x00, 0x23, 0x00, 0x29, 0x00, 0x31, 0x00, 0x39, 0x00,
+  0x41, 0x00, 0x00, 0x00, 0x29, 0x00, 0x56, 0x00, 0x00, 0x00, 0x28, 0x00,
+  0x53, 0x00, 0x66, 0x00, 0x6c, 0x00, 0x76, 0x00, 0x7c, 0x00, 0x83, 0x00,
+  0x89, 0x00, 0x91, 0x00, 0x9b, 0x00, 0xa3, 0x00, 0x00, 0x00, 0x15, 0x00,
+  0x4a, 0x00, 0x53, 0x00, 0x00, 0x00, 0x11, 0x00, 0x40, 0x00, 0x46, 0x00,
+  0x4c, 0x00, 0x56, 0x00, 0x5f, 0x00, 0x65, 0x00, 0x6d, 0x00, 0x74, 0x00,
+  0x00, 0x00, 0x23, 0x00, 0x52, 0x00, 0x00, 0x00, 0x13, 0x00, 0x40, 0x00,
+  0x53, 0x00, 0x5a, 0x00, 0x62, 0x00, 0x6a, 0x00, 0x74, 0x00, 0x7d, 0x00,
+  0x83, 0x00, 0x8b, 0x00, 0x92, 0x00, 0x99, 0x00, 0xa0, 0x00, 0xa9, 0x00,
+  0xb2, 0x00, 0xbc, 0x00, 0x00, 0x00, 0x11, 0x00, 0x3c, 0x00, 0x5a, 0x00,
+  0x00, 0x00, 0x1b, 0x00, 0x50, 0x00, 0x61, 0x00, 0x6a, 0x00, 0x72, 0x00,
+  0x7d, 0x00, 0x84, 0x00, 0x8e, 0x00, 0x96, 0x00, 0x9f, 0x00, 0xa7, 0x00,
+  0xb1, 0x00, 0xba, 0x00, 0x00, 0x00, 0x22, 0x00, 0x2b, 0x00, 0x31, 0x00,
+  0x39, 0x00, 0x43, 0x00, 0x00, 0x00, 0x20, 0x00, 0x4c, 0x00, 0x5c, 0x00,
+  0x65, 0x00, 0x70, 0x00, 0x79, 0x00, 0x86, 0x00, 0x8e, 0x00, 0x95, 0x00,
+  0x9d, 0x00, 0xa5, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x14, 0x00, 0x1e, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x31, 0x00, 0x00, 0x00,
+  0x4d, 0x00, 0x00, 0x00, 0x26, 0x00, 0x2c, 0x00, 0x33, 0x00, 0x3a, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x28, 0x00, 0x39, 0x00, 0x40, 0x00, 0x46, 0x00,
+  0x4b, 0x00, 0x53, 0x00, 0x00, 0x00, 0x11, 0x00, 0x19, 0x00, 0x00, 0x00,
+  0x38, 0x00, 0x6f, 0x00, 0x76, 0x00, 0x82, 0x00, 0x89, 0x00, 0x00, 0x00,
+  0x24, 0x00, 0x00, 0x00, 0x35, 0x00, 0x3c, 0x00, 0x44, 0x00, 0x4c, 0x00,
+  0x54, 0x00, 0x5c, 0x00, 0x62, 0x00, 0x68, 0x00, 0x6f, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x22, 0x00, 0x2a, 0x00, 0x32, 0x00,
+  0x3a, 0x00, 0x40, 0x00, 0x00, 0x00, 0x32, 0x00, 0x4e, 0x00, 0x73, 0x00,
+  0x7f, 0x00, 0x87, 0x00, 0x8f, 0x00, 0x00, 0x00, 0x36, 0x00, 0x57, 0x00,
+  0x85, 0x00, 0x8e, 0x00, 0x97, 0x00, 0xa0, 0x00, 0xa8, 0x00, 0x00, 0x00,
+  0x1b, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x18, 0x00,
+  0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x3f, 0x00, 0x47, 0x00,
+  0x4e, 0x00, 0x56, 0x00, 0x00, 0x00, 0x20, 0x00, 0x29, 0x00, 0x30, 0x00,
+  0x36, 0x00, 0x00, 0x00, 0x28, 0x00, 0x31, 0x00, 0x39, 0x00, 0x42, 0x00,
+  0x4b, 0x00, 0x54, 0x00, 0x00, 0x00, 0x08, 0x00, 0x0f, 0x00, 0x15, 0x00,
+  0x1d, 0x00, 0x00, 0x00, 0x09, 0x00, 0x13, 0x00, 0x1d, 0x00, 0x26, 0x00,
+  0x00, 0x00, 0x27, 0x00, 0x30, 0x00, 0x39, 0x00, 0x40, 0x00, 0x47, 0x00,
+  0x00, 0x00, 0x15, 0x00, 0x34, 0x00, 0x3d, 0x00, 0x46, 0x00, 0x00, 0x00,
+  0x2c, 0x00, 0x32, 0x00, 0x38, 0x00, 0x3e, 0x00, 0x47, 0x00, 0x00, 0x00,
+  0x1d, 0x00, 0x30, 0x00, 0x4c, 0x00, 0x80, 0x00, 0x8a, 0x00, 0x00, 0x00,
+  0x1f, 0x00, 0x43, 0x00, 0x4b, 0x00, 0x54, 0x00, 0x5b, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x18, 0x00, 0x00, 0x00, 0x11, 0x00, 0x18, 0x00, 0x21, 0x00,
+  0x29, 0x00, 0x34, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x1e, 0x00, 0x44, 0x00, 0x4d, 0x00, 0x56, 0x00, 0x5e, 0x00,
+  0x68, 0x00, 0x00, 0x00, 0x13, 0x00, 0x29, 0x00, 0x30, 0x00, 0x37, 0x00,
+  0x00, 0x00, 0x21, 0x00, 0x3b, 0x00, 0x4a, 0x00, 0x51, 0x00, 0x5b, 0x00,
+  0x66, 0x00, 0x70, 0x00, 0x00, 0x00, 0x15, 0x00, 0x28, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x11, 0x00, 0x18, 0x00, 0x1f, 0x00,
+  0x25, 0x00, 0x00, 0x00, 0x26, 0x00, 0x56, 0x00, 0x00, 0x00, 0x20, 0x00,
+  0x3a, 0x00, 0x46, 0x00, 0x4e, 0x00, 0x55, 0x00, 0x5d, 0x00, 0x66, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x30, 0x00, 0x38, 0x00, 0x3e, 0x00,
+  0x44, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x36, 0x00, 0x3e, 0x00, 0x00, 0x00,
+  0x24, 0x00, 0x4c, 0x00, 0x85, 0x00, 0x8b, 0x00, 0x91, 0x00, 0x99, 0x00,
+  0xa1, 0x00, 0xa9, 0x00, 0xb1, 0x00, 0x00, 0x00, 0x15, 0x00, 0x1c, 0x00,
+  0x22, 0x00, 0x2b, 0x00, 0x31, 0x00, 0x00, 0x00, 0x20, 0x00, 0x28, 0x00,
+  0x31, 0x00, 0x39, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x12, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x33, 0x00, 0x3c, 0x00, 0x45, 0x00,
+  0x00, 0x00, 0x21, 0x00, 0x4e, 0x00, 0x5d, 0x00, 0x67, 0x00, 0x00, 0x00,
+  0x19, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x17, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x22, 0x00,
+  0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x30, 0x00, 0x38, 0x00,
+  0x3f, 0x00, 0x46, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x10, 0x00, 0x17, 0x00, 0x1e, 0x00, 0x24, 0x00, 0x2a, 0x00, 0x31, 0x00,
+  0x38, 0x00, 0x40, 0x00, 0x46, 0x00, 0x4d, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x12, 0x00, 0x1b, 0x00, 0x24, 0x00, 0x2d, 0x00, 0x36, 0x00, 0x3d, 0x00,
+  0x46, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x36, 0x00, 0x3d, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x13, 0x00, 0x1d, 0x00, 0x24, 0x00, 0x2b, 0x00, 0x35, 0x00,
+  0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x24, 0x00, 0x43, 0x00, 0x49, 0x00,
+  0x53, 0x00, 0x00, 0x00, 0x13, 0x00, 0x1a, 0x00, 0x22, 0x00, 0x2b, 0x00,
+  0x33, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x22, 0x00, 0x29, 0x00,
+  0x00, 0x00, 0x2d, 0x00, 0x33, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x07, 0x00,
+  0x11, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x15, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00,
+  0x2b, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0d, 0x00,
+  0x14, 0x00, 0x1d, 0x00, 0x24, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x0f, 0x00, 0x15, 0x00, 0x1b, 0x00, 0x23, 0x00, 0x2a, 0x00,
+  0x00, 0x00, 0x41, 0x00, 0x48, 0x00, 0x00, 0x00, 0x41, 0x00, 0x47, 0x00,
+  0x4e, 0x00, 0x56, 0x00, 0x5d, 0x00, 0x65, 0x00, 0x00, 0x00, 0x06, 0x00,
+  0x0c, 0x00, 0x12, 0x00, 0x18, 0x00, 0x00, 0x00, 0x09, 0x00, 0x11, 0x00,
+  0x19, 0x00, 0x21, 0x00, 0x2a, 0x00, 0x32, 0x00, 0x39, 0x00, 0x42, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x18, 0x00, 0x20, 0x00, 0x28, 0x00, 0x2f, 0x00,
+  0x35, 0x00, 0x00, 0x00, 0x08, 0x00, 0x11, 0x00, 0x19, 0x00, 0x1f, 0x00,
+  0x26, 0x00, 0x2d, 0x00, 0x36, 0x00, 0x3e, 0x00, 0x46, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x0e, 0x00, 0x15, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x08, 0x00,
+  0x0e, 0x00, 0x16, 0x00, 0x1e, 0x00, 0x27, 0x00, 0x30, 0x00, 0x37, 0x00,
+  0x00, 0x00, 0x06, 0x00, 0x0d, 0x00, 0x15, 0x00, 0x1d, 0x00, 0x25, 0x00,
+  0x2c, 0x00, 0x33, 0x00, 0x00, 0x00, 0x07, 0x00, 0x0f, 0x00, 0x18, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x10, 0x00, 0x19, 0x00, 0x21, 0x00, 0x28, 0x00,
+  0x2f, 0x00, 0x36, 0x00, 0x3d, 0x00, 0x45, 0x00, 0x4d, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00,
+  0x12, 0x00, 0x1a, 0x00, 0x22, 0x00, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x09, 0x00, 0x12, 0x00,
+  0x1b, 0x00, 0x24, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x07, 0x00, 0x0f, 0x00,
+  0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x10, 0x00, 0x16, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x35, 0x00, 0x3e, 0x00, 0x45, 0x00, 0x4e, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0e, 0x00, 0x15, 0x00,
+  0x00, 0x00, 0x06, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x07, 0x00, 0x10, 0x00,
+  0x18, 0x00, 0x21, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00,
+  0x0f, 0x00, 0x18, 0x00, 0x21, 0x00, 0x27, 0x00, 0x30, 0x00, 0x38, 0x00,
+  0x40, 0x00, 0x49, 0x00, 0x52, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x07, 0x00,
+  0x0f, 0x00, 0x15, 0x00, 0x1c, 0x00, 0x24, 0x00, 0x00, 0x00, 0x08, 0x00,
+  0x10, 0x00, 0x19, 0x00, 0x23, 0x00, 0x2c, 0x00, 0x34, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x11, 0x00, 0x18, 0x00, 0x20, 0x00, 0x27, 0x00, 0x30, 0x00,
+  0x00, 0x00, 0x08, 0x00, 0x0f, 0x00, 0x18, 0x00, 0x00, 0x00, 0x08, 0x00,
+  0x0e, 0x00, 0x15, 0x00, 0x1d, 0x00, 0x24, 0x00, 0x2b, 0x00, 0x00, 0x00,
+  0x39, 0x00, 0x43, 0x00, 0x4d, 0x00, 0x56, 0x00, 0x60, 0x00, 0x69, 0x00,
+  0x72, 0x00, 0x00, 0x00, 0x09, 0x00, 0x12, 0x00, 0x1a, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x10, 0x00, 0x16, 0x00, 0x22, 0x00, 0x2a, 0x00, 0x00, 0x00,
+  0x37, 0x00, 0x3d, 0x00, 0x46, 0x00, 0x4f, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x16, 0x00, 0x22, 0x00, 0x2c, 0x00, 0x35, 0x00, 0x3f, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x34, 0x00, 0x52, 0x00, 0x5e, 0x00, 0x65, 0x00, 0x00, 0x00,
+  0x1e, 0x00, 0x28, 0x00, 0x31, 0x00, 0x00, 0x00, 0x09, 0x00, 0x15, 0x00,
+  0x1e, 0x00, 0x26, 0x00, 0x2f, 0x00, 0x38, 0x00, 0x40, 0x00, 0x49, 0x00,
+  0x52, 0x00, 0x5a, 0x00, 0x61, 0x00, 0x00, 0x00, 0x38, 0x00, 0x54, 0x00,
+  0x5a, 0x00, 0x62, 0x00, 0x68, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x26, 0x00,
+  0x2d, 0x00, 0x36, 0x00, 0x3f, 0x00, 0x48, 0x00, 0x50, 0x00, 0x59, 0x00,
+  0x62, 0x00, 0x6a, 0x00, 0x76, 0x00, 0x80, 0x00, 0x89, 0x00, 0x00, 0x00,
+  0x22, 0x00, 0x29, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x28, 0x00, 0x32, 0x00,
+  0x39, 0x00, 0x41, 0x00, 0x49, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x26, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x12, 0x00, 0x1b, 0x00, 0x23, 0x00, 0x2c, 0x00,
+  0x00, 0x00, 0x0b, 0x00, 0x14, 0x00, 0x00, 0x00, 0x23, 0x00, 0x2d, 0x00,
+  0x36, 0x00, 0x41, 0x00, 0x4b, 0x00, 0x54, 0x00, 0x00, 0x00, 0x18, 0x00,
+  0x21, 0x00, 0x2a, 0x00, 0x33, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x15, 0x00,
+  0x21, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x17, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x0d, 0x00, 0x19, 0x00, 0x25, 0x00,
+  0x2e, 0x00, 0x37, 0x00, 0x00, 0x00, 0x28, 0x00, 0x40, 0x00, 0x46, 0x00,
+  0x53, 0x00, 0x5c, 0x00, 0x63, 0x00, 0x6a, 0x00, 0x71, 0x00, 0x79, 0x00,
+  0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x45, 0x00, 0x51, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x50, 0x00, 0x6c, 0x00, 0x75, 0x00, 0x00, 0x00,
+  0x4c, 0x00, 0x8c, 0x00, 0xa9, 0x00, 0xc1, 0x00, 0xc8, 0x00, 0xcf, 0x00,
+  0x00, 0x00, 0x3c, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00,
+  0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x24, 0x00, 0x3e, 0x00, 0x61, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x12, 0x00, 0x26, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x26, 0x00, 0x00, 0x00, 0x24, 0x00, 0x47, 0x00, 0x7a, 0x00,
+  0x81, 0x00, 0x00, 0x00, 0x21, 0x00, 0x33, 0x00, 0x00, 0x00, 0x12, 0x00,
+  0x3c, 0x00, 0x45, 0x00, 0x00, 0x00, 0x14, 0x00, 0x28, 0x00, 0x00, 0x00,
+  0x21, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x10, 0x00, 0x16, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x3f, 0x00, 0x5e, 0x00, 0x9d, 0x00,
+  0xde, 0x00, 0xe4, 0x00, 0xec, 0x00, 0xf3, 0x00, 0xfb, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x3b, 0x00, 0x57, 0x00, 0x88, 0x00, 0x00, 0x00, 0x3b, 0x00,
+  0x53, 0x00, 0x74, 0x00, 0x9e, 0x00, 0xa5, 0x00, 0xad, 0x00, 0xb4, 0x00,
+  0xbb, 0x00, 0xc2, 0x00, 0xc9, 0x00, 0x00, 0x00, 0x22, 0x00, 0x49, 0x00,
+  0x64, 0x00, 0x7e, 0x00, 0x85, 0x00, 0x00, 0x00, 0x33, 0x00, 0x4f, 0x00,
+  0x5f, 0x00, 0x97, 0x00, 0xda, 0x00, 0xe1, 0x00, 0xe8, 0x00, 0xef, 0x00,
+  0xf8, 0x00, 0x01, 0x01, 0x00, 0x00, 0x14, 0x00, 0x2e, 0x00, 0x53, 0x00,
+  0x8c, 0x00, 0x00, 0x00, 0x20, 0x00, 0x3f, 0x00, 0x6b, 0x00, 0xa3, 0x00,
+  0xdc, 0x00, 0x18, 0x01, 0x20, 0x01, 0x29, 0x01, 0x30, 0x01, 0x39, 0x01,
+  0x00, 0x00, 0x1c, 0x00, 0x39, 0x00, 0x4f, 0x00, 0x6b, 0x00, 0xa6, 0x00,
+  0xaf, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x32, 0x00, 0x44, 0x00, 0x4d, 0x00,
+  0x54, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x12, 0x00, 0x24, 0x00, 0x00, 0x00,
+  0x29, 0x00, 0x3b, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x37, 0x00,
+  0x5b, 0x00, 0x61, 0x00, 0x67, 0x00, 0x6f, 0x00, 0x00, 0x00, 0x1f, 0x00,
+  0x3b, 0x00, 0x80, 0x00, 0x89, 0x00, 0x00, 0x00, 0x29, 0x00, 0x4a, 0x00,
+  0x80, 0x00, 0xb7, 0x00, 0xd8, 0x00, 0x00, 0x00, 0x16, 0x00, 0x30, 0x00,
+  0x4f, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x21, 0x00, 0x31, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x20, 0x00, 0x43, 0x00, 0x6a, 0x00, 0x84, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x3d, 0x00, 0x66, 0x00, 0x94, 0x00, 0xbd, 0x00, 0xc4, 0x00,
+  0xc8, 0x00, 0x00, 0x00, 0x33, 0x00, 0x43, 0x00, 0x53, 0x00, 0x7a, 0x00,
+  0x92, 0x00, 0xb3, 0x00, 0x00, 0x00, 0x35, 0x00, 0x47, 0x00, 0x6a, 0x00,
+  0x91, 0x00, 0xa7, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x35, 0x00, 0x5a, 0x00,
+  0x79, 0x00, 0x94, 0x00, 0xc6, 0x00, 0x00, 0x00, 0x21, 0x00, 0x31, 0x00,
+  0x47, 0x00, 0x71, 0x00, 0x8d, 0x00, 0xab, 0x00, 0x00, 0x00, 0x19, 0x00,
+  0x2b, 0x00, 0x41, 0x00, 0x55, 0x00, 0x86, 0x00, 0x00, 0x00, 0x1f, 0x00,
+  0x31, 0x00, 0x58, 0x00, 0x70, 0x00, 0xa1, 0x00, 0xa9, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x48, 0x00, 0x6c, 0x00, 0x7c, 0x00, 0xb2, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x2e, 0x00, 0x56, 0x00, 0x66, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x26, 0x00, 0x38, 0x00, 0x64, 0x00, 0xa3, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x30, 0x00, 0x46, 0x00, 0x58, 0x00, 0x72, 0x00, 0xb1, 0x00, 0x00, 0x00,
+  0x33, 0x00, 0x51, 0x00, 0x72, 0x00, 0x93, 0x00, 0xb3, 0x00, 0x00, 0x00,
+  0x36, 0x00, 0x69, 0x00, 0x7d, 0x00, 0x97, 0x00, 0xb6, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x45, 0x00, 0x70, 0x00, 0x95, 0x00, 0xd8, 0x00, 0xde, 0x00,
+  0xe6, 0x00, 0xec, 0x00, 0x00, 0x00, 0x10, 0x00, 0x26, 0x00, 0x4b, 0x00,
+  0x8c, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x47, 0x00, 0x6a, 0x00, 0x80, 0x00,
+  0xa9, 0x00, 0xe2, 0x00, 0xfd, 0x00, 0x26, 0x01, 0x2d, 0x01, 0x34, 0x01,
+  0x3a, 0x01, 0x42, 0x01, 0x49, 0x01, 0x51, 0x01, 0x58, 0x01, 0x00, 0x00,
+  0x18, 0x00, 0x32, 0x00, 0x4a, 0x00, 0x5c, 0x00, 0x72, 0x00, 0x86, 0x00,
+  0xb3, 0x00, 0xda, 0x00, 0xe0, 0x00, 0xe6, 0x00, 0xec, 0x00, 0xf2, 0x00,
+  0x00, 0x00, 0x21, 0x00, 0x42, 0x00, 0x6b, 0x00, 0x8a, 0x00, 0xb5, 0x00,
+  0xda, 0x00, 0xfe, 0x00, 0x3f, 0x01, 0x51, 0x01, 0x65, 0x01, 0x75, 0x01,
+  0x87, 0x01, 0xaf, 0x01, 0xd2, 0x01, 0xe6, 0x01, 0xee, 0x01, 0x00, 0x00,
+  0x41, 0x00, 0x80, 0x00, 0x94, 0x00, 0xa4, 0x00, 0xc5, 0x00, 0xe8, 0x00,
+  0x0f, 0x01, 0x00, 0x00, 0x25, 0x00, 0x43, 0x00, 0x63, 0x00, 0x86, 0x00,
+  0xb3, 0x00, 0xda, 0x00, 0x00, 0x01, 0x14, 0x01, 0x38, 0x01, 0x57, 0x01,
+  0x69, 0x01, 0x97, 0x01, 0xa7, 0x01, 0xde, 0x01, 0xf9, 0x01, 0x01, 0x02,
+  0x00, 0x00, 0x33, 0x00, 0x45, 0x00, 0x5d, 0x00, 0x80, 0x00, 0x94, 0x00,
+  0xb5, 0x00, 0xcd, 0x00, 0xe3, 0x00, 0xf3, 0x00, 0xfc, 0x00, 0x02, 0x01,
+  0x00, 0x00, 0x16, 0x00, 0x2c, 0x00, 0x3e, 0x00, 0x54, 0x00, 0x81, 0x00,
+  0x99, 0x00, 0xbe, 0x00, 0xd0, 0x00, 0xd9, 0x00, 0xe2, 0x00, 0xeb, 0x00,
+  0xf4, 0x00, 0x00, 0x00, 0x37, 0x00, 0x5a, 0x00, 0x78, 0x00, 0x90, 0x00,
+  0xa0, 0x00, 0xb6, 0x00, 0xd9, 0x00, 0x05, 0x01, 0x19, 0x01, 0x1f, 0x01,
+  0x00, 0x00, 0x23, 0x00, 0x42, 0x00, 0x5a, 0x00, 0x7b, 0x00, 0xa3, 0x00,
+  0xc3, 0x00, 0x00, 0x00, 0x25, 0x00, 0x37, 0x00, 0x45, 0x00, 0x64, 0x00,
+  0x9a, 0x00, 0xb0, 0x00, 0xc2, 0x00, 0xca, 0x00, 0xd2, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x35, 0x00, 0x47, 0x00, 0x57, 0x00, 0x6f, 0x00, 0x91, 0x00,
+  0x98, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x3e, 0x00, 0x52, 0x00, 0x74, 0x00,
+  0x9b, 0x00, 0xbd, 0x00, 0xeb, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x4e, 0x00,
+  0x5c, 0x00, 0x6e, 0x00, 0x8f, 0x00, 0x9f, 0x00, 0xaf, 0x00, 0x00, 0x00,
+  0x1a, 0x00, 0x2c, 0x00, 0x3c, 0x00, 0x62, 0x00, 0x84, 0x00, 0xa1, 0x00,
+  0x00, 0x00, 0x35, 0x00, 0x53, 0x00, 0x65, 0x00, 0x75, 0x00, 0x93, 0x00,
+  0xc2, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x18, 0x00, 0x2e, 0x00, 0x3e, 0x00,
+  0x54, 0x00, 0x83, 0x00, 0x97, 0x00, 0x00, 0x00, 0x12, 0x00, 0x4d, 0x00,
+  0x5f, 0x00, 0x73, 0x00, 0x8d, 0x00, 0xa9, 0x00, 0xbd, 0x00, 0xd9, 0x00,
+  0xe2, 0x00, 0xe9, 0x00, 0x00, 0x00, 0x12, 0x00, 0x6c, 0x00, 0x7c, 0x00,
+  0x99, 0x00, 0xd6, 0x00, 0x04, 0x01, 0x25, 0x01, 0x3b, 0x01, 0x43, 0x01,
+  0x4b, 0x01, 0x00, 0x00, 0x31, 0x00, 0x4c, 0x00, 0x5e, 0x00, 0x6c, 0x00,
+  0x91, 0x00, 0xab, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x36, 0x00, 0x59, 0x00,
+  0x7b, 0x00, 0x8b, 0x00, 0xa6, 0x00, 0xc4, 0x00, 0xd8, 0x00, 0xde, 0x00,
+  0xea, 0x00, 0xf3, 0x00, 0x00, 0x00, 0x14, 0x00, 0x45, 0x00, 0x70, 0x00,
+  0x93, 0x00, 0xc0, 0x00, 0xd2, 0x00, 0xf0, 0x00, 0x00, 0x01, 0x0a, 0x01,
+  0x00, 0x00, 0x37, 0x00, 0x4d, 0x00, 0x7b, 0x00, 0xa7, 0x00, 0xbd, 0x00,
+  0xdb, 0x00, 0xf3, 0x00, 0x00, 0x00, 0x14, 0x00, 0x71, 0x00, 0x85, 0x00,
+  0xa6, 0x00, 0xe4, 0x00, 0xfa, 0x00, 0x18, 0x01, 0x49, 0x01, 0x00, 0x00,
+  0x18, 0x00, 0x47, 0x00, 0x5d, 0x00, 0x76, 0x00, 0xb0, 0x00, 0xe3, 0x00,
+  0x01, 0x01, 0x11, 0x01, 0x1b, 0x01, 0x22, 0x01, 0x29, 0x01, 0x30, 0x01,
+  0x39, 0x01, 0x41, 0x01, 0x00, 0x00, 0x1f, 0x00, 0x31, 0x00, 0x50, 0x00,
+  0x79, 0x00, 0x9a, 0x00, 0x00, 0x00, 0x18, 0x00, 0x46, 0x00, 0x5a, 0x00,
+  0x74, 0x00, 0x9f, 0x00, 0xb1, 0x00, 0xcd, 0x00, 0xd6, 0x00, 0xdd, 0x00,
+  0xe5, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x40, 0x00, 0x69, 0x00, 0x79, 0x00,
+  0x8b, 0x00, 0xb7, 0x00, 0x00, 0x00, 0x16, 0x00, 0x32, 0x00, 0x64, 0x00,
+  0x7a, 0x00, 0x92, 0x00, 0xa2, 0x00, 0xab, 0x00, 0xb3, 0x00, 0xbc, 0x00,
+  0x00, 0x00, 0x23, 0x00, 0x4a, 0x00, 0x5c, 0x00, 0x72, 0x00, 0x8c, 0x00,
+  0x00, 0x00, 0x1f, 0x00, 0x35, 0x00, 0x49, 0x00, 0x59, 0x00, 0x6d, 0x00,
+  0x88, 0x00, 0x9a, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x60, 0x00, 0x82, 0x00,
+  0x96, 0x00, 0xc3, 0x00, 0xd5, 0x00, 0xe5, 0x00, 0xec, 0x00, 0x00, 0x00,
+  0x37, 0x00, 0x5c, 0x00, 0x72, 0x00, 0x9c, 0x00, 0xae, 0x00, 0xc2, 0x00,
+  0xeb, 0x00, 0x00, 0x00, 0x39, 0x00, 0x5e, 0x00, 0x74, 0x00, 0xcf, 0x00,
+  0xf1, 0x00, 0x05, 0x01, 0x29, 0x01, 0x30, 0x01, 0x00, 0x00, 0x25, 0x00,
+  0x4a, 0x00, 0x8e, 0x00, 0xa0, 0x00, 0xb6, 0x00, 0xd3, 0x00, 0xd9, 0x00,
+  0xde, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x56, 0x00, 0x8f, 0x00, 0xab, 0x00,
+  0xe1, 0x00, 0x03, 0x01, 0x2e, 0x01, 0x63, 0x01, 0x85, 0x01, 0xa1, 0x01,
+  0xbe, 0x01, 0xf1, 0x01, 0x14, 0x02, 0x44, 0x02, 0x5c, 0x02, 0x7e, 0x02,
+  0x85, 0x02, 0x00, 0x00, 0x1d, 0x00, 0x2d, 0x00, 0x53, 0x00, 0x80, 0x00,
+  0x9c, 0x00, 0xc0, 0x00, 0xc8, 0x00, 0xce, 0x00, 0xd6, 0x00, 0x00, 0x00,
+  0x2e, 0x00, 0x5c, 0x00, 0x99, 0x00, 0xb9, 0x00, 0xf1, 0x00, 0x17, 0x01,
+  0x46, 0x01, 0x7d, 0x01, 0xb8, 0x01, 0xd8, 0x01, 0x05, 0x02, 0x1b, 0x02,
+  0x3e, 0x02, 0x57, 0x02, 0x84, 0x02, 0xa6, 0x02, 0x00, 0x00, 0x29, 0x00,
+  0x5c, 0x00, 0x70, 0x00, 0x8f, 0x00, 0xa1, 0x00, 0xb7, 0x00, 0xdb, 0x00,
+  0xe1, 0x00, 0xe8, 0x00, 0xee, 0x00, 0xf6, 0x00, 0xfd, 0x00, 0x05, 0x01,
+  0x0b, 0x01, 0x11, 0x01, 0x18, 0x01, 0x1e, 0x01, 0x00, 0x00, 0x2f, 0x00,
+  0x43, 0x00, 0x98, 0x00, 0xaa, 0x00, 0xc0, 0x00, 0xe0, 0x00, 0xe6, 0x00,
+  0xec, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x52, 0x00, 0xab, 0x00, 0xc1, 0x00,
+  0xdd, 0x00, 0x05, 0x01, 0x1f, 0x01, 0x26, 0x01, 0x2d, 0x01, 0x35, 0x01,
+  0x3c, 0x01, 0x45, 0x01, 0x4d, 0x01, 0x56, 0x01, 0x5c, 0x01, 0x62, 0x01,
+  0x00, 0x00, 0x36, 0x00, 0x4f, 0x00, 0x8d, 0x00, 0xd8, 0x00, 0xf7, 0x00,
+  0x28, 0x01, 0x3c, 0x01, 0x52, 0x01, 0x5b, 0x01, 0x77, 0x01, 0x00, 0x00,
+  0x27, 0x00, 0x46, 0x00, 0x5c, 0x00, 0x72, 0x00, 0x8f, 0x00, 0xb1, 0x00,
+  0xd6, 0x00, 0xec, 0x00, 0xf5, 0x00, 0xfc, 0x00, 0x04, 0x01, 0x0c, 0x01,
+  0x00, 0x00, 0x1b, 0x00, 0x41, 0x00, 0x51, 0x00, 0x77, 0x00, 0x95, 0x00,
+  0xa7, 0x00, 0x00, 0x00, 0x19, 0x00, 0x4e, 0x00, 0x75, 0x00, 0x92, 0x00,
+  0xad, 0x00, 0xbf, 0x00, 0x08, 0x01, 0x10, 0x01, 0x00, 0x00, 0x1d, 0x00,
+  0x4f, 0x00, 0x61, 0x00, 0x86, 0x00, 0x96, 0x00, 0xba, 0x00, 0xcc, 0x00,
+  0xd8, 0x00, 0xdf, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x43, 0x00, 0x55, 0x00,
+  0x74, 0x00, 0x8c, 0x00, 0xb0, 0x00, 0xbe, 0x00, 0xc6, 0x00, 0x00, 0x00,
+  0x25, 0x00, 0x3e, 0x00, 0x6b, 0x00, 0x8c, 0x00, 0xab, 0x00, 0xbf, 0x00,
+  0xd3, 0x00, 0xf0, 0x00, 0xf5, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x4b, 0x00,
+  0x6a, 0x00, 0x90, 0x00, 0xa6, 0x00, 0xca, 0x00, 0xe2, 0x00, 0xed, 0x00,
+  0x00, 0x00, 0x3a, 0x00, 0x81, 0x00, 0xaf, 0x00, 0xc1, 0x00, 0x00, 0x00,
+  0x15, 0x00, 0x49, 0x00, 0x73, 0x00, 0x8d, 0x00, 0xbe, 0x00, 0xc5, 0x00,
+  0xce, 0x00, 0xd4, 0x00, 0xda, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x13, 0x00,
+  0x52, 0x00, 0x9d, 0x00, 0xbb, 0x00, 0x00, 0x00, 0x17, 0x00, 0x47, 0x00,
+  0x8b, 0x00, 0xd8, 0x00, 0x10, 0x01, 0x2e, 0x01, 0x35, 0x01, 0x3b, 0x01,
+  0x44, 0x01, 0x4a, 0x01, 0x00, 0x00, 0x1f, 0x00, 0x50, 0x00, 0x60, 0x00,
+  0x7d, 0x00, 0x95, 0x00, 0xcb, 0x00, 0x00, 0x00, 0x21, 0x00, 0x70, 0x00,
+  0x9f, 0x00, 0xcd, 0x00, 0xe3, 0x00, 0x19, 0x01, 0x21, 0x01, 0x2a, 0x01,
+  0x32, 0x01, 0x3d, 0x01, 0x46, 0x01, 0x00, 0x00, 0x23, 0x00, 0x6f, 0x00,
+  0x88, 0x00, 0xa7, 0x00, 0xb7, 0x00, 0xd7, 0x00, 0x0f, 0x01, 0x18, 0x01,
+  0x23, 0x01, 0x00, 0x00, 0x1d, 0x00, 0x4c, 0x00, 0x99, 0x00, 0xb3, 0x00,
+  0xf3, 0x00, 0x11, 0x01, 0x47, 0x01, 0x4d, 0x01, 0x54, 0x01, 0x00, 0x00,
+  0x34, 0x00, 0x62, 0x00, 0x78, 0x00, 0xa7, 0x00, 0xc4, 0x00, 0xec, 0x00,
+  0x06, 0x01, 0x00, 0x00, 0x2c, 0x00, 0x5a, 0x00, 0x74, 0x00, 0xa5, 0x00,
+  0xc2, 0x00, 0xfd, 0x00, 0x20, 0x01, 0x42, 0x01, 0x4a, 0x01, 0x00, 0x00,
+  0x2c, 0x00, 0x3e, 0x00, 0x6d, 0x00, 0x8b, 0x00, 0xb0, 0x00, 0xce, 0x00,
+  0xf6, 0x00, 0x00, 0x00, 0x30, 0x00, 0x5d, 0x00, 0x7f, 0x00, 0x95, 0x00,
+  0xa9, 0x00, 0xc9, 0x00, 0xd1, 0x00, 0x00, 0x00, 0x28, 0x00, 0x61, 0x00,
+  0x79, 0x00, 0x95, 0x00, 0xae, 0x00, 0xc6, 0x00, 0x00, 0x00, 0x1e, 0x00,
+  0x57, 0x00, 0xa8, 0x00, 0xd6, 0x00, 0xf1, 0x00, 0x11, 0x01, 0x17, 0x01,
+  0x26, 0x01, 0x00, 0x00, 0x1a, 0x00, 0x2e, 0x00, 0x5f, 0x00, 0x7c, 0x00,
+  0xb6, 0x00, 0xdc, 0x00, 0xee, 0x00, 0xf5, 0x00, 0xfb, 0x00, 0x00, 0x00,
+  0x3a, 0x00, 0x4c, 0x00, 0x7d, 0x00, 0x9f, 0x00, 0xd5, 0x00, 0xfb, 0x00,
+  0x1f, 0x01, 0x26, 0x01, 0x00, 0x00, 0x22, 0x00, 0x34, 0x00, 0x61, 0x00,
+  0x9b, 0x00, 0xa2, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x3d, 0x00, 0x5c, 0x00,
+  0x8e, 0x00, 0x95, 0x00, 0x9b, 0x00, 0xa3, 0x00, 0xaa, 0x00, 0xb0, 0x00,
+  0xb6, 0x00, 0xbd, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x41, 0x00, 0x59, 0x00,
+  0x71, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x14, 0x00, 0x37, 0x00, 0x6a, 0x00,
+  0x80, 0x00, 0xb9, 0x00, 0xc1, 0x00, 0xc8, 0x00, 0xd1, 0x00, 0xda, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x24, 0x00, 0x45, 0x00, 0x78, 0x00, 0x9a, 0x00,
+  0xa2, 0x00, 0xab, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x3a, 0x00, 0x59, 0x00,
+  0x83, 0x00, 0x8b, 0x00, 0x94, 0x00, 0x9c, 0x00, 0xa4, 0x00, 0x00, 0x00,
+  0x23, 0x00, 0x5f, 0x00, 0x80, 0x00, 0xa9, 0x00, 0xc0, 0x00, 0xc7, 0x00,
+  0xd0, 0x00, 0xd9, 0x00, 0x00, 0x00, 0x24, 0x00, 0x53, 0x00, 0x74, 0x00,
+  0x91, 0x00, 0xae, 0x00, 0xbb, 0x00, 0xc1, 0x00, 0xc9, 0x00, 0xd3, 0x00,
+  0xda, 0x00, 0x00, 0x00, 0x16, 0x00, 0x62, 0x00, 0x85, 0x00, 0x97, 0x00,
+  0xaf, 0x00, 0xc3, 0x00, 0xd3, 0x00, 0xdb, 0x00, 0x00, 0x00, 0x29, 0x00,
+  0x69, 0x00, 0x8a, 0x00, 0x9c, 0x00, 0xa2, 0x00, 0xaa, 0x00, 0xb3, 0x00,
+  0xbc, 0x00, 0xc5, 0x00, 0xce, 0x00, 0x00, 0x00, 0x10, 0x00, 0x31, 0x00,
+  0x45, 0x00, 0x63, 0x00, 0xbe, 0x00, 0xcc, 0x00, 0xd4, 0x00, 0x00, 0x00,
+  0x22, 0x00, 0x51, 0x00, 0x7b, 0x00, 0x89, 0x00, 0xa7, 0x00, 0xb6, 0x00,
+  0x00, 0x00, 0x2c, 0x00, 0x3c, 0x00, 0x73, 0x00, 0x92, 0x00, 0x9b, 0x00,
+  0x00, 0x00, 0x46, 0x00, 0x63, 0x00, 0x88, 0x00, 0x9e, 0x00, 0xa7, 0x00,
+  0x00, 0x00, 0x23, 0x00, 0x72, 0x00, 0x8a, 0x00, 0xa2, 0x00, 0x00, 0x00,
+  0x2c, 0x00, 0x4f, 0x00, 0x80, 0x00, 0x9a, 0x00, 0xc4, 0x00, 0xcb, 0x00,
+  0xd1, 0x00, 0x00, 0x00, 0x25, 0x00, 0x44, 0x00, 0x5f, 0x00, 0x00, 0x00,
+  0x29, 0x00, 0x4e, 0x00, 0x70, 0x00, 0x86, 0x00, 0x98, 0x00, 0x00, 0x00,
+  0x2b, 0x00, 0x41, 0x00, 0x62, 0x00, 0x00, 0x00, 0x45, 0x00, 0x5b, 0x00,
+  0x7a, 0x00, 0x85, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x3f, 0x00, 0x4f, 0x00,
+  0x00, 0x00, 0x2b, 0x00, 0x6b, 0x00, 0x8f, 0x00, 0x9d, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x52, 0x00, 0x98, 0x00, 0xc8, 0x00, 0xd1, 0x00, 0x00, 0x00,
+  0x3e, 0x00, 0x7c, 0x00, 0xb7, 0x00, 0xd9, 0x00, 0x00, 0x00, 0x23, 0x00,
+  0x47, 0x00, 0x83, 0x00, 0xc4, 0x00, 0x00, 0x00, 0x30, 0x00, 0x46, 0x00,
+  0x88, 0x00, 0xc9, 0x00, 0x00, 0x00, 0x19, 0x00, 0x29, 0x00, 0x67, 0x00,
+  0x89, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x60, 0x00, 0x83, 0x00, 0xc3, 0x00,
+  0xd9, 0x00, 0x03, 0x01, 0x00, 0x00, 0x27, 0x00, 0x50, 0x00, 0x00, 0x00,
+  0x1a, 0x00, 0x43, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x75, 0x00, 0x99, 0x00,
+  0x00, 0x00, 0x16, 0x00, 0x4e, 0x00, 0x72, 0x00, 0x81, 0x00, 0x88, 0x00,
+  0x91, 0x00, 0x9a, 0x00, 0x00, 0x00, 0x25, 0x00, 0x44, 0x00, 0x67, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x31, 0x00, 0x3b, 0x00, 0x41, 0x00, 0x49, 0x00,
+  0x50, 0x00, 0x57, 0x00, 0x5e, 0x00, 0x00, 0x00, 0x21, 0x00, 0x40, 0x00,
+  0x70, 0x00, 0x82, 0x00, 0x00, 0x00, 0x10, 0x00, 0x56, 0x00, 0x5c, 0x00,
+  0x6c, 0x00, 0x73, 0x00, 0x7b, 0x00, 0x82, 0x00, 0x8a, 0x00, 0x93, 0x00,
+  0x9b, 0x00, 0xa3, 0x00, 0xab, 0x00, 0x00, 0x00, 0x29, 0x00, 0x5c, 0x00,
+  0x62, 0x00, 0x68, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x4d, 0x00, 0x5b, 0x00,
+  0x64, 0x00, 0x6a, 0x00, 0x72, 0x00, 0x7b, 0x00, 0x84, 0x00, 0x8d, 0x00,
+  0x95, 0x00, 0x9e, 0x00, 0xa7, 0x00, 0xb0, 0x00, 0xb8, 0x00, 0x00, 0x00,
+  0x31, 0x00, 0x50, 0x00, 0x00, 0x00, 0x21, 0x00, 0x33, 0x00, 0x4e, 0x00,
+  0x56, 0x00, 0x60, 0x00, 0x69, 0x00, 0x6f, 0x00, 0x78, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x4a, 0x00, 0x69, 0x00, 0x71, 0x00, 0x79, 0x00, 0x82, 0x00,
+  0x00, 0x00, 0x20, 0x00, 0x4a, 0x00, 0x67, 0x00, 0x71, 0x00, 0x78, 0x00,
+  0x81, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x4b, 0x00, 0x00, 0x00,
+  0x1a, 0x00, 0x34, 0x00, 0x4e, 0x00, 0x68, 0x00, 0x82, 0x00, 0x9c, 0x00,
+  0xb6, 0x00, 0xd0, 0x00, 0xea, 0x00, 0x11, 0x01, 0x42, 0x01, 0x65, 0x01,
+  0x70, 0x01, 0x00, 0x00, 0x27, 0x00, 0x4c, 0x00, 0x56, 0x00, 0x00, 0x00,
+  0x2d, 0x00, 0x5a, 0x00, 0x66, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x1f, 0x00,
+  0x50, 0x00, 0x7a, 0x00, 0x81, 0x00, 0x00, 0x00, 0x29, 0x00, 0x3f, 0x00,
+  0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x21, 0x00, 0x00, 0x00,
+  0x17, 0x00, 0x31, 0x00, 0x68, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x3e, 0x00,
+  0x47, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x2c, 0x00,
+  0x36, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x00,
+  0x41, 0x00, 0x00, 0x00, 0x12, 0x00, 0x61, 0x00, 0x6b, 0x00, 0x00, 0x00,
+  0x25, 0x00, 0x00, 0x00, 0x16, 0x00, 0x3d, 0x00, 0x88, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x53, 0x00, 0x00, 0x00, 0x10, 0x00, 0x60, 0x00, 0x00, 0x00,
+  0x23, 0x00, 0x4e, 0x00, 0x9f, 0x00, 0xbc, 0x00, 0xc2, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x30, 0x00, 0x74, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x0d, 0x00, 0x15, 0x00, 0x1c, 0x00, 0x24, 0x00, 0x2c, 0x00,
+  0x32, 0x00, 0x00, 0x00, 0x12, 0x00, 0x18, 0x00, 0x00, 0x00, 0x08, 0x00,
+  0x0f, 0x00, 0x15, 0x00, 0x1e, 0x00, 0x25, 0x00, 0x2c, 0x00, 0x33, 0x00,
+  0x3b, 0x00, 0x43, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x24, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x0f, 0x00, 0x17, 0x00, 0x1f, 0x00, 0x25, 0x00, 0x2d, 0x00,
+  0x00, 0x00, 0x1f, 0x00, 0x28, 0x00, 0x2f, 0x00, 0x38, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x1c, 0x00, 0x24, 0x00, 0x2d, 0x00, 0x35, 0x00, 0x3e, 0x00,
+  0x45, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x32, 0x00, 0x3a, 0x00, 0x41, 0x00,
+  0x48, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x3d, 0x00, 0x46, 0x00, 0x4f, 0x00,
+  0x58, 0x00, 0x63, 0x00, 0x6b, 0x00, 0x73, 0x00, 0x7c, 0x00, 0x86, 0x00,
+  0x00, 0x00, 0x19, 0x00, 0x29, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x35, 0x00,
+  0x4f, 0x00, 0x69, 0x00, 0x8c, 0x00, 0x95, 0x00, 0x9d, 0x00, 0xa7, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x14, 0x00, 0x00, 0x00, 0x18, 0x00, 0x21, 0x00,
+  0x2a, 0x00, 0x34, 0x00, 0x3d, 0x00, 0x46, 0x00, 0x00, 0x00, 0x23, 0x00,
+  0x00, 0x00, 0x22, 0x00, 0x28, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x33, 0x00,
+  0x00, 0x00, 0x27, 0x00, 0x32, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x33, 0x00,
+  0x3a, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x33, 0x00, 0x3b, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x20, 0x00, 0x28, 0x00, 0x2e, 0x00, 0x36, 0x00, 0x00, 0x00,
+  0x24, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x22, 0x00, 0x58, 0x00, 0x00, 0x00,
+  0x2a, 0x00, 0x45, 0x00, 0x00, 0x00, 0x26, 0x00, 0x6e, 0x00, 0x00, 0x00,
+  0x28, 0x00, 0x4a, 0x00, 0x60, 0x00, 0x66, 0x00, 0x00, 0x00, 0x35, 0x00,
+  0x6c, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x46, 0x00, 0x00, 0x00, 0x1e, 0x00,
+  0x48, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x24, 0x00, 0x44, 0x00, 0x4a, 0x00,
+  0x00, 0x00, 0x5c, 0x00, 0x7e, 0x00, 0x92, 0x00, 0x99, 0x00, 0xa5, 0x00,
+  0xac, 0x00, 0xb5, 0x00, 0xbb, 0x00, 0xc1, 0x00, 0xc8, 0x00, 0x00, 0x00,
+  0x1b, 0x00, 0x6e, 0x00, 0x8e, 0x00, 0xa0, 0x00, 0xbb, 0x00, 0xdf, 0x00,
+  0xe5, 0x00, 0x00, 0x00, 0x45, 0x00, 0x6e, 0x00, 0x92, 0x00, 0xaa, 0x00,
+  0xba, 0x00, 0xe2, 0x00, 0xe9, 0x00, 0xf4, 0x00, 0xfa, 0x00, 0x01, 0x01,
+  0x08, 0x01, 0x0e, 0x01, 0x16, 0x01, 0x1e, 0x01, 0x26, 0x01, 0x2e, 0x01,
+  0x35, 0x01, 0x00, 0x00, 0x22, 0x00, 0x46, 0x00, 0x66, 0x00, 0x7c, 0x00,
+  0xa8, 0x00, 0xaf, 0x00, 0xb7, 0x00, 0xbd, 0x00, 0xc3, 0x00, 0xc9, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x2c, 0x00, 0x52, 0x00, 0x58, 0x00, 0x5d, 0x00,
+  0x6b, 0x00, 0x71, 0x00, 0x78, 0x00, 0x7f, 0x00, 0x85, 0x00, 0x8e, 0x00,
+  0x00, 0x00, 0x37, 0x00, 0x4b, 0x00, 0x6c, 0x00, 0x91, 0x00, 0xb1, 0x00,
+  0xb7, 0x00, 0xbd, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x32, 0x00, 0x4c, 0x00,
+  0x6c, 0x00, 0x83, 0x00, 0x8c, 0x00, 0x93, 0x00, 0x9c, 0x00, 0xa3, 0x00,
+  0xac, 0x00, 0xb3, 0x00, 0xbc, 0x00, 0xc3, 0x00, 0xcb, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x29, 0x00, 0x63, 0x00, 0x69, 0x00, 0x72, 0x00, 0x79, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x28, 0x00, 0x3e, 0x00, 0x61, 0x00, 0x69, 0x00,
+  0x71, 0x00, 0x7b, 0x00, 0x84, 0x00, 0x8c, 0x00, 0x00, 0x00, 0x12, 0x00,
+  0x1d, 0x00, 0x24, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x2a, 0x00, 0x33, 0x00,
+  0x3c, 0x00, 0x45, 0x00, 0x4c, 0x00, 0x55, 0x00, 0x5e, 0x00, 0x67, 0x00,
+  0x00, 0x00, 0x26, 0x00, 0x3c, 0x00, 0x52, 0x00, 0x58, 0x00, 0x5f, 0x00,
+  0x68, 0x00, 0x00, 0x00, 0x36, 0x00, 0x55, 0x00, 0x6b, 0x00, 0x74, 0x00,
+  0x7d, 0x00, 0x83, 0x00, 0x8d, 0x00, 0x96, 0x00, 0x00, 0x00, 0x21, 0x00,
+  0x2c, 0x00, 0x35, 0x00, 0x00, 0x00, 0x24, 0x00, 0x38, 0x00, 0x41, 0x00,
+  0x4b, 0x00, 0x54, 0x00, 0x5c, 0x00, 0x65, 0x00, 0x6f, 0x00, 0x78, 0x00,
+  0x81, 0x00, 0x00, 0x00, 0x14, 0x00, 0x1a, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x1d, 0x00, 0x27, 0x00, 0x00, 0x00, 0x18, 0x00, 0x2a, 0x00,
+  0x55, 0x00, 0x89, 0x00, 0x8f, 0x00, 0x9a, 0x00, 0xa0, 0x00, 0x00, 0x00,
+  0x22, 0x00, 0x30, 0x00, 0x42, 0x00, 0x58, 0x00, 0x84, 0x00, 0x8b, 0x00,
+  0x93, 0x00, 0x9b, 0x00, 0xa3, 0x00, 0x00, 0x00, 0x23, 0x00, 0x37, 0x00,
+  0x52, 0x00, 0x73, 0x00, 0x79, 0x00, 0x80, 0x00, 0x88, 0x00, 0x8e, 0x00,
+  0x00, 0x00, 0x1b, 0x00, 0x44, 0x00, 0x5a, 0x00, 0x6e, 0x00, 0x9f, 0x00,
+  0xa8, 0x00, 0xb1, 0x00, 0xba, 0x00, 0xc3, 0x00, 0x00, 0x00, 0x24, 0x00,
+  0x36, 0x00, 0x48, 0x00, 0x5c, 0x00, 0x79, 0x00, 0x81, 0x00, 0x87, 0x00,
+  0x8e, 0x00, 0x97, 0x00, 0x9e, 0x00, 0xa6, 0x00, 0x00, 0x00, 0x28, 0x00,
+  0x54, 0x00, 0x71, 0x00, 0x86, 0x00, 0xa1, 0x00, 0xc5, 0x00, 0xce, 0x00,
+  0x00, 0x00, 0x2a, 0x00, 0x48, 0x00, 0x70, 0x00, 0x7e, 0x00, 0x96, 0x00,
+  0xa8, 0x00, 0xc5, 0x00, 0xce, 0x00, 0xd4, 0x00, 0xdb, 0x00, 0xe3, 0x00,
+  0xea, 0x00, 0xf0, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x61, 0x00,
+  0x8e, 0x00, 0xc1, 0x00, 0xe0, 0x00, 0xf6, 0x00, 0x1b, 0x01, 0x48, 0x01,
+  0x52, 0x01, 0x5b, 0x01, 0x00, 0x00, 0x31, 0x00, 0x80, 0x00, 0xaa, 0x00,
+  0xc2, 0x00, 0xe2, 0x00, 0x10, 0x01, 0x18, 0x01, 0x00, 0x00, 0x26, 0x00,
+  0x48, 0x00, 0x6e, 0x00, 0x7e, 0x00, 0xa0, 0x00, 0xca, 0x00, 0xeb, 0x00,
+  0xf4, 0x00, 0xfe, 0x00, 0x07, 0x01, 0x11, 0x01, 0x1b, 0x01, 0x25, 0x01,
+  0x30, 0x01, 0x3a, 0x01, 0x00, 0x00, 0x24, 0x00, 0x55, 0x00, 0x6f, 0x00,
+  0x81, 0x00, 0xb3, 0x00, 0xd9, 0x00, 0x00, 0x00, 0x20, 0x00, 0x75, 0x00,
+  0x97, 0x00, 0xa9, 0x00, 0xd5, 0x00, 0xf7, 0x00, 0x00, 0x01, 0x0b, 0x01,
+  0x17, 0x01, 0x20, 0x01, 0x00, 0x00, 0x33, 0x00, 0x59, 0x00, 0x7b, 0x00,
+  0xa4, 0x00, 0xca, 0x00, 0xe0, 0x00, 0xee, 0x00, 0x10, 0x01, 0x00, 0x00,
+  0x37, 0x00, 0x55, 0x00, 0x90, 0x00, 0xc4, 0x00, 0xd6, 0x00, 0xec, 0x00,
+  0x14, 0x01, 0x1f, 0x01, 0x00, 0x00, 0x20, 0x00, 0x48, 0x00, 0x7d, 0x00,
+  0xab, 0x00, 0xbf, 0x00, 0xde, 0x00, 0xfe, 0x00, 0x05, 0x01, 0x0c, 0x01,
+  0x13, 0x01, 0x00, 0x00, 0x26, 0x00, 0x67, 0x00, 0x8d, 0x00, 0xad, 0x00,
+  0xbd, 0x00, 0xe1, 0x00, 0x11, 0x01, 0x1d, 0x01, 0x00, 0x00, 0x2b, 0x00,
+  0x51, 0x00, 0x73, 0x00, 0x93, 0x00, 0xb5, 0x00, 0xc7, 0x00, 0xce, 0x00,
+  0xd6, 0x00, 0xdd, 0x00, 0x00, 0x00, 0x43, 0x00, 0x65, 0x00, 0x8b, 0x00,
+  0xaf, 0x00, 0xc9, 0x00, 0xdb, 0x00, 0xfe, 0x00, 0x3a, 0x01, 0x41, 0x01,
+  0x4d, 0x01, 0x59, 0x01, 0x65, 0x01, 0x00, 0x00, 0x2a, 0x00, 0x48, 0x00,
+  0x68, 0x00, 0x7c, 0x00, 0x92, 0x00, 0x99, 0x00, 0x00, 0x00, 0x3c, 0x00,
+  0x5c, 0x00, 0x87, 0x00, 0x9d, 0x00, 0xb1, 0x00, 0xd2, 0x00, 0xd8, 0x00,
+  0x00, 0x00, 0x2a, 0x00, 0x4a, 0x00, 0x76, 0x00, 0x98, 0x00, 0xc0, 0x00,
+  0x00, 0x00, 0x24, 0x00, 0x3a, 0x00, 0x67, 0x00, 0x84, 0x00, 0x00, 0x00,
+  0x35, 0x00, 0x49, 0x00, 0x6e, 0x00, 0x8c, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x2e, 0x00, 0x5f, 0x00, 0x71, 0x00, 0x7a, 0x00, 0x81, 0x00,
+  0x8a, 0x00, 0x92, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x28, 0x00, 0x51, 0x00,
+  0x7e, 0x00, 0x85, 0x00, 0x8b, 0x00, 0x00, 0x00, 0x24, 0x00, 0x4c, 0x00,
+  0x70, 0x00, 0x80, 0x00, 0x00, 0x00, 0x22, 0x00, 0x42, 0x00, 0x66, 0x00,
+  0x89, 0x00, 0x99, 0x00, 0x00, 0x00, 0x31, 0x00, 0x57, 0x00, 0x8e, 0x00,
+  0xa0, 0x00, 0xb6, 0x00, 0xeb, 0x00, 0x1e, 0x01, 0x25, 0x01, 0x2c, 0x01,
+  0x00, 0x00, 0x3d, 0x00, 0x63, 0x00, 0x80, 0x00, 0x92, 0x00, 0xbd, 0x00,
+  0xc4, 0x00, 0xcf, 0x00, 0x00, 0x00, 0x20, 0x00, 0x42, 0x00, 0x7c, 0x00,
+  0x90, 0x00, 0xa0, 0x00, 0xc5, 0x00, 0xe8, 0x00, 0xf1, 0x00, 0xf8, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x12, 0x00, 0x22, 0x00, 0x45, 0x00, 0x77, 0x00,
+  0x80, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x18, 0x00, 0x2e, 0x00, 0x4f, 0x00,
+  0x8b, 0x00, 0x92, 0x00, 0x98, 0x00, 0x00, 0x00, 0x25, 0x00, 0x46, 0x00,
+  0x00, 0x00, 0x16, 0x00, 0x35, 0x00, 0x00, 0x00, 0x12, 0x00, 0x31, 0x00,
+  0x39, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x20, 0x00, 0x40, 0x00,
+  0x52, 0x00, 0x60, 0x00, 0x68, 0x00, 0x00, 0x00, 0x28, 0x00, 0x4c, 0x00,
+  0x64, 0x00, 0x00, 0x00, 0x24, 0x00, 0x42, 0x00, 0x52, 0x00, 0x00, 0x00,
+  0x26, 0x00, 0x38, 0x00, 0x4a, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00,
+  0x22, 0x00, 0x44, 0x00, 0x58, 0x00, 0x70, 0x00, 0x76, 0x00, 0x00, 0x00,
+  0x28, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x53, 0x00, 0x00, 0x00,
+  0x24, 0x00, 0x4a, 0x00, 0x6d, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x51, 0x00,
+  0x00, 0x00, 0x22, 0x00, 0x34, 0x00, 0x00, 0x00, 0x26, 0x00, 0x5d, 0x00,
+  0x81, 0x00, 0xa7, 0x00, 0xb9, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00,
+  0x22, 0x00, 0x4c, 0x00, 0x83, 0x00, 0x93, 0x00, 0x00, 0x00, 0x2f, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x40, 0x00, 0x47, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x51, 0x00,
+  0x77, 0x00, 0x00, 0x00, 0x29, 0x00, 0x54, 0x00, 0x00, 0x00, 0x1e, 0x00,
+  0x3c, 0x00, 0x00, 0x00, 0x28, 0x00, 0x48, 0x00, 0x00, 0x00, 0x5f, 0x00,
+  0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x0f, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x0d, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x4e, 0x00, 0x9a, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x96, 0x00,
+  0xe0, 0x00, 0x28, 0x01, 0x6c, 0x01, 0xb2, 0x01, 0xbb, 0x01, 0x00, 0x00,
+  0x09, 0x00, 0x00, 0x00
+};
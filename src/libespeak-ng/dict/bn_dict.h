@@ -1,5 +1,7 @@
 #pragma once
-const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
+#include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/bn_dict_index.h>
+const unsigned char __espeakng_dict_bn[] __attribute__((aligned((4)))) = {
   0x00, 0x04, 0x00, 0x00, 0xd7, 0x59, 0x01, 0x00, 0x00, 0x73, 0x19, 0xf0,
   0x9f, 0x91, 0xa9, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xe2, 0x80,
   0x8d, 0xf0, 0x9f, 0x91, 0xa7, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa7,
@@ -7500,4 +7502,11 @@ const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
   0x25, 0x39, 0x06, 0x27, 0x52, 0x00, 0x2d, 0x08, 0x20, 0x02, 0x20, 0x0f,
   0x00, 0x07, 0x00
 };
-size_t __espeakng_dictlen = 89979;
+
+BackgroundAudioDictionary dict_bn = {
+    "bn",
+    89979,
+    __espeakng_dict_bn,
+    8126,
+    __espeakng_dictindex_bn
+};
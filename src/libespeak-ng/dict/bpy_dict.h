@@ -1,5 +1,7 @@
 #pragma once
-const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
+#include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/bpy_dict_index.h>
+const unsigned char __espeakng_dict_bpy[] __attribute__((aligned((4)))) = {
   0x00, 0x04, 0x00, 0x00, 0x10, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x08, 0x04, 0x5f, 0x64, 0x70, 0x74, 0x0a, 0x00,
@@ -437,4 +439,11 @@ const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
   0x43, 0x00, 0x08, 0x02, 0x11, 0x42, 0x00, 0x08, 0x02, 0x11, 0x43, 0x00,
   0x03, 0x3a, 0x23, 0x00, 0x07, 0x00
 };
-size_t __espeakng_dictlen = 5226;
+
+BackgroundAudioDictionary dict_bpy = {
+    "bpy",
+    5226,
+    __espeakng_dict_bpy,
+    2606,
+    __espeakng_dictindex_bpy
+};
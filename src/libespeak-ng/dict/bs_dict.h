@@ -1,5 +1,7 @@
 #pragma once
-const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
+#include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/bs_dict_index.h>
+const unsigned char __espeakng_dict_bs[] __attribute__((aligned((4)))) = {
   0x00, 0x04, 0x00, 0x00, 0x9b, 0xb3, 0x00, 0x00, 0x00, 0x4e, 0x19, 0xf0,
   0x9f, 0x91, 0xa9, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xe2, 0x80,
   0x8d, 0xf0, 0x9f, 0x91, 0xa7, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa7,
@@ -3924,4 +3926,11 @@ const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
   0xa1, 0x03, 0x7c, 0x00, 0xc3, 0xb3, 0x03, 0x7d, 0x00, 0xc3, 0xba, 0x03,
   0x7e, 0x00, 0x07, 0x00
 };
-size_t __espeakng_dictlen = 47068;
+
+BackgroundAudioDictionary dict_bs = {
+    "bs",
+    47068,
+    __espeakng_dict_bs,
+    8812,
+    __espeakng_dictindex_bs
+};
@@ -1,5 +1,7 @@
 #pragma once
-const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
+#include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/ca_dict_index.h>
+const unsigned char __espeakng_dict_ca[] __attribute__((aligned((4)))) = {
   0x00, 0x04, 0x00, 0x00, 0x20, 0x9c, 0x04, 0x00, 0x16, 0x48, 0x14, 0xd4,
   0x12, 0x14, 0xe6, 0x41, 0x58, 0x10, 0x0d, 0x42, 0x30, 0x46, 0x7f, 0x44,
   0x06, 0x23, 0x55, 0x0d, 0x00, 0x68, 0x16, 0x48, 0x58, 0x13, 0x0c, 0x0c,
@@ -25862,4 +25864,11 @@ const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
   0x00, 0xc3, 0xbc, 0x01, 0x67, 0x03, 0x3a, 0x00, 0xc3, 0xb1, 0x03, 0x44,
   0x00, 0x24, 0x03, 0x49, 0x27, 0x37, 0x23, 0x33, 0x00, 0x07, 0x00
 };
-size_t __espeakng_dictlen = 310331;
+
+BackgroundAudioDictionary dict_ca = {
+    "ca",
+    310331,
+    __espeakng_dict_ca,
+    62350,
+    __espeakng_dictindex_ca
+};
@@ -0,0 +1,5199 @@
+#pragma once
+const unsigned char __espeakng_dictindex_ca[] __attribute__((aligned((4)))) = {
+  0x45, 0x44, 0x58, 0x31, 0x3b, 0xbc, 0x04, 0x00, 0x20, 0x9c, 0x04, 0x00,
+  0x7e, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x0f, 0x00, 0x23, 0x00,
+  0x2a, 0x00, 0x32, 0x00, 0x43, 0x00, 0x6c, 0x00, 0x89, 0x00, 0x90, 0x00,
+  0xa0, 0x00, 0xac, 0x00, 0xd5, 0x00, 0xd9, 0x00, 0xf2, 0x00, 0x1f, 0x01,
+  0x4d, 0x01, 0x5d, 0x01, 0x66, 0x01, 0x72, 0x01, 0x7c, 0x01, 0x8b, 0x01,
+  0x92, 0x01, 0x97, 0x01, 0xa2, 0x01, 0xa9, 0x01, 0xaf, 0x01, 0xce, 0x01,
+  0xd5, 0x01, 0xe5, 0x01, 0xe9, 0x01, 0xf1, 0x01, 0x01, 0x02, 0x32, 0x02,
+  0x46, 0x02, 0x4d, 0x02, 0x61, 0x02, 0x6a, 0x02, 0x6f, 0x02, 0xab, 0x02,
+  0xbb, 0x02, 0xc3, 0x02, 0xca, 0x02, 0xdf, 0x02, 0xfe, 0x02, 0x0f, 0x03,
+  0x16, 0x03, 0x24, 0x03, 0x2b, 0x03, 0x3b, 0x03, 0x4a, 0x03, 0x5d, 0x03,
+  0x76, 0x03, 0x7a, 0x03, 0x80, 0x03, 0x8a, 0x03, 0x8c, 0x03, 0x90, 0x03,
+  0x9f, 0x03, 0xa1, 0x03, 0xa6, 0x03, 0xac, 0x03, 0xbd, 0x03, 0xd0, 0x03,
+  0xd9, 0x03, 0xe5, 0x03, 0x1d, 0x04, 0x25, 0x04, 0x2c, 0x04, 0x46, 0x04,
+  0x4b, 0x04, 0x52, 0x04, 0x61, 0x04, 0x64, 0x04, 0x6b, 0x04, 0x7f, 0x04,
+  0x89, 0x04, 0xa0, 0x04, 0xa5, 0x04, 0xb5, 0x04, 0xbb, 0x04, 0xc5, 0x04,
+  0xe2, 0x04, 0xe8, 0x04, 0xee, 0x04, 0xfa, 0x04, 0x01, 0x05, 0x06, 0x05,
+  0x0e, 0x05, 0x13, 0x05, 0x28, 0x05, 0x36, 0x05, 0x42, 0x05, 0x59, 0x05,
+  0x78, 0x05, 0x7c, 0x05, 0x81, 0x05, 0x89, 0x05, 0x9a, 0x05, 0xa3, 0x05,
+  0xaa, 0x05, 0xad, 0x05, 0xb2, 0x05, 0xc1, 0x05, 0xcc, 0x05, 0xe9, 0x05,
+  0xfd, 0x05, 0x16, 0x06, 0x2c, 0x06, 0xe0, 0x06, 0xe8, 0x06, 0xf6, 0x06,
+  0x00, 0x07, 0x03, 0x07, 0x08, 0x07, 0x0f, 0x07, 0x17, 0x07, 0x2c, 0x07,
+  0x38, 0x07, 0x41, 0x07, 0x51, 0x07, 0x61, 0x07, 0x95, 0x07, 0xab, 0x07,
+  0xb9, 0x07, 0xc4, 0x07, 0xe4, 0x07, 0xf1, 0x07, 0xfe, 0x07, 0x0e, 0x08,
+  0x15, 0x08, 0x23, 0x08, 0x4d, 0x08, 0x75, 0x08, 0x7b, 0x08, 0x8c, 0x08,
+  0xb7, 0x08, 0xd4, 0x08, 0xe6, 0x08, 0xfe, 0x08, 0x10, 0x09, 0x28, 0x09,
+  0x67, 0x09, 0x91, 0x09, 0x9b, 0x09, 0xb5, 0x09, 0xbc, 0x09, 0xc5, 0x09,
+  0xd2, 0x09, 0xdb, 0x09, 0xe0, 0x09, 0xef, 0x09, 0x07, 0x0a, 0x1d, 0x0a,
+  0x50, 0x0a, 0x86, 0x0a, 0x93, 0x0a, 0xa9, 0x0a, 0xb7, 0x0a, 0xc6, 0x0a,
+  0xd1, 0x0a, 0xe8, 0x0a, 0xef, 0x0a, 0xfb, 0x0a, 0x0e, 0x0b, 0x2f, 0x0b,
+  0x45, 0x0b, 0x52, 0x0b, 0x69, 0x0b, 0x93, 0x0b, 0xef, 0x0b, 0xf8, 0x0b,
+  0x04, 0x0c, 0x0c, 0x0c, 0x1e, 0x0c, 0x2c, 0x0c, 0x31, 0x0c, 0x3c, 0x0c,
+  0x44, 0x0c, 0x51, 0x0c, 0x5f, 0x0c, 0x67, 0x0c, 0x81, 0x0c, 0x8d, 0x0c,
+  0xa1, 0x0c, 0xc2, 0x0c, 0xdc, 0x0c, 0xfa, 0x0c, 0x06, 0x0d, 0x2b, 0x0d,
+  0x4d, 0x0d, 0x52, 0x0d, 0xc7, 0x0d, 0xcd, 0x0d, 0xce, 0x0d, 0xd4, 0x0d,
+  0x3c, 0x0e, 0x4d, 0x0e, 0x76, 0x0e, 0x9e, 0x0e, 0xce, 0x0e, 0xf2, 0x0e,
+  0x57, 0x0f, 0xa6, 0x0f, 0xb4, 0x0f, 0xbb, 0x0f, 0xc4, 0x0f, 0xcb, 0x0f,
+  0xdb, 0x0f, 0xe4, 0x0f, 0xed, 0x0f, 0xf2, 0x0f, 0x00, 0x10, 0x06, 0x10,
+  0x2a, 0x10, 0x32, 0x10, 0x3c, 0x10, 0x5e, 0x10, 0x60, 0x10, 0x74, 0x10,
+  0x8a, 0x10, 0x9e, 0x10, 0xa4, 0x10, 0xaa, 0x10, 0xb5, 0x10, 0xb9, 0x10,
+  0xbc, 0x10, 0xc7, 0x10, 0xce, 0x10, 0xd8, 0x10, 0xe5, 0x10, 0xf0, 0x10,
+  0x06, 0x11, 0x0d, 0x11, 0x17, 0x11, 0x2d, 0x11, 0x5a, 0x11, 0xca, 0x11,
+  0xd5, 0x11, 0xed, 0x11, 0xfa, 0x11, 0x06, 0x12, 0x0b, 0x12, 0x0f, 0x12,
+  0x22, 0x12, 0x2c, 0x12, 0x33, 0x12, 0x3a, 0x12, 0x51, 0x12, 0x7e, 0x12,
+  0x8d, 0x12, 0xa9, 0x12, 0xbb, 0x12, 0xcf, 0x12, 0xd5, 0x12, 0xde, 0x12,
+  0xe8, 0x12, 0xee, 0x12, 0xef, 0x12, 0xf7, 0x12, 0x05, 0x13, 0x17, 0x13,
+  0x3d, 0x13, 0x78, 0x13, 0x80, 0x13, 0x9c, 0x13, 0xad, 0x13, 0xcf, 0x13,
+  0xd8, 0x13, 0xe0, 0x13, 0xed, 0x13, 0x3d, 0x14, 0x48, 0x14, 0x51, 0x14,
+  0x63, 0x14, 0x79, 0x14, 0x82, 0x14, 0x8a, 0x14, 0x97, 0x14, 0xb5, 0x14,
+  0xd6, 0x14, 0xf4, 0x14, 0x2a, 0x15, 0x3f, 0x15, 0x54, 0x15, 0x65, 0x15,
+  0x6a, 0x15, 0x73, 0x15, 0x8b, 0x15, 0x95, 0x15, 0x72, 0x16, 0x8b, 0x16,
+  0xa2, 0x16, 0xb0, 0x16, 0xb5, 0x16, 0xbc, 0x16, 0xc2, 0x16, 0xcd, 0x16,
+  0xd2, 0x16, 0xe4, 0x16, 0xeb, 0x16, 0xfb, 0x16, 0x04, 0x17, 0x0c, 0x17,
+  0x15, 0x17, 0x21, 0x17, 0x2d, 0x17, 0x36, 0x17, 0x40, 0x17, 0x4a, 0x17,
+  0x63, 0x17, 0x76, 0x17, 0x84, 0x17, 0x9c, 0x17, 0xb4, 0x17, 0xce, 0x17,
+  0xd7, 0x17, 0xeb, 0x17, 0xef, 0x17, 0xf9, 0x17, 0xff, 0x17, 0x03, 0x18,
+  0x0e, 0x18, 0x29, 0x18, 0x38, 0x18, 0x49, 0x18, 0x4f, 0x18, 0x55, 0x18,
+  0x5d, 0x18, 0x78, 0x18, 0x7f, 0x18, 0x8b, 0x18, 0x90, 0x18, 0xa7, 0x18,
+  0xaf, 0x18, 0xbc, 0x18, 0xc3, 0x18, 0xce, 0x18, 0xdb, 0x18, 0xe3, 0x18,
+  0xec, 0x18, 0xf4, 0x18, 0xfb, 0x18, 0x14, 0x19, 0x24, 0x19, 0x63, 0x19,
+  0x6f, 0x19, 0x7b, 0x19, 0x83, 0x19, 0xa4, 0x19, 0xb3, 0x19, 0xc0, 0x19,
+  0xd0, 0x19, 0xd4, 0x19, 0xdf, 0x19, 0xe5, 0x19, 0xf2, 0x19, 0x0d, 0x1a,
+  0x13, 0x1a, 0x22, 0x1a, 0x2f, 0x1a, 0x3c, 0x1a, 0x53, 0x1a, 0x5a, 0x1a,
+  0x70, 0x1a, 0x81, 0x1a, 0x88, 0x1a, 0x9e, 0x1a, 0xa2, 0x1a, 0xae, 0x1a,
+  0xb8, 0x1a, 0xc0, 0x1a, 0xd6, 0x1a, 0xdc, 0x1a, 0xe2, 0x1a, 0xf3, 0x1a,
+  0x03, 0x1b, 0x1e, 0x1b, 0x2c, 0x1b, 0x3f, 0x1b, 0x4c, 0x1b, 0x61, 0x1b,
+  0x6b, 0x1b, 0x6e, 0x1b, 0x7d, 0x1b, 0x81, 0x1b, 0x8c, 0x1b, 0x94, 0x1b,
+  0xa3, 0x1b, 0xbc, 0x1b, 0xd4, 0x1b, 0xee, 0x1b, 0xfc, 0x1b, 0x06, 0x1c,
+  0x1c, 0x1c, 0x21, 0x1c, 0x47, 0x1c, 0x56, 0x1c, 0x62, 0x1c, 0x68, 0x1c,
+  0x6d, 0x1c, 0x84, 0x1c, 0x92, 0x1c, 0x93, 0x1c, 0x9e, 0x1c, 0xa5, 0x1c,
+  0xbd, 0x1c, 0xc2, 0x1c, 0xcf, 0x1c, 0xe7, 0x1c, 0x19, 0x1d, 0x3f, 0x1d,
+  0x4c, 0x1d, 0x5b, 0x1d, 0x6c, 0x1d, 0x8a, 0x1d, 0x92, 0x1d, 0x9c, 0x1d,
+  0xac, 0x1d, 0xba, 0x1d, 0xc9, 0x1d, 0xf0, 0x1d, 0x06, 0x1e, 0x0f, 0x1e,
+  0x22, 0x1e, 0x4a, 0x1e, 0x5e, 0x1e, 0x76, 0x1e, 0xa3, 0x1e, 0xd9, 0x1e,
+  0xe2, 0x1e, 0xf0, 0x1e, 0xfc, 0x1e, 0x0b, 0x1f, 0x17, 0x1f, 0x2a, 0x1f,
+  0x30, 0x1f, 0x3a, 0x1f, 0x44, 0x1f, 0x4c, 0x1f, 0x58, 0x1f, 0x62, 0x1f,
+  0x8a, 0x1f, 0xa5, 0x1f, 0xad, 0x1f, 0xc4, 0x1f, 0xdd, 0x1f, 0x45, 0x20,
+  0x95, 0x20, 0x9b, 0x20, 0xa2, 0x20, 0xf1, 0x20, 0x55, 0x21, 0x77, 0x21,
+  0x91, 0x21, 0xc2, 0x21, 0xd3, 0x21, 0xf6, 0x21, 0x11, 0x22, 0x1d, 0x22,
+  0x9f, 0x22, 0xc9, 0x22, 0xcf, 0x22, 0xdc, 0x22, 0xe5, 0x22, 0xed, 0x22,
+  0xf4, 0x22, 0xff, 0x22, 0x04, 0x23, 0x0a, 0x23, 0x12, 0x23, 0x1f, 0x23,
+  0x4c, 0x23, 0x55, 0x23, 0x72, 0x23, 0x7e, 0x23, 0x8b, 0x23, 0x9d, 0x23,
+  0xae, 0x23, 0xb2, 0x23, 0xbd, 0x23, 0xd2, 0x23, 0xd6, 0x23, 0xde, 0x23,
+  0xe8, 0x23, 0x0a, 0x24, 0x13, 0x24, 0x3c, 0x24, 0x53, 0x24, 0x72, 0x24,
+  0x85, 0x24, 0xa9, 0x24, 0xb3, 0x24, 0xc3, 0x24, 0x16, 0x25, 0x31, 0x25,
+  0x3e, 0x25, 0x5f, 0x25, 0x65, 0x25, 0x77, 0x25, 0x7e, 0x25, 0x85, 0x25,
+  0x8e, 0x25, 0x9b, 0x25, 0xa8, 0x25, 0xb3, 0x25, 0xc6, 0x25, 0xd8, 0x25,
+  0xe8, 0x25, 0x06, 0x26, 0x10, 0x26, 0x29, 0x26, 0x32, 0x26, 0x36, 0x26,
+  0x3f, 0x26, 0x45, 0x26, 0x55, 0x26, 0x6c, 0x26, 0x7f, 0x26, 0x84, 0x26,
+  0x94, 0x26, 0xad, 0x26, 0xda, 0x26, 0xea, 0x26, 0xf8, 0x26, 0x0b, 0x27,
+  0x3e, 0x27, 0x4b, 0x27, 0x7e, 0x27, 0x94, 0x27, 0xa7, 0x27, 0xad, 0x27,
+  0xb4, 0x27, 0xbb, 0x27, 0xdf, 0x27, 0xf8, 0x27, 0x00, 0x28, 0x02, 0x28,
+  0x0c, 0x28, 0x23, 0x28, 0x2d, 0x28, 0x44, 0x28, 0x56, 0x28, 0x5e, 0x28,
+  0x68, 0x28, 0x9d, 0x28, 0xb8, 0x28, 0xca, 0x28, 0xd0, 0x28, 0xd6, 0x28,
+  0xef, 0x28, 0x05, 0x29, 0x0b, 0x29, 0x14, 0x29, 0x21, 0x29, 0x27, 0x29,
+  0x56, 0x29, 0x71, 0x29, 0x82, 0x29, 0x89, 0x29, 0x8f, 0x29, 0x98, 0x29,
+  0x9e, 0x29, 0xa3, 0x29, 0xae, 0x29, 0xc1, 0x29, 0xce, 0x29, 0xe2, 0x29,
+  0xf3, 0x29, 0x04, 0x2a, 0x0d, 0x2a, 0x1b, 0x2a, 0x4a, 0x2a, 0x92, 0x2a,
+  0x99, 0x2a, 0xa1, 0x2a, 0xab, 0x2a, 0xaf, 0x2a, 0xdc, 0x2a, 0xdd, 0x2a,
+  0xfc, 0x2a, 0x04, 0x2b, 0x0a, 0x2b, 0x0f, 0x2b, 0x15, 0x2b, 0x22, 0x2b,
+  0x2c, 0x2b, 0x32, 0x2b, 0x6a, 0x2b, 0xd3, 0x2b, 0xdb, 0x2b, 0xe1, 0x2b,
+  0xe7, 0x2b, 0xee, 0x2b, 0xfa, 0x2b, 0x00, 0x2c, 0x1b, 0x2c, 0x1f, 0x2c,
+  0x39, 0x2c, 0x41, 0x2c, 0x71, 0x2c, 0x77, 0x2c, 0x7d, 0x2c, 0x85, 0x2c,
+  0xb3, 0x2c, 0xba, 0x2c, 0xc2, 0x2c, 0xc7, 0x2c, 0xd2, 0x2c, 0xe7, 0x2c,
+  0x1b, 0x2d, 0x23, 0x2d, 0x3b, 0x2d, 0x49, 0x2d, 0x51, 0x2d, 0x64, 0x2d,
+  0x68, 0x2d, 0x77, 0x2d, 0x7f, 0x2d, 0x96, 0x2d, 0x9f, 0x2d, 0xbb, 0x2d,
+  0xc0, 0x2d, 0xcd, 0x2d, 0xd7, 0x2d, 0xe0, 0x2d, 0xe8, 0x2d, 0xfc, 0x2d,
+  0x02, 0x2e, 0x0c, 0x2e, 0x14, 0x2e, 0x1d, 0x2e, 0x32, 0x2e, 0x46, 0x2e,
+  0x4d, 0x2e, 0x55, 0x2e, 0x6c, 0x2e, 0x7d, 0x2e, 0x87, 0x2e, 0x94, 0x2e,
+  0xda, 0x2e, 0xe0, 0x2e, 0xf3, 0x2e, 0xf6, 0x2e, 0x1d, 0x2f, 0x2b, 0x2f,
+  0x3b, 0x2f, 0x49, 0x2f, 0x4f, 0x2f, 0x6d, 0x2f, 0x7f, 0x2f, 0x98, 0x2f,
+  0xa1, 0x2f, 0xae, 0x2f, 0xb5, 0x2f, 0xc4, 0x2f, 0xce, 0x2f, 0xd5, 0x2f,
+  0xd6, 0x2f, 0xda, 0x2f, 0xdf, 0x2f, 0xe8, 0x2f, 0xf7, 0x2f, 0x02, 0x30,
+  0x0e, 0x30, 0x5c, 0x30, 0x65, 0x30, 0x6d, 0x30, 0x7e, 0x30, 0x99, 0x30,
+  0xac, 0x30, 0xed, 0x30, 0xf4, 0x30, 0x02, 0x31, 0x1f, 0x31, 0x72, 0x31,
+  0xc3, 0x31, 0xf5, 0x31, 0xfd, 0x31, 0x17, 0x32, 0x22, 0x32, 0x34, 0x32,
+  0x3d, 0x32, 0x4d, 0x32, 0x58, 0x32, 0x68, 0x32, 0x70, 0x32, 0x86, 0x32,
+  0x9f, 0x32, 0xa7, 0x32, 0xad, 0x32, 0xb3, 0x32, 0xc0, 0x32, 0xd7, 0x32,
+  0xe9, 0x32, 0xfe, 0x32, 0x13, 0x33, 0x4b, 0x33, 0x60, 0x33, 0x7c, 0x33,
+  0x8d, 0x33, 0xb1, 0x33, 0xbd, 0x33, 0xca, 0x33, 0x14, 0x34, 0x1d, 0x34,
+  0x2a, 0x34, 0x3d, 0x34, 0x9f, 0x34, 0xbc, 0x34, 0xcf, 0x34, 0xe2, 0x34,
+  0xf6, 0x34, 0x0d, 0x35, 0x2d, 0x35, 0x4a, 0x35, 0x55, 0x35, 0x77, 0x35,
+  0x84, 0x35, 0x94, 0x35, 0xa5, 0x35, 0xad, 0x35, 0xbf, 0x35, 0xc8, 0x35,
+  0xd6, 0x35, 0xea, 0x35, 0xfb, 0x35, 0x2a, 0x36, 0x41, 0x36, 0x82, 0x36,
+  0xb0, 0x36, 0xff, 0x36, 0x1e, 0x37, 0x3d, 0x37, 0x4f, 0x37, 0x59, 0x37,
+  0x63, 0x37, 0x6d, 0x37, 0x79, 0x37, 0x85, 0x37, 0x93, 0x37, 0xad, 0x37,
+  0xb8, 0x37, 0xcf, 0x37, 0xf6, 0x37, 0x2f, 0x38, 0x54, 0x38, 0x77, 0x38,
+  0x90, 0x38, 0xb3, 0x38, 0xd7, 0x38, 0xeb, 0x38, 0xfd, 0x38, 0x08, 0x39,
+  0x16, 0x39, 0x36, 0x39, 0x49, 0x39, 0x5b, 0x39, 0x76, 0x39, 0x9d, 0x39,
+  0xac, 0x39, 0xc9, 0x39, 0xe2, 0x39, 0x0c, 0x3a, 0x71, 0x3a, 0x8b, 0x3a,
+  0xa0, 0x3a, 0xc7, 0x3a, 0xd1, 0x3a, 0xe5, 0x3a, 0xf3, 0x3a, 0xfc, 0x3a,
+  0x06, 0x3b, 0x17, 0x3b, 0x22, 0x3b, 0x31, 0x3b, 0x59, 0x3b, 0x72, 0x3b,
+  0x8d, 0x3b, 0xa7, 0x3b, 0xbf, 0x3b, 0xeb, 0x3b, 0x02, 0x3c, 0x0e, 0x3c,
+  0x16, 0x3c, 0x2c, 0x3c, 0x3c, 0x3c, 0x47, 0x3c, 0x4f, 0x3c, 0x5d, 0x3c,
+  0x70, 0x3c, 0x7c, 0x3c, 0x87, 0x3c, 0x91, 0x3c, 0xca, 0x3c, 0x05, 0x3d,
+  0x0f, 0x3d, 0x23, 0x3d, 0x31, 0x3d, 0x48, 0x3d, 0x5d, 0x3d, 0x67, 0x3d,
+  0x75, 0x3d, 0x87, 0x3d, 0x93, 0x3d, 0x9e, 0x3d, 0xb0, 0x3d, 0xbe, 0x3d,
+  0xcd, 0x3d, 0xd9, 0x3d, 0xe7, 0x3d, 0xfd, 0x3d, 0x17, 0x3e, 0x2f, 0x3e,
+  0x42, 0x3e, 0x57, 0x3e, 0x67, 0x3e, 0x73, 0x3e, 0x77, 0x3e, 0x97, 0x3e,
+  0x9e, 0x3e, 0xac, 0x3e, 0xbf, 0x3e, 0xdd, 0x3e, 0xf1, 0x3e, 0xfb, 0x3e,
+  0x0b, 0x3f, 0x30, 0x3f, 0x37, 0x3f, 0x3f, 0x3f, 0x4f, 0x3f, 0x54, 0x3f,
+  0x63, 0x3f, 0x8a, 0x3f, 0x91, 0x3f, 0x9f, 0x3f, 0xa4, 0x3f, 0xaa, 0x3f,
+  0xaf, 0x3f, 0xbb, 0x3f, 0xc9, 0x3f, 0xda, 0x3f, 0xe6, 0x3f, 0xf3, 0x3f,
+  0x05, 0x40, 0x11, 0x40, 0x1d, 0x40, 0x27, 0x40, 0x32, 0x40, 0x41, 0x40,
+  0x48, 0x40, 0x5f, 0x40, 0x6c, 0x40, 0x6e, 0x40, 0x79, 0x40, 0xbd, 0x40,
+  0xc6, 0x40, 0xcf, 0x40, 0xd6, 0x40, 0x24, 0x41, 0x29, 0x41, 0x30, 0x41,
+  0x41, 0x41, 0x4d, 0x41, 0x57, 0x41, 0x92, 0x41, 0x97, 0x41, 0xaa, 0x41,
+  0xad, 0x41, 0xb3, 0x41, 0xb9, 0x41, 0xc0, 0x41, 0xd2, 0x41, 0xd5, 0x41,
+  0xf3, 0x41, 0x0f, 0x42, 0x30, 0x42, 0x36, 0x42, 0x4f, 0x42, 0x5f, 0x42,
+  0x6d, 0x42, 0x7a, 0x42, 0x8f, 0x42, 0x94, 0x42, 0xaf, 0x42, 0xb8, 0x42,
+  0xe7, 0x42, 0x0b, 0x43, 0x22, 0x43, 0x2c, 0x43, 0x3c, 0x43, 0x57, 0x43,
+  0x6a, 0x43, 0x83, 0x43, 0x8c, 0x43, 0x99, 0x43, 0xca, 0x43, 0xe3, 0x43,
+  0xfd, 0x43, 0x02, 0x44, 0x37, 0x44, 0x3f, 0x44, 0x78, 0x44, 0x83, 0x44,
+  0x99, 0x44, 0xaa, 0x44, 0xda, 0x44, 0xeb, 0x44, 0x04, 0x45, 0x11, 0x45,
+  0x35, 0x45, 0x55, 0x45, 0x64, 0x45, 0x72, 0x45, 0x82, 0x45, 0x94, 0x45,
+  0xb1, 0x45, 0xfe, 0x45, 0x25, 0x46, 0x36, 0x46, 0x94, 0x46, 0xa0, 0x46,
+  0xaa, 0x46, 0xbb, 0x46, 0xd4, 0x46, 0xe5, 0x46, 0xf0, 0x46, 0x04, 0x47,
+  0x1f, 0x47, 0x2f, 0x47, 0x58, 0x47, 0x73, 0x47, 0x82, 0x47, 0x9b, 0x47,
+  0xbb, 0x47, 0xce, 0x47, 0xd8, 0x47, 0xe5, 0x47, 0xff, 0x47, 0x1d, 0x48,
+  0x37, 0x48, 0x4e, 0x48, 0x5f, 0x48, 0x87, 0x48, 0x8c, 0x48, 0xcd, 0x48,
+  0xd5, 0x48, 0xde, 0x48, 0xeb, 0x48, 0xf5, 0x48, 0x09, 0x49, 0x11, 0x49,
+  0x3a, 0x49, 0x49, 0x49, 0x6f, 0x49, 0x84, 0x49, 0x97, 0x49, 0x9f, 0x49,
+  0xc3, 0x49, 0xd3, 0x49, 0xf5, 0x49, 0x3e, 0x4a, 0x68, 0x4a, 0x6c, 0x4a,
+  0xbd, 0x4a, 0xbf, 0x4a, 0xe7, 0x4a, 0xf6, 0x4a, 0x04, 0x4b, 0x08, 0x4b,
+  0x13, 0x4b, 0x34, 0x4b, 0x40, 0x4b, 0x4d, 0x4b, 0x5b, 0x4b, 0x7a, 0x4b,
+  0x7c, 0x4b, 0x84, 0x4b, 0x95, 0x4b, 0xa8, 0x4b, 0xaf, 0x4b, 0xb2, 0x4b,
+  0xbe, 0x4b, 0xc7, 0x4b, 0xd5, 0x4b, 0x00, 0x4c, 0x27, 0x4c, 0x3c, 0x4c,
+  0x46, 0x4c, 0x4c, 0x4c, 0x65, 0x4c, 0x72, 0x4c, 0x79, 0x4c, 0x82, 0x4c,
+  0x89, 0x4c, 0x90, 0x4c, 0xa1, 0x4c, 0xa5, 0x4c, 0xd1, 0x4c, 0xdc, 0x4c,
+  0xfb, 0x4c, 0x14, 0x4d, 0x45, 0x4d, 0x53, 0x4d, 0x67, 0x4d, 0x7d, 0x4d,
+  0x8a, 0x4d, 0x93, 0x4d, 0x98, 0x4d, 0xa1, 0x4d, 0xa5, 0x4d, 0xaf, 0x4d,
+  0xb4, 0x4d, 0xb6, 0x4d, 0xc1, 0x4d, 0xc4, 0x4d, 0xd9, 0x4d, 0xe3, 0x4d,
+  0x02, 0x4e, 0x39, 0x4e, 0x4f, 0x4e, 0x52, 0x4e, 0x76, 0x4e, 0x76, 0x4e,
+  0x7e, 0x4e, 0x00, 0x00, 0xd9, 0x96, 0x1f, 0x1f, 0x78, 0x78, 0x49, 0x8c,
+  0x02, 0x63, 0x5c, 0x8c, 0x8c, 0x22, 0xbd, 0x31, 0x3e, 0xc6, 0x70, 0x35,
+  0x0b, 0x4d, 0x5b, 0x25, 0x25, 0x93, 0x93, 0x16, 0x8d, 0x8d, 0x31, 0x31,
+  0xa7, 0xfe, 0x3f, 0xaa, 0xba, 0x49, 0x3b, 0x6f, 0xb2, 0x2c, 0x86, 0xf1,
+  0x84, 0x1b, 0x3e, 0x86, 0x78, 0x02, 0xc0, 0x0c, 0xe8, 0xb0, 0xb7, 0x6d,
+  0x6d, 0x82, 0x82, 0x1a, 0x24, 0x2d, 0xb3, 0x91, 0x5f, 0x17, 0x17, 0x75,
+  0x8b, 0xe0, 0x8d, 0x60, 0x6a, 0xab, 0xbc, 0x23, 0xfe, 0xf7, 0x09, 0x84,
+  0xee, 0xce, 0x5f, 0xba, 0x21, 0x40, 0x6d, 0xc7, 0x14, 0x25, 0xda, 0xe5,
+  0x5b, 0x4e, 0xe6, 0x36, 0x2a, 0xfb, 0x76, 0xf8, 0x71, 0xe7, 0x96, 0x4d,
+  0x45, 0xfe, 0xeb, 0x32, 0x5d, 0x2c, 0xe7, 0x31, 0x31, 0x31, 0x31, 0x31,
+  0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x73, 0x01,
+  0xf5, 0x33, 0x6b, 0x48, 0x30, 0xd3, 0x07, 0x32, 0xae, 0x20, 0x50, 0x50,
+  0x22, 0x54, 0xb3, 0x5e, 0x93, 0xef, 0xfc, 0x05, 0x18, 0xde, 0x92, 0xc2,
+  0x9f, 0x06, 0x36, 0xa8, 0x26, 0x15, 0x4d, 0x20, 0x1d, 0xe5, 0x48, 0x48,
+  0x7a, 0xfe, 0x4a, 0x65, 0x93, 0xb6, 0xd9, 0x72, 0x99, 0x99, 0xec, 0x2b,
+  0xa7, 0x24, 0xae, 0xbf, 0x95, 0x1b, 0x86, 0x4e, 0x03, 0x4b, 0x35, 0xa1,
+  0x8e, 0x31, 0x08, 0x23, 0xfa, 0x26, 0x40, 0x17, 0x36, 0x66, 0x2d, 0xd0,
+  0xd0, 0x8b, 0x28, 0x30, 0x4e, 0xee, 0x95, 0xd7, 0x29, 0x5b, 0x16, 0xf0,
+  0x2e, 0xae, 0xae, 0x03, 0x73, 0x56, 0x11, 0xb4, 0xd5, 0x52, 0xe5, 0x4c,
+  0x00, 0x28, 0x25, 0x9f, 0xc1, 0xd1, 0x83, 0x03, 0x92, 0xca, 0xc1, 0xf3,
+  0x59, 0x05, 0x71, 0x64, 0x43, 0xbb, 0x8b, 0x3e, 0x31, 0x17, 0xf7, 0xb3,
+  0x6d, 0x34, 0xc8, 0x6c, 0xcc, 0xa2, 0x82, 0x30, 0x04, 0x1d, 0xf2, 0xc3,
+  0x37, 0xa4, 0x09, 0x00, 0x05, 0x55, 0xf8, 0x2c, 0xf3, 0xde, 0xdd, 0x50,
+  0x7e, 0x51, 0x28, 0x53, 0xf6, 0x09, 0x7b, 0x02, 0x3b, 0x7d, 0x59, 0x53,
+  0x92, 0x67, 0x63, 0x58, 0x9a, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
+  0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
+  0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x9a, 0x69, 0x0c, 0x76, 0x9d, 0x4a, 0xfd,
+  0xfd, 0xf7, 0x8c, 0x06, 0x36, 0x31, 0x17, 0x93, 0xe7, 0x38, 0x26, 0xef,
+  0xef, 0x99, 0x61, 0x25, 0x53, 0xd2, 0x2e, 0xd7, 0xe0, 0x6a, 0x8f, 0x72,
+  0x84, 0xdf, 0x9c, 0x36, 0x36, 0x3e, 0x54, 0x85, 0xc1, 0x22, 0x92, 0x00,
+  0x8d, 0x67, 0xe8, 0x45, 0x45, 0xfd, 0x83, 0x12, 0x1c, 0xe7, 0x8d, 0x62,
+  0xa0, 0xd5, 0xf2, 0x6e, 0xa3, 0x54, 0x54, 0xcb, 0x54, 0xac, 0x16, 0xc2,
+  0xc9, 0xbc, 0x4b, 0x79, 0x59, 0x5e, 0x5b, 0xc5, 0xa4, 0xb7, 0x57, 0xf4,
+  0x4d, 0x08, 0x65, 0x3d, 0xc0, 0x9e, 0x01, 0xe8, 0x05, 0x3d, 0xa5, 0xf7,
+  0x6c, 0x3b, 0x5b, 0x6a, 0x1b, 0x66, 0x66, 0xad, 0xb0, 0x5f, 0x51, 0x67,
+  0xe2, 0x7d, 0x6a, 0xbd, 0xd9, 0x28, 0xec, 0xe4, 0x3b, 0xc6, 0xc8, 0x33,
+  0x55, 0x13, 0x94, 0x5e, 0x58, 0x23, 0x98, 0xc3, 0xc3, 0xd3, 0xb3, 0x82,
+  0xe2, 0x98, 0x58, 0xca, 0xda, 0xba, 0xfe, 0x4f, 0xb6, 0xd8, 0xcb, 0xdc,
+  0xba, 0xbf, 0x07, 0x3a, 0x27, 0xf7, 0xbf, 0xb6, 0x23, 0x05, 0x19, 0xd2,
+  0x36, 0x7c, 0x9d, 0x87, 0xd0, 0x82, 0x04, 0xb4, 0xb4, 0x85, 0x85, 0xc8,
+  0x7c, 0xa0, 0x4f, 0x50, 0xd1, 0x66, 0x66, 0x4c, 0x15, 0xfe, 0x28, 0xb1,
+  0x42, 0xe0, 0x46, 0x99, 0x3c, 0x4e, 0x49, 0x9f, 0x3b, 0xe8, 0xfe, 0x78,
+  0x9d, 0x1c, 0xc6, 0x57, 0xc2, 0xa0, 0x07, 0x92, 0x22, 0x06, 0x78, 0x16,
+  0xe6, 0xe9, 0x54, 0xb8, 0xd1, 0x34, 0x04, 0x3b, 0xbf, 0xad, 0x87, 0x70,
+  0x70, 0x6f, 0x4e, 0x4e, 0x5b, 0x74, 0x74, 0x47, 0x95, 0xa2, 0x20, 0x35,
+  0x21, 0x28, 0x60, 0x42, 0x36, 0xcb, 0x13, 0x85, 0x78, 0xa1, 0x16, 0x3c,
+  0x03, 0x77, 0x96, 0x38, 0x5d, 0xbd, 0x47, 0xa5, 0xb7, 0x01, 0x94, 0x37,
+  0x26, 0x6c, 0x20, 0x4a, 0x08, 0x9f, 0x9f, 0xc3, 0xc3, 0x58, 0x55, 0xca,
+  0xca, 0xf7, 0xdc, 0xc1, 0x51, 0xb9, 0xcc, 0xf8, 0x9b, 0x6e, 0xfc, 0x07,
+  0xd2, 0xd2, 0x03, 0x00, 0xe8, 0x65, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e,
+  0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0xb7, 0xbe, 0xa5, 0x7e, 0xfe,
+  0xc5, 0xff, 0xb9, 0x55, 0xe0, 0x2e, 0xa1, 0xf3, 0x53, 0x53, 0xe5, 0xdf,
+  0xfa, 0x47, 0xc4, 0x45, 0x75, 0xe0, 0xf1, 0xf1, 0x00, 0x75, 0x96, 0xa5,
+  0xa3, 0x76, 0xf7, 0x94, 0xde, 0x80, 0x4b, 0x46, 0x5d, 0x77, 0x4c, 0x83,
+  0x16, 0x6a, 0x1f, 0xe9, 0x2f, 0xe0, 0x7c, 0x9c, 0x81, 0x9b, 0x83, 0x53,
+  0x1f, 0x7c, 0x84, 0x8f, 0x16, 0x52, 0x6a, 0x27, 0x77, 0xa3, 0x92, 0x4e,
+  0x5a, 0xa1, 0x9c, 0x05, 0x26, 0xac, 0x9a, 0x09, 0x84, 0xf1, 0xbf, 0xeb,
+  0xd1, 0x3c, 0x3c, 0x9b, 0x9b, 0xdd, 0xdd, 0x43, 0x91, 0x25, 0x70, 0x6b,
+  0x62, 0xe5, 0xb1, 0xc3, 0xd8, 0x17, 0xaf, 0x58, 0x58, 0x6f, 0x6f, 0xe3,
+  0x44, 0xaf, 0x01, 0x1c, 0xb0, 0x8f, 0x8f, 0x66, 0x8e, 0x13, 0xa7, 0x26,
+  0x26, 0x21, 0x21, 0xb4, 0x56, 0x5a, 0x8a, 0x3a, 0x18, 0x90, 0x58, 0x21,
+  0xcb, 0xe9, 0x0c, 0x25, 0xa7, 0xa3, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xe7, 0xff, 0xee, 0x0b, 0x2d, 0x0b,
+  0xa9, 0x65, 0xee, 0x6c, 0x2e, 0x6d, 0xc8, 0xa6, 0x38, 0x8a, 0x3d, 0x1b,
+  0xed, 0x76, 0x3f, 0x19, 0xfa, 0xa6, 0xd0, 0xf5, 0xd3, 0x3b, 0xe8, 0x79,
+  0x70, 0xa9, 0x5c, 0xe4, 0xb3, 0x31, 0x0b, 0xa6, 0x70, 0x5c, 0x49, 0x81,
+  0xd3, 0xc1, 0x88, 0xbe, 0x07, 0xd6, 0xe5, 0x44, 0x44, 0x76, 0xd2, 0x68,
+  0x9e, 0x47, 0x68, 0x68, 0x75, 0x4e, 0xdb, 0xaa, 0xd6, 0x37, 0x54, 0x9c,
+  0x69, 0x2c, 0xae, 0x3d, 0xb9, 0xa5, 0x87, 0xf5, 0xd2, 0xad, 0x57, 0xc7,
+  0xc4, 0x5d, 0x8d, 0x68, 0x35, 0xbe, 0x41, 0xe5, 0xe4, 0x68, 0x90, 0xd8,
+  0xd8, 0x1d, 0x79, 0x1c, 0xab, 0x5d, 0xd5, 0xa9, 0x16, 0x54, 0x45, 0x45,
+  0xc6, 0x0d, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73,
+  0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0xfb, 0xc0, 0xc0, 0xf3, 0x0f, 0x19,
+  0x10, 0x10, 0xc0, 0x03, 0x68, 0xcc, 0x06, 0x87, 0x5e, 0x37, 0x7f, 0xe3,
+  0x43, 0x9e, 0xc9, 0xc6, 0xd8, 0xe2, 0x85, 0x0c, 0x64, 0x14, 0x94, 0xd0,
+  0x9c, 0xcc, 0xcc, 0xa5, 0xa6, 0xa6, 0x1b, 0x1b, 0x35, 0x35, 0x55, 0x80,
+  0xdd, 0xac, 0x68, 0xc9, 0xf3, 0xb8, 0x99, 0x8d, 0x5b, 0x03, 0x7f, 0xce,
+  0x13, 0xe7, 0x14, 0x42, 0x34, 0xa9, 0x56, 0xb1, 0x7d, 0x6b, 0xc4, 0xc4,
+  0xe1, 0x76, 0x20, 0x76, 0xa9, 0x82, 0xdb, 0xcb, 0x68, 0x10, 0x02, 0x97,
+  0x30, 0xcb, 0x19, 0xc7, 0xde, 0xac, 0x81, 0x81, 0xd1, 0x0b, 0xca, 0xd2,
+  0x21, 0x33, 0xf0, 0x36, 0x9a, 0x16, 0xac, 0x90, 0x5f, 0x86, 0x53, 0x01,
+  0x50, 0xce, 0x50, 0xb8, 0x99, 0x44, 0x68, 0x29, 0xb7, 0xb7, 0x1e, 0xd4,
+  0xdb, 0x2e, 0xdd, 0x68, 0xf6, 0x25, 0xc1, 0x3b, 0x16, 0xc3, 0xc3, 0xb5,
+  0xf9, 0x86, 0x81, 0x6b, 0xa2, 0x6e, 0x63, 0x86, 0x4e, 0xb1, 0x83, 0xce,
+  0xe2, 0xbb, 0xbc, 0x36, 0xf4, 0xcc, 0xd0, 0x05, 0x55, 0x63, 0xfa, 0x1a,
+  0x83, 0x7b, 0xc3, 0x2d, 0x77, 0x7c, 0x1d, 0x53, 0x96, 0x88, 0xc7, 0x6f,
+  0x56, 0xb1, 0x18, 0x9f, 0x89, 0x86, 0x20, 0xb6, 0x66, 0x66, 0xea, 0x85,
+  0xf9, 0x1a, 0xca, 0x4a, 0x4a, 0x9d, 0x75, 0xdd, 0xcb, 0x50, 0x8d, 0x30,
+  0xbd, 0xf5, 0x86, 0x08, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
+  0x25, 0x25, 0x25, 0x25, 0x25, 0xbb, 0x86, 0x0a, 0xbb, 0x3b, 0x80, 0xb3,
+  0xa6, 0xb8, 0xc6, 0x38, 0x33, 0x7a, 0x9e, 0x72, 0x2a, 0x2a, 0xf3, 0x92,
+  0x92, 0x3a, 0x3a, 0x9b, 0x3a, 0x72, 0xad, 0x3a, 0x0e, 0x48, 0x48, 0xe4,
+  0xa9, 0xe8, 0x91, 0x05, 0xef, 0xcf, 0xcf, 0x02, 0x1b, 0x0a, 0xe7, 0x66,
+  0xec, 0x93, 0xab, 0x62, 0x85, 0x31, 0x2a, 0xb8, 0xa5, 0x89, 0xb3, 0xd6,
+  0x07, 0xa9, 0xfb, 0xd8, 0x99, 0xa6, 0xa4, 0x46, 0x67, 0xaf, 0x3d, 0x15,
+  0xcd, 0x3d, 0x88, 0xf6, 0xb3, 0x52, 0x1c, 0x29, 0x5b, 0x83, 0x84, 0xe8,
+  0xb3, 0x48, 0x9a, 0xa1, 0xde, 0xe3, 0xe4, 0x05, 0x54, 0x54, 0x23, 0xfc,
+  0xd2, 0xd1, 0xae, 0x0f, 0x3a, 0x62, 0x00, 0x03, 0xa7, 0x41, 0xa8, 0xa8,
+  0x59, 0x59, 0x1e, 0x8c, 0x40, 0x48, 0x0f, 0x2f, 0xa2, 0x5d, 0xdb, 0x51,
+  0xfb, 0x80, 0xfe, 0x63, 0x63, 0x0d, 0x51, 0xa2, 0x3d, 0xd7, 0xd7, 0x8b,
+  0xde, 0x12, 0x3e, 0x6e, 0xdc, 0x56, 0xaa, 0xd1, 0x35, 0x92, 0x1f, 0xfb,
+  0xc6, 0xcf, 0xc0, 0xdd, 0xcb, 0x16, 0xf3, 0x9d, 0x69, 0xfd, 0xa6, 0xab,
+  0xd8, 0xec, 0x19, 0x9a, 0x00, 0xb6, 0xf2, 0xc7, 0xa0, 0x9a, 0x9a, 0xd0,
+  0xd8, 0x3c, 0xa1, 0x4c, 0x4c, 0xd8, 0x22, 0xfe, 0xda, 0x9e, 0x3e, 0xaa,
+  0x82, 0x13, 0x15, 0x32, 0xcf, 0xaf, 0x39, 0x69, 0x2e, 0x3c, 0xe2, 0x2d,
+  0x39, 0x82, 0xbb, 0x6b, 0xd3, 0xb8, 0x04, 0x0f, 0x82, 0x49, 0x45, 0x98,
+  0x9d, 0x3e, 0xfe, 0xe4, 0x9f, 0x92, 0xd2, 0x9a, 0x63, 0xb6, 0x50, 0x23,
+  0x33, 0x55, 0xbc, 0x7f, 0xd0, 0xd0, 0x9e, 0x5b, 0x02, 0x77, 0xf6, 0x3f,
+  0x3f, 0x3c, 0x3c, 0xcd, 0x93, 0xd6, 0xc3, 0x64, 0x8a, 0x69, 0x8f, 0x94,
+  0x41, 0xdc, 0x31, 0x31, 0x74, 0xff, 0xde, 0xef, 0xac, 0x58, 0xbe, 0x1d,
+  0xd0, 0xcf, 0x88, 0xe2, 0xa9, 0xa9, 0xa4, 0x19, 0xc6, 0x58, 0xab, 0xab,
+  0xa6, 0xe3, 0xe3, 0x65, 0xff, 0x00, 0x53, 0x17, 0x8d, 0xc4, 0x93, 0x7f,
+  0x9d, 0xf0, 0xd2, 0xed, 0x83, 0x83, 0xda, 0xda, 0x51, 0xd9, 0x52, 0x61,
+  0x4b, 0xda, 0x91, 0x75, 0xc2, 0x0c, 0x7d, 0xfb, 0x64, 0x9c, 0x96, 0xb8,
+  0xb8, 0x7e, 0xf2, 0xd8, 0x44, 0x6a, 0x3c, 0xb0, 0x11, 0x8f, 0x2e, 0xfd,
+  0x29, 0x19, 0x73, 0x21, 0x5e, 0x3c, 0xb1, 0xdd, 0xb0, 0x00, 0x6a, 0x6f,
+  0x91, 0x91, 0x81, 0xfc, 0x3b, 0xb7, 0x41, 0xc6, 0x58, 0x66, 0xa6, 0xb1,
+  0xb1, 0xdf, 0xb3, 0x53, 0x55, 0x1f, 0x31, 0x35, 0xd1, 0x8c, 0xf0, 0x2b,
+  0xd1, 0xf5, 0xe9, 0x0f, 0xfb, 0xf3, 0xa5, 0x05, 0x35, 0x0b, 0x5f, 0xca,
+  0xca, 0x98, 0xa2, 0x81, 0xf1, 0xd6, 0x5f, 0xb5, 0x30, 0xf3, 0x3d, 0x98,
+  0x4d, 0xab, 0x0d, 0x1a, 0x70, 0x02, 0x02, 0xe7, 0xa1, 0xdf, 0x08, 0xe3,
+  0xfc, 0xb3, 0xa2, 0xa2, 0x5e, 0x2c, 0x34, 0x58, 0x0a, 0x7e, 0x6f, 0xcc,
+  0xb4, 0x2c, 0xc2, 0xe1, 0xec, 0x18, 0xc1, 0x63, 0x26, 0x5e, 0xc1, 0x6c,
+  0x1e, 0x69, 0xad, 0x43, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e,
+  0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1f, 0x87, 0x62, 0x83, 0xa0,
+  0xb3, 0xca, 0x4b, 0x7f, 0xe5, 0x6c, 0x26, 0xaa, 0xfe, 0xd4, 0x94, 0x4a,
+  0x61, 0x1d, 0x91, 0xa6, 0x3e, 0x29, 0x4a, 0x39, 0xd6, 0x9f, 0x6d, 0x5d,
+  0xff, 0xd2, 0xae, 0x45, 0xa5, 0xf5, 0x61, 0x61, 0xfb, 0x84, 0x36, 0x36,
+  0x07, 0x83, 0x83, 0xb1, 0x54, 0xe8, 0x12, 0xa4, 0xea, 0x70, 0xdd, 0x07,
+  0x41, 0x01, 0xa1, 0x49, 0x49, 0x43, 0x6b, 0x9f, 0xef, 0x0e, 0x68, 0xcc,
+  0x4e, 0x4e, 0x99, 0x99, 0x4f, 0x3f, 0x9a, 0x01, 0x73, 0x44, 0xed, 0xd5,
+  0xe7, 0x7a, 0x2c, 0x84, 0xde, 0x0a, 0x1a, 0x58, 0x9a, 0xf2, 0x57, 0x9f,
+  0x9c, 0x62, 0xca, 0x50, 0x50, 0x15, 0x91, 0x6a, 0x9e, 0x6d, 0xbf, 0x47,
+  0x0b, 0xaf, 0x41, 0x4d, 0x14, 0xb2, 0xe2, 0x60, 0xfd, 0xf9, 0xb0, 0xee,
+  0x64, 0x5e, 0xf2, 0x76, 0x26, 0x3e, 0x4b, 0xda, 0xe8, 0x47, 0x5f, 0x34,
+  0xb8, 0x25, 0x90, 0x10, 0xf6, 0xe7, 0x8e, 0x62, 0x85, 0xe7, 0x2d, 0x75,
+  0x34, 0xd9, 0x7f, 0xcf, 0xf1, 0x7e, 0xce, 0x61, 0x31, 0xc9, 0x5a, 0x8a,
+  0x74, 0x09, 0xb5, 0x54, 0x9b, 0x87, 0xbf, 0xbc, 0x86, 0x2f, 0xdc, 0x9f,
+  0x60, 0xec, 0x9e, 0xa2, 0x86, 0xbd, 0x90, 0x6f, 0x9a, 0xb8, 0x6b, 0x9c,
+  0x2c, 0x5b, 0x98, 0xbd, 0x2d, 0xe2, 0xb3, 0x9b, 0xaf, 0x2c, 0x81, 0x9c,
+  0xf3, 0x94, 0x4a, 0xed, 0xb3, 0x41, 0x38, 0xc2, 0x70, 0x5b, 0x1d, 0x71,
+  0xa9, 0xd5, 0x16, 0x90, 0xa9, 0x52, 0x07, 0x6e, 0xc3, 0x9c, 0xaf, 0x0a,
+  0xf5, 0x09, 0x3e, 0xa8, 0xe5, 0x61, 0xf6, 0x38, 0x24, 0x0d, 0x7f, 0x42,
+  0x09, 0x27, 0xd4, 0xa6, 0xd3, 0xb3, 0x4b, 0xcb, 0xd9, 0x03, 0x83, 0x30,
+  0x18, 0xef, 0xc4, 0x6a, 0x6c, 0x3d, 0x53, 0x65, 0x46, 0x21, 0xb5, 0xb3,
+  0xe0, 0xbf, 0x4b, 0xa5, 0xf4, 0x06, 0xeb, 0x05, 0x49, 0xef, 0x05, 0x04,
+  0x39, 0x16, 0xcf, 0x17, 0x6c, 0x3f, 0xef, 0x54, 0x35, 0x98, 0xed, 0x37,
+  0x96, 0xd0, 0xd0, 0x7b, 0xd7, 0x39, 0x74, 0x97, 0xb0, 0xd6, 0x1e, 0xa8,
+  0x94, 0xa7, 0x5a, 0x2a, 0x98, 0x8b, 0x0a, 0xdc, 0x1d, 0x90, 0x52, 0x80,
+  0xb0, 0x60, 0x6b, 0x7e, 0x36, 0x4c, 0x94, 0x59, 0xd9, 0x25, 0xc9, 0x9d,
+  0x06, 0x5f, 0x82, 0x67, 0x90, 0xf4, 0x1a, 0xd4, 0x96, 0x63, 0x3e, 0xc1,
+  0x59, 0x01, 0x13, 0x7e, 0xce, 0x9e, 0x8a, 0x08, 0x49, 0x38, 0x8f, 0xf7,
+  0x43, 0x15, 0x4d, 0xe3, 0x22, 0x09, 0x9a, 0xb4, 0x0f, 0x64, 0x64, 0x15,
+  0x24, 0x87, 0x84, 0x62, 0x81, 0x60, 0x58, 0xd0, 0xe8, 0x69, 0x60, 0x97,
+  0x86, 0x6f, 0x33, 0xb2, 0xee, 0xc6, 0xc6, 0xe8, 0xd9, 0x47, 0x80, 0x25,
+  0xb2, 0x78, 0xe8, 0x90, 0x4b, 0x4d, 0xa4, 0xbe, 0xfd, 0xfd, 0x08, 0x08,
+  0x98, 0x8c, 0x9b, 0xab, 0x16, 0x92, 0x7b, 0xad, 0xe5, 0xfe, 0x49, 0x60,
+  0x1d, 0x82, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60,
+  0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60,
+  0xf6, 0x87, 0x87, 0x87, 0x37, 0x8a, 0x21, 0x4b, 0x60, 0xfe, 0x27, 0xed,
+  0x23, 0x30, 0x45, 0xd1, 0x88, 0x06, 0xbe, 0xd3, 0x50, 0x9f, 0x56, 0xf6,
+  0xf6, 0xfc, 0xdf, 0x8e, 0x6a, 0x83, 0x49, 0xa6, 0xdf, 0xf3, 0xf3, 0xe5,
+  0xe5, 0x7f, 0x7f, 0x0d, 0xd6, 0xd6, 0x47, 0x15, 0x25, 0x6c, 0x2d, 0x12,
+  0x8b, 0x02, 0x43, 0x51, 0xb6, 0xf4, 0xae, 0x65, 0xc6, 0xb7, 0x65, 0x88,
+  0xa1, 0x27, 0x38, 0xf5, 0x13, 0x7d, 0xe4, 0x9d, 0x89, 0x69, 0xd2, 0xd2,
+  0x80, 0x17, 0xaa, 0xf9, 0xb4, 0x47, 0x9c, 0x61, 0x17, 0x65, 0x59, 0x01,
+  0x87, 0x87, 0x56, 0x34, 0x10, 0x90, 0x35, 0x53, 0xbf, 0x3d, 0x17, 0x3c,
+  0x8e, 0x0f, 0xfa, 0x30, 0xe2, 0xd4, 0xb5, 0x4c, 0xbe, 0x89, 0x0f, 0x10,
+  0xe5, 0x5d, 0x5d, 0x98, 0x3f, 0xe8, 0x48, 0x6f, 0x11, 0xd5, 0x32, 0x27,
+  0x29, 0xa9, 0xcb, 0xa5, 0xd7, 0x12, 0x6a, 0xbc, 0xa9, 0x6e, 0x9f, 0xd3,
+  0x1f, 0x8d, 0x0c, 0x5b, 0xd7, 0x6d, 0xe3, 0x85, 0xfe, 0x38, 0x0e, 0xb7,
+  0xda, 0xb3, 0x56, 0x51, 0xfd, 0xa7, 0xb9, 0x15, 0x00, 0xb9, 0xfb, 0x14,
+  0x8c, 0xe6, 0xa7, 0xa6, 0x49, 0x3f, 0xa1, 0x12, 0x71, 0x4b, 0x96, 0x72,
+  0x7e, 0x7e, 0xcb, 0x6b, 0x89, 0x89, 0x84, 0x5e, 0x0f, 0x0f, 0x6f, 0x6f,
+  0xc0, 0xc0, 0x4e, 0xa8, 0xf6, 0x05, 0x6b, 0x78, 0x54, 0xdb, 0x4f, 0x94,
+  0x4b, 0x8b, 0x05, 0xe2, 0x8e, 0x41, 0x87, 0x5a, 0xbc, 0xfd, 0xa7, 0x6b,
+  0xab, 0x16, 0xd1, 0x25, 0xd0, 0x2b, 0x34, 0xff, 0xf4, 0x76, 0x8c, 0xe9,
+  0xe9, 0xbb, 0xc7, 0xe1, 0x5e, 0xa3, 0xd7, 0xf9, 0x52, 0x2d, 0x61, 0x75,
+  0xf2, 0x56, 0x67, 0x5d, 0xb1, 0x4c, 0x74, 0xf7, 0x19, 0x5b, 0x5c, 0x96,
+  0x76, 0xba, 0x73, 0x62, 0x4d, 0x2b, 0x0d, 0xab, 0xb1, 0x40, 0x9f, 0x29,
+  0x35, 0xe8, 0x65, 0x95, 0xf8, 0x9c, 0xf1, 0x9a, 0x44, 0xb2, 0x53, 0xd1,
+  0x64, 0x6e, 0xe0, 0x6b, 0x60, 0xe3, 0x55, 0x6e, 0x6d, 0xb3, 0xb3, 0xb3,
+  0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3,
+  0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x4e, 0x4e, 0x1f, 0xd6, 0xfa,
+  0xd9, 0x57, 0xc8, 0x29, 0x14, 0xf9, 0xf6, 0x86, 0x4f, 0xb4, 0xb8, 0x43,
+  0x7a, 0x85, 0x76, 0x36, 0x8b, 0xbe, 0x47, 0xb3, 0x33, 0xe2, 0xe2, 0xfb,
+  0xa6, 0xf6, 0xaa, 0x72, 0xa2, 0xb9, 0x57, 0xd1, 0x92, 0xaf, 0x17, 0x52,
+  0xa7, 0x83, 0x2a, 0x47, 0xb1, 0xf2, 0xa3, 0x6b, 0xbe, 0x5d, 0xca, 0xca,
+  0x3a, 0x3a, 0x7b, 0x7b, 0x2e, 0x2e, 0x5a, 0x5a, 0x65, 0x65, 0x0a, 0x44,
+  0x74, 0xc8, 0xc3, 0x91, 0xb0, 0xcd, 0x7c, 0xcb, 0xc9, 0xc9, 0x19, 0x19,
+  0x66, 0x66, 0xb0, 0x01, 0x98, 0x1d, 0x31, 0x51, 0x1f, 0x9c, 0x14, 0xb8,
+  0xcb, 0x6b, 0xc8, 0x57, 0x24, 0x46, 0x87, 0x0f, 0x73, 0xd5, 0x33, 0xbc,
+  0xf6, 0x65, 0xcd, 0xc8, 0x25, 0x49, 0xfc, 0x7f, 0x65, 0x79, 0x02, 0x3c,
+  0x12, 0x37, 0xbe, 0xd9, 0xe5, 0x1d, 0xde, 0xfa, 0x0a, 0x36, 0xeb, 0x0d,
+  0x94, 0x48, 0x39, 0x89, 0x0d, 0x71, 0x1f, 0x48, 0x09, 0xcc, 0xb3, 0x45,
+  0xb5, 0x69, 0xb1, 0xbb, 0xcc, 0x69, 0x6c, 0x74, 0x9b, 0xac, 0x2d, 0xf4,
+  0xa5, 0x51, 0xe5, 0x04, 0x63, 0x4b, 0x31, 0x26, 0x83, 0x3a, 0xc9, 0x4a,
+  0xb6, 0xe0, 0x3d, 0x1b, 0x49, 0x32, 0x17, 0xa9, 0x06, 0x39, 0x34, 0xd6,
+  0x0e, 0xcf, 0x32, 0x67, 0x23, 0x03, 0x64, 0x6c, 0xf7, 0xe9, 0x0e, 0x1e,
+  0x86, 0xd2, 0xaf, 0x07, 0xc3, 0x99, 0x7c, 0xfa, 0xe5, 0xc2, 0x44, 0x27,
+  0x28, 0x57, 0x60, 0x48, 0xfe, 0xa2, 0xb0, 0x8c, 0xcd, 0x61, 0xec, 0x0f,
+  0x10, 0xf9, 0x11, 0xac, 0xb9, 0x99, 0xa1, 0xdd, 0x88, 0xfa, 0x77, 0xba,
+  0x65, 0xc0, 0x7a, 0xdb, 0x2b, 0x29, 0x30, 0x5b, 0x2e, 0xf3, 0x69, 0xbd,
+  0x2b, 0x1b, 0x91, 0x2b, 0xdf, 0xf2, 0xed, 0xd8, 0xac, 0x3b, 0x51, 0x41,
+  0x34, 0x82, 0x95, 0xe3, 0x9b, 0xc5, 0x52, 0xec, 0x20, 0x28, 0x28, 0xe0,
+  0xe0, 0x12, 0x12, 0xd0, 0xb0, 0x21, 0xc5, 0x47, 0x17, 0x1b, 0x91, 0x02,
+  0x5c, 0xae, 0x17, 0xf6, 0xf6, 0xe2, 0xfe, 0xb8, 0x1e, 0xe5, 0x48, 0x3f,
+  0xe7, 0xeb, 0x1d, 0x67, 0xb4, 0x0f, 0xc8, 0xc3, 0x10, 0x24, 0x34, 0x56,
+  0xf3, 0xd9, 0xd4, 0x2e, 0xca, 0x17, 0x82, 0x89, 0x6d, 0x66, 0x24, 0x09,
+  0xd5, 0xbe, 0x86, 0x5b, 0xbd, 0xf6, 0x15, 0x9a, 0x49, 0x5d, 0x77, 0xce,
+  0x32, 0xfe, 0x72, 0xdd, 0xdd, 0x25, 0xc5, 0xaa, 0xe3, 0xb9, 0xa9, 0xd2,
+  0xa0, 0x72, 0x5d, 0xaf, 0x62, 0x1a, 0x05, 0x5c, 0xe2, 0x80, 0x30, 0xf2,
+  0x9e, 0x71, 0x0a, 0x7f, 0x7a, 0x3c, 0x14, 0x00, 0x74, 0xe9, 0xd2, 0x42,
+  0xa2, 0x7f, 0x64, 0x1e, 0x7b, 0x25, 0xa7, 0x06, 0xac, 0x17, 0x4d, 0x74,
+  0x90, 0xc2, 0xed, 0x75, 0x53, 0xa4, 0xe7, 0xf4, 0x6a, 0xb9, 0x51, 0xb7,
+  0xe5, 0xaa, 0xb4, 0xb8, 0xbb, 0xeb, 0x52, 0x77, 0x63, 0x81, 0x00, 0x79,
+  0xd6, 0xd6, 0xab, 0x3d, 0x2a, 0xde, 0xf3, 0xbb, 0xa3, 0x7b, 0x97, 0x1d,
+  0xd3, 0x86, 0xe6, 0x9c, 0x7f, 0x3d, 0x05, 0xaf, 0x26, 0x57, 0x39, 0x87,
+  0xd0, 0xd0, 0x4f, 0xe8, 0x03, 0x27, 0xcb, 0xa6, 0xfa, 0xac, 0xee, 0x56,
+  0xe0, 0xb4, 0xdd, 0x2a, 0x75, 0x5a, 0xf9, 0x6a, 0x27, 0xf9, 0xeb, 0x27,
+  0x7e, 0x02, 0x20, 0x81, 0xeb, 0x24, 0x5c, 0x0d, 0x3a, 0x0f, 0x5b, 0x66,
+  0xf0, 0x6e, 0x73, 0xd7, 0x19, 0x56, 0x52, 0x99, 0x27, 0x28, 0x61, 0x5f,
+  0xef, 0x9f, 0x69, 0xb6, 0xcf, 0x89, 0x0f, 0xc4, 0x95, 0xff, 0xff, 0x13,
+  0x27, 0x26, 0xa4, 0xcc, 0x5f, 0x13, 0x59, 0x13, 0x09, 0x32, 0x81, 0x31,
+  0x5c, 0x0a, 0x08, 0xcb, 0x2d, 0x8d, 0x76, 0xa3, 0x89, 0x31, 0x31, 0xff,
+  0x90, 0xbe, 0x05, 0xd0, 0xb8, 0x94, 0x7d, 0x7d, 0x40, 0x2a, 0x00, 0x47,
+  0x62, 0x05, 0xeb, 0x16, 0xfb, 0xc5, 0x2f, 0x2e, 0x2e, 0x6c, 0x23, 0x23,
+  0x3f, 0x3f, 0x6e, 0x7e, 0xed, 0x46, 0x79, 0xdc, 0x5b, 0x1c, 0xa8, 0x3b,
+  0x10, 0xbb, 0x48, 0xbf, 0xed, 0x88, 0x5f, 0xec, 0xd5, 0x5b, 0x7d, 0xc5,
+  0x31, 0x6c, 0xf7, 0x08, 0x2f, 0x1b, 0x5d, 0x1b, 0x59, 0x7f, 0x4a, 0x79,
+  0x5d, 0x09, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
+  0x81, 0x81, 0x81, 0x14, 0x61, 0xfb, 0x4a, 0x93, 0x61, 0xe9, 0x76, 0x35,
+  0x9d, 0x8a, 0xc9, 0x2c, 0xc0, 0xb3, 0x2d, 0x37, 0x98, 0xbe, 0x72, 0xd6,
+  0x65, 0xe2, 0x3d, 0xe2, 0xc6, 0x02, 0x15, 0x0d, 0x01, 0xac, 0x9c, 0x84,
+  0x84, 0x6d, 0x50, 0xac, 0xcf, 0xc5, 0x7f, 0x44, 0xb7, 0xb0, 0x46, 0xf6,
+  0x0b, 0xc6, 0x40, 0xf4, 0x38, 0xec, 0xf4, 0x61, 0xaf, 0x69, 0x69, 0x25,
+  0x99, 0x53, 0x49, 0xce, 0x2d, 0xd8, 0x62, 0x51, 0x58, 0x6d, 0xbb, 0xd9,
+  0x05, 0x3f, 0x02, 0xb5, 0x53, 0xa2, 0x35, 0xa7, 0xc9, 0x0d, 0xe1, 0xf2,
+  0xc3, 0xc3, 0xa2, 0x65, 0xa8, 0xc6, 0x6d, 0x58, 0x6a, 0x5e, 0xce, 0xd9,
+  0x59, 0xb1, 0x65, 0x19, 0x46, 0xcf, 0x83, 0x23, 0xa1, 0xcd, 0x9e, 0x5a,
+  0x1c, 0xab, 0xac, 0x04, 0xd0, 0xdf, 0x4a, 0x2f, 0x2f, 0xfe, 0xf2, 0x15,
+  0xeb, 0x06, 0xfb, 0xd2, 0xae, 0xae, 0x1a, 0x1a, 0x2e, 0x2e, 0xaa, 0xaa,
+  0xf1, 0x9e, 0xbe, 0x0e, 0xd9, 0x1f, 0xf3, 0xf3, 0xb6, 0x41, 0xbf, 0x45,
+  0xb1, 0x9f, 0xdf, 0xcd, 0xa3, 0xa0, 0xbe, 0xbe, 0xe0, 0xd8, 0x4b, 0xb7,
+  0x7a, 0xe1, 0xf9, 0xf0, 0xf4, 0x2d, 0x14, 0x38, 0x24, 0x80, 0x4f, 0x63,
+  0x5e, 0x38, 0x05, 0x3e, 0xff, 0x31, 0x73, 0xa6, 0x67, 0x5d, 0x08, 0x73,
+  0x87, 0xd3, 0x4d, 0x1c, 0xcf, 0xe8, 0xe8, 0xa3, 0xa3, 0x98, 0xa1, 0xe9,
+  0x5d, 0xc7, 0xab, 0x98, 0x1d, 0x83, 0x29, 0x37, 0xa3, 0x20, 0xb3, 0x0d,
+  0xb4, 0xf6, 0xc2, 0xb2, 0x40, 0xd0, 0xad, 0xd7, 0xa2, 0x2d, 0xcb, 0x9c,
+  0x06, 0x9f, 0xf1, 0xbd, 0xf5, 0x47, 0xad, 0xf7, 0x8f, 0x94, 0x22, 0x1e,
+  0xf7, 0xa2, 0xbe, 0x97, 0x75, 0x2b, 0x41, 0xd5, 0x12, 0x76, 0x00, 0x1d,
+  0x82, 0xda, 0x05, 0x2f, 0x9a, 0xd3, 0x11, 0x91, 0x86, 0xce, 0x09, 0x2f,
+  0x24, 0xad, 0xe6, 0x35, 0x01, 0x60, 0x8a, 0x7a, 0x7d, 0xd4, 0x7d, 0xc0,
+  0x26, 0x50, 0xe8, 0xf0, 0x70, 0x8e, 0x24, 0x5a, 0x49, 0x91, 0xf0, 0xfa,
+  0x95, 0x0d, 0x33, 0x11, 0x8a, 0xe4, 0x0f, 0x0f, 0xd7, 0x96, 0x2b, 0x16,
+  0xe3, 0x17, 0xd0, 0x3b, 0xc1, 0x4a, 0x98, 0xe2, 0x37, 0x41, 0x41, 0x70,
+  0x81, 0x86, 0xd0, 0x7d, 0xad, 0xad, 0xa9, 0x83, 0x64, 0x64, 0x59, 0x05,
+  0xe2, 0x36, 0x94, 0x26, 0xc8, 0xc2, 0xa0, 0x43, 0x9c, 0x4a, 0xde, 0x11,
+  0xb0, 0xdf, 0xfd, 0xde, 0x8c, 0x8c, 0x6a, 0xc5, 0x5e, 0xbf, 0x87, 0x1a,
+  0x11, 0x02, 0xc2, 0x15, 0x1d, 0xd8, 0xac, 0x7d, 0xcb, 0x2c, 0xf8, 0xd9,
+  0x80, 0x70, 0xdb, 0x80, 0x31, 0x72, 0xfb, 0x48, 0xfc, 0xd6, 0x7f, 0x72,
+  0x2b, 0x19, 0x2c, 0x60, 0x85, 0xfd, 0xfd, 0x8b, 0x5c, 0x1d, 0x82, 0xbb,
+  0xb7, 0x14, 0x3f, 0xc6, 0xd0, 0xb2, 0x7a, 0xec, 0xaa, 0xf6, 0xf9, 0x3a,
+  0xa6, 0x5e, 0xbb, 0xc2, 0x96, 0x96, 0x0c, 0x76, 0x47, 0x58, 0x04, 0xf2,
+  0x50, 0x65, 0x65, 0x4d, 0xb8, 0xeb, 0x51, 0x12, 0xd0, 0xf8, 0xb4, 0x48,
+  0x13, 0xec, 0x0d, 0x89, 0x48, 0xf4, 0x8f, 0xbd, 0xbd, 0xcc, 0xb0, 0x16,
+  0xea, 0xbd, 0x7f, 0xfe, 0xa6, 0x84, 0xa6, 0x1c, 0x35, 0x0a, 0x75, 0x42,
+  0xdd, 0x06, 0xbe, 0xa8, 0x39, 0x6f, 0xef, 0x8f, 0xde, 0x81, 0xde, 0x5f,
+  0x4b, 0xd8, 0x94, 0xe7, 0x46, 0x30, 0x4f, 0x2c, 0x2a, 0x1a, 0x1a, 0x1a,
+  0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x5c, 0x42,
+  0x4a, 0x4a, 0xd7, 0x75, 0x30, 0x4b, 0x36, 0x36, 0xec, 0xa2, 0xcf, 0x3c,
+  0x07, 0x91, 0x82, 0x53, 0x5d, 0xfc, 0x83, 0x3d, 0xa0, 0x32, 0xc2, 0x41,
+  0x83, 0x74, 0x00, 0x00, 0x5b, 0x5b, 0x0a, 0xc3, 0x6e, 0x1f, 0x9a, 0x1a,
+  0x1b, 0x9d, 0xcd, 0xb2, 0xe8, 0x50, 0xf7, 0x33, 0x44, 0xe3, 0x3a, 0xe9,
+  0x19, 0x08, 0x08, 0x39, 0x9a, 0x06, 0x7e, 0x89, 0x10, 0x0f, 0xa5, 0x0d,
+  0x7a, 0x7a, 0x7a, 0xf5, 0xf4, 0xcb, 0xd8, 0xbc, 0x53, 0xd8, 0x8b, 0x4f,
+  0x40, 0x05, 0x86, 0xde, 0xc7, 0xd6, 0xeb, 0xeb, 0x6e, 0x6f, 0x97, 0xf6,
+  0xe4, 0xb6, 0x3f, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0xcf, 0xa6,
+  0x24, 0x9b, 0xba, 0x03, 0x4e, 0x45, 0xc0, 0x85, 0x40, 0x60, 0x62, 0x20,
+  0x9a, 0xdb, 0xc6, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+  0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71,
+  0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0xc5, 0x65, 0x19,
+  0xc4, 0xd3, 0xa4, 0xa6, 0xea, 0x2d, 0x22, 0x2a, 0x42, 0x42, 0x06, 0x06,
+  0x06, 0xb0, 0xff, 0xbc, 0xcb, 0x31, 0xe9, 0x6b, 0xfd, 0x20, 0x0c, 0x27,
+  0x3e, 0x55, 0xd7, 0x6f, 0xf2, 0x1b, 0x28, 0x7e, 0x4c, 0xe2, 0x19, 0x04,
+  0xee, 0x09, 0x2a, 0xf0, 0xfb, 0xd9, 0x40, 0xa3, 0x49, 0x56, 0x11, 0xa7,
+  0xb6, 0x72, 0xf1, 0x1d, 0x3a, 0xd7, 0xc2, 0x2e, 0xc7, 0x00, 0x84, 0x2e,
+  0x93, 0x04, 0xaf, 0x68, 0xc2, 0xdd, 0xa5, 0xee, 0x65, 0x42, 0xfa, 0xef,
+  0x60, 0xa1, 0x1c, 0xed, 0xfd, 0x83, 0x64, 0x09, 0x1e, 0x4a, 0x96, 0x54,
+  0xa1, 0x9c, 0x47, 0x9d, 0xae, 0x4c, 0x0c, 0x78, 0xee, 0x9b, 0xb5, 0x4f,
+  0xac, 0x7e, 0xe8, 0xaa, 0xfe, 0xb7, 0x8c, 0x64, 0x47, 0x18, 0xe2, 0x71,
+  0x93, 0x2c, 0x0f, 0x4e, 0xa3, 0x2d, 0x5f, 0x57, 0xb5, 0x39, 0xbc, 0x20,
+  0x47, 0x39, 0x0a, 0xa0, 0x8d, 0xef, 0x89, 0x5a, 0xa5, 0xcc, 0x1f, 0x4e,
+  0x6c, 0xbc, 0x3a, 0x2b, 0x62, 0x92, 0x43, 0x55, 0x38, 0xb7, 0x6f, 0xe4,
+  0x5a, 0x08, 0x78, 0x05, 0x8b, 0xc8, 0xfb, 0x50, 0xd9, 0x48, 0x54, 0x1f,
+  0xed, 0xe3, 0x5a, 0x88, 0x13, 0x2a, 0x14, 0xd0, 0xb9, 0x78, 0xbf, 0x95,
+  0x03, 0x8b, 0xaf, 0x1c, 0x50, 0xb5, 0xc4, 0x81, 0xd5, 0x2c, 0xf1, 0xd3,
+  0xea, 0x78, 0x85, 0x4d, 0x9d, 0xaf, 0xaf, 0xaa, 0xb6, 0x8e, 0x73, 0x2d,
+  0x8f, 0x15, 0x99, 0x70, 0x9f, 0x4d, 0xae, 0x32, 0x3b, 0xeb, 0x35, 0xdc,
+  0x55, 0xd1, 0xd1, 0x33, 0x5d, 0x36, 0xac, 0xe6, 0x85, 0x69, 0x21, 0xf6,
+  0xff, 0xb7, 0x6a, 0x98, 0xba, 0x37, 0xaa, 0x41, 0x8c, 0x68, 0x33, 0xf8,
+  0x06, 0x8a, 0x2e, 0xa3, 0xd9, 0x31, 0xe7, 0xe7, 0x9e, 0x9e, 0x88, 0x51,
+  0xdf, 0x11, 0xd4, 0x4f, 0x26, 0xbf, 0xbf, 0x94, 0xf8, 0xb3, 0x4b, 0x52,
+  0xc6, 0x2f, 0x14, 0x56, 0x27, 0x62, 0xe1, 0x7f, 0x80, 0x65, 0xcb, 0x7b,
+  0x7b, 0x27, 0xb2, 0x73, 0x0f, 0x48, 0xfa, 0x30, 0xf4, 0x74, 0x24, 0x96,
+  0x3a, 0xa3, 0x06, 0x31, 0x8d, 0x06, 0x08, 0xe2, 0x87, 0x82, 0x5d, 0x23,
+  0xb9, 0xa5, 0x63, 0x3f, 0x8f, 0x2d, 0x42, 0xc3, 0xc5, 0x0c, 0x7b, 0x56,
+  0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
+  0x90, 0x31, 0x40, 0x40, 0x89, 0x59, 0x90, 0x6c, 0x55, 0x95, 0x54, 0xb1,
+  0xfc, 0x11, 0x50, 0x13, 0x29, 0x59, 0xd0, 0x88, 0x10, 0x70, 0x02, 0x46,
+  0xb7, 0x1d, 0xd7, 0xbb, 0x99, 0x40, 0xd2, 0x6b, 0xc8, 0x65, 0xf2, 0xeb,
+  0x08, 0x81, 0xa1, 0x8c, 0x20, 0x8e, 0xbc, 0xa3, 0x39, 0x46, 0x3f, 0xb9,
+  0x25, 0xbc, 0x90, 0xc2, 0xc5, 0x8a, 0x7a, 0x1a, 0x8a, 0x3c, 0xbc, 0x45,
+  0x11, 0xf2, 0xf5, 0x88, 0x8d, 0x75, 0xb9, 0x70, 0xd3, 0x7c, 0xd4, 0x56,
+  0xcf, 0x54, 0x0e, 0xb4, 0xde, 0x31, 0xdb, 0x6d, 0xab, 0xab, 0x3c, 0x33,
+  0x61, 0xaf, 0x9a, 0x98, 0xc1, 0xc1, 0x87, 0x44, 0x7f, 0x4e, 0x34, 0xbd,
+  0x9e, 0xda, 0xa5, 0x50, 0x81, 0x97, 0x40, 0xf9, 0x38, 0x51, 0xe8, 0x0b,
+  0x60, 0x44, 0x92, 0x8b, 0xef, 0x20, 0x4d, 0xbf, 0x4e, 0x4e, 0x60, 0x64,
+  0x27, 0xc1, 0xa9, 0x15, 0xc0, 0xab, 0xa1, 0xa3, 0x0c, 0xd5, 0x0e, 0xca,
+  0xaf, 0xd6, 0x17, 0xd3, 0x1a, 0x39, 0x45, 0x60, 0x80, 0x2d, 0x4f, 0xfa,
+  0x29, 0x92, 0x11, 0x91, 0x4c, 0x3f, 0xdc, 0xa1, 0xc2, 0x16, 0x8b, 0x8e,
+  0x35, 0x46, 0x14, 0x38, 0x65, 0xc4, 0xf3, 0x58, 0x7c, 0xfa, 0x83, 0xeb,
+  0x71, 0x0a, 0xd9, 0x58, 0x45, 0x1a, 0x76, 0x84, 0x9e, 0x46, 0x6e, 0x77,
+  0x7c, 0xc3, 0xc2, 0x88, 0x13, 0x93, 0xcb, 0x98, 0xb9, 0xec, 0x6c, 0x25,
+  0xdd, 0xb9, 0xc8, 0x32, 0xa8, 0xb9, 0x47, 0xb0, 0x7a, 0x3e, 0xc5, 0x2a,
+  0x4a, 0xd8, 0x6e, 0x6b, 0xca, 0x00, 0xac, 0x28, 0x52, 0x7f, 0x1e, 0xae,
+  0xc2, 0x24, 0x2b, 0x3f, 0x49, 0xe5, 0x69, 0xb7, 0xb8, 0x50, 0x38, 0x29,
+  0xc5, 0x9d, 0xc0, 0xc0, 0xc5, 0x06, 0xb8, 0xb8, 0xb8, 0x92, 0x1b, 0xa0,
+  0x35, 0x33, 0x42, 0xaf, 0x24, 0x14, 0xfc, 0x68, 0x37, 0xb9, 0x0e, 0xb4,
+  0x4a, 0xa9, 0x07, 0x77, 0x5a, 0xb8, 0x88, 0xf3, 0x09, 0xa7, 0x9e, 0x54,
+  0x49, 0xbb, 0x90, 0x9e, 0xc1, 0x9d, 0x27, 0x10, 0x6a, 0xab, 0xb6, 0xa1,
+  0x53, 0x57, 0x51, 0xaa, 0xa1, 0xbb, 0x49, 0xda, 0xbb, 0xdb, 0xd0, 0xa9,
+  0x07, 0x5a, 0x55, 0x40, 0x85, 0xb3, 0xd4, 0x42, 0xae, 0xd2, 0xf3, 0x4d,
+  0xe0, 0xb1, 0x50, 0xc8, 0xa4, 0x57, 0xb9, 0x9e, 0x90, 0x2e, 0x2e, 0x86,
+  0xb9, 0xeb, 0xdd, 0xfd, 0x26, 0xfd, 0x55, 0xc0, 0x83, 0xe1, 0x83, 0x64,
+  0x64, 0xd8, 0xd2, 0x3f, 0x51, 0xc0, 0x1f, 0x1f, 0x37, 0x1d, 0x3c, 0xc0,
+  0x38, 0x2c, 0x10, 0xc0, 0x38, 0xa3, 0x3f, 0xd3, 0x70, 0xa1, 0xc1, 0xf4,
+  0xcc, 0x51, 0xfc, 0xb5, 0xa0, 0xb5, 0xed, 0xdf, 0x4f, 0x03, 0xe7, 0xc2,
+  0xee, 0x17, 0x23, 0xcd, 0x74, 0xfa, 0x2b, 0xe4, 0x0e, 0x0e, 0x3a, 0x45,
+  0x6d, 0x87, 0x32, 0x89, 0xb9, 0x26, 0xa3, 0x51, 0xff, 0xd2, 0xd2, 0x73,
+  0x52, 0x1e, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7,
+  0xf7, 0xf7, 0xf7, 0x79, 0x9a, 0xc6, 0x93, 0x3f, 0x1d, 0x84, 0x39, 0x7a,
+  0x54, 0xc1, 0x88, 0xf3, 0xe5, 0xcd, 0xdf, 0x6a, 0xc6, 0xef, 0x09, 0x7b,
+  0x46, 0x5e, 0xe8, 0x59, 0x14, 0x97, 0xc4, 0x14, 0x82, 0x8b, 0x29, 0x29,
+  0x84, 0x82, 0x95, 0x3b, 0xaa, 0x11, 0xb9, 0xf9, 0xd3, 0x1e, 0xef, 0xd2,
+  0x0e, 0x04, 0x31, 0x8a, 0x7e, 0xe1, 0xd8, 0x77, 0xb8, 0x49, 0xbe, 0x78,
+  0x6a, 0x35, 0xc4, 0x8c, 0xef, 0xc4, 0x9a, 0xce, 0xf2, 0x7e, 0x91, 0x90,
+  0x7a, 0xa0, 0xc6, 0x41, 0xe3, 0x34, 0xa8, 0xa8, 0xe1, 0xb5, 0x0b, 0xb4,
+  0xca, 0xed, 0x20, 0x15, 0x12, 0x03, 0x08, 0x0d, 0xc6, 0xed, 0x03, 0x7a,
+  0x18, 0x6e, 0x6e, 0x6e, 0x2d, 0x8f, 0x20, 0xf3, 0xb8, 0x26, 0x66, 0xe5,
+  0xa0, 0xa0, 0xe8, 0xf1, 0x53, 0xdf, 0x34, 0x0f, 0x0f, 0x12, 0xb3, 0x8f,
+  0x97, 0xc1, 0x2e, 0x34, 0x7b, 0xca, 0x51, 0xee, 0xee, 0xa6, 0x5e, 0x9a,
+  0xd8, 0xd0, 0xd1, 0x78, 0xf5, 0x2b, 0xca, 0xa7, 0xcf, 0x1e, 0x3e, 0x39,
+  0x04, 0x04, 0x2a, 0xa8, 0x2f, 0x9b, 0xdc, 0x2f, 0x8c, 0x2b, 0xb4, 0xc5,
+  0xc0, 0xc0, 0x1e, 0xf6, 0x3e, 0xc9, 0x92, 0xa4, 0xa2, 0x38, 0x0e, 0xd9,
+  0xcb, 0xd4, 0xd4, 0x61, 0xdd, 0x43, 0xf2, 0xf2, 0xdf, 0xf1, 0x43, 0xfd,
+  0xbe, 0x07, 0xa8, 0x00, 0x00, 0x31, 0x71, 0x5b, 0xe6, 0x44, 0xac, 0xac,
+  0x7f, 0x0e, 0x0e, 0xcb, 0xb1, 0xf6, 0xa6, 0x90, 0x03, 0x0d, 0x0d, 0x35,
+  0x47, 0xa2, 0x83, 0xd8, 0x38, 0x84, 0x0e, 0x0f, 0xb7, 0x85, 0xf0, 0xf0,
+  0x28, 0xee, 0xfa, 0x38, 0x97, 0x34, 0x16, 0x78, 0x5f, 0x98, 0x32, 0xc3,
+  0x56, 0x2c, 0xfe, 0xc7, 0x00, 0x35, 0x56, 0x1d, 0x8d, 0x13, 0xb5, 0x16,
+  0x7b, 0x7b, 0xf0, 0xdd, 0x2a, 0x2a, 0x02, 0x15, 0x15, 0x49, 0x8c, 0x66,
+  0xca, 0xe7, 0xe7, 0x53, 0x0a, 0x2b, 0x2b, 0x0c, 0x7d, 0xf0, 0xcb, 0xb3,
+  0x15, 0x89, 0x4a, 0x79, 0x61, 0x78, 0xc3, 0x18, 0x5d, 0x0f, 0xa9, 0xf1,
+  0xa3, 0x78, 0x00, 0x0b, 0x30, 0xe5, 0x6d, 0x2f, 0xff, 0x79, 0x03, 0xfb,
+  0xe0, 0x2e, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65,
+  0x65, 0x65, 0x65, 0xe2, 0xef, 0x15, 0x47, 0x2a, 0x3d, 0x31, 0xa9, 0x82,
+  0xe1, 0xf5, 0x68, 0xc2, 0x6d, 0xd2, 0x47, 0xa9, 0xed, 0x5e, 0xda, 0xa5,
+  0x20, 0xb3, 0x2d, 0x1e, 0x65, 0xf8, 0x90, 0x0f, 0xe3, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0xf8, 0xf8,
+  0x18, 0x18, 0xd5, 0xd5, 0x96, 0xfb, 0x82, 0xfc, 0xee, 0x47, 0x98, 0x19,
+  0x28, 0xba, 0x18, 0xeb, 0xab, 0xde, 0x9b, 0x55, 0x84, 0x7d, 0xa3, 0x0b,
+  0x05, 0x8a, 0xe3, 0xd4, 0xfd, 0x73, 0x42, 0x32, 0x2d, 0x9a, 0x19, 0x17,
+  0xf0, 0xb9, 0x5d, 0xf4, 0x15, 0x35, 0x60, 0x6f, 0xce, 0x9c, 0x83, 0x29,
+  0x59, 0x0f, 0xec, 0xb3, 0x8c, 0x40, 0xc5, 0xa6, 0x64, 0xd0, 0x11, 0xe4,
+  0xc8, 0xf5, 0xf0, 0xcb, 0x34, 0x34, 0x46, 0xce, 0x2b, 0xd1, 0x92, 0x40,
+  0xeb, 0x56, 0xb8, 0x9a, 0x89, 0x8a, 0x5b, 0x41, 0x26, 0x46, 0x5a, 0x43,
+  0xe3, 0xd0, 0x6b, 0x2f, 0x00, 0xee, 0x3a, 0xdc, 0xfd, 0x10, 0xf3, 0x15,
+  0x46, 0x64, 0x8f, 0xd0, 0x88, 0x86, 0x26, 0x36, 0xec, 0x12, 0x38, 0x3b,
+  0x87, 0x76, 0x0e, 0x14, 0x14, 0x84, 0x84, 0x18, 0x1a, 0xba, 0x4c, 0xe0,
+  0x4f, 0xc5, 0xdf, 0xbb, 0x72, 0xce, 0x8a, 0xc6, 0xc0, 0xd5, 0x2d, 0xa8,
+  0xe3, 0xb7, 0x97, 0xcc, 0xac, 0x74, 0x90, 0x90, 0xd8, 0x58, 0x7f, 0x1b,
+  0x52, 0x52, 0xcb, 0xcb, 0x34, 0x49, 0xa6, 0x74, 0x8a, 0xff, 0x26, 0x80,
+  0x8d, 0x8d, 0x7c, 0x75, 0xfc, 0x4f, 0x5a, 0x01, 0x80, 0xcb, 0x27, 0x5c,
+  0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+  0x5d, 0xe2, 0x06, 0x4f, 0x57, 0x00, 0x68, 0x69, 0x0c, 0xf0, 0x75, 0xbe,
+  0x35, 0x75, 0x05, 0x62, 0xee, 0xd4, 0x36, 0x7a, 0x90, 0xb0, 0xfa, 0xcf,
+  0x13, 0xd5, 0x8f, 0xa4, 0xcf, 0xcf, 0xae, 0xae, 0x1a, 0x6b, 0x6b, 0xf6,
+  0xfb, 0x58, 0x96, 0x14, 0x31, 0x44, 0xb5, 0xc2, 0xe1, 0x6c, 0x41, 0x18,
+  0x86, 0xd1, 0x81, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+  0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x92, 0x82,
+  0x62, 0x2a, 0xd7, 0x03, 0x58, 0xea, 0xed, 0xb6, 0x5c, 0x58, 0xba, 0x3f,
+  0x9f, 0xc8, 0x58, 0x9c, 0x07, 0xb1, 0x1c, 0x87, 0x62, 0xdf, 0x71, 0x18,
+  0x5f, 0x5f, 0xb1, 0xb1, 0xc0, 0x7d, 0x10, 0xf9, 0x01, 0x16, 0x7c, 0x00,
+  0xe4, 0xc2, 0xb3, 0x4f, 0x64, 0xf5, 0xcf, 0x6a, 0x6a, 0x88, 0x07, 0x99,
+  0xdd, 0x77, 0x36, 0x77, 0x07, 0xf1, 0x52, 0x13, 0xa7, 0x6c, 0x67, 0xb6,
+  0xbc, 0x5d, 0x7f, 0x88, 0x00, 0x80, 0xa3, 0x47, 0x56, 0xe6, 0x05, 0x41,
+  0xb1, 0x51, 0x51, 0xf5, 0x1a, 0xe2, 0x9b, 0x1e, 0xab, 0x5f, 0xd3, 0x00,
+  0x65, 0xa5, 0xcd, 0xcd, 0xab, 0x36, 0x33, 0x06, 0x0e, 0xda, 0x2d, 0xc7,
+  0x42, 0xfb, 0x85, 0x5d, 0x0e, 0xbb, 0xbb, 0xed, 0xed, 0x29, 0x29, 0x11,
+  0x11, 0xd2, 0xf7, 0xfd, 0x07, 0x49, 0x44, 0x18, 0x03, 0x4f, 0x4c, 0x81,
+  0x6d, 0x6d, 0x9f, 0xb1, 0xca, 0xea, 0x84, 0x84, 0x46, 0x43, 0x58, 0xef,
+  0xbd, 0x28, 0xeb, 0xbc, 0x36, 0x55, 0x3f, 0x3f, 0x14, 0x37, 0x2a, 0xda,
+  0x24, 0x5f, 0x43, 0xb4, 0x88, 0x5b, 0x44, 0x6e, 0xa6, 0x46, 0xc2, 0x3f,
+  0x4b, 0x4f, 0x70, 0x06, 0x69, 0x05, 0x8b, 0x95, 0x03, 0x18, 0x18, 0xb2,
+  0x8f, 0x2b, 0x5c, 0xda, 0x67, 0x0f, 0xb0, 0xff, 0xa7, 0xbf, 0x71, 0x5a,
+  0x80, 0xe4, 0xd4, 0xb4, 0x20, 0x17, 0x93, 0xea, 0xff, 0x56, 0x75, 0x94,
+  0x8b, 0x6b, 0x7e, 0x48, 0xb3, 0xfc, 0xf4, 0x80, 0xde, 0xb6, 0x15, 0x4f,
+  0x6f, 0xcf, 0xf4, 0xaa, 0x3c, 0xca, 0x25, 0x85, 0x80, 0x0c, 0x6c, 0xf5,
+  0xac, 0x15, 0xd9, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+  0x06, 0x06, 0x06, 0x06, 0x1f, 0xce, 0x7f, 0x4a, 0x32, 0x42, 0xac, 0x27,
+  0xae, 0x0b, 0xcf, 0x78, 0x2a, 0x3f, 0xe0, 0x6a, 0x7a, 0x4e, 0x13, 0x41,
+  0x37, 0xc5, 0xe2, 0xd4, 0xf2, 0x08, 0xca, 0xeb, 0x64, 0xc7, 0x51, 0x12,
+  0x96, 0x56, 0xf2, 0xaf, 0x3a, 0x3a, 0x22, 0x22, 0xda, 0x5e, 0x2f, 0x2b,
+  0x79, 0x2a, 0xcd, 0xcd, 0x5b, 0x24, 0x31, 0x0e, 0x02, 0x02, 0x57, 0x57,
+  0xf3, 0xf3, 0xcd, 0xcd, 0x5e, 0x9a, 0xd6, 0x75, 0xbb, 0x92, 0x1f, 0xc4,
+  0x46, 0x11, 0x74, 0x19, 0xbb, 0x4e, 0x53, 0x81, 0x61, 0x8e, 0x6c, 0x8d,
+  0x8d, 0xeb, 0xfb, 0xb7, 0x8d, 0x8c, 0xba, 0xf4, 0x76, 0x2f, 0x9b, 0x43,
+  0x06, 0xfe, 0x5b, 0x46, 0xde, 0x97, 0xab, 0xeb, 0x9d, 0x9d, 0x09, 0x09,
+  0x31, 0xfb, 0xe6, 0x64, 0xa7, 0x40, 0xa1, 0x15, 0xa1, 0x5d, 0x5c, 0xa4,
+  0x64, 0xd7, 0xf7, 0xbd, 0xea, 0x2c, 0x3d, 0xe2, 0x63, 0x62, 0x3e, 0x2e,
+  0x51, 0x75, 0xee, 0x00, 0x4f, 0x70, 0x06, 0x0b, 0xa9, 0x29, 0x62, 0x01,
+  0xde, 0x86, 0x60, 0x59, 0x03, 0xeb, 0xc0, 0x23, 0x47, 0xd7, 0x10, 0xd2,
+  0xd2, 0xf6, 0x50, 0x85, 0xeb, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92,
+  0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x6a, 0x8f, 0x62, 0x62, 0x16, 0x7a,
+  0x13, 0x98, 0x8f, 0xc9, 0xf3, 0xb9, 0xa9, 0xb9, 0x7b, 0x1c, 0x2b, 0xb2,
+  0xa5, 0x36, 0x39, 0xba, 0xe2, 0xd6, 0x66, 0xe0, 0x5b, 0x8d, 0x16, 0x32,
+  0x55, 0x73, 0x16, 0x82, 0xd8, 0x9a, 0x43, 0xdf, 0xad, 0x4e, 0x29, 0x60,
+  0xc4, 0x8f, 0x2c, 0x9d, 0x60, 0xf7, 0x59, 0x78, 0x7e, 0x49, 0x74, 0x0d,
+  0xf7, 0x2f, 0x61, 0xa9, 0x04, 0x4c, 0x12, 0x96, 0x5f, 0x25, 0xa9, 0x07,
+  0x6a, 0xb5, 0xb3, 0xfb, 0xe3, 0x03, 0xce, 0x2e, 0x04, 0xfa, 0x36, 0xb4,
+  0x56, 0x94, 0x49, 0xc6, 0x51, 0x07, 0x08, 0x93, 0x6e, 0x4c, 0x5d, 0xae,
+  0x73, 0xbd, 0x1a, 0x63, 0xda, 0xee, 0xfc, 0x9e, 0x3f, 0x0c, 0xc7, 0xdc,
+  0xe5, 0x55, 0x1a, 0x17, 0x2e, 0xfb, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5,
+  0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xb6, 0x0a, 0x3d, 0xc4, 0xc3,
+  0x63, 0x79, 0x80, 0x8e, 0x52, 0x9e, 0x34, 0x87, 0x5d, 0xd1, 0x69, 0x5a,
+  0xea, 0xa0, 0x70, 0x13, 0xc2, 0xea, 0x0d, 0xfb, 0x5e, 0x83, 0x8e, 0x32,
+  0xdd, 0x7d, 0xc4, 0xe7, 0x76, 0x90, 0xa9, 0xfb, 0x7a, 0xe7, 0xe7, 0xe7,
+  0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7,
+  0x8e, 0x91, 0x2c, 0xec, 0x8c, 0x35, 0x30, 0x5c, 0x9f, 0x19, 0xcd, 0xc6,
+  0x4f, 0x97, 0x83, 0x83, 0x9d, 0x48, 0xe5, 0x3d, 0x0b, 0xcf, 0xc9, 0x6f,
+  0x92, 0x96, 0xf8, 0x88, 0x0c, 0xd3, 0x9a, 0x50, 0xc7, 0x2f, 0x01, 0x1f,
+  0x3e, 0x23, 0x48, 0x93, 0xd4, 0xd7, 0x85, 0x56, 0x3d, 0xa7, 0xfe, 0x29,
+  0xe3, 0x1a, 0xb3, 0xb3, 0x01, 0x1c, 0xdf, 0x10, 0x44, 0x6e, 0x9b, 0xaf,
+  0x6e, 0x9a, 0xd4, 0xff, 0x30, 0x12, 0xf2, 0xd0, 0xcb, 0x44, 0xd6, 0x7e,
+  0x08, 0x1c, 0x01, 0xfb, 0xcd, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83,
+  0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94,
+  0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0xdb, 0xdb, 0x25, 0xdc, 0x0a,
+  0x0a, 0x6a, 0x6a, 0xcc, 0x43, 0x43, 0x3d, 0x3d, 0x7e, 0x86, 0x76, 0x01,
+  0xfd, 0x01, 0xc9, 0x3f, 0x25, 0x7f, 0x1a, 0x9e, 0x96, 0x1a, 0x6e, 0x44,
+  0x21, 0x6c, 0xaf, 0xb1, 0xf5, 0xf5, 0x9d, 0xdc, 0x35, 0x35, 0xa3, 0xa3,
+  0x44, 0x44, 0xa1, 0xa1, 0xd1, 0x1d, 0x43, 0x8a, 0x45, 0x45, 0x45, 0x45,
+  0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x92, 0xc4, 0x90,
+  0x56, 0xbb, 0xd2, 0xae, 0x7c, 0x3f, 0x74, 0x0b, 0x05, 0xcb, 0x0e, 0xeb,
+  0xf3, 0x7b, 0x21, 0x1c, 0xeb, 0x74, 0x90, 0xbd, 0x4b, 0xe9, 0x20, 0xc6,
+  0x00, 0x1a, 0x2e, 0x09, 0x0b, 0x5b, 0x10, 0x9f, 0x93, 0xd6, 0xdd, 0xe5,
+  0x4a, 0xa0, 0x41, 0x2b, 0x2b, 0x5f, 0x4e, 0xbc, 0x03, 0x03, 0x34, 0x34,
+  0x06, 0xfc, 0x39, 0x2f, 0xc3, 0xbc, 0x55, 0xdc, 0xcd, 0xa3, 0x6d, 0x5e,
+  0x52, 0x06, 0x94, 0x94, 0x21, 0x0a, 0x4b, 0xc4, 0xc4, 0x69, 0x4f, 0xa5,
+  0x7f, 0x7f, 0x13, 0x26, 0xcb, 0xa9, 0x09, 0x19, 0x5c, 0x1b, 0x18, 0xa3,
+  0x56, 0x34, 0x41, 0xf8, 0xf0, 0x90, 0x5d, 0xd7, 0xb8, 0xa0, 0xb0, 0xa3,
+  0xe1, 0xa2, 0xc1, 0x6e, 0xbc, 0x71, 0x4f, 0x33, 0x12, 0x52, 0x68, 0xda,
+  0x11, 0x01, 0xf2, 0x7b, 0x72, 0xea, 0x15, 0x4d, 0x9b, 0xb6, 0x3a, 0x97,
+  0xa5, 0xf0, 0x29, 0xcd, 0xe7, 0x47, 0x22, 0x96, 0x7a, 0x67, 0xf5, 0x2d,
+  0x4f, 0xf3, 0x55, 0x3d, 0xdb, 0xdc, 0x9d, 0xee, 0xea, 0xb7, 0x18, 0x41,
+  0xd2, 0xd4, 0x9f, 0xa1, 0x54, 0x73, 0x65, 0xd2, 0x18, 0x07, 0xf3, 0xac,
+  0xc8, 0xd2, 0x91, 0x13, 0xa0, 0x18, 0xf4, 0xf1, 0x2f, 0xbd, 0x62, 0x73,
+  0x0f, 0xdf, 0xf2, 0xc4, 0x88, 0x8a, 0x3b, 0xfe, 0xa0, 0x42, 0xea, 0x3c,
+  0xac, 0x3a, 0xa7, 0x87, 0xa0, 0xff, 0xff, 0x6e, 0x5b, 0x1e, 0x4e, 0x42,
+  0xf8, 0x33, 0x50, 0xb3, 0xfd, 0x38, 0x32, 0x38, 0xf8, 0x8f, 0x7f, 0xdf,
+  0x4b, 0x6f, 0x20, 0x0c, 0x8a, 0x74, 0x17, 0xa2, 0xc2, 0xb5, 0x70, 0x51,
+  0x93, 0x76, 0x8a, 0xba, 0xd4, 0xbc, 0xda, 0xc5, 0x23, 0x26, 0xc8, 0xe8,
+  0xac, 0x30, 0xe9, 0x27, 0xcf, 0xc6, 0x23, 0x73, 0xf1, 0x52, 0x1c, 0x26,
+  0x25, 0xb7, 0xf9, 0xa0, 0xb2, 0x70, 0x26, 0xac, 0xae, 0x7e, 0x41, 0xb3,
+  0x49, 0x4b, 0x10, 0xfa, 0x4c, 0xc0, 0xa8, 0xda, 0x92, 0x4d, 0xf2, 0xe7,
+  0xf0, 0x53, 0x4c, 0xcf, 0x52, 0x5d, 0x45, 0xaa, 0xd6, 0x05, 0x3d, 0x53,
+  0x51, 0x13, 0x7e, 0xb2, 0xfe, 0xf7, 0x2e, 0xc8, 0xd6, 0xf8, 0x88, 0x62,
+  0x3a, 0xb2, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b,
+  0x5b, 0x5b, 0x5b, 0xac, 0x35, 0xd9, 0x93, 0xa5, 0xa5, 0x15, 0xf8, 0x5f,
+  0x26, 0x6f, 0xe3, 0x4a, 0xd8, 0x8e, 0x8e, 0x57, 0x57, 0x6f, 0x6f, 0xce,
+  0xce, 0x6c, 0xc0, 0x70, 0x64, 0x4b, 0x30, 0x35, 0xff, 0x3c, 0xf7, 0x46,
+  0x4e, 0x91, 0x16, 0xa6, 0x35, 0x84, 0x8f, 0x8f, 0x37, 0xbc, 0x9b, 0xcd,
+  0x37, 0xf3, 0x26, 0xf0, 0x70, 0x6e, 0x78, 0xb2, 0x3d, 0xae, 0x0b, 0xd3,
+  0x50, 0x64, 0xa2, 0xe3, 0xc3, 0x1a, 0xa5, 0xf3, 0x78, 0xd8, 0x0d, 0x5b,
+  0x7c, 0x7c, 0xca, 0xbe, 0xa3, 0xca, 0x98, 0xdc, 0x4b, 0xb9, 0xe7, 0x6c,
+  0x6e, 0x0b, 0xd5, 0x33, 0x25, 0x86, 0xa5, 0xa5, 0xdb, 0xf4, 0xf4, 0xe9,
+  0xe9, 0xe9, 0x25, 0xeb, 0x2d, 0xa3, 0xf2, 0xdd, 0xaa, 0x6c, 0x3f, 0xef,
+  0xd4, 0xef, 0x48, 0x9a, 0xee, 0x8b, 0xa9, 0x70, 0x30, 0xf6, 0xa6, 0xf1,
+  0x05, 0x38, 0x3e, 0x45, 0xd8, 0xa6, 0xc2, 0xb8, 0x34, 0xb1, 0xcf, 0x09,
+  0x77, 0x77, 0x89, 0x5f, 0x53, 0x54, 0xf5, 0x7d, 0x4c, 0x4c, 0xff, 0xff,
+  0x92, 0x10, 0x2c, 0xdb, 0x4c, 0x79, 0xa8, 0xb6, 0x8d, 0x2d, 0xcd, 0x9d,
+  0xc3, 0xdf, 0xdf, 0x84, 0x2d, 0x1e, 0x65, 0x73, 0x6a, 0x9f, 0x77, 0x4e,
+  0x09, 0x4d, 0x4d, 0xfa, 0x07, 0xec, 0xfe, 0x6c, 0x46, 0x47, 0x5b, 0x18,
+  0x47, 0x81, 0x81, 0x59, 0x9f, 0xfb, 0xbe, 0xff, 0xd4, 0x7a, 0xd4, 0xb3,
+  0x13, 0x3b, 0x94, 0x3d, 0x87, 0x9c, 0xcb, 0x35, 0x20, 0x24, 0x2c, 0xca,
+  0xcb, 0xca, 0x53, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89,
+  0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0xee, 0x4c, 0x4c, 0x53, 0x48, 0x68,
+  0xaf, 0xfc, 0x30, 0x8d, 0x23, 0x93, 0x9c, 0xf7, 0x50, 0x9a, 0x74, 0xc3,
+  0xec, 0x8f, 0xaf, 0x97, 0x56, 0x8a, 0x73, 0xbe, 0x4a, 0x4a, 0x35, 0x5b,
+  0x49, 0x49, 0x10, 0xed, 0x93, 0x9d, 0x7a, 0x22, 0xfd, 0x93, 0x0f, 0x3d,
+  0x4e, 0x18, 0x0a, 0x34, 0x34, 0x41, 0x41, 0x50, 0x50, 0xba, 0xba, 0x75,
+  0xfe, 0xd2, 0xbf, 0xc7, 0x4b, 0x00, 0xf4, 0x2f, 0x16, 0x1f, 0xa0, 0x4e,
+  0x17, 0x4f, 0x5c, 0x06, 0xf5, 0xf5, 0x67, 0x67, 0xd0, 0x08, 0x08, 0x41,
+  0xe8, 0xe8, 0xd5, 0xb1, 0x62, 0x15, 0xdc, 0x3e, 0x24, 0x71, 0x8f, 0xfe,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0xab, 0x22, 0x22, 0x87, 0xea, 0x33, 0xce, 0x44,
+  0xd7, 0x1e, 0x33, 0x33, 0x22, 0xf8, 0x94, 0x37, 0xad, 0x62, 0x62, 0xf1,
+  0xb5, 0x11, 0xe7, 0xa9, 0xac, 0xb2, 0x5c, 0xa6, 0x26, 0xdc, 0x18, 0x82,
+  0xc8, 0x8d, 0x82, 0x96, 0x19, 0xbf, 0x6e, 0xb7, 0xde, 0xb6, 0xda, 0xdf,
+  0xde, 0xbe, 0xe0, 0xe0, 0x6f, 0x7d, 0x0d, 0x8d, 0x05, 0x99, 0x90, 0x8e,
+  0x70, 0xbd, 0x21, 0x79, 0x5a, 0xd0, 0xe1, 0x42, 0x55, 0xf4, 0xf4, 0xf4,
+  0xe9, 0xba, 0xb9, 0xb9, 0xdf, 0x9b, 0x8e, 0x32, 0xb6, 0xb6, 0xb6, 0xb6,
+  0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xd0, 0x5d, 0x5d,
+  0x0c, 0xd8, 0x76, 0x76, 0xa6, 0xef, 0x2b, 0xfd, 0x4c, 0xbc, 0xb1, 0xfc,
+  0xfc, 0x13, 0xba, 0xba, 0x17, 0x69, 0x69, 0x48, 0x54, 0x77, 0x64, 0x20,
+  0xc5, 0x01, 0x2d, 0x2d, 0x61, 0x61, 0xd9, 0x56, 0x56, 0x89, 0x8e, 0x29,
+  0xd9, 0x6a, 0xf4, 0x0c, 0x0c, 0xd4, 0x46, 0xce, 0x01, 0x5c, 0xb4, 0x22,
+  0x0a, 0xbe, 0x69, 0xec, 0x22, 0xf7, 0x81, 0x58, 0xf4, 0x4b, 0xfb, 0x24,
+  0x4e, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
+  0x4a, 0x4a, 0x9b, 0x36, 0x4b, 0x5b, 0xda, 0xb1, 0x9b, 0x7f, 0x7f, 0x67,
+  0x67, 0x6e, 0xb4, 0xd1, 0x53, 0xa0, 0x24, 0x77, 0x26, 0x31, 0x73, 0x9f,
+  0xc3, 0xc3, 0x14, 0x14, 0xbc, 0xbc, 0x2f, 0x2f, 0x23, 0x2e, 0x28, 0xe1,
+  0x97, 0x22, 0x19, 0x44, 0xea, 0x41, 0xf2, 0x7e, 0x33, 0xfc, 0xce, 0xea,
+  0xd6, 0x66, 0x0d, 0xfd, 0x85, 0x97, 0x44, 0x50, 0x83, 0x13, 0x0b, 0x0e,
+  0x38, 0x38, 0xce, 0xc1, 0x36, 0xcd, 0xe5, 0xe5, 0xbb, 0x2a, 0xae, 0x5b,
+  0xcd, 0x5e, 0x48, 0x48, 0x6c, 0x33, 0x0c, 0x32, 0xeb, 0xc6, 0x5d, 0x5d,
+  0x2e, 0xba, 0x3e, 0xa0, 0xec, 0xfb, 0xad, 0xb0, 0x7b, 0x28, 0x05, 0x05,
+  0xe1, 0x22, 0x54, 0xc8, 0x34, 0xee, 0xf5, 0x7a, 0x81, 0x02, 0x02, 0x5b,
+  0xfb, 0xdd, 0xae, 0xc9, 0xe6, 0xa8, 0x2f, 0xd7, 0x02, 0x67, 0xad, 0x67,
+  0x05, 0x20, 0xe5, 0x6e, 0xac, 0xac, 0xac, 0xc9, 0x6d, 0x93, 0xc7, 0x8c,
+  0xc0, 0x5d, 0x7b, 0x24, 0x96, 0x2b, 0x63, 0x74, 0x85, 0xf9, 0x92, 0x5a,
+  0xcd, 0x57, 0x0a, 0x7f, 0x58, 0x35, 0xa6, 0x01, 0xb5, 0x4e, 0x2c, 0x98,
+  0x31, 0x72, 0xdc, 0x58, 0x50, 0xe9, 0x83, 0x89, 0x25, 0xd1, 0xee, 0xd8,
+  0x0c, 0x7e, 0x7e, 0xf8, 0x7d, 0x71, 0xdd, 0x4c, 0xca, 0x44, 0xac, 0xac,
+  0xd1, 0xdd, 0x5b, 0x56, 0xd2, 0x5c, 0x5c, 0x59, 0x26, 0x11, 0x11, 0x02,
+  0xb0, 0xe4, 0x21, 0x28, 0xc8, 0xc9, 0x91, 0x91, 0x6a, 0xd4, 0xd4, 0x98,
+  0x8b, 0xf3, 0xc3, 0xa7, 0x48, 0x98, 0xcc, 0x5e, 0xba, 0xb9, 0xd7, 0x8f,
+  0x3d, 0xe6, 0x58, 0xcb, 0x85, 0xfe, 0xfc, 0xf1, 0xdc, 0x62, 0x40, 0x2a,
+  0x31, 0xd0, 0x06, 0x4e, 0x8f, 0x93, 0x8d, 0xe0, 0x92, 0x8e, 0x5b, 0xaa,
+  0xa0, 0x4b, 0xbe, 0x1a, 0x05, 0x00, 0xa6, 0x6d, 0xa3, 0xbb, 0x23, 0xd6,
+  0xb2, 0xed, 0xde, 0xca, 0x5f, 0x5f, 0xd3, 0x77, 0xd6, 0x87, 0x69, 0xa4,
+  0xbb, 0x2c, 0xcf, 0x2b, 0x41, 0x41, 0x99, 0x31, 0xf7, 0x4d, 0x4d, 0x1f,
+  0x95, 0x67, 0x95, 0xb8, 0x5e, 0x33, 0x33, 0xde, 0xc3, 0x28, 0x03, 0xd0,
+  0xe3, 0xe6, 0xe6, 0x70, 0x3e, 0xa6, 0xa4, 0x14, 0x4e, 0x79, 0x7d, 0x02,
+  0x78, 0x92, 0x02, 0xad, 0x14, 0x0b, 0xfa, 0x04, 0x17, 0x4a, 0xbf, 0x8b,
+  0x68, 0x91, 0xf9, 0x06, 0x07, 0xe5, 0x9f, 0x91, 0x91, 0x9d, 0x13, 0xfc,
+  0x3e, 0x67, 0x7e, 0x2d, 0xd7, 0x42, 0xe5, 0x78, 0xab, 0xf3, 0xf3, 0xbc,
+  0xbc, 0xab, 0xab, 0x76, 0x36, 0xe8, 0xc6, 0x1e, 0xa3, 0x81, 0xac, 0x91,
+  0x1f, 0xd0, 0x04, 0x09, 0xe3, 0x91, 0x2c, 0xf7, 0xf7, 0xfd, 0x8f, 0x90,
+  0x2e, 0x48, 0xfb, 0x49, 0x8d, 0x28, 0x3e, 0xe7, 0xe7, 0xd9, 0xba, 0x70,
+  0xe4, 0xe8, 0x70, 0x5d, 0x6e, 0xdf, 0xba, 0xad, 0xf3, 0x63, 0xdf, 0xa9,
+  0x07, 0x4a, 0x4a, 0xd6, 0x80, 0xb5, 0x83, 0xcf, 0x6a, 0x6d, 0xb0, 0xd6,
+  0x64, 0x56, 0xf8, 0xf8, 0x51, 0xcf, 0xd6, 0xec, 0x8f, 0x7a, 0xdd, 0xbb,
+  0xd7, 0xbd, 0xca, 0x85, 0x7d, 0x50, 0x28, 0x52, 0xa7, 0xf6, 0x81, 0x81,
+  0x81, 0x3f, 0xa5, 0x55, 0x86, 0xd9, 0xbf, 0x1f, 0xb9, 0xcb, 0x84, 0x56,
+  0xef, 0x7b, 0xa9, 0x16, 0xea, 0xe8, 0x71, 0x33, 0x1f, 0x6d, 0xdb, 0x71,
+  0x94, 0xee, 0x08, 0x7b, 0x9b, 0xf2, 0x18, 0x60, 0x21, 0x52, 0xb1, 0x26,
+  0x20, 0x76, 0x0f, 0xa7, 0xa7, 0xfe, 0x83, 0xbb, 0x10, 0xa7, 0xa7, 0xa7,
+  0x4e, 0xd4, 0x11, 0x69, 0x25, 0xf5, 0x04, 0x04, 0xec, 0xea, 0x08, 0x0e,
+  0xfc, 0xfa, 0xe2, 0x18, 0xb8, 0xaa, 0x58, 0x9e, 0x72, 0xb6, 0x12, 0x1b,
+  0xe6, 0xe6, 0x82, 0xba, 0x15, 0xac, 0xb5, 0xff, 0x01, 0x5f, 0xc4, 0x93,
+  0xaa, 0x5e, 0xdc, 0x0c, 0x0d, 0xf1, 0x1d, 0x36, 0xcf, 0xf2, 0x54, 0xc8,
+  0x8f, 0x28, 0xec, 0x23, 0xc1, 0x79, 0xad, 0xfe, 0x82, 0x82, 0x5e, 0xdb,
+  0xf7, 0xe7, 0xa4, 0x0b, 0x0c, 0xad, 0xff, 0xa4, 0xe5, 0xca, 0x64, 0xb1,
+  0x52, 0x0e, 0xa1, 0xca, 0x69, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5,
+  0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xcd, 0x86, 0x76, 0x1c, 0x9a, 0x73,
+  0x28, 0x28, 0x07, 0x35, 0x5c, 0x2e, 0xa9, 0x30, 0xbd, 0x27, 0x9b, 0x5d,
+  0xf3, 0xc9, 0xb2, 0x7f, 0xc6, 0x3b, 0x34, 0x3d, 0x3e, 0x3d, 0x1f, 0x52,
+  0x74, 0xd3, 0x7c, 0xae, 0x4e, 0xa9, 0xd2, 0x8d, 0x86, 0xa2, 0xc3, 0x2e,
+  0xf3, 0x7a, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb,
+  0xfb, 0xfb, 0xfb, 0xed, 0x52, 0x95, 0x18, 0x5b, 0x67, 0x66, 0x65, 0x7b,
+  0x9e, 0x11, 0x6c, 0x4a, 0xd0, 0x83, 0x0d, 0xd2, 0x39, 0x00, 0x4a, 0x86,
+  0xc2, 0xd5, 0xd5, 0x05, 0x53, 0x8e, 0xfa, 0x14, 0xff, 0xff, 0x7a, 0x71,
+  0xe5, 0x0f, 0x94, 0x3c, 0x96, 0x93, 0x08, 0xe0, 0x78, 0x85, 0x83, 0xa5,
+  0xe8, 0xef, 0x62, 0x18, 0x2a, 0xda, 0x84, 0xb2, 0x02, 0xbb, 0xfc, 0x42,
+  0x34, 0xfe, 0x7c, 0xbb, 0x9f, 0xc7, 0xb9, 0x63, 0x4b, 0x95, 0xa5, 0xd9,
+  0xec, 0x06, 0x26, 0x7e, 0xa3, 0x33, 0x5a, 0x54, 0x6e, 0x6e, 0xf1, 0xb1,
+  0x25, 0x25, 0x8c, 0xba, 0x5b, 0xa7, 0xa7, 0x6c, 0xb0, 0x9d, 0x89, 0x89,
+  0x04, 0x46, 0x35, 0x4e, 0x61, 0x72, 0x72, 0x87, 0x87, 0xf9, 0xf9, 0xba,
+  0xea, 0x80, 0x8f, 0x65, 0x1b, 0xc3, 0xd3, 0xa8, 0xbe, 0x65, 0x7f, 0x59,
+  0xd5, 0x2a, 0xd7, 0x6a, 0xed, 0xed, 0xf8, 0xf8, 0x3b, 0x6e, 0x72, 0xae,
+  0x25, 0xfd, 0x39, 0xf8, 0x9c, 0xbf, 0xd4, 0xc1, 0x8c, 0x7e, 0x71, 0xf8,
+  0x04, 0xae, 0xfc, 0x11, 0xf8, 0x29, 0x07, 0xd8, 0x3e, 0xcb, 0xd1, 0xba,
+  0xe1, 0xa1, 0x40, 0xbc, 0x36, 0x0a, 0xb2, 0xbc, 0xf8, 0xbd, 0x52, 0x58,
+  0xd6, 0xbb, 0x50, 0xc8, 0x13, 0xdc, 0xc7, 0xc2, 0x0f, 0x3c, 0xb2, 0x69,
+  0xa3, 0xf9, 0x44, 0xfc, 0x05, 0x55, 0x2e, 0x3c, 0x96, 0xe8, 0x57, 0x88,
+  0x49, 0x68, 0x8b, 0x8b, 0x39, 0xcc, 0xd4, 0xde, 0xbd, 0xbd, 0x43, 0x43,
+  0x72, 0x72, 0x40, 0xfc, 0xbb, 0x0b, 0xfc, 0xd3, 0xad, 0x9f, 0x9f, 0xf2,
+  0x91, 0x71, 0xe8, 0xe8, 0x9a, 0x44, 0xef, 0x4e, 0x34, 0xbc, 0x71, 0xe4,
+  0x31, 0x3d, 0x9c, 0x78, 0xba, 0x7c, 0x2e, 0x96, 0x05, 0x23, 0x6c, 0x6c,
+  0xbf, 0xe4, 0x80, 0x76, 0xf8, 0x53, 0xee, 0x7a, 0x7a, 0x8a, 0x8a, 0x45,
+  0x45, 0xb9, 0x07, 0xbe, 0x62, 0xe2, 0xc7, 0x8c, 0x3d, 0x54, 0xba, 0x33,
+  0xc3, 0x63, 0x8f, 0xc1, 0x1e, 0x96, 0x05, 0x84, 0xac, 0xa7, 0x34, 0xe4,
+  0x40, 0x8e, 0x74, 0x3b, 0x8e, 0x90, 0x6f, 0x21, 0x9b, 0xc3, 0x15, 0x71,
+  0x4f, 0x91, 0xf5, 0xf4, 0x1f, 0xc1, 0xc1, 0xb3, 0xd2, 0x86, 0xb7, 0x89,
+  0x29, 0x27, 0xc7, 0x85, 0x98, 0xe5, 0x08, 0x04, 0xae, 0x27, 0x2e, 0x88,
+  0xd1, 0x2a, 0x1c, 0xbe, 0xfc, 0xfc, 0x4a, 0x4a, 0x36, 0xeb, 0xef, 0x2c,
+  0xa6, 0x2e, 0xa4, 0x82, 0xbf, 0x1e, 0x4a, 0xac, 0xaf, 0xbf, 0xe8, 0x1d,
+  0x2a, 0xb7, 0x87, 0x87, 0x3a, 0x8d, 0xd7, 0xbf, 0xf7, 0xe4, 0x6b, 0xa2,
+  0xef, 0x69, 0x60, 0xf0, 0x7a, 0xd2, 0xd4, 0xd4, 0x6d, 0x6d, 0x1a, 0xd7,
+  0xcd, 0x32, 0xd5, 0x20, 0xff, 0x37, 0xc2, 0x47, 0x83, 0x60, 0x6f, 0xf0,
+  0x55, 0xcd, 0xff, 0x57, 0x3c, 0xcd, 0x2a, 0x89, 0xf5, 0x2b, 0x66, 0xc0,
+  0xc6, 0x4a, 0x35, 0xbd, 0x35, 0xf5, 0xc5, 0x97, 0xfd, 0x3b, 0x46, 0x5c,
+  0xb5, 0xba, 0x98, 0x8c, 0x6f, 0xbb, 0xf8, 0x83, 0x5e, 0x09, 0xe9, 0xf6,
+  0x5e, 0x0c, 0x96, 0xb6, 0x01, 0xcf, 0x03, 0x15, 0xb0, 0xef, 0x3d, 0x3d,
+  0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0xef,
+  0x14, 0x14, 0x43, 0x5d, 0x96, 0x74, 0x3d, 0x6b, 0x31, 0x13, 0xbe, 0xfe,
+  0x19, 0xc9, 0x9e, 0x87, 0xa8, 0xfd, 0x55, 0x46, 0xcc, 0xe8, 0x14, 0xd2,
+  0x80, 0x25, 0x7e, 0x82, 0x82, 0x28, 0xf8, 0x54, 0x54, 0x54, 0xc8, 0x1e,
+  0x1e, 0x29, 0xf9, 0xf9, 0xf9, 0x22, 0x4c, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8,
+  0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0x48, 0xd3, 0x6f, 0x8e,
+  0x56, 0x48, 0xf2, 0xd0, 0xd0, 0xc1, 0x24, 0x24, 0xd4, 0xf7, 0x0f, 0x4a,
+  0x59, 0x22, 0x0d, 0xd3, 0x6f, 0x10, 0xad, 0x85, 0x1d, 0x3d, 0xac, 0x4d,
+  0xfb, 0x45, 0x8a, 0xcb, 0x51, 0x34, 0x19, 0x70, 0x3f, 0x8a, 0xe7, 0x6a,
+  0xa6, 0x65, 0x53, 0x0e, 0x17, 0x0e, 0x91, 0xcd, 0x37, 0x91, 0x0c, 0xc8,
+  0xe3, 0x6f, 0x67, 0xcf, 0xba, 0x3c, 0x72, 0x78, 0xae, 0x50, 0x6c, 0xc9,
+  0x16, 0x93, 0x61, 0x18, 0x88, 0x3b, 0xdb, 0xb6, 0xa9, 0x40, 0x94, 0xb3,
+  0x65, 0x1f, 0x2d, 0x18, 0xb6, 0xbf, 0xc5, 0x67, 0xa9, 0x01, 0x98, 0x14,
+  0x9f, 0xb1, 0xa3, 0x4e, 0x2b, 0x3e, 0xbb, 0x54, 0xfa, 0x54, 0xc0, 0xea,
+  0xb0, 0x68, 0x5a, 0xdc, 0x4f, 0x5a, 0x28, 0xf5, 0xee, 0xee, 0xfb, 0xfb,
+  0x46, 0x46, 0x9e, 0xf6, 0x1e, 0x8c, 0x14, 0xf2, 0xa8, 0xf6, 0xd6, 0x3d,
+  0x3e, 0x24, 0x5f, 0x2c, 0xa1, 0x64, 0xd1, 0x77, 0x8c, 0xea, 0x56, 0xa3,
+  0xe8, 0x61, 0x71, 0x72, 0xea, 0x84, 0x40, 0xa6, 0x80, 0x5e, 0xc1, 0xb8,
+  0x9f, 0x8c, 0xb2, 0xe0, 0x5b, 0x22, 0x22, 0x30, 0x40, 0xcc, 0x64, 0x1d,
+  0x70, 0x0d, 0x64, 0xfd, 0x8d, 0x54, 0x7a, 0x93, 0x6a, 0xa6, 0xe4, 0xeb,
+  0x56, 0x84, 0x25, 0xc5, 0x50, 0xc5, 0xb0, 0xb9, 0x58, 0x58, 0x8f, 0x8f,
+  0x22, 0xe2, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+  0x30, 0x30, 0x30, 0xde, 0xde, 0xce, 0x41, 0xe2, 0x8d, 0x50, 0x4f, 0x97,
+  0x3a, 0x2b, 0xf7, 0x9f, 0x19, 0x19, 0x80, 0x20, 0xc6, 0x99, 0x3e, 0x19,
+  0xff, 0x0e, 0xc9, 0xcd, 0xac, 0x68, 0x12, 0xc1, 0x4b, 0x3b, 0xab, 0xbb,
+  0x7d, 0xc6, 0x10, 0xbd, 0xd9, 0x0e, 0xd0, 0x18, 0xd1, 0x25, 0xda, 0x6f,
+  0xc6, 0xd5, 0xd5, 0xd5, 0xba, 0x28, 0x84, 0xc8, 0x37, 0x2d, 0x3f, 0xb8,
+  0xe2, 0xed, 0x4f, 0x5c, 0x57, 0x57, 0x31, 0xfb, 0xa4, 0xc7, 0x0a, 0x9d,
+  0x45, 0xd5, 0xc5, 0x45, 0x22, 0x4e, 0x1e, 0x1c, 0x75, 0xa4, 0xb4, 0xa6,
+  0x3b, 0x4d, 0x15, 0x5a, 0x2f, 0x2f, 0x3d, 0x3d, 0x6c, 0x14, 0x4a, 0xce,
+  0xe0, 0xbe, 0x29, 0x2d, 0xb7, 0x9b, 0xf9, 0xd9, 0xa5, 0xa5, 0xef, 0xe0,
+  0x05, 0x3a, 0xe3, 0x48, 0xac, 0xb5, 0x3c, 0x09, 0xe6, 0x9a, 0x75, 0xf7,
+  0x36, 0x35, 0xb8, 0x79, 0x97, 0xf5, 0x43, 0x5f, 0xfe, 0x0f, 0x25, 0x9d,
+  0x45, 0xb7, 0x40, 0x36, 0x3f, 0xbb, 0x8f, 0x0f, 0x28, 0x28, 0x70, 0xcd,
+  0xfa, 0x5c, 0x5c, 0xce, 0x1b, 0x76, 0x11, 0x28, 0x0a, 0x02, 0x30, 0x0a,
+  0x59, 0x40, 0xdf, 0x16, 0x33, 0x4e, 0xfc, 0x9b, 0xad, 0x4f, 0xbf, 0x13,
+  0xf2, 0x02, 0x47, 0xb3, 0x86, 0x95, 0x6d, 0xe1, 0xcf, 0x73, 0x8a, 0xde,
+  0x10, 0x37, 0xed, 0xac, 0x01, 0x29, 0x7c, 0xdf, 0xb3, 0x6d, 0x1a, 0xbc,
+  0x67, 0x0a, 0xa5, 0xb1, 0x10, 0x35, 0x8c, 0x25, 0xf2, 0x91, 0xc5, 0x00,
+  0x4b, 0x76, 0x4d, 0x8b, 0xbb, 0xe4, 0xc0, 0x1f, 0x03, 0x54, 0x54, 0xf2,
+  0xf2, 0x4d, 0x4d, 0xc2, 0xc2, 0xeb, 0xb5, 0xdb, 0x18, 0xf8, 0xfc, 0xc5,
+  0x44, 0x72, 0x87, 0x01, 0x06, 0x51, 0x4f, 0x8f, 0x78, 0x78, 0x39, 0xd1,
+  0xa6, 0x52, 0xd9, 0xb4, 0x78, 0x4e, 0x9f, 0xf4, 0xb4, 0x04, 0x87, 0xf9,
+  0xf9, 0x1b, 0xb6, 0xbd, 0x9c, 0x5b, 0x5b, 0x78, 0x3e, 0x66, 0x50, 0x20,
+  0xb8, 0xb8, 0xb2, 0x80, 0x8e, 0xbb, 0x98, 0xb2, 0xca, 0xae, 0x0c, 0x57,
+  0x17, 0xd2, 0x72, 0x4d, 0xee, 0xb3, 0x9f, 0x2a, 0xf5, 0x3e, 0x31, 0xd7,
+  0x8a, 0xc2, 0x73, 0x27, 0x47, 0x9d, 0x3f, 0x9b, 0x1b, 0x33, 0x09, 0xec,
+  0xa5, 0xcf, 0x81, 0xd3, 0xa4, 0xa4, 0xa4, 0xf1, 0xc8, 0xc8, 0x57, 0x57,
+  0x0c, 0xe9, 0xbe, 0x7a, 0x47, 0x7f, 0xac, 0x23, 0x8c, 0x8b, 0x47, 0x84,
+  0xee, 0xa2, 0x59, 0xfe, 0x35, 0x1c, 0xba, 0x60, 0x9f, 0x13, 0x18, 0x62,
+  0x91, 0xf1, 0x19, 0x58, 0x7d, 0xfb, 0x50, 0x52, 0x4a, 0xa5, 0xe3, 0xc5,
+  0x98, 0xae, 0x2a, 0x5b, 0xa5, 0x3d, 0xcd, 0x10, 0x10, 0xf1, 0x85, 0xea,
+  0xc6, 0xc6, 0x5f, 0x5e, 0xd8, 0xec, 0x89, 0x6a, 0xc5, 0x31, 0x21, 0x5f,
+  0xc5, 0xb4, 0x5f, 0xfc, 0x20, 0xd4, 0x1c, 0x2b, 0x55, 0x71, 0xb1, 0xcd,
+  0xde, 0xf6, 0xfe, 0x72, 0xb7, 0x75, 0x25, 0x9b, 0xcc, 0xfe, 0x50, 0x25,
+  0x7c, 0x5a, 0x1e, 0x39, 0x54, 0xc5, 0xae, 0x19, 0xbd, 0xdf, 0xf1, 0x16,
+  0xc7, 0x8f, 0x89, 0x5a, 0x3f, 0x16, 0xf2, 0x84, 0x31, 0x31, 0x31, 0x31,
+  0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x69, 0xfd,
+  0x57, 0x1c, 0x16, 0xa9, 0xa9, 0xeb, 0xce, 0xfe, 0x75, 0x45, 0x45, 0x50,
+  0xc6, 0xa2, 0x5d, 0x17, 0x7c, 0x57, 0x96, 0x96, 0x81, 0xf5, 0x1e, 0x9d,
+  0x4f, 0x41, 0xa4, 0xa4, 0x8f, 0x91, 0x88, 0x16, 0x72, 0xb7, 0xc8, 0xcd,
+  0x74, 0x58, 0xe0, 0x12, 0x13, 0x65, 0x0b, 0xe7, 0x7e, 0xf1, 0x33, 0x34,
+  0xdc, 0x69, 0x50, 0x32, 0xe8, 0x77, 0x39, 0xc8, 0x8b, 0x93, 0xdd, 0x1d,
+  0xed, 0x7d, 0x32, 0x65, 0x5e, 0x5e, 0x2b, 0xb4, 0xec, 0xc2, 0xc2, 0x3e,
+  0xc7, 0x79, 0x09, 0x92, 0x4b, 0x5f, 0x70, 0x76, 0x91, 0x16, 0xbc, 0x48,
+  0xcd, 0x24, 0xb8, 0x91, 0x31, 0xbc, 0x2a, 0x23, 0xa6, 0x81, 0x8d, 0x60,
+  0x35, 0x35, 0xc9, 0xb7, 0xbf, 0x3d, 0x97, 0x45, 0x8c, 0xc2, 0x49, 0xe3,
+  0xe3, 0x0e, 0x66, 0xc0, 0xd5, 0x8b, 0xf4, 0x6f, 0x59, 0x32, 0x7f, 0xc9,
+  0xfc, 0x57, 0x6d, 0xc4, 0x13, 0xca, 0xce, 0x3d, 0xd3, 0x7a, 0xce, 0x9a,
+  0xfc, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf,
+  0xbf, 0xbf, 0x2e, 0xed, 0xed, 0x24, 0x7e, 0x4f, 0x0d, 0x30, 0x15, 0x15,
+  0xaf, 0xf6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
+  0xe6, 0xe6, 0xe6, 0xf8, 0x4f, 0x1f, 0x6a, 0xb7, 0x70, 0x63, 0x20, 0xee,
+  0x5a, 0xb9, 0xb9, 0xf0, 0xb6, 0x45, 0xc3, 0x47, 0x5e, 0xb4, 0x5b, 0x67,
+  0x58, 0xef, 0xa0, 0x5c, 0x4a, 0x27, 0xb0, 0xe8, 0x24, 0x35, 0x1c, 0xaa,
+  0x16, 0x4e, 0x37, 0xd4, 0x9a, 0x7d, 0x9f, 0xd1, 0xd1, 0x19, 0x24, 0x27,
+  0x77, 0x62, 0x5e, 0xb9, 0x4f, 0xc4, 0x2d, 0x6d, 0x05, 0xce, 0x2f, 0x32,
+  0x6f, 0xc9, 0xff, 0xde, 0x5a, 0x05, 0x20, 0xbb, 0x2d, 0x2c, 0x4f, 0x68,
+  0x11, 0x44, 0xb2, 0xf3, 0x1a, 0xf5, 0x42, 0x52, 0xe7, 0x7a, 0x7f, 0x61,
+  0x81, 0x83, 0x3f, 0xcb, 0xd7, 0xff, 0x09, 0x20, 0x9d, 0xc9, 0xc4, 0x6d,
+  0x89, 0xad, 0x96, 0x5f, 0x91, 0xd1, 0xfd, 0x02, 0x2f, 0xe2, 0x00, 0x64,
+  0x20, 0x31, 0x75, 0xc4, 0x28, 0x06, 0x97, 0x1d, 0x49, 0x0d, 0x7a, 0x03,
+  0x98, 0x98, 0x8e, 0x4e, 0x19, 0x49, 0x1a, 0x6d, 0x44, 0x40, 0xe4, 0x9e,
+  0xd6, 0xae, 0xa1, 0x64, 0x9f, 0x3d, 0xd6, 0x80, 0x31, 0xeb, 0xec, 0x74,
+  0x9d, 0xde, 0x6b, 0xe4, 0x05, 0xf0, 0x22, 0xeb, 0xc8, 0x35, 0x52, 0x6f,
+  0x3c, 0x65, 0x17, 0xb8, 0x0b, 0x45, 0xb8, 0xb5, 0x1f, 0x0a, 0xc6, 0xc3,
+  0x82, 0xc2, 0xdd, 0x90, 0x5f, 0x4c, 0x21, 0xd6, 0xa0, 0x13, 0x37, 0x01,
+  0x89, 0x13, 0x33, 0x8b, 0x94, 0x72, 0x92, 0x93, 0xb7, 0x95, 0x27, 0x51,
+  0xd4, 0xdd, 0x5b, 0x26, 0x74, 0x55, 0xe9, 0x3f, 0xd0, 0x6f, 0xe9, 0x16,
+  0x6c, 0x39, 0x6c, 0xe7, 0x0f, 0xa3, 0xd3, 0xd3, 0x07, 0x9d, 0x19, 0xc7,
+  0x1a, 0x1f, 0x41, 0xaf, 0x09, 0xa4, 0x74, 0x94, 0x44, 0x7e, 0x3e, 0x3f,
+  0x58, 0x5f, 0x44, 0x03, 0x47, 0x23, 0x74, 0xd1, 0x5e, 0xa6, 0xa0, 0x58,
+  0x26, 0xe7, 0x62, 0x92, 0x93, 0x49, 0x5d, 0x60, 0x07, 0x48, 0x6a, 0x4d,
+  0xaf, 0x15, 0x56, 0xab, 0xf2, 0x0c, 0x0a, 0x07, 0x46, 0x5c, 0x1a, 0xf0,
+  0x21, 0x25, 0x1d, 0x65, 0xb0, 0x9e, 0x09, 0xc5, 0xcd, 0xf1, 0xbf, 0xa5,
+  0xe1, 0xe8, 0x57, 0x79, 0xc1, 0xfb, 0x5d, 0xa8, 0x68, 0x44, 0x07, 0x5b,
+  0x33, 0x00, 0x6b, 0x03, 0xa1, 0x0b, 0xf1, 0xf1, 0xb7, 0xb7, 0xcf, 0xcf,
+  0xbc, 0x72, 0x29, 0xae, 0x71, 0xc6, 0xd2, 0xe6, 0x4a, 0x89, 0x1b, 0x03,
+  0x33, 0x7e, 0xec, 0xda, 0xd6, 0x90, 0x82, 0x42, 0x09, 0x94, 0xe0, 0x80,
+  0x31, 0xf2, 0x0e, 0xe4, 0x3d, 0xcb, 0x29, 0x52, 0x4d, 0x7a, 0x04, 0x9f,
+  0x92, 0x51, 0x17, 0x4e, 0x85, 0xa6, 0x1c, 0x39, 0x1d, 0xc9, 0x66, 0x56,
+  0xf0, 0x94, 0x18, 0xad, 0x19, 0x17, 0x74, 0x5c, 0x64, 0xbd, 0xc6, 0x08,
+  0x11, 0x02, 0x91, 0xd6, 0xbe, 0xc4, 0xf8, 0x53, 0xf6, 0x0c, 0x5e, 0x79,
+  0x7a, 0x03, 0x32, 0x10, 0xca, 0xf8, 0xf7, 0xee, 0xd0, 0x29, 0x2d, 0xef,
+  0xd3, 0xd1, 0xed, 0xa6, 0x92, 0x1f, 0x4d, 0x63, 0x7b, 0x2a, 0x9d, 0x89,
+  0xa2, 0x84, 0x5e, 0xfa, 0x48, 0x48, 0x3c, 0xc0, 0xc0, 0x56, 0xd7, 0xc7,
+  0x77, 0xff, 0x1f, 0x1d, 0xe6, 0x1b, 0x74, 0x14, 0xdc, 0x2d, 0x37, 0xcc,
+  0xab, 0x8b, 0xf9, 0x35, 0x5d, 0xe1, 0xe2, 0x2a, 0x74, 0x77, 0xdf, 0xf6,
+  0x2a, 0x7c, 0x0e, 0x03, 0x2c, 0x7b, 0xe3, 0xb2, 0x41, 0x03, 0x6b, 0xf5,
+  0x08, 0xc4, 0x90, 0xc3, 0xc3, 0x45, 0xc6, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
+  0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x06,
+  0x91, 0x0d, 0x67, 0x5e, 0xa8, 0xab, 0xab, 0xd0, 0xcf, 0x9f, 0x9f, 0x58,
+  0x5c, 0xce, 0x4e, 0xa9, 0x56, 0xc7, 0x8b, 0x9b, 0x64, 0x50, 0xbc, 0x01,
+  0xb8, 0x50, 0x4a, 0x2e, 0x25, 0x1d, 0xe2, 0xa5, 0x50, 0x9f, 0xf8, 0x9d,
+  0xea, 0x73, 0x05, 0x13, 0xa7, 0xad, 0x8e, 0xd4, 0x90, 0x7c, 0xe7, 0x8e,
+  0x8c, 0x48, 0xaf, 0xaf, 0x3a, 0x89, 0xd0, 0x86, 0x10, 0x89, 0xe6, 0xed,
+  0xfb, 0x87, 0x69, 0x0c, 0x13, 0x90, 0x07, 0x1c, 0x23, 0x2d, 0xc0, 0x63,
+  0xcb, 0x6e, 0xf7, 0xfb, 0x93, 0xb1, 0xf6, 0x21, 0x88, 0xed, 0xaa, 0x18,
+  0x44, 0x29, 0x31, 0x34, 0x70, 0xa9, 0xc9, 0xea, 0x41, 0x41, 0x79, 0x79,
+  0xe7, 0xe7, 0xa6, 0xcf, 0x38, 0x30, 0xb4, 0x3e, 0x08, 0x19, 0x86, 0x21,
+  0x78, 0x96, 0x00, 0x84, 0x84, 0x93, 0xe9, 0x74, 0x93, 0x8d, 0x8d, 0xd0,
+  0xb8, 0x48, 0x48, 0x33, 0x56, 0x56, 0x5c, 0x3f, 0x3f, 0xba, 0xba, 0x43,
+  0xdd, 0x05, 0x82, 0x9d, 0xe1, 0xa1, 0x50, 0x2d, 0xcc, 0x9c, 0xf3, 0x9a,
+  0x7d, 0x88, 0xe7, 0xc5, 0x69, 0xb6, 0xe7, 0xe4, 0x60, 0x48, 0xf0, 0x6e,
+  0x75, 0xc2, 0xec, 0xaf, 0x7c, 0xcb, 0x4c, 0x09, 0xa4, 0xa4, 0x1b, 0xee,
+  0x9e, 0x74, 0x46, 0xd9, 0x0b, 0x03, 0xa7, 0x02, 0x3a, 0x2a, 0x0b, 0xe9,
+  0xf4, 0x9f, 0x19, 0xd2, 0x5f, 0x04, 0xf1, 0x41, 0x2a, 0xa1, 0x73, 0xbe,
+  0xa0, 0x5f, 0xf5, 0x21, 0xf8, 0xb6, 0x8e, 0x44, 0x2f, 0x12, 0xdd, 0xf1,
+  0x49, 0xcf, 0x74, 0xd5, 0x67, 0x31, 0xbf, 0xa2, 0x68, 0x9a, 0xc0, 0xea,
+  0xc1, 0xe1, 0x51, 0xf7, 0x20, 0x8f, 0x34, 0x0f, 0xc0, 0x57, 0xa9, 0x73,
+  0x1e, 0x32, 0x13, 0x84, 0x1b, 0x45, 0xd3, 0x96, 0x21, 0x9b, 0xfd, 0x63,
+  0x43, 0x0a, 0xda, 0xe0, 0x44, 0x49, 0xbc, 0x3b, 0x66, 0x75, 0x49, 0x48,
+  0xe5, 0x65, 0xa7, 0xa7, 0x91, 0x95, 0x84, 0x31, 0x68, 0x05, 0x76, 0xef,
+  0x89, 0x46, 0x7e, 0x7e, 0x4a, 0xda, 0x9c, 0xdd, 0x8f, 0xea, 0x88, 0x9a,
+  0xdc, 0x15, 0xc3, 0x5a, 0x1b, 0x1b, 0x33, 0x74, 0xea, 0x0d, 0x18, 0x0d,
+  0x18, 0x9a, 0xe1, 0x22, 0xd1, 0x88, 0x66, 0x1e, 0xee, 0xf6, 0xf6, 0xd8,
+  0xd8, 0xad, 0x2d, 0xd0, 0x5d, 0xbf, 0xc8, 0x29, 0xff, 0x4b, 0x67, 0x4d,
+  0x3c, 0x7a, 0xd2, 0xd2, 0x98, 0xfd, 0xdd, 0x33, 0xfd, 0xfa, 0xe3, 0x9f,
+  0xff, 0xf9, 0x8c, 0xc4, 0xd9, 0x5c, 0xaa, 0x5c, 0x22, 0x34, 0xd8, 0x14,
+  0x02, 0x83, 0x1a, 0xb7, 0x31, 0xd6, 0x3e, 0x90, 0xd0, 0xe1, 0x85, 0xb2,
+  0xf9, 0x78, 0xf9, 0xac, 0x0e, 0x37, 0x77, 0x94, 0x68, 0x35, 0xb2, 0xa1,
+  0x02, 0xbc, 0xc0, 0x2c, 0x54, 0x54, 0xc7, 0xef, 0x30, 0xc3, 0x51, 0x33,
+  0x40, 0xb7, 0xd7, 0x96, 0x58, 0xff, 0x06, 0xda, 0xe1, 0xe1, 0xe1, 0xe1,
+  0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0x56, 0x56, 0x56,
+  0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56,
+  0x56, 0xb8, 0xb8, 0x81, 0xbe, 0x04, 0xdb, 0x6e, 0xc6, 0xae, 0xd7, 0xd2,
+  0xf5, 0xb0, 0xe0, 0x80, 0xf0, 0xbc, 0x39, 0x58, 0x63, 0x8e, 0x4f, 0xad,
+  0x70, 0x15, 0x53, 0x1d, 0x66, 0x2a, 0x2a, 0x56, 0x07, 0x07, 0xf9, 0x7c,
+  0xaf, 0xba, 0x50, 0x18, 0x82, 0xc1, 0xf9, 0x14, 0x48, 0x88, 0x10, 0x87,
+  0x87, 0x1d, 0x9c, 0x73, 0xf7, 0xea, 0x0c, 0x78, 0xdd, 0x68, 0xe0, 0xe0,
+  0x98, 0x66, 0xc2, 0xd4, 0x2c, 0xc3, 0x02, 0x86, 0x0e, 0x0e, 0xc5, 0x22,
+  0xa3, 0xe3, 0x7b, 0xaa, 0xce, 0x7a, 0x02, 0xe2, 0xc5, 0x8f, 0x7e, 0x7e,
+  0xbf, 0xbc, 0x9a, 0xd8, 0x2d, 0xd1, 0x6f, 0x7d, 0xbf, 0x0e, 0xfe, 0xa6,
+  0xa6, 0xe3, 0x28, 0x90, 0xe3, 0x6e, 0x7b, 0x32, 0x1a, 0x43, 0xab, 0x06,
+  0xf3, 0xfa, 0xb2, 0x6b, 0xde, 0xcf, 0xa7, 0xa7, 0x4a, 0xe8, 0xef, 0x4a,
+  0xab, 0xf2, 0x65, 0xcf, 0x88, 0xba, 0xbc, 0x12, 0x30, 0xd9, 0xd9, 0xd9,
+  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9,
+  0xaa, 0xd8, 0x0e, 0x2c, 0xe6, 0x2c, 0xfb, 0xcd, 0xe2, 0x44, 0x30, 0x30,
+  0xcb, 0xcb, 0x02, 0x9e, 0xef, 0xae, 0xad, 0xa3, 0xfe, 0x45, 0xd8, 0xd8,
+  0x45, 0x8f, 0x68, 0xf9, 0xc1, 0x59, 0x77, 0x17, 0x78, 0x78, 0x78, 0x78,
+  0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0xfb,
+  0xc6, 0x72, 0xa4, 0x0f, 0x9d, 0x7b, 0x33, 0xce, 0x08, 0xd2, 0x65, 0xd5,
+  0x8c, 0x8c, 0x51, 0x98, 0xc3, 0x67, 0xff, 0xd0, 0x5f, 0xc3, 0xcb, 0xe2,
+  0x0e, 0x43, 0x0b, 0x3b, 0x5c, 0x2d, 0x74, 0x42, 0x03, 0x6a, 0x41, 0x41,
+  0xb1, 0x7e, 0x91, 0xbb, 0x7a, 0x36, 0x88, 0xd6, 0x52, 0xba, 0xd0, 0x92,
+  0x2f, 0x37, 0x98, 0x48, 0x96, 0x7b, 0x7d, 0x48, 0xa3, 0x80, 0x2b, 0x54,
+  0x42, 0xa1, 0x63, 0x4f, 0x6b, 0x09, 0xb2, 0xe9, 0x8b, 0x1a, 0x9d, 0x2c,
+  0x33, 0x2f, 0xc0, 0x4e, 0xca, 0x28, 0x62, 0x9b, 0x6d, 0xd0, 0x33, 0x2e,
+  0x15, 0xec, 0x19, 0xec, 0xee, 0x21, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3,
+  0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0x04, 0xcc, 0x7e, 0x7e, 0x57,
+  0x97, 0xe2, 0x9a, 0x59, 0xfd, 0x6a, 0xa2, 0x47, 0x91, 0x76, 0x98, 0x2e,
+  0xe3, 0x15, 0xa8, 0x5c, 0xde, 0x0a, 0x0a, 0x23, 0xa6, 0xb2, 0xe5, 0x17,
+  0x82, 0xb6, 0x3c, 0x3c, 0x7f, 0x08, 0xbf, 0x4a, 0xf2, 0x52, 0xd0, 0x5e,
+  0x62, 0xc5, 0x68, 0x01, 0xf3, 0xc4, 0x6d, 0x95, 0x28, 0x70, 0x9b, 0x28,
+  0x95, 0x15, 0x1c, 0x1c, 0x6a, 0x26, 0x1c, 0xc2, 0xec, 0x55, 0x6d, 0x6d,
+  0x5a, 0xb2, 0x44, 0xc4, 0xc4, 0x2e, 0xf5, 0x28, 0xef, 0xe2, 0xc7, 0xf9,
+  0xa3, 0x06, 0x36, 0x85, 0xc4, 0xa2, 0x3e, 0x3e, 0xc1, 0x4e, 0x41, 0x49,
+  0xe5, 0x41, 0xf9, 0x17, 0x17, 0xb1, 0xb1, 0x9e, 0xa0, 0x77, 0x77, 0x71,
+  0x71, 0x85, 0x56, 0x22, 0x9f, 0xf1, 0x6d, 0xfb, 0x06, 0xd9, 0xc0, 0x07,
+  0xbd, 0x69, 0x11, 0x33, 0x89, 0x64, 0x2f, 0xd7, 0x01, 0xcf, 0x83, 0x35,
+  0x9c, 0x1d, 0x21, 0xbf, 0x2c, 0xbb, 0x9c, 0xea, 0x71, 0xda, 0x3b, 0x1f,
+  0x2e, 0x7a, 0x33, 0xef, 0x95, 0x89, 0xdc, 0xfa, 0x90, 0xaf, 0x68, 0x1a,
+  0x5d, 0x0c, 0x38, 0x5d, 0x42, 0x1c, 0xdf, 0xc6, 0x18, 0xfb, 0x32, 0x08,
+  0xce, 0x64, 0x50, 0xbb, 0x21, 0xf5, 0x7b, 0xbb, 0x42, 0xba, 0x88, 0xf7,
+  0xc6, 0xa6, 0xfd, 0xd2, 0x2d, 0x85, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
+  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x10, 0x02, 0x2c, 0x7d, 0xd9,
+  0xd3, 0x36, 0x8c, 0x29, 0xd3, 0xd0, 0xd0, 0xe3, 0xe3, 0x18, 0x24, 0x78,
+  0xc4, 0xb5, 0xb5, 0x73, 0x73, 0xac, 0x88, 0x1a, 0x1a, 0xfb, 0x83, 0xe1,
+  0x99, 0x83, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x6f, 0x70, 0xca, 0xca, 0x34, 0x0f, 0x0f,
+  0xb7, 0xff, 0x9c, 0xb8, 0x60, 0x9c, 0x30, 0x10, 0x7d, 0x19, 0xca, 0x2d,
+  0xc3, 0x78, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+  0x14, 0x14, 0x14, 0xc1, 0x0f, 0xb7, 0xd2, 0x5d, 0x3b, 0xb7, 0xc4, 0x42,
+  0x0a, 0xdb, 0xae, 0x84, 0x25, 0xa3, 0x7c, 0xa8, 0xf0, 0x71, 0x89, 0xdd,
+  0x04, 0x95, 0xc5, 0x90, 0x51, 0x7d, 0xd3, 0xcb, 0x60, 0xcc, 0xf0, 0x0c,
+  0x1a, 0xee, 0x22, 0x7f, 0xfd, 0x7f, 0x29, 0x7a, 0x74, 0x2a, 0xf7, 0xca,
+  0xca, 0xf4, 0xbb, 0x49, 0x2a, 0x35, 0x83, 0x83, 0x4d, 0x53, 0x93, 0x11,
+  0x9d, 0x68, 0x31, 0xdc, 0x0e, 0x84, 0xc2, 0xc8, 0xe6, 0x3b, 0x3b, 0x80,
+  0x80, 0x07, 0xa1, 0xa1, 0x7a, 0x6b, 0xf4, 0x6b, 0x92, 0xae, 0x17, 0xe3,
+  0x65, 0x38, 0xd0, 0x61, 0xca, 0xd6, 0x90, 0xa1, 0xea, 0xe7, 0x2f, 0x2f,
+  0xbc, 0x88, 0xef, 0xdb, 0x26, 0x71, 0x1c, 0x24, 0x76, 0xb7, 0xb8, 0x22,
+  0x46, 0xbc, 0xc0, 0xa2, 0xf9, 0xbf, 0xa8, 0xf3, 0xa6, 0xd6, 0xbc, 0xe3,
+  0x11, 0x02, 0x03, 0xcd, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6,
+  0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xa8,
+  0x49, 0x5e, 0x46, 0xd3, 0x96, 0x09, 0x51, 0xc8, 0x69, 0xe1, 0xc7, 0xdf,
+  0xa0, 0x38, 0x24, 0x4e, 0x28, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+  0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0xf9, 0x52, 0x3b, 0x39, 0xfb, 0x4f,
+  0x61, 0x63, 0x27, 0x8c, 0x25, 0xe1, 0x46, 0x9e, 0x78, 0x35, 0xbd, 0x82,
+  0xf5, 0xcc, 0x70, 0xcc, 0x84, 0xf3, 0xe7, 0x01, 0x59, 0x59, 0x2b, 0x1e,
+  0xb1, 0x5b, 0x1d, 0x95, 0x37, 0xcc, 0x3f, 0xc6, 0x6b, 0x0e, 0x41, 0x88,
+  0x25, 0x7e, 0x6f, 0x47, 0xbd, 0xd8, 0x40, 0x7e, 0xce, 0xc1, 0xc6, 0x62,
+  0xe8, 0x85, 0xf3, 0xe9, 0x98, 0x14, 0xdf, 0xa1, 0x67, 0xd9, 0x64, 0xae,
+  0xc2, 0xea, 0x47, 0x9f, 0xa4, 0x5a, 0x84, 0x75, 0x97, 0x64, 0xe9, 0x12,
+  0x11, 0x15, 0xa3, 0x22, 0x22, 0x2d, 0x24, 0x45, 0x1d, 0x56, 0x1b, 0xdf,
+  0x67, 0x79, 0x6e, 0xcf, 0xcf, 0xd1, 0x12, 0xa7, 0x58, 0xbc, 0x12, 0x12,
+  0x1d, 0xd9, 0x40, 0x40, 0x0e, 0x0e, 0x07, 0x55, 0x28, 0xf5, 0xd1, 0x55,
+  0x71, 0x78, 0xf4, 0xd8, 0xb5, 0xcd, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a,
+  0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0xf1, 0x53, 0x91, 0x91, 0xe4,
+  0xe3, 0x8b, 0xcb, 0x14, 0xb5, 0xe0, 0xf2, 0x9d, 0xec, 0xcb, 0xcb, 0xdf,
+  0x60, 0xf1, 0x24, 0x3b, 0xba, 0x57, 0x81, 0xa2, 0xca, 0xed, 0x77, 0x24,
+  0x08, 0x30, 0xdd, 0xeb, 0x67, 0xce, 0x47, 0xc4, 0xb1, 0x89, 0x66, 0x8c,
+  0x49, 0x02, 0xf9, 0x48, 0x4e, 0x42, 0xd0, 0xeb, 0xd4, 0x96, 0x11, 0xf1,
+  0xb3, 0x5f, 0x6e, 0x65, 0x97, 0x3e, 0x86, 0x50, 0xaa, 0xb7, 0x3e, 0x8a,
+  0x97, 0x30, 0xdd, 0x7a, 0xad, 0x58, 0x2e, 0x6b, 0xc5, 0xe6, 0xe6, 0xb0,
+  0xc2, 0xa4, 0xaa, 0xc6, 0x4c, 0xcb, 0x16, 0x50, 0xf9, 0x3e, 0x65, 0x22,
+  0x06, 0xf4, 0x83, 0xa0, 0x6a, 0x93, 0x6a, 0x7a, 0xe6, 0xfa, 0x09, 0x23,
+  0xd9, 0x4f, 0x30, 0x56, 0x3a, 0x2c, 0x11, 0xbe, 0x6a, 0x10, 0x8c, 0xfb,
+  0x6c, 0x14, 0x35, 0xc7, 0xb6, 0x80, 0x82, 0x6d, 0x30, 0x30, 0x63, 0x63,
+  0xd5, 0xac, 0x19, 0x06, 0x26, 0x8d, 0xbe, 0xca, 0x35, 0xb8, 0xb0, 0x0b,
+  0xdf, 0xbc, 0xbf, 0x4c, 0x53, 0x0e, 0x6f, 0xb7, 0xc5, 0x56, 0xb7, 0x67,
+  0xe2, 0x20, 0x9e, 0xcd, 0x72, 0x2c, 0xc4, 0x95, 0x41, 0x44, 0x44, 0x5b,
+  0x5b, 0x5e, 0x46, 0xf8, 0x22, 0x6d, 0x65, 0xb2, 0x57, 0xbc, 0x26, 0x48,
+  0xac, 0xac, 0x3e, 0x54, 0xb1, 0x70, 0x22, 0x9e, 0xd8, 0xd4, 0x12, 0x8b,
+  0xf8, 0x90, 0xc8, 0x6d, 0xbd, 0x79, 0x70, 0xd4, 0x95, 0x3e, 0xc9, 0x7b,
+  0x03, 0xf1, 0x00, 0x6c, 0xb3, 0x24, 0xb4, 0xf5, 0x6f, 0x79, 0x65, 0x18,
+  0xee, 0x13, 0xab, 0x9e, 0x30, 0x18, 0x8f, 0xe1, 0xbe, 0x96, 0x2f, 0xeb,
+  0xf9, 0x24, 0xc5, 0x26, 0x6a, 0x54, 0x54, 0x11, 0x0d, 0x8c, 0x69, 0x21,
+  0xf3, 0x53, 0x11, 0xda, 0xe2, 0x92, 0x75, 0x6f, 0x95, 0x31, 0x5b, 0xbe,
+  0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf,
+  0xaf, 0x02, 0x02, 0x0a, 0xbb, 0x77, 0x6c, 0xe3, 0x36, 0x8d, 0xa8, 0x78,
+  0x88, 0x63, 0x5f, 0x4e, 0x41, 0x61, 0x79, 0x79, 0x4c, 0xdb, 0x56, 0x23,
+  0x3c, 0x00, 0x76, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d,
+  0x8d, 0x8d, 0x8d, 0x8d, 0x17, 0x6d, 0x66, 0x31, 0x14, 0x2a, 0x8d, 0xea,
+  0xa8, 0x5e, 0x31, 0x55, 0xf6, 0x95, 0xea, 0x52, 0x26, 0x39, 0x5e, 0xad,
+  0xfc, 0xea, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
+  0x68, 0x68, 0x68, 0xba, 0xde, 0x80, 0xfc, 0xf8, 0x83, 0x6c, 0xfb, 0x95,
+  0x44, 0x44, 0xdc, 0x90, 0xc0, 0x27, 0x2a, 0x43, 0x12, 0x31, 0xdb, 0x35,
+  0x35, 0xd2, 0x9f, 0x5d, 0x7c, 0xb0, 0xd4, 0x5d, 0x94, 0x62, 0xfb, 0xe7,
+  0xb5, 0x8d, 0x2c, 0x63, 0x63, 0x84, 0xa0, 0xa8, 0x8b, 0xf7, 0xe7, 0x32,
+  0xc3, 0x24, 0xcf, 0x80, 0x3e, 0xf4, 0xf4, 0x74, 0xe4, 0x31, 0xb3, 0xb5,
+  0x4d, 0xf0, 0x73, 0xda, 0x09, 0x0a, 0x48, 0x9f, 0xf2, 0x6c, 0x4d, 0x4d,
+  0x7a, 0x7a, 0x7d, 0x7d, 0x65, 0x65, 0x61, 0xd4, 0x18, 0xc7, 0xfa, 0xba,
+  0x48, 0x7f, 0x86, 0x07, 0x4c, 0xb4, 0xb1, 0x7e, 0x4c, 0x39, 0x39, 0x46,
+  0x8a, 0x8a, 0x19, 0xbb, 0xcc, 0x21, 0x06, 0xcf, 0x2b, 0x2b, 0xc7, 0x34,
+  0x5c, 0x50, 0x4b, 0xb2, 0x36, 0xc0, 0x51, 0xa4, 0xea, 0xd1, 0x72, 0x48,
+  0xcb, 0x50, 0x5e, 0x04, 0x3f, 0xc0, 0x63, 0x63, 0x71, 0x55, 0x7b, 0x04,
+  0x5c, 0x70, 0xea, 0xab, 0x2d, 0xad, 0x0a, 0xc7, 0xd2, 0xcd, 0x45, 0x0a,
+  0x31, 0x18, 0x67, 0x03, 0x6e, 0x6d, 0x07, 0xa1, 0x7a, 0x6e, 0xc8, 0x35,
+  0xda, 0xbe, 0x4a, 0x1e, 0xde, 0xf6, 0x83, 0xf0, 0x27, 0x1b, 0x55, 0xb0,
+  0x55, 0xcf, 0x5f, 0xfb, 0x99, 0x52, 0xe9, 0xe9, 0xe6, 0x02, 0x08, 0x45,
+  0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f,
+  0x8f, 0x21, 0x8b, 0x2a, 0x31, 0x50, 0x95, 0xf0, 0x85, 0x05, 0x0c, 0xa1,
+  0x7a, 0xe3, 0x35, 0xce, 0xc8, 0x9d, 0x61, 0x76, 0xa5, 0x4f, 0x4f, 0xdd,
+  0xea, 0x1e, 0xf2, 0x8c, 0x32, 0x59, 0xfa, 0x7d, 0x1f, 0xa3, 0xb8, 0x71,
+  0xde, 0xf2, 0xf2, 0x4f, 0xc8, 0x79, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+  0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xf6, 0x64, 0x37, 0x2a, 0xd1,
+  0x02, 0x2a, 0xc5, 0x4e, 0xc0, 0x2a, 0x6d, 0x29, 0x29, 0x29, 0x29, 0x29,
+  0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0xfa, 0x2e, 0xf4, 0xc8,
+  0x85, 0xdd, 0xf8, 0xf4, 0x7b, 0x13, 0x13, 0x8c, 0xa3, 0x76, 0xd5, 0xe9,
+  0x35, 0xdc, 0xb1, 0xd3, 0x81, 0xb1, 0x0d, 0xfd, 0xc0, 0x98, 0xd7, 0xca,
+  0x0f, 0xf1, 0x23, 0x07, 0xab, 0xe9, 0x03, 0xb6, 0x3e, 0xb4, 0x59, 0x10,
+  0xc8, 0x53, 0x93, 0x9f, 0x02, 0xff, 0xff, 0xa6, 0x20, 0xc8, 0x78, 0x7c,
+  0x63, 0x53, 0x50, 0xeb, 0xea, 0x14, 0x34, 0xe7, 0xa1, 0xe9, 0x10, 0xaf,
+  0x65, 0x8e, 0x5f, 0x03, 0x0c, 0x3c, 0xc5, 0xe7, 0xb4, 0x26, 0xa0, 0xd5,
+  0x0a, 0xfa, 0x71, 0xea, 0xfb, 0x10, 0xcd, 0x58, 0xfe, 0x97, 0xf6, 0x84,
+  0xad, 0x05, 0x70, 0x8d, 0xeb, 0xeb, 0x43, 0xf5, 0xa4, 0x82, 0xf5, 0xb0,
+  0x28, 0x70, 0x3a, 0xa5, 0xd3, 0xcd, 0xb6, 0x27, 0x44, 0xb7, 0x0a, 0x8f,
+  0x1b, 0xf2, 0xb0, 0xa5, 0x27, 0x71, 0x65, 0x79, 0x79, 0xbe, 0x31, 0xc1,
+  0x6d, 0x4f, 0xf5, 0x19, 0x96, 0xa6, 0x0a, 0x9c, 0xf1, 0x28, 0xc3, 0xe9,
+  0xfe, 0x78, 0x5c, 0x01, 0x91, 0xf2, 0x9b, 0x8f, 0x6e, 0xed, 0x22, 0x2a,
+  0x23, 0x8f, 0x5e, 0x3f, 0x46, 0x39, 0x26, 0xcc, 0xe9, 0x87, 0x87, 0x6e,
+  0xc3, 0x62, 0x7a, 0x24, 0x1a, 0x00, 0xbc, 0xa2, 0x46, 0x76, 0xe6, 0x61,
+  0x78, 0x41, 0xcb, 0xd5, 0xef, 0x5d, 0x13, 0xd1, 0x85, 0xc6, 0xf7, 0xab,
+  0x63, 0x6a, 0x87, 0x87, 0x3e, 0x4d, 0x03, 0x72, 0x98, 0xe1, 0xb6, 0xb6,
+  0x2c, 0x1d, 0xd4, 0xd5, 0xcd, 0x60, 0x9c, 0x25, 0x67, 0x92, 0x37, 0xe2,
+  0x12, 0x91, 0xd6, 0xd3, 0x9a, 0x81, 0x7c, 0x20, 0x91, 0xfa, 0x75, 0xd1,
+  0xa9, 0xe4, 0x64, 0x50, 0x03, 0x43, 0x33, 0x98, 0x1d, 0x5a, 0xda, 0x6c,
+  0x79, 0x1c, 0x42, 0x6b, 0x95, 0x29, 0xf7, 0xb7, 0x4d, 0x37, 0x16, 0xa7,
+  0x88, 0x47, 0x7c, 0xd2, 0x71, 0xab, 0x8a, 0x99, 0xdc, 0x95, 0xd1, 0x30,
+  0x7d, 0x7f, 0x36, 0x25, 0xc5, 0x0a, 0x23, 0xac, 0x53, 0x81, 0x42, 0x0c,
+  0xe8, 0xaa, 0x0b, 0x45, 0x76, 0xda, 0xdd, 0xc9, 0xda, 0x9a, 0xaf, 0xaf,
+  0x0f, 0x11, 0xff, 0x26, 0x0f, 0x68, 0x51, 0x98, 0x83, 0xe2, 0xa3, 0x40,
+  0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
+  0x2f, 0x4d, 0xc9, 0xc9, 0x89, 0x89, 0xaa, 0x95, 0x26, 0xa4, 0xab, 0x79,
+  0xe0, 0xa9, 0x19, 0xb6, 0x26, 0x25, 0x30, 0x3b, 0x97, 0x4e, 0x25, 0xf2,
+  0x0f, 0xd4, 0x7e, 0x02, 0x1b, 0xf3, 0x13, 0xba, 0x32, 0xfc, 0x73, 0x2b,
+  0xb6, 0xa3, 0xd8, 0x4a, 0x95, 0x0e, 0xcd, 0x34, 0x60, 0x74, 0x71, 0xcc,
+  0xed, 0x1b, 0xd5, 0xe8, 0x85, 0x42, 0x1a, 0xfd, 0xe7, 0xe8, 0x96, 0xd4,
+  0x78, 0x82, 0xda, 0x28, 0x13, 0x44, 0x3d, 0x07, 0xb5, 0x30, 0xb8, 0xd4,
+  0x01, 0xfd, 0xf7, 0x7b, 0xf3, 0xf7, 0x05, 0x94, 0xc1, 0x9e, 0x2d, 0xf1,
+  0xbf, 0xe6, 0xcc, 0xc9, 0x7b, 0xf9, 0x9c, 0xad, 0xb0, 0x10, 0x46, 0xf4,
+  0xbf, 0xa5, 0x7f, 0xee, 0x64, 0xf6, 0xa1, 0xed, 0xb0, 0x52, 0x2e, 0x9c,
+  0x77, 0x66, 0x26, 0xad, 0xa0, 0x4c, 0x4f, 0x36, 0xfe, 0x7d, 0xe4, 0x68,
+  0x15, 0x1d, 0x0d, 0x0d, 0x75, 0x4e, 0xcf, 0x5a, 0x19, 0x7b, 0x11, 0x77,
+  0x10, 0xe9, 0xfa, 0xf7, 0x36, 0xdb, 0x5b, 0xb0, 0xab, 0x8f, 0x73, 0x7a,
+  0x7f, 0xf4, 0x19, 0xfe, 0x0b, 0x3e, 0x2e, 0xb7, 0x65, 0x4c, 0x61, 0x52,
+  0x4c, 0x0f, 0x32, 0x60, 0xb9, 0x10, 0x0f, 0x75, 0x9f, 0x5a, 0x76, 0x41,
+  0xd5, 0x8c, 0xd5, 0x91, 0x11, 0x0f, 0x71, 0xd5, 0x19, 0x18, 0x8d, 0xe0,
+  0x0e, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc,
+  0xfc, 0xfc, 0xfc, 0xfc, 0x8a, 0xc2, 0x2c, 0xe1, 0xd1, 0x21, 0x4b, 0x4a,
+  0x17, 0xe4, 0xa7, 0x8a, 0xa7, 0x5a, 0xa6, 0x5c, 0x5c, 0xb3, 0xb3, 0x85,
+  0xbc, 0x4f, 0x4f, 0x01, 0xc0, 0x67, 0x77, 0x1e, 0xce, 0x74, 0x16, 0x3f,
+  0x11, 0x9b, 0xd9, 0xf3, 0x1e, 0x46, 0x72, 0xb8, 0x6f, 0xd7, 0xe7, 0x1b,
+  0x0f, 0x01, 0x44, 0x46, 0xf7, 0x04, 0x7d, 0x61, 0x61, 0x67, 0x12, 0x03,
+  0xe9, 0xf6, 0xc1, 0xc1, 0xd6, 0x9b, 0x7f, 0x73, 0x73, 0xe1, 0x35, 0x98,
+  0x98, 0xd8, 0x5d, 0x1d, 0x1f, 0x2a, 0xd2, 0x10, 0xe6, 0x06, 0x2b, 0xc2,
+  0x6a, 0x13, 0xf4, 0x22, 0xde, 0x0d, 0xc5, 0xee, 0x17, 0xf8, 0x08, 0xd9,
+  0x88, 0x93, 0x80, 0x78, 0xb3, 0x63, 0xf9, 0xc4, 0xed, 0x1c, 0x2a, 0xf1,
+  0xb0, 0x73, 0x61, 0x6d, 0x00, 0x91, 0xb6, 0x59, 0xaf, 0x73, 0x65, 0xde,
+  0x4b, 0xd0, 0xd6, 0x7b, 0x70, 0xa7, 0x09, 0xfe, 0xc3, 0x76, 0x8c, 0xc3,
+  0xc3, 0x3c, 0xbd, 0xbf, 0xe8, 0xad, 0xb9, 0x44, 0x8c, 0x26, 0x78, 0x26,
+  0xd6, 0x7f, 0x41, 0x8c, 0x23, 0xc3, 0x71, 0x24, 0xde, 0x39, 0xfa, 0xd2,
+  0x6c, 0x66, 0x4e, 0x1b, 0xe9, 0x8e, 0x52, 0x93, 0x56, 0x3c, 0x80, 0xf1,
+  0xdd, 0xd3, 0xeb, 0x82, 0xad, 0xe8, 0x63, 0xbd, 0x27, 0x75, 0x92, 0xc4,
+  0xca, 0xcf, 0xca, 0x69, 0xb1, 0x51, 0x2f, 0x5c, 0xd8, 0x83, 0x69, 0xe6,
+  0x9d, 0x33, 0x40, 0x7e, 0x18, 0x00, 0x06, 0xc9, 0x7c, 0xa0, 0xe2, 0x4d,
+  0xef, 0xa7, 0x06, 0xd1, 0x9e, 0xb5, 0x1a, 0xc6, 0x3a, 0x03, 0xdb, 0xb6,
+  0x2a, 0x3d, 0x81, 0x34, 0xe5, 0x50, 0x4f, 0xfb, 0x82, 0xa1, 0xdb, 0x22,
+  0xff, 0xca, 0x46, 0x20, 0xdf, 0xf5, 0x27, 0x4d, 0xdf, 0xd9, 0x31, 0x9d,
+  0xef, 0xef, 0x93, 0xd1, 0x66, 0x74, 0x74, 0x4d, 0x0d, 0xf8, 0x64, 0x87,
+  0x0e, 0x4d, 0xc3, 0x56, 0xbe, 0x1e, 0x72, 0xe3, 0x92, 0xd3, 0xcb, 0xd2,
+  0x0c, 0x46, 0x1b, 0x0c, 0xd3, 0x73, 0xf9, 0xf9, 0x74, 0x24, 0x59, 0x09,
+  0xaa, 0xeb, 0xcd, 0xb7, 0x19, 0xf3, 0x2e, 0x72, 0x49, 0xb4, 0xe1, 0xe1,
+  0xd0, 0x11, 0x11, 0x78, 0x1f, 0x3c, 0xa6, 0x1d, 0x13, 0xfc, 0xb4, 0x87,
+  0xa4, 0x9e, 0xd0, 0xa4, 0xb2, 0xca, 0x5c, 0x2f, 0x61, 0xe8, 0xe8, 0xe8,
+  0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xac, 0x2c,
+  0x2c, 0x9b, 0xdb, 0xfd, 0x56, 0x09, 0xdb, 0x48, 0x39, 0x9c, 0x25, 0x0a,
+  0xee, 0xee, 0x15, 0xfb, 0xc8, 0x3f, 0x1c, 0x0a, 0xee, 0x33, 0x85, 0x55,
+  0x98, 0x2e, 0x93, 0x89, 0x1f, 0x1b, 0x1e, 0xa2, 0x75, 0x5d, 0xd0, 0x33,
+  0x81, 0xf4, 0x11, 0x5a, 0x89, 0x0d, 0x5d, 0xc8, 0x2d, 0xa0, 0x7a, 0xdd,
+  0x0a, 0xa2, 0x02, 0x1d, 0x5f, 0x24, 0x43, 0x8b, 0xc0, 0xf4, 0x35, 0xf4,
+  0x89, 0x31, 0x97, 0x97, 0x89, 0x83, 0xdc, 0xf0, 0x4d, 0x67, 0x0e, 0x47,
+  0x9c, 0xf7, 0xe2, 0xde, 0x30, 0x24, 0x96, 0x89, 0x1a, 0x54, 0x70, 0xf2,
+  0xed, 0x5b, 0xd5, 0x83, 0x64, 0x8c, 0x66, 0x1f, 0xec, 0x67, 0xf8, 0x50,
+  0x4c, 0x53, 0x9d, 0x40, 0x9f, 0x41, 0x05, 0x4f, 0x32, 0xe2, 0xc0, 0xdf,
+  0xca, 0xd5, 0xb5, 0x18, 0x30, 0x8b, 0x48, 0x31, 0xa8, 0x80, 0x65, 0xfc,
+  0x88, 0x66, 0x09, 0xdd, 0x8e, 0x61, 0x1c, 0xf4, 0x55, 0x4c, 0x67, 0x24,
+  0x83, 0xf0, 0xf0, 0xc5, 0xae, 0x69, 0xb0, 0xfb, 0x8e, 0x50, 0x91, 0xf6,
+  0xac, 0xd6, 0x75, 0x75, 0xbd, 0x6e, 0xf2, 0x40, 0x4e, 0x30, 0x87, 0xbb,
+  0x3d, 0x9d, 0x80, 0x88, 0xe3, 0x88, 0xee, 0xba, 0xba, 0xba, 0xba, 0xba,
+  0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0x19, 0x4c, 0x4c, 0xa2,
+  0xff, 0xac, 0x1b, 0xcc, 0x01, 0x75, 0x90, 0xc2, 0xc5, 0x2c, 0x69, 0xba,
+  0xa7, 0x31, 0x33, 0x77, 0x44, 0xd9, 0xaf, 0xaf, 0x99, 0x68, 0x42, 0x81,
+  0x29, 0x59, 0x78, 0x45, 0x1e, 0x95, 0xa0, 0x41, 0xd9, 0x4d, 0x02, 0x40,
+  0xf3, 0xca, 0xb4, 0x5d, 0x60, 0xfe, 0x33, 0xc0, 0xbc, 0xfc, 0xf8, 0x20,
+  0x8f, 0x27, 0x84, 0xcf, 0x4d, 0x98, 0x43, 0x4e, 0xb9, 0xb9, 0xb5, 0xd8,
+  0x8d, 0x5b, 0x8a, 0xde, 0xce, 0xc7, 0xce, 0x59, 0x3d, 0x4f, 0x39, 0x7c,
+  0xf3, 0x0d, 0x9b, 0x6a, 0xde, 0x1b, 0xfe, 0x09, 0xc2, 0x62, 0xdc, 0xdf,
+  0xc7, 0xe1, 0x77, 0x6a, 0xb8, 0x03, 0x0e, 0x0e, 0x3f, 0xe9, 0x4c, 0xbe,
+  0x4c, 0x4c, 0xde, 0x4c, 0xb4, 0x06, 0x06, 0x13, 0x67, 0x85, 0xb4, 0x3b,
+  0x12, 0x41, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea,
+  0xea, 0xea, 0xea, 0xbe, 0x8f, 0xa1, 0xe0, 0x8f, 0xa3, 0x97, 0xb4, 0x05,
+  0xd9, 0x7f, 0x1e, 0x51, 0x93, 0xf1, 0x7f, 0x00, 0xd9, 0xed, 0xda, 0xc7,
+  0xd5, 0x08, 0x26, 0x53, 0x33, 0x4d, 0x6c, 0x10, 0x9a, 0xe7, 0x0a, 0xe7,
+  0x34, 0x96, 0xca, 0xc5, 0xa0, 0xfa, 0x20, 0xfd, 0x4c, 0x4c, 0x22, 0x22,
+  0x41, 0x3b, 0x95, 0xe7, 0x76, 0x3a, 0x03, 0xad, 0x25, 0xf9, 0xd9, 0x31,
+  0x31, 0x72, 0xb7, 0x78, 0xb6, 0x78, 0xa0, 0x64, 0x62, 0x62, 0x62, 0x62,
+  0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x88,
+  0xaa, 0x7e, 0x38, 0x8e, 0xcc, 0x62, 0xae, 0xd0, 0x0b, 0x61, 0x61, 0xab,
+  0xaf, 0xeb, 0x62, 0x64, 0xc7, 0x1d, 0xa6, 0x2b, 0x63, 0x98, 0xc3, 0x89,
+  0x1e, 0xc7, 0xc3, 0xb0, 0xbc, 0x40, 0x12, 0xf9, 0xd3, 0x63, 0xd6, 0x3d,
+  0x3f, 0x63, 0x3c, 0xae, 0xc3, 0x63, 0x64, 0x52, 0x75, 0x7d, 0x53, 0x86,
+  0xb9, 0x6e, 0x6e, 0x46, 0x0b, 0x8a, 0xcb, 0x6b, 0xcc, 0xcc, 0xcc, 0xcc,
+  0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x89,
+  0x89, 0x19, 0xc6, 0x2a, 0xf8, 0x1c, 0xbd, 0x74, 0x6f, 0xe3, 0x9f, 0x26,
+  0x56, 0xb1, 0xa1, 0x83, 0xc4, 0xe2, 0xc4, 0xb1, 0xd4, 0xd4, 0xd2, 0xe4,
+  0x7d, 0x92, 0xf5, 0xcf, 0xdd, 0x25, 0x25, 0x41, 0xac, 0xfb, 0x55, 0x77,
+  0x25, 0x03, 0x59, 0x96, 0x8e, 0xb5, 0x52, 0x5a, 0x9f, 0x09, 0x67, 0x5b,
+  0xe5, 0xc8, 0x41, 0x91, 0x2d, 0x7f, 0xaf, 0x9a, 0xb9, 0xd1, 0xad, 0x07,
+  0x38, 0x2b, 0x43, 0x46, 0xa0, 0xa0, 0xaa, 0x9a, 0x22, 0x17, 0xc8, 0x46,
+  0x81, 0x9d, 0x90, 0x38, 0xba, 0x32, 0x3a, 0x21, 0xd9, 0xcd, 0x2f, 0xcd,
+  0xbf, 0xbe, 0x47, 0xcd, 0x7b, 0x66, 0x18, 0x6e, 0xda, 0x99, 0xa8, 0x3a,
+  0x19, 0xec, 0xd1, 0x70, 0x35, 0x91, 0x96, 0x7a, 0x16, 0x77, 0xd6, 0x09,
+  0x61, 0xbe, 0xea, 0xb8, 0x98, 0x04, 0x1d, 0x94, 0x5c, 0x45, 0xec, 0x2d,
+  0x59, 0xd1, 0xab, 0x87, 0x99, 0x61, 0xc5, 0x89, 0x84, 0xbc, 0x42, 0x4b,
+  0x3c, 0xa1, 0x48, 0x4c, 0xe2, 0x04, 0xbc, 0xba, 0xaa, 0x76, 0x74, 0xee,
+  0x0d, 0x96, 0x8d, 0xab, 0x07, 0x6a, 0x94, 0x4c, 0x2f, 0xbe, 0x8d, 0xcb,
+  0x17, 0xff, 0xe4, 0xb9, 0xf8, 0x2a, 0xf5, 0x6f, 0xcd, 0x83, 0x8e, 0x1d,
+  0x14, 0x0b, 0xe7, 0x46, 0x59, 0x00, 0x8a, 0x02, 0x15, 0x7d, 0xc0, 0x49,
+  0xdf, 0xa4, 0x43, 0x85, 0xf0, 0xbd, 0x30, 0xd4, 0xca, 0x85, 0xd4, 0x85,
+  0x6a, 0x55, 0x38, 0x66, 0x91, 0xfb, 0x46, 0xc2, 0xe3, 0xd3, 0x6c, 0xc9,
+  0xc5, 0x78, 0xbf, 0x85, 0xa9, 0x93, 0x0d, 0x7d, 0x16, 0x07, 0x9d, 0x73,
+  0xd5, 0x39, 0xef, 0xa7, 0xb6, 0xd0, 0x9d, 0xf5, 0x83, 0xa9, 0xa3, 0xfd,
+  0x32, 0x23, 0xd8, 0xe6, 0xbe, 0xae, 0x56, 0x00, 0x0a, 0x43, 0xac, 0xcc,
+  0x46, 0x89, 0x2f, 0x36, 0xc9, 0x32, 0x4b, 0x10, 0xf1, 0x58, 0xee, 0xe9,
+  0xe9, 0xee, 0xa1, 0xf9, 0xb5, 0x8a, 0x40, 0x88, 0x17, 0x43, 0x93, 0xd6,
+  0xef, 0xf0, 0x0d, 0x64, 0xa7, 0x75, 0x3b, 0x99, 0x5d, 0x1d, 0xfe, 0xbf,
+  0x0d, 0x1d, 0x57, 0xe6, 0x61, 0xdf, 0x91, 0x3c, 0xfa, 0x5b, 0x24, 0x04,
+  0xb3, 0x7c, 0x7f, 0x96, 0xce, 0x21, 0xd0, 0xcc, 0xa0, 0x54, 0x97, 0x08,
+  0xde, 0xa8, 0x85, 0x8d, 0x99, 0x8d, 0x8d, 0x45, 0xf8, 0xc4, 0x9c, 0x32,
+  0xb9, 0x97, 0x45, 0x44, 0x9c, 0x2b, 0x7d, 0xf5, 0x9d, 0x70, 0xe0, 0xd3,
+  0xd3, 0x43, 0xac, 0x80, 0x37, 0x9b, 0x52, 0x12, 0x36, 0xf1, 0x38, 0xc9,
+  0xc9, 0x40, 0xa8, 0xe8, 0x22, 0x22, 0xfb, 0x6b, 0xe5, 0x46, 0x07, 0x3f,
+  0x8a, 0x89, 0x3d, 0x14, 0x43, 0x20, 0xa7, 0x1f, 0xdb, 0xb7, 0xb7, 0xbb,
+  0x7a, 0x4c, 0xa3, 0x70, 0x8f, 0xb8, 0xd1, 0x7b, 0x75, 0x18, 0x4c, 0x6e,
+  0x3f, 0x8b, 0xce, 0x2c, 0xd3, 0x34, 0x34, 0xc7, 0x6e, 0x22, 0x22, 0x5c,
+  0x5c, 0x0b, 0x2d, 0x43, 0x1e, 0xc0, 0x04, 0x4a, 0x47, 0xe9, 0x1b, 0xd5,
+  0x71, 0x71, 0x4e, 0x4c, 0x47, 0xb6, 0xa2, 0xd2, 0x52, 0x51, 0xb6, 0xd2,
+  0x74, 0xaf, 0xfe, 0x75, 0xf7, 0x58, 0x58, 0xbc, 0xfe, 0x84, 0x90, 0xdc,
+  0x7b, 0x34, 0x8c, 0x9a, 0x12, 0xb6, 0x3e, 0xe8, 0x1b, 0x6b, 0xa3, 0xa8,
+  0x4a, 0x97, 0xb3, 0xf9, 0xf9, 0x4e, 0xe3, 0x43, 0x47, 0x68, 0x58, 0x67,
+  0x6e, 0xd2, 0x17, 0x06, 0xb3, 0x9e, 0x72, 0xaa, 0x1a, 0x4b, 0x5d, 0xd8,
+  0x40, 0xa2, 0x9c, 0x4b, 0xbe, 0xde, 0x90, 0x29, 0x04, 0x04, 0x35, 0xa2,
+  0xa2, 0xec, 0xae, 0x35, 0xa9, 0x89, 0x23, 0x23, 0x06, 0x9b, 0xf7, 0xca,
+  0x52, 0x3c, 0x2c, 0x19, 0x54, 0x5b, 0x89, 0x62, 0x33, 0x25, 0xc3, 0x8a,
+  0x00, 0x2c, 0x44, 0xc0, 0xf1, 0x59, 0xf7, 0x2b, 0x87, 0xfb, 0x26, 0x3f,
+  0x2b, 0x3a, 0x30, 0xbd, 0x1f, 0x4f, 0x8a, 0xfb, 0xe1, 0x66, 0x9c, 0xf7,
+  0x61, 0x61, 0xfd, 0xc1, 0xca, 0xa4, 0x5a, 0x5a, 0x5a, 0x5a, 0x26, 0x6b,
+  0x85, 0xdc, 0xb3, 0xb5, 0x6a, 0x05, 0xa7, 0xd0, 0xb7, 0xfb, 0x69, 0xed,
+  0xdd, 0xa3, 0x0a, 0x86, 0xbc, 0xdd, 0x7c, 0x5a, 0xb6, 0xc0, 0xb3, 0x25,
+  0xb2, 0x07, 0x09, 0xab, 0xe9, 0xc1, 0xe3, 0xfd, 0x22, 0xf3, 0x92, 0x25,
+  0x13, 0x03, 0x6a, 0x71, 0x22, 0x05, 0x64, 0x72, 0x89, 0xcb, 0x7e, 0xae,
+  0x87, 0x6c, 0x09, 0x2d, 0x5c, 0x97, 0x0c, 0x90, 0x4c, 0xad, 0x8a, 0xa3,
+  0x1d, 0x08, 0xf3, 0xc8, 0xfb, 0xb7, 0x9a, 0xe9, 0xbe, 0x05, 0xdf, 0xe8,
+  0x95, 0xf7, 0x59, 0x89, 0x35, 0xb6, 0x23, 0xc6, 0xd3, 0xf3, 0x11, 0x11,
+  0x79, 0x0e, 0x1f, 0xa3, 0x64, 0x86, 0x48, 0xb6, 0xc0, 0x64, 0xad, 0x4b,
+  0x25, 0xd2, 0xb4, 0x1b, 0x7c, 0x18, 0xc7, 0xc6, 0x8e, 0x19, 0x3a, 0x3a,
+  0x60, 0xc2, 0xc3, 0xc0, 0xc7, 0x4c, 0x72, 0xa8, 0x77, 0x5e, 0xe5, 0xad,
+  0xf4, 0x01, 0x3e, 0x5c, 0xc0, 0xe9, 0x04, 0x4a, 0x4a, 0x29, 0x44, 0x1c,
+  0xcd, 0xa2, 0x90, 0x81, 0x6f, 0x16, 0x26, 0xcb, 0xfc, 0x40, 0x96, 0xf0,
+  0xb9, 0x10, 0x8d, 0x5c, 0x8d, 0x39, 0x39, 0xa3, 0xa3, 0x87, 0x87, 0x83,
+  0x83, 0x45, 0x18, 0x14, 0x74, 0x49, 0x18, 0x49, 0xc2, 0xab, 0x6c, 0x3d,
+  0x5a, 0xba, 0x72, 0x5e, 0x84, 0x49, 0x61, 0xf3, 0x40, 0xd6, 0x91, 0xdd,
+  0x33, 0xc8, 0xd6, 0x68, 0xda, 0x73, 0x5a, 0x62, 0x59, 0x3c, 0x14, 0x6b,
+  0x55, 0x04, 0x31, 0x67, 0x54, 0x37, 0x2b, 0xd4, 0xe4, 0x7f, 0x05, 0xef,
+  0x8f, 0x9a, 0x51, 0x10, 0xbf, 0x9d, 0x9c, 0x88, 0x98, 0x4e, 0x57, 0x05,
+  0x5c, 0xa7, 0x08, 0xe2, 0x29, 0x36, 0x96, 0x78, 0x40, 0x55, 0x56, 0x82,
+  0x12, 0x1d, 0xfd, 0xaf, 0x45, 0x81, 0x35, 0x6f, 0xfc, 0x53, 0x47, 0xde,
+  0x8a, 0x6c, 0xd7, 0x06, 0xed, 0x83, 0xf8, 0x64, 0x4b, 0x48, 0x2a, 0xe0,
+  0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0,
+  0xa2, 0xd4, 0x93, 0x91, 0xbe, 0x26, 0xc5, 0x23, 0x24, 0xbf, 0x35, 0xd0,
+  0x08, 0xcb, 0xbf, 0xb7, 0xa6, 0x28, 0xed, 0xd8, 0x9f, 0xd2, 0x1e, 0xe3,
+  0xf1, 0x86, 0x4e, 0x9c, 0xe8, 0x84, 0x6b, 0xee, 0x06, 0x5e, 0x2e, 0x40,
+  0xc6, 0x98, 0xdc, 0x87, 0xda, 0xa5, 0x2e, 0x8a, 0x33, 0x42, 0xba, 0x89,
+  0xe8, 0xd9, 0x90, 0x7b, 0x2d, 0x42, 0x18, 0x63, 0xb7, 0x4f, 0xd0, 0xd9,
+  0x45, 0x7f, 0x8c, 0x7f, 0x49, 0x12, 0xee, 0x39, 0xd7, 0x1b, 0x4d, 0xe7,
+  0x77, 0x26, 0x7e, 0xe7, 0x60, 0x25, 0x3b, 0xa1, 0x07, 0x92, 0x96, 0xdc,
+  0x14, 0x3c, 0xcc, 0x65, 0x4d, 0xd3, 0xd9, 0x1e, 0x4f, 0x35, 0x2b, 0x04,
+  0x5e, 0x93, 0x00, 0x38, 0xb6, 0xb6, 0x99, 0x99, 0x99, 0x0c, 0xfa, 0xfa,
+  0x03, 0x61, 0x3e, 0x3e, 0xf5, 0xd6, 0xd6, 0x11, 0x11, 0x27, 0x3d, 0xe4,
+  0x48, 0x62, 0xbc, 0x9c, 0x21, 0x4b, 0xeb, 0xf3, 0xbd, 0xce, 0x8b, 0xfa,
+  0x92, 0xe2, 0x72, 0x5b, 0xed, 0x59, 0xcf, 0x4d, 0x20, 0x7b, 0xd4, 0x33,
+  0x82, 0xff, 0x9b, 0x1e, 0x94, 0x1b, 0x2c, 0x8a, 0x94, 0xa9, 0xaf, 0x28,
+  0x49, 0x9d, 0x06, 0x36, 0xaa, 0xc7, 0x79, 0x3e, 0x02, 0x16, 0x7c, 0xc4,
+  0x74, 0x24, 0xb5, 0x14, 0x28, 0xbf, 0x3c, 0x29, 0x96, 0x90, 0xa7, 0x49,
+  0xd5, 0x36, 0xbc, 0x2e, 0x68, 0x73, 0x73, 0x59, 0x59, 0x9d, 0xae, 0xe8,
+  0x43, 0x6b, 0xcb, 0x32, 0x54, 0x3e, 0xba, 0x35, 0x29, 0x73, 0x09, 0x3f,
+  0x2d, 0x88, 0x44, 0x12, 0x39, 0x56, 0x10, 0xc2, 0xc1, 0x5d, 0x71, 0x05,
+  0x8b, 0xfe, 0x9d, 0xb3, 0xa0, 0xe6, 0xad, 0xf2, 0xce, 0xc0, 0xc0, 0x6c,
+  0x12, 0x6b, 0xa3, 0xd9, 0x6b, 0x43, 0xad, 0x8e, 0x3d, 0x05, 0x1b, 0x68,
+  0xff, 0x31, 0xd7, 0x52, 0x52, 0x91, 0x91, 0x2d, 0x2d, 0xe2, 0xe2, 0x38,
+  0x38, 0x34, 0x34, 0x86, 0xcc, 0x0a, 0x45, 0x1c, 0xf7, 0xe9, 0x26, 0x9a,
+  0xf4, 0xf3, 0x41, 0x59, 0x92, 0x38, 0x38, 0xa5, 0x68, 0x68, 0xc0, 0x2c,
+  0x9b, 0x3a, 0xf3, 0x58, 0x71, 0x79, 0x06, 0x30, 0x30, 0xf9, 0x15, 0x25,
+  0x96, 0xd4, 0xcb, 0xd5, 0xb5, 0x2a, 0xf3, 0xe7, 0x19, 0x63, 0x10, 0xc5,
+  0x67, 0x47, 0xb6, 0xe1, 0x63, 0xfc, 0x83, 0x48, 0xfd, 0x49, 0x24, 0xd4,
+  0xfb, 0x2a, 0xef, 0x30, 0xe5, 0xd4, 0xc2, 0x45, 0xa1, 0x37, 0x7a, 0x56,
+  0x7c, 0xc8, 0x16, 0xcc, 0x61, 0xad, 0xd7, 0xf2, 0xe5, 0x65, 0xa8, 0xb0,
+  0x29, 0x39, 0x70, 0xce, 0xdc, 0x1b, 0x5e, 0xce, 0xe6, 0xe9, 0x4f, 0x25,
+  0xd9, 0x18, 0x76, 0x90, 0x58, 0xbf, 0x32, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4,
+  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x44,
+  0xdd, 0xa3, 0xc9, 0x62, 0xd4, 0x78, 0x5f, 0x68, 0xe6, 0xa4, 0x92, 0x92,
+  0xee, 0xee, 0xb2, 0xb2, 0x35, 0xbc, 0x79, 0x6a, 0x6b, 0xa7, 0xc9, 0x79,
+  0x87, 0x87, 0x5f, 0xbb, 0x53, 0x97, 0xcc, 0x99, 0x99, 0xc4, 0x9e, 0x50,
+  0x11, 0xfc, 0xb7, 0xc7, 0xf1, 0xba, 0xc9, 0xe0, 0x57, 0x12, 0xc9, 0x48,
+  0x96, 0x23, 0xfd, 0x51, 0x86, 0x69, 0x0b, 0x09, 0x75, 0xc6, 0x1f, 0xc4,
+  0x1a, 0x0f, 0x9c, 0xcc, 0xcc, 0x4c, 0xb7, 0xb6, 0xb6, 0xaa, 0x83, 0x38,
+  0xa6, 0xc0, 0xed, 0xd8, 0x63, 0xa8, 0x7f, 0x57, 0xac, 0x7d, 0xcb, 0x84,
+  0x9b, 0x02, 0x7c, 0xbc, 0x56, 0x4d, 0x9e, 0xa0, 0x40, 0xcf, 0xe2, 0x7e,
+  0x0e, 0xf4, 0x8f, 0xd3, 0xae, 0x75, 0xd6, 0xef, 0xe1, 0xa2, 0x1f, 0x1f,
+  0x51, 0x9e, 0xcd, 0x6a, 0x6c, 0x87, 0xa1, 0xb4, 0x77, 0xd1, 0x0e, 0x51,
+  0xa6, 0x10, 0xe7, 0x67, 0x5d, 0x8d, 0xb9, 0xf2, 0xf2, 0xbb, 0xe6, 0xa1,
+  0xbf, 0x76, 0x18, 0xc6, 0x98, 0x98, 0xd1, 0xc1, 0xa1, 0xfb, 0x92, 0xc3,
+  0xb5, 0xd6, 0x35, 0x9e, 0x66, 0x3c, 0xdd, 0x9f, 0xd7, 0xa4, 0x53, 0xe7,
+  0x03, 0x54, 0x80, 0x32, 0xa1, 0x4a, 0x66, 0x5a, 0x8d, 0x73, 0x21, 0xe6,
+  0x0a, 0x05, 0x08, 0x27, 0x5b, 0x79, 0x98, 0xeb, 0xdf, 0x00, 0x2c, 0xa4,
+  0x20, 0xe3, 0x3c, 0xa2, 0xb4, 0xd0, 0x03, 0x13, 0xa9, 0xe6, 0xd0, 0xb4,
+  0x24, 0x4a, 0x80, 0x91, 0xbd, 0xf8, 0x10, 0x76, 0x4a, 0xac, 0xa6, 0x02,
+  0x50, 0x0f, 0x30, 0xf0, 0x5b, 0xfe, 0xcb, 0xce, 0x6d, 0xd9, 0xe7, 0xba,
+  0x9c, 0xca, 0x5a, 0x45, 0x3f, 0x94, 0x3e, 0x5e, 0xf1, 0xf4, 0x05, 0xe7,
+  0x98, 0xf7, 0x89, 0xed, 0xeb, 0x1a, 0x97, 0x51, 0x72, 0x92, 0x92, 0x73,
+  0x73, 0x50, 0xe9, 0x21, 0x10, 0xe8, 0x18, 0x26, 0x51, 0x21, 0x8f, 0xcf,
+  0x5d, 0x23, 0xa2, 0xbd, 0xf9, 0xf9, 0x14, 0x84, 0xd6, 0x50, 0x7b, 0x5b,
+  0x1d, 0xad, 0xe9, 0x63, 0x3b, 0xf5, 0x61, 0x03, 0xa3, 0xdf, 0xbd, 0xbd,
+  0xbd, 0xbd, 0xbd, 0xbd, 0xbd, 0xbd, 0xbd, 0xbd, 0xbd, 0xbd, 0xbd, 0xbd,
+  0xbd, 0xbd, 0xcd, 0x47, 0x0f, 0x1c, 0x5a, 0xbb, 0x52, 0x69, 0xc7, 0xd3,
+  0x6e, 0x40, 0x60, 0x0f, 0x5c, 0x09, 0x1f, 0xcb, 0x2a, 0x6a, 0xc8, 0xe3,
+  0xed, 0xe8, 0x03, 0xa4, 0x9a, 0x23, 0xf2, 0x3f, 0x13, 0x4b, 0x4b, 0x51,
+  0x3d, 0x3f, 0x03, 0xf0, 0x18, 0x40, 0x7c, 0x25, 0x19, 0x8d, 0x7a, 0x55,
+  0x55, 0xca, 0x50, 0xd9, 0x0e, 0x4d, 0x9d, 0xb5, 0x3a, 0xbd, 0xfb, 0x73,
+  0x15, 0xa7, 0x2f, 0xc6, 0x02, 0x9d, 0xeb, 0x02, 0x4e, 0x85, 0xb1, 0xd2,
+  0xa0, 0xb5, 0xb3, 0x8f, 0xb0, 0xf9, 0x7b, 0x7f, 0xbd, 0xe7, 0xaf, 0x9e,
+  0xd8, 0xb5, 0x3d, 0x06, 0xc9, 0x44, 0x2c, 0x83, 0xa8, 0xf5, 0x7f, 0xdb,
+  0xe8, 0x4a, 0x0a, 0xdf, 0xe4, 0xbd, 0xe5, 0x06, 0x57, 0x2f, 0x03, 0xc8,
+  0x97, 0x38, 0x5e, 0xcd, 0x17, 0x62, 0x89, 0x37, 0x62, 0x24, 0x6c, 0x49,
+  0x35, 0x81, 0xcb, 0x79, 0x38, 0x38, 0x00, 0xff, 0x4d, 0xe9, 0xe8, 0xf5,
+  0x9d, 0x38, 0x32, 0xbd, 0xd2, 0x41, 0xd4, 0x75, 0x1f, 0x56, 0x87, 0x87,
+  0xbb, 0x68, 0x5e, 0xdf, 0x84, 0x21, 0xa1, 0x6a, 0x47, 0xac, 0x23, 0x4a,
+  0xd9, 0xd1, 0x80, 0xce, 0x2d, 0x25, 0x1d, 0x24, 0x48, 0x5e, 0xdb, 0xb2,
+  0x65, 0xe6, 0x23, 0xe8, 0x73, 0x63, 0x93, 0xd6, 0x47, 0xa3, 0xd6, 0xbb,
+  0x95, 0x9f, 0x6e, 0xb4, 0xd4, 0x13, 0x37, 0x0c, 0x24, 0x91, 0xbd, 0x58,
+  0x9e, 0xc6, 0xac, 0x80, 0x8c, 0x21, 0x88, 0xd6, 0x8a, 0x05, 0xc4, 0xf0,
+  0xe5, 0xe2, 0x4f, 0xf1, 0x69, 0x61, 0x80, 0x76, 0x0a, 0x08, 0x06, 0x87,
+  0x4b, 0xdd, 0xcf, 0x1f, 0x2b, 0xba, 0x25, 0x40, 0x23, 0x85, 0xb9, 0x73,
+  0xe3, 0x58, 0x40, 0xc3, 0xcc, 0xe8, 0x35, 0xfe, 0x35, 0xe4, 0x5e, 0xf1,
+  0x47, 0xcc, 0xab, 0x61, 0xf8, 0xdc, 0x51, 0x98, 0xd0, 0x87, 0x98, 0xd1,
+  0x78, 0x8c, 0x31, 0xa0, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f,
+  0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x1e, 0x35, 0x09,
+  0x21, 0xf7, 0x91, 0x67, 0x60, 0xe6, 0x32, 0x80, 0x59, 0x54, 0x22, 0x52,
+  0xfc, 0xa5, 0x92, 0xc0, 0xbc, 0xc7, 0xf9, 0x5f, 0x0f, 0x1b, 0x0c, 0xf4,
+  0x49, 0x61, 0x4e, 0xfb, 0x92, 0x24, 0xc9, 0xc7, 0xc7, 0xc7, 0x8f, 0x8f,
+  0xf5, 0xf5, 0xbd, 0xe3, 0x6c, 0x9e, 0x80, 0xc7, 0x17, 0xdd, 0x68, 0x3e,
+  0xaf, 0x68, 0xbb, 0x16, 0x16, 0x08, 0x31, 0x59, 0x73, 0x17, 0x0d, 0xb8,
+  0x37, 0x83, 0xb7, 0xb6, 0xe2, 0x7f, 0x1a, 0xa9, 0x47, 0xe6, 0xd0, 0x30,
+  0xed, 0xc5, 0xc5, 0x0d, 0xdb, 0xd1, 0x9b, 0xbb, 0xe9, 0x2c, 0x90, 0xcc,
+  0xe5, 0x22, 0x25, 0x70, 0xe2, 0x80, 0x5d, 0x6c, 0x17, 0x17, 0x36, 0x7b,
+  0xcb, 0xab, 0xf0, 0x69, 0xbb, 0x0a, 0xb9, 0x86, 0xbf, 0xbf, 0xdb, 0xc7,
+  0x2e, 0x90, 0x97, 0xd4, 0xd7, 0x15, 0xd3, 0x2b, 0x2e, 0x8a, 0x97, 0xa7,
+  0x35, 0xc4, 0xfe, 0xac, 0xb6, 0xb4, 0xa0, 0xa0, 0x5a, 0xcb, 0x26, 0x62,
+  0x40, 0x03, 0x5d, 0x41, 0x5d, 0x67, 0x3b, 0x44, 0xcc, 0x90, 0xe1, 0xc3,
+  0x75, 0xa3, 0x79, 0x0e, 0x55, 0x9b, 0x7c, 0xd2, 0xf1, 0xf3, 0xf6, 0xcd,
+  0x91, 0xfc, 0x39, 0xba, 0x3f, 0x78, 0x60, 0x37, 0x93, 0xcc, 0xcc, 0xcc,
+  0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xe6, 0xe7,
+  0xe7, 0xf6, 0x15, 0x03, 0x22, 0xa9, 0x4a, 0x4e, 0xf5, 0x45, 0xb7, 0x14,
+  0xd6, 0x0f, 0xb5, 0xe9, 0x10, 0xee, 0x67, 0x61, 0x7f, 0x5f, 0x7b, 0xfb,
+  0xa3, 0x0e, 0x5a, 0x4e, 0x4d, 0xb3, 0x0b, 0x4c, 0xf8, 0xac, 0x5e, 0xbb,
+  0x28, 0x52, 0xf2, 0x3c, 0x33, 0x9b, 0x2a, 0xdc, 0xd2, 0x23, 0x8e, 0xb4,
+  0xb8, 0xc5, 0x59, 0xc5, 0xb2, 0x92, 0x70, 0x90, 0x6b, 0x32, 0x6f, 0x61,
+  0x69, 0xa6, 0xe3, 0xb9, 0xab, 0xd1, 0x46, 0xda, 0xc9, 0x1f, 0x32, 0x04,
+  0x63, 0xbf, 0xc1, 0x20, 0xdb, 0xb7, 0x67, 0xf8, 0x5e, 0x47, 0xe6, 0xd9,
+  0x44, 0x18, 0x89, 0x9b, 0x43, 0x18, 0xa6, 0xb3, 0x65, 0xf9, 0x94, 0x3e,
+  0x53, 0x1a, 0x06, 0x6e, 0x6f, 0x5f, 0x2b, 0xe3, 0x06, 0x4f, 0x68, 0x03,
+  0x36, 0x1f, 0x73, 0x98, 0xeb, 0xfe, 0x83, 0x1d, 0xf8, 0x1d, 0xae, 0x82,
+  0xde, 0xfc, 0xc4, 0x65, 0xa9, 0x0d, 0xf9, 0x9c, 0xaa, 0xed, 0xe8, 0x0f,
+  0x70, 0x0d, 0x2a, 0x5e, 0xf1, 0xcf, 0xd4, 0x6d, 0xe1, 0xf8, 0x00, 0x5c,
+  0xd3, 0x42, 0x4e, 0xec, 0xe5, 0xaf, 0x03, 0xef, 0x1d, 0x40, 0x58, 0x48,
+  0xa2, 0x95, 0x1e, 0x90, 0x90, 0x3c, 0xa1, 0x11, 0x0a, 0x11, 0x59, 0xad,
+  0x26, 0xf0, 0xbf, 0xf3, 0xf0, 0x8d, 0xfc, 0x07, 0x3c, 0xab, 0x6f, 0x3b,
+  0xdf, 0xd7, 0x69, 0xe7, 0x3c, 0xf9, 0x3b, 0xd1, 0x25, 0xae, 0xac, 0x79,
+  0x89, 0xce, 0xcd, 0x34, 0x53, 0x34, 0xe7, 0xfd, 0x17, 0xe2, 0x43, 0xa3,
+  0x8b, 0xe0, 0xe4, 0x38, 0x6c, 0xb7, 0xf5, 0xbf, 0x01, 0x21, 0xea, 0x7f,
+  0x6f, 0x95, 0xca, 0x56, 0xe3, 0x5d, 0xac, 0xcd, 0xa9, 0x61, 0xc5, 0x40,
+  0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+  0x36, 0x13, 0xe1, 0xf2, 0x61, 0x60, 0x8e, 0x6f, 0x46, 0x7a, 0xf6, 0x7c,
+  0x3b, 0xb9, 0xe2, 0x73, 0x4d, 0x4d, 0xc0, 0xa8, 0xc2, 0x12, 0x0e, 0x06,
+  0x20, 0x6e, 0x36, 0x20, 0xbb, 0xda, 0x67, 0x90, 0x3e, 0x82, 0x40, 0x93,
+  0xc1, 0xfb, 0xe6, 0x97, 0xf6, 0x5b, 0xbb, 0x5f, 0xd9, 0x7a, 0xd4, 0xb5,
+  0x9c, 0xe4, 0x94, 0xe9, 0x5d, 0x50, 0x06, 0x06, 0x34, 0x38, 0x73, 0x72,
+  0x1f, 0x5d, 0xe5, 0xac, 0xc1, 0x2c, 0x2f, 0x5d, 0xe2, 0x71, 0x18, 0x83,
+  0x13, 0xa3, 0x65, 0x3e, 0x9b, 0x81, 0x1e, 0xa3, 0xc3, 0x4e, 0x0c, 0x77,
+  0xf2, 0x2e, 0xf3, 0x2e, 0x9e, 0x06, 0xec, 0x6f, 0xe2, 0x38, 0x8a, 0xbe,
+  0x38, 0x5e, 0xaa, 0xb9, 0x5c, 0xfd, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea,
+  0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9,
+  0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4,
+  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x5a,
+  0xc8, 0xa4, 0xe0, 0xd8, 0xbe, 0xf2, 0x46, 0x20, 0x75, 0x25, 0xab, 0x67,
+  0xa8, 0xc0, 0x5c, 0x7e, 0x01, 0x12, 0x3e, 0xcb, 0x7a, 0xb3, 0x62, 0x94,
+  0x3c, 0xf6, 0x92, 0xfb, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86,
+  0x86, 0x86, 0x86, 0x86, 0x86, 0x45, 0x45, 0x9e, 0x65, 0x3f, 0x21, 0x73,
+  0xb9, 0x88, 0xe4, 0x75, 0x9b, 0x20, 0x9d, 0x66, 0x2a, 0x1b, 0xc1, 0x48,
+  0x43, 0x13, 0x8f, 0x24, 0xd8, 0x46, 0xb9, 0x8a, 0x98, 0x63, 0x7c, 0x3a,
+  0x7c, 0x19, 0x73, 0xbb, 0x54, 0xb1, 0x72, 0x56, 0x75, 0x54, 0x1d, 0x0a,
+  0x8d, 0xf4, 0xec, 0x9a, 0x5b, 0x5b, 0x9c, 0x98, 0x6d, 0xbf, 0x1a, 0x31,
+  0xd7, 0xd8, 0xd6, 0x87, 0x89, 0xf4, 0xc4, 0x71, 0xf1, 0x2f, 0x21, 0xc8,
+  0x44, 0x7f, 0x34, 0x63, 0x72, 0x22, 0xc7, 0x89, 0x0a, 0x1a, 0x66, 0xbe,
+  0x2b, 0x5a, 0x56, 0xeb, 0x50, 0x1d, 0x7f, 0x45, 0x82, 0x12, 0xbf, 0xe8,
+  0xc3, 0x47, 0xb6, 0xa0, 0xc2, 0xf9, 0x8c, 0xe9, 0x19, 0x41, 0x5e, 0x43,
+  0x3b, 0x03, 0x48, 0xe1, 0x1a, 0xcb, 0x5d, 0xce, 0x30, 0xd6, 0xce, 0x29,
+  0xa0, 0x91, 0xdf, 0x1c, 0x06, 0xe0, 0x7e, 0x8a, 0x98, 0xb3, 0x04, 0x1f,
+  0x6d, 0xa3, 0xa8, 0x82, 0x26, 0x5a, 0x42, 0x86, 0x86, 0x86, 0x86, 0x86,
+  0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x26, 0xd8, 0x77, 0xf4,
+  0xde, 0x8b, 0x9c, 0xd7, 0x55, 0xfe, 0xb4, 0xa7, 0x36, 0x69, 0x77, 0xf3,
+  0x16, 0x7a, 0xf5, 0x66, 0xde, 0x7f, 0x03, 0xff, 0xc1, 0xc1, 0xf1, 0xf1,
+  0x0b, 0xf8, 0x46, 0x98, 0xf5, 0xec, 0x9e, 0x09, 0x3e, 0xe8, 0x7b, 0xa2,
+  0xa5, 0x2b, 0x3e, 0xd5, 0x55, 0xc4, 0x93, 0xae, 0xa9, 0x38, 0xbf, 0x11,
+  0xa9, 0x3b, 0x44, 0xfb, 0xfb, 0x8a, 0x8a, 0xff, 0x83, 0x1b, 0x17, 0x75,
+  0x0d, 0x82, 0x92, 0x41, 0x05, 0x0d, 0x19, 0x11, 0xd4, 0x2f, 0x1d, 0xac,
+  0x8d, 0x8d, 0x51, 0x37, 0x1d, 0x1a, 0x38, 0x64, 0x90, 0x68, 0x43, 0x43,
+  0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+  0x43, 0x5e, 0x91, 0xda, 0xf3, 0xdf, 0xdf, 0x19, 0x19, 0x00, 0xf4, 0xd4,
+  0x22, 0x06, 0xb0, 0x71, 0x3c, 0x4c, 0x16, 0x9a, 0x93, 0x84, 0x20, 0x60,
+  0xb9, 0x6c, 0xd6, 0xe0, 0xe7, 0x34, 0x93, 0x2b, 0x58, 0x9b, 0x59, 0x45,
+  0x8e, 0x8c, 0xb0, 0xf2, 0x06, 0xf0, 0xe6, 0xae, 0x72, 0xd6, 0xd7, 0xca,
+  0x64, 0x14, 0x14, 0x43, 0xb3, 0xe0, 0x0d, 0x0d, 0xa1, 0x53, 0x90, 0x24,
+  0xbc, 0xcd, 0x51, 0xac, 0x24, 0x93, 0x0a, 0xf0, 0x4e, 0x3f, 0xbe, 0xe9,
+  0x64, 0xe8, 0x34, 0xc7, 0x5f, 0x05, 0x35, 0x41, 0xb0, 0x2a, 0x8b, 0xf3,
+  0xb3, 0x21, 0x9d, 0x4d, 0x28, 0x26, 0x6f, 0x16, 0x6e, 0x3d, 0x08, 0x42,
+  0x1f, 0xaa, 0x0f, 0x63, 0x19, 0x7d, 0x91, 0x69, 0x12, 0xa3, 0x98, 0x10,
+  0x76, 0xa1, 0x78, 0xef, 0x93, 0x9a, 0xdd, 0x14, 0x14, 0x14, 0x8c, 0x5b,
+  0x9d, 0x44, 0xbc, 0x20, 0xe8, 0x43, 0x78, 0xaf, 0xb7, 0xd7, 0xdb, 0x50,
+  0xde, 0x8f, 0xce, 0xe2, 0xc4, 0x6d, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5,
+  0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc3, 0xc5, 0xc5, 0xeb, 0x79,
+  0xdb, 0xe0, 0x1b, 0xf7, 0x55, 0x88, 0x0a, 0x3f, 0x24, 0xc3, 0xac, 0x53,
+  0x21, 0x61, 0x51, 0x64, 0x3c, 0xf1, 0xd2, 0x14, 0xb7, 0x4e, 0xb3, 0xbe,
+  0x2a, 0xd8, 0x2e, 0x53, 0xa4, 0x97, 0x1b, 0xfa, 0x63, 0xc1, 0x94, 0xca,
+  0x3a, 0xf7, 0x5d, 0x2c, 0x90, 0xd1, 0x4e, 0x51, 0xb0, 0x74, 0xca, 0x3e,
+  0x68, 0x15, 0xb3, 0xbb, 0xed, 0x18, 0x84, 0xa3, 0xa3, 0xdd, 0xdd, 0x0c,
+  0x8b, 0x8b, 0x33, 0xb4, 0x93, 0x62, 0x9d, 0xa6, 0x1a, 0x81, 0xc9, 0x59,
+  0x80, 0x9c, 0xf8, 0xad, 0xad, 0x8f, 0x8f, 0xf9, 0xc8, 0xb2, 0x5e, 0x50,
+  0xbd, 0x19, 0x09, 0x84, 0xb0, 0x12, 0x37, 0xd2, 0x85, 0xda, 0x65, 0x0b,
+  0x89, 0x9b, 0x33, 0x2f, 0xaa, 0x7e, 0xa7, 0x6a, 0x5b, 0x5b, 0x41, 0xff,
+  0x9b, 0xa4, 0x48, 0xda, 0xab, 0x99, 0xf1, 0x0b, 0xd3, 0x4b, 0x4b, 0x4b,
+  0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b,
+  0xd6, 0x70, 0x2f, 0xa7, 0x31, 0xba, 0x5b, 0xc1, 0xea, 0xa4, 0xa8, 0xfc,
+  0xb4, 0x5a, 0x70, 0x8f, 0x9a, 0x66, 0x35, 0x90, 0xa3, 0x66, 0xf3, 0xe4,
+  0xb9, 0xa5, 0x7b, 0xc5, 0x86, 0x34, 0xf6, 0x76, 0x9a, 0x5c, 0x78, 0xcc,
+  0x75, 0xe6, 0x63, 0x1b, 0xaf, 0x63, 0x5c, 0xb8, 0xb9, 0x53, 0x1e, 0x41,
+  0xe5, 0x0e, 0xce, 0xe7, 0x7b, 0x45, 0x69, 0x4e, 0x4e, 0xaf, 0x5f, 0x40,
+  0xaa, 0x16, 0x98, 0xcc, 0x5b, 0xd1, 0x83, 0x69, 0x39, 0x29, 0x20, 0xd1,
+  0x10, 0x34, 0xfe, 0xaa, 0x3a, 0x85, 0xc3, 0x2d, 0xd8, 0xd9, 0x05, 0x21,
+  0xdd, 0x5f, 0xbd, 0x79, 0x0f, 0x95, 0x55, 0xde, 0xf5, 0x64, 0xa3, 0xa3,
+  0xe0, 0xe0, 0xa1, 0xa1, 0x65, 0xdb, 0x90, 0x91, 0xe3, 0x4d, 0x5e, 0xb1,
+  0xe3, 0x86, 0x92, 0xdc, 0xd5, 0xa9, 0xce, 0xd1, 0xeb, 0x9e, 0x1c, 0x9f,
+  0xa5, 0xb4, 0xcd, 0x26, 0x8f, 0x29, 0x1e, 0x25, 0xcb, 0xb3, 0xef, 0xe2,
+  0x0b, 0x42, 0xb5, 0xf4, 0xc0, 0x10, 0x38, 0x38, 0x94, 0x0e, 0x91, 0x3b,
+  0x49, 0xf1, 0xcb, 0x31, 0x31, 0xed, 0x2d, 0xb2, 0x26, 0xcf, 0x8c, 0x2b,
+  0xdc, 0x95, 0xa8, 0xaf, 0x25, 0x78, 0x29, 0x89, 0x38, 0x03, 0xd0, 0xd0,
+  0x61, 0x18, 0xe2, 0x8f, 0x38, 0x85, 0xa8, 0x0c, 0xda, 0x66, 0x60, 0xe4,
+  0x69, 0xb5, 0x5f, 0x01, 0xff, 0x3b, 0x45, 0x1c, 0x14, 0xe7, 0xd9, 0x73,
+  0x4c, 0xa2, 0xb5, 0x5a, 0xaa, 0x1d, 0xa8, 0xa8, 0x33, 0x33, 0xaf, 0x3b,
+  0x20, 0xc5, 0x42, 0x87, 0xfa, 0x11, 0x28, 0x6f, 0xa2, 0xcf, 0x9a, 0xcd,
+  0x5b, 0xc5, 0x23, 0x9b, 0x0c, 0xfe, 0xaa, 0x1f, 0xcf, 0x4f, 0x08, 0xa5,
+  0xd0, 0x5a, 0x1c, 0x1c, 0x9b, 0x07, 0xd4, 0xe2, 0x4c, 0x21, 0xcf, 0x3b,
+  0x2c, 0xad, 0xd2, 0x07, 0x9f, 0x90, 0xf6, 0xc4, 0x06, 0xb1, 0xb3, 0x35,
+  0x48, 0x0e, 0xc0, 0x8e, 0x59, 0x89, 0xbe, 0x4f, 0x90, 0x4b, 0x55, 0x91,
+  0x2d, 0xe3, 0x14, 0x49, 0x0a, 0x2f, 0xf4, 0x50, 0x1f, 0x2b, 0xe4, 0xcc,
+  0xc0, 0xb4, 0x1e, 0xb1, 0x99, 0x0f, 0xb5, 0xaa, 0x77, 0x4e, 0xf4, 0x12,
+  0xfb, 0x9f, 0xe4, 0xf2, 0x9b, 0xd0, 0xe5, 0xc7, 0x7a, 0xfc, 0x4a, 0xce,
+  0x6f, 0xa0, 0x10, 0x1a, 0xfc, 0x00, 0xec, 0x53, 0xdb, 0x00, 0x37, 0xf4,
+  0xa4, 0xef, 0xf0, 0x41, 0x51, 0x26, 0x3e, 0x4d, 0x49, 0x14, 0x4c, 0x22,
+  0x8d, 0x7f, 0x6a, 0x89, 0x39, 0x54, 0xc7, 0x69, 0x2f, 0xbe, 0xbe, 0xbe,
+  0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0x18, 0x09,
+  0xf6, 0x6a, 0x78, 0x8c, 0xfe, 0x1f, 0xca, 0xe6, 0x6b, 0xf7, 0xbb, 0x7b,
+  0x0e, 0xd2, 0xe0, 0x4a, 0x44, 0x5e, 0x53, 0xf6, 0x4e, 0x12, 0x84, 0xee,
+  0x9e, 0xaa, 0x10, 0x31, 0xfa, 0x4a, 0xc4, 0x84, 0xb3, 0xa4, 0xa4, 0xa4,
+  0x62, 0x62, 0xf5, 0xba, 0xae, 0x30, 0x03, 0xf7, 0xb1, 0x4a, 0xd6, 0x2d,
+  0x1a, 0x0e, 0xdd, 0x4e, 0xab, 0x76, 0x70, 0x1c, 0x66, 0xe8, 0x6a, 0x22,
+  0x0e, 0xaa, 0xcd, 0x2d, 0xf8, 0xad, 0xa3, 0x0a, 0xd0, 0x57, 0xfa, 0xb8,
+  0x0f, 0xbd, 0x93, 0xf0, 0x87, 0x3d, 0xd7, 0x95, 0x1d, 0x05, 0x56, 0xf9,
+  0x22, 0x22, 0xdc, 0xdc, 0x01, 0x64, 0x20, 0x64, 0x91, 0x44, 0x20, 0x80,
+  0x30, 0xac, 0x26, 0x74, 0x2c, 0x1a, 0xfe, 0xfe, 0x8f, 0xdd, 0x28, 0x18,
+  0xd0, 0xba, 0xf3, 0x73, 0x10, 0xb0, 0xb2, 0x41, 0x63, 0x4b, 0x5b, 0x1d,
+  0x83, 0x1f, 0x01, 0x3e, 0x98, 0xd2, 0x92, 0xa0, 0x90, 0x65, 0x47, 0x5b,
+  0xc4, 0x30, 0x25, 0x25, 0xfc, 0x8a, 0x8a, 0x58, 0xa0, 0x1a, 0x63, 0x32,
+  0x1e, 0x22, 0xd5, 0xe5, 0xdc, 0xee, 0xe0, 0xf8, 0x8b, 0x8c, 0x73, 0x51,
+  0xf3, 0x58, 0x70, 0x0e, 0x0e, 0x8a, 0xda, 0x21, 0x20, 0xae, 0x65, 0x26,
+  0x85, 0xe6, 0x3f, 0xe4, 0x05, 0xb4, 0x86, 0x05, 0x1a, 0x08, 0x08, 0x08,
+  0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0x96, 0xeb, 0x66, 0x98, 0xc4, 0x5d, 0xe6, 0xe6, 0x09, 0x00, 0x1b, 0x27,
+  0xec, 0x45, 0x55, 0xe0, 0x21, 0xf0, 0xd2, 0x62, 0xda, 0x03, 0x91, 0x7b,
+  0x26, 0x2d, 0x3e, 0x2c, 0x79, 0xcf, 0x9c, 0x30, 0x54, 0xc0, 0xd0, 0x4c,
+  0x8d, 0x15, 0x39, 0x4d, 0xd3, 0xa4, 0x44, 0x40, 0x03, 0xd1, 0x64, 0x04,
+  0x80, 0xdc, 0xef, 0xdb, 0x4d, 0x4d, 0x7e, 0x7e, 0x22, 0x50, 0x8a, 0x7c,
+  0x63, 0xec, 0x93, 0xfb, 0x00, 0x39, 0x54, 0x5d, 0xce, 0x99, 0x8b, 0xff,
+  0xa3, 0x25, 0xf7, 0xaa, 0xce, 0xc2, 0x7c, 0x02, 0x76, 0x6a, 0xeb, 0x5a,
+  0xe1, 0xbb, 0xe1, 0xe4, 0x77, 0x49, 0x9f, 0x96, 0xbb, 0xa0, 0xbb, 0x58,
+  0x69, 0x61, 0x62, 0xb4, 0x66, 0xd0, 0xe3, 0x99, 0xbe, 0xc7, 0x90, 0x5f,
+  0xae, 0x46, 0x63, 0xd0, 0xa3, 0x83, 0x32, 0x87, 0x75, 0x62, 0xcc, 0xfd,
+  0xa7, 0xc7, 0x8b, 0x60, 0x81, 0xd2, 0x9e, 0xc6, 0x5c, 0xe6, 0x72, 0xa7,
+  0xcb, 0x05, 0xff, 0xff, 0xbd, 0x84, 0x89, 0x89, 0x54, 0xbf, 0x3e, 0x6c,
+  0x96, 0x63, 0x34, 0xd2, 0x6d, 0xd3, 0xee, 0xc6, 0xee, 0xd7, 0x29, 0x87,
+  0xff, 0xbb, 0xf7, 0xcc, 0x51, 0x51, 0x50, 0x81, 0x36, 0x72, 0xff, 0xd2,
+  0x10, 0x39, 0x70, 0xa3, 0x5e, 0x0d, 0x89, 0x89, 0xf7, 0x3e, 0x63, 0xe2,
+  0x3b, 0x81, 0xa9, 0x63, 0x1b, 0xba, 0xd6, 0xb2, 0xb0, 0x01, 0xd4, 0xaf,
+  0xbf, 0x65, 0x06, 0x2c, 0x25, 0xa9, 0x6a, 0x24, 0xf3, 0x4b, 0x1a, 0x01,
+  0x52, 0x70, 0x5c, 0xd1, 0x2a, 0xbf, 0x2d, 0x3d, 0x45, 0xb2, 0x18, 0xe7,
+  0xe7, 0x44, 0xcf, 0x7a, 0xe1, 0xfb, 0x88, 0x46, 0x05, 0x0d, 0xcd, 0x18,
+  0xcb, 0x41, 0xb4, 0x2a, 0xbb, 0xae, 0xbd, 0x16, 0xe4, 0x8c, 0xaa, 0xc3,
+  0xc6, 0x44, 0xe4, 0xf2, 0x1d, 0xae, 0xf6, 0xc3, 0x82, 0xc9, 0xe5, 0x7e,
+  0x6f, 0x42, 0x02, 0xac, 0xc0, 0x66, 0x54, 0xfa, 0x64, 0x4f, 0x4e, 0xf3,
+  0x46, 0xd9, 0x7a, 0xf5, 0xa1, 0x07, 0xff, 0xf3, 0x61, 0x73, 0xde, 0x30,
+  0x53, 0xe9, 0x37, 0x25, 0xe5, 0x1c, 0xce, 0xad, 0x47, 0x37, 0x3d, 0xa8,
+  0x3f, 0xd3, 0xce, 0x2f, 0xcf, 0x53, 0x6e, 0x05, 0x13, 0x8e, 0xfa, 0x9a,
+  0x19, 0xff, 0x21, 0x7f, 0x48, 0x80, 0x97, 0x86, 0x86, 0x24, 0x2f, 0x4a,
+  0x0c, 0x14, 0xa3, 0xbf, 0x85, 0x70, 0xc6, 0x49, 0x9d, 0x78, 0x3a, 0xbd,
+  0xb6, 0x59, 0x77, 0x2f, 0x11, 0xd9, 0x37, 0xc9, 0x2f, 0x70, 0x3e, 0xe0,
+  0x1d, 0x1d, 0xc8, 0x36, 0x1b, 0x47, 0x93, 0xb0, 0x0d, 0xe1, 0xec, 0xff,
+  0x3c, 0x9e, 0x66, 0x6c, 0xb8, 0x72, 0xf8, 0x54, 0x78, 0x9c, 0x45, 0x2f,
+  0x18, 0xf5, 0xa4, 0x13, 0x3f, 0x00, 0xce, 0x33, 0x32, 0x6f, 0x64, 0xf1,
+  0x8f, 0x75, 0xe0, 0x4c, 0x0c, 0xf0, 0x97, 0xb5, 0x83, 0xde, 0x9b, 0xb5,
+  0x08, 0xff, 0x72, 0xaa, 0x80, 0x38, 0xfc, 0xb3, 0x9f, 0xb1, 0x07, 0x07,
+  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+  0x07, 0x07, 0x07, 0x07, 0x07, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f,
+  0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x8a, 0x17, 0x88, 0xa9, 0xa9, 0xf7,
+  0xf2, 0xa7, 0xa7, 0x96, 0xe7, 0x13, 0x26, 0xa7, 0xcf, 0x4a, 0x23, 0xef,
+  0x9e, 0x82, 0xd4, 0xee, 0x8a, 0x4e, 0x89, 0xdc, 0x37, 0xb9, 0xea, 0x1f,
+  0x15, 0x01, 0x41, 0x0c, 0x28, 0x19, 0x10, 0x10, 0x76, 0x76, 0xbb, 0x39,
+  0xbb, 0x74, 0x9c, 0x49, 0x0c, 0x4e, 0x14, 0xb3, 0xe2, 0x9f, 0x46, 0x8e,
+  0x22, 0x30, 0x30, 0xf0, 0xfc, 0x37, 0xb2, 0x3e, 0xb1, 0x28, 0x22, 0x4c,
+  0xb7, 0xf4, 0xb9, 0xa8, 0xa8, 0x37, 0xf8, 0x4c, 0xfe, 0xd2, 0x60, 0x1c,
+  0x14, 0xf4, 0x4a, 0xf4, 0x89, 0xf3, 0xf3, 0xad, 0x44, 0xbb, 0xed, 0xe6,
+  0x63, 0xe4, 0x41, 0xde, 0xde, 0x6b, 0x1d, 0x1b, 0xed, 0xc2, 0x19, 0x3d,
+  0xda, 0xfc, 0x4d, 0x87, 0x48, 0x57, 0xb6, 0x57, 0x42, 0x6e, 0xba, 0x0a,
+  0xda, 0x43, 0x3c, 0x25, 0x0a, 0x21, 0xb0, 0x3b, 0x72, 0x1e, 0xf0, 0xac,
+  0x97, 0x05, 0x2e, 0xb6, 0x0c, 0x91, 0x74, 0xef, 0x76, 0x2f, 0xbd, 0x39,
+  0x30, 0xb5, 0x65, 0x7d, 0x31, 0x39, 0x29, 0xcd, 0x67, 0x55, 0xf4, 0x06,
+  0xcd, 0x1f, 0xc8, 0xbd, 0xb4, 0x56, 0x3c, 0x1f, 0x77, 0x34, 0xfd, 0x1d,
+  0x33, 0x04, 0x06, 0x2b, 0x2b, 0x23, 0xac, 0xf4, 0xf4, 0xf8, 0xb0, 0xc2,
+  0x97, 0x1d, 0xce, 0xce, 0x26, 0x26, 0x06, 0x06, 0xba, 0xb5, 0xb4, 0x59,
+  0x70, 0x39, 0x58, 0x10, 0xcd, 0x3a, 0x02, 0x8f, 0x27, 0xe8, 0x4f, 0x18,
+  0x9c, 0xec, 0xa5, 0xfb, 0x6e, 0x7e, 0xe6, 0x4c, 0xa9, 0x90, 0x0c, 0x52,
+  0x0c, 0x63, 0x7f, 0xd7, 0xa0, 0xf3, 0x64, 0xed, 0xed, 0x5b, 0x85, 0xc5,
+  0x10, 0x52, 0x8d, 0x11, 0x1f, 0x52, 0x80, 0x37, 0x92, 0xce, 0x13, 0x51,
+  0x8b, 0x60, 0xaa, 0x4d, 0x20, 0x8e, 0x4d, 0x8e, 0xb7, 0x49, 0xc6, 0x31,
+  0x70, 0x54, 0xe0, 0x58, 0x99, 0x6a, 0x33, 0xde, 0x4d, 0xb9, 0xc8, 0x3a,
+  0x4d, 0xae, 0x9b, 0xf0, 0x4d, 0xae, 0xae, 0x12, 0x12, 0x5d, 0xeb, 0xf3,
+  0x70, 0x74, 0x04, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89,
+  0x89, 0x89, 0x89, 0x89, 0x75, 0x45, 0x5a, 0x8e, 0x61, 0x61, 0xa1, 0xe2,
+  0x0a, 0x98, 0x17, 0x84, 0xe8, 0x00, 0x8e, 0x8e, 0x85, 0x27, 0x20, 0x6c,
+  0xfd, 0xa9, 0x68, 0xa5, 0x20, 0xbe, 0xa7, 0xa7, 0xdf, 0xda, 0xfe, 0xb5,
+  0x1c, 0x9b, 0x61, 0xdc, 0x80, 0xd1, 0xd1, 0x65, 0x65, 0x75, 0x50, 0x87,
+  0x8d, 0xc7, 0xae, 0x4c, 0x8a, 0x8a, 0x0d, 0x8f, 0x5b, 0x3e, 0xd3, 0x24,
+  0x50, 0x17, 0xaf, 0xa1, 0x84, 0x0a, 0x62, 0x69, 0xfb, 0x9f, 0xb7, 0x16,
+  0x07, 0x24, 0x74, 0x3f, 0xe4, 0x39, 0xa0, 0xdc, 0x81, 0x87, 0x23, 0x2d,
+  0x78, 0x9f, 0x54, 0xbf, 0x2d, 0xab, 0xe7, 0x38, 0xdc, 0xc0, 0x40, 0x82,
+  0x74, 0x15, 0x28, 0x69, 0x66, 0x6e, 0x31, 0xab, 0x4a, 0x81, 0xc0, 0xc5,
+  0xed, 0x70, 0x21, 0x17, 0x19, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c,
+  0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0xe4, 0x69, 0xf1, 0x35, 0x26, 0x02,
+  0x13, 0xdf, 0x12, 0x19, 0x52, 0x10, 0xb6, 0x77, 0x6b, 0xe3, 0x2b, 0xd4,
+  0x46, 0x46, 0x9a, 0x54, 0x6b, 0x1d, 0x41, 0xad, 0x68, 0xe1, 0xe1, 0xd6,
+  0x0c, 0xc0, 0xdf, 0x83, 0x36, 0xf8, 0x42, 0x7c, 0xfb, 0x61, 0x5b, 0x5b,
+  0xda, 0x8f, 0xc7, 0x04, 0x0c, 0x41, 0xa4, 0x3a, 0xe1, 0x17, 0x17, 0xc1,
+  0x81, 0xb8, 0x26, 0x0e, 0x86, 0xb0, 0x10, 0x47, 0x71, 0x7f, 0x0b, 0xd7,
+  0x62, 0xc8, 0x4c, 0x20, 0xe2, 0xf5, 0x00, 0x62, 0x22, 0xe1, 0x7f, 0xfa,
+  0x85, 0xa1, 0xc7, 0xf8, 0xf8, 0x13, 0xd1, 0x68, 0xad, 0xb5, 0x63, 0x76,
+  0xc5, 0x43, 0xeb, 0x0c, 0x33, 0xfe, 0x91, 0xf0, 0x86, 0x34, 0xbd, 0xc1,
+  0xb4, 0x12, 0xad, 0xd3, 0x79, 0x5d, 0xea, 0x39, 0xb7, 0x30, 0xfd, 0xe5,
+  0x5b, 0x3e, 0x61, 0x89, 0xd1, 0xd1, 0x81, 0x46, 0x9b, 0x4c, 0x74, 0x7b,
+  0x7c, 0xf0, 0x6d, 0x7f, 0x92, 0x3c, 0xa7, 0xf9, 0xe2, 0x3d, 0x3d, 0x6a,
+  0x2c, 0x32, 0x68, 0xe2, 0x74, 0x7b, 0xdd, 0x13, 0x11, 0x92, 0x0e, 0x73,
+  0x38, 0xe2, 0x4b, 0x6f, 0x8a, 0x27, 0xab, 0x25, 0x23, 0x80, 0x4f, 0x15,
+  0x2f, 0x4c, 0xcf, 0x9a, 0xaf, 0xc2, 0x38, 0x47, 0xfc, 0x16, 0x81, 0x0f,
+  0xb9, 0x26, 0xcc, 0xb7, 0x4c, 0x86, 0x7f, 0xfe, 0x23, 0x94, 0x76, 0xa5,
+  0xee, 0x15, 0x15, 0xa3, 0xa3, 0xa3, 0x57, 0x57, 0xc8, 0xaa, 0xb8, 0x62,
+  0x55, 0xae, 0x1c, 0x44, 0x39, 0x0c, 0x65, 0x60, 0x56, 0xc8, 0x60, 0x80,
+  0x96, 0xcd, 0xc0, 0x34, 0xb2, 0xf2, 0xed, 0xd7, 0xe9, 0xf5, 0xfa, 0xee,
+  0x1c, 0x7c, 0x12, 0x71, 0x42, 0x1e, 0xdc, 0x2b, 0xf0, 0xfb, 0xf6, 0x48,
+  0x16, 0x62, 0xdd, 0x1a, 0x7c, 0x3c, 0x62, 0x9f, 0x83, 0xe2, 0x59, 0x8d,
+  0x04, 0x4e, 0xff, 0xee, 0xd5, 0x98, 0x9d, 0xfc, 0xdf, 0x81, 0x61, 0x56,
+  0xcd, 0x90, 0x3e, 0x04, 0xda, 0x9c, 0x8c, 0x01, 0x21, 0xa8, 0x6d, 0x2b,
+  0xbd, 0xbd, 0x4b, 0xf8, 0x4c, 0x21, 0x6b, 0x0c, 0x0e, 0x7f, 0x1f, 0x31,
+  0x53, 0x8b, 0x40, 0x85, 0x96, 0xc0, 0xbd, 0x5f, 0x4e, 0xf3, 0xad, 0x72,
+  0xc6, 0x28, 0x0c, 0xf1, 0x38, 0x56, 0xe0, 0xe0, 0xf3, 0x81, 0x98, 0xba,
+  0x9a, 0x4c, 0x40, 0xdd, 0x9e, 0x99, 0x35, 0xa9, 0xa8, 0x18, 0x20, 0x75,
+  0x9e, 0xa9, 0x2c, 0xf8, 0x0e, 0x02, 0x63, 0x3b, 0xcb, 0xcb, 0x27, 0xf5,
+  0x29, 0x9d, 0x5e, 0x08, 0x7b, 0xf9, 0x3c, 0x07, 0xf7, 0x3e, 0xf9, 0x0d,
+  0x3e, 0xdf, 0x00, 0xad, 0x8b, 0xd0, 0x46, 0xc9, 0xed, 0x01, 0xd1, 0x20,
+  0x40, 0xde, 0x20, 0xda, 0xf6, 0x61, 0xf5, 0xd8, 0x56, 0x1d, 0x29, 0xb0,
+  0x63, 0xb8, 0x6b, 0xe1, 0xfc, 0x86, 0xf6, 0x18, 0xf3, 0xb0, 0x4a, 0x37,
+  0x0c, 0x54, 0xd7, 0x1c, 0x0d, 0x0d, 0x0d, 0xd8, 0x68, 0x22, 0x1a, 0xb1,
+  0x8e, 0x6a, 0x8d, 0x17, 0xf0, 0xf0, 0x61, 0x61, 0x63, 0x42, 0xa6, 0x5d,
+  0x98, 0xfc, 0xc4, 0x78, 0xb6, 0xcd, 0x3a, 0x14, 0xfd, 0xc5, 0x31, 0x17,
+  0x07, 0x72, 0x24, 0x4b, 0xfa, 0x56, 0xec, 0xa8, 0xa7, 0xf9, 0xfe, 0xee,
+  0x6e, 0x1e, 0x72, 0x10, 0x93, 0xbc, 0x15, 0x15, 0x18, 0x39, 0x35, 0x24,
+  0x60, 0x0e, 0x78, 0xff, 0x97, 0xa1, 0x63, 0x97, 0x95, 0xcb, 0x3f, 0x99,
+  0x6e, 0x6e, 0xa7, 0x05, 0x36, 0xa4, 0xa3, 0x2d, 0x66, 0xe0, 0x07, 0x7d,
+  0xba, 0xc6, 0x7c, 0x0a, 0x78, 0x78, 0xa5, 0x25, 0x45, 0xa4, 0xa1, 0x5f,
+  0xe9, 0x11, 0x11, 0x7e, 0x68, 0xd8, 0x7e, 0x8a, 0x61, 0xa8, 0x2d, 0x34,
+  0x4d, 0x81, 0x70, 0x48, 0x70, 0xb7, 0xbf, 0xbf, 0xbf, 0x5f, 0x7e, 0x4b,
+  0x9e, 0x0e, 0xd6, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
+  0x7e, 0x7e, 0x7e, 0x7e, 0x4a, 0xed, 0x26, 0x49, 0x1d, 0x29, 0x15, 0x3c,
+  0x66, 0x19, 0x18, 0x62, 0x55, 0xb2, 0x23, 0xbb, 0xa9, 0xf5, 0x30, 0xa8,
+  0x0c, 0x4f, 0x39, 0xa6, 0xfe, 0xe7, 0x1d, 0xd9, 0xe6, 0x75, 0x66, 0x83,
+  0x96, 0x67, 0x92, 0xe0, 0x7c, 0xad, 0xa3, 0xfb, 0x0c, 0x78, 0x55, 0x74,
+  0x27, 0xa8, 0xcf, 0xf7, 0xf7, 0x0d, 0xc6, 0xc6, 0x71, 0x1e, 0xd5, 0x24,
+  0xc0, 0x59, 0x38, 0x80, 0x81, 0x60, 0xd2, 0xb4, 0x81, 0x11, 0x80, 0x84,
+  0x63, 0x06, 0x1e, 0x92, 0xc2, 0x7f, 0xc2, 0xc6, 0xe9, 0xc9, 0xc9, 0xc9,
+  0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9,
+  0xc9, 0xb8, 0x09, 0x46, 0x0f, 0xae, 0x35, 0x02, 0xf2, 0x92, 0x5c, 0xaf,
+  0xba, 0xe5, 0x7b, 0x4d, 0x05, 0xc3, 0x22, 0xbf, 0x61, 0x47, 0x4a, 0x9f,
+  0x35, 0xbc, 0x17, 0x7a, 0x6f, 0xb7, 0x5f, 0x38, 0x84, 0xfb, 0x51, 0x62,
+  0xa5, 0xbf, 0x3a, 0x18, 0x03, 0xd7, 0x11, 0x35, 0xba, 0xb8, 0xe1, 0x22,
+  0xf9, 0x27, 0x34, 0xbd, 0xc4, 0xcc, 0x13, 0x10, 0x09, 0x37, 0x46, 0x66,
+  0x39, 0x39, 0xd1, 0x34, 0xcc, 0xae, 0xc3, 0x58, 0xdf, 0xdf, 0x99, 0x99,
+  0x05, 0x31, 0xee, 0x65, 0x0e, 0x2d, 0xf2, 0xfc, 0x2a, 0x46, 0xee, 0x90,
+  0x65, 0xf2, 0x4d, 0x2e, 0xa8, 0x8d, 0x9b, 0x62, 0x1a, 0x0b, 0x8b, 0x67,
+  0x80, 0x6f, 0x17, 0x9c, 0xbd, 0xb7, 0xfb, 0x37, 0x34, 0x0e, 0x05, 0xb9,
+  0x41, 0xb0, 0xb6, 0x05, 0xda, 0x5c, 0x03, 0xcc, 0x55, 0x02, 0x69, 0xde,
+  0x9d, 0x93, 0x81, 0xa8, 0xaf, 0x18, 0xab, 0x42, 0x3c, 0x3c, 0xec, 0x04,
+  0x58, 0xa6, 0xa6, 0xb7, 0xf5, 0xd9, 0xcd, 0x14, 0x40, 0x43, 0x1c, 0x86,
+  0xc3, 0xeb, 0x88, 0xae, 0xf4, 0x24, 0x3e, 0x68, 0xbe, 0x53, 0xe9, 0x73,
+  0xfc, 0x4f, 0x27, 0xd9, 0x14, 0xf1, 0x88, 0x1d, 0xc6, 0xd2, 0x57, 0xfb,
+  0x46, 0xa0, 0x7f, 0x6c, 0xea, 0xd3, 0x0f, 0xd1, 0x01, 0x01, 0xc0, 0xa0,
+  0x4e, 0x5c, 0x27, 0x77, 0x83, 0xa7, 0x6b, 0x9e, 0x7a, 0xa6, 0xfc, 0xff,
+  0x45, 0xb7, 0x5c, 0x41, 0x3d, 0x6e, 0x59, 0xc9, 0x18, 0xbc, 0x45, 0xdf,
+  0xfc, 0x8c, 0x6b, 0x7a, 0xc9, 0x01, 0x67, 0x29, 0xda, 0x15, 0xc1, 0x82,
+  0xf2, 0x63, 0x8b, 0x5c, 0x2c, 0x2d, 0x2d, 0x7a, 0x7a, 0x56, 0x75, 0x13,
+  0x03, 0x9f, 0x13, 0x0d, 0x06, 0xd5, 0x20, 0xcf, 0x29, 0xf3, 0x8d, 0x8a,
+  0xd4, 0xb4, 0x8d, 0x7e, 0xb8, 0x26, 0x2f, 0x76, 0x15, 0x19, 0x25, 0x10,
+  0x34, 0x66, 0x70, 0x2b, 0xd6, 0x7e, 0x11, 0x15, 0xf5, 0x20, 0x90, 0x8a,
+  0xb3, 0x41, 0x41, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
+  0x2b, 0x2b, 0x2b, 0x2b, 0x11, 0x04, 0x0d, 0xd7, 0x5b, 0x8a, 0x32, 0xdf,
+  0x85, 0xa9, 0x27, 0x61, 0x61, 0x6e, 0x61, 0xe4, 0x24, 0x50, 0x92, 0x3c,
+  0xce, 0xce, 0x1d, 0x1d, 0xe8, 0x69, 0x28, 0x7e, 0xc5, 0xe2, 0xd7, 0xc3,
+  0x90, 0x73, 0xc4, 0xeb, 0x2e, 0x94, 0xa9, 0x66, 0x09, 0x3f, 0xd8, 0xe7,
+  0x3a, 0x54, 0x83, 0x0a, 0x31, 0xdb, 0xab, 0x50, 0x6e, 0xb0, 0xa4, 0xa1,
+  0x43, 0xce, 0x28, 0x99, 0x7f, 0x10, 0x48, 0xae, 0xef, 0x5a, 0x6d, 0x6d,
+  0x7c, 0xb2, 0xed, 0xb4, 0xa4, 0x75, 0x6d, 0x38, 0xbf, 0x2f, 0x91, 0x17,
+  0x12, 0x82, 0x90, 0x28, 0x5b, 0x95, 0x5b, 0x2f, 0x0a, 0x1d, 0x96, 0x4b,
+  0x12, 0x5b, 0x5b, 0x7f, 0x92, 0x36, 0xfb, 0xec, 0x37, 0x7a, 0xf5, 0x4d,
+  0x8f, 0xfc, 0xc0, 0x31, 0x1d, 0xbe, 0x0d, 0x6d, 0x79, 0x4a, 0x78, 0x78,
+  0xdc, 0x28, 0x80, 0x71, 0xc6, 0x49, 0x2f, 0xbd, 0x29, 0xa9, 0xa9, 0xa9,
+  0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xab, 0x2e, 0x94,
+  0x23, 0x23, 0xe3, 0x34, 0xe0, 0x34, 0x1e, 0xd3, 0xef, 0xae, 0x85, 0xee,
+  0x74, 0x04, 0x9a, 0x0e, 0xbe, 0xbe, 0xad, 0xdb, 0x75, 0x08, 0x4b, 0x77,
+  0xb8, 0xb7, 0xd0, 0x2c, 0x59, 0x77, 0xf2, 0x89, 0x27, 0xf4, 0xaf, 0x63,
+  0xff, 0xcc, 0x55, 0x47, 0x50, 0xcf, 0xcf, 0xcb, 0x6e, 0x59, 0x4c, 0xe0,
+  0xd0, 0xe6, 0xb5, 0xbc, 0xbc, 0xec, 0xe6, 0x67, 0x72, 0xf6, 0x11, 0x1b,
+  0x21, 0xa3, 0xc1, 0x70, 0xd1, 0x52, 0x92, 0xb9, 0x1a, 0x68, 0xcb, 0x5b,
+  0x28, 0x6c, 0x5a, 0xc2, 0xf9, 0x4b, 0xfa, 0xf9, 0xbd, 0x85, 0x6e, 0x4e,
+  0xed, 0x7c, 0x5e, 0xe4, 0x4b, 0xde, 0xa0, 0xe9, 0xf8, 0x7a, 0x66, 0xb9,
+  0xca, 0x25, 0x88, 0x2c, 0x07, 0x45, 0x48, 0x3f, 0x94, 0x45, 0x03, 0xd0,
+  0xee, 0xcf, 0x28, 0x13, 0xc7, 0xdb, 0x80, 0x84, 0x7d, 0xe0, 0xae, 0xdd,
+  0xd0, 0xa8, 0x74, 0x74, 0x8d, 0xd6, 0xd6, 0x0c, 0xfb, 0xc7, 0x62, 0x2e,
+  0x5b, 0x79, 0xf6, 0x06, 0x0f, 0x0f, 0xa3, 0xaa, 0x55, 0xc7, 0xdb, 0x6b,
+  0xf5, 0xb4, 0xa2, 0x0e, 0x57, 0x1e, 0x74, 0x97, 0xbe, 0x9e, 0x42, 0x89,
+  0xed, 0xa1, 0xd6, 0x4e, 0xe2, 0x39, 0x16, 0x2f, 0x80, 0x80, 0x51, 0x6a,
+  0x08, 0x8f, 0x6f, 0x12, 0x12, 0x77, 0x66, 0xea, 0xcc, 0xd9, 0xe7, 0x5d,
+  0xd8, 0xdb, 0x16, 0x38, 0x8c, 0x89, 0x9c, 0x06, 0x9f, 0x4a, 0x61, 0xbd,
+  0x03, 0x15, 0x83, 0x0b, 0xf0, 0xd4, 0xed, 0x44, 0x1f, 0x61, 0xf1, 0x56,
+  0x29, 0x74, 0xc2, 0x6f, 0x6f, 0xdf, 0xa8, 0x84, 0xc0, 0xb6, 0xb9, 0xb2,
+  0x26, 0xa1, 0x6f, 0xae, 0x00, 0xae, 0xf0, 0xa0, 0xc8, 0x84, 0x32, 0x50,
+  0xf2, 0x6f, 0xb9, 0x22, 0x39, 0xe3, 0x2c, 0x51, 0x8f, 0x46, 0xef, 0x0b,
+  0xf9, 0x17, 0x39, 0xb9, 0x25, 0x3b, 0x69, 0x89, 0x44, 0x83, 0x11, 0x5b,
+  0x53, 0x0a, 0x9e, 0x86, 0x7e, 0x68, 0x0b, 0x92, 0xfe, 0x07, 0x07, 0x10,
+  0x10, 0xbb, 0xe9, 0xee, 0xff, 0xb3, 0xe0, 0x98, 0x4a, 0x7a, 0x7c, 0x10,
+  0x20, 0x82, 0x13, 0xe8, 0xd4, 0x1a, 0x88, 0xe3, 0x20, 0x69, 0x0b, 0xab,
+  0x9a, 0xb1, 0xa7, 0xcb, 0xbc, 0x9a, 0x64, 0xa1, 0xd6, 0x7b, 0xc5, 0x48,
+  0x38, 0x59, 0x9b, 0x6e, 0x85, 0x4a, 0xbf, 0x80, 0xbd, 0x50, 0xba, 0x59,
+  0x63, 0x5c, 0xd1, 0x3a, 0x95, 0xb7, 0x2a, 0x44, 0xfb, 0xb6, 0xc8, 0x4e,
+  0xbc, 0xbc, 0xf8, 0xf5, 0x24, 0x1d, 0x49, 0xca, 0x97, 0x9e, 0xae, 0x6e,
+  0xf5, 0x84, 0x54, 0x5e, 0xc4, 0x6b, 0xfa, 0x89, 0xbb, 0x00, 0x7e, 0xcd,
+  0x24, 0x49, 0x3b, 0x9a, 0xcd, 0x47, 0x08, 0xb1, 0xd0, 0xfa, 0x3d, 0x02,
+  0x36, 0xfd, 0x14, 0x61, 0x31, 0x37, 0xd5, 0x61, 0x47, 0x4d, 0x49, 0xb2,
+  0xd2, 0x63, 0xde, 0x9d, 0x2b, 0x40, 0x53, 0xaa, 0xf2, 0x43, 0x9a, 0x83,
+  0x34, 0x1d, 0xda, 0x77, 0xd4, 0x04, 0x11, 0xb0, 0xea, 0x16, 0xdf, 0xbd,
+  0xda, 0x25, 0xe7, 0xcb, 0x89, 0x6a, 0x55, 0x76, 0x65, 0x31, 0x49, 0xf3,
+  0xba, 0x0d, 0x10, 0x9b, 0x39, 0xe6, 0xe7, 0x62, 0x47, 0xb3, 0xe0, 0x2f,
+  0x41, 0x2d, 0xba, 0xf5, 0x11, 0x2c, 0xee, 0x8e, 0x8c, 0x9d, 0x6c, 0xc8,
+  0xca, 0x3e, 0xb5, 0xac, 0x7d, 0x1e, 0xe9, 0xfd, 0x21, 0xa5, 0x6a, 0x6a,
+  0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a,
+  0x6a, 0x6a, 0x43, 0xdd, 0xe5, 0x90, 0xb7, 0x63, 0x63, 0x2a, 0xc8, 0xc8,
+  0x06, 0x98, 0x12, 0xb1, 0x04, 0x22, 0xb9, 0xa7, 0x18, 0x04, 0x89, 0x89,
+  0x1b, 0xfe, 0x69, 0x49, 0x2e, 0x8f, 0xfe, 0x5a, 0x58, 0xd7, 0x14, 0xa2,
+  0xdd, 0xa1, 0x8c, 0x4d, 0x25, 0x70, 0x70, 0xc8, 0x0c, 0x44, 0xdd, 0xc7,
+  0x4c, 0x2b, 0x3c, 0xda, 0x4f, 0x86, 0xf9, 0x57, 0x51, 0xf5, 0x5c, 0x61,
+  0x7d, 0x86, 0xf5, 0xf5, 0x22, 0xd5, 0x5c, 0x01, 0x01, 0x11, 0x4f, 0xde,
+  0xf7, 0xb5, 0xc7, 0x70, 0x99, 0x01, 0x4b, 0x4b, 0xdf, 0xec, 0x73, 0x20,
+  0x82, 0x49, 0x22, 0xc8, 0x3f, 0x70, 0x1f, 0x3b, 0xc9, 0x96, 0xb8, 0xb8,
+  0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8,
+  0xb8, 0x56, 0xff, 0xc6, 0xc1, 0x8e, 0x0a, 0xf8, 0x7c, 0xb3, 0x3c, 0xf4,
+  0x39, 0x62, 0xdc, 0x00, 0x03, 0xb1, 0x43, 0x38, 0x66, 0x2b, 0x9b, 0xc7,
+  0x63, 0x9e, 0x41, 0xeb, 0x30, 0xab, 0xe3, 0xde, 0xea, 0x6a, 0xa3, 0x7d,
+  0x0f, 0x71, 0x1a, 0x98, 0x71, 0x9a, 0xa7, 0xd6, 0x79, 0x7e, 0xa7, 0x16,
+  0x9d, 0x42, 0x18, 0x8a, 0xc4, 0x1b, 0x1b, 0x40, 0x0a, 0xf3, 0xa2, 0x2a,
+  0xc9, 0x4b, 0xcd, 0xbb, 0x9c, 0x2a, 0x4a, 0xc3, 0x55, 0xe8, 0x52, 0xe9,
+  0xc9, 0x35, 0x5e, 0x49, 0x47, 0x57, 0x5e, 0xff, 0x43, 0xb1, 0xfc, 0x21,
+  0xe2, 0x43, 0x5e, 0xa4, 0x02, 0xba, 0xa9, 0xfb, 0xd7, 0xc4, 0xa4, 0xa4,
+  0x58, 0x2e, 0x32, 0x32, 0x3d, 0x2b, 0x2b, 0xba, 0x7e, 0xc1, 0x69, 0x6f,
+  0x44, 0x80, 0x89, 0xaf, 0xd8, 0x8a, 0x2e, 0xbe, 0x7f, 0xb5, 0xcf, 0x41,
+  0x2d, 0x90, 0xf5, 0x40, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1,
+  0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xb5, 0x60, 0x91, 0x28, 0x99, 0x50, 0x51,
+  0x51, 0xeb, 0x60, 0xf7, 0x7f, 0x8c, 0x7d, 0x39, 0x98, 0x61, 0x43, 0x3c,
+  0xd7, 0x74, 0xc4, 0xe0, 0xfe, 0x2e, 0xe6, 0x1c, 0x19, 0xa4, 0xa1, 0x3d,
+  0x30, 0x0a, 0xa3, 0x9c, 0x20, 0x1a, 0x18, 0x18, 0x62, 0x4b, 0x8e, 0xff,
+  0x38, 0x9c, 0xf5, 0x1c, 0x62, 0x15, 0x81, 0x61, 0x71, 0x83, 0x39, 0x4b,
+  0x40, 0x40, 0xfc, 0x41, 0x6c, 0x2f, 0x6f, 0x43, 0xb3, 0xde, 0xb5, 0xd1,
+  0xdf, 0xa1, 0x6a, 0xff, 0x6f, 0xe9, 0xfa, 0xb5, 0x6a, 0xfd, 0x92, 0xc3,
+  0xe2, 0x37, 0x01, 0xa6, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93,
+  0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x1c, 0x92, 0x92, 0x19, 0x58,
+  0x40, 0xdf, 0x4e, 0x0b, 0xbb, 0xc7, 0xe6, 0x09, 0xee, 0x1d, 0x07, 0x12,
+  0xc4, 0x6f, 0x1d, 0xd4, 0xd0, 0xa0, 0x4a, 0x40, 0xcb, 0x60, 0x8a, 0xb5,
+  0xd9, 0x82, 0x1f, 0x32, 0xa7, 0x7a, 0x5b, 0x6f, 0xea, 0xbd, 0x31, 0xc6,
+  0x26, 0xe7, 0x8a, 0x0a, 0x7d, 0xdd, 0xf2, 0x93, 0x8f, 0x91, 0x3c, 0x46,
+  0x8c, 0x34, 0x91, 0x9c, 0x99, 0xdd, 0x36, 0xa3, 0x1c, 0x86, 0x59, 0xfc,
+  0x0e, 0xbb, 0xa0, 0x4f, 0xc3, 0x04, 0xcf, 0x7a, 0xd3, 0x10, 0xeb, 0x30,
+  0x37, 0x8d, 0x9f, 0x29, 0xce, 0x34, 0xf9, 0xb2, 0xd4, 0xf9, 0x56, 0x35,
+  0xe2, 0x94, 0x04, 0x23, 0x79, 0x2f, 0x28, 0xba, 0xcd, 0x02, 0x76, 0x21,
+  0xcf, 0x9e, 0x5b, 0x5a, 0xa0, 0x14, 0xae, 0x9d, 0xc5, 0x56, 0x77, 0xc6,
+  0x6c, 0x52, 0x42, 0xf0, 0x3f, 0xdf, 0x38, 0x42, 0x42, 0x72, 0x5a, 0x32,
+  0xa8, 0xc7, 0xb4, 0xcc, 0x29, 0x29, 0xab, 0xab, 0x41, 0xc0, 0xb4, 0x72,
+  0x80, 0xfa, 0x01, 0xbf, 0x28, 0x86, 0x12, 0x75, 0xf9, 0x30, 0x13, 0x08,
+  0x0a, 0x2a, 0x81, 0x64, 0xc1, 0x8a, 0xad, 0x89, 0x5b, 0xcd, 0xe9, 0xd6,
+  0x51, 0x05, 0x13, 0xf1, 0x35, 0x17, 0x06, 0x41, 0x27, 0x9b, 0xb8, 0xf9,
+  0x6a, 0x07, 0x2c, 0x49, 0x69, 0x76, 0x98, 0x3f, 0xbb, 0x13, 0x14, 0x7e,
+  0x5b, 0x25, 0x7c, 0xf4, 0xe7, 0xf5, 0xa1, 0x19, 0x9d, 0x6e, 0x8d, 0xf5,
+  0xcd, 0x72, 0x5c, 0x86, 0x84, 0x3f, 0x39, 0x46, 0x6b, 0x24, 0x4b, 0x61,
+  0x40, 0x10, 0x36, 0xf5, 0x73, 0x70, 0x8a, 0x75, 0x01, 0xdc, 0x54, 0x1e,
+  0x45, 0xfa, 0xfc, 0x29, 0xa5, 0x0c, 0x00, 0xf6, 0xb5, 0x8e, 0xd6, 0xd2,
+  0xc0, 0x48, 0x7e, 0xcc, 0xac, 0xa7, 0xc1, 0xc1, 0xb5, 0xd2, 0x02, 0x30,
+  0x53, 0x00, 0xa0, 0x52, 0x2b, 0x44, 0xd0, 0x09, 0x7c, 0x90, 0xaa, 0xf0,
+  0x17, 0x95, 0x4d, 0x76, 0xc5, 0x79, 0xdb, 0x13, 0x02, 0xb0, 0xec, 0xf8,
+  0x03, 0x9c, 0x17, 0x23, 0x6f, 0xa4, 0x03, 0x66, 0xc1, 0x03, 0xa3, 0x01,
+  0xe8, 0x74, 0xb4, 0xb2, 0xf1, 0xf1, 0x80, 0xdb, 0x03, 0xf3, 0xc9, 0xb4,
+  0x6e, 0xe2, 0xc0, 0x84, 0xa8, 0x0f, 0x66, 0xc3, 0x5c, 0xaa, 0x74, 0xbc,
+  0xc8, 0xe3, 0x63, 0x29, 0x18, 0xad, 0xcb, 0xe4, 0xcc, 0x5d, 0xc8, 0x3b,
+  0xba, 0x71, 0x5f, 0x39, 0xaa, 0x83, 0x87, 0xe5, 0x5d, 0xec, 0x55, 0x66,
+  0x54, 0x08, 0xea, 0x49, 0x4e, 0x72, 0xd3, 0x24, 0x24, 0xc4, 0x0a, 0xd2,
+  0xc6, 0x68, 0x42, 0x79, 0xe9, 0xb5, 0xe9, 0xf3, 0xc7, 0xca, 0x56, 0x8a,
+  0xeb, 0xf1, 0xa3, 0x03, 0x74, 0x74, 0x26, 0x12, 0x19, 0x19, 0x1a, 0x3b,
+  0xf3, 0xcc, 0xfa, 0x05, 0x67, 0xb5, 0xd5, 0x48, 0x6a, 0x19, 0x71, 0x29,
+  0x25, 0xfa, 0xa3, 0x40, 0xad, 0xab, 0x3c, 0xd4, 0x23, 0x71, 0x39, 0xbf,
+  0x54, 0x98, 0xe5, 0xec, 0x25, 0xbe, 0x30, 0xe0, 0x63, 0xb6, 0x6f, 0x0d,
+  0x35, 0x1d, 0x68, 0xe6, 0xe2, 0xbf, 0xbf, 0x7a, 0x23, 0xa0, 0x42, 0x5f,
+  0x4d, 0xa2, 0xc7, 0x2b, 0x54, 0x27, 0x80, 0xf1, 0x54, 0x65, 0xbd, 0x89,
+  0xec, 0xae, 0xc2, 0x57, 0x74, 0xe6, 0x98, 0x46, 0xbd, 0x16, 0x48, 0x60,
+  0x60, 0x6d, 0x3f, 0x80, 0xe3, 0x0b, 0x59, 0x28, 0xa7, 0x0b, 0x8e, 0x49,
+  0x9d, 0xda, 0x7f, 0x88, 0x41, 0xd5, 0xbd, 0xdc, 0x68, 0x08, 0xd7, 0xdf,
+  0xc9, 0x7f, 0xc2, 0xc2, 0x54, 0x84, 0x24, 0xd3, 0x8a, 0x75, 0xdd, 0x7a,
+  0xeb, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc,
+  0xfc, 0xfc, 0xfc, 0xfc, 0x2e, 0x7e, 0x7e, 0x22, 0x00, 0x14, 0xac, 0x69,
+  0xec, 0x0c, 0xa3, 0xcc, 0x9c, 0xb8, 0x5f, 0xf2, 0x56, 0x07, 0x0f, 0x3f,
+  0x6e, 0x45, 0x3c, 0x96, 0x38, 0x52, 0x58, 0x23, 0x6f, 0x91, 0x10, 0x5a,
+  0x30, 0x6e, 0xe7, 0x61, 0x24, 0x5c, 0x99, 0x8a, 0xae, 0x4f, 0xdc, 0xcb,
+  0x6c, 0x91, 0xfd, 0xfd, 0x2a, 0x09, 0x09, 0x99, 0x99, 0xe9, 0xfb, 0xb2,
+  0xdc, 0x3d, 0x1e, 0x39, 0x32, 0xb1, 0xa1, 0x02, 0x83, 0x0f, 0x41, 0x79,
+  0x72, 0x7f, 0x1b, 0x8b, 0x78, 0xc3, 0xed, 0x8e, 0xb6, 0xb6, 0x9e, 0x9e,
+  0x55, 0xec, 0xcc, 0xa8, 0x66, 0x98, 0xcc, 0x0e, 0x42, 0x15, 0x50, 0x50,
+  0x9b, 0x9b, 0xbc, 0xbc, 0xdd, 0xdd, 0x1b, 0xeb, 0xf7, 0x82, 0xcc, 0x7d,
+  0x1e, 0xa6, 0xfb, 0x0c, 0x38, 0xf0, 0xcc, 0x2a, 0xab, 0xab, 0xdb, 0x61,
+  0xd9, 0x50, 0x53, 0x15, 0x84, 0xf3, 0x14, 0xd7, 0xcb, 0xb4, 0xf5, 0xad,
+  0x0f, 0xa0, 0xf6, 0xcc, 0x63, 0x97, 0xf0, 0xcc, 0x4f, 0x9d, 0x48, 0x43,
+  0xe1, 0x1a, 0x6a, 0xfc, 0xc8, 0xf6, 0xc3, 0xc3, 0x07, 0x3e, 0x09, 0x73,
+  0x91, 0x91, 0x07, 0xcd, 0x61, 0x61, 0x7e, 0x91, 0x80, 0x7d, 0xda, 0x49,
+  0x60, 0x2e, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3,
+  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xda, 0x15, 0x7d, 0x78, 0x6b, 0x1f, 0xe7,
+  0x9d, 0xeb, 0x91, 0xa9, 0xe9, 0x5a, 0xc0, 0x81, 0xea, 0x81, 0x34, 0x6c,
+  0x4d, 0x6c, 0x75, 0x5e, 0xfd, 0x23, 0xae, 0xf6, 0xf6, 0xa8, 0xb2, 0xf7,
+  0x99, 0x2f, 0xd5, 0xb5, 0x98, 0x4f, 0xde, 0x23, 0xd1, 0xda, 0xfc, 0x56,
+  0x2a, 0x56, 0x21, 0x9e, 0x75, 0xdb, 0xf1, 0x11, 0x6d, 0x6b, 0x9b, 0x91,
+  0x82, 0xe5, 0x36, 0x61, 0x0c, 0xa6, 0x88, 0x4a, 0xd0, 0x97, 0x8b, 0x1e,
+  0x35, 0x23, 0xbf, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5,
+  0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xee, 0x8f, 0xd0, 0x9d, 0x9b, 0x8b,
+  0x8b, 0xbe, 0x40, 0x40, 0x7d, 0x30, 0x64, 0x5a, 0xdc, 0xc9, 0x2d, 0x19,
+  0x4d, 0x4f, 0xe6, 0xfb, 0x34, 0xf3, 0x16, 0x42, 0xf6, 0x03, 0x95, 0x49,
+  0x57, 0xe0, 0xb2, 0x86, 0x2f, 0x82, 0xcc, 0x09, 0x3a, 0xdf, 0x3a, 0x59,
+  0xfc, 0x4f, 0x9e, 0xe8, 0xd9, 0xb1, 0x2f, 0xb1, 0x29, 0xba, 0xdb, 0xd9,
+  0x79, 0x55, 0x5b, 0xe0, 0x2d, 0x05, 0xdb, 0x4f, 0x1a, 0xb2, 0xc0, 0xfe,
+  0x9e, 0xf4, 0x9e, 0x3b, 0x2f, 0xe6, 0xe6, 0xee, 0xe6, 0x2e, 0xf8, 0xfa,
+  0xeb, 0x34, 0x4e, 0x87, 0x8d, 0x52, 0xd4, 0xaa, 0x30, 0xa3, 0xc9, 0x0b,
+  0x64, 0x50, 0xac, 0x39, 0xb5, 0xb5, 0xfb, 0x64, 0xfc, 0xaa, 0x86, 0x72,
+  0x50, 0x50, 0xb1, 0xb0, 0xf2, 0xcb, 0xe9, 0x51, 0x51, 0x5c, 0x5c, 0x6f,
+  0x19, 0x21, 0xbd, 0x57, 0x19, 0xeb, 0x61, 0x94, 0x0b, 0x58, 0xb6, 0x55,
+  0x63, 0x75, 0x37, 0x8a, 0xa4, 0x88, 0xaa, 0x63, 0xf4, 0xca, 0x46, 0x2e,
+  0xc2, 0xa8, 0xca, 0x3b, 0x18, 0xe6, 0x67, 0x0a, 0x1d, 0x66, 0xb1, 0x8a,
+  0x68, 0x37, 0x9f, 0x8a, 0xe6, 0x66, 0xb0, 0x74, 0x3f, 0xda, 0x43, 0xa4,
+  0x86, 0xd4, 0x91, 0x6e, 0xd7, 0x2b, 0x86, 0x1e, 0x6e, 0x6b, 0xce, 0xe2,
+  0xfe, 0x8a, 0xac, 0x06, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+  0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x09, 0xaa, 0xb4, 0xa8, 0x6f,
+  0x0e, 0x6e, 0x79, 0xeb, 0x5b, 0xa4, 0xe1, 0x7c, 0xb2, 0x77, 0x4d, 0x9f,
+  0x5b, 0x27, 0xe2, 0xb4, 0x06, 0x06, 0x7b, 0x7b, 0x01, 0x5f, 0x01, 0x01,
+  0x1c, 0xd7, 0x13, 0x26, 0x41, 0x93, 0x3b, 0xcd, 0x52, 0x2e, 0x1a, 0x7d,
+  0x07, 0xbd, 0xa6, 0x5a, 0xf1, 0xc7, 0x3e, 0x7f, 0x5c, 0xcb, 0xc0, 0xb7,
+  0x8f, 0xa7, 0x08, 0xee, 0x2e, 0x4b, 0x87, 0x7e, 0xcb, 0x5a, 0xe4, 0x05,
+  0x0d, 0x02, 0x7a, 0x87, 0xf2, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56,
+  0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0xa3, 0x8e,
+  0x86, 0x38, 0xbd, 0xac, 0xb7, 0x88, 0xf3, 0xf3, 0xd3, 0x7f, 0xab, 0x9e,
+  0x57, 0x02, 0xb7, 0xeb, 0xd3, 0x6e, 0xb2, 0x5c, 0xaa, 0xed, 0x0f, 0xc0,
+  0x52, 0x52, 0x55, 0x0c, 0xd5, 0x94, 0xbd, 0xb8, 0xc0, 0xc0, 0xc0, 0xc0,
+  0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x35,
+  0x78, 0x6f, 0x06, 0xee, 0xf5, 0x83, 0x9a, 0x1d, 0xfd, 0xe7, 0xf2, 0x46,
+  0x47, 0x25, 0xaa, 0xd4, 0xd4, 0x91, 0x8c, 0x8c, 0x40, 0x94, 0x1a, 0xf0,
+  0x42, 0x03, 0xa6, 0xf6, 0xc8, 0xd4, 0xeb, 0x10, 0xab, 0xc8, 0x1f, 0x70,
+  0x83, 0xe2, 0x0a, 0xa0, 0x3f, 0xbf, 0xd8, 0xce, 0x17, 0xcf, 0xf8, 0xb1,
+  0xcb, 0xcb, 0xfb, 0x04, 0xf1, 0xbe, 0x4f, 0x0f, 0x57, 0xa1, 0xdd, 0x0a,
+  0x39, 0xc0, 0xa1, 0xb9, 0x3d, 0xe0, 0xf8, 0x50, 0xc7, 0x60, 0xa4, 0x4f,
+  0xd7, 0xbd, 0xe6, 0xe7, 0xbe, 0x3a, 0x97, 0xdd, 0xde, 0x46, 0xee, 0x1b,
+  0xbe, 0xde, 0xd2, 0x6b, 0x07, 0xcb, 0x43, 0x28, 0x73, 0x41, 0x4b, 0xf8,
+  0xc8, 0x1b, 0xaa, 0x88, 0x80, 0xe2, 0x08, 0x83, 0xcd, 0xd8, 0x80, 0x00,
+  0x2c, 0x40, 0x1e, 0xed, 0xf5, 0xda, 0x42, 0x91, 0xdf, 0x9c, 0x7d, 0xcf,
+  0xfa, 0xa3, 0x63, 0x0d, 0x81, 0x5e, 0x99, 0xb5, 0x50, 0x5d, 0x3f, 0x9d,
+  0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4,
+  0xa4, 0xa4, 0xa4, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9,
+  0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0x6d, 0xe8, 0x46, 0x7c, 0x61, 0x74,
+  0x94, 0x94, 0x4e, 0xc0, 0x7c, 0x90, 0x90, 0x0e, 0x37, 0xaa, 0x03, 0x11,
+  0x11, 0x9d, 0xfc, 0xe0, 0xe0, 0x6c, 0x1d, 0x8f, 0x37, 0xb7, 0x83, 0x7d,
+  0x52, 0x82, 0x12, 0x78, 0x45, 0x29, 0x09, 0x93, 0x09, 0x0a, 0x95, 0xdd,
+  0x27, 0x68, 0x78, 0xee, 0x5f, 0xa3, 0xe9, 0x34, 0x04, 0xe7, 0xa0, 0x27,
+  0x17, 0x16, 0x8d, 0x33, 0x09, 0x63, 0x63, 0x86, 0x89, 0x6b, 0xf3, 0xa2,
+  0xfe, 0x05, 0x2c, 0x40, 0x47, 0x18, 0x9b, 0x89, 0x94, 0x5a, 0x60, 0xb3,
+  0xc8, 0x7e, 0xe3, 0xe8, 0xa0, 0xba, 0x56, 0x11, 0xa7, 0x29, 0x90, 0x57,
+  0x19, 0xbb, 0x01, 0x38, 0xa5, 0xd5, 0x49, 0x9e, 0x72, 0x66, 0x42, 0xe4,
+  0xc6, 0x13, 0xf3, 0x07, 0x08, 0x89, 0x4d, 0x17, 0x88, 0x39, 0xe1, 0xe9,
+  0x19, 0xe8, 0xdf, 0xf2, 0x7a, 0x71, 0x27, 0x2a, 0xef, 0x17, 0xbf, 0x8b,
+  0x8e, 0x61, 0xcc, 0x14, 0xd0, 0x52, 0xd0, 0x0d, 0x73, 0x39, 0x04, 0xd2,
+  0xd2, 0x83, 0xfa, 0x70, 0xfc, 0x38, 0x3d, 0xbe, 0x4e, 0x44, 0xf3, 0x70,
+  0x28, 0x3f, 0x66, 0xdb, 0xca, 0x3f, 0x95, 0x62, 0xd2, 0x67, 0x3d, 0x19,
+  0x7b, 0x34, 0x5b, 0x04, 0x16, 0x3e, 0xe5, 0xf2, 0x86, 0x94, 0x78, 0x6d,
+  0x78, 0x2c, 0x05, 0xf5, 0x3d, 0x04, 0x2c, 0xb0, 0x25, 0x1d, 0x62, 0x1b,
+  0x8a, 0x41, 0xeb, 0x1b, 0x7b, 0xdb, 0x71, 0x65, 0x14, 0xc0, 0x83, 0x9e,
+  0x07, 0x00, 0xe0, 0x0c, 0x85, 0x98, 0xec, 0xc0, 0x53, 0x07, 0xe1, 0x62,
+  0xb2, 0xb2, 0x52, 0x52, 0x3c, 0x0f, 0xaa, 0x80, 0xb0, 0x7c, 0x85, 0x74,
+  0x54, 0x88, 0x6a, 0x96, 0xd0, 0xef, 0xfb, 0x1c, 0xa3, 0x16, 0xb2, 0xaf,
+  0xda, 0x80, 0x47, 0x88, 0x34, 0xa5, 0xb1, 0x45, 0x03, 0xf6, 0xf6, 0x59,
+  0x82, 0x17, 0xb7, 0xb7, 0x1a, 0xd7, 0x6b, 0x60, 0x3a, 0x67, 0x0c, 0x0f,
+  0xd7, 0x30, 0x85, 0x28, 0xa9, 0xee, 0x83, 0x79, 0x6f, 0x9f, 0x7b, 0xb8,
+  0x0f, 0x96, 0x96, 0x54, 0x09, 0x6d, 0xdd, 0xe3, 0x6a, 0x21, 0xed, 0xd7,
+  0xdd, 0x6a, 0xe4, 0xf0, 0x50, 0xcc, 0x7a, 0xc0, 0x4d, 0xf5, 0x49, 0xc4,
+  0xd1, 0x4b, 0x90, 0xf2, 0xaf, 0x31, 0x88, 0x4d, 0x5a, 0x12, 0xdc, 0x7d,
+  0x22, 0xd1, 0xe5, 0xa7, 0xed, 0xed, 0x41, 0x66, 0x2a, 0x75, 0xab, 0xbd,
+  0xf2, 0x7a, 0xca, 0x89, 0x75, 0x1b, 0x26, 0x33, 0xf7, 0x16, 0x41, 0x79,
+  0xe1, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60,
+  0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x6a, 0xc2, 0xc2, 0x5e, 0x5e, 0x67,
+  0x6c, 0xda, 0x70, 0xf2, 0x10, 0x08, 0x58, 0xb3, 0xf4, 0x6b, 0x8a, 0x87,
+  0x41, 0xfa, 0xbc, 0x06, 0x60, 0x7d, 0x6a, 0xe0, 0x7d, 0xde, 0x94, 0x37,
+  0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+  0x37, 0x37, 0xd2, 0x40, 0x14, 0x14, 0xac, 0xb8, 0x50, 0x49, 0x49, 0xb5,
+  0x62, 0xe2, 0x58, 0x9a, 0xad, 0x06, 0x5d, 0x07, 0xb7, 0xd8, 0x2a, 0x52,
+  0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
+  0x88, 0x88, 0x4b, 0xd7, 0x81, 0xa1, 0x1e, 0x70, 0xfa, 0xb9, 0xeb, 0x7d,
+  0xd4, 0x20, 0xbf, 0x77, 0xb2, 0x44, 0xc4, 0x7f, 0xb3, 0x2f, 0x6d, 0x6d,
+  0x7c, 0xc8, 0x24, 0x63, 0x04, 0x6f, 0x4d, 0xb2, 0xc1, 0x37, 0x37, 0x03,
+  0x19, 0x08, 0x08, 0xb4, 0x71, 0x2d, 0x63, 0x1c, 0x04, 0xb8, 0x9f, 0x0a,
+  0x0f, 0x1d, 0x12, 0x90, 0xa4, 0xc8, 0xe2, 0xb5, 0x63, 0xf6, 0x67, 0x68,
+  0x78, 0xf2, 0x51, 0xb4, 0xd7, 0xd6, 0x16, 0xdd, 0x99, 0x4d, 0x24, 0x23,
+  0x75, 0xfd, 0xfd, 0x6b, 0x48, 0xaa, 0x3e, 0x4c, 0x8c, 0x11, 0xb8, 0x9f,
+  0xbe, 0x1c, 0x73, 0x9d, 0xf9, 0xd5, 0xe0, 0x8b, 0x32, 0x4e, 0xba, 0xba,
+  0x65, 0x0a, 0xce, 0x07, 0x7f, 0x11, 0x3f, 0x98, 0xd6, 0xe8, 0xe9, 0x0d,
+  0x7c, 0x44, 0x44, 0xfb, 0x11, 0xe2, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x27, 0x72, 0x87,
+  0x87, 0x7a, 0x53, 0xd0, 0x5f, 0xac, 0xac, 0x7b, 0xbd, 0xbd, 0x5e, 0x19,
+  0x9d, 0x11, 0xa5, 0xf2, 0xd5, 0x69, 0x30, 0x70, 0xe4, 0x50, 0xf3, 0xa3,
+  0xb2, 0x8f, 0xf6, 0xf9, 0xf9, 0x4a, 0x97, 0x02, 0x36, 0x21, 0x06, 0x25,
+  0x18, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8,
+  0xb8, 0x4b, 0x11, 0xac, 0xad, 0x46, 0x4f, 0x2d, 0x22, 0x55, 0x04, 0x8c,
+  0x74, 0xfb, 0x1a, 0xf4, 0xc9, 0x33, 0x37, 0x25, 0x71, 0x23, 0xba, 0x19,
+  0x97, 0x2a, 0x78, 0x87, 0xab, 0x92, 0xaa, 0x09, 0xf1, 0xac, 0x91, 0x25,
+  0xf6, 0xa3, 0xaa, 0xd1, 0xf1, 0xb7, 0xa3, 0x3f, 0xd3, 0xba, 0xba, 0xba,
+  0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0x84, 0xcf,
+  0xb6, 0x1f, 0x73, 0x69, 0x69, 0xf7, 0x1e, 0x88, 0x62, 0x9b, 0x9b, 0x5a,
+  0x5a, 0x1f, 0x39, 0x36, 0x45, 0x1c, 0x95, 0x74, 0x3c, 0xcf, 0x4d, 0xda,
+  0xae, 0x15, 0x94, 0xeb, 0x88, 0xab, 0x80, 0x42, 0xa8, 0xb7, 0xe8, 0x81,
+  0x77, 0xe1, 0x0d, 0x1f, 0x1f, 0x69, 0xc7, 0xea, 0x9e, 0x34, 0x68, 0x8b,
+  0x46, 0xb1, 0x75, 0xd6, 0xb5, 0xb1, 0x19, 0x7d, 0x7d, 0xe7, 0x7e, 0xa0,
+  0xec, 0x62, 0x95, 0x9e, 0xfe, 0x7c, 0x73, 0xa0, 0x80, 0x19, 0xbc, 0x3a,
+  0x94, 0x37, 0x59, 0xfb, 0xfe, 0xca, 0xe8, 0x9c, 0x13, 0x45, 0x48, 0xe3,
+  0x1c, 0xeb, 0x98, 0x61, 0xa8, 0x48, 0x9a, 0xc3, 0x02, 0xd5, 0x19, 0x44,
+  0x93, 0x70, 0x83, 0x7e, 0x1a, 0x07, 0xe0, 0x0e, 0x96, 0xf1, 0x53, 0x0b,
+  0x02, 0xf5, 0x11, 0xc7, 0x31, 0xc4, 0xaf, 0xdf, 0xeb, 0xda, 0x1a, 0x0b,
+  0x87, 0x84, 0x84, 0xbc, 0x61, 0xd5, 0xb6, 0x1a, 0xb3, 0x18, 0x6d, 0x66,
+  0x66, 0x43, 0x7b, 0x6d, 0xb2, 0x5e, 0x74, 0xd1, 0xd1, 0x37, 0x37, 0x90,
+  0x66, 0x1b, 0xed, 0x5d, 0x09, 0x54, 0x54, 0x10, 0x98, 0x71, 0xa3, 0x70,
+  0xfe, 0x75, 0xa0, 0xb6, 0xce, 0x96, 0x79, 0x7d, 0x75, 0x87, 0x87, 0x7b,
+  0x7b, 0xa9, 0xa9, 0xe7, 0xe7, 0x18, 0x3a, 0x0f, 0xb6, 0x8c, 0x7c, 0xcf,
+  0xb0, 0x3e, 0x1f, 0x1f, 0x02, 0x2e, 0x6f, 0xe9, 0x28, 0xa2, 0x82, 0x38,
+  0x93, 0xfd, 0x48, 0x64, 0x49, 0xc4, 0x19, 0x34, 0x82, 0x82, 0xda, 0xda,
+  0xe7, 0xe0, 0x5a, 0x7e, 0x78, 0x75, 0x03, 0x7d, 0x66, 0x31, 0xe2, 0x16,
+  0x48, 0x31, 0x50, 0x41, 0x31, 0xf0, 0x40, 0x12, 0x47, 0xb3, 0x6a, 0x96,
+  0x99, 0x75, 0x6c, 0xed, 0xf1, 0xbf, 0xec, 0x73, 0xfa, 0x7b, 0xc7, 0xda,
+  0xf2, 0xd0, 0xa0, 0x07, 0x45, 0xb2, 0x7d, 0x14, 0xa6, 0x23, 0x4e, 0xcc,
+  0x30, 0xef, 0xb1, 0x53, 0x3c, 0xb6, 0xb0, 0xe1, 0x8a, 0xb8, 0x98, 0x8e,
+  0x59, 0x6c, 0x3c, 0x42, 0x16, 0xfc, 0x2b, 0x1c, 0x75, 0x44, 0x79, 0x0d,
+  0x90, 0xfd, 0x6b, 0xa6, 0x34, 0xef, 0x22, 0xb0, 0x36, 0xa8, 0x56, 0x5f,
+  0x74, 0x4a, 0x8a, 0x84, 0x40, 0x26, 0x8e, 0xf8, 0xe8, 0xfa, 0x9d, 0x89,
+  0x45, 0x01, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+  0x36, 0x36, 0x36, 0x73, 0x77, 0x2b, 0x77, 0xc6, 0x23, 0xd2, 0xa2, 0x54,
+  0x4c, 0x01, 0xf8, 0xc3, 0xbf, 0xf4, 0x35, 0x19, 0xd5, 0x2c, 0xd8, 0x1b,
+  0x84, 0x5d, 0x2c, 0xad, 0xb7, 0xc4, 0xc4, 0x4a, 0x4a, 0x06, 0x00, 0x00,
+  0x16, 0x00, 0x2c, 0x00, 0x40, 0x00, 0x54, 0x00, 0x6b, 0x00, 0x81, 0x00,
+  0x00, 0x00, 0x3e, 0x00, 0x7c, 0x00, 0xba, 0x00, 0xc7, 0x00, 0xda, 0x00,
+  0xed, 0x00, 0x01, 0x01, 0x00, 0x00, 0x3c, 0x00, 0x79, 0x00, 0xb5, 0x00,
+  0xf2, 0x00, 0x2e, 0x01, 0x6b, 0x01, 0x84, 0x01, 0x9c, 0x01, 0xb4, 0x01,
+  0xcb, 0x01, 0xe1, 0x01, 0xf7, 0x01, 0x0c, 0x02, 0x24, 0x02, 0x3b, 0x02,
+  0x51, 0x02, 0x65, 0x02, 0x6e, 0x02, 0x75, 0x02, 0x00, 0x00, 0x11, 0x00,
+  0x25, 0x00, 0x3f, 0x00, 0x49, 0x00, 0x52, 0x00, 0x59, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x28, 0x00, 0x41, 0x00, 0x5a, 0x00, 0x72, 0x00, 0x7c, 0x00,
+  0x86, 0x00, 0x00, 0x00, 0x12, 0x00, 0x1d, 0x00, 0x28, 0x00, 0x3c, 0x00,
+  0x4e, 0x00, 0x67, 0x00, 0x7e, 0x00, 0x91, 0x00, 0xa2, 0x00, 0xac, 0x00,
+  0xb6, 0x00, 0xc0, 0x00, 0xca, 0x00, 0xd7, 0x00, 0xe4, 0x00, 0xeb, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x17, 0x00, 0x29, 0x00, 0x3e, 0x00, 0x55, 0x00,
+  0x75, 0x00, 0x83, 0x00, 0x90, 0x00, 0x9c, 0x00, 0xa7, 0x00, 0xb3, 0x00,
+  0xbe, 0x00, 0xcb, 0x00, 0xd7, 0x00, 0xe4, 0x00, 0xf0, 0x00, 0xfc, 0x00,
+  0x08, 0x01, 0x14, 0x01, 0x1f, 0x01, 0x2d, 0x01, 0x3a, 0x01, 0x45, 0x01,
+  0x4f, 0x01, 0x5c, 0x01, 0x68, 0x01, 0x73, 0x01, 0x7d, 0x01, 0x8a, 0x01,
+  0x96, 0x01, 0x9d, 0x01, 0xa8, 0x01, 0xb3, 0x01, 0xba, 0x01, 0xc3, 0x01,
+  0xcb, 0x01, 0xd5, 0x01, 0xdf, 0x01, 0xeb, 0x01, 0xff, 0x01, 0x00, 0x00,
+  0x0e, 0x00, 0x1c, 0x00, 0x2a, 0x00, 0x44, 0x00, 0x5d, 0x00, 0x79, 0x00,
+  0x96, 0x00, 0xb2, 0x00, 0xcd, 0x00, 0xe7, 0x00, 0x01, 0x01, 0x1a, 0x01,
+  0x34, 0x01, 0x4d, 0x01, 0x67, 0x01, 0x84, 0x01, 0x9f, 0x01, 0xb9, 0x01,
+  0xcd, 0x01, 0xdf, 0x01, 0xe7, 0x01, 0xf3, 0x01, 0xff, 0x01, 0x07, 0x02,
+  0x0f, 0x02, 0x17, 0x02, 0x1f, 0x02, 0x29, 0x02, 0x00, 0x00, 0x10, 0x00,
+  0x2a, 0x00, 0x43, 0x00, 0x4c, 0x00, 0x55, 0x00, 0x61, 0x00, 0x00, 0x00,
+  0x1b, 0x00, 0x2e, 0x00, 0x37, 0x00, 0x43, 0x00, 0x50, 0x00, 0x5d, 0x00,
+  0x6a, 0x00, 0x77, 0x00, 0x84, 0x00, 0x91, 0x00, 0x9e, 0x00, 0xab, 0x00,
+  0xb3, 0x00, 0xb9, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x12, 0x00, 0x25, 0x00,
+  0x38, 0x00, 0x49, 0x00, 0x52, 0x00, 0x5c, 0x00, 0x6a, 0x00, 0x74, 0x00,
+  0x7d, 0x00, 0x86, 0x00, 0x94, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1b, 0x00,
+  0x28, 0x00, 0x46, 0x00, 0x51, 0x00, 0x5c, 0x00, 0x67, 0x00, 0x6f, 0x00,
+  0x7e, 0x00, 0x86, 0x00, 0x92, 0x00, 0x9b, 0x00, 0xaa, 0x00, 0xb9, 0x00,
+  0xc8, 0x00, 0xd7, 0x00, 0xe6, 0x00, 0xf5, 0x00, 0x04, 0x01, 0x0c, 0x01,
+  0x14, 0x01, 0x1c, 0x01, 0x24, 0x01, 0x2c, 0x01, 0x34, 0x01, 0x42, 0x01,
+  0x4a, 0x01, 0x52, 0x01, 0x5a, 0x01, 0x63, 0x01, 0x72, 0x01, 0x7a, 0x01,
+  0x83, 0x01, 0x8c, 0x01, 0x94, 0x01, 0x9c, 0x01, 0xa2, 0x01, 0xb2, 0x01,
+  0xc2, 0x01, 0xd1, 0x01, 0x00, 0x00, 0x13, 0x00, 0x25, 0x00, 0x3d, 0x00,
+  0x00, 0x00, 0x0a, 0x00, 0x1c, 0x00, 0x2b, 0x00, 0x3a, 0x00, 0x49, 0x00,
+  0x61, 0x00, 0x6e, 0x00, 0x7b, 0x00, 0x88, 0x00, 0x95, 0x00, 0xa2, 0x00,
+  0xaf, 0x00, 0xbc, 0x00, 0xc9, 0x00, 0xd6, 0x00, 0xe3, 0x00, 0xf0, 0x00,
+  0xf8, 0x00, 0x03, 0x01, 0x0a, 0x01, 0x12, 0x01, 0x1a, 0x01, 0x22, 0x01,
+  0x2a, 0x01, 0x00, 0x00, 0x14, 0x00, 0x2e, 0x00, 0x3c, 0x00, 0x4a, 0x00,
+  0x58, 0x00, 0x66, 0x00, 0x74, 0x00, 0x82, 0x00, 0x90, 0x00, 0x9e, 0x00,
+  0xac, 0x00, 0xba, 0x00, 0xc8, 0x00, 0xd6, 0x00, 0xe4, 0x00, 0xf2, 0x00,
+  0x00, 0x01, 0x0e, 0x01, 0x1c, 0x01, 0x2a, 0x01, 0x38, 0x01, 0x46, 0x01,
+  0x54, 0x01, 0x62, 0x01, 0x70, 0x01, 0x7e, 0x01, 0x8c, 0x01, 0x9a, 0x01,
+  0xa8, 0x01, 0xb6, 0x01, 0xc4, 0x01, 0xd2, 0x01, 0xe0, 0x01, 0xee, 0x01,
+  0xfc, 0x01, 0x0a, 0x02, 0x18, 0x02, 0x26, 0x02, 0x30, 0x02, 0x3b, 0x02,
+  0x42, 0x02, 0x49, 0x02, 0x51, 0x02, 0x58, 0x02, 0x00, 0x00, 0x11, 0x00,
+  0x22, 0x00, 0x4d, 0x00, 0x79, 0x00, 0xa3, 0x00, 0xd0, 0x00, 0xfe, 0x00,
+  0x2d, 0x01, 0x5a, 0x01, 0x86, 0x01, 0xb3, 0x01, 0xde, 0x01, 0x09, 0x02,
+  0x35, 0x02, 0x5f, 0x02, 0x8a, 0x02, 0xb6, 0x02, 0xe0, 0x02, 0x0d, 0x03,
+  0x38, 0x03, 0x66, 0x03, 0x92, 0x03, 0xbf, 0x03, 0xea, 0x03, 0x16, 0x04,
+  0x40, 0x04, 0x4f, 0x04, 0x5f, 0x04, 0x6f, 0x04, 0x7f, 0x04, 0x8f, 0x04,
+  0xa8, 0x04, 0xc3, 0x04, 0xdd, 0x04, 0xe6, 0x04, 0xee, 0x04, 0xf6, 0x04,
+  0xfe, 0x04, 0x07, 0x05, 0x10, 0x05, 0x1d, 0x05, 0x2a, 0x05, 0x33, 0x05,
+  0x3b, 0x05, 0x41, 0x05, 0x00, 0x00, 0x18, 0x00, 0x31, 0x00, 0x3c, 0x00,
+  0x45, 0x00, 0x4f, 0x00, 0x58, 0x00, 0x61, 0x00, 0x6b, 0x00, 0x74, 0x00,
+  0x7d, 0x00, 0x8a, 0x00, 0x97, 0x00, 0xa4, 0x00, 0xb1, 0x00, 0xc0, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x17, 0x00, 0x22, 0x00, 0x30, 0x00, 0x39, 0x00,
+  0x41, 0x00, 0x4f, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x24, 0x00,
+  0x2d, 0x00, 0x3c, 0x00, 0x46, 0x00, 0x50, 0x00, 0x5c, 0x00, 0x68, 0x00,
+  0x78, 0x00, 0x82, 0x00, 0x89, 0x00, 0x00, 0x00, 0x11, 0x00, 0x1e, 0x00,
+  0x2b, 0x00, 0x36, 0x00, 0x4d, 0x00, 0x64, 0x00, 0x6a, 0x00, 0x70, 0x00,
+  0x78, 0x00, 0x00, 0x00, 0x13, 0x00, 0x27, 0x00, 0x3b, 0x00, 0x4f, 0x00,
+  0x62, 0x00, 0x6b, 0x00, 0x75, 0x00, 0x7f, 0x00, 0x85, 0x00, 0x8b, 0x00,
+  0x9c, 0x00, 0xa6, 0x00, 0xaf, 0x00, 0xb5, 0x00, 0x00, 0x00, 0x1f, 0x00,
+  0x2a, 0x00, 0x38, 0x00, 0x4b, 0x00, 0x63, 0x00, 0x6e, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x28, 0x00, 0x31, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x0d, 0x00,
+  0x19, 0x00, 0x30, 0x00, 0x46, 0x00, 0x51, 0x00, 0x5c, 0x00, 0x67, 0x00,
+  0x72, 0x00, 0x7d, 0x00, 0x88, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1f, 0x00,
+  0x28, 0x00, 0x31, 0x00, 0x38, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x0b, 0x00,
+  0x16, 0x00, 0x21, 0x00, 0x28, 0x00, 0x33, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x22, 0x00, 0x34, 0x00, 0x47, 0x00, 0x5b, 0x00, 0x6d, 0x00, 0x76, 0x00,
+  0x7f, 0x00, 0x88, 0x00, 0x91, 0x00, 0x9a, 0x00, 0xa4, 0x00, 0xaf, 0x00,
+  0xba, 0x00, 0xc5, 0x00, 0xce, 0x00, 0xd8, 0x00, 0xe2, 0x00, 0xed, 0x00,
+  0xf7, 0x00, 0x01, 0x01, 0x0b, 0x01, 0x15, 0x01, 0x1f, 0x01, 0x29, 0x01,
+  0x33, 0x01, 0x3d, 0x01, 0x47, 0x01, 0x51, 0x01, 0x5a, 0x01, 0x00, 0x00,
+  0x08, 0x00, 0x10, 0x00, 0x17, 0x00, 0x1e, 0x00, 0x25, 0x00, 0x35, 0x00,
+  0x00, 0x00, 0x30, 0x00, 0x3d, 0x00, 0x53, 0x00, 0x68, 0x00, 0x7d, 0x00,
+  0x91, 0x00, 0x9d, 0x00, 0xa7, 0x00, 0xaf, 0x00, 0xb9, 0x00, 0xc0, 0x00,
+  0xc7, 0x00, 0xce, 0x00, 0xd5, 0x00, 0xdd, 0x00, 0x00, 0x00, 0x31, 0x00,
+  0x46, 0x00, 0x4f, 0x00, 0x00, 0x00, 0x09, 0x00, 0x21, 0x00, 0x2f, 0x00,
+  0x39, 0x00, 0x43, 0x00, 0x4b, 0x00, 0x56, 0x00, 0x00, 0x00, 0x0a, 0x00,
+  0x19, 0x00, 0x27, 0x00, 0x36, 0x00, 0x40, 0x00, 0x4a, 0x00, 0x55, 0x00,
+  0x61, 0x00, 0x68, 0x00, 0x6f, 0x00, 0x76, 0x00, 0x7e, 0x00, 0x87, 0x00,
+  0x8e, 0x00, 0x99, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x16, 0x00, 0x23, 0x00,
+  0x30, 0x00, 0x44, 0x00, 0x59, 0x00, 0x74, 0x00, 0x8c, 0x00, 0xa3, 0x00,
+  0xba, 0x00, 0xd4, 0x00, 0xed, 0x00, 0x05, 0x01, 0x18, 0x01, 0x2a, 0x01,
+  0x43, 0x01, 0x67, 0x01, 0x8b, 0x01, 0x9e, 0x01, 0xa8, 0x01, 0xb2, 0x01,
+  0xbc, 0x01, 0xc6, 0x01, 0xd0, 0x01, 0xda, 0x01, 0xe4, 0x01, 0xee, 0x01,
+  0xf8, 0x01, 0x02, 0x02, 0x0c, 0x02, 0x16, 0x02, 0x20, 0x02, 0x2a, 0x02,
+  0x34, 0x02, 0x3e, 0x02, 0x47, 0x02, 0x51, 0x02, 0x5b, 0x02, 0x65, 0x02,
+  0x6f, 0x02, 0x79, 0x02, 0x83, 0x02, 0x8d, 0x02, 0x94, 0x02, 0x9b, 0x02,
+  0xa2, 0x02, 0xac, 0x02, 0xbb, 0x02, 0x00, 0x00, 0x0f, 0x00, 0x24, 0x00,
+  0x3a, 0x00, 0x55, 0x00, 0x70, 0x00, 0x91, 0x00, 0xb0, 0x00, 0xc5, 0x00,
+  0xd0, 0x00, 0xdb, 0x00, 0xe6, 0x00, 0xef, 0x00, 0xf8, 0x00, 0x03, 0x01,
+  0x0b, 0x01, 0x16, 0x01, 0x1e, 0x01, 0x27, 0x01, 0x2f, 0x01, 0x00, 0x00,
+  0x0c, 0x00, 0x18, 0x00, 0x2e, 0x00, 0x43, 0x00, 0x4d, 0x00, 0x5c, 0x00,
+  0x00, 0x00, 0x0f, 0x00, 0x2b, 0x00, 0x48, 0x00, 0x64, 0x00, 0x7f, 0x00,
+  0x99, 0x00, 0xb3, 0x00, 0xcc, 0x00, 0xe6, 0x00, 0xff, 0x00, 0x19, 0x01,
+  0x36, 0x01, 0x51, 0x01, 0x6b, 0x01, 0x81, 0x01, 0x91, 0x01, 0x99, 0x01,
+  0xa1, 0x01, 0xaa, 0x01, 0x00, 0x00, 0x13, 0x00, 0x24, 0x00, 0x30, 0x00,
+  0x39, 0x00, 0x42, 0x00, 0x4b, 0x00, 0x57, 0x00, 0x66, 0x00, 0x00, 0x00,
+  0x34, 0x00, 0x40, 0x00, 0x4c, 0x00, 0x60, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x22, 0x00, 0x36, 0x00, 0x4d, 0x00, 0x63, 0x00, 0x6e, 0x00, 0x79, 0x00,
+  0x84, 0x00, 0x8f, 0x00, 0x9a, 0x00, 0xa5, 0x00, 0xb0, 0x00, 0xbb, 0x00,
+  0xc6, 0x00, 0xd1, 0x00, 0xdc, 0x00, 0xe7, 0x00, 0xf2, 0x00, 0xfd, 0x00,
+  0x08, 0x01, 0x13, 0x01, 0x1e, 0x01, 0x29, 0x01, 0x34, 0x01, 0x3f, 0x01,
+  0x4a, 0x01, 0x55, 0x01, 0x60, 0x01, 0x6b, 0x01, 0x76, 0x01, 0x81, 0x01,
+  0x8c, 0x01, 0x97, 0x01, 0xa2, 0x01, 0xad, 0x01, 0xb8, 0x01, 0xc3, 0x01,
+  0xce, 0x01, 0xd9, 0x01, 0xe4, 0x01, 0xef, 0x01, 0xfa, 0x01, 0x05, 0x02,
+  0x10, 0x02, 0x1b, 0x02, 0x26, 0x02, 0x31, 0x02, 0x3c, 0x02, 0x47, 0x02,
+  0x55, 0x02, 0x5f, 0x02, 0x69, 0x02, 0x73, 0x02, 0x7d, 0x02, 0x88, 0x02,
+  0x92, 0x02, 0x9b, 0x02, 0xa5, 0x02, 0xb2, 0x02, 0x00, 0x00, 0x17, 0x00,
+  0x2d, 0x00, 0x34, 0x00, 0x3a, 0x00, 0x40, 0x00, 0x4a, 0x00, 0x50, 0x00,
+  0x59, 0x00, 0x62, 0x00, 0x6d, 0x00, 0x76, 0x00, 0x7f, 0x00, 0x8b, 0x00,
+  0x94, 0x00, 0xaf, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x32, 0x00, 0x47, 0x00,
+  0x5b, 0x00, 0x6e, 0x00, 0x78, 0x00, 0x84, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x1e, 0x00, 0x33, 0x00, 0x47, 0x00, 0x5a, 0x00, 0x61, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x22, 0x00, 0x34, 0x00, 0x48, 0x00, 0x5a, 0x00, 0x63, 0x00,
+  0x6a, 0x00, 0x71, 0x00, 0x7a, 0x00, 0x83, 0x00, 0x8c, 0x00, 0x95, 0x00,
+  0x9e, 0x00, 0xa7, 0x00, 0xae, 0x00, 0xb5, 0x00, 0xbd, 0x00, 0xc7, 0x00,
+  0xce, 0x00, 0xd5, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x3d, 0x00, 0x5a, 0x00,
+  0x7a, 0x00, 0x9b, 0x00, 0xbd, 0x00, 0xdd, 0x00, 0xfc, 0x00, 0x1c, 0x01,
+  0x3a, 0x01, 0x58, 0x01, 0x77, 0x01, 0x94, 0x01, 0xb2, 0x01, 0xd1, 0x01,
+  0xee, 0x01, 0x0e, 0x02, 0x2c, 0x02, 0x4d, 0x02, 0x6c, 0x02, 0x8c, 0x02,
+  0xaa, 0x02, 0xba, 0x02, 0xc9, 0x02, 0xe4, 0x02, 0xed, 0x02, 0xf4, 0x02,
+  0xfd, 0x02, 0x06, 0x03, 0x16, 0x03, 0x00, 0x00, 0x2e, 0x00, 0x3d, 0x00,
+  0x4d, 0x00, 0x5a, 0x00, 0x67, 0x00, 0x74, 0x00, 0x80, 0x00, 0x93, 0x00,
+  0xa2, 0x00, 0xb4, 0x00, 0xc6, 0x00, 0xd8, 0x00, 0xe9, 0x00, 0xfa, 0x00,
+  0x03, 0x01, 0x0a, 0x01, 0x00, 0x00, 0x0b, 0x00, 0x1a, 0x00, 0x31, 0x00,
+  0x40, 0x00, 0x47, 0x00, 0x50, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x20, 0x00,
+  0x31, 0x00, 0x42, 0x00, 0x53, 0x00, 0x5b, 0x00, 0x69, 0x00, 0x77, 0x00,
+  0x80, 0x00, 0x8e, 0x00, 0x95, 0x00, 0xa4, 0x00, 0xb3, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x23, 0x00, 0x39, 0x00, 0x55, 0x00, 0x6f, 0x00, 0x7b, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x1c, 0x00, 0x36, 0x00, 0x4f, 0x00, 0x68, 0x00,
+  0x7a, 0x00, 0x95, 0x00, 0xaf, 0x00, 0xca, 0x00, 0xd7, 0x00, 0xe1, 0x00,
+  0xee, 0x00, 0xf6, 0x00, 0x03, 0x01, 0x0b, 0x01, 0x00, 0x00, 0x0f, 0x00,
+  0x1a, 0x00, 0x26, 0x00, 0x2e, 0x00, 0x36, 0x00, 0x43, 0x00, 0x4b, 0x00,
+  0x53, 0x00, 0x5c, 0x00, 0x64, 0x00, 0x6d, 0x00, 0x77, 0x00, 0x80, 0x00,
+  0x88, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x2a, 0x00, 0x3a, 0x00, 0x4b, 0x00,
+  0x5c, 0x00, 0x7d, 0x00, 0x9f, 0x00, 0xb4, 0x00, 0xc9, 0x00, 0xde, 0x00,
+  0xe8, 0x00, 0xf1, 0x00, 0xfb, 0x00, 0x06, 0x01, 0x14, 0x01, 0x1c, 0x01,
+  0x27, 0x01, 0x2f, 0x01, 0x00, 0x00, 0x12, 0x00, 0x2e, 0x00, 0x4b, 0x00,
+  0x67, 0x00, 0x82, 0x00, 0x9c, 0x00, 0xb6, 0x00, 0xcf, 0x00, 0xe9, 0x00,
+  0x02, 0x01, 0x1d, 0x01, 0x37, 0x01, 0x54, 0x01, 0x70, 0x01, 0x8b, 0x01,
+  0xa6, 0x01, 0xc0, 0x01, 0xd6, 0x01, 0xf6, 0x01, 0x16, 0x02, 0x21, 0x02,
+  0x27, 0x02, 0x32, 0x02, 0x38, 0x02, 0x00, 0x00, 0x13, 0x00, 0x22, 0x00,
+  0x2b, 0x00, 0x00, 0x00, 0x13, 0x00, 0x21, 0x00, 0x2a, 0x00, 0x33, 0x00,
+  0x3b, 0x00, 0x00, 0x00, 0x11, 0x00, 0x1d, 0x00, 0x29, 0x00, 0x35, 0x00,
+  0x48, 0x00, 0x5a, 0x00, 0x70, 0x00, 0x79, 0x00, 0x85, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x10, 0x00, 0x27, 0x00, 0x3e, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x25, 0x00, 0x3e, 0x00, 0x57, 0x00, 0x6b, 0x00, 0x7e, 0x00,
+  0x87, 0x00, 0x91, 0x00, 0x9b, 0x00, 0xa6, 0x00, 0xb0, 0x00, 0xb9, 0x00,
+  0xc2, 0x00, 0xcd, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x1b, 0x00,
+  0x23, 0x00, 0x2b, 0x00, 0x33, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x1d, 0x00,
+  0x2f, 0x00, 0x36, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x21, 0x00,
+  0x3d, 0x00, 0x59, 0x00, 0x72, 0x00, 0x7e, 0x00, 0x86, 0x00, 0x92, 0x00,
+  0x9a, 0x00, 0xa2, 0x00, 0xaa, 0x00, 0xb3, 0x00, 0xbf, 0x00, 0xc7, 0x00,
+  0xcf, 0x00, 0xd8, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x1e, 0x00, 0x35, 0x00,
+  0x4d, 0x00, 0x65, 0x00, 0x7c, 0x00, 0x92, 0x00, 0x9a, 0x00, 0xa3, 0x00,
+  0xab, 0x00, 0xb8, 0x00, 0xc5, 0x00, 0xd2, 0x00, 0xdf, 0x00, 0xe9, 0x00,
+  0xf2, 0x00, 0xfc, 0x00, 0x06, 0x01, 0x00, 0x00, 0x0f, 0x00, 0x21, 0x00,
+  0x3b, 0x00, 0x54, 0x00, 0x5c, 0x00, 0x64, 0x00, 0x6b, 0x00, 0x73, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x1c, 0x00, 0x2b, 0x00, 0x41, 0x00, 0x54, 0x00,
+  0x5b, 0x00, 0x62, 0x00, 0x69, 0x00, 0x70, 0x00, 0x77, 0x00, 0x80, 0x00,
+  0x00, 0x00, 0x0f, 0x00, 0x1e, 0x00, 0x2c, 0x00, 0x3d, 0x00, 0x54, 0x00,
+  0x6a, 0x00, 0x80, 0x00, 0x8b, 0x00, 0x96, 0x00, 0xa1, 0x00, 0xac, 0x00,
+  0xb7, 0x00, 0xc2, 0x00, 0xcd, 0x00, 0xd8, 0x00, 0xe3, 0x00, 0xee, 0x00,
+  0xf9, 0x00, 0x04, 0x01, 0x0f, 0x01, 0x1a, 0x01, 0x25, 0x01, 0x30, 0x01,
+  0x3b, 0x01, 0x46, 0x01, 0x51, 0x01, 0x5c, 0x01, 0x67, 0x01, 0x72, 0x01,
+  0x7d, 0x01, 0x88, 0x01, 0x93, 0x01, 0x9e, 0x01, 0xa9, 0x01, 0xb4, 0x01,
+  0xbf, 0x01, 0xca, 0x01, 0xd5, 0x01, 0xe0, 0x01, 0xeb, 0x01, 0xf6, 0x01,
+  0x01, 0x02, 0x0c, 0x02, 0x17, 0x02, 0x22, 0x02, 0x2d, 0x02, 0x38, 0x02,
+  0x40, 0x02, 0x49, 0x02, 0x51, 0x02, 0x59, 0x02, 0x61, 0x02, 0x69, 0x02,
+  0x72, 0x02, 0x79, 0x02, 0x00, 0x00, 0x11, 0x00, 0x25, 0x00, 0x41, 0x00,
+  0x5d, 0x00, 0x66, 0x00, 0x6f, 0x00, 0x81, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x16, 0x00, 0x26, 0x00, 0x3c, 0x00, 0x53, 0x00, 0x62, 0x00, 0x00, 0x00,
+  0x1e, 0x00, 0x3d, 0x00, 0x5b, 0x00, 0x78, 0x00, 0x94, 0x00, 0xb0, 0x00,
+  0xcb, 0x00, 0xe7, 0x00, 0x02, 0x01, 0x1e, 0x01, 0x3d, 0x01, 0x5a, 0x01,
+  0x76, 0x01, 0x80, 0x01, 0x8c, 0x01, 0x96, 0x01, 0xa0, 0x01, 0xaa, 0x01,
+  0xb4, 0x01, 0xbe, 0x01, 0xc8, 0x01, 0xd2, 0x01, 0xdc, 0x01, 0xe6, 0x01,
+  0xf0, 0x01, 0x00, 0x00, 0x15, 0x00, 0x21, 0x00, 0x42, 0x00, 0x64, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x20, 0x00, 0x38, 0x00, 0x4f, 0x00, 0x58, 0x00,
+  0x61, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x28, 0x00, 0x3e, 0x00, 0x52, 0x00,
+  0x64, 0x00, 0x6d, 0x00, 0x76, 0x00, 0x7d, 0x00, 0x83, 0x00, 0x89, 0x00,
+  0x96, 0x00, 0xa6, 0x00, 0xb4, 0x00, 0xbe, 0x00, 0x00, 0x00, 0x13, 0x00,
+  0x1d, 0x00, 0x00, 0x00, 0x12, 0x00, 0x25, 0x00, 0x2f, 0x00, 0x39, 0x00,
+  0x40, 0x00, 0x49, 0x00, 0x00, 0x00, 0x26, 0x00, 0x54, 0x00, 0x77, 0x00,
+  0x95, 0x00, 0xac, 0x00, 0xc3, 0x00, 0xd9, 0x00, 0xf1, 0x00, 0x01, 0x01,
+  0x0e, 0x01, 0x20, 0x01, 0x2b, 0x01, 0x41, 0x01, 0x4c, 0x01, 0x59, 0x01,
+  0x5f, 0x01, 0x6b, 0x01, 0x79, 0x01, 0x7f, 0x01, 0x00, 0x00, 0x09, 0x00,
+  0x13, 0x00, 0x2d, 0x00, 0x43, 0x00, 0x56, 0x00, 0x62, 0x00, 0x6c, 0x00,
+  0x72, 0x00, 0x82, 0x00, 0x00, 0x00, 0x26, 0x00, 0x54, 0x00, 0x76, 0x00,
+  0x94, 0x00, 0xaa, 0x00, 0xc1, 0x00, 0xd9, 0x00, 0xed, 0x00, 0x01, 0x01,
+  0x11, 0x01, 0x23, 0x01, 0x34, 0x01, 0x46, 0x01, 0x58, 0x01, 0x6a, 0x01,
+  0x7c, 0x01, 0x94, 0x01, 0xa2, 0x01, 0xaf, 0x01, 0xbb, 0x01, 0xc2, 0x01,
+  0xcf, 0x01, 0x00, 0x00, 0x12, 0x00, 0x23, 0x00, 0x2c, 0x00, 0x35, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x1d, 0x00, 0x2e, 0x00, 0x3e, 0x00, 0x4e, 0x00,
+  0x5e, 0x00, 0x6f, 0x00, 0x7d, 0x00, 0x96, 0x00, 0xad, 0x00, 0xc2, 0x00,
+  0xd5, 0x00, 0xe1, 0x00, 0xea, 0x00, 0xf1, 0x00, 0x00, 0x00, 0x1a, 0x00,
+  0x32, 0x00, 0x3e, 0x00, 0x46, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x15, 0x00,
+  0x2c, 0x00, 0x33, 0x00, 0x3a, 0x00, 0x46, 0x00, 0x4f, 0x00, 0x58, 0x00,
+  0x62, 0x00, 0x69, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x1a, 0x00, 0x30, 0x00,
+  0x3f, 0x00, 0x52, 0x00, 0x64, 0x00, 0x6c, 0x00, 0x77, 0x00, 0x82, 0x00,
+  0x8a, 0x00, 0x92, 0x00, 0x9a, 0x00, 0xa2, 0x00, 0xac, 0x00, 0xb4, 0x00,
+  0xbc, 0x00, 0xc4, 0x00, 0xcd, 0x00, 0xd5, 0x00, 0xdd, 0x00, 0xe6, 0x00,
+  0xee, 0x00, 0xf6, 0x00, 0xfe, 0x00, 0x06, 0x01, 0x0e, 0x01, 0x18, 0x01,
+  0x1f, 0x01, 0x00, 0x00, 0x19, 0x00, 0x2a, 0x00, 0x39, 0x00, 0x4a, 0x00,
+  0x62, 0x00, 0x00, 0x00, 0x10, 0x00, 0x26, 0x00, 0x35, 0x00, 0x3f, 0x00,
+  0x45, 0x00, 0x00, 0x00, 0x11, 0x00, 0x24, 0x00, 0x2d, 0x00, 0x36, 0x00,
+  0x3f, 0x00, 0x48, 0x00, 0x51, 0x00, 0x5a, 0x00, 0x60, 0x00, 0x66, 0x00,
+  0x6c, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1c, 0x00, 0x25, 0x00, 0x2f, 0x00,
+  0x39, 0x00, 0x43, 0x00, 0x00, 0x00, 0x12, 0x00, 0x1f, 0x00, 0x29, 0x00,
+  0x37, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x1c, 0x00, 0x2b, 0x00, 0x3a, 0x00,
+  0x4d, 0x00, 0x55, 0x00, 0x60, 0x00, 0x00, 0x00, 0x12, 0x00, 0x2b, 0x00,
+  0x3f, 0x00, 0x51, 0x00, 0x00, 0x00, 0x20, 0x00, 0x2b, 0x00, 0x40, 0x00,
+  0x53, 0x00, 0x67, 0x00, 0x7a, 0x00, 0x8f, 0x00, 0xa3, 0x00, 0xac, 0x00,
+  0xb6, 0x00, 0xc0, 0x00, 0xcb, 0x00, 0xd2, 0x00, 0xdb, 0x00, 0xe4, 0x00,
+  0xed, 0x00, 0xf6, 0x00, 0xff, 0x00, 0x08, 0x01, 0x17, 0x01, 0x00, 0x00,
+  0x1d, 0x00, 0x44, 0x00, 0x65, 0x00, 0x8c, 0x00, 0xa7, 0x00, 0xbb, 0x00,
+  0xd4, 0x00, 0xe5, 0x00, 0xf9, 0x00, 0x04, 0x01, 0x0a, 0x01, 0x16, 0x01,
+  0x22, 0x01, 0x00, 0x00, 0x20, 0x00, 0x33, 0x00, 0x46, 0x00, 0x57, 0x00,
+  0x75, 0x00, 0x93, 0x00, 0xaa, 0x00, 0xc8, 0x00, 0xe6, 0x00, 0xf4, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x43, 0x00, 0x63, 0x00, 0x8a, 0x00,
+  0xa5, 0x00, 0xbe, 0x00, 0xd7, 0x00, 0xeb, 0x00, 0xf7, 0x00, 0x10, 0x01,
+  0x30, 0x01, 0x51, 0x01, 0x6d, 0x01, 0x88, 0x01, 0xa8, 0x01, 0xb3, 0x01,
+  0xba, 0x01, 0xc1, 0x01, 0xc8, 0x01, 0xcf, 0x01, 0xd6, 0x01, 0xde, 0x01,
+  0x00, 0x00, 0x1e, 0x00, 0x2c, 0x00, 0x3b, 0x00, 0x4e, 0x00, 0x5e, 0x00,
+  0x72, 0x00, 0x8c, 0x00, 0xa6, 0x00, 0xb2, 0x00, 0xba, 0x00, 0xc2, 0x00,
+  0xcb, 0x00, 0xd4, 0x00, 0xdc, 0x00, 0xe4, 0x00, 0xec, 0x00, 0xf4, 0x00,
+  0xfc, 0x00, 0x04, 0x01, 0x0d, 0x01, 0x15, 0x01, 0x1d, 0x01, 0x25, 0x01,
+  0x2e, 0x01, 0x36, 0x01, 0x3f, 0x01, 0x47, 0x01, 0x4f, 0x01, 0x57, 0x01,
+  0x5f, 0x01, 0x00, 0x00, 0x18, 0x00, 0x2e, 0x00, 0x37, 0x00, 0x00, 0x00,
+  0x1e, 0x00, 0x28, 0x00, 0x35, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x0d, 0x00,
+  0x25, 0x00, 0x3c, 0x00, 0x53, 0x00, 0x5a, 0x00, 0x61, 0x00, 0x68, 0x00,
+  0x00, 0x00, 0x0f, 0x00, 0x24, 0x00, 0x34, 0x00, 0x47, 0x00, 0x59, 0x00,
+  0x61, 0x00, 0x69, 0x00, 0x72, 0x00, 0x7a, 0x00, 0x82, 0x00, 0x8a, 0x00,
+  0x96, 0x00, 0x9e, 0x00, 0xa6, 0x00, 0xae, 0x00, 0xb6, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x29, 0x00, 0x41, 0x00, 0x56, 0x00, 0x61, 0x00, 0x6d, 0x00,
+  0x76, 0x00, 0x7d, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1e, 0x00, 0x2f, 0x00,
+  0x3e, 0x00, 0x4d, 0x00, 0x62, 0x00, 0x00, 0x00, 0x14, 0x00, 0x1e, 0x00,
+  0x00, 0x00, 0x19, 0x00, 0x31, 0x00, 0x38, 0x00, 0x44, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x20, 0x00, 0x2b, 0x00, 0x39, 0x00, 0x4d, 0x00, 0x5f, 0x00,
+  0x6b, 0x00, 0x77, 0x00, 0x80, 0x00, 0x89, 0x00, 0x90, 0x00, 0x97, 0x00,
+  0x9e, 0x00, 0xa5, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x1d, 0x00, 0x26, 0x00,
+  0x30, 0x00, 0x39, 0x00, 0x3f, 0x00, 0x45, 0x00, 0x4c, 0x00, 0x53, 0x00,
+  0x5e, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x29, 0x00, 0x36, 0x00, 0x46, 0x00,
+  0x5c, 0x00, 0x71, 0x00, 0x89, 0x00, 0xa2, 0x00, 0xba, 0x00, 0xd1, 0x00,
+  0xe7, 0x00, 0xfd, 0x00, 0x12, 0x01, 0x28, 0x01, 0x3d, 0x01, 0x53, 0x01,
+  0x6c, 0x01, 0x83, 0x01, 0x99, 0x01, 0xac, 0x01, 0xbf, 0x01, 0xd1, 0x01,
+  0xda, 0x01, 0xe3, 0x01, 0xec, 0x01, 0xf5, 0x01, 0xfc, 0x01, 0x06, 0x02,
+  0x00, 0x00, 0x1b, 0x00, 0x2c, 0x00, 0x41, 0x00, 0x57, 0x00, 0x6c, 0x00,
+  0x76, 0x00, 0x80, 0x00, 0x8a, 0x00, 0x94, 0x00, 0x9e, 0x00, 0xaa, 0x00,
+  0xb6, 0x00, 0xc0, 0x00, 0xca, 0x00, 0xd5, 0x00, 0xe0, 0x00, 0xeb, 0x00,
+  0xf6, 0x00, 0x01, 0x01, 0x00, 0x00, 0x27, 0x00, 0x42, 0x00, 0x5f, 0x00,
+  0x8a, 0x00, 0xa1, 0x00, 0xba, 0x00, 0xdd, 0x00, 0xfb, 0x00, 0x0c, 0x01,
+  0x1b, 0x01, 0x2a, 0x01, 0x41, 0x01, 0x55, 0x01, 0x67, 0x01, 0x6f, 0x01,
+  0x77, 0x01, 0x7e, 0x01, 0x85, 0x01, 0x8c, 0x01, 0x93, 0x01, 0x9a, 0x01,
+  0xa1, 0x01, 0xad, 0x01, 0xb9, 0x01, 0x00, 0x00, 0x30, 0x00, 0x4e, 0x00,
+  0x63, 0x00, 0x77, 0x00, 0x8d, 0x00, 0xa1, 0x00, 0xb6, 0x00, 0xcf, 0x00,
+  0xe5, 0x00, 0xf9, 0x00, 0x0e, 0x01, 0x21, 0x01, 0x39, 0x01, 0x4f, 0x01,
+  0x69, 0x01, 0x73, 0x01, 0x7e, 0x01, 0x88, 0x01, 0x93, 0x01, 0x9e, 0x01,
+  0xa4, 0x01, 0x00, 0x00, 0x27, 0x00, 0x41, 0x00, 0x5e, 0x00, 0x88, 0x00,
+  0x9f, 0x00, 0xb8, 0x00, 0xdb, 0x00, 0xfa, 0x00, 0x0b, 0x01, 0x1c, 0x01,
+  0x30, 0x01, 0x42, 0x01, 0x54, 0x01, 0x65, 0x01, 0x77, 0x01, 0x89, 0x01,
+  0x9a, 0x01, 0xab, 0x01, 0xbe, 0x01, 0xcf, 0x01, 0xe0, 0x01, 0xf2, 0x01,
+  0x03, 0x02, 0x15, 0x02, 0x33, 0x02, 0x3f, 0x02, 0x4b, 0x02, 0x57, 0x02,
+  0x63, 0x02, 0x6f, 0x02, 0x7b, 0x02, 0x87, 0x02, 0x93, 0x02, 0x9f, 0x02,
+  0xab, 0x02, 0xb7, 0x02, 0xc3, 0x02, 0xcf, 0x02, 0xdb, 0x02, 0xe7, 0x02,
+  0xf3, 0x02, 0xff, 0x02, 0x0b, 0x03, 0x17, 0x03, 0x23, 0x03, 0x2f, 0x03,
+  0x3b, 0x03, 0x47, 0x03, 0x53, 0x03, 0x5f, 0x03, 0x6b, 0x03, 0x77, 0x03,
+  0x83, 0x03, 0x8f, 0x03, 0x9b, 0x03, 0xa7, 0x03, 0xb3, 0x03, 0xbf, 0x03,
+  0xcb, 0x03, 0xd7, 0x03, 0xe3, 0x03, 0xef, 0x03, 0xfb, 0x03, 0x07, 0x04,
+  0x13, 0x04, 0x1f, 0x04, 0x2b, 0x04, 0x37, 0x04, 0x43, 0x04, 0x4f, 0x04,
+  0x5b, 0x04, 0x67, 0x04, 0x73, 0x04, 0x7f, 0x04, 0x8b, 0x04, 0x97, 0x04,
+  0xa3, 0x04, 0xaf, 0x04, 0xbb, 0x04, 0xc7, 0x04, 0xd3, 0x04, 0xdf, 0x04,
+  0xeb, 0x04, 0xf7, 0x04, 0x03, 0x05, 0x0f, 0x05, 0x1b, 0x05, 0x27, 0x05,
+  0x33, 0x05, 0x3f, 0x05, 0x4b, 0x05, 0x57, 0x05, 0x63, 0x05, 0x6f, 0x05,
+  0x7b, 0x05, 0x87, 0x05, 0x93, 0x05, 0x9f, 0x05, 0xab, 0x05, 0xb7, 0x05,
+  0xc3, 0x05, 0xcf, 0x05, 0xdb, 0x05, 0xe7, 0x05, 0xf3, 0x05, 0xff, 0x05,
+  0x0b, 0x06, 0x17, 0x06, 0x23, 0x06, 0x2f, 0x06, 0x3b, 0x06, 0x47, 0x06,
+  0x53, 0x06, 0x5f, 0x06, 0x6b, 0x06, 0x77, 0x06, 0x83, 0x06, 0x8f, 0x06,
+  0x9b, 0x06, 0xa7, 0x06, 0xb3, 0x06, 0xbf, 0x06, 0xcb, 0x06, 0xd7, 0x06,
+  0xe3, 0x06, 0xef, 0x06, 0xfb, 0x06, 0x07, 0x07, 0x13, 0x07, 0x1f, 0x07,
+  0x2b, 0x07, 0x37, 0x07, 0x43, 0x07, 0x4f, 0x07, 0x5b, 0x07, 0x67, 0x07,
+  0x73, 0x07, 0x7f, 0x07, 0x8b, 0x07, 0x97, 0x07, 0xa3, 0x07, 0xaf, 0x07,
+  0xbb, 0x07, 0xc7, 0x07, 0xd3, 0x07, 0xdf, 0x07, 0xeb, 0x07, 0xf7, 0x07,
+  0x03, 0x08, 0x0f, 0x08, 0x1b, 0x08, 0x27, 0x08, 0x33, 0x08, 0x3f, 0x08,
+  0x4b, 0x08, 0x57, 0x08, 0x60, 0x08, 0x6b, 0x08, 0x76, 0x08, 0x81, 0x08,
+  0x8c, 0x08, 0x95, 0x08, 0x9f, 0x08, 0xa8, 0x08, 0xb3, 0x08, 0xbc, 0x08,
+  0xc5, 0x08, 0xd0, 0x08, 0xd9, 0x08, 0xe2, 0x08, 0xec, 0x08, 0xf5, 0x08,
+  0xfd, 0x08, 0x09, 0x09, 0x13, 0x09, 0x1e, 0x09, 0x27, 0x09, 0x32, 0x09,
+  0x3b, 0x09, 0x00, 0x00, 0x25, 0x00, 0x41, 0x00, 0x5b, 0x00, 0x77, 0x00,
+  0x7e, 0x00, 0x85, 0x00, 0x8b, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x2b, 0x00,
+  0x3b, 0x00, 0x4b, 0x00, 0x60, 0x00, 0x73, 0x00, 0x85, 0x00, 0x8e, 0x00,
+  0x95, 0x00, 0x9e, 0x00, 0xa7, 0x00, 0xb2, 0x00, 0xbd, 0x00, 0x00, 0x00,
+  0x25, 0x00, 0x42, 0x00, 0x5e, 0x00, 0x72, 0x00, 0x87, 0x00, 0x9b, 0x00,
+  0xb3, 0x00, 0xbd, 0x00, 0xc7, 0x00, 0x00, 0x00, 0x25, 0x00, 0x41, 0x00,
+  0x00, 0x00, 0x2d, 0x00, 0x3c, 0x00, 0x44, 0x00, 0x4d, 0x00, 0x00, 0x00,
+  0x1e, 0x00, 0x3b, 0x00, 0x47, 0x00, 0x53, 0x00, 0x5d, 0x00, 0x67, 0x00,
+  0x00, 0x00, 0x20, 0x00, 0x2b, 0x00, 0x3b, 0x00, 0x46, 0x00, 0x57, 0x00,
+  0x62, 0x00, 0x6a, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x3a, 0x00, 0x48, 0x00,
+  0x59, 0x00, 0x6c, 0x00, 0x75, 0x00, 0x7e, 0x00, 0x87, 0x00, 0x90, 0x00,
+  0x99, 0x00, 0xa2, 0x00, 0xab, 0x00, 0xb4, 0x00, 0xc4, 0x00, 0xd0, 0x00,
+  0xda, 0x00, 0xe0, 0x00, 0xe9, 0x00, 0xf2, 0x00, 0xf8, 0x00, 0x00, 0x00,
+  0x19, 0x00, 0x40, 0x00, 0x50, 0x00, 0x5e, 0x00, 0x69, 0x00, 0x84, 0x00,
+  0x9e, 0x00, 0xa8, 0x00, 0xb3, 0x00, 0xba, 0x00, 0xc4, 0x00, 0x00, 0x00,
+  0x28, 0x00, 0x32, 0x00, 0x40, 0x00, 0x4e, 0x00, 0x59, 0x00, 0x63, 0x00,
+  0x6d, 0x00, 0x79, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x2c, 0x00, 0x37, 0x00,
+  0x48, 0x00, 0x54, 0x00, 0x60, 0x00, 0x6a, 0x00, 0x74, 0x00, 0x7e, 0x00,
+  0x88, 0x00, 0x92, 0x00, 0x98, 0x00, 0x9e, 0x00, 0xa7, 0x00, 0xaf, 0x00,
+  0x00, 0x00, 0x19, 0x00, 0x38, 0x00, 0x45, 0x00, 0x5b, 0x00, 0x70, 0x00,
+  0x89, 0x00, 0xa2, 0x00, 0xb7, 0x00, 0xc0, 0x00, 0xc8, 0x00, 0xd8, 0x00,
+  0xe0, 0x00, 0xe7, 0x00, 0xf3, 0x00, 0xff, 0x00, 0x00, 0x00, 0x1f, 0x00,
+  0x42, 0x00, 0x51, 0x00, 0x60, 0x00, 0x70, 0x00, 0x8a, 0x00, 0xa5, 0x00,
+  0xbe, 0x00, 0xda, 0x00, 0xf7, 0x00, 0x15, 0x01, 0x31, 0x01, 0x4c, 0x01,
+  0x68, 0x01, 0x82, 0x01, 0x9c, 0x01, 0xb7, 0x01, 0xd0, 0x01, 0xea, 0x01,
+  0x05, 0x02, 0x1e, 0x02, 0x3a, 0x02, 0x54, 0x02, 0x71, 0x02, 0x8c, 0x02,
+  0xa8, 0x02, 0xc2, 0x02, 0xd1, 0x02, 0xe1, 0x02, 0xf4, 0x02, 0x05, 0x03,
+  0x0e, 0x03, 0x18, 0x03, 0x22, 0x03, 0x2c, 0x03, 0x34, 0x03, 0x3d, 0x03,
+  0x46, 0x03, 0x4f, 0x03, 0x5c, 0x03, 0x69, 0x03, 0x76, 0x03, 0x83, 0x03,
+  0x90, 0x03, 0x9d, 0x03, 0xaa, 0x03, 0xb2, 0x03, 0xba, 0x03, 0xc2, 0x03,
+  0xca, 0x03, 0xd2, 0x03, 0x00, 0x00, 0x2a, 0x00, 0x4b, 0x00, 0x63, 0x00,
+  0x85, 0x00, 0x95, 0x00, 0xa6, 0x00, 0xb6, 0x00, 0xc8, 0x00, 0xdd, 0x00,
+  0xf1, 0x00, 0x08, 0x01, 0x1d, 0x01, 0x33, 0x01, 0x48, 0x01, 0x54, 0x01,
+  0x5d, 0x01, 0x66, 0x01, 0x6f, 0x01, 0x79, 0x01, 0x89, 0x01, 0x93, 0x01,
+  0x00, 0x00, 0x20, 0x00, 0x2b, 0x00, 0x38, 0x00, 0x4a, 0x00, 0x57, 0x00,
+  0x68, 0x00, 0x7c, 0x00, 0x85, 0x00, 0x8c, 0x00, 0x94, 0x00, 0x9c, 0x00,
+  0xa2, 0x00, 0xa8, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x4b, 0x00, 0x63, 0x00,
+  0x8c, 0x00, 0xa8, 0x00, 0xc8, 0x00, 0xd1, 0x00, 0xd8, 0x00, 0xdf, 0x00,
+  0xec, 0x00, 0x00, 0x00, 0x19, 0x00, 0x37, 0x00, 0x46, 0x00, 0x4e, 0x00,
+  0x5a, 0x00, 0x66, 0x00, 0x6e, 0x00, 0x76, 0x00, 0x7e, 0x00, 0x86, 0x00,
+  0x8e, 0x00, 0x96, 0x00, 0x9e, 0x00, 0xa6, 0x00, 0xad, 0x00, 0xb5, 0x00,
+  0xbd, 0x00, 0xc5, 0x00, 0xcd, 0x00, 0xd5, 0x00, 0xdd, 0x00, 0xe5, 0x00,
+  0xed, 0x00, 0xf5, 0x00, 0xfd, 0x00, 0x05, 0x01, 0x0d, 0x01, 0x15, 0x01,
+  0x1e, 0x01, 0x26, 0x01, 0x2f, 0x01, 0x00, 0x00, 0x1a, 0x00, 0x39, 0x00,
+  0x5d, 0x00, 0x6b, 0x00, 0x79, 0x00, 0x8d, 0x00, 0x9f, 0x00, 0xb1, 0x00,
+  0xc3, 0x00, 0xca, 0x00, 0xd3, 0x00, 0xdc, 0x00, 0x00, 0x00, 0x32, 0x00,
+  0x53, 0x00, 0x60, 0x00, 0x73, 0x00, 0x7d, 0x00, 0x8b, 0x00, 0x93, 0x00,
+  0x9d, 0x00, 0xa7, 0x00, 0xb3, 0x00, 0xbd, 0x00, 0xc7, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x1e, 0x00, 0x31, 0x00, 0x3a, 0x00, 0x43, 0x00, 0x4c, 0x00,
+  0x55, 0x00, 0x5c, 0x00, 0x63, 0x00, 0x6a, 0x00, 0x71, 0x00, 0x7a, 0x00,
+  0x82, 0x00, 0x8b, 0x00, 0x98, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1c, 0x00,
+  0x27, 0x00, 0x38, 0x00, 0x40, 0x00, 0x49, 0x00, 0x00, 0x00, 0x1c, 0x00,
+  0x42, 0x00, 0x5c, 0x00, 0x77, 0x00, 0x90, 0x00, 0x9c, 0x00, 0xaa, 0x00,
+  0xb7, 0x00, 0xc5, 0x00, 0xd3, 0x00, 0xe1, 0x00, 0xeb, 0x00, 0xf9, 0x00,
+  0x00, 0x00, 0x1b, 0x00, 0x31, 0x00, 0x45, 0x00, 0x5b, 0x00, 0x73, 0x00,
+  0x8a, 0x00, 0xa0, 0x00, 0xb7, 0x00, 0xd1, 0x00, 0xe5, 0x00, 0xf8, 0x00,
+  0x0f, 0x01, 0x24, 0x01, 0x3b, 0x01, 0x50, 0x01, 0x68, 0x01, 0x7f, 0x01,
+  0x8e, 0x01, 0x9d, 0x01, 0xa9, 0x01, 0xb8, 0x01, 0xc7, 0x01, 0xd6, 0x01,
+  0xe5, 0x01, 0xf4, 0x01, 0x03, 0x02, 0x12, 0x02, 0x21, 0x02, 0x30, 0x02,
+  0x3f, 0x02, 0x4e, 0x02, 0x5d, 0x02, 0x6c, 0x02, 0x7b, 0x02, 0x8a, 0x02,
+  0x99, 0x02, 0xa5, 0x02, 0xaf, 0x02, 0xb6, 0x02, 0xbd, 0x02, 0xcd, 0x02,
+  0x00, 0x00, 0x14, 0x00, 0x29, 0x00, 0x3e, 0x00, 0x53, 0x00, 0x61, 0x00,
+  0x76, 0x00, 0x8c, 0x00, 0xa1, 0x00, 0xaa, 0x00, 0xba, 0x00, 0xc3, 0x00,
+  0xcc, 0x00, 0xd5, 0x00, 0xde, 0x00, 0xe7, 0x00, 0xf0, 0x00, 0xf9, 0x00,
+  0x09, 0x01, 0x19, 0x01, 0x22, 0x01, 0x32, 0x01, 0x42, 0x01, 0x52, 0x01,
+  0x62, 0x01, 0x72, 0x01, 0x82, 0x01, 0x92, 0x01, 0x9b, 0x01, 0xa4, 0x01,
+  0xae, 0x01, 0xb8, 0x01, 0xbf, 0x01, 0xc6, 0x01, 0xd0, 0x01, 0xda, 0x01,
+  0xe4, 0x01, 0xee, 0x01, 0xf8, 0x01, 0x02, 0x02, 0x00, 0x00, 0x0d, 0x00,
+  0x1e, 0x00, 0x2f, 0x00, 0x40, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x11, 0x00,
+  0x1c, 0x00, 0x31, 0x00, 0x3b, 0x00, 0x49, 0x00, 0x5b, 0x00, 0x6a, 0x00,
+  0x74, 0x00, 0x7d, 0x00, 0x86, 0x00, 0x8e, 0x00, 0x96, 0x00, 0x9d, 0x00,
+  0xa4, 0x00, 0xab, 0x00, 0xb3, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x34, 0x00,
+  0x52, 0x00, 0x7b, 0x00, 0xa7, 0x00, 0xd4, 0x00, 0xf4, 0x00, 0x20, 0x01,
+  0x4b, 0x01, 0x6a, 0x01, 0x94, 0x01, 0xbe, 0x01, 0xdc, 0x01, 0x05, 0x02,
+  0x2f, 0x02, 0x4c, 0x02, 0x75, 0x02, 0x93, 0x02, 0xbd, 0x02, 0xea, 0x02,
+  0x15, 0x03, 0x33, 0x03, 0x5d, 0x03, 0x72, 0x03, 0x86, 0x03, 0x9b, 0x03,
+  0xb0, 0x03, 0xbf, 0x03, 0xca, 0x03, 0xd3, 0x03, 0xdc, 0x03, 0xe6, 0x03,
+  0xf0, 0x03, 0xfa, 0x03, 0x04, 0x04, 0x0e, 0x04, 0x17, 0x04, 0x24, 0x04,
+  0x2d, 0x04, 0x38, 0x04, 0x41, 0x04, 0x4a, 0x04, 0x00, 0x00, 0x1b, 0x00,
+  0x36, 0x00, 0x49, 0x00, 0x5e, 0x00, 0x73, 0x00, 0x87, 0x00, 0x9f, 0x00,
+  0xb6, 0x00, 0xcb, 0x00, 0xd5, 0x00, 0xdf, 0x00, 0xe8, 0x00, 0xf2, 0x00,
+  0xfb, 0x00, 0x04, 0x01, 0x0d, 0x01, 0x17, 0x01, 0x21, 0x01, 0x2b, 0x01,
+  0x34, 0x01, 0x3f, 0x01, 0x49, 0x01, 0x53, 0x01, 0x5d, 0x01, 0x68, 0x01,
+  0x73, 0x01, 0x7e, 0x01, 0x88, 0x01, 0x00, 0x00, 0x21, 0x00, 0x3a, 0x00,
+  0x52, 0x00, 0x69, 0x00, 0x82, 0x00, 0x9b, 0x00, 0xb5, 0x00, 0xcd, 0x00,
+  0xe6, 0x00, 0xfd, 0x00, 0x16, 0x01, 0x2d, 0x01, 0x47, 0x01, 0x5f, 0x01,
+  0x70, 0x01, 0x7c, 0x01, 0x82, 0x01, 0x00, 0x00, 0x1b, 0x00, 0x36, 0x00,
+  0x57, 0x00, 0x63, 0x00, 0x70, 0x00, 0x7e, 0x00, 0x94, 0x00, 0xaa, 0x00,
+  0xc0, 0x00, 0xd6, 0x00, 0xee, 0x00, 0x04, 0x01, 0x16, 0x01, 0x22, 0x01,
+  0x2e, 0x01, 0x35, 0x01, 0x3c, 0x01, 0x43, 0x01, 0x4a, 0x01, 0x57, 0x01,
+  0x5e, 0x01, 0x65, 0x01, 0x6b, 0x01, 0x00, 0x00, 0x1e, 0x00, 0x3f, 0x00,
+  0x5e, 0x00, 0x74, 0x00, 0x8b, 0x00, 0xa2, 0x00, 0xb9, 0x00, 0xd0, 0x00,
+  0xdb, 0x00, 0xe6, 0x00, 0xf1, 0x00, 0xfc, 0x00, 0x05, 0x01, 0x10, 0x01,
+  0x1b, 0x01, 0x25, 0x01, 0x2f, 0x01, 0x00, 0x00, 0x1a, 0x00, 0x3c, 0x00,
+  0x58, 0x00, 0x6c, 0x00, 0x7d, 0x00, 0x8e, 0x00, 0xa4, 0x00, 0xb6, 0x00,
+  0xc7, 0x00, 0xd9, 0x00, 0xeb, 0x00, 0xfc, 0x00, 0x08, 0x01, 0x14, 0x01,
+  0x1d, 0x01, 0x27, 0x01, 0x30, 0x01, 0x39, 0x01, 0x42, 0x01, 0x4b, 0x01,
+  0x55, 0x01, 0x5e, 0x01, 0x67, 0x01, 0x00, 0x00, 0x26, 0x00, 0x51, 0x00,
+  0x6f, 0x00, 0x8b, 0x00, 0x98, 0x00, 0xa5, 0x00, 0xb2, 0x00, 0xbf, 0x00,
+  0xcc, 0x00, 0xd8, 0x00, 0xe5, 0x00, 0xf2, 0x00, 0xff, 0x00, 0x0c, 0x01,
+  0x19, 0x01, 0x26, 0x01, 0x33, 0x01, 0x40, 0x01, 0x4d, 0x01, 0x5a, 0x01,
+  0x67, 0x01, 0x74, 0x01, 0x81, 0x01, 0x8e, 0x01, 0x9b, 0x01, 0xa8, 0x01,
+  0xb5, 0x01, 0xc2, 0x01, 0xcf, 0x01, 0xdc, 0x01, 0xe9, 0x01, 0xf6, 0x01,
+  0x03, 0x02, 0x10, 0x02, 0x1d, 0x02, 0x2a, 0x02, 0x37, 0x02, 0x44, 0x02,
+  0x51, 0x02, 0x5e, 0x02, 0x6b, 0x02, 0x78, 0x02, 0x85, 0x02, 0x92, 0x02,
+  0x9f, 0x02, 0xac, 0x02, 0xb9, 0x02, 0xc6, 0x02, 0xd3, 0x02, 0xe0, 0x02,
+  0xed, 0x02, 0xfa, 0x02, 0x07, 0x03, 0x14, 0x03, 0x21, 0x03, 0x2e, 0x03,
+  0x3b, 0x03, 0x48, 0x03, 0x55, 0x03, 0x66, 0x03, 0x73, 0x03, 0x80, 0x03,
+  0x00, 0x00, 0x1e, 0x00, 0x2a, 0x00, 0x38, 0x00, 0x46, 0x00, 0x54, 0x00,
+  0x62, 0x00, 0x70, 0x00, 0x7e, 0x00, 0x8c, 0x00, 0x9a, 0x00, 0xa8, 0x00,
+  0xb6, 0x00, 0xc4, 0x00, 0xd2, 0x00, 0xe0, 0x00, 0xee, 0x00, 0xfc, 0x00,
+  0x0a, 0x01, 0x18, 0x01, 0x26, 0x01, 0x34, 0x01, 0x42, 0x01, 0x50, 0x01,
+  0x5e, 0x01, 0x6c, 0x01, 0x7a, 0x01, 0x88, 0x01, 0x96, 0x01, 0xa4, 0x01,
+  0xb2, 0x01, 0xc0, 0x01, 0xce, 0x01, 0xdc, 0x01, 0xea, 0x01, 0xf4, 0x01,
+  0x04, 0x02, 0x10, 0x02, 0x19, 0x02, 0x23, 0x02, 0x2c, 0x02, 0x35, 0x02,
+  0x00, 0x00, 0x1b, 0x00, 0x3b, 0x00, 0x58, 0x00, 0x66, 0x00, 0x89, 0x00,
+  0xa0, 0x00, 0xb7, 0x00, 0xc1, 0x00, 0xcb, 0x00, 0x00, 0x00, 0x1a, 0x00,
+  0x37, 0x00, 0x45, 0x00, 0x55, 0x00, 0x6e, 0x00, 0x81, 0x00, 0x9a, 0x00,
+  0xb2, 0x00, 0xca, 0x00, 0xe1, 0x00, 0xfa, 0x00, 0x12, 0x01, 0x29, 0x01,
+  0x42, 0x01, 0x4e, 0x01, 0x5b, 0x01, 0x64, 0x01, 0x71, 0x01, 0x7a, 0x01,
+  0x82, 0x01, 0x8a, 0x01, 0x93, 0x01, 0x9c, 0x01, 0xa9, 0x01, 0xba, 0x01,
+  0x00, 0x00, 0x23, 0x00, 0x2e, 0x00, 0x40, 0x00, 0x52, 0x00, 0x65, 0x00,
+  0x78, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1a, 0x00, 0x22, 0x00, 0x2a, 0x00,
+  0x32, 0x00, 0x37, 0x00, 0x44, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x1c, 0x00,
+  0x38, 0x00, 0x55, 0x00, 0x77, 0x00, 0x83, 0x00, 0xa3, 0x00, 0xae, 0x00,
+  0xb7, 0x00, 0xc2, 0x00, 0xcb, 0x00, 0xd6, 0x00, 0xe1, 0x00, 0x00, 0x00,
+  0x1b, 0x00, 0x37, 0x00, 0x57, 0x00, 0x75, 0x00, 0x83, 0x00, 0x92, 0x00,
+  0x9d, 0x00, 0xa7, 0x00, 0x00, 0x00, 0x23, 0x00, 0x44, 0x00, 0x55, 0x00,
+  0x63, 0x00, 0x00, 0x00, 0x21, 0x00, 0x40, 0x00, 0x5c, 0x00, 0x76, 0x00,
+  0x90, 0x00, 0x9d, 0x00, 0xaa, 0x00, 0xb7, 0x00, 0xc4, 0x00, 0xd1, 0x00,
+  0xde, 0x00, 0xeb, 0x00, 0xf8, 0x00, 0x05, 0x01, 0x00, 0x00, 0x1d, 0x00,
+  0x39, 0x00, 0x67, 0x00, 0x74, 0x00, 0x7e, 0x00, 0x86, 0x00, 0x8e, 0x00,
+  0x99, 0x00, 0xa0, 0x00, 0xa7, 0x00, 0xae, 0x00, 0xb7, 0x00, 0xbf, 0x00,
+  0xca, 0x00, 0xd5, 0x00, 0xe0, 0x00, 0xeb, 0x00, 0xf6, 0x00, 0x04, 0x01,
+  0x12, 0x01, 0x1d, 0x01, 0x28, 0x01, 0x30, 0x01, 0x00, 0x00, 0x1d, 0x00,
+  0x3a, 0x00, 0x5b, 0x00, 0x72, 0x00, 0x88, 0x00, 0x94, 0x00, 0xa0, 0x00,
+  0xac, 0x00, 0xb8, 0x00, 0xc4, 0x00, 0xd0, 0x00, 0xdc, 0x00, 0xe3, 0x00,
+  0xea, 0x00, 0xf1, 0x00, 0xf8, 0x00, 0xff, 0x00, 0x06, 0x01, 0x0d, 0x01,
+  0x14, 0x01, 0x1b, 0x01, 0x00, 0x00, 0x21, 0x00, 0x3e, 0x00, 0x4c, 0x00,
+  0x5c, 0x00, 0x6c, 0x00, 0x7e, 0x00, 0x8d, 0x00, 0x9c, 0x00, 0xaa, 0x00,
+  0xbb, 0x00, 0xd8, 0x00, 0xeb, 0x00, 0xfb, 0x00, 0x04, 0x01, 0x0d, 0x01,
+  0x16, 0x01, 0x20, 0x01, 0x2a, 0x01, 0x34, 0x01, 0x3e, 0x01, 0x48, 0x01,
+  0x52, 0x01, 0x5c, 0x01, 0x66, 0x01, 0x70, 0x01, 0x77, 0x01, 0x80, 0x01,
+  0x87, 0x01, 0x90, 0x01, 0x99, 0x01, 0xa2, 0x01, 0xab, 0x01, 0xb4, 0x01,
+  0xbd, 0x01, 0xca, 0x01, 0xd7, 0x01, 0xe4, 0x01, 0xf1, 0x01, 0xfe, 0x01,
+  0x0b, 0x02, 0x18, 0x02, 0x25, 0x02, 0x32, 0x02, 0x3f, 0x02, 0x4c, 0x02,
+  0x59, 0x02, 0x66, 0x02, 0x73, 0x02, 0x7c, 0x02, 0x85, 0x02, 0x00, 0x00,
+  0x1f, 0x00, 0x3d, 0x00, 0x5a, 0x00, 0x69, 0x00, 0x79, 0x00, 0x89, 0x00,
+  0x9a, 0x00, 0xab, 0x00, 0xbc, 0x00, 0xd3, 0x00, 0xdc, 0x00, 0xe8, 0x00,
+  0xf4, 0x00, 0xfd, 0x00, 0x06, 0x01, 0x0f, 0x01, 0x18, 0x01, 0x21, 0x01,
+  0x2a, 0x01, 0x33, 0x01, 0x3c, 0x01, 0x45, 0x01, 0x4e, 0x01, 0x57, 0x01,
+  0x60, 0x01, 0x69, 0x01, 0x72, 0x01, 0x7b, 0x01, 0x84, 0x01, 0x8d, 0x01,
+  0x96, 0x01, 0x9f, 0x01, 0xa8, 0x01, 0xb1, 0x01, 0xba, 0x01, 0xc3, 0x01,
+  0xcc, 0x01, 0xd5, 0x01, 0xde, 0x01, 0xe7, 0x01, 0xf0, 0x01, 0xf9, 0x01,
+  0x02, 0x02, 0x0c, 0x02, 0x15, 0x02, 0x1f, 0x02, 0x27, 0x02, 0x30, 0x02,
+  0x3c, 0x02, 0x42, 0x02, 0x4c, 0x02, 0x56, 0x02, 0x60, 0x02, 0x00, 0x00,
+  0x29, 0x00, 0x37, 0x00, 0x4c, 0x00, 0x59, 0x00, 0x6d, 0x00, 0x84, 0x00,
+  0x8f, 0x00, 0x97, 0x00, 0x9e, 0x00, 0xa5, 0x00, 0xb2, 0x00, 0xba, 0x00,
+  0x00, 0x00, 0x1f, 0x00, 0x43, 0x00, 0x4d, 0x00, 0x64, 0x00, 0x7b, 0x00,
+  0x88, 0x00, 0x99, 0x00, 0xa2, 0x00, 0xac, 0x00, 0xb6, 0x00, 0xbf, 0x00,
+  0xca, 0x00, 0xd1, 0x00, 0xd7, 0x00, 0xe2, 0x00, 0xe9, 0x00, 0xf0, 0x00,
+  0xf7, 0x00, 0x05, 0x01, 0x13, 0x01, 0x22, 0x01, 0x00, 0x00, 0x1a, 0x00,
+  0x30, 0x00, 0x44, 0x00, 0x5b, 0x00, 0x70, 0x00, 0x7d, 0x00, 0x8a, 0x00,
+  0x97, 0x00, 0xa1, 0x00, 0xab, 0x00, 0xb5, 0x00, 0xbf, 0x00, 0xc9, 0x00,
+  0x00, 0x00, 0x1c, 0x00, 0x43, 0x00, 0x5e, 0x00, 0x78, 0x00, 0x87, 0x00,
+  0x95, 0x00, 0xa2, 0x00, 0xb3, 0x00, 0xc1, 0x00, 0xcf, 0x00, 0xd8, 0x00,
+  0xe4, 0x00, 0xeb, 0x00, 0xf4, 0x00, 0x00, 0x00, 0x24, 0x00, 0x40, 0x00,
+  0x4d, 0x00, 0x62, 0x00, 0x76, 0x00, 0x85, 0x00, 0x8f, 0x00, 0x99, 0x00,
+  0xa3, 0x00, 0xad, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x37, 0x00, 0x53, 0x00,
+  0x6e, 0x00, 0x88, 0x00, 0xa1, 0x00, 0xba, 0x00, 0xd2, 0x00, 0xeb, 0x00,
+  0x03, 0x01, 0x1c, 0x01, 0x38, 0x01, 0x52, 0x01, 0x6b, 0x01, 0x7c, 0x01,
+  0x83, 0x01, 0x8a, 0x01, 0x97, 0x01, 0xa0, 0x01, 0xa8, 0x01, 0xb2, 0x01,
+  0xba, 0x01, 0x00, 0x00, 0x1d, 0x00, 0x28, 0x00, 0x39, 0x00, 0x4a, 0x00,
+  0x5b, 0x00, 0x64, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x52, 0x00, 0x6f, 0x00,
+  0x91, 0x00, 0xab, 0x00, 0xbd, 0x00, 0xc5, 0x00, 0xcd, 0x00, 0xd5, 0x00,
+  0xdb, 0x00, 0xe3, 0x00, 0x00, 0x00, 0x22, 0x00, 0x2c, 0x00, 0x42, 0x00,
+  0x56, 0x00, 0x6b, 0x00, 0x7f, 0x00, 0x8e, 0x00, 0x97, 0x00, 0x9e, 0x00,
+  0xa8, 0x00, 0xb2, 0x00, 0xbc, 0x00, 0xc6, 0x00, 0xd0, 0x00, 0xda, 0x00,
+  0xe3, 0x00, 0xec, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1d, 0x00,
+  0x31, 0x00, 0x41, 0x00, 0x56, 0x00, 0x6b, 0x00, 0x80, 0x00, 0x93, 0x00,
+  0xa6, 0x00, 0xc1, 0x00, 0xd4, 0x00, 0xdc, 0x00, 0xe6, 0x00, 0xf0, 0x00,
+  0xf7, 0x00, 0xfe, 0x00, 0x05, 0x01, 0x10, 0x01, 0x1a, 0x01, 0x24, 0x01,
+  0x2c, 0x01, 0x36, 0x01, 0x3e, 0x01, 0x48, 0x01, 0x52, 0x01, 0x5c, 0x01,
+  0x65, 0x01, 0x6e, 0x01, 0x78, 0x01, 0x83, 0x01, 0x91, 0x01, 0x9b, 0x01,
+  0x00, 0x00, 0x0b, 0x00, 0x2a, 0x00, 0x46, 0x00, 0x5e, 0x00, 0x6a, 0x00,
+  0x76, 0x00, 0x82, 0x00, 0x8e, 0x00, 0x9f, 0x00, 0xab, 0x00, 0xb7, 0x00,
+  0xc3, 0x00, 0xcf, 0x00, 0xdb, 0x00, 0xe5, 0x00, 0xef, 0x00, 0xf9, 0x00,
+  0x03, 0x01, 0x0d, 0x01, 0x17, 0x01, 0x27, 0x01, 0x00, 0x00, 0x12, 0x00,
+  0x1b, 0x00, 0x21, 0x00, 0x2a, 0x00, 0x33, 0x00, 0x3c, 0x00, 0x43, 0x00,
+  0x4d, 0x00, 0x54, 0x00, 0x5e, 0x00, 0x6d, 0x00, 0x7f, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x25, 0x00, 0x38, 0x00, 0x4a, 0x00, 0x5c, 0x00, 0x6e, 0x00,
+  0x83, 0x00, 0x98, 0x00, 0xad, 0x00, 0xc1, 0x00, 0xd5, 0x00, 0xe8, 0x00,
+  0xfc, 0x00, 0x0f, 0x01, 0x19, 0x01, 0x23, 0x01, 0x2e, 0x01, 0x39, 0x01,
+  0x43, 0x01, 0x4d, 0x01, 0x56, 0x01, 0x5f, 0x01, 0x00, 0x00, 0x13, 0x00,
+  0x31, 0x00, 0x4c, 0x00, 0x5c, 0x00, 0x70, 0x00, 0x85, 0x00, 0x9a, 0x00,
+  0xae, 0x00, 0xc6, 0x00, 0xe0, 0x00, 0xf9, 0x00, 0x11, 0x01, 0x23, 0x01,
+  0x2d, 0x01, 0x38, 0x01, 0x43, 0x01, 0x4d, 0x01, 0x58, 0x01, 0x63, 0x01,
+  0x6d, 0x01, 0x77, 0x01, 0x81, 0x01, 0x8b, 0x01, 0x95, 0x01, 0x9f, 0x01,
+  0xa8, 0x01, 0xb2, 0x01, 0xbc, 0x01, 0xc6, 0x01, 0xd0, 0x01, 0xda, 0x01,
+  0xe4, 0x01, 0xee, 0x01, 0xf8, 0x01, 0x01, 0x02, 0x0b, 0x02, 0x14, 0x02,
+  0x1d, 0x02, 0x27, 0x02, 0x30, 0x02, 0x3c, 0x02, 0x00, 0x00, 0x17, 0x00,
+  0x2d, 0x00, 0x46, 0x00, 0x5d, 0x00, 0x75, 0x00, 0x8b, 0x00, 0x95, 0x00,
+  0xa1, 0x00, 0xad, 0x00, 0xb9, 0x00, 0xc3, 0x00, 0xcf, 0x00, 0xdb, 0x00,
+  0xe7, 0x00, 0xf1, 0x00, 0xfd, 0x00, 0x09, 0x01, 0x13, 0x01, 0x1d, 0x01,
+  0x27, 0x01, 0x33, 0x01, 0x3f, 0x01, 0x4b, 0x01, 0x57, 0x01, 0x63, 0x01,
+  0x6f, 0x01, 0x7b, 0x01, 0x87, 0x01, 0x93, 0x01, 0x9f, 0x01, 0xa9, 0x01,
+  0xb5, 0x01, 0xc1, 0x01, 0xcd, 0x01, 0xd9, 0x01, 0xe5, 0x01, 0xef, 0x01,
+  0xf9, 0x01, 0x05, 0x02, 0x11, 0x02, 0x1b, 0x02, 0x27, 0x02, 0x33, 0x02,
+  0x3f, 0x02, 0x4b, 0x02, 0x57, 0x02, 0x63, 0x02, 0x6f, 0x02, 0x79, 0x02,
+  0x85, 0x02, 0x91, 0x02, 0x9d, 0x02, 0xa9, 0x02, 0xb5, 0x02, 0xc1, 0x02,
+  0xcd, 0x02, 0xd9, 0x02, 0xe5, 0x02, 0xf1, 0x02, 0xfd, 0x02, 0x09, 0x03,
+  0x15, 0x03, 0x21, 0x03, 0x2d, 0x03, 0x39, 0x03, 0x45, 0x03, 0x51, 0x03,
+  0x5d, 0x03, 0x69, 0x03, 0x73, 0x03, 0x7d, 0x03, 0x87, 0x03, 0x91, 0x03,
+  0x9d, 0x03, 0xa9, 0x03, 0xb5, 0x03, 0xc1, 0x03, 0xcd, 0x03, 0xd9, 0x03,
+  0xe5, 0x03, 0xef, 0x03, 0xfb, 0x03, 0x05, 0x04, 0x0f, 0x04, 0x1b, 0x04,
+  0x25, 0x04, 0x31, 0x04, 0x3d, 0x04, 0x49, 0x04, 0x52, 0x04, 0x5b, 0x04,
+  0x00, 0x00, 0x11, 0x00, 0x1e, 0x00, 0x30, 0x00, 0x3f, 0x00, 0x49, 0x00,
+  0x50, 0x00, 0x57, 0x00, 0x66, 0x00, 0x00, 0x00, 0x21, 0x00, 0x34, 0x00,
+  0x46, 0x00, 0x50, 0x00, 0x59, 0x00, 0x62, 0x00, 0x6b, 0x00, 0x74, 0x00,
+  0x7d, 0x00, 0x86, 0x00, 0x8f, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x30, 0x00,
+  0x43, 0x00, 0x52, 0x00, 0x61, 0x00, 0x71, 0x00, 0x7a, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x14, 0x00, 0x1f, 0x00, 0x31, 0x00, 0x4e, 0x00, 0x6b, 0x00,
+  0x78, 0x00, 0x85, 0x00, 0x92, 0x00, 0x9f, 0x00, 0xac, 0x00, 0xb9, 0x00,
+  0xc6, 0x00, 0xcf, 0x00, 0xd8, 0x00, 0xe7, 0x00, 0xf5, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x35, 0x00, 0x41, 0x00, 0x50, 0x00, 0x5d, 0x00, 0x73, 0x00,
+  0x88, 0x00, 0x9b, 0x00, 0xa5, 0x00, 0xb1, 0x00, 0xbb, 0x00, 0xc4, 0x00,
+  0xd3, 0x00, 0x00, 0x00, 0x14, 0x00, 0x28, 0x00, 0x3b, 0x00, 0x45, 0x00,
+  0x00, 0x00, 0x1c, 0x00, 0x38, 0x00, 0x47, 0x00, 0x56, 0x00, 0x66, 0x00,
+  0x78, 0x00, 0x8a, 0x00, 0x93, 0x00, 0x9b, 0x00, 0xa4, 0x00, 0x00, 0x00,
+  0x1a, 0x00, 0x26, 0x00, 0x2e, 0x00, 0x36, 0x00, 0x45, 0x00, 0x4b, 0x00,
+  0x51, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1a, 0x00, 0x26, 0x00, 0x3b, 0x00,
+  0x51, 0x00, 0x66, 0x00, 0x79, 0x00, 0x85, 0x00, 0x90, 0x00, 0x9a, 0x00,
+  0xa2, 0x00, 0xb2, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x31, 0x00, 0x45, 0x00,
+  0x5b, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x77, 0x00, 0x80, 0x00, 0x8c, 0x00,
+  0x97, 0x00, 0xa2, 0x00, 0xad, 0x00, 0xb8, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x21, 0x00, 0x32, 0x00, 0x3c, 0x00, 0x44, 0x00, 0x4c, 0x00, 0x52, 0x00,
+  0x00, 0x00, 0x23, 0x00, 0x2d, 0x00, 0x47, 0x00, 0x60, 0x00, 0x6c, 0x00,
+  0x78, 0x00, 0x84, 0x00, 0x90, 0x00, 0x9c, 0x00, 0xa8, 0x00, 0xb4, 0x00,
+  0xc0, 0x00, 0xcc, 0x00, 0xd8, 0x00, 0xe4, 0x00, 0xf0, 0x00, 0xfc, 0x00,
+  0x08, 0x01, 0x14, 0x01, 0x20, 0x01, 0x27, 0x01, 0x2e, 0x01, 0x36, 0x01,
+  0x40, 0x01, 0x4b, 0x01, 0x00, 0x00, 0x1c, 0x00, 0x2e, 0x00, 0x40, 0x00,
+  0x4c, 0x00, 0x59, 0x00, 0x66, 0x00, 0x72, 0x00, 0x7f, 0x00, 0x8b, 0x00,
+  0x95, 0x00, 0x9b, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x1a, 0x00, 0x21, 0x00,
+  0x2b, 0x00, 0x35, 0x00, 0x3d, 0x00, 0x48, 0x00, 0x52, 0x00, 0x5c, 0x00,
+  0x66, 0x00, 0x71, 0x00, 0x7b, 0x00, 0x85, 0x00, 0x8f, 0x00, 0x99, 0x00,
+  0xa3, 0x00, 0xab, 0x00, 0xb5, 0x00, 0xbe, 0x00, 0x00, 0x00, 0x17, 0x00,
+  0x2f, 0x00, 0x46, 0x00, 0x5c, 0x00, 0x71, 0x00, 0x86, 0x00, 0x9a, 0x00,
+  0xaf, 0x00, 0xc3, 0x00, 0xd8, 0x00, 0xf0, 0x00, 0x06, 0x01, 0x1b, 0x01,
+  0x2d, 0x01, 0x42, 0x01, 0x5c, 0x01, 0x76, 0x01, 0x85, 0x01, 0x94, 0x01,
+  0xa3, 0x01, 0xb2, 0x01, 0xc1, 0x01, 0xca, 0x01, 0xd2, 0x01, 0xdf, 0x01,
+  0xeb, 0x01, 0xf5, 0x01, 0xff, 0x01, 0x05, 0x02, 0x0f, 0x02, 0x1b, 0x02,
+  0x22, 0x02, 0x00, 0x00, 0x10, 0x00, 0x1b, 0x00, 0x2a, 0x00, 0x3d, 0x00,
+  0x4e, 0x00, 0x60, 0x00, 0x71, 0x00, 0x82, 0x00, 0x95, 0x00, 0xa7, 0x00,
+  0xb9, 0x00, 0xc9, 0x00, 0xdf, 0x00, 0xe9, 0x00, 0xf3, 0x00, 0xfd, 0x00,
+  0x07, 0x01, 0x11, 0x01, 0x1b, 0x01, 0x25, 0x01, 0x2f, 0x01, 0x38, 0x01,
+  0x41, 0x01, 0x4a, 0x01, 0x53, 0x01, 0x00, 0x00, 0x0e, 0x00, 0x1e, 0x00,
+  0x2e, 0x00, 0x40, 0x00, 0x4f, 0x00, 0x59, 0x00, 0x69, 0x00, 0x7a, 0x00,
+  0x8a, 0x00, 0x9a, 0x00, 0xab, 0x00, 0xc1, 0x00, 0xd6, 0x00, 0xdf, 0x00,
+  0xe8, 0x00, 0xf2, 0x00, 0xfb, 0x00, 0x04, 0x01, 0x0d, 0x01, 0x16, 0x01,
+  0x1f, 0x01, 0x28, 0x01, 0x30, 0x01, 0x3c, 0x01, 0x45, 0x01, 0x4d, 0x01,
+  0x57, 0x01, 0x60, 0x01, 0x6a, 0x01, 0x00, 0x00, 0x10, 0x00, 0x23, 0x00,
+  0x35, 0x00, 0x48, 0x00, 0x5b, 0x00, 0x6d, 0x00, 0x75, 0x00, 0x7c, 0x00,
+  0x86, 0x00, 0x8d, 0x00, 0x97, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x29, 0x00,
+  0x45, 0x00, 0x62, 0x00, 0x7d, 0x00, 0x97, 0x00, 0xb2, 0x00, 0xcb, 0x00,
+  0xe4, 0x00, 0xfe, 0x00, 0x16, 0x01, 0x2f, 0x01, 0x49, 0x01, 0x61, 0x01,
+  0x7c, 0x01, 0x95, 0x01, 0xb1, 0x01, 0xcb, 0x01, 0xe6, 0x01, 0xff, 0x01,
+  0x0d, 0x02, 0x20, 0x02, 0x2f, 0x02, 0x3e, 0x02, 0x46, 0x02, 0x4f, 0x02,
+  0x58, 0x02, 0x61, 0x02, 0x6a, 0x02, 0x72, 0x02, 0x7f, 0x02, 0x86, 0x02,
+  0x8d, 0x02, 0x94, 0x02, 0x9f, 0x02, 0xa6, 0x02, 0x00, 0x00, 0x1c, 0x00,
+  0x37, 0x00, 0x55, 0x00, 0x74, 0x00, 0x92, 0x00, 0xaf, 0x00, 0xcb, 0x00,
+  0xe7, 0x00, 0x02, 0x01, 0x1e, 0x01, 0x39, 0x01, 0x55, 0x01, 0x74, 0x01,
+  0x91, 0x01, 0xad, 0x01, 0xc9, 0x01, 0xe4, 0x01, 0x02, 0x02, 0x21, 0x02,
+  0x3f, 0x02, 0x5c, 0x02, 0x78, 0x02, 0x94, 0x02, 0xaf, 0x02, 0xcb, 0x02,
+  0xe6, 0x02, 0x02, 0x03, 0x21, 0x03, 0x3e, 0x03, 0x5a, 0x03, 0x64, 0x03,
+  0x6c, 0x03, 0x75, 0x03, 0x00, 0x00, 0x0e, 0x00, 0x1e, 0x00, 0x25, 0x00,
+  0x2e, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x31, 0x00, 0x45, 0x00, 0x57, 0x00,
+  0x70, 0x00, 0x88, 0x00, 0x9e, 0x00, 0xaa, 0x00, 0xb6, 0x00, 0xc2, 0x00,
+  0xce, 0x00, 0xda, 0x00, 0xe6, 0x00, 0xf2, 0x00, 0xfe, 0x00, 0x0a, 0x01,
+  0x16, 0x01, 0x22, 0x01, 0x2e, 0x01, 0x3a, 0x01, 0x46, 0x01, 0x52, 0x01,
+  0x5e, 0x01, 0x6a, 0x01, 0x76, 0x01, 0x82, 0x01, 0x8e, 0x01, 0x9a, 0x01,
+  0xa6, 0x01, 0xb2, 0x01, 0xbe, 0x01, 0xca, 0x01, 0xd6, 0x01, 0xe2, 0x01,
+  0xee, 0x01, 0xfa, 0x01, 0x06, 0x02, 0x12, 0x02, 0x1e, 0x02, 0x2a, 0x02,
+  0x36, 0x02, 0x42, 0x02, 0x4e, 0x02, 0x5a, 0x02, 0x66, 0x02, 0x72, 0x02,
+  0x7e, 0x02, 0x8a, 0x02, 0x96, 0x02, 0xa2, 0x02, 0xae, 0x02, 0xba, 0x02,
+  0xc6, 0x02, 0xd2, 0x02, 0xde, 0x02, 0xea, 0x02, 0xf6, 0x02, 0x02, 0x03,
+  0x0e, 0x03, 0x1a, 0x03, 0x26, 0x03, 0x32, 0x03, 0x3e, 0x03, 0x4a, 0x03,
+  0x56, 0x03, 0x62, 0x03, 0x6e, 0x03, 0x7a, 0x03, 0x86, 0x03, 0x92, 0x03,
+  0x9e, 0x03, 0xaa, 0x03, 0xb6, 0x03, 0xc2, 0x03, 0xce, 0x03, 0xda, 0x03,
+  0xe6, 0x03, 0xf2, 0x03, 0xfe, 0x03, 0x0a, 0x04, 0x16, 0x04, 0x22, 0x04,
+  0x2e, 0x04, 0x3a, 0x04, 0x46, 0x04, 0x52, 0x04, 0x5e, 0x04, 0x6a, 0x04,
+  0x76, 0x04, 0x82, 0x04, 0x8e, 0x04, 0x9a, 0x04, 0xa6, 0x04, 0xb2, 0x04,
+  0xbe, 0x04, 0xca, 0x04, 0xd6, 0x04, 0xe2, 0x04, 0xee, 0x04, 0xfa, 0x04,
+  0x06, 0x05, 0x12, 0x05, 0x1e, 0x05, 0x2a, 0x05, 0x36, 0x05, 0x42, 0x05,
+  0x4e, 0x05, 0x5a, 0x05, 0x66, 0x05, 0x70, 0x05, 0x78, 0x05, 0x80, 0x05,
+  0x8a, 0x05, 0x94, 0x05, 0x9f, 0x05, 0xa7, 0x05, 0x00, 0x00, 0x0f, 0x00,
+  0x16, 0x00, 0x1d, 0x00, 0x26, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x18, 0x00, 0x24, 0x00, 0x2c, 0x00, 0x36, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x19, 0x00, 0x2d, 0x00, 0x46, 0x00, 0x52, 0x00, 0x5e, 0x00,
+  0x6a, 0x00, 0x76, 0x00, 0x82, 0x00, 0x8e, 0x00, 0x9a, 0x00, 0xa6, 0x00,
+  0xb2, 0x00, 0xbe, 0x00, 0xcd, 0x00, 0xd9, 0x00, 0xe5, 0x00, 0xf1, 0x00,
+  0xfd, 0x00, 0x09, 0x01, 0x15, 0x01, 0x21, 0x01, 0x2d, 0x01, 0x39, 0x01,
+  0x45, 0x01, 0x51, 0x01, 0x5d, 0x01, 0x69, 0x01, 0x75, 0x01, 0x81, 0x01,
+  0x8d, 0x01, 0x99, 0x01, 0xa5, 0x01, 0xb4, 0x01, 0xc3, 0x01, 0xcf, 0x01,
+  0xdb, 0x01, 0xe7, 0x01, 0xf3, 0x01, 0xff, 0x01, 0x0b, 0x02, 0x17, 0x02,
+  0x23, 0x02, 0x2f, 0x02, 0x3b, 0x02, 0x47, 0x02, 0x53, 0x02, 0x5f, 0x02,
+  0x6b, 0x02, 0x77, 0x02, 0x83, 0x02, 0x8f, 0x02, 0x9b, 0x02, 0xa7, 0x02,
+  0xb3, 0x02, 0xbf, 0x02, 0xcb, 0x02, 0xda, 0x02, 0xe6, 0x02, 0xf2, 0x02,
+  0xfe, 0x02, 0x0a, 0x03, 0x19, 0x03, 0x25, 0x03, 0x31, 0x03, 0x3d, 0x03,
+  0x49, 0x03, 0x55, 0x03, 0x61, 0x03, 0x6d, 0x03, 0x79, 0x03, 0x85, 0x03,
+  0x91, 0x03, 0x9d, 0x03, 0xa9, 0x03, 0xb5, 0x03, 0xc1, 0x03, 0xcd, 0x03,
+  0xd9, 0x03, 0xe5, 0x03, 0xf1, 0x03, 0xfd, 0x03, 0x09, 0x04, 0x15, 0x04,
+  0x21, 0x04, 0x2d, 0x04, 0x39, 0x04, 0x45, 0x04, 0x51, 0x04, 0x5d, 0x04,
+  0x69, 0x04, 0x75, 0x04, 0x81, 0x04, 0x8b, 0x04, 0x93, 0x04, 0x9d, 0x04,
+  0xa4, 0x04, 0xab, 0x04, 0xb1, 0x04, 0xb7, 0x04, 0xbd, 0x04, 0xc3, 0x04,
+  0xc9, 0x04, 0x00, 0x00, 0x0a, 0x00, 0x14, 0x00, 0x21, 0x00, 0x39, 0x00,
+  0x4c, 0x00, 0x69, 0x00, 0x84, 0x00, 0x98, 0x00, 0xab, 0x00, 0xb5, 0x00,
+  0xbf, 0x00, 0xc6, 0x00, 0xcd, 0x00, 0xd8, 0x00, 0xe2, 0x00, 0xeb, 0x00,
+  0x00, 0x00, 0x14, 0x00, 0x24, 0x00, 0x30, 0x00, 0x42, 0x00, 0x54, 0x00,
+  0x66, 0x00, 0x79, 0x00, 0x8b, 0x00, 0x9e, 0x00, 0xaa, 0x00, 0xb6, 0x00,
+  0xc2, 0x00, 0xcf, 0x00, 0xdb, 0x00, 0xe7, 0x00, 0xf3, 0x00, 0xff, 0x00,
+  0x0b, 0x01, 0x17, 0x01, 0x23, 0x01, 0x2f, 0x01, 0x3c, 0x01, 0x49, 0x01,
+  0x55, 0x01, 0x61, 0x01, 0x6d, 0x01, 0x79, 0x01, 0x85, 0x01, 0x91, 0x01,
+  0x9e, 0x01, 0xaa, 0x01, 0xb6, 0x01, 0xc3, 0x01, 0xcf, 0x01, 0xdb, 0x01,
+  0xe7, 0x01, 0xf4, 0x01, 0xfa, 0x01, 0x00, 0x02, 0x09, 0x02, 0x00, 0x00,
+  0x0b, 0x00, 0x16, 0x00, 0x33, 0x00, 0x51, 0x00, 0x6e, 0x00, 0x8a, 0x00,
+  0xa5, 0x00, 0xc0, 0x00, 0xda, 0x00, 0xf5, 0x00, 0x0f, 0x01, 0x2a, 0x01,
+  0x48, 0x01, 0x64, 0x01, 0x7f, 0x01, 0x94, 0x01, 0xae, 0x01, 0xc7, 0x01,
+  0xd0, 0x01, 0xd9, 0x01, 0xe2, 0x01, 0xec, 0x01, 0xf5, 0x01, 0x01, 0x02,
+  0x0d, 0x02, 0x19, 0x02, 0x25, 0x02, 0x31, 0x02, 0x3d, 0x02, 0x49, 0x02,
+  0x55, 0x02, 0x61, 0x02, 0x6d, 0x02, 0x74, 0x02, 0x7b, 0x02, 0x82, 0x02,
+  0x89, 0x02, 0x90, 0x02, 0x97, 0x02, 0x00, 0x00, 0x12, 0x00, 0x25, 0x00,
+  0x34, 0x00, 0x43, 0x00, 0x52, 0x00, 0x61, 0x00, 0x70, 0x00, 0x7f, 0x00,
+  0x8e, 0x00, 0x9d, 0x00, 0xac, 0x00, 0xbb, 0x00, 0xca, 0x00, 0xd9, 0x00,
+  0xe8, 0x00, 0xf7, 0x00, 0x06, 0x01, 0x15, 0x01, 0x24, 0x01, 0x33, 0x01,
+  0x42, 0x01, 0x51, 0x01, 0x5b, 0x01, 0x66, 0x01, 0x70, 0x01, 0x79, 0x01,
+  0x83, 0x01, 0x8d, 0x01, 0x9a, 0x01, 0xa7, 0x01, 0xb4, 0x01, 0xbd, 0x01,
+  0xc7, 0x01, 0xd1, 0x01, 0xde, 0x01, 0xeb, 0x01, 0xf8, 0x01, 0x02, 0x02,
+  0x0f, 0x02, 0x1c, 0x02, 0x25, 0x02, 0x2f, 0x02, 0x3c, 0x02, 0x49, 0x02,
+  0x4f, 0x02, 0x57, 0x02, 0x62, 0x02, 0x00, 0x00, 0x0f, 0x00, 0x20, 0x00,
+  0x33, 0x00, 0x48, 0x00, 0x5d, 0x00, 0x71, 0x00, 0x84, 0x00, 0x95, 0x00,
+  0xa7, 0x00, 0xb7, 0x00, 0xc7, 0x00, 0xd7, 0x00, 0xe7, 0x00, 0xf1, 0x00,
+  0xfb, 0x00, 0x05, 0x01, 0x0e, 0x01, 0x18, 0x01, 0x22, 0x01, 0x2c, 0x01,
+  0x36, 0x01, 0x40, 0x01, 0x49, 0x01, 0x53, 0x01, 0x5c, 0x01, 0x69, 0x01,
+  0x73, 0x01, 0x7d, 0x01, 0x87, 0x01, 0x91, 0x01, 0x9b, 0x01, 0xa5, 0x01,
+  0xaf, 0x01, 0xb9, 0x01, 0xc3, 0x01, 0x00, 0x00, 0x1c, 0x00, 0x38, 0x00,
+  0x54, 0x00, 0x6f, 0x00, 0x8c, 0x00, 0xa8, 0x00, 0xbe, 0x00, 0xd2, 0x00,
+  0xdc, 0x00, 0xe8, 0x00, 0xf2, 0x00, 0xfc, 0x00, 0x08, 0x01, 0x14, 0x01,
+  0x20, 0x01, 0x2a, 0x01, 0x34, 0x01, 0x3e, 0x01, 0x4a, 0x01, 0x56, 0x01,
+  0x60, 0x01, 0x6c, 0x01, 0x76, 0x01, 0x80, 0x01, 0x8a, 0x01, 0x96, 0x01,
+  0xa0, 0x01, 0xaa, 0x01, 0xb4, 0x01, 0xbe, 0x01, 0xc8, 0x01, 0xd2, 0x01,
+  0xdc, 0x01, 0xe6, 0x01, 0xf2, 0x01, 0xfc, 0x01, 0x08, 0x02, 0x14, 0x02,
+  0x20, 0x02, 0x2a, 0x02, 0x34, 0x02, 0x40, 0x02, 0x4a, 0x02, 0x54, 0x02,
+  0x5e, 0x02, 0x6a, 0x02, 0x76, 0x02, 0x82, 0x02, 0x8c, 0x02, 0x98, 0x02,
+  0xa2, 0x02, 0xae, 0x02, 0xba, 0x02, 0xc6, 0x02, 0xd2, 0x02, 0xde, 0x02,
+  0xea, 0x02, 0xf6, 0x02, 0x02, 0x03, 0x0e, 0x03, 0x1a, 0x03, 0x26, 0x03,
+  0x32, 0x03, 0x3c, 0x03, 0x46, 0x03, 0x50, 0x03, 0x5c, 0x03, 0x68, 0x03,
+  0x72, 0x03, 0x7e, 0x03, 0x88, 0x03, 0x92, 0x03, 0x9c, 0x03, 0xa8, 0x03,
+  0xb2, 0x03, 0xbe, 0x03, 0xc8, 0x03, 0xd2, 0x03, 0xde, 0x03, 0xea, 0x03,
+  0xf6, 0x03, 0x02, 0x04, 0x0e, 0x04, 0x18, 0x04, 0x24, 0x04, 0x30, 0x04,
+  0x3a, 0x04, 0x44, 0x04, 0x50, 0x04, 0x5a, 0x04, 0x66, 0x04, 0x70, 0x04,
+  0x7c, 0x04, 0x86, 0x04, 0x92, 0x04, 0x9c, 0x04, 0xa8, 0x04, 0xb2, 0x04,
+  0xbe, 0x04, 0xc5, 0x04, 0x00, 0x00, 0x0c, 0x00, 0x19, 0x00, 0x31, 0x00,
+  0x49, 0x00, 0x61, 0x00, 0x79, 0x00, 0x92, 0x00, 0xa9, 0x00, 0xc1, 0x00,
+  0xd9, 0x00, 0xf1, 0x00, 0x0a, 0x01, 0x23, 0x01, 0x3b, 0x01, 0x53, 0x01,
+  0x6b, 0x01, 0x83, 0x01, 0x9b, 0x01, 0xb2, 0x01, 0xcb, 0x01, 0xe3, 0x01,
+  0xfb, 0x01, 0x12, 0x02, 0x2c, 0x02, 0x45, 0x02, 0x5e, 0x02, 0x76, 0x02,
+  0x8e, 0x02, 0xa7, 0x02, 0xbf, 0x02, 0xcb, 0x02, 0xd7, 0x02, 0xe3, 0x02,
+  0xef, 0x02, 0xfb, 0x02, 0x07, 0x03, 0x13, 0x03, 0x1f, 0x03, 0x2b, 0x03,
+  0x39, 0x03, 0x45, 0x03, 0x52, 0x03, 0x5a, 0x03, 0x62, 0x03, 0x6e, 0x03,
+  0x7a, 0x03, 0x86, 0x03, 0x92, 0x03, 0x9e, 0x03, 0xaa, 0x03, 0xb6, 0x03,
+  0xc2, 0x03, 0xce, 0x03, 0xda, 0x03, 0xe6, 0x03, 0xf2, 0x03, 0xfe, 0x03,
+  0x0a, 0x04, 0x16, 0x04, 0x22, 0x04, 0x2e, 0x04, 0x3a, 0x04, 0x46, 0x04,
+  0x52, 0x04, 0x5e, 0x04, 0x6a, 0x04, 0x6f, 0x04, 0x7b, 0x04, 0x87, 0x04,
+  0x93, 0x04, 0x9f, 0x04, 0xab, 0x04, 0xb7, 0x04, 0xc4, 0x04, 0xd0, 0x04,
+  0xdc, 0x04, 0xe4, 0x04, 0xec, 0x04, 0x00, 0x00, 0x14, 0x00, 0x21, 0x00,
+  0x34, 0x00, 0x48, 0x00, 0x5e, 0x00, 0x72, 0x00, 0x84, 0x00, 0x9c, 0x00,
+  0xa6, 0x00, 0xaf, 0x00, 0xb8, 0x00, 0xc1, 0x00, 0xce, 0x00, 0x00, 0x00,
+  0x15, 0x00, 0x25, 0x00, 0x34, 0x00, 0x43, 0x00, 0x52, 0x00, 0x61, 0x00,
+  0x00, 0x00, 0x19, 0x00, 0x26, 0x00, 0x30, 0x00, 0x3a, 0x00, 0x44, 0x00,
+  0x4a, 0x00, 0x53, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x12, 0x00, 0x1e, 0x00,
+  0x30, 0x00, 0x43, 0x00, 0x54, 0x00, 0x63, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x19, 0x00, 0x25, 0x00, 0x3e, 0x00, 0x55, 0x00, 0x5f, 0x00, 0x6c, 0x00,
+  0x73, 0x00, 0x7a, 0x00, 0x81, 0x00, 0x88, 0x00, 0x94, 0x00, 0x9a, 0x00,
+  0xa0, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x11, 0x00, 0x33, 0x00, 0x42, 0x00,
+  0x5a, 0x00, 0x72, 0x00, 0x7b, 0x00, 0x84, 0x00, 0x8d, 0x00, 0x00, 0x00,
+  0x16, 0x00, 0x21, 0x00, 0x37, 0x00, 0x4d, 0x00, 0x5f, 0x00, 0x67, 0x00,
+  0x6e, 0x00, 0x77, 0x00, 0x00, 0x00, 0x17, 0x00, 0x20, 0x00, 0x29, 0x00,
+  0x33, 0x00, 0x00, 0x00, 0x12, 0x00, 0x29, 0x00, 0x3c, 0x00, 0x4d, 0x00,
+  0x58, 0x00, 0x63, 0x00, 0x6e, 0x00, 0x78, 0x00, 0x81, 0x00, 0x8c, 0x00,
+  0x97, 0x00, 0xa2, 0x00, 0xa8, 0x00, 0x00, 0x00, 0x16, 0x00, 0x2f, 0x00,
+  0x47, 0x00, 0x51, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x35, 0x00,
+  0x4f, 0x00, 0x68, 0x00, 0x80, 0x00, 0x98, 0x00, 0xaf, 0x00, 0xc7, 0x00,
+  0xde, 0x00, 0xf6, 0x00, 0x11, 0x01, 0x2a, 0x01, 0x42, 0x01, 0x4e, 0x01,
+  0x5a, 0x01, 0x66, 0x01, 0x72, 0x01, 0x7e, 0x01, 0x8a, 0x01, 0x96, 0x01,
+  0xa2, 0x01, 0xae, 0x01, 0xba, 0x01, 0xc6, 0x01, 0xd2, 0x01, 0xde, 0x01,
+  0xe8, 0x01, 0xf3, 0x01, 0xfd, 0x01, 0x08, 0x02, 0x12, 0x02, 0x1c, 0x02,
+  0x26, 0x02, 0x33, 0x02, 0x3a, 0x02, 0x00, 0x00, 0x10, 0x00, 0x18, 0x00,
+  0x24, 0x00, 0x2e, 0x00, 0x36, 0x00, 0x42, 0x00, 0x48, 0x00, 0x00, 0x00,
+  0x19, 0x00, 0x32, 0x00, 0x3e, 0x00, 0x44, 0x00, 0x4c, 0x00, 0x59, 0x00,
+  0x63, 0x00, 0x69, 0x00, 0x78, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x1a, 0x00,
+  0x29, 0x00, 0x37, 0x00, 0x4f, 0x00, 0x62, 0x00, 0x74, 0x00, 0x91, 0x00,
+  0xa9, 0x00, 0xb7, 0x00, 0xc5, 0x00, 0xd1, 0x00, 0xdd, 0x00, 0xe9, 0x00,
+  0xf2, 0x00, 0xfb, 0x00, 0x04, 0x01, 0x0d, 0x01, 0x16, 0x01, 0x1f, 0x01,
+  0x28, 0x01, 0x30, 0x01, 0x3a, 0x01, 0x46, 0x01, 0x50, 0x01, 0x5c, 0x01,
+  0x66, 0x01, 0x70, 0x01, 0x7a, 0x01, 0x84, 0x01, 0x8e, 0x01, 0x95, 0x01,
+  0x9c, 0x01, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x13, 0x00, 0x21, 0x00,
+  0x30, 0x00, 0x40, 0x00, 0x4f, 0x00, 0x65, 0x00, 0x79, 0x00, 0x89, 0x00,
+  0x9b, 0x00, 0xa7, 0x00, 0xaf, 0x00, 0xb7, 0x00, 0xc4, 0x00, 0xcc, 0x00,
+  0xd8, 0x00, 0xe1, 0x00, 0xed, 0x00, 0xf4, 0x00, 0xfe, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x26, 0x00, 0x39, 0x00, 0x4c, 0x00, 0x5f, 0x00, 0x73, 0x00,
+  0x88, 0x00, 0x9c, 0x00, 0xb8, 0x00, 0xd2, 0x00, 0xef, 0x00, 0xfe, 0x00,
+  0x0d, 0x01, 0x17, 0x01, 0x21, 0x01, 0x2b, 0x01, 0x34, 0x01, 0x3d, 0x01,
+  0x46, 0x01, 0x4f, 0x01, 0x58, 0x01, 0x00, 0x00, 0x0d, 0x00, 0x1b, 0x00,
+  0x28, 0x00, 0x35, 0x00, 0x45, 0x00, 0x55, 0x00, 0x65, 0x00, 0x75, 0x00,
+  0x7d, 0x00, 0x86, 0x00, 0x8f, 0x00, 0x98, 0x00, 0xa1, 0x00, 0xa9, 0x00,
+  0xb1, 0x00, 0xbc, 0x00, 0xc3, 0x00, 0xca, 0x00, 0xd1, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x25, 0x00, 0x49, 0x00, 0x6e, 0x00, 0x76, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x11, 0x00, 0x1a, 0x00, 0x23, 0x00, 0x2d, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x24, 0x00, 0x3c, 0x00, 0x54, 0x00, 0x5f, 0x00, 0x69, 0x00,
+  0x73, 0x00, 0x7d, 0x00, 0x83, 0x00, 0x8c, 0x00, 0x00, 0x00, 0x13, 0x00,
+  0x27, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x12, 0x00, 0x24, 0x00, 0x00, 0x00,
+  0x18, 0x00, 0x2a, 0x00, 0x3f, 0x00, 0x52, 0x00, 0x5b, 0x00, 0x64, 0x00,
+  0x6e, 0x00, 0x78, 0x00, 0x85, 0x00, 0x8b, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x20, 0x00, 0x30, 0x00, 0x3b, 0x00, 0x46, 0x00, 0x4e, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x37, 0x00, 0x51, 0x00, 0x67, 0x00, 0x7c, 0x00, 0x86, 0x00,
+  0x90, 0x00, 0x98, 0x00, 0xa2, 0x00, 0x00, 0x00, 0x19, 0x00, 0x2c, 0x00,
+  0x3f, 0x00, 0x4b, 0x00, 0x57, 0x00, 0x63, 0x00, 0x6f, 0x00, 0x7b, 0x00,
+  0x85, 0x00, 0x91, 0x00, 0x9b, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x0d, 0x00,
+  0x29, 0x00, 0x44, 0x00, 0x4d, 0x00, 0x55, 0x00, 0x5c, 0x00, 0x63, 0x00,
+  0x6b, 0x00, 0x72, 0x00, 0x79, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1d, 0x00,
+  0x2b, 0x00, 0x38, 0x00, 0x40, 0x00, 0x49, 0x00, 0x52, 0x00, 0x5b, 0x00,
+  0x62, 0x00, 0x6a, 0x00, 0x72, 0x00, 0x7a, 0x00, 0x82, 0x00, 0x8a, 0x00,
+  0x92, 0x00, 0x99, 0x00, 0xa5, 0x00, 0xac, 0x00, 0xbc, 0x00, 0xcc, 0x00,
+  0xda, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1f, 0x00, 0x30, 0x00, 0x3a, 0x00,
+  0x43, 0x00, 0x4d, 0x00, 0x00, 0x00, 0x15, 0x00, 0x28, 0x00, 0x40, 0x00,
+  0x59, 0x00, 0x6f, 0x00, 0x83, 0x00, 0x90, 0x00, 0x9a, 0x00, 0xa1, 0x00,
+  0x00, 0x00, 0x11, 0x00, 0x21, 0x00, 0x2e, 0x00, 0x40, 0x00, 0x53, 0x00,
+  0x66, 0x00, 0x74, 0x00, 0x7d, 0x00, 0x86, 0x00, 0x90, 0x00, 0x9a, 0x00,
+  0xa2, 0x00, 0xaf, 0x00, 0xb9, 0x00, 0xc1, 0x00, 0xc9, 0x00, 0xd5, 0x00,
+  0xdc, 0x00, 0xe3, 0x00, 0xea, 0x00, 0xf3, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x1c, 0x00, 0x2b, 0x00, 0x3a, 0x00, 0x48, 0x00, 0x5f, 0x00, 0x77, 0x00,
+  0x8e, 0x00, 0xa4, 0x00, 0xb9, 0x00, 0xce, 0x00, 0xe2, 0x00, 0xf7, 0x00,
+  0x0b, 0x01, 0x20, 0x01, 0x38, 0x01, 0x4e, 0x01, 0x63, 0x01, 0x79, 0x01,
+  0x8f, 0x01, 0xa6, 0x01, 0xbb, 0x01, 0xc4, 0x01, 0xcd, 0x01, 0xd5, 0x01,
+  0xdd, 0x01, 0xe5, 0x01, 0xed, 0x01, 0xf5, 0x01, 0xfd, 0x01, 0x05, 0x02,
+  0x0d, 0x02, 0x18, 0x02, 0x24, 0x02, 0x2f, 0x02, 0x37, 0x02, 0x3f, 0x02,
+  0x47, 0x02, 0x50, 0x02, 0x58, 0x02, 0x5e, 0x02, 0x69, 0x02, 0x70, 0x02,
+  0x7a, 0x02, 0x00, 0x00, 0x15, 0x00, 0x29, 0x00, 0x33, 0x00, 0x4f, 0x00,
+  0x6c, 0x00, 0x88, 0x00, 0xa3, 0x00, 0xbd, 0x00, 0xd7, 0x00, 0xf0, 0x00,
+  0x0a, 0x01, 0x23, 0x01, 0x3d, 0x01, 0x5a, 0x01, 0x75, 0x01, 0x8f, 0x01,
+  0xa2, 0x01, 0xb4, 0x01, 0xc7, 0x01, 0xda, 0x01, 0xee, 0x01, 0x01, 0x02,
+  0x0d, 0x02, 0x19, 0x02, 0x25, 0x02, 0x31, 0x02, 0x3d, 0x02, 0x49, 0x02,
+  0x55, 0x02, 0x61, 0x02, 0x6d, 0x02, 0x79, 0x02, 0x85, 0x02, 0x91, 0x02,
+  0x9d, 0x02, 0xa9, 0x02, 0xb5, 0x02, 0xc1, 0x02, 0xcd, 0x02, 0xd9, 0x02,
+  0xe5, 0x02, 0xf1, 0x02, 0xfd, 0x02, 0x09, 0x03, 0x15, 0x03, 0x21, 0x03,
+  0x2d, 0x03, 0x39, 0x03, 0x45, 0x03, 0x51, 0x03, 0x5d, 0x03, 0x69, 0x03,
+  0x75, 0x03, 0x81, 0x03, 0x8d, 0x03, 0x99, 0x03, 0xa5, 0x03, 0xb1, 0x03,
+  0xbd, 0x03, 0xc9, 0x03, 0xd5, 0x03, 0xe1, 0x03, 0xed, 0x03, 0xf9, 0x03,
+  0x05, 0x04, 0x11, 0x04, 0x1d, 0x04, 0x29, 0x04, 0x35, 0x04, 0x41, 0x04,
+  0x4d, 0x04, 0x59, 0x04, 0x65, 0x04, 0x71, 0x04, 0x7d, 0x04, 0x89, 0x04,
+  0x95, 0x04, 0xa1, 0x04, 0xad, 0x04, 0xb9, 0x04, 0xc5, 0x04, 0xd1, 0x04,
+  0xdd, 0x04, 0xe9, 0x04, 0xf5, 0x04, 0x01, 0x05, 0x0d, 0x05, 0x19, 0x05,
+  0x25, 0x05, 0x31, 0x05, 0x3d, 0x05, 0x49, 0x05, 0x55, 0x05, 0x61, 0x05,
+  0x6d, 0x05, 0x79, 0x05, 0x85, 0x05, 0x91, 0x05, 0x9d, 0x05, 0xa9, 0x05,
+  0xb5, 0x05, 0xc1, 0x05, 0xcd, 0x05, 0xd9, 0x05, 0xe5, 0x05, 0xf1, 0x05,
+  0xfd, 0x05, 0x09, 0x06, 0x13, 0x06, 0x20, 0x06, 0x27, 0x06, 0x00, 0x00,
+  0x11, 0x00, 0x2d, 0x00, 0x48, 0x00, 0x58, 0x00, 0x62, 0x00, 0x6c, 0x00,
+  0x78, 0x00, 0x7e, 0x00, 0x8c, 0x00, 0x9a, 0x00, 0x00, 0x00, 0x18, 0x00,
+  0x2c, 0x00, 0x39, 0x00, 0x4b, 0x00, 0x5d, 0x00, 0x77, 0x00, 0x8c, 0x00,
+  0xa1, 0x00, 0xb7, 0x00, 0xcc, 0x00, 0xd5, 0x00, 0xde, 0x00, 0xe7, 0x00,
+  0xf5, 0x00, 0xfe, 0x00, 0x07, 0x01, 0x10, 0x01, 0x19, 0x01, 0x20, 0x01,
+  0x2a, 0x01, 0x33, 0x01, 0x3f, 0x01, 0x48, 0x01, 0x00, 0x00, 0x15, 0x00,
+  0x1c, 0x00, 0x2b, 0x00, 0x32, 0x00, 0x3d, 0x00, 0x48, 0x00, 0x53, 0x00,
+  0x5a, 0x00, 0x61, 0x00, 0x73, 0x00, 0x83, 0x00, 0x99, 0x00, 0x00, 0x00,
+  0x16, 0x00, 0x2d, 0x00, 0x46, 0x00, 0x5f, 0x00, 0x79, 0x00, 0x91, 0x00,
+  0xaa, 0x00, 0xb6, 0x00, 0xbf, 0x00, 0xcb, 0x00, 0xd4, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x1b, 0x00, 0x32, 0x00, 0x48, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x19, 0x00, 0x23, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x4b, 0x00, 0x5c, 0x00,
+  0x66, 0x00, 0x82, 0x00, 0x9f, 0x00, 0xbb, 0x00, 0xd6, 0x00, 0xf0, 0x00,
+  0x0a, 0x01, 0x23, 0x01, 0x3d, 0x01, 0x56, 0x01, 0x70, 0x01, 0x8d, 0x01,
+  0xa8, 0x01, 0xc2, 0x01, 0xcc, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x1c, 0x00,
+  0x37, 0x00, 0x4a, 0x00, 0x60, 0x00, 0x66, 0x00, 0x6f, 0x00, 0x78, 0x00,
+  0x82, 0x00, 0x00, 0x00, 0x12, 0x00, 0x27, 0x00, 0x2e, 0x00, 0x37, 0x00,
+  0x3e, 0x00, 0x47, 0x00, 0x00, 0x00, 0x11, 0x00, 0x23, 0x00, 0x2b, 0x00,
+  0x36, 0x00, 0x3e, 0x00, 0x46, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x14, 0x00,
+  0x26, 0x00, 0x36, 0x00, 0x43, 0x00, 0x55, 0x00, 0x5b, 0x00, 0x63, 0x00,
+  0x6a, 0x00, 0x78, 0x00, 0x86, 0x00, 0x94, 0x00, 0xa2, 0x00, 0xb0, 0x00,
+  0xbe, 0x00, 0xcc, 0x00, 0xda, 0x00, 0xe8, 0x00, 0xf6, 0x00, 0x04, 0x01,
+  0x0e, 0x01, 0x1b, 0x01, 0x00, 0x00, 0x11, 0x00, 0x22, 0x00, 0x3c, 0x00,
+  0x57, 0x00, 0x73, 0x00, 0x8d, 0x00, 0xa6, 0x00, 0xc0, 0x00, 0xd8, 0x00,
+  0xf0, 0x00, 0x09, 0x01, 0x20, 0x01, 0x38, 0x01, 0x51, 0x01, 0x68, 0x01,
+  0x82, 0x01, 0x9a, 0x01, 0xb5, 0x01, 0xce, 0x01, 0xe8, 0x01, 0x00, 0x02,
+  0x15, 0x02, 0x1e, 0x02, 0x27, 0x02, 0x30, 0x02, 0x39, 0x02, 0x45, 0x02,
+  0x51, 0x02, 0x5d, 0x02, 0x69, 0x02, 0x75, 0x02, 0x81, 0x02, 0x8d, 0x02,
+  0x99, 0x02, 0xa5, 0x02, 0xae, 0x02, 0xba, 0x02, 0xc6, 0x02, 0xd2, 0x02,
+  0xde, 0x02, 0xe8, 0x02, 0xee, 0x02, 0xf5, 0x02, 0xfd, 0x02, 0x00, 0x00,
+  0x13, 0x00, 0x28, 0x00, 0x40, 0x00, 0x56, 0x00, 0x70, 0x00, 0x89, 0x00,
+  0x93, 0x00, 0xa0, 0x00, 0xad, 0x00, 0xbd, 0x00, 0xca, 0x00, 0xd7, 0x00,
+  0xe4, 0x00, 0xec, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x20, 0x00, 0x33, 0x00,
+  0x45, 0x00, 0x57, 0x00, 0x6a, 0x00, 0x86, 0x00, 0xa2, 0x00, 0xb4, 0x00,
+  0xc0, 0x00, 0xcd, 0x00, 0xd7, 0x00, 0xdf, 0x00, 0xea, 0x00, 0xf2, 0x00,
+  0xfd, 0x00, 0x08, 0x01, 0x11, 0x01, 0x1a, 0x01, 0x23, 0x01, 0x2c, 0x01,
+  0x35, 0x01, 0x3f, 0x01, 0x49, 0x01, 0x53, 0x01, 0x5c, 0x01, 0x65, 0x01,
+  0x00, 0x00, 0x0c, 0x00, 0x1c, 0x00, 0x26, 0x00, 0x31, 0x00, 0x47, 0x00,
+  0x5d, 0x00, 0x73, 0x00, 0x89, 0x00, 0xa1, 0x00, 0xba, 0x00, 0xd1, 0x00,
+  0xd9, 0x00, 0xe0, 0x00, 0xe7, 0x00, 0xf8, 0x00, 0x01, 0x01, 0x0b, 0x01,
+  0x00, 0x00, 0x0f, 0x00, 0x25, 0x00, 0x3b, 0x00, 0x4e, 0x00, 0x5f, 0x00,
+  0x81, 0x00, 0x8a, 0x00, 0x92, 0x00, 0x9a, 0x00, 0xa3, 0x00, 0xac, 0x00,
+  0xb3, 0x00, 0xbf, 0x00, 0xc6, 0x00, 0xcc, 0x00, 0xd3, 0x00, 0xda, 0x00,
+  0xe3, 0x00, 0xea, 0x00, 0x00, 0x00, 0x14, 0x00, 0x27, 0x00, 0x3c, 0x00,
+  0x4f, 0x00, 0x69, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x18, 0x00, 0x25, 0x00,
+  0x32, 0x00, 0x3a, 0x00, 0x42, 0x00, 0x4b, 0x00, 0x51, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x20, 0x00, 0x36, 0x00, 0x4b, 0x00, 0x63, 0x00, 0x6f, 0x00,
+  0x7d, 0x00, 0x88, 0x00, 0x96, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x1d, 0x00,
+  0x31, 0x00, 0x3a, 0x00, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00,
+  0x22, 0x00, 0x36, 0x00, 0x49, 0x00, 0x5b, 0x00, 0x64, 0x00, 0x70, 0x00,
+  0x00, 0x00, 0x23, 0x00, 0x31, 0x00, 0x3d, 0x00, 0x53, 0x00, 0x69, 0x00,
+  0x71, 0x00, 0x7c, 0x00, 0x87, 0x00, 0x8f, 0x00, 0x96, 0x00, 0xa1, 0x00,
+  0xa9, 0x00, 0xb4, 0x00, 0x00, 0x00, 0x31, 0x00, 0x3e, 0x00, 0x53, 0x00,
+  0x74, 0x00, 0x8b, 0x00, 0xa3, 0x00, 0xb7, 0x00, 0xc1, 0x00, 0xc8, 0x00,
+  0xd0, 0x00, 0xda, 0x00, 0xe4, 0x00, 0xeb, 0x00, 0xf2, 0x00, 0xf8, 0x00,
+  0x01, 0x01, 0x0a, 0x01, 0x00, 0x00, 0x22, 0x00, 0x2e, 0x00, 0x3d, 0x00,
+  0x4c, 0x00, 0x5b, 0x00, 0x69, 0x00, 0x75, 0x00, 0x81, 0x00, 0x8d, 0x00,
+  0x99, 0x00, 0xa5, 0x00, 0xb4, 0x00, 0xc0, 0x00, 0xcc, 0x00, 0xd8, 0x00,
+  0xe4, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0x08, 0x01, 0x14, 0x01, 0x20, 0x01,
+  0x2c, 0x01, 0x38, 0x01, 0x44, 0x01, 0x50, 0x01, 0x5c, 0x01, 0x68, 0x01,
+  0x74, 0x01, 0x80, 0x01, 0x87, 0x01, 0x8e, 0x01, 0x95, 0x01, 0x9f, 0x01,
+  0xa6, 0x01, 0xad, 0x01, 0xb4, 0x01, 0xbf, 0x01, 0x00, 0x00, 0x26, 0x00,
+  0x34, 0x00, 0x42, 0x00, 0x50, 0x00, 0x5f, 0x00, 0x6e, 0x00, 0x8a, 0x00,
+  0xa7, 0x00, 0xc3, 0x00, 0xde, 0x00, 0xf8, 0x00, 0x12, 0x01, 0x2b, 0x01,
+  0x45, 0x01, 0x5e, 0x01, 0x78, 0x01, 0x95, 0x01, 0xb0, 0x01, 0xca, 0x01,
+  0xd9, 0x01, 0xe7, 0x01, 0xf4, 0x01, 0x04, 0x02, 0x13, 0x02, 0x1b, 0x02,
+  0x25, 0x02, 0x2d, 0x02, 0x39, 0x02, 0x45, 0x02, 0x4e, 0x02, 0x5a, 0x02,
+  0x66, 0x02, 0x72, 0x02, 0x7b, 0x02, 0x87, 0x02, 0x93, 0x02, 0x9f, 0x02,
+  0xab, 0x02, 0xb7, 0x02, 0xc3, 0x02, 0xcf, 0x02, 0xd7, 0x02, 0xe0, 0x02,
+  0xe9, 0x02, 0xf1, 0x02, 0xf9, 0x02, 0x01, 0x03, 0x09, 0x03, 0x11, 0x03,
+  0x19, 0x03, 0x21, 0x03, 0x2a, 0x03, 0x33, 0x03, 0x3b, 0x03, 0x43, 0x03,
+  0x4b, 0x03, 0x53, 0x03, 0x5b, 0x03, 0x00, 0x00, 0x1a, 0x00, 0x21, 0x00,
+  0x2c, 0x00, 0x36, 0x00, 0x42, 0x00, 0x4e, 0x00, 0x5e, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x24, 0x00, 0x3b, 0x00, 0x54, 0x00, 0x6c, 0x00, 0x84, 0x00,
+  0x9c, 0x00, 0xb4, 0x00, 0xce, 0x00, 0xe6, 0x00, 0xff, 0x00, 0x17, 0x01,
+  0x2b, 0x01, 0x45, 0x01, 0x54, 0x01, 0x5d, 0x01, 0x67, 0x01, 0x74, 0x01,
+  0x7e, 0x01, 0x8b, 0x01, 0x95, 0x01, 0x9e, 0x01, 0xa6, 0x01, 0xb0, 0x01,
+  0xba, 0x01, 0xc3, 0x01, 0xcc, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x19, 0x00,
+  0x26, 0x00, 0x44, 0x00, 0x61, 0x00, 0x6b, 0x00, 0x75, 0x00, 0x7d, 0x00,
+  0x84, 0x00, 0x8b, 0x00, 0x92, 0x00, 0x99, 0x00, 0xa0, 0x00, 0xa8, 0x00,
+  0xb0, 0x00, 0xb7, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x19, 0x00, 0x24, 0x00,
+  0x30, 0x00, 0x3f, 0x00, 0x4f, 0x00, 0x5f, 0x00, 0x78, 0x00, 0x90, 0x00,
+  0xa9, 0x00, 0xc2, 0x00, 0xcc, 0x00, 0xd8, 0x00, 0xe1, 0x00, 0xeb, 0x00,
+  0xf5, 0x00, 0xff, 0x00, 0x07, 0x01, 0x0f, 0x01, 0x17, 0x01, 0x1f, 0x01,
+  0x25, 0x01, 0x2d, 0x01, 0x35, 0x01, 0x3d, 0x01, 0x45, 0x01, 0x50, 0x01,
+  0x5c, 0x01, 0x65, 0x01, 0x71, 0x01, 0x7a, 0x01, 0x82, 0x01, 0x8a, 0x01,
+  0x00, 0x00, 0x12, 0x00, 0x1c, 0x00, 0x28, 0x00, 0x34, 0x00, 0x3e, 0x00,
+  0x48, 0x00, 0x4f, 0x00, 0x59, 0x00, 0x00, 0x00, 0x28, 0x00, 0x32, 0x00,
+  0x3d, 0x00, 0x57, 0x00, 0x70, 0x00, 0x7d, 0x00, 0x83, 0x00, 0x00, 0x00,
+  0x15, 0x00, 0x1f, 0x00, 0x33, 0x00, 0x42, 0x00, 0x56, 0x00, 0x6b, 0x00,
+  0x85, 0x00, 0xa0, 0x00, 0xb8, 0x00, 0xc2, 0x00, 0xc8, 0x00, 0xd1, 0x00,
+  0x00, 0x00, 0x1c, 0x00, 0x39, 0x00, 0x55, 0x00, 0x70, 0x00, 0x8a, 0x00,
+  0xa4, 0x00, 0xbd, 0x00, 0xd7, 0x00, 0xf0, 0x00, 0x0a, 0x01, 0x27, 0x01,
+  0x42, 0x01, 0x5c, 0x01, 0x6d, 0x01, 0x7d, 0x01, 0x9a, 0x01, 0xb5, 0x01,
+  0xc2, 0x01, 0xcf, 0x01, 0xdc, 0x01, 0xe9, 0x01, 0xf6, 0x01, 0x03, 0x02,
+  0x10, 0x02, 0x1d, 0x02, 0x2a, 0x02, 0x37, 0x02, 0x44, 0x02, 0x51, 0x02,
+  0x5d, 0x02, 0x6a, 0x02, 0x77, 0x02, 0x84, 0x02, 0x91, 0x02, 0x9e, 0x02,
+  0xab, 0x02, 0xb8, 0x02, 0xc5, 0x02, 0xd2, 0x02, 0xdf, 0x02, 0xec, 0x02,
+  0xf9, 0x02, 0x06, 0x03, 0x13, 0x03, 0x20, 0x03, 0x2d, 0x03, 0x39, 0x03,
+  0x46, 0x03, 0x53, 0x03, 0x60, 0x03, 0x6c, 0x03, 0x79, 0x03, 0x86, 0x03,
+  0x93, 0x03, 0xa0, 0x03, 0xad, 0x03, 0xba, 0x03, 0xc7, 0x03, 0xd4, 0x03,
+  0xe1, 0x03, 0xee, 0x03, 0xfb, 0x03, 0x08, 0x04, 0x15, 0x04, 0x22, 0x04,
+  0x2f, 0x04, 0x3c, 0x04, 0x49, 0x04, 0x55, 0x04, 0x5e, 0x04, 0x67, 0x04,
+  0x70, 0x04, 0x79, 0x04, 0x82, 0x04, 0x8b, 0x04, 0x94, 0x04, 0x9d, 0x04,
+  0xa7, 0x04, 0xad, 0x04, 0x00, 0x00, 0x0d, 0x00, 0x1e, 0x00, 0x38, 0x00,
+  0x4a, 0x00, 0x53, 0x00, 0x5d, 0x00, 0x66, 0x00, 0x72, 0x00, 0x7e, 0x00,
+  0x87, 0x00, 0x00, 0x00, 0x12, 0x00, 0x21, 0x00, 0x30, 0x00, 0x43, 0x00,
+  0x55, 0x00, 0x67, 0x00, 0x76, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x22, 0x00,
+  0x38, 0x00, 0x47, 0x00, 0x53, 0x00, 0x5f, 0x00, 0x6a, 0x00, 0x76, 0x00,
+  0x82, 0x00, 0x8e, 0x00, 0x9a, 0x00, 0xa6, 0x00, 0xb2, 0x00, 0xbe, 0x00,
+  0xca, 0x00, 0xd6, 0x00, 0xe2, 0x00, 0xee, 0x00, 0x00, 0x00, 0x11, 0x00,
+  0x22, 0x00, 0x33, 0x00, 0x4e, 0x00, 0x6a, 0x00, 0x85, 0x00, 0x9f, 0x00,
+  0xb8, 0x00, 0xd1, 0x00, 0xe9, 0x00, 0x02, 0x01, 0x1a, 0x01, 0x33, 0x01,
+  0x4f, 0x01, 0x69, 0x01, 0x82, 0x01, 0x91, 0x01, 0xa3, 0x01, 0xaf, 0x01,
+  0xbb, 0x01, 0xc6, 0x01, 0x00, 0x00, 0x10, 0x00, 0x1a, 0x00, 0x2b, 0x00,
+  0x35, 0x00, 0x3e, 0x00, 0x44, 0x00, 0x4d, 0x00, 0x55, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x1d, 0x00, 0x2d, 0x00, 0x37, 0x00, 0x42, 0x00, 0x4a, 0x00,
+  0x50, 0x00, 0x00, 0x00, 0x24, 0x00, 0x33, 0x00, 0x42, 0x00, 0x51, 0x00,
+  0x60, 0x00, 0x66, 0x00, 0x73, 0x00, 0x80, 0x00, 0x8d, 0x00, 0x9a, 0x00,
+  0xa7, 0x00, 0xb4, 0x00, 0x00, 0x00, 0x23, 0x00, 0x2f, 0x00, 0x44, 0x00,
+  0x58, 0x00, 0x6f, 0x00, 0x87, 0x00, 0x9e, 0x00, 0xb4, 0x00, 0xc9, 0x00,
+  0xde, 0x00, 0xf2, 0x00, 0x07, 0x01, 0x1b, 0x01, 0x30, 0x01, 0x48, 0x01,
+  0x5e, 0x01, 0x73, 0x01, 0x8d, 0x01, 0x9c, 0x01, 0xa3, 0x01, 0xae, 0x01,
+  0xbc, 0x01, 0xc7, 0x01, 0xd5, 0x01, 0xe3, 0x01, 0xee, 0x01, 0xfc, 0x01,
+  0x0a, 0x02, 0x18, 0x02, 0x00, 0x00, 0x11, 0x00, 0x24, 0x00, 0x35, 0x00,
+  0x41, 0x00, 0x4d, 0x00, 0x59, 0x00, 0x66, 0x00, 0x6f, 0x00, 0x7b, 0x00,
+  0x87, 0x00, 0x90, 0x00, 0x9c, 0x00, 0xab, 0x00, 0xb5, 0x00, 0xc4, 0x00,
+  0xd0, 0x00, 0xdc, 0x00, 0xe8, 0x00, 0xf7, 0x00, 0x06, 0x01, 0x12, 0x01,
+  0x1e, 0x01, 0x2a, 0x01, 0x39, 0x01, 0x48, 0x01, 0x57, 0x01, 0x5e, 0x01,
+  0x65, 0x01, 0x6c, 0x01, 0x73, 0x01, 0x7a, 0x01, 0x81, 0x01, 0x00, 0x00,
+  0x0c, 0x00, 0x22, 0x00, 0x33, 0x00, 0x4b, 0x00, 0x64, 0x00, 0x7c, 0x00,
+  0x86, 0x00, 0x90, 0x00, 0x97, 0x00, 0x9f, 0x00, 0xa7, 0x00, 0xaf, 0x00,
+  0xb8, 0x00, 0xc5, 0x00, 0xce, 0x00, 0xdb, 0x00, 0xe8, 0x00, 0xf5, 0x00,
+  0x02, 0x01, 0x0f, 0x01, 0x1c, 0x01, 0x29, 0x01, 0x36, 0x01, 0x43, 0x01,
+  0x50, 0x01, 0x5d, 0x01, 0x66, 0x01, 0x70, 0x01, 0x79, 0x01, 0x00, 0x00,
+  0x15, 0x00, 0x36, 0x00, 0x58, 0x00, 0x79, 0x00, 0x99, 0x00, 0xb8, 0x00,
+  0xd7, 0x00, 0xf5, 0x00, 0x14, 0x01, 0x32, 0x01, 0x51, 0x01, 0x73, 0x01,
+  0x93, 0x01, 0xb2, 0x01, 0xd4, 0x01, 0xf7, 0x01, 0x19, 0x02, 0x3a, 0x02,
+  0x5a, 0x02, 0x7a, 0x02, 0x99, 0x02, 0xb9, 0x02, 0xd8, 0x02, 0xf8, 0x02,
+  0x1b, 0x03, 0x3c, 0x03, 0x5c, 0x03, 0x6a, 0x03, 0x78, 0x03, 0x8c, 0x03,
+  0xa0, 0x03, 0xb4, 0x03, 0xc7, 0x03, 0xdd, 0x03, 0xf1, 0x03, 0x16, 0x04,
+  0x2c, 0x04, 0x40, 0x04, 0x56, 0x04, 0x6b, 0x04, 0x76, 0x04, 0x80, 0x04,
+  0x8a, 0x04, 0x95, 0x04, 0x9f, 0x04, 0xab, 0x04, 0xb6, 0x04, 0xc1, 0x04,
+  0xcb, 0x04, 0xd6, 0x04, 0xe1, 0x04, 0xec, 0x04, 0xf7, 0x04, 0x00, 0x00,
+  0x0b, 0x00, 0x1c, 0x00, 0x26, 0x00, 0x3d, 0x00, 0x54, 0x00, 0x6a, 0x00,
+  0x81, 0x00, 0x98, 0x00, 0xae, 0x00, 0xc4, 0x00, 0xe2, 0x00, 0x00, 0x01,
+  0x12, 0x01, 0x24, 0x01, 0x3c, 0x01, 0x53, 0x01, 0x6a, 0x01, 0x81, 0x01,
+  0x8f, 0x01, 0x9a, 0x01, 0x00, 0x00, 0x14, 0x00, 0x2e, 0x00, 0x49, 0x00,
+  0x63, 0x00, 0x7c, 0x00, 0x94, 0x00, 0xac, 0x00, 0xc3, 0x00, 0xdb, 0x00,
+  0xf2, 0x00, 0x0a, 0x01, 0x25, 0x01, 0x3e, 0x01, 0x56, 0x01, 0x6b, 0x01,
+  0x7c, 0x01, 0x85, 0x01, 0x8e, 0x01, 0x95, 0x01, 0x9d, 0x01, 0x00, 0x00,
+  0x0d, 0x00, 0x1a, 0x00, 0x22, 0x00, 0x2a, 0x00, 0x32, 0x00, 0x3a, 0x00,
+  0x42, 0x00, 0x4a, 0x00, 0x52, 0x00, 0x5a, 0x00, 0x61, 0x00, 0x68, 0x00,
+  0x6f, 0x00, 0x75, 0x00, 0x7b, 0x00, 0x85, 0x00, 0x00, 0x00, 0x06, 0x00,
+  0x0c, 0x00, 0x12, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1f, 0x00,
+  0x29, 0x00, 0x33, 0x00, 0x3e, 0x00, 0x46, 0x00, 0x51, 0x00, 0x5c, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x1f, 0x00, 0x32, 0x00, 0x45, 0x00, 0x5e, 0x00,
+  0x76, 0x00, 0x8d, 0x00, 0xa4, 0x00, 0xbc, 0x00, 0xd5, 0x00, 0xee, 0x00,
+  0x07, 0x01, 0x1e, 0x01, 0x2a, 0x01, 0x34, 0x01, 0x3e, 0x01, 0x48, 0x01,
+  0x52, 0x01, 0x5e, 0x01, 0x67, 0x01, 0x73, 0x01, 0x7f, 0x01, 0x88, 0x01,
+  0x00, 0x00, 0x17, 0x00, 0x26, 0x00, 0x34, 0x00, 0x4e, 0x00, 0x67, 0x00,
+  0x6f, 0x00, 0x76, 0x00, 0x7c, 0x00, 0x88, 0x00, 0x00, 0x00, 0x18, 0x00,
+  0x30, 0x00, 0x48, 0x00, 0x60, 0x00, 0x78, 0x00, 0x90, 0x00, 0xa7, 0x00,
+  0xbe, 0x00, 0xca, 0x00, 0xd6, 0x00, 0xe2, 0x00, 0xee, 0x00, 0xfa, 0x00,
+  0x06, 0x01, 0x12, 0x01, 0x1e, 0x01, 0x2a, 0x01, 0x36, 0x01, 0x42, 0x01,
+  0x4e, 0x01, 0x5a, 0x01, 0x66, 0x01, 0x72, 0x01, 0x7e, 0x01, 0x8a, 0x01,
+  0x96, 0x01, 0xa2, 0x01, 0xae, 0x01, 0xba, 0x01, 0xc6, 0x01, 0xd2, 0x01,
+  0xde, 0x01, 0xea, 0x01, 0xf6, 0x01, 0x02, 0x02, 0x0e, 0x02, 0x1a, 0x02,
+  0x26, 0x02, 0x32, 0x02, 0x3e, 0x02, 0x4a, 0x02, 0x56, 0x02, 0x62, 0x02,
+  0x6e, 0x02, 0x7a, 0x02, 0x86, 0x02, 0x92, 0x02, 0x9e, 0x02, 0xaa, 0x02,
+  0xb6, 0x02, 0xc2, 0x02, 0xce, 0x02, 0xda, 0x02, 0xe6, 0x02, 0xf2, 0x02,
+  0xfe, 0x02, 0x0a, 0x03, 0x16, 0x03, 0x22, 0x03, 0x2e, 0x03, 0x3a, 0x03,
+  0x46, 0x03, 0x52, 0x03, 0x5e, 0x03, 0x6a, 0x03, 0x76, 0x03, 0x82, 0x03,
+  0x8e, 0x03, 0x9a, 0x03, 0xa6, 0x03, 0xb2, 0x03, 0xbe, 0x03, 0xca, 0x03,
+  0xd6, 0x03, 0xe2, 0x03, 0xee, 0x03, 0xfa, 0x03, 0x06, 0x04, 0x12, 0x04,
+  0x1e, 0x04, 0x2a, 0x04, 0x36, 0x04, 0x42, 0x04, 0x4e, 0x04, 0x5a, 0x04,
+  0x66, 0x04, 0x72, 0x04, 0x7e, 0x04, 0x8a, 0x04, 0x96, 0x04, 0xa2, 0x04,
+  0xae, 0x04, 0xba, 0x04, 0xc6, 0x04, 0xd2, 0x04, 0xde, 0x04, 0xea, 0x04,
+  0xf6, 0x04, 0x02, 0x05, 0x0e, 0x05, 0x1a, 0x05, 0x26, 0x05, 0x32, 0x05,
+  0x3e, 0x05, 0x4a, 0x05, 0x56, 0x05, 0x62, 0x05, 0x6e, 0x05, 0x7a, 0x05,
+  0x86, 0x05, 0x92, 0x05, 0x9e, 0x05, 0xaa, 0x05, 0xb6, 0x05, 0xc2, 0x05,
+  0xce, 0x05, 0xda, 0x05, 0xe6, 0x05, 0xf2, 0x05, 0xfe, 0x05, 0x0a, 0x06,
+  0x16, 0x06, 0x22, 0x06, 0x2e, 0x06, 0x3a, 0x06, 0x46, 0x06, 0x52, 0x06,
+  0x5e, 0x06, 0x6a, 0x06, 0x76, 0x06, 0x82, 0x06, 0x8e, 0x06, 0x9a, 0x06,
+  0xa6, 0x06, 0xb2, 0x06, 0xbe, 0x06, 0xca, 0x06, 0xd6, 0x06, 0xe2, 0x06,
+  0xee, 0x06, 0xfa, 0x06, 0x06, 0x07, 0x12, 0x07, 0x1e, 0x07, 0x2a, 0x07,
+  0x36, 0x07, 0x42, 0x07, 0x4e, 0x07, 0x5a, 0x07, 0x66, 0x07, 0x72, 0x07,
+  0x7e, 0x07, 0x8a, 0x07, 0x96, 0x07, 0xa2, 0x07, 0xae, 0x07, 0xba, 0x07,
+  0xc6, 0x07, 0xd2, 0x07, 0xde, 0x07, 0xea, 0x07, 0xf6, 0x07, 0x02, 0x08,
+  0x0e, 0x08, 0x1a, 0x08, 0x26, 0x08, 0x32, 0x08, 0x3e, 0x08, 0x4a, 0x08,
+  0x56, 0x08, 0x62, 0x08, 0x6e, 0x08, 0x7a, 0x08, 0x86, 0x08, 0x92, 0x08,
+  0x9e, 0x08, 0xaa, 0x08, 0xb6, 0x08, 0xc2, 0x08, 0xce, 0x08, 0xda, 0x08,
+  0xe6, 0x08, 0xf2, 0x08, 0xfe, 0x08, 0x0a, 0x09, 0x16, 0x09, 0x22, 0x09,
+  0x2e, 0x09, 0x3a, 0x09, 0x46, 0x09, 0x52, 0x09, 0x5e, 0x09, 0x6a, 0x09,
+  0x76, 0x09, 0x82, 0x09, 0x8e, 0x09, 0x9a, 0x09, 0xa6, 0x09, 0xb2, 0x09,
+  0xbe, 0x09, 0xca, 0x09, 0xd6, 0x09, 0xe2, 0x09, 0xee, 0x09, 0xfa, 0x09,
+  0x06, 0x0a, 0x12, 0x0a, 0x1e, 0x0a, 0x2a, 0x0a, 0x36, 0x0a, 0x42, 0x0a,
+  0x4e, 0x0a, 0x5a, 0x0a, 0x66, 0x0a, 0x72, 0x0a, 0x7e, 0x0a, 0x8a, 0x0a,
+  0x90, 0x0a, 0x9c, 0x0a, 0xa8, 0x0a, 0x00, 0x00, 0x1c, 0x00, 0x39, 0x00,
+  0x55, 0x00, 0x70, 0x00, 0x8a, 0x00, 0xa4, 0x00, 0xbd, 0x00, 0xd7, 0x00,
+  0xf0, 0x00, 0x0a, 0x01, 0x27, 0x01, 0x42, 0x01, 0x5c, 0x01, 0x67, 0x01,
+  0x77, 0x01, 0x8d, 0x01, 0xa3, 0x01, 0xba, 0x01, 0xd1, 0x01, 0xde, 0x01,
+  0xe6, 0x01, 0xf1, 0x01, 0xfc, 0x01, 0x07, 0x02, 0x00, 0x00, 0x10, 0x00,
+  0x21, 0x00, 0x34, 0x00, 0x45, 0x00, 0x5b, 0x00, 0x70, 0x00, 0x8d, 0x00,
+  0xa8, 0x00, 0xbc, 0x00, 0xcd, 0x00, 0xe2, 0x00, 0xee, 0x00, 0xfa, 0x00,
+  0x03, 0x01, 0x0c, 0x01, 0x15, 0x01, 0x1e, 0x01, 0x28, 0x01, 0x31, 0x01,
+  0x3d, 0x01, 0x46, 0x01, 0x4c, 0x01, 0x00, 0x00, 0x0d, 0x00, 0x1c, 0x00,
+  0x2b, 0x00, 0x3b, 0x00, 0x47, 0x00, 0x53, 0x00, 0x5a, 0x00, 0x61, 0x00,
+  0x6c, 0x00, 0x72, 0x00, 0x78, 0x00, 0x7e, 0x00, 0x86, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x19, 0x00, 0x2b, 0x00, 0x35, 0x00, 0x00, 0x00, 0x13, 0x00,
+  0x22, 0x00, 0x34, 0x00, 0x3c, 0x00, 0x46, 0x00, 0x4f, 0x00, 0x00, 0x00,
+  0x30, 0x00, 0x4a, 0x00, 0x5f, 0x00, 0x7b, 0x00, 0x84, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x25, 0x00, 0x3d, 0x00, 0x54, 0x00, 0x5b, 0x00, 0x66, 0x00,
+  0x71, 0x00, 0x77, 0x00, 0x7d, 0x00, 0x86, 0x00, 0x00, 0x00, 0x0d, 0x00,
+  0x25, 0x00, 0x30, 0x00, 0x37, 0x00, 0x00, 0x00, 0x16, 0x00, 0x25, 0x00,
+  0x3a, 0x00, 0x4f, 0x00, 0x67, 0x00, 0x7d, 0x00, 0x93, 0x00, 0xa9, 0x00,
+  0xbf, 0x00, 0xd4, 0x00, 0xe8, 0x00, 0xfb, 0x00, 0x06, 0x01, 0x12, 0x01,
+  0x1c, 0x01, 0x26, 0x01, 0x32, 0x01, 0x00, 0x00, 0x11, 0x00, 0x27, 0x00,
+  0x2e, 0x00, 0x35, 0x00, 0x3b, 0x00, 0x41, 0x00, 0x00, 0x00, 0x0b, 0x00,
+  0x1e, 0x00, 0x3c, 0x00, 0x43, 0x00, 0x4a, 0x00, 0x50, 0x00, 0x56, 0x00,
+  0x5c, 0x00, 0x6d, 0x00, 0x76, 0x00, 0x7d, 0x00, 0x88, 0x00, 0x96, 0x00,
+  0xa4, 0x00, 0xae, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x1f, 0x00, 0x2d, 0x00,
+  0x3a, 0x00, 0x4c, 0x00, 0x68, 0x00, 0x81, 0x00, 0x90, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x1e, 0x00, 0x29, 0x00, 0x2f, 0x00, 0x35, 0x00, 0x3b, 0x00,
+  0x45, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x4c, 0x00, 0x5d, 0x00, 0x66, 0x00,
+  0x6f, 0x00, 0x78, 0x00, 0x81, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x0b, 0x00,
+  0x16, 0x00, 0x21, 0x00, 0x34, 0x00, 0x4e, 0x00, 0x66, 0x00, 0x6c, 0x00,
+  0x76, 0x00, 0x83, 0x00, 0x90, 0x00, 0x99, 0x00, 0x00, 0x00, 0x0f, 0x00,
+  0x1c, 0x00, 0x33, 0x00, 0x4d, 0x00, 0x66, 0x00, 0x7f, 0x00, 0x8a, 0x00,
+  0x98, 0x00, 0xa3, 0x00, 0xac, 0x00, 0xb5, 0x00, 0x00, 0x00, 0x2e, 0x00,
+  0x38, 0x00, 0x49, 0x00, 0x55, 0x00, 0x5d, 0x00, 0x65, 0x00, 0x70, 0x00,
+  0x76, 0x00, 0x00, 0x00, 0x11, 0x00, 0x27, 0x00, 0x3d, 0x00, 0x53, 0x00,
+  0x69, 0x00, 0x75, 0x00, 0x80, 0x00, 0x8a, 0x00, 0x8f, 0x00, 0x00, 0x00,
+  0x27, 0x00, 0x31, 0x00, 0x42, 0x00, 0x4c, 0x00, 0x56, 0x00, 0x6b, 0x00,
+  0x75, 0x00, 0x80, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x25, 0x00,
+  0x3e, 0x00, 0x5a, 0x00, 0x77, 0x00, 0x93, 0x00, 0xae, 0x00, 0xc8, 0x00,
+  0xe2, 0x00, 0xfb, 0x00, 0x15, 0x01, 0x2e, 0x01, 0x48, 0x01, 0x65, 0x01,
+  0x80, 0x01, 0x9a, 0x01, 0xa8, 0x01, 0xc8, 0x01, 0xe6, 0x01, 0xef, 0x01,
+  0xf9, 0x01, 0x00, 0x02, 0x09, 0x02, 0x12, 0x02, 0x00, 0x00, 0x10, 0x00,
+  0x21, 0x00, 0x2c, 0x00, 0x3f, 0x00, 0x51, 0x00, 0x63, 0x00, 0x71, 0x00,
+  0x79, 0x00, 0x85, 0x00, 0x91, 0x00, 0x9b, 0x00, 0xa5, 0x00, 0xaf, 0x00,
+  0xb9, 0x00, 0xbf, 0x00, 0xcb, 0x00, 0xd2, 0x00, 0xe1, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x24, 0x00, 0x3e, 0x00, 0x58, 0x00, 0x5f, 0x00, 0x66, 0x00,
+  0x6c, 0x00, 0x73, 0x00, 0x7a, 0x00, 0x86, 0x00, 0x8d, 0x00, 0x93, 0x00,
+  0x9a, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1f, 0x00, 0x32, 0x00, 0x47, 0x00,
+  0x5a, 0x00, 0x6d, 0x00, 0x7f, 0x00, 0x95, 0x00, 0xa9, 0x00, 0xb1, 0x00,
+  0xb9, 0x00, 0xc1, 0x00, 0xcb, 0x00, 0xd4, 0x00, 0xdc, 0x00, 0xe4, 0x00,
+  0xec, 0x00, 0xf4, 0x00, 0xfc, 0x00, 0x04, 0x01, 0x0c, 0x01, 0x14, 0x01,
+  0x1c, 0x01, 0x00, 0x00, 0x19, 0x00, 0x24, 0x00, 0x38, 0x00, 0x4c, 0x00,
+  0x5d, 0x00, 0x6e, 0x00, 0x8c, 0x00, 0xa8, 0x00, 0xbc, 0x00, 0xd2, 0x00,
+  0xe6, 0x00, 0xfb, 0x00, 0x12, 0x01, 0x29, 0x01, 0x3e, 0x01, 0x48, 0x01,
+  0x53, 0x01, 0x5e, 0x01, 0x67, 0x01, 0x72, 0x01, 0x79, 0x01, 0x87, 0x01,
+  0x90, 0x01, 0x00, 0x00, 0x1a, 0x00, 0x35, 0x00, 0x4f, 0x00, 0x68, 0x00,
+  0x80, 0x00, 0x98, 0x00, 0xaf, 0x00, 0xc7, 0x00, 0xde, 0x00, 0xf7, 0x00,
+  0x0f, 0x01, 0x2a, 0x01, 0x44, 0x01, 0x5d, 0x01, 0x76, 0x01, 0x8e, 0x01,
+  0x9f, 0x01, 0xb8, 0x01, 0xcf, 0x01, 0xe5, 0x01, 0xec, 0x01, 0xf6, 0x01,
+  0x03, 0x02, 0x0d, 0x02, 0x14, 0x02, 0x00, 0x00, 0x1a, 0x00, 0x33, 0x00,
+  0x3a, 0x00, 0x44, 0x00, 0x4d, 0x00, 0x54, 0x00, 0x5a, 0x00, 0x61, 0x00,
+  0x00, 0x00, 0x0f, 0x00, 0x1a, 0x00, 0x27, 0x00, 0x3a, 0x00, 0x4d, 0x00,
+  0x5f, 0x00, 0x71, 0x00, 0x83, 0x00, 0x8b, 0x00, 0x96, 0x00, 0x9f, 0x00,
+  0xa8, 0x00, 0xb0, 0x00, 0xba, 0x00, 0xc2, 0x00, 0xca, 0x00, 0xd3, 0x00,
+  0xdb, 0x00, 0xe3, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x16, 0x00, 0x1c, 0x00,
+  0x00, 0x00, 0x13, 0x00, 0x22, 0x00, 0x39, 0x00, 0x50, 0x00, 0x66, 0x00,
+  0x71, 0x00, 0x77, 0x00, 0x7d, 0x00, 0x83, 0x00, 0x00, 0x00, 0x26, 0x00,
+  0x31, 0x00, 0x43, 0x00, 0x5b, 0x00, 0x64, 0x00, 0x00, 0x00, 0x22, 0x00,
+  0x35, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x11, 0x00, 0x29, 0x00, 0x42, 0x00,
+  0x5a, 0x00, 0x71, 0x00, 0x8d, 0x00, 0xa3, 0x00, 0xbc, 0x00, 0xd2, 0x00,
+  0xdf, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x17, 0x00, 0x33, 0x00, 0x50, 0x00,
+  0x6c, 0x00, 0x87, 0x00, 0xa1, 0x00, 0xbb, 0x00, 0xd4, 0x00, 0xee, 0x00,
+  0x07, 0x01, 0x21, 0x01, 0x3e, 0x01, 0x59, 0x01, 0x73, 0x01, 0x82, 0x01,
+  0x9a, 0x01, 0xb1, 0x01, 0xc0, 0x01, 0xc9, 0x01, 0xcf, 0x01, 0xd5, 0x01,
+  0xdb, 0x01, 0xe1, 0x01, 0xe7, 0x01, 0xf2, 0x01, 0x00, 0x00, 0x0b, 0x00,
+  0x1d, 0x00, 0x30, 0x00, 0x42, 0x00, 0x57, 0x00, 0x6a, 0x00, 0x7c, 0x00,
+  0x86, 0x00, 0x8f, 0x00, 0x98, 0x00, 0xa1, 0x00, 0xab, 0x00, 0xb5, 0x00,
+  0xbe, 0x00, 0x00, 0x00, 0x13, 0x00, 0x26, 0x00, 0x3c, 0x00, 0x51, 0x00,
+  0x6b, 0x00, 0x84, 0x00, 0x8f, 0x00, 0x9a, 0x00, 0xa3, 0x00, 0xac, 0x00,
+  0xb5, 0x00, 0xbe, 0x00, 0xc7, 0x00, 0xce, 0x00, 0xd8, 0x00, 0xe7, 0x00,
+  0x00, 0x00, 0x0f, 0x00, 0x17, 0x00, 0x20, 0x00, 0x29, 0x00, 0x31, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x20, 0x00, 0x39, 0x00, 0x42, 0x00, 0x52, 0x00,
+  0x00, 0x00, 0x0b, 0x00, 0x1f, 0x00, 0x33, 0x00, 0x46, 0x00, 0x51, 0x00,
+  0x58, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x18, 0x00, 0x31, 0x00, 0x49, 0x00,
+  0x60, 0x00, 0x76, 0x00, 0x8c, 0x00, 0xa1, 0x00, 0xb7, 0x00, 0xcc, 0x00,
+  0xe2, 0x00, 0xfb, 0x00, 0x12, 0x01, 0x28, 0x01, 0x33, 0x01, 0x52, 0x01,
+  0x70, 0x01, 0x7e, 0x01, 0x85, 0x01, 0x8e, 0x01, 0x94, 0x01, 0x9a, 0x01,
+  0xa0, 0x01, 0xa6, 0x01, 0xad, 0x01, 0xb7, 0x01, 0xc7, 0x01, 0x00, 0x00,
+  0x0b, 0x00, 0x16, 0x00, 0x22, 0x00, 0x29, 0x00, 0x30, 0x00, 0x37, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x27, 0x00, 0x3d, 0x00, 0x52, 0x00, 0x65, 0x00,
+  0x7b, 0x00, 0x8f, 0x00, 0x99, 0x00, 0xa3, 0x00, 0xab, 0x00, 0xb4, 0x00,
+  0x00, 0x00, 0x0f, 0x00, 0x24, 0x00, 0x2b, 0x00, 0x34, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x16, 0x00, 0x21, 0x00, 0x2d, 0x00, 0x51, 0x00, 0x77, 0x00,
+  0x81, 0x00, 0x87, 0x00, 0x8e, 0x00, 0x95, 0x00, 0x9c, 0x00, 0xa3, 0x00,
+  0xa9, 0x00, 0xaf, 0x00, 0xb5, 0x00, 0xbb, 0x00, 0xc1, 0x00, 0xc7, 0x00,
+  0xd1, 0x00, 0xe1, 0x00, 0xef, 0x00, 0xfd, 0x00, 0x00, 0x00, 0x14, 0x00,
+  0x22, 0x00, 0x36, 0x00, 0x4c, 0x00, 0x61, 0x00, 0x76, 0x00, 0x82, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x1b, 0x00, 0x2f, 0x00, 0x44, 0x00, 0x59, 0x00,
+  0x68, 0x00, 0x73, 0x00, 0x79, 0x00, 0x80, 0x00, 0x8c, 0x00, 0x98, 0x00,
+  0xa6, 0x00, 0x00, 0x00, 0x12, 0x00, 0x1d, 0x00, 0x2f, 0x00, 0x47, 0x00,
+  0x5f, 0x00, 0x69, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x1e, 0x00, 0x36, 0x00,
+  0x50, 0x00, 0x68, 0x00, 0x72, 0x00, 0x7c, 0x00, 0x86, 0x00, 0x8c, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x1d, 0x00, 0x37, 0x00, 0x41, 0x00,
+  0x4b, 0x00, 0x59, 0x00, 0x67, 0x00, 0x70, 0x00, 0x7b, 0x00, 0x84, 0x00,
+  0x8d, 0x00, 0x96, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x16, 0x00, 0x22, 0x00,
+  0x39, 0x00, 0x44, 0x00, 0x4f, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x0b, 0x00,
+  0x28, 0x00, 0x44, 0x00, 0x5f, 0x00, 0x69, 0x00, 0x72, 0x00, 0x7c, 0x00,
+  0x84, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x18, 0x00, 0x22, 0x00, 0x2c, 0x00,
+  0x36, 0x00, 0x40, 0x00, 0x48, 0x00, 0x00, 0x00, 0x19, 0x00, 0x2a, 0x00,
+  0x3b, 0x00, 0x4d, 0x00, 0x55, 0x00, 0x5e, 0x00, 0x00, 0x00, 0x11, 0x00,
+  0x22, 0x00, 0x32, 0x00, 0x42, 0x00, 0x51, 0x00, 0x63, 0x00, 0x75, 0x00,
+  0x83, 0x00, 0x91, 0x00, 0xa1, 0x00, 0xaf, 0x00, 0xbc, 0x00, 0xc9, 0x00,
+  0xd2, 0x00, 0xdb, 0x00, 0xe2, 0x00, 0xeb, 0x00, 0xf4, 0x00, 0xfc, 0x00,
+  0x05, 0x01, 0x0e, 0x01, 0x17, 0x01, 0x25, 0x01, 0x32, 0x01, 0x00, 0x00,
+  0x0c, 0x00, 0x23, 0x00, 0x3b, 0x00, 0x53, 0x00, 0x6b, 0x00, 0x84, 0x00,
+  0x9e, 0x00, 0xb8, 0x00, 0xc4, 0x00, 0xd0, 0x00, 0xd7, 0x00, 0xe4, 0x00,
+  0xeb, 0x00, 0xf6, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0f, 0x00, 0x1e, 0x00,
+  0x2c, 0x00, 0x3a, 0x00, 0x49, 0x00, 0x58, 0x00, 0x67, 0x00, 0x76, 0x00,
+  0x85, 0x00, 0x95, 0x00, 0xa8, 0x00, 0xbb, 0x00, 0xce, 0x00, 0xea, 0x00,
+  0x06, 0x01, 0x0e, 0x01, 0x16, 0x01, 0x1e, 0x01, 0x28, 0x01, 0x32, 0x01,
+  0x3c, 0x01, 0x46, 0x01, 0x50, 0x01, 0x58, 0x01, 0x60, 0x01, 0x69, 0x01,
+  0x72, 0x01, 0x7a, 0x01, 0x82, 0x01, 0x8a, 0x01, 0x92, 0x01, 0x9a, 0x01,
+  0xa2, 0x01, 0xaa, 0x01, 0xb3, 0x01, 0xbb, 0x01, 0xc4, 0x01, 0xcd, 0x01,
+  0xd5, 0x01, 0xdd, 0x01, 0xe6, 0x01, 0xef, 0x01, 0xf8, 0x01, 0x00, 0x02,
+  0x09, 0x02, 0x12, 0x02, 0x1b, 0x02, 0x23, 0x02, 0x2c, 0x02, 0x36, 0x02,
+  0x40, 0x02, 0x4a, 0x02, 0x54, 0x02, 0x5e, 0x02, 0x67, 0x02, 0x71, 0x02,
+  0x7a, 0x02, 0x82, 0x02, 0x8a, 0x02, 0x92, 0x02, 0x9b, 0x02, 0xa3, 0x02,
+  0x00, 0x00, 0x0b, 0x00, 0x18, 0x00, 0x2f, 0x00, 0x47, 0x00, 0x5b, 0x00,
+  0x79, 0x00, 0x96, 0x00, 0xa0, 0x00, 0xad, 0x00, 0xb3, 0x00, 0xbf, 0x00,
+  0x00, 0x00, 0x0f, 0x00, 0x1f, 0x00, 0x2f, 0x00, 0x45, 0x00, 0x5b, 0x00,
+  0x73, 0x00, 0x89, 0x00, 0x90, 0x00, 0x9b, 0x00, 0xa7, 0x00, 0xb1, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x19, 0x00, 0x20, 0x00, 0x27, 0x00, 0x2e, 0x00,
+  0x36, 0x00, 0x48, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x18, 0x00, 0x26, 0x00,
+  0x38, 0x00, 0x47, 0x00, 0x59, 0x00, 0x6b, 0x00, 0x7d, 0x00, 0x89, 0x00,
+  0x95, 0x00, 0x9d, 0x00, 0xa6, 0x00, 0xaf, 0x00, 0xb7, 0x00, 0xbf, 0x00,
+  0xc8, 0x00, 0xd1, 0x00, 0xd9, 0x00, 0xe3, 0x00, 0xec, 0x00, 0xf5, 0x00,
+  0xfd, 0x00, 0x05, 0x01, 0x0d, 0x01, 0x15, 0x01, 0x1e, 0x01, 0x26, 0x01,
+  0x2e, 0x01, 0x37, 0x01, 0x3f, 0x01, 0x47, 0x01, 0x51, 0x01, 0x00, 0x00,
+  0x16, 0x00, 0x24, 0x00, 0x3b, 0x00, 0x56, 0x00, 0x70, 0x00, 0x79, 0x00,
+  0x82, 0x00, 0x8b, 0x00, 0x94, 0x00, 0x9d, 0x00, 0xa6, 0x00, 0xaf, 0x00,
+  0xb8, 0x00, 0xc1, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x1a, 0x00, 0x33, 0x00,
+  0x4c, 0x00, 0x6c, 0x00, 0x8b, 0x00, 0x9e, 0x00, 0xb0, 0x00, 0xc8, 0x00,
+  0xcf, 0x00, 0xd8, 0x00, 0xdf, 0x00, 0x00, 0x00, 0x10, 0x00, 0x1d, 0x00,
+  0x34, 0x00, 0x4c, 0x00, 0x64, 0x00, 0x7c, 0x00, 0x93, 0x00, 0xac, 0x00,
+  0xc4, 0x00, 0xd4, 0x00, 0xdf, 0x00, 0xec, 0x00, 0xf5, 0x00, 0xfd, 0x00,
+  0x09, 0x01, 0x00, 0x00, 0x14, 0x00, 0x29, 0x00, 0x35, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x2a, 0x00, 0x42, 0x00, 0x5b, 0x00, 0x72, 0x00, 0x8d, 0x00,
+  0x96, 0x00, 0x9f, 0x00, 0xa8, 0x00, 0xb1, 0x00, 0x00, 0x00, 0x0b, 0x00,
+  0x1b, 0x00, 0x2c, 0x00, 0x32, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x13, 0x00,
+  0x26, 0x00, 0x3a, 0x00, 0x50, 0x00, 0x5c, 0x00, 0x68, 0x00, 0x72, 0x00,
+  0x7c, 0x00, 0x83, 0x00, 0x8a, 0x00, 0x91, 0x00, 0x9b, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x1c, 0x00, 0x33, 0x00, 0x45, 0x00, 0x5c, 0x00, 0x72, 0x00,
+  0x85, 0x00, 0x90, 0x00, 0x9b, 0x00, 0xa1, 0x00, 0xa8, 0x00, 0xb1, 0x00,
+  0xba, 0x00, 0xc5, 0x00, 0xcb, 0x00, 0xd4, 0x00, 0xdd, 0x00, 0xe6, 0x00,
+  0xef, 0x00, 0xf5, 0x00, 0xfe, 0x00, 0x08, 0x01, 0x12, 0x01, 0x21, 0x01,
+  0x2d, 0x01, 0x39, 0x01, 0x00, 0x00, 0x11, 0x00, 0x22, 0x00, 0x34, 0x00,
+  0x3b, 0x00, 0x44, 0x00, 0x00, 0x00, 0x10, 0x00, 0x20, 0x00, 0x31, 0x00,
+  0x43, 0x00, 0x4d, 0x00, 0x57, 0x00, 0x60, 0x00, 0x69, 0x00, 0x72, 0x00,
+  0x7b, 0x00, 0x84, 0x00, 0x8d, 0x00, 0x96, 0x00, 0x9f, 0x00, 0x00, 0x00,
+  0x18, 0x00, 0x22, 0x00, 0x30, 0x00, 0x41, 0x00, 0x4b, 0x00, 0x54, 0x00,
+  0x5d, 0x00, 0x66, 0x00, 0x70, 0x00, 0x79, 0x00, 0x83, 0x00, 0x8c, 0x00,
+  0x00, 0x00, 0x15, 0x00, 0x32, 0x00, 0x39, 0x00, 0x3f, 0x00, 0x47, 0x00,
+  0x4e, 0x00, 0x54, 0x00, 0x5a, 0x00, 0x61, 0x00, 0x67, 0x00, 0x6e, 0x00,
+  0x7a, 0x00, 0x00, 0x00, 0x12, 0x00, 0x1c, 0x00, 0x26, 0x00, 0x31, 0x00,
+  0x48, 0x00, 0x61, 0x00, 0x77, 0x00, 0x8b, 0x00, 0x92, 0x00, 0x98, 0x00,
+  0x9e, 0x00, 0xa4, 0x00, 0xaa, 0x00, 0xb0, 0x00, 0xb8, 0x00, 0xbf, 0x00,
+  0xc6, 0x00, 0xce, 0x00, 0xd5, 0x00, 0xdd, 0x00, 0xe4, 0x00, 0xeb, 0x00,
+  0x00, 0x00, 0x1c, 0x00, 0x2f, 0x00, 0x44, 0x00, 0x89, 0x00, 0x93, 0x00,
+  0x9d, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x24, 0x00, 0x35, 0x00, 0x47, 0x00,
+  0x58, 0x00, 0x6a, 0x00, 0x7c, 0x00, 0x8e, 0x00, 0xa0, 0x00, 0xa9, 0x00,
+  0xb2, 0x00, 0xbb, 0x00, 0xc4, 0x00, 0xcd, 0x00, 0xd7, 0x00, 0xe0, 0x00,
+  0xe9, 0x00, 0xf2, 0x00, 0xfc, 0x00, 0x06, 0x01, 0x0f, 0x01, 0x00, 0x00,
+  0x22, 0x00, 0x2c, 0x00, 0x37, 0x00, 0x42, 0x00, 0x5c, 0x00, 0x75, 0x00,
+  0x83, 0x00, 0x8c, 0x00, 0x93, 0x00, 0x9c, 0x00, 0xa3, 0x00, 0xa9, 0x00,
+  0xaf, 0x00, 0xb5, 0x00, 0xbc, 0x00, 0xc3, 0x00, 0x00, 0x00, 0x0a, 0x00,
+  0x17, 0x00, 0x2c, 0x00, 0x35, 0x00, 0x44, 0x00, 0x4e, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x2c, 0x00, 0x45, 0x00, 0x5d, 0x00, 0x74, 0x00, 0x8a, 0x00,
+  0xa0, 0x00, 0xb5, 0x00, 0xcb, 0x00, 0xe0, 0x00, 0xf6, 0x00, 0x0f, 0x01,
+  0x26, 0x01, 0x3c, 0x01, 0x4e, 0x01, 0x65, 0x01, 0x7a, 0x01, 0x8a, 0x01,
+  0x91, 0x01, 0x98, 0x01, 0xa6, 0x01, 0x00, 0x00, 0x12, 0x00, 0x1c, 0x00,
+  0x2d, 0x00, 0x00, 0x00, 0x12, 0x00, 0x20, 0x00, 0x29, 0x00, 0x43, 0x00,
+  0x55, 0x00, 0x5f, 0x00, 0x65, 0x00, 0x6b, 0x00, 0x7d, 0x00, 0x83, 0x00,
+  0x89, 0x00, 0x00, 0x00, 0x21, 0x00, 0x39, 0x00, 0x48, 0x00, 0x57, 0x00,
+  0x70, 0x00, 0x7b, 0x00, 0x84, 0x00, 0x90, 0x00, 0x9a, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x23, 0x00, 0x36, 0x00, 0x49, 0x00, 0x5c, 0x00, 0x68, 0x00,
+  0x6e, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x28, 0x00, 0x44, 0x00, 0x61, 0x00,
+  0x7d, 0x00, 0x98, 0x00, 0xb2, 0x00, 0xcc, 0x00, 0xe5, 0x00, 0xff, 0x00,
+  0x18, 0x01, 0x32, 0x01, 0x4f, 0x01, 0x6a, 0x01, 0x84, 0x01, 0x93, 0x01,
+  0x98, 0x01, 0xa2, 0x01, 0xac, 0x01, 0xb8, 0x01, 0xc2, 0x01, 0x00, 0x00,
+  0x27, 0x00, 0x34, 0x00, 0x41, 0x00, 0x4c, 0x00, 0x55, 0x00, 0x00, 0x00,
+  0x27, 0x00, 0x36, 0x00, 0x44, 0x00, 0x52, 0x00, 0x5b, 0x00, 0x00, 0x00,
+  0x1e, 0x00, 0x30, 0x00, 0x42, 0x00, 0x50, 0x00, 0x62, 0x00, 0x74, 0x00,
+  0x86, 0x00, 0x98, 0x00, 0xa7, 0x00, 0xb6, 0x00, 0xbe, 0x00, 0xc6, 0x00,
+  0xcf, 0x00, 0xd6, 0x00, 0xdc, 0x00, 0xe2, 0x00, 0x00, 0x00, 0x25, 0x00,
+  0x32, 0x00, 0x3f, 0x00, 0x53, 0x00, 0x5a, 0x00, 0x65, 0x00, 0x6c, 0x00,
+  0x73, 0x00, 0x7a, 0x00, 0x81, 0x00, 0x8b, 0x00, 0x93, 0x00, 0x9a, 0x00,
+  0xa1, 0x00, 0xa8, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1e, 0x00, 0x2d, 0x00,
+  0x3c, 0x00, 0x4b, 0x00, 0x5a, 0x00, 0x69, 0x00, 0x7c, 0x00, 0x85, 0x00,
+  0x8d, 0x00, 0x95, 0x00, 0x9d, 0x00, 0xa5, 0x00, 0xad, 0x00, 0xba, 0x00,
+  0xc3, 0x00, 0xd0, 0x00, 0xdd, 0x00, 0xe5, 0x00, 0xed, 0x00, 0xf5, 0x00,
+  0xfc, 0x00, 0x05, 0x01, 0x0e, 0x01, 0x24, 0x01, 0x2e, 0x01, 0x00, 0x00,
+  0x27, 0x00, 0x36, 0x00, 0x4f, 0x00, 0x67, 0x00, 0x70, 0x00, 0x79, 0x00,
+  0x82, 0x00, 0x8b, 0x00, 0x94, 0x00, 0x9d, 0x00, 0xa6, 0x00, 0xaf, 0x00,
+  0xb9, 0x00, 0x00, 0x00, 0x26, 0x00, 0x36, 0x00, 0x45, 0x00, 0x54, 0x00,
+  0x63, 0x00, 0x7b, 0x00, 0x91, 0x00, 0xa4, 0x00, 0xb6, 0x00, 0xce, 0x00,
+  0xe6, 0x00, 0xef, 0x00, 0xf9, 0x00, 0x03, 0x01, 0x0c, 0x01, 0x15, 0x01,
+  0x26, 0x01, 0x32, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x18, 0x00, 0x24, 0x00,
+  0x2e, 0x00, 0x35, 0x00, 0x3c, 0x00, 0x43, 0x00, 0x4a, 0x00, 0x51, 0x00,
+  0x58, 0x00, 0x5e, 0x00, 0x65, 0x00, 0x00, 0x00, 0x10, 0x00, 0x22, 0x00,
+  0x31, 0x00, 0x41, 0x00, 0x49, 0x00, 0x50, 0x00, 0x5d, 0x00, 0x65, 0x00,
+  0x6d, 0x00, 0x75, 0x00, 0x7d, 0x00, 0x88, 0x00, 0x90, 0x00, 0x98, 0x00,
+  0xa0, 0x00, 0xa8, 0x00, 0xb0, 0x00, 0xb8, 0x00, 0xbe, 0x00, 0xc4, 0x00,
+  0x00, 0x00, 0x14, 0x00, 0x27, 0x00, 0x41, 0x00, 0x4a, 0x00, 0x54, 0x00,
+  0x5d, 0x00, 0x66, 0x00, 0x6f, 0x00, 0x78, 0x00, 0x00, 0x00, 0x11, 0x00,
+  0x25, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x1a, 0x00, 0x27, 0x00, 0x37, 0x00,
+  0x44, 0x00, 0x51, 0x00, 0x5e, 0x00, 0x6b, 0x00, 0x78, 0x00, 0x85, 0x00,
+  0x92, 0x00, 0x9f, 0x00, 0xa9, 0x00, 0xb2, 0x00, 0x00, 0x00, 0x13, 0x00,
+  0x20, 0x00, 0x27, 0x00, 0x00, 0x00, 0x13, 0x00, 0x1f, 0x00, 0x2e, 0x00,
+  0x43, 0x00, 0x51, 0x00, 0x5f, 0x00, 0x71, 0x00, 0x7f, 0x00, 0x89, 0x00,
+  0x93, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x1c, 0x00, 0x28, 0x00, 0x34, 0x00,
+  0x3b, 0x00, 0x45, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x17, 0x00, 0x2d, 0x00,
+  0x50, 0x00, 0x71, 0x00, 0x8b, 0x00, 0xa4, 0x00, 0xb4, 0x00, 0xbc, 0x00,
+  0xc4, 0x00, 0xcc, 0x00, 0xd4, 0x00, 0xde, 0x00, 0xe5, 0x00, 0xee, 0x00,
+  0x00, 0x00, 0x17, 0x00, 0x2e, 0x00, 0x45, 0x00, 0x5b, 0x00, 0x6f, 0x00,
+  0x80, 0x00, 0x91, 0x00, 0xa2, 0x00, 0xad, 0x00, 0xb8, 0x00, 0xc3, 0x00,
+  0xce, 0x00, 0xd8, 0x00, 0xe2, 0x00, 0xed, 0x00, 0xf3, 0x00, 0xfe, 0x00,
+  0x09, 0x01, 0x15, 0x01, 0x20, 0x01, 0x2b, 0x01, 0x36, 0x01, 0x41, 0x01,
+  0x4f, 0x01, 0x00, 0x00, 0x11, 0x00, 0x22, 0x00, 0x31, 0x00, 0x48, 0x00,
+  0x60, 0x00, 0x78, 0x00, 0x90, 0x00, 0xa4, 0x00, 0xb6, 0x00, 0xcc, 0x00,
+  0xe0, 0x00, 0xfb, 0x00, 0x14, 0x01, 0x1e, 0x01, 0x25, 0x01, 0x2e, 0x01,
+  0x35, 0x01, 0x3c, 0x01, 0x43, 0x01, 0x4d, 0x01, 0x56, 0x01, 0x64, 0x01,
+  0x6d, 0x01, 0x00, 0x00, 0x11, 0x00, 0x1b, 0x00, 0x2c, 0x00, 0x37, 0x00,
+  0x48, 0x00, 0x5a, 0x00, 0x6b, 0x00, 0x7c, 0x00, 0x8e, 0x00, 0xa0, 0x00,
+  0xb2, 0x00, 0xc6, 0x00, 0xdd, 0x00, 0xf2, 0x00, 0x0b, 0x01, 0x14, 0x01,
+  0x20, 0x01, 0x28, 0x01, 0x31, 0x01, 0x3a, 0x01, 0x43, 0x01, 0x4c, 0x01,
+  0x55, 0x01, 0x5e, 0x01, 0x66, 0x01, 0x00, 0x00, 0x10, 0x00, 0x1d, 0x00,
+  0x2e, 0x00, 0x4a, 0x00, 0x66, 0x00, 0x6f, 0x00, 0x78, 0x00, 0x81, 0x00,
+  0x8b, 0x00, 0x94, 0x00, 0x9d, 0x00, 0xa7, 0x00, 0xb1, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x1d, 0x00, 0x27, 0x00, 0x30, 0x00, 0x36, 0x00, 0x3f, 0x00,
+  0x48, 0x00, 0x51, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x1e, 0x00,
+  0x31, 0x00, 0x44, 0x00, 0x5c, 0x00, 0x72, 0x00, 0x7e, 0x00, 0x84, 0x00,
+  0x8b, 0x00, 0x96, 0x00, 0xa1, 0x00, 0xac, 0x00, 0xb2, 0x00, 0xbd, 0x00,
+  0xc4, 0x00, 0xca, 0x00, 0xd1, 0x00, 0xd9, 0x00, 0xe0, 0x00, 0xe6, 0x00,
+  0xed, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x16, 0x00, 0x2e, 0x00, 0x43, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x21, 0x00, 0x32, 0x00, 0x43, 0x00, 0x55, 0x00,
+  0x67, 0x00, 0x79, 0x00, 0x8a, 0x00, 0x9c, 0x00, 0xae, 0x00, 0xc0, 0x00,
+  0xd2, 0x00, 0xe4, 0x00, 0xfc, 0x00, 0x13, 0x01, 0x2d, 0x01, 0x45, 0x01,
+  0x52, 0x01, 0x5f, 0x01, 0x68, 0x01, 0x71, 0x01, 0x7d, 0x01, 0x8c, 0x01,
+  0x96, 0x01, 0x9f, 0x01, 0xa8, 0x01, 0xb1, 0x01, 0xba, 0x01, 0xc3, 0x01,
+  0xcc, 0x01, 0xd5, 0x01, 0xde, 0x01, 0xe8, 0x01, 0xf2, 0x01, 0xfc, 0x01,
+  0x06, 0x02, 0x0f, 0x02, 0x00, 0x00, 0x12, 0x00, 0x1d, 0x00, 0x29, 0x00,
+  0x37, 0x00, 0x43, 0x00, 0x51, 0x00, 0x5a, 0x00, 0x60, 0x00, 0x66, 0x00,
+  0x6c, 0x00, 0x72, 0x00, 0x78, 0x00, 0x7f, 0x00, 0x88, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x1d, 0x00, 0x31, 0x00, 0x46, 0x00, 0x57, 0x00, 0x66, 0x00,
+  0x75, 0x00, 0x84, 0x00, 0x93, 0x00, 0x9c, 0x00, 0xa7, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x1f, 0x00, 0x35, 0x00, 0x45, 0x00, 0x55, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x1c, 0x00, 0x33, 0x00, 0x42, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x24, 0x00, 0x3d, 0x00, 0x55, 0x00, 0x6c, 0x00, 0x82, 0x00, 0x98, 0x00,
+  0xad, 0x00, 0xc3, 0x00, 0xd8, 0x00, 0xee, 0x00, 0x07, 0x01, 0x1e, 0x01,
+  0x34, 0x01, 0x42, 0x01, 0x5b, 0x01, 0x73, 0x01, 0x81, 0x01, 0x8d, 0x01,
+  0x93, 0x01, 0x99, 0x01, 0x9f, 0x01, 0x00, 0x00, 0x0f, 0x00, 0x1d, 0x00,
+  0x2c, 0x00, 0x3b, 0x00, 0x4a, 0x00, 0x59, 0x00, 0x68, 0x00, 0x77, 0x00,
+  0x86, 0x00, 0x8f, 0x00, 0x98, 0x00, 0xa3, 0x00, 0xab, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x1e, 0x00, 0x24, 0x00, 0x2d, 0x00, 0x37, 0x00,
+  0x3d, 0x00, 0x43, 0x00, 0x50, 0x00, 0x5d, 0x00, 0x6a, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x27, 0x00, 0x40, 0x00, 0x46, 0x00, 0x54, 0x00, 0x61, 0x00,
+  0x00, 0x00, 0x0f, 0x00, 0x1f, 0x00, 0x37, 0x00, 0x50, 0x00, 0x68, 0x00,
+  0x7f, 0x00, 0x95, 0x00, 0xab, 0x00, 0xc0, 0x00, 0xd6, 0x00, 0xeb, 0x00,
+  0x01, 0x01, 0x1a, 0x01, 0x31, 0x01, 0x47, 0x01, 0x56, 0x01, 0x5c, 0x01,
+  0x66, 0x01, 0x70, 0x01, 0x7a, 0x01, 0x82, 0x01, 0x8a, 0x01, 0x99, 0x01,
+  0x00, 0x00, 0x13, 0x00, 0x26, 0x00, 0x39, 0x00, 0x42, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x1e, 0x00, 0x26, 0x00, 0x33, 0x00, 0x3b, 0x00, 0x47, 0x00,
+  0x4e, 0x00, 0x55, 0x00, 0x5c, 0x00, 0x63, 0x00, 0x6b, 0x00, 0x72, 0x00,
+  0x00, 0x00, 0x11, 0x00, 0x23, 0x00, 0x2f, 0x00, 0x3a, 0x00, 0x41, 0x00,
+  0x49, 0x00, 0x51, 0x00, 0x58, 0x00, 0x5f, 0x00, 0x66, 0x00, 0x76, 0x00,
+  0x80, 0x00, 0x8a, 0x00, 0x94, 0x00, 0x9e, 0x00, 0xa8, 0x00, 0xb8, 0x00,
+  0xc5, 0x00, 0xd5, 0x00, 0xdd, 0x00, 0xe4, 0x00, 0xee, 0x00, 0xf6, 0x00,
+  0x00, 0x00, 0x11, 0x00, 0x21, 0x00, 0x31, 0x00, 0x41, 0x00, 0x52, 0x00,
+  0x63, 0x00, 0x74, 0x00, 0x88, 0x00, 0x91, 0x00, 0x9a, 0x00, 0xa3, 0x00,
+  0xac, 0x00, 0xb5, 0x00, 0xbe, 0x00, 0xc7, 0x00, 0xd0, 0x00, 0xd9, 0x00,
+  0xe2, 0x00, 0xeb, 0x00, 0xf4, 0x00, 0xfd, 0x00, 0x07, 0x01, 0x10, 0x01,
+  0x19, 0x01, 0x22, 0x01, 0x2b, 0x01, 0x34, 0x01, 0x3d, 0x01, 0x46, 0x01,
+  0x4f, 0x01, 0x58, 0x01, 0x61, 0x01, 0x6d, 0x01, 0x76, 0x01, 0x7f, 0x01,
+  0x88, 0x01, 0x91, 0x01, 0x9a, 0x01, 0xa3, 0x01, 0xac, 0x01, 0xb5, 0x01,
+  0xbf, 0x01, 0xc8, 0x01, 0xd1, 0x01, 0xdb, 0x01, 0xe4, 0x01, 0xed, 0x01,
+  0xf6, 0x01, 0xff, 0x01, 0x00, 0x00, 0x12, 0x00, 0x23, 0x00, 0x32, 0x00,
+  0x41, 0x00, 0x52, 0x00, 0x63, 0x00, 0x70, 0x00, 0x83, 0x00, 0x94, 0x00,
+  0xa6, 0x00, 0xb7, 0x00, 0xc9, 0x00, 0xda, 0x00, 0xe3, 0x00, 0xec, 0x00,
+  0xf5, 0x00, 0xfe, 0x00, 0x07, 0x01, 0x10, 0x01, 0x1a, 0x01, 0x24, 0x01,
+  0x2e, 0x01, 0x38, 0x01, 0x42, 0x01, 0x4c, 0x01, 0x56, 0x01, 0x60, 0x01,
+  0x6a, 0x01, 0x71, 0x01, 0x78, 0x01, 0x81, 0x01, 0x8a, 0x01, 0x93, 0x01,
+  0x9c, 0x01, 0xa5, 0x01, 0xb2, 0x01, 0xbb, 0x01, 0x00, 0x00, 0x14, 0x00,
+  0x29, 0x00, 0x35, 0x00, 0x3f, 0x00, 0x46, 0x00, 0x4e, 0x00, 0x58, 0x00,
+  0x62, 0x00, 0x69, 0x00, 0x73, 0x00, 0x7a, 0x00, 0x81, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x25, 0x00, 0x3c, 0x00, 0x52, 0x00, 0x59, 0x00, 0x61, 0x00,
+  0x69, 0x00, 0x71, 0x00, 0x79, 0x00, 0x80, 0x00, 0x87, 0x00, 0x90, 0x00,
+  0x9b, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x1e, 0x00, 0x2c, 0x00,
+  0x41, 0x00, 0x55, 0x00, 0x6c, 0x00, 0x83, 0x00, 0x8c, 0x00, 0x96, 0x00,
+  0x9f, 0x00, 0xa8, 0x00, 0xb3, 0x00, 0xbe, 0x00, 0xce, 0x00, 0xdd, 0x00,
+  0xec, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x1a, 0x00, 0x32, 0x00, 0x4b, 0x00,
+  0x63, 0x00, 0x7a, 0x00, 0x90, 0x00, 0xa6, 0x00, 0xbb, 0x00, 0xd1, 0x00,
+  0xe6, 0x00, 0xfc, 0x00, 0x15, 0x01, 0x2c, 0x01, 0x42, 0x01, 0x57, 0x01,
+  0x6c, 0x01, 0x75, 0x01, 0x7e, 0x01, 0x87, 0x01, 0x91, 0x01, 0x9b, 0x01,
+  0xa5, 0x01, 0xaf, 0x01, 0xb9, 0x01, 0xc1, 0x01, 0xc9, 0x01, 0xcf, 0x01,
+  0xdd, 0x01, 0x00, 0x00, 0x0f, 0x00, 0x1b, 0x00, 0x2b, 0x00, 0x3b, 0x00,
+  0x45, 0x00, 0x4f, 0x00, 0x59, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x27, 0x00,
+  0x34, 0x00, 0x45, 0x00, 0x4e, 0x00, 0x57, 0x00, 0x61, 0x00, 0x6c, 0x00,
+  0x75, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1f, 0x00, 0x2d, 0x00, 0x3b, 0x00,
+  0x45, 0x00, 0x4f, 0x00, 0x58, 0x00, 0x62, 0x00, 0x6c, 0x00, 0x74, 0x00,
+  0x7e, 0x00, 0x88, 0x00, 0x90, 0x00, 0x9d, 0x00, 0xaa, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x2b, 0x00, 0x42, 0x00, 0x5a, 0x00, 0x72, 0x00, 0x7f, 0x00,
+  0x8d, 0x00, 0x96, 0x00, 0x9f, 0x00, 0xa8, 0x00, 0xb1, 0x00, 0xc0, 0x00,
+  0xce, 0x00, 0x00, 0x00, 0x21, 0x00, 0x39, 0x00, 0x51, 0x00, 0x68, 0x00,
+  0x80, 0x00, 0x98, 0x00, 0xa8, 0x00, 0xbf, 0x00, 0xcb, 0x00, 0xd6, 0x00,
+  0xe1, 0x00, 0xeb, 0x00, 0xf5, 0x00, 0xfd, 0x00, 0x00, 0x00, 0x1b, 0x00,
+  0x35, 0x00, 0x4c, 0x00, 0x62, 0x00, 0x78, 0x00, 0x90, 0x00, 0xa6, 0x00,
+  0xbc, 0x00, 0xd2, 0x00, 0xea, 0x00, 0x00, 0x01, 0x16, 0x01, 0x24, 0x01,
+  0x2f, 0x01, 0x3d, 0x01, 0x4b, 0x01, 0x59, 0x01, 0x67, 0x01, 0x75, 0x01,
+  0x80, 0x01, 0x8b, 0x01, 0x96, 0x01, 0xa1, 0x01, 0xac, 0x01, 0xb7, 0x01,
+  0xc2, 0x01, 0xcd, 0x01, 0xd8, 0x01, 0xe3, 0x01, 0xed, 0x01, 0xf7, 0x01,
+  0x02, 0x02, 0x0d, 0x02, 0x18, 0x02, 0x23, 0x02, 0x2e, 0x02, 0x3a, 0x02,
+  0x46, 0x02, 0x00, 0x00, 0x20, 0x00, 0x2f, 0x00, 0x3c, 0x00, 0x48, 0x00,
+  0x55, 0x00, 0x62, 0x00, 0x6f, 0x00, 0x80, 0x00, 0x95, 0x00, 0xaa, 0x00,
+  0xbd, 0x00, 0xd1, 0x00, 0xe4, 0x00, 0xfb, 0x00, 0x04, 0x01, 0x0d, 0x01,
+  0x1b, 0x01, 0x22, 0x01, 0x29, 0x01, 0x37, 0x01, 0x4a, 0x01, 0x00, 0x00,
+  0x21, 0x00, 0x3d, 0x00, 0x52, 0x00, 0x68, 0x00, 0x7d, 0x00, 0x86, 0x00,
+  0x90, 0x00, 0x98, 0x00, 0x00, 0x00, 0x11, 0x00, 0x19, 0x00, 0x23, 0x00,
+  0x30, 0x00, 0x3a, 0x00, 0x47, 0x00, 0x54, 0x00, 0x61, 0x00, 0x6b, 0x00,
+  0x78, 0x00, 0x81, 0x00, 0x8a, 0x00, 0x93, 0x00, 0x9c, 0x00, 0xa5, 0x00,
+  0xae, 0x00, 0xb7, 0x00, 0xc1, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x17, 0x00,
+  0x23, 0x00, 0x2f, 0x00, 0x3b, 0x00, 0x47, 0x00, 0x53, 0x00, 0x5f, 0x00,
+  0x6b, 0x00, 0x77, 0x00, 0x83, 0x00, 0x8f, 0x00, 0x9b, 0x00, 0xa7, 0x00,
+  0xb3, 0x00, 0xbf, 0x00, 0xcb, 0x00, 0xd7, 0x00, 0xe3, 0x00, 0xef, 0x00,
+  0xfb, 0x00, 0x07, 0x01, 0x13, 0x01, 0x1f, 0x01, 0x2b, 0x01, 0x37, 0x01,
+  0x43, 0x01, 0x4f, 0x01, 0x5b, 0x01, 0x67, 0x01, 0x73, 0x01, 0x7f, 0x01,
+  0x8b, 0x01, 0x97, 0x01, 0xa3, 0x01, 0xaf, 0x01, 0xbb, 0x01, 0xc7, 0x01,
+  0xd3, 0x01, 0x00, 0x00, 0x1b, 0x00, 0x28, 0x00, 0x35, 0x00, 0x4d, 0x00,
+  0x62, 0x00, 0x7a, 0x00, 0x90, 0x00, 0xa8, 0x00, 0xbd, 0x00, 0xd5, 0x00,
+  0xeb, 0x00, 0xf6, 0x00, 0x01, 0x01, 0x0d, 0x01, 0x16, 0x01, 0x1d, 0x01,
+  0x29, 0x01, 0x30, 0x01, 0x38, 0x01, 0x00, 0x00, 0x11, 0x00, 0x1c, 0x00,
+  0x34, 0x00, 0x4c, 0x00, 0x65, 0x00, 0x7e, 0x00, 0x95, 0x00, 0xab, 0x00,
+  0xb7, 0x00, 0xc3, 0x00, 0xcc, 0x00, 0xd8, 0x00, 0xe1, 0x00, 0xea, 0x00,
+  0xf3, 0x00, 0xfc, 0x00, 0x05, 0x01, 0x0e, 0x01, 0x17, 0x01, 0x23, 0x01,
+  0x2c, 0x01, 0x33, 0x01, 0x39, 0x01, 0x00, 0x00, 0x1c, 0x00, 0x2f, 0x00,
+  0x43, 0x00, 0x5a, 0x00, 0x6f, 0x00, 0x7e, 0x00, 0x89, 0x00, 0x94, 0x00,
+  0x9f, 0x00, 0xac, 0x00, 0xb7, 0x00, 0xc2, 0x00, 0xcf, 0x00, 0xda, 0x00,
+  0xe5, 0x00, 0xf0, 0x00, 0xfb, 0x00, 0x06, 0x01, 0x11, 0x01, 0x1c, 0x01,
+  0x27, 0x01, 0x32, 0x01, 0x41, 0x01, 0x4c, 0x01, 0x5b, 0x01, 0x66, 0x01,
+  0x71, 0x01, 0x7c, 0x01, 0x87, 0x01, 0x92, 0x01, 0x9d, 0x01, 0xa8, 0x01,
+  0xb3, 0x01, 0xbe, 0x01, 0xc9, 0x01, 0xd4, 0x01, 0xdf, 0x01, 0xea, 0x01,
+  0xf5, 0x01, 0x00, 0x02, 0x0b, 0x02, 0x12, 0x02, 0x22, 0x02, 0x32, 0x02,
+  0x00, 0x00, 0x16, 0x00, 0x22, 0x00, 0x35, 0x00, 0x48, 0x00, 0x5a, 0x00,
+  0x70, 0x00, 0x84, 0x00, 0x96, 0x00, 0xa9, 0x00, 0xc1, 0x00, 0xd7, 0x00,
+  0xef, 0x00, 0x06, 0x01, 0x12, 0x01, 0x1e, 0x01, 0x2a, 0x01, 0x36, 0x01,
+  0x42, 0x01, 0x4e, 0x01, 0x5a, 0x01, 0x68, 0x01, 0x74, 0x01, 0x80, 0x01,
+  0x8c, 0x01, 0x95, 0x01, 0xa1, 0x01, 0xad, 0x01, 0xb9, 0x01, 0xc5, 0x01,
+  0xd1, 0x01, 0xdd, 0x01, 0xe9, 0x01, 0xf5, 0x01, 0x01, 0x02, 0x0d, 0x02,
+  0x19, 0x02, 0x25, 0x02, 0x31, 0x02, 0x3d, 0x02, 0x49, 0x02, 0x55, 0x02,
+  0x61, 0x02, 0x6d, 0x02, 0x79, 0x02, 0x85, 0x02, 0x91, 0x02, 0x9d, 0x02,
+  0xa9, 0x02, 0xb2, 0x02, 0xbb, 0x02, 0xc4, 0x02, 0xca, 0x02, 0xdb, 0x02,
+  0x00, 0x00, 0x0e, 0x00, 0x27, 0x00, 0x40, 0x00, 0x5a, 0x00, 0x69, 0x00,
+  0x72, 0x00, 0x7d, 0x00, 0x8d, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x1a, 0x00,
+  0x29, 0x00, 0x39, 0x00, 0x43, 0x00, 0x4d, 0x00, 0x57, 0x00, 0x61, 0x00,
+  0x6c, 0x00, 0x73, 0x00, 0x7d, 0x00, 0x83, 0x00, 0x89, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x20, 0x00, 0x2f, 0x00, 0x3e, 0x00, 0x4d, 0x00, 0x5c, 0x00,
+  0x6b, 0x00, 0x7a, 0x00, 0x84, 0x00, 0x8e, 0x00, 0x99, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x1c, 0x00, 0x22, 0x00, 0x2f, 0x00, 0x3b, 0x00, 0x46, 0x00,
+  0x4c, 0x00, 0x52, 0x00, 0x58, 0x00, 0x5e, 0x00, 0x64, 0x00, 0x6a, 0x00,
+  0x79, 0x00, 0x8b, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x29, 0x00, 0x38, 0x00,
+  0x49, 0x00, 0x59, 0x00, 0x7a, 0x00, 0x90, 0x00, 0x9a, 0x00, 0xa3, 0x00,
+  0xab, 0x00, 0xb2, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x36, 0x00, 0x51, 0x00,
+  0x6f, 0x00, 0x8e, 0x00, 0xac, 0x00, 0xc9, 0x00, 0xe5, 0x00, 0x01, 0x01,
+  0x1c, 0x01, 0x38, 0x01, 0x53, 0x01, 0x6f, 0x01, 0x8e, 0x01, 0xab, 0x01,
+  0xba, 0x01, 0xcd, 0x01, 0xd5, 0x01, 0x00, 0x00, 0x17, 0x00, 0x2e, 0x00,
+  0x43, 0x00, 0x4b, 0x00, 0x53, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x27, 0x00,
+  0x3d, 0x00, 0x5b, 0x00, 0x69, 0x00, 0x72, 0x00, 0x7b, 0x00, 0x86, 0x00,
+  0x8f, 0x00, 0x00, 0x00, 0x15, 0x00, 0x29, 0x00, 0x2f, 0x00, 0x3b, 0x00,
+  0x45, 0x00, 0x4b, 0x00, 0x55, 0x00, 0x5f, 0x00, 0x6e, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x15, 0x00, 0x1b, 0x00, 0x25, 0x00, 0x2c, 0x00, 0x32, 0x00,
+  0x3e, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x18, 0x00, 0x22, 0x00, 0x29, 0x00,
+  0x33, 0x00, 0x3d, 0x00, 0x47, 0x00, 0x50, 0x00, 0x57, 0x00, 0x5e, 0x00,
+  0x65, 0x00, 0x00, 0x00, 0x14, 0x00, 0x20, 0x00, 0x34, 0x00, 0x48, 0x00,
+  0x53, 0x00, 0x5b, 0x00, 0x62, 0x00, 0x69, 0x00, 0x7b, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x1d, 0x00, 0x28, 0x00, 0x33, 0x00, 0x41, 0x00, 0x49, 0x00,
+  0x59, 0x00, 0x69, 0x00, 0x7a, 0x00, 0x8a, 0x00, 0x9e, 0x00, 0xae, 0x00,
+  0xbd, 0x00, 0xc6, 0x00, 0xcf, 0x00, 0xd8, 0x00, 0xe1, 0x00, 0xea, 0x00,
+  0xf3, 0x00, 0xfc, 0x00, 0x05, 0x01, 0x11, 0x01, 0x1a, 0x01, 0x23, 0x01,
+  0x2c, 0x01, 0x34, 0x01, 0x43, 0x01, 0x4f, 0x01, 0x58, 0x01, 0x60, 0x01,
+  0x6b, 0x01, 0x74, 0x01, 0x7d, 0x01, 0x86, 0x01, 0x8c, 0x01, 0x92, 0x01,
+  0x9c, 0x01, 0xa5, 0x01, 0xb0, 0x01, 0x00, 0x00, 0x0d, 0x00, 0x19, 0x00,
+  0x28, 0x00, 0x37, 0x00, 0x46, 0x00, 0x57, 0x00, 0x68, 0x00, 0x7a, 0x00,
+  0x8f, 0x00, 0xa2, 0x00, 0xb3, 0x00, 0xc7, 0x00, 0xd3, 0x00, 0xdc, 0x00,
+  0xe5, 0x00, 0xef, 0x00, 0xf9, 0x00, 0x03, 0x01, 0x0d, 0x01, 0x17, 0x01,
+  0x20, 0x01, 0x29, 0x01, 0x32, 0x01, 0x3f, 0x01, 0x4c, 0x01, 0x59, 0x01,
+  0x00, 0x00, 0x12, 0x00, 0x1f, 0x00, 0x2d, 0x00, 0x41, 0x00, 0x4b, 0x00,
+  0x55, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x3f, 0x00, 0x5e, 0x00,
+  0x7c, 0x00, 0x99, 0x00, 0xb6, 0x00, 0xd2, 0x00, 0xef, 0x00, 0x0b, 0x01,
+  0x28, 0x01, 0x48, 0x01, 0x66, 0x01, 0x83, 0x01, 0x99, 0x01, 0xab, 0x01,
+  0xbc, 0x01, 0xc3, 0x01, 0xcc, 0x01, 0xd4, 0x01, 0xdc, 0x01, 0xe4, 0x01,
+  0xf1, 0x01, 0x00, 0x00, 0x0d, 0x00, 0x1c, 0x00, 0x3a, 0x00, 0x59, 0x00,
+  0x77, 0x00, 0x94, 0x00, 0xb0, 0x00, 0xcc, 0x00, 0xe7, 0x00, 0x03, 0x01,
+  0x1e, 0x01, 0x3a, 0x01, 0x59, 0x01, 0x76, 0x01, 0x92, 0x01, 0xa1, 0x01,
+  0xb2, 0x01, 0xc5, 0x01, 0xce, 0x01, 0xd7, 0x01, 0xe0, 0x01, 0xec, 0x01,
+  0xf4, 0x01, 0xfd, 0x01, 0x00, 0x00, 0x15, 0x00, 0x2a, 0x00, 0x36, 0x00,
+  0x42, 0x00, 0x4e, 0x00, 0x5a, 0x00, 0x66, 0x00, 0x72, 0x00, 0x7e, 0x00,
+  0x8a, 0x00, 0x96, 0x00, 0xa2, 0x00, 0xae, 0x00, 0xba, 0x00, 0xc6, 0x00,
+  0xd2, 0x00, 0xde, 0x00, 0xea, 0x00, 0xf6, 0x00, 0x02, 0x01, 0x0e, 0x01,
+  0x1a, 0x01, 0x26, 0x01, 0x32, 0x01, 0x3e, 0x01, 0x4a, 0x01, 0x56, 0x01,
+  0x62, 0x01, 0x6e, 0x01, 0x7a, 0x01, 0x86, 0x01, 0x92, 0x01, 0x9e, 0x01,
+  0xaa, 0x01, 0xb6, 0x01, 0xc2, 0x01, 0xce, 0x01, 0xda, 0x01, 0xe6, 0x01,
+  0xf2, 0x01, 0xfe, 0x01, 0x0a, 0x02, 0x16, 0x02, 0x22, 0x02, 0x2e, 0x02,
+  0x3a, 0x02, 0x46, 0x02, 0x52, 0x02, 0x5e, 0x02, 0x6a, 0x02, 0x76, 0x02,
+  0x82, 0x02, 0x8e, 0x02, 0x9a, 0x02, 0xa6, 0x02, 0xb2, 0x02, 0xbe, 0x02,
+  0xca, 0x02, 0xd6, 0x02, 0xe2, 0x02, 0xee, 0x02, 0xfa, 0x02, 0x06, 0x03,
+  0x12, 0x03, 0x1e, 0x03, 0x2a, 0x03, 0x36, 0x03, 0x42, 0x03, 0x4e, 0x03,
+  0x5a, 0x03, 0x66, 0x03, 0x72, 0x03, 0x7e, 0x03, 0x8a, 0x03, 0x96, 0x03,
+  0xa2, 0x03, 0xae, 0x03, 0xba, 0x03, 0xc6, 0x03, 0xd2, 0x03, 0xde, 0x03,
+  0xea, 0x03, 0xf6, 0x03, 0x02, 0x04, 0x0e, 0x04, 0x1a, 0x04, 0x26, 0x04,
+  0x32, 0x04, 0x3e, 0x04, 0x4a, 0x04, 0x56, 0x04, 0x62, 0x04, 0x6e, 0x04,
+  0x7a, 0x04, 0x86, 0x04, 0x92, 0x04, 0x9e, 0x04, 0xaa, 0x04, 0xb6, 0x04,
+  0xc2, 0x04, 0xce, 0x04, 0xda, 0x04, 0xe6, 0x04, 0x00, 0x00, 0x14, 0x00,
+  0x28, 0x00, 0x3a, 0x00, 0x4f, 0x00, 0x62, 0x00, 0x7d, 0x00, 0x8a, 0x00,
+  0x97, 0x00, 0xa4, 0x00, 0xb1, 0x00, 0xbe, 0x00, 0xcb, 0x00, 0xd8, 0x00,
+  0xe5, 0x00, 0xf2, 0x00, 0xff, 0x00, 0x0c, 0x01, 0x19, 0x01, 0x26, 0x01,
+  0x33, 0x01, 0x40, 0x01, 0x4d, 0x01, 0x5a, 0x01, 0x67, 0x01, 0x74, 0x01,
+  0x81, 0x01, 0x8e, 0x01, 0x9b, 0x01, 0xa8, 0x01, 0xb5, 0x01, 0xc2, 0x01,
+  0xcf, 0x01, 0xdc, 0x01, 0xe9, 0x01, 0xf6, 0x01, 0x03, 0x02, 0x10, 0x02,
+  0x1d, 0x02, 0x2a, 0x02, 0x37, 0x02, 0x44, 0x02, 0x51, 0x02, 0x5e, 0x02,
+  0x6b, 0x02, 0x78, 0x02, 0x85, 0x02, 0x92, 0x02, 0x9f, 0x02, 0xac, 0x02,
+  0xb9, 0x02, 0xc6, 0x02, 0xd3, 0x02, 0xe0, 0x02, 0xed, 0x02, 0xfa, 0x02,
+  0x07, 0x03, 0x14, 0x03, 0x21, 0x03, 0x2e, 0x03, 0x3b, 0x03, 0x48, 0x03,
+  0x55, 0x03, 0x62, 0x03, 0x6f, 0x03, 0x7c, 0x03, 0x89, 0x03, 0x96, 0x03,
+  0xa3, 0x03, 0xb0, 0x03, 0xbd, 0x03, 0xca, 0x03, 0xd7, 0x03, 0xe4, 0x03,
+  0xf1, 0x03, 0xfe, 0x03, 0x0b, 0x04, 0x18, 0x04, 0x25, 0x04, 0x32, 0x04,
+  0x00, 0x00, 0x0a, 0x00, 0x12, 0x00, 0x19, 0x00, 0x21, 0x00, 0x2a, 0x00,
+  0x00, 0x00, 0x15, 0x00, 0x35, 0x00, 0x3e, 0x00, 0x47, 0x00, 0x53, 0x00,
+  0x59, 0x00, 0x00, 0x00, 0x16, 0x00, 0x2c, 0x00, 0x39, 0x00, 0x51, 0x00,
+  0x5d, 0x00, 0x69, 0x00, 0x75, 0x00, 0x81, 0x00, 0x8d, 0x00, 0x99, 0x00,
+  0xa5, 0x00, 0xb1, 0x00, 0xbd, 0x00, 0xc9, 0x00, 0xd5, 0x00, 0xe1, 0x00,
+  0xed, 0x00, 0xf9, 0x00, 0x05, 0x01, 0x11, 0x01, 0x1d, 0x01, 0x29, 0x01,
+  0x35, 0x01, 0x41, 0x01, 0x4d, 0x01, 0x59, 0x01, 0x65, 0x01, 0x71, 0x01,
+  0x7d, 0x01, 0x89, 0x01, 0x95, 0x01, 0xa1, 0x01, 0xad, 0x01, 0xb9, 0x01,
+  0xc5, 0x01, 0xd1, 0x01, 0xdd, 0x01, 0xe9, 0x01, 0xf5, 0x01, 0x01, 0x02,
+  0x0d, 0x02, 0x19, 0x02, 0x25, 0x02, 0x31, 0x02, 0x3d, 0x02, 0x49, 0x02,
+  0x55, 0x02, 0x61, 0x02, 0x6d, 0x02, 0x79, 0x02, 0x85, 0x02, 0x91, 0x02,
+  0x9d, 0x02, 0xa9, 0x02, 0xb5, 0x02, 0xc1, 0x02, 0xcd, 0x02, 0xd9, 0x02,
+  0xe5, 0x02, 0xf1, 0x02, 0xfd, 0x02, 0x09, 0x03, 0x15, 0x03, 0x21, 0x03,
+  0x2d, 0x03, 0x39, 0x03, 0x45, 0x03, 0x51, 0x03, 0x5d, 0x03, 0x69, 0x03,
+  0x75, 0x03, 0x81, 0x03, 0x8d, 0x03, 0x99, 0x03, 0xa5, 0x03, 0xb1, 0x03,
+  0xbb, 0x03, 0xc7, 0x03, 0x00, 0x00, 0x1a, 0x00, 0x42, 0x00, 0x54, 0x00,
+  0x6b, 0x00, 0x80, 0x00, 0x97, 0x00, 0xac, 0x00, 0xc4, 0x00, 0xda, 0x00,
+  0xf2, 0x00, 0x08, 0x01, 0x15, 0x01, 0x22, 0x01, 0x2f, 0x01, 0x3c, 0x01,
+  0x49, 0x01, 0x56, 0x01, 0x63, 0x01, 0x70, 0x01, 0x7d, 0x01, 0x8a, 0x01,
+  0x97, 0x01, 0xa4, 0x01, 0xb1, 0x01, 0xbe, 0x01, 0xcb, 0x01, 0xd8, 0x01,
+  0xe5, 0x01, 0xf2, 0x01, 0xff, 0x01, 0x0c, 0x02, 0x19, 0x02, 0x26, 0x02,
+  0x33, 0x02, 0x40, 0x02, 0x4d, 0x02, 0x5a, 0x02, 0x67, 0x02, 0x74, 0x02,
+  0x81, 0x02, 0x8e, 0x02, 0x9b, 0x02, 0xa8, 0x02, 0xb5, 0x02, 0xc2, 0x02,
+  0xcf, 0x02, 0xdc, 0x02, 0xe9, 0x02, 0xf6, 0x02, 0x03, 0x03, 0x10, 0x03,
+  0x1d, 0x03, 0x2a, 0x03, 0x37, 0x03, 0x44, 0x03, 0x51, 0x03, 0x5e, 0x03,
+  0x6b, 0x03, 0x78, 0x03, 0x85, 0x03, 0x92, 0x03, 0x9f, 0x03, 0xac, 0x03,
+  0xb9, 0x03, 0xc6, 0x03, 0xd3, 0x03, 0xe0, 0x03, 0xed, 0x03, 0xfa, 0x03,
+  0x07, 0x04, 0x14, 0x04, 0x21, 0x04, 0x2e, 0x04, 0x3b, 0x04, 0x48, 0x04,
+  0x55, 0x04, 0x62, 0x04, 0x6f, 0x04, 0x7c, 0x04, 0x89, 0x04, 0x96, 0x04,
+  0xa3, 0x04, 0xb0, 0x04, 0xbd, 0x04, 0xca, 0x04, 0xd7, 0x04, 0xe4, 0x04,
+  0xf1, 0x04, 0xfe, 0x04, 0x0b, 0x05, 0x18, 0x05, 0x23, 0x05, 0x30, 0x05,
+  0x3a, 0x05, 0x43, 0x05, 0x4f, 0x05, 0x5b, 0x05, 0x63, 0x05, 0x6b, 0x05,
+  0x00, 0x00, 0x14, 0x00, 0x26, 0x00, 0x39, 0x00, 0x50, 0x00, 0x5e, 0x00,
+  0x75, 0x00, 0x8a, 0x00, 0xa0, 0x00, 0xb7, 0x00, 0xcc, 0x00, 0xe3, 0x00,
+  0xfa, 0x00, 0x11, 0x01, 0x28, 0x01, 0x40, 0x01, 0x57, 0x01, 0x6e, 0x01,
+  0x79, 0x01, 0x84, 0x01, 0x8c, 0x01, 0x97, 0x01, 0xa2, 0x01, 0xad, 0x01,
+  0xb5, 0x01, 0xc1, 0x01, 0xcc, 0x01, 0xd3, 0x01, 0xde, 0x01, 0xe9, 0x01,
+  0xf4, 0x01, 0xff, 0x01, 0x0d, 0x02, 0x1f, 0x02, 0x00, 0x00, 0x1c, 0x00,
+  0x2b, 0x00, 0x37, 0x00, 0x44, 0x00, 0x57, 0x00, 0x6e, 0x00, 0x83, 0x00,
+  0x9c, 0x00, 0xb3, 0x00, 0xd1, 0x00, 0xda, 0x00, 0xe3, 0x00, 0xef, 0x00,
+  0xf8, 0x00, 0x01, 0x01, 0x0a, 0x01, 0x16, 0x01, 0x22, 0x01, 0x2e, 0x01,
+  0x3a, 0x01, 0x46, 0x01, 0x4d, 0x01, 0x54, 0x01, 0x61, 0x01, 0x70, 0x01,
+  0x00, 0x00, 0x1b, 0x00, 0x2f, 0x00, 0x4e, 0x00, 0x6e, 0x00, 0x8d, 0x00,
+  0xab, 0x00, 0xc8, 0x00, 0xe5, 0x00, 0x01, 0x01, 0x1e, 0x01, 0x3a, 0x01,
+  0x58, 0x01, 0x75, 0x01, 0x95, 0x01, 0xb4, 0x01, 0xd2, 0x01, 0xf0, 0x01,
+  0x0d, 0x02, 0x21, 0x02, 0x3b, 0x02, 0x54, 0x02, 0x6c, 0x02, 0x7d, 0x02,
+  0x97, 0x02, 0xb2, 0x02, 0xcc, 0x02, 0xe0, 0x02, 0xfa, 0x02, 0x04, 0x03,
+  0x10, 0x03, 0x1a, 0x03, 0x24, 0x03, 0x2e, 0x03, 0x36, 0x03, 0x43, 0x03,
+  0x50, 0x03, 0x5d, 0x03, 0x67, 0x03, 0x74, 0x03, 0x81, 0x03, 0x8e, 0x03,
+  0x9b, 0x03, 0xa5, 0x03, 0xb2, 0x03, 0xbf, 0x03, 0xcc, 0x03, 0xd3, 0x03,
+  0xe0, 0x03, 0x00, 0x00, 0x11, 0x00, 0x20, 0x00, 0x34, 0x00, 0x49, 0x00,
+  0x5b, 0x00, 0x6d, 0x00, 0x78, 0x00, 0x84, 0x00, 0x8e, 0x00, 0x98, 0x00,
+  0xa1, 0x00, 0xaa, 0x00, 0xb3, 0x00, 0xbc, 0x00, 0xc5, 0x00, 0xce, 0x00,
+  0x00, 0x00, 0x0b, 0x00, 0x21, 0x00, 0x30, 0x00, 0x45, 0x00, 0x59, 0x00,
+  0x76, 0x00, 0x82, 0x00, 0x8e, 0x00, 0x9a, 0x00, 0xa6, 0x00, 0xb2, 0x00,
+  0xbe, 0x00, 0xca, 0x00, 0xd6, 0x00, 0xe2, 0x00, 0xee, 0x00, 0xfa, 0x00,
+  0x06, 0x01, 0x12, 0x01, 0x1e, 0x01, 0x2a, 0x01, 0x36, 0x01, 0x42, 0x01,
+  0x4e, 0x01, 0x5a, 0x01, 0x66, 0x01, 0x72, 0x01, 0x7e, 0x01, 0x8a, 0x01,
+  0x96, 0x01, 0xa2, 0x01, 0xb0, 0x01, 0xb6, 0x01, 0xbc, 0x01, 0x00, 0x00,
+  0x0a, 0x00, 0x17, 0x00, 0x24, 0x00, 0x3d, 0x00, 0x55, 0x00, 0x6b, 0x00,
+  0x7e, 0x00, 0x97, 0x00, 0xaf, 0x00, 0xc6, 0x00, 0xda, 0x00, 0xec, 0x00,
+  0x05, 0x01, 0x1d, 0x01, 0x34, 0x01, 0x48, 0x01, 0x60, 0x01, 0x6c, 0x01,
+  0x77, 0x01, 0x83, 0x01, 0x8f, 0x01, 0x96, 0x01, 0x9f, 0x01, 0xab, 0x01,
+  0xb5, 0x01, 0xbe, 0x01, 0x00, 0x00, 0x0e, 0x00, 0x21, 0x00, 0x3b, 0x00,
+  0x53, 0x00, 0x5f, 0x00, 0x68, 0x00, 0x70, 0x00, 0x7e, 0x00, 0x84, 0x00,
+  0x8a, 0x00, 0x94, 0x00, 0x00, 0x00, 0x16, 0x00, 0x2e, 0x00, 0x3f, 0x00,
+  0x57, 0x00, 0x6c, 0x00, 0x81, 0x00, 0x99, 0x00, 0xaf, 0x00, 0xc7, 0x00,
+  0xdd, 0x00, 0xe8, 0x00, 0xf3, 0x00, 0xfe, 0x00, 0x09, 0x01, 0x14, 0x01,
+  0x1f, 0x01, 0x2a, 0x01, 0x35, 0x01, 0x40, 0x01, 0x4b, 0x01, 0x56, 0x01,
+  0x61, 0x01, 0x6c, 0x01, 0x77, 0x01, 0x82, 0x01, 0x8d, 0x01, 0x98, 0x01,
+  0xa3, 0x01, 0xae, 0x01, 0xb9, 0x01, 0xc4, 0x01, 0xcf, 0x01, 0xda, 0x01,
+  0xe5, 0x01, 0xf0, 0x01, 0xfb, 0x01, 0x06, 0x02, 0x11, 0x02, 0x1c, 0x02,
+  0x27, 0x02, 0x32, 0x02, 0x3d, 0x02, 0x48, 0x02, 0x53, 0x02, 0x5e, 0x02,
+  0x69, 0x02, 0x74, 0x02, 0x7f, 0x02, 0x8a, 0x02, 0x95, 0x02, 0xa0, 0x02,
+  0xab, 0x02, 0xb6, 0x02, 0xc1, 0x02, 0xcc, 0x02, 0xd7, 0x02, 0xe2, 0x02,
+  0xed, 0x02, 0xf8, 0x02, 0x03, 0x03, 0x0e, 0x03, 0x19, 0x03, 0x24, 0x03,
+  0x2f, 0x03, 0x3a, 0x03, 0x45, 0x03, 0x50, 0x03, 0x5b, 0x03, 0x66, 0x03,
+  0x71, 0x03, 0x7c, 0x03, 0x87, 0x03, 0x92, 0x03, 0x9d, 0x03, 0xa8, 0x03,
+  0xb3, 0x03, 0xbe, 0x03, 0xc9, 0x03, 0xd4, 0x03, 0xdf, 0x03, 0xee, 0x03,
+  0xfd, 0x03, 0x08, 0x04, 0x13, 0x04, 0x1e, 0x04, 0x29, 0x04, 0x34, 0x04,
+  0x3f, 0x04, 0x4a, 0x04, 0x55, 0x04, 0x60, 0x04, 0x6b, 0x04, 0x76, 0x04,
+  0x81, 0x04, 0x8c, 0x04, 0x97, 0x04, 0xa2, 0x04, 0xad, 0x04, 0xb8, 0x04,
+  0xc3, 0x04, 0xce, 0x04, 0xd9, 0x04, 0xe4, 0x04, 0xef, 0x04, 0xfa, 0x04,
+  0x05, 0x05, 0x10, 0x05, 0x1b, 0x05, 0x26, 0x05, 0x31, 0x05, 0x3c, 0x05,
+  0x47, 0x05, 0x52, 0x05, 0x5d, 0x05, 0x68, 0x05, 0x73, 0x05, 0x7e, 0x05,
+  0x89, 0x05, 0x94, 0x05, 0x9f, 0x05, 0xaa, 0x05, 0xb5, 0x05, 0xc0, 0x05,
+  0xcb, 0x05, 0xd6, 0x05, 0xe1, 0x05, 0xec, 0x05, 0xf7, 0x05, 0x02, 0x06,
+  0x00, 0x00, 0x12, 0x00, 0x1d, 0x00, 0x27, 0x00, 0x3f, 0x00, 0x56, 0x00,
+  0x6d, 0x00, 0x79, 0x00, 0x85, 0x00, 0x91, 0x00, 0x9d, 0x00, 0xa9, 0x00,
+  0xb5, 0x00, 0xc1, 0x00, 0xcd, 0x00, 0xd9, 0x00, 0xe5, 0x00, 0xf1, 0x00,
+  0xfd, 0x00, 0x09, 0x01, 0x15, 0x01, 0x21, 0x01, 0x2d, 0x01, 0x39, 0x01,
+  0x44, 0x01, 0x4f, 0x01, 0x5a, 0x01, 0x64, 0x01, 0x6f, 0x01, 0x7a, 0x01,
+  0x80, 0x01, 0x86, 0x01, 0x90, 0x01, 0x9a, 0x01, 0xae, 0x01, 0xbb, 0x01,
+  0xc8, 0x01, 0xd4, 0x01, 0xe0, 0x01, 0xec, 0x01, 0xf6, 0x01, 0x06, 0x02,
+  0x00, 0x00, 0x0e, 0x00, 0x1b, 0x00, 0x25, 0x00, 0x2f, 0x00, 0x3f, 0x00,
+  0x00, 0x00, 0x1f, 0x00, 0x3c, 0x00, 0x5a, 0x00, 0x77, 0x00, 0x85, 0x00,
+  0x8b, 0x00, 0x96, 0x00, 0xa0, 0x00, 0xa7, 0x00, 0xae, 0x00, 0xb4, 0x00,
+  0xba, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x1b, 0x00, 0x31, 0x00, 0x46, 0x00,
+  0x5b, 0x00, 0x62, 0x00, 0x6c, 0x00, 0x78, 0x00, 0x00, 0x00, 0x14, 0x00,
+  0x20, 0x00, 0x2c, 0x00, 0x39, 0x00, 0x3f, 0x00, 0x45, 0x00, 0x54, 0x00,
+  0x00, 0x00, 0x0f, 0x00, 0x1e, 0x00, 0x29, 0x00, 0x32, 0x00, 0x3a, 0x00,
+  0x41, 0x00, 0x00, 0x00, 0x19, 0x00, 0x24, 0x00, 0x3b, 0x00, 0x4d, 0x00,
+  0x58, 0x00, 0x60, 0x00, 0x6d, 0x00, 0x73, 0x00, 0x7a, 0x00, 0x84, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x19, 0x00, 0x21, 0x00, 0x2d, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x1d, 0x00, 0x26, 0x00, 0x2f, 0x00, 0x3a, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x1f, 0x00, 0x37, 0x00, 0x44, 0x00, 0x4e, 0x00, 0x58, 0x00,
+  0x6b, 0x00, 0x00, 0x00, 0x17, 0x00, 0x23, 0x00, 0x2a, 0x00, 0x36, 0x00,
+  0x3e, 0x00, 0x4b, 0x00, 0x58, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x77, 0x00,
+  0x7e, 0x00, 0x87, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x29, 0x00, 0x46, 0x00,
+  0x62, 0x00, 0x7d, 0x00, 0x97, 0x00, 0xb1, 0x00, 0xca, 0x00, 0xe4, 0x00,
+  0xfd, 0x00, 0x17, 0x01, 0x34, 0x01, 0x4f, 0x01, 0x69, 0x01, 0x85, 0x01,
+  0xa2, 0x01, 0xbe, 0x01, 0xd9, 0x01, 0xf3, 0x01, 0x0d, 0x02, 0x26, 0x02,
+  0x40, 0x02, 0x59, 0x02, 0x74, 0x02, 0x8e, 0x02, 0xab, 0x02, 0xc7, 0x02,
+  0xe2, 0x02, 0xfd, 0x02, 0x17, 0x03, 0x2c, 0x03, 0x45, 0x03, 0x5f, 0x03,
+  0x6b, 0x03, 0x77, 0x03, 0x80, 0x03, 0x89, 0x03, 0x91, 0x03, 0x98, 0x03,
+  0xa5, 0x03, 0xaf, 0x03, 0xb6, 0x03, 0xc2, 0x03, 0xc9, 0x03, 0x00, 0x00,
+  0x0a, 0x00, 0x19, 0x00, 0x1f, 0x00, 0x2d, 0x00, 0x3b, 0x00, 0x41, 0x00,
+  0x4f, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x19, 0x00, 0x27, 0x00,
+  0x35, 0x00, 0x4d, 0x00, 0x62, 0x00, 0x6a, 0x00, 0x72, 0x00, 0x7a, 0x00,
+  0x83, 0x00, 0x8c, 0x00, 0x95, 0x00, 0x9e, 0x00, 0xac, 0x00, 0xb5, 0x00,
+  0xbe, 0x00, 0xc6, 0x00, 0xce, 0x00, 0xd6, 0x00, 0xdc, 0x00, 0xe4, 0x00,
+  0xec, 0x00, 0xf4, 0x00, 0xfc, 0x00, 0x08, 0x01, 0x14, 0x01, 0x1d, 0x01,
+  0x29, 0x01, 0x00, 0x00, 0x0b, 0x00, 0x19, 0x00, 0x2b, 0x00, 0x3c, 0x00,
+  0x55, 0x00, 0x6d, 0x00, 0x76, 0x00, 0x7f, 0x00, 0x8d, 0x00, 0x96, 0x00,
+  0xa0, 0x00, 0x00, 0x00, 0x10, 0x00, 0x25, 0x00, 0x36, 0x00, 0x45, 0x00,
+  0x51, 0x00, 0x5b, 0x00, 0x62, 0x00, 0x6c, 0x00, 0x73, 0x00, 0x7a, 0x00,
+  0x81, 0x00, 0x93, 0x00, 0x00, 0x00, 0x11, 0x00, 0x29, 0x00, 0x40, 0x00,
+  0x53, 0x00, 0x64, 0x00, 0x7c, 0x00, 0x88, 0x00, 0x90, 0x00, 0x98, 0x00,
+  0xa0, 0x00, 0xa6, 0x00, 0xb1, 0x00, 0xb7, 0x00, 0xc0, 0x00, 0xcc, 0x00,
+  0xda, 0x00, 0xea, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x1a, 0x00, 0x28, 0x00,
+  0x37, 0x00, 0x46, 0x00, 0x55, 0x00, 0x68, 0x00, 0x70, 0x00, 0x79, 0x00,
+  0x82, 0x00, 0x8b, 0x00, 0x94, 0x00, 0x9d, 0x00, 0xa6, 0x00, 0xaf, 0x00,
+  0xb8, 0x00, 0x00, 0x00, 0x15, 0x00, 0x28, 0x00, 0x32, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x34, 0x00, 0x48, 0x00, 0x5d, 0x00, 0x71, 0x00, 0x8c, 0x00,
+  0x9c, 0x00, 0xa6, 0x00, 0xaf, 0x00, 0xbf, 0x00, 0x00, 0x00, 0x17, 0x00,
+  0x2d, 0x00, 0x46, 0x00, 0x60, 0x00, 0x79, 0x00, 0x91, 0x00, 0xa8, 0x00,
+  0xbf, 0x00, 0xd5, 0x00, 0xec, 0x00, 0x02, 0x01, 0x19, 0x01, 0x33, 0x01,
+  0x4b, 0x01, 0x62, 0x01, 0x70, 0x01, 0x79, 0x01, 0x82, 0x01, 0x91, 0x01,
+  0x9b, 0x01, 0x00, 0x00, 0x0a, 0x00, 0x1d, 0x00, 0x26, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x27, 0x00, 0x3b, 0x00, 0x4d, 0x00, 0x56, 0x00, 0x60, 0x00,
+  0x69, 0x00, 0x00, 0x00, 0x15, 0x00, 0x21, 0x00, 0x35, 0x00, 0x48, 0x00,
+  0x64, 0x00, 0x7e, 0x00, 0x85, 0x00, 0x8e, 0x00, 0x94, 0x00, 0x00, 0x00,
+  0x17, 0x00, 0x23, 0x00, 0x30, 0x00, 0x3c, 0x00, 0x56, 0x00, 0x6f, 0x00,
+  0x8b, 0x00, 0xa8, 0x00, 0xc4, 0x00, 0xdf, 0x00, 0xf9, 0x00, 0x13, 0x01,
+  0x2c, 0x01, 0x46, 0x01, 0x5f, 0x01, 0x79, 0x01, 0x96, 0x01, 0xb1, 0x01,
+  0xcb, 0x01, 0xe1, 0x01, 0xf3, 0x01, 0x06, 0x02, 0x18, 0x02, 0x2b, 0x02,
+  0x3a, 0x02, 0x4c, 0x02, 0x55, 0x02, 0x61, 0x02, 0x6d, 0x02, 0x78, 0x02,
+  0x83, 0x02, 0x8e, 0x02, 0x97, 0x02, 0x00, 0x00, 0x0e, 0x00, 0x1e, 0x00,
+  0x2b, 0x00, 0x44, 0x00, 0x4c, 0x00, 0x59, 0x00, 0x60, 0x00, 0x67, 0x00,
+  0x00, 0x00, 0x19, 0x00, 0x28, 0x00, 0x34, 0x00, 0x43, 0x00, 0x52, 0x00,
+  0x61, 0x00, 0x71, 0x00, 0x81, 0x00, 0x91, 0x00, 0xa9, 0x00, 0xbd, 0x00,
+  0xd3, 0x00, 0xe8, 0x00, 0x03, 0x01, 0x17, 0x01, 0x27, 0x01, 0x30, 0x01,
+  0x38, 0x01, 0x41, 0x01, 0x49, 0x01, 0x53, 0x01, 0x5b, 0x01, 0x64, 0x01,
+  0x71, 0x01, 0x7a, 0x01, 0x88, 0x01, 0x8f, 0x01, 0x98, 0x01, 0xa0, 0x01,
+  0xa8, 0x01, 0xb0, 0x01, 0xb8, 0x01, 0xc0, 0x01, 0xc8, 0x01, 0xd0, 0x01,
+  0xd8, 0x01, 0xe0, 0x01, 0xe8, 0x01, 0xf0, 0x01, 0xf8, 0x01, 0x00, 0x00,
+  0x18, 0x00, 0x24, 0x00, 0x31, 0x00, 0x3d, 0x00, 0x49, 0x00, 0x55, 0x00,
+  0x61, 0x00, 0x6a, 0x00, 0x7e, 0x00, 0x85, 0x00, 0x8c, 0x00, 0x93, 0x00,
+  0x9a, 0x00, 0xa4, 0x00, 0xae, 0x00, 0xba, 0x00, 0xc6, 0x00, 0xd2, 0x00,
+  0xdc, 0x00, 0xe7, 0x00, 0xf0, 0x00, 0xf9, 0x00, 0x00, 0x00, 0x15, 0x00,
+  0x22, 0x00, 0x2c, 0x00, 0x4b, 0x00, 0x6b, 0x00, 0x8a, 0x00, 0xa8, 0x00,
+  0xc5, 0x00, 0xe2, 0x00, 0xfe, 0x00, 0x1b, 0x01, 0x37, 0x01, 0x54, 0x01,
+  0x74, 0x01, 0x92, 0x01, 0xaf, 0x01, 0xc3, 0x01, 0xd6, 0x01, 0xf0, 0x01,
+  0x0a, 0x02, 0x12, 0x02, 0x1a, 0x02, 0x28, 0x02, 0x36, 0x02, 0x44, 0x02,
+  0x52, 0x02, 0x60, 0x02, 0x6e, 0x02, 0x77, 0x02, 0x80, 0x02, 0x00, 0x00,
+  0x0e, 0x00, 0x1c, 0x00, 0x2f, 0x00, 0x3b, 0x00, 0x48, 0x00, 0x53, 0x00,
+  0x6a, 0x00, 0x7e, 0x00, 0x90, 0x00, 0x99, 0x00, 0xa4, 0x00, 0xb0, 0x00,
+  0xb8, 0x00, 0xc1, 0x00, 0xcb, 0x00, 0xd7, 0x00, 0xe1, 0x00, 0xea, 0x00,
+  0x00, 0x00, 0x14, 0x00, 0x22, 0x00, 0x31, 0x00, 0x3f, 0x00, 0x4c, 0x00,
+  0x5b, 0x00, 0x6b, 0x00, 0x7b, 0x00, 0x95, 0x00, 0xa0, 0x00, 0xaf, 0x00,
+  0xb9, 0x00, 0xc2, 0x00, 0xcc, 0x00, 0xd4, 0x00, 0xdd, 0x00, 0xe6, 0x00,
+  0xef, 0x00, 0xf8, 0x00, 0x01, 0x01, 0x0f, 0x01, 0x18, 0x01, 0x20, 0x01,
+  0x2b, 0x01, 0x34, 0x01, 0x3d, 0x01, 0x45, 0x01, 0x4d, 0x01, 0x55, 0x01,
+  0x60, 0x01, 0x6c, 0x01, 0x75, 0x01, 0x7d, 0x01, 0x85, 0x01, 0x8d, 0x01,
+  0x00, 0x00, 0x13, 0x00, 0x22, 0x00, 0x35, 0x00, 0x42, 0x00, 0x49, 0x00,
+  0x50, 0x00, 0x5b, 0x00, 0x65, 0x00, 0x71, 0x00, 0x00, 0x00, 0x12, 0x00,
+  0x28, 0x00, 0x39, 0x00, 0x51, 0x00, 0x68, 0x00, 0x76, 0x00, 0x7f, 0x00,
+  0x85, 0x00, 0x90, 0x00, 0x96, 0x00, 0x9c, 0x00, 0xa3, 0x00, 0xb0, 0x00,
+  0xbc, 0x00, 0xcb, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x23, 0x00, 0x38, 0x00,
+  0x4c, 0x00, 0x66, 0x00, 0x7d, 0x00, 0x92, 0x00, 0x9e, 0x00, 0xaa, 0x00,
+  0xb6, 0x00, 0xc2, 0x00, 0xce, 0x00, 0xda, 0x00, 0xe6, 0x00, 0xf2, 0x00,
+  0xfe, 0x00, 0x0d, 0x01, 0x19, 0x01, 0x25, 0x01, 0x31, 0x01, 0x3d, 0x01,
+  0x49, 0x01, 0x55, 0x01, 0x61, 0x01, 0x6d, 0x01, 0x79, 0x01, 0x85, 0x01,
+  0x91, 0x01, 0x9d, 0x01, 0xa9, 0x01, 0xb5, 0x01, 0xc1, 0x01, 0xcd, 0x01,
+  0xd9, 0x01, 0xe5, 0x01, 0xf1, 0x01, 0xfd, 0x01, 0x09, 0x02, 0x15, 0x02,
+  0x21, 0x02, 0x2d, 0x02, 0x39, 0x02, 0x45, 0x02, 0x51, 0x02, 0x5d, 0x02,
+  0x69, 0x02, 0x75, 0x02, 0x81, 0x02, 0x8d, 0x02, 0x99, 0x02, 0xa5, 0x02,
+  0xb1, 0x02, 0xbd, 0x02, 0xc9, 0x02, 0xd5, 0x02, 0xe1, 0x02, 0xed, 0x02,
+  0xf9, 0x02, 0x05, 0x03, 0x11, 0x03, 0x1d, 0x03, 0x29, 0x03, 0x35, 0x03,
+  0x41, 0x03, 0x4d, 0x03, 0x59, 0x03, 0x65, 0x03, 0x71, 0x03, 0x7d, 0x03,
+  0x89, 0x03, 0x95, 0x03, 0xa1, 0x03, 0xad, 0x03, 0xb9, 0x03, 0xc5, 0x03,
+  0xcf, 0x03, 0xd9, 0x03, 0xe5, 0x03, 0xef, 0x03, 0xf7, 0x03, 0x00, 0x04,
+  0x0b, 0x04, 0x00, 0x00, 0x1b, 0x00, 0x37, 0x00, 0x52, 0x00, 0x6c, 0x00,
+  0x85, 0x00, 0x9e, 0x00, 0xb6, 0x00, 0xcf, 0x00, 0xe7, 0x00, 0x00, 0x01,
+  0x1c, 0x01, 0x36, 0x01, 0x4f, 0x01, 0x64, 0x01, 0x6e, 0x01, 0x78, 0x01,
+  0x82, 0x01, 0x88, 0x01, 0x8e, 0x01, 0x94, 0x01, 0xa0, 0x01, 0xa7, 0x01,
+  0xad, 0x01, 0xb8, 0x01, 0xc4, 0x01, 0xcb, 0x01, 0x00, 0x00, 0x1b, 0x00,
+  0x28, 0x00, 0x3c, 0x00, 0x51, 0x00, 0x6a, 0x00, 0x82, 0x00, 0x9c, 0x00,
+  0xb5, 0x00, 0xc1, 0x00, 0xcb, 0x00, 0xd5, 0x00, 0xdf, 0x00, 0x00, 0x00,
+  0x16, 0x00, 0x28, 0x00, 0x37, 0x00, 0x49, 0x00, 0x61, 0x00, 0x78, 0x00,
+  0x92, 0x00, 0xad, 0x00, 0xc7, 0x00, 0xe0, 0x00, 0xf8, 0x00, 0x10, 0x01,
+  0x27, 0x01, 0x3f, 0x01, 0x56, 0x01, 0x6e, 0x01, 0x89, 0x01, 0xa2, 0x01,
+  0xba, 0x01, 0xcc, 0x01, 0xde, 0x01, 0xf6, 0x01, 0x0e, 0x02, 0x21, 0x02,
+  0x35, 0x02, 0x49, 0x02, 0x52, 0x02, 0x5b, 0x02, 0x61, 0x02, 0x67, 0x02,
+  0x72, 0x02, 0x82, 0x02, 0x00, 0x00, 0x22, 0x00, 0x30, 0x00, 0x3d, 0x00,
+  0x4b, 0x00, 0x55, 0x00, 0x00, 0x00, 0x17, 0x00, 0x33, 0x00, 0x50, 0x00,
+  0x6c, 0x00, 0x87, 0x00, 0xa1, 0x00, 0xbb, 0x00, 0xd4, 0x00, 0xee, 0x00,
+  0x07, 0x01, 0x21, 0x01, 0x3e, 0x01, 0x59, 0x01, 0x73, 0x01, 0x83, 0x01,
+  0x93, 0x01, 0x9c, 0x01, 0x00, 0x00, 0x13, 0x00, 0x1c, 0x00, 0x24, 0x00,
+  0x2d, 0x00, 0x33, 0x00, 0x39, 0x00, 0x00, 0x00, 0x21, 0x00, 0x2e, 0x00,
+  0x3d, 0x00, 0x48, 0x00, 0x53, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x0a, 0x00,
+  0x1a, 0x00, 0x26, 0x00, 0x32, 0x00, 0x3e, 0x00, 0x48, 0x00, 0x54, 0x00,
+  0x60, 0x00, 0x00, 0x00, 0x20, 0x00, 0x2d, 0x00, 0x3d, 0x00, 0x4f, 0x00,
+  0x61, 0x00, 0x73, 0x00, 0x80, 0x00, 0x87, 0x00, 0x94, 0x00, 0x9d, 0x00,
+  0xa6, 0x00, 0xaf, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x2a, 0x00, 0x37, 0x00,
+  0x48, 0x00, 0x5b, 0x00, 0x6b, 0x00, 0x74, 0x00, 0x7b, 0x00, 0x88, 0x00,
+  0x8f, 0x00, 0x96, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x29, 0x00,
+  0x34, 0x00, 0x40, 0x00, 0x49, 0x00, 0x51, 0x00, 0x5d, 0x00, 0x65, 0x00,
+  0x6d, 0x00, 0x73, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x24, 0x00, 0x37, 0x00,
+  0x49, 0x00, 0x61, 0x00, 0x77, 0x00, 0x7f, 0x00, 0x87, 0x00, 0x8f, 0x00,
+  0x98, 0x00, 0xa1, 0x00, 0xaa, 0x00, 0xb2, 0x00, 0xbb, 0x00, 0xc4, 0x00,
+  0xcd, 0x00, 0xd8, 0x00, 0xe2, 0x00, 0x00, 0x00, 0x12, 0x00, 0x28, 0x00,
+  0x3d, 0x00, 0x52, 0x00, 0x68, 0x00, 0x7e, 0x00, 0x94, 0x00, 0xaa, 0x00,
+  0xc1, 0x00, 0xd8, 0x00, 0xe2, 0x00, 0xef, 0x00, 0xfc, 0x00, 0x07, 0x01,
+  0x12, 0x01, 0x1b, 0x01, 0x25, 0x01, 0x00, 0x00, 0x22, 0x00, 0x37, 0x00,
+  0x53, 0x00, 0x60, 0x00, 0x6c, 0x00, 0x7a, 0x00, 0x8f, 0x00, 0x9b, 0x00,
+  0xa4, 0x00, 0xac, 0x00, 0xb4, 0x00, 0xbb, 0x00, 0xca, 0x00, 0xd1, 0x00,
+  0xd8, 0x00, 0x00, 0x00, 0x24, 0x00, 0x41, 0x00, 0x5e, 0x00, 0x6a, 0x00,
+  0x83, 0x00, 0x9d, 0x00, 0xb8, 0x00, 0xd1, 0x00, 0xe9, 0x00, 0x02, 0x01,
+  0x19, 0x01, 0x30, 0x01, 0x48, 0x01, 0x5e, 0x01, 0x75, 0x01, 0x8d, 0x01,
+  0xa3, 0x01, 0xbc, 0x01, 0xd3, 0x01, 0xed, 0x01, 0x05, 0x02, 0x1e, 0x02,
+  0x35, 0x02, 0x40, 0x02, 0x4b, 0x02, 0x53, 0x02, 0x5a, 0x02, 0x65, 0x02,
+  0x71, 0x02, 0x00, 0x00, 0x1c, 0x00, 0x29, 0x00, 0x36, 0x00, 0x4c, 0x00,
+  0x62, 0x00, 0x77, 0x00, 0x7f, 0x00, 0x88, 0x00, 0x91, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x2c, 0x00, 0x49, 0x00, 0x65, 0x00, 0x80, 0x00, 0x9a, 0x00,
+  0xb4, 0x00, 0xcd, 0x00, 0xe7, 0x00, 0x00, 0x01, 0x1a, 0x01, 0x37, 0x01,
+  0x52, 0x01, 0x6c, 0x01, 0x7e, 0x01, 0x97, 0x01, 0xa1, 0x01, 0xab, 0x01,
+  0xb5, 0x01, 0xbf, 0x01, 0xca, 0x01, 0xd5, 0x01, 0xe1, 0x01, 0xe9, 0x01,
+  0x00, 0x00, 0x0c, 0x00, 0x21, 0x00, 0x33, 0x00, 0x47, 0x00, 0x4e, 0x00,
+  0x58, 0x00, 0x62, 0x00, 0x69, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x1a, 0x00,
+  0x27, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x31, 0x00, 0x4c, 0x00, 0x66, 0x00,
+  0x72, 0x00, 0x7e, 0x00, 0x8a, 0x00, 0x91, 0x00, 0x00, 0x00, 0x12, 0x00,
+  0x24, 0x00, 0x39, 0x00, 0x40, 0x00, 0x48, 0x00, 0x00, 0x00, 0x14, 0x00,
+  0x24, 0x00, 0x33, 0x00, 0x3f, 0x00, 0x56, 0x00, 0x5f, 0x00, 0x6d, 0x00,
+  0x76, 0x00, 0x80, 0x00, 0x8a, 0x00, 0x94, 0x00, 0x9e, 0x00, 0xa8, 0x00,
+  0xb4, 0x00, 0xbd, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x16, 0x00, 0x25, 0x00,
+  0x34, 0x00, 0x46, 0x00, 0x58, 0x00, 0x69, 0x00, 0x75, 0x00, 0x81, 0x00,
+  0x8a, 0x00, 0x95, 0x00, 0x9c, 0x00, 0xa3, 0x00, 0xaa, 0x00, 0xb1, 0x00,
+  0xb8, 0x00, 0xbe, 0x00, 0xc8, 0x00, 0xd3, 0x00, 0xde, 0x00, 0xe7, 0x00,
+  0xf8, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x17, 0x00, 0x2e, 0x00, 0x43, 0x00,
+  0x57, 0x00, 0x60, 0x00, 0x6c, 0x00, 0x78, 0x00, 0x84, 0x00, 0x90, 0x00,
+  0x9c, 0x00, 0xa8, 0x00, 0xb4, 0x00, 0xbf, 0x00, 0xcb, 0x00, 0xde, 0x00,
+  0xef, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x2e, 0x00, 0x45, 0x00,
+  0x5b, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x1d, 0x00, 0x36, 0x00, 0x4e, 0x00,
+  0x67, 0x00, 0x7f, 0x00, 0x9e, 0x00, 0xbd, 0x00, 0xc6, 0x00, 0xcf, 0x00,
+  0xdb, 0x00, 0xe5, 0x00, 0xef, 0x00, 0xf5, 0x00, 0xfd, 0x00, 0x00, 0x00,
+  0x15, 0x00, 0x22, 0x00, 0x41, 0x00, 0x61, 0x00, 0x80, 0x00, 0x9e, 0x00,
+  0xbb, 0x00, 0xd8, 0x00, 0xf4, 0x00, 0x11, 0x01, 0x2d, 0x01, 0x4a, 0x01,
+  0x6a, 0x01, 0x88, 0x01, 0xa5, 0x01, 0xb7, 0x01, 0xca, 0x01, 0xe4, 0x01,
+  0xfd, 0x01, 0x03, 0x02, 0x0a, 0x02, 0x11, 0x02, 0x19, 0x02, 0x2a, 0x02,
+  0x00, 0x00, 0x1a, 0x00, 0x26, 0x00, 0x3a, 0x00, 0x50, 0x00, 0x5e, 0x00,
+  0x6c, 0x00, 0x7b, 0x00, 0x8a, 0x00, 0x99, 0x00, 0xa7, 0x00, 0xc0, 0x00,
+  0xd0, 0x00, 0xe0, 0x00, 0xf0, 0x00, 0x00, 0x01, 0x16, 0x01, 0x2f, 0x01,
+  0x39, 0x01, 0x41, 0x01, 0x49, 0x01, 0x51, 0x01, 0x59, 0x01, 0x62, 0x01,
+  0x6b, 0x01, 0x77, 0x01, 0x83, 0x01, 0x8c, 0x01, 0x95, 0x01, 0x9e, 0x01,
+  0xaa, 0x01, 0xb6, 0x01, 0xbe, 0x01, 0xc6, 0x01, 0xce, 0x01, 0xd6, 0x01,
+  0xde, 0x01, 0xe6, 0x01, 0xee, 0x01, 0xf7, 0x01, 0x00, 0x02, 0x09, 0x02,
+  0x11, 0x02, 0x21, 0x02, 0x31, 0x02, 0x00, 0x00, 0x1d, 0x00, 0x33, 0x00,
+  0x4c, 0x00, 0x61, 0x00, 0x6d, 0x00, 0x79, 0x00, 0x85, 0x00, 0x8f, 0x00,
+  0x99, 0x00, 0xa3, 0x00, 0xb0, 0x00, 0xbd, 0x00, 0xc7, 0x00, 0xd4, 0x00,
+  0xe1, 0x00, 0x00, 0x00, 0x16, 0x00, 0x21, 0x00, 0x2c, 0x00, 0x44, 0x00,
+  0x5a, 0x00, 0x66, 0x00, 0x72, 0x00, 0x78, 0x00, 0x82, 0x00, 0x8d, 0x00,
+  0x94, 0x00, 0xa4, 0x00, 0xb4, 0x00, 0x00, 0x00, 0x10, 0x00, 0x22, 0x00,
+  0x2c, 0x00, 0x36, 0x00, 0x40, 0x00, 0x4d, 0x00, 0x5a, 0x00, 0x61, 0x00,
+  0x67, 0x00, 0x71, 0x00, 0x76, 0x00, 0x80, 0x00, 0x88, 0x00, 0x8f, 0x00,
+  0x96, 0x00, 0x9d, 0x00, 0xa4, 0x00, 0xae, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x1b, 0x00, 0x28, 0x00, 0x35, 0x00, 0x42, 0x00, 0x50, 0x00, 0x5e, 0x00,
+  0x6d, 0x00, 0x7a, 0x00, 0x89, 0x00, 0x96, 0x00, 0xa4, 0x00, 0xb4, 0x00,
+  0xc4, 0x00, 0xd4, 0x00, 0xe4, 0x00, 0xf4, 0x00, 0x0b, 0x01, 0x21, 0x01,
+  0x39, 0x01, 0x50, 0x01, 0x67, 0x01, 0x75, 0x01, 0x7d, 0x01, 0x89, 0x01,
+  0x92, 0x01, 0x9b, 0x01, 0xa4, 0x01, 0xaa, 0x01, 0xb0, 0x01, 0xb6, 0x01,
+  0xbf, 0x01, 0xc8, 0x01, 0xd2, 0x01, 0xdc, 0x01, 0xe5, 0x01, 0xee, 0x01,
+  0xf6, 0x01, 0xfc, 0x01, 0x04, 0x02, 0x0c, 0x02, 0x14, 0x02, 0x1a, 0x02,
+  0x23, 0x02, 0x2b, 0x02, 0x34, 0x02, 0x3d, 0x02, 0x46, 0x02, 0x4e, 0x02,
+  0x56, 0x02, 0x00, 0x00, 0x0c, 0x00, 0x1e, 0x00, 0x40, 0x00, 0x54, 0x00,
+  0x67, 0x00, 0x7b, 0x00, 0x8d, 0x00, 0x97, 0x00, 0xa1, 0x00, 0xab, 0x00,
+  0xb5, 0x00, 0xbf, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x1e, 0x00, 0x2d, 0x00,
+  0x3d, 0x00, 0x50, 0x00, 0x6d, 0x00, 0x88, 0x00, 0x95, 0x00, 0xa2, 0x00,
+  0xaf, 0x00, 0xbc, 0x00, 0xc8, 0x00, 0xd5, 0x00, 0xe2, 0x00, 0xef, 0x00,
+  0xfc, 0x00, 0x09, 0x01, 0x16, 0x01, 0x23, 0x01, 0x30, 0x01, 0x3d, 0x01,
+  0x4a, 0x01, 0x57, 0x01, 0x64, 0x01, 0x71, 0x01, 0x7e, 0x01, 0x8b, 0x01,
+  0x98, 0x01, 0xa4, 0x01, 0xb1, 0x01, 0xbe, 0x01, 0xcb, 0x01, 0xdb, 0x01,
+  0xe8, 0x01, 0xf4, 0x01, 0x01, 0x02, 0x0e, 0x02, 0x1b, 0x02, 0x27, 0x02,
+  0x34, 0x02, 0x40, 0x02, 0x4d, 0x02, 0x59, 0x02, 0x66, 0x02, 0x73, 0x02,
+  0x7d, 0x02, 0x86, 0x02, 0x8e, 0x02, 0x97, 0x02, 0x9e, 0x02, 0x00, 0x00,
+  0x18, 0x00, 0x2b, 0x00, 0x41, 0x00, 0x51, 0x00, 0x5c, 0x00, 0x6c, 0x00,
+  0x81, 0x00, 0x96, 0x00, 0xaa, 0x00, 0xb7, 0x00, 0xc4, 0x00, 0xd1, 0x00,
+  0xdb, 0x00, 0xe4, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0x08, 0x01, 0x12, 0x01,
+  0x1b, 0x01, 0x25, 0x01, 0x2e, 0x01, 0x00, 0x00, 0x0f, 0x00, 0x23, 0x00,
+  0x31, 0x00, 0x3f, 0x00, 0x5b, 0x00, 0x78, 0x00, 0x94, 0x00, 0xaf, 0x00,
+  0xc9, 0x00, 0xe3, 0x00, 0xfc, 0x00, 0x16, 0x01, 0x2f, 0x01, 0x49, 0x01,
+  0x66, 0x01, 0x81, 0x01, 0x9b, 0x01, 0xb8, 0x01, 0x00, 0x00, 0x1a, 0x00,
+  0x27, 0x00, 0x3a, 0x00, 0x47, 0x00, 0x58, 0x00, 0x00, 0x00, 0x0f, 0x00,
+  0x1e, 0x00, 0x31, 0x00, 0x43, 0x00, 0x53, 0x00, 0x63, 0x00, 0x00, 0x00,
+  0x16, 0x00, 0x1e, 0x00, 0x33, 0x00, 0x46, 0x00, 0x4e, 0x00, 0x54, 0x00,
+  0x00, 0x00, 0x1e, 0x00, 0x40, 0x00, 0x50, 0x00, 0x62, 0x00, 0x7e, 0x00,
+  0x9b, 0x00, 0xb7, 0x00, 0xd2, 0x00, 0xec, 0x00, 0x06, 0x01, 0x1f, 0x01,
+  0x39, 0x01, 0x52, 0x01, 0x6c, 0x01, 0x89, 0x01, 0xa4, 0x01, 0xbe, 0x01,
+  0xce, 0x01, 0xda, 0x01, 0xe3, 0x01, 0xeb, 0x01, 0xf2, 0x01, 0xf9, 0x01,
+  0x00, 0x02, 0x07, 0x02, 0x0e, 0x02, 0x16, 0x02, 0x1e, 0x02, 0x27, 0x02,
+  0x30, 0x02, 0x36, 0x02, 0x3f, 0x02, 0x48, 0x02, 0x4f, 0x02, 0x58, 0x02,
+  0x00, 0x00, 0x15, 0x00, 0x22, 0x00, 0x2f, 0x00, 0x49, 0x00, 0x64, 0x00,
+  0x7e, 0x00, 0x97, 0x00, 0xaf, 0x00, 0xc7, 0x00, 0xde, 0x00, 0xf6, 0x00,
+  0x0d, 0x01, 0x25, 0x01, 0x40, 0x01, 0x59, 0x01, 0x71, 0x01, 0x78, 0x01,
+  0x82, 0x01, 0x8e, 0x01, 0x95, 0x01, 0x9c, 0x01, 0xa3, 0x01, 0xaa, 0x01,
+  0xb1, 0x01, 0x00, 0x00, 0x10, 0x00, 0x20, 0x00, 0x36, 0x00, 0x4b, 0x00,
+  0x55, 0x00, 0x5c, 0x00, 0x65, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x27, 0x00, 0x39, 0x00, 0x41, 0x00, 0x49, 0x00, 0x51, 0x00,
+  0x58, 0x00, 0x5f, 0x00, 0x6f, 0x00, 0x00, 0x00, 0x19, 0x00, 0x2c, 0x00,
+  0x54, 0x00, 0x5e, 0x00, 0x6a, 0x00, 0x77, 0x00, 0x8a, 0x00, 0x9f, 0x00,
+  0xb2, 0x00, 0xb8, 0x00, 0xc0, 0x00, 0xc6, 0x00, 0xcc, 0x00, 0xd2, 0x00,
+  0xd8, 0x00, 0xdf, 0x00, 0xe6, 0x00, 0xed, 0x00, 0xf4, 0x00, 0xfb, 0x00,
+  0x09, 0x01, 0x18, 0x01, 0x00, 0x00, 0x0f, 0x00, 0x18, 0x00, 0x2d, 0x00,
+  0x43, 0x00, 0x58, 0x00, 0x6e, 0x00, 0x77, 0x00, 0x83, 0x00, 0x8d, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x2a, 0x00, 0x3f, 0x00, 0x53, 0x00, 0x67, 0x00,
+  0x7c, 0x00, 0x90, 0x00, 0xa6, 0x00, 0xba, 0x00, 0xd0, 0x00, 0xe4, 0x00,
+  0xfa, 0x00, 0x0f, 0x01, 0x23, 0x01, 0x2f, 0x01, 0x39, 0x01, 0x42, 0x01,
+  0x4c, 0x01, 0x56, 0x01, 0x60, 0x01, 0x6a, 0x01, 0x75, 0x01, 0x00, 0x00,
+  0x12, 0x00, 0x22, 0x00, 0x34, 0x00, 0x4a, 0x00, 0x5f, 0x00, 0x72, 0x00,
+  0x83, 0x00, 0x8e, 0x00, 0x94, 0x00, 0x9b, 0x00, 0xa7, 0x00, 0xb1, 0x00,
+  0xba, 0x00, 0xc3, 0x00, 0xcc, 0x00, 0xd6, 0x00, 0xe5, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x29, 0x00, 0x3d, 0x00, 0x47, 0x00, 0x54, 0x00, 0x5e, 0x00,
+  0x69, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x1c, 0x00, 0x26, 0x00, 0x31, 0x00,
+  0x3f, 0x00, 0x48, 0x00, 0x50, 0x00, 0x5c, 0x00, 0x68, 0x00, 0x00, 0x00,
+  0x18, 0x00, 0x25, 0x00, 0x3c, 0x00, 0x52, 0x00, 0x6a, 0x00, 0x77, 0x00,
+  0x83, 0x00, 0x8f, 0x00, 0x9b, 0x00, 0xa7, 0x00, 0xb3, 0x00, 0xbf, 0x00,
+  0xcb, 0x00, 0xd7, 0x00, 0xe3, 0x00, 0xef, 0x00, 0xfb, 0x00, 0x07, 0x01,
+  0x13, 0x01, 0x1f, 0x01, 0x2b, 0x01, 0x37, 0x01, 0x43, 0x01, 0x4f, 0x01,
+  0x5b, 0x01, 0x67, 0x01, 0x73, 0x01, 0x7f, 0x01, 0x8b, 0x01, 0x97, 0x01,
+  0xa3, 0x01, 0xaf, 0x01, 0xbb, 0x01, 0xc7, 0x01, 0xd3, 0x01, 0xdf, 0x01,
+  0xe8, 0x01, 0xf1, 0x01, 0xfd, 0x01, 0x09, 0x02, 0x13, 0x02, 0x1d, 0x02,
+  0x27, 0x02, 0x31, 0x02, 0x3a, 0x02, 0x46, 0x02, 0x52, 0x02, 0x5e, 0x02,
+  0x6a, 0x02, 0x74, 0x02, 0x7e, 0x02, 0x88, 0x02, 0x00, 0x00, 0x0f, 0x00,
+  0x1e, 0x00, 0x28, 0x00, 0x43, 0x00, 0x5f, 0x00, 0x7a, 0x00, 0x94, 0x00,
+  0xad, 0x00, 0xc6, 0x00, 0xde, 0x00, 0xf7, 0x00, 0x0f, 0x01, 0x28, 0x01,
+  0x44, 0x01, 0x5e, 0x01, 0x77, 0x01, 0x8e, 0x01, 0xa4, 0x01, 0xad, 0x01,
+  0xb6, 0x01, 0xc1, 0x01, 0xc9, 0x01, 0xd2, 0x01, 0xd8, 0x01, 0xe1, 0x01,
+  0xea, 0x01, 0x00, 0x00, 0x11, 0x00, 0x21, 0x00, 0x2e, 0x00, 0x38, 0x00,
+  0x51, 0x00, 0x62, 0x00, 0x7a, 0x00, 0x92, 0x00, 0xab, 0x00, 0xc4, 0x00,
+  0xdb, 0x00, 0xf4, 0x00, 0x0d, 0x01, 0x14, 0x01, 0x1e, 0x01, 0x25, 0x01,
+  0x33, 0x01, 0x00, 0x00, 0x0f, 0x00, 0x1e, 0x00, 0x35, 0x00, 0x4a, 0x00,
+  0x51, 0x00, 0x00, 0x00, 0x09, 0x00, 0x1e, 0x00, 0x33, 0x00, 0x39, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x39, 0x00, 0x55, 0x00, 0x70, 0x00,
+  0x8a, 0x00, 0xa4, 0x00, 0xbd, 0x00, 0xd7, 0x00, 0xf0, 0x00, 0x0a, 0x01,
+  0x27, 0x01, 0x42, 0x01, 0x5c, 0x01, 0x68, 0x01, 0x78, 0x01, 0x8d, 0x01,
+  0x94, 0x01, 0x9f, 0x01, 0xaa, 0x01, 0xb0, 0x01, 0xb6, 0x01, 0xc1, 0x01,
+  0xd1, 0x01, 0xdb, 0x01, 0x00, 0x00, 0x1e, 0x00, 0x3d, 0x00, 0x5b, 0x00,
+  0x78, 0x00, 0x94, 0x00, 0xb0, 0x00, 0xcb, 0x00, 0xe7, 0x00, 0x02, 0x01,
+  0x1e, 0x01, 0x3d, 0x01, 0x5a, 0x01, 0x76, 0x01, 0x87, 0x01, 0x9a, 0x01,
+  0xa4, 0x01, 0xad, 0x01, 0xb9, 0x01, 0xc2, 0x01, 0xcb, 0x01, 0xd5, 0x01,
+  0x00, 0x00, 0x21, 0x00, 0x40, 0x00, 0x55, 0x00, 0x6a, 0x00, 0x78, 0x00,
+  0x00, 0x00, 0x0a, 0x00, 0x13, 0x00, 0x1c, 0x00, 0x23, 0x00, 0x2b, 0x00,
+  0x33, 0x00, 0x39, 0x00, 0x40, 0x00, 0x00, 0x00, 0x09, 0x00, 0x2a, 0x00,
+  0x41, 0x00, 0x58, 0x00, 0x70, 0x00, 0x88, 0x00, 0xa0, 0x00, 0xb8, 0x00,
+  0xbe, 0x00, 0xca, 0x00, 0xd0, 0x00, 0xdb, 0x00, 0x00, 0x00, 0x16, 0x00,
+  0x38, 0x00, 0x43, 0x00, 0x4c, 0x00, 0x55, 0x00, 0x00, 0x00, 0x0b, 0x00,
+  0x1c, 0x00, 0x32, 0x00, 0x47, 0x00, 0x51, 0x00, 0x5b, 0x00, 0x65, 0x00,
+  0x6f, 0x00, 0x79, 0x00, 0x83, 0x00, 0x8d, 0x00, 0x97, 0x00, 0xa1, 0x00,
+  0xab, 0x00, 0xb5, 0x00, 0xbf, 0x00, 0xc9, 0x00, 0xd3, 0x00, 0xdd, 0x00,
+  0xe7, 0x00, 0xf1, 0x00, 0xfb, 0x00, 0x05, 0x01, 0x0f, 0x01, 0x19, 0x01,
+  0x23, 0x01, 0x2d, 0x01, 0x37, 0x01, 0x41, 0x01, 0x4b, 0x01, 0x55, 0x01,
+  0x5f, 0x01, 0x69, 0x01, 0x73, 0x01, 0x7d, 0x01, 0x87, 0x01, 0x91, 0x01,
+  0x9b, 0x01, 0xa5, 0x01, 0xb0, 0x01, 0xbb, 0x01, 0xc6, 0x01, 0xd1, 0x01,
+  0xdc, 0x01, 0xe6, 0x01, 0xf0, 0x01, 0x00, 0x00, 0x0b, 0x00, 0x1d, 0x00,
+  0x35, 0x00, 0x4a, 0x00, 0x55, 0x00, 0x60, 0x00, 0x6b, 0x00, 0x76, 0x00,
+  0x81, 0x00, 0x8c, 0x00, 0x97, 0x00, 0xa2, 0x00, 0xad, 0x00, 0xb8, 0x00,
+  0xc3, 0x00, 0xce, 0x00, 0xd9, 0x00, 0xe4, 0x00, 0xef, 0x00, 0xfa, 0x00,
+  0x05, 0x01, 0x10, 0x01, 0x19, 0x01, 0x22, 0x01, 0x2b, 0x01, 0x33, 0x01,
+  0x00, 0x00, 0x14, 0x00, 0x27, 0x00, 0x3f, 0x00, 0x55, 0x00, 0x68, 0x00,
+  0x6e, 0x00, 0x74, 0x00, 0x7a, 0x00, 0x80, 0x00, 0x8a, 0x00, 0x94, 0x00,
+  0x9e, 0x00, 0xa4, 0x00, 0xad, 0x00, 0xc5, 0x00, 0xd5, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x22, 0x00, 0x31, 0x00, 0x45, 0x00, 0x4c, 0x00, 0x52, 0x00,
+  0x00, 0x00, 0x14, 0x00, 0x27, 0x00, 0x3f, 0x00, 0x48, 0x00, 0x4e, 0x00,
+  0x00, 0x00, 0x0f, 0x00, 0x1f, 0x00, 0x38, 0x00, 0x49, 0x00, 0x54, 0x00,
+  0x5f, 0x00, 0x6c, 0x00, 0x79, 0x00, 0x00, 0x00, 0x16, 0x00, 0x2c, 0x00,
+  0x41, 0x00, 0x4c, 0x00, 0x53, 0x00, 0x00, 0x00, 0x14, 0x00, 0x26, 0x00,
+  0x36, 0x00, 0x43, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x20, 0x00, 0x32, 0x00,
+  0x44, 0x00, 0x56, 0x00, 0x70, 0x00, 0x85, 0x00, 0x99, 0x00, 0xa2, 0x00,
+  0xb0, 0x00, 0x00, 0x00, 0x21, 0x00, 0x2e, 0x00, 0x3d, 0x00, 0x4d, 0x00,
+  0x5a, 0x00, 0x6f, 0x00, 0x80, 0x00, 0x98, 0x00, 0xac, 0x00, 0xbe, 0x00,
+  0xc7, 0x00, 0xd1, 0x00, 0xdb, 0x00, 0xe5, 0x00, 0xf1, 0x00, 0xfb, 0x00,
+  0x05, 0x01, 0x0e, 0x01, 0x00, 0x00, 0x0d, 0x00, 0x17, 0x00, 0x27, 0x00,
+  0x2e, 0x00, 0x37, 0x00, 0x3e, 0x00, 0x48, 0x00, 0x52, 0x00, 0x5a, 0x00,
+  0x62, 0x00, 0x6b, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x16, 0x00,
+  0x23, 0x00, 0x36, 0x00, 0x41, 0x00, 0x48, 0x00, 0x52, 0x00, 0x5c, 0x00,
+  0x66, 0x00, 0x70, 0x00, 0x7a, 0x00, 0x84, 0x00, 0x8e, 0x00, 0x95, 0x00,
+  0x9e, 0x00, 0xa5, 0x00, 0xac, 0x00, 0xb3, 0x00, 0xb9, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x1d, 0x00, 0x28, 0x00, 0x36, 0x00, 0x49, 0x00, 0x51, 0x00,
+  0x5a, 0x00, 0x63, 0x00, 0x6c, 0x00, 0x74, 0x00, 0x7c, 0x00, 0x84, 0x00,
+  0x8c, 0x00, 0x94, 0x00, 0x9c, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x1c, 0x00,
+  0x2e, 0x00, 0x3c, 0x00, 0x4c, 0x00, 0x5e, 0x00, 0x71, 0x00, 0x7a, 0x00,
+  0x83, 0x00, 0x8c, 0x00, 0x95, 0x00, 0x9e, 0x00, 0xa7, 0x00, 0xb0, 0x00,
+  0xba, 0x00, 0xc3, 0x00, 0xcc, 0x00, 0x00, 0x00, 0x14, 0x00, 0x24, 0x00,
+  0x36, 0x00, 0x42, 0x00, 0x59, 0x00, 0x61, 0x00, 0x68, 0x00, 0x6f, 0x00,
+  0x00, 0x00, 0x0f, 0x00, 0x26, 0x00, 0x38, 0x00, 0x47, 0x00, 0x58, 0x00,
+  0x6c, 0x00, 0x7e, 0x00, 0x85, 0x00, 0x8c, 0x00, 0x96, 0x00, 0x9d, 0x00,
+  0xa4, 0x00, 0xb0, 0x00, 0x00, 0x00, 0x18, 0x00, 0x30, 0x00, 0x43, 0x00,
+  0x53, 0x00, 0x60, 0x00, 0x7a, 0x00, 0x95, 0x00, 0xaf, 0x00, 0xc8, 0x00,
+  0xe0, 0x00, 0xf8, 0x00, 0x0f, 0x01, 0x27, 0x01, 0x3e, 0x01, 0x56, 0x01,
+  0x71, 0x01, 0x8a, 0x01, 0xa2, 0x01, 0xb7, 0x01, 0xcd, 0x01, 0xe2, 0x01,
+  0xf6, 0x01, 0x08, 0x02, 0x1b, 0x02, 0x26, 0x02, 0x31, 0x02, 0x3c, 0x02,
+  0x47, 0x02, 0x52, 0x02, 0x5d, 0x02, 0x68, 0x02, 0x73, 0x02, 0x7e, 0x02,
+  0x89, 0x02, 0x91, 0x02, 0x99, 0x02, 0xa1, 0x02, 0xa9, 0x02, 0xb1, 0x02,
+  0xb9, 0x02, 0xc1, 0x02, 0xc7, 0x02, 0xcf, 0x02, 0xd7, 0x02, 0xdf, 0x02,
+  0xe7, 0x02, 0x00, 0x00, 0x0f, 0x00, 0x23, 0x00, 0x36, 0x00, 0x48, 0x00,
+  0x5c, 0x00, 0x70, 0x00, 0x7c, 0x00, 0x88, 0x00, 0x94, 0x00, 0xa0, 0x00,
+  0xac, 0x00, 0xb8, 0x00, 0xc4, 0x00, 0xd0, 0x00, 0xdc, 0x00, 0xe8, 0x00,
+  0xf4, 0x00, 0x00, 0x01, 0x0c, 0x01, 0x18, 0x01, 0x24, 0x01, 0x30, 0x01,
+  0x3c, 0x01, 0x48, 0x01, 0x54, 0x01, 0x60, 0x01, 0x6c, 0x01, 0x78, 0x01,
+  0x84, 0x01, 0x90, 0x01, 0x9c, 0x01, 0xa8, 0x01, 0xb4, 0x01, 0xc0, 0x01,
+  0xcc, 0x01, 0xd8, 0x01, 0xe4, 0x01, 0xf0, 0x01, 0xfc, 0x01, 0x08, 0x02,
+  0x14, 0x02, 0x20, 0x02, 0x2c, 0x02, 0x38, 0x02, 0x44, 0x02, 0x50, 0x02,
+  0x5c, 0x02, 0x68, 0x02, 0x74, 0x02, 0x80, 0x02, 0x8c, 0x02, 0x98, 0x02,
+  0xa4, 0x02, 0xb0, 0x02, 0xbc, 0x02, 0xc8, 0x02, 0xd4, 0x02, 0xe0, 0x02,
+  0xec, 0x02, 0xf8, 0x02, 0x04, 0x03, 0x10, 0x03, 0x1c, 0x03, 0x28, 0x03,
+  0x34, 0x03, 0x40, 0x03, 0x4c, 0x03, 0x53, 0x03, 0x5e, 0x03, 0x6a, 0x03,
+  0x74, 0x03, 0x00, 0x00, 0x12, 0x00, 0x22, 0x00, 0x32, 0x00, 0x42, 0x00,
+  0x4d, 0x00, 0x56, 0x00, 0x00, 0x00, 0x17, 0x00, 0x28, 0x00, 0x35, 0x00,
+  0x4a, 0x00, 0x5e, 0x00, 0x72, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x1d, 0x00,
+  0x31, 0x00, 0x44, 0x00, 0x57, 0x00, 0x6a, 0x00, 0x7f, 0x00, 0x94, 0x00,
+  0xa3, 0x00, 0xad, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x16, 0x00, 0x20, 0x00,
+  0x00, 0x00, 0x11, 0x00, 0x1b, 0x00, 0x2d, 0x00, 0x3f, 0x00, 0x52, 0x00,
+  0x61, 0x00, 0x74, 0x00, 0x86, 0x00, 0x98, 0x00, 0xab, 0x00, 0xbe, 0x00,
+  0xd0, 0x00, 0xe2, 0x00, 0xf5, 0x00, 0xfe, 0x00, 0x07, 0x01, 0x10, 0x01,
+  0x19, 0x01, 0x22, 0x01, 0x2b, 0x01, 0x35, 0x01, 0x42, 0x01, 0x4b, 0x01,
+  0x54, 0x01, 0x5d, 0x01, 0x66, 0x01, 0x6f, 0x01, 0x78, 0x01, 0x81, 0x01,
+  0x8a, 0x01, 0x93, 0x01, 0x9c, 0x01, 0xa5, 0x01, 0xaf, 0x01, 0xb9, 0x01,
+  0xc2, 0x01, 0xcb, 0x01, 0xd4, 0x01, 0xde, 0x01, 0xe8, 0x01, 0xf1, 0x01,
+  0xfa, 0x01, 0x03, 0x02, 0x0c, 0x02, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00,
+  0x24, 0x00, 0x35, 0x00, 0x45, 0x00, 0x5b, 0x00, 0x70, 0x00, 0x88, 0x00,
+  0xa1, 0x00, 0xb9, 0x00, 0xd0, 0x00, 0xe6, 0x00, 0xfc, 0x00, 0x11, 0x01,
+  0x27, 0x01, 0x3c, 0x01, 0x52, 0x01, 0x6b, 0x01, 0x82, 0x01, 0x98, 0x01,
+  0xaa, 0x01, 0xb7, 0x01, 0xc8, 0x01, 0xd7, 0x01, 0xe1, 0x01, 0xeb, 0x01,
+  0xf4, 0x01, 0xfd, 0x01, 0x04, 0x02, 0x0d, 0x02, 0x16, 0x02, 0x00, 0x00,
+  0x17, 0x00, 0x22, 0x00, 0x2e, 0x00, 0x47, 0x00, 0x5f, 0x00, 0x7a, 0x00,
+  0x93, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x1f, 0x00, 0x32, 0x00, 0x39, 0x00,
+  0x47, 0x00, 0x00, 0x00, 0x20, 0x00, 0x34, 0x00, 0x48, 0x00, 0x59, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x1f, 0x00, 0x2c, 0x00, 0x35, 0x00, 0x3e, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x18, 0x00, 0x23, 0x00, 0x30, 0x00, 0x3d, 0x00,
+  0x51, 0x00, 0x5a, 0x00, 0x61, 0x00, 0x68, 0x00, 0x6f, 0x00, 0x76, 0x00,
+  0x7d, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x34, 0x00, 0x4d, 0x00, 0x58, 0x00,
+  0x61, 0x00, 0x6b, 0x00, 0x71, 0x00, 0x77, 0x00, 0x7d, 0x00, 0x00, 0x00,
+  0x1f, 0x00, 0x35, 0x00, 0x4e, 0x00, 0x64, 0x00, 0x79, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x21, 0x00, 0x34, 0x00, 0x3e, 0x00, 0x48, 0x00, 0x52, 0x00,
+  0x5c, 0x00, 0x66, 0x00, 0x70, 0x00, 0x7a, 0x00, 0x84, 0x00, 0x8e, 0x00,
+  0x98, 0x00, 0xa2, 0x00, 0xac, 0x00, 0xb6, 0x00, 0xc0, 0x00, 0xca, 0x00,
+  0xd4, 0x00, 0xde, 0x00, 0xe8, 0x00, 0xf2, 0x00, 0xfc, 0x00, 0x06, 0x01,
+  0x10, 0x01, 0x1a, 0x01, 0x24, 0x01, 0x2e, 0x01, 0x38, 0x01, 0x42, 0x01,
+  0x4c, 0x01, 0x56, 0x01, 0x60, 0x01, 0x6a, 0x01, 0x74, 0x01, 0x7e, 0x01,
+  0x88, 0x01, 0x92, 0x01, 0x9c, 0x01, 0xa6, 0x01, 0xb0, 0x01, 0xba, 0x01,
+  0xc4, 0x01, 0xce, 0x01, 0xd8, 0x01, 0xe2, 0x01, 0xec, 0x01, 0xf6, 0x01,
+  0x00, 0x02, 0x0a, 0x02, 0x14, 0x02, 0x1e, 0x02, 0x29, 0x02, 0x34, 0x02,
+  0x3d, 0x02, 0x00, 0x00, 0x0b, 0x00, 0x17, 0x00, 0x2e, 0x00, 0x41, 0x00,
+  0x5b, 0x00, 0x6d, 0x00, 0x7e, 0x00, 0x89, 0x00, 0x94, 0x00, 0x9f, 0x00,
+  0xaa, 0x00, 0xb5, 0x00, 0xc0, 0x00, 0xcb, 0x00, 0xd6, 0x00, 0xe1, 0x00,
+  0xec, 0x00, 0xf7, 0x00, 0x02, 0x01, 0x0d, 0x01, 0x18, 0x01, 0x23, 0x01,
+  0x2e, 0x01, 0x39, 0x01, 0x44, 0x01, 0x4f, 0x01, 0x5a, 0x01, 0x65, 0x01,
+  0x70, 0x01, 0x7b, 0x01, 0x86, 0x01, 0x91, 0x01, 0x9c, 0x01, 0xa7, 0x01,
+  0xb4, 0x01, 0xbf, 0x01, 0xca, 0x01, 0xd5, 0x01, 0xe0, 0x01, 0xeb, 0x01,
+  0xf6, 0x01, 0x01, 0x02, 0x0c, 0x02, 0x17, 0x02, 0x22, 0x02, 0x2d, 0x02,
+  0x38, 0x02, 0x43, 0x02, 0x4e, 0x02, 0x59, 0x02, 0x64, 0x02, 0x6f, 0x02,
+  0x7a, 0x02, 0x85, 0x02, 0x90, 0x02, 0x9b, 0x02, 0xa6, 0x02, 0xb1, 0x02,
+  0xbc, 0x02, 0xc7, 0x02, 0xd2, 0x02, 0xdd, 0x02, 0xe8, 0x02, 0xf3, 0x02,
+  0xfe, 0x02, 0x09, 0x03, 0x14, 0x03, 0x1f, 0x03, 0x2a, 0x03, 0x35, 0x03,
+  0x40, 0x03, 0x4b, 0x03, 0x56, 0x03, 0x61, 0x03, 0x6c, 0x03, 0x77, 0x03,
+  0x82, 0x03, 0x8d, 0x03, 0x98, 0x03, 0xa3, 0x03, 0xae, 0x03, 0xb9, 0x03,
+  0xc4, 0x03, 0xcf, 0x03, 0xda, 0x03, 0xe5, 0x03, 0xf0, 0x03, 0xfb, 0x03,
+  0x06, 0x04, 0x11, 0x04, 0x1c, 0x04, 0x27, 0x04, 0x32, 0x04, 0x3d, 0x04,
+  0x48, 0x04, 0x53, 0x04, 0x5e, 0x04, 0x69, 0x04, 0x74, 0x04, 0x7f, 0x04,
+  0x87, 0x04, 0x8e, 0x04, 0x95, 0x04, 0x9c, 0x04, 0x00, 0x00, 0x11, 0x00,
+  0x1b, 0x00, 0x26, 0x00, 0x2c, 0x00, 0x32, 0x00, 0x3c, 0x00, 0x4a, 0x00,
+  0x00, 0x00, 0x14, 0x00, 0x28, 0x00, 0x3a, 0x00, 0x46, 0x00, 0x4f, 0x00,
+  0x00, 0x00, 0x1a, 0x00, 0x33, 0x00, 0x3f, 0x00, 0x4c, 0x00, 0x58, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x22, 0x00, 0x2d, 0x00, 0x36, 0x00, 0x3f, 0x00,
+  0x49, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x17, 0x00, 0x25, 0x00, 0x2c, 0x00,
+  0x37, 0x00, 0x42, 0x00, 0x48, 0x00, 0x4e, 0x00, 0x55, 0x00, 0x5b, 0x00,
+  0x62, 0x00, 0x00, 0x00, 0x19, 0x00, 0x31, 0x00, 0x3e, 0x00, 0x47, 0x00,
+  0x51, 0x00, 0x00, 0x00, 0x10, 0x00, 0x21, 0x00, 0x32, 0x00, 0x44, 0x00,
+  0x56, 0x00, 0x68, 0x00, 0x7a, 0x00, 0x8c, 0x00, 0x9e, 0x00, 0xb0, 0x00,
+  0xc7, 0x00, 0xde, 0x00, 0xf2, 0x00, 0x0f, 0x01, 0x2a, 0x01, 0x38, 0x01,
+  0x41, 0x01, 0x4a, 0x01, 0x53, 0x01, 0x5c, 0x01, 0x65, 0x01, 0x6e, 0x01,
+  0x78, 0x01, 0x81, 0x01, 0x8a, 0x01, 0x93, 0x01, 0x00, 0x00, 0x11, 0x00,
+  0x1b, 0x00, 0x25, 0x00, 0x00, 0x00, 0x26, 0x00, 0x33, 0x00, 0x49, 0x00,
+  0x60, 0x00, 0x76, 0x00, 0x8b, 0x00, 0x9f, 0x00, 0xb3, 0x00, 0xc6, 0x00,
+  0xda, 0x00, 0xed, 0x00, 0x01, 0x01, 0x18, 0x01, 0x2d, 0x01, 0x41, 0x01,
+  0x59, 0x01, 0x76, 0x01, 0x91, 0x01, 0x99, 0x01, 0xa1, 0x01, 0xae, 0x01,
+  0xbb, 0x01, 0xc4, 0x01, 0xcc, 0x01, 0xd6, 0x01, 0x00, 0x00, 0x26, 0x00,
+  0x31, 0x00, 0x3c, 0x00, 0x52, 0x00, 0x66, 0x00, 0x70, 0x00, 0x7a, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x1c, 0x00, 0x2b, 0x00, 0x39, 0x00, 0x49, 0x00,
+  0x57, 0x00, 0x6b, 0x00, 0x7a, 0x00, 0x98, 0x00, 0xa4, 0x00, 0xac, 0x00,
+  0xb4, 0x00, 0xbc, 0x00, 0xc4, 0x00, 0xcc, 0x00, 0xd4, 0x00, 0xdc, 0x00,
+  0xe4, 0x00, 0xed, 0x00, 0xf6, 0x00, 0xff, 0x00, 0x08, 0x01, 0x11, 0x01,
+  0x1a, 0x01, 0x23, 0x01, 0x2d, 0x01, 0x34, 0x01, 0x3c, 0x01, 0x44, 0x01,
+  0x4d, 0x01, 0x55, 0x01, 0x5d, 0x01, 0x65, 0x01, 0x6d, 0x01, 0x76, 0x01,
+  0x7e, 0x01, 0x86, 0x01, 0x8e, 0x01, 0x96, 0x01, 0x9e, 0x01, 0xa7, 0x01,
+  0xaf, 0x01, 0xb7, 0x01, 0xbf, 0x01, 0xc7, 0x01, 0xcf, 0x01, 0xd7, 0x01,
+  0x00, 0x00, 0x14, 0x00, 0x26, 0x00, 0x3b, 0x00, 0x46, 0x00, 0x4f, 0x00,
+  0x00, 0x00, 0x0f, 0x00, 0x22, 0x00, 0x35, 0x00, 0x48, 0x00, 0x5a, 0x00,
+  0x00, 0x00, 0x19, 0x00, 0x24, 0x00, 0x2f, 0x00, 0x36, 0x00, 0x3d, 0x00,
+  0x4a, 0x00, 0x54, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1e, 0x00, 0x29, 0x00,
+  0x34, 0x00, 0x3f, 0x00, 0x47, 0x00, 0x4f, 0x00, 0x57, 0x00, 0x5e, 0x00,
+  0x66, 0x00, 0x6e, 0x00, 0x76, 0x00, 0x7e, 0x00, 0x86, 0x00, 0x8e, 0x00,
+  0x96, 0x00, 0xa0, 0x00, 0xa8, 0x00, 0xb1, 0x00, 0xb9, 0x00, 0xc1, 0x00,
+  0xc9, 0x00, 0xd1, 0x00, 0xd9, 0x00, 0xe1, 0x00, 0xe9, 0x00, 0xf2, 0x00,
+  0xfb, 0x00, 0x03, 0x01, 0x0b, 0x01, 0x14, 0x01, 0x1c, 0x01, 0x24, 0x01,
+  0x2c, 0x01, 0x35, 0x01, 0x3d, 0x01, 0x45, 0x01, 0x4d, 0x01, 0x55, 0x01,
+  0x5e, 0x01, 0x66, 0x01, 0x70, 0x01, 0x79, 0x01, 0x83, 0x01, 0x8b, 0x01,
+  0x00, 0x00, 0x12, 0x00, 0x2d, 0x00, 0x41, 0x00, 0x53, 0x00, 0x67, 0x00,
+  0x70, 0x00, 0x00, 0x00, 0x16, 0x00, 0x2a, 0x00, 0x40, 0x00, 0x4b, 0x00,
+  0x55, 0x00, 0x5f, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x13, 0x00, 0x25, 0x00,
+  0x2f, 0x00, 0x38, 0x00, 0x00, 0x00, 0x12, 0x00, 0x2d, 0x00, 0x40, 0x00,
+  0x49, 0x00, 0x52, 0x00, 0x58, 0x00, 0x64, 0x00, 0x6d, 0x00, 0x77, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x11, 0x00, 0x2b, 0x00, 0x46, 0x00, 0x60, 0x00,
+  0x79, 0x00, 0x91, 0x00, 0xa9, 0x00, 0xc0, 0x00, 0xd8, 0x00, 0xef, 0x00,
+  0x07, 0x01, 0x22, 0x01, 0x3b, 0x01, 0x53, 0x01, 0x6b, 0x01, 0x82, 0x01,
+  0x98, 0x01, 0xae, 0x01, 0xba, 0x01, 0xc6, 0x01, 0x00, 0x00, 0x12, 0x00,
+  0x25, 0x00, 0x38, 0x00, 0x4a, 0x00, 0x5d, 0x00, 0x6f, 0x00, 0x81, 0x00,
+  0x93, 0x00, 0xa5, 0x00, 0xb8, 0x00, 0xca, 0x00, 0xdd, 0x00, 0xf0, 0x00,
+  0x03, 0x01, 0x15, 0x01, 0x2e, 0x01, 0x46, 0x01, 0x5d, 0x01, 0x66, 0x01,
+  0x6f, 0x01, 0x78, 0x01, 0x81, 0x01, 0x8a, 0x01, 0x93, 0x01, 0x9c, 0x01,
+  0xa5, 0x01, 0xae, 0x01, 0xb9, 0x01, 0xc2, 0x01, 0xcb, 0x01, 0xd4, 0x01,
+  0xdd, 0x01, 0xe6, 0x01, 0xef, 0x01, 0xf8, 0x01, 0x01, 0x02, 0x0a, 0x02,
+  0x13, 0x02, 0x1c, 0x02, 0x25, 0x02, 0x2e, 0x02, 0x37, 0x02, 0x40, 0x02,
+  0x49, 0x02, 0x52, 0x02, 0x5c, 0x02, 0x66, 0x02, 0x70, 0x02, 0x7a, 0x02,
+  0x84, 0x02, 0x8d, 0x02, 0x00, 0x00, 0x0c, 0x00, 0x26, 0x00, 0x3e, 0x00,
+  0x45, 0x00, 0x4c, 0x00, 0x56, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x20, 0x00, 0x32, 0x00, 0x43, 0x00, 0x56, 0x00, 0x6d, 0x00, 0x78, 0x00,
+  0x83, 0x00, 0x8c, 0x00, 0x97, 0x00, 0xa1, 0x00, 0xaa, 0x00, 0xb3, 0x00,
+  0xbc, 0x00, 0xc5, 0x00, 0xce, 0x00, 0xd7, 0x00, 0xe0, 0x00, 0xea, 0x00,
+  0xf3, 0x00, 0xfc, 0x00, 0x05, 0x01, 0x0e, 0x01, 0x00, 0x00, 0x0f, 0x00,
+  0x1f, 0x00, 0x2f, 0x00, 0x46, 0x00, 0x5b, 0x00, 0x64, 0x00, 0x6b, 0x00,
+  0x72, 0x00, 0x79, 0x00, 0x7f, 0x00, 0x85, 0x00, 0x93, 0x00, 0x99, 0x00,
+  0x00, 0x00, 0x17, 0x00, 0x2c, 0x00, 0x38, 0x00, 0x44, 0x00, 0x4a, 0x00,
+  0x53, 0x00, 0x59, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x26, 0x00, 0x43, 0x00,
+  0x5f, 0x00, 0x7a, 0x00, 0x94, 0x00, 0xae, 0x00, 0xc7, 0x00, 0xe1, 0x00,
+  0xfa, 0x00, 0x14, 0x01, 0x31, 0x01, 0x4c, 0x01, 0x66, 0x01, 0x77, 0x01,
+  0x7f, 0x01, 0x86, 0x01, 0x8d, 0x01, 0x00, 0x00, 0x11, 0x00, 0x1b, 0x00,
+  0x25, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x25, 0x00, 0x2c, 0x00, 0x36, 0x00,
+  0x3e, 0x00, 0x47, 0x00, 0x53, 0x00, 0x5a, 0x00, 0x62, 0x00, 0x6a, 0x00,
+  0x76, 0x00, 0x7f, 0x00, 0x88, 0x00, 0x90, 0x00, 0x00, 0x00, 0x19, 0x00,
+  0x32, 0x00, 0x39, 0x00, 0x40, 0x00, 0x46, 0x00, 0x4e, 0x00, 0x55, 0x00,
+  0x00, 0x00, 0x11, 0x00, 0x22, 0x00, 0x33, 0x00, 0x43, 0x00, 0x54, 0x00,
+  0x65, 0x00, 0x77, 0x00, 0x89, 0x00, 0x9b, 0x00, 0xbc, 0x00, 0xdb, 0x00,
+  0xef, 0x00, 0x01, 0x01, 0x0a, 0x01, 0x16, 0x01, 0x1f, 0x01, 0x29, 0x01,
+  0x33, 0x01, 0x3c, 0x01, 0x45, 0x01, 0x4e, 0x01, 0x57, 0x01, 0x00, 0x00,
+  0x12, 0x00, 0x27, 0x00, 0x3b, 0x00, 0x49, 0x00, 0x55, 0x00, 0x5c, 0x00,
+  0x63, 0x00, 0x6a, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x26, 0x00, 0x3e, 0x00,
+  0x59, 0x00, 0x75, 0x00, 0x90, 0x00, 0xaa, 0x00, 0xc3, 0x00, 0xdc, 0x00,
+  0xf4, 0x00, 0x0d, 0x01, 0x25, 0x01, 0x3e, 0x01, 0x5a, 0x01, 0x74, 0x01,
+  0x8d, 0x01, 0xa0, 0x01, 0xad, 0x01, 0xba, 0x01, 0xc7, 0x01, 0xcf, 0x01,
+  0xd9, 0x01, 0xe1, 0x01, 0xe8, 0x01, 0xef, 0x01, 0xf7, 0x01, 0xfe, 0x01,
+  0x00, 0x00, 0x19, 0x00, 0x2b, 0x00, 0x33, 0x00, 0x3b, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x1e, 0x00, 0x2f, 0x00, 0x3d, 0x00, 0x46, 0x00, 0x52, 0x00,
+  0x5b, 0x00, 0x64, 0x00, 0x6d, 0x00, 0x76, 0x00, 0x7f, 0x00, 0x88, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x1d, 0x00, 0x2d, 0x00, 0x36, 0x00, 0x3d, 0x00,
+  0x46, 0x00, 0x50, 0x00, 0x56, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x19, 0x00,
+  0x2e, 0x00, 0x42, 0x00, 0x56, 0x00, 0x73, 0x00, 0x81, 0x00, 0x8e, 0x00,
+  0x97, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x34, 0x00, 0x5a, 0x00, 0x6c, 0x00,
+  0x76, 0x00, 0x7d, 0x00, 0x83, 0x00, 0x00, 0x00, 0x16, 0x00, 0x2b, 0x00,
+  0x43, 0x00, 0x5c, 0x00, 0x74, 0x00, 0x8b, 0x00, 0xa1, 0x00, 0xb7, 0x00,
+  0xcc, 0x00, 0xe2, 0x00, 0xf7, 0x00, 0x0d, 0x01, 0x26, 0x01, 0x3d, 0x01,
+  0x53, 0x01, 0x67, 0x01, 0x79, 0x01, 0x86, 0x01, 0x8f, 0x01, 0x00, 0x00,
+  0x0b, 0x00, 0x14, 0x00, 0x1f, 0x00, 0x28, 0x00, 0x31, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x1e, 0x00, 0x2e, 0x00, 0x38, 0x00, 0x42, 0x00, 0x4b, 0x00,
+  0x52, 0x00, 0x58, 0x00, 0x61, 0x00, 0x00, 0x00, 0x12, 0x00, 0x25, 0x00,
+  0x37, 0x00, 0x40, 0x00, 0x49, 0x00, 0x54, 0x00, 0x5d, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x13, 0x00, 0x1a, 0x00, 0x21, 0x00, 0x28, 0x00, 0x2e, 0x00,
+  0x3a, 0x00, 0x41, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1c, 0x00, 0x29, 0x00,
+  0x38, 0x00, 0x46, 0x00, 0x53, 0x00, 0x62, 0x00, 0x6c, 0x00, 0x74, 0x00,
+  0x7c, 0x00, 0x87, 0x00, 0x8f, 0x00, 0x97, 0x00, 0x9f, 0x00, 0xa7, 0x00,
+  0xae, 0x00, 0xb6, 0x00, 0xbe, 0x00, 0xc6, 0x00, 0xce, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x20, 0x00, 0x2e, 0x00, 0x40, 0x00, 0x51, 0x00, 0x5a, 0x00,
+  0x63, 0x00, 0x6c, 0x00, 0x75, 0x00, 0x7e, 0x00, 0x87, 0x00, 0x90, 0x00,
+  0x99, 0x00, 0xa2, 0x00, 0xab, 0x00, 0xb5, 0x00, 0xbe, 0x00, 0xc7, 0x00,
+  0xd0, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x16, 0x00, 0x26, 0x00, 0x2e, 0x00,
+  0x35, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x13, 0x00, 0x28, 0x00, 0x3e, 0x00,
+  0x4a, 0x00, 0x52, 0x00, 0x5a, 0x00, 0x66, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x1f, 0x00, 0x31, 0x00, 0x39, 0x00, 0x43, 0x00, 0x4b, 0x00, 0x53, 0x00,
+  0x5b, 0x00, 0x63, 0x00, 0x70, 0x00, 0x77, 0x00, 0x7f, 0x00, 0x87, 0x00,
+  0x92, 0x00, 0x9a, 0x00, 0xa2, 0x00, 0xaa, 0x00, 0xb2, 0x00, 0xb8, 0x00,
+  0xc1, 0x00, 0xc9, 0x00, 0xd1, 0x00, 0x00, 0x00, 0x10, 0x00, 0x22, 0x00,
+  0x3d, 0x00, 0x4c, 0x00, 0x55, 0x00, 0x5e, 0x00, 0x68, 0x00, 0x71, 0x00,
+  0x7a, 0x00, 0x83, 0x00, 0x8c, 0x00, 0x95, 0x00, 0x9e, 0x00, 0xa7, 0x00,
+  0xb0, 0x00, 0xb9, 0x00, 0x00, 0x00, 0x09, 0x00, 0x18, 0x00, 0x2a, 0x00,
+  0x42, 0x00, 0x4b, 0x00, 0x54, 0x00, 0x5e, 0x00, 0x68, 0x00, 0x72, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x20, 0x00, 0x2e, 0x00, 0x3e, 0x00, 0x52, 0x00,
+  0x65, 0x00, 0x79, 0x00, 0x8d, 0x00, 0xa1, 0x00, 0xae, 0x00, 0xb7, 0x00,
+  0xbf, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x1b, 0x00, 0x29, 0x00, 0x37, 0x00,
+  0x45, 0x00, 0x53, 0x00, 0x61, 0x00, 0x6f, 0x00, 0x7d, 0x00, 0x8b, 0x00,
+  0x99, 0x00, 0xa7, 0x00, 0xb5, 0x00, 0xc3, 0x00, 0xd1, 0x00, 0xdf, 0x00,
+  0xed, 0x00, 0xfb, 0x00, 0x09, 0x01, 0x17, 0x01, 0x25, 0x01, 0x33, 0x01,
+  0x41, 0x01, 0x4f, 0x01, 0x5d, 0x01, 0x6b, 0x01, 0x79, 0x01, 0x87, 0x01,
+  0x95, 0x01, 0xa3, 0x01, 0xb1, 0x01, 0xbf, 0x01, 0xcd, 0x01, 0xdb, 0x01,
+  0xe9, 0x01, 0xf7, 0x01, 0x05, 0x02, 0x13, 0x02, 0x21, 0x02, 0x2f, 0x02,
+  0x3d, 0x02, 0x4b, 0x02, 0x59, 0x02, 0x67, 0x02, 0x75, 0x02, 0x83, 0x02,
+  0x91, 0x02, 0x9f, 0x02, 0xad, 0x02, 0xbb, 0x02, 0xc9, 0x02, 0xd7, 0x02,
+  0xe5, 0x02, 0xf3, 0x02, 0x01, 0x03, 0x0f, 0x03, 0x1d, 0x03, 0x2b, 0x03,
+  0x39, 0x03, 0x47, 0x03, 0x55, 0x03, 0x63, 0x03, 0x71, 0x03, 0x7f, 0x03,
+  0x8d, 0x03, 0x9b, 0x03, 0xa5, 0x03, 0xae, 0x03, 0xb8, 0x03, 0x00, 0x00,
+  0x15, 0x00, 0x2a, 0x00, 0x3a, 0x00, 0x53, 0x00, 0x69, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x22, 0x00, 0x3a, 0x00, 0x43, 0x00, 0x4c, 0x00, 0x56, 0x00,
+  0x60, 0x00, 0x69, 0x00, 0x72, 0x00, 0x7b, 0x00, 0x84, 0x00, 0x8d, 0x00,
+  0x96, 0x00, 0x9f, 0x00, 0xa9, 0x00, 0xb2, 0x00, 0xb9, 0x00, 0xc2, 0x00,
+  0x00, 0x00, 0x1b, 0x00, 0x34, 0x00, 0x00, 0x00, 0x11, 0x00, 0x21, 0x00,
+  0x31, 0x00, 0x42, 0x00, 0x52, 0x00, 0x62, 0x00, 0x73, 0x00, 0x89, 0x00,
+  0xa0, 0x00, 0xb7, 0x00, 0xcf, 0x00, 0xe0, 0x00, 0xf7, 0x00, 0x03, 0x01,
+  0x0f, 0x01, 0x1a, 0x01, 0x25, 0x01, 0x2d, 0x01, 0x35, 0x01, 0x3d, 0x01,
+  0x45, 0x01, 0x4d, 0x01, 0x55, 0x01, 0x5e, 0x01, 0x69, 0x01, 0x75, 0x01,
+  0x80, 0x01, 0x8b, 0x01, 0x94, 0x01, 0x9f, 0x01, 0xa8, 0x01, 0xb1, 0x01,
+  0xba, 0x01, 0xc3, 0x01, 0xce, 0x01, 0xd9, 0x01, 0xe4, 0x01, 0xef, 0x01,
+  0x00, 0x00, 0x29, 0x00, 0x3b, 0x00, 0x48, 0x00, 0x59, 0x00, 0x6d, 0x00,
+  0x81, 0x00, 0x95, 0x00, 0x9e, 0x00, 0xa9, 0x00, 0xb3, 0x00, 0xbc, 0x00,
+  0xc5, 0x00, 0xd3, 0x00, 0x00, 0x00, 0x12, 0x00, 0x1f, 0x00, 0x31, 0x00,
+  0x3c, 0x00, 0x4d, 0x00, 0x56, 0x00, 0x60, 0x00, 0x6c, 0x00, 0x75, 0x00,
+  0x7b, 0x00, 0x82, 0x00, 0x8b, 0x00, 0x94, 0x00, 0x9a, 0x00, 0xa7, 0x00,
+  0x00, 0x00, 0x1c, 0x00, 0x37, 0x00, 0x40, 0x00, 0x4b, 0x00, 0x56, 0x00,
+  0x61, 0x00, 0x6c, 0x00, 0x78, 0x00, 0x81, 0x00, 0x8b, 0x00, 0x9b, 0x00,
+  0xaa, 0x00, 0xb6, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x2c, 0x00, 0x3b, 0x00,
+  0x51, 0x00, 0x65, 0x00, 0x00, 0x00, 0x10, 0x00, 0x1d, 0x00, 0x2b, 0x00,
+  0x38, 0x00, 0x45, 0x00, 0x5a, 0x00, 0x6f, 0x00, 0x83, 0x00, 0x98, 0x00,
+  0xad, 0x00, 0xc1, 0x00, 0xda, 0x00, 0xef, 0x00, 0x01, 0x01, 0x13, 0x01,
+  0x24, 0x01, 0x2a, 0x01, 0x32, 0x01, 0x3a, 0x01, 0x41, 0x01, 0x48, 0x01,
+  0x4f, 0x01, 0x56, 0x01, 0x5d, 0x01, 0x64, 0x01, 0x6c, 0x01, 0x7a, 0x01,
+  0x82, 0x01, 0x89, 0x01, 0x00, 0x00, 0x10, 0x00, 0x27, 0x00, 0x40, 0x00,
+  0x56, 0x00, 0x6d, 0x00, 0x84, 0x00, 0x9d, 0x00, 0xb5, 0x00, 0xcf, 0x00,
+  0xe8, 0x00, 0x02, 0x01, 0x1c, 0x01, 0x27, 0x01, 0x33, 0x01, 0x40, 0x01,
+  0x4a, 0x01, 0x57, 0x01, 0x00, 0x00, 0x10, 0x00, 0x20, 0x00, 0x31, 0x00,
+  0x43, 0x00, 0x56, 0x00, 0x69, 0x00, 0x7a, 0x00, 0x94, 0x00, 0xae, 0x00,
+  0xb7, 0x00, 0xc0, 0x00, 0xc9, 0x00, 0xd2, 0x00, 0xdb, 0x00, 0xe5, 0x00,
+  0xef, 0x00, 0xf8, 0x00, 0x01, 0x01, 0x0c, 0x01, 0x15, 0x01, 0x1f, 0x01,
+  0x29, 0x01, 0x30, 0x01, 0x37, 0x01, 0x00, 0x00, 0x11, 0x00, 0x22, 0x00,
+  0x31, 0x00, 0x3b, 0x00, 0x42, 0x00, 0x4b, 0x00, 0x54, 0x00, 0x5d, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x2a, 0x00, 0x39, 0x00, 0x42, 0x00, 0x4a, 0x00,
+  0x52, 0x00, 0x59, 0x00, 0x60, 0x00, 0x67, 0x00, 0x6e, 0x00, 0x7c, 0x00,
+  0x88, 0x00, 0x00, 0x00, 0x12, 0x00, 0x24, 0x00, 0x32, 0x00, 0x3e, 0x00,
+  0x49, 0x00, 0x59, 0x00, 0x00, 0x00, 0x10, 0x00, 0x1c, 0x00, 0x27, 0x00,
+  0x38, 0x00, 0x47, 0x00, 0x59, 0x00, 0x6b, 0x00, 0x78, 0x00, 0x81, 0x00,
+  0x8a, 0x00, 0x93, 0x00, 0x9c, 0x00, 0xa5, 0x00, 0xae, 0x00, 0x00, 0x00,
+  0x15, 0x00, 0x29, 0x00, 0x35, 0x00, 0x44, 0x00, 0x5e, 0x00, 0x77, 0x00,
+  0x89, 0x00, 0x92, 0x00, 0x98, 0x00, 0x00, 0x00, 0x20, 0x00, 0x35, 0x00,
+  0x4a, 0x00, 0x5e, 0x00, 0x72, 0x00, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x22, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x1b, 0x00,
+  0x26, 0x00, 0x34, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1b, 0x00, 0x27, 0x00,
+  0x33, 0x00, 0x39, 0x00, 0x42, 0x00, 0x57, 0x00, 0x5f, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x1a, 0x00, 0x2c, 0x00, 0x34, 0x00, 0x3c, 0x00, 0x44, 0x00,
+  0x4c, 0x00, 0x54, 0x00, 0x5b, 0x00, 0x62, 0x00, 0x69, 0x00, 0x70, 0x00,
+  0x79, 0x00, 0x82, 0x00, 0x00, 0x00, 0x10, 0x00, 0x2a, 0x00, 0x35, 0x00,
+  0x3c, 0x00, 0x46, 0x00, 0x4d, 0x00, 0x54, 0x00, 0x5b, 0x00, 0x62, 0x00,
+  0x69, 0x00, 0x00, 0x00, 0x19, 0x00, 0x30, 0x00, 0x43, 0x00, 0x54, 0x00,
+  0x5d, 0x00, 0x67, 0x00, 0x71, 0x00, 0x7b, 0x00, 0x85, 0x00, 0x8f, 0x00,
+  0x9a, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x3f, 0x00, 0x4f, 0x00, 0x5d, 0x00,
+  0x6e, 0x00, 0x7f, 0x00, 0x91, 0x00, 0xa3, 0x00, 0xb5, 0x00, 0xc7, 0x00,
+  0xd9, 0x00, 0xeb, 0x00, 0xfd, 0x00, 0x0f, 0x01, 0x21, 0x01, 0x33, 0x01,
+  0x44, 0x01, 0x55, 0x01, 0x66, 0x01, 0x7d, 0x01, 0x86, 0x01, 0x8f, 0x01,
+  0x98, 0x01, 0xa1, 0x01, 0xaa, 0x01, 0xb3, 0x01, 0xbc, 0x01, 0xc6, 0x01,
+  0xd0, 0x01, 0xda, 0x01, 0xe4, 0x01, 0xee, 0x01, 0xf8, 0x01, 0x02, 0x02,
+  0x0c, 0x02, 0x16, 0x02, 0x1f, 0x02, 0x28, 0x02, 0x31, 0x02, 0x3a, 0x02,
+  0x44, 0x02, 0x4d, 0x02, 0x56, 0x02, 0x5f, 0x02, 0x68, 0x02, 0x71, 0x02,
+  0x7a, 0x02, 0x83, 0x02, 0x8c, 0x02, 0x95, 0x02, 0x9e, 0x02, 0xa7, 0x02,
+  0xb0, 0x02, 0xb9, 0x02, 0xc2, 0x02, 0xcb, 0x02, 0xd4, 0x02, 0xdd, 0x02,
+  0xe6, 0x02, 0xef, 0x02, 0xf9, 0x02, 0x02, 0x03, 0x0b, 0x03, 0x15, 0x03,
+  0x1c, 0x03, 0x25, 0x03, 0x2e, 0x03, 0x37, 0x03, 0x40, 0x03, 0x49, 0x03,
+  0x52, 0x03, 0x5b, 0x03, 0x64, 0x03, 0x6d, 0x03, 0x76, 0x03, 0x80, 0x03,
+  0x8d, 0x03, 0x00, 0x00, 0x10, 0x00, 0x1b, 0x00, 0x24, 0x00, 0x2d, 0x00,
+  0x3a, 0x00, 0x42, 0x00, 0x49, 0x00, 0x4f, 0x00, 0x00, 0x00, 0x33, 0x00,
+  0x3f, 0x00, 0x4c, 0x00, 0x5f, 0x00, 0x69, 0x00, 0x73, 0x00, 0x7f, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x23, 0x00, 0x36, 0x00, 0x49, 0x00, 0x5b, 0x00,
+  0x6f, 0x00, 0x81, 0x00, 0x8c, 0x00, 0x95, 0x00, 0x9f, 0x00, 0xa9, 0x00,
+  0xb3, 0x00, 0xbd, 0x00, 0xc7, 0x00, 0xd0, 0x00, 0xd9, 0x00, 0x00, 0x00,
+  0x31, 0x00, 0x41, 0x00, 0x52, 0x00, 0x63, 0x00, 0x73, 0x00, 0x83, 0x00,
+  0x90, 0x00, 0xa0, 0x00, 0xb9, 0x00, 0xcc, 0x00, 0xde, 0x00, 0xe8, 0x00,
+  0xf2, 0x00, 0xfc, 0x00, 0x06, 0x01, 0x0f, 0x01, 0x18, 0x01, 0x21, 0x01,
+  0x2a, 0x01, 0x33, 0x01, 0x3c, 0x01, 0x46, 0x01, 0x50, 0x01, 0x5a, 0x01,
+  0x64, 0x01, 0x71, 0x01, 0x00, 0x00, 0x16, 0x00, 0x24, 0x00, 0x35, 0x00,
+  0x47, 0x00, 0x61, 0x00, 0x79, 0x00, 0x93, 0x00, 0xab, 0x00, 0xbf, 0x00,
+  0xd1, 0x00, 0xe4, 0x00, 0xf5, 0x00, 0xfe, 0x00, 0x06, 0x01, 0x0f, 0x01,
+  0x1a, 0x01, 0x26, 0x01, 0x37, 0x01, 0x00, 0x00, 0x2e, 0x00, 0x4a, 0x00,
+  0x5b, 0x00, 0x7b, 0x00, 0x89, 0x00, 0x98, 0x00, 0xa5, 0x00, 0xb2, 0x00,
+  0xbf, 0x00, 0xcc, 0x00, 0xd9, 0x00, 0xe6, 0x00, 0xf3, 0x00, 0x00, 0x01,
+  0x0d, 0x01, 0x1a, 0x01, 0x27, 0x01, 0x34, 0x01, 0x41, 0x01, 0x4e, 0x01,
+  0x5b, 0x01, 0x68, 0x01, 0x75, 0x01, 0x82, 0x01, 0x8f, 0x01, 0x9c, 0x01,
+  0xa9, 0x01, 0xb6, 0x01, 0xc3, 0x01, 0xd0, 0x01, 0xdd, 0x01, 0xea, 0x01,
+  0xf7, 0x01, 0x04, 0x02, 0x11, 0x02, 0x1e, 0x02, 0x2b, 0x02, 0x38, 0x02,
+  0x45, 0x02, 0x52, 0x02, 0x5f, 0x02, 0x6c, 0x02, 0x79, 0x02, 0x86, 0x02,
+  0x93, 0x02, 0xa0, 0x02, 0xad, 0x02, 0xba, 0x02, 0xc7, 0x02, 0xd4, 0x02,
+  0xe1, 0x02, 0xee, 0x02, 0xfb, 0x02, 0x08, 0x03, 0x15, 0x03, 0x22, 0x03,
+  0x2f, 0x03, 0x3c, 0x03, 0x49, 0x03, 0x56, 0x03, 0x5e, 0x03, 0x66, 0x03,
+  0x71, 0x03, 0x77, 0x03, 0x00, 0x00, 0x21, 0x00, 0x41, 0x00, 0x61, 0x00,
+  0x7a, 0x00, 0x85, 0x00, 0x90, 0x00, 0x00, 0x00, 0x13, 0x00, 0x2a, 0x00,
+  0x35, 0x00, 0x40, 0x00, 0x4b, 0x00, 0x56, 0x00, 0x60, 0x00, 0x6a, 0x00,
+  0x74, 0x00, 0x7d, 0x00, 0x89, 0x00, 0x95, 0x00, 0x9d, 0x00, 0x00, 0x00,
+  0x1e, 0x00, 0x3d, 0x00, 0x5d, 0x00, 0x7c, 0x00, 0x9a, 0x00, 0xb7, 0x00,
+  0xd4, 0x00, 0xf0, 0x00, 0x0d, 0x01, 0x29, 0x01, 0x46, 0x01, 0x66, 0x01,
+  0x84, 0x01, 0xa1, 0x01, 0xb4, 0x01, 0xc7, 0x01, 0xda, 0x01, 0xed, 0x01,
+  0x00, 0x02, 0x13, 0x02, 0x1f, 0x02, 0x2b, 0x02, 0x37, 0x02, 0x3f, 0x02,
+  0x48, 0x02, 0x51, 0x02, 0x5b, 0x02, 0x62, 0x02, 0x00, 0x00, 0x0e, 0x00,
+  0x1d, 0x00, 0x2b, 0x00, 0x38, 0x00, 0x45, 0x00, 0x52, 0x00, 0x5f, 0x00,
+  0x6c, 0x00, 0x79, 0x00, 0x86, 0x00, 0x93, 0x00, 0xa0, 0x00, 0xad, 0x00,
+  0xba, 0x00, 0xc7, 0x00, 0xd4, 0x00, 0xe1, 0x00, 0xee, 0x00, 0xfb, 0x00,
+  0x08, 0x01, 0x15, 0x01, 0x22, 0x01, 0x2f, 0x01, 0x3c, 0x01, 0x49, 0x01,
+  0x56, 0x01, 0x63, 0x01, 0x70, 0x01, 0x7d, 0x01, 0x8a, 0x01, 0x97, 0x01,
+  0xa4, 0x01, 0xb1, 0x01, 0xbe, 0x01, 0xcb, 0x01, 0xd8, 0x01, 0xe5, 0x01,
+  0xf2, 0x01, 0xff, 0x01, 0x0c, 0x02, 0x19, 0x02, 0x26, 0x02, 0x33, 0x02,
+  0x40, 0x02, 0x4d, 0x02, 0x5a, 0x02, 0x67, 0x02, 0x74, 0x02, 0x81, 0x02,
+  0x8e, 0x02, 0x9b, 0x02, 0xa8, 0x02, 0xb5, 0x02, 0xc2, 0x02, 0xcf, 0x02,
+  0xdc, 0x02, 0xe9, 0x02, 0xf6, 0x02, 0x03, 0x03, 0x10, 0x03, 0x1d, 0x03,
+  0x2a, 0x03, 0x37, 0x03, 0x44, 0x03, 0x51, 0x03, 0x5e, 0x03, 0x6b, 0x03,
+  0x78, 0x03, 0x85, 0x03, 0x92, 0x03, 0x9f, 0x03, 0xac, 0x03, 0xb9, 0x03,
+  0xc6, 0x03, 0xd3, 0x03, 0xe0, 0x03, 0xea, 0x03, 0xf6, 0x03, 0x02, 0x04,
+  0x0a, 0x04, 0x12, 0x04, 0x1c, 0x04, 0x00, 0x00, 0x17, 0x00, 0x28, 0x00,
+  0x3f, 0x00, 0x54, 0x00, 0x71, 0x00, 0x8e, 0x00, 0xaa, 0x00, 0xc0, 0x00,
+  0xd7, 0x00, 0xed, 0x00, 0x04, 0x01, 0x1a, 0x01, 0x31, 0x01, 0x47, 0x01,
+  0x5d, 0x01, 0x75, 0x01, 0x8c, 0x01, 0xa4, 0x01, 0xbb, 0x01, 0xd1, 0x01,
+  0xdf, 0x01, 0xed, 0x01, 0xfb, 0x01, 0x09, 0x02, 0x17, 0x02, 0x25, 0x02,
+  0x33, 0x02, 0x41, 0x02, 0x4f, 0x02, 0x5d, 0x02, 0x6b, 0x02, 0x79, 0x02,
+  0x87, 0x02, 0x95, 0x02, 0xa3, 0x02, 0xb1, 0x02, 0xbf, 0x02, 0xcd, 0x02,
+  0xdb, 0x02, 0xe9, 0x02, 0xf7, 0x02, 0x05, 0x03, 0x13, 0x03, 0x21, 0x03,
+  0x2f, 0x03, 0x3d, 0x03, 0x4b, 0x03, 0x59, 0x03, 0x67, 0x03, 0x75, 0x03,
+  0x83, 0x03, 0x91, 0x03, 0x9f, 0x03, 0xad, 0x03, 0xbb, 0x03, 0xc9, 0x03,
+  0xd7, 0x03, 0xe5, 0x03, 0xf3, 0x03, 0xfe, 0x03, 0x07, 0x04, 0x10, 0x04,
+  0x18, 0x04, 0x20, 0x04, 0x28, 0x04, 0x31, 0x04, 0x3d, 0x04, 0x48, 0x04,
+  0x53, 0x04, 0x5e, 0x04, 0x69, 0x04, 0x74, 0x04, 0x7f, 0x04, 0x8a, 0x04,
+  0x94, 0x04, 0x9f, 0x04, 0xaa, 0x04, 0xb5, 0x04, 0xc0, 0x04, 0xcc, 0x04,
+  0x00, 0x00, 0x27, 0x00, 0x38, 0x00, 0x4f, 0x00, 0x63, 0x00, 0x72, 0x00,
+  0x8e, 0x00, 0xa3, 0x00, 0xb7, 0x00, 0xce, 0x00, 0xe3, 0x00, 0xf2, 0x00,
+  0x01, 0x01, 0x10, 0x01, 0x1f, 0x01, 0x2e, 0x01, 0x3d, 0x01, 0x4c, 0x01,
+  0x5b, 0x01, 0x6a, 0x01, 0x79, 0x01, 0x88, 0x01, 0x97, 0x01, 0xa6, 0x01,
+  0xb5, 0x01, 0xc4, 0x01, 0xd3, 0x01, 0xe2, 0x01, 0xf1, 0x01, 0x00, 0x02,
+  0x0f, 0x02, 0x1e, 0x02, 0x2d, 0x02, 0x3c, 0x02, 0x4b, 0x02, 0x5a, 0x02,
+  0x69, 0x02, 0x78, 0x02, 0x87, 0x02, 0x96, 0x02, 0xa5, 0x02, 0xb4, 0x02,
+  0xc3, 0x02, 0xd2, 0x02, 0xe1, 0x02, 0xf0, 0x02, 0xff, 0x02, 0x0e, 0x03,
+  0x1d, 0x03, 0x29, 0x03, 0x00, 0x00, 0x0f, 0x00, 0x25, 0x00, 0x36, 0x00,
+  0x47, 0x00, 0x56, 0x00, 0x65, 0x00, 0x6d, 0x00, 0x00, 0x00, 0x0d, 0x00,
+  0x1b, 0x00, 0x2f, 0x00, 0x3a, 0x00, 0x44, 0x00, 0x5d, 0x00, 0x73, 0x00,
+  0x87, 0x00, 0x9e, 0x00, 0xb3, 0x00, 0xca, 0x00, 0xe0, 0x00, 0xf8, 0x00,
+  0x0d, 0x01, 0x24, 0x01, 0x38, 0x01, 0x4f, 0x01, 0x63, 0x01, 0x70, 0x01,
+  0x7b, 0x01, 0x84, 0x01, 0x90, 0x01, 0x9b, 0x01, 0xa6, 0x01, 0xb1, 0x01,
+  0x00, 0x00, 0x10, 0x00, 0x29, 0x00, 0x3e, 0x00, 0x53, 0x00, 0x68, 0x00,
+  0x7b, 0x00, 0x90, 0x00, 0xa4, 0x00, 0xb8, 0x00, 0xc2, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x31, 0x00, 0x51, 0x00, 0x60, 0x00, 0x70, 0x00, 0x81, 0x00,
+  0x96, 0x00, 0xaa, 0x00, 0xc6, 0x00, 0xda, 0x00, 0xec, 0x00, 0x08, 0x01,
+  0x11, 0x01, 0x17, 0x01, 0x26, 0x01, 0x35, 0x01, 0x42, 0x01, 0x00, 0x00,
+  0x12, 0x00, 0x26, 0x00, 0x31, 0x00, 0x3c, 0x00, 0x48, 0x00, 0x51, 0x00,
+  0x5a, 0x00, 0x63, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x2f, 0x00, 0x3e, 0x00,
+  0x4d, 0x00, 0x61, 0x00, 0x76, 0x00, 0x8c, 0x00, 0x97, 0x00, 0x9f, 0x00,
+  0xa9, 0x00, 0xb3, 0x00, 0xbd, 0x00, 0xc6, 0x00, 0xd6, 0x00, 0xe3, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x19, 0x00, 0x33, 0x00, 0x3f, 0x00, 0x4b, 0x00,
+  0x57, 0x00, 0x63, 0x00, 0x6f, 0x00, 0x79, 0x00, 0x82, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x2f, 0x00, 0x3b, 0x00, 0x4a, 0x00, 0x64, 0x00, 0x79, 0x00,
+  0x8f, 0x00, 0xa6, 0x00, 0xbd, 0x00, 0xc8, 0x00, 0xd0, 0x00, 0xdb, 0x00,
+  0xe6, 0x00, 0xef, 0x00, 0xf6, 0x00, 0x00, 0x00, 0x22, 0x00, 0x36, 0x00,
+  0x41, 0x00, 0x53, 0x00, 0x65, 0x00, 0x82, 0x00, 0x8b, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x30, 0x00, 0x3f, 0x00, 0x54, 0x00, 0x68, 0x00, 0x7f, 0x00,
+  0x97, 0x00, 0xae, 0x00, 0xc4, 0x00, 0xd9, 0x00, 0xee, 0x00, 0x02, 0x01,
+  0x17, 0x01, 0x2b, 0x01, 0x40, 0x01, 0x58, 0x01, 0x6e, 0x01, 0x84, 0x01,
+  0x99, 0x01, 0xaa, 0x01, 0xb4, 0x01, 0x00, 0x00, 0x17, 0x00, 0x21, 0x00,
+  0x2b, 0x00, 0x36, 0x00, 0x42, 0x00, 0x55, 0x00, 0x68, 0x00, 0x7b, 0x00,
+  0x94, 0x00, 0xab, 0x00, 0xc1, 0x00, 0xd6, 0x00, 0xf4, 0x00, 0x10, 0x01,
+  0x25, 0x01, 0x38, 0x01, 0x44, 0x01, 0x4d, 0x01, 0x56, 0x01, 0x5c, 0x01,
+  0x6b, 0x01, 0x75, 0x01, 0x7b, 0x01, 0x81, 0x01, 0x00, 0x00, 0x13, 0x00,
+  0x27, 0x00, 0x32, 0x00, 0x42, 0x00, 0x5e, 0x00, 0x78, 0x00, 0x80, 0x00,
+  0x00, 0x00, 0x1c, 0x00, 0x29, 0x00, 0x36, 0x00, 0x41, 0x00, 0x47, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x1d, 0x00, 0x2c, 0x00, 0x33, 0x00, 0x3c, 0x00,
+  0x00, 0x00, 0x11, 0x00, 0x25, 0x00, 0x3b, 0x00, 0x53, 0x00, 0x6b, 0x00,
+  0x85, 0x00, 0x91, 0x00, 0x9f, 0x00, 0xab, 0x00, 0xb7, 0x00, 0xc3, 0x00,
+  0xcf, 0x00, 0x00, 0x00, 0x18, 0x00, 0x36, 0x00, 0x4b, 0x00, 0x6a, 0x00,
+  0x89, 0x00, 0x98, 0x00, 0xac, 0x00, 0xbd, 0x00, 0xcc, 0x00, 0xd4, 0x00,
+  0xde, 0x00, 0xe7, 0x00, 0xf2, 0x00, 0xfe, 0x00, 0x0a, 0x01, 0x16, 0x01,
+  0x1d, 0x01, 0x22, 0x01, 0x27, 0x01, 0x2d, 0x01, 0x33, 0x01, 0x3e, 0x01,
+  0x00, 0x00, 0x20, 0x00, 0x3e, 0x00, 0x55, 0x00, 0x7e, 0x00, 0xa2, 0x00,
+  0xb4, 0x00, 0xc6, 0x00, 0xcf, 0x00, 0xd7, 0x00, 0xdf, 0x00, 0xe7, 0x00,
+  0xef, 0x00, 0xf6, 0x00, 0xfe, 0x00, 0x06, 0x01, 0x0f, 0x01, 0x17, 0x01,
+  0x00, 0x00, 0x21, 0x00, 0x2e, 0x00, 0x47, 0x00, 0x6d, 0x00, 0x83, 0x00,
+  0x99, 0x00, 0xae, 0x00, 0xb7, 0x00, 0xc2, 0x00, 0xce, 0x00, 0xd5, 0x00,
+  0xde, 0x00, 0xe7, 0x00, 0xee, 0x00, 0xf6, 0x00, 0x02, 0x01, 0x0f, 0x01,
+  0x1c, 0x01, 0x26, 0x01, 0x2c, 0x01, 0x00, 0x00, 0x17, 0x00, 0x2e, 0x00,
+  0x45, 0x00, 0x57, 0x00, 0x66, 0x00, 0x7c, 0x00, 0x90, 0x00, 0x97, 0x00,
+  0x9e, 0x00, 0xa9, 0x00, 0xb4, 0x00, 0xbf, 0x00, 0xca, 0x00, 0xd5, 0x00,
+  0xe2, 0x00, 0xe9, 0x00, 0xef, 0x00, 0xf8, 0x00, 0x01, 0x01, 0x17, 0x01,
+  0x00, 0x00, 0x17, 0x00, 0x30, 0x00, 0x3a, 0x00, 0x56, 0x00, 0x78, 0x00,
+  0x88, 0x00, 0x9a, 0x00, 0xac, 0x00, 0xbe, 0x00, 0xd3, 0x00, 0xe8, 0x00,
+  0xfc, 0x00, 0x0e, 0x01, 0x25, 0x01, 0x3a, 0x01, 0x4e, 0x01, 0x60, 0x01,
+  0x72, 0x01, 0x7c, 0x01, 0x84, 0x01, 0x8d, 0x01, 0x96, 0x01, 0x9e, 0x01,
+  0xa7, 0x01, 0xb3, 0x01, 0xbb, 0x01, 0xc5, 0x01, 0xce, 0x01, 0xd7, 0x01,
+  0xe0, 0x01, 0xe9, 0x01, 0xf2, 0x01, 0xfb, 0x01, 0x04, 0x02, 0x0d, 0x02,
+  0x16, 0x02, 0x1f, 0x02, 0x28, 0x02, 0x31, 0x02, 0x3a, 0x02, 0x43, 0x02,
+  0x4c, 0x02, 0x55, 0x02, 0x5e, 0x02, 0x67, 0x02, 0x70, 0x02, 0x7a, 0x02,
+  0x84, 0x02, 0x8e, 0x02, 0x97, 0x02, 0xa0, 0x02, 0xa9, 0x02, 0xb2, 0x02,
+  0xc4, 0x02, 0xd6, 0x02, 0x00, 0x00, 0x0f, 0x00, 0x1e, 0x00, 0x36, 0x00,
+  0x5f, 0x00, 0x84, 0x00, 0x8f, 0x00, 0xa1, 0x00, 0xb2, 0x00, 0xbb, 0x00,
+  0xc4, 0x00, 0xcd, 0x00, 0xd6, 0x00, 0xdf, 0x00, 0xe6, 0x00, 0xed, 0x00,
+  0xf4, 0x00, 0xff, 0x00, 0x07, 0x01, 0x0d, 0x01, 0x16, 0x01, 0x00, 0x00,
+  0x10, 0x00, 0x26, 0x00, 0x3a, 0x00, 0x57, 0x00, 0x87, 0x00, 0x9d, 0x00,
+  0xab, 0x00, 0xba, 0x00, 0xcc, 0x00, 0xde, 0x00, 0xef, 0x00, 0x02, 0x01,
+  0x13, 0x01, 0x25, 0x01, 0x37, 0x01, 0x46, 0x01, 0x57, 0x01, 0x6a, 0x01,
+  0x7b, 0x01, 0x8e, 0x01, 0x9f, 0x01, 0xa9, 0x01, 0xb2, 0x01, 0xbb, 0x01,
+  0xc3, 0x01, 0xc9, 0x01, 0xd0, 0x01, 0x00, 0x00, 0x13, 0x00, 0x24, 0x00,
+  0x36, 0x00, 0x49, 0x00, 0x71, 0x00, 0x7d, 0x00, 0x92, 0x00, 0xa8, 0x00,
+  0xc2, 0x00, 0xda, 0x00, 0xe4, 0x00, 0xee, 0x00, 0xf8, 0x00, 0x00, 0x01,
+  0x08, 0x01, 0x10, 0x01, 0x00, 0x00, 0x17, 0x00, 0x26, 0x00, 0x33, 0x00,
+  0x44, 0x00, 0x54, 0x00, 0x65, 0x00, 0x75, 0x00, 0x7f, 0x00, 0x8f, 0x00,
+  0xad, 0x00, 0xcc, 0x00, 0xea, 0x00, 0x07, 0x01, 0x23, 0x01, 0x3f, 0x01,
+  0x5a, 0x01, 0x76, 0x01, 0x91, 0x01, 0xae, 0x01, 0xca, 0x01, 0xe9, 0x01,
+  0x07, 0x02, 0x24, 0x02, 0x40, 0x02, 0x5c, 0x02, 0x75, 0x02, 0x8e, 0x02,
+  0x97, 0x02, 0x9f, 0x02, 0xa9, 0x02, 0xb2, 0x02, 0xbb, 0x02, 0xc4, 0x02,
+  0xcd, 0x02, 0xd6, 0x02, 0x00, 0x00, 0x19, 0x00, 0x28, 0x00, 0x36, 0x00,
+  0x48, 0x00, 0x55, 0x00, 0x71, 0x00, 0x78, 0x00, 0x7f, 0x00, 0x88, 0x00,
+  0x91, 0x00, 0x9a, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x26, 0x00, 0x40, 0x00,
+  0x4e, 0x00, 0x59, 0x00, 0x73, 0x00, 0x82, 0x00, 0x95, 0x00, 0xab, 0x00,
+  0xc0, 0x00, 0xd2, 0x00, 0xd9, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x2a, 0x00,
+  0x3d, 0x00, 0x4a, 0x00, 0x62, 0x00, 0x7b, 0x00, 0x92, 0x00, 0xaa, 0x00,
+  0xc2, 0x00, 0xdb, 0x00, 0xf3, 0x00, 0x01, 0x01, 0x0f, 0x01, 0x1d, 0x01,
+  0x2b, 0x01, 0x39, 0x01, 0x47, 0x01, 0x55, 0x01, 0x63, 0x01, 0x71, 0x01,
+  0x7f, 0x01, 0x8d, 0x01, 0x9b, 0x01, 0xa9, 0x01, 0xb7, 0x01, 0xc5, 0x01,
+  0xd3, 0x01, 0xe1, 0x01, 0xef, 0x01, 0xfd, 0x01, 0x0b, 0x02, 0x19, 0x02,
+  0x27, 0x02, 0x35, 0x02, 0x43, 0x02, 0x51, 0x02, 0x5f, 0x02, 0x6d, 0x02,
+  0x7b, 0x02, 0x89, 0x02, 0x97, 0x02, 0xa5, 0x02, 0xb3, 0x02, 0xc1, 0x02,
+  0xcf, 0x02, 0xdd, 0x02, 0xeb, 0x02, 0xf9, 0x02, 0x07, 0x03, 0x15, 0x03,
+  0x23, 0x03, 0x31, 0x03, 0x3f, 0x03, 0x4d, 0x03, 0x5b, 0x03, 0x69, 0x03,
+  0x77, 0x03, 0x85, 0x03, 0x93, 0x03, 0xa1, 0x03, 0xaf, 0x03, 0xbd, 0x03,
+  0xcb, 0x03, 0xd9, 0x03, 0xe7, 0x03, 0xf0, 0x03, 0xfc, 0x03, 0x0a, 0x04,
+  0x13, 0x04, 0x1d, 0x04, 0x28, 0x04, 0x33, 0x04, 0x3e, 0x04, 0x00, 0x00,
+  0x0e, 0x00, 0x21, 0x00, 0x46, 0x00, 0x5f, 0x00, 0x73, 0x00, 0x87, 0x00,
+  0x92, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x19, 0x00, 0x33, 0x00, 0x62, 0x00,
+  0x81, 0x00, 0x96, 0x00, 0xa8, 0x00, 0xb5, 0x00, 0xc2, 0x00, 0xcf, 0x00,
+  0xd8, 0x00, 0xe3, 0x00, 0xee, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x2e, 0x00,
+  0x41, 0x00, 0x50, 0x00, 0x5e, 0x00, 0x6c, 0x00, 0x7a, 0x00, 0x89, 0x00,
+  0x9b, 0x00, 0xac, 0x00, 0xb5, 0x00, 0xbe, 0x00, 0xc7, 0x00, 0xd1, 0x00,
+  0xdb, 0x00, 0xe5, 0x00, 0xef, 0x00, 0xf9, 0x00, 0x00, 0x00, 0x19, 0x00,
+  0x26, 0x00, 0x53, 0x00, 0x62, 0x00, 0x79, 0x00, 0x87, 0x00, 0x9d, 0x00,
+  0xb3, 0x00, 0xca, 0x00, 0xd8, 0x00, 0xe6, 0x00, 0xf4, 0x00, 0x02, 0x01,
+  0x10, 0x01, 0x1e, 0x01, 0x2c, 0x01, 0x3a, 0x01, 0x48, 0x01, 0x56, 0x01,
+  0x64, 0x01, 0x72, 0x01, 0x80, 0x01, 0x8e, 0x01, 0x9c, 0x01, 0xaa, 0x01,
+  0xb8, 0x01, 0xc6, 0x01, 0xd4, 0x01, 0xe2, 0x01, 0xf0, 0x01, 0xfe, 0x01,
+  0x0c, 0x02, 0x1a, 0x02, 0x28, 0x02, 0x36, 0x02, 0x44, 0x02, 0x52, 0x02,
+  0x60, 0x02, 0x6e, 0x02, 0x7c, 0x02, 0x8a, 0x02, 0x98, 0x02, 0xa6, 0x02,
+  0xb4, 0x02, 0xc2, 0x02, 0xd0, 0x02, 0xde, 0x02, 0xec, 0x02, 0xfa, 0x02,
+  0x08, 0x03, 0x16, 0x03, 0x24, 0x03, 0x32, 0x03, 0x40, 0x03, 0x4e, 0x03,
+  0x5c, 0x03, 0x6a, 0x03, 0x78, 0x03, 0x86, 0x03, 0x94, 0x03, 0x9f, 0x03,
+  0xa9, 0x03, 0xb4, 0x03, 0xbf, 0x03, 0xca, 0x03, 0xd5, 0x03, 0xe0, 0x03,
+  0xe8, 0x03, 0xf0, 0x03, 0xf8, 0x03, 0x01, 0x04, 0x0c, 0x04, 0x18, 0x04,
+  0x23, 0x04, 0x2e, 0x04, 0x3a, 0x04, 0x46, 0x04, 0x51, 0x04, 0x5c, 0x04,
+  0x67, 0x04, 0x72, 0x04, 0x7d, 0x04, 0x88, 0x04, 0x93, 0x04, 0x9e, 0x04,
+  0xa9, 0x04, 0xb4, 0x04, 0xbf, 0x04, 0xca, 0x04, 0xd5, 0x04, 0xe0, 0x04,
+  0xeb, 0x04, 0xf6, 0x04, 0x02, 0x05, 0x0e, 0x05, 0x1a, 0x05, 0x26, 0x05,
+  0x00, 0x00, 0x13, 0x00, 0x1e, 0x00, 0x35, 0x00, 0x50, 0x00, 0x5e, 0x00,
+  0x7e, 0x00, 0x9d, 0x00, 0xbf, 0x00, 0xe2, 0x00, 0x04, 0x01, 0x25, 0x01,
+  0x45, 0x01, 0x65, 0x01, 0x84, 0x01, 0xa4, 0x01, 0xc3, 0x01, 0xe3, 0x01,
+  0x06, 0x02, 0x27, 0x02, 0x48, 0x02, 0x68, 0x02, 0x87, 0x02, 0x9c, 0x02,
+  0xa3, 0x02, 0xb1, 0x02, 0xbf, 0x02, 0xc9, 0x02, 0xce, 0x02, 0x00, 0x00,
+  0x16, 0x00, 0x2d, 0x00, 0x45, 0x00, 0x61, 0x00, 0x7b, 0x00, 0x87, 0x00,
+  0x94, 0x00, 0x9f, 0x00, 0xaa, 0x00, 0xb7, 0x00, 0xc2, 0x00, 0xcd, 0x00,
+  0xd8, 0x00, 0xe3, 0x00, 0xee, 0x00, 0xf9, 0x00, 0x04, 0x01, 0x13, 0x01,
+  0x00, 0x00, 0x30, 0x00, 0x3c, 0x00, 0x49, 0x00, 0x62, 0x00, 0x6f, 0x00,
+  0x83, 0x00, 0x94, 0x00, 0xa7, 0x00, 0xbf, 0x00, 0xd6, 0x00, 0xea, 0x00,
+  0x02, 0x01, 0x17, 0x01, 0x2e, 0x01, 0x43, 0x01, 0x50, 0x01, 0x59, 0x01,
+  0x67, 0x01, 0x00, 0x00, 0x2c, 0x00, 0x3b, 0x00, 0x51, 0x00, 0x6f, 0x00,
+  0x7d, 0x00, 0x90, 0x00, 0x9b, 0x00, 0xae, 0x00, 0xc3, 0x00, 0xd7, 0x00,
+  0xea, 0x00, 0xfb, 0x00, 0x05, 0x01, 0x13, 0x01, 0x1d, 0x01, 0x28, 0x01,
+  0x36, 0x01, 0x40, 0x01, 0x4d, 0x01, 0x00, 0x00, 0x17, 0x00, 0x27, 0x00,
+  0x3c, 0x00, 0x53, 0x00, 0x5f, 0x00, 0x8a, 0x00, 0x96, 0x00, 0xa6, 0x00,
+  0xba, 0x00, 0xce, 0x00, 0xe2, 0x00, 0xfa, 0x00, 0x11, 0x01, 0x27, 0x01,
+  0x30, 0x01, 0x3f, 0x01, 0x48, 0x01, 0x4f, 0x01, 0x57, 0x01, 0x5e, 0x01,
+  0x65, 0x01, 0x6f, 0x01, 0x00, 0x00, 0x1c, 0x00, 0x2a, 0x00, 0x38, 0x00,
+  0x52, 0x00, 0x64, 0x00, 0x7c, 0x00, 0x90, 0x00, 0xb1, 0x00, 0xd1, 0x00,
+  0xe0, 0x00, 0xeb, 0x00, 0xf4, 0x00, 0xff, 0x00, 0x0a, 0x01, 0x15, 0x01,
+  0x20, 0x01, 0x2b, 0x01, 0x36, 0x01, 0x41, 0x01, 0x4c, 0x01, 0x57, 0x01,
+  0x62, 0x01, 0x6d, 0x01, 0x78, 0x01, 0x83, 0x01, 0x8e, 0x01, 0x99, 0x01,
+  0xa4, 0x01, 0xaf, 0x01, 0xb5, 0x01, 0xbf, 0x01, 0x00, 0x00, 0x28, 0x00,
+  0x34, 0x00, 0x42, 0x00, 0x51, 0x00, 0x78, 0x00, 0x88, 0x00, 0x9b, 0x00,
+  0xad, 0x00, 0xbf, 0x00, 0xd2, 0x00, 0xe3, 0x00, 0xec, 0x00, 0xf5, 0x00,
+  0xfe, 0x00, 0x07, 0x01, 0x10, 0x01, 0x19, 0x01, 0x22, 0x01, 0x2b, 0x01,
+  0x3a, 0x01, 0x44, 0x01, 0x4e, 0x01, 0x5e, 0x01, 0x6a, 0x01, 0x73, 0x01,
+  0x7c, 0x01, 0x85, 0x01, 0x91, 0x01, 0x00, 0x00, 0x17, 0x00, 0x24, 0x00,
+  0x38, 0x00, 0x48, 0x00, 0x6e, 0x00, 0x84, 0x00, 0x90, 0x00, 0x9d, 0x00,
+  0xaa, 0x00, 0xb7, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x26, 0x00, 0x3d, 0x00,
+  0x57, 0x00, 0x71, 0x00, 0x94, 0x00, 0xa6, 0x00, 0xb3, 0x00, 0xd4, 0x00,
+  0xf6, 0x00, 0x17, 0x01, 0x37, 0x01, 0x56, 0x01, 0x75, 0x01, 0x93, 0x01,
+  0xb2, 0x01, 0xd0, 0x01, 0xef, 0x01, 0x11, 0x02, 0x31, 0x02, 0x50, 0x02,
+  0x67, 0x02, 0x85, 0x02, 0xa2, 0x02, 0xab, 0x02, 0xb7, 0x02, 0xbf, 0x02,
+  0xcc, 0x02, 0xd9, 0x02, 0xe1, 0x02, 0xea, 0x02, 0xf1, 0x02, 0xfa, 0x02,
+  0x00, 0x00, 0x0b, 0x00, 0x22, 0x00, 0x49, 0x00, 0x56, 0x00, 0x7f, 0x00,
+  0x9e, 0x00, 0xa7, 0x00, 0xb0, 0x00, 0xb9, 0x00, 0xc2, 0x00, 0xcb, 0x00,
+  0xd5, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x26, 0x00, 0x34, 0x00, 0x4a, 0x00,
+  0x5f, 0x00, 0x80, 0x00, 0x90, 0x00, 0xa2, 0x00, 0xbb, 0x00, 0xc2, 0x00,
+  0xcc, 0x00, 0xd5, 0x00, 0xdf, 0x00, 0xe8, 0x00, 0xf9, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x25, 0x00, 0x3b, 0x00, 0x5b, 0x00, 0x71, 0x00, 0x91, 0x00,
+  0x9d, 0x00, 0xa9, 0x00, 0xb5, 0x00, 0xbf, 0x00, 0xcc, 0x00, 0xd6, 0x00,
+  0xe5, 0x00, 0xef, 0x00, 0xf5, 0x00, 0xfb, 0x00, 0x00, 0x00, 0x27, 0x00,
+  0x42, 0x00, 0x59, 0x00, 0x72, 0x00, 0x86, 0x00, 0x95, 0x00, 0xa2, 0x00,
+  0x00, 0x00, 0x33, 0x00, 0x5a, 0x00, 0x7b, 0x00, 0x96, 0x00, 0xa7, 0x00,
+  0xc0, 0x00, 0xc9, 0x00, 0xd8, 0x00, 0xe1, 0x00, 0xec, 0x00, 0xf2, 0x00,
+  0xf8, 0x00, 0xfe, 0x00, 0x04, 0x01, 0x0d, 0x01, 0x1a, 0x01, 0x29, 0x01,
+  0x00, 0x00, 0x0c, 0x00, 0x2b, 0x00, 0x44, 0x00, 0x59, 0x00, 0x83, 0x00,
+  0x8f, 0x00, 0x9e, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1f, 0x00,
+  0x37, 0x00, 0x5a, 0x00, 0x76, 0x00, 0x81, 0x00, 0x91, 0x00, 0xa7, 0x00,
+  0xb2, 0x00, 0xbd, 0x00, 0xc7, 0x00, 0xcd, 0x00, 0xd5, 0x00, 0x00, 0x00,
+  0x19, 0x00, 0x27, 0x00, 0x3b, 0x00, 0x47, 0x00, 0x61, 0x00, 0x77, 0x00,
+  0x8f, 0x00, 0xad, 0x00, 0xba, 0x00, 0xc3, 0x00, 0xcd, 0x00, 0xd6, 0x00,
+  0xdf, 0x00, 0xe8, 0x00, 0xf1, 0x00, 0xfa, 0x00, 0x02, 0x01, 0x08, 0x01,
+  0x14, 0x01, 0x00, 0x00, 0x15, 0x00, 0x2b, 0x00, 0x3a, 0x00, 0x46, 0x00,
+  0x54, 0x00, 0x6b, 0x00, 0x8f, 0x00, 0xac, 0x00, 0xc1, 0x00, 0xd0, 0x00,
+  0xd8, 0x00, 0xe4, 0x00, 0xf0, 0x00, 0xf9, 0x00, 0xff, 0x00, 0x0e, 0x01,
+  0x00, 0x00, 0x28, 0x00, 0x43, 0x00, 0x61, 0x00, 0x7d, 0x00, 0x9b, 0x00,
+  0xb4, 0x00, 0xd2, 0x00, 0xed, 0x00, 0xfa, 0x00, 0x09, 0x01, 0x16, 0x01,
+  0x23, 0x01, 0x34, 0x01, 0x4b, 0x01, 0x5b, 0x01, 0x6e, 0x01, 0x7c, 0x01,
+  0x89, 0x01, 0x96, 0x01, 0xa3, 0x01, 0xb2, 0x01, 0xc0, 0x01, 0xcf, 0x01,
+  0xdb, 0x01, 0xe4, 0x01, 0xf0, 0x01, 0xf9, 0x01, 0x02, 0x02, 0x0b, 0x02,
+  0x17, 0x02, 0x20, 0x02, 0x29, 0x02, 0x32, 0x02, 0x3b, 0x02, 0x44, 0x02,
+  0x4d, 0x02, 0x56, 0x02, 0x5e, 0x02, 0x66, 0x02, 0x6e, 0x02, 0x75, 0x02,
+  0x7d, 0x02, 0x88, 0x02, 0x90, 0x02, 0x96, 0x02, 0x9d, 0x02, 0x00, 0x00,
+  0x1e, 0x00, 0x49, 0x00, 0x58, 0x00, 0x66, 0x00, 0x7c, 0x00, 0x90, 0x00,
+  0xa7, 0x00, 0xb3, 0x00, 0xbe, 0x00, 0xca, 0x00, 0xd4, 0x00, 0xdf, 0x00,
+  0xea, 0x00, 0xf5, 0x00, 0x03, 0x01, 0x0e, 0x01, 0x19, 0x01, 0x24, 0x01,
+  0x2f, 0x01, 0x37, 0x01, 0x3e, 0x01, 0x47, 0x01, 0x00, 0x00, 0x28, 0x00,
+  0x43, 0x00, 0x61, 0x00, 0x7d, 0x00, 0x9c, 0x00, 0xb5, 0x00, 0xd3, 0x00,
+  0xdf, 0x00, 0x09, 0x01, 0x20, 0x01, 0x2c, 0x01, 0x4a, 0x01, 0x58, 0x01,
+  0x6f, 0x01, 0x7c, 0x01, 0x97, 0x01, 0xb3, 0x01, 0xce, 0x01, 0xe8, 0x01,
+  0x01, 0x02, 0x1a, 0x02, 0x32, 0x02, 0x4b, 0x02, 0x63, 0x02, 0x7c, 0x02,
+  0x98, 0x02, 0xb2, 0x02, 0xcb, 0x02, 0xd8, 0x02, 0xe8, 0x02, 0xf8, 0x02,
+  0x08, 0x03, 0x18, 0x03, 0x28, 0x03, 0x38, 0x03, 0x4d, 0x03, 0x62, 0x03,
+  0x74, 0x03, 0x89, 0x03, 0x98, 0x03, 0xa8, 0x03, 0xb7, 0x03, 0xd3, 0x03,
+  0xea, 0x03, 0x01, 0x04, 0x0b, 0x04, 0x13, 0x04, 0x1d, 0x04, 0x25, 0x04,
+  0x2f, 0x04, 0x39, 0x04, 0x43, 0x04, 0x4b, 0x04, 0x53, 0x04, 0x5c, 0x04,
+  0x65, 0x04, 0x71, 0x04, 0x80, 0x04, 0x8a, 0x04, 0x93, 0x04, 0x9d, 0x04,
+  0xa6, 0x04, 0xae, 0x04, 0xb7, 0x04, 0x00, 0x00, 0x26, 0x00, 0x33, 0x00,
+  0x5b, 0x00, 0x77, 0x00, 0x86, 0x00, 0x9e, 0x00, 0xaf, 0x00, 0xc0, 0x00,
+  0xce, 0x00, 0xdd, 0x00, 0xe8, 0x00, 0xf4, 0x00, 0x06, 0x01, 0x18, 0x01,
+  0x2a, 0x01, 0x3b, 0x01, 0x53, 0x01, 0x6b, 0x01, 0x74, 0x01, 0x7d, 0x01,
+  0x86, 0x01, 0x8f, 0x01, 0x98, 0x01, 0xa1, 0x01, 0xad, 0x01, 0xb9, 0x01,
+  0xc5, 0x01, 0xd1, 0x01, 0xda, 0x01, 0xe3, 0x01, 0xeb, 0x01, 0xf4, 0x01,
+  0xff, 0x01, 0x0a, 0x02, 0x13, 0x02, 0x1c, 0x02, 0x25, 0x02, 0x2e, 0x02,
+  0x37, 0x02, 0x40, 0x02, 0x4a, 0x02, 0x54, 0x02, 0x5e, 0x02, 0x67, 0x02,
+  0x71, 0x02, 0x00, 0x00, 0x0f, 0x00, 0x22, 0x00, 0x36, 0x00, 0x47, 0x00,
+  0x5f, 0x00, 0x70, 0x00, 0x7f, 0x00, 0x8e, 0x00, 0x9c, 0x00, 0xaa, 0x00,
+  0xb9, 0x00, 0xc7, 0x00, 0xd5, 0x00, 0xe2, 0x00, 0xef, 0x00, 0xfd, 0x00,
+  0x0a, 0x01, 0x16, 0x01, 0x34, 0x01, 0x53, 0x01, 0x71, 0x01, 0x8e, 0x01,
+  0xaa, 0x01, 0xc6, 0x01, 0xe1, 0x01, 0xfd, 0x01, 0x18, 0x02, 0x34, 0x02,
+  0x53, 0x02, 0x70, 0x02, 0x8c, 0x02, 0xaa, 0x02, 0xc9, 0x02, 0xe7, 0x02,
+  0x04, 0x03, 0x20, 0x03, 0x3c, 0x03, 0x57, 0x03, 0x73, 0x03, 0x8e, 0x03,
+  0xaa, 0x03, 0xc9, 0x03, 0xe6, 0x03, 0x02, 0x04, 0x1c, 0x04, 0x35, 0x04,
+  0x51, 0x04, 0x6e, 0x04, 0x8a, 0x04, 0xa5, 0x04, 0xbf, 0x04, 0xd9, 0x04,
+  0xf2, 0x04, 0x0c, 0x05, 0x25, 0x05, 0x3f, 0x05, 0x5c, 0x05, 0x77, 0x05,
+  0x91, 0x05, 0xa3, 0x05, 0xb4, 0x05, 0xc6, 0x05, 0xd8, 0x05, 0xea, 0x05,
+  0xfc, 0x05, 0x19, 0x06, 0x2b, 0x06, 0x35, 0x06, 0x3d, 0x06, 0x46, 0x06,
+  0x4f, 0x06, 0x58, 0x06, 0x61, 0x06, 0x6a, 0x06, 0x73, 0x06, 0x7f, 0x06,
+  0x8d, 0x06, 0x93, 0x06, 0x00, 0x00, 0x26, 0x00, 0x3c, 0x00, 0x55, 0x00,
+  0x62, 0x00, 0x6d, 0x00, 0x7d, 0x00, 0x9d, 0x00, 0xbe, 0x00, 0xcc, 0x00,
+  0xe6, 0x00, 0x01, 0x01, 0x1b, 0x01, 0x34, 0x01, 0x4c, 0x01, 0x64, 0x01,
+  0x7b, 0x01, 0x93, 0x01, 0xaa, 0x01, 0xc2, 0x01, 0xdd, 0x01, 0xf6, 0x01,
+  0x0e, 0x02, 0x22, 0x02, 0x36, 0x02, 0x41, 0x02, 0x4c, 0x02, 0x54, 0x02,
+  0x5c, 0x02, 0x63, 0x02, 0x6e, 0x02, 0x00, 0x00, 0x21, 0x00, 0x37, 0x00,
+  0x47, 0x00, 0x63, 0x00, 0x85, 0x00, 0x9e, 0x00, 0xad, 0x00, 0xbe, 0x00,
+  0xcd, 0x00, 0xdf, 0x00, 0xf0, 0x00, 0x00, 0x01, 0x0f, 0x01, 0x1f, 0x01,
+  0x33, 0x01, 0x49, 0x01, 0x51, 0x01, 0x59, 0x01, 0x61, 0x01, 0x69, 0x01,
+  0x71, 0x01, 0x79, 0x01, 0x81, 0x01, 0x8c, 0x01, 0x97, 0x01, 0xa4, 0x01,
+  0xac, 0x01, 0xb4, 0x01, 0xbd, 0x01, 0xc3, 0x01, 0x00, 0x00, 0x1e, 0x00,
+  0x2d, 0x00, 0x3b, 0x00, 0x5e, 0x00, 0x77, 0x00, 0x88, 0x00, 0x95, 0x00,
+  0xa5, 0x00, 0xb3, 0x00, 0xbc, 0x00, 0xc5, 0x00, 0xce, 0x00, 0xd5, 0x00,
+  0xde, 0x00, 0xe7, 0x00, 0xf1, 0x00, 0xfb, 0x00, 0x00, 0x00, 0x0b, 0x00,
+  0x1f, 0x00, 0x2a, 0x00, 0x36, 0x00, 0x50, 0x00, 0x66, 0x00, 0x79, 0x00,
+  0x88, 0x00, 0x90, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x28, 0x00, 0x34, 0x00,
+  0x4b, 0x00, 0x67, 0x00, 0x7d, 0x00, 0x95, 0x00, 0xac, 0x00, 0xb6, 0x00,
+  0x00, 0x00, 0x19, 0x00, 0x27, 0x00, 0x35, 0x00, 0x41, 0x00, 0x61, 0x00,
+  0x6d, 0x00, 0x79, 0x00, 0x82, 0x00, 0x8c, 0x00, 0x00, 0x00, 0x20, 0x00,
+  0x2e, 0x00, 0x3c, 0x00, 0x5e, 0x00, 0x79, 0x00, 0x8b, 0x00, 0x9a, 0x00,
+  0xb2, 0x00, 0xb8, 0x00, 0xbe, 0x00, 0xc4, 0x00, 0x00, 0x00, 0x0f, 0x00,
+  0x1e, 0x00, 0x2c, 0x00, 0x4e, 0x00, 0x69, 0x00, 0x75, 0x00, 0x80, 0x00,
+  0x8d, 0x00, 0xa3, 0x00, 0xac, 0x00, 0xb2, 0x00, 0x00, 0x00, 0x11, 0x00,
+  0x22, 0x00, 0x2e, 0x00, 0x3e, 0x00, 0x51, 0x00, 0x62, 0x00, 0x78, 0x00,
+  0x8e, 0x00, 0xa5, 0x00, 0xbc, 0x00, 0xc7, 0x00, 0xd0, 0x00, 0xdb, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x2f, 0x00, 0x3e, 0x00, 0x4e, 0x00, 0x5e, 0x00,
+  0x6d, 0x00, 0x7c, 0x00, 0x88, 0x00, 0xa2, 0x00, 0xbd, 0x00, 0xd7, 0x00,
+  0xf0, 0x00, 0x08, 0x01, 0x20, 0x01, 0x37, 0x01, 0x4f, 0x01, 0x66, 0x01,
+  0x7e, 0x01, 0x99, 0x01, 0xb2, 0x01, 0xca, 0x01, 0xd4, 0x01, 0xdb, 0x01,
+  0xe1, 0x01, 0xe9, 0x01, 0x00, 0x00, 0x0f, 0x00, 0x37, 0x00, 0x56, 0x00,
+  0x6c, 0x00, 0x98, 0x00, 0xb9, 0x00, 0xd0, 0x00, 0xdf, 0x00, 0xf0, 0x00,
+  0xfb, 0x00, 0x00, 0x00, 0x28, 0x00, 0x3b, 0x00, 0x4f, 0x00, 0x5b, 0x00,
+  0x70, 0x00, 0x82, 0x00, 0xa2, 0x00, 0xac, 0x00, 0xc3, 0x00, 0xd8, 0x00,
+  0xe3, 0x00, 0xee, 0x00, 0xfb, 0x00, 0x08, 0x01, 0x15, 0x01, 0x22, 0x01,
+  0x2f, 0x01, 0x3c, 0x01, 0x49, 0x01, 0x56, 0x01, 0x63, 0x01, 0x70, 0x01,
+  0x00, 0x00, 0x16, 0x00, 0x31, 0x00, 0x47, 0x00, 0x61, 0x00, 0x6d, 0x00,
+  0x80, 0x00, 0x94, 0x00, 0xaa, 0x00, 0xb6, 0x00, 0xc5, 0x00, 0xd8, 0x00,
+  0xea, 0x00, 0xf6, 0x00, 0x08, 0x01, 0x1a, 0x01, 0x2d, 0x01, 0x40, 0x01,
+  0x53, 0x01, 0x6c, 0x01, 0x85, 0x01, 0x98, 0x01, 0xa1, 0x01, 0xaa, 0x01,
+  0xb3, 0x01, 0xbc, 0x01, 0xc5, 0x01, 0xcc, 0x01, 0xd9, 0x01, 0xe6, 0x01,
+  0xf4, 0x01, 0x01, 0x02, 0x0c, 0x02, 0x17, 0x02, 0x22, 0x02, 0x2f, 0x02,
+  0x3a, 0x02, 0x42, 0x02, 0x4b, 0x02, 0x00, 0x00, 0x20, 0x00, 0x49, 0x00,
+  0x66, 0x00, 0x7d, 0x00, 0x95, 0x00, 0xa2, 0x00, 0xb4, 0x00, 0xca, 0x00,
+  0xe0, 0x00, 0xf5, 0x00, 0x0d, 0x01, 0x26, 0x01, 0x3e, 0x01, 0x55, 0x01,
+  0x6b, 0x01, 0x81, 0x01, 0x96, 0x01, 0xac, 0x01, 0xc1, 0x01, 0xd7, 0x01,
+  0xf0, 0x01, 0x07, 0x02, 0x1d, 0x02, 0x2e, 0x02, 0x42, 0x02, 0x5b, 0x02,
+  0x68, 0x02, 0x7d, 0x02, 0x91, 0x02, 0xab, 0x02, 0xc5, 0x02, 0xd1, 0x02,
+  0xdd, 0x02, 0xe9, 0x02, 0xf6, 0x02, 0xfd, 0x02, 0x06, 0x03, 0x0d, 0x03,
+  0x16, 0x03, 0x1d, 0x03, 0x24, 0x03, 0x2b, 0x03, 0x33, 0x03, 0x3b, 0x03,
+  0x44, 0x03, 0x4c, 0x03, 0x54, 0x03, 0x5d, 0x03, 0x6a, 0x03, 0x73, 0x03,
+  0x80, 0x03, 0x8d, 0x03, 0x96, 0x03, 0x9d, 0x03, 0xa4, 0x03, 0xab, 0x03,
+  0x00, 0x00, 0x1a, 0x00, 0x2f, 0x00, 0x44, 0x00, 0x6c, 0x00, 0x7c, 0x00,
+  0x93, 0x00, 0xa2, 0x00, 0xae, 0x00, 0xbd, 0x00, 0xcc, 0x00, 0xdb, 0x00,
+  0xe8, 0x00, 0x02, 0x01, 0x14, 0x01, 0x2b, 0x01, 0x42, 0x01, 0x5b, 0x01,
+  0x73, 0x01, 0x92, 0x01, 0xac, 0x01, 0xc5, 0x01, 0xd1, 0x01, 0xd8, 0x01,
+  0xe1, 0x01, 0xe7, 0x01, 0xef, 0x01, 0xf7, 0x01, 0xff, 0x01, 0x07, 0x02,
+  0x0d, 0x02, 0x15, 0x02, 0x1d, 0x02, 0x25, 0x02, 0x2d, 0x02, 0x36, 0x02,
+  0x3f, 0x02, 0x00, 0x00, 0x10, 0x00, 0x45, 0x00, 0x55, 0x00, 0x68, 0x00,
+  0x8e, 0x00, 0xa6, 0x00, 0xc0, 0x00, 0xdb, 0x00, 0xee, 0x00, 0x0a, 0x01,
+  0x26, 0x01, 0x36, 0x01, 0x3f, 0x01, 0x48, 0x01, 0x51, 0x01, 0x5a, 0x01,
+  0x63, 0x01, 0x6c, 0x01, 0x75, 0x01, 0x7e, 0x01, 0x87, 0x01, 0x90, 0x01,
+  0x99, 0x01, 0xa2, 0x01, 0xab, 0x01, 0xb4, 0x01, 0xbd, 0x01, 0xc6, 0x01,
+  0xcf, 0x01, 0xd8, 0x01, 0xe4, 0x01, 0xee, 0x01, 0xf7, 0x01, 0x01, 0x02,
+  0x00, 0x00, 0x10, 0x00, 0x37, 0x00, 0x43, 0x00, 0x53, 0x00, 0x79, 0x00,
+  0x8f, 0x00, 0xa2, 0x00, 0xb6, 0x00, 0xc8, 0x00, 0xda, 0x00, 0xec, 0x00,
+  0xfe, 0x00, 0x11, 0x01, 0x1d, 0x01, 0x28, 0x01, 0x33, 0x01, 0x3e, 0x01,
+  0x4b, 0x01, 0x58, 0x01, 0x65, 0x01, 0x72, 0x01, 0x7f, 0x01, 0x8a, 0x01,
+  0x93, 0x01, 0x00, 0x00, 0x1f, 0x00, 0x2f, 0x00, 0x43, 0x00, 0x58, 0x00,
+  0x6d, 0x00, 0x7b, 0x00, 0x93, 0x00, 0xac, 0x00, 0xc4, 0x00, 0xdb, 0x00,
+  0xf1, 0x00, 0x07, 0x01, 0x1c, 0x01, 0x32, 0x01, 0x47, 0x01, 0x5d, 0x01,
+  0x76, 0x01, 0x8d, 0x01, 0xa3, 0x01, 0xb0, 0x01, 0xbc, 0x01, 0xc8, 0x01,
+  0xd5, 0x01, 0xe1, 0x01, 0xef, 0x01, 0xf6, 0x01, 0xfd, 0x01, 0x04, 0x02,
+  0x0b, 0x02, 0x12, 0x02, 0x1d, 0x02, 0x24, 0x02, 0x2b, 0x02, 0x32, 0x02,
+  0x00, 0x00, 0x10, 0x00, 0x26, 0x00, 0x36, 0x00, 0x43, 0x00, 0x59, 0x00,
+  0x67, 0x00, 0x77, 0x00, 0x84, 0x00, 0x93, 0x00, 0xa3, 0x00, 0xb3, 0x00,
+  0xd2, 0x00, 0xe9, 0x00, 0x00, 0x01, 0x0e, 0x01, 0x14, 0x01, 0x1a, 0x01,
+  0x28, 0x01, 0x35, 0x01, 0x3e, 0x01, 0x47, 0x01, 0x4f, 0x01, 0x57, 0x01,
+  0x5f, 0x01, 0x65, 0x01, 0x6b, 0x01, 0x73, 0x01, 0x7b, 0x01, 0x82, 0x01,
+  0x89, 0x01, 0x91, 0x01, 0x99, 0x01, 0xa1, 0x01, 0xa9, 0x01, 0xb3, 0x01,
+  0x00, 0x00, 0x10, 0x00, 0x20, 0x00, 0x37, 0x00, 0x46, 0x00, 0x55, 0x00,
+  0x6f, 0x00, 0x86, 0x00, 0x94, 0x00, 0xa9, 0x00, 0xbd, 0x00, 0xd1, 0x00,
+  0xe2, 0x00, 0xf5, 0x00, 0x09, 0x01, 0x1c, 0x01, 0x32, 0x01, 0x3c, 0x01,
+  0x45, 0x01, 0x52, 0x01, 0x00, 0x00, 0x11, 0x00, 0x20, 0x00, 0x39, 0x00,
+  0x44, 0x00, 0x5a, 0x00, 0x66, 0x00, 0x75, 0x00, 0x84, 0x00, 0x9c, 0x00,
+  0xb3, 0x00, 0xce, 0x00, 0xe7, 0x00, 0xf3, 0x00, 0x03, 0x01, 0x0f, 0x01,
+  0x1b, 0x01, 0x29, 0x01, 0x00, 0x00, 0x14, 0x00, 0x21, 0x00, 0x2c, 0x00,
+  0x3b, 0x00, 0x4b, 0x00, 0x64, 0x00, 0x74, 0x00, 0x83, 0x00, 0x8e, 0x00,
+  0x97, 0x00, 0x00, 0x00, 0x13, 0x00, 0x20, 0x00, 0x2c, 0x00, 0x38, 0x00,
+  0x48, 0x00, 0x55, 0x00, 0x62, 0x00, 0x74, 0x00, 0x7a, 0x00, 0x80, 0x00,
+  0x86, 0x00, 0x8d, 0x00, 0x98, 0x00, 0x00, 0x00, 0x26, 0x00, 0x3c, 0x00,
+  0x57, 0x00, 0x66, 0x00, 0x7b, 0x00, 0x8b, 0x00, 0x97, 0x00, 0xb8, 0x00,
+  0xd8, 0x00, 0xfb, 0x00, 0x1f, 0x01, 0x42, 0x01, 0x64, 0x01, 0x85, 0x01,
+  0xa6, 0x01, 0xc6, 0x01, 0xe7, 0x01, 0x07, 0x02, 0x28, 0x02, 0x4c, 0x02,
+  0x6e, 0x02, 0x8f, 0x02, 0xa0, 0x02, 0xaf, 0x02, 0xbe, 0x02, 0xcd, 0x02,
+  0xdc, 0x02, 0xeb, 0x02, 0xfa, 0x02, 0x06, 0x03, 0x11, 0x03, 0x00, 0x00,
+  0x23, 0x00, 0x38, 0x00, 0x45, 0x00, 0x5e, 0x00, 0x6c, 0x00, 0x7a, 0x00,
+  0x96, 0x00, 0xa5, 0x00, 0xb3, 0x00, 0xc0, 0x00, 0xd3, 0x00, 0xde, 0x00,
+  0xf8, 0x00, 0x05, 0x01, 0x10, 0x01, 0x1b, 0x01, 0x26, 0x01, 0x2f, 0x01,
+  0x00, 0x00, 0x24, 0x00, 0x3c, 0x00, 0x52, 0x00, 0x81, 0x00, 0x9a, 0x00,
+  0xa8, 0x00, 0xbc, 0x00, 0xcc, 0x00, 0xdd, 0x00, 0xf4, 0x00, 0xfc, 0x00,
+  0x07, 0x01, 0x11, 0x01, 0x1c, 0x01, 0x26, 0x01, 0x32, 0x01, 0x3c, 0x01,
+  0x00, 0x00, 0x19, 0x00, 0x2e, 0x00, 0x5d, 0x00, 0x6a, 0x00, 0x7a, 0x00,
+  0x97, 0x00, 0xa1, 0x00, 0xb3, 0x00, 0xd1, 0x00, 0xef, 0x00, 0xf7, 0x00,
+  0xff, 0x00, 0x06, 0x01, 0x0d, 0x01, 0x14, 0x01, 0x1b, 0x01, 0x26, 0x01,
+  0x32, 0x01, 0x3a, 0x01, 0x46, 0x01, 0x4f, 0x01, 0x57, 0x01, 0x60, 0x01,
+  0x67, 0x01, 0x6f, 0x01, 0x78, 0x01, 0x00, 0x00, 0x2c, 0x00, 0x45, 0x00,
+  0x6f, 0x00, 0x86, 0x00, 0xa3, 0x00, 0xc4, 0x00, 0xef, 0x00, 0x16, 0x01,
+  0x33, 0x01, 0x49, 0x01, 0x60, 0x01, 0x7f, 0x01, 0x97, 0x01, 0xad, 0x01,
+  0xbd, 0x01, 0xd3, 0x01, 0xe0, 0x01, 0xef, 0x01, 0xfd, 0x01, 0x0f, 0x02,
+  0x22, 0x02, 0x33, 0x02, 0x44, 0x02, 0x53, 0x02, 0x64, 0x02, 0x73, 0x02,
+  0x7b, 0x02, 0x85, 0x02, 0x8e, 0x02, 0x97, 0x02, 0xa0, 0x02, 0xa9, 0x02,
+  0xb2, 0x02, 0xba, 0x02, 0xc2, 0x02, 0xcf, 0x02, 0xd9, 0x02, 0xdf, 0x02,
+  0x00, 0x00, 0x17, 0x00, 0x23, 0x00, 0x3b, 0x00, 0x4a, 0x00, 0x56, 0x00,
+  0x69, 0x00, 0x7b, 0x00, 0x8d, 0x00, 0x9b, 0x00, 0xa3, 0x00, 0xac, 0x00,
+  0xb8, 0x00, 0xc4, 0x00, 0xcb, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x46, 0x00,
+  0x70, 0x00, 0x88, 0x00, 0xa5, 0x00, 0xc7, 0x00, 0xf2, 0x00, 0x1a, 0x01,
+  0x3a, 0x01, 0x52, 0x01, 0x6e, 0x01, 0x84, 0x01, 0x93, 0x01, 0xa8, 0x01,
+  0xc3, 0x01, 0xd6, 0x01, 0xe8, 0x01, 0xff, 0x01, 0x0a, 0x02, 0x12, 0x02,
+  0x1a, 0x02, 0x24, 0x02, 0x2e, 0x02, 0x38, 0x02, 0x47, 0x02, 0x51, 0x02,
+  0x5b, 0x02, 0x64, 0x02, 0x00, 0x00, 0x17, 0x00, 0x31, 0x00, 0x40, 0x00,
+  0x55, 0x00, 0x61, 0x00, 0x81, 0x00, 0x95, 0x00, 0xa6, 0x00, 0xb8, 0x00,
+  0xd4, 0x00, 0xef, 0x00, 0xf8, 0x00, 0x01, 0x01, 0x0a, 0x01, 0x13, 0x01,
+  0x1c, 0x01, 0x28, 0x01, 0x30, 0x01, 0x38, 0x01, 0x3f, 0x01, 0x48, 0x01,
+  0x51, 0x01, 0x5a, 0x01, 0x63, 0x01, 0x00, 0x00, 0x1a, 0x00, 0x29, 0x00,
+  0x57, 0x00, 0x62, 0x00, 0x71, 0x00, 0x87, 0x00, 0x94, 0x00, 0xa0, 0x00,
+  0xac, 0x00, 0xbe, 0x00, 0xcc, 0x00, 0xde, 0x00, 0xf0, 0x00, 0xfe, 0x00,
+  0x10, 0x01, 0x21, 0x01, 0x33, 0x01, 0x44, 0x01, 0x57, 0x01, 0x68, 0x01,
+  0x7c, 0x01, 0x86, 0x01, 0x8e, 0x01, 0x95, 0x01, 0x9c, 0x01, 0xa5, 0x01,
+  0xae, 0x01, 0xb7, 0x01, 0xc0, 0x01, 0xc9, 0x01, 0xcf, 0x01, 0xd5, 0x01,
+  0xdd, 0x01, 0xe4, 0x01, 0xf5, 0x01, 0xfc, 0x01, 0x06, 0x02, 0x11, 0x02,
+  0x18, 0x02, 0x1f, 0x02, 0x29, 0x02, 0x00, 0x00, 0x1a, 0x00, 0x34, 0x00,
+  0x62, 0x00, 0x74, 0x00, 0x87, 0x00, 0x9b, 0x00, 0xa8, 0x00, 0xb4, 0x00,
+  0xbf, 0x00, 0xca, 0x00, 0xd5, 0x00, 0xe0, 0x00, 0xeb, 0x00, 0xf6, 0x00,
+  0x01, 0x01, 0x0c, 0x01, 0x17, 0x01, 0x22, 0x01, 0x2d, 0x01, 0x38, 0x01,
+  0x43, 0x01, 0x4e, 0x01, 0x59, 0x01, 0x64, 0x01, 0x6f, 0x01, 0x7a, 0x01,
+  0x85, 0x01, 0x90, 0x01, 0x9b, 0x01, 0xa6, 0x01, 0xb1, 0x01, 0xbc, 0x01,
+  0xc7, 0x01, 0xd2, 0x01, 0xdd, 0x01, 0xe8, 0x01, 0xf3, 0x01, 0xfe, 0x01,
+  0x09, 0x02, 0x14, 0x02, 0x1f, 0x02, 0x2a, 0x02, 0x35, 0x02, 0x40, 0x02,
+  0x4b, 0x02, 0x56, 0x02, 0x61, 0x02, 0x6c, 0x02, 0x77, 0x02, 0x82, 0x02,
+  0x8d, 0x02, 0x98, 0x02, 0xa3, 0x02, 0xae, 0x02, 0xb9, 0x02, 0xc4, 0x02,
+  0xcf, 0x02, 0xda, 0x02, 0xe5, 0x02, 0xf0, 0x02, 0xfb, 0x02, 0x06, 0x03,
+  0x11, 0x03, 0x1c, 0x03, 0x27, 0x03, 0x32, 0x03, 0x3d, 0x03, 0x48, 0x03,
+  0x53, 0x03, 0x5e, 0x03, 0x69, 0x03, 0x74, 0x03, 0x7f, 0x03, 0x8a, 0x03,
+  0x95, 0x03, 0xa0, 0x03, 0xab, 0x03, 0xb6, 0x03, 0xc1, 0x03, 0xcc, 0x03,
+  0xd7, 0x03, 0xe2, 0x03, 0xed, 0x03, 0xf8, 0x03, 0x03, 0x04, 0x0e, 0x04,
+  0x19, 0x04, 0x24, 0x04, 0x2f, 0x04, 0x3a, 0x04, 0x45, 0x04, 0x50, 0x04,
+  0x5b, 0x04, 0x66, 0x04, 0x71, 0x04, 0x7c, 0x04, 0x87, 0x04, 0x92, 0x04,
+  0x9d, 0x04, 0xa3, 0x04, 0x00, 0x00, 0x31, 0x00, 0x49, 0x00, 0x69, 0x00,
+  0x85, 0x00, 0x95, 0x00, 0xb3, 0x00, 0xc4, 0x00, 0xd4, 0x00, 0xf0, 0x00,
+  0x0d, 0x01, 0x29, 0x01, 0x44, 0x01, 0x5e, 0x01, 0x78, 0x01, 0x91, 0x01,
+  0xab, 0x01, 0xc4, 0x01, 0xde, 0x01, 0xfb, 0x01, 0x16, 0x02, 0x30, 0x02,
+  0x38, 0x02, 0x40, 0x02, 0x49, 0x02, 0x52, 0x02, 0x00, 0x00, 0x1d, 0x00,
+  0x37, 0x00, 0x46, 0x00, 0x56, 0x00, 0x66, 0x00, 0x81, 0x00, 0x8f, 0x00,
+  0x9d, 0x00, 0xaf, 0x00, 0xc1, 0x00, 0xd3, 0x00, 0xe5, 0x00, 0xf7, 0x00,
+  0x16, 0x01, 0x20, 0x01, 0x2a, 0x01, 0x34, 0x01, 0x3e, 0x01, 0x48, 0x01,
+  0x4e, 0x01, 0x00, 0x00, 0x16, 0x00, 0x37, 0x00, 0x42, 0x00, 0x58, 0x00,
+  0x6e, 0x00, 0x7b, 0x00, 0x8b, 0x00, 0x94, 0x00, 0xa2, 0x00, 0xb7, 0x00,
+  0xcc, 0x00, 0xe0, 0x00, 0xf3, 0x00, 0x06, 0x01, 0x10, 0x01, 0x1a, 0x01,
+  0x24, 0x01, 0x2e, 0x01, 0x38, 0x01, 0x42, 0x01, 0x4c, 0x01, 0x56, 0x01,
+  0x60, 0x01, 0x6a, 0x01, 0x74, 0x01, 0x7e, 0x01, 0x88, 0x01, 0x92, 0x01,
+  0x9c, 0x01, 0xa6, 0x01, 0xb0, 0x01, 0xba, 0x01, 0xc3, 0x01, 0xcd, 0x01,
+  0xd9, 0x01, 0xe3, 0x01, 0xea, 0x01, 0xf4, 0x01, 0x00, 0x00, 0x18, 0x00,
+  0x3b, 0x00, 0x57, 0x00, 0x67, 0x00, 0x8d, 0x00, 0x9c, 0x00, 0xb2, 0x00,
+  0xba, 0x00, 0xc4, 0x00, 0x00, 0x00, 0x17, 0x00, 0x32, 0x00, 0x40, 0x00,
+  0x56, 0x00, 0x63, 0x00, 0x77, 0x00, 0x85, 0x00, 0x95, 0x00, 0xa4, 0x00,
+  0xb4, 0x00, 0xc6, 0x00, 0xda, 0x00, 0xed, 0x00, 0xf6, 0x00, 0xff, 0x00,
+  0x09, 0x01, 0x12, 0x01, 0x1f, 0x01, 0x28, 0x01, 0x00, 0x00, 0x18, 0x00,
+  0x31, 0x00, 0x4b, 0x00, 0x60, 0x00, 0x86, 0x00, 0x9b, 0x00, 0xaa, 0x00,
+  0xb8, 0x00, 0xc5, 0x00, 0xe2, 0x00, 0xfe, 0x00, 0x07, 0x01, 0x0e, 0x01,
+  0x00, 0x00, 0x11, 0x00, 0x29, 0x00, 0x37, 0x00, 0x50, 0x00, 0x60, 0x00,
+  0x71, 0x00, 0x7e, 0x00, 0x90, 0x00, 0x00, 0x00, 0x17, 0x00, 0x36, 0x00,
+  0x50, 0x00, 0x68, 0x00, 0x79, 0x00, 0x90, 0x00, 0xad, 0x00, 0xbc, 0x00,
+  0xd2, 0x00, 0x00, 0x00, 0x23, 0x00, 0x55, 0x00, 0x6e, 0x00, 0x7c, 0x00,
+  0x96, 0x00, 0xa1, 0x00, 0xb4, 0x00, 0xbf, 0x00, 0xd9, 0x00, 0xf2, 0x00,
+  0x0b, 0x01, 0x27, 0x01, 0x42, 0x01, 0x4a, 0x01, 0x56, 0x01, 0x60, 0x01,
+  0x00, 0x00, 0x19, 0x00, 0x40, 0x00, 0x59, 0x00, 0x6b, 0x00, 0x87, 0x00,
+  0x9e, 0x00, 0xa5, 0x00, 0xac, 0x00, 0xb2, 0x00, 0xbb, 0x00, 0x00, 0x00,
+  0x1b, 0x00, 0x4a, 0x00, 0x7a, 0x00, 0x93, 0x00, 0xaa, 0x00, 0xc3, 0x00,
+  0xdc, 0x00, 0xe5, 0x00, 0xef, 0x00, 0xf9, 0x00, 0x03, 0x01, 0x0d, 0x01,
+  0x19, 0x01, 0x22, 0x01, 0x00, 0x00, 0x18, 0x00, 0x32, 0x00, 0x44, 0x00,
+  0x74, 0x00, 0x8d, 0x00, 0xa4, 0x00, 0xb1, 0x00, 0xbe, 0x00, 0xda, 0x00,
+  0xf5, 0x00, 0x13, 0x01, 0x32, 0x01, 0x50, 0x01, 0x6d, 0x01, 0x89, 0x01,
+  0xa5, 0x01, 0xc0, 0x01, 0xdc, 0x01, 0xf7, 0x01, 0x13, 0x02, 0x32, 0x02,
+  0x4f, 0x02, 0x6b, 0x02, 0x77, 0x02, 0x88, 0x02, 0x90, 0x02, 0x98, 0x02,
+  0xa0, 0x02, 0xa8, 0x02, 0xb0, 0x02, 0xbb, 0x02, 0xc6, 0x02, 0xd4, 0x02,
+  0xdf, 0x02, 0xed, 0x02, 0xfb, 0x02, 0x06, 0x03, 0x0d, 0x03, 0x14, 0x03,
+  0x00, 0x00, 0x17, 0x00, 0x39, 0x00, 0x48, 0x00, 0x5c, 0x00, 0x6a, 0x00,
+  0x84, 0x00, 0x91, 0x00, 0x9e, 0x00, 0xac, 0x00, 0xbb, 0x00, 0xcb, 0x00,
+  0xda, 0x00, 0xea, 0x00, 0xf6, 0x00, 0xfe, 0x00, 0x06, 0x01, 0x0e, 0x01,
+  0x1a, 0x01, 0x22, 0x01, 0x2a, 0x01, 0x32, 0x01, 0x3a, 0x01, 0x42, 0x01,
+  0x4a, 0x01, 0x00, 0x00, 0x18, 0x00, 0x4c, 0x00, 0x63, 0x00, 0x80, 0x00,
+  0x91, 0x00, 0xaa, 0x00, 0xbe, 0x00, 0xcd, 0x00, 0xdf, 0x00, 0xf2, 0x00,
+  0x0b, 0x01, 0x23, 0x01, 0x35, 0x01, 0x46, 0x01, 0x65, 0x01, 0x7e, 0x01,
+  0x87, 0x01, 0x93, 0x01, 0x9f, 0x01, 0xaa, 0x01, 0xb3, 0x01, 0xbd, 0x01,
+  0xc7, 0x01, 0xce, 0x01, 0xda, 0x01, 0xe6, 0x01, 0x00, 0x00, 0x1a, 0x00,
+  0x44, 0x00, 0x57, 0x00, 0x6a, 0x00, 0x75, 0x00, 0x96, 0x00, 0xb0, 0x00,
+  0xc6, 0x00, 0xdc, 0x00, 0xe7, 0x00, 0xf0, 0x00, 0xfb, 0x00, 0x06, 0x01,
+  0x11, 0x01, 0x18, 0x01, 0x20, 0x01, 0x29, 0x01, 0x31, 0x01, 0x3a, 0x01,
+  0x43, 0x01, 0x4c, 0x01, 0x5b, 0x01, 0x65, 0x01, 0x6f, 0x01, 0x7e, 0x01,
+  0x00, 0x00, 0x17, 0x00, 0x2b, 0x00, 0x57, 0x00, 0x66, 0x00, 0x87, 0x00,
+  0x9a, 0x00, 0xb1, 0x00, 0xbd, 0x00, 0xcb, 0x00, 0xd7, 0x00, 0xe4, 0x00,
+  0xf1, 0x00, 0x02, 0x01, 0x09, 0x01, 0x15, 0x01, 0x21, 0x01, 0x2f, 0x01,
+  0x3b, 0x01, 0x42, 0x01, 0x49, 0x01, 0x50, 0x01, 0x57, 0x01, 0x5e, 0x01,
+  0x00, 0x00, 0x1d, 0x00, 0x3a, 0x00, 0x56, 0x00, 0x6f, 0x00, 0x90, 0x00,
+  0xa9, 0x00, 0xb7, 0x00, 0xca, 0x00, 0xd7, 0x00, 0xe6, 0x00, 0xf3, 0x00,
+  0xff, 0x00, 0x0e, 0x01, 0x1d, 0x01, 0x30, 0x01, 0x4f, 0x01, 0x6d, 0x01,
+  0x79, 0x01, 0x81, 0x01, 0x89, 0x01, 0x91, 0x01, 0x97, 0x01, 0x9d, 0x01,
+  0xa3, 0x01, 0xa9, 0x01, 0xb2, 0x01, 0xbc, 0x01, 0xc4, 0x01, 0xcc, 0x01,
+  0xd4, 0x01, 0xdc, 0x01, 0xe4, 0x01, 0xea, 0x01, 0xf2, 0x01, 0xfb, 0x01,
+  0x03, 0x02, 0x0b, 0x02, 0x13, 0x02, 0x1b, 0x02, 0x23, 0x02, 0x2b, 0x02,
+  0x31, 0x02, 0x37, 0x02, 0x00, 0x00, 0x20, 0x00, 0x41, 0x00, 0x52, 0x00,
+  0x6c, 0x00, 0x8d, 0x00, 0xaf, 0x00, 0xc5, 0x00, 0xd9, 0x00, 0xf1, 0x00,
+  0x02, 0x01, 0x24, 0x01, 0x40, 0x01, 0x5b, 0x01, 0x6e, 0x01, 0x77, 0x01,
+  0x80, 0x01, 0x8b, 0x01, 0x95, 0x01, 0xa0, 0x01, 0xab, 0x01, 0xb5, 0x01,
+  0xc0, 0x01, 0x00, 0x00, 0x1e, 0x00, 0x2e, 0x00, 0x47, 0x00, 0x69, 0x00,
+  0x80, 0x00, 0x8c, 0x00, 0xa5, 0x00, 0xb3, 0x00, 0xbc, 0x00, 0xc4, 0x00,
+  0xd2, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x35, 0x00, 0x4d, 0x00, 0x5a, 0x00,
+  0x70, 0x00, 0x87, 0x00, 0x90, 0x00, 0x00, 0x00, 0x17, 0x00, 0x31, 0x00,
+  0x42, 0x00, 0x51, 0x00, 0x62, 0x00, 0x72, 0x00, 0x81, 0x00, 0x91, 0x00,
+  0xa1, 0x00, 0xb7, 0x00, 0xcb, 0x00, 0xdb, 0x00, 0xeb, 0x00, 0xf3, 0x00,
+  0xfb, 0x00, 0x03, 0x01, 0x09, 0x01, 0x0f, 0x01, 0x16, 0x01, 0x1e, 0x01,
+  0x24, 0x01, 0x00, 0x00, 0x1b, 0x00, 0x36, 0x00, 0x58, 0x00, 0x73, 0x00,
+  0x86, 0x00, 0xa1, 0x00, 0xb1, 0x00, 0xbc, 0x00, 0xc9, 0x00, 0xda, 0x00,
+  0xee, 0x00, 0xff, 0x00, 0x0c, 0x01, 0x16, 0x01, 0x1d, 0x01, 0x00, 0x00,
+  0x18, 0x00, 0x2f, 0x00, 0x4a, 0x00, 0x6b, 0x00, 0x92, 0x00, 0xac, 0x00,
+  0xbf, 0x00, 0xca, 0x00, 0xdc, 0x00, 0xee, 0x00, 0x00, 0x00, 0x22, 0x00,
+  0x31, 0x00, 0x4a, 0x00, 0x6c, 0x00, 0x8e, 0x00, 0xa8, 0x00, 0xbd, 0x00,
+  0x00, 0x00, 0x18, 0x00, 0x37, 0x00, 0x52, 0x00, 0x70, 0x00, 0x81, 0x00,
+  0x92, 0x00, 0x9b, 0x00, 0xa4, 0x00, 0xad, 0x00, 0xb6, 0x00, 0xbe, 0x00,
+  0xc8, 0x00, 0xd0, 0x00, 0x00, 0x00, 0x12, 0x00, 0x2f, 0x00, 0x45, 0x00,
+  0x63, 0x00, 0x73, 0x00, 0x80, 0x00, 0x8d, 0x00, 0x9d, 0x00, 0xaa, 0x00,
+  0xb1, 0x00, 0xb8, 0x00, 0xbf, 0x00, 0xc6, 0x00, 0xcd, 0x00, 0xd4, 0x00,
+  0xdb, 0x00, 0xe2, 0x00, 0xea, 0x00, 0x00, 0x00, 0x13, 0x00, 0x2c, 0x00,
+  0x46, 0x00, 0x5e, 0x00, 0x69, 0x00, 0x73, 0x00, 0x7b, 0x00, 0x82, 0x00,
+  0x89, 0x00, 0x96, 0x00, 0x9c, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x1f, 0x00,
+  0x4c, 0x00, 0x5d, 0x00, 0x84, 0x00, 0x8d, 0x00, 0x97, 0x00, 0xa0, 0x00,
+  0xaa, 0x00, 0xb4, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x19, 0x00, 0x35, 0x00,
+  0x5e, 0x00, 0x75, 0x00, 0x86, 0x00, 0x9f, 0x00, 0xa8, 0x00, 0xb1, 0x00,
+  0x00, 0x00, 0x17, 0x00, 0x23, 0x00, 0x3e, 0x00, 0x58, 0x00, 0x69, 0x00,
+  0x76, 0x00, 0x88, 0x00, 0xa2, 0x00, 0xbc, 0x00, 0xd0, 0x00, 0xda, 0x00,
+  0xe4, 0x00, 0xee, 0x00, 0xf8, 0x00, 0x02, 0x01, 0x0c, 0x01, 0x16, 0x01,
+  0x20, 0x01, 0x2a, 0x01, 0x34, 0x01, 0x3e, 0x01, 0x48, 0x01, 0x52, 0x01,
+  0x5c, 0x01, 0x66, 0x01, 0x70, 0x01, 0x7a, 0x01, 0x84, 0x01, 0x8e, 0x01,
+  0x98, 0x01, 0xa2, 0x01, 0xac, 0x01, 0xb6, 0x01, 0xc0, 0x01, 0xca, 0x01,
+  0xd4, 0x01, 0xde, 0x01, 0xe8, 0x01, 0xf2, 0x01, 0xfc, 0x01, 0x06, 0x02,
+  0x10, 0x02, 0x1a, 0x02, 0x24, 0x02, 0x2e, 0x02, 0x38, 0x02, 0x42, 0x02,
+  0x4c, 0x02, 0x55, 0x02, 0x5f, 0x02, 0x69, 0x02, 0x73, 0x02, 0x7d, 0x02,
+  0x87, 0x02, 0x8e, 0x02, 0x95, 0x02, 0x00, 0x00, 0x19, 0x00, 0x2a, 0x00,
+  0x43, 0x00, 0x63, 0x00, 0x76, 0x00, 0x82, 0x00, 0x94, 0x00, 0xa1, 0x00,
+  0xba, 0x00, 0xd4, 0x00, 0xef, 0x00, 0x08, 0x01, 0x20, 0x01, 0x39, 0x01,
+  0x50, 0x01, 0x67, 0x01, 0x7f, 0x01, 0x95, 0x01, 0xac, 0x01, 0xc4, 0x01,
+  0xda, 0x01, 0xf3, 0x01, 0x0a, 0x02, 0x24, 0x02, 0x3c, 0x02, 0x55, 0x02,
+  0x6c, 0x02, 0x84, 0x02, 0x9d, 0x02, 0xb5, 0x02, 0xcc, 0x02, 0xe2, 0x02,
+  0xf8, 0x02, 0x0d, 0x03, 0x23, 0x03, 0x38, 0x03, 0x4e, 0x03, 0x67, 0x03,
+  0x7e, 0x03, 0x94, 0x03, 0xa1, 0x03, 0xb7, 0x03, 0xcd, 0x03, 0xe5, 0x03,
+  0xfc, 0x03, 0x0e, 0x04, 0x25, 0x04, 0x39, 0x04, 0x4b, 0x04, 0x56, 0x04,
+  0x5d, 0x04, 0x67, 0x04, 0x71, 0x04, 0x7b, 0x04, 0x84, 0x04, 0x8b, 0x04,
+  0x96, 0x04, 0x9f, 0x04, 0x00, 0x00, 0x17, 0x00, 0x36, 0x00, 0x4d, 0x00,
+  0x5e, 0x00, 0x74, 0x00, 0x81, 0x00, 0x92, 0x00, 0x9b, 0x00, 0xa1, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x3b, 0x00, 0x54, 0x00, 0x61, 0x00, 0x70, 0x00,
+  0x8b, 0x00, 0x9b, 0x00, 0xad, 0x00, 0xbf, 0x00, 0xd9, 0x00, 0xf1, 0x00,
+  0xf9, 0x00, 0x05, 0x01, 0x0e, 0x01, 0x17, 0x01, 0x20, 0x01, 0x29, 0x01,
+  0x30, 0x01, 0x45, 0x01, 0x00, 0x00, 0x1d, 0x00, 0x47, 0x00, 0x5f, 0x00,
+  0x6d, 0x00, 0x82, 0x00, 0x96, 0x00, 0xb6, 0x00, 0xd7, 0x00, 0xea, 0x00,
+  0xf6, 0x00, 0x03, 0x01, 0x0a, 0x01, 0x16, 0x01, 0x00, 0x00, 0x0f, 0x00,
+  0x2e, 0x00, 0x3a, 0x00, 0x52, 0x00, 0x82, 0x00, 0x90, 0x00, 0xa0, 0x00,
+  0xa8, 0x00, 0xb3, 0x00, 0xbe, 0x00, 0xc9, 0x00, 0xd4, 0x00, 0xda, 0x00,
+  0xe5, 0x00, 0xf8, 0x00, 0x03, 0x01, 0x09, 0x01, 0x0f, 0x01, 0x1a, 0x01,
+  0x24, 0x01, 0x33, 0x01, 0x42, 0x01, 0x00, 0x00, 0x1c, 0x00, 0x3c, 0x00,
+  0x55, 0x00, 0x64, 0x00, 0x7b, 0x00, 0x8b, 0x00, 0x9b, 0x00, 0xb2, 0x00,
+  0xc8, 0x00, 0xd7, 0x00, 0xe3, 0x00, 0xef, 0x00, 0xfb, 0x00, 0x07, 0x01,
+  0x11, 0x01, 0x18, 0x01, 0x1f, 0x01, 0x26, 0x01, 0x2d, 0x01, 0x34, 0x01,
+  0x00, 0x00, 0x26, 0x00, 0x34, 0x00, 0x5b, 0x00, 0x6e, 0x00, 0x78, 0x00,
+  0x81, 0x00, 0x89, 0x00, 0x92, 0x00, 0x9b, 0x00, 0x00, 0x00, 0x28, 0x00,
+  0x3e, 0x00, 0x53, 0x00, 0x62, 0x00, 0x6f, 0x00, 0x83, 0x00, 0x97, 0x00,
+  0xa1, 0x00, 0xab, 0x00, 0xb5, 0x00, 0xbe, 0x00, 0xc5, 0x00, 0xce, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x3e, 0x00, 0x4e, 0x00, 0x5f, 0x00, 0x6f, 0x00,
+  0x7f, 0x00, 0x8e, 0x00, 0x9f, 0x00, 0xb7, 0x00, 0xc3, 0x00, 0xcb, 0x00,
+  0xd8, 0x00, 0xe0, 0x00, 0xe7, 0x00, 0xf4, 0x00, 0xff, 0x00, 0x08, 0x01,
+  0x00, 0x00, 0x20, 0x00, 0x3c, 0x00, 0x5e, 0x00, 0x70, 0x00, 0x7f, 0x00,
+  0x8c, 0x00, 0xa9, 0x00, 0xb5, 0x00, 0xbf, 0x00, 0xc9, 0x00, 0xd3, 0x00,
+  0x00, 0x00, 0x18, 0x00, 0x35, 0x00, 0x46, 0x00, 0x56, 0x00, 0x6a, 0x00,
+  0x7c, 0x00, 0x85, 0x00, 0x92, 0x00, 0xa4, 0x00, 0xb4, 0x00, 0x00, 0x00,
+  0x18, 0x00, 0x2e, 0x00, 0x43, 0x00, 0x5a, 0x00, 0x79, 0x00, 0x96, 0x00,
+  0xae, 0x00, 0xc4, 0x00, 0xd7, 0x00, 0xe8, 0x00, 0xf4, 0x00, 0xfb, 0x00,
+  0x02, 0x01, 0x08, 0x01, 0x12, 0x01, 0x1d, 0x01, 0x2a, 0x01, 0x00, 0x00,
+  0x26, 0x00, 0x39, 0x00, 0x4e, 0x00, 0x6b, 0x00, 0x7d, 0x00, 0x84, 0x00,
+  0x8b, 0x00, 0x91, 0x00, 0x97, 0x00, 0x9d, 0x00, 0xa3, 0x00, 0xae, 0x00,
+  0xb8, 0x00, 0x00, 0x00, 0x18, 0x00, 0x29, 0x00, 0x3e, 0x00, 0x4a, 0x00,
+  0x5a, 0x00, 0x66, 0x00, 0x6e, 0x00, 0x76, 0x00, 0x7e, 0x00, 0x86, 0x00,
+  0x8d, 0x00, 0x97, 0x00, 0xa1, 0x00, 0xab, 0x00, 0x00, 0x00, 0x12, 0x00,
+  0x2a, 0x00, 0x36, 0x00, 0x48, 0x00, 0x55, 0x00, 0x6d, 0x00, 0x82, 0x00,
+  0x8b, 0x00, 0x92, 0x00, 0x9e, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x17, 0x00,
+  0x41, 0x00, 0x57, 0x00, 0x68, 0x00, 0x7b, 0x00, 0x87, 0x00, 0x93, 0x00,
+  0x9d, 0x00, 0xa4, 0x00, 0xaa, 0x00, 0xb0, 0x00, 0xb9, 0x00, 0xbf, 0x00,
+  0x00, 0x00, 0x2e, 0x00, 0x3a, 0x00, 0x64, 0x00, 0x84, 0x00, 0x97, 0x00,
+  0xa0, 0x00, 0xab, 0x00, 0xb6, 0x00, 0xbc, 0x00, 0xc2, 0x00, 0xc8, 0x00,
+  0xd3, 0x00, 0xd9, 0x00, 0xdf, 0x00, 0xe5, 0x00, 0xee, 0x00, 0xfb, 0x00,
+  0x09, 0x01, 0x18, 0x01, 0x25, 0x01, 0x30, 0x01, 0x00, 0x00, 0x2e, 0x00,
+  0x51, 0x00, 0x72, 0x00, 0x8a, 0x00, 0x94, 0x00, 0xa8, 0x00, 0xc2, 0x00,
+  0xdd, 0x00, 0xf7, 0x00, 0x10, 0x01, 0x28, 0x01, 0x40, 0x01, 0x57, 0x01,
+  0x6f, 0x01, 0x86, 0x01, 0x9e, 0x01, 0xb9, 0x01, 0xd2, 0x01, 0xea, 0x01,
+  0x03, 0x02, 0x0c, 0x02, 0x13, 0x02, 0x1a, 0x02, 0x21, 0x02, 0x2a, 0x02,
+  0x00, 0x00, 0x18, 0x00, 0x35, 0x00, 0x49, 0x00, 0x6b, 0x00, 0x7c, 0x00,
+  0x8e, 0x00, 0xa6, 0x00, 0xbe, 0x00, 0xd5, 0x00, 0xed, 0x00, 0xf6, 0x00,
+  0xfc, 0x00, 0x02, 0x01, 0x08, 0x01, 0x14, 0x01, 0x1e, 0x01, 0x27, 0x01,
+  0x2d, 0x01, 0x36, 0x01, 0x3c, 0x01, 0x42, 0x01, 0x4a, 0x01, 0x55, 0x01,
+  0x00, 0x00, 0x10, 0x00, 0x1f, 0x00, 0x50, 0x00, 0x72, 0x00, 0x88, 0x00,
+  0x96, 0x00, 0xab, 0x00, 0xbf, 0x00, 0xd6, 0x00, 0xeb, 0x00, 0xf5, 0x00,
+  0xff, 0x00, 0x09, 0x01, 0x13, 0x01, 0x1e, 0x01, 0x28, 0x01, 0x30, 0x01,
+  0x3b, 0x01, 0x00, 0x00, 0x18, 0x00, 0x28, 0x00, 0x59, 0x00, 0x71, 0x00,
+  0x7b, 0x00, 0x8a, 0x00, 0x9b, 0x00, 0xa6, 0x00, 0xb1, 0x00, 0xc2, 0x00,
+  0xcb, 0x00, 0xd1, 0x00, 0xda, 0x00, 0xe3, 0x00, 0xed, 0x00, 0xf7, 0x00,
+  0x01, 0x01, 0x0a, 0x01, 0x15, 0x01, 0x23, 0x01, 0x00, 0x00, 0x1c, 0x00,
+  0x31, 0x00, 0x45, 0x00, 0x66, 0x00, 0x78, 0x00, 0x93, 0x00, 0xa4, 0x00,
+  0xb5, 0x00, 0xc5, 0x00, 0xd9, 0x00, 0xee, 0x00, 0xf7, 0x00, 0x00, 0x01,
+  0x09, 0x01, 0x13, 0x01, 0x00, 0x00, 0x1b, 0x00, 0x37, 0x00, 0x48, 0x00,
+  0x5f, 0x00, 0x68, 0x00, 0x6e, 0x00, 0x7a, 0x00, 0x81, 0x00, 0x8d, 0x00,
+  0x97, 0x00, 0xa2, 0x00, 0x00, 0x00, 0x12, 0x00, 0x2b, 0x00, 0x35, 0x00,
+  0x00, 0x00, 0x1b, 0x00, 0x4e, 0x00, 0x6a, 0x00, 0x76, 0x00, 0x82, 0x00,
+  0x8d, 0x00, 0xac, 0x00, 0xcc, 0x00, 0xeb, 0x00, 0x09, 0x01, 0x26, 0x01,
+  0x43, 0x01, 0x5f, 0x01, 0x7c, 0x01, 0x98, 0x01, 0xb5, 0x01, 0xd5, 0x01,
+  0xf3, 0x01, 0x10, 0x02, 0x16, 0x02, 0x21, 0x02, 0x27, 0x02, 0x2d, 0x02,
+  0x33, 0x02, 0x39, 0x02, 0x3f, 0x02, 0x45, 0x02, 0x4b, 0x02, 0x51, 0x02,
+  0x66, 0x02, 0x73, 0x02, 0x00, 0x00, 0x10, 0x00, 0x3e, 0x00, 0x5a, 0x00,
+  0x68, 0x00, 0x70, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x42, 0x00,
+  0x59, 0x00, 0x64, 0x00, 0x72, 0x00, 0x7c, 0x00, 0x90, 0x00, 0xb4, 0x00,
+  0xd6, 0x00, 0xdd, 0x00, 0xe6, 0x00, 0xf0, 0x00, 0xf9, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x27, 0x00, 0x36, 0x00, 0x48, 0x00, 0x55, 0x00, 0x6e, 0x00,
+  0x80, 0x00, 0x91, 0x00, 0x9b, 0x00, 0xa7, 0x00, 0xb1, 0x00, 0xb8, 0x00,
+  0xbf, 0x00, 0xc4, 0x00, 0xcb, 0x00, 0xd2, 0x00, 0xe7, 0x00, 0xf1, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x22, 0x00, 0x3f, 0x00, 0x4c, 0x00, 0x59, 0x00,
+  0x74, 0x00, 0x7c, 0x00, 0x84, 0x00, 0x90, 0x00, 0x98, 0x00, 0xa0, 0x00,
+  0xa8, 0x00, 0xb0, 0x00, 0xb8, 0x00, 0xc0, 0x00, 0xc8, 0x00, 0xd0, 0x00,
+  0xd8, 0x00, 0xe1, 0x00, 0xe9, 0x00, 0xf1, 0x00, 0xf9, 0x00, 0x01, 0x01,
+  0x09, 0x01, 0x11, 0x01, 0x19, 0x01, 0x21, 0x01, 0x29, 0x01, 0x3a, 0x01,
+  0x00, 0x00, 0x1e, 0x00, 0x4a, 0x00, 0x5c, 0x00, 0x6e, 0x00, 0x80, 0x00,
+  0x91, 0x00, 0x9d, 0x00, 0xa7, 0x00, 0xb1, 0x00, 0xba, 0x00, 0xc4, 0x00,
+  0xce, 0x00, 0xd7, 0x00, 0xe6, 0x00, 0xf0, 0x00, 0x00, 0x01, 0x0a, 0x01,
+  0x13, 0x01, 0x1c, 0x01, 0x00, 0x00, 0x0d, 0x00, 0x27, 0x00, 0x37, 0x00,
+  0x49, 0x00, 0x50, 0x00, 0x56, 0x00, 0x5d, 0x00, 0x65, 0x00, 0x6d, 0x00,
+  0x00, 0x00, 0x19, 0x00, 0x30, 0x00, 0x41, 0x00, 0x54, 0x00, 0x68, 0x00,
+  0x84, 0x00, 0x9e, 0x00, 0xaa, 0x00, 0xb4, 0x00, 0xbe, 0x00, 0xc4, 0x00,
+  0xcb, 0x00, 0xd2, 0x00, 0xd9, 0x00, 0xe4, 0x00, 0x00, 0x00, 0x1c, 0x00,
+  0x31, 0x00, 0x3e, 0x00, 0x4c, 0x00, 0x56, 0x00, 0x65, 0x00, 0x7c, 0x00,
+  0x92, 0x00, 0xa8, 0x00, 0xb3, 0x00, 0xbe, 0x00, 0xc6, 0x00, 0xce, 0x00,
+  0xd6, 0x00, 0xde, 0x00, 0xe6, 0x00, 0xee, 0x00, 0xf6, 0x00, 0x01, 0x01,
+  0x09, 0x01, 0x14, 0x01, 0x1d, 0x01, 0x26, 0x01, 0x2c, 0x01, 0x34, 0x01,
+  0x3c, 0x01, 0x44, 0x01, 0x4c, 0x01, 0x54, 0x01, 0x5c, 0x01, 0x64, 0x01,
+  0x6d, 0x01, 0x75, 0x01, 0x7d, 0x01, 0x86, 0x01, 0x8e, 0x01, 0x00, 0x00,
+  0x1b, 0x00, 0x31, 0x00, 0x47, 0x00, 0x59, 0x00, 0x66, 0x00, 0x6d, 0x00,
+  0x00, 0x00, 0x11, 0x00, 0x29, 0x00, 0x42, 0x00, 0x49, 0x00, 0x52, 0x00,
+  0x5b, 0x00, 0x65, 0x00, 0x00, 0x00, 0x18, 0x00, 0x35, 0x00, 0x48, 0x00,
+  0x59, 0x00, 0x6c, 0x00, 0x7e, 0x00, 0x92, 0x00, 0xa5, 0x00, 0xba, 0x00,
+  0xcf, 0x00, 0xe3, 0x00, 0x01, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x33, 0x01,
+  0x00, 0x00, 0x0d, 0x00, 0x26, 0x00, 0x41, 0x00, 0x54, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x26, 0x00, 0x39, 0x00, 0x4c, 0x00, 0x5f, 0x00, 0x72, 0x00,
+  0x85, 0x00, 0x98, 0x00, 0xab, 0x00, 0xc9, 0x00, 0xe6, 0x00, 0xf9, 0x00,
+  0x08, 0x01, 0x19, 0x01, 0x00, 0x00, 0x21, 0x00, 0x39, 0x00, 0x44, 0x00,
+  0x56, 0x00, 0x65, 0x00, 0x78, 0x00, 0x8a, 0x00, 0x9d, 0x00, 0xb0, 0x00,
+  0xc2, 0x00, 0xd4, 0x00, 0xe7, 0x00, 0xfa, 0x00, 0x0d, 0x01, 0x16, 0x01,
+  0x1f, 0x01, 0x28, 0x01, 0x31, 0x01, 0x3a, 0x01, 0x43, 0x01, 0x4f, 0x01,
+  0x59, 0x01, 0x63, 0x01, 0x6d, 0x01, 0x77, 0x01, 0x81, 0x01, 0x8b, 0x01,
+  0x95, 0x01, 0x9f, 0x01, 0xa8, 0x01, 0xb1, 0x01, 0xba, 0x01, 0xc3, 0x01,
+  0xcc, 0x01, 0xd5, 0x01, 0xde, 0x01, 0xe8, 0x01, 0xf2, 0x01, 0x00, 0x00,
+  0x1f, 0x00, 0x3e, 0x00, 0x50, 0x00, 0x6a, 0x00, 0x73, 0x00, 0x79, 0x00,
+  0x00, 0x00, 0x17, 0x00, 0x29, 0x00, 0x50, 0x00, 0x5f, 0x00, 0x77, 0x00,
+  0x91, 0x00, 0xa9, 0x00, 0xc3, 0x00, 0xdb, 0x00, 0xe6, 0x00, 0xef, 0x00,
+  0xf8, 0x00, 0x01, 0x01, 0x00, 0x00, 0x13, 0x00, 0x22, 0x00, 0x4f, 0x00,
+  0x66, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x30, 0x00, 0x3b, 0x00, 0x4d, 0x00,
+  0x61, 0x00, 0x00, 0x00, 0x11, 0x00, 0x20, 0x00, 0x2f, 0x00, 0x39, 0x00,
+  0x00, 0x00, 0x19, 0x00, 0x2a, 0x00, 0x42, 0x00, 0x4f, 0x00, 0x55, 0x00,
+  0x5b, 0x00, 0x65, 0x00, 0x72, 0x00, 0x7d, 0x00, 0x8c, 0x00, 0x96, 0x00,
+  0x00, 0x00, 0x14, 0x00, 0x29, 0x00, 0x3a, 0x00, 0x52, 0x00, 0x5b, 0x00,
+  0x64, 0x00, 0x70, 0x00, 0x79, 0x00, 0x84, 0x00, 0x8c, 0x00, 0x92, 0x00,
+  0x99, 0x00, 0xa0, 0x00, 0x00, 0x00, 0x24, 0x00, 0x38, 0x00, 0x52, 0x00,
+  0x6a, 0x00, 0x84, 0x00, 0x96, 0x00, 0xab, 0x00, 0xc8, 0x00, 0xe3, 0x00,
+  0xf8, 0x00, 0x11, 0x01, 0x1b, 0x01, 0x25, 0x01, 0x2f, 0x01, 0x3b, 0x01,
+  0x47, 0x01, 0x00, 0x00, 0x1a, 0x00, 0x25, 0x00, 0x2e, 0x00, 0x35, 0x00,
+  0x3e, 0x00, 0x47, 0x00, 0x4d, 0x00, 0x56, 0x00, 0x5f, 0x00, 0x68, 0x00,
+  0x79, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x36, 0x00, 0x41, 0x00, 0x4e, 0x00,
+  0x59, 0x00, 0x64, 0x00, 0x6f, 0x00, 0x7c, 0x00, 0x87, 0x00, 0x8d, 0x00,
+  0x94, 0x00, 0xa3, 0x00, 0x00, 0x00, 0x10, 0x00, 0x22, 0x00, 0x2b, 0x00,
+  0x34, 0x00, 0x3d, 0x00, 0x46, 0x00, 0x4f, 0x00, 0x58, 0x00, 0x61, 0x00,
+  0x6a, 0x00, 0x73, 0x00, 0x7c, 0x00, 0x85, 0x00, 0x8c, 0x00, 0x93, 0x00,
+  0x9a, 0x00, 0xa1, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x2d, 0x00, 0x5b, 0x00,
+  0x76, 0x00, 0x90, 0x00, 0xa8, 0x00, 0xb7, 0x00, 0xc3, 0x00, 0xce, 0x00,
+  0xda, 0x00, 0xe2, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x3c, 0x00, 0x4e, 0x00,
+  0x66, 0x00, 0x7c, 0x00, 0x94, 0x00, 0xaa, 0x00, 0xb8, 0x00, 0xc2, 0x00,
+  0xce, 0x00, 0xd8, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x48, 0x00, 0x53, 0x00,
+  0x65, 0x00, 0x78, 0x00, 0x85, 0x00, 0x8e, 0x00, 0x9a, 0x00, 0xa4, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x32, 0x00, 0x63, 0x00, 0x72, 0x00, 0x82, 0x00,
+  0x93, 0x00, 0x9c, 0x00, 0xa5, 0x00, 0xae, 0x00, 0xb5, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x2e, 0x00, 0x4b, 0x00, 0x59, 0x00, 0x67, 0x00, 0x71, 0x00,
+  0x7c, 0x00, 0x90, 0x00, 0xa5, 0x00, 0xb9, 0x00, 0xcd, 0x00, 0xd7, 0x00,
+  0xdd, 0x00, 0xe6, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x26, 0x00, 0x42, 0x00,
+  0x50, 0x00, 0x62, 0x00, 0x68, 0x00, 0x00, 0x00, 0x10, 0x00, 0x26, 0x00,
+  0x49, 0x00, 0x54, 0x00, 0x68, 0x00, 0x7a, 0x00, 0x83, 0x00, 0x8f, 0x00,
+  0x99, 0x00, 0xa2, 0x00, 0xa8, 0x00, 0xae, 0x00, 0xb4, 0x00, 0xbd, 0x00,
+  0xc6, 0x00, 0xcc, 0x00, 0xd2, 0x00, 0xdd, 0x00, 0xe6, 0x00, 0xf8, 0x00,
+  0x0a, 0x01, 0x1c, 0x01, 0x00, 0x00, 0x0f, 0x00, 0x20, 0x00, 0x48, 0x00,
+  0x59, 0x00, 0x6a, 0x00, 0x78, 0x00, 0x8a, 0x00, 0x9b, 0x00, 0xa4, 0x00,
+  0xab, 0x00, 0xb4, 0x00, 0xbd, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00,
+  0x1b, 0x00, 0x25, 0x00, 0x2c, 0x00, 0x35, 0x00, 0x3d, 0x00, 0x43, 0x00,
+  0x4a, 0x00, 0x56, 0x00, 0x5e, 0x00, 0x66, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x1c, 0x00, 0x2a, 0x00, 0x37, 0x00, 0x45, 0x00, 0x54, 0x00, 0x70, 0x00,
+  0x8d, 0x00, 0xa9, 0x00, 0xc4, 0x00, 0xde, 0x00, 0xf8, 0x00, 0x11, 0x01,
+  0x2b, 0x01, 0x44, 0x01, 0x5e, 0x01, 0x7b, 0x01, 0x96, 0x01, 0xb0, 0x01,
+  0xbf, 0x01, 0xcc, 0x01, 0xdc, 0x01, 0xeb, 0x01, 0xf3, 0x01, 0xfc, 0x01,
+  0x05, 0x02, 0x0d, 0x02, 0x15, 0x02, 0x1d, 0x02, 0x25, 0x02, 0x2d, 0x02,
+  0x35, 0x02, 0x3d, 0x02, 0x45, 0x02, 0x4d, 0x02, 0x55, 0x02, 0x5d, 0x02,
+  0x66, 0x02, 0x6f, 0x02, 0x78, 0x02, 0x80, 0x02, 0x89, 0x02, 0x92, 0x02,
+  0x9a, 0x02, 0xa2, 0x02, 0xaa, 0x02, 0xb2, 0x02, 0xba, 0x02, 0xc2, 0x02,
+  0xca, 0x02, 0xd2, 0x02, 0xda, 0x02, 0xe2, 0x02, 0xea, 0x02, 0xf2, 0x02,
+  0xfa, 0x02, 0x03, 0x03, 0x0c, 0x03, 0x14, 0x03, 0x1c, 0x03, 0x24, 0x03,
+  0x2c, 0x03, 0x34, 0x03, 0x3c, 0x03, 0x45, 0x03, 0x54, 0x03, 0x67, 0x03,
+  0x00, 0x00, 0x0a, 0x00, 0x1e, 0x00, 0x32, 0x00, 0x4c, 0x00, 0x66, 0x00,
+  0x7a, 0x00, 0x88, 0x00, 0x91, 0x00, 0x00, 0x00, 0x11, 0x00, 0x1f, 0x00,
+  0x2f, 0x00, 0x37, 0x00, 0x42, 0x00, 0x49, 0x00, 0x52, 0x00, 0x58, 0x00,
+  0x00, 0x00, 0x0f, 0x00, 0x19, 0x00, 0x2e, 0x00, 0x43, 0x00, 0x4d, 0x00,
+  0x56, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x29, 0x00, 0x38, 0x00, 0x54, 0x00,
+  0x71, 0x00, 0x8d, 0x00, 0xa8, 0x00, 0xc2, 0x00, 0xdc, 0x00, 0xf5, 0x00,
+  0x0f, 0x01, 0x28, 0x01, 0x43, 0x01, 0x5d, 0x01, 0x7a, 0x01, 0x95, 0x01,
+  0xb0, 0x01, 0xcb, 0x01, 0xe5, 0x01, 0xf4, 0x01, 0x04, 0x02, 0x13, 0x02,
+  0x22, 0x02, 0x38, 0x02, 0x40, 0x02, 0x4b, 0x02, 0x53, 0x02, 0x5e, 0x02,
+  0x66, 0x02, 0x6e, 0x02, 0x76, 0x02, 0x7e, 0x02, 0x86, 0x02, 0x8e, 0x02,
+  0x96, 0x02, 0x9e, 0x02, 0xa6, 0x02, 0xae, 0x02, 0xb6, 0x02, 0xbe, 0x02,
+  0xc7, 0x02, 0xd0, 0x02, 0xd9, 0x02, 0xe1, 0x02, 0xea, 0x02, 0xf2, 0x02,
+  0xfa, 0x02, 0x02, 0x03, 0x0a, 0x03, 0x12, 0x03, 0x1a, 0x03, 0x22, 0x03,
+  0x2a, 0x03, 0x32, 0x03, 0x3a, 0x03, 0x42, 0x03, 0x4a, 0x03, 0x53, 0x03,
+  0x5c, 0x03, 0x65, 0x03, 0x6d, 0x03, 0x75, 0x03, 0x7d, 0x03, 0x85, 0x03,
+  0x8d, 0x03, 0x95, 0x03, 0x9d, 0x03, 0xa5, 0x03, 0xad, 0x03, 0xb5, 0x03,
+  0xbb, 0x03, 0xc3, 0x03, 0xcb, 0x03, 0xd4, 0x03, 0xdc, 0x03, 0xe4, 0x03,
+  0xec, 0x03, 0x00, 0x00, 0x14, 0x00, 0x25, 0x00, 0x2b, 0x00, 0x35, 0x00,
+  0x00, 0x00, 0x0f, 0x00, 0x19, 0x00, 0x29, 0x00, 0x41, 0x00, 0x59, 0x00,
+  0x63, 0x00, 0x00, 0x00, 0x16, 0x00, 0x2d, 0x00, 0x37, 0x00, 0x49, 0x00,
+  0x56, 0x00, 0x63, 0x00, 0x70, 0x00, 0x7d, 0x00, 0x8a, 0x00, 0x97, 0x00,
+  0xa4, 0x00, 0xb1, 0x00, 0xbe, 0x00, 0xcb, 0x00, 0xd2, 0x00, 0xda, 0x00,
+  0x00, 0x00, 0x1b, 0x00, 0x33, 0x00, 0x46, 0x00, 0x59, 0x00, 0x6b, 0x00,
+  0x7e, 0x00, 0x8a, 0x00, 0x95, 0x00, 0xa0, 0x00, 0xa7, 0x00, 0xb5, 0x00,
+  0x00, 0x00, 0x18, 0x00, 0x2b, 0x00, 0x3e, 0x00, 0x51, 0x00, 0x68, 0x00,
+  0x79, 0x00, 0x8a, 0x00, 0x95, 0x00, 0xa0, 0x00, 0x00, 0x00, 0x0d, 0x00,
+  0x1e, 0x00, 0x30, 0x00, 0x43, 0x00, 0x55, 0x00, 0x68, 0x00, 0x7a, 0x00,
+  0x8c, 0x00, 0x9f, 0x00, 0xb2, 0x00, 0xc5, 0x00, 0xd7, 0x00, 0xea, 0x00,
+  0xfd, 0x00, 0x10, 0x01, 0x23, 0x01, 0x36, 0x01, 0x4a, 0x01, 0x5c, 0x01,
+  0x65, 0x01, 0x6e, 0x01, 0x77, 0x01, 0x80, 0x01, 0x89, 0x01, 0x92, 0x01,
+  0x9b, 0x01, 0xa5, 0x01, 0xaf, 0x01, 0xb9, 0x01, 0xc2, 0x01, 0xcb, 0x01,
+  0xd4, 0x01, 0xdd, 0x01, 0xe6, 0x01, 0xef, 0x01, 0xf8, 0x01, 0x01, 0x02,
+  0x0a, 0x02, 0x13, 0x02, 0x1c, 0x02, 0x25, 0x02, 0x2e, 0x02, 0x37, 0x02,
+  0x40, 0x02, 0x49, 0x02, 0x52, 0x02, 0x5b, 0x02, 0x65, 0x02, 0x6f, 0x02,
+  0x79, 0x02, 0x83, 0x02, 0x8d, 0x02, 0x96, 0x02, 0x9f, 0x02, 0xa8, 0x02,
+  0xb1, 0x02, 0xba, 0x02, 0xc3, 0x02, 0x00, 0x00, 0x0e, 0x00, 0x20, 0x00,
+  0x32, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x25, 0x00, 0x3a, 0x00,
+  0x48, 0x00, 0x55, 0x00, 0x65, 0x00, 0x74, 0x00, 0x7f, 0x00, 0x89, 0x00,
+  0x95, 0x00, 0xa0, 0x00, 0xab, 0x00, 0xb6, 0x00, 0xc1, 0x00, 0xcc, 0x00,
+  0xd2, 0x00, 0xdd, 0x00, 0xe9, 0x00, 0x00, 0x00, 0x18, 0x00, 0x21, 0x00,
+  0x00, 0x00, 0x21, 0x00, 0x31, 0x00, 0x3e, 0x00, 0x49, 0x00, 0x65, 0x00,
+  0x00, 0x00, 0x15, 0x00, 0x1f, 0x00, 0x25, 0x00, 0x2d, 0x00, 0x3d, 0x00,
+  0x00, 0x00, 0x19, 0x00, 0x1f, 0x00, 0x25, 0x00, 0x2c, 0x00, 0x38, 0x00,
+  0x42, 0x00, 0x00, 0x00, 0x18, 0x00, 0x24, 0x00, 0x36, 0x00, 0x42, 0x00,
+  0x4f, 0x00, 0x64, 0x00, 0x78, 0x00, 0x89, 0x00, 0x99, 0x00, 0xa5, 0x00,
+  0xad, 0x00, 0xb5, 0x00, 0xbc, 0x00, 0xc3, 0x00, 0xca, 0x00, 0xd1, 0x00,
+  0xd8, 0x00, 0x00, 0x00, 0x14, 0x00, 0x30, 0x00, 0x00, 0x00, 0x1d, 0x00,
+  0x36, 0x00, 0x47, 0x00, 0x57, 0x00, 0x67, 0x00, 0x78, 0x00, 0x89, 0x00,
+  0x9b, 0x00, 0xac, 0x00, 0xbe, 0x00, 0xd4, 0x00, 0xeb, 0x00, 0xf6, 0x00,
+  0xff, 0x00, 0x08, 0x01, 0x11, 0x01, 0x1a, 0x01, 0x20, 0x01, 0x29, 0x01,
+  0x33, 0x01, 0x3c, 0x01, 0x45, 0x01, 0x4e, 0x01, 0x57, 0x01, 0x61, 0x01,
+  0x6b, 0x01, 0x76, 0x01, 0x81, 0x01, 0x88, 0x01, 0x00, 0x00, 0x1f, 0x00,
+  0x3f, 0x00, 0x5e, 0x00, 0x7c, 0x00, 0x99, 0x00, 0xb6, 0x00, 0xd2, 0x00,
+  0xef, 0x00, 0x0b, 0x01, 0x28, 0x01, 0x48, 0x01, 0x66, 0x01, 0x83, 0x01,
+  0x98, 0x01, 0xad, 0x01, 0xc1, 0x01, 0xe5, 0x01, 0xef, 0x01, 0xfc, 0x01,
+  0x08, 0x02, 0x0f, 0x02, 0x15, 0x02, 0x1c, 0x02, 0x26, 0x02, 0x2d, 0x02,
+  0x36, 0x02, 0x3d, 0x02, 0x00, 0x00, 0x1b, 0x00, 0x41, 0x00, 0x5a, 0x00,
+  0x65, 0x00, 0x78, 0x00, 0x8e, 0x00, 0xa3, 0x00, 0xb9, 0x00, 0xcd, 0x00,
+  0xe2, 0x00, 0xf5, 0x00, 0xfe, 0x00, 0x07, 0x01, 0x10, 0x01, 0x19, 0x01,
+  0x22, 0x01, 0x2b, 0x01, 0x34, 0x01, 0x3d, 0x01, 0x46, 0x01, 0x4f, 0x01,
+  0x58, 0x01, 0x61, 0x01, 0x6a, 0x01, 0x73, 0x01, 0x7c, 0x01, 0x85, 0x01,
+  0x8e, 0x01, 0x94, 0x01, 0x9e, 0x01, 0xa7, 0x01, 0xae, 0x01, 0x00, 0x00,
+  0x1f, 0x00, 0x33, 0x00, 0x47, 0x00, 0x51, 0x00, 0x5b, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x45, 0x00, 0x54, 0x00, 0x64, 0x00, 0x75, 0x00, 0x82, 0x00,
+  0x93, 0x00, 0xa4, 0x00, 0xb5, 0x00, 0xc7, 0x00, 0xd9, 0x00, 0xea, 0x00,
+  0xff, 0x00, 0x14, 0x01, 0x1c, 0x01, 0x25, 0x01, 0x2e, 0x01, 0x37, 0x01,
+  0x3e, 0x01, 0x47, 0x01, 0x50, 0x01, 0x59, 0x01, 0x63, 0x01, 0x6c, 0x01,
+  0x00, 0x00, 0x1f, 0x00, 0x3b, 0x00, 0x49, 0x00, 0x5b, 0x00, 0x67, 0x00,
+  0x73, 0x00, 0x85, 0x00, 0x91, 0x00, 0xa6, 0x00, 0xbb, 0x00, 0xd0, 0x00,
+  0xd6, 0x00, 0xe0, 0x00, 0xe7, 0x00, 0xed, 0x00, 0x00, 0x00, 0x24, 0x00,
+  0x4e, 0x00, 0x62, 0x00, 0x70, 0x00, 0x7d, 0x00, 0x87, 0x00, 0x94, 0x00,
+  0xa7, 0x00, 0xba, 0x00, 0xc3, 0x00, 0xce, 0x00, 0xd9, 0x00, 0xe1, 0x00,
+  0x00, 0x00, 0x19, 0x00, 0x37, 0x00, 0x4d, 0x00, 0x5d, 0x00, 0x74, 0x00,
+  0x89, 0x00, 0x9d, 0x00, 0xb4, 0x00, 0xbe, 0x00, 0xc4, 0x00, 0xca, 0x00,
+  0xd0, 0x00, 0x00, 0x00, 0x19, 0x00, 0x38, 0x00, 0x42, 0x00, 0x60, 0x00,
+  0x7e, 0x00, 0x9c, 0x00, 0xb9, 0x00, 0xd5, 0x00, 0xf1, 0x00, 0x0c, 0x01,
+  0x28, 0x01, 0x43, 0x01, 0x5e, 0x01, 0x7b, 0x01, 0x96, 0x01, 0xaf, 0x01,
+  0xbe, 0x01, 0xd3, 0x01, 0xeb, 0x01, 0x01, 0x02, 0x00, 0x00, 0x10, 0x00,
+  0x1b, 0x00, 0x26, 0x00, 0x31, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x57, 0x00,
+  0x66, 0x00, 0x75, 0x00, 0x84, 0x00, 0x9b, 0x00, 0xb2, 0x00, 0xc5, 0x00,
+  0xdb, 0x00, 0xef, 0x00, 0xfb, 0x00, 0x07, 0x01, 0x13, 0x01, 0x1f, 0x01,
+  0x2b, 0x01, 0x37, 0x01, 0x43, 0x01, 0x4f, 0x01, 0x5b, 0x01, 0x67, 0x01,
+  0x73, 0x01, 0x7f, 0x01, 0x8b, 0x01, 0x97, 0x01, 0xa1, 0x01, 0xab, 0x01,
+  0x00, 0x00, 0x15, 0x00, 0x38, 0x00, 0x53, 0x00, 0x65, 0x00, 0x78, 0x00,
+  0x94, 0x00, 0x9c, 0x00, 0xa5, 0x00, 0x00, 0x00, 0x38, 0x00, 0x58, 0x00,
+  0x75, 0x00, 0x85, 0x00, 0x8f, 0x00, 0xab, 0x00, 0xb8, 0x00, 0xc5, 0x00,
+  0xd2, 0x00, 0xe0, 0x00, 0xee, 0x00, 0xfc, 0x00, 0x0a, 0x01, 0x18, 0x01,
+  0x26, 0x01, 0x34, 0x01, 0x42, 0x01, 0x50, 0x01, 0x5e, 0x01, 0x6c, 0x01,
+  0x7a, 0x01, 0x88, 0x01, 0x96, 0x01, 0xa4, 0x01, 0xb2, 0x01, 0xc0, 0x01,
+  0xce, 0x01, 0xdc, 0x01, 0xea, 0x01, 0xf8, 0x01, 0x06, 0x02, 0x14, 0x02,
+  0x22, 0x02, 0x30, 0x02, 0x3e, 0x02, 0x4c, 0x02, 0x5a, 0x02, 0x68, 0x02,
+  0x76, 0x02, 0x80, 0x02, 0x8a, 0x02, 0x94, 0x02, 0x9b, 0x02, 0xa2, 0x02,
+  0xa9, 0x02, 0xb0, 0x02, 0x00, 0x00, 0x1b, 0x00, 0x38, 0x00, 0x4d, 0x00,
+  0x5a, 0x00, 0x70, 0x00, 0x7e, 0x00, 0x8b, 0x00, 0x9a, 0x00, 0xa4, 0x00,
+  0xbc, 0x00, 0xd2, 0x00, 0xda, 0x00, 0xe2, 0x00, 0xea, 0x00, 0xf2, 0x00,
+  0xfa, 0x00, 0x02, 0x01, 0x0b, 0x01, 0x13, 0x01, 0x1b, 0x01, 0x23, 0x01,
+  0x2b, 0x01, 0x33, 0x01, 0x3b, 0x01, 0x43, 0x01, 0x4b, 0x01, 0x53, 0x01,
+  0x5c, 0x01, 0x65, 0x01, 0x6d, 0x01, 0x76, 0x01, 0x7e, 0x01, 0x86, 0x01,
+  0x8e, 0x01, 0x96, 0x01, 0x00, 0x00, 0x0d, 0x00, 0x1b, 0x00, 0x40, 0x00,
+  0x51, 0x00, 0x63, 0x00, 0x74, 0x00, 0x82, 0x00, 0x94, 0x00, 0xa6, 0x00,
+  0xbe, 0x00, 0xd4, 0x00, 0xeb, 0x00, 0xf6, 0x00, 0x01, 0x01, 0x0b, 0x01,
+  0x15, 0x01, 0x1f, 0x01, 0x2c, 0x01, 0x35, 0x01, 0x3e, 0x01, 0x47, 0x01,
+  0x50, 0x01, 0x00, 0x00, 0x28, 0x00, 0x3b, 0x00, 0x50, 0x00, 0x6a, 0x00,
+  0x72, 0x00, 0x7c, 0x00, 0x82, 0x00, 0x88, 0x00, 0xa1, 0x00, 0x00, 0x00,
+  0x1a, 0x00, 0x27, 0x00, 0x3f, 0x00, 0x54, 0x00, 0x68, 0x00, 0x7a, 0x00,
+  0x84, 0x00, 0x8b, 0x00, 0x92, 0x00, 0x9a, 0x00, 0xa4, 0x00, 0xaa, 0x00,
+  0xb0, 0x00, 0xb7, 0x00, 0xbe, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1a, 0x00,
+  0x39, 0x00, 0x47, 0x00, 0x55, 0x00, 0x63, 0x00, 0x71, 0x00, 0x7e, 0x00,
+  0x88, 0x00, 0x97, 0x00, 0xac, 0x00, 0xc0, 0x00, 0xca, 0x00, 0xd2, 0x00,
+  0xdb, 0x00, 0xe7, 0x00, 0xf3, 0x00, 0xfc, 0x00, 0x04, 0x01, 0x0c, 0x01,
+  0x14, 0x01, 0x1c, 0x01, 0x24, 0x01, 0x2c, 0x01, 0x34, 0x01, 0x3d, 0x01,
+  0x00, 0x00, 0x18, 0x00, 0x28, 0x00, 0x3e, 0x00, 0x4b, 0x00, 0x5e, 0x00,
+  0x6f, 0x00, 0x78, 0x00, 0x81, 0x00, 0x8e, 0x00, 0x98, 0x00, 0xa5, 0x00,
+  0xb2, 0x00, 0xbb, 0x00, 0xc4, 0x00, 0xcd, 0x00, 0xd6, 0x00, 0xdf, 0x00,
+  0xe8, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x1c, 0x00, 0x2b, 0x00, 0x3a, 0x00,
+  0x4c, 0x00, 0x5e, 0x00, 0x6a, 0x00, 0x79, 0x00, 0x85, 0x00, 0x91, 0x00,
+  0x99, 0x00, 0xa1, 0x00, 0xaa, 0x00, 0xb3, 0x00, 0xbd, 0x00, 0xc7, 0x00,
+  0xd1, 0x00, 0xdb, 0x00, 0xe5, 0x00, 0xef, 0x00, 0xf9, 0x00, 0x03, 0x01,
+  0x0d, 0x01, 0x17, 0x01, 0x00, 0x00, 0x0b, 0x00, 0x1b, 0x00, 0x2b, 0x00,
+  0x3a, 0x00, 0x47, 0x00, 0x56, 0x00, 0x60, 0x00, 0x6a, 0x00, 0x00, 0x00,
+  0x1e, 0x00, 0x2d, 0x00, 0x3c, 0x00, 0x51, 0x00, 0x63, 0x00, 0x81, 0x00,
+  0x9e, 0x00, 0xb6, 0x00, 0xce, 0x00, 0xe0, 0x00, 0xf3, 0x00, 0x04, 0x01,
+  0x00, 0x00, 0x26, 0x00, 0x3e, 0x00, 0x4f, 0x00, 0x5e, 0x00, 0x6a, 0x00,
+  0x78, 0x00, 0x86, 0x00, 0x95, 0x00, 0xad, 0x00, 0xbc, 0x00, 0xcb, 0x00,
+  0xda, 0x00, 0xe9, 0x00, 0xf8, 0x00, 0x07, 0x01, 0x16, 0x01, 0x25, 0x01,
+  0x34, 0x01, 0x43, 0x01, 0x52, 0x01, 0x61, 0x01, 0x70, 0x01, 0x7f, 0x01,
+  0x8e, 0x01, 0x9d, 0x01, 0xac, 0x01, 0xbb, 0x01, 0xca, 0x01, 0xd9, 0x01,
+  0xe8, 0x01, 0xf7, 0x01, 0x06, 0x02, 0x15, 0x02, 0x24, 0x02, 0x33, 0x02,
+  0x42, 0x02, 0x51, 0x02, 0x60, 0x02, 0x6f, 0x02, 0x7e, 0x02, 0x90, 0x02,
+  0x9f, 0x02, 0xae, 0x02, 0xbd, 0x02, 0xcc, 0x02, 0xdb, 0x02, 0xeb, 0x02,
+  0xf4, 0x02, 0x00, 0x00, 0x0f, 0x00, 0x1d, 0x00, 0x30, 0x00, 0x42, 0x00,
+  0x54, 0x00, 0x66, 0x00, 0x7c, 0x00, 0x8f, 0x00, 0x9e, 0x00, 0xa7, 0x00,
+  0xb3, 0x00, 0xbf, 0x00, 0xd2, 0x00, 0xde, 0x00, 0xea, 0x00, 0xf3, 0x00,
+  0xfc, 0x00, 0x05, 0x01, 0x0e, 0x01, 0x17, 0x01, 0x24, 0x01, 0x37, 0x01,
+  0x40, 0x01, 0x49, 0x01, 0x00, 0x00, 0x1d, 0x00, 0x2b, 0x00, 0x36, 0x00,
+  0x4b, 0x00, 0x60, 0x00, 0x75, 0x00, 0x8c, 0x00, 0x96, 0x00, 0xa6, 0x00,
+  0xb0, 0x00, 0xba, 0x00, 0xc4, 0x00, 0xcd, 0x00, 0xd6, 0x00, 0xe0, 0x00,
+  0xea, 0x00, 0xf4, 0x00, 0xfe, 0x00, 0x08, 0x01, 0x12, 0x01, 0x1c, 0x01,
+  0x23, 0x01, 0x2d, 0x01, 0x37, 0x01, 0x41, 0x01, 0x00, 0x00, 0x11, 0x00,
+  0x1d, 0x00, 0x26, 0x00, 0x31, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1a, 0x00,
+  0x29, 0x00, 0x35, 0x00, 0x43, 0x00, 0x51, 0x00, 0x60, 0x00, 0x6f, 0x00,
+  0x7e, 0x00, 0x8d, 0x00, 0x9c, 0x00, 0xab, 0x00, 0xba, 0x00, 0xc9, 0x00,
+  0xd8, 0x00, 0xe7, 0x00, 0xf6, 0x00, 0x05, 0x01, 0x14, 0x01, 0x23, 0x01,
+  0x32, 0x01, 0x41, 0x01, 0x50, 0x01, 0x5f, 0x01, 0x6e, 0x01, 0x7d, 0x01,
+  0x8c, 0x01, 0x9b, 0x01, 0xaa, 0x01, 0xb9, 0x01, 0xc8, 0x01, 0xd7, 0x01,
+  0xe6, 0x01, 0xf5, 0x01, 0x04, 0x02, 0x13, 0x02, 0x22, 0x02, 0x31, 0x02,
+  0x40, 0x02, 0x4f, 0x02, 0x5e, 0x02, 0x6d, 0x02, 0x7c, 0x02, 0x8b, 0x02,
+  0x9a, 0x02, 0xa9, 0x02, 0xb8, 0x02, 0xc7, 0x02, 0xd6, 0x02, 0xe2, 0x02,
+  0xef, 0x02, 0xf7, 0x02, 0x00, 0x00, 0x0e, 0x00, 0x1b, 0x00, 0x35, 0x00,
+  0x56, 0x00, 0x69, 0x00, 0x75, 0x00, 0x81, 0x00, 0x00, 0x00, 0x1c, 0x00,
+  0x28, 0x00, 0x36, 0x00, 0x46, 0x00, 0x5e, 0x00, 0x71, 0x00, 0x80, 0x00,
+  0xa0, 0x00, 0xc1, 0x00, 0xe1, 0x00, 0x00, 0x01, 0x1e, 0x01, 0x3c, 0x01,
+  0x59, 0x01, 0x77, 0x01, 0x94, 0x01, 0xb2, 0x01, 0xd0, 0x01, 0xf1, 0x01,
+  0x10, 0x02, 0x2f, 0x02, 0x4d, 0x02, 0x6b, 0x02, 0x80, 0x02, 0x95, 0x02,
+  0xa9, 0x02, 0xc5, 0x02, 0xd8, 0x02, 0xf3, 0x02, 0x0c, 0x03, 0x23, 0x03,
+  0x3b, 0x03, 0x51, 0x03, 0x6a, 0x03, 0x74, 0x03, 0x7e, 0x03, 0x88, 0x03,
+  0x92, 0x03, 0x9a, 0x03, 0xa0, 0x03, 0xa9, 0x03, 0xb5, 0x03, 0xbf, 0x03,
+  0xc8, 0x03, 0xd0, 0x03, 0xda, 0x03, 0xe4, 0x03, 0xef, 0x03, 0xfa, 0x03,
+  0x05, 0x04, 0x10, 0x04, 0x1b, 0x04, 0x25, 0x04, 0x2f, 0x04, 0x39, 0x04,
+  0x43, 0x04, 0x00, 0x00, 0x0b, 0x00, 0x1a, 0x00, 0x2e, 0x00, 0x46, 0x00,
+  0x58, 0x00, 0x6d, 0x00, 0x82, 0x00, 0x8c, 0x00, 0x96, 0x00, 0xa1, 0x00,
+  0x00, 0x00, 0x15, 0x00, 0x3c, 0x00, 0x49, 0x00, 0x59, 0x00, 0x7a, 0x00,
+  0x94, 0x00, 0xa0, 0x00, 0xac, 0x00, 0xbe, 0x00, 0xca, 0x00, 0xd4, 0x00,
+  0xdc, 0x00, 0xe4, 0x00, 0xeb, 0x00, 0xf2, 0x00, 0xf9, 0x00, 0x01, 0x01,
+  0x0a, 0x01, 0x11, 0x01, 0x19, 0x01, 0x26, 0x01, 0x00, 0x00, 0x1d, 0x00,
+  0x2a, 0x00, 0x37, 0x00, 0x44, 0x00, 0x5e, 0x00, 0x69, 0x00, 0x75, 0x00,
+  0x8a, 0x00, 0xa1, 0x00, 0xb7, 0x00, 0xcc, 0x00, 0xe7, 0x00, 0xf2, 0x00,
+  0x01, 0x01, 0x0f, 0x01, 0x1b, 0x01, 0x00, 0x00, 0x1e, 0x00, 0x42, 0x00,
+  0x4e, 0x00, 0x61, 0x00, 0x7b, 0x00, 0x9f, 0x00, 0xb0, 0x00, 0xc1, 0x00,
+  0xda, 0x00, 0xf2, 0x00, 0x0d, 0x01, 0x29, 0x01, 0x44, 0x01, 0x5e, 0x01,
+  0x77, 0x01, 0x90, 0x01, 0xa8, 0x01, 0xc1, 0x01, 0xd9, 0x01, 0xf2, 0x01,
+  0x0e, 0x02, 0x28, 0x02, 0x41, 0x02, 0x52, 0x02, 0x64, 0x02, 0x76, 0x02,
+  0x91, 0x02, 0xa2, 0x02, 0xb4, 0x02, 0xc6, 0x02, 0xdd, 0x02, 0xe6, 0x02,
+  0xef, 0x02, 0xf7, 0x02, 0xff, 0x02, 0x09, 0x03, 0x13, 0x03, 0x1d, 0x03,
+  0x27, 0x03, 0x31, 0x03, 0x3b, 0x03, 0x44, 0x03, 0x4d, 0x03, 0x56, 0x03,
+  0x5f, 0x03, 0x6c, 0x03, 0x76, 0x03, 0x00, 0x00, 0x1d, 0x00, 0x37, 0x00,
+  0x53, 0x00, 0x5e, 0x00, 0x70, 0x00, 0x7d, 0x00, 0x95, 0x00, 0xa2, 0x00,
+  0xb7, 0x00, 0xc3, 0x00, 0xcf, 0x00, 0xd9, 0x00, 0xe3, 0x00, 0xed, 0x00,
+  0xfc, 0x00, 0x0c, 0x01, 0x00, 0x00, 0x29, 0x00, 0x46, 0x00, 0x67, 0x00,
+  0x8f, 0x00, 0xa5, 0x00, 0xb4, 0x00, 0xc7, 0x00, 0xde, 0x00, 0xeb, 0x00,
+  0xfd, 0x00, 0x13, 0x01, 0x27, 0x01, 0x2e, 0x01, 0x38, 0x01, 0x42, 0x01,
+  0x4c, 0x01, 0x54, 0x01, 0x5b, 0x01, 0x62, 0x01, 0x69, 0x01, 0x70, 0x01,
+  0x77, 0x01, 0x7f, 0x01, 0x8c, 0x01, 0x00, 0x00, 0x25, 0x00, 0x53, 0x00,
+  0x67, 0x00, 0x78, 0x00, 0x8f, 0x00, 0xa0, 0x00, 0xb9, 0x00, 0xc5, 0x00,
+  0xcf, 0x00, 0xdb, 0x00, 0xe4, 0x00, 0xed, 0x00, 0x00, 0x00, 0x1d, 0x00,
+  0x3a, 0x00, 0x57, 0x00, 0x67, 0x00, 0x7d, 0x00, 0x96, 0x00, 0xae, 0x00,
+  0xc2, 0x00, 0xd0, 0x00, 0xe2, 0x00, 0xf4, 0x00, 0x06, 0x01, 0x18, 0x01,
+  0x2b, 0x01, 0x3d, 0x01, 0x55, 0x01, 0x6d, 0x01, 0x86, 0x01, 0x9f, 0x01,
+  0xb7, 0x01, 0xd1, 0x01, 0xea, 0x01, 0x02, 0x02, 0x0a, 0x02, 0x13, 0x02,
+  0x1c, 0x02, 0x25, 0x02, 0x2e, 0x02, 0x38, 0x02, 0x41, 0x02, 0x4a, 0x02,
+  0x53, 0x02, 0x5c, 0x02, 0x65, 0x02, 0x6e, 0x02, 0x00, 0x00, 0x1c, 0x00,
+  0x41, 0x00, 0x50, 0x00, 0x5e, 0x00, 0x79, 0x00, 0x9f, 0x00, 0xac, 0x00,
+  0xc2, 0x00, 0xd9, 0x00, 0xef, 0x00, 0x04, 0x01, 0x18, 0x01, 0x2c, 0x01,
+  0x3f, 0x01, 0x53, 0x01, 0x66, 0x01, 0x7a, 0x01, 0x91, 0x01, 0xa6, 0x01,
+  0xba, 0x01, 0xc9, 0x01, 0xeb, 0x01, 0x00, 0x02, 0x15, 0x02, 0x30, 0x02,
+  0x36, 0x02, 0x3c, 0x02, 0x42, 0x02, 0x48, 0x02, 0x52, 0x02, 0x62, 0x02,
+  0x00, 0x00, 0x1a, 0x00, 0x3a, 0x00, 0x52, 0x00, 0x60, 0x00, 0x79, 0x00,
+  0x98, 0x00, 0xa6, 0x00, 0xb4, 0x00, 0xc4, 0x00, 0xd4, 0x00, 0xdf, 0x00,
+  0xe7, 0x00, 0xef, 0x00, 0xf7, 0x00, 0x00, 0x00, 0x23, 0x00, 0x40, 0x00,
+  0x5c, 0x00, 0x7b, 0x00, 0x95, 0x00, 0xa7, 0x00, 0xb3, 0x00, 0xcd, 0x00,
+  0xd9, 0x00, 0xe8, 0x00, 0xfb, 0x00, 0x0c, 0x01, 0x15, 0x01, 0x00, 0x00,
+  0x2d, 0x00, 0x46, 0x00, 0x6c, 0x00, 0x86, 0x00, 0x99, 0x00, 0xa9, 0x00,
+  0xbd, 0x00, 0xd5, 0x00, 0xe3, 0x00, 0xf0, 0x00, 0x09, 0x01, 0x1f, 0x01,
+  0x34, 0x01, 0x3b, 0x01, 0x49, 0x01, 0x00, 0x00, 0x1d, 0x00, 0x3c, 0x00,
+  0x60, 0x00, 0x7e, 0x00, 0x8e, 0x00, 0x9a, 0x00, 0xb3, 0x00, 0xbe, 0x00,
+  0xc9, 0x00, 0xd5, 0x00, 0xe0, 0x00, 0xeb, 0x00, 0xf3, 0x00, 0xfb, 0x00,
+  0x02, 0x01, 0x08, 0x01, 0x12, 0x01, 0x00, 0x00, 0x1d, 0x00, 0x47, 0x00,
+  0x65, 0x00, 0x7b, 0x00, 0x8a, 0x00, 0x9f, 0x00, 0xb4, 0x00, 0xc2, 0x00,
+  0xdc, 0x00, 0xf5, 0x00, 0x11, 0x01, 0x2e, 0x01, 0x4a, 0x01, 0x65, 0x01,
+  0x7f, 0x01, 0x99, 0x01, 0xb2, 0x01, 0xcc, 0x01, 0xe5, 0x01, 0xff, 0x01,
+  0x1c, 0x02, 0x37, 0x02, 0x51, 0x02, 0x61, 0x02, 0x74, 0x02, 0x86, 0x02,
+  0x8d, 0x02, 0x95, 0x02, 0x00, 0x00, 0x20, 0x00, 0x3d, 0x00, 0x58, 0x00,
+  0x71, 0x00, 0x87, 0x00, 0x97, 0x00, 0xa4, 0x00, 0xb1, 0x00, 0xbe, 0x00,
+  0xcb, 0x00, 0xd8, 0x00, 0xe5, 0x00, 0xf2, 0x00, 0xff, 0x00, 0x0c, 0x01,
+  0x19, 0x01, 0x26, 0x01, 0x33, 0x01, 0x40, 0x01, 0x4d, 0x01, 0x5a, 0x01,
+  0x67, 0x01, 0x74, 0x01, 0x81, 0x01, 0x8e, 0x01, 0x9b, 0x01, 0xa8, 0x01,
+  0xb5, 0x01, 0xc2, 0x01, 0xcf, 0x01, 0xdc, 0x01, 0xe9, 0x01, 0xf6, 0x01,
+  0x03, 0x02, 0x10, 0x02, 0x1d, 0x02, 0x2a, 0x02, 0x37, 0x02, 0x44, 0x02,
+  0x51, 0x02, 0x5e, 0x02, 0x6b, 0x02, 0x78, 0x02, 0x85, 0x02, 0x92, 0x02,
+  0x9f, 0x02, 0xac, 0x02, 0xb9, 0x02, 0xc6, 0x02, 0xd3, 0x02, 0xe0, 0x02,
+  0xed, 0x02, 0xfa, 0x02, 0x07, 0x03, 0x14, 0x03, 0x21, 0x03, 0x2e, 0x03,
+  0x3b, 0x03, 0x48, 0x03, 0x55, 0x03, 0x62, 0x03, 0x6f, 0x03, 0x7c, 0x03,
+  0x89, 0x03, 0x96, 0x03, 0xa3, 0x03, 0xb0, 0x03, 0xbd, 0x03, 0xca, 0x03,
+  0xd7, 0x03, 0xe4, 0x03, 0xef, 0x03, 0xfa, 0x03, 0x05, 0x04, 0x10, 0x04,
+  0x1a, 0x04, 0x00, 0x00, 0x30, 0x00, 0x4c, 0x00, 0x69, 0x00, 0x85, 0x00,
+  0x9b, 0x00, 0xa8, 0x00, 0xc0, 0x00, 0xee, 0x00, 0xfb, 0x00, 0x0c, 0x01,
+  0x1a, 0x01, 0x3f, 0x01, 0x50, 0x01, 0x5e, 0x01, 0x6c, 0x01, 0x7a, 0x01,
+  0x88, 0x01, 0x96, 0x01, 0xa4, 0x01, 0xb2, 0x01, 0xc0, 0x01, 0xce, 0x01,
+  0xdc, 0x01, 0xea, 0x01, 0xf8, 0x01, 0x06, 0x02, 0x14, 0x02, 0x22, 0x02,
+  0x30, 0x02, 0x3e, 0x02, 0x4c, 0x02, 0x5a, 0x02, 0x62, 0x02, 0x69, 0x02,
+  0x70, 0x02, 0x77, 0x02, 0x80, 0x02, 0x88, 0x02, 0x00, 0x00, 0x20, 0x00,
+  0x39, 0x00, 0x4f, 0x00, 0x5d, 0x00, 0x74, 0x00, 0x86, 0x00, 0x99, 0x00,
+  0xaf, 0x00, 0xc3, 0x00, 0xd9, 0x00, 0xed, 0x00, 0xf6, 0x00, 0xff, 0x00,
+  0x08, 0x01, 0x10, 0x01, 0x18, 0x01, 0x00, 0x00, 0x29, 0x00, 0x47, 0x00,
+  0x66, 0x00, 0x74, 0x00, 0x83, 0x00, 0x96, 0x00, 0xa7, 0x00, 0xb9, 0x00,
+  0xc8, 0x00, 0xd9, 0x00, 0xea, 0x00, 0xfb, 0x00, 0x0b, 0x01, 0x1d, 0x01,
+  0x2f, 0x01, 0x41, 0x01, 0x53, 0x01, 0x65, 0x01, 0x77, 0x01, 0x89, 0x01,
+  0x9b, 0x01, 0xad, 0x01, 0xbb, 0x01, 0xc9, 0x01, 0xd1, 0x01, 0xda, 0x01,
+  0xe3, 0x01, 0xec, 0x01, 0xf5, 0x01, 0xfe, 0x01, 0x08, 0x02, 0x11, 0x02,
+  0x1a, 0x02, 0x24, 0x02, 0x2e, 0x02, 0x38, 0x02, 0x41, 0x02, 0x4b, 0x02,
+  0x55, 0x02, 0x5f, 0x02, 0x69, 0x02, 0x72, 0x02, 0x7b, 0x02, 0x84, 0x02,
+  0x8d, 0x02, 0x96, 0x02, 0x9f, 0x02, 0xa8, 0x02, 0xb1, 0x02, 0xba, 0x02,
+  0xc3, 0x02, 0xcc, 0x02, 0xd5, 0x02, 0xde, 0x02, 0xe7, 0x02, 0xf0, 0x02,
+  0xf9, 0x02, 0x02, 0x03, 0x0b, 0x03, 0x14, 0x03, 0x1d, 0x03, 0x26, 0x03,
+  0x2f, 0x03, 0x39, 0x03, 0x42, 0x03, 0x4b, 0x03, 0x54, 0x03, 0x5d, 0x03,
+  0x66, 0x03, 0x6f, 0x03, 0x78, 0x03, 0x81, 0x03, 0x8a, 0x03, 0x93, 0x03,
+  0x9c, 0x03, 0xa5, 0x03, 0xae, 0x03, 0xb7, 0x03, 0xc1, 0x03, 0xcb, 0x03,
+  0xd5, 0x03, 0xdf, 0x03, 0xe9, 0x03, 0xf3, 0x03, 0xfc, 0x03, 0x05, 0x04,
+  0x0e, 0x04, 0x17, 0x04, 0x20, 0x04, 0x29, 0x04, 0x32, 0x04, 0x3b, 0x04,
+  0x44, 0x04, 0x00, 0x00, 0x1f, 0x00, 0x3c, 0x00, 0x5c, 0x00, 0x70, 0x00,
+  0x99, 0x00, 0xb1, 0x00, 0xc4, 0x00, 0xd5, 0x00, 0xe4, 0x00, 0xef, 0x00,
+  0xf8, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x29, 0x00, 0x41, 0x00, 0x52, 0x00,
+  0x60, 0x00, 0x6a, 0x00, 0x74, 0x00, 0x7b, 0x00, 0x82, 0x00, 0x00, 0x00,
+  0x21, 0x00, 0x32, 0x00, 0x4c, 0x00, 0x60, 0x00, 0x73, 0x00, 0x80, 0x00,
+  0x94, 0x00, 0xa9, 0x00, 0xc0, 0x00, 0xd7, 0x00, 0xf7, 0x00, 0x0d, 0x01,
+  0x23, 0x01, 0x32, 0x01, 0x40, 0x01, 0x48, 0x01, 0x00, 0x00, 0x1a, 0x00,
+  0x25, 0x00, 0x3f, 0x00, 0x4f, 0x00, 0x5f, 0x00, 0x70, 0x00, 0x81, 0x00,
+  0x91, 0x00, 0xa4, 0x00, 0xb2, 0x00, 0xc0, 0x00, 0xc9, 0x00, 0xd2, 0x00,
+  0xdb, 0x00, 0xe4, 0x00, 0xee, 0x00, 0xf8, 0x00, 0x02, 0x01, 0x0b, 0x01,
+  0x14, 0x01, 0x1d, 0x01, 0x27, 0x01, 0x31, 0x01, 0x3a, 0x01, 0x00, 0x00,
+  0x0f, 0x00, 0x21, 0x00, 0x35, 0x00, 0x54, 0x00, 0x6c, 0x00, 0x7e, 0x00,
+  0x90, 0x00, 0x9a, 0x00, 0xa4, 0x00, 0xae, 0x00, 0xb8, 0x00, 0xc2, 0x00,
+  0xcb, 0x00, 0xd1, 0x00, 0xda, 0x00, 0xe3, 0x00, 0x00, 0x00, 0x1c, 0x00,
+  0x3b, 0x00, 0x48, 0x00, 0x54, 0x00, 0x6b, 0x00, 0x7c, 0x00, 0x8d, 0x00,
+  0x9e, 0x00, 0xaf, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x37, 0x00,
+  0x54, 0x00, 0x67, 0x00, 0x74, 0x00, 0x97, 0x00, 0xa4, 0x00, 0xb9, 0x00,
+  0xce, 0x00, 0xdf, 0x00, 0xec, 0x00, 0x04, 0x01, 0x1c, 0x01, 0x31, 0x01,
+  0x3e, 0x01, 0x4f, 0x01, 0x5a, 0x01, 0x63, 0x01, 0x6d, 0x01, 0x00, 0x00,
+  0x21, 0x00, 0x3f, 0x00, 0x68, 0x00, 0x77, 0x00, 0x85, 0x00, 0xa5, 0x00,
+  0xc8, 0x00, 0xd7, 0x00, 0xe7, 0x00, 0xfe, 0x00, 0x15, 0x01, 0x2b, 0x01,
+  0x43, 0x01, 0x59, 0x01, 0x67, 0x01, 0x6f, 0x01, 0x79, 0x01, 0x88, 0x01,
+  0x98, 0x01, 0xa0, 0x01, 0xa8, 0x01, 0xb3, 0x01, 0xbd, 0x01, 0xc5, 0x01,
+  0xd0, 0x01, 0xda, 0x01, 0x00, 0x00, 0x1f, 0x00, 0x3c, 0x00, 0x51, 0x00,
+  0x60, 0x00, 0x77, 0x00, 0x8e, 0x00, 0xa6, 0x00, 0xb9, 0x00, 0xc8, 0x00,
+  0xdb, 0x00, 0xe5, 0x00, 0xf0, 0x00, 0xf9, 0x00, 0x02, 0x01, 0x0b, 0x01,
+  0x00, 0x00, 0x1a, 0x00, 0x36, 0x00, 0x60, 0x00, 0x6f, 0x00, 0x7f, 0x00,
+  0x93, 0x00, 0xaa, 0x00, 0xbe, 0x00, 0xd3, 0x00, 0xeb, 0x00, 0x00, 0x01,
+  0x13, 0x01, 0x2a, 0x01, 0x42, 0x01, 0x56, 0x01, 0x6e, 0x01, 0x82, 0x01,
+  0x97, 0x01, 0xad, 0x01, 0xc1, 0x01, 0xcb, 0x01, 0xd5, 0x01, 0xdf, 0x01,
+  0xe9, 0x01, 0xf5, 0x01, 0xff, 0x01, 0x09, 0x02, 0x12, 0x02, 0x1b, 0x02,
+  0x24, 0x02, 0x2d, 0x02, 0x36, 0x02, 0x47, 0x02, 0x51, 0x02, 0x5b, 0x02,
+  0x65, 0x02, 0x6f, 0x02, 0x79, 0x02, 0x83, 0x02, 0x8e, 0x02, 0x00, 0x00,
+  0x0d, 0x00, 0x20, 0x00, 0x35, 0x00, 0x5a, 0x00, 0x64, 0x00, 0x6e, 0x00,
+  0x81, 0x00, 0x97, 0x00, 0xab, 0x00, 0xbc, 0x00, 0xc7, 0x00, 0xd1, 0x00,
+  0xdc, 0x00, 0xe8, 0x00, 0xf2, 0x00, 0xfe, 0x00, 0x08, 0x01, 0x12, 0x01,
+  0x1c, 0x01, 0x26, 0x01, 0x30, 0x01, 0x37, 0x01, 0x3e, 0x01, 0x47, 0x01,
+  0x52, 0x01, 0x5c, 0x01, 0x00, 0x00, 0x0e, 0x00, 0x1b, 0x00, 0x31, 0x00,
+  0x54, 0x00, 0x63, 0x00, 0x72, 0x00, 0x8e, 0x00, 0xa2, 0x00, 0xb4, 0x00,
+  0xc7, 0x00, 0xd0, 0x00, 0xdd, 0x00, 0xe5, 0x00, 0xed, 0x00, 0x00, 0x00,
+  0x17, 0x00, 0x2d, 0x00, 0x43, 0x00, 0x59, 0x00, 0x6e, 0x00, 0x86, 0x00,
+  0x9f, 0x00, 0xb7, 0x00, 0xce, 0x00, 0xe4, 0x00, 0xfa, 0x00, 0x0f, 0x01,
+  0x25, 0x01, 0x3a, 0x01, 0x50, 0x01, 0x69, 0x01, 0x80, 0x01, 0x96, 0x01,
+  0xa7, 0x01, 0xbf, 0x01, 0xd6, 0x01, 0xe9, 0x01, 0xf5, 0x01, 0xfb, 0x01,
+  0x00, 0x00, 0x10, 0x00, 0x21, 0x00, 0x39, 0x00, 0x4e, 0x00, 0x62, 0x00,
+  0x77, 0x00, 0x8b, 0x00, 0x9f, 0x00, 0xb4, 0x00, 0xcc, 0x00, 0xe5, 0x00,
+  0xfa, 0x00, 0x0a, 0x01, 0x16, 0x01, 0x23, 0x01, 0x2d, 0x01, 0x37, 0x01,
+  0x44, 0x01, 0x51, 0x01, 0x5b, 0x01, 0x64, 0x01, 0x6d, 0x01, 0x77, 0x01,
+  0x84, 0x01, 0x8e, 0x01, 0x98, 0x01, 0xa2, 0x01, 0xac, 0x01, 0xb6, 0x01,
+  0xc0, 0x01, 0xca, 0x01, 0x00, 0x00, 0x10, 0x00, 0x29, 0x00, 0x3b, 0x00,
+  0x47, 0x00, 0x5e, 0x00, 0x75, 0x00, 0x89, 0x00, 0x9e, 0x00, 0xb1, 0x00,
+  0xc6, 0x00, 0xdc, 0x00, 0xf0, 0x00, 0x06, 0x01, 0x1a, 0x01, 0x28, 0x01,
+  0x35, 0x01, 0x40, 0x01, 0x46, 0x01, 0x00, 0x00, 0x14, 0x00, 0x2c, 0x00,
+  0x38, 0x00, 0x45, 0x00, 0x56, 0x00, 0x5f, 0x00, 0x6c, 0x00, 0x76, 0x00,
+  0x83, 0x00, 0x00, 0x00, 0x19, 0x00, 0x34, 0x00, 0x41, 0x00, 0x4d, 0x00,
+  0x5e, 0x00, 0x6d, 0x00, 0x80, 0x00, 0x95, 0x00, 0xb1, 0x00, 0xcd, 0x00,
+  0xe9, 0x00, 0x05, 0x01, 0x00, 0x00, 0x1f, 0x00, 0x3b, 0x00, 0x48, 0x00,
+  0x53, 0x00, 0x63, 0x00, 0x71, 0x00, 0x80, 0x00, 0x8e, 0x00, 0xaa, 0x00,
+  0xc1, 0x00, 0xd6, 0x00, 0xf2, 0x00, 0x0d, 0x01, 0x29, 0x01, 0x44, 0x01,
+  0x61, 0x01, 0x7d, 0x01, 0x99, 0x01, 0xa2, 0x01, 0xab, 0x01, 0xb4, 0x01,
+  0xbb, 0x01, 0xc5, 0x01, 0xd2, 0x01, 0xdb, 0x01, 0x00, 0x00, 0x1c, 0x00,
+  0x2b, 0x00, 0x37, 0x00, 0x49, 0x00, 0x5c, 0x00, 0x78, 0x00, 0x92, 0x00,
+  0x9e, 0x00, 0xaa, 0x00, 0xb6, 0x00, 0xc2, 0x00, 0xce, 0x00, 0xda, 0x00,
+  0xe6, 0x00, 0xf2, 0x00, 0xfe, 0x00, 0x0a, 0x01, 0x16, 0x01, 0x22, 0x01,
+  0x2e, 0x01, 0x3a, 0x01, 0x46, 0x01, 0x52, 0x01, 0x5e, 0x01, 0x6a, 0x01,
+  0x76, 0x01, 0x82, 0x01, 0x8e, 0x01, 0x9a, 0x01, 0x00, 0x00, 0x1e, 0x00,
+  0x2b, 0x00, 0x35, 0x00, 0x45, 0x00, 0x52, 0x00, 0x5f, 0x00, 0x78, 0x00,
+  0x90, 0x00, 0xa8, 0x00, 0xbc, 0x00, 0xd0, 0x00, 0xe5, 0x00, 0xfe, 0x00,
+  0x12, 0x01, 0x23, 0x01, 0x39, 0x01, 0x4e, 0x01, 0x62, 0x01, 0x6e, 0x01,
+  0x87, 0x01, 0x93, 0x01, 0x9f, 0x01, 0xab, 0x01, 0xb2, 0x01, 0xb9, 0x01,
+  0x00, 0x00, 0x21, 0x00, 0x2f, 0x00, 0x42, 0x00, 0x5a, 0x00, 0x71, 0x00,
+  0x8b, 0x00, 0xa6, 0x00, 0xc0, 0x00, 0xd9, 0x00, 0xf1, 0x00, 0x09, 0x01,
+  0x20, 0x01, 0x38, 0x01, 0x4f, 0x01, 0x67, 0x01, 0x82, 0x01, 0x9b, 0x01,
+  0xb3, 0x01, 0xc5, 0x01, 0xce, 0x01, 0xdb, 0x01, 0xe5, 0x01, 0x00, 0x00,
+  0x1b, 0x00, 0x38, 0x00, 0x45, 0x00, 0x63, 0x00, 0x71, 0x00, 0x80, 0x00,
+  0x8d, 0x00, 0x9d, 0x00, 0xae, 0x00, 0xbe, 0x00, 0xcd, 0x00, 0xdc, 0x00,
+  0xe5, 0x00, 0xf1, 0x00, 0xfa, 0x00, 0x01, 0x01, 0x00, 0x00, 0x20, 0x00,
+  0x2d, 0x00, 0x4c, 0x00, 0x5e, 0x00, 0x79, 0x00, 0x92, 0x00, 0xab, 0x00,
+  0xb7, 0x00, 0xc3, 0x00, 0xcf, 0x00, 0xdb, 0x00, 0xe7, 0x00, 0xf3, 0x00,
+  0xff, 0x00, 0x0b, 0x01, 0x17, 0x01, 0x23, 0x01, 0x2f, 0x01, 0x3b, 0x01,
+  0x47, 0x01, 0x53, 0x01, 0x5f, 0x01, 0x6b, 0x01, 0x77, 0x01, 0x83, 0x01,
+  0x8f, 0x01, 0x9b, 0x01, 0xa7, 0x01, 0xb3, 0x01, 0xbf, 0x01, 0xcb, 0x01,
+  0xd7, 0x01, 0xe3, 0x01, 0xea, 0x01, 0xf3, 0x01, 0xfd, 0x01, 0x09, 0x02,
+  0x15, 0x02, 0x25, 0x02, 0x00, 0x00, 0x17, 0x00, 0x35, 0x00, 0x41, 0x00,
+  0x5b, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x37, 0x00, 0x49, 0x00, 0x68, 0x00,
+  0x86, 0x00, 0xa7, 0x00, 0xc9, 0x00, 0xea, 0x00, 0x0a, 0x01, 0x29, 0x01,
+  0x48, 0x01, 0x66, 0x01, 0x85, 0x01, 0xa3, 0x01, 0xc2, 0x01, 0xe4, 0x01,
+  0x04, 0x02, 0x23, 0x02, 0x33, 0x02, 0x42, 0x02, 0x51, 0x02, 0x63, 0x02,
+  0x79, 0x02, 0x91, 0x02, 0xa8, 0x02, 0xbd, 0x02, 0xd2, 0x02, 0xe6, 0x02,
+  0xfc, 0x02, 0x06, 0x03, 0x10, 0x03, 0x1a, 0x03, 0x24, 0x03, 0x2e, 0x03,
+  0x38, 0x03, 0x42, 0x03, 0x4c, 0x03, 0x56, 0x03, 0x60, 0x03, 0x6a, 0x03,
+  0x74, 0x03, 0x7e, 0x03, 0x88, 0x03, 0x92, 0x03, 0x9c, 0x03, 0xa6, 0x03,
+  0xb0, 0x03, 0xba, 0x03, 0xc4, 0x03, 0xce, 0x03, 0xd8, 0x03, 0xe2, 0x03,
+  0xec, 0x03, 0xf6, 0x03, 0x00, 0x04, 0x0a, 0x04, 0x13, 0x04, 0x1d, 0x04,
+  0x27, 0x04, 0x31, 0x04, 0x3b, 0x04, 0x45, 0x04, 0x50, 0x04, 0x5b, 0x04,
+  0x00, 0x00, 0x26, 0x00, 0x33, 0x00, 0x55, 0x00, 0x62, 0x00, 0x6e, 0x00,
+  0x7d, 0x00, 0x8c, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x25, 0x00, 0x49, 0x00,
+  0x53, 0x00, 0x61, 0x00, 0x78, 0x00, 0x84, 0x00, 0x8a, 0x00, 0x00, 0x00,
+  0x1e, 0x00, 0x3f, 0x00, 0x5c, 0x00, 0x74, 0x00, 0x90, 0x00, 0xa0, 0x00,
+  0xb0, 0x00, 0xc0, 0x00, 0xcf, 0x00, 0xda, 0x00, 0xe3, 0x00, 0xec, 0x00,
+  0x00, 0x00, 0x1b, 0x00, 0x31, 0x00, 0x42, 0x00, 0x59, 0x00, 0x6c, 0x00,
+  0x7f, 0x00, 0x8d, 0x00, 0x97, 0x00, 0xa0, 0x00, 0x00, 0x00, 0x1c, 0x00,
+  0x3c, 0x00, 0x59, 0x00, 0x65, 0x00, 0x73, 0x00, 0x85, 0x00, 0x99, 0x00,
+  0xb3, 0x00, 0xcc, 0x00, 0xd6, 0x00, 0xe0, 0x00, 0xea, 0x00, 0xf3, 0x00,
+  0xfa, 0x00, 0x01, 0x01, 0x08, 0x01, 0x0f, 0x01, 0x16, 0x01, 0x22, 0x01,
+  0x00, 0x00, 0x26, 0x00, 0x40, 0x00, 0x55, 0x00, 0x6a, 0x00, 0x80, 0x00,
+  0x95, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x23, 0x00, 0x30, 0x00, 0x41, 0x00,
+  0x50, 0x00, 0x62, 0x00, 0x6b, 0x00, 0x74, 0x00, 0x7d, 0x00, 0x86, 0x00,
+  0x8f, 0x00, 0x98, 0x00, 0xa0, 0x00, 0xaa, 0x00, 0xb4, 0x00, 0xbe, 0x00,
+  0xc7, 0x00, 0xd0, 0x00, 0xd9, 0x00, 0xe2, 0x00, 0xeb, 0x00, 0xf4, 0x00,
+  0xfd, 0x00, 0x06, 0x01, 0x0f, 0x01, 0x18, 0x01, 0x21, 0x01, 0x2a, 0x01,
+  0x33, 0x01, 0x3c, 0x01, 0x45, 0x01, 0x4e, 0x01, 0x57, 0x01, 0x61, 0x01,
+  0x6b, 0x01, 0x75, 0x01, 0x7e, 0x01, 0x87, 0x01, 0x90, 0x01, 0x99, 0x01,
+  0xa2, 0x01, 0x00, 0x00, 0x1d, 0x00, 0x38, 0x00, 0x44, 0x00, 0x56, 0x00,
+  0x64, 0x00, 0x6b, 0x00, 0x75, 0x00, 0x7f, 0x00, 0x89, 0x00, 0x92, 0x00,
+  0x9b, 0x00, 0xa1, 0x00, 0xa7, 0x00, 0xb0, 0x00, 0x00, 0x00, 0x1b, 0x00,
+  0x35, 0x00, 0x52, 0x00, 0x5f, 0x00, 0x70, 0x00, 0x81, 0x00, 0x96, 0x00,
+  0xb0, 0x00, 0xc9, 0x00, 0xe5, 0x00, 0x02, 0x01, 0x1e, 0x01, 0x39, 0x01,
+  0x53, 0x01, 0x6d, 0x01, 0x86, 0x01, 0xa0, 0x01, 0xb9, 0x01, 0xd3, 0x01,
+  0xf0, 0x01, 0x0b, 0x02, 0x25, 0x02, 0x35, 0x02, 0x47, 0x02, 0x58, 0x02,
+  0x72, 0x02, 0x84, 0x02, 0x8c, 0x02, 0x94, 0x02, 0x9c, 0x02, 0xa4, 0x02,
+  0xab, 0x02, 0xb3, 0x02, 0xbb, 0x02, 0xc2, 0x02, 0xca, 0x02, 0xd1, 0x02,
+  0x00, 0x00, 0x23, 0x00, 0x32, 0x00, 0x45, 0x00, 0x5a, 0x00, 0x6e, 0x00,
+  0x89, 0x00, 0xa2, 0x00, 0xb9, 0x00, 0xd0, 0x00, 0xd8, 0x00, 0xdf, 0x00,
+  0xe6, 0x00, 0xed, 0x00, 0xfb, 0x00, 0x09, 0x01, 0x13, 0x01, 0x1d, 0x01,
+  0x26, 0x01, 0x2f, 0x01, 0x38, 0x01, 0x00, 0x00, 0x22, 0x00, 0x3f, 0x00,
+  0x5c, 0x00, 0x69, 0x00, 0x79, 0x00, 0x8c, 0x00, 0xa0, 0x00, 0xb2, 0x00,
+  0xc3, 0x00, 0xd1, 0x00, 0xd9, 0x00, 0xe1, 0x00, 0xeb, 0x00, 0xf5, 0x00,
+  0xff, 0x00, 0x08, 0x01, 0x11, 0x01, 0x18, 0x01, 0x00, 0x00, 0x1d, 0x00,
+  0x38, 0x00, 0x45, 0x00, 0x59, 0x00, 0x71, 0x00, 0x7b, 0x00, 0x84, 0x00,
+  0x00, 0x00, 0x19, 0x00, 0x32, 0x00, 0x42, 0x00, 0x52, 0x00, 0x5f, 0x00,
+  0x6f, 0x00, 0x91, 0x00, 0xb2, 0x00, 0xd6, 0x00, 0xfb, 0x00, 0x1f, 0x01,
+  0x42, 0x01, 0x64, 0x01, 0x86, 0x01, 0xa7, 0x01, 0xc9, 0x01, 0xea, 0x01,
+  0x0c, 0x02, 0x31, 0x02, 0x54, 0x02, 0x76, 0x02, 0x99, 0x02, 0xba, 0x02,
+  0xc2, 0x02, 0xca, 0x02, 0xd2, 0x02, 0xda, 0x02, 0xe2, 0x02, 0xea, 0x02,
+  0xf2, 0x02, 0xfa, 0x02, 0x02, 0x03, 0x0a, 0x03, 0x12, 0x03, 0x1b, 0x03,
+  0x00, 0x00, 0x1e, 0x00, 0x39, 0x00, 0x4c, 0x00, 0x5f, 0x00, 0x74, 0x00,
+  0x81, 0x00, 0x8e, 0x00, 0x9b, 0x00, 0xa4, 0x00, 0xad, 0x00, 0xb3, 0x00,
+  0xba, 0x00, 0xc3, 0x00, 0xcd, 0x00, 0xd7, 0x00, 0x00, 0x00, 0x3e, 0x00,
+  0x5a, 0x00, 0x6c, 0x00, 0x82, 0x00, 0x95, 0x00, 0xaf, 0x00, 0xc8, 0x00,
+  0xe4, 0x00, 0x01, 0x01, 0x1d, 0x01, 0x38, 0x01, 0x52, 0x01, 0x6c, 0x01,
+  0x85, 0x01, 0x9f, 0x01, 0xb8, 0x01, 0xd2, 0x01, 0xef, 0x01, 0x0a, 0x02,
+  0x24, 0x02, 0x3a, 0x02, 0x4c, 0x02, 0x5d, 0x02, 0x6f, 0x02, 0x81, 0x02,
+  0x8f, 0x02, 0x96, 0x02, 0xa0, 0x02, 0xab, 0x02, 0xb5, 0x02, 0xc0, 0x02,
+  0xc8, 0x02, 0xd3, 0x02, 0x00, 0x00, 0x11, 0x00, 0x28, 0x00, 0x3f, 0x00,
+  0x56, 0x00, 0x6f, 0x00, 0x88, 0x00, 0xa0, 0x00, 0xbc, 0x00, 0xc8, 0x00,
+  0xd4, 0x00, 0xe0, 0x00, 0xec, 0x00, 0xf8, 0x00, 0x04, 0x01, 0x10, 0x01,
+  0x1c, 0x01, 0x28, 0x01, 0x34, 0x01, 0x40, 0x01, 0x4c, 0x01, 0x58, 0x01,
+  0x64, 0x01, 0x70, 0x01, 0x7c, 0x01, 0x88, 0x01, 0x94, 0x01, 0xa0, 0x01,
+  0xac, 0x01, 0xb8, 0x01, 0xc4, 0x01, 0xd0, 0x01, 0xdc, 0x01, 0xe8, 0x01,
+  0xf4, 0x01, 0x00, 0x02, 0x0c, 0x02, 0x18, 0x02, 0x24, 0x02, 0x30, 0x02,
+  0x3c, 0x02, 0x48, 0x02, 0x54, 0x02, 0x60, 0x02, 0x6c, 0x02, 0x78, 0x02,
+  0x84, 0x02, 0x90, 0x02, 0x9c, 0x02, 0xa8, 0x02, 0xb4, 0x02, 0xc0, 0x02,
+  0xcc, 0x02, 0xd8, 0x02, 0xe4, 0x02, 0xf0, 0x02, 0xfc, 0x02, 0x08, 0x03,
+  0x14, 0x03, 0x20, 0x03, 0x2c, 0x03, 0x38, 0x03, 0x44, 0x03, 0x50, 0x03,
+  0x5c, 0x03, 0x68, 0x03, 0x74, 0x03, 0x7e, 0x03, 0x88, 0x03, 0x92, 0x03,
+  0x9c, 0x03, 0xa6, 0x03, 0xaf, 0x03, 0x00, 0x00, 0x13, 0x00, 0x27, 0x00,
+  0x3f, 0x00, 0x53, 0x00, 0x66, 0x00, 0x7c, 0x00, 0x92, 0x00, 0xa2, 0x00,
+  0xb2, 0x00, 0xc2, 0x00, 0xd2, 0x00, 0xe2, 0x00, 0xf2, 0x00, 0xfa, 0x00,
+  0x04, 0x01, 0x0e, 0x01, 0x18, 0x01, 0x22, 0x01, 0x2c, 0x01, 0x36, 0x01,
+  0x40, 0x01, 0x4a, 0x01, 0x54, 0x01, 0x5e, 0x01, 0x68, 0x01, 0x72, 0x01,
+  0x7c, 0x01, 0x86, 0x01, 0x90, 0x01, 0x9a, 0x01, 0xa3, 0x01, 0xab, 0x01,
+  0xb8, 0x01, 0xc2, 0x01, 0xcc, 0x01, 0xd6, 0x01, 0xe1, 0x01, 0xeb, 0x01,
+  0xf6, 0x01, 0x00, 0x02, 0x0a, 0x02, 0x00, 0x00, 0x13, 0x00, 0x1c, 0x00,
+  0x24, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x37, 0x00, 0x55, 0x00, 0x74, 0x00,
+  0x92, 0x00, 0xaf, 0x00, 0xcb, 0x00, 0xe7, 0x00, 0x02, 0x01, 0x1e, 0x01,
+  0x39, 0x01, 0x55, 0x01, 0x74, 0x01, 0x91, 0x01, 0xad, 0x01, 0xc9, 0x01,
+  0xe4, 0x01, 0x02, 0x02, 0x21, 0x02, 0x3f, 0x02, 0x5c, 0x02, 0x78, 0x02,
+  0x94, 0x02, 0xaf, 0x02, 0xcb, 0x02, 0xe6, 0x02, 0x02, 0x03, 0x21, 0x03,
+  0x3e, 0x03, 0x5a, 0x03, 0x72, 0x03, 0x8a, 0x03, 0xa3, 0x03, 0xba, 0x03,
+  0xd2, 0x03, 0xea, 0x03, 0x02, 0x04, 0x19, 0x04, 0x31, 0x04, 0x48, 0x04,
+  0x59, 0x04, 0x72, 0x04, 0x8a, 0x04, 0xa4, 0x04, 0xbc, 0x04, 0xd5, 0x04,
+  0xed, 0x04, 0x00, 0x05, 0x11, 0x05, 0x22, 0x05, 0x3a, 0x05, 0x53, 0x05,
+  0x6b, 0x05, 0x83, 0x05, 0x9c, 0x05, 0xa8, 0x05, 0xb4, 0x05, 0xc0, 0x05,
+  0xcc, 0x05, 0xd8, 0x05, 0xe1, 0x05, 0xed, 0x05, 0xf6, 0x05, 0xff, 0x05,
+  0x08, 0x06, 0x12, 0x06, 0x1c, 0x06, 0x28, 0x06, 0x34, 0x06, 0x3e, 0x06,
+  0x4a, 0x06, 0x56, 0x06, 0x62, 0x06, 0x6b, 0x06, 0x77, 0x06, 0x83, 0x06,
+  0x8d, 0x06, 0x9a, 0x06, 0xa6, 0x06, 0xb2, 0x06, 0x00, 0x00, 0x10, 0x00,
+  0x00, 0x00, 0x13, 0x00, 0x26, 0x00, 0x3b, 0x00, 0x50, 0x00, 0x63, 0x00,
+  0x77, 0x00, 0x91, 0x00, 0xa9, 0x00, 0xb6, 0x00, 0xc0, 0x00, 0xcf, 0x00,
+  0xdc, 0x00, 0xe9, 0x00, 0xf6, 0x00, 0x03, 0x01, 0x10, 0x01, 0x1d, 0x01,
+  0x2a, 0x01, 0x37, 0x01, 0x41, 0x01, 0x4b, 0x01, 0x54, 0x01, 0x5e, 0x01,
+  0x68, 0x01, 0x72, 0x01, 0x7c, 0x01, 0x86, 0x01, 0x90, 0x01, 0x9a, 0x01,
+  0xa4, 0x01, 0xae, 0x01, 0xb8, 0x01, 0xc3, 0x01, 0xce, 0x01, 0xd9, 0x01,
+  0xe4, 0x01, 0xef, 0x01, 0xf9, 0x01, 0x0e, 0x02, 0x00, 0x00, 0x16, 0x00,
+  0x2c, 0x00, 0x33, 0x00, 0x3e, 0x00, 0x49, 0x00, 0x57, 0x00, 0x62, 0x00,
+  0x70, 0x00, 0x7e, 0x00, 0x8c, 0x00, 0x96, 0x00, 0x9c, 0x00, 0xa2, 0x00,
+  0xb2, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1d, 0x00, 0x2c, 0x00, 0x39, 0x00,
+  0x4c, 0x00, 0x62, 0x00, 0x70, 0x00, 0x86, 0x00, 0x8f, 0x00, 0x98, 0x00,
+  0xa0, 0x00, 0xaa, 0x00, 0xb2, 0x00, 0x00, 0x00, 0x17, 0x00, 0x1d, 0x00,
+  0x25, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1d, 0x00, 0x37, 0x00, 0x47, 0x00,
+  0x4e, 0x00, 0x58, 0x00, 0x5e, 0x00, 0x69, 0x00, 0x76, 0x00, 0x83, 0x00,
+  0x00, 0x00, 0x1b, 0x00, 0x34, 0x00, 0x40, 0x00, 0x4c, 0x00, 0x58, 0x00,
+  0x64, 0x00, 0x70, 0x00, 0x7c, 0x00, 0x88, 0x00, 0x94, 0x00, 0xa0, 0x00,
+  0xac, 0x00, 0xb8, 0x00, 0xc4, 0x00, 0xd0, 0x00, 0xdc, 0x00, 0xe8, 0x00,
+  0xf4, 0x00, 0x00, 0x01, 0x0c, 0x01, 0x18, 0x01, 0x24, 0x01, 0x30, 0x01,
+  0x3c, 0x01, 0x48, 0x01, 0x54, 0x01, 0x60, 0x01, 0x6d, 0x01, 0x7b, 0x01,
+  0x89, 0x01, 0x99, 0x01, 0xa8, 0x01, 0x00, 0x00, 0x12, 0x00, 0x25, 0x00,
+  0x2e, 0x00, 0x37, 0x00, 0x41, 0x00, 0x49, 0x00, 0x53, 0x00, 0x5a, 0x00,
+  0x61, 0x00, 0x68, 0x00, 0x6f, 0x00, 0x00, 0x00, 0x10, 0x00, 0x19, 0x00,
+  0x22, 0x00, 0x2b, 0x00, 0x34, 0x00, 0x3d, 0x00, 0x43, 0x00, 0x4c, 0x00,
+  0x55, 0x00, 0x5e, 0x00, 0x67, 0x00, 0x77, 0x00, 0x00, 0x00, 0x0f, 0x00,
+  0x1e, 0x00, 0x2d, 0x00, 0x3c, 0x00, 0x4b, 0x00, 0x5a, 0x00, 0x69, 0x00,
+  0x78, 0x00, 0x87, 0x00, 0x93, 0x00, 0x9b, 0x00, 0xa4, 0x00, 0xad, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x2c, 0x00, 0x44, 0x00, 0x5d, 0x00, 0x75, 0x00,
+  0x81, 0x00, 0x8d, 0x00, 0x99, 0x00, 0xa5, 0x00, 0xb1, 0x00, 0xbd, 0x00,
+  0xc9, 0x00, 0xd5, 0x00, 0xe1, 0x00, 0xed, 0x00, 0xf9, 0x00, 0x05, 0x01,
+  0x11, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x35, 0x01, 0x41, 0x01, 0x4d, 0x01,
+  0x59, 0x01, 0x65, 0x01, 0x6e, 0x01, 0x74, 0x01, 0x7e, 0x01, 0x8e, 0x01,
+  0x9c, 0x01, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x10, 0x00, 0x21, 0x00,
+  0x2b, 0x00, 0x34, 0x00, 0x3a, 0x00, 0x40, 0x00, 0x46, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x24, 0x00, 0x33, 0x00, 0x42, 0x00, 0x51, 0x00, 0x60, 0x00,
+  0x6f, 0x00, 0x78, 0x00, 0x82, 0x00, 0x8b, 0x00, 0x95, 0x00, 0x9f, 0x00,
+  0xa9, 0x00, 0xb3, 0x00, 0xbd, 0x00, 0xc7, 0x00, 0x00, 0x00, 0x0a, 0x00,
+  0x1c, 0x00, 0x30, 0x00, 0x42, 0x00, 0x57, 0x00, 0x6a, 0x00, 0x73, 0x00,
+  0x7c, 0x00, 0x86, 0x00, 0x91, 0x00, 0x9b, 0x00, 0xa6, 0x00, 0xb1, 0x00,
+  0xb7, 0x00, 0xc3, 0x00, 0xcf, 0x00, 0xdb, 0x00, 0xe7, 0x00, 0x00, 0x00,
+  0x17, 0x00, 0x25, 0x00, 0x34, 0x00, 0x3d, 0x00, 0x46, 0x00, 0x4f, 0x00,
+  0x00, 0x00, 0x0b, 0x00, 0x16, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x26, 0x00,
+  0x32, 0x00, 0x3b, 0x00, 0x44, 0x00, 0x4e, 0x00, 0x57, 0x00, 0x61, 0x00,
+  0x6b, 0x00, 0x74, 0x00, 0x7b, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x17, 0x00,
+  0x2c, 0x00, 0x3f, 0x00, 0x47, 0x00, 0x52, 0x00, 0x5b, 0x00, 0x69, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x1c, 0x00, 0x2b, 0x00, 0x3e, 0x00, 0x47, 0x00,
+  0x50, 0x00, 0x59, 0x00, 0x62, 0x00, 0x6b, 0x00, 0x73, 0x00, 0x7b, 0x00,
+  0x83, 0x00, 0x8c, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x35, 0x00, 0x4f, 0x00,
+  0x68, 0x00, 0x80, 0x00, 0x98, 0x00, 0xaf, 0x00, 0xc7, 0x00, 0xde, 0x00,
+  0xf7, 0x00, 0x0f, 0x01, 0x2a, 0x01, 0x44, 0x01, 0x5d, 0x01, 0x76, 0x01,
+  0x8e, 0x01, 0x9c, 0x01, 0xa8, 0x01, 0xbb, 0x01, 0xcd, 0x01, 0xe0, 0x01,
+  0xf2, 0x01, 0xfb, 0x01, 0x04, 0x02, 0x0d, 0x02, 0x19, 0x02, 0x24, 0x02,
+  0x2f, 0x02, 0x38, 0x02, 0x43, 0x02, 0x50, 0x02, 0x5d, 0x02, 0x67, 0x02,
+  0x74, 0x02, 0x7e, 0x02, 0x88, 0x02, 0x93, 0x02, 0x9f, 0x02, 0xa8, 0x02,
+  0xaf, 0x02, 0xb9, 0x02, 0xbf, 0x02, 0x00, 0x00, 0x0e, 0x00, 0x1b, 0x00,
+  0x29, 0x00, 0x43, 0x00, 0x5c, 0x00, 0x78, 0x00, 0x95, 0x00, 0xb1, 0x00,
+  0xcc, 0x00, 0xe6, 0x00, 0x00, 0x01, 0x19, 0x01, 0x33, 0x01, 0x4c, 0x01,
+  0x66, 0x01, 0x83, 0x01, 0x9e, 0x01, 0xb8, 0x01, 0xca, 0x01, 0xdc, 0x01,
+  0xec, 0x01, 0xfc, 0x01, 0x0b, 0x02, 0x1c, 0x02, 0x2c, 0x02, 0x3d, 0x02,
+  0x4c, 0x02, 0x53, 0x02, 0x5c, 0x02, 0x65, 0x02, 0x6d, 0x02, 0x75, 0x02,
+  0x7d, 0x02, 0x85, 0x02, 0x8f, 0x02, 0x9e, 0x02, 0xa6, 0x02, 0xae, 0x02,
+  0x00, 0x00, 0x17, 0x00, 0x2f, 0x00, 0x46, 0x00, 0x5c, 0x00, 0x71, 0x00,
+  0x86, 0x00, 0x9a, 0x00, 0xaf, 0x00, 0xc3, 0x00, 0xd8, 0x00, 0xf0, 0x00,
+  0x06, 0x01, 0x1b, 0x01, 0x32, 0x01, 0x48, 0x01, 0x5a, 0x01, 0x70, 0x01,
+  0x7b, 0x01, 0x86, 0x01, 0x94, 0x01, 0x00, 0x00, 0x0b, 0x00, 0x19, 0x00,
+  0x28, 0x00, 0x3a, 0x00, 0x43, 0x00, 0x4c, 0x00, 0x55, 0x00, 0x5e, 0x00,
+  0x67, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1c, 0x00, 0x2e, 0x00, 0x40, 0x00,
+  0x4b, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1c, 0x00, 0x2c, 0x00, 0x3c, 0x00,
+  0x4b, 0x00, 0x5b, 0x00, 0x6b, 0x00, 0x7b, 0x00, 0x93, 0x00, 0xac, 0x00,
+  0xc4, 0x00, 0xdc, 0x00, 0xf4, 0x00, 0x0e, 0x01, 0x26, 0x01, 0x3f, 0x01,
+  0x47, 0x01, 0x4f, 0x01, 0x57, 0x01, 0x5f, 0x01, 0x67, 0x01, 0x73, 0x01,
+  0x7f, 0x01, 0x87, 0x01, 0x00, 0x00, 0x13, 0x00, 0x25, 0x00, 0x37, 0x00,
+  0x4c, 0x00, 0x61, 0x00, 0x6c, 0x00, 0x77, 0x00, 0x80, 0x00, 0x89, 0x00,
+  0x8f, 0x00, 0x95, 0x00, 0x9b, 0x00, 0x00, 0x00, 0x13, 0x00, 0x28, 0x00,
+  0x3c, 0x00, 0x46, 0x00, 0x4e, 0x00, 0x59, 0x00, 0x00, 0x00, 0x30, 0x00,
+  0x42, 0x00, 0x58, 0x00, 0x6b, 0x00, 0x8f, 0x00, 0xb3, 0x00, 0xca, 0x00,
+  0xd5, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x1a, 0x00, 0x2d, 0x00, 0x42, 0x00,
+  0x4c, 0x00, 0x56, 0x00, 0x00, 0x00, 0x14, 0x00, 0x1f, 0x00, 0x2a, 0x00,
+  0x35, 0x00, 0x3b, 0x00, 0x45, 0x00, 0x00, 0x00, 0x12, 0x00, 0x28, 0x00,
+  0x3b, 0x00, 0x4c, 0x00, 0x5e, 0x00, 0x6a, 0x00, 0x73, 0x00, 0x7c, 0x00,
+  0x88, 0x00, 0x92, 0x00, 0x9c, 0x00, 0xa6, 0x00, 0xb0, 0x00, 0xba, 0x00,
+  0xc1, 0x00, 0xca, 0x00, 0x00, 0x00, 0x15, 0x00, 0x29, 0x00, 0x34, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x25, 0x00, 0x3c, 0x00, 0x56, 0x00, 0x71, 0x00,
+  0x8b, 0x00, 0xa4, 0x00, 0xbc, 0x00, 0xd4, 0x00, 0xeb, 0x00, 0x03, 0x01,
+  0x1a, 0x01, 0x32, 0x01, 0x4d, 0x01, 0x66, 0x01, 0x7e, 0x01, 0x91, 0x01,
+  0xa4, 0x01, 0xb7, 0x01, 0xca, 0x01, 0xde, 0x01, 0xf3, 0x01, 0x07, 0x02,
+  0x1b, 0x02, 0x2c, 0x02, 0x3d, 0x02, 0x50, 0x02, 0x65, 0x02, 0x7a, 0x02,
+  0x84, 0x02, 0x8e, 0x02, 0x98, 0x02, 0x9e, 0x02, 0xab, 0x02, 0xb8, 0x02,
+  0xc5, 0x02, 0xcf, 0x02, 0xdc, 0x02, 0xe4, 0x02, 0xf1, 0x02, 0xfa, 0x02,
+  0x03, 0x03, 0x10, 0x03, 0x00, 0x00, 0x10, 0x00, 0x21, 0x00, 0x3b, 0x00,
+  0x46, 0x00, 0x51, 0x00, 0x5c, 0x00, 0x6a, 0x00, 0x73, 0x00, 0x7b, 0x00,
+  0x83, 0x00, 0x00, 0x00, 0x12, 0x00, 0x2e, 0x00, 0x4a, 0x00, 0x66, 0x00,
+  0x81, 0x00, 0x9b, 0x00, 0xb5, 0x00, 0xce, 0x00, 0xe8, 0x00, 0x01, 0x01,
+  0x1a, 0x01, 0x35, 0x01, 0x4e, 0x01, 0x58, 0x01, 0x62, 0x01, 0x6c, 0x01,
+  0x76, 0x01, 0x80, 0x01, 0x8a, 0x01, 0x94, 0x01, 0x9e, 0x01, 0xa9, 0x01,
+  0xb3, 0x01, 0xbd, 0x01, 0xc7, 0x01, 0xd1, 0x01, 0xdb, 0x01, 0xe5, 0x01,
+  0xef, 0x01, 0xf9, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x19, 0x00, 0x28, 0x00,
+  0x37, 0x00, 0x46, 0x00, 0x60, 0x00, 0x77, 0x00, 0x8e, 0x00, 0x9b, 0x00,
+  0xa7, 0x00, 0xaf, 0x00, 0xb8, 0x00, 0xc1, 0x00, 0xca, 0x00, 0xd2, 0x00,
+  0xdd, 0x00, 0xe5, 0x00, 0xf1, 0x00, 0xf9, 0x00, 0x02, 0x01, 0x0b, 0x01,
+  0x14, 0x01, 0x1c, 0x01, 0x24, 0x01, 0x00, 0x00, 0x10, 0x00, 0x2a, 0x00,
+  0x45, 0x00, 0x5f, 0x00, 0x78, 0x00, 0x90, 0x00, 0xa8, 0x00, 0xbf, 0x00,
+  0xd7, 0x00, 0xee, 0x00, 0x06, 0x01, 0x21, 0x01, 0x3a, 0x01, 0x52, 0x01,
+  0x64, 0x01, 0x76, 0x01, 0x89, 0x01, 0x9c, 0x01, 0xaf, 0x01, 0xc2, 0x01,
+  0xd5, 0x01, 0xe8, 0x01, 0x00, 0x02, 0x18, 0x02, 0x27, 0x02, 0x43, 0x02,
+  0x5d, 0x02, 0x73, 0x02, 0x88, 0x02, 0x9a, 0x02, 0xa4, 0x02, 0xb0, 0x02,
+  0xbd, 0x02, 0xca, 0x02, 0xd7, 0x02, 0xe4, 0x02, 0xf1, 0x02, 0xfe, 0x02,
+  0x0b, 0x03, 0x18, 0x03, 0x21, 0x03, 0x2a, 0x03, 0x33, 0x03, 0x3e, 0x03,
+  0x47, 0x03, 0x50, 0x03, 0x5a, 0x03, 0x63, 0x03, 0x00, 0x00, 0x12, 0x00,
+  0x24, 0x00, 0x3c, 0x00, 0x47, 0x00, 0x54, 0x00, 0x5f, 0x00, 0x6c, 0x00,
+  0x79, 0x00, 0x84, 0x00, 0x94, 0x00, 0x9b, 0x00, 0xa3, 0x00, 0xaa, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x20, 0x00, 0x33, 0x00, 0x40, 0x00, 0x51, 0x00,
+  0x63, 0x00, 0x77, 0x00, 0x8c, 0x00, 0xa0, 0x00, 0xb3, 0x00, 0xbf, 0x00,
+  0xc9, 0x00, 0xd2, 0x00, 0xd9, 0x00, 0xe3, 0x00, 0xed, 0x00, 0xf7, 0x00,
+  0x02, 0x01, 0x09, 0x01, 0x00, 0x00, 0x0d, 0x00, 0x1c, 0x00, 0x28, 0x00,
+  0x37, 0x00, 0x45, 0x00, 0x50, 0x00, 0x5f, 0x00, 0x6f, 0x00, 0x7f, 0x00,
+  0x8f, 0x00, 0x9f, 0x00, 0xaf, 0x00, 0xbf, 0x00, 0xc7, 0x00, 0xd0, 0x00,
+  0xd7, 0x00, 0xde, 0x00, 0xe6, 0x00, 0xee, 0x00, 0xf4, 0x00, 0xfc, 0x00,
+  0x00, 0x00, 0x18, 0x00, 0x2b, 0x00, 0x3d, 0x00, 0x55, 0x00, 0x5e, 0x00,
+  0x67, 0x00, 0x71, 0x00, 0x7c, 0x00, 0x86, 0x00, 0x96, 0x00, 0xa2, 0x00,
+  0xaa, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1a, 0x00, 0x23, 0x00, 0x33, 0x00,
+  0x3c, 0x00, 0x4d, 0x00, 0x56, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x1f, 0x00, 0x2d, 0x00, 0x37, 0x00, 0x00, 0x00, 0x11, 0x00, 0x1a, 0x00,
+  0x28, 0x00, 0x37, 0x00, 0x4d, 0x00, 0x64, 0x00, 0x7b, 0x00, 0x86, 0x00,
+  0x00, 0x00, 0x0a, 0x00, 0x13, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x0f, 0x00,
+  0x1e, 0x00, 0x28, 0x00, 0x32, 0x00, 0x3a, 0x00, 0x40, 0x00, 0x48, 0x00,
+  0x51, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x35, 0x00, 0x50, 0x00,
+  0x6a, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x12, 0x00, 0x1f, 0x00,
+  0x30, 0x00, 0x43, 0x00, 0x54, 0x00, 0x60, 0x00, 0x6a, 0x00, 0x6f, 0x00,
+  0x78, 0x00, 0x80, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x1b, 0x00, 0x00, 0x00,
+  0x34, 0x00, 0x43, 0x00, 0x51, 0x00, 0x60, 0x00, 0x75, 0x00, 0x8c, 0x00,
+  0xa2, 0x00, 0xba, 0x00, 0xd0, 0x00, 0xe8, 0x00, 0xfe, 0x00, 0x06, 0x01,
+  0x0e, 0x01, 0x19, 0x01, 0x22, 0x01, 0x2a, 0x01, 0x32, 0x01, 0x3b, 0x01,
+  0x44, 0x01, 0x4d, 0x01, 0x00, 0x00, 0x34, 0x00, 0x47, 0x00, 0x59, 0x00,
+  0x6f, 0x00, 0x78, 0x00, 0x81, 0x00, 0x88, 0x00, 0x93, 0x00, 0x9d, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x1e, 0x00, 0x2e, 0x00, 0x3b, 0x00, 0x49, 0x00,
+  0x5c, 0x00, 0x6b, 0x00, 0x7d, 0x00, 0x8e, 0x00, 0xa1, 0x00, 0xb2, 0x00,
+  0xc7, 0x00, 0xdb, 0x00, 0xe3, 0x00, 0xeb, 0x00, 0xf5, 0x00, 0xfd, 0x00,
+  0x06, 0x01, 0x0f, 0x01, 0x17, 0x01, 0x1e, 0x01, 0x28, 0x01, 0x30, 0x01,
+  0x36, 0x01, 0x3d, 0x01, 0x44, 0x01, 0x4d, 0x01, 0x56, 0x01, 0x5e, 0x01,
+  0x67, 0x01, 0x00, 0x00, 0x31, 0x00, 0x62, 0x00, 0x93, 0x00, 0xc4, 0x00,
+  0xcf, 0x00, 0xe0, 0x00, 0xeb, 0x00, 0xf6, 0x00, 0x01, 0x01, 0x0c, 0x01,
+  0x17, 0x01, 0x22, 0x01, 0x2d, 0x01, 0x38, 0x01, 0x43, 0x01, 0x4e, 0x01,
+  0x59, 0x01, 0x64, 0x01, 0x6f, 0x01, 0x7a, 0x01, 0x85, 0x01, 0x90, 0x01,
+  0x9b, 0x01, 0xa6, 0x01, 0xb1, 0x01, 0xbc, 0x01, 0xc7, 0x01, 0xd2, 0x01,
+  0xdd, 0x01, 0xe8, 0x01, 0xf3, 0x01, 0xfe, 0x01, 0x09, 0x02, 0x14, 0x02,
+  0x1f, 0x02, 0x2a, 0x02, 0x35, 0x02, 0x40, 0x02, 0x4b, 0x02, 0x56, 0x02,
+  0x61, 0x02, 0x6c, 0x02, 0x77, 0x02, 0x82, 0x02, 0x8d, 0x02, 0x98, 0x02,
+  0xa3, 0x02, 0xae, 0x02, 0xb9, 0x02, 0xc1, 0x02, 0xc9, 0x02, 0xd0, 0x02,
+  0xd7, 0x02, 0xe2, 0x02, 0x00, 0x00, 0x30, 0x00, 0x5f, 0x00, 0x8f, 0x00,
+  0xbe, 0x00, 0xee, 0x00, 0x1e, 0x01, 0x2c, 0x01, 0x37, 0x01, 0x45, 0x01,
+  0x5f, 0x01, 0x79, 0x01, 0x92, 0x01, 0x9e, 0x01, 0xa7, 0x01, 0xaf, 0x01,
+  0xbc, 0x01, 0xc9, 0x01, 0xd6, 0x01, 0xe3, 0x01, 0xf0, 0x01, 0xfb, 0x01,
+  0x00, 0x00, 0x12, 0x00, 0x19, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x39, 0x00,
+  0x55, 0x00, 0x70, 0x00, 0x8a, 0x00, 0xa4, 0x00, 0xbd, 0x00, 0xd7, 0x00,
+  0xf0, 0x00, 0x0a, 0x01, 0x27, 0x01, 0x42, 0x01, 0x5c, 0x01, 0x6f, 0x01,
+  0x82, 0x01, 0x91, 0x01, 0xaa, 0x01, 0xbe, 0x01, 0xd6, 0x01, 0xe6, 0x01,
+  0xf0, 0x01, 0xfa, 0x01, 0x04, 0x02, 0x0e, 0x02, 0x18, 0x02, 0x22, 0x02,
+  0x2c, 0x02, 0x36, 0x02, 0x3e, 0x02, 0x46, 0x02, 0x50, 0x02, 0x59, 0x02,
+  0x62, 0x02, 0x6c, 0x02, 0x73, 0x02, 0x00, 0x00, 0x10, 0x00, 0x1f, 0x00,
+  0x2f, 0x00, 0x45, 0x00, 0x59, 0x00, 0x6d, 0x00, 0x80, 0x00
+};
@@ -1,5 +1,7 @@
 #pragma once
-const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
+#include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/chr_dict_index.h>
+const unsigned char __espeakng_dict_chr[] __attribute__((aligned((4)))) = {
   0x00, 0x04, 0x00, 0x00, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -240,4 +242,11 @@ const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
   0x03, 0x39, 0x00, 0x68, 0x02, 0x12, 0x42, 0x00, 0x68, 0x02, 0x12, 0x44,
   0x00, 0x07, 0x00
 };
-size_t __espeakng_dictlen = 2859;
+
+BackgroundAudioDictionary dict_chr = {
+    "chr",
+    2859,
+    __espeakng_dict_chr,
+    2068,
+    __espeakng_dictindex_chr
+};
@@ -1,5 +1,7 @@
 #pragma once
-const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
+#include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/cmn_dict_index.h>
+const unsigned char __espeakng_dict_cmn[] __attribute__((aligned((4)))) = {
   0x00, 0x04, 0x00, 0x00, 0xf6, 0x15, 0x01, 0x00, 0x0a, 0x03, 0xe5, 0xb9,
   0xb2, 0x67, 0x61, 0x6e, 0x31, 0x00, 0x0c, 0x03, 0xe8, 0xac, 0x8a, 0x68,
   0x75, 0x61, 0x6e, 0x67, 0x33, 0x00, 0x0a, 0x03, 0xe9, 0xa5, 0x92, 0x72,
@@ -6047,4 +6049,11 @@ const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
   0x00, 0x32, 0x03, 0x73, 0x00, 0x34, 0x03, 0x76, 0x00, 0x31, 0x03, 0x79,
   0x00, 0x07, 0x00
 };
-size_t __espeakng_dictlen = 72543;
+
+BackgroundAudioDictionary dict_cmn = {
+    "cmn",
+    72543,
+    __espeakng_dict_cmn,
+    18566,
+    __espeakng_dictindex_cmn
+};
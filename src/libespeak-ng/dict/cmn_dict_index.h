@@ -0,0 +1,1551 @@
+#pragma once
+const unsigned char __espeakng_dictindex_cmn[] __attribute__((aligned((4)))) = {
+  0x45, 0x44, 0x58, 0x31, 0x5f, 0x1b, 0x01, 0x00, 0xf6, 0x15, 0x01, 0x00,
+  0x7b, 0x15, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x0c, 0x00, 0x1b, 0x00,
+  0x1d, 0x00, 0x22, 0x00, 0x25, 0x00, 0x29, 0x00, 0x2e, 0x00, 0x32, 0x00,
+  0x37, 0x00, 0x3d, 0x00, 0x41, 0x00, 0x44, 0x00, 0x4b, 0x00, 0x50, 0x00,
+  0x55, 0x00, 0x59, 0x00, 0x5e, 0x00, 0x62, 0x00, 0x68, 0x00, 0x6d, 0x00,
+  0x72, 0x00, 0x77, 0x00, 0x7d, 0x00, 0x83, 0x00, 0x86, 0x00, 0x88, 0x00,
+  0x8c, 0x00, 0x93, 0x00, 0x98, 0x00, 0x9d, 0x00, 0xa1, 0x00, 0xa4, 0x00,
+  0xa8, 0x00, 0xac, 0x00, 0xb7, 0x00, 0xbc, 0x00, 0xc2, 0x00, 0xc5, 0x00,
+  0xcc, 0x00, 0xd2, 0x00, 0xd7, 0x00, 0xdc, 0x00, 0xe2, 0x00, 0xe9, 0x00,
+  0xec, 0x00, 0xf1, 0x00, 0xf6, 0x00, 0xf9, 0x00, 0xfc, 0x00, 0x01, 0x01,
+  0x06, 0x01, 0x09, 0x01, 0x13, 0x01, 0x16, 0x01, 0x1a, 0x01, 0x1b, 0x01,
+  0x20, 0x01, 0x24, 0x01, 0x2a, 0x01, 0x2d, 0x01, 0x2e, 0x01, 0x33, 0x01,
+  0x37, 0x01, 0x3b, 0x01, 0x41, 0x01, 0x46, 0x01, 0x4a, 0x01, 0x4f, 0x01,
+  0x51, 0x01, 0x56, 0x01, 0x5d, 0x01, 0x5e, 0x01, 0x61, 0x01, 0x6c, 0x01,
+  0x6d, 0x01, 0x78, 0x01, 0x7a, 0x01, 0x7e, 0x01, 0x83, 0x01, 0x86, 0x01,
+  0x88, 0x01, 0x8d, 0x01, 0x8f, 0x01, 0x90, 0x01, 0x91, 0x01, 0x93, 0x01,
+  0x94, 0x01, 0x98, 0x01, 0x9d, 0x01, 0xa7, 0x01, 0xaa, 0x01, 0xb4, 0x01,
+  0xb7, 0x01, 0xb8, 0x01, 0xba, 0x01, 0xbb, 0x01, 0xbc, 0x01, 0xbe, 0x01,
+  0xc3, 0x01, 0xc6, 0x01, 0xca, 0x01, 0xce, 0x01, 0xd1, 0x01, 0xd8, 0x01,
+  0xdd, 0x01, 0xeb, 0x01, 0xf1, 0x01, 0xfd, 0x01, 0x05, 0x02, 0x08, 0x02,
+  0x0f, 0x02, 0x15, 0x02, 0x1a, 0x02, 0x1f, 0x02, 0x26, 0x02, 0x30, 0x02,
+  0x37, 0x02, 0x3b, 0x02, 0x43, 0x02, 0x46, 0x02, 0x48, 0x02, 0x4f, 0x02,
+  0x53, 0x02, 0x5e, 0x02, 0x65, 0x02, 0x6f, 0x02, 0x77, 0x02, 0x7b, 0x02,
+  0x80, 0x02, 0x89, 0x02, 0x8b, 0x02, 0x8c, 0x02, 0x8f, 0x02, 0x8f, 0x02,
+  0x8f, 0x02, 0x91, 0x02, 0x93, 0x02, 0x97, 0x02, 0x9a, 0x02, 0x9e, 0x02,
+  0xa1, 0x02, 0xa2, 0x02, 0xa6, 0x02, 0xa8, 0x02, 0xa9, 0x02, 0xa9, 0x02,
+  0xad, 0x02, 0xb1, 0x02, 0xb3, 0x02, 0xb6, 0x02, 0xb9, 0x02, 0xbc, 0x02,
+  0xbe, 0x02, 0xc1, 0x02, 0xc2, 0x02, 0xc4, 0x02, 0xc5, 0x02, 0xc9, 0x02,
+  0xcb, 0x02, 0xcc, 0x02, 0xcd, 0x02, 0xd1, 0x02, 0xd4, 0x02, 0xd6, 0x02,
+  0xd8, 0x02, 0xd8, 0x02, 0xdc, 0x02, 0xe1, 0x02, 0xe2, 0x02, 0xe5, 0x02,
+  0xe7, 0x02, 0xe8, 0x02, 0xe8, 0x02, 0xeb, 0x02, 0xec, 0x02, 0xef, 0x02,
+  0xf0, 0x02, 0xf1, 0x02, 0xf3, 0x02, 0xf3, 0x02, 0xf4, 0x02, 0xf8, 0x02,
+  0xfb, 0x02, 0xfb, 0x02, 0xfc, 0x02, 0xff, 0x02, 0x00, 0x03, 0x00, 0x03,
+  0x02, 0x03, 0x02, 0x03, 0x04, 0x03, 0x05, 0x03, 0x05, 0x03, 0x05, 0x03,
+  0x05, 0x03, 0x05, 0x03, 0x05, 0x03, 0x05, 0x03, 0x05, 0x03, 0x05, 0x03,
+  0x05, 0x03, 0x05, 0x03, 0x05, 0x03, 0x05, 0x03, 0x06, 0x03, 0x07, 0x03,
+  0x07, 0x03, 0x08, 0x03, 0x09, 0x03, 0x0a, 0x03, 0x0a, 0x03, 0x0b, 0x03,
+  0x0c, 0x03, 0x0c, 0x03, 0x0d, 0x03, 0x0d, 0x03, 0x0d, 0x03, 0x0d, 0x03,
+  0x0d, 0x03, 0x0e, 0x03, 0x0e, 0x03, 0x0f, 0x03, 0x10, 0x03, 0x11, 0x03,
+  0x11, 0x03, 0x12, 0x03, 0x12, 0x03, 0x13, 0x03, 0x13, 0x03, 0x14, 0x03,
+  0x14, 0x03, 0x15, 0x03, 0x17, 0x03, 0x19, 0x03, 0x19, 0x03, 0x1a, 0x03,
+  0x1a, 0x03, 0x1b, 0x03, 0x1c, 0x03, 0x1e, 0x03, 0x1e, 0x03, 0x1e, 0x03,
+  0x21, 0x03, 0x21, 0x03, 0x22, 0x03, 0x23, 0x03, 0x24, 0x03, 0x25, 0x03,
+  0x27, 0x03, 0x27, 0x03, 0x29, 0x03, 0x29, 0x03, 0x2a, 0x03, 0x2a, 0x03,
+  0x2a, 0x03, 0x2c, 0x03, 0x2c, 0x03, 0x2d, 0x03, 0x2e, 0x03, 0x32, 0x03,
+  0x33, 0x03, 0x34, 0x03, 0x35, 0x03, 0x36, 0x03, 0x38, 0x03, 0x38, 0x03,
+  0x3a, 0x03, 0x3b, 0x03, 0x3c, 0x03, 0x3c, 0x03, 0x3c, 0x03, 0x3f, 0x03,
+  0x40, 0x03, 0x40, 0x03, 0x40, 0x03, 0x40, 0x03, 0x41, 0x03, 0x42, 0x03,
+  0x42, 0x03, 0x42, 0x03, 0x42, 0x03, 0x42, 0x03, 0x42, 0x03, 0x42, 0x03,
+  0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03,
+  0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x44, 0x03, 0x44, 0x03,
+  0x45, 0x03, 0x46, 0x03, 0x46, 0x03, 0x46, 0x03, 0x46, 0x03, 0x46, 0x03,
+  0x47, 0x03, 0x47, 0x03, 0x47, 0x03, 0x48, 0x03, 0x48, 0x03, 0x49, 0x03,
+  0x49, 0x03, 0x49, 0x03, 0x49, 0x03, 0x49, 0x03, 0x4a, 0x03, 0x4a, 0x03,
+  0x4a, 0x03, 0x4a, 0x03, 0x4a, 0x03, 0x4a, 0x03, 0x4b, 0x03, 0x4c, 0x03,
+  0x4c, 0x03, 0x4c, 0x03, 0x4d, 0x03, 0x4d, 0x03, 0x4e, 0x03, 0x4f, 0x03,
+  0x4f, 0x03, 0x4f, 0x03, 0x4f, 0x03, 0x4f, 0x03, 0x4f, 0x03, 0x4f, 0x03,
+  0x4f, 0x03, 0x4f, 0x03, 0x50, 0x03, 0x50, 0x03, 0x50, 0x03, 0x50, 0x03,
+  0x50, 0x03, 0x50, 0x03, 0x51, 0x03, 0x51, 0x03, 0x51, 0x03, 0x51, 0x03,
+  0x51, 0x03, 0x51, 0x03, 0x51, 0x03, 0x51, 0x03, 0x51, 0x03, 0x51, 0x03,
+  0x51, 0x03, 0x51, 0x03, 0x51, 0x03, 0x51, 0x03, 0x52, 0x03, 0x53, 0x03,
+  0x54, 0x03, 0x55, 0x03, 0x57, 0x03, 0x59, 0x03, 0x5a, 0x03, 0x5c, 0x03,
+  0x5d, 0x03, 0x5f, 0x03, 0x60, 0x03, 0x61, 0x03, 0x63, 0x03, 0x65, 0x03,
+  0x68, 0x03, 0x6b, 0x03, 0x6d, 0x03, 0x6f, 0x03, 0x71, 0x03, 0x73, 0x03,
+  0x75, 0x03, 0x76, 0x03, 0x78, 0x03, 0x7a, 0x03, 0x7b, 0x03, 0x7c, 0x03,
+  0x7d, 0x03, 0x7e, 0x03, 0x7f, 0x03, 0x80, 0x03, 0x81, 0x03, 0x82, 0x03,
+  0x82, 0x03, 0x83, 0x03, 0x84, 0x03, 0x84, 0x03, 0x84, 0x03, 0x84, 0x03,
+  0x84, 0x03, 0x84, 0x03, 0x84, 0x03, 0x84, 0x03, 0x84, 0x03, 0x84, 0x03,
+  0x84, 0x03, 0x84, 0x03, 0x84, 0x03, 0x84, 0x03, 0x84, 0x03, 0x84, 0x03,
+  0x84, 0x03, 0x84, 0x03, 0x84, 0x03, 0x84, 0x03, 0x84, 0x03, 0x84, 0x03,
+  0x84, 0x03, 0x84, 0x03, 0x84, 0x03, 0x84, 0x03, 0x85, 0x03, 0x88, 0x03,
+  0x88, 0x03, 0x88, 0x03, 0x89, 0x03, 0x8c, 0x03, 0x8d, 0x03, 0x8f, 0x03,
+  0x8f, 0x03, 0x8f, 0x03, 0x90, 0x03, 0x90, 0x03, 0x91, 0x03, 0x91, 0x03,
+  0x91, 0x03, 0x91, 0x03, 0x91, 0x03, 0x91, 0x03, 0x92, 0x03, 0x93, 0x03,
+  0x93, 0x03, 0x94, 0x03, 0x94, 0x03, 0x94, 0x03, 0x94, 0x03, 0x95, 0x03,
+  0x95, 0x03, 0x95, 0x03, 0x95, 0x03, 0x96, 0x03, 0x96, 0x03, 0x96, 0x03,
+  0x96, 0x03, 0x96, 0x03, 0x96, 0x03, 0x96, 0x03, 0x9a, 0x03, 0x9c, 0x03,
+  0x9d, 0x03, 0x9f, 0x03, 0xa0, 0x03, 0xa2, 0x03, 0xa4, 0x03, 0xa6, 0x03,
+  0xa8, 0x03, 0xac, 0x03, 0xad, 0x03, 0xad, 0x03, 0xaf, 0x03, 0xb0, 0x03,
+  0xb1, 0x03, 0xb2, 0x03, 0xb4, 0x03, 0xb5, 0x03, 0xb6, 0x03, 0xb6, 0x03,
+  0xb7, 0x03, 0xb7, 0x03, 0xb7, 0x03, 0xb7, 0x03, 0xb7, 0x03, 0xb9, 0x03,
+  0xb9, 0x03, 0xba, 0x03, 0xbb, 0x03, 0xbc, 0x03, 0xbc, 0x03, 0xbc, 0x03,
+  0xc0, 0x03, 0xc4, 0x03, 0xc9, 0x03, 0xce, 0x03, 0xd4, 0x03, 0xda, 0x03,
+  0xe0, 0x03, 0xe6, 0x03, 0xe9, 0x03, 0xed, 0x03, 0xf0, 0x03, 0xf1, 0x03,
+  0xf2, 0x03, 0xf4, 0x03, 0xf7, 0x03, 0xf8, 0x03, 0xfa, 0x03, 0xfe, 0x03,
+  0x00, 0x04, 0x02, 0x04, 0x03, 0x04, 0x04, 0x04, 0x05, 0x04, 0x07, 0x04,
+  0x0b, 0x04, 0x11, 0x04, 0x13, 0x04, 0x13, 0x04, 0x17, 0x04, 0x19, 0x04,
+  0x1c, 0x04, 0x1e, 0x04, 0x23, 0x04, 0x25, 0x04, 0x26, 0x04, 0x2a, 0x04,
+  0x2e, 0x04, 0x32, 0x04, 0x3b, 0x04, 0x42, 0x04, 0x44, 0x04, 0x49, 0x04,
+  0x4d, 0x04, 0x52, 0x04, 0x56, 0x04, 0x5c, 0x04, 0x62, 0x04, 0x68, 0x04,
+  0x69, 0x04, 0x6a, 0x04, 0x6f, 0x04, 0x73, 0x04, 0x7a, 0x04, 0x7d, 0x04,
+  0x80, 0x04, 0x85, 0x04, 0x87, 0x04, 0x8a, 0x04, 0x8c, 0x04, 0x8e, 0x04,
+  0x92, 0x04, 0x99, 0x04, 0x9c, 0x04, 0xa1, 0x04, 0xa7, 0x04, 0xaa, 0x04,
+  0xaf, 0x04, 0xb2, 0x04, 0xb6, 0x04, 0xb9, 0x04, 0xc0, 0x04, 0xc4, 0x04,
+  0xc8, 0x04, 0xce, 0x04, 0xd0, 0x04, 0xd4, 0x04, 0xdc, 0x04, 0xdf, 0x04,
+  0xe4, 0x04, 0xe9, 0x04, 0xed, 0x04, 0xf3, 0x04, 0xf7, 0x04, 0xfb, 0x04,
+  0x00, 0x05, 0x03, 0x05, 0x04, 0x05, 0x05, 0x05, 0x0b, 0x05, 0x11, 0x05,
+  0x14, 0x05, 0x1a, 0x05, 0x1d, 0x05, 0x20, 0x05, 0x23, 0x05, 0x26, 0x05,
+  0x2c, 0x05, 0x35, 0x05, 0x3a, 0x05, 0x3e, 0x05, 0x46, 0x05, 0x49, 0x05,
+  0x4c, 0x05, 0x54, 0x05, 0x58, 0x05, 0x5c, 0x05, 0x60, 0x05, 0x66, 0x05,
+  0x6f, 0x05, 0x74, 0x05, 0x79, 0x05, 0x7f, 0x05, 0x82, 0x05, 0x86, 0x05,
+  0x8b, 0x05, 0x90, 0x05, 0x93, 0x05, 0x99, 0x05, 0xa0, 0x05, 0xa4, 0x05,
+  0xaa, 0x05, 0xb1, 0x05, 0xb4, 0x05, 0xb7, 0x05, 0xbb, 0x05, 0xbf, 0x05,
+  0xc3, 0x05, 0xc6, 0x05, 0xcd, 0x05, 0xd3, 0x05, 0xd8, 0x05, 0xde, 0x05,
+  0xe3, 0x05, 0xe9, 0x05, 0xef, 0x05, 0xf5, 0x05, 0xfa, 0x05, 0xff, 0x05,
+  0x06, 0x06, 0x07, 0x06, 0x0e, 0x06, 0x14, 0x06, 0x18, 0x06, 0x1f, 0x06,
+  0x27, 0x06, 0x2f, 0x06, 0x33, 0x06, 0x38, 0x06, 0x3b, 0x06, 0x3c, 0x06,
+  0x43, 0x06, 0x47, 0x06, 0x4e, 0x06, 0x53, 0x06, 0x57, 0x06, 0x5d, 0x06,
+  0x62, 0x06, 0x66, 0x06, 0x6e, 0x06, 0x75, 0x06, 0x7d, 0x06, 0x88, 0x06,
+  0x8d, 0x06, 0x92, 0x06, 0x98, 0x06, 0x9c, 0x06, 0xa1, 0x06, 0xa5, 0x06,
+  0xaa, 0x06, 0xb0, 0x06, 0xb4, 0x06, 0xb9, 0x06, 0xbf, 0x06, 0xc7, 0x06,
+  0xc9, 0x06, 0xcc, 0x06, 0xd2, 0x06, 0xd7, 0x06, 0xdc, 0x06, 0xe1, 0x06,
+  0xe6, 0x06, 0xf0, 0x06, 0xfc, 0x06, 0x05, 0x07, 0x0b, 0x07, 0x15, 0x07,
+  0x19, 0x07, 0x22, 0x07, 0x2a, 0x07, 0x30, 0x07, 0x35, 0x07, 0x3a, 0x07,
+  0x41, 0x07, 0x46, 0x07, 0x4d, 0x07, 0x53, 0x07, 0x5e, 0x07, 0x65, 0x07,
+  0x6f, 0x07, 0x75, 0x07, 0x7e, 0x07, 0x89, 0x07, 0x91, 0x07, 0x95, 0x07,
+  0x98, 0x07, 0x9e, 0x07, 0xa6, 0x07, 0xae, 0x07, 0xb8, 0x07, 0xc3, 0x07,
+  0xce, 0x07, 0xdc, 0x07, 0xe7, 0x07, 0xf0, 0x07, 0xfd, 0x07, 0x08, 0x08,
+  0x12, 0x08, 0x1d, 0x08, 0x26, 0x08, 0x32, 0x08, 0x3b, 0x08, 0x45, 0x08,
+  0x58, 0x08, 0x64, 0x08, 0x6c, 0x08, 0x78, 0x08, 0x85, 0x08, 0x93, 0x08,
+  0xa1, 0x08, 0xab, 0x08, 0xb8, 0x08, 0xc5, 0x08, 0xd2, 0x08, 0xe0, 0x08,
+  0xeb, 0x08, 0xf4, 0x08, 0x03, 0x09, 0x11, 0x09, 0x20, 0x09, 0x31, 0x09,
+  0x3e, 0x09, 0x4f, 0x09, 0x61, 0x09, 0x76, 0x09, 0x85, 0x09, 0x99, 0x09,
+  0xaa, 0x09, 0xb7, 0x09, 0xc5, 0x09, 0xd4, 0x09, 0xe1, 0x09, 0xf1, 0x09,
+  0xfe, 0x09, 0x0b, 0x0a, 0x1a, 0x0a, 0x24, 0x0a, 0x34, 0x0a, 0x46, 0x0a,
+  0x52, 0x0a, 0x5c, 0x0a, 0x6f, 0x0a, 0x7d, 0x0a, 0x89, 0x0a, 0x94, 0x0a,
+  0x9d, 0x0a, 0xad, 0x0a, 0xb8, 0x0a, 0xc5, 0x0a, 0xd4, 0x0a, 0xe4, 0x0a,
+  0xf2, 0x0a, 0xff, 0x0a, 0x0b, 0x0b, 0x19, 0x0b, 0x24, 0x0b, 0x3a, 0x0b,
+  0x46, 0x0b, 0x5a, 0x0b, 0x65, 0x0b, 0x72, 0x0b, 0x7a, 0x0b, 0x89, 0x0b,
+  0x9a, 0x0b, 0xa8, 0x0b, 0xb7, 0x0b, 0xc1, 0x0b, 0xcc, 0x0b, 0xdd, 0x0b,
+  0xeb, 0x0b, 0xf5, 0x0b, 0x02, 0x0c, 0x0a, 0x0c, 0x16, 0x0c, 0x21, 0x0c,
+  0x2e, 0x0c, 0x3a, 0x0c, 0x48, 0x0c, 0x57, 0x0c, 0x63, 0x0c, 0x6d, 0x0c,
+  0x7a, 0x0c, 0x85, 0x0c, 0x91, 0x0c, 0xa2, 0x0c, 0xb1, 0x0c, 0xbc, 0x0c,
+  0xc8, 0x0c, 0xd4, 0x0c, 0xdf, 0x0c, 0xec, 0x0c, 0xf7, 0x0c, 0x06, 0x0d,
+  0x12, 0x0d, 0x23, 0x0d, 0x2f, 0x0d, 0x3d, 0x0d, 0x4c, 0x0d, 0x57, 0x0d,
+  0x65, 0x0d, 0x70, 0x0d, 0x7b, 0x0d, 0x81, 0x0d, 0x8b, 0x0d, 0x97, 0x0d,
+  0xa0, 0x0d, 0xa5, 0x0d, 0xae, 0x0d, 0xb9, 0x0d, 0xc2, 0x0d, 0xd0, 0x0d,
+  0xd7, 0x0d, 0xe0, 0x0d, 0xee, 0x0d, 0xf8, 0x0d, 0xff, 0x0d, 0x04, 0x0e,
+  0x0c, 0x0e, 0x15, 0x0e, 0x1e, 0x0e, 0x29, 0x0e, 0x31, 0x0e, 0x3c, 0x0e,
+  0x47, 0x0e, 0x4e, 0x0e, 0x56, 0x0e, 0x60, 0x0e, 0x6b, 0x0e, 0x77, 0x0e,
+  0x86, 0x0e, 0x8e, 0x0e, 0x97, 0x0e, 0xa0, 0x0e, 0xa8, 0x0e, 0xae, 0x0e,
+  0xb3, 0x0e, 0xc0, 0x0e, 0xc9, 0x0e, 0xcc, 0x0e, 0xd6, 0x0e, 0xde, 0x0e,
+  0xe5, 0x0e, 0xef, 0x0e, 0xf9, 0x0e, 0x00, 0x0f, 0x09, 0x0f, 0x12, 0x0f,
+  0x19, 0x0f, 0x20, 0x0f, 0x27, 0x0f, 0x2c, 0x0f, 0x2f, 0x0f, 0x33, 0x0f,
+  0x37, 0x0f, 0x3b, 0x0f, 0x3e, 0x0f, 0x42, 0x0f, 0x48, 0x0f, 0x4c, 0x0f,
+  0x55, 0x0f, 0x5f, 0x0f, 0x6a, 0x0f, 0x6b, 0x0f, 0x72, 0x0f, 0x77, 0x0f,
+  0x81, 0x0f, 0x8b, 0x0f, 0x91, 0x0f, 0x99, 0x0f, 0xa7, 0x0f, 0xb2, 0x0f,
+  0xc4, 0x0f, 0xcd, 0x0f, 0xd5, 0x0f, 0xe1, 0x0f, 0xed, 0x0f, 0xf9, 0x0f,
+  0x00, 0x10, 0x09, 0x10, 0x15, 0x10, 0x21, 0x10, 0x2f, 0x10, 0x3f, 0x10,
+  0x4b, 0x10, 0x55, 0x10, 0x5e, 0x10, 0x69, 0x10, 0x76, 0x10, 0x7e, 0x10,
+  0x87, 0x10, 0x90, 0x10, 0x9c, 0x10, 0xa5, 0x10, 0xac, 0x10, 0xb3, 0x10,
+  0xbe, 0x10, 0xc9, 0x10, 0xd0, 0x10, 0xdb, 0x10, 0xe4, 0x10, 0xef, 0x10,
+  0xff, 0x10, 0x0d, 0x11, 0x1a, 0x11, 0x2a, 0x11, 0x3c, 0x11, 0x4c, 0x11,
+  0x5a, 0x11, 0x65, 0x11, 0x72, 0x11, 0x85, 0x11, 0x97, 0x11, 0xa8, 0x11,
+  0xb6, 0x11, 0xc4, 0x11, 0xd2, 0x11, 0xe3, 0x11, 0xef, 0x11, 0xfa, 0x11,
+  0x07, 0x12, 0x16, 0x12, 0x25, 0x12, 0x34, 0x12, 0x42, 0x12, 0x50, 0x12,
+  0x62, 0x12, 0x72, 0x12, 0x81, 0x12, 0x8c, 0x12, 0x99, 0x12, 0xa5, 0x12,
+  0xb3, 0x12, 0xbb, 0x12, 0xc2, 0x12, 0xcd, 0x12, 0xdc, 0x12, 0xe5, 0x12,
+  0xf1, 0x12, 0xfe, 0x12, 0x0e, 0x13, 0x13, 0x13, 0x1c, 0x13, 0x2a, 0x13,
+  0x35, 0x13, 0x3f, 0x13, 0x48, 0x13, 0x4f, 0x13, 0x56, 0x13, 0x62, 0x13,
+  0x69, 0x13, 0x6f, 0x13, 0x7d, 0x13, 0x84, 0x13, 0x8c, 0x13, 0x96, 0x13,
+  0x9b, 0x13, 0xa3, 0x13, 0xaf, 0x13, 0xb9, 0x13, 0xc2, 0x13, 0xc9, 0x13,
+  0xcf, 0x13, 0xd6, 0x13, 0xdc, 0x13, 0xdf, 0x13, 0xe8, 0x13, 0xf1, 0x13,
+  0xf9, 0x13, 0xfd, 0x13, 0x02, 0x14, 0x08, 0x14, 0x11, 0x14, 0x16, 0x14,
+  0x22, 0x14, 0x2b, 0x14, 0x31, 0x14, 0x36, 0x14, 0x3d, 0x14, 0x43, 0x14,
+  0x4a, 0x14, 0x4d, 0x14, 0x51, 0x14, 0x58, 0x14, 0x5f, 0x14, 0x65, 0x14,
+  0x6f, 0x14, 0x72, 0x14, 0x78, 0x14, 0x83, 0x14, 0x8a, 0x14, 0x91, 0x14,
+  0x9b, 0x14, 0xa4, 0x14, 0xac, 0x14, 0xb4, 0x14, 0xbb, 0x14, 0xbe, 0x14,
+  0xc3, 0x14, 0xce, 0x14, 0xd6, 0x14, 0xdf, 0x14, 0xe3, 0x14, 0xea, 0x14,
+  0xf2, 0x14, 0xf8, 0x14, 0xfe, 0x14, 0x02, 0x15, 0x0d, 0x15, 0x11, 0x15,
+  0x17, 0x15, 0x1e, 0x15, 0x24, 0x15, 0x2e, 0x15, 0x3a, 0x15, 0x42, 0x15,
+  0x48, 0x15, 0x53, 0x15, 0x60, 0x15, 0x69, 0x15, 0x6f, 0x15, 0x74, 0x15,
+  0x7b, 0x15, 0x00, 0x00, 0xed, 0xd1, 0x3d, 0x31, 0x3d, 0x8c, 0x02, 0x63,
+  0xcd, 0xda, 0x25, 0xf5, 0x31, 0x3e, 0xc6, 0x70, 0x35, 0x0b, 0x67, 0x04,
+  0x7f, 0x96, 0xa2, 0xcc, 0x09, 0x3f, 0x14, 0xef, 0x36, 0xbb, 0x58, 0xa4,
+  0x87, 0x9f, 0xf0, 0x72, 0xe5, 0xd6, 0x7a, 0xe9, 0x9d, 0x4a, 0x28, 0x2b,
+  0xdd, 0x7b, 0x37, 0x47, 0xd2, 0x5a, 0x79, 0x7a, 0x82, 0x2c, 0xc7, 0x95,
+  0xea, 0xec, 0x73, 0x8b, 0xe9, 0x63, 0xba, 0xd8, 0x95, 0xe2, 0xca, 0x88,
+  0xe2, 0x23, 0x5c, 0x68, 0xc5, 0x2b, 0xb3, 0x33, 0x4f, 0x71, 0x6d, 0x8e,
+  0xce, 0xd4, 0x78, 0xf9, 0xe0, 0x6e, 0xf2, 0xd4, 0xcc, 0xa0, 0xf2, 0x39,
+  0x0a, 0x9b, 0xf9, 0x2a, 0xfd, 0xa9, 0x5a, 0x07, 0x3c, 0x4c, 0xb8, 0x1d,
+  0x6d, 0x7a, 0x93, 0xdb, 0x65, 0x28, 0xcd, 0xe5, 0xa8, 0x04, 0x8f, 0x67,
+  0xf4, 0xec, 0x55, 0xe4, 0xeb, 0x02, 0x36, 0x00, 0x42, 0x30, 0x04, 0xb9,
+  0x88, 0x46, 0xe4, 0x05, 0x5a, 0x2f, 0x98, 0x68, 0xec, 0x4e, 0x64, 0xb2,
+  0x82, 0xef, 0x63, 0x16, 0x93, 0xee, 0xc7, 0xfe, 0x69, 0x0f, 0x72, 0x3a,
+  0x4e, 0x81, 0x94, 0x3b, 0x23, 0x2a, 0x3e, 0x22, 0x55, 0xb8, 0x15, 0xbd,
+  0x3f, 0x22, 0x07, 0x64, 0x34, 0x92, 0x78, 0x3d, 0xc1, 0xb1, 0xbf, 0x90,
+  0xd1, 0x4f, 0xb7, 0xda, 0x34, 0x50, 0x30, 0x03, 0xdb, 0x8f, 0x53, 0x22,
+  0xe5, 0xe2, 0xa2, 0x3d, 0x6b, 0x7a, 0x1f, 0x4e, 0xd4, 0x56, 0xef, 0x6e,
+  0xe2, 0x20, 0xd3, 0x7d, 0x79, 0x4e, 0x1d, 0xb6, 0x71, 0x2a, 0xb2, 0x19,
+  0xcc, 0xe3, 0x84, 0xed, 0x75, 0xb1, 0x05, 0x9e, 0x5c, 0x4e, 0xb2, 0xef,
+  0x6a, 0x49, 0xee, 0xc3, 0xf3, 0xde, 0x50, 0x8f, 0x62, 0x1e, 0x28, 0x85,
+  0x13, 0xc5, 0xc8, 0x72, 0xd9, 0x9c, 0xf8, 0x8c, 0x8c, 0x3e, 0x1c, 0xd5,
+  0x6c, 0xb4, 0xb8, 0x93, 0x41, 0xd7, 0x27, 0xc8, 0xd0, 0x29, 0xbe, 0xc5,
+  0xac, 0xf2, 0x25, 0xb7, 0x7f, 0x12, 0xa1, 0x2f, 0x56, 0x61, 0x65, 0xd2,
+  0x4e, 0xc7, 0xc5, 0xe6, 0x4c, 0xef, 0x23, 0xf1, 0x00, 0xc4, 0x6d, 0xac,
+  0x0d, 0x30, 0x13, 0xe2, 0xbf, 0x80, 0x03, 0xb9, 0x03, 0x9e, 0x5c, 0xe0,
+  0xae, 0x57, 0x7a, 0x1c, 0xcb, 0x1a, 0xf3, 0x03, 0x96, 0xec, 0x25, 0x54,
+  0x48, 0xfb, 0x72, 0x02, 0x1b, 0xc4, 0x54, 0x13, 0x80, 0x37, 0xb0, 0xb9,
+  0x2b, 0x14, 0x31, 0x54, 0xd2, 0x28, 0x74, 0xc0, 0x29, 0x10, 0x2e, 0xd9,
+  0x9a, 0x51, 0x76, 0x9e, 0xf9, 0x2a, 0x9d, 0xd3, 0xcc, 0x1a, 0xad, 0x8d,
+  0x80, 0x91, 0x63, 0xe3, 0x3b, 0xae, 0xc8, 0x6f, 0x88, 0xb8, 0xa5, 0x89,
+  0xb3, 0xd6, 0x07, 0xa9, 0xfb, 0x6c, 0x58, 0xc3, 0x9a, 0x48, 0x9a, 0xa1,
+  0xde, 0xe3, 0xe4, 0x05, 0x36, 0x95, 0x40, 0x6b, 0x3c, 0x85, 0xf7, 0x07,
+  0xcc, 0xae, 0xf0, 0x0e, 0x13, 0x5b, 0x4e, 0x91, 0xf5, 0x4c, 0xc5, 0x85,
+  0x22, 0x0b, 0x3a, 0xfc, 0x30, 0xb8, 0xe2, 0x73, 0x82, 0xb9, 0xb3, 0x71,
+  0x96, 0x80, 0xa0, 0x88, 0x5b, 0x11, 0x11, 0x46, 0x72, 0x74, 0xff, 0xde,
+  0xef, 0xac, 0x58, 0xbe, 0x2d, 0xe1, 0xe4, 0xa4, 0x54, 0x9c, 0x53, 0x17,
+  0x8d, 0xc4, 0x93, 0x7f, 0x9d, 0x1c, 0x8f, 0xac, 0x0c, 0x33, 0x15, 0xca,
+  0x3b, 0x4a, 0xc1, 0x15, 0xbb, 0xe0, 0x9d, 0x41, 0xeb, 0x37, 0xa8, 0x5b,
+  0x41, 0x97, 0x60, 0xd4, 0x91, 0x93, 0x23, 0xd3, 0x02, 0xae, 0xb1, 0x5e,
+  0x65, 0x1e, 0x48, 0x0d, 0x1e, 0xe5, 0xa6, 0xf6, 0x6c, 0x7c, 0x2e, 0x9e,
+  0x04, 0xd2, 0xae, 0x45, 0xa5, 0xf5, 0x61, 0x61, 0xfb, 0x22, 0xef, 0x77,
+  0x09, 0xda, 0xbc, 0xa1, 0x49, 0x6c, 0xcb, 0x06, 0x08, 0xe7, 0x7a, 0x2c,
+  0x84, 0xde, 0x0a, 0x1a, 0x58, 0x49, 0xab, 0x11, 0x4b, 0x39, 0x16, 0xcf,
+  0x25, 0xb9, 0x48, 0xbc, 0xea, 0x35, 0x77, 0xfe, 0x1e, 0xa8, 0x94, 0x75,
+  0x75, 0x21, 0x9d, 0x1d, 0x90, 0xd3, 0x01, 0x2f, 0xdf, 0x80, 0x29, 0x06,
+  0x96, 0xbb, 0x36, 0x4c, 0x27, 0xa7, 0x90, 0x9d, 0x6e, 0xc2, 0xb4, 0x90,
+  0xa4, 0xd3, 0xd4, 0x96, 0x04, 0x83, 0xb8, 0x42, 0xec, 0x8c, 0x0d, 0x0d,
+  0x22, 0x09, 0x8a, 0x45, 0x60, 0x26, 0x05, 0x81, 0xc5, 0x93, 0xdd, 0x6f,
+  0x19, 0xad, 0x57, 0x03, 0x8e, 0xf4, 0x94, 0x4d, 0xa4, 0x8e, 0xfe, 0x49,
+  0xfc, 0xdf, 0x8e, 0x6a, 0xaa, 0x44, 0xb3, 0x12, 0x4e, 0xaa, 0x37, 0x27,
+  0x38, 0xf5, 0x13, 0x7d, 0xe4, 0xaa, 0x21, 0xd9, 0xcd, 0xde, 0x80, 0x17,
+  0xfe, 0xea, 0x69, 0x23, 0x56, 0xbe, 0x89, 0x0f, 0x56, 0x2e, 0x7d, 0xe6,
+  0xf2, 0xf0, 0x37, 0xd5, 0x32, 0xc9, 0xd7, 0x78, 0xae, 0x70, 0x04, 0x1b,
+  0xb3, 0x54, 0x93, 0x0b, 0x10, 0xaf, 0x28, 0x08, 0xb9, 0xfb, 0x14, 0x8c,
+  0xe6, 0x3c, 0x1f, 0xef, 0xa2, 0x72, 0xb9, 0x8e, 0x4e, 0x46, 0x43, 0x36,
+  0x8b, 0xbe, 0x3d, 0xc3, 0x91, 0xb0, 0xa9, 0xc8, 0x57, 0x24, 0x65, 0x79,
+  0x02, 0xcb, 0x09, 0xcc, 0xb3, 0x27, 0xf2, 0xed, 0xd8, 0x8d, 0xe3, 0x9b,
+  0xe2, 0x24, 0x34, 0x56, 0xf3, 0x24, 0x09, 0xd5, 0xbe, 0x9a, 0x49, 0x32,
+  0xfe, 0x72, 0xaf, 0x62, 0x1a, 0x1e, 0x7b, 0x25, 0xaa, 0xb4, 0x75, 0x5a,
+  0xf9, 0x81, 0xff, 0x90, 0x6c, 0x3b, 0x10, 0xbb, 0x48, 0xf7, 0x08, 0x09,
+  0x9d, 0x37, 0x98, 0xbe, 0x72, 0x0d, 0x12, 0x1f, 0x08, 0xe1, 0xc1, 0x5e,
+  0xf2, 0x60, 0x85, 0x4a, 0x41, 0xbf, 0x45, 0x6e, 0xbe, 0x1a, 0xa9, 0xf2,
+  0x86, 0xd7, 0x84, 0x37, 0xde, 0x11, 0x03, 0x58, 0xd8, 0xac, 0x26, 0x31,
+  0x79, 0x14, 0xdb, 0xf2, 0xbd, 0x64, 0x85, 0x8c, 0xf5, 0x86, 0xbe, 0x8b,
+  0xbd, 0xd3, 0x23, 0x71, 0xd7, 0xbd, 0x22, 0x2a, 0xbf, 0x05, 0xae, 0x42,
+  0xa0, 0x17, 0xff, 0x80, 0xa7, 0x88, 0x91, 0x5e, 0x1e, 0xeb, 0x23, 0x00,
+  0x61, 0xdd, 0xe2, 0x4c, 0xe5, 0xa0, 0x12, 0xd5, 0x7f, 0x95, 0x01, 0x80,
+  0x43, 0xcc, 0x28, 0xf6, 0x09, 0xd4, 0x44, 0x89, 0x27, 0x5a, 0xa2, 0xec,
+  0xbc, 0xda, 0x4f, 0x77, 0xab, 0x68, 0xff, 0x0c, 0xc8, 0x3e, 0x9f, 0xf7,
+  0x22, 0xf0, 0xa9, 0xe0, 0xa3, 0x4b, 0x03, 0xc2, 0x0d, 0xfb, 0x07, 0xc3,
+  0x88, 0xd5, 0x92, 0x47, 0x87, 0x17, 0x99, 0x79, 0xc6, 0xe7, 0x07, 0x2e,
+  0x85, 0xd0, 0x40, 0x28, 0xb5, 0xdb, 0x01, 0x26, 0x92, 0x7e, 0x1b, 0xc7,
+  0x7c, 0xc1, 0xed, 0x5d, 0x31, 0x07, 0xa2, 0xa9, 0x1e, 0x34, 0x3d, 0x83,
+  0x4e, 0xa9, 0x73, 0xf3, 0xa9, 0x65, 0x59, 0xd0, 0xce, 0x4a, 0x7e, 0x3c,
+  0xef, 0x9b, 0xf1, 0x37, 0x04, 0xa0, 0x15, 0xa6, 0x32, 0xdb, 0x6b, 0xf8,
+  0x98, 0x0c, 0x6c, 0x33, 0xe6, 0xc9, 0xcd, 0x76, 0x31, 0xa4, 0xb4, 0xf7,
+  0x36, 0x70, 0xcd, 0xc0, 0xb6, 0x19, 0x84, 0x60, 0xdc, 0x15, 0x00, 0x6b,
+  0x40, 0x20, 0x1f, 0xe0, 0x35, 0x45, 0xc6, 0x52, 0x17, 0xc1, 0x07, 0x78,
+  0x96, 0xcf, 0x8c, 0xce, 0x48, 0x5c, 0x60, 0xd1, 0x88, 0x62, 0xde, 0x0a,
+  0xf3, 0x25, 0x73, 0xaa, 0x35, 0x6a, 0xe8, 0x55, 0xa6, 0x7e, 0xef, 0xec,
+  0xad, 0xa3, 0xed, 0x46, 0xc1, 0x59, 0x77, 0x01, 0x51, 0x98, 0x5f, 0xe8,
+  0xae, 0xe2, 0x0e, 0x17, 0x33, 0x57, 0x6b, 0x09, 0xb2, 0xe4, 0x14, 0x4c,
+  0xec, 0xee, 0x21, 0x4d, 0xdf, 0x82, 0x98, 0x2e, 0xe3, 0x77, 0xb5, 0x90,
+  0x08, 0xbf, 0x4a, 0xe0, 0xdd, 0x26, 0x2e, 0x1e, 0x8b, 0x85, 0xc4, 0x0a,
+  0xb1, 0x63, 0xcb, 0x97, 0x63, 0x18, 0x83, 0x80, 0x10, 0x7d, 0x29, 0x78,
+  0xff, 0x07, 0xae, 0x0c, 0xef, 0xf0, 0x71, 0x5b, 0xd3, 0xcb, 0x7a, 0x4d,
+  0xde, 0xd0, 0xec, 0x76, 0xb7, 0xb8, 0x54, 0x11, 0x02, 0x03, 0xa5, 0xa7,
+  0x99, 0x51, 0xc8, 0xe1, 0x10, 0x49, 0x95, 0x70, 0xd9, 0xe7, 0x01, 0xf4,
+  0x95, 0x70, 0x0e, 0xc2, 0x68, 0xd3, 0x61, 0x6b, 0x4e, 0x3e, 0xa7, 0x2f,
+  0x8e, 0xf5, 0x1d, 0xd9, 0x2e, 0x05, 0xb5, 0xe0, 0x9d, 0x09, 0xe0, 0xf2,
+  0x9d, 0xec, 0x5c, 0x0d, 0x48, 0xe1, 0x9c, 0x6e, 0x65, 0x77, 0xdf, 0xe8,
+  0x4d, 0x39, 0x2e, 0xdf, 0xf9, 0x4e, 0x24, 0x36, 0xf7, 0x56, 0x66, 0x83,
+  0xf2, 0xc4, 0x95, 0x41, 0x81, 0xa3, 0xb2, 0x57, 0xb9, 0xc0, 0x2f, 0xeb,
+  0xf9, 0x43, 0xb5, 0x25, 0x95, 0x31, 0x5b, 0xbd, 0x4d, 0xe8, 0x0a, 0xa3,
+  0xdb, 0xdc, 0x18, 0xdb, 0x3e, 0x41, 0x23, 0x3c, 0x3a, 0x18, 0xd7, 0xad,
+  0xc5, 0xaa, 0xb8, 0x44, 0x70, 0x52, 0x80, 0x4f, 0x9b, 0xec, 0x12, 0x4e,
+  0xdf, 0xdb, 0x98, 0x72, 0x94, 0x62, 0xfb, 0x76, 0x77, 0x74, 0xbf, 0x0a,
+  0x5c, 0x08, 0x4c, 0x47, 0xd7, 0xcd, 0x51, 0xe0, 0xf8, 0x1b, 0x3f, 0xc0,
+  0xfa, 0x73, 0x8b, 0xe0, 0xe6, 0x02, 0x08, 0xc8, 0x7a, 0xe3, 0x59, 0x91,
+  0x9b, 0x69, 0x10, 0xfa, 0x58, 0xd0, 0x71, 0x48, 0xf3, 0xdd, 0xbf, 0xac,
+  0x36, 0x39, 0xa1, 0x90, 0xe3, 0x0d, 0xae, 0x2b, 0x0d, 0x8b, 0x54, 0x92,
+  0xcb, 0xdf, 0xef, 0xf0, 0x35, 0xbe, 0x06, 0x19, 0xa9, 0xbc, 0x92, 0xa8,
+  0x34, 0xc6, 0x2d, 0xbe, 0x19, 0xb9, 0xff, 0x27, 0xa6, 0x01, 0xa9, 0x3d,
+  0x07, 0xb3, 0xcf, 0xb8, 0xf2, 0xb4, 0x4c, 0x72, 0x11, 0x77, 0x5e, 0x7e,
+  0x07, 0xd3, 0xf1, 0xe9, 0x9b, 0x76, 0x63, 0x03, 0x7a, 0xb9, 0x29, 0xcb,
+  0xf1, 0xa2, 0x73, 0x33, 0x2c, 0x13, 0x4f, 0x0d, 0x91, 0xe3, 0x24, 0x97,
+  0xf6, 0xd5, 0x4e, 0xb8, 0xe9, 0x0a, 0x0e, 0x85, 0xba, 0x8d, 0x3c, 0x6a,
+  0xd2, 0xc0, 0x29, 0x66, 0xee, 0x98, 0x83, 0x9a, 0x2e, 0xe4, 0x7c, 0x13,
+  0x81, 0x2d, 0x35, 0x32, 0xee, 0xce, 0xf3, 0x0b, 0x66, 0xf5, 0xa7, 0x02,
+  0xe9, 0xba, 0x7d, 0x4d, 0x6e, 0x4b, 0xfe, 0x29, 0x45, 0xe9, 0xee, 0x7c,
+  0x12, 0xb4, 0x18, 0x22, 0x84, 0x00, 0x28, 0x02, 0xa7, 0x8f, 0xf6, 0x97,
+  0xa0, 0x04, 0x98, 0x97, 0x70, 0x3c, 0x05, 0x6f, 0xa8, 0xff, 0x77, 0xb2,
+  0xb8, 0xa1, 0x13, 0x76, 0xa8, 0x0e, 0x66, 0xde, 0x19, 0x16, 0x60, 0xd4,
+  0x19, 0x66, 0x60, 0x27, 0xd6, 0x60, 0x41, 0xf3, 0x41, 0xc8, 0x40, 0x33,
+  0xfc, 0xa8, 0x10, 0xa9, 0xb5, 0x69, 0x95, 0x18, 0xbe, 0xdc, 0xe9, 0xd1,
+  0x52, 0x5c, 0x42, 0xf2, 0xe6, 0x05, 0x62, 0x25, 0x2b, 0x4c, 0x3d, 0x4f,
+  0x44, 0xd9, 0x85, 0x2f, 0x4c, 0x6d, 0x2c, 0xee, 0x02, 0x66, 0x5b, 0x15,
+  0x1a, 0x18, 0xaf, 0x3f, 0x6b, 0x84, 0x7c, 0x4f, 0x51, 0x98, 0xca, 0xdc,
+  0x5e, 0xd7, 0x2f, 0x0d, 0x32, 0x40, 0xc1, 0x9c, 0xa1, 0x76, 0xf4, 0xe3,
+  0xc6, 0xe2, 0x9f, 0x08, 0xf3, 0x75, 0x5b, 0xcb, 0x99, 0x47, 0xba, 0xa6,
+  0xaf, 0x72, 0xa2, 0x27, 0x3a, 0x28, 0xb6, 0x6c, 0x9e, 0x9f, 0x75, 0x56,
+  0xc4, 0x6f, 0xa7, 0x1b, 0xbc, 0xf8, 0x98, 0xe6, 0x60, 0xaf, 0x87, 0xeb,
+  0xb1, 0x13, 0xb6, 0x17, 0x26, 0x4a, 0x02, 0xa9, 0x3e, 0x0f, 0x4a, 0x0c,
+  0xf1, 0x50, 0x19, 0xdd, 0x61, 0xe5, 0x61, 0x77, 0x32, 0x73, 0xb3, 0x72,
+  0x8e, 0x0f, 0xdf, 0x30, 0x13, 0x61, 0x5b, 0x49, 0x05, 0xc8, 0x6c, 0x71,
+  0x1e, 0x36, 0xc0, 0x7b, 0xa9, 0xf9, 0x9a, 0x79, 0xb0, 0x1b, 0xfb, 0xa6,
+  0xeb, 0xd4, 0xfa, 0x65, 0x6c, 0xd3, 0x3f, 0x5a, 0x1f, 0x40, 0xf5, 0x59,
+  0x01, 0x8f, 0x95, 0xe7, 0x81, 0xd8, 0xec, 0xc9, 0xe2, 0x3d, 0x94, 0x64,
+  0xcc, 0x19, 0x74, 0xab, 0xd0, 0xc5, 0xd1, 0xa4, 0xda, 0xa6, 0x4d, 0x7b,
+  0x73, 0xaf, 0xa0, 0xd7, 0x77, 0x62, 0xae, 0x20, 0xae, 0x51, 0x45, 0x42,
+  0x00, 0x8b, 0x09, 0x95, 0x7d, 0x0f, 0x4d, 0x8b, 0xed, 0x19, 0xa7, 0x08,
+  0x70, 0x7d, 0xc6, 0x63, 0xe6, 0x99, 0xe2, 0xbf, 0x8c, 0x5f, 0x4b, 0xfe,
+  0x71, 0x66, 0x2a, 0x52, 0x61, 0x2b, 0x9e, 0x22, 0x63, 0x60, 0x31, 0xc1,
+  0xf5, 0x87, 0x76, 0xcd, 0xd4, 0xdd, 0x44, 0x19, 0x2f, 0x65, 0x8e, 0x9a,
+  0x77, 0x7a, 0xe4, 0xaa, 0xd3, 0xf6, 0x4e, 0xba, 0xe5, 0x69, 0x86, 0x40,
+  0x1c, 0x8a, 0x5b, 0x23, 0x8b, 0x25, 0xce, 0xee, 0x3c, 0x1a, 0x05, 0xff,
+  0x31, 0x6c, 0xe0, 0xfa, 0x08, 0xd2, 0x09, 0x9f, 0x8c, 0x4a, 0xbe, 0xc1,
+  0xd3, 0x45, 0x0b, 0xb6, 0xb1, 0xdc, 0x44, 0xd6, 0x22, 0x1f, 0xeb, 0xfb,
+  0x7e, 0x7a, 0x80, 0xee, 0x8f, 0xa7, 0xe1, 0x48, 0x05, 0x21, 0xd0, 0xbb,
+  0x79, 0xe2, 0xae, 0xc1, 0x1a, 0xc7, 0x73, 0x79, 0x45, 0x77, 0xab, 0xf0,
+  0xed, 0xc4, 0xf6, 0x67, 0x7a, 0x35, 0x40, 0xa8, 0x29, 0x61, 0x4f, 0x27,
+  0x6b, 0x8d, 0xd9, 0x9c, 0x8b, 0xb0, 0x68, 0x32, 0xb4, 0x4a, 0xe4, 0x1a,
+  0x44, 0xfe, 0x29, 0x0d, 0x52, 0x3e, 0x50, 0xad, 0xe6, 0x8f, 0x2b, 0xd6,
+  0x2c, 0x4a, 0x6b, 0x14, 0xef, 0x8c, 0xef, 0xd5, 0xac, 0xbe, 0xcb, 0x6c,
+  0xb4, 0x2c, 0x5c, 0xae, 0xfd, 0x57, 0x28, 0x0a, 0xdc, 0x7d, 0xde, 0xd9,
+  0x65, 0x57, 0x89, 0x06, 0xf6, 0x94, 0x66, 0x17, 0xb8, 0x28, 0xe1, 0xf4,
+  0x64, 0x0a, 0x32, 0xbb, 0xc9, 0x5e, 0x47, 0x8f, 0x3f, 0xd0, 0x4f, 0x54,
+  0x57, 0xee, 0xc9, 0x55, 0x16, 0x7e, 0xa7, 0xd0, 0xc7, 0xc0, 0x0a, 0x2c,
+  0x20, 0xa3, 0x98, 0x92, 0x79, 0x20, 0xfc, 0xb1, 0xe1, 0xa6, 0x69, 0xe0,
+  0x1d, 0xed, 0x13, 0x32, 0x64, 0x7d, 0x84, 0x31, 0x9f, 0x7e, 0x35, 0x9a,
+  0x92, 0x80, 0x07, 0x54, 0xb4, 0x48, 0xa4, 0xe5, 0xad, 0x03, 0xaf, 0x6d,
+  0x10, 0xc9, 0x2d, 0x4d, 0x38, 0xc0, 0x6b, 0x13, 0xe5, 0xc2, 0xab, 0x6c,
+  0x3d, 0x6c, 0xd4, 0xc2, 0xe9, 0xbd, 0x1d, 0xfd, 0xaf, 0x7e, 0xc9, 0xe5,
+  0x6d, 0x97, 0xf7, 0x2d, 0xc9, 0x3b, 0x81, 0x59, 0x2a, 0x3e, 0x9e, 0xfc,
+  0xa3, 0x77, 0x2b, 0xec, 0x08, 0x33, 0xc7, 0xeb, 0xb8, 0x9b, 0x1d, 0xd0,
+  0x54, 0x49, 0xd5, 0x36, 0xf7, 0xcb, 0x6b, 0xa3, 0xc2, 0xb5, 0x20, 0x1c,
+  0x6b, 0x05, 0x1b, 0xcd, 0xaf, 0xaa, 0xf6, 0x9a, 0xf4, 0x2b, 0x96, 0x45,
+  0x1d, 0x68, 0xf2, 0x8d, 0x69, 0x93, 0xc0, 0x2c, 0x9b, 0xac, 0xd5, 0x33,
+  0x33, 0xb5, 0x2a, 0xff, 0x72, 0x59, 0x19, 0x3a, 0xd2, 0xaa, 0xf9, 0x47,
+  0xb6, 0x9d, 0xb4, 0x3f, 0x21, 0xd4, 0xc2, 0x37, 0xf4, 0xc5, 0x7f, 0xa8,
+  0x4c, 0x08, 0x61, 0xad, 0x7b, 0x42, 0xff, 0x18, 0x49, 0x20, 0x4b, 0xb3,
+  0x40, 0xe6, 0x74, 0xe6, 0x74, 0xa0, 0xe0, 0xe0, 0x49, 0x58, 0x77, 0x49,
+  0x30, 0xc9, 0x3f, 0x36, 0xbb, 0x4f, 0xfa, 0x58, 0x02, 0x9f, 0x50, 0x11,
+  0xce, 0xec, 0x83, 0x0a, 0xc2, 0xdc, 0xba, 0x7b, 0x76, 0x19, 0xfc, 0x3c,
+  0x9a, 0x37, 0x48, 0xfe, 0xe7, 0xe5, 0x29, 0xe0, 0x65, 0x15, 0x2a, 0xb1,
+  0x1a, 0x0f, 0x9c, 0xcc, 0xcc, 0x7d, 0x05, 0x90, 0x84, 0x23, 0x8c, 0x84,
+  0x9b, 0x02, 0x7c, 0xbc, 0x72, 0x7c, 0x25, 0xf5, 0x0c, 0x71, 0x75, 0xd6,
+  0xef, 0xe1, 0xc5, 0x8d, 0xe3, 0x40, 0x85, 0x7a, 0x1a, 0xe1, 0xd3, 0x71,
+  0xe7, 0x67, 0x5d, 0x8d, 0xdf, 0x0e, 0x64, 0x58, 0x9f, 0x7e, 0xf4, 0xc3,
+  0xb5, 0xd6, 0x35, 0x9e, 0x7d, 0x08, 0xc4, 0x73, 0x76, 0x4a, 0xac, 0xa6,
+  0x02, 0x03, 0xde, 0x32, 0x1b, 0x96, 0xb0, 0xf4, 0x5b, 0x3f, 0x94, 0x3e,
+  0x5e, 0xf1, 0xf4, 0xfd, 0x19, 0x2f, 0xa5, 0xc1, 0x51, 0x21, 0x8f, 0xcf,
+  0x5d, 0xe3, 0xe8, 0x22, 0xdd, 0x86, 0xad, 0xe9, 0x63, 0xad, 0x0c, 0x97,
+  0x92, 0x70, 0x6c, 0x2e, 0x0c, 0x40, 0x60, 0x0f, 0xb5, 0x4f, 0x04, 0x5e,
+  0xff, 0xc4, 0xe8, 0x03, 0xa4, 0xf3, 0xcb, 0x6d, 0xc7, 0x01, 0xf0, 0xfc,
+  0x29, 0xb0, 0x03, 0xf0, 0x18, 0x25, 0x73, 0x26, 0xe3, 0x28, 0xd6, 0x17,
+  0x62, 0x89, 0x56, 0xc5, 0x55, 0xf2, 0xa7, 0xe8, 0x4f, 0x81, 0xcb, 0x79,
+  0x38, 0x38, 0x32, 0x07, 0x8c, 0x8d, 0x6b, 0x2e, 0x0d, 0x13, 0x34, 0x73,
+  0x13, 0x05, 0xab, 0xe6, 0x32, 0xbd, 0xd2, 0x6a, 0x81, 0x75, 0x52, 0x1a,
+  0xc6, 0x03, 0xa8, 0x9e, 0xac, 0x23, 0x4a, 0xc5, 0xcf, 0x82, 0xb2, 0x81,
+  0xd1, 0x78, 0x8c, 0x31, 0xa0, 0x21, 0x47, 0x86, 0x93, 0xb7, 0x64, 0x51,
+  0x60, 0xe6, 0x32, 0x80, 0x59, 0x74, 0xd4, 0x40, 0x5a, 0xc3, 0xb4, 0x0c,
+  0xad, 0xf4, 0x49, 0x61, 0x4e, 0xfb, 0x92, 0x21, 0x65, 0xf0, 0x48, 0xc3,
+  0xb5, 0x54, 0x21, 0x80, 0xc7, 0x17, 0xdd, 0x68, 0x3e, 0xd3, 0x91, 0x64,
+  0x88, 0x5c, 0x17, 0x31, 0x51, 0xb7, 0xb6, 0xe2, 0x7f, 0x1a, 0xa9, 0x6f,
+  0xa0, 0xf1, 0x16, 0x22, 0x25, 0x70, 0xe2, 0x80, 0x5d, 0xc0, 0x17, 0xa2,
+  0xdb, 0x99, 0xc7, 0x53, 0x8a, 0x97, 0xa7, 0x35, 0xc4, 0x47, 0xaa, 0xfe,
+  0x70, 0x0e, 0x17, 0x63, 0xc3, 0x79, 0x0e, 0x55, 0x9b, 0x7c, 0x0d, 0xda,
+  0x70, 0x6b, 0x00, 0x7b, 0xf1, 0xb9, 0xfc, 0x39, 0xba, 0x3f, 0x78, 0x60,
+  0xf6, 0xe0, 0xfb, 0xe5, 0xc9, 0xf9, 0xbf, 0x41, 0x14, 0xd6, 0x0f, 0xb5,
+  0xe9, 0x66, 0x53, 0x73, 0xc2, 0xc1, 0xfd, 0xa3, 0x0e, 0x5a, 0x4e, 0x4d,
+  0xb3, 0xef, 0xcd, 0x45, 0x33, 0x9b, 0x2a, 0xdc, 0xd2, 0x23, 0x61, 0xc0,
+  0xfb, 0x40, 0x14, 0xb4, 0xf0, 0x95, 0xbf, 0x32, 0x6f, 0x61, 0x69, 0xa6,
+  0x15, 0x9c, 0x36, 0x66, 0x4e, 0x14, 0x3f, 0x46, 0x7b, 0xd1, 0x46, 0xda,
+  0xc9, 0x1f, 0x32, 0xa3, 0x5c, 0xa1, 0x94, 0x93, 0xff, 0xef, 0xdd, 0x23,
+  0xd9, 0x44, 0x18, 0x89, 0x9b, 0x62, 0x4b, 0x0f, 0x6b, 0xec, 0x4f, 0x6c,
+  0x2c, 0xd9, 0x06, 0x30, 0x2a, 0x65, 0xf9, 0x94, 0x3e, 0x53, 0xac, 0x24,
+  0xbb, 0x3a, 0x70, 0x83, 0xbc, 0xae, 0x68, 0x03, 0x36, 0x1f, 0x73, 0x98,
+  0xeb, 0xfe, 0x1a, 0x2c, 0x9a, 0x5e, 0x00, 0x33, 0xb4, 0xb3, 0x01, 0xf9,
+  0x9c, 0xaa, 0xed, 0xe8, 0x0f, 0x70, 0x0d, 0x86, 0x0d, 0x6c, 0x4a, 0xc7,
+  0xd0, 0x54, 0x9f, 0x71, 0x20, 0x5c, 0xd3, 0x42, 0x4e, 0xec, 0xe5, 0xaf,
+  0x03, 0xef, 0x1d, 0x40, 0x58, 0x48, 0xa2, 0x95, 0x27, 0xde, 0x1b, 0x8d,
+  0x40, 0x2c, 0xac, 0x79, 0x89, 0xce, 0xcd, 0x34, 0x53, 0x34, 0x0a, 0x71,
+  0x18, 0x12, 0x7a, 0x10, 0x98, 0x21, 0xea, 0x7f, 0x6f, 0x95, 0xca, 0x56,
+  0xe3, 0x5d, 0xac, 0xcd, 0xa9, 0x61, 0xc5, 0x40, 0x74, 0x01, 0x81, 0xc5,
+  0x23, 0xe6, 0x97, 0xf6, 0x5b, 0xbb, 0x5f, 0xd9, 0x7a, 0xd4, 0x19, 0x02,
+  0x17, 0x0d, 0xfd, 0x7d, 0xf4, 0xeb, 0xf2, 0x2e, 0xf3, 0x2e, 0x9e, 0x06,
+  0xec, 0x6f, 0x3c, 0xb2, 0x7a, 0xff, 0x4a, 0xcb, 0x7a, 0xb3, 0x62, 0x94,
+  0x3c, 0xf6, 0x92, 0xfb, 0x34, 0x5c, 0x0f, 0x67, 0xf3, 0xe4, 0x75, 0x9b,
+  0x20, 0x9d, 0x66, 0x2a, 0x4b, 0x5a, 0xa7, 0x1e, 0xb5, 0x1f, 0x20, 0xaf,
+  0x54, 0x1d, 0x0a, 0x8d, 0xf4, 0xec, 0x9a, 0x7c, 0x48, 0x7a, 0x11, 0x24,
+  0x32, 0x87, 0x89, 0xf4, 0xc4, 0x71, 0xf1, 0xba, 0xaf, 0xb9, 0xf3, 0x6e,
+  0xbf, 0x49, 0xbc, 0xc7, 0x4e, 0x7f, 0x34, 0x63, 0x72, 0x22, 0xc7, 0x89,
+  0x4d, 0x28, 0x87, 0x5b, 0xf8, 0xcf, 0xbe, 0x2b, 0x5a, 0x56, 0xeb, 0x50,
+  0x1d, 0xfb, 0xf3, 0x09, 0x5a, 0x7e, 0x58, 0x12, 0xbf, 0xe8, 0xc3, 0x47,
+  0xb6, 0xa0, 0x47, 0xca, 0xbd, 0x86, 0x8a, 0x7c, 0x77, 0x5a, 0x41, 0x5e,
+  0x43, 0x3b, 0x03, 0x48, 0xeb, 0xc8, 0x24, 0x0e, 0xd6, 0xce, 0x29, 0xa0,
+  0x91, 0xdf, 0x5e, 0x3d, 0xde, 0x97, 0xce, 0xec, 0xa4, 0xa7, 0x03, 0x78,
+  0x1f, 0x6d, 0xa3, 0xa8, 0x82, 0x26, 0x5a, 0x42, 0x59, 0x75, 0x7c, 0xd6,
+  0x3b, 0x7b, 0x2a, 0x66, 0xf7, 0x25, 0x8b, 0x9c, 0xd7, 0x55, 0xfe, 0xb4,
+  0xa7, 0x36, 0xdd, 0x82, 0x97, 0x7f, 0x16, 0x7a, 0xf5, 0x66, 0xde, 0x7f,
+  0x03, 0x91, 0x5f, 0x4f, 0xa2, 0xa5, 0x2b, 0x3e, 0xd5, 0x55, 0xc4, 0x93,
+  0x5e, 0x2c, 0x3e, 0x30, 0x77, 0x04, 0x03, 0x8b, 0x7e, 0x1e, 0xd2, 0x51,
+  0x37, 0x1d, 0x1a, 0x38, 0x64, 0x90, 0x68, 0x75, 0xcb, 0xac, 0xa3, 0x9b,
+  0x7c, 0x45, 0x8e, 0x8c, 0xb0, 0xf2, 0x06, 0xf0, 0xc0, 0xbe, 0x32, 0x61,
+  0xe5, 0x64, 0xe8, 0x34, 0xc7, 0x5f, 0x05, 0x35, 0x41, 0x95, 0xf5, 0xe4,
+  0x10, 0x76, 0xa1, 0x78, 0xef, 0x93, 0x9a, 0xdd, 0xd3, 0xde, 0x8f, 0xce,
+  0xe2, 0xc4, 0x6d, 0x83, 0x47, 0xfb, 0xd0, 0x1a, 0x9a, 0x29, 0xe2, 0xc8,
+  0x6f, 0x53, 0x21, 0x61, 0x51, 0x64, 0x3c, 0xf1, 0x09, 0x98, 0xfd, 0x4b,
+  0x3e, 0x68, 0x15, 0xb3, 0xbb, 0xed, 0x18, 0x21, 0x9a, 0xae, 0x45, 0x80,
+  0x2c, 0xa6, 0x1a, 0x81, 0xc9, 0x59, 0x80, 0xdb, 0x57, 0x9d, 0xa9, 0x68,
+  0x0b, 0xbb, 0xb0, 0xd4, 0x19, 0x09, 0x84, 0xb0, 0x12, 0x37, 0x41, 0xc5,
+  0x82, 0xbb, 0x31, 0x35, 0x29, 0x9e, 0xa9, 0x59, 0x89, 0x9b, 0x33, 0x2f,
+  0xaa, 0x7e, 0xa7, 0xcc, 0xcd, 0xe6, 0x11, 0x88, 0x60, 0xb6, 0x48, 0xda,
+  0xab, 0x99, 0xf1, 0x0b, 0xd3, 0x43, 0x6f, 0x45, 0x65, 0x58, 0x4f, 0xa8,
+  0xfc, 0xb4, 0x5a, 0x70, 0x8f, 0x9a, 0x66, 0xee, 0x1f, 0xb3, 0x3e, 0x34,
+  0xf6, 0x76, 0x9a, 0x5c, 0x78, 0xcc, 0xe5, 0x10, 0x6d, 0x2f, 0xa3, 0xf7,
+  0x8c, 0x41, 0xe5, 0x0e, 0xce, 0xe7, 0x7b, 0xdc, 0xfc, 0x57, 0xa9, 0xe8,
+  0xfe, 0xaa, 0x3a, 0x85, 0xc3, 0x2d, 0xd8, 0xd9, 0x05, 0x21, 0xdd, 0x5f,
+  0xbd, 0x79, 0x0f, 0x95, 0x32, 0x93, 0x20, 0xca, 0x55, 0x58, 0xa9, 0xce,
+  0xd1, 0xeb, 0x9e, 0x1c, 0x70, 0x7d, 0x30, 0x6f, 0xb9, 0x09, 0xcb, 0xb3,
+  0xef, 0xe2, 0x0b, 0x42, 0xb5, 0xf4, 0xc0, 0x10, 0x38, 0x38, 0x94, 0x0e,
+  0x91, 0x3b, 0xc5, 0xec, 0x92, 0x37, 0x95, 0xa8, 0xaf, 0x25, 0x78, 0x29,
+  0x89, 0xac, 0x13, 0x2d, 0x4a, 0x5f, 0x01, 0xff, 0x3b, 0x45, 0x1c, 0xa9,
+  0xf9, 0xd0, 0xca, 0x9f, 0x37, 0x88, 0xcf, 0x4f, 0x08, 0xa5, 0xd0, 0x5a,
+  0xef, 0x3b, 0x7f, 0x6a, 0x89, 0x39, 0x54, 0xc7, 0x69, 0x2f, 0x8f, 0xc7,
+  0xfd, 0x59, 0x32, 0xf3, 0x96, 0x8c, 0xfe, 0x1f, 0xca, 0xe6, 0x6b, 0xf7,
+  0xbb, 0xf7, 0x43, 0x0a, 0x63, 0xa7, 0x55, 0xef, 0xc8, 0x19, 0x9e, 0xaa,
+  0x10, 0x31, 0xfa, 0x4a, 0xc4, 0x5d, 0x07, 0x8f, 0x02, 0xfe, 0x39, 0x07,
+  0x2d, 0xf8, 0xad, 0xa3, 0x0a, 0xd0, 0x57, 0xc8, 0x92, 0xa0, 0x0d, 0xb0,
+  0xd9, 0xd0, 0xa4, 0xbd, 0x93, 0xf0, 0x87, 0x3d, 0xd7, 0x95, 0xd9, 0xe2,
+  0x44, 0x44, 0x20, 0x80, 0x30, 0xac, 0x26, 0x74, 0x2d, 0xf6, 0xb5, 0xbd,
+  0x18, 0xd0, 0xba, 0xf3, 0x73, 0x10, 0xb0, 0xb2, 0xd5, 0xa5, 0x8d, 0x44,
+  0x62, 0xd9, 0x68, 0xd3, 0x77, 0x63, 0x4b, 0x5b, 0x1d, 0x83, 0x1f, 0x01,
+  0x22, 0xcc, 0xe9, 0x35, 0xd4, 0xcf, 0x2d, 0x92, 0xa0, 0x90, 0x65, 0x47,
+  0x85, 0x21, 0xe8, 0x53, 0x26, 0x32, 0x1e, 0x22, 0xd5, 0xe5, 0x3e, 0x53,
+  0xfc, 0xdb, 0x52, 0x5f, 0x21, 0x2d, 0x73, 0x51, 0xf3, 0x58, 0x70, 0x1b,
+  0x01, 0x22, 0xe6, 0x3f, 0xe4, 0x05, 0xb4, 0x86, 0x37, 0x3f, 0x1c, 0xc0,
+  0x21, 0xc6, 0xf0, 0xd2, 0x62, 0xda, 0x03, 0x91, 0xfd, 0x48, 0x0e, 0x71,
+  0x0c, 0x44, 0x40, 0x03, 0xd1, 0x64, 0x04, 0x6a, 0xfe, 0x5a, 0x22, 0x48,
+  0xea, 0x40, 0x99, 0x8b, 0xff, 0xa3, 0x25, 0xf7, 0xaa, 0xd7, 0x8e, 0x1f,
+  0xc3, 0xa1, 0x58, 0x69, 0x61, 0x62, 0xb4, 0x66, 0xd0, 0x4f, 0x23, 0x53,
+  0xea, 0x55, 0x51, 0xf9, 0xfd, 0xa7, 0xc7, 0x8b, 0x60, 0x81, 0xd2, 0x9e,
+  0x11, 0x43, 0x08, 0x74, 0xb9, 0xe0, 0xce, 0x81, 0x36, 0x72, 0xff, 0xd2,
+  0x10, 0x39, 0x70, 0xdd, 0xdc, 0x50, 0x42, 0xd6, 0xb2, 0xb0, 0x01, 0xd4,
+  0xaf, 0xbf, 0xa4, 0xab, 0xda, 0x6a, 0x24, 0xf3, 0x4b, 0x1a, 0x01, 0x94,
+  0x77, 0x5a, 0x07, 0xa6, 0xe1, 0x1c, 0x5c, 0xd1, 0x2a, 0xbf, 0x2d, 0x3d,
+  0x6e, 0x26, 0x96, 0x91, 0x27, 0xcb, 0x41, 0xb4, 0x2a, 0xbb, 0xae, 0x60,
+  0x28, 0xdb, 0xd3, 0xf8, 0xaf, 0x1d, 0xae, 0xf6, 0xc3, 0x82, 0xc9, 0xe5,
+  0x9e, 0x47, 0x94, 0x38, 0xd4, 0x38, 0xcd, 0x69, 0xa8, 0x7b, 0xac, 0xc0,
+  0x66, 0x54, 0xfa, 0x64, 0x4f, 0x1c, 0xde, 0xb0, 0x71, 0x50, 0xaf, 0xce,
+  0x96, 0xf3, 0x46, 0xd9, 0x7a, 0x05, 0x83, 0x4d, 0xa0, 0x5b, 0xe8, 0x97,
+  0xe9, 0x37, 0x25, 0xe5, 0x84, 0x12, 0x47, 0x89, 0x4a, 0x9e, 0x68, 0x49,
+  0x13, 0x8e, 0xfa, 0x9a, 0x20, 0x77, 0xbc, 0x81, 0x85, 0x9a, 0xb3, 0x7f,
+  0x86, 0x24, 0x2f, 0x4a, 0x0c, 0x44, 0x43, 0xab, 0x66, 0xaf, 0x25, 0x49,
+  0x9d, 0x78, 0x3a, 0xbd, 0x7f, 0x8d, 0x80, 0x90, 0xfa, 0x11, 0xd5, 0x1c,
+  0xd9, 0x37, 0xc9, 0x2f, 0xe8, 0xbd, 0x87, 0x9e, 0x7f, 0x52, 0x5f, 0x72,
+  0xaa, 0x80, 0x38, 0xfc, 0xfe, 0x20, 0x4b, 0xec, 0xfc, 0x83, 0xd5, 0x18,
+  0x13, 0x1c, 0x82, 0xd4, 0xee, 0x8a, 0x4e, 0x8a, 0xde, 0x1c, 0x28, 0xa3,
+  0x4a, 0x38, 0x1f, 0x15, 0x01, 0x41, 0x0c, 0x28, 0xeb, 0x98, 0x1b, 0x4a,
+  0xb1, 0x85, 0xe7, 0x95, 0xe5, 0xf6, 0xc8, 0xb3, 0xe2, 0x9f, 0x46, 0x3d,
+  0xd0, 0x19, 0x22, 0xb9, 0x98, 0xc4, 0xee, 0x28, 0x22, 0x4c, 0xb7, 0xf4,
+  0x83, 0xba, 0xa8, 0x12, 0x63, 0x68, 0x42, 0x29, 0x5c, 0x44, 0xbb, 0xed,
+  0xe6, 0x63, 0xa7, 0xce, 0x00, 0xf1, 0x90, 0x53, 0x60, 0xf7, 0x27, 0x1f,
+  0x57, 0xb6, 0x57, 0x42, 0xc7, 0xf4, 0xfd, 0x4f, 0xf8, 0x31, 0x51, 0x25,
+  0x0a, 0x21, 0xb0, 0xaa, 0x82, 0xf8, 0x62, 0x3b, 0x69, 0x84, 0x96, 0x41,
+  0x96, 0x91, 0x74, 0xef, 0x76, 0x2f, 0xdf, 0x0b, 0x8d, 0x12, 0x05, 0xc1,
+  0x06, 0xcd, 0x1f, 0xc8, 0xbd, 0x28, 0x5d, 0x47, 0xf7, 0xf5, 0x00, 0x1d,
+  0x33, 0x04, 0x19, 0xc2, 0x7d, 0xb0, 0xc2, 0x97, 0x1d, 0xa5, 0xd6, 0xa5,
+  0x8a, 0xeb, 0x7a, 0xcd, 0x3a, 0x02, 0x8f, 0x1e, 0x31, 0xc3, 0xac, 0x26,
+  0x0a, 0xb4, 0xfa, 0xe6, 0x4c, 0xa9, 0xb3, 0x6f, 0x27, 0x4d, 0x01, 0xf9,
+  0x5b, 0x85, 0xc5, 0x39, 0xe0, 0xce, 0x13, 0x51, 0xee, 0x83, 0xfa, 0xe5,
+  0xc2, 0x8c, 0x31, 0x70, 0x54, 0xe0, 0xd8, 0xed, 0x67, 0xe6, 0x52, 0xdf,
+  0x12, 0x5d, 0xeb, 0xf3, 0x70, 0x4a, 0xb8, 0x7c, 0xee, 0xa1, 0xe2, 0x0a,
+  0x98, 0x17, 0xd0, 0x1e, 0x3b, 0x5e, 0x6d, 0x89, 0x3f, 0xd7, 0xae, 0xfe,
+  0xb5, 0x1c, 0x9b, 0x61, 0x1d, 0x2b, 0x8a, 0x0d, 0x8f, 0x5b, 0x3e, 0x3f,
+  0x2e, 0xbb, 0x50, 0x74, 0x3f, 0xe4, 0x39, 0xa0, 0xdc, 0x81, 0xc9, 0x32,
+  0xb0, 0xcb, 0x2f, 0x62, 0xc6, 0xe7, 0x38, 0xdc, 0xd3, 0x94, 0x5c, 0x4b,
+  0x5e, 0xc7, 0x2c, 0x31, 0xab, 0x4a, 0xdf, 0x89, 0x32, 0x21, 0xc0, 0xc5,
+  0xed, 0x70, 0x54, 0x19, 0x77, 0x6b, 0xe3, 0x61, 0x02, 0x87, 0x03, 0x75,
+  0x9a, 0x54, 0x6b, 0x6f, 0x68, 0xa8, 0xde, 0xce, 0x83, 0x36, 0xf8, 0x8a,
+  0x81, 0x65, 0xf8, 0xf3, 0x3e, 0x17, 0xc1, 0x81, 0xb8, 0xaf, 0xed, 0xc5,
+  0x25, 0x54, 0xd6, 0xca, 0x1e, 0x13, 0xd1, 0xd0, 0x6c, 0xe7, 0xd8, 0x54,
+  0x23, 0x12, 0xad, 0xca, 0x20, 0xed, 0xf1, 0xb8, 0xde, 0x39, 0x85, 0x28,
+  0xe5, 0x5b, 0xfb, 0x89, 0xfd, 0x2a, 0x33, 0x53, 0x7c, 0x2d, 0xf3, 0x7f,
+  0x92, 0xe5, 0x33, 0x10, 0xdb, 0x88, 0xaf, 0xc2, 0x38, 0xd4, 0x5e, 0xb0,
+  0xde, 0x90, 0x0f, 0xb9, 0x26, 0x80, 0x8a, 0x64, 0xf6, 0x44, 0xe6, 0x35,
+  0xfe, 0x23, 0x94, 0xfa, 0x50, 0xc2, 0xef, 0x67, 0x23, 0x9b, 0xca, 0x62,
+  0x55, 0xae, 0x37, 0xa3, 0xdb, 0x16, 0x98, 0x90, 0xba, 0x40, 0x08, 0x39,
+  0x0c, 0x65, 0x60, 0x56, 0xc8, 0x60, 0x80, 0x96, 0xcd, 0xc0, 0x34, 0xe5,
+  0x10, 0x1b, 0xd7, 0xe9, 0x88, 0x97, 0x47, 0xb9, 0xbe, 0x84, 0x61, 0x56,
+  0x71, 0xac, 0xc1, 0xfe, 0x5f, 0x2d, 0x49, 0x9c, 0x8c, 0x01, 0x86, 0x7d,
+  0xbd, 0xc7, 0x2d, 0xe6, 0x0c, 0x0e, 0x7f, 0x1f, 0x9f, 0xf1, 0xb6, 0x89,
+  0x53, 0x9e, 0x6b, 0xe1, 0x0f, 0x00, 0xbd, 0xac, 0x50, 0x06, 0x3a, 0x72,
+  0xc6, 0x28, 0x2c, 0xbd, 0x02, 0x85, 0xeb, 0x80, 0xa7, 0x26, 0x48, 0x70,
+  0xba, 0x9a, 0xec, 0x40, 0x3f, 0x9d, 0x2b, 0x62, 0xaf, 0xa9, 0xf7, 0xf7,
+  0x3c, 0x1c, 0x61, 0x0c, 0x49, 0x5e, 0xf1, 0x42, 0x45, 0xe1, 0x46, 0xd5,
+  0xe3, 0xae, 0x3a, 0x70, 0x7a, 0xc9, 0xd8, 0x4e, 0xac, 0x6e, 0x64, 0x3f,
+  0xa3, 0x54, 0xd7, 0x1c, 0x9f, 0x7e, 0x4f, 0xe3, 0x6c, 0xac, 0xa1, 0x6a,
+  0x8d, 0xdc, 0xd5, 0x49, 0x8f, 0xa9, 0x5f, 0x50, 0x8e, 0xfc, 0xc4, 0xdb,
+  0xa9, 0x35, 0x43, 0xab, 0x17, 0x07, 0x72, 0x5a, 0xf6, 0x0b, 0x25, 0xca,
+  0xde, 0xfe, 0xee, 0x6e, 0xe4, 0x44, 0x5a, 0x8f, 0xf6, 0x4f, 0x0e, 0x78,
+  0xff, 0x6e, 0x86, 0xf2, 0xaf, 0x95, 0xcb, 0x3f, 0xfd, 0x8f, 0xfa, 0xda,
+  0x25, 0x45, 0xa4, 0xb4, 0xa1, 0xa9, 0xc0, 0x50, 0xd9, 0x36, 0x08, 0xe3,
+  0x6c, 0x5b, 0x59, 0x2a, 0xf6, 0x32, 0x39, 0x88, 0x4b, 0x46, 0x2b, 0x57,
+  0x60, 0xc5, 0xf0, 0x76, 0x01, 0xf0, 0xc2, 0xa8, 0x6a, 0xe9, 0xb3, 0xbf,
+  0x24, 0xfe, 0xb5, 0x78, 0xae, 0x84, 0x09, 0xf6, 0x05, 0x31, 0xb4, 0x17,
+  0x56, 0x68, 0x11, 0xd4, 0x15, 0x8d, 0x9b, 0x81, 0xc4, 0x27, 0x82, 0xdd,
+  0xd5, 0x28, 0x7c, 0xb7, 0xfb, 0x37, 0x34, 0x0e, 0xb3, 0x8b, 0x0f, 0x63,
+  0x1e, 0xe7, 0x05, 0x7f, 0xa6, 0xc7, 0xb6, 0x0b, 0xe0, 0xf0, 0xd1, 0x03,
+  0x23, 0xdd, 0x25, 0x5c, 0x2f, 0xcd, 0x14, 0x9d, 0x2a, 0xad, 0x61, 0x45,
+  0xa0, 0x6e, 0xd0, 0xf1, 0x32, 0xd7, 0x33, 0x93, 0xb5, 0x4d, 0x21, 0xdf,
+  0xb6, 0x67, 0x69, 0x25, 0xde, 0x01, 0x14, 0x90, 0x5d, 0x14, 0xf7, 0x4d,
+  0x68, 0xf2, 0xac, 0x98, 0x14, 0x1e, 0x9f, 0x4c, 0x3e, 0x10, 0x8b, 0x6b,
+  0xfd, 0x57, 0xeb, 0x20, 0x1f, 0x93, 0x68, 0x06, 0x41, 0x38, 0x40, 0x91,
+  0x4e, 0xe4, 0xf3, 0x8d, 0xc1, 0xca, 0x7f, 0xe9, 0x29, 0x63, 0x2f, 0xcc,
+  0xf7, 0x0c, 0xb0, 0x27, 0xdc, 0x9c, 0xb6, 0x70, 0xff, 0x42, 0x19, 0x54,
+  0x24, 0xe9, 0x4e, 0x3d, 0x8c, 0xe4, 0x24, 0x50, 0x1f, 0x86, 0x61, 0xcd,
+  0x6f, 0x31, 0xdb, 0xf8, 0x5e, 0xc1, 0xde, 0xe1, 0x59, 0x63, 0x7d, 0x80,
+  0x83, 0xa4, 0xa1, 0x43, 0x2c, 0xaf, 0xd6, 0x32, 0xbf, 0xb7, 0x1f, 0x9c,
+  0x4e, 0x17, 0x12, 0x82, 0x85, 0xcf, 0xcd, 0xf5, 0xc7, 0xb2, 0x32, 0x2e,
+  0xb4, 0x7f, 0x92, 0x36, 0xbb, 0x43, 0x34, 0x3b, 0xbe, 0x0d, 0x6d, 0x6d,
+  0xcd, 0x17, 0xde, 0xaf, 0x58, 0x2f, 0xbd, 0x24, 0x60, 0xe3, 0x4d, 0x69,
+  0x32, 0xaa, 0x24, 0x14, 0xd1, 0x34, 0xaa, 0x62, 0x6b, 0xf1, 0x04, 0x44,
+  0x50, 0x10, 0x6d, 0x89, 0x3f, 0xef, 0xae, 0x85, 0x60, 0xc6, 0xda, 0x7f,
+  0xa3, 0x28, 0x02, 0x16, 0x6f, 0x26, 0x11, 0x63, 0xff, 0xcc, 0x55, 0x47,
+  0x50, 0xd8, 0x0c, 0xde, 0x21, 0xbd, 0x7a, 0x50, 0x22, 0xfe, 0x33, 0x6e,
+  0x59, 0x4c, 0xe0, 0xd0, 0xe6, 0xcc, 0x7b, 0x4e, 0xa1, 0xea, 0x76, 0xe9,
+  0xf8, 0x7a, 0x66, 0xb9, 0x8c, 0x44, 0x02, 0x4e, 0x1d, 0x0c, 0xfb, 0xc7,
+  0x1e, 0x49, 0x3e, 0xec, 0xc0, 0xb1, 0x74, 0x97, 0xbe, 0x9e, 0x47, 0xda,
+  0xcf, 0xc1, 0xab, 0x39, 0x78, 0xe2, 0x39, 0x16, 0x2f, 0xe6, 0x8f, 0xcc,
+  0xe2, 0xa5, 0xb8, 0x34, 0x36, 0xcf, 0xcc, 0xd9, 0xe7, 0x2c, 0xe2, 0xbc,
+  0xee, 0x49, 0x56, 0x29, 0x74, 0x96, 0x8a, 0x02, 0x7a, 0xdc, 0x23, 0xf0,
+  0x1e, 0x72, 0xc7, 0x8a, 0xcb, 0x59, 0x8b, 0x88, 0x89, 0x44, 0x0c, 0xeb,
+  0x6d, 0x26, 0xe1, 0xe6, 0xdb, 0x23, 0x93, 0xf5, 0x7e, 0x68, 0x0b, 0x5b,
+  0xcc, 0xe0, 0x5e, 0xe9, 0x72, 0xb3, 0xe0, 0x98, 0x90, 0x2d, 0xe5, 0x5f,
+  0x2a, 0xdf, 0xf4, 0xe7, 0x8f, 0xb0, 0xdb, 0x89, 0xbb, 0x2d, 0x83, 0x2b,
+  0xf4, 0x64, 0x00, 0x7d, 0xf0, 0xa8, 0x4d, 0x9c, 0x7b, 0xf0, 0x4b, 0x71,
+  0xa1, 0x83, 0xb7, 0xe4, 0x32, 0xde, 0x2e, 0x30, 0x07, 0x78, 0x97, 0x29,
+  0x8e, 0x8c, 0x9d, 0x6c, 0xc3, 0x80, 0x47, 0xf8, 0x7d, 0x7c, 0x47, 0xac,
+  0x7d, 0x1e, 0xe9, 0xfd, 0x2d, 0xe8, 0x45, 0xee, 0xdd, 0xa1, 0x8c, 0x4d,
+  0xa4, 0xe4, 0x72, 0xe2, 0xd8, 0x06, 0x26, 0xc7, 0x4c, 0x2b, 0x3c, 0xda,
+  0xf5, 0x6c, 0x9b, 0x8c, 0xe5, 0x35, 0x45, 0x0f, 0x4e, 0x99, 0x12, 0x11,
+  0x4f, 0xde, 0xf7, 0xb5, 0xb4, 0xd3, 0x08, 0xed, 0xcc, 0x07, 0x3b, 0x29,
+  0x4f, 0x22, 0xc8, 0x3f, 0x70, 0x1f, 0x3b, 0xa0, 0xe9, 0xde, 0x1e, 0x6d,
+  0x0e, 0x37, 0x41, 0xeb, 0x30, 0xab, 0xe3, 0xde, 0xea, 0x10, 0xdf, 0x77,
+  0xdb, 0xa5, 0x06, 0x22, 0x17, 0x08, 0xd6, 0x79, 0x7e, 0xa7, 0x16, 0x9d,
+  0x42, 0x18, 0xc9, 0x1a, 0x5f, 0x94, 0x44, 0xea, 0x47, 0xad, 0x01, 0x7a,
+  0x55, 0xe8, 0x52, 0xe9, 0xc9, 0x35, 0xb4, 0x1a, 0xa4, 0xeb, 0x02, 0x07,
+  0x0c, 0xda, 0x1e, 0xad, 0xb1, 0xfc, 0x21, 0xe2, 0x43, 0x5e, 0xa4, 0x17,
+  0xbf, 0x6a, 0x7c, 0x4a, 0xf5, 0xd2, 0xb5, 0xcf, 0x41, 0x2d, 0x90, 0xf5,
+  0x12, 0x2d, 0xd9, 0x95, 0x8e, 0x8c, 0x7d, 0x39, 0x98, 0x61, 0x43, 0xff,
+  0x4f, 0xe0, 0xa8, 0x00, 0x80, 0x63, 0x19, 0xa4, 0xa1, 0x3d, 0x30, 0x0a,
+  0xa3, 0x9c, 0x65, 0x3a, 0xe6, 0xda, 0x0d, 0x99, 0x5c, 0xb3, 0x61, 0x83,
+  0xfe, 0x8e, 0xff, 0x38, 0x9c, 0xf5, 0x1c, 0x62, 0xe4, 0xc1, 0x43, 0xbc,
+  0x62, 0xb3, 0xba, 0x8e, 0x88, 0xb0, 0x22, 0xfc, 0x41, 0x6c, 0x2f, 0x6f,
+  0x43, 0xb3, 0x27, 0xe4, 0x58, 0xe9, 0x75, 0xa4, 0x87, 0x27, 0x8e, 0x49,
+  0x6a, 0xfd, 0x92, 0xc3, 0xe2, 0x37, 0x01, 0x96, 0x46, 0xe4, 0x31, 0x9d,
+  0x6e, 0xc7, 0xdf, 0x4e, 0x0b, 0xbb, 0xc7, 0xe6, 0x04, 0x08, 0x4c, 0x20,
+  0x08, 0xcc, 0x1e, 0x0a, 0xf9, 0xb2, 0xd4, 0xf9, 0x56, 0x35, 0xe2, 0x94,
+  0x70, 0x9e, 0x43, 0x85, 0xad, 0x5b, 0x72, 0x5a, 0x32, 0xa8, 0xc7, 0x96,
+  0xd3, 0xbe, 0xec, 0x6d, 0x6d, 0x23, 0x7b, 0xb7, 0x0f, 0x63, 0x21, 0x01,
+  0xbf, 0x28, 0x86, 0x12, 0x75, 0x7e, 0x83, 0xce, 0x5b, 0xe5, 0xca, 0xc0,
+  0x48, 0x7e, 0xcc, 0xac, 0x64, 0xf1, 0xc7, 0xdf, 0xad, 0xc2, 0x53, 0x00,
+  0xa0, 0x52, 0xf8, 0x3e, 0xe0, 0xfd, 0x8c, 0xc0, 0xd9, 0x41, 0xdc, 0xaa,
+  0xf0, 0x17, 0x95, 0x29, 0xeb, 0xd8, 0x22, 0xac, 0x72, 0x8c, 0xc4, 0x3d,
+  0x4f, 0xa3, 0x23, 0x6f, 0xa4, 0x03, 0x1a, 0x18, 0x96, 0x34, 0xc1, 0xf8,
+  0xdb, 0xb3, 0x41, 0x45, 0xa3, 0xa8, 0x0f, 0x66, 0xc3, 0xdf, 0x0c, 0x28,
+  0xa6, 0xcf, 0x7e, 0x53, 0x31, 0x53, 0x53, 0x86, 0x5d, 0xc8, 0x3b, 0xba,
+  0x71, 0x03, 0xcc, 0x31, 0x18, 0x3a, 0xbe, 0x2c, 0xe7, 0x9b, 0x5d, 0xec,
+  0x55, 0x66, 0x54, 0x08, 0x80, 0x9c, 0xdd, 0x36, 0xb3, 0x66, 0xfe, 0xd5,
+  0xe9, 0xb5, 0xe9, 0xf3, 0xc7, 0xca, 0x56, 0x71, 0x50, 0x79, 0x14, 0x4b,
+  0xea, 0x69, 0x29, 0x62, 0x91, 0x8a, 0x48, 0x6a, 0x19, 0x71, 0x29, 0xd4,
+  0x2a, 0x2d, 0x2c, 0xe7, 0x59, 0xe1, 0xee, 0x5e, 0xc9, 0x87, 0xbf, 0x54,
+  0x98, 0xe5, 0xec, 0x25, 0xbe, 0x1e, 0x50, 0xcd, 0x49, 0xcd, 0xe8, 0xa0,
+  0x07, 0x74, 0xe6, 0x98, 0x46, 0x01, 0xd2, 0xff, 0xaa, 0x06, 0xf8, 0x67,
+  0xdc, 0x68, 0x08, 0xd7, 0x4a, 0x1f, 0xff, 0xf4, 0xba, 0xc0, 0xc8, 0xe4,
+  0x77, 0xdd, 0x7a, 0x64, 0xa8, 0x74, 0x6d, 0x80, 0x7b, 0x8a, 0xb8, 0x88,
+  0xc2, 0x69, 0xec, 0xa7, 0x74, 0x87, 0xa8, 0x38, 0x3a, 0xc1, 0xe1, 0x90,
+  0xb3, 0x89, 0x84, 0x8a, 0xae, 0x50, 0xa9, 0x85, 0x00, 0xd3, 0x8a, 0x1e,
+  0x39, 0xa5, 0xae, 0xf1, 0x45, 0x5f, 0x72, 0x7f, 0x1b, 0x8b, 0xf6, 0x1f,
+  0xc3, 0x3a, 0xea, 0xea, 0xed, 0xec, 0xcc, 0xa8, 0x66, 0x96, 0x11, 0xdc,
+  0xee, 0xff, 0xc5, 0x1e, 0xcc, 0x84, 0x82, 0x9d, 0x0c, 0x38, 0xf0, 0x34,
+  0x01, 0xbd, 0xcb, 0x7a, 0x2c, 0x9d, 0x48, 0x43, 0xe1, 0xc8, 0x51, 0x7c,
+  0x6c, 0xf3, 0x7a, 0xc3, 0x84, 0x49, 0x60, 0x44, 0xcf, 0x47, 0x41, 0x16,
+  0x60, 0x60, 0x38, 0x7f, 0x28, 0xd1, 0x1f, 0xe7, 0x9d, 0xeb, 0x80, 0x8c,
+  0x98, 0x44, 0x90, 0x85, 0xf9, 0x35, 0xa7, 0x43, 0x82, 0x61, 0x5e, 0xfd,
+  0x23, 0xd5, 0xb7, 0x4a, 0xd0, 0x7d, 0x86, 0xd5, 0x45, 0x7c, 0x5e, 0x31,
+  0x35, 0x23, 0xbf, 0x00, 0x1c, 0x44, 0x9c, 0x0f, 0x16, 0x97, 0x5e, 0xeb,
+  0x01, 0xb1, 0xb1, 0x2f, 0xb1, 0x50, 0x5b, 0xa4, 0xda, 0x46, 0xf4, 0xf8,
+  0x50, 0x55, 0x5b, 0xe0, 0x41, 0x1a, 0xb6, 0x5b, 0x6f, 0x33, 0xd1, 0xc0,
+  0xfe, 0x9e, 0xf4, 0x9e, 0xe7, 0x80, 0x8d, 0x88, 0xfa, 0x1f, 0x75, 0xcf,
+  0x22, 0x8a, 0xab, 0xa3, 0xc9, 0x0b, 0xe2, 0x36, 0xaf, 0x88, 0xcb, 0xe4,
+  0x83, 0x6c, 0x92, 0x15, 0xed, 0x7f, 0xe8, 0x58, 0xaf, 0x73, 0x21, 0x3a,
+  0xca, 0xcb, 0xbf, 0x1a, 0x58, 0xb0, 0x74, 0x04, 0xa3, 0x08, 0xee, 0x6b,
+  0xce, 0xe2, 0xb8, 0x10, 0xfd, 0x47, 0x52, 0xa3, 0x07, 0x84, 0xa5, 0x9b,
+  0x7c, 0x9f, 0x2a, 0xcb, 0xec, 0xe1, 0x2d, 0xb7, 0x52, 0x2e, 0x1a, 0xf6,
+  0x19, 0x33, 0x9b, 0x81, 0xee, 0x2e, 0x45, 0x73, 0xb3, 0x67, 0x3a, 0xfc,
+  0xed, 0xc1, 0x05, 0x0d, 0xb1, 0xd1, 0xc8, 0x9e, 0x57, 0x02, 0x81, 0xa2,
+  0x0d, 0x23, 0x16, 0x0c, 0xd5, 0x94, 0xda, 0xf8, 0x91, 0xfe, 0xe7, 0x22,
+  0x43, 0x43, 0xf2, 0x87, 0xc8, 0x9a, 0xab, 0xdb, 0x37, 0x5a, 0x4a, 0x6c,
+  0x07, 0xcf, 0xc8, 0x7a, 0x13, 0x69, 0xd3, 0x64, 0x03, 0xcc, 0x6c, 0x14,
+  0x78, 0xf0, 0x26, 0x1c, 0x21, 0xaa, 0xdb, 0x0c, 0x0a, 0x69, 0xdc, 0x20,
+  0x7a, 0xc5, 0x70, 0x79, 0x3b, 0x37, 0x2e, 0x01, 0x2d, 0x60, 0x02, 0xed,
+  0xdf, 0x2e, 0xf4, 0x6b, 0xd2, 0x88, 0xfb, 0x22, 0xac, 0x11, 0x50, 0x26,
+  0x78, 0x7b, 0x2e, 0x93, 0xb3, 0xf8, 0x0d, 0x9d, 0xea, 0x21, 0x8f, 0x26,
+  0xf4, 0xd8, 0x6f, 0x48, 0x2a, 0x05, 0xf0, 0x99, 0x76, 0x49, 0xcf, 0x47,
+  0x00, 0xac, 0x57, 0x6e, 0xd6, 0x38, 0x13, 0x1d, 0xf0, 0xa7, 0x2b, 0xff,
+  0x7d, 0x26, 0x27, 0xbd, 0xd6, 0x8f, 0x09, 0x27, 0xeb, 0xb0, 0xd7, 0x64,
+  0x87, 0x8d, 0xd3, 0x20, 0xa4, 0xd0, 0x96, 0x04, 0x5e, 0x1c, 0x0a, 0x7c,
+  0xb6, 0x84, 0xd7, 0xcd, 0x6e, 0xfc, 0x70, 0x42, 0x90, 0x57, 0x8a, 0xae,
+  0xe9, 0x8b, 0xd5, 0x7b, 0x0d, 0xa3, 0xb6, 0x90, 0xae, 0x56, 0xae, 0xbe,
+  0x40, 0x6b, 0xe3, 0x2e, 0xc1, 0xbc, 0x5e, 0x1a, 0x67, 0x91, 0x7a, 0x53,
+  0x0b, 0x9d, 0x19, 0x97, 0x7f, 0xcc, 0x76, 0x11, 0xcf, 0x36, 0xa8, 0xa7,
+  0xa0, 0xc7, 0x91, 0x57, 0xcb, 0x0b, 0xe0, 0x56, 0xa9, 0xc9, 0xf8, 0xc8,
+  0x96, 0xaf, 0x3a, 0xa8, 0xa5, 0x25, 0x3f, 0xb8, 0x51, 0x39, 0xc6, 0xbb,
+  0x0b, 0xf3, 0x2a, 0x64, 0x15, 0x3f, 0x7c, 0x79, 0xc0, 0x7e, 0xa1, 0x01,
+  0x40, 0x98, 0x89, 0xbd, 0x36, 0xf9, 0x60, 0x34, 0x26, 0xac, 0x4d, 0x7f,
+  0xe1, 0xf6, 0x72, 0xef, 0x81, 0xbb, 0x4d, 0x0c, 0xc6, 0x65, 0x8b, 0x32,
+  0xe1, 0xe1, 0xdf, 0x50, 0x5c, 0x80, 0xbc, 0x12, 0x54, 0x53, 0x5d, 0xf0,
+  0x10, 0x9c, 0xc9, 0x50, 0x36, 0xa2, 0x8f, 0xee, 0x0e, 0xe6, 0xae, 0xe9,
+  0xd1, 0x51, 0x6e, 0xec, 0x41, 0xe6, 0x46, 0xfb, 0xce, 0xe5, 0x3c, 0xea,
+  0x26, 0xa4, 0xc7, 0x7d, 0x80, 0x1b, 0x57, 0xe4, 0x54, 0xfc, 0x0d, 0xbc,
+  0xc2, 0xab, 0xee, 0xad, 0x8e, 0xdd, 0xe3, 0x14, 0x5f, 0xbc, 0x42, 0x53,
+  0x41, 0xd4, 0xc2, 0x2a, 0xe8, 0x07, 0xb9, 0x23, 0x63, 0x3d, 0xf0, 0xb5,
+  0xaf, 0x94, 0x74, 0xa4, 0x34, 0xa7, 0x00, 0x9c, 0x1c, 0x12, 0x56, 0x88,
+  0xe6, 0xa3, 0x23, 0xbb, 0xf2, 0x0a, 0x93, 0x19, 0x25, 0xfb, 0xe7, 0x30,
+  0x2d, 0x84, 0x97, 0x1e, 0x6d, 0xb3, 0xe0, 0x2a, 0x94, 0x94, 0x04, 0xd0,
+  0x4b, 0xcb, 0x68, 0x66, 0x7a, 0x41, 0xa8, 0x6f, 0xbd, 0xff, 0x36, 0xf2,
+  0x04, 0x6b, 0xec, 0x28, 0x29, 0x57, 0x00, 0x17, 0x35, 0xc1, 0x93, 0xc1,
+  0xd3, 0x16, 0xd7, 0xd9, 0x1a, 0xa3, 0xa1, 0x1c, 0x6e, 0x33, 0xd0, 0x7f,
+  0x6c, 0xe7, 0xae, 0xf9, 0x47, 0x4d, 0xbf, 0x41, 0xdf, 0x84, 0x07, 0xb8,
+  0x25, 0xad, 0xce, 0x2a, 0x83, 0x61, 0xeb, 0x18, 0x54, 0x2b, 0xa5, 0x4c,
+  0xd1, 0x5d, 0x3e, 0x6e, 0x32, 0x56, 0x42, 0x58, 0xe3, 0xfe, 0xa6, 0x28,
+  0xf1, 0x08, 0x2e, 0xb4, 0x40, 0x12, 0x47, 0xb3, 0xef, 0x9a, 0xaa, 0x7b,
+  0xe6, 0x0e, 0x0b, 0xfd, 0x6b, 0xa6, 0x34, 0xef, 0x22, 0x5d, 0xec, 0xb5,
+  0x33, 0xbb, 0x5b, 0xeb, 0x61, 0xf6, 0x63, 0x0c, 0x5e, 0xdb, 0x1f, 0x03,
+  0xd1, 0x6d, 0xdb, 0x98, 0x40, 0x8f, 0x9d, 0x4e, 0xe0, 0x1b, 0x78, 0x05,
+  0xc5, 0x79, 0xc2, 0x79, 0xaa, 0x87, 0xb0, 0x00, 0x00, 0x00, 0x0a, 0x00,
+  0x16, 0x00, 0x20, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x78, 0x00,
+  0xb4, 0x00, 0xbe, 0x00, 0xc8, 0x00, 0xd1, 0x00, 0x00, 0x00, 0x3c, 0x00,
+  0x78, 0x00, 0xb4, 0x00, 0xf0, 0x00, 0x2c, 0x01, 0x68, 0x01, 0x72, 0x01,
+  0x7b, 0x01, 0x84, 0x01, 0x8f, 0x01, 0x99, 0x01, 0xa3, 0x01, 0xac, 0x01,
+  0xb6, 0x01, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x09, 0x00, 0x13, 0x00,
+  0x1d, 0x00, 0x28, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x15, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x17, 0x00, 0x22, 0x00, 0x00, 0x00, 0x09, 0x00, 0x12, 0x00,
+  0x1c, 0x00, 0x25, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x15, 0x00, 0x1e, 0x00,
+  0x00, 0x00, 0x0b, 0x00, 0x16, 0x00, 0x1f, 0x00, 0x29, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x14, 0x00, 0x1e, 0x00, 0x29, 0x00, 0x34, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x16, 0x00, 0x20, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x14, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x17, 0x00, 0x21, 0x00, 0x2a, 0x00, 0x33, 0x00,
+  0x3d, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x14, 0x00, 0x1e, 0x00, 0x27, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x13, 0x00, 0x1c, 0x00, 0x25, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x13, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x15, 0x00,
+  0x1f, 0x00, 0x28, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x14, 0x00, 0x1e, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x14, 0x00, 0x1f, 0x00, 0x28, 0x00, 0x32, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x14, 0x00, 0x1e, 0x00, 0x28, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x12, 0x00, 0x1d, 0x00, 0x28, 0x00, 0x00, 0x00, 0x0a, 0x00,
+  0x15, 0x00, 0x20, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x13, 0x00,
+  0x1d, 0x00, 0x29, 0x00, 0x32, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x13, 0x00,
+  0x1e, 0x00, 0x28, 0x00, 0x33, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x15, 0x00,
+  0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x09, 0x00, 0x13, 0x00, 0x1d, 0x00,
+  0x00, 0x00, 0x2f, 0x00, 0x3a, 0x00, 0x45, 0x00, 0x50, 0x00, 0x59, 0x00,
+  0x64, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x3a, 0x00, 0x44, 0x00, 0x4e, 0x00,
+  0x00, 0x00, 0x0b, 0x00, 0x14, 0x00, 0x1d, 0x00, 0x27, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x13, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x16, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x17, 0x00, 0x21, 0x00, 0x00, 0x00, 0x0b, 0x00,
+  0x16, 0x00, 0x20, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x13, 0x00, 0x1e, 0x00,
+  0x27, 0x00, 0x30, 0x00, 0x3a, 0x00, 0x44, 0x00, 0x4d, 0x00, 0x57, 0x00,
+  0x62, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x15, 0x00, 0x1f, 0x00, 0x2a, 0x00,
+  0x00, 0x00, 0x28, 0x00, 0x31, 0x00, 0x3a, 0x00, 0x44, 0x00, 0x4e, 0x00,
+  0x00, 0x00, 0x0a, 0x00, 0x14, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x16, 0x00,
+  0x21, 0x00, 0x2b, 0x00, 0x35, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x0a, 0x00,
+  0x15, 0x00, 0x1f, 0x00, 0x27, 0x00, 0x31, 0x00, 0x00, 0x00, 0x0a, 0x00,
+  0x13, 0x00, 0x1d, 0x00, 0x27, 0x00, 0x00, 0x00, 0x09, 0x00, 0x15, 0x00,
+  0x20, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x09, 0x00, 0x15, 0x00, 0x20, 0x00,
+  0x2a, 0x00, 0x33, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x3a, 0x00, 0x44, 0x00,
+  0x4e, 0x00, 0x57, 0x00, 0x62, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x17, 0x00,
+  0x00, 0x00, 0x0a, 0x00, 0x13, 0x00, 0x1e, 0x00, 0x28, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x14, 0x00, 0x1f, 0x00, 0x28, 0x00, 0x00, 0x00, 0x0b, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x09, 0x00, 0x13, 0x00, 0x00, 0x00, 0x17, 0x00,
+  0x1f, 0x00, 0x2a, 0x00, 0x34, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x16, 0x00,
+  0x21, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x15, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x15, 0x00, 0x1e, 0x00, 0x28, 0x00, 0x31, 0x00, 0x3b, 0x00,
+  0x45, 0x00, 0x50, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x14, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x12, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x15, 0x00, 0x1f, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x15, 0x00, 0x20, 0x00, 0x00, 0x00, 0x17, 0x00, 0x21, 0x00, 0x2a, 0x00,
+  0x35, 0x00, 0x40, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x15, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x12, 0x00, 0x1d, 0x00, 0x27, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x13, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x09, 0x00, 0x13, 0x00,
+  0x1d, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x13, 0x00, 0x1d, 0x00, 0x28, 0x00,
+  0x32, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x14, 0x00, 0x1f, 0x00, 0x2a, 0x00,
+  0x00, 0x00, 0x0a, 0x00, 0x14, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x0b, 0x00,
+  0x14, 0x00, 0x1d, 0x00, 0x27, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x15, 0x00, 0x1e, 0x00, 0x29, 0x00, 0x00, 0x00, 0x1a, 0x00,
+  0x24, 0x00, 0x2c, 0x00, 0x35, 0x00, 0x3e, 0x00, 0x47, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x13, 0x00, 0x00, 0x00, 0x19, 0x00, 0x2f, 0x00,
+  0x4b, 0x00, 0x6a, 0x00, 0x83, 0x00, 0x96, 0x00, 0xad, 0x00, 0xc6, 0x00,
+  0xd0, 0x00, 0xd9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x2f, 0x00,
+  0x4b, 0x00, 0x6a, 0x00, 0x83, 0x00, 0x96, 0x00, 0xad, 0x00, 0xb6, 0x00,
+  0xc0, 0x00, 0xca, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x13, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x13, 0x00, 0x1c, 0x00,
+  0x26, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x15, 0x00, 0x00, 0x00, 0x0a, 0x00,
+  0x00, 0x00, 0x17, 0x00, 0x22, 0x00, 0x2b, 0x00, 0x35, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0a, 0x00, 0x15, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x18, 0x00,
+  0x23, 0x00, 0x2d, 0x00, 0x36, 0x00, 0x00, 0x00, 0x16, 0x00, 0x32, 0x00,
+  0x4b, 0x00, 0x6a, 0x00, 0x83, 0x00, 0x99, 0x00, 0xb2, 0x00, 0xbb, 0x00,
+  0xc6, 0x00, 0x00, 0x00, 0x18, 0x00, 0x22, 0x00, 0x00, 0x00, 0x16, 0x00,
+  0x32, 0x00, 0x4b, 0x00, 0x6a, 0x00, 0x83, 0x00, 0x99, 0x00, 0xb2, 0x00,
+  0xbd, 0x00, 0xc6, 0x00, 0x00, 0x00, 0x19, 0x00, 0x22, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00,
+  0x00, 0x00, 0x0a, 0x00, 0x14, 0x00, 0x1d, 0x00, 0x27, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x14, 0x00, 0x00, 0x00, 0x09, 0x00, 0x13, 0x00, 0x1e, 0x00,
+  0x00, 0x00, 0x0a, 0x00, 0x14, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x0a, 0x00,
+  0x15, 0x00, 0x00, 0x00, 0x19, 0x00, 0x23, 0x00, 0x2e, 0x00, 0x38, 0x00,
+  0x42, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x19, 0x00, 0x23, 0x00, 0x2f, 0x00,
+  0x39, 0x00, 0x00, 0x00, 0x19, 0x00, 0x2f, 0x00, 0x45, 0x00, 0x5e, 0x00,
+  0x74, 0x00, 0x90, 0x00, 0xa6, 0x00, 0xc2, 0x00, 0xcc, 0x00, 0xd5, 0x00,
+  0xdf, 0x00, 0xe8, 0x00, 0xf1, 0x00, 0x00, 0x00, 0x17, 0x00, 0x33, 0x00,
+  0x3d, 0x00, 0x49, 0x00, 0x52, 0x00, 0x00, 0x00, 0x19, 0x00, 0x2f, 0x00,
+  0x45, 0x00, 0x5e, 0x00, 0x74, 0x00, 0x90, 0x00, 0xa6, 0x00, 0xc5, 0x00,
+  0xcf, 0x00, 0xd9, 0x00, 0xe4, 0x00, 0x00, 0x00, 0x22, 0x00, 0x3b, 0x00,
+  0x54, 0x00, 0x5d, 0x00, 0x68, 0x00, 0x73, 0x00, 0x7e, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x26, 0x00, 0x00, 0x00, 0x22, 0x00, 0x3e, 0x00, 0x5d, 0x00,
+  0x68, 0x00, 0x73, 0x00, 0x7d, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x47, 0x00,
+  0x51, 0x00, 0x5a, 0x00, 0x63, 0x00, 0x00, 0x00, 0x25, 0x00, 0x30, 0x00,
+  0x3a, 0x00, 0x44, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x38, 0x00, 0x41, 0x00,
+  0x4c, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x2a, 0x00, 0x34, 0x00, 0x3e, 0x00,
+  0x48, 0x00, 0x51, 0x00, 0x00, 0x00, 0x19, 0x00, 0x2f, 0x00, 0x39, 0x00,
+  0x44, 0x00, 0x4e, 0x00, 0x58, 0x00, 0x64, 0x00, 0x6f, 0x00, 0x79, 0x00,
+  0x00, 0x00, 0x16, 0x00, 0x32, 0x00, 0x3b, 0x00, 0x44, 0x00, 0x4d, 0x00,
+  0x57, 0x00, 0x00, 0x00, 0x16, 0x00, 0x1f, 0x00, 0x2a, 0x00, 0x00, 0x00,
+  0x16, 0x00, 0x20, 0x00, 0x2a, 0x00, 0x34, 0x00, 0x3e, 0x00, 0x48, 0x00,
+  0x52, 0x00, 0x00, 0x00, 0x16, 0x00, 0x35, 0x00, 0x00, 0x00, 0x16, 0x00,
+  0x00, 0x00, 0x1c, 0x00, 0x38, 0x00, 0x4e, 0x00, 0x6d, 0x00, 0x78, 0x00,
+  0x81, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x28, 0x00, 0x33, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x38, 0x00, 0x4e, 0x00, 0x79, 0x00, 0x92, 0x00, 0xae, 0x00,
+  0xba, 0x00, 0xc6, 0x00, 0xd0, 0x00, 0xda, 0x00, 0x00, 0x00, 0x16, 0x00,
+  0x32, 0x00, 0x3c, 0x00, 0x46, 0x00, 0x50, 0x00, 0x5c, 0x00, 0x00, 0x00,
+  0x16, 0x00, 0x2c, 0x00, 0x51, 0x00, 0x5a, 0x00, 0x65, 0x00, 0x6f, 0x00,
+  0x78, 0x00, 0x83, 0x00, 0x8d, 0x00, 0x00, 0x00, 0x22, 0x00, 0x41, 0x00,
+  0x4c, 0x00, 0x55, 0x00, 0x60, 0x00, 0x6a, 0x00, 0x74, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x15, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x15, 0x00,
+  0x1f, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x16, 0x00, 0x45, 0x00, 0x5e, 0x00,
+  0x77, 0x00, 0x8d, 0x00, 0x97, 0x00, 0xa0, 0x00, 0xaa, 0x00, 0x00, 0x00,
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x15, 0x00, 0x00, 0x00,
+  0x16, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x19, 0x00, 0x32, 0x00,
+  0x4e, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x38, 0x00, 0x00, 0x00, 0x19, 0x00,
+  0x32, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x28, 0x00, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x19, 0x00, 0x35, 0x00, 0x51, 0x00, 0x00, 0x00, 0x16, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x32, 0x00, 0x4e, 0x00, 0x00, 0x00,
+  0x19, 0x00, 0x32, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00,
+  0x1f, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x19, 0x00, 0x35, 0x00, 0x00, 0x00,
+  0x19, 0x00, 0x35, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x1f, 0x00,
+  0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x16, 0x00, 0x2f, 0x00, 0x48, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x35, 0x00, 0x51, 0x00, 0x00, 0x00,
+  0x1f, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x0a, 0x00,
+  0x00, 0x00, 0x16, 0x00, 0x21, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x16, 0x00,
+  0x32, 0x00, 0x4b, 0x00, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x12, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00,
+  0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x32, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00,
+  0x22, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x16, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x1a, 0x00,
+  0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x1d, 0x00, 0x28, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x2a, 0x00,
+  0x00, 0x00, 0x0f, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x1d, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x1e, 0x00, 0x29, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x15, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x21, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x1b, 0x00, 0x27, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1e, 0x00, 0x28, 0x00,
+  0x33, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x1b, 0x00, 0x24, 0x00, 0x2e, 0x00,
+  0x00, 0x00, 0x0f, 0x00, 0x1e, 0x00, 0x27, 0x00, 0x30, 0x00, 0x3a, 0x00,
+  0x00, 0x00, 0x18, 0x00, 0x27, 0x00, 0x33, 0x00, 0x3c, 0x00, 0x47, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x18, 0x00, 0x2a, 0x00, 0x34, 0x00, 0x3d, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x21, 0x00, 0x2a, 0x00, 0x35, 0x00, 0x41, 0x00,
+  0x00, 0x00, 0x0f, 0x00, 0x18, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x1e, 0x00,
+  0x29, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1b, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x16, 0x00, 0x21, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x12, 0x00, 0x1e, 0x00,
+  0x27, 0x00, 0x00, 0x00, 0x12, 0x00, 0x24, 0x00, 0x30, 0x00, 0x3b, 0x00,
+  0x46, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x17, 0x00,
+  0x21, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x1b, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x18, 0x00, 0x23, 0x00, 0x2e, 0x00,
+  0x38, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x17, 0x00, 0x20, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x18, 0x00, 0x21, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x1c, 0x00, 0x28, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x18, 0x00, 0x24, 0x00, 0x30, 0x00, 0x39, 0x00, 0x43, 0x00, 0x4e, 0x00,
+  0x57, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x1b, 0x00, 0x25, 0x00, 0x2e, 0x00,
+  0x39, 0x00, 0x45, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x12, 0x00,
+  0x1d, 0x00, 0x27, 0x00, 0x30, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x16, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x18, 0x00, 0x2d, 0x00, 0x39, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x1b, 0x00, 0x24, 0x00, 0x00, 0x00, 0x0f, 0x00,
+  0x1e, 0x00, 0x2a, 0x00, 0x33, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x15, 0x00, 0x24, 0x00, 0x2e, 0x00, 0x39, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x15, 0x00, 0x1e, 0x00, 0x27, 0x00, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0f, 0x00, 0x1b, 0x00, 0x26, 0x00, 0x33, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x17, 0x00, 0x22, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x18, 0x00,
+  0x22, 0x00, 0x2c, 0x00, 0x35, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x0f, 0x00,
+  0x1a, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x17, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x18, 0x00, 0x27, 0x00, 0x31, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x1e, 0x00, 0x28, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x0b, 0x00,
+  0x00, 0x00, 0x0f, 0x00, 0x19, 0x00, 0x23, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x1b, 0x00, 0x26, 0x00, 0x30, 0x00, 0x3b, 0x00, 0x44, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x1b, 0x00, 0x25, 0x00,
+  0x30, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x13, 0x00, 0x1d, 0x00, 0x26, 0x00,
+  0x30, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x14, 0x00, 0x00, 0x00, 0x0a, 0x00,
+  0x15, 0x00, 0x1e, 0x00, 0x28, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x18, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x13, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x0a, 0x00,
+  0x15, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x15, 0x00, 0x1f, 0x00, 0x29, 0x00,
+  0x35, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x13, 0x00, 0x1d, 0x00,
+  0x00, 0x00, 0x0a, 0x00, 0x15, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x0a, 0x00,
+  0x14, 0x00, 0x1d, 0x00, 0x27, 0x00, 0x32, 0x00, 0x00, 0x00, 0x0a, 0x00,
+  0x00, 0x00, 0x0b, 0x00, 0x14, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x15, 0x00, 0x20, 0x00, 0x2c, 0x00, 0x35, 0x00, 0x3f, 0x00, 0x49, 0x00,
+  0x00, 0x00, 0x0a, 0x00, 0x15, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x16, 0x00,
+  0x21, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x16, 0x00, 0x1f, 0x00,
+  0x28, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x17, 0x00, 0x21, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x15, 0x00, 0x21, 0x00, 0x2b, 0x00, 0x34, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x16, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x08, 0x00, 0x12, 0x00,
+  0x1b, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x16, 0x00, 0x20, 0x00, 0x29, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x18, 0x00, 0x22, 0x00, 0x2b, 0x00, 0x36, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x16, 0x00, 0x20, 0x00, 0x2b, 0x00, 0x36, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x13, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x15, 0x00, 0x1e, 0x00,
+  0x28, 0x00, 0x33, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x16, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x13, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x13, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x13, 0x00, 0x00, 0x00, 0x12, 0x00, 0x1d, 0x00, 0x27, 0x00,
+  0x32, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x12, 0x00, 0x1b, 0x00, 0x26, 0x00,
+  0x30, 0x00, 0x3b, 0x00, 0x44, 0x00, 0x4e, 0x00, 0x59, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x16, 0x00, 0x21, 0x00, 0x29, 0x00, 0x00, 0x00, 0x12, 0x00,
+  0x1c, 0x00, 0x25, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x12, 0x00, 0x1d, 0x00,
+  0x27, 0x00, 0x31, 0x00, 0x3c, 0x00, 0x45, 0x00, 0x00, 0x00, 0x0a, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x14, 0x00, 0x00, 0x00, 0x0d, 0x00,
+  0x16, 0x00, 0x22, 0x00, 0x2c, 0x00, 0x35, 0x00, 0x40, 0x00, 0x4b, 0x00,
+  0x00, 0x00, 0x0a, 0x00, 0x16, 0x00, 0x21, 0x00, 0x00, 0x00, 0x0a, 0x00,
+  0x13, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x16, 0x00, 0x22, 0x00,
+  0x00, 0x00, 0x0a, 0x00, 0x13, 0x00, 0x1c, 0x00, 0x25, 0x00, 0x2f, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x16, 0x00, 0x20, 0x00, 0x29, 0x00, 0x32, 0x00,
+  0x3c, 0x00, 0x47, 0x00, 0x50, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x16, 0x00,
+  0x20, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x09, 0x00, 0x13, 0x00, 0x1d, 0x00,
+  0x28, 0x00, 0x00, 0x00, 0x09, 0x00, 0x14, 0x00, 0x1e, 0x00, 0x27, 0x00,
+  0x31, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x13, 0x00, 0x00, 0x00, 0x0a, 0x00,
+  0x15, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x15, 0x00, 0x1f, 0x00, 0x2b, 0x00,
+  0x34, 0x00, 0x00, 0x00, 0x15, 0x00, 0x1e, 0x00, 0x27, 0x00, 0x31, 0x00,
+  0x00, 0x00, 0x0a, 0x00, 0x14, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x14, 0x00,
+  0x1f, 0x00, 0x29, 0x00, 0x33, 0x00, 0x00, 0x00, 0x10, 0x00, 0x1b, 0x00,
+  0x25, 0x00, 0x30, 0x00, 0x3a, 0x00, 0x44, 0x00, 0x00, 0x00, 0x0a, 0x00,
+  0x13, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x14, 0x00, 0x1f, 0x00,
+  0x2a, 0x00, 0x34, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x13, 0x00, 0x1c, 0x00,
+  0x27, 0x00, 0x32, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x13, 0x00,
+  0x00, 0x00, 0x0b, 0x00, 0x16, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x15, 0x00,
+  0x1f, 0x00, 0x00, 0x00, 0x09, 0x00, 0x12, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x15, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x15, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x13, 0x00, 0x1d, 0x00, 0x27, 0x00, 0x31, 0x00,
+  0x3a, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x14, 0x00, 0x1e, 0x00, 0x27, 0x00,
+  0x31, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x15, 0x00, 0x1e, 0x00, 0x27, 0x00,
+  0x00, 0x00, 0x0a, 0x00, 0x14, 0x00, 0x1e, 0x00, 0x28, 0x00, 0x31, 0x00,
+  0x00, 0x00, 0x0a, 0x00, 0x15, 0x00, 0x20, 0x00, 0x29, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x15, 0x00, 0x20, 0x00, 0x2a, 0x00, 0x35, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x15, 0x00, 0x21, 0x00, 0x2a, 0x00, 0x33, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x14, 0x00, 0x1d, 0x00, 0x26, 0x00, 0x2f, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x14, 0x00, 0x1e, 0x00, 0x27, 0x00, 0x00, 0x00, 0x0a, 0x00,
+  0x15, 0x00, 0x1f, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x15, 0x00, 0x1f, 0x00,
+  0x28, 0x00, 0x31, 0x00, 0x3a, 0x00, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x14, 0x00, 0x1f, 0x00, 0x29, 0x00, 0x32, 0x00, 0x3d, 0x00,
+  0x00, 0x00, 0x15, 0x00, 0x1e, 0x00, 0x26, 0x00, 0x2f, 0x00, 0x3a, 0x00,
+  0x00, 0x00, 0x0a, 0x00, 0x15, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x0a, 0x00,
+  0x14, 0x00, 0x1e, 0x00, 0x29, 0x00, 0x32, 0x00, 0x3d, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x14, 0x00, 0x1e, 0x00, 0x27, 0x00, 0x30, 0x00, 0x3a, 0x00,
+  0x43, 0x00, 0x00, 0x00, 0x09, 0x00, 0x13, 0x00, 0x1e, 0x00, 0x29, 0x00,
+  0x34, 0x00, 0x3d, 0x00, 0x46, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x14, 0x00,
+  0x1d, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x16, 0x00, 0x20, 0x00, 0x2a, 0x00,
+  0x00, 0x00, 0x0a, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x13, 0x00, 0x1d, 0x00, 0x27, 0x00, 0x30, 0x00, 0x39, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x15, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x14, 0x00,
+  0x1e, 0x00, 0x28, 0x00, 0x30, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x13, 0x00, 0x1d, 0x00, 0x27, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x14, 0x00,
+  0x1e, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x19, 0x00, 0x22, 0x00, 0x2f, 0x00,
+  0x38, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x14, 0x00, 0x1f, 0x00, 0x29, 0x00,
+  0x00, 0x00, 0x0a, 0x00, 0x14, 0x00, 0x20, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x15, 0x00, 0x20, 0x00, 0x2c, 0x00, 0x36, 0x00, 0x41, 0x00, 0x4b, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x17, 0x00, 0x20, 0x00, 0x29, 0x00, 0x32, 0x00,
+  0x3d, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x15, 0x00, 0x1f, 0x00, 0x29, 0x00,
+  0x35, 0x00, 0x3f, 0x00, 0x49, 0x00, 0x00, 0x00, 0x22, 0x00, 0x2c, 0x00,
+  0x37, 0x00, 0x42, 0x00, 0x4b, 0x00, 0x56, 0x00, 0x5f, 0x00, 0x69, 0x00,
+  0x73, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x17, 0x00, 0x22, 0x00,
+  0x2b, 0x00, 0x00, 0x00, 0x09, 0x00, 0x13, 0x00, 0x1d, 0x00, 0x28, 0x00,
+  0x00, 0x00, 0x1f, 0x00, 0x2e, 0x00, 0x38, 0x00, 0x42, 0x00, 0x4b, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x13, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x0f, 0x00,
+  0x19, 0x00, 0x24, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x17, 0x00,
+  0x21, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x14, 0x00, 0x1e, 0x00, 0x28, 0x00,
+  0x00, 0x00, 0x0a, 0x00, 0x16, 0x00, 0x20, 0x00, 0x2a, 0x00, 0x33, 0x00,
+  0x00, 0x00, 0x0a, 0x00, 0x13, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x13, 0x00, 0x1d, 0x00, 0x27, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x24, 0x00,
+  0x2d, 0x00, 0x36, 0x00, 0x41, 0x00, 0x00, 0x00, 0x10, 0x00, 0x1b, 0x00,
+  0x26, 0x00, 0x31, 0x00, 0x3b, 0x00, 0x45, 0x00, 0x4f, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x14, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x13, 0x00, 0x1d, 0x00, 0x28, 0x00, 0x34, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x12, 0x00, 0x1c, 0x00, 0x25, 0x00, 0x00, 0x00, 0x09, 0x00, 0x14, 0x00,
+  0x1e, 0x00, 0x27, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x14, 0x00, 0x1d, 0x00,
+  0x26, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x15, 0x00, 0x1e, 0x00, 0x29, 0x00,
+  0x00, 0x00, 0x1c, 0x00, 0x2c, 0x00, 0x37, 0x00, 0x40, 0x00, 0x4b, 0x00,
+  0x56, 0x00, 0x61, 0x00, 0x6b, 0x00, 0x74, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x18, 0x00, 0x23, 0x00, 0x2d, 0x00, 0x38, 0x00, 0x44, 0x00, 0x4f, 0x00,
+  0x58, 0x00, 0x62, 0x00, 0x6d, 0x00, 0x76, 0x00, 0x00, 0x00, 0x2e, 0x00,
+  0x38, 0x00, 0x44, 0x00, 0x4d, 0x00, 0x56, 0x00, 0x62, 0x00, 0x6b, 0x00,
+  0x76, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x16, 0x00, 0x20, 0x00, 0x2a, 0x00,
+  0x34, 0x00, 0x00, 0x00, 0x25, 0x00, 0x2e, 0x00, 0x39, 0x00, 0x42, 0x00,
+  0x4c, 0x00, 0x56, 0x00, 0x61, 0x00, 0x6b, 0x00, 0x76, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x15, 0x00, 0x20, 0x00, 0x00, 0x00, 0x25, 0x00, 0x2f, 0x00,
+  0x39, 0x00, 0x49, 0x00, 0x54, 0x00, 0x5e, 0x00, 0x69, 0x00, 0x72, 0x00,
+  0x00, 0x00, 0x0a, 0x00, 0x13, 0x00, 0x23, 0x00, 0x2c, 0x00, 0x35, 0x00,
+  0x40, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x14, 0x00, 0x1e, 0x00,
+  0x29, 0x00, 0x32, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x23, 0x00, 0x2c, 0x00,
+  0x36, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x16, 0x00, 0x1f, 0x00, 0x28, 0x00,
+  0x00, 0x00, 0x0b, 0x00, 0x15, 0x00, 0x1f, 0x00, 0x29, 0x00, 0x33, 0x00,
+  0x3e, 0x00, 0x00, 0x00, 0x19, 0x00, 0x26, 0x00, 0x39, 0x00, 0x42, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x1a, 0x00, 0x25, 0x00, 0x2f, 0x00, 0x39, 0x00,
+  0x43, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x1a, 0x00, 0x25, 0x00, 0x30, 0x00,
+  0x3a, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x1a, 0x00, 0x24, 0x00, 0x2f, 0x00,
+  0x39, 0x00, 0x42, 0x00, 0x4b, 0x00, 0x56, 0x00, 0x5f, 0x00, 0x6a, 0x00,
+  0x00, 0x00, 0x1c, 0x00, 0x2c, 0x00, 0x3f, 0x00, 0x49, 0x00, 0x52, 0x00,
+  0x5e, 0x00, 0x00, 0x00, 0x10, 0x00, 0x1d, 0x00, 0x28, 0x00, 0x31, 0x00,
+  0x3b, 0x00, 0x47, 0x00, 0x51, 0x00, 0x5a, 0x00, 0x65, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x20, 0x00, 0x2a, 0x00, 0x36, 0x00, 0x3f, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x1a, 0x00, 0x24, 0x00, 0x2e, 0x00, 0x38, 0x00, 0x42, 0x00,
+  0x4d, 0x00, 0x59, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x17, 0x00, 0x20, 0x00,
+  0x2a, 0x00, 0x35, 0x00, 0x3e, 0x00, 0x4a, 0x00, 0x55, 0x00, 0x5f, 0x00,
+  0x69, 0x00, 0x00, 0x00, 0x13, 0x00, 0x1d, 0x00, 0x27, 0x00, 0x31, 0x00,
+  0x3b, 0x00, 0x44, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x10, 0x00, 0x1b, 0x00,
+  0x26, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x18, 0x00, 0x00, 0x00, 0x0d, 0x00,
+  0x18, 0x00, 0x23, 0x00, 0x2d, 0x00, 0x37, 0x00, 0x00, 0x00, 0x16, 0x00,
+  0x23, 0x00, 0x2e, 0x00, 0x39, 0x00, 0x43, 0x00, 0x4e, 0x00, 0x57, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x17, 0x00, 0x22, 0x00, 0x2c, 0x00, 0x36, 0x00,
+  0x40, 0x00, 0x49, 0x00, 0x00, 0x00, 0x10, 0x00, 0x1c, 0x00, 0x25, 0x00,
+  0x2e, 0x00, 0x39, 0x00, 0x42, 0x00, 0x4c, 0x00, 0x55, 0x00, 0x5f, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x20, 0x00, 0x2d, 0x00, 0x3d, 0x00, 0x47, 0x00,
+  0x51, 0x00, 0x5b, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x7a, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x1d, 0x00, 0x2d, 0x00, 0x3d, 0x00, 0x47, 0x00, 0x51, 0x00,
+  0x5b, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x78, 0x00, 0x00, 0x00, 0x16, 0x00,
+  0x26, 0x00, 0x33, 0x00, 0x40, 0x00, 0x49, 0x00, 0x54, 0x00, 0x5e, 0x00,
+  0x68, 0x00, 0x73, 0x00, 0x7e, 0x00, 0x88, 0x00, 0x91, 0x00, 0x9b, 0x00,
+  0x00, 0x00, 0x16, 0x00, 0x23, 0x00, 0x30, 0x00, 0x3d, 0x00, 0x46, 0x00,
+  0x50, 0x00, 0x5b, 0x00, 0x64, 0x00, 0x6f, 0x00, 0x7a, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x1a, 0x00, 0x27, 0x00, 0x37, 0x00, 0x41, 0x00, 0x4c, 0x00,
+  0x57, 0x00, 0x62, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x1a, 0x00, 0x27, 0x00,
+  0x37, 0x00, 0x41, 0x00, 0x4b, 0x00, 0x54, 0x00, 0x5f, 0x00, 0x68, 0x00,
+  0x72, 0x00, 0x7c, 0x00, 0x87, 0x00, 0x00, 0x00, 0x19, 0x00, 0x29, 0x00,
+  0x36, 0x00, 0x46, 0x00, 0x50, 0x00, 0x5b, 0x00, 0x64, 0x00, 0x6e, 0x00,
+  0x77, 0x00, 0x82, 0x00, 0x00, 0x00, 0x10, 0x00, 0x23, 0x00, 0x30, 0x00,
+  0x3d, 0x00, 0x47, 0x00, 0x51, 0x00, 0x5b, 0x00, 0x65, 0x00, 0x6f, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x1d, 0x00, 0x2a, 0x00, 0x34, 0x00, 0x3d, 0x00,
+  0x46, 0x00, 0x51, 0x00, 0x5b, 0x00, 0x66, 0x00, 0x70, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x1d, 0x00, 0x2a, 0x00, 0x33, 0x00, 0x3e, 0x00, 0x48, 0x00,
+  0x51, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x17, 0x00, 0x24, 0x00,
+  0x2e, 0x00, 0x37, 0x00, 0x41, 0x00, 0x4a, 0x00, 0x55, 0x00, 0x60, 0x00,
+  0x6b, 0x00, 0x73, 0x00, 0x00, 0x00, 0x10, 0x00, 0x1a, 0x00, 0x30, 0x00,
+  0x39, 0x00, 0x42, 0x00, 0x4b, 0x00, 0x55, 0x00, 0x5f, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x1a, 0x00, 0x33, 0x00, 0x3d, 0x00, 0x47, 0x00, 0x52, 0x00,
+  0x5c, 0x00, 0x66, 0x00, 0x71, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x1a, 0x00,
+  0x33, 0x00, 0x3d, 0x00, 0x48, 0x00, 0x53, 0x00, 0x5d, 0x00, 0x67, 0x00,
+  0x73, 0x00, 0x7c, 0x00, 0x85, 0x00, 0x8f, 0x00, 0x99, 0x00, 0xa2, 0x00,
+  0xac, 0x00, 0xb6, 0x00, 0xc3, 0x00, 0xce, 0x00, 0x00, 0x00, 0x0d, 0x00,
+  0x1a, 0x00, 0x27, 0x00, 0x31, 0x00, 0x3c, 0x00, 0x46, 0x00, 0x51, 0x00,
+  0x5b, 0x00, 0x64, 0x00, 0x6f, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x0d, 0x00,
+  0x1a, 0x00, 0x39, 0x00, 0x43, 0x00, 0x4c, 0x00, 0x59, 0x00, 0x64, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x1a, 0x00, 0x27, 0x00, 0x34, 0x00, 0x41, 0x00,
+  0x4c, 0x00, 0x56, 0x00, 0x60, 0x00, 0x6b, 0x00, 0x75, 0x00, 0x7f, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x1a, 0x00, 0x2d, 0x00, 0x3d, 0x00, 0x4d, 0x00,
+  0x57, 0x00, 0x62, 0x00, 0x6c, 0x00, 0x76, 0x00, 0x80, 0x00, 0x8a, 0x00,
+  0x94, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x29, 0x00, 0x3c, 0x00, 0x49, 0x00,
+  0x59, 0x00, 0x66, 0x00, 0x71, 0x00, 0x7b, 0x00, 0x85, 0x00, 0x90, 0x00,
+  0x9a, 0x00, 0xa5, 0x00, 0xb0, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x29, 0x00,
+  0x3c, 0x00, 0x49, 0x00, 0x59, 0x00, 0x69, 0x00, 0x72, 0x00, 0x7b, 0x00,
+  0x86, 0x00, 0x8f, 0x00, 0x99, 0x00, 0xa3, 0x00, 0xad, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x20, 0x00, 0x33, 0x00, 0x43, 0x00, 0x50, 0x00, 0x60, 0x00,
+  0x6a, 0x00, 0x74, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x1a, 0x00,
+  0x2a, 0x00, 0x37, 0x00, 0x44, 0x00, 0x51, 0x00, 0x5c, 0x00, 0x65, 0x00,
+  0x6e, 0x00, 0x7a, 0x00, 0x84, 0x00, 0x8d, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x16, 0x00, 0x23, 0x00, 0x2d, 0x00, 0x40, 0x00, 0x49, 0x00, 0x53, 0x00,
+  0x5e, 0x00, 0x69, 0x00, 0x72, 0x00, 0x7c, 0x00, 0x85, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x20, 0x00, 0x33, 0x00, 0x43, 0x00, 0x50, 0x00, 0x5b, 0x00,
+  0x65, 0x00, 0x6f, 0x00, 0x78, 0x00, 0x82, 0x00, 0x8b, 0x00, 0x96, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x1a, 0x00, 0x2d, 0x00, 0x3d, 0x00, 0x53, 0x00,
+  0x5d, 0x00, 0x68, 0x00, 0x71, 0x00, 0x7b, 0x00, 0x85, 0x00, 0x8e, 0x00,
+  0x9a, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x1d, 0x00, 0x2a, 0x00,
+  0x37, 0x00, 0x50, 0x00, 0x5b, 0x00, 0x65, 0x00, 0x6f, 0x00, 0x79, 0x00,
+  0x83, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x1a, 0x00, 0x27, 0x00, 0x37, 0x00,
+  0x44, 0x00, 0x4e, 0x00, 0x5a, 0x00, 0x63, 0x00, 0x00, 0x00, 0x0d, 0x00,
+  0x1d, 0x00, 0x30, 0x00, 0x3d, 0x00, 0x4a, 0x00, 0x54, 0x00, 0x5e, 0x00,
+  0x68, 0x00, 0x72, 0x00, 0x7a, 0x00, 0x83, 0x00, 0x8e, 0x00, 0x99, 0x00,
+  0xa5, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x2c, 0x00, 0x3f, 0x00, 0x55, 0x00,
+  0x6b, 0x00, 0x75, 0x00, 0x7e, 0x00, 0x88, 0x00, 0x91, 0x00, 0x9c, 0x00,
+  0xa5, 0x00, 0xb0, 0x00, 0xbb, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x49, 0x00,
+  0x56, 0x00, 0x66, 0x00, 0x73, 0x00, 0x89, 0x00, 0x93, 0x00, 0x9c, 0x00,
+  0xa7, 0x00, 0xb1, 0x00, 0xbc, 0x00, 0xc6, 0x00, 0xcf, 0x00, 0xda, 0x00,
+  0x00, 0x00, 0x0a, 0x00, 0x17, 0x00, 0x27, 0x00, 0x37, 0x00, 0x50, 0x00,
+  0x59, 0x00, 0x64, 0x00, 0x6f, 0x00, 0x79, 0x00, 0x82, 0x00, 0x8d, 0x00,
+  0x99, 0x00, 0xa3, 0x00, 0xae, 0x00, 0xb8, 0x00, 0xc1, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x1a, 0x00, 0x27, 0x00, 0x34, 0x00, 0x4a, 0x00, 0x54, 0x00,
+  0x60, 0x00, 0x6b, 0x00, 0x76, 0x00, 0x7f, 0x00, 0x89, 0x00, 0x93, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x1d, 0x00, 0x2a, 0x00, 0x37, 0x00, 0x47, 0x00,
+  0x57, 0x00, 0x64, 0x00, 0x71, 0x00, 0x7a, 0x00, 0x84, 0x00, 0x90, 0x00,
+  0x9a, 0x00, 0xa6, 0x00, 0xb0, 0x00, 0xba, 0x00, 0xc3, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x1d, 0x00, 0x2a, 0x00, 0x37, 0x00, 0x44, 0x00, 0x54, 0x00,
+  0x61, 0x00, 0x71, 0x00, 0x7a, 0x00, 0x84, 0x00, 0x8e, 0x00, 0x97, 0x00,
+  0xa1, 0x00, 0xab, 0x00, 0xb5, 0x00, 0xbe, 0x00, 0xc9, 0x00, 0x00, 0x00,
+  0x19, 0x00, 0x32, 0x00, 0x4b, 0x00, 0x64, 0x00, 0x83, 0x00, 0x99, 0x00,
+  0xb8, 0x00, 0xcb, 0x00, 0xd8, 0x00, 0xe5, 0x00, 0xf2, 0x00, 0xff, 0x00,
+  0x12, 0x01, 0x22, 0x01, 0x2f, 0x01, 0x3b, 0x01, 0x45, 0x01, 0x50, 0x01,
+  0x5b, 0x01, 0x64, 0x01, 0x00, 0x00, 0x13, 0x00, 0x20, 0x00, 0x30, 0x00,
+  0x3d, 0x00, 0x50, 0x00, 0x60, 0x00, 0x79, 0x00, 0x86, 0x00, 0x91, 0x00,
+  0x9a, 0x00, 0xa4, 0x00, 0xae, 0x00, 0xb7, 0x00, 0xc0, 0x00, 0x00, 0x00,
+  0x19, 0x00, 0x32, 0x00, 0x4b, 0x00, 0x64, 0x00, 0x83, 0x00, 0x99, 0x00,
+  0xb8, 0x00, 0xc8, 0x00, 0xd5, 0x00, 0xe2, 0x00, 0xec, 0x00, 0xfc, 0x00,
+  0x0c, 0x01, 0x19, 0x01, 0x29, 0x01, 0x34, 0x01, 0x3e, 0x01, 0x48, 0x01,
+  0x52, 0x01, 0x00, 0x00, 0x1c, 0x00, 0x29, 0x00, 0x36, 0x00, 0x43, 0x00,
+  0x50, 0x00, 0x63, 0x00, 0x70, 0x00, 0x80, 0x00, 0x90, 0x00, 0x9b, 0x00,
+  0xa7, 0x00, 0xb0, 0x00, 0xba, 0x00, 0xc3, 0x00, 0xcd, 0x00, 0xd9, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x1a, 0x00, 0x2a, 0x00, 0x37, 0x00, 0x44, 0x00,
+  0x54, 0x00, 0x61, 0x00, 0x71, 0x00, 0x7a, 0x00, 0x83, 0x00, 0x8c, 0x00,
+  0x96, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x2c, 0x00, 0x3f, 0x00, 0x4c, 0x00,
+  0x56, 0x00, 0x63, 0x00, 0x73, 0x00, 0x80, 0x00, 0x90, 0x00, 0x9c, 0x00,
+  0xa5, 0x00, 0xb0, 0x00, 0xbd, 0x00, 0x00, 0x00, 0x16, 0x00, 0x23, 0x00,
+  0x30, 0x00, 0x40, 0x00, 0x53, 0x00, 0x66, 0x00, 0x76, 0x00, 0x81, 0x00,
+  0x8a, 0x00, 0x96, 0x00, 0xa0, 0x00, 0xa9, 0x00, 0xb2, 0x00, 0xbb, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x1a, 0x00, 0x27, 0x00, 0x3a, 0x00, 0x4d, 0x00,
+  0x5a, 0x00, 0x64, 0x00, 0x6d, 0x00, 0x79, 0x00, 0x85, 0x00, 0x90, 0x00,
+  0x9b, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x1d, 0x00, 0x27, 0x00, 0x34, 0x00,
+  0x47, 0x00, 0x54, 0x00, 0x5e, 0x00, 0x69, 0x00, 0x73, 0x00, 0x7c, 0x00,
+  0x86, 0x00, 0x90, 0x00, 0x9a, 0x00, 0xa4, 0x00, 0xaf, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x1d, 0x00, 0x27, 0x00, 0x34, 0x00, 0x4d, 0x00, 0x5a, 0x00,
+  0x67, 0x00, 0x71, 0x00, 0x7b, 0x00, 0x86, 0x00, 0x8f, 0x00, 0x9a, 0x00,
+  0x00, 0x00, 0x13, 0x00, 0x23, 0x00, 0x2d, 0x00, 0x3a, 0x00, 0x4d, 0x00,
+  0x5a, 0x00, 0x70, 0x00, 0x79, 0x00, 0x83, 0x00, 0x8e, 0x00, 0x98, 0x00,
+  0xa1, 0x00, 0x00, 0x00, 0x13, 0x00, 0x23, 0x00, 0x30, 0x00, 0x40, 0x00,
+  0x50, 0x00, 0x60, 0x00, 0x7c, 0x00, 0x86, 0x00, 0x8f, 0x00, 0x99, 0x00,
+  0xa3, 0x00, 0xad, 0x00, 0xb9, 0x00, 0xc3, 0x00, 0x00, 0x00, 0x0d, 0x00,
+  0x1a, 0x00, 0x27, 0x00, 0x3a, 0x00, 0x47, 0x00, 0x54, 0x00, 0x5f, 0x00,
+  0x68, 0x00, 0x73, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x18, 0x00, 0x22, 0x00,
+  0x2f, 0x00, 0x3c, 0x00, 0x49, 0x00, 0x53, 0x00, 0x5d, 0x00, 0x68, 0x00,
+  0x71, 0x00, 0x7c, 0x00, 0x87, 0x00, 0x90, 0x00, 0x9a, 0x00, 0xa4, 0x00,
+  0x00, 0x00, 0x0a, 0x00, 0x1d, 0x00, 0x27, 0x00, 0x34, 0x00, 0x41, 0x00,
+  0x4b, 0x00, 0x5b, 0x00, 0x68, 0x00, 0x72, 0x00, 0x7b, 0x00, 0x84, 0x00,
+  0x8d, 0x00, 0x98, 0x00, 0xa2, 0x00, 0xad, 0x00, 0xb6, 0x00, 0xc0, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x26, 0x00, 0x33, 0x00, 0x40, 0x00, 0x5f, 0x00,
+  0x72, 0x00, 0x85, 0x00, 0x95, 0x00, 0x9e, 0x00, 0xa9, 0x00, 0xb3, 0x00,
+  0x00, 0x00, 0x13, 0x00, 0x26, 0x00, 0x33, 0x00, 0x40, 0x00, 0x50, 0x00,
+  0x60, 0x00, 0x70, 0x00, 0x7b, 0x00, 0x86, 0x00, 0x00, 0x00, 0x0d, 0x00,
+  0x20, 0x00, 0x33, 0x00, 0x40, 0x00, 0x4d, 0x00, 0x5a, 0x00, 0x67, 0x00,
+  0x74, 0x00, 0x7f, 0x00, 0x8a, 0x00, 0x95, 0x00, 0x9f, 0x00, 0xa9, 0x00,
+  0xb3, 0x00, 0xbd, 0x00, 0xc6, 0x00, 0xd1, 0x00, 0xda, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x1d, 0x00, 0x2a, 0x00, 0x3d, 0x00, 0x4a, 0x00, 0x54, 0x00,
+  0x6b, 0x00, 0x7e, 0x00, 0x88, 0x00, 0x92, 0x00, 0x9c, 0x00, 0xa6, 0x00,
+  0xaf, 0x00, 0x00, 0x00, 0x16, 0x00, 0x26, 0x00, 0x39, 0x00, 0x46, 0x00,
+  0x53, 0x00, 0x66, 0x00, 0x79, 0x00, 0x83, 0x00, 0x8d, 0x00, 0x97, 0x00,
+  0xa2, 0x00, 0x00, 0x00, 0x10, 0x00, 0x26, 0x00, 0x33, 0x00, 0x40, 0x00,
+  0x5f, 0x00, 0x6c, 0x00, 0x83, 0x00, 0x90, 0x00, 0x9b, 0x00, 0xa4, 0x00,
+  0x00, 0x00, 0x13, 0x00, 0x23, 0x00, 0x33, 0x00, 0x43, 0x00, 0x62, 0x00,
+  0x7e, 0x00, 0x91, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x1a, 0x00,
+  0x27, 0x00, 0x34, 0x00, 0x4a, 0x00, 0x57, 0x00, 0x60, 0x00, 0x6b, 0x00,
+  0x75, 0x00, 0x80, 0x00, 0x8c, 0x00, 0x95, 0x00, 0x9f, 0x00, 0xaa, 0x00,
+  0xb4, 0x00, 0x00, 0x00, 0x10, 0x00, 0x1d, 0x00, 0x2a, 0x00, 0x3a, 0x00,
+  0x4a, 0x00, 0x54, 0x00, 0x64, 0x00, 0x6d, 0x00, 0x78, 0x00, 0x84, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x20, 0x00, 0x30, 0x00, 0x3d, 0x00, 0x50, 0x00,
+  0x60, 0x00, 0x6d, 0x00, 0x77, 0x00, 0x84, 0x00, 0x8f, 0x00, 0x99, 0x00,
+  0xa3, 0x00, 0x00, 0x00, 0x10, 0x00, 0x20, 0x00, 0x33, 0x00, 0x40, 0x00,
+  0x4d, 0x00, 0x5a, 0x00, 0x64, 0x00, 0x6e, 0x00, 0x77, 0x00, 0x83, 0x00,
+  0x8d, 0x00, 0x98, 0x00, 0xa3, 0x00, 0xae, 0x00, 0x00, 0x00, 0x16, 0x00,
+  0x23, 0x00, 0x30, 0x00, 0x3d, 0x00, 0x50, 0x00, 0x5d, 0x00, 0x66, 0x00,
+  0x71, 0x00, 0x7a, 0x00, 0x84, 0x00, 0x8f, 0x00, 0x98, 0x00, 0xa4, 0x00,
+  0xad, 0x00, 0xb6, 0x00, 0x00, 0x00, 0x13, 0x00, 0x20, 0x00, 0x2d, 0x00,
+  0x37, 0x00, 0x44, 0x00, 0x60, 0x00, 0x6d, 0x00, 0x78, 0x00, 0x83, 0x00,
+  0x8d, 0x00, 0x97, 0x00, 0xa1, 0x00, 0xac, 0x00, 0x00, 0x00, 0x16, 0x00,
+  0x23, 0x00, 0x30, 0x00, 0x3d, 0x00, 0x4d, 0x00, 0x5d, 0x00, 0x6a, 0x00,
+  0x74, 0x00, 0x7d, 0x00, 0x87, 0x00, 0x93, 0x00, 0x9e, 0x00, 0x00, 0x00,
+  0x22, 0x00, 0x2f, 0x00, 0x3c, 0x00, 0x4c, 0x00, 0x59, 0x00, 0x6c, 0x00,
+  0x79, 0x00, 0x86, 0x00, 0x92, 0x00, 0x9b, 0x00, 0xa4, 0x00, 0x00, 0x00,
+  0x22, 0x00, 0x32, 0x00, 0x3c, 0x00, 0x52, 0x00, 0x5c, 0x00, 0x69, 0x00,
+  0x76, 0x00, 0x7f, 0x00, 0x89, 0x00, 0x92, 0x00, 0x9d, 0x00, 0xa6, 0x00,
+  0xb1, 0x00, 0x00, 0x00, 0x10, 0x00, 0x23, 0x00, 0x39, 0x00, 0x46, 0x00,
+  0x50, 0x00, 0x63, 0x00, 0x6d, 0x00, 0x77, 0x00, 0x81, 0x00, 0x8a, 0x00,
+  0x00, 0x00, 0x19, 0x00, 0x32, 0x00, 0x4a, 0x00, 0x66, 0x00, 0x85, 0x00,
+  0xa1, 0x00, 0xba, 0x00, 0xd3, 0x00, 0xef, 0x00, 0x05, 0x01, 0x12, 0x01,
+  0x25, 0x01, 0x38, 0x01, 0x48, 0x01, 0x55, 0x01, 0x65, 0x01, 0x70, 0x01,
+  0x79, 0x01, 0x82, 0x01, 0x8d, 0x01, 0x97, 0x01, 0x00, 0x00, 0x0d, 0x00,
+  0x1a, 0x00, 0x2a, 0x00, 0x37, 0x00, 0x47, 0x00, 0x54, 0x00, 0x5f, 0x00,
+  0x69, 0x00, 0x74, 0x00, 0x7d, 0x00, 0x87, 0x00, 0x00, 0x00, 0x19, 0x00,
+  0x32, 0x00, 0x4a, 0x00, 0x66, 0x00, 0x85, 0x00, 0xa1, 0x00, 0xba, 0x00,
+  0xd3, 0x00, 0xef, 0x00, 0x05, 0x01, 0x15, 0x01, 0x22, 0x01, 0x2f, 0x01,
+  0x3c, 0x01, 0x49, 0x01, 0x56, 0x01, 0x5f, 0x01, 0x69, 0x01, 0x74, 0x01,
+  0x00, 0x00, 0x16, 0x00, 0x26, 0x00, 0x33, 0x00, 0x40, 0x00, 0x4d, 0x00,
+  0x5a, 0x00, 0x67, 0x00, 0x70, 0x00, 0x79, 0x00, 0x83, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x1d, 0x00, 0x30, 0x00, 0x3d, 0x00, 0x4d, 0x00, 0x5a, 0x00,
+  0x63, 0x00, 0x6c, 0x00, 0x76, 0x00, 0x80, 0x00, 0x8a, 0x00, 0x95, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x23, 0x00, 0x36, 0x00, 0x43, 0x00, 0x53, 0x00,
+  0x60, 0x00, 0x6b, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x29, 0x00, 0x39, 0x00,
+  0x46, 0x00, 0x53, 0x00, 0x6c, 0x00, 0x79, 0x00, 0x86, 0x00, 0x90, 0x00,
+  0x9b, 0x00, 0xa7, 0x00, 0xb1, 0x00, 0xbc, 0x00, 0xc6, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x1d, 0x00, 0x2a, 0x00, 0x3a, 0x00, 0x47, 0x00, 0x5d, 0x00,
+  0x70, 0x00, 0x80, 0x00, 0x89, 0x00, 0x93, 0x00, 0x9d, 0x00, 0xa7, 0x00,
+  0xb0, 0x00, 0xba, 0x00, 0xc4, 0x00, 0xce, 0x00, 0x00, 0x00, 0x0d, 0x00,
+  0x1d, 0x00, 0x2d, 0x00, 0x40, 0x00, 0x4d, 0x00, 0x5a, 0x00, 0x67, 0x00,
+  0x73, 0x00, 0x7c, 0x00, 0x87, 0x00, 0x91, 0x00, 0x9a, 0x00, 0xa4, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x1d, 0x00, 0x30, 0x00, 0x3d, 0x00, 0x56, 0x00,
+  0x66, 0x00, 0x79, 0x00, 0x85, 0x00, 0x91, 0x00, 0x9c, 0x00, 0xa6, 0x00,
+  0xb0, 0x00, 0xba, 0x00, 0xc6, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x26, 0x00,
+  0x33, 0x00, 0x46, 0x00, 0x56, 0x00, 0x66, 0x00, 0x73, 0x00, 0x7e, 0x00,
+  0x89, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x23, 0x00, 0x30, 0x00, 0x43, 0x00,
+  0x56, 0x00, 0x66, 0x00, 0x73, 0x00, 0x7d, 0x00, 0x87, 0x00, 0x92, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x1d, 0x00, 0x30, 0x00, 0x40, 0x00, 0x4d, 0x00,
+  0x5d, 0x00, 0x6a, 0x00, 0x77, 0x00, 0x83, 0x00, 0x8d, 0x00, 0x96, 0x00,
+  0xa1, 0x00, 0xaa, 0x00, 0xb4, 0x00, 0xbe, 0x00, 0xc8, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x26, 0x00, 0x36, 0x00, 0x4f, 0x00, 0x5f, 0x00, 0x6f, 0x00,
+  0x82, 0x00, 0x8c, 0x00, 0x95, 0x00, 0xa0, 0x00, 0xaa, 0x00, 0xb5, 0x00,
+  0xc0, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x1a, 0x00, 0x2d, 0x00, 0x3d, 0x00,
+  0x4d, 0x00, 0x56, 0x00, 0x5f, 0x00, 0x69, 0x00, 0x73, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x23, 0x00, 0x36, 0x00, 0x43, 0x00, 0x56, 0x00, 0x5f, 0x00,
+  0x69, 0x00, 0x74, 0x00, 0x7d, 0x00, 0x86, 0x00, 0x91, 0x00, 0x9b, 0x00,
+  0x00, 0x00, 0x13, 0x00, 0x20, 0x00, 0x36, 0x00, 0x46, 0x00, 0x53, 0x00,
+  0x5c, 0x00, 0x65, 0x00, 0x00, 0x00, 0x13, 0x00, 0x20, 0x00, 0x2d, 0x00,
+  0x43, 0x00, 0x5f, 0x00, 0x6c, 0x00, 0x76, 0x00, 0x81, 0x00, 0x8b, 0x00,
+  0x96, 0x00, 0xa0, 0x00, 0x00, 0x00, 0x13, 0x00, 0x26, 0x00, 0x33, 0x00,
+  0x40, 0x00, 0x4d, 0x00, 0x5a, 0x00, 0x64, 0x00, 0x6f, 0x00, 0x78, 0x00,
+  0x83, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x1d, 0x00, 0x2d, 0x00, 0x43, 0x00,
+  0x50, 0x00, 0x5d, 0x00, 0x69, 0x00, 0x73, 0x00, 0x7d, 0x00, 0x88, 0x00,
+  0x93, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x1a, 0x00, 0x2d, 0x00,
+  0x3d, 0x00, 0x4a, 0x00, 0x60, 0x00, 0x6d, 0x00, 0x78, 0x00, 0x83, 0x00,
+  0x8d, 0x00, 0x98, 0x00, 0x00, 0x00, 0x17, 0x00, 0x27, 0x00, 0x34, 0x00,
+  0x44, 0x00, 0x5a, 0x00, 0x6a, 0x00, 0x77, 0x00, 0x81, 0x00, 0x8a, 0x00,
+  0x93, 0x00, 0x9e, 0x00, 0xa9, 0x00, 0xb4, 0x00, 0x00, 0x00, 0x0d, 0x00,
+  0x20, 0x00, 0x2d, 0x00, 0x3d, 0x00, 0x46, 0x00, 0x59, 0x00, 0x66, 0x00,
+  0x73, 0x00, 0x7d, 0x00, 0x87, 0x00, 0x92, 0x00, 0x9b, 0x00, 0xa4, 0x00,
+  0xae, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x1d, 0x00, 0x27, 0x00, 0x37, 0x00,
+  0x44, 0x00, 0x60, 0x00, 0x6d, 0x00, 0x7a, 0x00, 0x84, 0x00, 0x8e, 0x00,
+  0x98, 0x00, 0x00, 0x00, 0x13, 0x00, 0x23, 0x00, 0x33, 0x00, 0x40, 0x00,
+  0x4d, 0x00, 0x5a, 0x00, 0x67, 0x00, 0x70, 0x00, 0x7a, 0x00, 0x00, 0x00,
+  0x16, 0x00, 0x26, 0x00, 0x33, 0x00, 0x40, 0x00, 0x4d, 0x00, 0x5d, 0x00,
+  0x67, 0x00, 0x72, 0x00, 0x7b, 0x00, 0x84, 0x00, 0x8e, 0x00, 0x9a, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x20, 0x00, 0x31, 0x00, 0x3e, 0x00, 0x4e, 0x00,
+  0x5b, 0x00, 0x66, 0x00, 0x70, 0x00, 0x7a, 0x00, 0x83, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x22, 0x00, 0x2e, 0x00, 0x3e, 0x00, 0x4b, 0x00, 0x58, 0x00,
+  0x62, 0x00, 0x6c, 0x00, 0x75, 0x00, 0x80, 0x00, 0x8a, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x20, 0x00, 0x30, 0x00, 0x3d, 0x00, 0x56, 0x00, 0x6f, 0x00,
+  0x7f, 0x00, 0x88, 0x00, 0x93, 0x00, 0x9f, 0x00, 0xaa, 0x00, 0xb5, 0x00,
+  0xbf, 0x00, 0xc9, 0x00, 0xd4, 0x00, 0xde, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x1d, 0x00, 0x2d, 0x00, 0x3a, 0x00, 0x4d, 0x00, 0x60, 0x00, 0x6d, 0x00,
+  0x77, 0x00, 0x83, 0x00, 0x8c, 0x00, 0x95, 0x00, 0xa0, 0x00, 0xaa, 0x00,
+  0xb4, 0x00, 0x00, 0x00, 0x13, 0x00, 0x23, 0x00, 0x2d, 0x00, 0x46, 0x00,
+  0x53, 0x00, 0x5e, 0x00, 0x68, 0x00, 0x71, 0x00, 0x7c, 0x00, 0x85, 0x00,
+  0x00, 0x00, 0x13, 0x00, 0x23, 0x00, 0x39, 0x00, 0x52, 0x00, 0x5c, 0x00,
+  0x68, 0x00, 0x73, 0x00, 0x7e, 0x00, 0x89, 0x00, 0x93, 0x00, 0x9e, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x1d, 0x00, 0x33, 0x00, 0x43, 0x00, 0x4e, 0x00,
+  0x57, 0x00, 0x60, 0x00, 0x6b, 0x00, 0x75, 0x00, 0x7f, 0x00, 0x89, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x1a, 0x00, 0x36, 0x00, 0x46, 0x00, 0x65, 0x00,
+  0x6f, 0x00, 0x79, 0x00, 0x84, 0x00, 0x8d, 0x00, 0x96, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x17, 0x00, 0x24, 0x00, 0x3d, 0x00, 0x53, 0x00, 0x5d, 0x00,
+  0x66, 0x00, 0x70, 0x00, 0x7a, 0x00, 0x83, 0x00, 0x8d, 0x00, 0x97, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x1d, 0x00, 0x2a, 0x00, 0x40, 0x00, 0x4b, 0x00,
+  0x54, 0x00, 0x5e, 0x00, 0x68, 0x00, 0x73, 0x00, 0x7d, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x2c, 0x00, 0x39, 0x00, 0x4c, 0x00, 0x5c, 0x00, 0x67, 0x00,
+  0x72, 0x00, 0x7d, 0x00, 0x88, 0x00, 0x92, 0x00, 0x9b, 0x00, 0xa5, 0x00,
+  0xaf, 0x00, 0xba, 0x00, 0x00, 0x00, 0x19, 0x00, 0x2c, 0x00, 0x39, 0x00,
+  0x46, 0x00, 0x56, 0x00, 0x60, 0x00, 0x6a, 0x00, 0x73, 0x00, 0x7d, 0x00,
+  0x86, 0x00, 0x8f, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x1a, 0x00, 0x27, 0x00,
+  0x31, 0x00, 0x3e, 0x00, 0x54, 0x00, 0x5f, 0x00, 0x68, 0x00, 0x73, 0x00,
+  0x7d, 0x00, 0x88, 0x00, 0x92, 0x00, 0x9d, 0x00, 0xa6, 0x00, 0xb0, 0x00,
+  0xb9, 0x00, 0x00, 0x00, 0x13, 0x00, 0x26, 0x00, 0x33, 0x00, 0x40, 0x00,
+  0x4a, 0x00, 0x54, 0x00, 0x5f, 0x00, 0x69, 0x00, 0x75, 0x00, 0x7f, 0x00,
+  0x8a, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x1a, 0x00, 0x27, 0x00, 0x3d, 0x00,
+  0x56, 0x00, 0x61, 0x00, 0x6a, 0x00, 0x73, 0x00, 0x7c, 0x00, 0x87, 0x00,
+  0x90, 0x00, 0x9b, 0x00, 0xa5, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x20, 0x00,
+  0x2d, 0x00, 0x3a, 0x00, 0x50, 0x00, 0x5a, 0x00, 0x63, 0x00, 0x6e, 0x00,
+  0x78, 0x00, 0x81, 0x00, 0x8b, 0x00, 0x96, 0x00, 0x9f, 0x00, 0xa8, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x1a, 0x00, 0x33, 0x00, 0x40, 0x00, 0x4b, 0x00,
+  0x55, 0x00, 0x60, 0x00, 0x69, 0x00, 0x73, 0x00, 0x7d, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x20, 0x00, 0x30, 0x00, 0x3d, 0x00, 0x49, 0x00, 0x52, 0x00,
+  0x5b, 0x00, 0x67, 0x00, 0x72, 0x00, 0x7e, 0x00, 0x89, 0x00, 0x93, 0x00,
+  0x9e, 0x00, 0x00, 0x00, 0x13, 0x00, 0x20, 0x00, 0x2d, 0x00, 0x3d, 0x00,
+  0x50, 0x00, 0x59, 0x00, 0x63, 0x00, 0x6e, 0x00, 0x79, 0x00, 0x82, 0x00,
+  0x00, 0x00, 0x13, 0x00, 0x26, 0x00, 0x3f, 0x00, 0x4f, 0x00, 0x5f, 0x00,
+  0x6a, 0x00, 0x75, 0x00, 0x80, 0x00, 0x8b, 0x00, 0x97, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x1a, 0x00, 0x2a, 0x00, 0x34, 0x00, 0x3f, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x1a, 0x00, 0x2d, 0x00, 0x3d, 0x00, 0x47, 0x00, 0x52, 0x00,
+  0x5d, 0x00, 0x67, 0x00, 0x70, 0x00, 0x00, 0x00, 0x17, 0x00, 0x27, 0x00,
+  0x3a, 0x00, 0x47, 0x00, 0x51, 0x00, 0x5c, 0x00, 0x66, 0x00, 0x70, 0x00,
+  0x79, 0x00, 0x83, 0x00, 0x8e, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x27, 0x00,
+  0x34, 0x00, 0x3e, 0x00, 0x48, 0x00, 0x54, 0x00, 0x5e, 0x00, 0x67, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x20, 0x00, 0x33, 0x00, 0x3e, 0x00, 0x00, 0x00,
+  0x1f, 0x00, 0x29, 0x00, 0x3c, 0x00, 0x45, 0x00, 0x4f, 0x00, 0x5a, 0x00,
+  0x64, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x3f, 0x00, 0x5b, 0x00,
+  0x71, 0x00, 0x7b, 0x00, 0x85, 0x00, 0x8e, 0x00, 0x99, 0x00, 0xa3, 0x00,
+  0xae, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x4b, 0x00, 0x58, 0x00, 0x68, 0x00,
+  0x73, 0x00, 0x7d, 0x00, 0x87, 0x00, 0x91, 0x00, 0x00, 0x00, 0x13, 0x00,
+  0x20, 0x00, 0x30, 0x00, 0x46, 0x00, 0x51, 0x00, 0x5b, 0x00, 0x66, 0x00,
+  0x70, 0x00, 0x7c, 0x00, 0x87, 0x00, 0x91, 0x00, 0x9a, 0x00, 0xa5, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x23, 0x00, 0x36, 0x00, 0x4c, 0x00, 0x56, 0x00,
+  0x61, 0x00, 0x00, 0x00, 0x13, 0x00, 0x20, 0x00, 0x33, 0x00, 0x49, 0x00,
+  0x52, 0x00, 0x5b, 0x00, 0x65, 0x00, 0x70, 0x00, 0x00, 0x00, 0x17, 0x00,
+  0x2a, 0x00, 0x37, 0x00, 0x44, 0x00, 0x54, 0x00, 0x6a, 0x00, 0x75, 0x00,
+  0x7f, 0x00, 0x89, 0x00, 0x92, 0x00, 0x9c, 0x00, 0xa8, 0x00, 0xb1, 0x00,
+  0x00, 0x00, 0x13, 0x00, 0x20, 0x00, 0x2b, 0x00, 0x35, 0x00, 0x40, 0x00,
+  0x4b, 0x00, 0x56, 0x00, 0x61, 0x00, 0x6a, 0x00, 0x00, 0x00, 0x13, 0x00,
+  0x20, 0x00, 0x2c, 0x00, 0x37, 0x00, 0x42, 0x00, 0x4b, 0x00, 0x00, 0x00,
+  0x1f, 0x00, 0x32, 0x00, 0x3f, 0x00, 0x4a, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x23, 0x00, 0x30, 0x00, 0x3c, 0x00, 0x47, 0x00, 0x52, 0x00, 0x5b, 0x00,
+  0x00, 0x00, 0x13, 0x00, 0x20, 0x00, 0x2d, 0x00, 0x38, 0x00, 0x41, 0x00,
+  0x4d, 0x00, 0x57, 0x00, 0x60, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x17, 0x00,
+  0x22, 0x00, 0x2c, 0x00, 0x35, 0x00, 0x3f, 0x00, 0x4a, 0x00, 0x54, 0x00,
+  0x00, 0x00, 0x13, 0x00, 0x20, 0x00, 0x30, 0x00, 0x3b, 0x00, 0x45, 0x00,
+  0x50, 0x00, 0x5c, 0x00, 0x66, 0x00, 0x71, 0x00, 0x7d, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x1a, 0x00, 0x25, 0x00, 0x2e, 0x00, 0x39, 0x00, 0x43, 0x00,
+  0x4e, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x1a, 0x00, 0x23, 0x00, 0x2e, 0x00,
+  0x37, 0x00, 0x41, 0x00, 0x4a, 0x00, 0x54, 0x00, 0x5e, 0x00, 0x67, 0x00,
+  0x00, 0x00, 0x19, 0x00, 0x26, 0x00, 0x31, 0x00, 0x3a, 0x00, 0x46, 0x00,
+  0x50, 0x00, 0x5a, 0x00, 0x65, 0x00, 0x70, 0x00, 0x7b, 0x00, 0x00, 0x00,
+  0x19, 0x00, 0x2c, 0x00, 0x37, 0x00, 0x41, 0x00, 0x4c, 0x00, 0x56, 0x00,
+  0x00, 0x00, 0x13, 0x00, 0x20, 0x00, 0x30, 0x00, 0x3b, 0x00, 0x45, 0x00,
+  0x4e, 0x00, 0x58, 0x00, 0x00, 0x00, 0x13, 0x00, 0x29, 0x00, 0x33, 0x00,
+  0x3d, 0x00, 0x47, 0x00, 0x51, 0x00, 0x5b, 0x00, 0x65, 0x00, 0x6f, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x1d, 0x00, 0x27, 0x00, 0x31, 0x00, 0x3b, 0x00,
+  0x45, 0x00, 0x4f, 0x00, 0x59, 0x00, 0x63, 0x00, 0x6c, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x1d, 0x00, 0x2d, 0x00, 0x38, 0x00, 0x41, 0x00, 0x4c, 0x00,
+  0x57, 0x00, 0x60, 0x00, 0x69, 0x00, 0x74, 0x00, 0x7f, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x26, 0x00, 0x39, 0x00, 0x4c, 0x00, 0x5f, 0x00, 0x72, 0x00,
+  0x85, 0x00, 0x98, 0x00, 0xab, 0x00, 0xc1, 0x00, 0xdd, 0x00, 0xea, 0x00,
+  0xf4, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x1a, 0x00, 0x23, 0x00,
+  0x2d, 0x00, 0x38, 0x00, 0x43, 0x00, 0x4d, 0x00, 0x00, 0x00, 0x13, 0x00,
+  0x20, 0x00, 0x2b, 0x00, 0x34, 0x00, 0x3e, 0x00, 0x48, 0x00, 0x52, 0x00,
+  0x5d, 0x00, 0x00, 0x00, 0x10, 0x00, 0x1d, 0x00, 0x30, 0x00, 0x39, 0x00,
+  0x44, 0x00, 0x4f, 0x00, 0x58, 0x00, 0x62, 0x00, 0x00, 0x00, 0x0d, 0x00,
+  0x1d, 0x00, 0x30, 0x00, 0x43, 0x00, 0x4c, 0x00, 0x56, 0x00, 0x61, 0x00,
+  0x00, 0x00, 0x16, 0x00, 0x21, 0x00, 0x2a, 0x00, 0x35, 0x00, 0x3f, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x1a, 0x00, 0x24, 0x00, 0x2f, 0x00, 0x00, 0x00,
+  0x1a, 0x00, 0x27, 0x00, 0x3a, 0x00, 0x44, 0x00, 0x4e, 0x00, 0x59, 0x00,
+  0x64, 0x00, 0x6d, 0x00, 0x78, 0x00, 0x83, 0x00, 0x8d, 0x00, 0x98, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x1d, 0x00, 0x27, 0x00, 0x30, 0x00, 0x39, 0x00,
+  0x44, 0x00, 0x4e, 0x00, 0x58, 0x00, 0x00, 0x00, 0x19, 0x00, 0x24, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x16, 0x00, 0x21, 0x00, 0x2a, 0x00, 0x35, 0x00,
+  0x40, 0x00, 0x4b, 0x00, 0x56, 0x00, 0x63, 0x00, 0x00, 0x00, 0x13, 0x00,
+  0x1f, 0x00, 0x28, 0x00, 0x31, 0x00, 0x3b, 0x00, 0x46, 0x00, 0x52, 0x00,
+  0x00, 0x00, 0x13, 0x00, 0x1c, 0x00, 0x25, 0x00, 0x30, 0x00, 0x39, 0x00,
+  0x43, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x1a, 0x00, 0x30, 0x00, 0x3a, 0x00,
+  0x44, 0x00, 0x4d, 0x00, 0x57, 0x00, 0x64, 0x00, 0x70, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x20, 0x00, 0x2a, 0x00, 0x35, 0x00, 0x3e, 0x00, 0x47, 0x00,
+  0x50, 0x00, 0x5a, 0x00, 0x65, 0x00, 0x00, 0x00, 0x10, 0x00, 0x2c, 0x00,
+  0x35, 0x00, 0x3f, 0x00, 0x49, 0x00, 0x52, 0x00, 0x00, 0x00, 0x0d, 0x00,
+  0x1d, 0x00, 0x33, 0x00, 0x3c, 0x00, 0x46, 0x00, 0x4f, 0x00, 0x5a, 0x00,
+  0x64, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x26, 0x00, 0x3c, 0x00, 0x45, 0x00,
+  0x4f, 0x00, 0x5a, 0x00, 0x65, 0x00, 0x70, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x20, 0x00, 0x36, 0x00, 0x3f, 0x00, 0x49, 0x00, 0x52, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x23, 0x00, 0x36, 0x00, 0x3f, 0x00, 0x4a, 0x00, 0x53, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x1d, 0x00, 0x33, 0x00, 0x3e, 0x00, 0x48, 0x00,
+  0x51, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x17, 0x00, 0x21, 0x00, 0x2a, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x16, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x15, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x15, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x15, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x14, 0x00,
+  0x00, 0x00, 0x1a, 0x00, 0x24, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x0b, 0x00,
+  0x14, 0x00, 0x1e, 0x00, 0x28, 0x00, 0x32, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x1a, 0x00, 0x24, 0x00, 0x00, 0x00, 0x17, 0x00, 0x24, 0x00, 0x2f, 0x00,
+  0x38, 0x00, 0x41, 0x00, 0x4a, 0x00, 0x55, 0x00, 0x60, 0x00, 0x00, 0x00,
+  0x17, 0x00, 0x24, 0x00, 0x2f, 0x00, 0x39, 0x00, 0x44, 0x00, 0x4e, 0x00,
+  0x57, 0x00, 0x5f, 0x00, 0x69, 0x00, 0x00, 0x00, 0x17, 0x00, 0x2a, 0x00,
+  0x3d, 0x00, 0x50, 0x00, 0x63, 0x00, 0x6e, 0x00, 0x77, 0x00, 0x82, 0x00,
+  0x8b, 0x00, 0x96, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x18, 0x00,
+  0x23, 0x00, 0x2c, 0x00, 0x37, 0x00, 0x41, 0x00, 0x00, 0x00, 0x0d, 0x00,
+  0x17, 0x00, 0x21, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x19, 0x00,
+  0x24, 0x00, 0x2d, 0x00, 0x36, 0x00, 0x40, 0x00, 0x4a, 0x00, 0x55, 0x00,
+  0x5e, 0x00, 0x00, 0x00, 0x10, 0x00, 0x19, 0x00, 0x22, 0x00, 0x2b, 0x00,
+  0x34, 0x00, 0x3e, 0x00, 0x48, 0x00, 0x54, 0x00, 0x5e, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x1d, 0x00, 0x26, 0x00, 0x30, 0x00, 0x3b, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x19, 0x00, 0x23, 0x00, 0x2c, 0x00, 0x37, 0x00, 0x42, 0x00,
+  0x4d, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x17, 0x00, 0x22, 0x00, 0x2c, 0x00,
+  0x36, 0x00, 0x40, 0x00, 0x4b, 0x00, 0x54, 0x00, 0x5d, 0x00, 0x68, 0x00,
+  0x71, 0x00, 0x7b, 0x00, 0x85, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x17, 0x00,
+  0x22, 0x00, 0x2b, 0x00, 0x34, 0x00, 0x40, 0x00, 0x4a, 0x00, 0x55, 0x00,
+  0x5e, 0x00, 0x68, 0x00, 0x00, 0x00, 0x19, 0x00, 0x26, 0x00, 0x2f, 0x00,
+  0x38, 0x00, 0x42, 0x00, 0x4c, 0x00, 0x57, 0x00, 0x61, 0x00, 0x6a, 0x00,
+  0x73, 0x00, 0x7d, 0x00, 0x86, 0x00, 0x8f, 0x00, 0x99, 0x00, 0xa4, 0x00,
+  0xb1, 0x00, 0xba, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x15, 0x00, 0x1f, 0x00,
+  0x28, 0x00, 0x31, 0x00, 0x3a, 0x00, 0x46, 0x00, 0x51, 0x00, 0x00, 0x00,
+  0x19, 0x00, 0x3e, 0x00, 0x4b, 0x00, 0x55, 0x00, 0x5f, 0x00, 0x6b, 0x00,
+  0x77, 0x00, 0x00, 0x00, 0x19, 0x00, 0x29, 0x00, 0x32, 0x00, 0x3b, 0x00,
+  0x45, 0x00, 0x4f, 0x00, 0x59, 0x00, 0x62, 0x00, 0x6b, 0x00, 0x75, 0x00,
+  0x7e, 0x00, 0x00, 0x00, 0x19, 0x00, 0x41, 0x00, 0x4e, 0x00, 0x5a, 0x00,
+  0x64, 0x00, 0x6d, 0x00, 0x76, 0x00, 0x7f, 0x00, 0x89, 0x00, 0x93, 0x00,
+  0x9d, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x38, 0x00, 0x42, 0x00, 0x4b, 0x00,
+  0x56, 0x00, 0x5f, 0x00, 0x68, 0x00, 0x71, 0x00, 0x7a, 0x00, 0x83, 0x00,
+  0x8d, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x3b, 0x00, 0x4e, 0x00, 0x59, 0x00,
+  0x63, 0x00, 0x6d, 0x00, 0x00, 0x00, 0x16, 0x00, 0x2f, 0x00, 0x3c, 0x00,
+  0x47, 0x00, 0x51, 0x00, 0x5b, 0x00, 0x64, 0x00, 0x6e, 0x00, 0x00, 0x00,
+  0x19, 0x00, 0x32, 0x00, 0x3b, 0x00, 0x44, 0x00, 0x50, 0x00, 0x5a, 0x00,
+  0x63, 0x00, 0x6d, 0x00, 0x78, 0x00, 0x83, 0x00, 0x8c, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x17, 0x00, 0x21, 0x00, 0x2a, 0x00, 0x33, 0x00, 0x3e, 0x00,
+  0x47, 0x00, 0x51, 0x00, 0x5d, 0x00, 0x66, 0x00, 0x6f, 0x00, 0x00, 0x00,
+  0x25, 0x00, 0x3e, 0x00, 0x4b, 0x00, 0x56, 0x00, 0x5f, 0x00, 0x68, 0x00,
+  0x72, 0x00, 0x7f, 0x00, 0x88, 0x00, 0x94, 0x00, 0x9e, 0x00, 0xa7, 0x00,
+  0xb2, 0x00, 0x00, 0x00, 0x14, 0x00, 0x2d, 0x00, 0x43, 0x00, 0x50, 0x00,
+  0x60, 0x00, 0x73, 0x00, 0x7d, 0x00, 0x88, 0x00, 0x93, 0x00, 0x9d, 0x00,
+  0xa7, 0x00, 0xb0, 0x00, 0xbb, 0x00, 0xc4, 0x00, 0xcd, 0x00, 0x00, 0x00,
+  0x28, 0x00, 0x41, 0x00, 0x5d, 0x00, 0x6a, 0x00, 0x74, 0x00, 0x81, 0x00,
+  0x8a, 0x00, 0x94, 0x00, 0x9f, 0x00, 0xaa, 0x00, 0xb3, 0x00, 0x00, 0x00,
+  0x19, 0x00, 0x38, 0x00, 0x45, 0x00, 0x55, 0x00, 0x62, 0x00, 0x6d, 0x00,
+  0x78, 0x00, 0x81, 0x00, 0x8c, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x29, 0x00,
+  0x36, 0x00, 0x41, 0x00, 0x4a, 0x00, 0x54, 0x00, 0x5f, 0x00, 0x69, 0x00,
+  0x00, 0x00, 0x25, 0x00, 0x32, 0x00, 0x3f, 0x00, 0x4c, 0x00, 0x55, 0x00,
+  0x60, 0x00, 0x6a, 0x00, 0x75, 0x00, 0x7e, 0x00, 0x89, 0x00, 0x00, 0x00,
+  0x16, 0x00, 0x23, 0x00, 0x30, 0x00, 0x40, 0x00, 0x4a, 0x00, 0x54, 0x00,
+  0x5e, 0x00, 0x69, 0x00, 0x72, 0x00, 0x7d, 0x00, 0x87, 0x00, 0x90, 0x00,
+  0x00, 0x00, 0x0a, 0x00, 0x1a, 0x00, 0x27, 0x00, 0x30, 0x00, 0x3a, 0x00,
+  0x44, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x13, 0x00, 0x20, 0x00, 0x30, 0x00,
+  0x39, 0x00, 0x44, 0x00, 0x4f, 0x00, 0x59, 0x00, 0x65, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x17, 0x00, 0x20, 0x00, 0x2a, 0x00, 0x35, 0x00, 0x3e, 0x00,
+  0x47, 0x00, 0x50, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x17, 0x00, 0x21, 0x00,
+  0x2a, 0x00, 0x33, 0x00, 0x3c, 0x00, 0x46, 0x00, 0x51, 0x00, 0x5c, 0x00,
+  0x65, 0x00, 0x70, 0x00, 0x00, 0x00, 0x19, 0x00, 0x2c, 0x00, 0x39, 0x00,
+  0x43, 0x00, 0x4d, 0x00, 0x59, 0x00, 0x64, 0x00, 0x6f, 0x00, 0x00, 0x00,
+  0x25, 0x00, 0x32, 0x00, 0x45, 0x00, 0x50, 0x00, 0x5b, 0x00, 0x64, 0x00,
+  0x00, 0x00, 0x13, 0x00, 0x1e, 0x00, 0x27, 0x00, 0x32, 0x00, 0x3d, 0x00,
+  0x47, 0x00, 0x00, 0x00, 0x19, 0x00, 0x32, 0x00, 0x3c, 0x00, 0x47, 0x00,
+  0x52, 0x00, 0x5b, 0x00, 0x65, 0x00, 0x6f, 0x00, 0x7a, 0x00, 0x84, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x1a, 0x00, 0x23, 0x00, 0x2d, 0x00, 0x36, 0x00,
+  0x40, 0x00, 0x49, 0x00, 0x55, 0x00, 0x60, 0x00, 0x6a, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x16, 0x00, 0x21, 0x00, 0x2c, 0x00, 0x35, 0x00, 0x40, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x1d, 0x00, 0x30, 0x00, 0x49, 0x00, 0x52, 0x00,
+  0x5d, 0x00, 0x67, 0x00, 0x70, 0x00, 0x7a, 0x00, 0x82, 0x00, 0x00, 0x00,
+  0x19, 0x00, 0x26, 0x00, 0x36, 0x00, 0x46, 0x00, 0x53, 0x00, 0x5c, 0x00,
+  0x66, 0x00, 0x70, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x1a, 0x00, 0x27, 0x00,
+  0x37, 0x00, 0x43, 0x00, 0x4e, 0x00, 0x57, 0x00, 0x61, 0x00, 0x6b, 0x00,
+  0x76, 0x00, 0x00, 0x00, 0x17, 0x00, 0x2a, 0x00, 0x34, 0x00, 0x47, 0x00,
+  0x5a, 0x00, 0x63, 0x00, 0x6d, 0x00, 0x77, 0x00, 0x81, 0x00, 0x8c, 0x00,
+  0x97, 0x00, 0xa1, 0x00, 0xad, 0x00, 0xb8, 0x00, 0xc1, 0x00, 0x00, 0x00,
+  0x19, 0x00, 0x26, 0x00, 0x33, 0x00, 0x43, 0x00, 0x53, 0x00, 0x5c, 0x00,
+  0x66, 0x00, 0x71, 0x00, 0x7b, 0x00, 0x87, 0x00, 0x90, 0x00, 0x9a, 0x00,
+  0xa3, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x38, 0x00, 0x45, 0x00, 0x55, 0x00,
+  0x62, 0x00, 0x6f, 0x00, 0x7a, 0x00, 0x85, 0x00, 0x8f, 0x00, 0x9a, 0x00,
+  0xa5, 0x00, 0xae, 0x00, 0x00, 0x00, 0x19, 0x00, 0x2f, 0x00, 0x45, 0x00,
+  0x55, 0x00, 0x65, 0x00, 0x72, 0x00, 0x7f, 0x00, 0x89, 0x00, 0x93, 0x00,
+  0x9e, 0x00, 0xa9, 0x00, 0xb2, 0x00, 0xbc, 0x00, 0xc6, 0x00, 0xd1, 0x00,
+  0x00, 0x00, 0x22, 0x00, 0x3b, 0x00, 0x5d, 0x00, 0x7c, 0x00, 0x89, 0x00,
+  0x96, 0x00, 0xa9, 0x00, 0xb9, 0x00, 0xc3, 0x00, 0xcd, 0x00, 0xd7, 0x00,
+  0xe2, 0x00, 0xec, 0x00, 0xf7, 0x00, 0x03, 0x01, 0x0d, 0x01, 0x17, 0x01,
+  0x00, 0x00, 0x1f, 0x00, 0x3e, 0x00, 0x4e, 0x00, 0x5b, 0x00, 0x68, 0x00,
+  0x7e, 0x00, 0x88, 0x00, 0x91, 0x00, 0x9d, 0x00, 0xa8, 0x00, 0xb3, 0x00,
+  0xbf, 0x00, 0xc9, 0x00, 0xd3, 0x00, 0xdd, 0x00, 0x00, 0x00, 0x19, 0x00,
+  0x35, 0x00, 0x4b, 0x00, 0x58, 0x00, 0x6b, 0x00, 0x78, 0x00, 0x8e, 0x00,
+  0x99, 0x00, 0xa4, 0x00, 0xad, 0x00, 0xb7, 0x00, 0xc2, 0x00, 0xce, 0x00,
+  0x00, 0x00, 0x1c, 0x00, 0x3b, 0x00, 0x48, 0x00, 0x58, 0x00, 0x68, 0x00,
+  0x7e, 0x00, 0x89, 0x00, 0x94, 0x00, 0x9d, 0x00, 0xa8, 0x00, 0x00, 0x00,
+  0x16, 0x00, 0x41, 0x00, 0x5d, 0x00, 0x6a, 0x00, 0x7d, 0x00, 0x8a, 0x00,
+  0x93, 0x00, 0x9e, 0x00, 0xa9, 0x00, 0xb3, 0x00, 0xbe, 0x00, 0xc9, 0x00,
+  0x00, 0x00, 0x22, 0x00, 0x3e, 0x00, 0x54, 0x00, 0x73, 0x00, 0x86, 0x00,
+  0x93, 0x00, 0x9d, 0x00, 0xb3, 0x00, 0xbd, 0x00, 0xc7, 0x00, 0xd1, 0x00,
+  0xdc, 0x00, 0xe8, 0x00, 0xf3, 0x00, 0xfc, 0x00, 0x05, 0x01, 0x10, 0x01,
+  0x19, 0x01, 0x00, 0x00, 0x2e, 0x00, 0x44, 0x00, 0x63, 0x00, 0x79, 0x00,
+  0x86, 0x00, 0x96, 0x00, 0xac, 0x00, 0xb6, 0x00, 0xc0, 0x00, 0xcb, 0x00,
+  0xd5, 0x00, 0xe0, 0x00, 0xeb, 0x00, 0xf7, 0x00, 0x03, 0x01, 0x0d, 0x01,
+  0x16, 0x01, 0x00, 0x00, 0x16, 0x00, 0x32, 0x00, 0x51, 0x00, 0x6a, 0x00,
+  0x7a, 0x00, 0x87, 0x00, 0x94, 0x00, 0x9d, 0x00, 0xa9, 0x00, 0xb4, 0x00,
+  0xbf, 0x00, 0xca, 0x00, 0xd5, 0x00, 0xde, 0x00, 0xe8, 0x00, 0xf3, 0x00,
+  0x00, 0x00, 0x1c, 0x00, 0x41, 0x00, 0x5d, 0x00, 0x73, 0x00, 0x7d, 0x00,
+  0x90, 0x00, 0xa6, 0x00, 0xb1, 0x00, 0xbd, 0x00, 0xc7, 0x00, 0xd0, 0x00,
+  0xda, 0x00, 0xe3, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x38, 0x00, 0x51, 0x00,
+  0x67, 0x00, 0x77, 0x00, 0x84, 0x00, 0x8f, 0x00, 0x99, 0x00, 0xa2, 0x00,
+  0xac, 0x00, 0xb5, 0x00, 0xc0, 0x00, 0xcc, 0x00, 0x00, 0x00, 0x2e, 0x00,
+  0x47, 0x00, 0x63, 0x00, 0x7c, 0x00, 0x89, 0x00, 0x96, 0x00, 0xa9, 0x00,
+  0xc2, 0x00, 0xcd, 0x00, 0xd7, 0x00, 0xe1, 0x00, 0xec, 0x00, 0xf6, 0x00,
+  0x00, 0x00, 0x19, 0x00, 0x2f, 0x00, 0x3c, 0x00, 0x46, 0x00, 0x59, 0x00,
+  0x63, 0x00, 0x6d, 0x00, 0x77, 0x00, 0x82, 0x00, 0x8b, 0x00, 0x95, 0x00,
+  0x9f, 0x00, 0xaa, 0x00, 0xb3, 0x00, 0xbe, 0x00, 0xc7, 0x00, 0x00, 0x00,
+  0x2b, 0x00, 0x41, 0x00, 0x5d, 0x00, 0x6a, 0x00, 0x77, 0x00, 0x84, 0x00,
+  0x8d, 0x00, 0x98, 0x00, 0xa2, 0x00, 0xab, 0x00, 0xb7, 0x00, 0x00, 0x00,
+  0x22, 0x00, 0x41, 0x00, 0x5d, 0x00, 0x6d, 0x00, 0x7a, 0x00, 0x83, 0x00,
+  0x8e, 0x00, 0x97, 0x00, 0xa0, 0x00, 0xab, 0x00, 0x00, 0x00, 0x19, 0x00,
+  0x26, 0x00, 0x36, 0x00, 0x49, 0x00, 0x52, 0x00, 0x5c, 0x00, 0x67, 0x00,
+  0x72, 0x00, 0x7b, 0x00, 0x86, 0x00, 0x91, 0x00, 0x9b, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x2c, 0x00, 0x3c, 0x00, 0x58, 0x00, 0x62, 0x00, 0x6d, 0x00,
+  0x77, 0x00, 0x82, 0x00, 0x8b, 0x00, 0x97, 0x00, 0xa0, 0x00, 0xa9, 0x00,
+  0xb3, 0x00, 0xbc, 0x00, 0x00, 0x00, 0x19, 0x00, 0x23, 0x00, 0x33, 0x00,
+  0x40, 0x00, 0x4b, 0x00, 0x54, 0x00, 0x5e, 0x00, 0x67, 0x00, 0x73, 0x00,
+  0x7c, 0x00, 0x87, 0x00, 0x93, 0x00, 0x9c, 0x00, 0xa7, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x1a, 0x00, 0x2d, 0x00, 0x40, 0x00, 0x49, 0x00, 0x53, 0x00,
+  0x5d, 0x00, 0x67, 0x00, 0x72, 0x00, 0x7b, 0x00, 0x87, 0x00, 0x92, 0x00,
+  0x9d, 0x00, 0xa6, 0x00, 0x00, 0x00, 0x19, 0x00, 0x35, 0x00, 0x45, 0x00,
+  0x52, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x77, 0x00, 0x81, 0x00, 0x8a, 0x00,
+  0x95, 0x00, 0x9f, 0x00, 0xa9, 0x00, 0xb4, 0x00, 0x00, 0x00, 0x19, 0x00,
+  0x2f, 0x00, 0x48, 0x00, 0x55, 0x00, 0x65, 0x00, 0x78, 0x00, 0x81, 0x00,
+  0x8a, 0x00, 0x94, 0x00, 0x9d, 0x00, 0xa6, 0x00, 0xb1, 0x00, 0xba, 0x00,
+  0x00, 0x00, 0x16, 0x00, 0x2c, 0x00, 0x4b, 0x00, 0x55, 0x00, 0x62, 0x00,
+  0x75, 0x00, 0x88, 0x00, 0x92, 0x00, 0x9d, 0x00, 0xa7, 0x00, 0xb1, 0x00,
+  0xbb, 0x00, 0xc5, 0x00, 0xd0, 0x00, 0xd9, 0x00, 0xe2, 0x00, 0xec, 0x00,
+  0x00, 0x00, 0x16, 0x00, 0x32, 0x00, 0x3f, 0x00, 0x4c, 0x00, 0x5c, 0x00,
+  0x67, 0x00, 0x71, 0x00, 0x7c, 0x00, 0x85, 0x00, 0x8f, 0x00, 0x99, 0x00,
+  0xa3, 0x00, 0xad, 0x00, 0xb8, 0x00, 0xc3, 0x00, 0x00, 0x00, 0x16, 0x00,
+  0x2f, 0x00, 0x5d, 0x00, 0x6a, 0x00, 0x77, 0x00, 0x84, 0x00, 0x91, 0x00,
+  0x9b, 0x00, 0xa5, 0x00, 0xb0, 0x00, 0xba, 0x00, 0xc5, 0x00, 0xd1, 0x00,
+  0xdb, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x1a, 0x00, 0x2a, 0x00, 0x37, 0x00,
+  0x41, 0x00, 0x4d, 0x00, 0x56, 0x00, 0x61, 0x00, 0x6c, 0x00, 0x78, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x1a, 0x00, 0x2d, 0x00, 0x49, 0x00, 0x56, 0x00,
+  0x61, 0x00, 0x6c, 0x00, 0x77, 0x00, 0x82, 0x00, 0x8b, 0x00, 0x95, 0x00,
+  0xa1, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x1a, 0x00, 0x26, 0x00, 0x30, 0x00,
+  0x39, 0x00, 0x44, 0x00, 0x4e, 0x00, 0x59, 0x00, 0x62, 0x00, 0x6d, 0x00,
+  0x76, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x17, 0x00, 0x21, 0x00, 0x2e, 0x00,
+  0x38, 0x00, 0x43, 0x00, 0x4c, 0x00, 0x58, 0x00, 0x63, 0x00, 0x6c, 0x00,
+  0x78, 0x00, 0x81, 0x00, 0x8b, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x1a, 0x00,
+  0x25, 0x00, 0x2e, 0x00, 0x37, 0x00, 0x40, 0x00, 0x49, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x1d, 0x00, 0x27, 0x00, 0x30, 0x00, 0x3a, 0x00, 0x45, 0x00,
+  0x00, 0x00, 0x16, 0x00, 0x2c, 0x00, 0x45, 0x00, 0x52, 0x00, 0x5c, 0x00,
+  0x65, 0x00, 0x6f, 0x00, 0x7a, 0x00, 0x84, 0x00, 0x8d, 0x00, 0x00, 0x00,
+  0x16, 0x00, 0x2f, 0x00, 0x3c, 0x00, 0x46, 0x00, 0x50, 0x00, 0x59, 0x00,
+  0x63, 0x00, 0x6d, 0x00, 0x7a, 0x00, 0x84, 0x00, 0x90, 0x00, 0x9a, 0x00,
+  0xa3, 0x00, 0xad, 0x00, 0x00, 0x00, 0x16, 0x00, 0x23, 0x00, 0x2d, 0x00,
+  0x36, 0x00, 0x40, 0x00, 0x49, 0x00, 0x53, 0x00, 0x5e, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x26, 0x00, 0x33, 0x00, 0x3c, 0x00, 0x45, 0x00, 0x50, 0x00,
+  0x5b, 0x00, 0x64, 0x00, 0x6e, 0x00, 0x78, 0x00, 0x82, 0x00, 0x00, 0x00,
+  0x1f, 0x00, 0x2f, 0x00, 0x39, 0x00, 0x43, 0x00, 0x4c, 0x00, 0x56, 0x00,
+  0x60, 0x00, 0x6b, 0x00, 0x75, 0x00, 0x7e, 0x00, 0x87, 0x00, 0x90, 0x00,
+  0x00, 0x00, 0x19, 0x00, 0x32, 0x00, 0x3f, 0x00, 0x52, 0x00, 0x5c, 0x00,
+  0x67, 0x00, 0x70, 0x00, 0x79, 0x00, 0x82, 0x00, 0x8d, 0x00, 0x98, 0x00,
+  0xa1, 0x00, 0xab, 0x00, 0xb5, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x1c, 0x00,
+  0x26, 0x00, 0x39, 0x00, 0x42, 0x00, 0x00, 0x00, 0x10, 0x00, 0x20, 0x00,
+  0x2a, 0x00, 0x34, 0x00, 0x3e, 0x00, 0x48, 0x00, 0x53, 0x00, 0x5c, 0x00,
+  0x00, 0x00, 0x16, 0x00, 0x2c, 0x00, 0x3f, 0x00, 0x49, 0x00, 0x54, 0x00,
+  0x5e, 0x00, 0x6b, 0x00, 0x75, 0x00, 0x80, 0x00, 0x8b, 0x00, 0x95, 0x00,
+  0x9f, 0x00, 0xa9, 0x00, 0x00, 0x00, 0x22, 0x00, 0x2f, 0x00, 0x3c, 0x00,
+  0x46, 0x00, 0x50, 0x00, 0x59, 0x00, 0x64, 0x00, 0x6e, 0x00, 0x78, 0x00,
+  0x83, 0x00, 0x00, 0x00, 0x16, 0x00, 0x20, 0x00, 0x2d, 0x00, 0x37, 0x00,
+  0x40, 0x00, 0x4c, 0x00, 0x56, 0x00, 0x60, 0x00, 0x6b, 0x00, 0x00, 0x00,
+  0x16, 0x00, 0x32, 0x00, 0x4e, 0x00, 0x5e, 0x00, 0x71, 0x00, 0x7a, 0x00,
+  0x83, 0x00, 0x8d, 0x00, 0x00, 0x00, 0x16, 0x00, 0x20, 0x00, 0x2a, 0x00,
+  0x34, 0x00, 0x3f, 0x00, 0x49, 0x00, 0x00, 0x00, 0x19, 0x00, 0x3b, 0x00,
+  0x54, 0x00, 0x5f, 0x00, 0x69, 0x00, 0x73, 0x00, 0x00, 0x00, 0x1f, 0x00,
+  0x28, 0x00, 0x32, 0x00, 0x3b, 0x00, 0x44, 0x00, 0x4d, 0x00, 0x56, 0x00,
+  0x60, 0x00, 0x69, 0x00, 0x74, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x1f, 0x00,
+  0x2a, 0x00, 0x34, 0x00, 0x3f, 0x00, 0x48, 0x00, 0x51, 0x00, 0x00, 0x00,
+  0x16, 0x00, 0x2f, 0x00, 0x3b, 0x00, 0x44, 0x00, 0x4e, 0x00, 0x00, 0x00,
+  0x19, 0x00, 0x35, 0x00, 0x51, 0x00, 0x5a, 0x00, 0x65, 0x00, 0x70, 0x00,
+  0x7b, 0x00, 0x85, 0x00, 0x90, 0x00, 0x9b, 0x00, 0xa4, 0x00, 0xad, 0x00,
+  0xb6, 0x00, 0x00, 0x00, 0x19, 0x00, 0x22, 0x00, 0x2d, 0x00, 0x37, 0x00,
+  0x40, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x38, 0x00, 0x54, 0x00,
+  0x5e, 0x00, 0x68, 0x00, 0x72, 0x00, 0x7b, 0x00, 0x00, 0x00, 0x19, 0x00,
+  0x32, 0x00, 0x3b, 0x00, 0x46, 0x00, 0x50, 0x00, 0x5a, 0x00, 0x65, 0x00,
+  0x70, 0x00, 0x79, 0x00, 0x00, 0x00, 0x16, 0x00, 0x2c, 0x00, 0x38, 0x00,
+  0x41, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x32, 0x00, 0x48, 0x00, 0x52, 0x00,
+  0x5b, 0x00, 0x64, 0x00, 0x6f, 0x00, 0x00, 0x00, 0x31, 0x00, 0x4a, 0x00,
+  0x5d, 0x00, 0x66, 0x00, 0x71, 0x00, 0x7c, 0x00, 0x85, 0x00, 0x90, 0x00,
+  0x9a, 0x00, 0xa4, 0x00, 0xae, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x15, 0x00,
+  0x1f, 0x00, 0x2a, 0x00, 0x34, 0x00, 0x40, 0x00, 0x4c, 0x00, 0x55, 0x00,
+  0x5f, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x15, 0x00, 0x1f, 0x00, 0x28, 0x00,
+  0x32, 0x00, 0x3d, 0x00, 0x47, 0x00, 0x51, 0x00, 0x00, 0x00, 0x0a, 0x00,
+  0x16, 0x00, 0x20, 0x00, 0x2c, 0x00, 0x35, 0x00, 0x3f, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x14, 0x00, 0x1e, 0x00, 0x29, 0x00, 0x32, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x15, 0x00, 0x1e, 0x00, 0x28, 0x00, 0x33, 0x00, 0x3c, 0x00,
+  0x00, 0x00, 0x0a, 0x00, 0x15, 0x00, 0x1e, 0x00, 0x29, 0x00, 0x33, 0x00,
+  0x00, 0x00, 0x0b, 0x00, 0x14, 0x00, 0x00, 0x00, 0x09, 0x00, 0x14, 0x00,
+  0x1e, 0x00, 0x29, 0x00, 0x34, 0x00, 0x3f, 0x00, 0x4a, 0x00, 0x55, 0x00,
+  0x00, 0x00, 0x0b, 0x00, 0x16, 0x00, 0x22, 0x00, 0x2d, 0x00, 0x38, 0x00,
+  0x42, 0x00, 0x4c, 0x00, 0x57, 0x00, 0x00, 0x00, 0x09, 0x00, 0x13, 0x00,
+  0x1d, 0x00, 0x28, 0x00, 0x32, 0x00, 0x3c, 0x00, 0x45, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x14, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x09, 0x00, 0x13, 0x00,
+  0x1d, 0x00, 0x27, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x16, 0x00, 0x21, 0x00,
+  0x2c, 0x00, 0x36, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x13, 0x00, 0x1e, 0x00,
+  0x28, 0x00, 0x31, 0x00, 0x3b, 0x00, 0x46, 0x00, 0x50, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x15, 0x00, 0x1f, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x0a, 0x00,
+  0x15, 0x00, 0x1e, 0x00, 0x27, 0x00, 0x31, 0x00, 0x3a, 0x00, 0x45, 0x00,
+  0x50, 0x00, 0x5a, 0x00, 0x66, 0x00, 0x6f, 0x00, 0x00, 0x00, 0x0b, 0x00,
+  0x16, 0x00, 0x1f, 0x00, 0x28, 0x00, 0x34, 0x00, 0x40, 0x00, 0x4b, 0x00,
+  0x55, 0x00, 0x00, 0x00, 0x09, 0x00, 0x14, 0x00, 0x1e, 0x00, 0x27, 0x00,
+  0x30, 0x00, 0x00, 0x00, 0x09, 0x00, 0x13, 0x00, 0x1e, 0x00, 0x28, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x13, 0x00, 0x1d, 0x00, 0x28, 0x00, 0x34, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x17, 0x00, 0x20, 0x00, 0x2b, 0x00,
+  0x36, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x15, 0x00, 0x1e, 0x00, 0x27, 0x00,
+  0x30, 0x00, 0x39, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x13, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x15, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x09, 0x00, 0x13, 0x00,
+  0x1d, 0x00, 0x27, 0x00, 0x30, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x0a, 0x00,
+  0x14, 0x00, 0x1d, 0x00, 0x28, 0x00, 0x31, 0x00, 0x3b, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x12, 0x00, 0x1d, 0x00, 0x27, 0x00, 0x33, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x14, 0x00, 0x1f, 0x00, 0x29, 0x00, 0x33, 0x00, 0x3c, 0x00,
+  0x46, 0x00, 0x50, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x15, 0x00,
+  0x00, 0x00, 0x0b, 0x00, 0x15, 0x00, 0x20, 0x00, 0x29, 0x00, 0x32, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x15, 0x00, 0x1f, 0x00, 0x28, 0x00, 0x33, 0x00,
+  0x3c, 0x00, 0x45, 0x00, 0x50, 0x00, 0x5c, 0x00, 0x67, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x17, 0x00, 0x21, 0x00, 0x2b, 0x00, 0x37, 0x00, 0x40, 0x00,
+  0x00, 0x00, 0x2d, 0x00, 0x36, 0x00, 0x40, 0x00, 0x49, 0x00, 0x53, 0x00,
+  0x5e, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x14, 0x00, 0x1d, 0x00, 0x26, 0x00,
+  0x31, 0x00, 0x3a, 0x00, 0x45, 0x00, 0x51, 0x00, 0x5b, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x14, 0x00, 0x1e, 0x00, 0x29, 0x00, 0x33, 0x00, 0x3c, 0x00,
+  0x46, 0x00, 0x52, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x14, 0x00, 0x1d, 0x00,
+  0x26, 0x00, 0x30, 0x00, 0x39, 0x00, 0x42, 0x00, 0x00, 0x00, 0x0a, 0x00,
+  0x14, 0x00, 0x1e, 0x00, 0x29, 0x00, 0x32, 0x00, 0x3b, 0x00, 0x46, 0x00,
+  0x00, 0x00, 0x0a, 0x00, 0x14, 0x00, 0x1c, 0x00, 0x25, 0x00, 0x31, 0x00,
+  0x3c, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x14, 0x00, 0x00, 0x00, 0x0b, 0x00,
+  0x15, 0x00, 0x1f, 0x00, 0x29, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x15, 0x00,
+  0x1f, 0x00, 0x28, 0x00, 0x33, 0x00, 0x3f, 0x00, 0x4a, 0x00, 0x54, 0x00,
+  0x5f, 0x00, 0x69, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x14, 0x00, 0x1e, 0x00,
+  0x28, 0x00, 0x32, 0x00, 0x3d, 0x00, 0x48, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x14, 0x00, 0x1e, 0x00, 0x29, 0x00, 0x32, 0x00, 0x3b, 0x00, 0x46, 0x00,
+  0x50, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x15, 0x00, 0x1d, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x12, 0x00, 0x1c, 0x00, 0x27, 0x00, 0x31, 0x00, 0x3c, 0x00,
+  0x00, 0x00, 0x0a, 0x00, 0x14, 0x00, 0x1e, 0x00, 0x27, 0x00, 0x32, 0x00,
+  0x3c, 0x00, 0x46, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x15, 0x00, 0x20, 0x00,
+  0x2a, 0x00, 0x34, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x14, 0x00, 0x20, 0x00,
+  0x29, 0x00, 0x33, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x15, 0x00, 0x1f, 0x00,
+  0x00, 0x00, 0x0a, 0x00, 0x14, 0x00, 0x1e, 0x00, 0x27, 0x00, 0x31, 0x00,
+  0x3b, 0x00, 0x45, 0x00, 0x50, 0x00, 0x5a, 0x00, 0x64, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x16, 0x00, 0x20, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x14, 0x00,
+  0x20, 0x00, 0x2c, 0x00, 0x35, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x15, 0x00,
+  0x1e, 0x00, 0x29, 0x00, 0x33, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x12, 0x00, 0x1d, 0x00, 0x28, 0x00, 0x33, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x12, 0x00, 0x1b, 0x00, 0x25, 0x00, 0x2f, 0x00, 0x39, 0x00, 0x43, 0x00,
+  0x4e, 0x00, 0x59, 0x00, 0x00, 0x00, 0x28, 0x00, 0x32, 0x00, 0x3d, 0x00,
+  0x46, 0x00, 0x52, 0x00, 0x5c, 0x00, 0x66, 0x00, 0x6e, 0x00, 0x79, 0x00,
+  0x84, 0x00, 0x8e, 0x00, 0x00, 0x00, 0x28, 0x00, 0x33, 0x00, 0x3d, 0x00,
+  0x48, 0x00, 0x53, 0x00, 0x5e, 0x00, 0x69, 0x00, 0x00, 0x00, 0x0a, 0x00,
+  0x14, 0x00, 0x20, 0x00, 0x2b, 0x00, 0x34, 0x00, 0x00, 0x00, 0x2f, 0x00,
+  0x5e, 0x00, 0x8d, 0x00, 0xbc, 0x00, 0xc6, 0x00, 0xd1, 0x00, 0xdb, 0x00,
+  0xe6, 0x00, 0xf0, 0x00, 0xf9, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x5e, 0x00,
+  0x8d, 0x00, 0xbc, 0x00, 0xeb, 0x00, 0x1a, 0x01, 0x26, 0x01, 0x30, 0x01,
+  0x3a, 0x01, 0x44, 0x01, 0x4f, 0x01, 0x5a, 0x01, 0x00, 0x00, 0x0c, 0x00,
+  0x17, 0x00, 0x21, 0x00, 0x2b, 0x00, 0x36, 0x00, 0x40, 0x00, 0x4b, 0x00,
+  0x57, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x14, 0x00, 0x1f, 0x00, 0x28, 0x00,
+  0x32, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x16, 0x00, 0x20, 0x00, 0x2b, 0x00,
+  0x00, 0x00, 0x0a, 0x00, 0x15, 0x00, 0x1f, 0x00, 0x2a, 0x00, 0x34, 0x00,
+  0x3f, 0x00
+};
@@ -1,5 +1,7 @@
 #pragma once
-const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
+#include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/cs_dict_index.h>
+const unsigned char __espeakng_dict_cs[] __attribute__((aligned((4)))) = {
   0x00, 0x04, 0x00, 0x00, 0x9f, 0xb8, 0x00, 0x00, 0x00, 0x42, 0x19, 0xf0,
   0x9f, 0x91, 0xa9, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xe2, 0x80,
   0x8d, 0xf0, 0x9f, 0x91, 0xa7, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa7,
@@ -4206,4 +4208,11 @@ const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
   0x32, 0x28, 0x5a, 0x00, 0x24, 0x03, 0x49, 0x27, 0x37, 0x7c, 0x33, 0x00,
   0xc3, 0xb6, 0x03, 0x7b, 0x00, 0x07, 0x00
 };
-size_t __espeakng_dictlen = 50455;
+
+BackgroundAudioDictionary dict_cs = {
+    "cs",
+    50455,
+    __espeakng_dict_cs,
+    8206,
+    __espeakng_dictindex_cs
+};
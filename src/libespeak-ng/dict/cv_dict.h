@@ -1,5 +1,7 @@
 #pragma once
-const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
+#include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/cv_dict_index.h>
+const unsigned char __espeakng_dict_cv[] __attribute__((aligned((4)))) = {
   0x00, 0x04, 0x00, 0x00, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -113,4 +115,11 @@ const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
   0xd3, 0x91, 0x00, 0x03, 0x0d, 0x00, 0x07, 0x06, 0xd3, 0x97, 0x00, 0x03,
   0x81, 0x00, 0x07, 0x06, 0xd3, 0xb3, 0x00, 0x03, 0x70, 0x00, 0x07, 0x00
 };
-size_t __espeakng_dictlen = 1344;
+
+BackgroundAudioDictionary dict_cv = {
+    "cv",
+    1344,
+    __espeakng_dict_cv,
+    2068,
+    __espeakng_dictindex_cv
+};
@@ -1,5 +1,7 @@
 #pragma once
-const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
+#include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/cy_dict_index.h>
+const unsigned char __espeakng_dict_cy[] __attribute__((aligned((4)))) = {
   0x00, 0x04, 0x00, 0x00, 0x0d, 0xa4, 0x00, 0x00, 0x00, 0x3e, 0x19, 0xf0,
   0x9f, 0x91, 0xa9, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xe2, 0x80,
   0x8d, 0xf0, 0x9f, 0x91, 0xa7, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa7,
@@ -3596,4 +3598,11 @@ const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
   0x75, 0x00, 0xc3, 0xb4, 0x03, 0x76, 0x00, 0xc3, 0xa2, 0x03, 0x77, 0x00,
   0x07, 0x00
 };
-size_t __espeakng_dictlen = 43130;
+
+BackgroundAudioDictionary dict_cy = {
+    "cy",
+    43130,
+    __espeakng_dict_cy,
+    7474,
+    __espeakng_dictindex_cy
+};
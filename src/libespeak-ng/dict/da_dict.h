@@ -1,5 +1,7 @@
 #pragma once
-const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
+#include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/da_dict_index.h>
+const unsigned char __espeakng_dict_da[] __attribute__((aligned((4)))) = {
   0x00, 0x04, 0x00, 0x00, 0xc2, 0x61, 0x02, 0x00, 0x0b, 0xc8, 0x41, 0x23,
   0xc7, 0x48, 0x13, 0x4d, 0xa5, 0x20, 0x0f, 0x08, 0xc5, 0x34, 0xf4, 0x86,
   0x14, 0xd0, 0x0f, 0x00, 0x42, 0x19, 0xf0, 0x9f, 0x91, 0xa9, 0xe2, 0x80,
@@ -20442,4 +20444,11 @@ const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
   0x6c, 0x00, 0xc3, 0xa7, 0x03, 0x5a, 0x00, 0xc3, 0xab, 0x03, 0x73, 0x00,
   0xc3, 0xa0, 0x03, 0x75, 0x00, 0x07, 0x00
 };
-size_t __espeakng_dictlen = 245287;
+
+BackgroundAudioDictionary dict_da = {
+    "da",
+    245287,
+    __espeakng_dict_da,
+    40442,
+    __espeakng_dictindex_da
+};
@@ -0,0 +1,3374 @@
+#pragma once
+const unsigned char __espeakng_dictindex_da[] __attribute__((aligned((4)))) = {
+  0x45, 0x44, 0x58, 0x31, 0x27, 0xbe, 0x03, 0x00, 0xc2, 0x61, 0x02, 0x00,
+  0xf7, 0x31, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x0d, 0x00, 0x15, 0x00,
+  0x24, 0x00, 0x26, 0x00, 0x29, 0x00, 0x32, 0x00, 0x47, 0x00, 0x4d, 0x00,
+  0x52, 0x00, 0x57, 0x00, 0x5c, 0x00, 0x5e, 0x00, 0x62, 0x00, 0x6c, 0x00,
+  0x75, 0x00, 0x76, 0x00, 0x7f, 0x00, 0x88, 0x00, 0x8f, 0x00, 0x93, 0x00,
+  0xa5, 0x00, 0xc0, 0x00, 0xc6, 0x00, 0xce, 0x00, 0xd5, 0x00, 0xed, 0x00,
+  0xf1, 0x00, 0xfe, 0x00, 0x03, 0x01, 0x05, 0x01, 0x15, 0x01, 0x1f, 0x01,
+  0x43, 0x01, 0x48, 0x01, 0x4d, 0x01, 0x52, 0x01, 0x58, 0x01, 0x61, 0x01,
+  0x65, 0x01, 0x71, 0x01, 0x7d, 0x01, 0x80, 0x01, 0x81, 0x01, 0x8d, 0x01,
+  0x9c, 0x01, 0x9f, 0x01, 0xaa, 0x01, 0xc1, 0x01, 0xca, 0x01, 0xdc, 0x01,
+  0xe0, 0x01, 0xea, 0x01, 0x0f, 0x02, 0x21, 0x02, 0x24, 0x02, 0x26, 0x02,
+  0x3f, 0x02, 0x54, 0x02, 0x61, 0x02, 0x73, 0x02, 0x79, 0x02, 0x85, 0x02,
+  0x9f, 0x02, 0xa0, 0x02, 0xae, 0x02, 0xb8, 0x02, 0xbe, 0x02, 0xc3, 0x02,
+  0xdc, 0x02, 0xe4, 0x02, 0xe6, 0x02, 0xec, 0x02, 0x01, 0x03, 0x10, 0x03,
+  0x16, 0x03, 0x28, 0x03, 0x2a, 0x03, 0x3c, 0x03, 0x41, 0x03, 0x47, 0x03,
+  0x53, 0x03, 0x5b, 0x03, 0x5f, 0x03, 0x62, 0x03, 0x6c, 0x03, 0x7d, 0x03,
+  0x8c, 0x03, 0x93, 0x03, 0xa2, 0x03, 0xba, 0x03, 0xc1, 0x03, 0xd1, 0x03,
+  0xdc, 0x03, 0xe0, 0x03, 0xe1, 0x03, 0xe9, 0x03, 0xf1, 0x03, 0xf6, 0x03,
+  0xfa, 0x03, 0xfb, 0x03, 0x02, 0x04, 0x05, 0x04, 0x06, 0x04, 0x09, 0x04,
+  0x1b, 0x04, 0x44, 0x04, 0x48, 0x04, 0x5a, 0x04, 0x5e, 0x04, 0x65, 0x04,
+  0x76, 0x04, 0x80, 0x04, 0x83, 0x04, 0x89, 0x04, 0x8d, 0x04, 0x9d, 0x04,
+  0xb2, 0x04, 0xc0, 0x04, 0xcf, 0x04, 0xd9, 0x04, 0xfc, 0x04, 0x07, 0x05,
+  0x19, 0x05, 0x30, 0x05, 0x38, 0x05, 0x4a, 0x05, 0x52, 0x05, 0x54, 0x05,
+  0x59, 0x05, 0x63, 0x05, 0x71, 0x05, 0x7c, 0x05, 0x7c, 0x05, 0x80, 0x05,
+  0x98, 0x05, 0x9e, 0x05, 0xa4, 0x05, 0xc0, 0x05, 0xc9, 0x05, 0xd1, 0x05,
+  0xd5, 0x05, 0xe8, 0x05, 0xf0, 0x05, 0xf7, 0x05, 0xf8, 0x05, 0xfa, 0x05,
+  0xff, 0x05, 0x0b, 0x06, 0x11, 0x06, 0x17, 0x06, 0x1e, 0x06, 0x25, 0x06,
+  0x6b, 0x06, 0x74, 0x06, 0x88, 0x06, 0x90, 0x06, 0x93, 0x06, 0x9c, 0x06,
+  0xa3, 0x06, 0xa5, 0x06, 0xd9, 0x06, 0xe2, 0x06, 0xfa, 0x06, 0x0d, 0x07,
+  0x11, 0x07, 0x14, 0x07, 0x28, 0x07, 0x3b, 0x07, 0x9d, 0x07, 0xa3, 0x07,
+  0xa6, 0x07, 0xb0, 0x07, 0xb5, 0x07, 0xbc, 0x07, 0xc9, 0x07, 0xcd, 0x07,
+  0xd2, 0x07, 0xd4, 0x07, 0xdd, 0x07, 0xe3, 0x07, 0xe9, 0x07, 0xf0, 0x07,
+  0xf4, 0x07, 0xf7, 0x07, 0x2c, 0x08, 0x33, 0x08, 0x3b, 0x08, 0x4f, 0x08,
+  0x50, 0x08, 0x54, 0x08, 0x68, 0x08, 0x6e, 0x08, 0x7c, 0x08, 0x86, 0x08,
+  0x9e, 0x08, 0xaa, 0x08, 0xab, 0x08, 0xb1, 0x08, 0xc5, 0x08, 0xd6, 0x08,
+  0xe0, 0x08, 0xe9, 0x08, 0xf4, 0x08, 0x01, 0x09, 0x0a, 0x09, 0x0e, 0x09,
+  0x12, 0x09, 0x14, 0x09, 0x15, 0x09, 0x1a, 0x09, 0x20, 0x09, 0x27, 0x09,
+  0x2c, 0x09, 0x2f, 0x09, 0x41, 0x09, 0x47, 0x09, 0x52, 0x09, 0x5d, 0x09,
+  0x67, 0x09, 0x83, 0x09, 0x85, 0x09, 0x8c, 0x09, 0x93, 0x09, 0x94, 0x09,
+  0xa1, 0x09, 0xaa, 0x09, 0xab, 0x09, 0xae, 0x09, 0xb0, 0x09, 0xb1, 0x09,
+  0xb5, 0x09, 0xb8, 0x09, 0xc7, 0x09, 0xd2, 0x09, 0xde, 0x09, 0xfa, 0x09,
+  0x11, 0x0a, 0x13, 0x0a, 0x21, 0x0a, 0x30, 0x0a, 0x31, 0x0a, 0x32, 0x0a,
+  0x37, 0x0a, 0x43, 0x0a, 0x49, 0x0a, 0x56, 0x0a, 0x5b, 0x0a, 0x5f, 0x0a,
+  0x6f, 0x0a, 0x7d, 0x0a, 0x81, 0x0a, 0xa0, 0x0a, 0xc0, 0x0a, 0xc8, 0x0a,
+  0xd0, 0x0a, 0xe4, 0x0a, 0xe6, 0x0a, 0xea, 0x0a, 0xf1, 0x0a, 0xf4, 0x0a,
+  0xf7, 0x0a, 0xfe, 0x0a, 0xfe, 0x0a, 0x02, 0x0b, 0x03, 0x0b, 0x0d, 0x0b,
+  0x0f, 0x0b, 0x20, 0x0b, 0x68, 0x0b, 0x6f, 0x0b, 0x75, 0x0b, 0x7c, 0x0b,
+  0x89, 0x0b, 0x8f, 0x0b, 0xa3, 0x0b, 0xaa, 0x0b, 0xb9, 0x0b, 0xc1, 0x0b,
+  0xcb, 0x0b, 0xd0, 0x0b, 0xe2, 0x0b, 0xf5, 0x0b, 0xfc, 0x0b, 0x1d, 0x0c,
+  0x40, 0x0c, 0x8f, 0x0c, 0x92, 0x0c, 0x97, 0x0c, 0x9a, 0x0c, 0xc6, 0x0c,
+  0xdd, 0x0c, 0xe3, 0x0c, 0xe9, 0x0c, 0xec, 0x0c, 0xed, 0x0c, 0xf2, 0x0c,
+  0xf2, 0x0c, 0xff, 0x0c, 0x04, 0x0d, 0x12, 0x0d, 0x12, 0x0d, 0x33, 0x0d,
+  0x39, 0x0d, 0x48, 0x0d, 0x4a, 0x0d, 0x57, 0x0d, 0x60, 0x0d, 0x67, 0x0d,
+  0x7c, 0x0d, 0xa5, 0x0d, 0xad, 0x0d, 0xcc, 0x0d, 0xd1, 0x0d, 0xe1, 0x0d,
+  0xe8, 0x0d, 0xf5, 0x0d, 0x0d, 0x0e, 0x29, 0x0e, 0x39, 0x0e, 0x53, 0x0e,
+  0x55, 0x0e, 0x6d, 0x0e, 0x71, 0x0e, 0x74, 0x0e, 0x78, 0x0e, 0x7e, 0x0e,
+  0x82, 0x0e, 0x88, 0x0e, 0x91, 0x0e, 0xa3, 0x0e, 0xb1, 0x0e, 0xc4, 0x0e,
+  0xc5, 0x0e, 0xd8, 0x0e, 0xdc, 0x0e, 0xe7, 0x0e, 0xea, 0x0e, 0xf3, 0x0e,
+  0xf9, 0x0e, 0xfd, 0x0e, 0x00, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x2c, 0x0f,
+  0x2d, 0x0f, 0x39, 0x0f, 0x40, 0x0f, 0x4b, 0x0f, 0x63, 0x0f, 0x82, 0x0f,
+  0x8a, 0x0f, 0x97, 0x0f, 0xa2, 0x0f, 0xae, 0x0f, 0xb1, 0x0f, 0xb6, 0x0f,
+  0xb7, 0x0f, 0xc6, 0x0f, 0xc9, 0x0f, 0xcf, 0x0f, 0xe4, 0x0f, 0xec, 0x0f,
+  0xf2, 0x0f, 0xfc, 0x0f, 0x02, 0x10, 0x08, 0x10, 0x0f, 0x10, 0x11, 0x10,
+  0x17, 0x10, 0x39, 0x10, 0x47, 0x10, 0x4a, 0x10, 0x4f, 0x10, 0x58, 0x10,
+  0x5b, 0x10, 0x6d, 0x10, 0x7b, 0x10, 0x8a, 0x10, 0x8e, 0x10, 0x95, 0x10,
+  0x98, 0x10, 0x9b, 0x10, 0xab, 0x10, 0xc5, 0x10, 0xcb, 0x10, 0xdd, 0x10,
+  0xfe, 0x10, 0x02, 0x11, 0x0f, 0x11, 0x1c, 0x11, 0x1c, 0x11, 0x20, 0x11,
+  0x52, 0x11, 0x57, 0x11, 0x5e, 0x11, 0x60, 0x11, 0x6c, 0x11, 0x73, 0x11,
+  0x82, 0x11, 0x86, 0x11, 0x8b, 0x11, 0x8b, 0x11, 0x92, 0x11, 0x9d, 0x11,
+  0xa5, 0x11, 0xa7, 0x11, 0xa8, 0x11, 0xba, 0x11, 0xca, 0x11, 0xfe, 0x11,
+  0x01, 0x12, 0x09, 0x12, 0x0f, 0x12, 0x25, 0x12, 0x3e, 0x12, 0x53, 0x12,
+  0x62, 0x12, 0x65, 0x12, 0xd2, 0x12, 0xde, 0x12, 0xe8, 0x12, 0xf4, 0x12,
+  0x01, 0x13, 0x08, 0x13, 0x27, 0x13, 0x38, 0x13, 0x47, 0x13, 0x48, 0x13,
+  0x4a, 0x13, 0x54, 0x13, 0x60, 0x13, 0x66, 0x13, 0x6a, 0x13, 0x6d, 0x13,
+  0x7f, 0x13, 0x81, 0x13, 0x8f, 0x13, 0x90, 0x13, 0x92, 0x13, 0x94, 0x13,
+  0xa5, 0x13, 0xcc, 0x13, 0xdc, 0x13, 0xe1, 0x13, 0xee, 0x13, 0xf7, 0x13,
+  0x08, 0x14, 0x0b, 0x14, 0x0e, 0x14, 0x10, 0x14, 0x24, 0x14, 0x2c, 0x14,
+  0x2f, 0x14, 0x3b, 0x14, 0x51, 0x14, 0x54, 0x14, 0x94, 0x14, 0x95, 0x14,
+  0x9e, 0x14, 0xa3, 0x14, 0xa6, 0x14, 0xa9, 0x14, 0xad, 0x14, 0xb2, 0x14,
+  0xb8, 0x14, 0xd4, 0x14, 0xd8, 0x14, 0xda, 0x14, 0xe9, 0x14, 0xed, 0x14,
+  0xf5, 0x14, 0xf9, 0x14, 0xff, 0x14, 0x09, 0x15, 0x1d, 0x15, 0x23, 0x15,
+  0x33, 0x15, 0x36, 0x15, 0x41, 0x15, 0x49, 0x15, 0x4b, 0x15, 0x5c, 0x15,
+  0x67, 0x15, 0x6d, 0x15, 0x6f, 0x15, 0x77, 0x15, 0x7b, 0x15, 0x7f, 0x15,
+  0x93, 0x15, 0xa1, 0x15, 0xad, 0x15, 0xbb, 0x15, 0xbd, 0x15, 0xc2, 0x15,
+  0xce, 0x15, 0xd8, 0x15, 0xda, 0x15, 0xe5, 0x15, 0xf3, 0x15, 0xf8, 0x15,
+  0x06, 0x16, 0x0e, 0x16, 0x15, 0x16, 0x1e, 0x16, 0x26, 0x16, 0x30, 0x16,
+  0x41, 0x16, 0x5b, 0x16, 0x6d, 0x16, 0x73, 0x16, 0x82, 0x16, 0xa2, 0x16,
+  0xac, 0x16, 0xb3, 0x16, 0xea, 0x16, 0xef, 0x16, 0xfb, 0x16, 0xff, 0x16,
+  0x03, 0x17, 0x0d, 0x17, 0x17, 0x17, 0x1b, 0x17, 0x28, 0x17, 0x42, 0x17,
+  0x4e, 0x17, 0x54, 0x17, 0x56, 0x17, 0x5f, 0x17, 0x67, 0x17, 0x6c, 0x17,
+  0x6c, 0x17, 0x79, 0x17, 0x81, 0x17, 0x96, 0x17, 0xa0, 0x17, 0xa7, 0x17,
+  0xac, 0x17, 0xb6, 0x17, 0xda, 0x17, 0x16, 0x18, 0x26, 0x18, 0x2e, 0x18,
+  0x38, 0x18, 0x88, 0x18, 0x97, 0x18, 0x9a, 0x18, 0xa1, 0x18, 0xa9, 0x18,
+  0xb7, 0x18, 0xd2, 0x18, 0xd4, 0x18, 0xd9, 0x18, 0xdc, 0x18, 0xde, 0x18,
+  0xe8, 0x18, 0xee, 0x18, 0xf2, 0x18, 0xf8, 0x18, 0x03, 0x19, 0x0e, 0x19,
+  0x11, 0x19, 0x17, 0x19, 0x26, 0x19, 0x33, 0x19, 0x3b, 0x19, 0x4d, 0x19,
+  0x60, 0x19, 0x71, 0x19, 0x78, 0x19, 0x92, 0x19, 0x9f, 0x19, 0xa7, 0x19,
+  0xac, 0x19, 0xb9, 0x19, 0xc2, 0x19, 0xe7, 0x19, 0xf3, 0x19, 0x05, 0x1a,
+  0x14, 0x1a, 0x21, 0x1a, 0x23, 0x1a, 0x27, 0x1a, 0x2d, 0x1a, 0x2f, 0x1a,
+  0x35, 0x1a, 0x40, 0x1a, 0x52, 0x1a, 0x5b, 0x1a, 0x5e, 0x1a, 0x64, 0x1a,
+  0x91, 0x1a, 0x93, 0x1a, 0x96, 0x1a, 0x9b, 0x1a, 0xaf, 0x1a, 0xb6, 0x1a,
+  0xbc, 0x1a, 0xc4, 0x1a, 0xd6, 0x1a, 0xde, 0x1a, 0xe2, 0x1a, 0x05, 0x1b,
+  0x0d, 0x1b, 0x16, 0x1b, 0x17, 0x1b, 0x22, 0x1b, 0x34, 0x1b, 0x40, 0x1b,
+  0x43, 0x1b, 0x53, 0x1b, 0x76, 0x1b, 0x77, 0x1b, 0x78, 0x1b, 0x7d, 0x1b,
+  0x80, 0x1b, 0x89, 0x1b, 0x8f, 0x1b, 0x9f, 0x1b, 0xa1, 0x1b, 0xa5, 0x1b,
+  0xac, 0x1b, 0xba, 0x1b, 0xc1, 0x1b, 0xc9, 0x1b, 0xc9, 0x1b, 0xd6, 0x1b,
+  0xd7, 0x1b, 0xda, 0x1b, 0xde, 0x1b, 0xe1, 0x1b, 0xe9, 0x1b, 0xf2, 0x1b,
+  0xf5, 0x1b, 0xf8, 0x1b, 0xfd, 0x1b, 0x04, 0x1c, 0x07, 0x1c, 0x17, 0x1c,
+  0x1f, 0x1c, 0x27, 0x1c, 0x34, 0x1c, 0x47, 0x1c, 0x55, 0x1c, 0x63, 0x1c,
+  0x6a, 0x1c, 0x8b, 0x1c, 0xa1, 0x1c, 0xa8, 0x1c, 0xaa, 0x1c, 0xb1, 0x1c,
+  0xb6, 0x1c, 0xc0, 0x1c, 0xc7, 0x1c, 0xcf, 0x1c, 0xd7, 0x1c, 0xdd, 0x1c,
+  0xde, 0x1c, 0xe6, 0x1c, 0xe7, 0x1c, 0xea, 0x1c, 0xed, 0x1c, 0xf2, 0x1c,
+  0xfe, 0x1c, 0x08, 0x1d, 0x0d, 0x1d, 0x13, 0x1d, 0x15, 0x1d, 0x29, 0x1d,
+  0x35, 0x1d, 0x46, 0x1d, 0x56, 0x1d, 0x64, 0x1d, 0x69, 0x1d, 0x7f, 0x1d,
+  0x80, 0x1d, 0x92, 0x1d, 0x99, 0x1d, 0xc2, 0x1d, 0xea, 0x1d, 0xf4, 0x1d,
+  0xf6, 0x1d, 0x09, 0x1e, 0x16, 0x1e, 0x26, 0x1e, 0x39, 0x1e, 0x42, 0x1e,
+  0x46, 0x1e, 0x4a, 0x1e, 0x4c, 0x1e, 0x51, 0x1e, 0x54, 0x1e, 0x72, 0x1e,
+  0x7a, 0x1e, 0x94, 0x1e, 0x9b, 0x1e, 0xbd, 0x1e, 0xc9, 0x1e, 0xd9, 0x1e,
+  0xdf, 0x1e, 0x35, 0x1f, 0x4a, 0x1f, 0x60, 0x1f, 0x68, 0x1f, 0x6f, 0x1f,
+  0x77, 0x1f, 0x7e, 0x1f, 0x83, 0x1f, 0xa3, 0x1f, 0xaa, 0x1f, 0xc7, 0x1f,
+  0xd3, 0x1f, 0xdb, 0x1f, 0xe1, 0x1f, 0x03, 0x20, 0x11, 0x20, 0x23, 0x20,
+  0x29, 0x20, 0x41, 0x20, 0x4e, 0x20, 0x54, 0x20, 0x5c, 0x20, 0x62, 0x20,
+  0x6c, 0x20, 0x77, 0x20, 0x7f, 0x20, 0xaa, 0x20, 0xb4, 0x20, 0xec, 0x20,
+  0x02, 0x21, 0x1a, 0x21, 0x24, 0x21, 0x54, 0x21, 0x5e, 0x21, 0x64, 0x21,
+  0x6d, 0x21, 0x79, 0x21, 0x83, 0x21, 0x8a, 0x21, 0x97, 0x21, 0xa2, 0x21,
+  0xb1, 0x21, 0xbb, 0x21, 0xc4, 0x21, 0xd3, 0x21, 0xe7, 0x21, 0x07, 0x22,
+  0x11, 0x22, 0x1c, 0x22, 0x2a, 0x22, 0x33, 0x22, 0x3a, 0x22, 0x42, 0x22,
+  0x4c, 0x22, 0x59, 0x22, 0x81, 0x22, 0x9c, 0x22, 0xa9, 0x22, 0xc2, 0x22,
+  0xc8, 0x22, 0xeb, 0x22, 0xf4, 0x22, 0x09, 0x23, 0x12, 0x23, 0x2c, 0x23,
+  0x3c, 0x23, 0x4d, 0x23, 0x67, 0x23, 0xb3, 0x23, 0xbf, 0x23, 0xcc, 0x23,
+  0xd4, 0x23, 0xe6, 0x23, 0xf1, 0x23, 0x05, 0x24, 0x0c, 0x24, 0x19, 0x24,
+  0x25, 0x24, 0x32, 0x24, 0x3c, 0x24, 0x4c, 0x24, 0x7b, 0x24, 0x8d, 0x24,
+  0x9c, 0x24, 0xa6, 0x24, 0xbf, 0x24, 0xcf, 0x24, 0xd9, 0x24, 0xe5, 0x24,
+  0x02, 0x25, 0x0b, 0x25, 0x18, 0x25, 0x1f, 0x25, 0x26, 0x25, 0x2f, 0x25,
+  0x35, 0x25, 0x42, 0x25, 0x56, 0x25, 0x63, 0x25, 0x70, 0x25, 0x76, 0x25,
+  0xbb, 0x25, 0xd4, 0x25, 0xdf, 0x25, 0xf0, 0x25, 0xf9, 0x25, 0x00, 0x26,
+  0x09, 0x26, 0x0e, 0x26, 0x12, 0x26, 0x1d, 0x26, 0x23, 0x26, 0x32, 0x26,
+  0x48, 0x26, 0x55, 0x26, 0x66, 0x26, 0x70, 0x26, 0x78, 0x26, 0x82, 0x26,
+  0xa2, 0x26, 0xb4, 0x26, 0xc7, 0x26, 0xce, 0x26, 0xd6, 0x26, 0xdb, 0x26,
+  0xe7, 0x26, 0x04, 0x27, 0x76, 0x27, 0x81, 0x27, 0x8d, 0x27, 0xaf, 0x27,
+  0xc6, 0x27, 0xcb, 0x27, 0xfd, 0x27, 0x0c, 0x28, 0x16, 0x28, 0x20, 0x28,
+  0x25, 0x28, 0x30, 0x28, 0x34, 0x28, 0x3a, 0x28, 0x3f, 0x28, 0x45, 0x28,
+  0x4d, 0x28, 0x54, 0x28, 0x69, 0x28, 0x74, 0x28, 0x81, 0x28, 0x8d, 0x28,
+  0x95, 0x28, 0xa8, 0x28, 0xb1, 0x28, 0xb5, 0x28, 0xc3, 0x28, 0xcc, 0x28,
+  0xdb, 0x28, 0xea, 0x28, 0xf2, 0x28, 0xfd, 0x28, 0x19, 0x29, 0x26, 0x29,
+  0x32, 0x29, 0x3d, 0x29, 0x46, 0x29, 0x49, 0x29, 0x61, 0x29, 0x72, 0x29,
+  0x7f, 0x29, 0x86, 0x29, 0x8a, 0x29, 0x93, 0x29, 0x99, 0x29, 0x9e, 0x29,
+  0xa8, 0x29, 0xb0, 0x29, 0xc3, 0x29, 0xcc, 0x29, 0xe5, 0x29, 0xf2, 0x29,
+  0x01, 0x2a, 0x11, 0x2a, 0x2c, 0x2a, 0x40, 0x2a, 0x45, 0x2a, 0x4d, 0x2a,
+  0x5b, 0x2a, 0x67, 0x2a, 0x6b, 0x2a, 0x7b, 0x2a, 0x81, 0x2a, 0x89, 0x2a,
+  0x90, 0x2a, 0x9c, 0x2a, 0x9f, 0x2a, 0xa5, 0x2a, 0xaa, 0x2a, 0xaf, 0x2a,
+  0xbb, 0x2a, 0xce, 0x2a, 0xd7, 0x2a, 0xe0, 0x2a, 0xea, 0x2a, 0x0d, 0x2b,
+  0x15, 0x2b, 0x1c, 0x2b, 0x2f, 0x2b, 0x42, 0x2b, 0x51, 0x2b, 0x61, 0x2b,
+  0x6a, 0x2b, 0x73, 0x2b, 0x80, 0x2b, 0x90, 0x2b, 0xa4, 0x2b, 0xb9, 0x2b,
+  0xc5, 0x2b, 0xcc, 0x2b, 0xd8, 0x2b, 0xe4, 0x2b, 0xec, 0x2b, 0xf8, 0x2b,
+  0xfe, 0x2b, 0x06, 0x2c, 0x13, 0x2c, 0x3a, 0x2c, 0x40, 0x2c, 0x4d, 0x2c,
+  0x61, 0x2c, 0xa6, 0x2c, 0xbb, 0x2c, 0xda, 0x2c, 0xed, 0x2c, 0x18, 0x2d,
+  0x23, 0x2d, 0x43, 0x2d, 0x47, 0x2d, 0x4c, 0x2d, 0x79, 0x2d, 0x7d, 0x2d,
+  0x8b, 0x2d, 0x97, 0x2d, 0xa7, 0x2d, 0xac, 0x2d, 0xb0, 0x2d, 0xb9, 0x2d,
+  0xc3, 0x2d, 0xce, 0x2d, 0xdb, 0x2d, 0xff, 0x2d, 0x0b, 0x2e, 0x0f, 0x2e,
+  0x18, 0x2e, 0x2a, 0x2e, 0x3d, 0x2e, 0x57, 0x2e, 0x5f, 0x2e, 0x67, 0x2e,
+  0x75, 0x2e, 0x7a, 0x2e, 0x9a, 0x2e, 0x9a, 0x2e, 0xa2, 0x2e, 0xcd, 0x2e,
+  0xdc, 0x2e, 0xe0, 0x2e, 0xeb, 0x2e, 0x0a, 0x2f, 0x38, 0x2f, 0x55, 0x2f,
+  0x73, 0x2f, 0x7d, 0x2f, 0x87, 0x2f, 0x87, 0x2f, 0x9a, 0x2f, 0xa0, 0x2f,
+  0xa3, 0x2f, 0xaf, 0x2f, 0xb4, 0x2f, 0xc9, 0x2f, 0xcd, 0x2f, 0xce, 0x2f,
+  0xd7, 0x2f, 0xd8, 0x2f, 0xe5, 0x2f, 0xef, 0x2f, 0x02, 0x30, 0x28, 0x30,
+  0x32, 0x30, 0x55, 0x30, 0x6c, 0x30, 0x75, 0x30, 0x7e, 0x30, 0x8b, 0x30,
+  0x92, 0x30, 0x94, 0x30, 0x95, 0x30, 0x96, 0x30, 0x9b, 0x30, 0xa1, 0x30,
+  0xa6, 0x30, 0xbc, 0x30, 0xcf, 0x30, 0xd3, 0x30, 0xd6, 0x30, 0xe4, 0x30,
+  0x01, 0x31, 0x19, 0x31, 0x21, 0x31, 0x2d, 0x31, 0x31, 0x31, 0x37, 0x31,
+  0x46, 0x31, 0x4b, 0x31, 0x5c, 0x31, 0x5f, 0x31, 0x64, 0x31, 0x67, 0x31,
+  0x88, 0x31, 0x93, 0x31, 0x9f, 0x31, 0xab, 0x31, 0xcc, 0x31, 0xd1, 0x31,
+  0xf7, 0x31, 0x00, 0x00, 0x73, 0xe3, 0x8c, 0x02, 0x63, 0x26, 0x47, 0x55,
+  0x27, 0x3d, 0x41, 0x1d, 0xef, 0x31, 0x3e, 0xc6, 0x70, 0x35, 0x0b, 0xbc,
+  0xc1, 0x93, 0xa8, 0x99, 0x22, 0xd1, 0x73, 0xd6, 0xd2, 0x13, 0x3c, 0xf8,
+  0x01, 0x2c, 0x5f, 0x93, 0x6b, 0x69, 0x19, 0xab, 0x3e, 0xc4, 0xf7, 0x2c,
+  0xe0, 0xb2, 0x75, 0x0b, 0xdf, 0x36, 0xa1, 0x28, 0x19, 0xb5, 0x57, 0xfd,
+  0xcc, 0xd5, 0xaf, 0x68, 0xe7, 0x5f, 0xaa, 0xd5, 0x4e, 0x13, 0x12, 0x6f,
+  0x26, 0x60, 0x5d, 0xe9, 0xc4, 0x8e, 0x4b, 0xff, 0xf5, 0x15, 0xbb, 0xc8,
+  0x7b, 0x4d, 0xff, 0xa1, 0xfe, 0x49, 0x28, 0x3e, 0x26, 0x92, 0x99, 0xea,
+  0x8f, 0x53, 0x44, 0x44, 0x44, 0xbb, 0x8c, 0x14, 0xc3, 0x85, 0x55, 0xc8,
+  0xfd, 0x37, 0x9f, 0x80, 0x8f, 0xf4, 0x9a, 0x09, 0x40, 0xd8, 0x9a, 0x40,
+  0xd8, 0xe8, 0x97, 0x2d, 0xbc, 0xaf, 0x12, 0xd2, 0x0d, 0xef, 0x67, 0x41,
+  0x77, 0x33, 0x1e, 0x49, 0xfa, 0xda, 0x01, 0x38, 0x0b, 0xe8, 0x53, 0xf6,
+  0x98, 0x27, 0xd3, 0xc2, 0x40, 0x5b, 0x65, 0xbd, 0x1a, 0x4e, 0x71, 0xaa,
+  0xd1, 0x44, 0xb3, 0x08, 0x08, 0x72, 0x72, 0xbf, 0xe0, 0x32, 0x85, 0xe9,
+  0xcd, 0x53, 0xc2, 0x12, 0x46, 0x6a, 0x3a, 0x30, 0x9f, 0x31, 0x48, 0x14,
+  0xd7, 0xe7, 0x42, 0x98, 0xb6, 0x64, 0x03, 0x01, 0x46, 0x2b, 0xa0, 0xb6,
+  0xe8, 0x26, 0x42, 0xf5, 0x20, 0xe3, 0xc9, 0x47, 0x9a, 0xbd, 0x32, 0x24,
+  0x97, 0x38, 0x39, 0x23, 0x1e, 0xb5, 0xe9, 0xcf, 0x83, 0x87, 0x8a, 0x42,
+  0x94, 0xf9, 0xc7, 0xf9, 0x4b, 0x1b, 0x46, 0x95, 0x67, 0x31, 0x27, 0x91,
+  0x17, 0xbc, 0x67, 0xe7, 0xf0, 0xcf, 0x82, 0x5f, 0x50, 0xe3, 0x0d, 0x99,
+  0xa2, 0x53, 0x36, 0x40, 0x34, 0x82, 0xa6, 0x46, 0xdd, 0x78, 0x80, 0xbd,
+  0xa8, 0x0a, 0x31, 0x70, 0x5a, 0xa6, 0xfe, 0x86, 0x52, 0xe6, 0x42, 0xb1,
+  0xe0, 0xa4, 0xae, 0xb4, 0x18, 0x23, 0xe6, 0x50, 0x44, 0xaa, 0x1a, 0xe1,
+  0xf3, 0x71, 0x2c, 0xe1, 0xa4, 0x14, 0x7b, 0xc5, 0x28, 0xfd, 0xf9, 0xa8,
+  0x49, 0xd8, 0x07, 0xdf, 0x30, 0xdd, 0x43, 0x2f, 0xd7, 0x37, 0xde, 0xe8,
+  0x39, 0x5d, 0x74, 0x9d, 0xc1, 0xa2, 0x72, 0xca, 0xea, 0xeb, 0x45, 0xf8,
+  0xa0, 0xba, 0x9c, 0x8f, 0x1f, 0x2b, 0x1f, 0x39, 0xef, 0x9a, 0x56, 0xaf,
+  0x40, 0x40, 0x6e, 0xb4, 0x0d, 0x3f, 0x21, 0x07, 0x4d, 0x68, 0x3b, 0xad,
+  0x5a, 0xdd, 0xc6, 0xd8, 0x8a, 0x53, 0xe5, 0xc4, 0xb1, 0xdb, 0x12, 0xc4,
+  0x44, 0x8c, 0xb1, 0x1e, 0x57, 0xca, 0x6e, 0x8f, 0x3c, 0x0b, 0xa3, 0xc1,
+  0xaf, 0x36, 0xd4, 0x3a, 0xec, 0x9b, 0x3f, 0x1a, 0x8d, 0x86, 0xef, 0xbd,
+  0x01, 0xd9, 0xcf, 0x8f, 0xca, 0x7a, 0x63, 0x82, 0x74, 0x32, 0xe5, 0x3b,
+  0x13, 0xf1, 0x3c, 0x3a, 0x65, 0xee, 0x77, 0xbf, 0x3f, 0x00, 0xe2, 0xc6,
+  0xd7, 0x0c, 0x33, 0x6c, 0xd0, 0x71, 0x46, 0x66, 0x16, 0xc2, 0x37, 0xf4,
+  0xe9, 0x20, 0x5f, 0x81, 0x32, 0x1a, 0xa7, 0xa9, 0x26, 0x67, 0x9c, 0x32,
+  0x47, 0x8d, 0xdc, 0x34, 0x41, 0x08, 0xc8, 0x59, 0x61, 0x66, 0x54, 0x0d,
+  0x7d, 0x35, 0x3f, 0xb3, 0x52, 0x36, 0x30, 0x84, 0x96, 0x51, 0xde, 0x59,
+  0x46, 0x88, 0x4b, 0x7b, 0x0b, 0x96, 0x18, 0x91, 0xae, 0xaf, 0x68, 0xa8,
+  0x69, 0x37, 0x94, 0xac, 0x35, 0xbe, 0x41, 0xa3, 0x4f, 0x3f, 0x68, 0x03,
+  0xec, 0x45, 0x7a, 0x5c, 0x64, 0x36, 0x97, 0x3a, 0xca, 0x0e, 0x7c, 0x38,
+  0xdb, 0xda, 0xd0, 0xdd, 0xed, 0x51, 0x1b, 0x6d, 0xa6, 0xc8, 0xdc, 0xa6,
+  0xdc, 0xfc, 0x55, 0x95, 0xeb, 0x59, 0xcf, 0x51, 0x16, 0xa2, 0x79, 0x1f,
+  0x59, 0x49, 0xaf, 0x9d, 0x28, 0x5b, 0xd7, 0xb0, 0x95, 0x10, 0x5b, 0xf0,
+  0xdf, 0x7d, 0x45, 0x24, 0xee, 0x48, 0xb3, 0x7d, 0x40, 0x7f, 0xfd, 0x8c,
+  0xd9, 0x43, 0xe3, 0xd9, 0x2b, 0x19, 0xa2, 0xd3, 0xc6, 0xff, 0x5b, 0x6d,
+  0xf7, 0x93, 0x13, 0xf1, 0x41, 0x0a, 0x68, 0xa8, 0xad, 0x0f, 0xc4, 0x53,
+  0xf6, 0xa9, 0x23, 0xd0, 0x9b, 0x96, 0x85, 0xe7, 0xe8, 0x12, 0xd1, 0x73,
+  0x84, 0x46, 0xcb, 0x8c, 0x5b, 0x92, 0x47, 0x75, 0x4d, 0x44, 0x80, 0x22,
+  0xf9, 0xc2, 0x99, 0x33, 0x37, 0xd5, 0x94, 0xbb, 0x7f, 0x28, 0x16, 0x34,
+  0xbf, 0x52, 0x1c, 0xe0, 0x6d, 0x85, 0xf3, 0x99, 0x21, 0x4e, 0x67, 0x52,
+  0x03, 0xd4, 0xa7, 0x4d, 0x3f, 0x62, 0x28, 0x5c, 0xaa, 0x2d, 0x80, 0x1d,
+  0xaf, 0xbc, 0x95, 0x60, 0xe0, 0x12, 0x22, 0xd4, 0x7f, 0x9e, 0x0a, 0x15,
+  0xd2, 0x6c, 0x0c, 0x2a, 0x5f, 0x21, 0x95, 0x3a, 0xef, 0xe1, 0x37, 0xc9,
+  0x30, 0x0f, 0xab, 0xb4, 0xd6, 0x14, 0x76, 0x6b, 0x9c, 0x93, 0xd1, 0x23,
+  0x90, 0x6a, 0x49, 0xa8, 0xad, 0x3b, 0x92, 0xd7, 0xcb, 0x17, 0x74, 0xc7,
+  0x36, 0x2c, 0x9a, 0x58, 0x27, 0xce, 0x80, 0x3f, 0x89, 0x94, 0xba, 0x3d,
+  0x06, 0xb4, 0x8c, 0x37, 0x3b, 0x0a, 0xa8, 0x2f, 0xcc, 0x57, 0x26, 0xe2,
+  0x93, 0x06, 0x51, 0x24, 0x85, 0xf9, 0x0d, 0x46, 0x04, 0xc3, 0x35, 0x35,
+  0x58, 0xf1, 0x18, 0x4f, 0x21, 0x21, 0xdc, 0xd0, 0x91, 0x21, 0x8a, 0xfb,
+  0xed, 0xc9, 0xe2, 0x9e, 0x8f, 0xe8, 0xcb, 0xdb, 0x43, 0x74, 0x61, 0x8a,
+  0xc9, 0xc3, 0xa5, 0x70, 0x23, 0x99, 0x96, 0x8c, 0xe4, 0xc4, 0xd9, 0xbd,
+  0x39, 0x43, 0x64, 0xf3, 0x45, 0xbe, 0x47, 0x9d, 0x13, 0x66, 0x92, 0x52,
+  0xad, 0xf0, 0xc3, 0x71, 0x09, 0x59, 0x30, 0xc3, 0xc1, 0xbe, 0x5c, 0xc9,
+  0xc1, 0x8b, 0x69, 0x59, 0x0f, 0x42, 0xcb, 0xfa, 0xf6, 0x65, 0x58, 0xd7,
+  0x0c, 0x6a, 0x9d, 0x0a, 0x2a, 0xb8, 0xa5, 0x89, 0xb3, 0xd6, 0x07, 0xa9,
+  0xfb, 0xf3, 0x50, 0x60, 0x24, 0xf7, 0xbd, 0xe7, 0xaf, 0xac, 0x98, 0xa8,
+  0x44, 0xf6, 0x48, 0x9a, 0xa1, 0xde, 0xe3, 0xe4, 0x05, 0x82, 0x14, 0x48,
+  0x3a, 0xc0, 0x57, 0xec, 0xb0, 0x1a, 0x8d, 0xa8, 0x5e, 0x40, 0x54, 0x10,
+  0x47, 0x08, 0xa2, 0x31, 0x54, 0x00, 0x72, 0x6c, 0x88, 0x5b, 0x80, 0x9e,
+  0x7b, 0x5b, 0x49, 0xad, 0x03, 0xf9, 0x31, 0xd4, 0xd6, 0xca, 0x17, 0xa0,
+  0xa6, 0x35, 0x60, 0x59, 0xff, 0xda, 0x87, 0xf0, 0xed, 0x5d, 0xf9, 0x89,
+  0xf8, 0x10, 0xed, 0x22, 0xe5, 0x5f, 0x43, 0x3c, 0x46, 0x03, 0x5c, 0x01,
+  0x90, 0x14, 0x78, 0xcf, 0x37, 0x0e, 0x79, 0x28, 0x5e, 0x72, 0x49, 0xc8,
+  0x29, 0xc7, 0x4b, 0x9a, 0x92, 0xbc, 0x83, 0x98, 0xc9, 0xf0, 0x51, 0x3e,
+  0x00, 0xe3, 0x41, 0x50, 0x9c, 0xd3, 0x4a, 0x9d, 0x44, 0xd3, 0xf4, 0x5a,
+  0xc2, 0x4f, 0x00, 0xd0, 0xe8, 0xa1, 0xe6, 0xe1, 0x32, 0xcc, 0x82, 0x55,
+  0x9c, 0x96, 0xde, 0x10, 0xf2, 0x72, 0x8c, 0x5b, 0xad, 0x8a, 0x72, 0xaa,
+  0xc0, 0x4b, 0x1d, 0xa4, 0xa1, 0xd2, 0xe9, 0x69, 0xb8, 0x31, 0x74, 0xff,
+  0xde, 0xef, 0xac, 0x58, 0xbe, 0xf3, 0xb9, 0x63, 0x4a, 0x35, 0x63, 0xfc,
+  0xe4, 0x3a, 0x9f, 0xf8, 0x2f, 0x17, 0xff, 0x72, 0x2c, 0x01, 0xa4, 0xaa,
+  0x0f, 0x49, 0x8f, 0xf7, 0x47, 0x53, 0x17, 0x8d, 0xc4, 0x93, 0x7f, 0x9d,
+  0x43, 0x33, 0xa3, 0x69, 0xd8, 0x63, 0xc7, 0x39, 0x74, 0x0c, 0xed, 0x1d,
+  0x18, 0x37, 0xcc, 0x51, 0x9d, 0x86, 0x6f, 0xa3, 0x6d, 0x53, 0x7b, 0xff,
+  0x3b, 0xdd, 0x43, 0xe2, 0xc9, 0x47, 0x2a, 0xc9, 0xd7, 0xa0, 0xc2, 0xe8,
+  0xc8, 0xa4, 0xe1, 0x0b, 0x1a, 0xb4, 0xcb, 0xd1, 0xd1, 0x5f, 0x99, 0x94,
+  0x24, 0x2b, 0x6c, 0xb6, 0xef, 0xa7, 0xbd, 0x29, 0x7c, 0xa1, 0xa3, 0xa5,
+  0x3b, 0xbe, 0x1e, 0x30, 0xbf, 0x6c, 0x2b, 0xb6, 0x86, 0x5d, 0x31, 0xe7,
+  0xdc, 0x3a, 0x09, 0x46, 0x3a, 0x30, 0x6f, 0x71, 0x62, 0x84, 0xff, 0xd2,
+  0xae, 0x45, 0xa5, 0xf5, 0x61, 0x61, 0xfb, 0x99, 0x29, 0xda, 0xfd, 0xc9,
+  0xfa, 0x37, 0x26, 0xae, 0x88, 0x0d, 0x08, 0xdb, 0x02, 0x27, 0x68, 0xb3,
+  0xf9, 0xbc, 0xff, 0x76, 0xee, 0x41, 0x87, 0x36, 0xf0, 0xf6, 0x2b, 0x01,
+  0x66, 0xb3, 0xaf, 0x99, 0xa1, 0x49, 0xb0, 0x65, 0xe7, 0x7a, 0x2c, 0x84,
+  0xde, 0x0a, 0x1a, 0x58, 0x39, 0x5c, 0x9d, 0xf6, 0xf3, 0x1e, 0xaa, 0xca,
+  0xa2, 0xa9, 0x39, 0x16, 0xcf, 0x76, 0x35, 0xc5, 0x54, 0x8f, 0x2b, 0xe4,
+  0x98, 0x1e, 0xa8, 0x94, 0xf3, 0x75, 0xcd, 0x2f, 0xdf, 0xb5, 0x82, 0xa8,
+  0x23, 0x7d, 0x90, 0xea, 0x44, 0x73, 0x1d, 0x90, 0x73, 0x8f, 0x91, 0x97,
+  0x45, 0x6d, 0x0a, 0xa1, 0x80, 0xd2, 0x3a, 0x36, 0x4c, 0x82, 0x5d, 0x17,
+  0xb0, 0x9d, 0x97, 0xdc, 0x2c, 0xd4, 0x96, 0x0e, 0xf5, 0xa2, 0x9b, 0x63,
+  0x18, 0x01, 0x9f, 0xb5, 0x19, 0x7b, 0xd4, 0x6c, 0xd0, 0x22, 0x09, 0x99,
+  0xbf, 0x7a, 0xab, 0xce, 0x00, 0xed, 0x7d, 0x17, 0x1b, 0x99, 0xb5, 0xcf,
+  0xfb, 0x5f, 0x00, 0xad, 0xbd, 0xdc, 0x81, 0x37, 0x4c, 0xc5, 0xa0, 0x4e,
+  0x5e, 0x67, 0x36, 0x3b, 0x3b, 0xc7, 0x72, 0x89, 0x6f, 0xe2, 0x06, 0x5a,
+  0xae, 0x4b, 0xce, 0x30, 0xf9, 0x44, 0xfa, 0xaa, 0x03, 0x2f, 0xa3, 0x4d,
+  0xa4, 0x71, 0x5a, 0x6a, 0xa4, 0xeb, 0x90, 0x5c, 0xbe, 0xfe, 0x49, 0x3a,
+  0x86, 0xa8, 0xb4, 0x8e, 0x31, 0xd4, 0x6c, 0xf1, 0x0d, 0xbe, 0x28, 0x6a,
+  0x81, 0x74, 0xee, 0x20, 0xbd, 0x20, 0x30, 0x44, 0xc6, 0xb5, 0x22, 0x5f,
+  0x5b, 0xe2, 0x14, 0x5a, 0xfb, 0x02, 0x47, 0xee, 0xfc, 0xdf, 0x8e, 0x6a,
+  0x54, 0x1b, 0x1f, 0x28, 0x52, 0xfb, 0xf3, 0x12, 0xd4, 0x45, 0x70, 0x8e,
+  0x1e, 0x3a, 0x20, 0xbd, 0xfe, 0x35, 0xcb, 0xdf, 0x2b, 0xfe, 0xc5, 0x74,
+  0x1f, 0x27, 0x38, 0xf5, 0x13, 0x7d, 0xe4, 0xcb, 0xac, 0x5f, 0x4e, 0x06,
+  0x0f, 0x23, 0x87, 0x7d, 0x38, 0x39, 0x2e, 0xc3, 0xe5, 0x3b, 0xaa, 0x35,
+  0x80, 0x17, 0x67, 0x2e, 0xec, 0xaf, 0x2d, 0xca, 0xbe, 0x89, 0x0f, 0x58,
+  0x84, 0xb4, 0x57, 0x27, 0x70, 0xef, 0xe0, 0xe1, 0x4a, 0x1d, 0x01, 0x8c,
+  0x5c, 0x4f, 0xd5, 0x32, 0xb7, 0x88, 0x1b, 0xf7, 0x31, 0x2f, 0x1f, 0xb3,
+  0x7d, 0x3f, 0xf3, 0x08, 0xe0, 0xb9, 0xfb, 0x14, 0x8c, 0xe6, 0x90, 0xe8,
+  0xbb, 0x35, 0x2e, 0x72, 0x32, 0x46, 0x41, 0xe7, 0x4f, 0xc0, 0x2b, 0xfd,
+  0xda, 0x98, 0x80, 0x30, 0x00, 0xb3, 0x52, 0x7e, 0xd8, 0x78, 0xca, 0x35,
+  0xc5, 0xb6, 0x62, 0x59, 0x86, 0x3c, 0x83, 0x34, 0x69, 0x75, 0xe8, 0x53,
+  0xc9, 0x5d, 0xbc, 0x14, 0x3a, 0x80, 0xac, 0x7d, 0x5a, 0x67, 0x43, 0x39,
+  0xc1, 0xfc, 0x3e, 0x1c, 0x40, 0xa6, 0x15, 0x8f, 0x36, 0x8b, 0x0b, 0xf7,
+  0x86, 0x13, 0xbe, 0x4b, 0xac, 0x3a, 0x70, 0xc1, 0xc3, 0x91, 0xb0, 0x73,
+  0xa8, 0xcc, 0x20, 0xa3, 0xa3, 0x27, 0x09, 0x80, 0xf7, 0x7b, 0x39, 0x45,
+  0x30, 0xc5, 0x37, 0x03, 0x9d, 0xa8, 0xfc, 0x8e, 0xc9, 0xdf, 0x5e, 0xea,
+  0xc8, 0x57, 0x24, 0x55, 0x2b, 0xb3, 0x8f, 0x2b, 0x03, 0x65, 0x79, 0x02,
+  0x7d, 0x32, 0x97, 0x9d, 0xb1, 0x09, 0xcc, 0xb3, 0xc9, 0x27, 0xbb, 0x69,
+  0x8f, 0x60, 0x26, 0x99, 0xd1, 0x92, 0xc4, 0xb4, 0xcc, 0x85, 0x7a, 0x85,
+  0x27, 0xcd, 0x68, 0x4d, 0xf2, 0xed, 0xd8, 0x28, 0x4c, 0x2e, 0xa2, 0xd3,
+  0xe3, 0x9b, 0x02, 0xff, 0xb6, 0x48, 0x85, 0xe2, 0x5a, 0x81, 0x24, 0x34,
+  0x56, 0xf3, 0x79, 0x24, 0x09, 0xd5, 0xbe, 0x7d, 0xb8, 0xf6, 0xbb, 0x83,
+  0xb8, 0x83, 0x16, 0x9a, 0x49, 0x97, 0x63, 0x02, 0x02, 0x32, 0xfe, 0x72,
+  0x66, 0x27, 0x24, 0xaf, 0x62, 0x1a, 0xd7, 0x76, 0xd7, 0xc3, 0x1e, 0x7b,
+  0x25, 0x0e, 0x2d, 0xa7, 0xe7, 0xaa, 0xb4, 0x50, 0x18, 0xc9, 0xc4, 0x04,
+  0x38, 0xfa, 0x5e, 0x25, 0xe5, 0x2c, 0xb6, 0x9f, 0x0a, 0x97, 0xba, 0x68,
+  0xbb, 0xe8, 0xcd, 0xe0, 0x60, 0x16, 0x18, 0x33, 0x0f, 0x4d, 0x02, 0x6b,
+  0xa2, 0x85, 0x3f, 0xa3, 0x27, 0xfe, 0x0c, 0x26, 0xf2, 0x9c, 0x65, 0x5a,
+  0xdf, 0x92, 0xdf, 0x19, 0xba, 0xd7, 0x00, 0xea, 0x4b, 0xb7, 0x40, 0xdb,
+  0x11, 0x39, 0x37, 0x5e, 0xe5, 0x78, 0xf9, 0xab, 0x19, 0xb0, 0x36, 0xa8,
+  0x05, 0xc6, 0x29, 0x75, 0x5a, 0xf9, 0x56, 0x68, 0x5d, 0x48, 0x63, 0xdf,
+  0x81, 0xc4, 0x78, 0xe4, 0xdb, 0x12, 0x87, 0xd3, 0x87, 0xcc, 0xb9, 0x0a,
+  0xe4, 0x4c, 0x14, 0x72, 0xba, 0xcc, 0x25, 0xea, 0xff, 0x90, 0x02, 0xad,
+  0x41, 0xd4, 0x27, 0xac, 0x6c, 0x7a, 0xd2, 0x3b, 0x10, 0xbb, 0x48, 0x08,
+  0x2e, 0xa5, 0xf6, 0x6a, 0xf7, 0x08, 0xeb, 0xb3, 0xaf, 0xd7, 0x42, 0x09,
+  0x85, 0x9d, 0xde, 0xdb, 0x75, 0xe9, 0xd0, 0x3c, 0xe7, 0xcc, 0x2a, 0xd8,
+  0x6c, 0xeb, 0x1a, 0xcd, 0xa9, 0xb7, 0x36, 0x92, 0xbb, 0x48, 0x01, 0x28,
+  0x03, 0x56, 0x98, 0x04, 0x71, 0xa3, 0x39, 0xf8, 0x94, 0xd8, 0xe9, 0xea,
+  0xc6, 0xfd, 0xab, 0x95, 0x19, 0x5f, 0x31, 0xbd, 0xa1, 0xb2, 0xc1, 0xda,
+  0x04, 0x96, 0x70, 0x1e, 0x74, 0x37, 0x98, 0xbe, 0x72, 0x08, 0x15, 0xe7,
+  0x98, 0x25, 0x0d, 0x62, 0xe2, 0xad, 0xf7, 0xe5, 0x2e, 0x02, 0x29, 0x4d,
+  0xe9, 0xa1, 0xd3, 0xa6, 0x2d, 0x8c, 0x21, 0x48, 0x4c, 0xba, 0x76, 0x35,
+  0xaa, 0xe9, 0x88, 0xc0, 0xf2, 0xa6, 0x7f, 0xd7, 0x40, 0x61, 0xce, 0xdc,
+  0x5c, 0xe0, 0x08, 0xaa, 0x75, 0x74, 0x18, 0xeb, 0xd9, 0x71, 0x86, 0x46,
+  0x23, 0x3d, 0xae, 0x2b, 0xf2, 0xaf, 0xa1, 0x09, 0x7a, 0x58, 0xf9, 0x6e,
+  0x75, 0x44, 0x53, 0x58, 0xba, 0x8c, 0xff, 0x74, 0x20, 0x13, 0x7e, 0x86,
+  0x41, 0xbf, 0x45, 0x0a, 0xcb, 0x82, 0xce, 0x8f, 0x22, 0xbd, 0xf4, 0xa0,
+  0x6e, 0xb2, 0xd9, 0xba, 0x00, 0xf6, 0xc7, 0xc3, 0x8d, 0xd0, 0x5f, 0x09,
+  0xd3, 0xdc, 0x3b, 0x9e, 0x56, 0x70, 0x28, 0xf8, 0x09, 0x17, 0x11, 0xb5,
+  0x7f, 0x76, 0xe0, 0x2f, 0xe2, 0x49, 0xd4, 0x09, 0xdc, 0xde, 0x7d, 0x6e,
+  0x9d, 0xad, 0x41, 0x1c, 0x33, 0xf5, 0xe7, 0x09, 0x29, 0x2a, 0x25, 0x00,
+  0xe1, 0x84, 0xea, 0x75, 0x3b, 0xd8, 0xd3, 0x1c, 0x55, 0x21, 0x98, 0x0a,
+  0xb0, 0x83, 0x44, 0x68, 0x54, 0x6f, 0xb5, 0x35, 0x71, 0x1b, 0xea, 0x9d,
+  0x8d, 0x4e, 0xb4, 0x3a, 0xe3, 0x25, 0x18, 0x3f, 0x02, 0xf4, 0x17, 0x66,
+  0x71, 0x35, 0x12, 0xc4, 0xe0, 0x8b, 0x49, 0x6f, 0x93, 0x02, 0x4c, 0xe5,
+  0xd5, 0xaa, 0x3e, 0x75, 0xc6, 0x41, 0x79, 0x3e, 0x87, 0x98, 0x69, 0x34,
+  0xd5, 0x4a, 0xd5, 0xd7, 0xf6, 0x67, 0x37, 0x07, 0x32, 0x24, 0x57, 0x79,
+  0x51, 0x34, 0x91, 0x50, 0xfa, 0x9d, 0x57, 0xcb, 0xbc, 0xde, 0x11, 0x0e,
+  0x17, 0xd1, 0x4b, 0xe5, 0x5f, 0xe2, 0x3c, 0x58, 0x88, 0x6e, 0xa2, 0x17,
+  0xc7, 0xc9, 0xf1, 0x50, 0x03, 0xd8, 0xac, 0x7a, 0x8f, 0x31, 0xd3, 0xa6,
+  0x17, 0xb1, 0xbd, 0xa2, 0x14, 0x3c, 0x4a, 0xdf, 0x0c, 0xd3, 0xec, 0x06,
+  0xf7, 0x7f, 0x2d, 0xae, 0x6f, 0x11, 0x5f, 0xf2, 0x69, 0xc1, 0xeb, 0x4c,
+  0x21, 0xbd, 0x27, 0x79, 0x05, 0x31, 0x91, 0xdd, 0x22, 0xac, 0xbf, 0x72,
+  0x2d, 0xee, 0xd7, 0xf9, 0x45, 0x61, 0x9b, 0xc4, 0xe2, 0x67, 0x7a, 0x6b,
+  0x5a, 0x45, 0xfc, 0x0c, 0xfc, 0x73, 0xc7, 0xdf, 0xe1, 0x48, 0x23, 0x30,
+  0x77, 0x66, 0x06, 0xe5, 0x43, 0x44, 0x99, 0xaf, 0xe1, 0xd0, 0xb8, 0x62,
+  0x68, 0x06, 0x42, 0x54, 0x15, 0x93, 0x3e, 0x37, 0xdd, 0xd9, 0x7e, 0xa8,
+  0xb4, 0xd2, 0x05, 0x51, 0x9a, 0xab, 0x54, 0x97, 0xd3, 0xf1, 0xc9, 0x60,
+  0xa4, 0x75, 0xa3, 0x01, 0x80, 0x36, 0x3d, 0x51, 0x67, 0xa9, 0xa4, 0x69,
+  0x49, 0x50, 0xa9, 0x96, 0x93, 0x1c, 0xdc, 0x4f, 0x6c, 0xd5, 0x4e, 0x65,
+  0xad, 0x72, 0xaf, 0x01, 0x9e, 0xb3, 0x38, 0xcb, 0x82, 0x07, 0xc4, 0x58,
+  0x22, 0x38, 0x44, 0x46, 0x9b, 0x43, 0x8d, 0x0b, 0x2c, 0x61, 0xa2, 0x5f,
+  0xa1, 0x89, 0xb1, 0x6e, 0x39, 0x89, 0x1f, 0x9e, 0x21, 0xdf, 0x02, 0x20,
+  0xf0, 0x23, 0xe0, 0x3b, 0x1f, 0xec, 0xde, 0x26, 0x20, 0x86, 0xa1, 0xda,
+  0x90, 0x88, 0x3e, 0xe0, 0x9a, 0xf9, 0x67, 0x51, 0xed, 0xca, 0xcd, 0xcc,
+  0x5f, 0x84, 0x95, 0x50, 0xe2, 0x6f, 0x88, 0xf0, 0xe6, 0x55, 0xec, 0x1c,
+  0x98, 0x7d, 0x22, 0x6f, 0x21, 0xa6, 0x71, 0x58, 0xec, 0x37, 0xd9, 0x83,
+  0xa3, 0xa6, 0x07, 0xc1, 0x0b, 0x32, 0x9e, 0x78, 0xb8, 0x4d, 0xbf, 0x58,
+  0x93, 0x0b, 0x76, 0x92, 0xe9, 0xca, 0x17, 0xa5, 0x36, 0xab, 0x6a, 0xde,
+  0xfe, 0xbe, 0xa1, 0x3d, 0x92, 0x24, 0x32, 0x7c, 0x59, 0x5a, 0xca, 0xc9,
+  0xa6, 0x96, 0x94, 0xe9, 0x68, 0xc5, 0x69, 0x07, 0xa9, 0xf0, 0x6b, 0xa8,
+  0x42, 0xe7, 0xca, 0xc0, 0xa9, 0x7f, 0x04, 0xa5, 0xfd, 0xb2, 0xdb, 0xc8,
+  0x6f, 0xa4, 0xca, 0x7f, 0x2f, 0x25, 0x34, 0x13, 0x46, 0xbb, 0xfa, 0xe4,
+  0x4f, 0xb8, 0xc7, 0x6f, 0x57, 0x3e, 0xe9, 0x59, 0x77, 0xdd, 0x5f, 0x58,
+  0xfd, 0xca, 0x91, 0x19, 0x01, 0x85, 0x94, 0xbf, 0x7d, 0xae, 0x08, 0xf2,
+  0x94, 0x3b, 0x38, 0x87, 0x34, 0xcf, 0xee, 0xb9, 0x42, 0x87, 0x57, 0x4c,
+  0xa4, 0x48, 0x61, 0x0b, 0x59, 0x3e, 0x43, 0x48, 0xb8, 0xe2, 0x89, 0xf0,
+  0xa0, 0x17, 0xfa, 0xfa, 0xfa, 0xfa, 0xe3, 0xaf, 0x4e, 0x30, 0x96, 0xfe,
+  0xff, 0xb7, 0x55, 0x8c, 0x0d, 0x54, 0x7d, 0x8e, 0x73, 0x84, 0xb3, 0x46,
+  0x5e, 0xfc, 0xf1, 0x54, 0x54, 0x54, 0x5c, 0x90, 0x31, 0x45, 0x62, 0x8f,
+  0x33, 0x2e, 0x7e, 0x19, 0xf9, 0x45, 0xc3, 0x1a, 0x54, 0x7e, 0x89, 0x0f,
+  0x70, 0x86, 0x2b, 0x70, 0x7a, 0x6c, 0x44, 0x5b, 0xbe, 0xfc, 0x30, 0xb5,
+  0x85, 0xda, 0xf3, 0x57, 0x7a, 0x11, 0xd3, 0x96, 0x5e, 0x66, 0x42, 0xdb,
+  0xf3, 0xe7, 0x5c, 0xbf, 0x33, 0xdf, 0x96, 0xf8, 0xdf, 0xb2, 0x11, 0x02,
+  0xa9, 0x18, 0x62, 0xb2, 0x10, 0xa0, 0x20, 0xb9, 0x9b, 0x3b, 0x1f, 0x3b,
+  0xde, 0xd1, 0x4d, 0x07, 0xaf, 0x98, 0x1d, 0xab, 0x4c, 0xe0, 0x5b, 0x5e,
+  0xbd, 0x32, 0x94, 0xb1, 0x99, 0x4c, 0xde, 0x56, 0x17, 0x06, 0xe4, 0x5e,
+  0x3a, 0xcf, 0xb5, 0x69, 0xa9, 0x9b, 0x4e, 0x83, 0x4b, 0x27, 0x9a, 0x79,
+  0x20, 0x54, 0x71, 0x6d, 0x74, 0xee, 0x8e, 0xc2, 0x90, 0x07, 0x19, 0x94,
+  0xf3, 0x5a, 0xb0, 0x09, 0xf1, 0xef, 0x85, 0xc7, 0xc7, 0x4a, 0xc5, 0x6c,
+  0xed, 0xb2, 0x79, 0x82, 0xb3, 0x89, 0x99, 0x80, 0x47, 0x4d, 0x3c, 0x95,
+  0x7f, 0xfc, 0x10, 0x53, 0xfc, 0x49, 0x08, 0x05, 0x80, 0xa7, 0x34, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0x57, 0x71, 0x1c, 0xff, 0x66, 0x92,
+  0x42, 0x18, 0xdd, 0x3f, 0x57, 0xec, 0x7c, 0xf4, 0x20, 0x66, 0x8b, 0x97,
+  0x08, 0x92, 0x6f, 0x4f, 0xd5, 0xdb, 0xa3, 0x91, 0x25, 0x61, 0x5f, 0xba,
+  0x10, 0x71, 0xb4, 0x35, 0x92, 0xc3, 0x48, 0xae, 0xe9, 0x4d, 0x18, 0xfe,
+  0xf4, 0xa9, 0x73, 0x98, 0x52, 0xff, 0x97, 0xe5, 0x06, 0x9e, 0xd9, 0xba,
+  0x52, 0xa7, 0x1f, 0x0e, 0x08, 0x88, 0xd2, 0x8d, 0x83, 0x73, 0x9e, 0xc1,
+  0xd5, 0x12, 0xd8, 0xd5, 0xcf, 0xcf, 0x11, 0x6b, 0x6a, 0xcd, 0xf9, 0x12,
+  0xaa, 0xa0, 0x85, 0x6f, 0x97, 0x7f, 0x8a, 0xb5, 0x68, 0xbc, 0x17, 0x88,
+  0xb6, 0x6f, 0xd1, 0x00, 0x6b, 0x66, 0xbd, 0x98, 0x75, 0xc9, 0x01, 0x80,
+  0x03, 0x31, 0xdd, 0xd5, 0x5b, 0x9c, 0x62, 0x36, 0x5f, 0x4a, 0x6f, 0x7c,
+  0x0e, 0x7c, 0x40, 0xf3, 0xfe, 0x4e, 0x5b, 0xe9, 0xde, 0x01, 0x93, 0x06,
+  0x2d, 0x0b, 0xcd, 0x57, 0x97, 0x7f, 0x48, 0x61, 0x20, 0x9d, 0xcd, 0xce,
+  0xd3, 0x90, 0xea, 0xb4, 0xc2, 0x09, 0xe9, 0xb6, 0x83, 0xa3, 0x14, 0x7e,
+  0x57, 0xba, 0x0f, 0xcf, 0x8b, 0xa0, 0x05, 0x2e, 0x00, 0xe3, 0xfa, 0xb4,
+  0x7c, 0x7c, 0xb6, 0x4b, 0x37, 0xb5, 0x49, 0x02, 0x4c, 0xa9, 0xcc, 0x3a,
+  0x93, 0x9b, 0x50, 0x79, 0x0d, 0x47, 0x91, 0xae, 0xfa, 0xf5, 0x0e, 0xb2,
+  0x59, 0x93, 0x73, 0xff, 0x4c, 0x55, 0x6e, 0xd1, 0x49, 0x81, 0xe1, 0x19,
+  0xc6, 0x01, 0xe1, 0xc4, 0x36, 0xfe, 0x08, 0x96, 0x33, 0x06, 0x33, 0x91,
+  0x53, 0x77, 0x0e, 0xf2, 0x93, 0x02, 0x3a, 0xc3, 0x4d, 0x74, 0xe5, 0x3e,
+  0x5d, 0x75, 0xfe, 0x27, 0x54, 0xaf, 0x93, 0x91, 0xe4, 0xf7, 0x0f, 0xb5,
+  0xaa, 0xd8, 0xbd, 0x13, 0x40, 0x83, 0x86, 0x26, 0x0b, 0xae, 0x97, 0x40,
+  0x61, 0x1f, 0x89, 0x2e, 0xc8, 0x77, 0x4e, 0x1d, 0x68, 0x86, 0x32, 0x1e,
+  0xd8, 0x29, 0x94, 0xfe, 0x98, 0x44, 0x80, 0xec, 0x00, 0x9c, 0x3e, 0xc3,
+  0xbe, 0xa4, 0xea, 0x06, 0x6c, 0x3f, 0xf1, 0x8b, 0x5d, 0x7d, 0xbc, 0x92,
+  0x24, 0xde, 0xda, 0x00, 0x3e, 0x62, 0x07, 0xf3, 0x27, 0x4f, 0xc0, 0xba,
+  0xff, 0xed, 0xa7, 0x0c, 0x27, 0xbd, 0xc8, 0x23, 0x20, 0xb9, 0x6b, 0x6c,
+  0x3a, 0x1e, 0x19, 0x0a, 0x80, 0x27, 0x36, 0x15, 0xec, 0xe9, 0x10, 0x8d,
+  0x89, 0x66, 0x51, 0xa9, 0x31, 0x7a, 0x54, 0x60, 0x9a, 0xa8, 0x0b, 0xbd,
+  0x4e, 0x32, 0xc0, 0xc2, 0xab, 0x19, 0x65, 0xc9, 0x26, 0x4b, 0x4e, 0x83,
+  0xed, 0xa4, 0x91, 0xb1, 0xd2, 0x70, 0x88, 0x83, 0xd0, 0x5f, 0xcd, 0x59,
+  0xd3, 0xed, 0xd5, 0x04, 0x6f, 0x28, 0x67, 0xe1, 0x04, 0x09, 0xcb, 0x2e,
+  0xca, 0xa2, 0x7c, 0x35, 0xee, 0xd2, 0xd2, 0xf1, 0xaf, 0x16, 0x61, 0xff,
+  0x7c, 0xbd, 0xbc, 0x81, 0x22, 0xfa, 0x6b, 0x25, 0xaf, 0xf5, 0x19, 0x2e,
+  0x07, 0x2c, 0x4f, 0x0d, 0x21, 0x72, 0x4e, 0xc8, 0xd5, 0x66, 0x86, 0x32,
+  0x60, 0xf2, 0xd5, 0x81, 0x6a, 0xf1, 0x7d, 0xbc, 0xb0, 0xb8, 0x00, 0x32,
+  0xfc, 0x97, 0x87, 0xce, 0xb0, 0x74, 0x92, 0x12, 0x25, 0x0c, 0x1d, 0xc6,
+  0xde, 0xde, 0x7a, 0x16, 0xcf, 0x66, 0xa2, 0x03, 0x5a, 0x9e, 0xb0, 0x6c,
+  0xe4, 0xdd, 0x11, 0xf3, 0x6c, 0x78, 0x0e, 0x2b, 0x5c, 0x1a, 0x5b, 0x25,
+  0x31, 0xe3, 0x38, 0x08, 0x41, 0x6b, 0xc9, 0xf8, 0x28, 0xbc, 0xd1, 0x23,
+  0x50, 0x3b, 0x7c, 0xf0, 0xeb, 0x4b, 0xaa, 0xd9, 0xe0, 0x44, 0xcc, 0xfb,
+  0x9d, 0xc2, 0x0d, 0x15, 0x40, 0x31, 0x2c, 0x74, 0x02, 0x82, 0x53, 0xd5,
+  0x1d, 0x82, 0x1a, 0x39, 0x0f, 0xfb, 0xea, 0x99, 0xaf, 0xac, 0xfc, 0x99,
+  0x90, 0x2a, 0xbb, 0x2f, 0x95, 0x97, 0x73, 0x9d, 0x37, 0xd1, 0x9c, 0x81,
+  0xfa, 0x36, 0xab, 0xeb, 0x14, 0x22, 0x57, 0xa5, 0xdb, 0xf1, 0xd7, 0xe5,
+  0xee, 0x9d, 0x43, 0x1a, 0xe6, 0x3d, 0xcf, 0x2b, 0x79, 0x79, 0x70, 0x6d,
+  0x68, 0xba, 0xd6, 0x7a, 0xe0, 0x3e, 0xd1, 0x13, 0x19, 0xfd, 0xf4, 0x81,
+  0x00, 0xfc, 0xd2, 0x56, 0x9c, 0x62, 0x78, 0x74, 0x34, 0x22, 0x36, 0xe8,
+  0xbd, 0x0a, 0x63, 0x17, 0xd2, 0xf4, 0x71, 0x9d, 0x97, 0xea, 0x8f, 0xdf,
+  0xa7, 0xdd, 0xce, 0x2b, 0x43, 0xe6, 0x40, 0x21, 0xac, 0xd2, 0x1e, 0x1d,
+  0x89, 0xc3, 0xe7, 0xe4, 0xac, 0xd7, 0xa9, 0x41, 0xbd, 0xcf, 0x12, 0xa3,
+  0xe3, 0x55, 0xca, 0xb9, 0xca, 0xe2, 0x76, 0x29, 0xac, 0x0c, 0x42, 0xde,
+  0x93, 0xd6, 0x0b, 0x54, 0x43, 0x74, 0xfb, 0xbb, 0x77, 0xdf, 0x4f, 0xe1,
+  0xb3, 0x82, 0x91, 0x7b, 0xe6, 0xe3, 0x9a, 0x4d, 0x8d, 0xbe, 0xa8, 0xe3,
+  0x60, 0x39, 0x1c, 0xbf, 0xf0, 0xf7, 0x80, 0x80, 0xd5, 0xd0, 0x91, 0xbb,
+  0x2f, 0x19, 0x21, 0xd0, 0xb0, 0x51, 0x92, 0xb5, 0x09, 0x04, 0x0c, 0xff,
+  0x7a, 0x4b, 0x2c, 0xea, 0x45, 0x2b, 0xe1, 0xca, 0x19, 0x9d, 0x18, 0x23,
+  0x99, 0xef, 0x3f, 0x59, 0x06, 0xb3, 0xd9, 0xd3, 0x47, 0x4e, 0xab, 0xb6,
+  0x42, 0x59, 0xf4, 0x52, 0xa4, 0x42, 0xfb, 0x3c, 0x69, 0xe3, 0x71, 0xd0,
+  0x5f, 0xfc, 0x2b, 0xa7, 0x38, 0x3f, 0x02, 0x4c, 0x55, 0xf3, 0x85, 0xb5,
+  0xfd, 0x47, 0x0a, 0x96, 0x22, 0xb3, 0x04, 0x29, 0xf4, 0xbd, 0x76, 0xe5,
+  0xf3, 0x2a, 0xfc, 0x76, 0xca, 0x8b, 0x92, 0x8c, 0xe8, 0xbd, 0x6b, 0x98,
+  0x4d, 0xab, 0xab, 0x8c, 0xa3, 0xe2, 0x7b, 0x74, 0x9a, 0xb7, 0x0a, 0x8f,
+  0x2e, 0x9b, 0xf0, 0xc9, 0x1e, 0xe5, 0xbc, 0x29, 0xa5, 0x83, 0xc4, 0x98,
+  0xa3, 0x14, 0x3e, 0x01, 0x43, 0xf5, 0x5b, 0x6c, 0x73, 0x4d, 0xe0, 0xac,
+  0x3c, 0x21, 0x2e, 0x79, 0x88, 0x98, 0x12, 0x29, 0xf1, 0x0c, 0x8f, 0xc8,
+  0xc6, 0x6a, 0xa6, 0x25, 0x53, 0x87, 0xdd, 0xa8, 0x91, 0xbc, 0x8e, 0x98,
+  0x82, 0xff, 0xec, 0xd7, 0xe7, 0xc8, 0x4a, 0x91, 0x7c, 0xb2, 0xb3, 0xe3,
+  0xc3, 0x52, 0x12, 0x5a, 0x14, 0xf6, 0xd5, 0x33, 0xe7, 0x60, 0x89, 0x7a,
+  0x47, 0xd1, 0x61, 0xbf, 0x3d, 0x82, 0xa5, 0x58, 0xaa, 0x8d, 0x62, 0x2b,
+  0x4d, 0x14, 0xb0, 0xec, 0x79, 0x27, 0x36, 0x1d, 0x11, 0xa0, 0x73, 0x27,
+  0x47, 0x50, 0x3e, 0xc3, 0xa1, 0x1e, 0x44, 0x00, 0xc7, 0x8f, 0xb8, 0xbb,
+  0xc7, 0x15, 0xdb, 0x36, 0x2e, 0xca, 0x58, 0x69, 0x23, 0xe8, 0xee, 0x42,
+  0x9d, 0x4b, 0x48, 0xde, 0xc0, 0xfc, 0x86, 0x53, 0x4a, 0x5c, 0xec, 0x92,
+  0x0a, 0x21, 0x8c, 0xca, 0x9a, 0xc3, 0xc0, 0x14, 0xee, 0xbe, 0x2d, 0x61,
+  0x5b, 0xd5, 0xc6, 0x5f, 0xde, 0x10, 0x73, 0x28, 0x38, 0xd6, 0x47, 0xdc,
+  0x2d, 0x6a, 0x4a, 0x67, 0x01, 0x52, 0xeb, 0xdf, 0x8d, 0xef, 0x58, 0xab,
+  0x19, 0x09, 0x01, 0xc3, 0xcc, 0x8d, 0x2d, 0x0e, 0x87, 0x45, 0xbb, 0x96,
+  0x33, 0x1a, 0xff, 0x6e, 0x11, 0x3a, 0xd8, 0x48, 0x41, 0x8a, 0xab, 0x46,
+  0xa6, 0x4a, 0x7d, 0x85, 0x01, 0x4f, 0xef, 0xb3, 0xb2, 0x92, 0x1f, 0x9e,
+  0x1d, 0x8e, 0x7e, 0xea, 0xac, 0x37, 0x91, 0x94, 0xda, 0x0b, 0x05, 0xf0,
+  0x98, 0x68, 0x23, 0x9b, 0xa0, 0xc1, 0x6f, 0xd7, 0xf7, 0x1c, 0xd8, 0xc1,
+  0xed, 0xf7, 0xf7, 0xa6, 0x7f, 0xf8, 0xfb, 0xa4, 0x00, 0x8b, 0xdc, 0xa9,
+  0x8a, 0xd9, 0xbe, 0x9a, 0x6b, 0x94, 0x46, 0x84, 0x9d, 0xee, 0x07, 0x28,
+  0x7d, 0xb3, 0xd1, 0x2f, 0x04, 0x0a, 0xec, 0x99, 0xe2, 0x98, 0x09, 0x1d,
+  0x22, 0x8e, 0xa0, 0xd6, 0xf1, 0x08, 0x97, 0xbb, 0x0b, 0x42, 0x23, 0xf5,
+  0x5d, 0x2f, 0x4b, 0xd5, 0x64, 0x33, 0xc6, 0xbf, 0x17, 0x00, 0x68, 0xed,
+  0xdc, 0xbf, 0x89, 0x93, 0xce, 0x42, 0xda, 0x7f, 0xab, 0x75, 0x56, 0x87,
+  0x6e, 0x82, 0xea, 0xea, 0xc6, 0x2b, 0x21, 0x32, 0x30, 0x51, 0x13, 0x9b,
+  0x04, 0x02, 0x7c, 0x45, 0x36, 0x8e, 0x71, 0x3c, 0x03, 0x65, 0xa4, 0x62,
+  0xb3, 0x27, 0xff, 0xd2, 0xa2, 0x74, 0xea, 0x68, 0x80, 0x65, 0xe9, 0x6a,
+  0x10, 0xe4, 0xfd, 0x0b, 0x5f, 0x57, 0x64, 0x79, 0xa6, 0x49, 0xcb, 0x94,
+  0x26, 0x3e, 0xae, 0x64, 0x6b, 0xe1, 0x92, 0xe3, 0x98, 0xac, 0x04, 0x18,
+  0xc6, 0xa0, 0x35, 0x9d, 0x2c, 0xd8, 0x87, 0xb3, 0xd8, 0xa2, 0xf3, 0x04,
+  0x4f, 0x32, 0x9a, 0xa3, 0x05, 0x99, 0x77, 0xcb, 0x84, 0xe9, 0x49, 0x5b,
+  0x4b, 0x3a, 0x11, 0x54, 0xb5, 0xe5, 0xc1, 0x89, 0x90, 0x79, 0x8a, 0x66,
+  0x8f, 0xff, 0x16, 0xd8, 0x61, 0x7a, 0x8b, 0x09, 0xe5, 0xfa, 0x9f, 0x98,
+  0x76, 0xed, 0xc8, 0x7d, 0xc6, 0x5a, 0xdb, 0xa2, 0xae, 0x32, 0x45, 0x94,
+  0xbf, 0x35, 0x8d, 0x0f, 0xaf, 0xdb, 0x6b, 0xef, 0xce, 0x41, 0x26, 0x00,
+  0xd5, 0xa7, 0x23, 0x1a, 0x8d, 0xfd, 0x70, 0x37, 0xb1, 0xd3, 0x70, 0xfd,
+  0x6f, 0x09, 0x90, 0x9a, 0x69, 0x60, 0x92, 0x66, 0xe3, 0x13, 0xde, 0xf1,
+  0xb7, 0xf9, 0xfa, 0x4c, 0x00, 0x0a, 0x5c, 0x02, 0x0e, 0x97, 0x9e, 0xe6,
+  0x7b, 0x1b, 0xf4, 0x92, 0x8a, 0xf0, 0x1f, 0x6d, 0xff, 0x2d, 0x17, 0x5c,
+  0xa7, 0x20, 0xf1, 0x46, 0xcd, 0x13, 0xfb, 0x7f, 0x9a, 0x02, 0xab, 0xa0,
+  0x73, 0x7b, 0x17, 0x41, 0xd1, 0xe0, 0x4c, 0x4d, 0xf0, 0xbc, 0xa0, 0x28,
+  0xa1, 0x6d, 0x27, 0xce, 0x73, 0x53, 0xb0, 0x45, 0x81, 0x87, 0xd1, 0xb3,
+  0xf6, 0x57, 0x63, 0x31, 0xa5, 0xff, 0x23, 0xbe, 0x09, 0x57, 0xb6, 0x78,
+  0xda, 0x3e, 0xc3, 0xce, 0x1d, 0xa8, 0x68, 0xcb, 0x74, 0x40, 0x02, 0x7f,
+  0x8b, 0xf3, 0x8e, 0xdc, 0xa6, 0x6d, 0x05, 0x0f, 0xcd, 0x0c, 0xfe, 0x5d,
+  0x2e, 0xb9, 0xfa, 0xae, 0x76, 0x05, 0x98, 0x2b, 0x9c, 0x96, 0xa3, 0xb3,
+  0x67, 0x59, 0xd2, 0xb5, 0x5f, 0xc3, 0x2e, 0xa7, 0x91, 0x27, 0x06, 0x94,
+  0x63, 0x15, 0xd9, 0x3a, 0xe1, 0x44, 0x3a, 0x8c, 0xd8, 0x6d, 0x4f, 0x0a,
+  0x75, 0x85, 0xa1, 0x18, 0x7d, 0xa1, 0x90, 0x3a, 0xb6, 0xbe, 0xdd, 0xbe,
+  0x94, 0xd4, 0xad, 0x48, 0xf7, 0x6a, 0xf8, 0xa4, 0xe9, 0x37, 0x3d, 0x73,
+  0x17, 0xa7, 0x0c, 0xad, 0x1c, 0xed, 0x1c, 0xcf, 0xcd, 0xb6, 0x4e, 0xaa,
+  0x13, 0x32, 0xac, 0xc6, 0xe2, 0xd6, 0xee, 0x0b, 0x12, 0xed, 0xe7, 0xe9,
+  0x40, 0x11, 0x6c, 0x53, 0x0c, 0x90, 0x89, 0x8f, 0x72, 0x22, 0x95, 0xcb,
+  0xdd, 0x33, 0xde, 0xba, 0x8c, 0xf2, 0x97, 0x82, 0x27, 0xe9, 0x47, 0x3e,
+  0x16, 0xdd, 0x42, 0xa1, 0x23, 0x32, 0x10, 0x1b, 0x0b, 0x76, 0x3c, 0x31,
+  0x57, 0x96, 0x5a, 0x70, 0x7a, 0x9f, 0xdb, 0x52, 0x91, 0xb7, 0xf5, 0x65,
+  0x58, 0x22, 0x30, 0x50, 0xb0, 0x6c, 0x70, 0x9e, 0x28, 0x4e, 0xdb, 0x05,
+  0xc9, 0xf5, 0x57, 0x72, 0x82, 0xf1, 0xd8, 0x72, 0xe5, 0xe0, 0x33, 0x45,
+  0xb0, 0xad, 0xd9, 0xd2, 0x35, 0xd1, 0xb8, 0xfa, 0x55, 0x64, 0xd6, 0x86,
+  0x3a, 0x35, 0xe9, 0xb0, 0x37, 0xfb, 0x34, 0x95, 0xba, 0x41, 0x1e, 0x16,
+  0x8c, 0xf5, 0x09, 0xfa, 0x2e, 0x99, 0x19, 0x4b, 0xda, 0x60, 0x94, 0x95,
+  0x9e, 0x32, 0x0f, 0x8d, 0xa7, 0x14, 0xcf, 0xd0, 0x99, 0x17, 0x5f, 0x03,
+  0x03, 0xbb, 0xff, 0x00, 0xa9, 0x62, 0x85, 0x0c, 0x0c, 0x43, 0x22, 0xf3,
+  0x18, 0x50, 0x84, 0x2c, 0x1f, 0xb8, 0x2a, 0x0a, 0x80, 0x30, 0x3b, 0xbd,
+  0xe5, 0xef, 0x29, 0xe5, 0xa3, 0x7b, 0x4c, 0xda, 0x4f, 0x97, 0xdb, 0x71,
+  0x3b, 0x26, 0xfe, 0x99, 0xfe, 0xa9, 0xda, 0xd2, 0xf7, 0x90, 0x9c, 0xfb,
+  0x57, 0x27, 0x68, 0xf4, 0xc7, 0x9b, 0xac, 0x0a, 0x06, 0xab, 0xe4, 0xf0,
+  0xb9, 0x02, 0x72, 0x69, 0x1b, 0xb5, 0x15, 0x2f, 0x63, 0xd6, 0x97, 0xd5,
+  0x2a, 0x02, 0x58, 0x8a, 0x69, 0x23, 0xc1, 0x3f, 0x01, 0x08, 0x87, 0xe4,
+  0x74, 0x29, 0x44, 0x79, 0x53, 0x17, 0xc0, 0x65, 0x6e, 0x7e, 0xf0, 0xa8,
+  0x1a, 0xb2, 0x31, 0x1e, 0x07, 0x80, 0xfd, 0x4a, 0x0c, 0x94, 0x2e, 0xa9,
+  0xfc, 0x34, 0x3d, 0xbd, 0x1e, 0xd5, 0x6b, 0x4e, 0xa9, 0x85, 0xbb, 0x63,
+  0xc3, 0x5b, 0x2a, 0x7a, 0x70, 0x8f, 0x10, 0xdb, 0x97, 0x83, 0xd4, 0x52,
+  0x4d, 0x8b, 0x90, 0xb7, 0xe9, 0x7a, 0xc5, 0x94, 0x5b, 0x58, 0x6b, 0x0e,
+  0xf0, 0x45, 0x45, 0x95, 0x89, 0xf3, 0x03, 0x46, 0xe3, 0x9f, 0x5b, 0x1b,
+  0xec, 0x63, 0xb7, 0x53, 0xf7, 0xf7, 0xd6, 0x65, 0x7b, 0x7b, 0xd0, 0x0b,
+  0x44, 0xc8, 0xae, 0x4a, 0x59, 0x30, 0xe1, 0x5d, 0x75, 0x1e, 0x1b, 0x41,
+  0x3c, 0xdb, 0xc9, 0xff, 0x8a, 0xc4, 0xff, 0x79, 0x5e, 0xdf, 0x59, 0x19,
+  0x67, 0x0d, 0x69, 0xc9, 0x77, 0x7d, 0x8f, 0x4a, 0xde, 0xf1, 0xfd, 0x14,
+  0xbb, 0x49, 0x78, 0xb9, 0x5e, 0x3e, 0x9d, 0xb2, 0xfb, 0x41, 0xfb, 0x04,
+  0x8e, 0xb0, 0x6d, 0x89, 0x19, 0x31, 0x0f, 0xe3, 0xce, 0xe4, 0x30, 0x77,
+  0xf9, 0xf7, 0xfd, 0x56, 0xb0, 0x79, 0xcd, 0x99, 0xc1, 0x69, 0x08, 0xd5,
+  0x92, 0xec, 0xe7, 0x8d, 0xd3, 0xb8, 0xa2, 0x45, 0x5d, 0xde, 0x32, 0xa1,
+  0xe8, 0x94, 0xcd, 0xd1, 0x8b, 0xb3, 0x5e, 0x90, 0x4c, 0xd3, 0xf5, 0x24,
+  0xe8, 0xb3, 0x76, 0x8f, 0x6d, 0x15, 0x46, 0x62, 0xed, 0x1a, 0xdd, 0x92,
+  0x88, 0x99, 0x12, 0xb8, 0x94, 0x59, 0x9a, 0x93, 0x76, 0x68, 0x12, 0xa3,
+  0xf6, 0xc6, 0xfc, 0x03, 0xfc, 0x67, 0xf9, 0x5c, 0x2e, 0xf3, 0x5b, 0xd3,
+  0xb1, 0xfc, 0xeb, 0x9a, 0x51, 0x47, 0x7f, 0xa5, 0x69, 0xd3, 0x5e, 0x15,
+  0x82, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xab, 0x6d, 0x75, 0x01, 0x3a,
+  0x6d, 0x6a, 0x34, 0x29, 0x9b, 0xbe, 0x47, 0x5d, 0x55, 0xae, 0x71, 0x26,
+  0x1d, 0x6f, 0x53, 0x16, 0xeb, 0x04, 0x14, 0x82, 0xb5, 0x9f, 0xa4, 0xf9,
+  0x3d, 0x6c, 0xef, 0xc5, 0xaa, 0xef, 0x8f, 0x2b, 0x0d, 0x3e, 0x64, 0x38,
+  0xa1, 0x9d, 0x33, 0x0e, 0x75, 0xdf, 0x32, 0x7c, 0x66, 0x77, 0xd0, 0xd1,
+  0x10, 0x41, 0x13, 0x2c, 0x76, 0x13, 0x88, 0x4f, 0x4e, 0x65, 0xa4, 0xc3,
+  0xa2, 0x83, 0x8b, 0x93, 0xd1, 0xc8, 0x50, 0x16, 0x5e, 0x0b, 0x17, 0x73,
+  0xe9, 0x91, 0x86, 0x7f, 0xdd, 0x1f, 0x59, 0x3c, 0xd2, 0x86, 0x93, 0x5d,
+  0x6e, 0x97, 0x69, 0xb6, 0x98, 0x6d, 0xde, 0x80, 0x2a, 0xb2, 0x1c, 0xbb,
+  0x64, 0xc5, 0x83, 0x1d, 0xdf, 0x9c, 0x69, 0x8f, 0x57, 0xe5, 0xdc, 0x3f,
+  0x79, 0x18, 0xa6, 0xa7, 0xcb, 0x1e, 0x26, 0x1d, 0x79, 0xd5, 0x0d, 0x9f,
+  0xa5, 0x2b, 0xaf, 0x79, 0x1c, 0x7e, 0xa8, 0x4a, 0xbe, 0xbb, 0xba, 0x09,
+  0x52, 0x55, 0x68, 0x2f, 0xe5, 0xed, 0xac, 0x6d, 0x3a, 0x69, 0x73, 0x1f,
+  0x44, 0x0f, 0x6b, 0x53, 0xdb, 0x22, 0x84, 0x59, 0x07, 0xf7, 0xa4, 0x33,
+  0x6b, 0x21, 0x5e, 0x54, 0x4b, 0xd9, 0x9c, 0x75, 0xe7, 0x8f, 0xe0, 0x89,
+  0x58, 0x54, 0x20, 0xe8, 0xdb, 0x3c, 0xf1, 0xfa, 0xb2, 0x3d, 0x08, 0xaf,
+  0xf9, 0xfe, 0xaa, 0x4b, 0x95, 0x39, 0x53, 0x84, 0xdd, 0x6a, 0x1d, 0xad,
+  0xaf, 0xa3, 0xf5, 0x4b, 0x5f, 0x80, 0x4a, 0x8a, 0x2d, 0x56, 0x4c, 0x58,
+  0x49, 0x94, 0x80, 0xfd, 0x9a, 0x19, 0xe3, 0x9d, 0xa6, 0x7e, 0x9a, 0x13,
+  0x61, 0x2e, 0x86, 0x28, 0xa6, 0xa6, 0x9e, 0x26, 0x43, 0x60, 0xda, 0x20,
+  0xb0, 0x0c, 0x1d, 0x76, 0x0a, 0x9b, 0x22, 0xea, 0xf4, 0xb7, 0x81, 0x29,
+  0xf4, 0x47, 0x5d, 0x16, 0xcf, 0xe9, 0xe2, 0x72, 0x5e, 0xb2, 0x62, 0x38,
+  0x47, 0xf3, 0x1d, 0xeb, 0x7c, 0x1d, 0x9b, 0x6d, 0x1f, 0xf3, 0xf7, 0xee,
+  0x8e, 0xf1, 0xb4, 0xa5, 0x45, 0x0b, 0xa8, 0x93, 0x99, 0x42, 0x9b, 0x32,
+  0x9b, 0xd3, 0xeb, 0x2b, 0xe0, 0x5d, 0x16, 0x12, 0xad, 0x20, 0x8d, 0x26,
+  0x7a, 0xeb, 0xd8, 0xe6, 0xdb, 0x5c, 0x8f, 0x27, 0x5f, 0xbc, 0xa8, 0x2b,
+  0x86, 0x64, 0x7e, 0xc5, 0x45, 0xc3, 0x96, 0xac, 0xea, 0x45, 0x20, 0x2b,
+  0xa1, 0x4c, 0x6c, 0xf0, 0x19, 0xe0, 0x90, 0x4d, 0xb5, 0x7c, 0xcd, 0xae,
+  0x31, 0x79, 0x8f, 0x27, 0xbc, 0x54, 0xc2, 0xa5, 0xc3, 0x40, 0xc4, 0x03,
+  0x69, 0x6e, 0x77, 0xfe, 0x1c, 0x0e, 0xc9, 0xcd, 0xba, 0x50, 0x48, 0x68,
+  0x42, 0xaa, 0xf5, 0x15, 0xcb, 0xe8, 0x51, 0x43, 0xed, 0xbc, 0xd0, 0x45,
+  0x18, 0xe9, 0xbb, 0xe8, 0x1c, 0xcc, 0xf5, 0x02, 0x3c, 0x45, 0x62, 0x5f,
+  0x91, 0x9d, 0x4b, 0xa2, 0x5d, 0xd5, 0xf8, 0x6f, 0x57, 0x31, 0xf2, 0xab,
+  0xe8, 0xf2, 0x09, 0xac, 0x30, 0x24, 0x8f, 0x64, 0x21, 0xc5, 0x6f, 0x6b,
+  0xb2, 0x71, 0x66, 0x1b, 0x0c, 0xba, 0x33, 0xf2, 0xe2, 0xf9, 0xe1, 0x79,
+  0x4a, 0xa5, 0xe4, 0x0e, 0xce, 0xe8, 0x4d, 0x3a, 0xfb, 0x2d, 0x34, 0x50,
+  0xf1, 0x32, 0x08, 0x9e, 0xe6, 0xce, 0x9f, 0x1e, 0xf4, 0x07, 0x1f, 0xf9,
+  0x49, 0x1f, 0xef, 0xd1, 0x32, 0x92, 0x57, 0xc1, 0xd3, 0xd1, 0x5b, 0x06,
+  0x2b, 0x35, 0x3e, 0x2d, 0xcb, 0x31, 0xfc, 0xc8, 0x81, 0x5f, 0xb8, 0x26,
+  0x46, 0xda, 0xa2, 0xb9, 0xec, 0x1a, 0xf5, 0x9f, 0x9c, 0x87, 0x10, 0x1e,
+  0xef, 0x2f, 0x40, 0xad, 0x76, 0x03, 0x61, 0x3b, 0xab, 0xd5, 0x0a, 0x2f,
+  0x07, 0xe4, 0x53, 0xa9, 0x88, 0x68, 0x05, 0x2b, 0x66, 0xc6, 0xa4, 0xb4,
+  0xa7, 0x23, 0x18, 0x3a, 0x55, 0x00, 0x26, 0xa7, 0x12, 0xf7, 0x36, 0x7c,
+  0x65, 0x63, 0xf7, 0x07, 0x45, 0xee, 0x26, 0xdf, 0x70, 0xcd, 0x71, 0xd6,
+  0x4c, 0xf0, 0x15, 0x6d, 0xa7, 0xba, 0x1e, 0xf0, 0x9e, 0xd6, 0x8d, 0xf4,
+  0x0b, 0xe2, 0x8e, 0x77, 0x22, 0x19, 0x22, 0xd9, 0x8e, 0xb1, 0x12, 0x34,
+  0x5e, 0x90, 0xce, 0x56, 0xc0, 0xba, 0x82, 0x1e, 0x65, 0xca, 0x21, 0x11,
+  0x09, 0x52, 0x6c, 0x02, 0x44, 0xee, 0xbe, 0x7e, 0x42, 0xff, 0x70, 0xab,
+  0x9b, 0x1a, 0x9e, 0xc7, 0xeb, 0xf8, 0x10, 0x12, 0x21, 0x27, 0x44, 0xc4,
+  0x7d, 0x32, 0x18, 0xc2, 0xff, 0xf1, 0xe1, 0x22, 0x67, 0x1d, 0x6a, 0x34,
+  0x42, 0xe7, 0xc7, 0xb3, 0xb6, 0x9f, 0x29, 0x4d, 0x70, 0x4e, 0x94, 0xbc,
+  0x91, 0x92, 0x5c, 0xfd, 0x7c, 0xbf, 0x49, 0xc7, 0x68, 0x7b, 0xa6, 0x7e,
+  0x03, 0x10, 0x7f, 0x0d, 0xc5, 0x86, 0x49, 0xd2, 0x7a, 0x4f, 0xf9, 0x95,
+  0xa4, 0x19, 0xea, 0x01, 0xb8, 0xd8, 0x83, 0x35, 0xd7, 0xeb, 0x96, 0x3b,
+  0x08, 0xae, 0x19, 0xac, 0xf2, 0x17, 0x84, 0xce, 0xc9, 0x64, 0x02, 0xa1,
+  0x88, 0x40, 0x8d, 0xee, 0xe0, 0x07, 0x1e, 0x6c, 0x11, 0x29, 0x09, 0x8f,
+  0x99, 0x09, 0xae, 0xa3, 0xf1, 0xdd, 0x00, 0xde, 0xb9, 0x1d, 0x20, 0xc8,
+  0xa3, 0x4c, 0x77, 0xdd, 0xbc, 0x0b, 0x36, 0x0b, 0x78, 0x27, 0xdc, 0x73,
+  0x66, 0xe9, 0x41, 0xe6, 0xbc, 0x70, 0x6f, 0xd7, 0xe8, 0xf9, 0x2e, 0xe4,
+  0xcc, 0xc3, 0xf6, 0x63, 0x35, 0x6d, 0xfc, 0x5a, 0x91, 0x15, 0x4f, 0xe9,
+  0x69, 0xe1, 0xf0, 0x27, 0xdd, 0x20, 0x99, 0x4f, 0x09, 0x26, 0xd9, 0xc5,
+  0x8b, 0x0d, 0x07, 0x0b, 0x18, 0xc4, 0x26, 0x12, 0x40, 0x29, 0x0e, 0x4f,
+  0x5c, 0x93, 0x72, 0xe9, 0x1c, 0x12, 0xb1, 0x12, 0x5f, 0x38, 0xcd, 0x95,
+  0x99, 0x60, 0x64, 0xae, 0xb5, 0x1b, 0x19, 0x9a, 0x66, 0x9e, 0x0a, 0x49,
+  0xd0, 0x21, 0x45, 0x6c, 0x15, 0x1a, 0xa2, 0x0f, 0x8b, 0x18, 0xeb, 0x6e,
+  0x05, 0x2a, 0x65, 0xf7, 0x80, 0xfc, 0xa5, 0x64, 0x10, 0x9d, 0x78, 0x1a,
+  0x94, 0x93, 0x10, 0xd5, 0x85, 0xc0, 0x12, 0xa2, 0x7c, 0x5c, 0x28, 0x1f,
+  0x99, 0xa8, 0xfb, 0xd0, 0x8f, 0x51, 0x70, 0xfa, 0xc7, 0xc3, 0xe5, 0xb3,
+  0xb8, 0x7e, 0x1e, 0xed, 0x00, 0x6b, 0xee, 0x49, 0x4f, 0xc0, 0x1b, 0xc5,
+  0x1e, 0xfb, 0xd3, 0xcc, 0x06, 0xe5, 0xa4, 0x05, 0x32, 0x5f, 0xa1, 0x7a,
+  0x1f, 0x3b, 0xb3, 0x75, 0xa4, 0xa5, 0xa6, 0xba, 0x35, 0xc5, 0x4c, 0x45,
+  0xc6, 0x30, 0x38, 0x73, 0x65, 0xfd, 0xde, 0x0a, 0xbe, 0x35, 0x8e, 0xbc,
+  0x7d, 0x32, 0xe8, 0x45, 0x2a, 0xb9, 0x36, 0xf0, 0x54, 0x6e, 0x73, 0x56,
+  0x98, 0x97, 0x2f, 0x3d, 0x78, 0xc5, 0x5a, 0x78, 0x6f, 0x03, 0xe5, 0x6d,
+  0xbc, 0xfb, 0xbe, 0xb4, 0xc7, 0xac, 0xc5, 0x45, 0x20, 0x64, 0x10, 0xd3,
+  0xc4, 0xa0, 0x53, 0x3e, 0x42, 0xba, 0x26, 0xab, 0x79, 0x5c, 0xad, 0x35,
+  0xaa, 0xe1, 0xc1, 0x3f, 0xa3, 0x6d, 0xcf, 0xa0, 0x10, 0x65, 0x34, 0x99,
+  0x5f, 0xb4, 0x5b, 0xeb, 0x19, 0x1c, 0xcf, 0x45, 0x43, 0x9d, 0xd5, 0xed,
+  0x19, 0x7e, 0xc4, 0x93, 0x6c, 0x38, 0x7d, 0xc6, 0x96, 0x1a, 0xf9, 0x56,
+  0x77, 0xab, 0x86, 0x78, 0x96, 0x70, 0x06, 0x37, 0xf4, 0x47, 0xad, 0x69,
+  0xb7, 0xf6, 0x48, 0xaa, 0x08, 0x9e, 0xd1, 0x88, 0xce, 0xa8, 0xf7, 0x29,
+  0x9d, 0x95, 0x21, 0x2d, 0x9b, 0x83, 0x83, 0x83, 0x08, 0x1e, 0xf1, 0xe0,
+  0x83, 0xa8, 0x53, 0x14, 0xa0, 0xf1, 0x0e, 0x0e, 0x52, 0x42, 0x7a, 0x45,
+  0xa7, 0xc2, 0x0a, 0x48, 0xf9, 0x71, 0xfd, 0xc8, 0xd7, 0x07, 0x66, 0x10,
+  0x7b, 0x08, 0xc4, 0xbc, 0xe3, 0x4e, 0x18, 0x96, 0xac, 0xcf, 0x77, 0xcf,
+  0xb2, 0x35, 0x4d, 0xa5, 0x7c, 0x69, 0xbb, 0xb5, 0x2c, 0xd7, 0xfd, 0x85,
+  0x91, 0xae, 0x37, 0xc0, 0x18, 0x76, 0xa7, 0x78, 0x06, 0x86, 0x00, 0xde,
+  0x31, 0x21, 0xbb, 0xf7, 0x11, 0xb0, 0x22, 0x2d, 0x8e, 0x2a, 0xd8, 0xe9,
+  0x4f, 0x2c, 0xea, 0x6a, 0x7d, 0x5e, 0x32, 0x48, 0xaa, 0x84, 0xc1, 0xb0,
+  0x17, 0x61, 0x63, 0x99, 0x47, 0xba, 0xdb, 0xfe, 0x18, 0xe8, 0xc4, 0x67,
+  0xb0, 0x64, 0xc1, 0x27, 0x69, 0x05, 0x97, 0x86, 0x19, 0xfe, 0xf7, 0xb7,
+  0x48, 0x98, 0xa6, 0x54, 0xb2, 0xcb, 0x0c, 0x46, 0xcf, 0xbc, 0x2d, 0xc2,
+  0x77, 0x28, 0xad, 0xc4, 0xe1, 0x9b, 0xd0, 0xf9, 0x59, 0x29, 0xef, 0x0a,
+  0x1a, 0x3d, 0x6c, 0x53, 0x37, 0x90, 0x72, 0x06, 0x8f, 0x6a, 0xa3, 0x3d,
+  0x26, 0xf3, 0x98, 0x41, 0xb0, 0x6d, 0xe3, 0xfd, 0x77, 0xf2, 0xae, 0x58,
+  0xc6, 0xad, 0x9e, 0xc9, 0x08, 0x01, 0x94, 0xf9, 0xf6, 0xa7, 0x4b, 0xdc,
+  0xad, 0xa3, 0x0a, 0xfa, 0xd3, 0x85, 0x44, 0x73, 0xd1, 0x26, 0x47, 0xc1,
+  0x59, 0x77, 0x32, 0x4f, 0xf0, 0x51, 0x98, 0xe2, 0x0e, 0x6c, 0xff, 0x71,
+  0xba, 0xfe, 0xf2, 0x6b, 0x09, 0xb2, 0x1e, 0xec, 0xee, 0x21, 0x12, 0x98,
+  0x2e, 0xe3, 0x2e, 0x1f, 0x9e, 0xfe, 0x9b, 0x80, 0x4e, 0x00, 0x7c, 0x4d,
+  0x1a, 0xae, 0x4f, 0xd9, 0xe1, 0x8b, 0x3c, 0x08, 0xbf, 0x4a, 0xc7, 0x0b,
+  0xea, 0x02, 0xa1, 0x9d, 0x9a, 0x13, 0x31, 0xa7, 0xf6, 0x2e, 0x23, 0xf2,
+  0xf0, 0xfa, 0x0d, 0x05, 0xde, 0x66, 0xf8, 0x9d, 0xd1, 0x85, 0xc4, 0xcd,
+  0xcf, 0x3a, 0xfc, 0x15, 0x85, 0x05, 0x04, 0xc1, 0x52, 0x4a, 0xb1, 0x69,
+  0x75, 0x2b, 0xac, 0xe9, 0xb2, 0x88, 0x18, 0x7a, 0x42, 0xee, 0x03, 0xe7,
+  0xb7, 0x06, 0x61, 0x6b, 0x9b, 0x56, 0x83, 0xfc, 0xa2, 0x2e, 0x5b, 0xe9,
+  0xc3, 0x6f, 0x52, 0xbe, 0x10, 0x7d, 0x78, 0xe7, 0x81, 0x8d, 0xc9, 0x31,
+  0xc0, 0xc4, 0x38, 0x32, 0x94, 0x6a, 0x42, 0x70, 0x81, 0xdc, 0xf8, 0x11,
+  0xb3, 0x12, 0x2f, 0xce, 0x4f, 0xb6, 0xbe, 0xae, 0x25, 0x94, 0xea, 0xf0,
+  0x71, 0x57, 0xa7, 0xf0, 0x75, 0xe0, 0x09, 0xde, 0x08, 0xb0, 0x23, 0x59,
+  0xe6, 0xfe, 0xd3, 0xcb, 0xdb, 0x3c, 0xcd, 0x80, 0x38, 0x7e, 0x7a, 0x7d,
+  0xb9, 0xef, 0x6f, 0x56, 0x78, 0x4d, 0x68, 0x66, 0x25, 0x68, 0xa4, 0xe5,
+  0x58, 0xbb, 0xdc, 0x23, 0x3e, 0x78, 0xd0, 0x57, 0xb8, 0xc4, 0xd0, 0xf4,
+  0x80, 0x4e, 0x47, 0x5b, 0xc3, 0x88, 0x5d, 0x12, 0x76, 0xb7, 0xb8, 0xb9,
+  0x77, 0xd7, 0x69, 0x25, 0x51, 0xb4, 0x74, 0x08, 0x42, 0x47, 0xae, 0x12,
+  0x0a, 0x11, 0x02, 0x03, 0xab, 0xd3, 0xce, 0x20, 0xec, 0x0e, 0xe3, 0x7e,
+  0xbc, 0xc5, 0xf2, 0x16, 0xec, 0x89, 0xfe, 0xae, 0xda, 0xb9, 0x97, 0xe6,
+  0x20, 0x73, 0xae, 0x51, 0xc8, 0xd0, 0x8d, 0xc3, 0xc3, 0xeb, 0xdc, 0x21,
+  0xd1, 0x3c, 0x32, 0xbe, 0xcf, 0xc9, 0xf0, 0x7f, 0x05, 0x66, 0x2d, 0xd4,
+  0x70, 0x20, 0x5b, 0xe1, 0x7b, 0x2b, 0x13, 0x13, 0x81, 0x83, 0xb9, 0xdb,
+  0x63, 0xab, 0x59, 0xf1, 0xd7, 0xe1, 0x70, 0x57, 0x6f, 0x2e, 0x79, 0x3d,
+  0xd8, 0xa0, 0x3a, 0x1e, 0x73, 0xf5, 0x38, 0x35, 0x4e, 0x2e, 0x15, 0xa4,
+  0xe9, 0x70, 0xca, 0x7d, 0xfa, 0x5a, 0xe6, 0x6a, 0x8d, 0x92, 0xee, 0xde,
+  0xc1, 0x63, 0xe7, 0x01, 0xf5, 0xee, 0xeb, 0xb5, 0x94, 0xf5, 0x96, 0x5c,
+  0x95, 0xe5, 0xba, 0xff, 0xd2, 0xf7, 0x6b, 0x0e, 0x4a, 0x08, 0x8c, 0xda,
+  0xf2, 0x42, 0x7e, 0xd9, 0x0c, 0x41, 0x90, 0xd1, 0x91, 0x1f, 0xf3, 0xb3,
+  0xf6, 0x24, 0xab, 0x70, 0x36, 0xf2, 0x07, 0x0b, 0xec, 0x04, 0x9d, 0xec,
+  0xfd, 0x9d, 0x95, 0x7b, 0x6e, 0x33, 0x5f, 0xa1, 0xcd, 0x2d, 0x38, 0x92,
+  0x0f, 0xa6, 0xd1, 0xfa, 0xd3, 0x22, 0x48, 0x3f, 0x61, 0xe8, 0x56, 0xb9,
+  0xff, 0x5c, 0x77, 0x44, 0x9e, 0x70, 0x2b, 0x27, 0xd0, 0x57, 0x5a, 0x87,
+  0xc2, 0xa6, 0xff, 0xfa, 0x54, 0x00, 0xda, 0xa7, 0x53, 0x22, 0x80, 0x1d,
+  0xd9, 0xd8, 0x1d, 0xb5, 0x02, 0xc3, 0xa8, 0xe1, 0x1d, 0x1d, 0x22, 0x15,
+  0x2c, 0xe0, 0xf2, 0x9d, 0xec, 0xa6, 0xea, 0xb0, 0xa6, 0xd1, 0xf2, 0x6e,
+  0x65, 0x72, 0xa5, 0x2e, 0xd9, 0xd6, 0x1c, 0x1e, 0xaf, 0x05, 0x43, 0xa8,
+  0x3b, 0xac, 0x29, 0x52, 0xf9, 0xef, 0x56, 0xd2, 0xf2, 0x9d, 0xed, 0x19,
+  0x11, 0x30, 0xd7, 0xc0, 0x02, 0x0f, 0x60, 0x82, 0x38, 0xe2, 0x01, 0xb0,
+  0x3d, 0x23, 0xb7, 0x0a, 0x9f, 0x7a, 0x56, 0x83, 0x7d, 0x1a, 0xbe, 0x87,
+  0x24, 0x78, 0x6e, 0x04, 0x0d, 0x8b, 0xc4, 0x95, 0x41, 0xa3, 0xbd, 0x0d,
+  0xb2, 0x57, 0x2f, 0xeb, 0xf9, 0xc7, 0x26, 0x62, 0xa9, 0x2a, 0x9f, 0x95,
+  0x31, 0x5b, 0x99, 0xb8, 0x83, 0x9b, 0x28, 0x0a, 0x62, 0x2c, 0x06, 0x2c,
+  0x41, 0x48, 0x66, 0x26, 0x64, 0x0a, 0x49, 0x54, 0xc8, 0x82, 0x64, 0xdd,
+  0x2f, 0x23, 0x3c, 0x8d, 0xa5, 0xcf, 0xed, 0x32, 0xe9, 0xad, 0xb2, 0xbc,
+  0x69, 0xe4, 0xe9, 0xe7, 0xc8, 0x87, 0x32, 0xbc, 0x35, 0xd9, 0xfe, 0xb1,
+  0x12, 0x91, 0x9b, 0x15, 0x23, 0x08, 0x44, 0x78, 0x1b, 0x8e, 0x95, 0x6e,
+  0xc7, 0x09, 0xce, 0x68, 0x12, 0x0a, 0xa2, 0x0c, 0x56, 0x7a, 0xf8, 0xdb,
+  0x95, 0xfc, 0x0e, 0xec, 0x94, 0x62, 0xfb, 0x28, 0x56, 0x88, 0x88, 0x8a,
+  0x73, 0xdb, 0x74, 0x2c, 0x10, 0x00, 0x81, 0x93, 0xa1, 0x6c, 0x64, 0x50,
+  0x9d, 0xdb, 0xd0, 0x88, 0x9a, 0x0a, 0xc7, 0x08, 0x0b, 0x51, 0xad, 0x1f,
+  0x90, 0x53, 0xc1, 0x0b, 0x7a, 0xcf, 0x44, 0x65, 0x49, 0xb4, 0x4d, 0x11,
+  0xba, 0x77, 0x0a, 0x3b, 0x40, 0xd7, 0x49, 0x26, 0x0e, 0x00, 0xb6, 0xe6,
+  0x7c, 0x8a, 0xac, 0xae, 0x50, 0x04, 0xe4, 0x30, 0x03, 0x9c, 0x2d, 0x38,
+  0xcf, 0x35, 0x69, 0x3b, 0xef, 0xdc, 0xc6, 0x9f, 0x58, 0xc2, 0x78, 0x29,
+  0x22, 0xee, 0xa5, 0xb1, 0x97, 0x9b, 0xf8, 0x73, 0xaa, 0xe7, 0x3e, 0x0f,
+  0x5c, 0x85, 0x46, 0xb0, 0x23, 0x04, 0x99, 0x6d, 0x84, 0xfd, 0x43, 0xc2,
+  0x07, 0xd3, 0x4c, 0x87, 0x3a, 0x5f, 0x72, 0xce, 0x6d, 0x8d, 0xb5, 0xeb,
+  0x03, 0x85, 0xf9, 0x45, 0x7f, 0x93, 0x58, 0x1e, 0xf2, 0x3c, 0x59, 0x6b,
+  0x43, 0xef, 0x51, 0x12, 0xd7, 0x07, 0x0c, 0x73, 0x12, 0xd3, 0xf0, 0x76,
+  0x3f, 0xc0, 0x6d, 0x92, 0x58, 0x42, 0xe8, 0x75, 0x9b, 0x21, 0x1d, 0x18,
+  0xe6, 0x3c, 0x69, 0x9b, 0xae, 0x50, 0x57, 0xc4, 0x8b, 0xef, 0x4c, 0x90,
+  0xc6, 0x94, 0x47, 0x72, 0x18, 0x45, 0x06, 0x61, 0x6d, 0x03, 0x3e, 0x7a,
+  0xdf, 0x0e, 0x7e, 0x6a, 0x09, 0xef, 0x0d, 0x15, 0xde, 0x01, 0x35, 0xc3,
+  0x7f, 0x4f, 0x8e, 0x29, 0xa2, 0xc8, 0x2f, 0x2c, 0x6c, 0x5d, 0x0c, 0x51,
+  0x71, 0x77, 0x0f, 0x08, 0xdb, 0xf1, 0x89, 0xad, 0xd7, 0xd6, 0xfb, 0xd8,
+  0x08, 0x8e, 0xb5, 0x8f, 0x8f, 0xb8, 0xe9, 0xe6, 0x02, 0x08, 0x96, 0x66,
+  0xcb, 0x50, 0x91, 0xfd, 0xd5, 0xee, 0x9d, 0x93, 0x4f, 0xdc, 0x96, 0x7a,
+  0xe3, 0x6d, 0x73, 0x80, 0x33, 0x21, 0xdf, 0x34, 0x71, 0x78, 0x6e, 0xe2,
+  0xaa, 0x4d, 0xfe, 0x4f, 0xd4, 0x11, 0xc9, 0x58, 0xbe, 0x59, 0xcd, 0xb6,
+  0xb7, 0x27, 0xa9, 0x71, 0x67, 0x7f, 0x8f, 0x8f, 0x6e, 0xd9, 0x83, 0x83,
+  0x83, 0x0e, 0x07, 0xbf, 0xbb, 0xd3, 0x6e, 0x56, 0x8d, 0xcb, 0x2a, 0xe7,
+  0x79, 0x7f, 0x18, 0x74, 0x89, 0xd4, 0x05, 0x76, 0xab, 0x36, 0xbd, 0x81,
+  0xeb, 0x29, 0x41, 0x74, 0xef, 0x58, 0x48, 0x03, 0x87, 0x51, 0x79, 0x7f,
+  0x1b, 0x9c, 0x80, 0xcb, 0xbb, 0x22, 0xc8, 0xe5, 0x4e, 0x79, 0x8d, 0x96,
+  0x6b, 0xf5, 0x99, 0xda, 0x63, 0x28, 0xaf, 0x01, 0x31, 0x05, 0xe9, 0x88,
+  0xf2, 0xfb, 0xdd, 0xc3, 0xce, 0x6d, 0x4a, 0x56, 0xb7, 0xca, 0x3d, 0xf6,
+  0xec, 0x4a, 0x83, 0x6a, 0x03, 0xd3, 0xf4, 0xf4, 0x2b, 0x94, 0xe9, 0xd1,
+  0xa6, 0x7a, 0x49, 0xfd, 0x3f, 0xca, 0x3e, 0xa2, 0xc8, 0x49, 0x06, 0xc5,
+  0x91, 0xfc, 0x42, 0xfd, 0x88, 0xc2, 0x73, 0xad, 0x36, 0x06, 0x13, 0x3e,
+  0x89, 0xfb, 0x5b, 0x2b, 0xf3, 0xbf, 0x49, 0x26, 0x95, 0x5b, 0x6d, 0x60,
+  0xd0, 0x2a, 0x0a, 0x82, 0x4f, 0xc0, 0x75, 0x88, 0xd4, 0x51, 0x1e, 0x66,
+  0xa0, 0xdc, 0xc7, 0x7c, 0xe2, 0x6d, 0x88, 0xa4, 0x98, 0xaf, 0xa2, 0xfa,
+  0x3c, 0xae, 0xf0, 0xa1, 0x93, 0xec, 0x62, 0xb7, 0x3d, 0x0f, 0x1b, 0x7c,
+  0x1b, 0xec, 0xc2, 0xf3, 0xe1, 0x0f, 0x6d, 0x57, 0xd2, 0x35, 0xd4, 0xb1,
+  0x4d, 0xf0, 0x62, 0x99, 0xdc, 0x01, 0xda, 0x26, 0x87, 0xb9, 0xa2, 0xe0,
+  0xe5, 0x76, 0xe2, 0x3e, 0x80, 0x82, 0xd8, 0x76, 0xc7, 0x8e, 0xa1, 0xab,
+  0xe9, 0xdd, 0x99, 0xc7, 0x35, 0x81, 0x3f, 0xff, 0xe4, 0x8a, 0x2f, 0x8a,
+  0x3a, 0x8d, 0xd6, 0xe8, 0x4b, 0x3d, 0xf0, 0xf8, 0xe3, 0x1d, 0x98, 0x83,
+  0x6d, 0x53, 0x16, 0x2e, 0x74, 0x84, 0x19, 0xf9, 0x4d, 0x8a, 0xb8, 0x13,
+  0x5b, 0x8f, 0xa0, 0x2b, 0x38, 0x06, 0xac, 0xc8, 0x15, 0xbf, 0xcc, 0x0f,
+  0x66, 0x68, 0x75, 0x3d, 0x51, 0x19, 0x04, 0x03, 0xb6, 0xec, 0xd6, 0x70,
+  0x09, 0x7d, 0x17, 0xef, 0xf1, 0xb6, 0xe4, 0x81, 0x88, 0x8c, 0x80, 0xad,
+  0x8e, 0x7f, 0x9d, 0xb3, 0x3a, 0xeb, 0x8b, 0xad, 0xde, 0x84, 0xde, 0xc5,
+  0xfd, 0xd6, 0x34, 0x5b, 0xbd, 0x08, 0xfc, 0xd6, 0x0d, 0x01, 0x4b, 0xc4,
+  0xa0, 0x4a, 0x1b, 0x9c, 0xae, 0x1a, 0x97, 0x1e, 0xbe, 0x0b, 0xc9, 0xab,
+  0x2c, 0x9b, 0x75, 0xde, 0xd2, 0xb1, 0x9e, 0xda, 0x82, 0x3c, 0x82, 0x25,
+  0xa2, 0x8f, 0xe7, 0x9d, 0x00, 0x9c, 0x05, 0x56, 0x82, 0x71, 0xab, 0x96,
+  0x99, 0x65, 0x90, 0x2c, 0x59, 0x18, 0xb7, 0xf5, 0x6b, 0x63, 0x26, 0x91,
+  0x35, 0x2e, 0xc2, 0xaf, 0x33, 0xb4, 0xad, 0x57, 0xa7, 0x9c, 0x3b, 0x51,
+  0x2d, 0xa4, 0xf2, 0x75, 0xaa, 0x43, 0x07, 0x6d, 0x39, 0x5d, 0x21, 0x77,
+  0x9e, 0x81, 0x1d, 0xba, 0xf6, 0x19, 0x86, 0xb1, 0x7f, 0x81, 0x36, 0xf9,
+  0x1e, 0x31, 0x93, 0xdc, 0x5b, 0xd6, 0xb3, 0x09, 0xf8, 0x0f, 0xe0, 0x9a,
+  0xe6, 0x64, 0x16, 0x0b, 0x7f, 0x85, 0x40, 0x86, 0x1c, 0x2a, 0x7e, 0x64,
+  0x8c, 0x7d, 0x0a, 0xcd, 0x83, 0xdd, 0x58, 0x9a, 0x27, 0x93, 0x19, 0xfb,
+  0x98, 0xc4, 0x98, 0x52, 0xfa, 0xd2, 0xde, 0x18, 0x9f, 0x18, 0x5c, 0xa1,
+  0xcd, 0xc4, 0x38, 0xa1, 0x76, 0xdf, 0xd9, 0xb0, 0xe2, 0x76, 0x35, 0x1d,
+  0xfe, 0xa5, 0x7e, 0x28, 0x7b, 0xfe, 0x8c, 0x45, 0xf3, 0xb9, 0xb6, 0xb6,
+  0x2c, 0x19, 0xc1, 0xde, 0x40, 0xd7, 0x8a, 0x08, 0xe8, 0x94, 0x2f, 0x20,
+  0xfa, 0x09, 0x10, 0x45, 0xe7, 0xa7, 0x69, 0x04, 0xba, 0x49, 0x78, 0x7b,
+  0x27, 0x99, 0xb4, 0x94, 0x92, 0x15, 0x40, 0xb8, 0xdf, 0x40, 0x09, 0x13,
+  0x92, 0x2f, 0xc9, 0x7d, 0xe1, 0x01, 0xf3, 0x10, 0x48, 0x19, 0x43, 0x5e,
+  0xcf, 0xff, 0x5c, 0x05, 0xe1, 0x14, 0x67, 0xca, 0x70, 0x27, 0xd4, 0x2c,
+  0x0e, 0x16, 0x2f, 0x52, 0x81, 0xb3, 0xf2, 0xbf, 0x9c, 0x40, 0x66, 0x4b,
+  0xa4, 0x50, 0xcb, 0x38, 0x13, 0x08, 0x24, 0x51, 0xc0, 0x8b, 0xf3, 0xac,
+  0xa7, 0xe2, 0xa5, 0x5a, 0x7a, 0x5a, 0x56, 0x24, 0xf3, 0xe2, 0xd9, 0x62,
+  0x7d, 0x7e, 0xdf, 0x66, 0xcb, 0x29, 0x47, 0x95, 0x61, 0x75, 0xba, 0x9d,
+  0x6b, 0xce, 0x5e, 0x1a, 0xa7, 0xee, 0xe3, 0x05, 0xfa, 0x75, 0x54, 0xca,
+  0xc5, 0x61, 0xed, 0x2a, 0x5b, 0xaf, 0x1d, 0xfc, 0xfe, 0x43, 0x3b, 0xcf,
+  0xd4, 0x87, 0x63, 0xe2, 0x2a, 0xef, 0x04, 0x7e, 0x6a, 0x6b, 0x24, 0x34,
+  0x79, 0x51, 0x2d, 0x8a, 0x95, 0x68, 0x9a, 0xd2, 0x5c, 0x15, 0xfe, 0xdf,
+  0x8a, 0xfc, 0x18, 0x20, 0x2d, 0x3c, 0xca, 0x56, 0xf4, 0xb4, 0x2c, 0xb8,
+  0xa3, 0xf2, 0x7d, 0xdf, 0xf5, 0x93, 0xf2, 0x05, 0x4c, 0x4d, 0xd0, 0x73,
+  0x7b, 0x35, 0x15, 0xdf, 0x9f, 0xeb, 0x16, 0x04, 0xd8, 0x41, 0x02, 0x69,
+  0xcf, 0x64, 0x96, 0x1a, 0x2e, 0xb3, 0xfa, 0xab, 0xb3, 0xcb, 0x2a, 0x68,
+  0xea, 0x71, 0x0a, 0x4d, 0xdf, 0x27, 0x64, 0xd9, 0x29, 0x83, 0x75, 0x12,
+  0xf8, 0x2d, 0xf5, 0xc0, 0x40, 0xe0, 0x96, 0x5b, 0xf4, 0xfc, 0x4b, 0xde,
+  0xaa, 0x8c, 0x19, 0x20, 0xb6, 0x10, 0xde, 0x06, 0xfd, 0xd1, 0x84, 0x71,
+  0xbf, 0x63, 0xf5, 0x07, 0x51, 0xd1, 0x03, 0x26, 0x01, 0x77, 0xe1, 0x13,
+  0x90, 0x4f, 0xd1, 0xd7, 0xc0, 0x2e, 0x25, 0x44, 0x5a, 0x0b, 0xc4, 0x7e,
+  0xeb, 0x67, 0x14, 0xfb, 0xc0, 0xf7, 0x98, 0x5c, 0xf4, 0x4d, 0x27, 0xf7,
+  0x19, 0x21, 0xf2, 0x63, 0x9d, 0x23, 0xa4, 0xab, 0x41, 0x62, 0xbb, 0x9c,
+  0x93, 0x00, 0x61, 0xd0, 0xc5, 0xc2, 0x00, 0xcf, 0x2d, 0x94, 0x0d, 0x1a,
+  0x9c, 0xab, 0x92, 0x6a, 0x68, 0xa7, 0x30, 0x78, 0xaa, 0x99, 0x54, 0x39,
+  0xff, 0x33, 0xb4, 0xd6, 0x31, 0x4f, 0xff, 0x05, 0xe4, 0x3a, 0x27, 0xb7,
+  0x7e, 0xe2, 0xe1, 0xef, 0x85, 0xae, 0xbe, 0xfc, 0x64, 0xd0, 0x2f, 0x36,
+  0xe1, 0x55, 0x81, 0x58, 0x64, 0x14, 0x55, 0x20, 0xb1, 0x2b, 0xc6, 0xa4,
+  0xfa, 0x1b, 0x32, 0x99, 0x34, 0x53, 0x43, 0xb9, 0x32, 0x6a, 0x58, 0x2c,
+  0x00, 0xe7, 0x4a, 0xb1, 0xd0, 0x35, 0xf5, 0xf3, 0x13, 0x48, 0xc8, 0x68,
+  0x00, 0xd5, 0x1b, 0x0b, 0x59, 0xcd, 0x16, 0xf3, 0xde, 0x4e, 0x65, 0x9e,
+  0x1d, 0x7a, 0x1a, 0xc0, 0xda, 0x40, 0x03, 0xe5, 0xa7, 0x01, 0x33, 0x4a,
+  0xb0, 0xcb, 0xb9, 0xee, 0x34, 0xa6, 0x20, 0xbf, 0x51, 0x64, 0xc1, 0x9f,
+  0x0b, 0x45, 0xbc, 0xfa, 0x1f, 0xd4, 0x63, 0x20, 0xa5, 0xa9, 0x6b, 0x9e,
+  0x52, 0x12, 0x17, 0xfa, 0x49, 0x63, 0x6a, 0x11, 0xb0, 0x3c, 0xc0, 0xbe,
+  0x6e, 0x51, 0x51, 0xd6, 0xc3, 0xea, 0x1d, 0x4e, 0xbb, 0xbd, 0xdb, 0x18,
+  0x20, 0x6e, 0x51, 0xfd, 0x6b, 0x84, 0x7f, 0x73, 0x0a, 0x29, 0x4d, 0x2f,
+  0x4e, 0x2e, 0x92, 0xc9, 0x85, 0x4f, 0x9d, 0x97, 0x6e, 0x84, 0x98, 0x25,
+  0xef, 0x74, 0x69, 0xf2, 0x50, 0xef, 0x99, 0x93, 0x53, 0x21, 0xd0, 0xd4,
+  0xc9, 0x0e, 0x17, 0xaa, 0x51, 0x3b, 0x01, 0xfe, 0xb2, 0x24, 0x28, 0x45,
+  0x3b, 0xff, 0x79, 0x3b, 0x9a, 0x8c, 0x82, 0xb9, 0x2d, 0x23, 0xd9, 0x4e,
+  0x5e, 0xe1, 0x85, 0xfb, 0x81, 0x8b, 0xcf, 0x7e, 0xa7, 0xee, 0xc3, 0x75,
+  0xbc, 0x67, 0xe3, 0x7a, 0x69, 0x61, 0x43, 0xb6, 0x4c, 0x04, 0x6f, 0xc9,
+  0x02, 0x55, 0xd4, 0x40, 0xa8, 0x00, 0xcb, 0xc0, 0x52, 0x27, 0x90, 0x8a,
+  0x1a, 0x5c, 0x3c, 0x8a, 0xe8, 0x39, 0xf2, 0x45, 0x18, 0xd7, 0x17, 0x17,
+  0x26, 0x6b, 0x70, 0xbc, 0xb0, 0x11, 0x5e, 0xfd, 0x8b, 0x66, 0x4a, 0x85,
+  0x46, 0x15, 0x10, 0x2e, 0x2d, 0xfe, 0x61, 0x24, 0x2f, 0xd1, 0xfc, 0xe1,
+  0xe1, 0x82, 0x6d, 0x67, 0x25, 0x21, 0x02, 0x7b, 0xd4, 0xaf, 0x70, 0x68,
+  0xab, 0x7f, 0xcd, 0xca, 0xef, 0xcc, 0x01, 0x19, 0x4c, 0x2a, 0xc9, 0xbe,
+  0x31, 0x92, 0x83, 0x36, 0x19, 0xdf, 0x71, 0xae, 0x1d, 0x1a, 0x66, 0x77,
+  0xca, 0xd9, 0x94, 0x51, 0x20, 0xdd, 0x8a, 0xcf, 0x2a, 0x55, 0x1d, 0x30,
+  0x2f, 0x72, 0xbd, 0x13, 0x30, 0x30, 0x4a, 0xe1, 0x0c, 0x30, 0x52, 0x3c,
+  0x8b, 0x34, 0x69, 0x32, 0x09, 0x48, 0x33, 0x98, 0x7a, 0xbf, 0xa7, 0xd0,
+  0x14, 0x98, 0x96, 0x48, 0xf1, 0x75, 0x25, 0xd1, 0x79, 0x0d, 0x5b, 0xc0,
+  0x2f, 0x64, 0x79, 0x99, 0x35, 0x08, 0x7b, 0x3b, 0xb6, 0xe5, 0xad, 0x26,
+  0x74, 0x3b, 0xcd, 0x56, 0xb8, 0x58, 0xb3, 0x5f, 0x80, 0x42, 0xb1, 0x63,
+  0x01, 0x7e, 0x89, 0xf3, 0x14, 0xb3, 0x40, 0x55, 0xdf, 0xf4, 0x55, 0x52,
+  0x70, 0x9f, 0xa0, 0xf6, 0xdc, 0xc2, 0xab, 0x6c, 0x3d, 0xfd, 0x63, 0x43,
+  0x66, 0x66, 0xb6, 0x94, 0x75, 0x7a, 0xa2, 0x23, 0xd5, 0x68, 0x1d, 0xfd,
+  0xaf, 0x05, 0x64, 0x99, 0x83, 0x2e, 0x3f, 0xb3, 0xf6, 0xbf, 0xb6, 0x28,
+  0x97, 0x4d, 0x8e, 0x31, 0xd9, 0x21, 0x64, 0x6d, 0xb6, 0x7a, 0xc1, 0x49,
+  0x73, 0x8d, 0x50, 0xaf, 0x2a, 0x25, 0x95, 0x5c, 0x64, 0xd9, 0x49, 0x5d,
+  0x43, 0xd6, 0x19, 0xbc, 0x14, 0x8f, 0x7d, 0xfe, 0x7a, 0xcc, 0xd9, 0x23,
+  0xf0, 0xf0, 0x29, 0xbd, 0xe2, 0xb4, 0xfe, 0x9c, 0x49, 0xd5, 0x36, 0xa2,
+  0xf4, 0x13, 0x20, 0xbc, 0x1b, 0xf3, 0x90, 0x9a, 0x81, 0xa6, 0x76, 0x55,
+  0x0e, 0xb3, 0x6b, 0xa3, 0x36, 0x0a, 0xa1, 0x43, 0x49, 0x05, 0x1b, 0x48,
+  0x87, 0xed, 0x06, 0xae, 0xc1, 0x59, 0x8a, 0x67, 0xef, 0xb9, 0xe8, 0x6e,
+  0xcf, 0xfc, 0x83, 0xd0, 0x23, 0x8b, 0x29, 0x85, 0x1f, 0xdd, 0xc4, 0x6f,
+  0x05, 0x81, 0xe2, 0xb7, 0x59, 0xe9, 0x81, 0x19, 0x65, 0xc4, 0x44, 0x37,
+  0xca, 0x4b, 0x9a, 0xf4, 0x19, 0x01, 0x0e, 0xd1, 0xc9, 0x38, 0xe4, 0xa8,
+  0xb9, 0x6d, 0xb3, 0x4c, 0x59, 0x49, 0x90, 0x85, 0xaa, 0x5a, 0x65, 0x7d,
+  0xef, 0x25, 0x87, 0x53, 0x39, 0x3c, 0x64, 0x4e, 0xc2, 0x96, 0x96, 0x08,
+  0x76, 0x4f, 0x10, 0x4b, 0x33, 0x20, 0xc0, 0x2c, 0x9b, 0x92, 0x25, 0xbd,
+  0x3e, 0x7d, 0x7e, 0xd5, 0xb5, 0x2a, 0x47, 0xb6, 0xcf, 0x26, 0x66, 0x02,
+  0x14, 0x39, 0x9e, 0x1a, 0x3c, 0xc7, 0xa5, 0x4e, 0xf4, 0xca, 0x08, 0x53,
+  0xb8, 0xd4, 0xc2, 0x50, 0x1c, 0x24, 0x39, 0x30, 0x7b, 0xeb, 0xb2, 0xf4,
+  0x1b, 0x97, 0x61, 0xad, 0x2a, 0xb4, 0x75, 0x0b, 0x3d, 0x09, 0xa4, 0xd2,
+  0x62, 0xea, 0x7f, 0x4b, 0x3b, 0x79, 0xe6, 0xe5, 0x6b, 0xad, 0xb1, 0xdf,
+  0x4a, 0xd8, 0xfb, 0x5f, 0x4c, 0xa5, 0x79, 0x87, 0x52, 0x9b, 0x1d, 0xe9,
+  0xac, 0x58, 0x8a, 0xe9, 0x91, 0xe9, 0xcd, 0xc7, 0xa0, 0xe0, 0xc9, 0xc1,
+  0x0c, 0xdb, 0xbb, 0xfc, 0xf2, 0x7d, 0x50, 0x11, 0xba, 0x3d, 0xd1, 0x9c,
+  0xbf, 0x48, 0x77, 0xc4, 0x1a, 0x0f, 0x9c, 0xcc, 0xcc, 0xac, 0x70, 0x27,
+  0xf5, 0x95, 0xf6, 0x20, 0x65, 0x85, 0xc8, 0x75, 0x6e, 0x1b, 0x47, 0x87,
+  0x8b, 0xfa, 0x83, 0x2c, 0x3d, 0x0f, 0x30, 0xcb, 0x09, 0xa8, 0x84, 0x9b,
+  0x02, 0x7c, 0xbc, 0x40, 0x43, 0x3f, 0x75, 0xd6, 0xef, 0xe1, 0xc5, 0x6c,
+  0xab, 0x67, 0xb0, 0x34, 0xb5, 0xeb, 0x48, 0x32, 0x0c, 0x70, 0x25, 0xa1,
+  0x2d, 0x44, 0xe5, 0xf6, 0x5f, 0xa4, 0x12, 0x2a, 0xe7, 0x67, 0x5d, 0x8d,
+  0xd9, 0xd7, 0x92, 0xc3, 0xb5, 0xd6, 0x35, 0x9e, 0x29, 0x58, 0x50, 0x04,
+  0x67, 0x96, 0x22, 0x65, 0x75, 0x23, 0xbc, 0xc6, 0x3e, 0x4d, 0x13, 0x2c,
+  0xb1, 0x14, 0x54, 0x5d, 0x3c, 0xd4, 0xf6, 0x02, 0xc9, 0x3f, 0xc2, 0xe6,
+  0x4d, 0x76, 0x4a, 0xac, 0xa6, 0x02, 0x23, 0x57, 0x4b, 0xa5, 0x71, 0x4b,
+  0xd8, 0x3f, 0x94, 0x3e, 0x5e, 0xf1, 0xf4, 0xa1, 0x13, 0x54, 0x39, 0x79,
+  0x07, 0xda, 0x73, 0xc1, 0xf4, 0x51, 0x21, 0x8f, 0xcf, 0x5d, 0xc6, 0xad,
+  0xe9, 0x63, 0x56, 0xe8, 0x0a, 0xbb, 0x1f, 0xcd, 0x6c, 0xbf, 0x93, 0x91,
+  0x78, 0xbf, 0xf1, 0xc0, 0x4a, 0xb4, 0xb6, 0x4a, 0x0e, 0x9a, 0x37, 0xb1,
+  0xd5, 0x04, 0x0c, 0x5a, 0xc4, 0xe8, 0xde, 0xf9, 0xd4, 0x71, 0x60, 0xbc,
+  0xd8, 0x3d, 0x1d, 0xa1, 0xaa, 0x4d, 0x4d, 0xd7, 0x10, 0xa6, 0xa8, 0xa3,
+  0xff, 0xc6, 0x65, 0x61, 0x91, 0xdc, 0x55, 0xd8, 0x70, 0x4b, 0x34, 0x32,
+  0xe7, 0xfa, 0xc4, 0xc2, 0x8b, 0xf9, 0xca, 0xd9, 0x7c, 0x12, 0x9f, 0xb5,
+  0x0a, 0x73, 0x4c, 0xde, 0xc7, 0xa1, 0x79, 0x3d, 0x6f, 0x6c, 0xa1, 0xcd,
+  0xd2, 0x40, 0x60, 0x0f, 0xf6, 0xb2, 0x82, 0xf2, 0x57, 0x7f, 0x72, 0xb1,
+  0x9e, 0x92, 0x36, 0xbb, 0xc8, 0x5d, 0x4c, 0x10, 0x7c, 0xd4, 0xe8, 0x03,
+  0xa4, 0x7a, 0xdc, 0xa6, 0x60, 0x1e, 0x78, 0x93, 0x6f, 0x1e, 0x81, 0xe4,
+  0x5f, 0xeb, 0xaf, 0x50, 0xc4, 0xce, 0xcb, 0x86, 0x03, 0xf0, 0x18, 0x6f,
+  0xe2, 0xa4, 0xb5, 0x6a, 0x17, 0x62, 0x89, 0xc1, 0x2d, 0xdf, 0xe2, 0x81,
+  0xcb, 0x79, 0x38, 0x38, 0x93, 0x2b, 0x38, 0x32, 0xbd, 0xd2, 0x1b, 0x79,
+  0xb1, 0xc2, 0xac, 0x23, 0x4a, 0x13, 0x2b, 0xd1, 0x78, 0x8c, 0x31, 0xa0,
+  0x72, 0x2c, 0x1f, 0x19, 0x54, 0xa2, 0x78, 0x4b, 0xf0, 0xa6, 0x68, 0x34,
+  0x19, 0xd6, 0x78, 0x7c, 0xa5, 0x40, 0xea, 0x2f, 0x62, 0x93, 0x41, 0xaf,
+  0x99, 0x6b, 0xf2, 0x60, 0xe6, 0x32, 0x80, 0x59, 0x95, 0x96, 0xf4, 0x49,
+  0x61, 0x4e, 0xfb, 0x92, 0xb6, 0xe5, 0x48, 0x42, 0xc8, 0xd1, 0x89, 0x5a,
+  0xf8, 0xb3, 0x90, 0x0c, 0x3d, 0x26, 0x3c, 0x33, 0xa7, 0xc3, 0xc0, 0xc3,
+  0x85, 0xc3, 0x73, 0x80, 0xc7, 0x17, 0xdd, 0x68, 0x3e, 0x5b, 0xc6, 0xa7,
+  0x0c, 0xfd, 0x64, 0xb7, 0xb6, 0xe2, 0x7f, 0x1a, 0xa9, 0x81, 0x81, 0x22,
+  0x25, 0x70, 0xe2, 0x80, 0x5d, 0x8a, 0x97, 0xa7, 0x35, 0xc4, 0x35, 0x44,
+  0x2d, 0xdb, 0x16, 0x41, 0x47, 0xdb, 0xbc, 0xb1, 0x50, 0x94, 0x23, 0xd4,
+  0xba, 0x20, 0x6e, 0x89, 0x62, 0xbb, 0x14, 0x22, 0x4c, 0x6b, 0xf2, 0xe1,
+  0xbb, 0xbc, 0xf3, 0x79, 0x0e, 0x55, 0x9b, 0x7c, 0x6b, 0x95, 0x40, 0x65,
+  0xb7, 0x37, 0x25, 0x77, 0x21, 0xfc, 0x39, 0xba, 0x3f, 0x78, 0x60, 0xc4,
+  0xd6, 0xe6, 0x1f, 0x7a, 0xd2, 0xd2, 0x0e, 0x46, 0xfc, 0xb0, 0xa6, 0x14,
+  0xd6, 0x0f, 0xb5, 0xe9, 0x35, 0xa3, 0x0e, 0x5a, 0x4e, 0x4d, 0xb3, 0x5e,
+  0x26, 0x88, 0xfb, 0x44, 0xee, 0x34, 0x86, 0xd9, 0x0a, 0x08, 0x98, 0xeb,
+  0x32, 0xd3, 0x32, 0x8f, 0x3c, 0x33, 0x9b, 0x2a, 0xdc, 0xd2, 0x23, 0xd2,
+  0x7e, 0xe5, 0x7c, 0xbb, 0x8c, 0x94, 0x32, 0x6f, 0x61, 0x69, 0xa6, 0x66,
+  0xd1, 0x46, 0xda, 0xc9, 0x1f, 0x32, 0xbc, 0xf8, 0xd9, 0x44, 0x18, 0x89,
+  0x9b, 0x6e, 0x65, 0xf9, 0x94, 0x3e, 0x53, 0x90, 0x90, 0x26, 0x07, 0x1a,
+  0x68, 0x03, 0x36, 0x1f, 0x73, 0x98, 0xeb, 0xfe, 0xe3, 0xa5, 0x85, 0xf9,
+  0x9c, 0xaa, 0xed, 0xe8, 0x0f, 0x70, 0x0d, 0x5c, 0xd3, 0x42, 0x4e, 0xec,
+  0xe5, 0xaf, 0x03, 0xef, 0x1d, 0x40, 0x58, 0x48, 0xa2, 0x95, 0xc0, 0xf4,
+  0xfc, 0x72, 0xbe, 0x26, 0x69, 0xa8, 0x08, 0x2b, 0x4c, 0xbf, 0x26, 0x3c,
+  0xda, 0x4f, 0xc6, 0xf4, 0xd8, 0x6c, 0xec, 0x54, 0x72, 0xdd, 0x79, 0x95,
+  0xd0, 0xda, 0xac, 0x79, 0x89, 0xce, 0xcd, 0x34, 0x53, 0x34, 0x96, 0x14,
+  0x21, 0xea, 0x7f, 0x6f, 0x95, 0xca, 0x56, 0xe3, 0x5d, 0xac, 0xcd, 0xa9,
+  0x61, 0xc5, 0x40, 0x6e, 0xc6, 0x83, 0x51, 0x5c, 0xc5, 0xc0, 0x8e, 0xe5,
+  0x94, 0x46, 0x10, 0x6a, 0x6f, 0x6d, 0x1c, 0x14, 0x32, 0xb5, 0x1f, 0x8e,
+  0xba, 0xa3, 0x60, 0x0b, 0x32, 0xd1, 0x6e, 0xdb, 0x45, 0xfe, 0x53, 0xce,
+  0x4d, 0x4b, 0x34, 0x6a, 0x97, 0x08, 0x9c, 0x1d, 0xe6, 0x97, 0xf6, 0x5b,
+  0xbb, 0x5f, 0xd9, 0x7a, 0xd4, 0x8f, 0x27, 0x3b, 0x10, 0x5c, 0x5b, 0xc3,
+  0xeb, 0x99, 0x01, 0xdb, 0x12, 0xda, 0xf2, 0x2e, 0xf3, 0x2e, 0x9e, 0x06,
+  0xec, 0x6f, 0x17, 0xe2, 0xd8, 0x43, 0xb8, 0xb3, 0xa1, 0x8f, 0x86, 0x3b,
+  0x49, 0xc5, 0x6c, 0xd8, 0xff, 0xa3, 0xcb, 0x7a, 0xb3, 0x62, 0x94, 0x3c,
+  0xf6, 0x92, 0xfb, 0x70, 0xe4, 0x75, 0x9b, 0x20, 0x9d, 0x66, 0x2a, 0x03,
+  0x51, 0x28, 0xd0, 0xba, 0xd5, 0x30, 0xc2, 0xf9, 0xd2, 0xc7, 0x1a, 0x10,
+  0x5d, 0x69, 0x7a, 0x58, 0x58, 0x51, 0x19, 0x92, 0x0d, 0x15, 0x20, 0x88,
+  0xc3, 0xb2, 0x22, 0x05, 0x4d, 0xca, 0x7f, 0xa5, 0x59, 0x5c, 0xd4, 0x91,
+  0x96, 0x51, 0xbb, 0xf4, 0x54, 0x1d, 0x0a, 0x8d, 0xf4, 0xec, 0x9a, 0xfe,
+  0xf5, 0xd8, 0x87, 0x89, 0xf4, 0xc4, 0x71, 0xf1, 0x7f, 0x34, 0x63, 0x72,
+  0x22, 0xc7, 0x89, 0xeb, 0x26, 0xbe, 0x2b, 0x5a, 0x56, 0xeb, 0x50, 0x1d,
+  0x96, 0xb9, 0x9c, 0xf0, 0x37, 0x12, 0xbf, 0xe8, 0xc3, 0x47, 0xb6, 0xa0,
+  0xb9, 0xb9, 0xb9, 0x41, 0x5e, 0x43, 0x3b, 0x03, 0x48, 0x14, 0xd6, 0xce,
+  0x29, 0xa0, 0x91, 0xdf, 0x4c, 0xd8, 0x60, 0xd7, 0xbb, 0x1d, 0x20, 0x1f,
+  0x6d, 0xa3, 0xa8, 0x82, 0x26, 0x5a, 0x42, 0x2b, 0xf5, 0xf4, 0x8b, 0x9c,
+  0xd7, 0x55, 0xfe, 0xb4, 0xa7, 0x36, 0x97, 0xb3, 0x14, 0x59, 0xe5, 0x3d,
+  0x32, 0x16, 0x7a, 0xf5, 0x66, 0xde, 0x7f, 0x03, 0x00, 0x83, 0x59, 0xa2,
+  0xa5, 0x2b, 0x3e, 0xd5, 0x55, 0xc4, 0x93, 0xab, 0x51, 0x37, 0x1d, 0x1a,
+  0x38, 0x64, 0x90, 0x68, 0x06, 0x75, 0x75, 0x9e, 0x5d, 0x7c, 0x76, 0x45,
+  0x8e, 0x8c, 0xb0, 0xf2, 0x06, 0xf0, 0x04, 0x46, 0xee, 0x27, 0x80, 0x44,
+  0x7f, 0xda, 0xc7, 0xf3, 0x80, 0xfb, 0xc0, 0x64, 0xe8, 0x34, 0xc7, 0x5f,
+  0x05, 0x35, 0x41, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6,
+  0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0x3b, 0x9d, 0x56, 0xc4, 0x27, 0x07, 0xd7,
+  0x34, 0x4a, 0x6a, 0x10, 0x76, 0xa1, 0x78, 0xef, 0x93, 0x9a, 0xdd, 0x0f,
+  0x71, 0xde, 0x8f, 0xce, 0xe2, 0xc4, 0x6d, 0x41, 0x42, 0xd5, 0x14, 0x90,
+  0x53, 0x21, 0x61, 0x51, 0x64, 0x3c, 0xf1, 0xa3, 0xb0, 0xd5, 0xa6, 0x0c,
+  0x8f, 0x9d, 0x3e, 0x68, 0x15, 0xb3, 0xbb, 0xed, 0x18, 0x13, 0x57, 0xa6,
+  0x1a, 0x81, 0xc9, 0x59, 0x80, 0x30, 0x19, 0x09, 0x84, 0xb0, 0x12, 0x37,
+  0xae, 0xe3, 0x89, 0x9b, 0x33, 0x2f, 0xaa, 0x7e, 0xa7, 0xa2, 0x7b, 0x07,
+  0x48, 0xda, 0xab, 0x99, 0xf1, 0x0b, 0xd3, 0x5a, 0x2a, 0x3e, 0x8d, 0x3f,
+  0xf0, 0xa8, 0xfc, 0xb4, 0x5a, 0x70, 0x8f, 0x9a, 0x66, 0xfe, 0x4d, 0xc6,
+  0x7d, 0x88, 0x81, 0x2e, 0x31, 0x8e, 0x25, 0x3f, 0x15, 0x78, 0x80, 0xfc,
+  0xe2, 0xf8, 0x00, 0xae, 0x93, 0x4e, 0x04, 0x0a, 0xb4, 0x0b, 0x94, 0xfe,
+  0x87, 0x2e, 0xd7, 0xbb, 0xc2, 0x34, 0xf6, 0x76, 0x9a, 0x5c, 0x78, 0xcc,
+  0xa0, 0x0f, 0x45, 0xaf, 0xa9, 0x3e, 0x84, 0x7f, 0xba, 0x42, 0x5d, 0x15,
+  0x25, 0x07, 0x41, 0x31, 0x45, 0xc8, 0x25, 0xa0, 0x41, 0xe5, 0x0e, 0xce,
+  0xe7, 0x7b, 0x40, 0xaa, 0x33, 0x46, 0xaf, 0x16, 0x73, 0xfe, 0xaa, 0x3a,
+  0x85, 0xc3, 0x2d, 0xd8, 0xd9, 0x05, 0x21, 0xdd, 0x5f, 0xbd, 0x79, 0x0f,
+  0x95, 0x6e, 0x38, 0x11, 0x2e, 0x4a, 0x11, 0x60, 0xb9, 0xfd, 0xa9, 0xce,
+  0xd1, 0xeb, 0x9e, 0x1c, 0xcb, 0xb3, 0xef, 0xe2, 0x0b, 0x42, 0xb5, 0xf4,
+  0xc0, 0x10, 0x38, 0x38, 0x94, 0x0e, 0x91, 0x3b, 0x09, 0x99, 0x9c, 0x86,
+  0x62, 0x5e, 0x30, 0xbe, 0x52, 0x02, 0xc5, 0x9b, 0xb0, 0x9a, 0x97, 0x7a,
+  0x4b, 0x76, 0x88, 0x95, 0xa8, 0xaf, 0x25, 0x78, 0x29, 0x89, 0x87, 0x8e,
+  0x5f, 0x01, 0xff, 0x3b, 0x45, 0x1c, 0x87, 0x5a, 0x43, 0xc0, 0xf0, 0xd9,
+  0xbd, 0x11, 0x2d, 0xb6, 0xa5, 0x4f, 0x90, 0xac, 0x25, 0xcf, 0x4f, 0x08,
+  0xa5, 0xd0, 0x5a, 0x85, 0x27, 0x36, 0x7f, 0x6a, 0x89, 0x39, 0x54, 0xc7,
+  0x69, 0x2f, 0x9b, 0x3c, 0x10, 0xe6, 0xf9, 0xfd, 0xdc, 0xe7, 0x96, 0x94,
+  0x2a, 0x9e, 0xfd, 0xdf, 0x60, 0xed, 0x91, 0x5a, 0x8c, 0xfe, 0x1f, 0xca,
+  0xe6, 0x6b, 0xf7, 0xbb, 0xd7, 0x2c, 0x18, 0x97, 0xb8, 0xd0, 0x1c, 0xd5,
+  0x9e, 0xaa, 0x10, 0x31, 0xfa, 0x4a, 0xc4, 0xe5, 0x57, 0xd7, 0xce, 0xab,
+  0xe6, 0x42, 0xe8, 0xf4, 0x49, 0x2d, 0xf8, 0xad, 0xa3, 0x0a, 0xd0, 0x57,
+  0xdb, 0x42, 0x1d, 0xef, 0x4c, 0xf6, 0x15, 0x47, 0x97, 0xce, 0xb2, 0x0c,
+  0xa4, 0xe5, 0xb3, 0x49, 0x3b, 0x82, 0x9e, 0xbd, 0x93, 0xf0, 0x87, 0x3d,
+  0xd7, 0x95, 0x97, 0x2f, 0x10, 0x97, 0xcf, 0x16, 0xb9, 0x11, 0x8b, 0xb0,
+  0xa4, 0xbc, 0x2f, 0x26, 0x22, 0x2e, 0xdc, 0x39, 0x66, 0xe7, 0xe5, 0xa5,
+  0x8f, 0xfa, 0x0a, 0x0f, 0x0b, 0xaa, 0xa7, 0x9d, 0x29, 0x03, 0x06, 0x42,
+  0xb2, 0x24, 0xba, 0xf2, 0x9a, 0xc6, 0xc0, 0x29, 0xd7, 0xde, 0x0e, 0x9b,
+  0x2b, 0x97, 0x33, 0xa2, 0x1c, 0xc3, 0xad, 0xcf, 0xc6, 0xc3, 0xec, 0x5b,
+  0x79, 0xed, 0x59, 0x9b, 0x03, 0xc7, 0x03, 0x99, 0xc2, 0xab, 0xfc, 0x44,
+  0x20, 0x80, 0x30, 0xac, 0x26, 0x74, 0x09, 0x56, 0x38, 0x8d, 0x3f, 0x18,
+  0xd0, 0xba, 0xf3, 0x73, 0x10, 0xb0, 0xb2, 0x0d, 0x2b, 0xaa, 0xf7, 0x05,
+  0x63, 0x4b, 0x5b, 0x1d, 0x83, 0x1f, 0x01, 0x20, 0x92, 0xa0, 0x90, 0x65,
+  0x47, 0x00, 0x50, 0xc2, 0xad, 0x4b, 0xcd, 0xb8, 0x20, 0x0f, 0xb4, 0x73,
+  0x71, 0x3e, 0x32, 0x1e, 0x22, 0xd5, 0xe5, 0x7d, 0x3a, 0xe9, 0xfb, 0x4d,
+  0xe7, 0x73, 0x51, 0xf3, 0x58, 0x70, 0x43, 0x05, 0x68, 0xac, 0x82, 0xd5,
+  0x6c, 0xbe, 0x71, 0x7f, 0xc6, 0xd2, 0x18, 0xed, 0x40, 0xe6, 0x3f, 0xe4,
+  0x05, 0xb4, 0x86, 0xa7, 0xf0, 0xd2, 0x62, 0xda, 0x03, 0x91, 0x39, 0xd7,
+  0xd7, 0x2d, 0x11, 0x44, 0x3c, 0x44, 0x40, 0x03, 0xd1, 0x64, 0x04, 0x8d,
+  0xe2, 0xb3, 0x9a, 0x56, 0x07, 0x99, 0x8b, 0xff, 0xa3, 0x25, 0xf7, 0xaa,
+  0x31, 0xf9, 0xcb, 0x9f, 0x5d, 0x0f, 0x58, 0x69, 0x61, 0x62, 0xb4, 0x66,
+  0xd0, 0x7d, 0x5d, 0xe3, 0xfd, 0xa7, 0xc7, 0x8b, 0x60, 0x81, 0xd2, 0x9e,
+  0x58, 0xe7, 0x21, 0x8b, 0x64, 0x83, 0xab, 0x2a, 0x81, 0x36, 0x72, 0xff,
+  0xd2, 0x10, 0x39, 0x70, 0xae, 0x71, 0x3d, 0xa9, 0x98, 0x12, 0x00, 0xcf,
+  0x19, 0x29, 0x3a, 0xf9, 0x34, 0x55, 0xab, 0xa7, 0xd0, 0x15, 0x81, 0xf7,
+  0x06, 0xf2, 0xd6, 0xf4, 0x12, 0x57, 0x61, 0x7f, 0x88, 0xee, 0x1d, 0xe3,
+  0x49, 0x1d, 0xe9, 0xfc, 0x85, 0x25, 0x91, 0xd6, 0xb2, 0xb0, 0x01, 0xd4,
+  0xaf, 0xbf, 0x7c, 0x41, 0xe1, 0x16, 0xbf, 0xaa, 0xf3, 0xe0, 0xcb, 0xe3,
+  0x90, 0x6a, 0x24, 0xf3, 0x4b, 0x1a, 0x01, 0xa0, 0x72, 0xc0, 0xda, 0x61,
+  0x30, 0x06, 0x15, 0x59, 0x5c, 0xd1, 0x2a, 0xbf, 0x2d, 0x3d, 0xa3, 0x05,
+  0x84, 0x78, 0xcb, 0x41, 0xb4, 0x2a, 0xbb, 0xae, 0x82, 0x8a, 0x02, 0x3c,
+  0x6b, 0x9a, 0x69, 0x9c, 0xae, 0x75, 0xd5, 0x7f, 0x64, 0xf3, 0x0d, 0x89,
+  0x14, 0xd9, 0xbd, 0x1d, 0xae, 0xf6, 0xc3, 0x82, 0xc9, 0xe5, 0x68, 0x6a,
+  0x58, 0x7f, 0x36, 0x6c, 0x01, 0x0b, 0xf7, 0xac, 0xc0, 0x66, 0x54, 0xfa,
+  0x64, 0x4f, 0xe9, 0x0e, 0x6d, 0xf3, 0x46, 0xd9, 0x7a, 0xfa, 0xcb, 0x2f,
+  0x78, 0x6b, 0x42, 0x87, 0xf8, 0xe9, 0x37, 0x25, 0xe5, 0xc8, 0xfe, 0xaa,
+  0x11, 0x3a, 0x11, 0xf6, 0x65, 0x61, 0x4e, 0xe1, 0x9b, 0x25, 0xa6, 0xed,
+  0x9c, 0xbb, 0xe3, 0x6c, 0x19, 0xec, 0xca, 0x41, 0x82, 0x35, 0x13, 0x8e,
+  0xfa, 0x9a, 0x7f, 0xde, 0xcf, 0x7f, 0x7f, 0x86, 0x24, 0x2f, 0x4a, 0x0c,
+  0x2a, 0x0b, 0x5a, 0xbe, 0xd2, 0xf0, 0xc5, 0xc7, 0x49, 0x9d, 0x78, 0x3a,
+  0xbd, 0x04, 0x2b, 0xd9, 0x37, 0xc9, 0x2f, 0x0e, 0x56, 0xeb, 0x72, 0xaa,
+  0x80, 0x38, 0xfc, 0xda, 0x91, 0xc4, 0xd2, 0x82, 0xd4, 0xee, 0x8a, 0x4e,
+  0x9f, 0x1f, 0x15, 0x01, 0x41, 0x0c, 0x28, 0xfd, 0x9c, 0x4e, 0xec, 0xa7,
+  0x59, 0x14, 0xb3, 0xe2, 0x9f, 0x46, 0x26, 0x93, 0x18, 0xbb, 0x43, 0x26,
+  0xf7, 0x4d, 0x42, 0x00, 0x77, 0xab, 0x05, 0xf6, 0x6e, 0x8e, 0x28, 0x22,
+  0x4c, 0xb7, 0xf4, 0x14, 0x98, 0x38, 0x9d, 0xf1, 0x36, 0xa0, 0xac, 0x44,
+  0xbb, 0xed, 0xe6, 0x63, 0xcf, 0x1e, 0xe1, 0xbe, 0x82, 0x08, 0x9c, 0x1f,
+  0x57, 0xb6, 0x57, 0x42, 0x71, 0x64, 0x25, 0x0a, 0x21, 0xb0, 0x5d, 0xb3,
+  0x4e, 0x95, 0x18, 0xe5, 0xa5, 0x93, 0x30, 0xc7, 0xe2, 0x28, 0xac, 0x17,
+  0x6b, 0x00, 0xe9, 0xc1, 0x05, 0x18, 0xe0, 0xcc, 0xf5, 0xd2, 0x96, 0x74,
+  0xfc, 0x59, 0x71, 0x90, 0xdb, 0xe5, 0x8d, 0x6e, 0xac, 0x05, 0x92, 0x39,
+  0x81, 0xac, 0xfb, 0x40, 0x1f, 0x4b, 0xc3, 0x4e, 0x0d, 0x68, 0x2d, 0x89,
+  0x6d, 0x64, 0x23, 0xd6, 0x86, 0xd9, 0xe5, 0x91, 0x19, 0xe2, 0xb9, 0x63,
+  0xa2, 0xef, 0x33, 0x91, 0x74, 0xef, 0x76, 0x2f, 0x88, 0x88, 0x90, 0x4f,
+  0xc4, 0x22, 0xac, 0xee, 0xab, 0xbd, 0x52, 0x9c, 0xbf, 0xb8, 0x8a, 0x7c,
+  0x12, 0x21, 0x90, 0x88, 0x06, 0xcd, 0x1f, 0xc8, 0xbd, 0x40, 0xe0, 0xee,
+  0x05, 0xe3, 0x16, 0x1d, 0x33, 0x04, 0x63, 0x84, 0xae, 0xf6, 0xf8, 0xf8,
+  0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xb0, 0xc2, 0x97, 0x1d,
+  0x0d, 0xa2, 0xfd, 0xed, 0x9d, 0xcd, 0x3a, 0x02, 0x8f, 0xbd, 0x63, 0x3d,
+  0xe6, 0x4c, 0xa9, 0x79, 0xfa, 0x0c, 0xcd, 0xd5, 0xed, 0x5b, 0x85, 0xc5,
+  0xa6, 0x5b, 0xce, 0x13, 0x51, 0xc6, 0x31, 0x70, 0x54, 0xe0, 0x87, 0x17,
+  0x18, 0x50, 0xde, 0x5a, 0x12, 0x5d, 0xeb, 0xf3, 0x70, 0xe9, 0xa1, 0xe2,
+  0x0a, 0x98, 0x17, 0x96, 0x94, 0x73, 0xf3, 0x43, 0xbf, 0x65, 0xbb, 0xd1,
+  0xec, 0xfe, 0xb5, 0x1c, 0x9b, 0x61, 0xad, 0x48, 0xa7, 0xe2, 0x58, 0x59,
+  0x23, 0xe4, 0x24, 0xe9, 0xf6, 0x9d, 0xac, 0xe1, 0xdb, 0x94, 0xba, 0x8a,
+  0x0d, 0x8f, 0x5b, 0x3e, 0xd2, 0xfa, 0x87, 0xe1, 0x4f, 0x5e, 0x9c, 0x6f,
+  0x74, 0x3f, 0xe4, 0x39, 0xa0, 0xdc, 0x81, 0x88, 0xa6, 0x98, 0xc6, 0xca,
+  0x1a, 0xf9, 0x40, 0xf6, 0x3d, 0xe7, 0x38, 0xdc, 0xc2, 0x82, 0xed, 0x28,
+  0xa6, 0x1e, 0xe3, 0x31, 0xab, 0x4a, 0xe0, 0xe3, 0xfe, 0x4b, 0x3a, 0xc0,
+  0xc5, 0xed, 0x70, 0x09, 0x15, 0x26, 0x6b, 0x89, 0x5f, 0xb6, 0x77, 0x6b,
+  0xe3, 0x28, 0x07, 0x82, 0x83, 0x4d, 0x95, 0x8e, 0x97, 0x57, 0x0a, 0xc0,
+  0x6f, 0xf8, 0x21, 0x15, 0x2c, 0x7a, 0x8b, 0xce, 0x82, 0x3b, 0xcb, 0x8a,
+  0x98, 0x2e, 0x57, 0x7c, 0xe4, 0x46, 0x9a, 0x54, 0x6b, 0x59, 0xa9, 0x49,
+  0x2a, 0xf6, 0x6c, 0x2a, 0x24, 0x49, 0xe1, 0xb3, 0x05, 0x42, 0xa0, 0x83,
+  0x36, 0xf8, 0x15, 0x43, 0xbd, 0x6c, 0x6d, 0xbd, 0x0f, 0x06, 0x80, 0x61,
+  0x80, 0x3e, 0x17, 0x93, 0x20, 0x52, 0x17, 0xc1, 0x81, 0xb8, 0x56, 0xa5,
+  0xb9, 0xf8, 0x13, 0xd1, 0x10, 0x79, 0xc9, 0xc5, 0x99, 0xe9, 0x12, 0xad,
+  0xf0, 0x79, 0xe9, 0xe5, 0x5b, 0x60, 0xcc, 0x72, 0xfe, 0xf7, 0xe4, 0xc1,
+  0x0e, 0x77, 0x11, 0x7f, 0x92, 0x4e, 0x61, 0x03, 0xf4, 0xdd, 0x39, 0x8b,
+  0x6a, 0xce, 0x39, 0x73, 0xf1, 0xaf, 0x0a, 0x3d, 0x46, 0x5d, 0x3e, 0x3b,
+  0xb4, 0x45, 0x6f, 0x0e, 0x01, 0x6e, 0xf0, 0xd7, 0xaf, 0xc2, 0x38, 0xed,
+  0x51, 0x5b, 0x10, 0x94, 0x48, 0x4e, 0xb4, 0x2f, 0xab, 0x75, 0x7d, 0xef,
+  0xa3, 0x1e, 0x92, 0xa8, 0xe4, 0xc0, 0x37, 0x25, 0x00, 0x49, 0x31, 0x01,
+  0xf5, 0x87, 0x93, 0x86, 0xde, 0x3a, 0xcb, 0x34, 0xdf, 0x74, 0x01, 0xc2,
+  0x29, 0x9b, 0xf0, 0xe8, 0xf0, 0xb3, 0x7d, 0x24, 0x9c, 0x4b, 0xf0, 0x47,
+  0x4f, 0xc1, 0xca, 0x4c, 0x73, 0x81, 0xdf, 0x31, 0xce, 0x08, 0xad, 0x0a,
+  0x08, 0x4b, 0xb9, 0x61, 0x40, 0x30, 0xaf, 0x2e, 0x0a, 0xf1, 0xc1, 0xb0,
+  0x90, 0xf4, 0xdb, 0x23, 0x5e, 0x3c, 0x1d, 0xa1, 0xa8, 0x74, 0xca, 0x2d,
+  0x01, 0xe4, 0x1e, 0xe9, 0x0e, 0x2d, 0x93, 0xde, 0x14, 0xf7, 0x40, 0xfc,
+  0xcb, 0x6c, 0xa2, 0x33, 0x7e, 0xf3, 0xc3, 0x63, 0xfb, 0x06, 0xda, 0x34,
+  0x69, 0x88, 0x0f, 0xb9, 0x26, 0x71, 0xc6, 0x39, 0x2b, 0xdd, 0xf9, 0x63,
+  0x61, 0xfe, 0x23, 0x94, 0x13, 0x8b, 0xca, 0x9c, 0x29, 0x3e, 0x27, 0x21,
+  0x0c, 0x62, 0x55, 0xae, 0x76, 0xdc, 0x31, 0x85, 0x6a, 0x2e, 0x73, 0xdf,
+  0xd4, 0xa8, 0xbb, 0x4f, 0xa0, 0x61, 0xc8, 0x97, 0xfc, 0x02, 0x78, 0xf5,
+  0x93, 0x6f, 0x3e, 0xbc, 0x71, 0x1e, 0x54, 0x46, 0x80, 0xd5, 0x0b, 0x39,
+  0x0c, 0x65, 0x60, 0x56, 0xc8, 0x60, 0x80, 0x96, 0xcd, 0xc0, 0x34, 0xed,
+  0xdd, 0x2b, 0x76, 0x7e, 0x30, 0x9d, 0x19, 0xf2, 0x10, 0xaf, 0xd7, 0xe9,
+  0xd4, 0xe6, 0x38, 0x61, 0x56, 0xf5, 0x3e, 0xe4, 0x5f, 0x70, 0xb6, 0xf0,
+  0xae, 0x6d, 0xcb, 0xa1, 0x93, 0x57, 0x27, 0xe3, 0x52, 0xb7, 0xdc, 0xef,
+  0x49, 0xad, 0x3f, 0x10, 0x58, 0x8f, 0xd3, 0x63, 0xcd, 0x20, 0xd3, 0xb3,
+  0x52, 0x8e, 0x57, 0x34, 0x82, 0x4d, 0x70, 0x39, 0x22, 0x69, 0xef, 0x25,
+  0x2a, 0xae, 0x06, 0x77, 0xa7, 0x9c, 0x8c, 0x01, 0xfc, 0xe8, 0xc7, 0x78,
+  0x09, 0xbe, 0x65, 0xf3, 0x03, 0x9b, 0x13, 0x44, 0x0c, 0x0e, 0x7f, 0x1f,
+  0xf5, 0xb1, 0x8c, 0x7c, 0xe1, 0x30, 0x53, 0xc3, 0x70, 0x4a, 0x3f, 0x14,
+  0x4c, 0x4a, 0xae, 0xe2, 0xbd, 0x4f, 0xdc, 0xd8, 0x41, 0x72, 0xc6, 0x28,
+  0x98, 0x98, 0x57, 0x57, 0x3d, 0x67, 0xe0, 0x3a, 0xba, 0x9a, 0xde, 0x7a,
+  0xa9, 0x01, 0xa5, 0x9e, 0xfb, 0xcd, 0x3c, 0x72, 0xd4, 0xc0, 0x44, 0x46,
+  0x3f, 0x03, 0xd3, 0xb1, 0x21, 0xd8, 0xfa, 0x45, 0xeb, 0xf3, 0x93, 0x46,
+  0xc0, 0x54, 0xd7, 0x1c, 0xa4, 0xed, 0xde, 0x24, 0x6a, 0x8d, 0xa5, 0x82,
+  0x76, 0x28, 0x03, 0xd9, 0xed, 0x1f, 0x59, 0xb0, 0xa2, 0xc0, 0xed, 0xf7,
+  0x3e, 0x13, 0x15, 0xe5, 0x1f, 0xfc, 0xc4, 0x4f, 0xcc, 0x47, 0xd4, 0xf0,
+  0xea, 0x79, 0xcc, 0xa0, 0x17, 0x07, 0x72, 0x4d, 0x6d, 0x57, 0xf2, 0xcd,
+  0xc5, 0xe4, 0xd7, 0xfd, 0xb1, 0xfe, 0xee, 0x6e, 0xad, 0x4f, 0x62, 0x9f,
+  0xe5, 0xea, 0x35, 0xe5, 0xa9, 0x0e, 0x78, 0xff, 0x2c, 0xfd, 0xaa, 0xcb,
+  0xe8, 0x95, 0xcb, 0x3f, 0xc8, 0x51, 0x30, 0xca, 0xfb, 0xde, 0x62, 0x79,
+  0x09, 0x3b, 0x24, 0xb6, 0xa2, 0xb5, 0xae, 0xc8, 0x25, 0x45, 0xa4, 0x7a,
+  0xa1, 0xfe, 0xff, 0x93, 0xdb, 0x83, 0x0e, 0xdf, 0x70, 0xbf, 0x55, 0xda,
+  0x92, 0x99, 0xdf, 0x32, 0x15, 0x3f, 0x48, 0x51, 0x50, 0x50, 0xbf, 0xd4,
+  0xd3, 0xf5, 0xe0, 0xa4, 0xca, 0xed, 0x00, 0xf7, 0x15, 0x90, 0x0f, 0x54,
+  0xc3, 0xe7, 0x8c, 0xa1, 0xb0, 0x4a, 0x34, 0xea, 0x25, 0xe2, 0x0d, 0xd8,
+  0xe6, 0x28, 0x49, 0x9b, 0xa2, 0x55, 0x9a, 0xdc, 0x96, 0x43, 0x1c, 0xb1,
+  0x1c, 0x38, 0x5b, 0xca, 0x77, 0x6a, 0x63, 0xbc, 0x75, 0x84, 0xc2, 0xfb,
+  0xc9, 0x78, 0xee, 0xa0, 0x8b, 0x18, 0x18, 0x05, 0xcf, 0x5e, 0x30, 0xa4,
+  0x03, 0x71, 0xa6, 0x5c, 0xff, 0x83, 0x7f, 0x0f, 0xad, 0xdf, 0x4d, 0x0f,
+  0xa9, 0x6b, 0xda, 0xb2, 0x47, 0x6f, 0xbc, 0xce, 0x46, 0x73, 0x3d, 0x50,
+  0x70, 0xae, 0x1f, 0x0b, 0x12, 0x20, 0x16, 0x0a, 0x84, 0xf3, 0xe9, 0xf3,
+  0xf7, 0xc1, 0x05, 0x31, 0x73, 0xe3, 0xe1, 0x9d, 0x86, 0x9a, 0xab, 0xb1,
+  0xe9, 0xea, 0x8d, 0x9b, 0x41, 0x56, 0xee, 0xef, 0x52, 0x45, 0xd8, 0x65,
+  0x41, 0xb7, 0xfb, 0x37, 0x34, 0x0e, 0x2e, 0x35, 0x91, 0xfe, 0x05, 0x9e,
+  0xf3, 0x7f, 0x8a, 0xae, 0x6a, 0xf6, 0x40, 0x44, 0x6e, 0x9a, 0xd7, 0x02,
+  0xb9, 0x6e, 0x5c, 0xe8, 0x01, 0x3b, 0x33, 0xe3, 0x9c, 0x6c, 0x3c, 0x2c,
+  0x94, 0xd1, 0x6a, 0x8c, 0x60, 0xd2, 0xf3, 0xd7, 0x35, 0x74, 0xc4, 0x17,
+  0x66, 0xb7, 0xad, 0xe7, 0x62, 0xa4, 0x5c, 0x95, 0xd1, 0xdf, 0x72, 0xf8,
+  0x61, 0x2a, 0xf4, 0x95, 0x31, 0x1c, 0xba, 0x6e, 0xaa, 0x76, 0x74, 0xc2,
+  0x55, 0x45, 0xdf, 0xb5, 0x29, 0xb6, 0x01, 0xc1, 0x47, 0x66, 0xaa, 0xc6,
+  0x90, 0xcd, 0xcf, 0xf2, 0xf8, 0xe7, 0x18, 0x82, 0xe4, 0x20, 0xbb, 0x04,
+  0xba, 0xab, 0xf3, 0x8d, 0x31, 0x92, 0x40, 0x81, 0x9f, 0x01, 0x74, 0xf8,
+  0xf4, 0x0a, 0x4e, 0xbe, 0x30, 0xf4, 0x5e, 0xa6, 0xe4, 0x24, 0x50, 0x72,
+  0x0a, 0x0e, 0x2f, 0xd0, 0x43, 0x03, 0x8c, 0xeb, 0x87, 0xfc, 0xd8, 0x9d,
+  0x04, 0xd3, 0xd5, 0x31, 0xdb, 0x63, 0xa5, 0xbf, 0xf2, 0x26, 0xca, 0xb0,
+  0xa4, 0xa1, 0x43, 0x2a, 0x7d, 0x2f, 0x1c, 0xb7, 0x8b, 0xae, 0x62, 0x7c,
+  0x3d, 0x54, 0x20, 0x52, 0x2a, 0xe6, 0x2f, 0x79, 0x08, 0xbf, 0x54, 0x62,
+  0x25, 0x17, 0x12, 0x82, 0xda, 0x06, 0x77, 0x07, 0xb3, 0xef, 0xdd, 0x3a,
+  0x50, 0xe6, 0x7f, 0x92, 0x36, 0xcb, 0xe5, 0xaa, 0x3d, 0x52, 0xb4, 0xa7,
+  0x4f, 0x23, 0xb1, 0x9d, 0x53, 0xbe, 0x0d, 0x6d, 0x42, 0x65, 0xda, 0x42,
+  0x44, 0x65, 0x08, 0x48, 0x89, 0xbf, 0xf3, 0x51, 0x3a, 0x2f, 0xbd, 0x75,
+  0x4d, 0x28, 0xdf, 0x33, 0x64, 0x6b, 0xae, 0xb4, 0xfa, 0x52, 0x56, 0x2a,
+  0x20, 0x2f, 0x55, 0x7c, 0x6f, 0x37, 0xa5, 0x30, 0x58, 0xd7, 0x2c, 0xc9,
+  0x34, 0x21, 0xcf, 0x82, 0xbf, 0xf7, 0x17, 0x07, 0xf7, 0x2f, 0x4e, 0x12,
+  0x95, 0x8c, 0x9e, 0x55, 0x7a, 0xb5, 0x33, 0xc0, 0xef, 0xae, 0x85, 0x77,
+  0x42, 0x63, 0xff, 0xcc, 0x55, 0x47, 0x50, 0x41, 0xe6, 0x6e, 0x59, 0x4c,
+  0xe0, 0xd0, 0xe6, 0x19, 0xb0, 0xe4, 0xe5, 0xc4, 0x7f, 0x21, 0x5c, 0xe9,
+  0xf8, 0x7a, 0x66, 0xb9, 0xd0, 0x57, 0x37, 0x6f, 0xcf, 0x1c, 0x5c, 0x0c,
+  0xfb, 0xc7, 0x97, 0x74, 0x97, 0xbe, 0x9e, 0xa8, 0x7b, 0xf1, 0x0a, 0xd5,
+  0x6f, 0x8e, 0x61, 0x64, 0x01, 0x65, 0xa8, 0xe2, 0x39, 0x16, 0x2f, 0x09,
+  0xeb, 0xcc, 0xd9, 0xe7, 0x2a, 0xa9, 0x95, 0x63, 0x59, 0x56, 0x29, 0x74,
+  0xe1, 0x76, 0x91, 0x91, 0xf0, 0x32, 0x0c, 0x51, 0x6c, 0xb4, 0xb0, 0xc3,
+  0xba, 0x79, 0xc2, 0x98, 0x89, 0x44, 0x74, 0x7e, 0x68, 0x0b, 0xce, 0xa6,
+  0xce, 0xb3, 0xe0, 0x98, 0x7a, 0x0e, 0x2a, 0xd7, 0x95, 0x56, 0xfe, 0x89,
+  0xbb, 0x9f, 0xa8, 0x55, 0x6b, 0x6e, 0xa9, 0x5f, 0xb3, 0x34, 0x99, 0x4d,
+  0x1d, 0xd1, 0x12, 0xa9, 0xb6, 0x19, 0xe5, 0xc5, 0xc6, 0x66, 0xcd, 0x8c,
+  0x76, 0xe4, 0xb6, 0x3e, 0x0f, 0x05, 0xde, 0xfa, 0xd4, 0xa4, 0xee, 0x35,
+  0xec, 0x84, 0x01, 0x8e, 0x8c, 0x9d, 0x6c, 0x9e, 0x61, 0xb1, 0x9d, 0xd7,
+  0xac, 0x7d, 0x1e, 0xe9, 0xfd, 0x30, 0x6e, 0x88, 0xef, 0xfa, 0xdd, 0xa1,
+  0x8c, 0x4d, 0x8b, 0x38, 0xd2, 0x12, 0xf5, 0xbf, 0x33, 0x60, 0x8b, 0xe7,
+  0xdb, 0x3d, 0xb3, 0x97, 0x39, 0x41, 0xd0, 0x1d, 0xa9, 0xdb, 0x8b, 0x3a,
+  0x82, 0x9c, 0x52, 0x6a, 0x1f, 0xcc, 0x99, 0x8c, 0x18, 0xc7, 0x4c, 0x2b,
+  0x3c, 0xda, 0x9a, 0xff, 0x26, 0x11, 0x4f, 0xde, 0xf7, 0xb5, 0x89, 0xca,
+  0x22, 0xc8, 0x3f, 0x70, 0x1f, 0x3b, 0x64, 0x29, 0xb3, 0x3b, 0x23, 0x6e,
+  0x02, 0x73, 0x5c, 0x1a, 0x20, 0xc5, 0x6e, 0x41, 0xeb, 0x30, 0xab, 0xe3,
+  0xde, 0xea, 0x51, 0x38, 0x4b, 0x7a, 0x9b, 0x59, 0xc2, 0x77, 0x42, 0xfe,
+  0xe3, 0x95, 0xd6, 0x79, 0x7e, 0xa7, 0x16, 0x9d, 0x42, 0x18, 0x8d, 0xec,
+  0x95, 0x42, 0x2f, 0xda, 0xab, 0x55, 0xe8, 0x52, 0xe9, 0xc9, 0x35, 0xaa,
+  0x22, 0xaf, 0xc2, 0x09, 0x5f, 0xc2, 0xdc, 0x91, 0x3b, 0xb1, 0xfc, 0x21,
+  0xe2, 0x43, 0x5e, 0xa4, 0xd9, 0x45, 0xb5, 0xcf, 0x41, 0x2d, 0x90, 0xf5,
+  0x85, 0xfd, 0x40, 0x8c, 0x7d, 0x39, 0x98, 0x61, 0x43, 0x12, 0x30, 0x71,
+  0xcf, 0x24, 0xe1, 0x84, 0x19, 0xa4, 0xa1, 0x3d, 0x30, 0x0a, 0xa3, 0x9c,
+  0xde, 0x3c, 0x0d, 0x95, 0xb5, 0x3c, 0x6d, 0x0c, 0x8e, 0xff, 0x38, 0x9c,
+  0xf5, 0x1c, 0x62, 0x27, 0xde, 0xba, 0xe2, 0x2b, 0x57, 0x78, 0xa3, 0x39,
+  0xba, 0x9c, 0x0b, 0x40, 0xfc, 0x41, 0x6c, 0x2f, 0x6f, 0x43, 0xb3, 0xc6,
+  0x0c, 0x6d, 0xba, 0x0c, 0xc3, 0xeb, 0xb8, 0xf7, 0xd3, 0x83, 0x3e, 0x43,
+  0xd3, 0x6a, 0xfd, 0x92, 0xc3, 0xe2, 0x37, 0x01, 0x1f, 0x8b, 0x2e, 0x60,
+  0xae, 0xdf, 0x4e, 0x0b, 0xbb, 0xc7, 0xe6, 0x2d, 0xf9, 0xb2, 0xd4, 0xf9,
+  0x56, 0x35, 0xe2, 0x94, 0x12, 0x1e, 0x9e, 0x80, 0x72, 0x5a, 0x32, 0xa8,
+  0xc7, 0xb9, 0x76, 0x86, 0x51, 0xdc, 0xfe, 0x79, 0x01, 0xbf, 0x28, 0x86,
+  0x12, 0x75, 0x08, 0x6e, 0xc0, 0x48, 0x7e, 0xcc, 0xac, 0x86, 0x4e, 0x24,
+  0xbf, 0x0d, 0x8b, 0x01, 0x53, 0x00, 0xa0, 0x52, 0x13, 0xe3, 0xaa, 0xf0,
+  0x17, 0x95, 0xed, 0xfe, 0x7c, 0x9d, 0x23, 0x6f, 0xa4, 0x03, 0xe5, 0x31,
+  0xe5, 0x22, 0x31, 0xd5, 0x71, 0x41, 0xad, 0xa8, 0x0f, 0x66, 0xc3, 0xdb,
+  0x53, 0xbb, 0x55, 0x5c, 0x86, 0x3e, 0x93, 0x8b, 0x19, 0x5f, 0x1e, 0x74,
+  0x9d, 0x64, 0x82, 0x22, 0xb9, 0x09, 0xde, 0xd7, 0xf1, 0xac, 0x9c, 0x0a,
+  0xca, 0xe2, 0x6c, 0xf0, 0x4a, 0x16, 0x4c, 0xbf, 0xed, 0xa2, 0x5d, 0xc8,
+  0x3b, 0xba, 0x71, 0x43, 0x5d, 0xec, 0x55, 0x66, 0x54, 0x08, 0xef, 0x5e,
+  0xc9, 0xfc, 0x47, 0x80, 0x72, 0xe9, 0xb5, 0xe9, 0xf3, 0xc7, 0xca, 0x56,
+  0x7b, 0xab, 0xec, 0xeb, 0xe5, 0x10, 0x51, 0xc4, 0xf3, 0x63, 0x7f, 0xa2,
+  0xff, 0x48, 0x6a, 0x19, 0x71, 0x29, 0xb2, 0x24, 0x0a, 0x5c, 0x0e, 0x07,
+  0x51, 0x0a, 0xa1, 0x36, 0x62, 0x57, 0x77, 0x91, 0xdd, 0x58, 0xfa, 0x63,
+  0x1a, 0xc3, 0x76, 0x1c, 0x3b, 0x8f, 0x05, 0x8d, 0xd9, 0x19, 0xab, 0x89,
+  0xe7, 0x70, 0xa3, 0xd5, 0x10, 0x01, 0x47, 0xb9, 0x62, 0x9f, 0xe4, 0xd3,
+  0x13, 0x54, 0xcc, 0x47, 0xe5, 0x13, 0x68, 0x85, 0x4c, 0xbe, 0x4f, 0x4b,
+  0xe2, 0xc9, 0x66, 0x3b, 0x0b, 0x11, 0xba, 0xf7, 0x4c, 0x11, 0xbf, 0x54,
+  0x98, 0xe5, 0xec, 0x25, 0xbe, 0x80, 0xdd, 0xdd, 0xb3, 0x3c, 0x49, 0x4c,
+  0x7e, 0x3d, 0xaa, 0x0d, 0x33, 0xf5, 0x34, 0x74, 0xe6, 0x98, 0x46, 0xa8,
+  0x66, 0x0f, 0x69, 0x91, 0x99, 0x24, 0x5e, 0xc5, 0x24, 0x23, 0x8b, 0xcb,
+  0x72, 0x59, 0xf4, 0x35, 0x96, 0xc5, 0x36, 0xba, 0x3e, 0x22, 0xbd, 0x8e,
+  0xbd, 0x51, 0xdc, 0x68, 0x08, 0xd7, 0xcf, 0x0c, 0x2d, 0x1b, 0x10, 0xed,
+  0x58, 0x94, 0xdc, 0x70, 0x87, 0x59, 0xcb, 0xee, 0x59, 0xdd, 0x7a, 0xfe,
+  0x60, 0xd2, 0x49, 0x52, 0x9f, 0x83, 0x32, 0xf8, 0x04, 0xa9, 0x73, 0xfd,
+  0x44, 0x3a, 0xe0, 0xbe, 0x0e, 0x0d, 0x9c, 0xe8, 0x93, 0x71, 0x87, 0x0c,
+  0x87, 0xd6, 0xd9, 0xa8, 0xf0, 0x82, 0xf1, 0x1d, 0x9c, 0x01, 0x45, 0x61,
+  0x74, 0x73, 0x68, 0x66, 0x69, 0xec, 0xc2, 0x0e, 0xc2, 0x3a, 0x0e, 0xe7,
+  0x28, 0x64, 0xf3, 0x8a, 0xae, 0xe2, 0xfd, 0x20, 0x92, 0xc9, 0x10, 0x84,
+  0xc3, 0x68, 0x37, 0xfb, 0x12, 0x17, 0x61, 0xfa, 0x6d, 0x9f, 0x4a, 0xfc,
+  0x90, 0x6b, 0x18, 0x7e, 0x7c, 0xd9, 0x71, 0x1d, 0xfe, 0x73, 0x4b, 0x1e,
+  0x39, 0x79, 0x4d, 0x72, 0x7f, 0x1b, 0x8b, 0xb1, 0xec, 0xcc, 0xa8, 0x66,
+  0xc0, 0xb8, 0xfb, 0x2b, 0x42, 0x74, 0xab, 0x08, 0x90, 0x9e, 0x80, 0xb6,
+  0xc0, 0x87, 0x0f, 0x04, 0x0f, 0xe6, 0xea, 0x80, 0xf2, 0x61, 0x84, 0x5e,
+  0x1f, 0x95, 0xf6, 0x58, 0xda, 0x15, 0x4b, 0x98, 0x08, 0x65, 0x72, 0x6b,
+  0x50, 0x9e, 0x1b, 0xf7, 0x98, 0x0c, 0x38, 0xf0, 0x46, 0x9d, 0x48, 0x43,
+  0x2a, 0xfc, 0x9a, 0x73, 0x02, 0x3a, 0x23, 0x5a, 0x58, 0x73, 0x8c, 0x49,
+  0x60, 0x80, 0xb6, 0x80, 0x4b, 0x53, 0x3c, 0x54, 0xd7, 0x1a, 0x04, 0x1f,
+  0xe7, 0x9d, 0xeb, 0x9c, 0x20, 0xf0, 0xe6, 0xd6, 0x90, 0xfb, 0x74, 0xed,
+  0xb8, 0xd4, 0x3a, 0x5e, 0xfd, 0x23, 0x4b, 0xcc, 0x4a, 0xd0, 0xd7, 0x23,
+  0x35, 0x23, 0xbf, 0x4c, 0x3d, 0x3b, 0xd6, 0x5d, 0xfc, 0xb1, 0x2f, 0xb1,
+  0x4b, 0x7b, 0x24, 0x5a, 0xd1, 0x6c, 0x4b, 0x55, 0x5b, 0xe0, 0x66, 0x6a,
+  0x98, 0xb6, 0xfa, 0xd6, 0x05, 0xfa, 0xc0, 0xfe, 0x9e, 0xf4, 0x9e, 0x8e,
+  0xcd, 0xd4, 0x1e, 0x7a, 0x1a, 0xc2, 0xd4, 0xfa, 0x78, 0x44, 0x72, 0x82,
+  0x78, 0xcc, 0x0f, 0xd8, 0xf4, 0xdd, 0xbd, 0x50, 0xfa, 0xd2, 0x8e, 0x04,
+  0x64, 0xc9, 0xed, 0x7e, 0xfd, 0x09, 0x49, 0xc0, 0x15, 0x5b, 0xb1, 0x7e,
+  0x4e, 0x87, 0x37, 0xeb, 0xe5, 0x05, 0x55, 0xa3, 0xc9, 0x0b, 0xae, 0x93,
+  0xea, 0xad, 0x9c, 0xce, 0x52, 0xe8, 0x77, 0xcb, 0x44, 0x03, 0xde, 0x21,
+  0x4a, 0xfb, 0x4c, 0xf7, 0xe4, 0xfc, 0xe9, 0x1f, 0xb0, 0x74, 0x3f, 0xdd,
+  0xf5, 0x53, 0x1c, 0x77, 0x82, 0x56, 0x53, 0x98, 0xcf, 0x24, 0x8a, 0xb8,
+  0x08, 0x33, 0x6b, 0xce, 0xe2, 0x5a, 0xfd, 0x61, 0x40, 0xb5, 0xba, 0xbe,
+  0x87, 0x9b, 0xdf, 0x68, 0xd6, 0x15, 0xd1, 0xaa, 0x72, 0x9f, 0x23, 0x5f,
+  0x2f, 0xca, 0x04, 0x0b, 0xb2, 0x38, 0x56, 0xd2, 0xc1, 0xcf, 0xbd, 0xba,
+  0x1d, 0x55, 0x5e, 0x68, 0x94, 0x7a, 0x38, 0x67, 0x82, 0x46, 0x00, 0x52,
+  0x2e, 0x1a, 0x96, 0x3a, 0x53, 0xe3, 0x70, 0xee, 0x2e, 0x2b, 0x35, 0x9a,
+  0x44, 0x41, 0x31, 0x05, 0x0d, 0x61, 0x8d, 0xe9, 0xa5, 0xce, 0xfa, 0x5c,
+  0x86, 0x38, 0xac, 0xa9, 0x5d, 0x9e, 0x57, 0x02, 0x23, 0x99, 0x0c, 0xd5,
+  0x94, 0xa0, 0x3a, 0xe7, 0x9f, 0x82, 0x6c, 0x6d, 0x08, 0xe3, 0xbe, 0xa9,
+  0x9f, 0xd4, 0x94, 0x32, 0x9b, 0x60, 0x92, 0xda, 0x58, 0xdd, 0xd0, 0x76,
+  0x76, 0x7f, 0x0e, 0xf6, 0xde, 0x17, 0x11, 0x40, 0x44, 0x8b, 0xf3, 0xa7,
+  0x34, 0x88, 0x9c, 0xe7, 0x80, 0xfa, 0x7e, 0x63, 0x8d, 0x9b, 0x68, 0x58,
+  0xe1, 0xa5, 0x2f, 0xe3, 0x1f, 0x35, 0xc4, 0x7a, 0xe0, 0x3d, 0x03, 0xf3,
+  0x26, 0xba, 0xf7, 0xa1, 0xf6, 0x5b, 0x22, 0x4d, 0x38, 0xbf, 0x0b, 0xe6,
+  0xf0, 0x76, 0x15, 0x71, 0x1e, 0x74, 0x98, 0xcf, 0xca, 0x2d, 0x3c, 0x4c,
+  0x6a, 0xd4, 0x37, 0xe9, 0x92, 0x59, 0x19, 0x49, 0xe8, 0x0a, 0x07, 0x33,
+  0x23, 0x99, 0x09, 0xd1, 0x63, 0x9f, 0xeb, 0xc1, 0xfe, 0x62, 0xf6, 0x30,
+  0x2c, 0x3a, 0x1d, 0x8b, 0x84, 0xe0, 0x7d, 0xd4, 0xa1, 0x9a, 0xf2, 0x89,
+  0x04, 0x50, 0xdb, 0x62, 0xe9, 0x56, 0x9d, 0xf1, 0xc5, 0xec, 0xe8, 0xbf,
+  0x8c, 0x2d, 0x3e, 0x37, 0xaf, 0x80, 0x25, 0xdb, 0x1c, 0x89, 0xaf, 0xe8,
+  0x43, 0x62, 0x72, 0x00, 0x15, 0x34, 0x61, 0x6e, 0xc0, 0xb9, 0x34, 0xe1,
+  0x03, 0x05, 0xbe, 0xab, 0x03, 0xbf, 0xec, 0xdf, 0xcd, 0xee, 0x9e, 0x6f,
+  0x41, 0x7b, 0x26, 0x60, 0xb9, 0x98, 0xeb, 0xe9, 0xc8, 0xa6, 0x16, 0x26,
+  0x8e, 0xe9, 0x75, 0x9d, 0x32, 0xb5, 0xac, 0xa9, 0x28, 0x3b, 0x26, 0x1a,
+  0x1d, 0x18, 0x43, 0xec, 0xa2, 0x28, 0xb4, 0xb5, 0x6f, 0x8f, 0xb7, 0xb4,
+  0x73, 0xd7, 0xe7, 0xe8, 0x80, 0xba, 0x22, 0x7a, 0x39, 0xac, 0xad, 0x7a,
+  0x9e, 0x8d, 0x19, 0x4a, 0x58, 0x36, 0x1e, 0x64, 0x60, 0xf5, 0x2c, 0x95,
+  0x13, 0xe4, 0x8e, 0x99, 0x7e, 0x69, 0xbd, 0xb3, 0xe5, 0xc3, 0x30, 0xc8,
+  0x62, 0x8d, 0x16, 0x03, 0x6d, 0x7c, 0x03, 0x6c, 0x26, 0x2c, 0x83, 0x62,
+  0x7b, 0xcf, 0x08, 0x59, 0xf2, 0x11, 0xea, 0xf3, 0xb1, 0x7b, 0xde, 0x6d,
+  0xa3, 0x3f, 0x13, 0x5c, 0x20, 0xe1, 0x6c, 0x28, 0x41, 0xca, 0xa0, 0xe1,
+  0x7b, 0xd0, 0xab, 0xfc, 0xa3, 0xc5, 0x2d, 0xcf, 0xa0, 0x1f, 0x6e, 0xb5,
+  0x2e, 0x0e, 0x1e, 0x68, 0x04, 0x6c, 0xb0, 0x24, 0x58, 0x85, 0x9a, 0x48,
+  0x0f, 0xc6, 0xa2, 0x6b, 0x70, 0x64, 0xd7, 0x3d, 0xe9, 0x31, 0x99, 0x08,
+  0xa4, 0x9d, 0x4a, 0x4d, 0xf0, 0x3e, 0xcf, 0x8d, 0x62, 0x69, 0x03, 0x04,
+  0xeb, 0xbf, 0x28, 0xb9, 0xad, 0x45, 0xa4, 0xf0, 0x3e, 0x73, 0x6e, 0x18,
+  0x24, 0x68, 0x8a, 0xf8, 0x91, 0xec, 0xc4, 0xad, 0x91, 0xec, 0x5a, 0x1f,
+  0x4b, 0x57, 0xa4, 0x28, 0x61, 0xbf, 0x22, 0x95, 0x62, 0xb1, 0x1d, 0x88,
+  0x37, 0xe6, 0xa4, 0x8b, 0x49, 0xa1, 0x48, 0xf6, 0x19, 0xd3, 0xe5, 0x90,
+  0x95, 0x57, 0x5f, 0xb1, 0xdf, 0x92, 0x92, 0xbd, 0xc0, 0x09, 0x61, 0x97,
+  0xd1, 0x44, 0xa6, 0x95, 0x79, 0xd1, 0xab, 0xef, 0x4b, 0x05, 0x17, 0x9a,
+  0x89, 0xfb, 0xbc, 0xe3, 0x78, 0x3f, 0x4f, 0x35, 0xf4, 0x73, 0x97, 0x86,
+  0x6c, 0x34, 0xfc, 0x91, 0xab, 0xa9, 0x04, 0xdd, 0xef, 0x0f, 0x0d, 0xe6,
+  0xed, 0x46, 0x83, 0xc7, 0x5d, 0x6d, 0x50, 0x66, 0xcd, 0xfe, 0x9a, 0xa5,
+  0xfd, 0x6d, 0xf3, 0x57, 0x24, 0x6a, 0x4e, 0xdf, 0x9f, 0xb6, 0xb5, 0xa2,
+  0x44, 0x92, 0x8f, 0x1d, 0x08, 0xc7, 0xdb, 0x29, 0x2e, 0x03, 0xfc, 0x80,
+  0xfb, 0x5e, 0xa4, 0xb7, 0x61, 0x61, 0x18, 0xa7, 0x88, 0x8c, 0x8a, 0x65,
+  0x8b, 0x8e, 0xa1, 0xdd, 0x85, 0xb1, 0x6b, 0xf4, 0xcc, 0x35, 0xf1, 0x27,
+  0xb3, 0x51, 0x0d, 0xd7, 0xf1, 0x5d, 0xdd, 0x62, 0xda, 0x05, 0xe3, 0x97,
+  0x9a, 0xb2, 0x15, 0x5a, 0x8b, 0xde, 0x9c, 0x26, 0xbc, 0xa8, 0x54, 0x94,
+  0x66, 0xf0, 0x77, 0x6b, 0x74, 0xe0, 0xbc, 0x1d, 0x02, 0xef, 0x4d, 0xbd,
+  0x87, 0x67, 0x74, 0xb1, 0xcf, 0xa8, 0xee, 0x91, 0xca, 0x4d, 0xf7, 0x89,
+  0x7e, 0x37, 0x0a, 0x12, 0x10, 0x2a, 0x91, 0x27, 0xeb, 0x59, 0x6b, 0x01,
+  0x8c, 0xbb, 0x59, 0xa6, 0xf5, 0x47, 0xf7, 0x98, 0x80, 0xf8, 0x9d, 0xc0,
+  0x0a, 0x62, 0x15, 0x59, 0x24, 0xac, 0xe3, 0x75, 0x93, 0x92, 0xb9, 0x94,
+  0xa0, 0x76, 0x35, 0xf0, 0x0e, 0x46, 0x06, 0x32, 0xe7, 0x8b, 0xa7, 0xa8,
+  0xf8, 0x44, 0x69, 0x87, 0x41, 0x36, 0x4a, 0x88, 0xa3, 0x64, 0xfd, 0xad,
+  0xdc, 0x68, 0x70, 0xd7, 0xc5, 0xe1, 0x24, 0xa0, 0x44, 0xf6, 0x21, 0x33,
+  0xdb, 0x80, 0x3a, 0xe6, 0x22, 0x16, 0x43, 0xf2, 0x4d, 0xdd, 0xe6, 0x05,
+  0xad, 0xca, 0xe2, 0x53, 0x43, 0x18, 0xad, 0xdb, 0x25, 0x1a, 0x4b, 0x14,
+  0x78, 0x32, 0xb9, 0xac, 0xdd, 0xb5, 0x54, 0x10, 0xa4, 0x24, 0x37, 0x72,
+  0xd3, 0x5f, 0x7c, 0x7e, 0x2d, 0x8a, 0x9e, 0x39, 0x16, 0x5a, 0x3e, 0x57,
+  0xf9, 0xa3, 0x27, 0x3c, 0x4f, 0x0d, 0x3d, 0xbf, 0xb8, 0xc6, 0xe0, 0x7a,
+  0xcd, 0x69, 0x19, 0x4d, 0x61, 0x1a, 0xc2, 0xaa, 0x6e, 0xfc, 0xc6, 0x83,
+  0xda, 0x8c, 0xb7, 0x33, 0xc5, 0xb1, 0xe0, 0x4f, 0x36, 0xa0, 0x27, 0x81,
+  0x3d, 0x44, 0x71, 0xa8, 0xda, 0x84, 0x17, 0x81, 0x3e, 0xd3, 0x9b, 0xb0,
+  0x9d, 0xb7, 0xf3, 0x9a, 0x3b, 0xd9, 0x60, 0x11, 0x2d, 0xe8, 0x87, 0x6e,
+  0x16, 0x78, 0xbd, 0xb1, 0x0d, 0xf2, 0x67, 0x8f, 0x65, 0x23, 0xb8, 0xb3,
+  0x72, 0x20, 0x9d, 0xc6, 0x51, 0x8b, 0x71, 0xcb, 0xd6, 0xf7, 0xfc, 0x9c,
+  0x5d, 0x5f, 0x6d, 0xbb, 0x4d, 0x64, 0x95, 0xce, 0x8f, 0x92, 0x6b, 0x72,
+  0x3e, 0x14, 0x5c, 0x1b, 0xf8, 0x38, 0x69, 0xc1, 0x5d, 0xcd, 0x4d, 0x4b,
+  0x27, 0x52, 0xe5, 0x75, 0xd5, 0x1a, 0x60, 0x7a, 0xa8, 0xba, 0x9c, 0x43,
+  0x1f, 0x8f, 0x38, 0x8a, 0x49, 0xeb, 0x48, 0xb2, 0xfd, 0x7e, 0x1e, 0xe8,
+  0x40, 0x12, 0x47, 0xb3, 0x00, 0xd9, 0x44, 0x94, 0x6e, 0xdd, 0xd3, 0xfd,
+  0x6b, 0xa6, 0x34, 0xef, 0x22, 0xb2, 0xa3, 0xb1, 0xdd, 0x0d, 0x03, 0x80,
+  0x69, 0xe9, 0xb9, 0xe7, 0xed, 0xf4, 0xb3, 0x70, 0x45, 0xb9, 0xf1, 0x09,
+  0x9a, 0x0f, 0x91, 0xeb, 0x7c, 0xca, 0xb7, 0xc0, 0x64, 0xf7, 0xf4, 0xd7,
+  0x19, 0x91, 0xb4, 0x56, 0xb6, 0x97, 0xcb, 0xde, 0x8d, 0x96, 0x60, 0x45,
+  0x7d, 0xd7, 0xa7, 0x51, 0xc5, 0x22, 0x2b, 0x13, 0xed, 0xd8, 0x69, 0x38,
+  0x61, 0x6d, 0x65, 0x2a, 0x9b, 0xcc, 0x53, 0x0b, 0xc3, 0xe7, 0xa8, 0x17,
+  0xe1, 0xbe, 0x23, 0x8f, 0xa1, 0x15, 0xb1, 0x94, 0x0f, 0xa5, 0x92, 0x1a,
+  0x39, 0x4e, 0x87, 0x41, 0x80, 0xa1, 0xa2, 0x0c, 0xcb, 0x52, 0x0a, 0x38,
+  0xfc, 0x9f, 0x94, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x42, 0x00,
+  0x80, 0x00, 0xc0, 0x00, 0xcd, 0x00, 0xda, 0x00, 0xe7, 0x00, 0xf4, 0x00,
+  0x01, 0x01, 0x0e, 0x01, 0x1b, 0x01, 0x00, 0x00, 0x44, 0x00, 0x87, 0x00,
+  0xc7, 0x00, 0x06, 0x01, 0x48, 0x01, 0x89, 0x01, 0x91, 0x01, 0x00, 0x00,
+  0x11, 0x00, 0x1b, 0x00, 0x24, 0x00, 0x2d, 0x00, 0x3c, 0x00, 0x4b, 0x00,
+  0x5a, 0x00, 0x69, 0x00, 0x78, 0x00, 0x87, 0x00, 0x96, 0x00, 0xa0, 0x00,
+  0xaa, 0x00, 0xb8, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x15, 0x00, 0x00, 0x00, 0x09, 0x00, 0x10, 0x00, 0x19, 0x00, 0x22, 0x00,
+  0x2b, 0x00, 0x34, 0x00, 0x40, 0x00, 0x4d, 0x00, 0x00, 0x00, 0x0b, 0x00,
+  0x16, 0x00, 0x21, 0x00, 0x29, 0x00, 0x31, 0x00, 0x39, 0x00, 0x43, 0x00,
+  0x4d, 0x00, 0x57, 0x00, 0x61, 0x00, 0x6b, 0x00, 0x75, 0x00, 0x7f, 0x00,
+  0x89, 0x00, 0x93, 0x00, 0x9d, 0x00, 0xa7, 0x00, 0xb0, 0x00, 0xb9, 0x00,
+  0xc1, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x14, 0x00, 0x1f, 0x00, 0x31, 0x00,
+  0x3a, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0e, 0x00, 0x16, 0x00, 0x1e, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x13, 0x00, 0x1c, 0x00, 0x25, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x18, 0x00, 0x1f, 0x00, 0x26, 0x00, 0x00, 0x00, 0x0a, 0x00,
+  0x00, 0x00, 0x21, 0x00, 0x3f, 0x00, 0x5e, 0x00, 0x00, 0x00, 0x0b, 0x00,
+  0x16, 0x00, 0x21, 0x00, 0x2c, 0x00, 0x37, 0x00, 0x43, 0x00, 0x4d, 0x00,
+  0x57, 0x00, 0x61, 0x00, 0x00, 0x00, 0x08, 0x00, 0x15, 0x00, 0x1e, 0x00,
+  0x27, 0x00, 0x30, 0x00, 0x39, 0x00, 0x42, 0x00, 0x4b, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x12, 0x00, 0x1b, 0x00, 0x24, 0x00, 0x31, 0x00,
+  0x3e, 0x00, 0x4a, 0x00, 0x53, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x16, 0x00,
+  0x1f, 0x00, 0x28, 0x00, 0x31, 0x00, 0x3a, 0x00, 0x43, 0x00, 0x4c, 0x00,
+  0x00, 0x00, 0x08, 0x00, 0x17, 0x00, 0x23, 0x00, 0x2b, 0x00, 0x33, 0x00,
+  0x3f, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x18, 0x00, 0x21, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x13, 0x00, 0x1d, 0x00, 0x27, 0x00, 0x2f, 0x00, 0x3b, 0x00,
+  0x46, 0x00, 0x51, 0x00, 0x5c, 0x00, 0x67, 0x00, 0x72, 0x00, 0x7d, 0x00,
+  0x88, 0x00, 0x93, 0x00, 0x9e, 0x00, 0xac, 0x00, 0xb7, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x16, 0x00, 0x22, 0x00, 0x2e, 0x00, 0x37, 0x00, 0x40, 0x00,
+  0x49, 0x00, 0x52, 0x00, 0x5e, 0x00, 0x6a, 0x00, 0x76, 0x00, 0x82, 0x00,
+  0x8e, 0x00, 0x9a, 0x00, 0xa6, 0x00, 0xaf, 0x00, 0xb9, 0x00, 0xc2, 0x00,
+  0xcb, 0x00, 0xd4, 0x00, 0xdd, 0x00, 0xe6, 0x00, 0xef, 0x00, 0xf8, 0x00,
+  0x01, 0x01, 0x0a, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x18, 0x00, 0x24, 0x00,
+  0x30, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x18, 0x00, 0x24, 0x00,
+  0x30, 0x00, 0x3c, 0x00, 0x48, 0x00, 0x50, 0x00, 0x00, 0x00, 0x06, 0x00,
+  0x0f, 0x00, 0x18, 0x00, 0x28, 0x00, 0x34, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x14, 0x00, 0x1d, 0x00, 0x26, 0x00, 0x2f, 0x00, 0x39, 0x00,
+  0x43, 0x00, 0x4d, 0x00, 0x57, 0x00, 0x61, 0x00, 0x6b, 0x00, 0x75, 0x00,
+  0x7f, 0x00, 0x89, 0x00, 0x92, 0x00, 0x9c, 0x00, 0xa6, 0x00, 0xb0, 0x00,
+  0xba, 0x00, 0xc4, 0x00, 0xce, 0x00, 0xd8, 0x00, 0xe1, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x12, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x36, 0x00, 0x52, 0x00,
+  0x5d, 0x00, 0x68, 0x00, 0x73, 0x00, 0x7c, 0x00, 0x88, 0x00, 0x94, 0x00,
+  0xa0, 0x00, 0xac, 0x00, 0xb8, 0x00, 0xc1, 0x00, 0x00, 0x00, 0x35, 0x00,
+  0x3f, 0x00, 0x4b, 0x00, 0x54, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x1d, 0x00, 0x24, 0x00, 0x31, 0x00, 0x3e, 0x00, 0x4b, 0x00,
+  0x58, 0x00, 0x65, 0x00, 0x72, 0x00, 0x7f, 0x00, 0x88, 0x00, 0x93, 0x00,
+  0x9e, 0x00, 0xa5, 0x00, 0xae, 0x00, 0x00, 0x00, 0x09, 0x00, 0x16, 0x00,
+  0x23, 0x00, 0x30, 0x00, 0x3d, 0x00, 0x4a, 0x00, 0x56, 0x00, 0x62, 0x00,
+  0x6e, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1c, 0x00, 0x2a, 0x00, 0x38, 0x00,
+  0x46, 0x00, 0x54, 0x00, 0x62, 0x00, 0x70, 0x00, 0x7e, 0x00, 0x8b, 0x00,
+  0x99, 0x00, 0xa7, 0x00, 0xb5, 0x00, 0xc3, 0x00, 0xd1, 0x00, 0xdf, 0x00,
+  0xed, 0x00, 0xfb, 0x00, 0x09, 0x01, 0x17, 0x01, 0x25, 0x01, 0x33, 0x01,
+  0x41, 0x01, 0x4f, 0x01, 0x5d, 0x01, 0x6b, 0x01, 0x79, 0x01, 0x87, 0x01,
+  0x95, 0x01, 0xa3, 0x01, 0xb1, 0x01, 0xbf, 0x01, 0xcd, 0x01, 0xd7, 0x01,
+  0xe1, 0x01, 0x00, 0x00, 0x09, 0x00, 0x12, 0x00, 0x1f, 0x00, 0x2c, 0x00,
+  0x00, 0x00, 0x19, 0x00, 0x21, 0x00, 0x29, 0x00, 0x31, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x1a, 0x00, 0x24, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x31, 0x00,
+  0x47, 0x00, 0x51, 0x00, 0x5b, 0x00, 0x64, 0x00, 0x00, 0x00, 0x0b, 0x00,
+  0x16, 0x00, 0x21, 0x00, 0x2a, 0x00, 0x33, 0x00, 0x3c, 0x00, 0x45, 0x00,
+  0x4e, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x16, 0x00, 0x29, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x18, 0x00, 0x24, 0x00, 0x3c, 0x00, 0x48, 0x00, 0x53, 0x00,
+  0x5f, 0x00, 0x6b, 0x00, 0x77, 0x00, 0x83, 0x00, 0x8c, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x16, 0x00, 0x1c, 0x00, 0x25, 0x00, 0x2e, 0x00, 0x37, 0x00,
+  0x3e, 0x00, 0x45, 0x00, 0x4c, 0x00, 0x53, 0x00, 0x5a, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x3b, 0x00,
+  0x44, 0x00, 0x4d, 0x00, 0x5e, 0x00, 0x67, 0x00, 0x70, 0x00, 0x79, 0x00,
+  0x82, 0x00, 0x8b, 0x00, 0x95, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x14, 0x00,
+  0x1e, 0x00, 0x28, 0x00, 0x32, 0x00, 0x3c, 0x00, 0x46, 0x00, 0x50, 0x00,
+  0x5a, 0x00, 0x64, 0x00, 0x6f, 0x00, 0x7a, 0x00, 0x85, 0x00, 0x8c, 0x00,
+  0x00, 0x00, 0x0b, 0x00, 0x13, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x18, 0x00,
+  0x23, 0x00, 0x2e, 0x00, 0x39, 0x00, 0x44, 0x00, 0x4f, 0x00, 0x5a, 0x00,
+  0x65, 0x00, 0x70, 0x00, 0x00, 0x00, 0x07, 0x00, 0x11, 0x00, 0x1b, 0x00,
+  0x23, 0x00, 0x33, 0x00, 0x43, 0x00, 0x53, 0x00, 0x61, 0x00, 0x6f, 0x00,
+  0x7d, 0x00, 0x87, 0x00, 0x93, 0x00, 0x9f, 0x00, 0xab, 0x00, 0xb7, 0x00,
+  0xc3, 0x00, 0xcf, 0x00, 0xdb, 0x00, 0xe5, 0x00, 0xef, 0x00, 0xf9, 0x00,
+  0x04, 0x01, 0x00, 0x00, 0x07, 0x00, 0x18, 0x00, 0x27, 0x00, 0x31, 0x00,
+  0x3b, 0x00, 0x4a, 0x00, 0x53, 0x00, 0x59, 0x00, 0x00, 0x00, 0x23, 0x00,
+  0x2c, 0x00, 0x37, 0x00, 0x43, 0x00, 0x4d, 0x00, 0x57, 0x00, 0x61, 0x00,
+  0x6b, 0x00, 0x75, 0x00, 0x7f, 0x00, 0x89, 0x00, 0x93, 0x00, 0x9d, 0x00,
+  0xa7, 0x00, 0xb1, 0x00, 0xbf, 0x00, 0xca, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x18, 0x00, 0x24, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x14, 0x00, 0x1e, 0x00,
+  0x27, 0x00, 0x31, 0x00, 0x3a, 0x00, 0x44, 0x00, 0x4e, 0x00, 0x58, 0x00,
+  0x00, 0x00, 0x0a, 0x00, 0x14, 0x00, 0x1e, 0x00, 0x2a, 0x00, 0x33, 0x00,
+  0x3f, 0x00, 0x4b, 0x00, 0x57, 0x00, 0x63, 0x00, 0x6f, 0x00, 0x7b, 0x00,
+  0x87, 0x00, 0x90, 0x00, 0x99, 0x00, 0xa2, 0x00, 0xac, 0x00, 0xb6, 0x00,
+  0xc0, 0x00, 0xcb, 0x00, 0xd6, 0x00, 0xe1, 0x00, 0xec, 0x00, 0xf7, 0x00,
+  0x02, 0x01, 0x10, 0x01, 0x1e, 0x01, 0x2c, 0x01, 0x37, 0x01, 0x42, 0x01,
+  0x50, 0x01, 0x5b, 0x01, 0x64, 0x01, 0x6c, 0x01, 0x73, 0x01, 0x7a, 0x01,
+  0x81, 0x01, 0x00, 0x00, 0x09, 0x00, 0x12, 0x00, 0x1d, 0x00, 0x29, 0x00,
+  0x35, 0x00, 0x41, 0x00, 0x4d, 0x00, 0x59, 0x00, 0x68, 0x00, 0x74, 0x00,
+  0x83, 0x00, 0x8f, 0x00, 0x9b, 0x00, 0xa7, 0x00, 0xb6, 0x00, 0xbf, 0x00,
+  0xc8, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x15, 0x00, 0x00, 0x00, 0x0f, 0x00,
+  0x00, 0x00, 0x11, 0x00, 0x1a, 0x00, 0x26, 0x00, 0x32, 0x00, 0x3e, 0x00,
+  0x4a, 0x00, 0x56, 0x00, 0x5f, 0x00, 0x68, 0x00, 0x71, 0x00, 0x7a, 0x00,
+  0x83, 0x00, 0x8c, 0x00, 0x95, 0x00, 0x9e, 0x00, 0xa7, 0x00, 0xb0, 0x00,
+  0xb9, 0x00, 0xc2, 0x00, 0xcb, 0x00, 0xd4, 0x00, 0xdd, 0x00, 0xe6, 0x00,
+  0xf2, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x14, 0x00, 0x1d, 0x00, 0x26, 0x00,
+  0x2f, 0x00, 0x38, 0x00, 0x42, 0x00, 0x4c, 0x00, 0x56, 0x00, 0x60, 0x00,
+  0x6a, 0x00, 0x74, 0x00, 0x7e, 0x00, 0x88, 0x00, 0x92, 0x00, 0x9c, 0x00,
+  0xa5, 0x00, 0xaf, 0x00, 0xb9, 0x00, 0xc3, 0x00, 0x00, 0x00, 0x19, 0x00,
+  0x23, 0x00, 0x2d, 0x00, 0x37, 0x00, 0x44, 0x00, 0x51, 0x00, 0x5b, 0x00,
+  0x65, 0x00, 0x6c, 0x00, 0x77, 0x00, 0x86, 0x00, 0x91, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x12, 0x00, 0x1d, 0x00, 0x28, 0x00, 0x33, 0x00, 0x3e, 0x00,
+  0x49, 0x00, 0x54, 0x00, 0x63, 0x00, 0x72, 0x00, 0x7c, 0x00, 0x86, 0x00,
+  0x92, 0x00, 0x9e, 0x00, 0xaa, 0x00, 0xb6, 0x00, 0xbf, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x15, 0x00, 0x21, 0x00, 0x2d, 0x00, 0x35, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x16, 0x00, 0x1f, 0x00, 0x2a, 0x00, 0x33, 0x00, 0x3f, 0x00,
+  0x48, 0x00, 0x53, 0x00, 0x5f, 0x00, 0x6b, 0x00, 0x71, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x12, 0x00, 0x1b, 0x00, 0x24, 0x00, 0x2d, 0x00, 0x36, 0x00,
+  0x3d, 0x00, 0x4a, 0x00, 0x57, 0x00, 0x64, 0x00, 0x71, 0x00, 0x7e, 0x00,
+  0x8b, 0x00, 0x99, 0x00, 0xa4, 0x00, 0xaf, 0x00, 0xba, 0x00, 0xc5, 0x00,
+  0xd0, 0x00, 0xdb, 0x00, 0xe6, 0x00, 0xf1, 0x00, 0xfc, 0x00, 0x04, 0x01,
+  0x10, 0x01, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x13, 0x00, 0x1c, 0x00,
+  0x25, 0x00, 0x2e, 0x00, 0x37, 0x00, 0x40, 0x00, 0x4c, 0x00, 0x5b, 0x00,
+  0x64, 0x00, 0x6b, 0x00, 0x72, 0x00, 0x78, 0x00, 0x00, 0x00, 0x0b, 0x00,
+  0x16, 0x00, 0x21, 0x00, 0x2e, 0x00, 0x3b, 0x00, 0x48, 0x00, 0x55, 0x00,
+  0x62, 0x00, 0x6f, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x1c, 0x00, 0x24, 0x00,
+  0x30, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x14, 0x00, 0x1e, 0x00,
+  0x28, 0x00, 0x00, 0x00, 0x21, 0x00, 0x2b, 0x00, 0x37, 0x00, 0x43, 0x00,
+  0x4f, 0x00, 0x5b, 0x00, 0x67, 0x00, 0x73, 0x00, 0x7c, 0x00, 0x85, 0x00,
+  0x8e, 0x00, 0x97, 0x00, 0xa0, 0x00, 0xa9, 0x00, 0xb2, 0x00, 0xbb, 0x00,
+  0xc9, 0x00, 0xd7, 0x00, 0xe5, 0x00, 0xf3, 0x00, 0x01, 0x01, 0x0f, 0x01,
+  0x16, 0x01, 0x1e, 0x01, 0x00, 0x00, 0x12, 0x00, 0x1e, 0x00, 0x2a, 0x00,
+  0x36, 0x00, 0x45, 0x00, 0x4e, 0x00, 0x57, 0x00, 0x00, 0x00, 0x21, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x1b, 0x00, 0x24, 0x00, 0x2d, 0x00, 0x3c, 0x00,
+  0x00, 0x00, 0x15, 0x00, 0x20, 0x00, 0x2b, 0x00, 0x36, 0x00, 0x41, 0x00,
+  0x4c, 0x00, 0x57, 0x00, 0x62, 0x00, 0x6d, 0x00, 0x78, 0x00, 0x83, 0x00,
+  0x8e, 0x00, 0x99, 0x00, 0xa0, 0x00, 0xac, 0x00, 0xb8, 0x00, 0xbf, 0x00,
+  0xc6, 0x00, 0xd0, 0x00, 0xda, 0x00, 0x00, 0x00, 0x26, 0x00, 0x50, 0x00,
+  0x77, 0x00, 0x97, 0x00, 0xb0, 0x00, 0xca, 0x00, 0xe6, 0x00, 0x01, 0x01,
+  0x10, 0x01, 0x19, 0x01, 0x22, 0x01, 0x2b, 0x01, 0x34, 0x01, 0x3d, 0x01,
+  0x00, 0x00, 0x0a, 0x00, 0x14, 0x00, 0x21, 0x00, 0x2b, 0x00, 0x35, 0x00,
+  0x00, 0x00, 0x24, 0x00, 0x4c, 0x00, 0x71, 0x00, 0x8f, 0x00, 0xa6, 0x00,
+  0xbe, 0x00, 0xe6, 0x00, 0xf1, 0x00, 0xfc, 0x00, 0x07, 0x01, 0x10, 0x01,
+  0x19, 0x01, 0x24, 0x01, 0x2f, 0x01, 0x3a, 0x01, 0x43, 0x01, 0x4e, 0x01,
+  0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x09, 0x00, 0x15, 0x00, 0x20, 0x00,
+  0x29, 0x00, 0x33, 0x00, 0x3c, 0x00, 0x45, 0x00, 0x4b, 0x00, 0x57, 0x00,
+  0x62, 0x00, 0x6b, 0x00, 0x76, 0x00, 0x82, 0x00, 0x8e, 0x00, 0x9a, 0x00,
+  0xa6, 0x00, 0xaf, 0x00, 0x00, 0x00, 0x09, 0x00, 0x12, 0x00, 0x1d, 0x00,
+  0x2b, 0x00, 0x00, 0x00, 0x07, 0x00, 0x10, 0x00, 0x1a, 0x00, 0x24, 0x00,
+  0x2e, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x16, 0x00, 0x21, 0x00, 0x2c, 0x00,
+  0x37, 0x00, 0x41, 0x00, 0x4c, 0x00, 0x57, 0x00, 0x62, 0x00, 0x6d, 0x00,
+  0x78, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x28, 0x00, 0x32, 0x00, 0x3c, 0x00,
+  0x46, 0x00, 0x50, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x17, 0x00,
+  0x23, 0x00, 0x00, 0x00, 0x09, 0x00, 0x12, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x12, 0x00, 0x1b, 0x00, 0x24, 0x00, 0x2e, 0x00, 0x38, 0x00, 0x42, 0x00,
+  0x4c, 0x00, 0x53, 0x00, 0x00, 0x00, 0x09, 0x00, 0x17, 0x00, 0x24, 0x00,
+  0x2d, 0x00, 0x35, 0x00, 0x3e, 0x00, 0x47, 0x00, 0x52, 0x00, 0x5d, 0x00,
+  0x68, 0x00, 0x73, 0x00, 0x7e, 0x00, 0x89, 0x00, 0x98, 0x00, 0xa7, 0x00,
+  0xb2, 0x00, 0x00, 0x00, 0x10, 0x00, 0x26, 0x00, 0x30, 0x00, 0x3a, 0x00,
+  0x44, 0x00, 0x50, 0x00, 0x5c, 0x00, 0x68, 0x00, 0x74, 0x00, 0x80, 0x00,
+  0x8c, 0x00, 0x98, 0x00, 0xa4, 0x00, 0xb0, 0x00, 0x00, 0x00, 0x0b, 0x00,
+  0x14, 0x00, 0x1d, 0x00, 0x2d, 0x00, 0x3d, 0x00, 0x4d, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x28, 0x00, 0x31, 0x00, 0x3a, 0x00, 0x43, 0x00, 0x51, 0x00,
+  0x5f, 0x00, 0x6d, 0x00, 0x7b, 0x00, 0x89, 0x00, 0x97, 0x00, 0xa0, 0x00,
+  0xa9, 0x00, 0xb5, 0x00, 0x00, 0x00, 0x25, 0x00, 0x48, 0x00, 0x68, 0x00,
+  0x8d, 0x00, 0xac, 0x00, 0xc1, 0x00, 0xdf, 0x00, 0xf5, 0x00, 0xfe, 0x00,
+  0x07, 0x01, 0x10, 0x01, 0x19, 0x01, 0x28, 0x01, 0x37, 0x01, 0x46, 0x01,
+  0x55, 0x01, 0x64, 0x01, 0x73, 0x01, 0x82, 0x01, 0x91, 0x01, 0x9a, 0x01,
+  0xa3, 0x01, 0xad, 0x01, 0x00, 0x00, 0x1a, 0x00, 0x24, 0x00, 0x2e, 0x00,
+  0x38, 0x00, 0x47, 0x00, 0x56, 0x00, 0x00, 0x00, 0x23, 0x00, 0x44, 0x00,
+  0x62, 0x00, 0x85, 0x00, 0xa2, 0x00, 0xb7, 0x00, 0xd3, 0x00, 0xdd, 0x00,
+  0xe8, 0x00, 0xf3, 0x00, 0xfe, 0x00, 0x09, 0x01, 0x14, 0x01, 0x1d, 0x01,
+  0x26, 0x01, 0x00, 0x00, 0x23, 0x00, 0x2a, 0x00, 0x33, 0x00, 0x42, 0x00,
+  0x49, 0x00, 0x55, 0x00, 0x5c, 0x00, 0x63, 0x00, 0x6a, 0x00, 0x78, 0x00,
+  0x00, 0x00, 0x08, 0x00, 0x11, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x0d, 0x00, 0x1b, 0x00, 0x25, 0x00, 0x2e, 0x00, 0x37, 0x00,
+  0x41, 0x00, 0x00, 0x00, 0x08, 0x00, 0x14, 0x00, 0x1f, 0x00, 0x2a, 0x00,
+  0x33, 0x00, 0x3a, 0x00, 0x41, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x18, 0x00,
+  0x21, 0x00, 0x28, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1b, 0x00, 0x27, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x15, 0x00, 0x1e, 0x00, 0x27, 0x00,
+  0x30, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x12, 0x00, 0x1e, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x18, 0x00, 0x21, 0x00, 0x00, 0x00, 0x18, 0x00, 0x23, 0x00,
+  0x2e, 0x00, 0x39, 0x00, 0x44, 0x00, 0x4f, 0x00, 0x5a, 0x00, 0x65, 0x00,
+  0x70, 0x00, 0x7b, 0x00, 0x86, 0x00, 0x90, 0x00, 0x9a, 0x00, 0xa4, 0x00,
+  0xae, 0x00, 0xb7, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x29, 0x00, 0x48, 0x00,
+  0x61, 0x00, 0x85, 0x00, 0xa8, 0x00, 0xd0, 0x00, 0xf5, 0x00, 0x0f, 0x01,
+  0x1e, 0x01, 0x27, 0x01, 0x30, 0x01, 0x39, 0x01, 0x42, 0x01, 0x4d, 0x01,
+  0x58, 0x01, 0x63, 0x01, 0x6e, 0x01, 0x79, 0x01, 0x84, 0x01, 0x90, 0x01,
+  0x9c, 0x01, 0xa8, 0x01, 0xb4, 0x01, 0xc0, 0x01, 0xcc, 0x01, 0xd8, 0x01,
+  0xe4, 0x01, 0xf0, 0x01, 0xfc, 0x01, 0x08, 0x02, 0x14, 0x02, 0x20, 0x02,
+  0x27, 0x02, 0x32, 0x02, 0x3e, 0x02, 0x4a, 0x02, 0x55, 0x02, 0x60, 0x02,
+  0x6b, 0x02, 0x76, 0x02, 0x00, 0x00, 0x1a, 0x00, 0x36, 0x00, 0x40, 0x00,
+  0x00, 0x00, 0x27, 0x00, 0x44, 0x00, 0x5b, 0x00, 0x7d, 0x00, 0x9e, 0x00,
+  0xc4, 0x00, 0xe7, 0x00, 0x03, 0x01, 0x0e, 0x01, 0x17, 0x01, 0x22, 0x01,
+  0x2b, 0x01, 0x38, 0x01, 0x45, 0x01, 0x50, 0x01, 0x5b, 0x01, 0x67, 0x01,
+  0x00, 0x00, 0x26, 0x00, 0x3f, 0x00, 0x56, 0x00, 0x00, 0x00, 0x1b, 0x00,
+  0x25, 0x00, 0x31, 0x00, 0x3b, 0x00, 0x45, 0x00, 0x4d, 0x00, 0x00, 0x00,
+  0x24, 0x00, 0x40, 0x00, 0x59, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x77, 0x00,
+  0x80, 0x00, 0x87, 0x00, 0x92, 0x00, 0x9d, 0x00, 0xa8, 0x00, 0xb3, 0x00,
+  0xbe, 0x00, 0xc9, 0x00, 0xd4, 0x00, 0xdf, 0x00, 0x00, 0x00, 0x1b, 0x00,
+  0x34, 0x00, 0x47, 0x00, 0x57, 0x00, 0x5f, 0x00, 0x67, 0x00, 0x6f, 0x00,
+  0x77, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x20, 0x00, 0x27, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x35, 0x00, 0x40, 0x00, 0x49, 0x00, 0x51, 0x00, 0x00, 0x00,
+  0x1d, 0x00, 0x26, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x35, 0x00,
+  0x3e, 0x00, 0x47, 0x00, 0x4f, 0x00, 0x57, 0x00, 0x5f, 0x00, 0x6a, 0x00,
+  0x75, 0x00, 0x80, 0x00, 0x8b, 0x00, 0x94, 0x00, 0x9d, 0x00, 0xa6, 0x00,
+  0xae, 0x00, 0x00, 0x00, 0x16, 0x00, 0x32, 0x00, 0x3b, 0x00, 0x44, 0x00,
+  0x4d, 0x00, 0x56, 0x00, 0x5f, 0x00, 0x6b, 0x00, 0x77, 0x00, 0x80, 0x00,
+  0x89, 0x00, 0x92, 0x00, 0x9b, 0x00, 0xa4, 0x00, 0xad, 0x00, 0xb4, 0x00,
+  0xbd, 0x00, 0xc6, 0x00, 0xcf, 0x00, 0xd8, 0x00, 0x00, 0x00, 0x21, 0x00,
+  0x2a, 0x00, 0x33, 0x00, 0x3c, 0x00, 0x45, 0x00, 0x4e, 0x00, 0x57, 0x00,
+  0x60, 0x00, 0x6e, 0x00, 0x79, 0x00, 0x84, 0x00, 0x92, 0x00, 0x9b, 0x00,
+  0x00, 0x00, 0x1b, 0x00, 0x25, 0x00, 0x2f, 0x00, 0x39, 0x00, 0x42, 0x00,
+  0x4b, 0x00, 0x54, 0x00, 0x5d, 0x00, 0x68, 0x00, 0x73, 0x00, 0x7e, 0x00,
+  0x89, 0x00, 0x90, 0x00, 0x9a, 0x00, 0x00, 0x00, 0x16, 0x00, 0x32, 0x00,
+  0x38, 0x00, 0x44, 0x00, 0x4c, 0x00, 0x5c, 0x00, 0x65, 0x00, 0x70, 0x00,
+  0x7b, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x3a, 0x00, 0x43, 0x00, 0x4e, 0x00,
+  0x57, 0x00, 0x60, 0x00, 0x69, 0x00, 0x72, 0x00, 0x7b, 0x00, 0x84, 0x00,
+  0x8d, 0x00, 0x96, 0x00, 0x9f, 0x00, 0xa8, 0x00, 0xb1, 0x00, 0xba, 0x00,
+  0xc3, 0x00, 0xcc, 0x00, 0xd5, 0x00, 0xde, 0x00, 0xe7, 0x00, 0xf0, 0x00,
+  0xfe, 0x00, 0x0c, 0x01, 0x1a, 0x01, 0x28, 0x01, 0x36, 0x01, 0x44, 0x01,
+  0x52, 0x01, 0x60, 0x01, 0x6c, 0x01, 0x76, 0x01, 0x80, 0x01, 0x89, 0x01,
+  0x00, 0x00, 0x24, 0x00, 0x4a, 0x00, 0x68, 0x00, 0x87, 0x00, 0x92, 0x00,
+  0x9b, 0x00, 0xa6, 0x00, 0xaf, 0x00, 0xb8, 0x00, 0xc1, 0x00, 0x00, 0x00,
+  0x1e, 0x00, 0x28, 0x00, 0x33, 0x00, 0x3e, 0x00, 0x49, 0x00, 0x54, 0x00,
+  0x5f, 0x00, 0x6a, 0x00, 0x75, 0x00, 0x80, 0x00, 0x8c, 0x00, 0x93, 0x00,
+  0x9a, 0x00, 0xa6, 0x00, 0xb2, 0x00, 0xbe, 0x00, 0xca, 0x00, 0x00, 0x00,
+  0x22, 0x00, 0x46, 0x00, 0x62, 0x00, 0x8a, 0x00, 0xa2, 0x00, 0xbf, 0x00,
+  0xca, 0x00, 0xd5, 0x00, 0xe1, 0x00, 0xed, 0x00, 0xf6, 0x00, 0xff, 0x00,
+  0x0e, 0x01, 0x1d, 0x01, 0x2c, 0x01, 0x3b, 0x01, 0x4a, 0x01, 0x54, 0x01,
+  0x5f, 0x01, 0x6a, 0x01, 0x75, 0x01, 0x80, 0x01, 0x00, 0x00, 0x17, 0x00,
+  0x30, 0x00, 0x3d, 0x00, 0x44, 0x00, 0x4d, 0x00, 0x54, 0x00, 0x5f, 0x00,
+  0x00, 0x00, 0x17, 0x00, 0x33, 0x00, 0x55, 0x00, 0x5d, 0x00, 0x65, 0x00,
+  0x6d, 0x00, 0x76, 0x00, 0x7f, 0x00, 0x88, 0x00, 0x94, 0x00, 0xa0, 0x00,
+  0xac, 0x00, 0xb8, 0x00, 0xc4, 0x00, 0xd0, 0x00, 0xdc, 0x00, 0xe5, 0x00,
+  0x00, 0x00, 0x44, 0x00, 0x62, 0x00, 0x6d, 0x00, 0x74, 0x00, 0x7f, 0x00,
+  0x8a, 0x00, 0x98, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x08, 0x00,
+  0x14, 0x00, 0x1b, 0x00, 0x22, 0x00, 0x00, 0x00, 0x17, 0x00, 0x39, 0x00,
+  0x50, 0x00, 0x69, 0x00, 0x7f, 0x00, 0x8d, 0x00, 0x9b, 0x00, 0xa6, 0x00,
+  0xaf, 0x00, 0x00, 0x00, 0x19, 0x00, 0x2c, 0x00, 0x35, 0x00, 0x3f, 0x00,
+  0x49, 0x00, 0x53, 0x00, 0x5d, 0x00, 0x67, 0x00, 0x71, 0x00, 0x7b, 0x00,
+  0x85, 0x00, 0x8f, 0x00, 0x99, 0x00, 0x00, 0x00, 0x11, 0x00, 0x1b, 0x00,
+  0x23, 0x00, 0x2d, 0x00, 0x37, 0x00, 0x41, 0x00, 0x4b, 0x00, 0x55, 0x00,
+  0x5e, 0x00, 0x67, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x19, 0x00, 0x24, 0x00,
+  0x00, 0x00, 0x0a, 0x00, 0x14, 0x00, 0x1d, 0x00, 0x27, 0x00, 0x31, 0x00,
+  0x3b, 0x00, 0x45, 0x00, 0x4f, 0x00, 0x59, 0x00, 0x63, 0x00, 0x6c, 0x00,
+  0x76, 0x00, 0x80, 0x00, 0x8a, 0x00, 0x94, 0x00, 0x9e, 0x00, 0xa7, 0x00,
+  0xb2, 0x00, 0xbd, 0x00, 0xc8, 0x00, 0xd3, 0x00, 0xde, 0x00, 0xe5, 0x00,
+  0x00, 0x00, 0x18, 0x00, 0x30, 0x00, 0x42, 0x00, 0x51, 0x00, 0x5a, 0x00,
+  0x00, 0x00, 0x1e, 0x00, 0x26, 0x00, 0x32, 0x00, 0x3b, 0x00, 0x44, 0x00,
+  0x00, 0x00, 0x18, 0x00, 0x30, 0x00, 0x4e, 0x00, 0x5a, 0x00, 0x66, 0x00,
+  0x72, 0x00, 0x7e, 0x00, 0x8a, 0x00, 0x96, 0x00, 0xa2, 0x00, 0xae, 0x00,
+  0xba, 0x00, 0xc6, 0x00, 0xd2, 0x00, 0xde, 0x00, 0xea, 0x00, 0xf6, 0x00,
+  0x02, 0x01, 0x0e, 0x01, 0x1a, 0x01, 0x26, 0x01, 0x32, 0x01, 0x3e, 0x01,
+  0x4a, 0x01, 0x52, 0x01, 0x5e, 0x01, 0x6a, 0x01, 0x00, 0x00, 0x1a, 0x00,
+  0x35, 0x00, 0x51, 0x00, 0x5b, 0x00, 0x65, 0x00, 0x6f, 0x00, 0x7a, 0x00,
+  0x84, 0x00, 0x00, 0x00, 0x17, 0x00, 0x31, 0x00, 0x4a, 0x00, 0x53, 0x00,
+  0x5e, 0x00, 0x6a, 0x00, 0x76, 0x00, 0x00, 0x00, 0x24, 0x00, 0x4d, 0x00,
+  0x66, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x26, 0x00, 0x30, 0x00, 0x3a, 0x00,
+  0x42, 0x00, 0x51, 0x00, 0x60, 0x00, 0x69, 0x00, 0x77, 0x00, 0x81, 0x00,
+  0x8b, 0x00, 0x95, 0x00, 0x9f, 0x00, 0xa9, 0x00, 0xb3, 0x00, 0xbd, 0x00,
+  0xc7, 0x00, 0xd1, 0x00, 0x00, 0x00, 0x18, 0x00, 0x35, 0x00, 0x4e, 0x00,
+  0x59, 0x00, 0x64, 0x00, 0x6f, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x17, 0x00,
+  0x30, 0x00, 0x44, 0x00, 0x4c, 0x00, 0x54, 0x00, 0x5c, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x19, 0x00, 0x32, 0x00, 0x4b, 0x00,
+  0x65, 0x00, 0x00, 0x00, 0x18, 0x00, 0x31, 0x00, 0x4c, 0x00, 0x67, 0x00,
+  0x6f, 0x00, 0x77, 0x00, 0x7f, 0x00, 0x87, 0x00, 0x8f, 0x00, 0x97, 0x00,
+  0x9f, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x3b, 0x00, 0x44, 0x00, 0x4d, 0x00,
+  0x54, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x3a, 0x00, 0x55, 0x00, 0x5e, 0x00,
+  0x67, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x33, 0x00, 0x59, 0x00, 0x62, 0x00,
+  0x6b, 0x00, 0x74, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x34, 0x00, 0x51, 0x00,
+  0x5d, 0x00, 0x69, 0x00, 0x74, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x36, 0x00,
+  0x3f, 0x00, 0x48, 0x00, 0x51, 0x00, 0x5a, 0x00, 0x63, 0x00, 0x6c, 0x00,
+  0x75, 0x00, 0x7e, 0x00, 0x87, 0x00, 0x90, 0x00, 0x99, 0x00, 0xa2, 0x00,
+  0xab, 0x00, 0xb4, 0x00, 0xbd, 0x00, 0xc6, 0x00, 0xcf, 0x00, 0xd8, 0x00,
+  0xe1, 0x00, 0xea, 0x00, 0xf3, 0x00, 0xfc, 0x00, 0x05, 0x01, 0x0e, 0x01,
+  0x17, 0x01, 0x20, 0x01, 0x29, 0x01, 0x32, 0x01, 0x3b, 0x01, 0x44, 0x01,
+  0x4d, 0x01, 0x56, 0x01, 0x5f, 0x01, 0x68, 0x01, 0x71, 0x01, 0x7a, 0x01,
+  0x83, 0x01, 0x8c, 0x01, 0x95, 0x01, 0x9e, 0x01, 0xa7, 0x01, 0xb0, 0x01,
+  0xb9, 0x01, 0xc2, 0x01, 0xcb, 0x01, 0xd4, 0x01, 0xdd, 0x01, 0xe6, 0x01,
+  0xef, 0x01, 0xf8, 0x01, 0x01, 0x02, 0x0a, 0x02, 0x13, 0x02, 0x1c, 0x02,
+  0x25, 0x02, 0x2e, 0x02, 0x37, 0x02, 0x40, 0x02, 0x49, 0x02, 0x52, 0x02,
+  0x5b, 0x02, 0x64, 0x02, 0x6d, 0x02, 0x76, 0x02, 0x7f, 0x02, 0x88, 0x02,
+  0x91, 0x02, 0x00, 0x00, 0x1b, 0x00, 0x36, 0x00, 0x50, 0x00, 0x5a, 0x00,
+  0x64, 0x00, 0x6e, 0x00, 0x78, 0x00, 0x81, 0x00, 0x00, 0x00, 0x27, 0x00,
+  0x32, 0x00, 0x3d, 0x00, 0x48, 0x00, 0x53, 0x00, 0x5e, 0x00, 0x69, 0x00,
+  0x70, 0x00, 0x77, 0x00, 0x7e, 0x00, 0x85, 0x00, 0x8c, 0x00, 0x93, 0x00,
+  0x9e, 0x00, 0xa9, 0x00, 0xb7, 0x00, 0xc5, 0x00, 0xcc, 0x00, 0xd3, 0x00,
+  0x00, 0x00, 0x1e, 0x00, 0x3d, 0x00, 0x4f, 0x00, 0x5a, 0x00, 0x65, 0x00,
+  0x70, 0x00, 0x79, 0x00, 0x00, 0x00, 0x17, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x19, 0x00, 0x33, 0x00, 0x4a, 0x00, 0x61, 0x00, 0x6b, 0x00, 0x74, 0x00,
+  0x7c, 0x00, 0x85, 0x00, 0x00, 0x00, 0x22, 0x00, 0x42, 0x00, 0x4e, 0x00,
+  0x5a, 0x00, 0x64, 0x00, 0x6b, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00,
+  0x1a, 0x00, 0x25, 0x00, 0x30, 0x00, 0x3b, 0x00, 0x46, 0x00, 0x51, 0x00,
+  0x5c, 0x00, 0x67, 0x00, 0x72, 0x00, 0x7d, 0x00, 0x88, 0x00, 0x93, 0x00,
+  0x9e, 0x00, 0xa9, 0x00, 0xb4, 0x00, 0xbf, 0x00, 0xca, 0x00, 0xd5, 0x00,
+  0xe0, 0x00, 0xeb, 0x00, 0xf6, 0x00, 0x01, 0x01, 0x0c, 0x01, 0x17, 0x01,
+  0x22, 0x01, 0x2d, 0x01, 0x38, 0x01, 0x43, 0x01, 0x4e, 0x01, 0x59, 0x01,
+  0x64, 0x01, 0x6f, 0x01, 0x7a, 0x01, 0x85, 0x01, 0x90, 0x01, 0x9b, 0x01,
+  0xa6, 0x01, 0xb1, 0x01, 0xbc, 0x01, 0xc7, 0x01, 0xd2, 0x01, 0xdd, 0x01,
+  0xe8, 0x01, 0xf3, 0x01, 0xfe, 0x01, 0x09, 0x02, 0x14, 0x02, 0x1f, 0x02,
+  0x2a, 0x02, 0x33, 0x02, 0x46, 0x02, 0x00, 0x00, 0x1b, 0x00, 0x3a, 0x00,
+  0x53, 0x00, 0x7a, 0x00, 0x83, 0x00, 0x97, 0x00, 0xa0, 0x00, 0xa8, 0x00,
+  0x00, 0x00, 0x1f, 0x00, 0x26, 0x00, 0x32, 0x00, 0x3c, 0x00, 0x46, 0x00,
+  0x50, 0x00, 0x5a, 0x00, 0x64, 0x00, 0x6e, 0x00, 0x78, 0x00, 0x82, 0x00,
+  0x8c, 0x00, 0x96, 0x00, 0xa0, 0x00, 0xaa, 0x00, 0xb4, 0x00, 0xbe, 0x00,
+  0xc8, 0x00, 0xd2, 0x00, 0xdc, 0x00, 0xe6, 0x00, 0xf0, 0x00, 0xf7, 0x00,
+  0x00, 0x00, 0x08, 0x00, 0x10, 0x00, 0x18, 0x00, 0x20, 0x00, 0x29, 0x00,
+  0x32, 0x00, 0x3b, 0x00, 0x44, 0x00, 0x4d, 0x00, 0x56, 0x00, 0x5f, 0x00,
+  0x68, 0x00, 0x71, 0x00, 0x7a, 0x00, 0x83, 0x00, 0x8b, 0x00, 0x93, 0x00,
+  0x9b, 0x00, 0x00, 0x00, 0x09, 0x00, 0x12, 0x00, 0x1b, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x11, 0x00, 0x00, 0x00, 0x24, 0x00, 0x2e, 0x00, 0x38, 0x00,
+  0x42, 0x00, 0x4c, 0x00, 0x56, 0x00, 0x60, 0x00, 0x6a, 0x00, 0x74, 0x00,
+  0x7e, 0x00, 0x88, 0x00, 0x92, 0x00, 0x9c, 0x00, 0xa6, 0x00, 0xb0, 0x00,
+  0xba, 0x00, 0xc5, 0x00, 0xd0, 0x00, 0xdb, 0x00, 0x00, 0x00, 0x1c, 0x00,
+  0x36, 0x00, 0x4e, 0x00, 0x57, 0x00, 0x60, 0x00, 0x69, 0x00, 0x72, 0x00,
+  0x7b, 0x00, 0x84, 0x00, 0x8d, 0x00, 0x96, 0x00, 0x9f, 0x00, 0xac, 0x00,
+  0xb5, 0x00, 0xbe, 0x00, 0xc7, 0x00, 0xd0, 0x00, 0xd9, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x11, 0x00, 0x1c, 0x00, 0x27, 0x00, 0x33, 0x00, 0x3f, 0x00,
+  0x4b, 0x00, 0x57, 0x00, 0x63, 0x00, 0x6f, 0x00, 0x7b, 0x00, 0x87, 0x00,
+  0x93, 0x00, 0x9f, 0x00, 0xab, 0x00, 0xb7, 0x00, 0xc3, 0x00, 0xcf, 0x00,
+  0xdb, 0x00, 0xe7, 0x00, 0xf3, 0x00, 0xff, 0x00, 0x0b, 0x01, 0x17, 0x01,
+  0x23, 0x01, 0x2f, 0x01, 0x3b, 0x01, 0x47, 0x01, 0x53, 0x01, 0x5f, 0x01,
+  0x6b, 0x01, 0x77, 0x01, 0x83, 0x01, 0x8f, 0x01, 0x9b, 0x01, 0xa7, 0x01,
+  0xb3, 0x01, 0xbf, 0x01, 0xcb, 0x01, 0xd7, 0x01, 0xe3, 0x01, 0xef, 0x01,
+  0xfb, 0x01, 0x07, 0x02, 0x13, 0x02, 0x1f, 0x02, 0x2b, 0x02, 0x37, 0x02,
+  0x43, 0x02, 0x4f, 0x02, 0x5b, 0x02, 0x67, 0x02, 0x73, 0x02, 0x7f, 0x02,
+  0x8b, 0x02, 0x97, 0x02, 0xa3, 0x02, 0xaf, 0x02, 0xbb, 0x02, 0xc7, 0x02,
+  0xd3, 0x02, 0xdf, 0x02, 0xeb, 0x02, 0xf7, 0x02, 0x03, 0x03, 0x0f, 0x03,
+  0x1b, 0x03, 0x27, 0x03, 0x33, 0x03, 0x3f, 0x03, 0x4b, 0x03, 0x57, 0x03,
+  0x63, 0x03, 0x6f, 0x03, 0x7b, 0x03, 0x87, 0x03, 0x93, 0x03, 0x9f, 0x03,
+  0xab, 0x03, 0xb7, 0x03, 0xc3, 0x03, 0xcf, 0x03, 0xdb, 0x03, 0xe7, 0x03,
+  0xf3, 0x03, 0xff, 0x03, 0x0b, 0x04, 0x17, 0x04, 0x23, 0x04, 0x2f, 0x04,
+  0x3b, 0x04, 0x45, 0x04, 0x51, 0x04, 0x5b, 0x04, 0x65, 0x04, 0x71, 0x04,
+  0x7b, 0x04, 0x00, 0x00, 0x09, 0x00, 0x12, 0x00, 0x1b, 0x00, 0x22, 0x00,
+  0x29, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x28, 0x00, 0x00, 0x00, 0x19, 0x00,
+  0x22, 0x00, 0x2b, 0x00, 0x34, 0x00, 0x40, 0x00, 0x49, 0x00, 0x52, 0x00,
+  0x5b, 0x00, 0x64, 0x00, 0x00, 0x00, 0x15, 0x00, 0x1e, 0x00, 0x2a, 0x00,
+  0x36, 0x00, 0x00, 0x00, 0x19, 0x00, 0x2f, 0x00, 0x39, 0x00, 0x42, 0x00,
+  0x4a, 0x00, 0x56, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x14, 0x00, 0x1e, 0x00,
+  0x28, 0x00, 0x32, 0x00, 0x3c, 0x00, 0x44, 0x00, 0x4d, 0x00, 0x56, 0x00,
+  0x5f, 0x00, 0x68, 0x00, 0x71, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x32, 0x00,
+  0x3a, 0x00, 0x00, 0x00, 0x17, 0x00, 0x20, 0x00, 0x29, 0x00, 0x32, 0x00,
+  0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x17, 0x00, 0x21, 0x00, 0x2b, 0x00,
+  0x35, 0x00, 0x3f, 0x00, 0x49, 0x00, 0x53, 0x00, 0x5d, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x14, 0x00, 0x1e, 0x00, 0x27, 0x00, 0x30, 0x00, 0x00, 0x00,
+  0x19, 0x00, 0x23, 0x00, 0x2d, 0x00, 0x36, 0x00, 0x42, 0x00, 0x00, 0x00,
+  0x18, 0x00, 0x21, 0x00, 0x2a, 0x00, 0x33, 0x00, 0x3c, 0x00, 0x45, 0x00,
+  0x00, 0x00, 0x0a, 0x00, 0x11, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x0a, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x09, 0x00, 0x12, 0x00, 0x21, 0x00, 0x2a, 0x00,
+  0x33, 0x00, 0x3c, 0x00, 0x45, 0x00, 0x56, 0x00, 0x5f, 0x00, 0x68, 0x00,
+  0x71, 0x00, 0x7a, 0x00, 0x83, 0x00, 0x8c, 0x00, 0x95, 0x00, 0x9e, 0x00,
+  0xa7, 0x00, 0xb0, 0x00, 0xb9, 0x00, 0xc2, 0x00, 0xcb, 0x00, 0xd4, 0x00,
+  0xdd, 0x00, 0xe6, 0x00, 0xef, 0x00, 0xf8, 0x00, 0x01, 0x01, 0x0a, 0x01,
+  0x13, 0x01, 0x1c, 0x01, 0x25, 0x01, 0x2e, 0x01, 0x37, 0x01, 0x40, 0x01,
+  0x49, 0x01, 0x52, 0x01, 0x5b, 0x01, 0x64, 0x01, 0x6d, 0x01, 0x76, 0x01,
+  0x7f, 0x01, 0x88, 0x01, 0x91, 0x01, 0x9a, 0x01, 0xa5, 0x01, 0xaf, 0x01,
+  0xba, 0x01, 0xc3, 0x01, 0xcc, 0x01, 0xd5, 0x01, 0xde, 0x01, 0xe7, 0x01,
+  0x00, 0x00, 0x0c, 0x00, 0x16, 0x00, 0x1f, 0x00, 0x28, 0x00, 0x31, 0x00,
+  0x3e, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x14, 0x00, 0x1b, 0x00, 0x29, 0x00,
+  0x33, 0x00, 0x3d, 0x00, 0x47, 0x00, 0x00, 0x00, 0x08, 0x00, 0x13, 0x00,
+  0x1e, 0x00, 0x29, 0x00, 0x34, 0x00, 0x3f, 0x00, 0x4a, 0x00, 0x55, 0x00,
+  0x60, 0x00, 0x6b, 0x00, 0x73, 0x00, 0x7b, 0x00, 0x83, 0x00, 0x8b, 0x00,
+  0x94, 0x00, 0x9f, 0x00, 0xa8, 0x00, 0xb3, 0x00, 0xbb, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x12, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x22, 0x00,
+  0x2e, 0x00, 0x45, 0x00, 0x50, 0x00, 0x5a, 0x00, 0x64, 0x00, 0x6e, 0x00,
+  0x79, 0x00, 0x84, 0x00, 0x8f, 0x00, 0x9a, 0x00, 0xa5, 0x00, 0xae, 0x00,
+  0xb7, 0x00, 0xc0, 0x00, 0xc9, 0x00, 0xd2, 0x00, 0xdc, 0x00, 0xe6, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x12, 0x00, 0x1a, 0x00, 0x22, 0x00, 0x2a, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x14, 0x00, 0x1f, 0x00, 0x2a, 0x00, 0x35, 0x00,
+  0x40, 0x00, 0x4b, 0x00, 0x56, 0x00, 0x61, 0x00, 0x6c, 0x00, 0x77, 0x00,
+  0x80, 0x00, 0x89, 0x00, 0x00, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x17, 0x00,
+  0x21, 0x00, 0x2b, 0x00, 0x35, 0x00, 0x3d, 0x00, 0x49, 0x00, 0x55, 0x00,
+  0x00, 0x00, 0x0a, 0x00, 0x14, 0x00, 0x1e, 0x00, 0x28, 0x00, 0x32, 0x00,
+  0x3c, 0x00, 0x46, 0x00, 0x50, 0x00, 0x5a, 0x00, 0x64, 0x00, 0x6e, 0x00,
+  0x78, 0x00, 0x82, 0x00, 0x8c, 0x00, 0x96, 0x00, 0xa0, 0x00, 0xaa, 0x00,
+  0xb4, 0x00, 0xbe, 0x00, 0xc8, 0x00, 0xd2, 0x00, 0xdc, 0x00, 0xe6, 0x00,
+  0x00, 0x00, 0x13, 0x00, 0x1b, 0x00, 0x23, 0x00, 0x2c, 0x00, 0x35, 0x00,
+  0x3e, 0x00, 0x47, 0x00, 0x50, 0x00, 0x59, 0x00, 0x62, 0x00, 0x6b, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x24, 0x00, 0x2a, 0x00, 0x33, 0x00,
+  0x44, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x14, 0x00, 0x1e, 0x00, 0x28, 0x00,
+  0x32, 0x00, 0x3c, 0x00, 0x46, 0x00, 0x50, 0x00, 0x5a, 0x00, 0x64, 0x00,
+  0x6e, 0x00, 0x78, 0x00, 0x82, 0x00, 0x8c, 0x00, 0x94, 0x00, 0x9f, 0x00,
+  0xaa, 0x00, 0xb4, 0x00, 0xbe, 0x00, 0x00, 0x00, 0x11, 0x00, 0x1a, 0x00,
+  0x23, 0x00, 0x2c, 0x00, 0x35, 0x00, 0x3e, 0x00, 0x47, 0x00, 0x50, 0x00,
+  0x59, 0x00, 0x62, 0x00, 0x6b, 0x00, 0x74, 0x00, 0x7d, 0x00, 0x8f, 0x00,
+  0x98, 0x00, 0xa1, 0x00, 0x00, 0x00, 0x09, 0x00, 0x14, 0x00, 0x1f, 0x00,
+  0x2b, 0x00, 0x35, 0x00, 0x3f, 0x00, 0x49, 0x00, 0x53, 0x00, 0x5d, 0x00,
+  0x00, 0x00, 0x17, 0x00, 0x20, 0x00, 0x29, 0x00, 0x32, 0x00, 0x3b, 0x00,
+  0x44, 0x00, 0x4d, 0x00, 0x59, 0x00, 0x00, 0x00, 0x13, 0x00, 0x1d, 0x00,
+  0x27, 0x00, 0x31, 0x00, 0x3b, 0x00, 0x45, 0x00, 0x4f, 0x00, 0x59, 0x00,
+  0x63, 0x00, 0x6d, 0x00, 0x00, 0x00, 0x09, 0x00, 0x12, 0x00, 0x1b, 0x00,
+  0x24, 0x00, 0x2d, 0x00, 0x38, 0x00, 0x43, 0x00, 0x4c, 0x00, 0x56, 0x00,
+  0x5f, 0x00, 0x65, 0x00, 0x6b, 0x00, 0x00, 0x00, 0x09, 0x00, 0x12, 0x00,
+  0x1b, 0x00, 0x26, 0x00, 0x31, 0x00, 0x3c, 0x00, 0x47, 0x00, 0x52, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x12, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x0a, 0x00,
+  0x14, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1f, 0x00, 0x30, 0x00, 0x41, 0x00, 0x53, 0x00, 0x00, 0x00, 0x0a, 0x00,
+  0x14, 0x00, 0x1e, 0x00, 0x28, 0x00, 0x32, 0x00, 0x00, 0x00, 0x1d, 0x00,
+  0x26, 0x00, 0x30, 0x00, 0x3a, 0x00, 0x43, 0x00, 0x4d, 0x00, 0x00, 0x00,
+  0x16, 0x00, 0x1d, 0x00, 0x27, 0x00, 0x31, 0x00, 0x00, 0x00, 0x08, 0x00,
+  0x11, 0x00, 0x00, 0x00, 0x12, 0x00, 0x24, 0x00, 0x3d, 0x00, 0x47, 0x00,
+  0x51, 0x00, 0x5b, 0x00, 0x65, 0x00, 0x72, 0x00, 0x7c, 0x00, 0x86, 0x00,
+  0x90, 0x00, 0x9c, 0x00, 0xa8, 0x00, 0xb4, 0x00, 0xc0, 0x00, 0xcb, 0x00,
+  0xd6, 0x00, 0x00, 0x00, 0x08, 0x00, 0x10, 0x00, 0x18, 0x00, 0x20, 0x00,
+  0x29, 0x00, 0x00, 0x00, 0x08, 0x00, 0x10, 0x00, 0x19, 0x00, 0x24, 0x00,
+  0x2f, 0x00, 0x3a, 0x00, 0x45, 0x00, 0x50, 0x00, 0x5a, 0x00, 0x65, 0x00,
+  0x00, 0x00, 0x11, 0x00, 0x19, 0x00, 0x25, 0x00, 0x2f, 0x00, 0x38, 0x00,
+  0x40, 0x00, 0x49, 0x00, 0x51, 0x00, 0x5a, 0x00, 0x62, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x14, 0x00, 0x22, 0x00, 0x30, 0x00, 0x3e, 0x00, 0x4c, 0x00,
+  0x5a, 0x00, 0x68, 0x00, 0x76, 0x00, 0x00, 0x00, 0x08, 0x00, 0x10, 0x00,
+  0x18, 0x00, 0x29, 0x00, 0x34, 0x00, 0x3f, 0x00, 0x4a, 0x00, 0x55, 0x00,
+  0x60, 0x00, 0x6b, 0x00, 0x76, 0x00, 0x81, 0x00, 0x8c, 0x00, 0x97, 0x00,
+  0xa2, 0x00, 0xad, 0x00, 0xb5, 0x00, 0xbd, 0x00, 0xc5, 0x00, 0xcd, 0x00,
+  0xd9, 0x00, 0xe8, 0x00, 0xf3, 0x00, 0x02, 0x01, 0x0b, 0x01, 0x14, 0x01,
+  0x1f, 0x01, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x08, 0x00, 0x11, 0x00,
+  0x1a, 0x00, 0x23, 0x00, 0x2c, 0x00, 0x35, 0x00, 0x00, 0x00, 0x0a, 0x00,
+  0x14, 0x00, 0x1e, 0x00, 0x28, 0x00, 0x32, 0x00, 0x3c, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x18, 0x00, 0x23, 0x00, 0x2e, 0x00, 0x39, 0x00,
+  0x44, 0x00, 0x4f, 0x00, 0x5a, 0x00, 0x65, 0x00, 0x6c, 0x00, 0x75, 0x00,
+  0x7e, 0x00, 0x00, 0x00, 0x15, 0x00, 0x1e, 0x00, 0x27, 0x00, 0x30, 0x00,
+  0x39, 0x00, 0x42, 0x00, 0x4b, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x16, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x13, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x09, 0x00, 0x12, 0x00,
+  0x00, 0x00, 0x08, 0x00, 0x11, 0x00, 0x1c, 0x00, 0x27, 0x00, 0x31, 0x00,
+  0x3d, 0x00, 0x47, 0x00, 0x51, 0x00, 0x5d, 0x00, 0x67, 0x00, 0x71, 0x00,
+  0x7b, 0x00, 0x85, 0x00, 0x8f, 0x00, 0x00, 0x00, 0x17, 0x00, 0x28, 0x00,
+  0x3f, 0x00, 0x50, 0x00, 0x60, 0x00, 0x78, 0x00, 0x92, 0x00, 0x9b, 0x00,
+  0xa4, 0x00, 0xad, 0x00, 0x00, 0x00, 0x18, 0x00, 0x22, 0x00, 0x2c, 0x00,
+  0x36, 0x00, 0x40, 0x00, 0x4a, 0x00, 0x52, 0x00, 0x5a, 0x00, 0x62, 0x00,
+  0x6a, 0x00, 0x72, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x18, 0x00, 0x23, 0x00,
+  0x2d, 0x00, 0x37, 0x00, 0x41, 0x00, 0x4b, 0x00, 0x55, 0x00, 0x5f, 0x00,
+  0x69, 0x00, 0x73, 0x00, 0x7d, 0x00, 0x87, 0x00, 0x91, 0x00, 0x9b, 0x00,
+  0xa5, 0x00, 0xaf, 0x00, 0xb9, 0x00, 0xc3, 0x00, 0xcd, 0x00, 0xd7, 0x00,
+  0xe1, 0x00, 0xeb, 0x00, 0xf5, 0x00, 0xff, 0x00, 0x09, 0x01, 0x12, 0x01,
+  0x00, 0x00, 0x0c, 0x00, 0x17, 0x00, 0x22, 0x00, 0x2d, 0x00, 0x38, 0x00,
+  0x43, 0x00, 0x4e, 0x00, 0x59, 0x00, 0x64, 0x00, 0x6f, 0x00, 0x7a, 0x00,
+  0x85, 0x00, 0x90, 0x00, 0x9b, 0x00, 0xa6, 0x00, 0xb1, 0x00, 0xbc, 0x00,
+  0xc5, 0x00, 0xd1, 0x00, 0xdd, 0x00, 0xea, 0x00, 0xf6, 0x00, 0x00, 0x00,
+  0x22, 0x00, 0x00, 0x00, 0x26, 0x00, 0x45, 0x00, 0x4c, 0x00, 0x57, 0x00,
+  0x62, 0x00, 0x6d, 0x00, 0x78, 0x00, 0x83, 0x00, 0x8e, 0x00, 0x99, 0x00,
+  0xa4, 0x00, 0xaf, 0x00, 0xb6, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x26, 0x00,
+  0x30, 0x00, 0x3a, 0x00, 0x44, 0x00, 0x4e, 0x00, 0x58, 0x00, 0x62, 0x00,
+  0x6c, 0x00, 0x76, 0x00, 0x80, 0x00, 0x8a, 0x00, 0x94, 0x00, 0x9e, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x4e, 0x00, 0x59, 0x00,
+  0x64, 0x00, 0x00, 0x00, 0x21, 0x00, 0x2a, 0x00, 0x33, 0x00, 0x3c, 0x00,
+  0x45, 0x00, 0x4e, 0x00, 0x57, 0x00, 0x60, 0x00, 0x69, 0x00, 0x72, 0x00,
+  0x7b, 0x00, 0x00, 0x00, 0x09, 0x00, 0x12, 0x00, 0x1b, 0x00, 0x24, 0x00,
+  0x2d, 0x00, 0x00, 0x00, 0x09, 0x00, 0x12, 0x00, 0x1b, 0x00, 0x24, 0x00,
+  0x2d, 0x00, 0x35, 0x00, 0x3f, 0x00, 0x49, 0x00, 0x55, 0x00, 0x5d, 0x00,
+  0x66, 0x00, 0x6f, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x11, 0x00, 0x18, 0x00,
+  0x21, 0x00, 0x00, 0x00, 0x08, 0x00, 0x10, 0x00, 0x19, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x10, 0x00, 0x1c, 0x00, 0x28, 0x00, 0x34, 0x00, 0x40, 0x00,
+  0x4c, 0x00, 0x58, 0x00, 0x64, 0x00, 0x70, 0x00, 0x7c, 0x00, 0x88, 0x00,
+  0x94, 0x00, 0xa0, 0x00, 0xac, 0x00, 0x00, 0x00, 0x05, 0x00, 0x0f, 0x00,
+  0x19, 0x00, 0x23, 0x00, 0x2d, 0x00, 0x37, 0x00, 0x3f, 0x00, 0x48, 0x00,
+  0x55, 0x00, 0x62, 0x00, 0x6f, 0x00, 0x7c, 0x00, 0x89, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x17, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x14, 0x00,
+  0x1c, 0x00, 0x24, 0x00, 0x2c, 0x00, 0x34, 0x00, 0x3e, 0x00, 0x48, 0x00,
+  0x52, 0x00, 0x5c, 0x00, 0x66, 0x00, 0x70, 0x00, 0x7a, 0x00, 0x84, 0x00,
+  0x8e, 0x00, 0x98, 0x00, 0xa2, 0x00, 0xac, 0x00, 0xb6, 0x00, 0xc0, 0x00,
+  0xca, 0x00, 0xd4, 0x00, 0xde, 0x00, 0xe8, 0x00, 0xf2, 0x00, 0xfc, 0x00,
+  0x0b, 0x01, 0x13, 0x01, 0x1b, 0x01, 0x23, 0x01, 0x00, 0x00, 0x09, 0x00,
+  0x12, 0x00, 0x1d, 0x00, 0x28, 0x00, 0x33, 0x00, 0x3e, 0x00, 0x49, 0x00,
+  0x54, 0x00, 0x5f, 0x00, 0x6a, 0x00, 0x75, 0x00, 0x80, 0x00, 0x8b, 0x00,
+  0x96, 0x00, 0xa1, 0x00, 0xac, 0x00, 0xb7, 0x00, 0xc2, 0x00, 0xcd, 0x00,
+  0xd8, 0x00, 0xe3, 0x00, 0xee, 0x00, 0xf9, 0x00, 0x04, 0x01, 0x0f, 0x01,
+  0x1a, 0x01, 0x25, 0x01, 0x30, 0x01, 0x3b, 0x01, 0x46, 0x01, 0x51, 0x01,
+  0x00, 0x00, 0x08, 0x00, 0x10, 0x00, 0x18, 0x00, 0x20, 0x00, 0x28, 0x00,
+  0x2f, 0x00, 0x36, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x13, 0x00, 0x1f, 0x00,
+  0x2a, 0x00, 0x35, 0x00, 0x40, 0x00, 0x47, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x12, 0x00, 0x1c, 0x00, 0x26, 0x00, 0x30, 0x00, 0x3a, 0x00, 0x44, 0x00,
+  0x4e, 0x00, 0x58, 0x00, 0x62, 0x00, 0x6c, 0x00, 0x76, 0x00, 0x80, 0x00,
+  0x8a, 0x00, 0x94, 0x00, 0x9e, 0x00, 0xa8, 0x00, 0xb2, 0x00, 0xbc, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x27, 0x00, 0x35, 0x00,
+  0x00, 0x00, 0x1c, 0x00, 0x27, 0x00, 0x32, 0x00, 0x3d, 0x00, 0x44, 0x00,
+  0x4b, 0x00, 0x00, 0x00, 0x20, 0x00, 0x29, 0x00, 0x00, 0x00, 0x1f, 0x00,
+  0x25, 0x00, 0x00, 0x00, 0x20, 0x00, 0x29, 0x00, 0x32, 0x00, 0x3c, 0x00,
+  0x46, 0x00, 0x50, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x18, 0x00, 0x24, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x29, 0x00, 0x32, 0x00, 0x3c, 0x00,
+  0x44, 0x00, 0x4c, 0x00, 0x54, 0x00, 0x5c, 0x00, 0x64, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x33, 0x00, 0x3e, 0x00, 0x49, 0x00,
+  0x54, 0x00, 0x5f, 0x00, 0x6a, 0x00, 0x75, 0x00, 0x80, 0x00, 0x8b, 0x00,
+  0x96, 0x00, 0xa1, 0x00, 0xac, 0x00, 0xb7, 0x00, 0xc2, 0x00, 0xcb, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x18, 0x00, 0x24, 0x00, 0x30, 0x00, 0x3c, 0x00,
+  0x48, 0x00, 0x54, 0x00, 0x60, 0x00, 0x6c, 0x00, 0x78, 0x00, 0x84, 0x00,
+  0x90, 0x00, 0x9c, 0x00, 0xa8, 0x00, 0xb4, 0x00, 0xc0, 0x00, 0xcc, 0x00,
+  0xd8, 0x00, 0xe4, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0x08, 0x01, 0x14, 0x01,
+  0x20, 0x01, 0x2c, 0x01, 0x38, 0x01, 0x44, 0x01, 0x50, 0x01, 0x5c, 0x01,
+  0x68, 0x01, 0x74, 0x01, 0x80, 0x01, 0x8c, 0x01, 0x98, 0x01, 0xa4, 0x01,
+  0xb0, 0x01, 0xbc, 0x01, 0xc8, 0x01, 0xd4, 0x01, 0xe0, 0x01, 0xec, 0x01,
+  0xf8, 0x01, 0x04, 0x02, 0x10, 0x02, 0x1c, 0x02, 0x28, 0x02, 0x34, 0x02,
+  0x40, 0x02, 0x4c, 0x02, 0x58, 0x02, 0x64, 0x02, 0x70, 0x02, 0x7c, 0x02,
+  0x88, 0x02, 0x94, 0x02, 0xa0, 0x02, 0xac, 0x02, 0xb8, 0x02, 0xc4, 0x02,
+  0xd0, 0x02, 0xdc, 0x02, 0xe8, 0x02, 0xf4, 0x02, 0x00, 0x03, 0x0c, 0x03,
+  0x18, 0x03, 0x24, 0x03, 0x30, 0x03, 0x3c, 0x03, 0x48, 0x03, 0x54, 0x03,
+  0x00, 0x00, 0x11, 0x00, 0x19, 0x00, 0x21, 0x00, 0x29, 0x00, 0x31, 0x00,
+  0x3c, 0x00, 0x00, 0x00, 0x09, 0x00, 0x12, 0x00, 0x1a, 0x00, 0x22, 0x00,
+  0x2c, 0x00, 0x00, 0x00, 0x09, 0x00, 0x11, 0x00, 0x19, 0x00, 0x20, 0x00,
+  0x27, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x07, 0x00, 0x11, 0x00, 0x1b, 0x00,
+  0x25, 0x00, 0x2f, 0x00, 0x39, 0x00, 0x43, 0x00, 0x4d, 0x00, 0x57, 0x00,
+  0x61, 0x00, 0x6b, 0x00, 0x75, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x13, 0x00,
+  0x1b, 0x00, 0x23, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x09, 0x00, 0x12, 0x00,
+  0x1b, 0x00, 0x24, 0x00, 0x2d, 0x00, 0x36, 0x00, 0x3f, 0x00, 0x48, 0x00,
+  0x51, 0x00, 0x5a, 0x00, 0x6e, 0x00, 0x77, 0x00, 0x80, 0x00, 0x89, 0x00,
+  0x92, 0x00, 0x9b, 0x00, 0xa4, 0x00, 0xad, 0x00, 0xb6, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x12, 0x00, 0x1b, 0x00, 0x24, 0x00, 0x2a, 0x00, 0x33, 0x00,
+  0x00, 0x00, 0x26, 0x00, 0x2f, 0x00, 0x38, 0x00, 0x41, 0x00, 0x4a, 0x00,
+  0x53, 0x00, 0x5c, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x77, 0x00, 0x80, 0x00,
+  0x89, 0x00, 0x92, 0x00, 0x9b, 0x00, 0x00, 0x00, 0x27, 0x00, 0x30, 0x00,
+  0x39, 0x00, 0x42, 0x00, 0x4b, 0x00, 0x54, 0x00, 0x5d, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x17, 0x00, 0x23, 0x00, 0x2c, 0x00, 0x35, 0x00, 0x3e, 0x00,
+  0x47, 0x00, 0x50, 0x00, 0x59, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x18, 0x00,
+  0x1f, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x16, 0x00, 0x1f, 0x00,
+  0x29, 0x00, 0x33, 0x00, 0x3d, 0x00, 0x47, 0x00, 0x51, 0x00, 0x5b, 0x00,
+  0x65, 0x00, 0x6f, 0x00, 0x79, 0x00, 0x83, 0x00, 0x8d, 0x00, 0x97, 0x00,
+  0xa1, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x18, 0x00, 0x21, 0x00,
+  0x2f, 0x00, 0x3d, 0x00, 0x4b, 0x00, 0x59, 0x00, 0x67, 0x00, 0x75, 0x00,
+  0x83, 0x00, 0x91, 0x00, 0x9f, 0x00, 0xad, 0x00, 0xbb, 0x00, 0xc9, 0x00,
+  0xd7, 0x00, 0xe5, 0x00, 0xf3, 0x00, 0x00, 0x00, 0x08, 0x00, 0x11, 0x00,
+  0x1a, 0x00, 0x23, 0x00, 0x2c, 0x00, 0x35, 0x00, 0x00, 0x00, 0x14, 0x00,
+  0x1e, 0x00, 0x27, 0x00, 0x33, 0x00, 0x3a, 0x00, 0x41, 0x00, 0x48, 0x00,
+  0x4f, 0x00, 0x5a, 0x00, 0x65, 0x00, 0x70, 0x00, 0x7b, 0x00, 0x86, 0x00,
+  0x91, 0x00, 0x9c, 0x00, 0xa7, 0x00, 0xb2, 0x00, 0xbd, 0x00, 0xc8, 0x00,
+  0xd3, 0x00, 0xde, 0x00, 0xe9, 0x00, 0xf4, 0x00, 0xff, 0x00, 0x0a, 0x01,
+  0x15, 0x01, 0x20, 0x01, 0x2b, 0x01, 0x36, 0x01, 0x41, 0x01, 0x4c, 0x01,
+  0x57, 0x01, 0x00, 0x00, 0x0a, 0x00, 0x16, 0x00, 0x22, 0x00, 0x2e, 0x00,
+  0x3a, 0x00, 0x46, 0x00, 0x52, 0x00, 0x5e, 0x00, 0x6a, 0x00, 0x76, 0x00,
+  0x82, 0x00, 0x8e, 0x00, 0x9a, 0x00, 0xa6, 0x00, 0xb2, 0x00, 0xbe, 0x00,
+  0xca, 0x00, 0xd6, 0x00, 0xe2, 0x00, 0xee, 0x00, 0xfa, 0x00, 0x06, 0x01,
+  0x12, 0x01, 0x1e, 0x01, 0x2a, 0x01, 0x36, 0x01, 0x42, 0x01, 0x4e, 0x01,
+  0x5a, 0x01, 0x66, 0x01, 0x72, 0x01, 0x7e, 0x01, 0x8a, 0x01, 0x96, 0x01,
+  0x00, 0x00, 0x0b, 0x00, 0x16, 0x00, 0x21, 0x00, 0x2d, 0x00, 0x39, 0x00,
+  0x45, 0x00, 0x51, 0x00, 0x5d, 0x00, 0x69, 0x00, 0x75, 0x00, 0x81, 0x00,
+  0x8d, 0x00, 0x99, 0x00, 0xa5, 0x00, 0xb1, 0x00, 0xbd, 0x00, 0xc9, 0x00,
+  0xd5, 0x00, 0xe1, 0x00, 0xed, 0x00, 0xf9, 0x00, 0x05, 0x01, 0x11, 0x01,
+  0x1d, 0x01, 0x29, 0x01, 0x35, 0x01, 0x41, 0x01, 0x4d, 0x01, 0x59, 0x01,
+  0x65, 0x01, 0x71, 0x01, 0x7d, 0x01, 0x89, 0x01, 0x95, 0x01, 0xa1, 0x01,
+  0xad, 0x01, 0xb9, 0x01, 0xc5, 0x01, 0xd1, 0x01, 0xdd, 0x01, 0xe9, 0x01,
+  0xf5, 0x01, 0x01, 0x02, 0x0d, 0x02, 0x19, 0x02, 0x25, 0x02, 0x31, 0x02,
+  0x3d, 0x02, 0x49, 0x02, 0x55, 0x02, 0x61, 0x02, 0x6d, 0x02, 0x79, 0x02,
+  0x85, 0x02, 0x91, 0x02, 0x9d, 0x02, 0xa9, 0x02, 0xb5, 0x02, 0xc1, 0x02,
+  0xcd, 0x02, 0xd9, 0x02, 0xe5, 0x02, 0xf1, 0x02, 0xfd, 0x02, 0x09, 0x03,
+  0x14, 0x03, 0x1f, 0x03, 0x2a, 0x03, 0x35, 0x03, 0x40, 0x03, 0x4b, 0x03,
+  0x56, 0x03, 0x61, 0x03, 0x6c, 0x03, 0x77, 0x03, 0x82, 0x03, 0x8d, 0x03,
+  0x98, 0x03, 0x00, 0x00, 0x09, 0x00, 0x12, 0x00, 0x00, 0x00, 0x0a, 0x00,
+  0x13, 0x00, 0x1c, 0x00, 0x25, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x14, 0x00,
+  0x00, 0x00, 0x1c, 0x00, 0x27, 0x00, 0x32, 0x00, 0x3d, 0x00, 0x48, 0x00,
+  0x54, 0x00, 0x60, 0x00, 0x6c, 0x00, 0x78, 0x00, 0x84, 0x00, 0x90, 0x00,
+  0x9c, 0x00, 0xa8, 0x00, 0xb4, 0x00, 0xc0, 0x00, 0xcc, 0x00, 0xd8, 0x00,
+  0xe4, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0x08, 0x01, 0x14, 0x01, 0x20, 0x01,
+  0x2c, 0x01, 0x38, 0x01, 0x44, 0x01, 0x50, 0x01, 0x5c, 0x01, 0x68, 0x01,
+  0x74, 0x01, 0x80, 0x01, 0x8c, 0x01, 0x98, 0x01, 0xa4, 0x01, 0xb0, 0x01,
+  0xbc, 0x01, 0xc8, 0x01, 0xd4, 0x01, 0xe0, 0x01, 0xeb, 0x01, 0xf3, 0x01,
+  0xfe, 0x01, 0x09, 0x02, 0x00, 0x00, 0x09, 0x00, 0x12, 0x00, 0x1b, 0x00,
+  0x24, 0x00, 0x2d, 0x00, 0x36, 0x00, 0x3f, 0x00, 0x48, 0x00, 0x54, 0x00,
+  0x60, 0x00, 0x69, 0x00, 0x72, 0x00, 0x7b, 0x00, 0x84, 0x00, 0x8d, 0x00,
+  0x96, 0x00, 0x9f, 0x00, 0xa8, 0x00, 0xb1, 0x00, 0xba, 0x00, 0xc3, 0x00,
+  0xcc, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x2b, 0x00, 0x34, 0x00, 0x3d, 0x00,
+  0x46, 0x00, 0x00, 0x00, 0x09, 0x00, 0x12, 0x00, 0x1b, 0x00, 0x24, 0x00,
+  0x2d, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x13, 0x00, 0x1c, 0x00, 0x25, 0x00, 0x00, 0x00, 0x11, 0x00,
+  0x19, 0x00, 0x24, 0x00, 0x2e, 0x00, 0x38, 0x00, 0x42, 0x00, 0x4c, 0x00,
+  0x59, 0x00, 0x66, 0x00, 0x70, 0x00, 0x7a, 0x00, 0x84, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x15, 0x00, 0x1e, 0x00, 0x27, 0x00, 0x00, 0x00, 0x0a, 0x00,
+  0x23, 0x00, 0x2e, 0x00, 0x39, 0x00, 0x44, 0x00, 0x4f, 0x00, 0x5a, 0x00,
+  0x65, 0x00, 0x70, 0x00, 0x7b, 0x00, 0x86, 0x00, 0x91, 0x00, 0x9c, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x18, 0x00, 0x24, 0x00, 0x30, 0x00, 0x3c, 0x00,
+  0x48, 0x00, 0x54, 0x00, 0x60, 0x00, 0x6c, 0x00, 0x78, 0x00, 0x84, 0x00,
+  0x90, 0x00, 0x9c, 0x00, 0xa8, 0x00, 0xb4, 0x00, 0xc0, 0x00, 0xcc, 0x00,
+  0xd8, 0x00, 0xe4, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0x08, 0x01, 0x14, 0x01,
+  0x20, 0x01, 0x2c, 0x01, 0x38, 0x01, 0x44, 0x01, 0x50, 0x01, 0x5c, 0x01,
+  0x68, 0x01, 0x6f, 0x01, 0x76, 0x01, 0x00, 0x00, 0x2b, 0x00, 0x34, 0x00,
+  0x3d, 0x00, 0x47, 0x00, 0x51, 0x00, 0x00, 0x00, 0x14, 0x00, 0x1e, 0x00,
+  0x28, 0x00, 0x32, 0x00, 0x3c, 0x00, 0x45, 0x00, 0x4e, 0x00, 0x57, 0x00,
+  0x60, 0x00, 0x69, 0x00, 0x72, 0x00, 0x7b, 0x00, 0x8c, 0x00, 0x95, 0x00,
+  0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x36, 0x00, 0x41, 0x00,
+  0x4d, 0x00, 0x59, 0x00, 0x65, 0x00, 0x71, 0x00, 0x7d, 0x00, 0x89, 0x00,
+  0x95, 0x00, 0xa1, 0x00, 0xac, 0x00, 0x00, 0x00, 0x19, 0x00, 0x25, 0x00,
+  0x31, 0x00, 0x3d, 0x00, 0x47, 0x00, 0x51, 0x00, 0x5d, 0x00, 0x68, 0x00,
+  0x00, 0x00, 0x24, 0x00, 0x2e, 0x00, 0x35, 0x00, 0x3e, 0x00, 0x47, 0x00,
+  0x50, 0x00, 0x00, 0x00, 0x09, 0x00, 0x12, 0x00, 0x1b, 0x00, 0x24, 0x00,
+  0x2d, 0x00, 0x36, 0x00, 0x3f, 0x00, 0x48, 0x00, 0x51, 0x00, 0x5a, 0x00,
+  0x63, 0x00, 0x6c, 0x00, 0x75, 0x00, 0x7e, 0x00, 0x88, 0x00, 0x91, 0x00,
+  0x9a, 0x00, 0xa3, 0x00, 0xac, 0x00, 0xb5, 0x00, 0x00, 0x00, 0x07, 0x00,
+  0x10, 0x00, 0x19, 0x00, 0x22, 0x00, 0x2b, 0x00, 0x34, 0x00, 0x3d, 0x00,
+  0x46, 0x00, 0x4f, 0x00, 0x58, 0x00, 0x63, 0x00, 0x6e, 0x00, 0x79, 0x00,
+  0x80, 0x00, 0x89, 0x00, 0x92, 0x00, 0xa3, 0x00, 0xae, 0x00, 0xb9, 0x00,
+  0xc4, 0x00, 0xcf, 0x00, 0xda, 0x00, 0xe5, 0x00, 0xf0, 0x00, 0xfb, 0x00,
+  0x06, 0x01, 0x11, 0x01, 0x1c, 0x01, 0x27, 0x01, 0x32, 0x01, 0x3d, 0x01,
+  0x48, 0x01, 0x53, 0x01, 0x5e, 0x01, 0x67, 0x01, 0x70, 0x01, 0x79, 0x01,
+  0x82, 0x01, 0x8b, 0x01, 0x92, 0x01, 0x00, 0x00, 0x0b, 0x00, 0x17, 0x00,
+  0x23, 0x00, 0x2f, 0x00, 0x39, 0x00, 0x45, 0x00, 0x51, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x12, 0x00, 0x19, 0x00, 0x23, 0x00, 0x2d, 0x00, 0x37, 0x00,
+  0x41, 0x00, 0x4d, 0x00, 0x56, 0x00, 0x5f, 0x00, 0x68, 0x00, 0x71, 0x00,
+  0x7a, 0x00, 0x83, 0x00, 0x8c, 0x00, 0x95, 0x00, 0x9e, 0x00, 0xa7, 0x00,
+  0xb0, 0x00, 0xb9, 0x00, 0xc2, 0x00, 0xcb, 0x00, 0xd4, 0x00, 0xdd, 0x00,
+  0xe6, 0x00, 0xef, 0x00, 0xf8, 0x00, 0x01, 0x01, 0x0a, 0x01, 0x14, 0x01,
+  0x00, 0x00, 0x27, 0x00, 0x3b, 0x00, 0x47, 0x00, 0x50, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x10, 0x00, 0x19, 0x00, 0x22, 0x00, 0x2c, 0x00, 0x35, 0x00,
+  0x3e, 0x00, 0x47, 0x00, 0x50, 0x00, 0x59, 0x00, 0x62, 0x00, 0x6d, 0x00,
+  0x78, 0x00, 0x7f, 0x00, 0x86, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x15, 0x00,
+  0x1e, 0x00, 0x27, 0x00, 0x30, 0x00, 0x39, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x12, 0x00, 0x1e, 0x00, 0x2a, 0x00, 0x36, 0x00, 0x40, 0x00, 0x4a, 0x00,
+  0x54, 0x00, 0x5e, 0x00, 0x6a, 0x00, 0x76, 0x00, 0x82, 0x00, 0x00, 0x00,
+  0x1a, 0x00, 0x23, 0x00, 0x2e, 0x00, 0x39, 0x00, 0x44, 0x00, 0x4f, 0x00,
+  0x5a, 0x00, 0x65, 0x00, 0x70, 0x00, 0x7b, 0x00, 0x86, 0x00, 0x91, 0x00,
+  0x9c, 0x00, 0xa7, 0x00, 0xb2, 0x00, 0xbd, 0x00, 0xc8, 0x00, 0xd3, 0x00,
+  0xe0, 0x00, 0xed, 0x00, 0xfa, 0x00, 0x07, 0x01, 0x14, 0x01, 0x00, 0x00,
+  0x0b, 0x00, 0x16, 0x00, 0x21, 0x00, 0x2c, 0x00, 0x37, 0x00, 0x42, 0x00,
+  0x4d, 0x00, 0x59, 0x00, 0x65, 0x00, 0x71, 0x00, 0x7d, 0x00, 0x89, 0x00,
+  0x95, 0x00, 0xa1, 0x00, 0xad, 0x00, 0xb9, 0x00, 0xc5, 0x00, 0xd1, 0x00,
+  0xdd, 0x00, 0xe9, 0x00, 0xf5, 0x00, 0x01, 0x01, 0x0d, 0x01, 0x19, 0x01,
+  0x25, 0x01, 0x31, 0x01, 0x3a, 0x01, 0x00, 0x00, 0x21, 0x00, 0x2a, 0x00,
+  0x33, 0x00, 0x3c, 0x00, 0x45, 0x00, 0x4e, 0x00, 0x57, 0x00, 0x60, 0x00,
+  0x69, 0x00, 0x78, 0x00, 0x85, 0x00, 0x8e, 0x00, 0x97, 0x00, 0x9d, 0x00,
+  0xa7, 0x00, 0x00, 0x00, 0x20, 0x00, 0x29, 0x00, 0x33, 0x00, 0x3d, 0x00,
+  0x47, 0x00, 0x52, 0x00, 0x5d, 0x00, 0x68, 0x00, 0x73, 0x00, 0x7e, 0x00,
+  0x89, 0x00, 0x94, 0x00, 0x9f, 0x00, 0xaa, 0x00, 0xb5, 0x00, 0xc0, 0x00,
+  0xcb, 0x00, 0xd6, 0x00, 0xe1, 0x00, 0xec, 0x00, 0xf7, 0x00, 0x02, 0x01,
+  0x0d, 0x01, 0x18, 0x01, 0x23, 0x01, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x14, 0x00, 0x20, 0x00, 0x2c, 0x00, 0x38, 0x00, 0x44, 0x00,
+  0x50, 0x00, 0x5c, 0x00, 0x68, 0x00, 0x74, 0x00, 0x80, 0x00, 0x8c, 0x00,
+  0x98, 0x00, 0xa4, 0x00, 0xb0, 0x00, 0xbc, 0x00, 0xc7, 0x00, 0xd2, 0x00,
+  0xdd, 0x00, 0xe4, 0x00, 0xeb, 0x00, 0xf2, 0x00, 0xf9, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x12, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x16, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x12, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x0a, 0x00,
+  0x11, 0x00, 0x1a, 0x00, 0x23, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x18, 0x00, 0x23, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x24, 0x00, 0x2f, 0x00,
+  0x3a, 0x00, 0x43, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x15, 0x00, 0x21, 0x00,
+  0x2d, 0x00, 0x39, 0x00, 0x45, 0x00, 0x51, 0x00, 0x5d, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x18, 0x00, 0x24, 0x00, 0x30, 0x00, 0x3e, 0x00, 0x48, 0x00,
+  0x52, 0x00, 0x5c, 0x00, 0x66, 0x00, 0x70, 0x00, 0x7a, 0x00, 0x84, 0x00,
+  0x91, 0x00, 0xa1, 0x00, 0xab, 0x00, 0xb5, 0x00, 0xbf, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x1b, 0x00, 0x24, 0x00, 0x2d, 0x00, 0x36, 0x00, 0x42, 0x00,
+  0x4e, 0x00, 0x5a, 0x00, 0x66, 0x00, 0x72, 0x00, 0x7b, 0x00, 0x85, 0x00,
+  0x8f, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x14, 0x00, 0x1f, 0x00, 0x2a, 0x00,
+  0x35, 0x00, 0x40, 0x00, 0x4b, 0x00, 0x56, 0x00, 0x61, 0x00, 0x6c, 0x00,
+  0x77, 0x00, 0x80, 0x00, 0x8b, 0x00, 0x96, 0x00, 0xa1, 0x00, 0xac, 0x00,
+  0xbc, 0x00, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x18, 0x00,
+  0x24, 0x00, 0x30, 0x00, 0x3c, 0x00, 0x48, 0x00, 0x54, 0x00, 0x60, 0x00,
+  0x6c, 0x00, 0x78, 0x00, 0x84, 0x00, 0x90, 0x00, 0x9c, 0x00, 0xa8, 0x00,
+  0xb4, 0x00, 0xbb, 0x00, 0xc2, 0x00, 0xc9, 0x00, 0x00, 0x00, 0x18, 0x00,
+  0x21, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x14, 0x00, 0x1e, 0x00,
+  0x28, 0x00, 0x32, 0x00, 0x3c, 0x00, 0x46, 0x00, 0x4f, 0x00, 0x5a, 0x00,
+  0x65, 0x00, 0x00, 0x00, 0x07, 0x00, 0x11, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x18, 0x00, 0x24, 0x00, 0x30, 0x00, 0x3c, 0x00, 0x48, 0x00, 0x53, 0x00,
+  0x69, 0x00, 0x00, 0x00, 0x06, 0x00, 0x10, 0x00, 0x1a, 0x00, 0x24, 0x00,
+  0x2d, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x14, 0x00, 0x1e, 0x00, 0x00, 0x00,
+  0x16, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x07, 0x00, 0x10, 0x00, 0x1a, 0x00,
+  0x24, 0x00, 0x2e, 0x00, 0x39, 0x00, 0x44, 0x00, 0x4f, 0x00, 0x5a, 0x00,
+  0x63, 0x00, 0x6c, 0x00, 0x75, 0x00, 0x7e, 0x00, 0x87, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x14, 0x00, 0x21, 0x00, 0x2b, 0x00, 0x35, 0x00, 0x3f, 0x00,
+  0x49, 0x00, 0x53, 0x00, 0x5c, 0x00, 0x67, 0x00, 0x72, 0x00, 0x7d, 0x00,
+  0x88, 0x00, 0x93, 0x00, 0x9e, 0x00, 0xa9, 0x00, 0xb4, 0x00, 0xbe, 0x00,
+  0xc9, 0x00, 0xd4, 0x00, 0xdf, 0x00, 0xeb, 0x00, 0xf4, 0x00, 0xfd, 0x00,
+  0x06, 0x01, 0x0f, 0x01, 0x18, 0x01, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x10, 0x00, 0x18, 0x00, 0x1f, 0x00, 0x28, 0x00, 0x2e, 0x00,
+  0x34, 0x00, 0x3b, 0x00, 0x42, 0x00, 0x49, 0x00, 0x55, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x18, 0x00, 0x24, 0x00, 0x37, 0x00, 0x49, 0x00, 0x56, 0x00,
+  0x00, 0x00, 0x0a, 0x00, 0x14, 0x00, 0x1e, 0x00, 0x2a, 0x00, 0x36, 0x00,
+  0x43, 0x00, 0x50, 0x00, 0x5d, 0x00, 0x69, 0x00, 0x74, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x10, 0x00, 0x19, 0x00, 0x24, 0x00, 0x2f, 0x00, 0x3a, 0x00,
+  0x45, 0x00, 0x50, 0x00, 0x5b, 0x00, 0x66, 0x00, 0x71, 0x00, 0x7c, 0x00,
+  0x87, 0x00, 0x92, 0x00, 0x9d, 0x00, 0xa8, 0x00, 0xb3, 0x00, 0xbe, 0x00,
+  0xc9, 0x00, 0xd4, 0x00, 0xdd, 0x00, 0xeb, 0x00, 0xf4, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x15, 0x00, 0x1f, 0x00, 0x26, 0x00, 0x32, 0x00, 0x3e, 0x00,
+  0x4a, 0x00, 0x56, 0x00, 0x62, 0x00, 0x6e, 0x00, 0x7a, 0x00, 0x86, 0x00,
+  0x92, 0x00, 0x9e, 0x00, 0xaa, 0x00, 0xb6, 0x00, 0xc2, 0x00, 0xce, 0x00,
+  0xda, 0x00, 0xe6, 0x00, 0xf2, 0x00, 0xfe, 0x00, 0x0a, 0x01, 0x16, 0x01,
+  0x22, 0x01, 0x2e, 0x01, 0x3a, 0x01, 0x46, 0x01, 0x52, 0x01, 0x59, 0x01,
+  0x00, 0x00, 0x09, 0x00, 0x12, 0x00, 0x21, 0x00, 0x2a, 0x00, 0x33, 0x00,
+  0x3c, 0x00, 0x45, 0x00, 0x00, 0x00, 0x11, 0x00, 0x1b, 0x00, 0x25, 0x00,
+  0x2f, 0x00, 0x39, 0x00, 0x44, 0x00, 0x4f, 0x00, 0x58, 0x00, 0x61, 0x00,
+  0x6a, 0x00, 0x73, 0x00, 0x7d, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x1a, 0x00,
+  0x23, 0x00, 0x2c, 0x00, 0x35, 0x00, 0x3e, 0x00, 0x47, 0x00, 0x50, 0x00,
+  0x59, 0x00, 0x62, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x18, 0x00, 0x24, 0x00,
+  0x30, 0x00, 0x3c, 0x00, 0x48, 0x00, 0x54, 0x00, 0x60, 0x00, 0x6c, 0x00,
+  0x78, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x05, 0x00, 0x0f, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x1f, 0x00, 0x29, 0x00, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x14, 0x00, 0x1d, 0x00, 0x26, 0x00, 0x2f, 0x00, 0x38, 0x00,
+  0x43, 0x00, 0x4c, 0x00, 0x55, 0x00, 0x5e, 0x00, 0x67, 0x00, 0x70, 0x00,
+  0x79, 0x00, 0x82, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x2b, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x1b, 0x00, 0x26, 0x00, 0x31, 0x00, 0x3e, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x11, 0x00, 0x1b, 0x00, 0x25, 0x00, 0x2f, 0x00, 0x39, 0x00,
+  0x43, 0x00, 0x4d, 0x00, 0x57, 0x00, 0x65, 0x00, 0x73, 0x00, 0x81, 0x00,
+  0x8f, 0x00, 0x9d, 0x00, 0xab, 0x00, 0xb9, 0x00, 0xc7, 0x00, 0xd0, 0x00,
+  0xd9, 0x00, 0xe2, 0x00, 0x00, 0x00, 0x11, 0x00, 0x1c, 0x00, 0x26, 0x00,
+  0x30, 0x00, 0x3a, 0x00, 0x43, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x05, 0x00,
+  0x0d, 0x00, 0x15, 0x00, 0x20, 0x00, 0x29, 0x00, 0x00, 0x00, 0x1a, 0x00,
+  0x23, 0x00, 0x2d, 0x00, 0x37, 0x00, 0x41, 0x00, 0x4b, 0x00, 0x58, 0x00,
+  0x65, 0x00, 0x72, 0x00, 0x00, 0x00, 0x07, 0x00, 0x12, 0x00, 0x1d, 0x00,
+  0x2a, 0x00, 0x35, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x14, 0x00, 0x1e, 0x00,
+  0x28, 0x00, 0x32, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x16, 0x00, 0x1d, 0x00,
+  0x2c, 0x00, 0x3b, 0x00, 0x4a, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00,
+  0x21, 0x00, 0x39, 0x00, 0x41, 0x00, 0x47, 0x00, 0x51, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x17, 0x00, 0x23, 0x00, 0x2f, 0x00, 0x3b, 0x00, 0x47, 0x00,
+  0x53, 0x00, 0x5f, 0x00, 0x6b, 0x00, 0x77, 0x00, 0x83, 0x00, 0x8f, 0x00,
+  0x9b, 0x00, 0xa7, 0x00, 0xb3, 0x00, 0xbf, 0x00, 0xcb, 0x00, 0xd7, 0x00,
+  0xe3, 0x00, 0xef, 0x00, 0xfb, 0x00, 0x07, 0x01, 0x13, 0x01, 0x1f, 0x01,
+  0x2b, 0x01, 0x37, 0x01, 0x43, 0x01, 0x4f, 0x01, 0x5b, 0x01, 0x67, 0x01,
+  0x73, 0x01, 0x7f, 0x01, 0x8b, 0x01, 0x00, 0x00, 0x1d, 0x00, 0x29, 0x00,
+  0x35, 0x00, 0x41, 0x00, 0x4d, 0x00, 0x59, 0x00, 0x65, 0x00, 0x71, 0x00,
+  0x7d, 0x00, 0x89, 0x00, 0x95, 0x00, 0x9d, 0x00, 0xa5, 0x00, 0x00, 0x00,
+  0x17, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x23, 0x00, 0x31, 0x00, 0x39, 0x00,
+  0x42, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x33, 0x00, 0x3c, 0x00, 0x45, 0x00,
+  0x4e, 0x00, 0x58, 0x00, 0x61, 0x00, 0x6d, 0x00, 0x00, 0x00, 0x15, 0x00,
+  0x1b, 0x00, 0x00, 0x00, 0x28, 0x00, 0x2e, 0x00, 0x35, 0x00, 0x3c, 0x00,
+  0x46, 0x00, 0x50, 0x00, 0x5c, 0x00, 0x68, 0x00, 0x74, 0x00, 0x80, 0x00,
+  0x8c, 0x00, 0x98, 0x00, 0xa4, 0x00, 0xb0, 0x00, 0xbc, 0x00, 0xc8, 0x00,
+  0xcf, 0x00, 0x00, 0x00, 0x16, 0x00, 0x21, 0x00, 0x2c, 0x00, 0x37, 0x00,
+  0x42, 0x00, 0x4b, 0x00, 0x54, 0x00, 0x61, 0x00, 0x6e, 0x00, 0x7b, 0x00,
+  0x88, 0x00, 0x95, 0x00, 0xa3, 0x00, 0x00, 0x00, 0x18, 0x00, 0x20, 0x00,
+  0x27, 0x00, 0x30, 0x00, 0x3c, 0x00, 0x45, 0x00, 0x4e, 0x00, 0x57, 0x00,
+  0x60, 0x00, 0x69, 0x00, 0x72, 0x00, 0x7b, 0x00, 0x84, 0x00, 0x8d, 0x00,
+  0x00, 0x00, 0x0b, 0x00, 0x18, 0x00, 0x27, 0x00, 0x00, 0x00, 0x07, 0x00,
+  0x15, 0x00, 0x1f, 0x00, 0x2e, 0x00, 0x3d, 0x00, 0x48, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x13, 0x00, 0x00, 0x00, 0x07, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x18, 0x00, 0x25, 0x00, 0x32, 0x00, 0x3f, 0x00, 0x4c, 0x00,
+  0x59, 0x00, 0x66, 0x00, 0x73, 0x00, 0x7f, 0x00, 0x8c, 0x00, 0x99, 0x00,
+  0xa6, 0x00, 0xb0, 0x00, 0xba, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x16, 0x00,
+  0x24, 0x00, 0x32, 0x00, 0x40, 0x00, 0x4e, 0x00, 0x5c, 0x00, 0x6a, 0x00,
+  0x78, 0x00, 0x86, 0x00, 0x94, 0x00, 0xa2, 0x00, 0xb0, 0x00, 0xbe, 0x00,
+  0xcc, 0x00, 0xda, 0x00, 0xe8, 0x00, 0xf6, 0x00, 0x04, 0x01, 0x12, 0x01,
+  0x20, 0x01, 0x29, 0x01, 0x33, 0x01, 0x3d, 0x01, 0x47, 0x01, 0x00, 0x00,
+  0x08, 0x00, 0x10, 0x00, 0x17, 0x00, 0x1f, 0x00, 0x30, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x16, 0x00, 0x21, 0x00, 0x2c, 0x00, 0x37, 0x00, 0x42, 0x00,
+  0x51, 0x00, 0x60, 0x00, 0x6f, 0x00, 0x7a, 0x00, 0x89, 0x00, 0x98, 0x00,
+  0xa7, 0x00, 0xb6, 0x00, 0xc5, 0x00, 0xd4, 0x00, 0xe3, 0x00, 0x00, 0x00,
+  0x19, 0x00, 0x29, 0x00, 0x42, 0x00, 0x59, 0x00, 0x6c, 0x00, 0x7e, 0x00,
+  0x87, 0x00, 0x90, 0x00, 0x99, 0x00, 0xa5, 0x00, 0xb1, 0x00, 0xbd, 0x00,
+  0xc9, 0x00, 0xd6, 0x00, 0xe3, 0x00, 0xf0, 0x00, 0xfd, 0x00, 0x0a, 0x01,
+  0x17, 0x01, 0x24, 0x01, 0x31, 0x01, 0x3e, 0x01, 0x4b, 0x01, 0x58, 0x01,
+  0x65, 0x01, 0x72, 0x01, 0x7f, 0x01, 0x8c, 0x01, 0x99, 0x01, 0xa1, 0x01,
+  0xac, 0x01, 0xb8, 0x01, 0x00, 0x00, 0x0d, 0x00, 0x1a, 0x00, 0x24, 0x00,
+  0x00, 0x00, 0x08, 0x00, 0x19, 0x00, 0x27, 0x00, 0x35, 0x00, 0x43, 0x00,
+  0x51, 0x00, 0x5f, 0x00, 0x68, 0x00, 0x70, 0x00, 0x79, 0x00, 0x82, 0x00,
+  0x8b, 0x00, 0x00, 0x00, 0x09, 0x00, 0x13, 0x00, 0x1d, 0x00, 0x26, 0x00,
+  0x2f, 0x00, 0x38, 0x00, 0x41, 0x00, 0x4b, 0x00, 0x55, 0x00, 0x5f, 0x00,
+  0x69, 0x00, 0x73, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x18, 0x00, 0x21, 0x00,
+  0x00, 0x00, 0x07, 0x00, 0x12, 0x00, 0x1d, 0x00, 0x28, 0x00, 0x33, 0x00,
+  0x3e, 0x00, 0x49, 0x00, 0x54, 0x00, 0x5f, 0x00, 0x6a, 0x00, 0x75, 0x00,
+  0x80, 0x00, 0x8b, 0x00, 0x96, 0x00, 0xa1, 0x00, 0xac, 0x00, 0xb7, 0x00,
+  0xc2, 0x00, 0xcd, 0x00, 0xd8, 0x00, 0xe3, 0x00, 0xee, 0x00, 0xf9, 0x00,
+  0x04, 0x01, 0x0f, 0x01, 0x1a, 0x01, 0x25, 0x01, 0x30, 0x01, 0x3b, 0x01,
+  0x46, 0x01, 0x51, 0x01, 0x5c, 0x01, 0x67, 0x01, 0x72, 0x01, 0x7d, 0x01,
+  0x88, 0x01, 0x93, 0x01, 0x9e, 0x01, 0xa9, 0x01, 0xb4, 0x01, 0xbf, 0x01,
+  0xca, 0x01, 0xd3, 0x01, 0xdc, 0x01, 0xe5, 0x01, 0xee, 0x01, 0xf7, 0x01,
+  0x00, 0x02, 0x09, 0x02, 0x00, 0x00, 0x0b, 0x00, 0x16, 0x00, 0x1f, 0x00,
+  0x28, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x18, 0x00, 0x24, 0x00, 0x30, 0x00,
+  0x3c, 0x00, 0x48, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x07, 0x00,
+  0x16, 0x00, 0x25, 0x00, 0x30, 0x00, 0x39, 0x00, 0x42, 0x00, 0x4b, 0x00,
+  0x54, 0x00, 0x5d, 0x00, 0x66, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x0a, 0x00,
+  0x13, 0x00, 0x21, 0x00, 0x2a, 0x00, 0x33, 0x00, 0x3d, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x12, 0x00, 0x1e, 0x00, 0x2a, 0x00, 0x36, 0x00, 0x42, 0x00,
+  0x4e, 0x00, 0x5a, 0x00, 0x6b, 0x00, 0x78, 0x00, 0x85, 0x00, 0x92, 0x00,
+  0x9f, 0x00, 0xa7, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x11, 0x00, 0x1e, 0x00,
+  0x00, 0x00, 0x07, 0x00, 0x15, 0x00, 0x23, 0x00, 0x2b, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x18, 0x00, 0x24, 0x00, 0x30, 0x00, 0x38, 0x00, 0x40, 0x00,
+  0x00, 0x00, 0x07, 0x00, 0x10, 0x00, 0x19, 0x00, 0x22, 0x00, 0x2b, 0x00,
+  0x34, 0x00, 0x3d, 0x00, 0x46, 0x00, 0x4f, 0x00, 0x58, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x12, 0x00, 0x1c, 0x00, 0x26, 0x00, 0x30, 0x00, 0x3a, 0x00,
+  0x42, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00,
+  0x10, 0x00, 0x1c, 0x00, 0x28, 0x00, 0x34, 0x00, 0x40, 0x00, 0x4c, 0x00,
+  0x58, 0x00, 0x64, 0x00, 0x70, 0x00, 0x7c, 0x00, 0x88, 0x00, 0x94, 0x00,
+  0xa0, 0x00, 0xac, 0x00, 0xb8, 0x00, 0xbf, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x16, 0x00, 0x20, 0x00, 0x2a, 0x00, 0x34, 0x00, 0x3e, 0x00, 0x48, 0x00,
+  0x52, 0x00, 0x5c, 0x00, 0x66, 0x00, 0x6f, 0x00, 0x78, 0x00, 0x81, 0x00,
+  0x8a, 0x00, 0x93, 0x00, 0x00, 0x00, 0x09, 0x00, 0x15, 0x00, 0x1e, 0x00,
+  0x27, 0x00, 0x30, 0x00, 0x39, 0x00, 0x42, 0x00, 0x4b, 0x00, 0x54, 0x00,
+  0x5d, 0x00, 0x66, 0x00, 0x6f, 0x00, 0x78, 0x00, 0x81, 0x00, 0x8a, 0x00,
+  0x93, 0x00, 0x9c, 0x00, 0xa5, 0x00, 0xae, 0x00, 0xb7, 0x00, 0xc0, 0x00,
+  0xc9, 0x00, 0xd2, 0x00, 0xdb, 0x00, 0xe4, 0x00, 0xed, 0x00, 0xf6, 0x00,
+  0xff, 0x00, 0x08, 0x01, 0x11, 0x01, 0x1a, 0x01, 0x23, 0x01, 0x2c, 0x01,
+  0x35, 0x01, 0x3e, 0x01, 0x47, 0x01, 0x50, 0x01, 0x59, 0x01, 0x62, 0x01,
+  0x6b, 0x01, 0x74, 0x01, 0x7d, 0x01, 0x86, 0x01, 0x8f, 0x01, 0x98, 0x01,
+  0xa1, 0x01, 0xaa, 0x01, 0xb3, 0x01, 0xbc, 0x01, 0xc5, 0x01, 0xce, 0x01,
+  0x00, 0x00, 0x1c, 0x00, 0x25, 0x00, 0x00, 0x00, 0x09, 0x00, 0x10, 0x00,
+  0x17, 0x00, 0x1e, 0x00, 0x25, 0x00, 0x2c, 0x00, 0x33, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x12, 0x00, 0x1b, 0x00, 0x24, 0x00, 0x31, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x12, 0x00, 0x1b, 0x00, 0x24, 0x00, 0x2d, 0x00, 0x36, 0x00,
+  0x3f, 0x00, 0x48, 0x00, 0x51, 0x00, 0x5a, 0x00, 0x63, 0x00, 0x6c, 0x00,
+  0x75, 0x00, 0x7e, 0x00, 0x87, 0x00, 0x90, 0x00, 0x99, 0x00, 0xa2, 0x00,
+  0xab, 0x00, 0xb5, 0x00, 0xbe, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x18, 0x00,
+  0x24, 0x00, 0x30, 0x00, 0x3a, 0x00, 0x47, 0x00, 0x51, 0x00, 0x5e, 0x00,
+  0x68, 0x00, 0x72, 0x00, 0x7c, 0x00, 0x86, 0x00, 0x90, 0x00, 0x9a, 0x00,
+  0xa4, 0x00, 0xae, 0x00, 0xbb, 0x00, 0xc5, 0x00, 0xd2, 0x00, 0xdc, 0x00,
+  0xe4, 0x00, 0xec, 0x00, 0xf4, 0x00, 0xff, 0x00, 0x00, 0x00, 0x23, 0x00,
+  0x32, 0x00, 0x3c, 0x00, 0x46, 0x00, 0x51, 0x00, 0x5f, 0x00, 0x6a, 0x00,
+  0x75, 0x00, 0x83, 0x00, 0x8e, 0x00, 0x99, 0x00, 0xa4, 0x00, 0xaf, 0x00,
+  0xbd, 0x00, 0xc8, 0x00, 0xd3, 0x00, 0xde, 0x00, 0xe9, 0x00, 0xf1, 0x00,
+  0xf8, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x15, 0x00, 0x1f, 0x00, 0x28, 0x00,
+  0x30, 0x00, 0x3e, 0x00, 0x46, 0x00, 0x50, 0x00, 0x5b, 0x00, 0x63, 0x00,
+  0x6d, 0x00, 0x77, 0x00, 0x81, 0x00, 0x8b, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x18, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x35, 0x00, 0x3e, 0x00, 0x47, 0x00,
+  0x50, 0x00, 0x59, 0x00, 0x62, 0x00, 0x6d, 0x00, 0x78, 0x00, 0x83, 0x00,
+  0x8e, 0x00, 0x99, 0x00, 0xa4, 0x00, 0xaf, 0x00, 0xba, 0x00, 0xc5, 0x00,
+  0xd0, 0x00, 0xdb, 0x00, 0xe6, 0x00, 0xf1, 0x00, 0xfc, 0x00, 0x07, 0x01,
+  0x12, 0x01, 0x1d, 0x01, 0x28, 0x01, 0x33, 0x01, 0x3e, 0x01, 0x49, 0x01,
+  0x54, 0x01, 0x5f, 0x01, 0x6a, 0x01, 0x75, 0x01, 0x80, 0x01, 0x8b, 0x01,
+  0x96, 0x01, 0xa1, 0x01, 0xac, 0x01, 0xb7, 0x01, 0xc2, 0x01, 0xcd, 0x01,
+  0xd8, 0x01, 0xe3, 0x01, 0xee, 0x01, 0xf9, 0x01, 0x04, 0x02, 0x0f, 0x02,
+  0x1a, 0x02, 0x25, 0x02, 0x30, 0x02, 0x3b, 0x02, 0x46, 0x02, 0x51, 0x02,
+  0x5c, 0x02, 0x67, 0x02, 0x72, 0x02, 0x7d, 0x02, 0x88, 0x02, 0x93, 0x02,
+  0x9e, 0x02, 0xa9, 0x02, 0xb4, 0x02, 0xbf, 0x02, 0xca, 0x02, 0xd5, 0x02,
+  0xe0, 0x02, 0xed, 0x02, 0xfa, 0x02, 0x07, 0x03, 0x14, 0x03, 0x21, 0x03,
+  0x2e, 0x03, 0x3b, 0x03, 0x48, 0x03, 0x55, 0x03, 0x62, 0x03, 0x6f, 0x03,
+  0x7c, 0x03, 0x89, 0x03, 0x96, 0x03, 0xa3, 0x03, 0xb0, 0x03, 0xbd, 0x03,
+  0xca, 0x03, 0xd7, 0x03, 0xe4, 0x03, 0xf1, 0x03, 0xfe, 0x03, 0x0b, 0x04,
+  0x18, 0x04, 0x25, 0x04, 0x32, 0x04, 0x3f, 0x04, 0x4c, 0x04, 0x59, 0x04,
+  0x66, 0x04, 0x73, 0x04, 0x80, 0x04, 0x88, 0x04, 0x97, 0x04, 0xa3, 0x04,
+  0xaf, 0x04, 0xbb, 0x04, 0xc7, 0x04, 0xd2, 0x04, 0xda, 0x04, 0xe2, 0x04,
+  0xea, 0x04, 0xf2, 0x04, 0x00, 0x00, 0x1f, 0x00, 0x31, 0x00, 0x3d, 0x00,
+  0x4a, 0x00, 0x51, 0x00, 0x5e, 0x00, 0x6b, 0x00, 0x78, 0x00, 0x85, 0x00,
+  0x8f, 0x00, 0x99, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x34, 0x00, 0x3d, 0x00,
+  0x45, 0x00, 0x4d, 0x00, 0x56, 0x00, 0x5f, 0x00, 0x68, 0x00, 0x71, 0x00,
+  0x00, 0x00, 0x1d, 0x00, 0x33, 0x00, 0x3d, 0x00, 0x49, 0x00, 0x55, 0x00,
+  0x5f, 0x00, 0x69, 0x00, 0x73, 0x00, 0x7d, 0x00, 0x87, 0x00, 0x91, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x22, 0x00, 0x2b, 0x00, 0x34, 0x00, 0x3d, 0x00,
+  0x46, 0x00, 0x4f, 0x00, 0x58, 0x00, 0x61, 0x00, 0x6a, 0x00, 0x73, 0x00,
+  0x7c, 0x00, 0x00, 0x00, 0x09, 0x00, 0x12, 0x00, 0x1b, 0x00, 0x24, 0x00,
+  0x38, 0x00, 0x41, 0x00, 0x00, 0x00, 0x20, 0x00, 0x2b, 0x00, 0x36, 0x00,
+  0x41, 0x00, 0x4c, 0x00, 0x57, 0x00, 0x62, 0x00, 0x6d, 0x00, 0x78, 0x00,
+  0x83, 0x00, 0x8e, 0x00, 0x99, 0x00, 0xa4, 0x00, 0xaf, 0x00, 0xba, 0x00,
+  0xc5, 0x00, 0xd0, 0x00, 0xdb, 0x00, 0xe6, 0x00, 0xf1, 0x00, 0xfc, 0x00,
+  0x07, 0x01, 0x12, 0x01, 0x1d, 0x01, 0x28, 0x01, 0x33, 0x01, 0x3e, 0x01,
+  0x49, 0x01, 0x54, 0x01, 0x5d, 0x01, 0x00, 0x00, 0x12, 0x00, 0x24, 0x00,
+  0x30, 0x00, 0x3c, 0x00, 0x48, 0x00, 0x54, 0x00, 0x60, 0x00, 0x6c, 0x00,
+  0x78, 0x00, 0x84, 0x00, 0x90, 0x00, 0x9c, 0x00, 0xa8, 0x00, 0xb4, 0x00,
+  0xc0, 0x00, 0xcc, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x23, 0x00, 0x2c, 0x00,
+  0x35, 0x00, 0x3e, 0x00, 0x49, 0x00, 0x52, 0x00, 0x5b, 0x00, 0x66, 0x00,
+  0x70, 0x00, 0x7a, 0x00, 0x84, 0x00, 0x8f, 0x00, 0x9a, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x15, 0x00, 0x1e, 0x00,
+  0x27, 0x00, 0x30, 0x00, 0x39, 0x00, 0x42, 0x00, 0x4b, 0x00, 0x54, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x18, 0x00, 0x24, 0x00, 0x30, 0x00, 0x3c, 0x00,
+  0x48, 0x00, 0x54, 0x00, 0x5d, 0x00, 0x65, 0x00, 0x6d, 0x00, 0x79, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x1a, 0x00, 0x27, 0x00, 0x34, 0x00, 0x41, 0x00,
+  0x00, 0x00, 0x1a, 0x00, 0x23, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x19, 0x00,
+  0x2b, 0x00, 0x00, 0x00, 0x09, 0x00, 0x15, 0x00, 0x21, 0x00, 0x2d, 0x00,
+  0x39, 0x00, 0x45, 0x00, 0x51, 0x00, 0x5d, 0x00, 0x69, 0x00, 0x75, 0x00,
+  0x81, 0x00, 0x8d, 0x00, 0x99, 0x00, 0xa5, 0x00, 0xb1, 0x00, 0xbd, 0x00,
+  0xc5, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x08, 0x00, 0x13, 0x00,
+  0x1e, 0x00, 0x2a, 0x00, 0x36, 0x00, 0x41, 0x00, 0x4a, 0x00, 0x54, 0x00,
+  0x5e, 0x00, 0x67, 0x00, 0x6f, 0x00, 0x79, 0x00, 0x82, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x0b, 0x00,
+  0x13, 0x00, 0x1b, 0x00, 0x23, 0x00, 0x2b, 0x00, 0x36, 0x00, 0x41, 0x00,
+  0x4c, 0x00, 0x57, 0x00, 0x64, 0x00, 0x6d, 0x00, 0x76, 0x00, 0x7f, 0x00,
+  0x88, 0x00, 0x91, 0x00, 0x9a, 0x00, 0x00, 0x00, 0x08, 0x00, 0x10, 0x00,
+  0x19, 0x00, 0x22, 0x00, 0x2b, 0x00, 0x34, 0x00, 0x47, 0x00, 0x50, 0x00,
+  0x59, 0x00, 0x62, 0x00, 0x6b, 0x00, 0x74, 0x00, 0x7d, 0x00, 0x86, 0x00,
+  0x8f, 0x00, 0x98, 0x00, 0xa1, 0x00, 0xaa, 0x00, 0xb3, 0x00, 0xbc, 0x00,
+  0xc5, 0x00, 0xce, 0x00, 0xd7, 0x00, 0xe0, 0x00, 0xe9, 0x00, 0xf2, 0x00,
+  0xfb, 0x00, 0x04, 0x01, 0x0d, 0x01, 0x16, 0x01, 0x1f, 0x01, 0x28, 0x01,
+  0x31, 0x01, 0x3a, 0x01, 0x43, 0x01, 0x4c, 0x01, 0x55, 0x01, 0x5e, 0x01,
+  0x00, 0x00, 0x0a, 0x00, 0x14, 0x00, 0x1e, 0x00, 0x28, 0x00, 0x32, 0x00,
+  0x3c, 0x00, 0x46, 0x00, 0x50, 0x00, 0x5a, 0x00, 0x64, 0x00, 0x6e, 0x00,
+  0x78, 0x00, 0x82, 0x00, 0x8b, 0x00, 0x94, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x1c, 0x00, 0x28, 0x00, 0x32, 0x00, 0x00, 0x00, 0x09, 0x00, 0x15, 0x00,
+  0x21, 0x00, 0x2d, 0x00, 0x39, 0x00, 0x41, 0x00, 0x49, 0x00, 0x51, 0x00,
+  0x59, 0x00, 0x61, 0x00, 0x6a, 0x00, 0x73, 0x00, 0x00, 0x00, 0x0a, 0x00,
+  0x15, 0x00, 0x1e, 0x00, 0x27, 0x00, 0x30, 0x00, 0x39, 0x00, 0x42, 0x00,
+  0x4b, 0x00, 0x00, 0x00, 0x09, 0x00, 0x13, 0x00, 0x1d, 0x00, 0x27, 0x00,
+  0x31, 0x00, 0x3b, 0x00, 0x45, 0x00, 0x4f, 0x00, 0x59, 0x00, 0x63, 0x00,
+  0x6b, 0x00, 0x73, 0x00, 0x7c, 0x00, 0x85, 0x00, 0x8d, 0x00, 0x95, 0x00,
+  0x00, 0x00, 0x0a, 0x00, 0x16, 0x00, 0x00, 0x00, 0x09, 0x00, 0x13, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x19, 0x00, 0x21, 0x00,
+  0x29, 0x00, 0x34, 0x00, 0x3f, 0x00, 0x4a, 0x00, 0x55, 0x00, 0x60, 0x00,
+  0x6b, 0x00, 0x76, 0x00, 0x81, 0x00, 0x8c, 0x00, 0x97, 0x00, 0xa2, 0x00,
+  0xad, 0x00, 0xb8, 0x00, 0xc3, 0x00, 0xcb, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x18, 0x00, 0x24, 0x00, 0x30, 0x00, 0x3a, 0x00, 0x44, 0x00, 0x4e, 0x00,
+  0x00, 0x00, 0x0f, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x1c, 0x00,
+  0x27, 0x00, 0x33, 0x00, 0x3f, 0x00, 0x4b, 0x00, 0x57, 0x00, 0x63, 0x00,
+  0x6f, 0x00, 0x79, 0x00, 0x83, 0x00, 0x00, 0x00, 0x09, 0x00, 0x12, 0x00,
+  0x1b, 0x00, 0x24, 0x00, 0x2d, 0x00, 0x36, 0x00, 0x3f, 0x00, 0x48, 0x00,
+  0x51, 0x00, 0x5a, 0x00, 0x63, 0x00, 0x6c, 0x00, 0x75, 0x00, 0x7e, 0x00,
+  0x87, 0x00, 0x90, 0x00, 0x9c, 0x00, 0xae, 0x00, 0xb7, 0x00, 0xc0, 0x00,
+  0xc9, 0x00, 0x00, 0x00, 0x09, 0x00, 0x12, 0x00, 0x00, 0x00, 0x1e, 0x00,
+  0x29, 0x00, 0x34, 0x00, 0x3f, 0x00, 0x4a, 0x00, 0x55, 0x00, 0x60, 0x00,
+  0x6b, 0x00, 0x76, 0x00, 0x81, 0x00, 0x8c, 0x00, 0x97, 0x00, 0xa2, 0x00,
+  0xad, 0x00, 0xb8, 0x00, 0xc3, 0x00, 0xce, 0x00, 0xd9, 0x00, 0xe4, 0x00,
+  0xef, 0x00, 0xfa, 0x00, 0x05, 0x01, 0x10, 0x01, 0x1b, 0x01, 0x26, 0x01,
+  0x31, 0x01, 0x3c, 0x01, 0x47, 0x01, 0x52, 0x01, 0x5d, 0x01, 0x68, 0x01,
+  0x73, 0x01, 0x7e, 0x01, 0x89, 0x01, 0x94, 0x01, 0x9f, 0x01, 0xaa, 0x01,
+  0xb5, 0x01, 0xc0, 0x01, 0xcb, 0x01, 0xd6, 0x01, 0xe1, 0x01, 0xec, 0x01,
+  0xf7, 0x01, 0x02, 0x02, 0x0d, 0x02, 0x18, 0x02, 0x23, 0x02, 0x2e, 0x02,
+  0x39, 0x02, 0x44, 0x02, 0x4f, 0x02, 0x5a, 0x02, 0x65, 0x02, 0x70, 0x02,
+  0x7b, 0x02, 0x86, 0x02, 0x91, 0x02, 0x9c, 0x02, 0xa5, 0x02, 0xae, 0x02,
+  0xb7, 0x02, 0xc2, 0x02, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x14, 0x00,
+  0x26, 0x00, 0x2f, 0x00, 0x38, 0x00, 0x43, 0x00, 0x4e, 0x00, 0x58, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x19, 0x00, 0x24, 0x00, 0x2f, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x09, 0x00, 0x0f, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x12, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x16, 0x00, 0x2d, 0x00,
+  0x3f, 0x00, 0x49, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x16, 0x00, 0x21, 0x00,
+  0x2c, 0x00, 0x37, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x18, 0x00, 0x24, 0x00,
+  0x30, 0x00, 0x3c, 0x00, 0x48, 0x00, 0x54, 0x00, 0x60, 0x00, 0x6c, 0x00,
+  0x78, 0x00, 0x84, 0x00, 0x90, 0x00, 0x9c, 0x00, 0xa8, 0x00, 0xb4, 0x00,
+  0xc0, 0x00, 0xcc, 0x00, 0xd8, 0x00, 0xe4, 0x00, 0xf0, 0x00, 0xfc, 0x00,
+  0x08, 0x01, 0x14, 0x01, 0x20, 0x01, 0x2c, 0x01, 0x38, 0x01, 0x44, 0x01,
+  0x00, 0x00, 0x0a, 0x00, 0x13, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x0a, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x12, 0x00, 0x1d, 0x00, 0x29, 0x00, 0x34, 0x00,
+  0x3f, 0x00, 0x49, 0x00, 0x53, 0x00, 0x5d, 0x00, 0x67, 0x00, 0x70, 0x00,
+  0x7a, 0x00, 0x84, 0x00, 0x8e, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x27, 0x00,
+  0x33, 0x00, 0x00, 0x00, 0x09, 0x00, 0x12, 0x00, 0x1b, 0x00, 0x24, 0x00,
+  0x2c, 0x00, 0x34, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x09, 0x00, 0x13, 0x00,
+  0x1d, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x15, 0x00, 0x1d, 0x00, 0x25, 0x00,
+  0x2d, 0x00, 0x00, 0x00, 0x08, 0x00, 0x10, 0x00, 0x19, 0x00, 0x22, 0x00,
+  0x2b, 0x00, 0x39, 0x00, 0x47, 0x00, 0x55, 0x00, 0x61, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x1e, 0x00, 0x27, 0x00, 0x31, 0x00, 0x3b, 0x00, 0x45, 0x00,
+  0x4f, 0x00, 0x59, 0x00, 0x63, 0x00, 0x6d, 0x00, 0x77, 0x00, 0x81, 0x00,
+  0x8b, 0x00, 0x98, 0x00, 0xa5, 0x00, 0xad, 0x00, 0xbc, 0x00, 0xcb, 0x00,
+  0xda, 0x00, 0x00, 0x00, 0x06, 0x00, 0x15, 0x00, 0x1e, 0x00, 0x2a, 0x00,
+  0x35, 0x00, 0x00, 0x00, 0x08, 0x00, 0x10, 0x00, 0x18, 0x00, 0x23, 0x00,
+  0x2e, 0x00, 0x39, 0x00, 0x41, 0x00, 0x49, 0x00, 0x51, 0x00, 0x59, 0x00,
+  0x61, 0x00, 0x69, 0x00, 0x71, 0x00, 0x7b, 0x00, 0x87, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x12, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x34, 0x00, 0x3e, 0x00,
+  0x48, 0x00, 0x52, 0x00, 0x5c, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x7a, 0x00,
+  0x89, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x18, 0x00, 0x23, 0x00, 0x2e, 0x00,
+  0x39, 0x00, 0x44, 0x00, 0x4d, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x18, 0x00, 0x24, 0x00, 0x30, 0x00, 0x3c, 0x00, 0x48, 0x00,
+  0x54, 0x00, 0x60, 0x00, 0x6c, 0x00, 0x78, 0x00, 0x84, 0x00, 0x90, 0x00,
+  0x9c, 0x00, 0xa8, 0x00, 0xb4, 0x00, 0xbb, 0x00, 0x00, 0x00, 0x14, 0x00,
+  0x23, 0x00, 0x2b, 0x00, 0x40, 0x00, 0x49, 0x00, 0x52, 0x00, 0x5b, 0x00,
+  0x64, 0x00, 0x6d, 0x00, 0x76, 0x00, 0x00, 0x00, 0x17, 0x00, 0x24, 0x00,
+  0x30, 0x00, 0x3b, 0x00, 0x45, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x1a, 0x00, 0x23, 0x00, 0x2c, 0x00, 0x34, 0x00, 0x3c, 0x00,
+  0x44, 0x00, 0x00, 0x00, 0x14, 0x00, 0x20, 0x00, 0x2a, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x1e, 0x00, 0x28, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x1a, 0x00,
+  0x28, 0x00, 0x32, 0x00, 0x3c, 0x00, 0x46, 0x00, 0x50, 0x00, 0x5a, 0x00,
+  0x64, 0x00, 0x6d, 0x00, 0x76, 0x00, 0x7f, 0x00, 0x88, 0x00, 0x91, 0x00,
+  0x9a, 0x00, 0xa3, 0x00, 0xac, 0x00, 0xb5, 0x00, 0xbe, 0x00, 0x00, 0x00,
+  0x16, 0x00, 0x27, 0x00, 0x35, 0x00, 0x3e, 0x00, 0x47, 0x00, 0x50, 0x00,
+  0x59, 0x00, 0x62, 0x00, 0x6b, 0x00, 0x73, 0x00, 0x7e, 0x00, 0x89, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x13, 0x00, 0x26, 0x00, 0x30, 0x00, 0x3a, 0x00,
+  0x44, 0x00, 0x4e, 0x00, 0x58, 0x00, 0x62, 0x00, 0x6c, 0x00, 0x75, 0x00,
+  0x7e, 0x00, 0x00, 0x00, 0x13, 0x00, 0x28, 0x00, 0x33, 0x00, 0x3e, 0x00,
+  0x49, 0x00, 0x54, 0x00, 0x5f, 0x00, 0x6a, 0x00, 0x75, 0x00, 0x80, 0x00,
+  0x8b, 0x00, 0x92, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x13, 0x00, 0x1e, 0x00, 0x26, 0x00, 0x00, 0x00, 0x1b, 0x00,
+  0x24, 0x00, 0x2e, 0x00, 0x38, 0x00, 0x42, 0x00, 0x4c, 0x00, 0x56, 0x00,
+  0x60, 0x00, 0x6a, 0x00, 0x73, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x13, 0x00,
+  0x1e, 0x00, 0x29, 0x00, 0x34, 0x00, 0x3f, 0x00, 0x4a, 0x00, 0x55, 0x00,
+  0x5c, 0x00, 0x64, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x12, 0x00,
+  0x1c, 0x00, 0x26, 0x00, 0x2e, 0x00, 0x39, 0x00, 0x41, 0x00, 0x4c, 0x00,
+  0x57, 0x00, 0x5f, 0x00, 0x6a, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x16, 0x00,
+  0x21, 0x00, 0x2c, 0x00, 0x37, 0x00, 0x40, 0x00, 0x49, 0x00, 0x52, 0x00,
+  0x5b, 0x00, 0x64, 0x00, 0x6d, 0x00, 0x76, 0x00, 0x7f, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x1b, 0x00, 0x24, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x15, 0x00, 0x1e, 0x00, 0x27, 0x00, 0x30, 0x00, 0x39, 0x00, 0x42, 0x00,
+  0x4b, 0x00, 0x54, 0x00, 0x5d, 0x00, 0x66, 0x00, 0x6f, 0x00, 0x78, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x27, 0x00, 0x33, 0x00, 0x3f, 0x00, 0x48, 0x00,
+  0x51, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x15, 0x00, 0x1e, 0x00, 0x27, 0x00,
+  0x36, 0x00, 0x3e, 0x00, 0x46, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x21, 0x00,
+  0x2b, 0x00, 0x37, 0x00, 0x43, 0x00, 0x4f, 0x00, 0x5b, 0x00, 0x67, 0x00,
+  0x00, 0x00, 0x0a, 0x00, 0x12, 0x00, 0x1a, 0x00, 0x22, 0x00, 0x2a, 0x00,
+  0x32, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x14, 0x00, 0x1c, 0x00, 0x28, 0x00,
+  0x34, 0x00, 0x40, 0x00, 0x4c, 0x00, 0x58, 0x00, 0x64, 0x00, 0x70, 0x00,
+  0x00, 0x00, 0x18, 0x00, 0x2e, 0x00, 0x40, 0x00, 0x4a, 0x00, 0x54, 0x00,
+  0x5e, 0x00, 0x68, 0x00, 0x72, 0x00, 0x7c, 0x00, 0x86, 0x00, 0x90, 0x00,
+  0x9a, 0x00, 0xa4, 0x00, 0xad, 0x00, 0xb6, 0x00, 0xbf, 0x00, 0x00, 0x00,
+  0x1d, 0x00, 0x2a, 0x00, 0x45, 0x00, 0x4e, 0x00, 0x57, 0x00, 0x5e, 0x00,
+  0x69, 0x00, 0x74, 0x00, 0x7f, 0x00, 0x8a, 0x00, 0x95, 0x00, 0xa0, 0x00,
+  0xab, 0x00, 0xb6, 0x00, 0xc1, 0x00, 0xcc, 0x00, 0xd7, 0x00, 0xe2, 0x00,
+  0xed, 0x00, 0xf8, 0x00, 0x03, 0x01, 0x0e, 0x01, 0x19, 0x01, 0x28, 0x01,
+  0x37, 0x01, 0x00, 0x00, 0x12, 0x00, 0x1f, 0x00, 0x27, 0x00, 0x2f, 0x00,
+  0x38, 0x00, 0x40, 0x00, 0x48, 0x00, 0x50, 0x00, 0x58, 0x00, 0x60, 0x00,
+  0x68, 0x00, 0x70, 0x00, 0x78, 0x00, 0x82, 0x00, 0x8c, 0x00, 0x96, 0x00,
+  0xa6, 0x00, 0x00, 0x00, 0x08, 0x00, 0x14, 0x00, 0x20, 0x00, 0x2b, 0x00,
+  0x36, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x18, 0x00, 0x25, 0x00, 0x2d, 0x00,
+  0x37, 0x00, 0x41, 0x00, 0x4b, 0x00, 0x55, 0x00, 0x5f, 0x00, 0x69, 0x00,
+  0x73, 0x00, 0x7d, 0x00, 0x87, 0x00, 0x8e, 0x00, 0x00, 0x00, 0x0a, 0x00,
+  0x16, 0x00, 0x22, 0x00, 0x30, 0x00, 0x3e, 0x00, 0x4c, 0x00, 0x5a, 0x00,
+  0x68, 0x00, 0x76, 0x00, 0x84, 0x00, 0x92, 0x00, 0xa0, 0x00, 0xae, 0x00,
+  0xbc, 0x00, 0xca, 0x00, 0xd8, 0x00, 0xe1, 0x00, 0xec, 0x00, 0xf7, 0x00,
+  0x02, 0x01, 0x0d, 0x01, 0x18, 0x01, 0x23, 0x01, 0x2e, 0x01, 0x39, 0x01,
+  0x44, 0x01, 0x4f, 0x01, 0x5a, 0x01, 0x66, 0x01, 0x6d, 0x01, 0x74, 0x01,
+  0x00, 0x00, 0x17, 0x00, 0x2b, 0x00, 0x34, 0x00, 0x43, 0x00, 0x52, 0x00,
+  0x61, 0x00, 0x70, 0x00, 0x7f, 0x00, 0x8e, 0x00, 0x00, 0x00, 0x18, 0x00,
+  0x24, 0x00, 0x30, 0x00, 0x3b, 0x00, 0x46, 0x00, 0x4e, 0x00, 0x00, 0x00,
+  0x15, 0x00, 0x21, 0x00, 0x2f, 0x00, 0x38, 0x00, 0x41, 0x00, 0x4a, 0x00,
+  0x53, 0x00, 0x5c, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x77, 0x00, 0x80, 0x00,
+  0x89, 0x00, 0x92, 0x00, 0x9b, 0x00, 0xa4, 0x00, 0xad, 0x00, 0xb6, 0x00,
+  0xbf, 0x00, 0xc8, 0x00, 0xd1, 0x00, 0xda, 0x00, 0xe3, 0x00, 0xec, 0x00,
+  0xf5, 0x00, 0xfe, 0x00, 0x07, 0x01, 0x10, 0x01, 0x19, 0x01, 0x22, 0x01,
+  0x2b, 0x01, 0x34, 0x01, 0x3d, 0x01, 0x46, 0x01, 0x4f, 0x01, 0x58, 0x01,
+  0x61, 0x01, 0x6a, 0x01, 0x73, 0x01, 0x7c, 0x01, 0x85, 0x01, 0x8e, 0x01,
+  0x97, 0x01, 0xa0, 0x01, 0xa9, 0x01, 0xb2, 0x01, 0xbb, 0x01, 0xc4, 0x01,
+  0xcd, 0x01, 0xd9, 0x01, 0xe5, 0x01, 0xf1, 0x01, 0x04, 0x02, 0x17, 0x02,
+  0x00, 0x00, 0x0c, 0x00, 0x19, 0x00, 0x26, 0x00, 0x35, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x18, 0x00, 0x27, 0x00, 0x36, 0x00, 0x45, 0x00, 0x54, 0x00,
+  0x63, 0x00, 0x71, 0x00, 0x80, 0x00, 0x8f, 0x00, 0x9e, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x1b, 0x00, 0x24, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x1c, 0x00,
+  0x28, 0x00, 0x00, 0x00, 0x15, 0x00, 0x21, 0x00, 0x2a, 0x00, 0x33, 0x00,
+  0x3c, 0x00, 0x45, 0x00, 0x4e, 0x00, 0x57, 0x00, 0x60, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x1a, 0x00, 0x2d, 0x00, 0x4f, 0x00, 0x5a, 0x00, 0x63, 0x00,
+  0x6c, 0x00, 0x75, 0x00, 0x7d, 0x00, 0x00, 0x00, 0x16, 0x00, 0x21, 0x00,
+  0x2d, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x14, 0x00, 0x1f, 0x00, 0x2a, 0x00,
+  0x35, 0x00, 0x40, 0x00, 0x4b, 0x00, 0x56, 0x00, 0x61, 0x00, 0x6c, 0x00,
+  0x75, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x10, 0x00, 0x1a, 0x00, 0x26, 0x00,
+  0x32, 0x00, 0x3e, 0x00, 0x4a, 0x00, 0x56, 0x00, 0x62, 0x00, 0x6e, 0x00,
+  0x7a, 0x00, 0x86, 0x00, 0x92, 0x00, 0x9e, 0x00, 0xaa, 0x00, 0xb6, 0x00,
+  0xc2, 0x00, 0xce, 0x00, 0xda, 0x00, 0xe6, 0x00, 0xf2, 0x00, 0xfe, 0x00,
+  0x0a, 0x01, 0x16, 0x01, 0x1f, 0x01, 0x28, 0x01, 0x00, 0x00, 0x0d, 0x00,
+  0x16, 0x00, 0x23, 0x00, 0x2c, 0x00, 0x35, 0x00, 0x3d, 0x00, 0x45, 0x00,
+  0x4d, 0x00, 0x55, 0x00, 0x5d, 0x00, 0x66, 0x00, 0x00, 0x00, 0x0f, 0x00,
+  0x1d, 0x00, 0x35, 0x00, 0x44, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x11, 0x00,
+  0x00, 0x00, 0x17, 0x00, 0x29, 0x00, 0x35, 0x00, 0x3f, 0x00, 0x49, 0x00,
+  0x53, 0x00, 0x5d, 0x00, 0x67, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x17, 0x00,
+  0x25, 0x00, 0x33, 0x00, 0x41, 0x00, 0x49, 0x00, 0x57, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x17, 0x00, 0x20, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x0f, 0x00,
+  0x1a, 0x00, 0x25, 0x00, 0x30, 0x00, 0x3b, 0x00, 0x46, 0x00, 0x50, 0x00,
+  0x5a, 0x00, 0x64, 0x00, 0x6e, 0x00, 0x77, 0x00, 0x89, 0x00, 0x00, 0x00,
+  0x19, 0x00, 0x37, 0x00, 0x3e, 0x00, 0x46, 0x00, 0x4e, 0x00, 0x59, 0x00,
+  0x61, 0x00, 0x00, 0x00, 0x10, 0x00, 0x19, 0x00, 0x24, 0x00, 0x2d, 0x00,
+  0x36, 0x00, 0x3f, 0x00, 0x48, 0x00, 0x51, 0x00, 0x5a, 0x00, 0x63, 0x00,
+  0x6c, 0x00, 0x75, 0x00, 0x7e, 0x00, 0x87, 0x00, 0x90, 0x00, 0x99, 0x00,
+  0xa2, 0x00, 0xab, 0x00, 0xb4, 0x00, 0xbd, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x15, 0x00, 0x1e, 0x00, 0x27, 0x00, 0x30, 0x00, 0x39, 0x00, 0x42, 0x00,
+  0x4b, 0x00, 0x54, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x28, 0x00, 0x3a, 0x00,
+  0x43, 0x00, 0x4c, 0x00, 0x55, 0x00, 0x00, 0x00, 0x15, 0x00, 0x1c, 0x00,
+  0x25, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x17, 0x00, 0x2b, 0x00, 0x4e, 0x00,
+  0x5a, 0x00, 0x66, 0x00, 0x6f, 0x00, 0x78, 0x00, 0x81, 0x00, 0x8a, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x17, 0x00, 0x22, 0x00, 0x2d, 0x00, 0x38, 0x00,
+  0x47, 0x00, 0x53, 0x00, 0x5e, 0x00, 0x69, 0x00, 0x74, 0x00, 0x7f, 0x00,
+  0x8a, 0x00, 0x95, 0x00, 0xa0, 0x00, 0xab, 0x00, 0xb6, 0x00, 0xc1, 0x00,
+  0xcc, 0x00, 0xd7, 0x00, 0xe2, 0x00, 0xed, 0x00, 0xf8, 0x00, 0x02, 0x01,
+  0x0e, 0x01, 0x1a, 0x01, 0x26, 0x01, 0x32, 0x01, 0x3e, 0x01, 0x4a, 0x01,
+  0x56, 0x01, 0x62, 0x01, 0x6e, 0x01, 0x7a, 0x01, 0x86, 0x01, 0x92, 0x01,
+  0x00, 0x00, 0x16, 0x00, 0x20, 0x00, 0x2a, 0x00, 0x34, 0x00, 0x3e, 0x00,
+  0x48, 0x00, 0x52, 0x00, 0x5c, 0x00, 0x66, 0x00, 0x70, 0x00, 0x7a, 0x00,
+  0x84, 0x00, 0x90, 0x00, 0x9c, 0x00, 0xa8, 0x00, 0xb4, 0x00, 0xc0, 0x00,
+  0xcc, 0x00, 0xd8, 0x00, 0xe4, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0x08, 0x01,
+  0x14, 0x01, 0x20, 0x01, 0x2c, 0x01, 0x38, 0x01, 0x44, 0x01, 0x50, 0x01,
+  0x5c, 0x01, 0x68, 0x01, 0x74, 0x01, 0x80, 0x01, 0x8c, 0x01, 0x98, 0x01,
+  0xa4, 0x01, 0xb0, 0x01, 0xbc, 0x01, 0xc8, 0x01, 0xd4, 0x01, 0xe0, 0x01,
+  0xec, 0x01, 0xf8, 0x01, 0x04, 0x02, 0x10, 0x02, 0x1c, 0x02, 0x28, 0x02,
+  0x34, 0x02, 0x40, 0x02, 0x4c, 0x02, 0x58, 0x02, 0x64, 0x02, 0x6d, 0x02,
+  0x76, 0x02, 0x7f, 0x02, 0x88, 0x02, 0x90, 0x02, 0x9c, 0x02, 0xb0, 0x02,
+  0x00, 0x00, 0x13, 0x00, 0x1a, 0x00, 0x23, 0x00, 0x2c, 0x00, 0x35, 0x00,
+  0x3e, 0x00, 0x47, 0x00, 0x50, 0x00, 0x59, 0x00, 0x62, 0x00, 0x6e, 0x00,
+  0x75, 0x00, 0x7e, 0x00, 0x87, 0x00, 0x8e, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x18, 0x00, 0x24, 0x00, 0x30, 0x00, 0x3c, 0x00, 0x43, 0x00, 0x4f, 0x00,
+  0x00, 0x00, 0x11, 0x00, 0x1a, 0x00, 0x23, 0x00, 0x2c, 0x00, 0x38, 0x00,
+  0x44, 0x00, 0x4d, 0x00, 0x56, 0x00, 0x5e, 0x00, 0x00, 0x00, 0x11, 0x00,
+  0x1e, 0x00, 0x27, 0x00, 0x30, 0x00, 0x39, 0x00, 0x42, 0x00, 0x4b, 0x00,
+  0x54, 0x00, 0x5d, 0x00, 0x66, 0x00, 0x6f, 0x00, 0x78, 0x00, 0x81, 0x00,
+  0x8a, 0x00, 0x93, 0x00, 0x9c, 0x00, 0xa5, 0x00, 0xae, 0x00, 0xb7, 0x00,
+  0xc0, 0x00, 0xc9, 0x00, 0xd2, 0x00, 0xdb, 0x00, 0xe4, 0x00, 0xed, 0x00,
+  0xf6, 0x00, 0xff, 0x00, 0x08, 0x01, 0x11, 0x01, 0x1a, 0x01, 0x23, 0x01,
+  0x2c, 0x01, 0x35, 0x01, 0x3e, 0x01, 0x47, 0x01, 0x50, 0x01, 0x59, 0x01,
+  0x62, 0x01, 0x6b, 0x01, 0x74, 0x01, 0x7d, 0x01, 0x86, 0x01, 0x8f, 0x01,
+  0x98, 0x01, 0xa1, 0x01, 0xaa, 0x01, 0xb3, 0x01, 0xbc, 0x01, 0xc5, 0x01,
+  0xce, 0x01, 0xd7, 0x01, 0xe0, 0x01, 0xe9, 0x01, 0xf2, 0x01, 0xfb, 0x01,
+  0x04, 0x02, 0x0d, 0x02, 0x16, 0x02, 0x1f, 0x02, 0x28, 0x02, 0x31, 0x02,
+  0x3a, 0x02, 0x43, 0x02, 0x4c, 0x02, 0x55, 0x02, 0x5e, 0x02, 0x67, 0x02,
+  0x70, 0x02, 0x79, 0x02, 0x82, 0x02, 0x8b, 0x02, 0x97, 0x02, 0xa0, 0x02,
+  0xa9, 0x02, 0xb0, 0x02, 0xbc, 0x02, 0xc8, 0x02, 0xd3, 0x02, 0xdd, 0x02,
+  0x00, 0x00, 0x0f, 0x00, 0x1d, 0x00, 0x2e, 0x00, 0x38, 0x00, 0x43, 0x00,
+  0x4b, 0x00, 0x56, 0x00, 0x61, 0x00, 0x6c, 0x00, 0x77, 0x00, 0x82, 0x00,
+  0x8a, 0x00, 0x91, 0x00, 0x98, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x20, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x12, 0x00, 0x1b, 0x00, 0x2b, 0x00, 0x33, 0x00,
+  0x3b, 0x00, 0x00, 0x00, 0x09, 0x00, 0x12, 0x00, 0x1b, 0x00, 0x26, 0x00,
+  0x30, 0x00, 0x3a, 0x00, 0x44, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x14, 0x00,
+  0x1e, 0x00, 0x28, 0x00, 0x32, 0x00, 0x3a, 0x00, 0x42, 0x00, 0x4a, 0x00,
+  0x52, 0x00, 0x5d, 0x00, 0x65, 0x00, 0x6d, 0x00, 0x75, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x14, 0x00, 0x1d, 0x00, 0x26, 0x00, 0x2f, 0x00, 0x38, 0x00,
+  0x41, 0x00, 0x4a, 0x00, 0x53, 0x00, 0x5f, 0x00, 0x6b, 0x00, 0x74, 0x00,
+  0x7d, 0x00, 0x86, 0x00, 0x8f, 0x00, 0x98, 0x00, 0xa1, 0x00, 0xaa, 0x00,
+  0xb3, 0x00, 0xbc, 0x00, 0xc5, 0x00, 0xce, 0x00, 0xd7, 0x00, 0xe0, 0x00,
+  0xe9, 0x00, 0xf2, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x18, 0x00, 0x21, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x10, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x09, 0x00, 0x14, 0x00, 0x1f, 0x00,
+  0x2a, 0x00, 0x31, 0x00, 0x3a, 0x00, 0x43, 0x00, 0x4d, 0x00, 0x57, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x12, 0x00, 0x1e, 0x00, 0x27, 0x00, 0x34, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x15, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x0a, 0x00,
+  0x14, 0x00, 0x1e, 0x00, 0x28, 0x00, 0x32, 0x00, 0x00, 0x00, 0x16, 0x00,
+  0x1f, 0x00, 0x2b, 0x00, 0x35, 0x00, 0x3f, 0x00, 0x4b, 0x00, 0x52, 0x00,
+  0x59, 0x00, 0x62, 0x00, 0x69, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x18, 0x00,
+  0x24, 0x00, 0x30, 0x00, 0x3c, 0x00, 0x48, 0x00, 0x54, 0x00, 0x5c, 0x00,
+  0x68, 0x00, 0x74, 0x00, 0x00, 0x00, 0x12, 0x00, 0x1a, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x1c, 0x00, 0x26, 0x00, 0x30, 0x00, 0x3c, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x19, 0x00, 0x22, 0x00, 0x2b, 0x00, 0x34, 0x00, 0x3d, 0x00,
+  0x46, 0x00, 0x4f, 0x00, 0x59, 0x00, 0x6a, 0x00, 0x7b, 0x00, 0x87, 0x00,
+  0x90, 0x00, 0x99, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x26, 0x00, 0x32, 0x00,
+  0x3e, 0x00, 0x4a, 0x00, 0x55, 0x00, 0x60, 0x00, 0x6c, 0x00, 0x77, 0x00,
+  0x82, 0x00, 0x8c, 0x00, 0x98, 0x00, 0x00, 0x00, 0x07, 0x00, 0x10, 0x00,
+  0x1c, 0x00, 0x28, 0x00, 0x34, 0x00, 0x40, 0x00, 0x4c, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x12, 0x00, 0x1b, 0x00, 0x24, 0x00, 0x2d, 0x00, 0x36, 0x00,
+  0x3f, 0x00, 0x48, 0x00, 0x51, 0x00, 0x5a, 0x00, 0x63, 0x00, 0x6c, 0x00,
+  0x78, 0x00, 0x82, 0x00, 0x8f, 0x00, 0x9b, 0x00, 0xa4, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x11, 0x00, 0x1a, 0x00, 0x23, 0x00, 0x2c, 0x00, 0x35, 0x00,
+  0x3e, 0x00, 0x47, 0x00, 0x50, 0x00, 0x59, 0x00, 0x62, 0x00, 0x6b, 0x00,
+  0x74, 0x00, 0x7d, 0x00, 0x87, 0x00, 0x94, 0x00, 0xa2, 0x00, 0xab, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x17, 0x00, 0x22, 0x00, 0x2d, 0x00, 0x3a, 0x00,
+  0x44, 0x00, 0x4e, 0x00, 0x58, 0x00, 0x62, 0x00, 0x6b, 0x00, 0x74, 0x00,
+  0x7d, 0x00, 0x86, 0x00, 0x8f, 0x00, 0x98, 0x00, 0xa1, 0x00, 0x00, 0x00,
+  0x1a, 0x00, 0x28, 0x00, 0x34, 0x00, 0x40, 0x00, 0x4b, 0x00, 0x56, 0x00,
+  0x00, 0x00, 0x0b, 0x00, 0x16, 0x00, 0x21, 0x00, 0x2c, 0x00, 0x37, 0x00,
+  0x42, 0x00, 0x4d, 0x00, 0x58, 0x00, 0x63, 0x00, 0x6d, 0x00, 0x77, 0x00,
+  0x81, 0x00, 0x8b, 0x00, 0x95, 0x00, 0x9f, 0x00, 0xa9, 0x00, 0xb3, 0x00,
+  0xbd, 0x00, 0xc7, 0x00, 0xd1, 0x00, 0xdb, 0x00, 0xe5, 0x00, 0xef, 0x00,
+  0xf8, 0x00, 0x04, 0x01, 0x00, 0x00, 0x0f, 0x00, 0x21, 0x00, 0x28, 0x00,
+  0x30, 0x00, 0x3c, 0x00, 0x45, 0x00, 0x4e, 0x00, 0x57, 0x00, 0x60, 0x00,
+  0x6e, 0x00, 0x75, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x12, 0x00, 0x1c, 0x00,
+  0x25, 0x00, 0x2e, 0x00, 0x37, 0x00, 0x40, 0x00, 0x49, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x14, 0x00, 0x1e, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x16, 0x00, 0x20, 0x00, 0x2a, 0x00, 0x34, 0x00, 0x3e, 0x00, 0x48, 0x00,
+  0x52, 0x00, 0x5c, 0x00, 0x66, 0x00, 0x70, 0x00, 0x77, 0x00, 0x00, 0x00,
+  0x1b, 0x00, 0x27, 0x00, 0x33, 0x00, 0x3f, 0x00, 0x4b, 0x00, 0x57, 0x00,
+  0x63, 0x00, 0x6a, 0x00, 0x00, 0x00, 0x09, 0x00, 0x12, 0x00, 0x1b, 0x00,
+  0x24, 0x00, 0x2d, 0x00, 0x36, 0x00, 0x3f, 0x00, 0x48, 0x00, 0x51, 0x00,
+  0x5a, 0x00, 0x63, 0x00, 0x6c, 0x00, 0x75, 0x00, 0x7e, 0x00, 0x87, 0x00,
+  0x90, 0x00, 0x99, 0x00, 0xa2, 0x00, 0xab, 0x00, 0xb4, 0x00, 0xbd, 0x00,
+  0xc6, 0x00, 0xcf, 0x00, 0xd8, 0x00, 0xe1, 0x00, 0xea, 0x00, 0xf3, 0x00,
+  0x01, 0x01, 0x0b, 0x01, 0x15, 0x01, 0x1f, 0x01, 0x29, 0x01, 0x33, 0x01,
+  0x3d, 0x01, 0x44, 0x01, 0x4d, 0x01, 0x00, 0x00, 0x0a, 0x00, 0x14, 0x00,
+  0x1e, 0x00, 0x28, 0x00, 0x32, 0x00, 0x3a, 0x00, 0x43, 0x00, 0x51, 0x00,
+  0x5c, 0x00, 0x64, 0x00, 0x78, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x17, 0x00,
+  0x24, 0x00, 0x31, 0x00, 0x3e, 0x00, 0x4b, 0x00, 0x58, 0x00, 0x65, 0x00,
+  0x72, 0x00, 0x7f, 0x00, 0x8c, 0x00, 0x99, 0x00, 0xa5, 0x00, 0xb1, 0x00,
+  0xbd, 0x00, 0xc9, 0x00, 0xd2, 0x00, 0x00, 0x00, 0x14, 0x00, 0x1d, 0x00,
+  0x26, 0x00, 0x32, 0x00, 0x3a, 0x00, 0x43, 0x00, 0x4c, 0x00, 0x55, 0x00,
+  0x5e, 0x00, 0x6f, 0x00, 0x78, 0x00, 0x84, 0x00, 0x95, 0x00, 0x9e, 0x00,
+  0x00, 0x00, 0x15, 0x00, 0x1e, 0x00, 0x2a, 0x00, 0x36, 0x00, 0x42, 0x00,
+  0x4e, 0x00, 0x58, 0x00, 0x61, 0x00, 0x6a, 0x00, 0x78, 0x00, 0x81, 0x00,
+  0x8a, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x16, 0x00, 0x1f, 0x00,
+  0x28, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x14, 0x00, 0x1d, 0x00, 0x26, 0x00,
+  0x2f, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x09, 0x00, 0x12, 0x00,
+  0x1b, 0x00, 0x24, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x14, 0x00, 0x22, 0x00,
+  0x2d, 0x00, 0x38, 0x00, 0x43, 0x00, 0x4e, 0x00, 0x59, 0x00, 0x64, 0x00,
+  0x6f, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x16, 0x00, 0x21, 0x00,
+  0x30, 0x00, 0x39, 0x00, 0x44, 0x00, 0x4e, 0x00, 0x58, 0x00, 0x62, 0x00,
+  0x6c, 0x00, 0x78, 0x00, 0x84, 0x00, 0x8e, 0x00, 0x99, 0x00, 0xa3, 0x00,
+  0xaf, 0x00, 0xb9, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x13, 0x00, 0x25, 0x00,
+  0x2e, 0x00, 0x37, 0x00, 0x42, 0x00, 0x4d, 0x00, 0x58, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x14, 0x00, 0x1e, 0x00,
+  0x28, 0x00, 0x32, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x17, 0x00, 0x23, 0x00,
+  0x2f, 0x00, 0x3b, 0x00, 0x47, 0x00, 0x53, 0x00, 0x5f, 0x00, 0x6b, 0x00,
+  0x77, 0x00, 0x83, 0x00, 0x8f, 0x00, 0x9b, 0x00, 0xa7, 0x00, 0xb3, 0x00,
+  0xbf, 0x00, 0xcb, 0x00, 0xd7, 0x00, 0xe3, 0x00, 0xef, 0x00, 0xfb, 0x00,
+  0x07, 0x01, 0x13, 0x01, 0x1f, 0x01, 0x2b, 0x01, 0x37, 0x01, 0x43, 0x01,
+  0x4f, 0x01, 0x5b, 0x01, 0x67, 0x01, 0x73, 0x01, 0x7f, 0x01, 0x8b, 0x01,
+  0x97, 0x01, 0xa3, 0x01, 0xaf, 0x01, 0xbb, 0x01, 0xc2, 0x01, 0xcf, 0x01,
+  0xd8, 0x01, 0xe4, 0x01, 0xed, 0x01, 0xf7, 0x01, 0x03, 0x02, 0x00, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x13, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x12, 0x00, 0x1b, 0x00, 0x24, 0x00, 0x00, 0x00, 0x12, 0x00, 0x1b, 0x00,
+  0x24, 0x00, 0x2d, 0x00, 0x36, 0x00, 0x3f, 0x00, 0x48, 0x00, 0x51, 0x00,
+  0x5a, 0x00, 0x63, 0x00, 0x6c, 0x00, 0x78, 0x00, 0x84, 0x00, 0x8d, 0x00,
+  0x96, 0x00, 0x9f, 0x00, 0xa8, 0x00, 0xb1, 0x00, 0xba, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x14, 0x00, 0x1f, 0x00, 0x2a, 0x00, 0x35, 0x00, 0x3f, 0x00,
+  0x00, 0x00, 0x24, 0x00, 0x2e, 0x00, 0x3a, 0x00, 0x46, 0x00, 0x52, 0x00,
+  0x00, 0x00, 0x25, 0x00, 0x2f, 0x00, 0x39, 0x00, 0x42, 0x00, 0x4e, 0x00,
+  0x5a, 0x00, 0x63, 0x00, 0x00, 0x00, 0x09, 0x00, 0x14, 0x00, 0x1f, 0x00,
+  0x29, 0x00, 0x34, 0x00, 0x3f, 0x00, 0x4a, 0x00, 0x55, 0x00, 0x60, 0x00,
+  0x6b, 0x00, 0x76, 0x00, 0x7e, 0x00, 0x85, 0x00, 0x8c, 0x00, 0x93, 0x00,
+  0x9e, 0x00, 0xa9, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x16, 0x00, 0x20, 0x00,
+  0x2a, 0x00, 0x34, 0x00, 0x3e, 0x00, 0x48, 0x00, 0x00, 0x00, 0x0d, 0x00,
+  0x19, 0x00, 0x24, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x16, 0x00, 0x21, 0x00,
+  0x2c, 0x00, 0x37, 0x00, 0x42, 0x00, 0x4d, 0x00, 0x58, 0x00, 0x63, 0x00,
+  0x6e, 0x00, 0x79, 0x00, 0x84, 0x00, 0x8f, 0x00, 0x9a, 0x00, 0xa4, 0x00,
+  0xae, 0x00, 0xb8, 0x00, 0xc2, 0x00, 0xcc, 0x00, 0xd6, 0x00, 0xe0, 0x00,
+  0xea, 0x00, 0xf4, 0x00, 0xfe, 0x00, 0x08, 0x01, 0x12, 0x01, 0x1c, 0x01,
+  0x26, 0x01, 0x30, 0x01, 0x3a, 0x01, 0x44, 0x01, 0x4e, 0x01, 0x58, 0x01,
+  0x61, 0x01, 0x00, 0x00, 0x07, 0x00, 0x0e, 0x00, 0x1a, 0x00, 0x26, 0x00,
+  0x2d, 0x00, 0x36, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x07, 0x00, 0x0f, 0x00,
+  0x18, 0x00, 0x22, 0x00, 0x2b, 0x00, 0x34, 0x00, 0x3d, 0x00, 0x49, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x14, 0x00, 0x1e, 0x00, 0x28, 0x00,
+  0x32, 0x00, 0x3c, 0x00, 0x46, 0x00, 0x53, 0x00, 0x60, 0x00, 0x6d, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x18, 0x00, 0x24, 0x00, 0x30, 0x00, 0x3c, 0x00,
+  0x48, 0x00, 0x54, 0x00, 0x60, 0x00, 0x6c, 0x00, 0x78, 0x00, 0x84, 0x00,
+  0x8e, 0x00, 0x97, 0x00, 0xa1, 0x00, 0xab, 0x00, 0xb2, 0x00, 0xb9, 0x00,
+  0x00, 0x00, 0x11, 0x00, 0x1a, 0x00, 0x23, 0x00, 0x2c, 0x00, 0x35, 0x00,
+  0x3e, 0x00, 0x47, 0x00, 0x50, 0x00, 0x59, 0x00, 0x62, 0x00, 0x6b, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x1a, 0x00,
+  0x27, 0x00, 0x34, 0x00, 0x41, 0x00, 0x4e, 0x00, 0x5b, 0x00, 0x68, 0x00,
+  0x75, 0x00, 0x82, 0x00, 0x8f, 0x00, 0x9c, 0x00, 0xa9, 0x00, 0xb6, 0x00,
+  0xc3, 0x00, 0x00, 0x00, 0x11, 0x00, 0x22, 0x00, 0x2b, 0x00, 0x34, 0x00,
+  0x42, 0x00, 0x50, 0x00, 0x5e, 0x00, 0x6c, 0x00, 0x7a, 0x00, 0x88, 0x00,
+  0x96, 0x00, 0xa4, 0x00, 0xb2, 0x00, 0xc0, 0x00, 0xce, 0x00, 0xdc, 0x00,
+  0xea, 0x00, 0xf8, 0x00, 0x03, 0x01, 0x0f, 0x01, 0x18, 0x01, 0x21, 0x01,
+  0x2a, 0x01, 0x33, 0x01, 0x3c, 0x01, 0x45, 0x01, 0x4e, 0x01, 0x57, 0x01,
+  0x60, 0x01, 0x69, 0x01, 0x72, 0x01, 0x7b, 0x01, 0x84, 0x01, 0x8d, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x0e, 0x00, 0x17, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x14, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x18, 0x00, 0x27, 0x00, 0x33, 0x00, 0x45, 0x00, 0x4d, 0x00, 0x55, 0x00,
+  0x5e, 0x00, 0x00, 0x00, 0x09, 0x00, 0x12, 0x00, 0x22, 0x00, 0x2f, 0x00,
+  0x41, 0x00, 0x00, 0x00, 0x07, 0x00, 0x12, 0x00, 0x1d, 0x00, 0x26, 0x00,
+  0x2f, 0x00, 0x38, 0x00, 0x41, 0x00, 0x4a, 0x00, 0x53, 0x00, 0x5c, 0x00,
+  0x65, 0x00, 0x6e, 0x00, 0x77, 0x00, 0x80, 0x00, 0x89, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x00, 0x00, 0x08, 0x00, 0x11, 0x00, 0x1a, 0x00, 0x00, 0x00,
+  0x1a, 0x00, 0x28, 0x00, 0x36, 0x00, 0x42, 0x00, 0x4e, 0x00, 0x55, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x18, 0x00, 0x24, 0x00, 0x31, 0x00, 0x3e, 0x00,
+  0x4b, 0x00, 0x58, 0x00, 0x65, 0x00, 0x72, 0x00, 0x7f, 0x00, 0x8c, 0x00,
+  0x99, 0x00, 0xa2, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x14, 0x00, 0x1e, 0x00,
+  0x28, 0x00, 0x32, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x19, 0x00, 0x2a, 0x00,
+  0x34, 0x00, 0x3e, 0x00, 0x48, 0x00, 0x52, 0x00, 0x5a, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x19, 0x00, 0x26, 0x00, 0x34, 0x00, 0x42, 0x00, 0x50, 0x00,
+  0x5e, 0x00, 0x6b, 0x00, 0x73, 0x00, 0x7b, 0x00, 0x85, 0x00, 0x8d, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x11, 0x00, 0x00, 0x00, 0x0a, 0x00,
+  0x11, 0x00, 0x20, 0x00, 0x00, 0x00, 0x09, 0x00, 0x12, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x18, 0x00, 0x24, 0x00, 0x30, 0x00, 0x3c, 0x00, 0x48, 0x00,
+  0x52, 0x00, 0x00, 0x00, 0x09, 0x00, 0x12, 0x00, 0x1b, 0x00, 0x24, 0x00,
+  0x2d, 0x00, 0x36, 0x00, 0x3f, 0x00, 0x48, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x18, 0x00, 0x00, 0x00, 0x09, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x0a, 0x00,
+  0x16, 0x00, 0x22, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x09, 0x00, 0x12, 0x00,
+  0x1b, 0x00, 0x28, 0x00, 0x31, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x12, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x22, 0x00, 0x2f, 0x00, 0x3c, 0x00,
+  0x49, 0x00, 0x56, 0x00, 0x63, 0x00, 0x70, 0x00, 0x7d, 0x00, 0x8a, 0x00,
+  0x97, 0x00, 0xa4, 0x00, 0xb1, 0x00, 0xbe, 0x00, 0xcb, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x16, 0x00, 0x23, 0x00, 0x31, 0x00, 0x3b, 0x00, 0x45, 0x00,
+  0x51, 0x00, 0x00, 0x00, 0x09, 0x00, 0x12, 0x00, 0x21, 0x00, 0x30, 0x00,
+  0x3a, 0x00, 0x42, 0x00, 0x4a, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x2b, 0x00,
+  0x38, 0x00, 0x45, 0x00, 0x52, 0x00, 0x5f, 0x00, 0x6c, 0x00, 0x79, 0x00,
+  0x86, 0x00, 0x93, 0x00, 0xa0, 0x00, 0xac, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x1c, 0x00, 0x2a, 0x00, 0x38, 0x00, 0x46, 0x00, 0x54, 0x00, 0x61, 0x00,
+  0x6e, 0x00, 0x7b, 0x00, 0x88, 0x00, 0x95, 0x00, 0xa2, 0x00, 0xb2, 0x00,
+  0xc2, 0x00, 0xcf, 0x00, 0xdc, 0x00, 0xe2, 0x00, 0xea, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x12, 0x00, 0x1b, 0x00, 0x24, 0x00, 0x2c, 0x00, 0x35, 0x00,
+  0x3e, 0x00, 0x47, 0x00, 0x4e, 0x00, 0x57, 0x00, 0x60, 0x00, 0x69, 0x00,
+  0x72, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x3e, 0x00, 0x56, 0x00, 0x5f, 0x00,
+  0x68, 0x00, 0x74, 0x00, 0x7a, 0x00, 0x82, 0x00, 0x8c, 0x00, 0x96, 0x00,
+  0xa1, 0x00, 0xac, 0x00, 0xb4, 0x00, 0x00, 0x00, 0x11, 0x00, 0x1a, 0x00,
+  0x23, 0x00, 0x2c, 0x00, 0x35, 0x00, 0x41, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x12, 0x00, 0x1b, 0x00, 0x26, 0x00, 0x31, 0x00, 0x3c, 0x00, 0x47, 0x00,
+  0x52, 0x00, 0x5d, 0x00, 0x68, 0x00, 0x73, 0x00, 0x7e, 0x00, 0x89, 0x00,
+  0x94, 0x00, 0x9f, 0x00, 0xaa, 0x00, 0xb5, 0x00, 0xc0, 0x00, 0xcb, 0x00,
+  0xd6, 0x00, 0xe1, 0x00, 0xec, 0x00, 0xf7, 0x00, 0x02, 0x01, 0x0d, 0x01,
+  0x18, 0x01, 0x23, 0x01, 0x2e, 0x01, 0x39, 0x01, 0x42, 0x01, 0x4b, 0x01,
+  0x53, 0x01, 0x00, 0x00, 0x23, 0x00, 0x32, 0x00, 0x3c, 0x00, 0x46, 0x00,
+  0x50, 0x00, 0x5a, 0x00, 0x64, 0x00, 0x6e, 0x00, 0x78, 0x00, 0x82, 0x00,
+  0x8c, 0x00, 0x96, 0x00, 0xa0, 0x00, 0xaa, 0x00, 0xb4, 0x00, 0xbe, 0x00,
+  0xc8, 0x00, 0xd2, 0x00, 0xdc, 0x00, 0xe6, 0x00, 0xf0, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x1e, 0x00, 0x2d, 0x00, 0x39, 0x00, 0x41, 0x00, 0x49, 0x00,
+  0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x16, 0x00, 0x1f, 0x00,
+  0x28, 0x00, 0x31, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x10, 0x00, 0x1b, 0x00,
+  0x27, 0x00, 0x30, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x14, 0x00, 0x1d, 0x00,
+  0x26, 0x00, 0x2f, 0x00, 0x38, 0x00, 0x41, 0x00, 0x4a, 0x00, 0x53, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x19, 0x00, 0x26, 0x00, 0x33, 0x00, 0x40, 0x00,
+  0x47, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x11, 0x00, 0x1d, 0x00, 0x25, 0x00,
+  0x31, 0x00, 0x3a, 0x00, 0x46, 0x00, 0x00, 0x00, 0x18, 0x00, 0x28, 0x00,
+  0x36, 0x00, 0x44, 0x00, 0x50, 0x00, 0x5a, 0x00, 0x64, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x1f, 0x00, 0x2e, 0x00, 0x36, 0x00, 0x3e, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x19, 0x00, 0x21, 0x00, 0x29, 0x00, 0x30, 0x00,
+  0x38, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x0f, 0x00,
+  0x00, 0x00, 0x07, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x26, 0x00,
+  0x2f, 0x00, 0x36, 0x00, 0x00, 0x00, 0x09, 0x00, 0x12, 0x00, 0x1b, 0x00,
+  0x24, 0x00, 0x2d, 0x00, 0x36, 0x00, 0x3f, 0x00, 0x48, 0x00, 0x51, 0x00,
+  0x5a, 0x00, 0x63, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x2e, 0x00, 0x3b, 0x00,
+  0x48, 0x00, 0x52, 0x00, 0x5f, 0x00, 0x69, 0x00, 0x72, 0x00, 0x7b, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x18, 0x00, 0x1f, 0x00, 0x26, 0x00, 0x00, 0x00,
+  0x2f, 0x00, 0x38, 0x00, 0x41, 0x00, 0x4a, 0x00, 0x53, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x39, 0x00, 0x44, 0x00, 0x4e, 0x00,
+  0x58, 0x00, 0x62, 0x00, 0x6b, 0x00, 0x79, 0x00, 0x86, 0x00, 0x93, 0x00,
+  0xa0, 0x00, 0xad, 0x00, 0xb6, 0x00, 0xbf, 0x00, 0xc8, 0x00, 0xd1, 0x00,
+  0xda, 0x00, 0xe3, 0x00, 0xec, 0x00, 0x00, 0x00, 0x09, 0x00, 0x12, 0x00,
+  0x1b, 0x00, 0x24, 0x00, 0x2d, 0x00, 0x36, 0x00, 0x3f, 0x00, 0x48, 0x00,
+  0x51, 0x00, 0x5a, 0x00, 0x63, 0x00, 0x00, 0x00, 0x28, 0x00, 0x4e, 0x00,
+  0x59, 0x00, 0x6c, 0x00, 0x76, 0x00, 0x80, 0x00, 0x8e, 0x00, 0x9c, 0x00,
+  0xaa, 0x00, 0xb8, 0x00, 0xc6, 0x00, 0xd4, 0x00, 0xe1, 0x00, 0xee, 0x00,
+  0xf6, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x26, 0x00, 0x36, 0x00, 0x49, 0x00,
+  0x53, 0x00, 0x5c, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x77, 0x00, 0x80, 0x00,
+  0x89, 0x00, 0x93, 0x00, 0x9f, 0x00, 0xab, 0x00, 0xb5, 0x00, 0xbf, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x12, 0x00, 0x1d, 0x00, 0x26, 0x00, 0x30, 0x00,
+  0x3a, 0x00, 0x44, 0x00, 0x4c, 0x00, 0x54, 0x00, 0x63, 0x00, 0x6b, 0x00,
+  0x73, 0x00, 0x7b, 0x00, 0x00, 0x00, 0x20, 0x00, 0x2d, 0x00, 0x3a, 0x00,
+  0x47, 0x00, 0x00, 0x00, 0x08, 0x00, 0x15, 0x00, 0x22, 0x00, 0x2f, 0x00,
+  0x3c, 0x00, 0x49, 0x00, 0x56, 0x00, 0x63, 0x00, 0x70, 0x00, 0x7d, 0x00,
+  0x8a, 0x00, 0x97, 0x00, 0xa4, 0x00, 0xb1, 0x00, 0xbe, 0x00, 0xcb, 0x00,
+  0xd3, 0x00, 0xdb, 0x00, 0xe3, 0x00, 0xeb, 0x00, 0xf3, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1f, 0x00, 0x2f, 0x00, 0x45, 0x00, 0x4d, 0x00, 0x55, 0x00,
+  0x5f, 0x00, 0x69, 0x00, 0x73, 0x00, 0x7d, 0x00, 0x87, 0x00, 0x91, 0x00,
+  0x9b, 0x00, 0xa5, 0x00, 0xb0, 0x00, 0xba, 0x00, 0xc4, 0x00, 0xce, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x23, 0x00, 0x2c, 0x00, 0x3e, 0x00, 0x4e, 0x00,
+  0x5d, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x1b, 0x00, 0x26, 0x00, 0x2f, 0x00,
+  0x38, 0x00, 0x41, 0x00, 0x4a, 0x00, 0x53, 0x00, 0x5c, 0x00, 0x66, 0x00,
+  0x71, 0x00, 0x7c, 0x00, 0x87, 0x00, 0x92, 0x00, 0x9d, 0x00, 0xa8, 0x00,
+  0xb3, 0x00, 0xbe, 0x00, 0xc9, 0x00, 0xd4, 0x00, 0xdf, 0x00, 0xea, 0x00,
+  0xf5, 0x00, 0x00, 0x01, 0x0b, 0x01, 0x16, 0x01, 0x21, 0x01, 0x2c, 0x01,
+  0x37, 0x01, 0x42, 0x01, 0x4d, 0x01, 0x58, 0x01, 0x63, 0x01, 0x6e, 0x01,
+  0x79, 0x01, 0x82, 0x01, 0x8b, 0x01, 0x94, 0x01, 0x9d, 0x01, 0xa9, 0x01,
+  0x00, 0x00, 0x11, 0x00, 0x1f, 0x00, 0x29, 0x00, 0x33, 0x00, 0x3d, 0x00,
+  0x47, 0x00, 0x51, 0x00, 0x5b, 0x00, 0x65, 0x00, 0x6f, 0x00, 0x79, 0x00,
+  0x83, 0x00, 0x8d, 0x00, 0x97, 0x00, 0xa1, 0x00, 0xab, 0x00, 0xb5, 0x00,
+  0xbf, 0x00, 0xc9, 0x00, 0xd3, 0x00, 0xdd, 0x00, 0xe7, 0x00, 0xf1, 0x00,
+  0xfb, 0x00, 0x05, 0x01, 0x0f, 0x01, 0x19, 0x01, 0x23, 0x01, 0x2d, 0x01,
+  0x37, 0x01, 0x41, 0x01, 0x4b, 0x01, 0x55, 0x01, 0x5f, 0x01, 0x69, 0x01,
+  0x73, 0x01, 0x7d, 0x01, 0x87, 0x01, 0x91, 0x01, 0x00, 0x00, 0x19, 0x00,
+  0x2c, 0x00, 0x43, 0x00, 0x55, 0x00, 0x67, 0x00, 0x70, 0x00, 0x82, 0x00,
+  0x8b, 0x00, 0x94, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x0d, 0x00,
+  0x2a, 0x00, 0x33, 0x00, 0x40, 0x00, 0x49, 0x00, 0x52, 0x00, 0x5b, 0x00,
+  0x64, 0x00, 0x6d, 0x00, 0x76, 0x00, 0x7f, 0x00, 0x88, 0x00, 0x91, 0x00,
+  0x9b, 0x00, 0xa4, 0x00, 0xad, 0x00, 0xb6, 0x00, 0xbf, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x1f, 0x00, 0x2b, 0x00, 0x36, 0x00, 0x41, 0x00, 0x4c, 0x00,
+  0x57, 0x00, 0x60, 0x00, 0x69, 0x00, 0x72, 0x00, 0x7b, 0x00, 0x84, 0x00,
+  0x00, 0x00, 0x16, 0x00, 0x3c, 0x00, 0x45, 0x00, 0x4c, 0x00, 0x55, 0x00,
+  0x5e, 0x00, 0x67, 0x00, 0x70, 0x00, 0x79, 0x00, 0x84, 0x00, 0x8f, 0x00,
+  0x9a, 0x00, 0xa5, 0x00, 0xb0, 0x00, 0xb7, 0x00, 0x00, 0x00, 0x16, 0x00,
+  0x1f, 0x00, 0x28, 0x00, 0x31, 0x00, 0x3a, 0x00, 0x43, 0x00, 0x4c, 0x00,
+  0x55, 0x00, 0x5e, 0x00, 0x67, 0x00, 0x70, 0x00, 0x79, 0x00, 0x82, 0x00,
+  0x8b, 0x00, 0x94, 0x00, 0x9d, 0x00, 0xa6, 0x00, 0xaf, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x1b, 0x00, 0x2a, 0x00, 0x39, 0x00, 0x43, 0x00, 0x49, 0x00,
+  0x52, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x11, 0x00, 0x1d, 0x00, 0x29, 0x00,
+  0x00, 0x00, 0x11, 0x00, 0x21, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x19, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x1c, 0x00, 0x29, 0x00, 0x37, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x14, 0x00, 0x00, 0x00, 0x10, 0x00, 0x28, 0x00, 0x33, 0x00,
+  0x4b, 0x00, 0x71, 0x00, 0x80, 0x00, 0x89, 0x00, 0x95, 0x00, 0xa1, 0x00,
+  0xad, 0x00, 0xb9, 0x00, 0xc5, 0x00, 0xd1, 0x00, 0xdd, 0x00, 0xe9, 0x00,
+  0xf5, 0x00, 0x01, 0x01, 0x0d, 0x01, 0x19, 0x01, 0x25, 0x01, 0x31, 0x01,
+  0x3d, 0x01, 0x49, 0x01, 0x55, 0x01, 0x61, 0x01, 0x6d, 0x01, 0x75, 0x01,
+  0x7d, 0x01, 0x85, 0x01, 0x00, 0x00, 0x14, 0x00, 0x29, 0x00, 0x3d, 0x00,
+  0x5b, 0x00, 0x80, 0x00, 0x87, 0x00, 0x92, 0x00, 0x00, 0x00, 0x1a, 0x00,
+  0x29, 0x00, 0x38, 0x00, 0x58, 0x00, 0x63, 0x00, 0x6e, 0x00, 0x79, 0x00,
+  0x84, 0x00, 0x8f, 0x00, 0x9a, 0x00, 0xa2, 0x00, 0xaa, 0x00, 0xb3, 0x00,
+  0xbf, 0x00, 0xcb, 0x00, 0xd7, 0x00, 0xe3, 0x00, 0xef, 0x00, 0xfb, 0x00,
+  0x07, 0x01, 0x13, 0x01, 0x1f, 0x01, 0x2b, 0x01, 0x33, 0x01, 0x3b, 0x01,
+  0x00, 0x00, 0x11, 0x00, 0x1d, 0x00, 0x2d, 0x00, 0x3c, 0x00, 0x45, 0x00,
+  0x4b, 0x00, 0x00, 0x00, 0x10, 0x00, 0x23, 0x00, 0x30, 0x00, 0x54, 0x00,
+  0x7f, 0x00, 0x87, 0x00, 0x8f, 0x00, 0x97, 0x00, 0x9f, 0x00, 0xa9, 0x00,
+  0xb3, 0x00, 0xbb, 0x00, 0xc3, 0x00, 0xcb, 0x00, 0xd3, 0x00, 0xdd, 0x00,
+  0xe7, 0x00, 0xf1, 0x00, 0xfb, 0x00, 0x05, 0x01, 0x0f, 0x01, 0x19, 0x01,
+  0x23, 0x01, 0x2d, 0x01, 0x37, 0x01, 0x41, 0x01, 0x49, 0x01, 0x52, 0x01,
+  0x5a, 0x01, 0x62, 0x01, 0x6a, 0x01, 0x73, 0x01, 0x81, 0x01, 0x00, 0x00,
+  0x0f, 0x00, 0x24, 0x00, 0x36, 0x00, 0x54, 0x00, 0x85, 0x00, 0x8e, 0x00,
+  0x97, 0x00, 0xa0, 0x00, 0xa9, 0x00, 0xb2, 0x00, 0xbe, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x23, 0x00, 0x31, 0x00, 0x56, 0x00, 0x7e, 0x00, 0x9a, 0x00,
+  0xa2, 0x00, 0xaa, 0x00, 0xb2, 0x00, 0xba, 0x00, 0xc6, 0x00, 0xce, 0x00,
+  0xd7, 0x00, 0xe0, 0x00, 0xe9, 0x00, 0x00, 0x00, 0x12, 0x00, 0x22, 0x00,
+  0x33, 0x00, 0x44, 0x00, 0x6b, 0x00, 0x00, 0x00, 0x13, 0x00, 0x24, 0x00,
+  0x32, 0x00, 0x3a, 0x00, 0x42, 0x00, 0x4a, 0x00, 0x52, 0x00, 0x5e, 0x00,
+  0x6a, 0x00, 0x76, 0x00, 0x82, 0x00, 0x8e, 0x00, 0x9a, 0x00, 0xa6, 0x00,
+  0xb2, 0x00, 0xbe, 0x00, 0xca, 0x00, 0xd6, 0x00, 0xe2, 0x00, 0xee, 0x00,
+  0xfa, 0x00, 0x06, 0x01, 0x12, 0x01, 0x1e, 0x01, 0x2a, 0x01, 0x36, 0x01,
+  0x42, 0x01, 0x4e, 0x01, 0x5a, 0x01, 0x66, 0x01, 0x72, 0x01, 0x7e, 0x01,
+  0x8a, 0x01, 0x96, 0x01, 0xa2, 0x01, 0xae, 0x01, 0xba, 0x01, 0xc6, 0x01,
+  0xd2, 0x01, 0xde, 0x01, 0xea, 0x01, 0xf6, 0x01, 0x02, 0x02, 0x0e, 0x02,
+  0x1a, 0x02, 0x26, 0x02, 0x32, 0x02, 0x3e, 0x02, 0x4a, 0x02, 0x56, 0x02,
+  0x62, 0x02, 0x6e, 0x02, 0x7a, 0x02, 0x86, 0x02, 0x92, 0x02, 0x9e, 0x02,
+  0xaa, 0x02, 0xb6, 0x02, 0xc2, 0x02, 0xce, 0x02, 0xda, 0x02, 0xe6, 0x02,
+  0xf2, 0x02, 0xfe, 0x02, 0x0a, 0x03, 0x16, 0x03, 0x22, 0x03, 0x2e, 0x03,
+  0x3a, 0x03, 0x46, 0x03, 0x52, 0x03, 0x5e, 0x03, 0x6a, 0x03, 0x76, 0x03,
+  0x82, 0x03, 0x8e, 0x03, 0x9a, 0x03, 0xa6, 0x03, 0xb2, 0x03, 0xbb, 0x03,
+  0xc3, 0x03, 0xce, 0x03, 0xd7, 0x03, 0xe0, 0x03, 0xe7, 0x03, 0x00, 0x00,
+  0x0e, 0x00, 0x1e, 0x00, 0x2c, 0x00, 0x35, 0x00, 0x3e, 0x00, 0x47, 0x00,
+  0x50, 0x00, 0x59, 0x00, 0x62, 0x00, 0x6b, 0x00, 0x74, 0x00, 0x7d, 0x00,
+  0x86, 0x00, 0x8f, 0x00, 0x98, 0x00, 0xa1, 0x00, 0xaa, 0x00, 0xb3, 0x00,
+  0xbc, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x12, 0x00, 0x1f, 0x00, 0x2e, 0x00,
+  0x38, 0x00, 0x42, 0x00, 0x4c, 0x00, 0x56, 0x00, 0x60, 0x00, 0x6a, 0x00,
+  0x74, 0x00, 0x7b, 0x00, 0x83, 0x00, 0x92, 0x00, 0x99, 0x00, 0xa1, 0x00,
+  0xb0, 0x00, 0xb8, 0x00, 0xc1, 0x00, 0xca, 0x00, 0xd3, 0x00, 0xde, 0x00,
+  0x00, 0x00, 0x13, 0x00, 0x22, 0x00, 0x36, 0x00, 0x40, 0x00, 0x4a, 0x00,
+  0x54, 0x00, 0x5e, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x19, 0x00, 0x3f, 0x00,
+  0x49, 0x00, 0x51, 0x00, 0x59, 0x00, 0x00, 0x00, 0x17, 0x00, 0x2b, 0x00,
+  0x51, 0x00, 0x77, 0x00, 0x86, 0x00, 0x8d, 0x00, 0x97, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x20, 0x00, 0x33, 0x00, 0x3f, 0x00, 0x4b, 0x00, 0x57, 0x00,
+  0x00, 0x00, 0x15, 0x00, 0x22, 0x00, 0x45, 0x00, 0x4a, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x1d, 0x00, 0x36, 0x00, 0x45, 0x00, 0x55, 0x00, 0x5e, 0x00,
+  0x69, 0x00, 0x74, 0x00, 0x7f, 0x00, 0x8a, 0x00, 0x95, 0x00, 0xa0, 0x00,
+  0xab, 0x00, 0xb6, 0x00, 0xc1, 0x00, 0xcc, 0x00, 0xd7, 0x00, 0xe2, 0x00,
+  0xed, 0x00, 0xf8, 0x00, 0x03, 0x01, 0x0e, 0x01, 0x19, 0x01, 0x24, 0x01,
+  0x2f, 0x01, 0x3a, 0x01, 0x45, 0x01, 0x50, 0x01, 0x5b, 0x01, 0x66, 0x01,
+  0x6e, 0x01, 0x00, 0x00, 0x0e, 0x00, 0x21, 0x00, 0x39, 0x00, 0x4c, 0x00,
+  0x5d, 0x00, 0x66, 0x00, 0x00, 0x00, 0x19, 0x00, 0x26, 0x00, 0x32, 0x00,
+  0x42, 0x00, 0x4c, 0x00, 0x5f, 0x00, 0x6a, 0x00, 0x75, 0x00, 0x80, 0x00,
+  0x8b, 0x00, 0x96, 0x00, 0xa1, 0x00, 0xac, 0x00, 0xb7, 0x00, 0xc2, 0x00,
+  0xcd, 0x00, 0xd8, 0x00, 0xe3, 0x00, 0xee, 0x00, 0xf9, 0x00, 0x04, 0x01,
+  0x0f, 0x01, 0x1a, 0x01, 0x25, 0x01, 0x30, 0x01, 0x3b, 0x01, 0x46, 0x01,
+  0x51, 0x01, 0x00, 0x00, 0x18, 0x00, 0x23, 0x00, 0x35, 0x00, 0x4a, 0x00,
+  0x57, 0x00, 0x69, 0x00, 0x7c, 0x00, 0x86, 0x00, 0x90, 0x00, 0x9c, 0x00,
+  0xa6, 0x00, 0x00, 0x00, 0x18, 0x00, 0x27, 0x00, 0x3b, 0x00, 0x52, 0x00,
+  0x61, 0x00, 0x7d, 0x00, 0x86, 0x00, 0x00, 0x00, 0x19, 0x00, 0x26, 0x00,
+  0x35, 0x00, 0x47, 0x00, 0x56, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x19, 0x00,
+  0x27, 0x00, 0x35, 0x00, 0x4e, 0x00, 0x57, 0x00, 0x60, 0x00, 0x69, 0x00,
+  0x72, 0x00, 0x7b, 0x00, 0x84, 0x00, 0x8d, 0x00, 0x96, 0x00, 0x9f, 0x00,
+  0xa8, 0x00, 0xb1, 0x00, 0xba, 0x00, 0xc3, 0x00, 0xcc, 0x00, 0xd5, 0x00,
+  0xde, 0x00, 0xe7, 0x00, 0xf0, 0x00, 0xf9, 0x00, 0x02, 0x01, 0x0b, 0x01,
+  0x14, 0x01, 0x1d, 0x01, 0x29, 0x01, 0x32, 0x01, 0x3b, 0x01, 0x44, 0x01,
+  0x4d, 0x01, 0x00, 0x00, 0x17, 0x00, 0x24, 0x00, 0x33, 0x00, 0x43, 0x00,
+  0x5b, 0x00, 0x64, 0x00, 0x6d, 0x00, 0x76, 0x00, 0x7f, 0x00, 0x88, 0x00,
+  0x93, 0x00, 0x9e, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x1c, 0x00,
+  0x2c, 0x00, 0x40, 0x00, 0x5a, 0x00, 0x7f, 0x00, 0x88, 0x00, 0x91, 0x00,
+  0x9b, 0x00, 0xa4, 0x00, 0xad, 0x00, 0xb3, 0x00, 0xbe, 0x00, 0xc9, 0x00,
+  0xd4, 0x00, 0xdf, 0x00, 0xea, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x1f, 0x00,
+  0x39, 0x00, 0x46, 0x00, 0x6b, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x1f, 0x00,
+  0x2d, 0x00, 0x43, 0x00, 0x5a, 0x00, 0x84, 0x00, 0x8d, 0x00, 0x96, 0x00,
+  0x9f, 0x00, 0xa8, 0x00, 0xb1, 0x00, 0xba, 0x00, 0xc6, 0x00, 0xcf, 0x00,
+  0xd8, 0x00, 0xe6, 0x00, 0xf0, 0x00, 0xfa, 0x00, 0x04, 0x01, 0x10, 0x01,
+  0x19, 0x01, 0x23, 0x01, 0x2d, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x1a, 0x00,
+  0x2b, 0x00, 0x38, 0x00, 0x49, 0x00, 0x6e, 0x00, 0x7a, 0x00, 0x83, 0x00,
+  0x8c, 0x00, 0x95, 0x00, 0x9e, 0x00, 0xa7, 0x00, 0x00, 0x00, 0x12, 0x00,
+  0x2c, 0x00, 0x43, 0x00, 0x52, 0x00, 0x68, 0x00, 0x00, 0x00, 0x2d, 0x00,
+  0x40, 0x00, 0x52, 0x00, 0x65, 0x00, 0x76, 0x00, 0x8f, 0x00, 0x98, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x23, 0x00, 0x3b, 0x00, 0x50, 0x00, 0x75, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x1c, 0x00, 0x36, 0x00, 0x48, 0x00, 0x5f, 0x00,
+  0x75, 0x00, 0x86, 0x00, 0x8d, 0x00, 0x99, 0x00, 0x00, 0x00, 0x15, 0x00,
+  0x23, 0x00, 0x30, 0x00, 0x3b, 0x00, 0x4d, 0x00, 0x5f, 0x00, 0x6e, 0x00,
+  0x7f, 0x00, 0x88, 0x00, 0x91, 0x00, 0x00, 0x00, 0x11, 0x00, 0x1f, 0x00,
+  0x2b, 0x00, 0x37, 0x00, 0x44, 0x00, 0x56, 0x00, 0x6f, 0x00, 0x00, 0x00,
+  0x1b, 0x00, 0x39, 0x00, 0x55, 0x00, 0x6e, 0x00, 0x8e, 0x00, 0xaa, 0x00,
+  0xc7, 0x00, 0xdf, 0x00, 0xee, 0x00, 0xfc, 0x00, 0x07, 0x01, 0x14, 0x01,
+  0x24, 0x01, 0x38, 0x01, 0x48, 0x01, 0x54, 0x01, 0x5d, 0x01, 0x64, 0x01,
+  0x6f, 0x01, 0x77, 0x01, 0x82, 0x01, 0x8d, 0x01, 0x98, 0x01, 0xa3, 0x01,
+  0xae, 0x01, 0xb9, 0x01, 0xc4, 0x01, 0xcc, 0x01, 0xd4, 0x01, 0xdc, 0x01,
+  0xe4, 0x01, 0xf0, 0x01, 0xfc, 0x01, 0x09, 0x02, 0x15, 0x02, 0x21, 0x02,
+  0x2d, 0x02, 0x39, 0x02, 0x40, 0x02, 0x48, 0x02, 0x50, 0x02, 0x59, 0x02,
+  0x00, 0x00, 0x19, 0x00, 0x3d, 0x00, 0x4b, 0x00, 0x57, 0x00, 0x6f, 0x00,
+  0x82, 0x00, 0x97, 0x00, 0xa4, 0x00, 0xae, 0x00, 0x00, 0x00, 0x1d, 0x00,
+  0x3d, 0x00, 0x5b, 0x00, 0x76, 0x00, 0x98, 0x00, 0xb6, 0x00, 0xd5, 0x00,
+  0xe7, 0x00, 0xfd, 0x00, 0x0d, 0x01, 0x19, 0x01, 0x2e, 0x01, 0x3a, 0x01,
+  0x5a, 0x01, 0x67, 0x01, 0x6f, 0x01, 0x77, 0x01, 0x7f, 0x01, 0x87, 0x01,
+  0x90, 0x01, 0x98, 0x01, 0xa0, 0x01, 0xa8, 0x01, 0xb0, 0x01, 0xb8, 0x01,
+  0xc0, 0x01, 0xcf, 0x01, 0xde, 0x01, 0xed, 0x01, 0xf7, 0x01, 0x01, 0x02,
+  0x0b, 0x02, 0x15, 0x02, 0x1d, 0x02, 0x25, 0x02, 0x2d, 0x02, 0x36, 0x02,
+  0x3f, 0x02, 0x48, 0x02, 0x52, 0x02, 0x5c, 0x02, 0x66, 0x02, 0x70, 0x02,
+  0x7a, 0x02, 0x84, 0x02, 0x8e, 0x02, 0x96, 0x02, 0x9e, 0x02, 0xa6, 0x02,
+  0xae, 0x02, 0xb6, 0x02, 0xbe, 0x02, 0xc6, 0x02, 0xce, 0x02, 0xd6, 0x02,
+  0x00, 0x00, 0x25, 0x00, 0x33, 0x00, 0x49, 0x00, 0x59, 0x00, 0x69, 0x00,
+  0x7d, 0x00, 0x91, 0x00, 0xa0, 0x00, 0xaf, 0x00, 0xbb, 0x00, 0xc7, 0x00,
+  0xd3, 0x00, 0xdf, 0x00, 0xe8, 0x00, 0xf1, 0x00, 0xfa, 0x00, 0x03, 0x01,
+  0x0c, 0x01, 0x15, 0x01, 0x1e, 0x01, 0x27, 0x01, 0x00, 0x00, 0x12, 0x00,
+  0x24, 0x00, 0x36, 0x00, 0x43, 0x00, 0x56, 0x00, 0x66, 0x00, 0x79, 0x00,
+  0x86, 0x00, 0x8d, 0x00, 0x95, 0x00, 0x9d, 0x00, 0xa5, 0x00, 0xad, 0x00,
+  0xb5, 0x00, 0xbd, 0x00, 0xc5, 0x00, 0xcd, 0x00, 0xd5, 0x00, 0xdd, 0x00,
+  0xe9, 0x00, 0xf5, 0x00, 0x01, 0x01, 0x0a, 0x01, 0x00, 0x00, 0x27, 0x00,
+  0x3e, 0x00, 0x4e, 0x00, 0x5b, 0x00, 0x67, 0x00, 0x75, 0x00, 0x87, 0x00,
+  0xab, 0x00, 0xb9, 0x00, 0x00, 0x00, 0x13, 0x00, 0x1e, 0x00, 0x30, 0x00,
+  0x45, 0x00, 0x5b, 0x00, 0x70, 0x00, 0x7f, 0x00, 0x88, 0x00, 0x91, 0x00,
+  0x9a, 0x00, 0xa3, 0x00, 0xaf, 0x00, 0xbb, 0x00, 0xc7, 0x00, 0xd3, 0x00,
+  0xdf, 0x00, 0xeb, 0x00, 0xf7, 0x00, 0x03, 0x01, 0x0f, 0x01, 0x1b, 0x01,
+  0x27, 0x01, 0x33, 0x01, 0x3f, 0x01, 0x4b, 0x01, 0x57, 0x01, 0x63, 0x01,
+  0x6f, 0x01, 0x7b, 0x01, 0x87, 0x01, 0x93, 0x01, 0x9f, 0x01, 0xab, 0x01,
+  0xb7, 0x01, 0xc3, 0x01, 0xcf, 0x01, 0xdb, 0x01, 0xe7, 0x01, 0xf3, 0x01,
+  0xff, 0x01, 0x08, 0x02, 0x11, 0x02, 0x19, 0x02, 0x21, 0x02, 0x27, 0x02,
+  0x2f, 0x02, 0x37, 0x02, 0x00, 0x00, 0x15, 0x00, 0x24, 0x00, 0x30, 0x00,
+  0x47, 0x00, 0x56, 0x00, 0x68, 0x00, 0x75, 0x00, 0x86, 0x00, 0x8f, 0x00,
+  0x00, 0x00, 0x0b, 0x00, 0x20, 0x00, 0x2b, 0x00, 0x36, 0x00, 0x45, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x1a, 0x00, 0x27, 0x00, 0x3b, 0x00, 0x51, 0x00,
+  0x5e, 0x00, 0x6f, 0x00, 0x7b, 0x00, 0x00, 0x00, 0x14, 0x00, 0x22, 0x00,
+  0x2e, 0x00, 0x3a, 0x00, 0x4e, 0x00, 0x5a, 0x00, 0x66, 0x00, 0x6f, 0x00,
+  0x78, 0x00, 0x82, 0x00, 0x8c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x1d, 0x00,
+  0x2c, 0x00, 0x40, 0x00, 0x55, 0x00, 0x64, 0x00, 0x73, 0x00, 0x86, 0x00,
+  0x99, 0x00, 0x00, 0x00, 0x10, 0x00, 0x1d, 0x00, 0x2a, 0x00, 0x39, 0x00,
+  0x4f, 0x00, 0x61, 0x00, 0x00, 0x00, 0x10, 0x00, 0x1f, 0x00, 0x2d, 0x00,
+  0x3d, 0x00, 0x4b, 0x00, 0x59, 0x00, 0x63, 0x00, 0x6f, 0x00, 0x78, 0x00,
+  0x81, 0x00, 0x8a, 0x00, 0x93, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x2a, 0x00,
+  0x38, 0x00, 0x47, 0x00, 0x56, 0x00, 0x68, 0x00, 0x76, 0x00, 0x85, 0x00,
+  0x91, 0x00, 0x9a, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x20, 0x00, 0x32, 0x00,
+  0x49, 0x00, 0x6d, 0x00, 0x89, 0x00, 0x9a, 0x00, 0xa9, 0x00, 0xb2, 0x00,
+  0xbb, 0x00, 0xc4, 0x00, 0xcd, 0x00, 0xd3, 0x00, 0xdd, 0x00, 0x00, 0x00,
+  0x15, 0x00, 0x25, 0x00, 0x3a, 0x00, 0x46, 0x00, 0x5a, 0x00, 0x6b, 0x00,
+  0x80, 0x00, 0x95, 0x00, 0x9b, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x1d, 0x00,
+  0x2f, 0x00, 0x45, 0x00, 0x53, 0x00, 0x64, 0x00, 0x76, 0x00, 0x85, 0x00,
+  0x00, 0x00, 0x1a, 0x00, 0x30, 0x00, 0x43, 0x00, 0x5e, 0x00, 0x73, 0x00,
+  0x7f, 0x00, 0x9d, 0x00, 0xaa, 0x00, 0xbf, 0x00, 0xd2, 0x00, 0xe7, 0x00,
+  0xf1, 0x00, 0xfa, 0x00, 0x03, 0x01, 0x00, 0x00, 0x16, 0x00, 0x2a, 0x00,
+  0x41, 0x00, 0x60, 0x00, 0x6f, 0x00, 0x82, 0x00, 0x91, 0x00, 0x99, 0x00,
+  0xa1, 0x00, 0xa9, 0x00, 0xb2, 0x00, 0xbb, 0x00, 0xc4, 0x00, 0xcd, 0x00,
+  0xd6, 0x00, 0xdf, 0x00, 0xe8, 0x00, 0xf1, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x1e, 0x00, 0x31, 0x00, 0x45, 0x00, 0x63, 0x00, 0x72, 0x00,
+  0x8e, 0x00, 0xad, 0x00, 0xbf, 0x00, 0xcf, 0x00, 0xe9, 0x00, 0xf9, 0x00,
+  0x0c, 0x01, 0x21, 0x01, 0x32, 0x01, 0x46, 0x01, 0x57, 0x01, 0x6b, 0x01,
+  0x7d, 0x01, 0x8c, 0x01, 0xa0, 0x01, 0xb6, 0x01, 0xbf, 0x01, 0xc8, 0x01,
+  0xd1, 0x01, 0xda, 0x01, 0xe3, 0x01, 0xec, 0x01, 0xf5, 0x01, 0xfe, 0x01,
+  0x07, 0x02, 0x00, 0x00, 0x10, 0x00, 0x25, 0x00, 0x32, 0x00, 0x44, 0x00,
+  0x64, 0x00, 0x7a, 0x00, 0x8e, 0x00, 0x9a, 0x00, 0xa2, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x21, 0x00, 0x34, 0x00, 0x44, 0x00, 0x52, 0x00, 0x62, 0x00,
+  0x6c, 0x00, 0x75, 0x00, 0x7e, 0x00, 0x87, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x23, 0x00, 0x32, 0x00, 0x3f, 0x00, 0x51, 0x00, 0x5f, 0x00, 0x6f, 0x00,
+  0x77, 0x00, 0x7f, 0x00, 0x87, 0x00, 0x90, 0x00, 0x98, 0x00, 0xa0, 0x00,
+  0x00, 0x00, 0x14, 0x00, 0x22, 0x00, 0x35, 0x00, 0x44, 0x00, 0x50, 0x00,
+  0x5d, 0x00, 0x74, 0x00, 0x7b, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x1d, 0x00,
+  0x2f, 0x00, 0x43, 0x00, 0x53, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x11, 0x00,
+  0x22, 0x00, 0x2f, 0x00, 0x41, 0x00, 0x52, 0x00, 0x63, 0x00, 0x80, 0x00,
+  0x00, 0x00, 0x11, 0x00, 0x1c, 0x00, 0x28, 0x00, 0x34, 0x00, 0x43, 0x00,
+  0x53, 0x00, 0x5e, 0x00, 0x6a, 0x00, 0x78, 0x00, 0x00, 0x00, 0x1f, 0x00,
+  0x36, 0x00, 0x4d, 0x00, 0x59, 0x00, 0x6a, 0x00, 0x7a, 0x00, 0x88, 0x00,
+  0x91, 0x00, 0x9a, 0x00, 0xa3, 0x00, 0xb1, 0x00, 0xc0, 0x00, 0x00, 0x00,
+  0x25, 0x00, 0x37, 0x00, 0x43, 0x00, 0x5b, 0x00, 0x6c, 0x00, 0x79, 0x00,
+  0x87, 0x00, 0x93, 0x00, 0xa5, 0x00, 0xb2, 0x00, 0xbc, 0x00, 0xc6, 0x00,
+  0xd0, 0x00, 0xda, 0x00, 0xe4, 0x00, 0xee, 0x00, 0xf8, 0x00, 0x02, 0x01,
+  0x0c, 0x01, 0x16, 0x01, 0x20, 0x01, 0x2a, 0x01, 0x34, 0x01, 0x3e, 0x01,
+  0x48, 0x01, 0x52, 0x01, 0x5c, 0x01, 0x66, 0x01, 0x70, 0x01, 0x7a, 0x01,
+  0x84, 0x01, 0x8e, 0x01, 0x98, 0x01, 0xa2, 0x01, 0xac, 0x01, 0xb6, 0x01,
+  0xc0, 0x01, 0xca, 0x01, 0xd4, 0x01, 0x00, 0x00, 0x24, 0x00, 0x36, 0x00,
+  0x4f, 0x00, 0x78, 0x00, 0x85, 0x00, 0x91, 0x00, 0xa3, 0x00, 0xb1, 0x00,
+  0xba, 0x00, 0xc3, 0x00, 0xce, 0x00, 0xd9, 0x00, 0xe4, 0x00, 0xef, 0x00,
+  0xfa, 0x00, 0x05, 0x01, 0x10, 0x01, 0x1b, 0x01, 0x26, 0x01, 0x31, 0x01,
+  0x3c, 0x01, 0x47, 0x01, 0x52, 0x01, 0x5d, 0x01, 0x66, 0x01, 0x6f, 0x01,
+  0x00, 0x00, 0x10, 0x00, 0x28, 0x00, 0x50, 0x00, 0x5d, 0x00, 0x6e, 0x00,
+  0x8a, 0x00, 0x91, 0x00, 0x98, 0x00, 0xa5, 0x00, 0xac, 0x00, 0xb4, 0x00,
+  0xbc, 0x00, 0x00, 0x00, 0x29, 0x00, 0x47, 0x00, 0x67, 0x00, 0x8a, 0x00,
+  0xa8, 0x00, 0xce, 0x00, 0xef, 0x00, 0x15, 0x01, 0x34, 0x01, 0x4c, 0x01,
+  0x5a, 0x01, 0x7e, 0x01, 0x95, 0x01, 0xad, 0x01, 0xbe, 0x01, 0xd0, 0x01,
+  0xdb, 0x01, 0xe6, 0x01, 0xee, 0x01, 0xf6, 0x01, 0xfe, 0x01, 0x04, 0x02,
+  0x0a, 0x02, 0x13, 0x02, 0x00, 0x00, 0x0e, 0x00, 0x1c, 0x00, 0x32, 0x00,
+  0x41, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x4b, 0x00, 0x6d, 0x00,
+  0x92, 0x00, 0xb2, 0x00, 0xda, 0x00, 0xfd, 0x00, 0x25, 0x01, 0x46, 0x01,
+  0x60, 0x01, 0x71, 0x01, 0x82, 0x01, 0x93, 0x01, 0xa6, 0x01, 0xbb, 0x01,
+  0xcd, 0x01, 0xd5, 0x01, 0xdd, 0x01, 0xe5, 0x01, 0xed, 0x01, 0xf5, 0x01,
+  0xfd, 0x01, 0x05, 0x02, 0x0d, 0x02, 0x15, 0x02, 0x1e, 0x02, 0x26, 0x02,
+  0x2e, 0x02, 0x36, 0x02, 0x3e, 0x02, 0x46, 0x02, 0x4e, 0x02, 0x56, 0x02,
+  0x5e, 0x02, 0x00, 0x00, 0x1e, 0x00, 0x2e, 0x00, 0x3a, 0x00, 0x4a, 0x00,
+  0x58, 0x00, 0x6d, 0x00, 0x7f, 0x00, 0x90, 0x00, 0x00, 0x00, 0x0f, 0x00,
+  0x1d, 0x00, 0x44, 0x00, 0x53, 0x00, 0x64, 0x00, 0x76, 0x00, 0x7e, 0x00,
+  0x86, 0x00, 0x8e, 0x00, 0x95, 0x00, 0x9d, 0x00, 0xa5, 0x00, 0xad, 0x00,
+  0xb5, 0x00, 0xbd, 0x00, 0xc5, 0x00, 0xcd, 0x00, 0xd5, 0x00, 0xdd, 0x00,
+  0xe8, 0x00, 0x00, 0x00, 0x10, 0x00, 0x24, 0x00, 0x4c, 0x00, 0x5d, 0x00,
+  0x6e, 0x00, 0x7e, 0x00, 0x8a, 0x00, 0x96, 0x00, 0x00, 0x00, 0x15, 0x00,
+  0x24, 0x00, 0x45, 0x00, 0x64, 0x00, 0x79, 0x00, 0x96, 0x00, 0xa6, 0x00,
+  0xb5, 0x00, 0xbe, 0x00, 0xc7, 0x00, 0xd0, 0x00, 0xd8, 0x00, 0xe0, 0x00,
+  0xe8, 0x00, 0xf4, 0x00, 0xfe, 0x00, 0x06, 0x01, 0x0e, 0x01, 0x17, 0x01,
+  0x20, 0x01, 0x2c, 0x01, 0x35, 0x01, 0x3d, 0x01, 0x45, 0x01, 0x4d, 0x01,
+  0x00, 0x00, 0x12, 0x00, 0x22, 0x00, 0x31, 0x00, 0x40, 0x00, 0x53, 0x00,
+  0x6c, 0x00, 0x79, 0x00, 0x87, 0x00, 0x90, 0x00, 0x99, 0x00, 0xa2, 0x00,
+  0xab, 0x00, 0xb4, 0x00, 0xc0, 0x00, 0xc9, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x2e, 0x00, 0x39, 0x00, 0x4f, 0x00, 0x5b, 0x00, 0x68, 0x00, 0x76, 0x00,
+  0x82, 0x00, 0x8f, 0x00, 0x9c, 0x00, 0xa9, 0x00, 0xb6, 0x00, 0xc2, 0x00,
+  0xce, 0x00, 0xda, 0x00, 0xe2, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x31, 0x00,
+  0x47, 0x00, 0x5b, 0x00, 0x6f, 0x00, 0x7d, 0x00, 0x8b, 0x00, 0x96, 0x00,
+  0xa1, 0x00, 0xac, 0x00, 0xb7, 0x00, 0xc2, 0x00, 0xcd, 0x00, 0xd8, 0x00,
+  0xe3, 0x00, 0xee, 0x00, 0xf9, 0x00, 0x04, 0x01, 0x0d, 0x01, 0x16, 0x01,
+  0x24, 0x01, 0x32, 0x01, 0x40, 0x01, 0x48, 0x01, 0x50, 0x01, 0x00, 0x00,
+  0x0f, 0x00, 0x34, 0x00, 0x41, 0x00, 0x5a, 0x00, 0x66, 0x00, 0x75, 0x00,
+  0x83, 0x00, 0x94, 0x00, 0x9d, 0x00, 0xa9, 0x00, 0xb5, 0x00, 0xc1, 0x00,
+  0xcd, 0x00, 0xd9, 0x00, 0xe5, 0x00, 0xf4, 0x00, 0x03, 0x01, 0x12, 0x01,
+  0x21, 0x01, 0x30, 0x01, 0x39, 0x01, 0x42, 0x01, 0x4b, 0x01, 0x54, 0x01,
+  0x5d, 0x01, 0x66, 0x01, 0x70, 0x01, 0x79, 0x01, 0x82, 0x01, 0x8b, 0x01,
+  0x94, 0x01, 0x9d, 0x01, 0xa6, 0x01, 0xaf, 0x01, 0xb8, 0x01, 0xc1, 0x01,
+  0xca, 0x01, 0xd3, 0x01, 0xdc, 0x01, 0xe5, 0x01, 0xee, 0x01, 0xf7, 0x01,
+  0x00, 0x02, 0x09, 0x02, 0x12, 0x02, 0x1b, 0x02, 0x24, 0x02, 0x2d, 0x02,
+  0x36, 0x02, 0x3f, 0x02, 0x48, 0x02, 0x51, 0x02, 0x5a, 0x02, 0x63, 0x02,
+  0x6c, 0x02, 0x75, 0x02, 0x7e, 0x02, 0x87, 0x02, 0x90, 0x02, 0x99, 0x02,
+  0xa2, 0x02, 0xab, 0x02, 0xb4, 0x02, 0xbd, 0x02, 0xc6, 0x02, 0xcf, 0x02,
+  0xd8, 0x02, 0xe1, 0x02, 0xea, 0x02, 0xf3, 0x02, 0xfc, 0x02, 0x05, 0x03,
+  0x0f, 0x03, 0x19, 0x03, 0x22, 0x03, 0x00, 0x00, 0x10, 0x00, 0x31, 0x00,
+  0x3d, 0x00, 0x55, 0x00, 0x6d, 0x00, 0x7f, 0x00, 0x8a, 0x00, 0x92, 0x00,
+  0xa2, 0x00, 0xa9, 0x00, 0xb0, 0x00, 0x00, 0x00, 0x11, 0x00, 0x20, 0x00,
+  0x2c, 0x00, 0x3b, 0x00, 0x50, 0x00, 0x63, 0x00, 0x71, 0x00, 0x81, 0x00,
+  0x8e, 0x00, 0x9a, 0x00, 0xa7, 0x00, 0xb1, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x36, 0x00, 0x46, 0x00, 0x5e, 0x00, 0x73, 0x00, 0x84, 0x00, 0x97, 0x00,
+  0x00, 0x00, 0x20, 0x00, 0x46, 0x00, 0x56, 0x00, 0x63, 0x00, 0x75, 0x00,
+  0x7f, 0x00, 0x89, 0x00, 0x98, 0x00, 0xa7, 0x00, 0xb6, 0x00, 0xc5, 0x00,
+  0xd4, 0x00, 0xe3, 0x00, 0xf2, 0x00, 0x01, 0x01, 0x10, 0x01, 0x1f, 0x01,
+  0x00, 0x00, 0x11, 0x00, 0x31, 0x00, 0x3c, 0x00, 0x46, 0x00, 0x58, 0x00,
+  0x61, 0x00, 0x70, 0x00, 0x7f, 0x00, 0x8e, 0x00, 0x9d, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x3e, 0x00, 0x54, 0x00, 0x67, 0x00, 0x7d, 0x00, 0x88, 0x00,
+  0x93, 0x00, 0x9e, 0x00, 0xa7, 0x00, 0xb0, 0x00, 0xbc, 0x00, 0xc8, 0x00,
+  0xd4, 0x00, 0xe0, 0x00, 0xec, 0x00, 0xf8, 0x00, 0x01, 0x01, 0x0d, 0x01,
+  0x19, 0x01, 0x00, 0x00, 0x0f, 0x00, 0x26, 0x00, 0x46, 0x00, 0x5d, 0x00,
+  0x75, 0x00, 0x86, 0x00, 0x00, 0x00, 0x17, 0x00, 0x39, 0x00, 0x4b, 0x00,
+  0x5e, 0x00, 0x6f, 0x00, 0x81, 0x00, 0x89, 0x00, 0x91, 0x00, 0x99, 0x00,
+  0xa2, 0x00, 0xab, 0x00, 0xb3, 0x00, 0x00, 0x00, 0x19, 0x00, 0x50, 0x00,
+  0x69, 0x00, 0x7e, 0x00, 0x90, 0x00, 0xa2, 0x00, 0xa9, 0x00, 0xb6, 0x00,
+  0xbf, 0x00, 0xc8, 0x00, 0xd1, 0x00, 0x00, 0x00, 0x14, 0x00, 0x42, 0x00,
+  0x57, 0x00, 0x6a, 0x00, 0x75, 0x00, 0x8a, 0x00, 0x9e, 0x00, 0xa4, 0x00,
+  0xac, 0x00, 0xb4, 0x00, 0xbc, 0x00, 0xc2, 0x00, 0x00, 0x00, 0x20, 0x00,
+  0x2d, 0x00, 0x65, 0x00, 0x78, 0x00, 0x90, 0x00, 0xa2, 0x00, 0xb3, 0x00,
+  0xbc, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x16, 0x00, 0x2c, 0x00, 0x3c, 0x00,
+  0x4b, 0x00, 0x59, 0x00, 0x6a, 0x00, 0x79, 0x00, 0x8d, 0x00, 0x95, 0x00,
+  0x9d, 0x00, 0xa5, 0x00, 0xad, 0x00, 0xb5, 0x00, 0xbe, 0x00, 0xc7, 0x00,
+  0x00, 0x00, 0x1b, 0x00, 0x2c, 0x00, 0x3c, 0x00, 0x4d, 0x00, 0x5c, 0x00,
+  0x71, 0x00, 0x83, 0x00, 0x94, 0x00, 0x9f, 0x00, 0xab, 0x00, 0xb7, 0x00,
+  0xc3, 0x00, 0xcf, 0x00, 0xdb, 0x00, 0xe7, 0x00, 0xf3, 0x00, 0xff, 0x00,
+  0x0b, 0x01, 0x17, 0x01, 0x23, 0x01, 0x2f, 0x01, 0x3b, 0x01, 0x47, 0x01,
+  0x53, 0x01, 0x5f, 0x01, 0x6b, 0x01, 0x77, 0x01, 0x83, 0x01, 0x8f, 0x01,
+  0x9b, 0x01, 0xa8, 0x01, 0xb5, 0x01, 0xc2, 0x01, 0xcf, 0x01, 0xdc, 0x01,
+  0xe9, 0x01, 0xf6, 0x01, 0x03, 0x02, 0x10, 0x02, 0x1d, 0x02, 0x2a, 0x02,
+  0x37, 0x02, 0x44, 0x02, 0x50, 0x02, 0x59, 0x02, 0x62, 0x02, 0x00, 0x00,
+  0x19, 0x00, 0x2a, 0x00, 0x3a, 0x00, 0x4a, 0x00, 0x57, 0x00, 0x62, 0x00,
+  0x76, 0x00, 0x83, 0x00, 0x90, 0x00, 0x9d, 0x00, 0xaa, 0x00, 0xb7, 0x00,
+  0xc5, 0x00, 0xd3, 0x00, 0xe1, 0x00, 0xe8, 0x00, 0xef, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x22, 0x00, 0x38, 0x00, 0x44, 0x00, 0x53, 0x00, 0x64, 0x00,
+  0x73, 0x00, 0x7d, 0x00, 0x87, 0x00, 0x91, 0x00, 0x9b, 0x00, 0xa5, 0x00,
+  0xaf, 0x00, 0xb8, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1d, 0x00, 0x2f, 0x00,
+  0x3d, 0x00, 0x4e, 0x00, 0x5f, 0x00, 0x67, 0x00, 0x76, 0x00, 0x7e, 0x00,
+  0x00, 0x00, 0x15, 0x00, 0x26, 0x00, 0x42, 0x00, 0x55, 0x00, 0x6c, 0x00,
+  0x7e, 0x00, 0x8a, 0x00, 0x96, 0x00, 0xa2, 0x00, 0xae, 0x00, 0xba, 0x00,
+  0xc6, 0x00, 0xd2, 0x00, 0xde, 0x00, 0xea, 0x00, 0xf6, 0x00, 0x02, 0x01,
+  0x0e, 0x01, 0x1a, 0x01, 0x26, 0x01, 0x36, 0x01, 0x42, 0x01, 0x4e, 0x01,
+  0x5a, 0x01, 0x00, 0x00, 0x16, 0x00, 0x28, 0x00, 0x3b, 0x00, 0x4a, 0x00,
+  0x68, 0x00, 0x7a, 0x00, 0x8c, 0x00, 0x94, 0x00, 0x9b, 0x00, 0xa8, 0x00,
+  0xb5, 0x00, 0xbd, 0x00, 0xc6, 0x00, 0xce, 0x00, 0xd4, 0x00, 0x00, 0x00,
+  0x21, 0x00, 0x34, 0x00, 0x43, 0x00, 0x53, 0x00, 0x6b, 0x00, 0x7c, 0x00,
+  0x8e, 0x00, 0x98, 0x00, 0x9f, 0x00, 0x00, 0x00, 0x15, 0x00, 0x24, 0x00,
+  0x3f, 0x00, 0x5b, 0x00, 0x6a, 0x00, 0x79, 0x00, 0x88, 0x00, 0x97, 0x00,
+  0xa6, 0x00, 0xb5, 0x00, 0xc4, 0x00, 0x00, 0x00, 0x15, 0x00, 0x2e, 0x00,
+  0x43, 0x00, 0x5f, 0x00, 0x69, 0x00, 0x72, 0x00, 0x7d, 0x00, 0x88, 0x00,
+  0x93, 0x00, 0x9e, 0x00, 0xa9, 0x00, 0xb4, 0x00, 0xbf, 0x00, 0xca, 0x00,
+  0xd5, 0x00, 0xe0, 0x00, 0xeb, 0x00, 0xf6, 0x00, 0x01, 0x01, 0x0c, 0x01,
+  0x17, 0x01, 0x22, 0x01, 0x2d, 0x01, 0x36, 0x01, 0x3f, 0x01, 0x48, 0x01,
+  0x51, 0x01, 0x5f, 0x01, 0x00, 0x00, 0x12, 0x00, 0x2d, 0x00, 0x3d, 0x00,
+  0x4c, 0x00, 0x53, 0x00, 0x5a, 0x00, 0x63, 0x00, 0x6c, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x24, 0x00, 0x41, 0x00, 0x58, 0x00, 0x76, 0x00, 0x84, 0x00,
+  0x8e, 0x00, 0x98, 0x00, 0xa1, 0x00, 0xaa, 0x00, 0xb3, 0x00, 0xbc, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x19, 0x00, 0x2c, 0x00, 0x4d, 0x00, 0x66, 0x00,
+  0x6f, 0x00, 0x00, 0x00, 0x13, 0x00, 0x1e, 0x00, 0x37, 0x00, 0x52, 0x00,
+  0x5b, 0x00, 0x64, 0x00, 0x00, 0x00, 0x15, 0x00, 0x2e, 0x00, 0x46, 0x00,
+  0x61, 0x00, 0x74, 0x00, 0x80, 0x00, 0x8c, 0x00, 0x93, 0x00, 0x00, 0x00,
+  0x15, 0x00, 0x23, 0x00, 0x40, 0x00, 0x53, 0x00, 0x66, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x22, 0x00, 0x37, 0x00, 0x42, 0x00, 0x50, 0x00, 0x68, 0x00,
+  0x73, 0x00, 0x7c, 0x00, 0x85, 0x00, 0x8e, 0x00, 0x97, 0x00, 0xa0, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x32, 0x00, 0x45, 0x00, 0x52, 0x00, 0x60, 0x00,
+  0x6d, 0x00, 0x7a, 0x00, 0x87, 0x00, 0x94, 0x00, 0xa0, 0x00, 0xac, 0x00,
+  0xb8, 0x00, 0xc4, 0x00, 0xd0, 0x00, 0xdc, 0x00, 0xe8, 0x00, 0xf4, 0x00,
+  0x00, 0x01, 0x0c, 0x01, 0x00, 0x00, 0x0f, 0x00, 0x27, 0x00, 0x36, 0x00,
+  0x4d, 0x00, 0x64, 0x00, 0x6b, 0x00, 0x77, 0x00, 0x83, 0x00, 0x90, 0x00,
+  0x9d, 0x00, 0xab, 0x00, 0xbb, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x2b, 0x00,
+  0x3a, 0x00, 0x48, 0x00, 0x5e, 0x00, 0x68, 0x00, 0x73, 0x00, 0x82, 0x00,
+  0x8b, 0x00, 0x94, 0x00, 0x9d, 0x00, 0xa6, 0x00, 0x00, 0x00, 0x20, 0x00,
+  0x30, 0x00, 0x53, 0x00, 0x5d, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x26, 0x00,
+  0x38, 0x00, 0x4c, 0x00, 0x5c, 0x00, 0x69, 0x00, 0x79, 0x00, 0x86, 0x00,
+  0x93, 0x00, 0xa0, 0x00, 0xad, 0x00, 0xba, 0x00, 0xc7, 0x00, 0xd4, 0x00,
+  0xe4, 0x00, 0xf4, 0x00, 0xfd, 0x00, 0x06, 0x01, 0x0f, 0x01, 0x18, 0x01,
+  0x21, 0x01, 0x2a, 0x01, 0x33, 0x01, 0x3c, 0x01, 0x45, 0x01, 0x4e, 0x01,
+  0x57, 0x01, 0x60, 0x01, 0x69, 0x01, 0x72, 0x01, 0x7b, 0x01, 0x84, 0x01,
+  0x8d, 0x01, 0x96, 0x01, 0x9f, 0x01, 0xa8, 0x01, 0xb1, 0x01, 0xba, 0x01,
+  0xc3, 0x01, 0xcc, 0x01, 0xd5, 0x01, 0xde, 0x01, 0xe7, 0x01, 0xf0, 0x01,
+  0xf9, 0x01, 0x02, 0x02, 0x0b, 0x02, 0x14, 0x02, 0x1d, 0x02, 0x26, 0x02,
+  0x2f, 0x02, 0x38, 0x02, 0x41, 0x02, 0x4a, 0x02, 0x53, 0x02, 0x5c, 0x02,
+  0x65, 0x02, 0x6e, 0x02, 0x77, 0x02, 0x80, 0x02, 0x89, 0x02, 0x92, 0x02,
+  0x9b, 0x02, 0xa4, 0x02, 0xad, 0x02, 0xb6, 0x02, 0xbf, 0x02, 0xc8, 0x02,
+  0xd1, 0x02, 0x00, 0x00, 0x18, 0x00, 0x3f, 0x00, 0x4f, 0x00, 0x5f, 0x00,
+  0x6d, 0x00, 0x80, 0x00, 0x93, 0x00, 0xa0, 0x00, 0xad, 0x00, 0xba, 0x00,
+  0xc8, 0x00, 0xd6, 0x00, 0xe4, 0x00, 0xf2, 0x00, 0x00, 0x01, 0x0e, 0x01,
+  0x1c, 0x01, 0x2a, 0x01, 0x38, 0x01, 0x46, 0x01, 0x54, 0x01, 0x5c, 0x01,
+  0x64, 0x01, 0x6c, 0x01, 0x00, 0x00, 0x18, 0x00, 0x2d, 0x00, 0x4e, 0x00,
+  0x5f, 0x00, 0x74, 0x00, 0x7e, 0x00, 0x8b, 0x00, 0x97, 0x00, 0xa3, 0x00,
+  0xaf, 0x00, 0x00, 0x00, 0x11, 0x00, 0x28, 0x00, 0x3c, 0x00, 0x50, 0x00,
+  0x5e, 0x00, 0x66, 0x00, 0x6e, 0x00, 0x78, 0x00, 0x83, 0x00, 0x8d, 0x00,
+  0x99, 0x00, 0xa4, 0x00, 0xaf, 0x00, 0xb9, 0x00, 0xc5, 0x00, 0xcf, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x28, 0x00, 0x3b, 0x00, 0x4c, 0x00, 0x55, 0x00,
+  0x5e, 0x00, 0x67, 0x00, 0x70, 0x00, 0x00, 0x00, 0x22, 0x00, 0x33, 0x00,
+  0x46, 0x00, 0x59, 0x00, 0x65, 0x00, 0x71, 0x00, 0x00, 0x00, 0x25, 0x00,
+  0x34, 0x00, 0x48, 0x00, 0x67, 0x00, 0x72, 0x00, 0x7d, 0x00, 0x88, 0x00,
+  0x93, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x21, 0x00, 0x2f, 0x00, 0x36, 0x00,
+  0x00, 0x00, 0x13, 0x00, 0x39, 0x00, 0x50, 0x00, 0x00, 0x00, 0x31, 0x00,
+  0x3d, 0x00, 0x5e, 0x00, 0x75, 0x00, 0x81, 0x00, 0x8a, 0x00, 0x95, 0x00,
+  0xa0, 0x00, 0xa9, 0x00, 0xb4, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x47, 0x00,
+  0x5e, 0x00, 0x71, 0x00, 0x7b, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x29, 0x00,
+  0x4a, 0x00, 0x5d, 0x00, 0x67, 0x00, 0x71, 0x00, 0x7d, 0x00, 0x86, 0x00,
+  0x8f, 0x00, 0x98, 0x00, 0xa1, 0x00, 0xa9, 0x00, 0xb2, 0x00, 0xbb, 0x00,
+  0x00, 0x00, 0x14, 0x00, 0x24, 0x00, 0x49, 0x00, 0x5b, 0x00, 0x67, 0x00,
+  0x73, 0x00, 0x7f, 0x00, 0x8b, 0x00, 0x97, 0x00, 0xa3, 0x00, 0xaf, 0x00,
+  0xbb, 0x00, 0xc8, 0x00, 0xd4, 0x00, 0xe1, 0x00, 0xea, 0x00, 0xf5, 0x00,
+  0x00, 0x01, 0x0b, 0x01, 0x16, 0x01, 0x21, 0x01, 0x00, 0x00, 0x11, 0x00,
+  0x23, 0x00, 0x49, 0x00, 0x63, 0x00, 0x70, 0x00, 0x7d, 0x00, 0x8a, 0x00,
+  0x97, 0x00, 0xa4, 0x00, 0xb2, 0x00, 0xc0, 0x00, 0xce, 0x00, 0x00, 0x00,
+  0x21, 0x00, 0x31, 0x00, 0x40, 0x00, 0x57, 0x00, 0x66, 0x00, 0x82, 0x00,
+  0x8c, 0x00, 0x96, 0x00, 0xa0, 0x00, 0xaa, 0x00, 0xb6, 0x00, 0xc5, 0x00,
+  0xd4, 0x00, 0xda, 0x00, 0xe3, 0x00, 0xec, 0x00, 0x00, 0x00, 0x15, 0x00,
+  0x2c, 0x00, 0x34, 0x00, 0x3d, 0x00, 0x46, 0x00, 0x56, 0x00, 0x60, 0x00,
+  0x6c, 0x00, 0x73, 0x00, 0x00, 0x00, 0x12, 0x00, 0x28, 0x00, 0x31, 0x00,
+  0x3a, 0x00, 0x43, 0x00, 0x4c, 0x00, 0x55, 0x00, 0x00, 0x00, 0x12, 0x00,
+  0x45, 0x00, 0x55, 0x00, 0x60, 0x00, 0x6c, 0x00, 0x75, 0x00, 0x7e, 0x00,
+  0x87, 0x00, 0x91, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x3a, 0x00, 0x49, 0x00,
+  0x53, 0x00, 0x5f, 0x00, 0x6b, 0x00, 0x77, 0x00, 0x83, 0x00, 0x8f, 0x00,
+  0x9b, 0x00, 0xa7, 0x00, 0xb3, 0x00, 0xbf, 0x00, 0xcb, 0x00, 0xd7, 0x00,
+  0xe3, 0x00, 0xef, 0x00, 0xfb, 0x00, 0x07, 0x01, 0x13, 0x01, 0x1f, 0x01,
+  0x2b, 0x01, 0x37, 0x01, 0x43, 0x01, 0x4f, 0x01, 0x5b, 0x01, 0x67, 0x01,
+  0x73, 0x01, 0x7f, 0x01, 0x87, 0x01, 0x8f, 0x01, 0x00, 0x00, 0x11, 0x00,
+  0x1f, 0x00, 0x37, 0x00, 0x41, 0x00, 0x4b, 0x00, 0x55, 0x00, 0x5f, 0x00,
+  0x69, 0x00, 0x73, 0x00, 0x7d, 0x00, 0x87, 0x00, 0x91, 0x00, 0x9b, 0x00,
+  0xa5, 0x00, 0xaf, 0x00, 0xb9, 0x00, 0xcb, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x25, 0x00, 0x2e, 0x00, 0x37, 0x00, 0x43, 0x00, 0x4f, 0x00, 0x5b, 0x00,
+  0x67, 0x00, 0x73, 0x00, 0x7f, 0x00, 0x8b, 0x00, 0x97, 0x00, 0xa3, 0x00,
+  0xaf, 0x00, 0xbb, 0x00, 0xc7, 0x00, 0xd3, 0x00, 0xdb, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x23, 0x00, 0x3b, 0x00, 0x44, 0x00, 0x4e, 0x00, 0x56, 0x00,
+  0x00, 0x00, 0x11, 0x00, 0x3a, 0x00, 0x45, 0x00, 0x4e, 0x00, 0x57, 0x00,
+  0x60, 0x00, 0x6a, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x2a, 0x00, 0x31, 0x00,
+  0x3a, 0x00, 0x00, 0x00, 0x11, 0x00, 0x29, 0x00, 0x32, 0x00, 0x3f, 0x00,
+  0x4c, 0x00, 0x59, 0x00, 0x62, 0x00, 0x6b, 0x00, 0x74, 0x00, 0x7d, 0x00,
+  0x86, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x31, 0x00, 0x3a, 0x00, 0x43, 0x00,
+  0x4c, 0x00, 0x55, 0x00, 0x5e, 0x00, 0x67, 0x00, 0x70, 0x00, 0x79, 0x00,
+  0x82, 0x00, 0x8b, 0x00, 0x94, 0x00, 0x9d, 0x00, 0xa6, 0x00, 0xaf, 0x00,
+  0xb8, 0x00, 0xc4, 0x00, 0xd0, 0x00, 0xd9, 0x00, 0xe2, 0x00, 0xeb, 0x00,
+  0xf7, 0x00, 0x01, 0x01, 0x0b, 0x01, 0x17, 0x01, 0x23, 0x01, 0x33, 0x01,
+  0x00, 0x00, 0x12, 0x00, 0x23, 0x00, 0x39, 0x00, 0x40, 0x00, 0x4c, 0x00,
+  0x58, 0x00, 0x64, 0x00, 0x70, 0x00, 0x7c, 0x00, 0x88, 0x00, 0x94, 0x00,
+  0xa0, 0x00, 0xac, 0x00, 0xb8, 0x00, 0xc4, 0x00, 0xd0, 0x00, 0xdc, 0x00,
+  0xe8, 0x00, 0xf4, 0x00, 0x00, 0x01, 0x0c, 0x01, 0x18, 0x01, 0x24, 0x01,
+  0x30, 0x01, 0x3c, 0x01, 0x48, 0x01, 0x54, 0x01, 0x60, 0x01, 0x6c, 0x01,
+  0x78, 0x01, 0x84, 0x01, 0x90, 0x01, 0x9c, 0x01, 0xa8, 0x01, 0xb4, 0x01,
+  0xc0, 0x01, 0xcc, 0x01, 0xd8, 0x01, 0xe4, 0x01, 0xf0, 0x01, 0xfc, 0x01,
+  0x08, 0x02, 0x14, 0x02, 0x20, 0x02, 0x2c, 0x02, 0x38, 0x02, 0x44, 0x02,
+  0x50, 0x02, 0x5c, 0x02, 0x68, 0x02, 0x74, 0x02, 0x80, 0x02, 0x8c, 0x02,
+  0x98, 0x02, 0xa4, 0x02, 0xb0, 0x02, 0xbc, 0x02, 0xc8, 0x02, 0xd4, 0x02,
+  0xe0, 0x02, 0xec, 0x02, 0xf8, 0x02, 0x04, 0x03, 0x10, 0x03, 0x1c, 0x03,
+  0x28, 0x03, 0x34, 0x03, 0x40, 0x03, 0x4c, 0x03, 0x58, 0x03, 0x64, 0x03,
+  0x70, 0x03, 0x7c, 0x03, 0x88, 0x03, 0x94, 0x03, 0xa0, 0x03, 0xac, 0x03,
+  0xb8, 0x03, 0xc4, 0x03, 0xd0, 0x03, 0xdc, 0x03, 0xe8, 0x03, 0xf4, 0x03,
+  0x00, 0x04, 0x0c, 0x04, 0x18, 0x04, 0x24, 0x04, 0x30, 0x04, 0x3c, 0x04,
+  0x48, 0x04, 0x54, 0x04, 0x60, 0x04, 0x6c, 0x04, 0x78, 0x04, 0x84, 0x04,
+  0x90, 0x04, 0x9c, 0x04, 0xa8, 0x04, 0xb4, 0x04, 0xc0, 0x04, 0xcc, 0x04,
+  0xd8, 0x04, 0xe4, 0x04, 0xf0, 0x04, 0xfc, 0x04, 0x08, 0x05, 0x14, 0x05,
+  0x20, 0x05, 0x2c, 0x05, 0x38, 0x05, 0x41, 0x05, 0x4a, 0x05, 0x55, 0x05,
+  0x00, 0x00, 0x10, 0x00, 0x20, 0x00, 0x34, 0x00, 0x3d, 0x00, 0x49, 0x00,
+  0x55, 0x00, 0x61, 0x00, 0x68, 0x00, 0x6f, 0x00, 0x76, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x21, 0x00, 0x38, 0x00, 0x47, 0x00, 0x54, 0x00, 0x61, 0x00,
+  0x6e, 0x00, 0x7b, 0x00, 0x84, 0x00, 0x8d, 0x00, 0x96, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x27, 0x00, 0x3e, 0x00, 0x47, 0x00, 0x51, 0x00, 0x5a, 0x00,
+  0x66, 0x00, 0x72, 0x00, 0x7e, 0x00, 0x8a, 0x00, 0x96, 0x00, 0xa2, 0x00,
+  0xae, 0x00, 0xba, 0x00, 0xc6, 0x00, 0xd2, 0x00, 0xde, 0x00, 0xe7, 0x00,
+  0xf3, 0x00, 0xfc, 0x00, 0x05, 0x01, 0x13, 0x01, 0x21, 0x01, 0x2f, 0x01,
+  0x3d, 0x01, 0x4b, 0x01, 0x59, 0x01, 0x67, 0x01, 0x71, 0x01, 0x7f, 0x01,
+  0x89, 0x01, 0x91, 0x01, 0x9d, 0x01, 0x00, 0x00, 0x14, 0x00, 0x28, 0x00,
+  0x3c, 0x00, 0x50, 0x00, 0x64, 0x00, 0x78, 0x00, 0x8c, 0x00, 0xa0, 0x00,
+  0xb4, 0x00, 0xd1, 0x00, 0xe3, 0x00, 0xf7, 0x00, 0x01, 0x01, 0x0b, 0x01,
+  0x15, 0x01, 0x1f, 0x01, 0x28, 0x01, 0x31, 0x01, 0x3a, 0x01, 0x40, 0x01,
+  0x4b, 0x01, 0x55, 0x01, 0x00, 0x00, 0x10, 0x00, 0x24, 0x00, 0x2c, 0x00,
+  0x38, 0x00, 0x00, 0x00, 0x11, 0x00, 0x2e, 0x00, 0x3d, 0x00, 0x4c, 0x00,
+  0x5b, 0x00, 0x64, 0x00, 0x6d, 0x00, 0x76, 0x00, 0x7f, 0x00, 0x88, 0x00,
+  0x91, 0x00, 0x9a, 0x00, 0xa3, 0x00, 0xac, 0x00, 0xb5, 0x00, 0xbe, 0x00,
+  0xc7, 0x00, 0xd0, 0x00, 0xd9, 0x00, 0xe2, 0x00, 0xeb, 0x00, 0xf4, 0x00,
+  0xfd, 0x00, 0x06, 0x01, 0x0f, 0x01, 0x1c, 0x01, 0x29, 0x01, 0x36, 0x01,
+  0x43, 0x01, 0x50, 0x01, 0x5d, 0x01, 0x6a, 0x01, 0x77, 0x01, 0x84, 0x01,
+  0x91, 0x01, 0x9e, 0x01, 0xab, 0x01, 0xb8, 0x01, 0xc5, 0x01, 0xd2, 0x01,
+  0xdf, 0x01, 0xec, 0x01, 0xf8, 0x01, 0x04, 0x02, 0x10, 0x02, 0x1c, 0x02,
+  0x28, 0x02, 0x34, 0x02, 0x3b, 0x02, 0x00, 0x00, 0x11, 0x00, 0x21, 0x00,
+  0x3a, 0x00, 0x43, 0x00, 0x4f, 0x00, 0x5b, 0x00, 0x64, 0x00, 0x6d, 0x00,
+  0x76, 0x00, 0x7f, 0x00, 0x8d, 0x00, 0x9b, 0x00, 0xa9, 0x00, 0xb1, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x1f, 0x00, 0x38, 0x00, 0x51, 0x00, 0x5d, 0x00,
+  0x66, 0x00, 0x6c, 0x00, 0x72, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x16, 0x00,
+  0x1e, 0x00, 0x27, 0x00, 0x34, 0x00, 0x41, 0x00, 0x4b, 0x00, 0x54, 0x00,
+  0x5d, 0x00, 0x64, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x16, 0x00, 0x1f, 0x00,
+  0x28, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x30, 0x00, 0x47, 0x00, 0x4d, 0x00,
+  0x53, 0x00, 0x5c, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x77, 0x00, 0x80, 0x00,
+  0x00, 0x00, 0x0b, 0x00, 0x1d, 0x00, 0x26, 0x00, 0x00, 0x00, 0x19, 0x00,
+  0x26, 0x00, 0x38, 0x00, 0x43, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x12, 0x00,
+  0x1b, 0x00, 0x24, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x29, 0x00,
+  0x32, 0x00, 0x3b, 0x00, 0x46, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x2d, 0x00,
+  0x36, 0x00, 0x3f, 0x00, 0x48, 0x00, 0x51, 0x00, 0x5a, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x28, 0x00, 0x48, 0x00, 0x4f, 0x00, 0x59, 0x00, 0x63, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x20, 0x00, 0x2d, 0x00, 0x3a, 0x00, 0x47, 0x00,
+  0x54, 0x00, 0x61, 0x00, 0x6d, 0x00, 0x76, 0x00, 0x7f, 0x00, 0x88, 0x00,
+  0x93, 0x00, 0x9e, 0x00, 0xa9, 0x00, 0xb3, 0x00, 0xbd, 0x00, 0xc8, 0x00,
+  0xd3, 0x00, 0xde, 0x00, 0xe9, 0x00, 0x00, 0x00, 0x16, 0x00, 0x33, 0x00,
+  0x39, 0x00, 0x43, 0x00, 0x4f, 0x00, 0x58, 0x00, 0x61, 0x00, 0x6b, 0x00,
+  0x75, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x10, 0x00, 0x20, 0x00, 0x34, 0x00,
+  0x3e, 0x00, 0x48, 0x00, 0x4f, 0x00, 0x5a, 0x00, 0x65, 0x00, 0x70, 0x00,
+  0x7d, 0x00, 0x8a, 0x00, 0x97, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x25, 0x00,
+  0x3a, 0x00, 0x44, 0x00, 0x53, 0x00, 0x62, 0x00, 0x71, 0x00, 0x80, 0x00,
+  0x8f, 0x00, 0x9e, 0x00, 0xad, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x27, 0x00,
+  0x36, 0x00, 0x3f, 0x00, 0x4c, 0x00, 0x59, 0x00, 0x66, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x26, 0x00, 0x3a, 0x00, 0x4d, 0x00, 0x56, 0x00, 0x5f, 0x00,
+  0x68, 0x00, 0x71, 0x00, 0x7a, 0x00, 0x88, 0x00, 0x96, 0x00, 0xa4, 0x00,
+  0xb2, 0x00, 0xc0, 0x00, 0xcd, 0x00, 0xdb, 0x00, 0xe9, 0x00, 0xf7, 0x00,
+  0x00, 0x00, 0x11, 0x00, 0x20, 0x00, 0x3c, 0x00, 0x49, 0x00, 0x50, 0x00,
+  0x5c, 0x00, 0x6b, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x13, 0x00,
+  0x1a, 0x00, 0x00, 0x00, 0x12, 0x00, 0x1c, 0x00, 0x29, 0x00, 0x35, 0x00,
+  0x42, 0x00, 0x4e, 0x00, 0x5e, 0x00, 0x6e, 0x00, 0x7a, 0x00, 0x86, 0x00,
+  0x92, 0x00, 0x9e, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x09, 0x00, 0x12, 0x00,
+  0x1b, 0x00, 0x24, 0x00, 0x2d, 0x00, 0x37, 0x00, 0x46, 0x00, 0x4e, 0x00,
+  0x00, 0x00, 0x07, 0x00, 0x12, 0x00, 0x1e, 0x00, 0x2a, 0x00, 0x36, 0x00,
+  0x42, 0x00, 0x4e, 0x00, 0x5a, 0x00, 0x66, 0x00, 0x70, 0x00, 0x7a, 0x00,
+  0x84, 0x00, 0x8e, 0x00, 0x98, 0x00, 0x00, 0x00, 0x07, 0x00, 0x14, 0x00,
+  0x21, 0x00, 0x2e, 0x00, 0x3b, 0x00, 0x48, 0x00, 0x55, 0x00, 0x62, 0x00,
+  0x6f, 0x00, 0x7c, 0x00, 0x83, 0x00, 0x8a, 0x00, 0x91, 0x00, 0x98, 0x00,
+  0x00, 0x00, 0x13, 0x00, 0x1c, 0x00, 0x25, 0x00, 0x2e, 0x00, 0x38, 0x00,
+  0x41, 0x00, 0x48, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x26, 0x00, 0x2c, 0x00,
+  0x38, 0x00, 0x44, 0x00, 0x4e, 0x00, 0x58, 0x00, 0x60, 0x00, 0x68, 0x00,
+  0x70, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x18, 0x00, 0x24, 0x00, 0x33, 0x00,
+  0x3f, 0x00, 0x4b, 0x00, 0x57, 0x00, 0x63, 0x00, 0x6f, 0x00, 0x7b, 0x00,
+  0x87, 0x00, 0x93, 0x00, 0x9f, 0x00, 0xab, 0x00, 0xb7, 0x00, 0xc3, 0x00,
+  0xcf, 0x00, 0xdb, 0x00, 0xe7, 0x00, 0xf3, 0x00, 0xff, 0x00, 0x0b, 0x01,
+  0x17, 0x01, 0x23, 0x01, 0x2f, 0x01, 0x3b, 0x01, 0x47, 0x01, 0x00, 0x00,
+  0x13, 0x00, 0x1a, 0x00, 0x21, 0x00, 0x28, 0x00, 0x35, 0x00, 0x42, 0x00,
+  0x4f, 0x00, 0x5c, 0x00, 0x69, 0x00, 0x70, 0x00, 0x77, 0x00, 0x7e, 0x00,
+  0x00, 0x00, 0x26, 0x00, 0x35, 0x00, 0x3e, 0x00, 0x47, 0x00, 0x50, 0x00,
+  0x59, 0x00, 0x62, 0x00, 0x70, 0x00, 0x7d, 0x00, 0x8a, 0x00, 0x97, 0x00,
+  0x00, 0x00, 0x15, 0x00, 0x22, 0x00, 0x36, 0x00, 0x44, 0x00, 0x50, 0x00,
+  0x5c, 0x00, 0x68, 0x00, 0x74, 0x00, 0x80, 0x00, 0x8c, 0x00, 0x00, 0x00,
+  0x1d, 0x00, 0x31, 0x00, 0x45, 0x00, 0x59, 0x00, 0x72, 0x00, 0x7b, 0x00,
+  0x86, 0x00, 0x91, 0x00, 0x00, 0x00, 0x10, 0x00, 0x1d, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x19, 0x00, 0x22, 0x00, 0x31, 0x00, 0x3a, 0x00, 0x43, 0x00,
+  0x4c, 0x00, 0x55, 0x00, 0x5e, 0x00, 0x67, 0x00, 0x70, 0x00, 0x79, 0x00,
+  0x85, 0x00, 0x92, 0x00, 0x9f, 0x00, 0xac, 0x00, 0xb9, 0x00, 0xc6, 0x00,
+  0xd3, 0x00, 0xe0, 0x00, 0xed, 0x00, 0xfa, 0x00, 0x07, 0x01, 0x00, 0x00,
+  0x0e, 0x00, 0x18, 0x00, 0x26, 0x00, 0x34, 0x00, 0x42, 0x00, 0x50, 0x00,
+  0x5e, 0x00, 0x6c, 0x00, 0x7a, 0x00, 0x88, 0x00, 0x91, 0x00, 0x9e, 0x00,
+  0xac, 0x00, 0xba, 0x00, 0xc8, 0x00, 0xd6, 0x00, 0x00, 0x00, 0x12, 0x00,
+  0x1b, 0x00, 0x24, 0x00, 0x2d, 0x00, 0x36, 0x00, 0x45, 0x00, 0x54, 0x00,
+  0x63, 0x00, 0x72, 0x00, 0x81, 0x00, 0x90, 0x00, 0x9f, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x22, 0x00, 0x29, 0x00, 0x38, 0x00, 0x3f, 0x00, 0x46, 0x00,
+  0x00, 0x00, 0x14, 0x00, 0x23, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x15, 0x00,
+  0x1b, 0x00, 0x27, 0x00, 0x33, 0x00, 0x3f, 0x00, 0x4b, 0x00, 0x56, 0x00,
+  0x5f, 0x00, 0x00, 0x00, 0x14, 0x00, 0x1b, 0x00, 0x24, 0x00, 0x2d, 0x00,
+  0x36, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x19, 0x00, 0x23, 0x00, 0x2d, 0x00,
+  0x00, 0x00, 0x1a, 0x00, 0x2a, 0x00, 0x39, 0x00, 0x45, 0x00, 0x4d, 0x00,
+  0x55, 0x00, 0x5d, 0x00, 0x65, 0x00, 0x6d, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x12, 0x00, 0x1e, 0x00, 0x2b, 0x00, 0x35, 0x00, 0x3f, 0x00, 0x49, 0x00,
+  0x00, 0x00, 0x18, 0x00, 0x3c, 0x00, 0x4f, 0x00, 0x58, 0x00, 0x61, 0x00,
+  0x6a, 0x00, 0x73, 0x00, 0x7c, 0x00, 0x85, 0x00, 0x8e, 0x00, 0x97, 0x00,
+  0xa0, 0x00, 0xa9, 0x00, 0xb2, 0x00, 0xbb, 0x00, 0xc4, 0x00, 0xcd, 0x00,
+  0xd6, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x34, 0x00, 0x3c, 0x00, 0x44, 0x00,
+  0x4f, 0x00, 0x5a, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x18, 0x00,
+  0x47, 0x00, 0x54, 0x00, 0x5f, 0x00, 0x6a, 0x00, 0x75, 0x00, 0x82, 0x00,
+  0x8f, 0x00, 0x9c, 0x00, 0xa9, 0x00, 0xb6, 0x00, 0xc3, 0x00, 0xd0, 0x00,
+  0xdd, 0x00, 0xea, 0x00, 0xf7, 0x00, 0x04, 0x01, 0x11, 0x01, 0x1e, 0x01,
+  0x2b, 0x01, 0x38, 0x01, 0x45, 0x01, 0x52, 0x01, 0x5a, 0x01, 0x00, 0x00,
+  0x1c, 0x00, 0x35, 0x00, 0x43, 0x00, 0x4f, 0x00, 0x5b, 0x00, 0x64, 0x00,
+  0x6d, 0x00, 0x77, 0x00, 0x7e, 0x00, 0x87, 0x00, 0x91, 0x00, 0x9b, 0x00,
+  0x00, 0x00, 0x20, 0x00, 0x3f, 0x00, 0x54, 0x00, 0x5c, 0x00, 0x6b, 0x00,
+  0x74, 0x00, 0x80, 0x00, 0x8c, 0x00, 0x94, 0x00, 0x9f, 0x00, 0xaa, 0x00,
+  0xb5, 0x00, 0xc0, 0x00, 0xcb, 0x00, 0x00, 0x00, 0x16, 0x00, 0x31, 0x00,
+  0x44, 0x00, 0x4f, 0x00, 0x5a, 0x00, 0x65, 0x00, 0x70, 0x00, 0x7b, 0x00,
+  0x86, 0x00, 0x8f, 0x00, 0x98, 0x00, 0xa1, 0x00, 0xaa, 0x00, 0xb3, 0x00,
+  0xc0, 0x00, 0x00, 0x00, 0x16, 0x00, 0x31, 0x00, 0x3d, 0x00, 0x49, 0x00,
+  0x55, 0x00, 0x61, 0x00, 0x6d, 0x00, 0x79, 0x00, 0x85, 0x00, 0x91, 0x00,
+  0x9d, 0x00, 0xa9, 0x00, 0xb5, 0x00, 0xc1, 0x00, 0xcd, 0x00, 0xd9, 0x00,
+  0xe5, 0x00, 0xf1, 0x00, 0xfd, 0x00, 0x09, 0x01, 0x14, 0x01, 0x1f, 0x01,
+  0x2a, 0x01, 0x35, 0x01, 0x3d, 0x01, 0x45, 0x01, 0x00, 0x00, 0x0f, 0x00,
+  0x16, 0x00, 0x1d, 0x00, 0x2a, 0x00, 0x33, 0x00, 0x3c, 0x00, 0x45, 0x00,
+  0x4e, 0x00, 0x57, 0x00, 0x5e, 0x00, 0x68, 0x00, 0x72, 0x00, 0x7c, 0x00,
+  0x86, 0x00, 0x90, 0x00, 0x9a, 0x00, 0xa4, 0x00, 0xae, 0x00, 0xb8, 0x00,
+  0x00, 0x00, 0x3e, 0x00, 0x56, 0x00, 0x61, 0x00, 0x68, 0x00, 0x00, 0x00,
+  0x17, 0x00, 0x3d, 0x00, 0x55, 0x00, 0x63, 0x00, 0x75, 0x00, 0x88, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x4b, 0x00, 0x65, 0x00, 0x75, 0x00,
+  0x80, 0x00, 0x9d, 0x00, 0xa6, 0x00, 0xaf, 0x00, 0xb8, 0x00, 0xc1, 0x00,
+  0xca, 0x00, 0xd3, 0x00, 0xdc, 0x00, 0x00, 0x00, 0x18, 0x00, 0x32, 0x00,
+  0x44, 0x00, 0x5b, 0x00, 0x78, 0x00, 0x7f, 0x00, 0x89, 0x00, 0x93, 0x00,
+  0x9d, 0x00, 0xa4, 0x00, 0xae, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x23, 0x00,
+  0x41, 0x00, 0x00, 0x00, 0x23, 0x00, 0x34, 0x00, 0x44, 0x00, 0x5c, 0x00,
+  0x69, 0x00, 0x76, 0x00, 0x83, 0x00, 0x8f, 0x00, 0x98, 0x00, 0xa1, 0x00,
+  0xaa, 0x00, 0xb3, 0x00, 0xbc, 0x00, 0xc5, 0x00, 0xce, 0x00, 0x00, 0x00,
+  0x16, 0x00, 0x21, 0x00, 0x33, 0x00, 0x46, 0x00, 0x4f, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x1d, 0x00, 0x37, 0x00, 0x3e, 0x00, 0x47, 0x00, 0x50, 0x00,
+  0x5c, 0x00, 0x00, 0x00, 0x19, 0x00, 0x28, 0x00, 0x40, 0x00, 0x4a, 0x00,
+  0x51, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x16, 0x00, 0x1f, 0x00,
+  0x28, 0x00, 0x31, 0x00, 0x3a, 0x00, 0x43, 0x00, 0x4c, 0x00, 0x53, 0x00,
+  0x5c, 0x00, 0x63, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x19, 0x00, 0x00, 0x00,
+  0x1e, 0x00, 0x2d, 0x00, 0x3c, 0x00, 0x48, 0x00, 0x54, 0x00, 0x00, 0x00,
+  0x21, 0x00, 0x36, 0x00, 0x47, 0x00, 0x50, 0x00, 0x00, 0x00, 0x13, 0x00,
+  0x1e, 0x00, 0x29, 0x00, 0x34, 0x00, 0x00, 0x00, 0x19, 0x00, 0x26, 0x00,
+  0x32, 0x00, 0x3e, 0x00, 0x4a, 0x00, 0x56, 0x00, 0x62, 0x00, 0x7c, 0x00,
+  0x87, 0x00, 0x8f, 0x00, 0x96, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x26, 0x00,
+  0x32, 0x00, 0x3c, 0x00, 0x46, 0x00, 0x50, 0x00, 0x5a, 0x00, 0x64, 0x00,
+  0x6e, 0x00, 0x78, 0x00, 0x82, 0x00, 0x8c, 0x00, 0x96, 0x00, 0xa0, 0x00,
+  0xaa, 0x00, 0xb4, 0x00, 0xbe, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x11, 0x00,
+  0x19, 0x00, 0x21, 0x00, 0x2e, 0x00, 0x36, 0x00, 0x3e, 0x00, 0x47, 0x00,
+  0x50, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1b, 0x00, 0x2c, 0x00, 0x53, 0x00,
+  0x5a, 0x00, 0x65, 0x00, 0x70, 0x00, 0x7b, 0x00, 0x00, 0x00, 0x18, 0x00,
+  0x22, 0x00, 0x2f, 0x00, 0x3f, 0x00, 0x58, 0x00, 0x64, 0x00, 0x70, 0x00,
+  0x78, 0x00, 0x83, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1e, 0x00, 0x34, 0x00,
+  0x48, 0x00, 0x54, 0x00, 0x5f, 0x00, 0x6a, 0x00, 0x74, 0x00, 0x7e, 0x00,
+  0x88, 0x00, 0x92, 0x00, 0x9c, 0x00, 0xa6, 0x00, 0xb0, 0x00, 0xba, 0x00,
+  0xc4, 0x00, 0xce, 0x00, 0xd8, 0x00, 0xe2, 0x00, 0xec, 0x00, 0xf6, 0x00,
+  0x00, 0x01, 0x0a, 0x01, 0x14, 0x01, 0x1e, 0x01, 0x28, 0x01, 0x32, 0x01,
+  0x3c, 0x01, 0x46, 0x01, 0x50, 0x01, 0x5a, 0x01, 0x64, 0x01, 0x6e, 0x01,
+  0x75, 0x01, 0x00, 0x00, 0x1a, 0x00, 0x2f, 0x00, 0x3b, 0x00, 0x4a, 0x00,
+  0x66, 0x00, 0x7c, 0x00, 0x88, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x28, 0x00,
+  0x3c, 0x00, 0x49, 0x00, 0x5f, 0x00, 0x69, 0x00, 0x00, 0x00, 0x1b, 0x00,
+  0x3c, 0x00, 0x4f, 0x00, 0x5c, 0x00, 0x6d, 0x00, 0x88, 0x00, 0x91, 0x00,
+  0x9a, 0x00, 0xa8, 0x00, 0xb6, 0x00, 0xc4, 0x00, 0xd2, 0x00, 0xe0, 0x00,
+  0xee, 0x00, 0xfc, 0x00, 0x08, 0x01, 0x10, 0x01, 0x18, 0x01, 0x00, 0x00,
+  0x1a, 0x00, 0x31, 0x00, 0x4a, 0x00, 0x57, 0x00, 0x67, 0x00, 0x74, 0x00,
+  0x89, 0x00, 0x8f, 0x00, 0x9c, 0x00, 0xac, 0x00, 0xb9, 0x00, 0xc6, 0x00,
+  0xd3, 0x00, 0xdd, 0x00, 0xe7, 0x00, 0xf0, 0x00, 0xfa, 0x00, 0x01, 0x01,
+  0x00, 0x00, 0x2e, 0x00, 0x48, 0x00, 0x66, 0x00, 0x89, 0x00, 0x9a, 0x00,
+  0xaa, 0x00, 0xbc, 0x00, 0xd3, 0x00, 0xdd, 0x00, 0xe7, 0x00, 0xf1, 0x00,
+  0xfb, 0x00, 0x05, 0x01, 0x0f, 0x01, 0x00, 0x00, 0x1f, 0x00, 0x4f, 0x00,
+  0x64, 0x00, 0x76, 0x00, 0x89, 0x00, 0xa7, 0x00, 0xaf, 0x00, 0xc4, 0x00,
+  0xcf, 0x00, 0xda, 0x00, 0xe5, 0x00, 0xf0, 0x00, 0xfb, 0x00, 0x06, 0x01,
+  0x0f, 0x01, 0x00, 0x00, 0x1a, 0x00, 0x34, 0x00, 0x4e, 0x00, 0x5a, 0x00,
+  0x6c, 0x00, 0x7e, 0x00, 0x96, 0x00, 0xa1, 0x00, 0x00, 0x00, 0x19, 0x00,
+  0x39, 0x00, 0x47, 0x00, 0x53, 0x00, 0x64, 0x00, 0x7e, 0x00, 0x8b, 0x00,
+  0x95, 0x00, 0x00, 0x00, 0x17, 0x00, 0x34, 0x00, 0x4e, 0x00, 0x59, 0x00,
+  0x6a, 0x00, 0x7d, 0x00, 0x8b, 0x00, 0x93, 0x00, 0x9b, 0x00, 0xab, 0x00,
+  0xb3, 0x00, 0xbe, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x34, 0x00, 0x51, 0x00,
+  0x6d, 0x00, 0x82, 0x00, 0x93, 0x00, 0xa1, 0x00, 0xba, 0x00, 0xc5, 0x00,
+  0xd0, 0x00, 0xdb, 0x00, 0xe6, 0x00, 0xf1, 0x00, 0xfe, 0x00, 0x0a, 0x01,
+  0x00, 0x00, 0x2a, 0x00, 0x40, 0x00, 0x63, 0x00, 0x7d, 0x00, 0x8b, 0x00,
+  0x9b, 0x00, 0xb2, 0x00, 0xbe, 0x00, 0xc6, 0x00, 0xce, 0x00, 0xd6, 0x00,
+  0xde, 0x00, 0xe6, 0x00, 0xf1, 0x00, 0xfc, 0x00, 0x07, 0x01, 0x12, 0x01,
+  0x1d, 0x01, 0x28, 0x01, 0x00, 0x00, 0x17, 0x00, 0x33, 0x00, 0x53, 0x00,
+  0x70, 0x00, 0x7f, 0x00, 0x90, 0x00, 0xa1, 0x00, 0xaa, 0x00, 0xb3, 0x00,
+  0xbc, 0x00, 0xc5, 0x00, 0xce, 0x00, 0xd7, 0x00, 0xe0, 0x00, 0xe9, 0x00,
+  0xf2, 0x00, 0xfb, 0x00, 0x04, 0x01, 0x0d, 0x01, 0x16, 0x01, 0x00, 0x00,
+  0x1a, 0x00, 0x45, 0x00, 0x5f, 0x00, 0x75, 0x00, 0x82, 0x00, 0x9d, 0x00,
+  0xba, 0x00, 0xd0, 0x00, 0xd8, 0x00, 0xe0, 0x00, 0xec, 0x00, 0x00, 0x00,
+  0x1d, 0x00, 0x37, 0x00, 0x4f, 0x00, 0x65, 0x00, 0x77, 0x00, 0x85, 0x00,
+  0x00, 0x00, 0x32, 0x00, 0x4a, 0x00, 0x64, 0x00, 0x7e, 0x00, 0x91, 0x00,
+  0x9e, 0x00, 0xb9, 0x00, 0xde, 0x00, 0xe6, 0x00, 0xee, 0x00, 0xf6, 0x00,
+  0x00, 0x00, 0x1b, 0x00, 0x32, 0x00, 0x43, 0x00, 0x54, 0x00, 0x6d, 0x00,
+  0x74, 0x00, 0x7b, 0x00, 0x84, 0x00, 0x8e, 0x00, 0x98, 0x00, 0xa2, 0x00,
+  0x00, 0x00, 0x1e, 0x00, 0x37, 0x00, 0x53, 0x00, 0x64, 0x00, 0x73, 0x00,
+  0x88, 0x00, 0xa3, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x36, 0x00, 0x54, 0x00,
+  0x64, 0x00, 0x82, 0x00, 0x8b, 0x00, 0x94, 0x00, 0x9d, 0x00, 0xa6, 0x00,
+  0xaf, 0x00, 0xb8, 0x00, 0x00, 0x00, 0x19, 0x00, 0x2b, 0x00, 0x40, 0x00,
+  0x58, 0x00, 0x61, 0x00, 0x00, 0x00, 0x18, 0x00, 0x26, 0x00, 0x3f, 0x00,
+  0x55, 0x00, 0x5b, 0x00, 0x65, 0x00, 0x6f, 0x00, 0x00, 0x00, 0x17, 0x00,
+  0x22, 0x00, 0x30, 0x00, 0x3d, 0x00, 0x46, 0x00, 0x4f, 0x00, 0x58, 0x00,
+  0x61, 0x00, 0x6a, 0x00, 0x73, 0x00, 0x7c, 0x00, 0x85, 0x00, 0x00, 0x00,
+  0x16, 0x00, 0x26, 0x00, 0x38, 0x00, 0x4f, 0x00, 0x5b, 0x00, 0x67, 0x00,
+  0x73, 0x00, 0x7f, 0x00, 0x8b, 0x00, 0x97, 0x00, 0xa3, 0x00, 0xaf, 0x00,
+  0xbb, 0x00, 0xc7, 0x00, 0xd3, 0x00, 0xdf, 0x00, 0xeb, 0x00, 0xf7, 0x00,
+  0x03, 0x01, 0x0f, 0x01, 0x1b, 0x01, 0x27, 0x01, 0x33, 0x01, 0x3f, 0x01,
+  0x4b, 0x01, 0x57, 0x01, 0x63, 0x01, 0x6f, 0x01, 0x7b, 0x01, 0x87, 0x01,
+  0x93, 0x01, 0x9f, 0x01, 0xab, 0x01, 0xb7, 0x01, 0xc3, 0x01, 0xcf, 0x01,
+  0xdb, 0x01, 0xe7, 0x01, 0x00, 0x00, 0x18, 0x00, 0x34, 0x00, 0x49, 0x00,
+  0x58, 0x00, 0x6d, 0x00, 0x00, 0x00, 0x19, 0x00, 0x30, 0x00, 0x49, 0x00,
+  0x5e, 0x00, 0x6a, 0x00, 0x79, 0x00, 0x83, 0x00, 0x8d, 0x00, 0x96, 0x00,
+  0xa0, 0x00, 0xaa, 0x00, 0xb1, 0x00, 0x00, 0x00, 0x15, 0x00, 0x2d, 0x00,
+  0x4f, 0x00, 0x5d, 0x00, 0x6d, 0x00, 0x94, 0x00, 0xb8, 0x00, 0xc3, 0x00,
+  0xcd, 0x00, 0xd5, 0x00, 0xe5, 0x00, 0xf0, 0x00, 0xfb, 0x00, 0x06, 0x01,
+  0x11, 0x01, 0x1c, 0x01, 0x27, 0x01, 0x2f, 0x01, 0x3a, 0x01, 0x00, 0x00,
+  0x20, 0x00, 0x3a, 0x00, 0x4b, 0x00, 0x56, 0x00, 0x74, 0x00, 0x7f, 0x00,
+  0x8a, 0x00, 0x95, 0x00, 0xa1, 0x00, 0xad, 0x00, 0xb9, 0x00, 0xc5, 0x00,
+  0xd1, 0x00, 0xdd, 0x00, 0xe9, 0x00, 0xf5, 0x00, 0x01, 0x01, 0x0d, 0x01,
+  0x19, 0x01, 0x25, 0x01, 0x31, 0x01, 0x3d, 0x01, 0x49, 0x01, 0x55, 0x01,
+  0x61, 0x01, 0x6d, 0x01, 0x79, 0x01, 0x85, 0x01, 0x91, 0x01, 0x9d, 0x01,
+  0xa9, 0x01, 0xb5, 0x01, 0xc1, 0x01, 0xcd, 0x01, 0xd9, 0x01, 0xe5, 0x01,
+  0xf1, 0x01, 0xfd, 0x01, 0x09, 0x02, 0x15, 0x02, 0x21, 0x02, 0x2d, 0x02,
+  0x39, 0x02, 0x45, 0x02, 0x51, 0x02, 0x5d, 0x02, 0x69, 0x02, 0x75, 0x02,
+  0x81, 0x02, 0x8d, 0x02, 0x99, 0x02, 0xa5, 0x02, 0xb1, 0x02, 0xbd, 0x02,
+  0xc9, 0x02, 0xd5, 0x02, 0xe1, 0x02, 0xed, 0x02, 0xf9, 0x02, 0x05, 0x03,
+  0x11, 0x03, 0x1d, 0x03, 0x29, 0x03, 0x35, 0x03, 0x41, 0x03, 0x4d, 0x03,
+  0x59, 0x03, 0x65, 0x03, 0x00, 0x00, 0x17, 0x00, 0x2f, 0x00, 0x54, 0x00,
+  0x62, 0x00, 0x70, 0x00, 0x87, 0x00, 0xa4, 0x00, 0xad, 0x00, 0xb5, 0x00,
+  0xbd, 0x00, 0xc6, 0x00, 0xcf, 0x00, 0xd7, 0x00, 0xe0, 0x00, 0xe8, 0x00,
+  0xf0, 0x00, 0xfc, 0x00, 0x08, 0x01, 0x16, 0x01, 0x1e, 0x01, 0x00, 0x00,
+  0x0e, 0x00, 0x21, 0x00, 0x38, 0x00, 0x5c, 0x00, 0x66, 0x00, 0x70, 0x00,
+  0x7a, 0x00, 0x84, 0x00, 0x8e, 0x00, 0x98, 0x00, 0xa2, 0x00, 0xac, 0x00,
+  0xb6, 0x00, 0xc0, 0x00, 0xca, 0x00, 0xd4, 0x00, 0xde, 0x00, 0xe8, 0x00,
+  0xf2, 0x00, 0xfc, 0x00, 0x06, 0x01, 0x10, 0x01, 0x1a, 0x01, 0x24, 0x01,
+  0x2e, 0x01, 0x38, 0x01, 0x42, 0x01, 0x49, 0x01, 0x56, 0x01, 0x5d, 0x01,
+  0x00, 0x00, 0x10, 0x00, 0x21, 0x00, 0x34, 0x00, 0x5a, 0x00, 0x62, 0x00,
+  0x6c, 0x00, 0x74, 0x00, 0x7d, 0x00, 0x86, 0x00, 0x8f, 0x00, 0x98, 0x00,
+  0xa1, 0x00, 0xaa, 0x00, 0xb3, 0x00, 0xbc, 0x00, 0xc5, 0x00, 0xce, 0x00,
+  0xd7, 0x00, 0x00, 0x00, 0x12, 0x00, 0x24, 0x00, 0x30, 0x00, 0x3c, 0x00,
+  0x48, 0x00, 0x54, 0x00, 0x60, 0x00, 0x6c, 0x00, 0x78, 0x00, 0x84, 0x00,
+  0x90, 0x00, 0x9c, 0x00, 0xa8, 0x00, 0xb4, 0x00, 0xc0, 0x00, 0xcc, 0x00,
+  0xd8, 0x00, 0xe4, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0x08, 0x01, 0x14, 0x01,
+  0x20, 0x01, 0x2c, 0x01, 0x38, 0x01, 0x44, 0x01, 0x50, 0x01, 0x5c, 0x01,
+  0x68, 0x01, 0x74, 0x01, 0x80, 0x01, 0x8c, 0x01, 0x98, 0x01, 0xa4, 0x01,
+  0xb0, 0x01, 0xbc, 0x01, 0xc8, 0x01, 0xd4, 0x01, 0xe0, 0x01, 0xec, 0x01,
+  0xf7, 0x01, 0x02, 0x02, 0x00, 0x00, 0x0c, 0x00, 0x1b, 0x00, 0x23, 0x00,
+  0x2b, 0x00, 0x33, 0x00, 0x3b, 0x00, 0x43, 0x00, 0x4b, 0x00, 0x57, 0x00,
+  0x63, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x21, 0x00, 0x2c, 0x00, 0x37, 0x00,
+  0x42, 0x00, 0x4c, 0x00, 0x56, 0x00, 0x60, 0x00, 0x6a, 0x00, 0x74, 0x00,
+  0x7d, 0x00, 0x87, 0x00, 0x91, 0x00, 0x9b, 0x00, 0xa5, 0x00, 0xaf, 0x00,
+  0xb9, 0x00, 0xc3, 0x00, 0xcd, 0x00, 0xd7, 0x00, 0xe1, 0x00, 0xeb, 0x00,
+  0xf5, 0x00, 0xff, 0x00, 0x09, 0x01, 0x13, 0x01, 0x1d, 0x01, 0x27, 0x01,
+  0x31, 0x01, 0x3b, 0x01, 0x45, 0x01, 0x00, 0x00, 0x0d, 0x00, 0x1f, 0x00,
+  0x2b, 0x00, 0x00, 0x00, 0x16, 0x00, 0x2d, 0x00, 0x40, 0x00, 0x4c, 0x00,
+  0x00, 0x00, 0x19, 0x00, 0x32, 0x00, 0x44, 0x00, 0x4f, 0x00, 0x5d, 0x00,
+  0x6b, 0x00, 0x79, 0x00, 0x87, 0x00, 0x95, 0x00, 0xa3, 0x00, 0xb1, 0x00,
+  0xbf, 0x00, 0xcd, 0x00, 0xdb, 0x00, 0xe7, 0x00, 0xf0, 0x00, 0xf9, 0x00,
+  0x02, 0x01, 0x0b, 0x01, 0x14, 0x01, 0x1d, 0x01, 0x26, 0x01, 0x2f, 0x01,
+  0x38, 0x01, 0x41, 0x01, 0x4a, 0x01, 0x53, 0x01, 0x5c, 0x01, 0x65, 0x01,
+  0x6e, 0x01, 0x77, 0x01, 0x80, 0x01, 0x89, 0x01, 0x93, 0x01, 0x9d, 0x01,
+  0xa7, 0x01, 0xb0, 0x01, 0xb9, 0x01, 0xc2, 0x01, 0xcb, 0x01, 0xd4, 0x01,
+  0xdd, 0x01, 0xe6, 0x01, 0xef, 0x01, 0x00, 0x00, 0x19, 0x00, 0x2b, 0x00,
+  0x36, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x28, 0x00, 0x36, 0x00, 0x3f, 0x00,
+  0x48, 0x00, 0x51, 0x00, 0x5a, 0x00, 0x63, 0x00, 0x6f, 0x00, 0x7b, 0x00,
+  0x87, 0x00, 0x93, 0x00, 0x9f, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x2c, 0x00,
+  0x34, 0x00, 0x3c, 0x00, 0x45, 0x00, 0x4e, 0x00, 0x57, 0x00, 0x60, 0x00,
+  0x69, 0x00, 0x72, 0x00, 0x7b, 0x00, 0x00, 0x00, 0x18, 0x00, 0x31, 0x00,
+  0x3f, 0x00, 0x4e, 0x00, 0x57, 0x00, 0x60, 0x00, 0x69, 0x00, 0x72, 0x00,
+  0x7c, 0x00, 0x88, 0x00, 0x91, 0x00, 0x9a, 0x00, 0xa3, 0x00, 0xac, 0x00,
+  0xb5, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x2b, 0x00, 0x3b, 0x00, 0x45, 0x00,
+  0x00, 0x00, 0x17, 0x00, 0x29, 0x00, 0x32, 0x00, 0x00, 0x00, 0x1a, 0x00,
+  0x35, 0x00, 0x4b, 0x00, 0x56, 0x00, 0x61, 0x00, 0x6c, 0x00, 0x73, 0x00,
+  0x7e, 0x00, 0x00, 0x00, 0x34, 0x00, 0x40, 0x00, 0x51, 0x00, 0x5b, 0x00,
+  0x65, 0x00, 0x6f, 0x00, 0x79, 0x00, 0x83, 0x00, 0x8d, 0x00, 0x00, 0x00,
+  0x17, 0x00, 0x24, 0x00, 0x34, 0x00, 0x3f, 0x00, 0x4a, 0x00, 0x55, 0x00,
+  0x60, 0x00, 0x6b, 0x00, 0x76, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x18, 0x00,
+  0x34, 0x00, 0x4d, 0x00, 0x5f, 0x00, 0x6e, 0x00, 0x79, 0x00, 0x85, 0x00,
+  0x91, 0x00, 0x9c, 0x00, 0xa5, 0x00, 0xad, 0x00, 0xb9, 0x00, 0x00, 0x00,
+  0x18, 0x00, 0x24, 0x00, 0x30, 0x00, 0x3c, 0x00, 0x48, 0x00, 0x54, 0x00,
+  0x5f, 0x00, 0x6a, 0x00, 0x75, 0x00, 0x80, 0x00, 0x8b, 0x00, 0x96, 0x00,
+  0xa1, 0x00, 0xac, 0x00, 0xb7, 0x00, 0xc2, 0x00, 0xcd, 0x00, 0xd8, 0x00,
+  0xe3, 0x00, 0xee, 0x00, 0xf9, 0x00, 0x04, 0x01, 0x0f, 0x01, 0x1a, 0x01,
+  0x25, 0x01, 0x30, 0x01, 0x3b, 0x01, 0x46, 0x01, 0x51, 0x01, 0x5c, 0x01,
+  0x67, 0x01, 0x72, 0x01, 0x7d, 0x01, 0x88, 0x01, 0x93, 0x01, 0x00, 0x00,
+  0x19, 0x00, 0x36, 0x00, 0x4f, 0x00, 0x58, 0x00, 0x61, 0x00, 0x6a, 0x00,
+  0x74, 0x00, 0x7e, 0x00, 0x88, 0x00, 0x91, 0x00, 0x9b, 0x00, 0x00, 0x00,
+  0x23, 0x00, 0x2d, 0x00, 0x39, 0x00, 0x00, 0x00, 0x21, 0x00, 0x28, 0x00,
+  0x30, 0x00, 0x38, 0x00, 0x40, 0x00, 0x48, 0x00, 0x51, 0x00, 0x5a, 0x00,
+  0x00, 0x00, 0x1a, 0x00, 0x32, 0x00, 0x3b, 0x00, 0x44, 0x00, 0x4d, 0x00,
+  0x56, 0x00, 0x5f, 0x00, 0x68, 0x00, 0x74, 0x00, 0x80, 0x00, 0x8c, 0x00,
+  0x98, 0x00, 0xa1, 0x00, 0xaa, 0x00, 0xb3, 0x00, 0xbc, 0x00, 0xc3, 0x00,
+  0x00, 0x00, 0x18, 0x00, 0x30, 0x00, 0x4e, 0x00, 0x57, 0x00, 0x5f, 0x00,
+  0x68, 0x00, 0x70, 0x00, 0x78, 0x00, 0x81, 0x00, 0x8a, 0x00, 0x93, 0x00,
+  0x9b, 0x00, 0xa3, 0x00, 0xac, 0x00, 0xb5, 0x00, 0xbe, 0x00, 0xc6, 0x00,
+  0xce, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x23, 0x00, 0x2a, 0x00, 0x33, 0x00,
+  0x3d, 0x00, 0x47, 0x00, 0x52, 0x00, 0x5d, 0x00, 0x68, 0x00, 0x73, 0x00,
+  0x7e, 0x00, 0x89, 0x00, 0x94, 0x00, 0x9f, 0x00, 0xaa, 0x00, 0xb5, 0x00,
+  0xc0, 0x00, 0xcb, 0x00, 0xd6, 0x00, 0xe1, 0x00, 0xec, 0x00, 0xf8, 0x00,
+  0x04, 0x01, 0x0d, 0x01, 0x17, 0x01, 0x00, 0x00, 0x1f, 0x00, 0x39, 0x00,
+  0x53, 0x00, 0x5c, 0x00, 0x64, 0x00, 0x6d, 0x00, 0x76, 0x00, 0x00, 0x00,
+  0x1b, 0x00, 0x37, 0x00, 0x4c, 0x00, 0x55, 0x00, 0x5e, 0x00, 0x67, 0x00,
+  0x73, 0x00, 0x00, 0x00, 0x16, 0x00, 0x2c, 0x00, 0x34, 0x00, 0x3c, 0x00,
+  0x44, 0x00, 0x4c, 0x00, 0x53, 0x00, 0x5b, 0x00, 0x63, 0x00, 0x6b, 0x00,
+  0x73, 0x00, 0x7b, 0x00, 0x83, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x33, 0x00,
+  0x45, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x53, 0x00, 0x64, 0x00,
+  0x72, 0x00, 0x7c, 0x00, 0x93, 0x00, 0x9e, 0x00, 0xa9, 0x00, 0xb4, 0x00,
+  0xbf, 0x00, 0xca, 0x00, 0xd5, 0x00, 0xe0, 0x00, 0xeb, 0x00, 0xf6, 0x00,
+  0x01, 0x01, 0x09, 0x01, 0x14, 0x01, 0x1f, 0x01, 0x2a, 0x01, 0x35, 0x01,
+  0x40, 0x01, 0x4b, 0x01, 0x56, 0x01, 0x61, 0x01, 0x6c, 0x01, 0x77, 0x01,
+  0x7f, 0x01, 0x88, 0x01, 0x93, 0x01, 0x9b, 0x01, 0x00, 0x00, 0x0c, 0x00,
+  0x18, 0x00, 0x24, 0x00, 0x30, 0x00, 0x3c, 0x00, 0x48, 0x00, 0x52, 0x00,
+  0x00, 0x00, 0x0b, 0x00, 0x17, 0x00, 0x21, 0x00, 0x2b, 0x00, 0x35, 0x00,
+  0x3f, 0x00, 0x49, 0x00, 0x53, 0x00, 0x5d, 0x00, 0x67, 0x00, 0x71, 0x00,
+  0x7b, 0x00, 0x85, 0x00, 0x8f, 0x00, 0x99, 0x00, 0xa3, 0x00, 0xad, 0x00,
+  0xb7, 0x00, 0xc1, 0x00, 0xcb, 0x00, 0xd5, 0x00, 0xdf, 0x00, 0xe9, 0x00,
+  0xf3, 0x00, 0xfd, 0x00, 0x07, 0x01, 0x11, 0x01, 0x1b, 0x01, 0x25, 0x01,
+  0x2f, 0x01, 0x39, 0x01, 0x43, 0x01, 0x4d, 0x01, 0x57, 0x01, 0x61, 0x01,
+  0x6b, 0x01, 0x75, 0x01, 0x7f, 0x01, 0x89, 0x01, 0x93, 0x01, 0x9d, 0x01,
+  0xa7, 0x01, 0x00, 0x00, 0x0d, 0x00, 0x1a, 0x00, 0x21, 0x00, 0x29, 0x00,
+  0x32, 0x00, 0x3b, 0x00, 0x44, 0x00, 0x4d, 0x00, 0x56, 0x00, 0x5f, 0x00,
+  0x68, 0x00, 0x71, 0x00, 0x7a, 0x00, 0x83, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x15, 0x00, 0x21, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x14, 0x00, 0x1e, 0x00,
+  0x28, 0x00, 0x32, 0x00, 0x3c, 0x00, 0x48, 0x00, 0x54, 0x00, 0x60, 0x00,
+  0x6c, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x1d, 0x00, 0x2f, 0x00, 0x39, 0x00,
+  0x43, 0x00, 0x4d, 0x00, 0x57, 0x00, 0x61, 0x00, 0x6b, 0x00, 0x75, 0x00,
+  0x7e, 0x00, 0x88, 0x00, 0x92, 0x00, 0x9c, 0x00, 0xa6, 0x00, 0xb0, 0x00,
+  0xba, 0x00, 0xc4, 0x00, 0xce, 0x00, 0xd8, 0x00, 0xe2, 0x00, 0xec, 0x00,
+  0xf6, 0x00, 0x00, 0x01, 0x0a, 0x01, 0x14, 0x01, 0x1e, 0x01, 0x28, 0x01,
+  0x32, 0x01, 0x3e, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x18, 0x00, 0x24, 0x00,
+  0x30, 0x00, 0x3c, 0x00, 0x48, 0x00, 0x54, 0x00, 0x60, 0x00, 0x6c, 0x00,
+  0x78, 0x00, 0x84, 0x00, 0x90, 0x00, 0x9c, 0x00, 0xa8, 0x00, 0xb4, 0x00,
+  0xc0, 0x00, 0xcc, 0x00, 0xd8, 0x00, 0xe4, 0x00, 0xf0, 0x00, 0xfc, 0x00,
+  0x08, 0x01, 0x14, 0x01, 0x20, 0x01, 0x2c, 0x01, 0x38, 0x01, 0x44, 0x01,
+  0x50, 0x01, 0x5c, 0x01, 0x68, 0x01, 0x74, 0x01, 0x80, 0x01, 0x8c, 0x01,
+  0x98, 0x01, 0xa4, 0x01, 0xb0, 0x01, 0xbc, 0x01, 0xc8, 0x01, 0xd4, 0x01,
+  0xe0, 0x01, 0xec, 0x01, 0xf8, 0x01, 0x01, 0x02, 0x0a, 0x02, 0x13, 0x02,
+  0x00, 0x00, 0x0d, 0x00, 0x1a, 0x00, 0x27, 0x00, 0x34, 0x00, 0x41, 0x00,
+  0x4e, 0x00, 0x5b, 0x00, 0x68, 0x00, 0x75, 0x00, 0x82, 0x00, 0x8f, 0x00,
+  0x9c, 0x00, 0xa9, 0x00, 0xb6, 0x00, 0xc3, 0x00, 0xd0, 0x00, 0xdd, 0x00,
+  0xea, 0x00, 0xf7, 0x00, 0x04, 0x01, 0x11, 0x01, 0x1e, 0x01, 0x2b, 0x01,
+  0x38, 0x01, 0x45, 0x01, 0x52, 0x01, 0x5f, 0x01, 0x6a, 0x01, 0x00, 0x00,
+  0x09, 0x00, 0x12, 0x00, 0x1b, 0x00, 0x24, 0x00, 0x2d, 0x00, 0x36, 0x00,
+  0x3f, 0x00, 0x48, 0x00, 0x51, 0x00, 0x5a, 0x00, 0x63, 0x00, 0x6c, 0x00,
+  0x75, 0x00, 0x7e, 0x00, 0x87, 0x00, 0x90, 0x00, 0x99, 0x00, 0xa2, 0x00,
+  0xab, 0x00, 0xb4, 0x00, 0xbd, 0x00, 0xc6, 0x00, 0xcf, 0x00, 0xd8, 0x00,
+  0xe1, 0x00, 0xea, 0x00, 0xfb, 0x00, 0x04, 0x01, 0x0d, 0x01, 0x00, 0x00,
+  0x09, 0x00, 0x12, 0x00, 0x1b, 0x00, 0x24, 0x00, 0x2d, 0x00, 0x37, 0x00,
+  0x41, 0x00, 0x4b, 0x00, 0x55, 0x00, 0x00, 0x00, 0x18, 0x00, 0x21, 0x00,
+  0x2a, 0x00, 0x33, 0x00, 0x3c, 0x00, 0x45, 0x00, 0x4e, 0x00, 0x5a, 0x00,
+  0x63, 0x00, 0x00, 0x00, 0x19, 0x00, 0x22, 0x00, 0x2b, 0x00, 0x34, 0x00,
+  0x3d, 0x00, 0x46, 0x00, 0x4f, 0x00, 0x58, 0x00, 0x61, 0x00, 0x6a, 0x00,
+  0x7c, 0x00, 0x85, 0x00, 0x8f, 0x00, 0x99, 0x00, 0xa5, 0x00, 0xae, 0x00,
+  0xb7, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x09, 0x00, 0x12, 0x00, 0x1b, 0x00,
+  0x26, 0x00, 0x32, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x16, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x16, 0x00, 0x20, 0x00, 0x2a, 0x00, 0x34, 0x00, 0x3e, 0x00,
+  0x48, 0x00, 0x52, 0x00, 0x5c, 0x00, 0x66, 0x00, 0x70, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x14, 0x00, 0x1e, 0x00, 0x28, 0x00, 0x00, 0x00, 0x0b, 0x00,
+  0x16, 0x00, 0x21, 0x00, 0x2c, 0x00, 0x37, 0x00, 0x42, 0x00, 0x4d, 0x00,
+  0x58, 0x00, 0x63, 0x00, 0x6e, 0x00, 0x79, 0x00, 0x84, 0x00, 0x8f, 0x00,
+  0x99, 0x00, 0xa4, 0x00, 0xaf, 0x00, 0xba, 0x00, 0xc5, 0x00, 0xd0, 0x00,
+  0xdb, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x16, 0x00, 0x1f, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x15, 0x00, 0x1f, 0x00, 0x29, 0x00, 0x33, 0x00,
+  0x42, 0x00, 0x4c, 0x00, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00,
+  0x0f, 0x00, 0x17, 0x00, 0x1f, 0x00, 0x27, 0x00, 0x2f, 0x00, 0x3a, 0x00,
+  0x45, 0x00, 0x50, 0x00, 0x5a, 0x00, 0x6c, 0x00, 0x74, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x12, 0x00, 0x1b, 0x00, 0x24, 0x00, 0x2d, 0x00, 0x36, 0x00,
+  0x3f, 0x00, 0x48, 0x00, 0x51, 0x00, 0x00, 0x00, 0x08, 0x00, 0x10, 0x00,
+  0x18, 0x00, 0x20, 0x00, 0x28, 0x00, 0x31, 0x00, 0x3a, 0x00, 0x42, 0x00,
+  0x4a, 0x00, 0x53, 0x00, 0x5f, 0x00, 0x69, 0x00, 0x71, 0x00, 0x79, 0x00,
+  0x81, 0x00, 0x8a, 0x00, 0x93, 0x00, 0x9c, 0x00, 0x00, 0x00, 0x0d, 0x00,
+  0x16, 0x00, 0x1f, 0x00, 0x2a, 0x00, 0x35, 0x00, 0x40, 0x00, 0x4b, 0x00,
+  0x56, 0x00, 0x61, 0x00, 0x6c, 0x00, 0x77, 0x00, 0x82, 0x00, 0x8d, 0x00,
+  0x98, 0x00, 0xa3, 0x00, 0xae, 0x00, 0xb9, 0x00, 0xc4, 0x00, 0xcf, 0x00,
+  0xda, 0x00, 0xe5, 0x00, 0xf0, 0x00, 0xfb, 0x00, 0x06, 0x01, 0x11, 0x01,
+  0x1c, 0x01, 0x27, 0x01, 0x32, 0x01, 0x3d, 0x01, 0x48, 0x01, 0x53, 0x01,
+  0x5e, 0x01, 0x69, 0x01, 0x74, 0x01, 0x7f, 0x01, 0x8a, 0x01, 0x95, 0x01,
+  0x00, 0x00, 0x08, 0x00, 0x10, 0x00, 0x18, 0x00, 0x21, 0x00, 0x2d, 0x00,
+  0x36, 0x00, 0x3e, 0x00, 0x46, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x0b, 0x00,
+  0x17, 0x00, 0x23, 0x00, 0x2f, 0x00, 0x3b, 0x00, 0x47, 0x00, 0x53, 0x00,
+  0x5f, 0x00, 0x6b, 0x00, 0x77, 0x00, 0x83, 0x00, 0x8f, 0x00, 0x9b, 0x00,
+  0xa7, 0x00, 0xb3, 0x00, 0xbf, 0x00, 0xcb, 0x00, 0xd7, 0x00, 0xe3, 0x00,
+  0xef, 0x00, 0xfb, 0x00, 0x07, 0x01, 0x13, 0x01, 0x1f, 0x01, 0x2b, 0x01,
+  0x37, 0x01, 0x43, 0x01, 0x4f, 0x01, 0x5b, 0x01, 0x6a, 0x01, 0x79, 0x01,
+  0x82, 0x01, 0x8b, 0x01, 0x94, 0x01, 0x00, 0x00, 0x1e, 0x00, 0x27, 0x00,
+  0x30, 0x00, 0x39, 0x00, 0x42, 0x00, 0x4a, 0x00, 0x52, 0x00, 0x5a, 0x00,
+  0x62, 0x00, 0x6a, 0x00, 0x72, 0x00, 0x7a, 0x00, 0x82, 0x00, 0x8a, 0x00,
+  0x93, 0x00, 0x9c, 0x00, 0xa4, 0x00, 0xac, 0x00, 0xb4, 0x00, 0xbc, 0x00,
+  0xc4, 0x00, 0xcc, 0x00, 0x00, 0x00, 0x07, 0x00, 0x10, 0x00, 0x19, 0x00,
+  0x22, 0x00, 0x2b, 0x00, 0x35, 0x00, 0x3f, 0x00, 0x4e, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x18, 0x00, 0x23, 0x00, 0x2e, 0x00, 0x39, 0x00, 0x44, 0x00,
+  0x4f, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x37, 0x00, 0x43, 0x00,
+  0x4f, 0x00, 0x5b, 0x00, 0x67, 0x00, 0x73, 0x00, 0x7f, 0x00, 0x8b, 0x00,
+  0x97, 0x00, 0xa3, 0x00, 0xaf, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x14, 0x00,
+  0x1e, 0x00, 0x27, 0x00, 0x30, 0x00, 0x39, 0x00, 0x00, 0x00, 0x0b, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x14, 0x00, 0x1e, 0x00,
+  0x28, 0x00, 0x00, 0x00, 0x08, 0x00, 0x10, 0x00, 0x16, 0x00, 0x1f, 0x00,
+  0x28, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x24, 0x00, 0x2d, 0x00, 0x36, 0x00,
+  0x00, 0x00, 0x15, 0x00, 0x1d, 0x00, 0x25, 0x00, 0x2d, 0x00, 0x35, 0x00,
+  0x3d, 0x00, 0x45, 0x00, 0x4e, 0x00, 0x57, 0x00, 0x60, 0x00, 0x69, 0x00,
+  0x72, 0x00, 0x7b, 0x00, 0x84, 0x00, 0x8d, 0x00, 0x96, 0x00, 0x9f, 0x00,
+  0xa8, 0x00, 0xb0, 0x00, 0xb8, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x0a, 0x00,
+  0x14, 0x00, 0x1e, 0x00, 0x28, 0x00, 0x32, 0x00, 0x3c, 0x00, 0x46, 0x00,
+  0x50, 0x00, 0x5a, 0x00, 0x64, 0x00, 0x6e, 0x00, 0x78, 0x00, 0x82, 0x00,
+  0x8c, 0x00, 0x96, 0x00, 0xa0, 0x00, 0xa9, 0x00, 0xb2, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x0e, 0x00, 0x17, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x13, 0x00,
+  0x00, 0x00, 0x08, 0x00, 0x14, 0x00, 0x20, 0x00, 0x28, 0x00, 0x30, 0x00,
+  0x38, 0x00, 0x40, 0x00, 0x48, 0x00, 0x50, 0x00, 0x5b, 0x00, 0x63, 0x00,
+  0x6b, 0x00, 0x78, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x14, 0x00, 0x1e, 0x00,
+  0x28, 0x00, 0x32, 0x00, 0x3c, 0x00, 0x46, 0x00, 0x50, 0x00, 0x5a, 0x00,
+  0x64, 0x00, 0x6e, 0x00, 0x78, 0x00, 0x82, 0x00, 0x8c, 0x00, 0x96, 0x00,
+  0xa0, 0x00, 0xaa, 0x00, 0xb4, 0x00, 0xbe, 0x00, 0xc8, 0x00, 0xd2, 0x00,
+  0xdc, 0x00, 0xe6, 0x00, 0xf0, 0x00, 0xfa, 0x00, 0x04, 0x01, 0x0e, 0x01,
+  0x18, 0x01, 0x00, 0x00, 0x09, 0x00, 0x13, 0x00, 0x1e, 0x00, 0x29, 0x00,
+  0x34, 0x00, 0x3f, 0x00, 0x4a, 0x00, 0x55, 0x00, 0x60, 0x00, 0x6b, 0x00,
+  0x76, 0x00, 0x81, 0x00, 0x8c, 0x00, 0x97, 0x00, 0xa2, 0x00, 0xad, 0x00,
+  0xbb, 0x00, 0xc3, 0x00, 0xcb, 0x00, 0xd2, 0x00, 0xd9, 0x00, 0xe0, 0x00,
+  0xee, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x18, 0x00, 0x24, 0x00, 0x30, 0x00,
+  0x3c, 0x00, 0x46, 0x00, 0x4f, 0x00, 0x00, 0x00, 0x19, 0x00, 0x25, 0x00,
+  0x31, 0x00, 0x3d, 0x00, 0x49, 0x00, 0x55, 0x00, 0x61, 0x00, 0x6d, 0x00,
+  0x76, 0x00, 0x7f, 0x00, 0x88, 0x00, 0x00, 0x00, 0x09, 0x00, 0x12, 0x00,
+  0x1b, 0x00, 0x00, 0x00, 0x09, 0x00, 0x12, 0x00, 0x1b, 0x00, 0x27, 0x00,
+  0x2e, 0x00, 0x00, 0x00, 0x09, 0x00, 0x12, 0x00, 0x1b, 0x00, 0x24, 0x00,
+  0x2d, 0x00, 0x36, 0x00, 0x3f, 0x00, 0x48, 0x00, 0x51, 0x00, 0x5a, 0x00,
+  0x63, 0x00, 0x6c, 0x00, 0x75, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x0a, 0x00,
+  0x14, 0x00, 0x1e, 0x00, 0x28, 0x00, 0x00, 0x00, 0x09, 0x00, 0x12, 0x00,
+  0x1b, 0x00, 0x24, 0x00, 0x2d, 0x00, 0x36, 0x00, 0x41, 0x00, 0x4c, 0x00,
+  0x57, 0x00, 0x62, 0x00, 0x6d, 0x00, 0x78, 0x00, 0x83, 0x00, 0x8e, 0x00,
+  0x97, 0x00, 0xa0, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x16, 0x00, 0x00, 0x00,
+  0x35, 0x00, 0x40, 0x00, 0x48, 0x00, 0x51, 0x00, 0x00, 0x00, 0x33, 0x00,
+  0x3e, 0x00, 0x00, 0x00, 0x18, 0x00, 0x28, 0x00, 0x30, 0x00, 0x38, 0x00,
+  0x42, 0x00, 0x4c, 0x00, 0x56, 0x00, 0x60, 0x00, 0x6a, 0x00, 0x74, 0x00,
+  0x7e, 0x00, 0x88, 0x00, 0x92, 0x00, 0x9c, 0x00, 0xa6, 0x00, 0xb0, 0x00,
+  0xba, 0x00, 0xc4, 0x00, 0xce, 0x00, 0xd8, 0x00, 0xe2, 0x00, 0xec, 0x00,
+  0xf6, 0x00, 0x00, 0x01, 0x0a, 0x01, 0x14, 0x01, 0x1e, 0x01, 0x28, 0x01,
+  0x32, 0x01, 0x3a, 0x01, 0x42, 0x01, 0x4a, 0x01, 0x00, 0x00, 0x33, 0x00,
+  0x64, 0x00, 0x95, 0x00, 0xc8, 0x00, 0xcf, 0x00, 0xd6, 0x00, 0xdd, 0x00,
+  0xea, 0x00, 0xf1, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x34, 0x00, 0x69, 0x00,
+  0x9b, 0x00, 0xce, 0x00, 0x00, 0x01, 0x34, 0x01, 0x3b, 0x01, 0x42, 0x01,
+  0x4a, 0x01, 0x54, 0x01, 0x5e, 0x01, 0x00, 0x00, 0x09, 0x00, 0x10, 0x00,
+  0x17, 0x00, 0x22, 0x00, 0x2d, 0x00, 0x38, 0x00, 0x43, 0x00, 0x4e, 0x00,
+  0x59, 0x00, 0x64, 0x00, 0x6f, 0x00, 0x00, 0x00, 0x08, 0x00, 0x15, 0x00,
+  0x22, 0x00, 0x2f, 0x00, 0x39, 0x00, 0x43, 0x00, 0x4d, 0x00, 0x57, 0x00,
+  0x61, 0x00, 0x6b, 0x00, 0x75, 0x00, 0x7f, 0x00, 0x89, 0x00, 0x93, 0x00,
+  0x9d, 0x00, 0xa7, 0x00, 0xb1, 0x00, 0xbb, 0x00, 0xc5, 0x00, 0xcf, 0x00,
+  0xd9, 0x00, 0xe3, 0x00, 0xed, 0x00, 0xf7, 0x00, 0x01, 0x01, 0x0b, 0x01,
+  0x15, 0x01, 0x1f, 0x01, 0x31, 0x01, 0x38, 0x01, 0x42, 0x01, 0x4a, 0x01,
+  0x00, 0x00, 0x0b, 0x00, 0x16, 0x00, 0x20, 0x00, 0x28, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x13, 0x00, 0x22, 0x00, 0x31, 0x00, 0x40, 0x00, 0x4f, 0x00,
+  0x5e, 0x00, 0x6d, 0x00, 0x7c, 0x00, 0x8b, 0x00, 0x9a, 0x00, 0xa9, 0x00,
+  0xb8, 0x00, 0xc7, 0x00, 0xd6, 0x00, 0xe5, 0x00, 0xf4, 0x00, 0x03, 0x01,
+  0x12, 0x01, 0x21, 0x01, 0x30, 0x01, 0x3f, 0x01, 0x4e, 0x01, 0x58, 0x01,
+  0x62, 0x01, 0x6c, 0x01, 0x76, 0x01, 0x80, 0x01, 0x8a, 0x01, 0x94, 0x01,
+  0x9e, 0x01, 0xa8, 0x01, 0xb2, 0x01, 0xbc, 0x01, 0xc6, 0x01, 0xd0, 0x01,
+  0xda, 0x01
+};
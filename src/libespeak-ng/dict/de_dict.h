@@ -1,5 +1,7 @@
 #pragma once
-const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
+#include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/de_dict_index.h>
+const unsigned char __espeakng_dict_de[] __attribute__((aligned((4)))) = {
   0x00, 0x04, 0x00, 0x00, 0x51, 0xd7, 0x00, 0x00, 0x00, 0x47, 0x19, 0xf0,
   0x9f, 0x91, 0xa9, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xe2, 0x80,
   0x8d, 0xf0, 0x9f, 0x91, 0xa7, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa7,
@@ -5775,4 +5777,11 @@ const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
   0x00, 0xc3, 0xa9, 0x03, 0x7e, 0x00, 0xc3, 0xb8, 0x03, 0x83, 0x00, 0x07,
   0x00
 };
-size_t __espeakng_dictlen = 69277;
+
+BackgroundAudioDictionary dict_de = {
+    "de",
+    69277,
+    __espeakng_dict_de,
+    10126,
+    __espeakng_dictindex_de
+};
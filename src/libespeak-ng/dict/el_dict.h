@@ -1,5 +1,7 @@
 #pragma once
-const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
+#include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/el_dict_index.h>
+const unsigned char __espeakng_dict_el[] __attribute__((aligned((4)))) = {
   0x00, 0x04, 0x00, 0x00, 0xb6, 0x13, 0x01, 0x00, 0x00, 0x71, 0x19, 0xf0,
   0x9f, 0x91, 0xa9, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xe2, 0x80,
   0x8d, 0xf0, 0x9f, 0x91, 0xa7, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa7,
@@ -6072,4 +6074,11 @@ const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
   0x23, 0x55, 0x42, 0x23, 0x5a, 0x2f, 0x25, 0x31, 0x06, 0x27, 0x00, 0x07,
   0x00
 };
-size_t __espeakng_dictlen = 72841;
+
+BackgroundAudioDictionary dict_el = {
+    "el",
+    72841,
+    __espeakng_dict_el,
+    8122,
+    __espeakng_dictindex_el
+};
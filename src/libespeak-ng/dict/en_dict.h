@@ -1,5 +1,7 @@
 #pragma once
-const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
+#include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/en_dict_index.h>
+const unsigned char __espeakng_dict_en[] __attribute__((aligned((4)))) = {
   0x00, 0x04, 0x00, 0x00, 0x88, 0xb1, 0x01, 0x00, 0x0e, 0x45, 0x5c, 0x83,
   0xc1, 0x34, 0x90, 0x41, 0x8e, 0x77, 0x42, 0x06, 0x92, 0x00, 0x10, 0x46,
   0x4d, 0x42, 0x4c, 0x15, 0x45, 0x0f, 0x5a, 0x2f, 0x7f, 0x37, 0x7b, 0x2f,
@@ -14018,4 +14020,11 @@ const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
   0xc3, 0xaf, 0x00, 0x04, 0xc3, 0xbb, 0x03, 0x8e, 0x00, 0xc3, 0xbc, 0x00,
   0xc3, 0xa9, 0x03, 0x93, 0x00, 0xc3, 0xaa, 0x03, 0x95, 0x00, 0x07, 0x00
 };
-size_t __espeakng_dictlen = 168204;
+
+BackgroundAudioDictionary dict_en = {
+    "en",
+    168204,
+    __espeakng_dict_en,
+    23818,
+    __espeakng_dictindex_en
+};
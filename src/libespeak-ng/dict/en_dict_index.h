@@ -0,0 +1,1988 @@
+#pragma once
+const unsigned char __espeakng_dictindex_en[] __attribute__((aligned((4)))) = {
+  0x45, 0x44, 0x58, 0x31, 0x0c, 0x91, 0x02, 0x00, 0x88, 0xb1, 0x01, 0x00,
+  0x52, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x0d, 0x00, 0x16, 0x00,
+  0x1c, 0x00, 0x21, 0x00, 0x2c, 0x00, 0x3a, 0x00, 0x45, 0x00, 0x47, 0x00,
+  0x4e, 0x00, 0x54, 0x00, 0x65, 0x00, 0x67, 0x00, 0x72, 0x00, 0x7b, 0x00,
+  0x7f, 0x00, 0x81, 0x00, 0x85, 0x00, 0x8a, 0x00, 0x93, 0x00, 0xa7, 0x00,
+  0xac, 0x00, 0xb1, 0x00, 0xb8, 0x00, 0xbd, 0x00, 0xc4, 0x00, 0xca, 0x00,
+  0xcc, 0x00, 0xd1, 0x00, 0xd6, 0x00, 0xd8, 0x00, 0xe0, 0x00, 0xe4, 0x00,
+  0xe6, 0x00, 0xe8, 0x00, 0xed, 0x00, 0xf2, 0x00, 0xff, 0x00, 0x0d, 0x01,
+  0x14, 0x01, 0x17, 0x01, 0x1d, 0x01, 0x1f, 0x01, 0x22, 0x01, 0x2c, 0x01,
+  0x30, 0x01, 0x35, 0x01, 0x38, 0x01, 0x3b, 0x01, 0x44, 0x01, 0x49, 0x01,
+  0x4b, 0x01, 0x51, 0x01, 0x5b, 0x01, 0x5f, 0x01, 0x62, 0x01, 0x68, 0x01,
+  0x6e, 0x01, 0x72, 0x01, 0x74, 0x01, 0x7b, 0x01, 0x82, 0x01, 0x87, 0x01,
+  0x8f, 0x01, 0x91, 0x01, 0x99, 0x01, 0x9c, 0x01, 0xa1, 0x01, 0xa4, 0x01,
+  0xab, 0x01, 0xb4, 0x01, 0xb8, 0x01, 0xba, 0x01, 0xbe, 0x01, 0xc7, 0x01,
+  0xcc, 0x01, 0xd6, 0x01, 0xda, 0x01, 0xe1, 0x01, 0xe4, 0x01, 0xe6, 0x01,
+  0xea, 0x01, 0xec, 0x01, 0xf4, 0x01, 0xf9, 0x01, 0x00, 0x02, 0x06, 0x02,
+  0x0a, 0x02, 0x10, 0x02, 0x15, 0x02, 0x27, 0x02, 0x28, 0x02, 0x33, 0x02,
+  0x45, 0x02, 0x4a, 0x02, 0x50, 0x02, 0x51, 0x02, 0x56, 0x02, 0x58, 0x02,
+  0x5e, 0x02, 0x5f, 0x02, 0x64, 0x02, 0x6d, 0x02, 0x71, 0x02, 0x76, 0x02,
+  0x7b, 0x02, 0x90, 0x02, 0x9b, 0x02, 0xaf, 0x02, 0xb6, 0x02, 0xc0, 0x02,
+  0xc6, 0x02, 0xc9, 0x02, 0xce, 0x02, 0xd4, 0x02, 0xda, 0x02, 0xdc, 0x02,
+  0xe5, 0x02, 0xec, 0x02, 0xf2, 0x02, 0xf8, 0x02, 0xff, 0x02, 0x08, 0x03,
+  0x0c, 0x03, 0x15, 0x03, 0x18, 0x03, 0x1d, 0x03, 0x21, 0x03, 0x28, 0x03,
+  0x2d, 0x03, 0x38, 0x03, 0x3d, 0x03, 0x40, 0x03, 0x42, 0x03, 0x49, 0x03,
+  0x52, 0x03, 0x59, 0x03, 0x61, 0x03, 0x6a, 0x03, 0x71, 0x03, 0x83, 0x03,
+  0x8c, 0x03, 0x96, 0x03, 0x9b, 0x03, 0xa1, 0x03, 0xa4, 0x03, 0xa9, 0x03,
+  0xb3, 0x03, 0xbb, 0x03, 0xbe, 0x03, 0xc2, 0x03, 0xc8, 0x03, 0xcd, 0x03,
+  0xe4, 0x03, 0xe7, 0x03, 0xed, 0x03, 0xf5, 0x03, 0xf7, 0x03, 0x07, 0x04,
+  0x0f, 0x04, 0x13, 0x04, 0x16, 0x04, 0x1f, 0x04, 0x25, 0x04, 0x2d, 0x04,
+  0x30, 0x04, 0x30, 0x04, 0x39, 0x04, 0x47, 0x04, 0x4b, 0x04, 0x50, 0x04,
+  0x51, 0x04, 0x58, 0x04, 0x5d, 0x04, 0x68, 0x04, 0x6c, 0x04, 0x70, 0x04,
+  0x74, 0x04, 0x78, 0x04, 0x7a, 0x04, 0x7d, 0x04, 0x7e, 0x04, 0x82, 0x04,
+  0x88, 0x04, 0x8c, 0x04, 0x94, 0x04, 0x9d, 0x04, 0x9e, 0x04, 0xa7, 0x04,
+  0xa9, 0x04, 0xaf, 0x04, 0xb5, 0x04, 0xb7, 0x04, 0xbd, 0x04, 0xc2, 0x04,
+  0xc5, 0x04, 0xc8, 0x04, 0xca, 0x04, 0xcb, 0x04, 0xcd, 0x04, 0xd8, 0x04,
+  0xdc, 0x04, 0xe3, 0x04, 0xe6, 0x04, 0xee, 0x04, 0xef, 0x04, 0xf7, 0x04,
+  0xfa, 0x04, 0xfc, 0x04, 0xfe, 0x04, 0x02, 0x05, 0x03, 0x05, 0x05, 0x05,
+  0x08, 0x05, 0x0b, 0x05, 0x10, 0x05, 0x15, 0x05, 0x18, 0x05, 0x21, 0x05,
+  0x25, 0x05, 0x2e, 0x05, 0x2e, 0x05, 0x33, 0x05, 0x39, 0x05, 0x39, 0x05,
+  0x40, 0x05, 0x41, 0x05, 0x42, 0x05, 0x44, 0x05, 0x47, 0x05, 0x4c, 0x05,
+  0x61, 0x05, 0x62, 0x05, 0x63, 0x05, 0x68, 0x05, 0x82, 0x05, 0x83, 0x05,
+  0x89, 0x05, 0x9a, 0x05, 0x9f, 0x05, 0xa2, 0x05, 0xa4, 0x05, 0xa6, 0x05,
+  0xad, 0x05, 0xb5, 0x05, 0xb7, 0x05, 0xbb, 0x05, 0xbc, 0x05, 0xc3, 0x05,
+  0xc4, 0x05, 0xcd, 0x05, 0xd0, 0x05, 0xda, 0x05, 0xdb, 0x05, 0xe0, 0x05,
+  0xe5, 0x05, 0xe8, 0x05, 0xe8, 0x05, 0xec, 0x05, 0xf3, 0x05, 0xf9, 0x05,
+  0xfe, 0x05, 0x1a, 0x06, 0x1b, 0x06, 0x24, 0x06, 0x2d, 0x06, 0x47, 0x06,
+  0x47, 0x06, 0x4d, 0x06, 0x4e, 0x06, 0x5c, 0x06, 0x5f, 0x06, 0x6b, 0x06,
+  0x6f, 0x06, 0x81, 0x06, 0x89, 0x06, 0x91, 0x06, 0x94, 0x06, 0x99, 0x06,
+  0x9b, 0x06, 0x9f, 0x06, 0xa6, 0x06, 0xaa, 0x06, 0xaf, 0x06, 0xb7, 0x06,
+  0xb8, 0x06, 0xbd, 0x06, 0xbf, 0x06, 0xc3, 0x06, 0xc7, 0x06, 0xcb, 0x06,
+  0xd0, 0x06, 0xd3, 0x06, 0xd7, 0x06, 0xdd, 0x06, 0xe4, 0x06, 0xe5, 0x06,
+  0xe9, 0x06, 0xee, 0x06, 0xef, 0x06, 0xf2, 0x06, 0xf7, 0x06, 0xfe, 0x06,
+  0x02, 0x07, 0x0a, 0x07, 0x0c, 0x07, 0x11, 0x07, 0x15, 0x07, 0x18, 0x07,
+  0x1c, 0x07, 0x25, 0x07, 0x26, 0x07, 0x2c, 0x07, 0x36, 0x07, 0x3b, 0x07,
+  0x3c, 0x07, 0x3f, 0x07, 0x44, 0x07, 0x47, 0x07, 0x49, 0x07, 0x51, 0x07,
+  0x54, 0x07, 0x5f, 0x07, 0x65, 0x07, 0x67, 0x07, 0x6a, 0x07, 0x6f, 0x07,
+  0x70, 0x07, 0x76, 0x07, 0x79, 0x07, 0x7c, 0x07, 0x7d, 0x07, 0x84, 0x07,
+  0x87, 0x07, 0x8b, 0x07, 0x8e, 0x07, 0x99, 0x07, 0x9b, 0x07, 0xa0, 0x07,
+  0xa4, 0x07, 0xa9, 0x07, 0xaf, 0x07, 0xb5, 0x07, 0xb5, 0x07, 0xbe, 0x07,
+  0xc5, 0x07, 0xc7, 0x07, 0xcb, 0x07, 0xd0, 0x07, 0xd2, 0x07, 0xdb, 0x07,
+  0xdd, 0x07, 0xe2, 0x07, 0xe4, 0x07, 0xee, 0x07, 0xf0, 0x07, 0xfe, 0x07,
+  0x00, 0x08, 0x06, 0x08, 0x11, 0x08, 0x19, 0x08, 0x1e, 0x08, 0x23, 0x08,
+  0x30, 0x08, 0x35, 0x08, 0x38, 0x08, 0x41, 0x08, 0x46, 0x08, 0x4a, 0x08,
+  0x52, 0x08, 0x5a, 0x08, 0x69, 0x08, 0x6c, 0x08, 0x71, 0x08, 0x78, 0x08,
+  0x7b, 0x08, 0x7f, 0x08, 0x82, 0x08, 0x88, 0x08, 0x89, 0x08, 0x8d, 0x08,
+  0x94, 0x08, 0x95, 0x08, 0x97, 0x08, 0x9a, 0x08, 0x9d, 0x08, 0xa2, 0x08,
+  0xa8, 0x08, 0xac, 0x08, 0xb8, 0x08, 0xbc, 0x08, 0xc4, 0x08, 0xc5, 0x08,
+  0xcb, 0x08, 0xcf, 0x08, 0xda, 0x08, 0xe8, 0x08, 0xeb, 0x08, 0xee, 0x08,
+  0xf6, 0x08, 0xfd, 0x08, 0x07, 0x09, 0x0a, 0x09, 0x15, 0x09, 0x1c, 0x09,
+  0x26, 0x09, 0x28, 0x09, 0x2a, 0x09, 0x2c, 0x09, 0x31, 0x09, 0x3f, 0x09,
+  0x43, 0x09, 0x4f, 0x09, 0x56, 0x09, 0x5e, 0x09, 0x68, 0x09, 0x6b, 0x09,
+  0x7a, 0x09, 0x7b, 0x09, 0x81, 0x09, 0x8b, 0x09, 0x97, 0x09, 0x9c, 0x09,
+  0xb9, 0x09, 0xbe, 0x09, 0xc7, 0x09, 0xc8, 0x09, 0xcf, 0x09, 0xd4, 0x09,
+  0xd5, 0x09, 0xd8, 0x09, 0xd9, 0x09, 0xde, 0x09, 0xe3, 0x09, 0xea, 0x09,
+  0xeb, 0x09, 0xed, 0x09, 0xf2, 0x09, 0xf4, 0x09, 0xf6, 0x09, 0xfa, 0x09,
+  0x05, 0x0a, 0x09, 0x0a, 0x0b, 0x0a, 0x0f, 0x0a, 0x17, 0x0a, 0x18, 0x0a,
+  0x1c, 0x0a, 0x1e, 0x0a, 0x23, 0x0a, 0x25, 0x0a, 0x29, 0x0a, 0x30, 0x0a,
+  0x37, 0x0a, 0x3b, 0x0a, 0x4d, 0x0a, 0x4e, 0x0a, 0x57, 0x0a, 0x59, 0x0a,
+  0x64, 0x0a, 0x6a, 0x0a, 0x6d, 0x0a, 0x6f, 0x0a, 0x70, 0x0a, 0x7c, 0x0a,
+  0x82, 0x0a, 0x83, 0x0a, 0x8a, 0x0a, 0x8d, 0x0a, 0x96, 0x0a, 0x99, 0x0a,
+  0xa5, 0x0a, 0xad, 0x0a, 0xb6, 0x0a, 0xb7, 0x0a, 0xc1, 0x0a, 0xc5, 0x0a,
+  0xcd, 0x0a, 0xcd, 0x0a, 0xcf, 0x0a, 0xd1, 0x0a, 0xd2, 0x0a, 0xd4, 0x0a,
+  0xd6, 0x0a, 0xde, 0x0a, 0xe9, 0x0a, 0xf2, 0x0a, 0xf6, 0x0a, 0xfd, 0x0a,
+  0x06, 0x0b, 0x15, 0x0b, 0x19, 0x0b, 0x20, 0x0b, 0x26, 0x0b, 0x2b, 0x0b,
+  0x2d, 0x0b, 0x31, 0x0b, 0x33, 0x0b, 0x35, 0x0b, 0x38, 0x0b, 0x3c, 0x0b,
+  0x43, 0x0b, 0x46, 0x0b, 0x4d, 0x0b, 0x52, 0x0b, 0x54, 0x0b, 0x55, 0x0b,
+  0x62, 0x0b, 0x68, 0x0b, 0x6e, 0x0b, 0x71, 0x0b, 0x74, 0x0b, 0x77, 0x0b,
+  0x7e, 0x0b, 0x80, 0x0b, 0x8c, 0x0b, 0x94, 0x0b, 0x98, 0x0b, 0x9b, 0x0b,
+  0xa5, 0x0b, 0xa8, 0x0b, 0xba, 0x0b, 0xbc, 0x0b, 0xc3, 0x0b, 0xca, 0x0b,
+  0xe5, 0x0b, 0xeb, 0x0b, 0xf1, 0x0b, 0x00, 0x0c, 0x05, 0x0c, 0x06, 0x0c,
+  0x08, 0x0c, 0x0a, 0x0c, 0x11, 0x0c, 0x1f, 0x0c, 0x22, 0x0c, 0x28, 0x0c,
+  0x2d, 0x0c, 0x33, 0x0c, 0x36, 0x0c, 0x40, 0x0c, 0x45, 0x0c, 0x47, 0x0c,
+  0x52, 0x0c, 0x5c, 0x0c, 0x65, 0x0c, 0x6b, 0x0c, 0x6e, 0x0c, 0x71, 0x0c,
+  0x75, 0x0c, 0x77, 0x0c, 0x7d, 0x0c, 0x83, 0x0c, 0x8f, 0x0c, 0x90, 0x0c,
+  0x9e, 0x0c, 0xa3, 0x0c, 0xaa, 0x0c, 0xae, 0x0c, 0xb7, 0x0c, 0xb9, 0x0c,
+  0xbc, 0x0c, 0xbd, 0x0c, 0xcd, 0x0c, 0xd1, 0x0c, 0xd3, 0x0c, 0xdc, 0x0c,
+  0xe3, 0x0c, 0xeb, 0x0c, 0xed, 0x0c, 0xf1, 0x0c, 0xfa, 0x0c, 0x0a, 0x0d,
+  0x0f, 0x0d, 0x11, 0x0d, 0x17, 0x0d, 0x1a, 0x0d, 0x21, 0x0d, 0x22, 0x0d,
+  0x32, 0x0d, 0x3f, 0x0d, 0x40, 0x0d, 0x41, 0x0d, 0x45, 0x0d, 0x47, 0x0d,
+  0x47, 0x0d, 0x48, 0x0d, 0x4d, 0x0d, 0x52, 0x0d, 0x55, 0x0d, 0x55, 0x0d,
+  0x5f, 0x0d, 0x63, 0x0d, 0x67, 0x0d, 0x69, 0x0d, 0x77, 0x0d, 0x7c, 0x0d,
+  0x80, 0x0d, 0x86, 0x0d, 0x8c, 0x0d, 0x8f, 0x0d, 0x91, 0x0d, 0x93, 0x0d,
+  0x9e, 0x0d, 0xa2, 0x0d, 0xa5, 0x0d, 0xa6, 0x0d, 0xa7, 0x0d, 0xab, 0x0d,
+  0xb5, 0x0d, 0xb8, 0x0d, 0xca, 0x0d, 0xcd, 0x0d, 0xcf, 0x0d, 0xd4, 0x0d,
+  0xd6, 0x0d, 0xde, 0x0d, 0xe2, 0x0d, 0xec, 0x0d, 0xef, 0x0d, 0xf5, 0x0d,
+  0xff, 0x0d, 0x0d, 0x0e, 0x14, 0x0e, 0x19, 0x0e, 0x24, 0x0e, 0x28, 0x0e,
+  0x2a, 0x0e, 0x2d, 0x0e, 0x30, 0x0e, 0x36, 0x0e, 0x3d, 0x0e, 0x3f, 0x0e,
+  0x41, 0x0e, 0x43, 0x0e, 0x46, 0x0e, 0x47, 0x0e, 0x4b, 0x0e, 0x4f, 0x0e,
+  0x4f, 0x0e, 0x53, 0x0e, 0x57, 0x0e, 0x5a, 0x0e, 0x63, 0x0e, 0x6c, 0x0e,
+  0x72, 0x0e, 0x7d, 0x0e, 0x81, 0x0e, 0x94, 0x0e, 0x96, 0x0e, 0xa0, 0x0e,
+  0xa6, 0x0e, 0xaf, 0x0e, 0xb2, 0x0e, 0xbe, 0x0e, 0xc6, 0x0e, 0xd3, 0x0e,
+  0xd6, 0x0e, 0xdc, 0x0e, 0xdd, 0x0e, 0xe2, 0x0e, 0xe5, 0x0e, 0xe8, 0x0e,
+  0xef, 0x0e, 0xff, 0x0e, 0x01, 0x0f, 0x09, 0x0f, 0x0c, 0x0f, 0x0f, 0x0f,
+  0x10, 0x0f, 0x16, 0x0f, 0x1f, 0x0f, 0x26, 0x0f, 0x2b, 0x0f, 0x30, 0x0f,
+  0x32, 0x0f, 0x3f, 0x0f, 0x42, 0x0f, 0x48, 0x0f, 0x4d, 0x0f, 0x5a, 0x0f,
+  0x5d, 0x0f, 0x6c, 0x0f, 0x74, 0x0f, 0x7e, 0x0f, 0x7f, 0x0f, 0x95, 0x0f,
+  0x9b, 0x0f, 0xa2, 0x0f, 0xa5, 0x0f, 0xa8, 0x0f, 0xb1, 0x0f, 0xc0, 0x0f,
+  0xc7, 0x0f, 0xd0, 0x0f, 0xda, 0x0f, 0xeb, 0x0f, 0xfb, 0x0f, 0x06, 0x10,
+  0x0c, 0x10, 0x16, 0x10, 0x1d, 0x10, 0x25, 0x10, 0x2c, 0x10, 0x31, 0x10,
+  0x37, 0x10, 0x3c, 0x10, 0x42, 0x10, 0x4b, 0x10, 0x54, 0x10, 0x5e, 0x10,
+  0x68, 0x10, 0x75, 0x10, 0x7e, 0x10, 0x90, 0x10, 0x99, 0x10, 0xa7, 0x10,
+  0xb1, 0x10, 0xd1, 0x10, 0xdc, 0x10, 0xe7, 0x10, 0xef, 0x10, 0xf5, 0x10,
+  0x01, 0x11, 0x09, 0x11, 0x13, 0x11, 0x23, 0x11, 0x32, 0x11, 0x51, 0x11,
+  0x5a, 0x11, 0x6c, 0x11, 0x77, 0x11, 0x99, 0x11, 0xa2, 0x11, 0xa8, 0x11,
+  0xb0, 0x11, 0xba, 0x11, 0xc3, 0x11, 0xcc, 0x11, 0xd8, 0x11, 0xe5, 0x11,
+  0xf0, 0x11, 0xfc, 0x11, 0x07, 0x12, 0x1c, 0x12, 0x36, 0x12, 0x44, 0x12,
+  0x53, 0x12, 0x63, 0x12, 0x80, 0x12, 0x8f, 0x12, 0x97, 0x12, 0xaa, 0x12,
+  0xb8, 0x12, 0xc1, 0x12, 0xcf, 0x12, 0xde, 0x12, 0xeb, 0x12, 0x00, 0x13,
+  0x08, 0x13, 0x1e, 0x13, 0x29, 0x13, 0x38, 0x13, 0x3f, 0x13, 0x51, 0x13,
+  0x5b, 0x13, 0x68, 0x13, 0x71, 0x13, 0x7e, 0x13, 0x8e, 0x13, 0x9b, 0x13,
+  0xad, 0x13, 0xb9, 0x13, 0xc4, 0x13, 0xce, 0x13, 0xdb, 0x13, 0xf6, 0x13,
+  0x05, 0x14, 0x13, 0x14, 0x21, 0x14, 0x48, 0x14, 0x56, 0x14, 0x64, 0x14,
+  0x6f, 0x14, 0x7b, 0x14, 0x89, 0x14, 0x98, 0x14, 0xa2, 0x14, 0xb2, 0x14,
+  0xbc, 0x14, 0xc9, 0x14, 0xd1, 0x14, 0xd9, 0x14, 0xe3, 0x14, 0xf0, 0x14,
+  0xfa, 0x14, 0x06, 0x15, 0x10, 0x15, 0x1e, 0x15, 0x27, 0x15, 0x30, 0x15,
+  0x40, 0x15, 0x4c, 0x15, 0x55, 0x15, 0x5d, 0x15, 0x68, 0x15, 0x75, 0x15,
+  0x7f, 0x15, 0x8b, 0x15, 0x94, 0x15, 0xa8, 0x15, 0xb2, 0x15, 0xba, 0x15,
+  0xc5, 0x15, 0xd1, 0x15, 0xdb, 0x15, 0xe6, 0x15, 0xef, 0x15, 0xfe, 0x15,
+  0x08, 0x16, 0x12, 0x16, 0x25, 0x16, 0x30, 0x16, 0x39, 0x16, 0x40, 0x16,
+  0x48, 0x16, 0x56, 0x16, 0x5d, 0x16, 0x67, 0x16, 0x74, 0x16, 0x7c, 0x16,
+  0x91, 0x16, 0x9e, 0x16, 0xa8, 0x16, 0xb3, 0x16, 0xb9, 0x16, 0xc2, 0x16,
+  0xc7, 0x16, 0xce, 0x16, 0xd5, 0x16, 0xd9, 0x16, 0xdd, 0x16, 0xe3, 0x16,
+  0xe6, 0x16, 0xec, 0x16, 0xf2, 0x16, 0xfc, 0x16, 0x03, 0x17, 0x0d, 0x17,
+  0x17, 0x17, 0x22, 0x17, 0x2d, 0x17, 0x34, 0x17, 0x3f, 0x17, 0x49, 0x17,
+  0x4f, 0x17, 0x56, 0x17, 0x5c, 0x17, 0x6a, 0x17, 0x6c, 0x17, 0x72, 0x17,
+  0x77, 0x17, 0x7b, 0x17, 0x85, 0x17, 0x8f, 0x17, 0x93, 0x17, 0x9d, 0x17,
+  0xa2, 0x17, 0xaa, 0x17, 0xaf, 0x17, 0xb3, 0x17, 0xc0, 0x17, 0xc4, 0x17,
+  0xd7, 0x17, 0xdc, 0x17, 0xe8, 0x17, 0xec, 0x17, 0xfa, 0x17, 0x02, 0x18,
+  0x0c, 0x18, 0x18, 0x18, 0x23, 0x18, 0x29, 0x18, 0x32, 0x18, 0x3e, 0x18,
+  0x53, 0x18, 0x5e, 0x18, 0x68, 0x18, 0x71, 0x18, 0x79, 0x18, 0x86, 0x18,
+  0x8e, 0x18, 0x92, 0x18, 0x95, 0x18, 0x9a, 0x18, 0xa3, 0x18, 0xab, 0x18,
+  0xb2, 0x18, 0xb4, 0x18, 0xb7, 0x18, 0xc0, 0x18, 0xcb, 0x18, 0xd3, 0x18,
+  0xe6, 0x18, 0xec, 0x18, 0xff, 0x18, 0x09, 0x19, 0x15, 0x19, 0x1e, 0x19,
+  0x2d, 0x19, 0x37, 0x19, 0x45, 0x19, 0x4f, 0x19, 0x5c, 0x19, 0x67, 0x19,
+  0x73, 0x19, 0x7f, 0x19, 0x90, 0x19, 0x97, 0x19, 0xa4, 0x19, 0xaa, 0x19,
+  0xb0, 0x19, 0xba, 0x19, 0xc3, 0x19, 0xc7, 0x19, 0xce, 0x19, 0xd9, 0x19,
+  0xe5, 0x19, 0xeb, 0x19, 0xfb, 0x19, 0x07, 0x1a, 0x0e, 0x1a, 0x13, 0x1a,
+  0x1b, 0x1a, 0x23, 0x1a, 0x30, 0x1a, 0x35, 0x1a, 0x4e, 0x1a, 0x52, 0x1a,
+  0x60, 0x1a, 0x64, 0x1a, 0x77, 0x1a, 0x81, 0x1a, 0x84, 0x1a, 0x8a, 0x1a,
+  0x90, 0x1a, 0x95, 0x1a, 0xa2, 0x1a, 0xab, 0x1a, 0xb4, 0x1a, 0xb7, 0x1a,
+  0xbe, 0x1a, 0xc2, 0x1a, 0xd2, 0x1a, 0xd9, 0x1a, 0xde, 0x1a, 0xe1, 0x1a,
+  0xed, 0x1a, 0xf0, 0x1a, 0xfa, 0x1a, 0xfd, 0x1a, 0xff, 0x1a, 0x01, 0x1b,
+  0x04, 0x1b, 0x05, 0x1b, 0x0b, 0x1b, 0x12, 0x1b, 0x1e, 0x1b, 0x1e, 0x1b,
+  0x33, 0x1b, 0x34, 0x1b, 0x40, 0x1b, 0x41, 0x1b, 0x56, 0x1b, 0x58, 0x1b,
+  0x59, 0x1b, 0x5b, 0x1b, 0x5d, 0x1b, 0x5e, 0x1b, 0x5e, 0x1b, 0x5e, 0x1b,
+  0x5e, 0x1b, 0x60, 0x1b, 0x67, 0x1b, 0x6b, 0x1b, 0x77, 0x1b, 0x7a, 0x1b,
+  0x80, 0x1b, 0x89, 0x1b, 0x9a, 0x1b, 0x9d, 0x1b, 0xa5, 0x1b, 0xae, 0x1b,
+  0xaf, 0x1b, 0xaf, 0x1b, 0xaf, 0x1b, 0xb0, 0x1b, 0xb2, 0x1b, 0xbc, 0x1b,
+  0xbf, 0x1b, 0xd0, 0x1b, 0xd2, 0x1b, 0xd8, 0x1b, 0xe3, 0x1b, 0xfa, 0x1b,
+  0x00, 0x1c, 0x0a, 0x1c, 0x0a, 0x1c, 0x0e, 0x1c, 0x11, 0x1c, 0x14, 0x1c,
+  0x17, 0x1c, 0x1a, 0x1c, 0x1c, 0x1c, 0x1d, 0x1c, 0x21, 0x1c, 0x23, 0x1c,
+  0x29, 0x1c, 0x2f, 0x1c, 0x3c, 0x1c, 0x40, 0x1c, 0x42, 0x1c, 0x47, 0x1c,
+  0x52, 0x1c, 0x00, 0x00, 0x2b, 0xe3, 0x32, 0xaf, 0x5d, 0x8c, 0x02, 0x63,
+  0x5c, 0x31, 0xbd, 0xd2, 0x38, 0x31, 0x3e, 0xc6, 0x70, 0x35, 0x0b, 0xfe,
+  0x76, 0x99, 0xde, 0xc6, 0x5f, 0x5f, 0xee, 0x59, 0x48, 0xa1, 0x34, 0x34,
+  0x2e, 0x17, 0x17, 0x17, 0x23, 0x3f, 0x27, 0xb9, 0x17, 0x17, 0x17, 0x17,
+  0x6b, 0x36, 0x14, 0xa5, 0x54, 0x54, 0xd8, 0x4e, 0x52, 0xd3, 0xff, 0x36,
+  0xdf, 0x36, 0xed, 0x17, 0x5d, 0x77, 0x21, 0xf4, 0xf3, 0x16, 0x7d, 0x47,
+  0x4e, 0x4c, 0x41, 0xda, 0x15, 0x48, 0xcb, 0xa1, 0xc0, 0x4d, 0x90, 0x63,
+  0x19, 0x56, 0x4f, 0x4f, 0x55, 0xb2, 0x84, 0xd5, 0x1b, 0x29, 0xc0, 0x14,
+  0xb5, 0x03, 0xe0, 0x1b, 0x3e, 0x16, 0x1a, 0x00, 0xed, 0xb6, 0xa3, 0x33,
+  0x5b, 0x6a, 0x3f, 0xe2, 0xe2, 0x1c, 0x32, 0x32, 0xbb, 0xbb, 0xd2, 0x02,
+  0xad, 0x3d, 0x3d, 0x3d, 0x3d, 0x5a, 0x64, 0x6b, 0x9a, 0xef, 0x56, 0xd2,
+  0x89, 0x54, 0x52, 0x79, 0x67, 0xe3, 0x75, 0xc2, 0xa6, 0x22, 0x71, 0x27,
+  0xe8, 0x5c, 0xf0, 0xef, 0x0b, 0xc9, 0x4c, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
+  0x3d, 0x3d, 0x3d, 0x3d, 0x78, 0xaf, 0x55, 0xaf, 0xb4, 0xb4, 0x5a, 0x5a,
+  0x49, 0x25, 0x65, 0xc0, 0x10, 0xff, 0x3d, 0x3d, 0x9f, 0xe4, 0x6a, 0x1b,
+  0x22, 0x6a, 0x96, 0xdc, 0xdc, 0x6e, 0xdd, 0x06, 0x7a, 0x6a, 0xc9, 0x21,
+  0x17, 0x0d, 0x38, 0xa7, 0xb5, 0xc3, 0x9f, 0x94, 0x1e, 0xe2, 0x08, 0x66,
+  0x66, 0xc0, 0x0b, 0xb7, 0x82, 0xe0, 0x04, 0x2c, 0x4c, 0xfe, 0x90, 0x63,
+  0xfb, 0x42, 0x62, 0x19, 0xaa, 0xc1, 0x16, 0xf3, 0x81, 0xb4, 0xe9, 0xa5,
+  0xb8, 0xe9, 0x92, 0x48, 0x6b, 0x6e, 0xf6, 0x71, 0xd2, 0x4c, 0x5d, 0xd9,
+  0x3a, 0xdb, 0xb3, 0x64, 0x1e, 0x53, 0xe5, 0xc4, 0xc4, 0xc4, 0xc4, 0xc4,
+  0xc4, 0xec, 0x77, 0xc5, 0xdd, 0x60, 0xc4, 0x65, 0x70, 0x45, 0x04, 0x52,
+  0xe3, 0xe2, 0xd2, 0x03, 0xc1, 0x25, 0xd1, 0x3c, 0x3c, 0x4b, 0xf0, 0x50,
+  0xfd, 0xd1, 0xaf, 0x12, 0x1b, 0x51, 0xc1, 0x6d, 0x6d, 0xca, 0x01, 0x01,
+  0x13, 0xac, 0x6d, 0x7a, 0x7a, 0x65, 0xee, 0xd0, 0x6c, 0x8f, 0xd2, 0xbe,
+  0xff, 0x41, 0xfc, 0xe5, 0x52, 0x24, 0x26, 0xa9, 0xe4, 0x28, 0x28, 0x8c,
+  0x0b, 0x66, 0x0b, 0xf5, 0xff, 0x13, 0xae, 0x17, 0x17, 0x17, 0xff, 0xe1,
+  0x32, 0xf1, 0xbe, 0x35, 0x41, 0x68, 0xfc, 0xfc, 0xb0, 0x69, 0x24, 0x82,
+  0x82, 0x82, 0x43, 0xfb, 0x75, 0xae, 0xcc, 0x43, 0x0b, 0x8a, 0x4f, 0xd3,
+  0xd3, 0x74, 0xe3, 0x69, 0x86, 0x14, 0x03, 0xeb, 0xf1, 0xf0, 0xe9, 0xf2,
+  0xf2, 0x18, 0x29, 0x5b, 0xb4, 0x0d, 0x88, 0xc1, 0xef, 0x99, 0xc0, 0x33,
+  0x33, 0xc8, 0x03, 0xc9, 0xe3, 0xe3, 0xe3, 0xcc, 0xdf, 0xc1, 0xa6, 0x39,
+  0x39, 0x39, 0xeb, 0x2d, 0xb6, 0x30, 0x3f, 0x19, 0xcb, 0x79, 0x90, 0x5f,
+  0x4a, 0x8c, 0x8d, 0x34, 0x51, 0xd7, 0x66, 0xc5, 0x4d, 0x6d, 0x3b, 0x94,
+  0xc9, 0xc9, 0x25, 0xf9, 0x85, 0x4f, 0x4f, 0x37, 0xda, 0x11, 0x29, 0x82,
+  0xe0, 0xf0, 0xb6, 0x70, 0x9e, 0xc5, 0xe8, 0xb6, 0xb2, 0xc5, 0xf3, 0xe0,
+  0x31, 0xf4, 0x84, 0x05, 0xa8, 0xa8, 0x8a, 0x8e, 0xad, 0xe2, 0xe8, 0x96,
+  0xf0, 0xf0, 0xec, 0x59, 0xc8, 0x2a, 0xb8, 0xa5, 0x89, 0xb3, 0xd6, 0x07,
+  0xa9, 0xfb, 0x7a, 0xf6, 0xf6, 0xf6, 0x1c, 0x1c, 0x48, 0x9a, 0xa1, 0xde,
+  0xe3, 0xe4, 0x05, 0x1a, 0x1c, 0xa8, 0xfc, 0xc8, 0x9d, 0x9d, 0x27, 0x9d,
+  0x5b, 0x51, 0x9a, 0x00, 0xe9, 0x09, 0xd7, 0xca, 0x81, 0xee, 0x36, 0x71,
+  0x78, 0x4c, 0x22, 0xe3, 0xcf, 0xa6, 0x21, 0x21, 0xa7, 0xc7, 0x3e, 0xc4,
+  0x3e, 0xf2, 0x3b, 0x3b, 0xad, 0xfe, 0xc7, 0x37, 0x49, 0xb6, 0xee, 0x9a,
+  0x82, 0x72, 0x1f, 0x2b, 0x44, 0x9f, 0x18, 0xee, 0x5a, 0xd2, 0x20, 0x69,
+  0x0c, 0x16, 0x6b, 0x3d, 0x5b, 0x57, 0x75, 0xaa, 0x31, 0x74, 0xff, 0xde,
+  0xef, 0xac, 0x58, 0xbe, 0x26, 0x26, 0x26, 0xef, 0xe7, 0x00, 0x40, 0x1d,
+  0x1d, 0xc2, 0xc6, 0xa4, 0x53, 0x17, 0x8d, 0xc4, 0x93, 0x7f, 0x9d, 0x07,
+  0x9e, 0xd7, 0xd7, 0x0c, 0x39, 0x7d, 0x7d, 0xae, 0x6d, 0xae, 0x38, 0xc9,
+  0x24, 0x37, 0x8a, 0x10, 0x3f, 0x02, 0x12, 0xa3, 0x6f, 0xd7, 0xd7, 0xd7,
+  0x78, 0x1b, 0x3b, 0x38, 0x38, 0x38, 0xfc, 0x46, 0xd0, 0x77, 0x68, 0xf4,
+  0x86, 0x0b, 0xb4, 0x2f, 0x74, 0xe1, 0x30, 0x77, 0x80, 0xa6, 0xc8, 0x4a,
+  0x5f, 0xa6, 0xc9, 0xa1, 0xe2, 0x2b, 0xd6, 0xe3, 0xae, 0x3a, 0x54, 0x60,
+  0x56, 0x2c, 0x5e, 0x02, 0x94, 0x1e, 0xc4, 0x74, 0x5f, 0xd7, 0x6c, 0x6b,
+  0x01, 0xff, 0xff, 0xd2, 0xae, 0x45, 0xa5, 0xf5, 0x61, 0x61, 0xfb, 0x09,
+  0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x76, 0xfd, 0x94, 0x4c, 0x87, 0x84,
+  0xa1, 0x49, 0x57, 0x57, 0x57, 0x57, 0x71, 0x36, 0x8e, 0x8e, 0xa5, 0xe7,
+  0x7a, 0x2c, 0x84, 0xde, 0x0a, 0x1a, 0x58, 0x47, 0x29, 0x93, 0xb6, 0x15,
+  0xce, 0x6e, 0x66, 0x7a, 0x3d, 0x68, 0xf2, 0x39, 0x16, 0xcf, 0xaa, 0x76,
+  0xc3, 0x63, 0x35, 0x77, 0x25, 0xc3, 0x60, 0xf5, 0x06, 0x5f, 0xce, 0x9c,
+  0x1e, 0xa8, 0x94, 0x8f, 0x86, 0x2b, 0x1d, 0x90, 0x77, 0x80, 0x1b, 0x0a,
+  0x49, 0xc4, 0x36, 0x4c, 0x73, 0xe7, 0x5a, 0xf5, 0x9d, 0x13, 0x63, 0xef,
+  0xc2, 0x38, 0xd4, 0x96, 0x22, 0x09, 0xc7, 0x64, 0xfe, 0x01, 0x01, 0x7b,
+  0xdd, 0x81, 0xa3, 0x30, 0x4f, 0x4c, 0xa0, 0x67, 0x6f, 0xc0, 0xf5, 0x05,
+  0x5d, 0xf1, 0x4d, 0xa4, 0xbe, 0x78, 0x53, 0xa2, 0xfe, 0x49, 0xdc, 0x5d,
+  0xf3, 0x55, 0x26, 0xfc, 0xdf, 0x8e, 0x6a, 0x6b, 0x2e, 0xb0, 0xc2, 0x70,
+  0x12, 0x26, 0x00, 0x2c, 0x27, 0x38, 0xf5, 0x13, 0x7d, 0xe4, 0x51, 0x79,
+  0xe5, 0x80, 0x17, 0x9a, 0xbe, 0x89, 0x0f, 0x10, 0x1a, 0xd5, 0x32, 0x1d,
+  0x6e, 0x7f, 0xf4, 0x9c, 0x05, 0x07, 0x3e, 0xb3, 0xa7, 0xd7, 0x06, 0xf3,
+  0xf2, 0xb9, 0xfb, 0x14, 0x8c, 0xe6, 0xf9, 0x2f, 0x79, 0x8e, 0x7b, 0xa3,
+  0x72, 0x25, 0x39, 0x62, 0xb8, 0x72, 0xdf, 0x01, 0xc4, 0x66, 0xd5, 0x26,
+  0xab, 0x2f, 0xdd, 0x95, 0xad, 0xd8, 0xde, 0x0b, 0x58, 0xb2, 0x2f, 0x89,
+  0xb7, 0x98, 0x36, 0x8b, 0xb7, 0xa9, 0xab, 0x1b, 0x0a, 0xbe, 0xfd, 0x24,
+  0xf4, 0xf4, 0xf4, 0xf4, 0x4d, 0xc3, 0x91, 0xb0, 0xda, 0x2c, 0x5e, 0xf3,
+  0x6e, 0x5e, 0xc8, 0x57, 0x24, 0x4d, 0xdc, 0x6b, 0xcf, 0x65, 0x79, 0x02,
+  0x99, 0x3d, 0xf3, 0x5e, 0x9e, 0x28, 0x91, 0xa7, 0x9b, 0xf9, 0xab, 0xdf,
+  0xd6, 0x2d, 0x83, 0x09, 0xcc, 0xb3, 0xc0, 0x45, 0x0f, 0x51, 0xbd, 0xb5,
+  0x27, 0xf2, 0x29, 0x4c, 0x06, 0xb4, 0x9e, 0x48, 0xb4, 0xbd, 0xf2, 0xed,
+  0xd8, 0x41, 0x95, 0xe3, 0x9b, 0x43, 0x4f, 0xc1, 0x11, 0xe2, 0x1b, 0x79,
+  0x1b, 0x0f, 0x81, 0x77, 0x26, 0x24, 0x34, 0x56, 0xf3, 0xe6, 0xd9, 0xa5,
+  0x94, 0xa9, 0x58, 0x24, 0x09, 0xd5, 0xbe, 0x28, 0x18, 0xaa, 0x40, 0x9a,
+  0x49, 0xb4, 0x32, 0xfe, 0x72, 0x3a, 0xaf, 0x62, 0x1a, 0x05, 0x71, 0xd9,
+  0x1e, 0x7b, 0x25, 0x56, 0xe3, 0xaa, 0xb4, 0x90, 0xaf, 0xb5, 0x1e, 0xa8,
+  0xf6, 0x59, 0xc9, 0x18, 0x18, 0x25, 0xc0, 0xaf, 0xd3, 0x13, 0xfc, 0x26,
+  0x17, 0x05, 0x61, 0xdc, 0x75, 0x5a, 0xf9, 0x81, 0xad, 0x25, 0x6e, 0xea,
+  0xf2, 0xff, 0x90, 0xbe, 0x91, 0x29, 0x62, 0x6c, 0x6c, 0x6c, 0x95, 0x3b,
+  0x10, 0xbb, 0x48, 0xf8, 0x05, 0x70, 0xef, 0x0b, 0x0b, 0xd8, 0x04, 0xe9,
+  0x89, 0x94, 0xe0, 0xf7, 0x08, 0x7c, 0xae, 0x2c, 0x37, 0x65, 0xff, 0x09,
+  0x85, 0xb6, 0x36, 0x9d, 0xc5, 0xfd, 0x37, 0x98, 0xbe, 0x72, 0x83, 0xb5,
+  0xdf, 0xcf, 0x04, 0x0d, 0x8c, 0x54, 0x44, 0xaa, 0xf6, 0xfb, 0x1c, 0x46,
+  0xb3, 0x92, 0xfe, 0x9f, 0xdd, 0x41, 0x21, 0x23, 0xf2, 0x15, 0xc1, 0x01,
+  0x8c, 0x01, 0x19, 0xeb, 0xeb, 0x41, 0xbf, 0x45, 0x2d, 0xa4, 0x30, 0xa5,
+  0xda, 0xbe, 0x42, 0x42, 0x0a, 0x00, 0x7b, 0x47, 0xcf, 0x32, 0xbe, 0xfa,
+  0xb1, 0x60, 0x0f, 0x0f, 0xd7, 0x37, 0x1e, 0x7c, 0xc1, 0x79, 0x4d, 0x4d,
+  0x8c, 0x8c, 0x1c, 0xf2, 0x31, 0xde, 0x11, 0x3c, 0xb7, 0x57, 0xdf, 0xba,
+  0x0a, 0x5a, 0x90, 0x8e, 0x83, 0x3c, 0x87, 0x55, 0xd8, 0xac, 0x7d, 0x2c,
+  0x31, 0x54, 0x54, 0x0a, 0x2b, 0xf9, 0xda, 0x45, 0x14, 0x04, 0xd6, 0xfd,
+  0x5f, 0xf2, 0xbd, 0x41, 0x5e, 0xdd, 0xb2, 0x2c, 0x4d, 0x80, 0x0d, 0xf5,
+  0x7f, 0xdf, 0x21, 0x3f, 0x3f, 0x9c, 0x35, 0xfd, 0x2e, 0x03, 0x1d, 0x81,
+  0x8b, 0x66, 0xc9, 0xf1, 0x0b, 0x3e, 0x04, 0x3f, 0xc9, 0x44, 0x07, 0x15,
+  0x19, 0x19, 0x0b, 0x83, 0x41, 0x41, 0x6b, 0x16, 0x0b, 0x6d, 0x73, 0x59,
+  0xbb, 0x58, 0xa4, 0x22, 0xee, 0xe9, 0x9a, 0x43, 0x89, 0x02, 0x18, 0xad,
+  0x9e, 0x45, 0x90, 0x6b, 0xb2, 0xd3, 0x2f, 0x08, 0x5c, 0x8a, 0x92, 0x31,
+  0x63, 0x0b, 0xc1, 0xc0, 0x1c, 0xf4, 0xec, 0xb4, 0x4d, 0x5b, 0x43, 0xd6,
+  0x5f, 0x83, 0xbb, 0xe2, 0x12, 0xbe, 0x4d, 0xa4, 0x6e, 0x31, 0xa1, 0x19,
+  0x03, 0x73, 0x52, 0x44, 0xc3, 0x43, 0xc2, 0x58, 0x37, 0xbc, 0x38, 0x57,
+  0x03, 0xa7, 0xa9, 0xc8, 0xfa, 0x04, 0x46, 0xb6, 0xf2, 0x65, 0x08, 0xf6,
+  0x2e, 0xc2, 0xc2, 0xab, 0x38, 0xc2, 0xc5, 0xb0, 0xa0, 0x87, 0x17, 0xb5,
+  0xfa, 0xfa, 0x04, 0xff, 0x97, 0x1f, 0x9a, 0x9a, 0xb2, 0xb2, 0x51, 0xad,
+  0xc1, 0x9c, 0x54, 0xf9, 0xef, 0xc4, 0x00, 0x00, 0x44, 0xde, 0xe7, 0x27,
+  0x90, 0xcd, 0x66, 0x00, 0x00, 0xf0, 0xf8, 0x72, 0xee, 0x1c, 0x60, 0xd3,
+  0x9c, 0x0d, 0x10, 0x50, 0x04, 0x94, 0xae, 0xf5, 0x1d, 0x28, 0x8c, 0x8c,
+  0x98, 0x4d, 0x4d, 0x99, 0x7b, 0x9a, 0x2c, 0x8b, 0x3c, 0x3f, 0x2a, 0xd1,
+  0x11, 0xdf, 0xc2, 0x7a, 0x0b, 0x29, 0x12, 0x4a, 0xc4, 0x80, 0xba, 0xb8,
+  0x6f, 0x9d, 0x9e, 0x8f, 0x4f, 0xa1, 0xfe, 0x2d, 0xac, 0xfc, 0x6b, 0x7d,
+  0x75, 0xca, 0xf1, 0x53, 0x51, 0x9f, 0xfd, 0xfd, 0xae, 0xa1, 0x5f, 0x56,
+  0xf8, 0x99, 0x8b, 0x3f, 0x85, 0xfe, 0x4b, 0x46, 0x6a, 0x09, 0x73, 0x99,
+  0xe0, 0x3c, 0x86, 0x53, 0x8e, 0xef, 0x7c, 0xd2, 0x2e, 0x26, 0x9e, 0xe3,
+  0xe3, 0x15, 0x2a, 0x56, 0x42, 0xe4, 0xa9, 0xa9, 0x90, 0xef, 0x9a, 0x71,
+  0xcc, 0x5d, 0xef, 0xd4, 0xd4, 0x12, 0xde, 0x68, 0x68, 0x03, 0x7d, 0x6e,
+  0xed, 0xd7, 0x46, 0x1d, 0x79, 0x9e, 0x29, 0xeb, 0x55, 0xba, 0xd5, 0x30,
+  0x67, 0xb6, 0x97, 0x7f, 0x1b, 0xee, 0x7c, 0x9f, 0x1c, 0xb2, 0x01, 0x80,
+  0xd2, 0x75, 0x82, 0x85, 0x35, 0x69, 0xe8, 0xb0, 0x44, 0xc4, 0xa6, 0x0d,
+  0x4e, 0xeb, 0xb5, 0xe4, 0xb0, 0x91, 0xfd, 0x5f, 0x9f, 0xfb, 0xd4, 0xb9,
+  0x74, 0x74, 0x2f, 0x1a, 0xe4, 0x48, 0xae, 0x94, 0xaa, 0xe3, 0x77, 0x77,
+  0xb4, 0x82, 0x94, 0xdf, 0x22, 0xf6, 0xda, 0xda, 0x06, 0xd0, 0x93, 0xb9,
+  0x11, 0xe5, 0x82, 0xd2, 0x0e, 0x5f, 0xd8, 0xf1, 0x3c, 0x4a, 0x6d, 0x9b,
+  0xde, 0xd4, 0xd4, 0x8b, 0xbc, 0x8b, 0x37, 0x05, 0xda, 0x14, 0xc2, 0x5f,
+  0x27, 0x7e, 0x8d, 0x4f, 0xeb, 0x1e, 0xdd, 0xff, 0xaa, 0xff, 0x86, 0x86,
+  0x4c, 0xb0, 0x0c, 0x15, 0xea, 0x2a, 0x26, 0xd9, 0xa6, 0xcf, 0xbe, 0xec,
+  0xf1, 0xaf, 0xac, 0xaa, 0xc1, 0x5d, 0x2a, 0x6d, 0xa6, 0xbd, 0xad, 0x91,
+  0xaf, 0x13, 0xc4, 0xb6, 0x7d, 0xe3, 0x9c, 0x25, 0x29, 0xc6, 0x27, 0x6e,
+  0xf2, 0xe9, 0x0f, 0x20, 0xb1, 0x3e, 0x4f, 0x8d, 0x80, 0x8e, 0x9b, 0x61,
+  0x92, 0xcd, 0x53, 0x34, 0x34, 0xbd, 0x18, 0x5b, 0xdc, 0x44, 0x9a, 0xc2,
+  0xe5, 0xc3, 0x0a, 0x57, 0x8f, 0xf8, 0x06, 0x89, 0x62, 0x12, 0x9b, 0xf7,
+  0xf7, 0xcf, 0xa3, 0xa9, 0x60, 0x07, 0x31, 0x6b, 0x1e, 0x40, 0xe5, 0x0f,
+  0xec, 0x6a, 0x6a, 0x65, 0xb4, 0xbf, 0xcc, 0xcc, 0xd9, 0xfe, 0x41, 0xa4,
+  0xdf, 0x31, 0x0d, 0x23, 0x23, 0x23, 0x8a, 0xde, 0x7a, 0x2d, 0xec, 0x25,
+  0x26, 0x09, 0xdf, 0x57, 0x57, 0xda, 0x6c, 0x9b, 0x9b, 0x4a, 0x4a, 0x4a,
+  0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x36, 0x2d, 0x79, 0x7b, 0x8e,
+  0x8e, 0x4a, 0x4a, 0xa5, 0x63, 0xf3, 0x4a, 0x4f, 0x4f, 0x25, 0x21, 0xac,
+  0x3b, 0xce, 0xfb, 0x93, 0xae, 0x0d, 0x80, 0x65, 0xfb, 0xc8, 0x99, 0xac,
+  0x9f, 0xb8, 0xe7, 0x96, 0xc1, 0x08, 0xa5, 0x75, 0x19, 0x41, 0x9d, 0x19,
+  0x11, 0x10, 0x83, 0x83, 0xb7, 0x08, 0x32, 0xbb, 0xf3, 0x8c, 0xa4, 0x7c,
+  0xe8, 0x94, 0x85, 0x70, 0xeb, 0xeb, 0x2a, 0x9d, 0xb6, 0xea, 0x84, 0x84,
+  0xe3, 0xc7, 0x96, 0xd5, 0x41, 0x41, 0xef, 0xa7, 0x07, 0x0f, 0xc8, 0xaf,
+  0x8f, 0xb5, 0xde, 0x44, 0xf4, 0x23, 0x4e, 0x29, 0x33, 0xda, 0xfc, 0x25,
+  0xf1, 0x58, 0x0e, 0xae, 0x3e, 0x76, 0x53, 0x32, 0x35, 0xc3, 0xf6, 0x3b,
+  0xea, 0x6d, 0xe0, 0xe0, 0x0d, 0x31, 0x31, 0x31, 0x42, 0xd5, 0x2d, 0x2d,
+  0x1e, 0x6e, 0x65, 0xad, 0xe4, 0x6a, 0xb2, 0xb8, 0x62, 0xe3, 0x5f, 0xcb,
+  0x33, 0x81, 0x5c, 0x8d, 0x0d, 0x67, 0x92, 0xf8, 0x5e, 0xf1, 0x38, 0x8c,
+  0x51, 0x43, 0xf7, 0x8b, 0x47, 0x28, 0xfe, 0x9f, 0x47, 0x57, 0xc4, 0x35,
+  0xfc, 0xf6, 0xed, 0xec, 0xf5, 0x87, 0xd7, 0xc1, 0xeb, 0x25, 0x8c, 0xdd,
+  0x6f, 0x09, 0xb2, 0xb2, 0xda, 0xc1, 0xa0, 0xa0, 0x7c, 0x75, 0xa7, 0x59,
+  0xf3, 0xf3, 0xd1, 0xd1, 0x17, 0x8d, 0xb5, 0xb0, 0xc0, 0x00, 0xfe, 0xfe,
+  0x19, 0xdb, 0x06, 0x96, 0x0f, 0x0f, 0xc8, 0xe5, 0x6d, 0x6f, 0x2e, 0xd6,
+  0xd6, 0xc9, 0x2a, 0xd0, 0xec, 0xba, 0x71, 0x99, 0x0d, 0x79, 0x5a, 0x19,
+  0x2b, 0x0b, 0x57, 0x8a, 0x58, 0xfa, 0x38, 0x07, 0x78, 0x5e, 0x02, 0x48,
+  0x50, 0xd9, 0xc8, 0xa7, 0x85, 0xe3, 0x6f, 0xf3, 0x9f, 0x9f, 0x5a, 0x5a,
+  0x48, 0xfb, 0x2b, 0x3f, 0x4b, 0x99, 0x04, 0x02, 0x4c, 0x88, 0x65, 0xd4,
+  0xde, 0x77, 0x77, 0x77, 0x19, 0x69, 0x24, 0x0c, 0xeb, 0x9f, 0x18, 0x54,
+  0xa7, 0xce, 0x53, 0xcb, 0x87, 0x3e, 0x83, 0x0a, 0xe0, 0xba, 0xcc, 0x93,
+  0xf3, 0xb6, 0x5d, 0x2e, 0x42, 0xf8, 0x8c, 0x70, 0x9b, 0x37, 0x01, 0x42,
+  0xf1, 0x71, 0x0f, 0x22, 0x11, 0x13, 0xaa, 0xdc, 0xbb, 0xbf, 0x87, 0x63,
+  0xc7, 0xc7, 0xd8, 0xdf, 0x91, 0x12, 0x47, 0x4f, 0x84, 0x85, 0x89, 0x89,
+  0x38, 0xa7, 0x40, 0x19, 0x7f, 0xd7, 0x26, 0xbf, 0xf8, 0xe9, 0xfd, 0x1a,
+  0xfe, 0x32, 0x39, 0xb4, 0xa0, 0x69, 0x30, 0x87, 0xe0, 0xe0, 0x58, 0xca,
+  0x2c, 0xba, 0xdd, 0x3e, 0x1f, 0xcf, 0x33, 0xb3, 0x28, 0x55, 0xdb, 0x1e,
+  0x0a, 0x30, 0xab, 0x26, 0x35, 0xcf, 0x79, 0xf8, 0xfc, 0x47, 0xb8, 0x03,
+  0xe9, 0x25, 0x78, 0xd7, 0x17, 0x6c, 0xf8, 0x8c, 0xfd, 0x59, 0x58, 0x01,
+  0x01, 0x01, 0x3a, 0x91, 0x61, 0x28, 0x22, 0x6d, 0x52, 0x52, 0x52, 0x52,
+  0x52, 0x52, 0x52, 0x52, 0x52, 0xde, 0x31, 0x8c, 0x5e, 0xfc, 0xe3, 0xf9,
+  0x1f, 0x3d, 0x09, 0x7b, 0x28, 0x30, 0xdb, 0x61, 0x5a, 0x94, 0x2f, 0xc4,
+  0x90, 0xf8, 0xb2, 0x57, 0xab, 0x26, 0xf1, 0x76, 0x76, 0xa1, 0x99, 0x32,
+  0x32, 0xb4, 0xf0, 0xff, 0x40, 0x8b, 0x1b, 0xc8, 0x30, 0x73, 0xb0, 0x2a,
+  0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0xb5, 0xb1, 0x49, 0x97, 0x4b, 0xa8, 0x23,
+  0xc1, 0xe0, 0xc7, 0x9c, 0xf6, 0x05, 0xc6, 0xfe, 0xde, 0xde, 0xd5, 0x1d,
+  0x56, 0x6e, 0x31, 0x6b, 0x59, 0x07, 0x30, 0x8a, 0x47, 0x2e, 0xa9, 0x80,
+  0x80, 0x82, 0x34, 0x3d, 0xb2, 0x3d, 0xc9, 0xb9, 0x98, 0x84, 0x4e, 0xa9,
+  0xb6, 0xab, 0x10, 0xd9, 0x0e, 0x67, 0xf3, 0x52, 0x52, 0x52, 0x31, 0xcb,
+  0xdb, 0xfb, 0x36, 0x5d, 0x5d, 0x67, 0x9a, 0xba, 0x99, 0x65, 0xd6, 0xc2,
+  0xd0, 0x62, 0xb0, 0xa8, 0x77, 0x4a, 0x50, 0x8e, 0x47, 0xdc, 0xf4, 0x4c,
+  0x3c, 0x4c, 0xc9, 0x55, 0xbb, 0x72, 0x34, 0xf1, 0x48, 0xbc, 0x04, 0x49,
+  0x1b, 0xb0, 0x8a, 0xb0, 0xbe, 0x13, 0x3b, 0x9a, 0x78, 0xc7, 0x81, 0x44,
+  0x00, 0xe2, 0x90, 0xf7, 0xcb, 0x12, 0xee, 0xff, 0xce, 0xca, 0xc7, 0xfc,
+  0xf9, 0xb5, 0x7e, 0x99, 0x26, 0xef, 0x7f, 0xf0, 0x9f, 0x9f, 0x72, 0xae,
+  0xde, 0x6c, 0x6c, 0x06, 0xbf, 0xca, 0xf7, 0x9a, 0x2f, 0x24, 0xba, 0xba,
+  0xba, 0xbc, 0xc3, 0x33, 0xf4, 0x08, 0xc1, 0xc8, 0xf5, 0xda, 0xa9, 0x65,
+  0x99, 0x43, 0xcb, 0x7d, 0xf9, 0x41, 0x82, 0xf6, 0x85, 0xed, 0x4b, 0xa1,
+  0xa1, 0xdd, 0xa5, 0x48, 0x50, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xb4, 0x63,
+  0x21, 0x60, 0x4e, 0xf8, 0xf5, 0x84, 0x5e, 0xbd, 0xce, 0x9f, 0x3a, 0xf7,
+  0x5d, 0x98, 0x44, 0x89, 0x40, 0xbe, 0xfd, 0xbd, 0xf6, 0xb2, 0x1e, 0xdf,
+  0xcb, 0xcf, 0x0e, 0xe0, 0xb5, 0x6b, 0xf7, 0xf3, 0x7c, 0xeb, 0xb7, 0x09,
+  0xc6, 0x77, 0x95, 0x43, 0xa1, 0x22, 0x29, 0xe9, 0xf1, 0x8d, 0x34, 0x07,
+  0xb5, 0x46, 0xd2, 0x82, 0x82, 0x62, 0xe2, 0x82, 0x82, 0x82, 0xb0, 0xb0,
+  0x54, 0x0f, 0xc8, 0x73, 0x50, 0x44, 0x00, 0xf9, 0xd5, 0x6d, 0x41, 0xb7,
+  0xfd, 0x53, 0x8f, 0x6a, 0xc1, 0x64, 0xf4, 0xf8, 0xfa, 0xa8, 0xc8, 0x54,
+  0x77, 0x26, 0x4c, 0xa7, 0x5c, 0x82, 0x87, 0xf2, 0xc4, 0xb9, 0x3c, 0x48,
+  0x8f, 0x07, 0x3a, 0x7f, 0x1b, 0xfe, 0xe2, 0xca, 0xf0, 0x58, 0xe0, 0x3b,
+  0xae, 0xf1, 0xb0, 0x24, 0x24, 0x71, 0xb2, 0xf1, 0xb9, 0x9f, 0x7a, 0xa6,
+  0xfc, 0x35, 0x35, 0xb7, 0x8f, 0x8f, 0x22, 0x26, 0xa2, 0xec, 0x9e, 0x36,
+  0x28, 0x19, 0x80, 0x5e, 0x11, 0xb0, 0x64, 0xde, 0x02, 0xbc, 0x0e, 0x3e,
+  0xc9, 0xcd, 0xbb, 0xab, 0x77, 0x77, 0x31, 0x8f, 0x67, 0x02, 0x5a, 0x1a,
+  0xb6, 0xa0, 0xed, 0xbe, 0xd5, 0xd5, 0x57, 0x31, 0x15, 0xda, 0x40, 0xed,
+  0x8c, 0xa4, 0xb4, 0x34, 0x34, 0x94, 0x6e, 0xb0, 0xb6, 0xf7, 0xf7, 0x36,
+  0xf1, 0xcd, 0xba, 0x10, 0x46, 0xdd, 0xe8, 0xe8, 0x67, 0x0d, 0x65, 0x70,
+  0xcd, 0xe0, 0xf1, 0x93, 0x68, 0x7a, 0x1c, 0x99, 0x38, 0x89, 0x55, 0x34,
+  0x34, 0x27, 0x34, 0x45, 0x18, 0x05, 0xe2, 0xe8, 0x51, 0x8f, 0x32, 0x2f,
+  0x73, 0x86, 0xf2, 0x9c, 0xe9, 0x00, 0x1a, 0xa2, 0x21, 0x01, 0xa8, 0x85,
+  0x5e, 0x74, 0xc0, 0x6e, 0x15, 0x3d, 0xb5, 0x29, 0x8a, 0x44, 0x44, 0x69,
+  0xb6, 0xbf, 0x7c, 0x6b, 0x38, 0xd6, 0xa6, 0xd5, 0x60, 0x74, 0xf2, 0x8d,
+  0x66, 0xe8, 0x4e, 0xdd, 0xb8, 0xa3, 0x9b, 0x11, 0x11, 0xae, 0x19, 0x4b,
+  0x27, 0xf2, 0x17, 0x84, 0x6b, 0x83, 0x48, 0x53, 0xcc, 0x1c, 0x5e, 0xea,
+  0x18, 0xc4, 0x09, 0xfa, 0x77, 0x36, 0xe2, 0x9f, 0xe5, 0x3d, 0xdc, 0xfb,
+  0x97, 0xd3, 0xf8, 0x63, 0xb9, 0x1c, 0xe9, 0x74, 0x1f, 0xa5, 0x35, 0x35,
+  0x2a, 0x15, 0x40, 0xb7, 0x23, 0xa0, 0xa0, 0x77, 0x30, 0xd2, 0x15, 0x4f,
+  0xd7, 0xd7, 0xf4, 0xb6, 0xfc, 0xe7, 0x66, 0x00, 0x94, 0xd4, 0x3d, 0x67,
+  0x02, 0x74, 0x03, 0xc5, 0xf9, 0xd1, 0x35, 0x6a, 0x49, 0x00, 0x6b, 0xee,
+  0x4b, 0x1f, 0x5d, 0x28, 0x2d, 0xf6, 0x83, 0x73, 0x35, 0xcb, 0xe1, 0x1e,
+  0x1e, 0x76, 0x08, 0x45, 0xc6, 0x00, 0x44, 0x14, 0x53, 0x04, 0x1b, 0xc0,
+  0x48, 0x48, 0x90, 0x27, 0x3e, 0x8e, 0xc7, 0x23, 0x11, 0xa9, 0x42, 0x42,
+  0x5d, 0x3d, 0x18, 0x2c, 0xc0, 0xfa, 0x5a, 0xf3, 0x1f, 0x86, 0x78, 0x96,
+  0xe3, 0x83, 0x69, 0x49, 0x4c, 0x2b, 0x44, 0x87, 0x63, 0x78, 0x38, 0x70,
+  0x48, 0x49, 0x6a, 0xf0, 0xdf, 0xd1, 0x88, 0xa7, 0x71, 0x93, 0x67, 0x3c,
+  0x83, 0x83, 0x83, 0x83, 0x72, 0x72, 0x66, 0x66, 0x66, 0xc9, 0xc9, 0xe1,
+  0x01, 0x0f, 0xd1, 0x82, 0x5c, 0x1f, 0x02, 0xe2, 0xac, 0x29, 0x5f, 0x29,
+  0x06, 0xe9, 0x48, 0x19, 0x35, 0xb8, 0xb8, 0xb8, 0xb8, 0x0a, 0x51, 0x72,
+  0xec, 0x38, 0x1d, 0x0b, 0x06, 0x43, 0xa7, 0xba, 0x91, 0x91, 0x26, 0x47,
+  0x5e, 0x89, 0x3c, 0x3c, 0xee, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
+  0xab, 0x1c, 0xa3, 0x83, 0x79, 0x45, 0x45, 0x27, 0x87, 0x47, 0x4a, 0xab,
+  0xdb, 0x24, 0x2a, 0x40, 0xab, 0x45, 0xd8, 0x95, 0x39, 0x9a, 0x9a, 0x11,
+  0xa6, 0xf3, 0x17, 0x6e, 0x1a, 0xc1, 0xe8, 0xfd, 0x13, 0xef, 0x55, 0xbc,
+  0xb0, 0x55, 0x10, 0x21, 0xad, 0xa3, 0xc1, 0x59, 0x77, 0xcc, 0xf0, 0x37,
+  0xfe, 0x70, 0x51, 0x98, 0xbf, 0x04, 0xed, 0x06, 0xf0, 0x85, 0x3c, 0x8e,
+  0x13, 0xe2, 0x0e, 0x56, 0xdd, 0x9e, 0xf2, 0x15, 0xb4, 0xe6, 0x6b, 0x09,
+  0xb2, 0x87, 0xec, 0xee, 0x21, 0x40, 0x41, 0x05, 0x05, 0x98, 0x2e, 0xe3,
+  0xa9, 0x8f, 0xb9, 0x95, 0x00, 0xe5, 0x08, 0xbf, 0x4a, 0x2d, 0xdf, 0x16,
+  0x16, 0x3d, 0xf6, 0xfc, 0x35, 0xf6, 0x9a, 0xb7, 0xc5, 0x2e, 0x18, 0xfb,
+  0x50, 0x85, 0xc4, 0x35, 0x51, 0x8a, 0x40, 0xb1, 0x40, 0xb8, 0xf3, 0x41,
+  0x8f, 0x8f, 0xdc, 0x89, 0x45, 0x2b, 0xb2, 0x18, 0x01, 0x83, 0xc5, 0x47,
+  0x76, 0x10, 0x7d, 0x78, 0x9b, 0x42, 0x42, 0x27, 0xae, 0xc7, 0x0b, 0xf0,
+  0x71, 0x1e, 0x89, 0x42, 0x5f, 0x95, 0x1f, 0xd3, 0xcb, 0xd5, 0x7a, 0x78,
+  0x03, 0xa3, 0x5b, 0xc8, 0xb6, 0x4d, 0x53, 0x53, 0x53, 0x20, 0xf4, 0x78,
+  0xd0, 0x76, 0xb7, 0xb8, 0xd4, 0xd4, 0xb2, 0x76, 0xa7, 0xd3, 0xc7, 0xde,
+  0x0e, 0x0a, 0x11, 0x02, 0x03, 0x41, 0x73, 0x5e, 0x51, 0xc8, 0x26, 0x18,
+  0x11, 0x6e, 0x67, 0x1e, 0xf1, 0xe1, 0x65, 0x94, 0x70, 0x84, 0xef, 0xe7,
+  0x01, 0xb7, 0xe4, 0x8c, 0x2a, 0xfb, 0x95, 0x6b, 0x0e, 0xd7, 0xed, 0x22,
+  0x94, 0xdf, 0x35, 0x44, 0x3a, 0xd4, 0xd8, 0xff, 0x2e, 0x08, 0x08, 0x08,
+  0x08, 0x8e, 0xba, 0x31, 0x44, 0x79, 0x2a, 0x22, 0xa7, 0xde, 0x11, 0x1d,
+  0xd9, 0x35, 0x5e, 0xf7, 0x99, 0x15, 0x0d, 0xc8, 0x35, 0xb5, 0x59, 0x01,
+  0xe0, 0xf2, 0x9d, 0xec, 0x7b, 0xdf, 0x5f, 0x54, 0xf1, 0x67, 0x30, 0x30,
+  0x78, 0xd1, 0xfd, 0x1a, 0xd6, 0xe8, 0x6e, 0x65, 0x2e, 0xe4, 0xe4, 0xe4,
+  0xe4, 0x0d, 0x6b, 0xf9, 0x6a, 0xcd, 0xc4, 0xe6, 0xfe, 0x7e, 0x56, 0x35,
+  0xf3, 0x33, 0x42, 0x14, 0x3d, 0x75, 0x59, 0xde, 0x18, 0xe0, 0xe0, 0x74,
+  0xe8, 0x04, 0x16, 0x96, 0xd7, 0x53, 0x53, 0x40, 0x96, 0x09, 0x8b, 0x18,
+  0x18, 0xc4, 0x95, 0x41, 0xe8, 0xe4, 0xf0, 0xb2, 0x57, 0xce, 0x33, 0xbf,
+  0x57, 0x2f, 0xeb, 0xf9, 0x53, 0xeb, 0xbd, 0x11, 0x43, 0xee, 0x77, 0xc7,
+  0x37, 0x7e, 0x4c, 0x98, 0x95, 0x31, 0x5b, 0xa7, 0x28, 0x0a, 0x57, 0x57,
+  0x41, 0x6a, 0x23, 0x3c, 0xa7, 0x8b, 0x1e, 0xa8, 0x90, 0xad, 0x7f, 0x50,
+  0xba, 0x03, 0x10, 0x23, 0x7e, 0x6c, 0x6f, 0x23, 0xd9, 0xce, 0x4b, 0x44,
+  0x2f, 0x2b, 0x12, 0x13, 0x8d, 0xa7, 0xf8, 0x13, 0xdb, 0x0e, 0x76, 0xe1,
+  0x6b, 0x94, 0x62, 0xfb, 0xae, 0x4b, 0x6d, 0x74, 0x3e, 0x82, 0x0a, 0x4f,
+  0xbd, 0xe6, 0x1d, 0x43, 0xd4, 0xc2, 0x07, 0xd3, 0x4c, 0x65, 0xc0, 0xe6,
+  0x58, 0xbc, 0xef, 0x51, 0xa9, 0x0b, 0x33, 0x5e, 0x14, 0x12, 0x90, 0x11,
+  0x33, 0x7b, 0x3f, 0xc0, 0x93, 0x04, 0xb0, 0x0f, 0x79, 0x92, 0xca, 0xe6,
+  0x02, 0x08, 0x3e, 0xf9, 0xbb, 0x21, 0x08, 0xaa, 0x96, 0x7a, 0xe3, 0xdf,
+  0x6f, 0xd3, 0xa0, 0x57, 0x82, 0x71, 0x94, 0x8b, 0x0c, 0xcf, 0x1f, 0x99,
+  0x2a, 0x90, 0x8e, 0x11, 0xcb, 0xcb, 0x8e, 0x98, 0x47, 0xef, 0x7b, 0xf0,
+  0x8f, 0xbd, 0xed, 0x26, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0xc0,
+  0x34, 0x71, 0x89, 0x79, 0x8c, 0x28, 0x2b, 0x49, 0x55, 0xda, 0x4f, 0x84,
+  0x75, 0x75, 0x8e, 0x02, 0xdc, 0xba, 0xdd, 0xc7, 0xe6, 0x22, 0x0f, 0x1f,
+  0xb5, 0x67, 0x3d, 0xb3, 0x87, 0x28, 0xfa, 0x59, 0x88, 0x0e, 0xf2, 0xf3,
+  0x7e, 0x2b, 0xeb, 0xd1, 0x80, 0xfe, 0x79, 0x22, 0x8b, 0xe9, 0x94, 0x49,
+  0x7a, 0xa2, 0x82, 0x82, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xf7, 0x46,
+  0x3c, 0x92, 0xef, 0xc5, 0xc8, 0x13, 0x33, 0x5b, 0xd3, 0xb5, 0x92, 0xbc,
+  0xa4, 0xd6, 0x31, 0x98, 0x47, 0x63, 0x63, 0xc3, 0x80, 0x44, 0x6e, 0x25,
+  0x83, 0xb5, 0xd7, 0xd2, 0x59, 0xd3, 0x6d, 0x55, 0x51, 0xb8, 0xd3, 0x5d,
+  0x76, 0x50, 0x64, 0x10, 0x3c, 0x98, 0x83, 0xa3, 0x3a, 0x60, 0x2f, 0x7f,
+  0x4e, 0x4e, 0x13, 0x96, 0x1d, 0xa1, 0xa5, 0x1b, 0x57, 0x3c, 0xd9, 0xeb,
+  0x5b, 0x6d, 0x9b, 0x3b, 0x45, 0xac, 0xbe, 0xb1, 0xb1, 0x3c, 0x7b, 0x66,
+  0x31, 0x7d, 0x65, 0x4f, 0xcc, 0xf1, 0x18, 0x6b, 0x8e, 0x7f, 0x82, 0xf8,
+  0x04, 0x0e, 0x30, 0x39, 0x0f, 0x59, 0x18, 0x9f, 0x8d, 0x66, 0xc2, 0xa0,
+  0x6a, 0xe9, 0xc3, 0x8f, 0x7e, 0xe5, 0x04, 0xa7, 0xfa, 0xfa, 0xa7, 0x6f,
+  0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0xb9, 0x7b, 0x7b, 0x65, 0xa9, 0xa9, 0xd4,
+  0x77, 0x65, 0x25, 0x5a, 0x80, 0x11, 0xc5, 0xd6, 0x79, 0x10, 0x35, 0xcd,
+  0xa9, 0x9a, 0x95, 0x88, 0x6a, 0xbf, 0xaf, 0xe8, 0xd6, 0x79, 0x4e, 0xd9,
+  0xe2, 0x1b, 0xd9, 0xd7, 0x80, 0x08, 0xe7, 0x29, 0x7d, 0x66, 0x6a, 0xe1,
+  0x72, 0xda, 0x85, 0x1b, 0x09, 0x52, 0xc1, 0x56, 0x17, 0x93, 0xa6, 0x92,
+  0x28, 0x4b, 0x67, 0x27, 0xd1, 0x6c, 0xfc, 0x90, 0xe0, 0x13, 0x83, 0x30,
+  0x2f, 0x16, 0xb0, 0x46, 0x9c, 0x98, 0xff, 0x40, 0xcb, 0x7c, 0x00, 0x11,
+  0x30, 0x79, 0x23, 0x88, 0xa3, 0x3c, 0xb7, 0x47, 0x9c, 0x0c, 0x7f, 0x2b,
+  0x2b, 0x88, 0xa0, 0x3b, 0xc0, 0x77, 0xf8, 0x1f, 0xa2, 0x4e, 0x93, 0x6a,
+  0x6c, 0x68, 0x07, 0x8e, 0x63, 0xf2, 0x15, 0x82, 0xab, 0xf1, 0x03, 0x2c,
+  0x54, 0x5c, 0x8c, 0xde, 0xad, 0x64, 0x3b, 0x34, 0x43, 0x68, 0x8c, 0x80,
+  0xec, 0xe7, 0x4e, 0xbf, 0xbf, 0xd7, 0x35, 0xfe, 0x80, 0x90, 0x99, 0x4d,
+  0xc0, 0x4f, 0x03, 0xf7, 0xfb, 0xfc, 0xd7, 0x94, 0x3e, 0xe1, 0x77, 0x8f,
+  0xc5, 0x41, 0x41, 0x69, 0x35, 0xe8, 0x7c, 0x1b, 0x43, 0x74, 0xf1, 0x88,
+  0x2a, 0x2a, 0xb9, 0xf2, 0xab, 0x59, 0x12, 0xcb, 0x45, 0x55, 0x62, 0xbb,
+  0x00, 0x41, 0x6f, 0xdd, 0x82, 0x98, 0x78, 0x6c, 0x77, 0x5d, 0x32, 0x45,
+  0xb9, 0xab, 0x81, 0x4e, 0xba, 0xf1, 0xf1, 0xf1, 0x92, 0x72, 0x78, 0x00,
+  0x74, 0x72, 0x46, 0xea, 0xb9, 0x24, 0xe4, 0x36, 0x3a, 0xd7, 0x4f, 0xd8,
+  0xa7, 0x3a, 0x6e, 0xe1, 0x23, 0xdf, 0xdf, 0xa5, 0xae, 0x05, 0x30, 0xf8,
+  0x86, 0x78, 0x78, 0x16, 0x84, 0x88, 0xc2, 0xaf, 0xa3, 0xed, 0xba, 0xc7,
+  0xf0, 0xfa, 0xfa, 0x30, 0xa6, 0xb6, 0x9f, 0x6a, 0x36, 0x7f, 0x84, 0x1a,
+  0x91, 0xb0, 0xbd, 0x5e, 0x6c, 0x0b, 0x59, 0x07, 0x7a, 0x51, 0xd8, 0xab,
+  0x5b, 0x3a, 0x7f, 0x21, 0x54, 0x60, 0xda, 0xf8, 0xc5, 0xf6, 0xc8, 0x04,
+  0xc5, 0x14, 0x14, 0xee, 0x7a, 0x63, 0x45, 0xc0, 0xe9, 0x85, 0x43, 0xbe,
+  0x17, 0xf3, 0x57, 0xaa, 0x3f, 0xba, 0x2d, 0x48, 0x0b, 0x57, 0xe9, 0x05,
+  0x2f, 0x68, 0xcc, 0x21, 0xd0, 0x61, 0x28, 0x54, 0x9e, 0xde, 0xa0, 0xf3,
+  0x45, 0xf8, 0x8c, 0x59, 0x28, 0x9a, 0x3d, 0x4b, 0x7b, 0xf5, 0x2e, 0xff,
+  0x35, 0x67, 0x6d, 0x4b, 0xc2, 0x40, 0xa8, 0xe4, 0x3f, 0x6b, 0x90, 0x90,
+  0x70, 0x62, 0x65, 0x19, 0x05, 0x17, 0x4a, 0x96, 0x23, 0xb6, 0x7a, 0x7a,
+  0x7a, 0x78, 0xce, 0x3e, 0x8b, 0x26, 0x4a, 0xb6, 0x94, 0x15, 0x4a, 0xbc,
+  0xb1, 0xb1, 0x76, 0x15, 0xfe, 0x6b, 0x32, 0x5f, 0x3c, 0x11, 0x61, 0xcd,
+  0xbb, 0xf8, 0x60, 0x91, 0x9a, 0x3a, 0x36, 0x8e, 0x8e, 0xd7, 0xc0, 0x08,
+  0xe9, 0x6b, 0x28, 0x22, 0x22, 0xd5, 0x4c, 0x49, 0xdc, 0x59, 0xbe, 0x7a,
+  0x29, 0x20, 0x56, 0x6a, 0x19, 0x50, 0xae, 0x0b, 0x0b, 0x0b, 0x0b, 0xf7,
+  0x33, 0xfa, 0x7b, 0x2b, 0x8a, 0x06, 0x06, 0xd9, 0x52, 0x2b, 0x5d, 0x86,
+  0x19, 0xdf, 0xb5, 0xb5, 0xec, 0x33, 0x64, 0x8a, 0x30, 0x72, 0x31, 0xaf,
+  0xe4, 0x57, 0xed, 0xf2, 0xd2, 0x3a, 0xfe, 0x92, 0xcb, 0xcb, 0x3a, 0xa7,
+  0xd0, 0xd7, 0x2d, 0xed, 0xed, 0xf9, 0xf9, 0xda, 0x32, 0x20, 0x3c, 0x77,
+  0x0a, 0x13, 0x9c, 0x79, 0x5a, 0x64, 0xad, 0xae, 0x52, 0xac, 0x19, 0xd9,
+  0xb4, 0xd0, 0x1f, 0x6d, 0xe5, 0xad, 0xb9, 0x21, 0xc2, 0xab, 0x6c, 0x3d,
+  0x42, 0xed, 0x1d, 0xfd, 0xaf, 0x0c, 0x78, 0x58, 0xea, 0x8e, 0x35, 0x9b,
+  0x68, 0xee, 0xaf, 0xaf, 0x2c, 0x48, 0x2a, 0x44, 0x64, 0x54, 0x80, 0xa6,
+  0x68, 0x93, 0x66, 0x89, 0x01, 0xf1, 0x49, 0xd5, 0x36, 0xea, 0xea, 0x57,
+  0x51, 0x20, 0x3a, 0xe8, 0xeb, 0x66, 0x13, 0x6b, 0xa3, 0x3d, 0x05, 0x1b,
+  0x56, 0xd8, 0x76, 0xf4, 0x9a, 0xf4, 0x9b, 0xb1, 0x19, 0xc0, 0x2c, 0x9b,
+  0x03, 0x76, 0xb0, 0xf3, 0xba, 0xe7, 0x44, 0xc5, 0xda, 0xd5, 0xb5, 0x2a,
+  0xd1, 0x47, 0xb6, 0x2c, 0x7f, 0xe1, 0x92, 0xe3, 0xe7, 0xa3, 0x7a, 0xdf,
+  0xb3, 0x4b, 0xc5, 0xb5, 0xd4, 0xc2, 0x97, 0x6c, 0x15, 0x7b, 0xb1, 0x90,
+  0x61, 0xad, 0xd9, 0x6f, 0x12, 0x01, 0x39, 0xce, 0xce, 0xce, 0xe6, 0x58,
+  0x33, 0x14, 0x73, 0x82, 0x32, 0xa6, 0x4e, 0x44, 0xf2, 0x33, 0x40, 0x6b,
+  0xb7, 0xa1, 0x9a, 0x9f, 0xbf, 0x13, 0xd2, 0x3b, 0xce, 0xc9, 0xac, 0x46,
+  0x36, 0x78, 0x6e, 0xbb, 0x95, 0xa5, 0x97, 0x44, 0x80, 0xea, 0x50, 0x11,
+  0xf5, 0xba, 0x55, 0x53, 0x48, 0xc4, 0x40, 0x35, 0x8f, 0x8f, 0x57, 0x04,
+  0xc2, 0x1a, 0x0f, 0x9c, 0xcc, 0xcc, 0xac, 0x7f, 0x7f, 0x7f, 0x84, 0xa3,
+  0xa8, 0xb9, 0xef, 0x7f, 0x84, 0x9b, 0x02, 0x7c, 0xbc, 0x3f, 0x68, 0x75,
+  0xd6, 0xef, 0xe1, 0x2a, 0xd1, 0x7d, 0xa6, 0xc8, 0xe7, 0x67, 0x5d, 0x8d,
+  0x92, 0xd7, 0xd7, 0x4b, 0xad, 0x94, 0xc3, 0xb5, 0xd6, 0x35, 0x9e, 0x92,
+  0x89, 0xe1, 0xab, 0x4b, 0x89, 0x2c, 0x24, 0xa7, 0x1d, 0xe6, 0xc2, 0x76,
+  0x4a, 0xac, 0xa6, 0x02, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x93, 0x43,
+  0x5d, 0xb7, 0x0d, 0x3f, 0x94, 0x3e, 0x5e, 0xf1, 0xf4, 0xb6, 0x1a, 0x9c,
+  0x34, 0x1a, 0x51, 0x21, 0x8f, 0xcf, 0x5d, 0xe0, 0xad, 0xe9, 0x63, 0xcf,
+  0xc9, 0x2d, 0x2d, 0x2d, 0x46, 0xd2, 0x40, 0x60, 0x0f, 0xb5, 0xb5, 0x8a,
+  0xd4, 0xe8, 0x03, 0xa4, 0x90, 0x90, 0xcb, 0xcc, 0xfe, 0x03, 0xf0, 0x18,
+  0xe7, 0xed, 0x7c, 0x31, 0x17, 0x62, 0x89, 0xa9, 0xb9, 0x81, 0xcb, 0x79,
+  0x38, 0x38, 0x88, 0x32, 0xbd, 0xd2, 0x47, 0x48, 0xac, 0x23, 0x4a, 0x56,
+  0x13, 0x2b, 0xd1, 0x78, 0x8c, 0x31, 0xa0, 0x91, 0x91, 0x0a, 0xfd, 0x60,
+  0xe6, 0x32, 0x80, 0x59, 0x96, 0x27, 0xce, 0x0c, 0xf4, 0x49, 0x61, 0x4e,
+  0xfb, 0x92, 0x21, 0x3d, 0xfd, 0x81, 0x80, 0xc7, 0x17, 0xdd, 0x68, 0x3e,
+  0x07, 0x87, 0x5b, 0x14, 0xb7, 0xb6, 0xe2, 0x7f, 0x1a, 0xa9, 0x64, 0xb6,
+  0x47, 0xd2, 0x49, 0xd7, 0x11, 0x22, 0x25, 0x70, 0xe2, 0x80, 0x5d, 0xd4,
+  0xf1, 0xed, 0x8a, 0x97, 0xa7, 0x35, 0xc4, 0xf3, 0x43, 0x1b, 0x7d, 0xec,
+  0x91, 0x90, 0x1b, 0x3f, 0x8f, 0x8f, 0xf4, 0x29, 0x79, 0x0e, 0x55, 0x9b,
+  0x7c, 0x21, 0xfc, 0x5c, 0x67, 0xfc, 0x39, 0xba, 0x3f, 0x78, 0x60, 0xa6,
+  0x3d, 0x37, 0xd2, 0xde, 0xab, 0x35, 0x3a, 0x14, 0xd6, 0x0f, 0xb5, 0xe9,
+  0x35, 0xe1, 0xe1, 0x7b, 0x75, 0xa3, 0x0e, 0x5a, 0x4e, 0x4d, 0xb3, 0x83,
+  0x52, 0x4b, 0x4b, 0x88, 0x3d, 0x90, 0x0b, 0x20, 0x5e, 0x1a, 0x2d, 0x3f,
+  0xeb, 0x60, 0x6d, 0x19, 0xa2, 0x9a, 0x61, 0x55, 0xf6, 0xd7, 0x11, 0x11,
+  0x4c, 0x33, 0x9b, 0x2a, 0xdc, 0xd2, 0x23, 0xf0, 0x70, 0xf4, 0xb5, 0xe7,
+  0x32, 0x6f, 0x61, 0x69, 0xa6, 0xe3, 0xe3, 0x47, 0x47, 0x99, 0x1a, 0xd1,
+  0x46, 0xda, 0xc9, 0x1f, 0x32, 0xab, 0xf8, 0xd9, 0x44, 0x18, 0x89, 0x9b,
+  0x1e, 0x65, 0xf9, 0x94, 0x3e, 0x53, 0xa4, 0x49, 0x0e, 0x7a, 0xd7, 0x22,
+  0xec, 0x68, 0x03, 0x36, 0x1f, 0x73, 0x98, 0xeb, 0xfe, 0xf9, 0x9c, 0xaa,
+  0xed, 0xe8, 0x0f, 0x70, 0x0d, 0x17, 0x39, 0x5c, 0xd3, 0x42, 0x4e, 0xec,
+  0xe5, 0xaf, 0x03, 0xef, 0x1d, 0x40, 0x58, 0x48, 0xa2, 0x95, 0x4c, 0xac,
+  0x79, 0x89, 0xce, 0xcd, 0x34, 0x53, 0x34, 0xd0, 0xd0, 0xe7, 0x11, 0xfb,
+  0x41, 0x5b, 0x21, 0xea, 0x7f, 0x6f, 0x95, 0xca, 0x56, 0xe3, 0x5d, 0xac,
+  0xcd, 0xa9, 0x61, 0xc5, 0x40, 0xfb, 0x27, 0xc6, 0xb9, 0x90, 0x90, 0xb1,
+  0x83, 0xb3, 0xb3, 0x56, 0xbe, 0xc9, 0x4d, 0xc5, 0xc5, 0xe6, 0x97, 0xf6,
+  0x5b, 0xbb, 0x5f, 0xd9, 0x7a, 0xd4, 0xf2, 0x2e, 0xf3, 0x2e, 0x9e, 0x06,
+  0xec, 0x6f, 0x4f, 0x4f, 0x13, 0x8a, 0x2a, 0x35, 0x83, 0x5c, 0xd9, 0x13,
+  0xcb, 0x7a, 0xb3, 0x62, 0x94, 0x3c, 0xf6, 0x92, 0xfb, 0x9f, 0xa3, 0xe4,
+  0x75, 0x9b, 0x20, 0x9d, 0x66, 0x2a, 0x56, 0x56, 0xc1, 0x95, 0x1b, 0x6c,
+  0xef, 0x6f, 0xbc, 0xb5, 0x1b, 0xa5, 0xa8, 0xdf, 0xf9, 0xa3, 0x63, 0x3a,
+  0x3a, 0x3a, 0x04, 0x65, 0x65, 0xcc, 0x31, 0x97, 0x0d, 0x54, 0x1d, 0x0a,
+  0x8d, 0xf4, 0xec, 0x9a, 0x2b, 0x5e, 0x87, 0x89, 0xf4, 0xc4, 0x71, 0xf1,
+  0x7f, 0x34, 0x63, 0x72, 0x22, 0xc7, 0x89, 0x63, 0xbe, 0x2b, 0x5a, 0x56,
+  0xeb, 0x50, 0x1d, 0xd4, 0xf0, 0x95, 0x12, 0xbf, 0xe8, 0xc3, 0x47, 0xb6,
+  0xa0, 0xc4, 0x43, 0x41, 0x5e, 0x43, 0x3b, 0x03, 0x48, 0xf5, 0xe1, 0x89,
+  0xd6, 0xce, 0x29, 0xa0, 0x91, 0xdf, 0x3b, 0xbb, 0x35, 0x20, 0xf4, 0x75,
+  0x1f, 0x6d, 0xa3, 0xa8, 0x82, 0x26, 0x5a, 0x42, 0x30, 0xa0, 0x2d, 0x1d,
+  0xc6, 0x8b, 0x9c, 0xd7, 0x55, 0xfe, 0xb4, 0xa7, 0x36, 0x38, 0x38, 0x40,
+  0x16, 0x7a, 0xf5, 0x66, 0xde, 0x7f, 0x03, 0xff, 0x5a, 0xe7, 0xf5, 0x68,
+  0xa2, 0xa5, 0x2b, 0x3e, 0xd5, 0x55, 0xc4, 0x93, 0x93, 0x3b, 0xe9, 0x51,
+  0x37, 0x1d, 0x1a, 0x38, 0x64, 0x90, 0x68, 0xb8, 0x12, 0xad, 0x79, 0xcf,
+  0xcf, 0xda, 0xb2, 0x8d, 0xd8, 0xee, 0x73, 0xd4, 0x45, 0x8e, 0x8c, 0xb0,
+  0xf2, 0x06, 0xf0, 0x92, 0x92, 0xbb, 0xf7, 0x75, 0xa6, 0x50, 0xbd, 0x77,
+  0x5d, 0x53, 0x53, 0xc2, 0xd7, 0xba, 0xcf, 0x4f, 0x16, 0xc6, 0x64, 0xe8,
+  0x34, 0xc7, 0x5f, 0x05, 0x35, 0x41, 0x9d, 0x73, 0xdc, 0xac, 0xd1, 0x87,
+  0x10, 0x76, 0xa1, 0x78, 0xef, 0x93, 0x9a, 0xdd, 0x63, 0xbe, 0xeb, 0xe3,
+  0xc1, 0xfa, 0x83, 0xde, 0x8f, 0xce, 0xe2, 0xc4, 0x6d, 0x70, 0x1e, 0x82,
+  0x8e, 0x1a, 0xb1, 0xb1, 0xb1, 0x6e, 0x23, 0x53, 0x21, 0x61, 0x51, 0x64,
+  0x3c, 0xf1, 0xce, 0xfe, 0xd6, 0xac, 0x82, 0xb7, 0xb7, 0xeb, 0x05, 0xf3,
+  0x55, 0x60, 0x55, 0xe4, 0x9b, 0x67, 0x18, 0xeb, 0xc5, 0xe6, 0x65, 0xd5,
+  0x3e, 0x68, 0x15, 0xb3, 0xbb, 0xed, 0x18, 0x69, 0xfe, 0x5f, 0x5f, 0x70,
+  0x70, 0x8a, 0x59, 0xa6, 0x1a, 0x81, 0xc9, 0x59, 0x80, 0x1e, 0xf8, 0x19,
+  0x09, 0x84, 0xb0, 0x12, 0x37, 0x30, 0xd2, 0xd2, 0x86, 0x70, 0x14, 0xa1,
+  0xda, 0x84, 0xf3, 0x6a, 0x66, 0x40, 0x89, 0x9b, 0x33, 0x2f, 0xaa, 0x7e,
+  0xa7, 0x6f, 0xe5, 0x28, 0x28, 0xf5, 0x37, 0x1b, 0x48, 0xda, 0xab, 0x99,
+  0xf1, 0x0b, 0xd3, 0x05, 0x6b, 0xa8, 0xfc, 0xb4, 0x5a, 0x70, 0x8f, 0x9a,
+  0x66, 0x66, 0x66, 0x35, 0x33, 0x4b, 0x2d, 0x34, 0xf6, 0x76, 0x9a, 0x5c,
+  0x78, 0xcc, 0xcd, 0xcd, 0x1e, 0xc2, 0x47, 0x60, 0x06, 0xda, 0x41, 0xe5,
+  0x0e, 0xce, 0xe7, 0x7b, 0xbc, 0xcc, 0x6d, 0x6d, 0x3b, 0xc7, 0x5c, 0xfe,
+  0xaa, 0x3a, 0x85, 0xc3, 0x2d, 0xd8, 0xd9, 0x05, 0x21, 0xdd, 0x5f, 0xbd,
+  0x79, 0x0f, 0x95, 0xeb, 0x19, 0x0c, 0xb1, 0x9a, 0xa9, 0xce, 0xd1, 0xeb,
+  0x9e, 0x1c, 0xae, 0xcb, 0xcb, 0xb3, 0xef, 0xe2, 0x0b, 0x42, 0xb5, 0xf4,
+  0xc0, 0x10, 0x38, 0x38, 0x94, 0x0e, 0x91, 0x3b, 0x90, 0x3e, 0x3e, 0x3e,
+  0x00, 0xf6, 0x95, 0xa8, 0xaf, 0x25, 0x78, 0x29, 0x89, 0x79, 0xb5, 0xbe,
+  0xd5, 0x5f, 0x01, 0xff, 0x3b, 0x45, 0x1c, 0x86, 0x67, 0x38, 0x06, 0x47,
+  0x47, 0xad, 0x75, 0x0a, 0xcf, 0x4f, 0x08, 0xa5, 0xd0, 0x5a, 0x65, 0x7f,
+  0x6a, 0x89, 0x39, 0x54, 0xc7, 0x69, 0x2f, 0x16, 0x16, 0x38, 0xdc, 0xf7,
+  0x28, 0x97, 0xef, 0x0f, 0xd0, 0x8c, 0xfe, 0x1f, 0xca, 0xe6, 0x6b, 0xf7,
+  0xbb, 0x26, 0x07, 0x9e, 0xaa, 0x10, 0x31, 0xfa, 0x4a, 0xc4, 0x8e, 0x19,
+  0x48, 0xa2, 0x35, 0x0c, 0x2d, 0xf8, 0xad, 0xa3, 0x0a, 0xd0, 0x57, 0x17,
+  0xd7, 0xbd, 0x93, 0xf0, 0x87, 0x3d, 0xd7, 0x95, 0x6c, 0x77, 0x77, 0x53,
+  0xb6, 0xda, 0x44, 0x20, 0x80, 0x30, 0xac, 0x26, 0x74, 0xe1, 0x8d, 0x8b,
+  0xba, 0x56, 0xcd, 0x3f, 0x95, 0xad, 0x18, 0xd0, 0xba, 0xf3, 0x73, 0x10,
+  0xb0, 0xb2, 0xd6, 0xe4, 0xb6, 0xd6, 0x6c, 0x63, 0x4b, 0x5b, 0x1d, 0x83,
+  0x1f, 0x01, 0x0e, 0x90, 0xf2, 0xb1, 0x55, 0xa2, 0xc1, 0xe7, 0x36, 0xa4,
+  0xc3, 0x92, 0xa0, 0x90, 0x65, 0x47, 0x61, 0xed, 0x16, 0x20, 0x80, 0xa5,
+  0x38, 0x32, 0x1e, 0x22, 0xd5, 0xe5, 0xdc, 0x51, 0xbf, 0xbf, 0xcf, 0xe8,
+  0x73, 0x51, 0xf3, 0x58, 0x70, 0xf7, 0xae, 0xac, 0xf5, 0x7d, 0xe6, 0x3f,
+  0xe4, 0x05, 0xb4, 0x86, 0x46, 0x48, 0x72, 0x77, 0xaf, 0xba, 0x4c, 0xf0,
+  0xd2, 0x62, 0xda, 0x03, 0x91, 0x92, 0xef, 0x47, 0xb2, 0x20, 0x8b, 0xb1,
+  0x15, 0x44, 0xf5, 0x88, 0x9b, 0x04, 0x0c, 0x81, 0xc9, 0x91, 0x33, 0x16,
+  0xdb, 0x8e, 0x44, 0x40, 0x03, 0xd1, 0x64, 0x04, 0xdc, 0x9a, 0x10, 0xd3,
+  0x8d, 0x97, 0x2d, 0x5a, 0x30, 0x99, 0x8b, 0xff, 0xa3, 0x25, 0xf7, 0xaa,
+  0x0e, 0xef, 0x31, 0x88, 0xbc, 0xaf, 0xbb, 0x58, 0x69, 0x61, 0x62, 0xb4,
+  0x66, 0xd0, 0x90, 0x99, 0xc4, 0x2d, 0x3a, 0x18, 0x16, 0xfd, 0xa7, 0xc7,
+  0x8b, 0x60, 0x81, 0xd2, 0x9e, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0xb1, 0xc7,
+  0xc6, 0x3d, 0x13, 0x0c, 0x2f, 0x89, 0xa4, 0x11, 0xfb, 0xdc, 0x76, 0x8c,
+  0xcd, 0xd1, 0x45, 0xb2, 0x58, 0x58, 0xe2, 0x72, 0xee, 0x4b, 0x8b, 0x6c,
+  0x81, 0x36, 0x72, 0xff, 0xd2, 0x10, 0x39, 0x70, 0x5e, 0x7e, 0xba, 0x9c,
+  0x7d, 0x02, 0xd6, 0xb2, 0xb0, 0x01, 0xd4, 0xaf, 0xbf, 0xab, 0xf5, 0xc1,
+  0x54, 0xce, 0xe4, 0xf5, 0x6a, 0x24, 0xf3, 0x4b, 0x1a, 0x01, 0x82, 0x0d,
+  0x57, 0xd2, 0x40, 0x5c, 0xd1, 0x2a, 0xbf, 0x2d, 0x3d, 0x45, 0x1a, 0x4a,
+  0x58, 0x62, 0xde, 0xcb, 0x41, 0xb4, 0x2a, 0xbb, 0xae, 0x72, 0xc7, 0x53,
+  0x75, 0x60, 0xf9, 0x37, 0x2d, 0x1d, 0xae, 0xf6, 0xc3, 0x82, 0xc9, 0xe5,
+  0xeb, 0xa1, 0xd3, 0xb6, 0xb6, 0xeb, 0xfa, 0xff, 0xac, 0xc0, 0x66, 0x54,
+  0xfa, 0x64, 0x4f, 0x8f, 0x92, 0x85, 0xf3, 0x46, 0xd9, 0x7a, 0x1f, 0xda,
+  0xda, 0xda, 0xda, 0xda, 0x5f, 0xa9, 0x9a, 0xcc, 0xac, 0x13, 0xe9, 0x37,
+  0x25, 0xe5, 0xef, 0x2c, 0xa0, 0x08, 0xca, 0xae, 0x13, 0x8e, 0xfa, 0x9a,
+  0x20, 0x2c, 0x19, 0x87, 0xfe, 0x7f, 0x66, 0x4a, 0xb9, 0x86, 0x24, 0x2f,
+  0x4a, 0x0c, 0xb0, 0x34, 0x2f, 0x49, 0x9d, 0x78, 0x3a, 0xbd, 0x49, 0x72,
+  0xc2, 0xd9, 0x37, 0xc9, 0x2f, 0x3d, 0xe0, 0xda, 0x86, 0xde, 0x68, 0x72,
+  0xaa, 0x80, 0x38, 0xfc, 0x62, 0x13, 0x33, 0x5f, 0x5f, 0x06, 0xb0, 0x2d,
+  0x82, 0xd4, 0xee, 0x8a, 0x4e, 0xde, 0x37, 0x03, 0xb1, 0xea, 0x1f, 0x15,
+  0x01, 0x41, 0x0c, 0x28, 0x83, 0x0b, 0xfb, 0xbe, 0x00, 0x14, 0xb3, 0xe2,
+  0x9f, 0x46, 0x32, 0xce, 0x56, 0x56, 0x51, 0x60, 0x28, 0x22, 0x4c, 0xb7,
+  0xf4, 0x57, 0x83, 0xf4, 0x38, 0x58, 0x4a, 0xa6, 0xfc, 0xad, 0x44, 0xbb,
+  0xed, 0xe6, 0x63, 0x23, 0x4b, 0xdb, 0x19, 0x57, 0xb6, 0x57, 0x42, 0xfd,
+  0xd7, 0x61, 0x56, 0x56, 0x25, 0x0a, 0x21, 0xb0, 0x60, 0xf5, 0x4c, 0x53,
+  0x0f, 0xc7, 0x2c, 0xc1, 0xc1, 0x30, 0x22, 0x3a, 0x91, 0x74, 0xef, 0x76,
+  0x2f, 0xa6, 0x31, 0x31, 0x46, 0x14, 0xb7, 0xb2, 0x06, 0xcd, 0x1f, 0xc8,
+  0xbd, 0x49, 0xbe, 0x55, 0x2f, 0x1d, 0x33, 0x04, 0x26, 0x73, 0xda, 0xf8,
+  0xf8, 0xb0, 0xc2, 0x97, 0x1d, 0xb6, 0x03, 0x29, 0x31, 0xb9, 0xa9, 0x10,
+  0xcd, 0x3a, 0x02, 0x8f, 0xfb, 0x3d, 0x6e, 0x6e, 0x6e, 0x63, 0xc7, 0x23,
+  0xb0, 0xe6, 0x4c, 0xa9, 0x4e, 0x90, 0xda, 0x4e, 0x75, 0x0f, 0xed, 0x5b,
+  0x85, 0xc5, 0x60, 0xf5, 0xf5, 0x4a, 0x52, 0xba, 0x64, 0x5b, 0x5b, 0xce,
+  0x13, 0x51, 0xf4, 0x4d, 0x8e, 0xb6, 0x62, 0xc6, 0x31, 0x70, 0x54, 0xe0,
+  0x05, 0xb9, 0x32, 0x99, 0x2c, 0xee, 0xee, 0x73, 0xd5, 0x5a, 0xbf, 0xad,
+  0x1e, 0x78, 0x87, 0x12, 0x5d, 0xeb, 0xf3, 0x70, 0x95, 0x13, 0x10, 0x31,
+  0xa1, 0x74, 0xe2, 0x0a, 0x98, 0x17, 0x45, 0x49, 0x30, 0xfe, 0xb5, 0x1c,
+  0x9b, 0x61, 0xd9, 0x1e, 0x59, 0xc8, 0x61, 0x42, 0x8a, 0x0d, 0x8f, 0x5b,
+  0x3e, 0x6e, 0x9d, 0x8a, 0x8d, 0x8d, 0x2e, 0x74, 0x74, 0x3f, 0xe4, 0x39,
+  0xa0, 0xdc, 0x81, 0xfa, 0xa2, 0x72, 0xe7, 0x38, 0xdc, 0x94, 0xe7, 0xe7,
+  0xee, 0x13, 0xd1, 0xe1, 0x31, 0x31, 0xab, 0x4a, 0x67, 0x43, 0x43, 0x26,
+  0x7f, 0xc0, 0x8e, 0xc5, 0xed, 0x70, 0xa9, 0xa9, 0xc9, 0x5b, 0xd3, 0x62,
+  0x62, 0x9a, 0x18, 0x8d, 0x28, 0xb6, 0x77, 0x6b, 0xe3, 0x00, 0x94, 0x42,
+  0x3d, 0x3f, 0xbb, 0x46, 0x9a, 0x54, 0x6b, 0x89, 0xf8, 0x74, 0x94, 0x54,
+  0x83, 0x47, 0x36, 0xf8, 0x85, 0x85, 0x85, 0x5f, 0x7b, 0x52, 0xe2, 0x38,
+  0x55, 0xde, 0x6b, 0xdf, 0x6b, 0xd9, 0xc5, 0x17, 0xea, 0xc1, 0x81, 0xb8,
+  0xf2, 0x83, 0x69, 0x43, 0x99, 0xa1, 0x7a, 0xf8, 0x13, 0xd1, 0x65, 0xbb,
+  0x68, 0xb8, 0x27, 0x0a, 0xb4, 0x12, 0xad, 0x3b, 0xf0, 0x69, 0x99, 0xd5,
+  0xe5, 0x5b, 0x8b, 0xf7, 0x69, 0xa7, 0x11, 0x6d, 0x7f, 0x92, 0xac, 0xbe,
+  0xc0, 0xa7, 0x9a, 0x76, 0x21, 0xcf, 0x72, 0xba, 0xa3, 0x97, 0xaf, 0xc2,
+  0x38, 0xac, 0xc6, 0xb4, 0x27, 0x0f, 0xb9, 0x26, 0x0c, 0x4d, 0xb6, 0xb6,
+  0x88, 0xd8, 0xb2, 0xfe, 0x23, 0x94, 0xe0, 0x4f, 0xec, 0x8b, 0x6d, 0xe2,
+  0x05, 0x69, 0x4e, 0xb6, 0x62, 0x55, 0xae, 0x21, 0x51, 0xbc, 0xe9, 0xd9,
+  0x39, 0x0c, 0x65, 0x60, 0x56, 0xc8, 0x60, 0x80, 0x96, 0xcd, 0xc0, 0x34,
+  0x91, 0x0f, 0x21, 0x97, 0x93, 0xa5, 0xd6, 0xe0, 0x75, 0xd7, 0xe9, 0xaf,
+  0x95, 0xe1, 0x14, 0xc9, 0xfa, 0xf7, 0x44, 0x16, 0x88, 0x05, 0x61, 0x56,
+  0x3e, 0x0f, 0xca, 0xb2, 0xb8, 0x89, 0x4e, 0x94, 0x9c, 0x8c, 0x01, 0x73,
+  0x33, 0x9f, 0x15, 0xdf, 0x3f, 0xa1, 0x7c, 0x0c, 0x0e, 0x7f, 0x1f, 0xdf,
+  0xda, 0x53, 0x56, 0x4a, 0x57, 0x65, 0x5e, 0x5c, 0x5c, 0xcd, 0xbd, 0x00,
+  0x05, 0x38, 0x39, 0x72, 0xc6, 0x28, 0x71, 0x62, 0xba, 0xf2, 0xba, 0x9a,
+  0x6e, 0xb3, 0x56, 0xa3, 0x66, 0xa9, 0x4a, 0xa7, 0xcd, 0x3c, 0x7a, 0x7a,
+  0xd7, 0x46, 0x0a, 0xa0, 0x61, 0x19, 0xac, 0xd8, 0x57, 0x2c, 0x54, 0xd7,
+  0x1c, 0x35, 0xa5, 0x83, 0x6a, 0x8d, 0x9b, 0xe3, 0xe3, 0x13, 0xfc, 0xc4,
+  0x8b, 0x8b, 0xf7, 0xbb, 0x3b, 0x3b, 0xaa, 0xa8, 0x17, 0x07, 0x72, 0x54,
+  0xb4, 0xa0, 0x38, 0xfe, 0xee, 0x6e, 0x3c, 0x13, 0x8d, 0x57, 0x75, 0xaf,
+  0x5a, 0x0e, 0x78, 0xff, 0x2b, 0x03, 0xe8, 0xaa, 0xe8, 0x01, 0xa9, 0x95,
+  0xcb, 0x3f, 0x13, 0x6c, 0x8a, 0xb9, 0x51, 0x7b, 0x6b, 0xa5, 0x25, 0x45,
+  0xa4, 0xef, 0x3c, 0x8b, 0x15, 0x15, 0xdb, 0x5f, 0xc6, 0x8c, 0x1c, 0x36,
+  0xe0, 0x4b, 0xf1, 0x14, 0x77, 0x77, 0x77, 0x77, 0xc0, 0x62, 0x62, 0xbf,
+  0xb7, 0x32, 0x80, 0xc1, 0x0b, 0x33, 0xd6, 0x2a, 0x24, 0x91, 0xcc, 0x35,
+  0xf7, 0xdb, 0xb0, 0xfd, 0x7c, 0x46, 0x46, 0xf2, 0xc7, 0xf6, 0x9d, 0xc3,
+  0x23, 0x80, 0xbb, 0x84, 0xe3, 0xc3, 0x9b, 0x3e, 0xc2, 0xdf, 0x06, 0xc6,
+  0x62, 0xcc, 0x1f, 0xfd, 0x73, 0xbd, 0x07, 0x8b, 0x0e, 0x37, 0x1a, 0xab,
+  0xae, 0x97, 0x8d, 0x64, 0x3c, 0x30, 0x05, 0x31, 0x8f, 0xcd, 0xa8, 0x8d,
+  0x9b, 0xa0, 0x80, 0xb7, 0xfb, 0x37, 0x34, 0x0e, 0x10, 0x0a, 0xfb, 0x77,
+  0xac, 0x05, 0x3e, 0x10, 0xa8, 0x01, 0x79, 0x61, 0xaf, 0x8d, 0x06, 0x7f,
+  0xe1, 0x69, 0xf7, 0xd1, 0x12, 0xeb, 0xf8, 0xfa, 0x4a, 0xf4, 0xf7, 0xa7,
+  0x41, 0x5c, 0x5a, 0x3c, 0x07, 0x83, 0x6e, 0x91, 0x99, 0xc5, 0xe4, 0x99,
+  0x18, 0x55, 0xdf, 0x71, 0xb6, 0xb9, 0xa5, 0x01, 0x45, 0x45, 0x34, 0xf2,
+  0x5c, 0xf4, 0x1e, 0x68, 0x77, 0x10, 0x38, 0x99, 0x73, 0xa6, 0x48, 0x3a,
+  0x20, 0xc7, 0xfc, 0x63, 0xf3, 0x8d, 0x68, 0x5b, 0x55, 0x05, 0x36, 0x32,
+  0x32, 0x73, 0xe0, 0x18, 0x0f, 0x12, 0xd2, 0xa3, 0xb7, 0xf1, 0x72, 0x49,
+  0x61, 0x6e, 0x8d, 0x6e, 0xe4, 0x24, 0x50, 0x07, 0x92, 0x75, 0xed, 0x59,
+  0x59, 0x77, 0x19, 0x19, 0x31, 0xdb, 0x58, 0xb0, 0xa4, 0xa1, 0x43, 0x28,
+  0xaf, 0x22, 0x7c, 0x65, 0x40, 0x92, 0x4e, 0x66, 0xfb, 0x31, 0x17, 0x12,
+  0x82, 0x95, 0x1d, 0xf0, 0x90, 0x1b, 0x7f, 0x92, 0x36, 0x2e, 0x97, 0xfb,
+  0xf4, 0xf4, 0x49, 0x9e, 0xbe, 0x0d, 0x6d, 0x22, 0x92, 0xe9, 0x11, 0x5c,
+  0xee, 0x06, 0xad, 0xad, 0x2f, 0xbd, 0x98, 0xa9, 0x8f, 0x2a, 0xf4, 0x55,
+  0xe7, 0xcc, 0xc5, 0x34, 0x9c, 0x86, 0xb9, 0xf9, 0xd3, 0xef, 0xae, 0x85,
+  0x57, 0x8c, 0xb2, 0x01, 0x01, 0x51, 0x63, 0xff, 0xcc, 0x55, 0x47, 0x50,
+  0x32, 0x3d, 0xaa, 0x26, 0x6c, 0xa2, 0x6e, 0x59, 0x4c, 0xe0, 0xd0, 0xe6,
+  0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x4d, 0x5f, 0xe7, 0xf3, 0x21,
+  0x18, 0xbe, 0x32, 0xe9, 0xf8, 0x7a, 0x66, 0xb9, 0xad, 0xad, 0x29, 0xde,
+  0xec, 0xb6, 0x0c, 0xfb, 0xc7, 0x2e, 0xb8, 0x62, 0x80, 0xf3, 0xe6, 0x0f,
+  0x74, 0x97, 0xbe, 0x9e, 0xed, 0x5a, 0x74, 0x3b, 0x4e, 0xe2, 0x39, 0x16,
+  0x2f, 0x47, 0xbf, 0xa6, 0xf2, 0xcc, 0xd9, 0xe7, 0xa9, 0xb7, 0xcb, 0x2c,
+  0x2a, 0x0b, 0x0b, 0xc2, 0x9e, 0xfb, 0x56, 0x29, 0x74, 0xc2, 0x5f, 0xb8,
+  0xc3, 0xd5, 0xf0, 0xbf, 0x94, 0x98, 0x89, 0x44, 0x18, 0x7e, 0x68, 0x0b,
+  0x26, 0xf2, 0xb3, 0xe0, 0x98, 0xa9, 0x31, 0x4a, 0x70, 0xe1, 0x39, 0x2a,
+  0xe9, 0x0b, 0x4c, 0xdf, 0xe8, 0xe7, 0x05, 0x89, 0xbb, 0x00, 0x9f, 0x21,
+  0x55, 0xbb, 0x4d, 0x27, 0xde, 0xab, 0x85, 0x8e, 0x8c, 0x9d, 0x6c, 0x1f,
+  0x38, 0x3e, 0x0c, 0x0d, 0xac, 0x7d, 0x1e, 0xe9, 0xfd, 0xda, 0xeb, 0x89,
+  0x21, 0x9b, 0xa2, 0xdd, 0xa1, 0x8c, 0x4d, 0x01, 0xb2, 0xd8, 0x5a, 0xc7,
+  0x4c, 0x2b, 0x3c, 0xda, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xb9,
+  0xf9, 0x69, 0x62, 0x92, 0x6a, 0xfa, 0x11, 0x4f, 0xde, 0xf7, 0xb5, 0x9f,
+  0x22, 0xc8, 0x3f, 0x70, 0x1f, 0x3b, 0x79, 0x85, 0x62, 0x17, 0x6c, 0xfb,
+  0xda, 0x5d, 0xe0, 0x8d, 0xd1, 0xc0, 0x5d, 0x41, 0xeb, 0x30, 0xab, 0xe3,
+  0xde, 0xea, 0xd3, 0xa7, 0xe5, 0xd6, 0x79, 0x7e, 0xa7, 0x16, 0x9d, 0x42,
+  0x18, 0x81, 0x2b, 0x2b, 0xf6, 0x55, 0xe8, 0x52, 0xe9, 0xc9, 0x35, 0x8f,
+  0x49, 0xed, 0xb1, 0xfc, 0x21, 0xe2, 0x43, 0x5e, 0xa4, 0xe0, 0xec, 0x45,
+  0x7d, 0xb5, 0xc4, 0xd3, 0x94, 0xb5, 0xcf, 0x41, 0x2d, 0x90, 0xf5, 0xa4,
+  0x40, 0x7f, 0xe9, 0x8c, 0x7d, 0x39, 0x98, 0x61, 0x43, 0x12, 0xc0, 0xec,
+  0x0a, 0x4a, 0x3e, 0x3e, 0x82, 0x19, 0xa4, 0xa1, 0x3d, 0x30, 0x0a, 0xa3,
+  0x9c, 0xec, 0xdb, 0x8e, 0xff, 0x38, 0x9c, 0xf5, 0x1c, 0x62, 0x8b, 0x3d,
+  0xf6, 0xb4, 0xb4, 0x40, 0xfc, 0x41, 0x6c, 0x2f, 0x6f, 0x43, 0xb3, 0x74,
+  0x74, 0xb5, 0xcb, 0x6a, 0xfd, 0x92, 0xc3, 0xe2, 0x37, 0x01, 0x29, 0xae,
+  0x7b, 0x8b, 0x8b, 0xdf, 0x4e, 0x0b, 0xbb, 0xc7, 0xe6, 0x48, 0xf2, 0xdd,
+  0x13, 0x93, 0x97, 0xf9, 0xb2, 0xd4, 0xf9, 0x56, 0x35, 0xe2, 0x94, 0xaa,
+  0x7b, 0x7b, 0x73, 0x3c, 0x0d, 0x1a, 0x80, 0xd7, 0x72, 0x5a, 0x32, 0xa8,
+  0xc7, 0x3e, 0x4c, 0x01, 0xbf, 0x28, 0x86, 0x12, 0x75, 0xd7, 0x81, 0x30,
+  0x7f, 0x5f, 0x82, 0x96, 0xc0, 0x48, 0x7e, 0xcc, 0xac, 0x92, 0x53, 0x00,
+  0xa0, 0x52, 0x2b, 0xe5, 0xaa, 0xf0, 0x17, 0x95, 0x4d, 0x26, 0xc6, 0x28,
+  0x6b, 0xee, 0x23, 0x6f, 0xa4, 0x03, 0xf9, 0xe7, 0x8f, 0x13, 0x29, 0xa8,
+  0x0f, 0x66, 0xc3, 0x5d, 0xc8, 0x3b, 0xba, 0x71, 0x79, 0x9b, 0x5d, 0xec,
+  0x55, 0x66, 0x54, 0x08, 0x72, 0x48, 0xca, 0x21, 0x5b, 0xe9, 0xb5, 0xe9,
+  0xf3, 0xc7, 0xca, 0x56, 0x89, 0x7f, 0x69, 0xb2, 0xe7, 0x48, 0x6a, 0x19,
+  0x71, 0x29, 0xc4, 0xbf, 0x54, 0x98, 0xe5, 0xec, 0x25, 0xbe, 0x09, 0xaa,
+  0x5b, 0x46, 0x29, 0x29, 0xf3, 0x80, 0x50, 0x74, 0xe6, 0x98, 0x46, 0x4b,
+  0x8e, 0x87, 0x97, 0x7b, 0x74, 0x8e, 0x45, 0xdc, 0x68, 0x08, 0xd7, 0xaf,
+  0x4b, 0x03, 0xdd, 0x7a, 0x3d, 0x7a, 0x54, 0x69, 0xec, 0xef, 0x3f, 0xf3,
+  0xa4, 0xda, 0xb0, 0x8a, 0xae, 0xa3, 0xb6, 0xb6, 0xa5, 0x53, 0xea, 0x1e,
+  0x39, 0xf8, 0x8b, 0xab, 0xcb, 0x8f, 0x55, 0x50, 0x32, 0xad, 0x34, 0x67,
+  0x72, 0x7f, 0x1b, 0x8b, 0x19, 0xec, 0xcc, 0xa8, 0x66, 0xd2, 0x51, 0x51,
+  0x06, 0xbf, 0x35, 0xc1, 0xab, 0x90, 0x22, 0x22, 0x11, 0x32, 0xc6, 0xfb,
+  0x72, 0x72, 0x1b, 0xf7, 0x53, 0x53, 0x0c, 0x38, 0xf0, 0x79, 0x9d, 0x48,
+  0x43, 0xe1, 0x6e, 0x03, 0x62, 0x28, 0xe7, 0xc5, 0x5c, 0x81, 0x81, 0x1d,
+  0x49, 0x60, 0xcb, 0xcf, 0x1f, 0xe7, 0x9d, 0xeb, 0x83, 0xdf, 0xfa, 0x7f,
+  0xca, 0x9f, 0x2c, 0x6e, 0xc5, 0x13, 0x99, 0xb8, 0xc4, 0x19, 0x8f, 0x5e,
+  0xfd, 0x23, 0x10, 0x16, 0x39, 0x1a, 0x9b, 0x55, 0x30, 0x4a, 0xd0, 0x97,
+  0x35, 0x23, 0xbf, 0x5b, 0xc4, 0x83, 0xb1, 0x2f, 0xb1, 0xfd, 0x29, 0x5c,
+  0x55, 0x5b, 0xe0, 0x47, 0x14, 0xc0, 0xfe, 0x9e, 0xf4, 0x9e, 0xc2, 0xe9,
+  0xe9, 0xb4, 0xb4, 0x12, 0xbb, 0xbb, 0xfa, 0x6d, 0x4e, 0xe0, 0xd7, 0xd7,
+  0xd7, 0xf7, 0x77, 0xa3, 0xc9, 0x0b, 0x64, 0x93, 0x7a, 0x50, 0x02, 0xe3,
+  0xcb, 0x1a, 0x1f, 0x21, 0x41, 0x41, 0x55, 0xfc, 0x07, 0x82, 0xb0, 0x74,
+  0xa4, 0xa4, 0x6b, 0xce, 0xe2, 0xaf, 0x66, 0x77, 0xb4, 0x4b, 0xf4, 0xa7,
+  0x42, 0xbb, 0xe6, 0x1b, 0x1b, 0xdc, 0x9f, 0x5a, 0x9e, 0x9e, 0x22, 0x1f,
+  0x72, 0x52, 0x2e, 0x1a, 0xaf, 0xea, 0xee, 0x2e, 0x6c, 0x05, 0x0d, 0xcd,
+  0xe3, 0xce, 0x47, 0x5c, 0x3f, 0x66, 0x66, 0x96, 0x75, 0x9e, 0x57, 0x02,
+  0x0c, 0xd5, 0x94, 0x35, 0x90, 0x68, 0x75, 0x5c, 0xd7, 0x11, 0x47, 0x4e,
+  0x4e, 0x8f, 0xec, 0xc2, 0xe5, 0xa3, 0xa3, 0x97, 0xf5, 0x0c, 0x7e, 0x7e,
+  0x35, 0x4a, 0xea, 0xab, 0x93, 0xc6, 0xf9, 0x07, 0x85, 0x8b, 0x91, 0x61,
+  0x61, 0x90, 0x46, 0x5f, 0xae, 0x17, 0xc9, 0x58, 0x54, 0xae, 0x80, 0xf9,
+  0x84, 0x61, 0x61, 0xe5, 0x67, 0x12, 0xa7, 0xea, 0x14, 0x3d, 0x57, 0x49,
+  0x0d, 0x61, 0x8e, 0x7d, 0x44, 0x60, 0xb4, 0xf2, 0x2e, 0xdc, 0x54, 0x5b,
+  0x2f, 0x09, 0x2e, 0xf3, 0x66, 0x9c, 0xda, 0x62, 0x31, 0xe2, 0xf7, 0xed,
+  0x2d, 0x0e, 0x7e, 0x30, 0xc4, 0x63, 0xda, 0xa0, 0xa0, 0x4c, 0x4c, 0x08,
+  0x62, 0x56, 0x2f, 0x2f, 0xda, 0x6b, 0x7c, 0x4f, 0x19, 0xb3, 0x61, 0xf6,
+  0xc5, 0xde, 0x71, 0x25, 0x63, 0xe3, 0x21, 0x21, 0x14, 0x68, 0x27, 0xea,
+  0xea, 0x6a, 0x15, 0x95, 0xc0, 0x3d, 0x24, 0x24, 0xd0, 0xd6, 0x9b, 0x2e,
+  0xe5, 0x2b, 0x33, 0x8b, 0x0f, 0x0f, 0x73, 0x7d, 0x39, 0x2f, 0xad, 0x6a,
+  0x4c, 0x0a, 0x29, 0x26, 0x5b, 0xb6, 0xf5, 0x23, 0x52, 0x9a, 0xed, 0x7c,
+  0x7c, 0xb1, 0x14, 0x0d, 0xd7, 0xe3, 0x0f, 0x07, 0x07, 0x29, 0x55, 0x48,
+  0x9f, 0x1a, 0x8b, 0x64, 0x64, 0xb1, 0xcd, 0x1d, 0xd8, 0x26, 0x71, 0x71,
+  0x98, 0x4d, 0xa7, 0x24, 0x7f, 0x7f, 0xe7, 0xe1, 0x8a, 0x04, 0xa0, 0xef,
+  0x88, 0x6b, 0x7b, 0x13, 0x8f, 0x3f, 0x6d, 0x82, 0xf1, 0xf1, 0xf1, 0x1f,
+  0x1b, 0xed, 0x5c, 0x80, 0xd3, 0x5c, 0x56, 0x1f, 0xd4, 0x9a, 0x9a, 0xf3,
+  0x78, 0x25, 0x8a, 0xb9, 0x9f, 0x7e, 0x81, 0x71, 0x3e, 0xc0, 0x03, 0xea,
+  0x47, 0xf6, 0x39, 0x44, 0x94, 0x46, 0xd4, 0xe2, 0xaa, 0x31, 0x47, 0x83,
+  0x83, 0xda, 0x7d, 0x41, 0x41, 0xb9, 0xb3, 0xba, 0x5e, 0x4e, 0x19, 0x81,
+  0x4a, 0x43, 0xa2, 0xa0, 0x2c, 0x94, 0x94, 0x0f, 0xca, 0xce, 0xc1, 0xe4,
+  0x5d, 0xb4, 0x84, 0x4c, 0x4c, 0x9d, 0x21, 0xef, 0xa3, 0xf2, 0xbd, 0x55,
+  0x7c, 0xca, 0x6f, 0xba, 0x3c, 0xa0, 0xf5, 0xeb, 0xfd, 0xf7, 0xa9, 0xde,
+  0x84, 0xbe, 0xbe, 0x63, 0x7f, 0x6b, 0x4f, 0xa0, 0xd8, 0x9e, 0xe7, 0x6a,
+  0x4a, 0xce, 0x8e, 0x16, 0xe7, 0x3e, 0x6a, 0xf5, 0x06, 0xbc, 0x2f, 0x2f,
+  0x9b, 0x40, 0x12, 0x47, 0xb3, 0x60, 0x98, 0xfd, 0x6b, 0xa6, 0x34, 0xef,
+  0x22, 0xcf, 0x60, 0x60, 0x13, 0xb5, 0x24, 0x15, 0x87, 0x08, 0x08, 0x46,
+  0x5c, 0x1e, 0xba, 0x6f, 0x79, 0x36, 0xaf, 0x21, 0x6d, 0xad, 0x33, 0x52,
+  0xd7, 0xb4, 0xb4, 0x9f, 0x73, 0x48, 0x00, 0x00, 0x0e, 0x00, 0x1e, 0x00,
+  0x26, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x39, 0x00, 0x6e, 0x00, 0xa5, 0x00,
+  0xb1, 0x00, 0xbb, 0x00, 0xc5, 0x00, 0xd7, 0x00, 0x00, 0x00, 0x37, 0x00,
+  0x6f, 0x00, 0xa2, 0x00, 0xd6, 0x00, 0x0b, 0x01, 0x41, 0x01, 0x4d, 0x01,
+  0x59, 0x01, 0x00, 0x00, 0x0b, 0x00, 0x1d, 0x00, 0x2b, 0x00, 0x38, 0x00,
+  0x42, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x13, 0x00, 0x2b, 0x00, 0x42, 0x00,
+  0x00, 0x00, 0x11, 0x00, 0x21, 0x00, 0x2d, 0x00, 0x37, 0x00, 0x48, 0x00,
+  0x51, 0x00, 0x62, 0x00, 0x6d, 0x00, 0x80, 0x00, 0x86, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x18, 0x00, 0x23, 0x00, 0x31, 0x00, 0x3c, 0x00, 0x46, 0x00,
+  0x4d, 0x00, 0x5d, 0x00, 0x68, 0x00, 0x75, 0x00, 0x7e, 0x00, 0x84, 0x00,
+  0x91, 0x00, 0x00, 0x00, 0x08, 0x00, 0x15, 0x00, 0x21, 0x00, 0x29, 0x00,
+  0x35, 0x00, 0x3e, 0x00, 0x4b, 0x00, 0x53, 0x00, 0x60, 0x00, 0x6d, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x16, 0x00, 0x20, 0x00,
+  0x28, 0x00, 0x39, 0x00, 0x4f, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x1d, 0x00,
+  0x2c, 0x00, 0x3e, 0x00, 0x52, 0x00, 0x00, 0x00, 0x08, 0x00, 0x16, 0x00,
+  0x21, 0x00, 0x28, 0x00, 0x40, 0x00, 0x55, 0x00, 0x61, 0x00, 0x68, 0x00,
+  0x77, 0x00, 0x7e, 0x00, 0x8a, 0x00, 0x92, 0x00, 0xa0, 0x00, 0xaf, 0x00,
+  0xb5, 0x00, 0xbb, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x0f, 0x00,
+  0x1c, 0x00, 0x25, 0x00, 0x33, 0x00, 0x45, 0x00, 0x55, 0x00, 0x5e, 0x00,
+  0x6c, 0x00, 0x84, 0x00, 0x89, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x19, 0x00,
+  0x2a, 0x00, 0x3c, 0x00, 0x51, 0x00, 0x5a, 0x00, 0x63, 0x00, 0x6f, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x14, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x0d, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x1e, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x13, 0x00,
+  0x1c, 0x00, 0x27, 0x00, 0x31, 0x00, 0x00, 0x00, 0x08, 0x00, 0x14, 0x00,
+  0x22, 0x00, 0x2f, 0x00, 0x37, 0x00, 0x45, 0x00, 0x52, 0x00, 0x60, 0x00,
+  0x00, 0x00, 0x1a, 0x00, 0x2b, 0x00, 0x3e, 0x00, 0x51, 0x00, 0x63, 0x00,
+  0x74, 0x00, 0x85, 0x00, 0x94, 0x00, 0xa1, 0x00, 0xae, 0x00, 0xbc, 0x00,
+  0xcb, 0x00, 0xdc, 0x00, 0xeb, 0x00, 0xf9, 0x00, 0x09, 0x01, 0x18, 0x01,
+  0x27, 0x01, 0x31, 0x01, 0x00, 0x00, 0x08, 0x00, 0x15, 0x00, 0x27, 0x00,
+  0x3c, 0x00, 0x00, 0x00, 0x11, 0x00, 0x22, 0x00, 0x32, 0x00, 0x41, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x20, 0x00, 0x35, 0x00, 0x4a, 0x00, 0x55, 0x00,
+  0x5b, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1c, 0x00, 0x25, 0x00, 0x2f, 0x00,
+  0x00, 0x00, 0x0f, 0x00, 0x1f, 0x00, 0x2a, 0x00, 0x3a, 0x00, 0x43, 0x00,
+  0x56, 0x00, 0x00, 0x00, 0x13, 0x00, 0x24, 0x00, 0x2e, 0x00, 0x42, 0x00,
+  0x56, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x3b, 0x00,
+  0x46, 0x00, 0x52, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x40, 0x00, 0x4e, 0x00,
+  0x5d, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x1b, 0x00,
+  0x25, 0x00, 0x30, 0x00, 0x38, 0x00, 0x44, 0x00, 0x51, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x16, 0x00, 0x21, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1b, 0x00, 0x23, 0x00, 0x2f, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x21, 0x00, 0x2e, 0x00, 0x3e, 0x00, 0x00, 0x00,
+  0x2e, 0x00, 0x3e, 0x00, 0x50, 0x00, 0x62, 0x00, 0x70, 0x00, 0x7d, 0x00,
+  0x86, 0x00, 0x91, 0x00, 0x9e, 0x00, 0xa5, 0x00, 0xb0, 0x00, 0xc0, 0x00,
+  0x00, 0x00, 0x11, 0x00, 0x25, 0x00, 0x34, 0x00, 0x45, 0x00, 0x55, 0x00,
+  0x5b, 0x00, 0x70, 0x00, 0x82, 0x00, 0x94, 0x00, 0x9a, 0x00, 0xa0, 0x00,
+  0xa6, 0x00, 0xb3, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x14, 0x00, 0x24, 0x00,
+  0x2f, 0x00, 0x41, 0x00, 0x4a, 0x00, 0x00, 0x00, 0x14, 0x00, 0x26, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x22, 0x00, 0x2b, 0x00, 0x3d, 0x00, 0x4e, 0x00,
+  0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x15, 0x00, 0x00, 0x00,
+  0x28, 0x00, 0x31, 0x00, 0x3f, 0x00, 0x48, 0x00, 0x56, 0x00, 0x62, 0x00,
+  0x6b, 0x00, 0x76, 0x00, 0x8c, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x16, 0x00,
+  0x21, 0x00, 0x00, 0x00, 0x10, 0x00, 0x1d, 0x00, 0x29, 0x00, 0x37, 0x00,
+  0x00, 0x00, 0x15, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x09, 0x00, 0x0f, 0x00,
+  0x00, 0x00, 0x1c, 0x00, 0x31, 0x00, 0x3f, 0x00, 0x4d, 0x00, 0x59, 0x00,
+  0x63, 0x00, 0x6e, 0x00, 0x7b, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x2d, 0x00,
+  0x39, 0x00, 0x44, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x0d, 0x00,
+  0x19, 0x00, 0x21, 0x00, 0x30, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x08, 0x00,
+  0x19, 0x00, 0x20, 0x00, 0x2a, 0x00, 0x36, 0x00, 0x3f, 0x00, 0x51, 0x00,
+  0x62, 0x00, 0x6b, 0x00, 0x00, 0x00, 0x10, 0x00, 0x20, 0x00, 0x2a, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x18, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1e, 0x00,
+  0x2c, 0x00, 0x3c, 0x00, 0x4d, 0x00, 0x00, 0x00, 0x10, 0x00, 0x1d, 0x00,
+  0x2c, 0x00, 0x35, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x11, 0x00, 0x23, 0x00,
+  0x34, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x21, 0x00, 0x3c, 0x00,
+  0x50, 0x00, 0x5f, 0x00, 0x6f, 0x00, 0x78, 0x00, 0x00, 0x00, 0x22, 0x00,
+  0x3f, 0x00, 0x55, 0x00, 0x62, 0x00, 0x74, 0x00, 0x82, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x18, 0x00, 0x24, 0x00, 0x31, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x17, 0x00, 0x23, 0x00, 0x31, 0x00, 0x3d, 0x00, 0x48, 0x00, 0x54, 0x00,
+  0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1c, 0x00, 0x2b, 0x00,
+  0x39, 0x00, 0x45, 0x00, 0x4b, 0x00, 0x54, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x1a, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1c, 0x00, 0x28, 0x00, 0x34, 0x00,
+  0x00, 0x00, 0x0f, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x28, 0x00,
+  0x33, 0x00, 0x44, 0x00, 0x55, 0x00, 0x5e, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x16, 0x00, 0x28, 0x00, 0x37, 0x00, 0x43, 0x00, 0x52, 0x00, 0x60, 0x00,
+  0x6c, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x2b, 0x00, 0x35, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x00, 0x00, 0x11, 0x00, 0x1e, 0x00, 0x2f, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x40, 0x00, 0x66, 0x00, 0x82, 0x00, 0x99, 0x00, 0xb2, 0x00,
+  0xcb, 0x00, 0xe2, 0x00, 0x00, 0x00, 0x14, 0x00, 0x27, 0x00, 0x31, 0x00,
+  0x43, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x3c, 0x00, 0x60, 0x00, 0x7a, 0x00,
+  0x8f, 0x00, 0xa6, 0x00, 0xc9, 0x00, 0xd5, 0x00, 0xe5, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x17, 0x00, 0x26, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1e, 0x00,
+  0x28, 0x00, 0x38, 0x00, 0x49, 0x00, 0x51, 0x00, 0x00, 0x00, 0x0f, 0x00,
+  0x18, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x10, 0x00, 0x1c, 0x00,
+  0x2a, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x19, 0x00,
+  0x27, 0x00, 0x34, 0x00, 0x3e, 0x00, 0x48, 0x00, 0x4e, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x1d, 0x00, 0x2e, 0x00, 0x37, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x17, 0x00, 0x23, 0x00, 0x34, 0x00, 0x40, 0x00, 0x50, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x19, 0x00, 0x24, 0x00, 0x2d, 0x00, 0x3d, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x17, 0x00, 0x26, 0x00, 0x00, 0x00, 0x09, 0x00, 0x1b, 0x00,
+  0x2e, 0x00, 0x3a, 0x00, 0x46, 0x00, 0x00, 0x00, 0x20, 0x00, 0x2f, 0x00,
+  0x40, 0x00, 0x49, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x3c, 0x00, 0x59, 0x00,
+  0x7c, 0x00, 0x96, 0x00, 0xab, 0x00, 0xc6, 0x00, 0xdb, 0x00, 0xeb, 0x00,
+  0xf4, 0x00, 0x05, 0x01, 0x15, 0x01, 0x27, 0x01, 0x3a, 0x01, 0x43, 0x01,
+  0x54, 0x01, 0x5d, 0x01, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x38, 0x00,
+  0x53, 0x00, 0x74, 0x00, 0x8c, 0x00, 0xa0, 0x00, 0xb9, 0x00, 0xc9, 0x00,
+  0xda, 0x00, 0xf4, 0x00, 0x00, 0x00, 0x20, 0x00, 0x2e, 0x00, 0x3c, 0x00,
+  0x49, 0x00, 0x54, 0x00, 0x5d, 0x00, 0x6b, 0x00, 0x78, 0x00, 0x88, 0x00,
+  0x9e, 0x00, 0xab, 0x00, 0xb8, 0x00, 0xc0, 0x00, 0xce, 0x00, 0xdb, 0x00,
+  0xea, 0x00, 0xf6, 0x00, 0x00, 0x00, 0x11, 0x00, 0x20, 0x00, 0x2b, 0x00,
+  0x39, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x31, 0x00, 0x45, 0x00, 0x57, 0x00,
+  0x5f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x29, 0x00, 0x37, 0x00,
+  0x46, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x1b, 0x00,
+  0x23, 0x00, 0x31, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00,
+  0x1b, 0x00, 0x27, 0x00, 0x30, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x1a, 0x00,
+  0x29, 0x00, 0x39, 0x00, 0x46, 0x00, 0x4d, 0x00, 0x5c, 0x00, 0x69, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x14, 0x00, 0x27, 0x00, 0x00, 0x00, 0x12, 0x00,
+  0x1b, 0x00, 0x2c, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x12, 0x00, 0x22, 0x00,
+  0x2d, 0x00, 0x34, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x3a, 0x00, 0x55, 0x00,
+  0x78, 0x00, 0x91, 0x00, 0xb8, 0x00, 0xda, 0x00, 0xee, 0x00, 0xfe, 0x00,
+  0x11, 0x01, 0x23, 0x01, 0x35, 0x01, 0x43, 0x01, 0x50, 0x01, 0x5a, 0x01,
+  0x67, 0x01, 0x72, 0x01, 0x89, 0x01, 0x93, 0x01, 0xa3, 0x01, 0x00, 0x00,
+  0x1b, 0x00, 0x31, 0x00, 0x42, 0x00, 0x50, 0x00, 0x5d, 0x00, 0x69, 0x00,
+  0x79, 0x00, 0x85, 0x00, 0x8e, 0x00, 0x96, 0x00, 0x00, 0x00, 0x1d, 0x00,
+  0x36, 0x00, 0x4f, 0x00, 0x70, 0x00, 0x87, 0x00, 0xac, 0x00, 0xcc, 0x00,
+  0xe2, 0x00, 0xf3, 0x00, 0x02, 0x01, 0x11, 0x01, 0x22, 0x01, 0x31, 0x01,
+  0x3d, 0x01, 0x4b, 0x01, 0x56, 0x01, 0x5f, 0x01, 0x6f, 0x01, 0x81, 0x01,
+  0x00, 0x00, 0x1e, 0x00, 0x31, 0x00, 0x42, 0x00, 0x54, 0x00, 0x5e, 0x00,
+  0x6e, 0x00, 0x00, 0x00, 0x15, 0x00, 0x23, 0x00, 0x2b, 0x00, 0x3d, 0x00,
+  0x47, 0x00, 0x5b, 0x00, 0x6d, 0x00, 0x7e, 0x00, 0x8a, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x30, 0x00, 0x43, 0x00, 0x56, 0x00, 0x69, 0x00, 0x00, 0x00,
+  0x1b, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x24, 0x00, 0x2f, 0x00, 0x3c, 0x00,
+  0x45, 0x00, 0x00, 0x00, 0x16, 0x00, 0x29, 0x00, 0x3c, 0x00, 0x4e, 0x00,
+  0x64, 0x00, 0x00, 0x00, 0x16, 0x00, 0x21, 0x00, 0x2d, 0x00, 0x36, 0x00,
+  0x44, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x10, 0x00, 0x2a, 0x00,
+  0x3a, 0x00, 0x4a, 0x00, 0x54, 0x00, 0x62, 0x00, 0x6e, 0x00, 0x77, 0x00,
+  0x00, 0x00, 0x1b, 0x00, 0x24, 0x00, 0x2b, 0x00, 0x3d, 0x00, 0x4d, 0x00,
+  0x5d, 0x00, 0x00, 0x00, 0x14, 0x00, 0x1f, 0x00, 0x29, 0x00, 0x37, 0x00,
+  0x42, 0x00, 0x00, 0x00, 0x10, 0x00, 0x26, 0x00, 0x32, 0x00, 0x3f, 0x00,
+  0x4b, 0x00, 0x00, 0x00, 0x14, 0x00, 0x30, 0x00, 0x3f, 0x00, 0x4d, 0x00,
+  0x5e, 0x00, 0x6b, 0x00, 0x00, 0x00, 0x25, 0x00, 0x45, 0x00, 0x5f, 0x00,
+  0x78, 0x00, 0x88, 0x00, 0x96, 0x00, 0x9d, 0x00, 0xa7, 0x00, 0x00, 0x00,
+  0x16, 0x00, 0x20, 0x00, 0x34, 0x00, 0x00, 0x00, 0x23, 0x00, 0x41, 0x00,
+  0x59, 0x00, 0x7d, 0x00, 0x8f, 0x00, 0xa6, 0x00, 0xb5, 0x00, 0xca, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x23, 0x00, 0x00, 0x00, 0x11, 0x00, 0x27, 0x00,
+  0x44, 0x00, 0x52, 0x00, 0x00, 0x00, 0x27, 0x00, 0x3f, 0x00, 0x4d, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x19, 0x00, 0x21, 0x00, 0x29, 0x00, 0x36, 0x00,
+  0x45, 0x00, 0x00, 0x00, 0x09, 0x00, 0x1f, 0x00, 0x2d, 0x00, 0x38, 0x00,
+  0x00, 0x00, 0x19, 0x00, 0x35, 0x00, 0x46, 0x00, 0x59, 0x00, 0x69, 0x00,
+  0x74, 0x00, 0x7f, 0x00, 0x8b, 0x00, 0x93, 0x00, 0x9d, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x1c, 0x00, 0x32, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x0d, 0x00,
+  0x1a, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x17, 0x00,
+  0x22, 0x00, 0x2e, 0x00, 0x3d, 0x00, 0x4a, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x1f, 0x00, 0x31, 0x00, 0x42, 0x00, 0x54, 0x00, 0x5f, 0x00, 0x74, 0x00,
+  0x86, 0x00, 0x00, 0x00, 0x12, 0x00, 0x24, 0x00, 0x3c, 0x00, 0x45, 0x00,
+  0x50, 0x00, 0x60, 0x00, 0x00, 0x00, 0x18, 0x00, 0x33, 0x00, 0x49, 0x00,
+  0x5d, 0x00, 0x74, 0x00, 0x81, 0x00, 0x8c, 0x00, 0x00, 0x00, 0x11, 0x00,
+  0x22, 0x00, 0x3c, 0x00, 0x48, 0x00, 0x56, 0x00, 0x6a, 0x00, 0x74, 0x00,
+  0x81, 0x00, 0x00, 0x00, 0x14, 0x00, 0x29, 0x00, 0x3f, 0x00, 0x4a, 0x00,
+  0x54, 0x00, 0x64, 0x00, 0x00, 0x00, 0x11, 0x00, 0x28, 0x00, 0x3b, 0x00,
+  0x44, 0x00, 0x53, 0x00, 0x60, 0x00, 0x6f, 0x00, 0x7f, 0x00, 0x8f, 0x00,
+  0x98, 0x00, 0xa7, 0x00, 0xb7, 0x00, 0xc0, 0x00, 0xcf, 0x00, 0xd6, 0x00,
+  0xe5, 0x00, 0xf6, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x43, 0x00, 0x58, 0x00,
+  0x62, 0x00, 0x6d, 0x00, 0x7d, 0x00, 0x8b, 0x00, 0x9a, 0x00, 0x00, 0x00,
+  0x16, 0x00, 0x23, 0x00, 0x30, 0x00, 0x3d, 0x00, 0x50, 0x00, 0x61, 0x00,
+  0x6e, 0x00, 0x81, 0x00, 0x91, 0x00, 0x00, 0x00, 0x12, 0x00, 0x29, 0x00,
+  0x3b, 0x00, 0x48, 0x00, 0x00, 0x00, 0x11, 0x00, 0x24, 0x00, 0x31, 0x00,
+  0x38, 0x00, 0x45, 0x00, 0x00, 0x00, 0x17, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x15, 0x00, 0x28, 0x00, 0x35, 0x00, 0x00, 0x00, 0x12, 0x00,
+  0x26, 0x00, 0x39, 0x00, 0x50, 0x00, 0x5c, 0x00, 0x66, 0x00, 0x6e, 0x00,
+  0x7e, 0x00, 0x87, 0x00, 0x00, 0x00, 0x12, 0x00, 0x25, 0x00, 0x39, 0x00,
+  0x4e, 0x00, 0x55, 0x00, 0x64, 0x00, 0x75, 0x00, 0x00, 0x00, 0x17, 0x00,
+  0x2f, 0x00, 0x00, 0x00, 0x18, 0x00, 0x2e, 0x00, 0x41, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x26, 0x00, 0x47, 0x00, 0x51, 0x00, 0x5b, 0x00, 0x00, 0x00,
+  0x15, 0x00, 0x28, 0x00, 0x3e, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x18, 0x00,
+  0x2c, 0x00, 0x3b, 0x00, 0x48, 0x00, 0x51, 0x00, 0x61, 0x00, 0x70, 0x00,
+  0x7f, 0x00, 0x8d, 0x00, 0x96, 0x00, 0xa5, 0x00, 0xb4, 0x00, 0xc4, 0x00,
+  0xd3, 0x00, 0xe3, 0x00, 0xed, 0x00, 0xfc, 0x00, 0x0a, 0x01, 0x13, 0x01,
+  0x21, 0x01, 0x30, 0x01, 0x40, 0x01, 0x00, 0x00, 0x14, 0x00, 0x29, 0x00,
+  0x00, 0x00, 0x22, 0x00, 0x31, 0x00, 0x3c, 0x00, 0x47, 0x00, 0x4e, 0x00,
+  0x00, 0x00, 0x16, 0x00, 0x2f, 0x00, 0x43, 0x00, 0x53, 0x00, 0x62, 0x00,
+  0x6b, 0x00, 0x81, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x12, 0x00,
+  0x26, 0x00, 0x37, 0x00, 0x48, 0x00, 0x58, 0x00, 0x65, 0x00, 0x72, 0x00,
+  0x82, 0x00, 0x8b, 0x00, 0x98, 0x00, 0xa6, 0x00, 0xb6, 0x00, 0xc6, 0x00,
+  0xd5, 0x00, 0xe4, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x37, 0x00, 0x43, 0x00,
+  0x55, 0x00, 0x69, 0x00, 0x7d, 0x00, 0x84, 0x00, 0x00, 0x00, 0x11, 0x00,
+  0x21, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x14, 0x00, 0x1d, 0x00, 0x00, 0x00,
+  0x18, 0x00, 0x30, 0x00, 0x43, 0x00, 0x5d, 0x00, 0x64, 0x00, 0x73, 0x00,
+  0x7e, 0x00, 0x87, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x2c, 0x00, 0x3c, 0x00,
+  0x46, 0x00, 0x52, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1c, 0x00, 0x28, 0x00,
+  0x36, 0x00, 0x44, 0x00, 0x50, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x15, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x2f, 0x00, 0x40, 0x00, 0x52, 0x00,
+  0x67, 0x00, 0x77, 0x00, 0x89, 0x00, 0x9c, 0x00, 0x00, 0x00, 0x17, 0x00,
+  0x2b, 0x00, 0x3d, 0x00, 0x4b, 0x00, 0x59, 0x00, 0x62, 0x00, 0x71, 0x00,
+  0x7a, 0x00, 0x8b, 0x00, 0x99, 0x00, 0xa6, 0x00, 0xb4, 0x00, 0xbd, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x23, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x26, 0x00, 0x31, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00,
+  0x1d, 0x00, 0x2f, 0x00, 0x38, 0x00, 0x46, 0x00, 0x58, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x18, 0x00, 0x21, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x12, 0x00,
+  0x22, 0x00, 0x2c, 0x00, 0x3b, 0x00, 0x46, 0x00, 0x57, 0x00, 0x68, 0x00,
+  0x7d, 0x00, 0x87, 0x00, 0x9b, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x17, 0x00,
+  0x28, 0x00, 0x00, 0x00, 0x13, 0x00, 0x25, 0x00, 0x33, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x21, 0x00, 0x30, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x1e, 0x00,
+  0x2a, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x18, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x29, 0x00, 0x38, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x15, 0x00, 0x22, 0x00, 0x33, 0x00, 0x46, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x19, 0x00, 0x21, 0x00, 0x00, 0x00, 0x10, 0x00, 0x19, 0x00,
+  0x27, 0x00, 0x33, 0x00, 0x3e, 0x00, 0x49, 0x00, 0x58, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x1d, 0x00, 0x26, 0x00, 0x37, 0x00, 0x49, 0x00, 0x56, 0x00,
+  0x5f, 0x00, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x1e, 0x00,
+  0x32, 0x00, 0x43, 0x00, 0x57, 0x00, 0x61, 0x00, 0x6e, 0x00, 0x7a, 0x00,
+  0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x11, 0x00, 0x20, 0x00, 0x28, 0x00,
+  0x37, 0x00, 0x44, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x30, 0x00, 0x42, 0x00,
+  0x55, 0x00, 0x68, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x12, 0x00,
+  0x1b, 0x00, 0x2d, 0x00, 0x39, 0x00, 0x45, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x1a, 0x00, 0x2c, 0x00, 0x36, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x16, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x16, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x1d, 0x00, 0x26, 0x00,
+  0x36, 0x00, 0x44, 0x00, 0x52, 0x00, 0x61, 0x00, 0x71, 0x00, 0x7f, 0x00,
+  0x8e, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1e, 0x00, 0x30, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x17, 0x00, 0x22, 0x00, 0x32, 0x00, 0x3e, 0x00, 0x4b, 0x00,
+  0x00, 0x00, 0x0a, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x09, 0x00, 0x19, 0x00,
+  0x29, 0x00, 0x33, 0x00, 0x44, 0x00, 0x53, 0x00, 0x61, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x1d, 0x00, 0x2b, 0x00, 0x3c, 0x00, 0x4c, 0x00,
+  0x5d, 0x00, 0x68, 0x00, 0x00, 0x00, 0x19, 0x00, 0x23, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x18, 0x00, 0x26, 0x00,
+  0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x18, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x13, 0x00, 0x00, 0x00, 0x15, 0x00,
+  0x25, 0x00, 0x2d, 0x00, 0x36, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1f, 0x00,
+  0x34, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x19, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x1b, 0x00, 0x25, 0x00, 0x33, 0x00, 0x3f, 0x00, 0x4d, 0x00,
+  0x58, 0x00, 0x61, 0x00, 0x00, 0x00, 0x09, 0x00, 0x18, 0x00, 0x26, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x1a, 0x00, 0x23, 0x00, 0x35, 0x00, 0x42, 0x00,
+  0x4a, 0x00, 0x57, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x09, 0x00, 0x1a, 0x00,
+  0x2b, 0x00, 0x34, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x14, 0x00, 0x27, 0x00,
+  0x32, 0x00, 0x38, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1f, 0x00, 0x31, 0x00,
+  0x3c, 0x00, 0x4c, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x16, 0x00, 0x00, 0x00, 0x11, 0x00, 0x22, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x1a, 0x00, 0x25, 0x00, 0x30, 0x00, 0x00, 0x00, 0x08, 0x00, 0x17, 0x00,
+  0x1f, 0x00, 0x2d, 0x00, 0x3c, 0x00, 0x4a, 0x00, 0x58, 0x00, 0x66, 0x00,
+  0x74, 0x00, 0x84, 0x00, 0x94, 0x00, 0xa1, 0x00, 0xae, 0x00, 0xb6, 0x00,
+  0xbe, 0x00, 0xcb, 0x00, 0xd8, 0x00, 0xe6, 0x00, 0xee, 0x00, 0xf7, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x14, 0x00, 0x20, 0x00,
+  0x2b, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x19, 0x00, 0x26, 0x00, 0x33, 0x00,
+  0x40, 0x00, 0x4e, 0x00, 0x5b, 0x00, 0x69, 0x00, 0x71, 0x00, 0x7e, 0x00,
+  0x8c, 0x00, 0x9a, 0x00, 0xa8, 0x00, 0xb5, 0x00, 0xc4, 0x00, 0xd1, 0x00,
+  0xdd, 0x00, 0xe6, 0x00, 0xf3, 0x00, 0xfd, 0x00, 0x0b, 0x01, 0x19, 0x01,
+  0x28, 0x01, 0x30, 0x01, 0x38, 0x01, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x1c, 0x00, 0x25, 0x00, 0x2f, 0x00, 0x39, 0x00, 0x00, 0x00, 0x1d, 0x00,
+  0x31, 0x00, 0x42, 0x00, 0x53, 0x00, 0x65, 0x00, 0x6f, 0x00, 0x80, 0x00,
+  0x8a, 0x00, 0x94, 0x00, 0x9e, 0x00, 0xa8, 0x00, 0xb9, 0x00, 0xc3, 0x00,
+  0xd3, 0x00, 0xdd, 0x00, 0xeb, 0x00, 0x00, 0x00, 0x21, 0x00, 0x2d, 0x00,
+  0x35, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x19, 0x00, 0x29, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x46, 0x00,
+  0x58, 0x00, 0x61, 0x00, 0x71, 0x00, 0x77, 0x00, 0x00, 0x00, 0x11, 0x00,
+  0x21, 0x00, 0x33, 0x00, 0x44, 0x00, 0x4e, 0x00, 0x5a, 0x00, 0x64, 0x00,
+  0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x17, 0x00, 0x24, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x1c, 0x00, 0x2c, 0x00, 0x38, 0x00,
+  0x45, 0x00, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x20, 0x00,
+  0x2a, 0x00, 0x3b, 0x00, 0x49, 0x00, 0x51, 0x00, 0x5a, 0x00, 0x62, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x19, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x15, 0x00,
+  0x1f, 0x00, 0x28, 0x00, 0x35, 0x00, 0x42, 0x00, 0x4f, 0x00, 0x5b, 0x00,
+  0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x19, 0x00, 0x22, 0x00,
+  0x2e, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x20, 0x00, 0x31, 0x00, 0x3f, 0x00,
+  0x00, 0x00, 0x0b, 0x00, 0x15, 0x00, 0x00, 0x00, 0x19, 0x00, 0x25, 0x00,
+  0x3d, 0x00, 0x00, 0x00, 0x14, 0x00, 0x1e, 0x00, 0x2a, 0x00, 0x35, 0x00,
+  0x4a, 0x00, 0x56, 0x00, 0x00, 0x00, 0x17, 0x00, 0x23, 0x00, 0x35, 0x00,
+  0x3c, 0x00, 0x50, 0x00, 0x00, 0x00, 0x15, 0x00, 0x23, 0x00, 0x30, 0x00,
+  0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x22, 0x00, 0x2f, 0x00, 0x37, 0x00,
+  0x45, 0x00, 0x52, 0x00, 0x62, 0x00, 0x6f, 0x00, 0x7b, 0x00, 0x87, 0x00,
+  0x94, 0x00, 0xa1, 0x00, 0xaf, 0x00, 0xbd, 0x00, 0xcb, 0x00, 0xd3, 0x00,
+  0xdb, 0x00, 0xed, 0x00, 0xfa, 0x00, 0x07, 0x01, 0x16, 0x01, 0x23, 0x01,
+  0x31, 0x01, 0x3c, 0x01, 0x48, 0x01, 0x55, 0x01, 0x69, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x11, 0x00, 0x25, 0x00, 0x33, 0x00, 0x3d, 0x00, 0x4e, 0x00,
+  0x5b, 0x00, 0x6b, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x11, 0x00, 0x1c, 0x00,
+  0x29, 0x00, 0x35, 0x00, 0x40, 0x00, 0x4c, 0x00, 0x58, 0x00, 0x64, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x1a, 0x00, 0x29, 0x00, 0x37, 0x00, 0x43, 0x00,
+  0x4b, 0x00, 0x57, 0x00, 0x66, 0x00, 0x70, 0x00, 0x7f, 0x00, 0x95, 0x00,
+  0xa2, 0x00, 0xae, 0x00, 0xb9, 0x00, 0xc5, 0x00, 0xd2, 0x00, 0xe6, 0x00,
+  0xf4, 0x00, 0x01, 0x01, 0x0f, 0x01, 0x26, 0x01, 0x33, 0x01, 0x3f, 0x01,
+  0x4a, 0x01, 0x63, 0x01, 0x00, 0x00, 0x23, 0x00, 0x2e, 0x00, 0x36, 0x00,
+  0x41, 0x00, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1d, 0x00,
+  0x31, 0x00, 0x3c, 0x00, 0x47, 0x00, 0x4f, 0x00, 0x5a, 0x00, 0x65, 0x00,
+  0x70, 0x00, 0x7b, 0x00, 0x87, 0x00, 0x9c, 0x00, 0xb0, 0x00, 0x00, 0x00,
+  0x15, 0x00, 0x21, 0x00, 0x00, 0x00, 0x20, 0x00, 0x3b, 0x00, 0x4c, 0x00,
+  0x5c, 0x00, 0x69, 0x00, 0x75, 0x00, 0x7e, 0x00, 0x8b, 0x00, 0x9b, 0x00,
+  0xab, 0x00, 0xb1, 0x00, 0x00, 0x00, 0x21, 0x00, 0x3d, 0x00, 0x48, 0x00,
+  0x00, 0x00, 0x13, 0x00, 0x1d, 0x00, 0x31, 0x00, 0x45, 0x00, 0x57, 0x00,
+  0x6a, 0x00, 0x7a, 0x00, 0x8f, 0x00, 0x9f, 0x00, 0xaf, 0x00, 0xba, 0x00,
+  0xc7, 0x00, 0xd7, 0x00, 0xe4, 0x00, 0xf1, 0x00, 0xfa, 0x00, 0x0b, 0x01,
+  0x00, 0x00, 0x14, 0x00, 0x1c, 0x00, 0x2b, 0x00, 0x33, 0x00, 0x44, 0x00,
+  0x4d, 0x00, 0x53, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x12, 0x00, 0x20, 0x00,
+  0x2c, 0x00, 0x36, 0x00, 0x40, 0x00, 0x48, 0x00, 0x00, 0x00, 0x20, 0x00,
+  0x30, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x2e, 0x00, 0x40, 0x00, 0x51, 0x00,
+  0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x09, 0x00, 0x12, 0x00, 0x1b, 0x00,
+  0x00, 0x00, 0x0a, 0x00, 0x1c, 0x00, 0x25, 0x00, 0x36, 0x00, 0x45, 0x00,
+  0x56, 0x00, 0x00, 0x00, 0x14, 0x00, 0x27, 0x00, 0x33, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x18, 0x00, 0x24, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x15, 0x00, 0x22, 0x00, 0x2d, 0x00, 0x3d, 0x00, 0x4a, 0x00, 0x55, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x21, 0x00, 0x2c, 0x00, 0x37, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x11, 0x00, 0x26, 0x00, 0x3a, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x25, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x24, 0x00, 0x34, 0x00, 0x00, 0x00, 0x10, 0x00, 0x1f, 0x00, 0x30, 0x00,
+  0x36, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x0b, 0x00,
+  0x11, 0x00, 0x17, 0x00, 0x00, 0x00, 0x12, 0x00, 0x25, 0x00, 0x30, 0x00,
+  0x41, 0x00, 0x52, 0x00, 0x00, 0x00, 0x20, 0x00, 0x2e, 0x00, 0x43, 0x00,
+  0x4b, 0x00, 0x55, 0x00, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00,
+  0x2a, 0x00, 0x35, 0x00, 0x00, 0x00, 0x11, 0x00, 0x1b, 0x00, 0x2e, 0x00,
+  0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x1b, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x15, 0x00, 0x2d, 0x00, 0x39, 0x00, 0x00, 0x00, 0x13, 0x00,
+  0x1e, 0x00, 0x28, 0x00, 0x33, 0x00, 0x46, 0x00, 0x53, 0x00, 0x00, 0x00,
+  0x1f, 0x00, 0x2c, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x09, 0x00, 0x12, 0x00,
+  0x1e, 0x00, 0x31, 0x00, 0x3a, 0x00, 0x40, 0x00, 0x46, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x29, 0x00, 0x31, 0x00, 0x39, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x1e, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x22, 0x00,
+  0x30, 0x00, 0x00, 0x00, 0x10, 0x00, 0x21, 0x00, 0x2b, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x1a, 0x00, 0x2a, 0x00, 0x34, 0x00, 0x43, 0x00, 0x4f, 0x00,
+  0x5f, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x1d, 0x00,
+  0x2c, 0x00, 0x3a, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x21, 0x00, 0x35, 0x00,
+  0x48, 0x00, 0x5b, 0x00, 0x67, 0x00, 0x78, 0x00, 0x89, 0x00, 0x9a, 0x00,
+  0xaf, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x1a, 0x00, 0x29, 0x00, 0x36, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x22, 0x00, 0x00, 0x00, 0x0f, 0x00,
+  0x18, 0x00, 0x24, 0x00, 0x33, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x16, 0x00,
+  0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x17, 0x00, 0x21, 0x00, 0x31, 0x00,
+  0x41, 0x00, 0x54, 0x00, 0x66, 0x00, 0x6f, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x1b, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x1c, 0x00, 0x2a, 0x00, 0x3c, 0x00,
+  0x4a, 0x00, 0x55, 0x00, 0x60, 0x00, 0x6d, 0x00, 0x7b, 0x00, 0x87, 0x00,
+  0x00, 0x00, 0x11, 0x00, 0x28, 0x00, 0x3f, 0x00, 0x50, 0x00, 0x60, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x09, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x1e, 0x00, 0x27, 0x00, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x18, 0x00, 0x29, 0x00, 0x3a, 0x00, 0x44, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x16, 0x00, 0x00, 0x00, 0x12, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x12, 0x00, 0x1b, 0x00, 0x28, 0x00, 0x3d, 0x00,
+  0x45, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x24, 0x00, 0x00, 0x00, 0x0b, 0x00,
+  0x18, 0x00, 0x25, 0x00, 0x00, 0x00, 0x12, 0x00, 0x21, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x1d, 0x00, 0x28, 0x00, 0x32, 0x00, 0x3b, 0x00, 0x45, 0x00,
+  0x56, 0x00, 0x61, 0x00, 0x6a, 0x00, 0x79, 0x00, 0x00, 0x00, 0x0f, 0x00,
+  0x00, 0x00, 0x0a, 0x00, 0x20, 0x00, 0x2a, 0x00, 0x39, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x1b, 0x00, 0x25, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x13, 0x00,
+  0x24, 0x00, 0x34, 0x00, 0x00, 0x00, 0x13, 0x00, 0x21, 0x00, 0x27, 0x00,
+  0x38, 0x00, 0x42, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x1c, 0x00, 0x25, 0x00,
+  0x32, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x1b, 0x00, 0x28, 0x00,
+  0x35, 0x00, 0x42, 0x00, 0x4a, 0x00, 0x58, 0x00, 0x6b, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x18, 0x00, 0x29, 0x00, 0x39, 0x00, 0x43, 0x00, 0x4f, 0x00,
+  0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x1a, 0x00, 0x2a, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x1b, 0x00, 0x28, 0x00, 0x38, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x00, 0x00, 0x07, 0x00, 0x12, 0x00, 0x1d, 0x00, 0x30, 0x00,
+  0x39, 0x00, 0x46, 0x00, 0x54, 0x00, 0x60, 0x00, 0x00, 0x00, 0x0a, 0x00,
+  0x00, 0x00, 0x0f, 0x00, 0x1e, 0x00, 0x27, 0x00, 0x31, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1e, 0x00, 0x2b, 0x00, 0x33, 0x00,
+  0x41, 0x00, 0x4e, 0x00, 0x5c, 0x00, 0x69, 0x00, 0x78, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x1b, 0x00, 0x2e, 0x00, 0x41, 0x00,
+  0x51, 0x00, 0x64, 0x00, 0x79, 0x00, 0x84, 0x00, 0x90, 0x00, 0x98, 0x00,
+  0xa1, 0x00, 0xab, 0x00, 0xb4, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x1e, 0x00, 0x28, 0x00, 0x39, 0x00, 0x43, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x1b, 0x00, 0x24, 0x00, 0x30, 0x00, 0x39, 0x00, 0x46, 0x00,
+  0x54, 0x00, 0x61, 0x00, 0x6d, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x13, 0x00,
+  0x27, 0x00, 0x3c, 0x00, 0x49, 0x00, 0x5a, 0x00, 0x6b, 0x00, 0x77, 0x00,
+  0x00, 0x00, 0x0b, 0x00, 0x1a, 0x00, 0x2a, 0x00, 0x37, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x20, 0x00, 0x2e, 0x00, 0x38, 0x00, 0x00, 0x00, 0x06, 0x00,
+  0x19, 0x00, 0x2b, 0x00, 0x3b, 0x00, 0x4d, 0x00, 0x56, 0x00, 0x65, 0x00,
+  0x6e, 0x00, 0x7a, 0x00, 0x8a, 0x00, 0x93, 0x00, 0x9f, 0x00, 0x00, 0x00,
+  0x1e, 0x00, 0x31, 0x00, 0x41, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x14, 0x00, 0x1e, 0x00, 0x28, 0x00,
+  0x32, 0x00, 0x3a, 0x00, 0x44, 0x00, 0x54, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x1e, 0x00, 0x2c, 0x00, 0x39, 0x00, 0x00, 0x00, 0x12, 0x00, 0x1d, 0x00,
+  0x28, 0x00, 0x00, 0x00, 0x19, 0x00, 0x2e, 0x00, 0x3a, 0x00, 0x49, 0x00,
+  0x56, 0x00, 0x68, 0x00, 0x78, 0x00, 0x00, 0x00, 0x12, 0x00, 0x1e, 0x00,
+  0x35, 0x00, 0x43, 0x00, 0x4c, 0x00, 0x56, 0x00, 0x61, 0x00, 0x00, 0x00,
+  0x18, 0x00, 0x27, 0x00, 0x38, 0x00, 0x40, 0x00, 0x4c, 0x00, 0x58, 0x00,
+  0x60, 0x00, 0x6e, 0x00, 0x78, 0x00, 0x7e, 0x00, 0x86, 0x00, 0x91, 0x00,
+  0x9d, 0x00, 0xb4, 0x00, 0x00, 0x00, 0x17, 0x00, 0x21, 0x00, 0x00, 0x00,
+  0x1b, 0x00, 0x2c, 0x00, 0x3a, 0x00, 0x44, 0x00, 0x00, 0x00, 0x18, 0x00,
+  0x28, 0x00, 0x38, 0x00, 0x4a, 0x00, 0x54, 0x00, 0x65, 0x00, 0x00, 0x00,
+  0x1a, 0x00, 0x26, 0x00, 0x00, 0x00, 0x18, 0x00, 0x26, 0x00, 0x36, 0x00,
+  0x00, 0x00, 0x15, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x29, 0x00,
+  0x32, 0x00, 0x40, 0x00, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00,
+  0x14, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1f, 0x00, 0x2b, 0x00,
+  0x36, 0x00, 0x46, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x19, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x1b, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x1f, 0x00, 0x2e, 0x00, 0x39, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x1e, 0x00, 0x31, 0x00, 0x44, 0x00, 0x50, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x17, 0x00, 0x23, 0x00, 0x00, 0x00, 0x07, 0x00, 0x17, 0x00,
+  0x25, 0x00, 0x2f, 0x00, 0x3b, 0x00, 0x44, 0x00, 0x4d, 0x00, 0x56, 0x00,
+  0x60, 0x00, 0x72, 0x00, 0x80, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1e, 0x00,
+  0x2e, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1c, 0x00, 0x25, 0x00, 0x33, 0x00,
+  0x3f, 0x00, 0x4b, 0x00, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x1e, 0x00, 0x2b, 0x00, 0x3b, 0x00, 0x49, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x17, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x30, 0x00, 0x4c, 0x00,
+  0x66, 0x00, 0x7b, 0x00, 0x90, 0x00, 0x9f, 0x00, 0xaf, 0x00, 0xbf, 0x00,
+  0xcc, 0x00, 0x00, 0x00, 0x17, 0x00, 0x22, 0x00, 0x2c, 0x00, 0x35, 0x00,
+  0x3d, 0x00, 0x47, 0x00, 0x51, 0x00, 0x62, 0x00, 0x72, 0x00, 0x82, 0x00,
+  0x8d, 0x00, 0x93, 0x00, 0x99, 0x00, 0x00, 0x00, 0x13, 0x00, 0x24, 0x00,
+  0x00, 0x00, 0x0f, 0x00, 0x19, 0x00, 0x00, 0x00, 0x13, 0x00, 0x21, 0x00,
+  0x30, 0x00, 0x3f, 0x00, 0x49, 0x00, 0x55, 0x00, 0x6c, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x1e, 0x00, 0x3a, 0x00, 0x46, 0x00, 0x4f, 0x00, 0x5b, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x1c, 0x00, 0x2a, 0x00, 0x33, 0x00, 0x43, 0x00,
+  0x54, 0x00, 0x60, 0x00, 0x6f, 0x00, 0x7b, 0x00, 0x00, 0x00, 0x12, 0x00,
+  0x25, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x21, 0x00, 0x32, 0x00, 0x47, 0x00,
+  0x54, 0x00, 0x64, 0x00, 0x6a, 0x00, 0x73, 0x00, 0x85, 0x00, 0x9a, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x15, 0x00, 0x24, 0x00, 0x37, 0x00, 0x41, 0x00,
+  0x47, 0x00, 0x00, 0x00, 0x13, 0x00, 0x22, 0x00, 0x33, 0x00, 0x43, 0x00,
+  0x4b, 0x00, 0x53, 0x00, 0x5c, 0x00, 0x67, 0x00, 0x71, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x1f, 0x00, 0x2e, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x19, 0x00, 0x2a, 0x00, 0x3a, 0x00, 0x48, 0x00, 0x56, 0x00, 0x65, 0x00,
+  0x73, 0x00, 0x83, 0x00, 0x8c, 0x00, 0x9a, 0x00, 0xa8, 0x00, 0xb6, 0x00,
+  0x00, 0x00, 0x0b, 0x00, 0x17, 0x00, 0x25, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x1b, 0x00, 0x2a, 0x00, 0x3a, 0x00, 0x4b, 0x00, 0x5a, 0x00, 0x6a, 0x00,
+  0x73, 0x00, 0x85, 0x00, 0x95, 0x00, 0xa0, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x1a, 0x00, 0x28, 0x00, 0x35, 0x00, 0x43, 0x00, 0x50, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x1d, 0x00, 0x27, 0x00, 0x36, 0x00, 0x45, 0x00, 0x4b, 0x00,
+  0x51, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x19, 0x00, 0x27, 0x00, 0x33, 0x00,
+  0x40, 0x00, 0x47, 0x00, 0x54, 0x00, 0x60, 0x00, 0x6d, 0x00, 0x00, 0x00,
+  0x15, 0x00, 0x24, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x1c, 0x00, 0x26, 0x00,
+  0x34, 0x00, 0x44, 0x00, 0x53, 0x00, 0x61, 0x00, 0x6d, 0x00, 0x7f, 0x00,
+  0x8c, 0x00, 0x9d, 0x00, 0xa7, 0x00, 0xb1, 0x00, 0xc1, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x20, 0x00, 0x2c, 0x00, 0x44, 0x00, 0x4c, 0x00, 0x62, 0x00,
+  0x00, 0x00, 0x1a, 0x00, 0x2b, 0x00, 0x3b, 0x00, 0x46, 0x00, 0x5c, 0x00,
+  0x67, 0x00, 0x7a, 0x00, 0x8e, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x26, 0x00,
+  0x38, 0x00, 0x47, 0x00, 0x53, 0x00, 0x5e, 0x00, 0x66, 0x00, 0x75, 0x00,
+  0x81, 0x00, 0x8c, 0x00, 0x98, 0x00, 0xa2, 0x00, 0x00, 0x00, 0x20, 0x00,
+  0x32, 0x00, 0x46, 0x00, 0x50, 0x00, 0x00, 0x00, 0x09, 0x00, 0x19, 0x00,
+  0x27, 0x00, 0x35, 0x00, 0x44, 0x00, 0x53, 0x00, 0x62, 0x00, 0x72, 0x00,
+  0x81, 0x00, 0x90, 0x00, 0xa0, 0x00, 0xaf, 0x00, 0xb8, 0x00, 0xc2, 0x00,
+  0xcc, 0x00, 0xdb, 0x00, 0xe4, 0x00, 0xed, 0x00, 0xf6, 0x00, 0x06, 0x01,
+  0x16, 0x01, 0x20, 0x01, 0x30, 0x01, 0x40, 0x01, 0x50, 0x01, 0x5f, 0x01,
+  0x70, 0x01, 0x7e, 0x01, 0x00, 0x00, 0x0f, 0x00, 0x18, 0x00, 0x28, 0x00,
+  0x31, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x29, 0x00, 0x34, 0x00, 0x48, 0x00,
+  0x5b, 0x00, 0x68, 0x00, 0x7b, 0x00, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x2c, 0x00, 0x3f, 0x00, 0x48, 0x00, 0x5f, 0x00, 0x68, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x15, 0x00, 0x1e, 0x00, 0x27, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0b, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x20, 0x00, 0x2a, 0x00, 0x34, 0x00, 0x00, 0x00, 0x19, 0x00, 0x20, 0x00,
+  0x2a, 0x00, 0x34, 0x00, 0x00, 0x00, 0x19, 0x00, 0x27, 0x00, 0x30, 0x00,
+  0x3a, 0x00, 0x45, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x00, 0x00, 0x0a, 0x00, 0x1d, 0x00, 0x26, 0x00, 0x36, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x23, 0x00,
+  0x2f, 0x00, 0x00, 0x00, 0x09, 0x00, 0x11, 0x00, 0x21, 0x00, 0x2a, 0x00,
+  0x36, 0x00, 0x47, 0x00, 0x5b, 0x00, 0x66, 0x00, 0x70, 0x00, 0x79, 0x00,
+  0x00, 0x00, 0x0f, 0x00, 0x1d, 0x00, 0x26, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x00, 0x00, 0x16, 0x00, 0x20, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x19, 0x00, 0x26, 0x00, 0x2f, 0x00, 0x3f, 0x00, 0x4e, 0x00, 0x58, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x1f, 0x00, 0x2f, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1d, 0x00, 0x2a, 0x00, 0x32, 0x00,
+  0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x16, 0x00, 0x33, 0x00, 0x40, 0x00,
+  0x00, 0x00, 0x11, 0x00, 0x1d, 0x00, 0x29, 0x00, 0x3e, 0x00, 0x52, 0x00,
+  0x59, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x26, 0x00, 0x31, 0x00, 0x3f, 0x00,
+  0x4c, 0x00, 0x59, 0x00, 0x00, 0x00, 0x17, 0x00, 0x2f, 0x00, 0x39, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x1c, 0x00, 0x2c, 0x00, 0x3b, 0x00, 0x4a, 0x00,
+  0x58, 0x00, 0x65, 0x00, 0x6f, 0x00, 0x79, 0x00, 0x82, 0x00, 0x93, 0x00,
+  0x9c, 0x00, 0xac, 0x00, 0xba, 0x00, 0xc8, 0x00, 0xd2, 0x00, 0xdb, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x16, 0x00, 0x21, 0x00, 0x2c, 0x00,
+  0x37, 0x00, 0x42, 0x00, 0x55, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x0f, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x1e, 0x00, 0x27, 0x00, 0x30, 0x00, 0x3f, 0x00,
+  0x54, 0x00, 0x5d, 0x00, 0x6b, 0x00, 0x79, 0x00, 0x7e, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x1a, 0x00, 0x24, 0x00, 0x2d, 0x00, 0x37, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x18, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x26, 0x00, 0x3b, 0x00, 0x48, 0x00, 0x53, 0x00, 0x5d, 0x00,
+  0x6d, 0x00, 0x77, 0x00, 0x81, 0x00, 0x8c, 0x00, 0x96, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x17, 0x00, 0x24, 0x00, 0x2f, 0x00, 0x38, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0a, 0x00, 0x20, 0x00, 0x2f, 0x00, 0x3e, 0x00, 0x47, 0x00,
+  0x57, 0x00, 0x00, 0x00, 0x15, 0x00, 0x23, 0x00, 0x00, 0x00, 0x19, 0x00,
+  0x2e, 0x00, 0x42, 0x00, 0x48, 0x00, 0x58, 0x00, 0x69, 0x00, 0x74, 0x00,
+  0x85, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x19, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x1c, 0x00, 0x2a, 0x00, 0x39, 0x00, 0x47, 0x00, 0x56, 0x00, 0x64, 0x00,
+  0x6f, 0x00, 0x77, 0x00, 0x86, 0x00, 0x94, 0x00, 0x00, 0x00, 0x19, 0x00,
+  0x31, 0x00, 0x49, 0x00, 0x60, 0x00, 0x72, 0x00, 0x7e, 0x00, 0x89, 0x00,
+  0x00, 0x00, 0x0b, 0x00, 0x1c, 0x00, 0x28, 0x00, 0x34, 0x00, 0x3d, 0x00,
+  0x47, 0x00, 0x50, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x18, 0x00, 0x27, 0x00, 0x37, 0x00, 0x44, 0x00, 0x4a, 0x00, 0x5d, 0x00,
+  0x69, 0x00, 0x76, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1d, 0x00, 0x28, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x18, 0x00, 0x25, 0x00, 0x32, 0x00, 0x41, 0x00,
+  0x4d, 0x00, 0x58, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
+  0x15, 0x00, 0x1f, 0x00, 0x2b, 0x00, 0x40, 0x00, 0x55, 0x00, 0x6c, 0x00,
+  0x72, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1c, 0x00, 0x28, 0x00, 0x33, 0x00,
+  0x3f, 0x00, 0x52, 0x00, 0x59, 0x00, 0x68, 0x00, 0x75, 0x00, 0x85, 0x00,
+  0x00, 0x00, 0x14, 0x00, 0x20, 0x00, 0x2e, 0x00, 0x3c, 0x00, 0x4b, 0x00,
+  0x58, 0x00, 0x64, 0x00, 0x71, 0x00, 0x00, 0x00, 0x14, 0x00, 0x21, 0x00,
+  0x2d, 0x00, 0x00, 0x00, 0x11, 0x00, 0x1d, 0x00, 0x27, 0x00, 0x32, 0x00,
+  0x40, 0x00, 0x47, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x1a, 0x00, 0x28, 0x00,
+  0x34, 0x00, 0x3f, 0x00, 0x50, 0x00, 0x5f, 0x00, 0x6f, 0x00, 0x00, 0x00,
+  0x16, 0x00, 0x23, 0x00, 0x32, 0x00, 0x3a, 0x00, 0x46, 0x00, 0x55, 0x00,
+  0x62, 0x00, 0x70, 0x00, 0x7d, 0x00, 0x8b, 0x00, 0x93, 0x00, 0xa0, 0x00,
+  0xa9, 0x00, 0xb6, 0x00, 0x00, 0x00, 0x12, 0x00, 0x20, 0x00, 0x2f, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x1f, 0x00, 0x28, 0x00, 0x31, 0x00, 0x3a, 0x00,
+  0x42, 0x00, 0x00, 0x00, 0x13, 0x00, 0x26, 0x00, 0x36, 0x00, 0x46, 0x00,
+  0x58, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x18, 0x00, 0x26, 0x00, 0x35, 0x00,
+  0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x12, 0x00, 0x20, 0x00, 0x2f, 0x00,
+  0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x12, 0x00, 0x00, 0x00, 0x17, 0x00, 0x2a, 0x00, 0x36, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x11, 0x00, 0x1f, 0x00, 0x2f, 0x00, 0x3f, 0x00, 0x47, 0x00,
+  0x00, 0x00, 0x1d, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x12, 0x00, 0x1e, 0x00,
+  0x32, 0x00, 0x3a, 0x00, 0x47, 0x00, 0x57, 0x00, 0x00, 0x00, 0x24, 0x00,
+  0x3e, 0x00, 0x51, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1d, 0x00, 0x30, 0x00, 0x47, 0x00, 0x57, 0x00, 0x66, 0x00,
+  0x71, 0x00, 0x7d, 0x00, 0x85, 0x00, 0x94, 0x00, 0xa1, 0x00, 0xaf, 0x00,
+  0xb7, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x2d, 0x00, 0x48, 0x00, 0x54, 0x00,
+  0x66, 0x00, 0x00, 0x00, 0x17, 0x00, 0x24, 0x00, 0x30, 0x00, 0x3e, 0x00,
+  0x4b, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x22, 0x00, 0x00, 0x00, 0x0f, 0x00,
+  0x1d, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x14, 0x00,
+  0x26, 0x00, 0x2f, 0x00, 0x38, 0x00, 0x4b, 0x00, 0x57, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x00, 0x00, 0x15, 0x00, 0x26, 0x00, 0x36, 0x00, 0x40, 0x00,
+  0x4b, 0x00, 0x56, 0x00, 0x64, 0x00, 0x6d, 0x00, 0x7c, 0x00, 0x91, 0x00,
+  0xa0, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x1f, 0x00, 0x2c, 0x00, 0x3b, 0x00,
+  0x46, 0x00, 0x5b, 0x00, 0x6d, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x14, 0x00,
+  0x1a, 0x00, 0x00, 0x00, 0x10, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x0b, 0x00,
+  0x1d, 0x00, 0x30, 0x00, 0x3a, 0x00, 0x48, 0x00, 0x59, 0x00, 0x6c, 0x00,
+  0x76, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x10, 0x00, 0x19, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x1d, 0x00, 0x2f, 0x00, 0x4a, 0x00, 0x55, 0x00, 0x62, 0x00,
+  0x6a, 0x00, 0x77, 0x00, 0x85, 0x00, 0x92, 0x00, 0xa1, 0x00, 0xa9, 0x00,
+  0xb7, 0x00, 0xc5, 0x00, 0xdb, 0x00, 0xe8, 0x00, 0xf4, 0x00, 0x00, 0x00,
+  0x1b, 0x00, 0x00, 0x00, 0x13, 0x00, 0x2e, 0x00, 0x43, 0x00, 0x59, 0x00,
+  0x63, 0x00, 0x6d, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x15, 0x00, 0x27, 0x00,
+  0x34, 0x00, 0x40, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x14, 0x00,
+  0x23, 0x00, 0x2b, 0x00, 0x39, 0x00, 0x46, 0x00, 0x53, 0x00, 0x68, 0x00,
+  0x75, 0x00, 0x83, 0x00, 0x8c, 0x00, 0x94, 0x00, 0x9d, 0x00, 0xab, 0x00,
+  0xb8, 0x00, 0xc0, 0x00, 0xcf, 0x00, 0xdc, 0x00, 0xe9, 0x00, 0xf7, 0x00,
+  0xff, 0x00, 0x08, 0x01, 0x16, 0x01, 0x25, 0x01, 0x33, 0x01, 0x42, 0x01,
+  0x00, 0x00, 0x0f, 0x00, 0x20, 0x00, 0x38, 0x00, 0x4c, 0x00, 0x58, 0x00,
+  0x00, 0x00, 0x0f, 0x00, 0x22, 0x00, 0x2f, 0x00, 0x3e, 0x00, 0x4b, 0x00,
+  0x00, 0x00, 0x13, 0x00, 0x26, 0x00, 0x36, 0x00, 0x46, 0x00, 0x56, 0x00,
+  0x63, 0x00, 0x76, 0x00, 0x81, 0x00, 0x92, 0x00, 0x9d, 0x00, 0xb0, 0x00,
+  0xbb, 0x00, 0xce, 0x00, 0xd5, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x20, 0x00,
+  0x2f, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x00, 0x00, 0x19, 0x00, 0x38, 0x00, 0x40, 0x00, 0x4a, 0x00,
+  0x54, 0x00, 0x60, 0x00, 0x00, 0x00, 0x13, 0x00, 0x1f, 0x00, 0x2f, 0x00,
+  0x3b, 0x00, 0x4f, 0x00, 0x5c, 0x00, 0x65, 0x00, 0x74, 0x00, 0x80, 0x00,
+  0x89, 0x00, 0x98, 0x00, 0xa8, 0x00, 0xb8, 0x00, 0x00, 0x00, 0x0d, 0x00,
+  0x1b, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x2e, 0x00, 0x3e, 0x00, 0x4e, 0x00,
+  0x5e, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x19, 0x00, 0x24, 0x00, 0x30, 0x00,
+  0x00, 0x00, 0x14, 0x00, 0x27, 0x00, 0x43, 0x00, 0x4f, 0x00, 0x59, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x18, 0x00, 0x23, 0x00,
+  0x35, 0x00, 0x41, 0x00, 0x4e, 0x00, 0x53, 0x00, 0x64, 0x00, 0x6f, 0x00,
+  0x82, 0x00, 0x00, 0x00, 0x13, 0x00, 0x1c, 0x00, 0x2a, 0x00, 0x41, 0x00,
+  0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1f, 0x00, 0x2f, 0x00,
+  0x3d, 0x00, 0x4c, 0x00, 0x5b, 0x00, 0x6b, 0x00, 0x74, 0x00, 0x7c, 0x00,
+  0x89, 0x00, 0x00, 0x00, 0x12, 0x00, 0x1f, 0x00, 0x29, 0x00, 0x3a, 0x00,
+  0x48, 0x00, 0x51, 0x00, 0x60, 0x00, 0x6f, 0x00, 0x78, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x21, 0x00, 0x32, 0x00, 0x47, 0x00, 0x55, 0x00, 0x6a, 0x00,
+  0x75, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x1b, 0x00, 0x27, 0x00,
+  0x39, 0x00, 0x45, 0x00, 0x00, 0x00, 0x08, 0x00, 0x17, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x14, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1d, 0x00, 0x30, 0x00,
+  0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x1c, 0x00, 0x28, 0x00,
+  0x39, 0x00, 0x43, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x17, 0x00, 0x21, 0x00,
+  0x2c, 0x00, 0x37, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x1c, 0x00, 0x33, 0x00,
+  0x4a, 0x00, 0x5a, 0x00, 0x69, 0x00, 0x76, 0x00, 0x7f, 0x00, 0xa0, 0x00,
+  0xb4, 0x00, 0xbe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x1c, 0x00,
+  0x25, 0x00, 0x35, 0x00, 0x3e, 0x00, 0x4f, 0x00, 0x58, 0x00, 0x61, 0x00,
+  0x73, 0x00, 0x7c, 0x00, 0x8b, 0x00, 0x94, 0x00, 0x9e, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x16, 0x00, 0x27, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x1b, 0x00, 0x2f, 0x00, 0x3f, 0x00, 0x49, 0x00, 0x4f, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x20, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x13, 0x00, 0x23, 0x00,
+  0x34, 0x00, 0x3f, 0x00, 0x4a, 0x00, 0x56, 0x00, 0x6d, 0x00, 0x78, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x16, 0x00, 0x24, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0f, 0x00, 0x1f, 0x00, 0x2e, 0x00, 0x4c, 0x00, 0x62, 0x00,
+  0x72, 0x00, 0x8f, 0x00, 0xa4, 0x00, 0xb3, 0x00, 0xc4, 0x00, 0xd4, 0x00,
+  0xe1, 0x00, 0xeb, 0x00, 0xfc, 0x00, 0x0b, 0x01, 0x00, 0x00, 0x18, 0x00,
+  0x28, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x08, 0x00,
+  0x14, 0x00, 0x20, 0x00, 0x27, 0x00, 0x30, 0x00, 0x3e, 0x00, 0x52, 0x00,
+  0x66, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x1a, 0x00, 0x26, 0x00, 0x33, 0x00,
+  0x3d, 0x00, 0x4a, 0x00, 0x00, 0x00, 0x17, 0x00, 0x27, 0x00, 0x37, 0x00,
+  0x49, 0x00, 0x5e, 0x00, 0x73, 0x00, 0x86, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x19, 0x00, 0x24, 0x00, 0x00, 0x00, 0x0f, 0x00,
+  0x22, 0x00, 0x2b, 0x00, 0x35, 0x00, 0x3d, 0x00, 0x4f, 0x00, 0x5d, 0x00,
+  0x6c, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x19, 0x00, 0x2b, 0x00, 0x3b, 0x00,
+  0x4e, 0x00, 0x5e, 0x00, 0x6e, 0x00, 0x7f, 0x00, 0x86, 0x00, 0x90, 0x00,
+  0xa1, 0x00, 0xb2, 0x00, 0xc2, 0x00, 0xd3, 0x00, 0xe5, 0x00, 0x00, 0x00,
+  0x16, 0x00, 0x27, 0x00, 0x37, 0x00, 0x40, 0x00, 0x00, 0x00, 0x12, 0x00,
+  0x00, 0x00, 0x18, 0x00, 0x26, 0x00, 0x36, 0x00, 0x41, 0x00, 0x49, 0x00,
+  0x00, 0x00, 0x11, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1e, 0x00,
+  0x25, 0x00, 0x31, 0x00, 0x44, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x18, 0x00, 0x24, 0x00, 0x33, 0x00, 0x3f, 0x00, 0x50, 0x00,
+  0x61, 0x00, 0x71, 0x00, 0x7a, 0x00, 0x84, 0x00, 0x92, 0x00, 0xa2, 0x00,
+  0xb3, 0x00, 0xc4, 0x00, 0xcd, 0x00, 0x00, 0x00, 0x11, 0x00, 0x21, 0x00,
+  0x35, 0x00, 0x48, 0x00, 0x56, 0x00, 0x62, 0x00, 0x6b, 0x00, 0x77, 0x00,
+  0x8b, 0x00, 0x9d, 0x00, 0xaa, 0x00, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x00, 0x12, 0x00, 0x21, 0x00, 0x00, 0x00, 0x07, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x11, 0x00, 0x1b, 0x00, 0x24, 0x00,
+  0x00, 0x00, 0x0f, 0x00, 0x1b, 0x00, 0x2a, 0x00, 0x35, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x18, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x16, 0x00, 0x2d, 0x00,
+  0x44, 0x00, 0x51, 0x00, 0x68, 0x00, 0x7d, 0x00, 0x89, 0x00, 0xa0, 0x00,
+  0x00, 0x00, 0x0b, 0x00, 0x1c, 0x00, 0x25, 0x00, 0x00, 0x00, 0x0b, 0x00,
+  0x17, 0x00, 0x21, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x1e, 0x00, 0x2e, 0x00, 0x3e, 0x00, 0x4e, 0x00, 0x57, 0x00, 0x61, 0x00,
+  0x71, 0x00, 0x80, 0x00, 0x8f, 0x00, 0x9d, 0x00, 0xab, 0x00, 0xb9, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x1b, 0x00, 0x29, 0x00, 0x34, 0x00, 0x00, 0x00,
+  0x1d, 0x00, 0x30, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x30, 0x00,
+  0x3f, 0x00, 0x52, 0x00, 0x61, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1b, 0x00,
+  0x28, 0x00, 0x33, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x12, 0x00, 0x25, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x0d, 0x00,
+  0x18, 0x00, 0x26, 0x00, 0x39, 0x00, 0x4a, 0x00, 0x57, 0x00, 0x66, 0x00,
+  0x78, 0x00, 0x87, 0x00, 0x95, 0x00, 0x00, 0x00, 0x14, 0x00, 0x25, 0x00,
+  0x2f, 0x00, 0x00, 0x00, 0x09, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x1d, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x1c, 0x00, 0x29, 0x00, 0x37, 0x00, 0x4b, 0x00, 0x59, 0x00, 0x68, 0x00,
+  0x73, 0x00, 0x79, 0x00, 0x00, 0x00, 0x11, 0x00, 0x22, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x1a, 0x00, 0x27, 0x00, 0x38, 0x00, 0x48, 0x00, 0x56, 0x00,
+  0x62, 0x00, 0x69, 0x00, 0x72, 0x00, 0x81, 0x00, 0x91, 0x00, 0xa2, 0x00,
+  0xab, 0x00, 0xb2, 0x00, 0xc2, 0x00, 0xd1, 0x00, 0xda, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x20, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x1e, 0x00, 0x29, 0x00, 0x32, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x15, 0x00, 0x1e, 0x00, 0x2c, 0x00, 0x39, 0x00, 0x45, 0x00,
+  0x50, 0x00, 0x00, 0x00, 0x17, 0x00, 0x2a, 0x00, 0x30, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x19, 0x00, 0x28, 0x00, 0x39, 0x00, 0x48, 0x00, 0x51, 0x00,
+  0x61, 0x00, 0x74, 0x00, 0x83, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x1b, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x17, 0x00, 0x24, 0x00, 0x30, 0x00, 0x3b, 0x00,
+  0x00, 0x00, 0x19, 0x00, 0x25, 0x00, 0x2e, 0x00, 0x36, 0x00, 0x4a, 0x00,
+  0x53, 0x00, 0x5b, 0x00, 0x66, 0x00, 0x71, 0x00, 0x00, 0x00, 0x0b, 0x00,
+  0x13, 0x00, 0x20, 0x00, 0x31, 0x00, 0x41, 0x00, 0x4d, 0x00, 0x5c, 0x00,
+  0x65, 0x00, 0x76, 0x00, 0x7f, 0x00, 0x8d, 0x00, 0x9e, 0x00, 0xa8, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x16, 0x00, 0x22, 0x00, 0x2c, 0x00, 0x3c, 0x00,
+  0x4c, 0x00, 0x00, 0x00, 0x19, 0x00, 0x22, 0x00, 0x2f, 0x00, 0x36, 0x00,
+  0x00, 0x00, 0x0a, 0x00, 0x10, 0x00, 0x18, 0x00, 0x22, 0x00, 0x2f, 0x00,
+  0x3e, 0x00, 0x4c, 0x00, 0x55, 0x00, 0x5d, 0x00, 0x63, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x20, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x16, 0x00, 0x00, 0x00, 0x08, 0x00, 0x16, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x1a, 0x00, 0x2d, 0x00, 0x39, 0x00, 0x43, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x19, 0x00, 0x23, 0x00, 0x30, 0x00, 0x3d, 0x00, 0x45, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x0b, 0x00,
+  0x00, 0x00, 0x08, 0x00, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00,
+  0x1d, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x19, 0x00, 0x29, 0x00, 0x37, 0x00,
+  0x00, 0x00, 0x0b, 0x00, 0x16, 0x00, 0x22, 0x00, 0x00, 0x00, 0x0b, 0x00,
+  0x17, 0x00, 0x27, 0x00, 0x00, 0x00, 0x10, 0x00, 0x24, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x1a, 0x00, 0x23, 0x00, 0x32, 0x00, 0x3b, 0x00, 0x4b, 0x00,
+  0x54, 0x00, 0x63, 0x00, 0x00, 0x00, 0x26, 0x00, 0x39, 0x00, 0x4a, 0x00,
+  0x54, 0x00, 0x66, 0x00, 0x79, 0x00, 0x8b, 0x00, 0x96, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x1f, 0x00, 0x2a, 0x00, 0x37, 0x00, 0x44, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x21, 0x00, 0x30, 0x00, 0x39, 0x00, 0x49, 0x00, 0x5e, 0x00,
+  0x69, 0x00, 0x79, 0x00, 0x84, 0x00, 0x99, 0x00, 0x00, 0x00, 0x1c, 0x00,
+  0x2e, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x12, 0x00, 0x20, 0x00, 0x2d, 0x00,
+  0x3a, 0x00, 0x47, 0x00, 0x61, 0x00, 0x6c, 0x00, 0x74, 0x00, 0x7d, 0x00,
+  0x90, 0x00, 0x9c, 0x00, 0xa3, 0x00, 0xb2, 0x00, 0xba, 0x00, 0xc9, 0x00,
+  0xd7, 0x00, 0xdf, 0x00, 0xed, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x22, 0x00, 0x33, 0x00, 0x44, 0x00, 0x53, 0x00, 0x62, 0x00,
+  0x73, 0x00, 0x83, 0x00, 0x92, 0x00, 0x00, 0x00, 0x12, 0x00, 0x23, 0x00,
+  0x2c, 0x00, 0x3b, 0x00, 0x46, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x16, 0x00,
+  0x24, 0x00, 0x30, 0x00, 0x3c, 0x00, 0x48, 0x00, 0x52, 0x00, 0x5a, 0x00,
+  0x00, 0x00, 0x14, 0x00, 0x20, 0x00, 0x00, 0x00, 0x11, 0x00, 0x22, 0x00,
+  0x2b, 0x00, 0x3a, 0x00, 0x4a, 0x00, 0x5b, 0x00, 0x6b, 0x00, 0x7a, 0x00,
+  0x88, 0x00, 0x98, 0x00, 0xa7, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x2d, 0x00,
+  0x3b, 0x00, 0x4d, 0x00, 0x57, 0x00, 0x66, 0x00, 0x79, 0x00, 0x00, 0x00,
+  0x1d, 0x00, 0x2a, 0x00, 0x37, 0x00, 0x43, 0x00, 0x4f, 0x00, 0x5d, 0x00,
+  0x6b, 0x00, 0x78, 0x00, 0x84, 0x00, 0x90, 0x00, 0x9a, 0x00, 0xa3, 0x00,
+  0x00, 0x00, 0x08, 0x00, 0x12, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1f, 0x00,
+  0x27, 0x00, 0x36, 0x00, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x12, 0x00, 0x1b, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x16, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x19, 0x00, 0x00, 0x00, 0x08, 0x00, 0x17, 0x00,
+  0x27, 0x00, 0x3a, 0x00, 0x48, 0x00, 0x56, 0x00, 0x00, 0x00, 0x15, 0x00,
+  0x31, 0x00, 0x42, 0x00, 0x53, 0x00, 0x64, 0x00, 0x74, 0x00, 0x82, 0x00,
+  0x8f, 0x00, 0xa0, 0x00, 0xae, 0x00, 0xbf, 0x00, 0xd2, 0x00, 0xe2, 0x00,
+  0xf2, 0x00, 0xfb, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x28, 0x00,
+  0x2f, 0x00, 0x38, 0x00, 0x44, 0x00, 0x54, 0x00, 0x5f, 0x00, 0x6b, 0x00,
+  0x00, 0x00, 0x0b, 0x00, 0x15, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x30, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x41, 0x00, 0x55, 0x00, 0x71, 0x00,
+  0x81, 0x00, 0x00, 0x00, 0x22, 0x00, 0x44, 0x00, 0x60, 0x00, 0x69, 0x00,
+  0x7f, 0x00, 0x91, 0x00, 0xa8, 0x00, 0xb2, 0x00, 0x00, 0x00, 0x0a, 0x00,
+  0x18, 0x00, 0x27, 0x00, 0x36, 0x00, 0x44, 0x00, 0x51, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x25, 0x00, 0x31, 0x00, 0x40, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x1d, 0x00, 0x25, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00,
+  0x18, 0x00, 0x29, 0x00, 0x40, 0x00, 0x50, 0x00, 0x59, 0x00, 0x6c, 0x00,
+  0x7e, 0x00, 0x8f, 0x00, 0xa1, 0x00, 0xb2, 0x00, 0xc3, 0x00, 0xd5, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x25, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x1c, 0x00,
+  0x31, 0x00, 0x45, 0x00, 0x58, 0x00, 0x00, 0x00, 0x12, 0x00, 0x1f, 0x00,
+  0x2a, 0x00, 0x39, 0x00, 0x00, 0x00, 0x13, 0x00, 0x24, 0x00, 0x3d, 0x00,
+  0x4b, 0x00, 0x59, 0x00, 0x6b, 0x00, 0x7a, 0x00, 0x86, 0x00, 0x92, 0x00,
+  0x9b, 0x00, 0xa9, 0x00, 0xb7, 0x00, 0x00, 0x00, 0x13, 0x00, 0x21, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x2c, 0x00, 0x3a, 0x00, 0x48, 0x00, 0x56, 0x00,
+  0x65, 0x00, 0x70, 0x00, 0x79, 0x00, 0x83, 0x00, 0x93, 0x00, 0xa1, 0x00,
+  0xaa, 0x00, 0xba, 0x00, 0xca, 0x00, 0x00, 0x00, 0x11, 0x00, 0x20, 0x00,
+  0x2b, 0x00, 0x34, 0x00, 0x3d, 0x00, 0x46, 0x00, 0x57, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x39, 0x00, 0x46, 0x00, 0x52, 0x00, 0x5b, 0x00, 0x65, 0x00,
+  0x7b, 0x00, 0x80, 0x00, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00,
+  0x21, 0x00, 0x31, 0x00, 0x3a, 0x00, 0x49, 0x00, 0x57, 0x00, 0x65, 0x00,
+  0x74, 0x00, 0x81, 0x00, 0x93, 0x00, 0xa2, 0x00, 0xa9, 0x00, 0xb2, 0x00,
+  0xbb, 0x00, 0xc4, 0x00, 0xd2, 0x00, 0xdb, 0x00, 0xea, 0x00, 0xf8, 0x00,
+  0x08, 0x01, 0x17, 0x01, 0x00, 0x00, 0x12, 0x00, 0x27, 0x00, 0x38, 0x00,
+  0x41, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x10, 0x00, 0x1c, 0x00, 0x26, 0x00,
+  0x30, 0x00, 0x3e, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x13, 0x00, 0x21, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1b, 0x00,
+  0x2c, 0x00, 0x3d, 0x00, 0x47, 0x00, 0x52, 0x00, 0x63, 0x00, 0x6c, 0x00,
+  0x00, 0x00, 0x17, 0x00, 0x2c, 0x00, 0x3f, 0x00, 0x5b, 0x00, 0x7d, 0x00,
+  0x90, 0x00, 0xa1, 0x00, 0xb8, 0x00, 0xc9, 0x00, 0xd4, 0x00, 0xdc, 0x00,
+  0xf1, 0x00, 0xfc, 0x00, 0x05, 0x01, 0x00, 0x00, 0x1e, 0x00, 0x34, 0x00,
+  0x46, 0x00, 0x60, 0x00, 0x7f, 0x00, 0x88, 0x00, 0x00, 0x00, 0x19, 0x00,
+  0x27, 0x00, 0x3b, 0x00, 0x57, 0x00, 0x62, 0x00, 0x6e, 0x00, 0x7a, 0x00,
+  0x84, 0x00, 0x00, 0x00, 0x16, 0x00, 0x2a, 0x00, 0x3b, 0x00, 0x4b, 0x00,
+  0x56, 0x00, 0x60, 0x00, 0x6a, 0x00, 0x78, 0x00, 0x87, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x23, 0x00, 0x30, 0x00, 0x4b, 0x00, 0x75, 0x00, 0x85, 0x00,
+  0x96, 0x00, 0xa5, 0x00, 0xad, 0x00, 0xb9, 0x00, 0xc9, 0x00, 0xd2, 0x00,
+  0xda, 0x00, 0xea, 0x00, 0xf8, 0x00, 0x05, 0x01, 0x00, 0x00, 0x14, 0x00,
+  0x24, 0x00, 0x38, 0x00, 0x51, 0x00, 0x77, 0x00, 0x83, 0x00, 0x92, 0x00,
+  0xac, 0x00, 0xc0, 0x00, 0xd3, 0x00, 0xe0, 0x00, 0xec, 0x00, 0xf9, 0x00,
+  0x02, 0x01, 0x0c, 0x01, 0x00, 0x00, 0x16, 0x00, 0x2c, 0x00, 0x41, 0x00,
+  0x5c, 0x00, 0x81, 0x00, 0x91, 0x00, 0x9f, 0x00, 0xab, 0x00, 0xb7, 0x00,
+  0xc6, 0x00, 0x00, 0x00, 0x12, 0x00, 0x25, 0x00, 0x36, 0x00, 0x47, 0x00,
+  0x69, 0x00, 0x00, 0x00, 0x13, 0x00, 0x23, 0x00, 0x35, 0x00, 0x43, 0x00,
+  0x50, 0x00, 0x59, 0x00, 0x62, 0x00, 0x72, 0x00, 0x7a, 0x00, 0x00, 0x00,
+  0x16, 0x00, 0x28, 0x00, 0x37, 0x00, 0x4c, 0x00, 0x60, 0x00, 0x76, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x1e, 0x00, 0x2d, 0x00, 0x36, 0x00, 0x3f, 0x00,
+  0x51, 0x00, 0x62, 0x00, 0x00, 0x00, 0x16, 0x00, 0x23, 0x00, 0x3a, 0x00,
+  0x45, 0x00, 0x56, 0x00, 0x62, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x22, 0x00,
+  0x40, 0x00, 0x50, 0x00, 0x00, 0x00, 0x14, 0x00, 0x27, 0x00, 0x4b, 0x00,
+  0x6b, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x16, 0x00, 0x27, 0x00, 0x38, 0x00,
+  0x47, 0x00, 0x00, 0x00, 0x14, 0x00, 0x21, 0x00, 0x44, 0x00, 0x4d, 0x00,
+  0x52, 0x00, 0x00, 0x00, 0x15, 0x00, 0x1f, 0x00, 0x35, 0x00, 0x4c, 0x00,
+  0x5a, 0x00, 0x69, 0x00, 0x72, 0x00, 0x88, 0x00, 0x00, 0x00, 0x13, 0x00,
+  0x28, 0x00, 0x42, 0x00, 0x58, 0x00, 0x6d, 0x00, 0x78, 0x00, 0x80, 0x00,
+  0x89, 0x00, 0x00, 0x00, 0x24, 0x00, 0x2f, 0x00, 0x3c, 0x00, 0x4e, 0x00,
+  0x5f, 0x00, 0x74, 0x00, 0x7e, 0x00, 0x92, 0x00, 0xa5, 0x00, 0x00, 0x00,
+  0x25, 0x00, 0x32, 0x00, 0x43, 0x00, 0x60, 0x00, 0x70, 0x00, 0x83, 0x00,
+  0x93, 0x00, 0x9e, 0x00, 0xb0, 0x00, 0x00, 0x00, 0x13, 0x00, 0x22, 0x00,
+  0x37, 0x00, 0x4d, 0x00, 0x5c, 0x00, 0x79, 0x00, 0x86, 0x00, 0x98, 0x00,
+  0xa3, 0x00, 0xad, 0x00, 0xbb, 0x00, 0xc9, 0x00, 0x00, 0x00, 0x16, 0x00,
+  0x24, 0x00, 0x33, 0x00, 0x4a, 0x00, 0x5b, 0x00, 0x72, 0x00, 0x85, 0x00,
+  0x8a, 0x00, 0x00, 0x00, 0x10, 0x00, 0x1b, 0x00, 0x29, 0x00, 0x36, 0x00,
+  0x54, 0x00, 0x68, 0x00, 0x76, 0x00, 0x84, 0x00, 0x8f, 0x00, 0x9e, 0x00,
+  0xad, 0x00, 0xbe, 0x00, 0xc7, 0x00, 0xd6, 0x00, 0xdf, 0x00, 0xef, 0x00,
+  0xfe, 0x00, 0x00, 0x00, 0x11, 0x00, 0x1e, 0x00, 0x33, 0x00, 0x43, 0x00,
+  0x61, 0x00, 0x71, 0x00, 0x81, 0x00, 0x90, 0x00, 0x00, 0x00, 0x0b, 0x00,
+  0x1d, 0x00, 0x32, 0x00, 0x3e, 0x00, 0x53, 0x00, 0x7c, 0x00, 0x8b, 0x00,
+  0x94, 0x00, 0xa5, 0x00, 0xb0, 0x00, 0xbb, 0x00, 0xd0, 0x00, 0xe0, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x1d, 0x00, 0x32, 0x00, 0x3f, 0x00, 0x5e, 0x00,
+  0x6a, 0x00, 0x7d, 0x00, 0x89, 0x00, 0x91, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x1e, 0x00, 0x2d, 0x00, 0x49, 0x00, 0x65, 0x00, 0x88, 0x00, 0x91, 0x00,
+  0xa0, 0x00, 0xb4, 0x00, 0xc1, 0x00, 0xd1, 0x00, 0xdf, 0x00, 0xef, 0x00,
+  0xfe, 0x00, 0x0d, 0x01, 0x16, 0x01, 0x1f, 0x01, 0x30, 0x01, 0x3f, 0x01,
+  0x4e, 0x01, 0x5d, 0x01, 0x6a, 0x01, 0x73, 0x01, 0x83, 0x01, 0x93, 0x01,
+  0xa3, 0x01, 0xb2, 0x01, 0xbb, 0x01, 0xc4, 0x01, 0xd4, 0x01, 0xe4, 0x01,
+  0x00, 0x00, 0x0b, 0x00, 0x1f, 0x00, 0x33, 0x00, 0x40, 0x00, 0x55, 0x00,
+  0x75, 0x00, 0x7f, 0x00, 0x89, 0x00, 0x93, 0x00, 0xa5, 0x00, 0x00, 0x00,
+  0x22, 0x00, 0x3d, 0x00, 0x53, 0x00, 0x69, 0x00, 0x7e, 0x00, 0x8e, 0x00,
+  0x9c, 0x00, 0xab, 0x00, 0xb9, 0x00, 0xc4, 0x00, 0x00, 0x00, 0x27, 0x00,
+  0x4b, 0x00, 0x68, 0x00, 0x7d, 0x00, 0x8f, 0x00, 0xa3, 0x00, 0xad, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x29, 0x00, 0x3e, 0x00, 0x52, 0x00, 0x70, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x1d, 0x00, 0x34, 0x00, 0x50, 0x00, 0x66, 0x00,
+  0x6f, 0x00, 0x7a, 0x00, 0x90, 0x00, 0xa0, 0x00, 0xaf, 0x00, 0xb5, 0x00,
+  0x00, 0x00, 0x11, 0x00, 0x1e, 0x00, 0x35, 0x00, 0x43, 0x00, 0x5c, 0x00,
+  0x72, 0x00, 0x82, 0x00, 0x00, 0x00, 0x11, 0x00, 0x26, 0x00, 0x33, 0x00,
+  0x42, 0x00, 0x50, 0x00, 0x64, 0x00, 0x7e, 0x00, 0x94, 0x00, 0xa2, 0x00,
+  0x00, 0x00, 0x1d, 0x00, 0x37, 0x00, 0x52, 0x00, 0x6b, 0x00, 0x89, 0x00,
+  0xa0, 0x00, 0xc0, 0x00, 0xd8, 0x00, 0xe5, 0x00, 0xf3, 0x00, 0xff, 0x00,
+  0x0c, 0x01, 0x22, 0x01, 0x38, 0x01, 0x48, 0x01, 0x00, 0x00, 0x18, 0x00,
+  0x33, 0x00, 0x41, 0x00, 0x4c, 0x00, 0x5e, 0x00, 0x72, 0x00, 0x88, 0x00,
+  0x98, 0x00, 0xaa, 0x00, 0xb5, 0x00, 0xbf, 0x00, 0xcf, 0x00, 0xdb, 0x00,
+  0xe2, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x3b, 0x00, 0x58, 0x00, 0x73, 0x00,
+  0x93, 0x00, 0xac, 0x00, 0xce, 0x00, 0xdf, 0x00, 0xfd, 0x00, 0x0f, 0x01,
+  0x1a, 0x01, 0x33, 0x01, 0x41, 0x01, 0x61, 0x01, 0x73, 0x01, 0x82, 0x01,
+  0x8f, 0x01, 0x9c, 0x01, 0xaa, 0x01, 0xb3, 0x01, 0xc4, 0x01, 0xcc, 0x01,
+  0xd9, 0x01, 0xe1, 0x01, 0xea, 0x01, 0xf8, 0x01, 0x03, 0x02, 0x12, 0x02,
+  0x20, 0x02, 0x2e, 0x02, 0x00, 0x00, 0x24, 0x00, 0x3a, 0x00, 0x58, 0x00,
+  0x6c, 0x00, 0x78, 0x00, 0x8f, 0x00, 0xa0, 0x00, 0xaf, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x1f, 0x00, 0x2e, 0x00, 0x3d, 0x00, 0x55, 0x00, 0x67, 0x00,
+  0x7a, 0x00, 0x8b, 0x00, 0xa1, 0x00, 0xb0, 0x00, 0xbe, 0x00, 0xca, 0x00,
+  0xdb, 0x00, 0xe8, 0x00, 0xf4, 0x00, 0x00, 0x01, 0x0f, 0x01, 0x00, 0x00,
+  0x26, 0x00, 0x3b, 0x00, 0x4e, 0x00, 0x60, 0x00, 0x6b, 0x00, 0x7a, 0x00,
+  0x8e, 0x00, 0xaf, 0x00, 0xbd, 0x00, 0xc6, 0x00, 0x00, 0x00, 0x18, 0x00,
+  0x2b, 0x00, 0x3c, 0x00, 0x53, 0x00, 0x67, 0x00, 0x7a, 0x00, 0x89, 0x00,
+  0x8f, 0x00, 0x98, 0x00, 0xa6, 0x00, 0xb4, 0x00, 0xc3, 0x00, 0xd1, 0x00,
+  0xd9, 0x00, 0xe7, 0x00, 0xf4, 0x00, 0x02, 0x01, 0x11, 0x01, 0x21, 0x01,
+  0x30, 0x01, 0x3a, 0x01, 0x43, 0x01, 0x51, 0x01, 0x5f, 0x01, 0x6d, 0x01,
+  0x7b, 0x01, 0x88, 0x01, 0x96, 0x01, 0x9f, 0x01, 0xa8, 0x01, 0xb6, 0x01,
+  0xc3, 0x01, 0xd7, 0x01, 0x00, 0x00, 0x16, 0x00, 0x25, 0x00, 0x32, 0x00,
+  0x4e, 0x00, 0x63, 0x00, 0x72, 0x00, 0x7d, 0x00, 0x87, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x1d, 0x00, 0x28, 0x00, 0x36, 0x00, 0x47, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x20, 0x00, 0x2e, 0x00, 0x47, 0x00, 0x60, 0x00, 0x71, 0x00,
+  0x8d, 0x00, 0x00, 0x00, 0x19, 0x00, 0x26, 0x00, 0x33, 0x00, 0x3f, 0x00,
+  0x52, 0x00, 0x5e, 0x00, 0x6a, 0x00, 0x7b, 0x00, 0x8e, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x1f, 0x00, 0x2a, 0x00, 0x3c, 0x00, 0x55, 0x00, 0x67, 0x00,
+  0x76, 0x00, 0x87, 0x00, 0x00, 0x00, 0x16, 0x00, 0x25, 0x00, 0x32, 0x00,
+  0x45, 0x00, 0x5b, 0x00, 0x6c, 0x00, 0x79, 0x00, 0x82, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x1f, 0x00, 0x2c, 0x00, 0x3c, 0x00, 0x59, 0x00, 0x68, 0x00,
+  0x71, 0x00, 0x81, 0x00, 0x92, 0x00, 0xa2, 0x00, 0xb2, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x28, 0x00, 0x35, 0x00, 0x44, 0x00, 0x52, 0x00, 0x60, 0x00,
+  0x6f, 0x00, 0x7f, 0x00, 0x93, 0x00, 0x9f, 0x00, 0xb3, 0x00, 0xbd, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x2e, 0x00, 0x40, 0x00, 0x55, 0x00, 0x78, 0x00,
+  0x8e, 0x00, 0xa5, 0x00, 0xb4, 0x00, 0xc1, 0x00, 0xcd, 0x00, 0x00, 0x00,
+  0x1d, 0x00, 0x2e, 0x00, 0x3d, 0x00, 0x48, 0x00, 0x5d, 0x00, 0x6e, 0x00,
+  0x82, 0x00, 0x8b, 0x00, 0xa2, 0x00, 0xb2, 0x00, 0xbc, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x1f, 0x00, 0x32, 0x00, 0x4b, 0x00, 0x58, 0x00, 0x68, 0x00,
+  0x7d, 0x00, 0x90, 0x00, 0x9b, 0x00, 0xa5, 0x00, 0x00, 0x00, 0x0f, 0x00,
+  0x24, 0x00, 0x3e, 0x00, 0x55, 0x00, 0x6b, 0x00, 0x77, 0x00, 0x94, 0x00,
+  0xa9, 0x00, 0xb0, 0x00, 0xbf, 0x00, 0xca, 0x00, 0xd4, 0x00, 0xe5, 0x00,
+  0xf6, 0x00, 0x01, 0x01, 0x0d, 0x01, 0x17, 0x01, 0x1d, 0x01, 0x27, 0x01,
+  0x31, 0x01, 0x00, 0x00, 0x15, 0x00, 0x22, 0x00, 0x37, 0x00, 0x55, 0x00,
+  0x64, 0x00, 0x7a, 0x00, 0x8b, 0x00, 0x98, 0x00, 0xa4, 0x00, 0xb1, 0x00,
+  0xb9, 0x00, 0xc8, 0x00, 0xd7, 0x00, 0xe5, 0x00, 0xf1, 0x00, 0xfd, 0x00,
+  0x05, 0x01, 0x0d, 0x01, 0x14, 0x01, 0x21, 0x01, 0x2e, 0x01, 0x3a, 0x01,
+  0x42, 0x01, 0x4d, 0x01, 0x57, 0x01, 0x00, 0x00, 0x0e, 0x00, 0x34, 0x00,
+  0x42, 0x00, 0x56, 0x00, 0x73, 0x00, 0x85, 0x00, 0xa3, 0x00, 0xbf, 0x00,
+  0xc8, 0x00, 0xd2, 0x00, 0xde, 0x00, 0xef, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x11, 0x00, 0x23, 0x00, 0x2f, 0x00, 0x41, 0x00, 0x60, 0x00, 0x7f, 0x00,
+  0x97, 0x00, 0xab, 0x00, 0xba, 0x00, 0xcb, 0x00, 0xd5, 0x00, 0xde, 0x00,
+  0xe9, 0x00, 0xf6, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1a, 0x00, 0x2e, 0x00,
+  0x42, 0x00, 0x55, 0x00, 0x65, 0x00, 0x72, 0x00, 0x7e, 0x00, 0x8b, 0x00,
+  0x97, 0x00, 0xa0, 0x00, 0xae, 0x00, 0xb9, 0x00, 0xc6, 0x00, 0xd0, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x21, 0x00, 0x33, 0x00, 0x3e, 0x00, 0x50, 0x00,
+  0x5e, 0x00, 0x6f, 0x00, 0x77, 0x00, 0x86, 0x00, 0x92, 0x00, 0xa0, 0x00,
+  0xa8, 0x00, 0xb7, 0x00, 0xc5, 0x00, 0xd3, 0x00, 0xe1, 0x00, 0xf0, 0x00,
+  0xfb, 0x00, 0x09, 0x01, 0x16, 0x01, 0x24, 0x01, 0x2c, 0x01, 0x34, 0x01,
+  0x41, 0x01, 0x4f, 0x01, 0x5c, 0x01, 0x64, 0x01, 0x72, 0x01, 0x00, 0x00,
+  0x18, 0x00, 0x2b, 0x00, 0x43, 0x00, 0x53, 0x00, 0x61, 0x00, 0x77, 0x00,
+  0x8d, 0x00, 0x95, 0x00, 0x9e, 0x00, 0xb5, 0x00, 0xcc, 0x00, 0xd8, 0x00,
+  0xed, 0x00, 0xf7, 0x00, 0x00, 0x00, 0x15, 0x00, 0x24, 0x00, 0x3a, 0x00,
+  0x49, 0x00, 0x58, 0x00, 0x64, 0x00, 0x7b, 0x00, 0x00, 0x00, 0x11, 0x00,
+  0x22, 0x00, 0x2d, 0x00, 0x40, 0x00, 0x52, 0x00, 0x67, 0x00, 0x76, 0x00,
+  0x85, 0x00, 0x94, 0x00, 0x9e, 0x00, 0xac, 0x00, 0xbb, 0x00, 0xc5, 0x00,
+  0xcf, 0x00, 0xe1, 0x00, 0xeb, 0x00, 0xf7, 0x00, 0x04, 0x01, 0x00, 0x00,
+  0x12, 0x00, 0x1e, 0x00, 0x2a, 0x00, 0x36, 0x00, 0x43, 0x00, 0x55, 0x00,
+  0x61, 0x00, 0x6a, 0x00, 0x78, 0x00, 0x85, 0x00, 0x91, 0x00, 0x9f, 0x00,
+  0xac, 0x00, 0x00, 0x00, 0x26, 0x00, 0x39, 0x00, 0x53, 0x00, 0x5e, 0x00,
+  0x70, 0x00, 0x85, 0x00, 0x94, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x1d, 0x00,
+  0x30, 0x00, 0x3c, 0x00, 0x57, 0x00, 0x67, 0x00, 0x76, 0x00, 0x8d, 0x00,
+  0xa0, 0x00, 0xab, 0x00, 0xb7, 0x00, 0xc4, 0x00, 0xd6, 0x00, 0xeb, 0x00,
+  0x00, 0x00, 0x1e, 0x00, 0x34, 0x00, 0x42, 0x00, 0x6a, 0x00, 0x7e, 0x00,
+  0x8c, 0x00, 0x9f, 0x00, 0xb6, 0x00, 0xcc, 0x00, 0xd3, 0x00, 0xe7, 0x00,
+  0xf2, 0x00, 0xfd, 0x00, 0x03, 0x01, 0x00, 0x00, 0x16, 0x00, 0x26, 0x00,
+  0x4d, 0x00, 0x59, 0x00, 0x66, 0x00, 0x7c, 0x00, 0x8d, 0x00, 0x99, 0x00,
+  0xab, 0x00, 0xbc, 0x00, 0xc6, 0x00, 0xd1, 0x00, 0x00, 0x00, 0x1b, 0x00,
+  0x33, 0x00, 0x51, 0x00, 0x6b, 0x00, 0x8b, 0x00, 0xad, 0x00, 0xce, 0x00,
+  0xef, 0x00, 0x0a, 0x01, 0x28, 0x01, 0x3c, 0x01, 0x53, 0x01, 0x6c, 0x01,
+  0x86, 0x01, 0x96, 0x01, 0xa9, 0x01, 0xb7, 0x01, 0xc6, 0x01, 0xd7, 0x01,
+  0xe5, 0x01, 0x00, 0x00, 0x13, 0x00, 0x1e, 0x00, 0x39, 0x00, 0x4b, 0x00,
+  0x57, 0x00, 0x67, 0x00, 0x72, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x37, 0x00,
+  0x57, 0x00, 0x73, 0x00, 0x95, 0x00, 0xb9, 0x00, 0xdc, 0x00, 0xff, 0x00,
+  0x1c, 0x01, 0x3c, 0x01, 0x50, 0x01, 0x60, 0x01, 0x6f, 0x01, 0x85, 0x01,
+  0x9a, 0x01, 0xaa, 0x01, 0xb7, 0x01, 0xc1, 0x01, 0xcb, 0x01, 0xd5, 0x01,
+  0xe3, 0x01, 0x00, 0x00, 0x19, 0x00, 0x2c, 0x00, 0x38, 0x00, 0x4b, 0x00,
+  0x5a, 0x00, 0x77, 0x00, 0x87, 0x00, 0x90, 0x00, 0x99, 0x00, 0xae, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x1e, 0x00, 0x43, 0x00, 0x4e, 0x00, 0x60, 0x00,
+  0x72, 0x00, 0x7e, 0x00, 0x8b, 0x00, 0x95, 0x00, 0x9e, 0x00, 0xad, 0x00,
+  0xbc, 0x00, 0xc9, 0x00, 0xd7, 0x00, 0x00, 0x00, 0x12, 0x00, 0x29, 0x00,
+  0x4f, 0x00, 0x60, 0x00, 0x6d, 0x00, 0x80, 0x00, 0x00, 0x00, 0x1b, 0x00,
+  0x30, 0x00, 0x4b, 0x00, 0x5e, 0x00, 0x71, 0x00, 0x8d, 0x00, 0x9a, 0x00,
+  0xa9, 0x00, 0xb6, 0x00, 0xc2, 0x00, 0xd0, 0x00, 0xe9, 0x00, 0xf1, 0x00,
+  0x02, 0x01, 0x15, 0x01, 0x23, 0x01, 0x2b, 0x01, 0x00, 0x00, 0x15, 0x00,
+  0x29, 0x00, 0x38, 0x00, 0x49, 0x00, 0x5d, 0x00, 0x7a, 0x00, 0x90, 0x00,
+  0x9e, 0x00, 0xa8, 0x00, 0x00, 0x00, 0x13, 0x00, 0x2d, 0x00, 0x40, 0x00,
+  0x58, 0x00, 0x6f, 0x00, 0x7c, 0x00, 0x8a, 0x00, 0x9d, 0x00, 0xa9, 0x00,
+  0xb7, 0x00, 0xca, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x13, 0x00, 0x30, 0x00,
+  0x49, 0x00, 0x5b, 0x00, 0x76, 0x00, 0x84, 0x00, 0x9c, 0x00, 0xab, 0x00,
+  0x00, 0x00, 0x15, 0x00, 0x3a, 0x00, 0x49, 0x00, 0x61, 0x00, 0x6d, 0x00,
+  0x7d, 0x00, 0x8b, 0x00, 0x95, 0x00, 0x9e, 0x00, 0xa8, 0x00, 0xb8, 0x00,
+  0xc8, 0x00, 0x00, 0x00, 0x15, 0x00, 0x2c, 0x00, 0x3a, 0x00, 0x52, 0x00,
+  0x6d, 0x00, 0x7f, 0x00, 0x8b, 0x00, 0x94, 0x00, 0xa0, 0x00, 0xae, 0x00,
+  0xb7, 0x00, 0xbf, 0x00, 0xc6, 0x00, 0xd3, 0x00, 0xe1, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x28, 0x00, 0x3d, 0x00, 0x50, 0x00, 0x64, 0x00, 0x73, 0x00,
+  0x82, 0x00, 0x97, 0x00, 0xa6, 0x00, 0xb5, 0x00, 0xc6, 0x00, 0xd6, 0x00,
+  0x00, 0x00, 0x13, 0x00, 0x37, 0x00, 0x49, 0x00, 0x62, 0x00, 0x73, 0x00,
+  0x85, 0x00, 0x9a, 0x00, 0xa5, 0x00, 0xb0, 0x00, 0xc2, 0x00, 0xd7, 0x00,
+  0xeb, 0x00, 0xf6, 0x00, 0x01, 0x01, 0x15, 0x01, 0x1c, 0x01, 0x23, 0x01,
+  0x00, 0x00, 0x1b, 0x00, 0x3e, 0x00, 0x53, 0x00, 0x60, 0x00, 0x73, 0x00,
+  0x81, 0x00, 0x94, 0x00, 0x9e, 0x00, 0xaf, 0x00, 0xbb, 0x00, 0xc2, 0x00,
+  0x00, 0x00, 0x1c, 0x00, 0x3a, 0x00, 0x4f, 0x00, 0x61, 0x00, 0x7a, 0x00,
+  0x90, 0x00, 0x99, 0x00, 0x9e, 0x00, 0xa4, 0x00, 0xab, 0x00, 0x00, 0x00,
+  0x1b, 0x00, 0x41, 0x00, 0x5e, 0x00, 0x72, 0x00, 0x8b, 0x00, 0x99, 0x00,
+  0xa4, 0x00, 0xac, 0x00, 0xb2, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x2f, 0x00,
+  0x50, 0x00, 0x6d, 0x00, 0x86, 0x00, 0x97, 0x00, 0xa4, 0x00, 0xb0, 0x00,
+  0xc0, 0x00, 0xcb, 0x00, 0xd2, 0x00, 0xde, 0x00, 0x00, 0x00, 0x14, 0x00,
+  0x32, 0x00, 0x40, 0x00, 0x4e, 0x00, 0x62, 0x00, 0x78, 0x00, 0x87, 0x00,
+  0x95, 0x00, 0xa2, 0x00, 0xaf, 0x00, 0xbc, 0x00, 0xc9, 0x00, 0xd6, 0x00,
+  0xe2, 0x00, 0xef, 0x00, 0xfe, 0x00, 0x0b, 0x01, 0x18, 0x01, 0x25, 0x01,
+  0x33, 0x01, 0x41, 0x01, 0x4f, 0x01, 0x5d, 0x01, 0x6a, 0x01, 0x77, 0x01,
+  0x7e, 0x01, 0x00, 0x00, 0x16, 0x00, 0x35, 0x00, 0x50, 0x00, 0x65, 0x00,
+  0x77, 0x00, 0x8c, 0x00, 0x99, 0x00, 0xa8, 0x00, 0xba, 0x00, 0xc9, 0x00,
+  0xcf, 0x00, 0xde, 0x00, 0xe5, 0x00, 0xed, 0x00, 0x00, 0x00, 0x17, 0x00,
+  0x37, 0x00, 0x46, 0x00, 0x5b, 0x00, 0x67, 0x00, 0x7d, 0x00, 0x94, 0x00,
+  0xa5, 0x00, 0xb2, 0x00, 0xb8, 0x00, 0xc9, 0x00, 0xd2, 0x00, 0xdb, 0x00,
+  0x00, 0x00, 0x1b, 0x00, 0x30, 0x00, 0x57, 0x00, 0x64, 0x00, 0x7f, 0x00,
+  0x94, 0x00, 0xa8, 0x00, 0xb4, 0x00, 0xc1, 0x00, 0xcd, 0x00, 0xd8, 0x00,
+  0xe2, 0x00, 0xea, 0x00, 0x00, 0x00, 0x18, 0x00, 0x2f, 0x00, 0x43, 0x00,
+  0x57, 0x00, 0x78, 0x00, 0x8e, 0x00, 0x9b, 0x00, 0xac, 0x00, 0xc5, 0x00,
+  0xe0, 0x00, 0xf5, 0x00, 0x09, 0x01, 0x17, 0x01, 0x24, 0x01, 0x32, 0x01,
+  0x3e, 0x01, 0x4c, 0x01, 0x5b, 0x01, 0x68, 0x01, 0x70, 0x01, 0x7e, 0x01,
+  0x86, 0x01, 0x8e, 0x01, 0x9a, 0x01, 0xa7, 0x01, 0xb4, 0x01, 0xc1, 0x01,
+  0xcf, 0x01, 0xdb, 0x01, 0xe8, 0x01, 0xf6, 0x01, 0x04, 0x02, 0x12, 0x02,
+  0x21, 0x02, 0x2c, 0x02, 0x3b, 0x02, 0x46, 0x02, 0x50, 0x02, 0x00, 0x00,
+  0x1d, 0x00, 0x33, 0x00, 0x3e, 0x00, 0x52, 0x00, 0x63, 0x00, 0x82, 0x00,
+  0x97, 0x00, 0xa8, 0x00, 0xb1, 0x00, 0xc9, 0x00, 0xce, 0x00, 0xdb, 0x00,
+  0xe4, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x31, 0x00, 0x43, 0x00, 0x55, 0x00,
+  0x69, 0x00, 0x7c, 0x00, 0x90, 0x00, 0x9e, 0x00, 0xaf, 0x00, 0xb9, 0x00,
+  0xc2, 0x00, 0xc8, 0x00, 0xd1, 0x00, 0x00, 0x00, 0x16, 0x00, 0x29, 0x00,
+  0x3d, 0x00, 0x4e, 0x00, 0x62, 0x00, 0x73, 0x00, 0x7a, 0x00, 0x86, 0x00,
+  0x91, 0x00, 0x9a, 0x00, 0x00, 0x00, 0x15, 0x00, 0x2a, 0x00, 0x3b, 0x00,
+  0x49, 0x00, 0x5f, 0x00, 0x6f, 0x00, 0x7c, 0x00, 0x8a, 0x00, 0x93, 0x00,
+  0xa0, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x30, 0x00, 0x4d, 0x00,
+  0x61, 0x00, 0x75, 0x00, 0x87, 0x00, 0x8d, 0x00, 0x97, 0x00, 0xa8, 0x00,
+  0xae, 0x00, 0xbd, 0x00, 0xc7, 0x00, 0xcf, 0x00, 0x00, 0x00, 0x1b, 0x00,
+  0x29, 0x00, 0x3b, 0x00, 0x4c, 0x00, 0x64, 0x00, 0x7b, 0x00, 0x8b, 0x00,
+  0x9c, 0x00, 0xa5, 0x00, 0xad, 0x00, 0xb7, 0x00, 0xc0, 0x00, 0xd5, 0x00,
+  0xdd, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x30, 0x00, 0x43, 0x00, 0x55, 0x00,
+  0x6d, 0x00, 0x83, 0x00, 0x95, 0x00, 0xb0, 0x00, 0xbc, 0x00, 0x00, 0x00,
+  0x16, 0x00, 0x29, 0x00, 0x49, 0x00, 0x64, 0x00, 0x6f, 0x00, 0x8b, 0x00,
+  0xa6, 0x00, 0xbd, 0x00, 0xd3, 0x00, 0xe3, 0x00, 0xed, 0x00, 0xf8, 0x00,
+  0x09, 0x01, 0x1b, 0x01, 0x23, 0x01, 0x00, 0x00, 0x12, 0x00, 0x27, 0x00,
+  0x3a, 0x00, 0x55, 0x00, 0x60, 0x00, 0x76, 0x00, 0x86, 0x00, 0x9c, 0x00,
+  0xa5, 0x00, 0x00, 0x00, 0x12, 0x00, 0x2d, 0x00, 0x3d, 0x00, 0x53, 0x00,
+  0x5e, 0x00, 0x6a, 0x00, 0x74, 0x00, 0x7d, 0x00, 0x87, 0x00, 0x92, 0x00,
+  0x98, 0x00, 0xa7, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x22, 0x00, 0x3c, 0x00,
+  0x4e, 0x00, 0x72, 0x00, 0x7d, 0x00, 0x87, 0x00, 0x00, 0x00, 0x0b, 0x00,
+  0x18, 0x00, 0x2c, 0x00, 0x46, 0x00, 0x60, 0x00, 0x6a, 0x00, 0x74, 0x00,
+  0x00, 0x00, 0x14, 0x00, 0x21, 0x00, 0x38, 0x00, 0x54, 0x00, 0x5f, 0x00,
+  0x6f, 0x00, 0x7f, 0x00, 0x8b, 0x00, 0x95, 0x00, 0x00, 0x00, 0x15, 0x00,
+  0x29, 0x00, 0x3e, 0x00, 0x56, 0x00, 0x69, 0x00, 0x74, 0x00, 0x82, 0x00,
+  0x8c, 0x00, 0x98, 0x00, 0xa3, 0x00, 0xad, 0x00, 0xb8, 0x00, 0x00, 0x00,
+  0x15, 0x00, 0x2d, 0x00, 0x41, 0x00, 0x54, 0x00, 0x66, 0x00, 0x71, 0x00,
+  0x83, 0x00, 0x92, 0x00, 0x9c, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x29, 0x00,
+  0x3e, 0x00, 0x4a, 0x00, 0x58, 0x00, 0x6f, 0x00, 0x79, 0x00, 0x89, 0x00,
+  0x99, 0x00, 0xa2, 0x00, 0xaf, 0x00, 0x00, 0x00, 0x18, 0x00, 0x3e, 0x00,
+  0x53, 0x00, 0x5f, 0x00, 0x69, 0x00, 0x7d, 0x00, 0x92, 0x00, 0xa6, 0x00,
+  0xb0, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x23, 0x00, 0x31, 0x00, 0x45, 0x00,
+  0x66, 0x00, 0x71, 0x00, 0x81, 0x00, 0x8a, 0x00, 0x98, 0x00, 0xa5, 0x00,
+  0xae, 0x00, 0xb8, 0x00, 0xc1, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x39, 0x00,
+  0x52, 0x00, 0x60, 0x00, 0x78, 0x00, 0x83, 0x00, 0x8c, 0x00, 0x95, 0x00,
+  0x00, 0x00, 0x15, 0x00, 0x23, 0x00, 0x42, 0x00, 0x56, 0x00, 0x60, 0x00,
+  0x6d, 0x00, 0x74, 0x00, 0x81, 0x00, 0x00, 0x00, 0x24, 0x00, 0x36, 0x00,
+  0x4a, 0x00, 0x5d, 0x00, 0x67, 0x00, 0x7a, 0x00, 0x89, 0x00, 0x99, 0x00,
+  0xa9, 0x00, 0xb7, 0x00, 0xc6, 0x00, 0xd7, 0x00, 0xe6, 0x00, 0xf7, 0x00,
+  0x04, 0x01, 0x00, 0x00, 0x14, 0x00, 0x38, 0x00, 0x49, 0x00, 0x5a, 0x00,
+  0x6f, 0x00, 0x79, 0x00, 0x89, 0x00, 0x9a, 0x00, 0xa3, 0x00, 0xb6, 0x00,
+  0xc2, 0x00, 0x00, 0x00, 0x15, 0x00, 0x2a, 0x00, 0x48, 0x00, 0x5a, 0x00,
+  0x6b, 0x00, 0x76, 0x00, 0x7f, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x12, 0x00,
+  0x2a, 0x00, 0x3c, 0x00, 0x47, 0x00, 0x5d, 0x00, 0x71, 0x00, 0x85, 0x00,
+  0x00, 0x00, 0x13, 0x00, 0x26, 0x00, 0x37, 0x00, 0x48, 0x00, 0x52, 0x00,
+  0x5c, 0x00, 0x6c, 0x00, 0x75, 0x00, 0x8c, 0x00, 0x95, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x31, 0x00, 0x45, 0x00, 0x5b, 0x00, 0x62, 0x00, 0x6d, 0x00,
+  0x7e, 0x00, 0x92, 0x00, 0x9b, 0x00, 0xa6, 0x00, 0xac, 0x00, 0xc0, 0x00,
+  0x00, 0x00, 0x1f, 0x00, 0x2e, 0x00, 0x40, 0x00, 0x4a, 0x00, 0x55, 0x00,
+  0x62, 0x00, 0x71, 0x00, 0x7c, 0x00, 0x93, 0x00, 0x00, 0x00, 0x12, 0x00,
+  0x28, 0x00, 0x34, 0x00, 0x41, 0x00, 0x4d, 0x00, 0x58, 0x00, 0x6f, 0x00,
+  0x7b, 0x00, 0x8f, 0x00, 0x98, 0x00, 0xa1, 0x00, 0x00, 0x00, 0x15, 0x00,
+  0x3a, 0x00, 0x4e, 0x00, 0x58, 0x00, 0x61, 0x00, 0x6a, 0x00, 0x70, 0x00,
+  0x7c, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x38, 0x00, 0x55, 0x00, 0x6e, 0x00,
+  0x79, 0x00, 0x8c, 0x00, 0x96, 0x00, 0xa0, 0x00, 0xa9, 0x00, 0xba, 0x00,
+  0xca, 0x00, 0xda, 0x00, 0xeb, 0x00, 0xf3, 0x00, 0xfc, 0x00, 0x0d, 0x01,
+  0x1c, 0x01, 0x25, 0x01, 0x31, 0x01, 0x00, 0x00, 0x2a, 0x00, 0x45, 0x00,
+  0x66, 0x00, 0x79, 0x00, 0x84, 0x00, 0x94, 0x00, 0xab, 0x00, 0xb8, 0x00,
+  0xc0, 0x00, 0x00, 0x00, 0x10, 0x00, 0x28, 0x00, 0x46, 0x00, 0x67, 0x00,
+  0x71, 0x00, 0x7d, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x15, 0x00, 0x21, 0x00,
+  0x46, 0x00, 0x65, 0x00, 0x70, 0x00, 0x85, 0x00, 0x97, 0x00, 0xa7, 0x00,
+  0xb2, 0x00, 0xbe, 0x00, 0x00, 0x00, 0x11, 0x00, 0x20, 0x00, 0x46, 0x00,
+  0x60, 0x00, 0x6a, 0x00, 0x72, 0x00, 0x88, 0x00, 0xa0, 0x00, 0xb6, 0x00,
+  0xbf, 0x00, 0xcb, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x32, 0x00, 0x44, 0x00,
+  0x5f, 0x00, 0x6e, 0x00, 0x8a, 0x00, 0x94, 0x00, 0xa3, 0x00, 0xb4, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x24, 0x00, 0x2e, 0x00, 0x41, 0x00, 0x4b, 0x00,
+  0x5b, 0x00, 0x6a, 0x00, 0x77, 0x00, 0x7d, 0x00, 0x86, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x2b, 0x00, 0x35, 0x00, 0x46, 0x00, 0x57, 0x00, 0x66, 0x00,
+  0x76, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x14, 0x00, 0x36, 0x00, 0x4e, 0x00,
+  0x58, 0x00, 0x69, 0x00, 0x72, 0x00, 0x7b, 0x00, 0x85, 0x00, 0x8e, 0x00,
+  0x96, 0x00, 0xa0, 0x00, 0xb2, 0x00, 0xc3, 0x00, 0xcb, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x2b, 0x00, 0x41, 0x00, 0x4c, 0x00, 0x5b, 0x00, 0x67, 0x00,
+  0x74, 0x00, 0x85, 0x00, 0x8d, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x34, 0x00,
+  0x48, 0x00, 0x54, 0x00, 0x61, 0x00, 0x70, 0x00, 0x7b, 0x00, 0x87, 0x00,
+  0x90, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x23, 0x00, 0x36, 0x00, 0x49, 0x00,
+  0x53, 0x00, 0x5f, 0x00, 0x67, 0x00, 0x74, 0x00, 0x82, 0x00, 0x8f, 0x00,
+  0x9c, 0x00, 0xa5, 0x00, 0xb5, 0x00, 0xc4, 0x00, 0xd6, 0x00, 0xe8, 0x00,
+  0xed, 0x00, 0xf5, 0x00, 0x00, 0x00, 0x16, 0x00, 0x2c, 0x00, 0x4a, 0x00,
+  0x55, 0x00, 0x5d, 0x00, 0x6d, 0x00, 0x7a, 0x00, 0x85, 0x00, 0x8e, 0x00,
+  0x96, 0x00, 0x00, 0x00, 0x19, 0x00, 0x38, 0x00, 0x43, 0x00, 0x4d, 0x00,
+  0x56, 0x00, 0x60, 0x00, 0x69, 0x00, 0x71, 0x00, 0x00, 0x00, 0x14, 0x00,
+  0x32, 0x00, 0x3d, 0x00, 0x49, 0x00, 0x60, 0x00, 0x68, 0x00, 0x00, 0x00,
+  0x1e, 0x00, 0x38, 0x00, 0x44, 0x00, 0x54, 0x00, 0x65, 0x00, 0x71, 0x00,
+  0x78, 0x00, 0x00, 0x00, 0x20, 0x00, 0x32, 0x00, 0x3b, 0x00, 0x4a, 0x00,
+  0x57, 0x00, 0x64, 0x00, 0x72, 0x00, 0x87, 0x00, 0x94, 0x00, 0xa1, 0x00,
+  0xaa, 0x00, 0xb8, 0x00, 0xbe, 0x00, 0x00, 0x00, 0x18, 0x00, 0x29, 0x00,
+  0x3e, 0x00, 0x49, 0x00, 0x5f, 0x00, 0x71, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x29, 0x00, 0x3b, 0x00, 0x45, 0x00, 0x50, 0x00, 0x5b, 0x00, 0x66, 0x00,
+  0x73, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x10, 0x00, 0x26, 0x00, 0x39, 0x00,
+  0x44, 0x00, 0x55, 0x00, 0x66, 0x00, 0x6f, 0x00, 0x78, 0x00, 0x89, 0x00,
+  0x97, 0x00, 0xa1, 0x00, 0xa8, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x2b, 0x00,
+  0x3d, 0x00, 0x47, 0x00, 0x55, 0x00, 0x5f, 0x00, 0x6b, 0x00, 0x00, 0x00,
+  0x16, 0x00, 0x2d, 0x00, 0x44, 0x00, 0x5b, 0x00, 0x70, 0x00, 0x85, 0x00,
+  0x9b, 0x00, 0xb1, 0x00, 0xc7, 0x00, 0xe0, 0x00, 0xfb, 0x00, 0x0f, 0x01,
+  0x19, 0x01, 0x24, 0x01, 0x2d, 0x01, 0x3c, 0x01, 0x45, 0x01, 0x53, 0x01,
+  0x5f, 0x01, 0x66, 0x01, 0x00, 0x00, 0x1a, 0x00, 0x2d, 0x00, 0x37, 0x00,
+  0x48, 0x00, 0x59, 0x00, 0x68, 0x00, 0x77, 0x00, 0x88, 0x00, 0x97, 0x00,
+  0xa1, 0x00, 0xad, 0x00, 0xb9, 0x00, 0x00, 0x00, 0x18, 0x00, 0x34, 0x00,
+  0x3e, 0x00, 0x4d, 0x00, 0x58, 0x00, 0x68, 0x00, 0x77, 0x00, 0x7e, 0x00,
+  0x89, 0x00, 0x00, 0x00, 0x12, 0x00, 0x22, 0x00, 0x3c, 0x00, 0x45, 0x00,
+  0x4f, 0x00, 0x60, 0x00, 0x6f, 0x00, 0x7b, 0x00, 0x82, 0x00, 0x89, 0x00,
+  0x00, 0x00, 0x15, 0x00, 0x24, 0x00, 0x3a, 0x00, 0x50, 0x00, 0x59, 0x00,
+  0x00, 0x00, 0x13, 0x00, 0x1e, 0x00, 0x2e, 0x00, 0x39, 0x00, 0x44, 0x00,
+  0x4f, 0x00, 0x64, 0x00, 0x77, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x17, 0x00,
+  0x20, 0x00, 0x30, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x2e, 0x00, 0x47, 0x00,
+  0x51, 0x00, 0x61, 0x00, 0x6b, 0x00, 0x00, 0x00, 0x15, 0x00, 0x2a, 0x00,
+  0x35, 0x00, 0x47, 0x00, 0x52, 0x00, 0x62, 0x00, 0x00, 0x00, 0x16, 0x00,
+  0x20, 0x00, 0x37, 0x00, 0x00, 0x00, 0x16, 0x00, 0x22, 0x00, 0x2d, 0x00,
+  0x00, 0x00, 0x1e, 0x00, 0x2c, 0x00, 0x39, 0x00, 0x3f, 0x00, 0x4a, 0x00,
+  0x00, 0x00, 0x15, 0x00, 0x21, 0x00, 0x00, 0x00, 0x16, 0x00, 0x28, 0x00,
+  0x50, 0x00, 0x5d, 0x00, 0x6a, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x25, 0x00,
+  0x39, 0x00, 0x4e, 0x00, 0x62, 0x00, 0x00, 0x00, 0x17, 0x00, 0x39, 0x00,
+  0x4a, 0x00, 0x57, 0x00, 0x61, 0x00, 0x6a, 0x00, 0x75, 0x00, 0x80, 0x00,
+  0x8f, 0x00, 0x00, 0x00, 0x11, 0x00, 0x29, 0x00, 0x54, 0x00, 0x64, 0x00,
+  0x6d, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x20, 0x00, 0x37, 0x00,
+  0x43, 0x00, 0x55, 0x00, 0x61, 0x00, 0x6c, 0x00, 0x79, 0x00, 0x84, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x27, 0x00, 0x3f, 0x00, 0x4e, 0x00, 0x57, 0x00,
+  0x62, 0x00, 0x68, 0x00, 0x73, 0x00, 0x82, 0x00, 0x00, 0x00, 0x15, 0x00,
+  0x27, 0x00, 0x3f, 0x00, 0x4a, 0x00, 0x55, 0x00, 0x5f, 0x00, 0x69, 0x00,
+  0x71, 0x00, 0x7a, 0x00, 0x89, 0x00, 0x00, 0x00, 0x14, 0x00, 0x25, 0x00,
+  0x44, 0x00, 0x50, 0x00, 0x60, 0x00, 0x6a, 0x00, 0x73, 0x00, 0x7c, 0x00,
+  0x85, 0x00, 0x8f, 0x00, 0x00, 0x00, 0x10, 0x00, 0x1f, 0x00, 0x2c, 0x00,
+  0x38, 0x00, 0x40, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x13, 0x00, 0x27, 0x00,
+  0x39, 0x00, 0x42, 0x00, 0x51, 0x00, 0x60, 0x00, 0x74, 0x00, 0x7a, 0x00,
+  0x7f, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1c, 0x00, 0x2d, 0x00,
+  0x3b, 0x00, 0x49, 0x00, 0x58, 0x00, 0x64, 0x00, 0x6d, 0x00, 0x79, 0x00,
+  0x00, 0x00, 0x13, 0x00, 0x1c, 0x00, 0x27, 0x00, 0x33, 0x00, 0x44, 0x00,
+  0x00, 0x00, 0x0b, 0x00, 0x1c, 0x00, 0x29, 0x00, 0x41, 0x00, 0x48, 0x00,
+  0x52, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1c, 0x00, 0x2b, 0x00, 0x33, 0x00,
+  0x3c, 0x00, 0x00, 0x00, 0x19, 0x00, 0x24, 0x00, 0x33, 0x00, 0x3b, 0x00,
+  0x4b, 0x00, 0x58, 0x00, 0x67, 0x00, 0x6f, 0x00, 0x7c, 0x00, 0x8a, 0x00,
+  0x98, 0x00, 0xa4, 0x00, 0xae, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x1c, 0x00, 0x25, 0x00, 0x2e, 0x00, 0x3b, 0x00, 0x00, 0x00,
+  0x21, 0x00, 0x35, 0x00, 0x48, 0x00, 0x51, 0x00, 0x00, 0x00, 0x19, 0x00,
+  0x2b, 0x00, 0x34, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x2f, 0x00, 0x45, 0x00,
+  0x5b, 0x00, 0x74, 0x00, 0x80, 0x00, 0x89, 0x00, 0xa5, 0x00, 0xb4, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x1a, 0x00, 0x2b, 0x00, 0x3c, 0x00, 0x4c, 0x00,
+  0x5b, 0x00, 0x67, 0x00, 0x74, 0x00, 0x82, 0x00, 0x00, 0x00, 0x14, 0x00,
+  0x24, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x17, 0x00, 0x27, 0x00,
+  0x3c, 0x00, 0x51, 0x00, 0x5a, 0x00, 0x66, 0x00, 0x6f, 0x00, 0x77, 0x00,
+  0x00, 0x00, 0x13, 0x00, 0x23, 0x00, 0x2f, 0x00, 0x38, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x25, 0x00, 0x33, 0x00, 0x3f, 0x00, 0x49, 0x00, 0x58, 0x00,
+  0x62, 0x00, 0x00, 0x00, 0x14, 0x00, 0x1b, 0x00, 0x2e, 0x00, 0x40, 0x00,
+  0x00, 0x00, 0x19, 0x00, 0x2d, 0x00, 0x42, 0x00, 0x00, 0x00, 0x1a, 0x00,
+  0x24, 0x00, 0x34, 0x00, 0x40, 0x00, 0x4d, 0x00, 0x56, 0x00, 0x61, 0x00,
+  0x6d, 0x00, 0x78, 0x00, 0x85, 0x00, 0x95, 0x00, 0xa5, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x22, 0x00, 0x30, 0x00, 0x00, 0x00, 0x14, 0x00, 0x24, 0x00,
+  0x35, 0x00, 0x3e, 0x00, 0x46, 0x00, 0x56, 0x00, 0x67, 0x00, 0x75, 0x00,
+  0x82, 0x00, 0x91, 0x00, 0xa0, 0x00, 0xb0, 0x00, 0xbc, 0x00, 0xcc, 0x00,
+  0xd9, 0x00, 0xe9, 0x00, 0xfa, 0x00, 0x0b, 0x01, 0x00, 0x00, 0x15, 0x00,
+  0x28, 0x00, 0x47, 0x00, 0x4d, 0x00, 0x00, 0x00, 0x12, 0x00, 0x31, 0x00,
+  0x46, 0x00, 0x53, 0x00, 0x5e, 0x00, 0x71, 0x00, 0x83, 0x00, 0x94, 0x00,
+  0xa3, 0x00, 0xad, 0x00, 0xb8, 0x00, 0x00, 0x00, 0x17, 0x00, 0x2c, 0x00,
+  0x36, 0x00, 0x00, 0x00, 0x13, 0x00, 0x33, 0x00, 0x4b, 0x00, 0x5b, 0x00,
+  0x64, 0x00, 0x73, 0x00, 0x81, 0x00, 0x92, 0x00, 0xa1, 0x00, 0xb2, 0x00,
+  0xc1, 0x00, 0xd2, 0x00, 0xe3, 0x00, 0x00, 0x00, 0x15, 0x00, 0x28, 0x00,
+  0x34, 0x00, 0x45, 0x00, 0x4f, 0x00, 0x59, 0x00, 0x63, 0x00, 0x00, 0x00,
+  0x1a, 0x00, 0x36, 0x00, 0x4b, 0x00, 0x60, 0x00, 0x6f, 0x00, 0x7d, 0x00,
+  0x8c, 0x00, 0x9b, 0x00, 0xa3, 0x00, 0x00, 0x00, 0x10, 0x00, 0x25, 0x00,
+  0x3e, 0x00, 0x47, 0x00, 0x54, 0x00, 0x5c, 0x00, 0x66, 0x00, 0x73, 0x00,
+  0x80, 0x00, 0x8c, 0x00, 0x96, 0x00, 0x00, 0x00, 0x10, 0x00, 0x26, 0x00,
+  0x34, 0x00, 0x42, 0x00, 0x4e, 0x00, 0x59, 0x00, 0x6b, 0x00, 0x82, 0x00,
+  0x95, 0x00, 0xa2, 0x00, 0x00, 0x00, 0x10, 0x00, 0x1b, 0x00, 0x25, 0x00,
+  0x2e, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x3c, 0x00, 0x49, 0x00,
+  0x57, 0x00, 0x63, 0x00, 0x70, 0x00, 0x79, 0x00, 0x83, 0x00, 0x00, 0x00,
+  0x19, 0x00, 0x33, 0x00, 0x44, 0x00, 0x52, 0x00, 0x67, 0x00, 0x78, 0x00,
+  0x82, 0x00, 0x91, 0x00, 0x9d, 0x00, 0xae, 0x00, 0xbf, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x37, 0x00, 0x4a, 0x00, 0x5a, 0x00, 0x65, 0x00, 0x82, 0x00,
+  0x8b, 0x00, 0x94, 0x00, 0xab, 0x00, 0xbb, 0x00, 0xcb, 0x00, 0xda, 0x00,
+  0xe3, 0x00, 0xef, 0x00, 0xf7, 0x00, 0x03, 0x01, 0x0b, 0x01, 0x1a, 0x01,
+  0x22, 0x01, 0x30, 0x01, 0x00, 0x00, 0x12, 0x00, 0x25, 0x00, 0x36, 0x00,
+  0x4f, 0x00, 0x67, 0x00, 0x73, 0x00, 0x7e, 0x00, 0x8c, 0x00, 0x9c, 0x00,
+  0xa5, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x27, 0x00, 0x40, 0x00, 0x51, 0x00,
+  0x61, 0x00, 0x71, 0x00, 0x7d, 0x00, 0x8b, 0x00, 0x98, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x27, 0x00, 0x37, 0x00, 0x4b, 0x00, 0x58, 0x00, 0x67, 0x00,
+  0x74, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x10, 0x00, 0x1c, 0x00, 0x2c, 0x00,
+  0x3e, 0x00, 0x49, 0x00, 0x5e, 0x00, 0x69, 0x00, 0x00, 0x00, 0x0d, 0x00,
+  0x1f, 0x00, 0x3d, 0x00, 0x53, 0x00, 0x60, 0x00, 0x6c, 0x00, 0x7b, 0x00,
+  0x86, 0x00, 0x94, 0x00, 0xa1, 0x00, 0xb4, 0x00, 0xc0, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x23, 0x00, 0x38, 0x00, 0x44, 0x00, 0x4f, 0x00, 0x5d, 0x00,
+  0x67, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x17, 0x00, 0x23, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x17, 0x00, 0x26, 0x00, 0x35, 0x00,
+  0x41, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x30, 0x00, 0x41, 0x00, 0x51, 0x00,
+  0x5c, 0x00, 0x64, 0x00, 0x74, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x13, 0x00,
+  0x22, 0x00, 0x33, 0x00, 0x41, 0x00, 0x53, 0x00, 0x65, 0x00, 0x70, 0x00,
+  0x00, 0x00, 0x13, 0x00, 0x29, 0x00, 0x35, 0x00, 0x48, 0x00, 0x58, 0x00,
+  0x66, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1d, 0x00,
+  0x00, 0x00, 0x0f, 0x00, 0x1c, 0x00, 0x2f, 0x00, 0x54, 0x00, 0x66, 0x00,
+  0x7a, 0x00, 0x8d, 0x00, 0x98, 0x00, 0x00, 0x00, 0x12, 0x00, 0x1f, 0x00,
+  0x2e, 0x00, 0x3e, 0x00, 0x54, 0x00, 0x66, 0x00, 0x72, 0x00, 0x85, 0x00,
+  0x96, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x19, 0x00, 0x2c, 0x00,
+  0x3e, 0x00, 0x48, 0x00, 0x52, 0x00, 0x65, 0x00, 0x00, 0x00, 0x17, 0x00,
+  0x37, 0x00, 0x45, 0x00, 0x54, 0x00, 0x6b, 0x00, 0x7f, 0x00, 0x94, 0x00,
+  0xa8, 0x00, 0xb8, 0x00, 0xc9, 0x00, 0xdb, 0x00, 0xe7, 0x00, 0xf3, 0x00,
+  0x03, 0x01, 0x0c, 0x01, 0x17, 0x01, 0x28, 0x01, 0x38, 0x01, 0x00, 0x00,
+  0x14, 0x00, 0x22, 0x00, 0x31, 0x00, 0x3e, 0x00, 0x53, 0x00, 0x00, 0x00,
+  0x15, 0x00, 0x2f, 0x00, 0x3c, 0x00, 0x49, 0x00, 0x5a, 0x00, 0x74, 0x00,
+  0x7d, 0x00, 0x8c, 0x00, 0x99, 0x00, 0xa9, 0x00, 0xba, 0x00, 0xcc, 0x00,
+  0xdb, 0x00, 0xec, 0x00, 0xfa, 0x00, 0x03, 0x01, 0x12, 0x01, 0x1f, 0x01,
+  0x00, 0x00, 0x14, 0x00, 0x25, 0x00, 0x3c, 0x00, 0x47, 0x00, 0x57, 0x00,
+  0x64, 0x00, 0x76, 0x00, 0x7f, 0x00, 0x88, 0x00, 0x00, 0x00, 0x23, 0x00,
+  0x37, 0x00, 0x4f, 0x00, 0x6e, 0x00, 0x7f, 0x00, 0x8f, 0x00, 0xa2, 0x00,
+  0xb7, 0x00, 0xcb, 0x00, 0xd7, 0x00, 0xe2, 0x00, 0x00, 0x00, 0x19, 0x00,
+  0x3d, 0x00, 0x50, 0x00, 0x61, 0x00, 0x78, 0x00, 0x90, 0x00, 0x99, 0x00,
+  0xa3, 0x00, 0x00, 0x00, 0x14, 0x00, 0x27, 0x00, 0x3a, 0x00, 0x47, 0x00,
+  0x57, 0x00, 0x69, 0x00, 0x84, 0x00, 0x94, 0x00, 0xa4, 0x00, 0xb4, 0x00,
+  0xbd, 0x00, 0xc8, 0x00, 0xd0, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x13, 0x00,
+  0x2f, 0x00, 0x3c, 0x00, 0x47, 0x00, 0x5a, 0x00, 0x6e, 0x00, 0x80, 0x00,
+  0x8b, 0x00, 0x95, 0x00, 0x00, 0x00, 0x11, 0x00, 0x34, 0x00, 0x4d, 0x00,
+  0x5a, 0x00, 0x70, 0x00, 0x89, 0x00, 0x97, 0x00, 0xab, 0x00, 0xb7, 0x00,
+  0xc5, 0x00, 0xd1, 0x00, 0xde, 0x00, 0xea, 0x00, 0x00, 0x00, 0x1c, 0x00,
+  0x2f, 0x00, 0x41, 0x00, 0x57, 0x00, 0x6e, 0x00, 0x80, 0x00, 0x8b, 0x00,
+  0xa3, 0x00, 0xaf, 0x00, 0x00, 0x00, 0x25, 0x00, 0x35, 0x00, 0x52, 0x00,
+  0x6f, 0x00, 0x7d, 0x00, 0x8d, 0x00, 0xa4, 0x00, 0xb2, 0x00, 0xbf, 0x00,
+  0xca, 0x00, 0xd8, 0x00, 0xe5, 0x00, 0x00, 0x00, 0x12, 0x00, 0x28, 0x00,
+  0x45, 0x00, 0x61, 0x00, 0x70, 0x00, 0x7f, 0x00, 0x90, 0x00, 0xa7, 0x00,
+  0xbb, 0x00, 0xc6, 0x00, 0x00, 0x00, 0x14, 0x00, 0x32, 0x00, 0x46, 0x00,
+  0x5c, 0x00, 0x68, 0x00, 0x7e, 0x00, 0x97, 0x00, 0xa5, 0x00, 0xb3, 0x00,
+  0xc0, 0x00, 0xc9, 0x00, 0x00, 0x00, 0x17, 0x00, 0x2b, 0x00, 0x3d, 0x00,
+  0x4e, 0x00, 0x60, 0x00, 0x6e, 0x00, 0x7a, 0x00, 0x85, 0x00, 0x8e, 0x00,
+  0xa5, 0x00, 0xae, 0x00, 0x00, 0x00, 0x26, 0x00, 0x38, 0x00, 0x4c, 0x00,
+  0x60, 0x00, 0x71, 0x00, 0x7d, 0x00, 0x92, 0x00, 0xab, 0x00, 0xb7, 0x00,
+  0xc5, 0x00, 0xd1, 0x00, 0xdc, 0x00, 0xe8, 0x00, 0xf5, 0x00, 0x02, 0x01,
+  0x10, 0x01, 0x00, 0x00, 0x15, 0x00, 0x26, 0x00, 0x34, 0x00, 0x42, 0x00,
+  0x58, 0x00, 0x6a, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x32, 0x00, 0x4a, 0x00,
+  0x5d, 0x00, 0x6c, 0x00, 0x82, 0x00, 0x91, 0x00, 0xa0, 0x00, 0xb1, 0x00,
+  0xc1, 0x00, 0xd1, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x16, 0x00, 0x29, 0x00,
+  0x3f, 0x00, 0x5a, 0x00, 0x72, 0x00, 0x00, 0x00, 0x13, 0x00, 0x21, 0x00,
+  0x34, 0x00, 0x48, 0x00, 0x54, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x29, 0x00,
+  0x38, 0x00, 0x4d, 0x00, 0x57, 0x00, 0x69, 0x00, 0x75, 0x00, 0x86, 0x00,
+  0x91, 0x00, 0x00, 0x00, 0x11, 0x00, 0x1c, 0x00, 0x2c, 0x00, 0x3a, 0x00,
+  0x4a, 0x00, 0x54, 0x00, 0x65, 0x00, 0x71, 0x00, 0x00, 0x00, 0x0d, 0x00,
+  0x21, 0x00, 0x36, 0x00, 0x00, 0x00, 0x13, 0x00, 0x28, 0x00, 0x3a, 0x00,
+  0x49, 0x00, 0x5a, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x11, 0x00, 0x22, 0x00,
+  0x35, 0x00, 0x49, 0x00, 0x56, 0x00, 0x69, 0x00, 0x75, 0x00, 0x8b, 0x00,
+  0x9f, 0x00, 0xab, 0x00, 0x00, 0x00, 0x19, 0x00, 0x2c, 0x00, 0x46, 0x00,
+  0x53, 0x00, 0x63, 0x00, 0x85, 0x00, 0xa5, 0x00, 0xb3, 0x00, 0xbb, 0x00,
+  0xca, 0x00, 0xd7, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x2e, 0x00, 0x42, 0x00,
+  0x52, 0x00, 0x68, 0x00, 0x00, 0x00, 0x11, 0x00, 0x23, 0x00, 0x45, 0x00,
+  0x52, 0x00, 0x61, 0x00, 0x72, 0x00, 0x87, 0x00, 0x96, 0x00, 0xa2, 0x00,
+  0xb2, 0x00, 0xc4, 0x00, 0xd5, 0x00, 0xe5, 0x00, 0xf2, 0x00, 0x01, 0x01,
+  0x00, 0x00, 0x0c, 0x00, 0x1b, 0x00, 0x2b, 0x00, 0x4c, 0x00, 0x59, 0x00,
+  0x70, 0x00, 0x7a, 0x00, 0x81, 0x00, 0x93, 0x00, 0xa3, 0x00, 0xad, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x1c, 0x00, 0x2e, 0x00, 0x50, 0x00, 0x67, 0x00,
+  0x74, 0x00, 0x00, 0x00, 0x15, 0x00, 0x29, 0x00, 0x39, 0x00, 0x4b, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x1a, 0x00, 0x29, 0x00, 0x31, 0x00, 0x3d, 0x00,
+  0x50, 0x00, 0x5e, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x21, 0x00, 0x2b, 0x00,
+  0x3e, 0x00, 0x4f, 0x00, 0x61, 0x00, 0x69, 0x00, 0x00, 0x00, 0x12, 0x00,
+  0x24, 0x00, 0x34, 0x00, 0x3f, 0x00, 0x48, 0x00, 0x56, 0x00, 0x5d, 0x00,
+  0x6c, 0x00, 0x77, 0x00, 0x82, 0x00, 0x8c, 0x00, 0x9b, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x21, 0x00, 0x35, 0x00, 0x42, 0x00, 0x00, 0x00, 0x13, 0x00,
+  0x26, 0x00, 0x35, 0x00, 0x41, 0x00, 0x50, 0x00, 0x61, 0x00, 0x70, 0x00,
+  0x7f, 0x00, 0x8e, 0x00, 0x9d, 0x00, 0xac, 0x00, 0xb5, 0x00, 0xc5, 0x00,
+  0xd6, 0x00, 0xe6, 0x00, 0xf5, 0x00, 0x04, 0x01, 0x0d, 0x01, 0x1c, 0x01,
+  0x2b, 0x01, 0x39, 0x01, 0x48, 0x01, 0x57, 0x01, 0x66, 0x01, 0x00, 0x00,
+  0x13, 0x00, 0x21, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x20, 0x00,
+  0x2c, 0x00, 0x3a, 0x00, 0x48, 0x00, 0x57, 0x00, 0x6a, 0x00, 0x76, 0x00,
+  0x87, 0x00, 0x97, 0x00, 0xa6, 0x00, 0xb2, 0x00, 0xbe, 0x00, 0x00, 0x00,
+  0x18, 0x00, 0x27, 0x00, 0x32, 0x00, 0x00, 0x00, 0x12, 0x00, 0x25, 0x00,
+  0x33, 0x00, 0x49, 0x00, 0x52, 0x00, 0x60, 0x00, 0x6f, 0x00, 0x7f, 0x00,
+  0x8e, 0x00, 0xa1, 0x00, 0xaa, 0x00, 0xba, 0x00, 0xc8, 0x00, 0xd5, 0x00,
+  0xe1, 0x00, 0xea, 0x00, 0xf9, 0x00, 0x07, 0x01, 0x00, 0x00, 0x16, 0x00,
+  0x24, 0x00, 0x3b, 0x00, 0x44, 0x00, 0x4d, 0x00, 0x57, 0x00, 0x63, 0x00,
+  0x71, 0x00, 0x7b, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x2a, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x24, 0x00, 0x36, 0x00, 0x48, 0x00, 0x5a, 0x00, 0x00, 0x00,
+  0x21, 0x00, 0x2d, 0x00, 0x4c, 0x00, 0x56, 0x00, 0x62, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x1f, 0x00, 0x40, 0x00, 0x4a, 0x00, 0x00, 0x00, 0x12, 0x00,
+  0x2b, 0x00, 0x3e, 0x00, 0x53, 0x00, 0x6b, 0x00, 0x78, 0x00, 0x8b, 0x00,
+  0x94, 0x00, 0x9d, 0x00, 0xa7, 0x00, 0xb3, 0x00, 0xc6, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x1d, 0x00, 0x28, 0x00, 0x3a, 0x00, 0x43, 0x00, 0x55, 0x00,
+  0x66, 0x00, 0x79, 0x00, 0x00, 0x00, 0x13, 0x00, 0x29, 0x00, 0x3c, 0x00,
+  0x43, 0x00, 0x53, 0x00, 0x66, 0x00, 0x7a, 0x00, 0x87, 0x00, 0x00, 0x00,
+  0x1d, 0x00, 0x28, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x30, 0x00, 0x3d, 0x00,
+  0x4d, 0x00, 0x5b, 0x00, 0x6b, 0x00, 0x00, 0x00, 0x13, 0x00, 0x25, 0x00,
+  0x3a, 0x00, 0x00, 0x00, 0x12, 0x00, 0x24, 0x00, 0x37, 0x00, 0x40, 0x00,
+  0x50, 0x00, 0x5c, 0x00, 0x6b, 0x00, 0x77, 0x00, 0x7f, 0x00, 0x8d, 0x00,
+  0x9a, 0x00, 0xa8, 0x00, 0xb4, 0x00, 0xbc, 0x00, 0xc5, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x2f, 0x00, 0x40, 0x00, 0x50, 0x00, 0x5f, 0x00, 0x71, 0x00,
+  0x00, 0x00, 0x19, 0x00, 0x2d, 0x00, 0x41, 0x00, 0x4f, 0x00, 0x00, 0x00,
+  0x16, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x10, 0x00, 0x20, 0x00, 0x2e, 0x00,
+  0x3c, 0x00, 0x4a, 0x00, 0x5a, 0x00, 0x68, 0x00, 0x74, 0x00, 0x80, 0x00,
+  0x8c, 0x00, 0x98, 0x00, 0x00, 0x00, 0x15, 0x00, 0x27, 0x00, 0x00, 0x00,
+  0x34, 0x00, 0x47, 0x00, 0x58, 0x00, 0x6f, 0x00, 0x85, 0x00, 0x93, 0x00,
+  0xa3, 0x00, 0xb8, 0x00, 0xc5, 0x00, 0x00, 0x00, 0x09, 0x00, 0x16, 0x00,
+  0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x12, 0x00,
+  0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x20, 0x00, 0x32, 0x00,
+  0x3e, 0x00, 0x43, 0x00, 0x00, 0x00, 0x10, 0x00, 0x19, 0x00, 0x21, 0x00,
+  0x30, 0x00, 0x3a, 0x00, 0x43, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x18, 0x00,
+  0x21, 0x00, 0x2f, 0x00, 0x3d, 0x00, 0x46, 0x00, 0x54, 0x00, 0x61, 0x00,
+  0x6c, 0x00, 0x7c, 0x00, 0x87, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1d, 0x00,
+  0x2c, 0x00, 0x3a, 0x00, 0x47, 0x00, 0x57, 0x00, 0x63, 0x00, 0x72, 0x00,
+  0x7b, 0x00, 0x8a, 0x00, 0x93, 0x00, 0xa1, 0x00, 0xaf, 0x00, 0xbf, 0x00,
+  0xcd, 0x00, 0xdd, 0x00, 0xeb, 0x00, 0xfa, 0x00, 0x09, 0x01, 0x18, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x17, 0x00, 0x24, 0x00, 0x36, 0x00,
+  0x40, 0x00, 0x49, 0x00, 0x54, 0x00, 0x66, 0x00, 0x79, 0x00, 0x8c, 0x00,
+  0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x17, 0x00, 0x20, 0x00,
+  0x29, 0x00, 0x32, 0x00, 0x3e, 0x00, 0x4c, 0x00, 0x5b, 0x00, 0x68, 0x00,
+  0x77, 0x00, 0x80, 0x00, 0x8a, 0x00, 0x9a, 0x00, 0xaa, 0x00, 0xb3, 0x00,
+  0xc7, 0x00, 0xd1, 0x00, 0xe0, 0x00, 0xee, 0x00, 0xff, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x0b, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x13, 0x00,
+  0x21, 0x00, 0x2e, 0x00, 0x39, 0x00, 0x42, 0x00, 0x00, 0x00, 0x0d, 0x00,
+  0x19, 0x00, 0x23, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1b, 0x00, 0x27, 0x00,
+  0x36, 0x00, 0x44, 0x00, 0x52, 0x00, 0x61, 0x00, 0x6d, 0x00, 0x79, 0x00,
+  0x87, 0x00, 0x95, 0x00, 0x00, 0x00, 0x13, 0x00, 0x22, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x1a, 0x00, 0x26, 0x00, 0x35, 0x00, 0x3b, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x27, 0x00, 0x2e, 0x00, 0x3e, 0x00, 0x4f, 0x00, 0x65, 0x00,
+  0x71, 0x00, 0x88, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x1a, 0x00, 0x28, 0x00,
+  0x36, 0x00, 0x44, 0x00, 0x52, 0x00, 0x5f, 0x00, 0x6d, 0x00, 0x7b, 0x00,
+  0x8a, 0x00, 0x99, 0x00, 0xa7, 0x00, 0xb4, 0x00, 0xc9, 0x00, 0xd7, 0x00,
+  0xe5, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x16, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x18, 0x00, 0x28, 0x00, 0x33, 0x00, 0x43, 0x00, 0x4e, 0x00, 0x5b, 0x00,
+  0x00, 0x00, 0x25, 0x00, 0x3b, 0x00, 0x4d, 0x00, 0x65, 0x00, 0x7c, 0x00,
+  0x8b, 0x00, 0xa3, 0x00, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x00, 0x00, 0x11, 0x00, 0x1b, 0x00, 0x2a, 0x00, 0x36, 0x00,
+  0x40, 0x00, 0x51, 0x00, 0x62, 0x00, 0x74, 0x00, 0x7e, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x18, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x18, 0x00, 0x20, 0x00,
+  0x2c, 0x00, 0x39, 0x00, 0x41, 0x00, 0x51, 0x00, 0x60, 0x00, 0x68, 0x00,
+  0x76, 0x00, 0x83, 0x00, 0x8f, 0x00, 0x9c, 0x00, 0xa4, 0x00, 0xb4, 0x00,
+  0xc1, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x17, 0x00,
+  0x24, 0x00, 0x34, 0x00, 0x42, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x1a, 0x00,
+  0x25, 0x00, 0x2f, 0x00, 0x3f, 0x00, 0x49, 0x00, 0x50, 0x00, 0x61, 0x00,
+  0x6b, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1b, 0x00, 0x28, 0x00,
+  0x36, 0x00, 0x43, 0x00, 0x51, 0x00, 0x5e, 0x00, 0x69, 0x00, 0x78, 0x00,
+  0x86, 0x00, 0x93, 0x00, 0xa1, 0x00, 0xae, 0x00, 0xc1, 0x00, 0xcf, 0x00,
+  0xdc, 0x00, 0xe4, 0x00, 0xf2, 0x00, 0xff, 0x00, 0x0e, 0x01, 0x1d, 0x01,
+  0x23, 0x01, 0x00, 0x00, 0x09, 0x00, 0x16, 0x00, 0x22, 0x00, 0x33, 0x00,
+  0x3f, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x15, 0x00, 0x24, 0x00, 0x33, 0x00,
+  0x3a, 0x00, 0x4a, 0x00, 0x54, 0x00, 0x5c, 0x00, 0x62, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x1c, 0x00, 0x33, 0x00, 0x00, 0x00, 0x10, 0x00, 0x22, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x19, 0x00, 0x00, 0x00, 0x12, 0x00, 0x1e, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x32, 0x00, 0x3e, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x30, 0x00,
+  0x00, 0x00, 0x0b, 0x00, 0x18, 0x00, 0x20, 0x00, 0x2e, 0x00, 0x3b, 0x00,
+  0x00, 0x00, 0x2c, 0x00, 0x56, 0x00, 0x7f, 0x00, 0xaa, 0x00, 0xb5, 0x00,
+  0x00, 0x00, 0x2b, 0x00, 0x55, 0x00, 0x7e, 0x00, 0xa6, 0x00, 0xce, 0x00,
+  0xf8, 0x00, 0x04, 0x01, 0x12, 0x01, 0x1f, 0x01, 0x2a, 0x01, 0x36, 0x01,
+  0x42, 0x01, 0x00, 0x00, 0x13, 0x00, 0x27, 0x00, 0x39, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x17, 0x00, 0x25, 0x00, 0x34, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x1d, 0x00, 0x2b, 0x00, 0x35, 0x00, 0x3f, 0x00,
+  0x4e, 0x00, 0x5d, 0x00, 0x6d, 0x00, 0x81, 0x00, 0x8a, 0x00
+};
@@ -1,5 +1,7 @@
 #pragma once
-const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
+#include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/eo_dict_index.h>
+const unsigned char __espeakng_dict_eo[] __attribute__((aligned((4)))) = {
   0x00, 0x04, 0x00, 0x00, 0x09, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c,
   0x43, 0x39, 0x23, 0xc0, 0x32, 0x28, 0x42, 0x24, 0x33, 0x27, 0x00, 0x0c,
   0x06, 0x5f, 0x23, 0x2d, 0x61, 0x6a, 0x6e, 0x02, 0x6e, 0x32, 0x00, 0x00,
@@ -390,4 +392,11 @@ const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
   0x02, 0x20, 0x03, 0x5c, 0x27, 0x00, 0xc4, 0xa5, 0x03, 0x66, 0x00, 0xc4,
   0xa5, 0x08, 0x02, 0x20, 0x03, 0x66, 0x27, 0x00, 0x07, 0x00
 };
-size_t __espeakng_dictlen = 4666;
+
+BackgroundAudioDictionary dict_eo = {
+    "eo",
+    4666,
+    __espeakng_dict_eo,
+    2794,
+    __espeakng_dictindex_eo
+};
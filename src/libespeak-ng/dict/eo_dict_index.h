@@ -0,0 +1,236 @@
+#pragma once
+const unsigned char __espeakng_dictindex_eo[] __attribute__((aligned((4)))) = {
+  0x45, 0x44, 0x58, 0x31, 0x3a, 0x12, 0x00, 0x00, 0x09, 0x0e, 0x00, 0x00,
+  0xf2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x02, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00,
+  0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00,
+  0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x04, 0x00,
+  0x04, 0x00, 0x04, 0x00, 0x05, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00,
+  0x06, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x08, 0x00,
+  0x08, 0x00, 0x09, 0x00, 0x09, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x0b, 0x00,
+  0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0e, 0x00, 0x0e, 0x00,
+  0x0e, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x10, 0x00, 0x11, 0x00, 0x11, 0x00,
+  0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x12, 0x00, 0x12, 0x00, 0x12, 0x00,
+  0x12, 0x00, 0x12, 0x00, 0x12, 0x00, 0x12, 0x00, 0x13, 0x00, 0x14, 0x00,
+  0x14, 0x00, 0x15, 0x00, 0x16, 0x00, 0x16, 0x00, 0x17, 0x00, 0x17, 0x00,
+  0x17, 0x00, 0x17, 0x00, 0x17, 0x00, 0x17, 0x00, 0x17, 0x00, 0x17, 0x00,
+  0x17, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00,
+  0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00,
+  0x18, 0x00, 0x18, 0x00, 0x19, 0x00, 0x19, 0x00, 0x19, 0x00, 0x19, 0x00,
+  0x1a, 0x00, 0x1a, 0x00, 0x1a, 0x00, 0x1a, 0x00, 0x1d, 0x00, 0x1d, 0x00,
+  0x1d, 0x00, 0x1d, 0x00, 0x1d, 0x00, 0x1d, 0x00, 0x1d, 0x00, 0x1d, 0x00,
+  0x1d, 0x00, 0x1d, 0x00, 0x1d, 0x00, 0x1d, 0x00, 0x1d, 0x00, 0x1d, 0x00,
+  0x1d, 0x00, 0x1d, 0x00, 0x1d, 0x00, 0x1d, 0x00, 0x1e, 0x00, 0x1e, 0x00,
+  0x1e, 0x00, 0x1e, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x1f, 0x00,
+  0x20, 0x00, 0x20, 0x00, 0x21, 0x00, 0x21, 0x00, 0x23, 0x00, 0x24, 0x00,
+  0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00,
+  0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x25, 0x00, 0x25, 0x00, 0x25, 0x00,
+  0x25, 0x00, 0x25, 0x00, 0x25, 0x00, 0x25, 0x00, 0x25, 0x00, 0x26, 0x00,
+  0x26, 0x00, 0x26, 0x00, 0x26, 0x00, 0x26, 0x00, 0x26, 0x00, 0x28, 0x00,
+  0x28, 0x00, 0x29, 0x00, 0x29, 0x00, 0x2a, 0x00, 0x2a, 0x00, 0x2a, 0x00,
+  0x2a, 0x00, 0x2a, 0x00, 0x2a, 0x00, 0x2a, 0x00, 0x2a, 0x00, 0x2a, 0x00,
+  0x2a, 0x00, 0x2a, 0x00, 0x2b, 0x00, 0x2b, 0x00, 0x2b, 0x00, 0x2c, 0x00,
+  0x2c, 0x00, 0x2c, 0x00, 0x2c, 0x00, 0x2c, 0x00, 0x2c, 0x00, 0x2c, 0x00,
+  0x2c, 0x00, 0x2c, 0x00, 0x2c, 0x00, 0x2c, 0x00, 0x2c, 0x00, 0x2d, 0x00,
+  0x2d, 0x00, 0x2e, 0x00, 0x2e, 0x00, 0x2e, 0x00, 0x2e, 0x00, 0x2e, 0x00,
+  0x2e, 0x00, 0x2e, 0x00, 0x2e, 0x00, 0x2e, 0x00, 0x2e, 0x00, 0x2e, 0x00,
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x32, 0x00, 0x32, 0x00,
+  0x32, 0x00, 0x32, 0x00, 0x32, 0x00, 0x32, 0x00, 0x33, 0x00, 0x33, 0x00,
+  0x33, 0x00, 0x33, 0x00, 0x33, 0x00, 0x35, 0x00, 0x35, 0x00, 0x35, 0x00,
+  0x35, 0x00, 0x35, 0x00, 0x35, 0x00, 0x35, 0x00, 0x35, 0x00, 0x35, 0x00,
+  0x35, 0x00, 0x35, 0x00, 0x35, 0x00, 0x35, 0x00, 0x35, 0x00, 0x35, 0x00,
+  0x35, 0x00, 0x37, 0x00, 0x37, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00,
+  0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00,
+  0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x39, 0x00,
+  0x3a, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x3a, 0x00,
+  0x3a, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x3a, 0x00,
+  0x3a, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x3b, 0x00,
+  0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00,
+  0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3c, 0x00,
+  0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00,
+  0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00,
+  0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00,
+  0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00,
+  0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00,
+  0x3c, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x3e, 0x00,
+  0x3e, 0x00, 0x3e, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00,
+  0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00,
+  0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00,
+  0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00,
+  0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00,
+  0x40, 0x00, 0x41, 0x00, 0x42, 0x00, 0x43, 0x00, 0x44, 0x00, 0x44, 0x00,
+  0x44, 0x00, 0x45, 0x00, 0x45, 0x00, 0x46, 0x00, 0x46, 0x00, 0x46, 0x00,
+  0x46, 0x00, 0x47, 0x00, 0x47, 0x00, 0x47, 0x00, 0x49, 0x00, 0x4a, 0x00,
+  0x4a, 0x00, 0x4a, 0x00, 0x4a, 0x00, 0x4a, 0x00, 0x4a, 0x00, 0x4a, 0x00,
+  0x4b, 0x00, 0x4b, 0x00, 0x4b, 0x00, 0x4b, 0x00, 0x4c, 0x00, 0x4d, 0x00,
+  0x4d, 0x00, 0x4e, 0x00, 0x4f, 0x00, 0x4f, 0x00, 0x4f, 0x00, 0x4f, 0x00,
+  0x4f, 0x00, 0x4f, 0x00, 0x4f, 0x00, 0x4f, 0x00, 0x50, 0x00, 0x50, 0x00,
+  0x50, 0x00, 0x50, 0x00, 0x50, 0x00, 0x50, 0x00, 0x50, 0x00, 0x50, 0x00,
+  0x52, 0x00, 0x54, 0x00, 0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x56, 0x00,
+  0x56, 0x00, 0x56, 0x00, 0x56, 0x00, 0x56, 0x00, 0x57, 0x00, 0x57, 0x00,
+  0x57, 0x00, 0x58, 0x00, 0x58, 0x00, 0x58, 0x00, 0x5a, 0x00, 0x5b, 0x00,
+  0x5b, 0x00, 0x5b, 0x00, 0x5b, 0x00, 0x5b, 0x00, 0x5b, 0x00, 0x5b, 0x00,
+  0x5d, 0x00, 0x5e, 0x00, 0x5e, 0x00, 0x5e, 0x00, 0x5e, 0x00, 0x5e, 0x00,
+  0x5e, 0x00, 0x5e, 0x00, 0x5e, 0x00, 0x5f, 0x00, 0x5f, 0x00, 0x5f, 0x00,
+  0x5f, 0x00, 0x5f, 0x00, 0x5f, 0x00, 0x5f, 0x00, 0x5f, 0x00, 0x5f, 0x00,
+  0x5f, 0x00, 0x60, 0x00, 0x61, 0x00, 0x62, 0x00, 0x62, 0x00, 0x62, 0x00,
+  0x63, 0x00, 0x64, 0x00, 0x64, 0x00, 0x64, 0x00, 0x64, 0x00, 0x64, 0x00,
+  0x64, 0x00, 0x64, 0x00, 0x64, 0x00, 0x65, 0x00, 0x65, 0x00, 0x65, 0x00,
+  0x65, 0x00, 0x65, 0x00, 0x65, 0x00, 0x65, 0x00, 0x65, 0x00, 0x66, 0x00,
+  0x67, 0x00, 0x68, 0x00, 0x68, 0x00, 0x68, 0x00, 0x6a, 0x00, 0x6a, 0x00,
+  0x6b, 0x00, 0x6c, 0x00, 0x6c, 0x00, 0x6c, 0x00, 0x6c, 0x00, 0x6c, 0x00,
+  0x6d, 0x00, 0x6d, 0x00, 0x6e, 0x00, 0x6f, 0x00, 0x6f, 0x00, 0x70, 0x00,
+  0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x71, 0x00,
+  0x71, 0x00, 0x71, 0x00, 0x71, 0x00, 0x71, 0x00, 0x71, 0x00, 0x71, 0x00,
+  0x71, 0x00, 0x72, 0x00, 0x72, 0x00, 0x72, 0x00, 0x72, 0x00, 0x73, 0x00,
+  0x73, 0x00, 0x73, 0x00, 0x73, 0x00, 0x74, 0x00, 0x74, 0x00, 0x74, 0x00,
+  0x74, 0x00, 0x74, 0x00, 0x74, 0x00, 0x74, 0x00, 0x74, 0x00, 0x75, 0x00,
+  0x75, 0x00, 0x75, 0x00, 0x76, 0x00, 0x76, 0x00, 0x76, 0x00, 0x76, 0x00,
+  0x77, 0x00, 0x78, 0x00, 0x79, 0x00, 0x79, 0x00, 0x79, 0x00, 0x79, 0x00,
+  0x79, 0x00, 0x7a, 0x00, 0x7a, 0x00, 0x7a, 0x00, 0x7a, 0x00, 0x7a, 0x00,
+  0x7a, 0x00, 0x7a, 0x00, 0x7a, 0x00, 0x7a, 0x00, 0x7a, 0x00, 0x7b, 0x00,
+  0x7b, 0x00, 0x7b, 0x00, 0x7b, 0x00, 0x7b, 0x00, 0x7b, 0x00, 0x7b, 0x00,
+  0x7b, 0x00, 0x7d, 0x00, 0x7d, 0x00, 0x7d, 0x00, 0x7d, 0x00, 0x7d, 0x00,
+  0x7e, 0x00, 0x7e, 0x00, 0x7e, 0x00, 0x7f, 0x00, 0x80, 0x00, 0x81, 0x00,
+  0x81, 0x00, 0x82, 0x00, 0x84, 0x00, 0x84, 0x00, 0x85, 0x00, 0x86, 0x00,
+  0x86, 0x00, 0x86, 0x00, 0x86, 0x00, 0x87, 0x00, 0x88, 0x00, 0x88, 0x00,
+  0x88, 0x00, 0x88, 0x00, 0x89, 0x00, 0x89, 0x00, 0x89, 0x00, 0x89, 0x00,
+  0x8a, 0x00, 0x8a, 0x00, 0x8a, 0x00, 0x8c, 0x00, 0x8c, 0x00, 0x8c, 0x00,
+  0x8c, 0x00, 0x8c, 0x00, 0x8c, 0x00, 0x8c, 0x00, 0x8c, 0x00, 0x8d, 0x00,
+  0x8d, 0x00, 0x8d, 0x00, 0x8d, 0x00, 0x8d, 0x00, 0x8d, 0x00, 0x8d, 0x00,
+  0x8d, 0x00, 0x8d, 0x00, 0x8d, 0x00, 0x8d, 0x00, 0x8d, 0x00, 0x8d, 0x00,
+  0x8e, 0x00, 0x8e, 0x00, 0x8e, 0x00, 0x8e, 0x00, 0x8e, 0x00, 0x8e, 0x00,
+  0x8e, 0x00, 0x8e, 0x00, 0x8e, 0x00, 0x8f, 0x00, 0x8f, 0x00, 0x90, 0x00,
+  0x90, 0x00, 0x91, 0x00, 0x91, 0x00, 0x91, 0x00, 0x93, 0x00, 0x94, 0x00,
+  0x94, 0x00, 0x94, 0x00, 0x94, 0x00, 0x95, 0x00, 0x95, 0x00, 0x95, 0x00,
+  0x96, 0x00, 0x96, 0x00, 0x96, 0x00, 0x96, 0x00, 0x96, 0x00, 0x96, 0x00,
+  0x96, 0x00, 0x96, 0x00, 0x97, 0x00, 0x97, 0x00, 0x97, 0x00, 0x97, 0x00,
+  0x97, 0x00, 0x97, 0x00, 0x97, 0x00, 0x98, 0x00, 0x99, 0x00, 0x99, 0x00,
+  0x99, 0x00, 0x99, 0x00, 0x99, 0x00, 0x99, 0x00, 0x99, 0x00, 0x99, 0x00,
+  0x99, 0x00, 0x99, 0x00, 0x99, 0x00, 0x99, 0x00, 0x99, 0x00, 0x99, 0x00,
+  0x99, 0x00, 0x99, 0x00, 0x99, 0x00, 0x99, 0x00, 0x99, 0x00, 0x99, 0x00,
+  0x99, 0x00, 0x99, 0x00, 0x99, 0x00, 0x99, 0x00, 0x99, 0x00, 0x99, 0x00,
+  0x99, 0x00, 0x99, 0x00, 0x99, 0x00, 0x99, 0x00, 0x99, 0x00, 0x99, 0x00,
+  0x99, 0x00, 0x99, 0x00, 0x99, 0x00, 0x99, 0x00, 0x99, 0x00, 0x9a, 0x00,
+  0x9a, 0x00, 0x9a, 0x00, 0x9b, 0x00, 0x9d, 0x00, 0x9d, 0x00, 0x9d, 0x00,
+  0x9d, 0x00, 0x9e, 0x00, 0x9e, 0x00, 0x9f, 0x00, 0x9f, 0x00, 0xa0, 0x00,
+  0xa0, 0x00, 0xa1, 0x00, 0xa1, 0x00, 0xa1, 0x00, 0xa1, 0x00, 0xa2, 0x00,
+  0xa2, 0x00, 0xa2, 0x00, 0xa2, 0x00, 0xa2, 0x00, 0xa2, 0x00, 0xa2, 0x00,
+  0xa2, 0x00, 0xa2, 0x00, 0xa2, 0x00, 0xa2, 0x00, 0xa2, 0x00, 0xa3, 0x00,
+  0xa4, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xa5, 0x00,
+  0xa5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xa7, 0x00,
+  0xa8, 0x00, 0xa8, 0x00, 0xa8, 0x00, 0xa8, 0x00, 0xaa, 0x00, 0xaa, 0x00,
+  0xaa, 0x00, 0xab, 0x00, 0xab, 0x00, 0xab, 0x00, 0xac, 0x00, 0xac, 0x00,
+  0xac, 0x00, 0xac, 0x00, 0xac, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
+  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xb0, 0x00, 0xb0, 0x00, 0xb0, 0x00,
+  0xb0, 0x00, 0xb0, 0x00, 0xb0, 0x00, 0xb0, 0x00, 0xb0, 0x00, 0xb0, 0x00,
+  0xb0, 0x00, 0xb1, 0x00, 0xb1, 0x00, 0xb1, 0x00, 0xb1, 0x00, 0xb1, 0x00,
+  0xb1, 0x00, 0xb1, 0x00, 0xb1, 0x00, 0xb1, 0x00, 0xb1, 0x00, 0xb1, 0x00,
+  0xb1, 0x00, 0xb1, 0x00, 0xb1, 0x00, 0xb1, 0x00, 0xb1, 0x00, 0xb1, 0x00,
+  0xb1, 0x00, 0xb1, 0x00, 0xb1, 0x00, 0xb2, 0x00, 0xb2, 0x00, 0xb4, 0x00,
+  0xb4, 0x00, 0xb4, 0x00, 0xb4, 0x00, 0xb4, 0x00, 0xb4, 0x00, 0xb4, 0x00,
+  0xb4, 0x00, 0xb4, 0x00, 0xb4, 0x00, 0xb4, 0x00, 0xb4, 0x00, 0xb4, 0x00,
+  0xb4, 0x00, 0xb4, 0x00, 0xb5, 0x00, 0xb5, 0x00, 0xb5, 0x00, 0xb6, 0x00,
+  0xb6, 0x00, 0xb6, 0x00, 0xb6, 0x00, 0xb6, 0x00, 0xb6, 0x00, 0xb8, 0x00,
+  0xb8, 0x00, 0xb8, 0x00, 0xb8, 0x00, 0xb8, 0x00, 0xb8, 0x00, 0xb8, 0x00,
+  0xb9, 0x00, 0xba, 0x00, 0xba, 0x00, 0xba, 0x00, 0xbc, 0x00, 0xbc, 0x00,
+  0xbd, 0x00, 0xbe, 0x00, 0xbe, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00,
+  0xc0, 0x00, 0xc1, 0x00, 0xc1, 0x00, 0xc2, 0x00, 0xc3, 0x00, 0xc5, 0x00,
+  0xc6, 0x00, 0xc7, 0x00, 0xc8, 0x00, 0xc9, 0x00, 0xca, 0x00, 0xcb, 0x00,
+  0xcc, 0x00, 0xcd, 0x00, 0xce, 0x00, 0xcf, 0x00, 0xd0, 0x00, 0xd1, 0x00,
+  0xd2, 0x00, 0xd3, 0x00, 0xd4, 0x00, 0xd7, 0x00, 0xd8, 0x00, 0xd8, 0x00,
+  0xd9, 0x00, 0xd9, 0x00, 0xd9, 0x00, 0xda, 0x00, 0xda, 0x00, 0xda, 0x00,
+  0xda, 0x00, 0xda, 0x00, 0xda, 0x00, 0xda, 0x00, 0xda, 0x00, 0xda, 0x00,
+  0xda, 0x00, 0xda, 0x00, 0xda, 0x00, 0xda, 0x00, 0xda, 0x00, 0xdb, 0x00,
+  0xdb, 0x00, 0xdb, 0x00, 0xdb, 0x00, 0xdb, 0x00, 0xdb, 0x00, 0xdb, 0x00,
+  0xdb, 0x00, 0xdc, 0x00, 0xdc, 0x00, 0xdc, 0x00, 0xde, 0x00, 0xdf, 0x00,
+  0xdf, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe2, 0x00, 0xe2, 0x00, 0xe2, 0x00,
+  0xe2, 0x00, 0xe2, 0x00, 0xe2, 0x00, 0xe2, 0x00, 0xe2, 0x00, 0xe2, 0x00,
+  0xe2, 0x00, 0xe2, 0x00, 0xe2, 0x00, 0xe2, 0x00, 0xe2, 0x00, 0xe2, 0x00,
+  0xe2, 0x00, 0xe3, 0x00, 0xe3, 0x00, 0xe4, 0x00, 0xe5, 0x00, 0xe5, 0x00,
+  0xe5, 0x00, 0xe5, 0x00, 0xe5, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00,
+  0xe7, 0x00, 0xe7, 0x00, 0xe7, 0x00, 0xe8, 0x00, 0xe8, 0x00, 0xe8, 0x00,
+  0xe8, 0x00, 0xe8, 0x00, 0xe8, 0x00, 0xe8, 0x00, 0xe8, 0x00, 0xe8, 0x00,
+  0xe8, 0x00, 0xe8, 0x00, 0xe8, 0x00, 0xe8, 0x00, 0xe8, 0x00, 0xe9, 0x00,
+  0xe9, 0x00, 0xe9, 0x00, 0xe9, 0x00, 0xe9, 0x00, 0xe9, 0x00, 0xe9, 0x00,
+  0xe9, 0x00, 0xe9, 0x00, 0xe9, 0x00, 0xe9, 0x00, 0xeb, 0x00, 0xeb, 0x00,
+  0xeb, 0x00, 0xeb, 0x00, 0xeb, 0x00, 0xeb, 0x00, 0xeb, 0x00, 0xeb, 0x00,
+  0xec, 0x00, 0xec, 0x00, 0xec, 0x00, 0xec, 0x00, 0xec, 0x00, 0xec, 0x00,
+  0xec, 0x00, 0xec, 0x00, 0xec, 0x00, 0xec, 0x00, 0xec, 0x00, 0xec, 0x00,
+  0xec, 0x00, 0xec, 0x00, 0xec, 0x00, 0xec, 0x00, 0xec, 0x00, 0xec, 0x00,
+  0xec, 0x00, 0xec, 0x00, 0xec, 0x00, 0xec, 0x00, 0xec, 0x00, 0xec, 0x00,
+  0xec, 0x00, 0xec, 0x00, 0xec, 0x00, 0xec, 0x00, 0xec, 0x00, 0xec, 0x00,
+  0xec, 0x00, 0xec, 0x00, 0xec, 0x00, 0xec, 0x00, 0xec, 0x00, 0xec, 0x00,
+  0xec, 0x00, 0xec, 0x00, 0xec, 0x00, 0xec, 0x00, 0xec, 0x00, 0xec, 0x00,
+  0xec, 0x00, 0xec, 0x00, 0xec, 0x00, 0xec, 0x00, 0xec, 0x00, 0xec, 0x00,
+  0xec, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00,
+  0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf1, 0x00, 0xf1, 0x00, 0xf1, 0x00,
+  0xf1, 0x00, 0xf1, 0x00, 0xf1, 0x00, 0xf1, 0x00, 0xf1, 0x00, 0xf1, 0x00,
+  0xf1, 0x00, 0xf1, 0x00, 0xf1, 0x00, 0xf1, 0x00, 0xf1, 0x00, 0xf1, 0x00,
+  0xf1, 0x00, 0xf1, 0x00, 0xf1, 0x00, 0xf1, 0x00, 0xf1, 0x00, 0xf1, 0x00,
+  0xf1, 0x00, 0xf1, 0x00, 0xf1, 0x00, 0xf1, 0x00, 0xf1, 0x00, 0xf1, 0x00,
+  0xf1, 0x00, 0xf1, 0x00, 0xf1, 0x00, 0xf1, 0x00, 0xf1, 0x00, 0xf2, 0x00,
+  0xf2, 0x00, 0xf2, 0x00, 0xf2, 0x00, 0xf2, 0x00, 0xf2, 0x00, 0xf2, 0x00,
+  0xf2, 0x00, 0xf2, 0x00, 0xf2, 0x00, 0xf2, 0x00, 0xf2, 0x00, 0xf2, 0x00,
+  0xf2, 0x00, 0x00, 0x00, 0x16, 0x73, 0x43, 0x65, 0x24, 0x4b, 0x7b, 0x71,
+  0x77, 0x82, 0x3c, 0xaf, 0x0b, 0x65, 0xc6, 0xae, 0xbe, 0x63, 0xd7, 0x90,
+  0xb2, 0xf9, 0xdd, 0xa8, 0x31, 0xa3, 0x68, 0x0b, 0x1a, 0x67, 0x81, 0xdb,
+  0x51, 0xdf, 0x6e, 0xb3, 0x79, 0x81, 0x97, 0x5b, 0xbe, 0x5c, 0xca, 0x5b,
+  0xdd, 0x18, 0xf3, 0x5d, 0x52, 0x2d, 0x97, 0xfa, 0xfa, 0x07, 0x07, 0x4a,
+  0xc9, 0x8b, 0xef, 0x01, 0x18, 0x3d, 0x40, 0xcb, 0x51, 0xbd, 0xf8, 0xc6,
+  0x4f, 0x26, 0x9f, 0x6d, 0x6d, 0x49, 0x23, 0x2e, 0x79, 0xd9, 0x52, 0x02,
+  0x9f, 0x9f, 0x9b, 0x6c, 0x33, 0x9b, 0x09, 0x3d, 0xb0, 0x82, 0x2c, 0x81,
+  0x0f, 0x54, 0xf7, 0x21, 0xc9, 0xae, 0x9d, 0x60, 0x15, 0xa2, 0x07, 0x19,
+  0x72, 0x78, 0x63, 0xd1, 0x8d, 0x2f, 0x35, 0x06, 0xa6, 0x70, 0xaf, 0xb1,
+  0xf0, 0x11, 0xaa, 0x5e, 0x17, 0x6b, 0xa1, 0xdb, 0x56, 0x50, 0x07, 0xc4,
+  0xef, 0xe6, 0xc8, 0x96, 0x71, 0x03, 0xa8, 0xab, 0x28, 0xe7, 0xb6, 0xd3,
+  0xf6, 0x6d, 0x09, 0x23, 0x8e, 0xab, 0x9f, 0xb6, 0xf2, 0x2a, 0x4d, 0x86,
+  0x4c, 0x2c, 0xcb, 0xdf, 0xb9, 0x5e, 0x48, 0xc1, 0x62, 0xd5, 0xac, 0xee,
+  0x7d, 0x16, 0xf0, 0x38, 0x27, 0xf1, 0x64, 0xea, 0x30, 0x9e, 0x14, 0x2c,
+  0x4c, 0x1e, 0xd1, 0xba, 0x45, 0x0a, 0x68, 0x05, 0x08, 0x34, 0xfe, 0x1e,
+  0xea, 0x14, 0x41, 0xad, 0x5a, 0xf8, 0x10, 0x51, 0x6e, 0xed, 0x5b, 0xc6,
+  0x12, 0xa1, 0xfe, 0x8a, 0x74, 0xe7, 0x31, 0xc0, 0xb6, 0x46, 0x83, 0x17,
+  0xe2, 0xe2, 0xf8, 0xb4, 0x6d, 0xff, 0x23, 0xa5, 0xbf, 0xb7, 0xf7, 0x80,
+  0xff, 0x28, 0x61, 0xb0, 0x49, 0xd3, 0x30, 0x4e, 0x12, 0x1f, 0x40, 0xe7,
+  0x6b, 0xec, 0xf2, 0xe7, 0x5b, 0x88, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x0d, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00
+};
@@ -1,5 +1,7 @@
 #pragma once
-const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
+#include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/es_dict_index.h>
+const unsigned char __espeakng_dict_es[] __attribute__((aligned((4)))) = {
   0x00, 0x04, 0x00, 0x00, 0x5d, 0xbb, 0x00, 0x00, 0x00, 0x40, 0x19, 0xf0,
   0x9f, 0x91, 0xa9, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xe2, 0x80,
   0x8d, 0xf0, 0x9f, 0x91, 0xa7, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa7,
@@ -4109,4 +4111,11 @@ const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
   0x44, 0x00, 0x24, 0x03, 0x49, 0x06, 0x27, 0x37, 0x23, 0x22, 0x00, 0x07,
   0x00
 };
-size_t __espeakng_dictlen = 49285;
+
+BackgroundAudioDictionary dict_es = {
+    "es",
+    49285,
+    __espeakng_dict_es,
+    8098,
+    __espeakng_dictindex_es
+};
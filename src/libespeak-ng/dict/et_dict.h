@@ -1,5 +1,7 @@
 #pragma once
-const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
+#include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/et_dict_index.h>
+const unsigned char __espeakng_dict_et[] __attribute__((aligned((4)))) = {
   0x00, 0x04, 0x00, 0x00, 0xa5, 0xa5, 0x00, 0x00, 0x00, 0x45, 0x19, 0xf0,
   0x9f, 0x91, 0xa9, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xe2, 0x80,
   0x8d, 0xf0, 0x9f, 0x91, 0xa7, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa7,
@@ -3690,4 +3692,11 @@ const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
   0x03, 0x42, 0x70, 0x32, 0x28, 0x5a, 0x00, 0xc5, 0xbe, 0x03, 0x5b, 0x00,
   0xc5, 0xa1, 0x03, 0x5c, 0x00, 0x07, 0x00
 };
-size_t __espeakng_dictlen = 44263;
+
+BackgroundAudioDictionary dict_et = {
+    "et",
+    44263,
+    __espeakng_dict_et,
+    7894,
+    __espeakng_dictindex_et
+};
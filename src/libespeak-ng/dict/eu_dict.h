@@ -1,5 +1,7 @@
 #pragma once
-const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
+#include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/eu_dict_index.h>
+const unsigned char __espeakng_dict_eu[] __attribute__((aligned((4)))) = {
   0x00, 0x04, 0x00, 0x00, 0xbd, 0xb7, 0x00, 0x00, 0x00, 0x49, 0x19, 0xf0,
   0x9f, 0x91, 0xa9, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xe2, 0x80,
   0x8d, 0xf0, 0x9f, 0x91, 0xa7, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa7,
@@ -4072,4 +4074,11 @@ const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
   0x00, 0xc3, 0xa7, 0x03, 0x5a, 0x00, 0xc3, 0xbc, 0x03, 0x70, 0x00, 0x07,
   0x00
 };
-size_t __espeakng_dictlen = 48841;
+
+BackgroundAudioDictionary dict_eu = {
+    "eu",
+    48841,
+    __espeakng_dict_eu,
+    7568,
+    __espeakng_dictindex_eu
+};
@@ -1,5 +1,7 @@
 #pragma once
-const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
+#include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/fa_dict_index.h>
+const unsigned char __espeakng_dict_fa[] __attribute__((aligned((4)))) = {
   0x00, 0x04, 0x00, 0x00, 0x24, 0xac, 0x03, 0x00, 0x12, 0x46, 0xc5, 0x14,
   0x94, 0x1c, 0xec, 0x00, 0x52, 0x27, 0x33, 0x59, 0x5c, 0x6c, 0x66, 0x23,
   0x31, 0x00, 0x11, 0x46, 0xc5, 0x13, 0xe2, 0x38, 0x7c, 0x00, 0x52, 0x23,
@@ -24478,4 +24480,11 @@ const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
   0x52, 0x2f, 0x23, 0x33, 0x0f, 0x39, 0x6c, 0x0c, 0x0f, 0x42, 0x04, 0x27,
   0x5a, 0x6c, 0x55, 0x25, 0x00, 0x07, 0x00
 };
-size_t __espeakng_dictlen = 293719;
+
+BackgroundAudioDictionary dict_fa = {
+    "fa",
+    293719,
+    __espeakng_dict_fa,
+    46882,
+    __espeakng_dictindex_fa
+};
@@ -0,0 +1,3910 @@
+#pragma once
+const unsigned char __espeakng_dictindex_fa[] __attribute__((aligned((4)))) = {
+  0x45, 0x44, 0x58, 0x31, 0x57, 0x7b, 0x04, 0x00, 0x24, 0xac, 0x03, 0x00,
+  0x5a, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x1c, 0x00, 0x31, 0x00,
+  0x3f, 0x00, 0x4a, 0x00, 0x52, 0x00, 0x5d, 0x00, 0x69, 0x00, 0x74, 0x00,
+  0x7a, 0x00, 0x89, 0x00, 0x95, 0x00, 0x98, 0x00, 0xa9, 0x00, 0xb4, 0x00,
+  0xc2, 0x00, 0xcc, 0x00, 0xd6, 0x00, 0xe2, 0x00, 0xfb, 0x00, 0x15, 0x01,
+  0x33, 0x01, 0x44, 0x01, 0x50, 0x01, 0x5c, 0x01, 0x68, 0x01, 0x77, 0x01,
+  0x84, 0x01, 0x91, 0x01, 0xa1, 0x01, 0xb0, 0x01, 0xc1, 0x01, 0xd4, 0x01,
+  0xef, 0x01, 0xf7, 0x01, 0x10, 0x02, 0x17, 0x02, 0x2e, 0x02, 0x3c, 0x02,
+  0x44, 0x02, 0x58, 0x02, 0x60, 0x02, 0x74, 0x02, 0x80, 0x02, 0x8e, 0x02,
+  0x96, 0x02, 0xab, 0x02, 0xbb, 0x02, 0xc8, 0x02, 0xd8, 0x02, 0xe4, 0x02,
+  0x02, 0x03, 0x0a, 0x03, 0x1c, 0x03, 0x27, 0x03, 0x3a, 0x03, 0x4b, 0x03,
+  0x56, 0x03, 0x64, 0x03, 0x7c, 0x03, 0x89, 0x03, 0x96, 0x03, 0xac, 0x03,
+  0xb3, 0x03, 0xc8, 0x03, 0xe0, 0x03, 0xef, 0x03, 0xfe, 0x03, 0x02, 0x04,
+  0x11, 0x04, 0x18, 0x04, 0x22, 0x04, 0x32, 0x04, 0x39, 0x04, 0x56, 0x04,
+  0x64, 0x04, 0x79, 0x04, 0x84, 0x04, 0x88, 0x04, 0x93, 0x04, 0x9b, 0x04,
+  0xae, 0x04, 0xbb, 0x04, 0xd4, 0x04, 0xe8, 0x04, 0x07, 0x05, 0x18, 0x05,
+  0x26, 0x05, 0x37, 0x05, 0x46, 0x05, 0x60, 0x05, 0x6b, 0x05, 0x79, 0x05,
+  0x81, 0x05, 0x8d, 0x05, 0x9d, 0x05, 0xaa, 0x05, 0xc3, 0x05, 0xce, 0x05,
+  0xdd, 0x05, 0xea, 0x05, 0xf8, 0x05, 0x01, 0x06, 0x10, 0x06, 0x1c, 0x06,
+  0x22, 0x06, 0x3b, 0x06, 0x46, 0x06, 0x5b, 0x06, 0x6b, 0x06, 0x76, 0x06,
+  0x83, 0x06, 0x8e, 0x06, 0xa4, 0x06, 0xba, 0x06, 0xd0, 0x06, 0xeb, 0x06,
+  0x04, 0x07, 0x15, 0x07, 0x22, 0x07, 0x2b, 0x07, 0x3f, 0x07, 0x50, 0x07,
+  0x64, 0x07, 0x6e, 0x07, 0x7e, 0x07, 0x8f, 0x07, 0x9d, 0x07, 0xa4, 0x07,
+  0xb3, 0x07, 0xbb, 0x07, 0xcb, 0x07, 0xd4, 0x07, 0xde, 0x07, 0xea, 0x07,
+  0xf4, 0x07, 0xff, 0x07, 0x02, 0x08, 0x11, 0x08, 0x1e, 0x08, 0x2f, 0x08,
+  0x34, 0x08, 0x41, 0x08, 0x4c, 0x08, 0x59, 0x08, 0x67, 0x08, 0x6d, 0x08,
+  0x83, 0x08, 0x8f, 0x08, 0xac, 0x08, 0xc5, 0x08, 0xd6, 0x08, 0xfd, 0x08,
+  0x0c, 0x09, 0x19, 0x09, 0x28, 0x09, 0x30, 0x09, 0x40, 0x09, 0x53, 0x09,
+  0x5f, 0x09, 0x64, 0x09, 0x72, 0x09, 0x7b, 0x09, 0x89, 0x09, 0x8e, 0x09,
+  0x99, 0x09, 0xa5, 0x09, 0xb1, 0x09, 0xb8, 0x09, 0xbe, 0x09, 0xca, 0x09,
+  0xcf, 0x09, 0xd3, 0x09, 0xdb, 0x09, 0xe6, 0x09, 0xfa, 0x09, 0x07, 0x0a,
+  0x13, 0x0a, 0x22, 0x0a, 0x33, 0x0a, 0x3d, 0x0a, 0x55, 0x0a, 0x6c, 0x0a,
+  0x82, 0x0a, 0xab, 0x0a, 0xc4, 0x0a, 0xd1, 0x0a, 0xe5, 0x0a, 0xea, 0x0a,
+  0xfe, 0x0a, 0x09, 0x0b, 0x1a, 0x0b, 0x23, 0x0b, 0x2b, 0x0b, 0x34, 0x0b,
+  0x46, 0x0b, 0x4e, 0x0b, 0x5a, 0x0b, 0x65, 0x0b, 0x6b, 0x0b, 0x77, 0x0b,
+  0x78, 0x0b, 0x81, 0x0b, 0x88, 0x0b, 0x8c, 0x0b, 0x95, 0x0b, 0x9d, 0x0b,
+  0xaa, 0x0b, 0xb9, 0x0b, 0xcc, 0x0b, 0xd8, 0x0b, 0xec, 0x0b, 0x0c, 0x0c,
+  0x20, 0x0c, 0x33, 0x0c, 0x47, 0x0c, 0x58, 0x0c, 0x68, 0x0c, 0x79, 0x0c,
+  0x97, 0x0c, 0xaa, 0x0c, 0xbd, 0x0c, 0xc7, 0x0c, 0xd2, 0x0c, 0xe1, 0x0c,
+  0xf0, 0x0c, 0xf8, 0x0c, 0xfe, 0x0c, 0x0a, 0x0d, 0x0e, 0x0d, 0x1b, 0x0d,
+  0x23, 0x0d, 0x29, 0x0d, 0x2f, 0x0d, 0x3d, 0x0d, 0x40, 0x0d, 0x4a, 0x0d,
+  0x54, 0x0d, 0x5b, 0x0d, 0x63, 0x0d, 0x6f, 0x0d, 0x7f, 0x0d, 0x92, 0x0d,
+  0xba, 0x0d, 0xd1, 0x0d, 0xed, 0x0d, 0x02, 0x0e, 0x20, 0x0e, 0x31, 0x0e,
+  0x53, 0x0e, 0x66, 0x0e, 0x81, 0x0e, 0x90, 0x0e, 0xa4, 0x0e, 0xb6, 0x0e,
+  0xce, 0x0e, 0xd5, 0x0e, 0xe2, 0x0e, 0xef, 0x0e, 0xf9, 0x0e, 0x02, 0x0f,
+  0x09, 0x0f, 0x18, 0x0f, 0x1f, 0x0f, 0x29, 0x0f, 0x31, 0x0f, 0x38, 0x0f,
+  0x44, 0x0f, 0x4e, 0x0f, 0x53, 0x0f, 0x5f, 0x0f, 0x68, 0x0f, 0x79, 0x0f,
+  0x88, 0x0f, 0xa1, 0x0f, 0xae, 0x0f, 0xc8, 0x0f, 0xe6, 0x0f, 0x07, 0x10,
+  0x26, 0x10, 0x45, 0x10, 0x7a, 0x10, 0x91, 0x10, 0xa9, 0x10, 0xc0, 0x10,
+  0xcd, 0x10, 0xe7, 0x10, 0xfd, 0x10, 0x06, 0x11, 0x19, 0x11, 0x26, 0x11,
+  0x34, 0x11, 0x3c, 0x11, 0x4b, 0x11, 0x59, 0x11, 0x6d, 0x11, 0x79, 0x11,
+  0x86, 0x11, 0x99, 0x11, 0xa0, 0x11, 0xa3, 0x11, 0xab, 0x11, 0xc1, 0x11,
+  0xcb, 0x11, 0xd6, 0x11, 0xde, 0x11, 0xf1, 0x11, 0x03, 0x12, 0x22, 0x12,
+  0x36, 0x12, 0x53, 0x12, 0x67, 0x12, 0x7b, 0x12, 0xab, 0x12, 0xb8, 0x12,
+  0xc3, 0x12, 0xce, 0x12, 0xdd, 0x12, 0xf0, 0x12, 0x01, 0x13, 0x0c, 0x13,
+  0x1a, 0x13, 0x28, 0x13, 0x31, 0x13, 0x35, 0x13, 0x3c, 0x13, 0x44, 0x13,
+  0x4f, 0x13, 0x55, 0x13, 0x5c, 0x13, 0x65, 0x13, 0x6d, 0x13, 0x73, 0x13,
+  0x73, 0x13, 0x86, 0x13, 0x8c, 0x13, 0x94, 0x13, 0x9d, 0x13, 0xb2, 0x13,
+  0xc9, 0x13, 0xdc, 0x13, 0xf7, 0x13, 0x0d, 0x14, 0x29, 0x14, 0x40, 0x14,
+  0x69, 0x14, 0x8a, 0x14, 0x9b, 0x14, 0xb1, 0x14, 0xbf, 0x14, 0xd2, 0x14,
+  0xdf, 0x14, 0xe3, 0x14, 0xef, 0x14, 0xf3, 0x14, 0xfc, 0x14, 0xff, 0x14,
+  0x0e, 0x15, 0x16, 0x15, 0x21, 0x15, 0x2a, 0x15, 0x32, 0x15, 0x39, 0x15,
+  0x41, 0x15, 0x45, 0x15, 0x4b, 0x15, 0x55, 0x15, 0x58, 0x15, 0x64, 0x15,
+  0x72, 0x15, 0x89, 0x15, 0x98, 0x15, 0xac, 0x15, 0xcf, 0x15, 0xe1, 0x15,
+  0xf9, 0x15, 0x16, 0x16, 0x26, 0x16, 0x44, 0x16, 0x4d, 0x16, 0x64, 0x16,
+  0x73, 0x16, 0x86, 0x16, 0x8c, 0x16, 0x8f, 0x16, 0x97, 0x16, 0x9d, 0x16,
+  0xa4, 0x16, 0xad, 0x16, 0xb8, 0x16, 0xc1, 0x16, 0xc7, 0x16, 0xc8, 0x16,
+  0xd7, 0x16, 0xe0, 0x16, 0xe9, 0x16, 0xeb, 0x16, 0xf5, 0x16, 0x00, 0x17,
+  0x09, 0x17, 0x10, 0x17, 0x15, 0x17, 0x23, 0x17, 0x2e, 0x17, 0x3f, 0x17,
+  0x4f, 0x17, 0x65, 0x17, 0x72, 0x17, 0x88, 0x17, 0x92, 0x17, 0x98, 0x17,
+  0xa5, 0x17, 0xbd, 0x17, 0xcc, 0x17, 0xe0, 0x17, 0xec, 0x17, 0xfa, 0x17,
+  0x00, 0x18, 0x08, 0x18, 0x15, 0x18, 0x21, 0x18, 0x2a, 0x18, 0x34, 0x18,
+  0x3d, 0x18, 0x43, 0x18, 0x4d, 0x18, 0x57, 0x18, 0x5f, 0x18, 0x66, 0x18,
+  0x6c, 0x18, 0x7e, 0x18, 0x86, 0x18, 0x91, 0x18, 0x9b, 0x18, 0xad, 0x18,
+  0xb7, 0x18, 0xcb, 0x18, 0xdd, 0x18, 0xf0, 0x18, 0x03, 0x19, 0x20, 0x19,
+  0x34, 0x19, 0x4c, 0x19, 0x57, 0x19, 0x6c, 0x19, 0x73, 0x19, 0x80, 0x19,
+  0x8a, 0x19, 0x92, 0x19, 0x98, 0x19, 0xa1, 0x19, 0xad, 0x19, 0xb0, 0x19,
+  0xb8, 0x19, 0xbf, 0x19, 0xc7, 0x19, 0xcc, 0x19, 0xd2, 0x19, 0xdb, 0x19,
+  0xe0, 0x19, 0xe8, 0x19, 0xf0, 0x19, 0xfc, 0x19, 0x07, 0x1a, 0x0f, 0x1a,
+  0x1d, 0x1a, 0x28, 0x1a, 0x37, 0x1a, 0x3f, 0x1a, 0x52, 0x1a, 0x5f, 0x1a,
+  0x6f, 0x1a, 0x82, 0x1a, 0x8d, 0x1a, 0x9b, 0x1a, 0x9e, 0x1a, 0xa9, 0x1a,
+  0xb2, 0x1a, 0xbc, 0x1a, 0xc8, 0x1a, 0xcd, 0x1a, 0xd6, 0x1a, 0xdd, 0x1a,
+  0xe8, 0x1a, 0xee, 0x1a, 0xf5, 0x1a, 0xfe, 0x1a, 0x07, 0x1b, 0x10, 0x1b,
+  0x19, 0x1b, 0x21, 0x1b, 0x28, 0x1b, 0x2f, 0x1b, 0x38, 0x1b, 0x48, 0x1b,
+  0x57, 0x1b, 0x6a, 0x1b, 0x76, 0x1b, 0x85, 0x1b, 0x92, 0x1b, 0xaa, 0x1b,
+  0xb4, 0x1b, 0xd6, 0x1b, 0xe8, 0x1b, 0x00, 0x1c, 0x11, 0x1c, 0x2a, 0x1c,
+  0x36, 0x1c, 0x43, 0x1c, 0x53, 0x1c, 0x61, 0x1c, 0x6b, 0x1c, 0x71, 0x1c,
+  0x7a, 0x1c, 0x80, 0x1c, 0x8b, 0x1c, 0x92, 0x1c, 0x96, 0x1c, 0x9a, 0x1c,
+  0xa0, 0x1c, 0xa8, 0x1c, 0xb1, 0x1c, 0xb7, 0x1c, 0xba, 0x1c, 0xc1, 0x1c,
+  0xcb, 0x1c, 0xd2, 0x1c, 0xdf, 0x1c, 0xeb, 0x1c, 0xf7, 0x1c, 0x0c, 0x1d,
+  0x1c, 0x1d, 0x2a, 0x1d, 0x4b, 0x1d, 0x58, 0x1d, 0x70, 0x1d, 0x7c, 0x1d,
+  0x90, 0x1d, 0x98, 0x1d, 0xb1, 0x1d, 0xbb, 0x1d, 0xc7, 0x1d, 0xd0, 0x1d,
+  0xdf, 0x1d, 0xf1, 0x1d, 0xf7, 0x1d, 0x0a, 0x1e, 0x12, 0x1e, 0x1c, 0x1e,
+  0x23, 0x1e, 0x2a, 0x1e, 0x31, 0x1e, 0x35, 0x1e, 0x43, 0x1e, 0x45, 0x1e,
+  0x53, 0x1e, 0x5a, 0x1e, 0x62, 0x1e, 0x68, 0x1e, 0x75, 0x1e, 0x83, 0x1e,
+  0x98, 0x1e, 0xab, 0x1e, 0xbd, 0x1e, 0xd0, 0x1e, 0xec, 0x1e, 0xf4, 0x1e,
+  0x0e, 0x1f, 0x1b, 0x1f, 0x30, 0x1f, 0x3f, 0x1f, 0x4c, 0x1f, 0x52, 0x1f,
+  0x5d, 0x1f, 0x65, 0x1f, 0x75, 0x1f, 0x8a, 0x1f, 0x90, 0x1f, 0x96, 0x1f,
+  0xa1, 0x1f, 0xb0, 0x1f, 0xb5, 0x1f, 0xbe, 0x1f, 0xc8, 0x1f, 0xcf, 0x1f,
+  0xd9, 0x1f, 0xdc, 0x1f, 0xe4, 0x1f, 0xeb, 0x1f, 0xf5, 0x1f, 0xfb, 0x1f,
+  0x08, 0x20, 0x15, 0x20, 0x20, 0x20, 0x2b, 0x20, 0x3d, 0x20, 0x50, 0x20,
+  0x5e, 0x20, 0x6c, 0x20, 0x89, 0x20, 0x94, 0x20, 0xa5, 0x20, 0xad, 0x20,
+  0xbc, 0x20, 0xc3, 0x20, 0xcf, 0x20, 0xda, 0x20, 0xe7, 0x20, 0xf8, 0x20,
+  0x05, 0x21, 0x11, 0x21, 0x18, 0x21, 0x27, 0x21, 0x2c, 0x21, 0x31, 0x21,
+  0x33, 0x21, 0x3a, 0x21, 0x3c, 0x21, 0x3e, 0x21, 0x45, 0x21, 0x4b, 0x21,
+  0x4f, 0x21, 0x61, 0x21, 0x77, 0x21, 0x8f, 0x21, 0x96, 0x21, 0xa3, 0x21,
+  0xb2, 0x21, 0xc5, 0x21, 0xd9, 0x21, 0xe2, 0x21, 0xf7, 0x21, 0x00, 0x22,
+  0x20, 0x22, 0x27, 0x22, 0x41, 0x22, 0x48, 0x22, 0x57, 0x22, 0x61, 0x22,
+  0x75, 0x22, 0x84, 0x22, 0x8d, 0x22, 0xa7, 0x22, 0xae, 0x22, 0xc7, 0x22,
+  0xcf, 0x22, 0xd7, 0x22, 0xdf, 0x22, 0xe6, 0x22, 0xec, 0x22, 0xf6, 0x22,
+  0xfe, 0x22, 0x02, 0x23, 0x07, 0x23, 0x0f, 0x23, 0x1f, 0x23, 0x2c, 0x23,
+  0x3b, 0x23, 0x5a, 0x23, 0x67, 0x23, 0x79, 0x23, 0x93, 0x23, 0xa6, 0x23,
+  0xbc, 0x23, 0xcb, 0x23, 0xd8, 0x23, 0xe7, 0x23, 0xfb, 0x23, 0x02, 0x24,
+  0x0a, 0x24, 0x17, 0x24, 0x2a, 0x24, 0x39, 0x24, 0x47, 0x24, 0x51, 0x24,
+  0x5e, 0x24, 0x70, 0x24, 0x80, 0x24, 0x89, 0x24, 0x97, 0x24, 0xa2, 0x24,
+  0xb0, 0x24, 0xb3, 0x24, 0xc1, 0x24, 0xcb, 0x24, 0xd5, 0x24, 0xda, 0x24,
+  0xe7, 0x24, 0xff, 0x24, 0x0f, 0x25, 0x21, 0x25, 0x33, 0x25, 0x58, 0x25,
+  0x6c, 0x25, 0x82, 0x25, 0x9e, 0x25, 0xab, 0x25, 0xc4, 0x25, 0xd7, 0x25,
+  0xf0, 0x25, 0xfd, 0x25, 0x10, 0x26, 0x16, 0x26, 0x22, 0x26, 0x2f, 0x26,
+  0x3f, 0x26, 0x48, 0x26, 0x5a, 0x26, 0x66, 0x26, 0x72, 0x26, 0x84, 0x26,
+  0x94, 0x26, 0xa0, 0x26, 0xa9, 0x26, 0xb1, 0x26, 0xbc, 0x26, 0xca, 0x26,
+  0xdb, 0x26, 0xe5, 0x26, 0xf6, 0x26, 0x08, 0x27, 0x16, 0x27, 0x2a, 0x27,
+  0x3c, 0x27, 0x51, 0x27, 0x6e, 0x27, 0x8f, 0x27, 0xa5, 0x27, 0xb9, 0x27,
+  0xcf, 0x27, 0xe3, 0x27, 0xfc, 0x27, 0x07, 0x28, 0x12, 0x28, 0x24, 0x28,
+  0x39, 0x28, 0x4b, 0x28, 0x5b, 0x28, 0x6e, 0x28, 0x7c, 0x28, 0x8e, 0x28,
+  0x9f, 0x28, 0xb1, 0x28, 0xbd, 0x28, 0xcd, 0x28, 0xd6, 0x28, 0xe1, 0x28,
+  0xef, 0x28, 0x00, 0x29, 0x0d, 0x29, 0x17, 0x29, 0x2c, 0x29, 0x42, 0x29,
+  0x52, 0x29, 0x66, 0x29, 0x7c, 0x29, 0x8f, 0x29, 0xa3, 0x29, 0xc1, 0x29,
+  0xda, 0x29, 0xf2, 0x29, 0x0b, 0x2a, 0x16, 0x2a, 0x2c, 0x2a, 0x3d, 0x2a,
+  0x51, 0x2a, 0x61, 0x2a, 0x72, 0x2a, 0x81, 0x2a, 0x8d, 0x2a, 0xa4, 0x2a,
+  0xb5, 0x2a, 0xc5, 0x2a, 0xcf, 0x2a, 0xdb, 0x2a, 0xe2, 0x2a, 0xee, 0x2a,
+  0xf5, 0x2a, 0x02, 0x2b, 0x0b, 0x2b, 0x24, 0x2b, 0x2f, 0x2b, 0x41, 0x2b,
+  0x4e, 0x2b, 0x6d, 0x2b, 0x7b, 0x2b, 0x8f, 0x2b, 0xaa, 0x2b, 0xc8, 0x2b,
+  0xdc, 0x2b, 0xf2, 0x2b, 0x02, 0x2c, 0x1c, 0x2c, 0x2e, 0x2c, 0x3d, 0x2c,
+  0x47, 0x2c, 0x5b, 0x2c, 0x69, 0x2c, 0x7b, 0x2c, 0x91, 0x2c, 0x9d, 0x2c,
+  0xaa, 0x2c, 0xb7, 0x2c, 0xc4, 0x2c, 0xd1, 0x2c, 0xdf, 0x2c, 0xe5, 0x2c,
+  0xed, 0x2c, 0xf3, 0x2c, 0xfb, 0x2c, 0x00, 0x2d, 0x08, 0x2d, 0x12, 0x2d,
+  0x1a, 0x2d, 0x25, 0x2d, 0x2f, 0x2d, 0x42, 0x2d, 0x52, 0x2d, 0x5f, 0x2d,
+  0x6b, 0x2d, 0x85, 0x2d, 0x94, 0x2d, 0xab, 0x2d, 0xb8, 0x2d, 0xcf, 0x2d,
+  0xda, 0x2d, 0xf1, 0x2d, 0xfb, 0x2d, 0x0f, 0x2e, 0x20, 0x2e, 0x2b, 0x2e,
+  0x3c, 0x2e, 0x4b, 0x2e, 0x55, 0x2e, 0x5f, 0x2e, 0x6b, 0x2e, 0x72, 0x2e,
+  0x80, 0x2e, 0x8a, 0x2e, 0x91, 0x2e, 0x96, 0x2e, 0x9a, 0x2e, 0xa1, 0x2e,
+  0xa4, 0x2e, 0xab, 0x2e, 0xb6, 0x2e, 0xbe, 0x2e, 0xc3, 0x2e, 0xd1, 0x2e,
+  0xe2, 0x2e, 0xf2, 0x2e, 0x05, 0x2f, 0x1a, 0x2f, 0x27, 0x2f, 0x41, 0x2f,
+  0x54, 0x2f, 0x71, 0x2f, 0x7d, 0x2f, 0x97, 0x2f, 0xa1, 0x2f, 0xbc, 0x2f,
+  0xc5, 0x2f, 0xd6, 0x2f, 0xe4, 0x2f, 0xee, 0x2f, 0x01, 0x30, 0x0e, 0x30,
+  0x20, 0x30, 0x2c, 0x30, 0x42, 0x30, 0x4e, 0x30, 0x56, 0x30, 0x61, 0x30,
+  0x6f, 0x30, 0x73, 0x30, 0x7a, 0x30, 0x81, 0x30, 0x87, 0x30, 0x95, 0x30,
+  0x9f, 0x30, 0xac, 0x30, 0xbf, 0x30, 0xcc, 0x30, 0xdd, 0x30, 0xfb, 0x30,
+  0x15, 0x31, 0x2e, 0x31, 0x4c, 0x31, 0x6b, 0x31, 0x7c, 0x31, 0x96, 0x31,
+  0xae, 0x31, 0xbb, 0x31, 0xca, 0x31, 0xd9, 0x31, 0xe8, 0x31, 0xf9, 0x31,
+  0x10, 0x32, 0x15, 0x32, 0x24, 0x32, 0x31, 0x32, 0x42, 0x32, 0x59, 0x32,
+  0x66, 0x32, 0x76, 0x32, 0x81, 0x32, 0x8b, 0x32, 0x9a, 0x32, 0xad, 0x32,
+  0xb5, 0x32, 0xc9, 0x32, 0xd8, 0x32, 0xeb, 0x32, 0x10, 0x33, 0x2a, 0x33,
+  0x5a, 0x33, 0x7a, 0x33, 0x94, 0x33, 0xb5, 0x33, 0xd2, 0x33, 0xf9, 0x33,
+  0x1f, 0x34, 0x37, 0x34, 0x4a, 0x34, 0x69, 0x34, 0x79, 0x34, 0x96, 0x34,
+  0xa5, 0x34, 0xbc, 0x34, 0xd1, 0x34, 0xdf, 0x34, 0xee, 0x34, 0xfc, 0x34,
+  0x07, 0x35, 0x0f, 0x35, 0x18, 0x35, 0x28, 0x35, 0x33, 0x35, 0x3b, 0x35,
+  0x45, 0x35, 0x53, 0x35, 0x5d, 0x35, 0x6b, 0x35, 0x71, 0x35, 0x7b, 0x35,
+  0x87, 0x35, 0x9b, 0x35, 0xc4, 0x35, 0xd8, 0x35, 0xf1, 0x35, 0x07, 0x36,
+  0x23, 0x36, 0x37, 0x36, 0x55, 0x36, 0x67, 0x36, 0x7a, 0x36, 0x99, 0x36,
+  0xa2, 0x36, 0xb9, 0x36, 0xcb, 0x36, 0xe5, 0x36, 0xf0, 0x36, 0x02, 0x37,
+  0x0e, 0x37, 0x1c, 0x37, 0x26, 0x37, 0x31, 0x37, 0x40, 0x37, 0x4b, 0x37,
+  0x58, 0x37, 0x5c, 0x37, 0x62, 0x37, 0x6a, 0x37, 0x6f, 0x37, 0x75, 0x37,
+  0x7a, 0x37, 0x8c, 0x37, 0x9e, 0x37, 0xb5, 0x37, 0xc8, 0x37, 0xda, 0x37,
+  0xf0, 0x37, 0x06, 0x38, 0x20, 0x38, 0x2d, 0x38, 0x3e, 0x38, 0x48, 0x38,
+  0x51, 0x38, 0x5e, 0x38, 0x73, 0x38, 0x88, 0x38, 0x8d, 0x38, 0xa1, 0x38,
+  0xac, 0x38, 0xbc, 0x38, 0xce, 0x38, 0xd5, 0x38, 0xe1, 0x38, 0xe8, 0x38,
+  0xf8, 0x38, 0x02, 0x39, 0x08, 0x39, 0x0d, 0x39, 0x1b, 0x39, 0x21, 0x39,
+  0x27, 0x39, 0x3b, 0x39, 0x44, 0x39, 0x54, 0x39, 0x62, 0x39, 0x6e, 0x39,
+  0x89, 0x39, 0x96, 0x39, 0xad, 0x39, 0xc1, 0x39, 0xda, 0x39, 0xf5, 0x39,
+  0xff, 0x39, 0x15, 0x3a, 0x28, 0x3a, 0x31, 0x3a, 0x42, 0x3a, 0x4f, 0x3a,
+  0x5a, 0x3a, 0x00, 0x00, 0xf8, 0x32, 0xad, 0xe3, 0x00, 0xad, 0x6c, 0x82,
+  0xd0, 0xc4, 0x02, 0x33, 0x40, 0x9e, 0xf4, 0xc4, 0x8c, 0x02, 0x63, 0xd6,
+  0x89, 0xc4, 0x4c, 0x0a, 0xe4, 0xe5, 0x1c, 0x0f, 0x31, 0x3e, 0xc6, 0x70,
+  0x35, 0x0b, 0xa9, 0x17, 0x69, 0xc0, 0x43, 0x6a, 0x93, 0xe4, 0x86, 0xff,
+  0x4a, 0x27, 0x39, 0x2f, 0x91, 0x7d, 0x1e, 0x5c, 0xeb, 0x94, 0x55, 0xa6,
+  0x1c, 0x9a, 0xde, 0x7f, 0xd5, 0xa8, 0x3c, 0xd6, 0x75, 0xd0, 0xd8, 0x68,
+  0x0b, 0x28, 0xe0, 0x9d, 0x96, 0x0b, 0x16, 0x25, 0x99, 0xc5, 0x7e, 0x39,
+  0x0b, 0xe1, 0xb1, 0xf9, 0x71, 0x3f, 0x7a, 0x43, 0x00, 0x33, 0xfc, 0x21,
+  0x80, 0x26, 0x40, 0x3f, 0x19, 0x09, 0x94, 0x95, 0xc2, 0x03, 0xe6, 0xfe,
+  0xd3, 0x29, 0xfa, 0x51, 0x9c, 0x3c, 0x6e, 0xbb, 0x97, 0x5c, 0x75, 0x12,
+  0xe4, 0xf5, 0xea, 0xcd, 0xf7, 0x6c, 0xc4, 0x06, 0x26, 0x6a, 0x4d, 0x15,
+  0xce, 0xdd, 0x09, 0x4c, 0x3b, 0x02, 0xa3, 0x2b, 0x6b, 0x51, 0x5b, 0xd7,
+  0x1a, 0x5a, 0x79, 0x95, 0xad, 0x58, 0xb5, 0x0f, 0x94, 0xab, 0xf4, 0xe8,
+  0x86, 0xaa, 0x56, 0x97, 0x45, 0xc9, 0xce, 0xf0, 0x45, 0x71, 0xdf, 0x67,
+  0x5c, 0x60, 0xf7, 0xd4, 0x13, 0x5f, 0x29, 0x72, 0xea, 0x7c, 0x18, 0xac,
+  0x81, 0x86, 0xa0, 0xae, 0x3a, 0xd3, 0xe8, 0x50, 0x36, 0x28, 0xf9, 0x88,
+  0x16, 0xe0, 0x8b, 0xc6, 0x47, 0xad, 0xab, 0xdf, 0x32, 0xd0, 0x83, 0xc5,
+  0x02, 0xa1, 0x16, 0x19, 0xc4, 0x4e, 0xa2, 0xf2, 0xef, 0x41, 0xcb, 0x8b,
+  0xbd, 0xc2, 0x64, 0x4e, 0xd7, 0x43, 0x86, 0x96, 0xcd, 0xc0, 0xb4, 0x12,
+  0xf2, 0x10, 0x2b, 0xe5, 0x74, 0x6d, 0xd0, 0x87, 0xa5, 0x4c, 0x9e, 0x44,
+  0x89, 0xc4, 0x40, 0xd2, 0x2a, 0x52, 0xcb, 0x35, 0x4e, 0x22, 0xf4, 0xcc,
+  0x8e, 0xe6, 0xfe, 0xb2, 0x48, 0xaa, 0xb1, 0xd0, 0x50, 0x88, 0xa8, 0xa7,
+  0xbc, 0xa1, 0x9a, 0x37, 0x2e, 0xab, 0x50, 0x42, 0x47, 0x85, 0xe3, 0x51,
+  0xb6, 0x6d, 0xdd, 0x71, 0x65, 0xfe, 0x4a, 0x6d, 0x98, 0xd5, 0x63, 0x7f,
+  0x40, 0xeb, 0x59, 0x41, 0x0d, 0xdd, 0x34, 0x7e, 0xe2, 0xce, 0xaf, 0x68,
+  0x65, 0x2f, 0x3d, 0x62, 0xca, 0xba, 0x12, 0x66, 0x3d, 0xc2, 0x60, 0xab,
+  0xa0, 0x2c, 0xf5, 0x55, 0x69, 0x5a, 0x70, 0x11, 0x11, 0xf4, 0xb7, 0xdf,
+  0x5f, 0x1d, 0x29, 0xb8, 0xa2, 0x17, 0x84, 0xea, 0x59, 0xce, 0x0b, 0x6b,
+  0xfa, 0xdc, 0x41, 0x22, 0xc4, 0x45, 0x3e, 0x5b, 0x21, 0x80, 0xcc, 0xeb,
+  0x42, 0x1f, 0xa8, 0xb6, 0x0b, 0xa2, 0xed, 0x5b, 0x8c, 0x70, 0x8c, 0x35,
+  0xc1, 0xdb, 0x6a, 0x39, 0xe3, 0x2e, 0x9a, 0xe3, 0x5f, 0x59, 0x11, 0xf2,
+  0x5b, 0x0d, 0x2a, 0x64, 0x70, 0x69, 0xc4, 0x7f, 0x41, 0xf9, 0x8d, 0xd7,
+  0x30, 0xd9, 0xe9, 0x34, 0xe5, 0xe4, 0x5f, 0xed, 0x82, 0xb4, 0x77, 0x9e,
+  0x7e, 0x80, 0xac, 0xa7, 0x85, 0x62, 0xb1, 0x4b, 0xd9, 0xfe, 0xba, 0x63,
+  0xd7, 0xb8, 0x87, 0x17, 0x36, 0xfa, 0x45, 0x86, 0x9a, 0x26, 0x85, 0x17,
+  0xa2, 0xae, 0xa1, 0xf2, 0x56, 0xda, 0x7b, 0xfb, 0x4d, 0xcd, 0x54, 0xf2,
+  0x9d, 0x6d, 0xd7, 0xd1, 0x2e, 0x12, 0x9c, 0x08, 0xe9, 0x30, 0xca, 0x3a,
+  0xb7, 0xb3, 0x11, 0xbb, 0xf3, 0x50, 0x19, 0x65, 0xd8, 0x71, 0x23, 0xaa,
+  0x55, 0x46, 0x99, 0x6e, 0xaf, 0x0b, 0xa5, 0x94, 0xa2, 0x12, 0x5c, 0x73,
+  0xe8, 0xb0, 0xcb, 0x85, 0x5e, 0x62, 0xf6, 0x7f, 0x10, 0xd2, 0xab, 0xbb,
+  0x82, 0x1d, 0x7b, 0x6c, 0x02, 0xc0, 0xa4, 0x97, 0xec, 0xb7, 0x7c, 0xa3,
+  0x18, 0x6a, 0x6a, 0x21, 0x70, 0x66, 0xf4, 0xa6, 0x86, 0x22, 0x7a, 0xe6,
+  0x02, 0x88, 0x7e, 0xb1, 0x55, 0xe5, 0x5c, 0xc1, 0x69, 0x3e, 0x21, 0xdf,
+  0xf7, 0xd8, 0xa5, 0xa7, 0x2f, 0xf4, 0x40, 0x0d, 0x8c, 0x81, 0x79, 0xd1,
+  0x30, 0xcd, 0xd8, 0x22, 0x20, 0x7f, 0xca, 0x04, 0xbb, 0x29, 0x08, 0xe5,
+  0x04, 0x60, 0xea, 0xea, 0x79, 0xb3, 0x42, 0x29, 0xa9, 0x02, 0x64, 0xb8,
+  0xed, 0xc6, 0xb0, 0xb7, 0x13, 0x97, 0x74, 0x1c, 0xa4, 0x42, 0xad, 0x02,
+  0xfe, 0x23, 0xe3, 0x47, 0xb2, 0x72, 0x84, 0x9a, 0xac, 0x91, 0x6a, 0x3c,
+  0xb9, 0xe8, 0x3b, 0x63, 0xbc, 0x78, 0x6c, 0xdb, 0xa5, 0xcc, 0x70, 0xea,
+  0xc8, 0x20, 0xa7, 0xa5, 0x10, 0x63, 0x3a, 0x12, 0x23, 0x7d, 0xcf, 0x5f,
+  0xff, 0xf7, 0x29, 0x38, 0x18, 0x43, 0x9c, 0x30, 0x50, 0x7d, 0xfa, 0x50,
+  0x78, 0xc3, 0x5c, 0xa0, 0x6b, 0x47, 0x27, 0xae, 0xf2, 0xdc, 0x23, 0x44,
+  0x70, 0xcb, 0x20, 0xd9, 0x9e, 0x9d, 0xdd, 0xaa, 0x4e, 0x47, 0xc4, 0xba,
+  0x53, 0xfc, 0x60, 0x99, 0x98, 0xf3, 0xa0, 0x65, 0xee, 0x08, 0x3f, 0x67,
+  0xdc, 0xf3, 0x75, 0x5b, 0x73, 0x54, 0x23, 0xff, 0x7a, 0x6f, 0xef, 0x6e,
+  0x4e, 0x4b, 0x24, 0xb3, 0xa4, 0xd9, 0x53, 0x7c, 0x36, 0x72, 0x26, 0x6d,
+  0xec, 0xcc, 0x62, 0x11, 0xb9, 0xe0, 0x3d, 0x50, 0x31, 0x39, 0xfa, 0xa9,
+  0xde, 0x2d, 0xf3, 0xf6, 0x34, 0x0c, 0xde, 0xff, 0xf4, 0xc2, 0xbb, 0x3f,
+  0x9d, 0x42, 0xa1, 0x5e, 0x7f, 0x49, 0x33, 0xd6, 0x48, 0xfb, 0x3c, 0x46,
+  0x1c, 0xef, 0xf6, 0x69, 0x04, 0x9b, 0xd6, 0xeb, 0x1d, 0x62, 0x92, 0xaf,
+  0x51, 0xa8, 0x7d, 0x28, 0x56, 0x2d, 0xc6, 0x9b, 0x0b, 0x66, 0x02, 0x10,
+  0x41, 0xbb, 0x58, 0xc6, 0x44, 0xc0, 0x63, 0x13, 0xa3, 0x5f, 0x45, 0x7d,
+  0xe0, 0x54, 0xf4, 0x12, 0x34, 0x06, 0xdd, 0x20, 0x39, 0x99, 0xb6, 0x14,
+  0x9c, 0x54, 0x0d, 0x9e, 0x56, 0x4d, 0x9c, 0xbb, 0x34, 0xc2, 0x20, 0xf2,
+  0x7f, 0x7d, 0x66, 0x6d, 0x36, 0x22, 0xf1, 0xb6, 0x03, 0x2b, 0xa5, 0xdc,
+  0xc8, 0x64, 0x9d, 0xc5, 0xc3, 0xf0, 0x20, 0xf6, 0xe1, 0x36, 0xb8, 0x36,
+  0x26, 0xa9, 0xa8, 0x03, 0x34, 0x4e, 0x2d, 0x2b, 0xef, 0xa0, 0xe8, 0xb9,
+  0x4e, 0xf7, 0x7a, 0x0b, 0xd2, 0x12, 0xa9, 0x34, 0x7b, 0x47, 0x55, 0xcd,
+  0x43, 0x23, 0x1d, 0x6d, 0x13, 0x64, 0x46, 0x70, 0xa5, 0x3b, 0xde, 0xbe,
+  0x63, 0xf1, 0x6c, 0x5f, 0xcc, 0xae, 0x98, 0x0c, 0x3b, 0x5b, 0x71, 0xde,
+  0xa7, 0x16, 0x6e, 0x59, 0x90, 0x41, 0xb3, 0x38, 0x8d, 0xff, 0x31, 0xd0,
+  0x6a, 0xb6, 0x2b, 0xe0, 0x16, 0x75, 0x93, 0xaf, 0x6e, 0x24, 0x03, 0x3e,
+  0x0f, 0xcb, 0xdf, 0x0c, 0x31, 0xfd, 0xc4, 0x78, 0x03, 0x26, 0x06, 0x76,
+  0x86, 0x30, 0xe8, 0x9f, 0xab, 0xc9, 0x25, 0x33, 0x46, 0x81, 0xe6, 0x63,
+  0x4e, 0x51, 0xf9, 0xf7, 0x1b, 0xbf, 0xa1, 0xbc, 0x02, 0x08, 0xbd, 0x0a,
+  0x8c, 0x1f, 0x3b, 0xec, 0x53, 0x04, 0x44, 0x09, 0xff, 0x8e, 0x43, 0x45,
+  0xd9, 0xc1, 0x4b, 0x4d, 0x8d, 0xb0, 0x82, 0x77, 0x6f, 0x3d, 0xc8, 0x6e,
+  0xca, 0x87, 0x39, 0x63, 0xa2, 0xb2, 0x5d, 0x22, 0x4a, 0x61, 0x15, 0x21,
+  0xd1, 0xa5, 0x46, 0xaa, 0x82, 0x02, 0x8b, 0x90, 0x09, 0x96, 0xa4, 0xe9,
+  0x74, 0x9f, 0x0a, 0xb1, 0x3b, 0xd8, 0xaf, 0x33, 0xec, 0x19, 0x6a, 0x0b,
+  0xee, 0x93, 0x4c, 0x2f, 0x57, 0x63, 0xf7, 0x5c, 0x18, 0x79, 0x85, 0xde,
+  0x24, 0xbf, 0xe0, 0x71, 0x0c, 0x3d, 0x10, 0xff, 0xd2, 0x10, 0x64, 0x08,
+  0x2d, 0x60, 0xd6, 0xcd, 0xc3, 0x18, 0xf3, 0x06, 0xfa, 0xfc, 0x10, 0x39,
+  0x83, 0x46, 0xcf, 0xaa, 0x98, 0x72, 0x55, 0x7e, 0x53, 0x24, 0xb9, 0x7e,
+  0xe1, 0x91, 0x86, 0x3f, 0xc9, 0xa4, 0xf3, 0x56, 0x92, 0x0f, 0x50, 0xf9,
+  0xca, 0xc1, 0xf0, 0x5b, 0xe3, 0x2d, 0x6f, 0xb7, 0xce, 0x88, 0x9e, 0x8e,
+  0x74, 0x7f, 0x13, 0x6c, 0xa3, 0xdc, 0x40, 0xb0, 0x28, 0x10, 0x1a, 0x17,
+  0x30, 0x14, 0xf5, 0x28, 0x0f, 0x76, 0xcb, 0xcc, 0xad, 0xdf, 0xd9, 0x06,
+  0x31, 0xbc, 0x61, 0x21, 0x0d, 0xb6, 0xd6, 0x40, 0x73, 0x28, 0x45, 0xc3,
+  0x5b, 0x13, 0xa5, 0x51, 0x2c, 0xd9, 0xdc, 0x67, 0x28, 0x12, 0xf5, 0x9b,
+  0xfc, 0xfb, 0xfa, 0xd2, 0x15, 0xb8, 0xa5, 0x89, 0xb3, 0xd6, 0x07, 0xa9,
+  0xfb, 0x27, 0x60, 0x86, 0x31, 0x31, 0x30, 0x60, 0x36, 0xf4, 0xc5, 0x1a,
+  0x12, 0xe1, 0xb1, 0xe5, 0xa5, 0x34, 0x83, 0xe4, 0x91, 0xd4, 0x2e, 0x67,
+  0xc1, 0x50, 0xdf, 0x82, 0x84, 0xe1, 0x4d, 0xce, 0xf1, 0x7b, 0xfc, 0x08,
+  0x48, 0x9a, 0xa1, 0xde, 0xe3, 0xe4, 0x05, 0xb0, 0x13, 0x0e, 0x22, 0x17,
+  0x7e, 0xf2, 0xa9, 0x25, 0x9d, 0x18, 0x81, 0x2a, 0xc2, 0xb6, 0x4a, 0x43,
+  0x82, 0xe4, 0x24, 0x35, 0x37, 0x58, 0xe4, 0xf3, 0xaa, 0x49, 0x74, 0x72,
+  0xbf, 0xda, 0x77, 0x1b, 0x65, 0x37, 0xc8, 0x4b, 0xb9, 0xc3, 0x93, 0x6b,
+  0x70, 0xe3, 0x59, 0x42, 0xa2, 0xf8, 0x27, 0x3f, 0xd2, 0x71, 0x2b, 0xaa,
+  0xa9, 0xa1, 0x67, 0xed, 0x07, 0xcf, 0x84, 0xfa, 0x8f, 0xc7, 0x3b, 0xe0,
+  0xb4, 0xd8, 0x22, 0xc7, 0x38, 0x62, 0x13, 0x3e, 0xa9, 0x28, 0xda, 0xb3,
+  0x48, 0x3b, 0x07, 0xdb, 0xb6, 0x27, 0xd7, 0x68, 0xc2, 0x83, 0x08, 0x07,
+  0x49, 0x69, 0xe4, 0xb3, 0x16, 0xc9, 0x3c, 0x3b, 0x39, 0x2a, 0x21, 0x92,
+  0x2a, 0x4e, 0xfd, 0xd0, 0x05, 0x15, 0x8f, 0xf4, 0x8b, 0x7e, 0xa2, 0x5c,
+  0x28, 0xbb, 0x99, 0x90, 0xd8, 0x00, 0x69, 0x34, 0xd1, 0x74, 0x9d, 0x86,
+  0x3b, 0xc2, 0x11, 0xac, 0x35, 0x69, 0x8b, 0x29, 0xa9, 0x17, 0x4c, 0x52,
+  0xe1, 0xdd, 0xa5, 0x1f, 0x21, 0x45, 0xe2, 0xaf, 0x54, 0x41, 0x5f, 0x94,
+  0x82, 0x2f, 0xa9, 0x30, 0x54, 0x66, 0x4d, 0x4a, 0x26, 0x03, 0x57, 0x8b,
+  0x0b, 0x8d, 0x60, 0xa3, 0xbb, 0x83, 0xed, 0x0f, 0x53, 0x42, 0x7f, 0xa7,
+  0xa6, 0x89, 0x34, 0x4a, 0xf0, 0x6f, 0x02, 0x87, 0x37, 0xf5, 0x2e, 0xd9,
+  0x53, 0x5f, 0xd9, 0x74, 0x9d, 0x7f, 0xba, 0xa6, 0x54, 0x75, 0x79, 0x5e,
+  0xb6, 0xc8, 0xb2, 0xc7, 0x31, 0xc1, 0x00, 0x5b, 0x3f, 0xf7, 0x8a, 0xef,
+  0x33, 0x43, 0x43, 0x8b, 0x1c, 0x84, 0xd8, 0x00, 0xc7, 0x87, 0x74, 0xff,
+  0xde, 0xef, 0xac, 0x58, 0xbe, 0x75, 0xd9, 0xd9, 0xa0, 0xf1, 0xee, 0x48,
+  0xc6, 0xd3, 0x8d, 0x02, 0x0e, 0x5f, 0xe9, 0xec, 0x04, 0x13, 0x40, 0xd5,
+  0xa4, 0xf9, 0x9a, 0xdf, 0x0f, 0x1b, 0xac, 0x5d, 0x5c, 0x06, 0x9a, 0x53,
+  0x17, 0x8d, 0xc4, 0x93, 0x7f, 0x9d, 0x09, 0xbb, 0x41, 0xed, 0xe3, 0xd9,
+  0xe2, 0x0c, 0x5c, 0xad, 0x7d, 0xfc, 0x98, 0x50, 0xce, 0x20, 0xcf, 0xf8,
+  0x0e, 0xbe, 0x06, 0x36, 0x35, 0x32, 0x57, 0x43, 0xf5, 0x3b, 0xc3, 0xf7,
+  0xf4, 0xa1, 0x86, 0x9d, 0x25, 0x76, 0x90, 0x45, 0x80, 0x8c, 0xd4, 0x3b,
+  0xf9, 0x21, 0xed, 0xe4, 0xca, 0xb1, 0x95, 0x48, 0x0a, 0x25, 0x02, 0x1c,
+  0x2a, 0x55, 0x73, 0x61, 0xc3, 0x37, 0xfa, 0x1f, 0x7b, 0xb6, 0xf6, 0x27,
+  0x52, 0xc2, 0x6c, 0x7c, 0x74, 0xe0, 0x21, 0xff, 0x2e, 0x2a, 0x88, 0x76,
+  0x1c, 0x97, 0x4f, 0x54, 0x78, 0xd6, 0x3f, 0x3e, 0x0b, 0x33, 0x42, 0xff,
+  0xff, 0x99, 0xa8, 0x28, 0xc4, 0xb3, 0x8a, 0xf3, 0x67, 0xaa, 0xde, 0x33,
+  0xb5, 0x33, 0xab, 0x24, 0xdc, 0xb3, 0x56, 0x2d, 0xed, 0x82, 0x92, 0x08,
+  0xff, 0xae, 0x42, 0xe6, 0x6e, 0xbe, 0x89, 0xc3, 0x25, 0xfd, 0xee, 0x91,
+  0xc0, 0x2e, 0xb5, 0xd8, 0x91, 0x2e, 0xdb, 0xa5, 0xec, 0x78, 0xb2, 0xbf,
+  0x16, 0x04, 0xdb, 0x52, 0x58, 0x9f, 0xb5, 0x59, 0x98, 0x2b, 0xf2, 0xe2,
+  0x31, 0x26, 0x8e, 0x96, 0x8f, 0x1a, 0xa4, 0xd2, 0x1e, 0x5a, 0xbc, 0x88,
+  0x90, 0x38, 0xda, 0x22, 0x0b, 0xe1, 0xa4, 0x7d, 0x6c, 0x77, 0x70, 0xef,
+  0xcb, 0x7c, 0xd2, 0xae, 0x45, 0xa5, 0xf5, 0x61, 0x61, 0xfb, 0xfc, 0xe1,
+  0x67, 0x92, 0x66, 0xe5, 0x3a, 0xe8, 0x95, 0xf7, 0x34, 0xb9, 0x89, 0x37,
+  0x78, 0x71, 0xe6, 0xa1, 0x49, 0x0a, 0x34, 0x36, 0x8a, 0x4b, 0xe5, 0xcf,
+  0xf8, 0x88, 0xe7, 0x7a, 0x2c, 0x84, 0xde, 0x0a, 0x1a, 0x58, 0xff, 0xb3,
+  0x53, 0xcb, 0x27, 0xb0, 0x18, 0xf2, 0x81, 0x6d, 0xc7, 0xb4, 0x3b, 0x39,
+  0x16, 0xcf, 0xc1, 0xbb, 0xc3, 0x4a, 0xd2, 0x1f, 0x26, 0x94, 0x2b, 0x83,
+  0xbc, 0x0a, 0x4a, 0x35, 0xcc, 0x9b, 0x0d, 0xd6, 0x83, 0xcf, 0x8a, 0xf3,
+  0x7f, 0xa4, 0x1e, 0xa8, 0x94, 0x61, 0x2c, 0x36, 0x3e, 0xae, 0xc6, 0x5c,
+  0x7e, 0x31, 0x57, 0x1d, 0x90, 0x5e, 0x4f, 0xa9, 0xf6, 0x3b, 0x55, 0x52,
+  0xdd, 0xc9, 0x80, 0x9a, 0x3a, 0x49, 0x3b, 0x8d, 0xc1, 0x80, 0xba, 0x30,
+  0x80, 0x88, 0xc0, 0xe6, 0x83, 0xa2, 0xe5, 0xb1, 0x10, 0xd9, 0xfe, 0x56,
+  0x36, 0x4c, 0x31, 0x2f, 0x74, 0x62, 0x79, 0x3f, 0x1e, 0xd8, 0xe7, 0x4e,
+  0xf6, 0xa2, 0x4a, 0x40, 0x4e, 0x27, 0x9c, 0x05, 0xd8, 0xa0, 0x9d, 0x72,
+  0xef, 0x40, 0x93, 0x3b, 0x0b, 0x25, 0x0a, 0x5f, 0x14, 0x73, 0x89, 0xc9,
+  0x25, 0xff, 0x1d, 0x02, 0xeb, 0xe1, 0x1b, 0x23, 0xd4, 0x96, 0xb2, 0x72,
+  0x22, 0xd1, 0x48, 0x9f, 0x77, 0xd0, 0xde, 0x34, 0x34, 0x62, 0x4e, 0x76,
+  0x26, 0x35, 0xa9, 0x34, 0xea, 0x44, 0x33, 0x77, 0x4a, 0x30, 0x95, 0x22,
+  0x09, 0xb4, 0x47, 0x42, 0xea, 0xc1, 0x75, 0xd1, 0x4f, 0x94, 0x32, 0xc6,
+  0x07, 0x61, 0x5e, 0xd5, 0x5d, 0x85, 0xf3, 0x13, 0xaf, 0xc0, 0xae, 0x8c,
+  0x81, 0xe2, 0x4c, 0xcd, 0x86, 0xe5, 0x7c, 0x73, 0x0c, 0xf3, 0xc8, 0x1f,
+  0x4f, 0xee, 0x55, 0x4a, 0x1f, 0x6f, 0x57, 0xd1, 0x3f, 0x62, 0x68, 0xee,
+  0xb7, 0x25, 0xc3, 0xe1, 0x85, 0x69, 0x4d, 0xa4, 0x11, 0xa1, 0xd0, 0x3f,
+  0x8c, 0xde, 0xc3, 0xfe, 0x49, 0x65, 0xea, 0xea, 0x1e, 0x0b, 0xac, 0x91,
+  0x71, 0x3e, 0x30, 0x40, 0xc8, 0x75, 0x47, 0xbf, 0xa4, 0x2f, 0xfa, 0xfc,
+  0xdf, 0x8e, 0x6a, 0x6a, 0x37, 0xcb, 0x89, 0x54, 0xdb, 0x71, 0x3e, 0x33,
+  0x78, 0x25, 0x58, 0x4d, 0x12, 0xf0, 0x42, 0x9b, 0x26, 0xcf, 0xb6, 0xff,
+  0xa4, 0x15, 0x69, 0xef, 0x0f, 0x3d, 0x43, 0x9d, 0x68, 0x8e, 0xfe, 0xa7,
+  0x27, 0x38, 0xf5, 0x13, 0x7d, 0xe4, 0x34, 0x0f, 0xda, 0xa2, 0x80, 0x17,
+  0x62, 0x0c, 0x1b, 0xd5, 0x35, 0x7b, 0x24, 0x8d, 0x45, 0x47, 0x62, 0x51,
+  0x49, 0xff, 0xbe, 0x89, 0x0f, 0x8b, 0x9f, 0xa9, 0xd6, 0x51, 0x53, 0xb0,
+  0x2b, 0xda, 0x53, 0xcd, 0xbf, 0x14, 0x82, 0xd5, 0x32, 0x4b, 0xf5, 0x26,
+  0x46, 0xba, 0x40, 0xc4, 0x3f, 0x4e, 0xfe, 0x96, 0x62, 0x10, 0x8b, 0xe7,
+  0xab, 0xe0, 0x28, 0x95, 0x79, 0x93, 0x90, 0xc9, 0xcf, 0x17, 0xfa, 0xea,
+  0x5e, 0xcf, 0x03, 0xa4, 0x91, 0x71, 0xfa, 0xb9, 0xfb, 0x14, 0x8c, 0xe6,
+  0xde, 0xc6, 0xda, 0x72, 0xf1, 0xef, 0xfe, 0xac, 0x35, 0x69, 0x78, 0xba,
+  0xfd, 0x88, 0xf5, 0x03, 0xf2, 0xdc, 0x6c, 0x57, 0x3e, 0x33, 0x40, 0xf5,
+  0x9b, 0x56, 0xff, 0x23, 0x35, 0x00, 0xb3, 0xc7, 0x9e, 0x17, 0x34, 0x77,
+  0xe9, 0xe0, 0xc5, 0x6c, 0x12, 0x6d, 0x56, 0xc1, 0x67, 0x6b, 0x5e, 0x8f,
+  0x69, 0xbc, 0x84, 0xab, 0x09, 0x1c, 0x35, 0xd3, 0x07, 0xfd, 0xcb, 0x3f,
+  0x36, 0x8b, 0xca, 0xa2, 0x11, 0xdf, 0xb2, 0xea, 0x01, 0xd6, 0x89, 0xbe,
+  0xeb, 0xdc, 0xc3, 0x91, 0xb0, 0x90, 0xe3, 0xe5, 0x79, 0xab, 0x75, 0xe8,
+  0xa2, 0x1f, 0x3a, 0xdb, 0xc2, 0xc8, 0x57, 0x24, 0xbc, 0x8c, 0xa0, 0xe0,
+  0x4e, 0xbf, 0xe6, 0xcc, 0x56, 0x2b, 0x65, 0x79, 0x02, 0xf7, 0x3d, 0x19,
+  0x75, 0x1a, 0x61, 0x8b, 0x95, 0x50, 0x6b, 0x58, 0xc1, 0xe7, 0xe0, 0x09,
+  0xcc, 0xb3, 0x57, 0xea, 0x27, 0x1b, 0xb1, 0x2e, 0x9a, 0x46, 0xe7, 0xb7,
+  0x84, 0x26, 0x82, 0x37, 0xe2, 0xf2, 0xed, 0xd8, 0x9c, 0xc3, 0xaf, 0xff,
+  0x00, 0xb2, 0xd3, 0x05, 0xe3, 0x9b, 0x7b, 0xbc, 0x5f, 0xa4, 0x70, 0x2a,
+  0x6d, 0xe2, 0x9b, 0xcd, 0x92, 0xe2, 0x00, 0x28, 0x29, 0x1c, 0x54, 0x1a,
+  0xbb, 0xdf, 0xa9, 0x0e, 0xfa, 0x43, 0x3b, 0xf8, 0x47, 0xa4, 0x63, 0xc2,
+  0xf0, 0x24, 0x34, 0x56, 0xf3, 0x3a, 0x5a, 0xf0, 0x83, 0xd4, 0x14, 0xac,
+  0x64, 0x91, 0x67, 0x64, 0x79, 0x37, 0x99, 0xa4, 0x2b, 0x38, 0xf3, 0x24,
+  0x09, 0xd5, 0xbe, 0x79, 0x71, 0x15, 0xa2, 0x0f, 0x5e, 0xd0, 0xca, 0x9a,
+  0x49, 0x48, 0x05, 0x56, 0x73, 0xc7, 0xf0, 0x98, 0x1a, 0x70, 0x63, 0xb1,
+  0x9a, 0x89, 0x7c, 0x14, 0x8d, 0xff, 0x56, 0xf2, 0x32, 0x86, 0x01, 0x4c,
+  0x74, 0xf3, 0x9b, 0xb6, 0x32, 0xfe, 0x72, 0xd3, 0x56, 0xd0, 0xf1, 0x08,
+  0x16, 0x88, 0x8e, 0x38, 0xef, 0x68, 0x9e, 0x38, 0x0b, 0x26, 0xd8, 0x57,
+  0x73, 0x2c, 0x0c, 0xcc, 0x21, 0xaf, 0x62, 0x1a, 0xbe, 0x25, 0x92, 0x06,
+  0x0b, 0xd0, 0xe2, 0x7a, 0x06, 0x92, 0x2c, 0xb7, 0x48, 0xe3, 0x1e, 0x7b,
+  0x25, 0xeb, 0x9a, 0xbd, 0x7e, 0x91, 0x72, 0x19, 0x5d, 0x75, 0x93, 0x66,
+  0x27, 0xcc, 0x5e, 0x97, 0x8b, 0x81, 0x83, 0x78, 0x28, 0xc3, 0x5a, 0x50,
+  0xba, 0xa6, 0x06, 0xec, 0xf9, 0x69, 0x66, 0x49, 0xac, 0x53, 0xd6, 0xc6,
+  0xc6, 0xaa, 0xb4, 0x81, 0xde, 0x48, 0x80, 0xfd, 0x3a, 0x0b, 0xd7, 0x47,
+  0xcf, 0x8a, 0x53, 0x89, 0x75, 0x5a, 0xf9, 0xd8, 0x81, 0xea, 0x35, 0xa1,
+  0xcb, 0x59, 0xbd, 0x08, 0xac, 0x81, 0xb7, 0x0b, 0xb2, 0xe7, 0x78, 0x48,
+  0xa9, 0xaf, 0xc5, 0xb8, 0x86, 0x0c, 0x37, 0xad, 0xff, 0x90, 0x22, 0x16,
+  0x06, 0x43, 0xc8, 0x2d, 0x6c, 0xb7, 0x68, 0xe5, 0xcc, 0x92, 0xa0, 0xbd,
+  0xf4, 0xec, 0xef, 0x26, 0xd0, 0x47, 0x8b, 0x0e, 0x3b, 0x10, 0xbb, 0x48,
+  0x0f, 0x50, 0x98, 0x74, 0xe3, 0xdb, 0x20, 0x7d, 0x1b, 0x1a, 0xf3, 0xf5,
+  0xef, 0x61, 0xbb, 0xf7, 0x08, 0x40, 0x37, 0xb0, 0xc7, 0xf5, 0xbb, 0x8f,
+  0xac, 0x05, 0x87, 0x09, 0x27, 0x5b, 0xb6, 0x56, 0x9d, 0x5c, 0x6b, 0x67,
+  0x60, 0xc2, 0xb5, 0x69, 0x50, 0xcb, 0xbf, 0x57, 0x65, 0x8a, 0x37, 0x98,
+  0xbe, 0x72, 0x2d, 0xf2, 0x97, 0xa5, 0x99, 0x0d, 0x18, 0x49, 0x63, 0xbd,
+  0x20, 0x45, 0xa9, 0x17, 0x55, 0x12, 0xbb, 0xdc, 0xc2, 0x47, 0x20, 0xba,
+  0xfe, 0x47, 0xe0, 0x6e, 0xd7, 0xe4, 0xca, 0x4d, 0x0c, 0x64, 0x84, 0x25,
+  0xd9, 0x75, 0xa5, 0xfd, 0xad, 0xc1, 0x0e, 0x81, 0xee, 0x6e, 0xb7, 0x48,
+  0xee, 0xf2, 0xef, 0xbf, 0x0b, 0xd1, 0xff, 0xbd, 0xf2, 0x8e, 0xb3, 0xe3,
+  0xdd, 0x41, 0xbf, 0x45, 0x45, 0xf8, 0x4e, 0x41, 0x0f, 0xfc, 0xc8, 0x4b,
+  0x68, 0xf4, 0xbd, 0xe5, 0x27, 0x8b, 0x8e, 0xc8, 0x0b, 0xb5, 0x7e, 0xf8,
+  0x3a, 0xe5, 0xd7, 0x0b, 0xa6, 0x94, 0x2d, 0x37, 0x81, 0x96, 0xec, 0x44,
+  0x05, 0x79, 0x5c, 0xfa, 0x54, 0xd5, 0x93, 0xde, 0x11, 0x29, 0x3a, 0x85,
+  0x22, 0x47, 0x0d, 0xb1, 0xa0, 0x86, 0xde, 0x89, 0x33, 0xa2, 0xd7, 0x26,
+  0x0e, 0x84, 0xf1, 0xe8, 0x56, 0x1a, 0xe1, 0xd5, 0xd7, 0xc5, 0x18, 0x64,
+  0x36, 0x8f, 0xd8, 0xac, 0x03, 0x46, 0xf2, 0xa8, 0x7b, 0xa4, 0x53, 0x6f,
+  0x8d, 0xf7, 0x23, 0x31, 0x45, 0x46, 0xb8, 0x1f, 0xd0, 0x50, 0xf3, 0x52,
+  0x83, 0xac, 0x17, 0xb8, 0x10, 0x10, 0x68, 0xaf, 0x75, 0x92, 0xd8, 0x6f,
+  0xd7, 0x47, 0xf4, 0x62, 0x19, 0x69, 0x14, 0x9f, 0x80, 0x74, 0xf2, 0x97,
+  0x1e, 0x1c, 0x64, 0x3b, 0xa3, 0x91, 0x4b, 0x21, 0x80, 0x90, 0xa3, 0xb1,
+  0xb6, 0x9d, 0x2a, 0x06, 0x3f, 0x08, 0xcd, 0x6b, 0x0d, 0xf2, 0x40, 0xe6,
+  0x83, 0xad, 0x46, 0x1c, 0xe4, 0xcd, 0x11, 0x94, 0xb3, 0x52, 0xb3, 0x84,
+  0x79, 0x10, 0xd0, 0x0d, 0xa8, 0x2d, 0xf9, 0xfa, 0x73, 0xbd, 0x14, 0x06,
+  0xa1, 0x3c, 0x54, 0x37, 0x8e, 0x34, 0x91, 0x8d, 0x4a, 0x65, 0x4c, 0x31,
+  0xf1, 0xde, 0x29, 0xe5, 0xe5, 0x73, 0x08, 0x58, 0xcb, 0xc2, 0x43, 0x81,
+  0xa5, 0xd0, 0xf9, 0xe4, 0xbb, 0x2a, 0xd0, 0x1f, 0x95, 0x50, 0x50, 0x9e,
+  0x53, 0x13, 0x88, 0x7f, 0xcb, 0x9e, 0x33, 0x92, 0xf3, 0x2e, 0x45, 0xd5,
+  0xbd, 0xea, 0x83, 0x76, 0x10, 0xec, 0x07, 0xee, 0x13, 0x51, 0x2d, 0x59,
+  0x73, 0xca, 0x75, 0x1a, 0xac, 0x37, 0x3c, 0x89, 0xa4, 0xf3, 0xa0, 0xcb,
+  0x49, 0x24, 0xbb, 0x38, 0x3e, 0xec, 0x34, 0xde, 0xcd, 0xc5, 0xef, 0x07,
+  0x48, 0x30, 0xc6, 0x12, 0x0d, 0xa4, 0xce, 0x90, 0x0f, 0xb4, 0xa1, 0x5f,
+  0xa9, 0x01, 0xac, 0x3a, 0xf5, 0x9b, 0x72, 0x16, 0x89, 0x23, 0xd6, 0xec,
+  0xbd, 0xef, 0x9a, 0x13, 0x63, 0x9b, 0xb3, 0xd9, 0xa4, 0xe2, 0x67, 0xd3,
+  0x6f, 0x75, 0x6f, 0x4d, 0x00, 0x74, 0xe9, 0x5b, 0x81, 0x27, 0x4e, 0xce,
+  0x84, 0xf9, 0x7a, 0x00, 0x07, 0xd4, 0x7f, 0x6e, 0x18, 0x53, 0x4c, 0x55,
+  0x08, 0x14, 0xbe, 0x7e, 0xc1, 0x2f, 0x69, 0x83, 0xac, 0x9b, 0x00, 0xad,
+  0x72, 0x70, 0x6a, 0xc1, 0x86, 0x9f, 0x31, 0xf3, 0xd7, 0x59, 0x69, 0xc2,
+  0xa4, 0xd5, 0xb9, 0xb4, 0x3e, 0x01, 0x10, 0x56, 0x45, 0xa6, 0x22, 0xb6,
+  0x12, 0x08, 0x01, 0x84, 0x60, 0xfa, 0x79, 0xec, 0x9f, 0x70, 0x7d, 0x1f,
+  0x1b, 0x35, 0xb7, 0xca, 0x15, 0x66, 0xee, 0xa5, 0xef, 0xda, 0xce, 0x29,
+  0x8d, 0x85, 0x45, 0xd1, 0xc1, 0x06, 0x81, 0x18, 0x86, 0x47, 0x94, 0x79,
+  0xe5, 0x39, 0x3b, 0x23, 0x83, 0x14, 0xaf, 0x2c, 0xe4, 0xcb, 0x57, 0x07,
+  0x87, 0x8d, 0xc9, 0x32, 0x94, 0x48, 0x2d, 0xb9, 0xdd, 0x17, 0xf1, 0x8c,
+  0xc0, 0x68, 0xbf, 0xe1, 0x67, 0x35, 0x09, 0xd8, 0xfa, 0x98, 0x67, 0xb8,
+  0x3f, 0xc2, 0x27, 0xa3, 0xab, 0xdf, 0xf9, 0x82, 0x31, 0xfc, 0xc8, 0x07,
+  0x2e, 0xbc, 0xb1, 0xcd, 0xcf, 0xd2, 0x1f, 0x55, 0x91, 0x16, 0x52, 0xa7,
+  0x28, 0x0b, 0x2d, 0x9a, 0x06, 0x5b, 0xe3, 0x91, 0x0c, 0x8e, 0x37, 0x93,
+  0xd5, 0xfd, 0xed, 0xdb, 0x39, 0x9e, 0x1b, 0x32, 0x57, 0x1e, 0x65, 0x40,
+  0x0b, 0x26, 0x69, 0x68, 0x78, 0x3e, 0xe9, 0x16, 0x50, 0xbc, 0x5f, 0x1a,
+  0x7e, 0xcd, 0x94, 0x04, 0x09, 0xb1, 0x33, 0x88, 0x60, 0x49, 0x64, 0x5e,
+  0x9d, 0x3f, 0xcd, 0x84, 0xe7, 0x9d, 0xa5, 0x70, 0x9c, 0x28, 0xe2, 0x44,
+  0x87, 0x9e, 0x7c, 0x6f, 0xa0, 0xca, 0xf5, 0x46, 0x2d, 0x02, 0x01, 0x30,
+  0xd4, 0xb8, 0x9d, 0x16, 0x88, 0xa0, 0xa8, 0x4b, 0x8a, 0x0f, 0x26, 0x87,
+  0x4d, 0xcb, 0x5d, 0xff, 0x43, 0x58, 0xef, 0x16, 0xd6, 0x23, 0xe6, 0x10,
+  0x17, 0x47, 0x05, 0x9e, 0x20, 0x3a, 0x15, 0xea, 0x1a, 0x82, 0x8b, 0xbb,
+  0xdf, 0xde, 0x19, 0xbc, 0xf8, 0xc0, 0x30, 0xaa, 0x72, 0xf4, 0x57, 0x41,
+  0x79, 0x94, 0x0a, 0x56, 0x86, 0x24, 0x9d, 0x3a, 0xff, 0xb5, 0x22, 0xe9,
+  0x2c, 0xbe, 0xa9, 0x16, 0x8c, 0x68, 0xf9, 0x8c, 0xff, 0xf6, 0x4e, 0x7e,
+  0xe3, 0xac, 0xc2, 0x71, 0xc0, 0xc6, 0xaa, 0xb6, 0x97, 0x23, 0x24, 0x05,
+  0xb1, 0x06, 0x10, 0xf9, 0x83, 0x99, 0x95, 0xc4, 0x8d, 0xc9, 0x21, 0xe7,
+  0xe3, 0x91, 0x97, 0x33, 0x19, 0xcb, 0xd8, 0x6f, 0x68, 0xa1, 0x79, 0xc7,
+  0xf0, 0x25, 0xd3, 0x77, 0x4f, 0xcd, 0x2f, 0xac, 0xe2, 0x25, 0xc3, 0x7e,
+  0xa4, 0x4f, 0x1e, 0x42, 0x78, 0x01, 0x8a, 0x48, 0xd1, 0x15, 0x25, 0x36,
+  0x5e, 0x42, 0x15, 0xea, 0xd9, 0xcb, 0x66, 0x78, 0xf8, 0x71, 0x94, 0x07,
+  0xa8, 0x60, 0xa6, 0x05, 0xb5, 0x21, 0xa4, 0x37, 0x8c, 0xee, 0xde, 0xea,
+  0x89, 0xd9, 0x16, 0x80, 0xaf, 0xe4, 0x0d, 0xe0, 0xb0, 0x2d, 0xbd, 0x85,
+  0x20, 0xdf, 0x41, 0xa6, 0xaf, 0xa4, 0x3f, 0x69, 0x3a, 0xfd, 0xe3, 0xf4,
+  0x17, 0xca, 0x8d, 0x93, 0xf8, 0xb5, 0x64, 0xb1, 0xe6, 0x9e, 0xd0, 0x7a,
+  0x85, 0x33, 0xba, 0x73, 0x7d, 0xb4, 0xde, 0x40, 0x43, 0x88, 0x32, 0x41,
+  0xf4, 0x0d, 0x00, 0x88, 0x67, 0xac, 0x8a, 0xb0, 0xf0, 0xea, 0x92, 0x4f,
+  0xaf, 0x36, 0xc4, 0x39, 0x50, 0x76, 0xae, 0x35, 0x2a, 0x6c, 0xdd, 0x9e,
+  0x36, 0xe9, 0x0a, 0xdf, 0xd2, 0x98, 0x70, 0xa5, 0xcf, 0x54, 0x71, 0xf6,
+  0xa2, 0x8a, 0x76, 0x4d, 0x39, 0xe2, 0xf6, 0xf6, 0xa1, 0xa0, 0x2b, 0x14,
+  0xcc, 0xb6, 0x32, 0x7d, 0x7c, 0x47, 0xa7, 0xf1, 0xf4, 0x7d, 0xb5, 0x8d,
+  0xed, 0x25, 0xf3, 0xa5, 0x9c, 0x4f, 0x5a, 0xe9, 0xe3, 0x51, 0xc2, 0xfb,
+  0x83, 0x0e, 0x1e, 0x6b, 0xd9, 0x8a, 0x70, 0x5d, 0x0b, 0x2d, 0xbc, 0xf0,
+  0x5b, 0xa2, 0xaa, 0x89, 0x4c, 0x39, 0xf4, 0x1a, 0xd0, 0x26, 0x11, 0xbd,
+  0x3b, 0x08, 0xa8, 0xf2, 0x1c, 0x71, 0x82, 0x21, 0x82, 0xef, 0x51, 0x9b,
+  0xd6, 0x48, 0xc8, 0xef, 0x9b, 0xbf, 0xbe, 0xb9, 0x13, 0x75, 0xcc, 0x70,
+  0x59, 0x57, 0x95, 0x56, 0x60, 0x23, 0x6d, 0x7b, 0x24, 0x0f, 0xdf, 0x06,
+  0xf1, 0x1e, 0x47, 0x74, 0x05, 0x4d, 0x31, 0x40, 0xe5, 0x28, 0x8d, 0x14,
+  0x13, 0xaa, 0x5c, 0xd1, 0x1d, 0xb8, 0xf7, 0x01, 0x07, 0xc9, 0x14, 0x92,
+  0x91, 0xd3, 0xf5, 0x9e, 0x27, 0x0f, 0x36, 0x5f, 0x41, 0x1d, 0x54, 0x3d,
+  0xd3, 0xeb, 0xbc, 0x5f, 0x57, 0x61, 0x42, 0x34, 0x25, 0x69, 0x60, 0x0f,
+  0x70, 0xc0, 0xfb, 0x98, 0x5f, 0xe7, 0x85, 0x52, 0x29, 0x7f, 0xb7, 0x69,
+  0x77, 0x83, 0x80, 0x20, 0xb9, 0xdc, 0x2f, 0x95, 0x23, 0x43, 0xee, 0xa5,
+  0x43, 0xd1, 0xb6, 0x74, 0x23, 0x14, 0xdf, 0x25, 0x12, 0x09, 0x9d, 0xa1,
+  0x98, 0x0f, 0x66, 0xd5, 0xfd, 0x03, 0xc0, 0x10, 0xe5, 0x7b, 0xdd, 0x7f,
+  0x7c, 0xf4, 0x61, 0xcd, 0x5c, 0x2c, 0xf0, 0x3b, 0x7a, 0x88, 0x5a, 0x8a,
+  0xef, 0xcd, 0x77, 0xf8, 0x46, 0xc1, 0xb1, 0x40, 0x11, 0x64, 0x88, 0x75,
+  0x67, 0xf7, 0xda, 0x72, 0x32, 0x0c, 0x10, 0x30, 0xa0, 0x8f, 0xd9, 0x77,
+  0x0a, 0xb8, 0xf7, 0xe6, 0x5c, 0xb0, 0x90, 0x76, 0xba, 0xfe, 0x01, 0x80,
+  0xa4, 0x3f, 0x0f, 0x2e, 0x78, 0x81, 0x53, 0xd4, 0x2e, 0xaa, 0xe9, 0xe9,
+  0x1e, 0x7b, 0xb0, 0x51, 0x17, 0xa3, 0xf3, 0x24, 0x0a, 0x36, 0x1e, 0x04,
+  0xd5, 0xdf, 0x75, 0x6e, 0x74, 0xd4, 0x22, 0x03, 0x03, 0x32, 0xf6, 0xad,
+  0xd8, 0xdf, 0x0b, 0xe6, 0x5b, 0x25, 0x93, 0x1c, 0x48, 0x72, 0xd1, 0xea,
+  0x28, 0xd0, 0xff, 0x5c, 0x0a, 0x77, 0x6f, 0x40, 0xfe, 0x07, 0x78, 0xc0,
+  0x00, 0x1b, 0x5d, 0x5c, 0x8e, 0x9f, 0x10, 0xee, 0x63, 0xb8, 0x8c, 0xce,
+  0x1a, 0x5f, 0x3c, 0x77, 0x4c, 0xef, 0x8e, 0x6f, 0x7a, 0x03, 0xb5, 0xeb,
+  0x1b, 0x4d, 0x6b, 0xd0, 0x62, 0x5b, 0x16, 0xcb, 0x54, 0x75, 0xca, 0x4e,
+  0x8c, 0xa3, 0x1a, 0xc6, 0x23, 0x0e, 0xc8, 0x25, 0x2c, 0xae, 0xfc, 0x7c,
+  0x6f, 0x02, 0xad, 0x6b, 0xea, 0xe1, 0x8e, 0x1d, 0x6c, 0x48, 0xb6, 0x84,
+  0x4a, 0xff, 0x0b, 0xe5, 0x93, 0xae, 0x25, 0x1f, 0xa0, 0xf6, 0x29, 0xeb,
+  0x80, 0xe6, 0xaf, 0x69, 0x44, 0xca, 0x7d, 0x21, 0xd4, 0xc3, 0xd5, 0xbc,
+  0x95, 0x7f, 0x59, 0xe3, 0x09, 0x5c, 0x76, 0x45, 0xbb, 0x07, 0xab, 0x63,
+  0x68, 0x05, 0x04, 0xd5, 0x82, 0xf8, 0x3f, 0x67, 0x57, 0xc7, 0x04, 0xe3,
+  0xd1, 0x0c, 0x08, 0x5a, 0x4c, 0xb4, 0x61, 0x39, 0xef, 0xf8, 0xb4, 0xe8,
+  0x0b, 0xd8, 0xa3, 0xa8, 0x6a, 0x40, 0x16, 0xcd, 0x3d, 0x34, 0x59, 0x36,
+  0x9a, 0x60, 0x48, 0x79, 0x55, 0xe4, 0x02, 0x50, 0x85, 0xe8, 0x2a, 0x5b,
+  0x3f, 0x1c, 0xc6, 0xde, 0x51, 0x05, 0x39, 0xc4, 0x64, 0x2a, 0x2b, 0x2f,
+  0xed, 0xec, 0x8e, 0x14, 0xd6, 0x5a, 0xcb, 0x11, 0xa0, 0x76, 0x3b, 0xb6,
+  0x7f, 0x65, 0x19, 0xed, 0x17, 0xaa, 0xe5, 0x43, 0x9a, 0x85, 0xc6, 0xd0,
+  0x41, 0x5f, 0xdd, 0xda, 0x87, 0xbb, 0x9e, 0x19, 0xb8, 0x13, 0x28, 0x28,
+  0x81, 0xe2, 0x17, 0x56, 0xac, 0x51, 0x0b, 0xb8, 0x40, 0xa9, 0xee, 0x92,
+  0x7f, 0x7a, 0x02, 0xf7, 0x49, 0x2d, 0xcd, 0xcd, 0xd0, 0x81, 0x05, 0xab,
+  0x17, 0xd3, 0x43, 0x7c, 0xc7, 0x19, 0x70, 0x18, 0xb3, 0xbe, 0x1e, 0x7a,
+  0x49, 0xe5, 0xb4, 0x19, 0x71, 0x11, 0x67, 0x37, 0xf9, 0xc3, 0x92, 0x1a,
+  0xa0, 0x09, 0x9e, 0x01, 0x1b, 0xe7, 0x86, 0x91, 0xfe, 0x8c, 0x35, 0xf8,
+  0xc9, 0xd7, 0xf9, 0x5f, 0x0c, 0x33, 0xae, 0x87, 0x0e, 0x96, 0xb1, 0x58,
+  0x00, 0xb8, 0xef, 0x64, 0x0b, 0xb1, 0xd0, 0xc4, 0x3a, 0x81, 0xbc, 0xbd,
+  0x47, 0x40, 0x43, 0xb4, 0x4d, 0x47, 0x1b, 0x00, 0x39, 0xb7, 0x67, 0xda,
+  0x0b, 0x5f, 0xc5, 0x09, 0x14, 0xe6, 0xe1, 0xed, 0x63, 0x4f, 0x03, 0x7b,
+  0xe3, 0x3d, 0x52, 0x04, 0xb3, 0xbb, 0xff, 0xf2, 0x01, 0xa4, 0x11, 0x8c,
+  0x91, 0x0c, 0x44, 0xd4, 0x34, 0x23, 0x5b, 0xc7, 0xce, 0xa6, 0xc7, 0xec,
+  0xb9, 0xd0, 0x5d, 0x82, 0xe9, 0x60, 0xfa, 0x69, 0x97, 0x5d, 0x72, 0xae,
+  0xfc, 0x0b, 0xdd, 0x15, 0x01, 0x0e, 0xf3, 0xff, 0x94, 0xbd, 0xe7, 0xbb,
+  0x57, 0x4a, 0xbd, 0xab, 0x19, 0x05, 0x92, 0xd4, 0xd1, 0xd6, 0x5b, 0x73,
+  0xb7, 0xb6, 0xf9, 0xf7, 0x66, 0xf9, 0xbd, 0xb5, 0x11, 0x26, 0x0d, 0xf7,
+  0xa9, 0x57, 0x53, 0xd3, 0x3b, 0x8d, 0x3e, 0x9f, 0x50, 0x0d, 0x96, 0x08,
+  0xfa, 0x80, 0x33, 0x70, 0x04, 0xfc, 0x94, 0xca, 0xb8, 0xa7, 0xdc, 0x2f,
+  0x2b, 0x8b, 0x41, 0xbf, 0x6e, 0xbf, 0xa4, 0x93, 0xde, 0x4f, 0xcb, 0x4e,
+  0xeb, 0xbc, 0xed, 0xe4, 0x08, 0x4e, 0x13, 0x2d, 0xa0, 0xb7, 0x47, 0x63,
+  0x69, 0xa9, 0x6d, 0x8c, 0xcd, 0xe1, 0x7d, 0x35, 0xaf, 0x9f, 0x6c, 0x81,
+  0x08, 0x5c, 0xb6, 0x54, 0x8d, 0x81, 0xbb, 0x28, 0x69, 0x7d, 0xcb, 0x54,
+  0xd2, 0xe8, 0xdb, 0x2c, 0x8f, 0xe1, 0xde, 0x3f, 0x3b, 0xab, 0xca, 0x24,
+  0x27, 0x68, 0x15, 0xb4, 0x85, 0xe2, 0x96, 0x32, 0xb5, 0x2c, 0x2f, 0xeb,
+  0x40, 0x64, 0xcc, 0xcb, 0x4c, 0xc0, 0xd7, 0xa5, 0xe3, 0xd0, 0x0f, 0xdc,
+  0x94, 0xe9, 0xdd, 0x60, 0xbb, 0xe4, 0x63, 0x87, 0x78, 0xd2, 0xda, 0x6b,
+  0x9c, 0x0c, 0xd2, 0x29, 0x42, 0x9a, 0x9a, 0xec, 0x12, 0x6d, 0x6e, 0x4e,
+  0x0d, 0x2d, 0x6d, 0x77, 0xa5, 0x7a, 0x72, 0x1a, 0xb4, 0x9b, 0x60, 0x24,
+  0xeb, 0xee, 0x3f, 0x04, 0x4c, 0x61, 0xd5, 0xdb, 0xb6, 0x4e, 0x7b, 0x31,
+  0xc6, 0xb5, 0x43, 0xb9, 0xea, 0x0c, 0xfb, 0x48, 0x62, 0x58, 0xf2, 0x44,
+  0x0a, 0x07, 0xad, 0xa9, 0xc1, 0xee, 0x4b, 0xe4, 0xfd, 0x58, 0xd0, 0x89,
+  0xad, 0x79, 0x10, 0xaf, 0x1d, 0x42, 0x82, 0x1a, 0x01, 0x51, 0x28, 0x2a,
+  0xce, 0x87, 0x81, 0x52, 0x35, 0x04, 0xa5, 0x61, 0x94, 0x50, 0x3b, 0xf3,
+  0x81, 0x79, 0x38, 0xb7, 0x88, 0x6b, 0xe8, 0x3b, 0x7a, 0x1f, 0x18, 0x06,
+  0xe1, 0x22, 0xdc, 0x6f, 0x23, 0x89, 0xa7, 0x68, 0xeb, 0xba, 0xd9, 0x7d,
+  0xf0, 0x4e, 0xe7, 0x1b, 0xe7, 0x9a, 0x2e, 0x1d, 0x43, 0x2d, 0x12, 0x6d,
+  0x71, 0xcc, 0xb3, 0xec, 0xba, 0xf3, 0x1b, 0x20, 0x99, 0xef, 0x63, 0x29,
+  0xf3, 0x0c, 0x7d, 0xde, 0xe8, 0x03, 0xa8, 0xe7, 0xbb, 0x91, 0xbb, 0xeb,
+  0x74, 0x3e, 0x22, 0x57, 0xb4, 0xf2, 0x57, 0x11, 0xc5, 0x95, 0x74, 0xbd,
+  0x1e, 0x36, 0xbb, 0x6e, 0xce, 0x59, 0x39, 0x2e, 0xf9, 0x3c, 0xe2, 0x06,
+  0x11, 0x6d, 0xe9, 0xc8, 0xbc, 0xa3, 0x19, 0xe7, 0x27, 0x50, 0xc5, 0x73,
+  0x3e, 0x0b, 0x92, 0x86, 0x2d, 0x5e, 0x19, 0xc8, 0x02, 0x01, 0x4a, 0x00,
+  0x06, 0x91, 0x39, 0x69, 0x17, 0xfc, 0x39, 0x66, 0x01, 0xca, 0x73, 0x43,
+  0x30, 0x1a, 0x19, 0x70, 0x50, 0xab, 0x53, 0x7e, 0x4d, 0x90, 0xbc, 0x27,
+  0x93, 0xf7, 0x25, 0xd3, 0xd4, 0x84, 0x3d, 0x41, 0x5e, 0x75, 0x16, 0xd8,
+  0x5c, 0xe1, 0x02, 0x0a, 0xa1, 0xa0, 0xeb, 0x58, 0xd4, 0x63, 0xad, 0x1b,
+  0x0a, 0x93, 0x5e, 0xbe, 0xa7, 0x51, 0xd3, 0xad, 0xb6, 0x9f, 0x6d, 0x44,
+  0xfa, 0x84, 0x3d, 0xa4, 0x63, 0x34, 0x62, 0xb1, 0x40, 0xd5, 0x4f, 0xa6,
+  0xda, 0x3c, 0xba, 0x96, 0x44, 0x0f, 0xa3, 0x4b, 0x72, 0x2d, 0x91, 0x35,
+  0x73, 0xfa, 0x94, 0x3c, 0xd9, 0xfb, 0xd2, 0x13, 0xa5, 0x05, 0x6c, 0x42,
+  0x2f, 0x91, 0x5f, 0x4a, 0xae, 0x66, 0x3a, 0x01, 0xc6, 0xa5, 0x80, 0xb9,
+  0x25, 0x85, 0xbe, 0x94, 0x8e, 0xb8, 0x51, 0x8c, 0x43, 0xc9, 0x4d, 0xfe,
+  0x8d, 0x70, 0xf5, 0xb2, 0x22, 0x34, 0xad, 0xd7, 0x3e, 0x5d, 0x4e, 0x16,
+  0x41, 0xce, 0xe2, 0x21, 0x84, 0x70, 0xe2, 0xa4, 0x64, 0xe6, 0x7f, 0xcc,
+  0x41, 0x47, 0xb3, 0xbe, 0xad, 0x1a, 0x66, 0xc0, 0x01, 0x1c, 0x5c, 0x7d,
+  0x19, 0x28, 0x40, 0xa1, 0x82, 0xf8, 0x8d, 0x44, 0xcf, 0xfe, 0x2a, 0xb6,
+  0x1a, 0xeb, 0x27, 0x7b, 0xce, 0x0e, 0x22, 0x66, 0xe6, 0x91, 0xd5, 0xda,
+  0x6a, 0x09, 0x60, 0x0d, 0x7a, 0xb7, 0xee, 0xb2, 0xe0, 0x46, 0x1c, 0x98,
+  0x77, 0x04, 0x03, 0x82, 0x39, 0x62, 0x83, 0x8d, 0x48, 0xd8, 0x2d, 0x19,
+  0xb6, 0x05, 0x73, 0x1b, 0xfe, 0x95, 0xdc, 0x3b, 0x81, 0x78, 0x78, 0xfb,
+  0xd2, 0x7a, 0x50, 0xec, 0x2e, 0xc3, 0xd8, 0xe1, 0xdf, 0x1c, 0x4d, 0x14,
+  0xfa, 0xac, 0x42, 0xd4, 0x16, 0x87, 0xbc, 0xeb, 0x24, 0x63, 0x2c, 0x73,
+  0x67, 0x04, 0xde, 0x60, 0x50, 0xbe, 0x8f, 0xbb, 0x51, 0x21, 0xd1, 0x6c,
+  0xc7, 0xac, 0x4e, 0x2a, 0x23, 0xc6, 0x20, 0xed, 0x13, 0x50, 0xf0, 0x67,
+  0xc0, 0x45, 0xd5, 0x27, 0x71, 0xb6, 0x12, 0x4e, 0xcf, 0x94, 0x6f, 0x47,
+  0x81, 0x53, 0x5f, 0xde, 0xa3, 0xc1, 0x16, 0xaf, 0xfd, 0x19, 0x9b, 0xbe,
+  0x31, 0xe3, 0x57, 0xd7, 0x70, 0x84, 0xdb, 0xe2, 0x37, 0x3c, 0x9b, 0x0a,
+  0xb6, 0xed, 0x82, 0x74, 0x1d, 0x41, 0x94, 0xb6, 0xe3, 0x47, 0x50, 0xc4,
+  0x6f, 0x6e, 0x35, 0x68, 0x69, 0xfc, 0x36, 0xf6, 0x6f, 0x93, 0x1e, 0xaa,
+  0x07, 0x92, 0xc7, 0x45, 0x57, 0x8f, 0x45, 0x46, 0x20, 0x8f, 0x8c, 0x6e,
+  0xe6, 0xbf, 0x98, 0xc2, 0x7e, 0xd1, 0x70, 0x7e, 0xb1, 0x66, 0x04, 0xac,
+  0x8f, 0xfe, 0xfa, 0x51, 0x5d, 0x83, 0x47, 0xf9, 0xd8, 0x1d, 0x15, 0x83,
+  0xd7, 0x63, 0x79, 0x04, 0xdf, 0x81, 0xeb, 0x88, 0xa4, 0x20, 0x51, 0xab,
+  0x15, 0xb9, 0x96, 0x9f, 0x8b, 0x6b, 0xc9, 0x78, 0x56, 0xd6, 0xe4, 0xbf,
+  0x4f, 0xeb, 0x57, 0xad, 0x85, 0xb4, 0xa4, 0x87, 0xd5, 0x2e, 0x87, 0x4e,
+  0x05, 0xc5, 0xab, 0x02, 0x4c, 0x90, 0x5c, 0xfc, 0x7d, 0xa7, 0xa3, 0x40,
+  0x53, 0x15, 0x04, 0x81, 0x9c, 0x98, 0xa5, 0x72, 0xad, 0x65, 0x39, 0xfd,
+  0xf2, 0x9e, 0x4b, 0x32, 0x72, 0x6c, 0xdf, 0x97, 0x16, 0xca, 0x97, 0xea,
+  0x21, 0x58, 0x65, 0x00, 0x08, 0x5b, 0x23, 0xde, 0x2e, 0xb2, 0x45, 0x2a,
+  0x30, 0x5f, 0x10, 0x01, 0x88, 0xf9, 0x24, 0xbf, 0xdc, 0x4e, 0xdb, 0x89,
+  0x18, 0x06, 0x37, 0xc7, 0x6a, 0x8e, 0xa2, 0x31, 0x8d, 0xd1, 0x3e, 0xff,
+  0xe1, 0xd5, 0x62, 0x08, 0xb3, 0x01, 0x46, 0xd3, 0x76, 0xa2, 0x55, 0xac,
+  0x98, 0x4f, 0xd9, 0x2e, 0xfb, 0x9e, 0xc5, 0xcc, 0x7d, 0xa9, 0x99, 0xc7,
+  0x31, 0xdd, 0x89, 0x04, 0xe8, 0x6d, 0x5b, 0xd1, 0xbd, 0x70, 0x1d, 0x7a,
+  0xea, 0xe4, 0xe4, 0x0b, 0x3d, 0xe3, 0x3b, 0x17, 0xa3, 0xb8, 0x77, 0x0d,
+  0x48, 0x2f, 0xc6, 0xba, 0xf6, 0xf0, 0xee, 0x93, 0x1c, 0x5d, 0xc8, 0x52,
+  0xd6, 0xf2, 0xd1, 0x3b, 0x44, 0x46, 0x36, 0x68, 0xae, 0xf0, 0xc5, 0x32,
+  0x47, 0x6a, 0xb8, 0x6e, 0x5e, 0x3a, 0x67, 0x00, 0x72, 0x24, 0x87, 0x4d,
+  0x6d, 0xa9, 0x49, 0x75, 0x78, 0x36, 0x91, 0x6c, 0x61, 0x63, 0xea, 0x72,
+  0x51, 0x0d, 0x25, 0xc3, 0xee, 0x9a, 0x07, 0xa1, 0x3c, 0x3f, 0xee, 0x14,
+  0xaa, 0xac, 0x81, 0x30, 0x23, 0xe7, 0x5f, 0xf2, 0xce, 0x3b, 0xe0, 0x21,
+  0x7c, 0x1b, 0x6a, 0xdb, 0xb7, 0x6d, 0x52, 0x8c, 0x34, 0xfa, 0xca, 0x4a,
+  0x74, 0xd8, 0xcc, 0x62, 0x6e, 0x52, 0x09, 0x1a, 0x5d, 0x3e, 0xaa, 0x34,
+  0x02, 0xaa, 0x96, 0x99, 0xfb, 0x74, 0xe6, 0xaa, 0xa2, 0x57, 0xf6, 0xbc,
+  0x68, 0x04, 0x0b, 0x70, 0x99, 0xa4, 0x26, 0xe9, 0xa5, 0x2a, 0xf9, 0x3d,
+  0x39, 0x57, 0xc4, 0x8b, 0x50, 0x18, 0x27, 0x2b, 0x2b, 0x79, 0x29, 0xae,
+  0x6c, 0xf6, 0x38, 0x0c, 0xbf, 0x52, 0x99, 0x2c, 0xeb, 0x03, 0x1b, 0xda,
+  0x48, 0xdc, 0xc6, 0x08, 0xe2, 0x31, 0x3c, 0xd7, 0x5d, 0xe7, 0x21, 0xd2,
+  0xc4, 0x32, 0x5a, 0x08, 0x73, 0x56, 0x3e, 0x9a, 0xa8, 0x18, 0x44, 0x2b,
+  0x84, 0x61, 0xbc, 0x6d, 0x62, 0xcc, 0x8d, 0x36, 0x75, 0xff, 0xbe, 0xa1,
+  0x75, 0x52, 0xbb, 0xc6, 0x90, 0x2f, 0x91, 0x01, 0x6b, 0xcd, 0xb5, 0x12,
+  0xd0, 0xe2, 0x49, 0x3d, 0x25, 0x79, 0x73, 0x36, 0x42, 0x6f, 0x14, 0x44,
+  0xfc, 0xdc, 0xd6, 0xbe, 0x4e, 0x1f, 0x10, 0x9e, 0xd5, 0xbd, 0xe4, 0x55,
+  0x2f, 0x49, 0x05, 0x45, 0xa6, 0xa8, 0xf3, 0x18, 0x47, 0x7a, 0x23, 0xa5,
+  0x92, 0x63, 0x6c, 0x69, 0x9a, 0x7f, 0xcb, 0x37, 0xdc, 0x94, 0xb5, 0x1c,
+  0xc7, 0xfc, 0x0f, 0x3c, 0xf0, 0xe7, 0xb7, 0x54, 0x9d, 0x8b, 0xf9, 0x20,
+  0xf4, 0x88, 0xb2, 0x57, 0x9d, 0xe0, 0x2a, 0x95, 0xb3, 0xf9, 0x2e, 0xdb,
+  0x40, 0xb4, 0xe6, 0xfe, 0x87, 0x32, 0x6d, 0xc6, 0x62, 0xb0, 0x18, 0x44,
+  0xdf, 0xb7, 0x41, 0x38, 0x6d, 0x1e, 0x44, 0x85, 0xa2, 0x33, 0xb7, 0xea,
+  0xa4, 0x8a, 0x81, 0x93, 0x1c, 0xa5, 0x46, 0xe4, 0xfc, 0x4f, 0x2f, 0xa4,
+  0x3c, 0x87, 0x48, 0x07, 0x94, 0xb7, 0x06, 0x27, 0xe8, 0x8b, 0x50, 0x03,
+  0x3b, 0xf6, 0x54, 0xd7, 0x85, 0xfb, 0x7b, 0xd7, 0x0d, 0x6c, 0x37, 0x47,
+  0x75, 0x21, 0xd5, 0xb9, 0xc1, 0xc1, 0x1d, 0x60, 0xf8, 0x73, 0x41, 0x41,
+  0x02, 0xb4, 0x59, 0x30, 0x7b, 0x37, 0xea, 0x54, 0x0d, 0x2f, 0x38, 0x06,
+  0x85, 0xf7, 0x6e, 0xb0, 0x46, 0x39, 0x63, 0x88, 0x7b, 0x4b, 0xa3, 0x10,
+  0x2f, 0xda, 0x52, 0x1d, 0x2c, 0xe4, 0x05, 0xf7, 0xe9, 0x3e, 0x47, 0xaa,
+  0x2f, 0x5d, 0x18, 0xcf, 0xef, 0xb0, 0x92, 0xe4, 0x84, 0x47, 0x5a, 0x33,
+  0x9f, 0xda, 0xc0, 0xcb, 0x3e, 0xf8, 0x70, 0x20, 0xad, 0xad, 0x3e, 0xe7,
+  0x47, 0x8e, 0x0b, 0xbf, 0x19, 0xd7, 0xed, 0x5a, 0x3c, 0xb7, 0x36, 0x7b,
+  0xa5, 0xfc, 0xe8, 0xb4, 0x19, 0x48, 0x7a, 0x51, 0x58, 0xa9, 0x21, 0x45,
+  0xf6, 0x30, 0x12, 0x17, 0x61, 0xec, 0x12, 0xea, 0x44, 0x4f, 0x49, 0x1c,
+  0xd2, 0xfc, 0xb6, 0xb6, 0x9e, 0x16, 0x61, 0x35, 0x49, 0x9b, 0xf5, 0xba,
+  0xe7, 0x94, 0xf7, 0xf6, 0x07, 0x06, 0x64, 0xcf, 0x15, 0xbe, 0x5d, 0xe8,
+  0xee, 0x62, 0xb7, 0xe9, 0x61, 0xba, 0xdd, 0x7d, 0xe4, 0x5f, 0xaa, 0x71,
+  0xa2, 0x52, 0x5a, 0xc9, 0xd0, 0xd3, 0x04, 0x4b, 0x8c, 0x11, 0x61, 0x04,
+  0x2a, 0x9e, 0x31, 0x44, 0x4b, 0xe6, 0xf7, 0xe9, 0x2a, 0xcb, 0x5c, 0xd8,
+  0x5e, 0xea, 0x95, 0x22, 0x26, 0x7d, 0x2d, 0x58, 0x67, 0x94, 0x4b, 0xe6,
+  0x3f, 0x42, 0xe4, 0x03, 0xfb, 0xb7, 0x52, 0x98, 0x18, 0x96, 0x3b, 0x18,
+  0x9e, 0x3d, 0xf0, 0x20, 0x75, 0xfb, 0xed, 0x5d, 0x76, 0x52, 0x9f, 0x86,
+  0xc5, 0x8c, 0x48, 0xca, 0xb6, 0xd0, 0x68, 0x93, 0xc1, 0x21, 0xfb, 0x4a,
+  0x67, 0x65, 0xff, 0x1f, 0xcf, 0x06, 0x17, 0xa4, 0x92, 0x75, 0x19, 0xfd,
+  0x38, 0x86, 0xe5, 0x0b, 0x97, 0x0b, 0xd9, 0xe4, 0x4a, 0xae, 0x27, 0x92,
+  0xa7, 0xb2, 0x89, 0x89, 0x86, 0x5f, 0x78, 0xd6, 0x60, 0x91, 0x99, 0xcb,
+  0x8f, 0x1e, 0xd6, 0x7f, 0x16, 0x1a, 0xc4, 0x00, 0xde, 0x2d, 0xfc, 0x7e,
+  0x06, 0xb5, 0xd5, 0x6c, 0x75, 0x37, 0x23, 0x24, 0xe5, 0xa9, 0xe3, 0xc3,
+  0x5b, 0x23, 0xb7, 0xd8, 0xe8, 0x67, 0x63, 0xdc, 0xad, 0xbc, 0xcd, 0xcc,
+  0xa2, 0x64, 0x18, 0xe5, 0x7a, 0x5e, 0xb7, 0x83, 0x5a, 0x9b, 0x2f, 0x99,
+  0x84, 0x00, 0x7d, 0xce, 0xd8, 0x3d, 0x81, 0x86, 0x19, 0x6e, 0x23, 0x6e,
+  0x4a, 0x43, 0x1f, 0x05, 0xb8, 0x7c, 0xf3, 0x93, 0xf0, 0xa5, 0x5b, 0xb4,
+  0xaf, 0x46, 0xd1, 0x2c, 0xdd, 0x15, 0xb1, 0xd6, 0x6d, 0x20, 0x7c, 0x74,
+  0x35, 0xa9, 0xdb, 0x2a, 0xf4, 0xab, 0x31, 0x3d, 0x3d, 0x35, 0xc8, 0x9c,
+  0x2b, 0x26, 0x76, 0x0b, 0x60, 0x6f, 0xaa, 0x01, 0x61, 0x5b, 0xf1, 0x03,
+  0x96, 0xb9, 0x07, 0x7b, 0xcb, 0x94, 0x1b, 0x49, 0xb7, 0x0c, 0xcb, 0x87,
+  0x75, 0x1f, 0x3b, 0x1f, 0x2b, 0x69, 0x46, 0x2a, 0xcd, 0xc1, 0xa9, 0x87,
+  0x41, 0xa1, 0xfb, 0x2c, 0xc0, 0x5a, 0xd8, 0xea, 0xaf, 0xcd, 0xe4, 0x7c,
+  0x3a, 0x2f, 0x4c, 0xe9, 0x27, 0x07, 0xfd, 0x9b, 0xa9, 0xb9, 0xf6, 0x1c,
+  0x01, 0x97, 0x1f, 0x5e, 0x68, 0x50, 0x36, 0x9e, 0x34, 0x3d, 0xdc, 0xe2,
+  0x7d, 0x15, 0x6b, 0xf6, 0x2c, 0x32, 0x6f, 0xaf, 0xb0, 0xa0, 0x4e, 0xa9,
+  0x06, 0x07, 0xb3, 0xca, 0x2e, 0xf2, 0x89, 0xfd, 0xd7, 0x0e, 0xa2, 0xaa,
+  0x7d, 0x1d, 0xf3, 0xd8, 0x22, 0x22, 0x5b, 0x93, 0xfc, 0xf3, 0xd7, 0x2a,
+  0x7b, 0xcd, 0x28, 0xce, 0xdc, 0x48, 0x00, 0xd3, 0x68, 0xc4, 0xfb, 0xa5,
+  0x65, 0xcf, 0xe6, 0xb9, 0xe1, 0x40, 0x65, 0x9c, 0x1b, 0x31, 0x44, 0x8b,
+  0x0f, 0xbd, 0x6d, 0x1f, 0xe4, 0xd5, 0x62, 0x83, 0xd0, 0x1a, 0x5a, 0xfb,
+  0xf9, 0x1e, 0xc7, 0xfd, 0xd9, 0xb0, 0x27, 0x4c, 0x8f, 0xc5, 0xbe, 0xfd,
+  0xef, 0x9b, 0x2f, 0xe2, 0x85, 0xbf, 0xc1, 0x20, 0xa5, 0x49, 0x06, 0xad,
+  0xb0, 0x7e, 0x26, 0xcb, 0x5b, 0x3c, 0x6f, 0x4a, 0x1c, 0x4a, 0xca, 0x82,
+  0x21, 0x06, 0x6b, 0x60, 0x26, 0x21, 0xe6, 0xc7, 0xe7, 0x85, 0x22, 0x4e,
+  0xa4, 0x3c, 0xa2, 0xed, 0xc3, 0xe7, 0xa5, 0x7d, 0x0e, 0x05, 0xa3, 0x48,
+  0x32, 0xa6, 0xdd, 0x06, 0xec, 0x1c, 0xe9, 0xe4, 0xd1, 0xea, 0x3b, 0xbb,
+  0x28, 0xd0, 0x55, 0x17, 0x8d, 0xc7, 0x5c, 0x2f, 0x54, 0x50, 0x44, 0x69,
+  0x1b, 0x84, 0x86, 0x44, 0x67, 0xa8, 0xa7, 0x52, 0xef, 0xa8, 0xd7, 0x8c,
+  0xf0, 0xc9, 0xd7, 0xb1, 0xc1, 0x29, 0xf1, 0xf1, 0xf0, 0x55, 0xf3, 0x4e,
+  0x62, 0xfd, 0xfe, 0x6a, 0xcd, 0x77, 0x74, 0xcd, 0x96, 0x99, 0x04, 0x16,
+  0x0f, 0x73, 0x85, 0xcc, 0xc7, 0x15, 0xca, 0xb5, 0xba, 0xc4, 0x89, 0x83,
+  0xdf, 0x24, 0xc3, 0x09, 0xc4, 0x3e, 0x70, 0xdb, 0x4c, 0x8d, 0x44, 0x3d,
+  0x34, 0xf1, 0x6f, 0x36, 0xd3, 0xf2, 0x9e, 0x69, 0x93, 0x23, 0x3d, 0xe9,
+  0x56, 0x5f, 0x35, 0x18, 0x81, 0xfc, 0x35, 0x7b, 0xa1, 0x5c, 0xd4, 0x9c,
+  0xe1, 0x6d, 0xad, 0x92, 0xc5, 0xb9, 0x21, 0x9f, 0x79, 0x55, 0x6a, 0x36,
+  0x22, 0x1f, 0xab, 0x3d, 0x28, 0xb0, 0x3a, 0x6e, 0xc6, 0x39, 0xa2, 0x97,
+  0x8c, 0x23, 0xa5, 0x1a, 0xa4, 0x3b, 0xd0, 0x60, 0x6e, 0x19, 0xf2, 0x4c,
+  0xf7, 0xb2, 0x46, 0x0f, 0x2f, 0x6e, 0xa1, 0x17, 0xf5, 0xb4, 0x8a, 0x98,
+  0xd0, 0x17, 0xab, 0x91, 0xc0, 0xd1, 0x9f, 0xdc, 0xde, 0x74, 0x2a, 0xab,
+  0x11, 0x4e, 0x0c, 0x69, 0xbb, 0xb1, 0xb5, 0xbc, 0xb0, 0x48, 0x66, 0x99,
+  0xe3, 0x91, 0xc3, 0x5c, 0x1f, 0x8c, 0x19, 0x1f, 0xfd, 0xf9, 0x5b, 0xc1,
+  0x6c, 0xf7, 0xd2, 0xe5, 0x40, 0x07, 0xdc, 0xff, 0x7d, 0x6d, 0x58, 0x33,
+  0x88, 0xc9, 0xd5, 0xea, 0x92, 0x9a, 0x38, 0xa4, 0xb6, 0x64, 0xfb, 0xc0,
+  0x95, 0xb0, 0xa7, 0x42, 0x60, 0xf5, 0x13, 0xd9, 0x5f, 0xe9, 0x2c, 0xb9,
+  0x8a, 0x46, 0x78, 0x1d, 0x0c, 0xe7, 0x06, 0x45, 0x9d, 0xa1, 0xdb, 0x9f,
+  0x11, 0xdd, 0x15, 0x84, 0x57, 0xbc, 0x9c, 0x1e, 0xad, 0xe5, 0x6d, 0x63,
+  0xef, 0x88, 0x9e, 0xcb, 0xd7, 0x40, 0x49, 0x9a, 0x40, 0x80, 0x8b, 0x09,
+  0x36, 0x4d, 0xf5, 0x40, 0x34, 0x2b, 0xd3, 0x60, 0xfc, 0x63, 0xd7, 0x8d,
+  0x6b, 0x66, 0x41, 0x0c, 0x67, 0x52, 0x05, 0xf6, 0xed, 0xbb, 0x65, 0xd3,
+  0xe5, 0xcd, 0x9a, 0xe5, 0x3b, 0xad, 0xa1, 0xaa, 0x81, 0x86, 0x46, 0xa6,
+  0x18, 0x77, 0xbc, 0x7c, 0xd7, 0x16, 0x54, 0xb3, 0x0b, 0xdd, 0xb4, 0x3e,
+  0x96, 0x00, 0x16, 0xc2, 0xd3, 0x89, 0x48, 0x2f, 0x93, 0x54, 0xa8, 0x78,
+  0x4e, 0x35, 0x5c, 0x19, 0xd9, 0x20, 0x81, 0x10, 0x56, 0x76, 0xbe, 0x38,
+  0xad, 0xbf, 0xf9, 0x00, 0xc4, 0x4b, 0xc7, 0x54, 0xd9, 0xf5, 0x4e, 0xbd,
+  0xdf, 0x5c, 0x1b, 0x29, 0xf0, 0xe9, 0xd0, 0xa6, 0xab, 0xf6, 0x54, 0x02,
+  0x08, 0x1f, 0xdf, 0x8f, 0x8d, 0xeb, 0xb1, 0x22, 0x6c, 0x37, 0xc1, 0x55,
+  0x99, 0x18, 0x67, 0x79, 0x8e, 0xd4, 0x97, 0x36, 0xd4, 0x5b, 0x7e, 0x14,
+  0xe6, 0xa5, 0x43, 0xe5, 0xd9, 0x29, 0x4e, 0x7d, 0xb4, 0x86, 0xaa, 0xab,
+  0x43, 0xc5, 0x3e, 0xe6, 0x0c, 0xc5, 0xe8, 0xb6, 0x8b, 0x0c, 0x5c, 0x9f,
+  0x67, 0x87, 0xe5, 0x72, 0xb5, 0xd3, 0xc1, 0xee, 0x08, 0x76, 0x8d, 0xd3,
+  0x71, 0x67, 0xfc, 0x6a, 0x8a, 0x6f, 0x05, 0x38, 0xfd, 0x79, 0x7a, 0x71,
+  0xfb, 0x22, 0xe8, 0xf3, 0xa4, 0x38, 0x54, 0x01, 0xe0, 0xf1, 0xf9, 0xb9,
+  0xab, 0x8a, 0xaf, 0x51, 0xd6, 0x3f, 0xbd, 0x8b, 0x8f, 0x81, 0x04, 0xce,
+  0x5a, 0x9a, 0x4b, 0x88, 0xee, 0x49, 0x77, 0x3d, 0x7a, 0xf8, 0x62, 0xfb,
+  0xb6, 0x29, 0x7f, 0x9c, 0x8e, 0xfc, 0x9a, 0x1f, 0xf3, 0xc1, 0x58, 0x8f,
+  0x17, 0x11, 0xeb, 0xeb, 0x00, 0x2f, 0x0c, 0x61, 0x86, 0xdd, 0xbd, 0x3c,
+  0x62, 0x5d, 0xa0, 0xcc, 0x93, 0xb8, 0x20, 0x19, 0xf8, 0x7d, 0xde, 0x24,
+  0x4b, 0x58, 0x9b, 0xe6, 0x0b, 0x47, 0x7b, 0x0e, 0xc9, 0xcd, 0x35, 0x8d,
+  0x2b, 0xae, 0x94, 0x4f, 0x6b, 0xe7, 0xb4, 0x8e, 0x42, 0xbb, 0xdb, 0x07,
+  0x1f, 0x3f, 0xca, 0xd5, 0x98, 0xa3, 0x3e, 0xfa, 0xe4, 0x7e, 0xa3, 0x57,
+  0x31, 0xae, 0xd5, 0x61, 0x67, 0xd7, 0xc2, 0x7e, 0x78, 0x7e, 0x5a, 0x0c,
+  0x23, 0xa4, 0xb4, 0x5e, 0x9f, 0xf9, 0x65, 0x28, 0x1d, 0xde, 0x98, 0x1a,
+  0xf7, 0x36, 0x55, 0x0b, 0x83, 0xd8, 0x9e, 0x02, 0x05, 0x38, 0x70, 0xcd,
+  0x68, 0x91, 0x2a, 0x28, 0xff, 0x1a, 0x72, 0x9c, 0xb3, 0x47, 0xd4, 0xff,
+  0xe6, 0x47, 0x50, 0xa2, 0x03, 0x1f, 0x85, 0x97, 0xc0, 0x13, 0xb0, 0xc0,
+  0x28, 0x0a, 0x8c, 0x60, 0x02, 0x56, 0xc6, 0x95, 0x93, 0x26, 0x0e, 0x08,
+  0xb3, 0x40, 0x40, 0xc4, 0x47, 0xcd, 0x61, 0xb6, 0x05, 0x16, 0x24, 0x8b,
+  0x1b, 0x02, 0x6e, 0x35, 0x82, 0x8d, 0xd6, 0x2b, 0x25, 0x8f, 0x6f, 0x5e,
+  0xca, 0x51, 0xc8, 0xc6, 0x1a, 0x55, 0xe5, 0x60, 0x08, 0x27, 0x83, 0x7f,
+  0xac, 0x6a, 0xac, 0x0b, 0x11, 0xc2, 0xd9, 0x50, 0x6b, 0xe4, 0xee, 0x5c,
+  0x02, 0x05, 0xb6, 0x45, 0x0b, 0x61, 0x46, 0x44, 0x27, 0x00, 0x69, 0xd4,
+  0x96, 0xda, 0xad, 0xe4, 0xf3, 0x19, 0x4a, 0xe5, 0x67, 0xd0, 0x99, 0x8d,
+  0xce, 0x99, 0x64, 0x84, 0x81, 0xa3, 0x15, 0x50, 0x38, 0xef, 0x05, 0x5f,
+  0x28, 0x7e, 0x11, 0x66, 0x8e, 0x47, 0xbc, 0xc0, 0x1d, 0xc7, 0x49, 0xd5,
+  0xfd, 0x24, 0x73, 0x3f, 0xae, 0x89, 0x64, 0x75, 0xe1, 0x21, 0x2b, 0x8f,
+  0x36, 0xd0, 0x12, 0x9a, 0xf9, 0x63, 0x33, 0x16, 0x2e, 0xd1, 0xf1, 0xbf,
+  0x3a, 0x55, 0xb9, 0xdf, 0x61, 0xde, 0x2d, 0x97, 0x7a, 0x28, 0xa2, 0x60,
+  0xe1, 0x5e, 0xdd, 0xc0, 0x6f, 0x20, 0xe5, 0x20, 0x4b, 0xe0, 0xbb, 0xc5,
+  0x0d, 0xc8, 0x1e, 0xf6, 0xbd, 0xab, 0x2e, 0x2a, 0xa5, 0x1d, 0xd9, 0xf6,
+  0x82, 0x04, 0xf1, 0x43, 0x97, 0xaa, 0x94, 0x3a, 0x85, 0xb6, 0xff, 0xd1,
+  0x23, 0x82, 0xcf, 0x2a, 0xfd, 0xea, 0x12, 0x12, 0x3a, 0x0b, 0x81, 0xa9,
+  0x07, 0x0e, 0xdc, 0x72, 0x9d, 0x41, 0xc0, 0xe9, 0x41, 0x21, 0x88, 0xeb,
+  0xb8, 0x26, 0xa7, 0x09, 0x91, 0x37, 0x47, 0xfb, 0x30, 0x23, 0x96, 0x68,
+  0x2d, 0x8a, 0x2d, 0x23, 0x34, 0x00, 0x7d, 0x1a, 0x50, 0x36, 0x96, 0xb2,
+  0x35, 0x73, 0xc6, 0x27, 0x41, 0x72, 0x6f, 0x7c, 0xd0, 0xe9, 0x94, 0x2a,
+  0x66, 0x24, 0x2e, 0xf9, 0x31, 0x22, 0x2b, 0x73, 0x01, 0x9a, 0xa1, 0x73,
+  0xc1, 0x93, 0x53, 0xd9, 0x2c, 0x79, 0xf3, 0x9e, 0x2a, 0x8e, 0xbb, 0x21,
+  0x68, 0x38, 0x25, 0x10, 0x1a, 0x71, 0xb6, 0x00, 0x36, 0x50, 0x50, 0x3c,
+  0xfd, 0xa0, 0xce, 0x73, 0x81, 0x53, 0x32, 0x01, 0xd3, 0x60, 0x9d, 0xd3,
+  0xaf, 0x18, 0xd6, 0x3a, 0x59, 0x40, 0x4d, 0x15, 0x1b, 0x5e, 0x8d, 0xaf,
+  0xa7, 0xa5, 0x51, 0x31, 0x07, 0x88, 0xae, 0xac, 0x30, 0xf6, 0x50, 0xdc,
+  0xd9, 0x3a, 0x55, 0x35, 0x2c, 0xca, 0x86, 0x4b, 0x46, 0x4b, 0x02, 0xd1,
+  0x62, 0x5e, 0xe4, 0x51, 0x40, 0x63, 0x9a, 0x2c, 0x4a, 0x1a, 0x66, 0xfa,
+  0x5a, 0xcf, 0xe5, 0x59, 0x83, 0x38, 0x3e, 0x9e, 0xfd, 0x4d, 0x5d, 0x83,
+  0xb3, 0x00, 0x6b, 0x72, 0x42, 0x4d, 0x2f, 0x5f, 0x2a, 0xba, 0x3b, 0xff,
+  0x9e, 0x1f, 0x64, 0x31, 0x35, 0x32, 0xf7, 0x31, 0xd3, 0xef, 0xfe, 0xa8,
+  0x45, 0xc6, 0xae, 0x77, 0xa2, 0xa1, 0x66, 0x35, 0xf4, 0x29, 0x30, 0xbc,
+  0xbd, 0x0b, 0xe3, 0x8f, 0x1b, 0x3b, 0x8c, 0x92, 0xc0, 0x93, 0x3a, 0x14,
+  0x9d, 0x9e, 0x96, 0xea, 0x35, 0x68, 0x88, 0x28, 0x33, 0xc1, 0xc4, 0xe4,
+  0x9f, 0x9b, 0x8d, 0x43, 0x48, 0x12, 0xf8, 0xcc, 0x1e, 0x02, 0x77, 0xd1,
+  0x88, 0xf0, 0xae, 0xf3, 0xe1, 0x8f, 0x85, 0x79, 0x54, 0x65, 0x9e, 0x8f,
+  0xd6, 0x50, 0x35, 0xcc, 0xdc, 0x43, 0x61, 0xe1, 0x31, 0x7f, 0xd0, 0x38,
+  0x43, 0x9b, 0x1a, 0xfe, 0x12, 0x79, 0xf2, 0xbc, 0x66, 0xf0, 0x11, 0xc0,
+  0x03, 0x43, 0xd5, 0xba, 0x4d, 0x11, 0x79, 0xa6, 0x3b, 0x4d, 0xed, 0xde,
+  0x1a, 0xa3, 0x0e, 0xba, 0x1f, 0x24, 0x90, 0x6b, 0x0e, 0xe2, 0x92, 0xc7,
+  0xfc, 0x67, 0xd7, 0x86, 0x4a, 0xcc, 0xa1, 0x7f, 0x69, 0xa5, 0xb7, 0xca,
+  0x5c, 0x62, 0xff, 0x69, 0x12, 0x3d, 0x2e, 0xc0, 0xcd, 0x5c, 0xed, 0x13,
+  0x36, 0x92, 0x35, 0xa7, 0xd3, 0xda, 0x23, 0x99, 0x8d, 0xf3, 0x2a, 0x07,
+  0x98, 0xa0, 0x8f, 0x38, 0x1d, 0x05, 0x0c, 0x84, 0x4f, 0x51, 0x7f, 0x56,
+  0xb3, 0x1a, 0xab, 0x85, 0x5c, 0xad, 0x72, 0x50, 0x71, 0x14, 0x0f, 0x1a,
+  0x51, 0xac, 0x0d, 0xab, 0x96, 0x09, 0x39, 0x1c, 0xb8, 0xcc, 0x64, 0x2c,
+  0x03, 0x7f, 0x65, 0x3f, 0xe7, 0x1b, 0x9c, 0xc3, 0x3d, 0xf2, 0xa3, 0xee,
+  0x59, 0x9d, 0x9f, 0xcf, 0xbd, 0xd4, 0xba, 0xb1, 0x12, 0x98, 0x0d, 0x59,
+  0x64, 0x7e, 0xfe, 0x44, 0xe2, 0x8a, 0x64, 0xda, 0x0c, 0x63, 0x00, 0x0d,
+  0x19, 0x0f, 0x35, 0xc2, 0xbf, 0x6a, 0x24, 0x19, 0x41, 0xdb, 0xe3, 0xdf,
+  0xc9, 0x83, 0x9c, 0x03, 0xb3, 0xd0, 0xb6, 0x21, 0xa9, 0xca, 0xa7, 0x35,
+  0xa6, 0x38, 0x39, 0xd9, 0x53, 0x08, 0xb8, 0xc2, 0xb3, 0x13, 0xda, 0xd4,
+  0xc7, 0x50, 0xa4, 0xaa, 0xe4, 0xad, 0x2f, 0x93, 0xef, 0x57, 0x40, 0x72,
+  0x4b, 0x34, 0x42, 0x86, 0x17, 0x6e, 0x66, 0x4a, 0x12, 0x26, 0x02, 0xf7,
+  0x09, 0x31, 0xfd, 0x83, 0x12, 0x84, 0x00, 0x08, 0xb9, 0xb2, 0x42, 0x04,
+  0x08, 0xb5, 0x9a, 0x34, 0xc7, 0xad, 0xa3, 0x1c, 0x21, 0x91, 0xd2, 0x89,
+  0xdd, 0x72, 0x71, 0xcd, 0xc1, 0x59, 0x77, 0xf2, 0x63, 0xa8, 0x51, 0x98,
+  0xf2, 0x00, 0xbc, 0xb6, 0x00, 0xe2, 0x0e, 0xf5, 0x9a, 0x35, 0x9e, 0x7a,
+  0x3f, 0x96, 0x6b, 0x09, 0xb2, 0xbd, 0x00, 0xfd, 0xc3, 0x1e, 0x9a, 0xec,
+  0xee, 0x21, 0x84, 0xb2, 0x8a, 0x5b, 0xf7, 0x20, 0x98, 0x2e, 0xe3, 0x82,
+  0x69, 0x21, 0x33, 0x01, 0x2f, 0x08, 0xbf, 0x4a, 0xd1, 0x0c, 0x42, 0xa9,
+  0x45, 0x2e, 0x77, 0x30, 0x8b, 0x68, 0x1f, 0x15, 0x85, 0xc4, 0x26, 0x5b,
+  0x70, 0xa9, 0xb1, 0x2b, 0xd8, 0x9e, 0x29, 0x1f, 0xe2, 0x8e, 0x8d, 0x13,
+  0xaa, 0x69, 0xc3, 0x73, 0x8d, 0x58, 0x07, 0xf9, 0xda, 0x0c, 0x33, 0x18,
+  0x7b, 0x4c, 0xc1, 0xc1, 0xf0, 0x18, 0x45, 0xde, 0x38, 0xa2, 0x0f, 0x7b,
+  0xb1, 0x7e, 0x54, 0x3e, 0x7d, 0x4e, 0x40, 0x83, 0xec, 0x84, 0x46, 0x2b,
+  0xe6, 0x44, 0x6d, 0x0f, 0x52, 0x6f, 0x14, 0x99, 0xcb, 0x1c, 0x1d, 0x96,
+  0x0a, 0x4e, 0x10, 0x7d, 0xbe, 0x66, 0x00, 0xf0, 0xd8, 0x93, 0x9a, 0xa7,
+  0x00, 0x4f, 0x78, 0x01, 0x57, 0xc6, 0x4c, 0xf7, 0x7c, 0xa1, 0x26, 0x5b,
+  0x6a, 0xa0, 0x5f, 0xb2, 0xf2, 0x87, 0x6a, 0x4c, 0x7e, 0xfc, 0x91, 0xf7,
+  0x9c, 0xcb, 0x25, 0x47, 0x35, 0x3d, 0xae, 0x9d, 0x83, 0x25, 0x64, 0xd6,
+  0x6e, 0xc2, 0xc6, 0x15, 0x2f, 0x5f, 0xc3, 0x04, 0xb6, 0x64, 0x25, 0x47,
+  0x69, 0xba, 0x4b, 0xfb, 0xa8, 0xf0, 0x71, 0x4f, 0x78, 0x60, 0xd0, 0x2a,
+  0x06, 0xdb, 0x8c, 0x35, 0xd3, 0xcb, 0x79, 0x92, 0xe5, 0xd0, 0xeb, 0xbd,
+  0x28, 0xfd, 0x64, 0x56, 0x37, 0xad, 0xbd, 0x5d, 0xaa, 0x9d, 0x29, 0x59,
+  0x1a, 0xf2, 0xa7, 0xe7, 0xe7, 0xac, 0x92, 0x44, 0x5a, 0xf7, 0x5a, 0x08,
+  0xae, 0xd3, 0x7a, 0x8a, 0x0e, 0x1d, 0x60, 0x7f, 0xd7, 0x97, 0xcd, 0xaf,
+  0x82, 0x55, 0xa5, 0xf6, 0xb3, 0x1b, 0xaf, 0x6a, 0x4d, 0x3b, 0x8d, 0xf3,
+  0x6d, 0x4a, 0x28, 0x02, 0x6a, 0x45, 0xb0, 0xf2, 0x7b, 0xc4, 0x18, 0x7c,
+  0x1f, 0xcb, 0x8f, 0x66, 0x68, 0xa4, 0x87, 0xd7, 0x6a, 0xa5, 0x68, 0x43,
+  0x1e, 0x45, 0x33, 0x5f, 0x45, 0x56, 0x81, 0x33, 0x79, 0xb8, 0x58, 0x9f,
+  0x7c, 0xd0, 0x5f, 0xf3, 0x60, 0xfe, 0x31, 0x3c, 0x1f, 0x34, 0xb5, 0xa6,
+  0x36, 0x26, 0x99, 0xa6, 0xff, 0x3d, 0x06, 0x73, 0xfb, 0x0b, 0x69, 0xfa,
+  0xe4, 0x15, 0x7a, 0x76, 0xb7, 0xb8, 0xe8, 0xa2, 0x2d, 0x33, 0xfc, 0xa5,
+  0x43, 0xf4, 0x11, 0x02, 0x03, 0x94, 0x0c, 0x40, 0x3c, 0x28, 0xf6, 0x3d,
+  0xba, 0x34, 0x5c, 0x51, 0xc8, 0x0d, 0x68, 0x72, 0x8c, 0xda, 0x06, 0x65,
+  0x1c, 0xc8, 0x7f, 0x9b, 0x8f, 0x1e, 0x89, 0x8d, 0xbd, 0xec, 0x63, 0x7e,
+  0xcb, 0x7b, 0x65, 0xab, 0xc1, 0x0d, 0x9a, 0xd9, 0x36, 0xe1, 0xc8, 0x1e,
+  0x98, 0x1b, 0x46, 0x21, 0x9c, 0xa2, 0xc3, 0x70, 0x56, 0x36, 0x98, 0x1e,
+  0x69, 0xe7, 0x01, 0x03, 0x1f, 0x47, 0x5f, 0x23, 0x58, 0x9b, 0x95, 0x4f,
+  0x9a, 0x23, 0xb0, 0x92, 0x0e, 0x40, 0x5e, 0xaa, 0x6f, 0x14, 0x2d, 0x9f,
+  0x3e, 0xfb, 0xaf, 0x3b, 0x31, 0x1c, 0x54, 0x30, 0x97, 0xfa, 0x5c, 0x52,
+  0x3f, 0x48, 0xa7, 0xbc, 0xc7, 0x87, 0x1d, 0xd9, 0xbc, 0x14, 0x36, 0x15,
+  0x3b, 0xb5, 0x4d, 0x79, 0x79, 0x8c, 0x0b, 0xa5, 0xe0, 0xf2, 0x9d, 0xec,
+  0xa1, 0xbe, 0x18, 0x17, 0xaf, 0x6e, 0x65, 0x4d, 0x0a, 0xf5, 0xe8, 0x2e,
+  0xef, 0xa9, 0xf9, 0x8f, 0x17, 0x09, 0xb5, 0x70, 0xef, 0x56, 0xb3, 0xcc,
+  0x8d, 0x42, 0xb9, 0x02, 0x84, 0xef, 0x40, 0xc4, 0x95, 0x41, 0x25, 0x7b,
+  0x94, 0x05, 0x4d, 0xb2, 0x57, 0x2d, 0xf8, 0xa8, 0xe3, 0xc2, 0xa9, 0xd2,
+  0xcc, 0xc9, 0xd7, 0x2f, 0xeb, 0xf9, 0xe0, 0x83, 0x58, 0xf2, 0xac, 0x8e,
+  0xef, 0x0d, 0xaa, 0x95, 0x31, 0x5b, 0xd9, 0x32, 0x8c, 0xa2, 0x33, 0x6c,
+  0x2a, 0x58, 0xa8, 0x0a, 0x18, 0x32, 0xef, 0xb9, 0x75, 0x0c, 0xd5, 0x24,
+  0x6d, 0xeb, 0x34, 0x88, 0xe9, 0x80, 0x3e, 0x62, 0xc8, 0x4d, 0x4b, 0x8e,
+  0xaa, 0xc6, 0x36, 0x8f, 0xae, 0x91, 0x8b, 0x4e, 0xd5, 0x97, 0x34, 0x2e,
+  0x15, 0x75, 0x03, 0x9e, 0x41, 0x4b, 0x46, 0x30, 0xb4, 0xe9, 0x9b, 0x1f,
+  0xf7, 0x44, 0x34, 0x58, 0xcc, 0xfe, 0xbf, 0x23, 0x3c, 0x08, 0xa1, 0xe8,
+  0x0f, 0x2d, 0xcd, 0xa8, 0x52, 0x3d, 0x7d, 0x34, 0x5d, 0xcd, 0x27, 0x85,
+  0x76, 0x7b, 0xa9, 0x46, 0xed, 0xaa, 0x73, 0xcc, 0x35, 0x1f, 0xa4, 0x7c,
+  0xc3, 0x47, 0xfd, 0xad, 0xa2, 0x49, 0x51, 0xc7, 0x60, 0xc2, 0xf4, 0x59,
+  0x5f, 0x22, 0x85, 0x0f, 0x44, 0x5d, 0x45, 0xfa, 0xd8, 0x65, 0xc5, 0x35,
+  0x02, 0x0b, 0xb8, 0x05, 0xaf, 0xe7, 0x16, 0xe5, 0xb5, 0x3a, 0x27, 0x8d,
+  0xdb, 0x22, 0xe5, 0x93, 0x12, 0x75, 0xe1, 0xcc, 0xa7, 0x26, 0x13, 0x11,
+  0xde, 0x73, 0xed, 0x16, 0xdb, 0x77, 0x6c, 0x6f, 0x19, 0xa7, 0xaf, 0x91,
+  0x12, 0xb8, 0xa6, 0x47, 0xea, 0x36, 0x80, 0x99, 0x46, 0xdd, 0x03, 0xc8,
+  0x94, 0x62, 0xfb, 0xc9, 0x30, 0x60, 0x05, 0x4b, 0x74, 0xf6, 0x2c, 0x6e,
+  0x49, 0x5f, 0x5d, 0x56, 0x2e, 0x30, 0x1f, 0x82, 0xfc, 0xa2, 0x47, 0xf8,
+  0xa1, 0x09, 0x78, 0x33, 0x67, 0xf3, 0x30, 0xc0, 0x2d, 0x0a, 0xe0, 0xe9,
+  0x9d, 0x14, 0xc9, 0x14, 0x15, 0x21, 0xae, 0x4c, 0x7f, 0x2b, 0x05, 0x80,
+  0xdd, 0x2a, 0x40, 0x6a, 0x0f, 0xd8, 0x69, 0xda, 0x54, 0x40, 0xbb, 0x9d,
+  0xe4, 0xb6, 0xd2, 0xf6, 0x51, 0x51, 0xb5, 0xe8, 0xe6, 0xbc, 0x6b, 0x6b,
+  0x4d, 0x4c, 0x73, 0x57, 0x05, 0x74, 0x7d, 0x47, 0x3f, 0xc0, 0xdb, 0xaf,
+  0xcf, 0xf5, 0xe0, 0xe1, 0x00, 0xfb, 0xd7, 0x27, 0x1f, 0x05, 0x4c, 0x2a,
+  0xe6, 0x02, 0x08, 0xd5, 0x83, 0x16, 0x96, 0x22, 0x7a, 0xe3, 0x00, 0xf0,
+  0x94, 0x67, 0xe2, 0xe8, 0x16, 0xec, 0x12, 0xc5, 0x00, 0x30, 0xb5, 0xe4,
+  0x39, 0x0e, 0xed, 0xb9, 0x45, 0xf5, 0xca, 0x92, 0x2a, 0x71, 0xe5, 0x60,
+  0x69, 0xd6, 0xed, 0x12, 0xdb, 0x43, 0xe4, 0xc0, 0x41, 0xc5, 0xf6, 0x5d,
+  0xc2, 0xd1, 0xf5, 0x21, 0xea, 0xb0, 0xab, 0x21, 0x60, 0x15, 0x92, 0x36,
+  0xb1, 0x3f, 0x34, 0x27, 0x63, 0x29, 0xd5, 0x22, 0xf4, 0x47, 0x9f, 0x5c,
+  0xed, 0x9d, 0x27, 0xf2, 0xd7, 0xe6, 0x2f, 0x09, 0xb0, 0x28, 0x73, 0x7b,
+  0xed, 0xcd, 0xc3, 0xdf, 0x3f, 0xf1, 0x88, 0x90, 0xee, 0xe8, 0x01, 0xfb,
+  0x3a, 0x50, 0x0a, 0x71, 0x64, 0x4c, 0x0c, 0x7c, 0xc2, 0x26, 0x73, 0x91,
+  0x7c, 0xb6, 0x6c, 0xa5, 0xa0, 0x19, 0xea, 0x06, 0x7f, 0x46, 0x6f, 0x5b,
+  0xf2, 0x1a, 0x6e, 0x4f, 0xea, 0x67, 0xf1, 0xb2, 0xb2, 0x96, 0x9e, 0x9e,
+  0xf5, 0x0a, 0x5c, 0xe1, 0xf4, 0xd3, 0x64, 0x46, 0x1f, 0x0c, 0xf2, 0xd3,
+  0x4b, 0x63, 0x35, 0xe9, 0x93, 0x79, 0x92, 0x7b, 0xa6, 0x64, 0x98, 0x1e,
+  0x48, 0x79, 0x7a, 0xf7, 0x2c, 0x40, 0x31, 0xe0, 0x99, 0x52, 0xf1, 0xeb,
+  0x7a, 0xf9, 0x06, 0xbc, 0xfe, 0xd3, 0xbe, 0x87, 0x3c, 0x13, 0x86, 0x13,
+  0xff, 0xfb, 0xab, 0x4c, 0x90, 0xae, 0x45, 0xa2, 0x2a, 0x7b, 0x6b, 0x50,
+  0x78, 0x6c, 0x25, 0xc4, 0x6e, 0x2d, 0x4f, 0x4a, 0xb4, 0x2f, 0xe8, 0x5a,
+  0x63, 0x13, 0x0c, 0xea, 0xda, 0x25, 0x14, 0xc4, 0xaf, 0xa4, 0xfb, 0xb8,
+  0xe0, 0x4f, 0x6c, 0x3d, 0xe1, 0xa8, 0x96, 0x02, 0x89, 0xea, 0x55, 0x6c,
+  0xdd, 0x5d, 0x71, 0x55, 0x1b, 0x6e, 0x0d, 0x84, 0x41, 0x7c, 0x62, 0x5f,
+  0x72, 0x95, 0x49, 0x0c, 0x9d, 0xd6, 0x43, 0xc9, 0x90, 0x56, 0xe3, 0x18,
+  0x4b, 0xdd, 0x1a, 0xa8, 0xf5, 0x9e, 0x0d, 0x41, 0x73, 0x0f, 0x04, 0xb9,
+  0xac, 0xe5, 0xeb, 0x42, 0x6b, 0xfc, 0x8f, 0x6f, 0x0b, 0x10, 0x13, 0x29,
+  0x6b, 0xe8, 0xe8, 0x56, 0x64, 0x99, 0x7d, 0x57, 0x6f, 0xd6, 0xd2, 0xdd,
+  0xcb, 0x7d, 0x43, 0x3b, 0x6a, 0x2c, 0x29, 0xbd, 0xa9, 0xdf, 0xdb, 0xd7,
+  0x18, 0x12, 0x71, 0xdd, 0x43, 0x88, 0xd7, 0x92, 0x55, 0x29, 0x44, 0xe9,
+  0x74, 0x1a, 0x1d, 0x3b, 0xde, 0x97, 0x6f, 0x6f, 0xbb, 0xeb, 0x02, 0x4f,
+  0x83, 0x67, 0xbe, 0xc8, 0x04, 0xd3, 0x81, 0x77, 0x62, 0x2a, 0x06, 0x98,
+  0x83, 0x5d, 0xc3, 0xa5, 0xb0, 0x24, 0xb4, 0x4e, 0x56, 0x5f, 0x38, 0x4e,
+  0x13, 0x7b, 0xd7, 0x13, 0x71, 0x7c, 0x80, 0x10, 0xf5, 0x13, 0xbc, 0x36,
+  0xb2, 0x5e, 0x75, 0x11, 0xc0, 0x66, 0x71, 0xe6, 0x80, 0x59, 0x47, 0xe4,
+  0xfd, 0x7d, 0xd1, 0xed, 0x8a, 0x15, 0x31, 0x17, 0x4f, 0xbb, 0x67, 0x02,
+  0x76, 0xde, 0x0c, 0x20, 0x20, 0xf7, 0x65, 0x70, 0x76, 0xd8, 0xcf, 0x46,
+  0xde, 0xd3, 0x01, 0xc5, 0x39, 0x0d, 0xfe, 0x51, 0x17, 0xa6, 0x38, 0x82,
+  0x86, 0x96, 0x59, 0x2a, 0x5f, 0x0a, 0xab, 0xf1, 0x85, 0xf0, 0x1c, 0x6e,
+  0x7e, 0xa2, 0x18, 0xeb, 0x8a, 0x29, 0x4b, 0xd7, 0xe2, 0x28, 0xf5, 0x93,
+  0xd2, 0xa7, 0xb1, 0x86, 0x8b, 0x20, 0xa4, 0x1e, 0xad, 0xa1, 0x9a, 0x21,
+  0x57, 0xb8, 0x6d, 0xde, 0x47, 0xed, 0x7b, 0xae, 0x3b, 0x77, 0x1a, 0x1d,
+  0x9b, 0x40, 0xb0, 0x65, 0x3d, 0x71, 0xdc, 0xd3, 0xd6, 0x94, 0x6d, 0x54,
+  0xe2, 0x60, 0x22, 0xd5, 0x4e, 0x9e, 0x08, 0x67, 0x90, 0xb4, 0x12, 0xcd,
+  0xf7, 0xa1, 0xd2, 0x8a, 0x23, 0x3d, 0x70, 0x76, 0x91, 0xd6, 0xbc, 0xbd,
+  0x7a, 0xd3, 0xbc, 0x71, 0xe7, 0xad, 0xf9, 0x63, 0xb8, 0x43, 0xc4, 0x2a,
+  0x4b, 0x98, 0xf3, 0x81, 0x65, 0xfb, 0x98, 0x92, 0x26, 0xcb, 0xa7, 0x40,
+  0x6a, 0x9b, 0x57, 0x24, 0xfc, 0xb5, 0x52, 0x0a, 0x93, 0xe8, 0xa0, 0xb4,
+  0xe8, 0x33, 0xea, 0x61, 0x50, 0xd0, 0x6d, 0x96, 0xff, 0x22, 0xa1, 0xc7,
+  0x81, 0x14, 0x44, 0xac, 0x16, 0x59, 0x0f, 0x49, 0xb9, 0x00, 0x48, 0x73,
+  0x27, 0x0d, 0x92, 0xe8, 0x83, 0x0d, 0xf1, 0xe3, 0x6d, 0xd7, 0x7c, 0x6b,
+  0x6d, 0x5d, 0x1c, 0x88, 0x91, 0xc5, 0xe1, 0x4c, 0x51, 0x9b, 0xe4, 0x8c,
+  0x17, 0xbf, 0x7d, 0xcc, 0x8e, 0xa1, 0x2b, 0xd4, 0x71, 0x20, 0x0b, 0x40,
+  0xc4, 0x3f, 0xda, 0x97, 0xb6, 0xe8, 0x86, 0xc2, 0x4e, 0x50, 0x58, 0x25,
+  0x11, 0x81, 0x3f, 0xd0, 0x00, 0xa9, 0x0e, 0x30, 0x2f, 0x1d, 0xe3, 0x29,
+  0x47, 0x6f, 0x74, 0x49, 0x5f, 0x5f, 0xf5, 0xa4, 0xb4, 0x16, 0x9c, 0x77,
+  0x78, 0xae, 0x49, 0x67, 0xe8, 0x1e, 0x8e, 0x0f, 0x1b, 0x10, 0x9c, 0x49,
+  0xae, 0x0f, 0x9e, 0xf6, 0x67, 0xcb, 0x74, 0x03, 0x9e, 0xb1, 0xc6, 0x96,
+  0x01, 0xf6, 0xb9, 0x98, 0x94, 0xdf, 0x4e, 0xf1, 0x8b, 0x28, 0x5d, 0x8a,
+  0x31, 0xda, 0x7f, 0x62, 0x2c, 0x02, 0x45, 0xe0, 0x61, 0x56, 0x79, 0xaf,
+  0x9a, 0x58, 0x20, 0xce, 0x47, 0x55, 0x5f, 0xc4, 0xd1, 0xd3, 0x85, 0x51,
+  0xe7, 0x18, 0x33, 0xb5, 0xf9, 0x59, 0xd3, 0xd1, 0x14, 0x77, 0x86, 0xf6,
+  0x3f, 0x75, 0xc7, 0x68, 0xd4, 0x8a, 0xc2, 0xc3, 0xfe, 0x00, 0xec, 0xa5,
+  0x6b, 0xba, 0xc9, 0x29, 0xe2, 0x75, 0x53, 0x4a, 0xc8, 0xfd, 0x4e, 0x6b,
+  0x01, 0x6e, 0xdb, 0xde, 0x13, 0x52, 0xdc, 0x80, 0x58, 0xf2, 0xd4, 0xe5,
+  0xcd, 0xa6, 0x56, 0x07, 0x48, 0xeb, 0x97, 0x56, 0xf5, 0x85, 0x42, 0x5a,
+  0x88, 0xee, 0xd2, 0x14, 0xdc, 0xcf, 0x41, 0x7f, 0x50, 0xdf, 0x92, 0xe9,
+  0x8b, 0xd8, 0xbd, 0x09, 0xfe, 0x6c, 0xad, 0x07, 0xc1, 0x0c, 0x78, 0xf1,
+  0x9a, 0x63, 0x79, 0xa7, 0x24, 0xa3, 0xaa, 0xf7, 0xb3, 0x09, 0xdc, 0x8f,
+  0x64, 0xc3, 0x11, 0xc1, 0xfc, 0xfb, 0xd5, 0xd3, 0xae, 0x5e, 0x15, 0xbc,
+  0x10, 0x12, 0xae, 0x5b, 0xaa, 0x0c, 0x05, 0xb5, 0xcb, 0x1d, 0xeb, 0xfa,
+  0x09, 0xe2, 0xa3, 0x40, 0xe6, 0x6b, 0x67, 0xdc, 0x8d, 0x67, 0xc5, 0xce,
+  0xb0, 0xc7, 0xe8, 0xc7, 0x7c, 0x6b, 0x18, 0x84, 0x2d, 0x88, 0x5d, 0x06,
+  0xf8, 0x94, 0x73, 0x05, 0xf3, 0xa2, 0xa5, 0x94, 0xb7, 0x05, 0xff, 0x59,
+  0x7c, 0xcb, 0x20, 0xcb, 0xd4, 0x46, 0x90, 0x6b, 0xb0, 0x8f, 0x3e, 0x9a,
+  0x27, 0x90, 0x95, 0xfe, 0x1f, 0x9c, 0xad, 0xab, 0x7b, 0xb4, 0x65, 0x10,
+  0x99, 0x18, 0x01, 0x03, 0x3f, 0xe7, 0x05, 0x27, 0x3e, 0x1b, 0x04, 0xe3,
+  0x1a, 0x77, 0x07, 0x7c, 0x99, 0x30, 0x22, 0x4b, 0x79, 0x57, 0xde, 0x4f,
+  0x5a, 0x5b, 0x0b, 0x09, 0x92, 0xc4, 0x2f, 0x9d, 0x9d, 0x7e, 0xca, 0x6e,
+  0xb0, 0x0c, 0xc2, 0xae, 0x25, 0x89, 0x58, 0x62, 0x25, 0xa9, 0xba, 0x63,
+  0xd9, 0xd3, 0x8f, 0xf4, 0x48, 0x1e, 0xba, 0x32, 0xa1, 0xe3, 0x14, 0xa4,
+  0xaa, 0xe2, 0x86, 0xcf, 0xac, 0xf9, 0x52, 0x72, 0x4e, 0xdd, 0xf3, 0x69,
+  0x9d, 0x45, 0x28, 0x18, 0xc7, 0xaa, 0x01, 0x0a, 0xac, 0xd6, 0xe2, 0x6e,
+  0xc2, 0xb3, 0x4f, 0xcd, 0xe1, 0xa0, 0x98, 0xd7, 0x12, 0x94, 0xcd, 0x6e,
+  0x40, 0xde, 0x8b, 0xe7, 0x83, 0x71, 0x69, 0xf1, 0x05, 0x19, 0x0f, 0x6a,
+  0x69, 0xcf, 0x15, 0xbb, 0xfc, 0x0b, 0x7f, 0x2f, 0x34, 0x2c, 0x83, 0xd3,
+  0x2a, 0x81, 0x64, 0xc8, 0xea, 0xe1, 0x56, 0x49, 0x7c, 0x4f, 0x8d, 0xce,
+  0x24, 0xfe, 0x7c, 0x4e, 0xc7, 0xfb, 0xc5, 0xf0, 0xc4, 0xde, 0x94, 0xe5,
+  0xeb, 0xce, 0xe9, 0xfc, 0x1c, 0x3b, 0xe3, 0xdb, 0x50, 0x42, 0x26, 0x3a,
+  0x34, 0xf3, 0x51, 0x71, 0xf2, 0x08, 0xff, 0x33, 0x64, 0xc3, 0x73, 0xd1,
+  0xe1, 0xef, 0x9f, 0x66, 0xf6, 0x22, 0x97, 0xf4, 0x3a, 0xc9, 0x0a, 0x98,
+  0x43, 0x72, 0x98, 0xdf, 0x0f, 0xfa, 0x14, 0x10, 0x19, 0xe2, 0xeb, 0x76,
+  0x18, 0x26, 0x92, 0xe7, 0x2c, 0x47, 0x18, 0x9c, 0x63, 0xfb, 0xc5, 0x4c,
+  0x03, 0x41, 0xae, 0x2c, 0x87, 0x76, 0xe7, 0x59, 0x82, 0x60, 0x72, 0xce,
+  0xd7, 0x8f, 0x75, 0xad, 0xb4, 0x92, 0xf4, 0x53, 0xcc, 0xc4, 0x71, 0xa8,
+  0xce, 0x79, 0x9a, 0x21, 0xc3, 0xd3, 0x75, 0x94, 0xb9, 0xb0, 0xd4, 0x37,
+  0xd3, 0x73, 0xf6, 0x9e, 0x4d, 0xc2, 0xa8, 0x4f, 0x2f, 0x39, 0xd9, 0xf8,
+  0x5a, 0x12, 0xf4, 0x10, 0xf4, 0x51, 0x9c, 0xe1, 0x3f, 0xdf, 0xdf, 0xee,
+  0xec, 0x47, 0xe6, 0x50, 0x78, 0xae, 0x82, 0xb8, 0xc9, 0x25, 0x05, 0x82,
+  0x90, 0x57, 0x18, 0xf2, 0x23, 0x0f, 0xf6, 0xf9, 0x63, 0xb4, 0x4a, 0xda,
+  0x05, 0x3e, 0xbe, 0x16, 0x12, 0xa7, 0x81, 0x55, 0x4c, 0xa6, 0x03, 0x83,
+  0x99, 0xb3, 0xf7, 0x8b, 0x8b, 0x7c, 0x7b, 0x78, 0xbe, 0x43, 0x83, 0xff,
+  0x3b, 0x77, 0x71, 0xba, 0x15, 0x10, 0x57, 0xda, 0xf0, 0x90, 0xcf, 0x6f,
+  0x7d, 0x47, 0xb7, 0xad, 0xbc, 0x17, 0x2a, 0xf0, 0xf0, 0xcf, 0xff, 0xc6,
+  0xc7, 0xf3, 0xb3, 0x41, 0xd2, 0xc3, 0x6b, 0xf4, 0x11, 0x90, 0x10, 0xc8,
+  0x9e, 0xaf, 0x21, 0xd0, 0x86, 0x0f, 0xc8, 0x56, 0xca, 0xa8, 0xec, 0x24,
+  0x0f, 0x87, 0x71, 0x85, 0xbc, 0xb4, 0x5e, 0xb8, 0xc9, 0x81, 0x83, 0x3f,
+  0x83, 0xec, 0x37, 0x45, 0x77, 0x80, 0x3a, 0xe8, 0x76, 0xbc, 0xd8, 0x12,
+  0x48, 0x2d, 0xf5, 0x4e, 0xe5, 0x46, 0x56, 0x40, 0xa8, 0xdb, 0x29, 0x18,
+  0xdb, 0x55, 0x7e, 0x6b, 0x5f, 0x72, 0x78, 0x5e, 0x4f, 0x99, 0x8b, 0x06,
+  0x4a, 0x9e, 0xd5, 0xfb, 0x4a, 0x5c, 0x71, 0x6b, 0x6a, 0x17, 0x9a, 0x38,
+  0x22, 0x64, 0xfe, 0xe0, 0x92, 0x5b, 0xa0, 0x57, 0xfd, 0xab, 0xda, 0xc3,
+  0x23, 0x19, 0x4a, 0x53, 0x0d, 0x7d, 0x38, 0xcf, 0x44, 0x63, 0xb6, 0x2a,
+  0x6e, 0x17, 0x60, 0xbe, 0xab, 0xf1, 0x8d, 0x56, 0x55, 0x1a, 0xd8, 0x12,
+  0xc5, 0xa1, 0xf3, 0x8f, 0xec, 0x55, 0x30, 0xae, 0x99, 0x93, 0x0a, 0xb5,
+  0xed, 0xd0, 0x38, 0xbf, 0xb8, 0x31, 0x7c, 0x36, 0x31, 0xc2, 0xa6, 0x98,
+  0xf1, 0xfc, 0x9d, 0x56, 0x24, 0x0d, 0xfa, 0xd3, 0x5b, 0xda, 0x18, 0x51,
+  0x23, 0xa1, 0x31, 0x9f, 0xd7, 0x0a, 0x3d, 0xca, 0xe5, 0x7e, 0x6e, 0xa6,
+  0x45, 0x5b, 0xd4, 0x8a, 0x45, 0x6a, 0x05, 0x66, 0x48, 0x7c, 0x8a, 0x07,
+  0xf4, 0x0f, 0x0f, 0x0d, 0x4e, 0xab, 0xb0, 0x15, 0x57, 0x06, 0x50, 0x35,
+  0x87, 0x6a, 0x3d, 0xee, 0x5c, 0x41, 0x6d, 0x9c, 0xb0, 0x29, 0xa3, 0xd8,
+  0x1f, 0x7d, 0xcc, 0x6f, 0xd1, 0xac, 0x37, 0x46, 0x29, 0xca, 0xb7, 0x29,
+  0x9e, 0xb9, 0x0f, 0xd2, 0x01, 0x78, 0xf7, 0x4b, 0xe9, 0x39, 0xf9, 0xa0,
+  0xeb, 0xb1, 0xe7, 0xe9, 0xbb, 0x7c, 0x9b, 0xa0, 0xdf, 0xf8, 0x5f, 0x01,
+  0xef, 0x2c, 0x4a, 0x6e, 0xe5, 0x91, 0x0b, 0xc8, 0x07, 0xc4, 0xb9, 0x6d,
+  0x74, 0xe6, 0x89, 0xaa, 0xca, 0x9a, 0xfc, 0x5b, 0xaf, 0xc4, 0x37, 0x6c,
+  0x9a, 0xbb, 0x87, 0x28, 0x99, 0xc5, 0x1d, 0x85, 0x8e, 0xee, 0x8c, 0xea,
+  0xdb, 0x0c, 0xf9, 0x5c, 0x0f, 0x12, 0x7a, 0xa9, 0xa7, 0xd0, 0x5c, 0x35,
+  0xae, 0x17, 0x32, 0xd1, 0x55, 0x55, 0x62, 0x1f, 0x00, 0xdc, 0xa1, 0x79,
+  0x69, 0x98, 0x98, 0x91, 0x4c, 0xf0, 0xba, 0x38, 0xbb, 0x11, 0x60, 0x64,
+  0x64, 0x86, 0x78, 0xeb, 0xd4, 0x96, 0x49, 0x24, 0x00, 0xda, 0xce, 0x50,
+  0x31, 0x41, 0x01, 0x56, 0xcd, 0x38, 0x51, 0x9f, 0x09, 0xcc, 0x1a, 0xc6,
+  0xd6, 0x1d, 0x2e, 0x65, 0x48, 0x8f, 0x5b, 0x79, 0x77, 0xbe, 0xeb, 0xe5,
+  0xad, 0x45, 0xa9, 0xd6, 0xd9, 0xa4, 0x13, 0x22, 0x92, 0x99, 0xa5, 0xe9,
+  0x9e, 0xc1, 0xc2, 0xab, 0x6c, 0x3d, 0x7e, 0x45, 0xfa, 0xcb, 0xdb, 0x9a,
+  0x14, 0xa0, 0x35, 0x1d, 0xfd, 0xaf, 0xc5, 0xf4, 0x21, 0xe3, 0x70, 0xce,
+  0x8e, 0x32, 0x9a, 0xb3, 0xd0, 0x5c, 0xd6, 0x70, 0xeb, 0xf2, 0xf9, 0x6a,
+  0x52, 0x37, 0x3f, 0x8f, 0x99, 0xe6, 0xea, 0x70, 0x1b, 0x8f, 0xc9, 0xf9,
+  0x48, 0x2a, 0xe2, 0x0a, 0x92, 0x11, 0x92, 0x8c, 0x41, 0x1e, 0x91, 0xda,
+  0x77, 0x19, 0x1d, 0x2c, 0x15, 0xd8, 0x8a, 0x8c, 0x91, 0x80, 0x89, 0x37,
+  0xff, 0xd3, 0xf5, 0xfa, 0x9f, 0xec, 0x57, 0xe3, 0x16, 0xc1, 0xcb, 0xef,
+  0xca, 0xc2, 0x49, 0xd5, 0x36, 0x26, 0x4b, 0xcf, 0x6b, 0x6d, 0x3a, 0xc1,
+  0xe5, 0x5f, 0x46, 0x13, 0xe5, 0x6e, 0x94, 0xc5, 0x6b, 0xa3, 0xc0, 0x52,
+  0xd8, 0xe5, 0xca, 0x62, 0xbe, 0x38, 0x5d, 0x5b, 0x88, 0xc7, 0x05, 0xb1,
+  0x05, 0x1b, 0x9d, 0xf9, 0xbb, 0xb9, 0x60, 0x15, 0xe6, 0x9a, 0xf4, 0x33,
+  0xbe, 0xec, 0xd4, 0x86, 0xab, 0xf5, 0x41, 0x93, 0x23, 0xea, 0x54, 0xc0,
+  0x2c, 0x9b, 0x7c, 0xfa, 0xc4, 0x66, 0x80, 0xfc, 0x3d, 0x23, 0xb5, 0x2a,
+  0xb9, 0x26, 0x91, 0x25, 0x0e, 0x9a, 0xd3, 0x62, 0x5b, 0xe5, 0xb0, 0x83,
+  0x47, 0xb6, 0x75, 0xd4, 0xc2, 0x02, 0xf0, 0x0c, 0x12, 0x7a, 0xba, 0x15,
+  0xaf, 0x84, 0xd2, 0x97, 0x97, 0x61, 0xad, 0x91, 0xe6, 0xa9, 0x34, 0x19,
+  0x9a, 0xb2, 0xda, 0xe6, 0x2b, 0x79, 0x57, 0xcc, 0x19, 0xf6, 0xff, 0xf7,
+  0xfe, 0x58, 0x1b, 0xdd, 0xa0, 0xde, 0xc9, 0xef, 0x3b, 0x6d, 0xbf, 0xfc,
+  0x71, 0x5e, 0xc7, 0x46, 0x03, 0x22, 0x55, 0xbb, 0xef, 0x84, 0x1f, 0x40,
+  0x9b, 0x8c, 0xb2, 0x43, 0xbb, 0x5f, 0x3f, 0x88, 0xa0, 0x13, 0x4e, 0x52,
+  0x56, 0x51, 0xc0, 0xc6, 0x64, 0xea, 0x46, 0x50, 0x11, 0x56, 0x4c, 0x84,
+  0x4a, 0x0c, 0xf0, 0x24, 0x1b, 0xb5, 0x4a, 0xb7, 0x3a, 0x23, 0xce, 0xba,
+  0x54, 0x3d, 0xfd, 0x8e, 0xc5, 0xdc, 0x55, 0xd3, 0x3a, 0xe4, 0xff, 0x59,
+  0xe1, 0x10, 0xfb, 0x07, 0x04, 0x48, 0x58, 0x92, 0x73, 0x9e, 0x5b, 0xfc,
+  0xa0, 0xce, 0x8f, 0x03, 0xf0, 0x12, 0xde, 0x94, 0x39, 0xee, 0xee, 0x1a,
+  0x0f, 0x9c, 0xcc, 0xcc, 0xc8, 0xf5, 0x88, 0x1c, 0x90, 0x8d, 0xe6, 0x83,
+  0xf1, 0xa6, 0x5f, 0xd4, 0xf8, 0x9a, 0xa4, 0xe4, 0xfd, 0x6f, 0xfd, 0xc7,
+  0x83, 0xd7, 0xd9, 0xae, 0x4d, 0x64, 0x67, 0xd8, 0x9d, 0xaf, 0x00, 0x85,
+  0x84, 0x9b, 0x02, 0x7c, 0xbc, 0xbd, 0x10, 0x8b, 0xdd, 0xee, 0xcf, 0xc9,
+  0xc0, 0x56, 0x44, 0xc1, 0xa1, 0xbe, 0xd4, 0x25, 0xe0, 0x75, 0xd6, 0xef,
+  0xe1, 0xf5, 0xe7, 0x72, 0x43, 0x1e, 0x70, 0x69, 0x1e, 0x6b, 0x26, 0x13,
+  0xd0, 0x6e, 0xaf, 0xcc, 0x0a, 0x89, 0xe7, 0x67, 0x5d, 0x8d, 0x14, 0xbf,
+  0xba, 0xe4, 0xa9, 0xc0, 0xa1, 0xf9, 0x71, 0x29, 0x8d, 0x6f, 0x43, 0xa9,
+  0xb4, 0x47, 0x0d, 0x6b, 0xff, 0xcf, 0x18, 0x0b, 0x68, 0x3d, 0xc3, 0xb5,
+  0xd6, 0x35, 0x9e, 0x89, 0xe7, 0xb3, 0xf2, 0xc3, 0x47, 0xe8, 0x6f, 0x76,
+  0x4a, 0xac, 0xa6, 0x02, 0x73, 0x13, 0xdf, 0x31, 0xff, 0x5f, 0xb9, 0xd9,
+  0x16, 0x67, 0x98, 0x2d, 0x00, 0x56, 0x2c, 0xa9, 0x89, 0x16, 0x77, 0x2f,
+  0x3f, 0x94, 0x3e, 0x5e, 0xf1, 0xf4, 0x2c, 0xa5, 0xff, 0x1a, 0x4e, 0x0f,
+  0x54, 0x4c, 0x9e, 0xa0, 0x55, 0x27, 0x0b, 0x51, 0x21, 0x8f, 0xcf, 0x5d,
+  0x32, 0x8c, 0x0f, 0xdd, 0x9d, 0x7f, 0xc9, 0x59, 0x22, 0x0d, 0x52, 0xa9,
+  0xd1, 0x22, 0x17, 0x8d, 0x44, 0xee, 0x5c, 0x3e, 0xad, 0xe9, 0x63, 0xc9,
+  0xdb, 0x22, 0x17, 0x62, 0x60, 0xa7, 0x94, 0xab, 0xcb, 0x40, 0x60, 0x0f,
+  0xec, 0x11, 0x87, 0x79, 0x4a, 0x18, 0xe6, 0x02, 0x23, 0x1c, 0x07, 0x5d,
+  0x26, 0x9c, 0x3b, 0x1c, 0xe8, 0x03, 0xa4, 0xf2, 0x1b, 0xef, 0x03, 0xf0,
+  0x18, 0x7d, 0x7c, 0xd0, 0x2a, 0xf9, 0xca, 0xd4, 0xf9, 0x94, 0x17, 0x62,
+  0x89, 0xd3, 0xbf, 0xc1, 0x76, 0xfc, 0xf0, 0x67, 0x34, 0x62, 0xfe, 0x81,
+  0xcb, 0x79, 0x38, 0x38, 0xf7, 0xe9, 0x53, 0xaf, 0x42, 0x9b, 0x9d, 0xcf,
+  0xe7, 0xb2, 0x93, 0x32, 0xbd, 0xd2, 0xff, 0x63, 0x86, 0xac, 0x2d, 0xa8,
+  0xac, 0x23, 0x4a, 0x4d, 0x81, 0x01, 0x00, 0xf5, 0x46, 0xdd, 0xce, 0x97,
+  0x98, 0x56, 0xc8, 0x9d, 0x39, 0x85, 0xd1, 0x78, 0x8c, 0x31, 0xa0, 0x69,
+  0xcd, 0xdb, 0x65, 0x9f, 0x57, 0x4a, 0x60, 0xe6, 0x32, 0x80, 0x59, 0xbe,
+  0xc0, 0x65, 0x3e, 0xce, 0xd6, 0x94, 0xf4, 0x49, 0x61, 0x4e, 0xfb, 0x92,
+  0x04, 0x32, 0xf2, 0xd6, 0x8f, 0xee, 0x41, 0x8d, 0xbf, 0x0f, 0xd5, 0x57,
+  0x80, 0xc7, 0x17, 0xdd, 0x68, 0x3e, 0x20, 0x36, 0x57, 0x83, 0x22, 0x9f,
+  0xf6, 0xd4, 0x1f, 0xab, 0xb7, 0xb6, 0xe2, 0x7f, 0x1a, 0xa9, 0x80, 0x83,
+  0x6d, 0xfa, 0x3d, 0x72, 0x22, 0x25, 0x70, 0xe2, 0x80, 0x5d, 0xa2, 0x68,
+  0xa0, 0x8a, 0x97, 0xa7, 0x35, 0xc4, 0x41, 0xb0, 0x23, 0x79, 0x0e, 0x55,
+  0x9b, 0x7c, 0xe0, 0x09, 0xf6, 0xe3, 0x21, 0xa4, 0xfc, 0x39, 0xba, 0x3f,
+  0x78, 0x60, 0x2d, 0xe9, 0x7b, 0xd2, 0x90, 0x90, 0x08, 0x67, 0x14, 0xd6,
+  0x0f, 0xb5, 0xe9, 0x96, 0x4a, 0xae, 0x18, 0xba, 0xdd, 0x30, 0x11, 0x30,
+  0x5f, 0xb8, 0x36, 0xa3, 0x0e, 0x5a, 0x4e, 0x4d, 0xb3, 0xde, 0x53, 0x2f,
+  0xc8, 0x33, 0x9b, 0x2a, 0xdc, 0xd2, 0x23, 0x5f, 0xbd, 0x9c, 0x2a, 0xc9,
+  0x6f, 0x65, 0xca, 0x26, 0xf2, 0x4a, 0x32, 0x6f, 0x61, 0x69, 0xa6, 0x5d,
+  0xe4, 0x98, 0xe3, 0xe4, 0x1c, 0xf7, 0x23, 0x21, 0x7c, 0xab, 0xb1, 0x1f,
+  0xd1, 0x46, 0xda, 0xc9, 0x1f, 0x32, 0x78, 0xf9, 0xc0, 0x06, 0xcd, 0xe5,
+  0x01, 0xb1, 0xd9, 0x44, 0x18, 0x89, 0x9b, 0xe4, 0xf4, 0xc4, 0x90, 0x55,
+  0xc3, 0x45, 0x25, 0x0a, 0x89, 0xfa, 0x11, 0x4b, 0x1e, 0x46, 0x65, 0xf9,
+  0x94, 0x3e, 0x53, 0xca, 0x2b, 0xed, 0x5f, 0x20, 0x40, 0xab, 0xed, 0x31,
+  0x4a, 0xfd, 0xdf, 0x61, 0x68, 0x03, 0x36, 0x1f, 0x73, 0x98, 0xeb, 0xfe,
+  0xf2, 0x0d, 0x98, 0xb2, 0x4c, 0x7f, 0xe1, 0x33, 0x26, 0xc6, 0x75, 0x6c,
+  0x72, 0xf9, 0x9c, 0xaa, 0xed, 0xe8, 0x0f, 0x70, 0x0d, 0xab, 0x6e, 0x62,
+  0x8d, 0x91, 0xea, 0x48, 0xe1, 0x3a, 0x12, 0x44, 0xff, 0x59, 0x11, 0xfc,
+  0xc6, 0xa7, 0x88, 0xdd, 0x65, 0xf3, 0x5c, 0xd3, 0x42, 0x4e, 0xec, 0xe5,
+  0xaf, 0x03, 0xef, 0x1d, 0x40, 0x58, 0x48, 0xa2, 0x95, 0xaf, 0x4b, 0x81,
+  0x8d, 0xaf, 0x37, 0x0f, 0x1e, 0x79, 0x33, 0x05, 0xb9, 0x3d, 0x16, 0x3a,
+  0xec, 0x41, 0xb2, 0xac, 0x79, 0x89, 0xce, 0xcd, 0x34, 0x53, 0x34, 0x67,
+  0xbd, 0x2b, 0x35, 0xeb, 0x11, 0x7d, 0xb4, 0x4c, 0x73, 0x70, 0x79, 0x2c,
+  0xd2, 0x21, 0xea, 0x7f, 0x6f, 0x95, 0xca, 0x56, 0xe3, 0x5d, 0xac, 0xcd,
+  0xa9, 0x61, 0xc5, 0x40, 0x63, 0x3b, 0xf5, 0x2f, 0x8b, 0xe6, 0x97, 0xf6,
+  0x5b, 0xbb, 0x5f, 0xd9, 0x7a, 0xd4, 0x57, 0x5c, 0x08, 0xa3, 0x28, 0x24,
+  0xe8, 0x2f, 0x92, 0xc5, 0xfa, 0x91, 0x33, 0xf2, 0x2e, 0xf3, 0x2e, 0x9e,
+  0x06, 0xec, 0x6f, 0xd5, 0xef, 0xd2, 0xe2, 0x84, 0x6a, 0xa7, 0x85, 0x88,
+  0x2f, 0x1e, 0xde, 0xcb, 0x7a, 0xb3, 0x62, 0x94, 0x3c, 0xf6, 0x92, 0xfb,
+  0xdb, 0xde, 0x47, 0xd0, 0x24, 0x16, 0xe5, 0x78, 0xa8, 0x4d, 0x4d, 0x4a,
+  0x3a, 0x35, 0x13, 0xbf, 0xe4, 0x75, 0x9b, 0x20, 0x9d, 0x66, 0x2a, 0x13,
+  0x75, 0xfd, 0x4a, 0x54, 0x1d, 0x0a, 0x8d, 0xf4, 0xec, 0x9a, 0x6f, 0xef,
+  0xa8, 0x1f, 0x87, 0x89, 0xf4, 0xc4, 0x71, 0xf1, 0x99, 0x2d, 0xa9, 0x8d,
+  0x3d, 0x96, 0xbf, 0xc8, 0xd7, 0xfd, 0x6c, 0xd0, 0x7f, 0x34, 0x63, 0x72,
+  0x22, 0xc7, 0x89, 0x51, 0x51, 0xf7, 0x95, 0x17, 0x0f, 0x51, 0x88, 0xdb,
+  0xf6, 0x1f, 0x60, 0x43, 0xed, 0xbe, 0x2b, 0x5a, 0x56, 0xeb, 0x50, 0x1d,
+  0xd8, 0x01, 0x2a, 0x5a, 0x6d, 0xd7, 0x54, 0x32, 0x37, 0xa5, 0x5e, 0x12,
+  0xbf, 0xe8, 0xc3, 0x47, 0xb6, 0xa0, 0x52, 0x2c, 0x60, 0x70, 0xc9, 0x43,
+  0x78, 0x49, 0xd8, 0x41, 0x5e, 0x43, 0x3b, 0x03, 0x48, 0xa4, 0x17, 0x13,
+  0xe5, 0x95, 0xcc, 0x62, 0xeb, 0xd8, 0x11, 0x31, 0xc1, 0xff, 0xd6, 0xce,
+  0x29, 0xa0, 0x91, 0xdf, 0xc5, 0x7d, 0xbd, 0x55, 0xee, 0x4a, 0xa7, 0x05,
+  0x1f, 0x6d, 0xa3, 0xa8, 0x82, 0x26, 0x5a, 0x42, 0xc7, 0xdb, 0x59, 0xed,
+  0xab, 0x29, 0x26, 0x00, 0xf1, 0xa9, 0x8b, 0x9c, 0xd7, 0x55, 0xfe, 0xb4,
+  0xa7, 0x36, 0x1c, 0x45, 0x5a, 0x4e, 0xa9, 0x4f, 0x4a, 0xca, 0x4d, 0x16,
+  0x7a, 0xf5, 0x66, 0xde, 0x7f, 0x03, 0x7b, 0xb3, 0x00, 0xf3, 0x84, 0x0c,
+  0x44, 0x17, 0xe2, 0xb3, 0xb6, 0xa2, 0xa5, 0x2b, 0x3e, 0xd5, 0x55, 0xc4,
+  0x93, 0xb0, 0x39, 0xe2, 0xfc, 0x39, 0x51, 0x37, 0x1d, 0x1a, 0x38, 0x64,
+  0x90, 0x68, 0x1f, 0x2c, 0xc1, 0xf6, 0x57, 0xe8, 0xc1, 0x45, 0x8e, 0x8c,
+  0xb0, 0xf2, 0x06, 0xf0, 0x94, 0xd3, 0x64, 0xe8, 0x34, 0xc7, 0x5f, 0x05,
+  0x35, 0x41, 0x1f, 0xfa, 0xcc, 0x10, 0x76, 0xa1, 0x78, 0xef, 0x93, 0x9a,
+  0xdd, 0xbc, 0x5f, 0x90, 0x54, 0xab, 0x0d, 0xde, 0x8f, 0xce, 0xe2, 0xc4,
+  0x6d, 0xda, 0x0c, 0x80, 0xdd, 0x41, 0xae, 0xa1, 0x37, 0x8a, 0x91, 0x08,
+  0x53, 0x21, 0x61, 0x51, 0x64, 0x3c, 0xf1, 0x29, 0x85, 0xbb, 0x52, 0x25,
+  0xa6, 0x3e, 0x68, 0x15, 0xb3, 0xbb, 0xed, 0x18, 0x1b, 0xb6, 0xc0, 0xa6,
+  0x1a, 0x81, 0xc9, 0x59, 0x80, 0xb0, 0x23, 0x59, 0x0c, 0x85, 0x47, 0xda,
+  0xf5, 0xa9, 0x78, 0x27, 0x1b, 0x44, 0xa3, 0xdf, 0x47, 0x19, 0x09, 0x84,
+  0xb0, 0x12, 0x37, 0x10, 0xfc, 0x49, 0xec, 0xca, 0x90, 0x9c, 0x0f, 0x29,
+  0xb4, 0xf3, 0xf0, 0x5a, 0x82, 0x87, 0x89, 0x9b, 0x33, 0x2f, 0xaa, 0x7e,
+  0xa7, 0x3f, 0xba, 0x40, 0xdd, 0xd6, 0xea, 0x78, 0x4e, 0xa8, 0x48, 0xda,
+  0xab, 0x99, 0xf1, 0x0b, 0xd3, 0xb1, 0x32, 0x69, 0x80, 0x6e, 0x14, 0x60,
+  0x0d, 0xa3, 0x22, 0x76, 0x2c, 0x2a, 0xa8, 0xfc, 0xb4, 0x5a, 0x70, 0x8f,
+  0x9a, 0x66, 0x86, 0x99, 0x76, 0xe0, 0x09, 0xde, 0x47, 0x82, 0x48, 0xd6,
+  0x2b, 0xe2, 0x78, 0xe5, 0x34, 0xf6, 0x76, 0x9a, 0x5c, 0x78, 0xcc, 0xdc,
+  0x38, 0x3f, 0xbb, 0x2c, 0x89, 0xc8, 0x09, 0x3e, 0x0b, 0xb1, 0x1e, 0x41,
+  0xe5, 0x0e, 0xce, 0xe7, 0x7b, 0xa5, 0xfe, 0x41, 0x94, 0x96, 0x7d, 0x85,
+  0xb7, 0xa9, 0x1c, 0x46, 0xdc, 0xaa, 0x8e, 0xfe, 0xaa, 0x3a, 0x85, 0xc3,
+  0x2d, 0xd8, 0xd9, 0x05, 0x21, 0xdd, 0x5f, 0xbd, 0x79, 0x0f, 0x95, 0xa7,
+  0xa1, 0xc5, 0x25, 0x7b, 0xb3, 0x1b, 0xe7, 0xbb, 0xb4, 0x64, 0x4a, 0xe0,
+  0xb9, 0xa9, 0xce, 0xd1, 0xeb, 0x9e, 0x1c, 0x2b, 0x88, 0x47, 0x02, 0x11,
+  0xcd, 0xf9, 0xbb, 0xbe, 0xf5, 0x3f, 0xc4, 0x22, 0x47, 0xb5, 0x5d, 0x76,
+  0xf2, 0xc2, 0x88, 0xcb, 0xb3, 0xef, 0xe2, 0x0b, 0x42, 0xb5, 0xf4, 0xc0,
+  0x10, 0x38, 0x38, 0x94, 0x0e, 0x91, 0x3b, 0x69, 0x88, 0x2f, 0x21, 0xab,
+  0x73, 0x6c, 0x95, 0xa8, 0xaf, 0x25, 0x78, 0x29, 0x89, 0x95, 0x2b, 0xfa,
+  0x31, 0x6f, 0xbf, 0x53, 0x36, 0x83, 0x47, 0x70, 0xf7, 0x9c, 0xbf, 0xde,
+  0xd0, 0xd5, 0x7e, 0x5f, 0x01, 0xff, 0x3b, 0x45, 0x1c, 0x93, 0xfa, 0x0e,
+  0x7e, 0x2d, 0xcf, 0x4f, 0x08, 0xa5, 0xd0, 0x5a, 0x09, 0x4e, 0x73, 0x11,
+  0x36, 0x8c, 0xc7, 0x1a, 0x98, 0xaf, 0x18, 0x27, 0x05, 0xd6, 0x71, 0x31,
+  0x7f, 0x6a, 0x89, 0x39, 0x54, 0xc7, 0x69, 0x2f, 0x3d, 0xe8, 0x3d, 0x41,
+  0xe4, 0x26, 0xe5, 0xf7, 0x97, 0x8c, 0xfe, 0x1f, 0xca, 0xe6, 0x6b, 0xf7,
+  0xbb, 0xae, 0x35, 0xc9, 0x5f, 0x3b, 0x20, 0xe1, 0xc3, 0x96, 0x9a, 0x38,
+  0x51, 0x9e, 0xaa, 0x10, 0x31, 0xfa, 0x4a, 0xc4, 0xbe, 0x7c, 0xc7, 0x9e,
+  0x47, 0x18, 0x52, 0x61, 0xa8, 0x2d, 0xf8, 0xad, 0xa3, 0x0a, 0xd0, 0x57,
+  0xfe, 0xee, 0x82, 0x32, 0x7d, 0x0d, 0xcf, 0x52, 0x3e, 0x95, 0xbd, 0x93,
+  0xf0, 0x87, 0x3d, 0xd7, 0x95, 0x84, 0x57, 0xd8, 0x22, 0x13, 0x0c, 0xe2,
+  0x9d, 0x44, 0x20, 0x80, 0x30, 0xac, 0x26, 0x74, 0x7d, 0xb6, 0x60, 0xc4,
+  0xd7, 0x8d, 0x18, 0xd0, 0xba, 0xf3, 0x73, 0x10, 0xb0, 0xb2, 0x88, 0x14,
+  0x34, 0x29, 0x4d, 0x60, 0x63, 0xd8, 0x0b, 0x7e, 0x03, 0x4c, 0x07, 0x06,
+  0x63, 0x4b, 0x5b, 0x1d, 0x83, 0x1f, 0x01, 0x54, 0x04, 0x8b, 0x2a, 0x95,
+  0x68, 0x84, 0xd8, 0x76, 0x37, 0x92, 0xa0, 0x90, 0x65, 0x47, 0x85, 0xca,
+  0x01, 0xe2, 0x9e, 0x4d, 0x5f, 0x3f, 0xd5, 0xd9, 0xf9, 0x32, 0x1e, 0x22,
+  0xd5, 0xe5, 0x32, 0x47, 0x67, 0x59, 0x4a, 0x73, 0x51, 0xf3, 0x58, 0x70,
+  0xb7, 0x05, 0x02, 0x6c, 0x31, 0x79, 0x62, 0xe6, 0x3f, 0xe4, 0x05, 0xb4,
+  0x86, 0x5a, 0xf0, 0xd2, 0x62, 0xda, 0x03, 0x91, 0x13, 0x0f, 0x89, 0x31,
+  0x3b, 0x46, 0x44, 0x40, 0x03, 0xd1, 0x64, 0x04, 0x8f, 0x99, 0x8b, 0xff,
+  0xa3, 0x25, 0xf7, 0xaa, 0x00, 0x3a, 0x66, 0x1d, 0xb0, 0xaf, 0x58, 0x69,
+  0x61, 0x62, 0xb4, 0x66, 0xd0, 0xe0, 0x6f, 0xfd, 0xa7, 0xc7, 0x8b, 0x60,
+  0x81, 0xd2, 0x9e, 0x6c, 0x00, 0xf8, 0xf1, 0x57, 0xc2, 0x1f, 0x0d, 0xe3,
+  0xa5, 0x29, 0x53, 0x73, 0x58, 0x82, 0xcf, 0xbd, 0x81, 0x36, 0x72, 0xff,
+  0xd2, 0x10, 0x39, 0x70, 0xda, 0x54, 0xe5, 0xd6, 0xb2, 0xb0, 0x01, 0xd4,
+  0xaf, 0xbf, 0x2d, 0x87, 0x13, 0x17, 0xc1, 0xfb, 0x5d, 0x84, 0x7c, 0x8c,
+  0x49, 0x6a, 0x24, 0xf3, 0x4b, 0x1a, 0x01, 0x1d, 0x09, 0x56, 0x12, 0x47,
+  0x72, 0xe6, 0xa0, 0x4d, 0xb2, 0x5c, 0xd1, 0x2a, 0xbf, 0x2d, 0x3d, 0x27,
+  0x91, 0x0e, 0x86, 0x6a, 0xfa, 0x88, 0xfd, 0x9f, 0x4f, 0xc0, 0xbb, 0xa9,
+  0x73, 0xab, 0xeb, 0x5d, 0x44, 0xa4, 0x23, 0x99, 0xe6, 0xcb, 0x41, 0xb4,
+  0x2a, 0xbb, 0xae, 0x48, 0xc5, 0xa1, 0xd0, 0x0d, 0x48, 0x60, 0xe8, 0x1d,
+  0xae, 0xf6, 0xc3, 0x82, 0xc9, 0xe5, 0xed, 0x9b, 0xd3, 0xfd, 0x02, 0x88,
+  0x52, 0x25, 0x68, 0xf7, 0x35, 0x79, 0x40, 0xac, 0xc0, 0x66, 0x54, 0xfa,
+  0x64, 0x4f, 0x2a, 0xb7, 0x15, 0x71, 0x03, 0x75, 0xd1, 0x6a, 0x6b, 0x0e,
+  0xb8, 0x37, 0x65, 0x22, 0xef, 0x12, 0x71, 0x6a, 0x8b, 0x95, 0xf3, 0x46,
+  0xd9, 0x7a, 0x8f, 0x66, 0xf4, 0x2a, 0xec, 0xde, 0x58, 0x2c, 0xfe, 0x36,
+  0xe5, 0x8c, 0x65, 0x3e, 0x94, 0x30, 0xab, 0x7a, 0x8f, 0x0c, 0x1f, 0x38,
+  0x1a, 0x50, 0xf2, 0xf2, 0xe9, 0x37, 0x25, 0xe5, 0x28, 0xb1, 0x7d, 0xe1,
+  0xcd, 0xbc, 0xa0, 0x5f, 0x2a, 0x9a, 0xa9, 0xa7, 0x65, 0x3b, 0xe1, 0xe1,
+  0x1c, 0x13, 0x8e, 0xfa, 0x9a, 0xbf, 0xfc, 0x2f, 0xb7, 0x2e, 0x77, 0xd0,
+  0xb5, 0x5f, 0x3a, 0x40, 0x3d, 0x50, 0x36, 0x87, 0xbd, 0x05, 0x86, 0x24,
+  0x2f, 0x4a, 0x0c, 0xc7, 0xfc, 0x65, 0x6c, 0x08, 0x6b, 0xde, 0x28, 0x15,
+  0xd8, 0xb7, 0x49, 0x9d, 0x78, 0x3a, 0xbd, 0x3d, 0x4b, 0x57, 0x7b, 0xf0,
+  0x68, 0x71, 0xb7, 0xe9, 0xc4, 0x01, 0xf8, 0xb7, 0x11, 0x5d, 0xcf, 0x75,
+  0x0d, 0xf1, 0x0f, 0x2b, 0xd9, 0x37, 0xc9, 0x2f, 0xe2, 0xe3, 0xf1, 0xd0,
+  0x65, 0x54, 0xb2, 0x6e, 0x03, 0x90, 0x4f, 0x7c, 0xa7, 0xb9, 0x72, 0xaa,
+  0x80, 0x38, 0xfc, 0xee, 0xf6, 0xc9, 0x9e, 0xd8, 0x22, 0xd0, 0xb7, 0xfe,
+  0x23, 0x82, 0xd4, 0xee, 0x8a, 0x4e, 0x9f, 0x85, 0xd1, 0xce, 0x88, 0x1f,
+  0x15, 0x01, 0x41, 0x0c, 0x28, 0x55, 0x2f, 0xe0, 0xa2, 0x29, 0x64, 0x69,
+  0xd2, 0x49, 0x7f, 0xe9, 0xf7, 0x70, 0xcc, 0xb3, 0xe2, 0x9f, 0x46, 0x9d,
+  0x6e, 0x50, 0xdd, 0x54, 0x5f, 0x93, 0x44, 0xdf, 0xf0, 0x28, 0x22, 0x4c,
+  0xb7, 0xf4, 0x62, 0x1d, 0xf7, 0x5e, 0x00, 0xc2, 0x93, 0xef, 0x7f, 0x4f,
+  0xec, 0xbb, 0x64, 0x44, 0xbb, 0xed, 0xe6, 0x63, 0x65, 0x53, 0x98, 0x9c,
+  0xd7, 0x4e, 0x0c, 0x5d, 0xb2, 0x07, 0x65, 0x1c, 0xd9, 0xc3, 0xfe, 0x04,
+  0x64, 0x57, 0xb6, 0x57, 0x42, 0xef, 0xed, 0x0c, 0x76, 0xe7, 0x1c, 0x7b,
+  0x90, 0x25, 0x0a, 0x21, 0xb0, 0x56, 0x76, 0x6c, 0x58, 0x83, 0x1d, 0x44,
+  0x75, 0x17, 0x91, 0x74, 0xef, 0x76, 0x2f, 0x06, 0xb2, 0x2c, 0x98, 0x49,
+  0xa1, 0xd1, 0x92, 0x06, 0xcd, 0x1f, 0xc8, 0xbd, 0xaf, 0xa8, 0x6b, 0xb2,
+  0x0a, 0x4b, 0x82, 0x94, 0x1d, 0x33, 0x04, 0x47, 0x6c, 0x13, 0x27, 0xd8,
+  0xfd, 0x87, 0x45, 0xf3, 0xf8, 0xb0, 0xc2, 0x97, 0x1d, 0x7f, 0xf8, 0x79,
+  0xa3, 0x98, 0x18, 0x5d, 0xc8, 0xf8, 0x10, 0xcd, 0x3a, 0x02, 0x8f, 0xde,
+  0xa0, 0xe6, 0x4c, 0xa9, 0xab, 0xdc, 0xa3, 0x45, 0x3c, 0x5b, 0x85, 0xc5,
+  0x24, 0x61, 0x68, 0xce, 0x13, 0x51, 0x73, 0x6f, 0x17, 0xee, 0x4c, 0x31,
+  0x70, 0x54, 0xe0, 0x12, 0x5d, 0xeb, 0xf3, 0x70, 0xf2, 0xde, 0xb5, 0xa1,
+  0xe2, 0x0a, 0x98, 0x17, 0x54, 0x80, 0xa7, 0xd7, 0x73, 0xfe, 0xb5, 0x1c,
+  0x9b, 0x61, 0xe8, 0x09, 0xa7, 0x8a, 0x0d, 0x8f, 0x5b, 0x3e, 0xd3, 0x5e,
+  0xfa, 0xec, 0xde, 0xd3, 0x74, 0x3f, 0xe4, 0x39, 0xa0, 0xdc, 0x81, 0xfa,
+  0xc2, 0x2f, 0xe7, 0x38, 0xdc, 0x18, 0xb9, 0xb8, 0x3a, 0x21, 0xce, 0x67,
+  0x08, 0x15, 0x20, 0xe8, 0x57, 0x95, 0x8f, 0xa9, 0x67, 0x31, 0xab, 0x4a,
+  0xed, 0xe5, 0x3d, 0xee, 0x1b, 0xfc, 0xcb, 0x9e, 0x73, 0x55, 0xab, 0x1b,
+  0xe8, 0xc0, 0xc5, 0xed, 0x70, 0x01, 0xb2, 0x09, 0xc4, 0x4f, 0x69, 0xbd,
+  0xa1, 0x6d, 0x4e, 0x77, 0x6b, 0xe3, 0x31, 0x64, 0x38, 0x49, 0x6c, 0xd3,
+  0x15, 0x13, 0xc6, 0x9a, 0x54, 0x6b, 0x87, 0x93, 0x2f, 0x62, 0xb6, 0xbb,
+  0xe6, 0x07, 0x1a, 0x13, 0x77, 0x52, 0x1d, 0x72, 0x96, 0x6d, 0xe8, 0x08,
+  0xc2, 0x95, 0xd5, 0x16, 0x83, 0x36, 0xf8, 0xb8, 0x34, 0x00, 0x08, 0xf3,
+  0x01, 0x9e, 0x8e, 0xa8, 0xfa, 0x04, 0x09, 0x17, 0xc1, 0x81, 0xb8, 0xee,
+  0x92, 0x5b, 0xc4, 0x93, 0xfb, 0xfb, 0x2d, 0x26, 0x4e, 0x83, 0x8d, 0x13,
+  0x11, 0x0d, 0xed, 0x76, 0x81, 0x7c, 0x3b, 0x13, 0xd1, 0x06, 0x6f, 0x61,
+  0xd6, 0x87, 0x25, 0x18, 0x53, 0xc5, 0xe2, 0x8d, 0x12, 0xad, 0xc5, 0x90,
+  0x95, 0x40, 0x7d, 0x41, 0x6b, 0xd1, 0x14, 0xc3, 0xbf, 0x6c, 0x59, 0x33,
+  0x03, 0x7e, 0x91, 0x6a, 0xb8, 0x13, 0xab, 0xe5, 0x5b, 0x86, 0xd4, 0xf5,
+  0x5a, 0x58, 0xc4, 0x3d, 0x83, 0x4c, 0x7f, 0x92, 0x2b, 0xdc, 0xa6, 0x96,
+  0x6b, 0xec, 0xbd, 0x79, 0x95, 0x8b, 0xe7, 0xe5, 0x72, 0x6d, 0x33, 0x9c,
+  0x55, 0x49, 0x73, 0x3e, 0xec, 0xaf, 0xc2, 0x38, 0x80, 0xd3, 0x5d, 0xd0,
+  0x12, 0x28, 0x01, 0x0f, 0xb9, 0x26, 0xbc, 0x35, 0x7f, 0xf9, 0x75, 0xf5,
+  0x87, 0x65, 0x0a, 0x17, 0x77, 0xc1, 0x96, 0xe2, 0xc8, 0x1e, 0x2e, 0xfe,
+  0x23, 0x94, 0x81, 0x2a, 0x5e, 0x53, 0xd1, 0x7c, 0x15, 0x51, 0x9d, 0x31,
+  0xee, 0x13, 0x63, 0x4d, 0x62, 0x55, 0xae, 0x07, 0x0f, 0x3b, 0x0f, 0x28,
+  0x1c, 0x80, 0xf4, 0x39, 0x0c, 0x65, 0x60, 0x56, 0xc8, 0x60, 0x80, 0x96,
+  0xcd, 0xc0, 0x34, 0x86, 0x45, 0x1e, 0x73, 0x15, 0xd7, 0xe9, 0x06, 0x70,
+  0xfe, 0x2a, 0xdd, 0x63, 0x9f, 0x83, 0x5c, 0x28, 0xbd, 0x66, 0xa8, 0x61,
+  0x56, 0x9d, 0x8f, 0xb1, 0x99, 0x32, 0x83, 0xaa, 0x9e, 0x9c, 0x8c, 0x01,
+  0x13, 0x3b, 0x9c, 0xe8, 0x61, 0xd5, 0x80, 0x0c, 0x0e, 0x7f, 0x1f, 0x57,
+  0x43, 0xaa, 0x3b, 0x29, 0xba, 0x84, 0xe2, 0x53, 0x57, 0x74, 0x23, 0x1b,
+  0x0f, 0xf1, 0xbd, 0x78, 0x9a, 0x4a, 0xf2, 0x5f, 0xe2, 0xba, 0x0f, 0x52,
+  0x36, 0x97, 0x54, 0x29, 0x72, 0xc6, 0x28, 0x99, 0xf6, 0x5d, 0xdb, 0xfe,
+  0xf7, 0x1d, 0x81, 0xba, 0x9a, 0xcf, 0xc5, 0x7d, 0x45, 0xa9, 0x9f, 0xb6,
+  0xea, 0x76, 0x3c, 0x2b, 0x8a, 0x67, 0x46, 0x4e, 0x7f, 0xa4, 0xd5, 0x35,
+  0x69, 0xd8, 0x73, 0x57, 0x54, 0xd7, 0x1c, 0xcb, 0x7c, 0xfa, 0x2f, 0x6a,
+  0x8d, 0x12, 0x14, 0x1d, 0xba, 0xf2, 0x70, 0x39, 0x94, 0x77, 0xfc, 0xc4,
+  0xea, 0x58, 0x5c, 0xdd, 0x78, 0xa0, 0x17, 0x07, 0x72, 0x24, 0xf5, 0xfe,
+  0xee, 0x6e, 0x80, 0x6b, 0xb5, 0xcd, 0x92, 0x85, 0x69, 0x08, 0x02, 0x22,
+  0x7a, 0x0e, 0x78, 0xff, 0x0b, 0x42, 0x24, 0x96, 0x85, 0x7b, 0x1d, 0xb8,
+  0x5d, 0x09, 0xbb, 0x06, 0x08, 0x34, 0x95, 0xcb, 0x3f, 0x03, 0x5d, 0xfd,
+  0x84, 0x57, 0x81, 0x1b, 0xd2, 0x02, 0x70, 0xf3, 0x9a, 0xa5, 0x25, 0x45,
+  0xa4, 0xe4, 0x0f, 0xe0, 0x0c, 0x88, 0x41, 0x9d, 0xdc, 0x43, 0xa7, 0x82,
+  0x4a, 0xd9, 0xa8, 0xc3, 0xfe, 0x7a, 0xe2, 0xb1, 0xb8, 0xb5, 0x1b, 0xf8,
+  0xf7, 0x31, 0xe7, 0xcb, 0xce, 0x57, 0xbf, 0x57, 0x86, 0x68, 0x7e, 0x88,
+  0x92, 0xea, 0xcd, 0x3f, 0xf0, 0xb4, 0x90, 0x79, 0x85, 0x05, 0x2c, 0x3a,
+  0x2f, 0xd3, 0x0a, 0xd0, 0xb0, 0xa6, 0x7e, 0x12, 0x7e, 0xfd, 0xe4, 0x62,
+  0xc0, 0x7c, 0x2f, 0x0e, 0x5d, 0xe4, 0x29, 0xb7, 0x06, 0x8f, 0xf6, 0x10,
+  0xf1, 0x51, 0x3f, 0x04, 0xa1, 0xdb, 0x57, 0x78, 0xfc, 0xa2, 0x4f, 0x10,
+  0x74, 0xf5, 0x43, 0x9c, 0x01, 0x14, 0xea, 0x0f, 0x4c, 0xe6, 0x86, 0x41,
+  0xb6, 0x15, 0xed, 0x97, 0xd1, 0x4b, 0x16, 0x20, 0x03, 0x75, 0x29, 0xbb,
+  0xc2, 0x31, 0x9b, 0x3e, 0x6b, 0x68, 0x20, 0xc2, 0xdb, 0xb8, 0xff, 0xd6,
+  0xd0, 0xb1, 0xc7, 0x80, 0x9a, 0xc9, 0x6c, 0x52, 0x91, 0xff, 0x0c, 0xa6,
+  0xce, 0x85, 0xfb, 0x25, 0xdf, 0xc2, 0x68, 0x7f, 0x6f, 0x9b, 0x65, 0x76,
+  0x21, 0xc7, 0x98, 0xbd, 0xd0, 0x4d, 0xca, 0xdc, 0x11, 0x57, 0x30, 0xec,
+  0x17, 0x10, 0xa2, 0x76, 0xbc, 0xf5, 0xcd, 0xe2, 0xb7, 0xb5, 0x57, 0x02,
+  0x45, 0xf4, 0xb2, 0xb7, 0x9a, 0x94, 0xae, 0x6d, 0x4a, 0x29, 0x0d, 0x0d,
+  0x2d, 0xb9, 0x1b, 0xdc, 0xaf, 0x1a, 0xb5, 0x7a, 0x8d, 0x19, 0x58, 0xe9,
+  0x42, 0x62, 0xad, 0xea, 0xab, 0xdb, 0x46, 0x3d, 0x05, 0x31, 0x31, 0x36,
+  0xed, 0x67, 0xe2, 0x4d, 0xc7, 0x8d, 0x9b, 0xe3, 0x29, 0xb3, 0x30, 0xf4,
+  0xf2, 0x28, 0x81, 0x70, 0x16, 0x47, 0x49, 0xbe, 0x9f, 0x6c, 0xb7, 0xfb,
+  0x37, 0x34, 0x0e, 0xaa, 0xc1, 0xa3, 0xb3, 0x40, 0x3f, 0x98, 0x2f, 0x1a,
+  0x05, 0x82, 0xbc, 0x17, 0xdb, 0x36, 0x0d, 0x92, 0x5c, 0x1f, 0x03, 0x7f,
+  0xbd, 0x56, 0x9c, 0xa4, 0xcb, 0x67, 0x62, 0xa7, 0xb7, 0x37, 0x05, 0xed,
+  0x2b, 0xe6, 0x0e, 0x0f, 0xf8, 0xd1, 0xb8, 0x31, 0xec, 0x74, 0x2e, 0x56,
+  0x38, 0x85, 0x5b, 0xe8, 0x28, 0x25, 0xac, 0x5c, 0x2e, 0x7c, 0x19, 0xba,
+  0x70, 0x0a, 0xaf, 0x74, 0x54, 0xe1, 0x89, 0x19, 0xa5, 0xc9, 0xfc, 0x79,
+  0x6e, 0x15, 0x8c, 0x72, 0xd3, 0xa6, 0x61, 0x2f, 0x8a, 0x38, 0xd0, 0xae,
+  0x23, 0xdf, 0xb6, 0x1a, 0x15, 0xf5, 0x6b, 0xbd, 0xa0, 0x33, 0x6a, 0xbb,
+  0xc3, 0x6b, 0x5a, 0xcc, 0x8c, 0x54, 0x9b, 0xbc, 0x66, 0xa5, 0x01, 0x0f,
+  0x2b, 0xc6, 0xc4, 0xbf, 0xe8, 0x06, 0xf4, 0x53, 0xe0, 0xe9, 0xf2, 0x53,
+  0xc8, 0x2e, 0xff, 0x2f, 0x0f, 0x1d, 0x20, 0x77, 0x8e, 0xfb, 0x83, 0x5b,
+  0xa2, 0x0b, 0x41, 0xc9, 0xf6, 0xf3, 0x8d, 0xbe, 0x5c, 0x83, 0x16, 0x7d,
+  0x85, 0x18, 0x04, 0xed, 0xb2, 0x05, 0xeb, 0x3b, 0xbb, 0x9a, 0xb9, 0xe4,
+  0x24, 0x50, 0xc5, 0x0b, 0x24, 0x6f, 0x31, 0xdb, 0x0f, 0x5a, 0x4a, 0x09,
+  0x76, 0xa4, 0xa1, 0x43, 0xa1, 0x93, 0x69, 0x17, 0x12, 0x82, 0x7c, 0x99,
+  0x0e, 0xfa, 0x99, 0x5c, 0x00, 0xd5, 0x53, 0xf0, 0xb7, 0x7f, 0x92, 0x36,
+  0xe8, 0x0b, 0x9a, 0xc4, 0xe1, 0xcb, 0xc9, 0xbe, 0x0d, 0x6d, 0x87, 0x6f,
+  0x35, 0x18, 0x86, 0x48, 0xf0, 0x87, 0x4a, 0x79, 0x2f, 0xbd, 0xb9, 0x8c,
+  0x1f, 0xe1, 0x9b, 0x3a, 0x64, 0x7a, 0x6c, 0xec, 0x38, 0xd6, 0x41, 0xb7,
+  0xe7, 0x1e, 0x43, 0x34, 0x08, 0x6c, 0x72, 0xe8, 0xf3, 0xc0, 0xa8, 0x9e,
+  0x50, 0x7f, 0x02, 0xd3, 0xef, 0xae, 0x85, 0x8a, 0x3e, 0x6d, 0x55, 0x9b,
+  0xf5, 0xdf, 0x32, 0x00, 0xe7, 0xe6, 0x5d, 0xf1, 0xf5, 0xe3, 0x63, 0xff,
+  0xcc, 0x55, 0x47, 0x50, 0x43, 0x29, 0xfb, 0x3a, 0xad, 0xf5, 0xba, 0x8e,
+  0xba, 0x0e, 0x48, 0xe7, 0x0f, 0x5d, 0xb5, 0x49, 0xd0, 0x42, 0x7e, 0x7b,
+  0x22, 0x9b, 0xb5, 0x6e, 0x59, 0x4c, 0xe0, 0xd0, 0xe6, 0xf6, 0x7a, 0xff,
+  0x36, 0x80, 0xe3, 0x66, 0x2b, 0x7e, 0xd3, 0x7c, 0xf2, 0xdf, 0xe2, 0xda,
+  0xc0, 0x52, 0xb1, 0x7b, 0x4d, 0xe9, 0xf8, 0x7a, 0x66, 0xb9, 0x79, 0x19,
+  0x91, 0xb7, 0x9e, 0xd6, 0x47, 0x0b, 0x74, 0x6c, 0xd6, 0x7f, 0x35, 0x5d,
+  0xe9, 0x0f, 0xcb, 0xea, 0x96, 0x54, 0x0c, 0xfb, 0xc7, 0x76, 0x9c, 0x78,
+  0x4c, 0xe3, 0x02, 0x27, 0x5f, 0x93, 0x41, 0xf8, 0x54, 0x9e, 0x70, 0xaa,
+  0x18, 0x37, 0xcc, 0x9a, 0xbf, 0x59, 0x46, 0xb0, 0x3d, 0xd7, 0xe2, 0x31,
+  0x74, 0x97, 0xbe, 0x9e, 0x37, 0x60, 0x6b, 0x28, 0x40, 0xb5, 0xbb, 0x94,
+  0xe3, 0x7d, 0xc3, 0x42, 0xe2, 0x0e, 0x3e, 0x95, 0xeb, 0xb8, 0x41, 0xfc,
+  0x7e, 0xe2, 0x45, 0x0c, 0xed, 0x3c, 0x4e, 0xe2, 0x39, 0x16, 0x2f, 0x3d,
+  0x8a, 0xab, 0xe3, 0x2a, 0xd8, 0x6e, 0xe2, 0xbb, 0x44, 0x99, 0x27, 0xdd,
+  0xcc, 0xd9, 0xe7, 0xb7, 0x70, 0x27, 0x27, 0xce, 0x66, 0x6e, 0x43, 0x71,
+  0x0b, 0x97, 0x88, 0xb1, 0x2e, 0x17, 0x16, 0xe6, 0x79, 0x7f, 0x25, 0xc0,
+  0x35, 0xca, 0x56, 0x29, 0x74, 0xdf, 0x6f, 0x06, 0x79, 0xf8, 0x01, 0xf9,
+  0xae, 0xee, 0x1a, 0x6f, 0x6f, 0xf2, 0x83, 0x73, 0x9b, 0x1d, 0xe3, 0xc9,
+  0x29, 0x69, 0xf0, 0xfd, 0x79, 0xf0, 0xb6, 0xb2, 0x56, 0xaa, 0xaf, 0xf9,
+  0xc5, 0x58, 0x98, 0x89, 0x44, 0x1e, 0x94, 0xb3, 0x24, 0x6b, 0x7d, 0x9d,
+  0xb0, 0x5d, 0x18, 0x61, 0x8a, 0xa4, 0x7e, 0x68, 0x0b, 0x3b, 0x6b, 0xd6,
+  0xc5, 0xfa, 0x53, 0xf0, 0x1b, 0x71, 0x5e, 0x0e, 0x83, 0xb3, 0xe0, 0x98,
+  0x42, 0x8e, 0x5c, 0x64, 0x8c, 0xb9, 0x72, 0xd6, 0xb7, 0x8b, 0xd9, 0xdb,
+  0x2a, 0x9b, 0xd4, 0x1d, 0x0e, 0x6a, 0x01, 0xb3, 0x04, 0x9a, 0x0f, 0xe1,
+  0x0c, 0xfe, 0x71, 0xc3, 0x91, 0x89, 0xbb, 0x51, 0x52, 0xb0, 0xeb, 0xcb,
+  0x4f, 0x54, 0xde, 0xc2, 0xb9, 0xe4, 0x81, 0xd6, 0x49, 0x24, 0x38, 0x02,
+  0x33, 0x4b, 0x13, 0xfd, 0x4d, 0xd0, 0x23, 0x22, 0xcf, 0xde, 0x67, 0xbc,
+  0xff, 0xa0, 0x48, 0x66, 0x04, 0xec, 0x99, 0x9a, 0x98, 0x80, 0x9b, 0xaf,
+  0x8e, 0x8c, 0x9d, 0x6c, 0x9a, 0x40, 0x7d, 0x61, 0xd4, 0x33, 0xfd, 0x2e,
+  0x2a, 0xac, 0x7d, 0x1e, 0xe9, 0xfd, 0xcc, 0xf2, 0x97, 0x85, 0x57, 0x0e,
+  0xe8, 0xbd, 0x72, 0xdc, 0xc9, 0xf5, 0xdd, 0xa1, 0x8c, 0x4d, 0x08, 0xe8,
+  0xfe, 0x4f, 0x5d, 0x2d, 0xaf, 0x4b, 0x4e, 0x53, 0x9c, 0x91, 0x5e, 0xcd,
+  0x62, 0x73, 0xbb, 0x21, 0x17, 0xc7, 0x4c, 0x2b, 0x3c, 0xda, 0xb5, 0xb3,
+  0x5b, 0xbe, 0x5c, 0x1c, 0x72, 0x7d, 0x11, 0x4f, 0xde, 0xf7, 0xb5, 0x5e,
+  0xe3, 0xb3, 0x88, 0x73, 0x27, 0x11, 0xc8, 0xac, 0xb2, 0x9b, 0x22, 0xc8,
+  0x3f, 0x70, 0x1f, 0x3b, 0xdf, 0x9f, 0xa4, 0x4f, 0x5b, 0x41, 0xeb, 0x30,
+  0xab, 0xe3, 0xde, 0xea, 0xba, 0x00, 0xa0, 0xd6, 0x79, 0x7e, 0xa7, 0x16,
+  0x9d, 0x42, 0x18, 0x32, 0xb0, 0x3b, 0xc7, 0x17, 0x70, 0x36, 0x55, 0xe8,
+  0x52, 0xe9, 0xc9, 0x35, 0xcc, 0x17, 0xdd, 0x59, 0x91, 0x77, 0x1c, 0x1b,
+  0x1f, 0x0c, 0xd7, 0x5b, 0x4f, 0xb1, 0xfc, 0x21, 0xe2, 0x43, 0x5e, 0xa4,
+  0xde, 0xb5, 0xcf, 0x41, 0x2d, 0x90, 0xf5, 0x2f, 0x4e, 0xc0, 0xfd, 0x89,
+  0x12, 0xdc, 0x52, 0xea, 0x39, 0x95, 0x4e, 0x1e, 0xea, 0x8c, 0x7d, 0x39,
+  0x98, 0x61, 0x43, 0x4a, 0x77, 0x54, 0x77, 0xf0, 0x69, 0x75, 0x36, 0x58,
+  0x19, 0xa4, 0xa1, 0x3d, 0x30, 0x0a, 0xa3, 0x9c, 0x9f, 0xa7, 0xc3, 0x04,
+  0x84, 0xeb, 0xd7, 0x07, 0x97, 0xa1, 0x81, 0x8e, 0xff, 0x38, 0x9c, 0xf5,
+  0x1c, 0x62, 0x37, 0x65, 0x4f, 0xa0, 0xc5, 0x3d, 0x9d, 0x1d, 0xea, 0x12,
+  0x88, 0x42, 0x73, 0x2d, 0x61, 0xa0, 0xa2, 0xd4, 0x12, 0x6f, 0x6a, 0x56,
+  0x2a, 0xe2, 0x7f, 0xfe, 0x48, 0xbb, 0x6e, 0x7f, 0xfc, 0x41, 0x6c, 0x2f,
+  0x6f, 0x43, 0xb3, 0xcd, 0x5b, 0x46, 0xc5, 0x9f, 0xbc, 0xa2, 0x82, 0xd7,
+  0xa0, 0x5f, 0xf0, 0x0e, 0xd4, 0xfb, 0x3d, 0x74, 0x08, 0xac, 0x6a, 0xfd,
+  0x92, 0xc3, 0xe2, 0x37, 0x01, 0xef, 0x08, 0x81, 0xe4, 0x23, 0x04, 0xe2,
+  0x42, 0x42, 0x68, 0xad, 0xd3, 0xa8, 0x51, 0x68, 0x9f, 0x7e, 0x96, 0x84,
+  0x60, 0x07, 0xb2, 0xd5, 0xb7, 0xf8, 0x06, 0xa3, 0xfd, 0xd2, 0x96, 0x30,
+  0xac, 0xe6, 0xed, 0x0a, 0x24, 0x6b, 0xb5, 0x00, 0x49, 0xdc, 0xdf, 0x4e,
+  0x0b, 0xbb, 0xc7, 0xe6, 0xdb, 0xe8, 0xd9, 0x4d, 0xf6, 0x51, 0xd6, 0xb3,
+  0xca, 0x6e, 0x54, 0x23, 0x4d, 0x33, 0x24, 0xe7, 0x6e, 0x7d, 0x1a, 0x07,
+  0x67, 0x14, 0xec, 0xd7, 0xfa, 0xf5, 0xf9, 0xb2, 0xd4, 0xf9, 0x56, 0x35,
+  0xe2, 0x94, 0x15, 0xd5, 0x14, 0x8c, 0x5a, 0x86, 0xe8, 0xb2, 0x0c, 0x4d,
+  0xbe, 0xbf, 0x20, 0x13, 0xa5, 0xb6, 0xb2, 0xa8, 0x15, 0x72, 0x5a, 0x32,
+  0xa8, 0xc7, 0xbc, 0xec, 0x3d, 0xd2, 0x99, 0x35, 0x18, 0xe4, 0x67, 0x79,
+  0x1a, 0x41, 0x7d, 0x9b, 0xd4, 0xa6, 0xea, 0x4a, 0x99, 0x80, 0x4c, 0x40,
+  0x0b, 0x8f, 0x90, 0xf3, 0x6f, 0x85, 0x01, 0xbf, 0x28, 0x86, 0x12, 0x75,
+  0x4e, 0x70, 0x7d, 0x71, 0xf4, 0x73, 0x31, 0xee, 0xe1, 0x42, 0xe3, 0x46,
+  0x59, 0xbf, 0xfa, 0x18, 0x9d, 0x5d, 0xc1, 0x82, 0xb9, 0x02, 0xc0, 0x48,
+  0x7e, 0xcc, 0xac, 0x2d, 0x1e, 0xcb, 0x53, 0xda, 0x78, 0xa6, 0x0a, 0x42,
+  0x80, 0x55, 0x39, 0x4c, 0x10, 0xf9, 0xf5, 0xfe, 0x2e, 0x04, 0x4a, 0x8d,
+  0x30, 0x1b, 0x17, 0x6a, 0x73, 0x61, 0x82, 0x6f, 0x9a, 0x1e, 0x3d, 0x3d,
+  0x64, 0x53, 0x00, 0xa0, 0x52, 0x79, 0x63, 0x73, 0xb5, 0xdc, 0x6e, 0x61,
+  0x23, 0x7e, 0xf2, 0x40, 0x9e, 0x9d, 0xf5, 0xa6, 0xa7, 0x91, 0x18, 0x74,
+  0xab, 0x16, 0x71, 0x81, 0x17, 0xbd, 0xbb, 0xd0, 0x15, 0xd7, 0x43, 0x94,
+  0x7e, 0x7e, 0xf3, 0xaa, 0xf0, 0x17, 0x95, 0x92, 0xa5, 0xc6, 0x5e, 0xab,
+  0x2a, 0x2b, 0x40, 0x76, 0xbe, 0xb1, 0x11, 0x59, 0xb5, 0x45, 0x8e, 0xd5,
+  0xa8, 0x4b, 0x10, 0x23, 0x6f, 0xa4, 0x03, 0x36, 0xe7, 0x8b, 0xa9, 0x1d,
+  0x8c, 0x45, 0x9d, 0xb3, 0x07, 0xa3, 0x80, 0x7e, 0x8e, 0x4b, 0xa8, 0x0f,
+  0x66, 0xc3, 0x3f, 0x2b, 0x93, 0x7c, 0x93, 0x78, 0x27, 0xd1, 0x32, 0xfe,
+  0xb9, 0xe3, 0x1a, 0xf6, 0xb0, 0x0a, 0x16, 0x78, 0xdb, 0xa5, 0xe3, 0x95,
+  0x19, 0x54, 0xea, 0x77, 0x0b, 0x97, 0x5d, 0xc8, 0x3b, 0xba, 0x71, 0x6b,
+  0x6b, 0x83, 0x34, 0x5d, 0x17, 0x2a, 0xbb, 0xac, 0x19, 0x59, 0x5d, 0xec,
+  0x55, 0x66, 0x54, 0x08, 0xab, 0x7b, 0x08, 0x42, 0x93, 0xe9, 0xe3, 0x96,
+  0x56, 0xe8, 0xca, 0xbf, 0x11, 0x4f, 0xf2, 0x6d, 0x5a, 0x64, 0x0b, 0x60,
+  0x5e, 0x87, 0xe9, 0xb5, 0xe9, 0xf3, 0xc7, 0xca, 0x56, 0x40, 0x01, 0x51,
+  0xe8, 0x47, 0x20, 0x99, 0xb0, 0x48, 0x6a, 0x19, 0x71, 0x29, 0xa9, 0x1e,
+  0x06, 0xaa, 0xc0, 0x4b, 0x72, 0xa4, 0xaf, 0x65, 0x2b, 0x7f, 0x21, 0x59,
+  0x4b, 0x4d, 0xa6, 0xcc, 0xbf, 0x54, 0x98, 0xe5, 0xec, 0x25, 0xbe, 0x0e,
+  0xdd, 0xc2, 0x2b, 0xf7, 0x41, 0xa5, 0x14, 0x89, 0x93, 0x87, 0xde, 0x3e,
+  0xe9, 0x74, 0xe6, 0x98, 0x46, 0x77, 0x81, 0x5a, 0x98, 0x92, 0x7e, 0xa6,
+  0x21, 0x4b, 0xcb, 0xdc, 0x68, 0x08, 0xd7, 0x10, 0x41, 0xcc, 0x8d, 0xd5,
+  0x1d, 0xee, 0xbd, 0xe4, 0x52, 0x42, 0xdd, 0x7a, 0xeb, 0x2f, 0x94, 0xba,
+  0xed, 0xdc, 0x59, 0x12, 0x08, 0x56, 0x94, 0x0a, 0x69, 0xec, 0xf9, 0xb5,
+  0x94, 0x93, 0xed, 0xe3, 0x94, 0x7f, 0x72, 0x8a, 0xae, 0x02, 0x23, 0xfc,
+  0xdd, 0x26, 0x6c, 0x1e, 0x39, 0xd9, 0x3a, 0x41, 0x65, 0xbd, 0xfb, 0x42,
+  0x72, 0x7f, 0x1b, 0x8b, 0xaa, 0x1d, 0x5f, 0x7f, 0x4f, 0x43, 0xf0, 0x94,
+  0xf6, 0x4f, 0x62, 0x74, 0xec, 0xcc, 0xa8, 0x66, 0x95, 0xbf, 0x94, 0x11,
+  0xea, 0x55, 0x6e, 0x0c, 0x38, 0xf0, 0x6d, 0x0d, 0x8d, 0x4f, 0x00, 0x9d,
+  0x48, 0x43, 0x92, 0x45, 0x3e, 0x98, 0x0a, 0x25, 0x63, 0x49, 0x60, 0x83,
+  0x61, 0x26, 0x00, 0xc0, 0x42, 0xcd, 0x41, 0x1d, 0x39, 0xc6, 0xf4, 0x1f,
+  0xe7, 0x9d, 0xeb, 0x11, 0x84, 0x52, 0x2b, 0xfd, 0x24, 0x5e, 0xfd, 0x23,
+  0x8f, 0xf6, 0xef, 0xce, 0x9c, 0xe8, 0x62, 0x8a, 0x87, 0x1b, 0x67, 0x4a,
+  0xd0, 0xeb, 0x8d, 0x85, 0xbe, 0x35, 0x23, 0xbf, 0x30, 0x7d, 0xde, 0x92,
+  0x91, 0x9e, 0x8d, 0xb1, 0x2f, 0xb1, 0xed, 0xd6, 0x26, 0x85, 0x6a, 0x92,
+  0x94, 0x3b, 0x90, 0x55, 0x5b, 0xe0, 0x85, 0x0b, 0xaa, 0x25, 0x42, 0x11,
+  0x56, 0x72, 0x3e, 0x73, 0x13, 0x1f, 0x10, 0x53, 0x03, 0xed, 0x66, 0xc0,
+  0xfe, 0x9e, 0xf4, 0x9e, 0x08, 0xaf, 0xa1, 0x66, 0xe3, 0xe0, 0xfe, 0xb3,
+  0xe9, 0x09, 0x49, 0x55, 0x97, 0xbe, 0x78, 0xf3, 0x0e, 0xdf, 0x04, 0xb4,
+  0x36, 0xef, 0x53, 0x99, 0xd0, 0xcc, 0x26, 0x92, 0x48, 0x47, 0x31, 0xaa,
+  0xea, 0x71, 0xb0, 0xc5, 0xfa, 0xce, 0xc9, 0xb8, 0xd1, 0xae, 0x97, 0x4c,
+  0xa9, 0x70, 0xa2, 0xa0, 0x1e, 0x3a, 0x2c, 0x23, 0x38, 0xb7, 0x02, 0xf4,
+  0xa3, 0xc9, 0x0b, 0x9a, 0x03, 0x6a, 0x21, 0xa6, 0x5b, 0x75, 0xa4, 0xf8,
+  0xc2, 0x8b, 0x39, 0xfa, 0xdf, 0x12, 0x24, 0x05, 0x1b, 0x0f, 0x67, 0xbb,
+  0x4a, 0x9a, 0xcb, 0x36, 0x93, 0xce, 0x2a, 0x70, 0xf8, 0x93, 0x26, 0x5b,
+  0x41, 0x60, 0x4a, 0x6f, 0x0f, 0x89, 0x49, 0xb8, 0x20, 0x13, 0x70, 0x21,
+  0xf5, 0x85, 0xce, 0x75, 0x3b, 0x7d, 0x33, 0x6f, 0x5f, 0x1c, 0x44, 0x22,
+  0xcf, 0x13, 0x98, 0xcd, 0x9e, 0xc9, 0xe2, 0x56, 0x2c, 0xa6, 0x7e, 0x11,
+  0xab, 0x26, 0xe8, 0xb0, 0x74, 0x67, 0x37, 0x1b, 0x8f, 0x06, 0x94, 0x6b,
+  0xc0, 0x4e, 0xcc, 0xb4, 0x30, 0xcb, 0x44, 0x4c, 0x47, 0x0b, 0x22, 0x6b,
+  0xce, 0xe2, 0x3b, 0xc0, 0x34, 0xff, 0x3f, 0x3b, 0x46, 0x27, 0x22, 0xf0,
+  0x09, 0x3b, 0x9c, 0xf4, 0x32, 0x1c, 0x0b, 0x61, 0x57, 0x61, 0xed, 0x05,
+  0x87, 0x4c, 0xf7, 0xed, 0xb0, 0x9f, 0x4d, 0xcc, 0x87, 0xc2, 0x0d, 0x28,
+  0xbb, 0x3f, 0x0b, 0x5e, 0x54, 0x17, 0x1c, 0x5d, 0xdc, 0xa5, 0xe8, 0x52,
+  0x2e, 0x1a, 0x88, 0x2c, 0x80, 0x3e, 0x69, 0xc6, 0x84, 0xdd, 0x4e, 0x0a,
+  0xcd, 0x39, 0x51, 0x34, 0xd9, 0xb3, 0x9c, 0xee, 0x2e, 0x74, 0x35, 0xc9,
+  0xe9, 0x05, 0xdb, 0x84, 0xe7, 0xcc, 0xfc, 0xac, 0xfd, 0xd1, 0x54, 0x82,
+  0x8f, 0xa7, 0x89, 0xaf, 0x77, 0x31, 0x2c, 0x83, 0xf0, 0x61, 0x33, 0x5f,
+  0xb5, 0x08, 0x05, 0x0d, 0x78, 0x0f, 0x48, 0x25, 0x0f, 0x0b, 0xf3, 0x9e,
+  0x57, 0x02, 0xea, 0xcb, 0x13, 0xab, 0x43, 0xe8, 0x5d, 0xd5, 0x5c, 0xd2,
+  0x50, 0x1a, 0x2b, 0x98, 0x67, 0x6d, 0xf9, 0x54, 0xee, 0x5f, 0x0c, 0xd5,
+  0x94, 0x1a, 0x70, 0x6f, 0xdd, 0xcf, 0x38, 0x52, 0xa1, 0x29, 0x62, 0x9a,
+  0xcf, 0x0e, 0x1f, 0x1d, 0xdd, 0xe9, 0xf9, 0x44, 0xfe, 0x1b, 0x6e, 0x62,
+  0x37, 0x53, 0xd1, 0x54, 0x3a, 0x36, 0x36, 0x41, 0x1f, 0x5e, 0x8c, 0x34,
+  0x18, 0xdd, 0x53, 0xd4, 0x60, 0xaa, 0x99, 0x45, 0xc0, 0x2a, 0x0b, 0x98,
+  0xa7, 0x26, 0x09, 0xc9, 0xda, 0x4f, 0xa7, 0x72, 0x19, 0xfd, 0xda, 0x7c,
+  0x15, 0x03, 0x30, 0xdd, 0x81, 0x96, 0xbf, 0x49, 0x05, 0x1a, 0x6d, 0xc4,
+  0x08, 0xfd, 0x96, 0xb3, 0x4e, 0x25, 0x76, 0x51, 0x45, 0x8a, 0x3e, 0x9d,
+  0x46, 0x6d, 0xab, 0x08, 0x3a, 0x57, 0x2e, 0xbe, 0xa9, 0xc6, 0x1c, 0x2e,
+  0x65, 0x54, 0x26, 0xd9, 0x81, 0x60, 0xb1, 0x8a, 0x78, 0x44, 0x9b, 0x52,
+  0x75, 0x06, 0xc0, 0x52, 0x0d, 0xe8, 0xd5, 0xa6, 0x42, 0x47, 0x5c, 0x46,
+  0xa5, 0xd1, 0xbd, 0x91, 0x47, 0xf9, 0xc2, 0x9d, 0x20, 0xca, 0x8a, 0xca,
+  0xf7, 0x94, 0x7a, 0x6a, 0x23, 0x00, 0xea, 0xcb, 0x59, 0x33, 0x10, 0x98,
+  0xc1, 0x4f, 0xca, 0x97, 0x8c, 0xc9, 0xbd, 0xe6, 0xd6, 0xaf, 0xb9, 0xed,
+  0xec, 0x6c, 0xb2, 0x2e, 0x71, 0xaa, 0x1c, 0xa5, 0x04, 0xa0, 0x2c, 0x82,
+  0x12, 0x00, 0x89, 0xfa, 0xac, 0x47, 0x64, 0x8f, 0x6d, 0xb2, 0x4f, 0xe0,
+  0x50, 0xba, 0x85, 0x41, 0x5a, 0xc8, 0x8e, 0x2b, 0x9c, 0x64, 0x50, 0xec,
+  0xfd, 0xf7, 0x3e, 0x68, 0xba, 0x81, 0xec, 0x7a, 0xd1, 0x7d, 0xeb, 0xb2,
+  0xed, 0xf5, 0xf9, 0x24, 0x7f, 0x99, 0x5f, 0x36, 0x2c, 0x1a, 0xfc, 0xe7,
+  0x2a, 0xe1, 0xba, 0x86, 0xb8, 0x43, 0x87, 0x18, 0x01, 0x25, 0xe8, 0x55,
+  0xe1, 0x3d, 0xf2, 0xe0, 0xc9, 0x70, 0xb2, 0x82, 0x82, 0x75, 0xde, 0x33,
+  0x62, 0x29, 0xe8, 0x91, 0x18, 0x82, 0x9d, 0xcb, 0xb9, 0xc1, 0xeb, 0x14,
+  0xab, 0x3d, 0x6c, 0x9d, 0x34, 0xf4, 0x9b, 0x57, 0xdc, 0x8e, 0x42, 0x92,
+  0x55, 0x98, 0x61, 0xa8, 0xd3, 0x26, 0x78, 0x0a, 0x4c, 0x0f, 0x5a, 0x53,
+  0x96, 0xcc, 0x96, 0xcb, 0x9d, 0x81, 0xcb, 0x34, 0xf5, 0x07, 0x6d, 0x56,
+  0xba, 0x5b, 0x8d, 0x2f, 0x40, 0x6d, 0x59, 0xc8, 0x86, 0x9f, 0x94, 0xf5,
+  0xd1, 0xd8, 0xbc, 0x82, 0xf4, 0x33, 0xee, 0x4e, 0xa2, 0xaa, 0x7f, 0xf9,
+  0x7f, 0x49, 0xad, 0xf4, 0x46, 0x54, 0xc3, 0xcb, 0x3c, 0x84, 0x3b, 0xa3,
+  0xdd, 0x74, 0xec, 0xbf, 0x19, 0xe3, 0x19, 0x9a, 0x21, 0x87, 0x7c, 0xb6,
+  0x55, 0xd5, 0x18, 0x14, 0x31, 0x3b, 0xce, 0x0c, 0xce, 0xbd, 0xcf, 0x0a,
+  0x6a, 0xc1, 0xe9, 0x47, 0x67, 0x7e, 0x21, 0x70, 0xdc, 0xdf, 0xa1, 0x8d,
+  0xab, 0x68, 0x0e, 0x60, 0xb7, 0x7e, 0x7b, 0xfa, 0x3c, 0x95, 0xb5, 0x05,
+  0x0c, 0x78, 0xd7, 0x37, 0x98, 0x7e, 0xda, 0xa1, 0xdb, 0xdf, 0x19, 0x6f,
+  0x47, 0xcd, 0x45, 0x9c, 0x2a, 0xfc, 0xbf, 0x62, 0x76, 0x29, 0x47, 0x2d,
+  0x95, 0xa2, 0x54, 0xb5, 0x1f, 0xe8, 0x95, 0x53, 0x1d, 0xe2, 0x11, 0x92,
+  0xf6, 0x05, 0x19, 0xf1, 0xc4, 0xc1, 0x4f, 0xfa, 0x65, 0xa1, 0x97, 0x9f,
+  0x6e, 0x1f, 0x38, 0x16, 0xd5, 0xe7, 0xa8, 0x9e, 0xad, 0x77, 0xfc, 0xd9,
+  0x40, 0x66, 0x7e, 0x24, 0x36, 0xd4, 0xb7, 0x49, 0xde, 0x48, 0xcc, 0x44,
+  0xac, 0xff, 0xce, 0xa1, 0x76, 0x76, 0xad, 0x9a, 0x1c, 0x47, 0x5b, 0x15,
+  0x7d, 0x26, 0x01, 0x11, 0x7c, 0x7d, 0x74, 0x9e, 0xfb, 0x4d, 0x65, 0x20,
+  0xf9, 0xc5, 0x8f, 0x09, 0x0d, 0xad, 0x0f, 0xcc, 0xbf, 0x98, 0x13, 0xdd,
+  0xd9, 0xd7, 0x59, 0x32, 0x41, 0xfd, 0xb5, 0x33, 0x7b, 0x79, 0x63, 0xf1,
+  0xeb, 0x6f, 0x80, 0x81, 0x84, 0xd9, 0xaf, 0xa4, 0x9d, 0x51, 0x3f, 0xc0,
+  0x16, 0x58, 0x6a, 0x01, 0x05, 0xd0, 0x3c, 0x43, 0x98, 0x0e, 0xce, 0x8c,
+  0x2b, 0xb1, 0x94, 0xd4, 0xa6, 0x02, 0x9d, 0x1a, 0x83, 0x17, 0x71, 0x30,
+  0x01, 0x12, 0x8d, 0x58, 0x41, 0x7b, 0xd2, 0x41, 0x36, 0xd9, 0xe0, 0x17,
+  0x37, 0xbb, 0xa5, 0xd4, 0x76, 0x5f, 0x6e, 0x64, 0xb6, 0x7c, 0xf1, 0x58,
+  0x4f, 0x08, 0xba, 0xca, 0x91, 0xdf, 0x1a, 0x9c, 0xb6, 0x07, 0x46, 0xaf,
+  0xb2, 0xee, 0x99, 0x3d, 0x02, 0xb5, 0x6d, 0x64, 0x43, 0xdd, 0xd9, 0x56,
+  0xe9, 0xd1, 0xdf, 0xaf, 0x5d, 0x41, 0x6b, 0x84, 0x99, 0x3b, 0x09, 0xbe,
+  0x4c, 0xa2, 0x78, 0xba, 0x5c, 0x2b, 0xf5, 0x88, 0x1f, 0x0a, 0xac, 0xeb,
+  0x4c, 0xe0, 0xd6, 0x8e, 0x3a, 0x21, 0x92, 0x65, 0xaa, 0xe4, 0xff, 0xa0,
+  0xce, 0xdb, 0xd0, 0x4c, 0xcd, 0xce, 0x3b, 0x20, 0x1f, 0x0c, 0xad, 0x88,
+  0x93, 0x90, 0xba, 0x83, 0x32, 0x92, 0x9a, 0x20, 0x24, 0x1c, 0x97, 0xfe,
+  0x1f, 0x1f, 0x0c, 0x53, 0x2c, 0xc5, 0x62, 0xa0, 0x42, 0xa3, 0x71, 0x0a,
+  0x99, 0x46, 0x7e, 0x55, 0x4a, 0x6f, 0xed, 0x0b, 0x87, 0x6d, 0x68, 0xfa,
+  0xce, 0x02, 0x5c, 0xf7, 0x8f, 0xba, 0xdd, 0xd4, 0xab, 0x0f, 0x2d, 0xd5,
+  0x9e, 0x76, 0x9c, 0x1b, 0x40, 0x41, 0x1d, 0x68, 0x06, 0x4e, 0xac, 0xeb,
+  0xcc, 0x42, 0x35, 0xb0, 0xca, 0x5a, 0xad, 0x8d, 0xcd, 0xfa, 0x0a, 0xae,
+  0x90, 0x69, 0xea, 0xbe, 0xaf, 0x2b, 0xf9, 0x99, 0x5e, 0x85, 0xd4, 0x89,
+  0x52, 0x28, 0xc1, 0x99, 0x36, 0x4b, 0x26, 0x46, 0x24, 0xc3, 0x9d, 0xfb,
+  0x80, 0x20, 0x02, 0x38, 0xbd, 0x34, 0xac, 0xaa, 0x3f, 0xae, 0x67, 0x39,
+  0x64, 0xdd, 0x00, 0xaa, 0xe9, 0x01, 0x3a, 0x82, 0x9a, 0x72, 0x06, 0xf9,
+  0x22, 0x0c, 0x4c, 0x69, 0x48, 0x14, 0xc1, 0x72, 0xc4, 0xcb, 0x1d, 0xba,
+  0x5b, 0x35, 0x8e, 0x46, 0xf8, 0x4f, 0x9a, 0xc6, 0xa2, 0xf4, 0x4b, 0x96,
+  0xd7, 0x54, 0xc5, 0x2f, 0x27, 0xce, 0x01, 0x26, 0x69, 0x43, 0x4c, 0x08,
+  0xe8, 0x2e, 0x57, 0x84, 0x10, 0x15, 0xf3, 0xa5, 0x1b, 0xdb, 0x61, 0x38,
+  0x94, 0x39, 0x3e, 0xf7, 0x1b, 0xe7, 0x3e, 0x94, 0xa6, 0x74, 0x60, 0xcb,
+  0xe8, 0xd6, 0xd1, 0x68, 0x1e, 0x4e, 0xa7, 0xaf, 0x31, 0xe9, 0xdd, 0x3c,
+  0xdb, 0x0b, 0xb9, 0xdd, 0x42, 0xe7, 0x33, 0xe5, 0xda, 0x5c, 0x0e, 0x14,
+  0x81, 0x3b, 0x95, 0x03, 0x01, 0x83, 0x78, 0x60, 0x40, 0x12, 0x47, 0xb3,
+  0x7d, 0x93, 0x57, 0xe4, 0x7f, 0x41, 0x9c, 0x9a, 0xc6, 0x74, 0x66, 0x92,
+  0xee, 0x1b, 0xb7, 0x31, 0x0f, 0xfd, 0x6b, 0xa6, 0x34, 0xef, 0x22, 0x62,
+  0x71, 0x0a, 0x30, 0x2e, 0xa7, 0x7e, 0x6b, 0xaf, 0xa4, 0xb1, 0x6b, 0xff,
+  0x86, 0x69, 0xd6, 0x60, 0xe6, 0x2f, 0xe0, 0xf3, 0x2c, 0x9c, 0xcb, 0x61,
+  0xae, 0xbb, 0x22, 0x3c, 0xab, 0x4b, 0xd3, 0x16, 0xab, 0x18, 0x62, 0x37,
+  0x19, 0x8f, 0x50, 0x2a, 0xb4, 0xda, 0x0c, 0x0d, 0x38, 0x87, 0x10, 0xf5,
+  0x17, 0x14, 0x66, 0x7c, 0x5b, 0x8b, 0xab, 0x24, 0x15, 0x36, 0xcc, 0xcf,
+  0xbf, 0xd0, 0x00, 0x00, 0x12, 0x00, 0x23, 0x00, 0x30, 0x00, 0x3d, 0x00,
+  0x4a, 0x00, 0x55, 0x00, 0x68, 0x00, 0x75, 0x00, 0x81, 0x00, 0x8c, 0x00,
+  0x97, 0x00, 0xa5, 0x00, 0xb1, 0x00, 0xc4, 0x00, 0xd5, 0x00, 0x00, 0x00,
+  0x57, 0x00, 0xb2, 0x00, 0x0b, 0x01, 0x19, 0x01, 0x25, 0x01, 0x32, 0x01,
+  0x40, 0x01, 0x4e, 0x01, 0x5d, 0x01, 0x6c, 0x01, 0x7b, 0x01, 0x00, 0x00,
+  0x53, 0x00, 0xa8, 0x00, 0xff, 0x00, 0x58, 0x01, 0xad, 0x01, 0x04, 0x02,
+  0x1a, 0x02, 0x2b, 0x02, 0x37, 0x02, 0x46, 0x02, 0x55, 0x02, 0x63, 0x02,
+  0x71, 0x02, 0x83, 0x02, 0x97, 0x02, 0xa8, 0x02, 0xb7, 0x02, 0xcc, 0x02,
+  0xdb, 0x02, 0xec, 0x02, 0x00, 0x00, 0x0e, 0x00, 0x18, 0x00, 0x28, 0x00,
+  0x36, 0x00, 0x43, 0x00, 0x51, 0x00, 0x59, 0x00, 0x68, 0x00, 0x74, 0x00,
+  0x7f, 0x00, 0x89, 0x00, 0x98, 0x00, 0xa9, 0x00, 0x00, 0x00, 0x0b, 0x00,
+  0x16, 0x00, 0x23, 0x00, 0x31, 0x00, 0x42, 0x00, 0x4e, 0x00, 0x5d, 0x00,
+  0x6e, 0x00, 0x79, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x14, 0x00, 0x26, 0x00,
+  0x34, 0x00, 0x43, 0x00, 0x4e, 0x00, 0x5f, 0x00, 0x6f, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x21, 0x00, 0x2f, 0x00, 0x3a, 0x00, 0x48, 0x00, 0x5a, 0x00,
+  0x67, 0x00, 0x75, 0x00, 0x87, 0x00, 0x8f, 0x00, 0x00, 0x00, 0x12, 0x00,
+  0x20, 0x00, 0x2f, 0x00, 0x3a, 0x00, 0x47, 0x00, 0x54, 0x00, 0x61, 0x00,
+  0x6f, 0x00, 0x7d, 0x00, 0x8e, 0x00, 0x97, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x19, 0x00, 0x23, 0x00, 0x2e, 0x00, 0x3d, 0x00, 0x49, 0x00, 0x55, 0x00,
+  0x64, 0x00, 0x70, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1e, 0x00,
+  0x30, 0x00, 0x3b, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x10, 0x00, 0x1d, 0x00,
+  0x28, 0x00, 0x36, 0x00, 0x41, 0x00, 0x4f, 0x00, 0x5a, 0x00, 0x70, 0x00,
+  0x7c, 0x00, 0x89, 0x00, 0x94, 0x00, 0x9f, 0x00, 0xad, 0x00, 0xb8, 0x00,
+  0x00, 0x00, 0x0b, 0x00, 0x16, 0x00, 0x21, 0x00, 0x2d, 0x00, 0x3a, 0x00,
+  0x47, 0x00, 0x52, 0x00, 0x5e, 0x00, 0x6b, 0x00, 0x75, 0x00, 0x80, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x1a, 0x00,
+  0x2e, 0x00, 0x39, 0x00, 0x44, 0x00, 0x4f, 0x00, 0x5a, 0x00, 0x66, 0x00,
+  0x72, 0x00, 0x7d, 0x00, 0x8b, 0x00, 0x98, 0x00, 0xa5, 0x00, 0xb1, 0x00,
+  0xc0, 0x00, 0xcd, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x21, 0x00, 0x2e, 0x00,
+  0x3c, 0x00, 0x4b, 0x00, 0x5c, 0x00, 0x69, 0x00, 0x79, 0x00, 0x85, 0x00,
+  0x93, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x1a, 0x00, 0x29, 0x00, 0x3b, 0x00,
+  0x48, 0x00, 0x54, 0x00, 0x5f, 0x00, 0x69, 0x00, 0x71, 0x00, 0x7c, 0x00,
+  0x87, 0x00, 0x93, 0x00, 0xa0, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x1c, 0x00,
+  0x29, 0x00, 0x36, 0x00, 0x46, 0x00, 0x51, 0x00, 0x5e, 0x00, 0x76, 0x00,
+  0x84, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x18, 0x00, 0x26, 0x00, 0x32, 0x00,
+  0x3c, 0x00, 0x4e, 0x00, 0x5e, 0x00, 0x70, 0x00, 0x7f, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x20, 0x00, 0x2c, 0x00, 0x36, 0x00, 0x4b, 0x00, 0x55, 0x00,
+  0x60, 0x00, 0x6b, 0x00, 0x76, 0x00, 0x82, 0x00, 0x8d, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x24, 0x00, 0x32, 0x00, 0x3e, 0x00, 0x49, 0x00, 0x58, 0x00,
+  0x69, 0x00, 0x78, 0x00, 0x86, 0x00, 0x92, 0x00, 0xa0, 0x00, 0xaf, 0x00,
+  0xbb, 0x00, 0xc8, 0x00, 0xd9, 0x00, 0xe7, 0x00, 0xf5, 0x00, 0x02, 0x01,
+  0x10, 0x01, 0x1e, 0x01, 0x29, 0x01, 0x35, 0x01, 0x42, 0x01, 0x50, 0x01,
+  0x00, 0x00, 0x0b, 0x00, 0x15, 0x00, 0x24, 0x00, 0x30, 0x00, 0x43, 0x00,
+  0x59, 0x00, 0x67, 0x00, 0x76, 0x00, 0x83, 0x00, 0x8f, 0x00, 0x9d, 0x00,
+  0xa9, 0x00, 0xb7, 0x00, 0xc2, 0x00, 0xd1, 0x00, 0xdf, 0x00, 0xea, 0x00,
+  0xfc, 0x00, 0x09, 0x01, 0x16, 0x01, 0x23, 0x01, 0x2f, 0x01, 0x3b, 0x01,
+  0x44, 0x01, 0x50, 0x01, 0x00, 0x00, 0x10, 0x00, 0x1a, 0x00, 0x2a, 0x00,
+  0x38, 0x00, 0x45, 0x00, 0x4f, 0x00, 0x60, 0x00, 0x6d, 0x00, 0x7b, 0x00,
+  0x89, 0x00, 0x97, 0x00, 0xa8, 0x00, 0xb9, 0x00, 0xc7, 0x00, 0xd7, 0x00,
+  0xe5, 0x00, 0xf2, 0x00, 0xfc, 0x00, 0x0a, 0x01, 0x20, 0x01, 0x2f, 0x01,
+  0x3e, 0x01, 0x4c, 0x01, 0x59, 0x01, 0x64, 0x01, 0x70, 0x01, 0x7a, 0x01,
+  0x86, 0x01, 0x97, 0x01, 0x00, 0x00, 0x0a, 0x00, 0x1a, 0x00, 0x28, 0x00,
+  0x37, 0x00, 0x42, 0x00, 0x55, 0x00, 0x62, 0x00, 0x6c, 0x00, 0x80, 0x00,
+  0x93, 0x00, 0x9e, 0x00, 0xb0, 0x00, 0xc0, 0x00, 0xca, 0x00, 0xde, 0x00,
+  0xea, 0x00, 0x00, 0x00, 0x10, 0x00, 0x20, 0x00, 0x30, 0x00, 0x46, 0x00,
+  0x53, 0x00, 0x5e, 0x00, 0x6e, 0x00, 0x80, 0x00, 0x8e, 0x00, 0x9b, 0x00,
+  0xae, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x17, 0x00, 0x22, 0x00, 0x30, 0x00,
+  0x3e, 0x00, 0x56, 0x00, 0x64, 0x00, 0x76, 0x00, 0x81, 0x00, 0x89, 0x00,
+  0x94, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x1e, 0x00, 0x2c, 0x00, 0x3f, 0x00,
+  0x4b, 0x00, 0x55, 0x00, 0x60, 0x00, 0x76, 0x00, 0x87, 0x00, 0x9a, 0x00,
+  0xaa, 0x00, 0x00, 0x00, 0x14, 0x00, 0x23, 0x00, 0x30, 0x00, 0x3e, 0x00,
+  0x4c, 0x00, 0x58, 0x00, 0x67, 0x00, 0x78, 0x00, 0x88, 0x00, 0x96, 0x00,
+  0xa4, 0x00, 0xb3, 0x00, 0xc1, 0x00, 0xce, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x1d, 0x00, 0x28, 0x00, 0x3b, 0x00, 0x51, 0x00, 0x5d, 0x00, 0x69, 0x00,
+  0x7d, 0x00, 0x8a, 0x00, 0x96, 0x00, 0xa7, 0x00, 0xb5, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x4f, 0x00, 0x5e, 0x00, 0x6d, 0x00, 0x78, 0x00, 0x83, 0x00,
+  0x93, 0x00, 0xa0, 0x00, 0xad, 0x00, 0xbc, 0x00, 0xca, 0x00, 0xd7, 0x00,
+  0x00, 0x00, 0x42, 0x00, 0x4e, 0x00, 0x59, 0x00, 0x6b, 0x00, 0x7c, 0x00,
+  0x88, 0x00, 0x93, 0x00, 0x9e, 0x00, 0xaa, 0x00, 0xb5, 0x00, 0xc1, 0x00,
+  0xd0, 0x00, 0xdb, 0x00, 0xe9, 0x00, 0xf4, 0x00, 0x00, 0x00, 0x0b, 0x00,
+  0x16, 0x00, 0x21, 0x00, 0x2c, 0x00, 0x38, 0x00, 0x43, 0x00, 0x4f, 0x00,
+  0x5e, 0x00, 0x6c, 0x00, 0x7c, 0x00, 0x87, 0x00, 0x93, 0x00, 0xa0, 0x00,
+  0xac, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x16, 0x00, 0x26, 0x00, 0x33, 0x00,
+  0x3e, 0x00, 0x4c, 0x00, 0x59, 0x00, 0x67, 0x00, 0x74, 0x00, 0x81, 0x00,
+  0x8d, 0x00, 0x99, 0x00, 0xa4, 0x00, 0xb0, 0x00, 0xbc, 0x00, 0xce, 0x00,
+  0x00, 0x00, 0x0f, 0x00, 0x1e, 0x00, 0x2b, 0x00, 0x3c, 0x00, 0x4a, 0x00,
+  0x58, 0x00, 0x65, 0x00, 0x73, 0x00, 0x80, 0x00, 0x8d, 0x00, 0x9a, 0x00,
+  0xa7, 0x00, 0xb3, 0x00, 0xc1, 0x00, 0xce, 0x00, 0xdb, 0x00, 0xe7, 0x00,
+  0xf3, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x16, 0x00, 0x28, 0x00, 0x3a, 0x00,
+  0x47, 0x00, 0x57, 0x00, 0x66, 0x00, 0x71, 0x00, 0x7c, 0x00, 0x87, 0x00,
+  0x91, 0x00, 0x9c, 0x00, 0xab, 0x00, 0xbb, 0x00, 0xce, 0x00, 0xe0, 0x00,
+  0xeb, 0x00, 0xf6, 0x00, 0x09, 0x01, 0x14, 0x01, 0x23, 0x01, 0x30, 0x01,
+  0x3b, 0x01, 0x4a, 0x01, 0x59, 0x01, 0x66, 0x01, 0x00, 0x00, 0x0d, 0x00,
+  0x1c, 0x00, 0x27, 0x00, 0x35, 0x00, 0x45, 0x00, 0x54, 0x00, 0x5f, 0x00,
+  0x00, 0x00, 0x0f, 0x00, 0x1d, 0x00, 0x28, 0x00, 0x35, 0x00, 0x41, 0x00,
+  0x4c, 0x00, 0x5c, 0x00, 0x69, 0x00, 0x74, 0x00, 0x7e, 0x00, 0x8f, 0x00,
+  0x9f, 0x00, 0xab, 0x00, 0xb7, 0x00, 0xcb, 0x00, 0xd7, 0x00, 0xe4, 0x00,
+  0xec, 0x00, 0xfd, 0x00, 0x0d, 0x01, 0x1e, 0x01, 0x2e, 0x01, 0x39, 0x01,
+  0x48, 0x01, 0x00, 0x00, 0x12, 0x00, 0x20, 0x00, 0x29, 0x00, 0x33, 0x00,
+  0x3e, 0x00, 0x49, 0x00, 0x00, 0x00, 0x38, 0x00, 0x46, 0x00, 0x57, 0x00,
+  0x66, 0x00, 0x74, 0x00, 0x81, 0x00, 0x92, 0x00, 0xa1, 0x00, 0xac, 0x00,
+  0xbb, 0x00, 0xce, 0x00, 0xdb, 0x00, 0xec, 0x00, 0xfd, 0x00, 0x11, 0x01,
+  0x1f, 0x01, 0x2c, 0x01, 0x3a, 0x01, 0x46, 0x01, 0x57, 0x01, 0x7a, 0x01,
+  0x8b, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x17, 0x00, 0x27, 0x00, 0x33, 0x00,
+  0x44, 0x00, 0x57, 0x00, 0x63, 0x00, 0x72, 0x00, 0x7e, 0x00, 0x8a, 0x00,
+  0x9a, 0x00, 0xac, 0x00, 0xc1, 0x00, 0x00, 0x00, 0x14, 0x00, 0x25, 0x00,
+  0x38, 0x00, 0x49, 0x00, 0x5a, 0x00, 0x6f, 0x00, 0x7f, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x22, 0x00, 0x2e, 0x00, 0x3b, 0x00, 0x46, 0x00, 0x52, 0x00,
+  0x5c, 0x00, 0x67, 0x00, 0x71, 0x00, 0x80, 0x00, 0x94, 0x00, 0x9f, 0x00,
+  0xaf, 0x00, 0xbc, 0x00, 0xc6, 0x00, 0xd0, 0x00, 0xe6, 0x00, 0xf4, 0x00,
+  0xff, 0x00, 0x00, 0x00, 0x13, 0x00, 0x25, 0x00, 0x35, 0x00, 0x40, 0x00,
+  0x4c, 0x00, 0x5d, 0x00, 0x67, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x18, 0x00,
+  0x27, 0x00, 0x34, 0x00, 0x43, 0x00, 0x4f, 0x00, 0x5b, 0x00, 0x69, 0x00,
+  0x76, 0x00, 0x89, 0x00, 0x9b, 0x00, 0xa8, 0x00, 0xb8, 0x00, 0xc8, 0x00,
+  0xd6, 0x00, 0xe0, 0x00, 0xed, 0x00, 0xf9, 0x00, 0x06, 0x01, 0x00, 0x00,
+  0x12, 0x00, 0x1e, 0x00, 0x2a, 0x00, 0x35, 0x00, 0x3f, 0x00, 0x4d, 0x00,
+  0x57, 0x00, 0x62, 0x00, 0x70, 0x00, 0x8c, 0x00, 0x97, 0x00, 0x00, 0x00,
+  0x38, 0x00, 0x46, 0x00, 0x50, 0x00, 0x5b, 0x00, 0x6a, 0x00, 0x76, 0x00,
+  0x84, 0x00, 0x98, 0x00, 0xa4, 0x00, 0xb3, 0x00, 0xbf, 0x00, 0xcf, 0x00,
+  0xde, 0x00, 0x00, 0x00, 0x11, 0x00, 0x22, 0x00, 0x2d, 0x00, 0x39, 0x00,
+  0x44, 0x00, 0x4f, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x11, 0x00, 0x1e, 0x00,
+  0x2e, 0x00, 0x3f, 0x00, 0x4a, 0x00, 0x57, 0x00, 0x69, 0x00, 0x78, 0x00,
+  0x8c, 0x00, 0x9c, 0x00, 0xab, 0x00, 0xb6, 0x00, 0xc5, 0x00, 0xd6, 0x00,
+  0xe3, 0x00, 0xf5, 0x00, 0x03, 0x01, 0x13, 0x01, 0x22, 0x01, 0x32, 0x01,
+  0x00, 0x00, 0x0b, 0x00, 0x1c, 0x00, 0x27, 0x00, 0x32, 0x00, 0x3d, 0x00,
+  0x4a, 0x00, 0x55, 0x00, 0x60, 0x00, 0x6b, 0x00, 0x78, 0x00, 0x82, 0x00,
+  0x8d, 0x00, 0x98, 0x00, 0xa5, 0x00, 0xaf, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x1f, 0x00, 0x2c, 0x00, 0x3a, 0x00, 0x47, 0x00, 0x54, 0x00, 0x66, 0x00,
+  0x78, 0x00, 0x86, 0x00, 0x93, 0x00, 0xa0, 0x00, 0xb0, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x19, 0x00, 0x2b, 0x00, 0x36, 0x00, 0x48, 0x00, 0x5a, 0x00,
+  0x6c, 0x00, 0x77, 0x00, 0x81, 0x00, 0x90, 0x00, 0x9d, 0x00, 0xaa, 0x00,
+  0xba, 0x00, 0xdd, 0x00, 0xe9, 0x00, 0x00, 0x00, 0x22, 0x00, 0x32, 0x00,
+  0x3c, 0x00, 0x4d, 0x00, 0x62, 0x00, 0x6c, 0x00, 0x7c, 0x00, 0x91, 0x00,
+  0xa4, 0x00, 0xb0, 0x00, 0xba, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x1c, 0x00,
+  0x28, 0x00, 0x34, 0x00, 0x41, 0x00, 0x4c, 0x00, 0x5a, 0x00, 0x68, 0x00,
+  0x76, 0x00, 0x84, 0x00, 0x8e, 0x00, 0x9a, 0x00, 0xa7, 0x00, 0xb4, 0x00,
+  0xc3, 0x00, 0xce, 0x00, 0xd9, 0x00, 0xe1, 0x00, 0xf0, 0x00, 0x00, 0x01,
+  0x0b, 0x01, 0x18, 0x01, 0x24, 0x01, 0x31, 0x01, 0x3d, 0x01, 0x49, 0x01,
+  0x58, 0x01, 0x68, 0x01, 0x74, 0x01, 0x00, 0x00, 0x10, 0x00, 0x1e, 0x00,
+  0x2f, 0x00, 0x3b, 0x00, 0x46, 0x00, 0x58, 0x00, 0x63, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x1d, 0x00, 0x29, 0x00, 0x39, 0x00, 0x45, 0x00, 0x53, 0x00,
+  0x64, 0x00, 0x75, 0x00, 0x7f, 0x00, 0x97, 0x00, 0xa6, 0x00, 0xb9, 0x00,
+  0xc5, 0x00, 0xd5, 0x00, 0xe3, 0x00, 0xf1, 0x00, 0x02, 0x01, 0x00, 0x00,
+  0x0c, 0x00, 0x17, 0x00, 0x22, 0x00, 0x2e, 0x00, 0x3a, 0x00, 0x46, 0x00,
+  0x59, 0x00, 0x69, 0x00, 0x76, 0x00, 0x83, 0x00, 0x00, 0x00, 0x11, 0x00,
+  0x21, 0x00, 0x33, 0x00, 0x42, 0x00, 0x52, 0x00, 0x62, 0x00, 0x71, 0x00,
+  0x84, 0x00, 0x96, 0x00, 0xa5, 0x00, 0xb6, 0x00, 0xc6, 0x00, 0xd7, 0x00,
+  0xe7, 0x00, 0xf8, 0x00, 0x08, 0x01, 0x19, 0x01, 0x2a, 0x01, 0x00, 0x00,
+  0x0b, 0x00, 0x16, 0x00, 0x21, 0x00, 0x2c, 0x00, 0x3c, 0x00, 0x47, 0x00,
+  0x57, 0x00, 0x62, 0x00, 0x6f, 0x00, 0x81, 0x00, 0x92, 0x00, 0x9c, 0x00,
+  0xa9, 0x00, 0xb7, 0x00, 0xc7, 0x00, 0xd2, 0x00, 0x00, 0x00, 0x0f, 0x00,
+  0x1f, 0x00, 0x29, 0x00, 0x35, 0x00, 0x49, 0x00, 0x5a, 0x00, 0x65, 0x00,
+  0x73, 0x00, 0x85, 0x00, 0x97, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x1a, 0x00,
+  0x23, 0x00, 0x35, 0x00, 0x41, 0x00, 0x4e, 0x00, 0x5e, 0x00, 0x6e, 0x00,
+  0x7d, 0x00, 0x88, 0x00, 0x94, 0x00, 0xa5, 0x00, 0xb1, 0x00, 0x00, 0x00,
+  0x22, 0x00, 0x2e, 0x00, 0x43, 0x00, 0x4e, 0x00, 0x62, 0x00, 0x77, 0x00,
+  0x89, 0x00, 0x94, 0x00, 0xa0, 0x00, 0xb3, 0x00, 0xbe, 0x00, 0xc9, 0x00,
+  0xd5, 0x00, 0xe0, 0x00, 0xf4, 0x00, 0x02, 0x01, 0x0e, 0x01, 0x19, 0x01,
+  0x28, 0x01, 0x33, 0x01, 0x40, 0x01, 0x4d, 0x01, 0x60, 0x01, 0x00, 0x00,
+  0x10, 0x00, 0x20, 0x00, 0x2f, 0x00, 0x3c, 0x00, 0x4a, 0x00, 0x55, 0x00,
+  0x64, 0x00, 0x72, 0x00, 0x80, 0x00, 0x8f, 0x00, 0x9e, 0x00, 0xb1, 0x00,
+  0x00, 0x00, 0x17, 0x00, 0x23, 0x00, 0x31, 0x00, 0x43, 0x00, 0x4f, 0x00,
+  0x5a, 0x00, 0x64, 0x00, 0x76, 0x00, 0x82, 0x00, 0x8e, 0x00, 0x99, 0x00,
+  0xa4, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x17, 0x00, 0x22, 0x00, 0x2c, 0x00,
+  0x37, 0x00, 0x43, 0x00, 0x50, 0x00, 0x5c, 0x00, 0x67, 0x00, 0x71, 0x00,
+  0x7e, 0x00, 0x89, 0x00, 0x95, 0x00, 0xaa, 0x00, 0xb7, 0x00, 0xc7, 0x00,
+  0xd3, 0x00, 0xe0, 0x00, 0xec, 0x00, 0xfb, 0x00, 0x07, 0x01, 0x00, 0x00,
+  0x11, 0x00, 0x1e, 0x00, 0x2b, 0x00, 0x35, 0x00, 0x46, 0x00, 0x53, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x18, 0x00, 0x26, 0x00, 0x34, 0x00, 0x41, 0x00,
+  0x50, 0x00, 0x5e, 0x00, 0x6b, 0x00, 0x79, 0x00, 0x86, 0x00, 0x93, 0x00,
+  0xa0, 0x00, 0xad, 0x00, 0xbd, 0x00, 0xca, 0x00, 0xd6, 0x00, 0xe3, 0x00,
+  0xef, 0x00, 0xfb, 0x00, 0x07, 0x01, 0x00, 0x00, 0x0e, 0x00, 0x1d, 0x00,
+  0x28, 0x00, 0x32, 0x00, 0x41, 0x00, 0x52, 0x00, 0x64, 0x00, 0x77, 0x00,
+  0x89, 0x00, 0x98, 0x00, 0xab, 0x00, 0xb7, 0x00, 0xc3, 0x00, 0xd5, 0x00,
+  0xe5, 0x00, 0xf1, 0x00, 0xfe, 0x00, 0x0c, 0x01, 0x19, 0x01, 0x27, 0x01,
+  0x37, 0x01, 0x41, 0x01, 0x53, 0x01, 0x00, 0x00, 0x0e, 0x00, 0x1d, 0x00,
+  0x32, 0x00, 0x41, 0x00, 0x4c, 0x00, 0x57, 0x00, 0x66, 0x00, 0x74, 0x00,
+  0x7f, 0x00, 0x8b, 0x00, 0x98, 0x00, 0xa9, 0x00, 0xb9, 0x00, 0xc7, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x1c, 0x00, 0x2a, 0x00, 0x36, 0x00, 0x46, 0x00,
+  0x56, 0x00, 0x63, 0x00, 0x6e, 0x00, 0x7a, 0x00, 0x85, 0x00, 0x91, 0x00,
+  0x9e, 0x00, 0xa9, 0x00, 0xb8, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x1e, 0x00,
+  0x2d, 0x00, 0x00, 0x00, 0x20, 0x00, 0x2e, 0x00, 0x3c, 0x00, 0x4b, 0x00,
+  0x58, 0x00, 0x64, 0x00, 0x6e, 0x00, 0x7b, 0x00, 0x8c, 0x00, 0x99, 0x00,
+  0xa3, 0x00, 0xb3, 0x00, 0xc0, 0x00, 0xce, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x1d, 0x00, 0x2f, 0x00, 0x42, 0x00, 0x51, 0x00, 0x5a, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x31, 0x00, 0x3d, 0x00, 0x4b, 0x00, 0x59, 0x00, 0x67, 0x00,
+  0x7c, 0x00, 0x91, 0x00, 0xa6, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x19, 0x00,
+  0x28, 0x00, 0x33, 0x00, 0x3f, 0x00, 0x4b, 0x00, 0x56, 0x00, 0x62, 0x00,
+  0x77, 0x00, 0x7f, 0x00, 0x86, 0x00, 0x92, 0x00, 0x99, 0x00, 0xa7, 0x00,
+  0xb2, 0x00, 0x00, 0x00, 0x17, 0x00, 0x27, 0x00, 0x39, 0x00, 0x4c, 0x00,
+  0x5c, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x37, 0x00, 0x5e, 0x00, 0x83, 0x00,
+  0xba, 0x00, 0xd5, 0x00, 0xee, 0x00, 0x0a, 0x01, 0x29, 0x01, 0x36, 0x01,
+  0x44, 0x01, 0x50, 0x01, 0x5d, 0x01, 0x70, 0x01, 0x7d, 0x01, 0x8a, 0x01,
+  0x95, 0x01, 0xa3, 0x01, 0xb0, 0x01, 0xbb, 0x01, 0xc9, 0x01, 0xd6, 0x01,
+  0xe0, 0x01, 0xea, 0x01, 0xf4, 0x01, 0xff, 0x01, 0x0e, 0x02, 0x1c, 0x02,
+  0x2a, 0x02, 0x00, 0x00, 0x0f, 0x00, 0x17, 0x00, 0x24, 0x00, 0x2f, 0x00,
+  0x3a, 0x00, 0x46, 0x00, 0x4e, 0x00, 0x57, 0x00, 0x6b, 0x00, 0x7b, 0x00,
+  0x8b, 0x00, 0x9b, 0x00, 0xa6, 0x00, 0x00, 0x00, 0x39, 0x00, 0x62, 0x00,
+  0x89, 0x00, 0xc2, 0x00, 0xdf, 0x00, 0xfa, 0x00, 0x27, 0x01, 0x35, 0x01,
+  0x41, 0x01, 0x4f, 0x01, 0x5e, 0x01, 0x6d, 0x01, 0x7b, 0x01, 0x86, 0x01,
+  0x94, 0x01, 0xa2, 0x01, 0xb1, 0x01, 0xc0, 0x01, 0xd2, 0x01, 0xdc, 0x01,
+  0x00, 0x00, 0x0b, 0x00, 0x17, 0x00, 0x25, 0x00, 0x31, 0x00, 0x43, 0x00,
+  0x51, 0x00, 0x5f, 0x00, 0x6b, 0x00, 0x7f, 0x00, 0x8a, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x1b, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x09, 0x00, 0x17, 0x00,
+  0x25, 0x00, 0x33, 0x00, 0x3f, 0x00, 0x4a, 0x00, 0x54, 0x00, 0x5c, 0x00,
+  0x67, 0x00, 0x7b, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1d, 0x00, 0x29, 0x00,
+  0x36, 0x00, 0x49, 0x00, 0x56, 0x00, 0x67, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x1c, 0x00, 0x26, 0x00, 0x30, 0x00, 0x3b, 0x00, 0x47, 0x00, 0x54, 0x00,
+  0x5f, 0x00, 0x6d, 0x00, 0x7b, 0x00, 0x8a, 0x00, 0x97, 0x00, 0xa2, 0x00,
+  0xae, 0x00, 0xbc, 0x00, 0xc9, 0x00, 0xd3, 0x00, 0xdf, 0x00, 0x00, 0x00,
+  0x22, 0x00, 0x36, 0x00, 0x43, 0x00, 0x4e, 0x00, 0x5b, 0x00, 0x6a, 0x00,
+  0x76, 0x00, 0x81, 0x00, 0x8c, 0x00, 0x9e, 0x00, 0xa9, 0x00, 0xb3, 0x00,
+  0x00, 0x00, 0x0b, 0x00, 0x18, 0x00, 0x2a, 0x00, 0x35, 0x00, 0x3e, 0x00,
+  0x4c, 0x00, 0x59, 0x00, 0x67, 0x00, 0x73, 0x00, 0x7b, 0x00, 0x89, 0x00,
+  0x96, 0x00, 0xa3, 0x00, 0xb0, 0x00, 0xba, 0x00, 0xc6, 0x00, 0xd3, 0x00,
+  0xe1, 0x00, 0xed, 0x00, 0xfa, 0x00, 0x09, 0x01, 0x15, 0x01, 0x24, 0x01,
+  0x30, 0x01, 0x00, 0x00, 0x0d, 0x00, 0x1c, 0x00, 0x2a, 0x00, 0x38, 0x00,
+  0x45, 0x00, 0x53, 0x00, 0x61, 0x00, 0x6f, 0x00, 0x81, 0x00, 0x8b, 0x00,
+  0x99, 0x00, 0xa6, 0x00, 0xb2, 0x00, 0xbd, 0x00, 0xcd, 0x00, 0xda, 0x00,
+  0xe9, 0x00, 0xf9, 0x00, 0x05, 0x01, 0x00, 0x00, 0x10, 0x00, 0x1e, 0x00,
+  0x2f, 0x00, 0x40, 0x00, 0x50, 0x00, 0x5e, 0x00, 0x6c, 0x00, 0x7b, 0x00,
+  0x8d, 0x00, 0x9b, 0x00, 0xaa, 0x00, 0xb9, 0x00, 0xc7, 0x00, 0xd4, 0x00,
+  0xe3, 0x00, 0xf2, 0x00, 0xfc, 0x00, 0x09, 0x01, 0x17, 0x01, 0x25, 0x01,
+  0x2f, 0x01, 0x3e, 0x01, 0x4c, 0x01, 0x59, 0x01, 0x66, 0x01, 0x75, 0x01,
+  0x83, 0x01, 0x94, 0x01, 0x9d, 0x01, 0xaa, 0x01, 0x00, 0x00, 0x10, 0x00,
+  0x1b, 0x00, 0x28, 0x00, 0x32, 0x00, 0x3d, 0x00, 0x49, 0x00, 0x5a, 0x00,
+  0x67, 0x00, 0x75, 0x00, 0x86, 0x00, 0x92, 0x00, 0x9e, 0x00, 0xaa, 0x00,
+  0xb7, 0x00, 0xc7, 0x00, 0xdd, 0x00, 0x00, 0x00, 0x10, 0x00, 0x20, 0x00,
+  0x33, 0x00, 0x44, 0x00, 0x50, 0x00, 0x61, 0x00, 0x70, 0x00, 0x81, 0x00,
+  0x95, 0x00, 0xa6, 0x00, 0xb7, 0x00, 0xc8, 0x00, 0xd7, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x27, 0x00, 0x31, 0x00, 0x44, 0x00, 0x54, 0x00, 0x62, 0x00,
+  0x6d, 0x00, 0x7a, 0x00, 0x86, 0x00, 0x97, 0x00, 0xa4, 0x00, 0xb2, 0x00,
+  0xbf, 0x00, 0xc9, 0x00, 0xd6, 0x00, 0xe5, 0x00, 0x00, 0x00, 0x1b, 0x00,
+  0x2c, 0x00, 0x3f, 0x00, 0x4b, 0x00, 0x5c, 0x00, 0x6a, 0x00, 0x75, 0x00,
+  0x80, 0x00, 0x8b, 0x00, 0x96, 0x00, 0xa8, 0x00, 0xb6, 0x00, 0xc7, 0x00,
+  0xd8, 0x00, 0x00, 0x00, 0x27, 0x00, 0x4d, 0x00, 0x73, 0x00, 0xb1, 0x00,
+  0xdb, 0x00, 0xfc, 0x00, 0x1f, 0x01, 0x2d, 0x01, 0x3c, 0x01, 0x47, 0x01,
+  0x51, 0x01, 0x5e, 0x01, 0x6f, 0x01, 0x79, 0x01, 0x84, 0x01, 0x91, 0x01,
+  0xa0, 0x01, 0xb1, 0x01, 0xbf, 0x01, 0xcd, 0x01, 0xdc, 0x01, 0xea, 0x01,
+  0xfa, 0x01, 0x05, 0x02, 0x19, 0x02, 0x00, 0x00, 0x1d, 0x00, 0x31, 0x00,
+  0x38, 0x00, 0x44, 0x00, 0x58, 0x00, 0x6c, 0x00, 0x7e, 0x00, 0x91, 0x00,
+  0xa3, 0x00, 0xaf, 0x00, 0x00, 0x00, 0x29, 0x00, 0x51, 0x00, 0x79, 0x00,
+  0xb9, 0x00, 0xe5, 0x00, 0x01, 0x01, 0x27, 0x01, 0x32, 0x01, 0x45, 0x01,
+  0x51, 0x01, 0x5b, 0x01, 0x71, 0x01, 0x7b, 0x01, 0x00, 0x00, 0x24, 0x00,
+  0x30, 0x00, 0x3f, 0x00, 0x4d, 0x00, 0x64, 0x00, 0x73, 0x00, 0x80, 0x00,
+  0x00, 0x00, 0x19, 0x00, 0x26, 0x00, 0x31, 0x00, 0x41, 0x00, 0x4f, 0x00,
+  0x5a, 0x00, 0x65, 0x00, 0x72, 0x00, 0x7f, 0x00, 0x8b, 0x00, 0x97, 0x00,
+  0x00, 0x00, 0x26, 0x00, 0x32, 0x00, 0x3c, 0x00, 0x49, 0x00, 0x55, 0x00,
+  0x65, 0x00, 0x73, 0x00, 0x7e, 0x00, 0x8a, 0x00, 0x95, 0x00, 0xa6, 0x00,
+  0xb1, 0x00, 0xbf, 0x00, 0xcc, 0x00, 0xd6, 0x00, 0x00, 0x00, 0x11, 0x00,
+  0x1f, 0x00, 0x2a, 0x00, 0x3a, 0x00, 0x45, 0x00, 0x51, 0x00, 0x5d, 0x00,
+  0x6b, 0x00, 0x76, 0x00, 0x82, 0x00, 0x93, 0x00, 0xa9, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x26, 0x00, 0x37, 0x00, 0x4f, 0x00, 0x61, 0x00, 0x70, 0x00,
+  0x7e, 0x00, 0x89, 0x00, 0x95, 0x00, 0xa3, 0x00, 0xb7, 0x00, 0xc4, 0x00,
+  0xd3, 0x00, 0xdf, 0x00, 0xec, 0x00, 0xf7, 0x00, 0x02, 0x01, 0x0d, 0x01,
+  0x18, 0x01, 0x29, 0x01, 0x35, 0x01, 0x3f, 0x01, 0x4f, 0x01, 0x58, 0x01,
+  0x00, 0x00, 0x10, 0x00, 0x1b, 0x00, 0x2c, 0x00, 0x36, 0x00, 0x46, 0x00,
+  0x51, 0x00, 0x60, 0x00, 0x6b, 0x00, 0x8a, 0x00, 0xa9, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x1d, 0x00, 0x2a, 0x00, 0x35, 0x00, 0x46, 0x00, 0x5d, 0x00,
+  0x72, 0x00, 0x83, 0x00, 0x8f, 0x00, 0x9f, 0x00, 0xaf, 0x00, 0xbb, 0x00,
+  0xca, 0x00, 0xd1, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x13, 0x00, 0x1e, 0x00,
+  0x29, 0x00, 0x34, 0x00, 0x3e, 0x00, 0x46, 0x00, 0x4f, 0x00, 0x5a, 0x00,
+  0x6c, 0x00, 0x74, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x11, 0x00, 0x21, 0x00,
+  0x30, 0x00, 0x3f, 0x00, 0x4d, 0x00, 0x59, 0x00, 0x66, 0x00, 0x74, 0x00,
+  0x81, 0x00, 0x8e, 0x00, 0x9d, 0x00, 0xaf, 0x00, 0xc1, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x20, 0x00, 0x30, 0x00, 0x3f, 0x00, 0x47, 0x00, 0x51, 0x00,
+  0x5c, 0x00, 0x67, 0x00, 0x00, 0x00, 0x10, 0x00, 0x1e, 0x00, 0x2e, 0x00,
+  0x3e, 0x00, 0x48, 0x00, 0x56, 0x00, 0x64, 0x00, 0x6b, 0x00, 0x80, 0x00,
+  0x91, 0x00, 0xa2, 0x00, 0xb4, 0x00, 0xc5, 0x00, 0xcd, 0x00, 0x00, 0x00,
+  0x22, 0x00, 0x2c, 0x00, 0x37, 0x00, 0x43, 0x00, 0x51, 0x00, 0x5d, 0x00,
+  0x6a, 0x00, 0x77, 0x00, 0x80, 0x00, 0x8c, 0x00, 0x99, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x2e, 0x00, 0x38, 0x00, 0x42, 0x00, 0x4f, 0x00, 0x00, 0x00,
+  0x43, 0x00, 0x75, 0x00, 0xa9, 0x00, 0xcf, 0x00, 0xe6, 0x00, 0x14, 0x01,
+  0x2f, 0x01, 0x4f, 0x01, 0x5d, 0x01, 0x6c, 0x01, 0x7f, 0x01, 0x8f, 0x01,
+  0x9a, 0x01, 0xa6, 0x01, 0xb1, 0x01, 0xbf, 0x01, 0xcd, 0x01, 0xdb, 0x01,
+  0xe9, 0x01, 0xf6, 0x01, 0x08, 0x02, 0x17, 0x02, 0x24, 0x02, 0x2e, 0x02,
+  0x00, 0x00, 0x2d, 0x00, 0x53, 0x00, 0x63, 0x00, 0x6e, 0x00, 0x79, 0x00,
+  0x84, 0x00, 0x8e, 0x00, 0x96, 0x00, 0xa1, 0x00, 0xad, 0x00, 0x00, 0x00,
+  0x45, 0x00, 0x79, 0x00, 0xaf, 0x00, 0xd7, 0x00, 0xf0, 0x00, 0x20, 0x01,
+  0x3d, 0x01, 0x64, 0x01, 0x70, 0x01, 0x7c, 0x01, 0x8d, 0x01, 0x9c, 0x01,
+  0xaa, 0x01, 0xb6, 0x01, 0xc7, 0x01, 0xd4, 0x01, 0xdf, 0x01, 0xea, 0x01,
+  0xf7, 0x01, 0x04, 0x02, 0x00, 0x00, 0x25, 0x00, 0x45, 0x00, 0x63, 0x00,
+  0x6c, 0x00, 0x78, 0x00, 0x87, 0x00, 0x96, 0x00, 0xa4, 0x00, 0xb1, 0x00,
+  0xbd, 0x00, 0xca, 0x00, 0xd5, 0x00, 0xe0, 0x00, 0xee, 0x00, 0xf7, 0x00,
+  0x00, 0x00, 0x20, 0x00, 0x2e, 0x00, 0x3b, 0x00, 0x4c, 0x00, 0x5e, 0x00,
+  0x6b, 0x00, 0x7a, 0x00, 0x8f, 0x00, 0x9f, 0x00, 0xab, 0x00, 0x00, 0x00,
+  0x27, 0x00, 0x49, 0x00, 0x6b, 0x00, 0x76, 0x00, 0x83, 0x00, 0x8e, 0x00,
+  0x9b, 0x00, 0xaa, 0x00, 0xb6, 0x00, 0xc1, 0x00, 0xcf, 0x00, 0xdb, 0x00,
+  0x00, 0x00, 0x50, 0x00, 0x74, 0x00, 0x88, 0x00, 0x97, 0x00, 0xa2, 0x00,
+  0xbe, 0x00, 0xc9, 0x00, 0xd9, 0x00, 0xe8, 0x00, 0xf8, 0x00, 0x00, 0x00,
+  0x3c, 0x00, 0x4f, 0x00, 0x5c, 0x00, 0x66, 0x00, 0x74, 0x00, 0x80, 0x00,
+  0x8c, 0x00, 0x99, 0x00, 0xa6, 0x00, 0xb1, 0x00, 0xbe, 0x00, 0xca, 0x00,
+  0xe4, 0x00, 0xf1, 0x00, 0xff, 0x00, 0x09, 0x01, 0x16, 0x01, 0x25, 0x01,
+  0x30, 0x01, 0x45, 0x01, 0x51, 0x01, 0x00, 0x00, 0x26, 0x00, 0x48, 0x00,
+  0x57, 0x00, 0x62, 0x00, 0x6d, 0x00, 0x7c, 0x00, 0x89, 0x00, 0x94, 0x00,
+  0x9f, 0x00, 0xaa, 0x00, 0xba, 0x00, 0xc7, 0x00, 0xd4, 0x00, 0xdf, 0x00,
+  0xed, 0x00, 0xf8, 0x00, 0x06, 0x01, 0x11, 0x01, 0x1c, 0x01, 0x2c, 0x01,
+  0x3c, 0x01, 0x00, 0x00, 0x26, 0x00, 0x33, 0x00, 0x40, 0x00, 0x4b, 0x00,
+  0x5a, 0x00, 0x69, 0x00, 0x79, 0x00, 0x86, 0x00, 0x93, 0x00, 0xa2, 0x00,
+  0xad, 0x00, 0xbd, 0x00, 0xca, 0x00, 0xd6, 0x00, 0xe6, 0x00, 0xf3, 0x00,
+  0x05, 0x01, 0x14, 0x01, 0x20, 0x01, 0x2c, 0x01, 0x38, 0x01, 0x00, 0x00,
+  0x24, 0x00, 0x40, 0x00, 0x4e, 0x00, 0x5b, 0x00, 0x6d, 0x00, 0x77, 0x00,
+  0x84, 0x00, 0x94, 0x00, 0xa1, 0x00, 0xae, 0x00, 0xbc, 0x00, 0xc9, 0x00,
+  0xd8, 0x00, 0xe5, 0x00, 0xf2, 0x00, 0x01, 0x01, 0x0e, 0x01, 0x1e, 0x01,
+  0x28, 0x01, 0x38, 0x01, 0x46, 0x01, 0x53, 0x01, 0x5f, 0x01, 0x6d, 0x01,
+  0x78, 0x01, 0x86, 0x01, 0x00, 0x00, 0x1e, 0x00, 0x47, 0x00, 0x55, 0x00,
+  0x66, 0x00, 0x75, 0x00, 0x7f, 0x00, 0x89, 0x00, 0x96, 0x00, 0xa5, 0x00,
+  0xb1, 0x00, 0xbe, 0x00, 0xcb, 0x00, 0xdc, 0x00, 0xec, 0x00, 0xff, 0x00,
+  0x14, 0x01, 0x25, 0x01, 0x32, 0x01, 0x3e, 0x01, 0x4d, 0x01, 0x5e, 0x01,
+  0x6e, 0x01, 0x7a, 0x01, 0x8e, 0x01, 0x00, 0x00, 0x2f, 0x00, 0x3c, 0x00,
+  0x48, 0x00, 0x56, 0x00, 0x68, 0x00, 0x70, 0x00, 0x80, 0x00, 0x91, 0x00,
+  0x9e, 0x00, 0xaf, 0x00, 0xbc, 0x00, 0xc9, 0x00, 0xd4, 0x00, 0xe6, 0x00,
+  0x00, 0x01, 0x12, 0x01, 0x00, 0x00, 0x26, 0x00, 0x34, 0x00, 0x45, 0x00,
+  0x55, 0x00, 0x64, 0x00, 0x72, 0x00, 0x84, 0x00, 0x95, 0x00, 0xa7, 0x00,
+  0xb4, 0x00, 0xc5, 0x00, 0xd6, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x48, 0x00,
+  0x55, 0x00, 0x5d, 0x00, 0x6e, 0x00, 0x7c, 0x00, 0x8b, 0x00, 0x97, 0x00,
+  0x00, 0x00, 0x22, 0x00, 0x4f, 0x00, 0x61, 0x00, 0x76, 0x00, 0x8a, 0x00,
+  0x9a, 0x00, 0xa5, 0x00, 0xb8, 0x00, 0xc6, 0x00, 0xd1, 0x00, 0xdb, 0x00,
+  0xe6, 0x00, 0xf8, 0x00, 0x09, 0x01, 0x1a, 0x01, 0x2c, 0x01, 0x39, 0x01,
+  0x49, 0x01, 0x54, 0x01, 0x00, 0x00, 0x29, 0x00, 0x56, 0x00, 0x7c, 0x00,
+  0xa9, 0x00, 0xbb, 0x00, 0xcb, 0x00, 0xd6, 0x00, 0xe2, 0x00, 0xf1, 0x00,
+  0xfe, 0x00, 0x08, 0x01, 0x17, 0x01, 0x26, 0x01, 0x36, 0x01, 0x42, 0x01,
+  0x57, 0x01, 0x00, 0x00, 0x28, 0x00, 0x32, 0x00, 0x44, 0x00, 0x4f, 0x00,
+  0x57, 0x00, 0x6a, 0x00, 0x78, 0x00, 0x85, 0x00, 0x92, 0x00, 0x9e, 0x00,
+  0xaa, 0x00, 0xb2, 0x00, 0xc5, 0x00, 0xd3, 0x00, 0xde, 0x00, 0xee, 0x00,
+  0xfa, 0x00, 0x06, 0x01, 0x1a, 0x01, 0x00, 0x00, 0x2b, 0x00, 0x5a, 0x00,
+  0x82, 0x00, 0xbd, 0x00, 0xdf, 0x00, 0x06, 0x01, 0x1c, 0x01, 0x2d, 0x01,
+  0x44, 0x01, 0x00, 0x00, 0x1c, 0x00, 0x40, 0x00, 0x55, 0x00, 0x61, 0x00,
+  0x6c, 0x00, 0x82, 0x00, 0x93, 0x00, 0x9d, 0x00, 0xa8, 0x00, 0xb2, 0x00,
+  0xbd, 0x00, 0xc7, 0x00, 0xd2, 0x00, 0xdc, 0x00, 0xeb, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x45, 0x00, 0x71, 0x00, 0x7c, 0x00, 0x86, 0x00, 0x98, 0x00,
+  0xa3, 0x00, 0xad, 0x00, 0xb9, 0x00, 0xc3, 0x00, 0xce, 0x00, 0xdb, 0x00,
+  0xeb, 0x00, 0xf9, 0x00, 0x10, 0x01, 0x28, 0x01, 0x00, 0x00, 0x3e, 0x00,
+  0x67, 0x00, 0x7c, 0x00, 0x8e, 0x00, 0xa0, 0x00, 0xae, 0x00, 0xbc, 0x00,
+  0xca, 0x00, 0xd8, 0x00, 0xeb, 0x00, 0xff, 0x00, 0x0d, 0x01, 0x18, 0x01,
+  0x00, 0x00, 0x0f, 0x00, 0x1d, 0x00, 0x2a, 0x00, 0x38, 0x00, 0x4d, 0x00,
+  0x5a, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1d, 0x00, 0x29, 0x00, 0x3b, 0x00,
+  0x49, 0x00, 0x59, 0x00, 0x63, 0x00, 0x6e, 0x00, 0x7e, 0x00, 0x8e, 0x00,
+  0x9b, 0x00, 0xac, 0x00, 0xb8, 0x00, 0xc7, 0x00, 0x00, 0x00, 0x2e, 0x00,
+  0x60, 0x00, 0x7c, 0x00, 0x9c, 0x00, 0xbc, 0x00, 0xce, 0x00, 0xe1, 0x00,
+  0x00, 0x00, 0x20, 0x00, 0x30, 0x00, 0x3c, 0x00, 0x4e, 0x00, 0x5b, 0x00,
+  0x68, 0x00, 0x76, 0x00, 0x84, 0x00, 0x91, 0x00, 0xa1, 0x00, 0xad, 0x00,
+  0xbf, 0x00, 0xcb, 0x00, 0xd8, 0x00, 0xe8, 0x00, 0x00, 0x00, 0x13, 0x00,
+  0x20, 0x00, 0x29, 0x00, 0x36, 0x00, 0x4e, 0x00, 0x5a, 0x00, 0x66, 0x00,
+  0x77, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1b, 0x00, 0x2d, 0x00, 0x3d, 0x00,
+  0x4c, 0x00, 0x5a, 0x00, 0x6a, 0x00, 0x77, 0x00, 0x86, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x17, 0x00, 0x25, 0x00, 0x36, 0x00, 0x43, 0x00, 0x56, 0x00,
+  0x65, 0x00, 0x71, 0x00, 0x79, 0x00, 0x85, 0x00, 0x93, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x1c, 0x00, 0x2d, 0x00, 0x3b, 0x00, 0x4d, 0x00, 0x5c, 0x00,
+  0x68, 0x00, 0x70, 0x00, 0x78, 0x00, 0x00, 0x00, 0x22, 0x00, 0x40, 0x00,
+  0x4e, 0x00, 0x5c, 0x00, 0x69, 0x00, 0x77, 0x00, 0x82, 0x00, 0x90, 0x00,
+  0x9e, 0x00, 0xac, 0x00, 0x00, 0x00, 0x27, 0x00, 0x3c, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x3e, 0x00, 0x69, 0x00, 0x76, 0x00, 0x84, 0x00, 0x91, 0x00,
+  0xa3, 0x00, 0xac, 0x00, 0xbc, 0x00, 0xcc, 0x00, 0xd4, 0x00, 0xe0, 0x00,
+  0xee, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x26, 0x00, 0x4c, 0x00, 0x72, 0x00,
+  0x7d, 0x00, 0x89, 0x00, 0x96, 0x00, 0xa4, 0x00, 0xba, 0x00, 0xc5, 0x00,
+  0xd7, 0x00, 0xe4, 0x00, 0xee, 0x00, 0x00, 0x00, 0x20, 0x00, 0x4b, 0x00,
+  0x6b, 0x00, 0x79, 0x00, 0x85, 0x00, 0x93, 0x00, 0xa1, 0x00, 0xaf, 0x00,
+  0xbe, 0x00, 0xcc, 0x00, 0xd7, 0x00, 0xed, 0x00, 0xfb, 0x00, 0x09, 0x01,
+  0x17, 0x01, 0x28, 0x01, 0x00, 0x00, 0x36, 0x00, 0x6e, 0x00, 0x92, 0x00,
+  0x9d, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x39, 0x00, 0x47, 0x00, 0x58, 0x00,
+  0x6b, 0x00, 0x75, 0x00, 0x80, 0x00, 0x8f, 0x00, 0x9b, 0x00, 0xad, 0x00,
+  0xbe, 0x00, 0xcf, 0x00, 0x00, 0x00, 0x22, 0x00, 0x4c, 0x00, 0x6c, 0x00,
+  0x77, 0x00, 0x84, 0x00, 0x93, 0x00, 0xa2, 0x00, 0xb1, 0x00, 0xbb, 0x00,
+  0xca, 0x00, 0x00, 0x00, 0x20, 0x00, 0x42, 0x00, 0x50, 0x00, 0x5c, 0x00,
+  0x68, 0x00, 0x7b, 0x00, 0x8f, 0x00, 0x9a, 0x00, 0xa8, 0x00, 0xb9, 0x00,
+  0xcb, 0x00, 0xda, 0x00, 0x00, 0x00, 0x29, 0x00, 0x36, 0x00, 0x41, 0x00,
+  0x4f, 0x00, 0x5c, 0x00, 0x68, 0x00, 0x75, 0x00, 0x83, 0x00, 0x8f, 0x00,
+  0x9b, 0x00, 0xa5, 0x00, 0xb3, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x12, 0x00,
+  0x1e, 0x00, 0x26, 0x00, 0x33, 0x00, 0x48, 0x00, 0x00, 0x00, 0x20, 0x00,
+  0x44, 0x00, 0x66, 0x00, 0x8f, 0x00, 0x9f, 0x00, 0xae, 0x00, 0xbc, 0x00,
+  0xc8, 0x00, 0xd4, 0x00, 0xe1, 0x00, 0xee, 0x00, 0xf7, 0x00, 0x04, 0x01,
+  0x0f, 0x01, 0x1a, 0x01, 0x27, 0x01, 0x32, 0x01, 0x3f, 0x01, 0x4a, 0x01,
+  0x59, 0x01, 0x65, 0x01, 0x00, 0x00, 0x20, 0x00, 0x44, 0x00, 0x68, 0x00,
+  0x8f, 0x00, 0x9e, 0x00, 0xad, 0x00, 0xb8, 0x00, 0xc4, 0x00, 0xd1, 0x00,
+  0xde, 0x00, 0xea, 0x00, 0x00, 0x00, 0x29, 0x00, 0x4f, 0x00, 0x5c, 0x00,
+  0x6d, 0x00, 0x78, 0x00, 0x86, 0x00, 0x93, 0x00, 0xa4, 0x00, 0xb2, 0x00,
+  0xc3, 0x00, 0xd0, 0x00, 0xdc, 0x00, 0xe9, 0x00, 0xf8, 0x00, 0x07, 0x01,
+  0x17, 0x01, 0x23, 0x01, 0x32, 0x01, 0x3d, 0x01, 0x4b, 0x01, 0x5b, 0x01,
+  0x6a, 0x01, 0x75, 0x01, 0x85, 0x01, 0x92, 0x01, 0xa3, 0x01, 0xb0, 0x01,
+  0xbf, 0x01, 0x00, 0x00, 0x28, 0x00, 0x51, 0x00, 0x73, 0x00, 0x82, 0x00,
+  0x8f, 0x00, 0x9a, 0x00, 0xa5, 0x00, 0xb0, 0x00, 0xbf, 0x00, 0xcc, 0x00,
+  0xdb, 0x00, 0xe7, 0x00, 0xf7, 0x00, 0x02, 0x01, 0x10, 0x01, 0x1d, 0x01,
+  0x29, 0x01, 0x35, 0x01, 0x41, 0x01, 0x4e, 0x01, 0x5b, 0x01, 0x67, 0x01,
+  0x73, 0x01, 0x7f, 0x01, 0x00, 0x00, 0x1e, 0x00, 0x3e, 0x00, 0x6f, 0x00,
+  0x7a, 0x00, 0x86, 0x00, 0x96, 0x00, 0xa7, 0x00, 0xb1, 0x00, 0xbb, 0x00,
+  0xc8, 0x00, 0xd5, 0x00, 0xe5, 0x00, 0xf1, 0x00, 0xfd, 0x00, 0x0c, 0x01,
+  0x1a, 0x01, 0x00, 0x00, 0x24, 0x00, 0x46, 0x00, 0x6e, 0x00, 0x7d, 0x00,
+  0x8a, 0x00, 0x98, 0x00, 0xa6, 0x00, 0xb4, 0x00, 0xc4, 0x00, 0xd5, 0x00,
+  0xe1, 0x00, 0xef, 0x00, 0xfc, 0x00, 0x0b, 0x01, 0x16, 0x01, 0x2e, 0x01,
+  0x3a, 0x01, 0x44, 0x01, 0x4e, 0x01, 0x59, 0x01, 0x64, 0x01, 0x72, 0x01,
+  0x7f, 0x01, 0x89, 0x01, 0x95, 0x01, 0xa1, 0x01, 0xb0, 0x01, 0xbe, 0x01,
+  0xca, 0x01, 0xd8, 0x01, 0xec, 0x01, 0xfb, 0x01, 0x07, 0x02, 0x14, 0x02,
+  0x21, 0x02, 0x32, 0x02, 0x3d, 0x02, 0x46, 0x02, 0x00, 0x00, 0x23, 0x00,
+  0x45, 0x00, 0x55, 0x00, 0x66, 0x00, 0x76, 0x00, 0x89, 0x00, 0x95, 0x00,
+  0xa5, 0x00, 0xb1, 0x00, 0xc3, 0x00, 0xd1, 0x00, 0xe1, 0x00, 0xef, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x24, 0x00, 0x4e, 0x00, 0x74, 0x00, 0x82, 0x00,
+  0x91, 0x00, 0x9b, 0x00, 0xa9, 0x00, 0xb8, 0x00, 0xc2, 0x00, 0xd2, 0x00,
+  0xe1, 0x00, 0xf2, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x4e, 0x00, 0x61, 0x00,
+  0x74, 0x00, 0x85, 0x00, 0x93, 0x00, 0xa0, 0x00, 0xb4, 0x00, 0xc8, 0x00,
+  0xd7, 0x00, 0xe9, 0x00, 0xfe, 0x00, 0x0e, 0x01, 0x21, 0x01, 0x00, 0x00,
+  0x1e, 0x00, 0x4f, 0x00, 0x5c, 0x00, 0x6c, 0x00, 0x7d, 0x00, 0x8d, 0x00,
+  0x9e, 0x00, 0x00, 0x00, 0x20, 0x00, 0x2c, 0x00, 0x37, 0x00, 0x4c, 0x00,
+  0x62, 0x00, 0x6e, 0x00, 0x81, 0x00, 0x98, 0x00, 0xa3, 0x00, 0xb8, 0x00,
+  0xc3, 0x00, 0xce, 0x00, 0xd9, 0x00, 0xe4, 0x00, 0xf0, 0x00, 0x00, 0x00,
+  0x1e, 0x00, 0x42, 0x00, 0x60, 0x00, 0x7e, 0x00, 0x8c, 0x00, 0x9b, 0x00,
+  0xac, 0x00, 0xc0, 0x00, 0xce, 0x00, 0xd9, 0x00, 0xe6, 0x00, 0xf0, 0x00,
+  0x02, 0x01, 0x0e, 0x01, 0x20, 0x01, 0x33, 0x01, 0x45, 0x01, 0x57, 0x01,
+  0x00, 0x00, 0x30, 0x00, 0x61, 0x00, 0x6c, 0x00, 0x84, 0x00, 0x91, 0x00,
+  0x9a, 0x00, 0xa7, 0x00, 0xb5, 0x00, 0xcc, 0x00, 0xd7, 0x00, 0xea, 0x00,
+  0x00, 0x00, 0x24, 0x00, 0x2e, 0x00, 0x39, 0x00, 0x47, 0x00, 0x00, 0x00,
+  0x22, 0x00, 0x2d, 0x00, 0x39, 0x00, 0x44, 0x00, 0x53, 0x00, 0x66, 0x00,
+  0x71, 0x00, 0x7f, 0x00, 0x8b, 0x00, 0x96, 0x00, 0xa1, 0x00, 0xb6, 0x00,
+  0xc7, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x5e, 0x00, 0x82, 0x00, 0xb3, 0x00,
+  0xc2, 0x00, 0xd1, 0x00, 0xe2, 0x00, 0xf1, 0x00, 0x00, 0x00, 0x2d, 0x00,
+  0x3d, 0x00, 0x4f, 0x00, 0x5a, 0x00, 0x67, 0x00, 0x73, 0x00, 0x7e, 0x00,
+  0x8c, 0x00, 0x99, 0x00, 0xa4, 0x00, 0xbf, 0x00, 0xce, 0x00, 0xdb, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x18, 0x00, 0x20, 0x00, 0x28, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x1e, 0x00, 0x30, 0x00, 0x3f, 0x00, 0x4e, 0x00, 0x5b, 0x00,
+  0x6a, 0x00, 0x77, 0x00, 0x85, 0x00, 0x94, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x1d, 0x00, 0x2a, 0x00, 0x38, 0x00, 0x49, 0x00, 0x5a, 0x00, 0x66, 0x00,
+  0x76, 0x00, 0x80, 0x00, 0x90, 0x00, 0xa1, 0x00, 0x00, 0x00, 0x2e, 0x00,
+  0x3d, 0x00, 0x49, 0x00, 0x58, 0x00, 0x64, 0x00, 0x83, 0x00, 0xa2, 0x00,
+  0xb0, 0x00, 0xbf, 0x00, 0xd2, 0x00, 0xf2, 0x00, 0x00, 0x00, 0x1d, 0x00,
+  0x43, 0x00, 0x65, 0x00, 0x7e, 0x00, 0x89, 0x00, 0x9a, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x1b, 0x00, 0x2d, 0x00, 0x40, 0x00, 0x54, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x16, 0x00, 0x20, 0x00, 0x2e, 0x00, 0x3c, 0x00, 0x46, 0x00,
+  0x50, 0x00, 0x5a, 0x00, 0x68, 0x00, 0x72, 0x00, 0x81, 0x00, 0x00, 0x00,
+  0x26, 0x00, 0x35, 0x00, 0x40, 0x00, 0x4a, 0x00, 0x00, 0x00, 0x24, 0x00,
+  0x30, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1f, 0x00, 0x30, 0x00,
+  0x3e, 0x00, 0x49, 0x00, 0x5a, 0x00, 0x67, 0x00, 0x00, 0x00, 0x20, 0x00,
+  0x40, 0x00, 0x4b, 0x00, 0x59, 0x00, 0x68, 0x00, 0x77, 0x00, 0x82, 0x00,
+  0x92, 0x00, 0xa1, 0x00, 0xb1, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x1c, 0x00,
+  0x28, 0x00, 0x3b, 0x00, 0x45, 0x00, 0x50, 0x00, 0x5b, 0x00, 0x65, 0x00,
+  0x71, 0x00, 0x7c, 0x00, 0x8d, 0x00, 0x97, 0x00, 0xa2, 0x00, 0xac, 0x00,
+  0xb7, 0x00, 0xc5, 0x00, 0xd4, 0x00, 0xe2, 0x00, 0xeb, 0x00, 0x00, 0x00,
+  0x22, 0x00, 0x40, 0x00, 0x4b, 0x00, 0x5c, 0x00, 0x66, 0x00, 0x70, 0x00,
+  0x7a, 0x00, 0x88, 0x00, 0x92, 0x00, 0x9c, 0x00, 0xa7, 0x00, 0xb7, 0x00,
+  0x00, 0x00, 0x1e, 0x00, 0x29, 0x00, 0x38, 0x00, 0x42, 0x00, 0x4f, 0x00,
+  0x5a, 0x00, 0x69, 0x00, 0x75, 0x00, 0x81, 0x00, 0x8c, 0x00, 0x97, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x17, 0x00, 0x26, 0x00, 0x35, 0x00, 0x41, 0x00,
+  0x4f, 0x00, 0x5d, 0x00, 0x67, 0x00, 0x73, 0x00, 0x7d, 0x00, 0x8a, 0x00,
+  0x97, 0x00, 0xa4, 0x00, 0xaf, 0x00, 0x00, 0x00, 0x22, 0x00, 0x31, 0x00,
+  0x41, 0x00, 0x4e, 0x00, 0x5c, 0x00, 0x6a, 0x00, 0x7b, 0x00, 0x8a, 0x00,
+  0x95, 0x00, 0xa3, 0x00, 0xae, 0x00, 0xbd, 0x00, 0xc8, 0x00, 0xd3, 0x00,
+  0xdf, 0x00, 0xeb, 0x00, 0x00, 0x00, 0x10, 0x00, 0x1f, 0x00, 0x2c, 0x00,
+  0x3b, 0x00, 0x49, 0x00, 0x57, 0x00, 0x64, 0x00, 0x71, 0x00, 0x8a, 0x00,
+  0x00, 0x00, 0x1e, 0x00, 0x27, 0x00, 0x30, 0x00, 0x40, 0x00, 0x49, 0x00,
+  0x54, 0x00, 0x64, 0x00, 0x72, 0x00, 0x82, 0x00, 0x91, 0x00, 0xa0, 0x00,
+  0xb1, 0x00, 0xc2, 0x00, 0xce, 0x00, 0xd7, 0x00, 0xe8, 0x00, 0xf4, 0x00,
+  0x00, 0x01, 0x0e, 0x01, 0x1c, 0x01, 0x26, 0x01, 0x33, 0x01, 0x41, 0x01,
+  0x00, 0x00, 0x22, 0x00, 0x33, 0x00, 0x3e, 0x00, 0x49, 0x00, 0x60, 0x00,
+  0x6d, 0x00, 0x7c, 0x00, 0x89, 0x00, 0x9a, 0x00, 0xa6, 0x00, 0xb5, 0x00,
+  0xc4, 0x00, 0xcf, 0x00, 0xda, 0x00, 0xe6, 0x00, 0xf5, 0x00, 0x00, 0x01,
+  0x13, 0x01, 0x21, 0x01, 0x2b, 0x01, 0x36, 0x01, 0x43, 0x01, 0x00, 0x00,
+  0x12, 0x00, 0x1f, 0x00, 0x2e, 0x00, 0x3f, 0x00, 0x50, 0x00, 0x62, 0x00,
+  0x73, 0x00, 0x84, 0x00, 0x94, 0x00, 0xa0, 0x00, 0xab, 0x00, 0xb7, 0x00,
+  0xc4, 0x00, 0xd2, 0x00, 0xe2, 0x00, 0xf2, 0x00, 0x02, 0x01, 0x12, 0x01,
+  0x20, 0x01, 0x2c, 0x01, 0x3e, 0x01, 0x00, 0x00, 0x0e, 0x00, 0x24, 0x00,
+  0x31, 0x00, 0x3e, 0x00, 0x4b, 0x00, 0x58, 0x00, 0x65, 0x00, 0x77, 0x00,
+  0x85, 0x00, 0x94, 0x00, 0xa3, 0x00, 0xae, 0x00, 0xbb, 0x00, 0xcc, 0x00,
+  0xd8, 0x00, 0xe3, 0x00, 0xef, 0x00, 0xfb, 0x00, 0x08, 0x01, 0x14, 0x01,
+  0x20, 0x01, 0x2d, 0x01, 0x38, 0x01, 0x44, 0x01, 0x51, 0x01, 0x60, 0x01,
+  0x6d, 0x01, 0x7a, 0x01, 0x8a, 0x01, 0x97, 0x01, 0xa5, 0x01, 0xb3, 0x01,
+  0xc1, 0x01, 0xcc, 0x01, 0xd9, 0x01, 0xe8, 0x01, 0xf5, 0x01, 0x05, 0x02,
+  0x14, 0x02, 0x23, 0x02, 0x00, 0x00, 0x10, 0x00, 0x22, 0x00, 0x2d, 0x00,
+  0x41, 0x00, 0x52, 0x00, 0x60, 0x00, 0x6e, 0x00, 0x80, 0x00, 0x8b, 0x00,
+  0x9e, 0x00, 0xaa, 0x00, 0xb7, 0x00, 0xc9, 0x00, 0xd8, 0x00, 0xe9, 0x00,
+  0xfc, 0x00, 0x0b, 0x01, 0x18, 0x01, 0x2b, 0x01, 0x3c, 0x01, 0x4b, 0x01,
+  0x58, 0x01, 0x69, 0x01, 0x7c, 0x01, 0x00, 0x00, 0x0e, 0x00, 0x1f, 0x00,
+  0x2a, 0x00, 0x35, 0x00, 0x41, 0x00, 0x50, 0x00, 0x5f, 0x00, 0x6d, 0x00,
+  0x80, 0x00, 0x8c, 0x00, 0x9a, 0x00, 0xaf, 0x00, 0x00, 0x00, 0x0b, 0x00,
+  0x1b, 0x00, 0x2c, 0x00, 0x39, 0x00, 0x44, 0x00, 0x57, 0x00, 0x66, 0x00,
+  0x75, 0x00, 0x85, 0x00, 0x94, 0x00, 0xa4, 0x00, 0xb3, 0x00, 0xbd, 0x00,
+  0xc8, 0x00, 0xdb, 0x00, 0xea, 0x00, 0xf9, 0x00, 0x0b, 0x01, 0x1e, 0x01,
+  0x00, 0x00, 0x08, 0x00, 0x18, 0x00, 0x28, 0x00, 0x36, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x20, 0x00, 0x30, 0x00, 0x47, 0x00, 0x55, 0x00, 0x60, 0x00,
+  0x6e, 0x00, 0x7a, 0x00, 0x89, 0x00, 0x94, 0x00, 0x9f, 0x00, 0xb1, 0x00,
+  0xc1, 0x00, 0xd6, 0x00, 0xe1, 0x00, 0xf0, 0x00, 0x02, 0x01, 0x15, 0x01,
+  0x2a, 0x01, 0x00, 0x00, 0x12, 0x00, 0x23, 0x00, 0x32, 0x00, 0x46, 0x00,
+  0x52, 0x00, 0x5c, 0x00, 0x6e, 0x00, 0x7d, 0x00, 0x8f, 0x00, 0xa1, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x2f, 0x00, 0x40, 0x00, 0x48, 0x00, 0x53, 0x00,
+  0x5e, 0x00, 0x71, 0x00, 0x7a, 0x00, 0x87, 0x00, 0x95, 0x00, 0x9f, 0x00,
+  0xad, 0x00, 0xbf, 0x00, 0xd3, 0x00, 0xe2, 0x00, 0xf1, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x16, 0x00, 0x2c, 0x00, 0x40, 0x00, 0x55, 0x00, 0x61, 0x00,
+  0x76, 0x00, 0x8c, 0x00, 0x00, 0x00, 0x13, 0x00, 0x21, 0x00, 0x33, 0x00,
+  0x47, 0x00, 0x52, 0x00, 0x62, 0x00, 0x6d, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x18, 0x00, 0x28, 0x00, 0x39, 0x00, 0x47, 0x00, 0x53, 0x00, 0x62, 0x00,
+  0x75, 0x00, 0x00, 0x00, 0x11, 0x00, 0x19, 0x00, 0x2c, 0x00, 0x39, 0x00,
+  0x4b, 0x00, 0x5e, 0x00, 0x69, 0x00, 0x73, 0x00, 0x7d, 0x00, 0x89, 0x00,
+  0x9e, 0x00, 0xad, 0x00, 0xb8, 0x00, 0xc5, 0x00, 0xdb, 0x00, 0xeb, 0x00,
+  0xfc, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x18, 0x00, 0x2a, 0x00, 0x38, 0x00,
+  0x45, 0x00, 0x56, 0x00, 0x63, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x1e, 0x00,
+  0x2b, 0x00, 0x39, 0x00, 0x4b, 0x00, 0x56, 0x00, 0x65, 0x00, 0x71, 0x00,
+  0x7c, 0x00, 0x8a, 0x00, 0x98, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1a, 0x00,
+  0x29, 0x00, 0x3a, 0x00, 0x45, 0x00, 0x52, 0x00, 0x62, 0x00, 0x72, 0x00,
+  0x83, 0x00, 0x94, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1a, 0x00, 0x29, 0x00,
+  0x33, 0x00, 0x48, 0x00, 0x00, 0x00, 0x11, 0x00, 0x21, 0x00, 0x2f, 0x00,
+  0x3d, 0x00, 0x48, 0x00, 0x58, 0x00, 0x65, 0x00, 0x71, 0x00, 0x7c, 0x00,
+  0x8a, 0x00, 0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1c, 0x00,
+  0x29, 0x00, 0x38, 0x00, 0x45, 0x00, 0x55, 0x00, 0x65, 0x00, 0x75, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x17, 0x00, 0x25, 0x00, 0x32, 0x00, 0x42, 0x00,
+  0x4f, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1a, 0x00, 0x3a, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x21, 0x00, 0x2f, 0x00, 0x3d, 0x00, 0x4b, 0x00, 0x5e, 0x00,
+  0x6f, 0x00, 0x83, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1c, 0x00, 0x2d, 0x00,
+  0x39, 0x00, 0x4a, 0x00, 0x5a, 0x00, 0x6a, 0x00, 0x00, 0x00, 0x08, 0x00,
+  0x13, 0x00, 0x1d, 0x00, 0x28, 0x00, 0x32, 0x00, 0x44, 0x00, 0x56, 0x00,
+  0x66, 0x00, 0x73, 0x00, 0x7e, 0x00, 0x8c, 0x00, 0x97, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x15, 0x00, 0x27, 0x00, 0x33, 0x00, 0x3d, 0x00, 0x48, 0x00,
+  0x54, 0x00, 0x62, 0x00, 0x6c, 0x00, 0x79, 0x00, 0x85, 0x00, 0x94, 0x00,
+  0xa2, 0x00, 0xb4, 0x00, 0x00, 0x00, 0x25, 0x00, 0x30, 0x00, 0x3b, 0x00,
+  0x46, 0x00, 0x54, 0x00, 0x5f, 0x00, 0x6a, 0x00, 0x75, 0x00, 0x82, 0x00,
+  0x8e, 0x00, 0x99, 0x00, 0xa5, 0x00, 0xb0, 0x00, 0xbb, 0x00, 0xc6, 0x00,
+  0xd1, 0x00, 0xdd, 0x00, 0xe7, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x27, 0x00,
+  0x32, 0x00, 0x3c, 0x00, 0x49, 0x00, 0x57, 0x00, 0x69, 0x00, 0x74, 0x00,
+  0x87, 0x00, 0x92, 0x00, 0x9f, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x15, 0x00,
+  0x1f, 0x00, 0x2a, 0x00, 0x34, 0x00, 0x40, 0x00, 0x4b, 0x00, 0x55, 0x00,
+  0x61, 0x00, 0x6e, 0x00, 0x7e, 0x00, 0x8a, 0x00, 0x97, 0x00, 0xa0, 0x00,
+  0xac, 0x00, 0xb9, 0x00, 0xc5, 0x00, 0xd1, 0x00, 0xdc, 0x00, 0x00, 0x00,
+  0x1d, 0x00, 0x31, 0x00, 0x40, 0x00, 0x4e, 0x00, 0x5b, 0x00, 0x65, 0x00,
+  0x73, 0x00, 0x80, 0x00, 0x8c, 0x00, 0x9b, 0x00, 0xad, 0x00, 0xba, 0x00,
+  0xc5, 0x00, 0xd9, 0x00, 0xe5, 0x00, 0xf2, 0x00, 0xfe, 0x00, 0x0d, 0x01,
+  0x1c, 0x01, 0x2e, 0x01, 0x38, 0x01, 0x45, 0x01, 0x53, 0x01, 0x63, 0x01,
+  0x71, 0x01, 0x82, 0x01, 0x93, 0x01, 0xa2, 0x01, 0xb1, 0x01, 0xc0, 0x01,
+  0xcc, 0x01, 0x00, 0x00, 0x0e, 0x00, 0x1a, 0x00, 0x28, 0x00, 0x3d, 0x00,
+  0x4b, 0x00, 0x5c, 0x00, 0x67, 0x00, 0x78, 0x00, 0x86, 0x00, 0x99, 0x00,
+  0xa5, 0x00, 0xb4, 0x00, 0xc0, 0x00, 0xcd, 0x00, 0xd8, 0x00, 0xe7, 0x00,
+  0xf5, 0x00, 0x06, 0x01, 0x18, 0x01, 0x00, 0x00, 0x0d, 0x00, 0x17, 0x00,
+  0x21, 0x00, 0x2b, 0x00, 0x3a, 0x00, 0x47, 0x00, 0x50, 0x00, 0x5d, 0x00,
+  0x6d, 0x00, 0x79, 0x00, 0x83, 0x00, 0x94, 0x00, 0x9e, 0x00, 0xb7, 0x00,
+  0xc4, 0x00, 0xd0, 0x00, 0xdd, 0x00, 0xe7, 0x00, 0x00, 0x00, 0x0b, 0x00,
+  0x16, 0x00, 0x26, 0x00, 0x37, 0x00, 0x46, 0x00, 0x57, 0x00, 0x63, 0x00,
+  0x6c, 0x00, 0x7b, 0x00, 0x8d, 0x00, 0x9b, 0x00, 0xab, 0x00, 0xb9, 0x00,
+  0xc5, 0x00, 0xd8, 0x00, 0xe6, 0x00, 0xf7, 0x00, 0x08, 0x01, 0x16, 0x01,
+  0x00, 0x00, 0x0d, 0x00, 0x18, 0x00, 0x25, 0x00, 0x32, 0x00, 0x40, 0x00,
+  0x52, 0x00, 0x60, 0x00, 0x72, 0x00, 0x81, 0x00, 0x91, 0x00, 0x9e, 0x00,
+  0xab, 0x00, 0xb7, 0x00, 0xc4, 0x00, 0xd2, 0x00, 0xe3, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x20, 0x00, 0x31, 0x00, 0x3e, 0x00, 0x4f, 0x00, 0x61, 0x00,
+  0x6d, 0x00, 0x7e, 0x00, 0x8e, 0x00, 0xa0, 0x00, 0xb2, 0x00, 0xc3, 0x00,
+  0xd4, 0x00, 0xe3, 0x00, 0xf7, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x1d, 0x00,
+  0x27, 0x00, 0x38, 0x00, 0x46, 0x00, 0x58, 0x00, 0x69, 0x00, 0x79, 0x00,
+  0x8d, 0x00, 0x9d, 0x00, 0xad, 0x00, 0xb8, 0x00, 0xca, 0x00, 0xd5, 0x00,
+  0xdf, 0x00, 0xef, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x19, 0x00, 0x26, 0x00,
+  0x3d, 0x00, 0x50, 0x00, 0x5b, 0x00, 0x6d, 0x00, 0x7d, 0x00, 0x8d, 0x00,
+  0x9a, 0x00, 0xaf, 0x00, 0xbb, 0x00, 0xc6, 0x00, 0xd1, 0x00, 0xdf, 0x00,
+  0xec, 0x00, 0xf9, 0x00, 0x08, 0x01, 0x14, 0x01, 0x22, 0x01, 0x32, 0x01,
+  0x43, 0x01, 0x52, 0x01, 0x61, 0x01, 0x73, 0x01, 0x82, 0x01, 0x91, 0x01,
+  0xa5, 0x01, 0xb4, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x17, 0x00, 0x26, 0x00,
+  0x31, 0x00, 0x3e, 0x00, 0x49, 0x00, 0x54, 0x00, 0x5f, 0x00, 0x6b, 0x00,
+  0x81, 0x00, 0x8d, 0x00, 0x9c, 0x00, 0xab, 0x00, 0xb5, 0x00, 0xc5, 0x00,
+  0xd2, 0x00, 0xe2, 0x00, 0xf6, 0x00, 0x00, 0x00, 0x12, 0x00, 0x20, 0x00,
+  0x2f, 0x00, 0x42, 0x00, 0x4f, 0x00, 0x5f, 0x00, 0x6c, 0x00, 0x7c, 0x00,
+  0x8e, 0x00, 0x9d, 0x00, 0xac, 0x00, 0xbd, 0x00, 0xd0, 0x00, 0xe1, 0x00,
+  0xf3, 0x00, 0x03, 0x01, 0x12, 0x01, 0x1e, 0x01, 0x00, 0x00, 0x12, 0x00,
+  0x22, 0x00, 0x2e, 0x00, 0x3c, 0x00, 0x46, 0x00, 0x58, 0x00, 0x66, 0x00,
+  0x76, 0x00, 0x86, 0x00, 0x00, 0x00, 0x12, 0x00, 0x26, 0x00, 0x31, 0x00,
+  0x3b, 0x00, 0x4e, 0x00, 0x59, 0x00, 0x68, 0x00, 0x72, 0x00, 0x85, 0x00,
+  0x99, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1e, 0x00, 0x31, 0x00, 0x48, 0x00,
+  0x53, 0x00, 0x61, 0x00, 0x70, 0x00, 0x7e, 0x00, 0x92, 0x00, 0xa1, 0x00,
+  0xab, 0x00, 0xb8, 0x00, 0xcb, 0x00, 0xdc, 0x00, 0x00, 0x00, 0x0a, 0x00,
+  0x19, 0x00, 0x2d, 0x00, 0x37, 0x00, 0x47, 0x00, 0x55, 0x00, 0x60, 0x00,
+  0x6f, 0x00, 0x7d, 0x00, 0x89, 0x00, 0x9b, 0x00, 0xad, 0x00, 0xbb, 0x00,
+  0xc7, 0x00, 0x00, 0x00, 0x10, 0x00, 0x2b, 0x00, 0x39, 0x00, 0x49, 0x00,
+  0x63, 0x00, 0x74, 0x00, 0x85, 0x00, 0x00, 0x00, 0x10, 0x00, 0x1c, 0x00,
+  0x2c, 0x00, 0x42, 0x00, 0x52, 0x00, 0x00, 0x00, 0x12, 0x00, 0x23, 0x00,
+  0x3c, 0x00, 0x53, 0x00, 0x66, 0x00, 0x79, 0x00, 0x8c, 0x00, 0x9e, 0x00,
+  0xb4, 0x00, 0xc6, 0x00, 0xe2, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x18, 0x00,
+  0x29, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x14, 0x00, 0x1f, 0x00, 0x29, 0x00,
+  0x38, 0x00, 0x4f, 0x00, 0x5b, 0x00, 0x65, 0x00, 0x74, 0x00, 0x8a, 0x00,
+  0x99, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x1a, 0x00, 0x26, 0x00,
+  0x32, 0x00, 0x41, 0x00, 0x5c, 0x00, 0x6b, 0x00, 0x00, 0x00, 0x13, 0x00,
+  0x20, 0x00, 0x2d, 0x00, 0x38, 0x00, 0x43, 0x00, 0x00, 0x00, 0x12, 0x00,
+  0x25, 0x00, 0x30, 0x00, 0x3a, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x0a, 0x00,
+  0x18, 0x00, 0x25, 0x00, 0x33, 0x00, 0x3d, 0x00, 0x51, 0x00, 0x5b, 0x00,
+  0x66, 0x00, 0x70, 0x00, 0x7d, 0x00, 0x8d, 0x00, 0x9b, 0x00, 0xa4, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x10, 0x00, 0x1c, 0x00,
+  0x28, 0x00, 0x32, 0x00, 0x45, 0x00, 0x56, 0x00, 0x65, 0x00, 0x77, 0x00,
+  0x8b, 0x00, 0x00, 0x00, 0x10, 0x00, 0x23, 0x00, 0x30, 0x00, 0x3d, 0x00,
+  0x4b, 0x00, 0x5c, 0x00, 0x6b, 0x00, 0x7b, 0x00, 0x85, 0x00, 0x00, 0x00,
+  0x24, 0x00, 0x34, 0x00, 0x40, 0x00, 0x51, 0x00, 0x5b, 0x00, 0x65, 0x00,
+  0x00, 0x00, 0x2c, 0x00, 0x37, 0x00, 0x41, 0x00, 0x4c, 0x00, 0x5e, 0x00,
+  0x69, 0x00, 0x79, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x26, 0x00, 0x32, 0x00,
+  0x40, 0x00, 0x4c, 0x00, 0x58, 0x00, 0x64, 0x00, 0x6e, 0x00, 0x7a, 0x00,
+  0x85, 0x00, 0x8f, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x19, 0x00, 0x2a, 0x00,
+  0x35, 0x00, 0x44, 0x00, 0x56, 0x00, 0x64, 0x00, 0x71, 0x00, 0x7f, 0x00,
+  0x8a, 0x00, 0x99, 0x00, 0xac, 0x00, 0xb7, 0x00, 0xc5, 0x00, 0xd2, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x1d, 0x00, 0x27, 0x00, 0x35, 0x00, 0x43, 0x00,
+  0x54, 0x00, 0x5f, 0x00, 0x6b, 0x00, 0x76, 0x00, 0x83, 0x00, 0x8e, 0x00,
+  0x99, 0x00, 0xa4, 0x00, 0xaf, 0x00, 0xbf, 0x00, 0xd0, 0x00, 0xd9, 0x00,
+  0xe4, 0x00, 0x00, 0x00, 0x22, 0x00, 0x5c, 0x00, 0x67, 0x00, 0x72, 0x00,
+  0x80, 0x00, 0x8d, 0x00, 0x98, 0x00, 0xa6, 0x00, 0xb1, 0x00, 0xbf, 0x00,
+  0xcb, 0x00, 0xd8, 0x00, 0xe3, 0x00, 0xf2, 0x00, 0x01, 0x01, 0x0e, 0x01,
+  0x1b, 0x01, 0x25, 0x01, 0x30, 0x01, 0x3b, 0x01, 0x47, 0x01, 0x56, 0x01,
+  0x61, 0x01, 0x6d, 0x01, 0x79, 0x01, 0x85, 0x01, 0x92, 0x01, 0x9f, 0x01,
+  0xad, 0x01, 0xb7, 0x01, 0xc3, 0x01, 0xce, 0x01, 0xdc, 0x01, 0xee, 0x01,
+  0x00, 0x02, 0x0c, 0x02, 0x19, 0x02, 0x2a, 0x02, 0x38, 0x02, 0x00, 0x00,
+  0x10, 0x00, 0x1d, 0x00, 0x2b, 0x00, 0x38, 0x00, 0x47, 0x00, 0x54, 0x00,
+  0x5f, 0x00, 0x6d, 0x00, 0x7e, 0x00, 0x8c, 0x00, 0x99, 0x00, 0xa7, 0x00,
+  0xb6, 0x00, 0xc4, 0x00, 0xd2, 0x00, 0xe2, 0x00, 0xf1, 0x00, 0xfe, 0x00,
+  0x0b, 0x01, 0x18, 0x01, 0x25, 0x01, 0x32, 0x01, 0x00, 0x00, 0x0f, 0x00,
+  0x1b, 0x00, 0x29, 0x00, 0x36, 0x00, 0x41, 0x00, 0x52, 0x00, 0x63, 0x00,
+  0x71, 0x00, 0x80, 0x00, 0x91, 0x00, 0xa1, 0x00, 0xb3, 0x00, 0xbf, 0x00,
+  0xcd, 0x00, 0xde, 0x00, 0xf1, 0x00, 0x02, 0x01, 0x0f, 0x01, 0x1c, 0x01,
+  0x26, 0x01, 0x33, 0x01, 0x3f, 0x01, 0x4d, 0x01, 0x5e, 0x01, 0x6c, 0x01,
+  0x77, 0x01, 0x8b, 0x01, 0x00, 0x00, 0x0f, 0x00, 0x1e, 0x00, 0x2d, 0x00,
+  0x3a, 0x00, 0x4c, 0x00, 0x57, 0x00, 0x62, 0x00, 0x71, 0x00, 0x80, 0x00,
+  0x8e, 0x00, 0x9c, 0x00, 0xa7, 0x00, 0xb3, 0x00, 0xbf, 0x00, 0xcd, 0x00,
+  0xdc, 0x00, 0xed, 0x00, 0xf9, 0x00, 0x07, 0x01, 0x18, 0x01, 0x00, 0x00,
+  0x11, 0x00, 0x1c, 0x00, 0x2b, 0x00, 0x3a, 0x00, 0x49, 0x00, 0x57, 0x00,
+  0x68, 0x00, 0x73, 0x00, 0x84, 0x00, 0x92, 0x00, 0xa0, 0x00, 0xae, 0x00,
+  0xbf, 0x00, 0xd1, 0x00, 0xdd, 0x00, 0xed, 0x00, 0xfb, 0x00, 0x09, 0x01,
+  0x16, 0x01, 0x20, 0x01, 0x2f, 0x01, 0x3a, 0x01, 0x45, 0x01, 0x52, 0x01,
+  0x5f, 0x01, 0x72, 0x01, 0x7f, 0x01, 0x91, 0x01, 0x9e, 0x01, 0x00, 0x00,
+  0x11, 0x00, 0x1c, 0x00, 0x27, 0x00, 0x38, 0x00, 0x45, 0x00, 0x54, 0x00,
+  0x62, 0x00, 0x71, 0x00, 0x7f, 0x00, 0x8a, 0x00, 0x97, 0x00, 0xa4, 0x00,
+  0xb3, 0x00, 0xc0, 0x00, 0xd1, 0x00, 0xe2, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x18, 0x00, 0x29, 0x00, 0x36, 0x00, 0x48, 0x00, 0x5c, 0x00, 0x67, 0x00,
+  0x79, 0x00, 0x84, 0x00, 0x97, 0x00, 0xae, 0x00, 0xbb, 0x00, 0xcc, 0x00,
+  0xdb, 0x00, 0xe7, 0x00, 0xf7, 0x00, 0x02, 0x01, 0x12, 0x01, 0x23, 0x01,
+  0x2e, 0x01, 0x39, 0x01, 0x4b, 0x01, 0x5d, 0x01, 0x68, 0x01, 0x79, 0x01,
+  0x88, 0x01, 0x95, 0x01, 0xa6, 0x01, 0xb3, 0x01, 0xc1, 0x01, 0xcf, 0x01,
+  0xdd, 0x01, 0xea, 0x01, 0x00, 0x00, 0x12, 0x00, 0x1d, 0x00, 0x2e, 0x00,
+  0x3d, 0x00, 0x4e, 0x00, 0x60, 0x00, 0x71, 0x00, 0x84, 0x00, 0x8c, 0x00,
+  0x9d, 0x00, 0xb0, 0x00, 0xc2, 0x00, 0xd0, 0x00, 0xde, 0x00, 0xf1, 0x00,
+  0xfb, 0x00, 0x09, 0x01, 0x1c, 0x01, 0x00, 0x00, 0x0d, 0x00, 0x19, 0x00,
+  0x2b, 0x00, 0x3e, 0x00, 0x51, 0x00, 0x60, 0x00, 0x70, 0x00, 0x7a, 0x00,
+  0x8b, 0x00, 0x98, 0x00, 0xa4, 0x00, 0xb4, 0x00, 0xc0, 0x00, 0xd1, 0x00,
+  0xdc, 0x00, 0xe7, 0x00, 0xfa, 0x00, 0x0f, 0x01, 0x19, 0x01, 0x2a, 0x01,
+  0x38, 0x01, 0x47, 0x01, 0x58, 0x01, 0x67, 0x01, 0x78, 0x01, 0x8a, 0x01,
+  0x00, 0x00, 0x0e, 0x00, 0x1f, 0x00, 0x2f, 0x00, 0x45, 0x00, 0x4f, 0x00,
+  0x5f, 0x00, 0x75, 0x00, 0x89, 0x00, 0x94, 0x00, 0xa1, 0x00, 0xad, 0x00,
+  0xbd, 0x00, 0xc7, 0x00, 0xd3, 0x00, 0x00, 0x00, 0x12, 0x00, 0x23, 0x00,
+  0x34, 0x00, 0x42, 0x00, 0x51, 0x00, 0x60, 0x00, 0x6b, 0x00, 0x7c, 0x00,
+  0x87, 0x00, 0x94, 0x00, 0xa1, 0x00, 0xb4, 0x00, 0xc6, 0x00, 0xd3, 0x00,
+  0xe4, 0x00, 0xf1, 0x00, 0x03, 0x01, 0x0f, 0x01, 0x1a, 0x01, 0x00, 0x00,
+  0x12, 0x00, 0x23, 0x00, 0x33, 0x00, 0x3e, 0x00, 0x4c, 0x00, 0x5e, 0x00,
+  0x69, 0x00, 0x7c, 0x00, 0x92, 0x00, 0xa5, 0x00, 0xb9, 0x00, 0xc5, 0x00,
+  0xd6, 0x00, 0xe4, 0x00, 0xf3, 0x00, 0x01, 0x01, 0x12, 0x01, 0x00, 0x00,
+  0x15, 0x00, 0x27, 0x00, 0x3b, 0x00, 0x4a, 0x00, 0x5a, 0x00, 0x62, 0x00,
+  0x6e, 0x00, 0x80, 0x00, 0x8e, 0x00, 0x9a, 0x00, 0xa4, 0x00, 0xbc, 0x00,
+  0xc6, 0x00, 0xd0, 0x00, 0xdd, 0x00, 0xe7, 0x00, 0xf8, 0x00, 0x03, 0x01,
+  0x13, 0x01, 0x24, 0x01, 0x34, 0x01, 0x43, 0x01, 0x57, 0x01, 0x00, 0x00,
+  0x15, 0x00, 0x29, 0x00, 0x37, 0x00, 0x48, 0x00, 0x5d, 0x00, 0x70, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x28, 0x00, 0x35, 0x00, 0x41, 0x00, 0x54, 0x00,
+  0x66, 0x00, 0x73, 0x00, 0x80, 0x00, 0x90, 0x00, 0x9a, 0x00, 0xa7, 0x00,
+  0xb9, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x2e, 0x00, 0x3e, 0x00, 0x4e, 0x00,
+  0x5d, 0x00, 0x7a, 0x00, 0x8a, 0x00, 0x9a, 0x00, 0xa8, 0x00, 0xb8, 0x00,
+  0xcc, 0x00, 0xe1, 0x00, 0x00, 0x00, 0x28, 0x00, 0x39, 0x00, 0x48, 0x00,
+  0x53, 0x00, 0x63, 0x00, 0x71, 0x00, 0x7e, 0x00, 0x93, 0x00, 0xab, 0x00,
+  0x00, 0x00, 0x1e, 0x00, 0x2b, 0x00, 0x46, 0x00, 0x54, 0x00, 0x66, 0x00,
+  0x74, 0x00, 0x86, 0x00, 0xa3, 0x00, 0x00, 0x00, 0x23, 0x00, 0x34, 0x00,
+  0x4b, 0x00, 0x65, 0x00, 0x72, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x1f, 0x00,
+  0x2c, 0x00, 0x3b, 0x00, 0x4a, 0x00, 0x58, 0x00, 0x69, 0x00, 0x78, 0x00,
+  0x84, 0x00, 0x93, 0x00, 0xa2, 0x00, 0xae, 0x00, 0xba, 0x00, 0xcb, 0x00,
+  0xdb, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x16, 0x00, 0x24, 0x00, 0x33, 0x00,
+  0x42, 0x00, 0x51, 0x00, 0x00, 0x00, 0x16, 0x00, 0x24, 0x00, 0x36, 0x00,
+  0x44, 0x00, 0x55, 0x00, 0x69, 0x00, 0x78, 0x00, 0x86, 0x00, 0x98, 0x00,
+  0x00, 0x00, 0x0b, 0x00, 0x1d, 0x00, 0x2b, 0x00, 0x38, 0x00, 0x45, 0x00,
+  0x53, 0x00, 0x61, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x26, 0x00, 0x36, 0x00,
+  0x40, 0x00, 0x4f, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x1c, 0x00,
+  0x2c, 0x00, 0x3c, 0x00, 0x4f, 0x00, 0x5d, 0x00, 0x6b, 0x00, 0x7b, 0x00,
+  0x8d, 0x00, 0x99, 0x00, 0xa6, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x3a, 0x00,
+  0x47, 0x00, 0x53, 0x00, 0x66, 0x00, 0x73, 0x00, 0x7f, 0x00, 0x91, 0x00,
+  0x9e, 0x00, 0x00, 0x00, 0x11, 0x00, 0x23, 0x00, 0x37, 0x00, 0x46, 0x00,
+  0x00, 0x00, 0x0f, 0x00, 0x20, 0x00, 0x2c, 0x00, 0x43, 0x00, 0x53, 0x00,
+  0x62, 0x00, 0x6f, 0x00, 0x7b, 0x00, 0x8b, 0x00, 0x96, 0x00, 0xa0, 0x00,
+  0x00, 0x00, 0x0b, 0x00, 0x19, 0x00, 0x2c, 0x00, 0x39, 0x00, 0x47, 0x00,
+  0x5c, 0x00, 0x6a, 0x00, 0x80, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1d, 0x00,
+  0x28, 0x00, 0x33, 0x00, 0x41, 0x00, 0x4e, 0x00, 0x5a, 0x00, 0x66, 0x00,
+  0x7c, 0x00, 0x87, 0x00, 0x95, 0x00, 0xa2, 0x00, 0xb0, 0x00, 0xc1, 0x00,
+  0xcc, 0x00, 0xde, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x1c, 0x00, 0x28, 0x00,
+  0x33, 0x00, 0x40, 0x00, 0x4f, 0x00, 0x58, 0x00, 0x63, 0x00, 0x71, 0x00,
+  0x7d, 0x00, 0x88, 0x00, 0x94, 0x00, 0xaa, 0x00, 0xba, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x1f, 0x00, 0x31, 0x00, 0x3e, 0x00, 0x4a, 0x00, 0x55, 0x00,
+  0x66, 0x00, 0x71, 0x00, 0x84, 0x00, 0x90, 0x00, 0xa0, 0x00, 0xac, 0x00,
+  0xb7, 0x00, 0xc3, 0x00, 0xd2, 0x00, 0xdf, 0x00, 0xed, 0x00, 0xfd, 0x00,
+  0x0d, 0x01, 0x17, 0x01, 0x27, 0x01, 0x32, 0x01, 0x42, 0x01, 0x4e, 0x01,
+  0x00, 0x00, 0x0f, 0x00, 0x1f, 0x00, 0x2b, 0x00, 0x3f, 0x00, 0x4a, 0x00,
+  0x58, 0x00, 0x65, 0x00, 0x6f, 0x00, 0x7b, 0x00, 0x89, 0x00, 0x95, 0x00,
+  0xa0, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x18, 0x00, 0x25, 0x00, 0x34, 0x00,
+  0x46, 0x00, 0x51, 0x00, 0x60, 0x00, 0x6c, 0x00, 0x78, 0x00, 0x83, 0x00,
+  0x94, 0x00, 0x9e, 0x00, 0xa8, 0x00, 0xba, 0x00, 0xc6, 0x00, 0xd3, 0x00,
+  0xe2, 0x00, 0xf0, 0x00, 0x01, 0x01, 0x0b, 0x01, 0x1c, 0x01, 0x27, 0x01,
+  0x38, 0x01, 0x47, 0x01, 0x51, 0x01, 0x00, 0x00, 0x31, 0x00, 0x3d, 0x00,
+  0x4a, 0x00, 0x56, 0x00, 0x63, 0x00, 0x6e, 0x00, 0x7c, 0x00, 0x8b, 0x00,
+  0x99, 0x00, 0xa7, 0x00, 0xb6, 0x00, 0xc1, 0x00, 0xcd, 0x00, 0xda, 0x00,
+  0xe4, 0x00, 0xf2, 0x00, 0xfd, 0x00, 0x0b, 0x01, 0x16, 0x01, 0x24, 0x01,
+  0x30, 0x01, 0x3f, 0x01, 0x4d, 0x01, 0x5f, 0x01, 0x6c, 0x01, 0x7a, 0x01,
+  0x87, 0x01, 0x94, 0x01, 0xa0, 0x01, 0x00, 0x00, 0x2f, 0x00, 0x3b, 0x00,
+  0x49, 0x00, 0x55, 0x00, 0x68, 0x00, 0x76, 0x00, 0x82, 0x00, 0x91, 0x00,
+  0xa2, 0x00, 0xae, 0x00, 0xba, 0x00, 0xc5, 0x00, 0xd1, 0x00, 0xe4, 0x00,
+  0xf0, 0x00, 0xfc, 0x00, 0x0d, 0x01, 0x19, 0x01, 0x25, 0x01, 0x31, 0x01,
+  0x3c, 0x01, 0x48, 0x01, 0x53, 0x01, 0x61, 0x01, 0x73, 0x01, 0x81, 0x01,
+  0x92, 0x01, 0xa1, 0x01, 0xac, 0x01, 0xbb, 0x01, 0xc7, 0x01, 0xd3, 0x01,
+  0x00, 0x00, 0x0b, 0x00, 0x15, 0x00, 0x23, 0x00, 0x2d, 0x00, 0x3d, 0x00,
+  0x48, 0x00, 0x56, 0x00, 0x65, 0x00, 0x73, 0x00, 0x83, 0x00, 0x8e, 0x00,
+  0x9a, 0x00, 0xaa, 0x00, 0xbc, 0x00, 0xc7, 0x00, 0xd3, 0x00, 0xde, 0x00,
+  0xec, 0x00, 0xfa, 0x00, 0x05, 0x01, 0x12, 0x01, 0x1d, 0x01, 0x29, 0x01,
+  0x39, 0x01, 0x45, 0x01, 0x51, 0x01, 0x5e, 0x01, 0x69, 0x01, 0x7a, 0x01,
+  0x88, 0x01, 0x00, 0x00, 0x0d, 0x00, 0x1a, 0x00, 0x2b, 0x00, 0x38, 0x00,
+  0x49, 0x00, 0x5a, 0x00, 0x6d, 0x00, 0x7d, 0x00, 0x8b, 0x00, 0x99, 0x00,
+  0xa8, 0x00, 0xb9, 0x00, 0xca, 0x00, 0xd9, 0x00, 0xe7, 0x00, 0xf4, 0x00,
+  0x03, 0x01, 0x14, 0x01, 0x26, 0x01, 0x33, 0x01, 0x43, 0x01, 0x50, 0x01,
+  0x5f, 0x01, 0x6b, 0x01, 0x7b, 0x01, 0x87, 0x01, 0x96, 0x01, 0xa3, 0x01,
+  0xb2, 0x01, 0xc2, 0x01, 0x00, 0x00, 0x0e, 0x00, 0x1b, 0x00, 0x28, 0x00,
+  0x36, 0x00, 0x44, 0x00, 0x50, 0x00, 0x5e, 0x00, 0x6c, 0x00, 0x73, 0x00,
+  0x7f, 0x00, 0x8c, 0x00, 0x9b, 0x00, 0xa8, 0x00, 0xb4, 0x00, 0xc1, 0x00,
+  0xd2, 0x00, 0xdf, 0x00, 0xed, 0x00, 0xfd, 0x00, 0x09, 0x01, 0x16, 0x01,
+  0x20, 0x01, 0x2d, 0x01, 0x39, 0x01, 0x48, 0x01, 0x55, 0x01, 0x63, 0x01,
+  0x70, 0x01, 0x88, 0x01, 0x94, 0x01, 0xa2, 0x01, 0xb0, 0x01, 0xc0, 0x01,
+  0xd2, 0x01, 0xe3, 0x01, 0xf1, 0x01, 0xfd, 0x01, 0x0a, 0x02, 0x16, 0x02,
+  0x24, 0x02, 0x2f, 0x02, 0x3c, 0x02, 0x49, 0x02, 0x5c, 0x02, 0x67, 0x02,
+  0x78, 0x02, 0x87, 0x02, 0x9a, 0x02, 0xa9, 0x02, 0xb3, 0x02, 0xc2, 0x02,
+  0xce, 0x02, 0x00, 0x00, 0x12, 0x00, 0x23, 0x00, 0x2e, 0x00, 0x3b, 0x00,
+  0x4e, 0x00, 0x59, 0x00, 0x6d, 0x00, 0x7c, 0x00, 0x87, 0x00, 0x98, 0x00,
+  0xa9, 0x00, 0xb9, 0x00, 0xcb, 0x00, 0xdb, 0x00, 0xe8, 0x00, 0xfe, 0x00,
+  0x0b, 0x01, 0x1a, 0x01, 0x29, 0x01, 0x38, 0x01, 0x47, 0x01, 0x57, 0x01,
+  0x00, 0x00, 0x0d, 0x00, 0x18, 0x00, 0x24, 0x00, 0x2e, 0x00, 0x3d, 0x00,
+  0x47, 0x00, 0x57, 0x00, 0x6b, 0x00, 0x78, 0x00, 0x87, 0x00, 0x99, 0x00,
+  0xa6, 0x00, 0xb3, 0x00, 0xc2, 0x00, 0xd1, 0x00, 0xe0, 0x00, 0xee, 0x00,
+  0x00, 0x01, 0x0e, 0x01, 0x1a, 0x01, 0x37, 0x01, 0x44, 0x01, 0x52, 0x01,
+  0x00, 0x00, 0x12, 0x00, 0x1e, 0x00, 0x2f, 0x00, 0x3b, 0x00, 0x4c, 0x00,
+  0x5b, 0x00, 0x6b, 0x00, 0x79, 0x00, 0x8b, 0x00, 0x96, 0x00, 0xa1, 0x00,
+  0xb1, 0x00, 0xbc, 0x00, 0xc9, 0x00, 0xdb, 0x00, 0xed, 0x00, 0xf7, 0x00,
+  0x05, 0x01, 0x15, 0x01, 0x28, 0x01, 0x3a, 0x01, 0x4d, 0x01, 0x00, 0x00,
+  0x0a, 0x00, 0x15, 0x00, 0x21, 0x00, 0x2f, 0x00, 0x3b, 0x00, 0x49, 0x00,
+  0x58, 0x00, 0x64, 0x00, 0x6e, 0x00, 0x7d, 0x00, 0x86, 0x00, 0x94, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x1f, 0x00, 0x2b, 0x00, 0x37, 0x00, 0x49, 0x00,
+  0x54, 0x00, 0x62, 0x00, 0x70, 0x00, 0x7d, 0x00, 0x8c, 0x00, 0x9a, 0x00,
+  0xa4, 0x00, 0xb0, 0x00, 0xbf, 0x00, 0xcd, 0x00, 0xda, 0x00, 0xe8, 0x00,
+  0xf7, 0x00, 0x05, 0x01, 0x10, 0x01, 0x1b, 0x01, 0x31, 0x01, 0x3d, 0x01,
+  0x50, 0x01, 0x5d, 0x01, 0x00, 0x00, 0x0e, 0x00, 0x22, 0x00, 0x33, 0x00,
+  0x3f, 0x00, 0x4c, 0x00, 0x60, 0x00, 0x6f, 0x00, 0x7d, 0x00, 0x8b, 0x00,
+  0x9a, 0x00, 0xa7, 0x00, 0xb4, 0x00, 0xbf, 0x00, 0xd0, 0x00, 0xdc, 0x00,
+  0xec, 0x00, 0xfa, 0x00, 0x08, 0x01, 0x1a, 0x01, 0x2b, 0x01, 0x3e, 0x01,
+  0x00, 0x00, 0x0d, 0x00, 0x1e, 0x00, 0x33, 0x00, 0x3e, 0x00, 0x4e, 0x00,
+  0x66, 0x00, 0x71, 0x00, 0x7b, 0x00, 0x00, 0x00, 0x10, 0x00, 0x1e, 0x00,
+  0x32, 0x00, 0x3c, 0x00, 0x4f, 0x00, 0x5a, 0x00, 0x6a, 0x00, 0x7c, 0x00,
+  0x8c, 0x00, 0x9b, 0x00, 0xad, 0x00, 0xba, 0x00, 0xc9, 0x00, 0xd8, 0x00,
+  0xe8, 0x00, 0xfd, 0x00, 0x0d, 0x01, 0x1d, 0x01, 0x00, 0x00, 0x12, 0x00,
+  0x24, 0x00, 0x36, 0x00, 0x48, 0x00, 0x59, 0x00, 0x6a, 0x00, 0x77, 0x00,
+  0x8c, 0x00, 0x98, 0x00, 0xa9, 0x00, 0xbb, 0x00, 0xcc, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x1b, 0x00, 0x2d, 0x00, 0x3d, 0x00, 0x4c, 0x00, 0x5c, 0x00,
+  0x6e, 0x00, 0x7e, 0x00, 0x8e, 0x00, 0x9f, 0x00, 0xaf, 0x00, 0xba, 0x00,
+  0xc5, 0x00, 0x00, 0x00, 0x12, 0x00, 0x1d, 0x00, 0x28, 0x00, 0x35, 0x00,
+  0x45, 0x00, 0x57, 0x00, 0x61, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x20, 0x00,
+  0x30, 0x00, 0x48, 0x00, 0x58, 0x00, 0x69, 0x00, 0x7b, 0x00, 0x88, 0x00,
+  0x9a, 0x00, 0xa7, 0x00, 0xba, 0x00, 0xcc, 0x00, 0xdb, 0x00, 0xf5, 0x00,
+  0x00, 0x00, 0x0b, 0x00, 0x16, 0x00, 0x21, 0x00, 0x31, 0x00, 0x44, 0x00,
+  0x54, 0x00, 0x60, 0x00, 0x6e, 0x00, 0x78, 0x00, 0x8f, 0x00, 0x9c, 0x00,
+  0xa7, 0x00, 0xb5, 0x00, 0x00, 0x00, 0x26, 0x00, 0x30, 0x00, 0x3c, 0x00,
+  0x4d, 0x00, 0x5b, 0x00, 0x6d, 0x00, 0x7d, 0x00, 0x8f, 0x00, 0x9d, 0x00,
+  0xab, 0x00, 0xba, 0x00, 0xcb, 0x00, 0xd9, 0x00, 0xe6, 0x00, 0xf5, 0x00,
+  0x03, 0x01, 0x1c, 0x01, 0x32, 0x01, 0x40, 0x01, 0x00, 0x00, 0x0e, 0x00,
+  0x1b, 0x00, 0x26, 0x00, 0x33, 0x00, 0x3d, 0x00, 0x4c, 0x00, 0x5b, 0x00,
+  0x69, 0x00, 0x75, 0x00, 0x83, 0x00, 0x96, 0x00, 0x00, 0x00, 0x12, 0x00,
+  0x23, 0x00, 0x30, 0x00, 0x40, 0x00, 0x53, 0x00, 0x5d, 0x00, 0x6b, 0x00,
+  0x77, 0x00, 0x85, 0x00, 0xa0, 0x00, 0xb0, 0x00, 0xbd, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x35, 0x00, 0x40, 0x00, 0x50, 0x00, 0x5f, 0x00, 0x69, 0x00,
+  0x76, 0x00, 0x87, 0x00, 0x98, 0x00, 0xa4, 0x00, 0xb8, 0x00, 0xc9, 0x00,
+  0xda, 0x00, 0xeb, 0x00, 0xf6, 0x00, 0x05, 0x01, 0x14, 0x01, 0x29, 0x01,
+  0x00, 0x00, 0x0e, 0x00, 0x1c, 0x00, 0x2d, 0x00, 0x3f, 0x00, 0x4d, 0x00,
+  0x5f, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x1c, 0x00, 0x27, 0x00, 0x37, 0x00, 0x52, 0x00, 0x61, 0x00, 0x70, 0x00,
+  0x00, 0x00, 0x08, 0x00, 0x1a, 0x00, 0x29, 0x00, 0x36, 0x00, 0x46, 0x00,
+  0x51, 0x00, 0x5d, 0x00, 0x72, 0x00, 0x7e, 0x00, 0x8a, 0x00, 0x94, 0x00,
+  0xa0, 0x00, 0xaa, 0x00, 0xba, 0x00, 0xcb, 0x00, 0xdb, 0x00, 0xeb, 0x00,
+  0xf8, 0x00, 0x04, 0x01, 0x13, 0x01, 0x1c, 0x01, 0x00, 0x00, 0x25, 0x00,
+  0x32, 0x00, 0x43, 0x00, 0x50, 0x00, 0x64, 0x00, 0x6f, 0x00, 0x7a, 0x00,
+  0x85, 0x00, 0x97, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x1a, 0x00, 0x27, 0x00,
+  0x37, 0x00, 0x42, 0x00, 0x4f, 0x00, 0x5a, 0x00, 0x68, 0x00, 0x73, 0x00,
+  0x84, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x1a, 0x00, 0x2a, 0x00, 0x35, 0x00,
+  0x40, 0x00, 0x4b, 0x00, 0x57, 0x00, 0x00, 0x00, 0x21, 0x00, 0x2d, 0x00,
+  0x3c, 0x00, 0x4b, 0x00, 0x5b, 0x00, 0x6a, 0x00, 0x7b, 0x00, 0x8c, 0x00,
+  0x9d, 0x00, 0xaa, 0x00, 0xb5, 0x00, 0xc1, 0x00, 0xcc, 0x00, 0xdc, 0x00,
+  0xed, 0x00, 0xfe, 0x00, 0x09, 0x01, 0x15, 0x01, 0x00, 0x00, 0x0c, 0x00,
+  0x18, 0x00, 0x2b, 0x00, 0x3a, 0x00, 0x48, 0x00, 0x53, 0x00, 0x61, 0x00,
+  0x70, 0x00, 0x80, 0x00, 0x8d, 0x00, 0x99, 0x00, 0xa3, 0x00, 0xae, 0x00,
+  0xb9, 0x00, 0xc4, 0x00, 0xd4, 0x00, 0xde, 0x00, 0x00, 0x00, 0x20, 0x00,
+  0x2b, 0x00, 0x35, 0x00, 0x40, 0x00, 0x55, 0x00, 0x60, 0x00, 0x71, 0x00,
+  0x7c, 0x00, 0x8a, 0x00, 0x98, 0x00, 0xac, 0x00, 0xb7, 0x00, 0xc3, 0x00,
+  0xcd, 0x00, 0xd9, 0x00, 0xe8, 0x00, 0xf4, 0x00, 0xfd, 0x00, 0x0a, 0x01,
+  0x15, 0x01, 0x20, 0x01, 0x2b, 0x01, 0x39, 0x01, 0x47, 0x01, 0x59, 0x01,
+  0x6b, 0x01, 0x77, 0x01, 0x86, 0x01, 0x95, 0x01, 0xa1, 0x01, 0x00, 0x00,
+  0x0a, 0x00, 0x18, 0x00, 0x26, 0x00, 0x36, 0x00, 0x42, 0x00, 0x51, 0x00,
+  0x60, 0x00, 0x6e, 0x00, 0x7c, 0x00, 0x87, 0x00, 0x97, 0x00, 0xa3, 0x00,
+  0xb4, 0x00, 0xbf, 0x00, 0xcc, 0x00, 0xda, 0x00, 0xe7, 0x00, 0xf1, 0x00,
+  0xfe, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x1e, 0x00, 0x2b, 0x00, 0x36, 0x00,
+  0x42, 0x00, 0x54, 0x00, 0x61, 0x00, 0x73, 0x00, 0x81, 0x00, 0x8b, 0x00,
+  0x9b, 0x00, 0xaa, 0x00, 0xbb, 0x00, 0xcb, 0x00, 0xd5, 0x00, 0xe5, 0x00,
+  0xf0, 0x00, 0xfe, 0x00, 0x0b, 0x01, 0x1a, 0x01, 0x27, 0x01, 0x3e, 0x01,
+  0x4a, 0x01, 0x5c, 0x01, 0x6f, 0x01, 0x7e, 0x01, 0x8b, 0x01, 0x97, 0x01,
+  0x00, 0x00, 0x0c, 0x00, 0x1c, 0x00, 0x2b, 0x00, 0x37, 0x00, 0x45, 0x00,
+  0x53, 0x00, 0x5b, 0x00, 0x66, 0x00, 0x73, 0x00, 0x7d, 0x00, 0x89, 0x00,
+  0x93, 0x00, 0x9f, 0x00, 0xab, 0x00, 0xb6, 0x00, 0xc4, 0x00, 0xd0, 0x00,
+  0xdb, 0x00, 0xe7, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x19, 0x00, 0x25, 0x00,
+  0x31, 0x00, 0x41, 0x00, 0x54, 0x00, 0x61, 0x00, 0x6f, 0x00, 0x7e, 0x00,
+  0x89, 0x00, 0x9f, 0x00, 0xb1, 0x00, 0xbc, 0x00, 0xc8, 0x00, 0xd4, 0x00,
+  0xdf, 0x00, 0xf1, 0x00, 0x03, 0x01, 0x13, 0x01, 0x00, 0x00, 0x2f, 0x00,
+  0x3b, 0x00, 0x47, 0x00, 0x54, 0x00, 0x61, 0x00, 0x6f, 0x00, 0x7c, 0x00,
+  0x87, 0x00, 0x94, 0x00, 0xa2, 0x00, 0xb0, 0x00, 0xbd, 0x00, 0xcc, 0x00,
+  0xdd, 0x00, 0xeb, 0x00, 0xfa, 0x00, 0x08, 0x01, 0x16, 0x01, 0x24, 0x01,
+  0x32, 0x01, 0x42, 0x01, 0x50, 0x01, 0x60, 0x01, 0x6e, 0x01, 0x7a, 0x01,
+  0x84, 0x01, 0x91, 0x01, 0x9e, 0x01, 0xac, 0x01, 0xb9, 0x01, 0xc9, 0x01,
+  0xd6, 0x01, 0xe7, 0x01, 0xf3, 0x01, 0x02, 0x02, 0x0d, 0x02, 0x1a, 0x02,
+  0x33, 0x02, 0x40, 0x02, 0x4d, 0x02, 0x5e, 0x02, 0x6a, 0x02, 0x79, 0x02,
+  0x86, 0x02, 0x91, 0x02, 0xa0, 0x02, 0xac, 0x02, 0x00, 0x00, 0x0b, 0x00,
+  0x18, 0x00, 0x23, 0x00, 0x2e, 0x00, 0x3f, 0x00, 0x50, 0x00, 0x5a, 0x00,
+  0x65, 0x00, 0x7a, 0x00, 0x89, 0x00, 0x95, 0x00, 0xa4, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x1b, 0x00, 0x2f, 0x00, 0x40, 0x00, 0x4d, 0x00, 0x5a, 0x00,
+  0x67, 0x00, 0x75, 0x00, 0x8a, 0x00, 0x9b, 0x00, 0x00, 0x00, 0x0b, 0x00,
+  0x19, 0x00, 0x2c, 0x00, 0x37, 0x00, 0x41, 0x00, 0x4f, 0x00, 0x5d, 0x00,
+  0x70, 0x00, 0x7b, 0x00, 0x8c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x1a, 0x00,
+  0x27, 0x00, 0x3b, 0x00, 0x47, 0x00, 0x52, 0x00, 0x60, 0x00, 0x71, 0x00,
+  0x80, 0x00, 0x8f, 0x00, 0x9d, 0x00, 0xaf, 0x00, 0xbb, 0x00, 0xcb, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x1c, 0x00, 0x29, 0x00, 0x36, 0x00, 0x47, 0x00,
+  0x55, 0x00, 0x67, 0x00, 0x75, 0x00, 0x85, 0x00, 0x93, 0x00, 0xa3, 0x00,
+  0xb2, 0x00, 0xbf, 0x00, 0xcd, 0x00, 0xda, 0x00, 0xe6, 0x00, 0xf4, 0x00,
+  0x05, 0x01, 0x00, 0x00, 0x21, 0x00, 0x2f, 0x00, 0x3f, 0x00, 0x53, 0x00,
+  0x66, 0x00, 0x76, 0x00, 0x84, 0x00, 0x93, 0x00, 0xa6, 0x00, 0xb9, 0x00,
+  0xcc, 0x00, 0xda, 0x00, 0xe7, 0x00, 0xf8, 0x00, 0x0c, 0x01, 0x1a, 0x01,
+  0x00, 0x00, 0x25, 0x00, 0x35, 0x00, 0x40, 0x00, 0x52, 0x00, 0x60, 0x00,
+  0x71, 0x00, 0x81, 0x00, 0x91, 0x00, 0xa1, 0x00, 0xb2, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x1c, 0x00, 0x30, 0x00, 0x45, 0x00, 0x50, 0x00, 0x5b, 0x00,
+  0x73, 0x00, 0x84, 0x00, 0x95, 0x00, 0xaa, 0x00, 0xb9, 0x00, 0xce, 0x00,
+  0xe1, 0x00, 0x00, 0x00, 0x11, 0x00, 0x22, 0x00, 0x2f, 0x00, 0x41, 0x00,
+  0x52, 0x00, 0x5f, 0x00, 0x69, 0x00, 0x74, 0x00, 0x80, 0x00, 0x93, 0x00,
+  0xa3, 0x00, 0xb5, 0x00, 0xca, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x1d, 0x00,
+  0x2c, 0x00, 0x3b, 0x00, 0x47, 0x00, 0x53, 0x00, 0x62, 0x00, 0x6c, 0x00,
+  0x00, 0x00, 0x0b, 0x00, 0x1d, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x1e, 0x00, 0x2d, 0x00, 0x3b, 0x00, 0x4a, 0x00, 0x58, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x1f, 0x00, 0x2e, 0x00, 0x3a, 0x00, 0x46, 0x00, 0x51, 0x00,
+  0x5c, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x16, 0x00, 0x27, 0x00, 0x37, 0x00,
+  0x46, 0x00, 0x59, 0x00, 0x71, 0x00, 0x83, 0x00, 0x8f, 0x00, 0x9e, 0x00,
+  0x00, 0x00, 0x0f, 0x00, 0x1d, 0x00, 0x35, 0x00, 0x42, 0x00, 0x50, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x1e, 0x00, 0x28, 0x00, 0x3b, 0x00, 0x4a, 0x00,
+  0x58, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x1c, 0x00, 0x27, 0x00, 0x32, 0x00,
+  0x40, 0x00, 0x5b, 0x00, 0x6c, 0x00, 0x85, 0x00, 0x00, 0x00, 0x0b, 0x00,
+  0x18, 0x00, 0x27, 0x00, 0x36, 0x00, 0x46, 0x00, 0x54, 0x00, 0x63, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x1f, 0x00, 0x31, 0x00, 0x3e, 0x00, 0x50, 0x00,
+  0x00, 0x00, 0x0b, 0x00, 0x19, 0x00, 0x28, 0x00, 0x34, 0x00, 0x40, 0x00,
+  0x4c, 0x00, 0x60, 0x00, 0x6a, 0x00, 0x74, 0x00, 0x85, 0x00, 0x90, 0x00,
+  0x9a, 0x00, 0xab, 0x00, 0xb6, 0x00, 0xc7, 0x00, 0xd1, 0x00, 0xe4, 0x00,
+  0xf4, 0x00, 0x00, 0x00, 0x15, 0x00, 0x26, 0x00, 0x31, 0x00, 0x3f, 0x00,
+  0x4d, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x1d, 0x00, 0x2b, 0x00, 0x36, 0x00,
+  0x42, 0x00, 0x4e, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x17, 0x00,
+  0x25, 0x00, 0x30, 0x00, 0x3c, 0x00, 0x47, 0x00, 0x52, 0x00, 0x5e, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x15, 0x00, 0x20, 0x00, 0x2c, 0x00, 0x38, 0x00,
+  0x44, 0x00, 0x4f, 0x00, 0x5d, 0x00, 0x6a, 0x00, 0x78, 0x00, 0x84, 0x00,
+  0x90, 0x00, 0x9b, 0x00, 0xa8, 0x00, 0xb6, 0x00, 0xc3, 0x00, 0xcf, 0x00,
+  0xdc, 0x00, 0xe8, 0x00, 0xf4, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x19, 0x00,
+  0x25, 0x00, 0x30, 0x00, 0x3b, 0x00, 0x46, 0x00, 0x53, 0x00, 0x61, 0x00,
+  0x6f, 0x00, 0x7c, 0x00, 0x8e, 0x00, 0x99, 0x00, 0xa5, 0x00, 0xb1, 0x00,
+  0xbd, 0x00, 0xc8, 0x00, 0xd5, 0x00, 0xe0, 0x00, 0xeb, 0x00, 0xf7, 0x00,
+  0x0e, 0x01, 0x1a, 0x01, 0x00, 0x00, 0x0f, 0x00, 0x1c, 0x00, 0x27, 0x00,
+  0x38, 0x00, 0x44, 0x00, 0x52, 0x00, 0x61, 0x00, 0x70, 0x00, 0x7b, 0x00,
+  0x89, 0x00, 0x93, 0x00, 0xa2, 0x00, 0xb2, 0x00, 0xbd, 0x00, 0xca, 0x00,
+  0xd8, 0x00, 0xe7, 0x00, 0xf3, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x25, 0x00,
+  0x2f, 0x00, 0x3d, 0x00, 0x4d, 0x00, 0x5b, 0x00, 0x68, 0x00, 0x77, 0x00,
+  0x86, 0x00, 0x92, 0x00, 0x9e, 0x00, 0xa8, 0x00, 0xb6, 0x00, 0xc2, 0x00,
+  0xd0, 0x00, 0xe2, 0x00, 0xf1, 0x00, 0xfd, 0x00, 0x07, 0x01, 0x14, 0x01,
+  0x22, 0x01, 0x32, 0x01, 0x3f, 0x01, 0x4c, 0x01, 0x59, 0x01, 0x66, 0x01,
+  0x00, 0x00, 0x0b, 0x00, 0x1a, 0x00, 0x25, 0x00, 0x36, 0x00, 0x41, 0x00,
+  0x4c, 0x00, 0x5a, 0x00, 0x67, 0x00, 0x73, 0x00, 0x7f, 0x00, 0x8b, 0x00,
+  0x96, 0x00, 0xa1, 0x00, 0xb2, 0x00, 0xc1, 0x00, 0xcc, 0x00, 0xdb, 0x00,
+  0xec, 0x00, 0xfd, 0x00, 0x09, 0x01, 0x19, 0x01, 0x00, 0x00, 0x0f, 0x00,
+  0x1a, 0x00, 0x24, 0x00, 0x30, 0x00, 0x3d, 0x00, 0x4d, 0x00, 0x5b, 0x00,
+  0x6d, 0x00, 0x79, 0x00, 0x89, 0x00, 0x9f, 0x00, 0xae, 0x00, 0xbd, 0x00,
+  0xcd, 0x00, 0xde, 0x00, 0xe9, 0x00, 0xf6, 0x00, 0x06, 0x01, 0x11, 0x01,
+  0x1f, 0x01, 0x2a, 0x01, 0x3f, 0x01, 0x4e, 0x01, 0x5c, 0x01, 0x68, 0x01,
+  0x75, 0x01, 0x81, 0x01, 0x00, 0x00, 0x0b, 0x00, 0x16, 0x00, 0x23, 0x00,
+  0x2e, 0x00, 0x3c, 0x00, 0x46, 0x00, 0x54, 0x00, 0x62, 0x00, 0x72, 0x00,
+  0x86, 0x00, 0x91, 0x00, 0xa3, 0x00, 0xb1, 0x00, 0xc2, 0x00, 0xd1, 0x00,
+  0xe5, 0x00, 0xf0, 0x00, 0xff, 0x00, 0x11, 0x01, 0x1d, 0x01, 0x29, 0x01,
+  0x3b, 0x01, 0x00, 0x00, 0x0b, 0x00, 0x16, 0x00, 0x23, 0x00, 0x2f, 0x00,
+  0x3c, 0x00, 0x4a, 0x00, 0x56, 0x00, 0x63, 0x00, 0x71, 0x00, 0x7e, 0x00,
+  0x91, 0x00, 0x9f, 0x00, 0xb2, 0x00, 0xc4, 0x00, 0xd1, 0x00, 0xdf, 0x00,
+  0xf0, 0x00, 0xfd, 0x00, 0x0a, 0x01, 0x18, 0x01, 0x26, 0x01, 0x35, 0x01,
+  0x41, 0x01, 0x4e, 0x01, 0x59, 0x01, 0x69, 0x01, 0x75, 0x01, 0x82, 0x01,
+  0x90, 0x01, 0x9d, 0x01, 0xac, 0x01, 0xb7, 0x01, 0xc3, 0x01, 0xd1, 0x01,
+  0xdd, 0x01, 0xeb, 0x01, 0xf8, 0x01, 0x05, 0x02, 0x13, 0x02, 0x1f, 0x02,
+  0x00, 0x00, 0x0f, 0x00, 0x1f, 0x00, 0x2c, 0x00, 0x3c, 0x00, 0x48, 0x00,
+  0x57, 0x00, 0x65, 0x00, 0x77, 0x00, 0x85, 0x00, 0x99, 0x00, 0xa9, 0x00,
+  0xb6, 0x00, 0xc3, 0x00, 0xd5, 0x00, 0xe3, 0x00, 0xf7, 0x00, 0x03, 0x01,
+  0x10, 0x01, 0x1b, 0x01, 0x25, 0x01, 0x34, 0x01, 0x3e, 0x01, 0x4c, 0x01,
+  0x59, 0x01, 0x63, 0x01, 0x73, 0x01, 0x7e, 0x01, 0x8b, 0x01, 0x9b, 0x01,
+  0xab, 0x01, 0xb7, 0x01, 0xc8, 0x01, 0x00, 0x00, 0x10, 0x00, 0x1f, 0x00,
+  0x2a, 0x00, 0x39, 0x00, 0x4a, 0x00, 0x5b, 0x00, 0x68, 0x00, 0x7a, 0x00,
+  0x8d, 0x00, 0x9e, 0x00, 0xb1, 0x00, 0xbd, 0x00, 0xce, 0x00, 0xde, 0x00,
+  0xf2, 0x00, 0x03, 0x01, 0x00, 0x00, 0x10, 0x00, 0x27, 0x00, 0x3a, 0x00,
+  0x4a, 0x00, 0x5f, 0x00, 0x6e, 0x00, 0x7d, 0x00, 0x89, 0x00, 0x9e, 0x00,
+  0xaf, 0x00, 0xba, 0x00, 0xca, 0x00, 0xd9, 0x00, 0xe8, 0x00, 0xf5, 0x00,
+  0x01, 0x01, 0x12, 0x01, 0x22, 0x01, 0x32, 0x01, 0x3e, 0x01, 0x53, 0x01,
+  0x00, 0x00, 0x0e, 0x00, 0x1a, 0x00, 0x2f, 0x00, 0x3c, 0x00, 0x4c, 0x00,
+  0x59, 0x00, 0x64, 0x00, 0x76, 0x00, 0x80, 0x00, 0x8d, 0x00, 0x98, 0x00,
+  0xb0, 0x00, 0xc2, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1d, 0x00, 0x2b, 0x00,
+  0x43, 0x00, 0x52, 0x00, 0x5f, 0x00, 0x6e, 0x00, 0x7c, 0x00, 0x8b, 0x00,
+  0x9b, 0x00, 0xa7, 0x00, 0xb5, 0x00, 0xc0, 0x00, 0xcb, 0x00, 0xdb, 0x00,
+  0xe9, 0x00, 0xfc, 0x00, 0x0b, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x1c, 0x00,
+  0x28, 0x00, 0x36, 0x00, 0x45, 0x00, 0x56, 0x00, 0x61, 0x00, 0x70, 0x00,
+  0x80, 0x00, 0x8d, 0x00, 0x9c, 0x00, 0xad, 0x00, 0x00, 0x00, 0x13, 0x00,
+  0x22, 0x00, 0x30, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x21, 0x00, 0x2c, 0x00,
+  0x38, 0x00, 0x42, 0x00, 0x4d, 0x00, 0x58, 0x00, 0x64, 0x00, 0x73, 0x00,
+  0x88, 0x00, 0x93, 0x00, 0x00, 0x00, 0x10, 0x00, 0x1c, 0x00, 0x2a, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x1e, 0x00, 0x2c, 0x00, 0x39, 0x00, 0x44, 0x00,
+  0x4f, 0x00, 0x5c, 0x00, 0x70, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1c, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x19, 0x00, 0x27, 0x00, 0x34, 0x00, 0x3e, 0x00,
+  0x4c, 0x00, 0x5a, 0x00, 0x6b, 0x00, 0x79, 0x00, 0x84, 0x00, 0x93, 0x00,
+  0xa1, 0x00, 0xab, 0x00, 0xb9, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x1c, 0x00,
+  0x31, 0x00, 0x40, 0x00, 0x52, 0x00, 0x61, 0x00, 0x6b, 0x00, 0x00, 0x00,
+  0x1a, 0x00, 0x25, 0x00, 0x3a, 0x00, 0x4e, 0x00, 0x5e, 0x00, 0x68, 0x00,
+  0x73, 0x00, 0x83, 0x00, 0x94, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x18, 0x00,
+  0x22, 0x00, 0x2c, 0x00, 0x36, 0x00, 0x41, 0x00, 0x4e, 0x00, 0x5e, 0x00,
+  0x71, 0x00, 0x00, 0x00, 0x07, 0x00, 0x1a, 0x00, 0x26, 0x00, 0x33, 0x00,
+  0x3d, 0x00, 0x4d, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x18, 0x00, 0x28, 0x00,
+  0x37, 0x00, 0x47, 0x00, 0x52, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x14, 0x00,
+  0x20, 0x00, 0x31, 0x00, 0x3c, 0x00, 0x4c, 0x00, 0x5b, 0x00, 0x6c, 0x00,
+  0x00, 0x00, 0x1f, 0x00, 0x29, 0x00, 0x35, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x1b, 0x00, 0x2b, 0x00, 0x36, 0x00, 0x48, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x19, 0x00, 0x29, 0x00, 0x34, 0x00, 0x3f, 0x00, 0x4b, 0x00, 0x57, 0x00,
+  0x67, 0x00, 0x76, 0x00, 0x00, 0x00, 0x15, 0x00, 0x21, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x27, 0x00, 0x33, 0x00, 0x44, 0x00, 0x50, 0x00, 0x5a, 0x00,
+  0x66, 0x00, 0x72, 0x00, 0x7f, 0x00, 0x87, 0x00, 0x93, 0x00, 0x00, 0x00,
+  0x29, 0x00, 0x3f, 0x00, 0x4b, 0x00, 0x56, 0x00, 0x61, 0x00, 0x6b, 0x00,
+  0x77, 0x00, 0x83, 0x00, 0x8f, 0x00, 0x9d, 0x00, 0xab, 0x00, 0xb5, 0x00,
+  0xc1, 0x00, 0x00, 0x00, 0x11, 0x00, 0x27, 0x00, 0x2f, 0x00, 0x3e, 0x00,
+  0x49, 0x00, 0x55, 0x00, 0x61, 0x00, 0x6d, 0x00, 0x7b, 0x00, 0x88, 0x00,
+  0x94, 0x00, 0xa1, 0x00, 0xac, 0x00, 0xba, 0x00, 0xc5, 0x00, 0xcf, 0x00,
+  0xdc, 0x00, 0xed, 0x00, 0xfb, 0x00, 0x08, 0x01, 0x12, 0x01, 0x1f, 0x01,
+  0x00, 0x00, 0x23, 0x00, 0x2e, 0x00, 0x39, 0x00, 0x46, 0x00, 0x53, 0x00,
+  0x5e, 0x00, 0x6d, 0x00, 0x78, 0x00, 0x83, 0x00, 0x90, 0x00, 0x9f, 0x00,
+  0xac, 0x00, 0xba, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x35, 0x00,
+  0x41, 0x00, 0x4f, 0x00, 0x5d, 0x00, 0x6a, 0x00, 0x76, 0x00, 0x86, 0x00,
+  0x92, 0x00, 0x9e, 0x00, 0xaa, 0x00, 0xb9, 0x00, 0xc5, 0x00, 0xd4, 0x00,
+  0xe2, 0x00, 0xf0, 0x00, 0xfe, 0x00, 0x0c, 0x01, 0x1e, 0x01, 0x00, 0x00,
+  0x24, 0x00, 0x32, 0x00, 0x3e, 0x00, 0x4d, 0x00, 0x5a, 0x00, 0x6c, 0x00,
+  0x7b, 0x00, 0x85, 0x00, 0x92, 0x00, 0xa1, 0x00, 0xaf, 0x00, 0xbe, 0x00,
+  0xcb, 0x00, 0xd6, 0x00, 0xe3, 0x00, 0xf2, 0x00, 0x00, 0x01, 0x0c, 0x01,
+  0x19, 0x01, 0x27, 0x01, 0x35, 0x01, 0x43, 0x01, 0x51, 0x01, 0x5f, 0x01,
+  0x6e, 0x01, 0x7e, 0x01, 0x8e, 0x01, 0x9c, 0x01, 0xa8, 0x01, 0xb6, 0x01,
+  0xc2, 0x01, 0xd4, 0x01, 0xe0, 0x01, 0xec, 0x01, 0x00, 0x00, 0x23, 0x00,
+  0x34, 0x00, 0x3f, 0x00, 0x49, 0x00, 0x56, 0x00, 0x61, 0x00, 0x6e, 0x00,
+  0x78, 0x00, 0x82, 0x00, 0x90, 0x00, 0x9b, 0x00, 0xaa, 0x00, 0xb6, 0x00,
+  0xc4, 0x00, 0xd4, 0x00, 0xe0, 0x00, 0xf6, 0x00, 0x00, 0x00, 0x26, 0x00,
+  0x2e, 0x00, 0x3a, 0x00, 0x47, 0x00, 0x56, 0x00, 0x60, 0x00, 0x6d, 0x00,
+  0x7c, 0x00, 0x8b, 0x00, 0x9a, 0x00, 0xa8, 0x00, 0xb6, 0x00, 0xc1, 0x00,
+  0xcd, 0x00, 0xde, 0x00, 0xed, 0x00, 0xfb, 0x00, 0x07, 0x01, 0x15, 0x01,
+  0x24, 0x01, 0x30, 0x01, 0x40, 0x01, 0x4a, 0x01, 0x00, 0x00, 0x0d, 0x00,
+  0x1b, 0x00, 0x2d, 0x00, 0x38, 0x00, 0x49, 0x00, 0x58, 0x00, 0x68, 0x00,
+  0x7a, 0x00, 0x89, 0x00, 0x9e, 0x00, 0xaa, 0x00, 0xb8, 0x00, 0xcb, 0x00,
+  0xdb, 0x00, 0xe7, 0x00, 0xf2, 0x00, 0x01, 0x01, 0x0f, 0x01, 0x1e, 0x01,
+  0x2e, 0x01, 0x3a, 0x01, 0x49, 0x01, 0x54, 0x01, 0x5f, 0x01, 0x6c, 0x01,
+  0x7d, 0x01, 0x8d, 0x01, 0x99, 0x01, 0x00, 0x00, 0x28, 0x00, 0x33, 0x00,
+  0x41, 0x00, 0x4c, 0x00, 0x5e, 0x00, 0x6b, 0x00, 0x78, 0x00, 0x85, 0x00,
+  0x90, 0x00, 0xa3, 0x00, 0xb1, 0x00, 0xbf, 0x00, 0xce, 0x00, 0xd8, 0x00,
+  0xdf, 0x00, 0x00, 0x00, 0x26, 0x00, 0x35, 0x00, 0x4c, 0x00, 0x63, 0x00,
+  0x70, 0x00, 0x84, 0x00, 0x92, 0x00, 0xa4, 0x00, 0xb4, 0x00, 0xc1, 0x00,
+  0xd5, 0x00, 0xdf, 0x00, 0xea, 0x00, 0xfb, 0x00, 0x07, 0x01, 0x16, 0x01,
+  0x27, 0x01, 0x31, 0x01, 0x3d, 0x01, 0x4a, 0x01, 0x5c, 0x01, 0x6c, 0x01,
+  0x7c, 0x01, 0x86, 0x01, 0x91, 0x01, 0x9f, 0x01, 0xb0, 0x01, 0xbc, 0x01,
+  0xc8, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x16, 0x00, 0x20, 0x00, 0x2e, 0x00,
+  0x3e, 0x00, 0x4d, 0x00, 0x5a, 0x00, 0x65, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x1b, 0x00, 0x27, 0x00, 0x3a, 0x00, 0x49, 0x00, 0x5a, 0x00, 0x67, 0x00,
+  0x75, 0x00, 0x89, 0x00, 0x98, 0x00, 0xa7, 0x00, 0xb5, 0x00, 0xc5, 0x00,
+  0xd2, 0x00, 0xe1, 0x00, 0xee, 0x00, 0xfe, 0x00, 0x0b, 0x01, 0x1b, 0x01,
+  0x2a, 0x01, 0x36, 0x01, 0x45, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x1b, 0x00,
+  0x2a, 0x00, 0x34, 0x00, 0x3e, 0x00, 0x49, 0x00, 0x55, 0x00, 0x5f, 0x00,
+  0x6f, 0x00, 0x81, 0x00, 0x8b, 0x00, 0x97, 0x00, 0xa2, 0x00, 0xb3, 0x00,
+  0x00, 0x00, 0x11, 0x00, 0x26, 0x00, 0x34, 0x00, 0x46, 0x00, 0x54, 0x00,
+  0x65, 0x00, 0x7d, 0x00, 0x8c, 0x00, 0x9a, 0x00, 0xa5, 0x00, 0xb4, 0x00,
+  0xc5, 0x00, 0xd9, 0x00, 0xe7, 0x00, 0xf6, 0x00, 0x0a, 0x01, 0x15, 0x01,
+  0x27, 0x01, 0x00, 0x00, 0x0b, 0x00, 0x1a, 0x00, 0x2b, 0x00, 0x3b, 0x00,
+  0x48, 0x00, 0x00, 0x00, 0x14, 0x00, 0x24, 0x00, 0x00, 0x00, 0x11, 0x00,
+  0x1c, 0x00, 0x2b, 0x00, 0x39, 0x00, 0x44, 0x00, 0x52, 0x00, 0x5d, 0x00,
+  0x00, 0x00, 0x13, 0x00, 0x24, 0x00, 0x37, 0x00, 0x46, 0x00, 0x56, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x1f, 0x00, 0x2b, 0x00, 0x3b, 0x00, 0x45, 0x00,
+  0x50, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x22, 0x00, 0x30, 0x00, 0x43, 0x00,
+  0x53, 0x00, 0x61, 0x00, 0x77, 0x00, 0x81, 0x00, 0x00, 0x00, 0x0f, 0x00,
+  0x21, 0x00, 0x30, 0x00, 0x3d, 0x00, 0x4b, 0x00, 0x5a, 0x00, 0x6c, 0x00,
+  0x7e, 0x00, 0x8d, 0x00, 0x9a, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1f, 0x00,
+  0x2a, 0x00, 0x3d, 0x00, 0x47, 0x00, 0x56, 0x00, 0x6c, 0x00, 0x76, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x20, 0x00, 0x2f, 0x00, 0x3f, 0x00, 0x54, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x21, 0x00, 0x2e, 0x00, 0x3b, 0x00,
+  0x4c, 0x00, 0x5a, 0x00, 0x6a, 0x00, 0x77, 0x00, 0x83, 0x00, 0x91, 0x00,
+  0x9d, 0x00, 0xa7, 0x00, 0xb3, 0x00, 0xbe, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x15, 0x00, 0x26, 0x00, 0x31, 0x00, 0x3d, 0x00, 0x50, 0x00, 0x5f, 0x00,
+  0x6b, 0x00, 0x00, 0x00, 0x13, 0x00, 0x20, 0x00, 0x2f, 0x00, 0x41, 0x00,
+  0x51, 0x00, 0x5e, 0x00, 0x6b, 0x00, 0x7b, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x00, 0x00, 0x11, 0x00, 0x1c, 0x00, 0x28, 0x00, 0x39, 0x00, 0x44, 0x00,
+  0x55, 0x00, 0x61, 0x00, 0x6d, 0x00, 0x77, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x22, 0x00, 0x30, 0x00, 0x3b, 0x00, 0x46, 0x00, 0x52, 0x00, 0x69, 0x00,
+  0x78, 0x00, 0x8a, 0x00, 0x97, 0x00, 0x00, 0x00, 0x08, 0x00, 0x18, 0x00,
+  0x26, 0x00, 0x38, 0x00, 0x49, 0x00, 0x57, 0x00, 0x68, 0x00, 0x76, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x17, 0x00, 0x24, 0x00, 0x31, 0x00, 0x45, 0x00,
+  0x53, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x19, 0x00, 0x23, 0x00, 0x33, 0x00,
+  0x00, 0x00, 0x0b, 0x00, 0x16, 0x00, 0x23, 0x00, 0x2e, 0x00, 0x39, 0x00,
+  0x46, 0x00, 0x54, 0x00, 0x61, 0x00, 0x74, 0x00, 0x7f, 0x00, 0x92, 0x00,
+  0x9d, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x10, 0x00, 0x1c, 0x00, 0x2b, 0x00,
+  0x3a, 0x00, 0x48, 0x00, 0x53, 0x00, 0x64, 0x00, 0x6e, 0x00, 0x7b, 0x00,
+  0x88, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x24, 0x00, 0x30, 0x00, 0x3f, 0x00,
+  0x4d, 0x00, 0x5f, 0x00, 0x6b, 0x00, 0x76, 0x00, 0x81, 0x00, 0x92, 0x00,
+  0x9c, 0x00, 0xa9, 0x00, 0xb6, 0x00, 0xc4, 0x00, 0xd4, 0x00, 0xdf, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x1c, 0x00, 0x2a, 0x00, 0x36, 0x00, 0x47, 0x00,
+  0x59, 0x00, 0x68, 0x00, 0x7d, 0x00, 0x88, 0x00, 0x94, 0x00, 0xa0, 0x00,
+  0xab, 0x00, 0xb5, 0x00, 0xc2, 0x00, 0xd0, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x1a, 0x00, 0x25, 0x00, 0x34, 0x00, 0x41, 0x00, 0x4e, 0x00, 0x5a, 0x00,
+  0x66, 0x00, 0x75, 0x00, 0x82, 0x00, 0x92, 0x00, 0xa2, 0x00, 0xaf, 0x00,
+  0xbb, 0x00, 0xc7, 0x00, 0xd7, 0x00, 0xe3, 0x00, 0xf3, 0x00, 0x01, 0x01,
+  0x17, 0x01, 0x27, 0x01, 0x00, 0x00, 0x10, 0x00, 0x1c, 0x00, 0x35, 0x00,
+  0x43, 0x00, 0x4f, 0x00, 0x5b, 0x00, 0x68, 0x00, 0x73, 0x00, 0x7f, 0x00,
+  0x8b, 0x00, 0x97, 0x00, 0xa5, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1a, 0x00,
+  0x29, 0x00, 0x34, 0x00, 0x45, 0x00, 0x59, 0x00, 0x68, 0x00, 0x7a, 0x00,
+  0x8c, 0x00, 0x9e, 0x00, 0xad, 0x00, 0xbc, 0x00, 0xca, 0x00, 0xd5, 0x00,
+  0xe1, 0x00, 0xee, 0x00, 0x00, 0x01, 0x12, 0x01, 0x22, 0x01, 0x31, 0x01,
+  0x41, 0x01, 0x00, 0x00, 0x10, 0x00, 0x21, 0x00, 0x35, 0x00, 0x42, 0x00,
+  0x50, 0x00, 0x5e, 0x00, 0x68, 0x00, 0x80, 0x00, 0x8c, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x1a, 0x00, 0x2c, 0x00, 0x3c, 0x00, 0x4b, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x21, 0x00, 0x30, 0x00, 0x3d, 0x00, 0x4b, 0x00, 0x5a, 0x00,
+  0x72, 0x00, 0x7c, 0x00, 0x87, 0x00, 0x94, 0x00, 0xa4, 0x00, 0xb1, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x23, 0x00, 0x37, 0x00, 0x49, 0x00, 0x55, 0x00,
+  0x69, 0x00, 0x74, 0x00, 0x86, 0x00, 0x91, 0x00, 0x9f, 0x00, 0xb1, 0x00,
+  0xc2, 0x00, 0xcf, 0x00, 0xdb, 0x00, 0xe8, 0x00, 0xf2, 0x00, 0xfd, 0x00,
+  0x0e, 0x01, 0x1f, 0x01, 0x2f, 0x01, 0x3a, 0x01, 0x48, 0x01, 0x52, 0x01,
+  0x00, 0x00, 0x0c, 0x00, 0x1d, 0x00, 0x27, 0x00, 0x36, 0x00, 0x47, 0x00,
+  0x56, 0x00, 0x60, 0x00, 0x6f, 0x00, 0x7e, 0x00, 0x90, 0x00, 0xa0, 0x00,
+  0xaa, 0x00, 0xb5, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x14, 0x00, 0x21, 0x00,
+  0x33, 0x00, 0x41, 0x00, 0x4e, 0x00, 0x5d, 0x00, 0x6a, 0x00, 0x7d, 0x00,
+  0x8a, 0x00, 0x98, 0x00, 0xa4, 0x00, 0xb1, 0x00, 0xbf, 0x00, 0xcc, 0x00,
+  0xd7, 0x00, 0xe8, 0x00, 0xf4, 0x00, 0x01, 0x01, 0x11, 0x01, 0x00, 0x00,
+  0x11, 0x00, 0x20, 0x00, 0x30, 0x00, 0x3b, 0x00, 0x45, 0x00, 0x53, 0x00,
+  0x5f, 0x00, 0x6d, 0x00, 0x80, 0x00, 0x8e, 0x00, 0x9f, 0x00, 0x00, 0x00,
+  0x24, 0x00, 0x3c, 0x00, 0x4e, 0x00, 0x59, 0x00, 0x69, 0x00, 0x7c, 0x00,
+  0x8a, 0x00, 0x95, 0x00, 0xa6, 0x00, 0xb5, 0x00, 0xc7, 0x00, 0xd6, 0x00,
+  0xe1, 0x00, 0x00, 0x00, 0x12, 0x00, 0x20, 0x00, 0x32, 0x00, 0x45, 0x00,
+  0x56, 0x00, 0x00, 0x00, 0x11, 0x00, 0x21, 0x00, 0x33, 0x00, 0x45, 0x00,
+  0x50, 0x00, 0x5b, 0x00, 0x67, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x3f, 0x00,
+  0x50, 0x00, 0x5e, 0x00, 0x6c, 0x00, 0x7d, 0x00, 0x8c, 0x00, 0xa2, 0x00,
+  0xad, 0x00, 0xb8, 0x00, 0xcc, 0x00, 0xdc, 0x00, 0x00, 0x00, 0x23, 0x00,
+  0x43, 0x00, 0x4e, 0x00, 0x58, 0x00, 0x63, 0x00, 0x6d, 0x00, 0x7f, 0x00,
+  0x89, 0x00, 0x93, 0x00, 0xa4, 0x00, 0xb8, 0x00, 0x00, 0x00, 0x30, 0x00,
+  0x3d, 0x00, 0x4c, 0x00, 0x5d, 0x00, 0x68, 0x00, 0x73, 0x00, 0x86, 0x00,
+  0x94, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x46, 0x00, 0x55, 0x00, 0x62, 0x00,
+  0x71, 0x00, 0x7d, 0x00, 0x89, 0x00, 0x94, 0x00, 0xa9, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x1d, 0x00, 0x30, 0x00, 0x3e, 0x00, 0x4e, 0x00, 0x62, 0x00,
+  0x72, 0x00, 0x7d, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x1b, 0x00, 0x2f, 0x00,
+  0x3a, 0x00, 0x4a, 0x00, 0x00, 0x00, 0x23, 0x00, 0x2d, 0x00, 0x3c, 0x00,
+  0x48, 0x00, 0x56, 0x00, 0x64, 0x00, 0x6e, 0x00, 0x7d, 0x00, 0x97, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x2b, 0x00, 0x38, 0x00, 0x44, 0x00, 0x4f, 0x00,
+  0x5b, 0x00, 0x6b, 0x00, 0x75, 0x00, 0x81, 0x00, 0x00, 0x00, 0x23, 0x00,
+  0x30, 0x00, 0x3f, 0x00, 0x49, 0x00, 0x57, 0x00, 0x61, 0x00, 0x71, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x18, 0x00, 0x22, 0x00, 0x2c, 0x00, 0x3b, 0x00,
+  0x52, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x1a, 0x00, 0x26, 0x00, 0x37, 0x00,
+  0x41, 0x00, 0x00, 0x00, 0x13, 0x00, 0x27, 0x00, 0x39, 0x00, 0x45, 0x00,
+  0x52, 0x00, 0x5d, 0x00, 0x72, 0x00, 0x7e, 0x00, 0x89, 0x00, 0x95, 0x00,
+  0xa6, 0x00, 0xb1, 0x00, 0xc1, 0x00, 0xd1, 0x00, 0xde, 0x00, 0xe8, 0x00,
+  0xf7, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x1f, 0x00, 0x29, 0x00, 0x37, 0x00,
+  0x41, 0x00, 0x52, 0x00, 0x63, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x1a, 0x00,
+  0x26, 0x00, 0x31, 0x00, 0x3b, 0x00, 0x48, 0x00, 0x53, 0x00, 0x60, 0x00,
+  0x6e, 0x00, 0x7b, 0x00, 0x00, 0x00, 0x21, 0x00, 0x31, 0x00, 0x46, 0x00,
+  0x55, 0x00, 0x65, 0x00, 0x75, 0x00, 0x84, 0x00, 0x90, 0x00, 0x9f, 0x00,
+  0x00, 0x00, 0x21, 0x00, 0x2d, 0x00, 0x3e, 0x00, 0x4b, 0x00, 0x57, 0x00,
+  0x64, 0x00, 0x6f, 0x00, 0x7d, 0x00, 0x8b, 0x00, 0x9a, 0x00, 0xac, 0x00,
+  0xb8, 0x00, 0xc5, 0x00, 0xd0, 0x00, 0xdd, 0x00, 0xef, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x10, 0x00, 0x20, 0x00, 0x33, 0x00, 0x46, 0x00, 0x51, 0x00,
+  0x60, 0x00, 0x6d, 0x00, 0x77, 0x00, 0x8b, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x1f, 0x00, 0x3a, 0x00, 0x45, 0x00, 0x53, 0x00, 0x69, 0x00, 0x79, 0x00,
+  0x88, 0x00, 0x97, 0x00, 0xa3, 0x00, 0xaf, 0x00, 0xc0, 0x00, 0xcc, 0x00,
+  0xd8, 0x00, 0xe3, 0x00, 0xf2, 0x00, 0xff, 0x00, 0x0c, 0x01, 0x19, 0x01,
+  0x00, 0x00, 0x12, 0x00, 0x23, 0x00, 0x37, 0x00, 0x41, 0x00, 0x50, 0x00,
+  0x5e, 0x00, 0x6d, 0x00, 0x7c, 0x00, 0x8b, 0x00, 0x9a, 0x00, 0xac, 0x00,
+  0xb8, 0x00, 0xc7, 0x00, 0xd2, 0x00, 0xe8, 0x00, 0xf6, 0x00, 0x0d, 0x01,
+  0x00, 0x00, 0x0c, 0x00, 0x1b, 0x00, 0x26, 0x00, 0x36, 0x00, 0x41, 0x00,
+  0x52, 0x00, 0x63, 0x00, 0x6f, 0x00, 0x7a, 0x00, 0x88, 0x00, 0x98, 0x00,
+  0xa5, 0x00, 0xb5, 0x00, 0xc1, 0x00, 0xcd, 0x00, 0xd7, 0x00, 0xe4, 0x00,
+  0xf4, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1b, 0x00, 0x29, 0x00, 0x35, 0x00,
+  0x41, 0x00, 0x4b, 0x00, 0x59, 0x00, 0x68, 0x00, 0x73, 0x00, 0x84, 0x00,
+  0x91, 0x00, 0xa0, 0x00, 0xb1, 0x00, 0xbf, 0x00, 0xcb, 0x00, 0xda, 0x00,
+  0xe4, 0x00, 0xee, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1e, 0x00, 0x2e, 0x00,
+  0x47, 0x00, 0x53, 0x00, 0x60, 0x00, 0x6d, 0x00, 0x79, 0x00, 0x8b, 0x00,
+  0x9a, 0x00, 0xa7, 0x00, 0xb1, 0x00, 0xc3, 0x00, 0xd2, 0x00, 0xe2, 0x00,
+  0xf0, 0x00, 0xfe, 0x00, 0x0d, 0x01, 0x1c, 0x01, 0x29, 0x01, 0x38, 0x01,
+  0x47, 0x01, 0x5a, 0x01, 0x64, 0x01, 0x72, 0x01, 0x7e, 0x01, 0x92, 0x01,
+  0x9b, 0x01, 0x00, 0x00, 0x0d, 0x00, 0x18, 0x00, 0x24, 0x00, 0x33, 0x00,
+  0x42, 0x00, 0x4f, 0x00, 0x59, 0x00, 0x63, 0x00, 0x70, 0x00, 0x7b, 0x00,
+  0x88, 0x00, 0x96, 0x00, 0xa5, 0x00, 0xb3, 0x00, 0xc0, 0x00, 0xcb, 0x00,
+  0xd9, 0x00, 0xe8, 0x00, 0xf5, 0x00, 0x00, 0x00, 0x13, 0x00, 0x22, 0x00,
+  0x35, 0x00, 0x45, 0x00, 0x57, 0x00, 0x62, 0x00, 0x72, 0x00, 0x7d, 0x00,
+  0x8c, 0x00, 0x98, 0x00, 0xa6, 0x00, 0xb8, 0x00, 0xcd, 0x00, 0xde, 0x00,
+  0xf1, 0x00, 0x02, 0x01, 0x11, 0x01, 0x1f, 0x01, 0x33, 0x01, 0x40, 0x01,
+  0x4f, 0x01, 0x5e, 0x01, 0x71, 0x01, 0x00, 0x00, 0x0d, 0x00, 0x19, 0x00,
+  0x27, 0x00, 0x38, 0x00, 0x46, 0x00, 0x50, 0x00, 0x5b, 0x00, 0x69, 0x00,
+  0x77, 0x00, 0x85, 0x00, 0x00, 0x00, 0x12, 0x00, 0x1d, 0x00, 0x2d, 0x00,
+  0x39, 0x00, 0x48, 0x00, 0x55, 0x00, 0x60, 0x00, 0x71, 0x00, 0x7e, 0x00,
+  0x8f, 0x00, 0xa2, 0x00, 0xb3, 0x00, 0xc7, 0x00, 0xd2, 0x00, 0xdd, 0x00,
+  0xe8, 0x00, 0xf6, 0x00, 0x06, 0x01, 0x19, 0x01, 0x28, 0x01, 0x00, 0x00,
+  0x0c, 0x00, 0x18, 0x00, 0x27, 0x00, 0x37, 0x00, 0x43, 0x00, 0x53, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x24, 0x00, 0x2f, 0x00, 0x3c, 0x00, 0x47, 0x00,
+  0x55, 0x00, 0x62, 0x00, 0x6f, 0x00, 0x7b, 0x00, 0x8a, 0x00, 0x9c, 0x00,
+  0xaa, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x20, 0x00, 0x2f, 0x00, 0x3a, 0x00,
+  0x4d, 0x00, 0x5c, 0x00, 0x6e, 0x00, 0x80, 0x00, 0x8e, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x1e, 0x00, 0x29, 0x00, 0x37, 0x00, 0x4a, 0x00, 0x54, 0x00,
+  0x67, 0x00, 0x00, 0x00, 0x14, 0x00, 0x20, 0x00, 0x32, 0x00, 0x3f, 0x00,
+  0x4b, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x1e, 0x00, 0x31, 0x00, 0x47, 0x00,
+  0x5a, 0x00, 0x6d, 0x00, 0x78, 0x00, 0x89, 0x00, 0x00, 0x00, 0x13, 0x00,
+  0x32, 0x00, 0x3d, 0x00, 0x4b, 0x00, 0x56, 0x00, 0x63, 0x00, 0x78, 0x00,
+  0x8c, 0x00, 0x9c, 0x00, 0xae, 0x00, 0xbe, 0x00, 0x00, 0x00, 0x26, 0x00,
+  0x35, 0x00, 0x00, 0x00, 0x11, 0x00, 0x28, 0x00, 0x34, 0x00, 0x43, 0x00,
+  0x4e, 0x00, 0x61, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x2e, 0x00,
+  0x39, 0x00, 0x46, 0x00, 0x59, 0x00, 0x68, 0x00, 0x00, 0x00, 0x0f, 0x00,
+  0x1a, 0x00, 0x29, 0x00, 0x3a, 0x00, 0x4f, 0x00, 0x5a, 0x00, 0x6f, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x30, 0x00, 0x3e, 0x00, 0x4b, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x1f, 0x00, 0x2e, 0x00, 0x38, 0x00, 0x4b, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x22, 0x00, 0x2e, 0x00, 0x3a, 0x00, 0x48, 0x00, 0x5b, 0x00,
+  0x6d, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x1c, 0x00, 0x2d, 0x00,
+  0x3d, 0x00, 0x00, 0x00, 0x16, 0x00, 0x25, 0x00, 0x2f, 0x00, 0x3e, 0x00,
+  0x4f, 0x00, 0x61, 0x00, 0x74, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1a, 0x00,
+  0x27, 0x00, 0x31, 0x00, 0x3b, 0x00, 0x56, 0x00, 0x68, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x20, 0x00, 0x2c, 0x00, 0x37, 0x00, 0x43, 0x00, 0x4f, 0x00,
+  0x5b, 0x00, 0x69, 0x00, 0x7c, 0x00, 0x8d, 0x00, 0x9f, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x23, 0x00, 0x35, 0x00, 0x44, 0x00, 0x4f, 0x00, 0x58, 0x00,
+  0x6a, 0x00, 0x75, 0x00, 0x83, 0x00, 0x8d, 0x00, 0x00, 0x00, 0x0d, 0x00,
+  0x19, 0x00, 0x27, 0x00, 0x34, 0x00, 0x40, 0x00, 0x4e, 0x00, 0x5b, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x18, 0x00, 0x25, 0x00, 0x35, 0x00, 0x3d, 0x00,
+  0x4d, 0x00, 0x55, 0x00, 0x5d, 0x00, 0x6d, 0x00, 0x79, 0x00, 0x89, 0x00,
+  0xa0, 0x00, 0xaf, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x19, 0x00, 0x28, 0x00,
+  0x37, 0x00, 0x45, 0x00, 0x53, 0x00, 0x65, 0x00, 0x77, 0x00, 0x8d, 0x00,
+  0x9e, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x16, 0x00, 0x22, 0x00, 0x2f, 0x00,
+  0x39, 0x00, 0x45, 0x00, 0x55, 0x00, 0x61, 0x00, 0x73, 0x00, 0x7d, 0x00,
+  0x89, 0x00, 0x9b, 0x00, 0xab, 0x00, 0xba, 0x00, 0x00, 0x00, 0x0f, 0x00,
+  0x1d, 0x00, 0x2b, 0x00, 0x3c, 0x00, 0x4a, 0x00, 0x58, 0x00, 0x65, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x1a, 0x00, 0x2b, 0x00, 0x38, 0x00, 0x46, 0x00,
+  0x54, 0x00, 0x62, 0x00, 0x70, 0x00, 0x82, 0x00, 0x90, 0x00, 0x9d, 0x00,
+  0xab, 0x00, 0xba, 0x00, 0xc5, 0x00, 0xd3, 0x00, 0xdf, 0x00, 0xed, 0x00,
+  0xfb, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x17, 0x00, 0x24, 0x00, 0x33, 0x00,
+  0x3f, 0x00, 0x4b, 0x00, 0x57, 0x00, 0x62, 0x00, 0x6e, 0x00, 0x78, 0x00,
+  0x8a, 0x00, 0x9c, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x1e, 0x00, 0x33, 0x00,
+  0x45, 0x00, 0x54, 0x00, 0x64, 0x00, 0x6f, 0x00, 0x7b, 0x00, 0x8a, 0x00,
+  0x97, 0x00, 0xa5, 0x00, 0xb4, 0x00, 0xc4, 0x00, 0xce, 0x00, 0xdb, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x1d, 0x00, 0x2b, 0x00, 0x35, 0x00, 0x46, 0x00,
+  0x52, 0x00, 0x62, 0x00, 0x6f, 0x00, 0x80, 0x00, 0x8e, 0x00, 0x9b, 0x00,
+  0xa9, 0x00, 0xb6, 0x00, 0xc4, 0x00, 0xd2, 0x00, 0xdf, 0x00, 0xeb, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x18, 0x00, 0x25, 0x00, 0x36, 0x00,
+  0x42, 0x00, 0x4f, 0x00, 0x5c, 0x00, 0x66, 0x00, 0x73, 0x00, 0x7e, 0x00,
+  0x00, 0x00, 0x0f, 0x00, 0x1e, 0x00, 0x2a, 0x00, 0x39, 0x00, 0x49, 0x00,
+  0x5a, 0x00, 0x69, 0x00, 0x7d, 0x00, 0x8a, 0x00, 0x97, 0x00, 0xa8, 0x00,
+  0xb5, 0x00, 0xc7, 0x00, 0x00, 0x00, 0x11, 0x00, 0x1e, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x20, 0x00, 0x2f, 0x00, 0x3d, 0x00, 0x4b, 0x00, 0x57, 0x00,
+  0x63, 0x00, 0x72, 0x00, 0x83, 0x00, 0x92, 0x00, 0x00, 0x00, 0x0a, 0x00,
+  0x16, 0x00, 0x21, 0x00, 0x2d, 0x00, 0x3b, 0x00, 0x45, 0x00, 0x50, 0x00,
+  0x5f, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x22, 0x00, 0x31, 0x00, 0x42, 0x00,
+  0x50, 0x00, 0x5d, 0x00, 0x6f, 0x00, 0x7a, 0x00, 0x86, 0x00, 0x00, 0x00,
+  0x2c, 0x00, 0x3a, 0x00, 0x48, 0x00, 0x54, 0x00, 0x61, 0x00, 0x70, 0x00,
+  0x7d, 0x00, 0x88, 0x00, 0x95, 0x00, 0xa3, 0x00, 0xb1, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x15, 0x00, 0x20, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x11, 0x00,
+  0x1e, 0x00, 0x33, 0x00, 0x47, 0x00, 0x54, 0x00, 0x64, 0x00, 0x72, 0x00,
+  0x82, 0x00, 0x00, 0x00, 0x16, 0x00, 0x22, 0x00, 0x33, 0x00, 0x42, 0x00,
+  0x4f, 0x00, 0x62, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x32, 0x00, 0x3c, 0x00,
+  0x48, 0x00, 0x5a, 0x00, 0x68, 0x00, 0x7a, 0x00, 0x86, 0x00, 0x96, 0x00,
+  0xa1, 0x00, 0x00, 0x00, 0x25, 0x00, 0x39, 0x00, 0x5e, 0x00, 0x70, 0x00,
+  0x88, 0x00, 0x00, 0x00, 0x11, 0x00, 0x27, 0x00, 0x3a, 0x00, 0x50, 0x00,
+  0x5d, 0x00, 0x6b, 0x00, 0x00, 0x00, 0x11, 0x00, 0x29, 0x00, 0x3a, 0x00,
+  0x4b, 0x00, 0x5c, 0x00, 0x6b, 0x00, 0x7d, 0x00, 0x87, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x30, 0x00, 0x3d, 0x00, 0x4f, 0x00, 0x5a, 0x00, 0x66, 0x00,
+  0x77, 0x00, 0x81, 0x00, 0x00, 0x00, 0x18, 0x00, 0x2c, 0x00, 0x3f, 0x00,
+  0x4d, 0x00, 0x5e, 0x00, 0x68, 0x00, 0x7e, 0x00, 0x8f, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x27, 0x00, 0x3d, 0x00, 0x4c, 0x00, 0x5b, 0x00, 0x67, 0x00,
+  0x77, 0x00, 0x86, 0x00, 0x00, 0x00, 0x19, 0x00, 0x2f, 0x00, 0x3c, 0x00,
+  0x54, 0x00, 0x67, 0x00, 0x73, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x0f, 0x00,
+  0x21, 0x00, 0x2f, 0x00, 0x3b, 0x00, 0x53, 0x00, 0x6d, 0x00, 0x00, 0x00,
+  0x16, 0x00, 0x30, 0x00, 0x3f, 0x00, 0x4c, 0x00, 0x56, 0x00, 0x5e, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x19, 0x00, 0x24, 0x00, 0x35, 0x00, 0x46, 0x00,
+  0x54, 0x00, 0x66, 0x00, 0x79, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x15, 0x00,
+  0x26, 0x00, 0x33, 0x00, 0x47, 0x00, 0x53, 0x00, 0x5e, 0x00, 0x68, 0x00,
+  0x74, 0x00, 0x7e, 0x00, 0x89, 0x00, 0x94, 0x00, 0xa6, 0x00, 0xb2, 0x00,
+  0xbe, 0x00, 0x00, 0x00, 0x10, 0x00, 0x2f, 0x00, 0x3e, 0x00, 0x4e, 0x00,
+  0x58, 0x00, 0x68, 0x00, 0x78, 0x00, 0x86, 0x00, 0x91, 0x00, 0x9a, 0x00,
+  0xa5, 0x00, 0xad, 0x00, 0xb7, 0x00, 0xc6, 0x00, 0x00, 0x00, 0x1a, 0x00,
+  0x23, 0x00, 0x2f, 0x00, 0x3c, 0x00, 0x45, 0x00, 0x4f, 0x00, 0x5d, 0x00,
+  0x71, 0x00, 0x7f, 0x00, 0x8d, 0x00, 0x9c, 0x00, 0xa7, 0x00, 0xb2, 0x00,
+  0xbe, 0x00, 0xc9, 0x00, 0xd4, 0x00, 0xe2, 0x00, 0xef, 0x00, 0x00, 0x00,
+  0x23, 0x00, 0x3c, 0x00, 0x4a, 0x00, 0x58, 0x00, 0x65, 0x00, 0x6e, 0x00,
+  0x7e, 0x00, 0x86, 0x00, 0x92, 0x00, 0xaa, 0x00, 0xb2, 0x00, 0x00, 0x00,
+  0x18, 0x00, 0x26, 0x00, 0x35, 0x00, 0x41, 0x00, 0x4d, 0x00, 0x5b, 0x00,
+  0x67, 0x00, 0x73, 0x00, 0x7f, 0x00, 0x8a, 0x00, 0x9c, 0x00, 0xa8, 0x00,
+  0xb4, 0x00, 0xc1, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x14, 0x00, 0x1f, 0x00,
+  0x2e, 0x00, 0x3a, 0x00, 0x4a, 0x00, 0x56, 0x00, 0x66, 0x00, 0x70, 0x00,
+  0x7c, 0x00, 0x87, 0x00, 0x94, 0x00, 0x00, 0x00, 0x21, 0x00, 0x2e, 0x00,
+  0x39, 0x00, 0x44, 0x00, 0x51, 0x00, 0x5f, 0x00, 0x72, 0x00, 0x7c, 0x00,
+  0x87, 0x00, 0x96, 0x00, 0xa4, 0x00, 0xb5, 0x00, 0xc1, 0x00, 0xd1, 0x00,
+  0xdf, 0x00, 0xea, 0x00, 0xf8, 0x00, 0x07, 0x01, 0x11, 0x01, 0x22, 0x01,
+  0x2f, 0x01, 0x3d, 0x01, 0x48, 0x01, 0x00, 0x00, 0x0f, 0x00, 0x1e, 0x00,
+  0x2d, 0x00, 0x3c, 0x00, 0x48, 0x00, 0x57, 0x00, 0x66, 0x00, 0x7a, 0x00,
+  0x8c, 0x00, 0x00, 0x00, 0x26, 0x00, 0x3a, 0x00, 0x46, 0x00, 0x56, 0x00,
+  0x61, 0x00, 0x6d, 0x00, 0x79, 0x00, 0x84, 0x00, 0x97, 0x00, 0xa5, 0x00,
+  0xb6, 0x00, 0xc2, 0x00, 0xd0, 0x00, 0xdd, 0x00, 0xe9, 0x00, 0xfb, 0x00,
+  0x0d, 0x01, 0x20, 0x01, 0x2b, 0x01, 0x38, 0x01, 0x4f, 0x01, 0x62, 0x01,
+  0x6d, 0x01, 0x79, 0x01, 0x84, 0x01, 0x93, 0x01, 0x9e, 0x01, 0xa9, 0x01,
+  0xb5, 0x01, 0xc0, 0x01, 0xcd, 0x01, 0xda, 0x01, 0xe5, 0x01, 0x00, 0x00,
+  0x1a, 0x00, 0x2a, 0x00, 0x35, 0x00, 0x45, 0x00, 0x56, 0x00, 0x68, 0x00,
+  0x76, 0x00, 0x81, 0x00, 0x8e, 0x00, 0x9e, 0x00, 0xaa, 0x00, 0xb9, 0x00,
+  0xcb, 0x00, 0xda, 0x00, 0xe5, 0x00, 0xf2, 0x00, 0x07, 0x01, 0x00, 0x00,
+  0x2f, 0x00, 0x3d, 0x00, 0x4b, 0x00, 0x59, 0x00, 0x67, 0x00, 0x76, 0x00,
+  0x84, 0x00, 0x94, 0x00, 0xa1, 0x00, 0xaf, 0x00, 0xbe, 0x00, 0xcb, 0x00,
+  0xda, 0x00, 0xe9, 0x00, 0xf7, 0x00, 0x03, 0x01, 0x0f, 0x01, 0x1e, 0x01,
+  0x2b, 0x01, 0x39, 0x01, 0x46, 0x01, 0x4f, 0x01, 0x59, 0x01, 0x00, 0x00,
+  0x0d, 0x00, 0x1c, 0x00, 0x28, 0x00, 0x37, 0x00, 0x41, 0x00, 0x52, 0x00,
+  0x63, 0x00, 0x74, 0x00, 0x7d, 0x00, 0x8a, 0x00, 0x97, 0x00, 0xa3, 0x00,
+  0xb1, 0x00, 0xbf, 0x00, 0xd3, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x16, 0x00,
+  0x26, 0x00, 0x37, 0x00, 0x43, 0x00, 0x4d, 0x00, 0x5e, 0x00, 0x6f, 0x00,
+  0x7f, 0x00, 0x8b, 0x00, 0x9b, 0x00, 0xaa, 0x00, 0xb5, 0x00, 0xc5, 0x00,
+  0xd7, 0x00, 0xe6, 0x00, 0xf4, 0x00, 0x05, 0x01, 0x15, 0x01, 0x28, 0x01,
+  0x38, 0x01, 0x43, 0x01, 0x51, 0x01, 0x5b, 0x01, 0x6c, 0x01, 0x00, 0x00,
+  0x0e, 0x00, 0x31, 0x00, 0x4e, 0x00, 0x6f, 0x00, 0x7e, 0x00, 0x8c, 0x00,
+  0x97, 0x00, 0xa7, 0x00, 0xb2, 0x00, 0xc7, 0x00, 0xd2, 0x00, 0x00, 0x00,
+  0x23, 0x00, 0x41, 0x00, 0x67, 0x00, 0x73, 0x00, 0x84, 0x00, 0x9b, 0x00,
+  0xae, 0x00, 0xc1, 0x00, 0xcd, 0x00, 0xd9, 0x00, 0xeb, 0x00, 0xf8, 0x00,
+  0x00, 0x00, 0x23, 0x00, 0x32, 0x00, 0x3e, 0x00, 0x4a, 0x00, 0x5a, 0x00,
+  0x6b, 0x00, 0x76, 0x00, 0x82, 0x00, 0x8e, 0x00, 0x98, 0x00, 0xa3, 0x00,
+  0xad, 0x00, 0xba, 0x00, 0xc6, 0x00, 0xd1, 0x00, 0x00, 0x00, 0x12, 0x00,
+  0x21, 0x00, 0x34, 0x00, 0x47, 0x00, 0x57, 0x00, 0x6a, 0x00, 0x7a, 0x00,
+  0x8f, 0x00, 0xa4, 0x00, 0xaf, 0x00, 0xbc, 0x00, 0xca, 0x00, 0xd8, 0x00,
+  0x00, 0x00, 0x18, 0x00, 0x22, 0x00, 0x2e, 0x00, 0x38, 0x00, 0x47, 0x00,
+  0x57, 0x00, 0x65, 0x00, 0x75, 0x00, 0x87, 0x00, 0x00, 0x00, 0x15, 0x00,
+  0x27, 0x00, 0x3a, 0x00, 0x47, 0x00, 0x57, 0x00, 0x00, 0x00, 0x23, 0x00,
+  0x41, 0x00, 0x4e, 0x00, 0x5f, 0x00, 0x6e, 0x00, 0x7f, 0x00, 0x89, 0x00,
+  0x99, 0x00, 0x00, 0x00, 0x16, 0x00, 0x27, 0x00, 0x34, 0x00, 0x47, 0x00,
+  0x58, 0x00, 0x00, 0x00, 0x20, 0x00, 0x2f, 0x00, 0x3b, 0x00, 0x47, 0x00,
+  0x53, 0x00, 0x62, 0x00, 0x71, 0x00, 0x82, 0x00, 0x94, 0x00, 0xa2, 0x00,
+  0x00, 0x00, 0x0f, 0x00, 0x1b, 0x00, 0x26, 0x00, 0x30, 0x00, 0x3b, 0x00,
+  0x4a, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x19, 0x00, 0x2b, 0x00, 0x00, 0x00,
+  0x18, 0x00, 0x27, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x2a, 0x00,
+  0x37, 0x00, 0x43, 0x00, 0x54, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x26, 0x00,
+  0x35, 0x00, 0x44, 0x00, 0x5a, 0x00, 0x64, 0x00, 0x6f, 0x00, 0x00, 0x00,
+  0x1b, 0x00, 0x2c, 0x00, 0x49, 0x00, 0x69, 0x00, 0x74, 0x00, 0x7f, 0x00,
+  0x8d, 0x00, 0x9b, 0x00, 0x00, 0x00, 0x19, 0x00, 0x32, 0x00, 0x3d, 0x00,
+  0x4a, 0x00, 0x56, 0x00, 0x00, 0x00, 0x14, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x18, 0x00, 0x2a, 0x00, 0x39, 0x00, 0x49, 0x00, 0x54, 0x00, 0x5e, 0x00,
+  0x00, 0x00, 0x11, 0x00, 0x1b, 0x00, 0x28, 0x00, 0x34, 0x00, 0x3f, 0x00,
+  0x4b, 0x00, 0x61, 0x00, 0x6c, 0x00, 0x76, 0x00, 0x00, 0x00, 0x1e, 0x00,
+  0x30, 0x00, 0x4f, 0x00, 0x59, 0x00, 0x68, 0x00, 0x77, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x1e, 0x00, 0x38, 0x00, 0x49, 0x00, 0x59, 0x00, 0x66, 0x00,
+  0x74, 0x00, 0x81, 0x00, 0x8c, 0x00, 0x9f, 0x00, 0xab, 0x00, 0xb9, 0x00,
+  0x00, 0x00, 0x1f, 0x00, 0x39, 0x00, 0x51, 0x00, 0x5d, 0x00, 0x68, 0x00,
+  0x77, 0x00, 0x86, 0x00, 0x93, 0x00, 0xa1, 0x00, 0xb2, 0x00, 0xbd, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x21, 0x00, 0x37, 0x00, 0x47, 0x00, 0x56, 0x00,
+  0x64, 0x00, 0x6e, 0x00, 0x7a, 0x00, 0x87, 0x00, 0x92, 0x00, 0xa1, 0x00,
+  0x00, 0x00, 0x1d, 0x00, 0x28, 0x00, 0x34, 0x00, 0x44, 0x00, 0x4f, 0x00,
+  0x5a, 0x00, 0x6b, 0x00, 0x7b, 0x00, 0x88, 0x00, 0x96, 0x00, 0xa0, 0x00,
+  0xae, 0x00, 0xbc, 0x00, 0xc9, 0x00, 0xd8, 0x00, 0xea, 0x00, 0xf9, 0x00,
+  0x06, 0x01, 0x13, 0x01, 0x21, 0x01, 0x00, 0x00, 0x13, 0x00, 0x1f, 0x00,
+  0x2b, 0x00, 0x3c, 0x00, 0x51, 0x00, 0x5d, 0x00, 0x6c, 0x00, 0x77, 0x00,
+  0x83, 0x00, 0x8b, 0x00, 0x9d, 0x00, 0xa9, 0x00, 0xb7, 0x00, 0xc2, 0x00,
+  0xd4, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x2b, 0x00, 0x39, 0x00, 0x46, 0x00,
+  0x56, 0x00, 0x64, 0x00, 0x70, 0x00, 0x7b, 0x00, 0x89, 0x00, 0x91, 0x00,
+  0xa0, 0x00, 0xa8, 0x00, 0xb8, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x2b, 0x00,
+  0x3f, 0x00, 0x50, 0x00, 0x5b, 0x00, 0x67, 0x00, 0x75, 0x00, 0x84, 0x00,
+  0x93, 0x00, 0x9f, 0x00, 0xaf, 0x00, 0xbb, 0x00, 0xc8, 0x00, 0xd5, 0x00,
+  0xe1, 0x00, 0xec, 0x00, 0xf7, 0x00, 0x03, 0x01, 0x14, 0x01, 0x20, 0x01,
+  0x2c, 0x01, 0x38, 0x01, 0x47, 0x01, 0x53, 0x01, 0x60, 0x01, 0x6c, 0x01,
+  0x77, 0x01, 0x89, 0x01, 0x93, 0x01, 0xa5, 0x01, 0xb0, 0x01, 0xbb, 0x01,
+  0x00, 0x00, 0x1c, 0x00, 0x2c, 0x00, 0x3b, 0x00, 0x48, 0x00, 0x5c, 0x00,
+  0x68, 0x00, 0x76, 0x00, 0x80, 0x00, 0x8e, 0x00, 0x9a, 0x00, 0xae, 0x00,
+  0xba, 0x00, 0x00, 0x00, 0x11, 0x00, 0x1f, 0x00, 0x2d, 0x00, 0x37, 0x00,
+  0x48, 0x00, 0x57, 0x00, 0x66, 0x00, 0x76, 0x00, 0x83, 0x00, 0x91, 0x00,
+  0x9e, 0x00, 0xaa, 0x00, 0xb9, 0x00, 0xc7, 0x00, 0xd6, 0x00, 0xe5, 0x00,
+  0xf2, 0x00, 0x05, 0x01, 0x17, 0x01, 0x24, 0x01, 0x30, 0x01, 0x40, 0x01,
+  0x4f, 0x01, 0x00, 0x00, 0x1f, 0x00, 0x29, 0x00, 0x3c, 0x00, 0x4b, 0x00,
+  0x5f, 0x00, 0x6e, 0x00, 0x79, 0x00, 0x86, 0x00, 0x90, 0x00, 0x9f, 0x00,
+  0xab, 0x00, 0x00, 0x00, 0x11, 0x00, 0x22, 0x00, 0x30, 0x00, 0x3f, 0x00,
+  0x4e, 0x00, 0x5e, 0x00, 0x68, 0x00, 0x78, 0x00, 0x87, 0x00, 0x98, 0x00,
+  0xa7, 0x00, 0xb6, 0x00, 0xc5, 0x00, 0xd1, 0x00, 0xdb, 0x00, 0xea, 0x00,
+  0xfc, 0x00, 0x0d, 0x01, 0x1c, 0x01, 0x00, 0x00, 0x1a, 0x00, 0x34, 0x00,
+  0x5b, 0x00, 0x67, 0x00, 0x6f, 0x00, 0x7d, 0x00, 0x85, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x1a, 0x00, 0x2a, 0x00, 0x34, 0x00, 0x46, 0x00, 0x58, 0x00,
+  0x64, 0x00, 0x74, 0x00, 0x82, 0x00, 0x90, 0x00, 0xa0, 0x00, 0xad, 0x00,
+  0xb6, 0x00, 0xc0, 0x00, 0xc8, 0x00, 0xd6, 0x00, 0xdf, 0x00, 0xf3, 0x00,
+  0x04, 0x01, 0x10, 0x01, 0x22, 0x01, 0x2a, 0x01, 0x36, 0x01, 0x47, 0x01,
+  0x00, 0x00, 0x25, 0x00, 0x30, 0x00, 0x3a, 0x00, 0x49, 0x00, 0x58, 0x00,
+  0x65, 0x00, 0x79, 0x00, 0x88, 0x00, 0x97, 0x00, 0x00, 0x00, 0x1d, 0x00,
+  0x28, 0x00, 0x36, 0x00, 0x49, 0x00, 0x57, 0x00, 0x65, 0x00, 0x6f, 0x00,
+  0x7c, 0x00, 0x89, 0x00, 0x96, 0x00, 0xa9, 0x00, 0x00, 0x00, 0x0f, 0x00,
+  0x21, 0x00, 0x32, 0x00, 0x43, 0x00, 0x57, 0x00, 0x64, 0x00, 0x6f, 0x00,
+  0x7e, 0x00, 0x00, 0x00, 0x14, 0x00, 0x26, 0x00, 0x31, 0x00, 0x3d, 0x00,
+  0x4c, 0x00, 0x5c, 0x00, 0x71, 0x00, 0x81, 0x00, 0x92, 0x00, 0x9e, 0x00,
+  0xad, 0x00, 0xc3, 0x00, 0xd4, 0x00, 0xe8, 0x00, 0x00, 0x00, 0x0b, 0x00,
+  0x21, 0x00, 0x35, 0x00, 0x40, 0x00, 0x4a, 0x00, 0x56, 0x00, 0x62, 0x00,
+  0x72, 0x00, 0x80, 0x00, 0x8c, 0x00, 0x98, 0x00, 0xa2, 0x00, 0xac, 0x00,
+  0xb8, 0x00, 0xc5, 0x00, 0xd1, 0x00, 0xe8, 0x00, 0x00, 0x00, 0x11, 0x00,
+  0x25, 0x00, 0x30, 0x00, 0x3a, 0x00, 0x47, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x24, 0x00, 0x38, 0x00, 0x45, 0x00, 0x53, 0x00, 0x64, 0x00, 0x74, 0x00,
+  0x83, 0x00, 0x92, 0x00, 0xa1, 0x00, 0xab, 0x00, 0xb5, 0x00, 0xc2, 0x00,
+  0xd1, 0x00, 0xda, 0x00, 0xe6, 0x00, 0xf4, 0x00, 0x03, 0x01, 0x00, 0x00,
+  0x0e, 0x00, 0x1c, 0x00, 0x26, 0x00, 0x39, 0x00, 0x4b, 0x00, 0x59, 0x00,
+  0x64, 0x00, 0x00, 0x00, 0x10, 0x00, 0x1b, 0x00, 0x31, 0x00, 0x3d, 0x00,
+  0x4e, 0x00, 0x5f, 0x00, 0x6d, 0x00, 0x7e, 0x00, 0x8c, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x18, 0x00, 0x24, 0x00, 0x30, 0x00, 0x3a, 0x00, 0x45, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x1f, 0x00, 0x32, 0x00, 0x49, 0x00, 0x5c, 0x00,
+  0x6e, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x1d, 0x00, 0x26, 0x00, 0x32, 0x00,
+  0x47, 0x00, 0x53, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x18, 0x00, 0x23, 0x00,
+  0x00, 0x00, 0x0b, 0x00, 0x17, 0x00, 0x24, 0x00, 0x2f, 0x00, 0x41, 0x00,
+  0x52, 0x00, 0x62, 0x00, 0x73, 0x00, 0x7e, 0x00, 0x89, 0x00, 0x98, 0x00,
+  0xa7, 0x00, 0xb1, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x19, 0x00, 0x27, 0x00, 0x34, 0x00, 0x3f, 0x00, 0x4e, 0x00, 0x58, 0x00,
+  0x6a, 0x00, 0x7b, 0x00, 0x88, 0x00, 0x9b, 0x00, 0xae, 0x00, 0xc2, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x1b, 0x00, 0x2b, 0x00, 0x3b, 0x00, 0x49, 0x00,
+  0x58, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x17, 0x00, 0x22, 0x00, 0x2f, 0x00,
+  0x3b, 0x00, 0x46, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1a, 0x00,
+  0x2b, 0x00, 0x3c, 0x00, 0x50, 0x00, 0x00, 0x00, 0x11, 0x00, 0x1f, 0x00,
+  0x2d, 0x00, 0x3b, 0x00, 0x4b, 0x00, 0x59, 0x00, 0x67, 0x00, 0x75, 0x00,
+  0x83, 0x00, 0x8e, 0x00, 0x9b, 0x00, 0xa5, 0x00, 0x00, 0x00, 0x0b, 0x00,
+  0x15, 0x00, 0x21, 0x00, 0x2e, 0x00, 0x3f, 0x00, 0x4d, 0x00, 0x5c, 0x00,
+  0x68, 0x00, 0x74, 0x00, 0x80, 0x00, 0x91, 0x00, 0x9d, 0x00, 0xa9, 0x00,
+  0x00, 0x00, 0x18, 0x00, 0x23, 0x00, 0x32, 0x00, 0x3d, 0x00, 0x4a, 0x00,
+  0x58, 0x00, 0x64, 0x00, 0x70, 0x00, 0x7c, 0x00, 0x87, 0x00, 0x92, 0x00,
+  0x9d, 0x00, 0xa9, 0x00, 0xb5, 0x00, 0xc2, 0x00, 0xce, 0x00, 0xdb, 0x00,
+  0xe6, 0x00, 0xf2, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1d, 0x00,
+  0x2b, 0x00, 0x3a, 0x00, 0x4d, 0x00, 0x5b, 0x00, 0x69, 0x00, 0x77, 0x00,
+  0x86, 0x00, 0x96, 0x00, 0xa6, 0x00, 0xb0, 0x00, 0xbd, 0x00, 0xc8, 0x00,
+  0xd5, 0x00, 0xe2, 0x00, 0xef, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x18, 0x00,
+  0x25, 0x00, 0x37, 0x00, 0x49, 0x00, 0x58, 0x00, 0x67, 0x00, 0x77, 0x00,
+  0x84, 0x00, 0x92, 0x00, 0x9d, 0x00, 0xa9, 0x00, 0xb4, 0x00, 0xbe, 0x00,
+  0xcd, 0x00, 0xdb, 0x00, 0xe5, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x2a, 0x00,
+  0x39, 0x00, 0x45, 0x00, 0x51, 0x00, 0x60, 0x00, 0x6c, 0x00, 0x7c, 0x00,
+  0x88, 0x00, 0x94, 0x00, 0x9f, 0x00, 0xaa, 0x00, 0xb5, 0x00, 0xc0, 0x00,
+  0xc8, 0x00, 0xd3, 0x00, 0xdd, 0x00, 0xec, 0x00, 0xfb, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x18, 0x00, 0x27, 0x00, 0x32, 0x00, 0x3d, 0x00, 0x4c, 0x00,
+  0x5c, 0x00, 0x6b, 0x00, 0x7a, 0x00, 0x88, 0x00, 0x95, 0x00, 0xa3, 0x00,
+  0xb4, 0x00, 0xc3, 0x00, 0xd0, 0x00, 0xdb, 0x00, 0xe7, 0x00, 0xf2, 0x00,
+  0x01, 0x01, 0x0b, 0x01, 0x17, 0x01, 0x22, 0x01, 0x2e, 0x01, 0x39, 0x01,
+  0x44, 0x01, 0x54, 0x01, 0x65, 0x01, 0x00, 0x00, 0x0e, 0x00, 0x1f, 0x00,
+  0x2b, 0x00, 0x39, 0x00, 0x43, 0x00, 0x56, 0x00, 0x60, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x1b, 0x00, 0x28, 0x00, 0x34, 0x00, 0x40, 0x00, 0x4c, 0x00,
+  0x5b, 0x00, 0x69, 0x00, 0x78, 0x00, 0x86, 0x00, 0x91, 0x00, 0xa2, 0x00,
+  0xaf, 0x00, 0xc1, 0x00, 0xd4, 0x00, 0xe6, 0x00, 0xf3, 0x00, 0xfd, 0x00,
+  0x0b, 0x01, 0x19, 0x01, 0x24, 0x01, 0x33, 0x01, 0x45, 0x01, 0x51, 0x01,
+  0x61, 0x01, 0x00, 0x00, 0x1e, 0x00, 0x31, 0x00, 0x41, 0x00, 0x4c, 0x00,
+  0x5e, 0x00, 0x6c, 0x00, 0x7c, 0x00, 0x8a, 0x00, 0x95, 0x00, 0xa3, 0x00,
+  0xb4, 0x00, 0xc2, 0x00, 0x00, 0x00, 0x10, 0x00, 0x1e, 0x00, 0x2d, 0x00,
+  0x3b, 0x00, 0x49, 0x00, 0x5a, 0x00, 0x67, 0x00, 0x77, 0x00, 0x82, 0x00,
+  0x8c, 0x00, 0x96, 0x00, 0xa2, 0x00, 0xaa, 0x00, 0xb5, 0x00, 0xc3, 0x00,
+  0xd9, 0x00, 0xe5, 0x00, 0xf2, 0x00, 0x01, 0x01, 0x0d, 0x01, 0x00, 0x00,
+  0x0f, 0x00, 0x1d, 0x00, 0x28, 0x00, 0x32, 0x00, 0x3c, 0x00, 0x47, 0x00,
+  0x50, 0x00, 0x6a, 0x00, 0x75, 0x00, 0x80, 0x00, 0x8c, 0x00, 0x98, 0x00,
+  0xa2, 0x00, 0xac, 0x00, 0x00, 0x00, 0x13, 0x00, 0x29, 0x00, 0x37, 0x00,
+  0x48, 0x00, 0x54, 0x00, 0x60, 0x00, 0x68, 0x00, 0x7a, 0x00, 0x82, 0x00,
+  0x93, 0x00, 0x9c, 0x00, 0xac, 0x00, 0x00, 0x00, 0x17, 0x00, 0x2f, 0x00,
+  0x45, 0x00, 0x52, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1f, 0x00,
+  0x2a, 0x00, 0x37, 0x00, 0x46, 0x00, 0x54, 0x00, 0x5f, 0x00, 0x71, 0x00,
+  0x82, 0x00, 0x8c, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x25, 0x00, 0x32, 0x00,
+  0x47, 0x00, 0x5c, 0x00, 0x6c, 0x00, 0x84, 0x00, 0x00, 0x00, 0x1d, 0x00,
+  0x27, 0x00, 0x3a, 0x00, 0x4b, 0x00, 0x5d, 0x00, 0x69, 0x00, 0x79, 0x00,
+  0x85, 0x00, 0x90, 0x00, 0x9c, 0x00, 0xae, 0x00, 0xb8, 0x00, 0xc5, 0x00,
+  0xd4, 0x00, 0xf2, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1b, 0x00, 0x27, 0x00,
+  0x35, 0x00, 0x42, 0x00, 0x50, 0x00, 0x5e, 0x00, 0x6b, 0x00, 0x79, 0x00,
+  0x85, 0x00, 0x95, 0x00, 0xa1, 0x00, 0xb1, 0x00, 0xbe, 0x00, 0xcb, 0x00,
+  0xd8, 0x00, 0xe7, 0x00, 0xf7, 0x00, 0x02, 0x01, 0x0e, 0x01, 0x00, 0x00,
+  0x13, 0x00, 0x21, 0x00, 0x2c, 0x00, 0x39, 0x00, 0x44, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x1d, 0x00, 0x2e, 0x00, 0x41, 0x00, 0x51, 0x00, 0x00, 0x00,
+  0x1a, 0x00, 0x2a, 0x00, 0x3f, 0x00, 0x4d, 0x00, 0x59, 0x00, 0x6a, 0x00,
+  0x74, 0x00, 0x87, 0x00, 0x96, 0x00, 0xa6, 0x00, 0x00, 0x00, 0x1c, 0x00,
+  0x2c, 0x00, 0x3f, 0x00, 0x4c, 0x00, 0x58, 0x00, 0x64, 0x00, 0x70, 0x00,
+  0x7e, 0x00, 0x92, 0x00, 0x9c, 0x00, 0xaa, 0x00, 0xb4, 0x00, 0xc5, 0x00,
+  0xd0, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x28, 0x00, 0x39, 0x00, 0x45, 0x00,
+  0x00, 0x00, 0x16, 0x00, 0x2b, 0x00, 0x38, 0x00, 0x45, 0x00, 0x59, 0x00,
+  0x6b, 0x00, 0x79, 0x00, 0x87, 0x00, 0x00, 0x00, 0x16, 0x00, 0x24, 0x00,
+  0x33, 0x00, 0x46, 0x00, 0x54, 0x00, 0x60, 0x00, 0x72, 0x00, 0x7f, 0x00,
+  0x8d, 0x00, 0x00, 0x00, 0x12, 0x00, 0x24, 0x00, 0x33, 0x00, 0x47, 0x00,
+  0x52, 0x00, 0x60, 0x00, 0x00, 0x00, 0x10, 0x00, 0x23, 0x00, 0x2e, 0x00,
+  0x3c, 0x00, 0x48, 0x00, 0x58, 0x00, 0x63, 0x00, 0x72, 0x00, 0x86, 0x00,
+  0x00, 0x00, 0x2a, 0x00, 0x32, 0x00, 0x00, 0x00, 0x18, 0x00, 0x26, 0x00,
+  0x32, 0x00, 0x43, 0x00, 0x57, 0x00, 0x69, 0x00, 0x76, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x16, 0x00, 0x29, 0x00, 0x3c, 0x00, 0x4c, 0x00, 0x5a, 0x00,
+  0x00, 0x00, 0x0b, 0x00, 0x22, 0x00, 0x2d, 0x00, 0x43, 0x00, 0x52, 0x00,
+  0x5f, 0x00, 0x6b, 0x00, 0x7b, 0x00, 0x85, 0x00, 0x00, 0x00, 0x0d, 0x00,
+  0x18, 0x00, 0x23, 0x00, 0x33, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x0d, 0x00,
+  0x16, 0x00, 0x20, 0x00, 0x2e, 0x00, 0x3c, 0x00, 0x47, 0x00, 0x55, 0x00,
+  0x5d, 0x00, 0x6a, 0x00, 0x80, 0x00, 0x8d, 0x00, 0x9f, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x19, 0x00, 0x2b, 0x00, 0x3b, 0x00, 0x48, 0x00, 0x54, 0x00,
+  0x5e, 0x00, 0x6e, 0x00, 0x7b, 0x00, 0x89, 0x00, 0x94, 0x00, 0xa0, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x1e, 0x00, 0x2e, 0x00, 0x3b, 0x00, 0x4d, 0x00,
+  0x58, 0x00, 0x65, 0x00, 0x74, 0x00, 0x82, 0x00, 0x90, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x1d, 0x00, 0x2d, 0x00, 0x3a, 0x00, 0x49, 0x00, 0x57, 0x00,
+  0x60, 0x00, 0x6e, 0x00, 0x76, 0x00, 0x85, 0x00, 0x00, 0x00, 0x13, 0x00,
+  0x21, 0x00, 0x2e, 0x00, 0x43, 0x00, 0x4e, 0x00, 0x5c, 0x00, 0x6a, 0x00,
+  0x7e, 0x00, 0x8d, 0x00, 0x9b, 0x00, 0xa7, 0x00, 0xb6, 0x00, 0xc8, 0x00,
+  0xd4, 0x00, 0xdf, 0x00, 0xea, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x0b, 0x00,
+  0x15, 0x00, 0x22, 0x00, 0x33, 0x00, 0x41, 0x00, 0x4d, 0x00, 0x5c, 0x00,
+  0x6a, 0x00, 0x78, 0x00, 0x87, 0x00, 0x94, 0x00, 0x9f, 0x00, 0xae, 0x00,
+  0xb8, 0x00, 0xc3, 0x00, 0xcf, 0x00, 0xdd, 0x00, 0xe8, 0x00, 0x00, 0x00,
+  0x2e, 0x00, 0x44, 0x00, 0x5a, 0x00, 0x66, 0x00, 0x71, 0x00, 0x7d, 0x00,
+  0x8b, 0x00, 0x97, 0x00, 0xa6, 0x00, 0xb4, 0x00, 0xc2, 0x00, 0xce, 0x00,
+  0xd9, 0x00, 0x00, 0x00, 0x30, 0x00, 0x42, 0x00, 0x54, 0x00, 0x62, 0x00,
+  0x70, 0x00, 0x7b, 0x00, 0x89, 0x00, 0x97, 0x00, 0xa9, 0x00, 0xbc, 0x00,
+  0xd1, 0x00, 0xe9, 0x00, 0xf3, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1a, 0x00,
+  0x28, 0x00, 0x3b, 0x00, 0x49, 0x00, 0x53, 0x00, 0x61, 0x00, 0x6c, 0x00,
+  0x7c, 0x00, 0x8a, 0x00, 0x98, 0x00, 0xa7, 0x00, 0xb5, 0x00, 0xc2, 0x00,
+  0xd0, 0x00, 0xe2, 0x00, 0xf4, 0x00, 0x06, 0x01, 0x15, 0x01, 0x24, 0x01,
+  0x34, 0x01, 0x46, 0x01, 0x54, 0x01, 0x63, 0x01, 0x76, 0x01, 0x89, 0x01,
+  0x97, 0x01, 0xa4, 0x01, 0x00, 0x00, 0x0f, 0x00, 0x1a, 0x00, 0x2e, 0x00,
+  0x3b, 0x00, 0x4b, 0x00, 0x5a, 0x00, 0x69, 0x00, 0x81, 0x00, 0x94, 0x00,
+  0xa2, 0x00, 0x00, 0x00, 0x10, 0x00, 0x22, 0x00, 0x31, 0x00, 0x3f, 0x00,
+  0x4d, 0x00, 0x5c, 0x00, 0x6d, 0x00, 0x7e, 0x00, 0x8f, 0x00, 0x9d, 0x00,
+  0xac, 0x00, 0xb7, 0x00, 0xc3, 0x00, 0xd6, 0x00, 0xe1, 0x00, 0xf1, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x18, 0x00, 0x20, 0x00, 0x2e, 0x00, 0x46, 0x00,
+  0x5d, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x18, 0x00, 0x24, 0x00,
+  0x33, 0x00, 0x3f, 0x00, 0x4b, 0x00, 0x59, 0x00, 0x6c, 0x00, 0x77, 0x00,
+  0x82, 0x00, 0x94, 0x00, 0xa8, 0x00, 0xb9, 0x00, 0xcc, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x19, 0x00, 0x27, 0x00, 0x37, 0x00, 0x45, 0x00, 0x5c, 0x00,
+  0x00, 0x00, 0x0f, 0x00, 0x1d, 0x00, 0x2c, 0x00, 0x37, 0x00, 0x46, 0x00,
+  0x58, 0x00, 0x66, 0x00, 0x7e, 0x00, 0x90, 0x00, 0x9f, 0x00, 0xac, 0x00,
+  0x00, 0x00, 0x0b, 0x00, 0x1f, 0x00, 0x31, 0x00, 0x3f, 0x00, 0x4c, 0x00,
+  0x57, 0x00, 0x65, 0x00, 0x71, 0x00, 0x7b, 0x00, 0x88, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x1b, 0x00, 0x31, 0x00, 0x3c, 0x00, 0x51, 0x00, 0x5e, 0x00,
+  0x6f, 0x00, 0x83, 0x00, 0x95, 0x00, 0xa8, 0x00, 0xbc, 0x00, 0xc6, 0x00,
+  0x00, 0x00, 0x0b, 0x00, 0x17, 0x00, 0x27, 0x00, 0x34, 0x00, 0x45, 0x00,
+  0x50, 0x00, 0x5c, 0x00, 0x67, 0x00, 0x7a, 0x00, 0x86, 0x00, 0x97, 0x00,
+  0xa1, 0x00, 0xad, 0x00, 0xb7, 0x00, 0xc4, 0x00, 0xcf, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x23, 0x00, 0x31, 0x00, 0x45, 0x00, 0x58, 0x00, 0x67, 0x00,
+  0x78, 0x00, 0x87, 0x00, 0x9f, 0x00, 0xae, 0x00, 0xc0, 0x00, 0xcf, 0x00,
+  0x00, 0x00, 0x17, 0x00, 0x24, 0x00, 0x33, 0x00, 0x41, 0x00, 0x4f, 0x00,
+  0x5b, 0x00, 0x67, 0x00, 0x77, 0x00, 0x85, 0x00, 0x92, 0x00, 0xa0, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x20, 0x00, 0x31, 0x00, 0x47, 0x00, 0x59, 0x00,
+  0x64, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x19, 0x00, 0x25, 0x00, 0x38, 0x00,
+  0x46, 0x00, 0x59, 0x00, 0x69, 0x00, 0x7a, 0x00, 0x8a, 0x00, 0x97, 0x00,
+  0xa2, 0x00, 0xb4, 0x00, 0xc9, 0x00, 0xd8, 0x00, 0x00, 0x00, 0x0f, 0x00,
+  0x21, 0x00, 0x35, 0x00, 0x46, 0x00, 0x00, 0x00, 0x11, 0x00, 0x24, 0x00,
+  0x31, 0x00, 0x42, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x18, 0x00, 0x27, 0x00, 0x37, 0x00, 0x42, 0x00, 0x51, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1c, 0x00,
+  0x2b, 0x00, 0x35, 0x00, 0x46, 0x00, 0x54, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x14, 0x00, 0x1f, 0x00, 0x28, 0x00, 0x33, 0x00, 0x00, 0x00, 0x21, 0x00,
+  0x2d, 0x00, 0x42, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x19, 0x00, 0x2c, 0x00,
+  0x36, 0x00, 0x42, 0x00, 0x4c, 0x00, 0x5b, 0x00, 0x66, 0x00, 0x76, 0x00,
+  0x85, 0x00, 0x92, 0x00, 0xa5, 0x00, 0xb3, 0x00, 0xc2, 0x00, 0xdb, 0x00,
+  0xec, 0x00, 0xf7, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1c, 0x00, 0x2b, 0x00,
+  0x3b, 0x00, 0x49, 0x00, 0x52, 0x00, 0x62, 0x00, 0x71, 0x00, 0x7d, 0x00,
+  0x88, 0x00, 0x93, 0x00, 0x9e, 0x00, 0xaa, 0x00, 0xb4, 0x00, 0xc0, 0x00,
+  0xcd, 0x00, 0xde, 0x00, 0xef, 0x00, 0xfc, 0x00, 0x0a, 0x01, 0x18, 0x01,
+  0x00, 0x00, 0x21, 0x00, 0x2c, 0x00, 0x3b, 0x00, 0x4a, 0x00, 0x57, 0x00,
+  0x67, 0x00, 0x73, 0x00, 0x83, 0x00, 0x90, 0x00, 0x9c, 0x00, 0xaa, 0x00,
+  0xb3, 0x00, 0xbe, 0x00, 0xcb, 0x00, 0xdb, 0x00, 0xe6, 0x00, 0xf4, 0x00,
+  0xfe, 0x00, 0x0a, 0x01, 0x16, 0x01, 0x30, 0x01, 0x45, 0x01, 0x4f, 0x01,
+  0x00, 0x00, 0x10, 0x00, 0x1a, 0x00, 0x26, 0x00, 0x33, 0x00, 0x3e, 0x00,
+  0x4c, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1e, 0x00, 0x2a, 0x00, 0x39, 0x00,
+  0x48, 0x00, 0x5c, 0x00, 0x65, 0x00, 0x75, 0x00, 0x7d, 0x00, 0x85, 0x00,
+  0x93, 0x00, 0xa2, 0x00, 0x00, 0x00, 0x09, 0x00, 0x19, 0x00, 0x27, 0x00,
+  0x2f, 0x00, 0x3a, 0x00, 0x46, 0x00, 0x52, 0x00, 0x5c, 0x00, 0x66, 0x00,
+  0x70, 0x00, 0x7b, 0x00, 0x86, 0x00, 0x99, 0x00, 0xa3, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x1b, 0x00, 0x27, 0x00, 0x32, 0x00, 0x41, 0x00, 0x4d, 0x00,
+  0x58, 0x00, 0x65, 0x00, 0x71, 0x00, 0x79, 0x00, 0x8b, 0x00, 0x96, 0x00,
+  0xa1, 0x00, 0xb1, 0x00, 0xbd, 0x00, 0xcd, 0x00, 0xdf, 0x00, 0xed, 0x00,
+  0x00, 0x00, 0x0b, 0x00, 0x16, 0x00, 0x2d, 0x00, 0x39, 0x00, 0x47, 0x00,
+  0x53, 0x00, 0x61, 0x00, 0x6c, 0x00, 0x77, 0x00, 0x82, 0x00, 0x8d, 0x00,
+  0x9d, 0x00, 0xa9, 0x00, 0xbd, 0x00, 0xc7, 0x00, 0xd7, 0x00, 0xe5, 0x00,
+  0xf3, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1b, 0x00, 0x28, 0x00,
+  0x33, 0x00, 0x40, 0x00, 0x4c, 0x00, 0x59, 0x00, 0x6a, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x1a, 0x00, 0x28, 0x00, 0x37, 0x00, 0x45, 0x00, 0x56, 0x00,
+  0x65, 0x00, 0x72, 0x00, 0x7d, 0x00, 0x87, 0x00, 0x98, 0x00, 0xa8, 0x00,
+  0xb4, 0x00, 0xc2, 0x00, 0xd2, 0x00, 0xe0, 0x00, 0xec, 0x00, 0xf9, 0x00,
+  0x0c, 0x01, 0x1c, 0x01, 0x00, 0x00, 0x0a, 0x00, 0x1f, 0x00, 0x32, 0x00,
+  0x3f, 0x00, 0x4b, 0x00, 0x59, 0x00, 0x66, 0x00, 0x79, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x20, 0x00, 0x2f, 0x00, 0x3f, 0x00, 0x4f, 0x00, 0x5a, 0x00,
+  0x6c, 0x00, 0x7c, 0x00, 0x88, 0x00, 0x93, 0x00, 0x9d, 0x00, 0xad, 0x00,
+  0xb8, 0x00, 0xc6, 0x00, 0xd5, 0x00, 0xe6, 0x00, 0xee, 0x00, 0x01, 0x01,
+  0x11, 0x01, 0x21, 0x01, 0x2d, 0x01, 0x37, 0x01, 0x49, 0x01, 0x56, 0x01,
+  0x67, 0x01, 0x77, 0x01, 0x89, 0x01, 0x97, 0x01, 0xa5, 0x01, 0xb5, 0x01,
+  0xc5, 0x01, 0x00, 0x00, 0x08, 0x00, 0x18, 0x00, 0x2d, 0x00, 0x37, 0x00,
+  0x47, 0x00, 0x53, 0x00, 0x00, 0x00, 0x12, 0x00, 0x22, 0x00, 0x33, 0x00,
+  0x45, 0x00, 0x57, 0x00, 0x65, 0x00, 0x71, 0x00, 0x85, 0x00, 0x97, 0x00,
+  0xab, 0x00, 0xbc, 0x00, 0xce, 0x00, 0xda, 0x00, 0xe6, 0x00, 0xf2, 0x00,
+  0xfe, 0x00, 0x10, 0x01, 0x25, 0x01, 0x37, 0x01, 0x45, 0x01, 0x54, 0x01,
+  0x5e, 0x01, 0x70, 0x01, 0x81, 0x01, 0x94, 0x01, 0x00, 0x00, 0x13, 0x00,
+  0x20, 0x00, 0x2a, 0x00, 0x35, 0x00, 0x41, 0x00, 0x51, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x1a, 0x00, 0x25, 0x00, 0x30, 0x00, 0x3f, 0x00, 0x52, 0x00,
+  0x63, 0x00, 0x71, 0x00, 0x89, 0x00, 0x9b, 0x00, 0xaa, 0x00, 0xb8, 0x00,
+  0xc3, 0x00, 0xce, 0x00, 0x00, 0x00, 0x25, 0x00, 0x30, 0x00, 0x3c, 0x00,
+  0x45, 0x00, 0x53, 0x00, 0x5e, 0x00, 0x69, 0x00, 0x74, 0x00, 0x7f, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x1f, 0x00, 0x2b, 0x00, 0x3b, 0x00, 0x47, 0x00,
+  0x57, 0x00, 0x6d, 0x00, 0x7f, 0x00, 0x8a, 0x00, 0x9f, 0x00, 0xb2, 0x00,
+  0xc7, 0x00, 0xd5, 0x00, 0xe3, 0x00, 0xef, 0x00, 0x01, 0x01, 0x10, 0x01,
+  0x21, 0x01, 0x31, 0x01, 0x00, 0x00, 0x0e, 0x00, 0x1e, 0x00, 0x28, 0x00,
+  0x37, 0x00, 0x49, 0x00, 0x56, 0x00, 0x65, 0x00, 0x74, 0x00, 0x82, 0x00,
+  0x94, 0x00, 0x9f, 0x00, 0xab, 0x00, 0xbb, 0x00, 0xc8, 0x00, 0x00, 0x00,
+  0x1a, 0x00, 0x28, 0x00, 0x37, 0x00, 0x42, 0x00, 0x58, 0x00, 0x63, 0x00,
+  0x7b, 0x00, 0x91, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x1a, 0x00, 0x24, 0x00,
+  0x37, 0x00, 0x47, 0x00, 0x55, 0x00, 0x66, 0x00, 0x75, 0x00, 0x7f, 0x00,
+  0x8d, 0x00, 0x9c, 0x00, 0xab, 0x00, 0xba, 0x00, 0xcb, 0x00, 0xd9, 0x00,
+  0xe8, 0x00, 0xf6, 0x00, 0x04, 0x01, 0x13, 0x01, 0x22, 0x01, 0x30, 0x01,
+  0x43, 0x01, 0x50, 0x01, 0x60, 0x01, 0x6e, 0x01, 0x00, 0x00, 0x13, 0x00,
+  0x2a, 0x00, 0x3d, 0x00, 0x52, 0x00, 0x62, 0x00, 0x74, 0x00, 0x00, 0x00,
+  0x3e, 0x00, 0x55, 0x00, 0x64, 0x00, 0x73, 0x00, 0x83, 0x00, 0x92, 0x00,
+  0xa4, 0x00, 0xb5, 0x00, 0xc7, 0x00, 0xd9, 0x00, 0xe5, 0x00, 0xf5, 0x00,
+  0x08, 0x01, 0x16, 0x01, 0x22, 0x01, 0x2d, 0x01, 0x3b, 0x01, 0x4a, 0x01,
+  0x5b, 0x01, 0x6a, 0x01, 0x7c, 0x01, 0x8f, 0x01, 0x9e, 0x01, 0xa9, 0x01,
+  0x00, 0x00, 0x17, 0x00, 0x21, 0x00, 0x2b, 0x00, 0x35, 0x00, 0x41, 0x00,
+  0x5c, 0x00, 0x6a, 0x00, 0x00, 0x00, 0x11, 0x00, 0x21, 0x00, 0x32, 0x00,
+  0x45, 0x00, 0x57, 0x00, 0x64, 0x00, 0x75, 0x00, 0x00, 0x00, 0x31, 0x00,
+  0x46, 0x00, 0x54, 0x00, 0x62, 0x00, 0x70, 0x00, 0x7b, 0x00, 0x84, 0x00,
+  0x00, 0x00, 0x15, 0x00, 0x23, 0x00, 0x37, 0x00, 0x48, 0x00, 0x53, 0x00,
+  0x67, 0x00, 0x00, 0x00, 0x15, 0x00, 0x23, 0x00, 0x33, 0x00, 0x43, 0x00,
+  0x54, 0x00, 0x00, 0x00, 0x21, 0x00, 0x2c, 0x00, 0x42, 0x00, 0x4b, 0x00,
+  0x56, 0x00, 0x6c, 0x00, 0x74, 0x00, 0x7f, 0x00, 0x8c, 0x00, 0x00, 0x00,
+  0x16, 0x00, 0x30, 0x00, 0x3f, 0x00, 0x54, 0x00, 0x60, 0x00, 0x6b, 0x00,
+  0x7c, 0x00, 0x00, 0x00, 0x19, 0x00, 0x29, 0x00, 0x3b, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x15, 0x00, 0x22, 0x00, 0x35, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x1b, 0x00, 0x25, 0x00, 0x33, 0x00, 0x3e, 0x00, 0x57, 0x00, 0x70, 0x00,
+  0x00, 0x00, 0x27, 0x00, 0x31, 0x00, 0x3d, 0x00, 0x4f, 0x00, 0x5d, 0x00,
+  0x6a, 0x00, 0x77, 0x00, 0x8b, 0x00, 0x98, 0x00, 0xa6, 0x00, 0xb8, 0x00,
+  0xc9, 0x00, 0xd6, 0x00, 0xe6, 0x00, 0xf4, 0x00, 0x00, 0x00, 0x29, 0x00,
+  0x34, 0x00, 0x40, 0x00, 0x4b, 0x00, 0x59, 0x00, 0x6b, 0x00, 0x7f, 0x00,
+  0x8a, 0x00, 0x96, 0x00, 0xa3, 0x00, 0xae, 0x00, 0xb9, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x1a, 0x00, 0x26, 0x00, 0x38, 0x00, 0x48, 0x00, 0x54, 0x00,
+  0x5f, 0x00, 0x6a, 0x00, 0x76, 0x00, 0x80, 0x00, 0x8a, 0x00, 0x96, 0x00,
+  0xa5, 0x00, 0xb4, 0x00, 0x00, 0x00, 0x10, 0x00, 0x1b, 0x00, 0x26, 0x00,
+  0x33, 0x00, 0x3f, 0x00, 0x4b, 0x00, 0x59, 0x00, 0x67, 0x00, 0x72, 0x00,
+  0x81, 0x00, 0x8f, 0x00, 0x9e, 0x00, 0xb1, 0x00, 0xbf, 0x00, 0xcb, 0x00,
+  0xd7, 0x00, 0xe5, 0x00, 0xf3, 0x00, 0x00, 0x01, 0x0d, 0x01, 0x19, 0x01,
+  0x28, 0x01, 0x35, 0x01, 0x43, 0x01, 0x50, 0x01, 0x5b, 0x01, 0x68, 0x01,
+  0x7a, 0x01, 0x89, 0x01, 0x94, 0x01, 0x00, 0x00, 0x11, 0x00, 0x20, 0x00,
+  0x2e, 0x00, 0x3a, 0x00, 0x44, 0x00, 0x4e, 0x00, 0x59, 0x00, 0x63, 0x00,
+  0x70, 0x00, 0x82, 0x00, 0x9d, 0x00, 0xa7, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x18, 0x00, 0x29, 0x00, 0x31, 0x00, 0x43, 0x00, 0x51, 0x00, 0x5d, 0x00,
+  0x6f, 0x00, 0x7a, 0x00, 0x8e, 0x00, 0xa4, 0x00, 0xaf, 0x00, 0xb7, 0x00,
+  0xc7, 0x00, 0xda, 0x00, 0xeb, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x0b, 0x00,
+  0x17, 0x00, 0x25, 0x00, 0x31, 0x00, 0x3c, 0x00, 0x47, 0x00, 0x53, 0x00,
+  0x61, 0x00, 0x6e, 0x00, 0x79, 0x00, 0x85, 0x00, 0x91, 0x00, 0xa3, 0x00,
+  0xae, 0x00, 0xb9, 0x00, 0xc5, 0x00, 0xd1, 0x00, 0xdb, 0x00, 0xe6, 0x00,
+  0xf1, 0x00, 0xfb, 0x00, 0x08, 0x01, 0x12, 0x01, 0x21, 0x01, 0x2e, 0x01,
+  0x00, 0x00, 0x17, 0x00, 0x28, 0x00, 0x34, 0x00, 0x44, 0x00, 0x55, 0x00,
+  0x66, 0x00, 0x75, 0x00, 0x83, 0x00, 0x92, 0x00, 0xa6, 0x00, 0xb7, 0x00,
+  0xc7, 0x00, 0xda, 0x00, 0xea, 0x00, 0xf9, 0x00, 0x05, 0x01, 0x15, 0x01,
+  0x21, 0x01, 0x00, 0x00, 0x0e, 0x00, 0x1b, 0x00, 0x28, 0x00, 0x38, 0x00,
+  0x46, 0x00, 0x53, 0x00, 0x60, 0x00, 0x70, 0x00, 0x7e, 0x00, 0x8c, 0x00,
+  0x97, 0x00, 0xa7, 0x00, 0xb6, 0x00, 0xc4, 0x00, 0xd1, 0x00, 0xe0, 0x00,
+  0xee, 0x00, 0xfa, 0x00, 0x08, 0x01, 0x19, 0x01, 0x25, 0x01, 0x00, 0x00,
+  0x24, 0x00, 0x4d, 0x00, 0x5b, 0x00, 0x6a, 0x00, 0x7b, 0x00, 0x89, 0x00,
+  0x98, 0x00, 0xa3, 0x00, 0xad, 0x00, 0xbc, 0x00, 0xd4, 0x00, 0xe6, 0x00,
+  0xf4, 0x00, 0x06, 0x01, 0x00, 0x00, 0x15, 0x00, 0x25, 0x00, 0x38, 0x00,
+  0x47, 0x00, 0x58, 0x00, 0x69, 0x00, 0x71, 0x00, 0x83, 0x00, 0x8b, 0x00,
+  0x99, 0x00, 0xa9, 0x00, 0xb8, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x50, 0x00,
+  0x5c, 0x00, 0x68, 0x00, 0x70, 0x00, 0x81, 0x00, 0x92, 0x00, 0x9c, 0x00,
+  0xa7, 0x00, 0xaf, 0x00, 0xc6, 0x00, 0xd2, 0x00, 0xe2, 0x00, 0xf7, 0x00,
+  0x00, 0x00, 0x11, 0x00, 0x21, 0x00, 0x32, 0x00, 0x45, 0x00, 0x50, 0x00,
+  0x5f, 0x00, 0x6d, 0x00, 0x7b, 0x00, 0x87, 0x00, 0x95, 0x00, 0xa3, 0x00,
+  0xb4, 0x00, 0xc2, 0x00, 0xd0, 0x00, 0xe4, 0x00, 0xef, 0x00, 0x01, 0x01,
+  0x0e, 0x01, 0x1e, 0x01, 0x00, 0x00, 0x45, 0x00, 0x5a, 0x00, 0x67, 0x00,
+  0x76, 0x00, 0x89, 0x00, 0x93, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x1c, 0x00,
+  0x2a, 0x00, 0x3f, 0x00, 0x50, 0x00, 0x5f, 0x00, 0x6e, 0x00, 0x00, 0x00,
+  0x3e, 0x00, 0x78, 0x00, 0x8e, 0x00, 0xb7, 0x00, 0xc2, 0x00, 0xcd, 0x00,
+  0xd6, 0x00, 0xe1, 0x00, 0xf1, 0x00, 0xfb, 0x00, 0x08, 0x01, 0x14, 0x01,
+  0x00, 0x00, 0x36, 0x00, 0x4c, 0x00, 0x75, 0x00, 0x81, 0x00, 0x93, 0x00,
+  0x9e, 0x00, 0xac, 0x00, 0xbf, 0x00, 0xcb, 0x00, 0xdc, 0x00, 0xed, 0x00,
+  0xf8, 0x00, 0x09, 0x01, 0x18, 0x01, 0x23, 0x01, 0x2e, 0x01, 0x40, 0x01,
+  0x55, 0x01, 0x00, 0x00, 0x09, 0x00, 0x17, 0x00, 0x23, 0x00, 0x33, 0x00,
+  0x41, 0x00, 0x4d, 0x00, 0x5e, 0x00, 0x6e, 0x00, 0x88, 0x00, 0x95, 0x00,
+  0xa3, 0x00, 0xb0, 0x00, 0xbe, 0x00, 0xcf, 0x00, 0x00, 0x00, 0x24, 0x00,
+  0x36, 0x00, 0x47, 0x00, 0x52, 0x00, 0x64, 0x00, 0x77, 0x00, 0x8b, 0x00,
+  0x94, 0x00, 0xa5, 0x00, 0xb3, 0x00, 0xc6, 0x00, 0xd3, 0x00, 0xe5, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x1c, 0x00, 0x27, 0x00, 0x35, 0x00, 0x43, 0x00,
+  0x4e, 0x00, 0x5b, 0x00, 0x66, 0x00, 0x78, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x1b, 0x00, 0x27, 0x00, 0x3d, 0x00, 0x50, 0x00, 0x5c, 0x00, 0x6c, 0x00,
+  0x7b, 0x00, 0x8e, 0x00, 0xa2, 0x00, 0xad, 0x00, 0xb8, 0x00, 0x00, 0x00,
+  0x24, 0x00, 0x38, 0x00, 0x4f, 0x00, 0x5c, 0x00, 0x6b, 0x00, 0x7d, 0x00,
+  0x8f, 0x00, 0xa1, 0x00, 0xb1, 0x00, 0xc3, 0x00, 0xce, 0x00, 0xdb, 0x00,
+  0xeb, 0x00, 0xf9, 0x00, 0x0b, 0x01, 0x1d, 0x01, 0x2c, 0x01, 0x00, 0x00,
+  0x17, 0x00, 0x32, 0x00, 0x44, 0x00, 0x50, 0x00, 0x5c, 0x00, 0x67, 0x00,
+  0x72, 0x00, 0x7e, 0x00, 0x91, 0x00, 0x9c, 0x00, 0xad, 0x00, 0xb7, 0x00,
+  0xc3, 0x00, 0xe0, 0x00, 0xf1, 0x00, 0x00, 0x00, 0x12, 0x00, 0x24, 0x00,
+  0x36, 0x00, 0x41, 0x00, 0x54, 0x00, 0x60, 0x00, 0x71, 0x00, 0x83, 0x00,
+  0x00, 0x00, 0x16, 0x00, 0x2b, 0x00, 0x38, 0x00, 0x46, 0x00, 0x53, 0x00,
+  0x61, 0x00, 0x6f, 0x00, 0x82, 0x00, 0x91, 0x00, 0xa2, 0x00, 0xaf, 0x00,
+  0xbd, 0x00, 0xcc, 0x00, 0x00, 0x00, 0x24, 0x00, 0x39, 0x00, 0x64, 0x00,
+  0x6f, 0x00, 0x7f, 0x00, 0x91, 0x00, 0x9b, 0x00, 0xac, 0x00, 0xbe, 0x00,
+  0xcc, 0x00, 0x00, 0x00, 0x15, 0x00, 0x25, 0x00, 0x35, 0x00, 0x45, 0x00,
+  0x53, 0x00, 0x5e, 0x00, 0x6e, 0x00, 0x79, 0x00, 0x8a, 0x00, 0x98, 0x00,
+  0xa8, 0x00, 0xb3, 0x00, 0xc2, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x32, 0x00,
+  0x00, 0x00, 0x14, 0x00, 0x24, 0x00, 0x2e, 0x00, 0x40, 0x00, 0x54, 0x00,
+  0x61, 0x00, 0x72, 0x00, 0x84, 0x00, 0x96, 0x00, 0xa1, 0x00, 0xb2, 0x00,
+  0xc5, 0x00, 0xd1, 0x00, 0x00, 0x00, 0x19, 0x00, 0x4a, 0x00, 0x54, 0x00,
+  0x5f, 0x00, 0x68, 0x00, 0x7e, 0x00, 0x8c, 0x00, 0xa3, 0x00, 0xae, 0x00,
+  0x00, 0x00, 0x21, 0x00, 0x2c, 0x00, 0x36, 0x00, 0x44, 0x00, 0x4f, 0x00,
+  0x5f, 0x00, 0x71, 0x00, 0x7d, 0x00, 0x97, 0x00, 0x00, 0x00, 0x1f, 0x00,
+  0x2d, 0x00, 0x38, 0x00, 0x43, 0x00, 0x00, 0x00, 0x17, 0x00, 0x28, 0x00,
+  0x31, 0x00, 0x42, 0x00, 0x52, 0x00, 0x61, 0x00, 0x6f, 0x00, 0x7b, 0x00,
+  0x86, 0x00, 0x94, 0x00, 0x9f, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x16, 0x00,
+  0x21, 0x00, 0x2f, 0x00, 0x3c, 0x00, 0x48, 0x00, 0x57, 0x00, 0x6a, 0x00,
+  0x76, 0x00, 0x81, 0x00, 0x8f, 0x00, 0x9a, 0x00, 0xa4, 0x00, 0xaf, 0x00,
+  0xba, 0x00, 0xc9, 0x00, 0xdc, 0x00, 0xe9, 0x00, 0xf5, 0x00, 0x00, 0x01,
+  0x0b, 0x01, 0x17, 0x01, 0x24, 0x01, 0x2f, 0x01, 0x00, 0x00, 0x22, 0x00,
+  0x34, 0x00, 0x43, 0x00, 0x4e, 0x00, 0x5d, 0x00, 0x6d, 0x00, 0x7d, 0x00,
+  0x88, 0x00, 0x93, 0x00, 0xa0, 0x00, 0xac, 0x00, 0xb7, 0x00, 0xc3, 0x00,
+  0xcd, 0x00, 0xdd, 0x00, 0x00, 0x00, 0x10, 0x00, 0x1d, 0x00, 0x2d, 0x00,
+  0x3f, 0x00, 0x4d, 0x00, 0x5e, 0x00, 0x69, 0x00, 0x76, 0x00, 0x84, 0x00,
+  0x8f, 0x00, 0xa0, 0x00, 0xaf, 0x00, 0xbe, 0x00, 0xce, 0x00, 0xde, 0x00,
+  0xf3, 0x00, 0x00, 0x01, 0x00, 0x00, 0x1b, 0x00, 0x27, 0x00, 0x32, 0x00,
+  0x45, 0x00, 0x53, 0x00, 0x5f, 0x00, 0x6c, 0x00, 0x78, 0x00, 0x82, 0x00,
+  0x8d, 0x00, 0x9a, 0x00, 0xab, 0x00, 0xbb, 0x00, 0xc7, 0x00, 0xd9, 0x00,
+  0xeb, 0x00, 0xf7, 0x00, 0x00, 0x00, 0x12, 0x00, 0x29, 0x00, 0x42, 0x00,
+  0x68, 0x00, 0x97, 0x00, 0xa2, 0x00, 0xad, 0x00, 0xbe, 0x00, 0xca, 0x00,
+  0xd7, 0x00, 0xe7, 0x00, 0xf3, 0x00, 0x01, 0x01, 0x0f, 0x01, 0x1b, 0x01,
+  0x29, 0x01, 0x34, 0x01, 0x40, 0x01, 0x4b, 0x01, 0x57, 0x01, 0x63, 0x01,
+  0x72, 0x01, 0x81, 0x01, 0x91, 0x01, 0xa1, 0x01, 0xae, 0x01, 0xba, 0x01,
+  0xc6, 0x01, 0xd1, 0x01, 0xdc, 0x01, 0xe6, 0x01, 0xf3, 0x01, 0x00, 0x02,
+  0x0b, 0x02, 0x16, 0x02, 0x26, 0x02, 0x00, 0x00, 0x1b, 0x00, 0x3d, 0x00,
+  0x5b, 0x00, 0x7b, 0x00, 0xaf, 0x00, 0xc0, 0x00, 0xd2, 0x00, 0xdd, 0x00,
+  0xec, 0x00, 0xfd, 0x00, 0x0a, 0x01, 0x17, 0x01, 0x23, 0x01, 0x2d, 0x01,
+  0x3a, 0x01, 0x46, 0x01, 0x52, 0x01, 0x5e, 0x01, 0x6f, 0x01, 0x00, 0x00,
+  0x0b, 0x00, 0x30, 0x00, 0x42, 0x00, 0x5d, 0x00, 0x88, 0x00, 0x97, 0x00,
+  0xa3, 0x00, 0xb0, 0x00, 0xc0, 0x00, 0xcd, 0x00, 0xdb, 0x00, 0xe9, 0x00,
+  0xf8, 0x00, 0x07, 0x01, 0x16, 0x01, 0x25, 0x01, 0x37, 0x01, 0x42, 0x01,
+  0x4f, 0x01, 0x5e, 0x01, 0x71, 0x01, 0x00, 0x00, 0x12, 0x00, 0x33, 0x00,
+  0x50, 0x00, 0x63, 0x00, 0x70, 0x00, 0x7e, 0x00, 0x89, 0x00, 0x9b, 0x00,
+  0xa9, 0x00, 0xb4, 0x00, 0xc1, 0x00, 0xd1, 0x00, 0xe2, 0x00, 0xf1, 0x00,
+  0x00, 0x01, 0x0e, 0x01, 0x1a, 0x01, 0x25, 0x01, 0x32, 0x01, 0x41, 0x01,
+  0x52, 0x01, 0x60, 0x01, 0x71, 0x01, 0x7f, 0x01, 0x92, 0x01, 0xa0, 0x01,
+  0xb1, 0x01, 0x00, 0x00, 0x1f, 0x00, 0x36, 0x00, 0x44, 0x00, 0x65, 0x00,
+  0x98, 0x00, 0xa7, 0x00, 0xb4, 0x00, 0xc7, 0x00, 0xd7, 0x00, 0xe8, 0x00,
+  0xf8, 0x00, 0x0c, 0x01, 0x00, 0x00, 0x12, 0x00, 0x24, 0x00, 0x4f, 0x00,
+  0x71, 0x00, 0xaf, 0x00, 0xbe, 0x00, 0xc8, 0x00, 0xd7, 0x00, 0xe2, 0x00,
+  0xed, 0x00, 0xf7, 0x00, 0x05, 0x01, 0x15, 0x01, 0x26, 0x01, 0x37, 0x01,
+  0x46, 0x01, 0x57, 0x01, 0x66, 0x01, 0x76, 0x01, 0x87, 0x01, 0x93, 0x01,
+  0xa1, 0x01, 0xb5, 0x01, 0xc7, 0x01, 0x00, 0x00, 0x15, 0x00, 0x32, 0x00,
+  0x4b, 0x00, 0x70, 0x00, 0xaa, 0x00, 0xd1, 0x00, 0xdc, 0x00, 0xf2, 0x00,
+  0x05, 0x01, 0x16, 0x01, 0x23, 0x01, 0x36, 0x01, 0x4b, 0x01, 0x55, 0x01,
+  0x5e, 0x01, 0x68, 0x01, 0x79, 0x01, 0x84, 0x01, 0x00, 0x00, 0x1c, 0x00,
+  0x35, 0x00, 0x4b, 0x00, 0x62, 0x00, 0x8f, 0x00, 0x9f, 0x00, 0xb2, 0x00,
+  0xc5, 0x00, 0xd7, 0x00, 0xe1, 0x00, 0xec, 0x00, 0xfe, 0x00, 0x0e, 0x01,
+  0x1a, 0x01, 0x26, 0x01, 0x36, 0x01, 0x41, 0x01, 0x55, 0x01, 0x61, 0x01,
+  0x6b, 0x01, 0x7e, 0x01, 0x8a, 0x01, 0x9d, 0x01, 0xab, 0x01, 0x00, 0x00,
+  0x16, 0x00, 0x28, 0x00, 0x3b, 0x00, 0x45, 0x00, 0x53, 0x00, 0x66, 0x00,
+  0x73, 0x00, 0x82, 0x00, 0x91, 0x00, 0xa5, 0x00, 0xb2, 0x00, 0xc2, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x2b, 0x00, 0x41, 0x00, 0x4c, 0x00, 0x58, 0x00,
+  0x67, 0x00, 0x75, 0x00, 0x80, 0x00, 0x8b, 0x00, 0x9a, 0x00, 0xa5, 0x00,
+  0xb3, 0x00, 0xc3, 0x00, 0xd6, 0x00, 0xed, 0x00, 0xf8, 0x00, 0x05, 0x01,
+  0x12, 0x01, 0x00, 0x00, 0x16, 0x00, 0x28, 0x00, 0x43, 0x00, 0x4f, 0x00,
+  0x5a, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x2b, 0x00, 0x41, 0x00, 0x4d, 0x00,
+  0x59, 0x00, 0x64, 0x00, 0x7b, 0x00, 0x8c, 0x00, 0x96, 0x00, 0xa2, 0x00,
+  0xae, 0x00, 0x00, 0x00, 0x19, 0x00, 0x3d, 0x00, 0x75, 0x00, 0x83, 0x00,
+  0x91, 0x00, 0x9c, 0x00, 0xa7, 0x00, 0xb6, 0x00, 0xc3, 0x00, 0xd1, 0x00,
+  0xda, 0x00, 0xe7, 0x00, 0x00, 0x00, 0x26, 0x00, 0x41, 0x00, 0x7d, 0x00,
+  0xb0, 0x00, 0xc1, 0x00, 0xcc, 0x00, 0xdd, 0x00, 0xec, 0x00, 0xfd, 0x00,
+  0x0b, 0x01, 0x18, 0x01, 0x25, 0x01, 0x30, 0x01, 0x3c, 0x01, 0x4f, 0x01,
+  0x00, 0x00, 0x17, 0x00, 0x2b, 0x00, 0x42, 0x00, 0x51, 0x00, 0x60, 0x00,
+  0x6c, 0x00, 0x7a, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x2d, 0x00,
+  0x65, 0x00, 0x79, 0x00, 0x89, 0x00, 0x99, 0x00, 0xa8, 0x00, 0xb7, 0x00,
+  0xc8, 0x00, 0xd7, 0x00, 0xea, 0x00, 0xf8, 0x00, 0x08, 0x01, 0x17, 0x01,
+  0x2a, 0x01, 0x39, 0x01, 0x48, 0x01, 0x00, 0x00, 0x20, 0x00, 0x33, 0x00,
+  0x52, 0x00, 0x6b, 0x00, 0x7d, 0x00, 0x8c, 0x00, 0x9e, 0x00, 0xab, 0x00,
+  0xbb, 0x00, 0xc6, 0x00, 0xd6, 0x00, 0x00, 0x00, 0x20, 0x00, 0x3d, 0x00,
+  0x62, 0x00, 0x8c, 0x00, 0xa7, 0x00, 0xba, 0x00, 0xc9, 0x00, 0xdb, 0x00,
+  0xea, 0x00, 0xf9, 0x00, 0x04, 0x01, 0x00, 0x00, 0x1c, 0x00, 0x37, 0x00,
+  0x49, 0x00, 0x60, 0x00, 0x72, 0x00, 0x8d, 0x00, 0x9f, 0x00, 0xac, 0x00,
+  0xba, 0x00, 0xc9, 0x00, 0xd8, 0x00, 0xe4, 0x00, 0xf2, 0x00, 0xfd, 0x00,
+  0x0a, 0x01, 0x1d, 0x01, 0x2e, 0x01, 0x00, 0x00, 0x20, 0x00, 0x2e, 0x00,
+  0x45, 0x00, 0x74, 0x00, 0x86, 0x00, 0x9a, 0x00, 0xa7, 0x00, 0xb1, 0x00,
+  0xc0, 0x00, 0xcc, 0x00, 0xde, 0x00, 0xf0, 0x00, 0x02, 0x01, 0x14, 0x01,
+  0x25, 0x01, 0x00, 0x00, 0x18, 0x00, 0x28, 0x00, 0x3f, 0x00, 0x5a, 0x00,
+  0x70, 0x00, 0x9f, 0x00, 0xaa, 0x00, 0xb5, 0x00, 0xc5, 0x00, 0xd3, 0x00,
+  0xe7, 0x00, 0x00, 0x00, 0x15, 0x00, 0x27, 0x00, 0x3d, 0x00, 0x5e, 0x00,
+  0x73, 0x00, 0x8e, 0x00, 0x9e, 0x00, 0xae, 0x00, 0x00, 0x00, 0x1d, 0x00,
+  0x34, 0x00, 0x48, 0x00, 0x5d, 0x00, 0x88, 0x00, 0x97, 0x00, 0xa5, 0x00,
+  0x00, 0x00, 0x16, 0x00, 0x24, 0x00, 0x4f, 0x00, 0x6d, 0x00, 0x98, 0x00,
+  0xaf, 0x00, 0xc0, 0x00, 0xd3, 0x00, 0xe1, 0x00, 0xef, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x2a, 0x00, 0x43, 0x00, 0x53, 0x00, 0x6f, 0x00, 0xb7, 0x00,
+  0xc3, 0x00, 0xd3, 0x00, 0xe3, 0x00, 0xed, 0x00, 0xfd, 0x00, 0x0b, 0x01,
+  0x1a, 0x01, 0x00, 0x00, 0x10, 0x00, 0x29, 0x00, 0x4a, 0x00, 0x5a, 0x00,
+  0x81, 0x00, 0x8e, 0x00, 0x9b, 0x00, 0xa7, 0x00, 0xb3, 0x00, 0xc0, 0x00,
+  0xcc, 0x00, 0xd7, 0x00, 0xe3, 0x00, 0xee, 0x00, 0xfa, 0x00, 0x06, 0x01,
+  0x00, 0x00, 0x13, 0x00, 0x29, 0x00, 0x3d, 0x00, 0x71, 0x00, 0x95, 0x00,
+  0xc6, 0x00, 0xd1, 0x00, 0xe2, 0x00, 0xee, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x2c, 0x00, 0x4c, 0x00, 0x5e, 0x00, 0x75, 0x00, 0xa4, 0x00, 0xac, 0x00,
+  0xb7, 0x00, 0xc5, 0x00, 0xd3, 0x00, 0xe1, 0x00, 0xee, 0x00, 0xff, 0x00,
+  0x0c, 0x01, 0x19, 0x01, 0x20, 0x01, 0x00, 0x00, 0x33, 0x00, 0x53, 0x00,
+  0x77, 0x00, 0x92, 0x00, 0xaf, 0x00, 0xb9, 0x00, 0xc7, 0x00, 0xd5, 0x00,
+  0xe0, 0x00, 0xea, 0x00, 0xf6, 0x00, 0x05, 0x01, 0x14, 0x01, 0x27, 0x01,
+  0x35, 0x01, 0x41, 0x01, 0x4e, 0x01, 0x00, 0x00, 0x3a, 0x00, 0x5c, 0x00,
+  0x86, 0x00, 0xb2, 0x00, 0xcc, 0x00, 0xeb, 0x00, 0xf7, 0x00, 0x02, 0x01,
+  0x0e, 0x01, 0x19, 0x01, 0x27, 0x01, 0x38, 0x01, 0x44, 0x01, 0x00, 0x00,
+  0x0c, 0x00, 0x25, 0x00, 0x4a, 0x00, 0x67, 0x00, 0x8e, 0x00, 0x96, 0x00,
+  0xa7, 0x00, 0xb6, 0x00, 0xbe, 0x00, 0xc6, 0x00, 0xd5, 0x00, 0xe2, 0x00,
+  0xee, 0x00, 0xfe, 0x00, 0x0d, 0x01, 0x1e, 0x01, 0x2c, 0x01, 0x39, 0x01,
+  0x46, 0x01, 0x00, 0x00, 0x10, 0x00, 0x26, 0x00, 0x3f, 0x00, 0x56, 0x00,
+  0x76, 0x00, 0x87, 0x00, 0x92, 0x00, 0xa7, 0x00, 0xb3, 0x00, 0xbf, 0x00,
+  0xca, 0x00, 0xd7, 0x00, 0xeb, 0x00, 0xfa, 0x00, 0x08, 0x01, 0x1a, 0x01,
+  0x28, 0x01, 0x00, 0x00, 0x1f, 0x00, 0x3a, 0x00, 0x55, 0x00, 0x67, 0x00,
+  0x79, 0x00, 0x92, 0x00, 0xae, 0x00, 0xc7, 0x00, 0xd2, 0x00, 0xe1, 0x00,
+  0xec, 0x00, 0xfd, 0x00, 0x09, 0x01, 0x1b, 0x01, 0x26, 0x01, 0x32, 0x01,
+  0x3f, 0x01, 0x4b, 0x01, 0x59, 0x01, 0x64, 0x01, 0x00, 0x00, 0x22, 0x00,
+  0x32, 0x00, 0x4b, 0x00, 0x5b, 0x00, 0x6d, 0x00, 0x8c, 0x00, 0xc4, 0x00,
+  0xd9, 0x00, 0xe9, 0x00, 0xf3, 0x00, 0x03, 0x01, 0x0f, 0x01, 0x1e, 0x01,
+  0x2c, 0x01, 0x3a, 0x01, 0x48, 0x01, 0x55, 0x01, 0x62, 0x01, 0x6f, 0x01,
+  0x7c, 0x01, 0x88, 0x01, 0x94, 0x01, 0x9f, 0x01, 0xab, 0x01, 0xb7, 0x01,
+  0xc5, 0x01, 0xd3, 0x01, 0xdf, 0x01, 0x00, 0x00, 0x21, 0x00, 0x40, 0x00,
+  0x66, 0x00, 0x85, 0x00, 0xa8, 0x00, 0xc5, 0x00, 0xe9, 0x00, 0x08, 0x01,
+  0x1a, 0x01, 0x2e, 0x01, 0x3a, 0x01, 0x48, 0x01, 0x69, 0x01, 0x82, 0x01,
+  0x92, 0x01, 0x9f, 0x01, 0xb2, 0x01, 0xc5, 0x01, 0xd3, 0x01, 0xe4, 0x01,
+  0xf5, 0x01, 0x05, 0x02, 0x14, 0x02, 0x20, 0x02, 0x2e, 0x02, 0x3b, 0x02,
+  0x4c, 0x02, 0x5f, 0x02, 0x70, 0x02, 0x7e, 0x02, 0x88, 0x02, 0x94, 0x02,
+  0x00, 0x00, 0x1f, 0x00, 0x38, 0x00, 0x4c, 0x00, 0x5a, 0x00, 0x78, 0x00,
+  0x90, 0x00, 0xb5, 0x00, 0xc7, 0x00, 0xd5, 0x00, 0xe4, 0x00, 0xf2, 0x00,
+  0x00, 0x01, 0x0e, 0x01, 0x1f, 0x01, 0x34, 0x01, 0x3e, 0x01, 0x4d, 0x01,
+  0x5b, 0x01, 0x65, 0x01, 0x70, 0x01, 0x82, 0x01, 0x00, 0x00, 0x1f, 0x00,
+  0x3c, 0x00, 0x60, 0x00, 0x7d, 0x00, 0x9e, 0x00, 0xb9, 0x00, 0xdb, 0x00,
+  0xf6, 0x00, 0x11, 0x01, 0x2c, 0x01, 0x3a, 0x01, 0x60, 0x01, 0x72, 0x01,
+  0x93, 0x01, 0xac, 0x01, 0xb9, 0x01, 0xc6, 0x01, 0xd2, 0x01, 0xe2, 0x01,
+  0x00, 0x00, 0x2d, 0x00, 0x3e, 0x00, 0x56, 0x00, 0x6f, 0x00, 0x84, 0x00,
+  0xa1, 0x00, 0xb3, 0x00, 0xce, 0x00, 0xde, 0x00, 0xee, 0x00, 0xfd, 0x00,
+  0x0e, 0x01, 0x1e, 0x01, 0x29, 0x01, 0x39, 0x01, 0x48, 0x01, 0x5a, 0x01,
+  0x6a, 0x01, 0x74, 0x01, 0x80, 0x01, 0x8f, 0x01, 0x00, 0x00, 0x12, 0x00,
+  0x24, 0x00, 0x3d, 0x00, 0x4b, 0x00, 0x6a, 0x00, 0x82, 0x00, 0x99, 0x00,
+  0xa7, 0x00, 0xb5, 0x00, 0xc1, 0x00, 0xcc, 0x00, 0xdf, 0x00, 0xeb, 0x00,
+  0x02, 0x01, 0x0c, 0x01, 0x18, 0x01, 0x24, 0x01, 0x33, 0x01, 0x40, 0x01,
+  0x00, 0x00, 0x2b, 0x00, 0x4b, 0x00, 0x60, 0x00, 0x8d, 0x00, 0x99, 0x00,
+  0xaf, 0x00, 0xd2, 0x00, 0xfe, 0x00, 0x12, 0x01, 0x1f, 0x01, 0x2a, 0x01,
+  0x3a, 0x01, 0x49, 0x01, 0x5c, 0x01, 0x6a, 0x01, 0x78, 0x01, 0x84, 0x01,
+  0x95, 0x01, 0xa1, 0x01, 0xae, 0x01, 0xba, 0x01, 0xc6, 0x01, 0xd9, 0x01,
+  0xea, 0x01, 0x00, 0x00, 0x19, 0x00, 0x34, 0x00, 0x46, 0x00, 0x67, 0x00,
+  0x8f, 0x00, 0xa4, 0x00, 0xb8, 0x00, 0xc7, 0x00, 0xd7, 0x00, 0xe7, 0x00,
+  0x00, 0x00, 0x1d, 0x00, 0x34, 0x00, 0x44, 0x00, 0x68, 0x00, 0x8a, 0x00,
+  0x9c, 0x00, 0xa8, 0x00, 0xbd, 0x00, 0xcf, 0x00, 0xda, 0x00, 0x00, 0x00,
+  0x16, 0x00, 0x32, 0x00, 0x42, 0x00, 0x52, 0x00, 0x69, 0x00, 0x80, 0x00,
+  0x8c, 0x00, 0x99, 0x00, 0xa6, 0x00, 0xb3, 0x00, 0xbf, 0x00, 0xc9, 0x00,
+  0xd9, 0x00, 0xe5, 0x00, 0xf2, 0x00, 0xfc, 0x00, 0x07, 0x01, 0x00, 0x00,
+  0x10, 0x00, 0x1e, 0x00, 0x30, 0x00, 0x52, 0x00, 0x7d, 0x00, 0x96, 0x00,
+  0xb0, 0x00, 0xbb, 0x00, 0xcc, 0x00, 0xdc, 0x00, 0xe8, 0x00, 0xf4, 0x00,
+  0x07, 0x01, 0x15, 0x01, 0x23, 0x01, 0x2e, 0x01, 0x3e, 0x01, 0x49, 0x01,
+  0x55, 0x01, 0x66, 0x01, 0x00, 0x00, 0x1f, 0x00, 0x38, 0x00, 0x46, 0x00,
+  0x56, 0x00, 0x71, 0x00, 0x81, 0x00, 0x91, 0x00, 0xa0, 0x00, 0xb2, 0x00,
+  0xbf, 0x00, 0xcd, 0x00, 0xd9, 0x00, 0xea, 0x00, 0xf7, 0x00, 0x03, 0x01,
+  0x0f, 0x01, 0x29, 0x01, 0x00, 0x00, 0x24, 0x00, 0x43, 0x00, 0x51, 0x00,
+  0x72, 0x00, 0x8b, 0x00, 0xa2, 0x00, 0xb6, 0x00, 0xc3, 0x00, 0xd6, 0x00,
+  0xe7, 0x00, 0xf5, 0x00, 0x02, 0x01, 0x10, 0x01, 0x1b, 0x01, 0x27, 0x01,
+  0x00, 0x00, 0x24, 0x00, 0x38, 0x00, 0x4a, 0x00, 0x65, 0x00, 0x83, 0x00,
+  0x9a, 0x00, 0xa8, 0x00, 0xbc, 0x00, 0xc9, 0x00, 0xd8, 0x00, 0xe5, 0x00,
+  0xf3, 0x00, 0xfe, 0x00, 0x09, 0x01, 0x17, 0x01, 0x23, 0x01, 0x2f, 0x01,
+  0x3e, 0x01, 0x00, 0x00, 0x12, 0x00, 0x27, 0x00, 0x35, 0x00, 0x4f, 0x00,
+  0x7a, 0x00, 0x8f, 0x00, 0x9e, 0x00, 0xb1, 0x00, 0xc0, 0x00, 0xce, 0x00,
+  0xdb, 0x00, 0xea, 0x00, 0xf9, 0x00, 0x00, 0x00, 0x12, 0x00, 0x3b, 0x00,
+  0x52, 0x00, 0x66, 0x00, 0x7c, 0x00, 0x91, 0x00, 0x9f, 0x00, 0xb6, 0x00,
+  0xc5, 0x00, 0xd1, 0x00, 0xe1, 0x00, 0xf1, 0x00, 0x03, 0x01, 0x11, 0x01,
+  0x1c, 0x01, 0x2f, 0x01, 0x3a, 0x01, 0x00, 0x00, 0x10, 0x00, 0x39, 0x00,
+  0x52, 0x00, 0x6b, 0x00, 0x94, 0x00, 0xc4, 0x00, 0xdd, 0x00, 0xf1, 0x00,
+  0x00, 0x01, 0x12, 0x01, 0x23, 0x01, 0x32, 0x01, 0x45, 0x01, 0x59, 0x01,
+  0x64, 0x01, 0x6e, 0x01, 0x00, 0x00, 0x26, 0x00, 0x3d, 0x00, 0x52, 0x00,
+  0x60, 0x00, 0x7f, 0x00, 0x97, 0x00, 0xb2, 0x00, 0xbf, 0x00, 0xcc, 0x00,
+  0xd7, 0x00, 0xe2, 0x00, 0xf5, 0x00, 0x05, 0x01, 0x1b, 0x01, 0x26, 0x01,
+  0x31, 0x01, 0x3f, 0x01, 0x00, 0x00, 0x0e, 0x00, 0x2b, 0x00, 0x48, 0x00,
+  0x5f, 0x00, 0x6b, 0x00, 0x8a, 0x00, 0xa4, 0x00, 0xba, 0x00, 0xc5, 0x00,
+  0xcf, 0x00, 0xd9, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x1c, 0x00, 0x49, 0x00,
+  0x62, 0x00, 0x7d, 0x00, 0x8d, 0x00, 0x9f, 0x00, 0xba, 0x00, 0xda, 0x00,
+  0xe9, 0x00, 0xf9, 0x00, 0x03, 0x01, 0x1c, 0x01, 0x2e, 0x01, 0x3b, 0x01,
+  0x00, 0x00, 0x21, 0x00, 0x31, 0x00, 0x51, 0x00, 0x5f, 0x00, 0x73, 0x00,
+  0x90, 0x00, 0xa8, 0x00, 0xbe, 0x00, 0x00, 0x00, 0x10, 0x00, 0x42, 0x00,
+  0x54, 0x00, 0x6d, 0x00, 0x93, 0x00, 0xa3, 0x00, 0xbc, 0x00, 0xe1, 0x00,
+  0xf2, 0x00, 0x08, 0x01, 0x00, 0x00, 0x12, 0x00, 0x3d, 0x00, 0x53, 0x00,
+  0x66, 0x00, 0x8a, 0x00, 0xaa, 0x00, 0xc5, 0x00, 0xde, 0x00, 0xec, 0x00,
+  0xfe, 0x00, 0x17, 0x01, 0x21, 0x01, 0x34, 0x01, 0x00, 0x00, 0x19, 0x00,
+  0x27, 0x00, 0x44, 0x00, 0x61, 0x00, 0x7a, 0x00, 0x91, 0x00, 0x9c, 0x00,
+  0xa8, 0x00, 0xbc, 0x00, 0xc6, 0x00, 0xdc, 0x00, 0xe6, 0x00, 0xf0, 0x00,
+  0x04, 0x01, 0x12, 0x01, 0x26, 0x01, 0x00, 0x00, 0x1f, 0x00, 0x3c, 0x00,
+  0x4d, 0x00, 0x5d, 0x00, 0x76, 0x00, 0x86, 0x00, 0xa7, 0x00, 0xb4, 0x00,
+  0xc1, 0x00, 0xd2, 0x00, 0xdf, 0x00, 0xea, 0x00, 0x00, 0x00, 0x12, 0x00,
+  0x2f, 0x00, 0x51, 0x00, 0x5f, 0x00, 0x6f, 0x00, 0x8a, 0x00, 0xa7, 0x00,
+  0xb6, 0x00, 0xc1, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x3f, 0x00, 0x5a, 0x00,
+  0x6d, 0x00, 0x9e, 0x00, 0xaa, 0x00, 0xbb, 0x00, 0xc7, 0x00, 0xd8, 0x00,
+  0xe5, 0x00, 0xef, 0x00, 0xfb, 0x00, 0x0b, 0x01, 0x18, 0x01, 0x26, 0x01,
+  0x34, 0x01, 0x3e, 0x01, 0x4f, 0x01, 0x5d, 0x01, 0x6a, 0x01, 0x00, 0x00,
+  0x0e, 0x00, 0x25, 0x00, 0x37, 0x00, 0x45, 0x00, 0x5b, 0x00, 0x7a, 0x00,
+  0x93, 0x00, 0x9d, 0x00, 0xad, 0x00, 0xbc, 0x00, 0xc8, 0x00, 0xd6, 0x00,
+  0xe4, 0x00, 0xf2, 0x00, 0xfc, 0x00, 0x0a, 0x01, 0x1c, 0x01, 0x27, 0x01,
+  0x33, 0x01, 0x43, 0x01, 0x52, 0x01, 0x00, 0x00, 0x17, 0x00, 0x27, 0x00,
+  0x37, 0x00, 0x47, 0x00, 0x59, 0x00, 0x7e, 0x00, 0x9b, 0x00, 0xa8, 0x00,
+  0xb4, 0x00, 0xbf, 0x00, 0xc9, 0x00, 0xd8, 0x00, 0xe8, 0x00, 0xf6, 0x00,
+  0x05, 0x01, 0x00, 0x00, 0x23, 0x00, 0x42, 0x00, 0x64, 0x00, 0x76, 0x00,
+  0x8f, 0x00, 0xa1, 0x00, 0xb3, 0x00, 0xc3, 0x00, 0xcf, 0x00, 0xdb, 0x00,
+  0xeb, 0x00, 0xf8, 0x00, 0x05, 0x01, 0x13, 0x01, 0x1f, 0x01, 0x2b, 0x01,
+  0x3a, 0x01, 0x49, 0x01, 0x5f, 0x01, 0x00, 0x00, 0x31, 0x00, 0x4a, 0x00,
+  0x5a, 0x00, 0x83, 0x00, 0x9c, 0x00, 0xaf, 0x00, 0xd0, 0x00, 0xe7, 0x00,
+  0xf5, 0x00, 0x08, 0x01, 0x18, 0x01, 0x26, 0x01, 0x33, 0x01, 0x3e, 0x01,
+  0x4b, 0x01, 0x57, 0x01, 0x66, 0x01, 0x78, 0x01, 0x83, 0x01, 0x92, 0x01,
+  0x9f, 0x01, 0x00, 0x00, 0x33, 0x00, 0x4e, 0x00, 0x5c, 0x00, 0x99, 0x00,
+  0xb8, 0x00, 0xd1, 0x00, 0xec, 0x00, 0xfb, 0x00, 0x06, 0x01, 0x15, 0x01,
+  0x26, 0x01, 0x37, 0x01, 0x43, 0x01, 0x50, 0x01, 0x5c, 0x01, 0x66, 0x01,
+  0x74, 0x01, 0x84, 0x01, 0x00, 0x00, 0x1d, 0x00, 0x32, 0x00, 0x6d, 0x00,
+  0x7b, 0x00, 0x89, 0x00, 0xb5, 0x00, 0xbf, 0x00, 0xcb, 0x00, 0xd7, 0x00,
+  0xe2, 0x00, 0xef, 0x00, 0xfa, 0x00, 0x04, 0x01, 0x13, 0x01, 0x26, 0x01,
+  0x39, 0x01, 0x43, 0x01, 0x52, 0x01, 0x5d, 0x01, 0x00, 0x00, 0x3a, 0x00,
+  0x67, 0x00, 0x8d, 0x00, 0xc3, 0x00, 0xee, 0x00, 0x15, 0x01, 0x47, 0x01,
+  0x6f, 0x01, 0x96, 0x01, 0xb1, 0x01, 0xc6, 0x01, 0xe0, 0x01, 0x06, 0x02,
+  0x26, 0x02, 0x45, 0x02, 0x60, 0x02, 0x72, 0x02, 0x84, 0x02, 0x91, 0x02,
+  0x9d, 0x02, 0xad, 0x02, 0xb9, 0x02, 0xca, 0x02, 0xd7, 0x02, 0xe1, 0x02,
+  0xf4, 0x02, 0x05, 0x03, 0x16, 0x03, 0x24, 0x03, 0x00, 0x00, 0x15, 0x00,
+  0x25, 0x00, 0x4e, 0x00, 0x5e, 0x00, 0x6c, 0x00, 0x85, 0x00, 0x93, 0x00,
+  0xa2, 0x00, 0xad, 0x00, 0xba, 0x00, 0xc7, 0x00, 0xd5, 0x00, 0xe6, 0x00,
+  0xf7, 0x00, 0x06, 0x01, 0x14, 0x01, 0x1e, 0x01, 0x2c, 0x01, 0x38, 0x01,
+  0x49, 0x01, 0x56, 0x01, 0x64, 0x01, 0x73, 0x01, 0x81, 0x01, 0x00, 0x00,
+  0x0b, 0x00, 0x43, 0x00, 0x6e, 0x00, 0x92, 0x00, 0xc6, 0x00, 0xef, 0x00,
+  0x14, 0x01, 0x44, 0x01, 0x6a, 0x01, 0x8f, 0x01, 0xa8, 0x01, 0xc7, 0x01,
+  0xe9, 0x01, 0x02, 0x02, 0x20, 0x02, 0x3f, 0x02, 0x54, 0x02, 0x5e, 0x02,
+  0x6f, 0x02, 0x7d, 0x02, 0x88, 0x02, 0x94, 0x02, 0x9c, 0x02, 0x00, 0x00,
+  0x1f, 0x00, 0x42, 0x00, 0x5f, 0x00, 0x78, 0x00, 0x88, 0x00, 0x98, 0x00,
+  0xaf, 0x00, 0xbd, 0x00, 0xce, 0x00, 0xe1, 0x00, 0xeb, 0x00, 0xfd, 0x00,
+  0x07, 0x01, 0x12, 0x01, 0x22, 0x01, 0x33, 0x01, 0x44, 0x01, 0x55, 0x01,
+  0x5f, 0x01, 0x74, 0x01, 0x7f, 0x01, 0x8f, 0x01, 0x9e, 0x01, 0xb0, 0x01,
+  0x00, 0x00, 0x1f, 0x00, 0x2d, 0x00, 0x66, 0x00, 0x7c, 0x00, 0x9b, 0x00,
+  0xb2, 0x00, 0xbf, 0x00, 0xd6, 0x00, 0xe3, 0x00, 0xee, 0x00, 0x00, 0x00,
+  0x1f, 0x00, 0x48, 0x00, 0x83, 0x00, 0x97, 0x00, 0xb4, 0x00, 0xcf, 0x00,
+  0xda, 0x00, 0xe7, 0x00, 0xf4, 0x00, 0xff, 0x00, 0x12, 0x01, 0x23, 0x01,
+  0x2f, 0x01, 0x3b, 0x01, 0x4c, 0x01, 0x56, 0x01, 0x67, 0x01, 0x75, 0x01,
+  0x86, 0x01, 0x98, 0x01, 0xa7, 0x01, 0x00, 0x00, 0x18, 0x00, 0x2d, 0x00,
+  0x58, 0x00, 0x6c, 0x00, 0x81, 0x00, 0xa6, 0x00, 0xb4, 0x00, 0xc8, 0x00,
+  0xd5, 0x00, 0xe4, 0x00, 0xf3, 0x00, 0x03, 0x01, 0x12, 0x01, 0x29, 0x01,
+  0x39, 0x01, 0x45, 0x01, 0x00, 0x00, 0x29, 0x00, 0x42, 0x00, 0x54, 0x00,
+  0x73, 0x00, 0x88, 0x00, 0xa8, 0x00, 0xc6, 0x00, 0xd8, 0x00, 0xe3, 0x00,
+  0xf0, 0x00, 0x00, 0x01, 0x0e, 0x01, 0x1c, 0x01, 0x2d, 0x01, 0x3d, 0x01,
+  0x48, 0x01, 0x58, 0x01, 0x6a, 0x01, 0x79, 0x01, 0x00, 0x00, 0x15, 0x00,
+  0x3c, 0x00, 0x5b, 0x00, 0x7a, 0x00, 0x8a, 0x00, 0x9c, 0x00, 0xae, 0x00,
+  0xbb, 0x00, 0xc8, 0x00, 0xd4, 0x00, 0xe0, 0x00, 0xeb, 0x00, 0xf6, 0x00,
+  0x0e, 0x01, 0x1d, 0x01, 0x00, 0x00, 0x15, 0x00, 0x44, 0x00, 0x63, 0x00,
+  0x78, 0x00, 0x91, 0x00, 0xa1, 0x00, 0xc2, 0x00, 0xd2, 0x00, 0xdf, 0x00,
+  0xee, 0x00, 0xf9, 0x00, 0x05, 0x01, 0x15, 0x01, 0x2c, 0x01, 0x3c, 0x01,
+  0x4b, 0x01, 0x00, 0x00, 0x17, 0x00, 0x3e, 0x00, 0x4e, 0x00, 0x67, 0x00,
+  0x79, 0x00, 0x90, 0x00, 0xa0, 0x00, 0xaf, 0x00, 0xbc, 0x00, 0xca, 0x00,
+  0xda, 0x00, 0xe7, 0x00, 0xf6, 0x00, 0x04, 0x01, 0x00, 0x00, 0x17, 0x00,
+  0x31, 0x00, 0x43, 0x00, 0x5e, 0x00, 0x70, 0x00, 0x87, 0x00, 0x9e, 0x00,
+  0xab, 0x00, 0xbb, 0x00, 0xd3, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x2b, 0x00, 0x42, 0x00, 0x56, 0x00, 0x73, 0x00, 0x8a, 0x00, 0x9e, 0x00,
+  0xb0, 0x00, 0xc8, 0x00, 0xd5, 0x00, 0xe2, 0x00, 0xf2, 0x00, 0x00, 0x01,
+  0x11, 0x01, 0x20, 0x01, 0x30, 0x01, 0x3f, 0x01, 0x4e, 0x01, 0x5f, 0x01,
+  0x6f, 0x01, 0x7c, 0x01, 0x8a, 0x01, 0x00, 0x00, 0x15, 0x00, 0x38, 0x00,
+  0x55, 0x00, 0x73, 0x00, 0x85, 0x00, 0x9c, 0x00, 0xb1, 0x00, 0xc1, 0x00,
+  0xd5, 0x00, 0xe3, 0x00, 0xed, 0x00, 0xfc, 0x00, 0x0e, 0x01, 0x26, 0x01,
+  0x33, 0x01, 0x49, 0x01, 0x00, 0x00, 0x15, 0x00, 0x30, 0x00, 0x4b, 0x00,
+  0x5d, 0x00, 0x7c, 0x00, 0x8d, 0x00, 0xa2, 0x00, 0xb2, 0x00, 0xc2, 0x00,
+  0xd4, 0x00, 0xe0, 0x00, 0xed, 0x00, 0xfd, 0x00, 0x0e, 0x01, 0x1a, 0x01,
+  0x00, 0x00, 0x1e, 0x00, 0x35, 0x00, 0x50, 0x00, 0x68, 0x00, 0x81, 0x00,
+  0x8d, 0x00, 0x98, 0x00, 0xa7, 0x00, 0xb8, 0x00, 0x00, 0x00, 0x20, 0x00,
+  0x3f, 0x00, 0x63, 0x00, 0x8d, 0x00, 0xa6, 0x00, 0xb3, 0x00, 0xc5, 0x00,
+  0xd7, 0x00, 0xe5, 0x00, 0xf1, 0x00, 0x02, 0x01, 0x00, 0x00, 0x20, 0x00,
+  0x30, 0x00, 0x45, 0x00, 0x69, 0x00, 0x8b, 0x00, 0xa4, 0x00, 0x00, 0x00,
+  0x1e, 0x00, 0x35, 0x00, 0x43, 0x00, 0x53, 0x00, 0x65, 0x00, 0x82, 0x00,
+  0x98, 0x00, 0xa7, 0x00, 0xb7, 0x00, 0xc2, 0x00, 0xd8, 0x00, 0x00, 0x00,
+  0x1b, 0x00, 0x30, 0x00, 0x4d, 0x00, 0x68, 0x00, 0x7f, 0x00, 0x9c, 0x00,
+  0x00, 0x00, 0x17, 0x00, 0x40, 0x00, 0x5b, 0x00, 0x78, 0x00, 0x86, 0x00,
+  0x9e, 0x00, 0xbb, 0x00, 0xca, 0x00, 0xdb, 0x00, 0xf2, 0x00, 0xfe, 0x00,
+  0x12, 0x01, 0x00, 0x00, 0x26, 0x00, 0x38, 0x00, 0x4a, 0x00, 0x58, 0x00,
+  0x7e, 0x00, 0x9d, 0x00, 0xb6, 0x00, 0xcc, 0x00, 0x00, 0x00, 0x1d, 0x00,
+  0x38, 0x00, 0x4e, 0x00, 0x6f, 0x00, 0x8a, 0x00, 0xa3, 0x00, 0xb7, 0x00,
+  0xce, 0x00, 0xdd, 0x00, 0xe8, 0x00, 0xf3, 0x00, 0x02, 0x01, 0x11, 0x01,
+  0x1c, 0x01, 0x29, 0x01, 0x36, 0x01, 0x43, 0x01, 0x4f, 0x01, 0x5e, 0x01,
+  0x6e, 0x01, 0x87, 0x01, 0x92, 0x01, 0x9d, 0x01, 0xac, 0x01, 0x00, 0x00,
+  0x1d, 0x00, 0x4b, 0x00, 0x5f, 0x00, 0x80, 0x00, 0x9d, 0x00, 0xc8, 0x00,
+  0xe1, 0x00, 0xf8, 0x00, 0x04, 0x01, 0x12, 0x01, 0x00, 0x00, 0x12, 0x00,
+  0x34, 0x00, 0x53, 0x00, 0x6c, 0x00, 0x87, 0x00, 0xa3, 0x00, 0xbe, 0x00,
+  0xc7, 0x00, 0xd4, 0x00, 0xe1, 0x00, 0xee, 0x00, 0xfe, 0x00, 0x09, 0x01,
+  0x13, 0x01, 0x20, 0x01, 0x2d, 0x01, 0x3b, 0x01, 0x00, 0x00, 0x20, 0x00,
+  0x41, 0x00, 0x62, 0x00, 0x78, 0x00, 0x94, 0x00, 0xb3, 0x00, 0xc4, 0x00,
+  0xce, 0x00, 0xe4, 0x00, 0xef, 0x00, 0xfc, 0x00, 0x09, 0x01, 0x00, 0x00,
+  0x0c, 0x00, 0x18, 0x00, 0x24, 0x00, 0x3c, 0x00, 0x63, 0x00, 0x7e, 0x00,
+  0x92, 0x00, 0xa7, 0x00, 0xc7, 0x00, 0xd4, 0x00, 0xdf, 0x00, 0xeb, 0x00,
+  0xfb, 0x00, 0x0a, 0x01, 0x14, 0x01, 0x25, 0x01, 0x34, 0x01, 0x3f, 0x01,
+  0x51, 0x01, 0x5f, 0x01, 0x6b, 0x01, 0x77, 0x01, 0x82, 0x01, 0x8f, 0x01,
+  0x9c, 0x01, 0xa8, 0x01, 0xb4, 0x01, 0xc6, 0x01, 0xd7, 0x01, 0xe2, 0x01,
+  0x00, 0x00, 0x10, 0x00, 0x35, 0x00, 0x5a, 0x00, 0x77, 0x00, 0x8c, 0x00,
+  0xa1, 0x00, 0xad, 0x00, 0xb8, 0x00, 0xc9, 0x00, 0xd8, 0x00, 0xe4, 0x00,
+  0xf1, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x17, 0x00, 0x2f, 0x00, 0x4e, 0x00,
+  0x65, 0x00, 0x8b, 0x00, 0xa6, 0x00, 0xbd, 0x00, 0xc8, 0x00, 0xd5, 0x00,
+  0xe1, 0x00, 0xeb, 0x00, 0xf7, 0x00, 0x03, 0x01, 0x10, 0x01, 0x1c, 0x01,
+  0x28, 0x01, 0x3a, 0x01, 0x45, 0x01, 0x55, 0x01, 0x00, 0x00, 0x1b, 0x00,
+  0x2e, 0x00, 0x4d, 0x00, 0x6d, 0x00, 0x93, 0x00, 0xae, 0x00, 0xc9, 0x00,
+  0xd2, 0x00, 0xe0, 0x00, 0xf1, 0x00, 0x01, 0x01, 0x0f, 0x01, 0x1d, 0x01,
+  0x29, 0x01, 0x36, 0x01, 0x44, 0x01, 0x55, 0x01, 0x6d, 0x01, 0x7b, 0x01,
+  0x87, 0x01, 0x97, 0x01, 0xa5, 0x01, 0xb4, 0x01, 0xbe, 0x01, 0xcd, 0x01,
+  0xdb, 0x01, 0x00, 0x00, 0x25, 0x00, 0x3e, 0x00, 0x53, 0x00, 0x75, 0x00,
+  0x83, 0x00, 0x8c, 0x00, 0x9f, 0x00, 0xad, 0x00, 0xbc, 0x00, 0xcb, 0x00,
+  0xd7, 0x00, 0xe4, 0x00, 0xf0, 0x00, 0xfb, 0x00, 0x07, 0x01, 0x12, 0x01,
+  0x1d, 0x01, 0x29, 0x01, 0x35, 0x01, 0x41, 0x01, 0x4f, 0x01, 0x5d, 0x01,
+  0x69, 0x01, 0x74, 0x01, 0x84, 0x01, 0x8f, 0x01, 0xa0, 0x01, 0xab, 0x01,
+  0xba, 0x01, 0x00, 0x00, 0x1a, 0x00, 0x28, 0x00, 0x48, 0x00, 0x6a, 0x00,
+  0x75, 0x00, 0x80, 0x00, 0x91, 0x00, 0x9c, 0x00, 0xa8, 0x00, 0xb6, 0x00,
+  0xc6, 0x00, 0xcf, 0x00, 0xda, 0x00, 0xe5, 0x00, 0xf8, 0x00, 0x07, 0x01,
+  0x11, 0x01, 0x1f, 0x01, 0x2b, 0x01, 0x00, 0x00, 0x0f, 0x00, 0x27, 0x00,
+  0x45, 0x00, 0x5e, 0x00, 0x7e, 0x00, 0x90, 0x00, 0x9f, 0x00, 0xac, 0x00,
+  0xb8, 0x00, 0xc3, 0x00, 0xd0, 0x00, 0xdf, 0x00, 0xeb, 0x00, 0xf8, 0x00,
+  0x03, 0x01, 0x11, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x38, 0x01, 0x45, 0x01,
+  0x52, 0x01, 0x00, 0x00, 0x10, 0x00, 0x20, 0x00, 0x40, 0x00, 0x5b, 0x00,
+  0x88, 0x00, 0x96, 0x00, 0xa8, 0x00, 0xb7, 0x00, 0xbe, 0x00, 0xcc, 0x00,
+  0xd7, 0x00, 0xe3, 0x00, 0xf2, 0x00, 0xff, 0x00, 0x15, 0x01, 0x00, 0x00,
+  0x16, 0x00, 0x2f, 0x00, 0x43, 0x00, 0x63, 0x00, 0x83, 0x00, 0x92, 0x00,
+  0xa1, 0x00, 0xaf, 0x00, 0xbe, 0x00, 0xcf, 0x00, 0xdd, 0x00, 0xeb, 0x00,
+  0xfc, 0x00, 0x0c, 0x01, 0x21, 0x01, 0x31, 0x01, 0x45, 0x01, 0x4f, 0x01,
+  0x5f, 0x01, 0x6a, 0x01, 0x77, 0x01, 0x8b, 0x01, 0x99, 0x01, 0xaa, 0x01,
+  0xbd, 0x01, 0x00, 0x00, 0x20, 0x00, 0x30, 0x00, 0x44, 0x00, 0x6a, 0x00,
+  0x7a, 0x00, 0x88, 0x00, 0x94, 0x00, 0xa1, 0x00, 0xac, 0x00, 0xba, 0x00,
+  0xcb, 0x00, 0xd7, 0x00, 0xe4, 0x00, 0xf3, 0x00, 0x08, 0x01, 0x16, 0x01,
+  0x2a, 0x01, 0x00, 0x00, 0x17, 0x00, 0x32, 0x00, 0x47, 0x00, 0x66, 0x00,
+  0x7f, 0x00, 0x91, 0x00, 0x9c, 0x00, 0xa7, 0x00, 0xb8, 0x00, 0xc7, 0x00,
+  0xd7, 0x00, 0xe3, 0x00, 0xf2, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x22, 0x00,
+  0x46, 0x00, 0x5a, 0x00, 0x71, 0x00, 0x8c, 0x00, 0x97, 0x00, 0xa3, 0x00,
+  0xad, 0x00, 0xba, 0x00, 0x00, 0x00, 0x10, 0x00, 0x40, 0x00, 0x64, 0x00,
+  0x74, 0x00, 0x84, 0x00, 0xa3, 0x00, 0xae, 0x00, 0xc1, 0x00, 0xd4, 0x00,
+  0xdf, 0x00, 0xee, 0x00, 0xf9, 0x00, 0x05, 0x01, 0x14, 0x01, 0x22, 0x01,
+  0x2d, 0x01, 0x3b, 0x01, 0x4a, 0x01, 0x59, 0x01, 0x00, 0x00, 0x21, 0x00,
+  0x40, 0x00, 0x63, 0x00, 0x75, 0x00, 0x81, 0x00, 0x90, 0x00, 0x9a, 0x00,
+  0xa8, 0x00, 0xb8, 0x00, 0xc5, 0x00, 0xdd, 0x00, 0xe9, 0x00, 0xfb, 0x00,
+  0x00, 0x00, 0x17, 0x00, 0x27, 0x00, 0x37, 0x00, 0x51, 0x00, 0x7a, 0x00,
+  0x89, 0x00, 0x98, 0x00, 0xa3, 0x00, 0xaf, 0x00, 0xba, 0x00, 0xc4, 0x00,
+  0xd0, 0x00, 0xdc, 0x00, 0xec, 0x00, 0xfb, 0x00, 0x0a, 0x01, 0x15, 0x01,
+  0x00, 0x00, 0x1a, 0x00, 0x39, 0x00, 0x59, 0x00, 0x67, 0x00, 0x89, 0x00,
+  0x94, 0x00, 0x9f, 0x00, 0xab, 0x00, 0xbc, 0x00, 0xc6, 0x00, 0xd5, 0x00,
+  0xe0, 0x00, 0xf2, 0x00, 0xfe, 0x00, 0x09, 0x01, 0x1a, 0x01, 0x29, 0x01,
+  0x35, 0x01, 0x42, 0x01, 0x50, 0x01, 0x64, 0x01, 0x00, 0x00, 0x14, 0x00,
+  0x28, 0x00, 0x46, 0x00, 0x56, 0x00, 0x67, 0x00, 0x7a, 0x00, 0x83, 0x00,
+  0x91, 0x00, 0xa3, 0x00, 0xb4, 0x00, 0xc7, 0x00, 0x00, 0x00, 0x12, 0x00,
+  0x2f, 0x00, 0x3d, 0x00, 0x58, 0x00, 0x65, 0x00, 0x71, 0x00, 0x81, 0x00,
+  0x8f, 0x00, 0x98, 0x00, 0xa6, 0x00, 0xb4, 0x00, 0xc2, 0x00, 0x00, 0x00,
+  0x19, 0x00, 0x37, 0x00, 0x4d, 0x00, 0x61, 0x00, 0x7a, 0x00, 0x85, 0x00,
+  0x95, 0x00, 0xa0, 0x00, 0xaa, 0x00, 0xbf, 0x00, 0xce, 0x00, 0xd8, 0x00,
+  0x00, 0x00, 0x1b, 0x00, 0x36, 0x00, 0x66, 0x00, 0x80, 0x00, 0x99, 0x00,
+  0xa9, 0x00, 0xb6, 0x00, 0xc2, 0x00, 0xd0, 0x00, 0xde, 0x00, 0xee, 0x00,
+  0xfe, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x31, 0x00, 0x48, 0x00, 0x59, 0x00,
+  0x6b, 0x00, 0x7e, 0x00, 0x8f, 0x00, 0x9b, 0x00, 0xa5, 0x00, 0xaf, 0x00,
+  0xbf, 0x00, 0xd1, 0x00, 0x00, 0x00, 0x24, 0x00, 0x36, 0x00, 0x51, 0x00,
+  0x61, 0x00, 0x6f, 0x00, 0x80, 0x00, 0x92, 0x00, 0x9e, 0x00, 0xb3, 0x00,
+  0xc3, 0x00, 0xd3, 0x00, 0xe2, 0x00, 0xef, 0x00, 0x00, 0x00, 0x22, 0x00,
+  0x3a, 0x00, 0x4e, 0x00, 0x64, 0x00, 0x75, 0x00, 0x00, 0x00, 0x31, 0x00,
+  0x48, 0x00, 0x5c, 0x00, 0x6f, 0x00, 0x7a, 0x00, 0x8c, 0x00, 0x99, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x26, 0x00, 0x41, 0x00, 0x50, 0x00, 0x5d, 0x00,
+  0x00, 0x00, 0x33, 0x00, 0x47, 0x00, 0x62, 0x00, 0x70, 0x00, 0x7a, 0x00,
+  0x84, 0x00, 0x8d, 0x00, 0x00, 0x00, 0x34, 0x00, 0x46, 0x00, 0x78, 0x00,
+  0x97, 0x00, 0x00, 0x00, 0x36, 0x00, 0x6f, 0x00, 0x9c, 0x00, 0xb5, 0x00,
+  0xbd, 0x00, 0xd5, 0x00, 0xe1, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x31, 0x00,
+  0x4a, 0x00, 0x71, 0x00, 0x7c, 0x00, 0x86, 0x00, 0x92, 0x00, 0x9e, 0x00,
+  0xa9, 0x00, 0x00, 0x00, 0x19, 0x00, 0x2d, 0x00, 0x4a, 0x00, 0x6f, 0x00,
+  0x7c, 0x00, 0x8c, 0x00, 0x96, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x3a, 0x00,
+  0x58, 0x00, 0x78, 0x00, 0x89, 0x00, 0x97, 0x00, 0xa2, 0x00, 0xb0, 0x00,
+  0xbd, 0x00, 0xc7, 0x00, 0x00, 0x00, 0x24, 0x00, 0x3d, 0x00, 0x5d, 0x00,
+  0x7c, 0x00, 0x8e, 0x00, 0xb4, 0x00, 0xbf, 0x00, 0xd4, 0x00, 0xde, 0x00,
+  0x00, 0x00, 0x23, 0x00, 0x35, 0x00, 0x41, 0x00, 0x4d, 0x00, 0x5d, 0x00,
+  0x6b, 0x00, 0x7f, 0x00, 0x8a, 0x00, 0x9f, 0x00, 0xaa, 0x00, 0xba, 0x00,
+  0xc4, 0x00, 0xcf, 0x00, 0xd9, 0x00, 0xe5, 0x00, 0xf0, 0x00, 0xfb, 0x00,
+  0x0a, 0x01, 0x00, 0x00, 0x1d, 0x00, 0x32, 0x00, 0x3f, 0x00, 0x4e, 0x00,
+  0x5a, 0x00, 0x66, 0x00, 0x71, 0x00, 0x81, 0x00, 0x8c, 0x00, 0x98, 0x00,
+  0xa3, 0x00, 0xaf, 0x00, 0xba, 0x00, 0xc5, 0x00, 0xd3, 0x00, 0x00, 0x00,
+  0x24, 0x00, 0x4b, 0x00, 0x68, 0x00, 0x77, 0x00, 0x85, 0x00, 0x94, 0x00,
+  0xa2, 0x00, 0xb7, 0x00, 0xc8, 0x00, 0xd8, 0x00, 0xe7, 0x00, 0xf6, 0x00,
+  0x00, 0x00, 0x14, 0x00, 0x32, 0x00, 0x4d, 0x00, 0x58, 0x00, 0x63, 0x00,
+  0x71, 0x00, 0x80, 0x00, 0x8c, 0x00, 0x99, 0x00, 0xa6, 0x00, 0xb0, 0x00,
+  0x00, 0x00, 0x28, 0x00, 0x45, 0x00, 0x5a, 0x00, 0x69, 0x00, 0x77, 0x00,
+  0x82, 0x00, 0x8e, 0x00, 0x9d, 0x00, 0xab, 0x00, 0xb9, 0x00, 0xc7, 0x00,
+  0xd1, 0x00, 0xe2, 0x00, 0xf3, 0x00, 0xff, 0x00, 0x10, 0x01, 0x1d, 0x01,
+  0x28, 0x01, 0x34, 0x01, 0x42, 0x01, 0x4d, 0x01, 0x5e, 0x01, 0x6c, 0x01,
+  0x78, 0x01, 0x8e, 0x01, 0x00, 0x00, 0x10, 0x00, 0x25, 0x00, 0x45, 0x00,
+  0x50, 0x00, 0x61, 0x00, 0x71, 0x00, 0x7f, 0x00, 0x8a, 0x00, 0x96, 0x00,
+  0xaa, 0x00, 0xb5, 0x00, 0xc4, 0x00, 0xd4, 0x00, 0xe2, 0x00, 0x00, 0x00,
+  0x21, 0x00, 0x42, 0x00, 0x57, 0x00, 0x65, 0x00, 0x73, 0x00, 0x82, 0x00,
+  0x93, 0x00, 0x9e, 0x00, 0xaa, 0x00, 0xb7, 0x00, 0xc8, 0x00, 0xd4, 0x00,
+  0xe5, 0x00, 0xf7, 0x00, 0x07, 0x01, 0x15, 0x01, 0x22, 0x01, 0x2e, 0x01,
+  0x3d, 0x01, 0x4c, 0x01, 0x58, 0x01, 0x67, 0x01, 0x00, 0x00, 0x2a, 0x00,
+  0x3f, 0x00, 0x51, 0x00, 0x5e, 0x00, 0x6a, 0x00, 0x76, 0x00, 0x8a, 0x00,
+  0x9d, 0x00, 0xac, 0x00, 0xbf, 0x00, 0xcd, 0x00, 0xd9, 0x00, 0x00, 0x00,
+  0x19, 0x00, 0x42, 0x00, 0x54, 0x00, 0x61, 0x00, 0x6d, 0x00, 0x75, 0x00,
+  0x86, 0x00, 0x96, 0x00, 0xa5, 0x00, 0xb7, 0x00, 0xc5, 0x00, 0xd0, 0x00,
+  0xe1, 0x00, 0xf0, 0x00, 0x05, 0x01, 0x16, 0x01, 0x20, 0x01, 0x32, 0x01,
+  0x41, 0x01, 0x50, 0x01, 0x59, 0x01, 0x65, 0x01, 0x00, 0x00, 0x2c, 0x00,
+  0x4a, 0x00, 0x58, 0x00, 0x66, 0x00, 0x71, 0x00, 0x7c, 0x00, 0x87, 0x00,
+  0x97, 0x00, 0xa4, 0x00, 0xb8, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x38, 0x00,
+  0x42, 0x00, 0x4e, 0x00, 0x5a, 0x00, 0x6a, 0x00, 0x7e, 0x00, 0x86, 0x00,
+  0x96, 0x00, 0xa2, 0x00, 0xae, 0x00, 0xb8, 0x00, 0xc3, 0x00, 0xd1, 0x00,
+  0xdc, 0x00, 0xe8, 0x00, 0xfb, 0x00, 0x05, 0x01, 0x11, 0x01, 0x1f, 0x01,
+  0x2a, 0x01, 0x34, 0x01, 0x00, 0x00, 0x28, 0x00, 0x43, 0x00, 0x59, 0x00,
+  0x63, 0x00, 0x6d, 0x00, 0x79, 0x00, 0x8e, 0x00, 0x99, 0x00, 0xa4, 0x00,
+  0x00, 0x00, 0x16, 0x00, 0x35, 0x00, 0x4e, 0x00, 0x5a, 0x00, 0x64, 0x00,
+  0x72, 0x00, 0x81, 0x00, 0x91, 0x00, 0x9c, 0x00, 0xb1, 0x00, 0xc1, 0x00,
+  0xcd, 0x00, 0xdd, 0x00, 0xec, 0x00, 0xf7, 0x00, 0x05, 0x01, 0x1a, 0x01,
+  0x2c, 0x01, 0x3e, 0x01, 0x00, 0x00, 0x17, 0x00, 0x32, 0x00, 0x4b, 0x00,
+  0x59, 0x00, 0x68, 0x00, 0x74, 0x00, 0x82, 0x00, 0x8e, 0x00, 0x99, 0x00,
+  0xa8, 0x00, 0xb3, 0x00, 0xc2, 0x00, 0xcf, 0x00, 0xdb, 0x00, 0xea, 0x00,
+  0xf7, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x34, 0x00, 0x52, 0x00, 0x62, 0x00,
+  0x71, 0x00, 0x7f, 0x00, 0x8a, 0x00, 0x9a, 0x00, 0xa7, 0x00, 0xb7, 0x00,
+  0x00, 0x00, 0x1d, 0x00, 0x3a, 0x00, 0x57, 0x00, 0x74, 0x00, 0x91, 0x00,
+  0xae, 0x00, 0xcb, 0x00, 0xe8, 0x00, 0x05, 0x01, 0x1f, 0x01, 0x51, 0x01,
+  0x65, 0x01, 0x70, 0x01, 0x81, 0x01, 0x8c, 0x01, 0x97, 0x01, 0x00, 0x00,
+  0x19, 0x00, 0x35, 0x00, 0x48, 0x00, 0x55, 0x00, 0x62, 0x00, 0x6f, 0x00,
+  0x7c, 0x00, 0x89, 0x00, 0x99, 0x00, 0xaf, 0x00, 0xbe, 0x00, 0xd0, 0x00,
+  0xea, 0x00, 0xf7, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x44, 0x00, 0x53, 0x00,
+  0x61, 0x00, 0x71, 0x00, 0x7d, 0x00, 0x89, 0x00, 0x96, 0x00, 0xa2, 0x00,
+  0x00, 0x00, 0x1d, 0x00, 0x30, 0x00, 0x4e, 0x00, 0x5a, 0x00, 0x6f, 0x00,
+  0x7a, 0x00, 0x85, 0x00, 0x98, 0x00, 0xb2, 0x00, 0x00, 0x00, 0x17, 0x00,
+  0x2d, 0x00, 0x42, 0x00, 0x5c, 0x00, 0x6b, 0x00, 0x76, 0x00, 0x85, 0x00,
+  0x97, 0x00, 0xa3, 0x00, 0xb0, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x1f, 0x00,
+  0x2b, 0x00, 0x38, 0x00, 0x49, 0x00, 0x56, 0x00, 0x62, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x26, 0x00, 0x35, 0x00, 0x44, 0x00, 0x50, 0x00, 0x5b, 0x00,
+  0x67, 0x00, 0x79, 0x00, 0x8b, 0x00, 0x9d, 0x00, 0xac, 0x00, 0xbd, 0x00,
+  0xcf, 0x00, 0x00, 0x00, 0x24, 0x00, 0x41, 0x00, 0x64, 0x00, 0x6e, 0x00,
+  0x78, 0x00, 0x86, 0x00, 0x94, 0x00, 0x9f, 0x00, 0xb5, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x30, 0x00, 0x4d, 0x00, 0x61, 0x00, 0x6f, 0x00, 0x7d, 0x00,
+  0x00, 0x00, 0x26, 0x00, 0x38, 0x00, 0x48, 0x00, 0x57, 0x00, 0x00, 0x00,
+  0x1b, 0x00, 0x2c, 0x00, 0x40, 0x00, 0x00, 0x00, 0x23, 0x00, 0x36, 0x00,
+  0x49, 0x00, 0x58, 0x00, 0x69, 0x00, 0x79, 0x00, 0x00, 0x00, 0x1d, 0x00,
+  0x2f, 0x00, 0x00, 0x00, 0x21, 0x00, 0x33, 0x00, 0x4e, 0x00, 0x60, 0x00,
+  0x6f, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x29, 0x00, 0x36, 0x00,
+  0x43, 0x00, 0x4f, 0x00, 0x5d, 0x00, 0x6d, 0x00, 0x7d, 0x00, 0x88, 0x00,
+  0x96, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x45, 0x00, 0x56, 0x00, 0x64, 0x00,
+  0x76, 0x00, 0x83, 0x00, 0x90, 0x00, 0x00, 0x00, 0x16, 0x00, 0x3a, 0x00,
+  0x68, 0x00, 0x77, 0x00, 0x00, 0x00, 0x14, 0x00, 0x3c, 0x00, 0x59, 0x00,
+  0x65, 0x00, 0x76, 0x00, 0x81, 0x00, 0x8b, 0x00, 0x95, 0x00, 0xa4, 0x00,
+  0xaf, 0x00, 0xb9, 0x00, 0xca, 0x00, 0xd5, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x4d, 0x00, 0x6f, 0x00, 0x7b, 0x00, 0x8c, 0x00, 0x9a, 0x00, 0xa7, 0x00,
+  0xb2, 0x00, 0xc1, 0x00, 0xd4, 0x00, 0xe5, 0x00, 0x02, 0x01, 0x0e, 0x01,
+  0x1b, 0x01, 0x26, 0x01, 0x33, 0x01, 0x00, 0x00, 0x14, 0x00, 0x3c, 0x00,
+  0x65, 0x00, 0x77, 0x00, 0x86, 0x00, 0x91, 0x00, 0xa3, 0x00, 0xab, 0x00,
+  0xba, 0x00, 0xc8, 0x00, 0xd6, 0x00, 0xe5, 0x00, 0xf2, 0x00, 0x02, 0x01,
+  0x11, 0x01, 0x00, 0x00, 0x17, 0x00, 0x29, 0x00, 0x4b, 0x00, 0x59, 0x00,
+  0x6b, 0x00, 0x79, 0x00, 0x87, 0x00, 0x92, 0x00, 0x9d, 0x00, 0xa8, 0x00,
+  0xb7, 0x00, 0xc6, 0x00, 0xd5, 0x00, 0xe0, 0x00, 0xef, 0x00, 0xfd, 0x00,
+  0x08, 0x01, 0x15, 0x01, 0x00, 0x00, 0x0a, 0x00, 0x18, 0x00, 0x29, 0x00,
+  0x3e, 0x00, 0x4b, 0x00, 0x5e, 0x00, 0x6b, 0x00, 0x77, 0x00, 0x83, 0x00,
+  0x8d, 0x00, 0x97, 0x00, 0xa4, 0x00, 0xb0, 0x00, 0xc0, 0x00, 0xca, 0x00,
+  0xd6, 0x00, 0xe7, 0x00, 0xf2, 0x00, 0xfe, 0x00, 0x0a, 0x01, 0x00, 0x00,
+  0x0b, 0x00, 0x1d, 0x00, 0x2c, 0x00, 0x38, 0x00, 0x44, 0x00, 0x51, 0x00,
+  0x66, 0x00, 0x73, 0x00, 0x83, 0x00, 0x93, 0x00, 0xa1, 0x00, 0xad, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x1b, 0x00, 0x2a, 0x00, 0x38, 0x00, 0x46, 0x00,
+  0x54, 0x00, 0x62, 0x00, 0x70, 0x00, 0x83, 0x00, 0x8e, 0x00, 0x9b, 0x00,
+  0xaa, 0x00, 0xbb, 0x00, 0xc8, 0x00, 0xd7, 0x00, 0xea, 0x00, 0xf8, 0x00,
+  0x0b, 0x01, 0x16, 0x01, 0x24, 0x01, 0x34, 0x01, 0x42, 0x01, 0x50, 0x01,
+  0x63, 0x01, 0x73, 0x01, 0x00, 0x00, 0x11, 0x00, 0x25, 0x00, 0x33, 0x00,
+  0x44, 0x00, 0x55, 0x00, 0x62, 0x00, 0x70, 0x00, 0x7e, 0x00, 0x8d, 0x00,
+  0x97, 0x00, 0xa1, 0x00, 0xb1, 0x00, 0xc4, 0x00, 0xd0, 0x00, 0xe1, 0x00,
+  0xf2, 0x00, 0x00, 0x01, 0x0e, 0x01, 0x00, 0x00, 0x0e, 0x00, 0x18, 0x00,
+  0x2b, 0x00, 0x37, 0x00, 0x46, 0x00, 0x52, 0x00, 0x62, 0x00, 0x77, 0x00,
+  0x88, 0x00, 0x99, 0x00, 0xab, 0x00, 0xbc, 0x00, 0xcd, 0x00, 0xdd, 0x00,
+  0xeb, 0x00, 0xfc, 0x00, 0x0a, 0x01, 0x1d, 0x01, 0x31, 0x01, 0x41, 0x01,
+  0x50, 0x01, 0x5a, 0x01, 0x69, 0x01, 0x78, 0x01, 0x86, 0x01, 0x96, 0x01,
+  0xa5, 0x01, 0xb7, 0x01, 0x00, 0x00, 0x0d, 0x00, 0x1a, 0x00, 0x26, 0x00,
+  0x33, 0x00, 0x43, 0x00, 0x51, 0x00, 0x60, 0x00, 0x6f, 0x00, 0x7b, 0x00,
+  0x89, 0x00, 0x94, 0x00, 0x00, 0x00, 0x22, 0x00, 0x33, 0x00, 0x45, 0x00,
+  0x56, 0x00, 0x65, 0x00, 0x73, 0x00, 0x87, 0x00, 0x92, 0x00, 0xa6, 0x00,
+  0xb9, 0x00, 0xcc, 0x00, 0xde, 0x00, 0xe9, 0x00, 0xf4, 0x00, 0x04, 0x01,
+  0x15, 0x01, 0x21, 0x01, 0x35, 0x01, 0x45, 0x01, 0x56, 0x01, 0x63, 0x01,
+  0x6f, 0x01, 0x7b, 0x01, 0x8c, 0x01, 0x9b, 0x01, 0x00, 0x00, 0x0d, 0x00,
+  0x15, 0x00, 0x2c, 0x00, 0x41, 0x00, 0x4e, 0x00, 0x5b, 0x00, 0x67, 0x00,
+  0x76, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x12, 0x00, 0x2f, 0x00, 0x3f, 0x00,
+  0x51, 0x00, 0x63, 0x00, 0x70, 0x00, 0x83, 0x00, 0x91, 0x00, 0xa8, 0x00,
+  0xbe, 0x00, 0xd1, 0x00, 0xde, 0x00, 0xe9, 0x00, 0xf3, 0x00, 0x05, 0x01,
+  0x10, 0x01, 0x1f, 0x01, 0x2a, 0x01, 0x35, 0x01, 0x43, 0x01, 0x57, 0x01,
+  0x65, 0x01, 0x73, 0x01, 0x85, 0x01, 0x97, 0x01, 0xaf, 0x01, 0x00, 0x00,
+  0x2f, 0x00, 0x4c, 0x00, 0x57, 0x00, 0x64, 0x00, 0x6f, 0x00, 0x7b, 0x00,
+  0x8b, 0x00, 0x96, 0x00, 0x00, 0x00, 0x24, 0x00, 0x43, 0x00, 0x4d, 0x00,
+  0x5e, 0x00, 0x69, 0x00, 0x74, 0x00, 0x84, 0x00, 0x8f, 0x00, 0x9a, 0x00,
+  0xac, 0x00, 0xb7, 0x00, 0xc4, 0x00, 0xd3, 0x00, 0xe2, 0x00, 0xf9, 0x00,
+  0x09, 0x01, 0x00, 0x00, 0x24, 0x00, 0x41, 0x00, 0x5e, 0x00, 0x7b, 0x00,
+  0x98, 0x00, 0xaa, 0x00, 0xb7, 0x00, 0xc4, 0x00, 0xcf, 0x00, 0xe0, 0x00,
+  0xeb, 0x00, 0x03, 0x01, 0x17, 0x01, 0x00, 0x00, 0x0e, 0x00, 0x21, 0x00,
+  0x32, 0x00, 0x46, 0x00, 0x53, 0x00, 0x67, 0x00, 0x76, 0x00, 0x8b, 0x00,
+  0x9b, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x2f, 0x00, 0x3b, 0x00, 0x46, 0x00,
+  0x54, 0x00, 0x62, 0x00, 0x73, 0x00, 0x81, 0x00, 0x8f, 0x00, 0x9a, 0x00,
+  0xaa, 0x00, 0xb5, 0x00, 0xcb, 0x00, 0xe4, 0x00, 0xf5, 0x00, 0x01, 0x01,
+  0x10, 0x01, 0x22, 0x01, 0x00, 0x00, 0x12, 0x00, 0x2a, 0x00, 0x3b, 0x00,
+  0x49, 0x00, 0x55, 0x00, 0x62, 0x00, 0x6d, 0x00, 0x7d, 0x00, 0x92, 0x00,
+  0xa1, 0x00, 0xab, 0x00, 0xc1, 0x00, 0x00, 0x00, 0x11, 0x00, 0x2c, 0x00,
+  0x38, 0x00, 0x45, 0x00, 0x54, 0x00, 0x67, 0x00, 0x76, 0x00, 0x82, 0x00,
+  0x91, 0x00, 0x9f, 0x00, 0xac, 0x00, 0xba, 0x00, 0xc8, 0x00, 0xde, 0x00,
+  0xef, 0x00, 0xfd, 0x00, 0x0b, 0x01, 0x00, 0x00, 0x26, 0x00, 0x33, 0x00,
+  0x44, 0x00, 0x52, 0x00, 0x5f, 0x00, 0x6a, 0x00, 0x74, 0x00, 0x8c, 0x00,
+  0x98, 0x00, 0xa7, 0x00, 0xb8, 0x00, 0x00, 0x00, 0x16, 0x00, 0x32, 0x00,
+  0x44, 0x00, 0x57, 0x00, 0x68, 0x00, 0x76, 0x00, 0x86, 0x00, 0x94, 0x00,
+  0xa4, 0x00, 0xb6, 0x00, 0xc6, 0x00, 0xd6, 0x00, 0xe5, 0x00, 0xf0, 0x00,
+  0xfc, 0x00, 0x0e, 0x01, 0x1d, 0x01, 0x2d, 0x01, 0x3d, 0x01, 0x50, 0x01,
+  0x63, 0x01, 0x00, 0x00, 0x19, 0x00, 0x26, 0x00, 0x30, 0x00, 0x3e, 0x00,
+  0x4c, 0x00, 0x5a, 0x00, 0x66, 0x00, 0x70, 0x00, 0x7e, 0x00, 0x88, 0x00,
+  0x9b, 0x00, 0x00, 0x00, 0x19, 0x00, 0x25, 0x00, 0x31, 0x00, 0x3c, 0x00,
+  0x49, 0x00, 0x5b, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x1e, 0x00,
+  0x2b, 0x00, 0x3a, 0x00, 0x46, 0x00, 0x52, 0x00, 0x5d, 0x00, 0x7f, 0x00,
+  0x8e, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x24, 0x00, 0x3b, 0x00, 0x46, 0x00,
+  0x50, 0x00, 0x61, 0x00, 0x6e, 0x00, 0x7c, 0x00, 0x8b, 0x00, 0x9c, 0x00,
+  0xa7, 0x00, 0xb6, 0x00, 0xc6, 0x00, 0xd6, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x1c, 0x00, 0x26, 0x00, 0x00, 0x00, 0x24, 0x00, 0x5a, 0x00, 0x75, 0x00,
+  0x8b, 0x00, 0xa2, 0x00, 0xae, 0x00, 0x00, 0x00, 0x28, 0x00, 0x4a, 0x00,
+  0x5a, 0x00, 0x69, 0x00, 0x78, 0x00, 0x88, 0x00, 0x00, 0x00, 0x22, 0x00,
+  0x5a, 0x00, 0x8f, 0x00, 0x9e, 0x00, 0xac, 0x00, 0x00, 0x00, 0x24, 0x00,
+  0x46, 0x00, 0x54, 0x00, 0x66, 0x00, 0x71, 0x00, 0x7f, 0x00, 0x8c, 0x00,
+  0x99, 0x00, 0xa9, 0x00, 0xba, 0x00, 0xc8, 0x00, 0xd5, 0x00, 0xe2, 0x00,
+  0x00, 0x00, 0x2b, 0x00, 0x5a, 0x00, 0x73, 0x00, 0x84, 0x00, 0x91, 0x00,
+  0x9c, 0x00, 0xa7, 0x00, 0xb9, 0x00, 0xd0, 0x00, 0x00, 0x00, 0x20, 0x00,
+  0x46, 0x00, 0x5d, 0x00, 0x6e, 0x00, 0x79, 0x00, 0x88, 0x00, 0x95, 0x00,
+  0xa4, 0x00, 0xb0, 0x00, 0xc3, 0x00, 0xce, 0x00, 0xdd, 0x00, 0x00, 0x00,
+  0x1e, 0x00, 0x42, 0x00, 0x50, 0x00, 0x5f, 0x00, 0x72, 0x00, 0x83, 0x00,
+  0x8f, 0x00, 0x9b, 0x00, 0xaa, 0x00, 0xbe, 0x00, 0xcb, 0x00, 0xd6, 0x00,
+  0xe4, 0x00, 0xf3, 0x00, 0x01, 0x01, 0x0b, 0x01, 0x1c, 0x01, 0x3d, 0x01,
+  0x00, 0x00, 0x14, 0x00, 0x20, 0x00, 0x2d, 0x00, 0x38, 0x00, 0x47, 0x00,
+  0x56, 0x00, 0x63, 0x00, 0x70, 0x00, 0x83, 0x00, 0x92, 0x00, 0xa0, 0x00,
+  0xb1, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x6e, 0x00, 0x7e, 0x00, 0x8d, 0x00,
+  0x95, 0x00, 0x9d, 0x00, 0xa5, 0x00, 0xba, 0x00, 0xc8, 0x00, 0xd7, 0x00,
+  0xe4, 0x00, 0xf1, 0x00, 0x00, 0x01, 0x10, 0x01, 0x21, 0x01, 0x2f, 0x01,
+  0x00, 0x00, 0x13, 0x00, 0x35, 0x00, 0x67, 0x00, 0x83, 0x00, 0x99, 0x00,
+  0xb2, 0x00, 0xc2, 0x00, 0xda, 0x00, 0xe5, 0x00, 0xf1, 0x00, 0x02, 0x01,
+  0x13, 0x01, 0x1e, 0x01, 0x2a, 0x01, 0x36, 0x01, 0x46, 0x01, 0x58, 0x01,
+  0x65, 0x01, 0x73, 0x01, 0x7f, 0x01, 0x88, 0x01, 0x93, 0x01, 0xa4, 0x01,
+  0xb0, 0x01, 0xbc, 0x01, 0xc8, 0x01, 0xd5, 0x01, 0xe1, 0x01, 0xf1, 0x01,
+  0x00, 0x00, 0x4e, 0x00, 0x75, 0x00, 0x9b, 0x00, 0xab, 0x00, 0xc0, 0x00,
+  0xd3, 0x00, 0xe2, 0x00, 0xee, 0x00, 0xfd, 0x00, 0x0b, 0x01, 0x2c, 0x01,
+  0x3e, 0x01, 0x4b, 0x01, 0x56, 0x01, 0x61, 0x01, 0x6c, 0x01, 0x7f, 0x01,
+  0x8b, 0x01, 0x9d, 0x01, 0xb0, 0x01, 0xbb, 0x01, 0xcc, 0x01, 0xd9, 0x01,
+  0xe7, 0x01, 0xf5, 0x01, 0x00, 0x00, 0x24, 0x00, 0x46, 0x00, 0x5d, 0x00,
+  0x6d, 0x00, 0x8d, 0x00, 0x9a, 0x00, 0xab, 0x00, 0xb7, 0x00, 0xc5, 0x00,
+  0xd4, 0x00, 0xe3, 0x00, 0xee, 0x00, 0xfb, 0x00, 0x09, 0x01, 0x15, 0x01,
+  0x21, 0x01, 0x2b, 0x01, 0x39, 0x01, 0x46, 0x01, 0x54, 0x01, 0x6b, 0x01,
+  0x78, 0x01, 0x86, 0x01, 0x93, 0x01, 0x00, 0x00, 0x12, 0x00, 0x31, 0x00,
+  0x48, 0x00, 0x55, 0x00, 0x62, 0x00, 0x73, 0x00, 0x83, 0x00, 0x90, 0x00,
+  0xa2, 0x00, 0xaf, 0x00, 0xbd, 0x00, 0xcb, 0x00, 0xd9, 0x00, 0xe6, 0x00,
+  0xf3, 0x00, 0xff, 0x00, 0x11, 0x01, 0x1d, 0x01, 0x30, 0x01, 0x3c, 0x01,
+  0x46, 0x01, 0x52, 0x01, 0x5d, 0x01, 0x6b, 0x01, 0x75, 0x01, 0x87, 0x01,
+  0x99, 0x01, 0xa6, 0x01, 0xb2, 0x01, 0x00, 0x00, 0x30, 0x00, 0x40, 0x00,
+  0x52, 0x00, 0x69, 0x00, 0x78, 0x00, 0x87, 0x00, 0x96, 0x00, 0xa7, 0x00,
+  0xb5, 0x00, 0xc4, 0x00, 0xd5, 0x00, 0xe8, 0x00, 0xf8, 0x00, 0x07, 0x01,
+  0x16, 0x01, 0x27, 0x01, 0x38, 0x01, 0x49, 0x01, 0x55, 0x01, 0x63, 0x01,
+  0x72, 0x01, 0x84, 0x01, 0x94, 0x01, 0xa0, 0x01, 0xad, 0x01, 0xbd, 0x01,
+  0xcd, 0x01, 0xdf, 0x01, 0xee, 0x01, 0xfa, 0x01, 0x00, 0x00, 0x1c, 0x00,
+  0x30, 0x00, 0x42, 0x00, 0x54, 0x00, 0x67, 0x00, 0x76, 0x00, 0x84, 0x00,
+  0x94, 0x00, 0xa0, 0x00, 0xb0, 0x00, 0xc3, 0x00, 0xd1, 0x00, 0xdd, 0x00,
+  0xed, 0x00, 0xf8, 0x00, 0x07, 0x01, 0x00, 0x00, 0x10, 0x00, 0x20, 0x00,
+  0x45, 0x00, 0x51, 0x00, 0x60, 0x00, 0x6b, 0x00, 0x7b, 0x00, 0x8a, 0x00,
+  0x9d, 0x00, 0xaf, 0x00, 0xba, 0x00, 0xc7, 0x00, 0xd1, 0x00, 0xe2, 0x00,
+  0xf4, 0x00, 0x01, 0x01, 0x11, 0x01, 0x1e, 0x01, 0x2c, 0x01, 0x3e, 0x01,
+  0x50, 0x01, 0x61, 0x01, 0x74, 0x01, 0x87, 0x01, 0x97, 0x01, 0x00, 0x00,
+  0x1c, 0x00, 0x39, 0x00, 0x54, 0x00, 0x60, 0x00, 0x6e, 0x00, 0x76, 0x00,
+  0x80, 0x00, 0x8e, 0x00, 0x9f, 0x00, 0xac, 0x00, 0xb6, 0x00, 0xc6, 0x00,
+  0xd1, 0x00, 0xdd, 0x00, 0xe7, 0x00, 0xf3, 0x00, 0xff, 0x00, 0x09, 0x01,
+  0x21, 0x01, 0x32, 0x01, 0x43, 0x01, 0x52, 0x01, 0x5d, 0x01, 0x00, 0x00,
+  0x10, 0x00, 0x22, 0x00, 0x30, 0x00, 0x3e, 0x00, 0x4d, 0x00, 0x5f, 0x00,
+  0x6c, 0x00, 0x7a, 0x00, 0x88, 0x00, 0x9b, 0x00, 0xaa, 0x00, 0xbe, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x1e, 0x00, 0x2a, 0x00, 0x3b, 0x00, 0x49, 0x00,
+  0x59, 0x00, 0x64, 0x00, 0x74, 0x00, 0x83, 0x00, 0x90, 0x00, 0xac, 0x00,
+  0xb9, 0x00, 0xc8, 0x00, 0xdb, 0x00, 0x00, 0x00, 0x24, 0x00, 0x3f, 0x00,
+  0x55, 0x00, 0x65, 0x00, 0x70, 0x00, 0x81, 0x00, 0x97, 0x00, 0xa6, 0x00,
+  0xb9, 0x00, 0xc9, 0x00, 0xd8, 0x00, 0xe7, 0x00, 0xfc, 0x00, 0x0c, 0x01,
+  0x00, 0x00, 0x30, 0x00, 0x47, 0x00, 0x5d, 0x00, 0x69, 0x00, 0x7e, 0x00,
+  0x8b, 0x00, 0x95, 0x00, 0xa2, 0x00, 0xae, 0x00, 0xba, 0x00, 0xc5, 0x00,
+  0xd1, 0x00, 0xe9, 0x00, 0xf5, 0x00, 0x00, 0x00, 0x21, 0x00, 0x2c, 0x00,
+  0x3e, 0x00, 0x4d, 0x00, 0x5f, 0x00, 0x71, 0x00, 0x86, 0x00, 0x90, 0x00,
+  0xa2, 0x00, 0xb0, 0x00, 0xbc, 0x00, 0xce, 0x00, 0xe1, 0x00, 0xef, 0x00,
+  0x06, 0x01, 0x1d, 0x01, 0x00, 0x00, 0x24, 0x00, 0x3b, 0x00, 0x47, 0x00,
+  0x55, 0x00, 0x63, 0x00, 0x6e, 0x00, 0x7c, 0x00, 0x8a, 0x00, 0x99, 0x00,
+  0xa5, 0x00, 0xaf, 0x00, 0xc2, 0x00, 0xcc, 0x00, 0xda, 0x00, 0xe8, 0x00,
+  0xf6, 0x00, 0x04, 0x01, 0x12, 0x01, 0x21, 0x01, 0x2f, 0x01, 0x3d, 0x01,
+  0x4b, 0x01, 0x00, 0x00, 0x10, 0x00, 0x1f, 0x00, 0x31, 0x00, 0x3e, 0x00,
+  0x00, 0x00, 0x19, 0x00, 0x2a, 0x00, 0x3f, 0x00, 0x4c, 0x00, 0x59, 0x00,
+  0x66, 0x00, 0x73, 0x00, 0x81, 0x00, 0x8d, 0x00, 0x99, 0x00, 0xa7, 0x00,
+  0xb5, 0x00, 0xc6, 0x00, 0xd6, 0x00, 0x00, 0x00, 0x17, 0x00, 0x29, 0x00,
+  0x4a, 0x00, 0x6d, 0x00, 0x77, 0x00, 0x83, 0x00, 0x91, 0x00, 0x9d, 0x00,
+  0xa9, 0x00, 0xbc, 0x00, 0xca, 0x00, 0xdb, 0x00, 0x00, 0x00, 0x22, 0x00,
+  0x30, 0x00, 0x42, 0x00, 0x58, 0x00, 0x71, 0x00, 0x84, 0x00, 0x95, 0x00,
+  0xa6, 0x00, 0xb6, 0x00, 0xc2, 0x00, 0xcd, 0x00, 0xda, 0x00, 0xe5, 0x00,
+  0xf7, 0x00, 0x04, 0x01, 0x11, 0x01, 0x00, 0x00, 0x10, 0x00, 0x29, 0x00,
+  0x40, 0x00, 0x50, 0x00, 0x67, 0x00, 0x72, 0x00, 0x80, 0x00, 0x8e, 0x00,
+  0x9e, 0x00, 0xb2, 0x00, 0xbf, 0x00, 0xcc, 0x00, 0xe9, 0x00, 0xf5, 0x00,
+  0x02, 0x01, 0x0f, 0x01, 0x1b, 0x01, 0x29, 0x01, 0x38, 0x01, 0x4a, 0x01,
+  0x5d, 0x01, 0x6a, 0x01, 0x00, 0x00, 0x1e, 0x00, 0x43, 0x00, 0x53, 0x00,
+  0x68, 0x00, 0x83, 0x00, 0x99, 0x00, 0xa8, 0x00, 0xb6, 0x00, 0xc4, 0x00,
+  0xd7, 0x00, 0xea, 0x00, 0x00, 0x01, 0x00, 0x00, 0x22, 0x00, 0x3d, 0x00,
+  0x53, 0x00, 0x6a, 0x00, 0x7a, 0x00, 0x89, 0x00, 0x99, 0x00, 0xa9, 0x00,
+  0xb9, 0x00, 0xc3, 0x00, 0xcd, 0x00, 0xda, 0x00, 0xeb, 0x00, 0xfd, 0x00,
+  0x0d, 0x01, 0x00, 0x00, 0x29, 0x00, 0x4e, 0x00, 0x5a, 0x00, 0x6d, 0x00,
+  0x82, 0x00, 0xb3, 0x00, 0xc3, 0x00, 0xd4, 0x00, 0xe3, 0x00, 0xfa, 0x00,
+  0x00, 0x00, 0x22, 0x00, 0x3e, 0x00, 0x5e, 0x00, 0x6e, 0x00, 0x82, 0x00,
+  0x92, 0x00, 0xaf, 0x00, 0xbd, 0x00, 0xca, 0x00, 0x00, 0x00, 0x38, 0x00,
+  0x58, 0x00, 0x86, 0x00, 0xb5, 0x00, 0xd1, 0x00, 0xea, 0x00, 0xff, 0x00,
+  0x21, 0x01, 0x2d, 0x01, 0x39, 0x01, 0x44, 0x01, 0x4e, 0x01, 0x58, 0x01,
+  0x6c, 0x01, 0x00, 0x00, 0x2d, 0x00, 0x69, 0x00, 0x80, 0x00, 0x94, 0x00,
+  0xb0, 0x00, 0xc8, 0x00, 0xd3, 0x00, 0xe7, 0x00, 0xf3, 0x00, 0xfe, 0x00,
+  0x09, 0x01, 0x15, 0x01, 0x20, 0x01, 0x32, 0x01, 0x3e, 0x01, 0x49, 0x01,
+  0x54, 0x01, 0x5f, 0x01, 0x00, 0x00, 0x26, 0x00, 0x4a, 0x00, 0x6a, 0x00,
+  0x78, 0x00, 0x93, 0x00, 0xac, 0x00, 0xc1, 0x00, 0x00, 0x00, 0x22, 0x00,
+  0x51, 0x00, 0x67, 0x00, 0x75, 0x00, 0x90, 0x00, 0xb3, 0x00, 0xc0, 0x00,
+  0xd6, 0x00, 0xe1, 0x00, 0xef, 0x00, 0xfa, 0x00, 0x08, 0x01, 0x15, 0x01,
+  0x23, 0x01, 0x35, 0x01, 0x41, 0x01, 0x51, 0x01, 0x5e, 0x01, 0x6b, 0x01,
+  0x00, 0x00, 0x22, 0x00, 0x4d, 0x00, 0x79, 0x00, 0x89, 0x00, 0xa6, 0x00,
+  0xbf, 0x00, 0xcf, 0x00, 0xe0, 0x00, 0xee, 0x00, 0xf9, 0x00, 0x08, 0x01,
+  0x1d, 0x01, 0x2b, 0x01, 0x39, 0x01, 0x00, 0x00, 0x2e, 0x00, 0x50, 0x00,
+  0x70, 0x00, 0x98, 0x00, 0xc6, 0x00, 0xd8, 0x00, 0xe6, 0x00, 0x0c, 0x01,
+  0x18, 0x01, 0x2a, 0x01, 0x3d, 0x01, 0x47, 0x01, 0x58, 0x01, 0x67, 0x01,
+  0x79, 0x01, 0x89, 0x01, 0x94, 0x01, 0x9e, 0x01, 0x00, 0x00, 0x2f, 0x00,
+  0x4d, 0x00, 0x7c, 0x00, 0xa3, 0x00, 0xb9, 0x00, 0xcd, 0x00, 0xf5, 0x00,
+  0x00, 0x01, 0x0b, 0x01, 0x16, 0x01, 0x22, 0x01, 0x2d, 0x01, 0x3c, 0x01,
+  0x4a, 0x01, 0x56, 0x01, 0x64, 0x01, 0x70, 0x01, 0x80, 0x01, 0x8a, 0x01,
+  0x95, 0x01, 0xa2, 0x01, 0xad, 0x01, 0xbb, 0x01, 0xc9, 0x01, 0xd6, 0x01,
+  0xe2, 0x01, 0xf0, 0x01, 0xfe, 0x01, 0x09, 0x02, 0x14, 0x02, 0x1f, 0x02,
+  0x2a, 0x02, 0x37, 0x02, 0x4c, 0x02, 0x57, 0x02, 0x61, 0x02, 0x00, 0x00,
+  0x22, 0x00, 0x46, 0x00, 0x77, 0x00, 0x93, 0x00, 0xa5, 0x00, 0xb9, 0x00,
+  0xd0, 0x00, 0xde, 0x00, 0xf0, 0x00, 0xfb, 0x00, 0x07, 0x01, 0x13, 0x01,
+  0x1e, 0x01, 0x2d, 0x01, 0x3a, 0x01, 0x44, 0x01, 0x50, 0x01, 0x5b, 0x01,
+  0x67, 0x01, 0x72, 0x01, 0x80, 0x01, 0x8c, 0x01, 0x98, 0x01, 0xa3, 0x01,
+  0xaf, 0x01, 0x00, 0x00, 0x24, 0x00, 0x57, 0x00, 0x79, 0x00, 0x8e, 0x00,
+  0x9e, 0x00, 0xba, 0x00, 0xd6, 0x00, 0xe3, 0x00, 0xee, 0x00, 0xfc, 0x00,
+  0x07, 0x01, 0x15, 0x01, 0x23, 0x01, 0x2e, 0x01, 0x3b, 0x01, 0x49, 0x01,
+  0x56, 0x01, 0x64, 0x01, 0x70, 0x01, 0x7d, 0x01, 0x8b, 0x01, 0x96, 0x01,
+  0xa1, 0x01, 0xae, 0x01, 0xb9, 0x01, 0xc6, 0x01, 0xd3, 0x01, 0xdf, 0x01,
+  0xee, 0x01, 0xfd, 0x01, 0x0c, 0x02, 0x19, 0x02, 0x26, 0x02, 0x32, 0x02,
+  0x3f, 0x02, 0x4c, 0x02, 0x5c, 0x02, 0x6c, 0x02, 0x79, 0x02, 0x86, 0x02,
+  0x91, 0x02, 0x9d, 0x02, 0xaa, 0x02, 0xb7, 0x02, 0xc3, 0x02, 0xcf, 0x02,
+  0xdc, 0x02, 0x00, 0x00, 0x28, 0x00, 0x4c, 0x00, 0x6a, 0x00, 0x86, 0x00,
+  0x9b, 0x00, 0xb1, 0x00, 0xbb, 0x00, 0xc5, 0x00, 0xd1, 0x00, 0xe1, 0x00,
+  0xed, 0x00, 0xf9, 0x00, 0x05, 0x01, 0x16, 0x01, 0x22, 0x01, 0x35, 0x01,
+  0x41, 0x01, 0x51, 0x01, 0x5d, 0x01, 0x69, 0x01, 0x74, 0x01, 0x84, 0x01,
+  0x8f, 0x01, 0x9d, 0x01, 0xaa, 0x01, 0xb7, 0x01, 0xc4, 0x01, 0xd1, 0x01,
+  0xdd, 0x01, 0xf0, 0x01, 0xfc, 0x01, 0x00, 0x00, 0x49, 0x00, 0x6b, 0x00,
+  0x91, 0x00, 0xb3, 0x00, 0xd8, 0x00, 0xe4, 0x00, 0x01, 0x01, 0x16, 0x01,
+  0x24, 0x01, 0x34, 0x01, 0x42, 0x01, 0x50, 0x01, 0x5d, 0x01, 0x68, 0x01,
+  0x74, 0x01, 0x7e, 0x01, 0x8c, 0x01, 0x99, 0x01, 0xa6, 0x01, 0xb3, 0x01,
+  0xc2, 0x01, 0xd0, 0x01, 0xdc, 0x01, 0xe8, 0x01, 0xf3, 0x01, 0x00, 0x00,
+  0x2c, 0x00, 0x50, 0x00, 0x6e, 0x00, 0x7e, 0x00, 0x90, 0x00, 0xb7, 0x00,
+  0xc5, 0x00, 0xd4, 0x00, 0xe2, 0x00, 0xf1, 0x00, 0xff, 0x00, 0x0c, 0x01,
+  0x1c, 0x01, 0x2a, 0x01, 0x39, 0x01, 0x49, 0x01, 0x54, 0x01, 0x62, 0x01,
+  0x6d, 0x01, 0x7b, 0x01, 0x8b, 0x01, 0x9c, 0x01, 0xa8, 0x01, 0xb6, 0x01,
+  0xc3, 0x01, 0xd4, 0x01, 0xe3, 0x01, 0xee, 0x01, 0xfd, 0x01, 0x07, 0x02,
+  0x14, 0x02, 0x1f, 0x02, 0x00, 0x00, 0x26, 0x00, 0x77, 0x00, 0x9b, 0x00,
+  0xc2, 0x00, 0xd2, 0x00, 0xe6, 0x00, 0xff, 0x00, 0x0b, 0x01, 0x1c, 0x01,
+  0x29, 0x01, 0x37, 0x01, 0x44, 0x01, 0x50, 0x01, 0x5f, 0x01, 0x6c, 0x01,
+  0x7b, 0x01, 0x87, 0x01, 0x95, 0x01, 0xa3, 0x01, 0xad, 0x01, 0xc2, 0x01,
+  0xd0, 0x01, 0xdc, 0x01, 0xe9, 0x01, 0xf6, 0x01, 0x03, 0x02, 0x10, 0x02,
+  0x1f, 0x02, 0x00, 0x00, 0x26, 0x00, 0x4a, 0x00, 0x7f, 0x00, 0x9d, 0x00,
+  0xc5, 0x00, 0xd2, 0x00, 0xda, 0x00, 0xea, 0x00, 0xf8, 0x00, 0x04, 0x01,
+  0x15, 0x01, 0x26, 0x01, 0x37, 0x01, 0x45, 0x01, 0x55, 0x01, 0x63, 0x01,
+  0x6e, 0x01, 0x82, 0x01, 0x8d, 0x01, 0x9e, 0x01, 0xaa, 0x01, 0xba, 0x01,
+  0xc4, 0x01, 0xd4, 0x01, 0xe4, 0x01, 0xf4, 0x01, 0x04, 0x02, 0x15, 0x02,
+  0x25, 0x02, 0x36, 0x02, 0x44, 0x02, 0x53, 0x02, 0x5f, 0x02, 0x6b, 0x02,
+  0x7c, 0x02, 0x85, 0x02, 0x94, 0x02, 0xa3, 0x02, 0x00, 0x00, 0x24, 0x00,
+  0x36, 0x00, 0x5a, 0x00, 0x75, 0x00, 0x85, 0x00, 0x97, 0x00, 0xa8, 0x00,
+  0xbb, 0x00, 0xc8, 0x00, 0xda, 0x00, 0xe5, 0x00, 0xef, 0x00, 0xfa, 0x00,
+  0x0b, 0x01, 0x1a, 0x01, 0x2e, 0x01, 0x40, 0x01, 0x52, 0x01, 0x60, 0x01,
+  0x6b, 0x01, 0x75, 0x01, 0x89, 0x01, 0x9b, 0x01, 0xae, 0x01, 0xc1, 0x01,
+  0xcb, 0x01, 0xde, 0x01, 0xf1, 0x01, 0x01, 0x02, 0x13, 0x02, 0x27, 0x02,
+  0x39, 0x02, 0x49, 0x02, 0x5b, 0x02, 0x6d, 0x02, 0x7c, 0x02, 0x8b, 0x02,
+  0x00, 0x00, 0x2b, 0x00, 0x40, 0x00, 0x5b, 0x00, 0x91, 0x00, 0xa3, 0x00,
+  0xb4, 0x00, 0xc0, 0x00, 0xd2, 0x00, 0xe5, 0x00, 0xf5, 0x00, 0x01, 0x01,
+  0x11, 0x01, 0x25, 0x01, 0x39, 0x01, 0x46, 0x01, 0x57, 0x01, 0x69, 0x01,
+  0x76, 0x01, 0x84, 0x01, 0x95, 0x01, 0x9f, 0x01, 0xad, 0x01, 0xc0, 0x01,
+  0x00, 0x00, 0x20, 0x00, 0x36, 0x00, 0x5b, 0x00, 0x71, 0x00, 0x7e, 0x00,
+  0x86, 0x00, 0x95, 0x00, 0xa1, 0x00, 0xac, 0x00, 0xb7, 0x00, 0xc4, 0x00,
+  0xda, 0x00, 0xe6, 0x00, 0xfa, 0x00, 0x10, 0x01, 0x1b, 0x01, 0x30, 0x01,
+  0x45, 0x01, 0x00, 0x00, 0x12, 0x00, 0x27, 0x00, 0x3f, 0x00, 0x4d, 0x00,
+  0x5a, 0x00, 0x6d, 0x00, 0x78, 0x00, 0x84, 0x00, 0x8f, 0x00, 0x98, 0x00,
+  0xa8, 0x00, 0xbd, 0x00, 0xcc, 0x00, 0xdc, 0x00, 0xec, 0x00, 0xfd, 0x00,
+  0x0c, 0x01, 0x1c, 0x01, 0x2b, 0x01, 0x38, 0x01, 0x4c, 0x01, 0x5d, 0x01,
+  0x6e, 0x01, 0x7a, 0x01, 0x88, 0x01, 0x9a, 0x01, 0xa7, 0x01, 0xb5, 0x01,
+  0xc3, 0x01, 0xd4, 0x01, 0x00, 0x00, 0x29, 0x00, 0x4f, 0x00, 0x75, 0x00,
+  0x93, 0x00, 0xa5, 0x00, 0xb9, 0x00, 0xcd, 0x00, 0xd7, 0x00, 0xe0, 0x00,
+  0xed, 0x00, 0xfc, 0x00, 0x09, 0x01, 0x17, 0x01, 0x25, 0x01, 0x39, 0x01,
+  0x00, 0x00, 0x24, 0x00, 0x48, 0x00, 0x6a, 0x00, 0x8a, 0x00, 0xa5, 0x00,
+  0xb5, 0x00, 0xd7, 0x00, 0xe6, 0x00, 0xf5, 0x00, 0x07, 0x01, 0x14, 0x01,
+  0x27, 0x01, 0x39, 0x01, 0x48, 0x01, 0x55, 0x01, 0x60, 0x01, 0x6b, 0x01,
+  0x7d, 0x01, 0x8c, 0x01, 0x98, 0x01, 0xaa, 0x01, 0xb8, 0x01, 0xd0, 0x01,
+  0xde, 0x01, 0xee, 0x01, 0xfc, 0x01, 0x0c, 0x02, 0x1d, 0x02, 0x00, 0x00,
+  0x2d, 0x00, 0x4f, 0x00, 0x7e, 0x00, 0x8c, 0x00, 0xa2, 0x00, 0xcb, 0x00,
+  0xfc, 0x00, 0x07, 0x01, 0x12, 0x01, 0x20, 0x01, 0x31, 0x01, 0x3b, 0x01,
+  0x4b, 0x01, 0x57, 0x01, 0x00, 0x00, 0x26, 0x00, 0x4c, 0x00, 0x63, 0x00,
+  0x71, 0x00, 0x8e, 0x00, 0xa0, 0x00, 0xb4, 0x00, 0xc5, 0x00, 0xd2, 0x00,
+  0xe6, 0x00, 0xf7, 0x00, 0x08, 0x01, 0x1b, 0x01, 0x28, 0x01, 0x33, 0x01,
+  0x3e, 0x01, 0x56, 0x01, 0x6a, 0x01, 0x82, 0x01, 0x91, 0x01, 0xa1, 0x01,
+  0xb5, 0x01, 0x00, 0x00, 0x1e, 0x00, 0x40, 0x00, 0x72, 0x00, 0x84, 0x00,
+  0x98, 0x00, 0xaf, 0x00, 0xd0, 0x00, 0xdf, 0x00, 0xf1, 0x00, 0xfd, 0x00,
+  0x08, 0x01, 0x12, 0x01, 0x1f, 0x01, 0x2b, 0x01, 0x3a, 0x01, 0x44, 0x01,
+  0x53, 0x01, 0x61, 0x01, 0x6f, 0x01, 0x7e, 0x01, 0x00, 0x00, 0x12, 0x00,
+  0x24, 0x00, 0x3b, 0x00, 0x57, 0x00, 0x6c, 0x00, 0x78, 0x00, 0x90, 0x00,
+  0xa5, 0x00, 0xb3, 0x00, 0xc9, 0x00, 0xe0, 0x00, 0xf0, 0x00, 0xfc, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x22, 0x00, 0x32, 0x00, 0x66, 0x00, 0x74, 0x00,
+  0x82, 0x00, 0x90, 0x00, 0xa0, 0x00, 0xb6, 0x00, 0xc4, 0x00, 0xcf, 0x00,
+  0xe0, 0x00, 0xf0, 0x00, 0xfd, 0x00, 0x00, 0x00, 0x17, 0x00, 0x2b, 0x00,
+  0x36, 0x00, 0x40, 0x00, 0x52, 0x00, 0x5f, 0x00, 0x6a, 0x00, 0x74, 0x00,
+  0x80, 0x00, 0x93, 0x00, 0xa0, 0x00, 0xaa, 0x00, 0xc3, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x1c, 0x00, 0x2d, 0x00, 0x3f, 0x00, 0x52, 0x00, 0x62, 0x00,
+  0x6e, 0x00, 0x7e, 0x00, 0x90, 0x00, 0x9f, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x27, 0x00, 0x33, 0x00, 0x44, 0x00, 0x52, 0x00, 0x6e, 0x00, 0x7b, 0x00,
+  0x00, 0x00, 0x17, 0x00, 0x2c, 0x00, 0x3c, 0x00, 0x48, 0x00, 0x57, 0x00,
+  0x69, 0x00, 0x7b, 0x00, 0x8b, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x3c, 0x00,
+  0x56, 0x00, 0x68, 0x00, 0x77, 0x00, 0x86, 0x00, 0x92, 0x00, 0xa3, 0x00,
+  0xb3, 0x00, 0xc2, 0x00, 0xd5, 0x00, 0xe5, 0x00, 0xf5, 0x00, 0x05, 0x01,
+  0x14, 0x01, 0x00, 0x00, 0x22, 0x00, 0x46, 0x00, 0x56, 0x00, 0x62, 0x00,
+  0x71, 0x00, 0x81, 0x00, 0x93, 0x00, 0xa5, 0x00, 0xb9, 0x00, 0xcd, 0x00,
+  0x00, 0x00, 0x20, 0x00, 0x37, 0x00, 0x45, 0x00, 0x57, 0x00, 0x69, 0x00,
+  0x7b, 0x00, 0x99, 0x00, 0x00, 0x00, 0x28, 0x00, 0x3a, 0x00, 0x50, 0x00,
+  0x66, 0x00, 0x72, 0x00, 0x80, 0x00, 0x90, 0x00, 0xa7, 0x00, 0xba, 0x00,
+  0x00, 0x00, 0x2c, 0x00, 0x3e, 0x00, 0x4a, 0x00, 0x5b, 0x00, 0x6d, 0x00,
+  0x82, 0x00, 0x96, 0x00, 0x9f, 0x00, 0xb1, 0x00, 0xc5, 0x00, 0xd1, 0x00,
+  0xe0, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x3e, 0x00, 0x53, 0x00,
+  0x6d, 0x00, 0x7a, 0x00, 0x87, 0x00, 0x92, 0x00, 0x9b, 0x00, 0xa8, 0x00,
+  0x00, 0x00, 0x24, 0x00, 0x3f, 0x00, 0x5d, 0x00, 0x68, 0x00, 0x75, 0x00,
+  0x80, 0x00, 0x8c, 0x00, 0x98, 0x00, 0xab, 0x00, 0xb7, 0x00, 0xc4, 0x00,
+  0xd1, 0x00, 0xde, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x3c, 0x00, 0x47, 0x00,
+  0x55, 0x00, 0x63, 0x00, 0x00, 0x00, 0x22, 0x00, 0x42, 0x00, 0x5d, 0x00,
+  0x68, 0x00, 0x73, 0x00, 0x7e, 0x00, 0x88, 0x00, 0x93, 0x00, 0xa1, 0x00,
+  0x00, 0x00, 0x38, 0x00, 0x53, 0x00, 0x67, 0x00, 0x72, 0x00, 0x7d, 0x00,
+  0x89, 0x00, 0xa8, 0x00, 0xb8, 0x00, 0xc2, 0x00, 0xce, 0x00, 0xd9, 0x00,
+  0x00, 0x00, 0x1e, 0x00, 0x2a, 0x00, 0x40, 0x00, 0x4b, 0x00, 0x56, 0x00,
+  0x62, 0x00, 0x72, 0x00, 0x7d, 0x00, 0x8a, 0x00, 0x95, 0x00, 0xa1, 0x00,
+  0xad, 0x00, 0xb7, 0x00, 0xc2, 0x00, 0xcd, 0x00, 0xd9, 0x00, 0xec, 0x00,
+  0xf8, 0x00, 0x02, 0x01, 0x00, 0x00, 0x1e, 0x00, 0x47, 0x00, 0x69, 0x00,
+  0x86, 0x00, 0xa3, 0x00, 0xae, 0x00, 0xbb, 0x00, 0xc9, 0x00, 0xd4, 0x00,
+  0xdf, 0x00, 0xea, 0x00, 0xf7, 0x00, 0x04, 0x01, 0x10, 0x01, 0x1e, 0x01,
+  0x2c, 0x01, 0x38, 0x01, 0x44, 0x01, 0x51, 0x01, 0x5d, 0x01, 0x69, 0x01,
+  0x75, 0x01, 0x81, 0x01, 0x8d, 0x01, 0x9a, 0x01, 0xa5, 0x01, 0xb2, 0x01,
+  0xbf, 0x01, 0xca, 0x01, 0xd6, 0x01, 0xe3, 0x01, 0xf0, 0x01, 0xfb, 0x01,
+  0x05, 0x02, 0x13, 0x02, 0x21, 0x02, 0x30, 0x02, 0x3f, 0x02, 0x4b, 0x02,
+  0x57, 0x02, 0x00, 0x00, 0x22, 0x00, 0x2d, 0x00, 0x39, 0x00, 0x49, 0x00,
+  0x55, 0x00, 0x61, 0x00, 0x6d, 0x00, 0x7f, 0x00, 0x91, 0x00, 0x9d, 0x00,
+  0xaa, 0x00, 0xb8, 0x00, 0xc8, 0x00, 0xd3, 0x00, 0xdf, 0x00, 0xec, 0x00,
+  0xf6, 0x00, 0x02, 0x01, 0x0d, 0x01, 0x00, 0x00, 0x26, 0x00, 0x4c, 0x00,
+  0x6e, 0x00, 0x80, 0x00, 0x91, 0x00, 0xa0, 0x00, 0xac, 0x00, 0xbd, 0x00,
+  0xca, 0x00, 0xd6, 0x00, 0xe1, 0x00, 0xed, 0x00, 0xff, 0x00, 0x0c, 0x01,
+  0x1e, 0x01, 0x2b, 0x01, 0x37, 0x01, 0x48, 0x01, 0x54, 0x01, 0x63, 0x01,
+  0x6f, 0x01, 0x8e, 0x01, 0x9a, 0x01, 0xa5, 0x01, 0x00, 0x00, 0x0f, 0x00,
+  0x38, 0x00, 0x45, 0x00, 0x53, 0x00, 0x60, 0x00, 0x70, 0x00, 0x7e, 0x00,
+  0x8a, 0x00, 0x9a, 0x00, 0xa6, 0x00, 0xbb, 0x00, 0xcc, 0x00, 0xdd, 0x00,
+  0xec, 0x00, 0xf6, 0x00, 0x04, 0x01, 0x11, 0x01, 0x1f, 0x01, 0x2f, 0x01,
+  0x40, 0x01, 0x4c, 0x01, 0x00, 0x00, 0x2f, 0x00, 0x3d, 0x00, 0x4e, 0x00,
+  0x5f, 0x00, 0x6f, 0x00, 0x7d, 0x00, 0x8b, 0x00, 0x99, 0x00, 0xa7, 0x00,
+  0xb5, 0x00, 0xc4, 0x00, 0xd2, 0x00, 0xdf, 0x00, 0xee, 0x00, 0xfd, 0x00,
+  0x0e, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x39, 0x01, 0x46, 0x01, 0x55, 0x01,
+  0x64, 0x01, 0x73, 0x01, 0x80, 0x01, 0x91, 0x01, 0xa0, 0x01, 0xad, 0x01,
+  0x00, 0x00, 0x27, 0x00, 0x45, 0x00, 0x50, 0x00, 0x5b, 0x00, 0x6e, 0x00,
+  0x7e, 0x00, 0x90, 0x00, 0x9e, 0x00, 0xa9, 0x00, 0xba, 0x00, 0xc7, 0x00,
+  0xd3, 0x00, 0xe5, 0x00, 0xf6, 0x00, 0x04, 0x01, 0x14, 0x01, 0x1f, 0x01,
+  0x2a, 0x01, 0x3c, 0x01, 0x00, 0x00, 0x20, 0x00, 0x3e, 0x00, 0x60, 0x00,
+  0x73, 0x00, 0x7e, 0x00, 0x8d, 0x00, 0xa0, 0x00, 0xb3, 0x00, 0xc2, 0x00,
+  0xd4, 0x00, 0xe3, 0x00, 0xf7, 0x00, 0x09, 0x01, 0x16, 0x01, 0x25, 0x01,
+  0x31, 0x01, 0x45, 0x01, 0x59, 0x01, 0x6f, 0x01, 0x7e, 0x01, 0x91, 0x01,
+  0xa7, 0x01, 0xb6, 0x01, 0xcb, 0x01, 0xda, 0x01, 0xeb, 0x01, 0xfc, 0x01,
+  0x0d, 0x02, 0x1e, 0x02, 0x00, 0x00, 0x2f, 0x00, 0x3b, 0x00, 0x4d, 0x00,
+  0x5a, 0x00, 0x70, 0x00, 0x81, 0x00, 0x8e, 0x00, 0x9a, 0x00, 0xac, 0x00,
+  0xb7, 0x00, 0xc4, 0x00, 0xda, 0x00, 0xe7, 0x00, 0xf8, 0x00, 0x0c, 0x01,
+  0x1b, 0x01, 0x27, 0x01, 0x00, 0x00, 0x2d, 0x00, 0x53, 0x00, 0x79, 0x00,
+  0x8f, 0x00, 0x9a, 0x00, 0xa5, 0x00, 0xb7, 0x00, 0xc2, 0x00, 0xcd, 0x00,
+  0xdd, 0x00, 0xee, 0x00, 0xff, 0x00, 0x0f, 0x01, 0x1e, 0x01, 0x2a, 0x01,
+  0x39, 0x01, 0x4c, 0x01, 0x58, 0x01, 0x00, 0x00, 0x29, 0x00, 0x4c, 0x00,
+  0x77, 0x00, 0x83, 0x00, 0x95, 0x00, 0xa2, 0x00, 0xae, 0x00, 0xbf, 0x00,
+  0xcd, 0x00, 0xdc, 0x00, 0xe8, 0x00, 0xf3, 0x00, 0x03, 0x01, 0x15, 0x01,
+  0x21, 0x01, 0x2c, 0x01, 0x3e, 0x01, 0x49, 0x01, 0x59, 0x01, 0x64, 0x01,
+  0x74, 0x01, 0x83, 0x01, 0x93, 0x01, 0xa0, 0x01, 0xae, 0x01, 0xbf, 0x01,
+  0xca, 0x01, 0xdb, 0x01, 0xe6, 0x01, 0xf5, 0x01, 0x00, 0x00, 0x41, 0x00,
+  0x5f, 0x00, 0x7d, 0x00, 0x8f, 0x00, 0xa4, 0x00, 0xb1, 0x00, 0xc4, 0x00,
+  0xd7, 0x00, 0x00, 0x00, 0x24, 0x00, 0x4a, 0x00, 0x6a, 0x00, 0x80, 0x00,
+  0x8b, 0x00, 0x96, 0x00, 0xa2, 0x00, 0xaf, 0x00, 0xbf, 0x00, 0xcb, 0x00,
+  0xdb, 0x00, 0xea, 0x00, 0xfd, 0x00, 0x14, 0x01, 0x20, 0x01, 0x2a, 0x01,
+  0x35, 0x01, 0x40, 0x01, 0x51, 0x01, 0x67, 0x01, 0x71, 0x01, 0x80, 0x01,
+  0x00, 0x00, 0x29, 0x00, 0x80, 0x00, 0xa2, 0x00, 0xbc, 0x00, 0xc7, 0x00,
+  0xd5, 0x00, 0xe0, 0x00, 0xf1, 0x00, 0xfe, 0x00, 0x0e, 0x01, 0x17, 0x01,
+  0x23, 0x01, 0x34, 0x01, 0x40, 0x01, 0x4d, 0x01, 0x58, 0x01, 0x68, 0x01,
+  0x00, 0x00, 0x0e, 0x00, 0x21, 0x00, 0x33, 0x00, 0x46, 0x00, 0x54, 0x00,
+  0x66, 0x00, 0x73, 0x00, 0x7f, 0x00, 0x92, 0x00, 0x9f, 0x00, 0xaf, 0x00,
+  0xc4, 0x00, 0xce, 0x00, 0xdb, 0x00, 0xe9, 0x00, 0xf6, 0x00, 0x03, 0x01,
+  0x11, 0x01, 0x23, 0x01, 0x2f, 0x01, 0x3c, 0x01, 0x48, 0x01, 0x61, 0x01,
+  0x72, 0x01, 0x7e, 0x01, 0x00, 0x00, 0x0e, 0x00, 0x1c, 0x00, 0x2a, 0x00,
+  0x38, 0x00, 0x48, 0x00, 0x55, 0x00, 0x61, 0x00, 0x6d, 0x00, 0x79, 0x00,
+  0x84, 0x00, 0x00, 0x00, 0x23, 0x00, 0x38, 0x00, 0x47, 0x00, 0x55, 0x00,
+  0x6a, 0x00, 0x7c, 0x00, 0x87, 0x00, 0x93, 0x00, 0xa7, 0x00, 0xbc, 0x00,
+  0xcc, 0x00, 0xda, 0x00, 0xe7, 0x00, 0xf3, 0x00, 0x09, 0x01, 0x15, 0x01,
+  0x2a, 0x01, 0x00, 0x00, 0x23, 0x00, 0x32, 0x00, 0x40, 0x00, 0x4f, 0x00,
+  0x5d, 0x00, 0x6e, 0x00, 0x7b, 0x00, 0x89, 0x00, 0x96, 0x00, 0xa1, 0x00,
+  0xae, 0x00, 0x00, 0x00, 0x10, 0x00, 0x1c, 0x00, 0x29, 0x00, 0x3b, 0x00,
+  0x4c, 0x00, 0x64, 0x00, 0x70, 0x00, 0x7c, 0x00, 0x8d, 0x00, 0x98, 0x00,
+  0xa4, 0x00, 0xb5, 0x00, 0xc5, 0x00, 0x00, 0x00, 0x12, 0x00, 0x1e, 0x00,
+  0x2e, 0x00, 0x40, 0x00, 0x52, 0x00, 0x5e, 0x00, 0x70, 0x00, 0x7a, 0x00,
+  0x88, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x18, 0x00, 0x23, 0x00, 0x2d, 0x00,
+  0x3a, 0x00, 0x4c, 0x00, 0x61, 0x00, 0x73, 0x00, 0x7e, 0x00, 0x8a, 0x00,
+  0x00, 0x00, 0x0b, 0x00, 0x1c, 0x00, 0x2f, 0x00, 0x41, 0x00, 0x4f, 0x00,
+  0x5d, 0x00, 0x6f, 0x00, 0x80, 0x00, 0x92, 0x00, 0xa5, 0x00, 0xb7, 0x00,
+  0xd6, 0x00, 0xdd, 0x00, 0xea, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1e, 0x00,
+  0x2e, 0x00, 0x3e, 0x00, 0x48, 0x00, 0x53, 0x00, 0x68, 0x00, 0x76, 0x00,
+  0x86, 0x00, 0x96, 0x00, 0x00, 0x00, 0x10, 0x00, 0x1e, 0x00, 0x31, 0x00,
+  0x41, 0x00, 0x53, 0x00, 0x60, 0x00, 0x70, 0x00, 0x80, 0x00, 0x90, 0x00,
+  0xa0, 0x00, 0xb2, 0x00, 0xc2, 0x00, 0x00, 0x00, 0x13, 0x00, 0x25, 0x00,
+  0x37, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x1d, 0x00, 0x2e, 0x00, 0x3a, 0x00,
+  0x4d, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x15, 0x00, 0x1d, 0x00, 0x29, 0x00,
+  0x3c, 0x00, 0x47, 0x00, 0x53, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1d, 0x00,
+  0x2b, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1e, 0x00, 0x29, 0x00,
+  0x37, 0x00, 0x45, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x17, 0x00, 0x24, 0x00,
+  0x2f, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x19, 0x00, 0x26, 0x00, 0x30, 0x00,
+  0x3b, 0x00, 0x46, 0x00, 0x55, 0x00, 0x60, 0x00, 0x6b, 0x00, 0x78, 0x00,
+  0x82, 0x00, 0x8d, 0x00, 0x98, 0x00, 0xa8, 0x00, 0xb2, 0x00, 0xc2, 0x00,
+  0xcd, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x1c, 0x00, 0x27, 0x00, 0x34, 0x00,
+  0x40, 0x00, 0x4b, 0x00, 0x5a, 0x00, 0x66, 0x00, 0x76, 0x00, 0x82, 0x00,
+  0x90, 0x00, 0x9c, 0x00, 0xa6, 0x00, 0xb2, 0x00, 0xbd, 0x00, 0xc8, 0x00,
+  0xd6, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x16, 0x00, 0x23, 0x00, 0x2f, 0x00,
+  0x39, 0x00, 0x46, 0x00, 0x53, 0x00, 0x61, 0x00, 0x6f, 0x00, 0x7e, 0x00,
+  0x89, 0x00, 0x93, 0x00, 0x9f, 0x00, 0xae, 0x00, 0xb9, 0x00, 0xc8, 0x00,
+  0xd7, 0x00, 0xe2, 0x00, 0xef, 0x00, 0xf9, 0x00, 0x07, 0x01, 0x15, 0x01,
+  0x00, 0x00, 0x0d, 0x00, 0x1a, 0x00, 0x28, 0x00, 0x34, 0x00, 0x41, 0x00,
+  0x50, 0x00, 0x5d, 0x00, 0x69, 0x00, 0x76, 0x00, 0x83, 0x00, 0x91, 0x00,
+  0x9e, 0x00, 0xa9, 0x00, 0xb5, 0x00, 0xc3, 0x00, 0xd0, 0x00, 0xdd, 0x00,
+  0xe9, 0x00, 0x00, 0x00, 0x11, 0x00, 0x1d, 0x00, 0x28, 0x00, 0x37, 0x00,
+  0x49, 0x00, 0x5a, 0x00, 0x6b, 0x00, 0x77, 0x00, 0x80, 0x00, 0x8a, 0x00,
+  0x95, 0x00, 0xa0, 0x00, 0xac, 0x00, 0xba, 0x00, 0xc8, 0x00, 0xd5, 0x00,
+  0xe7, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1a, 0x00, 0x25, 0x00, 0x30, 0x00,
+  0x3b, 0x00, 0x4a, 0x00, 0x58, 0x00, 0x63, 0x00, 0x6f, 0x00, 0x7d, 0x00,
+  0x88, 0x00, 0x93, 0x00, 0x9f, 0x00, 0xaa, 0x00, 0xb5, 0x00, 0xc6, 0x00,
+  0xd4, 0x00, 0xe0, 0x00, 0xef, 0x00, 0xfe, 0x00, 0x09, 0x01, 0x00, 0x00,
+  0x0e, 0x00, 0x1d, 0x00, 0x28, 0x00, 0x34, 0x00, 0x44, 0x00, 0x51, 0x00,
+  0x5d, 0x00, 0x6c, 0x00, 0x7b, 0x00, 0x8a, 0x00, 0x97, 0x00, 0xa3, 0x00,
+  0xb0, 0x00, 0xbc, 0x00, 0xcc, 0x00, 0xdb, 0x00, 0xeb, 0x00, 0xfa, 0x00,
+  0x07, 0x01, 0x15, 0x01, 0x27, 0x01, 0x00, 0x00, 0x12, 0x00, 0x23, 0x00,
+  0x2d, 0x00, 0x3f, 0x00, 0x4a, 0x00, 0x56, 0x00, 0x65, 0x00, 0x75, 0x00,
+  0x83, 0x00, 0x93, 0x00, 0xa4, 0x00, 0xb3, 0x00, 0xbd, 0x00, 0xd1, 0x00,
+  0xdf, 0x00, 0xed, 0x00, 0xf9, 0x00, 0x09, 0x01, 0x19, 0x01, 0x25, 0x01,
+  0x30, 0x01, 0x3b, 0x01, 0x48, 0x01, 0x53, 0x01, 0x5f, 0x01, 0x00, 0x00,
+  0x0f, 0x00, 0x1a, 0x00, 0x28, 0x00, 0x32, 0x00, 0x42, 0x00, 0x4e, 0x00,
+  0x5c, 0x00, 0x67, 0x00, 0x77, 0x00, 0x85, 0x00, 0x95, 0x00, 0xa2, 0x00,
+  0x00, 0x00, 0x11, 0x00, 0x1d, 0x00, 0x2e, 0x00, 0x41, 0x00, 0x53, 0x00,
+  0x62, 0x00, 0x6d, 0x00, 0x7e, 0x00, 0x8b, 0x00, 0x9a, 0x00, 0xa6, 0x00,
+  0xb4, 0x00, 0xc5, 0x00, 0xd1, 0x00, 0xe0, 0x00, 0xf3, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x25, 0x00, 0x32, 0x00, 0x3e, 0x00, 0x4c, 0x00, 0x60, 0x00,
+  0x6e, 0x00, 0x7d, 0x00, 0x8c, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x16, 0x00,
+  0x29, 0x00, 0x33, 0x00, 0x45, 0x00, 0x51, 0x00, 0x5d, 0x00, 0x6f, 0x00,
+  0x00, 0x00, 0x0b, 0x00, 0x16, 0x00, 0x27, 0x00, 0x38, 0x00, 0x47, 0x00,
+  0x52, 0x00, 0x5e, 0x00, 0x6c, 0x00, 0x76, 0x00, 0x80, 0x00, 0x8a, 0x00,
+  0x96, 0x00, 0x00, 0x00, 0x10, 0x00, 0x23, 0x00, 0x2f, 0x00, 0x46, 0x00,
+  0x51, 0x00, 0x5b, 0x00, 0x6d, 0x00, 0x7a, 0x00, 0x88, 0x00, 0x9c, 0x00,
+  0xaa, 0x00, 0xbe, 0x00, 0xd0, 0x00, 0xe0, 0x00, 0xed, 0x00, 0xfa, 0x00,
+  0x0e, 0x01, 0x23, 0x01, 0x30, 0x01, 0x43, 0x01, 0x00, 0x00, 0x12, 0x00,
+  0x1e, 0x00, 0x2a, 0x00, 0x3a, 0x00, 0x45, 0x00, 0x50, 0x00, 0x5b, 0x00,
+  0x6a, 0x00, 0x77, 0x00, 0x83, 0x00, 0x8d, 0x00, 0x97, 0x00, 0xa2, 0x00,
+  0xae, 0x00, 0xb9, 0x00, 0xc4, 0x00, 0xd1, 0x00, 0xdd, 0x00, 0xef, 0x00,
+  0xfd, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1d, 0x00, 0x28, 0x00, 0x3d, 0x00,
+  0x00, 0x00, 0x32, 0x00, 0x3f, 0x00, 0x4c, 0x00, 0x61, 0x00, 0x73, 0x00,
+  0x7d, 0x00, 0x89, 0x00, 0x96, 0x00, 0xa2, 0x00, 0xaf, 0x00, 0xc1, 0x00,
+  0xd6, 0x00, 0xe5, 0x00, 0xf1, 0x00, 0x02, 0x01, 0x12, 0x01, 0x1e, 0x01,
+  0x30, 0x01, 0x3c, 0x01, 0x00, 0x00, 0x0d, 0x00, 0x23, 0x00, 0x31, 0x00,
+  0x3e, 0x00, 0x4c, 0x00, 0x5c, 0x00, 0x6d, 0x00, 0x79, 0x00, 0x83, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x1a, 0x00, 0x2a, 0x00, 0x3a, 0x00,
+  0x4a, 0x00, 0x54, 0x00, 0x61, 0x00, 0x6e, 0x00, 0x7a, 0x00, 0x89, 0x00,
+  0x93, 0x00, 0xaa, 0x00, 0xba, 0x00, 0xc6, 0x00, 0xd4, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x20, 0x00, 0x32, 0x00, 0x42, 0x00, 0x51, 0x00, 0x5b, 0x00,
+  0x6d, 0x00, 0x7d, 0x00, 0x8a, 0x00, 0x98, 0x00, 0xa7, 0x00, 0xba, 0x00,
+  0xc8, 0x00, 0xd6, 0x00, 0xe7, 0x00, 0xfa, 0x00, 0x0d, 0x01, 0x00, 0x00,
+  0x12, 0x00, 0x25, 0x00, 0x34, 0x00, 0x43, 0x00, 0x52, 0x00, 0x63, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x1e, 0x00, 0x2a, 0x00, 0x38, 0x00, 0x46, 0x00,
+  0x51, 0x00, 0x5d, 0x00, 0x6a, 0x00, 0x7c, 0x00, 0x8a, 0x00, 0x96, 0x00,
+  0x00, 0x00, 0x0a, 0x00, 0x18, 0x00, 0x26, 0x00, 0x30, 0x00, 0x3f, 0x00,
+  0x51, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1b, 0x00, 0x28, 0x00, 0x36, 0x00,
+  0x42, 0x00, 0x50, 0x00, 0x5d, 0x00, 0x68, 0x00, 0x74, 0x00, 0x82, 0x00,
+  0x90, 0x00, 0x9f, 0x00, 0xb1, 0x00, 0xc4, 0x00, 0xd6, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x17, 0x00, 0x24, 0x00, 0x2f, 0x00, 0x3a, 0x00, 0x45, 0x00,
+  0x5a, 0x00, 0x6d, 0x00, 0x78, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x19, 0x00,
+  0x28, 0x00, 0x34, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x15, 0x00,
+  0x22, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x18, 0x00, 0x23, 0x00,
+  0x2f, 0x00, 0x3f, 0x00, 0x4f, 0x00, 0x5b, 0x00, 0x6f, 0x00, 0x85, 0x00,
+  0x91, 0x00, 0xa5, 0x00, 0xb5, 0x00, 0xc5, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x19, 0x00, 0x2a, 0x00, 0x3b, 0x00, 0x49, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x18, 0x00, 0x27, 0x00, 0x32, 0x00, 0x46, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x17, 0x00, 0x23, 0x00, 0x2f, 0x00, 0x3b, 0x00, 0x45, 0x00, 0x4f, 0x00,
+  0x5b, 0x00, 0x68, 0x00, 0x75, 0x00, 0x83, 0x00, 0x91, 0x00, 0x9c, 0x00,
+  0xaa, 0x00, 0xb7, 0x00, 0xc5, 0x00, 0xd3, 0x00, 0xde, 0x00, 0xea, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x1c, 0x00, 0x28, 0x00, 0x3c, 0x00, 0x4c, 0x00,
+  0x56, 0x00, 0x63, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x11, 0x00, 0x1c, 0x00,
+  0x27, 0x00, 0x32, 0x00, 0x45, 0x00, 0x55, 0x00, 0x63, 0x00, 0x6e, 0x00,
+  0x7a, 0x00, 0x89, 0x00, 0x94, 0x00, 0xbe, 0x00, 0xcb, 0x00, 0xda, 0x00,
+  0xea, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x14, 0x00, 0x22, 0x00, 0x2e, 0x00,
+  0x3a, 0x00, 0x46, 0x00, 0x53, 0x00, 0x61, 0x00, 0x6c, 0x00, 0x79, 0x00,
+  0x85, 0x00, 0x92, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x16, 0x00,
+  0x23, 0x00, 0x31, 0x00, 0x3b, 0x00, 0x45, 0x00, 0x4f, 0x00, 0x67, 0x00,
+  0x75, 0x00, 0x84, 0x00, 0x8f, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x14, 0x00,
+  0x21, 0x00, 0x2c, 0x00, 0x39, 0x00, 0x44, 0x00, 0x52, 0x00, 0x61, 0x00,
+  0x6e, 0x00, 0x7c, 0x00, 0x85, 0x00, 0x91, 0x00, 0x9f, 0x00, 0xae, 0x00,
+  0xb9, 0x00, 0xc5, 0x00, 0xd0, 0x00, 0xde, 0x00, 0xed, 0x00, 0xf8, 0x00,
+  0x06, 0x01, 0x14, 0x01, 0x21, 0x01, 0x2e, 0x01, 0x3b, 0x01, 0x46, 0x01,
+  0x00, 0x00, 0x11, 0x00, 0x1d, 0x00, 0x28, 0x00, 0x34, 0x00, 0x45, 0x00,
+  0x52, 0x00, 0x62, 0x00, 0x6e, 0x00, 0x7c, 0x00, 0x89, 0x00, 0x96, 0x00,
+  0xa1, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x18, 0x00, 0x26, 0x00, 0x35, 0x00,
+  0x40, 0x00, 0x53, 0x00, 0x5d, 0x00, 0x6c, 0x00, 0x78, 0x00, 0x85, 0x00,
+  0x90, 0x00, 0x9b, 0x00, 0xa7, 0x00, 0xb3, 0x00, 0xbf, 0x00, 0xcb, 0x00,
+  0xd6, 0x00, 0xe7, 0x00, 0xf3, 0x00, 0x02, 0x01, 0x0c, 0x01, 0x16, 0x01,
+  0x00, 0x00, 0x12, 0x00, 0x20, 0x00, 0x2e, 0x00, 0x39, 0x00, 0x48, 0x00,
+  0x52, 0x00, 0x5f, 0x00, 0x6a, 0x00, 0x78, 0x00, 0x83, 0x00, 0x8d, 0x00,
+  0x9d, 0x00, 0xae, 0x00, 0xbc, 0x00, 0xc6, 0x00, 0xd1, 0x00, 0xdc, 0x00,
+  0xe9, 0x00, 0xf7, 0x00, 0x00, 0x00, 0x34, 0x00, 0x3e, 0x00, 0x4a, 0x00,
+  0x54, 0x00, 0x61, 0x00, 0x6e, 0x00, 0x7a, 0x00, 0x87, 0x00, 0x94, 0x00,
+  0xa3, 0x00, 0xb3, 0x00, 0xc5, 0x00, 0xd0, 0x00, 0xdd, 0x00, 0xeb, 0x00,
+  0xf2, 0x00, 0x00, 0x01, 0x0d, 0x01, 0x1c, 0x01, 0x2a, 0x01, 0x40, 0x01,
+  0x4f, 0x01, 0x5c, 0x01, 0x64, 0x01, 0x00, 0x00, 0x36, 0x00, 0x49, 0x00,
+  0x5a, 0x00, 0x6b, 0x00, 0x79, 0x00, 0x8c, 0x00, 0x97, 0x00, 0xa5, 0x00,
+  0xb4, 0x00, 0xc4, 0x00, 0xce, 0x00, 0xdd, 0x00, 0xec, 0x00, 0xf7, 0x00,
+  0x06, 0x01, 0x14, 0x01, 0x23, 0x01, 0x35, 0x01, 0x49, 0x01, 0x54, 0x01,
+  0x65, 0x01, 0x78, 0x01, 0x85, 0x01, 0x95, 0x01, 0xa1, 0x01, 0xae, 0x01,
+  0x00, 0x00, 0x0d, 0x00, 0x1a, 0x00, 0x25, 0x00, 0x32, 0x00, 0x40, 0x00,
+  0x4e, 0x00, 0x59, 0x00, 0x65, 0x00, 0x78, 0x00, 0x00, 0x00, 0x11, 0x00,
+  0x57, 0x00, 0x9f, 0x00, 0xe5, 0x00, 0x29, 0x01, 0x37, 0x01, 0x46, 0x01,
+  0x57, 0x01, 0x67, 0x01, 0x77, 0x01, 0x81, 0x01, 0x8f, 0x01, 0x9d, 0x01,
+  0xa9, 0x01, 0xb8, 0x01, 0xc9, 0x01, 0xd8, 0x01, 0xea, 0x01, 0xf5, 0x01,
+  0x07, 0x02, 0x17, 0x02, 0x00, 0x00, 0x44, 0x00, 0x86, 0x00, 0xcc, 0x00,
+  0x10, 0x01, 0x54, 0x01, 0x96, 0x01, 0xa4, 0x01, 0xb8, 0x01, 0xc5, 0x01,
+  0xd3, 0x01, 0xe1, 0x01, 0xf2, 0x01, 0x01, 0x02, 0x10, 0x02, 0x1b, 0x02,
+  0x28, 0x02, 0x3c, 0x02, 0x4e, 0x02, 0x00, 0x00, 0x10, 0x00, 0x1b, 0x00,
+  0x27, 0x00, 0x36, 0x00, 0x45, 0x00, 0x52, 0x00, 0x60, 0x00, 0x6c, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x1c, 0x00, 0x27, 0x00, 0x34, 0x00, 0x3e, 0x00,
+  0x4d, 0x00, 0x5b, 0x00, 0x68, 0x00, 0x73, 0x00, 0x7f, 0x00, 0x8a, 0x00,
+  0x9b, 0x00, 0xab, 0x00, 0xbd, 0x00, 0xd8, 0x00, 0xeb, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x1e, 0x00, 0x2a, 0x00, 0x35, 0x00, 0x41, 0x00, 0x4c, 0x00,
+  0x58, 0x00, 0x6a, 0x00, 0x74, 0x00, 0x7f, 0x00, 0x8a, 0x00, 0x9b, 0x00,
+  0x00, 0x00, 0x15, 0x00, 0x20, 0x00, 0x2f, 0x00, 0x3f, 0x00, 0x4d, 0x00,
+  0x58, 0x00, 0x63, 0x00, 0x73, 0x00, 0x7e, 0x00, 0x8a, 0x00
+};
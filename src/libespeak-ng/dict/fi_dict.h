@@ -1,5 +1,7 @@
 #pragma once
-const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
+#include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/fi_dict_index.h>
+const unsigned char __espeakng_dict_fi[] __attribute__((aligned((4)))) = {
   0x00, 0x04, 0x00, 0x00, 0x45, 0xa7, 0x00, 0x00, 0x00, 0x42, 0x19, 0xf0,
   0x9f, 0x91, 0xa9, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xe2, 0x80,
   0x8d, 0xf0, 0x9f, 0x91, 0xa7, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa7,
@@ -3662,4 +3664,11 @@ const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
   0xc5, 0xa1, 0x03, 0x5c, 0x00, 0xc3, 0xbc, 0x03, 0x72, 0x00, 0xc3, 0xbc,
   0xc3, 0xbc, 0x03, 0x72, 0x0c, 0x00, 0x07, 0x00
 };
-size_t __espeakng_dictlen = 43928;
+
+BackgroundAudioDictionary dict_fi = {
+    "fi",
+    43928,
+    __espeakng_dict_fi,
+    7982,
+    __espeakng_dictindex_fi
+};
@@ -1,5 +1,7 @@
 #pragma once
-const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
+#include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/fr_dict_index.h>
+const unsigned char __espeakng_dict_fr[] __attribute__((aligned((4)))) = {
   0x00, 0x04, 0x00, 0x00, 0x87, 0xcf, 0x00, 0x00, 0x00, 0x43, 0x19, 0xf0,
   0x9f, 0x91, 0xa9, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xe2, 0x80,
   0x8d, 0xf0, 0x9f, 0x91, 0xa7, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa7,
@@ -5312,4 +5314,11 @@ const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
   0x70, 0x00, 0x3a, 0x08, 0x20, 0x12, 0x51, 0x02, 0x20, 0x12, 0x52, 0x0f,
   0x20, 0x03, 0x75, 0x22, 0x00, 0x07, 0x00
 };
-size_t __espeakng_dictlen = 63727;
+
+BackgroundAudioDictionary dict_fr = {
+    "fr",
+    63727,
+    __espeakng_dict_fr,
+    9638,
+    __espeakng_dictindex_fr
+};
@@ -1,5 +1,7 @@
 #pragma once
-const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
+#include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/ga_dict_index.h>
+const unsigned char __espeakng_dict_ga[] __attribute__((aligned((4)))) = {
   0x00, 0x04, 0x00, 0x00, 0x36, 0xba, 0x00, 0x00, 0x00, 0x44, 0x19, 0xf0,
   0x9f, 0x91, 0xa9, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xe2, 0x80,
   0x8d, 0xf0, 0x9f, 0x91, 0xa7, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa7,
@@ -4391,4 +4393,11 @@ const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
   0x00, 0x07, 0x06, 0x79, 0x00, 0x03, 0x15, 0x00, 0x07, 0x06, 0x7a, 0x00,
   0x03, 0x15, 0x00, 0x07, 0x00
 };
-size_t __espeakng_dictlen = 52673;
+
+BackgroundAudioDictionary dict_ga = {
+    "ga",
+    52673,
+    __espeakng_dict_ga,
+    7726,
+    __espeakng_dictindex_ga
+};
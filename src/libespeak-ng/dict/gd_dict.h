@@ -1,5 +1,7 @@
 #pragma once
-const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
+#include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/gd_dict_index.h>
+const unsigned char __espeakng_dict_gd[] __attribute__((aligned((4)))) = {
   0x00, 0x04, 0x00, 0x00, 0xaf, 0xb8, 0x00, 0x00, 0x00, 0x56, 0x19, 0xf0,
   0x9f, 0x91, 0xa9, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xe2, 0x80,
   0x8d, 0xf0, 0x9f, 0x91, 0xa7, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa7,
@@ -4095,4 +4097,11 @@ const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
   0x41, 0x03, 0x39, 0x00, 0x02, 0x11, 0x41, 0x00, 0x07, 0x06, 0x7a, 0x00,
   0x03, 0x59, 0x00, 0x07, 0x00
 };
-size_t __espeakng_dictlen = 49121;
+
+BackgroundAudioDictionary dict_gd = {
+    "gd",
+    49121,
+    __espeakng_dict_gd,
+    7288,
+    __espeakng_dictindex_gd
+};
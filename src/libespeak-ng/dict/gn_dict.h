@@ -1,5 +1,7 @@
 #pragma once
-const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
+#include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/gn_dict_index.h>
+const unsigned char __espeakng_dict_gn[] __attribute__((aligned((4)))) = {
   0x00, 0x04, 0x00, 0x00, 0xc9, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x05, 0x41, 0x04, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x41,
   0x08, 0x48, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x41, 0x0c, 0x58,
@@ -272,4 +274,11 @@ const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
   0x06, 0x79, 0x00, 0x03, 0x71, 0x00, 0x07, 0x06, 0x7a, 0x00, 0x7a, 0x03,
   0x2f, 0x5a, 0x00, 0x03, 0x58, 0x00, 0x07, 0x00
 };
-size_t __espeakng_dictlen = 3248;
+
+BackgroundAudioDictionary dict_gn = {
+    "gn",
+    3248,
+    __espeakng_dict_gn,
+    2518,
+    __espeakng_dictindex_gn
+};
@@ -1,5 +1,7 @@
 #pragma once
-const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
+#include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/grc_dict_index.h>
+const unsigned char __espeakng_dict_grc[] __attribute__((aligned((4)))) = {
   0x00, 0x04, 0x00, 0x00, 0xe0, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -288,4 +290,11 @@ const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
   0x03, 0x77, 0x0c, 0x00, 0xe1, 0xbf, 0xb3, 0x03, 0x7d, 0x0c, 0x00, 0x07,
   0x00
 };
-size_t __espeakng_dictlen = 3433;
+
+BackgroundAudioDictionary dict_grc = {
+    "grc",
+    3433,
+    __espeakng_dict_grc,
+    2134,
+    __espeakng_dictindex_grc
+};
@@ -1,5 +1,7 @@
 #pragma once
-const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
+#include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/gu_dict_index.h>
+const unsigned char __espeakng_dict_gu[] __attribute__((aligned((4)))) = {
   0x00, 0x04, 0x00, 0x00, 0xb9, 0x38, 0x01, 0x00, 0x00, 0x79, 0x19, 0xf0,
   0x9f, 0x91, 0xa9, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xe2, 0x80,
   0x8d, 0xf0, 0x9f, 0x91, 0xa7, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa7,
@@ -6875,4 +6877,11 @@ const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
   0x30, 0x6d, 0x5a, 0x74, 0x32, 0x2f, 0x00, 0x24, 0x03, 0x49, 0x79, 0x37,
   0x6d, 0x00, 0x07, 0x00
 };
-size_t __espeakng_dictlen = 82480;
+
+BackgroundAudioDictionary dict_gu = {
+    "gu",
+    82480,
+    __espeakng_dict_gu,
+    7508,
+    __espeakng_dictindex_gu
+};
@@ -1,5 +1,7 @@
 #pragma once
-const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
+#include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/hak_dict_index.h>
+const unsigned char __espeakng_dict_hak[] __attribute__((aligned((4)))) = {
   0x00, 0x04, 0x00, 0x00, 0xf4, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -279,4 +281,11 @@ const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
   0x00, 0x32, 0x03, 0x6c, 0x00, 0x33, 0x03, 0x6d, 0x00, 0x34, 0x03, 0x6e,
   0x00, 0x35, 0x03, 0x6f, 0x00, 0x36, 0x03, 0x70, 0x00, 0x07, 0x00
 };
-size_t __espeakng_dictlen = 3335;
+
+BackgroundAudioDictionary dict_hak = {
+    "hak",
+    3335,
+    __espeakng_dict_hak,
+    2134,
+    __espeakng_dictindex_hak
+};
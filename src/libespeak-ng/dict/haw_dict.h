@@ -1,5 +1,7 @@
 #pragma once
-const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
+#include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/haw_dict_index.h>
+const unsigned char __espeakng_dict_haw[] __attribute__((aligned((4)))) = {
   0x00, 0x04, 0x00, 0x00, 0x26, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x05, 0x41, 0x04, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x41,
@@ -205,4 +207,11 @@ const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
   0x00, 0x67, 0x03, 0x52, 0x00, 0x66, 0x03, 0x54, 0x00, 0x7a, 0x03, 0x59,
   0x00, 0x73, 0x03, 0x5a, 0x00, 0x07, 0x00
 };
-size_t __espeakng_dictlen = 2443;
+
+BackgroundAudioDictionary dict_haw = {
+    "haw",
+    2443,
+    __espeakng_dict_haw,
+    2368,
+    __espeakng_dictindex_haw
+};
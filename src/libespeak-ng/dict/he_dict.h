@@ -1,5 +1,7 @@
 #pragma once
-const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
+#include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/he_dict_index.h>
+const unsigned char __espeakng_dict_he[] __attribute__((aligned((4)))) = {
   0x00, 0x04, 0x00, 0x00, 0x14, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a,
   0x04, 0xd7, 0x9a, 0xd6, 0xbc, 0x31, 0x23, 0x54, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -890,4 +892,11 @@ const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
   0x00, 0x3e, 0x3d, 0x03, 0x52, 0x23, 0x49, 0x0d, 0x27, 0x37, 0x0f, 0x27,
   0x0d, 0x0f, 0x5c, 0x23, 0x55, 0x24, 0x00, 0x07, 0x00
 };
-size_t __espeakng_dictlen = 10665;
+
+BackgroundAudioDictionary dict_he = {
+    "he",
+    10665,
+    __espeakng_dict_he,
+    2938,
+    __espeakng_dictindex_he
+};
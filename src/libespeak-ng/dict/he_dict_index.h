@@ -0,0 +1,248 @@
+#pragma once
+const unsigned char __espeakng_dictindex_he[] __attribute__((aligned((4)))) = {
+  0x45, 0x44, 0x58, 0x31, 0xa9, 0x29, 0x00, 0x00, 0x14, 0x17, 0x00, 0x00,
+  0x22, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x02, 0x00, 0x02, 0x00, 0x03, 0x00,
+  0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00,
+  0x03, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00,
+  0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x05, 0x00, 0x06, 0x00,
+  0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x08, 0x00,
+  0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x0a, 0x00,
+  0x0a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x0a, 0x00,
+  0x0a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x0b, 0x00, 0x0b, 0x00, 0x0b, 0x00,
+  0x0b, 0x00, 0x0b, 0x00, 0x0b, 0x00, 0x0b, 0x00, 0x0b, 0x00, 0x0b, 0x00,
+  0x0b, 0x00, 0x0b, 0x00, 0x0b, 0x00, 0x0b, 0x00, 0x0c, 0x00, 0x0c, 0x00,
+  0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00,
+  0x0c, 0x00, 0x0d, 0x00, 0x0d, 0x00, 0x0d, 0x00, 0x0d, 0x00, 0x0d, 0x00,
+  0x0d, 0x00, 0x0d, 0x00, 0x0d, 0x00, 0x0d, 0x00, 0x0d, 0x00, 0x0d, 0x00,
+  0x0d, 0x00, 0x0d, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x10, 0x00, 0x10, 0x00,
+  0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00,
+  0x10, 0x00, 0x10, 0x00, 0x11, 0x00, 0x12, 0x00, 0x14, 0x00, 0x14, 0x00,
+  0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x16, 0x00, 0x16, 0x00, 0x16, 0x00,
+  0x16, 0x00, 0x16, 0x00, 0x16, 0x00, 0x16, 0x00, 0x16, 0x00, 0x18, 0x00,
+  0x1a, 0x00, 0x1b, 0x00, 0x1b, 0x00, 0x1b, 0x00, 0x1b, 0x00, 0x1b, 0x00,
+  0x1b, 0x00, 0x1b, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00,
+  0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1d, 0x00, 0x1d, 0x00,
+  0x1e, 0x00, 0x1e, 0x00, 0x1e, 0x00, 0x1e, 0x00, 0x1f, 0x00, 0x1f, 0x00,
+  0x1f, 0x00, 0x20, 0x00, 0x20, 0x00, 0x21, 0x00, 0x21, 0x00, 0x22, 0x00,
+  0x23, 0x00, 0x23, 0x00, 0x23, 0x00, 0x23, 0x00, 0x25, 0x00, 0x25, 0x00,
+  0x26, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00,
+  0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00,
+  0x28, 0x00, 0x29, 0x00, 0x29, 0x00, 0x2a, 0x00, 0x2a, 0x00, 0x2e, 0x00,
+  0x2e, 0x00, 0x2f, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x32, 0x00,
+  0x32, 0x00, 0x33, 0x00, 0x33, 0x00, 0x33, 0x00, 0x34, 0x00, 0x34, 0x00,
+  0x35, 0x00, 0x35, 0x00, 0x35, 0x00, 0x35, 0x00, 0x35, 0x00, 0x35, 0x00,
+  0x35, 0x00, 0x35, 0x00, 0x35, 0x00, 0x35, 0x00, 0x35, 0x00, 0x35, 0x00,
+  0x35, 0x00, 0x35, 0x00, 0x35, 0x00, 0x35, 0x00, 0x35, 0x00, 0x35, 0x00,
+  0x35, 0x00, 0x35, 0x00, 0x35, 0x00, 0x35, 0x00, 0x35, 0x00, 0x35, 0x00,
+  0x35, 0x00, 0x35, 0x00, 0x35, 0x00, 0x35, 0x00, 0x35, 0x00, 0x35, 0x00,
+  0x35, 0x00, 0x35, 0x00, 0x35, 0x00, 0x35, 0x00, 0x35, 0x00, 0x35, 0x00,
+  0x35, 0x00, 0x35, 0x00, 0x35, 0x00, 0x35, 0x00, 0x35, 0x00, 0x35, 0x00,
+  0x35, 0x00, 0x35, 0x00, 0x35, 0x00, 0x35, 0x00, 0x35, 0x00, 0x35, 0x00,
+  0x35, 0x00, 0x35, 0x00, 0x35, 0x00, 0x35, 0x00, 0x35, 0x00, 0x35, 0x00,
+  0x35, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00,
+  0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00,
+  0x37, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00,
+  0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00,
+  0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00,
+  0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00,
+  0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x39, 0x00, 0x3a, 0x00, 0x3a, 0x00,
+  0x3a, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x3a, 0x00,
+  0x3a, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00,
+  0x3b, 0x00, 0x3b, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00,
+  0x3c, 0x00, 0x3d, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x40, 0x00, 0x41, 0x00,
+  0x41, 0x00, 0x41, 0x00, 0x41, 0x00, 0x41, 0x00, 0x41, 0x00, 0x41, 0x00,
+  0x41, 0x00, 0x41, 0x00, 0x42, 0x00, 0x42, 0x00, 0x42, 0x00, 0x42, 0x00,
+  0x42, 0x00, 0x42, 0x00, 0x42, 0x00, 0x42, 0x00, 0x42, 0x00, 0x42, 0x00,
+  0x42, 0x00, 0x42, 0x00, 0x42, 0x00, 0x43, 0x00, 0x43, 0x00, 0x43, 0x00,
+  0x43, 0x00, 0x43, 0x00, 0x43, 0x00, 0x44, 0x00, 0x45, 0x00, 0x46, 0x00,
+  0x46, 0x00, 0x46, 0x00, 0x46, 0x00, 0x46, 0x00, 0x46, 0x00, 0x46, 0x00,
+  0x46, 0x00, 0x46, 0x00, 0x46, 0x00, 0x47, 0x00, 0x47, 0x00, 0x47, 0x00,
+  0x48, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x4a, 0x00,
+  0x4a, 0x00, 0x4a, 0x00, 0x4a, 0x00, 0x4a, 0x00, 0x4b, 0x00, 0x4b, 0x00,
+  0x4b, 0x00, 0x4b, 0x00, 0x4c, 0x00, 0x4e, 0x00, 0x4e, 0x00, 0x4e, 0x00,
+  0x50, 0x00, 0x51, 0x00, 0x52, 0x00, 0x54, 0x00, 0x55, 0x00, 0x55, 0x00,
+  0x55, 0x00, 0x57, 0x00, 0x58, 0x00, 0x5a, 0x00, 0x5a, 0x00, 0x5a, 0x00,
+  0x5b, 0x00, 0x5b, 0x00, 0x5b, 0x00, 0x5b, 0x00, 0x5c, 0x00, 0x5c, 0x00,
+  0x5c, 0x00, 0x5e, 0x00, 0x60, 0x00, 0x60, 0x00, 0x61, 0x00, 0x62, 0x00,
+  0x62, 0x00, 0x63, 0x00, 0x63, 0x00, 0x63, 0x00, 0x66, 0x00, 0x66, 0x00,
+  0x66, 0x00, 0x66, 0x00, 0x67, 0x00, 0x67, 0x00, 0x69, 0x00, 0x6a, 0x00,
+  0x6b, 0x00, 0x6b, 0x00, 0x6b, 0x00, 0x6b, 0x00, 0x6b, 0x00, 0x6c, 0x00,
+  0x6d, 0x00, 0x6f, 0x00, 0x72, 0x00, 0x73, 0x00, 0x74, 0x00, 0x75, 0x00,
+  0x77, 0x00, 0x78, 0x00, 0x79, 0x00, 0x7c, 0x00, 0x7d, 0x00, 0x80, 0x00,
+  0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x81, 0x00,
+  0x82, 0x00, 0x83, 0x00, 0x84, 0x00, 0x84, 0x00, 0x86, 0x00, 0x86, 0x00,
+  0x86, 0x00, 0x86, 0x00, 0x87, 0x00, 0x87, 0x00, 0x87, 0x00, 0x87, 0x00,
+  0x88, 0x00, 0x88, 0x00, 0x88, 0x00, 0x89, 0x00, 0x8b, 0x00, 0x8b, 0x00,
+  0x8c, 0x00, 0x8c, 0x00, 0x8c, 0x00, 0x8c, 0x00, 0x8c, 0x00, 0x8c, 0x00,
+  0x8d, 0x00, 0x8d, 0x00, 0x8d, 0x00, 0x8d, 0x00, 0x8d, 0x00, 0x8d, 0x00,
+  0x8d, 0x00, 0x8e, 0x00, 0x8f, 0x00, 0x8f, 0x00, 0x8f, 0x00, 0x8f, 0x00,
+  0x8f, 0x00, 0x8f, 0x00, 0x8f, 0x00, 0x90, 0x00, 0x90, 0x00, 0x90, 0x00,
+  0x90, 0x00, 0x90, 0x00, 0x90, 0x00, 0x90, 0x00, 0x90, 0x00, 0x91, 0x00,
+  0x91, 0x00, 0x91, 0x00, 0x91, 0x00, 0x91, 0x00, 0x91, 0x00, 0x91, 0x00,
+  0x91, 0x00, 0x91, 0x00, 0x91, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00,
+  0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x93, 0x00, 0x93, 0x00, 0x93, 0x00,
+  0x93, 0x00, 0x93, 0x00, 0x93, 0x00, 0x93, 0x00, 0x95, 0x00, 0x97, 0x00,
+  0x97, 0x00, 0x97, 0x00, 0x98, 0x00, 0x98, 0x00, 0x99, 0x00, 0x99, 0x00,
+  0x9a, 0x00, 0x9a, 0x00, 0x9a, 0x00, 0x9a, 0x00, 0x9b, 0x00, 0x9b, 0x00,
+  0x9c, 0x00, 0x9c, 0x00, 0x9c, 0x00, 0x9c, 0x00, 0x9c, 0x00, 0x9c, 0x00,
+  0x9c, 0x00, 0x9c, 0x00, 0x9c, 0x00, 0x9c, 0x00, 0x9c, 0x00, 0x9c, 0x00,
+  0x9c, 0x00, 0x9c, 0x00, 0x9c, 0x00, 0x9c, 0x00, 0x9c, 0x00, 0x9c, 0x00,
+  0x9c, 0x00, 0x9c, 0x00, 0x9c, 0x00, 0x9c, 0x00, 0x9c, 0x00, 0x9c, 0x00,
+  0x9c, 0x00, 0x9c, 0x00, 0x9c, 0x00, 0x9d, 0x00, 0x9d, 0x00, 0x9e, 0x00,
+  0x9e, 0x00, 0x9f, 0x00, 0x9f, 0x00, 0x9f, 0x00, 0xa0, 0x00, 0xa0, 0x00,
+  0xa0, 0x00, 0xa0, 0x00, 0xa1, 0x00, 0xa1, 0x00, 0xa3, 0x00, 0xa3, 0x00,
+  0xa3, 0x00, 0xa3, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00,
+  0xa4, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xa5, 0x00,
+  0xa5, 0x00, 0xa5, 0x00, 0xa6, 0x00, 0xa6, 0x00, 0xa8, 0x00, 0xa9, 0x00,
+  0xaa, 0x00, 0xaa, 0x00, 0xaa, 0x00, 0xab, 0x00, 0xab, 0x00, 0xac, 0x00,
+  0xac, 0x00, 0xac, 0x00, 0xac, 0x00, 0xad, 0x00, 0xad, 0x00, 0xad, 0x00,
+  0xae, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
+  0xaf, 0x00, 0xb0, 0x00, 0xb0, 0x00, 0xb0, 0x00, 0xb1, 0x00, 0xb1, 0x00,
+  0xb2, 0x00, 0xb2, 0x00, 0xb2, 0x00, 0xb2, 0x00, 0xb2, 0x00, 0xb2, 0x00,
+  0xb2, 0x00, 0xb2, 0x00, 0xb2, 0x00, 0xb3, 0x00, 0xb3, 0x00, 0xb4, 0x00,
+  0xb4, 0x00, 0xb4, 0x00, 0xb4, 0x00, 0xb4, 0x00, 0xb4, 0x00, 0xb5, 0x00,
+  0xb5, 0x00, 0xb6, 0x00, 0xb6, 0x00, 0xb8, 0x00, 0xb8, 0x00, 0xb8, 0x00,
+  0xb8, 0x00, 0xb8, 0x00, 0xb8, 0x00, 0xb8, 0x00, 0xb8, 0x00, 0xb8, 0x00,
+  0xb8, 0x00, 0xb8, 0x00, 0xb8, 0x00, 0xbc, 0x00, 0xbc, 0x00, 0xbd, 0x00,
+  0xbd, 0x00, 0xbd, 0x00, 0xbd, 0x00, 0xbd, 0x00, 0xbe, 0x00, 0xbf, 0x00,
+  0xbf, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00,
+  0xc1, 0x00, 0xc1, 0x00, 0xc1, 0x00, 0xc1, 0x00, 0xc3, 0x00, 0xc3, 0x00,
+  0xc3, 0x00, 0xc3, 0x00, 0xc3, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00,
+  0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00,
+  0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00,
+  0xc5, 0x00, 0xc5, 0x00, 0xc6, 0x00, 0xc7, 0x00, 0xc7, 0x00, 0xc7, 0x00,
+  0xc8, 0x00, 0xc8, 0x00, 0xc8, 0x00, 0xc8, 0x00, 0xc9, 0x00, 0xc9, 0x00,
+  0xc9, 0x00, 0xc9, 0x00, 0xc9, 0x00, 0xc9, 0x00, 0xc9, 0x00, 0xc9, 0x00,
+  0xc9, 0x00, 0xc9, 0x00, 0xc9, 0x00, 0xce, 0x00, 0xce, 0x00, 0xce, 0x00,
+  0xce, 0x00, 0xce, 0x00, 0xce, 0x00, 0xce, 0x00, 0xce, 0x00, 0xce, 0x00,
+  0xce, 0x00, 0xce, 0x00, 0xce, 0x00, 0xce, 0x00, 0xce, 0x00, 0xce, 0x00,
+  0xce, 0x00, 0xce, 0x00, 0xce, 0x00, 0xce, 0x00, 0xcf, 0x00, 0xcf, 0x00,
+  0xcf, 0x00, 0xcf, 0x00, 0xcf, 0x00, 0xcf, 0x00, 0xcf, 0x00, 0xcf, 0x00,
+  0xcf, 0x00, 0xcf, 0x00, 0xcf, 0x00, 0xcf, 0x00, 0xcf, 0x00, 0xcf, 0x00,
+  0xcf, 0x00, 0xcf, 0x00, 0xcf, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00,
+  0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00,
+  0xd0, 0x00, 0xd1, 0x00, 0xd1, 0x00, 0xd1, 0x00, 0xd1, 0x00, 0xd1, 0x00,
+  0xd1, 0x00, 0xd1, 0x00, 0xd1, 0x00, 0xd1, 0x00, 0xd1, 0x00, 0xd1, 0x00,
+  0xd1, 0x00, 0xd1, 0x00, 0xd1, 0x00, 0xd1, 0x00, 0xd1, 0x00, 0xd1, 0x00,
+  0xd1, 0x00, 0xd1, 0x00, 0xd1, 0x00, 0xd1, 0x00, 0xd1, 0x00, 0xd1, 0x00,
+  0xd1, 0x00, 0xd1, 0x00, 0xd1, 0x00, 0xd1, 0x00, 0xd1, 0x00, 0xd1, 0x00,
+  0xd1, 0x00, 0xd1, 0x00, 0xd1, 0x00, 0xd1, 0x00, 0xd1, 0x00, 0xd2, 0x00,
+  0xd2, 0x00, 0xd2, 0x00, 0xd2, 0x00, 0xd2, 0x00, 0xd2, 0x00, 0xd2, 0x00,
+  0xd2, 0x00, 0xd2, 0x00, 0xd2, 0x00, 0xd2, 0x00, 0xd2, 0x00, 0xd2, 0x00,
+  0xd2, 0x00, 0xd2, 0x00, 0xd2, 0x00, 0xd2, 0x00, 0xd2, 0x00, 0xd2, 0x00,
+  0xd2, 0x00, 0xd4, 0x00, 0xd4, 0x00, 0xd4, 0x00, 0xd4, 0x00, 0xd5, 0x00,
+  0xd5, 0x00, 0xd5, 0x00, 0xd5, 0x00, 0xd5, 0x00, 0xd5, 0x00, 0xd5, 0x00,
+  0xd5, 0x00, 0xd5, 0x00, 0xd5, 0x00, 0xd5, 0x00, 0xd5, 0x00, 0xd5, 0x00,
+  0xd5, 0x00, 0xd5, 0x00, 0xd5, 0x00, 0xd7, 0x00, 0xd9, 0x00, 0xda, 0x00,
+  0xdb, 0x00, 0xdc, 0x00, 0xdd, 0x00, 0xde, 0x00, 0xdf, 0x00, 0xdf, 0x00,
+  0xdf, 0x00, 0xe0, 0x00, 0xe1, 0x00, 0xe1, 0x00, 0xe1, 0x00, 0xe1, 0x00,
+  0xe3, 0x00, 0xe3, 0x00, 0xe3, 0x00, 0xe3, 0x00, 0xe3, 0x00, 0xe3, 0x00,
+  0xe3, 0x00, 0xe3, 0x00, 0xe3, 0x00, 0xe3, 0x00, 0xe3, 0x00, 0xe3, 0x00,
+  0xe3, 0x00, 0xe3, 0x00, 0xe3, 0x00, 0xe3, 0x00, 0xe3, 0x00, 0xe4, 0x00,
+  0xe7, 0x00, 0xe8, 0x00, 0xe9, 0x00, 0xea, 0x00, 0xeb, 0x00, 0xed, 0x00,
+  0xee, 0x00, 0xef, 0x00, 0xf0, 0x00, 0xf1, 0x00, 0xf4, 0x00, 0xf7, 0x00,
+  0xf8, 0x00, 0xf9, 0x00, 0xfa, 0x00, 0xfb, 0x00, 0xfc, 0x00, 0xfd, 0x00,
+  0xfe, 0x00, 0xff, 0x00, 0x00, 0x01, 0x01, 0x01, 0x03, 0x01, 0x03, 0x01,
+  0x03, 0x01, 0x03, 0x01, 0x03, 0x01, 0x04, 0x01, 0x05, 0x01, 0x06, 0x01,
+  0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x09, 0x01,
+  0x09, 0x01, 0x09, 0x01, 0x0b, 0x01, 0x0c, 0x01, 0x0d, 0x01, 0x0d, 0x01,
+  0x0f, 0x01, 0x0f, 0x01, 0x0f, 0x01, 0x0f, 0x01, 0x0f, 0x01, 0x0f, 0x01,
+  0x0f, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x11, 0x01, 0x11, 0x01,
+  0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01,
+  0x11, 0x01, 0x12, 0x01, 0x12, 0x01, 0x12, 0x01, 0x13, 0x01, 0x13, 0x01,
+  0x13, 0x01, 0x13, 0x01, 0x13, 0x01, 0x13, 0x01, 0x14, 0x01, 0x15, 0x01,
+  0x15, 0x01, 0x16, 0x01, 0x16, 0x01, 0x16, 0x01, 0x16, 0x01, 0x16, 0x01,
+  0x16, 0x01, 0x16, 0x01, 0x16, 0x01, 0x16, 0x01, 0x16, 0x01, 0x16, 0x01,
+  0x16, 0x01, 0x16, 0x01, 0x16, 0x01, 0x16, 0x01, 0x16, 0x01, 0x16, 0x01,
+  0x16, 0x01, 0x16, 0x01, 0x16, 0x01, 0x16, 0x01, 0x16, 0x01, 0x16, 0x01,
+  0x16, 0x01, 0x16, 0x01, 0x16, 0x01, 0x16, 0x01, 0x17, 0x01, 0x17, 0x01,
+  0x17, 0x01, 0x17, 0x01, 0x17, 0x01, 0x17, 0x01, 0x17, 0x01, 0x17, 0x01,
+  0x17, 0x01, 0x17, 0x01, 0x18, 0x01, 0x18, 0x01, 0x18, 0x01, 0x18, 0x01,
+  0x18, 0x01, 0x18, 0x01, 0x1a, 0x01, 0x1a, 0x01, 0x1a, 0x01, 0x1a, 0x01,
+  0x1b, 0x01, 0x1b, 0x01, 0x1b, 0x01, 0x1b, 0x01, 0x1b, 0x01, 0x1b, 0x01,
+  0x1b, 0x01, 0x1b, 0x01, 0x1b, 0x01, 0x1b, 0x01, 0x1b, 0x01, 0x1b, 0x01,
+  0x1c, 0x01, 0x1c, 0x01, 0x1d, 0x01, 0x1d, 0x01, 0x1d, 0x01, 0x1d, 0x01,
+  0x1d, 0x01, 0x1d, 0x01, 0x1d, 0x01, 0x1d, 0x01, 0x1d, 0x01, 0x1d, 0x01,
+  0x1e, 0x01, 0x1e, 0x01, 0x1f, 0x01, 0x20, 0x01, 0x20, 0x01, 0x20, 0x01,
+  0x20, 0x01, 0x20, 0x01, 0x20, 0x01, 0x20, 0x01, 0x20, 0x01, 0x20, 0x01,
+  0x20, 0x01, 0x21, 0x01, 0x21, 0x01, 0x21, 0x01, 0x21, 0x01, 0x21, 0x01,
+  0x21, 0x01, 0x21, 0x01, 0x21, 0x01, 0x21, 0x01, 0x21, 0x01, 0x21, 0x01,
+  0x21, 0x01, 0x21, 0x01, 0x21, 0x01, 0x21, 0x01, 0x21, 0x01, 0x21, 0x01,
+  0x21, 0x01, 0x21, 0x01, 0x21, 0x01, 0x21, 0x01, 0x21, 0x01, 0x21, 0x01,
+  0x22, 0x01, 0x00, 0x00, 0xa1, 0x9d, 0x65, 0x8b, 0x42, 0x3c, 0x38, 0xb6,
+  0xa1, 0x8b, 0xa1, 0x48, 0x97, 0xa4, 0x21, 0x74, 0x76, 0x5b, 0xe1, 0x03,
+  0xc0, 0xf0, 0x66, 0xb1, 0xfa, 0xd8, 0x52, 0xf5, 0xf2, 0xc1, 0xaa, 0x4b,
+  0x2a, 0xb5, 0xb0, 0x39, 0x01, 0x4b, 0x89, 0xc0, 0x7d, 0x5e, 0x05, 0x29,
+  0x32, 0x32, 0xec, 0x8d, 0xdb, 0xfa, 0xe7, 0xb2, 0x41, 0xe9, 0xa6, 0x32,
+  0xe6, 0x3e, 0x98, 0xa1, 0x62, 0x15, 0xc1, 0x00, 0xda, 0x1f, 0x4f, 0xe4,
+  0x0a, 0xa7, 0x62, 0x68, 0xc8, 0xcc, 0x0e, 0xc1, 0xe4, 0x3f, 0x1e, 0x22,
+  0xfd, 0x77, 0x27, 0x7e, 0xfc, 0xeb, 0xb4, 0xb3, 0xd8, 0xb6, 0x35, 0x4c,
+  0x6c, 0xdc, 0x33, 0xaf, 0x49, 0xab, 0x7e, 0x09, 0x4a, 0x91, 0xbe, 0x54,
+  0x78, 0xf9, 0xd0, 0x62, 0xe0, 0x7a, 0x90, 0x58, 0x8f, 0x72, 0x19, 0x0e,
+  0xbb, 0xd5, 0x0f, 0x57, 0x1a, 0xf7, 0x84, 0xb6, 0x28, 0x5b, 0x5b, 0x03,
+  0x10, 0xc6, 0xff, 0x8c, 0x18, 0x5e, 0xa4, 0x21, 0x15, 0x5a, 0xf8, 0x4b,
+  0xc3, 0xd1, 0xf6, 0x35, 0xa6, 0xe2, 0xb1, 0x0b, 0xfa, 0xf0, 0x6c, 0xc5,
+  0x9f, 0x8c, 0x53, 0x12, 0xcf, 0x24, 0xe6, 0x71, 0x8d, 0x9a, 0x9a, 0x36,
+  0x06, 0x0a, 0x70, 0xd4, 0x15, 0xfb, 0x00, 0xcb, 0xf3, 0x89, 0xc1, 0x66,
+  0x55, 0x51, 0xb1, 0xbc, 0xc1, 0x59, 0xcb, 0xb0, 0x85, 0x97, 0xdc, 0x1c,
+  0xc3, 0x25, 0x5d, 0x44, 0xba, 0x64, 0xf9, 0x5f, 0x38, 0xa2, 0x3a, 0x0c,
+  0x2b, 0xa1, 0x2c, 0xa1, 0x0f, 0x24, 0x00, 0x98, 0x73, 0xab, 0x77, 0xee,
+  0x09, 0x12, 0x8e, 0xa1, 0x4e, 0xfe, 0x8a, 0x74, 0xe7, 0x31, 0xc0, 0x83,
+  0x17, 0x5e, 0x5e, 0x88, 0x1e, 0xfd, 0x5b, 0xa9, 0x3f, 0x4e, 0xdf, 0x1f,
+  0x0e, 0xe4, 0x2c, 0x9d, 0xd4, 0xba, 0xd4, 0xc5, 0xfd, 0xb1, 0x0e, 0x63,
+  0x8a, 0x00, 0x9d, 0x32, 0x75, 0x0b, 0x52, 0xe0, 0x2b, 0xb1, 0xee, 0x41,
+  0x77, 0x97, 0x1c, 0x70, 0x32, 0x52, 0x45, 0x9a, 0x33, 0x79, 0x33, 0x98,
+  0xa5, 0xf3, 0x07, 0x18, 0x65, 0x2b, 0xd5, 0xf5, 0x79, 0xaa, 0x1e, 0x62,
+  0xbd, 0x99, 0x59, 0x13, 0x40, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x24, 0x00,
+  0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0b, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00,
+  0x00, 0x00, 0x11, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x31, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x13, 0x00, 0x23, 0x00, 0x32, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x1a, 0x00, 0x23, 0x00, 0x35, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x21, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00,
+  0x19, 0x00, 0x00, 0x00, 0x08, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
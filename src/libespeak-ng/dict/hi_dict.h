@@ -1,5 +1,7 @@
 #pragma once
-const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
+#include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/hi_dict_index.h>
+const unsigned char __espeakng_dict_hi[] __attribute__((aligned((4)))) = {
   0x00, 0x04, 0x00, 0x00, 0x93, 0x5d, 0x01, 0x00, 0x00, 0x73, 0x19, 0xf0,
   0x9f, 0x91, 0xa9, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xe2, 0x80,
   0x8d, 0xf0, 0x9f, 0x91, 0xa7, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa7,
@@ -7680,4 +7682,11 @@ const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
   0x00, 0x03, 0x15, 0x00, 0x66, 0x01, 0x20, 0x20, 0x0f, 0x02, 0x20, 0x20,
   0x0f, 0x03, 0x42, 0x24, 0x00, 0x07, 0x00
 };
-size_t __espeakng_dictlen = 92143;
+
+BackgroundAudioDictionary dict_hi = {
+    "hi",
+    92143,
+    __espeakng_dict_hi,
+    7934,
+    __espeakng_dictindex_hi
+};
@@ -1,5 +1,7 @@
 #pragma once
-const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
+#include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/hr_dict_index.h>
+const unsigned char __espeakng_dict_hr[] __attribute__((aligned((4)))) = {
   0x00, 0x04, 0x00, 0x00, 0xae, 0xbc, 0x00, 0x00, 0x00, 0x4c, 0x19, 0xf0,
   0x9f, 0x91, 0xa9, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xe2, 0x80,
   0x8d, 0xf0, 0x9f, 0x91, 0xa7, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa7,
@@ -4117,4 +4119,11 @@ const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
   0x03, 0x7b, 0x00, 0xc3, 0xa1, 0x03, 0x7c, 0x00, 0xc3, 0xb3, 0x03, 0x7d,
   0x00, 0xc3, 0xba, 0x03, 0x7e, 0x00, 0x07, 0x00
 };
-size_t __espeakng_dictlen = 49388;
+
+BackgroundAudioDictionary dict_hr = {
+    "hr",
+    49388,
+    __espeakng_dict_hr,
+    8824,
+    __espeakng_dictindex_hr
+};
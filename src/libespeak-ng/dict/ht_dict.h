@@ -1,5 +1,7 @@
 #pragma once
-const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
+#include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/ht_dict_index.h>
+const unsigned char __espeakng_dict_ht[] __attribute__((aligned((4)))) = {
   0x00, 0x04, 0x00, 0x00, 0x0c, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x0d, 0x04, 0x5f, 0x64, 0x70, 0x74, 0x55, 0x25,
@@ -152,4 +154,11 @@ const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
   0x06, 0x79, 0x00, 0x03, 0x39, 0x00, 0x07, 0x06, 0x7a, 0x00, 0x03, 0x59,
   0x00, 0x07, 0x00
 };
-size_t __espeakng_dictlen = 1803;
+
+BackgroundAudioDictionary dict_ht = {
+    "ht",
+    1803,
+    __espeakng_dict_ht,
+    2218,
+    __espeakng_dictindex_ht
+};
@@ -1,5 +1,7 @@
 #pragma once
-const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
+#include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/hu_dict_index.h>
+const unsigned char __espeakng_dict_hu[] __attribute__((aligned((4)))) = {
   0x00, 0x04, 0x00, 0x00, 0x86, 0xd6, 0x01, 0x00, 0x0b, 0xc8, 0x3c, 0xc5,
   0x81, 0x4c, 0x70, 0x54, 0x58, 0x10, 0x0b, 0x08, 0xc5, 0x2c, 0x53, 0x05,
   0x50, 0x90, 0x0b, 0x08, 0xc5, 0x48, 0x12, 0x94, 0x04, 0xd0, 0x0b, 0x08,
@@ -14825,4 +14827,11 @@ const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
   0x00, 0xc3, 0x9f, 0x03, 0x5a, 0x00, 0x04, 0xc3, 0xa4, 0x03, 0x6d, 0x00,
   0xc3, 0xa6, 0x00, 0xc3, 0xb8, 0x03, 0x6e, 0x00, 0x07, 0x00
 };
-size_t __espeakng_dictlen = 177886;
+
+BackgroundAudioDictionary dict_hu = {
+    "hu",
+    177886,
+    __espeakng_dict_hu,
+    22990,
+    __espeakng_dictindex_hu
+};
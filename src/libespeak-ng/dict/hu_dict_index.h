@@ -0,0 +1,1919 @@
+#pragma once
+const unsigned char __espeakng_dictindex_hu[] __attribute__((aligned((4)))) = {
+  0x45, 0x44, 0x58, 0x31, 0xde, 0xb6, 0x02, 0x00, 0x86, 0xd6, 0x01, 0x00,
+  0x3e, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x0a, 0x00, 0x13, 0x00,
+  0x13, 0x00, 0x14, 0x00, 0xaf, 0x00, 0xb4, 0x00, 0xb9, 0x00, 0xb9, 0x00,
+  0xc0, 0x00, 0xcc, 0x00, 0xd0, 0x00, 0xd5, 0x00, 0xd9, 0x00, 0xdb, 0x00,
+  0xe0, 0x00, 0xe4, 0x00, 0xeb, 0x00, 0xec, 0x00, 0xf0, 0x00, 0xf6, 0x00,
+  0x02, 0x01, 0x0f, 0x01, 0x11, 0x01, 0x19, 0x01, 0x1d, 0x01, 0x22, 0x01,
+  0x23, 0x01, 0x28, 0x01, 0x2c, 0x01, 0x2e, 0x01, 0x34, 0x01, 0x38, 0x01,
+  0x3e, 0x01, 0x42, 0x01, 0x47, 0x01, 0x4d, 0x01, 0x52, 0x01, 0x5d, 0x01,
+  0x65, 0x01, 0x6a, 0x01, 0x70, 0x01, 0x72, 0x01, 0x74, 0x01, 0x78, 0x01,
+  0x7b, 0x01, 0x7f, 0x01, 0x84, 0x01, 0x86, 0x01, 0xa5, 0x01, 0xc8, 0x01,
+  0xd5, 0x01, 0xe1, 0x01, 0xec, 0x01, 0xf9, 0x01, 0x03, 0x02, 0x0e, 0x02,
+  0x15, 0x02, 0x1b, 0x02, 0x21, 0x02, 0x22, 0x02, 0x28, 0x02, 0x2f, 0x02,
+  0x31, 0x02, 0x37, 0x02, 0x3d, 0x02, 0x42, 0x02, 0x49, 0x02, 0x4e, 0x02,
+  0x53, 0x02, 0x56, 0x02, 0x60, 0x02, 0x65, 0x02, 0x6f, 0x02, 0x7b, 0x02,
+  0x7d, 0x02, 0x8b, 0x02, 0x8f, 0x02, 0x95, 0x02, 0x9b, 0x02, 0x9b, 0x02,
+  0xa0, 0x02, 0xa8, 0x02, 0xb6, 0x02, 0xb8, 0x02, 0xc2, 0x02, 0xc7, 0x02,
+  0xc9, 0x02, 0xcb, 0x02, 0xd1, 0x02, 0xe5, 0x02, 0xe9, 0x02, 0xf5, 0x02,
+  0xfc, 0x02, 0x00, 0x03, 0x05, 0x03, 0x0c, 0x03, 0x21, 0x03, 0x29, 0x03,
+  0x2c, 0x03, 0x30, 0x03, 0x33, 0x03, 0x3d, 0x03, 0x43, 0x03, 0x4b, 0x03,
+  0x52, 0x03, 0x67, 0x03, 0x6e, 0x03, 0x80, 0x03, 0x85, 0x03, 0x89, 0x03,
+  0x8e, 0x03, 0x95, 0x03, 0x9b, 0x03, 0xa2, 0x03, 0xa5, 0x03, 0xa9, 0x03,
+  0xae, 0x03, 0xb5, 0x03, 0xc1, 0x03, 0xc7, 0x03, 0xd0, 0x03, 0xd9, 0x03,
+  0xe0, 0x03, 0xed, 0x03, 0xf8, 0x03, 0xfd, 0x03, 0x03, 0x04, 0x07, 0x04,
+  0x0b, 0x04, 0x17, 0x04, 0x1d, 0x04, 0x23, 0x04, 0x29, 0x04, 0x34, 0x04,
+  0x37, 0x04, 0x40, 0x04, 0x45, 0x04, 0x51, 0x04, 0x5b, 0x04, 0x65, 0x04,
+  0x6c, 0x04, 0x73, 0x04, 0x7b, 0x04, 0x80, 0x04, 0x84, 0x04, 0x8b, 0x04,
+  0x92, 0x04, 0x9a, 0x04, 0xa4, 0x04, 0xa9, 0x04, 0xaf, 0x04, 0xb5, 0x04,
+  0xbf, 0x04, 0xc5, 0x04, 0xc9, 0x04, 0xcf, 0x04, 0xd7, 0x04, 0xdf, 0x04,
+  0xe6, 0x04, 0xee, 0x04, 0xf0, 0x04, 0x06, 0x05, 0x14, 0x05, 0x18, 0x05,
+  0x1b, 0x05, 0x1e, 0x05, 0x23, 0x05, 0x2a, 0x05, 0x30, 0x05, 0x35, 0x05,
+  0x3d, 0x05, 0x40, 0x05, 0x42, 0x05, 0x45, 0x05, 0x46, 0x05, 0x48, 0x05,
+  0x4b, 0x05, 0x4f, 0x05, 0x52, 0x05, 0x5b, 0x05, 0x5e, 0x05, 0x67, 0x05,
+  0x6d, 0x05, 0x71, 0x05, 0x74, 0x05, 0x7a, 0x05, 0x7d, 0x05, 0x7f, 0x05,
+  0x81, 0x05, 0x86, 0x05, 0x89, 0x05, 0x8f, 0x05, 0x93, 0x05, 0x98, 0x05,
+  0x9b, 0x05, 0xa5, 0x05, 0xa7, 0x05, 0xb4, 0x05, 0xb8, 0x05, 0xbb, 0x05,
+  0xc3, 0x05, 0xf8, 0x05, 0xfe, 0x05, 0x01, 0x06, 0x03, 0x06, 0x08, 0x06,
+  0x18, 0x06, 0x18, 0x06, 0x1f, 0x06, 0x25, 0x06, 0x29, 0x06, 0x30, 0x06,
+  0x30, 0x06, 0x35, 0x06, 0x3e, 0x06, 0x43, 0x06, 0x46, 0x06, 0x56, 0x06,
+  0x66, 0x06, 0x6f, 0x06, 0x73, 0x06, 0x75, 0x06, 0x77, 0x06, 0x7a, 0x06,
+  0x7c, 0x06, 0x85, 0x06, 0x8a, 0x06, 0x92, 0x06, 0x93, 0x06, 0x95, 0x06,
+  0x99, 0x06, 0xa0, 0x06, 0xa7, 0x06, 0xb4, 0x06, 0xc7, 0x06, 0xcb, 0x06,
+  0xcf, 0x06, 0xd7, 0x06, 0xdf, 0x06, 0xe5, 0x06, 0xe6, 0x06, 0xe8, 0x06,
+  0xfc, 0x06, 0xff, 0x06, 0x05, 0x07, 0x0f, 0x07, 0x14, 0x07, 0x1c, 0x07,
+  0x23, 0x07, 0x28, 0x07, 0x29, 0x07, 0x34, 0x07, 0x36, 0x07, 0x3b, 0x07,
+  0x3e, 0x07, 0x3f, 0x07, 0x44, 0x07, 0x4e, 0x07, 0x52, 0x07, 0x55, 0x07,
+  0x5a, 0x07, 0x5e, 0x07, 0x66, 0x07, 0x6b, 0x07, 0x6c, 0x07, 0x74, 0x07,
+  0x7e, 0x07, 0x7f, 0x07, 0x81, 0x07, 0x86, 0x07, 0x88, 0x07, 0x8c, 0x07,
+  0x90, 0x07, 0x94, 0x07, 0x98, 0x07, 0x9f, 0x07, 0xa5, 0x07, 0xaa, 0x07,
+  0xae, 0x07, 0xb3, 0x07, 0xb4, 0x07, 0xb7, 0x07, 0xbb, 0x07, 0xbf, 0x07,
+  0xbf, 0x07, 0xc9, 0x07, 0xcb, 0x07, 0xce, 0x07, 0xd1, 0x07, 0xd8, 0x07,
+  0xda, 0x07, 0xe2, 0x07, 0xe6, 0x07, 0xee, 0x07, 0xf5, 0x07, 0xf7, 0x07,
+  0xfd, 0x07, 0x04, 0x08, 0x09, 0x08, 0x0d, 0x08, 0x0f, 0x08, 0x13, 0x08,
+  0x17, 0x08, 0x1a, 0x08, 0x1a, 0x08, 0x20, 0x08, 0x2d, 0x08, 0x32, 0x08,
+  0x35, 0x08, 0x38, 0x08, 0x3b, 0x08, 0x3f, 0x08, 0x42, 0x08, 0x45, 0x08,
+  0x48, 0x08, 0x4d, 0x08, 0x4f, 0x08, 0x58, 0x08, 0x5a, 0x08, 0x60, 0x08,
+  0x66, 0x08, 0x6a, 0x08, 0x6f, 0x08, 0x76, 0x08, 0x7c, 0x08, 0x82, 0x08,
+  0x84, 0x08, 0x8a, 0x08, 0x8e, 0x08, 0x92, 0x08, 0x98, 0x08, 0x9d, 0x08,
+  0xa0, 0x08, 0xa8, 0x08, 0xaf, 0x08, 0xb5, 0x08, 0xb7, 0x08, 0xbb, 0x08,
+  0xc0, 0x08, 0xc3, 0x08, 0xc8, 0x08, 0xce, 0x08, 0xd3, 0x08, 0xd9, 0x08,
+  0xe1, 0x08, 0xeb, 0x08, 0x4c, 0x09, 0x53, 0x09, 0x56, 0x09, 0x5a, 0x09,
+  0x62, 0x09, 0x6b, 0x09, 0x6f, 0x09, 0x73, 0x09, 0x80, 0x09, 0x82, 0x09,
+  0x8a, 0x09, 0x90, 0x09, 0x95, 0x09, 0x9c, 0x09, 0xa1, 0x09, 0xa7, 0x09,
+  0xae, 0x09, 0xb6, 0x09, 0xbb, 0x09, 0xc4, 0x09, 0xc9, 0x09, 0xce, 0x09,
+  0xd2, 0x09, 0xd5, 0x09, 0xdc, 0x09, 0xde, 0x09, 0xe0, 0x09, 0xe2, 0x09,
+  0xe5, 0x09, 0xe9, 0x09, 0xef, 0x09, 0xf9, 0x09, 0xff, 0x09, 0x01, 0x0a,
+  0x02, 0x0a, 0x09, 0x0a, 0x0c, 0x0a, 0x12, 0x0a, 0x18, 0x0a, 0x1b, 0x0a,
+  0x28, 0x0a, 0x2e, 0x0a, 0x37, 0x0a, 0x41, 0x0a, 0x44, 0x0a, 0x4c, 0x0a,
+  0x53, 0x0a, 0x57, 0x0a, 0x61, 0x0a, 0x69, 0x0a, 0x6d, 0x0a, 0x70, 0x0a,
+  0x7a, 0x0a, 0x83, 0x0a, 0x84, 0x0a, 0x87, 0x0a, 0x8f, 0x0a, 0x92, 0x0a,
+  0x96, 0x0a, 0x9f, 0x0a, 0xa3, 0x0a, 0xa4, 0x0a, 0xab, 0x0a, 0xb3, 0x0a,
+  0xb6, 0x0a, 0xb8, 0x0a, 0xbc, 0x0a, 0xbf, 0x0a, 0xc7, 0x0a, 0xce, 0x0a,
+  0xd1, 0x0a, 0xda, 0x0a, 0xe1, 0x0a, 0xe7, 0x0a, 0xf1, 0x0a, 0xf6, 0x0a,
+  0x02, 0x0b, 0x03, 0x0b, 0x09, 0x0b, 0x0c, 0x0b, 0x10, 0x0b, 0x12, 0x0b,
+  0x15, 0x0b, 0x17, 0x0b, 0x1a, 0x0b, 0x1e, 0x0b, 0x26, 0x0b, 0x28, 0x0b,
+  0x33, 0x0b, 0x39, 0x0b, 0x3f, 0x0b, 0x44, 0x0b, 0x4c, 0x0b, 0x53, 0x0b,
+  0x59, 0x0b, 0x5d, 0x0b, 0x64, 0x0b, 0x6c, 0x0b, 0x6d, 0x0b, 0x74, 0x0b,
+  0x7d, 0x0b, 0x84, 0x0b, 0x89, 0x0b, 0x8c, 0x0b, 0x99, 0x0b, 0xa0, 0x0b,
+  0xa3, 0x0b, 0xab, 0x0b, 0xad, 0x0b, 0xb1, 0x0b, 0xb5, 0x0b, 0xb7, 0x0b,
+  0xc2, 0x0b, 0xca, 0x0b, 0xce, 0x0b, 0xd2, 0x0b, 0xd4, 0x0b, 0xd5, 0x0b,
+  0xd9, 0x0b, 0xda, 0x0b, 0xe4, 0x0b, 0xe7, 0x0b, 0xec, 0x0b, 0xf4, 0x0b,
+  0xfd, 0x0b, 0x01, 0x0c, 0x09, 0x0c, 0x0e, 0x0c, 0x1c, 0x0c, 0x1d, 0x0c,
+  0x20, 0x0c, 0x21, 0x0c, 0x24, 0x0c, 0x38, 0x0c, 0x3a, 0x0c, 0x3d, 0x0c,
+  0x42, 0x0c, 0x47, 0x0c, 0x4b, 0x0c, 0x52, 0x0c, 0x57, 0x0c, 0x5f, 0x0c,
+  0x6a, 0x0c, 0x6f, 0x0c, 0x72, 0x0c, 0x77, 0x0c, 0x7b, 0x0c, 0x80, 0x0c,
+  0x87, 0x0c, 0x8d, 0x0c, 0x96, 0x0c, 0x9a, 0x0c, 0xa6, 0x0c, 0xb6, 0x0c,
+  0xba, 0x0c, 0xc3, 0x0c, 0xcb, 0x0c, 0xce, 0x0c, 0xcf, 0x0c, 0xd7, 0x0c,
+  0xdf, 0x0c, 0xe2, 0x0c, 0xe5, 0x0c, 0xeb, 0x0c, 0xf0, 0x0c, 0xf4, 0x0c,
+  0xfa, 0x0c, 0x05, 0x0d, 0x09, 0x0d, 0x13, 0x0d, 0x15, 0x0d, 0x19, 0x0d,
+  0x1d, 0x0d, 0x25, 0x0d, 0x2e, 0x0d, 0x33, 0x0d, 0x3b, 0x0d, 0x43, 0x0d,
+  0x4b, 0x0d, 0x4f, 0x0d, 0x5c, 0x0d, 0x68, 0x0d, 0x71, 0x0d, 0x74, 0x0d,
+  0x75, 0x0d, 0x82, 0x0d, 0x89, 0x0d, 0x92, 0x0d, 0x96, 0x0d, 0x9b, 0x0d,
+  0xa2, 0x0d, 0xa6, 0x0d, 0xac, 0x0d, 0xb2, 0x0d, 0xb3, 0x0d, 0xbd, 0x0d,
+  0xc4, 0x0d, 0xcc, 0x0d, 0xd1, 0x0d, 0xd9, 0x0d, 0xdf, 0x0d, 0xe4, 0x0d,
+  0xec, 0x0d, 0xf1, 0x0d, 0xf5, 0x0d, 0xf8, 0x0d, 0xff, 0x0d, 0x02, 0x0e,
+  0x04, 0x0e, 0x09, 0x0e, 0x10, 0x0e, 0x16, 0x0e, 0x1c, 0x0e, 0x21, 0x0e,
+  0x28, 0x0e, 0x2b, 0x0e, 0x2d, 0x0e, 0x3c, 0x0e, 0x3c, 0x0e, 0x3f, 0x0e,
+  0x40, 0x0e, 0x48, 0x0e, 0x4f, 0x0e, 0x55, 0x0e, 0x5b, 0x0e, 0x61, 0x0e,
+  0x66, 0x0e, 0x6c, 0x0e, 0x73, 0x0e, 0x74, 0x0e, 0x7a, 0x0e, 0x80, 0x0e,
+  0x86, 0x0e, 0x8c, 0x0e, 0x93, 0x0e, 0x98, 0x0e, 0x9a, 0x0e, 0x9d, 0x0e,
+  0xa2, 0x0e, 0xa6, 0x0e, 0xa7, 0x0e, 0xab, 0x0e, 0xb0, 0x0e, 0xb2, 0x0e,
+  0xb6, 0x0e, 0xbd, 0x0e, 0xc4, 0x0e, 0xca, 0x0e, 0xcf, 0x0e, 0xd7, 0x0e,
+  0xda, 0x0e, 0xe1, 0x0e, 0xe2, 0x0e, 0xed, 0x0e, 0xfb, 0x0e, 0x05, 0x0f,
+  0x0c, 0x0f, 0x13, 0x0f, 0x1c, 0x0f, 0x22, 0x0f, 0x2c, 0x0f, 0x32, 0x0f,
+  0x3c, 0x0f, 0x3d, 0x0f, 0x41, 0x0f, 0x47, 0x0f, 0x4e, 0x0f, 0x58, 0x0f,
+  0x60, 0x0f, 0x68, 0x0f, 0x70, 0x0f, 0x72, 0x0f, 0x78, 0x0f, 0x7f, 0x0f,
+  0x82, 0x0f, 0x83, 0x0f, 0x88, 0x0f, 0x8c, 0x0f, 0x8c, 0x0f, 0x8e, 0x0f,
+  0x90, 0x0f, 0x98, 0x0f, 0x99, 0x0f, 0x9b, 0x0f, 0x9c, 0x0f, 0xa3, 0x0f,
+  0xa4, 0x0f, 0xa8, 0x0f, 0xac, 0x0f, 0xad, 0x0f, 0xb1, 0x0f, 0xb5, 0x0f,
+  0xb6, 0x0f, 0xbb, 0x0f, 0xbe, 0x0f, 0xbf, 0x0f, 0xc2, 0x0f, 0xca, 0x0f,
+  0xd1, 0x0f, 0xd7, 0x0f, 0xdd, 0x0f, 0xe9, 0x0f, 0xf2, 0x0f, 0xf4, 0x0f,
+  0xf6, 0x0f, 0xfc, 0x0f, 0x01, 0x10, 0x04, 0x10, 0x06, 0x10, 0x09, 0x10,
+  0x0f, 0x10, 0x0f, 0x10, 0x11, 0x10, 0x14, 0x10, 0x14, 0x10, 0x16, 0x10,
+  0x1e, 0x10, 0x23, 0x10, 0x2a, 0x10, 0x2b, 0x10, 0x2e, 0x10, 0x36, 0x10,
+  0x3b, 0x10, 0x41, 0x10, 0x45, 0x10, 0x4e, 0x10, 0x53, 0x10, 0x56, 0x10,
+  0x58, 0x10, 0x5e, 0x10, 0x64, 0x10, 0x6a, 0x10, 0x73, 0x10, 0x7a, 0x10,
+  0x7c, 0x10, 0x7f, 0x10, 0x85, 0x10, 0x8b, 0x10, 0x8c, 0x10, 0x8e, 0x10,
+  0x9c, 0x10, 0xa1, 0x10, 0xa5, 0x10, 0xa7, 0x10, 0xac, 0x10, 0xbb, 0x10,
+  0xc1, 0x10, 0xc7, 0x10, 0xd1, 0x10, 0xdd, 0x10, 0xe7, 0x10, 0xf0, 0x10,
+  0xf6, 0x10, 0x00, 0x11, 0x0c, 0x11, 0x17, 0x11, 0x1d, 0x11, 0x24, 0x11,
+  0x2e, 0x11, 0x38, 0x11, 0x3f, 0x11, 0x49, 0x11, 0x50, 0x11, 0x59, 0x11,
+  0x6e, 0x11, 0x77, 0x11, 0x81, 0x11, 0x8a, 0x11, 0x91, 0x11, 0x9b, 0x11,
+  0xa1, 0x11, 0xa7, 0x11, 0xb2, 0x11, 0xb8, 0x11, 0xc1, 0x11, 0xc7, 0x11,
+  0xce, 0x11, 0xdf, 0x11, 0xee, 0x11, 0xfe, 0x11, 0x08, 0x12, 0x1d, 0x12,
+  0x2d, 0x12, 0x36, 0x12, 0x43, 0x12, 0x54, 0x12, 0x61, 0x12, 0x6b, 0x12,
+  0x76, 0x12, 0x7f, 0x12, 0x8b, 0x12, 0x93, 0x12, 0x9c, 0x12, 0xa6, 0x12,
+  0xb1, 0x12, 0xba, 0x12, 0xc6, 0x12, 0xd2, 0x12, 0xdc, 0x12, 0xe4, 0x12,
+  0xf1, 0x12, 0xf8, 0x12, 0x05, 0x13, 0x0c, 0x13, 0x19, 0x13, 0x26, 0x13,
+  0x3a, 0x13, 0x46, 0x13, 0x55, 0x13, 0x5f, 0x13, 0x6c, 0x13, 0x7e, 0x13,
+  0x8a, 0x13, 0x9e, 0x13, 0xa7, 0x13, 0xb1, 0x13, 0xb9, 0x13, 0xc2, 0x13,
+  0xcd, 0x13, 0xd6, 0x13, 0xe4, 0x13, 0xfb, 0x13, 0x04, 0x14, 0x0e, 0x14,
+  0x1c, 0x14, 0x26, 0x14, 0x2c, 0x14, 0x31, 0x14, 0x38, 0x14, 0x44, 0x14,
+  0x4f, 0x14, 0x5d, 0x14, 0x67, 0x14, 0x75, 0x14, 0x80, 0x14, 0x89, 0x14,
+  0x96, 0x14, 0xa0, 0x14, 0xac, 0x14, 0xbc, 0x14, 0xcb, 0x14, 0xd3, 0x14,
+  0xdc, 0x14, 0xe6, 0x14, 0xed, 0x14, 0xf3, 0x14, 0xf8, 0x14, 0x03, 0x15,
+  0x0d, 0x15, 0x1a, 0x15, 0x22, 0x15, 0x34, 0x15, 0x43, 0x15, 0x4c, 0x15,
+  0x5c, 0x15, 0x6a, 0x15, 0x75, 0x15, 0x7b, 0x15, 0x83, 0x15, 0x8d, 0x15,
+  0x93, 0x15, 0xa0, 0x15, 0xa5, 0x15, 0xb1, 0x15, 0xb9, 0x15, 0xc5, 0x15,
+  0xcc, 0x15, 0xd6, 0x15, 0xe3, 0x15, 0xe6, 0x15, 0xec, 0x15, 0xf8, 0x15,
+  0xfe, 0x15, 0x04, 0x16, 0x07, 0x16, 0x11, 0x16, 0x16, 0x16, 0x20, 0x16,
+  0x26, 0x16, 0x2d, 0x16, 0x37, 0x16, 0x3d, 0x16, 0x45, 0x16, 0x4c, 0x16,
+  0x5c, 0x16, 0x62, 0x16, 0x6b, 0x16, 0x75, 0x16, 0x7e, 0x16, 0x85, 0x16,
+  0x8b, 0x16, 0x8f, 0x16, 0x96, 0x16, 0x99, 0x16, 0x9d, 0x16, 0xa3, 0x16,
+  0xaf, 0x16, 0xb4, 0x16, 0xba, 0x16, 0xc6, 0x16, 0xce, 0x16, 0xd4, 0x16,
+  0xdb, 0x16, 0xe0, 0x16, 0xe7, 0x16, 0xe9, 0x16, 0xec, 0x16, 0xf1, 0x16,
+  0xf9, 0x16, 0x03, 0x17, 0x08, 0x17, 0x0d, 0x17, 0x10, 0x17, 0x1a, 0x17,
+  0x34, 0x17, 0x3e, 0x17, 0x48, 0x17, 0x4b, 0x17, 0x50, 0x17, 0x56, 0x17,
+  0x5b, 0x17, 0x5e, 0x17, 0x62, 0x17, 0x6a, 0x17, 0x71, 0x17, 0x78, 0x17,
+  0x7f, 0x17, 0x86, 0x17, 0x93, 0x17, 0x98, 0x17, 0x9d, 0x17, 0xa6, 0x17,
+  0xad, 0x17, 0xb3, 0x17, 0xba, 0x17, 0xc5, 0x17, 0xcb, 0x17, 0xd4, 0x17,
+  0xdd, 0x17, 0xe8, 0x17, 0xee, 0x17, 0xf5, 0x17, 0x01, 0x18, 0x07, 0x18,
+  0x0c, 0x18, 0x12, 0x18, 0x17, 0x18, 0x1e, 0x18, 0x24, 0x18, 0x28, 0x18,
+  0x31, 0x18, 0x3a, 0x18, 0x41, 0x18, 0x48, 0x18, 0x50, 0x18, 0x57, 0x18,
+  0x60, 0x18, 0x69, 0x18, 0x75, 0x18, 0x7f, 0x18, 0x8b, 0x18, 0x96, 0x18,
+  0xa7, 0x18, 0xb1, 0x18, 0xbf, 0x18, 0xca, 0x18, 0xd4, 0x18, 0xdd, 0x18,
+  0xe8, 0x18, 0xf0, 0x18, 0xfb, 0x18, 0x03, 0x19, 0x0b, 0x19, 0x12, 0x19,
+  0x26, 0x19, 0x32, 0x19, 0x3f, 0x19, 0x4b, 0x19, 0x53, 0x19, 0x5f, 0x19,
+  0x6e, 0x19, 0x7a, 0x19, 0x82, 0x19, 0x8a, 0x19, 0x92, 0x19, 0x96, 0x19,
+  0x9a, 0x19, 0xa0, 0x19, 0xa4, 0x19, 0xa9, 0x19, 0xae, 0x19, 0xb1, 0x19,
+  0xb6, 0x19, 0xb9, 0x19, 0xc4, 0x19, 0xca, 0x19, 0xce, 0x19, 0xd3, 0x19,
+  0xd6, 0x19, 0xde, 0x19, 0xe7, 0x19, 0xe9, 0x19, 0xf0, 0x19, 0xf8, 0x19,
+  0xfc, 0x19, 0xff, 0x19, 0x04, 0x1a, 0x0b, 0x1a, 0x11, 0x1a, 0x16, 0x1a,
+  0x1a, 0x1a, 0x1f, 0x1a, 0x26, 0x1a, 0x2c, 0x1a, 0x2e, 0x1a, 0x34, 0x1a,
+  0x3a, 0x1a, 0x41, 0x1a, 0x46, 0x1a, 0x48, 0x1a, 0x4d, 0x1a, 0x4e, 0x1a,
+  0x52, 0x1a, 0x54, 0x1a, 0x57, 0x1a, 0x5a, 0x1a, 0x5a, 0x1a, 0x5b, 0x1a,
+  0x5e, 0x1a, 0x5e, 0x1a, 0x64, 0x1a, 0x65, 0x1a, 0x69, 0x1a, 0x70, 0x1a,
+  0x73, 0x1a, 0x76, 0x1a, 0x7b, 0x1a, 0x80, 0x1a, 0x85, 0x1a, 0x89, 0x1a,
+  0x8d, 0x1a, 0x90, 0x1a, 0x94, 0x1a, 0x98, 0x1a, 0x9b, 0x1a, 0x9e, 0x1a,
+  0x9f, 0x1a, 0xa1, 0x1a, 0xa4, 0x1a, 0xa6, 0x1a, 0xa8, 0x1a, 0xac, 0x1a,
+  0xb8, 0x1a, 0xbf, 0x1a, 0xc2, 0x1a, 0xc7, 0x1a, 0xcc, 0x1a, 0xd2, 0x1a,
+  0xdd, 0x1a, 0xe5, 0x1a, 0xec, 0x1a, 0xf3, 0x1a, 0xfd, 0x1a, 0x01, 0x1b,
+  0x03, 0x1b, 0x05, 0x1b, 0x08, 0x1b, 0x0f, 0x1b, 0x14, 0x1b, 0x18, 0x1b,
+  0x1d, 0x1b, 0x24, 0x1b, 0x2e, 0x1b, 0x31, 0x1b, 0x35, 0x1b, 0x36, 0x1b,
+  0x3e, 0x1b, 0x00, 0x00, 0x86, 0x85, 0xae, 0x3e, 0x4f, 0x8c, 0x02, 0x63,
+  0xca, 0x72, 0x31, 0x3e, 0xc6, 0x70, 0x35, 0x0b, 0xa8, 0xf7, 0x85, 0xb7,
+  0x17, 0xdb, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0xee, 0x17, 0x17,
+  0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17,
+  0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17,
+  0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x8b,
+  0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17,
+  0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17,
+  0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17,
+  0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17,
+  0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17,
+  0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17,
+  0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17,
+  0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17,
+  0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0xee, 0x84, 0x17, 0x17, 0x43, 0x13,
+  0x57, 0x13, 0x57, 0xcc, 0xac, 0x69, 0x69, 0xde, 0xde, 0x4d, 0x78, 0x7a,
+  0x76, 0x98, 0xf9, 0x2d, 0x04, 0x17, 0xb2, 0x04, 0x63, 0xcf, 0xff, 0xb5,
+  0x74, 0x78, 0x5c, 0x7f, 0x53, 0x53, 0xf5, 0x3b, 0x2d, 0xd5, 0xdb, 0x40,
+  0x1e, 0xbb, 0x4e, 0x4d, 0x51, 0x2e, 0x54, 0xe5, 0xbd, 0xd3, 0x42, 0x41,
+  0x19, 0x04, 0x3f, 0xd2, 0x67, 0xac, 0xac, 0xac, 0x2f, 0x09, 0xac, 0x24,
+  0xa6, 0xed, 0x43, 0xdf, 0xe7, 0x1f, 0x18, 0xec, 0x98, 0x65, 0x3b, 0x5d,
+  0x64, 0xfe, 0x9d, 0x67, 0x32, 0x44, 0x22, 0x3d, 0x3d, 0x3d, 0x7a, 0x65,
+  0x23, 0x9f, 0x64, 0x65, 0xca, 0x92, 0xa3, 0x8f, 0xaf, 0x58, 0x9f, 0x60,
+  0x0d, 0x63, 0x63, 0x12, 0x5a, 0xb4, 0xd5, 0x2b, 0x7e, 0x94, 0x8f, 0x8f,
+  0x14, 0x54, 0xa5, 0x81, 0xb6, 0xb7, 0x3b, 0x82, 0x0b, 0x26, 0x26, 0x23,
+  0xfe, 0x42, 0x11, 0xc0, 0x9a, 0xac, 0x4d, 0x9b, 0x54, 0x70, 0xa1, 0x4d,
+  0x32, 0x9f, 0x0f, 0x67, 0x6e, 0xa8, 0xa8, 0xa0, 0x4d, 0xa8, 0xc6, 0x74,
+  0xe0, 0xd1, 0xa7, 0xa7, 0x2e, 0x60, 0xad, 0x53, 0xe0, 0xc2, 0x31, 0x8e,
+  0xb0, 0xe5, 0x9a, 0x09, 0x82, 0xdb, 0x3c, 0x3c, 0xdf, 0xdf, 0x3a, 0x61,
+  0xc4, 0xee, 0x6f, 0xfa, 0x7d, 0xaf, 0xf8, 0x23, 0x23, 0x21, 0x40, 0xbb,
+  0x6e, 0x26, 0x96, 0x74, 0x74, 0xf0, 0x13, 0x44, 0xe8, 0x55, 0x74, 0xa9,
+  0xbb, 0x19, 0x65, 0x64, 0xee, 0xd0, 0x89, 0x21, 0xa9, 0x74, 0x4f, 0xbc,
+  0x2f, 0xa5, 0x94, 0x33, 0x57, 0x17, 0x6e, 0xcc, 0xae, 0x8e, 0x35, 0x26,
+  0x78, 0x61, 0x61, 0x8e, 0xbe, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3,
+  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3,
+  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0x41, 0x07, 0x85, 0x85, 0x85, 0x85, 0x85,
+  0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85,
+  0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85,
+  0x85, 0x85, 0x85, 0x85, 0x0e, 0x63, 0x62, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f,
+  0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x75, 0xb3, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+  0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xe3, 0x4c, 0x03, 0x83, 0xa9, 0xa9, 0xa9,
+  0xa9, 0xa9, 0xa9, 0xa9, 0x35, 0x08, 0x55, 0x87, 0x32, 0xd6, 0xc1, 0x33,
+  0x33, 0x33, 0x33, 0x33, 0x33, 0x06, 0x06, 0x65, 0xc6, 0xc6, 0xc6, 0xc6,
+  0xc6, 0xc6, 0xc6, 0x76, 0x3e, 0xe0, 0xfa, 0x68, 0x68, 0x68, 0x68, 0x68,
+  0x68, 0x68, 0x99, 0x57, 0x61, 0x67, 0x67, 0x67, 0x67, 0xee, 0x0c, 0x68,
+  0xd2, 0xd2, 0xd2, 0x03, 0xfd, 0xf5, 0x5c, 0xf5, 0x5f, 0x70, 0xdb, 0x10,
+  0x1c, 0x5e, 0x2f, 0x0f, 0x90, 0x08, 0xcc, 0xbf, 0xaa, 0x08, 0x5b, 0x53,
+  0x06, 0x16, 0xe7, 0x04, 0x53, 0x43, 0x53, 0xf9, 0x85, 0x51, 0xa1, 0x6f,
+  0x84, 0x41, 0x0f, 0xfa, 0x54, 0xbb, 0x8f, 0x7b, 0x9d, 0x12, 0x33, 0x5f,
+  0xdf, 0xe9, 0x95, 0x4a, 0x96, 0x0b, 0x9e, 0xf3, 0x0f, 0xa0, 0x03, 0xf8,
+  0x43, 0x64, 0xad, 0xe8, 0x51, 0x77, 0x63, 0xcf, 0xb4, 0xb4, 0x06, 0xdb,
+  0x7a, 0x1b, 0x20, 0x9e, 0x61, 0x2a, 0xc0, 0xdd, 0x2c, 0x86, 0x04, 0x86,
+  0x04, 0xdd, 0xc0, 0xb8, 0xa5, 0x89, 0xb3, 0xd6, 0x07, 0xa9, 0xfb, 0x86,
+  0x78, 0x78, 0xa5, 0xf4, 0x19, 0x48, 0x9a, 0xa1, 0xde, 0xe3, 0xe4, 0x05,
+  0xdd, 0x7c, 0xe1, 0xef, 0x2c, 0xd5, 0x61, 0x40, 0x40, 0x6b, 0x82, 0xee,
+  0x94, 0x27, 0xc3, 0x0a, 0x1b, 0xde, 0x39, 0xd4, 0x80, 0x2c, 0x30, 0x05,
+  0xae, 0x6d, 0xc2, 0x90, 0x22, 0x1f, 0x66, 0x5f, 0xc3, 0x71, 0x1f, 0x2b,
+  0x68, 0x68, 0x43, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x10, 0x67,
+  0xb3, 0x68, 0x2c, 0x50, 0xa0, 0x53, 0x9c, 0xe3, 0x93, 0x51, 0x82, 0xf0,
+  0x49, 0x9a, 0x97, 0x97, 0xa9, 0x35, 0x82, 0x93, 0x93, 0x63, 0x44, 0x5b,
+  0x31, 0x31, 0x41, 0xaa, 0x0d, 0x74, 0xff, 0xde, 0xef, 0xac, 0x58, 0xbe,
+  0x13, 0xda, 0x37, 0x88, 0x88, 0x10, 0x88, 0x20, 0x18, 0x88, 0x9b, 0x26,
+  0x88, 0xa4, 0xb4, 0x56, 0x6d, 0x53, 0x17, 0x8d, 0xc4, 0x93, 0x7f, 0x9d,
+  0x6d, 0xf4, 0x86, 0x3a, 0x74, 0x0c, 0xa3, 0x6f, 0x73, 0x67, 0xd6, 0x7c,
+  0x3d, 0xd8, 0xed, 0x49, 0x3b, 0x58, 0x4d, 0x8f, 0xcd, 0xa8, 0x12, 0x08,
+  0xe2, 0xa5, 0x08, 0xed, 0x0b, 0x0b, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
+  0x23, 0x23, 0x23, 0x42, 0x23, 0x23, 0x23, 0x1e, 0x23, 0xf0, 0xe3, 0x23,
+  0x0b, 0x44, 0x21, 0xb4, 0xdf, 0xa8, 0xf1, 0xd1, 0x5f, 0x5c, 0xb7, 0x2b,
+  0x2e, 0x13, 0x57, 0x45, 0xa1, 0x58, 0xfe, 0x26, 0x25, 0x7a, 0xb2, 0x98,
+  0xdc, 0xe1, 0xb4, 0xfe, 0x56, 0x92, 0x7f, 0x26, 0xb8, 0x7f, 0xf3, 0x1e,
+  0x6e, 0xb0, 0x63, 0xc9, 0x6e, 0x32, 0x32, 0x6c, 0xff, 0x6d, 0xed, 0x76,
+  0x83, 0x15, 0xd2, 0xae, 0x45, 0xa5, 0xf5, 0x61, 0x61, 0xfb, 0xc2, 0x43,
+  0xe2, 0xaa, 0x6a, 0xa2, 0x1e, 0x54, 0xd4, 0x30, 0xb1, 0xf1, 0xe4, 0xa1,
+  0x49, 0xdf, 0x8a, 0xc8, 0x66, 0x36, 0xe7, 0x7a, 0x2c, 0x84, 0xde, 0x0a,
+  0x1a, 0x58, 0xf7, 0xc8, 0xd3, 0x53, 0x03, 0x05, 0xe9, 0x1a, 0xac, 0x31,
+  0x39, 0x16, 0xcf, 0x35, 0x35, 0x35, 0xf0, 0x01, 0x00, 0x1e, 0xa8, 0x94,
+  0x2d, 0x48, 0x1d, 0x90, 0x68, 0xcf, 0xba, 0xd3, 0xdd, 0x80, 0xef, 0xa8,
+  0x1c, 0xc9, 0x40, 0x36, 0x4c, 0x57, 0x31, 0x31, 0x53, 0x6f, 0x9d, 0x37,
+  0x96, 0xd4, 0x96, 0x7e, 0xe2, 0x22, 0x09, 0x8d, 0x77, 0x8d, 0x81, 0x6b,
+  0x6b, 0x56, 0x66, 0x6b, 0x2c, 0x6f, 0xc2, 0x64, 0xf0, 0xcb, 0x6f, 0x39,
+  0xa5, 0xce, 0x5f, 0x29, 0xc5, 0x4d, 0xa4, 0x7e, 0x15, 0xc4, 0x15, 0xfe,
+  0x49, 0x5c, 0x15, 0x88, 0x15, 0x06, 0x6d, 0xbb, 0xfc, 0xdf, 0x8e, 0x6a,
+  0xad, 0xab, 0x0e, 0x5f, 0x62, 0x12, 0xde, 0x0a, 0x0a, 0x0a, 0x31, 0xfa,
+  0x27, 0x38, 0xf5, 0x13, 0x7d, 0xe4, 0x02, 0xd6, 0x63, 0x73, 0x79, 0xd6,
+  0xe4, 0x80, 0x17, 0xee, 0x7e, 0x7c, 0x34, 0x5c, 0x96, 0x5e, 0x4e, 0x97,
+  0xbe, 0x89, 0x0f, 0x54, 0x77, 0xd5, 0x32, 0x6e, 0x37, 0x10, 0x1d, 0x8e,
+  0x8e, 0xeb, 0xb3, 0x69, 0x3e, 0x01, 0x12, 0xb9, 0xfb, 0x14, 0x8c, 0xe6,
+  0x48, 0x55, 0x55, 0x55, 0x84, 0xae, 0x55, 0x72, 0x07, 0x29, 0xee, 0xc3,
+  0xa4, 0xdc, 0x3e, 0x82, 0x60, 0xed, 0x55, 0xd2, 0xd2, 0x46, 0xd2, 0x46,
+  0xab, 0x6d, 0x6d, 0x6d, 0x81, 0xd2, 0x6d, 0x6d, 0x35, 0x6d, 0xe2, 0x6d,
+  0x71, 0x72, 0xed, 0x36, 0x8b, 0xad, 0xd7, 0x72, 0x72, 0x72, 0x46, 0x46,
+  0xbe, 0x3c, 0x74, 0x28, 0xe9, 0xc3, 0x91, 0xb0, 0xba, 0x69, 0xe4, 0x45,
+  0x74, 0xff, 0xba, 0x85, 0xf7, 0xc8, 0x57, 0x24, 0xf9, 0x99, 0x03, 0xc6,
+  0x8f, 0xf9, 0xa7, 0x65, 0x79, 0x02, 0x32, 0x93, 0xb1, 0x03, 0x71, 0x8c,
+  0x6c, 0x09, 0xcc, 0xb3, 0x9e, 0xdb, 0xaf, 0xf7, 0x27, 0xdd, 0xdc, 0x3e,
+  0x0e, 0xfa, 0x59, 0xf2, 0xed, 0xd8, 0x05, 0xa3, 0xc6, 0x4b, 0x8c, 0xe3,
+  0x9b, 0x3c, 0xe4, 0x3e, 0xe2, 0x0c, 0x30, 0x74, 0x0f, 0x0f, 0x72, 0x6d,
+  0x51, 0x0f, 0x0f, 0x24, 0x34, 0x56, 0xf3, 0x4f, 0x06, 0x05, 0x24, 0x09,
+  0xd5, 0xbe, 0xa1, 0xe9, 0x4e, 0x05, 0x9a, 0x49, 0xf3, 0xf3, 0x9f, 0xf3,
+  0xf3, 0xf3, 0xd8, 0xa7, 0x32, 0xfe, 0x72, 0xc8, 0x20, 0xaf, 0x62, 0x1a,
+  0x1e, 0xd7, 0x0f, 0x1e, 0x7b, 0x25, 0x01, 0x75, 0x60, 0xaa, 0xb4, 0x92,
+  0x92, 0x5d, 0x32, 0xc4, 0xf5, 0x15, 0x04, 0x75, 0x5a, 0xf9, 0xa2, 0x50,
+  0x8b, 0x81, 0x07, 0x17, 0x03, 0xff, 0x90, 0x12, 0x57, 0x4f, 0x4e, 0x6c,
+  0x48, 0x90, 0xf8, 0x0d, 0x48, 0x07, 0x41, 0x3b, 0x10, 0xbb, 0x48, 0x1b,
+  0xd8, 0x96, 0xf7, 0xf7, 0x08, 0x0c, 0x70, 0xce, 0x4f, 0x4f, 0x09, 0xae,
+  0xd2, 0x34, 0xd8, 0xd7, 0x35, 0x54, 0x9d, 0x07, 0x37, 0x98, 0xbe, 0x72,
+  0x6e, 0x6e, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x87, 0x87,
+  0xbb, 0x87, 0x29, 0x41, 0x15, 0xff, 0x0d, 0xe1, 0xe1, 0x71, 0x36, 0xb1,
+  0x71, 0x3a, 0x3a, 0x02, 0x71, 0x3b, 0x67, 0x6a, 0x9c, 0x55, 0x01, 0x45,
+  0x23, 0xb6, 0x43, 0x0d, 0x8c, 0xd3, 0xf2, 0x88, 0x46, 0xc4, 0xed, 0x41,
+  0xbf, 0x45, 0xd2, 0x0d, 0x16, 0xa1, 0x72, 0x42, 0x42, 0x28, 0xf1, 0x75,
+  0xf3, 0x4e, 0x7d, 0x0e, 0x0f, 0xd7, 0x54, 0xd8, 0xca, 0x17, 0x84, 0x54,
+  0x19, 0x37, 0x78, 0xc3, 0x53, 0x7c, 0xde, 0x11, 0xdd, 0x58, 0xd8, 0xac,
+  0x31, 0x39, 0xf8, 0x01, 0x4f, 0x50, 0xeb, 0x14, 0x3a, 0x8a, 0x9f, 0x9f,
+  0x9f, 0x9f, 0xe2, 0x9f, 0x7c, 0x2e, 0x5f, 0xf2, 0x2b, 0x3a, 0xbd, 0xd8,
+  0x60, 0xa7, 0x07, 0x08, 0xb4, 0xb5, 0xdd, 0xcd, 0xa3, 0xa5, 0x0b, 0xa3,
+  0x02, 0xe9, 0x77, 0xab, 0x30, 0x1f, 0x76, 0x56, 0x5a, 0x97, 0x8c, 0xd8,
+  0x2e, 0x07, 0x32, 0xfe, 0x36, 0xe7, 0xba, 0x91, 0xf2, 0x81, 0xa5, 0xbc,
+  0x3f, 0xcf, 0x22, 0x45, 0x9b, 0x8e, 0xcd, 0x13, 0x4b, 0x72, 0x8b, 0x23,
+  0xf5, 0xfc, 0x34, 0x94, 0xad, 0xcc, 0xfe, 0xa3, 0xc4, 0x5f, 0xe4, 0xef,
+  0x34, 0xbc, 0x4a, 0x31, 0xa6, 0x54, 0xbc, 0x90, 0x8d, 0xc7, 0x01, 0x02,
+  0x68, 0xa1, 0x68, 0x45, 0x60, 0x68, 0x94, 0x60, 0x8b, 0x71, 0x2c, 0xf5,
+  0x63, 0x60, 0xb7, 0x26, 0xc0, 0x78, 0xe7, 0x7e, 0xb4, 0xef, 0x75, 0xad,
+  0xe8, 0x7e, 0xdb, 0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 0xc4,
+  0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 0xc4,
+  0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 0xc4,
+  0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 0x74, 0xc4, 0xc4,
+  0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 0x9d, 0x3d, 0x25, 0x9d,
+  0xc7, 0x25, 0x7f, 0xdc, 0x36, 0x07, 0xb0, 0xb9, 0xb9, 0xb9, 0x16, 0xb9,
+  0x87, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0x98, 0xa1, 0xa1, 0xa1, 0x18,
+  0xa1, 0xa1, 0xa1, 0x94, 0xa0, 0x9e, 0x2e, 0xb7, 0x42, 0x46, 0x97, 0x17,
+  0x71, 0x71, 0x39, 0x71, 0xfa, 0xc5, 0x6c, 0xb7, 0xda, 0xff, 0xf0, 0x5e,
+  0xc6, 0xd3, 0xc2, 0x71, 0xb0, 0x84, 0x3a, 0x88, 0x09, 0xa5, 0xa5, 0xa5,
+  0xa5, 0xa5, 0xf9, 0xa7, 0xa5, 0x25, 0x9d, 0x82, 0x3f, 0x42, 0x42, 0xfd,
+  0xfd, 0x38, 0x94, 0x7b, 0x37, 0xa4, 0xd1, 0x96, 0x96, 0x3b, 0x0d, 0xa6,
+  0x5c, 0x62, 0x18, 0xf7, 0xb7, 0x6e, 0xe1, 0xd1, 0x93, 0xd1, 0xd1, 0xd1,
+  0xd1, 0xd1, 0xd1, 0x50, 0x10, 0x6a, 0x10, 0x04, 0xd1, 0xd1, 0xde, 0xa8,
+  0x0b, 0xe5, 0xad, 0x65, 0x0b, 0xa8, 0x82, 0xe6, 0x38, 0x0f, 0xa3, 0x19,
+  0xba, 0xf2, 0xb7, 0x8c, 0x47, 0x6c, 0x5e, 0x49, 0xe6, 0x56, 0x56, 0xac,
+  0x7f, 0x30, 0x56, 0x14, 0xac, 0xb1, 0xe0, 0x30, 0xae, 0x23, 0xeb, 0x9b,
+  0x9b, 0x76, 0x76, 0x25, 0x9b, 0x4a, 0x97, 0x83, 0x1c, 0x83, 0x8c, 0xac,
+  0x56, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x16, 0x60, 0x16, 0xec,
+  0x67, 0xe7, 0x46, 0x9e, 0xd5, 0x9e, 0xc7, 0x9e, 0xd5, 0x9e, 0x9e, 0x9e,
+  0x79, 0xff, 0x9e, 0x98, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8,
+  0x1c, 0x22, 0x10, 0x83, 0x81, 0x12, 0xf0, 0x10, 0x29, 0x57, 0x0a, 0x23,
+  0x6a, 0xf1, 0xaf, 0x74, 0x56, 0xb1, 0x4f, 0x12, 0xeb, 0x3e, 0x72, 0xcc,
+  0x74, 0x36, 0xdb, 0xd5, 0x97, 0x5a, 0x85, 0x9d, 0xe3, 0x2f, 0x97, 0x7f,
+  0xa9, 0x07, 0xdf, 0x27, 0x91, 0x89, 0x5f, 0x2c, 0x01, 0x80, 0xbb, 0xbb,
+  0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0x5a,
+  0x5b, 0x27, 0xbb, 0x7e, 0x2d, 0x83, 0x69, 0x00, 0xc9, 0x1c, 0x28, 0xdd,
+  0x00, 0x2f, 0xb3, 0xc7, 0xa8, 0xce, 0xb3, 0x9e, 0x5e, 0xc7, 0x83, 0xfc,
+  0x53, 0x9b, 0xa1, 0xf1, 0xc6, 0xb8, 0x46, 0xc6, 0xa3, 0xf3, 0x46, 0x46,
+  0x75, 0xbb, 0xdd, 0x34, 0xdc, 0x20, 0x8b, 0xb4, 0x71, 0x17, 0xa7, 0xc1,
+  0xa0, 0x51, 0x51, 0x51, 0xcb, 0xd6, 0x51, 0x51, 0x51, 0x7d, 0xcb, 0xac,
+  0xdb, 0xa2, 0x72, 0xdc, 0xa8, 0x88, 0x34, 0x95, 0xbf, 0x25, 0x03, 0x49,
+  0x16, 0x96, 0xf6, 0x16, 0xbc, 0xa9, 0x91, 0x05, 0xa9, 0xc1, 0x15, 0x0d,
+  0xd8, 0xc1, 0xda, 0xf3, 0x14, 0x4b, 0x4f, 0x88, 0xef, 0xff, 0x25, 0x08,
+  0xcf, 0x25, 0x0c, 0x15, 0x76, 0x76, 0xce, 0x3d, 0xce, 0x7f, 0x18, 0xe2,
+  0xcd, 0xf4, 0x99, 0xfe, 0x29, 0xaf, 0xca, 0xe2, 0xc5, 0xc8, 0x42, 0x53,
+  0xa1, 0x7b, 0xde, 0xc9, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0x94, 0xbc,
+  0xc2, 0x9c, 0xa9, 0xc7, 0x10, 0xc4, 0xa3, 0x9a, 0xce, 0x48, 0x8c, 0x6c,
+  0xd5, 0xeb, 0x48, 0xd4, 0xc6, 0xac, 0x72, 0x09, 0xf2, 0xbf, 0x4c, 0x3d,
+  0x5d, 0xc9, 0xe2, 0x5d, 0x69, 0x69, 0x10, 0x69, 0xf4, 0x4d, 0x69, 0x0d,
+  0x4d, 0xa4, 0x29, 0x7e, 0x2a, 0xfb, 0x72, 0x78, 0x06, 0x28, 0xa7, 0x8f,
+  0xa7, 0x8f, 0x8d, 0x8d, 0x46, 0x63, 0x96, 0xe5, 0x6c, 0x71, 0x7f, 0x3b,
+  0xe5, 0xcb, 0xcb, 0x15, 0x54, 0x9d, 0xac, 0xc9, 0x17, 0x3e, 0x9e, 0x7b,
+  0xca, 0xca, 0x3e, 0xd7, 0xc3, 0x96, 0xb6, 0xd1, 0x79, 0x4b, 0xe1, 0x4e,
+  0x11, 0x1a, 0x60, 0x55, 0xbb, 0x63, 0x63, 0x72, 0x59, 0x62, 0x8d, 0x6a,
+  0xcd, 0x3c, 0xf9, 0xc5, 0xcd, 0x79, 0x5c, 0x5c, 0x5c, 0x63, 0xba, 0x77,
+  0x99, 0x3c, 0x4c, 0x3c, 0x77, 0x3c, 0xc3, 0xae, 0x73, 0xf5, 0xa9, 0xd5,
+  0xd5, 0xf8, 0xee, 0xd4, 0xa7, 0xa7, 0xf0, 0x9a, 0x3e, 0xd5, 0xd5, 0x3b,
+  0xf7, 0xd2, 0x2b, 0xd0, 0x32, 0x43, 0xb3, 0xb3, 0xfa, 0xbf, 0x98, 0x66,
+  0x66, 0x1d, 0x0d, 0x72, 0x27, 0x27, 0x0f, 0x92, 0xce, 0xe3, 0xde, 0xc4,
+  0x09, 0x2c, 0x47, 0xc6, 0x29, 0x29, 0x3e, 0xea, 0x4a, 0xee, 0x11, 0xaa,
+  0xbd, 0x94, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x04, 0x87, 0xc3, 0x75,
+  0x3f, 0xd9, 0x1c, 0x43, 0x10, 0xa4, 0x2e, 0x93, 0xf8, 0xa8, 0x41, 0x98,
+  0x91, 0xda, 0xc9, 0x17, 0x49, 0x00, 0x5a, 0xf1, 0x49, 0x4f, 0xa6, 0x7f,
+  0x89, 0x25, 0x22, 0x8b, 0x10, 0x03, 0x2c, 0x3f, 0x3f, 0x1e, 0x2d, 0x3d,
+  0xac, 0xa8, 0xd6, 0x05, 0x99, 0x07, 0x79, 0x0c, 0x18, 0x65, 0x20, 0x9c,
+  0x9d, 0xfa, 0x10, 0xc4, 0xe9, 0x66, 0xe5, 0x46, 0xab, 0x64, 0xa3, 0xa3,
+  0x69, 0x17, 0x8b, 0xdf, 0x0c, 0x76, 0x0d, 0xbf, 0x0d, 0x4b, 0xd9, 0xa7,
+  0xa1, 0xa1, 0xb4, 0x9a, 0x39, 0x54, 0x2d, 0x04, 0x86, 0xbc, 0x09, 0xb2,
+  0x69, 0x63, 0x16, 0xe9, 0x3d, 0xd6, 0x39, 0xde, 0xcd, 0xe8, 0x1d, 0x0e,
+  0x82, 0x1d, 0x19, 0x19, 0x19, 0xdc, 0x79, 0x19, 0xce, 0x5d, 0xec, 0xec,
+  0xd3, 0x4c, 0x30, 0x58, 0xa4, 0xd1, 0xa4, 0x84, 0x83, 0x29, 0x1f, 0xa4,
+  0x2e, 0xe6, 0x31, 0xc6, 0xb5, 0xa9, 0x43, 0x02, 0x7d, 0x98, 0x3d, 0x6f,
+  0xf3, 0xb6, 0x8d, 0x27, 0x52, 0x52, 0x3d, 0x6a, 0xd5, 0xcf, 0x18, 0x4d,
+  0xf6, 0xdb, 0x51, 0x85, 0xa6, 0xa8, 0x1c, 0xa6, 0x17, 0xe2, 0x11, 0xbf,
+  0x1a, 0xf8, 0xf4, 0x13, 0x12, 0xe5, 0xff, 0xa0, 0xa0, 0xb8, 0xe1, 0x50,
+  0x7d, 0x2a, 0x8d, 0x63, 0x5a, 0x39, 0xc0, 0xf2, 0x63, 0xf8, 0x32, 0x9f,
+  0x20, 0xcb, 0x4d, 0xf7, 0xda, 0xad, 0x66, 0x0f, 0x3e, 0x3e, 0x3e, 0x3e,
+  0xd4, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e,
+  0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e,
+  0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x59, 0x3e, 0x3e,
+  0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e,
+  0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e,
+  0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e,
+  0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e,
+  0x3e, 0x3e, 0x3e, 0x3e, 0x86, 0xfb, 0x3e, 0x3e, 0x65, 0xe2, 0x15, 0xfc,
+  0x11, 0x77, 0xe2, 0x84, 0xfc, 0x61, 0x36, 0x57, 0xda, 0x36, 0x05, 0xbb,
+  0x97, 0x34, 0x9f, 0xf4, 0x22, 0xcc, 0x6e, 0x36, 0x6e, 0x83, 0x3c, 0x41,
+  0x9a, 0x6e, 0xb7, 0x14, 0xe1, 0x04, 0x6b, 0xf7, 0xb8, 0x90, 0xb8, 0xaf,
+  0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0xd1, 0x14, 0x58, 0x99, 0x0a, 0x6d, 0x22,
+  0x84, 0x81, 0xb4, 0x52, 0x52, 0xbb, 0x82, 0x22, 0xe7, 0x52, 0x30, 0x87,
+  0x53, 0xc2, 0x75, 0x2e, 0xdb, 0xfe, 0x66, 0x1d, 0xef, 0x26, 0x00, 0xdd,
+  0xbd, 0x40, 0x58, 0x00, 0x80, 0x87, 0xd0, 0x94, 0x93, 0x1b, 0x60, 0x60,
+  0x60, 0x0c, 0x60, 0xd0, 0x2e, 0x2d, 0x2d, 0x0f, 0x66, 0x23, 0xc1, 0x98,
+  0xa5, 0xd4, 0x0f, 0xec, 0x0f, 0x0f, 0x90, 0x64, 0xc9, 0x37, 0x33, 0x25,
+  0x46, 0x25, 0x25, 0x0a, 0x25, 0x10, 0x6a, 0x25, 0x07, 0x21, 0xfb, 0x71,
+  0x2e, 0xa9, 0x90, 0x27, 0xaf, 0xf4, 0x34, 0x3d, 0x43, 0x43, 0x4e, 0xa9,
+  0xc7, 0xf3, 0x01, 0x3d, 0x3d, 0xa1, 0xff, 0xfa, 0x65, 0xe7, 0xd0, 0x0a,
+  0x4a, 0x8a, 0x3c, 0x48, 0xff, 0x91, 0xa3, 0xcb, 0xe6, 0xf1, 0xd5, 0x27,
+  0xd4, 0xa4, 0xac, 0x04, 0x09, 0xb1, 0x51, 0x22, 0x09, 0x39, 0x22, 0x22,
+  0xd7, 0xfc, 0x1d, 0xa7, 0x65, 0x9e, 0x24, 0x0b, 0xd4, 0xfa, 0xb6, 0xce,
+  0x2b, 0x35, 0x07, 0xdd, 0x92, 0x1f, 0xce, 0x71, 0xc8, 0xc2, 0x63, 0x4f,
+  0x7b, 0x03, 0x28, 0xbf, 0x8c, 0x40, 0x54, 0x58, 0x3c, 0xec, 0xe0, 0x94,
+  0x42, 0x65, 0x4a, 0x4a, 0xe8, 0x65, 0xc8, 0x3f, 0x4a, 0x9f, 0x9f, 0xe8,
+  0x1c, 0xfa, 0xd6, 0xb0, 0xe4, 0x6c, 0x8f, 0x14, 0xad, 0x84, 0x0a, 0x8d,
+  0xad, 0x57, 0x33, 0x7f, 0x60, 0x03, 0x0a, 0x14, 0x7f, 0x7e, 0x6e, 0x90,
+  0xb9, 0x15, 0x02, 0x2c, 0xef, 0x3f, 0xd0, 0xb1, 0x7e, 0xef, 0xef, 0x86,
+  0xd9, 0x62, 0x7b, 0xd9, 0xe9, 0xd9, 0x7b, 0xda, 0x9a, 0xd9, 0x6b, 0x84,
+  0x3d, 0xda, 0x94, 0x94, 0xda, 0x29, 0xda, 0xff, 0xf5, 0x3c, 0xa8, 0x7d,
+  0x63, 0x7a, 0x63, 0x39, 0x90, 0xe3, 0xc6, 0xc8, 0xf7, 0xbd, 0x2f, 0x3a,
+  0x4c, 0x41, 0x3b, 0x0f, 0x12, 0xb3, 0x89, 0x00, 0xf2, 0xec, 0xf7, 0xcd,
+  0x0b, 0xba, 0xc7, 0x82, 0x88, 0xf0, 0xc7, 0x70, 0x07, 0x41, 0x45, 0x55,
+  0x43, 0xcd, 0x1a, 0x55, 0x43, 0x2e, 0x56, 0x19, 0xa4, 0x92, 0x9f, 0x9f,
+  0xce, 0xe1, 0xcd, 0x38, 0x38, 0x38, 0xfe, 0xfb, 0xed, 0x38, 0xb0, 0x4f,
+  0x4f, 0xef, 0xb0, 0x06, 0x8a, 0x15, 0x81, 0xbd, 0x81, 0x15, 0x01, 0x82,
+  0x5e, 0xe2, 0x67, 0xa6, 0x69, 0x71, 0xab, 0xd0, 0x0f, 0x07, 0x4c, 0x7a,
+  0x8b, 0x5b, 0xf7, 0x21, 0xc5, 0x51, 0xc8, 0x3e, 0x7b, 0x7b, 0x68, 0xec,
+  0x1e, 0x95, 0x1e, 0xc9, 0xcd, 0x6b, 0xbd, 0xf6, 0x25, 0x15, 0x86, 0xa7,
+  0xad, 0xd1, 0xe9, 0x1c, 0x1c, 0xa5, 0x35, 0xfd, 0x1c, 0x1c, 0x31, 0x97,
+  0x90, 0x81, 0xf3, 0x7a, 0xab, 0xa4, 0xb4, 0xc7, 0xa5, 0x67, 0xf7, 0x36,
+  0x6d, 0x0c, 0xc9, 0x0c, 0xae, 0x0c, 0x69, 0xae, 0x0c, 0x70, 0xcd, 0x65,
+  0x3f, 0xb0, 0x5b, 0xf1, 0xf1, 0x5b, 0xf1, 0xd7, 0x45, 0x5b, 0xe9, 0x7d,
+  0x1e, 0xf1, 0xfb, 0xc0, 0x8f, 0x0f, 0x2b, 0x44, 0x72, 0x5f, 0x63, 0x04,
+  0xb6, 0x5f, 0x09, 0xd9, 0x1c, 0x3a, 0x2c, 0xc3, 0x66, 0xc4, 0xe9, 0x8b,
+  0xba, 0xb5, 0x2e, 0xb8, 0x9e, 0xae, 0x19, 0x23, 0xc9, 0x32, 0x32, 0x7d,
+  0x74, 0xf2, 0x84, 0xf9, 0x98, 0x3b, 0xfe, 0xfe, 0xfe, 0x32, 0x76, 0xd8,
+  0xd8, 0xd8, 0xcc, 0x18, 0x18, 0x8a, 0x75, 0xb0, 0x60, 0x04, 0x82, 0xa3,
+  0xcf, 0xa2, 0x05, 0x84, 0x84, 0xcf, 0x8f, 0xce, 0x4b, 0x81, 0x53, 0xc5,
+  0x56, 0x74, 0x81, 0x96, 0xdc, 0x81, 0x81, 0x81, 0x87, 0x81, 0xd2, 0x71,
+  0x1a, 0xd2, 0x1a, 0x76, 0x35, 0x87, 0xee, 0x8e, 0xc7, 0xca, 0xdb, 0xdb,
+  0x14, 0x14, 0x14, 0x14, 0xb5, 0xb5, 0xb5, 0xd0, 0xdb, 0xb5, 0xaf, 0x15,
+  0x91, 0x11, 0x11, 0x64, 0x51, 0xc0, 0x43, 0x11, 0x3a, 0x70, 0x9c, 0x3a,
+  0x44, 0x14, 0x05, 0x9c, 0xab, 0x52, 0x8f, 0x8f, 0x06, 0x8f, 0xc6, 0xfc,
+  0x62, 0x47, 0x8a, 0x77, 0x51, 0x87, 0x5a, 0x4d, 0x00, 0x6b, 0x13, 0x39,
+  0xd1, 0xcf, 0x84, 0x13, 0x1e, 0x1e, 0x1e, 0xf0, 0x19, 0x1f, 0xce, 0x23,
+  0x39, 0xea, 0x65, 0x4c, 0x35, 0xcd, 0x16, 0x45, 0xc6, 0x90, 0x9a, 0x53,
+  0xb4, 0xd6, 0x83, 0x72, 0x06, 0x35, 0x87, 0xa0, 0xfb, 0x5b, 0x78, 0x3d,
+  0x86, 0x96, 0x58, 0xdb, 0xf5, 0xe6, 0xd5, 0x70, 0x27, 0x27, 0x27, 0x27,
+  0x4d, 0xb5, 0x48, 0x15, 0xd2, 0xcc, 0xc0, 0x5d, 0xf3, 0xd1, 0x88, 0x57,
+  0x57, 0x57, 0xfe, 0xa5, 0x78, 0xe2, 0x4b, 0xdf, 0xe3, 0x4f, 0xf7, 0xe1,
+  0x14, 0xe2, 0x45, 0x45, 0x39, 0x29, 0x29, 0x29, 0xed, 0x29, 0x05, 0xcd,
+  0x30, 0xc4, 0x35, 0x01, 0x7a, 0x26, 0x2f, 0x7f, 0x60, 0xc6, 0xc6, 0x2d,
+  0x75, 0xa1, 0xc6, 0x06, 0x91, 0x91, 0x91, 0xbb, 0x97, 0xa9, 0x1b, 0x56,
+  0x91, 0x5a, 0x45, 0xf3, 0x05, 0x6e, 0x8c, 0xd7, 0x0d, 0x9e, 0xd7, 0xa0,
+  0xea, 0x0c, 0x66, 0x1c, 0x1f, 0x7f, 0x28, 0x64, 0xbc, 0x0b, 0x8a, 0xc6,
+  0x46, 0x64, 0x01, 0x8c, 0x0b, 0xc9, 0xf4, 0xc5, 0xa6, 0xb0, 0x1b, 0xd1,
+  0xfe, 0xef, 0x8f, 0x8e, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
+  0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0x71, 0xe6,
+  0x3d, 0x17, 0x75, 0xc5, 0x10, 0xad, 0xa3, 0x5a, 0xe7, 0x2f, 0xc1, 0x59,
+  0x77, 0x0f, 0x9c, 0x51, 0x98, 0x3e, 0x5e, 0xe2, 0x0e, 0xb9, 0xdb, 0x6d,
+  0xb9, 0xdb, 0x6b, 0x09, 0xb2, 0x9b, 0x52, 0xec, 0xee, 0x21, 0xe0, 0x3d,
+  0x8d, 0xd3, 0x3d, 0x98, 0x2e, 0xe3, 0xe7, 0xc3, 0x08, 0xce, 0xd7, 0xc3,
+  0x3c, 0x7f, 0x08, 0xbf, 0x4a, 0xae, 0x0d, 0x2e, 0xfd, 0x0e, 0x85, 0xc4,
+  0x57, 0x94, 0xb1, 0x7f, 0x5f, 0xe1, 0x23, 0x4a, 0x8e, 0xec, 0xd3, 0xec,
+  0x18, 0xde, 0xfa, 0xe1, 0x1b, 0xdb, 0xac, 0x83, 0x0a, 0x99, 0x75, 0xeb,
+  0xd4, 0x10, 0x7d, 0xbb, 0xb7, 0x00, 0xc5, 0xce, 0xac, 0xb1, 0x78, 0xcb,
+  0xa5, 0xa5, 0x78, 0x78, 0x78, 0x78, 0x1e, 0x78, 0x78, 0x78, 0x06, 0x78,
+  0xe5, 0x3e, 0xae, 0x55, 0xb7, 0xbb, 0xb7, 0x08, 0xef, 0x5d, 0xf3, 0xb7,
+  0x52, 0x1a, 0x76, 0x6c, 0xb0, 0xf0, 0x71, 0x9b, 0x65, 0x9a, 0xd3, 0xcb,
+  0x3f, 0xab, 0x3f, 0x45, 0x2d, 0x3f, 0xfd, 0x7a, 0x03, 0x46, 0xb8, 0x0a,
+  0x03, 0xc5, 0x82, 0x4d, 0x69, 0x69, 0x94, 0xd0, 0x90, 0x14, 0x94, 0xed,
+  0x15, 0xb4, 0xed, 0x76, 0xb7, 0xb8, 0x7e, 0xa5, 0xcd, 0xd6, 0x88, 0x11,
+  0x02, 0x03, 0x51, 0xc8, 0x76, 0xa7, 0x0f, 0xfb, 0x60, 0x95, 0x01, 0xe1,
+  0xde, 0x3b, 0x12, 0x8c, 0x70, 0xd3, 0x8e, 0xd3, 0xe7, 0x01, 0x51, 0xd9,
+  0xbd, 0x5c, 0x95, 0x9d, 0x7c, 0xce, 0xe2, 0x94, 0x47, 0x81, 0xd0, 0x6b,
+  0xda, 0x0e, 0x6d, 0x7c, 0xe1, 0xa8, 0x12, 0x12, 0xd1, 0xd2, 0xf1, 0x12,
+  0x15, 0x15, 0x12, 0x89, 0x16, 0xa7, 0xe4, 0x58, 0x53, 0x1d, 0xd9, 0x3a,
+  0xac, 0xb5, 0x65, 0x65, 0xa8, 0x50, 0xf5, 0x50, 0x65, 0xe0, 0xf2, 0x9d,
+  0xec, 0x7e, 0xd4, 0x8c, 0x17, 0x81, 0x6e, 0x65, 0x67, 0x6c, 0xbd, 0x2e,
+  0x38, 0x84, 0xec, 0x1d, 0x92, 0x84, 0x92, 0xf9, 0x05, 0x94, 0x0b, 0x0b,
+  0x19, 0x00, 0x94, 0x56, 0x2f, 0x28, 0x12, 0x69, 0x2a, 0xc0, 0xc6, 0xc4,
+  0x95, 0x41, 0x9f, 0xb2, 0x57, 0x0d, 0xda, 0xe3, 0x51, 0x86, 0x6c, 0x2e,
+  0x6b, 0x6d, 0xcb, 0xd0, 0x2f, 0xeb, 0xf9, 0x04, 0x02, 0x14, 0x02, 0x14,
+  0x02, 0x83, 0x21, 0xf4, 0x95, 0x31, 0x5b, 0x54, 0x6f, 0xa3, 0xe6, 0xac,
+  0x57, 0x0a, 0xec, 0x55, 0x64, 0x41, 0x56, 0x4e, 0x56, 0xfa, 0xd0, 0x10,
+  0x66, 0x0d, 0x21, 0x69, 0x61, 0x56, 0x23, 0x3c, 0x6b, 0xdc, 0x6b, 0x2a,
+  0x67, 0xad, 0x6a, 0xd1, 0xfa, 0xc5, 0x20, 0x51, 0x4f, 0x38, 0x44, 0x70,
+  0x39, 0x4b, 0x12, 0x63, 0x94, 0xd8, 0xf6, 0xdb, 0x78, 0xca, 0xd0, 0xf9,
+  0x00, 0xdc, 0x94, 0x62, 0xfb, 0x84, 0x74, 0xa0, 0x8d, 0x90, 0x9d, 0x89,
+  0x0a, 0xae, 0x99, 0xed, 0x43, 0x07, 0x4c, 0x2f, 0x93, 0xa3, 0x93, 0x4e,
+  0xe6, 0x07, 0x84, 0x98, 0xef, 0x51, 0x05, 0xc4, 0x9d, 0xa2, 0x92, 0xbc,
+  0x3f, 0xc0, 0x77, 0x06, 0x9e, 0x9a, 0xe9, 0xe6, 0x02, 0x08, 0x16, 0xb2,
+  0x96, 0x7a, 0xe3, 0x5f, 0x02, 0xb8, 0x55, 0x30, 0xb8, 0x49, 0xaa, 0x65,
+  0x65, 0x66, 0x71, 0xcd, 0x75, 0xfd, 0x06, 0xcb, 0x85, 0x00, 0xd4, 0x4d,
+  0x82, 0xd9, 0x71, 0x66, 0xce, 0xd3, 0x56, 0x19, 0x85, 0xf3, 0xd3, 0x99,
+  0xd3, 0xc0, 0x00, 0xb8, 0x8f, 0x14, 0x89, 0x04, 0xec, 0xad, 0xd7, 0xe4,
+  0xa5, 0x7c, 0x9f, 0x79, 0x73, 0x5e, 0xda, 0x91, 0xda, 0x65, 0xaa, 0xa1,
+  0x31, 0x28, 0xea, 0x4d, 0xb1, 0xc1, 0xc3, 0x69, 0x60, 0x03, 0xf2, 0x40,
+  0x7a, 0x77, 0xfb, 0xc6, 0xd6, 0xf4, 0xd6, 0x8c, 0x08, 0xe9, 0xec, 0x72,
+  0x84, 0x7d, 0x72, 0x62, 0x7a, 0xd4, 0x69, 0xa2, 0xcf, 0x13, 0x2c, 0x2c,
+  0x2c, 0x2c, 0x22, 0xa3, 0xa3, 0xb6, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3,
+  0x6c, 0xdb, 0x45, 0x20, 0xd2, 0x16, 0x28, 0xfa, 0x49, 0x18, 0x02, 0xe5,
+  0x76, 0x76, 0x73, 0xa6, 0xf4, 0xd9, 0x76, 0xc0, 0xc2, 0xe7, 0x70, 0x94,
+  0xf2, 0x98, 0x83, 0xee, 0xe5, 0xee, 0x65, 0x13, 0x47, 0x90, 0x21, 0x78,
+  0x4e, 0xef, 0x94, 0x98, 0xc4, 0xb7, 0x66, 0x57, 0x9f, 0x63, 0xba, 0x57,
+  0x7d, 0xb4, 0x21, 0x04, 0x62, 0x04, 0x96, 0xcd, 0xfd, 0xd9, 0xf7, 0x23,
+  0x97, 0x97, 0x06, 0x4a, 0x68, 0xa5, 0x1e, 0x03, 0x18, 0x12, 0xc9, 0x1c,
+  0x28, 0xa1, 0xa7, 0xb8, 0xd9, 0xa2, 0x85, 0xd0, 0xec, 0x78, 0x35, 0x0f,
+  0x51, 0x2d, 0x8b, 0x77, 0x8b, 0xfc, 0xb9, 0x58, 0xd4, 0x7b, 0x3d, 0xa0,
+  0x2f, 0x17, 0x4a, 0x18, 0x98, 0xa4, 0xd6, 0x8e, 0x90, 0x0b, 0x30, 0xd6,
+  0xa0, 0x97, 0x98, 0x10, 0x19, 0x10, 0x7e, 0xbd, 0xda, 0x07, 0x4e, 0x29,
+  0x44, 0x7b, 0x07, 0x7c, 0x07, 0x93, 0x86, 0x81, 0x69, 0xd7, 0xce, 0xd7,
+  0xd7, 0x30, 0xac, 0xce, 0x53, 0x1c, 0xae, 0xb9, 0x9b, 0x09, 0x7a, 0xfc,
+  0x90, 0x7a, 0x66, 0xbb, 0x69, 0xb8, 0x75, 0x3a, 0x69, 0xf2, 0x16, 0x2f,
+  0x8d, 0xa7, 0x9c, 0x56, 0x99, 0x5d, 0x5d, 0xa8, 0x5d, 0x7a, 0xe9, 0x68,
+  0xe9, 0xe9, 0x4e, 0xe9, 0xca, 0xe9, 0xe4, 0xb4, 0x08, 0x47, 0xed, 0xed,
+  0xed, 0xed, 0xed, 0xed, 0xed, 0x58, 0x34, 0x95, 0x0a, 0xed, 0xfc, 0x1e,
+  0x1e, 0x93, 0x7d, 0x51, 0x9e, 0x1e, 0x17, 0xc3, 0x4f, 0x2b, 0x85, 0x8a,
+  0x05, 0x05, 0x8a, 0x3e, 0x68, 0xd5, 0x78, 0x92, 0x18, 0xb1, 0xc2, 0xa4,
+  0x59, 0x01, 0x01, 0x0b, 0x34, 0xcb, 0xd6, 0xe4, 0x7c, 0xd9, 0x5d, 0x18,
+  0x65, 0xf2, 0xfe, 0xf4, 0xc0, 0xe8, 0xd9, 0xd9, 0x8b, 0xbe, 0x80, 0x41,
+  0x55, 0x5a, 0xdc, 0xe7, 0xcf, 0x37, 0xf2, 0x91, 0x25, 0xa0, 0xbc, 0xec,
+  0xeb, 0x53, 0x53, 0x53, 0x5c, 0x78, 0x07, 0xf2, 0x1c, 0x3e, 0xaa, 0xe4,
+  0x94, 0xc7, 0x7e, 0x10, 0x46, 0x09, 0x5b, 0xb3, 0x24, 0xfa, 0xcd, 0x11,
+  0x66, 0x67, 0xa6, 0x2a, 0x38, 0xb4, 0x43, 0xd7, 0x0e, 0xa7, 0xf8, 0x80,
+  0xa7, 0x78, 0xf8, 0x74, 0xfc, 0x8c, 0x35, 0xc1, 0x28, 0x66, 0xf2, 0x75,
+  0x98, 0xe9, 0x99, 0xd8, 0x67, 0x87, 0x0b, 0x0a, 0x60, 0x44, 0x6a, 0x6a,
+  0x6a, 0x84, 0x5e, 0x8b, 0xdb, 0x08, 0x3d, 0x45, 0x7e, 0xdb, 0xd1, 0xab,
+  0x14, 0xe3, 0xa7, 0x35, 0x5a, 0x36, 0xde, 0x5a, 0xae, 0x86, 0x4a, 0x4a,
+  0x0e, 0x4b, 0x63, 0x96, 0x33, 0xcf, 0x4b, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a,
+  0x8d, 0x24, 0xde, 0x2d, 0x74, 0x12, 0xaa, 0xb6, 0x74, 0x79, 0x79, 0x54,
+  0xda, 0x93, 0x16, 0xef, 0x0a, 0x37, 0x6c, 0x03, 0xc0, 0x54, 0x6e, 0x5e,
+  0xc2, 0xee, 0x10, 0xcc, 0xbf, 0xd1, 0x6d, 0x35, 0x99, 0xb1, 0x15, 0xbe,
+  0x0f, 0x9b, 0xdc, 0x2a, 0xfc, 0xda, 0x21, 0xd0, 0x56, 0x18, 0x36, 0xd4,
+  0x79, 0x95, 0x45, 0xba, 0x43, 0x9b, 0xc0, 0xd8, 0x53, 0xb8, 0x3a, 0xa1,
+  0xd1, 0xb8, 0xa0, 0x40, 0xa8, 0x21, 0x90, 0xaf, 0x69, 0x6b, 0x3c, 0xbd,
+  0xf5, 0x0a, 0x48, 0x2b, 0x16, 0xf5, 0xbc, 0x14, 0xd6, 0x8b, 0xf4, 0xad,
+  0xf4, 0x06, 0xb7, 0x56, 0x24, 0x15, 0x4a, 0x87, 0xfe, 0x0d, 0x9d, 0x26,
+  0x61, 0xdd, 0x29, 0xd8, 0x49, 0x99, 0xa9, 0x16, 0x6e, 0xfd, 0x44, 0x2f,
+  0xbe, 0x3e, 0xae, 0xa2, 0x9b, 0x79, 0xaf, 0x51, 0x43, 0x79, 0xaf, 0xba,
+  0x75, 0x16, 0x8a, 0x72, 0x9c, 0xf5, 0x99, 0xb5, 0x99, 0xb3, 0x62, 0x05,
+  0x26, 0x87, 0xa7, 0xd0, 0xb0, 0xa9, 0x53, 0x79, 0x7f, 0xc6, 0xb2, 0x0a,
+  0x7f, 0xcb, 0x64, 0x0b, 0x0b, 0xbc, 0xe5, 0xad, 0xa7, 0x56, 0x05, 0x1a,
+  0xc6, 0x11, 0x27, 0xb0, 0x0d, 0x8e, 0x48, 0xc2, 0xab, 0x6c, 0x3d, 0x01,
+  0x7f, 0x1d, 0xfd, 0xaf, 0xf9, 0x48, 0xfa, 0x50, 0x72, 0xdf, 0xe4, 0x79,
+  0x5b, 0x93, 0x2a, 0x1a, 0x67, 0x68, 0x45, 0x17, 0x4e, 0xe1, 0x76, 0x1b,
+  0x49, 0xd5, 0x36, 0x31, 0xf4, 0x3d, 0x6b, 0xa3, 0xf0, 0x10, 0x10, 0x86,
+  0x05, 0x1b, 0x1f, 0xa4, 0x96, 0xf6, 0x9a, 0xf4, 0x82, 0xfb, 0x2a, 0xfb,
+  0x00, 0x58, 0xc5, 0xc0, 0x2c, 0x9b, 0x50, 0xe5, 0x61, 0xd5, 0xb5, 0x2a,
+  0x47, 0xb6, 0xc1, 0xd4, 0xc2, 0x97, 0x3c, 0xd9, 0x81, 0x61, 0xad, 0x38,
+  0x6d, 0x38, 0x6d, 0xe6, 0x58, 0x61, 0xc9, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2,
+  0xe2, 0xe2, 0xe2, 0xe2, 0x9f, 0x5c, 0x2c, 0xe2, 0xbb, 0xd7, 0x3e, 0xdf,
+  0x48, 0x50, 0x11, 0xcf, 0x44, 0xba, 0xc5, 0x48, 0xc4, 0xc2, 0x8a, 0x41,
+  0x1a, 0x0f, 0x9c, 0xcc, 0xcc, 0xac, 0xac, 0xac, 0x8f, 0xac, 0xac, 0xac,
+  0xc5, 0x7f, 0xac, 0x84, 0x9b, 0x02, 0x7c, 0xbc, 0xed, 0x75, 0xd6, 0xef,
+  0xe1, 0x05, 0x38, 0xe7, 0x67, 0x5d, 0x8d, 0x12, 0x05, 0x80, 0xd0, 0xb7,
+  0x5c, 0xc3, 0xb5, 0xd6, 0x35, 0x9e, 0x56, 0x97, 0x6b, 0x6b, 0x6b, 0x44,
+  0x64, 0x76, 0x4a, 0xac, 0xa6, 0x02, 0xc7, 0xc0, 0xc7, 0x37, 0x06, 0x3f,
+  0x94, 0x3e, 0x5e, 0xf1, 0xf4, 0xf4, 0xaa, 0x4e, 0x51, 0x21, 0x8f, 0xcf,
+  0x5d, 0x5c, 0xad, 0xe9, 0x63, 0xcf, 0xd2, 0x3a, 0xad, 0xed, 0x37, 0x52,
+  0x40, 0x60, 0x0f, 0xfb, 0xc3, 0x03, 0x62, 0xab, 0x00, 0x03, 0xbf, 0xe4,
+  0xe8, 0x03, 0xa4, 0x39, 0xfa, 0x51, 0xc2, 0x8d, 0x14, 0xe3, 0xa9, 0x03,
+  0xf0, 0x18, 0xc1, 0x00, 0x62, 0x17, 0x62, 0x89, 0xac, 0x1b, 0x4a, 0x28,
+  0x81, 0xcb, 0x79, 0x38, 0x38, 0x38, 0x79, 0xd8, 0x31, 0x4c, 0x32, 0xbd,
+  0xd2, 0x47, 0x1b, 0x16, 0x36, 0xcd, 0xd8, 0x9a, 0xac, 0x23, 0x4a, 0x33,
+  0xdc, 0x6f, 0xee, 0xd1, 0x78, 0x8c, 0x31, 0xa0, 0xeb, 0x55, 0x91, 0x67,
+  0x49, 0x60, 0xe6, 0x32, 0x80, 0x59, 0x96, 0x61, 0xf4, 0x49, 0x61, 0x4e,
+  0xfb, 0x92, 0x91, 0xac, 0xa4, 0x80, 0xc7, 0x17, 0xdd, 0x68, 0x3e, 0x93,
+  0x93, 0x93, 0x36, 0x4d, 0x42, 0x36, 0x45, 0xe4, 0x4d, 0x36, 0x42, 0x61,
+  0x47, 0x61, 0xb7, 0xb6, 0xe2, 0x7f, 0x1a, 0xa9, 0x64, 0x64, 0x38, 0x22,
+  0x25, 0x70, 0xe2, 0x80, 0x5d, 0xd4, 0x1e, 0x27, 0x28, 0x8a, 0x97, 0xa7,
+  0x35, 0xc4, 0xf3, 0xd2, 0xf0, 0x42, 0x79, 0x0e, 0x55, 0x9b, 0x7c, 0x21,
+  0xaa, 0xfc, 0x39, 0xba, 0x3f, 0x78, 0x60, 0xa6, 0x59, 0x47, 0x2d, 0x14,
+  0xd6, 0x0f, 0xb5, 0xe9, 0x35, 0xa3, 0x0e, 0x5a, 0x4e, 0x4d, 0xb3, 0x33,
+  0x9b, 0x2a, 0xdc, 0xd2, 0x23, 0xa6, 0x5c, 0x9d, 0xa2, 0x27, 0x32, 0x6f,
+  0x61, 0x69, 0xa6, 0x52, 0xd1, 0x46, 0xda, 0xc9, 0x1f, 0x32, 0xf8, 0x22,
+  0x33, 0xd9, 0x44, 0x18, 0x89, 0x9b, 0x2a, 0x65, 0xf9, 0x94, 0x3e, 0x53,
+  0xc8, 0x51, 0x68, 0x03, 0x36, 0x1f, 0x73, 0x98, 0xeb, 0xfe, 0x7d, 0x9f,
+  0x57, 0x7d, 0x3c, 0x85, 0xc0, 0x65, 0x18, 0xf9, 0x9c, 0xaa, 0xed, 0xe8,
+  0x0f, 0x70, 0x0d, 0x38, 0xfb, 0x75, 0xf3, 0x33, 0xfb, 0x75, 0x5c, 0xd3,
+  0x42, 0x4e, 0xec, 0xe5, 0xaf, 0x03, 0xef, 0x1d, 0x40, 0x58, 0x48, 0xa2,
+  0x95, 0x91, 0xac, 0x79, 0x89, 0xce, 0xcd, 0x34, 0x53, 0x34, 0x77, 0x24,
+  0x21, 0xea, 0x7f, 0x6f, 0x95, 0xca, 0x56, 0xe3, 0x5d, 0xac, 0xcd, 0xa9,
+  0x61, 0xc5, 0x40, 0x94, 0xc2, 0x66, 0xae, 0xa6, 0xb5, 0xe6, 0x97, 0xf6,
+  0x5b, 0xbb, 0x5f, 0xd9, 0x7a, 0xd4, 0x0c, 0x0c, 0x58, 0xe3, 0x47, 0xc8,
+  0x58, 0xf2, 0x2e, 0xf3, 0x2e, 0x9e, 0x06, 0xec, 0x6f, 0xb1, 0xcb, 0x7a,
+  0xb3, 0x62, 0x94, 0x3c, 0xf6, 0x92, 0xfb, 0x7b, 0x1a, 0x62, 0x15, 0xe4,
+  0x75, 0x9b, 0x20, 0x9d, 0x66, 0x2a, 0x98, 0x9f, 0xa8, 0x71, 0xbd, 0xf5,
+  0x6a, 0x0a, 0x30, 0x9e, 0x54, 0x1d, 0x0a, 0x8d, 0xf4, 0xec, 0x9a, 0x0f,
+  0x49, 0x35, 0x4d, 0x49, 0x8c, 0x87, 0x89, 0xf4, 0xc4, 0x71, 0xf1, 0x41,
+  0x41, 0x4c, 0x41, 0x7f, 0x34, 0x63, 0x72, 0x22, 0xc7, 0x89, 0xbb, 0x31,
+  0x9e, 0x66, 0xbe, 0x2b, 0x5a, 0x56, 0xeb, 0x50, 0x1d, 0x38, 0x35, 0x12,
+  0xbf, 0xe8, 0xc3, 0x47, 0xb6, 0xa0, 0xd9, 0x8f, 0x1b, 0x02, 0x10, 0x41,
+  0x5e, 0x43, 0x3b, 0x03, 0x48, 0x1f, 0x1f, 0xd6, 0xce, 0x29, 0xa0, 0x91,
+  0xdf, 0x84, 0x99, 0x84, 0x1f, 0x6d, 0xa3, 0xa8, 0x82, 0x26, 0x5a, 0x42,
+  0x43, 0x76, 0x8b, 0x9c, 0xd7, 0x55, 0xfe, 0xb4, 0xa7, 0x36, 0x09, 0x21,
+  0x67, 0x16, 0x7a, 0xf5, 0x66, 0xde, 0x7f, 0x03, 0xa6, 0xa9, 0xa2, 0xa5,
+  0x2b, 0x3e, 0xd5, 0x55, 0xc4, 0x93, 0xe9, 0xc6, 0xd9, 0x85, 0x51, 0x37,
+  0x1d, 0x1a, 0x38, 0x64, 0x90, 0x68, 0x70, 0xdf, 0x65, 0x2a, 0x45, 0x8e,
+  0x8c, 0xb0, 0xf2, 0x06, 0xf0, 0x06, 0x99, 0x9a, 0x64, 0xe8, 0x34, 0xc7,
+  0x5f, 0x05, 0x35, 0x41, 0x10, 0x76, 0xa1, 0x78, 0xef, 0x93, 0x9a, 0xdd,
+  0xb4, 0x97, 0x8b, 0x96, 0x70, 0xde, 0x8f, 0xce, 0xe2, 0xc4, 0x6d, 0xf5,
+  0x53, 0x21, 0x61, 0x51, 0x64, 0x3c, 0xf1, 0x26, 0x32, 0x2a, 0xe8, 0x86,
+  0x3a, 0x3e, 0x68, 0x15, 0xb3, 0xbb, 0xed, 0x18, 0xa6, 0x1a, 0x81, 0xc9,
+  0x59, 0x80, 0xce, 0x76, 0xdd, 0x94, 0x41, 0x49, 0xf1, 0x19, 0x09, 0x84,
+  0xb0, 0x12, 0x37, 0xdc, 0xac, 0xc7, 0x69, 0x2d, 0x4c, 0x4b, 0x89, 0x9b,
+  0x33, 0x2f, 0xaa, 0x7e, 0xa7, 0x47, 0x70, 0xda, 0x6c, 0x49, 0x49, 0xcc,
+  0x47, 0xcc, 0x65, 0xfb, 0x96, 0xb5, 0x48, 0xda, 0xab, 0x99, 0xf1, 0x0b,
+  0xd3, 0x4b, 0xd4, 0xd4, 0x87, 0x0e, 0xa8, 0xfc, 0xb4, 0x5a, 0x70, 0x8f,
+  0x9a, 0x66, 0x08, 0xb6, 0x64, 0x1e, 0x29, 0xca, 0x81, 0x34, 0xf6, 0x76,
+  0x9a, 0x5c, 0x78, 0xcc, 0x79, 0xdc, 0x0c, 0x41, 0xe5, 0x0e, 0xce, 0xe7,
+  0x7b, 0x6f, 0xc7, 0xc7, 0x6f, 0xc7, 0x2f, 0x02, 0xfe, 0xaa, 0x3a, 0x85,
+  0xc3, 0x2d, 0xd8, 0xd9, 0x05, 0x21, 0xdd, 0x5f, 0xbd, 0x79, 0x0f, 0x95,
+  0xba, 0x20, 0xa9, 0xce, 0xd1, 0xeb, 0x9e, 0x1c, 0x48, 0xc5, 0x48, 0xa8,
+  0x25, 0x48, 0xcb, 0xb3, 0xef, 0xe2, 0x0b, 0x42, 0xb5, 0xf4, 0xc0, 0x10,
+  0x38, 0x38, 0x94, 0x0e, 0x91, 0x3b, 0x07, 0x3e, 0x0f, 0xa9, 0x95, 0xa8,
+  0xaf, 0x25, 0x78, 0x29, 0x89, 0xc0, 0x3b, 0x5f, 0x01, 0xff, 0x3b, 0x45,
+  0x1c, 0x0d, 0x3a, 0xc4, 0x0d, 0xcf, 0x4f, 0x08, 0xa5, 0xd0, 0x5a, 0xf9,
+  0xcc, 0x7f, 0x6a, 0x89, 0x39, 0x54, 0xc7, 0x69, 0x2f, 0x37, 0x8c, 0xfe,
+  0x1f, 0xca, 0xe6, 0x6b, 0xf7, 0xbb, 0xb4, 0xbc, 0x07, 0x9e, 0xaa, 0x10,
+  0x31, 0xfa, 0x4a, 0xc4, 0x4a, 0x35, 0x2d, 0xf8, 0xad, 0xa3, 0x0a, 0xd0,
+  0x57, 0x2e, 0x08, 0x38, 0x09, 0x38, 0xa3, 0x5d, 0xbd, 0x93, 0xf0, 0x87,
+  0x3d, 0xd7, 0x95, 0xb2, 0x97, 0x79, 0xc4, 0x17, 0x1d, 0xd6, 0x17, 0x1b,
+  0x44, 0xe5, 0xda, 0xf6, 0xe5, 0x17, 0xc4, 0x44, 0x20, 0x80, 0x30, 0xac,
+  0x26, 0x74, 0xf7, 0x7a, 0x18, 0xd0, 0xba, 0xf3, 0x73, 0x10, 0xb0, 0xb2,
+  0xb1, 0x89, 0x63, 0x4b, 0x5b, 0x1d, 0x83, 0x1f, 0x01, 0x45, 0x50, 0x27,
+  0xb3, 0xb3, 0xbd, 0xb3, 0x92, 0xa0, 0x90, 0x65, 0x47, 0x43, 0x16, 0xad,
+  0x05, 0xe9, 0x32, 0x1e, 0x22, 0xd5, 0xe5, 0x3f, 0x73, 0x51, 0xf3, 0x58,
+  0x70, 0xe6, 0x3f, 0xe4, 0x05, 0xb4, 0x86, 0x64, 0xf0, 0xd2, 0x62, 0xda,
+  0x03, 0x91, 0x03, 0x32, 0xe1, 0x77, 0xc0, 0xf7, 0x44, 0x40, 0x03, 0xd1,
+  0x64, 0x04, 0x94, 0x94, 0x94, 0x11, 0x94, 0x99, 0x8b, 0xff, 0xa3, 0x25,
+  0xf7, 0xaa, 0x31, 0x31, 0x31, 0x31, 0x31, 0xb7, 0xaf, 0x58, 0x69, 0x61,
+  0x62, 0xb4, 0x66, 0xd0, 0x38, 0x7e, 0x9a, 0xfd, 0xa7, 0xc7, 0x8b, 0x60,
+  0x81, 0xd2, 0x9e, 0xc2, 0x42, 0x73, 0xa2, 0x54, 0x45, 0x81, 0x36, 0x72,
+  0xff, 0xd2, 0x10, 0x39, 0x70, 0xc2, 0x7f, 0x7f, 0xd6, 0xb2, 0xb0, 0x01,
+  0xd4, 0xaf, 0xbf, 0x4e, 0xda, 0x6a, 0x24, 0xf3, 0x4b, 0x1a, 0x01, 0xa8,
+  0x0c, 0x11, 0xfc, 0x63, 0xd9, 0xc3, 0x5c, 0xd1, 0x2a, 0xbf, 0x2d, 0x3d,
+  0x3d, 0x24, 0xbb, 0xc7, 0xcb, 0x41, 0xb4, 0x2a, 0xbb, 0xae, 0x7f, 0x40,
+  0x35, 0xbc, 0xb9, 0x7a, 0x1d, 0xae, 0xf6, 0xc3, 0x82, 0xc9, 0xe5, 0xa4,
+  0x63, 0x5d, 0xc5, 0x2b, 0x82, 0xa7, 0xf7, 0xeb, 0xac, 0xc0, 0x66, 0x54,
+  0xfa, 0x64, 0x4f, 0xe9, 0x3c, 0x3c, 0x3c, 0xca, 0x56, 0x35, 0x56, 0xf3,
+  0x46, 0xd9, 0x7a, 0xda, 0x30, 0x14, 0x19, 0xe9, 0x37, 0x25, 0xe5, 0x8f,
+  0xd9, 0x27, 0x45, 0xc8, 0x13, 0x8e, 0xfa, 0x9a, 0x9b, 0x9b, 0x9b, 0x1a,
+  0x6d, 0x9b, 0x86, 0x24, 0x2f, 0x4a, 0x0c, 0xa0, 0xf4, 0x49, 0x9d, 0x78,
+  0x3a, 0xbd, 0xce, 0xd9, 0x37, 0xc9, 0x2f, 0x41, 0x72, 0xaa, 0x80, 0x38,
+  0xfc, 0x6c, 0xe4, 0x3f, 0x3b, 0xe8, 0x12, 0x82, 0xd4, 0xee, 0x8a, 0x4e,
+  0xea, 0x68, 0x46, 0x84, 0x15, 0x1f, 0x15, 0x01, 0x41, 0x0c, 0x28, 0x14,
+  0x2b, 0x62, 0xd5, 0x7a, 0x97, 0xbf, 0xb3, 0xe2, 0x9f, 0x46, 0x86, 0xb0,
+  0x8d, 0xe5, 0x28, 0x22, 0x4c, 0xb7, 0xf4, 0xad, 0x82, 0xd7, 0xb3, 0x14,
+  0x21, 0x26, 0xa5, 0xb3, 0x82, 0x14, 0x55, 0x41, 0x44, 0xbb, 0xed, 0xe6,
+  0x63, 0xb8, 0xf0, 0xe3, 0xb0, 0xd7, 0x60, 0xe3, 0x96, 0xd9, 0xd0, 0x57,
+  0xb6, 0x57, 0x42, 0xd9, 0x4c, 0x76, 0x5a, 0xfb, 0x25, 0x0a, 0x21, 0xb0,
+  0x2c, 0x2b, 0x40, 0xd2, 0x68, 0xd6, 0x89, 0xd5, 0x44, 0xd6, 0x18, 0x11,
+  0x91, 0x74, 0xef, 0x76, 0x2f, 0x31, 0x44, 0x3d, 0x31, 0x31, 0x31, 0x31,
+  0xe1, 0xe1, 0x06, 0xcd, 0x1f, 0xc8, 0xbd, 0xaf, 0xff, 0x03, 0x13, 0xe7,
+  0xb7, 0x1d, 0x33, 0x04, 0xf8, 0x89, 0x71, 0xb0, 0xc2, 0x97, 0x1d, 0x10,
+  0x05, 0x74, 0x56, 0xcd, 0x3a, 0x02, 0x8f, 0x6d, 0x60, 0x7b, 0xa5, 0x63,
+  0xec, 0xe6, 0x4c, 0xa9, 0xed, 0x4b, 0x5c, 0x5b, 0x85, 0xc5, 0x5b, 0x5d,
+  0x15, 0x95, 0x41, 0xdc, 0xdd, 0x62, 0x8d, 0x0a, 0xce, 0x13, 0x51, 0xc6,
+  0xcf, 0x31, 0x70, 0x54, 0xe0, 0xd9, 0x31, 0xbc, 0x24, 0xef, 0x87, 0xb3,
+  0x12, 0x5d, 0xeb, 0xf3, 0x70, 0xa8, 0x82, 0x8f, 0xa1, 0xe2, 0x0a, 0x98,
+  0x17, 0x08, 0x86, 0x24, 0x9b, 0x9b, 0xd6, 0x24, 0xfe, 0xb5, 0x1c, 0x9b,
+  0x61, 0xf0, 0xd8, 0x8a, 0x0d, 0x8f, 0x5b, 0x3e, 0x96, 0xeb, 0x20, 0x11,
+  0x5f, 0x74, 0x3f, 0xe4, 0x39, 0xa0, 0xdc, 0x81, 0x81, 0xf7, 0x9a, 0xf2,
+  0xe9, 0x2a, 0xe7, 0x38, 0xdc, 0x31, 0xab, 0x4a, 0x3c, 0xbe, 0x70, 0xc0,
+  0xc5, 0xed, 0x70, 0xb6, 0xb9, 0xb9, 0xb9, 0xb9, 0xb4, 0xb4, 0xc8, 0xb9,
+  0x77, 0x6b, 0xe3, 0x46, 0xee, 0x75, 0x9a, 0x54, 0x6b, 0x4b, 0x74, 0x83,
+  0x36, 0xf8, 0x17, 0xc1, 0x81, 0xb8, 0xf8, 0x01, 0xc9, 0x81, 0xec, 0x01,
+  0x91, 0x13, 0xd1, 0xb4, 0x45, 0xcb, 0x12, 0xad, 0x92, 0x93, 0x60, 0x42,
+  0x5b, 0xc4, 0x06, 0xb9, 0xe5, 0x5b, 0x6d, 0x3f, 0x56, 0x56, 0x7f, 0x92,
+  0x70, 0x5d, 0x1f, 0x89, 0xbe, 0xaf, 0xc2, 0x38, 0x5a, 0xe0, 0xf4, 0x94,
+  0x8d, 0x16, 0x09, 0x0f, 0xb9, 0x26, 0xe0, 0x46, 0x46, 0xfe, 0x23, 0x94,
+  0xe9, 0xe9, 0xbf, 0xe9, 0x36, 0x62, 0x55, 0xae, 0xc4, 0x4c, 0xe0, 0x02,
+  0x39, 0x0c, 0x65, 0x60, 0x56, 0xc8, 0x60, 0x80, 0x96, 0xcd, 0xc0, 0x34,
+  0xb8, 0xac, 0x9d, 0x3a, 0xd7, 0xe9, 0x52, 0x95, 0x72, 0xdd, 0x61, 0x56,
+  0xb0, 0x76, 0x63, 0x7d, 0x87, 0x14, 0x2a, 0x9c, 0x8c, 0x01, 0x2a, 0x1b,
+  0xf1, 0x7e, 0x3f, 0xe7, 0xb9, 0x0c, 0x0e, 0x7f, 0x1f, 0xfb, 0x18, 0xf4,
+  0x19, 0xa0, 0x53, 0xcd, 0x4d, 0x70, 0xab, 0x31, 0x2a, 0xbd, 0x39, 0x25,
+  0xf6, 0x94, 0x8f, 0x72, 0xc6, 0x28, 0x0e, 0xba, 0x9a, 0x71, 0xd9, 0x6d,
+  0xde, 0xbf, 0xa9, 0x00, 0x7d, 0x3c, 0xd7, 0x1f, 0xc5, 0x46, 0x61, 0x61,
+  0x61, 0x41, 0x23, 0xd8, 0xdc, 0x00, 0x14, 0xb3, 0xfd, 0x1d, 0x8a, 0xa0,
+  0x28, 0x25, 0x21, 0x54, 0xd7, 0x1c, 0x83, 0xb6, 0x6a, 0x8d, 0x13, 0xba,
+  0xa8, 0x73, 0xfc, 0xc4, 0xa8, 0x2f, 0x31, 0x8f, 0xcc, 0xed, 0x31, 0x07,
+  0x7e, 0xcc, 0x17, 0x07, 0x72, 0x38, 0x70, 0x36, 0x8d, 0x4f, 0xfe, 0xee,
+  0x6e, 0x5a, 0x0e, 0x14, 0x0e, 0x78, 0xff, 0xa9, 0x1f, 0x79, 0x27, 0x95,
+  0xcb, 0x3f, 0x6b, 0xa5, 0x25, 0x45, 0xa4, 0xc6, 0x19, 0xc4, 0x38, 0x14,
+  0x52, 0xec, 0x23, 0xbf, 0xf7, 0x4b, 0x11, 0xec, 0x11, 0xec, 0x96, 0xc5,
+  0xdd, 0xbe, 0xb6, 0x96, 0xec, 0x80, 0x3c, 0x3c, 0x66, 0xce, 0xca, 0x21,
+  0xca, 0x08, 0xf0, 0xbf, 0xae, 0x7b, 0xb7, 0x1c, 0xc2, 0x03, 0x51, 0x26,
+  0xc9, 0xab, 0x8b, 0x83, 0xae, 0x3c, 0x30, 0x03, 0x2a, 0xc7, 0x6d, 0x8e,
+  0x01, 0xb3, 0x05, 0x31, 0xa8, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b,
+  0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0xd5, 0x4b, 0x4b,
+  0x4b, 0x4b, 0x27, 0x77, 0x8d, 0x9b, 0x6b, 0xbe, 0xca, 0x2c, 0xac, 0x6c,
+  0x31, 0xfa, 0xb7, 0xfb, 0x37, 0x34, 0x0e, 0x0e, 0x07, 0xf5, 0xeb, 0xeb,
+  0x05, 0xf3, 0x2e, 0x7f, 0x57, 0xca, 0x65, 0xdf, 0xd1, 0x49, 0x49, 0x49,
+  0xc1, 0x61, 0x5c, 0x0c, 0x86, 0xc5, 0xf0, 0x6e, 0x24, 0xf3, 0xdf, 0xfd,
+  0x53, 0x4f, 0x01, 0xf1, 0x1f, 0xe9, 0x30, 0x8d, 0x23, 0x28, 0xf2, 0x2c,
+  0x8a, 0x6c, 0xb2, 0xe7, 0x69, 0x20, 0x50, 0x92, 0xe8, 0x8d, 0xe8, 0x7f,
+  0xf3, 0x8d, 0x72, 0xef, 0x88, 0xc3, 0xbe, 0x6e, 0x87, 0xf3, 0x67, 0x1d,
+  0x35, 0x76, 0xe4, 0x24, 0x50, 0x90, 0x16, 0x14, 0x14, 0x54, 0xaa, 0x14,
+  0x4d, 0x5e, 0xda, 0x31, 0xdb, 0x89, 0xe4, 0xb0, 0xa4, 0xa1, 0x43, 0xae,
+  0x70, 0x17, 0x12, 0x82, 0x64, 0x7b, 0x54, 0x54, 0x2a, 0x06, 0x7f, 0x92,
+  0x36, 0x17, 0x41, 0x1f, 0x5f, 0xbe, 0x0d, 0x6d, 0x0d, 0x8e, 0x25, 0x2f,
+  0xbd, 0x14, 0xde, 0x65, 0xfc, 0x65, 0x34, 0xd3, 0xd5, 0xd5, 0xd5, 0xd5,
+  0xd5, 0x79, 0xd5, 0x11, 0xd5, 0xef, 0xae, 0x85, 0x81, 0x81, 0x65, 0x63,
+  0xff, 0xcc, 0x55, 0x47, 0x50, 0xa2, 0x8e, 0x5e, 0x6e, 0x59, 0x4c, 0xe0,
+  0xd0, 0xe6, 0x32, 0xf5, 0xea, 0xe9, 0xf8, 0x7a, 0x66, 0xb9, 0x51, 0x4f,
+  0x91, 0x75, 0xe3, 0x49, 0x0c, 0xfb, 0xc7, 0x0f, 0xce, 0x59, 0x74, 0x97,
+  0xbe, 0x9e, 0x4e, 0x14, 0x99, 0xe2, 0x39, 0x16, 0x2f, 0xf2, 0x54, 0x85,
+  0x8b, 0xab, 0x14, 0x8d, 0x87, 0xcc, 0xd9, 0xe7, 0xff, 0x45, 0x45, 0x56,
+  0x29, 0x74, 0x72, 0x52, 0xf0, 0x66, 0x60, 0x6a, 0xd0, 0xb3, 0x89, 0x44,
+  0x13, 0x40, 0xd1, 0x7e, 0x68, 0x0b, 0x2b, 0x91, 0xd7, 0xef, 0xb3, 0xe0,
+  0x98, 0x23, 0x98, 0xb9, 0x2a, 0x5c, 0x7d, 0x05, 0x89, 0xbb, 0x15, 0x96,
+  0x6f, 0x76, 0xf0, 0x47, 0x00, 0x4d, 0x02, 0x24, 0x1c, 0x21, 0x7f, 0x7b,
+  0x24, 0x7b, 0xde, 0x43, 0x76, 0x9a, 0x65, 0x51, 0x76, 0x8e, 0x8c, 0x9d,
+  0x6c, 0x0b, 0x09, 0xab, 0xac, 0x7d, 0x1e, 0xe9, 0xfd, 0xaa, 0x88, 0x88,
+  0xdd, 0xa1, 0x8c, 0x4d, 0x07, 0xbc, 0x83, 0xc7, 0x4c, 0x2b, 0x3c, 0xda,
+  0xd3, 0x80, 0x5c, 0xd3, 0x11, 0x4f, 0xde, 0xf7, 0xb5, 0x0a, 0xbd, 0x22,
+  0x36, 0x22, 0xc8, 0x3f, 0x70, 0x1f, 0x3b, 0xb7, 0x8e, 0xfa, 0x56, 0x74,
+  0x1a, 0x41, 0xeb, 0x30, 0xab, 0xe3, 0xde, 0xea, 0x12, 0x80, 0x72, 0xd6,
+  0x79, 0x7e, 0xa7, 0x16, 0x9d, 0x42, 0x18, 0x3f, 0x4e, 0x1a, 0x04, 0x55,
+  0xe8, 0x52, 0xe9, 0xc9, 0x35, 0xe0, 0xae, 0x4e, 0xa6, 0x7b, 0xb1, 0xfc,
+  0x21, 0xe2, 0x43, 0x5e, 0xa4, 0xa1, 0xdf, 0x32, 0x11, 0x32, 0x32, 0xae,
+  0x19, 0x32, 0x3e, 0xb5, 0xcf, 0x41, 0x2d, 0x90, 0xf5, 0xa7, 0x29, 0xf6,
+  0x1b, 0x8c, 0x7d, 0x39, 0x98, 0x61, 0x43, 0x6a, 0x04, 0xf8, 0x46, 0x8e,
+  0x88, 0x24, 0x82, 0x19, 0xa4, 0xa1, 0x3d, 0x30, 0x0a, 0xa3, 0x9c, 0xfa,
+  0x11, 0x76, 0x8e, 0xff, 0x38, 0x9c, 0xf5, 0x1c, 0x62, 0xe8, 0x20, 0x40,
+  0xfc, 0x41, 0x6c, 0x2f, 0x6f, 0x43, 0xb3, 0xec, 0x52, 0x6a, 0xfd, 0x92,
+  0xc3, 0xe2, 0x37, 0x01, 0x97, 0x66, 0xa9, 0x91, 0xdf, 0x4e, 0x0b, 0xbb,
+  0xc7, 0xe6, 0xbe, 0xca, 0xf9, 0xb2, 0xd4, 0xf9, 0x56, 0x35, 0xe2, 0x94,
+  0x50, 0xb2, 0x50, 0x72, 0x5a, 0x32, 0xa8, 0xc7, 0x2e, 0x64, 0x64, 0x01,
+  0xbf, 0x28, 0x86, 0x12, 0x75, 0x6d, 0x35, 0xc0, 0x48, 0x7e, 0xcc, 0xac,
+  0xd5, 0x2d, 0x53, 0x00, 0xa0, 0x52, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0xf7,
+  0x4a, 0x9d, 0x9d, 0x4a, 0xe2, 0x96, 0x9d, 0x7a, 0x4a, 0x37, 0xaa, 0xf0,
+  0x17, 0x95, 0xcb, 0xf9, 0x0f, 0xb5, 0x5f, 0x56, 0xdc, 0xfc, 0x23, 0x6f,
+  0xa4, 0x03, 0xdd, 0xef, 0xdd, 0x17, 0x1a, 0x63, 0x3d, 0xdd, 0x9b, 0xa8,
+  0x0f, 0x66, 0xc3, 0x4e, 0xb9, 0x4b, 0x04, 0x1f, 0x1d, 0x24, 0x72, 0x5d,
+  0xc8, 0x3b, 0xba, 0x71, 0x36, 0x6c, 0x8d, 0x5d, 0xec, 0x55, 0x66, 0x54,
+  0x08, 0xfb, 0xe3, 0x72, 0x78, 0x78, 0x5b, 0xe9, 0xb5, 0xe9, 0xf3, 0xc7,
+  0xca, 0x56, 0xca, 0xc4, 0xfe, 0x69, 0x64, 0xfb, 0x9a, 0x51, 0x48, 0x6a,
+  0x19, 0x71, 0x29, 0xde, 0xde, 0xa9, 0xde, 0xa4, 0x17, 0xde, 0xbf, 0x54,
+  0x98, 0xe5, 0xec, 0x25, 0xbe, 0xcb, 0x74, 0xe6, 0x98, 0x46, 0xe1, 0xad,
+  0xd7, 0x03, 0xdc, 0x68, 0x08, 0xd7, 0x9b, 0x23, 0x38, 0x14, 0xdd, 0x7a,
+  0xe9, 0xe4, 0x69, 0xec, 0x83, 0x21, 0x8a, 0xae, 0x2f, 0x16, 0x2f, 0x4b,
+  0x1e, 0x39, 0x1c, 0x65, 0x72, 0x7f, 0x1b, 0x8b, 0x1e, 0xec, 0xcc, 0xa8,
+  0x66, 0x2d, 0x0c, 0x38, 0xf0, 0x9d, 0x48, 0x43, 0xbd, 0x6b, 0x49, 0x60,
+  0x93, 0x1f, 0xe7, 0x9d, 0xeb, 0x16, 0x16, 0x16, 0x67, 0x87, 0x16, 0x16,
+  0x5e, 0xfd, 0x23, 0x3d, 0x2f, 0x00, 0x4a, 0xd0, 0xaa, 0x0f, 0x35, 0x23,
+  0xbf, 0x40, 0x36, 0xb1, 0x2f, 0xb1, 0x55, 0x5b, 0xe0, 0xe5, 0x5b, 0xe5,
+  0x3f, 0x49, 0xc0, 0xfe, 0x9e, 0xf4, 0x9e, 0x7f, 0xec, 0x38, 0x52, 0xfa,
+  0xf1, 0xa3, 0xc9, 0x0b, 0x95, 0x79, 0x82, 0x08, 0xcb, 0xb6, 0x51, 0x4c,
+  0xc7, 0xfb, 0xb6, 0x33, 0x21, 0x3c, 0x66, 0x9c, 0xb0, 0x74, 0x53, 0x6b,
+  0xce, 0xe2, 0xeb, 0x34, 0x9f, 0xc6, 0x9a, 0xc4, 0x04, 0x5f, 0x57, 0x52,
+  0x2e, 0x1a, 0x40, 0x1a, 0xd1, 0xee, 0x2e, 0x56, 0x18, 0x35, 0x05, 0x0d,
+  0x8d, 0x8d, 0x9e, 0x57, 0x02, 0xae, 0x17, 0x0c, 0xd5, 0x94, 0xcd, 0x77,
+  0xbf, 0x69, 0xd5, 0x4b, 0x26, 0xb6, 0x4e, 0x4e, 0x28, 0x79, 0x23, 0x84,
+  0x2c, 0xd2, 0x16, 0xf2, 0xb0, 0x1d, 0x81, 0xb1, 0xf9, 0x21, 0x16, 0x2e,
+  0x3f, 0x25, 0xb2, 0x76, 0xd5, 0xf4, 0x72, 0xd7, 0x47, 0xbc, 0xfd, 0x9b,
+  0xa8, 0xa2, 0xc9, 0xd5, 0x69, 0xd2, 0xb5, 0xd3, 0x8b, 0x01, 0x01, 0x92,
+  0x77, 0xe6, 0xf3, 0x45, 0xcb, 0x3e, 0x14, 0x4f, 0x45, 0x3e, 0x79, 0x79,
+  0x79, 0x66, 0xc6, 0x79, 0x5b, 0x20, 0x8b, 0x7c, 0xc3, 0xa3, 0x33, 0xf0,
+  0xa3, 0x23, 0x41, 0xa3, 0x8e, 0x7e, 0x95, 0xdb, 0x68, 0x6f, 0x02, 0xda,
+  0x75, 0x7c, 0x8e, 0xff, 0xff, 0xd8, 0xd8, 0x71, 0x30, 0xfc, 0xd9, 0x61,
+  0x9a, 0x4f, 0x88, 0x06, 0x85, 0x2b, 0x7c, 0x56, 0x1b, 0xd3, 0x1a, 0xba,
+  0x0b, 0x2a, 0x0b, 0x4e, 0xd4, 0xc1, 0x02, 0xdb, 0xb5, 0x90, 0x65, 0x4d,
+  0xbc, 0xe2, 0x8d, 0x72, 0xd5, 0x6d, 0xb8, 0x8f, 0xae, 0x23, 0x70, 0x26,
+  0xc9, 0xec, 0x57, 0xe1, 0x22, 0xbf, 0xc0, 0x11, 0x24, 0xd5, 0xf8, 0x3b,
+  0x2d, 0x2c, 0x44, 0x22, 0x9f, 0xac, 0x98, 0xfd, 0xac, 0x26, 0x0c, 0xcd,
+  0x2c, 0x2c, 0x4d, 0x97, 0xfc, 0xfb, 0xe7, 0xe4, 0xed, 0xc4, 0x02, 0xb3,
+  0x29, 0xa5, 0x58, 0xda, 0x2c, 0x59, 0x94, 0xf8, 0x6d, 0xb5, 0x01, 0x0d,
+  0x7a, 0x04, 0xe1, 0x20, 0x8d, 0xa0, 0x22, 0x49, 0x3c, 0xf3, 0x45, 0x5c,
+  0x31, 0x05, 0xb3, 0xbe, 0x49, 0x1b, 0x0b, 0x3c, 0x60, 0x68, 0x22, 0x74,
+  0x7e, 0xd1, 0x4f, 0xbc, 0xdc, 0x8e, 0x79, 0xe4, 0x3c, 0x28, 0x4e, 0x03,
+  0x2f, 0x2e, 0xa8, 0xe1, 0x9e, 0xf1, 0x5b, 0x40, 0x8e, 0x69, 0xf5, 0xc5,
+  0xe7, 0x09, 0xe7, 0x99, 0xe7, 0xc6, 0xe7, 0xce, 0xb0, 0x03, 0x73, 0x5a,
+  0x3e, 0xa5, 0x16, 0x21, 0x49, 0xe4, 0x72, 0x83, 0x16, 0x40, 0x12, 0x47,
+  0xb3, 0x79, 0xbe, 0x21, 0xfd, 0x6b, 0xa6, 0x34, 0xef, 0x22, 0xd1, 0xba,
+  0xdb, 0x90, 0xed, 0x30, 0xcb, 0xab, 0xe7, 0xe2, 0xef, 0xf4, 0x3f, 0x5a,
+  0x6e, 0x84, 0x1e, 0xf9, 0x0e, 0x48, 0x00, 0x00, 0x0b, 0x00, 0x13, 0x00,
+  0x1b, 0x00, 0x23, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x84, 0x00, 0xc6, 0x00,
+  0xd0, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x7b, 0x00, 0xbe, 0x00, 0x02, 0x01,
+  0x42, 0x01, 0x83, 0x01, 0xbe, 0x01, 0xc6, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x16, 0x00, 0x30, 0x00, 0x4d, 0x00, 0x67, 0x00, 0x80, 0x00,
+  0x9b, 0x00, 0xb0, 0x00, 0xc0, 0x00, 0xcc, 0x00, 0xea, 0x00, 0x08, 0x01,
+  0x1e, 0x01, 0x37, 0x01, 0x54, 0x01, 0x70, 0x01, 0x8a, 0x01, 0xad, 0x01,
+  0xc6, 0x01, 0xe2, 0x01, 0xf9, 0x01, 0x15, 0x02, 0x2b, 0x02, 0x43, 0x02,
+  0x5b, 0x02, 0x6c, 0x02, 0x82, 0x02, 0xaa, 0x02, 0xc2, 0x02, 0xdd, 0x02,
+  0xf7, 0x02, 0x11, 0x03, 0x27, 0x03, 0x3f, 0x03, 0x57, 0x03, 0x7e, 0x03,
+  0xa7, 0x03, 0xc7, 0x03, 0xe6, 0x03, 0x02, 0x04, 0x1f, 0x04, 0x39, 0x04,
+  0x63, 0x04, 0x7a, 0x04, 0x96, 0x04, 0xb5, 0x04, 0xd0, 0x04, 0xd9, 0x04,
+  0xfd, 0x04, 0x14, 0x05, 0x26, 0x05, 0x42, 0x05, 0x53, 0x05, 0x69, 0x05,
+  0x82, 0x05, 0x95, 0x05, 0xb3, 0x05, 0xd3, 0x05, 0xeb, 0x05, 0x05, 0x06,
+  0x26, 0x06, 0x44, 0x06, 0x60, 0x06, 0x7e, 0x06, 0x99, 0x06, 0xbd, 0x06,
+  0xdc, 0x06, 0xf1, 0x06, 0x0b, 0x07, 0x27, 0x07, 0x3d, 0x07, 0x52, 0x07,
+  0x66, 0x07, 0x7c, 0x07, 0x98, 0x07, 0xaf, 0x07, 0xc7, 0x07, 0xe1, 0x07,
+  0xfe, 0x07, 0x18, 0x08, 0x35, 0x08, 0x56, 0x08, 0x75, 0x08, 0x91, 0x08,
+  0xae, 0x08, 0xcc, 0x08, 0xe1, 0x08, 0x0c, 0x09, 0x23, 0x09, 0x52, 0x09,
+  0x69, 0x09, 0x80, 0x09, 0x9a, 0x09, 0xb6, 0x09, 0xe7, 0x09, 0x05, 0x0a,
+  0x29, 0x0a, 0x49, 0x0a, 0x65, 0x0a, 0x81, 0x0a, 0xa6, 0x0a, 0xbe, 0x0a,
+  0x0c, 0x0b, 0x20, 0x0b, 0x3a, 0x0b, 0x54, 0x0b, 0x77, 0x0b, 0x8c, 0x0b,
+  0xa6, 0x0b, 0xbf, 0x0b, 0xe1, 0x0b, 0xfb, 0x0b, 0x18, 0x0c, 0x28, 0x0c,
+  0x4a, 0x0c, 0x6d, 0x0c, 0x7f, 0x0c, 0xa0, 0x0c, 0xc9, 0x0c, 0xed, 0x0c,
+  0x09, 0x0d, 0x23, 0x0d, 0x41, 0x0d, 0x58, 0x0d, 0x6c, 0x0d, 0x87, 0x0d,
+  0xa4, 0x0d, 0xcc, 0x0d, 0xea, 0x0d, 0x06, 0x0e, 0x1b, 0x0e, 0x33, 0x0e,
+  0x55, 0x0e, 0x7b, 0x0e, 0x9b, 0x0e, 0xbb, 0x0e, 0xda, 0x0e, 0xee, 0x0e,
+  0x03, 0x0f, 0x22, 0x0f, 0x48, 0x0f, 0x6a, 0x0f, 0x81, 0x0f, 0x9c, 0x0f,
+  0xbf, 0x0f, 0xd6, 0x0f, 0xea, 0x0f, 0xff, 0x0f, 0x14, 0x10, 0x32, 0x10,
+  0x3e, 0x10, 0x46, 0x10, 0x4b, 0x10, 0x61, 0x10, 0x00, 0x00, 0x07, 0x00,
+  0x1f, 0x00, 0x3b, 0x00, 0x42, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x24, 0x00,
+  0x2d, 0x00, 0x33, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0e, 0x00, 0x16, 0x00,
+  0x1e, 0x00, 0x45, 0x00, 0x4d, 0x00, 0x00, 0x00, 0x09, 0x00, 0x10, 0x00,
+  0x1a, 0x00, 0x23, 0x00, 0x2c, 0x00, 0x35, 0x00, 0x58, 0x00, 0x61, 0x00,
+  0x6a, 0x00, 0x73, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x59, 0x00,
+  0x71, 0x00, 0x00, 0x00, 0x18, 0x00, 0x22, 0x00, 0x2c, 0x00, 0x38, 0x00,
+  0x00, 0x00, 0x06, 0x00, 0x0f, 0x00, 0x15, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x00, 0x00, 0x08, 0x00, 0x0f, 0x00, 0x17, 0x00, 0x27, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x38, 0x00, 0x41, 0x00, 0x00, 0x00, 0x06, 0x00, 0x24, 0x00,
+  0x46, 0x00, 0x6c, 0x00, 0x78, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x17, 0x00, 0x21, 0x00, 0x00, 0x00, 0x08, 0x00, 0x11, 0x00,
+  0x1a, 0x00, 0x23, 0x00, 0x29, 0x00, 0x00, 0x00, 0x08, 0x00, 0x11, 0x00,
+  0x32, 0x00, 0x3e, 0x00, 0x46, 0x00, 0x4e, 0x00, 0x57, 0x00, 0x60, 0x00,
+  0x69, 0x00, 0x6d, 0x00, 0x71, 0x00, 0x00, 0x00, 0x09, 0x00, 0x13, 0x00,
+  0x1e, 0x00, 0x49, 0x00, 0x4f, 0x00, 0x73, 0x00, 0x7e, 0x00, 0x89, 0x00,
+  0x92, 0x00, 0x9b, 0x00, 0xa4, 0x00, 0xac, 0x00, 0x00, 0x00, 0x07, 0x00,
+  0x00, 0x00, 0x19, 0x00, 0x34, 0x00, 0x5b, 0x00, 0x64, 0x00, 0x6c, 0x00,
+  0x75, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x07, 0x00, 0x25, 0x00, 0x47, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x13, 0x00, 0x1c, 0x00, 0x28, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x30, 0x00, 0x5c, 0x00, 0x63, 0x00, 0x6a, 0x00, 0x00, 0x00,
+  0x31, 0x00, 0x37, 0x00, 0x66, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x17, 0x00, 0x22, 0x00, 0x2e, 0x00, 0x35, 0x00, 0x41, 0x00, 0x00, 0x00,
+  0x1f, 0x00, 0x29, 0x00, 0x32, 0x00, 0x00, 0x00, 0x06, 0x00, 0x23, 0x00,
+  0x45, 0x00, 0x4b, 0x00, 0x51, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x22, 0x00,
+  0x2c, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x18, 0x00, 0x20, 0x00, 0x28, 0x00,
+  0x00, 0x00, 0x11, 0x00, 0x1a, 0x00, 0x24, 0x00, 0x2d, 0x00, 0x36, 0x00,
+  0x00, 0x00, 0x35, 0x00, 0x3f, 0x00, 0x46, 0x00, 0x4e, 0x00, 0x00, 0x00,
+  0x18, 0x00, 0x24, 0x00, 0x2e, 0x00, 0x37, 0x00, 0x40, 0x00, 0x49, 0x00,
+  0x52, 0x00, 0x5b, 0x00, 0x64, 0x00, 0x6d, 0x00, 0x00, 0x00, 0x07, 0x00,
+  0x10, 0x00, 0x19, 0x00, 0x49, 0x00, 0x52, 0x00, 0x5b, 0x00, 0x63, 0x00,
+  0x00, 0x00, 0x2d, 0x00, 0x3d, 0x00, 0x49, 0x00, 0x55, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x12, 0x00, 0x1a, 0x00, 0x28, 0x00, 0x2f, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x34, 0x00, 0x3d, 0x00,
+  0x46, 0x00, 0x00, 0x00, 0x06, 0x00, 0x13, 0x00, 0x00, 0x00, 0x30, 0x00,
+  0x3c, 0x00, 0x45, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x13, 0x00, 0x1f, 0x00,
+  0x26, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x07, 0x00, 0x10, 0x00,
+  0x1c, 0x00, 0x25, 0x00, 0x2e, 0x00, 0x36, 0x00, 0x42, 0x00, 0x53, 0x00,
+  0x67, 0x00, 0x76, 0x00, 0x8a, 0x00, 0x9f, 0x00, 0xb2, 0x00, 0xc7, 0x00,
+  0xd7, 0x00, 0xe7, 0x00, 0xfd, 0x00, 0x0e, 0x01, 0x1f, 0x01, 0x32, 0x01,
+  0x43, 0x01, 0x54, 0x01, 0x67, 0x01, 0x7a, 0x01, 0x89, 0x01, 0x9c, 0x01,
+  0xb0, 0x01, 0xc1, 0x01, 0xd4, 0x01, 0xe3, 0x01, 0x00, 0x00, 0x1b, 0x00,
+  0x25, 0x00, 0x36, 0x00, 0x47, 0x00, 0x58, 0x00, 0x6e, 0x00, 0x87, 0x00,
+  0x9c, 0x00, 0xaf, 0x00, 0xc3, 0x00, 0xde, 0x00, 0xfa, 0x00, 0x11, 0x01,
+  0x2a, 0x01, 0x42, 0x01, 0x5e, 0x01, 0x76, 0x01, 0x90, 0x01, 0xa4, 0x01,
+  0xb6, 0x01, 0xcb, 0x01, 0xe6, 0x01, 0xfc, 0x01, 0x14, 0x02, 0x2d, 0x02,
+  0x48, 0x02, 0x5d, 0x02, 0x76, 0x02, 0x8b, 0x02, 0xa2, 0x02, 0xb5, 0x02,
+  0xc7, 0x02, 0xdd, 0x02, 0xf2, 0x02, 0x00, 0x00, 0x0b, 0x00, 0x23, 0x00,
+  0x2e, 0x00, 0x40, 0x00, 0x4f, 0x00, 0x5e, 0x00, 0x6f, 0x00, 0x80, 0x00,
+  0x92, 0x00, 0xb4, 0x00, 0xd8, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x0a, 0x00,
+  0x19, 0x00, 0x2a, 0x00, 0x39, 0x00, 0x53, 0x00, 0x6b, 0x00, 0x83, 0x00,
+  0x97, 0x00, 0xa7, 0x00, 0xb9, 0x00, 0xd1, 0x00, 0x00, 0x00, 0x07, 0x00,
+  0x2e, 0x00, 0x35, 0x00, 0x47, 0x00, 0x60, 0x00, 0x77, 0x00, 0x8e, 0x00,
+  0xa1, 0x00, 0xaf, 0x00, 0xc1, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x25, 0x00,
+  0x2e, 0x00, 0x37, 0x00, 0x40, 0x00, 0x46, 0x00, 0x4c, 0x00, 0x5b, 0x00,
+  0x6d, 0x00, 0x7a, 0x00, 0x91, 0x00, 0xa0, 0x00, 0x00, 0x00, 0x1d, 0x00,
+  0x24, 0x00, 0x2b, 0x00, 0x3d, 0x00, 0x55, 0x00, 0x67, 0x00, 0x78, 0x00,
+  0x88, 0x00, 0x9f, 0x00, 0x00, 0x00, 0x21, 0x00, 0x2b, 0x00, 0x32, 0x00,
+  0x3a, 0x00, 0x4c, 0x00, 0x5f, 0x00, 0x75, 0x00, 0x85, 0x00, 0x96, 0x00,
+  0xae, 0x00, 0x00, 0x00, 0x07, 0x00, 0x11, 0x00, 0x17, 0x00, 0x28, 0x00,
+  0x3a, 0x00, 0x53, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x15, 0x00, 0x1f, 0x00,
+  0x32, 0x00, 0x46, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x24, 0x00, 0x2d, 0x00,
+  0x39, 0x00, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x3f, 0x00,
+  0x47, 0x00, 0x4f, 0x00, 0x59, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x33, 0x00,
+  0x4f, 0x00, 0x5b, 0x00, 0x63, 0x00, 0x79, 0x00, 0x00, 0x00, 0x07, 0x00,
+  0x00, 0x00, 0x1d, 0x00, 0x45, 0x00, 0x6f, 0x00, 0x79, 0x00, 0x80, 0x00,
+  0x00, 0x00, 0x0a, 0x00, 0x10, 0x00, 0x18, 0x00, 0x20, 0x00, 0x29, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x15, 0x00, 0x1f, 0x00, 0x25, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x14, 0x00, 0x1d, 0x00, 0x26, 0x00, 0x2f, 0x00, 0x39, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x19, 0x00, 0x29, 0x00, 0x32, 0x00, 0x00, 0x00,
+  0x19, 0x00, 0x1f, 0x00, 0x4c, 0x00, 0x92, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x11, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x25, 0x00, 0x30, 0x00, 0x3b, 0x00,
+  0x66, 0x00, 0x73, 0x00, 0x7f, 0x00, 0x88, 0x00, 0x8f, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x14, 0x00, 0x1e, 0x00, 0x28, 0x00, 0x00, 0x00, 0x07, 0x00,
+  0x1c, 0x00, 0x23, 0x00, 0x2a, 0x00, 0x36, 0x00, 0x62, 0x00, 0x6e, 0x00,
+  0x7d, 0x00, 0x84, 0x00, 0x00, 0x00, 0x20, 0x00, 0x42, 0x00, 0x62, 0x00,
+  0x7d, 0x00, 0x96, 0x00, 0xb1, 0x00, 0xcb, 0x00, 0xe0, 0x00, 0xec, 0x00,
+  0xfb, 0x00, 0x21, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x23, 0x00,
+  0x48, 0x00, 0x6b, 0x00, 0x89, 0x00, 0xa4, 0x00, 0xc1, 0x00, 0xdc, 0x00,
+  0xe4, 0x00, 0xed, 0x00, 0xf8, 0x00, 0x07, 0x01, 0x10, 0x01, 0x19, 0x01,
+  0x00, 0x00, 0x07, 0x00, 0x0d, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x0b, 0x00,
+  0x1c, 0x00, 0x29, 0x00, 0x33, 0x00, 0x39, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x14, 0x00, 0x1d, 0x00, 0x29, 0x00, 0x33, 0x00, 0x00, 0x00, 0x07, 0x00,
+  0x13, 0x00, 0x1c, 0x00, 0x23, 0x00, 0x00, 0x00, 0x18, 0x00, 0x37, 0x00,
+  0x3f, 0x00, 0x59, 0x00, 0x62, 0x00, 0x68, 0x00, 0x71, 0x00, 0x00, 0x00,
+  0x23, 0x00, 0x4c, 0x00, 0x54, 0x00, 0x7a, 0x00, 0x93, 0x00, 0xaf, 0x00,
+  0xdc, 0x00, 0xf9, 0x00, 0x11, 0x01, 0x20, 0x01, 0x2c, 0x01, 0x34, 0x01,
+  0x3d, 0x01, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x20, 0x00, 0x30, 0x00,
+  0x4c, 0x00, 0x58, 0x00, 0x65, 0x00, 0x71, 0x00, 0x7d, 0x00, 0x84, 0x00,
+  0x8b, 0x00, 0x00, 0x00, 0x21, 0x00, 0x27, 0x00, 0x33, 0x00, 0x3c, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x1a, 0x00,
+  0x1e, 0x00, 0x24, 0x00, 0x30, 0x00, 0x39, 0x00, 0x00, 0x00, 0x1c, 0x00,
+  0x3e, 0x00, 0x5a, 0x00, 0x7d, 0x00, 0x9b, 0x00, 0xb4, 0x00, 0xcf, 0x00,
+  0xd8, 0x00, 0xe4, 0x00, 0xed, 0x00, 0xfd, 0x00, 0x16, 0x01, 0x1f, 0x01,
+  0x40, 0x01, 0x4a, 0x01, 0x53, 0x01, 0x6b, 0x01, 0x75, 0x01, 0x7a, 0x01,
+  0x00, 0x00, 0x1d, 0x00, 0x26, 0x00, 0x30, 0x00, 0x00, 0x00, 0x1f, 0x00,
+  0x44, 0x00, 0x64, 0x00, 0x8a, 0x00, 0xab, 0x00, 0xc6, 0x00, 0xe3, 0x00,
+  0xef, 0x00, 0xfb, 0x00, 0x04, 0x01, 0x12, 0x01, 0x00, 0x00, 0x1c, 0x00,
+  0x28, 0x00, 0x33, 0x00, 0x42, 0x00, 0x52, 0x00, 0x5e, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x13, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x19, 0x00, 0x27, 0x00,
+  0x30, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x13, 0x00, 0x20, 0x00,
+  0x29, 0x00, 0x32, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0b, 0x00,
+  0x2e, 0x00, 0x54, 0x00, 0x6d, 0x00, 0x96, 0x00, 0xb7, 0x00, 0xd3, 0x00,
+  0xf5, 0x00, 0x19, 0x01, 0x33, 0x01, 0x43, 0x01, 0x65, 0x01, 0x89, 0x01,
+  0xa4, 0x01, 0xb4, 0x01, 0xd4, 0x01, 0xdb, 0x01, 0xe2, 0x01, 0xe9, 0x01,
+  0x00, 0x00, 0x0e, 0x00, 0x18, 0x00, 0x29, 0x00, 0x35, 0x00, 0x3f, 0x00,
+  0x48, 0x00, 0x4d, 0x00, 0x00, 0x00, 0x09, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x10, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x17, 0x00,
+  0x00, 0x00, 0x33, 0x00, 0x40, 0x00, 0x4d, 0x00, 0x57, 0x00, 0x68, 0x00,
+  0x89, 0x00, 0x94, 0x00, 0x9b, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x0b, 0x00,
+  0x1f, 0x00, 0x2b, 0x00, 0x39, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x1c, 0x00,
+  0x39, 0x00, 0x61, 0x00, 0x70, 0x00, 0x7d, 0x00, 0x9e, 0x00, 0xbd, 0x00,
+  0x00, 0x00, 0x1d, 0x00, 0x23, 0x00, 0x39, 0x00, 0x60, 0x00, 0x6f, 0x00,
+  0x77, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x44, 0x00, 0x5f, 0x00, 0x79, 0x00,
+  0x92, 0x00, 0xb3, 0x00, 0xcb, 0x00, 0xe9, 0x00, 0xf5, 0x00, 0xfe, 0x00,
+  0x0a, 0x01, 0x12, 0x01, 0x1a, 0x01, 0x2b, 0x01, 0x36, 0x01, 0x3e, 0x01,
+  0x46, 0x01, 0x4e, 0x01, 0x5f, 0x01, 0x67, 0x01, 0x00, 0x00, 0x2b, 0x00,
+  0x49, 0x00, 0x4f, 0x00, 0x58, 0x00, 0x61, 0x00, 0x6c, 0x00, 0x00, 0x00,
+  0x2d, 0x00, 0x4a, 0x00, 0x68, 0x00, 0x86, 0x00, 0xa1, 0x00, 0xc5, 0x00,
+  0xda, 0x00, 0xfa, 0x00, 0x04, 0x01, 0x0d, 0x01, 0x14, 0x01, 0x33, 0x01,
+  0x3e, 0x01, 0x47, 0x01, 0x50, 0x01, 0x57, 0x01, 0x60, 0x01, 0x00, 0x00,
+  0x1d, 0x00, 0x3a, 0x00, 0x56, 0x00, 0x85, 0x00, 0x00, 0x00, 0x1f, 0x00,
+  0x2a, 0x00, 0x36, 0x00, 0x00, 0x00, 0x20, 0x00, 0x46, 0x00, 0x63, 0x00,
+  0x79, 0x00, 0x00, 0x00, 0x20, 0x00, 0x3d, 0x00, 0x48, 0x00, 0x4f, 0x00,
+  0x56, 0x00, 0x60, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x35, 0x00, 0x5f, 0x00,
+  0x8a, 0x00, 0x91, 0x00, 0x00, 0x00, 0x20, 0x00, 0x42, 0x00, 0x4b, 0x00,
+  0x51, 0x00, 0x57, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x21, 0x00, 0x2d, 0x00,
+  0x00, 0x00, 0x20, 0x00, 0x3e, 0x00, 0x46, 0x00, 0x00, 0x00, 0x1a, 0x00,
+  0x3e, 0x00, 0x47, 0x00, 0x50, 0x00, 0x00, 0x00, 0x25, 0x00, 0x3b, 0x00,
+  0x61, 0x00, 0x6a, 0x00, 0x73, 0x00, 0x79, 0x00, 0x00, 0x00, 0x1f, 0x00,
+  0x33, 0x00, 0x3a, 0x00, 0x42, 0x00, 0x49, 0x00, 0x53, 0x00, 0x5d, 0x00,
+  0x66, 0x00, 0x6d, 0x00, 0x74, 0x00, 0x7b, 0x00, 0x00, 0x00, 0x1a, 0x00,
+  0x3c, 0x00, 0x46, 0x00, 0x4f, 0x00, 0x57, 0x00, 0x00, 0x00, 0x1f, 0x00,
+  0x46, 0x00, 0x51, 0x00, 0x6c, 0x00, 0x74, 0x00, 0x7d, 0x00, 0x85, 0x00,
+  0x91, 0x00, 0x00, 0x00, 0x22, 0x00, 0x44, 0x00, 0x5c, 0x00, 0x7f, 0x00,
+  0x8a, 0x00, 0xa3, 0x00, 0xae, 0x00, 0xb6, 0x00, 0x00, 0x00, 0x25, 0x00,
+  0x32, 0x00, 0x48, 0x00, 0x66, 0x00, 0x7e, 0x00, 0x86, 0x00, 0x00, 0x00,
+  0x25, 0x00, 0x4a, 0x00, 0x64, 0x00, 0x94, 0x00, 0xb0, 0x00, 0xd1, 0x00,
+  0xdd, 0x00, 0xfd, 0x00, 0x05, 0x01, 0x10, 0x01, 0x1b, 0x01, 0x24, 0x01,
+  0x00, 0x00, 0x1b, 0x00, 0x38, 0x00, 0x44, 0x00, 0x5f, 0x00, 0x68, 0x00,
+  0x72, 0x00, 0x7b, 0x00, 0x84, 0x00, 0x8f, 0x00, 0x98, 0x00, 0x00, 0x00,
+  0x1b, 0x00, 0x3c, 0x00, 0x63, 0x00, 0x6f, 0x00, 0x00, 0x00, 0x2e, 0x00,
+  0x50, 0x00, 0x59, 0x00, 0x63, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x31, 0x00,
+  0x40, 0x00, 0x49, 0x00, 0x00, 0x00, 0x07, 0x00, 0x13, 0x00, 0x43, 0x00,
+  0x00, 0x00, 0x1c, 0x00, 0x42, 0x00, 0x5d, 0x00, 0x7b, 0x00, 0x96, 0x00,
+  0x9f, 0x00, 0xc0, 0x00, 0xdb, 0x00, 0x07, 0x01, 0x0d, 0x01, 0x1e, 0x01,
+  0x00, 0x00, 0x1d, 0x00, 0x2b, 0x00, 0x36, 0x00, 0x3f, 0x00, 0x49, 0x00,
+  0x00, 0x00, 0x04, 0x00, 0x0b, 0x00, 0x18, 0x00, 0x48, 0x00, 0x57, 0x00,
+  0x00, 0x00, 0x29, 0x00, 0x34, 0x00, 0x3d, 0x00, 0x48, 0x00, 0x52, 0x00,
+  0x00, 0x00, 0x1a, 0x00, 0x2f, 0x00, 0x50, 0x00, 0x5d, 0x00, 0x81, 0x00,
+  0x97, 0x00, 0xba, 0x00, 0xd0, 0x00, 0xef, 0x00, 0xf6, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x11, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x38, 0x00, 0x45, 0x00,
+  0x61, 0x00, 0x88, 0x00, 0x9e, 0x00, 0xa5, 0x00, 0xae, 0x00, 0x00, 0x00,
+  0x22, 0x00, 0x29, 0x00, 0x32, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x1d, 0x00,
+  0x39, 0x00, 0x5f, 0x00, 0x87, 0x00, 0xb6, 0x00, 0xbe, 0x00, 0xcd, 0x00,
+  0xd4, 0x00, 0xdb, 0x00, 0xe4, 0x00, 0xeb, 0x00, 0x00, 0x00, 0x1f, 0x00,
+  0x41, 0x00, 0x62, 0x00, 0x89, 0x00, 0x92, 0x00, 0x9b, 0x00, 0xaa, 0x00,
+  0xb3, 0x00, 0xbc, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x3e, 0x00, 0x5b, 0x00,
+  0x67, 0x00, 0x6f, 0x00, 0x7a, 0x00, 0x84, 0x00, 0x8c, 0x00, 0xad, 0x00,
+  0x00, 0x00, 0x29, 0x00, 0x57, 0x00, 0x76, 0x00, 0x81, 0x00, 0x87, 0x00,
+  0x8e, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x2f, 0x00, 0x3d, 0x00, 0x49, 0x00,
+  0x53, 0x00, 0x5e, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x3a, 0x00, 0x5b, 0x00,
+  0x68, 0x00, 0x6f, 0x00, 0x79, 0x00, 0x80, 0x00, 0x00, 0x00, 0x1b, 0x00,
+  0x3a, 0x00, 0x4c, 0x00, 0x58, 0x00, 0x00, 0x00, 0x22, 0x00, 0x2b, 0x00,
+  0x54, 0x00, 0x00, 0x00, 0x14, 0x00, 0x2d, 0x00, 0x39, 0x00, 0x45, 0x00,
+  0x4f, 0x00, 0x54, 0x00, 0x00, 0x00, 0x24, 0x00, 0x42, 0x00, 0x60, 0x00,
+  0x80, 0x00, 0xb4, 0x00, 0xc3, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x3b, 0x00,
+  0x5b, 0x00, 0x7b, 0x00, 0x86, 0x00, 0x99, 0x00, 0xa1, 0x00, 0x00, 0x00,
+  0x21, 0x00, 0x43, 0x00, 0x67, 0x00, 0x89, 0x00, 0xa1, 0x00, 0xa9, 0x00,
+  0xcb, 0x00, 0xef, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x25, 0x00, 0x45, 0x00,
+  0x6a, 0x00, 0x73, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x3d, 0x00, 0x68, 0x00,
+  0x76, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x20, 0x00, 0x3e, 0x00, 0x61, 0x00,
+  0x69, 0x00, 0x70, 0x00, 0x00, 0x00, 0x21, 0x00, 0x40, 0x00, 0x48, 0x00,
+  0x62, 0x00, 0x6b, 0x00, 0x77, 0x00, 0x80, 0x00, 0x8c, 0x00, 0x98, 0x00,
+  0x00, 0x00, 0x20, 0x00, 0x3f, 0x00, 0x5d, 0x00, 0x64, 0x00, 0x6c, 0x00,
+  0x00, 0x00, 0x2c, 0x00, 0x35, 0x00, 0x40, 0x00, 0x00, 0x00, 0x28, 0x00,
+  0x4c, 0x00, 0x55, 0x00, 0x5d, 0x00, 0x68, 0x00, 0x00, 0x00, 0x1d, 0x00,
+  0x27, 0x00, 0x4b, 0x00, 0x57, 0x00, 0x63, 0x00, 0x6e, 0x00, 0x7a, 0x00,
+  0x00, 0x00, 0x22, 0x00, 0x40, 0x00, 0x5b, 0x00, 0x76, 0x00, 0x82, 0x00,
+  0x8d, 0x00, 0x95, 0x00, 0x00, 0x00, 0x27, 0x00, 0x4b, 0x00, 0x56, 0x00,
+  0x61, 0x00, 0x68, 0x00, 0x6f, 0x00, 0x00, 0x00, 0x24, 0x00, 0x46, 0x00,
+  0x6d, 0x00, 0x74, 0x00, 0x7e, 0x00, 0x88, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x1e, 0x00, 0x00, 0x00, 0x31, 0x00, 0x55, 0x00, 0x73, 0x00, 0x97, 0x00,
+  0xa9, 0x00, 0xbb, 0x00, 0xcc, 0x00, 0xde, 0x00, 0xf0, 0x00, 0x01, 0x01,
+  0x12, 0x01, 0x24, 0x01, 0x35, 0x01, 0x47, 0x01, 0x62, 0x01, 0x88, 0x01,
+  0x92, 0x01, 0x9a, 0x01, 0xa0, 0x01, 0xa6, 0x01, 0xcb, 0x01, 0x00, 0x00,
+  0x26, 0x00, 0x4b, 0x00, 0x51, 0x00, 0x76, 0x00, 0x7d, 0x00, 0x84, 0x00,
+  0x9c, 0x00, 0xca, 0x00, 0xf0, 0x00, 0xfa, 0x00, 0x02, 0x01, 0x0b, 0x01,
+  0x13, 0x01, 0x00, 0x00, 0x12, 0x00, 0x18, 0x00, 0x1e, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x07, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x1e, 0x00, 0x26, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x14, 0x00,
+  0x32, 0x00, 0x4e, 0x00, 0x59, 0x00, 0x79, 0x00, 0x82, 0x00, 0x00, 0x00,
+  0x36, 0x00, 0x42, 0x00, 0x4e, 0x00, 0x5d, 0x00, 0x68, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x27, 0x00, 0x37, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x21, 0x00,
+  0x41, 0x00, 0x4a, 0x00, 0x53, 0x00, 0x5f, 0x00, 0x67, 0x00, 0x70, 0x00,
+  0x00, 0x00, 0x1d, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+  0x22, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x28, 0x00, 0x00, 0x00, 0x09, 0x00, 0x11, 0x00, 0x19, 0x00,
+  0x00, 0x00, 0x1b, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x07, 0x00, 0x23, 0x00,
+  0x3c, 0x00, 0x60, 0x00, 0x6f, 0x00, 0x85, 0x00, 0x8e, 0x00, 0x98, 0x00,
+  0x00, 0x00, 0x1f, 0x00, 0x26, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x24, 0x00,
+  0x50, 0x00, 0x59, 0x00, 0x75, 0x00, 0x7d, 0x00, 0x85, 0x00, 0x8e, 0x00,
+  0x00, 0x00, 0x07, 0x00, 0x1e, 0x00, 0x25, 0x00, 0x2c, 0x00, 0x33, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x16, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x09, 0x00, 0x12, 0x00, 0x1b, 0x00, 0x23, 0x00,
+  0x28, 0x00, 0x00, 0x00, 0x09, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x08, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x09, 0x00, 0x16, 0x00, 0x1f, 0x00,
+  0x28, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x40, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x18, 0x00, 0x22, 0x00, 0x2b, 0x00, 0x38, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x15, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x15, 0x00, 0x1f, 0x00,
+  0x2b, 0x00, 0x00, 0x00, 0x08, 0x00, 0x10, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x15, 0x00, 0x34, 0x00, 0x40, 0x00, 0x4b, 0x00, 0x52, 0x00, 0x5e, 0x00,
+  0x68, 0x00, 0x6f, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0a, 0x00,
+  0x2b, 0x00, 0x33, 0x00, 0x4b, 0x00, 0x54, 0x00, 0x60, 0x00, 0x68, 0x00,
+  0x70, 0x00, 0x7c, 0x00, 0x83, 0x00, 0x89, 0x00, 0x8f, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x10, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x17, 0x00,
+  0x00, 0x00, 0x1c, 0x00, 0x3d, 0x00, 0x46, 0x00, 0x52, 0x00, 0x61, 0x00,
+  0x70, 0x00, 0x77, 0x00, 0x00, 0x00, 0x27, 0x00, 0x47, 0x00, 0x5d, 0x00,
+  0x6f, 0x00, 0x91, 0x00, 0xaa, 0x00, 0xc5, 0x00, 0xe2, 0x00, 0x02, 0x01,
+  0x18, 0x01, 0x34, 0x01, 0x4f, 0x01, 0x6a, 0x01, 0x81, 0x01, 0xa3, 0x01,
+  0xb9, 0x01, 0xcf, 0x01, 0xe7, 0x01, 0xfc, 0x01, 0x1b, 0x02, 0x32, 0x02,
+  0x4a, 0x02, 0x61, 0x02, 0x83, 0x02, 0x9c, 0x02, 0xb6, 0x02, 0xd9, 0x02,
+  0xfd, 0x02, 0x24, 0x03, 0x48, 0x03, 0x6c, 0x03, 0x90, 0x03, 0xb6, 0x03,
+  0xcf, 0x03, 0xf8, 0x03, 0x15, 0x04, 0x33, 0x04, 0x55, 0x04, 0x6a, 0x04,
+  0x82, 0x04, 0xa1, 0x04, 0xc0, 0x04, 0xc7, 0x04, 0xed, 0x04, 0x10, 0x05,
+  0x29, 0x05, 0x3b, 0x05, 0x4c, 0x05, 0x5d, 0x05, 0x73, 0x05, 0x82, 0x05,
+  0x96, 0x05, 0x00, 0x00, 0x1b, 0x00, 0x28, 0x00, 0x2e, 0x00, 0x34, 0x00,
+  0x3a, 0x00, 0x00, 0x00, 0x23, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x29, 0x00,
+  0x00, 0x00, 0x27, 0x00, 0x44, 0x00, 0x6c, 0x00, 0x77, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x2a, 0x00, 0x49, 0x00, 0x64, 0x00, 0x8a, 0x00, 0xab, 0x00,
+  0xd0, 0x00, 0xd9, 0x00, 0xfd, 0x00, 0x22, 0x01, 0x5a, 0x01, 0x65, 0x01,
+  0x73, 0x01, 0x7d, 0x01, 0x83, 0x01, 0x00, 0x00, 0x1b, 0x00, 0x3c, 0x00,
+  0x48, 0x00, 0x54, 0x00, 0x62, 0x00, 0x6b, 0x00, 0x00, 0x00, 0x1b, 0x00,
+  0x38, 0x00, 0x5b, 0x00, 0x64, 0x00, 0x6b, 0x00, 0x00, 0x00, 0x0b, 0x00,
+  0x16, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x42, 0x00, 0x4b, 0x00,
+  0x53, 0x00, 0x5c, 0x00, 0x68, 0x00, 0x00, 0x00, 0x08, 0x00, 0x11, 0x00,
+  0x19, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x11, 0x00, 0x30, 0x00, 0x4b, 0x00,
+  0x62, 0x00, 0x79, 0x00, 0x86, 0x00, 0x92, 0x00, 0x98, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x11, 0x00, 0x20, 0x00, 0x26, 0x00, 0x00, 0x00, 0x12, 0x00,
+  0x25, 0x00, 0x00, 0x00, 0x08, 0x00, 0x12, 0x00, 0x1b, 0x00, 0x23, 0x00,
+  0x2b, 0x00, 0x33, 0x00, 0x3b, 0x00, 0x43, 0x00, 0x4c, 0x00, 0x54, 0x00,
+  0x5c, 0x00, 0x64, 0x00, 0x6b, 0x00, 0x74, 0x00, 0x7c, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x31, 0x00, 0x44, 0x00, 0x73, 0x00, 0x8b, 0x00, 0xa0, 0x00,
+  0xcc, 0x00, 0xe0, 0x00, 0x08, 0x01, 0x13, 0x01, 0x1c, 0x01, 0x25, 0x01,
+  0x2e, 0x01, 0x37, 0x01, 0x3e, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x15, 0x00,
+  0x21, 0x00, 0x2c, 0x00, 0x33, 0x00, 0x3f, 0x00, 0x4b, 0x00, 0x5a, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x14, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x0b, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x09, 0x00, 0x13, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x29, 0x00, 0x3f, 0x00, 0x56, 0x00,
+  0x5e, 0x00, 0x64, 0x00, 0x6b, 0x00, 0x71, 0x00, 0x00, 0x00, 0x0a, 0x00,
+  0x2d, 0x00, 0x35, 0x00, 0x42, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x23, 0x00,
+  0x41, 0x00, 0x69, 0x00, 0x92, 0x00, 0x9b, 0x00, 0xa0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x34, 0x00, 0x3c, 0x00, 0x44, 0x00,
+  0x00, 0x00, 0x16, 0x00, 0x36, 0x00, 0x58, 0x00, 0x80, 0x00, 0xa1, 0x00,
+  0xbb, 0x00, 0x00, 0x00, 0x24, 0x00, 0x2e, 0x00, 0x38, 0x00, 0x3e, 0x00,
+  0x44, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x3a, 0x00, 0x50, 0x00,
+  0x59, 0x00, 0x6f, 0x00, 0x77, 0x00, 0x98, 0x00, 0xb8, 0x00, 0xe5, 0x00,
+  0x16, 0x01, 0x1b, 0x01, 0x22, 0x01, 0x00, 0x00, 0x15, 0x00, 0x2b, 0x00,
+  0x41, 0x00, 0x56, 0x00, 0x6b, 0x00, 0x81, 0x00, 0x96, 0x00, 0xac, 0x00,
+  0xcb, 0x00, 0xd3, 0x00, 0x05, 0x01, 0x10, 0x01, 0x17, 0x01, 0x21, 0x01,
+  0x2b, 0x01, 0x32, 0x01, 0x3b, 0x01, 0x42, 0x01, 0x00, 0x00, 0x08, 0x00,
+  0x12, 0x00, 0x18, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x15, 0x00, 0x21, 0x00,
+  0x00, 0x00, 0x1a, 0x00, 0x27, 0x00, 0x31, 0x00, 0x3a, 0x00, 0x43, 0x00,
+  0x4a, 0x00, 0x50, 0x00, 0x00, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x43, 0x00,
+  0x4b, 0x00, 0x54, 0x00, 0x5c, 0x00, 0x68, 0x00, 0x00, 0x00, 0x17, 0x00,
+  0x20, 0x00, 0x4f, 0x00, 0x5b, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x4b, 0x00, 0x63, 0x00, 0x7f, 0x00,
+  0xa2, 0x00, 0xc7, 0x00, 0xe2, 0x00, 0xf9, 0x00, 0x12, 0x01, 0x32, 0x01,
+  0x4f, 0x01, 0x75, 0x01, 0x8b, 0x01, 0xa2, 0x01, 0xc3, 0x01, 0xcb, 0x01,
+  0xd3, 0x01, 0xd9, 0x01, 0xe0, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x12, 0x00,
+  0x00, 0x00, 0x14, 0x00, 0x1c, 0x00, 0x29, 0x00, 0x2f, 0x00, 0x38, 0x00,
+  0x00, 0x00, 0x23, 0x00, 0x3a, 0x00, 0x52, 0x00, 0x60, 0x00, 0x69, 0x00,
+  0x72, 0x00, 0x7b, 0x00, 0x84, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x0d, 0x00,
+  0x17, 0x00, 0x1e, 0x00, 0x28, 0x00, 0x00, 0x00, 0x36, 0x00, 0x3e, 0x00,
+  0x50, 0x00, 0x5c, 0x00, 0x64, 0x00, 0x6c, 0x00, 0x73, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x12, 0x00, 0x1b, 0x00, 0x24, 0x00, 0x2d, 0x00, 0x34, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x34, 0x00, 0x3e, 0x00, 0x45, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x06, 0x00, 0x1e, 0x00, 0x3a, 0x00, 0x5e, 0x00, 0x67, 0x00,
+  0x80, 0x00, 0xa0, 0x00, 0xc0, 0x00, 0xca, 0x00, 0xd1, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x00, 0x00, 0x09, 0x00, 0x20, 0x00, 0x3f, 0x00, 0x48, 0x00,
+  0x00, 0x00, 0x0b, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00,
+  0x36, 0x00, 0x43, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x18, 0x00, 0x1f, 0x00,
+  0x54, 0x00, 0x5d, 0x00, 0x7b, 0x00, 0x96, 0x00, 0x9d, 0x00, 0xad, 0x00,
+  0xb3, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x23, 0x00, 0x28, 0x00, 0x00, 0x00,
+  0x21, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x24, 0x00, 0x43, 0x00, 0x4c, 0x00,
+  0x53, 0x00, 0x00, 0x00, 0x23, 0x00, 0x2c, 0x00, 0x4c, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x4e, 0x00, 0x64, 0x00, 0x71, 0x00, 0x7a, 0x00, 0x83, 0x00,
+  0x89, 0x00, 0x00, 0x00, 0x09, 0x00, 0x42, 0x00, 0x4a, 0x00, 0x51, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x1f, 0x00, 0x2a, 0x00, 0x35, 0x00,
+  0x3e, 0x00, 0x44, 0x00, 0x4a, 0x00, 0x00, 0x00, 0x16, 0x00, 0x2b, 0x00,
+  0x3e, 0x00, 0x51, 0x00, 0x66, 0x00, 0x72, 0x00, 0x7b, 0x00, 0x81, 0x00,
+  0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x14, 0x00, 0x1f, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x16, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x18, 0x00,
+  0x21, 0x00, 0x00, 0x00, 0x28, 0x00, 0x31, 0x00, 0x3a, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x1c, 0x00, 0x25, 0x00, 0x00, 0x00, 0x14, 0x00, 0x32, 0x00,
+  0x3b, 0x00, 0x59, 0x00, 0x5f, 0x00, 0x65, 0x00, 0x00, 0x00, 0x25, 0x00,
+  0x2f, 0x00, 0x38, 0x00, 0x41, 0x00, 0x47, 0x00, 0x00, 0x00, 0x24, 0x00,
+  0x2a, 0x00, 0x31, 0x00, 0x37, 0x00, 0x00, 0x00, 0x13, 0x00, 0x38, 0x00,
+  0x3f, 0x00, 0x00, 0x00, 0x14, 0x00, 0x1b, 0x00, 0x27, 0x00, 0x2d, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x12, 0x00, 0x00, 0x00, 0x22, 0x00,
+  0x29, 0x00, 0x46, 0x00, 0x00, 0x00, 0x09, 0x00, 0x15, 0x00, 0x20, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x43, 0x00, 0x5c, 0x00, 0x67, 0x00, 0x71, 0x00,
+  0x79, 0x00, 0x81, 0x00, 0x87, 0x00, 0x8d, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x00, 0x00, 0x11, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x28, 0x00,
+  0x00, 0x00, 0x0a, 0x00, 0x15, 0x00, 0x1d, 0x00, 0x2c, 0x00, 0x56, 0x00,
+  0x5f, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x09, 0x00, 0x14, 0x00,
+  0x1a, 0x00, 0x26, 0x00, 0x30, 0x00, 0x3d, 0x00, 0x45, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x12, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x2c, 0x00,
+  0x35, 0x00, 0x3d, 0x00, 0x46, 0x00, 0x4e, 0x00, 0x55, 0x00, 0x00, 0x00,
+  0x23, 0x00, 0x34, 0x00, 0x3d, 0x00, 0x49, 0x00, 0x50, 0x00, 0x59, 0x00,
+  0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0c, 0x00, 0x12, 0x00,
+  0x1b, 0x00, 0x21, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1b, 0x00, 0x3e, 0x00,
+  0x48, 0x00, 0x54, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x07, 0x00, 0x14, 0x00,
+  0x32, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x12, 0x00, 0x18, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x09, 0x00, 0x31, 0x00, 0x38, 0x00,
+  0x00, 0x00, 0x22, 0x00, 0x2b, 0x00, 0x34, 0x00, 0x00, 0x00, 0x06, 0x00,
+  0x12, 0x00, 0x00, 0x00, 0x22, 0x00, 0x32, 0x00, 0x4a, 0x00, 0x70, 0x00,
+  0x79, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x40, 0x00, 0x4a, 0x00, 0x51, 0x00,
+  0x57, 0x00, 0x5c, 0x00, 0x71, 0x00, 0x88, 0x00, 0xa0, 0x00, 0xbc, 0x00,
+  0xd3, 0x00, 0xe3, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x25, 0x00, 0x2e, 0x00,
+  0x37, 0x00, 0x00, 0x00, 0x27, 0x00, 0x41, 0x00, 0x00, 0x00, 0x07, 0x00,
+  0x0e, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x18, 0x00, 0x00, 0x00, 0x2a, 0x00,
+  0x33, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x26, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x14, 0x00, 0x00, 0x00, 0x09, 0x00, 0x12, 0x00, 0x00, 0x00,
+  0x2f, 0x00, 0x38, 0x00, 0x41, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x00, 0x00, 0x26, 0x00, 0x4a, 0x00, 0x54, 0x00, 0x5b, 0x00, 0x64, 0x00,
+  0x6f, 0x00, 0x79, 0x00, 0x83, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00,
+  0x23, 0x00, 0x3f, 0x00, 0x48, 0x00, 0x51, 0x00, 0x5a, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x22, 0x00, 0x2c, 0x00, 0x38, 0x00, 0x3f, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x14, 0x00, 0x21, 0x00, 0x00, 0x00, 0x18, 0x00, 0x21, 0x00,
+  0x4c, 0x00, 0x52, 0x00, 0x00, 0x00, 0x09, 0x00, 0x26, 0x00, 0x2f, 0x00,
+  0x35, 0x00, 0x3b, 0x00, 0x41, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x16, 0x00,
+  0x1f, 0x00, 0x2f, 0x00, 0x38, 0x00, 0x00, 0x00, 0x16, 0x00, 0x3e, 0x00,
+  0x47, 0x00, 0x57, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x1d, 0x00, 0x38, 0x00, 0x47, 0x00, 0x53, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x16, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x33, 0x00,
+  0x3f, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x2a, 0x00, 0x4d, 0x00, 0x5d, 0x00,
+  0x69, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x10, 0x00, 0x1b, 0x00, 0x26, 0x00,
+  0x00, 0x00, 0x0b, 0x00, 0x14, 0x00, 0x00, 0x00, 0x13, 0x00, 0x1b, 0x00,
+  0x30, 0x00, 0x3b, 0x00, 0x44, 0x00, 0x4b, 0x00, 0x52, 0x00, 0x00, 0x00,
+  0x1a, 0x00, 0x23, 0x00, 0x2b, 0x00, 0x37, 0x00, 0x44, 0x00, 0x51, 0x00,
+  0x00, 0x00, 0x07, 0x00, 0x13, 0x00, 0x19, 0x00, 0x27, 0x00, 0x34, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x26, 0x00, 0x30, 0x00,
+  0x00, 0x00, 0x20, 0x00, 0x29, 0x00, 0x3a, 0x00, 0x44, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x18, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x4a, 0x00, 0x50, 0x00,
+  0x55, 0x00, 0x00, 0x00, 0x07, 0x00, 0x2e, 0x00, 0x34, 0x00, 0x3a, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x19, 0x00, 0x22, 0x00, 0x2f, 0x00,
+  0x00, 0x00, 0x2d, 0x00, 0x50, 0x00, 0x66, 0x00, 0x72, 0x00, 0x7b, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x4b, 0x00, 0x76, 0x00, 0x95, 0x00, 0x9e, 0x00,
+  0xa8, 0x00, 0xae, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x15, 0x00, 0x1e, 0x00,
+  0x25, 0x00, 0x2e, 0x00, 0x3b, 0x00, 0x43, 0x00, 0x4a, 0x00, 0x53, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x2a, 0x00, 0x47, 0x00, 0x6f, 0x00, 0x8b, 0x00,
+  0x92, 0x00, 0xad, 0x00, 0xcb, 0x00, 0xe1, 0x00, 0xfc, 0x00, 0x15, 0x01,
+  0x4b, 0x01, 0x78, 0x01, 0xa5, 0x01, 0xc6, 0x01, 0xe5, 0x01, 0xfe, 0x01,
+  0x22, 0x02, 0x4a, 0x02, 0x6f, 0x02, 0x91, 0x02, 0xb2, 0x02, 0xd8, 0x02,
+  0xee, 0x02, 0x05, 0x03, 0x22, 0x03, 0x38, 0x03, 0x5b, 0x03, 0x73, 0x03,
+  0x85, 0x03, 0x9e, 0x03, 0xbe, 0x03, 0xdb, 0x03, 0x02, 0x04, 0x1e, 0x04,
+  0x40, 0x04, 0x63, 0x04, 0x85, 0x04, 0x91, 0x04, 0xb5, 0x04, 0xd8, 0x04,
+  0xf2, 0x04, 0x10, 0x05, 0x37, 0x05, 0x4e, 0x05, 0x68, 0x05, 0x87, 0x05,
+  0xb1, 0x05, 0xc3, 0x05, 0xe1, 0x05, 0x07, 0x06, 0x4a, 0x06, 0x67, 0x06,
+  0x7f, 0x06, 0x94, 0x06, 0xab, 0x06, 0xc8, 0x06, 0xdb, 0x06, 0xee, 0x06,
+  0x12, 0x07, 0x33, 0x07, 0x4d, 0x07, 0x69, 0x07, 0x7f, 0x07, 0x93, 0x07,
+  0xae, 0x07, 0xc7, 0x07, 0xe1, 0x07, 0xf5, 0x07, 0x1b, 0x08, 0x2b, 0x08,
+  0x4c, 0x08, 0x70, 0x08, 0x8f, 0x08, 0xa7, 0x08, 0xcf, 0x08, 0xf0, 0x08,
+  0x14, 0x09, 0x39, 0x09, 0x4e, 0x09, 0x67, 0x09, 0x84, 0x09, 0xd4, 0x09,
+  0xf8, 0x09, 0x12, 0x0a, 0x36, 0x0a, 0x53, 0x0a, 0x76, 0x0a, 0x8c, 0x0a,
+  0xa8, 0x0a, 0xd0, 0x0a, 0xed, 0x0a, 0x04, 0x0b, 0x11, 0x0b, 0x1a, 0x0b,
+  0x1f, 0x0b, 0x00, 0x00, 0x0b, 0x00, 0x2c, 0x00, 0x5c, 0x00, 0x65, 0x00,
+  0x70, 0x00, 0x7b, 0x00, 0x00, 0x00, 0x09, 0x00, 0x12, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x10, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x15, 0x00, 0x1d, 0x00,
+  0x2a, 0x00, 0x31, 0x00, 0x3a, 0x00, 0x47, 0x00, 0x59, 0x00, 0x00, 0x00,
+  0x1b, 0x00, 0x42, 0x00, 0x5f, 0x00, 0x68, 0x00, 0x76, 0x00, 0x80, 0x00,
+  0x89, 0x00, 0x90, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1e, 0x00, 0x28, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x24, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x0f, 0x00,
+  0x25, 0x00, 0x40, 0x00, 0x5b, 0x00, 0x74, 0x00, 0x97, 0x00, 0xa5, 0x00,
+  0xb2, 0x00, 0xbc, 0x00, 0xc5, 0x00, 0xcc, 0x00, 0xd1, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x00, 0x00, 0x09, 0x00, 0x31, 0x00, 0x5e, 0x00, 0x6d, 0x00,
+  0x76, 0x00, 0x84, 0x00, 0x8e, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x15, 0x00,
+  0x24, 0x00, 0x2d, 0x00, 0x38, 0x00, 0x00, 0x00, 0x18, 0x00, 0x21, 0x00,
+  0x28, 0x00, 0x30, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x33, 0x00, 0x3e, 0x00,
+  0x4b, 0x00, 0x51, 0x00, 0x57, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x16, 0x00,
+  0x1d, 0x00, 0x24, 0x00, 0x00, 0x00, 0x15, 0x00, 0x2b, 0x00, 0x3f, 0x00,
+  0x47, 0x00, 0x50, 0x00, 0x00, 0x00, 0x09, 0x00, 0x13, 0x00, 0x4c, 0x00,
+  0x55, 0x00, 0x5e, 0x00, 0x67, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x28, 0x00,
+  0x2e, 0x00, 0x3a, 0x00, 0x4f, 0x00, 0x68, 0x00, 0x70, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x43, 0x00, 0x4c, 0x00, 0x55, 0x00, 0x00, 0x00, 0x17, 0x00,
+  0x48, 0x00, 0x59, 0x00, 0x76, 0x00, 0x7f, 0x00, 0x96, 0x00, 0x9f, 0x00,
+  0xa7, 0x00, 0x00, 0x00, 0x12, 0x00, 0x1e, 0x00, 0x2a, 0x00, 0x38, 0x00,
+  0x00, 0x00, 0x15, 0x00, 0x21, 0x00, 0x2a, 0x00, 0x31, 0x00, 0x00, 0x00,
+  0x26, 0x00, 0x36, 0x00, 0x59, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x28, 0x00,
+  0x00, 0x00, 0x1d, 0x00, 0x26, 0x00, 0x4c, 0x00, 0x52, 0x00, 0x5d, 0x00,
+  0x64, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00,
+  0x11, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x23, 0x00, 0x56, 0x00,
+  0x5f, 0x00, 0x67, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x36, 0x00, 0x5f, 0x00,
+  0x75, 0x00, 0x92, 0x00, 0x9c, 0x00, 0xa5, 0x00, 0xc7, 0x00, 0xed, 0x00,
+  0x00, 0x00, 0x07, 0x00, 0x3a, 0x00, 0x42, 0x00, 0x4b, 0x00, 0x52, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x15, 0x00,
+  0x1e, 0x00, 0x29, 0x00, 0x2f, 0x00, 0x35, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x16, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x16, 0x00, 0x1e, 0x00, 0x27, 0x00,
+  0x32, 0x00, 0x00, 0x00, 0x08, 0x00, 0x11, 0x00, 0x20, 0x00, 0x29, 0x00,
+  0x31, 0x00, 0x00, 0x00, 0x16, 0x00, 0x21, 0x00, 0x00, 0x00, 0x07, 0x00,
+  0x10, 0x00, 0x25, 0x00, 0x36, 0x00, 0x45, 0x00, 0x4a, 0x00, 0x51, 0x00,
+  0x5f, 0x00, 0x65, 0x00, 0x6b, 0x00, 0x70, 0x00, 0x75, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x1d, 0x00, 0x28, 0x00, 0x2e, 0x00, 0x3d, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x12, 0x00, 0x31, 0x00, 0x3c, 0x00, 0x43, 0x00, 0x4e, 0x00,
+  0x55, 0x00, 0x64, 0x00, 0x00, 0x00, 0x25, 0x00, 0x3b, 0x00, 0x65, 0x00,
+  0x6f, 0x00, 0x78, 0x00, 0x81, 0x00, 0x92, 0x00, 0x99, 0x00, 0xa0, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x06, 0x00, 0x10, 0x00,
+  0x1f, 0x00, 0x2d, 0x00, 0x33, 0x00, 0x39, 0x00, 0x3f, 0x00, 0x00, 0x00,
+  0x22, 0x00, 0x56, 0x00, 0x5f, 0x00, 0x7b, 0x00, 0x86, 0x00, 0x8d, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x15, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x0b, 0x00,
+  0x13, 0x00, 0x34, 0x00, 0x79, 0x00, 0x80, 0x00, 0x8f, 0x00, 0x9b, 0x00,
+  0xa4, 0x00, 0xb5, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x2d, 0x00, 0x3d, 0x00,
+  0x45, 0x00, 0x4e, 0x00, 0x56, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x23, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x18, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x22, 0x00, 0x2b, 0x00, 0x34, 0x00, 0x3d, 0x00, 0x45, 0x00,
+  0x4b, 0x00, 0x53, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x15, 0x00,
+  0x28, 0x00, 0x34, 0x00, 0x48, 0x00, 0x56, 0x00, 0x62, 0x00, 0x67, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x18, 0x00, 0x00, 0x00, 0x1a, 0x00,
+  0x3f, 0x00, 0x48, 0x00, 0x51, 0x00, 0x59, 0x00, 0x5f, 0x00, 0x65, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x18, 0x00, 0x00, 0x00, 0x08, 0x00, 0x24, 0x00,
+  0x2d, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x3a, 0x00, 0x4d, 0x00, 0x67, 0x00,
+  0x72, 0x00, 0x78, 0x00, 0x7e, 0x00, 0x84, 0x00, 0x00, 0x00, 0x1f, 0x00,
+  0x25, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x2f, 0x00,
+  0x6f, 0x00, 0x7c, 0x00, 0x84, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x0b, 0x00,
+  0x13, 0x00, 0x1b, 0x00, 0x4b, 0x00, 0x6f, 0x00, 0x78, 0x00, 0x80, 0x00,
+  0x00, 0x00, 0x06, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x14, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x14, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x38, 0x00, 0x41, 0x00, 0x4b, 0x00, 0x74, 0x00,
+  0x7e, 0x00, 0x86, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x2f, 0x00, 0x37, 0x00,
+  0x43, 0x00, 0x4b, 0x00, 0x56, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x16, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x15, 0x00, 0x3e, 0x00, 0x4d, 0x00, 0x59, 0x00,
+  0x62, 0x00, 0x6b, 0x00, 0x70, 0x00, 0x00, 0x00, 0x23, 0x00, 0x2a, 0x00,
+  0x31, 0x00, 0x3c, 0x00, 0x47, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x1f, 0x00,
+  0x3c, 0x00, 0x6e, 0x00, 0x75, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x22, 0x00,
+  0x2b, 0x00, 0x5c, 0x00, 0x65, 0x00, 0x7c, 0x00, 0x88, 0x00, 0xba, 0x00,
+  0xc6, 0x00, 0xd2, 0x00, 0x00, 0x00, 0x23, 0x00, 0x3a, 0x00, 0x44, 0x00,
+  0x51, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x33, 0x00, 0x49, 0x00, 0x63, 0x00,
+  0x7e, 0x00, 0x87, 0x00, 0x95, 0x00, 0x9e, 0x00, 0xa7, 0x00, 0xb0, 0x00,
+  0xbe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x48, 0x00, 0x52, 0x00,
+  0x5d, 0x00, 0x6a, 0x00, 0x00, 0x00, 0x08, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x18, 0x00, 0x21, 0x00, 0x35, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x11, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x18, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0e, 0x00, 0x16, 0x00, 0x00, 0x00,
+  0x1a, 0x00, 0x22, 0x00, 0x31, 0x00, 0x3a, 0x00, 0x43, 0x00, 0x4a, 0x00,
+  0x53, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x14, 0x00, 0x2a, 0x00,
+  0x47, 0x00, 0x62, 0x00, 0x67, 0x00, 0x70, 0x00, 0x83, 0x00, 0x98, 0x00,
+  0xad, 0x00, 0xc4, 0x00, 0x00, 0x00, 0x16, 0x00, 0x2d, 0x00, 0x34, 0x00,
+  0x40, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x13, 0x00, 0x19, 0x00,
+  0x1f, 0x00, 0x25, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x19, 0x00, 0x24, 0x00,
+  0x2a, 0x00, 0x00, 0x00, 0x20, 0x00, 0x28, 0x00, 0x30, 0x00, 0x36, 0x00,
+  0x3c, 0x00, 0x42, 0x00, 0x4a, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x38, 0x00,
+  0x53, 0x00, 0x5b, 0x00, 0x63, 0x00, 0x6b, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x11, 0x00, 0x17, 0x00, 0x1f, 0x00, 0x25, 0x00, 0x00, 0x00, 0x07, 0x00,
+  0x11, 0x00, 0x18, 0x00, 0x00, 0x00, 0x08, 0x00, 0x2c, 0x00, 0x34, 0x00,
+  0x45, 0x00, 0x54, 0x00, 0x6b, 0x00, 0x00, 0x00, 0x22, 0x00, 0x40, 0x00,
+  0x55, 0x00, 0x5e, 0x00, 0x69, 0x00, 0x70, 0x00, 0x8e, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x14, 0x00, 0x28, 0x00, 0x44, 0x00, 0x4e, 0x00, 0x56, 0x00,
+  0x60, 0x00, 0x00, 0x00, 0x25, 0x00, 0x60, 0x00, 0x71, 0x00, 0x8d, 0x00,
+  0xb5, 0x00, 0xc2, 0x00, 0xcb, 0x00, 0xd1, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x14, 0x00, 0x2c, 0x00, 0x39, 0x00, 0x57, 0x00, 0x62, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x19, 0x00, 0x51, 0x00, 0x59, 0x00, 0x00, 0x00, 0x0a, 0x00,
+  0x17, 0x00, 0x00, 0x00, 0x16, 0x00, 0x2f, 0x00, 0x47, 0x00, 0x6c, 0x00,
+  0x75, 0x00, 0x7c, 0x00, 0x83, 0x00, 0x92, 0x00, 0xa3, 0x00, 0xbc, 0x00,
+  0xd2, 0x00, 0xf1, 0x00, 0x00, 0x00, 0x14, 0x00, 0x1f, 0x00, 0x2d, 0x00,
+  0x3a, 0x00, 0x40, 0x00, 0x46, 0x00, 0x00, 0x00, 0x18, 0x00, 0x21, 0x00,
+  0x00, 0x00, 0x18, 0x00, 0x31, 0x00, 0x3a, 0x00, 0x44, 0x00, 0x4e, 0x00,
+  0x55, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x1d, 0x00, 0x27, 0x00, 0x00, 0x00, 0x10, 0x00, 0x1e, 0x00, 0x3c, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x27, 0x00, 0x39, 0x00, 0x42, 0x00,
+  0x4c, 0x00, 0x58, 0x00, 0x6d, 0x00, 0x83, 0x00, 0x9c, 0x00, 0xb8, 0x00,
+  0xd8, 0x00, 0x00, 0x00, 0x10, 0x00, 0x30, 0x00, 0x39, 0x00, 0x44, 0x00,
+  0x56, 0x00, 0x62, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x2b, 0x00,
+  0x43, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0e, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x10, 0x00, 0x1d, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x20, 0x00, 0x2e, 0x00, 0x48, 0x00,
+  0x65, 0x00, 0x7b, 0x00, 0x80, 0x00, 0x85, 0x00, 0x8a, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x17, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x17, 0x00, 0x24, 0x00,
+  0x2c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x1f, 0x00, 0x34, 0x00, 0x3c, 0x00,
+  0x44, 0x00, 0x51, 0x00, 0x56, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x5f, 0x00,
+  0x72, 0x00, 0x7a, 0x00, 0x87, 0x00, 0x8f, 0x00, 0x97, 0x00, 0x9f, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x18, 0x00, 0x22, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x12, 0x00, 0x30, 0x00, 0x39, 0x00, 0x41, 0x00, 0x47, 0x00, 0x4e, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x13, 0x00, 0x1a, 0x00, 0x24, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x38, 0x00, 0x42, 0x00, 0x6c, 0x00, 0x74, 0x00, 0x7c, 0x00,
+  0x84, 0x00, 0x8d, 0x00, 0x95, 0x00, 0x9d, 0x00, 0xa5, 0x00, 0xb0, 0x00,
+  0xc3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x15, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x2d, 0x00,
+  0x4c, 0x00, 0x5f, 0x00, 0x7f, 0x00, 0x98, 0x00, 0xc2, 0x00, 0xea, 0x00,
+  0x20, 0x01, 0x37, 0x01, 0x4c, 0x01, 0x66, 0x01, 0x8f, 0x01, 0xd0, 0x01,
+  0x12, 0x02, 0x25, 0x02, 0x48, 0x02, 0x60, 0x02, 0x6a, 0x02, 0x00, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x16, 0x00, 0x00, 0x00, 0x18, 0x00,
+  0x30, 0x00, 0x37, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x36, 0x00,
+  0x47, 0x00, 0x52, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x28, 0x00, 0x31, 0x00,
+  0x00, 0x00, 0x18, 0x00, 0x32, 0x00, 0x3c, 0x00, 0x69, 0x00, 0xad, 0x00,
+  0xb7, 0x00, 0x00, 0x00, 0x15, 0x00, 0x2c, 0x00, 0x39, 0x00, 0x44, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x22, 0x00, 0x2c, 0x00, 0x34, 0x00, 0x4d, 0x00,
+  0x59, 0x00, 0x62, 0x00, 0x00, 0x00, 0x10, 0x00, 0x27, 0x00, 0x36, 0x00,
+  0x5e, 0x00, 0x82, 0x00, 0x92, 0x00, 0x99, 0x00, 0xa2, 0x00, 0xa8, 0x00,
+  0xb8, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x36, 0x00, 0x45, 0x00, 0x4d, 0x00,
+  0x00, 0x00, 0x14, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x14, 0x00, 0x2a, 0x00,
+  0x33, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x14, 0x00, 0x23, 0x00,
+  0x00, 0x00, 0x0a, 0x00, 0x15, 0x00, 0x32, 0x00, 0x3e, 0x00, 0x00, 0x00,
+  0x1f, 0x00, 0x28, 0x00, 0x35, 0x00, 0x57, 0x00, 0x5f, 0x00, 0x67, 0x00,
+  0x00, 0x00, 0x18, 0x00, 0x24, 0x00, 0x2d, 0x00, 0x35, 0x00, 0x41, 0x00,
+  0x00, 0x00, 0x27, 0x00, 0x33, 0x00, 0x3c, 0x00, 0x45, 0x00, 0x50, 0x00,
+  0x5c, 0x00, 0x67, 0x00, 0x72, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x42, 0x00,
+  0x4d, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x45, 0x00, 0x68, 0x00, 0x88, 0x00,
+  0x94, 0x00, 0xb1, 0x00, 0xc6, 0x00, 0xdf, 0x00, 0xec, 0x00, 0xf1, 0x00,
+  0x06, 0x01, 0x00, 0x00, 0x12, 0x00, 0x1a, 0x00, 0x22, 0x00, 0x2c, 0x00,
+  0x59, 0x00, 0x67, 0x00, 0x73, 0x00, 0x80, 0x00, 0x87, 0x00, 0x93, 0x00,
+  0x9d, 0x00, 0xaa, 0x00, 0xb6, 0x00, 0xbc, 0x00, 0xc2, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x1d, 0x00, 0x26, 0x00, 0x00, 0x00, 0x19, 0x00, 0x2d, 0x00,
+  0x45, 0x00, 0x53, 0x00, 0x67, 0x00, 0x71, 0x00, 0x7d, 0x00, 0x83, 0x00,
+  0x00, 0x00, 0x1b, 0x00, 0x3b, 0x00, 0x44, 0x00, 0x4c, 0x00, 0x54, 0x00,
+  0x5c, 0x00, 0x62, 0x00, 0x00, 0x00, 0x24, 0x00, 0x2c, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x16, 0x00, 0x27, 0x00, 0x2e, 0x00, 0x39, 0x00, 0x40, 0x00,
+  0x47, 0x00, 0x50, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x2d, 0x00, 0x4b, 0x00,
+  0x53, 0x00, 0x62, 0x00, 0x68, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x18, 0x00,
+  0x3b, 0x00, 0x00, 0x00, 0x15, 0x00, 0x22, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x0e, 0x00, 0x17, 0x00, 0x23, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x17, 0x00, 0x1e, 0x00, 0x28, 0x00, 0x00, 0x00, 0x13, 0x00, 0x28, 0x00,
+  0x4b, 0x00, 0x00, 0x00, 0x11, 0x00, 0x25, 0x00, 0x30, 0x00, 0x3c, 0x00,
+  0x48, 0x00, 0x00, 0x00, 0x16, 0x00, 0x22, 0x00, 0x2e, 0x00, 0x36, 0x00,
+  0x3c, 0x00, 0x48, 0x00, 0x56, 0x00, 0x5e, 0x00, 0x64, 0x00, 0x72, 0x00,
+  0x00, 0x00, 0x16, 0x00, 0x4d, 0x00, 0x56, 0x00, 0x00, 0x00, 0x08, 0x00,
+  0x2f, 0x00, 0x5e, 0x00, 0x69, 0x00, 0x87, 0x00, 0x90, 0x00, 0x97, 0x00,
+  0x9c, 0x00, 0xa1, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x11, 0x00,
+  0x18, 0x00, 0x23, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x1f, 0x00, 0x28, 0x00,
+  0x00, 0x00, 0x1a, 0x00, 0x39, 0x00, 0x61, 0x00, 0x69, 0x00, 0x6f, 0x00,
+  0x78, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x14, 0x00, 0x23, 0x00, 0x34, 0x00,
+  0x4d, 0x00, 0x79, 0x00, 0x82, 0x00, 0x8a, 0x00, 0x95, 0x00, 0x00, 0x00,
+  0x16, 0x00, 0x29, 0x00, 0x36, 0x00, 0x40, 0x00, 0x00, 0x00, 0x13, 0x00,
+  0x1b, 0x00, 0x37, 0x00, 0x43, 0x00, 0x4d, 0x00, 0x57, 0x00, 0x5d, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x31, 0x00, 0x4d, 0x00, 0x78, 0x00, 0x7f, 0x00,
+  0x8a, 0x00, 0x93, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x1c, 0x00, 0x27, 0x00,
+  0x2f, 0x00, 0x37, 0x00, 0x3e, 0x00, 0x45, 0x00, 0x00, 0x00, 0x16, 0x00,
+  0x27, 0x00, 0x49, 0x00, 0x00, 0x00, 0x12, 0x00, 0x24, 0x00, 0x2e, 0x00,
+  0x36, 0x00, 0x40, 0x00, 0x4e, 0x00, 0x5f, 0x00, 0x6d, 0x00, 0x73, 0x00,
+  0x7b, 0x00, 0x83, 0x00, 0x8c, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x2c, 0x00,
+  0x3e, 0x00, 0x45, 0x00, 0x64, 0x00, 0x79, 0x00, 0x8f, 0x00, 0x95, 0x00,
+  0x9c, 0x00, 0xa6, 0x00, 0xac, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x1c, 0x00,
+  0x2a, 0x00, 0x34, 0x00, 0x3e, 0x00, 0x44, 0x00, 0x4c, 0x00, 0x56, 0x00,
+  0x00, 0x00, 0x18, 0x00, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x00,
+  0x21, 0x00, 0x2a, 0x00, 0x42, 0x00, 0x53, 0x00, 0x5f, 0x00, 0x68, 0x00,
+  0x71, 0x00, 0x7a, 0x00, 0x81, 0x00, 0x87, 0x00, 0x8e, 0x00, 0x00, 0x00,
+  0x16, 0x00, 0x34, 0x00, 0x5d, 0x00, 0x6a, 0x00, 0x9d, 0x00, 0xa6, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x1e, 0x00, 0x38, 0x00, 0x41, 0x00, 0x4a, 0x00,
+  0x53, 0x00, 0x5a, 0x00, 0x63, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x15, 0x00,
+  0x1e, 0x00, 0x00, 0x00, 0x19, 0x00, 0x22, 0x00, 0x29, 0x00, 0x32, 0x00,
+  0x00, 0x00, 0x16, 0x00, 0x2a, 0x00, 0x36, 0x00, 0x3f, 0x00, 0x46, 0x00,
+  0x4f, 0x00, 0x00, 0x00, 0x17, 0x00, 0x2f, 0x00, 0x4f, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x1a, 0x00, 0x25, 0x00, 0x2f, 0x00, 0x39, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x21, 0x00, 0x2a, 0x00, 0x33, 0x00, 0x38, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x11, 0x00, 0x1b, 0x00, 0x24, 0x00, 0x2c, 0x00,
+  0x35, 0x00, 0x3f, 0x00, 0x45, 0x00, 0x56, 0x00, 0x00, 0x00, 0x1d, 0x00,
+  0x26, 0x00, 0x2e, 0x00, 0x50, 0x00, 0x58, 0x00, 0x61, 0x00, 0x00, 0x00,
+  0x16, 0x00, 0x2e, 0x00, 0x4e, 0x00, 0x6d, 0x00, 0x76, 0x00, 0x7d, 0x00,
+  0x8b, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x28, 0x00, 0x33, 0x00, 0x39, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x28, 0x00, 0x30, 0x00, 0x3f, 0x00, 0x73, 0x00,
+  0x80, 0x00, 0x88, 0x00, 0x00, 0x00, 0x08, 0x00, 0x32, 0x00, 0x3a, 0x00,
+  0x41, 0x00, 0x49, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x49, 0x00, 0x51, 0x00,
+  0x5a, 0x00, 0x00, 0x00, 0x08, 0x00, 0x11, 0x00, 0x19, 0x00, 0x21, 0x00,
+  0x29, 0x00, 0x2f, 0x00, 0x35, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1c, 0x00,
+  0x25, 0x00, 0x33, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x27, 0x00, 0x2e, 0x00,
+  0x00, 0x00, 0x18, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x2b, 0x00,
+  0x35, 0x00, 0x3e, 0x00, 0x49, 0x00, 0x54, 0x00, 0x00, 0x00, 0x0f, 0x00,
+  0x1e, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x07, 0x00, 0x19, 0x00,
+  0x20, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x09, 0x00, 0x2d, 0x00, 0x39, 0x00,
+  0x41, 0x00, 0x50, 0x00, 0x59, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x17, 0x00,
+  0x20, 0x00, 0x29, 0x00, 0x32, 0x00, 0x00, 0x00, 0x14, 0x00, 0x20, 0x00,
+  0x2a, 0x00, 0x34, 0x00, 0x40, 0x00, 0x00, 0x00, 0x13, 0x00, 0x22, 0x00,
+  0x28, 0x00, 0x31, 0x00, 0x00, 0x00, 0x14, 0x00, 0x1c, 0x00, 0x2f, 0x00,
+  0x3d, 0x00, 0x49, 0x00, 0x4f, 0x00, 0x00, 0x00, 0x15, 0x00, 0x20, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x13, 0x00, 0x25, 0x00, 0x36, 0x00,
+  0x48, 0x00, 0x5a, 0x00, 0x64, 0x00, 0x7e, 0x00, 0x85, 0x00, 0x8a, 0x00,
+  0x9e, 0x00, 0xb4, 0x00, 0xcb, 0x00, 0xe6, 0x00, 0xfc, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x2d, 0x00,
+  0x36, 0x00, 0x3f, 0x00, 0x4b, 0x00, 0x51, 0x00, 0x59, 0x00, 0x00, 0x00,
+  0x16, 0x00, 0x3c, 0x00, 0x44, 0x00, 0x4e, 0x00, 0x56, 0x00, 0x5e, 0x00,
+  0x00, 0x00, 0x22, 0x00, 0x32, 0x00, 0x39, 0x00, 0x3f, 0x00, 0x45, 0x00,
+  0x00, 0x00, 0x0f, 0x00, 0x1e, 0x00, 0x28, 0x00, 0x35, 0x00, 0x3f, 0x00,
+  0x00, 0x00, 0x0f, 0x00, 0x18, 0x00, 0x21, 0x00, 0x2c, 0x00, 0x38, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x16, 0x00, 0x1f, 0x00, 0x2a, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x23, 0x00, 0x2f, 0x00, 0x38, 0x00, 0x3e, 0x00, 0x00, 0x00,
+  0x1b, 0x00, 0x23, 0x00, 0x2c, 0x00, 0x46, 0x00, 0x50, 0x00, 0x5f, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x18, 0x00, 0x24, 0x00, 0x32, 0x00,
+  0x39, 0x00, 0x00, 0x00, 0x08, 0x00, 0x10, 0x00, 0x18, 0x00, 0x20, 0x00,
+  0x28, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x26, 0x00, 0x2f, 0x00, 0x3e, 0x00,
+  0x4d, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x26, 0x00, 0x2f, 0x00, 0x3b, 0x00,
+  0x43, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x16, 0x00, 0x4f, 0x00, 0x5a, 0x00,
+  0x66, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x29, 0x00, 0x31, 0x00,
+  0x3b, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x4c, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x2e, 0x00, 0x37, 0x00, 0x45, 0x00, 0x00, 0x00,
+  0x22, 0x00, 0x2c, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x00,
+  0x16, 0x00, 0x21, 0x00, 0x00, 0x00, 0x09, 0x00, 0x17, 0x00, 0x1e, 0x00,
+  0x28, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x09, 0x00, 0x13, 0x00,
+  0x1d, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x17, 0x00, 0x3f, 0x00, 0x49, 0x00,
+  0x56, 0x00, 0x5e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x1b, 0x00, 0x3f, 0x00,
+  0x5c, 0x00, 0x66, 0x00, 0x74, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x14, 0x00,
+  0x1c, 0x00, 0x28, 0x00, 0x30, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x33, 0x00,
+  0x3f, 0x00, 0x48, 0x00, 0x00, 0x00, 0x09, 0x00, 0x30, 0x00, 0x3a, 0x00,
+  0x43, 0x00, 0x4c, 0x00, 0x56, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x25, 0x00,
+  0x30, 0x00, 0x00, 0x00, 0x24, 0x00, 0x36, 0x00, 0x3e, 0x00, 0x56, 0x00,
+  0x6c, 0x00, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x33, 0x00,
+  0x60, 0x00, 0x89, 0x00, 0x95, 0x00, 0xcf, 0x00, 0xd5, 0x00, 0xe1, 0x00,
+  0xea, 0x00, 0xf1, 0x00, 0x00, 0x00, 0x10, 0x00, 0x27, 0x00, 0x52, 0x00,
+  0x80, 0x00, 0xc6, 0x00, 0xef, 0x00, 0x39, 0x01, 0x66, 0x01, 0x6d, 0x01,
+  0x76, 0x01, 0x82, 0x01, 0x8c, 0x01, 0x92, 0x01, 0x00, 0x00, 0x0b, 0x00,
+  0x3b, 0x00, 0x64, 0x00, 0x6f, 0x00, 0x7a, 0x00, 0x89, 0x00, 0x94, 0x00,
+  0x9f, 0x00, 0xa9, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x2b, 0x00, 0x4a, 0x00,
+  0x53, 0x00, 0x73, 0x00, 0x7b, 0x00, 0x00, 0x00, 0x07, 0x00, 0x10, 0x00,
+  0x1a, 0x00, 0x24, 0x00, 0x31, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x20, 0x00,
+  0x2a, 0x00, 0x55, 0x00, 0x7f, 0x00, 0x9f, 0x00, 0xaa, 0x00, 0xb2, 0x00,
+  0xba, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x15, 0x00, 0x20, 0x00, 0x38, 0x00,
+  0x42, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x14, 0x00, 0x1d, 0x00, 0x27, 0x00,
+  0x32, 0x00, 0x3c, 0x00, 0x49, 0x00, 0x55, 0x00, 0x5e, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x13, 0x00, 0x20, 0x00, 0x28, 0x00, 0x30, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x39, 0x00, 0x45, 0x00, 0x52, 0x00, 0x5c, 0x00, 0x64, 0x00,
+  0x70, 0x00, 0x7a, 0x00, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00,
+  0x36, 0x00, 0x42, 0x00, 0x00, 0x00, 0x11, 0x00, 0x1e, 0x00, 0x27, 0x00,
+  0x2e, 0x00, 0x38, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x17, 0x00, 0x1f, 0x00,
+  0x2c, 0x00, 0x37, 0x00, 0x41, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x15, 0x00,
+  0x1e, 0x00, 0x28, 0x00, 0x2e, 0x00, 0x39, 0x00, 0x44, 0x00, 0x4c, 0x00,
+  0x54, 0x00, 0x00, 0x00, 0x13, 0x00, 0x41, 0x00, 0x7e, 0x00, 0x8c, 0x00,
+  0x96, 0x00, 0x9e, 0x00, 0xae, 0x00, 0x00, 0x00, 0x14, 0x00, 0x1c, 0x00,
+  0x40, 0x00, 0x4b, 0x00, 0x55, 0x00, 0x5c, 0x00, 0x65, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x26, 0x00, 0x33, 0x00, 0x5b, 0x00, 0x79, 0x00, 0x85, 0x00,
+  0x90, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x38, 0x00,
+  0x6c, 0x00, 0x97, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x26, 0x00,
+  0x2d, 0x00, 0x36, 0x00, 0x3d, 0x00, 0x44, 0x00, 0x00, 0x00, 0x1b, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x28, 0x00, 0x55, 0x00,
+  0x61, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x31, 0x00, 0x37, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x07, 0x00, 0x0e, 0x00,
+  0x18, 0x00, 0x2c, 0x00, 0x42, 0x00, 0x5d, 0x00, 0x74, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x2c, 0x00,
+  0x35, 0x00, 0x3b, 0x00, 0x44, 0x00, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x17, 0x00, 0x20, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x16, 0x00,
+  0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x0f, 0x00, 0x15, 0x00,
+  0x00, 0x00, 0x18, 0x00, 0x21, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x30, 0x00, 0x3d, 0x00, 0x4a, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x18, 0x00, 0x00, 0x00,
+  0x22, 0x00, 0x33, 0x00, 0x3c, 0x00, 0x45, 0x00, 0x4c, 0x00, 0x55, 0x00,
+  0x5c, 0x00, 0x00, 0x00, 0x11, 0x00, 0x1c, 0x00, 0x2a, 0x00, 0x5e, 0x00,
+  0x69, 0x00, 0x76, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x2a, 0x00, 0x33, 0x00,
+  0x3c, 0x00, 0x45, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x29, 0x00, 0x38, 0x00,
+  0x42, 0x00, 0x4d, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x18, 0x00, 0x4c, 0x00,
+  0x75, 0x00, 0x8b, 0x00, 0x94, 0x00, 0xa5, 0x00, 0xae, 0x00, 0xb6, 0x00,
+  0xbf, 0x00, 0xc7, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x36, 0x00, 0x64, 0x00,
+  0x6f, 0x00, 0x7a, 0x00, 0x86, 0x00, 0x8f, 0x00, 0x95, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x09, 0x00, 0x12, 0x00,
+  0x1b, 0x00, 0x24, 0x00, 0x30, 0x00, 0x00, 0x00, 0x07, 0x00, 0x13, 0x00,
+  0x1c, 0x00, 0x25, 0x00, 0x00, 0x00, 0x09, 0x00, 0x35, 0x00, 0x00, 0x00,
+  0x18, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x39, 0x00, 0x00, 0x00, 0x26, 0x00,
+  0x2d, 0x00, 0x39, 0x00, 0x40, 0x00, 0x47, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x28, 0x00, 0x54, 0x00, 0x5e, 0x00, 0x65, 0x00, 0x6d, 0x00, 0x75, 0x00,
+  0x7c, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x3c, 0x00, 0x45, 0x00, 0x4e, 0x00,
+  0x00, 0x00, 0x0f, 0x00, 0x3c, 0x00, 0x45, 0x00, 0x4e, 0x00, 0x56, 0x00,
+  0x5f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x2e, 0x00, 0x3d, 0x00, 0x4c, 0x00, 0x7c, 0x00, 0x85, 0x00, 0x94, 0x00,
+  0x9d, 0x00, 0x00, 0x00, 0x12, 0x00, 0x1b, 0x00, 0x24, 0x00, 0x2b, 0x00,
+  0x00, 0x00, 0x2a, 0x00, 0x4f, 0x00, 0x5f, 0x00, 0x7c, 0x00, 0x8c, 0x00,
+  0x00, 0x00, 0x21, 0x00, 0x31, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x17, 0x00,
+  0x1f, 0x00, 0x29, 0x00, 0x32, 0x00, 0x3c, 0x00, 0x44, 0x00, 0x4e, 0x00,
+  0x54, 0x00, 0x00, 0x00, 0x18, 0x00, 0x20, 0x00, 0x28, 0x00, 0x30, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00,
+  0x1e, 0x00, 0x2e, 0x00, 0x48, 0x00, 0x56, 0x00, 0x5e, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x2b, 0x00, 0x34, 0x00, 0x3f, 0x00, 0x45, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x22, 0x00, 0x28, 0x00, 0x37, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x15, 0x00, 0x24, 0x00, 0x2f, 0x00, 0x62, 0x00, 0x72, 0x00, 0x7c, 0x00,
+  0x86, 0x00, 0x90, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x2f, 0x00, 0x4d, 0x00,
+  0x58, 0x00, 0x5f, 0x00, 0x69, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x32, 0x00, 0x00, 0x00, 0x10, 0x00, 0x23, 0x00, 0x2e, 0x00,
+  0x37, 0x00, 0x44, 0x00, 0x00, 0x00, 0x18, 0x00, 0x37, 0x00, 0x40, 0x00,
+  0x49, 0x00, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x2e, 0x00, 0x4b, 0x00, 0x62, 0x00, 0x79, 0x00, 0x94, 0x00,
+  0xaf, 0x00, 0xcc, 0x00, 0xe7, 0x00, 0x00, 0x01, 0x08, 0x01, 0x14, 0x01,
+  0x1a, 0x01, 0x00, 0x00, 0x12, 0x00, 0x1b, 0x00, 0x26, 0x00, 0x4c, 0x00,
+  0x00, 0x00, 0x1d, 0x00, 0x2c, 0x00, 0x34, 0x00, 0x00, 0x00, 0x0d, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x1d, 0x00, 0x26, 0x00, 0x2d, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x2a, 0x00, 0x3c, 0x00, 0x5e, 0x00, 0x7c, 0x00, 0x92, 0x00,
+  0xa7, 0x00, 0xc4, 0x00, 0xce, 0x00, 0xe6, 0x00, 0x01, 0x01, 0x18, 0x01,
+  0x1f, 0x01, 0x24, 0x01, 0x00, 0x00, 0x13, 0x00, 0x27, 0x00, 0x3a, 0x00,
+  0x5d, 0x00, 0x81, 0x00, 0x00, 0x00, 0x15, 0x00, 0x23, 0x00, 0x34, 0x00,
+  0x55, 0x00, 0x60, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x2b, 0x00, 0x3d, 0x00,
+  0x4c, 0x00, 0x5a, 0x00, 0x63, 0x00, 0x6b, 0x00, 0x74, 0x00, 0x7e, 0x00,
+  0x00, 0x00, 0x14, 0x00, 0x28, 0x00, 0x37, 0x00, 0x53, 0x00, 0x76, 0x00,
+  0x7f, 0x00, 0x8a, 0x00, 0xc4, 0x00, 0xcd, 0x00, 0xe7, 0x00, 0xef, 0x00,
+  0x00, 0x00, 0x0f, 0x00, 0x25, 0x00, 0x3a, 0x00, 0x5f, 0x00, 0x82, 0x00,
+  0x9a, 0x00, 0xa2, 0x00, 0xa8, 0x00, 0xae, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x24, 0x00, 0x3b, 0x00, 0x57, 0x00, 0x82, 0x00, 0x9f, 0x00, 0xad, 0x00,
+  0xd7, 0x00, 0x00, 0x00, 0x17, 0x00, 0x27, 0x00, 0x37, 0x00, 0x47, 0x00,
+  0x65, 0x00, 0x00, 0x00, 0x15, 0x00, 0x27, 0x00, 0x3f, 0x00, 0x4e, 0x00,
+  0x53, 0x00, 0x5c, 0x00, 0x64, 0x00, 0x6f, 0x00, 0x77, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x19, 0x00, 0x28, 0x00, 0x2f, 0x00, 0x36, 0x00, 0x4a, 0x00,
+  0x53, 0x00, 0x5c, 0x00, 0x66, 0x00, 0x6d, 0x00, 0x79, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x21, 0x00, 0x35, 0x00, 0x46, 0x00, 0x51, 0x00, 0x5a, 0x00,
+  0x64, 0x00, 0x8a, 0x00, 0x93, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x18, 0x00,
+  0x2b, 0x00, 0x40, 0x00, 0x4d, 0x00, 0x59, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x20, 0x00, 0x44, 0x00, 0x6d, 0x00, 0x80, 0x00, 0x87, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x24, 0x00, 0x59, 0x00, 0x77, 0x00, 0xa4, 0x00, 0xb6, 0x00,
+  0xc4, 0x00, 0xcd, 0x00, 0xd6, 0x00, 0x00, 0x00, 0x13, 0x00, 0x24, 0x00,
+  0x32, 0x00, 0x3f, 0x00, 0x4b, 0x00, 0x56, 0x00, 0x63, 0x00, 0x6e, 0x00,
+  0x7b, 0x00, 0x00, 0x00, 0x12, 0x00, 0x1f, 0x00, 0x50, 0x00, 0x5c, 0x00,
+  0x67, 0x00, 0x74, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x2b, 0x00, 0x43, 0x00,
+  0x57, 0x00, 0x69, 0x00, 0x70, 0x00, 0x77, 0x00, 0x7c, 0x00, 0x89, 0x00,
+  0x00, 0x00, 0x16, 0x00, 0x2b, 0x00, 0x46, 0x00, 0x6c, 0x00, 0x7f, 0x00,
+  0x86, 0x00, 0x00, 0x00, 0x20, 0x00, 0x30, 0x00, 0x43, 0x00, 0x58, 0x00,
+  0x68, 0x00, 0x7d, 0x00, 0x89, 0x00, 0x93, 0x00, 0x00, 0x00, 0x21, 0x00,
+  0x2e, 0x00, 0x40, 0x00, 0x52, 0x00, 0x5f, 0x00, 0x70, 0x00, 0x82, 0x00,
+  0x93, 0x00, 0xa2, 0x00, 0xcf, 0x00, 0xf1, 0x00, 0xf9, 0x00, 0x26, 0x01,
+  0x2c, 0x01, 0x38, 0x01, 0x41, 0x01, 0x4c, 0x01, 0x54, 0x01, 0x5a, 0x01,
+  0x60, 0x01, 0x00, 0x00, 0x23, 0x00, 0x33, 0x00, 0x47, 0x00, 0x63, 0x00,
+  0x71, 0x00, 0x96, 0x00, 0x9e, 0x00, 0xa9, 0x00, 0x00, 0x00, 0x15, 0x00,
+  0x22, 0x00, 0x31, 0x00, 0x4a, 0x00, 0x5f, 0x00, 0x75, 0x00, 0x83, 0x00,
+  0x8e, 0x00, 0x94, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1c, 0x00, 0x2b, 0x00,
+  0x3a, 0x00, 0x5d, 0x00, 0x6c, 0x00, 0x74, 0x00, 0x7c, 0x00, 0x00, 0x00,
+  0x24, 0x00, 0x32, 0x00, 0x49, 0x00, 0x59, 0x00, 0x7d, 0x00, 0x87, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x28, 0x00, 0x38, 0x00, 0x44, 0x00, 0x5a, 0x00,
+  0x7a, 0x00, 0x84, 0x00, 0xa7, 0x00, 0xb7, 0x00, 0x00, 0x00, 0x0b, 0x00,
+  0x1b, 0x00, 0x36, 0x00, 0x43, 0x00, 0x6d, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x1f, 0x00, 0x30, 0x00, 0x4b, 0x00, 0x6d, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x1d, 0x00, 0x33, 0x00, 0x40, 0x00, 0x5a, 0x00, 0x7b, 0x00, 0x97, 0x00,
+  0xa0, 0x00, 0xa6, 0x00, 0xb0, 0x00, 0x00, 0x00, 0x26, 0x00, 0x41, 0x00,
+  0x56, 0x00, 0x6b, 0x00, 0x7d, 0x00, 0x00, 0x00, 0x30, 0x00, 0x55, 0x00,
+  0x69, 0x00, 0x83, 0x00, 0x9d, 0x00, 0xb5, 0x00, 0xba, 0x00, 0xc1, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x27, 0x00, 0x47, 0x00, 0x61, 0x00, 0x8d, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x20, 0x00, 0x39, 0x00, 0x51, 0x00, 0x68, 0x00,
+  0x6e, 0x00, 0x00, 0x00, 0x15, 0x00, 0x26, 0x00, 0x37, 0x00, 0x44, 0x00,
+  0x53, 0x00, 0x68, 0x00, 0x7d, 0x00, 0x90, 0x00, 0xbd, 0x00, 0xc8, 0x00,
+  0xd3, 0x00, 0xd9, 0x00, 0xe2, 0x00, 0xeb, 0x00, 0xf2, 0x00, 0xf7, 0x00,
+  0x00, 0x00, 0x13, 0x00, 0x28, 0x00, 0x3b, 0x00, 0x48, 0x00, 0x56, 0x00,
+  0x69, 0x00, 0x8e, 0x00, 0xa5, 0x00, 0xb0, 0x00, 0xce, 0x00, 0xd5, 0x00,
+  0xe0, 0x00, 0xea, 0x00, 0xef, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x36, 0x00,
+  0x56, 0x00, 0x70, 0x00, 0x8e, 0x00, 0x9f, 0x00, 0xbd, 0x00, 0xd6, 0x00,
+  0xe5, 0x00, 0xf4, 0x00, 0x02, 0x01, 0x0f, 0x01, 0x2b, 0x01, 0x43, 0x01,
+  0x54, 0x01, 0x00, 0x00, 0x1a, 0x00, 0x41, 0x00, 0x4f, 0x00, 0x5c, 0x00,
+  0x7b, 0x00, 0x90, 0x00, 0xa5, 0x00, 0xb5, 0x00, 0xba, 0x00, 0x00, 0x00,
+  0x18, 0x00, 0x30, 0x00, 0x4d, 0x00, 0x64, 0x00, 0x80, 0x00, 0x96, 0x00,
+  0xb1, 0x00, 0xc2, 0x00, 0xd6, 0x00, 0xea, 0x00, 0xf9, 0x00, 0x13, 0x01,
+  0x1f, 0x01, 0x3d, 0x01, 0x51, 0x01, 0x59, 0x01, 0x88, 0x01, 0x90, 0x01,
+  0x98, 0x01, 0x9d, 0x01, 0x00, 0x00, 0x23, 0x00, 0x3b, 0x00, 0x4d, 0x00,
+  0x5f, 0x00, 0x71, 0x00, 0x88, 0x00, 0x9d, 0x00, 0xb9, 0x00, 0xc9, 0x00,
+  0xe0, 0x00, 0xe8, 0x00, 0xf0, 0x00, 0xf8, 0x00, 0x00, 0x01, 0x08, 0x01,
+  0x00, 0x00, 0x11, 0x00, 0x22, 0x00, 0x35, 0x00, 0x42, 0x00, 0x52, 0x00,
+  0x62, 0x00, 0x74, 0x00, 0x84, 0x00, 0x00, 0x00, 0x20, 0x00, 0x37, 0x00,
+  0x4a, 0x00, 0x58, 0x00, 0x65, 0x00, 0x72, 0x00, 0x80, 0x00, 0xa2, 0x00,
+  0xb1, 0x00, 0xbb, 0x00, 0xc8, 0x00, 0xe1, 0x00, 0x00, 0x00, 0x1a, 0x00,
+  0x2c, 0x00, 0x3c, 0x00, 0x51, 0x00, 0x61, 0x00, 0x77, 0x00, 0x88, 0x00,
+  0x97, 0x00, 0x9f, 0x00, 0xaa, 0x00, 0xb2, 0x00, 0xbc, 0x00, 0xc7, 0x00,
+  0xd1, 0x00, 0xda, 0x00, 0xe1, 0x00, 0x00, 0x00, 0x16, 0x00, 0x27, 0x00,
+  0x35, 0x00, 0x50, 0x00, 0x67, 0x00, 0x7e, 0x00, 0x8a, 0x00, 0x99, 0x00,
+  0x9f, 0x00, 0xb5, 0x00, 0xbe, 0x00, 0xc4, 0x00, 0x00, 0x00, 0x0b, 0x00,
+  0x22, 0x00, 0x30, 0x00, 0x41, 0x00, 0x58, 0x00, 0x6d, 0x00, 0x9c, 0x00,
+  0xc0, 0x00, 0xcd, 0x00, 0x00, 0x00, 0x12, 0x00, 0x20, 0x00, 0x31, 0x00,
+  0x45, 0x00, 0x5d, 0x00, 0x76, 0x00, 0x8f, 0x00, 0xa8, 0x00, 0xb4, 0x00,
+  0xbd, 0x00, 0x00, 0x00, 0x14, 0x00, 0x22, 0x00, 0x2d, 0x00, 0x39, 0x00,
+  0x4c, 0x00, 0x5a, 0x00, 0x66, 0x00, 0x8f, 0x00, 0x00, 0x00, 0x24, 0x00,
+  0x30, 0x00, 0x3b, 0x00, 0x4a, 0x00, 0x60, 0x00, 0x73, 0x00, 0x82, 0x00,
+  0x8b, 0x00, 0xa2, 0x00, 0xab, 0x00, 0xb6, 0x00, 0x00, 0x00, 0x1d, 0x00,
+  0x2f, 0x00, 0x3c, 0x00, 0x50, 0x00, 0x66, 0x00, 0x76, 0x00, 0x83, 0x00,
+  0x00, 0x00, 0x0f, 0x00, 0x1d, 0x00, 0x2c, 0x00, 0x3c, 0x00, 0x5f, 0x00,
+  0x6e, 0x00, 0x85, 0x00, 0xb7, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x30, 0x00,
+  0x40, 0x00, 0x50, 0x00, 0x5f, 0x00, 0x6e, 0x00, 0x7c, 0x00, 0x8e, 0x00,
+  0x95, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x55, 0x00, 0x65, 0x00, 0x7a, 0x00,
+  0xa4, 0x00, 0xbc, 0x00, 0xd7, 0x00, 0xe6, 0x00, 0x02, 0x01, 0x0e, 0x01,
+  0x00, 0x00, 0x28, 0x00, 0x3b, 0x00, 0x49, 0x00, 0x57, 0x00, 0x6b, 0x00,
+  0x7e, 0x00, 0x90, 0x00, 0x9b, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x21, 0x00,
+  0x3d, 0x00, 0x52, 0x00, 0x5d, 0x00, 0x6d, 0x00, 0x82, 0x00, 0x92, 0x00,
+  0x9d, 0x00, 0xbf, 0x00, 0xcd, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x2a, 0x00,
+  0x40, 0x00, 0x56, 0x00, 0x63, 0x00, 0x71, 0x00, 0x96, 0x00, 0xa8, 0x00,
+  0xd0, 0x00, 0xde, 0x00, 0xe5, 0x00, 0x00, 0x00, 0x20, 0x00, 0x36, 0x00,
+  0x4d, 0x00, 0x64, 0x00, 0x73, 0x00, 0x8d, 0x00, 0x9d, 0x00, 0xa5, 0x00,
+  0xad, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x51, 0x00, 0x60, 0x00, 0x79, 0x00,
+  0x9d, 0x00, 0xaf, 0x00, 0xd5, 0x00, 0x00, 0x00, 0x12, 0x00, 0x2c, 0x00,
+  0x3f, 0x00, 0x51, 0x00, 0x71, 0x00, 0x8f, 0x00, 0xaa, 0x00, 0xba, 0x00,
+  0xd5, 0x00, 0xdf, 0x00, 0xe9, 0x00, 0xef, 0x00, 0x00, 0x00, 0x11, 0x00,
+  0x21, 0x00, 0x34, 0x00, 0x49, 0x00, 0x5e, 0x00, 0x70, 0x00, 0x00, 0x00,
+  0x15, 0x00, 0x26, 0x00, 0x38, 0x00, 0x46, 0x00, 0x64, 0x00, 0x70, 0x00,
+  0x83, 0x00, 0x9f, 0x00, 0xa7, 0x00, 0xaf, 0x00, 0xb7, 0x00, 0xc0, 0x00,
+  0x00, 0x00, 0x1b, 0x00, 0x32, 0x00, 0x4c, 0x00, 0x5c, 0x00, 0x68, 0x00,
+  0x7d, 0x00, 0x00, 0x00, 0x15, 0x00, 0x27, 0x00, 0x3c, 0x00, 0x49, 0x00,
+  0x59, 0x00, 0x67, 0x00, 0x71, 0x00, 0x7a, 0x00, 0x84, 0x00, 0x90, 0x00,
+  0x9a, 0x00, 0xa2, 0x00, 0x00, 0x00, 0x16, 0x00, 0x24, 0x00, 0x30, 0x00,
+  0x3e, 0x00, 0x52, 0x00, 0x5e, 0x00, 0x67, 0x00, 0x72, 0x00, 0x7f, 0x00,
+  0x88, 0x00, 0x91, 0x00, 0x9a, 0x00, 0x00, 0x00, 0x14, 0x00, 0x21, 0x00,
+  0x2e, 0x00, 0x39, 0x00, 0x47, 0x00, 0x5b, 0x00, 0x71, 0x00, 0x79, 0x00,
+  0x81, 0x00, 0x89, 0x00, 0x93, 0x00, 0xb0, 0x00, 0xba, 0x00, 0xdd, 0x00,
+  0xe5, 0x00, 0xed, 0x00, 0xf5, 0x00, 0xfd, 0x00, 0x09, 0x01, 0x00, 0x00,
+  0x25, 0x00, 0x3d, 0x00, 0x67, 0x00, 0x75, 0x00, 0x93, 0x00, 0xa1, 0x00,
+  0xb3, 0x00, 0xc0, 0x00, 0xc8, 0x00, 0xd0, 0x00, 0xd8, 0x00, 0x00, 0x00,
+  0x27, 0x00, 0x3f, 0x00, 0x4e, 0x00, 0x7d, 0x00, 0x89, 0x00, 0x98, 0x00,
+  0xb4, 0x00, 0xc8, 0x00, 0xd0, 0x00, 0xdd, 0x00, 0x08, 0x01, 0x0e, 0x01,
+  0x17, 0x01, 0x20, 0x01, 0x00, 0x00, 0x28, 0x00, 0x3d, 0x00, 0x4a, 0x00,
+  0x7d, 0x00, 0x97, 0x00, 0xa5, 0x00, 0xb9, 0x00, 0xd6, 0x00, 0xe4, 0x00,
+  0x00, 0x00, 0x16, 0x00, 0x2b, 0x00, 0x5c, 0x00, 0x69, 0x00, 0x78, 0x00,
+  0x93, 0x00, 0xba, 0x00, 0xd2, 0x00, 0xdf, 0x00, 0xea, 0x00, 0xf1, 0x00,
+  0xf7, 0x00, 0x00, 0x00, 0x24, 0x00, 0x42, 0x00, 0x6c, 0x00, 0x88, 0x00,
+  0xad, 0x00, 0xd0, 0x00, 0xf1, 0x00, 0x14, 0x01, 0x33, 0x01, 0x4e, 0x01,
+  0x61, 0x01, 0x7d, 0x01, 0x99, 0x01, 0xb0, 0x01, 0xc1, 0x01, 0xd1, 0x01,
+  0xde, 0x01, 0x00, 0x00, 0x11, 0x00, 0x1e, 0x00, 0x38, 0x00, 0x4d, 0x00,
+  0x59, 0x00, 0x6a, 0x00, 0x81, 0x00, 0x8a, 0x00, 0xab, 0x00, 0xba, 0x00,
+  0xc6, 0x00, 0x00, 0x00, 0x21, 0x00, 0x3c, 0x00, 0x63, 0x00, 0x7c, 0x00,
+  0x9e, 0x00, 0xbe, 0x00, 0xdc, 0x00, 0xfc, 0x00, 0x19, 0x01, 0x31, 0x01,
+  0x43, 0x01, 0x57, 0x01, 0x69, 0x01, 0x81, 0x01, 0xa1, 0x01, 0xb1, 0x01,
+  0xba, 0x01, 0xc2, 0x01, 0xcb, 0x01, 0x00, 0x00, 0x21, 0x00, 0x31, 0x00,
+  0x3f, 0x00, 0x51, 0x00, 0x5e, 0x00, 0x6d, 0x00, 0x7d, 0x00, 0x84, 0x00,
+  0x00, 0x00, 0x13, 0x00, 0x21, 0x00, 0x52, 0x00, 0x60, 0x00, 0x72, 0x00,
+  0x80, 0x00, 0x94, 0x00, 0x9d, 0x00, 0xa7, 0x00, 0x00, 0x00, 0x13, 0x00,
+  0x2c, 0x00, 0x5f, 0x00, 0x71, 0x00, 0x89, 0x00, 0x99, 0x00, 0xa3, 0x00,
+  0x00, 0x00, 0x1e, 0x00, 0x31, 0x00, 0x4b, 0x00, 0x62, 0x00, 0x75, 0x00,
+  0x91, 0x00, 0x9d, 0x00, 0xad, 0x00, 0x00, 0x00, 0x16, 0x00, 0x28, 0x00,
+  0x34, 0x00, 0x43, 0x00, 0x57, 0x00, 0x6e, 0x00, 0x85, 0x00, 0x94, 0x00,
+  0xa9, 0x00, 0xb4, 0x00, 0x00, 0x00, 0x10, 0x00, 0x23, 0x00, 0x39, 0x00,
+  0x58, 0x00, 0x76, 0x00, 0x83, 0x00, 0x91, 0x00, 0x9c, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x2f, 0x00, 0x46, 0x00, 0x58, 0x00, 0x72, 0x00, 0x7f, 0x00,
+  0x9a, 0x00, 0xa2, 0x00, 0xaa, 0x00, 0xd5, 0x00, 0xe1, 0x00, 0xed, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x11, 0x00, 0x31, 0x00, 0x3f, 0x00, 0x55, 0x00,
+  0x61, 0x00, 0x72, 0x00, 0x80, 0x00, 0x89, 0x00, 0x93, 0x00, 0x9c, 0x00,
+  0xb2, 0x00, 0xdd, 0x00, 0xfc, 0x00, 0x05, 0x01, 0x2e, 0x01, 0x35, 0x01,
+  0x3e, 0x01, 0x47, 0x01, 0x50, 0x01, 0x57, 0x01, 0x60, 0x01, 0x69, 0x01,
+  0x00, 0x00, 0x12, 0x00, 0x26, 0x00, 0x34, 0x00, 0x57, 0x00, 0x6e, 0x00,
+  0x7f, 0x00, 0x90, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x15, 0x00, 0x25, 0x00,
+  0x3d, 0x00, 0x53, 0x00, 0x65, 0x00, 0x79, 0x00, 0x87, 0x00, 0x9a, 0x00,
+  0xd9, 0x00, 0x00, 0x00, 0x10, 0x00, 0x2f, 0x00, 0x48, 0x00, 0x5f, 0x00,
+  0x70, 0x00, 0x80, 0x00, 0x90, 0x00, 0x98, 0x00, 0xa1, 0x00, 0xaa, 0x00,
+  0xbc, 0x00, 0xd0, 0x00, 0xd9, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x47, 0x00,
+  0x64, 0x00, 0x73, 0x00, 0x87, 0x00, 0x8e, 0x00, 0x96, 0x00, 0x9d, 0x00,
+  0xa3, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x37, 0x00, 0x4b, 0x00, 0x5e, 0x00,
+  0x77, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x41, 0x00, 0x60, 0x00, 0x73, 0x00,
+  0x00, 0x00, 0x1a, 0x00, 0x2d, 0x00, 0x57, 0x00, 0x77, 0x00, 0x94, 0x00,
+  0xa8, 0x00, 0x00, 0x00, 0x17, 0x00, 0x38, 0x00, 0x47, 0x00, 0x5a, 0x00,
+  0x6c, 0x00, 0x81, 0x00, 0x98, 0x00, 0x9f, 0x00, 0xa7, 0x00, 0xaf, 0x00,
+  0xb8, 0x00, 0x00, 0x00, 0x16, 0x00, 0x50, 0x00, 0x69, 0x00, 0x85, 0x00,
+  0x97, 0x00, 0xad, 0x00, 0xc9, 0x00, 0xeb, 0x00, 0x08, 0x01, 0x10, 0x01,
+  0x00, 0x00, 0x18, 0x00, 0x38, 0x00, 0x4b, 0x00, 0x61, 0x00, 0x6d, 0x00,
+  0x81, 0x00, 0x99, 0x00, 0xac, 0x00, 0xc1, 0x00, 0xda, 0x00, 0xef, 0x00,
+  0x06, 0x01, 0x10, 0x01, 0x00, 0x00, 0x17, 0x00, 0x35, 0x00, 0x5a, 0x00,
+  0x66, 0x00, 0x83, 0x00, 0x97, 0x00, 0xab, 0x00, 0xd4, 0x00, 0xdd, 0x00,
+  0x00, 0x00, 0x22, 0x00, 0x3b, 0x00, 0x4e, 0x00, 0x61, 0x00, 0x7a, 0x00,
+  0x8d, 0x00, 0xa0, 0x00, 0xb0, 0x00, 0xba, 0x00, 0xc2, 0x00, 0xc8, 0x00,
+  0xd0, 0x00, 0xd6, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x32, 0x00, 0x3e, 0x00,
+  0x50, 0x00, 0x63, 0x00, 0x80, 0x00, 0x9c, 0x00, 0xad, 0x00, 0xb4, 0x00,
+  0xd7, 0x00, 0x00, 0x00, 0x18, 0x00, 0x2c, 0x00, 0x3d, 0x00, 0x51, 0x00,
+  0x65, 0x00, 0x76, 0x00, 0x8a, 0x00, 0x91, 0x00, 0x00, 0x00, 0x1b, 0x00,
+  0x2b, 0x00, 0x41, 0x00, 0x50, 0x00, 0x60, 0x00, 0x70, 0x00, 0x7b, 0x00,
+  0x84, 0x00, 0x8d, 0x00, 0x98, 0x00, 0xa1, 0x00, 0xaa, 0x00, 0x00, 0x00,
+  0x17, 0x00, 0x27, 0x00, 0x3a, 0x00, 0x53, 0x00, 0x65, 0x00, 0x73, 0x00,
+  0x7d, 0x00, 0x83, 0x00, 0x8b, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x36, 0x00,
+  0x50, 0x00, 0x65, 0x00, 0x7a, 0x00, 0x8d, 0x00, 0x96, 0x00, 0x9f, 0x00,
+  0xaa, 0x00, 0xb0, 0x00, 0xb5, 0x00, 0x00, 0x00, 0x19, 0x00, 0x2c, 0x00,
+  0x41, 0x00, 0x57, 0x00, 0x7d, 0x00, 0x95, 0x00, 0xa5, 0x00, 0xad, 0x00,
+  0xcd, 0x00, 0xdb, 0x00, 0xe7, 0x00, 0xef, 0x00, 0xf7, 0x00, 0xff, 0x00,
+  0x05, 0x01, 0x00, 0x00, 0x1c, 0x00, 0x29, 0x00, 0x3a, 0x00, 0x51, 0x00,
+  0x71, 0x00, 0x88, 0x00, 0x98, 0x00, 0xa1, 0x00, 0xcc, 0x00, 0xfe, 0x00,
+  0x07, 0x01, 0x0e, 0x01, 0x15, 0x01, 0x1c, 0x01, 0x00, 0x00, 0x1a, 0x00,
+  0x2f, 0x00, 0x51, 0x00, 0x75, 0x00, 0x94, 0x00, 0x9c, 0x00, 0xa4, 0x00,
+  0x00, 0x00, 0x0f, 0x00, 0x23, 0x00, 0x3b, 0x00, 0x5f, 0x00, 0x69, 0x00,
+  0x77, 0x00, 0x80, 0x00, 0x85, 0x00, 0x00, 0x00, 0x12, 0x00, 0x2d, 0x00,
+  0x3d, 0x00, 0x58, 0x00, 0x6d, 0x00, 0x80, 0x00, 0x94, 0x00, 0xa0, 0x00,
+  0xa6, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x23, 0x00, 0x48, 0x00, 0x5a, 0x00,
+  0x7d, 0x00, 0x85, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x1a, 0x00, 0x2f, 0x00,
+  0x5d, 0x00, 0x76, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x2b, 0x00, 0x47, 0x00,
+  0x69, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x3b, 0x00, 0x4d, 0x00, 0x6b, 0x00,
+  0x7c, 0x00, 0x88, 0x00, 0x91, 0x00, 0x9d, 0x00, 0xa5, 0x00, 0xad, 0x00,
+  0x00, 0x00, 0x18, 0x00, 0x2b, 0x00, 0x44, 0x00, 0x58, 0x00, 0x6a, 0x00,
+  0x77, 0x00, 0x82, 0x00, 0x98, 0x00, 0xa1, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x2d, 0x00, 0x42, 0x00, 0x4e, 0x00, 0x5e, 0x00, 0x6c, 0x00, 0x7d, 0x00,
+  0x85, 0x00, 0x91, 0x00, 0x99, 0x00, 0x9f, 0x00, 0xa7, 0x00, 0x00, 0x00,
+  0x1e, 0x00, 0x45, 0x00, 0x57, 0x00, 0x65, 0x00, 0x6c, 0x00, 0x77, 0x00,
+  0x82, 0x00, 0x00, 0x00, 0x13, 0x00, 0x28, 0x00, 0x34, 0x00, 0x4b, 0x00,
+  0x67, 0x00, 0x74, 0x00, 0x7c, 0x00, 0x85, 0x00, 0x9e, 0x00, 0xbd, 0x00,
+  0xc6, 0x00, 0xd1, 0x00, 0xdd, 0x00, 0xf4, 0x00, 0xfc, 0x00, 0x03, 0x01,
+  0x09, 0x01, 0x00, 0x00, 0x15, 0x00, 0x35, 0x00, 0x49, 0x00, 0x5a, 0x00,
+  0x74, 0x00, 0x81, 0x00, 0x8a, 0x00, 0xa5, 0x00, 0xd0, 0x00, 0xd7, 0x00,
+  0xe3, 0x00, 0xed, 0x00, 0xf9, 0x00, 0x02, 0x01, 0x00, 0x00, 0x1b, 0x00,
+  0x27, 0x00, 0x47, 0x00, 0x5c, 0x00, 0x67, 0x00, 0x73, 0x00, 0x80, 0x00,
+  0x88, 0x00, 0x00, 0x00, 0x25, 0x00, 0x39, 0x00, 0x4f, 0x00, 0x62, 0x00,
+  0x70, 0x00, 0x79, 0x00, 0xa4, 0x00, 0xb2, 0x00, 0xbb, 0x00, 0xc4, 0x00,
+  0xcd, 0x00, 0xd6, 0x00, 0xdf, 0x00, 0xe8, 0x00, 0xf1, 0x00, 0x00, 0x00,
+  0x17, 0x00, 0x41, 0x00, 0x52, 0x00, 0x62, 0x00, 0x72, 0x00, 0x79, 0x00,
+  0x82, 0x00, 0x8d, 0x00, 0xa2, 0x00, 0xc2, 0x00, 0xd4, 0x00, 0xeb, 0x00,
+  0x1a, 0x01, 0x00, 0x00, 0x1a, 0x00, 0x36, 0x00, 0x58, 0x00, 0x6b, 0x00,
+  0x7d, 0x00, 0x8c, 0x00, 0x98, 0x00, 0xa6, 0x00, 0xaf, 0x00, 0xba, 0x00,
+  0x00, 0x00, 0x14, 0x00, 0x2b, 0x00, 0x3e, 0x00, 0x4f, 0x00, 0x6a, 0x00,
+  0x00, 0x00, 0x16, 0x00, 0x28, 0x00, 0x3e, 0x00, 0x4f, 0x00, 0x60, 0x00,
+  0x69, 0x00, 0x74, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x2c, 0x00, 0x40, 0x00,
+  0x5e, 0x00, 0x64, 0x00, 0x6a, 0x00, 0x76, 0x00, 0x7c, 0x00, 0x82, 0x00,
+  0x00, 0x00, 0x21, 0x00, 0x32, 0x00, 0x45, 0x00, 0x4e, 0x00, 0x62, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x23, 0x00, 0x2f, 0x00, 0x3b, 0x00, 0x49, 0x00,
+  0x56, 0x00, 0x61, 0x00, 0x6d, 0x00, 0x79, 0x00, 0x87, 0x00, 0x8e, 0x00,
+  0x96, 0x00, 0x00, 0x00, 0x15, 0x00, 0x3c, 0x00, 0x54, 0x00, 0x5e, 0x00,
+  0x00, 0x00, 0x2e, 0x00, 0x3a, 0x00, 0x65, 0x00, 0x7e, 0x00, 0x87, 0x00,
+  0x90, 0x00, 0x96, 0x00, 0x9e, 0x00, 0xa7, 0x00, 0xb3, 0x00, 0xb9, 0x00,
+  0x00, 0x00, 0x31, 0x00, 0x4e, 0x00, 0x73, 0x00, 0x89, 0x00, 0x95, 0x00,
+  0x9e, 0x00, 0xb2, 0x00, 0x00, 0x00, 0x15, 0x00, 0x35, 0x00, 0x50, 0x00,
+  0x79, 0x00, 0x86, 0x00, 0x8f, 0x00, 0xa5, 0x00, 0xad, 0x00, 0xb5, 0x00,
+  0xbc, 0x00, 0xc3, 0x00, 0x00, 0x00, 0x19, 0x00, 0x29, 0x00, 0x4e, 0x00,
+  0x79, 0x00, 0x7f, 0x00, 0x89, 0x00, 0x00, 0x00, 0x12, 0x00, 0x23, 0x00,
+  0x4a, 0x00, 0x62, 0x00, 0x6a, 0x00, 0x73, 0x00, 0x7c, 0x00, 0x85, 0x00,
+  0x8e, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x2c, 0x00, 0x38, 0x00, 0x51, 0x00,
+  0x62, 0x00, 0x83, 0x00, 0x8e, 0x00, 0x97, 0x00, 0x9e, 0x00, 0xa6, 0x00,
+  0xaf, 0x00, 0xba, 0x00, 0x00, 0x00, 0x15, 0x00, 0x29, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x27, 0x00, 0x31, 0x00, 0x3b, 0x00, 0x44, 0x00, 0x00, 0x00,
+  0x15, 0x00, 0x4e, 0x00, 0x62, 0x00, 0x72, 0x00, 0x88, 0x00, 0xad, 0x00,
+  0xd0, 0x00, 0xe5, 0x00, 0x08, 0x01, 0x11, 0x01, 0x17, 0x01, 0x00, 0x00,
+  0x0c, 0x00, 0x42, 0x00, 0x57, 0x00, 0x66, 0x00, 0x84, 0x00, 0x00, 0x00,
+  0x1e, 0x00, 0x32, 0x00, 0x46, 0x00, 0x50, 0x00, 0x5b, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x27, 0x00, 0x00, 0x00, 0x13, 0x00, 0x33, 0x00, 0x54, 0x00,
+  0x61, 0x00, 0x87, 0x00, 0x99, 0x00, 0xa5, 0x00, 0xae, 0x00, 0xb4, 0x00,
+  0x00, 0x00, 0x16, 0x00, 0x4c, 0x00, 0x56, 0x00, 0x5c, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x38, 0x00, 0x5e, 0x00, 0x64, 0x00, 0x71, 0x00, 0x7b, 0x00,
+  0x85, 0x00, 0x8b, 0x00, 0x92, 0x00, 0x00, 0x00, 0x29, 0x00, 0x44, 0x00,
+  0x4f, 0x00, 0x56, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x28, 0x00, 0x3e, 0x00,
+  0x4a, 0x00, 0x7e, 0x00, 0x86, 0x00, 0x8f, 0x00, 0x00, 0x00, 0x1f, 0x00,
+  0x3c, 0x00, 0x4d, 0x00, 0x58, 0x00, 0x61, 0x00, 0x6e, 0x00, 0x74, 0x00,
+  0x7a, 0x00, 0x80, 0x00, 0x00, 0x00, 0x13, 0x00, 0x2f, 0x00, 0x42, 0x00,
+  0x5f, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x14, 0x00, 0x26, 0x00, 0x38, 0x00,
+  0x56, 0x00, 0x7d, 0x00, 0x86, 0x00, 0x91, 0x00, 0x00, 0x00, 0x0d, 0x00,
+  0x24, 0x00, 0x39, 0x00, 0x43, 0x00, 0x4c, 0x00, 0x56, 0x00, 0x00, 0x00,
+  0x15, 0x00, 0x2a, 0x00, 0x3f, 0x00, 0x54, 0x00, 0x69, 0x00, 0x7e, 0x00,
+  0x93, 0x00, 0xa8, 0x00, 0xbd, 0x00, 0xde, 0x00, 0xf4, 0x00, 0x10, 0x01,
+  0x1e, 0x01, 0x2b, 0x01, 0x4e, 0x01, 0x00, 0x00, 0x15, 0x00, 0x2e, 0x00,
+  0x40, 0x00, 0x66, 0x00, 0x6f, 0x00, 0x00, 0x00, 0x14, 0x00, 0x30, 0x00,
+  0x58, 0x00, 0x64, 0x00, 0x6f, 0x00, 0x75, 0x00, 0x7b, 0x00, 0x84, 0x00,
+  0x00, 0x00, 0x14, 0x00, 0x2c, 0x00, 0x3f, 0x00, 0x47, 0x00, 0x53, 0x00,
+  0x94, 0x00, 0xa0, 0x00, 0xa8, 0x00, 0xb1, 0x00, 0x00, 0x00, 0x14, 0x00,
+  0x23, 0x00, 0x3a, 0x00, 0x4f, 0x00, 0x57, 0x00, 0x5f, 0x00, 0x67, 0x00,
+  0x71, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x3d, 0x00, 0x46, 0x00, 0x4f, 0x00,
+  0x57, 0x00, 0x60, 0x00, 0x00, 0x00, 0x12, 0x00, 0x21, 0x00, 0x2a, 0x00,
+  0x32, 0x00, 0x39, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x2e, 0x00, 0x42, 0x00,
+  0x00, 0x00, 0x1b, 0x00, 0x2b, 0x00, 0x3f, 0x00, 0x49, 0x00, 0x52, 0x00,
+  0x59, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x25, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x23, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x19, 0x00, 0x2c, 0x00, 0x3f, 0x00,
+  0x53, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x24, 0x00, 0x2f, 0x00,
+  0x3a, 0x00, 0x45, 0x00, 0x4c, 0x00, 0x5b, 0x00, 0x63, 0x00, 0x6a, 0x00,
+  0x71, 0x00, 0x78, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x2a, 0x00, 0x5a, 0x00,
+  0x69, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x26, 0x00, 0x35, 0x00, 0x3e, 0x00,
+  0x4a, 0x00, 0x00, 0x00, 0x23, 0x00, 0x46, 0x00, 0x5f, 0x00, 0x68, 0x00,
+  0x75, 0x00, 0x7f, 0x00, 0x85, 0x00, 0x92, 0x00, 0x9b, 0x00, 0xa4, 0x00,
+  0xaa, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x2e, 0x00, 0x59, 0x00, 0x71, 0x00,
+  0x7d, 0x00, 0x87, 0x00, 0x92, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x25, 0x00,
+  0x3d, 0x00, 0x4c, 0x00, 0x57, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x31, 0x00,
+  0x4b, 0x00, 0x5a, 0x00, 0x66, 0x00, 0x72, 0x00, 0x00, 0x00, 0x0f, 0x00,
+  0x28, 0x00, 0x53, 0x00, 0x62, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x21, 0x00,
+  0x43, 0x00, 0x52, 0x00, 0x5f, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x12, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x16, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x20, 0x00,
+  0x3e, 0x00, 0x44, 0x00, 0x00, 0x00, 0x22, 0x00, 0x51, 0x00, 0x5c, 0x00,
+  0x62, 0x00, 0x6a, 0x00, 0x72, 0x00, 0x78, 0x00, 0x00, 0x00, 0x13, 0x00,
+  0x1a, 0x00, 0x3a, 0x00, 0x4e, 0x00, 0x55, 0x00, 0x5c, 0x00, 0x63, 0x00,
+  0x6a, 0x00, 0x70, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x17, 0x00, 0x20, 0x00,
+  0x2d, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x27, 0x00, 0x2f, 0x00, 0x38, 0x00,
+  0x00, 0x00, 0x11, 0x00, 0x33, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x19, 0x00,
+  0x20, 0x00, 0x28, 0x00, 0x4d, 0x00, 0x55, 0x00, 0x5e, 0x00, 0x68, 0x00,
+  0x74, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x30, 0x00, 0x3a, 0x00, 0x54, 0x00,
+  0x6c, 0x00, 0x87, 0x00, 0x9c, 0x00, 0xb8, 0x00, 0xce, 0x00, 0xe1, 0x00,
+  0xfa, 0x00, 0x17, 0x01, 0x2e, 0x01, 0x4c, 0x01, 0x64, 0x01, 0x7b, 0x01,
+  0x98, 0x01, 0xb5, 0x01, 0xd0, 0x01, 0xdd, 0x01, 0xff, 0x01, 0x1d, 0x02,
+  0x3a, 0x02, 0x40, 0x02, 0x4a, 0x02, 0x00, 0x00, 0x1d, 0x00, 0x31, 0x00,
+  0x53, 0x00, 0x81, 0x00, 0x8c, 0x00, 0x97, 0x00, 0xa3, 0x00, 0xad, 0x00,
+  0xb9, 0x00, 0x00, 0x00, 0x15, 0x00, 0x2a, 0x00, 0x3f, 0x00, 0x54, 0x00,
+  0x6e, 0x00, 0x79, 0x00, 0xa1, 0x00, 0xad, 0x00, 0xb5, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x17, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1c, 0x00, 0x28, 0x00,
+  0x33, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1a, 0x00, 0x26, 0x00, 0x46, 0x00,
+  0x56, 0x00, 0x00, 0x00, 0x17, 0x00, 0x39, 0x00, 0x71, 0x00, 0x7a, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x15, 0x00, 0x1f, 0x00,
+  0x30, 0x00, 0x00, 0x00, 0x12, 0x00, 0x1c, 0x00, 0x27, 0x00, 0x49, 0x00,
+  0x54, 0x00, 0x5f, 0x00, 0x6a, 0x00, 0x00, 0x00, 0x13, 0x00, 0x1c, 0x00,
+  0x28, 0x00, 0x32, 0x00, 0x3a, 0x00, 0x44, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x3c, 0x00, 0x43, 0x00, 0x4a, 0x00, 0x54, 0x00, 0x5b, 0x00, 0x00, 0x00,
+  0x1e, 0x00, 0x2e, 0x00, 0x3a, 0x00, 0x43, 0x00, 0x4d, 0x00, 0x58, 0x00,
+  0x00, 0x00, 0x07, 0x00, 0x12, 0x00, 0x1d, 0x00, 0x28, 0x00, 0x33, 0x00,
+  0x3a, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x45, 0x00, 0x57, 0x00, 0x5f, 0x00,
+  0x87, 0x00, 0xb6, 0x00, 0xe7, 0x00, 0xf0, 0x00, 0xf8, 0x00, 0x07, 0x01,
+  0x0f, 0x01, 0x16, 0x01, 0x00, 0x00, 0x22, 0x00, 0x36, 0x00, 0x41, 0x00,
+  0x49, 0x00, 0x00, 0x00, 0x20, 0x00, 0x50, 0x00, 0x69, 0x00, 0x71, 0x00,
+  0x00, 0x00, 0x20, 0x00, 0x3d, 0x00, 0x48, 0x00, 0x53, 0x00, 0x5f, 0x00,
+  0x7d, 0x00, 0x83, 0x00, 0x8f, 0x00, 0x00, 0x00, 0x26, 0x00, 0x4c, 0x00,
+  0x62, 0x00, 0x6b, 0x00, 0x76, 0x00, 0x81, 0x00, 0x00, 0x00, 0x1b, 0x00,
+  0x3b, 0x00, 0x4d, 0x00, 0x56, 0x00, 0x5e, 0x00, 0x00, 0x00, 0x1a, 0x00,
+  0x3a, 0x00, 0x42, 0x00, 0x4d, 0x00, 0x56, 0x00, 0x62, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x1e, 0x00, 0x41, 0x00, 0x5f, 0x00, 0x7d, 0x00, 0xa2, 0x00,
+  0xb4, 0x00, 0xcb, 0x00, 0xf8, 0x00, 0x1b, 0x01, 0x00, 0x00, 0x33, 0x00,
+  0x4f, 0x00, 0x5d, 0x00, 0x66, 0x00, 0x6f, 0x00, 0x00, 0x00, 0x14, 0x00,
+  0x47, 0x00, 0x62, 0x00, 0x70, 0x00, 0x86, 0x00, 0x96, 0x00, 0xaa, 0x00,
+  0xb4, 0x00, 0x00, 0x00, 0x32, 0x00, 0x52, 0x00, 0x77, 0x00, 0x87, 0x00,
+  0x95, 0x00, 0xae, 0x00, 0xbd, 0x00, 0xcc, 0x00, 0x00, 0x00, 0x1c, 0x00,
+  0x3a, 0x00, 0x4e, 0x00, 0x5a, 0x00, 0x75, 0x00, 0x7f, 0x00, 0xa3, 0x00,
+  0xac, 0x00, 0xb8, 0x00, 0xc4, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x24, 0x00,
+  0x4b, 0x00, 0x59, 0x00, 0x62, 0x00, 0x00, 0x00, 0x28, 0x00, 0x38, 0x00,
+  0x47, 0x00, 0x57, 0x00, 0x67, 0x00, 0x70, 0x00, 0x00, 0x00, 0x1a, 0x00,
+  0x27, 0x00, 0x39, 0x00, 0x49, 0x00, 0x5d, 0x00, 0x65, 0x00, 0x6e, 0x00,
+  0x78, 0x00, 0x82, 0x00, 0x88, 0x00, 0x8e, 0x00, 0x00, 0x00, 0x0b, 0x00,
+  0x17, 0x00, 0x34, 0x00, 0x4f, 0x00, 0x68, 0x00, 0x00, 0x00, 0x14, 0x00,
+  0x2a, 0x00, 0x41, 0x00, 0x67, 0x00, 0x00, 0x00, 0x10, 0x00, 0x18, 0x00,
+  0x1f, 0x00, 0x26, 0x00, 0x32, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x19, 0x00,
+  0x20, 0x00, 0x29, 0x00, 0x00, 0x00, 0x26, 0x00, 0x35, 0x00, 0x46, 0x00,
+  0x52, 0x00, 0x5d, 0x00, 0x6b, 0x00, 0x00, 0x00, 0x27, 0x00, 0x38, 0x00,
+  0x49, 0x00, 0x68, 0x00, 0x72, 0x00, 0x00, 0x00, 0x15, 0x00, 0x1f, 0x00,
+  0x2f, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x2b, 0x00, 0x34, 0x00, 0x45, 0x00,
+  0x50, 0x00, 0x61, 0x00, 0x6c, 0x00, 0x7d, 0x00, 0x00, 0x00, 0x13, 0x00,
+  0x1b, 0x00, 0x24, 0x00, 0x30, 0x00, 0x3e, 0x00, 0x47, 0x00, 0x50, 0x00,
+  0x59, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x44, 0x00, 0x5f, 0x00, 0x83, 0x00,
+  0x8c, 0x00, 0x9b, 0x00, 0x00, 0x00, 0x10, 0x00, 0x1d, 0x00, 0x2c, 0x00,
+  0x48, 0x00, 0x58, 0x00, 0x61, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x2c, 0x00,
+  0x3b, 0x00, 0x4c, 0x00, 0x61, 0x00, 0x6c, 0x00, 0x8a, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x22, 0x00, 0x33, 0x00, 0x44, 0x00, 0x4f, 0x00, 0x59, 0x00,
+  0x00, 0x00, 0x17, 0x00, 0x35, 0x00, 0x49, 0x00, 0x56, 0x00, 0x6f, 0x00,
+  0x90, 0x00, 0xa3, 0x00, 0xac, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x2b, 0x00,
+  0x3b, 0x00, 0x48, 0x00, 0x5f, 0x00, 0x66, 0x00, 0x8a, 0x00, 0x97, 0x00,
+  0x00, 0x00, 0x20, 0x00, 0x47, 0x00, 0x55, 0x00, 0x63, 0x00, 0x79, 0x00,
+  0x94, 0x00, 0x9e, 0x00, 0xa7, 0x00, 0xb0, 0x00, 0xba, 0x00, 0xc3, 0x00,
+  0x00, 0x00, 0x21, 0x00, 0x3d, 0x00, 0x59, 0x00, 0x67, 0x00, 0x78, 0x00,
+  0x86, 0x00, 0x99, 0x00, 0xa3, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x28, 0x00,
+  0x46, 0x00, 0x68, 0x00, 0x92, 0x00, 0xa0, 0x00, 0xac, 0x00, 0xc5, 0x00,
+  0xdb, 0x00, 0xe2, 0x00, 0xea, 0x00, 0xf1, 0x00, 0x00, 0x00, 0x24, 0x00,
+  0x58, 0x00, 0x71, 0x00, 0x82, 0x00, 0x98, 0x00, 0xb3, 0x00, 0xc1, 0x00,
+  0xca, 0x00, 0xd4, 0x00, 0xdd, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x3b, 0x00,
+  0x5e, 0x00, 0x6c, 0x00, 0x7c, 0x00, 0x92, 0x00, 0xa1, 0x00, 0xaa, 0x00,
+  0xb3, 0x00, 0xe0, 0x00, 0xf2, 0x00, 0x13, 0x01, 0x3b, 0x01, 0x44, 0x01,
+  0x4d, 0x01, 0x54, 0x01, 0x00, 0x00, 0x1d, 0x00, 0x44, 0x00, 0x54, 0x00,
+  0x62, 0x00, 0x79, 0x00, 0x95, 0x00, 0x9f, 0x00, 0xaa, 0x00, 0xb4, 0x00,
+  0x00, 0x00, 0x1b, 0x00, 0x4b, 0x00, 0x61, 0x00, 0x6e, 0x00, 0x84, 0x00,
+  0x97, 0x00, 0x9f, 0x00, 0xc7, 0x00, 0xd2, 0x00, 0xdd, 0x00, 0xe5, 0x00,
+  0xee, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x27, 0x00, 0x4b, 0x00, 0x6f, 0x00,
+  0x8f, 0x00, 0xa4, 0x00, 0xb6, 0x00, 0xc2, 0x00, 0xe0, 0x00, 0xec, 0x00,
+  0xf8, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x4a, 0x00, 0x73, 0x00, 0x91, 0x00,
+  0x9e, 0x00, 0xae, 0x00, 0xc8, 0x00, 0xd6, 0x00, 0xdd, 0x00, 0x00, 0x00,
+  0x24, 0x00, 0x44, 0x00, 0x6b, 0x00, 0x83, 0x00, 0x92, 0x00, 0xa5, 0x00,
+  0xb7, 0x00, 0xc3, 0x00, 0x00, 0x00, 0x20, 0x00, 0x4e, 0x00, 0x6c, 0x00,
+  0x84, 0x00, 0x93, 0x00, 0xb1, 0x00, 0xcd, 0x00, 0xd6, 0x00, 0xde, 0x00,
+  0xe6, 0x00, 0x00, 0x00, 0x21, 0x00, 0x3f, 0x00, 0x5b, 0x00, 0x76, 0x00,
+  0x8b, 0x00, 0x99, 0x00, 0x9f, 0x00, 0x00, 0x00, 0x38, 0x00, 0x54, 0x00,
+  0x72, 0x00, 0x8f, 0x00, 0x9f, 0x00, 0xae, 0x00, 0xc2, 0x00, 0xe6, 0x00,
+  0xff, 0x00, 0x08, 0x01, 0x00, 0x00, 0x1f, 0x00, 0x3a, 0x00, 0x49, 0x00,
+  0x55, 0x00, 0x67, 0x00, 0x71, 0x00, 0x88, 0x00, 0x00, 0x00, 0x22, 0x00,
+  0x3e, 0x00, 0x61, 0x00, 0x71, 0x00, 0x81, 0x00, 0x93, 0x00, 0xb3, 0x00,
+  0x00, 0x00, 0x23, 0x00, 0x41, 0x00, 0x64, 0x00, 0x7e, 0x00, 0x96, 0x00,
+  0xa2, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x2c, 0x00, 0x40, 0x00, 0x5d, 0x00,
+  0x75, 0x00, 0x94, 0x00, 0xc5, 0x00, 0xe7, 0x00, 0x07, 0x01, 0x10, 0x01,
+  0x30, 0x01, 0x47, 0x01, 0x6c, 0x01, 0x83, 0x01, 0x8c, 0x01, 0x95, 0x01,
+  0x9c, 0x01, 0xa2, 0x01, 0xa8, 0x01, 0x00, 0x00, 0x25, 0x00, 0x36, 0x00,
+  0x4d, 0x00, 0x66, 0x00, 0x6d, 0x00, 0x79, 0x00, 0x83, 0x00, 0x8a, 0x00,
+  0x93, 0x00, 0x9e, 0x00, 0xa6, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x26, 0x00,
+  0x3a, 0x00, 0x48, 0x00, 0x61, 0x00, 0x95, 0x00, 0xab, 0x00, 0xb9, 0x00,
+  0xc0, 0x00, 0xc7, 0x00, 0xd0, 0x00, 0xd8, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x1c, 0x00, 0x2f, 0x00, 0x44, 0x00, 0x5e, 0x00, 0x66, 0x00, 0x6f, 0x00,
+  0x77, 0x00, 0x81, 0x00, 0x8c, 0x00, 0x91, 0x00, 0x00, 0x00, 0x23, 0x00,
+  0x44, 0x00, 0x58, 0x00, 0x65, 0x00, 0x78, 0x00, 0x81, 0x00, 0x89, 0x00,
+  0x00, 0x00, 0x22, 0x00, 0x3d, 0x00, 0x5b, 0x00, 0x76, 0x00, 0x83, 0x00,
+  0x98, 0x00, 0xa6, 0x00, 0xb0, 0x00, 0xb9, 0x00, 0xc0, 0x00, 0xc7, 0x00,
+  0x00, 0x00, 0x28, 0x00, 0x44, 0x00, 0x69, 0x00, 0x74, 0x00, 0x83, 0x00,
+  0xa4, 0x00, 0xc8, 0x00, 0xce, 0x00, 0xda, 0x00, 0x0d, 0x01, 0x15, 0x01,
+  0x22, 0x01, 0x2c, 0x01, 0x3a, 0x01, 0x00, 0x00, 0x2b, 0x00, 0x49, 0x00,
+  0x60, 0x00, 0x70, 0x00, 0x87, 0x00, 0xa2, 0x00, 0xc0, 0x00, 0xed, 0x00,
+  0x01, 0x01, 0x0a, 0x01, 0x13, 0x01, 0x00, 0x00, 0x1b, 0x00, 0x37, 0x00,
+  0x60, 0x00, 0x6d, 0x00, 0x7b, 0x00, 0x8d, 0x00, 0xa0, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x20, 0x00, 0x32, 0x00, 0x52, 0x00, 0x69, 0x00, 0x72, 0x00,
+  0x7a, 0x00, 0x00, 0x00, 0x10, 0x00, 0x20, 0x00, 0x35, 0x00, 0x54, 0x00,
+  0x60, 0x00, 0x69, 0x00, 0x72, 0x00, 0x00, 0x00, 0x15, 0x00, 0x25, 0x00,
+  0x32, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1c, 0x00, 0x2a, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x22, 0x00, 0x40, 0x00, 0x4c, 0x00, 0x56, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x25, 0x00, 0x30, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x37, 0x00,
+  0x4c, 0x00, 0x57, 0x00, 0x00, 0x00, 0x21, 0x00, 0x3e, 0x00, 0x4c, 0x00,
+  0x5b, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x1f, 0x00,
+  0x2e, 0x00, 0x3b, 0x00, 0x43, 0x00, 0x00, 0x00, 0x22, 0x00, 0x32, 0x00,
+  0x00, 0x00, 0x1c, 0x00, 0x39, 0x00, 0x48, 0x00, 0x56, 0x00, 0x81, 0x00,
+  0xa3, 0x00, 0xca, 0x00, 0xf6, 0x00, 0xff, 0x00, 0x24, 0x01, 0x00, 0x00,
+  0x1f, 0x00, 0x2d, 0x00, 0x3e, 0x00, 0x44, 0x00, 0x4e, 0x00, 0x00, 0x00,
+  0x18, 0x00, 0x2d, 0x00, 0x34, 0x00, 0x00, 0x00, 0x24, 0x00, 0x43, 0x00,
+  0x59, 0x00, 0x62, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x3a, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x2a, 0x00, 0x3c, 0x00, 0x6f, 0x00, 0xb7, 0x00, 0xdf, 0x00,
+  0xe9, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x45, 0x00, 0x63, 0x00, 0x79, 0x00,
+  0x8b, 0x00, 0xb8, 0x00, 0xc3, 0x00, 0xcb, 0x00, 0x00, 0x00, 0x1c, 0x00,
+  0x00, 0x00, 0x1d, 0x00, 0x3e, 0x00, 0x5b, 0x00, 0x6e, 0x00, 0x76, 0x00,
+  0x7c, 0x00, 0x00, 0x00, 0x27, 0x00, 0x2d, 0x00, 0x3a, 0x00, 0x41, 0x00,
+  0x48, 0x00, 0x4e, 0x00, 0x55, 0x00, 0x00, 0x00, 0x27, 0x00, 0x4a, 0x00,
+  0x53, 0x00, 0x00, 0x00, 0x21, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x1c, 0x00,
+  0x38, 0x00, 0x56, 0x00, 0x60, 0x00, 0x00, 0x00, 0x27, 0x00, 0x41, 0x00,
+  0x4a, 0x00, 0x5e, 0x00, 0x6a, 0x00, 0x71, 0x00, 0x00, 0x00, 0x23, 0x00,
+  0x41, 0x00, 0x5f, 0x00, 0x66, 0x00, 0x6d, 0x00, 0x00, 0x00, 0x2f, 0x00,
+  0x52, 0x00, 0x5b, 0x00, 0x64, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x34, 0x00,
+  0x56, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x3c, 0x00, 0x4d, 0x00, 0x56, 0x00,
+  0x00, 0x00, 0x3f, 0x00, 0x64, 0x00, 0x76, 0x00, 0x80, 0x00, 0x8c, 0x00,
+  0x98, 0x00, 0x00, 0x00, 0x09, 0x00, 0x15, 0x00, 0x1f, 0x00, 0x28, 0x00,
+  0x33, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x10, 0x00,
+  0x17, 0x00, 0x1e, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x09, 0x00, 0x12, 0x00,
+  0x1d, 0x00, 0x29, 0x00, 0x31, 0x00, 0x00, 0x00, 0x09, 0x00, 0x13, 0x00,
+  0x1c, 0x00, 0x25, 0x00, 0x2e, 0x00, 0x35, 0x00, 0x00, 0x00, 0x24, 0x00,
+  0x2e, 0x00, 0x38, 0x00, 0x42, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x16, 0x00, 0x1f, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x3b, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x1f, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x08, 0x00, 0x0e, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x4a, 0x00,
+  0x53, 0x00, 0x5c, 0x00, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x00,
+  0x27, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x16, 0x00, 0x1d, 0x00, 0x29, 0x00,
+  0x3a, 0x00, 0x45, 0x00, 0x4a, 0x00, 0x00, 0x00, 0x08, 0x00, 0x13, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x12, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x13, 0x00,
+  0x1c, 0x00, 0x25, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x2a, 0x00, 0x31, 0x00,
+  0x38, 0x00, 0x00, 0x00, 0x28, 0x00, 0x30, 0x00, 0x38, 0x00, 0x44, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x2f, 0x00, 0x39, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x15, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x09, 0x00, 0x15, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x13, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x15, 0x00,
+  0x21, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x49, 0x00, 0x00, 0x00, 0x2f, 0x00,
+  0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x08, 0x00,
+  0x12, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x25, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x24, 0x00, 0x3a, 0x00,
+  0x45, 0x00, 0x4f, 0x00, 0x5b, 0x00, 0x65, 0x00, 0x6f, 0x00, 0x7d, 0x00,
+  0x83, 0x00, 0x8a, 0x00, 0x90, 0x00, 0x00, 0x00, 0x08, 0x00, 0x19, 0x00,
+  0x21, 0x00, 0x2e, 0x00, 0x35, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x09, 0x00, 0x12, 0x00, 0x1e, 0x00, 0x26, 0x00,
+  0x00, 0x00, 0x25, 0x00, 0x2f, 0x00, 0x39, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x13, 0x00, 0x1f, 0x00, 0x28, 0x00, 0x32, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x13, 0x00, 0x1c, 0x00, 0x23, 0x00, 0x2f, 0x00, 0x39, 0x00,
+  0x43, 0x00, 0x4d, 0x00, 0x59, 0x00, 0x65, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x14, 0x00, 0x1d, 0x00, 0x25, 0x00, 0x30, 0x00, 0x39, 0x00, 0x40, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x13, 0x00, 0x39, 0x00, 0x42, 0x00, 0x4b, 0x00,
+  0x54, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x2e, 0x00, 0x3d, 0x00, 0x49, 0x00,
+  0x55, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x09, 0x00, 0x16, 0x00, 0x1f, 0x00,
+  0x2b, 0x00, 0x34, 0x00, 0x3e, 0x00, 0x47, 0x00, 0x4d, 0x00, 0x56, 0x00,
+  0x00, 0x00, 0x08, 0x00, 0x16, 0x00, 0x22, 0x00, 0x00, 0x00, 0x29, 0x00,
+  0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x15, 0x00, 0x00, 0x00,
+  0x1a, 0x00, 0x26, 0x00, 0x73, 0x00, 0x7e, 0x00, 0xad, 0x00, 0xb6, 0x00,
+  0x00, 0x00, 0x2f, 0x00, 0x39, 0x00, 0x42, 0x00, 0x4b, 0x00, 0x00, 0x00,
+  0x32, 0x00, 0x3a, 0x00, 0x45, 0x00, 0x00, 0x00, 0x08, 0x00, 0x11, 0x00,
+  0x1a, 0x00, 0x24, 0x00, 0x00, 0x00, 0x33, 0x00, 0x69, 0x00, 0xa0, 0x00,
+  0xd4, 0x00, 0xda, 0x00, 0xe2, 0x00, 0x00, 0x00, 0x32, 0x00, 0x63, 0x00,
+  0x98, 0x00, 0xcc, 0x00, 0x02, 0x01, 0x35, 0x01, 0x3e, 0x01, 0x47, 0x01,
+  0x4e, 0x01, 0x00, 0x00, 0x07, 0x00, 0x11, 0x00, 0x00, 0x00, 0x3a, 0x00,
+  0x43, 0x00, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x19, 0x00,
+  0x22, 0x00, 0x2c, 0x00, 0x35, 0x00, 0x3f, 0x00, 0x48, 0x00
+};
@@ -1,5 +1,7 @@
 #pragma once
-const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
+#include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/hy_dict_index.h>
+const unsigned char __espeakng_dict_hy[] __attribute__((aligned((4)))) = {
   0x00, 0x04, 0x00, 0x00, 0xe8, 0xef, 0x00, 0x00, 0x00, 0x54, 0x19, 0xf0,
   0x9f, 0x91, 0xa9, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xe2, 0x80,
   0x8d, 0xf0, 0x9f, 0x91, 0xa7, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa7,
@@ -5190,4 +5192,11 @@ const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
   0x00, 0x07, 0x06, 0x01, 0x57, 0x00, 0x03, 0x54, 0x00, 0x08, 0x02, 0x11,
   0x42, 0x03, 0x54, 0x0d, 0x00, 0x07, 0x00
 };
-size_t __espeakng_dictlen = 62263;
+
+BackgroundAudioDictionary dict_hy = {
+    "hy",
+    62263,
+    __espeakng_dict_hy,
+    7496,
+    __espeakng_dictindex_hy
+};
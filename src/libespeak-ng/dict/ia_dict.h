@@ -1,5 +1,7 @@
 #pragma once
-const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
+#include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/ia_dict_index.h>
+const unsigned char __espeakng_dict_ia[] __attribute__((aligned((4)))) = {
   0x00, 0x04, 0x00, 0x00, 0x4d, 0x0c, 0x05, 0x00, 0x12, 0x46, 0x4d, 0x93,
   0x8f, 0x41, 0x32, 0x53, 0x5a, 0x25, 0x32, 0x06, 0x27, 0x30, 0x5a, 0x25,
   0x5a, 0x00, 0x12, 0x46, 0x38, 0x55, 0x52, 0x3d, 0x32, 0x53, 0x32, 0x24,
@@ -27608,4 +27610,11 @@ const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
   0x41, 0x00, 0x07, 0x06, 0x7a, 0x00, 0x02, 0x7a, 0x03, 0x00, 0x03, 0x59,
   0x00, 0x07, 0x00
 };
-size_t __espeakng_dictlen = 331275;
+
+BackgroundAudioDictionary dict_ia = {
+    "ia",
+    331275,
+    __espeakng_dict_ia,
+    49198,
+    __espeakng_dictindex_ia
+};
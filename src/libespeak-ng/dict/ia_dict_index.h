@@ -0,0 +1,4103 @@
+#pragma once
+const unsigned char __espeakng_dictindex_ia[] __attribute__((aligned((4)))) = {
+  0x45, 0x44, 0x58, 0x31, 0x0b, 0x0e, 0x05, 0x00, 0x4d, 0x0c, 0x05, 0x00,
+  0x5e, 0x3d, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x1d, 0x00, 0x20, 0x00,
+  0x2b, 0x00, 0x37, 0x00, 0x49, 0x00, 0x52, 0x00, 0x67, 0x00, 0x68, 0x00,
+  0x78, 0x00, 0x81, 0x00, 0xa5, 0x00, 0xab, 0x00, 0xce, 0x00, 0x0c, 0x01,
+  0x1b, 0x01, 0x2d, 0x01, 0x47, 0x01, 0x4d, 0x01, 0x57, 0x01, 0x5a, 0x01,
+  0x62, 0x01, 0x77, 0x01, 0x7a, 0x01, 0x7e, 0x01, 0x88, 0x01, 0xac, 0x01,
+  0xcd, 0x01, 0xdf, 0x01, 0xe8, 0x01, 0xee, 0x01, 0xfe, 0x01, 0x10, 0x02,
+  0x2d, 0x02, 0x36, 0x02, 0x3e, 0x02, 0x3e, 0x02, 0x44, 0x02, 0x4b, 0x02,
+  0x5c, 0x02, 0x64, 0x02, 0x6d, 0x02, 0x7d, 0x02, 0x86, 0x02, 0x93, 0x02,
+  0xb9, 0x02, 0xd9, 0x02, 0xdf, 0x02, 0xeb, 0x02, 0xf7, 0x02, 0x03, 0x03,
+  0x0b, 0x03, 0x0f, 0x03, 0x19, 0x03, 0x1b, 0x03, 0x21, 0x03, 0x3f, 0x03,
+  0x53, 0x03, 0x86, 0x03, 0x9e, 0x03, 0xac, 0x03, 0xba, 0x03, 0xc6, 0x03,
+  0xe2, 0x03, 0xe7, 0x03, 0x23, 0x04, 0x26, 0x04, 0x2a, 0x04, 0x2e, 0x04,
+  0x34, 0x04, 0x35, 0x04, 0x3c, 0x04, 0x42, 0x04, 0x4f, 0x04, 0x63, 0x04,
+  0x76, 0x04, 0x80, 0x04, 0x8e, 0x04, 0xc2, 0x04, 0xc5, 0x04, 0xd9, 0x04,
+  0xe3, 0x04, 0xf3, 0x04, 0xf7, 0x04, 0xfc, 0x04, 0xff, 0x04, 0x09, 0x05,
+  0x1c, 0x05, 0x56, 0x05, 0x5c, 0x05, 0x6e, 0x05, 0x72, 0x05, 0x98, 0x05,
+  0xa4, 0x05, 0xa7, 0x05, 0xa8, 0x05, 0xa9, 0x05, 0xba, 0x05, 0xcf, 0x05,
+  0xd0, 0x05, 0xd0, 0x05, 0xd3, 0x05, 0xd6, 0x05, 0xf7, 0x05, 0x07, 0x06,
+  0x0e, 0x06, 0x1e, 0x06, 0x23, 0x06, 0x32, 0x06, 0x33, 0x06, 0x55, 0x06,
+  0x5c, 0x06, 0x61, 0x06, 0x81, 0x06, 0x82, 0x06, 0xc9, 0x06, 0xd1, 0x06,
+  0xe3, 0x06, 0xe7, 0x06, 0xf6, 0x06, 0x06, 0x07, 0x0f, 0x07, 0x19, 0x07,
+  0x27, 0x07, 0x3a, 0x07, 0x42, 0x07, 0x47, 0x07, 0x49, 0x07, 0x54, 0x07,
+  0x63, 0x07, 0x6b, 0x07, 0x77, 0x07, 0x79, 0x07, 0x7d, 0x07, 0x7e, 0x07,
+  0x95, 0x07, 0xad, 0x07, 0xb3, 0x07, 0xb5, 0x07, 0xba, 0x07, 0xd7, 0x07,
+  0x28, 0x08, 0x48, 0x08, 0x59, 0x08, 0x64, 0x08, 0xc2, 0x08, 0xc3, 0x08,
+  0x0a, 0x09, 0x0c, 0x09, 0x12, 0x09, 0x14, 0x09, 0x17, 0x09, 0x1b, 0x09,
+  0x3b, 0x09, 0x57, 0x09, 0x5c, 0x09, 0x6a, 0x09, 0x6f, 0x09, 0x76, 0x09,
+  0x82, 0x09, 0x88, 0x09, 0x91, 0x09, 0x94, 0x09, 0xb0, 0x09, 0xb4, 0x09,
+  0xb4, 0x09, 0xb7, 0x09, 0xce, 0x09, 0xf2, 0x09, 0xfe, 0x09, 0x24, 0x0a,
+  0x26, 0x0a, 0x32, 0x0a, 0x3b, 0x0a, 0x59, 0x0a, 0x63, 0x0a, 0x66, 0x0a,
+  0x71, 0x0a, 0x72, 0x0a, 0xa8, 0x0a, 0xc2, 0x0a, 0xff, 0x0a, 0xff, 0x0a,
+  0x1b, 0x0b, 0x3f, 0x0b, 0x64, 0x0b, 0xdf, 0x0b, 0xec, 0x0b, 0xf1, 0x0b,
+  0xf3, 0x0b, 0xf6, 0x0b, 0xfc, 0x0b, 0xfe, 0x0b, 0x09, 0x0c, 0x0c, 0x0c,
+  0x17, 0x0c, 0x1d, 0x0c, 0x2f, 0x0c, 0x34, 0x0c, 0x50, 0x0c, 0x6d, 0x0c,
+  0x7f, 0x0c, 0x83, 0x0c, 0x88, 0x0c, 0x8d, 0x0c, 0x8f, 0x0c, 0x9a, 0x0c,
+  0xdb, 0x0c, 0xde, 0x0c, 0xec, 0x0c, 0xee, 0x0c, 0x0e, 0x0d, 0x26, 0x0d,
+  0x66, 0x0d, 0x74, 0x0d, 0x7c, 0x0d, 0x5b, 0x0e, 0x6c, 0x0e, 0x8c, 0x0e,
+  0x92, 0x0e, 0xa4, 0x0e, 0xa9, 0x0e, 0xb0, 0x0e, 0xb1, 0x0e, 0xb3, 0x0e,
+  0xb8, 0x0e, 0xbb, 0x0e, 0xc5, 0x0e, 0xcd, 0x0e, 0xd1, 0x0e, 0xd2, 0x0e,
+  0xef, 0x0e, 0xfd, 0x0e, 0x08, 0x0f, 0x1b, 0x0f, 0x40, 0x0f, 0x42, 0x0f,
+  0x4b, 0x0f, 0x5c, 0x0f, 0x68, 0x0f, 0x72, 0x0f, 0x84, 0x0f, 0x84, 0x0f,
+  0x95, 0x0f, 0xa5, 0x0f, 0xac, 0x0f, 0xaf, 0x0f, 0xbc, 0x0f, 0xc7, 0x0f,
+  0xd7, 0x0f, 0xe5, 0x0f, 0xec, 0x0f, 0xf7, 0x0f, 0xfb, 0x0f, 0xff, 0x0f,
+  0x0d, 0x10, 0x0e, 0x10, 0x10, 0x10, 0x10, 0x10, 0x17, 0x10, 0x1f, 0x10,
+  0x25, 0x10, 0x3e, 0x10, 0x4f, 0x10, 0x57, 0x10, 0x5f, 0x10, 0x7b, 0x10,
+  0x81, 0x10, 0x8f, 0x10, 0xa0, 0x10, 0xb4, 0x10, 0xb4, 0x10, 0xe0, 0x10,
+  0xe1, 0x10, 0x31, 0x11, 0x37, 0x11, 0x40, 0x11, 0x40, 0x11, 0x44, 0x11,
+  0x48, 0x11, 0x5e, 0x11, 0x7f, 0x11, 0x88, 0x11, 0x92, 0x11, 0xa2, 0x11,
+  0xa7, 0x11, 0xb9, 0x11, 0xc2, 0x11, 0xd4, 0x11, 0xd7, 0x11, 0xe0, 0x11,
+  0xe8, 0x11, 0xf4, 0x11, 0xf4, 0x11, 0x0b, 0x12, 0x11, 0x12, 0x36, 0x12,
+  0x3c, 0x12, 0x4b, 0x12, 0x50, 0x12, 0x56, 0x12, 0x68, 0x12, 0x6c, 0x12,
+  0x70, 0x12, 0x7f, 0x12, 0x80, 0x12, 0xab, 0x12, 0xc6, 0x12, 0x31, 0x13,
+  0x35, 0x13, 0x48, 0x13, 0x65, 0x13, 0x77, 0x13, 0x1d, 0x14, 0x5a, 0x14,
+  0x62, 0x14, 0x68, 0x14, 0x6b, 0x14, 0x79, 0x14, 0x7c, 0x14, 0x83, 0x14,
+  0x88, 0x14, 0x94, 0x14, 0x9e, 0x14, 0xa2, 0x14, 0xa9, 0x14, 0xac, 0x14,
+  0xb1, 0x14, 0xc5, 0x14, 0xcb, 0x14, 0xd7, 0x14, 0xd9, 0x14, 0xdf, 0x14,
+  0xea, 0x14, 0x3b, 0x15, 0x3f, 0x15, 0x4c, 0x15, 0x4d, 0x15, 0x6a, 0x15,
+  0x87, 0x15, 0xd3, 0x15, 0xf3, 0x15, 0x01, 0x16, 0xae, 0x16, 0xcf, 0x16,
+  0xe5, 0x16, 0xf6, 0x16, 0xfa, 0x16, 0x06, 0x17, 0x0a, 0x17, 0x11, 0x17,
+  0x15, 0x17, 0x22, 0x17, 0x23, 0x17, 0x2c, 0x17, 0x32, 0x17, 0x3b, 0x17,
+  0x4c, 0x17, 0x55, 0x17, 0x64, 0x17, 0x75, 0x17, 0x95, 0x17, 0x97, 0x17,
+  0xa5, 0x17, 0xca, 0x17, 0xec, 0x17, 0xff, 0x17, 0x0a, 0x18, 0x22, 0x18,
+  0x26, 0x18, 0x38, 0x18, 0x48, 0x18, 0x5e, 0x18, 0x6a, 0x18, 0x84, 0x18,
+  0x90, 0x18, 0xb1, 0x18, 0xbb, 0x18, 0xce, 0x18, 0xdc, 0x18, 0xde, 0x18,
+  0xdf, 0x18, 0xe0, 0x18, 0xe3, 0x18, 0xe8, 0x18, 0xf4, 0x18, 0xf9, 0x18,
+  0x0e, 0x19, 0x17, 0x19, 0x22, 0x19, 0x2b, 0x19, 0x33, 0x19, 0x35, 0x19,
+  0x3a, 0x19, 0x3d, 0x19, 0x60, 0x19, 0x68, 0x19, 0x70, 0x19, 0x8f, 0x19,
+  0x91, 0x19, 0x92, 0x19, 0xae, 0x19, 0xef, 0x19, 0xf4, 0x19, 0xf9, 0x19,
+  0x05, 0x1a, 0x07, 0x1a, 0x0c, 0x1a, 0x1f, 0x1a, 0x47, 0x1a, 0x55, 0x1a,
+  0x64, 0x1a, 0x70, 0x1a, 0x7b, 0x1a, 0x7f, 0x1a, 0x82, 0x1a, 0x82, 0x1a,
+  0xc2, 0x1a, 0xc4, 0x1a, 0xcd, 0x1a, 0xdc, 0x1a, 0xe5, 0x1a, 0xf0, 0x1a,
+  0x05, 0x1b, 0x22, 0x1b, 0x35, 0x1b, 0x4d, 0x1b, 0x56, 0x1b, 0x58, 0x1b,
+  0x5b, 0x1b, 0x5d, 0x1b, 0x61, 0x1b, 0x63, 0x1b, 0x75, 0x1b, 0x7f, 0x1b,
+  0x86, 0x1b, 0xa7, 0x1b, 0xca, 0x1b, 0xe1, 0x1b, 0xed, 0x1b, 0x1c, 0x1c,
+  0x3b, 0x1c, 0x74, 0x1c, 0x78, 0x1c, 0x8b, 0x1c, 0x94, 0x1c, 0x95, 0x1c,
+  0x9a, 0x1c, 0xa2, 0x1c, 0xa8, 0x1c, 0xad, 0x1c, 0xaf, 0x1c, 0xd4, 0x1c,
+  0xdd, 0x1c, 0xee, 0x1c, 0x09, 0x1d, 0x0b, 0x1d, 0x13, 0x1d, 0x28, 0x1d,
+  0xe8, 0x1d, 0xf5, 0x1d, 0xf7, 0x1d, 0x07, 0x1e, 0x09, 0x1e, 0x0e, 0x1e,
+  0x0f, 0x1e, 0x16, 0x1e, 0x1c, 0x1e, 0x26, 0x1e, 0x6f, 0x1e, 0x76, 0x1e,
+  0x85, 0x1e, 0x8a, 0x1e, 0x95, 0x1e, 0xbd, 0x1e, 0xc7, 0x1e, 0xd4, 0x1e,
+  0xdf, 0x1e, 0xe4, 0x1e, 0xe8, 0x1e, 0x03, 0x1f, 0x06, 0x1f, 0x0f, 0x1f,
+  0x14, 0x1f, 0x25, 0x1f, 0x2b, 0x1f, 0x3c, 0x1f, 0x3f, 0x1f, 0x54, 0x1f,
+  0x57, 0x1f, 0x7e, 0x1f, 0x89, 0x1f, 0x9f, 0x1f, 0xb0, 0x1f, 0xc7, 0x1f,
+  0xd0, 0x1f, 0xeb, 0x1f, 0xec, 0x1f, 0xf2, 0x1f, 0xf8, 0x1f, 0x01, 0x20,
+  0x0a, 0x20, 0x27, 0x20, 0x33, 0x20, 0x4b, 0x20, 0x50, 0x20, 0x58, 0x20,
+  0x65, 0x20, 0x68, 0x20, 0x73, 0x20, 0x73, 0x20, 0x74, 0x20, 0x7b, 0x20,
+  0x81, 0x20, 0x85, 0x20, 0x93, 0x20, 0x95, 0x20, 0x95, 0x20, 0x98, 0x20,
+  0xb1, 0x20, 0xb5, 0x20, 0xc6, 0x20, 0xcb, 0x20, 0xdb, 0x20, 0xe0, 0x20,
+  0x12, 0x21, 0x12, 0x21, 0x48, 0x21, 0x55, 0x21, 0x5a, 0x21, 0x65, 0x21,
+  0x90, 0x21, 0x92, 0x21, 0x99, 0x21, 0xac, 0x21, 0xaf, 0x21, 0xc5, 0x21,
+  0xcf, 0x21, 0xd7, 0x21, 0xf5, 0x21, 0x14, 0x22, 0x23, 0x22, 0x33, 0x22,
+  0x42, 0x22, 0x49, 0x22, 0x5b, 0x22, 0x68, 0x22, 0x72, 0x22, 0x7d, 0x22,
+  0x7e, 0x22, 0x83, 0x22, 0x8a, 0x22, 0x91, 0x22, 0xb0, 0x22, 0xb3, 0x22,
+  0xbd, 0x22, 0xc3, 0x22, 0xc8, 0x22, 0xc8, 0x22, 0xcc, 0x22, 0xf0, 0x22,
+  0xf4, 0x22, 0xfe, 0x22, 0x1f, 0x23, 0x26, 0x23, 0x37, 0x23, 0x4e, 0x23,
+  0x78, 0x23, 0xcc, 0x23, 0x13, 0x24, 0x1c, 0x24, 0x2f, 0x24, 0x34, 0x24,
+  0x40, 0x24, 0x44, 0x24, 0x4e, 0x24, 0x56, 0x24, 0x66, 0x24, 0x6c, 0x24,
+  0x6f, 0x24, 0x71, 0x24, 0x76, 0x24, 0x7f, 0x24, 0x8b, 0x24, 0x93, 0x24,
+  0x99, 0x24, 0x99, 0x24, 0xa5, 0x24, 0xa7, 0x24, 0xa7, 0x24, 0xaf, 0x24,
+  0xb4, 0x24, 0xcb, 0x24, 0xd4, 0x24, 0xe2, 0x24, 0x11, 0x25, 0x19, 0x25,
+  0x75, 0x25, 0x91, 0x25, 0x9a, 0x25, 0xb8, 0x25, 0xd2, 0x25, 0xf3, 0x25,
+  0xf9, 0x25, 0x03, 0x26, 0x0a, 0x26, 0x11, 0x26, 0x17, 0x26, 0x18, 0x26,
+  0x1c, 0x26, 0x28, 0x26, 0x3f, 0x26, 0x44, 0x26, 0x47, 0x26, 0x53, 0x26,
+  0x55, 0x26, 0x93, 0x26, 0xa3, 0x26, 0xbc, 0x26, 0xc5, 0x26, 0xc7, 0x26,
+  0xd1, 0x26, 0xec, 0x26, 0x05, 0x27, 0x05, 0x27, 0x08, 0x27, 0x09, 0x27,
+  0x0a, 0x27, 0x0f, 0x27, 0x11, 0x27, 0x14, 0x27, 0x28, 0x27, 0x50, 0x27,
+  0x53, 0x27, 0x59, 0x27, 0x69, 0x27, 0x6b, 0x27, 0x71, 0x27, 0x72, 0x27,
+  0x75, 0x27, 0x7b, 0x27, 0x7e, 0x27, 0x87, 0x27, 0x99, 0x27, 0xa4, 0x27,
+  0xa9, 0x27, 0xbf, 0x27, 0xc0, 0x27, 0x05, 0x28, 0x11, 0x28, 0x25, 0x28,
+  0x29, 0x28, 0x2c, 0x28, 0x2c, 0x28, 0x62, 0x28, 0x67, 0x28, 0x8e, 0x28,
+  0x93, 0x28, 0x9c, 0x28, 0x9e, 0x28, 0xb1, 0x28, 0xb6, 0x28, 0xbe, 0x28,
+  0xc2, 0x28, 0xea, 0x28, 0xea, 0x28, 0xef, 0x28, 0xf8, 0x28, 0xff, 0x28,
+  0x05, 0x29, 0x12, 0x29, 0x1c, 0x29, 0x28, 0x29, 0x2b, 0x29, 0x32, 0x29,
+  0x3f, 0x29, 0x73, 0x29, 0x77, 0x29, 0x83, 0x29, 0x87, 0x29, 0x93, 0x29,
+  0xa2, 0x29, 0xbf, 0x29, 0xea, 0x29, 0xef, 0x29, 0xf2, 0x29, 0x18, 0x2a,
+  0x25, 0x2a, 0x35, 0x2a, 0x3b, 0x2a, 0x43, 0x2a, 0x4e, 0x2a, 0x51, 0x2a,
+  0x68, 0x2a, 0x78, 0x2a, 0x8b, 0x2a, 0xcb, 0x2a, 0xd4, 0x2a, 0xe3, 0x2a,
+  0xe7, 0x2a, 0xec, 0x2a, 0xf1, 0x2a, 0xfb, 0x2a, 0xfd, 0x2a, 0x00, 0x2b,
+  0x02, 0x2b, 0x05, 0x2b, 0x16, 0x2b, 0x18, 0x2b, 0x23, 0x2b, 0x29, 0x2b,
+  0x2b, 0x2b, 0x3e, 0x2b, 0x45, 0x2b, 0x63, 0x2b, 0x65, 0x2b, 0x74, 0x2b,
+  0x76, 0x2b, 0xa2, 0x2b, 0xb5, 0x2b, 0xbd, 0x2b, 0xbf, 0x2b, 0xc0, 0x2b,
+  0xc6, 0x2b, 0xcb, 0x2b, 0xcc, 0x2b, 0xd5, 0x2b, 0xde, 0x2b, 0x09, 0x2c,
+  0x0e, 0x2c, 0x15, 0x2c, 0x1a, 0x2c, 0x29, 0x2c, 0x32, 0x2c, 0x39, 0x2c,
+  0x3f, 0x2c, 0x42, 0x2c, 0x48, 0x2c, 0x4f, 0x2c, 0x72, 0x2c, 0x72, 0x2c,
+  0x72, 0x2c, 0x76, 0x2c, 0x8e, 0x2c, 0xa5, 0x2c, 0xb9, 0x2c, 0xc9, 0x2c,
+  0xe5, 0x2c, 0xe8, 0x2c, 0x04, 0x2d, 0x11, 0x2d, 0x1e, 0x2d, 0x2a, 0x2d,
+  0x2e, 0x2d, 0x56, 0x2d, 0x63, 0x2d, 0x67, 0x2d, 0x6e, 0x2d, 0x84, 0x2d,
+  0xb5, 0x2d, 0xb9, 0x2d, 0xc3, 0x2d, 0xc9, 0x2d, 0xd0, 0x2d, 0xd2, 0x2d,
+  0xd5, 0x2d, 0xd8, 0x2d, 0xda, 0x2d, 0xdf, 0x2d, 0xe0, 0x2d, 0xed, 0x2d,
+  0xf1, 0x2d, 0xf4, 0x2d, 0xfe, 0x2d, 0x42, 0x2e, 0x47, 0x2e, 0x8f, 0x2e,
+  0x96, 0x2e, 0xaa, 0x2e, 0xaf, 0x2e, 0xdb, 0x2e, 0xde, 0x2e, 0xe7, 0x2e,
+  0xf4, 0x2e, 0xf9, 0x2e, 0x0c, 0x2f, 0x0f, 0x2f, 0x31, 0x2f, 0x45, 0x2f,
+  0x4f, 0x2f, 0x54, 0x2f, 0x6c, 0x2f, 0x71, 0x2f, 0x7b, 0x2f, 0x80, 0x2f,
+  0x85, 0x2f, 0x8a, 0x2f, 0xb0, 0x2f, 0xbf, 0x2f, 0xc1, 0x2f, 0xc5, 0x2f,
+  0xce, 0x2f, 0xd2, 0x2f, 0xd5, 0x2f, 0xd9, 0x2f, 0xde, 0x2f, 0xdf, 0x2f,
+  0xed, 0x2f, 0xf1, 0x2f, 0xf2, 0x2f, 0x04, 0x30, 0x07, 0x30, 0x0e, 0x30,
+  0x16, 0x30, 0x26, 0x30, 0x34, 0x30, 0x36, 0x30, 0x3e, 0x30, 0x43, 0x30,
+  0x4b, 0x30, 0x4f, 0x30, 0x67, 0x30, 0x7b, 0x30, 0xb2, 0x30, 0xd6, 0x30,
+  0xdb, 0x30, 0xed, 0x30, 0xef, 0x30, 0xf3, 0x30, 0xf6, 0x30, 0x08, 0x31,
+  0x15, 0x31, 0x1d, 0x31, 0x24, 0x31, 0x39, 0x31, 0x3f, 0x31, 0x40, 0x31,
+  0x45, 0x31, 0x47, 0x31, 0x49, 0x31, 0x4e, 0x31, 0x50, 0x31, 0x5c, 0x31,
+  0x5d, 0x31, 0x62, 0x31, 0xd4, 0x31, 0xd8, 0x31, 0xe6, 0x31, 0xe9, 0x31,
+  0xef, 0x31, 0xf0, 0x31, 0xfd, 0x31, 0x08, 0x32, 0x1a, 0x32, 0x2a, 0x32,
+  0x61, 0x32, 0x6c, 0x32, 0x74, 0x32, 0x7a, 0x32, 0x8a, 0x32, 0x97, 0x32,
+  0x9c, 0x32, 0xa3, 0x32, 0xad, 0x32, 0xb4, 0x32, 0xbb, 0x32, 0xcb, 0x32,
+  0xd9, 0x32, 0xd9, 0x32, 0xe1, 0x32, 0xe3, 0x32, 0x24, 0x33, 0x2b, 0x33,
+  0x3e, 0x33, 0x41, 0x33, 0x75, 0x33, 0x80, 0x33, 0xa8, 0x33, 0xa9, 0x33,
+  0xad, 0x33, 0xaf, 0x33, 0xb3, 0x33, 0xb7, 0x33, 0xbf, 0x33, 0xdc, 0x33,
+  0xe4, 0x33, 0xf4, 0x33, 0x15, 0x34, 0x23, 0x34, 0x2b, 0x34, 0x43, 0x34,
+  0x43, 0x34, 0x48, 0x34, 0x4c, 0x34, 0x4d, 0x34, 0x5a, 0x34, 0x63, 0x34,
+  0x6c, 0x34, 0x73, 0x34, 0x7b, 0x34, 0x8a, 0x34, 0x93, 0x34, 0x95, 0x34,
+  0xde, 0x34, 0xe4, 0x34, 0x05, 0x35, 0x12, 0x35, 0x23, 0x35, 0x41, 0x35,
+  0x6f, 0x35, 0x73, 0x35, 0x7e, 0x35, 0x7f, 0x35, 0x81, 0x35, 0x89, 0x35,
+  0x8a, 0x35, 0xae, 0x35, 0xb3, 0x35, 0xde, 0x35, 0xf3, 0x35, 0xfa, 0x35,
+  0x0f, 0x36, 0x27, 0x36, 0x2a, 0x36, 0x31, 0x36, 0x3e, 0x36, 0x42, 0x36,
+  0x4e, 0x36, 0x5b, 0x36, 0x71, 0x36, 0x78, 0x36, 0x81, 0x36, 0x91, 0x36,
+  0xb9, 0x36, 0xc7, 0x36, 0xd3, 0x36, 0xe3, 0x36, 0x07, 0x37, 0x18, 0x37,
+  0x34, 0x37, 0x38, 0x37, 0x60, 0x37, 0x65, 0x37, 0x68, 0x37, 0x6f, 0x37,
+  0x8d, 0x37, 0x98, 0x37, 0xc0, 0x37, 0xc8, 0x37, 0xeb, 0x37, 0x26, 0x38,
+  0x2f, 0x38, 0x81, 0x38, 0xa1, 0x38, 0xba, 0x38, 0xd6, 0x38, 0xe0, 0x38,
+  0xe2, 0x38, 0xe2, 0x38, 0xea, 0x38, 0xf3, 0x38, 0xff, 0x38, 0x0f, 0x39,
+  0x1c, 0x39, 0x1e, 0x39, 0x30, 0x39, 0x4f, 0x39, 0x5d, 0x39, 0x5f, 0x39,
+  0x81, 0x39, 0x8c, 0x39, 0xbb, 0x39, 0xf8, 0x39, 0x1a, 0x3a, 0x1b, 0x3a,
+  0x1e, 0x3a, 0x2a, 0x3a, 0x5b, 0x3a, 0x5f, 0x3a, 0x66, 0x3a, 0x6e, 0x3a,
+  0xf2, 0x3a, 0x34, 0x3b, 0x35, 0x3b, 0xa8, 0x3b, 0xbd, 0x3b, 0xbf, 0x3b,
+  0xd1, 0x3b, 0xd7, 0x3b, 0xdc, 0x3b, 0xe1, 0x3b, 0xe8, 0x3b, 0xf0, 0x3b,
+  0xfa, 0x3b, 0xff, 0x3b, 0x13, 0x3c, 0x14, 0x3c, 0x2b, 0x3c, 0x3f, 0x3c,
+  0x42, 0x3c, 0x59, 0x3c, 0x5f, 0x3c, 0x79, 0x3c, 0x90, 0x3c, 0xba, 0x3c,
+  0xc4, 0x3c, 0xce, 0x3c, 0xd0, 0x3c, 0xda, 0x3c, 0xdd, 0x3c, 0xe7, 0x3c,
+  0xec, 0x3c, 0x14, 0x3d, 0x1c, 0x3d, 0x27, 0x3d, 0x2e, 0x3d, 0x2f, 0x3d,
+  0x39, 0x3d, 0x3c, 0x3d, 0x3e, 0x3d, 0x44, 0x3d, 0x45, 0x3d, 0x4d, 0x3d,
+  0x5e, 0x3d, 0x00, 0x00, 0xc3, 0x49, 0x58, 0xdb, 0x7a, 0x71, 0x1a, 0xad,
+  0xcc, 0x58, 0xd9, 0x5d, 0x32, 0xa2, 0x43, 0x96, 0x02, 0x5e, 0x8e, 0x27,
+  0x35, 0x3e, 0x27, 0x4f, 0x9b, 0x4a, 0xd4, 0x0e, 0x1e, 0xc9, 0xd9, 0xd1,
+  0xa7, 0xcc, 0x89, 0x68, 0x4a, 0xe0, 0xfe, 0x64, 0xc8, 0x76, 0xfc, 0x4a,
+  0xb8, 0xee, 0x85, 0x06, 0x92, 0xcf, 0x12, 0x6c, 0x34, 0x65, 0xe3, 0x17,
+  0x36, 0xba, 0x85, 0x65, 0xc3, 0x7b, 0xc0, 0x08, 0x2c, 0xcc, 0xbf, 0xc2,
+  0xea, 0xf5, 0xd2, 0xba, 0xd9, 0xe8, 0x54, 0x90, 0x5a, 0xf7, 0x61, 0xb2,
+  0x01, 0x24, 0x02, 0xf2, 0x61, 0x87, 0xd8, 0xa1, 0x2a, 0x98, 0x94, 0xbc,
+  0xe2, 0xc5, 0xee, 0xa5, 0xff, 0xde, 0xf1, 0xe6, 0x6b, 0xcf, 0x11, 0x27,
+  0x4d, 0x32, 0xaa, 0x55, 0xf9, 0x6c, 0x1f, 0x1f, 0x23, 0x58, 0xa1, 0x91,
+  0x13, 0x6b, 0x1a, 0x6a, 0x7b, 0x24, 0x94, 0x20, 0xce, 0xb9, 0xa2, 0x47,
+  0x34, 0xec, 0x3e, 0x06, 0x53, 0x0b, 0x83, 0xdd, 0x9a, 0x71, 0x9f, 0x9d,
+  0x30, 0x81, 0xc0, 0x51, 0xb5, 0x0b, 0x1a, 0xcf, 0x85, 0x4d, 0x11, 0x0a,
+  0xe0, 0x76, 0x56, 0x89, 0xb7, 0xb7, 0x6d, 0xed, 0x3d, 0x3a, 0x48, 0x16,
+  0x90, 0x06, 0x15, 0x1e, 0xda, 0xa6, 0xa9, 0xbb, 0xd0, 0xff, 0xff, 0x52,
+  0x9b, 0x4e, 0x9f, 0x67, 0xd9, 0x44, 0x41, 0x28, 0xbf, 0x5b, 0xb3, 0xe8,
+  0xe2, 0xf7, 0x14, 0x9f, 0xbf, 0xb3, 0xb8, 0x41, 0x1e, 0x07, 0x35, 0x3c,
+  0x4f, 0x4b, 0x79, 0xf5, 0xd8, 0x13, 0xe2, 0x24, 0x55, 0x77, 0x83, 0xfa,
+  0xd3, 0x9a, 0x2c, 0x39, 0x87, 0xb0, 0x6b, 0x2f, 0xbd, 0x57, 0xd8, 0xb1,
+  0x40, 0x41, 0x1e, 0x69, 0x09, 0x08, 0x05, 0x00, 0x45, 0x05, 0x6e, 0x71,
+  0x51, 0x00, 0x36, 0xd6, 0xe2, 0xe9, 0x98, 0xd6, 0x83, 0x88, 0xdf, 0x93,
+  0x93, 0xee, 0x99, 0x20, 0x1c, 0x95, 0x12, 0x58, 0xcf, 0x3f, 0x0b, 0x70,
+  0xc8, 0x28, 0x63, 0x58, 0x25, 0xd3, 0x5e, 0x3b, 0xef, 0xd2, 0x77, 0xef,
+  0xfc, 0xc1, 0x2b, 0xc5, 0xe0, 0x2d, 0x58, 0xcb, 0x31, 0x56, 0x30, 0x56,
+  0x52, 0xa6, 0xfb, 0x44, 0x2a, 0x61, 0xe3, 0x5b, 0x78, 0xb6, 0x3f, 0xea,
+  0xed, 0x41, 0x8e, 0xa3, 0x0f, 0x67, 0xfd, 0x42, 0x8b, 0x52, 0xdb, 0x59,
+  0xc3, 0xf8, 0x7f, 0xd9, 0xec, 0xe1, 0x17, 0x74, 0x96, 0xa4, 0x63, 0x0a,
+  0x1d, 0xa2, 0x69, 0x56, 0x3a, 0x35, 0x59, 0x23, 0xb0, 0x38, 0xa6, 0xf4,
+  0xc2, 0xd3, 0x7d, 0x40, 0x27, 0xb6, 0x8e, 0xce, 0x66, 0xac, 0x8f, 0x4e,
+  0x46, 0x75, 0x3d, 0x4c, 0x9a, 0xf4, 0x67, 0x31, 0xc0, 0xc0, 0x5f, 0x1f,
+  0xcb, 0xf5, 0xc0, 0x80, 0x2d, 0x08, 0xb6, 0xcc, 0x4b, 0x09, 0x3a, 0xe0,
+  0x04, 0x49, 0x2b, 0x15, 0x75, 0xdb, 0xfc, 0xc2, 0xc2, 0x92, 0x40, 0xdf,
+  0xfc, 0x82, 0x94, 0x62, 0x2f, 0x2b, 0xb3, 0xb5, 0xc3, 0x58, 0x5d, 0x2e,
+  0xcb, 0xdf, 0xd2, 0x0f, 0x2e, 0x27, 0x49, 0x24, 0x21, 0xf8, 0x04, 0x46,
+  0x0b, 0x35, 0xf1, 0x22, 0x8d, 0x9d, 0xb7, 0xc6, 0x78, 0xaf, 0x53, 0xd8,
+  0x54, 0x25, 0x25, 0xa2, 0x9e, 0xef, 0xae, 0xd4, 0xdb, 0xb5, 0xff, 0x5a,
+  0xa9, 0x6c, 0x79, 0x81, 0xc3, 0xa0, 0x38, 0xee, 0x9f, 0x52, 0x3e, 0x3f,
+  0x2e, 0x5d, 0x67, 0x59, 0x46, 0x36, 0x6d, 0xa8, 0x9d, 0x1d, 0x78, 0xf5,
+  0x03, 0x6e, 0x60, 0xea, 0x0e, 0xaf, 0xcf, 0xd9, 0x70, 0x94, 0x2c, 0x77,
+  0xbf, 0x52, 0x63, 0xa8, 0x05, 0x14, 0xf6, 0x5e, 0x43, 0x4c, 0x8a, 0x65,
+  0x4e, 0x1e, 0xe1, 0x42, 0x46, 0x76, 0xcb, 0x63, 0x6d, 0x76, 0x87, 0x00,
+  0x1a, 0xeb, 0x01, 0x6b, 0x1f, 0x46, 0xae, 0xe8, 0xa8, 0x47, 0x46, 0xf3,
+  0x53, 0xbf, 0x22, 0x65, 0x82, 0x98, 0xfa, 0xd7, 0x34, 0x3c, 0xe9, 0x12,
+  0x01, 0xdf, 0xf5, 0x7d, 0xee, 0x55, 0xcd, 0x1b, 0x94, 0x00, 0xa1, 0x79,
+  0x31, 0xa9, 0x59, 0x97, 0x6e, 0xed, 0xfc, 0x57, 0xd5, 0xf3, 0x41, 0xc4,
+  0x2d, 0xcb, 0xb0, 0x1d, 0x02, 0x67, 0xd9, 0x32, 0x0f, 0x33, 0xe0, 0x5e,
+  0xc7, 0x43, 0xea, 0x33, 0x67, 0xed, 0x7e, 0x7e, 0x78, 0x69, 0x53, 0x52,
+  0x52, 0x27, 0x75, 0x73, 0x91, 0x6d, 0x75, 0x68, 0x50, 0x46, 0xd9, 0x85,
+  0xec, 0x88, 0x90, 0xb8, 0xbf, 0xf1, 0x21, 0x55, 0x01, 0x01, 0x0e, 0x2f,
+  0x32, 0x54, 0x30, 0x60, 0x40, 0x46, 0xd1, 0x2d, 0xfa, 0x46, 0x89, 0x60,
+  0xb2, 0x0e, 0xcb, 0x7c, 0xff, 0x7d, 0x19, 0xe9, 0xad, 0x22, 0xd5, 0xc5,
+  0x67, 0x4d, 0xfa, 0x9e, 0x13, 0x7a, 0xac, 0x66, 0x63, 0xec, 0x5a, 0xca,
+  0x3d, 0x70, 0x62, 0x57, 0x1d, 0x19, 0x1b, 0x5a, 0x57, 0x7b, 0xff, 0x26,
+  0x40, 0xe4, 0xd9, 0x65, 0xa1, 0x70, 0x42, 0x7a, 0x9b, 0x13, 0xc7, 0xd5,
+  0x04, 0xa6, 0x4a, 0x15, 0xf6, 0xff, 0x09, 0xff, 0xff, 0xc7, 0xdd, 0x3e,
+  0xaf, 0xa3, 0xea, 0xa9, 0x2c, 0x43, 0xa0, 0x5d, 0x41, 0x9a, 0x40, 0x40,
+  0xb5, 0xfd, 0x34, 0x19, 0xc3, 0xdf, 0x47, 0x0e, 0x5c, 0x56, 0xa1, 0xe9,
+  0x5b, 0x78, 0x97, 0xb1, 0x3c, 0xe5, 0xdc, 0xb9, 0x4f, 0x24, 0x00, 0x5c,
+  0x91, 0x50, 0x36, 0x37, 0x59, 0x39, 0x3d, 0x94, 0x56, 0x6d, 0x30, 0x47,
+  0xe2, 0x51, 0xd0, 0xbb, 0xbc, 0x81, 0x58, 0x83, 0x37, 0x55, 0xc9, 0x28,
+  0x8f, 0x83, 0xf3, 0x83, 0x5a, 0xc6, 0xb5, 0xc6, 0x82, 0xb9, 0x1c, 0x46,
+  0xf4, 0x1b, 0xe4, 0xee, 0xb8, 0x7c, 0x79, 0xfc, 0x06, 0x42, 0x37, 0x4b,
+  0x7a, 0x91, 0xa3, 0xad, 0xb4, 0xf4, 0xe9, 0x35, 0x09, 0x62, 0xec, 0x8f,
+  0xe2, 0x32, 0xca, 0xc0, 0xf4, 0x0f, 0x72, 0x22, 0x5c, 0xab, 0x87, 0x6f,
+  0xb0, 0x17, 0xb2, 0x97, 0x7e, 0x21, 0x2f, 0xf6, 0x22, 0x8c, 0x4c, 0x55,
+  0xd4, 0x05, 0x86, 0x69, 0xf8, 0xc7, 0x7b, 0xe3, 0x1e, 0x6d, 0xfe, 0x46,
+  0xa8, 0x62, 0xe3, 0x05, 0xa0, 0x73, 0x60, 0x1b, 0xd9, 0xf2, 0xd3, 0xb4,
+  0x57, 0x42, 0xb1, 0xdc, 0x97, 0x41, 0x1b, 0x6a, 0x77, 0xb0, 0x5b, 0xe0,
+  0x85, 0x27, 0x23, 0x16, 0x9e, 0x43, 0x33, 0xb5, 0xd0, 0xc0, 0xa8, 0x59,
+  0x8b, 0x19, 0x29, 0xa3, 0x11, 0xec, 0x62, 0x99, 0x49, 0xa8, 0xee, 0xd0,
+  0x06, 0xd5, 0x88, 0xde, 0xd1, 0x5c, 0x37, 0x83, 0x67, 0x17, 0x39, 0x3e,
+  0xfb, 0x97, 0xed, 0x68, 0x41, 0x8d, 0x34, 0xfa, 0x9d, 0x00, 0x6f, 0x0c,
+  0x4b, 0xab, 0x32, 0x78, 0xfb, 0x9c, 0x8c, 0x21, 0x2f, 0x61, 0x90, 0xb3,
+  0x5d, 0xc8, 0x6c, 0x0b, 0xcf, 0x24, 0x6e, 0xb3, 0xf2, 0x84, 0x4e, 0x34,
+  0x05, 0x51, 0x33, 0x58, 0x37, 0x24, 0xdc, 0x8c, 0xce, 0x7c, 0xc9, 0x83,
+  0x67, 0xf3, 0xf9, 0xa8, 0xdd, 0xf1, 0x84, 0x7c, 0xa8, 0xe9, 0xf2, 0x2a,
+  0xf2, 0x63, 0x11, 0xea, 0x12, 0x45, 0x9b, 0x06, 0xdf, 0x3c, 0x16, 0x90,
+  0x24, 0x27, 0x25, 0x35, 0x3c, 0xdd, 0x9f, 0x42, 0x37, 0x31, 0xf1, 0x51,
+  0x1e, 0x27, 0x76, 0xf5, 0x73, 0xc9, 0x56, 0x67, 0x0f, 0x51, 0x09, 0x9e,
+  0x74, 0x8d, 0xb0, 0x92, 0x75, 0xa3, 0x74, 0xf2, 0x52, 0x14, 0x33, 0xc6,
+  0x6c, 0x85, 0x7f, 0x3c, 0xad, 0xae, 0x09, 0xe8, 0xe9, 0x41, 0xa0, 0x8f,
+  0xc0, 0xac, 0x60, 0xe5, 0x2b, 0xbe, 0x8d, 0x8d, 0x1b, 0x7d, 0x81, 0x24,
+  0x95, 0xa3, 0xef, 0xa1, 0x62, 0x52, 0x71, 0x8b, 0x2d, 0xe8, 0x1b, 0x6d,
+  0xa3, 0xb1, 0xe7, 0xe9, 0x8f, 0x9c, 0xef, 0x85, 0xf9, 0x80, 0x92, 0xdd,
+  0xd3, 0x9b, 0x34, 0x35, 0xf3, 0xda, 0xfe, 0x5a, 0x0a, 0x8d, 0x60, 0x29,
+  0x08, 0xeb, 0x61, 0x17, 0x92, 0x45, 0x4e, 0xf8, 0x2e, 0x9e, 0xba, 0x22,
+  0x30, 0xbc, 0x10, 0x85, 0x65, 0xfd, 0x1a, 0x10, 0x12, 0xa4, 0x18, 0x57,
+  0xfd, 0x06, 0xc9, 0x92, 0x61, 0x9f, 0x79, 0xd9, 0x17, 0xf7, 0x4d, 0xd4,
+  0xae, 0xdf, 0x29, 0x5f, 0xbb, 0x98, 0xf0, 0x0b, 0xaf, 0x54, 0x0f, 0x38,
+  0x7e, 0x5c, 0x73, 0x8f, 0x8f, 0x9e, 0xf3, 0x37, 0x87, 0x3a, 0x57, 0x61,
+  0x90, 0xf8, 0x21, 0x63, 0x15, 0xaf, 0x80, 0x0c, 0xe1, 0x61, 0xcf, 0x80,
+  0xc7, 0x7a, 0x2a, 0x59, 0xe5, 0x3f, 0x2d, 0x5a, 0xea, 0xb9, 0x29, 0xeb,
+  0xbc, 0xad, 0x97, 0xfe, 0x2f, 0xfc, 0x94, 0x93, 0x46, 0x7c, 0x8c, 0x36,
+  0xf2, 0x1f, 0x6e, 0x5a, 0xf2, 0xb9, 0x9f, 0xf9, 0x81, 0x97, 0x5b, 0xc4,
+  0x49, 0x72, 0x0a, 0x80, 0xe4, 0x7c, 0x03, 0xfd, 0xe3, 0x04, 0xfb, 0x87,
+  0x51, 0x83, 0xda, 0xb1, 0xcc, 0x12, 0x2b, 0x1c, 0xb4, 0x35, 0x85, 0xb4,
+  0x45, 0x56, 0xbb, 0x61, 0x40, 0x50, 0x0f, 0xb7, 0x21, 0x5e, 0xd5, 0xcf,
+  0xbe, 0x9f, 0xad, 0x81, 0x0b, 0xd4, 0x4b, 0x5f, 0xed, 0x2c, 0x4e, 0x45,
+  0x26, 0x2c, 0x12, 0xd0, 0x1b, 0xf0, 0x33, 0x7e, 0xfb, 0x4b, 0x11, 0xe7,
+  0x3a, 0x32, 0x47, 0xff, 0x55, 0x5a, 0xa7, 0x52, 0x4c, 0xc3, 0x7a, 0x61,
+  0x51, 0x96, 0x9b, 0xf6, 0xff, 0xaf, 0x92, 0xd6, 0x93, 0x96, 0x43, 0x27,
+  0x73, 0x4c, 0x21, 0x0a, 0xc8, 0x40, 0xc3, 0x72, 0x6b, 0xb6, 0x45, 0x37,
+  0xd6, 0x3b, 0x12, 0x77, 0x10, 0x57, 0x9a, 0x4d, 0xae, 0x2f, 0x16, 0xd1,
+  0xac, 0x0a, 0xef, 0x81, 0x41, 0xee, 0xe0, 0x35, 0xb5, 0x4c, 0xc5, 0xca,
+  0x08, 0xd6, 0x9a, 0xc0, 0xa1, 0x80, 0xf0, 0xd6, 0xa7, 0xe3, 0x1d, 0x0d,
+  0xf1, 0x7d, 0x3c, 0x5a, 0x5d, 0xa7, 0x6e, 0xe9, 0x4b, 0xa3, 0x4f, 0x0d,
+  0xd1, 0xf7, 0x0a, 0x1e, 0x07, 0x89, 0xb5, 0x29, 0xc7, 0xf1, 0x73, 0x29,
+  0xe9, 0xd6, 0xf0, 0x5d, 0x41, 0x45, 0xdb, 0xcc, 0xa6, 0xda, 0x90, 0x3b,
+  0xaf, 0x91, 0x2e, 0x21, 0x8f, 0x48, 0xb2, 0x84, 0xc1, 0x87, 0x45, 0xe7,
+  0x6a, 0xf7, 0xe4, 0x1f, 0x15, 0x5c, 0x79, 0x00, 0x12, 0x0c, 0x93, 0xf7,
+  0xbb, 0x97, 0x69, 0xfe, 0xdf, 0x06, 0x2a, 0x3d, 0xc0, 0x8c, 0xdc, 0x02,
+  0xa2, 0x61, 0xe9, 0xa9, 0xfd, 0x35, 0xef, 0xb5, 0x6d, 0x2f, 0x17, 0xa4,
+  0x80, 0xa3, 0xc6, 0xdd, 0xd3, 0xdf, 0x31, 0x06, 0x5e, 0xbd, 0x08, 0x09,
+  0xa8, 0x68, 0x3c, 0x47, 0x74, 0x5c, 0x8b, 0x84, 0xcb, 0xe2, 0x32, 0x3b,
+  0x54, 0x6f, 0x31, 0x3a, 0x08, 0x4d, 0x6a, 0x4a, 0x8b, 0x89, 0xe7, 0xc4,
+  0xfc, 0x2e, 0xc3, 0xc8, 0x62, 0xcf, 0xa2, 0xab, 0x6e, 0x00, 0xe9, 0xd7,
+  0x10, 0x17, 0xda, 0x53, 0xbc, 0x36, 0x5c, 0xb6, 0xda, 0x7d, 0x91, 0x13,
+  0x9c, 0xe9, 0xe5, 0xca, 0xea, 0xcc, 0x65, 0x32, 0x27, 0x57, 0xf2, 0xb3,
+  0x63, 0x7f, 0x73, 0x73, 0xcc, 0x71, 0x10, 0x94, 0x68, 0xc1, 0x4e, 0xba,
+  0x16, 0xa8, 0x63, 0x85, 0xb7, 0x71, 0xe6, 0xa8, 0x6f, 0x6d, 0x0f, 0x07,
+  0x88, 0x7e, 0xc9, 0x14, 0x52, 0xd1, 0x91, 0x6c, 0x9d, 0xd0, 0xcb, 0xc9,
+  0xba, 0x0b, 0x79, 0x8b, 0x1b, 0xe7, 0xa9, 0x5d, 0xef, 0x0d, 0xe7, 0x43,
+  0xe4, 0xa5, 0xf4, 0xcf, 0x63, 0x40, 0x5e, 0xb3, 0xf9, 0xb0, 0x9a, 0xb4,
+  0xf6, 0x52, 0x55, 0xdc, 0x22, 0xc1, 0x3e, 0xda, 0x89, 0xa0, 0x66, 0x0d,
+  0x0e, 0x00, 0x53, 0xa1, 0xa1, 0xbd, 0x9a, 0xe3, 0x01, 0x79, 0xf2, 0x2a,
+  0xd8, 0xee, 0xf6, 0x2a, 0xb5, 0xb7, 0x3c, 0x3c, 0xe8, 0xd7, 0x9d, 0xfd,
+  0x39, 0x90, 0xa3, 0xad, 0xc9, 0xa9, 0x3e, 0x72, 0xa2, 0x5a, 0x5a, 0x51,
+  0xd1, 0x4d, 0x27, 0x7d, 0x02, 0x02, 0x79, 0x22, 0xa7, 0x6c, 0xe8, 0xd7,
+  0xe6, 0x5f, 0x4f, 0xcb, 0xfb, 0x7e, 0x80, 0x4b, 0x4d, 0xb4, 0x77, 0xff,
+  0xc7, 0xb7, 0xb7, 0xc0, 0xa4, 0x7d, 0xf6, 0xcf, 0xdc, 0x4b, 0x1a, 0xad,
+  0xeb, 0xa6, 0x3f, 0x86, 0x86, 0xec, 0xec, 0x59, 0xb4, 0xac, 0x85, 0x6e,
+  0x01, 0x48, 0xd5, 0x70, 0x3e, 0xba, 0x36, 0x06, 0x15, 0x84, 0xc7, 0x2d,
+  0xdc, 0x15, 0xac, 0x90, 0xab, 0x3d, 0x6e, 0xc7, 0x99, 0x3b, 0xaa, 0x46,
+  0x46, 0xc1, 0xb7, 0x2e, 0x0a, 0xfc, 0x4a, 0xdf, 0xe8, 0xb6, 0x32, 0x03,
+  0xf7, 0xf5, 0xe4, 0xc4, 0x0d, 0x9c, 0x4c, 0x4a, 0xad, 0xad, 0xfa, 0xd0,
+  0xd5, 0x5f, 0xaf, 0xc9, 0xb3, 0x7b, 0x11, 0x18, 0x27, 0x6a, 0xb3, 0xb2,
+  0xbf, 0x22, 0x07, 0x4e, 0x4a, 0x3f, 0xa8, 0x12, 0xcd, 0xa9, 0x11, 0xcf,
+  0x0e, 0x33, 0xe8, 0xe7, 0x04, 0xb2, 0xc2, 0x94, 0x25, 0x48, 0x9c, 0x15,
+  0x2c, 0xe4, 0x55, 0xb7, 0x22, 0x60, 0x54, 0x1f, 0x0e, 0x67, 0x6d, 0x32,
+  0x3d, 0xc7, 0xf7, 0x27, 0x91, 0x22, 0xb4, 0x92, 0x66, 0x5a, 0xc0, 0x8f,
+  0xd4, 0xd3, 0x46, 0x1b, 0x43, 0x83, 0x0d, 0x4b, 0xe6, 0xe0, 0x9c, 0x30,
+  0xae, 0xad, 0x82, 0x86, 0x95, 0x22, 0x02, 0x67, 0x8d, 0xad, 0x12, 0xf6,
+  0x5f, 0xcd, 0xcc, 0x4a, 0xde, 0xb6, 0x8c, 0xea, 0x3d, 0x78, 0x47, 0x7a,
+  0x74, 0xab, 0x0a, 0x13, 0x57, 0xa9, 0x1b, 0xe1, 0x9e, 0xd8, 0xc1, 0x74,
+  0x71, 0xa9, 0x6d, 0x00, 0x61, 0xb0, 0x7e, 0x01, 0xb6, 0x8c, 0x44, 0x98,
+  0x39, 0xc8, 0x53, 0x81, 0xb5, 0x3a, 0x36, 0xff, 0x0c, 0x79, 0xeb, 0x9d,
+  0xef, 0x9e, 0x4d, 0x05, 0x50, 0x16, 0x2a, 0x27, 0x44, 0x56, 0x4b, 0xbb,
+  0x8b, 0x71, 0x3f, 0xda, 0x63, 0x95, 0x33, 0xe0, 0xed, 0x9b, 0x79, 0xbf,
+  0x3d, 0x58, 0x2e, 0x4a, 0xdf, 0x03, 0x2d, 0x38, 0x63, 0xee, 0x85, 0xe1,
+  0xa5, 0x91, 0xca, 0x7e, 0xd6, 0x11, 0x1b, 0x9c, 0xc5, 0x16, 0xf2, 0x90,
+  0xf1, 0x73, 0x55, 0xef, 0x33, 0x02, 0x5e, 0xda, 0x89, 0x4c, 0xc9, 0x23,
+  0x2e, 0xbf, 0x14, 0xe7, 0xdc, 0x2e, 0x8d, 0xb0, 0x94, 0xee, 0xac, 0xff,
+  0x9d, 0x1d, 0xeb, 0x58, 0xc9, 0xa5, 0x26, 0x12, 0x27, 0x49, 0x0a, 0x00,
+  0x08, 0xbf, 0xec, 0x38, 0x4a, 0xcb, 0xa2, 0x59, 0x33, 0xc3, 0x7e, 0x02,
+  0x5a, 0xf2, 0x46, 0xb8, 0x7d, 0xd9, 0x25, 0xe6, 0xba, 0xea, 0x6e, 0xf3,
+  0x80, 0xbd, 0x45, 0x21, 0x1f, 0x07, 0x49, 0xfe, 0xe0, 0xe9, 0x82, 0x32,
+  0x80, 0x8d, 0x00, 0x53, 0x56, 0x0e, 0x07, 0x02, 0x3e, 0xd6, 0x22, 0x01,
+  0x34, 0x24, 0xef, 0xc1, 0xb6, 0xe9, 0x57, 0x8d, 0xcb, 0x41, 0x4c, 0x2f,
+  0x8f, 0x31, 0xe7, 0xe7, 0x0e, 0x66, 0x9e, 0x0f, 0xe9, 0x33, 0x53, 0xf0,
+  0x04, 0x61, 0xbd, 0xff, 0xd5, 0x62, 0xb8, 0xfa, 0x01, 0xc4, 0xf8, 0xf8,
+  0x53, 0xd0, 0x6a, 0xb9, 0x49, 0xde, 0x8f, 0xec, 0x94, 0x4c, 0x8c, 0xd4,
+  0x51, 0xda, 0x99, 0x75, 0xad, 0x8a, 0xe4, 0xd2, 0xf8, 0x61, 0x3b, 0x24,
+  0x0a, 0x8c, 0xc6, 0x50, 0xef, 0x63, 0x72, 0x44, 0x45, 0x7e, 0xdf, 0x10,
+  0xa7, 0xab, 0x18, 0x17, 0xa9, 0x68, 0xeb, 0x92, 0x8e, 0x6b, 0xef, 0xfc,
+  0xbb, 0xd2, 0x79, 0x85, 0x7d, 0x19, 0xcf, 0xd5, 0x0b, 0x70, 0xda, 0x3b,
+  0x6b, 0x7e, 0xe2, 0xcb, 0xcc, 0xc7, 0x3b, 0x1b, 0xec, 0x40, 0x28, 0x28,
+  0xc9, 0x9c, 0xeb, 0xa3, 0x14, 0xe0, 0xe9, 0x47, 0x0f, 0x36, 0x76, 0x7d,
+  0xdc, 0xf8, 0xdf, 0x8b, 0xd6, 0xe2, 0xd1, 0xaf, 0x68, 0xeb, 0xb7, 0x5d,
+  0xe3, 0x9f, 0x19, 0x7b, 0x0d, 0x9c, 0x71, 0xc8, 0xfb, 0x92, 0x16, 0xef,
+  0xff, 0x54, 0xee, 0x3d, 0x1d, 0xc6, 0xe3, 0x13, 0x70, 0x1a, 0x5c, 0xbf,
+  0x98, 0x55, 0xba, 0x8b, 0x8f, 0xe0, 0xf6, 0xf0, 0x7d, 0xd9, 0x32, 0xb7,
+  0x95, 0x01, 0x6e, 0x5a, 0x55, 0xc1, 0x76, 0x62, 0xd3, 0xaa, 0x00, 0x3f,
+  0x90, 0x87, 0xc0, 0x83, 0xd3, 0x5c, 0x15, 0x03, 0x72, 0x64, 0x11, 0xe7,
+  0xe7, 0x0e, 0x7d, 0x44, 0x6a, 0xc2, 0x66, 0xda, 0x4f, 0xc7, 0x10, 0xf8,
+  0x2a, 0xa8, 0xc3, 0x48, 0x0e, 0x02, 0xa1, 0x9d, 0x5b, 0xe7, 0x2d, 0x5c,
+  0x62, 0x75, 0x1a, 0x38, 0xd8, 0x6e, 0x90, 0xd1, 0x48, 0x5b, 0xf8, 0x17,
+  0x40, 0x73, 0xd9, 0xb3, 0x17, 0x7c, 0xd8, 0x8f, 0x58, 0xd4, 0xc8, 0x6a,
+  0x70, 0x86, 0x5d, 0x89, 0x11, 0xba, 0x46, 0x30, 0xbf, 0xda, 0x38, 0xc9,
+  0xe4, 0xba, 0x1d, 0x1d, 0xa9, 0xd7, 0x10, 0x90, 0x85, 0x60, 0x91, 0x05,
+  0xba, 0x41, 0x76, 0xc9, 0xe8, 0x75, 0xee, 0xba, 0xa9, 0x5c, 0xd3, 0x7e,
+  0x04, 0xc4, 0xc4, 0x4b, 0x30, 0x15, 0x19, 0x89, 0x51, 0x6c, 0x37, 0x16,
+  0x59, 0xd3, 0x49, 0xd6, 0x84, 0xac, 0x8f, 0x51, 0xef, 0xe7, 0xa6, 0x1a,
+  0xa6, 0x9f, 0x3f, 0xb2, 0x29, 0xb1, 0xb5, 0x18, 0x4e, 0x8a, 0xeb, 0xfa,
+  0xd7, 0x01, 0xeb, 0x95, 0xb9, 0x1e, 0x0d, 0x0d, 0x45, 0x31, 0xe8, 0xee,
+  0x54, 0xf8, 0x2c, 0x58, 0x08, 0x7f, 0x60, 0x8a, 0x07, 0x36, 0xee, 0x96,
+  0xb9, 0xb0, 0x55, 0x60, 0x60, 0xc1, 0x22, 0x95, 0x32, 0xaf, 0x76, 0x28,
+  0x4b, 0x8d, 0xe8, 0x6d, 0xa0, 0x51, 0xcc, 0xbb, 0x72, 0x8f, 0xf6, 0x64,
+  0x1d, 0x9c, 0x45, 0x90, 0x99, 0xf8, 0x33, 0x5f, 0x94, 0x6f, 0xdf, 0x85,
+  0x99, 0x15, 0x5e, 0x1b, 0x50, 0xb7, 0x47, 0x84, 0x1c, 0xf6, 0x0f, 0x24,
+  0xa9, 0x7e, 0x13, 0xe0, 0xf0, 0x0e, 0xf2, 0xf0, 0x29, 0x02, 0x20, 0x59,
+  0xb8, 0x87, 0x41, 0x4b, 0x21, 0x3a, 0x54, 0xdc, 0x22, 0x5e, 0xc0, 0x2f,
+  0x2e, 0x5f, 0x15, 0xb3, 0x9c, 0xa0, 0xcd, 0x45, 0x1d, 0xb6, 0xd4, 0x65,
+  0xf0, 0x02, 0xd1, 0x58, 0x04, 0x00, 0xc5, 0xa0, 0x6f, 0x4a, 0xce, 0x36,
+  0xc3, 0x7f, 0xc8, 0x51, 0x46, 0xc7, 0x09, 0xd4, 0xc3, 0xad, 0x3e, 0xba,
+  0x13, 0x30, 0x5b, 0xbd, 0xe1, 0x17, 0x3f, 0xf3, 0xff, 0x3c, 0xd7, 0x35,
+  0xeb, 0xc6, 0x05, 0x12, 0x5d, 0x91, 0x4a, 0xe8, 0x70, 0x5f, 0x77, 0xb3,
+  0xfc, 0x00, 0xd7, 0x4a, 0xaf, 0xb2, 0x9d, 0x9a, 0x9a, 0xd0, 0x27, 0x9b,
+  0x2c, 0x91, 0xc9, 0x56, 0x4a, 0xd0, 0x8e, 0x0a, 0xb1, 0x40, 0x04, 0x37,
+  0x3c, 0xf3, 0xbe, 0x6f, 0x6a, 0xeb, 0x63, 0xb3, 0x8d, 0x04, 0xed, 0xb6,
+  0xf3, 0x79, 0x1f, 0x80, 0x9f, 0x16, 0xcc, 0x45, 0x30, 0x08, 0xe6, 0xec,
+  0xce, 0x65, 0xee, 0x3d, 0x3b, 0x7b, 0xff, 0x30, 0x30, 0x87, 0x96, 0xea,
+  0xf5, 0x15, 0x02, 0x30, 0xe3, 0x16, 0xe9, 0xc4, 0xac, 0x3f, 0xbf, 0xd1,
+  0x5a, 0x7a, 0xa3, 0x4a, 0xa6, 0xa5, 0x6d, 0x51, 0xe0, 0x8c, 0xff, 0xfc,
+  0xe9, 0x3a, 0x57, 0x22, 0xbb, 0x5e, 0xf5, 0x3b, 0x26, 0x80, 0xbb, 0x87,
+  0xae, 0x90, 0x23, 0x5f, 0x73, 0xd5, 0xdf, 0xdf, 0xb2, 0x87, 0xa8, 0x90,
+  0xc5, 0x67, 0xca, 0xbe, 0xa3, 0xda, 0xa3, 0x7e, 0x07, 0xff, 0xda, 0xee,
+  0x5f, 0xcd, 0xda, 0x10, 0x6c, 0x03, 0x2d, 0x4a, 0xef, 0x99, 0xca, 0x06,
+  0x74, 0x6f, 0x7a, 0xcc, 0x01, 0x50, 0x78, 0x8a, 0x01, 0x01, 0xad, 0x7a,
+  0xdc, 0xc0, 0xa0, 0x41, 0x3d, 0x83, 0xf1, 0x15, 0x7b, 0x47, 0x7f, 0x12,
+  0x80, 0x41, 0x2b, 0xa7, 0xa0, 0x6d, 0x18, 0x5f, 0x1a, 0xf9, 0x9b, 0x03,
+  0x37, 0x3c, 0xf4, 0x8a, 0x5b, 0xe4, 0x28, 0xa0, 0xee, 0xff, 0x5b, 0x45,
+  0x37, 0x10, 0xf0, 0xe5, 0xcb, 0xab, 0xe0, 0x62, 0x5c, 0xce, 0x0a, 0x84,
+  0x24, 0xc2, 0x0c, 0x38, 0x04, 0xc0, 0x38, 0xf6, 0xfc, 0xbb, 0x18, 0x7b,
+  0x42, 0xa1, 0x25, 0x66, 0x01, 0xfd, 0xd3, 0xac, 0xe2, 0x05, 0x2c, 0x12,
+  0x84, 0x22, 0x7f, 0x13, 0x5a, 0x95, 0x65, 0x4c, 0x2c, 0x20, 0xf9, 0x50,
+  0x1a, 0x50, 0x85, 0xc5, 0x27, 0xf2, 0x4a, 0x1f, 0x1a, 0x5f, 0x1c, 0x88,
+  0xa4, 0x98, 0x9d, 0x8b, 0xe8, 0xeb, 0x5b, 0xbd, 0xa7, 0x3c, 0x87, 0x9a,
+  0x71, 0x8b, 0x3a, 0xbb, 0x10, 0x03, 0xb6, 0x7c, 0xce, 0x51, 0x90, 0xc7,
+  0x7d, 0x4d, 0xf9, 0x59, 0xf0, 0xf0, 0xc0, 0x38, 0xb7, 0xf1, 0xab, 0x2c,
+  0x61, 0x20, 0xa4, 0xed, 0x0a, 0xb2, 0xc6, 0x29, 0x92, 0x95, 0x5f, 0xd3,
+  0xb6, 0x9b, 0x7e, 0xbf, 0x15, 0x15, 0x91, 0xa0, 0xa0, 0x95, 0x9c, 0x59,
+  0xe9, 0x75, 0x16, 0x68, 0x5c, 0x1f, 0x3c, 0xa0, 0x17, 0x40, 0x9a, 0xc4,
+  0x7a, 0x41, 0xc6, 0x30, 0xe8, 0x17, 0x45, 0x3a, 0xea, 0x2b, 0xb8, 0x0a,
+  0x64, 0xf9, 0xf8, 0xa6, 0x3c, 0x97, 0xfc, 0xad, 0x9c, 0x64, 0xd4, 0x61,
+  0x72, 0x53, 0xd3, 0xba, 0x27, 0x7f, 0x0b, 0x53, 0x8b, 0xed, 0xfb, 0x42,
+  0xac, 0x1f, 0xff, 0x8d, 0x9e, 0xf2, 0x4f, 0x70, 0xdf, 0xe8, 0xf2, 0x84,
+  0x9f, 0xee, 0xe0, 0x69, 0x93, 0xce, 0x4d, 0x23, 0xa8, 0x50, 0x7a, 0xf5,
+  0x0e, 0x9d, 0xe0, 0xf7, 0xde, 0x64, 0x54, 0xec, 0xaf, 0x12, 0x75, 0x9a,
+  0xfd, 0x44, 0x05, 0x17, 0x52, 0x1f, 0xc1, 0x93, 0x00, 0xc6, 0x2b, 0x4f,
+  0xf6, 0x1b, 0x04, 0xaa, 0xad, 0x22, 0x29, 0x06, 0xf4, 0x5c, 0x50, 0x63,
+  0x86, 0xf5, 0xca, 0x96, 0xfd, 0x2d, 0x2d, 0x02, 0xdf, 0x0a, 0x8a, 0xb4,
+  0x07, 0x11, 0x8e, 0xd1, 0x65, 0xbb, 0x5c, 0x09, 0x6f, 0x1a, 0xdb, 0x9e,
+  0x9e, 0x33, 0xc8, 0xc3, 0x69, 0x6e, 0x39, 0x6c, 0xab, 0xd1, 0x95, 0x94,
+  0x32, 0x1c, 0x40, 0x3f, 0xef, 0xb2, 0x5a, 0x93, 0x23, 0xe1, 0xe4, 0x04,
+  0x02, 0x7d, 0x87, 0x03, 0x6c, 0x90, 0x52, 0xcb, 0x4c, 0x42, 0x80, 0x01,
+  0xcb, 0xda, 0xe2, 0xe2, 0x90, 0xc6, 0x3e, 0x20, 0x13, 0x9b, 0x3d, 0x40,
+  0x2c, 0xaa, 0xfa, 0xf1, 0x15, 0x3d, 0x1a, 0x16, 0xc9, 0x93, 0x5b, 0x56,
+  0xd5, 0x19, 0x53, 0x26, 0x70, 0x1e, 0x24, 0x49, 0x32, 0x42, 0xc3, 0xa2,
+  0x24, 0x78, 0x24, 0xd0, 0xf9, 0x3f, 0x60, 0x5c, 0x10, 0xf7, 0xf1, 0x5a,
+  0x76, 0x05, 0xb3, 0x2f, 0xab, 0xd4, 0x26, 0x3f, 0x3f, 0x32, 0xaa, 0x61,
+  0x17, 0x25, 0x82, 0xcf, 0x86, 0xbc, 0xc5, 0xdd, 0x85, 0x12, 0xac, 0x57,
+  0x8e, 0xa2, 0x9c, 0x2e, 0xbd, 0xbd, 0x30, 0x05, 0x55, 0x0f, 0x12, 0xac,
+  0xb3, 0xd7, 0x29, 0xf1, 0x15, 0xc5, 0xe6, 0xe2, 0x75, 0x4d, 0xbd, 0x78,
+  0x2d, 0x8a, 0x33, 0x6d, 0x74, 0xc9, 0xc0, 0xa7, 0xa1, 0xbf, 0x5b, 0x14,
+  0x75, 0x87, 0x10, 0xbb, 0x0a, 0x2d, 0xae, 0x6e, 0x1d, 0x4e, 0xa3, 0x72,
+  0x3a, 0x7a, 0xe6, 0x35, 0xb9, 0xeb, 0xe8, 0xf5, 0x34, 0xaf, 0x61, 0x42,
+  0xb5, 0xa6, 0x09, 0x2f, 0xe1, 0xf8, 0x06, 0xd0, 0x17, 0xb7, 0xce, 0x80,
+  0xf1, 0x3b, 0x78, 0x04, 0xb8, 0x1c, 0xc8, 0xd9, 0x04, 0x27, 0xc6, 0x48,
+  0x55, 0x6a, 0x10, 0x01, 0x1d, 0x19, 0x9a, 0x56, 0x59, 0x7c, 0x6b, 0xd0,
+  0x3d, 0xf2, 0x98, 0x0c, 0x72, 0x8b, 0x59, 0xd5, 0x5d, 0x4c, 0x98, 0x46,
+  0x45, 0x3e, 0x74, 0x64, 0x3d, 0x9b, 0x4a, 0xc4, 0x07, 0xf3, 0x02, 0xa2,
+  0xb8, 0x41, 0xc0, 0x24, 0x0c, 0xd3, 0x6a, 0x1d, 0x1b, 0x8a, 0xaa, 0x6a,
+  0x2e, 0xa4, 0x52, 0x4f, 0xb0, 0xfc, 0xe8, 0x38, 0x66, 0x9f, 0x4d, 0x7c,
+  0xff, 0x1d, 0x36, 0x4b, 0x08, 0x67, 0xcb, 0x76, 0xdb, 0x70, 0x9e, 0x3c,
+  0x2c, 0x5c, 0x08, 0xb9, 0x56, 0x7c, 0x95, 0x9a, 0x53, 0x29, 0x41, 0x22,
+  0xfe, 0x65, 0x69, 0x16, 0x57, 0x71, 0x7e, 0x02, 0xa5, 0x0a, 0xb3, 0x6f,
+  0xc4, 0x1a, 0x8c, 0x4c, 0xc1, 0x14, 0x9c, 0x3c, 0xac, 0xac, 0x90, 0x42,
+  0x09, 0xb0, 0x3a, 0x96, 0xf3, 0xb4, 0x65, 0x9e, 0x56, 0xeb, 0xdb, 0xd8,
+  0x4a, 0x4a, 0x3d, 0x5d, 0xa8, 0x89, 0x3b, 0x2a, 0x20, 0x97, 0x80, 0x80,
+  0xdc, 0xf2, 0x3d, 0xd0, 0x67, 0x3f, 0x3a, 0x76, 0xde, 0x32, 0x97, 0x4e,
+  0x4e, 0x36, 0xe0, 0x59, 0xf6, 0x3d, 0xd4, 0xd6, 0x09, 0x7b, 0x35, 0xac,
+  0xd4, 0xc6, 0x46, 0x67, 0x1f, 0xf8, 0x52, 0xcb, 0x93, 0x31, 0x13, 0xae,
+  0xd5, 0x10, 0x22, 0xe0, 0x6b, 0x71, 0xdf, 0xc8, 0x49, 0xf9, 0xb3, 0x2c,
+  0x7c, 0xe5, 0xd6, 0xa0, 0x4d, 0x05, 0x8e, 0xf6, 0xf5, 0xe2, 0x4f, 0x43,
+  0x30, 0xbd, 0xfe, 0x72, 0x72, 0x41, 0xe3, 0x8d, 0xfa, 0x1d, 0x6e, 0x18,
+  0x5b, 0x68, 0xff, 0x95, 0x58, 0xf4, 0x92, 0x31, 0x42, 0x3a, 0xaf, 0x8e,
+  0xda, 0x2b, 0x7f, 0x82, 0x37, 0xd0, 0x45, 0xa9, 0x29, 0xf2, 0x67, 0xc3,
+  0xae, 0xff, 0x04, 0xd2, 0x23, 0x33, 0xf9, 0x24, 0xe3, 0x97, 0x5a, 0x5b,
+  0x78, 0x72, 0x51, 0x93, 0x93, 0x21, 0x9d, 0xe5, 0x57, 0x4b, 0x52, 0x3d,
+  0x1a, 0x70, 0xf7, 0x27, 0x5a, 0x65, 0xb3, 0x14, 0x7a, 0xc8, 0x2c, 0xcb,
+  0x1c, 0x3d, 0x6e, 0xa7, 0x11, 0x92, 0x66, 0x7a, 0x15, 0x2e, 0xee, 0x07,
+  0xf8, 0x1f, 0x33, 0x13, 0x81, 0x1f, 0x3b, 0x74, 0xad, 0xd9, 0xdb, 0xdd,
+  0x43, 0xcb, 0x53, 0xbe, 0xee, 0xa5, 0xa1, 0x31, 0xac, 0x6b, 0x4a, 0x69,
+  0x32, 0xb0, 0xc9, 0x8d, 0x0d, 0xdf, 0xd2, 0x96, 0x25, 0x8f, 0x95, 0x07,
+  0x70, 0xaf, 0xc8, 0x49, 0xd7, 0x83, 0x82, 0xf9, 0x28, 0x5a, 0xa2, 0x87,
+  0x27, 0x33, 0xe4, 0xe1, 0xfc, 0x54, 0x29, 0xb5, 0x4c, 0x3c, 0xf6, 0x5a,
+  0xfa, 0xfa, 0x90, 0x53, 0x91, 0x65, 0x8c, 0x8b, 0xaf, 0x31, 0xb3, 0x3d,
+  0x77, 0x6e, 0x2e, 0xe1, 0xa3, 0x16, 0xa2, 0x4f, 0x4b, 0x44, 0x82, 0x9e,
+  0x0e, 0x21, 0x67, 0xb7, 0x58, 0x89, 0x2d, 0x65, 0xf3, 0x8d, 0xe4, 0x01,
+  0xe0, 0x6f, 0xb7, 0xbc, 0x29, 0x44, 0x60, 0xeb, 0x8a, 0x2e, 0xbe, 0xbd,
+  0xe7, 0xe0, 0xca, 0x14, 0xf7, 0x7d, 0x85, 0x44, 0xdc, 0x1d, 0x46, 0xbc,
+  0xca, 0xa5, 0xda, 0x7d, 0xf3, 0x91, 0x5b, 0xbe, 0x8a, 0x0c, 0x82, 0x14,
+  0xdb, 0x89, 0x13, 0x78, 0x60, 0xe8, 0x4e, 0x2a, 0xa9, 0xe2, 0xeb, 0x79,
+  0x53, 0xb6, 0x0c, 0x4c, 0x71, 0x94, 0x40, 0xbc, 0x7a, 0x3e, 0x38, 0xf5,
+  0xfa, 0x67, 0xc0, 0x91, 0x29, 0xbc, 0x05, 0x0a, 0x61, 0xf6, 0x5e, 0xbd,
+  0xdc, 0x46, 0x92, 0xad, 0x01, 0x64, 0xc7, 0xd4, 0x0a, 0x8c, 0x2e, 0x8a,
+  0xf9, 0xdf, 0xa2, 0x4b, 0x04, 0xac, 0x53, 0x02, 0x97, 0x9b, 0x88, 0x5d,
+  0xb3, 0xc5, 0x34, 0x06, 0xe5, 0x4b, 0x7a, 0xec, 0x41, 0xd3, 0x3d, 0x3f,
+  0x48, 0x15, 0x97, 0xc0, 0x3d, 0xa2, 0x2b, 0x6f, 0x73, 0xbb, 0xaf, 0x10,
+  0x36, 0x37, 0x00, 0x2c, 0x27, 0xd2, 0xb7, 0x4d, 0xac, 0xf9, 0x80, 0x1d,
+  0x2d, 0x21, 0x65, 0x7b, 0xeb, 0x8e, 0xad, 0x60, 0x16, 0x33, 0x4b, 0x05,
+  0x04, 0x5b, 0xf3, 0x8d, 0xc1, 0xd4, 0xa5, 0x11, 0x22, 0xb6, 0xc6, 0xdf,
+  0x0c, 0x4f, 0xc8, 0x0a, 0xf6, 0x3c, 0xcb, 0xbe, 0x33, 0xd5, 0x65, 0x0c,
+  0x11, 0xcc, 0x8c, 0xb4, 0x81, 0x1b, 0xb6, 0x30, 0x2f, 0x30, 0x44, 0x6f,
+  0x88, 0xaf, 0x5f, 0x86, 0x99, 0x13, 0x25, 0x10, 0x64, 0xf4, 0xef, 0x44,
+  0x55, 0xda, 0x7c, 0x98, 0xd8, 0xbd, 0x7b, 0x92, 0xa5, 0xd6, 0x26, 0x02,
+  0x73, 0x6d, 0x78, 0x87, 0x5a, 0x4a, 0xad, 0x18, 0xb8, 0x4c, 0xb8, 0xfe,
+  0x4e, 0xa9, 0x8c, 0x43, 0x20, 0x56, 0xb9, 0xeb, 0xc0, 0xee, 0xb1, 0x29,
+  0x38, 0xfa, 0x00, 0x5b, 0xf1, 0x18, 0xb1, 0xbc, 0x32, 0x32, 0x54, 0x88,
+  0xd6, 0x68, 0x64, 0x15, 0x0e, 0x9b, 0x79, 0x60, 0x1d, 0x2a, 0x56, 0x64,
+  0xf4, 0xa2, 0x72, 0x0e, 0x32, 0xcc, 0x1f, 0xce, 0xce, 0xcb, 0x80, 0x05,
+  0xe4, 0x64, 0xbf, 0xc2, 0x97, 0x05, 0x93, 0x60, 0xc3, 0x19, 0x47, 0x59,
+  0xc7, 0x2e, 0x11, 0xc6, 0x89, 0xbc, 0x14, 0xb8, 0x20, 0x82, 0xa5, 0x3e,
+  0xdd, 0x25, 0x96, 0x56, 0x17, 0xee, 0xb2, 0x39, 0x6e, 0x53, 0x2e, 0xaf,
+  0x6a, 0x59, 0xae, 0x84, 0xf8, 0xcf, 0x47, 0xd2, 0xee, 0x87, 0x7d, 0x2d,
+  0x20, 0x70, 0x61, 0x20, 0x08, 0x6d, 0x19, 0x84, 0x1a, 0xf6, 0xa0, 0x0d,
+  0xf0, 0x39, 0xc6, 0xe8, 0x6d, 0x78, 0xf1, 0x8b, 0x32, 0x38, 0xf2, 0x5f,
+  0xcf, 0x33, 0x17, 0xa6, 0x4b, 0x4a, 0xf1, 0x0d, 0xba, 0xe2, 0x6b, 0xbf,
+  0x6e, 0xa3, 0xc0, 0x4e, 0x35, 0x50, 0xb3, 0x6d, 0x48, 0x0c, 0x28, 0x54,
+  0x66, 0x83, 0xe2, 0x2e, 0x7f, 0xfd, 0x75, 0x92, 0x53, 0x3d, 0x0d, 0x14,
+  0x52, 0xb5, 0x3b, 0xbb, 0x08, 0xac, 0xa2, 0xc1, 0xa0, 0xda, 0x38, 0x91,
+  0xc5, 0x14, 0xba, 0xd5, 0x3f, 0xd5, 0xc9, 0x19, 0x8d, 0x70, 0x1a, 0xee,
+  0xee, 0xc8, 0xec, 0x2e, 0x34, 0x55, 0x87, 0x13, 0xd6, 0x92, 0x4e, 0xe9,
+  0x0c, 0x31, 0xb5, 0x86, 0x3c, 0x19, 0x01, 0x01, 0x24, 0x2d, 0x66, 0x2a,
+  0xe8, 0xf6, 0xc2, 0xc2, 0x07, 0xc1, 0x12, 0x4a, 0x0e, 0xac, 0x77, 0xe2,
+  0x9c, 0xce, 0x37, 0x9b, 0xb0, 0x94, 0x68, 0x74, 0x3f, 0x9b, 0xfd, 0x35,
+  0xb3, 0xc4, 0x1c, 0x04, 0xba, 0x30, 0xc0, 0x7a, 0x67, 0x18, 0x86, 0x25,
+  0x25, 0xea, 0xcd, 0x7f, 0xe3, 0x26, 0x53, 0x38, 0x3a, 0xab, 0x91, 0x4f,
+  0xb2, 0x95, 0x1c, 0x51, 0xfd, 0x5f, 0x91, 0x51, 0xba, 0x22, 0x63, 0xee,
+  0x66, 0x72, 0x7a, 0xea, 0xe5, 0x91, 0x02, 0x8c, 0x73, 0x9f, 0xe3, 0xa0,
+  0xd9, 0x80, 0x97, 0x90, 0x1f, 0x41, 0x13, 0xfd, 0x27, 0xd1, 0x48, 0xf3,
+  0x03, 0x02, 0x17, 0x3a, 0xea, 0x3f, 0x31, 0x62, 0xae, 0x9a, 0xc2, 0x3f,
+  0x04, 0x46, 0x96, 0x8d, 0x0b, 0xd2, 0x85, 0x05, 0xae, 0x48, 0x61, 0x33,
+  0x76, 0xdd, 0x75, 0xd3, 0xd3, 0xff, 0x31, 0x95, 0x64, 0x06, 0x2a, 0xe7,
+  0x80, 0x66, 0x66, 0x6f, 0x1f, 0xef, 0x1d, 0x2a, 0x20, 0x8b, 0x8b, 0x15,
+  0x3a, 0x96, 0x96, 0xed, 0x43, 0x7d, 0xcb, 0x18, 0xbb, 0x05, 0xc6, 0x2d,
+  0x28, 0x8f, 0xc7, 0xa5, 0x6f, 0x9a, 0x6b, 0x8d, 0x19, 0x3e, 0x79, 0xee,
+  0x4a, 0x80, 0xfe, 0x52, 0x98, 0x38, 0xae, 0x4d, 0x4d, 0xeb, 0x7c, 0x84,
+  0x74, 0x21, 0x32, 0x11, 0x41, 0x64, 0xec, 0x6b, 0x3a, 0xaf, 0x0d, 0x2e,
+  0x35, 0xbb, 0x62, 0x62, 0xae, 0x37, 0x37, 0x7f, 0x9d, 0x8d, 0x3f, 0xe4,
+  0x71, 0x44, 0xb5, 0x83, 0xb3, 0xca, 0x03, 0x0a, 0x94, 0x59, 0xcd, 0x15,
+  0x79, 0x18, 0x4f, 0xc9, 0x79, 0x6a, 0xda, 0x0f, 0x34, 0x7a, 0x37, 0x58,
+  0x07, 0x6e, 0xdc, 0x07, 0x60, 0xe7, 0xc2, 0x26, 0x1b, 0x78, 0xc7, 0xc7,
+  0xad, 0x9a, 0xc5, 0xc4, 0xe8, 0xa5, 0x25, 0x80, 0xf4, 0x8c, 0x9d, 0x44,
+  0xfd, 0x83, 0x15, 0x0b, 0x07, 0x3f, 0x63, 0xab, 0xd4, 0x02, 0x36, 0xef,
+  0x86, 0xd0, 0x3d, 0xc9, 0x5a, 0xdc, 0x80, 0x1d, 0xb8, 0x92, 0x64, 0xe3,
+  0x14, 0x1b, 0x6e, 0x3c, 0x8b, 0xb0, 0x50, 0x21, 0xc1, 0x2f, 0x5a, 0xfe,
+  0xa2, 0xf5, 0x4e, 0xf4, 0x30, 0xb7, 0xee, 0xc5, 0x94, 0xd0, 0x2a, 0xc0,
+  0xa0, 0x1c, 0xaa, 0xf2, 0x06, 0x2c, 0xce, 0xb7, 0xec, 0xa9, 0x01, 0x65,
+  0xc1, 0xe8, 0x75, 0x97, 0x41, 0x80, 0xc2, 0x1f, 0xa3, 0x49, 0xef, 0x42,
+  0xe6, 0x13, 0xd6, 0x40, 0x17, 0x16, 0xbd, 0x69, 0xef, 0xb6, 0x00, 0xaf,
+  0xb1, 0x80, 0x41, 0xb4, 0x4a, 0x11, 0xa8, 0xa2, 0xe3, 0x40, 0x49, 0xa4,
+  0x07, 0xf5, 0x1e, 0xbc, 0xdb, 0x71, 0x41, 0xac, 0x77, 0x27, 0x92, 0x45,
+  0x48, 0xf0, 0xf0, 0xe0, 0x0d, 0xd0, 0xe5, 0x1e, 0x32, 0x53, 0x6a, 0xd3,
+  0x8a, 0xe8, 0xaa, 0xd6, 0xaf, 0x80, 0xe9, 0x6e, 0xaf, 0x4b, 0x95, 0xaa,
+  0x54, 0x6c, 0x6c, 0x85, 0xaa, 0x7e, 0x85, 0xd2, 0xef, 0xe4, 0x45, 0xfa,
+  0xca, 0xe6, 0x49, 0x13, 0x4a, 0xcd, 0x6f, 0xf0, 0x08, 0x26, 0x44, 0x5a,
+  0x95, 0x75, 0x6b, 0xe7, 0xe7, 0xc5, 0x65, 0xef, 0xa3, 0xa0, 0x04, 0xf1,
+  0xd7, 0x3f, 0xd5, 0xe3, 0xe6, 0xde, 0xd4, 0x92, 0xeb, 0x2b, 0xd6, 0x05,
+  0x6a, 0xdd, 0x04, 0x7a, 0xe3, 0x86, 0x56, 0x6e, 0xa1, 0x49, 0x6b, 0xb7,
+  0xb7, 0x53, 0x53, 0xf0, 0x62, 0x19, 0xee, 0x40, 0xca, 0x2b, 0x95, 0x07,
+  0xfa, 0x1c, 0x14, 0x25, 0xdf, 0x8d, 0x06, 0xe0, 0x83, 0xcf, 0x03, 0x04,
+  0xa1, 0x41, 0xa3, 0x8f, 0x3b, 0x0a, 0x75, 0x6c, 0x8b, 0x65, 0x1e, 0x4d,
+  0xa4, 0x40, 0x66, 0x92, 0x6b, 0xf0, 0x95, 0xca, 0xaf, 0xab, 0xcf, 0x57,
+  0xac, 0x7f, 0x37, 0x22, 0xeb, 0xeb, 0x57, 0x20, 0x98, 0x47, 0x8e, 0x6d,
+  0x0b, 0xee, 0xe5, 0xab, 0xa3, 0xf6, 0x2b, 0xc3, 0x65, 0xa3, 0xe6, 0xfd,
+  0x15, 0x91, 0x31, 0x0f, 0x1d, 0x1f, 0xef, 0xae, 0x5e, 0xf5, 0xb4, 0xaa,
+  0x06, 0x83, 0x2b, 0xed, 0x39, 0xad, 0x48, 0x57, 0x00, 0x61, 0x6f, 0xf4,
+  0x2d, 0xb2, 0x07, 0x8f, 0x9c, 0xfa, 0x16, 0x25, 0x00, 0x7a, 0xf1, 0x4d,
+  0xef, 0xb6, 0xa5, 0xcf, 0xca, 0x50, 0x9b, 0x95, 0xa4, 0xb8, 0x50, 0xcd,
+  0xdf, 0xe9, 0x9c, 0x9f, 0xee, 0x79, 0xde, 0x93, 0xf8, 0x5d, 0x26, 0xf9,
+  0x18, 0x66, 0xa9, 0x7b, 0x2e, 0x9a, 0x8e, 0xb1, 0x84, 0x45, 0xef, 0xe1,
+  0xfb, 0x81, 0x58, 0x37, 0x33, 0x0e, 0x86, 0x81, 0x2c, 0x3a, 0xa1, 0x1d,
+  0x13, 0xe6, 0x27, 0x32, 0x3f, 0x9c, 0x2d, 0x28, 0x2a, 0x31, 0xd9, 0x7b,
+  0x08, 0x06, 0x72, 0x25, 0x8e, 0x62, 0xa1, 0x86, 0xba, 0x11, 0xe1, 0x8e,
+  0x14, 0x2c, 0x32, 0x1d, 0xe8, 0x07, 0xf8, 0x37, 0x01, 0x23, 0x2a, 0xb9,
+  0x42, 0x8d, 0x1b, 0xcb, 0xcf, 0x75, 0x0f, 0x19, 0xdc, 0x69, 0xe4, 0x84,
+  0x4c, 0x5d, 0x15, 0x7d, 0x9c, 0xb7, 0x43, 0x42, 0x4d, 0x58, 0xbb, 0x21,
+  0x7d, 0x21, 0x3c, 0xbb, 0xcb, 0xad, 0xb2, 0x6d, 0xcc, 0x70, 0x31, 0xcd,
+  0xe6, 0x39, 0x4f, 0x7c, 0x77, 0x80, 0xc1, 0xd5, 0x3a, 0x75, 0x8e, 0xb2,
+  0x44, 0x85, 0x08, 0xa0, 0x92, 0xfa, 0x0d, 0xd5, 0x1d, 0x28, 0x97, 0xbc,
+  0xb7, 0x2b, 0xf3, 0xfd, 0xde, 0xb0, 0xb5, 0x94, 0x21, 0xac, 0x79, 0x31,
+  0x0c, 0x35, 0xff, 0xc6, 0x6c, 0xc0, 0xc0, 0x66, 0x6b, 0xa6, 0x56, 0x19,
+  0xeb, 0xbc, 0x74, 0x59, 0x10, 0xe8, 0xb0, 0x95, 0x47, 0x07, 0xb1, 0x34,
+  0xb0, 0x55, 0xe4, 0xbe, 0xea, 0x5b, 0x9e, 0xa9, 0x9e, 0x9e, 0x63, 0x17,
+  0xf4, 0xbf, 0x6f, 0x84, 0xd2, 0x59, 0x8f, 0x6a, 0xda, 0x12, 0x69, 0xfe,
+  0x34, 0x44, 0x9c, 0x86, 0xe1, 0x7c, 0x26, 0x25, 0x89, 0xb1, 0x03, 0x02,
+  0x78, 0xbb, 0x08, 0xa4, 0x4d, 0x43, 0x70, 0x81, 0xbc, 0x77, 0x77, 0xe2,
+  0x7f, 0x94, 0xe2, 0x00, 0x61, 0x0a, 0x53, 0xde, 0x6e, 0x7c, 0x7c, 0xf7,
+  0xb9, 0x65, 0x3d, 0xc2, 0xc7, 0x6b, 0x2a, 0x0f, 0x7b, 0x09, 0xc3, 0xbd,
+  0xa4, 0x5e, 0x87, 0x87, 0x2a, 0x3f, 0x4a, 0x62, 0x44, 0xef, 0x44, 0x9c,
+  0xec, 0xe1, 0x8d, 0xd7, 0x42, 0x60, 0x3b, 0x04, 0xa6, 0x01, 0xa4, 0x14,
+  0x85, 0xc8, 0x76, 0xe2, 0xa7, 0xe3, 0x28, 0x87, 0x44, 0x9f, 0x4f, 0xd9,
+  0xbd, 0x35, 0xb5, 0xee, 0x5a, 0x59, 0xc3, 0x01, 0x76, 0xa6, 0x41, 0x5a,
+  0xba, 0x75, 0xbd, 0x78, 0xce, 0x8d, 0x02, 0xb3, 0x8e, 0x31, 0xd8, 0x70,
+  0x14, 0x4f, 0xec, 0x8c, 0xb0, 0xf3, 0xfb, 0xcf, 0xaf, 0xc5, 0xca, 0xb8,
+  0xe0, 0xbd, 0x40, 0xd5, 0xe6, 0x73, 0x39, 0xed, 0xf0, 0xa1, 0x98, 0x70,
+  0xf5, 0x46, 0x5c, 0x1f, 0xf2, 0xd2, 0x03, 0x96, 0x38, 0x84, 0x6c, 0x9e,
+  0x72, 0xee, 0xf8, 0x82, 0xe2, 0xa7, 0xba, 0x4c, 0x14, 0x3c, 0x7c, 0xa3,
+  0x10, 0xc4, 0xd6, 0xa0, 0x07, 0x46, 0x4c, 0x13, 0xa7, 0xf3, 0x93, 0x9f,
+  0x43, 0xac, 0xca, 0xe4, 0x01, 0x8c, 0x1f, 0x6d, 0x4f, 0x48, 0x48, 0x42,
+  0x02, 0x87, 0x30, 0xc8, 0x8a, 0xff, 0xb6, 0x84, 0x33, 0x21, 0x20, 0xca,
+  0x41, 0x4e, 0xe2, 0xa4, 0x3a, 0xb6, 0xe1, 0xcc, 0xe0, 0xe2, 0x7e, 0x6b,
+  0xc6, 0x89, 0x0d, 0xd4, 0x7d, 0x7d, 0xb5, 0x2f, 0xbd, 0xe1, 0xe3, 0x03,
+  0xb4, 0xfa, 0xc5, 0x60, 0x2d, 0xcc, 0xd6, 0x90, 0x0c, 0x92, 0xe7, 0x2a,
+  0x68, 0x07, 0xb7, 0x1b, 0x91, 0xfa, 0xd2, 0x63, 0x57, 0x6a, 0x2c, 0xd7,
+  0x09, 0x69, 0x91, 0xc5, 0x60, 0xa1, 0x3c, 0x7b, 0x94, 0x80, 0x03, 0x33,
+  0x33, 0x14, 0x7c, 0x12, 0x86, 0x4e, 0xa7, 0xa4, 0x86, 0x26, 0x06, 0xf3,
+  0xd8, 0xb9, 0xd7, 0x57, 0xe3, 0x56, 0xd9, 0x51, 0x72, 0xd6, 0xa1, 0xb9,
+  0xa0, 0x2c, 0x63, 0xea, 0x4e, 0x44, 0x0f, 0x3d, 0x25, 0x49, 0xe8, 0xcb,
+  0x24, 0x27, 0xcb, 0x2c, 0xa5, 0x3e, 0xd2, 0xcf, 0xb4, 0x6f, 0xaf, 0xff,
+  0x90, 0x57, 0x86, 0xcf, 0xc4, 0x96, 0x5c, 0xaa, 0x88, 0x9f, 0x2f, 0x66,
+  0xae, 0x85, 0xc4, 0x91, 0xe0, 0x7e, 0xfb, 0x32, 0x4b, 0x47, 0x15, 0x22,
+  0x5a, 0x0b, 0xf8, 0x41, 0xc1, 0x23, 0x0e, 0x3a, 0x88, 0xc5, 0x9f, 0xbc,
+  0x0a, 0x3c, 0xd0, 0x5d, 0xef, 0xc5, 0x2d, 0xf1, 0xf6, 0xd7, 0x31, 0x03,
+  0xa7, 0x0b, 0x3c, 0x99, 0xb0, 0x19, 0xe8, 0x6d, 0x3a, 0x38, 0x5b, 0x6f,
+  0xa6, 0x19, 0x79, 0x61, 0x3b, 0x51, 0x28, 0x2d, 0x75, 0x6a, 0x6e, 0xb6,
+  0x37, 0xaa, 0xcf, 0x8f, 0x11, 0x20, 0x94, 0x7b, 0xd8, 0x14, 0x40, 0x74,
+  0xe4, 0x83, 0x46, 0x00, 0xe7, 0xf8, 0xd1, 0x90, 0x6e, 0x44, 0xd2, 0x64,
+  0x42, 0x57, 0x0f, 0x42, 0x51, 0x74, 0x87, 0x72, 0x4b, 0x23, 0x23, 0x1f,
+  0xe3, 0xb7, 0x45, 0x4e, 0xfb, 0x62, 0xb7, 0xa2, 0x61, 0x73, 0xd9, 0x14,
+  0x83, 0x76, 0x10, 0xfd, 0xd1, 0xd8, 0x6c, 0xe9, 0x14, 0xb5, 0xa9, 0xe5,
+  0x7e, 0xe3, 0x1b, 0x55, 0x03, 0x38, 0x49, 0x4c, 0xd2, 0xb2, 0x75, 0xf9,
+  0x81, 0x3d, 0x60, 0x58, 0xb5, 0x6b, 0xb0, 0x5f, 0x8b, 0x27, 0x93, 0xa0,
+  0x83, 0x6b, 0xc3, 0x2c, 0x35, 0xc3, 0xa4, 0x6f, 0x6a, 0x38, 0x45, 0x29,
+  0xa4, 0xb2, 0x23, 0x7c, 0xf9, 0xa7, 0xd1, 0x3e, 0xf1, 0x6a, 0x38, 0x3a,
+  0x6a, 0xc6, 0x23, 0x26, 0x81, 0xe0, 0x62, 0xff, 0xe9, 0xf6, 0x84, 0xe2,
+  0x05, 0x29, 0x1b, 0x57, 0xe1, 0xdf, 0xba, 0x3c, 0xfa, 0xf9, 0xb5, 0xd7,
+  0x3e, 0x61, 0x82, 0xd4, 0xdc, 0x16, 0x85, 0x6b, 0xb9, 0x65, 0x46, 0x2c,
+  0xe4, 0x3f, 0x62, 0x42, 0x2e, 0x89, 0xe6, 0x0e, 0xbe, 0xfb, 0xde, 0xa2,
+  0x91, 0x06, 0xfc, 0xc7, 0xfb, 0xe7, 0x7e, 0x57, 0x17, 0x70, 0xe6, 0xce,
+  0xbb, 0x8e, 0x4a, 0x8f, 0x6c, 0xe8, 0xe9, 0x29, 0xfc, 0x7b, 0x02, 0xf5,
+  0xfb, 0xe7, 0x83, 0x27, 0x72, 0x9e, 0xa7, 0x43, 0x73, 0xc7, 0x00, 0xdb,
+  0x99, 0x50, 0xe0, 0x83, 0x09, 0x03, 0x9f, 0x04, 0x30, 0x3e, 0x81, 0x7c,
+  0xb9, 0x68, 0x09, 0x9f, 0x96, 0x76, 0xd4, 0x24, 0x54, 0x19, 0x11, 0x24,
+  0x3f, 0x69, 0xaa, 0xb6, 0xb7, 0x3c, 0xe1, 0xcf, 0x13, 0x53, 0xe2, 0x9e,
+  0x14, 0xd8, 0x06, 0x1f, 0xb3, 0xc2, 0x37, 0x23, 0xf2, 0x95, 0x97, 0x67,
+  0x6c, 0xf0, 0x13, 0x88, 0x37, 0x64, 0x71, 0x2e, 0xfc, 0xdb, 0x86, 0x93,
+  0x90, 0x5c, 0x2e, 0x52, 0xfd, 0x25, 0x9d, 0xd4, 0x77, 0xbe, 0xde, 0x8d,
+  0xd9, 0x14, 0x65, 0xa1, 0xe6, 0xcc, 0x62, 0xb9, 0x6f, 0x1e, 0x69, 0xa9,
+  0xc1, 0x37, 0x41, 0xee, 0xe1, 0xd4, 0x0e, 0x62, 0x24, 0x25, 0xf4, 0x98,
+  0x42, 0xa7, 0xd9, 0xf1, 0xe1, 0x14, 0x23, 0x0f, 0x9d, 0x2e, 0xd9, 0x71,
+  0xa9, 0x00, 0xb1, 0x5c, 0x79, 0x0d, 0x5c, 0x11, 0x62, 0xcb, 0xe9, 0x40,
+  0x09, 0x2d, 0xcb, 0x09, 0x65, 0xc5, 0xaf, 0x27, 0x9f, 0x91, 0x44, 0x35,
+  0x8c, 0x21, 0xe2, 0x53, 0xfc, 0x7e, 0x9e, 0xf3, 0xd5, 0x5a, 0xba, 0x82,
+  0x90, 0x3b, 0x11, 0xfb, 0x32, 0x18, 0x0f, 0xfd, 0x30, 0x49, 0x8b, 0x2f,
+  0xe0, 0x5e, 0xde, 0x76, 0x02, 0x67, 0xa5, 0x3f, 0x81, 0x2e, 0x7d, 0x9e,
+  0x97, 0x8c, 0x0d, 0x1a, 0x39, 0xff, 0x7b, 0x7d, 0xc1, 0x84, 0x08, 0x1c,
+  0xe4, 0x46, 0x49, 0x20, 0x4f, 0x35, 0x94, 0xca, 0x0c, 0x43, 0x00, 0x56,
+  0x5b, 0x10, 0x7a, 0xb0, 0x4c, 0x79, 0x94, 0x12, 0x08, 0xc8, 0x0f, 0x0d,
+  0xf9, 0x31, 0x61, 0xf8, 0x0e, 0xbf, 0x22, 0x31, 0xbf, 0x1d, 0xd3, 0x0d,
+  0x38, 0x0d, 0x07, 0xcb, 0x3f, 0x1d, 0xa8, 0xbc, 0x7e, 0x7a, 0x18, 0x10,
+  0x91, 0xe8, 0xc6, 0x49, 0x25, 0x9f, 0xcb, 0x4b, 0x6e, 0x8b, 0x14, 0xe7,
+  0x42, 0x57, 0x67, 0xf3, 0xc3, 0xc5, 0xff, 0xdb, 0xc6, 0x53, 0x64, 0x07,
+  0x0a, 0x97, 0x79, 0x7a, 0x95, 0x9b, 0xf8, 0x6c, 0xea, 0x71, 0xd4, 0xdf,
+  0x55, 0x87, 0xfb, 0xd8, 0xf0, 0x96, 0x57, 0x4e, 0x4e, 0xe7, 0x69, 0xa3,
+  0x12, 0x32, 0x9a, 0x06, 0xef, 0x52, 0x60, 0xb6, 0xf3, 0x62, 0x58, 0x8c,
+  0xca, 0x77, 0x0a, 0x4b, 0xc4, 0xaa, 0x9f, 0xd1, 0x15, 0xd6, 0x8c, 0x9d,
+  0xb2, 0x9b, 0xfd, 0xf6, 0xf0, 0x34, 0xe3, 0xc6, 0xdc, 0xdf, 0x1a, 0xd0,
+  0x0f, 0xf8, 0x84, 0x20, 0x43, 0x0c, 0x80, 0x1d, 0xc7, 0x37, 0x12, 0x86,
+  0x85, 0xd6, 0x4f, 0x81, 0x31, 0x3d, 0x13, 0x65, 0x09, 0x11, 0xae, 0x29,
+  0x4e, 0x20, 0x50, 0x85, 0x8d, 0xbf, 0x92, 0x73, 0xd7, 0x60, 0xea, 0x7a,
+  0x49, 0x19, 0xfa, 0x97, 0x62, 0x95, 0x27, 0x85, 0xa9, 0x02, 0xd1, 0x84,
+  0xa5, 0xdb, 0x19, 0xd6, 0x65, 0x2c, 0xeb, 0xba, 0xf9, 0x41, 0x6c, 0x56,
+  0xa7, 0x37, 0x6c, 0xc5, 0x26, 0x95, 0xfa, 0xaa, 0x9a, 0x37, 0xa4, 0xdc,
+  0xaf, 0x5e, 0x99, 0xeb, 0xe4, 0xfc, 0x0d, 0xdd, 0x9c, 0x95, 0xe1, 0x68,
+  0xdc, 0xc4, 0xe6, 0xd2, 0x43, 0x9d, 0x0b, 0xcc, 0x97, 0x90, 0x87, 0x0f,
+  0x23, 0x78, 0xdf, 0x16, 0xe1, 0x03, 0xc0, 0xd0, 0xe4, 0xae, 0xda, 0x42,
+  0xc0, 0x85, 0xbf, 0x33, 0xa1, 0x50, 0xc5, 0x86, 0x8a, 0x86, 0xec, 0x8c,
+  0xf7, 0xd2, 0xad, 0x2c, 0x93, 0xa5, 0x12, 0x2e, 0xc9, 0x53, 0xf6, 0xdb,
+  0x1f, 0xfa, 0xbe, 0x01, 0x5e, 0x94, 0x29, 0xa3, 0x18, 0xef, 0xce, 0xd1,
+  0xd6, 0xb6, 0x6c, 0xc2, 0x33, 0xfa, 0x85, 0x50, 0x46, 0xd4, 0x8f, 0xfd,
+  0xaf, 0x34, 0xcf, 0xc0, 0x9e, 0xfd, 0xdd, 0xe1, 0x7a, 0x09, 0xce, 0x8f,
+  0x2d, 0xc3, 0x0f, 0x30, 0x1f, 0xdc, 0x9e, 0x9e, 0xc7, 0x86, 0xf2, 0x82,
+  0x42, 0x22, 0x9e, 0x00, 0x99, 0xff, 0x50, 0x4c, 0x66, 0x55, 0x60, 0x85,
+  0x85, 0x91, 0x2b, 0x84, 0x2c, 0xc1, 0x8b, 0x2f, 0x2b, 0x1e, 0x8f, 0x2d,
+  0xdd, 0xda, 0x0b, 0x26, 0x6f, 0xf9, 0x2f, 0xbd, 0xbd, 0xbd, 0x2c, 0xd5,
+  0x54, 0xc0, 0x50, 0x70, 0x68, 0x5e, 0xab, 0xeb, 0x0a, 0x2e, 0xe9, 0x6e,
+  0x8d, 0xdc, 0x13, 0xcb, 0x05, 0xa7, 0xa7, 0x6a, 0x6a, 0xf3, 0xcf, 0x37,
+  0x2b, 0x14, 0xc2, 0xac, 0xbd, 0x37, 0xd2, 0xae, 0x51, 0x41, 0x97, 0xd6,
+  0xb2, 0x71, 0x2b, 0x6e, 0x0b, 0xb2, 0x2f, 0xe7, 0xf6, 0xb8, 0xff, 0x68,
+  0xa1, 0x00, 0x44, 0xce, 0xe2, 0x69, 0x30, 0xd0, 0xd6, 0x3e, 0xf8, 0x61,
+  0xee, 0xcd, 0x83, 0xe2, 0x28, 0x44, 0xdf, 0x93, 0xa2, 0x87, 0xc5, 0xe4,
+  0xca, 0x59, 0x4e, 0x10, 0xbc, 0x61, 0x42, 0xe9, 0xa9, 0x09, 0x10, 0x44,
+  0x09, 0x2e, 0x09, 0x21, 0x71, 0xce, 0xf9, 0x9f, 0xe9, 0x75, 0x57, 0x07,
+  0x4a, 0x63, 0x23, 0x13, 0xa5, 0x14, 0xc6, 0xec, 0x32, 0xb5, 0xb9, 0xc4,
+  0x37, 0xe8, 0xf1, 0x00, 0x7d, 0x48, 0x8d, 0xdc, 0xc9, 0xcf, 0x6f, 0x86,
+  0x62, 0x3f, 0x13, 0xc0, 0xac, 0x27, 0x94, 0x7a, 0xdb, 0x41, 0x59, 0x9c,
+  0x44, 0x20, 0x3d, 0xf5, 0xf7, 0x9e, 0x0d, 0xf9, 0x6e, 0xc7, 0x17, 0x95,
+  0x36, 0x85, 0xa1, 0x08, 0xc1, 0x79, 0x90, 0x5f, 0x31, 0x26, 0xc6, 0x00,
+  0x05, 0x54, 0x1a, 0x17, 0xd5, 0x2e, 0xda, 0x0f, 0xf8, 0x80, 0x24, 0x72,
+  0xb7, 0x1e, 0x8d, 0xf1, 0x5c, 0xb3, 0x94, 0x66, 0x35, 0x93, 0xa2, 0x46,
+  0xe2, 0x94, 0x31, 0x3d, 0x56, 0xc7, 0x49, 0xf8, 0xdb, 0x87, 0x68, 0x6b,
+  0x95, 0xd0, 0x98, 0x51, 0xa4, 0x0a, 0xb1, 0xe2, 0x29, 0x14, 0x60, 0x3e,
+  0x1d, 0xa3, 0x97, 0x87, 0x6d, 0x1a, 0x8d, 0x8f, 0x52, 0xda, 0xe7, 0x0b,
+  0xbb, 0xc9, 0xd8, 0x57, 0xe8, 0xa0, 0x9d, 0x92, 0x25, 0xc6, 0x04, 0xec,
+  0x7f, 0xda, 0xb6, 0xce, 0x96, 0x0a, 0x9b, 0x2f, 0xd7, 0xe3, 0xb6, 0x60,
+  0xcd, 0xc3, 0xf9, 0xe4, 0xca, 0x9e, 0xca, 0x94, 0x14, 0x1a, 0xd0, 0xf2,
+  0xcf, 0x90, 0x9a, 0x75, 0xb5, 0x38, 0x08, 0xfb, 0x1b, 0xa7, 0xf6, 0xb0,
+  0xf8, 0xec, 0x2f, 0xa3, 0xb2, 0xf4, 0x16, 0x99, 0x6d, 0x84, 0xa6, 0x97,
+  0x4f, 0xe5, 0xf0, 0xcc, 0x92, 0x09, 0x99, 0x28, 0x3b, 0x8b, 0x57, 0x57,
+  0xab, 0x5e, 0x95, 0xb5, 0xcb, 0x1e, 0x07, 0xc5, 0x24, 0x17, 0x11, 0x8c,
+  0x6d, 0x68, 0xb8, 0xdb, 0x9f, 0x83, 0xb6, 0x52, 0x88, 0xff, 0x3d, 0xbd,
+  0xd0, 0x99, 0x5c, 0x86, 0xc7, 0x71, 0x27, 0x6f, 0xb1, 0x4e, 0x6d, 0xc1,
+  0x70, 0x43, 0xa5, 0xff, 0x99, 0x08, 0x93, 0x25, 0x85, 0xe1, 0x09, 0xd2,
+  0xb7, 0x25, 0x81, 0xff, 0x3a, 0xba, 0xe6, 0x93, 0x45, 0x93, 0xe5, 0x0f,
+  0x81, 0xf1, 0xb5, 0xba, 0x5f, 0x62, 0x0c, 0xa9, 0xd4, 0xda, 0x61, 0x72,
+  0xd2, 0x41, 0xf9, 0x23, 0xd3, 0x1c, 0x13, 0x66, 0xfa, 0x59, 0xfc, 0xbe,
+  0xa5, 0x22, 0x71, 0x0a, 0xc5, 0x8d, 0x45, 0x0d, 0x25, 0xcc, 0xe4, 0x99,
+  0x94, 0xc8, 0x7a, 0x7f, 0x63, 0x8e, 0xaa, 0xb1, 0x6d, 0x0f, 0x5b, 0x2f,
+  0x9e, 0xf0, 0xed, 0x24, 0x19, 0x68, 0xd5, 0x2b, 0xad, 0x09, 0x1c, 0xbe,
+  0x99, 0x30, 0xf3, 0xe5, 0xeb, 0xfe, 0x3d, 0x72, 0x63, 0x38, 0x7e, 0x20,
+  0xa3, 0xbe, 0xb1, 0x8b, 0xe8, 0x60, 0xfb, 0xfe, 0xa5, 0xaf, 0x40, 0x26,
+  0xc1, 0xdb, 0xef, 0x5b, 0x6d, 0x0a, 0x14, 0xab, 0x44, 0x2c, 0x79, 0x7b,
+  0x7b, 0xf0, 0x39, 0x8f, 0x02, 0x57, 0x3f, 0xae, 0x49, 0xc4, 0x79, 0x7e,
+  0xfd, 0xf9, 0xc2, 0x0f, 0xc9, 0x1b, 0xaa, 0xd8, 0x14, 0x6c, 0x95, 0xcf,
+  0x3f, 0xd5, 0xde, 0x61, 0x42, 0x44, 0x09, 0x86, 0xbb, 0x58, 0x58, 0x65,
+  0xb4, 0xcf, 0xd3, 0xb6, 0x65, 0x6c, 0x02, 0xac, 0xaf, 0xff, 0x2d, 0xf4,
+  0x67, 0xfb, 0xb4, 0x74, 0x0f, 0x50, 0x0e, 0xe5, 0x54, 0x9a, 0x9e, 0xa4,
+  0xcd, 0x8e, 0x60, 0x5c, 0xe3, 0xee, 0xf5, 0x13, 0x8b, 0xba, 0xdc, 0x11,
+  0xd3, 0x87, 0xab, 0xab, 0xa8, 0xd1, 0xc8, 0x58, 0xde, 0xac, 0x75, 0xc2,
+  0x1a, 0xce, 0x1e, 0x2a, 0x70, 0x33, 0xac, 0xcf, 0xba, 0x00, 0x7f, 0xb9,
+  0x97, 0x45, 0x45, 0xa4, 0x82, 0xb4, 0x40, 0xbe, 0x6d, 0x72, 0x15, 0x87,
+  0x9d, 0xf5, 0xc4, 0x79, 0x19, 0xbd, 0x3b, 0x39, 0xec, 0x52, 0x73, 0x3b,
+  0x3c, 0xdf, 0x79, 0x3c, 0x62, 0x42, 0x89, 0x88, 0xf2, 0xd9, 0x03, 0xb2,
+  0x87, 0x43, 0x74, 0xbe, 0x0c, 0xca, 0x14, 0xa8, 0x6d, 0xd8, 0xac, 0xbd,
+  0x8b, 0x4f, 0xe3, 0x46, 0x62, 0xd9, 0x2d, 0xc0, 0x72, 0xbd, 0x6d, 0xa0,
+  0xd2, 0xdb, 0x01, 0x00, 0x9b, 0x71, 0x84, 0x41, 0xfd, 0x90, 0x47, 0x4a,
+  0x6e, 0xd5, 0xe3, 0xd4, 0xad, 0xe6, 0x49, 0x7c, 0x88, 0xc8, 0x74, 0x0b,
+  0xd5, 0x83, 0x17, 0xc6, 0x54, 0xa4, 0x3f, 0x98, 0x0a, 0xd1, 0x9f, 0x69,
+  0xca, 0xf1, 0x3d, 0xf7, 0x54, 0xac, 0x6a, 0x83, 0x83, 0x9e, 0x76, 0x7a,
+  0x34, 0xcf, 0xfd, 0x40, 0x27, 0xe6, 0xc0, 0x00, 0x87, 0x9d, 0x3a, 0xf8,
+  0xf5, 0x3c, 0x68, 0xbb, 0xad, 0x00, 0x39, 0xba, 0xff, 0x32, 0x27, 0xfd,
+  0x4b, 0x4c, 0xb4, 0x96, 0xdc, 0x2c, 0x18, 0x5a, 0x2e, 0x44, 0xa7, 0x01,
+  0xe0, 0x12, 0xdd, 0xe9, 0xbd, 0xc4, 0x28, 0x15, 0x8e, 0xff, 0xf3, 0xfd,
+  0x32, 0x0c, 0xa2, 0x34, 0x7f, 0xdd, 0xfb, 0xce, 0xb5, 0x6b, 0xb7, 0x4d,
+  0x91, 0xc0, 0x5a, 0x27, 0x81, 0xff, 0xde, 0x0e, 0x8e, 0x19, 0x87, 0x92,
+  0x5e, 0xd0, 0x8b, 0x9b, 0xa1, 0xd0, 0x3f, 0x75, 0x65, 0xbc, 0xbc, 0x8f,
+  0x91, 0xab, 0xe1, 0xf9, 0xf8, 0xdc, 0x45, 0x54, 0x24, 0x7c, 0x1b, 0x54,
+  0xf2, 0xe6, 0xac, 0x5d, 0xc5, 0xa7, 0x59, 0x9d, 0xb8, 0xfe, 0x5d, 0x16,
+  0x49, 0x75, 0x78, 0x48, 0x5d, 0xab, 0x24, 0xcc, 0x74, 0x1a, 0x22, 0x76,
+  0x5d, 0x43, 0x25, 0x71, 0xbf, 0x55, 0x81, 0xd8, 0x47, 0xd7, 0xcc, 0x6c,
+  0xc0, 0x8a, 0xbf, 0x54, 0xcd, 0xdb, 0xc5, 0x05, 0xf5, 0xef, 0x7e, 0x16,
+  0xa9, 0x51, 0x1a, 0xe4, 0xea, 0x9a, 0xd3, 0xba, 0x61, 0x96, 0x9f, 0xd2,
+  0x96, 0xa4, 0xd2, 0x1e, 0xf7, 0x91, 0x95, 0x53, 0x49, 0x8e, 0x9a, 0x6c,
+  0xf2, 0x96, 0xd3, 0xa8, 0x9f, 0xd9, 0xef, 0x33, 0xa6, 0x0c, 0x33, 0x34,
+  0xc5, 0x4e, 0x03, 0xca, 0xf2, 0x62, 0x6d, 0x68, 0x83, 0x92, 0x8e, 0x11,
+  0x34, 0xb0, 0xc8, 0xb6, 0x88, 0x6c, 0x30, 0x5b, 0x47, 0x6e, 0xcf, 0xcd,
+  0xe4, 0xf6, 0x1b, 0x97, 0x6f, 0xc7, 0x06, 0xbc, 0xa2, 0x9b, 0xf2, 0x33,
+  0xc6, 0xbf, 0xf5, 0x03, 0xf7, 0xba, 0x9b, 0x9b, 0x43, 0x6e, 0xe6, 0x80,
+  0x6e, 0x25, 0x49, 0x05, 0x05, 0x39, 0xb6, 0x0f, 0x0a, 0x1b, 0x0c, 0x32,
+  0x91, 0x01, 0x9b, 0x76, 0x76, 0x34, 0xe6, 0xe6, 0x28, 0x07, 0xd4, 0x5e,
+  0xde, 0x9f, 0xbe, 0xdd, 0x99, 0x64, 0xcc, 0x6e, 0x0f, 0x0a, 0x61, 0x0a,
+  0x21, 0x21, 0x60, 0xef, 0x35, 0x50, 0xcc, 0x7f, 0x78, 0xd3, 0x47, 0x15,
+  0x27, 0x90, 0x61, 0xe7, 0x90, 0xbf, 0x33, 0xe0, 0xb4, 0xdc, 0x52, 0x40,
+  0x38, 0x10, 0x3a, 0x0e, 0x56, 0x7e, 0x8f, 0x8c, 0xd6, 0xd5, 0xaf, 0x94,
+  0x14, 0xe9, 0x9c, 0x28, 0x09, 0xc4, 0x6e, 0xe0, 0x4b, 0xd8, 0x2d, 0x48,
+  0xc7, 0x98, 0xc2, 0xaa, 0x0f, 0xb4, 0x7f, 0x9d, 0x83, 0xa6, 0x6f, 0x3f,
+  0x16, 0xde, 0xdf, 0x40, 0xa8, 0x76, 0xa5, 0x15, 0x44, 0x5f, 0xce, 0xb6,
+  0xd9, 0x28, 0x1f, 0xf2, 0x9f, 0x11, 0x50, 0x0c, 0x39, 0xbb, 0xbe, 0xcf,
+  0x2e, 0x9f, 0xf2, 0x95, 0x8e, 0x39, 0x4d, 0xdf, 0x39, 0x13, 0x92, 0xae,
+  0xcb, 0x12, 0x6c, 0xdf, 0xc2, 0xed, 0x8d, 0xde, 0xed, 0xfc, 0xab, 0x02,
+  0x8a, 0x8a, 0x5c, 0x14, 0xd3, 0x87, 0xb2, 0x46, 0xda, 0x4e, 0x80, 0x64,
+  0x65, 0x53, 0x15, 0xcf, 0x8b, 0x0e, 0x4d, 0xdc, 0xc7, 0xfc, 0x84, 0x32,
+  0x17, 0xcb, 0xc1, 0x34, 0xa6, 0xd0, 0x29, 0x50, 0xa1, 0xd0, 0xfe, 0xdb,
+  0xd2, 0xe4, 0x2f, 0xc8, 0x94, 0x85, 0x0e, 0x12, 0x68, 0xf7, 0xec, 0x94,
+  0xaf, 0xfd, 0x33, 0x2d, 0xb7, 0x5d, 0xde, 0xca, 0x05, 0xb8, 0x49, 0x5d,
+  0x79, 0xd4, 0x98, 0x27, 0x59, 0xf0, 0x92, 0x4a, 0x98, 0x80, 0x24, 0x51,
+  0xea, 0x01, 0xed, 0x79, 0xfb, 0xc7, 0x95, 0x6a, 0x45, 0xd6, 0x9f, 0x81,
+  0xce, 0xad, 0xbd, 0xe9, 0xaf, 0x2b, 0x19, 0x64, 0x76, 0xb8, 0x3e, 0xe2,
+  0xc4, 0xfe, 0x24, 0x50, 0x6a, 0xe0, 0xbf, 0x20, 0xf8, 0x30, 0xc3, 0x45,
+  0x87, 0xa3, 0xf5, 0xdf, 0xae, 0x61, 0x36, 0x37, 0x51, 0xdb, 0x3d, 0x9f,
+  0x57, 0xf0, 0x46, 0x31, 0x30, 0xe4, 0xf9, 0x7d, 0x84, 0x6e, 0x4c, 0x6a,
+  0xb4, 0xdc, 0x4d, 0xac, 0x13, 0xaf, 0x61, 0xd0, 0xc7, 0xe7, 0x25, 0xc0,
+  0xa6, 0x65, 0x49, 0x37, 0x58, 0x82, 0x9a, 0x37, 0x1f, 0x42, 0xf0, 0x35,
+  0xba, 0x1e, 0x39, 0xa5, 0x50, 0xc1, 0x65, 0xb0, 0x11, 0x64, 0xf7, 0xb4,
+  0xca, 0x33, 0x02, 0x78, 0x1e, 0x82, 0x82, 0xa9, 0xb9, 0x91, 0xc1, 0x4d,
+  0x4b, 0x81, 0x6e, 0xfa, 0x12, 0xc2, 0x59, 0xfd, 0x66, 0x85, 0xfe, 0x0a,
+  0x59, 0x24, 0x2d, 0x82, 0x29, 0x7d, 0xbd, 0x09, 0x20, 0xcb, 0xcd, 0x6b,
+  0x95, 0xae, 0xe1, 0xa2, 0xa0, 0x35, 0x80, 0x06, 0x67, 0xc8, 0x95, 0x44,
+  0x6a, 0xb2, 0xb3, 0x03, 0xdb, 0x44, 0x1d, 0xfa, 0x70, 0xd0, 0x45, 0x5d,
+  0x04, 0xc6, 0x4a, 0x89, 0xbf, 0x49, 0xd5, 0x64, 0x07, 0xd7, 0x25, 0xe7,
+  0x5a, 0xf7, 0xe6, 0x21, 0xdc, 0x72, 0xae, 0x41, 0xb9, 0x49, 0x00, 0x9e,
+  0x88, 0xb6, 0x38, 0xeb, 0x28, 0xb0, 0x5e, 0xab, 0x7b, 0xe3, 0x34, 0xa3,
+  0x4b, 0xd2, 0x8c, 0x02, 0xca, 0xe7, 0xe3, 0xe7, 0x93, 0x9b, 0xd5, 0x4e,
+  0xaf, 0x2f, 0x6c, 0x0f, 0x0b, 0x08, 0x77, 0x31, 0x6e, 0xc8, 0xa8, 0x35,
+  0x45, 0xb1, 0x2f, 0xf7, 0xe9, 0x1a, 0x19, 0x63, 0x79, 0xf3, 0xcc, 0x32,
+  0x32, 0xae, 0x69, 0x87, 0x70, 0x08, 0x0a, 0xc6, 0xc6, 0xa7, 0xea, 0x03,
+  0xb7, 0x98, 0xae, 0x65, 0xaa, 0x15, 0x48, 0x23, 0x74, 0x60, 0x14, 0x14,
+  0xc2, 0x5d, 0x39, 0x0f, 0x83, 0x64, 0xc9, 0x27, 0xd1, 0xa6, 0x8a, 0x29,
+  0x7a, 0x94, 0x53, 0x58, 0x2f, 0xb5, 0x8c, 0x34, 0x2c, 0x1e, 0x6d, 0x24,
+  0xab, 0xdd, 0xe9, 0x5a, 0x49, 0x15, 0xae, 0xb5, 0xf0, 0xd6, 0x21, 0xff,
+  0x9e, 0x93, 0x20, 0x80, 0x14, 0x67, 0xe8, 0xbe, 0xd2, 0x7c, 0xa2, 0x92,
+  0x23, 0x6e, 0xf2, 0xa2, 0x41, 0x41, 0x69, 0x42, 0xc6, 0x6b, 0xf5, 0x36,
+  0xa9, 0x86, 0x28, 0x9d, 0x1d, 0xd3, 0x06, 0x05, 0x28, 0x2c, 0xf8, 0xa1,
+  0x82, 0x4e, 0x3f, 0x99, 0xa4, 0xbb, 0x57, 0xe9, 0x0c, 0x60, 0xe0, 0xe6,
+  0x73, 0x69, 0x37, 0x8c, 0x79, 0x5d, 0x5b, 0xe4, 0x68, 0xb1, 0xec, 0x98,
+  0xf3, 0x04, 0xb1, 0xa8, 0xf4, 0xd0, 0x2f, 0x60, 0x31, 0x59, 0xf7, 0x29,
+  0x88, 0xfe, 0xc3, 0x5f, 0x3e, 0x5e, 0x1d, 0x7b, 0x5f, 0xbc, 0x60, 0x8b,
+  0xd0, 0xa5, 0x03, 0xa7, 0x70, 0x3f, 0x2c, 0xa2, 0x6e, 0x9e, 0xdf, 0x3c,
+  0x1e, 0x9a, 0x66, 0xa4, 0x46, 0xf0, 0xe9, 0x75, 0x27, 0x66, 0xec, 0x42,
+  0xa5, 0xfb, 0xcc, 0xe2, 0x62, 0xf6, 0x74, 0x71, 0x3b, 0x5c, 0xf8, 0xf4,
+  0x84, 0x1f, 0x7f, 0x63, 0x8c, 0x77, 0xdd, 0xe6, 0xe8, 0xdf, 0xa5, 0xe3,
+  0xce, 0x4a, 0xc4, 0xf2, 0x7e, 0xd3, 0x1b, 0x38, 0x41, 0xc7, 0x18, 0x8b,
+  0xc3, 0x2e, 0xeb, 0x70, 0x5e, 0xf9, 0x26, 0xcb, 0x04, 0x61, 0x75, 0xe0,
+  0x8b, 0x69, 0xab, 0x8a, 0x9b, 0x1a, 0x0d, 0xf8, 0xde, 0x20, 0xe5, 0x49,
+  0x14, 0x0b, 0x24, 0x60, 0x31, 0xd7, 0xa6, 0x89, 0x5d, 0x8d, 0x3d, 0x36,
+  0x03, 0x26, 0x2f, 0xbe, 0x9d, 0xb0, 0x75, 0xd4, 0x63, 0xb8, 0xb3, 0x43,
+  0xd7, 0x79, 0x96, 0xc9, 0x90, 0xf7, 0xdc, 0xc5, 0x1e, 0x54, 0xd5, 0x69,
+  0x60, 0x85, 0x5b, 0x2e, 0x0c, 0x0a, 0x4f, 0x1b, 0x6f, 0x6b, 0x25, 0xac,
+  0x29, 0xf8, 0x3d, 0xe4, 0xa4, 0x5b, 0x22, 0x1d, 0xca, 0xc2, 0x82, 0xc5,
+  0xae, 0x0d, 0x0d, 0x49, 0x69, 0x48, 0x0e, 0x0e, 0xcf, 0x91, 0x03, 0xf2,
+  0x2a, 0x4a, 0xcf, 0xe8, 0x48, 0x9f, 0x46, 0x33, 0xd2, 0xd6, 0x1e, 0x67,
+  0xaa, 0xb7, 0x3b, 0x91, 0x2d, 0xae, 0x81, 0x06, 0x55, 0x52, 0x01, 0xf6,
+  0xe2, 0x93, 0xe3, 0x5c, 0xff, 0xfe, 0xd3, 0x64, 0x0f, 0xe0, 0x65, 0x6c,
+  0xeb, 0x53, 0xa3, 0x1d, 0x7c, 0x67, 0xd9, 0x23, 0x2c, 0xf3, 0x13, 0x14,
+  0x97, 0xc9, 0x5c, 0x13, 0x46, 0x32, 0x07, 0x23, 0xaa, 0xd6, 0xb7, 0x10,
+  0x5d, 0x5a, 0x02, 0x3d, 0xa5, 0x71, 0xae, 0x82, 0x72, 0x15, 0x7d, 0x1c,
+  0xfd, 0x5e, 0x72, 0xd1, 0x68, 0x36, 0x43, 0x6c, 0xd2, 0x75, 0xd7, 0xd4,
+  0xe7, 0x6f, 0x0f, 0x5a, 0xa6, 0xe3, 0x19, 0xf4, 0xb6, 0x4f, 0x73, 0x9a,
+  0xd7, 0xef, 0xe3, 0xae, 0x54, 0x1a, 0xe7, 0xc1, 0xd1, 0x5a, 0xaf, 0x7b,
+  0x37, 0xfc, 0xa9, 0x05, 0xf4, 0x8d, 0x15, 0xc2, 0x6b, 0x33, 0x32, 0x1f,
+  0x19, 0xf4, 0xfb, 0xbc, 0x33, 0xff, 0xec, 0x75, 0x40, 0x1b, 0xea, 0xbc,
+  0xab, 0x21, 0x2d, 0xe9, 0x28, 0x49, 0xa8, 0xc4, 0x83, 0x64, 0xf6, 0x13,
+  0xdd, 0xaa, 0x95, 0xb4, 0x68, 0x67, 0x52, 0x22, 0x1b, 0x58, 0xc6, 0x32,
+  0x48, 0xc5, 0xc2, 0x79, 0xc3, 0x7d, 0x89, 0x4e, 0xfe, 0x5e, 0xcc, 0x6e,
+  0x07, 0xdb, 0x07, 0x6d, 0x00, 0x15, 0x84, 0x59, 0xe0, 0xce, 0x96, 0x06,
+  0x7d, 0x40, 0x02, 0xd2, 0x97, 0x52, 0x1d, 0x67, 0x44, 0xfc, 0xfa, 0x1d,
+  0xca, 0xe7, 0xe5, 0xe5, 0xec, 0xec, 0x5a, 0xc0, 0x31, 0x7e, 0x60, 0x3e,
+  0x78, 0x04, 0x7d, 0x7e, 0x9e, 0x8a, 0x0e, 0x50, 0xe3, 0xb3, 0x1e, 0xbc,
+  0xec, 0xd9, 0x4f, 0xe5, 0xc8, 0x25, 0xcc, 0xe1, 0xa3, 0x28, 0xba, 0x94,
+  0xff, 0x99, 0x83, 0x6c, 0x47, 0x34, 0x9f, 0x8c, 0xf4, 0x1a, 0x04, 0xd1,
+  0xe7, 0x16, 0x88, 0xc4, 0x27, 0x45, 0x12, 0x76, 0x22, 0x96, 0x2a, 0x97,
+  0x00, 0x82, 0x78, 0x76, 0xcc, 0x79, 0x6a, 0x22, 0x93, 0xda, 0x1c, 0xfc,
+  0x95, 0x4e, 0x04, 0xb6, 0x1d, 0x3b, 0x9f, 0x29, 0x68, 0x85, 0x47, 0x42,
+  0xf2, 0xce, 0x9c, 0x45, 0x11, 0xf9, 0xa5, 0xa0, 0x5e, 0x24, 0xfd, 0x89,
+  0x23, 0x4a, 0x74, 0x3d, 0xbd, 0x04, 0x2e, 0x4a, 0x45, 0x10, 0x9f, 0x7d,
+  0xae, 0x7b, 0x8b, 0x31, 0xe5, 0x79, 0x5e, 0x3a, 0x73, 0x89, 0xd9, 0x3c,
+  0x86, 0x3d, 0x05, 0x9c, 0xf5, 0x02, 0xfc, 0x53, 0x21, 0x21, 0x60, 0x2b,
+  0x1d, 0x6e, 0x4f, 0xbf, 0x8b, 0x8b, 0xa7, 0x2a, 0xb4, 0xa9, 0x2a, 0x1f,
+  0xc9, 0xba, 0xab, 0x98, 0x34, 0x9c, 0x99, 0x01, 0x2a, 0x95, 0xeb, 0x28,
+  0xcf, 0xf1, 0xfc, 0xdc, 0x75, 0x5a, 0xcb, 0x9e, 0x1e, 0x77, 0xfc, 0x87,
+  0xa9, 0x4a, 0x87, 0x8d, 0x03, 0xf3, 0xae, 0x2c, 0x52, 0xf5, 0x85, 0x1c,
+  0x87, 0xf7, 0xeb, 0x9d, 0x01, 0xe0, 0xbd, 0xda, 0x1c, 0x58, 0xd7, 0xaf,
+  0x31, 0x22, 0x64, 0x8e, 0x8d, 0x8d, 0x37, 0xf0, 0x24, 0xb2, 0x2d, 0x70,
+  0x26, 0x44, 0x1c, 0xa9, 0x5e, 0xce, 0x09, 0x33, 0x0f, 0x18, 0x18, 0xcf,
+  0xe8, 0x42, 0xe3, 0xe5, 0xb7, 0x58, 0x92, 0x14, 0x46, 0xf5, 0x43, 0x1f,
+  0x77, 0xef, 0x1d, 0x13, 0x26, 0xe2, 0x85, 0x26, 0x8c, 0x0f, 0x32, 0x9f,
+  0x3c, 0xa1, 0x74, 0x96, 0xd1, 0xd0, 0x24, 0x9b, 0xd4, 0x1c, 0x9d, 0xd7,
+  0xce, 0x08, 0x8b, 0xdd, 0x63, 0xf6, 0x8c, 0x25, 0x50, 0xab, 0x8a, 0x29,
+  0x4d, 0xc6, 0x12, 0x98, 0xb4, 0xf7, 0x79, 0x67, 0x69, 0xa4, 0xa6, 0x26,
+  0x4d, 0xdf, 0x75, 0xd7, 0xb9, 0xfe, 0x3f, 0x57, 0x68, 0xe3, 0xdd, 0x8a,
+  0x62, 0xe4, 0x29, 0xa4, 0x07, 0x29, 0x29, 0x23, 0x50, 0x35, 0x8d, 0x1e,
+  0x90, 0xf1, 0x3e, 0x1f, 0x76, 0x4a, 0xa5, 0xe0, 0x56, 0xd0, 0x0c, 0x32,
+  0xf1, 0x8c, 0x60, 0x1d, 0x9c, 0x5d, 0x20, 0xd1, 0x03, 0xab, 0x3e, 0xa0,
+  0xe5, 0x60, 0x52, 0x3b, 0x60, 0xa5, 0x43, 0xe6, 0xaa, 0xd7, 0x4c, 0x8f,
+  0x14, 0xd1, 0x25, 0x99, 0xa1, 0x80, 0xad, 0x20, 0xe7, 0x88, 0x0b, 0xdb,
+  0xfd, 0xf6, 0xc0, 0x05, 0x1f, 0x29, 0xec, 0xb7, 0x4b, 0x64, 0xeb, 0x04,
+  0x0a, 0x6b, 0x5a, 0x53, 0x7d, 0xad, 0x7e, 0xb8, 0x6e, 0xb7, 0x31, 0xad,
+  0x2f, 0x07, 0xd6, 0x77, 0x37, 0x54, 0x40, 0xea, 0x3e, 0x8d, 0x62, 0x6c,
+  0x80, 0x9b, 0x3f, 0xa6, 0x00, 0x55, 0xd8, 0x5e, 0x77, 0x54, 0x63, 0x57,
+  0xe9, 0x32, 0xc8, 0x1a, 0x9d, 0xbf, 0xc4, 0x2a, 0x09, 0x2a, 0x8a, 0x06,
+  0x5b, 0x5e, 0x02, 0xa6, 0x0f, 0xc4, 0x00, 0xf6, 0xbf, 0xd0, 0xd1, 0x08,
+  0x28, 0x9c, 0x2e, 0x40, 0x3f, 0x61, 0x73, 0x6b, 0x2d, 0x02, 0xb9, 0x33,
+  0x4e, 0xc1, 0x16, 0xa1, 0x8d, 0x15, 0x79, 0x6c, 0xbf, 0xcd, 0x93, 0xd4,
+  0xd0, 0xd5, 0xde, 0x0a, 0xef, 0xbb, 0x89, 0xb7, 0x0b, 0x85, 0xbc, 0x51,
+  0xc7, 0xb0, 0x2d, 0x24, 0x89, 0x55, 0x00, 0x69, 0x2c, 0xb0, 0x2c, 0x91,
+  0xa6, 0xda, 0xa4, 0xcf, 0x0c, 0x51, 0x52, 0x05, 0xb6, 0x89, 0x26, 0xce,
+  0xd9, 0x16, 0x55, 0xd8, 0x5b, 0x0d, 0x81, 0x8c, 0xc1, 0x6a, 0x82, 0x6e,
+  0x6e, 0x8d, 0xc5, 0x01, 0x89, 0x8e, 0xe4, 0x4d, 0xd0, 0x14, 0xfe, 0xdc,
+  0x54, 0x30, 0x03, 0x50, 0xc1, 0x3e, 0x3c, 0x9d, 0xcc, 0xb2, 0xdf, 0xb4,
+  0x92, 0xdc, 0xae, 0x8a, 0x8e, 0x70, 0xd0, 0xd0, 0xeb, 0x60, 0x6e, 0xd4,
+  0xb3, 0x88, 0xef, 0xb2, 0xf5, 0x81, 0x60, 0x30, 0x43, 0xf0, 0xde, 0xfa,
+  0xe5, 0x82, 0x0a, 0xfd, 0x35, 0x47, 0x3a, 0x92, 0x8f, 0x63, 0x53, 0x4c,
+  0x77, 0x13, 0xfc, 0xa2, 0x95, 0x14, 0x98, 0x8e, 0xd6, 0x3d, 0xc8, 0xb4,
+  0x60, 0x44, 0x13, 0x54, 0xd7, 0xb8, 0xdf, 0xce, 0x61, 0x80, 0xae, 0xce,
+  0x36, 0x90, 0x15, 0x56, 0xd0, 0x06, 0x28, 0xe6, 0x7b, 0x41, 0x86, 0x8c,
+  0x75, 0x40, 0x35, 0x26, 0xf6, 0x09, 0x04, 0x52, 0x41, 0x9c, 0xa4, 0x02,
+  0x21, 0xd1, 0xc3, 0x64, 0x82, 0x97, 0x88, 0x3d, 0x9a, 0x1e, 0x1c, 0x5c,
+  0xac, 0x9d, 0x33, 0xaa, 0x58, 0xfc, 0xc9, 0x75, 0xc2, 0x5a, 0xf7, 0x3e,
+  0x52, 0x54, 0x94, 0xf9, 0xd8, 0x69, 0xd3, 0x3d, 0x39, 0x6a, 0xaa, 0xf3,
+  0x6e, 0xd8, 0xec, 0x05, 0xb7, 0x0a, 0xdb, 0xca, 0xca, 0x65, 0x28, 0x59,
+  0x1b, 0xaa, 0x08, 0x2d, 0x18, 0x93, 0xd2, 0x6a, 0xa5, 0xca, 0xca, 0x4a,
+  0x9b, 0xb1, 0x14, 0x69, 0x2f, 0x34, 0x2f, 0x32, 0x55, 0x47, 0x61, 0x61,
+  0x3f, 0x24, 0xeb, 0x39, 0x4b, 0x2e, 0x87, 0xe4, 0x95, 0x40, 0xfe, 0xc3,
+  0x46, 0x46, 0x41, 0x0e, 0xc4, 0xeb, 0x74, 0x9d, 0x55, 0x55, 0xce, 0xa4,
+  0xac, 0xf3, 0xd5, 0x83, 0x3b, 0xe8, 0x37, 0x06, 0x04, 0x71, 0x6a, 0x48,
+  0xf8, 0x61, 0xae, 0x2a, 0xd3, 0x96, 0x29, 0xbd, 0x7a, 0x88, 0x99, 0xb6,
+  0x6f, 0x05, 0x26, 0x99, 0x96, 0xd9, 0x65, 0x65, 0x69, 0xdc, 0x02, 0x02,
+  0xbc, 0x25, 0xa5, 0x86, 0xe1, 0x68, 0xe6, 0xfc, 0xe8, 0x81, 0xf0, 0xc4,
+  0x94, 0x49, 0xed, 0xf7, 0xb7, 0x1b, 0xcb, 0xf0, 0xf8, 0xf8, 0x29, 0xc4,
+  0x19, 0x1b, 0x68, 0x98, 0x6b, 0xaa, 0x62, 0x39, 0x9b, 0x42, 0xf2, 0x42,
+  0x43, 0x78, 0x2c, 0xa9, 0xf0, 0xf3, 0xee, 0x29, 0x4f, 0xf1, 0xf3, 0x4e,
+  0xea, 0xe1, 0xd5, 0x4f, 0x72, 0x9e, 0xb5, 0xbe, 0xa9, 0x99, 0xd8, 0xed,
+  0xdc, 0xfe, 0xe5, 0xa6, 0xdf, 0xfa, 0x6b, 0x59, 0x1b, 0x42, 0xeb, 0x09,
+  0x0f, 0xc1, 0xfe, 0xa8, 0x03, 0x4f, 0x6b, 0xb3, 0x97, 0x7d, 0xea, 0x7e,
+  0xe3, 0xbc, 0xb6, 0x7c, 0x63, 0xc6, 0x44, 0x63, 0xbf, 0x05, 0x5b, 0xf4,
+  0xb5, 0x99, 0x2f, 0x02, 0xbe, 0xca, 0x4d, 0x5b, 0x98, 0x04, 0x20, 0x45,
+  0x0b, 0x2e, 0x7f, 0x5d, 0xe1, 0x50, 0xeb, 0xc6, 0x26, 0xd1, 0x69, 0xbf,
+  0xda, 0xa0, 0xef, 0xda, 0xda, 0xa2, 0x8d, 0xd4, 0x42, 0xcc, 0xda, 0xd6,
+  0x5a, 0x58, 0x1f, 0x85, 0x13, 0x8f, 0x26, 0xf3, 0xaa, 0xd4, 0xf1, 0x76,
+  0x84, 0x85, 0xa3, 0xa8, 0xac, 0x7d, 0xb1, 0x5e, 0x2a, 0x68, 0x59, 0x17,
+  0x17, 0x7a, 0xfb, 0xcf, 0x5f, 0x50, 0x5f, 0xe1, 0xcb, 0xef, 0xef, 0xae,
+  0x9f, 0x79, 0xc3, 0x70, 0x53, 0x09, 0x1f, 0x40, 0xe9, 0xa7, 0x2d, 0x5d,
+  0x53, 0xbc, 0x72, 0xcb, 0xcd, 0x87, 0xe5, 0xe9, 0x2a, 0x97, 0x96, 0x26,
+  0xf6, 0x13, 0x11, 0x42, 0x08, 0x08, 0x73, 0xf1, 0xe5, 0xca, 0xe7, 0xf4,
+  0x11, 0xce, 0xd2, 0x5c, 0x7a, 0x89, 0x23, 0xab, 0x57, 0x5a, 0x3a, 0x9c,
+  0xdb, 0x8c, 0xd4, 0x8a, 0xa4, 0x62, 0xe6, 0xb3, 0xa6, 0x2c, 0xb7, 0xba,
+  0xba, 0xf1, 0xb3, 0x1e, 0x40, 0xdf, 0xdf, 0x30, 0x42, 0xd1, 0xe9, 0xc2,
+  0xbc, 0xe8, 0xc8, 0xf0, 0x96, 0x47, 0x13, 0x13, 0x93, 0x85, 0x0b, 0xff,
+  0x22, 0xf9, 0xb8, 0x94, 0xca, 0x05, 0x25, 0x1c, 0xd2, 0x37, 0x0c, 0x16,
+  0xdc, 0xa1, 0xf5, 0xe6, 0xfe, 0x61, 0x9f, 0xd3, 0x9a, 0xa8, 0x87, 0xc8,
+  0x2c, 0xa4, 0x52, 0x43, 0xb0, 0x4d, 0xf4, 0x27, 0x0b, 0x4e, 0x38, 0x38,
+  0xa3, 0x29, 0x71, 0xb2, 0xd8, 0x5a, 0xe7, 0x90, 0x24, 0x24, 0x9c, 0x95,
+  0xc0, 0xdc, 0x35, 0x4c, 0x10, 0x70, 0x0e, 0x59, 0xe7, 0xb1, 0x35, 0x78,
+  0x09, 0xa7, 0xef, 0x18, 0x41, 0x1e, 0x21, 0xe6, 0xe5, 0x27, 0x1a, 0x48,
+  0x7e, 0x28, 0x4e, 0x6b, 0xc2, 0xdc, 0xfc, 0xeb, 0xd2, 0xf9, 0x86, 0xa6,
+  0xee, 0x5e, 0x4c, 0x28, 0x8f, 0xe7, 0xfd, 0xee, 0xad, 0xb6, 0xd4, 0xc4,
+  0x82, 0xcc, 0x9f, 0x03, 0x31, 0x25, 0xa5, 0xe4, 0x7e, 0x4d, 0xf9, 0x04,
+  0x5d, 0x8d, 0xd1, 0x7a, 0x5a, 0x29, 0x06, 0xe1, 0x4d, 0x65, 0x05, 0xc0,
+  0xe7, 0xec, 0xf0, 0x03, 0xbd, 0x49, 0x60, 0xa9, 0x04, 0xab, 0xd7, 0x75,
+  0xb2, 0x98, 0x13, 0xb2, 0x95, 0x6d, 0x7c, 0xc1, 0xbe, 0x25, 0x40, 0xf4,
+  0xe1, 0xe2, 0x2d, 0x06, 0x96, 0xc5, 0xe3, 0xa6, 0xe6, 0xdb, 0x68, 0xdf,
+  0x46, 0x37, 0xca, 0x94, 0xd7, 0x21, 0x57, 0x0f, 0xd0, 0x27, 0xd7, 0xb0,
+  0x6f, 0x7e, 0x3c, 0x72, 0x7c, 0x0f, 0x95, 0x20, 0xcf, 0x1a, 0x57, 0x68,
+  0x3b, 0xa4, 0x8e, 0xae, 0x29, 0x18, 0x52, 0xf6, 0x26, 0x07, 0x10, 0xe5,
+  0x00, 0xa1, 0xb8, 0x9e, 0x49, 0x61, 0xda, 0x62, 0xeb, 0xca, 0x2b, 0x2b,
+  0x2e, 0x1a, 0x43, 0x10, 0xa3, 0xd1, 0xd1, 0x07, 0x6b, 0xc5, 0xd3, 0x96,
+  0xc0, 0x50, 0x3a, 0xb0, 0xcf, 0xcf, 0x0c, 0x2e, 0xd1, 0xf5, 0x3d, 0x28,
+  0xeb, 0x4d, 0x76, 0x2d, 0x1d, 0x03, 0x84, 0x61, 0xfb, 0xfb, 0xea, 0x9a,
+  0xe7, 0x2d, 0x6f, 0xaa, 0xac, 0xfb, 0xd1, 0x07, 0x51, 0xa1, 0x1c, 0x2a,
+  0x7c, 0x6e, 0x17, 0x1a, 0xcd, 0xd2, 0xcd, 0x02, 0x6a, 0x48, 0x3a, 0xcd,
+  0xb5, 0xae, 0x1f, 0x9e, 0x92, 0x52, 0x04, 0x51, 0xf5, 0xe1, 0x29, 0x29,
+  0xf7, 0x70, 0x68, 0x1f, 0x8c, 0x53, 0x06, 0xb2, 0xd1, 0xe9, 0xf4, 0xea,
+  0x7a, 0xf6, 0x37, 0x11, 0x68, 0x05, 0x5b, 0x34, 0xf8, 0xaf, 0x65, 0xfe,
+  0x6e, 0xd4, 0x83, 0x18, 0x5f, 0x32, 0xee, 0x39, 0xbd, 0xba, 0x63, 0x26,
+  0x55, 0xf3, 0x10, 0x94, 0xcf, 0x74, 0x71, 0xa9, 0xc0, 0x8e, 0xd8, 0x29,
+  0x12, 0x61, 0xa4, 0x66, 0xc4, 0x31, 0x0e, 0x8d, 0x67, 0xbc, 0xc4, 0xc4,
+  0x00, 0xd4, 0x85, 0x0c, 0x87, 0x78, 0x78, 0x21, 0x06, 0x24, 0x52, 0xb5,
+  0xbe, 0x46, 0x04, 0x29, 0xc2, 0x8c, 0x9b, 0x4f, 0x09, 0xd4, 0xd6, 0x76,
+  0x59, 0x65, 0x62, 0x2d, 0x30, 0x4c, 0xcf, 0xcb, 0x60, 0xdd, 0xd9, 0x39,
+  0x71, 0xf3, 0xce, 0xc0, 0xd7, 0x73, 0x69, 0x6b, 0xb6, 0x7c, 0x65, 0xfe,
+  0x12, 0x45, 0x22, 0x15, 0x4e, 0x80, 0xaa, 0x08, 0x08, 0x4a, 0x72, 0xf0,
+  0xa3, 0x21, 0xcf, 0xeb, 0x3e, 0x46, 0x38, 0xfe, 0x9d, 0x9b, 0xd3, 0x62,
+  0x5c, 0xa5, 0x58, 0xd7, 0x71, 0xe9, 0xe9, 0x80, 0x31, 0xeb, 0x0f, 0x88,
+  0x0f, 0xfa, 0x32, 0x5b, 0x0a, 0x6f, 0x96, 0x01, 0xbe, 0x08, 0x1e, 0xd0,
+  0x76, 0xf5, 0x54, 0xde, 0xfa, 0x1d, 0xf5, 0xc3, 0x45, 0xf8, 0xa8, 0xa8,
+  0xb6, 0xad, 0xf0, 0x0e, 0x6f, 0x37, 0xa4, 0xeb, 0xe8, 0xe5, 0x9d, 0x97,
+  0x9c, 0xcb, 0x3f, 0xde, 0x77, 0xf4, 0x20, 0x63, 0x50, 0xeb, 0x67, 0x05,
+  0xf3, 0x8f, 0x99, 0xcc, 0xd3, 0x63, 0xc0, 0x79, 0xf8, 0xfb, 0x04, 0x6d,
+  0x5d, 0xd9, 0xe8, 0xa6, 0x4d, 0x4e, 0xce, 0x68, 0x12, 0xc7, 0x85, 0x4d,
+  0xcb, 0xbb, 0x2b, 0xce, 0x6e, 0x76, 0xf5, 0xd1, 0x5a, 0x5f, 0x8a, 0xca,
+  0x54, 0xbb, 0x3d, 0x32, 0x7b, 0x22, 0x3b, 0x7f, 0xaf, 0xfa, 0x1c, 0x18,
+  0xca, 0xcf, 0xcc, 0x2a, 0xcb, 0xd0, 0x60, 0x60, 0x23, 0x65, 0x6f, 0x8e,
+  0xa6, 0x35, 0xde, 0x20, 0xa7, 0xeb, 0x5c, 0xe3, 0x77, 0x7e, 0x3d, 0x61,
+  0xfe, 0xc6, 0x93, 0x65, 0x07, 0x66, 0x7b, 0xaa, 0x63, 0x5f, 0x00, 0x53,
+  0xdb, 0x83, 0x76, 0xfb, 0xe4, 0x13, 0xab, 0xac, 0xc1, 0x35, 0x10, 0xd1,
+  0xdf, 0xf4, 0x6f, 0xfc, 0xcf, 0x3f, 0x03, 0x2d, 0x9c, 0x22, 0x2f, 0xaf,
+  0xdf, 0xe8, 0xe8, 0xd3, 0xd4, 0xf8, 0x29, 0x68, 0xf5, 0xcf, 0x97, 0x35,
+  0xbb, 0xc8, 0x9d, 0x77, 0x68, 0x81, 0xfd, 0xb6, 0xa9, 0xb6, 0xb6, 0xa9,
+  0x33, 0x46, 0x9d, 0x83, 0xaf, 0xb0, 0x96, 0x45, 0x92, 0xdb, 0xcb, 0xe1,
+  0xaa, 0x2f, 0xb7, 0xa6, 0x9a, 0x24, 0x50, 0x26, 0xd1, 0xf6, 0xea, 0x2d,
+  0x74, 0xfa, 0xcd, 0x2b, 0xd9, 0x36, 0xf5, 0x84, 0x9f, 0xa7, 0x0a, 0xa4,
+  0x96, 0xba, 0x60, 0x7a, 0x53, 0x1c, 0x57, 0xd4, 0x50, 0x7d, 0x0a, 0x6f,
+  0x00, 0xa7, 0x35, 0xa7, 0xd9, 0x3a, 0xab, 0x30, 0x35, 0x37, 0x80, 0xf5,
+  0x57, 0x86, 0x4c, 0x19, 0xaf, 0xb1, 0x8d, 0x8d, 0xbd, 0x88, 0xb2, 0x25,
+  0x0d, 0x6a, 0xfe, 0xf7, 0x88, 0x1e, 0x66, 0xf8, 0x9c, 0x1e, 0xfa, 0xab,
+  0x2b, 0xdf, 0x53, 0xbe, 0x8a, 0x68, 0xf9, 0x15, 0xb6, 0x6e, 0x62, 0x77,
+  0xb4, 0x89, 0xda, 0x02, 0x4f, 0xc2, 0x04, 0x92, 0x44, 0xfd, 0xd9, 0x10,
+  0x59, 0x72, 0x45, 0xe9, 0x58, 0x27, 0x9d, 0x10, 0xde, 0x63, 0xb9, 0x76,
+  0xcd, 0xab, 0x8e, 0x94, 0xb5, 0x19, 0x69, 0xcf, 0x07, 0x53, 0x11, 0xa2,
+  0x5c, 0xfd, 0xf8, 0xfa, 0x9a, 0xdc, 0xd8, 0xc4, 0x2a, 0x49, 0xa5, 0xba,
+  0xc1, 0x2a, 0xeb, 0xfd, 0x02, 0x2c, 0x69, 0xc3, 0x9a, 0x2e, 0x41, 0x5d,
+  0x25, 0xdd, 0x9a, 0x46, 0x4c, 0xd0, 0x4f, 0x0d, 0x78, 0xd2, 0xb5, 0xd8,
+  0x78, 0xda, 0x11, 0x5f, 0xcc, 0xda, 0x4c, 0x75, 0x15, 0x36, 0x1c, 0x34,
+  0xd4, 0x82, 0x5d, 0x32, 0x70, 0x85, 0x44, 0x75, 0x49, 0x3b, 0x47, 0x17,
+  0xe9, 0xcc, 0x9f, 0x01, 0x63, 0xf2, 0xb2, 0xac, 0x85, 0xc6, 0x2d, 0x45,
+  0x0d, 0xbc, 0xc0, 0x8c, 0xd9, 0xb8, 0x62, 0xa4, 0x2d, 0x92, 0x0b, 0x2b,
+  0x3f, 0xf5, 0x63, 0x30, 0x47, 0xa3, 0x9c, 0x33, 0xe6, 0xbd, 0x8c, 0xd2,
+  0xe9, 0xd7, 0x75, 0x28, 0xe6, 0x85, 0x34, 0x26, 0x0d, 0x7e, 0xc5, 0x09,
+  0xae, 0xd9, 0x58, 0x80, 0x77, 0xad, 0xda, 0x83, 0x12, 0xe7, 0x30, 0x2f,
+  0xc2, 0x8a, 0x80, 0x10, 0xb8, 0xcf, 0x6d, 0x2e, 0x2f, 0xce, 0xe2, 0x05,
+  0xe7, 0x15, 0x0f, 0x1b, 0xa5, 0xfb, 0xbb, 0x3b, 0x46, 0xf3, 0x86, 0x0a,
+  0xcb, 0xac, 0xc1, 0x46, 0x18, 0x62, 0x3a, 0x00, 0x8c, 0x00, 0x4c, 0x7f,
+  0x98, 0xb9, 0xa8, 0x92, 0xf1, 0xb2, 0x5f, 0xed, 0xd3, 0x9a, 0xce, 0xad,
+  0xca, 0x16, 0x21, 0x1e, 0x5e, 0x1a, 0x04, 0xef, 0x81, 0xda, 0x8f, 0x82,
+  0x82, 0xbf, 0x23, 0xc2, 0x39, 0xec, 0xf5, 0xb9, 0x48, 0xa4, 0xd6, 0xe8,
+  0x52, 0x96, 0xb7, 0x20, 0xc4, 0xae, 0x6c, 0x5d, 0xad, 0xa0, 0xdb, 0xb2,
+  0x33, 0x31, 0x8f, 0xeb, 0xc5, 0x71, 0xc6, 0x42, 0x56, 0x94, 0x1a, 0x8c,
+  0x7c, 0xaf, 0x65, 0xb8, 0x2d, 0xe8, 0x00, 0x7b, 0x6f, 0x80, 0x5d, 0x27,
+  0xcc, 0x32, 0xea, 0x69, 0x6c, 0xaf, 0xf3, 0x6d, 0x76, 0x3d, 0xc0, 0x77,
+  0x03, 0x35, 0x7a, 0xe5, 0xa5, 0x7e, 0x74, 0x92, 0x1c, 0xf3, 0xcf, 0xba,
+  0x9b, 0xee, 0xde, 0xe6, 0xb2, 0xed, 0x07, 0x2d, 0x7a, 0x03, 0x84, 0xb3,
+  0x0b, 0x22, 0x0b, 0xa8, 0xf4, 0x8b, 0x4e, 0x73, 0x73, 0xc8, 0x5c, 0x5a,
+  0xb9, 0xd8, 0xf2, 0x87, 0xa9, 0x01, 0xe6, 0xa2, 0x79, 0x79, 0x61, 0xcb,
+  0xa5, 0x1e, 0xe9, 0x63, 0xda, 0x64, 0x88, 0x29, 0x3a, 0x35, 0x10, 0x96,
+  0x43, 0xdd, 0x77, 0xe8, 0x21, 0xa5, 0x8f, 0x76, 0x9a, 0xed, 0x55, 0xf4,
+  0x10, 0xba, 0x88, 0x9b, 0x72, 0xbb, 0xa9, 0x05, 0x69, 0xe4, 0xa5, 0x75,
+  0x14, 0x6e, 0x7c, 0x62, 0xb4, 0x6b, 0x0f, 0x76, 0xd1, 0x53, 0x5f, 0xf0,
+  0x95, 0x48, 0x3f, 0xe6, 0x42, 0x3e, 0x7b, 0xe1, 0x8e, 0x3c, 0x6d, 0x59,
+  0x14, 0xc6, 0x57, 0x08, 0x70, 0x13, 0x82, 0x88, 0x4d, 0xd9, 0x01, 0x50,
+  0x33, 0x49, 0x49, 0x64, 0x0c, 0xc8, 0x0b, 0xaa, 0xd6, 0x98, 0xfc, 0x0e,
+  0x45, 0x5d, 0xfa, 0xb5, 0x1b, 0xde, 0x3c, 0xdc, 0x1d, 0xd0, 0x32, 0x0e,
+  0x84, 0xae, 0x95, 0xa5, 0xe3, 0xa2, 0x40, 0x00, 0x03, 0x15, 0xaf, 0xa0,
+  0xeb, 0xe0, 0xe4, 0x84, 0x70, 0xc9, 0x96, 0xc9, 0x4f, 0x8e, 0x66, 0xbd,
+  0x2a, 0xa3, 0x77, 0xf5, 0x7f, 0xd5, 0xa5, 0xaa, 0x17, 0xbd, 0x3e, 0x77,
+  0x8c, 0x40, 0x7a, 0xfc, 0x0c, 0x06, 0xd5, 0xda, 0x32, 0x7b, 0x19, 0x95,
+  0xd8, 0xe0, 0x1d, 0x7d, 0x24, 0xf1, 0x91, 0x60, 0x02, 0xcc, 0xf2, 0x40,
+  0xbc, 0x2c, 0xa1, 0xb6, 0x0f, 0x3d, 0x11, 0x7f, 0x01, 0x65, 0xf1, 0x15,
+  0x3f, 0xbe, 0x2f, 0x50, 0xea, 0x8d, 0xbb, 0x40, 0x2b, 0x15, 0x13, 0x96,
+  0x7f, 0x3b, 0xb8, 0xb6, 0xbf, 0xcb, 0x6e, 0xe7, 0x54, 0x7e, 0x0d, 0x78,
+  0xf3, 0x33, 0xb5, 0xba, 0xe2, 0x52, 0x14, 0xde, 0x92, 0xc6, 0x96, 0x5c,
+  0x21, 0x0a, 0x19, 0x9d, 0xce, 0x23, 0xcd, 0x53, 0x91, 0xb1, 0x11, 0x9b,
+  0xe4, 0xa8, 0xf7, 0x88, 0x9a, 0x9b, 0x86, 0xa5, 0x73, 0x9b, 0x26, 0x72,
+  0xde, 0x10, 0xfa, 0x35, 0x5b, 0x74, 0xb4, 0x34, 0x2e, 0xa4, 0x5d, 0x55,
+  0xf3, 0x2f, 0x08, 0x07, 0xe5, 0xd5, 0xe8, 0x7d, 0x90, 0x11, 0xd4, 0x97,
+  0x55, 0xd1, 0xd0, 0x4e, 0x6d, 0x24, 0x00, 0x6f, 0xc6, 0x0d, 0xee, 0xf2,
+  0xe8, 0xcb, 0x4e, 0x79, 0xf7, 0x75, 0xde, 0x4b, 0xd7, 0xa9, 0x02, 0x18,
+  0x10, 0xab, 0xa0, 0xfc, 0x50, 0x56, 0x42, 0x21, 0xd7, 0xbc, 0x38, 0xc3,
+  0xf0, 0xec, 0xd8, 0xcd, 0x35, 0xe4, 0x42, 0x7b, 0x05, 0x6e, 0xe5, 0x5b,
+  0xd5, 0xc4, 0x0f, 0x84, 0x6a, 0x12, 0x49, 0x23, 0xfa, 0xb5, 0xee, 0xef,
+  0x60, 0x16, 0xa0, 0xd1, 0x9f, 0xf7, 0x60, 0xc4, 0xf0, 0x33, 0xc8, 0xd1,
+  0x22, 0xd2, 0x8d, 0x7e, 0x6b, 0x59, 0x7d, 0x09, 0x0e, 0x95, 0xbe, 0x92,
+  0x18, 0xaf, 0x75, 0xb3, 0x03, 0xc8, 0x34, 0xc9, 0x16, 0x69, 0xcd, 0x75,
+  0xd9, 0xf5, 0x8e, 0x1e, 0x6e, 0xd8, 0xb7, 0xf7, 0x77, 0xb4, 0x24, 0x4e,
+  0x09, 0x1c, 0x27, 0xc0, 0x5c, 0x81, 0xae, 0x80, 0xc3, 0xab, 0xc7, 0xc2,
+  0x83, 0x39, 0x29, 0xc4, 0xc4, 0x65, 0xb9, 0x94, 0x8c, 0x85, 0xe0, 0x3a,
+  0x59, 0x3c, 0xe7, 0xd4, 0x53, 0x44, 0x47, 0x19, 0x25, 0x35, 0x19, 0x5a,
+  0xc8, 0x0f, 0x3b, 0xc9, 0xf9, 0xd1, 0x64, 0x4e, 0x7f, 0x7e, 0xf2, 0x2b,
+  0x68, 0x08, 0x04, 0x8d, 0x9d, 0x31, 0x7c, 0x3a, 0x43, 0x73, 0xa4, 0x7b,
+  0xf3, 0xee, 0x3c, 0xec, 0x93, 0xdf, 0x89, 0x09, 0x63, 0x17, 0x10, 0x0e,
+  0x56, 0xd2, 0xfe, 0xd2, 0x42, 0x5c, 0x33, 0x02, 0x07, 0xd3, 0xee, 0x8d,
+  0xad, 0xa0, 0xdb, 0xfe, 0xe6, 0xc6, 0x66, 0x7b, 0xfb, 0x98, 0x91, 0x91,
+  0xe5, 0x94, 0x28, 0xa6, 0x4d, 0xca, 0x3e, 0xc3, 0x1e, 0x43, 0x6d, 0x3d,
+  0x11, 0x72, 0xac, 0x7a, 0xea, 0xf2, 0xaa, 0xad, 0xc4, 0x47, 0xda, 0x8d,
+  0x2e, 0x3e, 0xe5, 0x47, 0xac, 0x62, 0xda, 0x54, 0x43, 0xbf, 0x2c, 0x41,
+  0x1d, 0x3f, 0x04, 0x8c, 0x02, 0x07, 0x5a, 0xcd, 0x57, 0x41, 0xf8, 0x98,
+  0x28, 0xec, 0x96, 0x96, 0xd9, 0xb2, 0x48, 0x10, 0x9d, 0xaf, 0x1a, 0x18,
+  0x9f, 0x8f, 0x48, 0x92, 0x11, 0xec, 0xd0, 0xc4, 0xd2, 0x3f, 0xac, 0x0d,
+  0x0d, 0xc3, 0xc9, 0x01, 0x3c, 0x82, 0xa7, 0xa5, 0x69, 0xa0, 0xef, 0x98,
+  0xbb, 0xcc, 0x4f, 0x3b, 0xf7, 0x9c, 0x19, 0xbb, 0x1e, 0xfe, 0x3a, 0x3a,
+  0x3d, 0xa6, 0xbf, 0xa9, 0x74, 0x02, 0xaf, 0x6b, 0x16, 0x17, 0xa4, 0x5d,
+  0x8c, 0xfd, 0x02, 0x87, 0xef, 0x5d, 0x87, 0x0a, 0x29, 0x8c, 0xb2, 0x2a,
+  0x18, 0x84, 0xe2, 0x4f, 0x6e, 0x50, 0x50, 0x2d, 0xd4, 0xa4, 0x24, 0x1e,
+  0x42, 0x29, 0x2b, 0xc2, 0xea, 0x7e, 0x37, 0xa4, 0x7c, 0x67, 0xc0, 0xab,
+  0x26, 0x28, 0x3a, 0x84, 0x73, 0x45, 0xdc, 0x18, 0xff, 0xc3, 0x34, 0xd0,
+  0x16, 0xde, 0x8c, 0xee, 0x7e, 0x7f, 0x3a, 0xd3, 0x4d, 0x7f, 0x28, 0xcb,
+  0x80, 0x8f, 0x58, 0x6c, 0x3b, 0x3e, 0x29, 0x45, 0xbe, 0xad, 0x4b, 0x5d,
+  0x8f, 0xeb, 0xdc, 0x36, 0x63, 0x6e, 0xff, 0xab, 0x13, 0x1f, 0x2c, 0xaa,
+  0xf5, 0x4c, 0x64, 0xaf, 0x2d, 0x75, 0x9f, 0x1c, 0xc2, 0x47, 0x01, 0xe3,
+  0x49, 0x14, 0xc1, 0x75, 0xff, 0xd7, 0x8a, 0xc4, 0xc5, 0x38, 0x00, 0xdc,
+  0xe0, 0x63, 0x40, 0x4e, 0xdf, 0xff, 0x5b, 0x7c, 0x8d, 0x25, 0x74, 0x93,
+  0xda, 0x68, 0xbb, 0x25, 0x0c, 0x26, 0x2f, 0x41, 0xc4, 0xbf, 0x9e, 0xa8,
+  0x33, 0x3f, 0xaf, 0x9d, 0x35, 0x15, 0x64, 0xe3, 0xc7, 0xde, 0x7d, 0x64,
+  0xb2, 0xfb, 0xb3, 0x5e, 0x87, 0x17, 0x64, 0xb1, 0x68, 0xdc, 0x99, 0xdd,
+  0x3c, 0x5a, 0x3b, 0x78, 0xdb, 0xff, 0x81, 0x06, 0x73, 0x81, 0x81, 0x31,
+  0xdb, 0x11, 0x2b, 0x71, 0x03, 0xdb, 0x90, 0x6c, 0xc7, 0x7f, 0x90, 0x4b,
+  0x62, 0x9b, 0xc2, 0x17, 0xc6, 0xf8, 0x6e, 0xf7, 0xb3, 0xe9, 0x37, 0x39,
+  0xe1, 0xa1, 0xc5, 0x48, 0x16, 0xa4, 0x12, 0x4d, 0x99, 0xd4, 0x5a, 0x74,
+  0xed, 0x5b, 0x7a, 0x07, 0x18, 0xc8, 0x9a, 0x39, 0x7a, 0xa8, 0x60, 0xf8,
+  0x32, 0x7a, 0x31, 0xc2, 0x3e, 0x64, 0x80, 0x03, 0xc1, 0xca, 0x18, 0x97,
+  0x89, 0x01, 0xf3, 0xf3, 0xe9, 0x52, 0xcb, 0x4e, 0x4f, 0xd5, 0x0b, 0x1d,
+  0x34, 0xea, 0x3d, 0x93, 0xbf, 0x74, 0x02, 0xb6, 0x14, 0xa0, 0xf9, 0xbf,
+  0x8e, 0xaa, 0xb3, 0xef, 0x38, 0xfe, 0xd5, 0x4a, 0xaf, 0xc5, 0x75, 0xf4,
+  0xf7, 0x61, 0x26, 0x2e, 0x82, 0x15, 0x40, 0xe4, 0x5d, 0x78, 0x6e, 0x6e,
+  0x78, 0xe3, 0xd7, 0x34, 0x9b, 0xe9, 0x8d, 0x82, 0x5d, 0x81, 0x47, 0x48,
+  0xd8, 0x82, 0xac, 0x0c, 0x44, 0x6f, 0x4c, 0xda, 0xcd, 0x67, 0x49, 0xf8,
+  0x2a, 0x8e, 0x8e, 0xc4, 0xc6, 0x6d, 0x88, 0x34, 0x21, 0xf2, 0xb8, 0x26,
+  0xca, 0xff, 0xde, 0x1c, 0xba, 0x1e, 0xd0, 0x4c, 0x44, 0x7d, 0x66, 0x90,
+  0x59, 0x30, 0xb7, 0xa7, 0x29, 0x74, 0x7f, 0x8b, 0xaf, 0xcc, 0x30, 0xce,
+  0xce, 0x1c, 0x98, 0x40, 0x5e, 0x1b, 0x4c, 0xa5, 0x88, 0x91, 0x84, 0xc5,
+  0x97, 0x00, 0xce, 0x2a, 0x9d, 0xbc, 0x82, 0xe2, 0x06, 0xc4, 0x99, 0xd2,
+  0x9c, 0xc9, 0xc9, 0x45, 0x1b, 0x02, 0x78, 0xb9, 0xda, 0xf6, 0x95, 0xd7,
+  0x29, 0x99, 0x75, 0x16, 0x65, 0x87, 0xd5, 0xad, 0x0e, 0x16, 0xef, 0x57,
+  0x95, 0xbe, 0x87, 0x66, 0x82, 0x83, 0x1f, 0x6e, 0xa7, 0x75, 0x28, 0xcb,
+  0x1b, 0x75, 0xb1, 0x7e, 0xf0, 0x6f, 0x52, 0x52, 0x4d, 0x32, 0x32, 0xb4,
+  0x7e, 0x44, 0x00, 0xf5, 0xfc, 0xf0, 0xda, 0xd9, 0x1d, 0x3c, 0xa9, 0x90,
+  0xd8, 0x5d, 0xc0, 0xc9, 0x83, 0x8a, 0x29, 0xa9, 0x60, 0xc9, 0xe9, 0x25,
+  0xef, 0xef, 0xb3, 0xdb, 0x92, 0x31, 0xe4, 0x6e, 0x83, 0x6b, 0x00, 0x0a,
+  0xd4, 0xed, 0x10, 0xd4, 0x83, 0x8f, 0x22, 0x68, 0x04, 0xc0, 0x3d, 0x04,
+  0xc7, 0xf3, 0x81, 0x0a, 0x6e, 0xd8, 0x90, 0x71, 0xc9, 0x69, 0x80, 0x0e,
+  0x7e, 0xa3, 0x26, 0xd1, 0x32, 0x5f, 0xcb, 0xc7, 0x3c, 0x3c, 0xca, 0x48,
+  0x0d, 0xd1, 0xe7, 0xbb, 0x01, 0xe0, 0xa1, 0x77, 0x33, 0xe9, 0xa3, 0x4e,
+  0xd7, 0x9a, 0x43, 0x6c, 0x78, 0x61, 0x98, 0xdb, 0xdb, 0xd9, 0x3f, 0x6e,
+  0xc1, 0xb3, 0x6b, 0x66, 0xe0, 0x02, 0x35, 0x11, 0x58, 0x99, 0x62, 0xe8,
+  0x75, 0xf8, 0x19, 0xa6, 0xc8, 0x1b, 0x14, 0x6a, 0x2d, 0x3f, 0xcb, 0x21,
+  0xa0, 0xa3, 0x6d, 0x5b, 0x8c, 0x63, 0x13, 0x94, 0x61, 0x48, 0xc4, 0xb0,
+  0x99, 0x73, 0xd6, 0x09, 0x12, 0x04, 0x66, 0xac, 0xe6, 0x49, 0x60, 0xbe,
+  0xaf, 0xd4, 0xc5, 0xe6, 0x68, 0xfa, 0x54, 0xb4, 0x7e, 0xae, 0x43, 0xe4,
+  0x40, 0xd8, 0x4a, 0x59, 0xfe, 0xc8, 0xb5, 0x62, 0x27, 0xba, 0x4f, 0x57,
+  0x1b, 0x60, 0x71, 0xf3, 0x12, 0x83, 0x83, 0x7c, 0x57, 0x08, 0xff, 0xbc,
+  0x75, 0x74, 0xbb, 0x55, 0x0d, 0xf8, 0x2d, 0x8a, 0xc8, 0xa8, 0x39, 0xcd,
+  0x8d, 0x55, 0xf4, 0xb4, 0x3d, 0x5f, 0x45, 0xf1, 0x00, 0x3d, 0x2e, 0x31,
+  0xad, 0x26, 0xeb, 0xdd, 0x6d, 0x7b, 0x9b, 0x7f, 0xb6, 0xa2, 0xa6, 0xb5,
+  0x5f, 0x0a, 0x6f, 0xdd, 0x6a, 0x25, 0x5e, 0xaf, 0xaf, 0x47, 0xb3, 0x0a,
+  0x5d, 0xbf, 0xf5, 0x52, 0xdd, 0x71, 0x6c, 0xf2, 0x22, 0x22, 0x47, 0x7c,
+  0x94, 0x19, 0xb5, 0x9a, 0x4b, 0x2e, 0xd4, 0x82, 0xac, 0xb7, 0xce, 0x2d,
+  0x9e, 0x11, 0xf0, 0xc5, 0x08, 0x4d, 0xf4, 0xb7, 0x1c, 0xe7, 0xa9, 0x74,
+  0x39, 0xad, 0x2d, 0x6f, 0xd3, 0xa0, 0xba, 0xbc, 0xcc, 0xdc, 0x85, 0xfa,
+  0x14, 0xe2, 0x78, 0x68, 0xd9, 0xb4, 0xb8, 0x20, 0x77, 0xaf, 0xca, 0xd5,
+  0x74, 0x4b, 0x43, 0x8b, 0x25, 0x91, 0x43, 0x4f, 0x54, 0xf4, 0xdf, 0x11,
+  0xd7, 0xd7, 0x68, 0x68, 0xd3, 0xff, 0xef, 0x7c, 0x8e, 0x39, 0xeb, 0x4c,
+  0xd2, 0x73, 0xa4, 0x2e, 0xaf, 0x42, 0xbe, 0xbe, 0x19, 0x80, 0xec, 0xec,
+  0x51, 0xa1, 0x35, 0x48, 0xec, 0xec, 0x31, 0x87, 0xe0, 0x98, 0xb6, 0xb6,
+  0x2a, 0x07, 0x66, 0x74, 0x74, 0x99, 0xd2, 0x51, 0x36, 0x94, 0x5a, 0x45,
+  0x1a, 0x1a, 0x7f, 0xbe, 0x03, 0xa2, 0xf2, 0xe1, 0x1a, 0x82, 0x60, 0x98,
+  0x58, 0xfb, 0xdd, 0xb7, 0x03, 0x6f, 0x0c, 0xfd, 0x7c, 0xe2, 0x0e, 0x09,
+  0xe9, 0xe6, 0x5b, 0x50, 0xb1, 0xb0, 0xd7, 0xc9, 0x86, 0x9d, 0xd3, 0x9b,
+  0xf7, 0xd8, 0x00, 0x1f, 0xbb, 0x97, 0x72, 0x00, 0xec, 0xc0, 0x44, 0x64,
+  0x57, 0xec, 0x15, 0x1e, 0xfd, 0xb8, 0xba, 0x89, 0xf8, 0x5e, 0x1d, 0xea,
+  0x85, 0x36, 0x79, 0xdd, 0xdc, 0x90, 0xe6, 0x13, 0xd8, 0x8b, 0xfb, 0x20,
+  0x32, 0xe0, 0x69, 0x3a, 0x9d, 0xb7, 0x6c, 0xef, 0x78, 0x59, 0x75, 0x14,
+  0x3e, 0x0b, 0xde, 0x5f, 0x44, 0x42, 0x41, 0xac, 0x18, 0x62, 0xac, 0xb5,
+  0x4b, 0x23, 0xa0, 0xa0, 0xa0, 0x9b, 0x0d, 0x16, 0x95, 0x16, 0x32, 0xcf,
+  0x27, 0x90, 0xf5, 0x24, 0xa6, 0xda, 0x56, 0x69, 0x24, 0xdc, 0x62, 0xf0,
+  0x5c, 0x1c, 0x1a, 0x85, 0x46, 0x93, 0xcb, 0x62, 0x50, 0xfb, 0x53, 0xff,
+  0x8f, 0x23, 0x17, 0xe4, 0x26, 0xcd, 0x82, 0xb4, 0x6d, 0xf6, 0xf5, 0xc3,
+  0x95, 0x61, 0xb0, 0xe1, 0xa1, 0x60, 0xf6, 0x8e, 0x74, 0xf2, 0x69, 0x6f,
+  0x8e, 0xf6, 0x7d, 0x5d, 0x00, 0x71, 0x7f, 0xb2, 0x69, 0x26, 0x96, 0x4d,
+  0xc3, 0x3e, 0xab, 0xba, 0x26, 0xa1, 0x18, 0xc8, 0x4a, 0x8a, 0x99, 0x6f,
+  0x35, 0xd3, 0x4c, 0x9c, 0x39, 0x6f, 0xc3, 0x63, 0x65, 0x86, 0xc4, 0x98,
+  0x61, 0x0f, 0xee, 0xbc, 0x82, 0xae, 0x1b, 0x66, 0xc0, 0xf2, 0xda, 0xaa,
+  0x08, 0x28, 0xee, 0xf2, 0x2b, 0x68, 0xac, 0xc9, 0xeb, 0x91, 0x72, 0x63,
+  0xd8, 0xc1, 0x30, 0x43, 0x8d, 0xa0, 0x9e, 0xcb, 0x65, 0x68, 0xb7, 0x88,
+  0x53, 0x15, 0x90, 0x86, 0xb2, 0xa1, 0xf3, 0x1c, 0xf9, 0x1a, 0xec, 0x24,
+  0x33, 0xf6, 0xcf, 0x8b, 0x67, 0x98, 0xee, 0xc9, 0xc9, 0x4d, 0x34, 0x45,
+  0x22, 0x4f, 0xe6, 0xd1, 0xca, 0x7f, 0x55, 0xff, 0x9e, 0x9e, 0x31, 0x5d,
+  0x60, 0x4a, 0x4f, 0x96, 0x51, 0xcf, 0x66, 0x3c, 0xdb, 0x88, 0x30, 0xe1,
+  0x26, 0x32, 0xbe, 0x20, 0x5b, 0xfd, 0x8e, 0x85, 0xb7, 0x59, 0x3b, 0xb7,
+  0x72, 0x1a, 0x59, 0xd3, 0x21, 0x6c, 0x91, 0x6c, 0x27, 0x27, 0x27, 0x94,
+  0x0f, 0xda, 0x75, 0x25, 0x93, 0x28, 0x0c, 0xc2, 0x07, 0x03, 0x03, 0x3d,
+  0x47, 0x2e, 0x87, 0xca, 0x87, 0xcc, 0x27, 0x7a, 0x40, 0xe0, 0xb8, 0xdd,
+  0x0b, 0x35, 0xe6, 0xac, 0x30, 0xab, 0x97, 0xf1, 0x43, 0x77, 0x83, 0x77,
+  0xbf, 0xf8, 0x12, 0xeb, 0xfb, 0x05, 0x78, 0x67, 0x06, 0x1a, 0x3c, 0x3c,
+  0x8f, 0x9b, 0xfe, 0x8b, 0xa7, 0xc5, 0x7d, 0x33, 0xe7, 0xbb, 0x3c, 0x91,
+  0xb0, 0x3d, 0x3f, 0x3f, 0xd7, 0xb0, 0x4d, 0x08, 0x10, 0x6a, 0xb8, 0x03,
+  0x22, 0xb7, 0x28, 0xae, 0x4c, 0x57, 0x18, 0xc9, 0x92, 0x3b, 0x4a, 0x44,
+  0xc8, 0x9f, 0x8c, 0xad, 0x4b, 0xbf, 0xc9, 0x1a, 0x1a, 0xdf, 0x26, 0x6e,
+  0xa0, 0x87, 0x77, 0x7c, 0x66, 0x30, 0x68, 0xac, 0x43, 0xe6, 0xd8, 0xa2,
+  0x97, 0x80, 0xbc, 0x65, 0xd3, 0x91, 0x6d, 0x78, 0x5f, 0x6b, 0x3f, 0x7c,
+  0x11, 0x25, 0x0f, 0x83, 0xcf, 0xc8, 0x53, 0xb8, 0x44, 0x9f, 0x3f, 0x11,
+  0x10, 0x0c, 0x52, 0x3d, 0x42, 0x69, 0xe6, 0xe4, 0xc1, 0x6b, 0xc6, 0x97,
+  0x25, 0x3e, 0x3c, 0x40, 0xd3, 0xa0, 0xbb, 0xa7, 0x3a, 0xcb, 0x4e, 0xba,
+  0xba, 0xf9, 0xdd, 0x3b, 0xe6, 0x47, 0x81, 0x0e, 0x7b, 0xcf, 0x1a, 0xdc,
+  0x09, 0x0d, 0xe9, 0x65, 0x48, 0x08, 0xaf, 0x59, 0x82, 0xfb, 0x44, 0x12,
+  0x9f, 0xd4, 0x26, 0xa8, 0x0a, 0xd3, 0xd9, 0x53, 0xa1, 0x62, 0x1d, 0x69,
+  0x57, 0xc1, 0xd7, 0xbc, 0x53, 0x86, 0x39, 0x2f, 0xf3, 0x4a, 0x46, 0x9f,
+  0x38, 0x23, 0xc8, 0x88, 0x6d, 0x8d, 0x77, 0x10, 0x0f, 0x2d, 0x3d, 0x69,
+  0x49, 0x77, 0x14, 0x1c, 0x4c, 0xda, 0xd6, 0x86, 0x4d, 0x6c, 0x99, 0x2e,
+  0x34, 0xa7, 0xea, 0x91, 0xe6, 0x1a, 0xc5, 0xbf, 0x67, 0xb9, 0x47, 0x5c,
+  0x26, 0x98, 0xc3, 0xcd, 0x47, 0x62, 0x97, 0x3f, 0x5c, 0x1f, 0x61, 0xcb,
+  0x99, 0xf3, 0xb8, 0x16, 0x02, 0xe5, 0x05, 0x9a, 0x85, 0x5a, 0xa4, 0x89,
+  0xd3, 0x0f, 0x1f, 0x2d, 0x05, 0xb2, 0x86, 0x80, 0xf2, 0x29, 0xe1, 0x4b,
+  0x90, 0x6d, 0x13, 0x92, 0x93, 0x16, 0x1c, 0x01, 0x99, 0xbe, 0x25, 0x47,
+  0x53, 0xc1, 0x79, 0x40, 0xa1, 0xa3, 0xf8, 0xf6, 0xca, 0xe9, 0x21, 0xb4,
+  0xab, 0xa5, 0x47, 0xb9, 0xc1, 0xb5, 0xf7, 0x6e, 0xd7, 0xda, 0xbb, 0x15,
+  0xc3, 0xef, 0xba, 0x3a, 0x95, 0x3f, 0xbc, 0x66, 0x4d, 0xe6, 0x20, 0xfa,
+  0xee, 0x3f, 0x3f, 0xab, 0x32, 0x30, 0xc1, 0x4f, 0x6f, 0x32, 0x7b, 0x3e,
+  0xc9, 0xc1, 0x7b, 0x05, 0x67, 0x15, 0x37, 0xe7, 0x18, 0x6f, 0xa1, 0x58,
+  0xb4, 0xd9, 0x37, 0x4d, 0xd9, 0xdd, 0x1c, 0x51, 0xdc, 0x1c, 0x85, 0x4d,
+  0x5f, 0xfd, 0x0f, 0xf5, 0x3b, 0x04, 0xa6, 0x97, 0x60, 0xa3, 0x45, 0xe9,
+  0xd2, 0x0a, 0xb4, 0x8d, 0x31, 0xef, 0x3f, 0x88, 0x88, 0x8a, 0xb9, 0xb7,
+  0x59, 0x85, 0x83, 0x72, 0x28, 0x2f, 0xb8, 0xc7, 0x89, 0xd2, 0x6d, 0x34,
+  0xb4, 0x50, 0xa7, 0xaa, 0x50, 0xc6, 0x8f, 0xa6, 0xf2, 0x9b, 0xee, 0xd6,
+  0xb5, 0xae, 0xfc, 0x91, 0xd2, 0x51, 0x4e, 0xb7, 0x43, 0xdc, 0xdc, 0x7a,
+  0xaa, 0xa6, 0xa6, 0xa5, 0x13, 0x7a, 0x5b, 0xd8, 0x5d, 0xe8, 0xa3, 0x0c,
+  0x41, 0x62, 0xe8, 0xfe, 0x35, 0x8a, 0xa1, 0x4c, 0xb5, 0x93, 0x50, 0x59,
+  0x61, 0x45, 0x37, 0x9f, 0x39, 0x74, 0x24, 0x71, 0x18, 0x5a, 0xc8, 0x9c,
+  0x93, 0x82, 0xb0, 0xb1, 0xd0, 0xd0, 0xc8, 0xae, 0x36, 0xce, 0xf2, 0xd9,
+  0x9e, 0xe5, 0x8b, 0xbe, 0xac, 0x21, 0x0f, 0x64, 0x2a, 0x66, 0x2b, 0xce,
+  0xac, 0x21, 0xdd, 0xcd, 0x52, 0x19, 0x46, 0x00, 0xb9, 0xce, 0xe0, 0xd1,
+  0x76, 0x3e, 0x43, 0x48, 0x0e, 0x27, 0xd4, 0xb8, 0x01, 0x7a, 0x06, 0x86,
+  0x00, 0xeb, 0xee, 0x65, 0x34, 0x70, 0x17, 0x9a, 0x9e, 0x2e, 0x8f, 0x8f,
+  0x27, 0xd8, 0x8a, 0x30, 0xcb, 0x0a, 0x3f, 0x91, 0x5c, 0xda, 0xaf, 0xf3,
+  0xc8, 0xda, 0xd6, 0x5f, 0x17, 0xff, 0x00, 0x6e, 0x48, 0xcb, 0x10, 0xf5,
+  0x1f, 0x9c, 0xf7, 0xb4, 0xc7, 0x56, 0x79, 0x2c, 0x5f, 0x5a, 0xbb, 0x3a,
+  0xcc, 0x8e, 0x59, 0x73, 0x45, 0x92, 0x63, 0xd6, 0x60, 0x9e, 0x6f, 0x8d,
+  0x6b, 0xbc, 0x0a, 0xb2, 0x37, 0x31, 0x20, 0xff, 0xff, 0x17, 0xee, 0x3e,
+  0xd7, 0xe2, 0x9e, 0xf8, 0xa4, 0x12, 0xd5, 0xb3, 0x94, 0x80, 0x66, 0x41,
+  0x7f, 0xe2, 0xfb, 0x02, 0x4a, 0xfe, 0xf1, 0xf0, 0x8c, 0x19, 0xe1, 0x76,
+  0x75, 0xd6, 0x0c, 0x46, 0xc8, 0xff, 0xe5, 0x31, 0x19, 0x34, 0x6a, 0xd4,
+  0xfb, 0xc2, 0x11, 0x4d, 0x00, 0xb0, 0x52, 0x1d, 0xf2, 0x6e, 0xa2, 0x26,
+  0x0a, 0xf4, 0x6b, 0xfc, 0x23, 0xe6, 0x74, 0x5b, 0xf5, 0x55, 0x78, 0x88,
+  0xd6, 0xf5, 0xce, 0xe8, 0x2a, 0x12, 0x1d, 0xe7, 0xa8, 0xe1, 0x30, 0x58,
+  0xb1, 0xc0, 0x97, 0xc4, 0x4f, 0xf1, 0x68, 0xc2, 0x2b, 0xf2, 0x6d, 0x98,
+  0x52, 0x40, 0x4c, 0x47, 0x0f, 0xd0, 0x7f, 0xa1, 0xc3, 0x65, 0x71, 0x4d,
+  0x0b, 0x7e, 0x05, 0x33, 0x76, 0x09, 0x3b, 0xe8, 0x38, 0x54, 0x27, 0x26,
+  0xde, 0x8e, 0x76, 0x3d, 0x31, 0xe0, 0x36, 0x8d, 0x78, 0xe2, 0xf1, 0xb4,
+  0x11, 0x84, 0xac, 0x0d, 0xed, 0x6e, 0x15, 0x08, 0xf9, 0xc6, 0x99, 0x4f,
+  0x8b, 0xad, 0x54, 0x0f, 0x59, 0x8a, 0x9a, 0x32, 0x63, 0xc8, 0xa5, 0xa3,
+  0x2f, 0xf2, 0x53, 0x09, 0x3e, 0x02, 0x4b, 0x1f, 0x0f, 0x7e, 0xda, 0xc0,
+  0x93, 0xd3, 0x36, 0xbd, 0x20, 0x3f, 0xcd, 0xb2, 0xe4, 0xd0, 0x37, 0x14,
+  0xbb, 0xda, 0x2c, 0xc8, 0x74, 0xe9, 0xf6, 0xed, 0xf7, 0x7c, 0x86, 0xe6,
+  0x0c, 0x78, 0x20, 0x38, 0xce, 0x1d, 0x79, 0x87, 0xde, 0x73, 0xcf, 0x79,
+  0x84, 0x8b, 0xba, 0xc5, 0xe8, 0x65, 0x9d, 0xec, 0xc2, 0x55, 0x29, 0x31,
+  0x4f, 0x8b, 0x6f, 0x0d, 0x26, 0x32, 0x29, 0xb0, 0x68, 0x66, 0xc2, 0x61,
+  0x4d, 0xb8, 0x9e, 0x0b, 0xeb, 0x94, 0x57, 0xfa, 0x85, 0x3a, 0xf7, 0x9e,
+  0x87, 0x15, 0x8d, 0xc2, 0x61, 0xa7, 0x87, 0x4e, 0x08, 0x9b, 0x42, 0x3e,
+  0xce, 0xc3, 0x61, 0x8a, 0x26, 0x20, 0xc9, 0xff, 0x70, 0x31, 0xf0, 0x8c,
+  0x5d, 0x84, 0x61, 0x91, 0xdd, 0x14, 0xa3, 0x58, 0xb8, 0x16, 0x36, 0x87,
+  0xaf, 0xaf, 0xc2, 0x5b, 0x26, 0x10, 0x43, 0x7d, 0xf7, 0xb7, 0x28, 0xda,
+  0x9c, 0x4c, 0xd7, 0xe9, 0xe9, 0x94, 0x0e, 0xf3, 0x48, 0xbd, 0x18, 0x32,
+  0xf1, 0x24, 0x5c, 0xb2, 0x68, 0x7e, 0xc6, 0x39, 0x3d, 0x68, 0x73, 0x3e,
+  0x59, 0x30, 0xda, 0xde, 0xb9, 0x1e, 0xa1, 0x9c, 0xcb, 0x2b, 0xaa, 0x0d,
+  0xaa, 0xa2, 0xc4, 0x50, 0xef, 0x50, 0x5c, 0x6d, 0xb4, 0x67, 0x16, 0xce,
+  0xbc, 0xb2, 0xdd, 0xa9, 0x8e, 0x25, 0x60, 0x51, 0x3b, 0xf7, 0xcf, 0xa4,
+  0x33, 0xe9, 0x5d, 0x80, 0x65, 0x68, 0x1f, 0x1f, 0xc4, 0xb2, 0xa0, 0xd5,
+  0x29, 0xb7, 0x3e, 0xdd, 0x0e, 0x92, 0x81, 0x42, 0xbb, 0x4b, 0x23, 0xff,
+  0x5e, 0x4a, 0x46, 0x24, 0x85, 0x37, 0x8a, 0xdb, 0xba, 0x87, 0x89, 0xf9,
+  0x76, 0x8b, 0x5e, 0xf6, 0x6d, 0xf0, 0xc5, 0xdd, 0xdd, 0x36, 0x68, 0x75,
+  0x19, 0x2f, 0x88, 0xcb, 0x0f, 0x4e, 0xd6, 0xf4, 0x0f, 0x4e, 0xcc, 0x72,
+  0x61, 0xf8, 0x93, 0x1d, 0xfa, 0xa7, 0x81, 0x76, 0x37, 0xb6, 0x78, 0x41,
+  0x0e, 0x26, 0x02, 0x8a, 0x8d, 0x62, 0xab, 0x48, 0x7e, 0x89, 0x56, 0x5b,
+  0xcb, 0xef, 0xab, 0xa3, 0xf0, 0xa9, 0xd3, 0x0f, 0xa7, 0x16, 0x92, 0x84,
+  0x6c, 0xdb, 0x01, 0x28, 0x8b, 0x62, 0x9a, 0x92, 0xe2, 0x94, 0xaf, 0x98,
+  0x13, 0xf3, 0x03, 0xae, 0x90, 0x36, 0x8e, 0x91, 0x4a, 0xb6, 0x14, 0x73,
+  0xf0, 0xb2, 0xbb, 0xc4, 0x52, 0xcb, 0xea, 0xc3, 0x18, 0x11, 0xd0, 0x92,
+  0x92, 0x9d, 0x4a, 0x53, 0x7a, 0xbc, 0x42, 0x53, 0x5a, 0x91, 0x23, 0x19,
+  0x49, 0x5b, 0x4c, 0x88, 0xa2, 0xcb, 0x28, 0xcf, 0xa4, 0xcc, 0x10, 0xc5,
+  0xa7, 0x6e, 0xcf, 0x97, 0xf4, 0x63, 0x82, 0x63, 0x9a, 0xfd, 0xca, 0xef,
+  0x62, 0xf1, 0x4f, 0xc0, 0x42, 0x53, 0x2d, 0xad, 0xfe, 0xeb, 0x4a, 0xfd,
+  0x47, 0x47, 0xa5, 0x47, 0xb7, 0x99, 0xa4, 0xe6, 0x94, 0x94, 0xf8, 0xd0,
+  0x1c, 0x88, 0xf1, 0xe0, 0xe0, 0xda, 0xa2, 0xb5, 0x86, 0x14, 0x54, 0x22,
+  0xd9, 0x12, 0x62, 0xe3, 0x19, 0x7f, 0x89, 0x89, 0x4a, 0x0f, 0xd0, 0x35,
+  0x04, 0x3a, 0xbe, 0xbe, 0xdd, 0x28, 0xb4, 0xcb, 0xea, 0x2f, 0x87, 0x86,
+  0x7b, 0x33, 0x75, 0x58, 0x3f, 0xda, 0x5a, 0xc2, 0x1c, 0x14, 0x57, 0x2f,
+  0x25, 0x9c, 0x1d, 0x62, 0xf9, 0x87, 0xe5, 0x6e, 0xfd, 0x5b, 0xaa, 0x63,
+  0x25, 0x3b, 0x5d, 0x5e, 0x33, 0x74, 0x57, 0x34, 0xa1, 0xde, 0x77, 0x77,
+  0xa2, 0xa7, 0xa7, 0x29, 0xe2, 0xbe, 0x7e, 0x6d, 0x4a, 0x82, 0x77, 0x06,
+  0xec, 0x87, 0x6f, 0x33, 0x11, 0x37, 0xfb, 0x53, 0xf1, 0xf1, 0xfd, 0xa4,
+  0xf2, 0xfe, 0x84, 0xca, 0xb3, 0x58, 0x7e, 0xbe, 0xa2, 0x52, 0xcc, 0x75,
+  0xd2, 0x4d, 0xf6, 0xe4, 0xd8, 0x68, 0x6e, 0xa7, 0x95, 0xca, 0x5b, 0x63,
+  0xda, 0x0a, 0x20, 0x14, 0xde, 0x87, 0xfb, 0xf6, 0x10, 0x49, 0xb9, 0xe2,
+  0xf7, 0xb3, 0x12, 0xea, 0x08, 0x11, 0xb3, 0xfc, 0x47, 0x28, 0x2d, 0x1e,
+  0x17, 0x03, 0x03, 0x2d, 0x59, 0x75, 0x36, 0x36, 0xa1, 0x04, 0x55, 0xfe,
+  0x6e, 0x6e, 0xbb, 0xbb, 0xb6, 0x42, 0x8a, 0x1e, 0x3d, 0x3f, 0xca, 0xec,
+  0xd6, 0x42, 0x74, 0xdd, 0x8c, 0x17, 0x88, 0x40, 0x14, 0x07, 0xaf, 0xaf,
+  0x8a, 0x9b, 0xf7, 0x35, 0x0c, 0xcd, 0xe7, 0xb9, 0x6e, 0x5e, 0x0a, 0xbb,
+  0x58, 0xcc, 0x72, 0x99, 0x99, 0x77, 0xe2, 0x39, 0x31, 0x47, 0xc0, 0x64,
+  0x4e, 0x61, 0x3a, 0x00, 0xa3, 0xcf, 0x64, 0x1d, 0x83, 0xc3, 0xdc, 0x60,
+  0xb8, 0xea, 0x3d, 0x8f, 0x66, 0xf5, 0x3d, 0x83, 0xdd, 0x88, 0x58, 0x17,
+  0x4e, 0x20, 0xf5, 0xd6, 0x04, 0x0e, 0x3f, 0x74, 0x38, 0xed, 0x90, 0xb6,
+  0x2f, 0x11, 0xa0, 0xa0, 0x5d, 0xa5, 0xe5, 0xf4, 0x7f, 0xbe, 0x56, 0x76,
+  0x1a, 0x92, 0xe3, 0xd2, 0x80, 0x69, 0xc1, 0x6e, 0x7b, 0x43, 0xf9, 0xc3,
+  0x19, 0x92, 0x6d, 0xa2, 0xc0, 0x8e, 0xa9, 0x6e, 0x8d, 0xb6, 0xbd, 0x52,
+  0x56, 0xdd, 0x72, 0x35, 0x9d, 0xf8, 0x1b, 0xb2, 0x16, 0x76, 0xd3, 0x84,
+  0x8f, 0xf3, 0x61, 0xa3, 0x5e, 0xd3, 0x56, 0xb1, 0xde, 0x33, 0xee, 0xe1,
+  0xda, 0x61, 0x2d, 0x31, 0x6a, 0x21, 0xb8, 0x72, 0x18, 0x3b, 0x05, 0xa5,
+  0xb4, 0x2f, 0xb3, 0x5b, 0x45, 0x4f, 0xfc, 0x43, 0x01, 0xe0, 0x7e, 0x3c,
+  0xe4, 0x0d, 0xd0, 0xba, 0x47, 0x77, 0x00, 0xfe, 0x33, 0x5f, 0xed, 0xf2,
+  0x19, 0xbf, 0x11, 0x30, 0xc3, 0x7e, 0x4a, 0x42, 0x9b, 0x0f, 0x61, 0x57,
+  0xaf, 0x04, 0xde, 0x7d, 0x0f, 0xc0, 0xb6, 0x10, 0x01, 0x7b, 0xae, 0xf7,
+  0xd3, 0xde, 0x19, 0x11, 0x07, 0x12, 0x02, 0xfe, 0xa6, 0x21, 0x8b, 0xdc,
+  0xa4, 0x37, 0x72, 0x74, 0xe9, 0xf4, 0xd1, 0x7f, 0x17, 0x17, 0xbb, 0xf9,
+  0x09, 0x14, 0x9c, 0x3b, 0x4c, 0x14, 0xe2, 0x3d, 0xca, 0x3a, 0x4c, 0x4c,
+  0x5a, 0xf0, 0x7a, 0xd6, 0xd3, 0x74, 0x74, 0x08, 0x3c, 0xbc, 0xa2, 0xca,
+  0x2b, 0x8b, 0xd5, 0x3f, 0x37, 0x82, 0x0b, 0x38, 0xce, 0x79, 0x1b, 0xd5,
+  0x71, 0xaf, 0x57, 0x53, 0x70, 0xfa, 0x4d, 0x1a, 0xc2, 0x61, 0x8a, 0xeb,
+  0x69, 0xe3, 0xf8, 0x2c, 0x72, 0x34, 0x99, 0xa8, 0x48, 0xbf, 0x56, 0x4b,
+  0xe5, 0x8c, 0xca, 0xb0, 0x79, 0xf8, 0x33, 0xfe, 0x2c, 0xfd, 0x5f, 0xa6,
+  0xb2, 0x87, 0x17, 0x70, 0x42, 0xb7, 0x20, 0x8d, 0x5f, 0xc3, 0x16, 0x03,
+  0xa3, 0xc1, 0x9a, 0x51, 0xa0, 0x5b, 0x0c, 0xb3, 0x13, 0x62, 0x81, 0xc5,
+  0x83, 0x47, 0x49, 0xac, 0x72, 0x4b, 0xc1, 0x77, 0x7c, 0x3a, 0x1c, 0x04,
+  0x45, 0x32, 0xcf, 0x3f, 0x57, 0xdf, 0x7f, 0x0f, 0x38, 0xc9, 0xcc, 0x0e,
+  0x36, 0x60, 0xca, 0x2a, 0xf8, 0x0d, 0xd9, 0xaa, 0x12, 0x34, 0xac, 0x0b,
+  0x97, 0xf9, 0x41, 0x47, 0x66, 0x21, 0x5a, 0x60, 0x17, 0xfa, 0xec, 0xb8,
+  0x34, 0x8a, 0xc3, 0xba, 0x1c, 0xef, 0xf7, 0x8c, 0x4e, 0xf5, 0xe2, 0xc8,
+  0xb6, 0xf3, 0x40, 0x29, 0xa4, 0x25, 0x59, 0xda, 0xea, 0x8e, 0x98, 0x2e,
+  0x38, 0x04, 0x6b, 0xb2, 0x1e, 0xb5, 0xa5, 0xa5, 0x20, 0x4f, 0x5b, 0x3d,
+  0xc2, 0x49, 0x89, 0xca, 0xd1, 0xb8, 0xd7, 0x71, 0xa8, 0xe4, 0xb4, 0x9e,
+  0x0e, 0x1a, 0xd5, 0x4b, 0xe6, 0x44, 0x31, 0xa4, 0x0f, 0x21, 0xbc, 0xcc,
+  0x3d, 0xc6, 0x32, 0xad, 0xb2, 0x47, 0x6e, 0x95, 0x59, 0xfa, 0x0a, 0x05,
+  0x2d, 0x0d, 0xa2, 0x92, 0xce, 0xca, 0xe8, 0x11, 0x73, 0x74, 0x99, 0x36,
+  0x5e, 0x9a, 0x31, 0x68, 0x86, 0xd3, 0xe4, 0x8c, 0xc6, 0x26, 0x3c, 0x61,
+  0x38, 0x37, 0xb9, 0x02, 0x23, 0x17, 0x87, 0xde, 0x4c, 0xdf, 0xf1, 0x98,
+  0x8b, 0x74, 0xb7, 0xba, 0x4c, 0x08, 0x1b, 0x38, 0x8c, 0x4b, 0x74, 0x9a,
+  0x9b, 0xa2, 0x09, 0x2a, 0xa6, 0x77, 0xea, 0x42, 0xb6, 0xd6, 0x14, 0x96,
+  0x34, 0x1e, 0xa8, 0xcf, 0xb0, 0xbd, 0x61, 0x52, 0x7b, 0x90, 0xc2, 0x29,
+  0x4c, 0xb3, 0x07, 0xac, 0x40, 0x6d, 0xe8, 0xae, 0x89, 0xf4, 0xdd, 0x34,
+  0xeb, 0x52, 0x44, 0xd1, 0x0b, 0x87, 0x0b, 0x86, 0x8a, 0xdd, 0xb9, 0x02,
+  0xe8, 0xc4, 0xaa, 0xe3, 0xba, 0x80, 0x3c, 0x36, 0x2b, 0x31, 0x5f, 0xc5,
+  0x28, 0xb3, 0xf0, 0x1d, 0x8f, 0xa8, 0x54, 0xa6, 0xda, 0xff, 0xcc, 0x2a,
+  0xa7, 0x6f, 0xe8, 0x97, 0x4a, 0xee, 0x7a, 0x48, 0x2e, 0x1b, 0xd2, 0xea,
+  0x25, 0x5b, 0xc1, 0xfc, 0x5b, 0x8a, 0x41, 0x80, 0x73, 0xa7, 0x04, 0x2f,
+  0x95, 0x47, 0xc2, 0xb3, 0x45, 0x4f, 0xb3, 0x5b, 0xf1, 0xc8, 0x5e, 0xe4,
+  0xa5, 0x05, 0x6c, 0x76, 0x79, 0xb7, 0x10, 0x8a, 0x72, 0x34, 0x93, 0xdc,
+  0x0d, 0x33, 0xf3, 0x69, 0x8a, 0x76, 0xbb, 0x90, 0x20, 0xd3, 0x07, 0x05,
+  0x3a, 0x3a, 0x81, 0x65, 0xac, 0x3a, 0xab, 0x48, 0x64, 0xed, 0x3c, 0x3f,
+  0xba, 0x68, 0xd5, 0x58, 0x7b, 0xb2, 0xb7, 0xcc, 0xe0, 0xcc, 0xaf, 0x3c,
+  0x97, 0x90, 0x50, 0xf5, 0x45, 0x28, 0x38, 0x9a, 0xb0, 0x11, 0xee, 0xc9,
+  0x94, 0x99, 0x85, 0x8d, 0xb5, 0x0f, 0xd0, 0x48, 0xac, 0xf1, 0x7e, 0x5a,
+  0x04, 0x0f, 0x1e, 0x72, 0x70, 0xe6, 0xe1, 0x31, 0x26, 0x9c, 0xdc, 0x07,
+  0xa2, 0xe1, 0xc5, 0xc1, 0x8a, 0x4d, 0xc3, 0x41, 0xc0, 0xf8, 0xde, 0xcc,
+  0x0b, 0x99, 0xaa, 0xe3, 0xe3, 0x5c, 0xa0, 0x2c, 0x34, 0xff, 0xb2, 0xfc,
+  0x34, 0xba, 0x6a, 0x99, 0x2e, 0x83, 0xd5, 0xf7, 0x08, 0x08, 0x85, 0x5f,
+  0x4c, 0x5e, 0xf1, 0xd8, 0x72, 0x53, 0xb6, 0x49, 0x50, 0x9f, 0xb9, 0xa5,
+  0x5d, 0xe8, 0x9f, 0xe7, 0x9a, 0xbf, 0x5f, 0x60, 0x7f, 0x18, 0x77, 0xaa,
+  0xb3, 0xde, 0x24, 0xd0, 0x89, 0x5f, 0x3a, 0x39, 0x36, 0x0a, 0x04, 0xad,
+  0x62, 0x64, 0x1a, 0x12, 0x55, 0xf0, 0xb5, 0x31, 0x0a, 0x0a, 0x18, 0xce,
+  0x6a, 0xd0, 0x10, 0x6e, 0x78, 0x0e, 0x9e, 0x08, 0x7a, 0xe0, 0x19, 0x92,
+  0x17, 0x78, 0xfe, 0x98, 0x07, 0x15, 0x18, 0x8f, 0x1a, 0xb4, 0x84, 0x3a,
+  0x09, 0xfc, 0x43, 0x37, 0x99, 0xab, 0xdd, 0x7f, 0x47, 0xb3, 0x9b, 0x6f,
+  0x5b, 0xc8, 0xc6, 0x41, 0xec, 0xff, 0xd3, 0xea, 0xba, 0xa5, 0xb4, 0x92,
+  0xac, 0xce, 0xb3, 0xd8, 0x55, 0x4d, 0xaa, 0x3f, 0xde, 0xc8, 0x7d, 0xd7,
+  0x12, 0xaa, 0xee, 0x10, 0x1e, 0x22, 0x64, 0x0b, 0x53, 0x95, 0x04, 0x20,
+  0x11, 0x26, 0x59, 0x91, 0xf5, 0x69, 0x69, 0x53, 0x99, 0x2c, 0x08, 0x2e,
+  0x8d, 0x8d, 0x87, 0xcb, 0xcb, 0xe3, 0xfe, 0xfe, 0xb0, 0x2f, 0x55, 0xd3,
+  0xaf, 0x0e, 0xe1, 0xe1, 0x5b, 0xe9, 0x92, 0x02, 0x93, 0x07, 0xc6, 0xc4,
+  0x92, 0x9a, 0xd7, 0x8e, 0xf7, 0xfd, 0x8f, 0x89, 0xff, 0x72, 0x76, 0xc6,
+  0xb4, 0x44, 0xe4, 0xe3, 0xc3, 0xc7, 0xc3, 0x28, 0xed, 0xe4, 0xfa, 0x66,
+  0x7d, 0x6a, 0x64, 0xff, 0x5b, 0x7a, 0x38, 0x3a, 0x4d, 0x55, 0xf3, 0x30,
+  0x3c, 0x3b, 0xce, 0x96, 0x48, 0xd7, 0xbf, 0x54, 0xf8, 0xb8, 0x75, 0x2b,
+  0xde, 0x5d, 0x5b, 0xd1, 0x6e, 0xfb, 0x95, 0x1d, 0xe6, 0x63, 0x63, 0xe1,
+  0x9f, 0x7e, 0x08, 0x2e, 0x60, 0x6f, 0x07, 0x83, 0x7a, 0xb1, 0x15, 0x56,
+  0x63, 0x88, 0x20, 0x21, 0x54, 0x17, 0x62, 0x6c, 0xc4, 0xfe, 0x6a, 0x9e,
+  0x23, 0xd8, 0xdf, 0x77, 0x8d, 0xe1, 0xab, 0x1f, 0x38, 0xb9, 0xca, 0x9d,
+  0xb6, 0xd5, 0xda, 0xbf, 0x8d, 0x43, 0x06, 0xf0, 0x54, 0xf9, 0xc2, 0x1a,
+  0xb0, 0xf5, 0xbd, 0x98, 0x34, 0x4a, 0x41, 0x8e, 0x8b, 0x01, 0xa5, 0xd4,
+  0xd9, 0x9f, 0x4f, 0x74, 0xb4, 0x91, 0xb6, 0xfa, 0x4d, 0xb8, 0x2d, 0x3e,
+  0x86, 0x07, 0xc8, 0x5f, 0x9e, 0x78, 0x11, 0x26, 0xe2, 0x1c, 0xea, 0x6f,
+  0xdb, 0xb4, 0xf5, 0x0a, 0xaf, 0x0a, 0x51, 0xe9, 0xff, 0x30, 0xa1, 0xd4,
+  0xef, 0x9f, 0xb0, 0x0e, 0xd8, 0xb9, 0xf8, 0x3d, 0x20, 0xa1, 0xb8, 0x74,
+  0x5b, 0x24, 0xc8, 0x13, 0xc8, 0x7e, 0x3c, 0x5e, 0x0f, 0x22, 0x1e, 0xd3,
+  0x4d, 0x00, 0x50, 0x08, 0x40, 0x43, 0xa7, 0xcc, 0x1e, 0x24, 0x88, 0xc2,
+  0x86, 0x11, 0x54, 0x5b, 0x77, 0x0c, 0x8a, 0xcd, 0xde, 0x4a, 0xc9, 0x1e,
+  0x8a, 0x28, 0x59, 0x53, 0xd2, 0x09, 0xfe, 0xf4, 0x0c, 0x38, 0xad, 0x1e,
+  0xd0, 0x0b, 0x0b, 0x37, 0x6a, 0xa4, 0x83, 0x6e, 0xc4, 0xad, 0x9c, 0x7c,
+  0x89, 0x9d, 0x9f, 0x64, 0xc0, 0x0a, 0xeb, 0xdf, 0x0b, 0x88, 0xad, 0xc2,
+  0x7a, 0x2b, 0xf8, 0x36, 0xe1, 0x1a, 0xd6, 0xf7, 0x47, 0xa9, 0xa7, 0x03,
+  0x7b, 0xda, 0xa3, 0x63, 0x2b, 0x84, 0x69, 0x8e, 0x0d, 0x51, 0x3b, 0xdc,
+  0x0f, 0x14, 0x01, 0x20, 0xc7, 0x0d, 0xca, 0xa3, 0x8e, 0xdf, 0xf2, 0xd0,
+  0x57, 0xfc, 0xa2, 0xa2, 0xa2, 0xe7, 0x24, 0x1c, 0x17, 0x3d, 0xb1, 0x2d,
+  0x4e, 0xde, 0x75, 0x9b, 0x92, 0x8a, 0x76, 0x76, 0x68, 0x1e, 0xa5, 0xbe,
+  0x45, 0x71, 0xdb, 0xfd, 0xad, 0x9a, 0x9c, 0x8e, 0x69, 0xd3, 0x5d, 0x14,
+  0x11, 0x4a, 0x92, 0xad, 0x7d, 0x14, 0xb0, 0xef, 0x4b, 0x2e, 0x17, 0x7f,
+  0x92, 0xac, 0x5b, 0xdf, 0xe4, 0xb7, 0x07, 0xd3, 0x47, 0x95, 0x63, 0xaa,
+  0x4f, 0x5f, 0x72, 0x51, 0x2c, 0xb9, 0xa9, 0x02, 0xff, 0x0e, 0x75, 0x43,
+  0x47, 0xde, 0x84, 0xb5, 0x4d, 0xf2, 0x5c, 0xac, 0x0d, 0xa8, 0x01, 0xc8,
+  0xe0, 0x38, 0x72, 0x90, 0xd4, 0x65, 0x60, 0xc7, 0x15, 0x06, 0x44, 0xad,
+  0x51, 0x47, 0x35, 0xfc, 0x22, 0xc7, 0x18, 0x8b, 0xbf, 0xb9, 0x85, 0xe3,
+  0x65, 0x91, 0x0b, 0x91, 0xcb, 0x44, 0xa4, 0x96, 0x2f, 0x90, 0xd2, 0x1e,
+  0x51, 0xbe, 0x9b, 0x30, 0x5c, 0x65, 0xf4, 0x3e, 0x3c, 0xf6, 0x42, 0xdf,
+  0x90, 0x75, 0xf9, 0xf5, 0xf8, 0x33, 0x33, 0x85, 0x14, 0x14, 0x78, 0xec,
+  0x05, 0x2f, 0x9e, 0x4e, 0x86, 0x0a, 0xa7, 0xda, 0x32, 0x81, 0x81, 0x90,
+  0x4a, 0x88, 0x88, 0x2f, 0xa5, 0xcb, 0x95, 0x41, 0x49, 0x49, 0x6c, 0x1a,
+  0xb6, 0xb6, 0xf6, 0xf6, 0x94, 0xd5, 0x99, 0x0f, 0x80, 0x80, 0x4e, 0x45,
+  0x41, 0x2b, 0xe5, 0x40, 0xfd, 0x02, 0xf1, 0xf6, 0x1e, 0x89, 0x01, 0x5b,
+  0xec, 0xe3, 0x68, 0x23, 0xea, 0x7d, 0x02, 0xe9, 0x49, 0xc4, 0x11, 0x3a,
+  0x33, 0x6c, 0x98, 0x61, 0xf9, 0x42, 0xca, 0x36, 0x7c, 0x66, 0x22, 0xe1,
+  0x55, 0x21, 0x29, 0x4c, 0x96, 0xad, 0x1b, 0x2d, 0xdd, 0x8a, 0x69, 0xb3,
+  0x39, 0x68, 0x6c, 0x1f, 0x2c, 0x49, 0xee, 0xd9, 0x6c, 0xb7, 0xaf, 0xc5,
+  0xf6, 0x41, 0xcf, 0xc0, 0xf5, 0x9a, 0xef, 0x5e, 0x55, 0xc3, 0xb2, 0x21,
+  0x21, 0x24, 0xf2, 0x17, 0xf9, 0xf7, 0xf7, 0xca, 0x28, 0x65, 0xc4, 0xdd,
+  0xeb, 0x88, 0x15, 0x59, 0x93, 0xeb, 0xb1, 0xd5, 0x97, 0x74, 0x7a, 0xb5,
+  0x14, 0x29, 0xad, 0x42, 0x8e, 0x10, 0x36, 0xa7, 0xa5, 0x89, 0xe0, 0xab,
+  0x57, 0x0d, 0xa4, 0x8c, 0x23, 0x72, 0x07, 0x83, 0x84, 0x3e, 0x7f, 0xb1,
+  0xab, 0xd4, 0x28, 0xc7, 0x25, 0x07, 0x7e, 0x76, 0xbf, 0xeb, 0x22, 0xca,
+  0xd2, 0xa8, 0x83, 0xcd, 0x27, 0xf6, 0xaa, 0x7b, 0x33, 0x80, 0x13, 0x2d,
+  0xbb, 0xd3, 0xee, 0x76, 0xd5, 0xe6, 0x7d, 0x84, 0x10, 0x2c, 0x40, 0xeb,
+  0xb0, 0x45, 0x33, 0x64, 0x73, 0x68, 0xb6, 0x51, 0x3b, 0x82, 0x9b, 0x6b,
+  0xbd, 0x5f, 0x76, 0xac, 0x43, 0x82, 0x16, 0x31, 0x43, 0x48, 0xd4, 0x04,
+  0xcd, 0x17, 0xce, 0x30, 0x2f, 0x50, 0x37, 0xb5, 0x3d, 0x60, 0xf7, 0x0b,
+  0xed, 0x75, 0xfc, 0x4c, 0xf8, 0x39, 0x11, 0xeb, 0xd0, 0x80, 0x40, 0x9e,
+  0xaf, 0x62, 0xcd, 0xce, 0x9c, 0x46, 0x45, 0x48, 0xc4, 0xb0, 0x5d, 0x8d,
+  0xa6, 0x7d, 0xf4, 0xc6, 0xa0, 0x3a, 0x01, 0x4a, 0x92, 0xc0, 0xe6, 0x27,
+  0x8a, 0xb4, 0xc3, 0xa4, 0x39, 0xbd, 0x99, 0x02, 0xdf, 0xd3, 0xaa, 0x69,
+  0x1d, 0x4d, 0x29, 0xd8, 0xca, 0xcf, 0x50, 0xf6, 0x78, 0x71, 0x7b, 0x9a,
+  0xa0, 0x64, 0x89, 0xb4, 0x56, 0xea, 0xf2, 0xed, 0xee, 0x86, 0x14, 0x56,
+  0xf4, 0xeb, 0x0a, 0x5f, 0xe6, 0x10, 0x6a, 0x3f, 0x60, 0x83, 0x69, 0x1a,
+  0xe0, 0x44, 0x71, 0x0c, 0x83, 0x22, 0xcc, 0x2c, 0x1c, 0x09, 0x0b, 0x9a,
+  0x77, 0x87, 0x4a, 0xa1, 0x46, 0x29, 0xbf, 0x65, 0x44, 0x67, 0xfb, 0x38,
+  0x83, 0x98, 0x9f, 0x25, 0x3f, 0x6c, 0x8a, 0x7d, 0x1f, 0xee, 0x02, 0xd3,
+  0x16, 0xc4, 0x4e, 0x24, 0x6c, 0x8f, 0x4f, 0xe7, 0xe8, 0x85, 0x20, 0x8c,
+  0x20, 0x90, 0x19, 0xdf, 0x9d, 0x50, 0x01, 0x4a, 0xc3, 0x1d, 0x5e, 0x22,
+  0x8d, 0x06, 0xc4, 0x0d, 0x21, 0xdf, 0x46, 0x0e, 0x4d, 0xcf, 0xa4, 0xea,
+  0xcf, 0x1b, 0x62, 0xdc, 0x7a, 0xfc, 0x32, 0xc5, 0x54, 0xfa, 0xad, 0x03,
+  0xf4, 0x33, 0xad, 0x6d, 0x39, 0x65, 0x2e, 0x5e, 0xcc, 0xdd, 0x6c, 0x3c,
+  0xbb, 0x0e, 0xaa, 0x5f, 0xa4, 0x53, 0x1b, 0xbb, 0x2a, 0x1c, 0xce, 0x0c,
+  0x10, 0x76, 0x47, 0x39, 0x93, 0xee, 0x25, 0xd1, 0xdd, 0xb7, 0xcc, 0x55,
+  0x65, 0xf1, 0x82, 0x38, 0xd6, 0xc8, 0x3e, 0x1c, 0xb5, 0xa1, 0xe3, 0x07,
+  0x55, 0xb3, 0xfb, 0x7c, 0x7d, 0x0b, 0xa0, 0xd4, 0xf1, 0x70, 0xfa, 0xf2,
+  0x1a, 0x53, 0x56, 0xcc, 0xa8, 0x87, 0x50, 0x08, 0x6c, 0xab, 0xab, 0xc6,
+  0x9b, 0x11, 0xe4, 0x35, 0x65, 0x35, 0x72, 0x3d, 0x9e, 0x7c, 0x7a, 0x62,
+  0x86, 0xca, 0xc6, 0x57, 0x30, 0xf8, 0x06, 0x1b, 0xf7, 0x36, 0xf0, 0x53,
+  0x29, 0xa7, 0x6d, 0xba, 0x08, 0x5d, 0x0c, 0xf3, 0x5b, 0xb6, 0x6f, 0x0d,
+  0xe7, 0xcb, 0xd2, 0x1a, 0x80, 0x9d, 0x1b, 0x79, 0x67, 0xb2, 0xaf, 0x74,
+  0xd6, 0xc9, 0x6c, 0xaa, 0xc8, 0x33, 0xda, 0xe5, 0x82, 0x08, 0xd2, 0x9c,
+  0x3f, 0x9c, 0x33, 0xd2, 0x0e, 0x75, 0x95, 0x1d, 0xf4, 0xb4, 0x9d, 0xdc,
+  0xc9, 0x7e, 0xbc, 0x5c, 0xa7, 0x81, 0xc3, 0x8b, 0xca, 0xf3, 0x64, 0xf0,
+  0x2d, 0x67, 0xa0, 0x5b, 0x5b, 0x9d, 0x80, 0x41, 0x91, 0x29, 0xaf, 0x80,
+  0x91, 0xb5, 0xfc, 0x95, 0x4d, 0x8d, 0x58, 0x8a, 0x22, 0x7d, 0x06, 0x06,
+  0xc2, 0xe6, 0x29, 0xe6, 0x0a, 0xde, 0xb0, 0x05, 0xb4, 0x6b, 0x81, 0xb6,
+  0x2d, 0x2a, 0x4f, 0xa1, 0x7b, 0x2a, 0x4c, 0xa8, 0x52, 0xf9, 0x2f, 0x56,
+  0x18, 0xa8, 0xbb, 0x0e, 0xa7, 0xfd, 0x3d, 0x27, 0xb7, 0x60, 0x18, 0x32,
+  0xa5, 0x79, 0xb9, 0xcc, 0x05, 0x2c, 0x29, 0x9c, 0xae, 0x45, 0xd0, 0x54,
+  0xdd, 0x96, 0x79, 0xfb, 0x4f, 0x84, 0x66, 0xb3, 0x52, 0x4f, 0xca, 0x76,
+  0x8a, 0x5a, 0xc3, 0xae, 0xf5, 0x29, 0x44, 0x5b, 0x2e, 0x40, 0xc1, 0xef,
+  0xc9, 0x6b, 0xb0, 0x37, 0x3b, 0x37, 0x90, 0x9e, 0x9c, 0x5b, 0x32, 0xc5,
+  0xdd, 0x0e, 0x6a, 0x7e, 0x6b, 0xcd, 0xb9, 0xfa, 0xae, 0xe4, 0x14, 0xd4,
+  0xbd, 0x2a, 0x1e, 0x2c, 0x64, 0xb6, 0x25, 0x1f, 0xd4, 0x41, 0x1e, 0x1c,
+  0xf6, 0x6c, 0x62, 0x67, 0xeb, 0x37, 0x87, 0x0d, 0xfe, 0x94, 0x77, 0x7a,
+  0xd6, 0x28, 0x44, 0xb9, 0xf0, 0x6f, 0x1d, 0xd1, 0x2b, 0x6a, 0x50, 0x48,
+  0x24, 0x7e, 0x1a, 0xa0, 0xce, 0x9b, 0x2b, 0x4d, 0x24, 0x06, 0xb8, 0xda,
+  0xd6, 0x88, 0x36, 0xa2, 0xc6, 0x7c, 0x64, 0x7f, 0x3a, 0xd4, 0x81, 0xaf,
+  0x6c, 0xf7, 0x08, 0x48, 0xc5, 0x9f, 0xc6, 0xd6, 0x15, 0xf3, 0x77, 0xff,
+  0xcb, 0x24, 0x30, 0x05, 0xf6, 0xd0, 0xe7, 0x4b, 0x7c, 0x8d, 0x7c, 0xeb,
+  0xd0, 0x2a, 0x40, 0xaa, 0x1f, 0x7d, 0x0d, 0x8d, 0xc8, 0xd3, 0x0b, 0xcd,
+  0xb7, 0x3d, 0xc2, 0xb3, 0xd9, 0x11, 0x3d, 0x46, 0xa1, 0xc1, 0x73, 0xcb,
+  0xa0, 0xb2, 0xfc, 0xe4, 0x55, 0xfc, 0x5d, 0xa2, 0x68, 0x0b, 0xe3, 0x54,
+  0x74, 0x7f, 0x97, 0xb1, 0x74, 0xf5, 0x65, 0xc6, 0xbf, 0x4f, 0x33, 0xa3,
+  0x12, 0xb1, 0x0b, 0xe5, 0x8e, 0x12, 0xa7, 0xd3, 0x7a, 0xd8, 0xbc, 0xb7,
+  0x60, 0x6a, 0x7c, 0xae, 0x8f, 0x27, 0xf5, 0x67, 0x61, 0x2f, 0x49, 0xa7,
+  0xe6, 0x9d, 0xe4, 0xee, 0x6b, 0x73, 0xa0, 0xd5, 0x55, 0x55, 0xd6, 0x67,
+  0x2e, 0x5d, 0x00, 0x4c, 0xf0, 0xc6, 0x17, 0x06, 0xe5, 0x35, 0xa0, 0x66,
+  0xb8, 0xf9, 0x0b, 0x9f, 0xb8, 0x5f, 0xe9, 0x40, 0x99, 0xfa, 0x3c, 0xb5,
+  0x7f, 0xaf, 0xdf, 0x65, 0x07, 0x85, 0xfc, 0x8f, 0x7b, 0x27, 0x45, 0xf2,
+  0x0d, 0x3b, 0x96, 0xb1, 0xd6, 0x51, 0x38, 0xc3, 0xf4, 0x28, 0x67, 0x7c,
+  0x21, 0xfe, 0x28, 0x10, 0x21, 0xe6, 0x72, 0x68, 0xcd, 0x2c, 0xfd, 0x74,
+  0x6c, 0xbd, 0xc8, 0xd0, 0xdc, 0x21, 0x35, 0x50, 0x9b, 0x75, 0xca, 0xa0,
+  0x9c, 0x21, 0x98, 0x23, 0xda, 0x2e, 0x0b, 0xf1, 0x60, 0xc7, 0xba, 0x1d,
+  0x68, 0x4a, 0xfa, 0xfe, 0x7b, 0x24, 0x0c, 0x96, 0x04, 0xf6, 0xea, 0x23,
+  0x2e, 0x72, 0x92, 0x7c, 0x0d, 0xbb, 0xed, 0x41, 0x4c, 0x32, 0x36, 0x1d,
+  0x5d, 0x16, 0xf2, 0x58, 0xf0, 0x8c, 0x3c, 0xc9, 0x36, 0xad, 0xe6, 0xab,
+  0xe0, 0x96, 0x80, 0xd8, 0xb9, 0x7b, 0xe5, 0x55, 0x89, 0x66, 0x32, 0x48,
+  0xe0, 0x90, 0x5c, 0x59, 0x59, 0x59, 0x22, 0xbb, 0x8b, 0xd0, 0x23, 0x7c,
+  0x4f, 0xe4, 0x74, 0x80, 0x4b, 0x8b, 0x76, 0x21, 0x18, 0x61, 0x1e, 0x1d,
+  0x42, 0x1f, 0xaf, 0xf5, 0x9e, 0x8d, 0x0d, 0xb2, 0xcc, 0x44, 0x48, 0x51,
+  0x6e, 0x0c, 0x8b, 0xf5, 0x00, 0xe5, 0x6c, 0xc8, 0x3e, 0x0e, 0x41, 0x8d,
+  0xa8, 0x72, 0x0b, 0x5c, 0xc4, 0x46, 0xcd, 0xb8, 0x3b, 0xf5, 0xdf, 0x9e,
+  0xd6, 0xa7, 0xaa, 0xa3, 0xb2, 0x38, 0x0c, 0x04, 0xf1, 0x70, 0x17, 0x4c,
+  0x62, 0x78, 0x6d, 0x2a, 0x76, 0xf0, 0x2b, 0xde, 0xe3, 0x1c, 0xd5, 0x8b,
+  0x8b, 0x50, 0x28, 0x64, 0xfc, 0x87, 0x67, 0x78, 0xf5, 0xb9, 0xe8, 0x97,
+  0x8d, 0x74, 0xd8, 0xb5, 0x6c, 0x75, 0xc3, 0x9c, 0x97, 0x20, 0x5b, 0x90,
+  0xfa, 0x2f, 0x7f, 0x47, 0x49, 0x40, 0x97, 0xf7, 0x2a, 0x54, 0xf2, 0x30,
+  0xa1, 0x8b, 0xd1, 0xe2, 0x93, 0xb7, 0x37, 0x8b, 0x83, 0x3e, 0xda, 0x57,
+  0x12, 0x14, 0xe0, 0x7f, 0xc1, 0x67, 0xa6, 0x7b, 0xb6, 0x08, 0xfa, 0x49,
+  0xf3, 0x70, 0x8e, 0xbd, 0xa4, 0xaa, 0x4d, 0x05, 0x03, 0x1d, 0x40, 0x7c,
+  0x6a, 0x65, 0x07, 0x49, 0xec, 0x1d, 0x5a, 0x2c, 0xba, 0xc4, 0x58, 0x26,
+  0xab, 0x82, 0xb3, 0x23, 0xb8, 0x4e, 0xdd, 0x63, 0x55, 0x71, 0x3a, 0x5a,
+  0x6c, 0x1e, 0xe2, 0x55, 0x9c, 0x2e, 0x4f, 0x7d, 0xaa, 0xd3, 0x47, 0x0e,
+  0x58, 0x98, 0x2b, 0x9c, 0x46, 0x92, 0xb8, 0xbb, 0xa8, 0x81, 0x03, 0x9a,
+  0x3f, 0xfc, 0x61, 0xef, 0xec, 0xfa, 0x62, 0xd8, 0x71, 0x7e, 0x84, 0x57,
+  0x3f, 0x46, 0xd0, 0xb4, 0x3e, 0x06, 0x1b, 0xa1, 0x7d, 0x94, 0xb7, 0xe6,
+  0x91, 0x11, 0x50, 0x10, 0x69, 0x8d, 0x44, 0x4b, 0x01, 0x36, 0x02, 0xf9,
+  0x69, 0x9f, 0x4e, 0xa2, 0x91, 0x16, 0x8a, 0xfe, 0x91, 0xeb, 0x92, 0x5f,
+  0x75, 0x94, 0x35, 0x4f, 0xcc, 0xe0, 0x7c, 0x4f, 0x7f, 0xd8, 0x3c, 0x25,
+  0x56, 0x7e, 0xa5, 0x91, 0x02, 0x8a, 0xac, 0x2f, 0x2c, 0x98, 0x69, 0xa1,
+  0x70, 0x2a, 0xf3, 0xf1, 0xdc, 0xda, 0x20, 0x9a, 0x62, 0x15, 0x61, 0x91,
+  0x6d, 0x22, 0x28, 0xac, 0x51, 0xd4, 0x1f, 0x78, 0x6a, 0x07, 0x34, 0x2e,
+  0x7b, 0x6c, 0xf7, 0xf7, 0xdd, 0x49, 0x2d, 0xcf, 0x31, 0x2f, 0xbf, 0x5d,
+  0xa7, 0x42, 0xaa, 0x02, 0x86, 0x4d, 0xf4, 0xa1, 0x85, 0x15, 0x24, 0xfb,
+  0x70, 0xd9, 0x86, 0xf2, 0x16, 0xd0, 0xcb, 0x24, 0x02, 0x8a, 0xaf, 0x78,
+  0x56, 0x3d, 0xaf, 0x43, 0xdf, 0xca, 0xcd, 0x3b, 0xda, 0xe1, 0x22, 0x15,
+  0x76, 0x7a, 0xe7, 0x66, 0x91, 0xf6, 0x7e, 0xef, 0x46, 0x41, 0xbd, 0xb4,
+  0xb3, 0x4c, 0x5c, 0x90, 0xf1, 0x08, 0x14, 0x12, 0x3f, 0x08, 0x7e, 0x91,
+  0xad, 0x66, 0xa3, 0xac, 0x72, 0x37, 0x5b, 0x53, 0xec, 0xf2, 0x92, 0xf6,
+  0x92, 0xbb, 0x2b, 0x41, 0x18, 0x55, 0xbc, 0xf1, 0xee, 0x76, 0xe0, 0x23,
+  0x64, 0x0c, 0xc4, 0xde, 0xe4, 0xd7, 0xd6, 0xbe, 0xb5, 0xcc, 0x6a, 0x8e,
+  0x1e, 0x54, 0x86, 0xaf, 0x4d, 0xc4, 0xa1, 0xe2, 0xb4, 0xd3, 0x89, 0x35,
+  0x4b, 0x32, 0x05, 0x73, 0xfe, 0x14, 0x01, 0x38, 0x42, 0xd5, 0x0b, 0x56,
+  0x5f, 0xf9, 0x31, 0x00, 0x21, 0x8f, 0x2a, 0x06, 0x9b, 0x15, 0x45, 0x0f,
+  0xc9, 0xaf, 0x59, 0x19, 0xc1, 0x41, 0xed, 0x45, 0x32, 0x68, 0xa4, 0x89,
+  0x5b, 0xd7, 0xb7, 0x06, 0x2e, 0x72, 0x14, 0x62, 0xd4, 0x7f, 0x9f, 0x71,
+  0xae, 0x61, 0xaa, 0xd5, 0xb6, 0xed, 0x4e, 0xfe, 0x62, 0xe4, 0x4d, 0xf3,
+  0x84, 0x51, 0x98, 0x0a, 0xd7, 0xe2, 0x93, 0x68, 0x7f, 0x2d, 0x36, 0xe5,
+  0x9a, 0x96, 0xd5, 0xcf, 0x8f, 0xd3, 0x43, 0x1e, 0xa8, 0xda, 0xb4, 0xab,
+  0x46, 0x38, 0xfd, 0x35, 0xb5, 0x0a, 0x3c, 0x7c, 0xaa, 0xa2, 0xd8, 0xcc,
+  0x4d, 0x5b, 0x84, 0x26, 0x9b, 0xb4, 0x0b, 0x3b, 0xe4, 0xae, 0x9f, 0xbb,
+  0xea, 0xd0, 0x20, 0x84, 0x30, 0x66, 0x86, 0xe7, 0x50, 0xfa, 0x3b, 0x12,
+  0x92, 0x24, 0x2f, 0x20, 0x88, 0xb5, 0x36, 0xd9, 0x37, 0xc3, 0x2b, 0x55,
+  0xfa, 0xda, 0xbc, 0xbb, 0xe5, 0x63, 0x71, 0x82, 0x9f, 0x4a, 0xe7, 0xa7,
+  0xdc, 0x6d, 0xa4, 0x93, 0x78, 0x8c, 0x25, 0xe1, 0x78, 0x3c, 0x19, 0x54,
+  0xd1, 0x74, 0x8d, 0xd8, 0xe3, 0xde, 0xf6, 0x49, 0xb2, 0x6d, 0xe8, 0x14,
+  0x25, 0xb6, 0xac, 0x88, 0x33, 0xb2, 0xde, 0x15, 0xcd, 0x70, 0x39, 0x48,
+  0x3b, 0x08, 0x26, 0x8f, 0x92, 0x01, 0x12, 0xb1, 0x3f, 0xf2, 0xfe, 0x86,
+  0x75, 0x10, 0x10, 0x2d, 0x07, 0xf3, 0x57, 0xbc, 0x77, 0x99, 0xf5, 0x9e,
+  0xea, 0x8b, 0xbb, 0x6f, 0x74, 0x8c, 0x4f, 0x56, 0x5c, 0x09, 0x65, 0x91,
+  0xda, 0x12, 0x3f, 0x07, 0x08, 0x55, 0x4e, 0x49, 0xfa, 0x9e, 0xe2, 0x27,
+  0x5d, 0xeb, 0x01, 0xa2, 0x50, 0xcf, 0x6b, 0xad, 0x2f, 0x44, 0x62, 0xae,
+  0xcc, 0x89, 0x3c, 0xf5, 0xd8, 0x09, 0xd5, 0xa3, 0xab, 0x53, 0xd7, 0x8e,
+  0x7d, 0xda, 0xb3, 0xcd, 0x3d, 0xd3, 0x52, 0x3c, 0xeb, 0x53, 0x74, 0x59,
+  0x28, 0xbf, 0x7d, 0xc1, 0x9e, 0x4d, 0x67, 0x83, 0x13, 0x7b, 0x85, 0xb4,
+  0x8d, 0x07, 0xef, 0x84, 0xde, 0x9e, 0x54, 0x67, 0x54, 0x24, 0xfa, 0x39,
+  0x74, 0x22, 0x21, 0xed, 0x1b, 0x3c, 0x79, 0xf4, 0xdc, 0x85, 0x16, 0xbb,
+  0x23, 0xc3, 0xd8, 0xf6, 0xd0, 0xcd, 0x9b, 0x2a, 0x2e, 0x1d, 0xbb, 0x8d,
+  0xad, 0x64, 0x23, 0x37, 0x6f, 0x4c, 0xb7, 0x6e, 0xaa, 0x56, 0xf8, 0x56,
+  0x57, 0x8a, 0x2f, 0xce, 0x15, 0x44, 0xb4, 0xd3, 0x4c, 0x67, 0x92, 0x62,
+  0xbd, 0xbe, 0x29, 0x45, 0xd7, 0x55, 0x23, 0x23, 0x4d, 0xa1, 0xf0, 0x54,
+  0xfe, 0xcd, 0xe5, 0xf9, 0x63, 0x54, 0x64, 0xdc, 0x3e, 0xf0, 0x4f, 0x54,
+  0x5f, 0xa2, 0x6a, 0x6d, 0x46, 0xa0, 0x1c, 0xb8, 0xaf, 0x2d, 0xbd, 0xbd,
+  0x7d, 0x28, 0xb0, 0x4e, 0xdc, 0x1f, 0x61, 0x7e, 0xad, 0x3f, 0x9e, 0x38,
+  0x92, 0xdb, 0x8a, 0x04, 0x8c, 0xe0, 0x68, 0x73, 0x0b, 0xc8, 0x3d, 0xef,
+  0xeb, 0xa0, 0xb7, 0x52, 0x43, 0x26, 0xa1, 0x2c, 0x3c, 0xb0, 0x0d, 0xc2,
+  0x56, 0x37, 0x00, 0xf8, 0xf6, 0x36, 0x8b, 0x87, 0x30, 0x81, 0x08, 0x49,
+  0x73, 0x82, 0xe6, 0x71, 0xd6, 0xe3, 0x9d, 0x40, 0x96, 0x99, 0xa8, 0xe8,
+  0x2e, 0x14, 0xf5, 0xbb, 0x6f, 0x31, 0xd2, 0xa7, 0xa5, 0x5c, 0x18, 0x03,
+  0x52, 0xab, 0xc4, 0xa8, 0xac, 0xac, 0xc2, 0xd5, 0xab, 0xf2, 0xf2, 0x1e,
+  0x4e, 0x8b, 0xdd, 0xdc, 0x54, 0x4a, 0xcb, 0x6e, 0xed, 0x4f, 0x3e, 0x40,
+  0x74, 0x21, 0x8d, 0x43, 0xa4, 0xd0, 0xe6, 0x05, 0x55, 0x2b, 0x3a, 0xef,
+  0xca, 0xfe, 0x34, 0xc8, 0xb9, 0x82, 0x23, 0x85, 0xe2, 0x39, 0xc7, 0x95,
+  0x7a, 0x65, 0x20, 0xf9, 0x93, 0x7a, 0x53, 0x48, 0x23, 0x23, 0xae, 0xda,
+  0x14, 0x72, 0xec, 0x52, 0x06, 0x2a, 0x8e, 0xb3, 0xf8, 0x66, 0xd3, 0x53,
+  0xb5, 0xb8, 0x5c, 0x14, 0x2d, 0xfa, 0x50, 0x86, 0xa0, 0x18, 0x08, 0x08,
+  0xc6, 0x08, 0x39, 0x1e, 0x1e, 0xee, 0xbd, 0x39, 0x4a, 0x87, 0x94, 0xef,
+  0xef, 0xad, 0x7b, 0x76, 0xfe, 0xaf, 0x62, 0xb7, 0xca, 0x14, 0x98, 0xce,
+  0x24, 0x2a, 0xcf, 0x35, 0x00, 0x00, 0xc4, 0x17, 0xef, 0x76, 0x24, 0x4a,
+  0x0f, 0x7f, 0x7f, 0x17, 0x8e, 0x2e, 0x3d, 0xa3, 0x40, 0xa0, 0x93, 0xb3,
+  0xa8, 0x18, 0x35, 0x35, 0x6f, 0x56, 0xb7, 0x65, 0xff, 0x43, 0x54, 0x3b,
+  0x6c, 0x83, 0x84, 0xfd, 0xaa, 0x87, 0xa9, 0x00, 0x9e, 0x2c, 0xbe, 0x33,
+  0x80, 0x2f, 0xff, 0x08, 0x94, 0x5f, 0x78, 0x15, 0x5e, 0x81, 0x6c, 0xe2,
+  0x7a, 0xbf, 0x0f, 0xaa, 0xfc, 0x88, 0xac, 0xd8, 0x20, 0xbb, 0xa5, 0x1f,
+  0x9d, 0x28, 0xc7, 0xe6, 0x7e, 0x79, 0xec, 0xec, 0xf3, 0xd8, 0x8f, 0xb8,
+  0xf4, 0x97, 0x08, 0xb4, 0x38, 0xf7, 0x93, 0x85, 0xcc, 0xee, 0xbc, 0x28,
+  0x62, 0xac, 0x95, 0xb5, 0x53, 0x27, 0xbd, 0x62, 0x0f, 0x19, 0x19, 0x5b,
+  0x7f, 0x9e, 0x91, 0x0e, 0x4a, 0xe1, 0xbc, 0x4a, 0xec, 0x88, 0x08, 0x7e,
+  0xb9, 0x50, 0xbe, 0xcb, 0x38, 0xbd, 0x7c, 0xec, 0xe4, 0xf1, 0x91, 0x06,
+  0x6f, 0x1e, 0x80, 0xd8, 0x67, 0xfb, 0xfb, 0x9c, 0xb2, 0x78, 0x8d, 0x72,
+  0xde, 0xc6, 0x47, 0x49, 0xd7, 0xe1, 0xd3, 0xa2, 0x4d, 0xe5, 0x97, 0xd6,
+  0xd2, 0xc2, 0xd5, 0xca, 0x68, 0x04, 0x1e, 0xb3, 0x52, 0x59, 0xeb, 0x92,
+  0x69, 0xf2, 0xc1, 0x97, 0x03, 0x9f, 0x00, 0x00, 0x12, 0x00, 0x24, 0x00,
+  0x36, 0x00, 0x48, 0x00, 0x5a, 0x00, 0x6c, 0x00, 0x80, 0x00, 0x92, 0x00,
+  0xa4, 0x00, 0xb6, 0x00, 0xc8, 0x00, 0xda, 0x00, 0xec, 0x00, 0x04, 0x01,
+  0x16, 0x01, 0x00, 0x00, 0x11, 0x00, 0x25, 0x00, 0x39, 0x00, 0x4d, 0x00,
+  0x5f, 0x00, 0x73, 0x00, 0x87, 0x00, 0x9a, 0x00, 0xad, 0x00, 0xc1, 0x00,
+  0xce, 0x00, 0xe2, 0x00, 0x00, 0x00, 0x16, 0x00, 0x25, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x2c, 0x00, 0x3f, 0x00, 0x52, 0x00, 0x65, 0x00, 0x79, 0x00,
+  0x8d, 0x00, 0xa1, 0x00, 0xb9, 0x00, 0xcb, 0x00, 0x00, 0x00, 0x1f, 0x00,
+  0x3e, 0x00, 0x5e, 0x00, 0x77, 0x00, 0x8c, 0x00, 0x9f, 0x00, 0xb5, 0x00,
+  0xc9, 0x00, 0xdf, 0x00, 0xf1, 0x00, 0x06, 0x01, 0x00, 0x00, 0x05, 0x00,
+  0x20, 0x00, 0x3a, 0x00, 0x4d, 0x00, 0x68, 0x00, 0x83, 0x00, 0x9d, 0x00,
+  0xb8, 0x00, 0xd3, 0x00, 0xee, 0x00, 0x08, 0x01, 0x23, 0x01, 0x3d, 0x01,
+  0x54, 0x01, 0x6f, 0x01, 0x86, 0x01, 0xa0, 0x01, 0x00, 0x00, 0x15, 0x00,
+  0x20, 0x00, 0x30, 0x00, 0x40, 0x00, 0x53, 0x00, 0x62, 0x00, 0x72, 0x00,
+  0x84, 0x00, 0x00, 0x00, 0x17, 0x00, 0x25, 0x00, 0x3c, 0x00, 0x48, 0x00,
+  0x60, 0x00, 0x6f, 0x00, 0x7e, 0x00, 0x9e, 0x00, 0xb5, 0x00, 0xc0, 0x00,
+  0xcf, 0x00, 0xe5, 0x00, 0xfd, 0x00, 0x0c, 0x01, 0x22, 0x01, 0x3a, 0x01,
+  0x52, 0x01, 0x68, 0x01, 0x77, 0x01, 0x8d, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x17, 0x00, 0x32, 0x00, 0x4c, 0x00, 0x66, 0x00, 0x80, 0x00,
+  0x8b, 0x00, 0x96, 0x00, 0xb0, 0x00, 0xcb, 0x00, 0xe6, 0x00, 0xf9, 0x00,
+  0x13, 0x01, 0x25, 0x01, 0x40, 0x01, 0x00, 0x00, 0x14, 0x00, 0x28, 0x00,
+  0x45, 0x00, 0x54, 0x00, 0x70, 0x00, 0x7b, 0x00, 0x8b, 0x00, 0x9f, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x22, 0x00, 0x33, 0x00, 0x44, 0x00, 0x56, 0x00,
+  0x68, 0x00, 0x75, 0x00, 0x87, 0x00, 0x96, 0x00, 0xa8, 0x00, 0xba, 0x00,
+  0xcc, 0x00, 0xde, 0x00, 0xf0, 0x00, 0x02, 0x01, 0x14, 0x01, 0x26, 0x01,
+  0x38, 0x01, 0x4a, 0x01, 0x5c, 0x01, 0x6d, 0x01, 0x7f, 0x01, 0x91, 0x01,
+  0x9e, 0x01, 0xb0, 0x01, 0xc1, 0x01, 0xd0, 0x01, 0xe2, 0x01, 0xf4, 0x01,
+  0x06, 0x02, 0x18, 0x02, 0x27, 0x02, 0x39, 0x02, 0x4b, 0x02, 0x5c, 0x02,
+  0x00, 0x00, 0x16, 0x00, 0x2e, 0x00, 0x49, 0x00, 0x61, 0x00, 0x6e, 0x00,
+  0x00, 0x00, 0x06, 0x00, 0x15, 0x00, 0x24, 0x00, 0x33, 0x00, 0x3f, 0x00,
+  0x4e, 0x00, 0x5d, 0x00, 0x6c, 0x00, 0x7b, 0x00, 0x8a, 0x00, 0x99, 0x00,
+  0xa8, 0x00, 0xb7, 0x00, 0xc5, 0x00, 0xd4, 0x00, 0xe3, 0x00, 0xf2, 0x00,
+  0x02, 0x01, 0x11, 0x01, 0x20, 0x01, 0x2f, 0x01, 0x3e, 0x01, 0x4d, 0x01,
+  0x5c, 0x01, 0x6b, 0x01, 0x7a, 0x01, 0x89, 0x01, 0x98, 0x01, 0xa7, 0x01,
+  0xb5, 0x01, 0xc4, 0x01, 0xd2, 0x01, 0xe1, 0x01, 0xf0, 0x01, 0x00, 0x00,
+  0x1b, 0x00, 0x36, 0x00, 0x51, 0x00, 0x6b, 0x00, 0x86, 0x00, 0xa1, 0x00,
+  0xbc, 0x00, 0xd7, 0x00, 0xf2, 0x00, 0x0c, 0x01, 0x27, 0x01, 0x42, 0x01,
+  0x5d, 0x01, 0x79, 0x01, 0x93, 0x01, 0xae, 0x01, 0xc9, 0x01, 0xe3, 0x01,
+  0xff, 0x01, 0x1b, 0x02, 0x37, 0x02, 0x53, 0x02, 0x6d, 0x02, 0x88, 0x02,
+  0xa3, 0x02, 0xbe, 0x02, 0xd9, 0x02, 0xf3, 0x02, 0x0e, 0x03, 0x29, 0x03,
+  0x3d, 0x03, 0x57, 0x03, 0x70, 0x03, 0x8a, 0x03, 0xa4, 0x03, 0xbf, 0x03,
+  0xda, 0x03, 0xf5, 0x03, 0x10, 0x04, 0x2a, 0x04, 0x44, 0x04, 0x58, 0x04,
+  0x6c, 0x04, 0x87, 0x04, 0xa2, 0x04, 0xbd, 0x04, 0xd8, 0x04, 0xf3, 0x04,
+  0x0e, 0x05, 0x28, 0x05, 0x43, 0x05, 0x5e, 0x05, 0x79, 0x05, 0x94, 0x05,
+  0xaf, 0x05, 0xca, 0x05, 0xe5, 0x05, 0x00, 0x06, 0x1b, 0x06, 0x35, 0x06,
+  0x50, 0x06, 0x00, 0x00, 0x09, 0x00, 0x18, 0x00, 0x31, 0x00, 0x39, 0x00,
+  0x47, 0x00, 0x57, 0x00, 0x66, 0x00, 0x75, 0x00, 0x82, 0x00, 0x91, 0x00,
+  0xa0, 0x00, 0xaf, 0x00, 0xbe, 0x00, 0xcd, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x19, 0x00, 0x33, 0x00, 0x4e, 0x00, 0x68, 0x00, 0x7c, 0x00, 0x90, 0x00,
+  0xaa, 0x00, 0xc4, 0x00, 0xde, 0x00, 0xf8, 0x00, 0x13, 0x01, 0x2d, 0x01,
+  0x48, 0x01, 0x63, 0x01, 0x77, 0x01, 0x8a, 0x01, 0x00, 0x00, 0x06, 0x00,
+  0x1e, 0x00, 0x37, 0x00, 0x49, 0x00, 0x58, 0x00, 0x70, 0x00, 0x8d, 0x00,
+  0xa5, 0x00, 0xb4, 0x00, 0xcc, 0x00, 0xe5, 0x00, 0xf4, 0x00, 0x0d, 0x01,
+  0x1c, 0x01, 0x2b, 0x01, 0x3a, 0x01, 0x49, 0x01, 0x66, 0x01, 0x7f, 0x01,
+  0x98, 0x01, 0xb1, 0x01, 0xc6, 0x01, 0xd5, 0x01, 0xec, 0x01, 0x08, 0x02,
+  0x00, 0x00, 0x18, 0x00, 0x37, 0x00, 0x47, 0x00, 0x52, 0x00, 0x70, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x1b, 0x00, 0x2d, 0x00, 0x3c, 0x00, 0x4b, 0x00,
+  0x5d, 0x00, 0x6c, 0x00, 0x81, 0x00, 0x8f, 0x00, 0x00, 0x00, 0x11, 0x00,
+  0x24, 0x00, 0x00, 0x00, 0x05, 0x00, 0x23, 0x00, 0x41, 0x00, 0x58, 0x00,
+  0x6d, 0x00, 0x85, 0x00, 0x90, 0x00, 0x00, 0x00, 0x18, 0x00, 0x30, 0x00,
+  0x46, 0x00, 0x5f, 0x00, 0x77, 0x00, 0x8f, 0x00, 0xb5, 0x00, 0xc9, 0x00,
+  0xe0, 0x00, 0xf5, 0x00, 0x06, 0x01, 0x17, 0x01, 0x29, 0x01, 0x41, 0x01,
+  0x55, 0x01, 0x6c, 0x01, 0x7c, 0x01, 0x95, 0x01, 0xb0, 0x01, 0xc8, 0x01,
+  0x00, 0x00, 0x09, 0x00, 0x11, 0x00, 0x00, 0x00, 0x11, 0x00, 0x28, 0x00,
+  0x39, 0x00, 0x00, 0x00, 0x06, 0x00, 0x18, 0x00, 0x2a, 0x00, 0x3b, 0x00,
+  0x54, 0x00, 0x66, 0x00, 0x77, 0x00, 0x88, 0x00, 0x9a, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x27, 0x00, 0x3b, 0x00, 0x55, 0x00, 0x69, 0x00, 0x7d, 0x00,
+  0x8e, 0x00, 0x9c, 0x00, 0xb0, 0x00, 0xca, 0x00, 0xdd, 0x00, 0xf6, 0x00,
+  0x0a, 0x01, 0x15, 0x01, 0x30, 0x01, 0x44, 0x01, 0x5f, 0x01, 0x74, 0x01,
+  0x88, 0x01, 0x9b, 0x01, 0xaf, 0x01, 0xca, 0x01, 0xdd, 0x01, 0xf1, 0x01,
+  0x05, 0x02, 0x19, 0x02, 0x2d, 0x02, 0x41, 0x02, 0x53, 0x02, 0x6e, 0x02,
+  0x89, 0x02, 0x9d, 0x02, 0xb5, 0x02, 0xcf, 0x02, 0xe2, 0x02, 0x00, 0x00,
+  0x16, 0x00, 0x28, 0x00, 0x3d, 0x00, 0x53, 0x00, 0x66, 0x00, 0x73, 0x00,
+  0x8f, 0x00, 0xa1, 0x00, 0xb7, 0x00, 0xca, 0x00, 0xdc, 0x00, 0xf8, 0x00,
+  0x14, 0x01, 0x30, 0x01, 0x42, 0x01, 0x58, 0x01, 0x6a, 0x01, 0x7c, 0x01,
+  0x97, 0x01, 0xa9, 0x01, 0xbb, 0x01, 0xc8, 0x01, 0xe4, 0x01, 0xf5, 0x01,
+  0x12, 0x02, 0x24, 0x02, 0x35, 0x02, 0x47, 0x02, 0x5c, 0x02, 0x6d, 0x02,
+  0x7f, 0x02, 0x9c, 0x02, 0x00, 0x00, 0x0d, 0x00, 0x1a, 0x00, 0x38, 0x00,
+  0x4c, 0x00, 0x60, 0x00, 0x7e, 0x00, 0x99, 0x00, 0xb6, 0x00, 0xc3, 0x00,
+  0xe1, 0x00, 0x00, 0x01, 0x18, 0x01, 0x25, 0x01, 0x43, 0x01, 0x62, 0x01,
+  0x81, 0x01, 0x94, 0x01, 0x00, 0x00, 0x06, 0x00, 0x22, 0x00, 0x37, 0x00,
+  0x4c, 0x00, 0x5d, 0x00, 0x73, 0x00, 0x89, 0x00, 0x9f, 0x00, 0x00, 0x00,
+  0x1b, 0x00, 0x39, 0x00, 0x4d, 0x00, 0x61, 0x00, 0x7b, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x26, 0x00, 0x3c, 0x00, 0x4b, 0x00, 0x61, 0x00, 0x77, 0x00,
+  0x86, 0x00, 0x9c, 0x00, 0xb2, 0x00, 0xc8, 0x00, 0xd1, 0x00, 0xe7, 0x00,
+  0xf6, 0x00, 0x08, 0x01, 0x17, 0x01, 0x00, 0x00, 0x0b, 0x00, 0x1c, 0x00,
+  0x37, 0x00, 0x52, 0x00, 0x6d, 0x00, 0x87, 0x00, 0xa1, 0x00, 0xbb, 0x00,
+  0xd6, 0x00, 0xee, 0x00, 0x04, 0x01, 0x11, 0x01, 0x29, 0x01, 0x36, 0x01,
+  0x4e, 0x01, 0x5b, 0x01, 0x75, 0x01, 0x00, 0x00, 0x06, 0x00, 0x22, 0x00,
+  0x3d, 0x00, 0x4c, 0x00, 0x62, 0x00, 0x78, 0x00, 0x88, 0x00, 0x9e, 0x00,
+  0xad, 0x00, 0xc9, 0x00, 0xe5, 0x00, 0xfa, 0x00, 0x16, 0x01, 0x24, 0x01,
+  0x40, 0x01, 0x55, 0x01, 0x72, 0x01, 0x8e, 0x01, 0xaa, 0x01, 0xc0, 0x01,
+  0xcf, 0x01, 0xe5, 0x01, 0xf4, 0x01, 0x0a, 0x02, 0x27, 0x02, 0x43, 0x02,
+  0x59, 0x02, 0x6a, 0x02, 0x00, 0x00, 0x1e, 0x00, 0x32, 0x00, 0x50, 0x00,
+  0x6e, 0x00, 0x8d, 0x00, 0xaf, 0x00, 0xce, 0x00, 0xed, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x25, 0x00, 0x37, 0x00, 0x49, 0x00, 0x55, 0x00, 0x67, 0x00,
+  0x79, 0x00, 0x00, 0x00, 0x10, 0x00, 0x1b, 0x00, 0x33, 0x00, 0x45, 0x00,
+  0x57, 0x00, 0x00, 0x00, 0x14, 0x00, 0x28, 0x00, 0x3c, 0x00, 0x50, 0x00,
+  0x68, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x06, 0x00, 0x1a, 0x00, 0x32, 0x00,
+  0x48, 0x00, 0x5a, 0x00, 0x6b, 0x00, 0x7d, 0x00, 0x95, 0x00, 0x9e, 0x00,
+  0xb6, 0x00, 0xc8, 0x00, 0xe0, 0x00, 0xf2, 0x00, 0x04, 0x01, 0x16, 0x01,
+  0x2c, 0x01, 0x00, 0x00, 0x17, 0x00, 0x2f, 0x00, 0x43, 0x00, 0x5a, 0x00,
+  0x6e, 0x00, 0x7e, 0x00, 0x92, 0x00, 0x00, 0x00, 0x08, 0x00, 0x1a, 0x00,
+  0x32, 0x00, 0x4b, 0x00, 0x5d, 0x00, 0x76, 0x00, 0x88, 0x00, 0x9a, 0x00,
+  0x00, 0x00, 0x14, 0x00, 0x28, 0x00, 0x3c, 0x00, 0x50, 0x00, 0x64, 0x00,
+  0x76, 0x00, 0x8a, 0x00, 0x9e, 0x00, 0xab, 0x00, 0xbb, 0x00, 0xcf, 0x00,
+  0xe3, 0x00, 0xf7, 0x00, 0x0a, 0x01, 0x1e, 0x01, 0x00, 0x00, 0x16, 0x00,
+  0x2b, 0x00, 0x40, 0x00, 0x56, 0x00, 0x6c, 0x00, 0x81, 0x00, 0x90, 0x00,
+  0xa5, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x1d, 0x00, 0x30, 0x00, 0x44, 0x00,
+  0x58, 0x00, 0x69, 0x00, 0x7a, 0x00, 0x8e, 0x00, 0xa2, 0x00, 0xb5, 0x00,
+  0xc9, 0x00, 0xd6, 0x00, 0x00, 0x00, 0x06, 0x00, 0x15, 0x00, 0x2d, 0x00,
+  0x3d, 0x00, 0x52, 0x00, 0x68, 0x00, 0x7f, 0x00, 0x95, 0x00, 0xab, 0x00,
+  0xc1, 0x00, 0xe1, 0x00, 0xf6, 0x00, 0x0c, 0x01, 0x22, 0x01, 0x37, 0x01,
+  0x4d, 0x01, 0x64, 0x01, 0x79, 0x01, 0x8f, 0x01, 0xa5, 0x01, 0xb4, 0x01,
+  0xc3, 0x01, 0xd9, 0x01, 0xef, 0x01, 0x04, 0x02, 0x1a, 0x02, 0x33, 0x02,
+  0x49, 0x02, 0x5f, 0x02, 0x78, 0x02, 0x87, 0x02, 0x9d, 0x02, 0xac, 0x02,
+  0xc6, 0x02, 0xd3, 0x02, 0xe8, 0x02, 0xfe, 0x02, 0x00, 0x00, 0x11, 0x00,
+  0x22, 0x00, 0x33, 0x00, 0x43, 0x00, 0x54, 0x00, 0x65, 0x00, 0x82, 0x00,
+  0x93, 0x00, 0xa6, 0x00, 0xb7, 0x00, 0xc8, 0x00, 0xd9, 0x00, 0xe6, 0x00,
+  0xf6, 0x00, 0x08, 0x01, 0x19, 0x01, 0x2a, 0x01, 0x3b, 0x01, 0x48, 0x01,
+  0x59, 0x01, 0x6a, 0x01, 0x7b, 0x01, 0x8c, 0x01, 0x9b, 0x01, 0xac, 0x01,
+  0xc0, 0x01, 0xd1, 0x01, 0xe5, 0x01, 0xf6, 0x01, 0x07, 0x02, 0x18, 0x02,
+  0x00, 0x00, 0x12, 0x00, 0x2a, 0x00, 0x41, 0x00, 0x53, 0x00, 0x69, 0x00,
+  0x00, 0x00, 0x18, 0x00, 0x2c, 0x00, 0x3b, 0x00, 0x55, 0x00, 0x62, 0x00,
+  0x75, 0x00, 0x86, 0x00, 0xa1, 0x00, 0xbc, 0x00, 0xd3, 0x00, 0xee, 0x00,
+  0x00, 0x00, 0x06, 0x00, 0x22, 0x00, 0x40, 0x00, 0x5f, 0x00, 0x7b, 0x00,
+  0x8b, 0x00, 0xa1, 0x00, 0xb5, 0x00, 0xd3, 0x00, 0xe9, 0x00, 0x04, 0x01,
+  0x00, 0x00, 0x11, 0x00, 0x30, 0x00, 0x4e, 0x00, 0x5f, 0x00, 0x73, 0x00,
+  0x84, 0x00, 0x95, 0x00, 0xa9, 0x00, 0xba, 0x00, 0xcb, 0x00, 0xdc, 0x00,
+  0x00, 0x00, 0x16, 0x00, 0x2f, 0x00, 0x46, 0x00, 0x58, 0x00, 0x6d, 0x00,
+  0x7c, 0x00, 0x8e, 0x00, 0x00, 0x00, 0x10, 0x00, 0x29, 0x00, 0x43, 0x00,
+  0x00, 0x00, 0x06, 0x00, 0x21, 0x00, 0x3d, 0x00, 0x59, 0x00, 0x75, 0x00,
+  0x91, 0x00, 0xac, 0x00, 0xbd, 0x00, 0xce, 0x00, 0x00, 0x00, 0x17, 0x00,
+  0x00, 0x00, 0x15, 0x00, 0x2e, 0x00, 0x46, 0x00, 0x5e, 0x00, 0x72, 0x00,
+  0x00, 0x00, 0x14, 0x00, 0x23, 0x00, 0x37, 0x00, 0x4b, 0x00, 0x5f, 0x00,
+  0x72, 0x00, 0x89, 0x00, 0x9d, 0x00, 0xb1, 0x00, 0xc4, 0x00, 0xd7, 0x00,
+  0xeb, 0x00, 0xff, 0x00, 0x13, 0x01, 0x30, 0x01, 0x44, 0x01, 0x58, 0x01,
+  0x6b, 0x01, 0x7f, 0x01, 0x93, 0x01, 0xa7, 0x01, 0xbb, 0x01, 0xcb, 0x01,
+  0xde, 0x01, 0xf1, 0x01, 0x06, 0x02, 0x1e, 0x02, 0x32, 0x02, 0x46, 0x02,
+  0x00, 0x00, 0x06, 0x00, 0x18, 0x00, 0x2a, 0x00, 0x40, 0x00, 0x52, 0x00,
+  0x64, 0x00, 0x7c, 0x00, 0x8d, 0x00, 0x9f, 0x00, 0xb1, 0x00, 0xc9, 0x00,
+  0xdb, 0x00, 0xed, 0x00, 0xff, 0x00, 0x11, 0x01, 0x23, 0x01, 0x35, 0x01,
+  0x46, 0x01, 0x58, 0x01, 0x00, 0x00, 0x15, 0x00, 0x2c, 0x00, 0x43, 0x00,
+  0x5a, 0x00, 0x71, 0x00, 0x88, 0x00, 0xa0, 0x00, 0xb8, 0x00, 0xce, 0x00,
+  0xe1, 0x00, 0xf9, 0x00, 0x11, 0x01, 0x29, 0x01, 0x41, 0x01, 0x59, 0x01,
+  0x71, 0x01, 0x85, 0x01, 0x9c, 0x01, 0xb3, 0x01, 0xca, 0x01, 0xe1, 0x01,
+  0xf9, 0x01, 0x10, 0x02, 0x27, 0x02, 0x3f, 0x02, 0x57, 0x02, 0x6f, 0x02,
+  0x86, 0x02, 0x9f, 0x02, 0xb6, 0x02, 0xcd, 0x02, 0xe1, 0x02, 0xf8, 0x02,
+  0x10, 0x03, 0x28, 0x03, 0x40, 0x03, 0x58, 0x03, 0x70, 0x03, 0x85, 0x03,
+  0x9e, 0x03, 0xb6, 0x03, 0xd2, 0x03, 0xe9, 0x03, 0x01, 0x04, 0x19, 0x04,
+  0x2c, 0x04, 0x42, 0x04, 0x59, 0x04, 0x71, 0x04, 0x88, 0x04, 0x00, 0x00,
+  0x12, 0x00, 0x2b, 0x00, 0x47, 0x00, 0x67, 0x00, 0x84, 0x00, 0x9c, 0x00,
+  0xb3, 0x00, 0xce, 0x00, 0xe3, 0x00, 0xf0, 0x00, 0x02, 0x01, 0x1a, 0x01,
+  0x2c, 0x01, 0x3e, 0x01, 0x50, 0x01, 0x62, 0x01, 0x7a, 0x01, 0x8b, 0x01,
+  0xa4, 0x01, 0xbf, 0x01, 0xd1, 0x01, 0xee, 0x01, 0x06, 0x02, 0x00, 0x00,
+  0x14, 0x00, 0x25, 0x00, 0x39, 0x00, 0x4d, 0x00, 0x61, 0x00, 0x74, 0x00,
+  0x88, 0x00, 0x9c, 0x00, 0xb0, 0x00, 0xc8, 0x00, 0xdc, 0x00, 0xef, 0x00,
+  0x03, 0x01, 0x00, 0x00, 0x15, 0x00, 0x24, 0x00, 0x31, 0x00, 0x47, 0x00,
+  0x5c, 0x00, 0x71, 0x00, 0x89, 0x00, 0x9f, 0x00, 0xb0, 0x00, 0xc1, 0x00,
+  0xd7, 0x00, 0xf4, 0x00, 0x0a, 0x01, 0x00, 0x00, 0x19, 0x00, 0x33, 0x00,
+  0x40, 0x00, 0x56, 0x00, 0x6e, 0x00, 0x79, 0x00, 0x94, 0x00, 0xae, 0x00,
+  0xbe, 0x00, 0xd6, 0x00, 0xe6, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x2b, 0x00,
+  0x48, 0x00, 0x57, 0x00, 0x73, 0x00, 0x8e, 0x00, 0xa9, 0x00, 0xc8, 0x00,
+  0xd7, 0x00, 0xe6, 0x00, 0x02, 0x01, 0x20, 0x01, 0x3c, 0x01, 0x58, 0x01,
+  0x73, 0x01, 0x8e, 0x01, 0x9d, 0x01, 0xac, 0x01, 0xc7, 0x01, 0xe2, 0x01,
+  0xf9, 0x01, 0x08, 0x02, 0x19, 0x02, 0x28, 0x02, 0x44, 0x02, 0x53, 0x02,
+  0x6f, 0x02, 0x00, 0x00, 0x1a, 0x00, 0x34, 0x00, 0x4e, 0x00, 0x62, 0x00,
+  0x00, 0x00, 0x06, 0x00, 0x13, 0x00, 0x24, 0x00, 0x3a, 0x00, 0x50, 0x00,
+  0x66, 0x00, 0x7c, 0x00, 0x8d, 0x00, 0xa3, 0x00, 0xbc, 0x00, 0xd2, 0x00,
+  0xea, 0x00, 0x00, 0x01, 0x17, 0x01, 0x2d, 0x01, 0x43, 0x01, 0x59, 0x01,
+  0x6e, 0x01, 0x83, 0x01, 0x99, 0x01, 0xaf, 0x01, 0xc5, 0x01, 0xdb, 0x01,
+  0xf1, 0x01, 0x07, 0x02, 0x1c, 0x02, 0x32, 0x02, 0x42, 0x02, 0x58, 0x02,
+  0x67, 0x02, 0x7d, 0x02, 0x93, 0x02, 0xa9, 0x02, 0xc2, 0x02, 0xd8, 0x02,
+  0xee, 0x02, 0x03, 0x03, 0x11, 0x03, 0x2a, 0x03, 0x38, 0x03, 0x4a, 0x03,
+  0x60, 0x03, 0x76, 0x03, 0x82, 0x03, 0x98, 0x03, 0xae, 0x03, 0xc4, 0x03,
+  0xda, 0x03, 0xf0, 0x03, 0x06, 0x04, 0x1c, 0x04, 0x2b, 0x04, 0x3a, 0x04,
+  0x50, 0x04, 0x69, 0x04, 0x78, 0x04, 0x8e, 0x04, 0xa2, 0x04, 0xb7, 0x04,
+  0x00, 0x00, 0x10, 0x00, 0x21, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x21, 0x00,
+  0x33, 0x00, 0x00, 0x00, 0x11, 0x00, 0x22, 0x00, 0x33, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x22, 0x00, 0x47, 0x00, 0x58, 0x00, 0x6a, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x14, 0x00, 0x26, 0x00, 0x38, 0x00, 0x4e, 0x00, 0x60, 0x00,
+  0x76, 0x00, 0x00, 0x00, 0x14, 0x00, 0x26, 0x00, 0x3b, 0x00, 0x4e, 0x00,
+  0x5e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x18, 0x00, 0x2c, 0x00, 0x41, 0x00,
+  0x57, 0x00, 0x69, 0x00, 0x7f, 0x00, 0x95, 0x00, 0xab, 0x00, 0xc0, 0x00,
+  0xd6, 0x00, 0xe8, 0x00, 0x00, 0x00, 0x14, 0x00, 0x27, 0x00, 0x3b, 0x00,
+  0x4f, 0x00, 0x63, 0x00, 0x77, 0x00, 0x8d, 0x00, 0xa3, 0x00, 0xb7, 0x00,
+  0xca, 0x00, 0xde, 0x00, 0xf1, 0x00, 0xfe, 0x00, 0x12, 0x01, 0x26, 0x01,
+  0x3a, 0x01, 0x4c, 0x01, 0x60, 0x01, 0x74, 0x01, 0x00, 0x00, 0x12, 0x00,
+  0x24, 0x00, 0x36, 0x00, 0x48, 0x00, 0x5e, 0x00, 0x72, 0x00, 0x84, 0x00,
+  0x9d, 0x00, 0xae, 0x00, 0xc4, 0x00, 0xd9, 0x00, 0xef, 0x00, 0x05, 0x01,
+  0x1a, 0x01, 0x32, 0x01, 0x44, 0x01, 0x56, 0x01, 0x68, 0x01, 0x00, 0x00,
+  0x14, 0x00, 0x25, 0x00, 0x39, 0x00, 0x4d, 0x00, 0x5e, 0x00, 0x72, 0x00,
+  0x85, 0x00, 0x99, 0x00, 0xad, 0x00, 0x00, 0x00, 0x06, 0x00, 0x17, 0x00,
+  0x2c, 0x00, 0x42, 0x00, 0x54, 0x00, 0x65, 0x00, 0x77, 0x00, 0x8d, 0x00,
+  0xa3, 0x00, 0xb4, 0x00, 0xca, 0x00, 0xdf, 0x00, 0xf4, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x2b, 0x00, 0x3c, 0x00, 0x4d, 0x00, 0x68, 0x00, 0x79, 0x00,
+  0x8a, 0x00, 0x99, 0x00, 0xaa, 0x00, 0xbb, 0x00, 0xcc, 0x00, 0xdb, 0x00,
+  0xed, 0x00, 0xfe, 0x00, 0x15, 0x01, 0x2d, 0x01, 0x44, 0x01, 0x5d, 0x01,
+  0x75, 0x01, 0x89, 0x01, 0xa2, 0x01, 0xb4, 0x01, 0xc5, 0x01, 0xd6, 0x01,
+  0xe6, 0x01, 0x01, 0x02, 0x12, 0x02, 0x2c, 0x02, 0x46, 0x02, 0x57, 0x02,
+  0x68, 0x02, 0x79, 0x02, 0x93, 0x02, 0xa4, 0x02, 0xb5, 0x02, 0xc6, 0x02,
+  0xd6, 0x02, 0xe7, 0x02, 0x02, 0x03, 0x1c, 0x03, 0x2d, 0x03, 0x3d, 0x03,
+  0x4e, 0x03, 0x69, 0x03, 0x79, 0x03, 0x8a, 0x03, 0x9a, 0x03, 0xab, 0x03,
+  0xc5, 0x03, 0xd5, 0x03, 0xef, 0x03, 0x00, 0x00, 0x16, 0x00, 0x33, 0x00,
+  0x00, 0x00, 0x1b, 0x00, 0x39, 0x00, 0x53, 0x00, 0x6f, 0x00, 0x89, 0x00,
+  0x9d, 0x00, 0xbb, 0x00, 0xd5, 0x00, 0xef, 0x00, 0x02, 0x01, 0x1d, 0x01,
+  0x3b, 0x01, 0x59, 0x01, 0x77, 0x01, 0x82, 0x01, 0x9a, 0x01, 0xa7, 0x01,
+  0xbf, 0x01, 0xda, 0x01, 0x00, 0x00, 0x06, 0x00, 0x15, 0x00, 0x24, 0x00,
+  0x33, 0x00, 0x49, 0x00, 0x58, 0x00, 0x6a, 0x00, 0x79, 0x00, 0x88, 0x00,
+  0x00, 0x00, 0x11, 0x00, 0x22, 0x00, 0x33, 0x00, 0x44, 0x00, 0x55, 0x00,
+  0x72, 0x00, 0x8f, 0x00, 0x9f, 0x00, 0xae, 0x00, 0xc2, 0x00, 0xe1, 0x00,
+  0xf2, 0x00, 0x10, 0x01, 0x20, 0x01, 0x3e, 0x01, 0x00, 0x00, 0x1e, 0x00,
+  0x3d, 0x00, 0x54, 0x00, 0x00, 0x00, 0x14, 0x00, 0x2e, 0x00, 0x42, 0x00,
+  0x5c, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x14, 0x00,
+  0x1f, 0x00, 0x37, 0x00, 0x49, 0x00, 0x61, 0x00, 0x74, 0x00, 0x87, 0x00,
+  0x9f, 0x00, 0xb0, 0x00, 0x00, 0x00, 0x16, 0x00, 0x22, 0x00, 0x38, 0x00,
+  0x4e, 0x00, 0x64, 0x00, 0x80, 0x00, 0x96, 0x00, 0xac, 0x00, 0xc2, 0x00,
+  0xd8, 0x00, 0xed, 0x00, 0x02, 0x01, 0x14, 0x01, 0x26, 0x01, 0x3c, 0x01,
+  0x52, 0x01, 0x64, 0x01, 0x76, 0x01, 0x00, 0x00, 0x17, 0x00, 0x2b, 0x00,
+  0x41, 0x00, 0x58, 0x00, 0x70, 0x00, 0x87, 0x00, 0x9f, 0x00, 0xb7, 0x00,
+  0xce, 0x00, 0xe5, 0x00, 0xf8, 0x00, 0x0b, 0x01, 0x1f, 0x01, 0x32, 0x01,
+  0x45, 0x01, 0x5c, 0x01, 0x70, 0x01, 0x87, 0x01, 0x9f, 0x01, 0xb5, 0x01,
+  0xcc, 0x01, 0xe3, 0x01, 0xfa, 0x01, 0x0e, 0x02, 0x22, 0x02, 0x3a, 0x02,
+  0x50, 0x02, 0x65, 0x02, 0x7d, 0x02, 0x91, 0x02, 0xa9, 0x02, 0xc1, 0x02,
+  0xd8, 0x02, 0xf1, 0x02, 0x05, 0x03, 0x19, 0x03, 0x31, 0x03, 0x49, 0x03,
+  0x5f, 0x03, 0x77, 0x03, 0x8b, 0x03, 0xa2, 0x03, 0xb9, 0x03, 0xcf, 0x03,
+  0xe7, 0x03, 0xfe, 0x03, 0x16, 0x04, 0x2e, 0x04, 0x46, 0x04, 0x59, 0x04,
+  0x6b, 0x04, 0x7e, 0x04, 0x91, 0x04, 0xa8, 0x04, 0xbb, 0x04, 0xcf, 0x04,
+  0xe6, 0x04, 0x00, 0x00, 0x06, 0x00, 0x11, 0x00, 0x27, 0x00, 0x41, 0x00,
+  0x54, 0x00, 0x00, 0x00, 0x19, 0x00, 0x2d, 0x00, 0x47, 0x00, 0x5b, 0x00,
+  0x6f, 0x00, 0x83, 0x00, 0x97, 0x00, 0xaf, 0x00, 0xc9, 0x00, 0xdf, 0x00,
+  0xf9, 0x00, 0x12, 0x01, 0x2a, 0x01, 0x3e, 0x01, 0x52, 0x01, 0x66, 0x01,
+  0x7e, 0x01, 0x00, 0x00, 0x15, 0x00, 0x29, 0x00, 0x3e, 0x00, 0x00, 0x00,
+  0x1a, 0x00, 0x33, 0x00, 0x47, 0x00, 0x5b, 0x00, 0x74, 0x00, 0x8e, 0x00,
+  0xac, 0x00, 0xc6, 0x00, 0xe4, 0x00, 0xfe, 0x00, 0x12, 0x01, 0x30, 0x01,
+  0x4e, 0x01, 0x6c, 0x01, 0x8a, 0x01, 0xa4, 0x01, 0xb7, 0x01, 0xd5, 0x01,
+  0xf3, 0x01, 0x0d, 0x02, 0x27, 0x02, 0x41, 0x02, 0x55, 0x02, 0x69, 0x02,
+  0x87, 0x02, 0xa0, 0x02, 0xb9, 0x02, 0xd0, 0x02, 0xed, 0x02, 0x06, 0x03,
+  0x1f, 0x03, 0x33, 0x03, 0x4d, 0x03, 0x62, 0x03, 0x76, 0x03, 0x8a, 0x03,
+  0xa7, 0x03, 0x00, 0x00, 0x0c, 0x00, 0x17, 0x00, 0x26, 0x00, 0x3c, 0x00,
+  0x49, 0x00, 0x56, 0x00, 0x67, 0x00, 0x76, 0x00, 0x8c, 0x00, 0x9e, 0x00,
+  0xad, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x00, 0x16, 0x00, 0x2b, 0x00, 0x39, 0x00, 0x4a, 0x00,
+  0x60, 0x00, 0x78, 0x00, 0x86, 0x00, 0x9c, 0x00, 0xb4, 0x00, 0xd3, 0x00,
+  0xe3, 0x00, 0xfc, 0x00, 0x0b, 0x01, 0x1d, 0x01, 0x2e, 0x01, 0x00, 0x00,
+  0x11, 0x00, 0x22, 0x00, 0x32, 0x00, 0x43, 0x00, 0x53, 0x00, 0x61, 0x00,
+  0x72, 0x00, 0x83, 0x00, 0x94, 0x00, 0xb3, 0x00, 0xc4, 0x00, 0xd5, 0x00,
+  0xe6, 0x00, 0xf7, 0x00, 0x08, 0x01, 0x19, 0x01, 0x2a, 0x01, 0x3b, 0x01,
+  0x53, 0x01, 0x64, 0x01, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x1d, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x16, 0x00, 0x2b, 0x00,
+  0x41, 0x00, 0x52, 0x00, 0x68, 0x00, 0x7e, 0x00, 0x94, 0x00, 0xaa, 0x00,
+  0xc0, 0x00, 0xd6, 0x00, 0xec, 0x00, 0x01, 0x01, 0x17, 0x01, 0x2d, 0x01,
+  0x43, 0x01, 0x59, 0x01, 0x6f, 0x01, 0x85, 0x01, 0x9b, 0x01, 0xb1, 0x01,
+  0xc7, 0x01, 0xdb, 0x01, 0xf1, 0x01, 0x07, 0x02, 0x1d, 0x02, 0x34, 0x02,
+  0x4a, 0x02, 0x60, 0x02, 0x76, 0x02, 0x8c, 0x02, 0xa1, 0x02, 0xb6, 0x02,
+  0x00, 0x00, 0x0d, 0x00, 0x20, 0x00, 0x38, 0x00, 0x48, 0x00, 0x5c, 0x00,
+  0x70, 0x00, 0x81, 0x00, 0x8e, 0x00, 0x9e, 0x00, 0xb2, 0x00, 0xc6, 0x00,
+  0xd7, 0x00, 0xe8, 0x00, 0xf5, 0x00, 0x06, 0x01, 0x00, 0x00, 0x08, 0x00,
+  0x1e, 0x00, 0x37, 0x00, 0x4d, 0x00, 0x63, 0x00, 0x7c, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x33, 0x00, 0x4b, 0x00, 0x63, 0x00, 0x7a, 0x00, 0x91, 0x00,
+  0xaa, 0x00, 0xc1, 0x00, 0xd2, 0x00, 0xea, 0x00, 0x01, 0x01, 0x0e, 0x01,
+  0x1b, 0x01, 0x33, 0x01, 0x43, 0x01, 0x00, 0x00, 0x19, 0x00, 0x2b, 0x00,
+  0x3d, 0x00, 0x47, 0x00, 0x00, 0x00, 0x11, 0x00, 0x25, 0x00, 0x37, 0x00,
+  0x48, 0x00, 0x53, 0x00, 0x63, 0x00, 0x70, 0x00, 0x81, 0x00, 0x92, 0x00,
+  0xa3, 0x00, 0xb7, 0x00, 0xc8, 0x00, 0xd9, 0x00, 0xea, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x11, 0x00, 0x25, 0x00, 0x39, 0x00, 0x4c, 0x00, 0x5f, 0x00,
+  0x72, 0x00, 0x83, 0x00, 0x94, 0x00, 0xa5, 0x00, 0xb9, 0x00, 0xca, 0x00,
+  0xd5, 0x00, 0xe5, 0x00, 0xf9, 0x00, 0x0a, 0x01, 0x1a, 0x01, 0x2e, 0x01,
+  0x42, 0x01, 0x56, 0x01, 0x6a, 0x01, 0x7d, 0x01, 0x8e, 0x01, 0xa2, 0x01,
+  0xb3, 0x01, 0xc7, 0x01, 0xda, 0x01, 0xed, 0x01, 0xfe, 0x01, 0x0f, 0x02,
+  0x22, 0x02, 0x33, 0x02, 0x44, 0x02, 0x55, 0x02, 0x00, 0x00, 0x15, 0x00,
+  0x2e, 0x00, 0x43, 0x00, 0x5c, 0x00, 0x75, 0x00, 0x82, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x28, 0x00, 0x3b, 0x00, 0x48, 0x00, 0x00, 0x00, 0x19, 0x00,
+  0x2e, 0x00, 0x46, 0x00, 0x58, 0x00, 0x6d, 0x00, 0x82, 0x00, 0x9b, 0x00,
+  0xb0, 0x00, 0xc5, 0x00, 0xda, 0x00, 0xe9, 0x00, 0xfe, 0x00, 0x13, 0x01,
+  0x28, 0x01, 0x3a, 0x01, 0x4c, 0x01, 0x64, 0x01, 0x7a, 0x01, 0x92, 0x01,
+  0xaa, 0x01, 0xc3, 0x01, 0xd4, 0x01, 0xeb, 0x01, 0x04, 0x02, 0x13, 0x02,
+  0x25, 0x02, 0x3e, 0x02, 0x57, 0x02, 0x69, 0x02, 0x7e, 0x02, 0x93, 0x02,
+  0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x24, 0x00, 0x3a, 0x00, 0x4c, 0x00,
+  0x62, 0x00, 0x78, 0x00, 0x8a, 0x00, 0xa0, 0x00, 0xb2, 0x00, 0xc4, 0x00,
+  0xd5, 0x00, 0xeb, 0x00, 0xfd, 0x00, 0x12, 0x01, 0x28, 0x01, 0x3e, 0x01,
+  0x53, 0x01, 0x68, 0x01, 0x7d, 0x01, 0x93, 0x01, 0xa4, 0x01, 0xb9, 0x01,
+  0xca, 0x01, 0xdc, 0x01, 0xf2, 0x01, 0x07, 0x02, 0x1d, 0x02, 0x32, 0x02,
+  0x48, 0x02, 0x5a, 0x02, 0x6c, 0x02, 0x84, 0x02, 0x9a, 0x02, 0xab, 0x02,
+  0xc1, 0x02, 0xd3, 0x02, 0xeb, 0x02, 0x00, 0x03, 0x15, 0x03, 0x2a, 0x03,
+  0x40, 0x03, 0x50, 0x03, 0x66, 0x03, 0x7c, 0x03, 0x92, 0x03, 0xa8, 0x03,
+  0xbd, 0x03, 0xd2, 0x03, 0xe4, 0x03, 0xfa, 0x03, 0x10, 0x04, 0x26, 0x04,
+  0x3c, 0x04, 0x4f, 0x04, 0x64, 0x04, 0x79, 0x04, 0x8b, 0x04, 0xa0, 0x04,
+  0xb5, 0x04, 0xc6, 0x04, 0xd7, 0x04, 0xed, 0x04, 0x03, 0x05, 0x15, 0x05,
+  0x27, 0x05, 0x3d, 0x05, 0x52, 0x05, 0x67, 0x05, 0x7d, 0x05, 0x93, 0x05,
+  0x00, 0x00, 0x13, 0x00, 0x27, 0x00, 0x3a, 0x00, 0x4d, 0x00, 0x61, 0x00,
+  0x6e, 0x00, 0x82, 0x00, 0x00, 0x00, 0x16, 0x00, 0x2b, 0x00, 0x41, 0x00,
+  0x57, 0x00, 0x6d, 0x00, 0x83, 0x00, 0x99, 0x00, 0xaf, 0x00, 0xc5, 0x00,
+  0xdb, 0x00, 0xf1, 0x00, 0x07, 0x01, 0x1c, 0x01, 0x32, 0x01, 0x48, 0x01,
+  0x5e, 0x01, 0x74, 0x01, 0x00, 0x00, 0x11, 0x00, 0x21, 0x00, 0x33, 0x00,
+  0x00, 0x00, 0x15, 0x00, 0x27, 0x00, 0x3b, 0x00, 0x4d, 0x00, 0x65, 0x00,
+  0x77, 0x00, 0x90, 0x00, 0xa2, 0x00, 0xba, 0x00, 0xcc, 0x00, 0xd9, 0x00,
+  0xeb, 0x00, 0xfd, 0x00, 0x16, 0x01, 0x00, 0x00, 0x1b, 0x00, 0x35, 0x00,
+  0x50, 0x00, 0x6b, 0x00, 0x89, 0x00, 0xa3, 0x00, 0xbe, 0x00, 0xd8, 0x00,
+  0xf3, 0x00, 0x0e, 0x01, 0x29, 0x01, 0x37, 0x01, 0x52, 0x01, 0x6e, 0x01,
+  0x89, 0x01, 0x00, 0x00, 0x0e, 0x00, 0x2a, 0x00, 0x3a, 0x00, 0x4a, 0x00,
+  0x5a, 0x00, 0x69, 0x00, 0x7f, 0x00, 0x88, 0x00, 0x00, 0x00, 0x17, 0x00,
+  0x2d, 0x00, 0x44, 0x00, 0x5c, 0x00, 0x6f, 0x00, 0x87, 0x00, 0x95, 0x00,
+  0xa8, 0x00, 0xaf, 0x00, 0x00, 0x00, 0x18, 0x00, 0x2f, 0x00, 0x41, 0x00,
+  0x5a, 0x00, 0x73, 0x00, 0x85, 0x00, 0x9d, 0x00, 0xb6, 0x00, 0xc8, 0x00,
+  0xe1, 0x00, 0xf4, 0x00, 0x0d, 0x01, 0x23, 0x01, 0x00, 0x00, 0x12, 0x00,
+  0x23, 0x00, 0x3e, 0x00, 0x59, 0x00, 0x74, 0x00, 0x8f, 0x00, 0xaa, 0x00,
+  0xb7, 0x00, 0xc4, 0x00, 0xdf, 0x00, 0xf3, 0x00, 0x0e, 0x01, 0x29, 0x01,
+  0x43, 0x01, 0x5e, 0x01, 0x71, 0x01, 0x8c, 0x01, 0xa0, 0x01, 0x00, 0x00,
+  0x15, 0x00, 0x2d, 0x00, 0x38, 0x00, 0x4d, 0x00, 0x69, 0x00, 0x7f, 0x00,
+  0x95, 0x00, 0x00, 0x00, 0x07, 0x00, 0x25, 0x00, 0x3f, 0x00, 0x5e, 0x00,
+  0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x3e, 0x00, 0x59, 0x00,
+  0x73, 0x00, 0x8e, 0x00, 0xa9, 0x00, 0xbd, 0x00, 0xd1, 0x00, 0xe5, 0x00,
+  0xf3, 0x00, 0x00, 0x00, 0x16, 0x00, 0x2c, 0x00, 0x3b, 0x00, 0x50, 0x00,
+  0x66, 0x00, 0x7b, 0x00, 0x91, 0x00, 0xa9, 0x00, 0xbe, 0x00, 0xd5, 0x00,
+  0xea, 0x00, 0x00, 0x01, 0x0f, 0x01, 0x24, 0x01, 0x00, 0x00, 0x0b, 0x00,
+  0x1c, 0x00, 0x2d, 0x00, 0x3e, 0x00, 0x4f, 0x00, 0x70, 0x00, 0x80, 0x00,
+  0x00, 0x00, 0x15, 0x00, 0x2b, 0x00, 0x3c, 0x00, 0x52, 0x00, 0x68, 0x00,
+  0x7e, 0x00, 0x90, 0x00, 0xa6, 0x00, 0xbc, 0x00, 0xd2, 0x00, 0xe8, 0x00,
+  0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x10, 0x00, 0x1b, 0x00, 0x26, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x24, 0x00, 0x3a, 0x00, 0x4e, 0x00,
+  0x63, 0x00, 0x79, 0x00, 0x8f, 0x00, 0xa5, 0x00, 0xba, 0x00, 0xcb, 0x00,
+  0xe0, 0x00, 0xf5, 0x00, 0x0d, 0x01, 0x22, 0x01, 0x34, 0x01, 0x50, 0x01,
+  0x62, 0x01, 0x77, 0x01, 0x88, 0x01, 0x9e, 0x01, 0xb1, 0x01, 0xc9, 0x01,
+  0x00, 0x00, 0x11, 0x00, 0x22, 0x00, 0x3d, 0x00, 0x4a, 0x00, 0x62, 0x00,
+  0x75, 0x00, 0x82, 0x00, 0x9d, 0x00, 0xaa, 0x00, 0xb7, 0x00, 0xcb, 0x00,
+  0xdc, 0x00, 0xe8, 0x00, 0xf5, 0x00, 0x06, 0x01, 0x19, 0x01, 0x2d, 0x01,
+  0x41, 0x01, 0x52, 0x01, 0x69, 0x01, 0x7d, 0x01, 0x90, 0x01, 0xa1, 0x01,
+  0x00, 0x00, 0x14, 0x00, 0x2b, 0x00, 0x41, 0x00, 0x57, 0x00, 0x6d, 0x00,
+  0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x12, 0x00, 0x28, 0x00, 0x3e, 0x00,
+  0x4e, 0x00, 0x00, 0x00, 0x14, 0x00, 0x21, 0x00, 0x35, 0x00, 0x42, 0x00,
+  0x56, 0x00, 0x65, 0x00, 0x76, 0x00, 0x8a, 0x00, 0x9b, 0x00, 0xaf, 0x00,
+  0xc2, 0x00, 0xcf, 0x00, 0xea, 0x00, 0xf7, 0x00, 0x04, 0x01, 0x13, 0x01,
+  0x20, 0x01, 0x30, 0x01, 0x41, 0x01, 0x4e, 0x01, 0x60, 0x01, 0x71, 0x01,
+  0x84, 0x01, 0x95, 0x01, 0xa2, 0x01, 0xb0, 0x01, 0xc0, 0x01, 0xd3, 0x01,
+  0x00, 0x00, 0x19, 0x00, 0x32, 0x00, 0x4b, 0x00, 0x64, 0x00, 0x7d, 0x00,
+  0x96, 0x00, 0xae, 0x00, 0xc6, 0x00, 0xdf, 0x00, 0xf7, 0x00, 0x10, 0x01,
+  0x29, 0x01, 0x42, 0x01, 0x5b, 0x01, 0x73, 0x01, 0x8c, 0x01, 0xa5, 0x01,
+  0xbe, 0x01, 0xd7, 0x01, 0xef, 0x01, 0x08, 0x02, 0x18, 0x02, 0x31, 0x02,
+  0x4a, 0x02, 0x63, 0x02, 0x7c, 0x02, 0x94, 0x02, 0xad, 0x02, 0xc6, 0x02,
+  0xed, 0x02, 0x06, 0x03, 0x1f, 0x03, 0x38, 0x03, 0x50, 0x03, 0x68, 0x03,
+  0x80, 0x03, 0x99, 0x03, 0xb2, 0x03, 0xcb, 0x03, 0xe4, 0x03, 0xfd, 0x03,
+  0x17, 0x04, 0x31, 0x04, 0x4a, 0x04, 0x63, 0x04, 0x7c, 0x04, 0x95, 0x04,
+  0xae, 0x04, 0xc6, 0x04, 0xdf, 0x04, 0xf8, 0x04, 0x10, 0x05, 0x29, 0x05,
+  0x41, 0x05, 0x59, 0x05, 0x71, 0x05, 0x89, 0x05, 0xa2, 0x05, 0xba, 0x05,
+  0xd4, 0x05, 0xed, 0x05, 0x06, 0x06, 0x1f, 0x06, 0x38, 0x06, 0x51, 0x06,
+  0x6a, 0x06, 0x83, 0x06, 0x9b, 0x06, 0xb3, 0x06, 0xcc, 0x06, 0xe5, 0x06,
+  0xfe, 0x06, 0x17, 0x07, 0x30, 0x07, 0x49, 0x07, 0x62, 0x07, 0x7a, 0x07,
+  0x92, 0x07, 0xa1, 0x07, 0xba, 0x07, 0x00, 0x00, 0x14, 0x00, 0x27, 0x00,
+  0x3b, 0x00, 0x4e, 0x00, 0x5f, 0x00, 0x73, 0x00, 0x87, 0x00, 0x9b, 0x00,
+  0xaf, 0x00, 0xc3, 0x00, 0xd6, 0x00, 0xea, 0x00, 0xfe, 0x00, 0x12, 0x01,
+  0x25, 0x01, 0x39, 0x01, 0x4d, 0x01, 0x61, 0x01, 0x72, 0x01, 0x85, 0x01,
+  0x9a, 0x01, 0xaf, 0x01, 0xc3, 0x01, 0xd4, 0x01, 0xe5, 0x01, 0xf9, 0x01,
+  0x0a, 0x02, 0x1e, 0x02, 0x2e, 0x02, 0x42, 0x02, 0x53, 0x02, 0x00, 0x00,
+  0x15, 0x00, 0x29, 0x00, 0x3f, 0x00, 0x54, 0x00, 0x6a, 0x00, 0x7f, 0x00,
+  0x93, 0x00, 0xa7, 0x00, 0xbc, 0x00, 0xd2, 0x00, 0xe7, 0x00, 0xfc, 0x00,
+  0x11, 0x01, 0x26, 0x01, 0x3c, 0x01, 0x52, 0x01, 0x00, 0x00, 0x0b, 0x00,
+  0x22, 0x00, 0x36, 0x00, 0x48, 0x00, 0x53, 0x00, 0x67, 0x00, 0x7a, 0x00,
+  0x8d, 0x00, 0xa1, 0x00, 0xb5, 0x00, 0x00, 0x00, 0x12, 0x00, 0x2b, 0x00,
+  0x3c, 0x00, 0x4e, 0x00, 0x5f, 0x00, 0x78, 0x00, 0x91, 0x00, 0xa9, 0x00,
+  0xc0, 0x00, 0xd9, 0x00, 0xf2, 0x00, 0x04, 0x01, 0x15, 0x01, 0x2a, 0x01,
+  0x43, 0x01, 0x5c, 0x01, 0x75, 0x01, 0x8e, 0x01, 0xa7, 0x01, 0xc0, 0x01,
+  0xd9, 0x01, 0xeb, 0x01, 0x04, 0x02, 0x1a, 0x02, 0x2f, 0x02, 0x45, 0x02,
+  0x5c, 0x02, 0x72, 0x02, 0x87, 0x02, 0x99, 0x02, 0xad, 0x02, 0xc6, 0x02,
+  0xdb, 0x02, 0xf4, 0x02, 0x06, 0x03, 0x18, 0x03, 0x29, 0x03, 0x40, 0x03,
+  0x52, 0x03, 0x68, 0x03, 0x80, 0x03, 0x99, 0x03, 0xb2, 0x03, 0xcb, 0x03,
+  0xe4, 0x03, 0xfd, 0x03, 0x16, 0x04, 0x2f, 0x04, 0x48, 0x04, 0x61, 0x04,
+  0x7a, 0x04, 0x93, 0x04, 0xab, 0x04, 0xc3, 0x04, 0xd5, 0x04, 0xe7, 0x04,
+  0xff, 0x04, 0x13, 0x05, 0x28, 0x05, 0x41, 0x05, 0x57, 0x05, 0x6d, 0x05,
+  0x83, 0x05, 0x99, 0x05, 0xaf, 0x05, 0xc1, 0x05, 0xda, 0x05, 0xf3, 0x05,
+  0x0c, 0x06, 0x25, 0x06, 0x37, 0x06, 0x50, 0x06, 0x66, 0x06, 0x78, 0x06,
+  0x8d, 0x06, 0xa6, 0x06, 0xbf, 0x06, 0xd8, 0x06, 0xf1, 0x06, 0x0a, 0x07,
+  0x22, 0x07, 0x3b, 0x07, 0x4f, 0x07, 0x61, 0x07, 0x72, 0x07, 0x8a, 0x07,
+  0xa2, 0x07, 0xbb, 0x07, 0xce, 0x07, 0xe0, 0x07, 0xf9, 0x07, 0x0b, 0x08,
+  0x1d, 0x08, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x23, 0x00, 0x35, 0x00,
+  0x46, 0x00, 0x57, 0x00, 0x68, 0x00, 0x7a, 0x00, 0x8c, 0x00, 0x9d, 0x00,
+  0xaf, 0x00, 0xc1, 0x00, 0xd4, 0x00, 0xe6, 0x00, 0xfc, 0x00, 0x0e, 0x01,
+  0x20, 0x01, 0x32, 0x01, 0x44, 0x01, 0x56, 0x01, 0x68, 0x01, 0x79, 0x01,
+  0x8a, 0x01, 0x9c, 0x01, 0xae, 0x01, 0xc0, 0x01, 0xd2, 0x01, 0xe4, 0x01,
+  0xf6, 0x01, 0x08, 0x02, 0x1a, 0x02, 0x2b, 0x02, 0x3d, 0x02, 0x4f, 0x02,
+  0x61, 0x02, 0x73, 0x02, 0x85, 0x02, 0x96, 0x02, 0xa7, 0x02, 0xb9, 0x02,
+  0xcb, 0x02, 0xdd, 0x02, 0xef, 0x02, 0x01, 0x03, 0x13, 0x03, 0x26, 0x03,
+  0x37, 0x03, 0x49, 0x03, 0x5b, 0x03, 0x6d, 0x03, 0x7f, 0x03, 0x92, 0x03,
+  0xa4, 0x03, 0xb6, 0x03, 0xc8, 0x03, 0xda, 0x03, 0xec, 0x03, 0xfe, 0x03,
+  0x10, 0x04, 0x22, 0x04, 0x34, 0x04, 0x45, 0x04, 0x57, 0x04, 0x69, 0x04,
+  0x7b, 0x04, 0x8d, 0x04, 0x9e, 0x04, 0xb0, 0x04, 0xc3, 0x04, 0xd5, 0x04,
+  0xe7, 0x04, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x15, 0x00, 0x2b, 0x00,
+  0x3d, 0x00, 0x53, 0x00, 0x68, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x19, 0x00, 0x2d, 0x00, 0x41, 0x00,
+  0x00, 0x00, 0x24, 0x00, 0x40, 0x00, 0x4f, 0x00, 0x68, 0x00, 0x78, 0x00,
+  0x89, 0x00, 0x99, 0x00, 0xa8, 0x00, 0xb6, 0x00, 0xca, 0x00, 0xe6, 0x00,
+  0xf6, 0x00, 0x0e, 0x01, 0x23, 0x01, 0x32, 0x01, 0x42, 0x01, 0x53, 0x01,
+  0x62, 0x01, 0x7d, 0x01, 0x93, 0x01, 0xa2, 0x01, 0xb1, 0x01, 0xc1, 0x01,
+  0xd7, 0x01, 0xe6, 0x01, 0xf5, 0x01, 0x10, 0x02, 0x1f, 0x02, 0x35, 0x02,
+  0x4a, 0x02, 0x5f, 0x02, 0x00, 0x00, 0x14, 0x00, 0x2e, 0x00, 0x47, 0x00,
+  0x61, 0x00, 0x7c, 0x00, 0x97, 0x00, 0xb2, 0x00, 0xcc, 0x00, 0xe6, 0x00,
+  0x01, 0x01, 0x1c, 0x01, 0x37, 0x01, 0x52, 0x01, 0x6c, 0x01, 0x86, 0x01,
+  0xa1, 0x01, 0xb9, 0x01, 0xd4, 0x01, 0xec, 0x01, 0x06, 0x02, 0x20, 0x02,
+  0x3b, 0x02, 0x55, 0x02, 0x70, 0x02, 0x8a, 0x02, 0x97, 0x02, 0xb2, 0x02,
+  0x00, 0x00, 0x20, 0x00, 0x3c, 0x00, 0x54, 0x00, 0x70, 0x00, 0x00, 0x00,
+  0x1a, 0x00, 0x33, 0x00, 0x46, 0x00, 0x61, 0x00, 0x74, 0x00, 0x8e, 0x00,
+  0xa2, 0x00, 0xaf, 0x00, 0xbc, 0x00, 0xd0, 0x00, 0xeb, 0x00, 0x06, 0x01,
+  0x21, 0x01, 0x00, 0x00, 0x1d, 0x00, 0x35, 0x00, 0x51, 0x00, 0x6d, 0x00,
+  0x00, 0x00, 0x0b, 0x00, 0x2a, 0x00, 0x48, 0x00, 0x57, 0x00, 0x71, 0x00,
+  0x8d, 0x00, 0x00, 0x00, 0x15, 0x00, 0x29, 0x00, 0x3d, 0x00, 0x52, 0x00,
+  0x67, 0x00, 0x7d, 0x00, 0x95, 0x00, 0xa9, 0x00, 0xbc, 0x00, 0xd1, 0x00,
+  0xe6, 0x00, 0x00, 0x00, 0x13, 0x00, 0x26, 0x00, 0x3a, 0x00, 0x4e, 0x00,
+  0x61, 0x00, 0x00, 0x00, 0x16, 0x00, 0x2c, 0x00, 0x42, 0x00, 0x58, 0x00,
+  0x6e, 0x00, 0x84, 0x00, 0x9a, 0x00, 0xb0, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x18, 0x00, 0x00, 0x00, 0x16, 0x00, 0x29, 0x00, 0x3c, 0x00, 0x52, 0x00,
+  0x67, 0x00, 0x7d, 0x00, 0x8f, 0x00, 0xa5, 0x00, 0xbb, 0x00, 0xd1, 0x00,
+  0xe3, 0x00, 0xf7, 0x00, 0x0d, 0x01, 0x23, 0x01, 0x39, 0x01, 0x4e, 0x01,
+  0x64, 0x01, 0x7a, 0x01, 0x90, 0x01, 0xa6, 0x01, 0xb8, 0x01, 0xc5, 0x01,
+  0xd7, 0x01, 0xec, 0x01, 0x01, 0x02, 0x18, 0x02, 0x2e, 0x02, 0x00, 0x00,
+  0x0f, 0x00, 0x23, 0x00, 0x30, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x17, 0x00,
+  0x00, 0x00, 0x11, 0x00, 0x22, 0x00, 0x33, 0x00, 0x47, 0x00, 0x5b, 0x00,
+  0x6d, 0x00, 0x83, 0x00, 0x95, 0x00, 0xab, 0x00, 0xbc, 0x00, 0xd2, 0x00,
+  0xe4, 0x00, 0xfa, 0x00, 0x0c, 0x01, 0x22, 0x01, 0x36, 0x01, 0x48, 0x01,
+  0x5f, 0x01, 0x71, 0x01, 0x83, 0x01, 0x8e, 0x01, 0xa0, 0x01, 0x00, 0x00,
+  0x17, 0x00, 0x2b, 0x00, 0x3c, 0x00, 0x4d, 0x00, 0x64, 0x00, 0x7f, 0x00,
+  0x90, 0x00, 0xa1, 0x00, 0xb2, 0x00, 0xc3, 0x00, 0xdd, 0x00, 0xf5, 0x00,
+  0x0d, 0x01, 0x1e, 0x01, 0x39, 0x01, 0x54, 0x01, 0x67, 0x01, 0x78, 0x01,
+  0x93, 0x01, 0xab, 0x01, 0xbc, 0x01, 0xcd, 0x01, 0xdd, 0x01, 0xf1, 0x01,
+  0x08, 0x02, 0x20, 0x02, 0x31, 0x02, 0x4b, 0x02, 0x63, 0x02, 0x7a, 0x02,
+  0x8b, 0x02, 0xa2, 0x02, 0xb9, 0x02, 0xd1, 0x02, 0xea, 0x02, 0x00, 0x00,
+  0x18, 0x00, 0x30, 0x00, 0x48, 0x00, 0x5e, 0x00, 0x70, 0x00, 0x8d, 0x00,
+  0xa4, 0x00, 0xbc, 0x00, 0xdd, 0x00, 0xf5, 0x00, 0x0c, 0x01, 0x00, 0x00,
+  0x18, 0x00, 0x30, 0x00, 0x48, 0x00, 0x60, 0x00, 0x78, 0x00, 0x90, 0x00,
+  0xa8, 0x00, 0xc0, 0x00, 0xd8, 0x00, 0xee, 0x00, 0x06, 0x01, 0x1f, 0x01,
+  0x36, 0x01, 0x4d, 0x01, 0x65, 0x01, 0x7d, 0x01, 0x95, 0x01, 0xad, 0x01,
+  0xc5, 0x01, 0xdd, 0x01, 0xf5, 0x01, 0x0d, 0x02, 0x25, 0x02, 0x3c, 0x02,
+  0x49, 0x02, 0x61, 0x02, 0x79, 0x02, 0x91, 0x02, 0xa3, 0x02, 0xba, 0x02,
+  0xd2, 0x02, 0xe1, 0x02, 0xf9, 0x02, 0x11, 0x03, 0x28, 0x03, 0x3f, 0x03,
+  0x57, 0x03, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x10, 0x00, 0x21, 0x00,
+  0x30, 0x00, 0x3f, 0x00, 0x50, 0x00, 0x60, 0x00, 0x71, 0x00, 0x82, 0x00,
+  0x93, 0x00, 0xa8, 0x00, 0xb9, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x28, 0x00,
+  0x40, 0x00, 0x59, 0x00, 0x72, 0x00, 0x8b, 0x00, 0xa3, 0x00, 0xbb, 0x00,
+  0x00, 0x00, 0x14, 0x00, 0x28, 0x00, 0x3b, 0x00, 0x4f, 0x00, 0x63, 0x00,
+  0x77, 0x00, 0x8b, 0x00, 0x9c, 0x00, 0xb0, 0x00, 0xc4, 0x00, 0xd7, 0x00,
+  0xea, 0x00, 0xfe, 0x00, 0x12, 0x01, 0x26, 0x01, 0x3a, 0x01, 0x4e, 0x01,
+  0x61, 0x01, 0x74, 0x01, 0x88, 0x01, 0x9c, 0x01, 0xb0, 0x01, 0xc4, 0x01,
+  0xd8, 0x01, 0xec, 0x01, 0x00, 0x02, 0x11, 0x02, 0x25, 0x02, 0x37, 0x02,
+  0x00, 0x00, 0x0f, 0x00, 0x27, 0x00, 0x40, 0x00, 0x56, 0x00, 0x6f, 0x00,
+  0x7d, 0x00, 0x92, 0x00, 0xa6, 0x00, 0xbb, 0x00, 0x00, 0x00, 0x13, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x16, 0x00, 0x2c, 0x00, 0x42, 0x00, 0x58, 0x00,
+  0x6e, 0x00, 0x86, 0x00, 0x9c, 0x00, 0xb1, 0x00, 0xc0, 0x00, 0xcb, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x27, 0x00, 0x39, 0x00, 0x4f, 0x00,
+  0x64, 0x00, 0x75, 0x00, 0x87, 0x00, 0x9d, 0x00, 0xb3, 0x00, 0xc8, 0x00,
+  0xdb, 0x00, 0xed, 0x00, 0xfe, 0x00, 0x13, 0x01, 0x25, 0x01, 0x3a, 0x01,
+  0x4e, 0x01, 0x64, 0x01, 0x7a, 0x01, 0x90, 0x01, 0xa1, 0x01, 0xb7, 0x01,
+  0xc9, 0x01, 0xde, 0x01, 0xf3, 0x01, 0x09, 0x02, 0x1e, 0x02, 0x34, 0x02,
+  0x4a, 0x02, 0x5c, 0x02, 0x6e, 0x02, 0x83, 0x02, 0x97, 0x02, 0xac, 0x02,
+  0xbe, 0x02, 0xd3, 0x02, 0xe5, 0x02, 0xfa, 0x02, 0x0c, 0x03, 0x22, 0x03,
+  0x38, 0x03, 0x4e, 0x03, 0x60, 0x03, 0x72, 0x03, 0x87, 0x03, 0x99, 0x03,
+  0xaf, 0x03, 0xc5, 0x03, 0xda, 0x03, 0xec, 0x03, 0x02, 0x04, 0x17, 0x04,
+  0x2b, 0x04, 0x00, 0x00, 0x14, 0x00, 0x28, 0x00, 0x3c, 0x00, 0x50, 0x00,
+  0x63, 0x00, 0x77, 0x00, 0x8b, 0x00, 0x9f, 0x00, 0xb3, 0x00, 0xc6, 0x00,
+  0xda, 0x00, 0xee, 0x00, 0x02, 0x01, 0x16, 0x01, 0x2a, 0x01, 0x3e, 0x01,
+  0x52, 0x01, 0x65, 0x01, 0x79, 0x01, 0x8d, 0x01, 0xa0, 0x01, 0xb4, 0x01,
+  0xc8, 0x01, 0xdc, 0x01, 0xf0, 0x01, 0x00, 0x00, 0x09, 0x00, 0x1e, 0x00,
+  0x34, 0x00, 0x49, 0x00, 0x5e, 0x00, 0x76, 0x00, 0x8b, 0x00, 0x9a, 0x00,
+  0xa9, 0x00, 0xbf, 0x00, 0xd4, 0x00, 0xe9, 0x00, 0x02, 0x01, 0x18, 0x01,
+  0x2d, 0x01, 0x45, 0x01, 0x5a, 0x01, 0x6f, 0x01, 0x84, 0x01, 0x9c, 0x01,
+  0xb3, 0x01, 0xc9, 0x01, 0xe2, 0x01, 0xf8, 0x01, 0x0e, 0x02, 0x24, 0x02,
+  0x39, 0x02, 0x4e, 0x02, 0x64, 0x02, 0x7a, 0x02, 0x90, 0x02, 0xa5, 0x02,
+  0xbd, 0x02, 0xd2, 0x02, 0xe8, 0x02, 0xfe, 0x02, 0x14, 0x03, 0x2c, 0x03,
+  0x42, 0x03, 0x58, 0x03, 0x6e, 0x03, 0x84, 0x03, 0x9a, 0x03, 0xaf, 0x03,
+  0xc5, 0x03, 0xdb, 0x03, 0xf1, 0x03, 0x06, 0x04, 0x1b, 0x04, 0x31, 0x04,
+  0x47, 0x04, 0x5c, 0x04, 0x71, 0x04, 0x87, 0x04, 0x9d, 0x04, 0xb2, 0x04,
+  0xc7, 0x04, 0xdb, 0x04, 0xf1, 0x04, 0x06, 0x05, 0x00, 0x00, 0x18, 0x00,
+  0x33, 0x00, 0x4c, 0x00, 0x58, 0x00, 0x64, 0x00, 0x81, 0x00, 0x9d, 0x00,
+  0xb5, 0x00, 0xce, 0x00, 0xe7, 0x00, 0xff, 0x00, 0x18, 0x01, 0x30, 0x01,
+  0x48, 0x01, 0x5e, 0x01, 0x77, 0x01, 0x90, 0x01, 0xa9, 0x01, 0xc1, 0x01,
+  0xda, 0x01, 0xf3, 0x01, 0x0c, 0x02, 0x25, 0x02, 0x36, 0x02, 0x4f, 0x02,
+  0x61, 0x02, 0x7a, 0x02, 0x00, 0x00, 0x0c, 0x00, 0x20, 0x00, 0x34, 0x00,
+  0x4f, 0x00, 0x63, 0x00, 0x77, 0x00, 0x8b, 0x00, 0x9f, 0x00, 0xb8, 0x00,
+  0xcc, 0x00, 0xe6, 0x00, 0x00, 0x01, 0x14, 0x01, 0x27, 0x01, 0x42, 0x01,
+  0x5a, 0x01, 0x6e, 0x01, 0x89, 0x01, 0x9d, 0x01, 0xb8, 0x01, 0xd3, 0x01,
+  0xee, 0x01, 0x05, 0x02, 0x20, 0x02, 0x34, 0x02, 0x47, 0x02, 0x5b, 0x02,
+  0x70, 0x02, 0x7d, 0x02, 0x8a, 0x02, 0x9e, 0x02, 0xb2, 0x02, 0xcd, 0x02,
+  0xe0, 0x02, 0xf3, 0x02, 0x00, 0x00, 0x1d, 0x00, 0x39, 0x00, 0x4e, 0x00,
+  0x63, 0x00, 0x7f, 0x00, 0x9c, 0x00, 0xb8, 0x00, 0xd3, 0x00, 0xef, 0x00,
+  0x0c, 0x01, 0x28, 0x01, 0x3a, 0x01, 0x4f, 0x01, 0x61, 0x01, 0x73, 0x01,
+  0x8f, 0x01, 0xac, 0x01, 0xbd, 0x01, 0xd9, 0x01, 0xf1, 0x01, 0x02, 0x02,
+  0x1f, 0x02, 0x2e, 0x02, 0x4c, 0x02, 0x69, 0x02, 0x86, 0x02, 0x96, 0x02,
+  0xae, 0x02, 0xb9, 0x02, 0xd3, 0x02, 0xf0, 0x02, 0xfe, 0x02, 0x0c, 0x03,
+  0x1b, 0x03, 0x38, 0x03, 0x57, 0x03, 0x00, 0x00, 0x17, 0x00, 0x2f, 0x00,
+  0x47, 0x00, 0x5e, 0x00, 0x75, 0x00, 0x96, 0x00, 0xad, 0x00, 0xc5, 0x00,
+  0xdd, 0x00, 0xf5, 0x00, 0x0d, 0x01, 0x24, 0x01, 0x3c, 0x01, 0x53, 0x01,
+  0x6b, 0x01, 0x83, 0x01, 0x9a, 0x01, 0xb2, 0x01, 0xc9, 0x01, 0xe0, 0x01,
+  0xf7, 0x01, 0x0f, 0x02, 0x26, 0x02, 0x3e, 0x02, 0x56, 0x02, 0x6d, 0x02,
+  0x84, 0x02, 0x9b, 0x02, 0xb1, 0x02, 0xc8, 0x02, 0xe0, 0x02, 0xf4, 0x02,
+  0x0c, 0x03, 0x1f, 0x03, 0x36, 0x03, 0x4e, 0x03, 0x65, 0x03, 0x8b, 0x03,
+  0xa2, 0x03, 0xb9, 0x03, 0xd1, 0x03, 0xe9, 0x03, 0x01, 0x04, 0x18, 0x04,
+  0x31, 0x04, 0x49, 0x04, 0x60, 0x04, 0x77, 0x04, 0x8f, 0x04, 0xa6, 0x04,
+  0xbd, 0x04, 0xd5, 0x04, 0xed, 0x04, 0x04, 0x05, 0x1b, 0x05, 0x32, 0x05,
+  0x4a, 0x05, 0x61, 0x05, 0x79, 0x05, 0x91, 0x05, 0xa8, 0x05, 0xbf, 0x05,
+  0xd6, 0x05, 0xed, 0x05, 0x04, 0x06, 0x1b, 0x06, 0x33, 0x06, 0x4a, 0x06,
+  0x61, 0x06, 0x78, 0x06, 0x8f, 0x06, 0xa7, 0x06, 0xbf, 0x06, 0xd6, 0x06,
+  0xed, 0x06, 0x05, 0x07, 0x1d, 0x07, 0x35, 0x07, 0x4d, 0x07, 0x64, 0x07,
+  0x7c, 0x07, 0x8b, 0x07, 0xa3, 0x07, 0xbb, 0x07, 0xd1, 0x07, 0xe1, 0x07,
+  0xf3, 0x07, 0x0a, 0x08, 0x1e, 0x08, 0x36, 0x08, 0x4d, 0x08, 0x65, 0x08,
+  0x7c, 0x08, 0x94, 0x08, 0xac, 0x08, 0xc4, 0x08, 0xdc, 0x08, 0xf4, 0x08,
+  0x0c, 0x09, 0x23, 0x09, 0x3a, 0x09, 0x51, 0x09, 0x68, 0x09, 0x7f, 0x09,
+  0x96, 0x09, 0xad, 0x09, 0xc0, 0x09, 0xd8, 0x09, 0xef, 0x09, 0x05, 0x0a,
+  0x1c, 0x0a, 0x34, 0x0a, 0x4c, 0x0a, 0x63, 0x0a, 0x7b, 0x0a, 0x93, 0x0a,
+  0xab, 0x0a, 0xc3, 0x0a, 0xda, 0x0a, 0xf2, 0x0a, 0x08, 0x0b, 0x1f, 0x0b,
+  0x00, 0x00, 0x18, 0x00, 0x31, 0x00, 0x49, 0x00, 0x67, 0x00, 0x7f, 0x00,
+  0x97, 0x00, 0xaf, 0x00, 0xb9, 0x00, 0xd8, 0x00, 0xf0, 0x00, 0x08, 0x01,
+  0x1c, 0x01, 0x00, 0x00, 0x21, 0x00, 0x2e, 0x00, 0x3d, 0x00, 0x4b, 0x00,
+  0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x11, 0x00, 0x29, 0x00, 0x00, 0x00,
+  0x16, 0x00, 0x2b, 0x00, 0x41, 0x00, 0x56, 0x00, 0x6b, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x00, 0x00, 0x12, 0x00, 0x24, 0x00, 0x36, 0x00, 0x4d, 0x00,
+  0x5f, 0x00, 0x72, 0x00, 0x84, 0x00, 0x96, 0x00, 0xa3, 0x00, 0xcb, 0x00,
+  0x00, 0x00, 0x16, 0x00, 0x34, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x1f, 0x00,
+  0x38, 0x00, 0x43, 0x00, 0x54, 0x00, 0x68, 0x00, 0x79, 0x00, 0x91, 0x00,
+  0xa5, 0x00, 0xb9, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x20, 0x00, 0x30, 0x00,
+  0x44, 0x00, 0x58, 0x00, 0x00, 0x00, 0x12, 0x00, 0x24, 0x00, 0x36, 0x00,
+  0x47, 0x00, 0x52, 0x00, 0x64, 0x00, 0x7a, 0x00, 0x8c, 0x00, 0x9d, 0x00,
+  0xaf, 0x00, 0xc0, 0x00, 0xd2, 0x00, 0xe4, 0x00, 0xf6, 0x00, 0x08, 0x01,
+  0x1a, 0x01, 0x2c, 0x01, 0x00, 0x00, 0x0d, 0x00, 0x1a, 0x00, 0x27, 0x00,
+  0x3f, 0x00, 0x00, 0x00, 0x12, 0x00, 0x26, 0x00, 0x38, 0x00, 0x50, 0x00,
+  0x62, 0x00, 0x74, 0x00, 0x86, 0x00, 0x9c, 0x00, 0xae, 0x00, 0xc6, 0x00,
+  0xd8, 0x00, 0xea, 0x00, 0x00, 0x01, 0x12, 0x01, 0x27, 0x01, 0x40, 0x01,
+  0x52, 0x01, 0x6b, 0x01, 0x7c, 0x01, 0x95, 0x01, 0xa7, 0x01, 0xb9, 0x01,
+  0xcb, 0x01, 0xe4, 0x01, 0xf5, 0x01, 0x06, 0x02, 0x1f, 0x02, 0x00, 0x00,
+  0x11, 0x00, 0x22, 0x00, 0x3e, 0x00, 0x4f, 0x00, 0x62, 0x00, 0x76, 0x00,
+  0x8a, 0x00, 0xa4, 0x00, 0xb5, 0x00, 0xc4, 0x00, 0xd3, 0x00, 0xed, 0x00,
+  0xfd, 0x00, 0x0e, 0x01, 0x1f, 0x01, 0x2f, 0x01, 0x3f, 0x01, 0x53, 0x01,
+  0x6d, 0x01, 0x7f, 0x01, 0x9d, 0x01, 0xae, 0x01, 0xbd, 0x01, 0xce, 0x01,
+  0xdf, 0x01, 0xfa, 0x01, 0x0b, 0x02, 0x1c, 0x02, 0x00, 0x00, 0x1c, 0x00,
+  0x31, 0x00, 0x40, 0x00, 0x54, 0x00, 0x69, 0x00, 0x80, 0x00, 0x95, 0x00,
+  0xaa, 0x00, 0xbf, 0x00, 0xd4, 0x00, 0xe9, 0x00, 0xfe, 0x00, 0x14, 0x01,
+  0x29, 0x01, 0x3d, 0x01, 0x52, 0x01, 0x66, 0x01, 0x00, 0x00, 0x0c, 0x00,
+  0x24, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x3b, 0x00, 0x45, 0x00,
+  0x4f, 0x00, 0x00, 0x00, 0x11, 0x00, 0x22, 0x00, 0x34, 0x00, 0x45, 0x00,
+  0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x14, 0x00, 0x28, 0x00, 0x3c, 0x00,
+  0x4e, 0x00, 0x62, 0x00, 0x72, 0x00, 0x85, 0x00, 0x99, 0x00, 0xbb, 0x00,
+  0xcf, 0x00, 0x00, 0x00, 0x16, 0x00, 0x2c, 0x00, 0x41, 0x00, 0x57, 0x00,
+  0x6d, 0x00, 0x83, 0x00, 0x98, 0x00, 0xad, 0x00, 0xc1, 0x00, 0xd7, 0x00,
+  0xed, 0x00, 0x03, 0x01, 0x19, 0x01, 0x2f, 0x01, 0x45, 0x01, 0x5b, 0x01,
+  0x71, 0x01, 0x87, 0x01, 0x9d, 0x01, 0xb2, 0x01, 0xc8, 0x01, 0xde, 0x01,
+  0xf4, 0x01, 0x0a, 0x02, 0x1e, 0x02, 0x34, 0x02, 0x4a, 0x02, 0x60, 0x02,
+  0x76, 0x02, 0x8c, 0x02, 0xa2, 0x02, 0xb7, 0x02, 0xcc, 0x02, 0xe1, 0x02,
+  0xf7, 0x02, 0x0d, 0x03, 0x23, 0x03, 0x39, 0x03, 0x4f, 0x03, 0x64, 0x03,
+  0x79, 0x03, 0x8f, 0x03, 0xa6, 0x03, 0xbd, 0x03, 0xc7, 0x03, 0xdd, 0x03,
+  0xf3, 0x03, 0x09, 0x04, 0x1f, 0x04, 0x35, 0x04, 0x4b, 0x04, 0x61, 0x04,
+  0x77, 0x04, 0x8d, 0x04, 0xa2, 0x04, 0xb6, 0x04, 0xcc, 0x04, 0xe1, 0x04,
+  0xf6, 0x04, 0x0c, 0x05, 0x21, 0x05, 0x37, 0x05, 0x4d, 0x05, 0x62, 0x05,
+  0x00, 0x00, 0x14, 0x00, 0x27, 0x00, 0x00, 0x00, 0x17, 0x00, 0x22, 0x00,
+  0x37, 0x00, 0x4e, 0x00, 0x64, 0x00, 0x7a, 0x00, 0x91, 0x00, 0xa8, 0x00,
+  0xc4, 0x00, 0xce, 0x00, 0xe3, 0x00, 0xf1, 0x00, 0x08, 0x01, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0x16, 0x00, 0x2b, 0x00, 0x3f, 0x00, 0x56, 0x00,
+  0x6b, 0x00, 0x81, 0x00, 0x94, 0x00, 0xa9, 0x00, 0xbe, 0x00, 0xd3, 0x00,
+  0xe9, 0x00, 0xfe, 0x00, 0x14, 0x01, 0x2a, 0x01, 0x3f, 0x01, 0x55, 0x01,
+  0x67, 0x01, 0x79, 0x01, 0x8f, 0x01, 0xa3, 0x01, 0xb9, 0x01, 0xcf, 0x01,
+  0xe4, 0x01, 0xfa, 0x01, 0x0e, 0x02, 0x23, 0x02, 0x39, 0x02, 0x4f, 0x02,
+  0x65, 0x02, 0x7a, 0x02, 0x8e, 0x02, 0x00, 0x00, 0x13, 0x00, 0x27, 0x00,
+  0x3b, 0x00, 0x4e, 0x00, 0x62, 0x00, 0x76, 0x00, 0x8a, 0x00, 0x9e, 0x00,
+  0xb2, 0x00, 0xc6, 0x00, 0xda, 0x00, 0xee, 0x00, 0x02, 0x01, 0x16, 0x01,
+  0x29, 0x01, 0x3c, 0x01, 0x50, 0x01, 0x64, 0x01, 0x78, 0x01, 0x8b, 0x01,
+  0x9e, 0x01, 0xb1, 0x01, 0xc5, 0x01, 0x00, 0x00, 0x06, 0x00, 0x16, 0x00,
+  0x2c, 0x00, 0x42, 0x00, 0x58, 0x00, 0x6e, 0x00, 0x85, 0x00, 0x9b, 0x00,
+  0xb0, 0x00, 0xc6, 0x00, 0xdb, 0x00, 0xf0, 0x00, 0x06, 0x01, 0x1c, 0x01,
+  0x32, 0x01, 0x48, 0x01, 0x51, 0x01, 0x66, 0x01, 0x7b, 0x01, 0x91, 0x01,
+  0xa6, 0x01, 0xbb, 0x01, 0xd0, 0x01, 0xe6, 0x01, 0xfb, 0x01, 0x0f, 0x02,
+  0x25, 0x02, 0x3a, 0x02, 0x50, 0x02, 0x65, 0x02, 0x7b, 0x02, 0x91, 0x02,
+  0xa7, 0x02, 0xbd, 0x02, 0xd3, 0x02, 0xe9, 0x02, 0xfe, 0x02, 0x14, 0x03,
+  0x29, 0x03, 0x3f, 0x03, 0x55, 0x03, 0x6b, 0x03, 0x81, 0x03, 0x97, 0x03,
+  0xac, 0x03, 0xc1, 0x03, 0xd7, 0x03, 0xed, 0x03, 0x01, 0x04, 0x16, 0x04,
+  0x2c, 0x04, 0x35, 0x04, 0x4b, 0x04, 0x60, 0x04, 0x76, 0x04, 0x8b, 0x04,
+  0xa1, 0x04, 0xb7, 0x04, 0xcd, 0x04, 0xe2, 0x04, 0xf8, 0x04, 0x0d, 0x05,
+  0x21, 0x05, 0x00, 0x00, 0x1a, 0x00, 0x34, 0x00, 0x4d, 0x00, 0x66, 0x00,
+  0x80, 0x00, 0x9a, 0x00, 0xb5, 0x00, 0xcf, 0x00, 0xde, 0x00, 0xf8, 0x00,
+  0x13, 0x01, 0x2d, 0x01, 0x46, 0x01, 0x00, 0x00, 0x16, 0x00, 0x28, 0x00,
+  0x33, 0x00, 0x45, 0x00, 0x5a, 0x00, 0x73, 0x00, 0x89, 0x00, 0x00, 0x00,
+  0x17, 0x00, 0x2f, 0x00, 0x47, 0x00, 0x5f, 0x00, 0x77, 0x00, 0x95, 0x00,
+  0xad, 0x00, 0xc4, 0x00, 0xdd, 0x00, 0xf4, 0x00, 0x0c, 0x01, 0x23, 0x01,
+  0x3b, 0x01, 0x53, 0x01, 0x6a, 0x01, 0x80, 0x01, 0x98, 0x01, 0xaf, 0x01,
+  0xc6, 0x01, 0xde, 0x01, 0xf1, 0x01, 0x09, 0x02, 0x21, 0x02, 0x39, 0x02,
+  0x51, 0x02, 0x69, 0x02, 0x80, 0x02, 0x98, 0x02, 0xb0, 0x02, 0xc8, 0x02,
+  0xe0, 0x02, 0xf7, 0x02, 0x0b, 0x03, 0x23, 0x03, 0x3f, 0x03, 0x56, 0x03,
+  0x6e, 0x03, 0x85, 0x03, 0xa0, 0x03, 0xbb, 0x03, 0xcf, 0x03, 0xe3, 0x03,
+  0xfa, 0x03, 0x18, 0x04, 0x2f, 0x04, 0x47, 0x04, 0x62, 0x04, 0x7c, 0x04,
+  0x93, 0x04, 0xaa, 0x04, 0xc1, 0x04, 0xd9, 0x04, 0xf1, 0x04, 0x09, 0x05,
+  0x21, 0x05, 0x39, 0x05, 0x51, 0x05, 0x69, 0x05, 0x81, 0x05, 0x98, 0x05,
+  0xaf, 0x05, 0xc6, 0x05, 0xe0, 0x05, 0xf7, 0x05, 0x0e, 0x06, 0x25, 0x06,
+  0x3c, 0x06, 0x55, 0x06, 0x6c, 0x06, 0x84, 0x06, 0x9b, 0x06, 0xb9, 0x06,
+  0xd4, 0x06, 0xeb, 0x06, 0x05, 0x07, 0x19, 0x07, 0x31, 0x07, 0x48, 0x07,
+  0x60, 0x07, 0x7f, 0x07, 0x97, 0x07, 0xaf, 0x07, 0xc6, 0x07, 0xdd, 0x07,
+  0xf8, 0x07, 0x0f, 0x08, 0x27, 0x08, 0x3f, 0x08, 0x57, 0x08, 0x6f, 0x08,
+  0x82, 0x08, 0x9a, 0x08, 0xb2, 0x08, 0xca, 0x08, 0xde, 0x08, 0xf9, 0x08,
+  0x13, 0x09, 0x2a, 0x09, 0x42, 0x09, 0x5f, 0x09, 0x77, 0x09, 0x8f, 0x09,
+  0xac, 0x09, 0xc4, 0x09, 0xdb, 0x09, 0xf9, 0x09, 0x11, 0x0a, 0x29, 0x0a,
+  0x41, 0x0a, 0x59, 0x0a, 0x67, 0x0a, 0x82, 0x0a, 0x9a, 0x0a, 0xb2, 0x0a,
+  0xca, 0x0a, 0xe2, 0x0a, 0xf9, 0x0a, 0x10, 0x0b, 0x27, 0x0b, 0x45, 0x0b,
+  0x5d, 0x0b, 0x75, 0x0b, 0x8d, 0x0b, 0xa5, 0x0b, 0xbd, 0x0b, 0xd5, 0x0b,
+  0xf3, 0x0b, 0x07, 0x0c, 0x1e, 0x0c, 0x35, 0x0c, 0x4c, 0x0c, 0x63, 0x0c,
+  0x7a, 0x0c, 0x90, 0x0c, 0xa8, 0x0c, 0xc0, 0x0c, 0xd8, 0x0c, 0xef, 0x0c,
+  0x0a, 0x0d, 0x22, 0x0d, 0x39, 0x0d, 0x50, 0x0d, 0x68, 0x0d, 0x7f, 0x0d,
+  0x96, 0x0d, 0xae, 0x0d, 0xc5, 0x0d, 0xdc, 0x0d, 0xf3, 0x0d, 0x0a, 0x0e,
+  0x22, 0x0e, 0x2e, 0x0e, 0x3a, 0x0e, 0x52, 0x0e, 0x6d, 0x0e, 0x85, 0x0e,
+  0xa3, 0x0e, 0xc1, 0x0e, 0xd9, 0x0e, 0xf1, 0x0e, 0x06, 0x0f, 0x19, 0x0f,
+  0x31, 0x0f, 0x47, 0x0f, 0x5e, 0x0f, 0x76, 0x0f, 0x8e, 0x0f, 0xa6, 0x0f,
+  0xbe, 0x0f, 0xd2, 0x0f, 0xf0, 0x0f, 0x0b, 0x10, 0x23, 0x10, 0x3a, 0x10,
+  0x52, 0x10, 0x68, 0x10, 0x82, 0x10, 0x9a, 0x10, 0xb2, 0x10, 0xca, 0x10,
+  0xe2, 0x10, 0xfa, 0x10, 0x12, 0x11, 0x2a, 0x11, 0x42, 0x11, 0x5a, 0x11,
+  0x72, 0x11, 0x8a, 0x11, 0xa1, 0x11, 0xb9, 0x11, 0xd7, 0x11, 0xef, 0x11,
+  0x06, 0x12, 0x1d, 0x12, 0x3a, 0x12, 0x4d, 0x12, 0x65, 0x12, 0x7d, 0x12,
+  0x94, 0x12, 0xac, 0x12, 0xc4, 0x12, 0xdb, 0x12, 0xf3, 0x12, 0x07, 0x13,
+  0x1e, 0x13, 0x36, 0x13, 0x4d, 0x13, 0x65, 0x13, 0x76, 0x13, 0x8f, 0x13,
+  0xa6, 0x13, 0xbc, 0x13, 0xd3, 0x13, 0xeb, 0x13, 0x02, 0x14, 0x1a, 0x14,
+  0x32, 0x14, 0x4a, 0x14, 0x61, 0x14, 0x7d, 0x14, 0x95, 0x14, 0xad, 0x14,
+  0x00, 0x00, 0x15, 0x00, 0x29, 0x00, 0x45, 0x00, 0x59, 0x00, 0x72, 0x00,
+  0x87, 0x00, 0x9b, 0x00, 0xb1, 0x00, 0xc9, 0x00, 0xd4, 0x00, 0xe9, 0x00,
+  0xfe, 0x00, 0x13, 0x01, 0x2b, 0x01, 0x47, 0x01, 0x5d, 0x01, 0x00, 0x00,
+  0x05, 0x00, 0x13, 0x00, 0x2b, 0x00, 0x42, 0x00, 0x61, 0x00, 0x80, 0x00,
+  0x9f, 0x00, 0xbe, 0x00, 0xd5, 0x00, 0xf3, 0x00, 0x11, 0x01, 0x30, 0x01,
+  0x43, 0x01, 0x61, 0x01, 0x78, 0x01, 0x8a, 0x01, 0xa1, 0x01, 0xc0, 0x01,
+  0xdf, 0x01, 0xfd, 0x01, 0x1c, 0x02, 0x3c, 0x02, 0x5a, 0x02, 0x78, 0x02,
+  0x97, 0x02, 0xb6, 0x02, 0xcf, 0x02, 0xee, 0x02, 0xfd, 0x02, 0x1a, 0x03,
+  0x39, 0x03, 0x00, 0x00, 0x19, 0x00, 0x32, 0x00, 0x4b, 0x00, 0x61, 0x00,
+  0x73, 0x00, 0x00, 0x00, 0x14, 0x00, 0x32, 0x00, 0x4b, 0x00, 0x5a, 0x00,
+  0x69, 0x00, 0x76, 0x00, 0x86, 0x00, 0xa1, 0x00, 0xbb, 0x00, 0xd5, 0x00,
+  0xe3, 0x00, 0xfd, 0x00, 0x12, 0x01, 0x2c, 0x01, 0x38, 0x01, 0x47, 0x01,
+  0x60, 0x01, 0x00, 0x00, 0x1c, 0x00, 0x37, 0x00, 0x53, 0x00, 0x6f, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x28, 0x00, 0x37, 0x00, 0x50, 0x00, 0x62, 0x00,
+  0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x11, 0x00,
+  0x22, 0x00, 0x33, 0x00, 0x44, 0x00, 0x00, 0x00, 0x06, 0x00, 0x16, 0x00,
+  0x00, 0x00, 0x11, 0x00, 0x22, 0x00, 0x3b, 0x00, 0x4c, 0x00, 0x5d, 0x00,
+  0x6f, 0x00, 0x88, 0x00, 0x97, 0x00, 0xb0, 0x00, 0x00, 0x00, 0x14, 0x00,
+  0x28, 0x00, 0x3c, 0x00, 0x50, 0x00, 0x64, 0x00, 0x78, 0x00, 0x8c, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x23, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x1f, 0x00, 0x2e, 0x00, 0x3d, 0x00, 0x4c, 0x00, 0x5c, 0x00,
+  0x6c, 0x00, 0x7b, 0x00, 0x8d, 0x00, 0xa2, 0x00, 0xb1, 0x00, 0xbe, 0x00,
+  0xcd, 0x00, 0xdc, 0x00, 0xeb, 0x00, 0xfa, 0x00, 0x09, 0x01, 0x18, 0x01,
+  0x26, 0x01, 0x33, 0x01, 0x41, 0x01, 0x4f, 0x01, 0x5d, 0x01, 0x6f, 0x01,
+  0x7d, 0x01, 0x99, 0x01, 0xb4, 0x01, 0xc3, 0x01, 0x00, 0x00, 0x0d, 0x00,
+  0x21, 0x00, 0x3c, 0x00, 0x50, 0x00, 0x64, 0x00, 0x78, 0x00, 0x93, 0x00,
+  0xa0, 0x00, 0xad, 0x00, 0xc1, 0x00, 0xd5, 0x00, 0xea, 0x00, 0xfd, 0x00,
+  0x00, 0x00, 0x16, 0x00, 0x2b, 0x00, 0x3f, 0x00, 0x5b, 0x00, 0x7a, 0x00,
+  0x96, 0x00, 0xb2, 0x00, 0xc1, 0x00, 0xd0, 0x00, 0xed, 0x00, 0x00, 0x00,
+  0x17, 0x00, 0x2d, 0x00, 0x45, 0x00, 0x5c, 0x00, 0x74, 0x00, 0x8c, 0x00,
+  0xa4, 0x00, 0xbb, 0x00, 0xd3, 0x00, 0xeb, 0x00, 0x03, 0x01, 0x1b, 0x01,
+  0x32, 0x01, 0x49, 0x01, 0x60, 0x01, 0x78, 0x01, 0x8f, 0x01, 0xa7, 0x01,
+  0x00, 0x00, 0x08, 0x00, 0x17, 0x00, 0x25, 0x00, 0x34, 0x00, 0x42, 0x00,
+  0x51, 0x00, 0x60, 0x00, 0x6f, 0x00, 0x82, 0x00, 0x95, 0x00, 0xa4, 0x00,
+  0xb3, 0x00, 0xc5, 0x00, 0xd9, 0x00, 0xe8, 0x00, 0xf7, 0x00, 0x09, 0x01,
+  0x18, 0x01, 0x2d, 0x01, 0x42, 0x01, 0x51, 0x01, 0x60, 0x01, 0x6f, 0x01,
+  0x7e, 0x01, 0x8d, 0x01, 0x9c, 0x01, 0xb0, 0x01, 0xc4, 0x01, 0xd3, 0x01,
+  0xe2, 0x01, 0xf7, 0x01, 0x0c, 0x02, 0x18, 0x02, 0x27, 0x02, 0x46, 0x02,
+  0x55, 0x02, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x18, 0x00, 0x27, 0x00,
+  0x36, 0x00, 0x45, 0x00, 0x54, 0x00, 0x63, 0x00, 0x72, 0x00, 0x81, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x31, 0x00, 0x50, 0x00, 0x64, 0x00, 0x78, 0x00,
+  0x8c, 0x00, 0x9e, 0x00, 0xb2, 0x00, 0xc4, 0x00, 0xe1, 0x00, 0xfe, 0x00,
+  0x10, 0x01, 0x24, 0x01, 0x38, 0x01, 0x4c, 0x01, 0x65, 0x01, 0x00, 0x00,
+  0x12, 0x00, 0x27, 0x00, 0x3d, 0x00, 0x53, 0x00, 0x68, 0x00, 0x7d, 0x00,
+  0x8f, 0x00, 0xa5, 0x00, 0xc4, 0x00, 0xda, 0x00, 0xf0, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x21, 0x00, 0x37, 0x00, 0x4d, 0x00, 0x65, 0x00, 0x7b, 0x00,
+  0x91, 0x00, 0x9e, 0x00, 0xb4, 0x00, 0x00, 0x00, 0x16, 0x00, 0x28, 0x00,
+  0x3e, 0x00, 0x5a, 0x00, 0x6c, 0x00, 0x81, 0x00, 0x93, 0x00, 0xa5, 0x00,
+  0xbb, 0x00, 0xd1, 0x00, 0xe7, 0x00, 0xfd, 0x00, 0x0f, 0x01, 0x28, 0x01,
+  0x3e, 0x01, 0x50, 0x01, 0x62, 0x01, 0x00, 0x00, 0x12, 0x00, 0x24, 0x00,
+  0x36, 0x00, 0x47, 0x00, 0x59, 0x00, 0x6b, 0x00, 0x7d, 0x00, 0x8f, 0x00,
+  0xa0, 0x00, 0xb2, 0x00, 0xc4, 0x00, 0xd6, 0x00, 0xe8, 0x00, 0xfa, 0x00,
+  0x0c, 0x01, 0x1e, 0x01, 0x00, 0x00, 0x0a, 0x00, 0x1e, 0x00, 0x2f, 0x00,
+  0x3a, 0x00, 0x4e, 0x00, 0x5f, 0x00, 0x70, 0x00, 0x81, 0x00, 0x92, 0x00,
+  0x9f, 0x00, 0xb3, 0x00, 0xc4, 0x00, 0xd7, 0x00, 0xe4, 0x00, 0xf8, 0x00,
+  0x00, 0x00, 0x19, 0x00, 0x31, 0x00, 0x49, 0x00, 0x5b, 0x00, 0x73, 0x00,
+  0x84, 0x00, 0x00, 0x00, 0x11, 0x00, 0x22, 0x00, 0x00, 0x00, 0x1b, 0x00,
+  0x34, 0x00, 0x4c, 0x00, 0x69, 0x00, 0x81, 0x00, 0x99, 0x00, 0xb1, 0x00,
+  0xc2, 0x00, 0xdb, 0x00, 0xf3, 0x00, 0x0b, 0x01, 0x1d, 0x01, 0x00, 0x00,
+  0x0f, 0x00, 0x29, 0x00, 0x3f, 0x00, 0x5d, 0x00, 0x77, 0x00, 0x86, 0x00,
+  0xa1, 0x00, 0xb4, 0x00, 0xc3, 0x00, 0xd0, 0x00, 0x00, 0x00, 0x1f, 0x00,
+  0x3e, 0x00, 0x54, 0x00, 0x71, 0x00, 0x86, 0x00, 0xa3, 0x00, 0xc0, 0x00,
+  0xd5, 0x00, 0xeb, 0x00, 0x08, 0x01, 0x24, 0x01, 0x41, 0x01, 0x50, 0x01,
+  0x65, 0x01, 0x82, 0x01, 0x00, 0x00, 0x14, 0x00, 0x28, 0x00, 0x3d, 0x00,
+  0x52, 0x00, 0x64, 0x00, 0x78, 0x00, 0x8c, 0x00, 0xa0, 0x00, 0xb4, 0x00,
+  0xc8, 0x00, 0xdc, 0x00, 0xf0, 0x00, 0x04, 0x01, 0x00, 0x00, 0x0d, 0x00,
+  0x23, 0x00, 0x3f, 0x00, 0x5b, 0x00, 0x7e, 0x00, 0x93, 0x00, 0x00, 0x00,
+  0x1a, 0x00, 0x28, 0x00, 0x41, 0x00, 0x5c, 0x00, 0x6b, 0x00, 0x85, 0x00,
+  0x9f, 0x00, 0xad, 0x00, 0xc8, 0x00, 0xdc, 0x00, 0x00, 0x00, 0x16, 0x00,
+  0x32, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x3c, 0x00, 0x5b, 0x00,
+  0x00, 0x00, 0x16, 0x00, 0x2c, 0x00, 0x42, 0x00, 0x54, 0x00, 0x6a, 0x00,
+  0x80, 0x00, 0x96, 0x00, 0xab, 0x00, 0xc1, 0x00, 0xd7, 0x00, 0xed, 0x00,
+  0x03, 0x01, 0x19, 0x01, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x21, 0x00, 0x30, 0x00, 0x3b, 0x00, 0x4d, 0x00, 0x5a, 0x00,
+  0x00, 0x00, 0x13, 0x00, 0x25, 0x00, 0x37, 0x00, 0x48, 0x00, 0x60, 0x00,
+  0x74, 0x00, 0x87, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x1c, 0x00, 0x2b, 0x00,
+  0x41, 0x00, 0x50, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1e, 0x00, 0x2d, 0x00,
+  0x3c, 0x00, 0x4b, 0x00, 0x5a, 0x00, 0x69, 0x00, 0x77, 0x00, 0x86, 0x00,
+  0x94, 0x00, 0xa4, 0x00, 0xb3, 0x00, 0xbe, 0x00, 0xcd, 0x00, 0xdc, 0x00,
+  0xeb, 0x00, 0xf7, 0x00, 0x05, 0x01, 0x11, 0x01, 0x20, 0x01, 0x2c, 0x01,
+  0x3b, 0x01, 0x4b, 0x01, 0x5a, 0x01, 0x00, 0x00, 0x12, 0x00, 0x24, 0x00,
+  0x3c, 0x00, 0x52, 0x00, 0x64, 0x00, 0x7d, 0x00, 0x93, 0x00, 0xac, 0x00,
+  0xcf, 0x00, 0xe1, 0x00, 0xf3, 0x00, 0x0a, 0x01, 0x1f, 0x01, 0x30, 0x01,
+  0x42, 0x01, 0x54, 0x01, 0x00, 0x00, 0x16, 0x00, 0x30, 0x00, 0x44, 0x00,
+  0x53, 0x00, 0x6a, 0x00, 0x84, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x15, 0x00,
+  0x22, 0x00, 0x2d, 0x00, 0x42, 0x00, 0x58, 0x00, 0x6e, 0x00, 0x84, 0x00,
+  0x00, 0x00, 0x0f, 0x00, 0x1e, 0x00, 0x2d, 0x00, 0x3b, 0x00, 0x4a, 0x00,
+  0x59, 0x00, 0x68, 0x00, 0x77, 0x00, 0x86, 0x00, 0x95, 0x00, 0xa4, 0x00,
+  0xb3, 0x00, 0xc2, 0x00, 0xd1, 0x00, 0xe0, 0x00, 0xef, 0x00, 0xfe, 0x00,
+  0x16, 0x01, 0x24, 0x01, 0x33, 0x01, 0x42, 0x01, 0x51, 0x01, 0x5f, 0x01,
+  0x6e, 0x01, 0x7d, 0x01, 0x8c, 0x01, 0x9b, 0x01, 0x00, 0x00, 0x0d, 0x00,
+  0x1a, 0x00, 0x27, 0x00, 0x30, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x0f, 0x00,
+  0x1e, 0x00, 0x29, 0x00, 0x40, 0x00, 0x4f, 0x00, 0x5e, 0x00, 0x6d, 0x00,
+  0x7c, 0x00, 0x8b, 0x00, 0x9a, 0x00, 0xa9, 0x00, 0xb4, 0x00, 0xc3, 0x00,
+  0x00, 0x00, 0x13, 0x00, 0x27, 0x00, 0x3b, 0x00, 0x4f, 0x00, 0x63, 0x00,
+  0x77, 0x00, 0x8b, 0x00, 0x9f, 0x00, 0xb2, 0x00, 0xbb, 0x00, 0xcf, 0x00,
+  0xe4, 0x00, 0xf8, 0x00, 0x0c, 0x01, 0x20, 0x01, 0x34, 0x01, 0x00, 0x00,
+  0x15, 0x00, 0x34, 0x00, 0x50, 0x00, 0x5f, 0x00, 0x7e, 0x00, 0x9d, 0x00,
+  0xb3, 0x00, 0xd1, 0x00, 0xdf, 0x00, 0xf4, 0x00, 0x09, 0x01, 0x27, 0x01,
+  0x3d, 0x01, 0x4f, 0x01, 0x64, 0x01, 0x73, 0x01, 0x89, 0x01, 0x9f, 0x01,
+  0xbd, 0x01, 0x00, 0x00, 0x11, 0x00, 0x1c, 0x00, 0x2e, 0x00, 0x3d, 0x00,
+  0x55, 0x00, 0x63, 0x00, 0x75, 0x00, 0x87, 0x00, 0x98, 0x00, 0xaa, 0x00,
+  0xbc, 0x00, 0xce, 0x00, 0xdd, 0x00, 0xef, 0x00, 0x01, 0x01, 0x13, 0x01,
+  0x24, 0x01, 0x36, 0x01, 0x48, 0x01, 0x5a, 0x01, 0x6c, 0x01, 0x7e, 0x01,
+  0x90, 0x01, 0xa1, 0x01, 0xb2, 0x01, 0xc4, 0x01, 0xd6, 0x01, 0xe8, 0x01,
+  0xf4, 0x01, 0x05, 0x02, 0x17, 0x02, 0x29, 0x02, 0x38, 0x02, 0x49, 0x02,
+  0x5b, 0x02, 0x6d, 0x02, 0x7f, 0x02, 0x91, 0x02, 0xa4, 0x02, 0xb4, 0x02,
+  0xc7, 0x02, 0xe1, 0x02, 0xf3, 0x02, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00,
+  0x24, 0x00, 0x36, 0x00, 0x47, 0x00, 0x58, 0x00, 0x69, 0x00, 0x7b, 0x00,
+  0x8d, 0x00, 0x9e, 0x00, 0xb0, 0x00, 0xc1, 0x00, 0xd3, 0x00, 0xe4, 0x00,
+  0xf6, 0x00, 0x08, 0x01, 0x1a, 0x01, 0x2c, 0x01, 0x3e, 0x01, 0x50, 0x01,
+  0x61, 0x01, 0x72, 0x01, 0x83, 0x01, 0x95, 0x01, 0xa7, 0x01, 0xb9, 0x01,
+  0xcb, 0x01, 0xdd, 0x01, 0xef, 0x01, 0x01, 0x02, 0x12, 0x02, 0x24, 0x02,
+  0x35, 0x02, 0x47, 0x02, 0x59, 0x02, 0x6a, 0x02, 0x7c, 0x02, 0x8e, 0x02,
+  0xa0, 0x02, 0xb2, 0x02, 0xc3, 0x02, 0xd5, 0x02, 0xe7, 0x02, 0xf9, 0x02,
+  0x0b, 0x03, 0x1d, 0x03, 0x2e, 0x03, 0x40, 0x03, 0x51, 0x03, 0x63, 0x03,
+  0x75, 0x03, 0x87, 0x03, 0x99, 0x03, 0xab, 0x03, 0xbd, 0x03, 0xcf, 0x03,
+  0xe1, 0x03, 0xf3, 0x03, 0x05, 0x04, 0x17, 0x04, 0x29, 0x04, 0x3b, 0x04,
+  0x4d, 0x04, 0x5f, 0x04, 0x70, 0x04, 0x81, 0x04, 0x92, 0x04, 0xa4, 0x04,
+  0xb6, 0x04, 0xc8, 0x04, 0xd9, 0x04, 0xeb, 0x04, 0xfd, 0x04, 0x0f, 0x05,
+  0x21, 0x05, 0x33, 0x05, 0x45, 0x05, 0x54, 0x05, 0x66, 0x05, 0x78, 0x05,
+  0x00, 0x00, 0x05, 0x00, 0x19, 0x00, 0x2a, 0x00, 0x3c, 0x00, 0x4d, 0x00,
+  0x00, 0x00, 0x0f, 0x00, 0x27, 0x00, 0x42, 0x00, 0x51, 0x00, 0x61, 0x00,
+  0x70, 0x00, 0x7f, 0x00, 0x8f, 0x00, 0x00, 0x00, 0x13, 0x00, 0x26, 0x00,
+  0x39, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x2d, 0x00, 0x4e, 0x00, 0x00, 0x00,
+  0x1f, 0x00, 0x3e, 0x00, 0x5e, 0x00, 0x6b, 0x00, 0x83, 0x00, 0x95, 0x00,
+  0xa7, 0x00, 0xbd, 0x00, 0xd6, 0x00, 0xed, 0x00, 0xff, 0x00, 0x15, 0x01,
+  0x2a, 0x01, 0x37, 0x01, 0x4c, 0x01, 0x5f, 0x01, 0x75, 0x01, 0x89, 0x01,
+  0x95, 0x01, 0xaa, 0x01, 0xbf, 0x01, 0x00, 0x00, 0x1a, 0x00, 0x2e, 0x00,
+  0x49, 0x00, 0x65, 0x00, 0x80, 0x00, 0x91, 0x00, 0xab, 0x00, 0xc5, 0x00,
+  0xdf, 0x00, 0xfa, 0x00, 0x0e, 0x01, 0x29, 0x01, 0x44, 0x01, 0x58, 0x01,
+  0x71, 0x01, 0x85, 0x01, 0x98, 0x01, 0xac, 0x01, 0xc7, 0x01, 0xd4, 0x01,
+  0xe1, 0x01, 0xfc, 0x01, 0x16, 0x02, 0x28, 0x02, 0x3b, 0x02, 0x4a, 0x02,
+  0x5d, 0x02, 0x70, 0x02, 0x83, 0x02, 0x9d, 0x02, 0xb8, 0x02, 0xcc, 0x02,
+  0x00, 0x00, 0x1d, 0x00, 0x2f, 0x00, 0x48, 0x00, 0x64, 0x00, 0x7d, 0x00,
+  0x99, 0x00, 0xb2, 0x00, 0xce, 0x00, 0x00, 0x00, 0x14, 0x00, 0x2f, 0x00,
+  0x4a, 0x00, 0x65, 0x00, 0x72, 0x00, 0x7f, 0x00, 0x9a, 0x00, 0xb4, 0x00,
+  0xce, 0x00, 0x00, 0x00, 0x24, 0x00, 0x36, 0x00, 0x48, 0x00, 0x67, 0x00,
+  0x80, 0x00, 0x9c, 0x00, 0xb8, 0x00, 0xd3, 0x00, 0xef, 0x00, 0x0c, 0x01,
+  0x16, 0x01, 0x33, 0x01, 0x45, 0x01, 0x61, 0x01, 0x73, 0x01, 0x00, 0x00,
+  0x1e, 0x00, 0x3c, 0x00, 0x5b, 0x00, 0x79, 0x00, 0x00, 0x00, 0x0f, 0x00,
+  0x25, 0x00, 0x3b, 0x00, 0x51, 0x00, 0x67, 0x00, 0x7d, 0x00, 0x93, 0x00,
+  0xa8, 0x00, 0xbe, 0x00, 0xd4, 0x00, 0xe3, 0x00, 0xf2, 0x00, 0x01, 0x01,
+  0x17, 0x01, 0x2d, 0x01, 0x43, 0x01, 0x59, 0x01, 0x00, 0x00, 0x18, 0x00,
+  0x22, 0x00, 0x3a, 0x00, 0x51, 0x00, 0x5e, 0x00, 0x6b, 0x00, 0x82, 0x00,
+  0x93, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1e, 0x00, 0x2b, 0x00, 0x34, 0x00,
+  0x43, 0x00, 0x5f, 0x00, 0x7e, 0x00, 0x9c, 0x00, 0xba, 0x00, 0xd2, 0x00,
+  0xe9, 0x00, 0x00, 0x01, 0x15, 0x01, 0x2a, 0x01, 0x3a, 0x01, 0x44, 0x01,
+  0x53, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x18, 0x00, 0x00, 0x00, 0x1f, 0x00,
+  0x3e, 0x00, 0x49, 0x00, 0x58, 0x00, 0x70, 0x00, 0x7f, 0x00, 0x90, 0x00,
+  0x9b, 0x00, 0x00, 0x00, 0x10, 0x00, 0x21, 0x00, 0x34, 0x00, 0x44, 0x00,
+  0x54, 0x00, 0x6d, 0x00, 0x81, 0x00, 0x00, 0x00, 0x15, 0x00, 0x2b, 0x00,
+  0x49, 0x00, 0x58, 0x00, 0x67, 0x00, 0x76, 0x00, 0x90, 0x00, 0x9f, 0x00,
+  0xb5, 0x00, 0xc4, 0x00, 0xd3, 0x00, 0x00, 0x00, 0x12, 0x00, 0x25, 0x00,
+  0x37, 0x00, 0x49, 0x00, 0x54, 0x00, 0x65, 0x00, 0x77, 0x00, 0x8c, 0x00,
+  0xa1, 0x00, 0xb8, 0x00, 0xca, 0x00, 0xdc, 0x00, 0xed, 0x00, 0x05, 0x01,
+  0x1b, 0x01, 0x2d, 0x01, 0x3e, 0x01, 0x50, 0x01, 0x61, 0x01, 0x75, 0x01,
+  0x87, 0x01, 0x9c, 0x01, 0x00, 0x00, 0x1a, 0x00, 0x2e, 0x00, 0x42, 0x00,
+  0x56, 0x00, 0x6d, 0x00, 0x00, 0x00, 0x15, 0x00, 0x25, 0x00, 0x3a, 0x00,
+  0x4f, 0x00, 0x64, 0x00, 0x76, 0x00, 0x8c, 0x00, 0xa1, 0x00, 0xb7, 0x00,
+  0xcc, 0x00, 0xe2, 0x00, 0xf6, 0x00, 0x0a, 0x01, 0x15, 0x01, 0x2b, 0x01,
+  0x40, 0x01, 0x56, 0x01, 0x6b, 0x01, 0x80, 0x01, 0x95, 0x01, 0xab, 0x01,
+  0xc1, 0x01, 0xd7, 0x01, 0xed, 0x01, 0x03, 0x02, 0x1a, 0x02, 0x31, 0x02,
+  0x47, 0x02, 0x5d, 0x02, 0x72, 0x02, 0x86, 0x02, 0x96, 0x02, 0xac, 0x02,
+  0xc1, 0x02, 0xd6, 0x02, 0xe7, 0x02, 0x00, 0x00, 0x0c, 0x00, 0x24, 0x00,
+  0x41, 0x00, 0x4e, 0x00, 0x65, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x27, 0x00,
+  0x40, 0x00, 0x59, 0x00, 0x68, 0x00, 0x7e, 0x00, 0x97, 0x00, 0xa6, 0x00,
+  0xb5, 0x00, 0xc4, 0x00, 0xdd, 0x00, 0xf6, 0x00, 0x0e, 0x01, 0x27, 0x01,
+  0x00, 0x00, 0x1b, 0x00, 0x35, 0x00, 0x3d, 0x00, 0x45, 0x00, 0x00, 0x00,
+  0x19, 0x00, 0x32, 0x00, 0x3d, 0x00, 0x53, 0x00, 0x6c, 0x00, 0x00, 0x00,
+  0x19, 0x00, 0x2d, 0x00, 0x41, 0x00, 0x55, 0x00, 0x69, 0x00, 0x7d, 0x00,
+  0x9b, 0x00, 0xac, 0x00, 0xba, 0x00, 0xce, 0x00, 0xe1, 0x00, 0x00, 0x01,
+  0x12, 0x01, 0x26, 0x01, 0x3a, 0x01, 0x4e, 0x01, 0x6c, 0x01, 0x00, 0x00,
+  0x15, 0x00, 0x24, 0x00, 0x33, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x3e, 0x00,
+  0x49, 0x00, 0x00, 0x00, 0x12, 0x00, 0x24, 0x00, 0x3d, 0x00, 0x4f, 0x00,
+  0x61, 0x00, 0x70, 0x00, 0x86, 0x00, 0x98, 0x00, 0xaa, 0x00, 0xbc, 0x00,
+  0xcf, 0x00, 0xe8, 0x00, 0xfa, 0x00, 0x0c, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x17, 0x00, 0x21, 0x00, 0x37, 0x00, 0x4c, 0x00, 0x61, 0x00, 0x77, 0x00,
+  0x88, 0x00, 0x9c, 0x00, 0xb2, 0x00, 0xc7, 0x00, 0xdd, 0x00, 0xf3, 0x00,
+  0x08, 0x01, 0x1d, 0x01, 0x33, 0x01, 0x48, 0x01, 0x5e, 0x01, 0x74, 0x01,
+  0x89, 0x01, 0x9f, 0x01, 0xb4, 0x01, 0xca, 0x01, 0xe0, 0x01, 0xf6, 0x01,
+  0x0b, 0x02, 0x21, 0x02, 0x36, 0x02, 0x4b, 0x02, 0x61, 0x02, 0x77, 0x02,
+  0x8c, 0x02, 0xa2, 0x02, 0xb7, 0x02, 0xcd, 0x02, 0xe2, 0x02, 0xf8, 0x02,
+  0x0e, 0x03, 0x25, 0x03, 0x3a, 0x03, 0x45, 0x03, 0x5a, 0x03, 0x6f, 0x03,
+  0x00, 0x00, 0x14, 0x00, 0x28, 0x00, 0x3c, 0x00, 0x50, 0x00, 0x64, 0x00,
+  0x78, 0x00, 0x8a, 0x00, 0x9e, 0x00, 0xb2, 0x00, 0xc6, 0x00, 0xda, 0x00,
+  0xed, 0x00, 0x00, 0x01, 0x14, 0x01, 0x28, 0x01, 0x3c, 0x01, 0x50, 0x01,
+  0x64, 0x01, 0x78, 0x01, 0x8b, 0x01, 0x9e, 0x01, 0xb2, 0x01, 0xc6, 0x01,
+  0xd9, 0x01, 0xec, 0x01, 0x00, 0x02, 0x00, 0x00, 0x18, 0x00, 0x2f, 0x00,
+  0x44, 0x00, 0x5c, 0x00, 0x6e, 0x00, 0x84, 0x00, 0x9c, 0x00, 0xb3, 0x00,
+  0xc8, 0x00, 0xdf, 0x00, 0xf5, 0x00, 0x0b, 0x01, 0x23, 0x01, 0x3b, 0x01,
+  0x51, 0x01, 0x69, 0x01, 0x81, 0x01, 0x97, 0x01, 0xad, 0x01, 0xc2, 0x01,
+  0xda, 0x01, 0xf0, 0x01, 0x08, 0x02, 0x20, 0x02, 0x36, 0x02, 0x4e, 0x02,
+  0x66, 0x02, 0x7e, 0x02, 0x96, 0x02, 0xab, 0x02, 0xc3, 0x02, 0xd9, 0x02,
+  0xf0, 0x02, 0x06, 0x03, 0x1e, 0x03, 0x34, 0x03, 0x4a, 0x03, 0x62, 0x03,
+  0x7a, 0x03, 0x8f, 0x03, 0xa6, 0x03, 0xbe, 0x03, 0xd4, 0x03, 0xea, 0x03,
+  0x01, 0x04, 0x19, 0x04, 0x2f, 0x04, 0x3e, 0x04, 0x54, 0x04, 0x6c, 0x04,
+  0x81, 0x04, 0x97, 0x04, 0xac, 0x04, 0xc1, 0x04, 0xd8, 0x04, 0xee, 0x04,
+  0x00, 0x05, 0x17, 0x05, 0x2e, 0x05, 0x44, 0x05, 0x5c, 0x05, 0x74, 0x05,
+  0x8a, 0x05, 0xa2, 0x05, 0xba, 0x05, 0xd2, 0x05, 0xe8, 0x05, 0xfe, 0x05,
+  0x16, 0x06, 0x2e, 0x06, 0x46, 0x06, 0x5c, 0x06, 0x75, 0x06, 0x8d, 0x06,
+  0xa4, 0x06, 0xba, 0x06, 0xcf, 0x06, 0xe5, 0x06, 0xfc, 0x06, 0x14, 0x07,
+  0x2a, 0x07, 0x3f, 0x07, 0x55, 0x07, 0x6d, 0x07, 0x85, 0x07, 0x9d, 0x07,
+  0xb5, 0x07, 0xcc, 0x07, 0xe3, 0x07, 0xfb, 0x07, 0x12, 0x08, 0x29, 0x08,
+  0x3e, 0x08, 0x55, 0x08, 0x69, 0x08, 0x7e, 0x08, 0x94, 0x08, 0xac, 0x08,
+  0xc2, 0x08, 0xd6, 0x08, 0xec, 0x08, 0x02, 0x09, 0x17, 0x09, 0x2e, 0x09,
+  0x46, 0x09, 0x5e, 0x09, 0x00, 0x00, 0x10, 0x00, 0x20, 0x00, 0x30, 0x00,
+  0x00, 0x00, 0x1c, 0x00, 0x38, 0x00, 0x50, 0x00, 0x6d, 0x00, 0x88, 0x00,
+  0xa5, 0x00, 0xbc, 0x00, 0xd8, 0x00, 0xea, 0x00, 0xfc, 0x00, 0x0e, 0x01,
+  0x26, 0x01, 0x3e, 0x01, 0x50, 0x01, 0x6c, 0x01, 0x7e, 0x01, 0x9b, 0x01,
+  0xb8, 0x01, 0x00, 0x00, 0x13, 0x00, 0x27, 0x00, 0x3a, 0x00, 0x4e, 0x00,
+  0x65, 0x00, 0x79, 0x00, 0x8d, 0x00, 0xa1, 0x00, 0xbb, 0x00, 0xcf, 0x00,
+  0xe9, 0x00, 0xfc, 0x00, 0x17, 0x01, 0x2d, 0x01, 0x41, 0x01, 0x55, 0x01,
+  0x69, 0x01, 0x7c, 0x01, 0x90, 0x01, 0xab, 0x01, 0xbf, 0x01, 0xcb, 0x01,
+  0xdf, 0x01, 0xf3, 0x01, 0x07, 0x02, 0x1b, 0x02, 0x35, 0x02, 0x48, 0x02,
+  0x00, 0x00, 0x12, 0x00, 0x24, 0x00, 0x33, 0x00, 0x48, 0x00, 0x62, 0x00,
+  0x74, 0x00, 0x86, 0x00, 0x98, 0x00, 0xb0, 0x00, 0xc5, 0x00, 0xd7, 0x00,
+  0xe9, 0x00, 0x01, 0x01, 0x1b, 0x01, 0x2d, 0x01, 0x3f, 0x01, 0x51, 0x01,
+  0x00, 0x00, 0x14, 0x00, 0x2c, 0x00, 0x44, 0x00, 0x5d, 0x00, 0x75, 0x00,
+  0x8c, 0x00, 0xa3, 0x00, 0xba, 0x00, 0xd0, 0x00, 0xe7, 0x00, 0xfd, 0x00,
+  0x15, 0x01, 0x2d, 0x01, 0x45, 0x01, 0x5b, 0x01, 0x72, 0x01, 0x8a, 0x01,
+  0xa2, 0x01, 0xba, 0x01, 0xce, 0x01, 0xe6, 0x01, 0xfe, 0x01, 0x16, 0x02,
+  0x2e, 0x02, 0x46, 0x02, 0x5e, 0x02, 0x76, 0x02, 0x8e, 0x02, 0xa2, 0x02,
+  0xba, 0x02, 0xd2, 0x02, 0xe9, 0x02, 0x01, 0x03, 0x18, 0x03, 0x2f, 0x03,
+  0x47, 0x03, 0x5f, 0x03, 0x77, 0x03, 0x8f, 0x03, 0xa7, 0x03, 0xbf, 0x03,
+  0xd6, 0x03, 0xee, 0x03, 0x05, 0x04, 0x1d, 0x04, 0x35, 0x04, 0x4d, 0x04,
+  0x65, 0x04, 0x7d, 0x04, 0x95, 0x04, 0xac, 0x04, 0xc3, 0x04, 0xda, 0x04,
+  0xf1, 0x04, 0x07, 0x05, 0x1e, 0x05, 0x35, 0x05, 0x4d, 0x05, 0x66, 0x05,
+  0x7d, 0x05, 0x95, 0x05, 0xac, 0x05, 0xc4, 0x05, 0xdb, 0x05, 0xf3, 0x05,
+  0x0a, 0x06, 0x22, 0x06, 0x3a, 0x06, 0x51, 0x06, 0x69, 0x06, 0x81, 0x06,
+  0x99, 0x06, 0xb0, 0x06, 0xc8, 0x06, 0xdf, 0x06, 0xf7, 0x06, 0x0f, 0x07,
+  0x31, 0x07, 0x48, 0x07, 0x5f, 0x07, 0x76, 0x07, 0x8c, 0x07, 0xa4, 0x07,
+  0xbc, 0x07, 0xd4, 0x07, 0xec, 0x07, 0xff, 0x07, 0x11, 0x08, 0x29, 0x08,
+  0x41, 0x08, 0x59, 0x08, 0x70, 0x08, 0x86, 0x08, 0x9d, 0x08, 0xb4, 0x08,
+  0xcb, 0x08, 0xe3, 0x08, 0xfb, 0x08, 0x13, 0x09, 0x2b, 0x09, 0x43, 0x09,
+  0x5b, 0x09, 0x72, 0x09, 0x85, 0x09, 0x9c, 0x09, 0xb4, 0x09, 0xcc, 0x09,
+  0xe3, 0x09, 0xfb, 0x09, 0x13, 0x0a, 0x2b, 0x0a, 0x43, 0x0a, 0x5b, 0x0a,
+  0x73, 0x0a, 0x8b, 0x0a, 0xa2, 0x0a, 0xba, 0x0a, 0xce, 0x0a, 0xe5, 0x0a,
+  0xfc, 0x0a, 0x14, 0x0b, 0x2c, 0x0b, 0x44, 0x0b, 0x5c, 0x0b, 0x74, 0x0b,
+  0x8c, 0x0b, 0xa4, 0x0b, 0xbb, 0x0b, 0xd2, 0x0b, 0xe9, 0x0b, 0x01, 0x0c,
+  0x19, 0x0c, 0x31, 0x0c, 0x49, 0x0c, 0x61, 0x0c, 0x78, 0x0c, 0x8f, 0x0c,
+  0xa7, 0x0c, 0xbf, 0x0c, 0xd7, 0x0c, 0xef, 0x0c, 0x07, 0x0d, 0x1f, 0x0d,
+  0x36, 0x0d, 0x4e, 0x0d, 0x65, 0x0d, 0x7c, 0x0d, 0x9a, 0x0d, 0xb2, 0x0d,
+  0xc9, 0x0d, 0xe2, 0x0d, 0xf9, 0x0d, 0x0f, 0x0e, 0x26, 0x0e, 0x3d, 0x0e,
+  0x55, 0x0e, 0x69, 0x0e, 0x81, 0x0e, 0x95, 0x0e, 0xac, 0x0e, 0xc3, 0x0e,
+  0xda, 0x0e, 0xf2, 0x0e, 0x09, 0x0f, 0x21, 0x0f, 0x00, 0x00, 0x18, 0x00,
+  0x30, 0x00, 0x48, 0x00, 0x63, 0x00, 0x7d, 0x00, 0x8e, 0x00, 0xa5, 0x00,
+  0xbd, 0x00, 0xd5, 0x00, 0xed, 0x00, 0x05, 0x01, 0x1d, 0x01, 0x35, 0x01,
+  0x4d, 0x01, 0x65, 0x01, 0x7d, 0x01, 0x95, 0x01, 0xad, 0x01, 0xc9, 0x01,
+  0xe5, 0x01, 0xfd, 0x01, 0x15, 0x02, 0x2c, 0x02, 0x43, 0x02, 0x5b, 0x02,
+  0x73, 0x02, 0x81, 0x02, 0x99, 0x02, 0xa8, 0x02, 0xb6, 0x02, 0xcd, 0x02,
+  0xe4, 0x02, 0xfc, 0x02, 0x14, 0x03, 0x2c, 0x03, 0x44, 0x03, 0x5c, 0x03,
+  0x74, 0x03, 0x8d, 0x03, 0xa5, 0x03, 0xbc, 0x03, 0xce, 0x03, 0xe5, 0x03,
+  0xfd, 0x03, 0x15, 0x04, 0x2d, 0x04, 0x3c, 0x04, 0x4d, 0x04, 0x68, 0x04,
+  0x7f, 0x04, 0x97, 0x04, 0xae, 0x04, 0xbb, 0x04, 0xd2, 0x04, 0xee, 0x04,
+  0x06, 0x05, 0x18, 0x05, 0x33, 0x05, 0x4b, 0x05, 0x62, 0x05, 0x00, 0x00,
+  0x1a, 0x00, 0x33, 0x00, 0x46, 0x00, 0x5f, 0x00, 0x7a, 0x00, 0x87, 0x00,
+  0x93, 0x00, 0x00, 0x00, 0x19, 0x00, 0x31, 0x00, 0x42, 0x00, 0x51, 0x00,
+  0x62, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x39, 0x00, 0x00, 0x00, 0x15, 0x00,
+  0x27, 0x00, 0x39, 0x00, 0x4b, 0x00, 0x61, 0x00, 0x73, 0x00, 0x80, 0x00,
+  0x96, 0x00, 0xa6, 0x00, 0xb5, 0x00, 0xc6, 0x00, 0xdc, 0x00, 0xee, 0x00,
+  0x00, 0x00, 0x19, 0x00, 0x24, 0x00, 0x00, 0x00, 0x11, 0x00, 0x23, 0x00,
+  0x3c, 0x00, 0x4b, 0x00, 0x60, 0x00, 0x6f, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x24, 0x00, 0x35, 0x00, 0x46, 0x00, 0x00, 0x00, 0x12, 0x00, 0x2b, 0x00,
+  0x3d, 0x00, 0x56, 0x00, 0x65, 0x00, 0x77, 0x00, 0x8f, 0x00, 0xa8, 0x00,
+  0xba, 0x00, 0xd3, 0x00, 0xe6, 0x00, 0x00, 0x00, 0x10, 0x00, 0x20, 0x00,
+  0x2d, 0x00, 0x3d, 0x00, 0x48, 0x00, 0x58, 0x00, 0x6b, 0x00, 0x7b, 0x00,
+  0x8f, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x21, 0x00, 0x3a, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x1d, 0x00, 0x29, 0x00, 0x36, 0x00, 0x46, 0x00, 0x57, 0x00,
+  0x00, 0x00, 0x0b, 0x00, 0x24, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x2f, 0x00,
+  0x47, 0x00, 0x57, 0x00, 0x00, 0x00, 0x16, 0x00, 0x2b, 0x00, 0x3c, 0x00,
+  0x4e, 0x00, 0x62, 0x00, 0x74, 0x00, 0x8a, 0x00, 0x9f, 0x00, 0xb4, 0x00,
+  0xc6, 0x00, 0xdc, 0x00, 0xf1, 0x00, 0x03, 0x01, 0x19, 0x01, 0x2b, 0x01,
+  0x3d, 0x01, 0x52, 0x01, 0x67, 0x01, 0x7d, 0x01, 0x00, 0x00, 0x17, 0x00,
+  0x24, 0x00, 0x3b, 0x00, 0x57, 0x00, 0x75, 0x00, 0x00, 0x00, 0x11, 0x00,
+  0x23, 0x00, 0x3c, 0x00, 0x4e, 0x00, 0x60, 0x00, 0x72, 0x00, 0x83, 0x00,
+  0x95, 0x00, 0xa6, 0x00, 0xb7, 0x00, 0xcc, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x00, 0x00, 0x18, 0x00, 0x2b, 0x00, 0x4a, 0x00, 0x69, 0x00, 0x7b, 0x00,
+  0x00, 0x00, 0x14, 0x00, 0x28, 0x00, 0x3c, 0x00, 0x50, 0x00, 0x64, 0x00,
+  0x76, 0x00, 0x8a, 0x00, 0x9f, 0x00, 0xb3, 0x00, 0xc6, 0x00, 0x00, 0x00,
+  0x16, 0x00, 0x2b, 0x00, 0x41, 0x00, 0x52, 0x00, 0x68, 0x00, 0x75, 0x00,
+  0x87, 0x00, 0x9d, 0x00, 0xa6, 0x00, 0xbc, 0x00, 0xd2, 0x00, 0xe8, 0x00,
+  0xfe, 0x00, 0x14, 0x01, 0x2a, 0x01, 0x40, 0x01, 0x55, 0x01, 0x6b, 0x01,
+  0x83, 0x01, 0x9c, 0x01, 0xb5, 0x01, 0xca, 0x01, 0xdf, 0x01, 0xf5, 0x01,
+  0x0b, 0x02, 0x26, 0x02, 0x3b, 0x02, 0x46, 0x02, 0x5b, 0x02, 0x71, 0x02,
+  0x87, 0x02, 0x9d, 0x02, 0xb6, 0x02, 0xc4, 0x02, 0xda, 0x02, 0xf0, 0x02,
+  0x06, 0x03, 0x1c, 0x03, 0x32, 0x03, 0x48, 0x03, 0x5d, 0x03, 0x73, 0x03,
+  0x89, 0x03, 0x9e, 0x03, 0xb4, 0x03, 0xca, 0x03, 0xdf, 0x03, 0xf5, 0x03,
+  0x0a, 0x04, 0x1f, 0x04, 0x34, 0x04, 0x4d, 0x04, 0x63, 0x04, 0x79, 0x04,
+  0x8f, 0x04, 0xa5, 0x04, 0xc0, 0x04, 0xcb, 0x04, 0xe1, 0x04, 0xf8, 0x04,
+  0x0d, 0x05, 0x1e, 0x05, 0x37, 0x05, 0x4d, 0x05, 0x63, 0x05, 0x7f, 0x05,
+  0x95, 0x05, 0xab, 0x05, 0xc1, 0x05, 0xd6, 0x05, 0xf1, 0x05, 0x07, 0x06,
+  0x1c, 0x06, 0x32, 0x06, 0x46, 0x06, 0x5b, 0x06, 0x70, 0x06, 0x85, 0x06,
+  0x9b, 0x06, 0xb1, 0x06, 0x00, 0x00, 0x18, 0x00, 0x2a, 0x00, 0x41, 0x00,
+  0x00, 0x00, 0x14, 0x00, 0x27, 0x00, 0x3d, 0x00, 0x52, 0x00, 0x67, 0x00,
+  0x7d, 0x00, 0x94, 0x00, 0xaa, 0x00, 0xbc, 0x00, 0xd1, 0x00, 0xe6, 0x00,
+  0xf7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x33, 0x00, 0x3f, 0x00,
+  0x55, 0x00, 0x6b, 0x00, 0x80, 0x00, 0x96, 0x00, 0xac, 0x00, 0xc1, 0x00,
+  0xd6, 0x00, 0xec, 0x00, 0x01, 0x01, 0x17, 0x01, 0x2d, 0x01, 0x43, 0x01,
+  0x59, 0x01, 0x70, 0x01, 0x86, 0x01, 0x9c, 0x01, 0xb1, 0x01, 0xc7, 0x01,
+  0xe8, 0x01, 0xfe, 0x01, 0x09, 0x02, 0x1e, 0x02, 0x33, 0x02, 0x48, 0x02,
+  0x5e, 0x02, 0x00, 0x00, 0x13, 0x00, 0x26, 0x00, 0x3a, 0x00, 0x4e, 0x00,
+  0x62, 0x00, 0x6f, 0x00, 0x83, 0x00, 0x97, 0x00, 0xab, 0x00, 0xbf, 0x00,
+  0xd4, 0x00, 0xe8, 0x00, 0xfc, 0x00, 0x10, 0x01, 0x24, 0x01, 0x38, 0x01,
+  0x4b, 0x01, 0x5f, 0x01, 0x73, 0x01, 0x87, 0x01, 0x9b, 0x01, 0xaf, 0x01,
+  0xc3, 0x01, 0xd7, 0x01, 0xeb, 0x01, 0xff, 0x01, 0x12, 0x02, 0x26, 0x02,
+  0x00, 0x00, 0x16, 0x00, 0x2b, 0x00, 0x3a, 0x00, 0x4e, 0x00, 0x64, 0x00,
+  0x7a, 0x00, 0x8f, 0x00, 0xa5, 0x00, 0xba, 0x00, 0xcc, 0x00, 0xe3, 0x00,
+  0xf9, 0x00, 0x0e, 0x01, 0x24, 0x01, 0x39, 0x01, 0x4f, 0x01, 0x65, 0x01,
+  0x7b, 0x01, 0x91, 0x01, 0xa6, 0x01, 0xbb, 0x01, 0xd1, 0x01, 0xe7, 0x01,
+  0xfd, 0x01, 0x13, 0x02, 0x29, 0x02, 0x3f, 0x02, 0x55, 0x02, 0x6b, 0x02,
+  0x81, 0x02, 0x97, 0x02, 0xac, 0x02, 0xc2, 0x02, 0xd7, 0x02, 0xed, 0x02,
+  0x03, 0x03, 0x19, 0x03, 0x30, 0x03, 0x46, 0x03, 0x5b, 0x03, 0x71, 0x03,
+  0x87, 0x03, 0x9d, 0x03, 0xb3, 0x03, 0xc9, 0x03, 0xdf, 0x03, 0xf5, 0x03,
+  0x0a, 0x04, 0x1f, 0x04, 0x31, 0x04, 0x47, 0x04, 0x5d, 0x04, 0x73, 0x04,
+  0x89, 0x04, 0x9e, 0x04, 0xb3, 0x04, 0xc9, 0x04, 0xdf, 0x04, 0xf5, 0x04,
+  0x0b, 0x05, 0x21, 0x05, 0x37, 0x05, 0x4c, 0x05, 0x62, 0x05, 0x6e, 0x05,
+  0x7a, 0x05, 0x8f, 0x05, 0xa5, 0x05, 0xbb, 0x05, 0xd1, 0x05, 0xe7, 0x05,
+  0xfd, 0x05, 0x13, 0x06, 0x29, 0x06, 0x3f, 0x06, 0x00, 0x00, 0x1b, 0x00,
+  0x35, 0x00, 0x50, 0x00, 0x6b, 0x00, 0x86, 0x00, 0xa1, 0x00, 0xbd, 0x00,
+  0xd7, 0x00, 0xe1, 0x00, 0xeb, 0x00, 0xf5, 0x00, 0x10, 0x01, 0x2a, 0x01,
+  0x45, 0x01, 0x60, 0x01, 0x7b, 0x01, 0x95, 0x01, 0xaf, 0x01, 0xca, 0x01,
+  0xe3, 0x01, 0xfe, 0x01, 0x0f, 0x02, 0x1f, 0x02, 0x3a, 0x02, 0x54, 0x02,
+  0x6f, 0x02, 0x89, 0x02, 0xa4, 0x02, 0xbe, 0x02, 0xd8, 0x02, 0xf2, 0x02,
+  0x00, 0x00, 0x12, 0x00, 0x24, 0x00, 0x33, 0x00, 0x49, 0x00, 0x55, 0x00,
+  0x65, 0x00, 0x7b, 0x00, 0x92, 0x00, 0xa8, 0x00, 0xbe, 0x00, 0xca, 0x00,
+  0xdb, 0x00, 0xec, 0x00, 0x00, 0x00, 0x17, 0x00, 0x2f, 0x00, 0x47, 0x00,
+  0x5c, 0x00, 0x70, 0x00, 0x87, 0x00, 0x9e, 0x00, 0xb1, 0x00, 0xc8, 0x00,
+  0xdf, 0x00, 0xfa, 0x00, 0x11, 0x01, 0x28, 0x01, 0x3f, 0x01, 0x57, 0x01,
+  0x6d, 0x01, 0x84, 0x01, 0x98, 0x01, 0xb0, 0x01, 0xc7, 0x01, 0xde, 0x01,
+  0xf6, 0x01, 0x0e, 0x02, 0x26, 0x02, 0x41, 0x02, 0x5c, 0x02, 0x73, 0x02,
+  0x8a, 0x02, 0xa1, 0x02, 0xb8, 0x02, 0xd3, 0x02, 0xea, 0x02, 0x04, 0x03,
+  0x1c, 0x03, 0x32, 0x03, 0x48, 0x03, 0x63, 0x03, 0x7a, 0x03, 0x92, 0x03,
+  0xb1, 0x03, 0xc9, 0x03, 0xe8, 0x03, 0xfc, 0x03, 0x13, 0x04, 0x31, 0x04,
+  0x4c, 0x04, 0x64, 0x04, 0x78, 0x04, 0x8f, 0x04, 0xa7, 0x04, 0xbf, 0x04,
+  0xd7, 0x04, 0xee, 0x04, 0x0b, 0x05, 0x22, 0x05, 0x39, 0x05, 0x4f, 0x05,
+  0x66, 0x05, 0x7a, 0x05, 0x91, 0x05, 0xa8, 0x05, 0xbf, 0x05, 0xd6, 0x05,
+  0xee, 0x05, 0x06, 0x06, 0x1d, 0x06, 0x37, 0x06, 0x54, 0x06, 0x6b, 0x06,
+  0x82, 0x06, 0x99, 0x06, 0xb0, 0x06, 0xc7, 0x06, 0xde, 0x06, 0xf5, 0x06,
+  0x0d, 0x07, 0x24, 0x07, 0x3b, 0x07, 0x53, 0x07, 0x6a, 0x07, 0x81, 0x07,
+  0x95, 0x07, 0xad, 0x07, 0xc8, 0x07, 0xe0, 0x07, 0xf8, 0x07, 0x0c, 0x08,
+  0x23, 0x08, 0x39, 0x08, 0x51, 0x08, 0x5d, 0x08, 0x75, 0x08, 0x90, 0x08,
+  0xaa, 0x08, 0xc9, 0x08, 0xdd, 0x08, 0xf4, 0x08, 0x0c, 0x09, 0x24, 0x09,
+  0x3c, 0x09, 0x54, 0x09, 0x6f, 0x09, 0x89, 0x09, 0xa0, 0x09, 0xb4, 0x09,
+  0xcb, 0x09, 0xdf, 0x09, 0xf6, 0x09, 0x0d, 0x0a, 0x24, 0x0a, 0x3f, 0x0a,
+  0x58, 0x0a, 0x70, 0x0a, 0x87, 0x0a, 0x9e, 0x0a, 0xb6, 0x0a, 0xc9, 0x0a,
+  0xdd, 0x0a, 0xf5, 0x0a, 0x0b, 0x0b, 0x21, 0x0b, 0x35, 0x0b, 0x50, 0x0b,
+  0x6e, 0x0b, 0x89, 0x0b, 0xa0, 0x0b, 0xb3, 0x0b, 0xca, 0x0b, 0xe5, 0x0b,
+  0xfc, 0x0b, 0x14, 0x0c, 0x2c, 0x0c, 0x43, 0x0c, 0x61, 0x0c, 0x7f, 0x0c,
+  0x97, 0x0c, 0xab, 0x0c, 0xc3, 0x0c, 0xda, 0x0c, 0xf1, 0x0c, 0x04, 0x0d,
+  0x1b, 0x0d, 0x32, 0x0d, 0x4d, 0x0d, 0x63, 0x0d, 0x79, 0x0d, 0x90, 0x0d,
+  0xa7, 0x0d, 0xbe, 0x0d, 0xd6, 0x0d, 0xe3, 0x0d, 0xfe, 0x0d, 0x14, 0x0e,
+  0x27, 0x0e, 0x39, 0x0e, 0x4c, 0x0e, 0x60, 0x0e, 0x78, 0x0e, 0x92, 0x0e,
+  0xad, 0x0e, 0xc7, 0x0e, 0xe5, 0x0e, 0xfc, 0x0e, 0x13, 0x0f, 0x2a, 0x0f,
+  0x42, 0x0f, 0x59, 0x0f, 0x71, 0x0f, 0x89, 0x0f, 0xa1, 0x0f, 0xb8, 0x0f,
+  0xd0, 0x0f, 0x00, 0x00, 0x18, 0x00, 0x35, 0x00, 0x4c, 0x00, 0x64, 0x00,
+  0x73, 0x00, 0x8a, 0x00, 0x9c, 0x00, 0xac, 0x00, 0xc4, 0x00, 0xd3, 0x00,
+  0xe2, 0x00, 0xf9, 0x00, 0x11, 0x01, 0x28, 0x01, 0x40, 0x01, 0x58, 0x01,
+  0x67, 0x01, 0x79, 0x01, 0x92, 0x01, 0xaa, 0x01, 0xc2, 0x01, 0xd0, 0x01,
+  0xe8, 0x01, 0x01, 0x02, 0x11, 0x02, 0x29, 0x02, 0x38, 0x02, 0x50, 0x02,
+  0x6d, 0x02, 0x88, 0x02, 0x97, 0x02, 0xaf, 0x02, 0x00, 0x00, 0x1a, 0x00,
+  0x32, 0x00, 0x46, 0x00, 0x65, 0x00, 0x7b, 0x00, 0x95, 0x00, 0xac, 0x00,
+  0xc9, 0x00, 0xe1, 0x00, 0xf9, 0x00, 0x18, 0x01, 0x2c, 0x01, 0x43, 0x01,
+  0x56, 0x01, 0x6e, 0x01, 0x81, 0x01, 0x97, 0x01, 0xae, 0x01, 0xc6, 0x01,
+  0xde, 0x01, 0xf6, 0x01, 0x00, 0x00, 0x19, 0x00, 0x2b, 0x00, 0x3d, 0x00,
+  0x4f, 0x00, 0x61, 0x00, 0x75, 0x00, 0x87, 0x00, 0x9f, 0x00, 0xb1, 0x00,
+  0xca, 0x00, 0xe3, 0x00, 0xfb, 0x00, 0x13, 0x01, 0x33, 0x01, 0x47, 0x01,
+  0x5a, 0x01, 0x00, 0x00, 0x1a, 0x00, 0x34, 0x00, 0x4e, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x20, 0x00, 0x3d, 0x00, 0x4f, 0x00, 0x61, 0x00, 0x73, 0x00,
+  0x87, 0x00, 0x97, 0x00, 0xaf, 0x00, 0xbe, 0x00, 0xd9, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x28, 0x00, 0x43, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x2b, 0x00,
+  0x36, 0x00, 0x53, 0x00, 0x73, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x12, 0x00,
+  0x26, 0x00, 0x45, 0x00, 0x00, 0x00, 0x12, 0x00, 0x1c, 0x00, 0x29, 0x00,
+  0x39, 0x00, 0x49, 0x00, 0x59, 0x00, 0x6b, 0x00, 0x83, 0x00, 0x95, 0x00,
+  0xa6, 0x00, 0xb7, 0x00, 0xc9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x1c, 0x00, 0x29, 0x00, 0x33, 0x00, 0x45, 0x00, 0x57, 0x00, 0x69, 0x00,
+  0x82, 0x00, 0x00, 0x00, 0x11, 0x00, 0x21, 0x00, 0x35, 0x00, 0x45, 0x00,
+  0x52, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x22, 0x00, 0x3d, 0x00, 0x56, 0x00,
+  0x6f, 0x00, 0x79, 0x00, 0x8d, 0x00, 0x97, 0x00, 0x00, 0x00, 0x14, 0x00,
+  0x2e, 0x00, 0x3b, 0x00, 0x56, 0x00, 0x64, 0x00, 0x75, 0x00, 0x8e, 0x00,
+  0x99, 0x00, 0xb4, 0x00, 0xc5, 0x00, 0xdf, 0x00, 0xee, 0x00, 0xff, 0x00,
+  0x10, 0x01, 0x29, 0x01, 0x44, 0x01, 0x00, 0x00, 0x11, 0x00, 0x26, 0x00,
+  0x42, 0x00, 0x5e, 0x00, 0x73, 0x00, 0x8b, 0x00, 0x9f, 0x00, 0xae, 0x00,
+  0x00, 0x00, 0x14, 0x00, 0x1e, 0x00, 0x38, 0x00, 0x45, 0x00, 0x54, 0x00,
+  0x6e, 0x00, 0x7b, 0x00, 0x88, 0x00, 0x9c, 0x00, 0xa9, 0x00, 0xbd, 0x00,
+  0xd8, 0x00, 0xe9, 0x00, 0x07, 0x01, 0x00, 0x00, 0x12, 0x00, 0x24, 0x00,
+  0x40, 0x00, 0x52, 0x00, 0x64, 0x00, 0x76, 0x00, 0x88, 0x00, 0xa1, 0x00,
+  0xb6, 0x00, 0xdb, 0x00, 0xed, 0x00, 0xf7, 0x00, 0x09, 0x01, 0x20, 0x01,
+  0x3c, 0x01, 0x4e, 0x01, 0x00, 0x00, 0x17, 0x00, 0x2f, 0x00, 0x47, 0x00,
+  0x5e, 0x00, 0x76, 0x00, 0x8e, 0x00, 0xa5, 0x00, 0xbd, 0x00, 0xd5, 0x00,
+  0xed, 0x00, 0x05, 0x01, 0x1c, 0x01, 0x34, 0x01, 0x4c, 0x01, 0x59, 0x01,
+  0x71, 0x01, 0x89, 0x01, 0xa0, 0x01, 0xb7, 0x01, 0xcf, 0x01, 0xe7, 0x01,
+  0xfd, 0x01, 0x14, 0x02, 0x2b, 0x02, 0x38, 0x02, 0x50, 0x02, 0x68, 0x02,
+  0x80, 0x02, 0x97, 0x02, 0xae, 0x02, 0xc6, 0x02, 0x00, 0x00, 0x19, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x1e, 0x00, 0x2d, 0x00, 0x3e, 0x00, 0x4e, 0x00,
+  0x5e, 0x00, 0x6b, 0x00, 0x7c, 0x00, 0x89, 0x00, 0xa1, 0x00, 0xae, 0x00,
+  0xc6, 0x00, 0xd6, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x16, 0x00, 0x27, 0x00,
+  0x39, 0x00, 0x4b, 0x00, 0x5d, 0x00, 0x70, 0x00, 0x82, 0x00, 0x94, 0x00,
+  0xa6, 0x00, 0xb8, 0x00, 0xca, 0x00, 0xdc, 0x00, 0xee, 0x00, 0x00, 0x01,
+  0x12, 0x01, 0x2e, 0x01, 0x40, 0x01, 0x52, 0x01, 0x63, 0x01, 0x75, 0x01,
+  0x87, 0x01, 0xa3, 0x01, 0xb7, 0x01, 0xc9, 0x01, 0xdb, 0x01, 0xed, 0x01,
+  0xff, 0x01, 0x11, 0x02, 0x23, 0x02, 0x35, 0x02, 0x47, 0x02, 0x59, 0x02,
+  0x6b, 0x02, 0x7d, 0x02, 0x8f, 0x02, 0x00, 0x00, 0x09, 0x00, 0x24, 0x00,
+  0x3f, 0x00, 0x4f, 0x00, 0x6a, 0x00, 0x85, 0x00, 0xa0, 0x00, 0xbb, 0x00,
+  0xd6, 0x00, 0xe7, 0x00, 0x02, 0x01, 0x1d, 0x01, 0x38, 0x01, 0x53, 0x01,
+  0x6e, 0x01, 0x8a, 0x01, 0xa5, 0x01, 0xc0, 0x01, 0xdb, 0x01, 0xf5, 0x01,
+  0x0f, 0x02, 0x2a, 0x02, 0x3a, 0x02, 0x55, 0x02, 0x71, 0x02, 0x8c, 0x02,
+  0xa7, 0x02, 0xc2, 0x02, 0xd4, 0x02, 0xe6, 0x02, 0xf9, 0x02, 0x0a, 0x03,
+  0x25, 0x03, 0x00, 0x00, 0x0b, 0x00, 0x27, 0x00, 0x43, 0x00, 0x55, 0x00,
+  0x70, 0x00, 0x8c, 0x00, 0xa9, 0x00, 0xc6, 0x00, 0xe3, 0x00, 0xff, 0x00,
+  0x1c, 0x01, 0x38, 0x01, 0x54, 0x01, 0x71, 0x01, 0x8e, 0x01, 0xa6, 0x01,
+  0xc3, 0x01, 0xe0, 0x01, 0x00, 0x00, 0x1f, 0x00, 0x40, 0x00, 0x59, 0x00,
+  0x77, 0x00, 0x96, 0x00, 0xb4, 0x00, 0xd3, 0x00, 0xf2, 0x00, 0x0b, 0x01,
+  0x2a, 0x01, 0x00, 0x00, 0x16, 0x00, 0x2c, 0x00, 0x41, 0x00, 0x5f, 0x00,
+  0x75, 0x00, 0x8b, 0x00, 0xaa, 0x00, 0xbf, 0x00, 0xdb, 0x00, 0xf1, 0x00,
+  0x07, 0x01, 0x26, 0x01, 0x46, 0x01, 0x66, 0x01, 0x85, 0x01, 0x9a, 0x01,
+  0xbb, 0x01, 0xd1, 0x01, 0xe6, 0x01, 0xf7, 0x01, 0x0d, 0x02, 0x23, 0x02,
+  0x35, 0x02, 0x00, 0x00, 0x11, 0x00, 0x1e, 0x00, 0x2d, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x24, 0x00, 0x36, 0x00, 0x47, 0x00, 0x58, 0x00, 0x6a, 0x00,
+  0x7a, 0x00, 0x8c, 0x00, 0x9d, 0x00, 0xaf, 0x00, 0xc0, 0x00, 0xcb, 0x00,
+  0xdd, 0x00, 0xef, 0x00, 0x01, 0x01, 0x12, 0x01, 0x21, 0x01, 0x00, 0x00,
+  0x10, 0x00, 0x2e, 0x00, 0x42, 0x00, 0x59, 0x00, 0x66, 0x00, 0x77, 0x00,
+  0x96, 0x00, 0xae, 0x00, 0xcd, 0x00, 0xec, 0x00, 0x0a, 0x01, 0x29, 0x01,
+  0x42, 0x01, 0x61, 0x01, 0x7f, 0x01, 0x00, 0x00, 0x19, 0x00, 0x32, 0x00,
+  0x47, 0x00, 0x5f, 0x00, 0x7f, 0x00, 0x97, 0x00, 0xb3, 0x00, 0xcb, 0x00,
+  0xe4, 0x00, 0x03, 0x01, 0x22, 0x01, 0x42, 0x01, 0x5b, 0x01, 0x74, 0x01,
+  0x8d, 0x01, 0x9f, 0x01, 0xb8, 0x01, 0xc9, 0x01, 0xe7, 0x01, 0xff, 0x01,
+  0x18, 0x02, 0x00, 0x00, 0x0d, 0x00, 0x20, 0x00, 0x33, 0x00, 0x46, 0x00,
+  0x59, 0x00, 0x68, 0x00, 0x77, 0x00, 0x8a, 0x00, 0xa4, 0x00, 0xb5, 0x00,
+  0xc8, 0x00, 0x00, 0x00, 0x19, 0x00, 0x31, 0x00, 0x4a, 0x00, 0x61, 0x00,
+  0x7a, 0x00, 0x95, 0x00, 0xa9, 0x00, 0xc0, 0x00, 0xd8, 0x00, 0xf0, 0x00,
+  0x08, 0x01, 0x20, 0x01, 0x39, 0x01, 0x51, 0x01, 0x6a, 0x01, 0x83, 0x01,
+  0x9b, 0x01, 0xb3, 0x01, 0xcf, 0x01, 0xe8, 0x01, 0x01, 0x02, 0x19, 0x02,
+  0x30, 0x02, 0x48, 0x02, 0x61, 0x02, 0x00, 0x00, 0x18, 0x00, 0x32, 0x00,
+  0x3f, 0x00, 0x52, 0x00, 0x6c, 0x00, 0x86, 0x00, 0xa1, 0x00, 0xb4, 0x00,
+  0xc8, 0x00, 0xe3, 0x00, 0xf6, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x27, 0x00,
+  0x36, 0x00, 0x54, 0x00, 0x6d, 0x00, 0x7c, 0x00, 0x95, 0x00, 0xb4, 0x00,
+  0xd2, 0x00, 0xe1, 0x00, 0xef, 0x00, 0xfd, 0x00, 0x19, 0x01, 0x31, 0x01,
+  0x49, 0x01, 0x5e, 0x01, 0x76, 0x01, 0x88, 0x01, 0xa7, 0x01, 0xc0, 0x01,
+  0xd2, 0x01, 0xeb, 0x01, 0xfd, 0x01, 0x16, 0x02, 0x2e, 0x02, 0x3b, 0x02,
+  0x54, 0x02, 0x6d, 0x02, 0x86, 0x02, 0x9e, 0x02, 0xb6, 0x02, 0xd5, 0x02,
+  0x00, 0x00, 0x1f, 0x00, 0x41, 0x00, 0x61, 0x00, 0x82, 0x00, 0x99, 0x00,
+  0xbb, 0x00, 0xdc, 0x00, 0xfd, 0x00, 0x09, 0x01, 0x00, 0x00, 0x23, 0x00,
+  0x33, 0x00, 0x4b, 0x00, 0x6e, 0x00, 0x90, 0x00, 0xa9, 0x00, 0xc0, 0x00,
+  0xe5, 0x00, 0xf5, 0x00, 0x05, 0x01, 0x1e, 0x01, 0x37, 0x01, 0x59, 0x01,
+  0x7b, 0x01, 0x9d, 0x01, 0xc0, 0x01, 0xd6, 0x01, 0xee, 0x01, 0x00, 0x00,
+  0x0d, 0x00, 0x27, 0x00, 0x44, 0x00, 0x60, 0x00, 0x77, 0x00, 0x8e, 0x00,
+  0xa5, 0x00, 0xbc, 0x00, 0xd4, 0x00, 0xeb, 0x00, 0x02, 0x01, 0x0e, 0x01,
+  0x26, 0x01, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x15, 0x00, 0x2b, 0x00, 0x41, 0x00,
+  0x59, 0x00, 0x00, 0x00, 0x17, 0x00, 0x2f, 0x00, 0x46, 0x00, 0x5e, 0x00,
+  0x75, 0x00, 0x8c, 0x00, 0xa4, 0x00, 0xbb, 0x00, 0xd3, 0x00, 0xeb, 0x00,
+  0xff, 0x00, 0x00, 0x00, 0x12, 0x00, 0x24, 0x00, 0x36, 0x00, 0x41, 0x00,
+  0x00, 0x00, 0x11, 0x00, 0x24, 0x00, 0x37, 0x00, 0x4e, 0x00, 0x64, 0x00,
+  0x78, 0x00, 0x8c, 0x00, 0xa2, 0x00, 0xb6, 0x00, 0xbd, 0x00, 0xd4, 0x00,
+  0xec, 0x00, 0x00, 0x01, 0x18, 0x01, 0x29, 0x01, 0x40, 0x01, 0x57, 0x01,
+  0x6a, 0x01, 0x80, 0x01, 0x91, 0x01, 0x00, 0x00, 0x0f, 0x00, 0x1b, 0x00,
+  0x30, 0x00, 0x46, 0x00, 0x5b, 0x00, 0x70, 0x00, 0x86, 0x00, 0x9c, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x19, 0x00, 0x2a, 0x00, 0x3b, 0x00, 0x48, 0x00,
+  0x57, 0x00, 0x67, 0x00, 0x74, 0x00, 0x86, 0x00, 0x97, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x23, 0x00, 0x35, 0x00, 0x45, 0x00, 0x56, 0x00, 0x6f, 0x00,
+  0x80, 0x00, 0x92, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x27, 0x00, 0x42, 0x00,
+  0x5d, 0x00, 0x6a, 0x00, 0x77, 0x00, 0x8b, 0x00, 0x00, 0x00, 0x19, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x21, 0x00, 0x37, 0x00, 0x51, 0x00, 0x00, 0x00,
+  0x15, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x11, 0x00, 0x22, 0x00, 0x3a, 0x00,
+  0x52, 0x00, 0x6a, 0x00, 0x7b, 0x00, 0x91, 0x00, 0xa9, 0x00, 0xba, 0x00,
+  0xd1, 0x00, 0xe8, 0x00, 0xf9, 0x00, 0x11, 0x01, 0x1e, 0x01, 0x2f, 0x01,
+  0x3f, 0x01, 0x56, 0x01, 0x62, 0x01, 0x6f, 0x01, 0x86, 0x01, 0x9e, 0x01,
+  0xb6, 0x01, 0xce, 0x01, 0xe6, 0x01, 0xfd, 0x01, 0x0e, 0x02, 0x26, 0x02,
+  0x37, 0x02, 0x47, 0x02, 0x5e, 0x02, 0x75, 0x02, 0x8c, 0x02, 0xa4, 0x02,
+  0xbc, 0x02, 0x00, 0x00, 0x0f, 0x00, 0x28, 0x00, 0x41, 0x00, 0x4c, 0x00,
+  0x68, 0x00, 0x7a, 0x00, 0x93, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x37, 0x00,
+  0x51, 0x00, 0x6c, 0x00, 0x87, 0x00, 0x9a, 0x00, 0xad, 0x00, 0x00, 0x00,
+  0x16, 0x00, 0x2c, 0x00, 0x49, 0x00, 0x66, 0x00, 0x83, 0x00, 0xa0, 0x00,
+  0xbc, 0x00, 0xd9, 0x00, 0xf6, 0x00, 0x11, 0x01, 0x2c, 0x01, 0x48, 0x01,
+  0x64, 0x01, 0x81, 0x01, 0x9d, 0x01, 0xb9, 0x01, 0xd6, 0x01, 0xf3, 0x01,
+  0x10, 0x02, 0x2c, 0x02, 0x49, 0x02, 0x66, 0x02, 0x82, 0x02, 0x9e, 0x02,
+  0xbb, 0x02, 0xd8, 0x02, 0xf5, 0x02, 0x0b, 0x03, 0x28, 0x03, 0x45, 0x03,
+  0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x32, 0x00,
+  0x4a, 0x00, 0x65, 0x00, 0x74, 0x00, 0x8c, 0x00, 0xa3, 0x00, 0xbd, 0x00,
+  0xd7, 0x00, 0xf1, 0x00, 0x0c, 0x01, 0x28, 0x01, 0x43, 0x01, 0x5e, 0x01,
+  0x79, 0x01, 0x94, 0x01, 0xaf, 0x01, 0xca, 0x01, 0xe2, 0x01, 0xfe, 0x01,
+  0x19, 0x02, 0x34, 0x02, 0x4f, 0x02, 0x67, 0x02, 0x7f, 0x02, 0x9a, 0x02,
+  0xb3, 0x02, 0x00, 0x00, 0x1d, 0x00, 0x2f, 0x00, 0x4c, 0x00, 0x69, 0x00,
+  0x86, 0x00, 0x98, 0x00, 0xaa, 0x00, 0xbc, 0x00, 0xd9, 0x00, 0xeb, 0x00,
+  0xfc, 0x00, 0x19, 0x01, 0x36, 0x01, 0x54, 0x01, 0x66, 0x01, 0x83, 0x01,
+  0x95, 0x01, 0xa7, 0x01, 0xb8, 0x01, 0xca, 0x01, 0xdc, 0x01, 0xee, 0x01,
+  0x0b, 0x02, 0x1d, 0x02, 0x2f, 0x02, 0x41, 0x02, 0x53, 0x02, 0x65, 0x02,
+  0x77, 0x02, 0x89, 0x02, 0x9b, 0x02, 0xb7, 0x02, 0xd4, 0x02, 0xf1, 0x02,
+  0x0e, 0x03, 0x2a, 0x03, 0x47, 0x03, 0x64, 0x03, 0x81, 0x03, 0x9e, 0x03,
+  0xbb, 0x03, 0xd7, 0x03, 0xf4, 0x03, 0x10, 0x04, 0x2d, 0x04, 0x3f, 0x04,
+  0x4a, 0x04, 0x55, 0x04, 0x67, 0x04, 0x7a, 0x04, 0x8b, 0x04, 0x9d, 0x04,
+  0xae, 0x04, 0xc0, 0x04, 0xd2, 0x04, 0xef, 0x04, 0x01, 0x05, 0x1d, 0x05,
+  0x39, 0x05, 0x4a, 0x05, 0x5c, 0x05, 0x77, 0x05, 0x89, 0x05, 0x9b, 0x05,
+  0x00, 0x00, 0x0e, 0x00, 0x21, 0x00, 0x2f, 0x00, 0x49, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x24, 0x00, 0x35, 0x00, 0x4a, 0x00, 0x00, 0x00, 0x12, 0x00,
+  0x30, 0x00, 0x4e, 0x00, 0x6c, 0x00, 0x86, 0x00, 0x95, 0x00, 0xa8, 0x00,
+  0xbc, 0x00, 0xcc, 0x00, 0xe5, 0x00, 0x00, 0x01, 0x00, 0x00, 0x1c, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x2c, 0x00, 0x4b, 0x00, 0x57, 0x00, 0x00, 0x00,
+  0x19, 0x00, 0x30, 0x00, 0x49, 0x00, 0x63, 0x00, 0x7c, 0x00, 0x95, 0x00,
+  0xae, 0x00, 0xc5, 0x00, 0xde, 0x00, 0xf6, 0x00, 0x0a, 0x01, 0x23, 0x01,
+  0x3c, 0x01, 0x53, 0x01, 0x6c, 0x01, 0x85, 0x01, 0x9d, 0x01, 0xb5, 0x01,
+  0x00, 0x00, 0x1a, 0x00, 0x35, 0x00, 0x46, 0x00, 0x5e, 0x00, 0x6f, 0x00,
+  0x89, 0x00, 0xa4, 0x00, 0xbc, 0x00, 0xd4, 0x00, 0xf4, 0x00, 0x0f, 0x01,
+  0x2a, 0x01, 0x44, 0x01, 0x5e, 0x01, 0x78, 0x01, 0x93, 0x01, 0xa4, 0x01,
+  0xbf, 0x01, 0xd6, 0x01, 0xf8, 0x01, 0x13, 0x02, 0x2e, 0x02, 0x49, 0x02,
+  0x64, 0x02, 0x7c, 0x02, 0x94, 0x02, 0xab, 0x02, 0xc3, 0x02, 0xe3, 0x02,
+  0x05, 0x03, 0x1c, 0x03, 0x37, 0x03, 0x4f, 0x03, 0x70, 0x03, 0x8c, 0x03,
+  0xa7, 0x03, 0xc2, 0x03, 0xdd, 0x03, 0xf7, 0x03, 0x00, 0x00, 0x1c, 0x00,
+  0x37, 0x00, 0x53, 0x00, 0x64, 0x00, 0x74, 0x00, 0x90, 0x00, 0xa1, 0x00,
+  0xb2, 0x00, 0xc4, 0x00, 0xdf, 0x00, 0xfb, 0x00, 0x0c, 0x01, 0x1c, 0x01,
+  0x00, 0x00, 0x0d, 0x00, 0x28, 0x00, 0x43, 0x00, 0x5d, 0x00, 0x78, 0x00,
+  0x93, 0x00, 0xae, 0x00, 0xc9, 0x00, 0xe4, 0x00, 0xf1, 0x00, 0x0c, 0x01,
+  0x27, 0x01, 0x46, 0x01, 0x61, 0x01, 0x00, 0x00, 0x19, 0x00, 0x2b, 0x00,
+  0x3d, 0x00, 0x59, 0x00, 0x66, 0x00, 0x7e, 0x00, 0x90, 0x00, 0xa2, 0x00,
+  0xbe, 0x00, 0xd0, 0x00, 0xdd, 0x00, 0x00, 0x00, 0x12, 0x00, 0x22, 0x00,
+  0x33, 0x00, 0x44, 0x00, 0x55, 0x00, 0x65, 0x00, 0x76, 0x00, 0x84, 0x00,
+  0x94, 0x00, 0xa5, 0x00, 0x00, 0x00, 0x27, 0x00, 0x3d, 0x00, 0x59, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x18, 0x00, 0x2b, 0x00,
+  0x3f, 0x00, 0x52, 0x00, 0x61, 0x00, 0x75, 0x00, 0x8d, 0x00, 0xa1, 0x00,
+  0xb5, 0x00, 0xc9, 0x00, 0xdf, 0x00, 0xf4, 0x00, 0x07, 0x01, 0x1b, 0x01,
+  0x2e, 0x01, 0x41, 0x01, 0x54, 0x01, 0x6d, 0x01, 0x80, 0x01, 0x98, 0x01,
+  0xab, 0x01, 0xbe, 0x01, 0xd1, 0x01, 0xe6, 0x01, 0xfe, 0x01, 0x13, 0x02,
+  0x27, 0x02, 0x3b, 0x02, 0x4f, 0x02, 0x63, 0x02, 0x76, 0x02, 0x88, 0x02,
+  0x9e, 0x02, 0xb2, 0x02, 0xc5, 0x02, 0xd9, 0x02, 0xeb, 0x02, 0xfd, 0x02,
+  0x12, 0x03, 0x26, 0x03, 0x39, 0x03, 0x4c, 0x03, 0x5f, 0x03, 0x72, 0x03,
+  0x86, 0x03, 0x9a, 0x03, 0xae, 0x03, 0xc2, 0x03, 0xd6, 0x03, 0xea, 0x03,
+  0xfe, 0x03, 0x16, 0x04, 0x2a, 0x04, 0x3c, 0x04, 0x50, 0x04, 0x63, 0x04,
+  0x7b, 0x04, 0x8e, 0x04, 0x9f, 0x04, 0xb2, 0x04, 0xc9, 0x04, 0xdc, 0x04,
+  0xed, 0x04, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x16, 0x00, 0x2e, 0x00,
+  0x43, 0x00, 0x5a, 0x00, 0x70, 0x00, 0x7e, 0x00, 0x8a, 0x00, 0x97, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x24, 0x00, 0x3a, 0x00, 0x50, 0x00, 0x66, 0x00,
+  0x7b, 0x00, 0x90, 0x00, 0xa6, 0x00, 0xbc, 0x00, 0xd2, 0x00, 0xe7, 0x00,
+  0xfc, 0x00, 0x11, 0x01, 0x26, 0x01, 0x00, 0x00, 0x15, 0x00, 0x25, 0x00,
+  0x30, 0x00, 0x3d, 0x00, 0x48, 0x00, 0x55, 0x00, 0x63, 0x00, 0x70, 0x00,
+  0x00, 0x00, 0x0f, 0x00, 0x28, 0x00, 0x39, 0x00, 0x4f, 0x00, 0x62, 0x00,
+  0x75, 0x00, 0x87, 0x00, 0x99, 0x00, 0xaf, 0x00, 0xc0, 0x00, 0x00, 0x00,
+  0x15, 0x00, 0x26, 0x00, 0x37, 0x00, 0x46, 0x00, 0x56, 0x00, 0x67, 0x00,
+  0x78, 0x00, 0x89, 0x00, 0x9a, 0x00, 0xab, 0x00, 0xbc, 0x00, 0xd1, 0x00,
+  0xec, 0x00, 0xfd, 0x00, 0x0d, 0x01, 0x28, 0x01, 0x39, 0x01, 0x4a, 0x01,
+  0x5b, 0x01, 0x6c, 0x01, 0x00, 0x00, 0x11, 0x00, 0x22, 0x00, 0x34, 0x00,
+  0x46, 0x00, 0x57, 0x00, 0x69, 0x00, 0x7b, 0x00, 0x8d, 0x00, 0x9f, 0x00,
+  0xb1, 0x00, 0xc3, 0x00, 0xd5, 0x00, 0xe6, 0x00, 0xf8, 0x00, 0x0a, 0x01,
+  0x1c, 0x01, 0x2e, 0x01, 0x40, 0x01, 0x52, 0x01, 0x64, 0x01, 0x76, 0x01,
+  0x8a, 0x01, 0x9c, 0x01, 0xa6, 0x01, 0xb0, 0x01, 0xc2, 0x01, 0xd4, 0x01,
+  0xe8, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x23, 0x00, 0x2f, 0x00, 0x42, 0x00,
+  0x5b, 0x00, 0x6f, 0x00, 0x82, 0x00, 0x9a, 0x00, 0xb0, 0x00, 0xc7, 0x00,
+  0xdf, 0x00, 0xf3, 0x00, 0x0a, 0x01, 0x1d, 0x01, 0x31, 0x01, 0x47, 0x01,
+  0x5b, 0x01, 0x74, 0x01, 0x00, 0x00, 0x19, 0x00, 0x32, 0x00, 0x4a, 0x00,
+  0x62, 0x00, 0x7a, 0x00, 0x93, 0x00, 0xac, 0x00, 0xc5, 0x00, 0xde, 0x00,
+  0xf6, 0x00, 0x0f, 0x01, 0x27, 0x01, 0x36, 0x01, 0x4e, 0x01, 0x66, 0x01,
+  0x7e, 0x01, 0x97, 0x01, 0xb0, 0x01, 0xc9, 0x01, 0xd8, 0x01, 0xf0, 0x01,
+  0x08, 0x02, 0x21, 0x02, 0x00, 0x00, 0x14, 0x00, 0x2b, 0x00, 0x3a, 0x00,
+  0x4b, 0x00, 0x5b, 0x00, 0x6c, 0x00, 0x82, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x15, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x30, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x11, 0x00,
+  0x00, 0x00, 0x0f, 0x00, 0x26, 0x00, 0x3e, 0x00, 0x56, 0x00, 0x6d, 0x00,
+  0x85, 0x00, 0x9d, 0x00, 0xb4, 0x00, 0xcb, 0x00, 0xe2, 0x00, 0xfa, 0x00,
+  0x12, 0x01, 0x2a, 0x01, 0x42, 0x01, 0x59, 0x01, 0x71, 0x01, 0x89, 0x01,
+  0x00, 0x00, 0x12, 0x00, 0x23, 0x00, 0x35, 0x00, 0x47, 0x00, 0x52, 0x00,
+  0x5e, 0x00, 0x6f, 0x00, 0x80, 0x00, 0x92, 0x00, 0x00, 0x00, 0x13, 0x00,
+  0x27, 0x00, 0x3a, 0x00, 0x4e, 0x00, 0x62, 0x00, 0x75, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x1a, 0x00, 0x32, 0x00, 0x48, 0x00, 0x5e, 0x00, 0x74, 0x00,
+  0x8c, 0x00, 0xa5, 0x00, 0xbd, 0x00, 0xda, 0x00, 0xf0, 0x00, 0x05, 0x01,
+  0x1a, 0x01, 0x31, 0x01, 0x47, 0x01, 0x5d, 0x01, 0x73, 0x01, 0x8c, 0x01,
+  0xa2, 0x01, 0xbd, 0x01, 0xd3, 0x01, 0xe9, 0x01, 0xff, 0x01, 0x18, 0x02,
+  0x2d, 0x02, 0x3e, 0x02, 0x53, 0x02, 0x72, 0x02, 0x89, 0x02, 0xa2, 0x02,
+  0xbd, 0x02, 0xd2, 0x02, 0x00, 0x00, 0x12, 0x00, 0x26, 0x00, 0x3a, 0x00,
+  0x4d, 0x00, 0x62, 0x00, 0x75, 0x00, 0x89, 0x00, 0x9d, 0x00, 0xb1, 0x00,
+  0xc5, 0x00, 0xe3, 0x00, 0xf7, 0x00, 0x0b, 0x01, 0x1e, 0x01, 0x32, 0x01,
+  0x4a, 0x01, 0x64, 0x01, 0x78, 0x01, 0x90, 0x01, 0xa4, 0x01, 0xb8, 0x01,
+  0xd0, 0x01, 0xe8, 0x01, 0xfc, 0x01, 0x0f, 0x02, 0x23, 0x02, 0x34, 0x02,
+  0x4b, 0x02, 0x5c, 0x02, 0x70, 0x02, 0x88, 0x02, 0xa0, 0x02, 0xb4, 0x02,
+  0xc8, 0x02, 0x00, 0x00, 0x1b, 0x00, 0x32, 0x00, 0x44, 0x00, 0x5d, 0x00,
+  0x68, 0x00, 0x81, 0x00, 0x9a, 0x00, 0xb0, 0x00, 0xcb, 0x00, 0xe4, 0x00,
+  0xfb, 0x00, 0x14, 0x01, 0x31, 0x01, 0x4a, 0x01, 0x63, 0x01, 0x7c, 0x01,
+  0x98, 0x01, 0xb5, 0x01, 0xce, 0x01, 0xe6, 0x01, 0xff, 0x01, 0x17, 0x02,
+  0x00, 0x00, 0x14, 0x00, 0x2f, 0x00, 0x4a, 0x00, 0x59, 0x00, 0x6d, 0x00,
+  0x87, 0x00, 0xa2, 0x00, 0xb6, 0x00, 0xd0, 0x00, 0xea, 0x00, 0x07, 0x01,
+  0x00, 0x00, 0x1e, 0x00, 0x34, 0x00, 0x50, 0x00, 0x6f, 0x00, 0x8b, 0x00,
+  0xaa, 0x00, 0xc5, 0x00, 0xdb, 0x00, 0xfa, 0x00, 0x10, 0x01, 0x2e, 0x01,
+  0x4d, 0x01, 0x69, 0x01, 0x88, 0x01, 0xa7, 0x01, 0xc6, 0x01, 0xdb, 0x01,
+  0xf1, 0x01, 0x0c, 0x02, 0x21, 0x02, 0x3e, 0x02, 0x5d, 0x02, 0x73, 0x02,
+  0x88, 0x02, 0x9e, 0x02, 0xba, 0x02, 0xd5, 0x02, 0xf1, 0x02, 0x0f, 0x03,
+  0x24, 0x03, 0x39, 0x03, 0x53, 0x03, 0x69, 0x03, 0x7e, 0x03, 0x94, 0x03,
+  0xb3, 0x03, 0xc9, 0x03, 0xe5, 0x03, 0x01, 0x04, 0x1f, 0x04, 0x34, 0x04,
+  0x49, 0x04, 0x68, 0x04, 0x87, 0x04, 0xa6, 0x04, 0xc4, 0x04, 0x00, 0x00,
+  0x0f, 0x00, 0x27, 0x00, 0x3f, 0x00, 0x57, 0x00, 0x6f, 0x00, 0x86, 0x00,
+  0x9e, 0x00, 0xb5, 0x00, 0xcc, 0x00, 0xe4, 0x00, 0xfb, 0x00, 0x13, 0x01,
+  0x2a, 0x01, 0x41, 0x01, 0x59, 0x01, 0x71, 0x01, 0x89, 0x01, 0xa1, 0x01,
+  0xb8, 0x01, 0xd0, 0x01, 0xe8, 0x01, 0xff, 0x01, 0x17, 0x02, 0x2e, 0x02,
+  0x46, 0x02, 0x5d, 0x02, 0x75, 0x02, 0x8d, 0x02, 0xa5, 0x02, 0xbc, 0x02,
+  0x00, 0x00, 0x0f, 0x00, 0x1e, 0x00, 0x36, 0x00, 0x4e, 0x00, 0x66, 0x00,
+  0x7e, 0x00, 0x97, 0x00, 0xaf, 0x00, 0xc0, 0x00, 0xd0, 0x00, 0xe9, 0x00,
+  0x02, 0x01, 0x11, 0x01, 0x20, 0x01, 0x38, 0x01, 0x50, 0x01, 0x69, 0x01,
+  0x80, 0x01, 0x98, 0x01, 0xb0, 0x01, 0xc7, 0x01, 0xe0, 0x01, 0xf8, 0x01,
+  0x10, 0x02, 0x29, 0x02, 0x42, 0x02, 0x5a, 0x02, 0x73, 0x02, 0x8b, 0x02,
+  0xa3, 0x02, 0xbc, 0x02, 0xd5, 0x02, 0xe4, 0x02, 0xf3, 0x02, 0x0b, 0x03,
+  0x24, 0x03, 0x35, 0x03, 0x4e, 0x03, 0x67, 0x03, 0x7f, 0x03, 0x98, 0x03,
+  0xa7, 0x03, 0xc0, 0x03, 0xd8, 0x03, 0xf1, 0x03, 0x09, 0x04, 0x2c, 0x04,
+  0x44, 0x04, 0x53, 0x04, 0x6a, 0x04, 0x79, 0x04, 0x92, 0x04, 0xab, 0x04,
+  0xc4, 0x04, 0xdc, 0x04, 0xf5, 0x04, 0x00, 0x00, 0x1e, 0x00, 0x40, 0x00,
+  0x54, 0x00, 0x00, 0x00, 0x10, 0x00, 0x1b, 0x00, 0x33, 0x00, 0x52, 0x00,
+  0x6e, 0x00, 0x8a, 0x00, 0xa2, 0x00, 0xbe, 0x00, 0xd6, 0x00, 0xf1, 0x00,
+  0x09, 0x01, 0x18, 0x01, 0x29, 0x01, 0x41, 0x01, 0x59, 0x01, 0x78, 0x01,
+  0x9b, 0x01, 0xb8, 0x01, 0x00, 0x00, 0x14, 0x00, 0x24, 0x00, 0x4b, 0x00,
+  0x60, 0x00, 0x71, 0x00, 0x82, 0x00, 0x93, 0x00, 0x9f, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0b, 0x00, 0x37, 0x00, 0x44, 0x00, 0x5b, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x24, 0x00, 0x36, 0x00, 0x48, 0x00, 0x5a, 0x00, 0x6c, 0x00,
+  0x78, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1a, 0x00, 0x31, 0x00, 0x40, 0x00,
+  0x57, 0x00, 0x00, 0x00, 0x12, 0x00, 0x23, 0x00, 0x35, 0x00, 0x47, 0x00,
+  0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x17, 0x00, 0x2d, 0x00, 0x43, 0x00,
+  0x59, 0x00, 0x6f, 0x00, 0x85, 0x00, 0x9b, 0x00, 0xb3, 0x00, 0xd1, 0x00,
+  0xe3, 0x00, 0xfa, 0x00, 0x0f, 0x01, 0x25, 0x01, 0x3c, 0x01, 0x52, 0x01,
+  0x6a, 0x01, 0x80, 0x01, 0x96, 0x01, 0xaf, 0x01, 0xc5, 0x01, 0xdb, 0x01,
+  0xf3, 0x01, 0x08, 0x02, 0x1f, 0x02, 0x36, 0x02, 0x4f, 0x02, 0x65, 0x02,
+  0x7c, 0x02, 0x94, 0x02, 0xac, 0x02, 0xc2, 0x02, 0xd8, 0x02, 0xea, 0x02,
+  0xf4, 0x02, 0x0a, 0x03, 0x20, 0x03, 0x00, 0x00, 0x13, 0x00, 0x20, 0x00,
+  0x32, 0x00, 0x3f, 0x00, 0x4c, 0x00, 0x59, 0x00, 0x66, 0x00, 0x73, 0x00,
+  0x00, 0x00, 0x1c, 0x00, 0x35, 0x00, 0x4e, 0x00, 0x64, 0x00, 0x76, 0x00,
+  0x8f, 0x00, 0xa1, 0x00, 0xb3, 0x00, 0xc5, 0x00, 0xd6, 0x00, 0xe8, 0x00,
+  0x01, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x44, 0x01, 0x61, 0x01, 0x00, 0x00,
+  0x14, 0x00, 0x25, 0x00, 0x36, 0x00, 0x47, 0x00, 0x58, 0x00, 0x69, 0x00,
+  0x7d, 0x00, 0x8e, 0x00, 0x9f, 0x00, 0xb0, 0x00, 0xc3, 0x00, 0xdd, 0x00,
+  0xf7, 0x00, 0x11, 0x01, 0x26, 0x01, 0x3b, 0x01, 0x4c, 0x01, 0x67, 0x01,
+  0x78, 0x01, 0x89, 0x01, 0x98, 0x01, 0xa7, 0x01, 0xbb, 0x01, 0xcc, 0x01,
+  0xdd, 0x01, 0xf7, 0x01, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x19, 0x00, 0x2e, 0x00, 0x42, 0x00, 0x4e, 0x00, 0x5b, 0x00, 0x6f, 0x00,
+  0x00, 0x00, 0x16, 0x00, 0x36, 0x00, 0x4c, 0x00, 0x62, 0x00, 0x7d, 0x00,
+  0x95, 0x00, 0xb2, 0x00, 0xc8, 0x00, 0xde, 0x00, 0xf4, 0x00, 0x0a, 0x01,
+  0x26, 0x01, 0x3e, 0x01, 0x53, 0x01, 0x70, 0x01, 0x88, 0x01, 0x9e, 0x01,
+  0xbb, 0x01, 0xd4, 0x01, 0xf0, 0x01, 0x00, 0x00, 0x18, 0x00, 0x30, 0x00,
+  0x48, 0x00, 0x60, 0x00, 0x78, 0x00, 0x8f, 0x00, 0xa6, 0x00, 0xbd, 0x00,
+  0xd5, 0x00, 0xed, 0x00, 0x05, 0x01, 0x1d, 0x01, 0x35, 0x01, 0x4d, 0x01,
+  0x65, 0x01, 0x7d, 0x01, 0x95, 0x01, 0xad, 0x01, 0xc5, 0x01, 0xdd, 0x01,
+  0xf5, 0x01, 0x0d, 0x02, 0x25, 0x02, 0x3d, 0x02, 0x56, 0x02, 0x6e, 0x02,
+  0x86, 0x02, 0x9e, 0x02, 0xb6, 0x02, 0xce, 0x02, 0xe6, 0x02, 0xf5, 0x02,
+  0x0d, 0x03, 0x25, 0x03, 0x3d, 0x03, 0x55, 0x03, 0x6d, 0x03, 0x85, 0x03,
+  0x9d, 0x03, 0xb5, 0x03, 0xcd, 0x03, 0xe5, 0x03, 0xfd, 0x03, 0x15, 0x04,
+  0x2d, 0x04, 0x45, 0x04, 0x5d, 0x04, 0x75, 0x04, 0x8d, 0x04, 0xa5, 0x04,
+  0xbd, 0x04, 0xd5, 0x04, 0xed, 0x04, 0x05, 0x05, 0x1c, 0x05, 0x34, 0x05,
+  0x4c, 0x05, 0x64, 0x05, 0x7c, 0x05, 0x94, 0x05, 0xac, 0x05, 0xc4, 0x05,
+  0xdc, 0x05, 0xf4, 0x05, 0x0c, 0x06, 0x24, 0x06, 0x3c, 0x06, 0x54, 0x06,
+  0x6c, 0x06, 0x83, 0x06, 0x9b, 0x06, 0xb3, 0x06, 0xcb, 0x06, 0xe3, 0x06,
+  0xfb, 0x06, 0x13, 0x07, 0x2a, 0x07, 0x41, 0x07, 0x59, 0x07, 0x71, 0x07,
+  0x89, 0x07, 0xa1, 0x07, 0xb9, 0x07, 0xd1, 0x07, 0xe9, 0x07, 0x01, 0x08,
+  0x19, 0x08, 0x31, 0x08, 0x49, 0x08, 0x61, 0x08, 0x79, 0x08, 0x92, 0x08,
+  0xab, 0x08, 0xc4, 0x08, 0xdd, 0x08, 0xf5, 0x08, 0x0d, 0x09, 0x25, 0x09,
+  0x3d, 0x09, 0x55, 0x09, 0x6d, 0x09, 0x85, 0x09, 0x9d, 0x09, 0xb5, 0x09,
+  0xcd, 0x09, 0xe4, 0x09, 0xfc, 0x09, 0x14, 0x0a, 0x2b, 0x0a, 0x42, 0x0a,
+  0x59, 0x0a, 0x70, 0x0a, 0x88, 0x0a, 0xa0, 0x0a, 0xb8, 0x0a, 0xd1, 0x0a,
+  0xea, 0x0a, 0x03, 0x0b, 0x1c, 0x0b, 0x35, 0x0b, 0x4e, 0x0b, 0x67, 0x0b,
+  0x7f, 0x0b, 0x98, 0x0b, 0xb0, 0x0b, 0xc8, 0x0b, 0xe0, 0x0b, 0xf8, 0x0b,
+  0x09, 0x0c, 0x21, 0x0c, 0x39, 0x0c, 0x51, 0x0c, 0x69, 0x0c, 0x81, 0x0c,
+  0x99, 0x0c, 0xb0, 0x0c, 0xc8, 0x0c, 0xe0, 0x0c, 0xf8, 0x0c, 0x10, 0x0d,
+  0x28, 0x0d, 0x40, 0x0d, 0x58, 0x0d, 0x70, 0x0d, 0x87, 0x0d, 0x9f, 0x0d,
+  0xb7, 0x0d, 0xce, 0x0d, 0xe6, 0x0d, 0xfe, 0x0d, 0x16, 0x0e, 0x2e, 0x0e,
+  0x46, 0x0e, 0x5e, 0x0e, 0x76, 0x0e, 0x8e, 0x0e, 0xa6, 0x0e, 0xbd, 0x0e,
+  0xd5, 0x0e, 0xed, 0x0e, 0x04, 0x0f, 0x13, 0x0f, 0x22, 0x0f, 0x3a, 0x0f,
+  0x52, 0x0f, 0x6a, 0x0f, 0x82, 0x0f, 0x9a, 0x0f, 0xb2, 0x0f, 0xc9, 0x0f,
+  0xe0, 0x0f, 0xf6, 0x0f, 0x0d, 0x10, 0x24, 0x10, 0x3c, 0x10, 0x53, 0x10,
+  0x6b, 0x10, 0x83, 0x10, 0x9a, 0x10, 0xb1, 0x10, 0xc2, 0x10, 0xd9, 0x10,
+  0xf0, 0x10, 0x07, 0x11, 0x1e, 0x11, 0x36, 0x11, 0x4e, 0x11, 0x65, 0x11,
+  0x7c, 0x11, 0x93, 0x11, 0xab, 0x11, 0x00, 0x00, 0x0e, 0x00, 0x1f, 0x00,
+  0x3c, 0x00, 0x58, 0x00, 0x62, 0x00, 0x7f, 0x00, 0x9b, 0x00, 0xb8, 0x00,
+  0xd5, 0x00, 0xe0, 0x00, 0xfc, 0x00, 0x19, 0x01, 0x00, 0x00, 0x14, 0x00,
+  0x00, 0x00, 0x1a, 0x00, 0x2f, 0x00, 0x45, 0x00, 0x5a, 0x00, 0x6b, 0x00,
+  0x79, 0x00, 0x8f, 0x00, 0xa5, 0x00, 0xba, 0x00, 0xd0, 0x00, 0xe6, 0x00,
+  0x02, 0x01, 0x0d, 0x01, 0x18, 0x01, 0x2d, 0x01, 0x00, 0x00, 0x10, 0x00,
+  0x00, 0x00, 0x1b, 0x00, 0x2b, 0x00, 0x4f, 0x00, 0x59, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x22, 0x00, 0x34, 0x00, 0x46, 0x00, 0x5f, 0x00,
+  0x78, 0x00, 0x00, 0x00, 0x06, 0x00, 0x1a, 0x00, 0x2e, 0x00, 0x35, 0x00,
+  0x3c, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1d, 0x00, 0x33, 0x00, 0x45, 0x00,
+  0x5b, 0x00, 0x6c, 0x00, 0x7d, 0x00, 0x93, 0x00, 0xa9, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x27, 0x00, 0x3f, 0x00, 0x53, 0x00, 0x6b, 0x00, 0x82, 0x00,
+  0x96, 0x00, 0xab, 0x00, 0xc3, 0x00, 0xdb, 0x00, 0xef, 0x00, 0x07, 0x01,
+  0x22, 0x01, 0x3a, 0x01, 0x52, 0x01, 0x66, 0x01, 0x7a, 0x01, 0x92, 0x01,
+  0xa6, 0x01, 0xba, 0x01, 0xd2, 0x01, 0xe6, 0x01, 0xfd, 0x01, 0x10, 0x02,
+  0x24, 0x02, 0x38, 0x02, 0x4b, 0x02, 0x5f, 0x02, 0x73, 0x02, 0x87, 0x02,
+  0x9e, 0x02, 0xb5, 0x02, 0xc9, 0x02, 0xe0, 0x02, 0xf2, 0x02, 0x06, 0x03,
+  0x1a, 0x03, 0x31, 0x03, 0x49, 0x03, 0x63, 0x03, 0x77, 0x03, 0x8b, 0x03,
+  0x9f, 0x03, 0xb4, 0x03, 0xc8, 0x03, 0xdc, 0x03, 0xf4, 0x03, 0x0f, 0x04,
+  0x21, 0x04, 0x35, 0x04, 0x4d, 0x04, 0x64, 0x04, 0x7d, 0x04, 0x94, 0x04,
+  0xa8, 0x04, 0xbb, 0x04, 0xd5, 0x04, 0xe9, 0x04, 0x00, 0x05, 0x18, 0x05,
+  0x2c, 0x05, 0x40, 0x05, 0x53, 0x05, 0x67, 0x05, 0x7b, 0x05, 0x8e, 0x05,
+  0xa2, 0x05, 0xb7, 0x05, 0xca, 0x05, 0xe2, 0x05, 0xf6, 0x05, 0x0a, 0x06,
+  0x00, 0x00, 0x12, 0x00, 0x27, 0x00, 0x39, 0x00, 0x4b, 0x00, 0x5c, 0x00,
+  0x78, 0x00, 0x00, 0x00, 0x14, 0x00, 0x27, 0x00, 0x40, 0x00, 0x4e, 0x00,
+  0x62, 0x00, 0x6d, 0x00, 0x7e, 0x00, 0x98, 0x00, 0xb3, 0x00, 0xc6, 0x00,
+  0xd4, 0x00, 0xe5, 0x00, 0xf7, 0x00, 0x11, 0x01, 0x00, 0x00, 0x19, 0x00,
+  0x30, 0x00, 0x3b, 0x00, 0x53, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x22, 0x00,
+  0x30, 0x00, 0x40, 0x00, 0x4d, 0x00, 0x5b, 0x00, 0x71, 0x00, 0x84, 0x00,
+  0x9b, 0x00, 0xa5, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x39, 0x00, 0x52, 0x00,
+  0x6b, 0x00, 0x84, 0x00, 0x93, 0x00, 0xac, 0x00, 0xc5, 0x00, 0xe4, 0x00,
+  0xfd, 0x00, 0x16, 0x01, 0x2e, 0x01, 0x4d, 0x01, 0x65, 0x01, 0x7e, 0x01,
+  0x9d, 0x01, 0xb5, 0x01, 0xcd, 0x01, 0xe6, 0x01, 0xff, 0x01, 0x18, 0x02,
+  0x30, 0x02, 0x49, 0x02, 0x62, 0x02, 0x7e, 0x02, 0x96, 0x02, 0xaf, 0x02,
+  0xcd, 0x02, 0xe5, 0x02, 0x00, 0x03, 0x18, 0x03, 0x31, 0x03, 0x50, 0x03,
+  0x68, 0x03, 0x7d, 0x03, 0x95, 0x03, 0xae, 0x03, 0xc7, 0x03, 0xe0, 0x03,
+  0x00, 0x00, 0x19, 0x00, 0x31, 0x00, 0x42, 0x00, 0x5c, 0x00, 0x7b, 0x00,
+  0x95, 0x00, 0xae, 0x00, 0xc7, 0x00, 0xe1, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x1c, 0x00, 0x3c, 0x00, 0x58, 0x00, 0x70, 0x00, 0x8b, 0x00, 0xa0, 0x00,
+  0xbc, 0x00, 0xd7, 0x00, 0xe6, 0x00, 0xf6, 0x00, 0x11, 0x01, 0x00, 0x00,
+  0x0f, 0x00, 0x1e, 0x00, 0x2f, 0x00, 0x3e, 0x00, 0x4c, 0x00, 0x5a, 0x00,
+  0x69, 0x00, 0x78, 0x00, 0x88, 0x00, 0xa6, 0x00, 0x00, 0x00, 0x1d, 0x00,
+  0x41, 0x00, 0x60, 0x00, 0x71, 0x00, 0x00, 0x00, 0x15, 0x00, 0x25, 0x00,
+  0x46, 0x00, 0x00, 0x00, 0x10, 0x00, 0x2d, 0x00, 0x3e, 0x00, 0x61, 0x00,
+  0x72, 0x00, 0x83, 0x00, 0x94, 0x00, 0xb0, 0x00, 0xc2, 0x00, 0xd3, 0x00,
+  0xe4, 0x00, 0xf5, 0x00, 0x17, 0x01, 0x28, 0x01, 0x3a, 0x01, 0x4d, 0x01,
+  0x5d, 0x01, 0x6d, 0x01, 0x7f, 0x01, 0x8f, 0x01, 0xa0, 0x01, 0xb1, 0x01,
+  0xc2, 0x01, 0xd3, 0x01, 0xf0, 0x01, 0x01, 0x02, 0x00, 0x00, 0x09, 0x00,
+  0x1b, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x34, 0x00, 0x46, 0x00, 0x5e, 0x00,
+  0x77, 0x00, 0x8f, 0x00, 0xa0, 0x00, 0xb8, 0x00, 0x00, 0x00, 0x05, 0x00,
+  0x19, 0x00, 0x29, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x15, 0x00, 0x2a, 0x00,
+  0x40, 0x00, 0x55, 0x00, 0x6b, 0x00, 0x83, 0x00, 0x99, 0x00, 0xaf, 0x00,
+  0xc5, 0x00, 0xdb, 0x00, 0xf1, 0x00, 0x06, 0x01, 0x1c, 0x01, 0x31, 0x01,
+  0x46, 0x01, 0x5b, 0x01, 0x00, 0x00, 0x07, 0x00, 0x14, 0x00, 0x2c, 0x00,
+  0x39, 0x00, 0x51, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x26, 0x00, 0x35, 0x00,
+  0x43, 0x00, 0x52, 0x00, 0x61, 0x00, 0x70, 0x00, 0x7e, 0x00, 0x96, 0x00,
+  0xa5, 0x00, 0xb4, 0x00, 0xc3, 0x00, 0xd1, 0x00, 0xde, 0x00, 0xed, 0x00,
+  0xfd, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x20, 0x00, 0x00, 0x00, 0x16, 0x00,
+  0x24, 0x00, 0x3a, 0x00, 0x48, 0x00, 0x57, 0x00, 0x77, 0x00, 0x86, 0x00,
+  0x9c, 0x00, 0xae, 0x00, 0xbd, 0x00, 0xcb, 0x00, 0xd9, 0x00, 0xe8, 0x00,
+  0xfd, 0x00, 0x0c, 0x01, 0x1b, 0x01, 0x2a, 0x01, 0x40, 0x01, 0x4e, 0x01,
+  0x5d, 0x01, 0x00, 0x00, 0x17, 0x00, 0x24, 0x00, 0x00, 0x00, 0x08, 0x00,
+  0x17, 0x00, 0x26, 0x00, 0x35, 0x00, 0x44, 0x00, 0x53, 0x00, 0x6b, 0x00,
+  0x78, 0x00, 0x86, 0x00, 0x94, 0x00, 0xad, 0x00, 0xc6, 0x00, 0xd5, 0x00,
+  0xe4, 0x00, 0xf3, 0x00, 0x02, 0x01, 0x11, 0x01, 0x20, 0x01, 0x2f, 0x01,
+  0x4b, 0x01, 0x64, 0x01, 0x7c, 0x01, 0x8b, 0x01, 0x9a, 0x01, 0xa9, 0x01,
+  0xc2, 0x01, 0xda, 0x01, 0xe9, 0x01, 0xff, 0x01, 0x0e, 0x02, 0x1c, 0x02,
+  0x2b, 0x02, 0x3a, 0x02, 0x49, 0x02, 0x66, 0x02, 0x75, 0x02, 0x8b, 0x02,
+  0xa7, 0x02, 0x00, 0x00, 0x14, 0x00, 0x2b, 0x00, 0x41, 0x00, 0x4e, 0x00,
+  0x5b, 0x00, 0x73, 0x00, 0x80, 0x00, 0x8d, 0x00, 0x9a, 0x00, 0xa7, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x1f, 0x00, 0x2e, 0x00, 0x3d, 0x00, 0x4f, 0x00,
+  0x5e, 0x00, 0x70, 0x00, 0x82, 0x00, 0x94, 0x00, 0xa3, 0x00, 0xb5, 0x00,
+  0xc4, 0x00, 0xd6, 0x00, 0xe5, 0x00, 0xf4, 0x00, 0x06, 0x01, 0x18, 0x01,
+  0x27, 0x01, 0x36, 0x01, 0x48, 0x01, 0x57, 0x01, 0x00, 0x00, 0x21, 0x00,
+  0x34, 0x00, 0x47, 0x00, 0x5a, 0x00, 0x74, 0x00, 0x8e, 0x00, 0xa9, 0x00,
+  0xc5, 0x00, 0xe0, 0x00, 0xf1, 0x00, 0x02, 0x01, 0x1d, 0x01, 0x38, 0x01,
+  0x51, 0x01, 0x63, 0x01, 0x75, 0x01, 0x00, 0x00, 0x0e, 0x00, 0x2b, 0x00,
+  0x4a, 0x00, 0x69, 0x00, 0x7e, 0x00, 0x9b, 0x00, 0xb8, 0x00, 0xd6, 0x00,
+  0xf4, 0x00, 0x12, 0x01, 0x2e, 0x01, 0x4b, 0x01, 0x68, 0x01, 0x85, 0x01,
+  0xa1, 0x01, 0xbe, 0x01, 0xdb, 0x01, 0xf8, 0x01, 0x0e, 0x02, 0x32, 0x02,
+  0x4f, 0x02, 0x6c, 0x02, 0x00, 0x00, 0x16, 0x00, 0x26, 0x00, 0x33, 0x00,
+  0x48, 0x00, 0x5d, 0x00, 0x73, 0x00, 0x8a, 0x00, 0xa0, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x21, 0x00, 0x44, 0x00, 0x53, 0x00, 0x6c, 0x00, 0x85, 0x00,
+  0x9d, 0x00, 0xb5, 0x00, 0xce, 0x00, 0xe0, 0x00, 0xf9, 0x00, 0x0c, 0x01,
+  0x1e, 0x01, 0x26, 0x01, 0x3f, 0x01, 0x58, 0x01, 0x71, 0x01, 0x8a, 0x01,
+  0xa3, 0x01, 0xbc, 0x01, 0xd5, 0x01, 0xee, 0x01, 0xfd, 0x01, 0x0f, 0x02,
+  0x28, 0x02, 0x3a, 0x02, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x33, 0x00,
+  0x43, 0x00, 0x52, 0x00, 0x60, 0x00, 0x00, 0x00, 0x14, 0x00, 0x1b, 0x00,
+  0x2f, 0x00, 0x50, 0x00, 0x61, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x25, 0x00,
+  0x3e, 0x00, 0x4d, 0x00, 0x65, 0x00, 0x74, 0x00, 0x8d, 0x00, 0xa3, 0x00,
+  0x00, 0x00, 0x1a, 0x00, 0x2b, 0x00, 0x4c, 0x00, 0x67, 0x00, 0x79, 0x00,
+  0x9b, 0x00, 0xbc, 0x00, 0xcd, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x34, 0x00,
+  0x51, 0x00, 0x6e, 0x00, 0x87, 0x00, 0xa0, 0x00, 0xb8, 0x00, 0xcf, 0x00,
+  0xe7, 0x00, 0xff, 0x00, 0x17, 0x01, 0x2f, 0x01, 0x48, 0x01, 0x60, 0x01,
+  0x78, 0x01, 0x90, 0x01, 0xa9, 0x01, 0xc2, 0x01, 0xde, 0x01, 0xfa, 0x01,
+  0x12, 0x02, 0x2e, 0x02, 0x40, 0x02, 0x59, 0x02, 0x72, 0x02, 0x8b, 0x02,
+  0xa3, 0x02, 0xbf, 0x02, 0x00, 0x00, 0x1e, 0x00, 0x32, 0x00, 0x40, 0x00,
+  0x54, 0x00, 0x61, 0x00, 0x6e, 0x00, 0x81, 0x00, 0x8e, 0x00, 0x9b, 0x00,
+  0xa8, 0x00, 0xc7, 0x00, 0x00, 0x00, 0x09, 0x00, 0x25, 0x00, 0x3e, 0x00,
+  0x56, 0x00, 0x71, 0x00, 0x8a, 0x00, 0xa3, 0x00, 0xbb, 0x00, 0xd3, 0x00,
+  0xec, 0x00, 0xfe, 0x00, 0x17, 0x01, 0x30, 0x01, 0x48, 0x01, 0x61, 0x01,
+  0x7e, 0x01, 0x96, 0x01, 0xaf, 0x01, 0xc8, 0x01, 0xe1, 0x01, 0xfa, 0x01,
+  0x12, 0x02, 0x2b, 0x02, 0x00, 0x00, 0x12, 0x00, 0x24, 0x00, 0x38, 0x00,
+  0x4c, 0x00, 0x00, 0x00, 0x12, 0x00, 0x29, 0x00, 0x4c, 0x00, 0x64, 0x00,
+  0x81, 0x00, 0x96, 0x00, 0xac, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x3d, 0x00,
+  0x49, 0x00, 0x64, 0x00, 0x7d, 0x00, 0xa3, 0x00, 0xb1, 0x00, 0xbe, 0x00,
+  0xd8, 0x00, 0xf2, 0x00, 0x0c, 0x01, 0x27, 0x01, 0x00, 0x00, 0x0d, 0x00,
+  0x1f, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1d, 0x00, 0x41, 0x00, 0x50, 0x00,
+  0x5f, 0x00, 0x6e, 0x00, 0x89, 0x00, 0x9d, 0x00, 0xab, 0x00, 0xb9, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x16, 0x00, 0x21, 0x00, 0x30, 0x00,
+  0x47, 0x00, 0x56, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x2f, 0x00, 0x43, 0x00,
+  0x56, 0x00, 0x6a, 0x00, 0x00, 0x00, 0x12, 0x00, 0x24, 0x00, 0x31, 0x00,
+  0x00, 0x00, 0x14, 0x00, 0x28, 0x00, 0x3c, 0x00, 0x50, 0x00, 0x64, 0x00,
+  0x78, 0x00, 0x8c, 0x00, 0x9f, 0x00, 0xb0, 0x00, 0xc4, 0x00, 0xd6, 0x00,
+  0xe9, 0x00, 0xf6, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x15, 0x00,
+  0x2a, 0x00, 0x00, 0x00, 0x14, 0x00, 0x23, 0x00, 0x32, 0x00, 0x46, 0x00,
+  0x5b, 0x00, 0x69, 0x00, 0x78, 0x00, 0x88, 0x00, 0x9c, 0x00, 0xab, 0x00,
+  0xb9, 0x00, 0xcd, 0x00, 0xe0, 0x00, 0xf4, 0x00, 0x03, 0x01, 0x11, 0x01,
+  0x20, 0x01, 0x34, 0x01, 0x43, 0x01, 0x57, 0x01, 0x6b, 0x01, 0x7a, 0x01,
+  0x8a, 0x01, 0x9e, 0x01, 0x00, 0x00, 0x11, 0x00, 0x27, 0x00, 0x34, 0x00,
+  0x00, 0x00, 0x08, 0x00, 0x10, 0x00, 0x1e, 0x00, 0x2d, 0x00, 0x3b, 0x00,
+  0x49, 0x00, 0x58, 0x00, 0x67, 0x00, 0x75, 0x00, 0x84, 0x00, 0x9c, 0x00,
+  0xb4, 0x00, 0xcc, 0x00, 0xdb, 0x00, 0xe8, 0x00, 0xf7, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x1a, 0x00, 0x39, 0x00, 0x46, 0x00, 0x00, 0x00, 0x0b, 0x00,
+  0x19, 0x00, 0x2b, 0x00, 0x3a, 0x00, 0x49, 0x00, 0x58, 0x00, 0x73, 0x00,
+  0x8e, 0x00, 0x99, 0x00, 0xa7, 0x00, 0xb7, 0x00, 0xc6, 0x00, 0xd6, 0x00,
+  0xe5, 0x00, 0xf4, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x19, 0x00, 0x36, 0x00,
+  0x48, 0x00, 0x00, 0x00, 0x08, 0x00, 0x17, 0x00, 0x26, 0x00, 0x35, 0x00,
+  0x44, 0x00, 0x53, 0x00, 0x62, 0x00, 0x71, 0x00, 0x80, 0x00, 0x8f, 0x00,
+  0x9e, 0x00, 0xad, 0x00, 0xbc, 0x00, 0xcb, 0x00, 0xd9, 0x00, 0xe7, 0x00,
+  0xf4, 0x00, 0x03, 0x01, 0x12, 0x01, 0x21, 0x01, 0x2f, 0x01, 0x3e, 0x01,
+  0x4d, 0x01, 0x72, 0x01, 0x82, 0x01, 0x92, 0x01, 0xa1, 0x01, 0xae, 0x01,
+  0xbd, 0x01, 0xcc, 0x01, 0xdb, 0x01, 0xea, 0x01, 0xf9, 0x01, 0x08, 0x02,
+  0x23, 0x02, 0x32, 0x02, 0x41, 0x02, 0x50, 0x02, 0x5f, 0x02, 0x6e, 0x02,
+  0x82, 0x02, 0x91, 0x02, 0xa0, 0x02, 0xae, 0x02, 0xbb, 0x02, 0xca, 0x02,
+  0xd8, 0x02, 0xe7, 0x02, 0xf7, 0x02, 0x00, 0x00, 0x18, 0x00, 0x31, 0x00,
+  0x4a, 0x00, 0x62, 0x00, 0x7a, 0x00, 0x93, 0x00, 0xaa, 0x00, 0xc3, 0x00,
+  0xd0, 0x00, 0xe9, 0x00, 0x02, 0x01, 0x1b, 0x01, 0x34, 0x01, 0x43, 0x01,
+  0x5c, 0x01, 0x74, 0x01, 0x8d, 0x01, 0xa5, 0x01, 0xbd, 0x01, 0xd6, 0x01,
+  0xef, 0x01, 0x08, 0x02, 0x21, 0x02, 0x3a, 0x02, 0x53, 0x02, 0x6c, 0x02,
+  0x85, 0x02, 0x94, 0x02, 0xad, 0x02, 0xc6, 0x02, 0xdf, 0x02, 0xf7, 0x02,
+  0x0f, 0x03, 0x27, 0x03, 0x40, 0x03, 0x4f, 0x03, 0x69, 0x03, 0x83, 0x03,
+  0x9d, 0x03, 0xb5, 0x03, 0xcd, 0x03, 0xe5, 0x03, 0xfd, 0x03, 0x16, 0x04,
+  0x2f, 0x04, 0x48, 0x04, 0x61, 0x04, 0x7a, 0x04, 0x93, 0x04, 0xac, 0x04,
+  0xc3, 0x04, 0xdb, 0x04, 0xf4, 0x04, 0x00, 0x00, 0x12, 0x00, 0x24, 0x00,
+  0x37, 0x00, 0x4b, 0x00, 0x5e, 0x00, 0x72, 0x00, 0x85, 0x00, 0x95, 0x00,
+  0xa9, 0x00, 0xbd, 0x00, 0xd1, 0x00, 0xe5, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x18, 0x00, 0x2e, 0x00, 0x43, 0x00, 0x00, 0x00, 0x14, 0x00, 0x28, 0x00,
+  0x3c, 0x00, 0x50, 0x00, 0x64, 0x00, 0x78, 0x00, 0x8c, 0x00, 0xa0, 0x00,
+  0xb4, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x12, 0x00, 0x24, 0x00, 0x36, 0x00,
+  0x4e, 0x00, 0x67, 0x00, 0x80, 0x00, 0x99, 0x00, 0xab, 0x00, 0xc3, 0x00,
+  0xdc, 0x00, 0xee, 0x00, 0x06, 0x01, 0x1e, 0x01, 0x37, 0x01, 0x50, 0x01,
+  0x69, 0x01, 0x82, 0x01, 0x9b, 0x01, 0xb4, 0x01, 0xcd, 0x01, 0xe6, 0x01,
+  0xff, 0x01, 0x18, 0x02, 0x2f, 0x02, 0x41, 0x02, 0x59, 0x02, 0x71, 0x02,
+  0x83, 0x02, 0x9d, 0x02, 0xaf, 0x02, 0xc7, 0x02, 0xdf, 0x02, 0xf1, 0x02,
+  0x03, 0x03, 0x1c, 0x03, 0x35, 0x03, 0x4d, 0x03, 0x5f, 0x03, 0x77, 0x03,
+  0x89, 0x03, 0x9b, 0x03, 0xad, 0x03, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00,
+  0x19, 0x00, 0x26, 0x00, 0x32, 0x00, 0x4e, 0x00, 0x66, 0x00, 0x75, 0x00,
+  0x00, 0x00, 0x18, 0x00, 0x29, 0x00, 0x37, 0x00, 0x4b, 0x00, 0x64, 0x00,
+  0x79, 0x00, 0x8d, 0x00, 0x9a, 0x00, 0xa7, 0x00, 0xb4, 0x00, 0xc1, 0x00,
+  0xdb, 0x00, 0xec, 0x00, 0x00, 0x01, 0x14, 0x01, 0x25, 0x01, 0x36, 0x01,
+  0x4a, 0x01, 0x00, 0x00, 0x19, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x17, 0x00,
+  0x2f, 0x00, 0x47, 0x00, 0x5f, 0x00, 0x77, 0x00, 0x8f, 0x00, 0xa7, 0x00,
+  0xbf, 0x00, 0xd9, 0x00, 0xf1, 0x00, 0x09, 0x01, 0x24, 0x01, 0x3c, 0x01,
+  0x54, 0x01, 0x6d, 0x01, 0x89, 0x01, 0xa1, 0x01, 0xb9, 0x01, 0xd1, 0x01,
+  0xe9, 0x01, 0x01, 0x02, 0x00, 0x00, 0x0d, 0x00, 0x23, 0x00, 0x3e, 0x00,
+  0x4b, 0x00, 0x62, 0x00, 0x80, 0x00, 0x96, 0x00, 0xb5, 0x00, 0xc6, 0x00,
+  0x00, 0x00, 0x22, 0x00, 0x33, 0x00, 0x40, 0x00, 0x4d, 0x00, 0x5a, 0x00,
+  0x66, 0x00, 0x73, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x23, 0x00, 0x3b, 0x00,
+  0x59, 0x00, 0x72, 0x00, 0x8b, 0x00, 0xa4, 0x00, 0xbd, 0x00, 0xd6, 0x00,
+  0xef, 0x00, 0x06, 0x01, 0x1f, 0x01, 0x37, 0x01, 0x56, 0x01, 0x6e, 0x01,
+  0x86, 0x01, 0x9f, 0x01, 0xb8, 0x01, 0xd1, 0x01, 0xea, 0x01, 0x0d, 0x02,
+  0x26, 0x02, 0x3f, 0x02, 0x58, 0x02, 0x71, 0x02, 0x8a, 0x02, 0xa2, 0x02,
+  0xba, 0x02, 0xd2, 0x02, 0x00, 0x00, 0x14, 0x00, 0x28, 0x00, 0x3c, 0x00,
+  0x50, 0x00, 0x64, 0x00, 0x78, 0x00, 0x8c, 0x00, 0x99, 0x00, 0xad, 0x00,
+  0xc1, 0x00, 0xd5, 0x00, 0xe2, 0x00, 0xf6, 0x00, 0x18, 0x01, 0x2b, 0x01,
+  0x45, 0x01, 0x58, 0x01, 0x6c, 0x01, 0x80, 0x01, 0x94, 0x01, 0xb5, 0x01,
+  0xc9, 0x01, 0xdd, 0x01, 0xf7, 0x01, 0x0b, 0x02, 0x1e, 0x02, 0x32, 0x02,
+  0x46, 0x02, 0x5a, 0x02, 0x74, 0x02, 0x00, 0x00, 0x06, 0x00, 0x27, 0x00,
+  0x36, 0x00, 0x46, 0x00, 0x58, 0x00, 0x71, 0x00, 0x7a, 0x00, 0x83, 0x00,
+  0xa7, 0x00, 0xbd, 0x00, 0xd3, 0x00, 0xf7, 0x00, 0x04, 0x01, 0x19, 0x01,
+  0x00, 0x00, 0x0d, 0x00, 0x25, 0x00, 0x3d, 0x00, 0x55, 0x00, 0x6d, 0x00,
+  0x85, 0x00, 0x9d, 0x00, 0xb5, 0x00, 0xcd, 0x00, 0xe5, 0x00, 0xfd, 0x00,
+  0x15, 0x01, 0x2d, 0x01, 0x45, 0x01, 0x5d, 0x01, 0x00, 0x00, 0x0f, 0x00,
+  0x1e, 0x00, 0x30, 0x00, 0x42, 0x00, 0x50, 0x00, 0x62, 0x00, 0x71, 0x00,
+  0x80, 0x00, 0x8f, 0x00, 0xa1, 0x00, 0xb0, 0x00, 0xbf, 0x00, 0xce, 0x00,
+  0xdd, 0x00, 0x00, 0x00, 0x18, 0x00, 0x29, 0x00, 0x3b, 0x00, 0x4c, 0x00,
+  0x5b, 0x00, 0x6f, 0x00, 0x00, 0x00, 0x16, 0x00, 0x2b, 0x00, 0x41, 0x00,
+  0x57, 0x00, 0x6d, 0x00, 0x83, 0x00, 0x92, 0x00, 0xa8, 0x00, 0xb7, 0x00,
+  0xc4, 0x00, 0xcd, 0x00, 0xd6, 0x00, 0xec, 0x00, 0x02, 0x01, 0x17, 0x01,
+  0x26, 0x01, 0x3c, 0x01, 0x00, 0x00, 0x18, 0x00, 0x2b, 0x00, 0x41, 0x00,
+  0x59, 0x00, 0x6d, 0x00, 0x81, 0x00, 0x97, 0x00, 0xa4, 0x00, 0xb1, 0x00,
+  0xc3, 0x00, 0xd6, 0x00, 0xea, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x1c, 0x00,
+  0x2b, 0x00, 0x3a, 0x00, 0x45, 0x00, 0x54, 0x00, 0x62, 0x00, 0x73, 0x00,
+  0x82, 0x00, 0x00, 0x00, 0x14, 0x00, 0x26, 0x00, 0x3a, 0x00, 0x4e, 0x00,
+  0x62, 0x00, 0x75, 0x00, 0x89, 0x00, 0x9d, 0x00, 0xb1, 0x00, 0xc9, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x28, 0x00, 0x3c, 0x00, 0x4f, 0x00,
+  0x00, 0x00, 0x14, 0x00, 0x2a, 0x00, 0x3f, 0x00, 0x55, 0x00, 0x6b, 0x00,
+  0x81, 0x00, 0x00, 0x00, 0x10, 0x00, 0x1d, 0x00, 0x35, 0x00, 0x4d, 0x00,
+  0x65, 0x00, 0x7d, 0x00, 0x00, 0x00, 0x19, 0x00, 0x32, 0x00, 0x43, 0x00,
+  0x5c, 0x00, 0x75, 0x00, 0x8e, 0x00, 0xa6, 0x00, 0xbe, 0x00, 0xd7, 0x00,
+  0xed, 0x00, 0x06, 0x01, 0x1f, 0x01, 0x38, 0x01, 0x51, 0x01, 0x6a, 0x01,
+  0x83, 0x01, 0x9c, 0x01, 0xb5, 0x01, 0xcd, 0x01, 0xdf, 0x01, 0xf8, 0x01,
+  0x10, 0x02, 0x29, 0x02, 0x42, 0x02, 0x54, 0x02, 0x6d, 0x02, 0x86, 0x02,
+  0x97, 0x02, 0xaf, 0x02, 0xc7, 0x02, 0x00, 0x00, 0x11, 0x00, 0x31, 0x00,
+  0x00, 0x00, 0x11, 0x00, 0x22, 0x00, 0x33, 0x00, 0x44, 0x00, 0x55, 0x00,
+  0x67, 0x00, 0x79, 0x00, 0x8a, 0x00, 0x9b, 0x00, 0x00, 0x00, 0x11, 0x00,
+  0x27, 0x00, 0x34, 0x00, 0x41, 0x00, 0x63, 0x00, 0x00, 0x00, 0x0f, 0x00,
+  0x1e, 0x00, 0x34, 0x00, 0x45, 0x00, 0x00, 0x00, 0x12, 0x00, 0x1f, 0x00,
+  0x2c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x28, 0x00, 0x3c, 0x00, 0x50, 0x00,
+  0x64, 0x00, 0x78, 0x00, 0x8c, 0x00, 0xa0, 0x00, 0xb8, 0x00, 0xcb, 0x00,
+  0xde, 0x00, 0xf1, 0x00, 0x05, 0x01, 0x18, 0x01, 0x2c, 0x01, 0x40, 0x01,
+  0x54, 0x01, 0x68, 0x01, 0x7c, 0x01, 0x8f, 0x01, 0xa3, 0x01, 0xb7, 0x01,
+  0xcb, 0x01, 0xdf, 0x01, 0xf3, 0x01, 0x06, 0x02, 0x1b, 0x02, 0x2f, 0x02,
+  0x43, 0x02, 0x57, 0x02, 0x6b, 0x02, 0x7f, 0x02, 0x92, 0x02, 0xa6, 0x02,
+  0xba, 0x02, 0x00, 0x00, 0x11, 0x00, 0x1e, 0x00, 0x32, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x1f, 0x00, 0x32, 0x00, 0x46, 0x00, 0x55, 0x00, 0x69, 0x00,
+  0x7e, 0x00, 0x91, 0x00, 0xa5, 0x00, 0x00, 0x00, 0x15, 0x00, 0x2a, 0x00,
+  0x39, 0x00, 0x4d, 0x00, 0x63, 0x00, 0x74, 0x00, 0x8b, 0x00, 0xa0, 0x00,
+  0xb6, 0x00, 0xcb, 0x00, 0xe0, 0x00, 0xf5, 0x00, 0x0a, 0x01, 0x20, 0x01,
+  0x36, 0x01, 0x4b, 0x01, 0x60, 0x01, 0x6d, 0x01, 0x88, 0x01, 0x9d, 0x01,
+  0xb2, 0x01, 0xc1, 0x01, 0xd6, 0x01, 0xe4, 0x01, 0xf9, 0x01, 0x0b, 0x02,
+  0x1c, 0x02, 0x31, 0x02, 0x46, 0x02, 0x5c, 0x02, 0x6e, 0x02, 0x7f, 0x02,
+  0x00, 0x00, 0x05, 0x00, 0x26, 0x00, 0x2d, 0x00, 0x34, 0x00, 0x44, 0x00,
+  0x54, 0x00, 0x00, 0x00, 0x15, 0x00, 0x29, 0x00, 0x3f, 0x00, 0x54, 0x00,
+  0x69, 0x00, 0x7e, 0x00, 0x93, 0x00, 0xa8, 0x00, 0xbd, 0x00, 0xd6, 0x00,
+  0xeb, 0x00, 0xff, 0x00, 0x14, 0x01, 0x2a, 0x01, 0x3f, 0x01, 0x54, 0x01,
+  0x00, 0x00, 0x11, 0x00, 0x2c, 0x00, 0x47, 0x00, 0x62, 0x00, 0x7b, 0x00,
+  0x8f, 0x00, 0xa9, 0x00, 0xc4, 0x00, 0xd7, 0x00, 0xeb, 0x00, 0xfe, 0x00,
+  0x12, 0x01, 0x1f, 0x01, 0x33, 0x01, 0x47, 0x01, 0x62, 0x01, 0x6f, 0x01,
+  0x82, 0x01, 0x95, 0x01, 0xaf, 0x01, 0xc8, 0x01, 0xdc, 0x01, 0x00, 0x00,
+  0x0d, 0x00, 0x24, 0x00, 0x39, 0x00, 0x52, 0x00, 0x6e, 0x00, 0x87, 0x00,
+  0xa0, 0x00, 0xb5, 0x00, 0xca, 0x00, 0xe6, 0x00, 0x02, 0x01, 0x1f, 0x01,
+  0x34, 0x01, 0x4d, 0x01, 0x65, 0x01, 0x80, 0x01, 0x8e, 0x01, 0xa7, 0x01,
+  0xc2, 0x01, 0xdb, 0x01, 0xf1, 0x01, 0x09, 0x02, 0x25, 0x02, 0x3d, 0x02,
+  0x4c, 0x02, 0x5b, 0x02, 0x6a, 0x02, 0x87, 0x02, 0xa4, 0x02, 0xb3, 0x02,
+  0xc2, 0x02, 0xda, 0x02, 0xf6, 0x02, 0x0a, 0x03, 0x19, 0x03, 0x2e, 0x03,
+  0x4a, 0x03, 0x5f, 0x03, 0x77, 0x03, 0x90, 0x03, 0x9e, 0x03, 0x00, 0x00,
+  0x13, 0x00, 0x2b, 0x00, 0x42, 0x00, 0x55, 0x00, 0x6d, 0x00, 0x85, 0x00,
+  0x9c, 0x00, 0xb3, 0x00, 0xc6, 0x00, 0xdd, 0x00, 0xf5, 0x00, 0x0c, 0x01,
+  0x24, 0x01, 0x3c, 0x01, 0x53, 0x01, 0x66, 0x01, 0x7e, 0x01, 0x95, 0x01,
+  0xac, 0x01, 0xc0, 0x01, 0xd8, 0x01, 0xf0, 0x01, 0x04, 0x02, 0x15, 0x02,
+  0x2d, 0x02, 0x44, 0x02, 0x5c, 0x02, 0x74, 0x02, 0x8b, 0x02, 0xa2, 0x02,
+  0xb9, 0x02, 0xd0, 0x02, 0xe3, 0x02, 0xf7, 0x02, 0x08, 0x03, 0x1f, 0x03,
+  0x37, 0x03, 0x4b, 0x03, 0x63, 0x03, 0x76, 0x03, 0x8e, 0x03, 0xa2, 0x03,
+  0xba, 0x03, 0xd1, 0x03, 0xe9, 0x03, 0x01, 0x04, 0x19, 0x04, 0x30, 0x04,
+  0x47, 0x04, 0x5d, 0x04, 0x75, 0x04, 0x8d, 0x04, 0x9d, 0x04, 0xb5, 0x04,
+  0xcc, 0x04, 0xe4, 0x04, 0xfc, 0x04, 0x13, 0x05, 0x2b, 0x05, 0x41, 0x05,
+  0x55, 0x05, 0x6d, 0x05, 0x85, 0x05, 0x9b, 0x05, 0xb3, 0x05, 0xcb, 0x05,
+  0xda, 0x05, 0xf1, 0x05, 0x05, 0x06, 0x1d, 0x06, 0x32, 0x06, 0x49, 0x06,
+  0x61, 0x06, 0x79, 0x06, 0x91, 0x06, 0xa4, 0x06, 0xbb, 0x06, 0xd2, 0x06,
+  0xe9, 0x06, 0xfd, 0x06, 0x11, 0x07, 0x28, 0x07, 0x40, 0x07, 0x00, 0x00,
+  0x0e, 0x00, 0x26, 0x00, 0x42, 0x00, 0x5e, 0x00, 0x77, 0x00, 0x92, 0x00,
+  0xaa, 0x00, 0xbc, 0x00, 0xd4, 0x00, 0xe5, 0x00, 0x02, 0x01, 0x1e, 0x01,
+  0x37, 0x01, 0x4f, 0x01, 0x68, 0x01, 0x80, 0x01, 0x98, 0x01, 0xb0, 0x01,
+  0xc8, 0x01, 0xe1, 0x01, 0xfd, 0x01, 0x16, 0x02, 0x2f, 0x02, 0x48, 0x02,
+  0x60, 0x02, 0x79, 0x02, 0x92, 0x02, 0xab, 0x02, 0xc4, 0x02, 0xdd, 0x02,
+  0xf5, 0x02, 0x0e, 0x03, 0x2a, 0x03, 0x45, 0x03, 0x5e, 0x03, 0x77, 0x03,
+  0x90, 0x03, 0xa9, 0x03, 0xc1, 0x03, 0xdb, 0x03, 0xf7, 0x03, 0x10, 0x04,
+  0x29, 0x04, 0x3b, 0x04, 0x58, 0x04, 0x70, 0x04, 0x7d, 0x04, 0x95, 0x04,
+  0xb1, 0x04, 0xcd, 0x04, 0xdf, 0x04, 0xf7, 0x04, 0x10, 0x05, 0x2c, 0x05,
+  0x45, 0x05, 0x5c, 0x05, 0x79, 0x05, 0x91, 0x05, 0xa9, 0x05, 0xc5, 0x05,
+  0xdd, 0x05, 0xf5, 0x05, 0x06, 0x06, 0x1f, 0x06, 0x38, 0x06, 0x51, 0x06,
+  0x69, 0x06, 0x81, 0x06, 0x8d, 0x06, 0xa6, 0x06, 0x00, 0x00, 0x1a, 0x00,
+  0x34, 0x00, 0x50, 0x00, 0x72, 0x00, 0x8c, 0x00, 0xa0, 0x00, 0xad, 0x00,
+  0xc3, 0x00, 0x00, 0x00, 0x12, 0x00, 0x20, 0x00, 0x38, 0x00, 0x5b, 0x00,
+  0x6d, 0x00, 0x8d, 0x00, 0x9f, 0x00, 0xbb, 0x00, 0xcd, 0x00, 0xdf, 0x00,
+  0xed, 0x00, 0xfd, 0x00, 0x0f, 0x01, 0x21, 0x01, 0x30, 0x01, 0x3f, 0x01,
+  0x51, 0x01, 0x6c, 0x01, 0x00, 0x00, 0x10, 0x00, 0x22, 0x00, 0x36, 0x00,
+  0x42, 0x00, 0x00, 0x00, 0x12, 0x00, 0x32, 0x00, 0x44, 0x00, 0x60, 0x00,
+  0x7c, 0x00, 0x98, 0x00, 0xa9, 0x00, 0xc5, 0x00, 0xd7, 0x00, 0xed, 0x00,
+  0x09, 0x01, 0x00, 0x00, 0x13, 0x00, 0x34, 0x00, 0x48, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x21, 0x00, 0x33, 0x00, 0x42, 0x00, 0x51, 0x00, 0x60, 0x00,
+  0x79, 0x00, 0x8b, 0x00, 0x9a, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x20, 0x00,
+  0x2f, 0x00, 0x45, 0x00, 0x5c, 0x00, 0x70, 0x00, 0x84, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x22, 0x00, 0x36, 0x00, 0x4c, 0x00, 0x5e, 0x00, 0x67, 0x00,
+  0x70, 0x00, 0x82, 0x00, 0x91, 0x00, 0xa7, 0x00, 0xb9, 0x00, 0xcb, 0x00,
+  0xe0, 0x00, 0xf2, 0x00, 0x01, 0x01, 0x00, 0x00, 0x18, 0x00, 0x2f, 0x00,
+  0x43, 0x00, 0x5b, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x15, 0x00, 0x2b, 0x00,
+  0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x19, 0x00, 0x26, 0x00,
+  0x46, 0x00, 0x00, 0x00, 0x14, 0x00, 0x28, 0x00, 0x3c, 0x00, 0x4d, 0x00,
+  0x61, 0x00, 0x74, 0x00, 0x85, 0x00, 0x99, 0x00, 0x00, 0x00, 0x16, 0x00,
+  0x21, 0x00, 0x36, 0x00, 0x49, 0x00, 0x5e, 0x00, 0x73, 0x00, 0x88, 0x00,
+  0x9d, 0x00, 0xb6, 0x00, 0xcd, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x0b, 0x00,
+  0x23, 0x00, 0x3e, 0x00, 0x55, 0x00, 0x6c, 0x00, 0x77, 0x00, 0x8e, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x28, 0x00, 0x40, 0x00, 0x59, 0x00, 0x75, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x23, 0x00, 0x33, 0x00, 0x45, 0x00, 0x57, 0x00,
+  0x62, 0x00, 0x72, 0x00, 0x84, 0x00, 0x95, 0x00, 0xb0, 0x00, 0xc2, 0x00,
+  0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x18, 0x00, 0x2f, 0x00, 0x47, 0x00,
+  0x5f, 0x00, 0x73, 0x00, 0x8b, 0x00, 0xa3, 0x00, 0x00, 0x00, 0x18, 0x00,
+  0x25, 0x00, 0x36, 0x00, 0x45, 0x00, 0x00, 0x00, 0x14, 0x00, 0x28, 0x00,
+  0x3c, 0x00, 0x4f, 0x00, 0x62, 0x00, 0x76, 0x00, 0x8a, 0x00, 0x9e, 0x00,
+  0xb2, 0x00, 0xc9, 0x00, 0xdd, 0x00, 0xf1, 0x00, 0x04, 0x01, 0x17, 0x01,
+  0x2a, 0x01, 0x3b, 0x01, 0x4f, 0x01, 0x63, 0x01, 0x77, 0x01, 0x87, 0x01,
+  0x9b, 0x01, 0xaf, 0x01, 0x00, 0x00, 0x16, 0x00, 0x21, 0x00, 0x37, 0x00,
+  0x4c, 0x00, 0x68, 0x00, 0x7e, 0x00, 0x94, 0x00, 0xaa, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x27, 0x00, 0x3b, 0x00, 0x4f, 0x00, 0x63, 0x00, 0x77, 0x00,
+  0x89, 0x00, 0x9c, 0x00, 0xb0, 0x00, 0xc4, 0x00, 0xd8, 0x00, 0xf0, 0x00,
+  0x04, 0x01, 0x00, 0x00, 0x16, 0x00, 0x2b, 0x00, 0x41, 0x00, 0x57, 0x00,
+  0x6c, 0x00, 0x82, 0x00, 0x97, 0x00, 0xac, 0x00, 0xbc, 0x00, 0xd1, 0x00,
+  0xe6, 0x00, 0xfc, 0x00, 0x12, 0x01, 0x28, 0x01, 0x3d, 0x01, 0x53, 0x01,
+  0x69, 0x01, 0x7f, 0x01, 0x95, 0x01, 0xa6, 0x01, 0xbb, 0x01, 0xd0, 0x01,
+  0xe6, 0x01, 0xfb, 0x01, 0x12, 0x02, 0x27, 0x02, 0x3d, 0x02, 0x54, 0x02,
+  0x65, 0x02, 0x76, 0x02, 0x87, 0x02, 0x9d, 0x02, 0xb3, 0x02, 0xc9, 0x02,
+  0xdf, 0x02, 0xf5, 0x02, 0x0b, 0x03, 0x21, 0x03, 0x3d, 0x03, 0x4c, 0x03,
+  0x61, 0x03, 0x76, 0x03, 0x93, 0x03, 0xa3, 0x03, 0xb9, 0x03, 0xce, 0x03,
+  0x00, 0x00, 0x0d, 0x00, 0x1a, 0x00, 0x38, 0x00, 0x49, 0x00, 0x59, 0x00,
+  0x6a, 0x00, 0x84, 0x00, 0x00, 0x00, 0x16, 0x00, 0x2c, 0x00, 0x42, 0x00,
+  0x58, 0x00, 0x6d, 0x00, 0x82, 0x00, 0x98, 0x00, 0xad, 0x00, 0xc3, 0x00,
+  0xe0, 0x00, 0xf6, 0x00, 0x0b, 0x01, 0x21, 0x01, 0x37, 0x01, 0x4c, 0x01,
+  0x69, 0x01, 0x86, 0x01, 0xa2, 0x01, 0xbf, 0x01, 0xd6, 0x01, 0xf3, 0x01,
+  0x08, 0x02, 0x1e, 0x02, 0x34, 0x02, 0x4a, 0x02, 0x60, 0x02, 0x76, 0x02,
+  0x8c, 0x02, 0xa1, 0x02, 0xb6, 0x02, 0xcc, 0x02, 0xe1, 0x02, 0xfe, 0x02,
+  0x13, 0x03, 0x28, 0x03, 0x3e, 0x03, 0x53, 0x03, 0x68, 0x03, 0x7e, 0x03,
+  0x93, 0x03, 0xa8, 0x03, 0xbe, 0x03, 0xda, 0x03, 0xf7, 0x03, 0x13, 0x04,
+  0x30, 0x04, 0x46, 0x04, 0x63, 0x04, 0x80, 0x04, 0x9d, 0x04, 0xba, 0x04,
+  0xd7, 0x04, 0xf4, 0x04, 0x11, 0x05, 0x27, 0x05, 0x43, 0x05, 0x5f, 0x05,
+  0x7b, 0x05, 0x91, 0x05, 0xa6, 0x05, 0xbb, 0x05, 0xd1, 0x05, 0xe7, 0x05,
+  0xfc, 0x05, 0x19, 0x06, 0x2f, 0x06, 0x45, 0x06, 0x5b, 0x06, 0x70, 0x06,
+  0x86, 0x06, 0x9c, 0x06, 0xb8, 0x06, 0xd5, 0x06, 0xeb, 0x06, 0x00, 0x07,
+  0x16, 0x07, 0x2c, 0x07, 0x41, 0x07, 0x55, 0x07, 0x6a, 0x07, 0x7f, 0x07,
+  0x9c, 0x07, 0xb1, 0x07, 0xc6, 0x07, 0xdc, 0x07, 0xf2, 0x07, 0x08, 0x08,
+  0x1e, 0x08, 0x3b, 0x08, 0x50, 0x08, 0x6d, 0x08, 0x00, 0x00, 0x14, 0x00,
+  0x27, 0x00, 0x3b, 0x00, 0x4e, 0x00, 0x5f, 0x00, 0x70, 0x00, 0x8a, 0x00,
+  0x9e, 0x00, 0xb7, 0x00, 0xd0, 0x00, 0xe3, 0x00, 0xfe, 0x00, 0x0e, 0x01,
+  0x22, 0x01, 0x36, 0x01, 0x46, 0x01, 0x57, 0x01, 0x6b, 0x01, 0x7f, 0x01,
+  0x93, 0x01, 0xa7, 0x01, 0xba, 0x01, 0xcb, 0x01, 0xe4, 0x01, 0xfe, 0x01,
+  0x18, 0x02, 0x2c, 0x02, 0x00, 0x00, 0x12, 0x00, 0x24, 0x00, 0x32, 0x00,
+  0x41, 0x00, 0x50, 0x00, 0x5f, 0x00, 0x6d, 0x00, 0x7f, 0x00, 0x00, 0x00,
+  0x18, 0x00, 0x32, 0x00, 0x45, 0x00, 0x59, 0x00, 0x73, 0x00, 0x8a, 0x00,
+  0xa1, 0x00, 0xb5, 0x00, 0xce, 0x00, 0xed, 0x00, 0x0b, 0x01, 0x20, 0x01,
+  0x3f, 0x01, 0x53, 0x01, 0x6e, 0x01, 0x82, 0x01, 0x9a, 0x01, 0xae, 0x01,
+  0xcc, 0x01, 0xdf, 0x01, 0xf4, 0x01, 0x13, 0x02, 0x2d, 0x02, 0x47, 0x02,
+  0x61, 0x02, 0x78, 0x02, 0x8a, 0x02, 0x9e, 0x02, 0xbc, 0x02, 0x00, 0x00,
+  0x18, 0x00, 0x31, 0x00, 0x4a, 0x00, 0x62, 0x00, 0x7a, 0x00, 0x93, 0x00,
+  0xab, 0x00, 0xc4, 0x00, 0xdd, 0x00, 0xf6, 0x00, 0x05, 0x01, 0x1d, 0x01,
+  0x36, 0x01, 0x4f, 0x01, 0x68, 0x01, 0x80, 0x01, 0x99, 0x01, 0xb1, 0x01,
+  0xca, 0x01, 0xe3, 0x01, 0xfb, 0x01, 0x14, 0x02, 0x25, 0x02, 0x3d, 0x02,
+  0x56, 0x02, 0x00, 0x00, 0x1e, 0x00, 0x36, 0x00, 0x4e, 0x00, 0x66, 0x00,
+  0x79, 0x00, 0x97, 0x00, 0xaf, 0x00, 0xc6, 0x00, 0xe0, 0x00, 0xf7, 0x00,
+  0x14, 0x01, 0x2c, 0x01, 0x43, 0x01, 0x5a, 0x01, 0x71, 0x01, 0x89, 0x01,
+  0xa0, 0x01, 0xb8, 0x01, 0xd1, 0x01, 0xe9, 0x01, 0x01, 0x02, 0x19, 0x02,
+  0x31, 0x02, 0x49, 0x02, 0x61, 0x02, 0x78, 0x02, 0x90, 0x02, 0xa7, 0x02,
+  0xbf, 0x02, 0xdd, 0x02, 0xf5, 0x02, 0x0d, 0x03, 0x00, 0x00, 0x0c, 0x00,
+  0x19, 0x00, 0x2b, 0x00, 0x47, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x1e, 0x00,
+  0x32, 0x00, 0x50, 0x00, 0x6a, 0x00, 0x84, 0x00, 0x9e, 0x00, 0xb2, 0x00,
+  0xcc, 0x00, 0xe9, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x37, 0x00, 0x49, 0x00,
+  0x65, 0x00, 0x81, 0x00, 0x9c, 0x00, 0x00, 0x00, 0x18, 0x00, 0x30, 0x00,
+  0x48, 0x00, 0x5f, 0x00, 0x77, 0x00, 0x8e, 0x00, 0x00, 0x00, 0x12, 0x00,
+  0x25, 0x00, 0x32, 0x00, 0x40, 0x00, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1a, 0x00, 0x2c, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x15, 0x00, 0x29, 0x00,
+  0x3d, 0x00, 0x50, 0x00, 0x63, 0x00, 0x77, 0x00, 0x8c, 0x00, 0x9a, 0x00,
+  0xae, 0x00, 0xc1, 0x00, 0xce, 0x00, 0x00, 0x00, 0x11, 0x00, 0x27, 0x00,
+  0x38, 0x00, 0x4e, 0x00, 0x63, 0x00, 0x75, 0x00, 0x8a, 0x00, 0x97, 0x00,
+  0xad, 0x00, 0xc3, 0x00, 0xd8, 0x00, 0xe8, 0x00, 0x04, 0x01, 0x19, 0x01,
+  0x2e, 0x01, 0x3f, 0x01, 0x55, 0x01, 0x64, 0x01, 0x75, 0x01, 0x84, 0x01,
+  0x94, 0x01, 0xaa, 0x01, 0x00, 0x00, 0x11, 0x00, 0x22, 0x00, 0x33, 0x00,
+  0x44, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x19, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x28, 0x00, 0x3c, 0x00, 0x50, 0x00, 0x64, 0x00, 0x78, 0x00, 0x89, 0x00,
+  0x9a, 0x00, 0xaa, 0x00, 0xba, 0x00, 0xc3, 0x00, 0x00, 0x00, 0x16, 0x00,
+  0x00, 0x00, 0x11, 0x00, 0x22, 0x00, 0x33, 0x00, 0x44, 0x00, 0x54, 0x00,
+  0x63, 0x00, 0x74, 0x00, 0x8b, 0x00, 0x9c, 0x00, 0xad, 0x00, 0xbe, 0x00,
+  0xcf, 0x00, 0xe7, 0x00, 0x01, 0x01, 0x11, 0x01, 0x29, 0x01, 0x3a, 0x01,
+  0x54, 0x01, 0x6c, 0x01, 0x7d, 0x01, 0x8d, 0x01, 0xa5, 0x01, 0xb6, 0x01,
+  0xc7, 0x01, 0xdf, 0x01, 0xf7, 0x01, 0x08, 0x02, 0x19, 0x02, 0x31, 0x02,
+  0x42, 0x02, 0x53, 0x02, 0x6b, 0x02, 0x7c, 0x02, 0x8d, 0x02, 0x9d, 0x02,
+  0xb5, 0x02, 0xcd, 0x02, 0xda, 0x02, 0xeb, 0x02, 0xfc, 0x02, 0x0d, 0x03,
+  0x1e, 0x03, 0x3d, 0x03, 0x4e, 0x03, 0x5f, 0x03, 0x70, 0x03, 0x80, 0x03,
+  0x91, 0x03, 0xa2, 0x03, 0xb3, 0x03, 0xca, 0x03, 0xe2, 0x03, 0xf3, 0x03,
+  0x04, 0x04, 0x14, 0x04, 0x25, 0x04, 0x36, 0x04, 0x47, 0x04, 0x58, 0x04,
+  0x69, 0x04, 0x7a, 0x04, 0x00, 0x00, 0x1e, 0x00, 0x27, 0x00, 0x44, 0x00,
+  0x5c, 0x00, 0x75, 0x00, 0x88, 0x00, 0xa0, 0x00, 0xb9, 0x00, 0xd1, 0x00,
+  0xea, 0x00, 0x02, 0x01, 0x14, 0x01, 0x2a, 0x01, 0x42, 0x01, 0x56, 0x01,
+  0x00, 0x00, 0x11, 0x00, 0x22, 0x00, 0x2f, 0x00, 0x3f, 0x00, 0x50, 0x00,
+  0x61, 0x00, 0x71, 0x00, 0x82, 0x00, 0x93, 0x00, 0xa4, 0x00, 0xb5, 0x00,
+  0xc6, 0x00, 0xd6, 0x00, 0xe6, 0x00, 0xf6, 0x00, 0x06, 0x01, 0x17, 0x01,
+  0x26, 0x01, 0x37, 0x01, 0x47, 0x01, 0x58, 0x01, 0x68, 0x01, 0x79, 0x01,
+  0x8a, 0x01, 0x00, 0x00, 0x12, 0x00, 0x25, 0x00, 0x37, 0x00, 0x49, 0x00,
+  0x5b, 0x00, 0x6d, 0x00, 0x7f, 0x00, 0x91, 0x00, 0x00, 0x00, 0x1a, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x20, 0x00, 0x32, 0x00, 0x44, 0x00, 0x5b, 0x00,
+  0x6c, 0x00, 0x7f, 0x00, 0x91, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x11, 0x00,
+  0x21, 0x00, 0x31, 0x00, 0x42, 0x00, 0x52, 0x00, 0x62, 0x00, 0x72, 0x00,
+  0x82, 0x00, 0x92, 0x00, 0xab, 0x00, 0xbb, 0x00, 0xcc, 0x00, 0xdd, 0x00,
+  0xee, 0x00, 0xfb, 0x00, 0x0a, 0x01, 0x1b, 0x01, 0x2c, 0x01, 0x3d, 0x01,
+  0x4e, 0x01, 0x6d, 0x01, 0x7e, 0x01, 0x8f, 0x01, 0xa0, 0x01, 0xad, 0x01,
+  0xbe, 0x01, 0x00, 0x00, 0x1c, 0x00, 0x38, 0x00, 0x4a, 0x00, 0x5c, 0x00,
+  0x6e, 0x00, 0x80, 0x00, 0x93, 0x00, 0xa5, 0x00, 0xb7, 0x00, 0xca, 0x00,
+  0xdc, 0x00, 0xee, 0x00, 0x0b, 0x01, 0x1d, 0x01, 0x2f, 0x01, 0x4c, 0x01,
+  0x5f, 0x01, 0x71, 0x01, 0x82, 0x01, 0x94, 0x01, 0xa6, 0x01, 0xb8, 0x01,
+  0xca, 0x01, 0xdc, 0x01, 0x00, 0x00, 0x11, 0x00, 0x23, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x18, 0x00, 0x29, 0x00, 0x39, 0x00,
+  0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x34, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x2b, 0x00, 0x3b, 0x00, 0x54, 0x00, 0x63, 0x00, 0x7c, 0x00,
+  0x95, 0x00, 0xa7, 0x00, 0xb9, 0x00, 0xd2, 0x00, 0xe1, 0x00, 0xf0, 0x00,
+  0x09, 0x01, 0x22, 0x01, 0x3b, 0x01, 0x53, 0x01, 0x6c, 0x01, 0x7b, 0x01,
+  0x93, 0x01, 0x00, 0x00, 0x1a, 0x00, 0x33, 0x00, 0x4c, 0x00, 0x66, 0x00,
+  0x7d, 0x00, 0x97, 0x00, 0xb1, 0x00, 0xcb, 0x00, 0xde, 0x00, 0xf8, 0x00,
+  0x12, 0x01, 0x2c, 0x01, 0x46, 0x01, 0x59, 0x01, 0x6d, 0x01, 0x80, 0x01,
+  0xa2, 0x01, 0xc4, 0x01, 0xe6, 0x01, 0x00, 0x02, 0x17, 0x02, 0x31, 0x02,
+  0x44, 0x02, 0x55, 0x02, 0x68, 0x02, 0x78, 0x02, 0x8b, 0x02, 0x9c, 0x02,
+  0xb6, 0x02, 0xcf, 0x02, 0xe8, 0x02, 0x01, 0x03, 0x1a, 0x03, 0x34, 0x03,
+  0x4e, 0x03, 0x61, 0x03, 0x7a, 0x03, 0x8b, 0x03, 0xa6, 0x03, 0x00, 0x00,
+  0x1c, 0x00, 0x34, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x2c, 0x00, 0x3d, 0x00,
+  0x63, 0x00, 0x85, 0x00, 0x00, 0x00, 0x20, 0x00, 0x2f, 0x00, 0x4f, 0x00,
+  0x6e, 0x00, 0x8c, 0x00, 0x9a, 0x00, 0xb8, 0x00, 0xd6, 0x00, 0xf5, 0x00,
+  0x14, 0x01, 0x23, 0x01, 0x32, 0x01, 0x51, 0x01, 0x6b, 0x01, 0x89, 0x01,
+  0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x23, 0x00, 0x46, 0x00, 0x56, 0x00,
+  0x66, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x24, 0x00,
+  0x00, 0x00, 0x18, 0x00, 0x2f, 0x00, 0x47, 0x00, 0x5e, 0x00, 0x76, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x14, 0x00, 0x27, 0x00,
+  0x3b, 0x00, 0x4f, 0x00, 0x5f, 0x00, 0x6a, 0x00, 0x7e, 0x00, 0x99, 0x00,
+  0x00, 0x00, 0x16, 0x00, 0x21, 0x00, 0x37, 0x00, 0x4d, 0x00, 0x63, 0x00,
+  0x78, 0x00, 0x8e, 0x00, 0xa4, 0x00, 0xb8, 0x00, 0xce, 0x00, 0xe5, 0x00,
+  0xfb, 0x00, 0x25, 0x01, 0x34, 0x01, 0x4a, 0x01, 0x59, 0x01, 0x6f, 0x01,
+  0x00, 0x00, 0x0c, 0x00, 0x1f, 0x00, 0x35, 0x00, 0x4d, 0x00, 0x5e, 0x00,
+  0x72, 0x00, 0x83, 0x00, 0x94, 0x00, 0xae, 0x00, 0xc8, 0x00, 0x00, 0x00,
+  0x19, 0x00, 0x2b, 0x00, 0x35, 0x00, 0x47, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x27, 0x00, 0x3e, 0x00, 0x55, 0x00, 0x66, 0x00, 0x7d, 0x00, 0x92, 0x00,
+  0x9f, 0x00, 0xac, 0x00, 0xb9, 0x00, 0xcc, 0x00, 0xe3, 0x00, 0xf0, 0x00,
+  0x07, 0x01, 0x1e, 0x01, 0x2f, 0x01, 0x44, 0x01, 0x57, 0x01, 0x6f, 0x01,
+  0x86, 0x01, 0x9a, 0x01, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x1d, 0x00,
+  0x2e, 0x00, 0x3e, 0x00, 0x4f, 0x00, 0x5f, 0x00, 0x70, 0x00, 0x81, 0x00,
+  0x91, 0x00, 0xa2, 0x00, 0xb1, 0x00, 0xc2, 0x00, 0xd3, 0x00, 0xe4, 0x00,
+  0xf5, 0x00, 0x06, 0x01, 0x16, 0x01, 0x27, 0x01, 0x33, 0x01, 0x44, 0x01,
+  0x55, 0x01, 0x66, 0x01, 0x77, 0x01, 0x88, 0x01, 0x99, 0x01, 0xaa, 0x01,
+  0xbb, 0x01, 0xcc, 0x01, 0xdc, 0x01, 0xed, 0x01, 0xfe, 0x01, 0x0f, 0x02,
+  0x20, 0x02, 0x31, 0x02, 0x42, 0x02, 0x53, 0x02, 0x64, 0x02, 0x75, 0x02,
+  0x86, 0x02, 0x97, 0x02, 0xa8, 0x02, 0xb9, 0x02, 0xca, 0x02, 0xdb, 0x02,
+  0xe6, 0x02, 0xf6, 0x02, 0x06, 0x03, 0x16, 0x03, 0x27, 0x03, 0x38, 0x03,
+  0x48, 0x03, 0x59, 0x03, 0x6a, 0x03, 0x7a, 0x03, 0x8b, 0x03, 0x9a, 0x03,
+  0xab, 0x03, 0xbb, 0x03, 0xcc, 0x03, 0xdd, 0x03, 0xed, 0x03, 0xfd, 0x03,
+  0x0e, 0x04, 0x1f, 0x04, 0x30, 0x04, 0x41, 0x04, 0x52, 0x04, 0x63, 0x04,
+  0x00, 0x00, 0x06, 0x00, 0x25, 0x00, 0x3e, 0x00, 0x5a, 0x00, 0x76, 0x00,
+  0x8e, 0x00, 0xae, 0x00, 0xcb, 0x00, 0xe3, 0x00, 0xfb, 0x00, 0x14, 0x01,
+  0x00, 0x00, 0x0d, 0x00, 0x1e, 0x00, 0x2f, 0x00, 0x40, 0x00, 0x51, 0x00,
+  0x62, 0x00, 0x73, 0x00, 0x84, 0x00, 0x95, 0x00, 0xa6, 0x00, 0xb3, 0x00,
+  0xc3, 0x00, 0xd4, 0x00, 0xe5, 0x00, 0xf6, 0x00, 0x07, 0x01, 0x18, 0x01,
+  0x29, 0x01, 0x39, 0x01, 0x00, 0x00, 0x1b, 0x00, 0x37, 0x00, 0x42, 0x00,
+  0x00, 0x00, 0x11, 0x00, 0x22, 0x00, 0x00, 0x00, 0x11, 0x00, 0x29, 0x00,
+  0x41, 0x00, 0x52, 0x00, 0x63, 0x00, 0x7b, 0x00, 0x93, 0x00, 0xa7, 0x00,
+  0xb8, 0x00, 0xc9, 0x00, 0xda, 0x00, 0xf2, 0x00, 0x03, 0x01, 0x14, 0x01,
+  0x26, 0x01, 0x3e, 0x01, 0x4f, 0x01, 0x67, 0x01, 0x77, 0x01, 0x8a, 0x01,
+  0x9c, 0x01, 0xaf, 0x01, 0xc0, 0x01, 0xd1, 0x01, 0xe1, 0x01, 0xf9, 0x01,
+  0x0a, 0x02, 0x1b, 0x02, 0x2e, 0x02, 0x42, 0x02, 0x56, 0x02, 0x66, 0x02,
+  0x77, 0x02, 0x88, 0x02, 0x9c, 0x02, 0xad, 0x02, 0xbe, 0x02, 0xcf, 0x02,
+  0xe0, 0x02, 0xef, 0x02, 0x03, 0x03, 0x14, 0x03, 0x25, 0x03, 0x3c, 0x03,
+  0x54, 0x03, 0x68, 0x03, 0x78, 0x03, 0x89, 0x03, 0x9a, 0x03, 0xad, 0x03,
+  0xbe, 0x03, 0xce, 0x03, 0xe6, 0x03, 0x00, 0x00, 0x18, 0x00, 0x2d, 0x00,
+  0x3d, 0x00, 0x55, 0x00, 0x00, 0x00, 0x18, 0x00, 0x33, 0x00, 0x4e, 0x00,
+  0x66, 0x00, 0x7e, 0x00, 0x95, 0x00, 0xab, 0x00, 0xc6, 0x00, 0xe0, 0x00,
+  0xfa, 0x00, 0x15, 0x01, 0x2d, 0x01, 0x45, 0x01, 0x60, 0x01, 0x7b, 0x01,
+  0x95, 0x01, 0xb0, 0x01, 0xc8, 0x01, 0xe0, 0x01, 0xf8, 0x01, 0x13, 0x02,
+  0x2a, 0x02, 0x45, 0x02, 0x5c, 0x02, 0x77, 0x02, 0x92, 0x02, 0xad, 0x02,
+  0xc5, 0x02, 0xdd, 0x02, 0xf5, 0x02, 0x10, 0x03, 0x2b, 0x03, 0x45, 0x03,
+  0x5c, 0x03, 0x74, 0x03, 0x8b, 0x03, 0xa6, 0x03, 0xc0, 0x03, 0x00, 0x00,
+  0x0b, 0x00, 0x16, 0x00, 0x20, 0x00, 0x33, 0x00, 0x00, 0x00, 0x1a, 0x00,
+  0x27, 0x00, 0x36, 0x00, 0x51, 0x00, 0x6c, 0x00, 0x77, 0x00, 0x92, 0x00,
+  0xa1, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x3d, 0x00,
+  0x57, 0x00, 0x79, 0x00, 0x9b, 0x00, 0xb6, 0x00, 0xd1, 0x00, 0xd8, 0x00,
+  0xf2, 0x00, 0x0e, 0x01, 0x29, 0x01, 0x44, 0x01, 0x66, 0x01, 0x80, 0x01,
+  0x9b, 0x01, 0xb6, 0x01, 0xd0, 0x01, 0xea, 0x01, 0x00, 0x00, 0x0d, 0x00,
+  0x1a, 0x00, 0x2c, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x14, 0x00, 0x21, 0x00,
+  0x2e, 0x00, 0x3b, 0x00, 0x4e, 0x00, 0x5b, 0x00, 0x78, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x1d, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x11, 0x00, 0x22, 0x00,
+  0x36, 0x00, 0x4c, 0x00, 0x5f, 0x00, 0x73, 0x00, 0x84, 0x00, 0x9f, 0x00,
+  0xb0, 0x00, 0xc0, 0x00, 0xd9, 0x00, 0xea, 0x00, 0xfb, 0x00, 0x0c, 0x01,
+  0x1d, 0x01, 0x2d, 0x01, 0x43, 0x01, 0x54, 0x01, 0x6d, 0x01, 0x7e, 0x01,
+  0x96, 0x01, 0xa7, 0x01, 0xbb, 0x01, 0xcf, 0x01, 0xe1, 0x01, 0xf1, 0x01,
+  0x01, 0x02, 0x18, 0x02, 0x29, 0x02, 0x43, 0x02, 0x53, 0x02, 0x64, 0x02,
+  0x76, 0x02, 0x87, 0x02, 0x9e, 0x02, 0xae, 0x02, 0xbe, 0x02, 0xdd, 0x02,
+  0xee, 0x02, 0x00, 0x00, 0x0d, 0x00, 0x1a, 0x00, 0x3a, 0x00, 0x4e, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x24, 0x00, 0x3a, 0x00, 0x53, 0x00, 0x6d, 0x00,
+  0x89, 0x00, 0xa2, 0x00, 0xbb, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x34, 0x00,
+  0x50, 0x00, 0x6b, 0x00, 0x84, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x0f, 0x00,
+  0x1f, 0x00, 0x30, 0x00, 0x4b, 0x00, 0x67, 0x00, 0x00, 0x00, 0x14, 0x00,
+  0x38, 0x00, 0x4b, 0x00, 0x5f, 0x00, 0x73, 0x00, 0x86, 0x00, 0x99, 0x00,
+  0xad, 0x00, 0xc0, 0x00, 0xc9, 0x00, 0xed, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x12, 0x00, 0x2f, 0x00, 0x41, 0x00, 0x59, 0x00, 0x80, 0x00, 0x90, 0x00,
+  0xa2, 0x00, 0xb4, 0x00, 0xc6, 0x00, 0x00, 0x00, 0x18, 0x00, 0x2f, 0x00,
+  0x45, 0x00, 0x5d, 0x00, 0x74, 0x00, 0x80, 0x00, 0x98, 0x00, 0xb0, 0x00,
+  0xc8, 0x00, 0xdf, 0x00, 0xf6, 0x00, 0x00, 0x00, 0x11, 0x00, 0x2a, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x21, 0x00, 0x34, 0x00, 0x4d, 0x00, 0x5c, 0x00,
+  0x70, 0x00, 0x00, 0x00, 0x16, 0x00, 0x2c, 0x00, 0x42, 0x00, 0x58, 0x00,
+  0x6e, 0x00, 0x80, 0x00, 0x95, 0x00, 0xaa, 0x00, 0xc0, 0x00, 0xd6, 0x00,
+  0xed, 0x00, 0x02, 0x01, 0x00, 0x00, 0x15, 0x00, 0x27, 0x00, 0x3b, 0x00,
+  0x4f, 0x00, 0x63, 0x00, 0x76, 0x00, 0x8a, 0x00, 0x9e, 0x00, 0xb1, 0x00,
+  0xc4, 0x00, 0xd8, 0x00, 0xea, 0x00, 0xfe, 0x00, 0x12, 0x01, 0x26, 0x01,
+  0x38, 0x01, 0x4b, 0x01, 0x5d, 0x01, 0x6f, 0x01, 0x83, 0x01, 0x97, 0x01,
+  0xaa, 0x01, 0xbd, 0x01, 0xd0, 0x01, 0xe2, 0x01, 0xf6, 0x01, 0x0a, 0x02,
+  0x1c, 0x02, 0x30, 0x02, 0x43, 0x02, 0x56, 0x02, 0x64, 0x02, 0x77, 0x02,
+  0x8a, 0x02, 0x9c, 0x02, 0xb0, 0x02, 0xc4, 0x02, 0xd7, 0x02, 0xeb, 0x02,
+  0xff, 0x02, 0x12, 0x03, 0x26, 0x03, 0x3a, 0x03, 0x4e, 0x03, 0x61, 0x03,
+  0x75, 0x03, 0x88, 0x03, 0x9b, 0x03, 0xae, 0x03, 0xc1, 0x03, 0xd4, 0x03,
+  0x00, 0x00, 0x11, 0x00, 0x22, 0x00, 0x34, 0x00, 0x00, 0x00, 0x14, 0x00,
+  0x27, 0x00, 0x3f, 0x00, 0x52, 0x00, 0x69, 0x00, 0x80, 0x00, 0x94, 0x00,
+  0xa8, 0x00, 0xbd, 0x00, 0xd0, 0x00, 0xe3, 0x00, 0x00, 0x00, 0x1b, 0x00,
+  0x38, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x11, 0x00, 0x29, 0x00, 0x3a, 0x00,
+  0x4b, 0x00, 0x58, 0x00, 0x69, 0x00, 0x7a, 0x00, 0x8b, 0x00, 0x9c, 0x00,
+  0xb1, 0x00, 0xc2, 0x00, 0x00, 0x00, 0x18, 0x00, 0x30, 0x00, 0x49, 0x00,
+  0x62, 0x00, 0x7b, 0x00, 0x94, 0x00, 0xb3, 0x00, 0xcc, 0x00, 0xe5, 0x00,
+  0xfe, 0x00, 0x17, 0x01, 0x30, 0x01, 0x48, 0x01, 0x61, 0x01, 0x00, 0x00,
+  0x10, 0x00, 0x21, 0x00, 0x31, 0x00, 0x42, 0x00, 0x5d, 0x00, 0x6d, 0x00,
+  0x7e, 0x00, 0x8e, 0x00, 0x9f, 0x00, 0xae, 0x00, 0xbd, 0x00, 0xce, 0x00,
+  0xdd, 0x00, 0xee, 0x00, 0xfe, 0x00, 0x0e, 0x01, 0x1e, 0x01, 0x30, 0x01,
+  0x4a, 0x01, 0x5b, 0x01, 0x6c, 0x01, 0x7c, 0x01, 0x95, 0x01, 0xa5, 0x01,
+  0xb5, 0x01, 0xc5, 0x01, 0xd5, 0x01, 0xe6, 0x01, 0x00, 0x00, 0x12, 0x00,
+  0x23, 0x00, 0x34, 0x00, 0x46, 0x00, 0x58, 0x00, 0x6a, 0x00, 0x7c, 0x00,
+  0x8e, 0x00, 0xaa, 0x00, 0xbc, 0x00, 0xcd, 0x00, 0xdf, 0x00, 0xf1, 0x00,
+  0x03, 0x01, 0x15, 0x01, 0x27, 0x01, 0x3a, 0x01, 0x4c, 0x01, 0x5e, 0x01,
+  0x6f, 0x01, 0x80, 0x01, 0x92, 0x01, 0xa4, 0x01, 0xb6, 0x01, 0xc8, 0x01,
+  0xda, 0x01, 0xec, 0x01, 0xfe, 0x01, 0x10, 0x02, 0x21, 0x02, 0x32, 0x02,
+  0x43, 0x02, 0x54, 0x02, 0x70, 0x02, 0x81, 0x02, 0x93, 0x02, 0xa5, 0x02,
+  0xb7, 0x02, 0xd4, 0x02, 0xe6, 0x02, 0xf8, 0x02, 0x0a, 0x03, 0x00, 0x00,
+  0x0c, 0x00, 0x19, 0x00, 0x26, 0x00, 0x33, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x15, 0x00, 0x00, 0x00, 0x11, 0x00, 0x22, 0x00, 0x33, 0x00, 0x44, 0x00,
+  0x55, 0x00, 0x66, 0x00, 0x77, 0x00, 0x88, 0x00, 0x99, 0x00, 0xaa, 0x00,
+  0xbb, 0x00, 0xcc, 0x00, 0xe0, 0x00, 0xef, 0x00, 0x00, 0x01, 0x11, 0x01,
+  0x21, 0x01, 0x31, 0x01, 0x42, 0x01, 0x53, 0x01, 0x64, 0x01, 0x73, 0x01,
+  0x84, 0x01, 0x99, 0x01, 0xaa, 0x01, 0xbb, 0x01, 0xcc, 0x01, 0xdd, 0x01,
+  0xec, 0x01, 0xfe, 0x01, 0x0f, 0x02, 0x1e, 0x02, 0x2d, 0x02, 0x3e, 0x02,
+  0x4d, 0x02, 0x5e, 0x02, 0x6f, 0x02, 0x00, 0x00, 0x17, 0x00, 0x2e, 0x00,
+  0x3d, 0x00, 0x4c, 0x00, 0x63, 0x00, 0x7e, 0x00, 0x9a, 0x00, 0xb5, 0x00,
+  0xc0, 0x00, 0xd7, 0x00, 0xed, 0x00, 0x02, 0x01, 0x00, 0x00, 0x17, 0x00,
+  0x2f, 0x00, 0x46, 0x00, 0x61, 0x00, 0x78, 0x00, 0x90, 0x00, 0x9b, 0x00,
+  0xb3, 0x00, 0xcb, 0x00, 0xe3, 0x00, 0xfa, 0x00, 0x11, 0x01, 0x2f, 0x01,
+  0x47, 0x01, 0x5f, 0x01, 0x00, 0x00, 0x17, 0x00, 0x2f, 0x00, 0x41, 0x00,
+  0x59, 0x00, 0x71, 0x00, 0x00, 0x00, 0x14, 0x00, 0x27, 0x00, 0x3b, 0x00,
+  0x4e, 0x00, 0x62, 0x00, 0x76, 0x00, 0x85, 0x00, 0x00, 0x00, 0x0a, 0x00,
+  0x15, 0x00, 0x2b, 0x00, 0x35, 0x00, 0x47, 0x00, 0x56, 0x00, 0x67, 0x00,
+  0x79, 0x00, 0x83, 0x00, 0x9a, 0x00, 0x00, 0x00, 0x07, 0x00, 0x20, 0x00,
+  0x00, 0x00, 0x17, 0x00, 0x24, 0x00, 0x31, 0x00, 0x3e, 0x00, 0x56, 0x00,
+  0x6d, 0x00, 0x86, 0x00, 0x9e, 0x00, 0xb6, 0x00, 0xce, 0x00, 0xdf, 0x00,
+  0xf7, 0x00, 0x10, 0x01, 0x28, 0x01, 0x40, 0x01, 0x58, 0x01, 0x70, 0x01,
+  0x87, 0x01, 0x9e, 0x01, 0xb5, 0x01, 0xcd, 0x01, 0xe5, 0x01, 0x00, 0x00,
+  0x1b, 0x00, 0x36, 0x00, 0x50, 0x00, 0x69, 0x00, 0x83, 0x00, 0x97, 0x00,
+  0xaf, 0x00, 0xc7, 0x00, 0xd4, 0x00, 0xee, 0x00, 0x07, 0x01, 0x15, 0x01,
+  0x2f, 0x01, 0x48, 0x01, 0x62, 0x01, 0x00, 0x00, 0x18, 0x00, 0x30, 0x00,
+  0x49, 0x00, 0x61, 0x00, 0x73, 0x00, 0x8b, 0x00, 0xa3, 0x00, 0xbb, 0x00,
+  0xca, 0x00, 0xe3, 0x00, 0xfb, 0x00, 0x17, 0x01, 0x29, 0x01, 0x41, 0x01,
+  0x59, 0x01, 0x71, 0x01, 0x83, 0x01, 0x9a, 0x01, 0x00, 0x00, 0x14, 0x00,
+  0x27, 0x00, 0x3b, 0x00, 0x4f, 0x00, 0x62, 0x00, 0x76, 0x00, 0x89, 0x00,
+  0x9d, 0x00, 0xae, 0x00, 0xc2, 0x00, 0xd6, 0x00, 0xea, 0x00, 0xfe, 0x00,
+  0x12, 0x01, 0x26, 0x01, 0x3a, 0x01, 0x4a, 0x01, 0x5e, 0x01, 0x72, 0x01,
+  0x86, 0x01, 0x97, 0x01, 0xaa, 0x01, 0xbe, 0x01, 0xd2, 0x01, 0xe6, 0x01,
+  0xfa, 0x01, 0x0e, 0x02, 0x22, 0x02, 0x36, 0x02, 0x4a, 0x02, 0x5e, 0x02,
+  0x72, 0x02, 0x86, 0x02, 0x96, 0x02, 0xa9, 0x02, 0xbd, 0x02, 0xd1, 0x02,
+  0xe5, 0x02, 0xf9, 0x02, 0x0d, 0x03, 0x20, 0x03, 0x33, 0x03, 0x46, 0x03,
+  0x58, 0x03, 0x6c, 0x03, 0x7f, 0x03, 0x93, 0x03, 0xa7, 0x03, 0xbb, 0x03,
+  0xcf, 0x03, 0xe2, 0x03, 0xec, 0x03, 0x00, 0x04, 0x17, 0x04, 0x2b, 0x04,
+  0x3e, 0x04, 0x52, 0x04, 0x66, 0x04, 0x77, 0x04, 0x8c, 0x04, 0x9c, 0x04,
+  0xb0, 0x04, 0xc4, 0x04, 0x00, 0x00, 0x18, 0x00, 0x30, 0x00, 0x48, 0x00,
+  0x67, 0x00, 0x7f, 0x00, 0x98, 0x00, 0xb1, 0x00, 0xbd, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x1c, 0x00, 0x36, 0x00, 0x57, 0x00, 0x77, 0x00, 0x92, 0x00,
+  0xac, 0x00, 0xcd, 0x00, 0xee, 0x00, 0xfb, 0x00, 0x1c, 0x01, 0x3c, 0x01,
+  0x5c, 0x01, 0x77, 0x01, 0x00, 0x00, 0x1c, 0x00, 0x2b, 0x00, 0x48, 0x00,
+  0x00, 0x00, 0x05, 0x00, 0x0c, 0x00, 0x1e, 0x00, 0x3c, 0x00, 0x00, 0x00,
+  0x18, 0x00, 0x3b, 0x00, 0x4d, 0x00, 0x5e, 0x00, 0x00, 0x00, 0x1b, 0x00,
+  0x35, 0x00, 0x44, 0x00, 0x69, 0x00, 0x7a, 0x00, 0x95, 0x00, 0xb0, 0x00,
+  0xc8, 0x00, 0xe2, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x1e, 0x00,
+  0x44, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x20, 0x00,
+  0x00, 0x00, 0x15, 0x00, 0x2b, 0x00, 0x41, 0x00, 0x57, 0x00, 0x6c, 0x00,
+  0x82, 0x00, 0x98, 0x00, 0xae, 0x00, 0xc3, 0x00, 0xd9, 0x00, 0xfd, 0x00,
+  0x0b, 0x01, 0x21, 0x01, 0x36, 0x01, 0x4c, 0x01, 0x62, 0x01, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x14, 0x00, 0x1e, 0x00, 0x37, 0x00,
+  0x50, 0x00, 0x62, 0x00, 0x72, 0x00, 0x82, 0x00, 0x9b, 0x00, 0xad, 0x00,
+  0x00, 0x00, 0x14, 0x00, 0x27, 0x00, 0x3b, 0x00, 0x67, 0x00, 0x7d, 0x00,
+  0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x10, 0x00, 0x21, 0x00, 0x3c, 0x00,
+  0x55, 0x00, 0x6f, 0x00, 0x89, 0x00, 0xa3, 0x00, 0xbd, 0x00, 0xc9, 0x00,
+  0xe2, 0x00, 0xf3, 0x00, 0x0d, 0x01, 0x1a, 0x01, 0x31, 0x01, 0x4c, 0x01,
+  0x62, 0x01, 0x7d, 0x01, 0x97, 0x01, 0x00, 0x00, 0x1c, 0x00, 0x39, 0x00,
+  0x52, 0x00, 0x5f, 0x00, 0x7c, 0x00, 0x9c, 0x00, 0x00, 0x00, 0x11, 0x00,
+  0x21, 0x00, 0x32, 0x00, 0x43, 0x00, 0x53, 0x00, 0x63, 0x00, 0x73, 0x00,
+  0x83, 0x00, 0x94, 0x00, 0xa4, 0x00, 0xb5, 0x00, 0xd0, 0x00, 0xe1, 0x00,
+  0xf1, 0x00, 0x02, 0x01, 0x13, 0x01, 0x23, 0x01, 0x44, 0x01, 0x54, 0x01,
+  0x75, 0x01, 0x85, 0x01, 0x95, 0x01, 0xa5, 0x01, 0xb6, 0x01, 0xc6, 0x01,
+  0xd7, 0x01, 0xe7, 0x01, 0xf7, 0x01, 0x08, 0x02, 0x00, 0x00, 0x12, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x21, 0x00, 0x3b, 0x00, 0x55, 0x00, 0x70, 0x00,
+  0x8b, 0x00, 0xa6, 0x00, 0xc1, 0x00, 0xdc, 0x00, 0xf6, 0x00, 0x10, 0x01,
+  0x2a, 0x01, 0x39, 0x01, 0x54, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x18, 0x00, 0x29, 0x00, 0x3a, 0x00, 0x4b, 0x00, 0x5c, 0x00, 0x6d, 0x00,
+  0x7e, 0x00, 0x8f, 0x00, 0xa0, 0x00, 0xb6, 0x00, 0xcc, 0x00, 0xdd, 0x00,
+  0xf3, 0x00, 0x09, 0x01, 0x21, 0x01, 0x39, 0x01, 0x49, 0x01, 0x5a, 0x01,
+  0x70, 0x01, 0x86, 0x01, 0x9d, 0x01, 0xb4, 0x01, 0xc5, 0x01, 0xd6, 0x01,
+  0xf4, 0x01, 0x0b, 0x02, 0x1c, 0x02, 0x32, 0x02, 0x43, 0x02, 0x54, 0x02,
+  0x64, 0x02, 0x75, 0x02, 0x8c, 0x02, 0x9d, 0x02, 0xb4, 0x02, 0xcb, 0x02,
+  0xf0, 0x02, 0x01, 0x03, 0x18, 0x03, 0x37, 0x03, 0x4e, 0x03, 0x5d, 0x03,
+  0x6e, 0x03, 0x00, 0x00, 0x1c, 0x00, 0x3c, 0x00, 0x57, 0x00, 0x74, 0x00,
+  0x82, 0x00, 0x9f, 0x00, 0xbe, 0x00, 0xdd, 0x00, 0xf9, 0x00, 0x19, 0x01,
+  0x39, 0x01, 0x58, 0x01, 0x79, 0x01, 0x99, 0x01, 0xa9, 0x01, 0xc8, 0x01,
+  0xe7, 0x01, 0x06, 0x02, 0x00, 0x00, 0x14, 0x00, 0x2a, 0x00, 0x37, 0x00,
+  0x44, 0x00, 0x51, 0x00, 0x68, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x1f, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x18, 0x00, 0x22, 0x00, 0x33, 0x00,
+  0x44, 0x00, 0x00, 0x00, 0x05, 0x00, 0x0c, 0x00, 0x27, 0x00, 0x41, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x31, 0x00, 0x3e, 0x00, 0x52, 0x00,
+  0x66, 0x00, 0x79, 0x00, 0x88, 0x00, 0xa2, 0x00, 0x00, 0x00, 0x11, 0x00,
+  0x2d, 0x00, 0x36, 0x00, 0x48, 0x00, 0x59, 0x00, 0x6a, 0x00, 0x7c, 0x00,
+  0x8d, 0x00, 0x00, 0x00, 0x12, 0x00, 0x26, 0x00, 0x39, 0x00, 0x4c, 0x00,
+  0x5f, 0x00, 0x73, 0x00, 0x87, 0x00, 0xa0, 0x00, 0xbf, 0x00, 0xd3, 0x00,
+  0xed, 0x00, 0x00, 0x01, 0x13, 0x01, 0x27, 0x01, 0x3a, 0x01, 0x4e, 0x01,
+  0x62, 0x01, 0x7c, 0x01, 0x90, 0x01, 0xa3, 0x01, 0xb7, 0x01, 0xcb, 0x01,
+  0xe5, 0x01, 0xf8, 0x01, 0x0c, 0x02, 0x1f, 0x02, 0x33, 0x02, 0x47, 0x02,
+  0x5a, 0x02, 0x6d, 0x02, 0x80, 0x02, 0x93, 0x02, 0xa7, 0x02, 0xbb, 0x02,
+  0xcf, 0x02, 0xe3, 0x02, 0xfe, 0x02, 0x12, 0x03, 0x26, 0x03, 0x3a, 0x03,
+  0x47, 0x03, 0x5e, 0x03, 0x00, 0x00, 0x18, 0x00, 0x37, 0x00, 0x4f, 0x00,
+  0x6e, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x2a, 0x00, 0x43, 0x00, 0x5d, 0x00,
+  0x71, 0x00, 0x8b, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x28, 0x00, 0x45, 0x00,
+  0x5e, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x23, 0x00, 0x3c, 0x00, 0x57, 0x00,
+  0x67, 0x00, 0x81, 0x00, 0x9b, 0x00, 0xb6, 0x00, 0xd1, 0x00, 0xe4, 0x00,
+  0xf8, 0x00, 0x1a, 0x01, 0x34, 0x01, 0x4e, 0x01, 0x00, 0x00, 0x0a, 0x00,
+  0x29, 0x00, 0x49, 0x00, 0x69, 0x00, 0x89, 0x00, 0xa9, 0x00, 0xc9, 0x00,
+  0xe9, 0x00, 0x00, 0x00, 0x16, 0x00, 0x2e, 0x00, 0x4f, 0x00, 0x69, 0x00,
+  0x8c, 0x00, 0xa1, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x37, 0x00, 0x53, 0x00,
+  0x61, 0x00, 0x6f, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x26, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x24, 0x00, 0x36, 0x00, 0x47, 0x00, 0x5d, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x28, 0x00, 0x3c, 0x00, 0x50, 0x00, 0x59, 0x00, 0x77, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x21, 0x00, 0x32, 0x00, 0x43, 0x00, 0x55, 0x00,
+  0x6b, 0x00, 0x7c, 0x00, 0x92, 0x00, 0xa5, 0x00, 0xbb, 0x00, 0xcc, 0x00,
+  0xde, 0x00, 0xf4, 0x00, 0x04, 0x01, 0x1a, 0x01, 0x2b, 0x01, 0x41, 0x01,
+  0x55, 0x01, 0x66, 0x01, 0x76, 0x01, 0x86, 0x01, 0x97, 0x01, 0xa8, 0x01,
+  0xb9, 0x01, 0xca, 0x01, 0xdb, 0x01, 0xec, 0x01, 0xfd, 0x01, 0x0e, 0x02,
+  0x1f, 0x02, 0x35, 0x02, 0x46, 0x02, 0x5c, 0x02, 0x6d, 0x02, 0x00, 0x00,
+  0x13, 0x00, 0x2d, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1a, 0x00,
+  0x29, 0x00, 0x37, 0x00, 0x46, 0x00, 0x59, 0x00, 0x68, 0x00, 0x77, 0x00,
+  0x93, 0x00, 0xb3, 0x00, 0xc3, 0x00, 0xd2, 0x00, 0xe1, 0x00, 0xf0, 0x00,
+  0xff, 0x00, 0x0d, 0x01, 0x1c, 0x01, 0x2b, 0x01, 0x3a, 0x01, 0x49, 0x01,
+  0x59, 0x01, 0x68, 0x01, 0x77, 0x01, 0x00, 0x00, 0x1a, 0x00, 0x34, 0x00,
+  0x4b, 0x00, 0x65, 0x00, 0x7c, 0x00, 0x92, 0x00, 0xac, 0x00, 0xc6, 0x00,
+  0xdd, 0x00, 0xea, 0x00, 0xf7, 0x00, 0x11, 0x01, 0x2b, 0x01, 0x42, 0x01,
+  0x59, 0x01, 0x70, 0x01, 0x8f, 0x01, 0xa6, 0x01, 0xb3, 0x01, 0xc0, 0x01,
+  0xcd, 0x01, 0xe7, 0x01, 0x00, 0x00, 0x0f, 0x00, 0x1e, 0x00, 0x2d, 0x00,
+  0x3c, 0x00, 0x4a, 0x00, 0x59, 0x00, 0x79, 0x00, 0x88, 0x00, 0x97, 0x00,
+  0xa6, 0x00, 0xb5, 0x00, 0xc4, 0x00, 0xd2, 0x00, 0xe1, 0x00, 0xf0, 0x00,
+  0xfd, 0x00, 0x1b, 0x01, 0x2a, 0x01, 0x39, 0x01, 0x00, 0x00, 0x0d, 0x00,
+  0x2b, 0x00, 0x4a, 0x00, 0x69, 0x00, 0x76, 0x00, 0x83, 0x00, 0x9d, 0x00,
+  0xbc, 0x00, 0xdb, 0x00, 0xf9, 0x00, 0x18, 0x01, 0x37, 0x01, 0x56, 0x01,
+  0x75, 0x01, 0x93, 0x01, 0x00, 0x00, 0x1c, 0x00, 0x2a, 0x00, 0x39, 0x00,
+  0x48, 0x00, 0x57, 0x00, 0x69, 0x00, 0x7b, 0x00, 0x8d, 0x00, 0x9f, 0x00,
+  0xbb, 0x00, 0xd7, 0x00, 0xe9, 0x00, 0xf7, 0x00, 0x05, 0x01, 0x14, 0x01,
+  0x26, 0x01, 0x46, 0x01, 0x55, 0x01, 0x67, 0x01, 0x78, 0x01, 0x8a, 0x01,
+  0x99, 0x01, 0xaa, 0x01, 0xb9, 0x01, 0xc8, 0x01, 0xe4, 0x01, 0xf6, 0x01,
+  0x00, 0x00, 0x0c, 0x00, 0x19, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1c, 0x00,
+  0x2b, 0x00, 0x3a, 0x00, 0x49, 0x00, 0x56, 0x00, 0x65, 0x00, 0x74, 0x00,
+  0x83, 0x00, 0x92, 0x00, 0xae, 0x00, 0xbb, 0x00, 0xc9, 0x00, 0xd8, 0x00,
+  0xe5, 0x00, 0x00, 0x01, 0x0f, 0x01, 0x1e, 0x01, 0x2b, 0x01, 0x3a, 0x01,
+  0x48, 0x01, 0x67, 0x01, 0x86, 0x01, 0x93, 0x01, 0x9e, 0x01, 0xad, 0x01,
+  0xca, 0x01, 0x00, 0x00, 0x18, 0x00, 0x25, 0x00, 0x49, 0x00, 0x64, 0x00,
+  0x83, 0x00, 0xa2, 0x00, 0xbc, 0x00, 0xd4, 0x00, 0xeb, 0x00, 0x0a, 0x01,
+  0x21, 0x01, 0x2e, 0x01, 0x00, 0x00, 0x12, 0x00, 0x24, 0x00, 0x36, 0x00,
+  0x48, 0x00, 0x5a, 0x00, 0x6c, 0x00, 0x7b, 0x00, 0x8d, 0x00, 0x98, 0x00,
+  0xaa, 0x00, 0xbc, 0x00, 0xcd, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x35, 0x00,
+  0x44, 0x00, 0x5f, 0x00, 0x72, 0x00, 0x8c, 0x00, 0xa7, 0x00, 0xc2, 0x00,
+  0xdd, 0x00, 0xf8, 0x00, 0x13, 0x01, 0x00, 0x00, 0x20, 0x00, 0x2f, 0x00,
+  0x46, 0x00, 0x00, 0x00, 0x11, 0x00, 0x30, 0x00, 0x4f, 0x00, 0x6f, 0x00,
+  0x8d, 0x00, 0xa0, 0x00, 0xbf, 0x00, 0xde, 0x00, 0xf8, 0x00, 0x13, 0x01,
+  0x2e, 0x01, 0x4d, 0x01, 0x5a, 0x01, 0x79, 0x01, 0x98, 0x01, 0xb7, 0x01,
+  0xd6, 0x01, 0xf5, 0x01, 0x14, 0x02, 0x33, 0x02, 0x52, 0x02, 0x71, 0x02,
+  0x90, 0x02, 0xaf, 0x02, 0xcd, 0x02, 0xeb, 0x02, 0x0a, 0x03, 0x29, 0x03,
+  0x49, 0x03, 0x5c, 0x03, 0x6f, 0x03, 0x8f, 0x03, 0xa9, 0x03, 0xc8, 0x03,
+  0xe5, 0x03, 0x03, 0x04, 0x1e, 0x04, 0x3b, 0x04, 0x56, 0x04, 0x00, 0x00,
+  0x0b, 0x00, 0x2a, 0x00, 0x35, 0x00, 0x54, 0x00, 0x74, 0x00, 0x93, 0x00,
+  0xa9, 0x00, 0xc9, 0x00, 0xda, 0x00, 0xef, 0x00, 0x06, 0x01, 0x17, 0x01,
+  0x00, 0x00, 0x11, 0x00, 0x22, 0x00, 0x33, 0x00, 0x00, 0x00, 0x19, 0x00,
+  0x31, 0x00, 0x49, 0x00, 0x5b, 0x00, 0x74, 0x00, 0x86, 0x00, 0x00, 0x00,
+  0x16, 0x00, 0x35, 0x00, 0x42, 0x00, 0x56, 0x00, 0x6a, 0x00, 0x89, 0x00,
+  0xa8, 0x00, 0xc7, 0x00, 0xd8, 0x00, 0xee, 0x00, 0x0d, 0x01, 0x2c, 0x01,
+  0x4b, 0x01, 0x69, 0x01, 0x86, 0x01, 0xa4, 0x01, 0xbe, 0x01, 0xcb, 0x01,
+  0xea, 0x01, 0x08, 0x02, 0x17, 0x02, 0x00, 0x00, 0x19, 0x00, 0x32, 0x00,
+  0x4a, 0x00, 0x64, 0x00, 0x71, 0x00, 0x89, 0x00, 0xa1, 0x00, 0xba, 0x00,
+  0xd3, 0x00, 0xeb, 0x00, 0x04, 0x01, 0x1d, 0x01, 0x34, 0x01, 0x4c, 0x01,
+  0x64, 0x01, 0x7d, 0x01, 0x98, 0x01, 0xb1, 0x01, 0xca, 0x01, 0xe2, 0x01,
+  0xfb, 0x01, 0x13, 0x02, 0x25, 0x02, 0x44, 0x02, 0x5d, 0x02, 0x75, 0x02,
+  0x8d, 0x02, 0xa6, 0x02, 0xbf, 0x02, 0xd8, 0x02, 0xf1, 0x02, 0x09, 0x03,
+  0x25, 0x03, 0x3c, 0x03, 0x59, 0x03, 0x72, 0x03, 0x8b, 0x03, 0xa4, 0x03,
+  0xbd, 0x03, 0xd6, 0x03, 0xef, 0x03, 0x08, 0x04, 0x28, 0x04, 0x40, 0x04,
+  0x59, 0x04, 0x72, 0x04, 0x8b, 0x04, 0xa4, 0x04, 0x00, 0x00, 0x0f, 0x00,
+  0x26, 0x00, 0x34, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x38, 0x00, 0x51, 0x00,
+  0x68, 0x00, 0x80, 0x00, 0x98, 0x00, 0xb0, 0x00, 0xc9, 0x00, 0xe4, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x1c, 0x00, 0x37, 0x00, 0x44, 0x00, 0x5f, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x2b, 0x00, 0x4a, 0x00, 0x67, 0x00, 0x86, 0x00,
+  0xa3, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x23, 0x00, 0x42, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x23, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x24, 0x00, 0x35, 0x00, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x28, 0x00, 0x3c, 0x00, 0x50, 0x00, 0x63, 0x00, 0x77, 0x00,
+  0x8b, 0x00, 0xa0, 0x00, 0xb4, 0x00, 0xc8, 0x00, 0xdc, 0x00, 0xf0, 0x00,
+  0x00, 0x00, 0x13, 0x00, 0x29, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x12, 0x00,
+  0x28, 0x00, 0x00, 0x00, 0x19, 0x00, 0x26, 0x00, 0x3f, 0x00, 0x58, 0x00,
+  0x65, 0x00, 0x7e, 0x00, 0x97, 0x00, 0xa4, 0x00, 0xbc, 0x00, 0x00, 0x00,
+  0x15, 0x00, 0x29, 0x00, 0x3d, 0x00, 0x4b, 0x00, 0x5a, 0x00, 0x6e, 0x00,
+  0x86, 0x00, 0x9e, 0x00, 0xb2, 0x00, 0xca, 0x00, 0xd9, 0x00, 0xe8, 0x00,
+  0xf7, 0x00, 0x0f, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x3f, 0x01, 0x4e, 0x01,
+  0x65, 0x01, 0x7c, 0x01, 0x94, 0x01, 0xa3, 0x01, 0xba, 0x01, 0xd1, 0x01,
+  0xe9, 0x01, 0x01, 0x02, 0x15, 0x02, 0x2c, 0x02, 0x3b, 0x02, 0x53, 0x02,
+  0x6b, 0x02, 0x89, 0x02, 0x98, 0x02, 0xa6, 0x02, 0xb5, 0x02, 0xc9, 0x02,
+  0xe1, 0x02, 0xf0, 0x02, 0xff, 0x02, 0x16, 0x03, 0x24, 0x03, 0x38, 0x03,
+  0x4e, 0x03, 0x66, 0x03, 0x7e, 0x03, 0x96, 0x03, 0xaa, 0x03, 0xc2, 0x03,
+  0xd1, 0x03, 0xe5, 0x03, 0xf4, 0x03, 0x04, 0x04, 0x13, 0x04, 0x22, 0x04,
+  0x3a, 0x04, 0x52, 0x04, 0x66, 0x04, 0x7e, 0x04, 0x96, 0x04, 0xae, 0x04,
+  0xc4, 0x04, 0xdb, 0x04, 0xeb, 0x04, 0xfa, 0x04, 0x09, 0x05, 0x21, 0x05,
+  0x30, 0x05, 0x00, 0x00, 0x0a, 0x00, 0x20, 0x00, 0x2a, 0x00, 0x3a, 0x00,
+  0x00, 0x00, 0x17, 0x00, 0x2e, 0x00, 0x3c, 0x00, 0x4b, 0x00, 0x62, 0x00,
+  0x78, 0x00, 0x8e, 0x00, 0xa5, 0x00, 0xbc, 0x00, 0xd3, 0x00, 0xe2, 0x00,
+  0xf1, 0x00, 0x08, 0x01, 0x1f, 0x01, 0x2e, 0x01, 0x45, 0x01, 0x5c, 0x01,
+  0x73, 0x01, 0x8a, 0x01, 0xa1, 0x01, 0xb0, 0x01, 0xc7, 0x01, 0xde, 0x01,
+  0xf5, 0x01, 0x0c, 0x02, 0x23, 0x02, 0x32, 0x02, 0x48, 0x02, 0x5f, 0x02,
+  0x6e, 0x02, 0x85, 0x02, 0x9c, 0x02, 0xb3, 0x02, 0xca, 0x02, 0xe1, 0x02,
+  0xf0, 0x02, 0xff, 0x02, 0x15, 0x03, 0x24, 0x03, 0x3b, 0x03, 0x52, 0x03,
+  0x69, 0x03, 0x80, 0x03, 0x97, 0x03, 0xae, 0x03, 0xbd, 0x03, 0xd4, 0x03,
+  0xeb, 0x03, 0x02, 0x04, 0x19, 0x04, 0x28, 0x04, 0x37, 0x04, 0x46, 0x04,
+  0x5c, 0x04, 0x6a, 0x04, 0x81, 0x04, 0x98, 0x04, 0xaf, 0x04, 0xc6, 0x04,
+  0xdc, 0x04, 0xf2, 0x04, 0x09, 0x05, 0x18, 0x05, 0x30, 0x05, 0x46, 0x05,
+  0x5d, 0x05, 0x6c, 0x05, 0x7a, 0x05, 0x91, 0x05, 0xa8, 0x05, 0xbe, 0x05,
+  0x00, 0x00, 0x0d, 0x00, 0x25, 0x00, 0x32, 0x00, 0x4a, 0x00, 0x57, 0x00,
+  0x70, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1e, 0x00, 0x2d, 0x00, 0x4b, 0x00,
+  0x5a, 0x00, 0x69, 0x00, 0x78, 0x00, 0x87, 0x00, 0x96, 0x00, 0xa5, 0x00,
+  0xb4, 0x00, 0xc2, 0x00, 0xd1, 0x00, 0xe0, 0x00, 0xef, 0x00, 0xfe, 0x00,
+  0x0d, 0x01, 0x1c, 0x01, 0x2b, 0x01, 0x00, 0x00, 0x11, 0x00, 0x1e, 0x00,
+  0x2b, 0x00, 0x37, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1e, 0x00, 0x2d, 0x00,
+  0x3c, 0x00, 0x4b, 0x00, 0x59, 0x00, 0x67, 0x00, 0x76, 0x00, 0x85, 0x00,
+  0x94, 0x00, 0xa3, 0x00, 0xb2, 0x00, 0xc1, 0x00, 0xd0, 0x00, 0xdf, 0x00,
+  0xee, 0x00, 0xfd, 0x00, 0x0c, 0x01, 0x1b, 0x01, 0x2a, 0x01, 0x39, 0x01,
+  0x48, 0x01, 0x56, 0x01, 0x65, 0x01, 0x74, 0x01, 0x83, 0x01, 0x92, 0x01,
+  0xa1, 0x01, 0xc0, 0x01, 0xcd, 0x01, 0xd9, 0x01, 0xe8, 0x01, 0xf5, 0x01,
+  0x04, 0x02, 0x13, 0x02, 0x21, 0x02, 0x30, 0x02, 0x3f, 0x02, 0x4e, 0x02,
+  0x5d, 0x02, 0x6b, 0x02, 0x79, 0x02, 0x88, 0x02, 0x00, 0x00, 0x17, 0x00,
+  0x37, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1c, 0x00, 0x2b, 0x00, 0x3d, 0x00,
+  0x4c, 0x00, 0x5b, 0x00, 0x6a, 0x00, 0x79, 0x00, 0x00, 0x00, 0x14, 0x00,
+  0x28, 0x00, 0x43, 0x00, 0x57, 0x00, 0x72, 0x00, 0x86, 0x00, 0xa0, 0x00,
+  0xbb, 0x00, 0xd6, 0x00, 0xf1, 0x00, 0x0c, 0x01, 0x26, 0x01, 0x00, 0x00,
+  0x11, 0x00, 0x2e, 0x00, 0x3d, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x14, 0x00,
+  0x2b, 0x00, 0x3f, 0x00, 0x52, 0x00, 0x63, 0x00, 0x7b, 0x00, 0x8f, 0x00,
+  0xa3, 0x00, 0xb7, 0x00, 0xcb, 0x00, 0xdd, 0x00, 0xf0, 0x00, 0x08, 0x01,
+  0x20, 0x01, 0x34, 0x01, 0x49, 0x01, 0x5d, 0x01, 0x71, 0x01, 0x00, 0x00,
+  0x0a, 0x00, 0x19, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x36, 0x00, 0x51, 0x00,
+  0x6c, 0x00, 0x87, 0x00, 0xa2, 0x00, 0xbc, 0x00, 0xd5, 0x00, 0xef, 0x00,
+  0x09, 0x01, 0x23, 0x01, 0x3e, 0x01, 0x59, 0x01, 0x74, 0x01, 0x8f, 0x01,
+  0xaa, 0x01, 0xc4, 0x01, 0xdf, 0x01, 0xfa, 0x01, 0x15, 0x02, 0x2f, 0x02,
+  0x4a, 0x02, 0x63, 0x02, 0x7e, 0x02, 0x97, 0x02, 0xb1, 0x02, 0xcc, 0x02,
+  0xe7, 0x02, 0x02, 0x03, 0x1c, 0x03, 0x37, 0x03, 0x51, 0x03, 0x5e, 0x03,
+  0x00, 0x00, 0x19, 0x00, 0x31, 0x00, 0x43, 0x00, 0x60, 0x00, 0x78, 0x00,
+  0x91, 0x00, 0xa9, 0x00, 0xc2, 0x00, 0xdc, 0x00, 0xf5, 0x00, 0x06, 0x01,
+  0x24, 0x01, 0x3d, 0x01, 0x4f, 0x01, 0x67, 0x01, 0x7f, 0x01, 0x98, 0x01,
+  0xb0, 0x01, 0xc9, 0x01, 0x00, 0x00, 0x15, 0x00, 0x28, 0x00, 0x3c, 0x00,
+  0x49, 0x00, 0x64, 0x00, 0x71, 0x00, 0x7e, 0x00, 0x92, 0x00, 0xa6, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x2d, 0x00, 0x44, 0x00, 0x5b, 0x00, 0x00, 0x00,
+  0x18, 0x00, 0x33, 0x00, 0x4b, 0x00, 0x65, 0x00, 0x7c, 0x00, 0x90, 0x00,
+  0xa8, 0x00, 0xbf, 0x00, 0xd7, 0x00, 0xf2, 0x00, 0x0d, 0x01, 0x25, 0x01,
+  0x40, 0x01, 0x5b, 0x01, 0x73, 0x01, 0x8a, 0x01, 0xa1, 0x01, 0xb9, 0x01,
+  0xd1, 0x01, 0xe9, 0x01, 0xf6, 0x01, 0x03, 0x02, 0x1b, 0x02, 0x00, 0x00,
+  0x1f, 0x00, 0x3d, 0x00, 0x5c, 0x00, 0x67, 0x00, 0x00, 0x00, 0x11, 0x00,
+  0x2c, 0x00, 0x4b, 0x00, 0x58, 0x00, 0x7a, 0x00, 0x95, 0x00, 0xa1, 0x00,
+  0xbc, 0x00, 0xd9, 0x00, 0x00, 0x00, 0x14, 0x00, 0x2c, 0x00, 0x45, 0x00,
+  0x57, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x34, 0x00, 0x4f, 0x00, 0x69, 0x00,
+  0x00, 0x00, 0x0b, 0x00, 0x15, 0x00, 0x1f, 0x00, 0x30, 0x00, 0x00, 0x00,
+  0x18, 0x00, 0x2f, 0x00, 0x4a, 0x00, 0x62, 0x00, 0x7a, 0x00, 0x92, 0x00,
+  0xaa, 0x00, 0xc1, 0x00, 0xd9, 0x00, 0xf1, 0x00, 0x08, 0x01, 0x1f, 0x01,
+  0x36, 0x01, 0x4d, 0x01, 0x65, 0x01, 0x7d, 0x01, 0x94, 0x01, 0xac, 0x01,
+  0xc4, 0x01, 0xdc, 0x01, 0xf4, 0x01, 0x0c, 0x02, 0x23, 0x02, 0x3a, 0x02,
+  0x52, 0x02, 0x65, 0x02, 0x7c, 0x02, 0x93, 0x02, 0xb0, 0x02, 0xc8, 0x02,
+  0xe0, 0x02, 0xf7, 0x02, 0x15, 0x03, 0x2d, 0x03, 0x51, 0x03, 0x69, 0x03,
+  0x82, 0x03, 0x00, 0x00, 0x0f, 0x00, 0x1e, 0x00, 0x29, 0x00, 0x34, 0x00,
+  0x43, 0x00, 0x53, 0x00, 0x63, 0x00, 0x72, 0x00, 0x84, 0x00, 0xa3, 0x00,
+  0xb2, 0x00, 0xc1, 0x00, 0xca, 0x00, 0xd9, 0x00, 0x00, 0x00, 0x0f, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x14, 0x00, 0x23, 0x00, 0x00, 0x00, 0x14, 0x00,
+  0x26, 0x00, 0x3a, 0x00, 0x4c, 0x00, 0x5e, 0x00, 0x72, 0x00, 0x86, 0x00,
+  0x98, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x39, 0x00, 0x48, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x24, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x20, 0x00, 0x31, 0x00,
+  0x00, 0x00, 0x11, 0x00, 0x22, 0x00, 0x35, 0x00, 0x47, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0b, 0x00, 0x20, 0x00, 0x36, 0x00, 0x47, 0x00, 0x58, 0x00,
+  0x65, 0x00, 0x76, 0x00, 0x8d, 0x00, 0xa3, 0x00, 0xb0, 0x00, 0xc1, 0x00,
+  0xd9, 0x00, 0xea, 0x00, 0x00, 0x00, 0x12, 0x00, 0x2d, 0x00, 0x3f, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x1b, 0x00, 0x2c, 0x00, 0x3d, 0x00,
+  0x4e, 0x00, 0x5f, 0x00, 0x70, 0x00, 0x81, 0x00, 0x92, 0x00, 0xa3, 0x00,
+  0xb4, 0x00, 0xbf, 0x00, 0xd1, 0x00, 0xe3, 0x00, 0xf5, 0x00, 0x07, 0x01,
+  0x19, 0x01, 0x00, 0x00, 0x08, 0x00, 0x15, 0x00, 0x00, 0x00, 0x07, 0x00,
+  0x15, 0x00, 0x23, 0x00, 0x32, 0x00, 0x41, 0x00, 0x50, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x20, 0x00, 0x37, 0x00, 0x4d, 0x00, 0x62, 0x00, 0x79, 0x00,
+  0x9b, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x1d, 0x00, 0x2c, 0x00, 0x45, 0x00,
+  0x5c, 0x00, 0x73, 0x00, 0x88, 0x00, 0x91, 0x00, 0x9a, 0x00, 0xa3, 0x00,
+  0xc7, 0x00, 0xd7, 0x00, 0xe6, 0x00, 0xf8, 0x00, 0x0a, 0x01, 0x00, 0x00,
+  0x09, 0x00, 0x1a, 0x00, 0x32, 0x00, 0x43, 0x00, 0x53, 0x00, 0x64, 0x00,
+  0x75, 0x00, 0x7e, 0x00, 0x8f, 0x00, 0xa0, 0x00, 0xb1, 0x00, 0xc2, 0x00,
+  0xd4, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x20, 0x00,
+  0x34, 0x00, 0x41, 0x00, 0x52, 0x00, 0x65, 0x00, 0x76, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x27, 0x00, 0x3f, 0x00, 0x4a, 0x00, 0x00, 0x00, 0x11, 0x00,
+  0x20, 0x00, 0x30, 0x00, 0x41, 0x00, 0x52, 0x00, 0x62, 0x00, 0x72, 0x00,
+  0x00, 0x00, 0x0b, 0x00, 0x24, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x0a, 0x00,
+  0x18, 0x00, 0x31, 0x00, 0x45, 0x00, 0x58, 0x00, 0x6f, 0x00, 0x83, 0x00,
+  0x96, 0x00, 0xaa, 0x00, 0xb7, 0x00, 0xcb, 0x00, 0xd8, 0x00, 0xec, 0x00,
+  0x05, 0x01, 0x19, 0x01, 0x26, 0x01, 0x33, 0x01, 0x46, 0x01, 0x5e, 0x01,
+  0x6f, 0x01, 0x83, 0x01, 0x9b, 0x01, 0xae, 0x01, 0x00, 0x00, 0x19, 0x00,
+  0x32, 0x00, 0x4a, 0x00, 0x63, 0x00, 0x7c, 0x00, 0x8b, 0x00, 0x9d, 0x00,
+  0xb6, 0x00, 0xc5, 0x00, 0xdd, 0x00, 0xf5, 0x00, 0x0d, 0x01, 0x26, 0x01,
+  0x3f, 0x01, 0x58, 0x01, 0x71, 0x01, 0x8a, 0x01, 0x99, 0x01, 0xb1, 0x01,
+  0x00, 0x00, 0x13, 0x00, 0x26, 0x00, 0x3b, 0x00, 0x4f, 0x00, 0x63, 0x00,
+  0x77, 0x00, 0x8b, 0x00, 0x9f, 0x00, 0xb3, 0x00, 0xc7, 0x00, 0xdb, 0x00,
+  0xef, 0x00, 0x03, 0x01, 0x17, 0x01, 0x2b, 0x01, 0x3f, 0x01, 0x53, 0x01,
+  0x67, 0x01, 0x7b, 0x01, 0x8f, 0x01, 0xa3, 0x01, 0xb7, 0x01, 0xca, 0x01,
+  0xdd, 0x01, 0xf1, 0x01, 0x05, 0x02, 0x19, 0x02, 0x2d, 0x02, 0x41, 0x02,
+  0x51, 0x02, 0x65, 0x02, 0x7d, 0x02, 0x91, 0x02, 0xa5, 0x02, 0xb8, 0x02,
+  0xc3, 0x02, 0xd6, 0x02, 0xe9, 0x02, 0xfc, 0x02, 0x05, 0x03, 0x19, 0x03,
+  0x2d, 0x03, 0x40, 0x03, 0x54, 0x03, 0x68, 0x03, 0x7c, 0x03, 0x90, 0x03,
+  0xa0, 0x03, 0xb3, 0x03, 0xc6, 0x03, 0xd9, 0x03, 0xed, 0x03, 0x00, 0x04,
+  0x10, 0x04, 0x00, 0x00, 0x12, 0x00, 0x2a, 0x00, 0x3d, 0x00, 0x56, 0x00,
+  0x6e, 0x00, 0x87, 0x00, 0xa0, 0x00, 0xb9, 0x00, 0xd2, 0x00, 0xeb, 0x00,
+  0x04, 0x01, 0x1d, 0x01, 0x36, 0x01, 0x48, 0x01, 0x60, 0x01, 0x78, 0x01,
+  0x91, 0x01, 0xaa, 0x01, 0xbc, 0x01, 0xd5, 0x01, 0xee, 0x01, 0x07, 0x02,
+  0x27, 0x02, 0x40, 0x02, 0x59, 0x02, 0x72, 0x02, 0x8a, 0x02, 0xa3, 0x02,
+  0xbc, 0x02, 0xd5, 0x02, 0xe2, 0x02, 0xf4, 0x02, 0x06, 0x03, 0x1e, 0x03,
+  0x2e, 0x03, 0x00, 0x00, 0x18, 0x00, 0x23, 0x00, 0x43, 0x00, 0x50, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x20, 0x00, 0x2f, 0x00, 0x47, 0x00, 0x56, 0x00,
+  0x67, 0x00, 0x76, 0x00, 0x88, 0x00, 0x9a, 0x00, 0xac, 0x00, 0xbe, 0x00,
+  0xda, 0x00, 0xec, 0x00, 0xfb, 0x00, 0x0a, 0x01, 0x1c, 0x01, 0x25, 0x01,
+  0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x31, 0x00, 0x57, 0x00,
+  0x00, 0x00, 0x25, 0x00, 0x49, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1e, 0x00,
+  0x29, 0x00, 0x42, 0x00, 0x51, 0x00, 0x74, 0x00, 0x83, 0x00, 0x95, 0x00,
+  0xa7, 0x00, 0xc0, 0x00, 0xcf, 0x00, 0xe7, 0x00, 0xff, 0x00, 0x0a, 0x01,
+  0x19, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x00, 0x00, 0x11, 0x00, 0x22, 0x00,
+  0x39, 0x00, 0x51, 0x00, 0x6f, 0x00, 0x86, 0x00, 0x97, 0x00, 0xb5, 0x00,
+  0xda, 0x00, 0xee, 0x00, 0x05, 0x01, 0x23, 0x01, 0x00, 0x00, 0x0f, 0x00,
+  0x1f, 0x00, 0x30, 0x00, 0x42, 0x00, 0x54, 0x00, 0x63, 0x00, 0x72, 0x00,
+  0x00, 0x00, 0x13, 0x00, 0x2d, 0x00, 0x40, 0x00, 0x58, 0x00, 0x6f, 0x00,
+  0x87, 0x00, 0x00, 0x00, 0x16, 0x00, 0x2f, 0x00, 0x45, 0x00, 0x5b, 0x00,
+  0x70, 0x00, 0x85, 0x00, 0xa0, 0x00, 0xbd, 0x00, 0xda, 0x00, 0xfd, 0x00,
+  0x08, 0x01, 0x1a, 0x01, 0x30, 0x01, 0x46, 0x01, 0x5e, 0x01, 0x74, 0x01,
+  0x83, 0x01, 0x99, 0x01, 0xad, 0x01, 0xc3, 0x01, 0x00, 0x00, 0x10, 0x00,
+  0x21, 0x00, 0x48, 0x00, 0x55, 0x00, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1a, 0x00, 0x2e, 0x00, 0x49, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x19, 0x00,
+  0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x18, 0x00, 0x2b, 0x00, 0x43, 0x00,
+  0x5c, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x12, 0x00, 0x22, 0x00,
+  0x34, 0x00, 0x43, 0x00, 0x4d, 0x00, 0x5d, 0x00, 0x6f, 0x00, 0x86, 0x00,
+  0x95, 0x00, 0xa7, 0x00, 0xb9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x00,
+  0x34, 0x00, 0x46, 0x00, 0x63, 0x00, 0x00, 0x00, 0x18, 0x00, 0x30, 0x00,
+  0x48, 0x00, 0x60, 0x00, 0x78, 0x00, 0x90, 0x00, 0xa8, 0x00, 0xc0, 0x00,
+  0xd8, 0x00, 0xf0, 0x00, 0x06, 0x01, 0x1e, 0x01, 0x34, 0x01, 0x4c, 0x01,
+  0x64, 0x01, 0x7c, 0x01, 0x93, 0x01, 0xab, 0x01, 0xc3, 0x01, 0xdb, 0x01,
+  0xf3, 0x01, 0x0b, 0x02, 0x23, 0x02, 0x3b, 0x02, 0x53, 0x02, 0x6b, 0x02,
+  0x83, 0x02, 0x9a, 0x02, 0xb3, 0x02, 0xc9, 0x02, 0xe0, 0x02, 0xf6, 0x02,
+  0x0e, 0x03, 0x26, 0x03, 0x3d, 0x03, 0x55, 0x03, 0x6b, 0x03, 0x83, 0x03,
+  0x9b, 0x03, 0xb3, 0x03, 0xcb, 0x03, 0xe3, 0x03, 0xfc, 0x03, 0x14, 0x04,
+  0x2c, 0x04, 0x44, 0x04, 0x5b, 0x04, 0x73, 0x04, 0x8b, 0x04, 0xa3, 0x04,
+  0xbb, 0x04, 0xd2, 0x04, 0xe9, 0x04, 0x01, 0x05, 0x19, 0x05, 0x31, 0x05,
+  0x48, 0x05, 0x5f, 0x05, 0x77, 0x05, 0x8f, 0x05, 0xa6, 0x05, 0xbe, 0x05,
+  0xd6, 0x05, 0xee, 0x05, 0x06, 0x06, 0x1e, 0x06, 0x36, 0x06, 0x4c, 0x06,
+  0x65, 0x06, 0x7e, 0x06, 0x97, 0x06, 0xb0, 0x06, 0xc9, 0x06, 0xe2, 0x06,
+  0xfb, 0x06, 0x16, 0x07, 0x2d, 0x07, 0x45, 0x07, 0x5c, 0x07, 0x74, 0x07,
+  0x8c, 0x07, 0xa4, 0x07, 0xbc, 0x07, 0xd4, 0x07, 0xec, 0x07, 0x04, 0x08,
+  0x1c, 0x08, 0x34, 0x08, 0x4c, 0x08, 0x64, 0x08, 0x7c, 0x08, 0x97, 0x08,
+  0xb1, 0x08, 0xc7, 0x08, 0xde, 0x08, 0xf6, 0x08, 0x0e, 0x09, 0x26, 0x09,
+  0x33, 0x09, 0x4a, 0x09, 0x61, 0x09, 0x77, 0x09, 0x8e, 0x09, 0xa6, 0x09,
+  0xbd, 0x09, 0xd4, 0x09, 0xec, 0x09, 0x03, 0x0a, 0x1a, 0x0a, 0x32, 0x0a,
+  0x4a, 0x0a, 0x62, 0x0a, 0x7a, 0x0a, 0x00, 0x00, 0x12, 0x00, 0x24, 0x00,
+  0x2f, 0x00, 0x00, 0x00, 0x11, 0x00, 0x22, 0x00, 0x33, 0x00, 0x44, 0x00,
+  0x5d, 0x00, 0x6e, 0x00, 0x79, 0x00, 0x89, 0x00, 0xa1, 0x00, 0xb9, 0x00,
+  0xc9, 0x00, 0xda, 0x00, 0xeb, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x20, 0x00,
+  0x00, 0x00, 0x14, 0x00, 0x2d, 0x00, 0x47, 0x00, 0x54, 0x00, 0x67, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x2c, 0x00, 0x3d, 0x00, 0x4e, 0x00,
+  0x5f, 0x00, 0x70, 0x00, 0x81, 0x00, 0x92, 0x00, 0xa3, 0x00, 0xb4, 0x00,
+  0xc5, 0x00, 0xd6, 0x00, 0x00, 0x00, 0x18, 0x00, 0x2f, 0x00, 0x47, 0x00,
+  0x5f, 0x00, 0x70, 0x00, 0x88, 0x00, 0xa1, 0x00, 0xb9, 0x00, 0xd0, 0x00,
+  0xe8, 0x00, 0x00, 0x00, 0x13, 0x00, 0x2d, 0x00, 0x47, 0x00, 0x61, 0x00,
+  0x75, 0x00, 0x8f, 0x00, 0xa9, 0x00, 0xc4, 0x00, 0xdf, 0x00, 0xf3, 0x00,
+  0xfd, 0x00, 0x17, 0x01, 0x2b, 0x01, 0x3f, 0x01, 0x59, 0x01, 0x73, 0x01,
+  0x8d, 0x01, 0x00, 0x00, 0x13, 0x00, 0x25, 0x00, 0x37, 0x00, 0x45, 0x00,
+  0x53, 0x00, 0x65, 0x00, 0x77, 0x00, 0x89, 0x00, 0x98, 0x00, 0xaa, 0x00,
+  0xbc, 0x00, 0xce, 0x00, 0xe0, 0x00, 0xef, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x14, 0x00, 0x29, 0x00, 0x3d, 0x00, 0x51, 0x00, 0x64, 0x00, 0x82, 0x00,
+  0x9e, 0x00, 0xb2, 0x00, 0xc6, 0x00, 0xe0, 0x00, 0xf4, 0x00, 0x08, 0x01,
+  0x1c, 0x01, 0x30, 0x01, 0x44, 0x01, 0x62, 0x01, 0x76, 0x01, 0x8a, 0x01,
+  0xa4, 0x01, 0xb3, 0x01, 0xc7, 0x01, 0xdc, 0x01, 0xf0, 0x01, 0x04, 0x02,
+  0x23, 0x02, 0x3d, 0x02, 0x51, 0x02, 0x65, 0x02, 0x79, 0x02, 0x8d, 0x02,
+  0xa1, 0x02, 0xbf, 0x02, 0xd3, 0x02, 0xe7, 0x02, 0xfb, 0x02, 0x0f, 0x03,
+  0x23, 0x03, 0x37, 0x03, 0x4b, 0x03, 0x69, 0x03, 0x7c, 0x03, 0x90, 0x03,
+  0xa2, 0x03, 0xb6, 0x03, 0xc9, 0x03, 0xdc, 0x03, 0xef, 0x03, 0x03, 0x04,
+  0x17, 0x04, 0x27, 0x04, 0x3a, 0x04, 0x4d, 0x04, 0x60, 0x04, 0x74, 0x04,
+  0x00, 0x00, 0x19, 0x00, 0x39, 0x00, 0x51, 0x00, 0x6a, 0x00, 0x89, 0x00,
+  0xa1, 0x00, 0xba, 0x00, 0xc9, 0x00, 0xe8, 0x00, 0x07, 0x01, 0x00, 0x00,
+  0x1b, 0x00, 0x39, 0x00, 0x59, 0x00, 0x73, 0x00, 0x90, 0x00, 0xa9, 0x00,
+  0xbc, 0x00, 0x00, 0x00, 0x19, 0x00, 0x34, 0x00, 0x43, 0x00, 0x52, 0x00,
+  0x61, 0x00, 0x00, 0x00, 0x21, 0x00, 0x3f, 0x00, 0x5d, 0x00, 0x7b, 0x00,
+  0x99, 0x00, 0xb7, 0x00, 0xd5, 0x00, 0xe8, 0x00, 0x06, 0x01, 0x1f, 0x01,
+  0x39, 0x01, 0x53, 0x01, 0x6d, 0x01, 0x8b, 0x01, 0xa8, 0x01, 0x00, 0x00,
+  0x20, 0x00, 0x40, 0x00, 0x51, 0x00, 0x71, 0x00, 0x83, 0x00, 0x8f, 0x00,
+  0x9b, 0x00, 0xad, 0x00, 0xbe, 0x00, 0xcb, 0x00, 0xea, 0x00, 0xfc, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x22, 0x00, 0x43, 0x00, 0x4c, 0x00, 0x00, 0x00,
+  0x19, 0x00, 0x32, 0x00, 0x49, 0x00, 0x62, 0x00, 0x7a, 0x00, 0x93, 0x00,
+  0x00, 0x00, 0x11, 0x00, 0x21, 0x00, 0x43, 0x00, 0x65, 0x00, 0x76, 0x00,
+  0x88, 0x00, 0x9a, 0x00, 0xab, 0x00, 0xbc, 0x00, 0x00, 0x00, 0x18, 0x00,
+  0x26, 0x00, 0x38, 0x00, 0x4a, 0x00, 0x5c, 0x00, 0x6e, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x2e, 0x00, 0x41, 0x00, 0x5b, 0x00, 0x6a, 0x00, 0x84, 0x00,
+  0x00, 0x00, 0x16, 0x00, 0x28, 0x00, 0x3d, 0x00, 0x52, 0x00, 0x68, 0x00,
+  0x7e, 0x00, 0x94, 0x00, 0xab, 0x00, 0xb5, 0x00, 0xbf, 0x00, 0xd6, 0x00,
+  0xec, 0x00, 0x02, 0x01, 0x14, 0x01, 0x2a, 0x01, 0x00, 0x00, 0x10, 0x00,
+  0x21, 0x00, 0x32, 0x00, 0x4f, 0x00, 0x60, 0x00, 0x71, 0x00, 0x7e, 0x00,
+  0x8f, 0x00, 0xa0, 0x00, 0xad, 0x00, 0xba, 0x00, 0xd3, 0x00, 0xe4, 0x00,
+  0x00, 0x00, 0x1b, 0x00, 0x35, 0x00, 0x49, 0x00, 0x64, 0x00, 0x78, 0x00,
+  0x8e, 0x00, 0xa2, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x11, 0x00,
+  0x22, 0x00, 0x33, 0x00, 0x43, 0x00, 0x54, 0x00, 0x65, 0x00, 0x76, 0x00,
+  0x87, 0x00, 0x97, 0x00, 0xa8, 0x00, 0xb9, 0x00, 0xca, 0x00, 0xdb, 0x00,
+  0xeb, 0x00, 0xfc, 0x00, 0x0c, 0x01, 0x1d, 0x01, 0x2e, 0x01, 0x3f, 0x01,
+  0x50, 0x01, 0x61, 0x01, 0x71, 0x01, 0x8b, 0x01, 0x9a, 0x01, 0xab, 0x01,
+  0xc2, 0x01, 0xd3, 0x01, 0xe4, 0x01, 0xf5, 0x01, 0x06, 0x02, 0x16, 0x02,
+  0x27, 0x02, 0x38, 0x02, 0x43, 0x02, 0x4e, 0x02, 0x5f, 0x02, 0x70, 0x02,
+  0x80, 0x02, 0x91, 0x02, 0xa2, 0x02, 0xb3, 0x02, 0xc4, 0x02, 0xd5, 0x02,
+  0xe6, 0x02, 0xf6, 0x02, 0x07, 0x03, 0x18, 0x03, 0x29, 0x03, 0x3a, 0x03,
+  0x45, 0x03, 0x56, 0x03, 0x67, 0x03, 0x78, 0x03, 0x88, 0x03, 0x9d, 0x03,
+  0xae, 0x03, 0xbf, 0x03, 0xd0, 0x03, 0xe1, 0x03, 0xf2, 0x03, 0x03, 0x04,
+  0x14, 0x04, 0x25, 0x04, 0x36, 0x04, 0x00, 0x00, 0x12, 0x00, 0x29, 0x00,
+  0x39, 0x00, 0x48, 0x00, 0x5a, 0x00, 0x71, 0x00, 0x00, 0x00, 0x11, 0x00,
+  0x22, 0x00, 0x33, 0x00, 0x44, 0x00, 0x5f, 0x00, 0x73, 0x00, 0x80, 0x00,
+  0x93, 0x00, 0xa4, 0x00, 0xb5, 0x00, 0xc6, 0x00, 0xd7, 0x00, 0xf8, 0x00,
+  0x0c, 0x01, 0x1d, 0x01, 0x2c, 0x01, 0x3c, 0x01, 0x4d, 0x01, 0x00, 0x00,
+  0x11, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x21, 0x00, 0x34, 0x00,
+  0x48, 0x00, 0x5c, 0x00, 0x70, 0x00, 0x84, 0x00, 0x98, 0x00, 0xac, 0x00,
+  0xbf, 0x00, 0xd2, 0x00, 0xe6, 0x00, 0xfa, 0x00, 0x0e, 0x01, 0x22, 0x01,
+  0x34, 0x01, 0x48, 0x01, 0x57, 0x01, 0x6a, 0x01, 0x7e, 0x01, 0x92, 0x01,
+  0xa6, 0x01, 0xba, 0x01, 0xce, 0x01, 0xe2, 0x01, 0xf5, 0x01, 0x09, 0x02,
+  0x1d, 0x02, 0x31, 0x02, 0x45, 0x02, 0x59, 0x02, 0x6d, 0x02, 0x81, 0x02,
+  0x95, 0x02, 0xa9, 0x02, 0xbd, 0x02, 0xca, 0x02, 0xde, 0x02, 0xef, 0x02,
+  0x03, 0x03, 0x17, 0x03, 0x2b, 0x03, 0x3f, 0x03, 0x53, 0x03, 0x67, 0x03,
+  0x7b, 0x03, 0x8e, 0x03, 0xa2, 0x03, 0xb6, 0x03, 0xca, 0x03, 0xde, 0x03,
+  0x00, 0x00, 0x12, 0x00, 0x24, 0x00, 0x36, 0x00, 0x41, 0x00, 0x53, 0x00,
+  0x65, 0x00, 0x7b, 0x00, 0x8d, 0x00, 0x9f, 0x00, 0xb1, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x1d, 0x00, 0x2e, 0x00, 0x3f, 0x00, 0x50, 0x00, 0x61, 0x00,
+  0x72, 0x00, 0x82, 0x00, 0x93, 0x00, 0xa4, 0x00, 0xb5, 0x00, 0xc6, 0x00,
+  0xd6, 0x00, 0xe7, 0x00, 0xf8, 0x00, 0x09, 0x01, 0x1a, 0x01, 0x2b, 0x01,
+  0x3c, 0x01, 0x4b, 0x01, 0x5d, 0x01, 0x6e, 0x01, 0x7b, 0x01, 0x88, 0x01,
+  0x99, 0x01, 0xaa, 0x01, 0xbb, 0x01, 0xcc, 0x01, 0xdd, 0x01, 0xee, 0x01,
+  0xff, 0x01, 0x10, 0x02, 0x21, 0x02, 0x33, 0x02, 0x46, 0x02, 0x58, 0x02,
+  0x69, 0x02, 0x7a, 0x02, 0x8a, 0x02, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00,
+  0x24, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x0f, 0x00,
+  0x23, 0x00, 0x36, 0x00, 0x00, 0x00, 0x16, 0x00, 0x2c, 0x00, 0x43, 0x00,
+  0x00, 0x00, 0x11, 0x00, 0x23, 0x00, 0x34, 0x00, 0x4b, 0x00, 0x5b, 0x00,
+  0x6c, 0x00, 0x83, 0x00, 0x00, 0x00, 0x12, 0x00, 0x23, 0x00, 0x34, 0x00,
+  0x4b, 0x00, 0x5d, 0x00, 0x6f, 0x00, 0x88, 0x00, 0xa1, 0x00, 0xb2, 0x00,
+  0xca, 0x00, 0xdc, 0x00, 0xf2, 0x00, 0x03, 0x01, 0x15, 0x01, 0x27, 0x01,
+  0x40, 0x01, 0x52, 0x01, 0x63, 0x01, 0x7b, 0x01, 0x94, 0x01, 0xa6, 0x01,
+  0xb8, 0x01, 0xc9, 0x01, 0xdb, 0x01, 0xf3, 0x01, 0x04, 0x02, 0x16, 0x02,
+  0x27, 0x02, 0x00, 0x00, 0x1b, 0x00, 0x35, 0x00, 0x50, 0x00, 0x6a, 0x00,
+  0x85, 0x00, 0x9f, 0x00, 0xb7, 0x00, 0x00, 0x00, 0x12, 0x00, 0x24, 0x00,
+  0x35, 0x00, 0x42, 0x00, 0x54, 0x00, 0x65, 0x00, 0x74, 0x00, 0x85, 0x00,
+  0x96, 0x00, 0xa8, 0x00, 0xb9, 0x00, 0xca, 0x00, 0xdb, 0x00, 0xf2, 0x00,
+  0x03, 0x01, 0x00, 0x00, 0x11, 0x00, 0x21, 0x00, 0x31, 0x00, 0x4b, 0x00,
+  0x5c, 0x00, 0x73, 0x00, 0x8a, 0x00, 0xa4, 0x00, 0xbe, 0x00, 0xcf, 0x00,
+  0xe8, 0x00, 0x02, 0x01, 0x1c, 0x01, 0x2d, 0x01, 0x47, 0x01, 0x5e, 0x01,
+  0x78, 0x01, 0x93, 0x01, 0xaa, 0x01, 0xc4, 0x01, 0xdd, 0x01, 0xf7, 0x01,
+  0x11, 0x02, 0x2b, 0x02, 0x44, 0x02, 0x5e, 0x02, 0x6f, 0x02, 0x80, 0x02,
+  0x98, 0x02, 0xb1, 0x02, 0xcb, 0x02, 0xe5, 0x02, 0x00, 0x00, 0x15, 0x00,
+  0x33, 0x00, 0x4f, 0x00, 0x67, 0x00, 0x7d, 0x00, 0x95, 0x00, 0xb1, 0x00,
+  0xc9, 0x00, 0xe5, 0x00, 0x01, 0x01, 0x1d, 0x01, 0x39, 0x01, 0x55, 0x01,
+  0x00, 0x00, 0x0a, 0x00, 0x17, 0x00, 0x2b, 0x00, 0x49, 0x00, 0x68, 0x00,
+  0x87, 0x00, 0x9a, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x26, 0x00, 0x35, 0x00,
+  0x4d, 0x00, 0x62, 0x00, 0x78, 0x00, 0x8d, 0x00, 0xa4, 0x00, 0xba, 0x00,
+  0xd2, 0x00, 0xea, 0x00, 0x00, 0x01, 0x0f, 0x01, 0x25, 0x01, 0x33, 0x01,
+  0x49, 0x01, 0x58, 0x01, 0x67, 0x01, 0x7d, 0x01, 0x95, 0x01, 0xb1, 0x01,
+  0xc7, 0x01, 0xdd, 0x01, 0x00, 0x00, 0x15, 0x00, 0x2a, 0x00, 0x3f, 0x00,
+  0x54, 0x00, 0x00, 0x00, 0x12, 0x00, 0x26, 0x00, 0x3a, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x11, 0x00, 0x22, 0x00, 0x30, 0x00, 0x4a, 0x00, 0x5a, 0x00,
+  0x6a, 0x00, 0x7c, 0x00, 0x8d, 0x00, 0x9f, 0x00, 0xb9, 0x00, 0xca, 0x00,
+  0xdb, 0x00, 0x00, 0x00, 0x12, 0x00, 0x24, 0x00, 0x3c, 0x00, 0x4e, 0x00,
+  0x60, 0x00, 0x71, 0x00, 0x83, 0x00, 0x95, 0x00, 0x00, 0x00, 0x11, 0x00,
+  0x25, 0x00, 0x39, 0x00, 0x4e, 0x00, 0x62, 0x00, 0x76, 0x00, 0x87, 0x00,
+  0x9b, 0x00, 0x00, 0x00, 0x16, 0x00, 0x36, 0x00, 0x48, 0x00, 0x5e, 0x00,
+  0x70, 0x00, 0x84, 0x00, 0x00, 0x00, 0x11, 0x00, 0x22, 0x00, 0x32, 0x00,
+  0x43, 0x00, 0x57, 0x00, 0x68, 0x00, 0x79, 0x00, 0x00, 0x00, 0x13, 0x00,
+  0x25, 0x00, 0x38, 0x00, 0x51, 0x00, 0x69, 0x00, 0x7e, 0x00, 0x93, 0x00,
+  0xa8, 0x00, 0xbe, 0x00, 0xd3, 0x00, 0xe8, 0x00, 0xfc, 0x00, 0x0f, 0x01,
+  0x23, 0x01, 0x00, 0x00, 0x06, 0x00, 0x1a, 0x00, 0x21, 0x00, 0x2e, 0x00,
+  0x42, 0x00, 0x56, 0x00, 0x6a, 0x00, 0x77, 0x00, 0x00, 0x00, 0x13, 0x00,
+  0x00, 0x00, 0x11, 0x00, 0x22, 0x00, 0x32, 0x00, 0x43, 0x00, 0x54, 0x00,
+  0x61, 0x00, 0x6e, 0x00, 0x7e, 0x00, 0x8f, 0x00, 0xa0, 0x00, 0xb0, 0x00,
+  0xc1, 0x00, 0xd2, 0x00, 0xe3, 0x00, 0xf4, 0x00, 0x04, 0x01, 0x15, 0x01,
+  0x24, 0x01, 0x35, 0x01, 0x46, 0x01, 0x56, 0x01, 0x67, 0x01, 0x78, 0x01,
+  0x89, 0x01, 0x9a, 0x01, 0xab, 0x01, 0xbc, 0x01, 0xcd, 0x01, 0xde, 0x01,
+  0xef, 0x01, 0x00, 0x02, 0x10, 0x02, 0x1d, 0x02, 0x2e, 0x02, 0x3f, 0x02,
+  0x50, 0x02, 0x69, 0x02, 0x7a, 0x02, 0x8b, 0x02, 0x9b, 0x02, 0xb2, 0x02,
+  0xc3, 0x02, 0xd3, 0x02, 0xe4, 0x02, 0xf5, 0x02, 0x06, 0x03, 0x16, 0x03,
+  0x27, 0x03, 0x39, 0x03, 0x49, 0x03, 0x59, 0x03, 0x6a, 0x03, 0x7a, 0x03,
+  0x8a, 0x03, 0x9b, 0x03, 0xac, 0x03, 0xbd, 0x03, 0xcd, 0x03, 0xde, 0x03,
+  0xef, 0x03, 0x00, 0x04, 0x10, 0x04, 0x26, 0x04, 0x37, 0x04, 0x48, 0x04,
+  0x59, 0x04, 0x6a, 0x04, 0x7b, 0x04, 0x8c, 0x04, 0x9d, 0x04, 0xad, 0x04,
+  0xbe, 0x04, 0x00, 0x00, 0x16, 0x00, 0x2c, 0x00, 0x42, 0x00, 0x52, 0x00,
+  0x68, 0x00, 0x00, 0x00, 0x11, 0x00, 0x22, 0x00, 0x36, 0x00, 0x47, 0x00,
+  0x62, 0x00, 0x7d, 0x00, 0x97, 0x00, 0xaa, 0x00, 0xbe, 0x00, 0xd9, 0x00,
+  0xf4, 0x00, 0x04, 0x01, 0x1f, 0x01, 0x3a, 0x01, 0x4e, 0x01, 0x69, 0x01,
+  0x7a, 0x01, 0x86, 0x01, 0x9a, 0x01, 0xab, 0x01, 0xbf, 0x01, 0xcb, 0x01,
+  0xdf, 0x01, 0xf3, 0x01, 0x07, 0x02, 0x1b, 0x02, 0x2f, 0x02, 0x44, 0x02,
+  0x58, 0x02, 0x68, 0x02, 0x77, 0x02, 0x87, 0x02, 0x00, 0x00, 0x16, 0x00,
+  0x2c, 0x00, 0x42, 0x00, 0x58, 0x00, 0x6e, 0x00, 0x7e, 0x00, 0xa1, 0x00,
+  0xb7, 0x00, 0xce, 0x00, 0xe3, 0x00, 0xf9, 0x00, 0x0e, 0x01, 0x00, 0x00,
+  0x14, 0x00, 0x28, 0x00, 0x3c, 0x00, 0x50, 0x00, 0x62, 0x00, 0x76, 0x00,
+  0x8a, 0x00, 0x9e, 0x00, 0xb1, 0x00, 0xc5, 0x00, 0xd9, 0x00, 0xed, 0x00,
+  0x00, 0x01, 0x14, 0x01, 0x2b, 0x01, 0x3f, 0x01, 0x00, 0x00, 0x16, 0x00,
+  0x2c, 0x00, 0x42, 0x00, 0x58, 0x00, 0x6e, 0x00, 0x84, 0x00, 0x9a, 0x00,
+  0xb0, 0x00, 0xc6, 0x00, 0xdc, 0x00, 0xf2, 0x00, 0x08, 0x01, 0x1e, 0x01,
+  0x34, 0x01, 0x4a, 0x01, 0x60, 0x01, 0x76, 0x01, 0x8c, 0x01, 0xa1, 0x01,
+  0xb5, 0x01, 0xcb, 0x01, 0xe0, 0x01, 0xf5, 0x01, 0x0b, 0x02, 0x21, 0x02,
+  0x36, 0x02, 0x4c, 0x02, 0x61, 0x02, 0x6c, 0x02, 0x00, 0x00, 0x11, 0x00,
+  0x22, 0x00, 0x32, 0x00, 0x43, 0x00, 0x57, 0x00, 0x68, 0x00, 0x79, 0x00,
+  0x8a, 0x00, 0x9c, 0x00, 0xad, 0x00, 0xc1, 0x00, 0xd5, 0x00, 0xe6, 0x00,
+  0xf7, 0x00, 0x08, 0x01, 0x1c, 0x01, 0x2d, 0x01, 0x3e, 0x01, 0x4f, 0x01,
+  0x62, 0x01, 0x73, 0x01, 0x87, 0x01, 0x98, 0x01, 0xa8, 0x01, 0xb9, 0x01,
+  0xca, 0x01, 0xdb, 0x01, 0xeb, 0x01, 0xfc, 0x01, 0x0d, 0x02, 0x1e, 0x02,
+  0x30, 0x02, 0x41, 0x02, 0x52, 0x02, 0x66, 0x02, 0x77, 0x02, 0x88, 0x02,
+  0x99, 0x02, 0xa9, 0x02, 0xba, 0x02, 0xca, 0x02, 0xdb, 0x02, 0xeb, 0x02,
+  0xfc, 0x02, 0x0d, 0x03, 0x00, 0x00, 0x19, 0x00, 0x31, 0x00, 0x45, 0x00,
+  0x00, 0x00, 0x18, 0x00, 0x30, 0x00, 0x3b, 0x00, 0x56, 0x00, 0x70, 0x00,
+  0x89, 0x00, 0xa1, 0x00, 0xb0, 0x00, 0xc8, 0x00, 0xdb, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x18, 0x00, 0x29, 0x00, 0x3e, 0x00,
+  0x47, 0x00, 0x60, 0x00, 0x78, 0x00, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x24, 0x00, 0x36, 0x00, 0x48, 0x00, 0x59, 0x00, 0x6b, 0x00,
+  0x7c, 0x00, 0x8e, 0x00, 0xa0, 0x00, 0xb2, 0x00, 0xc4, 0x00, 0xd6, 0x00,
+  0xe8, 0x00, 0xfa, 0x00, 0x0c, 0x01, 0x1e, 0x01, 0x30, 0x01, 0x4a, 0x01,
+  0x5c, 0x01, 0x6e, 0x01, 0x80, 0x01, 0x92, 0x01, 0xa4, 0x01, 0xb5, 0x01,
+  0xc7, 0x01, 0xd9, 0x01, 0xeb, 0x01, 0xfd, 0x01, 0x0f, 0x02, 0x21, 0x02,
+  0x33, 0x02, 0x46, 0x02, 0x57, 0x02, 0x69, 0x02, 0x7b, 0x02, 0x00, 0x00,
+  0x0c, 0x00, 0x20, 0x00, 0x33, 0x00, 0x40, 0x00, 0x00, 0x00, 0x12, 0x00,
+  0x24, 0x00, 0x36, 0x00, 0x48, 0x00, 0x5a, 0x00, 0x73, 0x00, 0x88, 0x00,
+  0x9a, 0x00, 0xac, 0x00, 0xbe, 0x00, 0xd0, 0x00, 0xeb, 0x00, 0xfd, 0x00,
+  0x13, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x56, 0x01, 0x68, 0x01, 0x7a, 0x01,
+  0x93, 0x01, 0xa5, 0x01, 0xb7, 0x01, 0xc4, 0x01, 0xd6, 0x01, 0xe7, 0x01,
+  0xf8, 0x01, 0x09, 0x02, 0x1b, 0x02, 0x2d, 0x02, 0x4a, 0x02, 0x5c, 0x02,
+  0x6d, 0x02, 0x7f, 0x02, 0x91, 0x02, 0xa9, 0x02, 0xbb, 0x02, 0xce, 0x02,
+  0xe9, 0x02, 0xfc, 0x02, 0x0e, 0x03, 0x20, 0x03, 0x31, 0x03, 0x00, 0x00,
+  0x11, 0x00, 0x22, 0x00, 0x33, 0x00, 0x44, 0x00, 0x54, 0x00, 0x65, 0x00,
+  0x79, 0x00, 0x8a, 0x00, 0x9b, 0x00, 0xac, 0x00, 0xbd, 0x00, 0xcc, 0x00,
+  0xeb, 0x00, 0xfc, 0x00, 0x17, 0x01, 0x27, 0x01, 0x38, 0x01, 0x49, 0x01,
+  0x5a, 0x01, 0x6b, 0x01, 0x00, 0x00, 0x20, 0x00, 0x3e, 0x00, 0x5c, 0x00,
+  0x7b, 0x00, 0x94, 0x00, 0xa6, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x33, 0x00,
+  0x48, 0x00, 0x66, 0x00, 0x7a, 0x00, 0x98, 0x00, 0xab, 0x00, 0xbf, 0x00,
+  0xcc, 0x00, 0xe0, 0x00, 0xf4, 0x00, 0x08, 0x01, 0x1c, 0x01, 0x30, 0x01,
+  0x51, 0x01, 0x65, 0x01, 0x84, 0x01, 0x98, 0x01, 0xac, 0x01, 0xc1, 0x01,
+  0x00, 0x00, 0x15, 0x00, 0x34, 0x00, 0x4a, 0x00, 0x5f, 0x00, 0x7e, 0x00,
+  0x96, 0x00, 0xab, 0x00, 0xc1, 0x00, 0xcf, 0x00, 0xe5, 0x00, 0xfe, 0x00,
+  0x17, 0x01, 0x36, 0x01, 0x4b, 0x01, 0x61, 0x01, 0x77, 0x01, 0x96, 0x01,
+  0xad, 0x01, 0xc3, 0x01, 0xd1, 0x01, 0xf0, 0x01, 0x06, 0x02, 0x25, 0x02,
+  0x00, 0x00, 0x1e, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x20, 0x00,
+  0x43, 0x00, 0x54, 0x00, 0x77, 0x00, 0x9a, 0x00, 0x00, 0x00, 0x14, 0x00,
+  0x28, 0x00, 0x3c, 0x00, 0x50, 0x00, 0x64, 0x00, 0x78, 0x00, 0x8c, 0x00,
+  0xa0, 0x00, 0xb3, 0x00, 0xc7, 0x00, 0xdb, 0x00, 0xee, 0x00, 0x00, 0x00,
+  0x18, 0x00, 0x37, 0x00, 0x4f, 0x00, 0x00, 0x00, 0x21, 0x00, 0x42, 0x00,
+  0x56, 0x00, 0x65, 0x00, 0x78, 0x00, 0x8c, 0x00, 0xa0, 0x00, 0xb3, 0x00,
+  0xc7, 0x00, 0xdb, 0x00, 0xf3, 0x00, 0x00, 0x00, 0x12, 0x00, 0x24, 0x00,
+  0x36, 0x00, 0x47, 0x00, 0x59, 0x00, 0x6b, 0x00, 0x7d, 0x00, 0x8f, 0x00,
+  0xa1, 0x00, 0xb3, 0x00, 0xc5, 0x00, 0xd7, 0x00, 0x00, 0x00, 0x21, 0x00,
+  0x42, 0x00, 0x56, 0x00, 0x69, 0x00, 0x7d, 0x00, 0x90, 0x00, 0xa1, 0x00,
+  0xb5, 0x00, 0xc8, 0x00, 0xdc, 0x00, 0xf0, 0x00, 0x04, 0x01, 0x18, 0x01,
+  0x2c, 0x01, 0x40, 0x01, 0x53, 0x01, 0x67, 0x01, 0x7b, 0x01, 0x8f, 0x01,
+  0xa3, 0x01, 0xb7, 0x01, 0x00, 0x00, 0x15, 0x00, 0x28, 0x00, 0x3c, 0x00,
+  0x46, 0x00, 0x5a, 0x00, 0x6f, 0x00, 0x00, 0x00, 0x17, 0x00, 0x2f, 0x00,
+  0x47, 0x00, 0x5e, 0x00, 0x76, 0x00, 0x8e, 0x00, 0xa6, 0x00, 0xbe, 0x00,
+  0x00, 0x00, 0x14, 0x00, 0x2b, 0x00, 0x3f, 0x00, 0x54, 0x00, 0x66, 0x00,
+  0x7b, 0x00, 0x90, 0x00, 0xa5, 0x00, 0xbb, 0x00, 0xd0, 0x00, 0xe4, 0x00,
+  0xfb, 0x00, 0x11, 0x01, 0x25, 0x01, 0x3e, 0x01, 0x00, 0x00, 0x18, 0x00,
+  0x2c, 0x00, 0x3f, 0x00, 0x5a, 0x00, 0x72, 0x00, 0x85, 0x00, 0x9c, 0x00,
+  0xb4, 0x00, 0xcb, 0x00, 0xe2, 0x00, 0xf9, 0x00, 0x11, 0x01, 0x29, 0x01,
+  0x40, 0x01, 0x58, 0x01, 0x6f, 0x01, 0x87, 0x01, 0x9f, 0x01, 0xb2, 0x01,
+  0xca, 0x01, 0xe2, 0x01, 0xfa, 0x01, 0x12, 0x02, 0x26, 0x02, 0x3e, 0x02,
+  0x56, 0x02, 0x6e, 0x02, 0x86, 0x02, 0x9d, 0x02, 0xb5, 0x02, 0xcf, 0x02,
+  0xe6, 0x02, 0xfe, 0x02, 0x16, 0x03, 0x2e, 0x03, 0x46, 0x03, 0x5d, 0x03,
+  0x74, 0x03, 0x8c, 0x03, 0x00, 0x00, 0x0a, 0x00, 0x1d, 0x00, 0x35, 0x00,
+  0x53, 0x00, 0x6a, 0x00, 0x81, 0x00, 0x94, 0x00, 0xa8, 0x00, 0xbb, 0x00,
+  0xcc, 0x00, 0xe0, 0x00, 0xf3, 0x00, 0x06, 0x01, 0x00, 0x00, 0x11, 0x00,
+  0x22, 0x00, 0x33, 0x00, 0x43, 0x00, 0x54, 0x00, 0x65, 0x00, 0x75, 0x00,
+  0x82, 0x00, 0x93, 0x00, 0xa3, 0x00, 0xb4, 0x00, 0x00, 0x00, 0x15, 0x00,
+  0x2b, 0x00, 0x41, 0x00, 0x57, 0x00, 0x6c, 0x00, 0x82, 0x00, 0x98, 0x00,
+  0xad, 0x00, 0xc2, 0x00, 0xce, 0x00, 0xe4, 0x00, 0xf9, 0x00, 0x0f, 0x01,
+  0x2e, 0x01, 0x44, 0x01, 0x00, 0x00, 0x11, 0x00, 0x20, 0x00, 0x31, 0x00,
+  0x41, 0x00, 0x51, 0x00, 0x60, 0x00, 0x71, 0x00, 0x82, 0x00, 0x93, 0x00,
+  0xa3, 0x00, 0xb3, 0x00, 0xc7, 0x00, 0xd8, 0x00, 0xe7, 0x00, 0xfb, 0x00,
+  0x0a, 0x01, 0x1a, 0x01, 0x2a, 0x01, 0x37, 0x01, 0x48, 0x01, 0x59, 0x01,
+  0x6a, 0x01, 0x79, 0x01, 0x8a, 0x01, 0x9b, 0x01, 0xab, 0x01, 0xba, 0x01,
+  0xcb, 0x01, 0xdc, 0x01, 0xeb, 0x01, 0xfc, 0x01, 0x0c, 0x02, 0x1b, 0x02,
+  0x2c, 0x02, 0x40, 0x02, 0x00, 0x00, 0x1d, 0x00, 0x27, 0x00, 0x3e, 0x00,
+  0x54, 0x00, 0x70, 0x00, 0x8b, 0x00, 0xa8, 0x00, 0xc4, 0x00, 0xe0, 0x00,
+  0xf6, 0x00, 0x0c, 0x01, 0x29, 0x01, 0x3e, 0x01, 0x53, 0x01, 0x70, 0x01,
+  0x86, 0x01, 0x00, 0x00, 0x14, 0x00, 0x28, 0x00, 0x3b, 0x00, 0x5a, 0x00,
+  0x6e, 0x00, 0x8c, 0x00, 0xa9, 0x00, 0xbd, 0x00, 0xdb, 0x00, 0xef, 0x00,
+  0x0d, 0x01, 0x20, 0x01, 0x34, 0x01, 0x53, 0x01, 0x65, 0x01, 0x79, 0x01,
+  0x97, 0x01, 0xa4, 0x01, 0xb8, 0x01, 0xd7, 0x01, 0xea, 0x01, 0x09, 0x02,
+  0x1d, 0x02, 0x31, 0x02, 0x3e, 0x02, 0x4b, 0x02, 0x6a, 0x02, 0x00, 0x00,
+  0x16, 0x00, 0x2c, 0x00, 0x40, 0x00, 0x00, 0x00, 0x11, 0x00, 0x22, 0x00,
+  0x33, 0x00, 0x4b, 0x00, 0x5a, 0x00, 0x6b, 0x00, 0x7c, 0x00, 0x8d, 0x00,
+  0xa1, 0x00, 0xb5, 0x00, 0xc6, 0x00, 0xd7, 0x00, 0xe8, 0x00, 0xf9, 0x00,
+  0x06, 0x01, 0x17, 0x01, 0x27, 0x01, 0x38, 0x01, 0x4c, 0x01, 0x61, 0x01,
+  0x71, 0x01, 0x82, 0x01, 0x93, 0x01, 0xa6, 0x01, 0xb7, 0x01, 0xc8, 0x01,
+  0xd9, 0x01, 0xea, 0x01, 0xfb, 0x01, 0x0c, 0x02, 0x1d, 0x02, 0x2e, 0x02,
+  0x3e, 0x02, 0x4f, 0x02, 0x60, 0x02, 0x71, 0x02, 0x81, 0x02, 0x92, 0x02,
+  0xa3, 0x02, 0x00, 0x00, 0x0a, 0x00, 0x19, 0x00, 0x22, 0x00, 0x31, 0x00,
+  0x00, 0x00, 0x14, 0x00, 0x25, 0x00, 0x00, 0x00, 0x10, 0x00, 0x22, 0x00,
+  0x2d, 0x00, 0x40, 0x00, 0x59, 0x00, 0x6b, 0x00, 0x00, 0x00, 0x13, 0x00,
+  0x28, 0x00, 0x3c, 0x00, 0x4f, 0x00, 0x63, 0x00, 0x77, 0x00, 0x8b, 0x00,
+  0x9f, 0x00, 0xb3, 0x00, 0xc7, 0x00, 0xdb, 0x00, 0xee, 0x00, 0x02, 0x01,
+  0x16, 0x01, 0x2a, 0x01, 0x3d, 0x01, 0x51, 0x01, 0x65, 0x01, 0x79, 0x01,
+  0x8d, 0x01, 0xa1, 0x01, 0xb5, 0x01, 0xc9, 0x01, 0xdd, 0x01, 0xf1, 0x01,
+  0x05, 0x02, 0x19, 0x02, 0x2d, 0x02, 0x40, 0x02, 0x00, 0x00, 0x16, 0x00,
+  0x2b, 0x00, 0x40, 0x00, 0x55, 0x00, 0x79, 0x00, 0x8d, 0x00, 0xa1, 0x00,
+  0xb5, 0x00, 0xcb, 0x00, 0xdf, 0x00, 0x00, 0x00, 0x18, 0x00, 0x2f, 0x00,
+  0x47, 0x00, 0x5f, 0x00, 0x77, 0x00, 0x8f, 0x00, 0xa7, 0x00, 0xbe, 0x00,
+  0xd4, 0x00, 0xec, 0x00, 0x03, 0x01, 0x19, 0x01, 0x31, 0x01, 0x49, 0x01,
+  0x61, 0x01, 0x78, 0x01, 0x8d, 0x01, 0xa5, 0x01, 0xbd, 0x01, 0xd5, 0x01,
+  0xed, 0x01, 0x04, 0x02, 0x1c, 0x02, 0x33, 0x02, 0x4c, 0x02, 0x64, 0x02,
+  0x7c, 0x02, 0x94, 0x02, 0xac, 0x02, 0xc3, 0x02, 0xdb, 0x02, 0xf2, 0x02,
+  0x0a, 0x03, 0x27, 0x03, 0x3e, 0x03, 0x55, 0x03, 0x6d, 0x03, 0x8b, 0x03,
+  0xa3, 0x03, 0x00, 0x00, 0x12, 0x00, 0x24, 0x00, 0x3b, 0x00, 0x54, 0x00,
+  0x5f, 0x00, 0x76, 0x00, 0x8c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x21, 0x00,
+  0x34, 0x00, 0x47, 0x00, 0x5b, 0x00, 0x6e, 0x00, 0x82, 0x00, 0x95, 0x00,
+  0xa9, 0x00, 0xbc, 0x00, 0xd0, 0x00, 0xe4, 0x00, 0xf8, 0x00, 0x0c, 0x01,
+  0x20, 0x01, 0x33, 0x01, 0x4c, 0x01, 0x60, 0x01, 0x74, 0x01, 0x88, 0x01,
+  0x9b, 0x01, 0xb6, 0x01, 0xcd, 0x01, 0xe1, 0x01, 0xf5, 0x01, 0x09, 0x02,
+  0x1c, 0x02, 0x30, 0x02, 0x3a, 0x02, 0x4d, 0x02, 0x61, 0x02, 0x78, 0x02,
+  0x8c, 0x02, 0xa0, 0x02, 0x00, 0x00, 0x16, 0x00, 0x2f, 0x00, 0x44, 0x00,
+  0x5a, 0x00, 0x70, 0x00, 0x86, 0x00, 0x9e, 0x00, 0xb4, 0x00, 0xca, 0x00,
+  0xe3, 0x00, 0xfc, 0x00, 0x15, 0x01, 0x2b, 0x01, 0x40, 0x01, 0x56, 0x01,
+  0x6b, 0x01, 0x84, 0x01, 0x99, 0x01, 0xae, 0x01, 0xc4, 0x01, 0xd9, 0x01,
+  0xef, 0x01, 0x05, 0x02, 0x1a, 0x02, 0x2f, 0x02, 0x45, 0x02, 0x5a, 0x02,
+  0x6f, 0x02, 0x85, 0x02, 0x9b, 0x02, 0xb1, 0x02, 0xc7, 0x02, 0xdc, 0x02,
+  0xf9, 0x02, 0x0e, 0x03, 0x24, 0x03, 0x3d, 0x03, 0x52, 0x03, 0x68, 0x03,
+  0x7d, 0x03, 0x96, 0x03, 0xac, 0x03, 0xc4, 0x03, 0xdc, 0x03, 0xf1, 0x03,
+  0x07, 0x04, 0x1c, 0x04, 0x35, 0x04, 0x4b, 0x04, 0x60, 0x04, 0x75, 0x04,
+  0x8a, 0x04, 0xa0, 0x04, 0xb6, 0x04, 0xcc, 0x04, 0xe1, 0x04, 0xfa, 0x04,
+  0x13, 0x05, 0x00, 0x00, 0x10, 0x00, 0x1f, 0x00, 0x30, 0x00, 0x41, 0x00,
+  0x52, 0x00, 0x63, 0x00, 0x72, 0x00, 0x84, 0x00, 0x00, 0x00, 0x16, 0x00,
+  0x2a, 0x00, 0x42, 0x00, 0x5a, 0x00, 0x72, 0x00, 0x87, 0x00, 0x9d, 0x00,
+  0xb3, 0x00, 0xcc, 0x00, 0xe4, 0x00, 0xfd, 0x00, 0x13, 0x01, 0x2c, 0x01,
+  0x42, 0x01, 0x58, 0x01, 0x71, 0x01, 0x8a, 0x01, 0xa9, 0x01, 0xc1, 0x01,
+  0xd9, 0x01, 0xee, 0x01, 0x03, 0x02, 0x18, 0x02, 0x31, 0x02, 0x4a, 0x02,
+  0x62, 0x02, 0x78, 0x02, 0x90, 0x02, 0xa5, 0x02, 0xbd, 0x02, 0xd5, 0x02,
+  0xea, 0x02, 0xff, 0x02, 0x14, 0x03, 0x2d, 0x03, 0x42, 0x03, 0x5b, 0x03,
+  0x70, 0x03, 0x86, 0x03, 0x9b, 0x03, 0xb1, 0x03, 0xc6, 0x03, 0xdf, 0x03,
+  0xf5, 0x03, 0x0a, 0x04, 0x20, 0x04, 0x38, 0x04, 0x4e, 0x04, 0x6d, 0x04,
+  0x83, 0x04, 0x98, 0x04, 0xad, 0x04, 0xc3, 0x04, 0xd8, 0x04, 0xf1, 0x04,
+  0x0a, 0x05, 0x29, 0x05, 0x3f, 0x05, 0x55, 0x05, 0x6e, 0x05, 0x83, 0x05,
+  0x98, 0x05, 0xaf, 0x05, 0xc5, 0x05, 0xde, 0x05, 0xf4, 0x05, 0x0a, 0x06,
+  0x23, 0x06, 0x3c, 0x06, 0x51, 0x06, 0x65, 0x06, 0x7d, 0x06, 0x95, 0x06,
+  0xae, 0x06, 0xc5, 0x06, 0xde, 0x06, 0xf4, 0x06, 0x00, 0x07, 0x15, 0x07,
+  0x2e, 0x07, 0x47, 0x07, 0x00, 0x00, 0x13, 0x00, 0x20, 0x00, 0x3b, 0x00,
+  0x55, 0x00, 0x6f, 0x00, 0x8a, 0x00, 0xa5, 0x00, 0xb6, 0x00, 0xd0, 0x00,
+  0xeb, 0x00, 0x05, 0x01, 0x13, 0x01, 0x2e, 0x01, 0x49, 0x01, 0x63, 0x01,
+  0x7e, 0x01, 0x8b, 0x01, 0xa5, 0x01, 0xc0, 0x01, 0xdb, 0x01, 0xe8, 0x01,
+  0x02, 0x02, 0x1d, 0x02, 0x37, 0x02, 0x52, 0x02, 0x6d, 0x02, 0x88, 0x02,
+  0x99, 0x02, 0xb6, 0x02, 0xd1, 0x02, 0xec, 0x02, 0x00, 0x00, 0x1d, 0x00,
+  0x3a, 0x00, 0x58, 0x00, 0x74, 0x00, 0x8f, 0x00, 0xac, 0x00, 0xc9, 0x00,
+  0xe6, 0x00, 0x02, 0x01, 0x1e, 0x01, 0x3b, 0x01, 0x53, 0x01, 0x6b, 0x01,
+  0x88, 0x01, 0x9a, 0x01, 0xb7, 0x01, 0xd3, 0x01, 0xef, 0x01, 0x0b, 0x02,
+  0x22, 0x02, 0x3f, 0x02, 0x5c, 0x02, 0x72, 0x02, 0x89, 0x02, 0x00, 0x00,
+  0x21, 0x00, 0x3f, 0x00, 0x5e, 0x00, 0x7e, 0x00, 0x9f, 0x00, 0xc0, 0x00,
+  0xe0, 0x00, 0x01, 0x01, 0x20, 0x01, 0x3f, 0x01, 0x60, 0x01, 0x81, 0x01,
+  0xa1, 0x01, 0xc2, 0x01, 0xe1, 0x01, 0xff, 0x01, 0x1e, 0x02, 0x3d, 0x02,
+  0x5e, 0x02, 0x6b, 0x02, 0x8a, 0x02, 0xab, 0x02, 0xcb, 0x02, 0xeb, 0x02,
+  0x0b, 0x03, 0x2c, 0x03, 0x4a, 0x03, 0x00, 0x00, 0x1c, 0x00, 0x32, 0x00,
+  0x4a, 0x00, 0x63, 0x00, 0x7f, 0x00, 0x9b, 0x00, 0xb0, 0x00, 0xc5, 0x00,
+  0xdb, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x14, 0x00, 0x28, 0x00,
+  0x3a, 0x00, 0x50, 0x00, 0x63, 0x00, 0x75, 0x00, 0x88, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x24, 0x00, 0x2f, 0x00, 0x3a, 0x00, 0x52, 0x00, 0x69, 0x00,
+  0x7b, 0x00, 0x93, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x21, 0x00, 0x34, 0x00,
+  0x48, 0x00, 0x5c, 0x00, 0x70, 0x00, 0x8b, 0x00, 0x9f, 0x00, 0xb3, 0x00,
+  0xc1, 0x00, 0xd5, 0x00, 0x00, 0x00, 0x15, 0x00, 0x27, 0x00, 0x3b, 0x00,
+  0x4d, 0x00, 0x5f, 0x00, 0x71, 0x00, 0x81, 0x00, 0x93, 0x00, 0xaa, 0x00,
+  0xc0, 0x00, 0xd2, 0x00, 0xe4, 0x00, 0xf6, 0x00, 0x08, 0x01, 0x1d, 0x01,
+  0x00, 0x00, 0x15, 0x00, 0x2d, 0x00, 0x45, 0x00, 0x55, 0x00, 0x6d, 0x00,
+  0x84, 0x00, 0x95, 0x00, 0xad, 0x00, 0xc4, 0x00, 0xdc, 0x00, 0xf4, 0x00,
+  0x03, 0x01, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x14, 0x00, 0x28, 0x00,
+  0x35, 0x00, 0x49, 0x00, 0x62, 0x00, 0x76, 0x00, 0x89, 0x00, 0x9d, 0x00,
+  0xac, 0x00, 0xc4, 0x00, 0xd8, 0x00, 0xec, 0x00, 0x00, 0x01, 0x1b, 0x01,
+  0x2e, 0x01, 0x42, 0x01, 0x55, 0x01, 0x00, 0x00, 0x1b, 0x00, 0x33, 0x00,
+  0x4b, 0x00, 0x67, 0x00, 0x7f, 0x00, 0x97, 0x00, 0xb0, 0x00, 0xcc, 0x00,
+  0xe5, 0x00, 0xfe, 0x00, 0x1b, 0x01, 0x36, 0x01, 0x52, 0x01, 0x68, 0x01,
+  0x7e, 0x01, 0x96, 0x01, 0xa9, 0x01, 0xbb, 0x01, 0xd4, 0x01, 0xf0, 0x01,
+  0x0d, 0x02, 0x2a, 0x02, 0x46, 0x02, 0x5f, 0x02, 0x7b, 0x02, 0x98, 0x02,
+  0xb4, 0x02, 0xc5, 0x02, 0xdd, 0x02, 0xef, 0x02, 0x00, 0x00, 0x10, 0x00,
+  0x21, 0x00, 0x30, 0x00, 0x41, 0x00, 0x5b, 0x00, 0x6b, 0x00, 0x7a, 0x00,
+  0x8a, 0x00, 0x9b, 0x00, 0xa8, 0x00, 0xb5, 0x00, 0xc7, 0x00, 0xe4, 0x00,
+  0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1f, 0x00, 0x2f, 0x00,
+  0x3f, 0x00, 0x4f, 0x00, 0x5f, 0x00, 0x70, 0x00, 0x8a, 0x00, 0xa2, 0x00,
+  0xb2, 0x00, 0xc4, 0x00, 0xd4, 0x00, 0xe3, 0x00, 0xfe, 0x00, 0x0e, 0x01,
+  0x1e, 0x01, 0x32, 0x01, 0x42, 0x01, 0x53, 0x01, 0x6d, 0x01, 0x7d, 0x01,
+  0x8e, 0x01, 0xa9, 0x01, 0xba, 0x01, 0xca, 0x01, 0xda, 0x01, 0xf5, 0x01,
+  0x06, 0x02, 0x16, 0x02, 0x27, 0x02, 0x38, 0x02, 0x49, 0x02, 0x59, 0x02,
+  0x00, 0x00, 0x1d, 0x00, 0x3a, 0x00, 0x56, 0x00, 0x60, 0x00, 0x74, 0x00,
+  0x89, 0x00, 0xa2, 0x00, 0xbb, 0x00, 0xd3, 0x00, 0xde, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x28, 0x00, 0x42, 0x00, 0x67, 0x00, 0x7a, 0x00, 0x8e, 0x00,
+  0xa1, 0x00, 0xb5, 0x00, 0xc9, 0x00, 0xdd, 0x00, 0xf1, 0x00, 0x0b, 0x01,
+  0x1e, 0x01, 0x32, 0x01, 0x47, 0x01, 0x5b, 0x01, 0x6e, 0x01, 0x7b, 0x01,
+  0x95, 0x01, 0xa9, 0x01, 0xbc, 0x01, 0xd0, 0x01, 0xe4, 0x01, 0xf8, 0x01,
+  0x0c, 0x02, 0x20, 0x02, 0x34, 0x02, 0x48, 0x02, 0x5c, 0x02, 0x7e, 0x02,
+  0x92, 0x02, 0xa6, 0x02, 0xbb, 0x02, 0xcf, 0x02, 0xe3, 0x02, 0xfc, 0x02,
+  0x10, 0x03, 0x24, 0x03, 0x37, 0x03, 0x50, 0x03, 0x64, 0x03, 0x77, 0x03,
+  0x89, 0x03, 0xa1, 0x03, 0xbb, 0x03, 0xcf, 0x03, 0x00, 0x00, 0x16, 0x00,
+  0x2c, 0x00, 0x41, 0x00, 0x57, 0x00, 0x6e, 0x00, 0x84, 0x00, 0x9a, 0x00,
+  0xb0, 0x00, 0xc6, 0x00, 0xdc, 0x00, 0xf2, 0x00, 0x08, 0x01, 0x1e, 0x01,
+  0x34, 0x01, 0x4a, 0x01, 0x63, 0x01, 0x7c, 0x01, 0x92, 0x01, 0xa8, 0x01,
+  0xbd, 0x01, 0xd1, 0x01, 0xe6, 0x01, 0xfc, 0x01, 0x12, 0x02, 0x1c, 0x02,
+  0x32, 0x02, 0x48, 0x02, 0x5d, 0x02, 0x73, 0x02, 0x89, 0x02, 0x9f, 0x02,
+  0xb5, 0x02, 0xcb, 0x02, 0xe1, 0x02, 0xf7, 0x02, 0x0d, 0x03, 0x23, 0x03,
+  0x39, 0x03, 0x51, 0x03, 0x66, 0x03, 0x7d, 0x03, 0x93, 0x03, 0xa9, 0x03,
+  0xbf, 0x03, 0xd4, 0x03, 0xea, 0x03, 0x00, 0x04, 0x16, 0x04, 0x2c, 0x04,
+  0x41, 0x04, 0x57, 0x04, 0x6d, 0x04, 0x85, 0x04, 0x9a, 0x04, 0xaf, 0x04,
+  0xc5, 0x04, 0xda, 0x04, 0xf0, 0x04, 0x06, 0x05, 0x1b, 0x05, 0x00, 0x00,
+  0x11, 0x00, 0x30, 0x00, 0x41, 0x00, 0x52, 0x00, 0x63, 0x00, 0x74, 0x00,
+  0x85, 0x00, 0x95, 0x00, 0xa6, 0x00, 0xb7, 0x00, 0xc8, 0x00, 0xd9, 0x00,
+  0xea, 0x00, 0xfb, 0x00, 0x0c, 0x01, 0x1d, 0x01, 0x2a, 0x01, 0x3b, 0x01,
+  0x4f, 0x01, 0x67, 0x01, 0x78, 0x01, 0x89, 0x01, 0x9a, 0x01, 0xab, 0x01,
+  0xbc, 0x01, 0xce, 0x01, 0xde, 0x01, 0xee, 0x01, 0xff, 0x01, 0x10, 0x02,
+  0x21, 0x02, 0x31, 0x02, 0x42, 0x02, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00,
+  0x23, 0x00, 0x00, 0x00, 0x12, 0x00, 0x24, 0x00, 0x3c, 0x00, 0x4a, 0x00,
+  0x5c, 0x00, 0x75, 0x00, 0x89, 0x00, 0x9a, 0x00, 0xac, 0x00, 0xba, 0x00,
+  0xc8, 0x00, 0x00, 0x00, 0x14, 0x00, 0x26, 0x00, 0x39, 0x00, 0x4e, 0x00,
+  0x61, 0x00, 0x74, 0x00, 0x88, 0x00, 0x9c, 0x00, 0xb0, 0x00, 0xc4, 0x00,
+  0xde, 0x00, 0xf2, 0x00, 0x06, 0x01, 0x1a, 0x01, 0x2d, 0x01, 0x41, 0x01,
+  0x55, 0x01, 0x69, 0x01, 0x7d, 0x01, 0x90, 0x01, 0xa3, 0x01, 0xb7, 0x01,
+  0xcb, 0x01, 0xde, 0x01, 0xf2, 0x01, 0x06, 0x02, 0x1a, 0x02, 0x2e, 0x02,
+  0x42, 0x02, 0x55, 0x02, 0x69, 0x02, 0x7d, 0x02, 0x91, 0x02, 0xa5, 0x02,
+  0xb9, 0x02, 0xc6, 0x02, 0xda, 0x02, 0xee, 0x02, 0x01, 0x03, 0x1b, 0x03,
+  0x2f, 0x03, 0x48, 0x03, 0x5c, 0x03, 0x70, 0x03, 0x84, 0x03, 0x98, 0x03,
+  0xab, 0x03, 0xbf, 0x03, 0x00, 0x00, 0x17, 0x00, 0x35, 0x00, 0x53, 0x00,
+  0x00, 0x00, 0x18, 0x00, 0x2f, 0x00, 0x46, 0x00, 0x5e, 0x00, 0x74, 0x00,
+  0x8b, 0x00, 0x00, 0x00, 0x16, 0x00, 0x33, 0x00, 0x4a, 0x00, 0x60, 0x00,
+  0x72, 0x00, 0x8f, 0x00, 0xa1, 0x00, 0x00, 0x00, 0x14, 0x00, 0x2c, 0x00,
+  0x40, 0x00, 0x57, 0x00, 0x6f, 0x00, 0x88, 0x00, 0xa0, 0x00, 0xb2, 0x00,
+  0xc8, 0x00, 0xe2, 0x00, 0xf9, 0x00, 0x10, 0x01, 0x24, 0x01, 0x3c, 0x01,
+  0x54, 0x01, 0x6b, 0x01, 0x7f, 0x01, 0x97, 0x01, 0xab, 0x01, 0xc3, 0x01,
+  0xdb, 0x01, 0xf3, 0x01, 0x0b, 0x02, 0x22, 0x02, 0x36, 0x02, 0x4e, 0x02,
+  0x65, 0x02, 0x7d, 0x02, 0x91, 0x02, 0xa4, 0x02, 0xb8, 0x02, 0xd0, 0x02,
+  0xe4, 0x02, 0xfc, 0x02, 0x14, 0x03, 0x2c, 0x03, 0x43, 0x03, 0x5a, 0x03,
+  0x70, 0x03, 0x87, 0x03, 0x9b, 0x03, 0xb2, 0x03, 0xc7, 0x03, 0xdb, 0x03,
+  0xf5, 0x03, 0x0c, 0x04, 0x20, 0x04, 0x38, 0x04, 0x50, 0x04, 0x69, 0x04,
+  0x7d, 0x04, 0x94, 0x04, 0xa8, 0x04, 0xc0, 0x04, 0xd8, 0x04, 0xef, 0x04,
+  0x06, 0x05, 0x1d, 0x05, 0x34, 0x05, 0x4c, 0x05, 0x63, 0x05, 0x7b, 0x05,
+  0x93, 0x05, 0xab, 0x05, 0xc2, 0x05, 0xda, 0x05, 0xf2, 0x05, 0x09, 0x06,
+  0x20, 0x06, 0x37, 0x06, 0x4b, 0x06, 0x64, 0x06, 0x7b, 0x06, 0x93, 0x06,
+  0xa7, 0x06, 0xbb, 0x06, 0xcf, 0x06, 0xe6, 0x06, 0xfd, 0x06, 0x15, 0x07,
+  0x29, 0x07, 0x41, 0x07, 0x58, 0x07, 0x6f, 0x07, 0x87, 0x07, 0xa0, 0x07,
+  0xb8, 0x07, 0xd0, 0x07, 0xe4, 0x07, 0xfb, 0x07, 0x0f, 0x08, 0x27, 0x08,
+  0x3f, 0x08, 0x53, 0x08, 0x6b, 0x08, 0x85, 0x08, 0x9c, 0x08, 0xb4, 0x08,
+  0xcc, 0x08, 0xe5, 0x08, 0xfd, 0x08, 0x15, 0x09, 0x29, 0x09, 0x41, 0x09,
+  0x55, 0x09, 0x6c, 0x09, 0x83, 0x09, 0x93, 0x09, 0xaa, 0x09, 0xc2, 0x09,
+  0xd9, 0x09, 0xed, 0x09, 0x05, 0x0a, 0x1c, 0x0a, 0x34, 0x0a, 0x4b, 0x0a,
+  0x63, 0x0a, 0x79, 0x0a, 0x8d, 0x0a, 0xa0, 0x0a, 0xb7, 0x0a, 0xce, 0x0a,
+  0xe5, 0x0a, 0xfd, 0x0a, 0x11, 0x0b, 0x25, 0x0b, 0x39, 0x0b, 0x4d, 0x0b,
+  0x66, 0x0b, 0x7a, 0x0b, 0x93, 0x0b, 0x00, 0x00, 0x16, 0x00, 0x2c, 0x00,
+  0x42, 0x00, 0x58, 0x00, 0x70, 0x00, 0x86, 0x00, 0x9c, 0x00, 0xb3, 0x00,
+  0xc8, 0x00, 0xdd, 0x00, 0xf4, 0x00, 0x0a, 0x01, 0x20, 0x01, 0x36, 0x01,
+  0x4e, 0x01, 0x64, 0x01, 0x78, 0x01, 0x8e, 0x01, 0xa4, 0x01, 0xb9, 0x01,
+  0xce, 0x01, 0xe4, 0x01, 0x01, 0x02, 0x17, 0x02, 0x2d, 0x02, 0x43, 0x02,
+  0x59, 0x02, 0x6f, 0x02, 0x85, 0x02, 0x9c, 0x02, 0xb2, 0x02, 0xc8, 0x02,
+  0xde, 0x02, 0xf3, 0x02, 0x09, 0x03, 0x1f, 0x03, 0x35, 0x03, 0x50, 0x03,
+  0x66, 0x03, 0x7c, 0x03, 0x92, 0x03, 0xa7, 0x03, 0xbd, 0x03, 0xd2, 0x03,
+  0xe8, 0x03, 0xfd, 0x03, 0x13, 0x04, 0x29, 0x04, 0x3f, 0x04, 0x54, 0x04,
+  0x6c, 0x04, 0x82, 0x04, 0x98, 0x04, 0xad, 0x04, 0xc3, 0x04, 0xd9, 0x04,
+  0xee, 0x04, 0x04, 0x05, 0x1a, 0x05, 0x30, 0x05, 0x46, 0x05, 0x5c, 0x05,
+  0x71, 0x05, 0x86, 0x05, 0x9c, 0x05, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00,
+  0x2d, 0x00, 0x43, 0x00, 0x59, 0x00, 0x6f, 0x00, 0x85, 0x00, 0x9b, 0x00,
+  0xb1, 0x00, 0xc7, 0x00, 0xdd, 0x00, 0xf2, 0x00, 0x07, 0x01, 0x1c, 0x01,
+  0x32, 0x01, 0x48, 0x01, 0x5e, 0x01, 0x74, 0x01, 0x8a, 0x01, 0xa1, 0x01,
+  0xb8, 0x01, 0xce, 0x01, 0xe4, 0x01, 0xf9, 0x01, 0x0f, 0x02, 0x24, 0x02,
+  0x3a, 0x02, 0x53, 0x02, 0x69, 0x02, 0x7f, 0x02, 0x94, 0x02, 0xab, 0x02,
+  0xc0, 0x02, 0xd5, 0x02, 0xea, 0x02, 0x00, 0x03, 0x15, 0x03, 0x2b, 0x03,
+  0x41, 0x03, 0x57, 0x03, 0x6d, 0x03, 0x83, 0x03, 0x99, 0x03, 0xae, 0x03,
+  0xc4, 0x03, 0xda, 0x03, 0xf0, 0x03, 0x05, 0x04, 0x1a, 0x04, 0x30, 0x04,
+  0x46, 0x04, 0x5c, 0x04, 0x72, 0x04, 0x88, 0x04, 0x9e, 0x04, 0xb7, 0x04,
+  0xcd, 0x04, 0xe3, 0x04, 0xf9, 0x04, 0x0f, 0x05, 0x25, 0x05, 0x3b, 0x05,
+  0x50, 0x05, 0x66, 0x05, 0x7c, 0x05, 0x92, 0x05, 0xa8, 0x05, 0xbe, 0x05,
+  0xd3, 0x05, 0xe9, 0x05, 0xfe, 0x05, 0x14, 0x06, 0x2a, 0x06, 0x40, 0x06,
+  0x56, 0x06, 0x6b, 0x06, 0x81, 0x06, 0x96, 0x06, 0xae, 0x06, 0xc4, 0x06,
+  0xda, 0x06, 0xf0, 0x06, 0x05, 0x07, 0x1b, 0x07, 0x31, 0x07, 0x46, 0x07,
+  0x5c, 0x07, 0x72, 0x07, 0x88, 0x07, 0x9e, 0x07, 0xb4, 0x07, 0xc9, 0x07,
+  0xdf, 0x07, 0xf4, 0x07, 0x0a, 0x08, 0x20, 0x08, 0x35, 0x08, 0x4a, 0x08,
+  0x5f, 0x08, 0x74, 0x08, 0x89, 0x08, 0x9d, 0x08, 0xb2, 0x08, 0xc8, 0x08,
+  0xdd, 0x08, 0xf2, 0x08, 0x08, 0x09, 0x1e, 0x09, 0x37, 0x09, 0x4d, 0x09,
+  0x63, 0x09, 0x79, 0x09, 0x8f, 0x09, 0xa4, 0x09, 0xba, 0x09, 0x00, 0x00,
+  0x0f, 0x00, 0x2a, 0x00, 0x44, 0x00, 0x5e, 0x00, 0x6d, 0x00, 0x87, 0x00,
+  0xa0, 0x00, 0xba, 0x00, 0xd5, 0x00, 0xf0, 0x00, 0x0b, 0x01, 0x25, 0x01,
+  0x40, 0x01, 0x5b, 0x01, 0x76, 0x01, 0x88, 0x01, 0xa3, 0x01, 0xbe, 0x01,
+  0xcb, 0x01, 0xe6, 0x01, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x1b, 0x00,
+  0x35, 0x00, 0x53, 0x00, 0x6e, 0x00, 0x8c, 0x00, 0xa6, 0x00, 0xc1, 0x00,
+  0xda, 0x00, 0xf5, 0x00, 0x14, 0x01, 0x2f, 0x01, 0x4e, 0x01, 0x67, 0x01,
+  0x82, 0x01, 0x9c, 0x01, 0xac, 0x01, 0xc6, 0x01, 0x00, 0x00, 0x17, 0x00,
+  0x28, 0x00, 0x39, 0x00, 0x59, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x12, 0x00,
+  0x24, 0x00, 0x35, 0x00, 0x42, 0x00, 0x00, 0x00, 0x11, 0x00, 0x26, 0x00,
+  0x3f, 0x00, 0x53, 0x00, 0x00, 0x00, 0x14, 0x00, 0x23, 0x00, 0x37, 0x00,
+  0x4b, 0x00, 0x5f, 0x00, 0x74, 0x00, 0x00, 0x00, 0x12, 0x00, 0x2a, 0x00,
+  0x42, 0x00, 0x5b, 0x00, 0x73, 0x00, 0x8b, 0x00, 0x9e, 0x00, 0x00, 0x00,
+  0x18, 0x00, 0x2c, 0x00, 0x47, 0x00, 0x5b, 0x00, 0x6f, 0x00, 0x83, 0x00,
+  0x97, 0x00, 0xa7, 0x00, 0xc2, 0x00, 0x00, 0x00, 0x14, 0x00, 0x28, 0x00,
+  0x3d, 0x00, 0x55, 0x00, 0x00, 0x00, 0x17, 0x00, 0x31, 0x00, 0x49, 0x00,
+  0x61, 0x00, 0x79, 0x00, 0x91, 0x00, 0xa9, 0x00, 0xc0, 0x00, 0xd8, 0x00,
+  0xf2, 0x00, 0x09, 0x01, 0x21, 0x01, 0x3b, 0x01, 0x53, 0x01, 0x6d, 0x01,
+  0x84, 0x01, 0x9b, 0x01, 0xb3, 0x01, 0xc5, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x30, 0x00, 0x44, 0x00, 0x5f, 0x00, 0x72, 0x00, 0x87, 0x00,
+  0xa2, 0x00, 0xb6, 0x00, 0xca, 0x00, 0xe5, 0x00, 0xf9, 0x00, 0x0d, 0x01,
+  0x22, 0x01, 0x35, 0x01, 0x49, 0x01, 0x5d, 0x01, 0x78, 0x01, 0x92, 0x01,
+  0xad, 0x01, 0xc8, 0x01, 0xd5, 0x01, 0xf0, 0x01, 0x00, 0x00, 0x18, 0x00,
+  0x27, 0x00, 0x3b, 0x00, 0x53, 0x00, 0x61, 0x00, 0x79, 0x00, 0x92, 0x00,
+  0xaa, 0x00, 0xc2, 0x00, 0xdb, 0x00, 0xea, 0x00, 0xf9, 0x00, 0x16, 0x01,
+  0x25, 0x01, 0x34, 0x01, 0x43, 0x01, 0x60, 0x01, 0x70, 0x01, 0x89, 0x01,
+  0x00, 0x00, 0x0b, 0x00, 0x18, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1d, 0x00,
+  0x2c, 0x00, 0x3b, 0x00, 0x4a, 0x00, 0x59, 0x00, 0x68, 0x00, 0x77, 0x00,
+  0x86, 0x00, 0x94, 0x00, 0xa2, 0x00, 0xb1, 0x00, 0xc0, 0x00, 0xcf, 0x00,
+  0xdd, 0x00, 0xec, 0x00, 0xfa, 0x00, 0x0c, 0x01, 0x1a, 0x01, 0x29, 0x01,
+  0x38, 0x01, 0x47, 0x01, 0x00, 0x00, 0x0e, 0x00, 0x20, 0x00, 0x3b, 0x00,
+  0x55, 0x00, 0x62, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x27, 0x00, 0x40, 0x00,
+  0x4f, 0x00, 0x6c, 0x00, 0x7b, 0x00, 0x8a, 0x00, 0x99, 0x00, 0xa8, 0x00,
+  0xc1, 0x00, 0xda, 0x00, 0xf2, 0x00, 0x0b, 0x01, 0x27, 0x01, 0x44, 0x01,
+  0x5d, 0x01, 0x76, 0x01, 0x85, 0x01, 0x94, 0x01, 0xa3, 0x01, 0xbc, 0x01,
+  0xcb, 0x01, 0xe3, 0x01, 0xfc, 0x01, 0x14, 0x02, 0x00, 0x00, 0x11, 0x00,
+  0x24, 0x00, 0x37, 0x00, 0x43, 0x00, 0x4f, 0x00, 0x69, 0x00, 0x7a, 0x00,
+  0x8d, 0x00, 0x9a, 0x00, 0xae, 0x00, 0xbf, 0x00, 0xd3, 0x00, 0xe6, 0x00,
+  0xf7, 0x00, 0x0b, 0x01, 0x1c, 0x01, 0x30, 0x01, 0x41, 0x01, 0x53, 0x01,
+  0x64, 0x01, 0x75, 0x01, 0x86, 0x01, 0x00, 0x00, 0x0f, 0x00, 0x1e, 0x00,
+  0x2d, 0x00, 0x3c, 0x00, 0x4a, 0x00, 0x5d, 0x00, 0x6a, 0x00, 0x77, 0x00,
+  0x85, 0x00, 0xa1, 0x00, 0xb0, 0x00, 0xbf, 0x00, 0xce, 0x00, 0xe4, 0x00,
+  0xf3, 0x00, 0x01, 0x01, 0x0f, 0x01, 0x1e, 0x01, 0x2c, 0x01, 0x3b, 0x01,
+  0x4a, 0x01, 0x58, 0x01, 0x6c, 0x01, 0x7b, 0x01, 0x8a, 0x01, 0x95, 0x01,
+  0xa3, 0x01, 0xb0, 0x01, 0xbe, 0x01, 0xcd, 0x01, 0xda, 0x01, 0xe8, 0x01,
+  0x01, 0x02, 0x10, 0x02, 0x1f, 0x02, 0x2e, 0x02, 0x3d, 0x02, 0x4c, 0x02,
+  0x5b, 0x02, 0x68, 0x02, 0x77, 0x02, 0x00, 0x00, 0x17, 0x00, 0x30, 0x00,
+  0x47, 0x00, 0x5d, 0x00, 0x73, 0x00, 0x8b, 0x00, 0x98, 0x00, 0xae, 0x00,
+  0xc3, 0x00, 0x00, 0x00, 0x10, 0x00, 0x22, 0x00, 0x34, 0x00, 0x46, 0x00,
+  0x58, 0x00, 0x6a, 0x00, 0x7b, 0x00, 0x8c, 0x00, 0x96, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x11, 0x00, 0x20, 0x00, 0x32, 0x00, 0x41, 0x00,
+  0x4f, 0x00, 0x61, 0x00, 0x77, 0x00, 0x89, 0x00, 0xa1, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x24, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x20, 0x00, 0x36, 0x00,
+  0x45, 0x00, 0x5b, 0x00, 0x6b, 0x00, 0x81, 0x00, 0x90, 0x00, 0xa5, 0x00,
+  0x00, 0x00, 0x1b, 0x00, 0x35, 0x00, 0x46, 0x00, 0x57, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x24, 0x00, 0x36, 0x00, 0x48, 0x00, 0x5a, 0x00, 0x6b, 0x00,
+  0x7c, 0x00, 0x8e, 0x00, 0xa6, 0x00, 0xb7, 0x00, 0xc9, 0x00, 0xdb, 0x00,
+  0xed, 0x00, 0xfe, 0x00, 0x0f, 0x01, 0x20, 0x01, 0x32, 0x01, 0x44, 0x01,
+  0x56, 0x01, 0x67, 0x01, 0x78, 0x01, 0x8a, 0x01, 0x9c, 0x01, 0xae, 0x01,
+  0xc0, 0x01, 0xd2, 0x01, 0xe3, 0x01, 0xf4, 0x01, 0x05, 0x02, 0x17, 0x02,
+  0x29, 0x02, 0x3b, 0x02, 0x4d, 0x02, 0x5f, 0x02, 0x71, 0x02, 0x83, 0x02,
+  0x94, 0x02, 0xa5, 0x02, 0xb6, 0x02, 0x00, 0x00, 0x14, 0x00, 0x28, 0x00,
+  0x41, 0x00, 0x54, 0x00, 0x61, 0x00, 0x74, 0x00, 0x87, 0x00, 0x00, 0x00,
+  0x19, 0x00, 0x31, 0x00, 0x52, 0x00, 0x64, 0x00, 0x7d, 0x00, 0x8f, 0x00,
+  0xa8, 0x00, 0xb9, 0x00, 0xca, 0x00, 0xdc, 0x00, 0x00, 0x00, 0x1b, 0x00,
+  0x2d, 0x00, 0x3f, 0x00, 0x4e, 0x00, 0x5b, 0x00, 0x6a, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1e, 0x00, 0x3c, 0x00, 0x5a, 0x00, 0x6c, 0x00, 0x78, 0x00,
+  0x87, 0x00, 0xa6, 0x00, 0xc4, 0x00, 0xe3, 0x00, 0x00, 0x00, 0x0b, 0x00,
+  0x1d, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x35, 0x00,
+  0x55, 0x00, 0x74, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00,
+  0x1e, 0x00, 0x2d, 0x00, 0x3c, 0x00, 0x4e, 0x00, 0x5d, 0x00, 0x76, 0x00,
+  0x00, 0x00, 0x14, 0x00, 0x28, 0x00, 0x3c, 0x00, 0x52, 0x00, 0x66, 0x00,
+  0x79, 0x00, 0x8d, 0x00, 0xa0, 0x00, 0xb4, 0x00, 0xc8, 0x00, 0xdb, 0x00,
+  0xef, 0x00, 0x02, 0x01, 0x12, 0x01, 0x25, 0x01, 0x39, 0x01
+};
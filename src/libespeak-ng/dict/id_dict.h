@@ -1,5 +1,7 @@
 #pragma once
-const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
+#include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/id_dict_index.h>
+const unsigned char __espeakng_dict_id[] __attribute__((aligned((4)))) = {
   0x00, 0x04, 0x00, 0x00, 0xcc, 0xa7, 0x00, 0x00, 0x00, 0x55, 0x19, 0xf0,
   0x9f, 0x91, 0xa9, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xe2, 0x80,
   0x8d, 0xf0, 0x9f, 0x91, 0xa7, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa7,
@@ -3623,4 +3625,11 @@ const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
   0x48, 0x06, 0x25, 0x32, 0x2f, 0x23, 0x45, 0x00, 0x24, 0x03, 0x49, 0x6e,
   0x37, 0x23, 0x33, 0x00, 0x07, 0x00
 };
-size_t __espeakng_dictlen = 43458;
+
+BackgroundAudioDictionary dict_id = {
+    "id",
+    43458,
+    __espeakng_dict_id,
+    7382,
+    __espeakng_dictindex_id
+};
@@ -1,5 +1,7 @@
 #pragma once
-const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
+#include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/io_dict_index.h>
+const unsigned char __espeakng_dict_io[] __attribute__((aligned((4)))) = {
   0x00, 0x04, 0x00, 0x00, 0x5a, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x0d, 0x04, 0x5f, 0x64, 0x70, 0x74, 0x0a, 0x31,
@@ -182,4 +184,11 @@ const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
   0x00, 0x07, 0x06, 0x7a, 0x00, 0x03, 0x59, 0x00, 0x08, 0x02, 0x20, 0x03,
   0x59, 0x24, 0x00, 0x07, 0x00
 };
-size_t __espeakng_dictlen = 2165;
+
+BackgroundAudioDictionary dict_io = {
+    "io",
+    2165,
+    __espeakng_dict_io,
+    2218,
+    __espeakng_dictindex_io
+};
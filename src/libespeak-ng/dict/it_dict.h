@@ -1,5 +1,7 @@
 #pragma once
-const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
+#include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/it_dict_index.h>
+const unsigned char __espeakng_dict_it[] __attribute__((aligned((4)))) = {
   0x00, 0x04, 0x00, 0x00, 0xda, 0x36, 0x02, 0x00, 0x0b, 0xc8, 0x0c, 0xf3,
   0x83, 0x31, 0x54, 0xcf, 0x4c, 0x90, 0x42, 0x08, 0xc5, 0x1c, 0x90, 0x43,
   0x3c, 0xd0, 0x41, 0x08, 0xc5, 0x34, 0xf4, 0x86, 0x14, 0xd0, 0x0f, 0x00,
@@ -12869,4 +12871,11 @@ const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
   0x80, 0x82, 0x03, 0x5a, 0x00, 0x04, 0xc5, 0x9f, 0x03, 0x5c, 0x00, 0xc8,
   0x99, 0x00, 0x07, 0x00
 };
-size_t __espeakng_dictlen = 154408;
+
+BackgroundAudioDictionary dict_it = {
+    "it",
+    154408,
+    __espeakng_dict_it,
+    35602,
+    __espeakng_dictindex_it
+};
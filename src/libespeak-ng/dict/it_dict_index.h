@@ -0,0 +1,2970 @@
+#pragma once
+const unsigned char __espeakng_dictindex_it[] __attribute__((aligned((4)))) = {
+  0x45, 0x44, 0x58, 0x31, 0x28, 0x5b, 0x02, 0x00, 0xda, 0x36, 0x02, 0x00,
+  0xaa, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x0e, 0x00, 0x17, 0x00,
+  0x1f, 0x00, 0x20, 0x00, 0x2a, 0x00, 0x30, 0x00, 0x4f, 0x00, 0x60, 0x00,
+  0x6f, 0x00, 0x70, 0x00, 0x78, 0x00, 0x7a, 0x00, 0x8b, 0x00, 0x90, 0x00,
+  0x96, 0x00, 0x98, 0x00, 0xa6, 0x00, 0xa9, 0x00, 0xbe, 0x00, 0xc8, 0x00,
+  0xd2, 0x00, 0xd8, 0x00, 0xdd, 0x00, 0xe6, 0x00, 0xf0, 0x00, 0xf9, 0x00,
+  0x01, 0x01, 0x07, 0x01, 0x0f, 0x01, 0x10, 0x01, 0x3f, 0x01, 0x49, 0x01,
+  0x54, 0x01, 0x56, 0x01, 0x80, 0x01, 0x8d, 0x01, 0x97, 0x01, 0x9f, 0x01,
+  0xa7, 0x01, 0xb0, 0x01, 0xba, 0x01, 0xc3, 0x01, 0xcc, 0x01, 0xd4, 0x01,
+  0xe4, 0x01, 0x28, 0x02, 0x29, 0x02, 0x2c, 0x02, 0x3a, 0x02, 0x41, 0x02,
+  0x53, 0x02, 0x55, 0x02, 0x61, 0x02, 0x75, 0x02, 0x78, 0x02, 0x7c, 0x02,
+  0x88, 0x02, 0x8d, 0x02, 0x91, 0x02, 0x93, 0x02, 0x9d, 0x02, 0x9f, 0x02,
+  0xbf, 0x02, 0xcc, 0x02, 0xdc, 0x02, 0xe0, 0x02, 0xe6, 0x02, 0xf6, 0x02,
+  0x02, 0x03, 0x07, 0x03, 0x0d, 0x03, 0x11, 0x03, 0x22, 0x03, 0x31, 0x03,
+  0x35, 0x03, 0x47, 0x03, 0x49, 0x03, 0xb8, 0x03, 0xbb, 0x03, 0xbd, 0x03,
+  0xc2, 0x03, 0xd3, 0x03, 0xd7, 0x03, 0xe9, 0x03, 0xf3, 0x03, 0xfa, 0x03,
+  0xfc, 0x03, 0xfd, 0x03, 0x01, 0x04, 0x11, 0x04, 0x16, 0x04, 0x20, 0x04,
+  0x2a, 0x04, 0x2d, 0x04, 0x2e, 0x04, 0x43, 0x04, 0x56, 0x04, 0x61, 0x04,
+  0x64, 0x04, 0x70, 0x04, 0x75, 0x04, 0x7d, 0x04, 0x80, 0x04, 0x8a, 0x04,
+  0x8f, 0x04, 0xa1, 0x04, 0xa8, 0x04, 0xc3, 0x04, 0xcb, 0x04, 0xe9, 0x04,
+  0xef, 0x04, 0xf3, 0x04, 0xfc, 0x04, 0x01, 0x05, 0x09, 0x05, 0x10, 0x05,
+  0x24, 0x05, 0x25, 0x05, 0x34, 0x05, 0x3c, 0x05, 0x47, 0x05, 0x56, 0x05,
+  0x60, 0x05, 0x73, 0x05, 0x78, 0x05, 0x84, 0x05, 0x88, 0x05, 0x97, 0x05,
+  0xb1, 0x05, 0xbd, 0x05, 0xc0, 0x05, 0xc6, 0x05, 0xc9, 0x05, 0xca, 0x05,
+  0xd1, 0x05, 0xdc, 0x05, 0xe0, 0x05, 0xe9, 0x05, 0xf0, 0x05, 0xf9, 0x05,
+  0x01, 0x06, 0x07, 0x06, 0x0f, 0x06, 0x15, 0x06, 0x23, 0x06, 0x2a, 0x06,
+  0x36, 0x06, 0x43, 0x06, 0x4c, 0x06, 0x53, 0x06, 0x5a, 0x06, 0x63, 0x06,
+  0x7e, 0x06, 0x88, 0x06, 0x9b, 0x06, 0xa7, 0x06, 0xac, 0x06, 0xb6, 0x06,
+  0xbc, 0x06, 0xc3, 0x06, 0xc6, 0x06, 0xcf, 0x06, 0xed, 0x06, 0xf5, 0x06,
+  0xf7, 0x06, 0xfb, 0x06, 0x20, 0x07, 0x32, 0x07, 0x4f, 0x07, 0x59, 0x07,
+  0x5a, 0x07, 0x62, 0x07, 0x68, 0x07, 0x73, 0x07, 0x77, 0x07, 0x7f, 0x07,
+  0x84, 0x07, 0x8c, 0x07, 0xa9, 0x07, 0xb0, 0x07, 0xb9, 0x07, 0xc5, 0x07,
+  0xea, 0x07, 0xef, 0x07, 0x02, 0x08, 0x0d, 0x08, 0x14, 0x08, 0x23, 0x08,
+  0x2b, 0x08, 0x30, 0x08, 0x3b, 0x08, 0x3e, 0x08, 0x43, 0x08, 0x4b, 0x08,
+  0x50, 0x08, 0x5b, 0x08, 0x5d, 0x08, 0x68, 0x08, 0x6d, 0x08, 0x7d, 0x08,
+  0x98, 0x08, 0xa8, 0x08, 0xac, 0x08, 0xb1, 0x08, 0xb4, 0x08, 0xbb, 0x08,
+  0xbe, 0x08, 0xc0, 0x08, 0xc5, 0x08, 0xca, 0x08, 0xda, 0x08, 0xe0, 0x08,
+  0xe3, 0x08, 0xed, 0x08, 0xf1, 0x08, 0x06, 0x09, 0x25, 0x09, 0x35, 0x09,
+  0x35, 0x09, 0x45, 0x09, 0x49, 0x09, 0x4b, 0x09, 0x50, 0x09, 0x56, 0x09,
+  0x5a, 0x09, 0x60, 0x09, 0x61, 0x09, 0x7a, 0x09, 0x7b, 0x09, 0x80, 0x09,
+  0x98, 0x09, 0x9c, 0x09, 0xae, 0x09, 0xb5, 0x09, 0xc5, 0x09, 0xd2, 0x09,
+  0xd6, 0x09, 0xe1, 0x09, 0xe9, 0x09, 0xef, 0x09, 0xf8, 0x09, 0xfe, 0x09,
+  0x10, 0x0a, 0x26, 0x0a, 0x31, 0x0a, 0x34, 0x0a, 0x35, 0x0a, 0x3f, 0x0a,
+  0x62, 0x0a, 0x6b, 0x0a, 0x77, 0x0a, 0x89, 0x0a, 0x8b, 0x0a, 0x8c, 0x0a,
+  0x94, 0x0a, 0x9b, 0x0a, 0xa2, 0x0a, 0xa5, 0x0a, 0xaf, 0x0a, 0xba, 0x0a,
+  0xc2, 0x0a, 0xdf, 0x0a, 0xe2, 0x0a, 0xea, 0x0a, 0xf0, 0x0a, 0x0a, 0x0b,
+  0x0f, 0x0b, 0x1b, 0x0b, 0x22, 0x0b, 0x2c, 0x0b, 0x34, 0x0b, 0x5e, 0x0b,
+  0x61, 0x0b, 0x73, 0x0b, 0x83, 0x0b, 0x9d, 0x0b, 0xa3, 0x0b, 0xa8, 0x0b,
+  0xae, 0x0b, 0xb6, 0x0b, 0xc1, 0x0b, 0xc8, 0x0b, 0xcc, 0x0b, 0xd9, 0x0b,
+  0xde, 0x0b, 0xee, 0x0b, 0xf6, 0x0b, 0x0a, 0x0c, 0x0e, 0x0c, 0x34, 0x0c,
+  0x44, 0x0c, 0x4f, 0x0c, 0x54, 0x0c, 0x78, 0x0c, 0x7c, 0x0c, 0x7d, 0x0c,
+  0x82, 0x0c, 0x8c, 0x0c, 0x8e, 0x0c, 0x91, 0x0c, 0x98, 0x0c, 0x9f, 0x0c,
+  0xac, 0x0c, 0xbc, 0x0c, 0xc1, 0x0c, 0xd9, 0x0c, 0xdf, 0x0c, 0xe9, 0x0c,
+  0xf4, 0x0c, 0x21, 0x0d, 0x27, 0x0d, 0x34, 0x0d, 0x3a, 0x0d, 0x44, 0x0d,
+  0x48, 0x0d, 0x4c, 0x0d, 0x51, 0x0d, 0x64, 0x0d, 0x6a, 0x0d, 0x70, 0x0d,
+  0x79, 0x0d, 0x86, 0x0d, 0x93, 0x0d, 0x96, 0x0d, 0xa4, 0x0d, 0xac, 0x0d,
+  0xae, 0x0d, 0xc5, 0x0d, 0xcc, 0x0d, 0xcc, 0x0d, 0xd4, 0x0d, 0xdc, 0x0d,
+  0xe0, 0x0d, 0xe8, 0x0d, 0xea, 0x0d, 0xf5, 0x0d, 0xfa, 0x0d, 0x02, 0x0e,
+  0x07, 0x0e, 0x0f, 0x0e, 0x1a, 0x0e, 0x31, 0x0e, 0x3c, 0x0e, 0x5b, 0x0e,
+  0x67, 0x0e, 0x6c, 0x0e, 0x6f, 0x0e, 0x74, 0x0e, 0x7c, 0x0e, 0x85, 0x0e,
+  0x87, 0x0e, 0x8f, 0x0e, 0xa0, 0x0e, 0xa6, 0x0e, 0xae, 0x0e, 0xb1, 0x0e,
+  0xc1, 0x0e, 0xc9, 0x0e, 0xd0, 0x0e, 0xdf, 0x0e, 0xea, 0x0e, 0xef, 0x0e,
+  0xf9, 0x0e, 0x04, 0x0f, 0x08, 0x0f, 0x0b, 0x0f, 0x0f, 0x0f, 0x15, 0x0f,
+  0x1e, 0x0f, 0x25, 0x0f, 0x2c, 0x0f, 0x30, 0x0f, 0x39, 0x0f, 0x45, 0x0f,
+  0x49, 0x0f, 0x71, 0x0f, 0x7b, 0x0f, 0x8c, 0x0f, 0x90, 0x0f, 0x94, 0x0f,
+  0x98, 0x0f, 0x9f, 0x0f, 0xa8, 0x0f, 0xac, 0x0f, 0xb3, 0x0f, 0xb6, 0x0f,
+  0xc0, 0x0f, 0xc4, 0x0f, 0xcf, 0x0f, 0xd5, 0x0f, 0xdb, 0x0f, 0xde, 0x0f,
+  0xea, 0x0f, 0xf4, 0x0f, 0x03, 0x10, 0x07, 0x10, 0x0d, 0x10, 0x10, 0x10,
+  0x1c, 0x10, 0x2a, 0x10, 0x30, 0x10, 0x31, 0x10, 0x3c, 0x10, 0x3f, 0x10,
+  0x44, 0x10, 0x47, 0x10, 0x4c, 0x10, 0x50, 0x10, 0x5b, 0x10, 0x78, 0x10,
+  0x80, 0x10, 0x93, 0x10, 0x9a, 0x10, 0xa3, 0x10, 0xaa, 0x10, 0xaf, 0x10,
+  0xb6, 0x10, 0xba, 0x10, 0xc6, 0x10, 0xcf, 0x10, 0xdc, 0x10, 0xe3, 0x10,
+  0xef, 0x10, 0xf8, 0x10, 0x2e, 0x11, 0x33, 0x11, 0x39, 0x11, 0x3f, 0x11,
+  0x43, 0x11, 0x46, 0x11, 0x4a, 0x11, 0x55, 0x11, 0x5d, 0x11, 0x61, 0x11,
+  0x6d, 0x11, 0x74, 0x11, 0x8c, 0x11, 0x94, 0x11, 0x97, 0x11, 0x9d, 0x11,
+  0xbd, 0x11, 0xd2, 0x11, 0xd7, 0x11, 0xe1, 0x11, 0xee, 0x11, 0xf7, 0x11,
+  0xfb, 0x11, 0xfd, 0x11, 0x06, 0x12, 0x09, 0x12, 0x28, 0x12, 0x37, 0x12,
+  0x47, 0x12, 0x4e, 0x12, 0x74, 0x12, 0x7c, 0x12, 0x85, 0x12, 0x8a, 0x12,
+  0x8e, 0x12, 0x94, 0x12, 0x9b, 0x12, 0x9d, 0x12, 0x9d, 0x12, 0xa2, 0x12,
+  0xa6, 0x12, 0xa9, 0x12, 0xc3, 0x12, 0xc8, 0x12, 0xdc, 0x12, 0xde, 0x12,
+  0xf6, 0x12, 0x00, 0x13, 0x0c, 0x13, 0x13, 0x13, 0x20, 0x13, 0x24, 0x13,
+  0x3d, 0x13, 0x40, 0x13, 0x44, 0x13, 0x46, 0x13, 0x49, 0x13, 0x4f, 0x13,
+  0x72, 0x13, 0x7f, 0x13, 0x87, 0x13, 0x98, 0x13, 0xb7, 0x13, 0xca, 0x13,
+  0xd2, 0x13, 0xe8, 0x13, 0xf1, 0x13, 0xf9, 0x13, 0xfc, 0x13, 0x01, 0x14,
+  0x06, 0x14, 0x12, 0x14, 0x16, 0x14, 0x23, 0x14, 0x3d, 0x14, 0x46, 0x14,
+  0x4d, 0x14, 0x54, 0x14, 0x73, 0x14, 0x80, 0x14, 0x90, 0x14, 0x96, 0x14,
+  0xa7, 0x14, 0xb3, 0x14, 0xce, 0x14, 0xd5, 0x14, 0xdb, 0x14, 0xe0, 0x14,
+  0xe7, 0x14, 0xef, 0x14, 0xfe, 0x14, 0x03, 0x15, 0x0a, 0x15, 0x0e, 0x15,
+  0x12, 0x15, 0x19, 0x15, 0x32, 0x15, 0x36, 0x15, 0x3b, 0x15, 0x43, 0x15,
+  0x58, 0x15, 0x5f, 0x15, 0x65, 0x15, 0x6f, 0x15, 0x7a, 0x15, 0x84, 0x15,
+  0x96, 0x15, 0x9b, 0x15, 0xa7, 0x15, 0xb0, 0x15, 0xb8, 0x15, 0xbd, 0x15,
+  0xd0, 0x15, 0xd8, 0x15, 0xdc, 0x15, 0xea, 0x15, 0xf4, 0x15, 0xfd, 0x15,
+  0x09, 0x16, 0x14, 0x16, 0x30, 0x16, 0x38, 0x16, 0x3e, 0x16, 0x41, 0x16,
+  0x45, 0x16, 0x54, 0x16, 0x56, 0x16, 0x5d, 0x16, 0x5f, 0x16, 0x61, 0x16,
+  0x64, 0x16, 0x6e, 0x16, 0x74, 0x16, 0x76, 0x16, 0x7f, 0x16, 0x8c, 0x16,
+  0x93, 0x16, 0xa1, 0x16, 0xb4, 0x16, 0xbd, 0x16, 0xcb, 0x16, 0xd1, 0x16,
+  0xde, 0x16, 0xf5, 0x16, 0xf9, 0x16, 0xff, 0x16, 0x0e, 0x17, 0x19, 0x17,
+  0x1c, 0x17, 0x1e, 0x17, 0x27, 0x17, 0x2a, 0x17, 0x30, 0x17, 0x3f, 0x17,
+  0x4f, 0x17, 0x53, 0x17, 0x5c, 0x17, 0x6d, 0x17, 0x7e, 0x17, 0x89, 0x17,
+  0x8b, 0x17, 0x8f, 0x17, 0x91, 0x17, 0x97, 0x17, 0x99, 0x17, 0x9b, 0x17,
+  0xa0, 0x17, 0xa8, 0x17, 0xae, 0x17, 0xbd, 0x17, 0xce, 0x17, 0xd3, 0x17,
+  0xde, 0x17, 0xf0, 0x17, 0x06, 0x18, 0x0c, 0x18, 0x12, 0x18, 0x15, 0x18,
+  0x1b, 0x18, 0x21, 0x18, 0x24, 0x18, 0x25, 0x18, 0x2b, 0x18, 0x30, 0x18,
+  0x32, 0x18, 0x3f, 0x18, 0x48, 0x18, 0x4d, 0x18, 0x55, 0x18, 0x64, 0x18,
+  0x6d, 0x18, 0x78, 0x18, 0x81, 0x18, 0x8a, 0x18, 0x8e, 0x18, 0x92, 0x18,
+  0x95, 0x18, 0xaf, 0x18, 0xb8, 0x18, 0xbb, 0x18, 0xbe, 0x18, 0xc1, 0x18,
+  0xc5, 0x18, 0xd6, 0x18, 0xdb, 0x18, 0xe3, 0x18, 0xf5, 0x18, 0x02, 0x19,
+  0x08, 0x19, 0x0e, 0x19, 0x13, 0x19, 0x19, 0x19, 0x1b, 0x19, 0x1e, 0x19,
+  0x1f, 0x19, 0x23, 0x19, 0x28, 0x19, 0x2f, 0x19, 0x35, 0x19, 0x3a, 0x19,
+  0x3b, 0x19, 0x49, 0x19, 0x4e, 0x19, 0x5b, 0x19, 0x5d, 0x19, 0x65, 0x19,
+  0x69, 0x19, 0x73, 0x19, 0x76, 0x19, 0x9a, 0x19, 0x9e, 0x19, 0xb3, 0x19,
+  0xb5, 0x19, 0xbd, 0x19, 0xc5, 0x19, 0xcf, 0x19, 0xda, 0x19, 0xe4, 0x19,
+  0xe7, 0x19, 0x00, 0x1a, 0x07, 0x1a, 0x10, 0x1a, 0x12, 0x1a, 0x1d, 0x1a,
+  0x27, 0x1a, 0x30, 0x1a, 0x41, 0x1a, 0x4a, 0x1a, 0x4f, 0x1a, 0x57, 0x1a,
+  0x58, 0x1a, 0x66, 0x1a, 0x68, 0x1a, 0x74, 0x1a, 0x7f, 0x1a, 0xad, 0x1a,
+  0xaf, 0x1a, 0xbc, 0x1a, 0xc1, 0x1a, 0xcb, 0x1a, 0xcc, 0x1a, 0xe4, 0x1a,
+  0xe8, 0x1a, 0xea, 0x1a, 0xed, 0x1a, 0xf4, 0x1a, 0xfe, 0x1a, 0x0d, 0x1b,
+  0x16, 0x1b, 0x21, 0x1b, 0x2e, 0x1b, 0x5a, 0x1b, 0x63, 0x1b, 0x73, 0x1b,
+  0x7d, 0x1b, 0x83, 0x1b, 0x89, 0x1b, 0x95, 0x1b, 0x9e, 0x1b, 0xa9, 0x1b,
+  0xb2, 0x1b, 0xcb, 0x1b, 0xd0, 0x1b, 0xd7, 0x1b, 0xde, 0x1b, 0xfb, 0x1b,
+  0x09, 0x1c, 0x1a, 0x1c, 0x20, 0x1c, 0x30, 0x1c, 0x36, 0x1c, 0x47, 0x1c,
+  0x4d, 0x1c, 0x71, 0x1c, 0x7e, 0x1c, 0x87, 0x1c, 0x91, 0x1c, 0xa8, 0x1c,
+  0xb3, 0x1c, 0xc1, 0x1c, 0xcb, 0x1c, 0xff, 0x1c, 0x0d, 0x1d, 0x32, 0x1d,
+  0x41, 0x1d, 0x5a, 0x1d, 0x70, 0x1d, 0x89, 0x1d, 0x92, 0x1d, 0x9e, 0x1d,
+  0xab, 0x1d, 0xb8, 0x1d, 0xc3, 0x1d, 0xcf, 0x1d, 0xd6, 0x1d, 0xe3, 0x1d,
+  0xed, 0x1d, 0xf7, 0x1d, 0x0a, 0x1e, 0x1c, 0x1e, 0x35, 0x1e, 0x41, 0x1e,
+  0x52, 0x1e, 0x5f, 0x1e, 0x7d, 0x1e, 0x87, 0x1e, 0x99, 0x1e, 0xa5, 0x1e,
+  0xb1, 0x1e, 0xc1, 0x1e, 0xce, 0x1e, 0xdd, 0x1e, 0xec, 0x1e, 0x0e, 0x1f,
+  0x14, 0x1f, 0x2c, 0x1f, 0x38, 0x1f, 0x50, 0x1f, 0x59, 0x1f, 0x6f, 0x1f,
+  0x79, 0x1f, 0x85, 0x1f, 0x90, 0x1f, 0xa3, 0x1f, 0xae, 0x1f, 0xba, 0x1f,
+  0xc4, 0x1f, 0xcf, 0x1f, 0xdb, 0x1f, 0xe8, 0x1f, 0xf0, 0x1f, 0x0c, 0x20,
+  0x19, 0x20, 0x2c, 0x20, 0x38, 0x20, 0x5b, 0x20, 0x69, 0x20, 0x79, 0x20,
+  0x84, 0x20, 0x8f, 0x20, 0xa3, 0x20, 0xb6, 0x20, 0xc1, 0x20, 0xd0, 0x20,
+  0xe9, 0x20, 0xf3, 0x20, 0xfa, 0x20, 0x07, 0x21, 0x11, 0x21, 0x1e, 0x21,
+  0x2f, 0x21, 0x3b, 0x21, 0x4b, 0x21, 0x5f, 0x21, 0x6a, 0x21, 0x7a, 0x21,
+  0x8f, 0x21, 0x9a, 0x21, 0xa3, 0x21, 0xac, 0x21, 0xb9, 0x21, 0xc3, 0x21,
+  0xcd, 0x21, 0xd5, 0x21, 0xda, 0x21, 0xe6, 0x21, 0xf6, 0x21, 0x01, 0x22,
+  0x0d, 0x22, 0x1b, 0x22, 0x42, 0x22, 0x4e, 0x22, 0x5d, 0x22, 0x6a, 0x22,
+  0x74, 0x22, 0x82, 0x22, 0x8f, 0x22, 0x99, 0x22, 0xab, 0x22, 0xbf, 0x22,
+  0xcb, 0x22, 0xd7, 0x22, 0xde, 0x22, 0xe6, 0x22, 0xee, 0x22, 0x01, 0x23,
+  0x17, 0x23, 0x24, 0x23, 0x3a, 0x23, 0x43, 0x23, 0x4e, 0x23, 0x58, 0x23,
+  0x66, 0x23, 0x6c, 0x23, 0x74, 0x23, 0x78, 0x23, 0x7d, 0x23, 0x89, 0x23,
+  0x92, 0x23, 0x9d, 0x23, 0xa3, 0x23, 0xae, 0x23, 0xe4, 0x23, 0xea, 0x23,
+  0x03, 0x24, 0x14, 0x24, 0x21, 0x24, 0x27, 0x24, 0x33, 0x24, 0x39, 0x24,
+  0x5d, 0x24, 0x67, 0x24, 0x6d, 0x24, 0x7a, 0x24, 0x7e, 0x24, 0x8d, 0x24,
+  0x98, 0x24, 0x9f, 0x24, 0xb6, 0x24, 0xbf, 0x24, 0xcc, 0x24, 0xd1, 0x24,
+  0xd7, 0x24, 0xdb, 0x24, 0xf2, 0x24, 0xf7, 0x24, 0x05, 0x25, 0x0a, 0x25,
+  0x13, 0x25, 0x18, 0x25, 0x23, 0x25, 0x28, 0x25, 0x54, 0x25, 0x5b, 0x25,
+  0x67, 0x25, 0x6d, 0x25, 0x7c, 0x25, 0x89, 0x25, 0x93, 0x25, 0xa2, 0x25,
+  0xbd, 0x25, 0xd4, 0x25, 0xe3, 0x25, 0xf1, 0x25, 0xfc, 0x25, 0x06, 0x26,
+  0x0d, 0x26, 0x13, 0x26, 0x17, 0x26, 0x1a, 0x26, 0x40, 0x26, 0x44, 0x26,
+  0x4a, 0x26, 0x53, 0x26, 0x5e, 0x26, 0x65, 0x26, 0x71, 0x26, 0x80, 0x26,
+  0x8d, 0x26, 0x97, 0x26, 0xaf, 0x26, 0xc1, 0x26, 0xcf, 0x26, 0xd8, 0x26,
+  0xf8, 0x26, 0x05, 0x27, 0x0e, 0x27, 0x1b, 0x27, 0x2e, 0x27, 0x3d, 0x27,
+  0x4c, 0x27, 0x56, 0x27, 0x69, 0x27, 0x7b, 0x27, 0x89, 0x27, 0x93, 0x27,
+  0x9b, 0x27, 0xa9, 0x27, 0xb6, 0x27, 0xbf, 0x27, 0xc5, 0x27, 0xce, 0x27,
+  0xdf, 0x27, 0x11, 0x28, 0x20, 0x28, 0x2b, 0x28, 0x38, 0x28, 0x4a, 0x28,
+  0x53, 0x28, 0x5d, 0x28, 0x6a, 0x28, 0x6f, 0x28, 0x89, 0x28, 0x93, 0x28,
+  0x9b, 0x28, 0xa0, 0x28, 0xb8, 0x28, 0xc2, 0x28, 0xc9, 0x28, 0xfa, 0x28,
+  0x03, 0x29, 0x1f, 0x29, 0x2b, 0x29, 0x38, 0x29, 0x42, 0x29, 0x4a, 0x29,
+  0x54, 0x29, 0x61, 0x29, 0x6d, 0x29, 0x74, 0x29, 0x7f, 0x29, 0x85, 0x29,
+  0x8d, 0x29, 0x95, 0x29, 0xa2, 0x29, 0xa4, 0x29, 0xa5, 0x29, 0xb4, 0x29,
+  0xb8, 0x29, 0xb9, 0x29, 0xc1, 0x29, 0xc6, 0x29, 0xd2, 0x29, 0xd3, 0x29,
+  0xef, 0x29, 0xf4, 0x29, 0xfc, 0x29, 0xff, 0x29, 0x13, 0x2a, 0x18, 0x2a,
+  0x1b, 0x2a, 0x1c, 0x2a, 0x22, 0x2a, 0x3c, 0x2a, 0x41, 0x2a, 0x44, 0x2a,
+  0x4c, 0x2a, 0x50, 0x2a, 0x55, 0x2a, 0x60, 0x2a, 0x69, 0x2a, 0x70, 0x2a,
+  0x7b, 0x2a, 0x83, 0x2a, 0x8c, 0x2a, 0x8e, 0x2a, 0x95, 0x2a, 0x99, 0x2a,
+  0x9a, 0x2a, 0xa9, 0x2a, 0xa9, 0x2a, 0xad, 0x2a, 0xb5, 0x2a, 0xbe, 0x2a,
+  0xc8, 0x2a, 0xd8, 0x2a, 0xdb, 0x2a, 0xe5, 0x2a, 0xef, 0x2a, 0x0a, 0x2b,
+  0x0b, 0x2b, 0x12, 0x2b, 0x14, 0x2b, 0x1c, 0x2b, 0x28, 0x2b, 0x3c, 0x2b,
+  0x46, 0x2b, 0x53, 0x2b, 0x61, 0x2b, 0x6b, 0x2b, 0x74, 0x2b, 0x7a, 0x2b,
+  0x7d, 0x2b, 0x86, 0x2b, 0x95, 0x2b, 0x98, 0x2b, 0x9d, 0x2b, 0xa1, 0x2b,
+  0xaa, 0x2b, 0x00, 0x00, 0x4d, 0x39, 0xe3, 0x8c, 0x02, 0x63, 0x57, 0x33,
+  0x11, 0x09, 0x57, 0x1e, 0xaf, 0x23, 0x31, 0x3e, 0xc6, 0x70, 0x35, 0x0b,
+  0xcd, 0x17, 0x82, 0x4d, 0x1d, 0xb8, 0xd1, 0x19, 0x59, 0x93, 0xc3, 0x2f,
+  0x0c, 0x17, 0xc2, 0x85, 0x56, 0x4d, 0x17, 0x45, 0x17, 0x28, 0xd3, 0x15,
+  0x75, 0xdf, 0xe8, 0x71, 0x02, 0xc3, 0x96, 0xc2, 0x94, 0x73, 0x2a, 0x6e,
+  0x78, 0xf8, 0x26, 0x62, 0x16, 0x7a, 0x8d, 0xdc, 0xc8, 0x1c, 0x0f, 0xfe,
+  0x91, 0x5b, 0xd0, 0xf6, 0x04, 0x72, 0x5f, 0xbe, 0x94, 0x1d, 0x15, 0x1b,
+  0xe5, 0x89, 0x8f, 0xa7, 0x77, 0x5f, 0xe2, 0xc9, 0xe4, 0x46, 0xa9, 0x72,
+  0xa8, 0x44, 0x3a, 0x42, 0x09, 0xa0, 0xe4, 0x19, 0xfc, 0x4d, 0x59, 0x3c,
+  0x02, 0xd4, 0xfd, 0x86, 0x94, 0x77, 0x28, 0x34, 0x2e, 0xb2, 0x5b, 0x16,
+  0x1a, 0xbd, 0xe2, 0x24, 0xf7, 0x64, 0x9d, 0xc9, 0x03, 0x07, 0xf5, 0x2e,
+  0xc1, 0xa1, 0xe2, 0xbb, 0xd1, 0x14, 0x21, 0xcd, 0x90, 0x06, 0x08, 0x01,
+  0x7f, 0xaf, 0x69, 0xe4, 0x7b, 0xfc, 0xca, 0xae, 0xcd, 0xe0, 0xec, 0x3a,
+  0xd2, 0xe8, 0xcd, 0x89, 0x85, 0xaa, 0x0d, 0x67, 0xe8, 0x2e, 0xd2, 0x8f,
+  0xf5, 0xa7, 0x37, 0x77, 0x44, 0x1c, 0x63, 0xf3, 0x24, 0x63, 0xf9, 0x1a,
+  0x3e, 0x7a, 0x21, 0x2e, 0xf0, 0xf3, 0xf2, 0x7d, 0x5e, 0x63, 0x7d, 0x50,
+  0x16, 0xda, 0xf7, 0xa2, 0x96, 0x65, 0x1f, 0x74, 0x5b, 0x12, 0x08, 0x90,
+  0xc6, 0x2c, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x4f, 0x08, 0xee, 0x7f, 0xdc,
+  0x64, 0x09, 0x3c, 0xe0, 0x84, 0x0f, 0x95, 0x5a, 0x41, 0xaf, 0x3d, 0x39,
+  0xa0, 0x22, 0xe3, 0x40, 0x68, 0x00, 0x0b, 0x36, 0x94, 0xcf, 0x68, 0x4b,
+  0x78, 0xc3, 0xa8, 0x54, 0xc5, 0xcc, 0xe2, 0xf2, 0xea, 0xd8, 0xc6, 0x94,
+  0x68, 0x95, 0xb2, 0xfa, 0x7c, 0x5e, 0x1d, 0xd2, 0x60, 0x82, 0x26, 0xfe,
+  0xf4, 0x1e, 0xfd, 0xfe, 0x53, 0x8d, 0x00, 0x25, 0x42, 0x36, 0x27, 0xc1,
+  0xc7, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0x67, 0x69, 0x4c, 0x94, 0x39, 0x86,
+  0x33, 0xb7, 0x59, 0x18, 0x66, 0xe2, 0xdb, 0x34, 0x3c, 0x2f, 0xa2, 0x83,
+  0x59, 0xc9, 0xfd, 0x8d, 0x3c, 0x53, 0x2e, 0x95, 0x07, 0x7e, 0xe7, 0x99,
+  0x30, 0x16, 0x2e, 0x00, 0xca, 0x9a, 0xc1, 0x6d, 0xe8, 0xbf, 0xb6, 0x69,
+  0x2d, 0x7f, 0xf7, 0x33, 0xf4, 0x34, 0x3d, 0x71, 0x29, 0xb3, 0xb0, 0x75,
+  0x2c, 0xa4, 0x6b, 0xe1, 0x84, 0x6e, 0x8b, 0xf0, 0xe0, 0xcd, 0x6a, 0x4b,
+  0x8a, 0xd7, 0x15, 0x6f, 0xa5, 0xe4, 0x37, 0x53, 0x9b, 0xd3, 0x46, 0x5b,
+  0x59, 0x66, 0x0b, 0xea, 0x4f, 0xe9, 0x03, 0x1d, 0x04, 0x06, 0x6d, 0xdb,
+  0x10, 0x2a, 0x6c, 0x19, 0x96, 0xe9, 0xd7, 0x67, 0x4c, 0xcf, 0xa8, 0xfc,
+  0x75, 0x47, 0xe0, 0xf3, 0x40, 0xb3, 0x90, 0x77, 0x1a, 0x1e, 0xff, 0x09,
+  0x53, 0x02, 0x43, 0x64, 0x62, 0xe5, 0x25, 0xc4, 0xc4, 0xc4, 0x42, 0x65,
+  0x00, 0x08, 0xbf, 0x46, 0xe3, 0xb4, 0x25, 0x3c, 0xef, 0xae, 0x0c, 0xbc,
+  0xc1, 0xf2, 0x58, 0xaf, 0x9a, 0x8b, 0x7b, 0x64, 0x5a, 0x8d, 0xe2, 0x07,
+  0xd3, 0xad, 0xd8, 0x4f, 0x0d, 0x78, 0x6c, 0x2b, 0xff, 0x74, 0x13, 0x5b,
+  0xad, 0xca, 0x3d, 0x1d, 0xfd, 0x14, 0xec, 0xe2, 0x30, 0x8e, 0x51, 0xb5,
+  0x3e, 0x65, 0xbe, 0x58, 0x56, 0x68, 0x00, 0xb8, 0xee, 0x6c, 0xc6, 0xd0,
+  0x33, 0xff, 0x93, 0x31, 0x91, 0x91, 0x91, 0xab, 0x45, 0xb5, 0x0b, 0x4c,
+  0x77, 0xa9, 0x04, 0xa7, 0xa8, 0x8f, 0xc9, 0x57, 0xf7, 0x1d, 0x74, 0x8b,
+  0x84, 0x0a, 0xa6, 0xd5, 0x83, 0xff, 0xb4, 0x85, 0x45, 0xf2, 0x29, 0xf8,
+  0x27, 0x09, 0xe3, 0xa1, 0x44, 0xc4, 0xd4, 0x2a, 0xe4, 0xa1, 0x41, 0x9b,
+  0xd4, 0x60, 0xec, 0x5c, 0x7e, 0x24, 0x28, 0x55, 0x78, 0xe3, 0x49, 0xb4,
+  0x6c, 0x89, 0xd5, 0x65, 0xe0, 0x49, 0x74, 0xaf, 0x7b, 0x8d, 0xd3, 0xa8,
+  0x2c, 0x20, 0xa8, 0xe3, 0xa5, 0x8a, 0x85, 0x9a, 0x7f, 0xa5, 0x4c, 0x67,
+  0x28, 0x7e, 0x3e, 0x87, 0xd0, 0x91, 0xae, 0x42, 0x4f, 0xfc, 0x1b, 0x87,
+  0xda, 0x25, 0xbe, 0x35, 0xa7, 0x19, 0xfd, 0xf0, 0x6d, 0x74, 0x41, 0xcc,
+  0xb5, 0x0b, 0x49, 0xcc, 0x90, 0xdc, 0x14, 0x14, 0x27, 0xd4, 0xfc, 0x09,
+  0x3b, 0x46, 0x39, 0xb2, 0xf5, 0x47, 0xb6, 0xb8, 0xc7, 0xa8, 0xc4, 0x03,
+  0xa5, 0x36, 0xf7, 0x16, 0xe3, 0xc9, 0x31, 0x2b, 0x68, 0xcf, 0x55, 0xbd,
+  0x95, 0xac, 0xa7, 0xf5, 0xc9, 0xcc, 0x4c, 0xe6, 0xc6, 0xff, 0x7c, 0xa5,
+  0x3f, 0xfa, 0xb8, 0xc6, 0xe2, 0x05, 0x06, 0xfe, 0xa7, 0xe3, 0x22, 0x68,
+  0xe9, 0x29, 0xdb, 0x74, 0x8e, 0xb5, 0x8d, 0x4c, 0xfe, 0xaa, 0xb4, 0x85,
+  0xa8, 0x17, 0x99, 0xba, 0xa2, 0x4f, 0xdc, 0xab, 0x40, 0x03, 0xdc, 0x90,
+  0xce, 0x58, 0x5d, 0xce, 0x8e, 0xb4, 0x04, 0x30, 0x30, 0x71, 0x68, 0x09,
+  0x9f, 0x90, 0x3c, 0x79, 0xd5, 0x7f, 0xa2, 0x51, 0xbe, 0x5e, 0xda, 0x3e,
+  0x58, 0xa8, 0x9e, 0x66, 0xd5, 0xe1, 0xa6, 0x86, 0xea, 0x7e, 0x47, 0xf2,
+  0x40, 0xb2, 0x6e, 0xa6, 0xfd, 0x97, 0x9f, 0x57, 0x26, 0xb9, 0x06, 0xcd,
+  0x8f, 0x21, 0x8e, 0x00, 0x48, 0xcb, 0xec, 0x67, 0xa4, 0x3a, 0x87, 0x7c,
+  0x34, 0x0e, 0xc9, 0x04, 0x2a, 0x76, 0x84, 0x80, 0xd3, 0xe7, 0x1c, 0xa5,
+  0xf9, 0x85, 0xf9, 0xcd, 0x31, 0x98, 0x0f, 0x0f, 0xee, 0x43, 0x90, 0x11,
+  0x63, 0x76, 0xd5, 0x03, 0xb3, 0x45, 0x0e, 0x8e, 0x66, 0xc2, 0xb6, 0x70,
+  0xf1, 0xd7, 0x97, 0xf3, 0x9d, 0xc6, 0x9e, 0x85, 0x3d, 0xb6, 0xf3, 0x21,
+  0x7b, 0xfc, 0xa0, 0xf3, 0xa5, 0x62, 0x8a, 0x91, 0x2f, 0xad, 0xe7, 0xad,
+  0x3a, 0x67, 0x05, 0xfe, 0x37, 0x1f, 0xc7, 0x17, 0xb3, 0x2a, 0xee, 0x52,
+  0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x2a, 0x90, 0x5c, 0xec, 0x23, 0x69, 0x3d,
+  0x9a, 0xad, 0xb8, 0xa5, 0x89, 0xb3, 0xd6, 0x07, 0xa9, 0xfb, 0xf0, 0xdc,
+  0x08, 0x9b, 0x19, 0x85, 0xa3, 0x4d, 0x47, 0xfa, 0xd9, 0x48, 0x9a, 0xa1,
+  0xde, 0xe3, 0xe4, 0x05, 0x54, 0x5f, 0x01, 0x45, 0x23, 0x35, 0xa8, 0x1e,
+  0xc7, 0x76, 0xc0, 0x40, 0x8c, 0xee, 0x6a, 0x31, 0x06, 0xdb, 0x87, 0x53,
+  0xf3, 0x4d, 0x5a, 0x1e, 0xa6, 0x2e, 0x6c, 0x78, 0x3a, 0x95, 0x8f, 0xa6,
+  0x06, 0x1d, 0x1e, 0x17, 0x69, 0x7c, 0xe9, 0x70, 0x27, 0x22, 0x21, 0xe6,
+  0xeb, 0x02, 0x26, 0xc2, 0xdc, 0x50, 0x8c, 0x11, 0xf4, 0xd1, 0x13, 0xb6,
+  0x15, 0xb0, 0xc5, 0x89, 0xa6, 0x4f, 0x23, 0xae, 0x4e, 0x92, 0x06, 0xd5,
+  0x92, 0xc7, 0xeb, 0x9e, 0x6a, 0xe1, 0xf0, 0x8d, 0xb5, 0x82, 0x6e, 0x59,
+  0x03, 0x39, 0xcd, 0xa7, 0xf2, 0x6d, 0xe0, 0x82, 0x91, 0x68, 0x9b, 0x46,
+  0xe0, 0x9a, 0x07, 0x3b, 0x10, 0x8f, 0x3b, 0xd3, 0xcd, 0xf5, 0xaf, 0x14,
+  0x01, 0xa1, 0xe6, 0xfa, 0x55, 0x13, 0x2f, 0x21, 0xc1, 0x12, 0x4a, 0x2d,
+  0x85, 0x7d, 0x41, 0x51, 0x33, 0x59, 0x87, 0x1e, 0xe1, 0x66, 0xd6, 0x50,
+  0xd3, 0xad, 0x33, 0x4c, 0x28, 0xdb, 0x22, 0xfe, 0x87, 0x04, 0x5a, 0xd0,
+  0xa5, 0xe4, 0xf6, 0x08, 0x03, 0x50, 0xef, 0x6a, 0xa0, 0xb8, 0xb2, 0xbc,
+  0x33, 0xdf, 0xd7, 0xe8, 0xa1, 0x6a, 0x28, 0x1d, 0xa5, 0xa2, 0xf6, 0x88,
+  0xb9, 0xf3, 0x26, 0xcf, 0x04, 0x64, 0x0d, 0x26, 0x3b, 0xfe, 0x9a, 0x54,
+  0x16, 0xf1, 0xaf, 0x23, 0x47, 0x37, 0xd3, 0x44, 0x72, 0x37, 0x82, 0x6c,
+  0x10, 0xc0, 0xb3, 0x4f, 0x2f, 0x5b, 0x31, 0xb3, 0xe5, 0x74, 0xff, 0xde,
+  0xef, 0xac, 0x58, 0xbe, 0xcf, 0x11, 0x1d, 0x9e, 0xb4, 0x68, 0xc8, 0x80,
+  0xe8, 0xa4, 0xc6, 0x48, 0xbc, 0xf7, 0x53, 0x17, 0x8d, 0xc4, 0x93, 0x7f,
+  0x9d, 0xf0, 0xa8, 0x74, 0x0c, 0xe1, 0x6c, 0x2a, 0xa3, 0x6f, 0x37, 0x30,
+  0x9c, 0x17, 0xfb, 0x80, 0x58, 0x3b, 0xae, 0x87, 0x93, 0x25, 0xd0, 0x78,
+  0x13, 0x65, 0xbf, 0x26, 0x3d, 0x63, 0xb4, 0x4e, 0xa5, 0x4d, 0xbe, 0xb3,
+  0x63, 0x19, 0x9f, 0xc2, 0x6c, 0x65, 0x6f, 0x72, 0x1b, 0xd6, 0x53, 0x8f,
+  0x5a, 0x91, 0xa2, 0x01, 0x9a, 0xfd, 0x83, 0x1a, 0x0b, 0x79, 0xb4, 0x66,
+  0x9d, 0xd1, 0x4c, 0x5f, 0x29, 0x0e, 0xbd, 0xde, 0x99, 0xb5, 0x67, 0x2b,
+  0x2b, 0x30, 0xb3, 0xf9, 0x6f, 0x34, 0x81, 0xd6, 0x5a, 0xe4, 0xa8, 0x8b,
+  0xcd, 0x49, 0xa1, 0xda, 0x13, 0x08, 0x3a, 0xe3, 0xd4, 0x6b, 0xe8, 0x75,
+  0xb0, 0x00, 0x9b, 0xe8, 0x1e, 0x76, 0x00, 0x43, 0x2b, 0xc6, 0x56, 0xea,
+  0x9b, 0x51, 0x6c, 0x7f, 0xff, 0x35, 0xd1, 0xd2, 0xae, 0x45, 0xa5, 0xf5,
+  0x61, 0x61, 0xfb, 0x40, 0xfd, 0x94, 0x29, 0x77, 0x9f, 0x95, 0x8c, 0xcb,
+  0x89, 0xa1, 0x49, 0x1d, 0x83, 0x21, 0x88, 0xa5, 0xe7, 0x7a, 0x2c, 0x84,
+  0xde, 0x0a, 0x1a, 0x58, 0x53, 0x0a, 0xf7, 0xff, 0xd7, 0xee, 0x57, 0x2d,
+  0xf6, 0x52, 0xd2, 0x19, 0x6f, 0xd8, 0x43, 0xd8, 0x20, 0x3d, 0x20, 0x39,
+  0x16, 0xcf, 0x25, 0xef, 0xdf, 0xc4, 0xa6, 0x35, 0x37, 0x88, 0x25, 0x62,
+  0x2c, 0x08, 0xda, 0xd4, 0x8e, 0x1b, 0x20, 0xd6, 0x9b, 0x8d, 0x46, 0x83,
+  0x1f, 0xef, 0x39, 0xc7, 0x1b, 0xf5, 0x2c, 0xc7, 0x99, 0xd0, 0x08, 0xde,
+  0xb6, 0x1e, 0xa8, 0x94, 0xa9, 0xe7, 0xdc, 0x1d, 0x90, 0xff, 0x25, 0x80,
+  0x93, 0x48, 0xdc, 0xf1, 0x99, 0xdd, 0xf7, 0x15, 0x36, 0x4c, 0xea, 0x98,
+  0x9f, 0x9d, 0x44, 0xb0, 0xdd, 0x15, 0xfb, 0xcf, 0x41, 0xd4, 0x96, 0x44,
+  0x7d, 0xe3, 0xf5, 0xe5, 0x22, 0x09, 0x86, 0xd4, 0x8b, 0x0d, 0xde, 0x74,
+  0xbf, 0x79, 0x40, 0x87, 0x41, 0x62, 0x1a, 0x43, 0x27, 0xfc, 0x05, 0xa5,
+  0x81, 0x6f, 0xaf, 0x33, 0xc0, 0xc5, 0x6a, 0xb3, 0xc0, 0xc8, 0xce, 0x6d,
+  0x03, 0x4a, 0xa3, 0xd6, 0x4d, 0xa4, 0x0d, 0xb6, 0xeb, 0xe6, 0xb0, 0xc8,
+  0xfe, 0x49, 0x37, 0x3a, 0xb8, 0xa4, 0x8a, 0xf2, 0x05, 0x3b, 0x96, 0xfc,
+  0xdf, 0x8e, 0x6a, 0x2c, 0x64, 0xa6, 0xc4, 0xc8, 0xc2, 0x41, 0xb0, 0x2e,
+  0x7f, 0x00, 0x12, 0xb3, 0xb7, 0x8b, 0x43, 0x8e, 0x99, 0x32, 0x88, 0x69,
+  0x27, 0x38, 0xf5, 0x13, 0x7d, 0xe4, 0x44, 0x9f, 0xa1, 0xd2, 0x32, 0x7a,
+  0x01, 0x46, 0x5d, 0xf5, 0x80, 0x32, 0x11, 0x80, 0x17, 0xbd, 0xd2, 0xc0,
+  0xbe, 0x89, 0x0f, 0x68, 0x10, 0x43, 0xe9, 0x2a, 0xbd, 0xc7, 0x81, 0x49,
+  0xd5, 0x32, 0x1d, 0x6e, 0x3b, 0xfd, 0x8d, 0xd9, 0xbf, 0x1b, 0xca, 0xb3,
+  0x10, 0xa7, 0x7d, 0xf7, 0x1d, 0x90, 0x19, 0xa1, 0xe1, 0xc6, 0x7d, 0x1c,
+  0x96, 0xa4, 0x21, 0x49, 0xed, 0x8e, 0x3b, 0x69, 0x1f, 0x52, 0xf3, 0xbc,
+  0xf4, 0xee, 0xd8, 0xd7, 0xcd, 0x73, 0x47, 0xf2, 0xa1, 0xb9, 0xfb, 0x14,
+  0x8c, 0xe6, 0x70, 0x60, 0xb4, 0x8f, 0xbb, 0xdf, 0xe3, 0x72, 0x76, 0xd1,
+  0x88, 0x4a, 0x10, 0x38, 0x5a, 0x9b, 0xbe, 0xbb, 0x88, 0x08, 0xd0, 0x9a,
+  0x32, 0x60, 0xac, 0xeb, 0xac, 0x36, 0x8b, 0xab, 0x22, 0x9e, 0xab, 0x71,
+  0xdf, 0xb7, 0x5e, 0x1e, 0xbe, 0x63, 0x9a, 0x74, 0xc3, 0x91, 0xb0, 0x44,
+  0x0f, 0xbf, 0x8b, 0x84, 0xab, 0xc8, 0x57, 0x24, 0xe0, 0x14, 0x05, 0xdf,
+  0x65, 0x79, 0x02, 0xbd, 0x23, 0x8b, 0x12, 0x89, 0xbe, 0x09, 0xcc, 0xb3,
+  0x13, 0x0f, 0x96, 0xcb, 0x57, 0x27, 0x3b, 0x8d, 0x79, 0x88, 0x9e, 0xf2,
+  0xed, 0xd8, 0xe4, 0xac, 0x22, 0x74, 0xd3, 0xe3, 0x9b, 0xbf, 0xc4, 0x12,
+  0xff, 0xe2, 0xbd, 0xe1, 0xbc, 0x11, 0x84, 0xa6, 0xd3, 0xc5, 0xbd, 0x91,
+  0x48, 0xca, 0x8d, 0xcb, 0x0c, 0x81, 0x9b, 0xef, 0x58, 0x30, 0x24, 0x34,
+  0x56, 0xf3, 0x91, 0x26, 0x7d, 0xce, 0x6e, 0xe6, 0x87, 0xee, 0x24, 0x09,
+  0xd5, 0xbe, 0x0a, 0x51, 0xe9, 0xc8, 0xb8, 0xc8, 0x9e, 0x83, 0xc1, 0x9a,
+  0x49, 0x9c, 0x8a, 0xb3, 0xc9, 0xaf, 0x17, 0x57, 0x32, 0xfe, 0x72, 0xbf,
+  0x5f, 0xec, 0x40, 0xaf, 0x62, 0x1a, 0xdb, 0x61, 0xf2, 0x58, 0x1e, 0x7b,
+  0x25, 0xa0, 0x8b, 0xb7, 0x7a, 0x2c, 0xe1, 0xaa, 0xb4, 0x11, 0x6f, 0x80,
+  0xb3, 0x86, 0x31, 0xeb, 0x0c, 0x83, 0x8d, 0xd5, 0x35, 0x18, 0xf9, 0xd2,
+  0xe5, 0xfa, 0x77, 0x94, 0xd8, 0xbe, 0x02, 0x50, 0xba, 0x58, 0x75, 0x5a,
+  0xf9, 0x4b, 0xd7, 0x9d, 0x95, 0xb7, 0xca, 0xe4, 0x81, 0x87, 0x95, 0x16,
+  0x2e, 0xad, 0x49, 0x6e, 0x07, 0x0a, 0x79, 0x63, 0x29, 0x4d, 0xa3, 0x97,
+  0xd0, 0x7d, 0xff, 0xff, 0x90, 0xec, 0xaf, 0xbe, 0xb0, 0x62, 0x81, 0xc9,
+  0xae, 0xe8, 0x8b, 0x6c, 0x95, 0x3d, 0x4b, 0x6e, 0x3b, 0x10, 0xbb, 0x48,
+  0xea, 0xbf, 0xa2, 0x8b, 0x06, 0x2c, 0xf7, 0x08, 0x5d, 0x49, 0xbe, 0x43,
+  0x09, 0x54, 0x8d, 0x4b, 0x40, 0x0a, 0xfc, 0x9d, 0xd0, 0x3b, 0x37, 0x98,
+  0xbe, 0x72, 0xb1, 0xd5, 0xb8, 0xea, 0x62, 0x0d, 0x63, 0x0f, 0x4f, 0xfb,
+  0x95, 0xa1, 0xb6, 0x74, 0x5d, 0x25, 0xac, 0xf8, 0xcb, 0x0c, 0xfb, 0x9a,
+  0xfd, 0x04, 0x92, 0xf7, 0x90, 0xd2, 0xc4, 0x89, 0x61, 0xe6, 0xbf, 0x13,
+  0x35, 0x27, 0x99, 0x91, 0xeb, 0x63, 0x79, 0x81, 0xb2, 0x23, 0x8c, 0xfa,
+  0x50, 0x54, 0xfe, 0xf2, 0x74, 0x14, 0x99, 0xfa, 0x31, 0x92, 0x0d, 0xce,
+  0xaa, 0x6e, 0xbb, 0x6b, 0x41, 0xb7, 0x5f, 0x53, 0xf6, 0x65, 0xff, 0x3a,
+  0x06, 0xa2, 0x93, 0xe8, 0x59, 0xa7, 0xeb, 0x39, 0xce, 0xbc, 0xbd, 0x89,
+  0xa7, 0xf0, 0x41, 0x87, 0x41, 0xbf, 0x45, 0x5a, 0x50, 0x98, 0x7b, 0x4f,
+  0xe9, 0x53, 0x69, 0x24, 0x64, 0xe3, 0x3b, 0x27, 0xba, 0x26, 0xbf, 0xd9,
+  0x20, 0x17, 0x22, 0x3c, 0x9d, 0x78, 0xe9, 0x8e, 0x30, 0xbd, 0x28, 0x25,
+  0x23, 0x36, 0xea, 0xcd, 0x55, 0xda, 0x94, 0xcf, 0x35, 0xaa, 0x7f, 0x07,
+  0xf5, 0xb3, 0xe9, 0xf9, 0x71, 0x93, 0xfa, 0x0f, 0x8a, 0x14, 0x1c, 0xe5,
+  0x58, 0xd7, 0x37, 0x8b, 0xe8, 0xf0, 0x6b, 0x51, 0x10, 0x50, 0xea, 0xfa,
+  0x8c, 0xad, 0x57, 0x5c, 0xde, 0x11, 0x63, 0xb5, 0xcf, 0x54, 0xef, 0x87,
+  0x26, 0x74, 0xa6, 0xd4, 0x83, 0xd3, 0x00, 0xd8, 0xac, 0x17, 0x7d, 0x29,
+  0x9e, 0x55, 0x46, 0x31, 0xca, 0xe0, 0xe5, 0x69, 0xc0, 0x2b, 0x45, 0xff,
+  0x90, 0x89, 0x42, 0x79, 0x14, 0x10, 0xc7, 0x29, 0x31, 0x9f, 0x8a, 0x86,
+  0x30, 0xf8, 0x54, 0x28, 0x6b, 0xd2, 0x4f, 0xec, 0x9c, 0xc0, 0x49, 0xa0,
+  0x9c, 0x44, 0x8a, 0x8f, 0xa6, 0xe4, 0x38, 0x4d, 0xbe, 0x41, 0x15, 0xb9,
+  0x51, 0xb8, 0xa7, 0xa8, 0xf2, 0xcf, 0xab, 0x50, 0xd2, 0xa4, 0x7b, 0x6a,
+  0x04, 0xbd, 0x94, 0x43, 0x91, 0xdd, 0x44, 0x34, 0x16, 0xc4, 0xd4, 0x95,
+  0x60, 0x1b, 0x1d, 0x6e, 0xa4, 0x83, 0x60, 0xc9, 0x4b, 0x37, 0xaa, 0x0c,
+  0xb2, 0xe9, 0x7c, 0x83, 0x96, 0x4e, 0x3d, 0x47, 0xd8, 0x9d, 0xeb, 0xdd,
+  0xbf, 0x6d, 0x6f, 0xdd, 0xda, 0xea, 0x2c, 0x30, 0xac, 0x2d, 0xd1, 0xf5,
+  0xf5, 0xee, 0xa5, 0x7d, 0xb9, 0xc5, 0x11, 0x9d, 0xbb, 0x6e, 0xde, 0xbd,
+  0xc7, 0x83, 0x97, 0x35, 0xb1, 0x1f, 0x06, 0x1c, 0xf1, 0x92, 0x8c, 0xc7,
+  0xaa, 0xee, 0x4c, 0xe9, 0x19, 0x6d, 0x8b, 0x82, 0x4e, 0x44, 0x7a, 0x7d,
+  0xbe, 0x79, 0x44, 0x6f, 0xee, 0x6c, 0x6e, 0x3c, 0x01, 0x9f, 0xd0, 0x41,
+  0xfe, 0x64, 0xcd, 0x21, 0x6a, 0xea, 0xfc, 0x63, 0xfe, 0xdf, 0x49, 0x69,
+  0x77, 0xc5, 0x23, 0x6e, 0x5e, 0x3f, 0x05, 0x02, 0x16, 0xe7, 0x0c, 0xd3,
+  0x22, 0x32, 0x28, 0x2a, 0x3c, 0x7d, 0xce, 0x6b, 0xe8, 0x89, 0x68, 0x15,
+  0x5b, 0xf0, 0x7c, 0x6c, 0x80, 0x1a, 0xac, 0x98, 0xb2, 0x9f, 0xa1, 0xcd,
+  0x4a, 0x62, 0x11, 0xff, 0x07, 0xd9, 0x9e, 0x64, 0x1c, 0x0c, 0x20, 0x52,
+  0x80, 0xd6, 0x9e, 0x77, 0x4f, 0x34, 0x33, 0xf2, 0xd4, 0xb2, 0xd9, 0xb4,
+  0xb2, 0x41, 0xb6, 0x07, 0xb8, 0xcf, 0x08, 0xad, 0x81, 0x41, 0xd4, 0x1b,
+  0x5f, 0x68, 0x4e, 0xb3, 0xec, 0xfb, 0x7e, 0x30, 0xc8, 0xe5, 0x33, 0x60,
+  0x8a, 0x9b, 0x79, 0x55, 0x95, 0x6f, 0xb6, 0xda, 0x69, 0xfe, 0x08, 0x02,
+  0x6f, 0xa7, 0xa7, 0x7d, 0x4e, 0xe7, 0x54, 0x95, 0xf0, 0x59, 0x04, 0x7a,
+  0x9e, 0x4b, 0xdd, 0x1e, 0xfb, 0xd5, 0x21, 0xf8, 0x03, 0x37, 0xe1, 0x37,
+  0xd1, 0xea, 0xe1, 0xe2, 0x63, 0x5a, 0x72, 0x7e, 0xc7, 0x47, 0x3e, 0x11,
+  0x7c, 0x58, 0x54, 0x50, 0xdb, 0xdd, 0x70, 0x4c, 0x95, 0x1b, 0xb5, 0xc0,
+  0x65, 0x0e, 0xd9, 0xd9, 0x70, 0x4f, 0x7a, 0x95, 0x15, 0x1d, 0xaa, 0x64,
+  0xa0, 0x65, 0x4a, 0xce, 0x9e, 0x17, 0xb5, 0x37, 0xfa, 0x74, 0xaf, 0x8e,
+  0xe4, 0xf4, 0xe1, 0xf3, 0x0a, 0x88, 0x2d, 0x5e, 0xe3, 0x35, 0xf0, 0xae,
+  0x70, 0x89, 0xff, 0xf2, 0xcc, 0x52, 0x01, 0xba, 0xae, 0xe0, 0x46, 0x9f,
+  0x18, 0xb9, 0x06, 0xca, 0x92, 0x20, 0x93, 0xe1, 0xce, 0x79, 0x79, 0x79,
+  0xaa, 0x2f, 0x8c, 0x59, 0x3e, 0xa7, 0x97, 0x70, 0x34, 0xa1, 0x28, 0xa4,
+  0x82, 0x27, 0x8e, 0xd4, 0xcc, 0xab, 0x43, 0x59, 0x23, 0x3a, 0x68, 0xbd,
+  0xe0, 0xd5, 0x2f, 0x90, 0x45, 0xe4, 0xe7, 0x80, 0xb6, 0xe3, 0xdb, 0x47,
+  0x96, 0xb7, 0xec, 0x4c, 0x5f, 0x6e, 0x6f, 0x62, 0xf1, 0xc6, 0x8a, 0x8d,
+  0x0a, 0xc1, 0xbc, 0x1b, 0x21, 0x31, 0xf5, 0x90, 0xf9, 0x55, 0xa4, 0x34,
+  0x4f, 0x42, 0xd6, 0x6c, 0xab, 0x80, 0x7a, 0x57, 0x17, 0xf4, 0x47, 0x10,
+  0x9a, 0xf4, 0xc9, 0x43, 0x78, 0x77, 0x5e, 0x55, 0xe8, 0x21, 0x4f, 0x1b,
+  0x8c, 0xb0, 0x17, 0x95, 0xad, 0x0d, 0x17, 0xfa, 0x78, 0xb1, 0x75, 0x8b,
+  0xf6, 0xcc, 0x5d, 0x83, 0x7e, 0x7f, 0xb4, 0x45, 0x97, 0x35, 0x07, 0x1c,
+  0x07, 0x0b, 0x07, 0x22, 0x93, 0x4c, 0x29, 0x9f, 0x66, 0xdd, 0x30, 0x2d,
+  0x66, 0x2a, 0x21, 0x9f, 0x2a, 0x11, 0x9d, 0x0a, 0x1c, 0x7d, 0xd9, 0xc1,
+  0x1a, 0x4c, 0x4c, 0x5a, 0x63, 0xb6, 0xaf, 0xc7, 0x08, 0x99, 0xe5, 0xae,
+  0x86, 0xb4, 0x8a, 0x00, 0xf6, 0x32, 0x2a, 0x57, 0x71, 0xf4, 0x26, 0x22,
+  0x91, 0xd6, 0xfa, 0x19, 0xb1, 0x6b, 0xce, 0x5c, 0xf7, 0xf1, 0x32, 0x66,
+  0x3a, 0x4e, 0x48, 0x9a, 0xac, 0x9b, 0xc6, 0xfd, 0xe8, 0xfc, 0xcd, 0x23,
+  0xa2, 0xa7, 0xd0, 0x00, 0x5f, 0xfb, 0x30, 0xa0, 0xa2, 0xcb, 0x30, 0x97,
+  0xa2, 0xb3, 0x93, 0xa6, 0x5a, 0x33, 0xcb, 0x6c, 0x20, 0x76, 0xcd, 0x33,
+  0xbd, 0xb3, 0xd4, 0x6a, 0xb7, 0x90, 0xfe, 0xaa, 0xad, 0xb7, 0xc9, 0xaf,
+  0x62, 0xef, 0xfd, 0x27, 0x44, 0x70, 0xf2, 0x9b, 0xd1, 0x63, 0xd4, 0x01,
+  0x39, 0xe7, 0x12, 0x2a, 0x45, 0x22, 0x2f, 0x4b, 0x39, 0xb3, 0xfe, 0x0c,
+  0xcc, 0xd5, 0xd9, 0x12, 0x11, 0x77, 0xd0, 0x33, 0xee, 0x7f, 0x82, 0x23,
+  0xae, 0x7f, 0x74, 0xfa, 0x19, 0x09, 0xcd, 0x67, 0x98, 0x6d, 0x7e, 0x0e,
+  0x28, 0xc9, 0xc9, 0xa8, 0xc9, 0x6f, 0x01, 0x80, 0xbd, 0x50, 0x95, 0x1c,
+  0x98, 0xb2, 0xf1, 0xab, 0xeb, 0x4f, 0x27, 0x78, 0xe5, 0xa1, 0xdd, 0x5d,
+  0x49, 0xd4, 0xe1, 0x3a, 0xf1, 0x8f, 0x27, 0x6a, 0xb1, 0x9a, 0x87, 0xb0,
+  0x2f, 0x3c, 0xad, 0x92, 0xec, 0x32, 0x69, 0xa6, 0x62, 0x26, 0x8b, 0x94,
+  0x64, 0xfd, 0xa3, 0xf5, 0x39, 0x83, 0xc1, 0x99, 0x63, 0xf9, 0xc9, 0xef,
+  0x34, 0x6e, 0x9e, 0x0c, 0xce, 0x75, 0x0e, 0x09, 0x8a, 0x9e, 0xd7, 0x24,
+  0x79, 0xe8, 0x0e, 0xac, 0xca, 0x6c, 0xb2, 0x52, 0xce, 0xbf, 0x5f, 0x09,
+  0x24, 0x0c, 0xf5, 0x90, 0x8c, 0x5b, 0x1d, 0xd0, 0x77, 0x2a, 0x67, 0xdd,
+  0x28, 0xcc, 0x99, 0x90, 0x60, 0xed, 0x44, 0x43, 0x6a, 0xc0, 0xce, 0xa2,
+  0x66, 0x24, 0x2f, 0xfa, 0xea, 0xc0, 0x62, 0x77, 0xa7, 0x65, 0x82, 0x77,
+  0x3e, 0x9b, 0x56, 0x81, 0xdf, 0x39, 0xed, 0xa7, 0xb0, 0x00, 0x9c, 0x91,
+  0xf9, 0x06, 0x69, 0x24, 0x2d, 0x51, 0x71, 0x38, 0x86, 0xc7, 0xb7, 0x49,
+  0xda, 0x8a, 0x6c, 0x99, 0xe5, 0x4c, 0xe5, 0x84, 0x9c, 0xe8, 0x66, 0x02,
+  0x98, 0xef, 0x56, 0xd5, 0x43, 0xf3, 0x53, 0xc0, 0x63, 0x8a, 0x9d, 0xd2,
+  0x73, 0x9c, 0xbc, 0x1c, 0xc3, 0xda, 0xf4, 0xf0, 0x5d, 0xe0, 0xb0, 0x63,
+  0x17, 0x52, 0xbd, 0x4f, 0x8c, 0xa7, 0x47, 0xc8, 0x3b, 0x3e, 0xef, 0xad,
+  0x60, 0xb5, 0xff, 0xc4, 0x35, 0x5e, 0x1c, 0x7d, 0x16, 0xae, 0x0c, 0xa3,
+  0x88, 0xd9, 0xec, 0x68, 0x08, 0xe5, 0xb9, 0x13, 0xca, 0x5a, 0x38, 0x22,
+  0x73, 0x59, 0xf2, 0xc4, 0xaa, 0x39, 0x4b, 0x85, 0xaf, 0x72, 0x1f, 0xf9,
+  0xb6, 0x5a, 0x05, 0x57, 0x9c, 0x26, 0xd5, 0xf4, 0x51, 0x81, 0x25, 0x6b,
+  0x3d, 0x74, 0x66, 0xb1, 0xe8, 0x80, 0xb1, 0x52, 0xad, 0xfa, 0x35, 0x7d,
+  0x59, 0x4a, 0xb0, 0x89, 0x5a, 0xcd, 0x5b, 0x4a, 0xd2, 0xde, 0xdd, 0xd3,
+  0x39, 0x36, 0x28, 0xdc, 0x62, 0xff, 0xc5, 0x06, 0x3c, 0xdc, 0x16, 0x58,
+  0xd5, 0x4d, 0x3f, 0xa9, 0xf1, 0xf6, 0xa6, 0x6c, 0x66, 0x82, 0xa0, 0x3f,
+  0x92, 0xe5, 0xa6, 0x34, 0xeb, 0xae, 0x8d, 0x72, 0x50, 0x5b, 0xad, 0x0f,
+  0x00, 0xb2, 0xee, 0x95, 0x15, 0x7a, 0x70, 0x3c, 0xf5, 0xc4, 0xc8, 0x61,
+  0x11, 0xaa, 0xe9, 0x90, 0x11, 0x98, 0xb6, 0xaa, 0xe1, 0x92, 0x80, 0xb2,
+  0x87, 0x9f, 0x2b, 0xe7, 0x55, 0x99, 0x89, 0x85, 0x34, 0xdf, 0x9d, 0x7d,
+  0xa0, 0x7a, 0x57, 0x20, 0xa8, 0x3c, 0x86, 0xe3, 0x8f, 0x97, 0x28, 0xe2,
+  0x50, 0x88, 0x25, 0x12, 0x79, 0x77, 0xc9, 0xb6, 0xba, 0x40, 0xbd, 0xcc,
+  0x11, 0xce, 0xa6, 0xcd, 0xcb, 0x77, 0xf5, 0x4f, 0xe7, 0xc4, 0x14, 0xd0,
+  0x3a, 0xd5, 0xe8, 0x32, 0x32, 0xa5, 0x69, 0x2a, 0x4a, 0x79, 0xd4, 0xbc,
+  0xb6, 0x5d, 0x4a, 0xc1, 0x2e, 0x9a, 0xda, 0x52, 0x4f, 0xc0, 0x22, 0x80,
+  0x08, 0x0d, 0xc7, 0x4d, 0x16, 0xec, 0x6b, 0x02, 0xdd, 0x4a, 0xac, 0xbc,
+  0x52, 0x46, 0x1b, 0x38, 0x0e, 0xec, 0xe0, 0x24, 0xfb, 0x90, 0xb0, 0xe8,
+  0x9f, 0x0d, 0x9e, 0xb9, 0x2b, 0x29, 0x31, 0xfb, 0x0c, 0x4f, 0x17, 0xe8,
+  0x36, 0x53, 0x17, 0x54, 0xec, 0x97, 0xff, 0x43, 0xa5, 0xcd, 0xd4, 0xdd,
+  0x77, 0xfe, 0x66, 0x40, 0x4f, 0x93, 0x30, 0xea, 0xa2, 0x4d, 0x75, 0x1d,
+  0xe5, 0x1b, 0x46, 0xa4, 0x0f, 0xa6, 0x16, 0x96, 0xf9, 0x80, 0x0f, 0x7e,
+  0x88, 0x9e, 0xbd, 0xb1, 0x3e, 0x41, 0xb5, 0xd2, 0x6a, 0xb6, 0x34, 0x96,
+  0x7c, 0x28, 0xff, 0x01, 0x88, 0xc6, 0xd4, 0x57, 0x9a, 0x76, 0xea, 0x6b,
+  0x29, 0x0a, 0x42, 0x16, 0x22, 0x70, 0x11, 0xe2, 0x47, 0x89, 0x17, 0x8a,
+  0x73, 0xb9, 0x5b, 0x14, 0xfc, 0x9f, 0xda, 0xc3, 0x85, 0xa8, 0x0a, 0x9b,
+  0x36, 0x6d, 0xf0, 0xa6, 0x1f, 0x2e, 0xac, 0xa1, 0xc7, 0xef, 0xb2, 0x2e,
+  0xc4, 0xf4, 0xbc, 0x91, 0x45, 0xed, 0xa6, 0xf1, 0xc7, 0x3a, 0xd1, 0x53,
+  0x31, 0xfd, 0x64, 0x2e, 0x7d, 0xb7, 0x40, 0x7f, 0xe5, 0xe9, 0x95, 0x2c,
+  0xa7, 0x9f, 0x69, 0x42, 0xa1, 0x28, 0x00, 0x9a, 0x63, 0xc4, 0xc0, 0x91,
+  0xa2, 0x6f, 0x78, 0x26, 0x7f, 0x90, 0xfc, 0xfd, 0xc3, 0x34, 0xc7, 0x91,
+  0x17, 0x61, 0x51, 0xf9, 0x32, 0xcb, 0x42, 0x64, 0x4e, 0x22, 0x6a, 0x9a,
+  0xa6, 0x94, 0xd2, 0xee, 0xfc, 0xcd, 0x14, 0x58, 0xf3, 0x54, 0xcc, 0x36,
+  0xa7, 0x32, 0xf2, 0x14, 0xda, 0x0e, 0x99, 0x67, 0x4e, 0x20, 0x7a, 0xc4,
+  0xf5, 0x37, 0x33, 0x42, 0xdf, 0xc2, 0x07, 0x3f, 0xdb, 0xc1, 0x31, 0x8c,
+  0xe6, 0x77, 0x4c, 0x0b, 0x0a, 0x96, 0x15, 0x27, 0x27, 0x4f, 0xae, 0x3a,
+  0xd4, 0xe3, 0xa9, 0x35, 0xc3, 0xd5, 0x74, 0x61, 0x98, 0x97, 0x0a, 0x5b,
+  0xed, 0xbf, 0xd5, 0x4b, 0x71, 0x5f, 0xd4, 0x19, 0xd2, 0xa7, 0x23, 0x2a,
+  0x3f, 0x9e, 0x3e, 0x38, 0xed, 0x66, 0xbb, 0x30, 0xb8, 0x3b, 0xb2, 0xb6,
+  0x78, 0xfa, 0xa0, 0x59, 0x71, 0xce, 0x99, 0x92, 0xfe, 0x98, 0x78, 0xf7,
+  0xfe, 0x0a, 0x86, 0x3d, 0x5e, 0x5f, 0x02, 0xcb, 0x2a, 0x55, 0x68, 0xd5,
+  0xe4, 0xc3, 0x47, 0xeb, 0x4d, 0x38, 0x3e, 0xaa, 0xca, 0xb9, 0x61, 0xed,
+  0xdf, 0xa2, 0x18, 0x17, 0xf7, 0x47, 0x86, 0x75, 0x79, 0x3d, 0xb7, 0x81,
+  0x1a, 0x68, 0x86, 0x14, 0xb5, 0x8a, 0x30, 0x5e, 0x35, 0xdb, 0x1a, 0xfb,
+  0xb8, 0xd7, 0xd7, 0xba, 0x4e, 0x50, 0x3f, 0xe2, 0x08, 0x13, 0x15, 0x87,
+  0x2d, 0xbf, 0x4d, 0xd5, 0x92, 0x00, 0x51, 0xa6, 0x10, 0x18, 0x3f, 0xeb,
+  0xbd, 0x36, 0x10, 0x31, 0xc7, 0x71, 0xda, 0x47, 0x82, 0xfa, 0xb9, 0xf7,
+  0xb6, 0x9d, 0x18, 0x1c, 0xd3, 0x31, 0x81, 0x25, 0xe6, 0xac, 0x84, 0x3e,
+  0x2e, 0xa8, 0xbe, 0xce, 0xf1, 0x30, 0xd0, 0xcf, 0x45, 0x85, 0xe4, 0x9c,
+  0x8d, 0xde, 0x68, 0x5c, 0x03, 0xb3, 0x9d, 0x86, 0x8a, 0x7e, 0xcd, 0xda,
+  0x4a, 0x6f, 0x09, 0xd0, 0x8a, 0x64, 0xdf, 0xec, 0xe9, 0x3d, 0x63, 0xee,
+  0x48, 0x4d, 0x1e, 0xb2, 0xd1, 0x51, 0x59, 0xac, 0x76, 0x46, 0x21, 0x65,
+  0x17, 0x07, 0x00, 0x0d, 0x21, 0x34, 0x55, 0xc2, 0xeb, 0xcb, 0xc8, 0xfe,
+  0xd7, 0x9a, 0xcb, 0x71, 0x90, 0x95, 0x0b, 0xa5, 0x89, 0x6d, 0xba, 0xb6,
+  0xb4, 0x7f, 0xff, 0xc1, 0x5e, 0xd9, 0x67, 0xa0, 0xb2, 0xd3, 0x2d, 0x72,
+  0x4a, 0x9b, 0x05, 0xfd, 0x6c, 0xd9, 0xcb, 0xde, 0xe1, 0x24, 0x8e, 0xac,
+  0x99, 0x27, 0xff, 0x4c, 0xba, 0x3f, 0x79, 0x34, 0x73, 0xf8, 0xf1, 0x54,
+  0xde, 0x82, 0x82, 0xfa, 0xf9, 0xcc, 0x7d, 0xa9, 0x02, 0x0c, 0x2f, 0x9b,
+  0xaf, 0x78, 0x51, 0xc7, 0x32, 0x50, 0xf0, 0xb5, 0xe3, 0xe0, 0xb0, 0xd1,
+  0xae, 0xc3, 0x7e, 0xa6, 0x53, 0xad, 0x66, 0x86, 0x55, 0xca, 0xbb, 0xa5,
+  0x2d, 0x8d, 0x2c, 0x99, 0x47, 0x42, 0xd3, 0x11, 0x86, 0xf8, 0x61, 0x09,
+  0x5c, 0x02, 0x1d, 0x65, 0x0a, 0xd1, 0xee, 0x22, 0xcc, 0xea, 0xed, 0x6d,
+  0x27, 0x54, 0xce, 0xe9, 0x7c, 0x6f, 0x5a, 0x77, 0x2b, 0xc4, 0xc5, 0xf3,
+  0x12, 0x88, 0xd5, 0x8f, 0xc9, 0xf0, 0xf3, 0x9e, 0x45, 0x7d, 0x99, 0x69,
+  0xde, 0x4f, 0xd3, 0x97, 0xc4, 0xa0, 0xfa, 0x64, 0x77, 0x46, 0x04, 0x22,
+  0x51, 0xe4, 0xb0, 0x8c, 0xe2, 0x01, 0xce, 0x28, 0x47, 0xce, 0x84, 0x0e,
+  0x37, 0xd0, 0xbe, 0x88, 0xe2, 0xe0, 0x20, 0x5d, 0xbe, 0xc6, 0x8a, 0x5b,
+  0x2e, 0xe3, 0x79, 0x87, 0x7f, 0xa3, 0xd6, 0x42, 0x22, 0x8c, 0x54, 0xbf,
+  0xbb, 0xa9, 0x96, 0xf4, 0xf0, 0x32, 0xcd, 0x41, 0x3f, 0x15, 0x75, 0xca,
+  0x58, 0xab, 0x6e, 0x3a, 0x99, 0xec, 0xd5, 0x72, 0x53, 0x85, 0x12, 0x63,
+  0x06, 0xb2, 0x63, 0x85, 0xfb, 0xfb, 0x83, 0x42, 0xa9, 0xf1, 0xfb, 0xbd,
+  0x18, 0xd1, 0x80, 0x05, 0xa6, 0x2e, 0x35, 0x29, 0x7f, 0x67, 0x37, 0x7e,
+  0xf8, 0xc1, 0x54, 0xf3, 0x81, 0xcc, 0x67, 0xc2, 0xaa, 0x90, 0xbe, 0x78,
+  0xef, 0xc0, 0x34, 0x18, 0x51, 0xab, 0x80, 0xa2, 0xfa, 0x89, 0xb7, 0x88,
+  0x7d, 0x49, 0xad, 0xe4, 0xab, 0xc1, 0x7e, 0x7a, 0x17, 0x80, 0x5b, 0x63,
+  0x9f, 0x4a, 0x20, 0x90, 0x00, 0xb4, 0x2c, 0xe8, 0xd9, 0xc8, 0x6c, 0x6c,
+  0x01, 0xcb, 0x12, 0xb2, 0xf5, 0xc9, 0x2d, 0x71, 0xc5, 0x0b, 0x7e, 0xb0,
+  0xb0, 0xc8, 0x69, 0x10, 0xd3, 0xe0, 0xfc, 0x8f, 0x7a, 0xdd, 0xec, 0xfa,
+  0x7e, 0x33, 0x2b, 0xbf, 0x85, 0xc9, 0xf0, 0x62, 0x5f, 0xe2, 0xc2, 0x36,
+  0xea, 0xe2, 0x58, 0x5e, 0x90, 0xd7, 0x2b, 0xdb, 0x1e, 0x01, 0x59, 0xa4,
+  0x50, 0xdd, 0x99, 0xa7, 0xac, 0x56, 0xf6, 0x6e, 0xa5, 0x7b, 0x62, 0xed,
+  0xe7, 0x5e, 0x01, 0x77, 0xc9, 0xac, 0xe3, 0x5c, 0x02, 0x8f, 0xf2, 0x62,
+  0x17, 0x84, 0xca, 0x0e, 0x5b, 0x0c, 0xf0, 0x5f, 0x85, 0xff, 0x07, 0x05,
+  0x09, 0xf2, 0x22, 0x10, 0x7d, 0x6d, 0x01, 0x50, 0x09, 0xe0, 0xe4, 0x79,
+  0xd7, 0x99, 0x53, 0x72, 0x2d, 0xe3, 0x7d, 0xe7, 0xc6, 0xf0, 0x47, 0xef,
+  0x23, 0x61, 0x5f, 0xe8, 0xd3, 0xfa, 0xa6, 0x25, 0x2d, 0xdb, 0x65, 0x71,
+  0x8d, 0xaf, 0x42, 0x09, 0x26, 0x94, 0x5f, 0x03, 0x06, 0xd1, 0x2f, 0xec,
+  0xc2, 0xfc, 0x53, 0x43, 0xf1, 0xbb, 0x06, 0x27, 0x1e, 0xc1, 0x0e, 0xca,
+  0x8e, 0x8b, 0x79, 0xf9, 0x0e, 0x8e, 0x1b, 0x3e, 0xc8, 0x8b, 0xde, 0x19,
+  0xe5, 0x98, 0x77, 0x75, 0x23, 0x15, 0x4b, 0x83, 0x26, 0xc1, 0x4b, 0x50,
+  0x3e, 0x79, 0xd6, 0x66, 0x4e, 0xac, 0xa2, 0x5e, 0x02, 0xf9, 0xa7, 0xab,
+  0x5e, 0x28, 0x95, 0x07, 0x14, 0x2e, 0xd6, 0xa9, 0x28, 0x2c, 0x7d, 0x5b,
+  0xff, 0x34, 0x3d, 0x74, 0x3d, 0xaa, 0x28, 0x53, 0x41, 0x37, 0x4e, 0xa9,
+  0xbd, 0x87, 0x6d, 0xd7, 0xa7, 0xf3, 0x4a, 0xfb, 0x95, 0xdc, 0x39, 0x66,
+  0x65, 0x9d, 0xb2, 0x2f, 0xd0, 0x83, 0x17, 0x30, 0x84, 0x9e, 0x4d, 0x07,
+  0xb8, 0x4a, 0x3f, 0x33, 0x30, 0x41, 0xc1, 0x29, 0xfe, 0x1b, 0x73, 0xe9,
+  0xa3, 0x3c, 0x19, 0x18, 0x2b, 0xcc, 0x90, 0x04, 0x1d, 0xfd, 0x5e, 0xd9,
+  0xfe, 0x1d, 0x2c, 0x40, 0x5e, 0x82, 0xe0, 0x64, 0x7b, 0x45, 0xa6, 0x87,
+  0x5a, 0xa7, 0x36, 0x00, 0x02, 0x50, 0x28, 0xbc, 0x6f, 0x9f, 0x08, 0x82,
+  0xbd, 0x55, 0xb9, 0xba, 0x78, 0xde, 0x55, 0xd7, 0x8a, 0xf1, 0x0f, 0x46,
+  0xc1, 0xc5, 0x8a, 0xe4, 0xba, 0xbe, 0x42, 0x04, 0x1e, 0xb4, 0x65, 0xb9,
+  0x07, 0x90, 0x40, 0x1b, 0x79, 0xdf, 0x7f, 0xb2, 0xa4, 0xe0, 0x8c, 0x4c,
+  0x7f, 0x68, 0x24, 0x7e, 0x46, 0x25, 0x1a, 0xd8, 0xf3, 0xc4, 0x2f, 0x55,
+  0x75, 0xf4, 0xcd, 0x85, 0xaf, 0x15, 0x76, 0xf5, 0x73, 0x84, 0x12, 0xdc,
+  0x7b, 0xae, 0x00, 0x9e, 0xb1, 0x0c, 0x2a, 0xa3, 0xdc, 0xfc, 0xf9, 0xe3,
+  0xe5, 0x7d, 0xe6, 0x61, 0x64, 0xef, 0xdd, 0x12, 0x36, 0xa3, 0x3c, 0x3b,
+  0xb9, 0x39, 0x29, 0x96, 0x6c, 0x14, 0xb5, 0xf3, 0xc4, 0x4e, 0x5e, 0x4b,
+  0xbf, 0xc2, 0x24, 0x04, 0x33, 0x4b, 0x99, 0x02, 0xfa, 0x98, 0x23, 0xe4,
+  0xde, 0x48, 0xe1, 0x60, 0xdb, 0xc6, 0xee, 0x40, 0x9b, 0xa8, 0x31, 0x4e,
+  0xa1, 0x10, 0x5a, 0xeb, 0xef, 0x02, 0x6a, 0x65, 0x8f, 0xf1, 0xa6, 0x02,
+  0x2a, 0xa5, 0x6d, 0xdc, 0x6b, 0xd5, 0x13, 0xa9, 0x69, 0xc4, 0x70, 0xdf,
+  0x50, 0x48, 0xc9, 0x43, 0x36, 0x7f, 0x5f, 0xf5, 0xb8, 0x4e, 0xe0, 0x4e,
+  0x5e, 0x14, 0x74, 0x61, 0x0a, 0xbc, 0x32, 0xd8, 0xfd, 0xbd, 0x5c, 0xf1,
+  0xcb, 0xcf, 0xe1, 0x1e, 0x48, 0x54, 0x10, 0x0b, 0x58, 0xce, 0x8c, 0xd0,
+  0x86, 0x2f, 0xb7, 0x4f, 0xef, 0x9c, 0xf7, 0xa7, 0xa4, 0x3a, 0x5f, 0xf0,
+  0xc9, 0x54, 0x34, 0x29, 0x77, 0x78, 0x52, 0xf3, 0x07, 0x82, 0x8b, 0x28,
+  0x28, 0x82, 0x51, 0x54, 0x57, 0x0c, 0xe6, 0x5e, 0xc8, 0xf9, 0x93, 0xc1,
+  0x41, 0xd0, 0x6d, 0xf7, 0xbc, 0xac, 0x21, 0xb2, 0xfa, 0x7a, 0xbc, 0x4b,
+  0x91, 0x54, 0x17, 0xef, 0x6a, 0x31, 0x8e, 0x81, 0x3e, 0x8e, 0x2c, 0x01,
+  0x10, 0x2e, 0xb7, 0x2f, 0xe6, 0xac, 0x68, 0x3c, 0xe6, 0x31, 0x8b, 0x7b,
+  0x95, 0xf5, 0x76, 0xdf, 0x36, 0x3d, 0x72, 0x9e, 0x57, 0x82, 0x55, 0xf5,
+  0x03, 0x32, 0x2b, 0x0f, 0x96, 0xc9, 0x62, 0xc5, 0xae, 0xfe, 0xf8, 0x00,
+  0xe7, 0x55, 0xe0, 0x3b, 0x70, 0xc0, 0xc7, 0x5f, 0xe7, 0x1d, 0x7a, 0xc4,
+  0x64, 0xe7, 0x8f, 0x24, 0xd7, 0xaf, 0x58, 0x68, 0x92, 0xa0, 0xce, 0x96,
+  0xd8, 0x13, 0x58, 0x8f, 0xa6, 0xcc, 0xef, 0xfc, 0x19, 0x36, 0xd6, 0x1d,
+  0x0a, 0xe2, 0xec, 0x2f, 0xde, 0x0e, 0x3e, 0x6d, 0xf6, 0x63, 0xc9, 0xcd,
+  0xbb, 0xdd, 0x32, 0x2a, 0x4b, 0xd5, 0x19, 0xa8, 0x37, 0x65, 0x57, 0x9f,
+  0x6d, 0x2d, 0x31, 0xf4, 0x15, 0x38, 0x64, 0x07, 0x5a, 0xaa, 0xc6, 0xe7,
+  0x71, 0x09, 0xa4, 0xb4, 0x62, 0xf7, 0xce, 0x18, 0xff, 0x13, 0xf4, 0x36,
+  0x52, 0x51, 0x0d, 0x28, 0x9e, 0x71, 0x6d, 0x28, 0xae, 0x48, 0xb4, 0xa3,
+  0x70, 0xcd, 0x16, 0x9b, 0x05, 0x15, 0xa9, 0x77, 0x16, 0x71, 0x2e, 0xbd,
+  0xb7, 0xa8, 0x5d, 0x31, 0x8b, 0x17, 0xeb, 0xc4, 0xae, 0x3c, 0x16, 0x15,
+  0x8b, 0x93, 0xa1, 0x18, 0xc0, 0xcc, 0x71, 0x00, 0x9c, 0x9a, 0x8f, 0xff,
+  0xb2, 0x75, 0x31, 0x41, 0x34, 0x16, 0x8f, 0x9a, 0xd8, 0xfe, 0x75, 0x6f,
+  0x13, 0x6f, 0xac, 0xb3, 0x49, 0xf0, 0x8a, 0x18, 0xe8, 0x45, 0x12, 0xfa,
+  0x26, 0x60, 0x64, 0x4a, 0x3a, 0x16, 0x1e, 0x4b, 0x1f, 0xbd, 0x4a, 0xe7,
+  0xe7, 0xda, 0x83, 0x44, 0x72, 0x78, 0x17, 0x00, 0x15, 0xdf, 0xf2, 0xeb,
+  0x18, 0x4a, 0x23, 0xb6, 0x54, 0x34, 0x03, 0x95, 0x84, 0xd9, 0x05, 0x62,
+  0x38, 0x34, 0x1e, 0x52, 0xc6, 0xc1, 0xed, 0x7c, 0xa1, 0xb4, 0x00, 0x50,
+  0xa4, 0xfc, 0x11, 0x78, 0xb7, 0xae, 0xf6, 0x5f, 0x23, 0x54, 0x69, 0x98,
+  0x3e, 0x19, 0xe3, 0xf2, 0x17, 0x05, 0x01, 0x63, 0x99, 0x84, 0xb6, 0x0c,
+  0x6b, 0xa3, 0xf6, 0x50, 0x84, 0xe0, 0x3c, 0x5e, 0xfe, 0x5e, 0xfc, 0x49,
+  0xd6, 0xea, 0xf2, 0xe7, 0x01, 0xd5, 0x7a, 0xf7, 0x0c, 0xa4, 0xa4, 0xb1,
+  0x38, 0x20, 0x74, 0xd5, 0x33, 0x6b, 0x92, 0x3c, 0x29, 0xec, 0x30, 0xd9,
+  0xba, 0x59, 0xe0, 0x77, 0x0b, 0x60, 0xaa, 0x91, 0xa8, 0x9f, 0x66, 0x44,
+  0x6c, 0xb7, 0xc4, 0xe1, 0xe5, 0x9a, 0xba, 0xdc, 0x77, 0x69, 0x4f, 0x7c,
+  0x87, 0x7f, 0x48, 0xee, 0x8f, 0x7c, 0xef, 0xdb, 0xbe, 0x4d, 0x3e, 0x95,
+  0x1b, 0xf7, 0x87, 0x77, 0xaa, 0x40, 0x29, 0x29, 0xb7, 0x7b, 0xda, 0x1c,
+  0x70, 0x35, 0x81, 0xc6, 0x0d, 0xa0, 0x8b, 0xfe, 0xff, 0xe7, 0x45, 0x5b,
+  0xde, 0xf6, 0x6d, 0xb0, 0x90, 0x73, 0x79, 0xd5, 0x91, 0x2d, 0x2a, 0x3d,
+  0x90, 0x8a, 0xd1, 0x6f, 0xae, 0x32, 0x50, 0x6a, 0xa7, 0xc7, 0xc8, 0xa5,
+  0xc6, 0xf0, 0x0d, 0xdb, 0x15, 0x77, 0x8a, 0x6b, 0x61, 0xbd, 0x2d, 0x34,
+  0x1e, 0x4d, 0xa2, 0xaf, 0x2b, 0xf8, 0x5a, 0xf4, 0x42, 0x6a, 0x79, 0x0a,
+  0xb7, 0x96, 0x96, 0x15, 0x45, 0x60, 0x2c, 0x94, 0x78, 0xe2, 0x09, 0x35,
+  0x37, 0x73, 0x73, 0x03, 0xba, 0x9f, 0x2c, 0x64, 0x8d, 0xcf, 0x8d, 0x6b,
+  0x26, 0x00, 0x6b, 0x8c, 0x99, 0xc2, 0x02, 0x0c, 0xd7, 0x1f, 0x97, 0x3d,
+  0x31, 0xfd, 0x05, 0x08, 0x8a, 0xf5, 0xb9, 0x6c, 0x08, 0x72, 0x96, 0x48,
+  0x7c, 0x1e, 0xf6, 0x8f, 0xea, 0x26, 0x95, 0xf1, 0x1f, 0x3b, 0x98, 0x32,
+  0x55, 0xc1, 0x9c, 0xae, 0xd7, 0x10, 0xa2, 0xf2, 0xe3, 0x6c, 0x48, 0x35,
+  0xc6, 0xe1, 0xb3, 0x7a, 0xc2, 0xba, 0xc3, 0x0b, 0x80, 0xcd, 0x6c, 0xb7,
+  0x08, 0x2d, 0x0a, 0x45, 0xc6, 0xd0, 0xc6, 0x87, 0xf2, 0xe6, 0x24, 0x73,
+  0xf1, 0x6d, 0xfb, 0x50, 0x65, 0xcf, 0xb6, 0x9c, 0x0c, 0xae, 0x65, 0xc9,
+  0x27, 0x30, 0xba, 0x70, 0x7b, 0x39, 0x11, 0xb5, 0x54, 0x88, 0x31, 0x0e,
+  0x5d, 0xc8, 0x52, 0x67, 0x39, 0xa3, 0x12, 0x2d, 0xd6, 0xe2, 0x5d, 0x64,
+  0x55, 0xbc, 0xc6, 0x8c, 0x55, 0x8e, 0x19, 0x88, 0xff, 0x33, 0x74, 0x86,
+  0x78, 0x76, 0xec, 0x67, 0x1d, 0x96, 0x60, 0x01, 0x01, 0x10, 0xa2, 0x49,
+  0x70, 0xd3, 0x48, 0xe5, 0xd4, 0xd1, 0x3c, 0x5a, 0x88, 0x07, 0xf6, 0x79,
+  0x71, 0x10, 0xd0, 0x69, 0xf5, 0x23, 0xa3, 0xb9, 0x66, 0x83, 0x82, 0x14,
+  0x65, 0x95, 0x9c, 0x0d, 0x2c, 0x29, 0x24, 0x05, 0x82, 0xf2, 0x33, 0xf1,
+  0x64, 0x30, 0x06, 0xd3, 0x5d, 0xee, 0x94, 0xd9, 0xce, 0xdb, 0x2f, 0xac,
+  0xac, 0xac, 0x22, 0x6c, 0x3e, 0x29, 0xe9, 0x0c, 0x5c, 0x98, 0x05, 0x35,
+  0x20, 0xb6, 0x45, 0x0b, 0x59, 0x91, 0x20, 0x0b, 0xb6, 0xa5, 0xa1, 0x71,
+  0x22, 0x22, 0x93, 0x79, 0x6e, 0xa3, 0x2a, 0xfd, 0x06, 0x1d, 0xfd, 0xba,
+  0x79, 0x14, 0x1d, 0x94, 0x57, 0xce, 0xbe, 0x37, 0xcc, 0x97, 0x62, 0xbf,
+  0x91, 0x89, 0x45, 0xe1, 0xb3, 0x17, 0x31, 0xa3, 0xcd, 0x95, 0x7e, 0x67,
+  0x8b, 0xae, 0x4f, 0x74, 0x94, 0xbc, 0xf2, 0xeb, 0xb0, 0xdf, 0x63, 0x4e,
+  0x97, 0x8a, 0x8b, 0xea, 0x06, 0x95, 0xa6, 0x95, 0xd5, 0x8f, 0xfe, 0x31,
+  0xae, 0x9e, 0xd5, 0x4d, 0x40, 0x31, 0x21, 0x72, 0x33, 0xff, 0x5b, 0x4e,
+  0x18, 0x7f, 0x1e, 0x7a, 0xa6, 0xff, 0x24, 0x7d, 0xbb, 0x2d, 0x9f, 0x6e,
+  0x09, 0xc5, 0x9d, 0x1b, 0xef, 0xdc, 0x69, 0x6a, 0xc4, 0xc0, 0x24, 0xa9,
+  0xd2, 0xa4, 0x06, 0x6a, 0x3b, 0xdb, 0xb9, 0x1d, 0xe4, 0xd0, 0xd7, 0xa8,
+  0xef, 0xc4, 0xa9, 0x5e, 0xb0, 0x75, 0xa6, 0x75, 0xb6, 0x29, 0xb0, 0xb8,
+  0x49, 0x57, 0xd4, 0xad, 0xa3, 0x82, 0x16, 0xfa, 0xdc, 0x54, 0x9a, 0x23,
+  0xb1, 0xfd, 0x0a, 0x3c, 0x1e, 0xb6, 0xa2, 0x00, 0x29, 0x8d, 0xa9, 0xf9,
+  0x8f, 0x29, 0x78, 0xe9, 0x10, 0x5d, 0xa8, 0x1b, 0xce, 0x0d, 0xfa, 0xfa,
+  0x97, 0x60, 0xc1, 0x59, 0x77, 0xe6, 0x05, 0x2b, 0x83, 0x6a, 0x37, 0x25,
+  0x85, 0xd6, 0xb1, 0x51, 0x98, 0x38, 0x80, 0x4a, 0x63, 0x0b, 0xf9, 0xe2,
+  0x0e, 0xf1, 0x42, 0x15, 0x59, 0x43, 0x7d, 0x7d, 0xd7, 0x4d, 0x4d, 0xc8,
+  0xae, 0x40, 0x84, 0x7b, 0x6b, 0x09, 0xb2, 0x6c, 0x6c, 0xe5, 0x38, 0x85,
+  0x30, 0xca, 0xbf, 0x12, 0x6e, 0x03, 0xa8, 0xd0, 0x71, 0xca, 0xf0, 0x6f,
+  0xd1, 0xdd, 0xf7, 0x81, 0x6d, 0x3d, 0x64, 0xd1, 0xa0, 0x08, 0xd2, 0xec,
+  0xee, 0x21, 0xea, 0x0d, 0x67, 0x7f, 0x76, 0x31, 0x69, 0xd6, 0xec, 0x85,
+  0x6d, 0x93, 0x99, 0xaf, 0x77, 0xa7, 0x98, 0x2e, 0xe3, 0x3d, 0xf2, 0x3c,
+  0x7f, 0x7f, 0x08, 0xbf, 0x4a, 0x19, 0xf9, 0x93, 0x60, 0x75, 0x40, 0x20,
+  0x5e, 0x93, 0x93, 0x5a, 0x63, 0xde, 0xb7, 0xca, 0x67, 0x28, 0xe0, 0xaa,
+  0x2e, 0xf3, 0xa2, 0x7d, 0xe5, 0xcd, 0x81, 0x9c, 0xc6, 0x85, 0xc4, 0x8a,
+  0xb2, 0x49, 0xb1, 0x2f, 0x65, 0xf3, 0xf7, 0x7b, 0x80, 0x5a, 0x96, 0xd3,
+  0xd5, 0x18, 0x91, 0xae, 0xb8, 0xb0, 0x83, 0xcf, 0xe8, 0x1d, 0xa5, 0xa3,
+  0x32, 0x8a, 0x3b, 0xde, 0x53, 0xa8, 0x10, 0x7d, 0xec, 0xae, 0x78, 0x80,
+  0xc2, 0x3e, 0x7a, 0x42, 0xe1, 0x39, 0xc3, 0x7e, 0xf8, 0xf6, 0x8b, 0xa2,
+  0x42, 0x72, 0x4e, 0x44, 0xc0, 0xc8, 0x61, 0x24, 0x84, 0xa6, 0xdd, 0x65,
+  0x5e, 0x34, 0xa1, 0x0a, 0x42, 0x94, 0x1c, 0x39, 0x3b, 0x25, 0x09, 0x01,
+  0x9a, 0xae, 0x85, 0x5f, 0x87, 0x68, 0x6f, 0x73, 0xf0, 0xb3, 0x71, 0x07,
+  0xe4, 0x62, 0x26, 0x90, 0x60, 0xd3, 0xcb, 0x38, 0xde, 0xe7, 0x1c, 0x19,
+  0x7a, 0x56, 0x59, 0xe2, 0xea, 0xa1, 0xef, 0xaf, 0x22, 0x59, 0x3d, 0x9f,
+  0x99, 0x22, 0x4e, 0xd9, 0x2f, 0x6f, 0x48, 0x17, 0xdc, 0xd9, 0x28, 0x43,
+  0x42, 0x6b, 0x81, 0xd3, 0x2d, 0x0c, 0xac, 0x4d, 0xe3, 0x66, 0x68, 0xb0,
+  0xeb, 0x75, 0x43, 0x91, 0x93, 0xf9, 0x5c, 0xf5, 0xa3, 0xde, 0xf0, 0x0d,
+  0x6b, 0xba, 0x04, 0xfe, 0xe0, 0x3a, 0xf6, 0x78, 0xec, 0x91, 0x05, 0xa8,
+  0xd0, 0x18, 0xc5, 0x01, 0x09, 0xb4, 0x76, 0xb7, 0xb8, 0x82, 0x74, 0xd1,
+  0x36, 0x0a, 0xa7, 0xca, 0x56, 0x94, 0xad, 0x5d, 0xd6, 0x07, 0x6c, 0x11,
+  0x02, 0x03, 0x58, 0x18, 0x58, 0x5e, 0x90, 0x7d, 0x3a, 0xd8, 0xb6, 0x51,
+  0xc8, 0x36, 0x73, 0x69, 0xed, 0xb3, 0x58, 0x2a, 0x3d, 0x68, 0x90, 0x56,
+  0x11, 0xb3, 0x5f, 0x2e, 0x51, 0x7a, 0xcd, 0xd9, 0x05, 0xee, 0x85, 0xa0,
+  0xba, 0x3b, 0x73, 0x9c, 0xf1, 0xba, 0x44, 0x0c, 0xe4, 0xe1, 0x4d, 0x07,
+  0xd7, 0xf3, 0xd1, 0x70, 0xef, 0xb8, 0xd3, 0xc5, 0xe7, 0x01, 0x38, 0x5c,
+  0xfb, 0x18, 0x30, 0x95, 0x6b, 0x50, 0xfc, 0x54, 0x78, 0xba, 0x3f, 0x0e,
+  0x95, 0x49, 0x84, 0x5a, 0xce, 0xc4, 0x51, 0x26, 0x07, 0x8a, 0x1e, 0xbc,
+  0xec, 0x7b, 0x17, 0x08, 0x08, 0x08, 0x2e, 0x9b, 0x16, 0x0f, 0x43, 0x11,
+  0x45, 0x65, 0xa7, 0xde, 0xec, 0x4b, 0x1d, 0xd9, 0x53, 0x2e, 0xb5, 0x74,
+  0xa7, 0x54, 0x2c, 0x68, 0xe1, 0xe0, 0xf2, 0x9d, 0xec, 0xdf, 0x4d, 0xfe,
+  0xd8, 0xe6, 0xcb, 0xf1, 0xb3, 0xba, 0xe6, 0xeb, 0x1b, 0x3c, 0xa5, 0xe1,
+  0x06, 0xe2, 0x33, 0x11, 0x38, 0xe5, 0x6e, 0x65, 0xd2, 0x25, 0x2e, 0xd0,
+  0x79, 0x50, 0x3e, 0xf9, 0x2c, 0x3c, 0xc6, 0xc6, 0x82, 0x4b, 0xfd, 0x56,
+  0x08, 0x43, 0xcb, 0x46, 0xe0, 0x8c, 0x29, 0xc7, 0x35, 0x57, 0x88, 0xe5,
+  0x3b, 0x32, 0x8b, 0x93, 0x80, 0xdc, 0x87, 0x45, 0xc4, 0x95, 0x41, 0x98,
+  0xb6, 0x04, 0xda, 0xb2, 0x57, 0xbe, 0x33, 0x81, 0xfe, 0x2f, 0xeb, 0xf9,
+  0x42, 0x95, 0x95, 0x04, 0xa7, 0x98, 0xba, 0x95, 0x31, 0x5b, 0xd9, 0xd9,
+  0x17, 0x7c, 0x28, 0xb1, 0x98, 0x46, 0x0a, 0x57, 0x0e, 0x85, 0x62, 0xbe,
+  0xf4, 0x75, 0x93, 0xd0, 0x21, 0x3e, 0x8d, 0x6a, 0xaf, 0x2d, 0x5f, 0x1f,
+  0xdd, 0x36, 0x66, 0x95, 0xb7, 0x38, 0xf7, 0x31, 0x2a, 0x4d, 0x41, 0x56,
+  0xdb, 0x61, 0xff, 0x23, 0x3c, 0xf3, 0x62, 0xb0, 0x90, 0x8d, 0x6d, 0x44,
+  0x42, 0xd7, 0xf5, 0xad, 0x3e, 0x7f, 0xcb, 0x03, 0x50, 0x1a, 0x15, 0xcf,
+  0x44, 0x44, 0x75, 0xfb, 0xd0, 0x96, 0xa9, 0x4e, 0x12, 0x8b, 0xf8, 0x2a,
+  0xf6, 0xdb, 0xbd, 0x56, 0x7c, 0x5f, 0xd2, 0x2d, 0xbd, 0x0e, 0xe5, 0xf9,
+  0x2a, 0x80, 0xfc, 0xe1, 0xe1, 0xec, 0xef, 0x03, 0x94, 0x62, 0xfb, 0xf4,
+  0x84, 0x7b, 0xe0, 0x88, 0x74, 0x9e, 0x2c, 0x24, 0x0a, 0x9c, 0x3c, 0x2c,
+  0x95, 0x74, 0xde, 0xc2, 0x07, 0xab, 0x31, 0xd4, 0x37, 0x12, 0x4c, 0x3c,
+  0xc4, 0x45, 0x34, 0xd2, 0xff, 0xd4, 0x20, 0xe6, 0xd7, 0xef, 0x7e, 0x20,
+  0xce, 0x3d, 0x73, 0xce, 0x6d, 0x51, 0x7c, 0x33, 0x9b, 0x05, 0x0b, 0x48,
+  0xcb, 0x2e, 0x71, 0xd0, 0x32, 0x3f, 0xc0, 0xe4, 0xd6, 0xfd, 0xe5, 0xd7,
+  0x73, 0xe9, 0xe6, 0xce, 0x02, 0x08, 0x08, 0x08, 0xd3, 0x8b, 0xd6, 0xa9,
+  0x9d, 0xdd, 0xaf, 0x08, 0x96, 0xb6, 0xc8, 0xdb, 0xda, 0xab, 0xd6, 0x3a,
+  0x21, 0x85, 0x52, 0x9c, 0xa6, 0x8c, 0xb2, 0x85, 0x7a, 0xe3, 0xeb, 0x3d,
+  0x4f, 0x8c, 0xfb, 0x80, 0xb9, 0x31, 0x9e, 0x71, 0x4a, 0xe9, 0xbe, 0x6f,
+  0xfd, 0xdf, 0x89, 0xf9, 0x78, 0x67, 0xde, 0xf9, 0x02, 0x89, 0x24, 0xb7,
+  0x92, 0x7d, 0x69, 0x23, 0x9a, 0x02, 0xe6, 0xe2, 0xe1, 0x8f, 0xda, 0xb9,
+  0x7d, 0xf0, 0xef, 0x0e, 0xb1, 0x03, 0x77, 0x93, 0x2c, 0x2a, 0x7f, 0xbb,
+  0xbb, 0x08, 0xd2, 0xda, 0xa7, 0x18, 0x3d, 0x89, 0x59, 0x2e, 0x28, 0x72,
+  0xc5, 0x60, 0x54, 0xb5, 0x6e, 0xfe, 0xf2, 0x55, 0xd3, 0x9b, 0xf9, 0x57,
+  0xa0, 0x76, 0xd3, 0xd2, 0xf4, 0x82, 0xba, 0xcf, 0xeb, 0xb6, 0xd6, 0x92,
+  0xd2, 0x27, 0x7a, 0x14, 0xe9, 0x76, 0x68, 0x62, 0x42, 0x7a, 0x74, 0x7a,
+  0x9a, 0xc6, 0x5b, 0x31, 0xf8, 0xbc, 0xa2, 0x02, 0xfe, 0x38, 0x0b, 0x3c,
+  0x8f, 0xa2, 0xfc, 0xb0, 0x46, 0xde, 0x57, 0x68, 0x78, 0xe5, 0x50, 0x97,
+  0x43, 0xc9, 0xad, 0xbc, 0xa8, 0x7c, 0xaf, 0x81, 0x13, 0xb6, 0xb6, 0x55,
+  0x2e, 0x5a, 0x40, 0x82, 0x31, 0xa0, 0x06, 0x84, 0x90, 0x94, 0xdb, 0x99,
+  0xa7, 0xb9, 0x71, 0x38, 0x82, 0x38, 0xa6, 0x53, 0xcd, 0x36, 0x53, 0x37,
+  0x8a, 0xe2, 0x44, 0x05, 0xba, 0x3f, 0xed, 0xb7, 0xca, 0xc4, 0xc8, 0x49,
+  0xbd, 0xde, 0xd2, 0x9a, 0x60, 0x7f, 0xc9, 0xd1, 0x71, 0xeb, 0x5b, 0xfd,
+  0x9d, 0x55, 0x04, 0xee, 0xb8, 0x05, 0x3e, 0xa7, 0xde, 0x09, 0x19, 0x73,
+  0x04, 0x0a, 0x8b, 0x0b, 0x42, 0xa1, 0xdd, 0x67, 0x04, 0x0f, 0x20, 0x98,
+  0x83, 0xe2, 0x1b, 0xa5, 0x02, 0x19, 0xa0, 0xb1, 0xa3, 0x3c, 0xe2, 0x07,
+  0x25, 0x2f, 0x13, 0x76, 0x69, 0x1b, 0x96, 0x3b, 0xac, 0x5d, 0x5f, 0xa8,
+  0x52, 0xc8, 0x7b, 0x44, 0x66, 0x4c, 0x7d, 0xab, 0xea, 0x6b, 0x85, 0xd9,
+  0x71, 0xd9, 0x11, 0x0b, 0xce, 0x11, 0x22, 0xcc, 0x82, 0xd8, 0x99, 0x2e,
+  0x80, 0x18, 0x85, 0xb4, 0x00, 0x4d, 0x54, 0x32, 0x59, 0xfc, 0x9b, 0xc7,
+  0x6d, 0xbf, 0x05, 0x18, 0xee, 0xee, 0xee, 0xb4, 0x9f, 0x4d, 0xe6, 0x6c,
+  0xe4, 0xa2, 0xfa, 0xd7, 0x91, 0x43, 0x4b, 0xa7, 0x80, 0x8a, 0x3d, 0x16,
+  0xf4, 0x88, 0xe0, 0x40, 0x5c, 0xf5, 0x4f, 0x40, 0x77, 0x7a, 0x13, 0x47,
+  0xc0, 0xd7, 0xda, 0x89, 0x7e, 0x45, 0xfd, 0x78, 0x7e, 0x8b, 0x2e, 0x79,
+  0x7d, 0xa8, 0x9c, 0x77, 0xe9, 0xbd, 0x8f, 0xb3, 0x6c, 0x9b, 0x3b, 0x57,
+  0xfe, 0xdb, 0xaa, 0x18, 0xba, 0x33, 0x44, 0x70, 0xbc, 0x06, 0xba, 0x4e,
+  0x1a, 0x54, 0xf7, 0x32, 0x72, 0xa4, 0x0f, 0xd6, 0xa4, 0x6c, 0x2a, 0xbd,
+  0x6a, 0x09, 0x41, 0x19, 0x14, 0x6b, 0x33, 0x9a, 0x67, 0x5c, 0x97, 0x9d,
+  0xb9, 0xf3, 0x32, 0x09, 0x7b, 0x89, 0x38, 0xe4, 0xa8, 0xc8, 0x39, 0x60,
+  0xab, 0x72, 0x85, 0xe2, 0xc8, 0xc5, 0x82, 0x9e, 0x99, 0x90, 0x67, 0xd9,
+  0xee, 0xd2, 0x0c, 0x95, 0x3c, 0x14, 0x1a, 0x14, 0x09, 0xbe, 0xc2, 0xfe,
+  0xcd, 0xd3, 0x7c, 0xd0, 0x00, 0x06, 0x3b, 0x47, 0x42, 0xa5, 0x80, 0x7b,
+  0x08, 0xe6, 0xb5, 0xb5, 0x90, 0x66, 0x16, 0x2f, 0x7f, 0xda, 0x3a, 0x56,
+  0xd0, 0x00, 0x38, 0x4d, 0x61, 0xf3, 0x9c, 0x1f, 0x6e, 0xf2, 0x7a, 0xc1,
+  0x7d, 0x2f, 0xd2, 0x2e, 0x8e, 0xc4, 0x0f, 0x03, 0x1b, 0xac, 0x5d, 0xf4,
+  0xa2, 0x22, 0x03, 0x0d, 0x35, 0xc2, 0x13, 0x25, 0x82, 0x94, 0x94, 0x94,
+  0x94, 0x06, 0x38, 0xf5, 0x23, 0x94, 0x82, 0xc6, 0xde, 0xce, 0x80, 0xba,
+  0xab, 0x4c, 0x2e, 0xc4, 0x47, 0x71, 0xb1, 0x33, 0xf1, 0x68, 0x44, 0xd6,
+  0x14, 0x51, 0x51, 0x7b, 0xeb, 0x85, 0xa1, 0x1f, 0xe7, 0xb9, 0x53, 0x6b,
+  0xdb, 0x1f, 0x88, 0x63, 0xf2, 0x3e, 0xd9, 0x22, 0xbd, 0xf2, 0xa1, 0x92,
+  0xe3, 0x61, 0xa3, 0x1b, 0x7b, 0x1c, 0xf7, 0xa4, 0x79, 0xbc, 0x6b, 0x36,
+  0x65, 0x41, 0x71, 0xad, 0xa0, 0x94, 0x99, 0x64, 0xc7, 0x35, 0xc4, 0x28,
+  0x90, 0x2e, 0x0b, 0xcf, 0x2f, 0x5c, 0x3e, 0x47, 0x1f, 0x57, 0xd7, 0xe0,
+  0x77, 0x33, 0x85, 0xb2, 0x1a, 0xe2, 0x39, 0x97, 0x50, 0x90, 0x79, 0x73,
+  0x56, 0xe5, 0x98, 0x50, 0x75, 0x1c, 0x44, 0x3a, 0x47, 0x46, 0xde, 0xe1,
+  0xf9, 0x72, 0x39, 0xb5, 0x01, 0x34, 0x74, 0x2a, 0x39, 0xc6, 0x7d, 0x1d,
+  0xdc, 0xad, 0xb0, 0xe3, 0xda, 0xbc, 0xfb, 0x4e, 0x45, 0xd2, 0xe7, 0x32,
+  0x59, 0x13, 0x83, 0x04, 0x74, 0xca, 0xa9, 0xc3, 0x1e, 0x2d, 0x05, 0x73,
+  0xbf, 0x07, 0x56, 0x4b, 0x96, 0xb5, 0xab, 0x40, 0x7b, 0x2e, 0xda, 0xc7,
+  0xd3, 0x0e, 0x6a, 0xd0, 0x39, 0x48, 0x99, 0x5a, 0x6e, 0xd1, 0x97, 0x85,
+  0x72, 0x0a, 0xcc, 0x80, 0x0d, 0xdf, 0xb4, 0x0a, 0x6a, 0xa0, 0xa5, 0x3f,
+  0xe1, 0x62, 0x9d, 0x98, 0x51, 0x21, 0x44, 0xf6, 0xae, 0xf5, 0x04, 0xaf,
+  0xfa, 0x8a, 0xfb, 0x24, 0x78, 0xbf, 0x86, 0x0c, 0xa6, 0xe2, 0x6f, 0xa1,
+  0x2f, 0x9f, 0x35, 0xe2, 0x37, 0x95, 0x72, 0x59, 0xff, 0x3f, 0x20, 0x17,
+  0xfe, 0x0c, 0x07, 0x41, 0x59, 0x31, 0x59, 0x84, 0x3f, 0x63, 0x19, 0xff,
+  0xe6, 0x4b, 0xa4, 0x25, 0xe0, 0x67, 0x2f, 0xfe, 0xac, 0xbb, 0xbf, 0x3c,
+  0x55, 0x5f, 0xe5, 0x53, 0xc0, 0xdc, 0xa6, 0x45, 0x19, 0x73, 0x38, 0x1a,
+  0xb9, 0x8a, 0x00, 0x38, 0x91, 0x59, 0x22, 0xe9, 0x17, 0x66, 0x41, 0xe3,
+  0xdd, 0x8e, 0xb0, 0xac, 0x3a, 0x75, 0xda, 0x93, 0xde, 0x9e, 0xec, 0x6d,
+  0xcc, 0xc5, 0xd2, 0xf0, 0x77, 0xf1, 0xa7, 0x27, 0xf8, 0x5b, 0x16, 0xee,
+  0x12, 0xdf, 0xb1, 0xde, 0x7a, 0x55, 0x58, 0xbe, 0x57, 0x9a, 0xb4, 0xbb,
+  0x19, 0xd4, 0x07, 0x3e, 0x45, 0x68, 0x42, 0x69, 0x6e, 0x1a, 0x9c, 0xa9,
+  0x5c, 0x21, 0xd0, 0xa0, 0x6a, 0xf2, 0x45, 0x4b, 0x3d, 0x67, 0xd7, 0x2e,
+  0x41, 0xa1, 0x72, 0x38, 0x06, 0x73, 0xfd, 0x8c, 0xa0, 0x40, 0xa8, 0x9f,
+  0xfd, 0x46, 0x6b, 0x51, 0xe8, 0x88, 0xcd, 0xc6, 0x7f, 0x66, 0xca, 0x0e,
+  0xdb, 0xa7, 0x54, 0x8b, 0x61, 0x4a, 0x42, 0x3e, 0xec, 0xbc, 0xb1, 0x7d,
+  0x41, 0xfe, 0x4e, 0xda, 0xa4, 0x3e, 0xbe, 0x92, 0xda, 0x9a, 0x3e, 0x51,
+  0xad, 0xb9, 0xf4, 0xe3, 0x9e, 0x8a, 0x0c, 0xda, 0x03, 0xb3, 0x18, 0x08,
+  0x06, 0x6f, 0x17, 0x93, 0xe2, 0x0c, 0x26, 0xc6, 0x39, 0xc6, 0x09, 0x25,
+  0xa2, 0xff, 0xaa, 0xdf, 0x7d, 0xf0, 0x7f, 0x69, 0xa0, 0x2f, 0x7f, 0x1b,
+  0x61, 0x84, 0x60, 0xa6, 0xdc, 0x8b, 0xbe, 0x07, 0x29, 0x75, 0xae, 0x05,
+  0x25, 0xb7, 0x79, 0x5f, 0x2c, 0x4e, 0x2b, 0x05, 0x25, 0x3d, 0x0a, 0x17,
+  0xd8, 0x92, 0x0e, 0xb2, 0x08, 0x4f, 0x90, 0x02, 0xc1, 0x20, 0x74, 0x58,
+  0x52, 0x38, 0x1f, 0x34, 0x6c, 0x45, 0xe3, 0x8f, 0x82, 0x6b, 0x62, 0x35,
+  0xa5, 0xfb, 0x71, 0xab, 0x72, 0x4f, 0x8a, 0x8a, 0x17, 0x93, 0x15, 0x61,
+  0x87, 0xac, 0x31, 0xe4, 0x10, 0x42, 0x08, 0x31, 0x4d, 0xad, 0x8e, 0xe4,
+  0xfb, 0xe1, 0x8c, 0x76, 0xce, 0x9b, 0x61, 0x26, 0xdc, 0x11, 0x92, 0xa7,
+  0xd0, 0x5b, 0xfb, 0xd5, 0xfb, 0x14, 0xed, 0xb0, 0xa7, 0x2b, 0x20, 0x5f,
+  0x6f, 0x96, 0xad, 0x71, 0x29, 0x89, 0x0b, 0x5e, 0xf8, 0x15, 0x02, 0xdd,
+  0x79, 0x01, 0xc0, 0xb6, 0x5d, 0xf6, 0xd0, 0x64, 0x04, 0x09, 0x85, 0xc6,
+  0x92, 0x8c, 0x99, 0x52, 0x5a, 0x65, 0xe5, 0xad, 0x06, 0xde, 0x08, 0x8a,
+  0xeb, 0xb9, 0xbd, 0x09, 0x01, 0x05, 0x0d, 0x71, 0xb9, 0xb8, 0x09, 0xa0,
+  0x41, 0x58, 0x9c, 0xc2, 0xab, 0x6c, 0x3d, 0xa9, 0xaf, 0x54, 0xe5, 0x4f,
+  0x1d, 0xfd, 0xaf, 0x97, 0x75, 0x6f, 0x32, 0x89, 0xc7, 0xe6, 0x00, 0xb7,
+  0x0e, 0xd7, 0xa1, 0xdd, 0x77, 0xd3, 0x5a, 0x49, 0xaf, 0x4d, 0xef, 0xae,
+  0xf9, 0x57, 0x2a, 0x2a, 0x54, 0x61, 0x80, 0x34, 0xc6, 0x46, 0xdf, 0xf9,
+  0x42, 0xda, 0x72, 0xdd, 0x49, 0xd5, 0x36, 0x50, 0xa7, 0x8d, 0x6c, 0xeb,
+  0x2c, 0xdd, 0xcf, 0x91, 0x29, 0x25, 0x6b, 0xa3, 0x05, 0x1b, 0xc0, 0xde,
+  0x68, 0x16, 0xde, 0x6c, 0x42, 0x32, 0x93, 0x78, 0x9a, 0xf4, 0x8c, 0x29,
+  0xa2, 0x81, 0xc3, 0xd5, 0xb7, 0x3b, 0x88, 0xc0, 0x2c, 0x9b, 0x79, 0x9c,
+  0x39, 0x68, 0xb1, 0xae, 0xa3, 0x28, 0xce, 0x59, 0x63, 0xf0, 0x9a, 0xeb,
+  0x66, 0xe9, 0xb7, 0xe5, 0xe5, 0x45, 0xe1, 0x74, 0x2a, 0xc0, 0xdb, 0x95,
+  0x34, 0xbb, 0xf4, 0xa6, 0xbe, 0x49, 0x3c, 0x89, 0x3a, 0xa6, 0x00, 0xc1,
+  0xba, 0xd5, 0x74, 0x6d, 0x20, 0xb5, 0x2a, 0x47, 0xb6, 0x97, 0x0d, 0x6e,
+  0xeb, 0xd4, 0x39, 0x34, 0x4f, 0xfa, 0x4b, 0x79, 0xd4, 0xc2, 0xc2, 0xa1,
+  0xe4, 0x61, 0xad, 0xd7, 0xf2, 0xd7, 0xce, 0x1a, 0x20, 0x69, 0x2e, 0xe6,
+  0x58, 0x7c, 0x8f, 0xc9, 0x67, 0x15, 0xe7, 0x5e, 0x2a, 0xb7, 0x82, 0xf7,
+  0x81, 0xde, 0xe7, 0x20, 0x6b, 0x2b, 0xa0, 0x84, 0xbd, 0x3b, 0xbc, 0xb1,
+  0xc9, 0xe2, 0xb3, 0xbf, 0xbb, 0xf1, 0x50, 0x11, 0x80, 0xba, 0x74, 0xf4,
+  0x55, 0xac, 0x58, 0x59, 0x48, 0xc2, 0xc4, 0xa0, 0x39, 0xdf, 0x24, 0x8f,
+  0x58, 0xc8, 0x1a, 0x0f, 0x9c, 0xcc, 0xcc, 0xac, 0x99, 0xac, 0x7f, 0xac,
+  0xa8, 0x26, 0x57, 0x5b, 0x81, 0x84, 0x9b, 0x02, 0x7c, 0xbc, 0xa0, 0x68,
+  0xe2, 0x15, 0x75, 0xd6, 0xef, 0xe1, 0xf0, 0x90, 0xf1, 0x80, 0x99, 0x52,
+  0x87, 0xe7, 0x67, 0x5d, 0x8d, 0x99, 0xad, 0x92, 0xb8, 0xd9, 0x92, 0x06,
+  0x27, 0xf8, 0xc3, 0xb5, 0xd6, 0x35, 0x9e, 0x38, 0xd6, 0x03, 0x7a, 0x13,
+  0xe2, 0x8c, 0xa8, 0xee, 0x2f, 0x2f, 0x4f, 0xae, 0x4f, 0x92, 0x26, 0x99,
+  0xcf, 0xcd, 0x58, 0x24, 0xee, 0x4d, 0x52, 0x75, 0xb8, 0x84, 0xd3, 0x12,
+  0x04, 0x56, 0x20, 0x88, 0xde, 0x0f, 0x2e, 0x00, 0x8e, 0x54, 0x76, 0x4a,
+  0xac, 0xa6, 0x02, 0x14, 0x30, 0xed, 0x5d, 0x3f, 0x94, 0x3e, 0x5e, 0xf1,
+  0xf4, 0xbf, 0x8f, 0x35, 0x09, 0x27, 0x4b, 0x20, 0x79, 0x2a, 0x07, 0x51,
+  0x21, 0x8f, 0xcf, 0x5d, 0xd8, 0xd7, 0x4e, 0x4d, 0x0b, 0xad, 0xe9, 0x63,
+  0xc9, 0xeb, 0x72, 0x40, 0x60, 0x0f, 0x7c, 0x5d, 0xc4, 0xe8, 0x03, 0xa4,
+  0x67, 0x0c, 0x94, 0xcb, 0xce, 0x31, 0xcb, 0xaf, 0xce, 0x03, 0xf0, 0x18,
+  0x24, 0x75, 0x25, 0x55, 0x97, 0x5a, 0x17, 0x62, 0x89, 0x9d, 0x2e, 0xd0,
+  0x93, 0x3c, 0x5b, 0x44, 0x96, 0x81, 0xcb, 0x79, 0x38, 0x38, 0xa3, 0xf4,
+  0x93, 0x1a, 0x32, 0xbd, 0xd2, 0x5b, 0x47, 0x42, 0x37, 0x5c, 0x0e, 0xc2,
+  0xdd, 0x81, 0x71, 0xd7, 0xd6, 0x78, 0x06, 0xfb, 0x98, 0x47, 0x20, 0x76,
+  0x3e, 0xcb, 0xb1, 0xac, 0x23, 0x4a, 0x13, 0x95, 0xd1, 0x78, 0x8c, 0x31,
+  0xa0, 0xe3, 0xfb, 0x60, 0xe6, 0x32, 0x80, 0x59, 0x33, 0x0c, 0xf4, 0x49,
+  0x61, 0x4e, 0xfb, 0x92, 0xa4, 0xb2, 0xbc, 0xd8, 0xd8, 0x09, 0x6a, 0x04,
+  0xe4, 0x87, 0x16, 0xec, 0xbc, 0xc8, 0x77, 0xb6, 0xfd, 0xf8, 0xd5, 0x7c,
+  0x55, 0xf1, 0x81, 0x80, 0xc7, 0x17, 0xdd, 0x68, 0x3e, 0x15, 0xd5, 0x1f,
+  0x14, 0xfd, 0x4d, 0x11, 0xe9, 0xb7, 0xb6, 0xe2, 0x7f, 0x1a, 0xa9, 0x95,
+  0xfb, 0x64, 0x7f, 0xa0, 0x5b, 0x44, 0xac, 0xa1, 0xeb, 0xbc, 0x22, 0x25,
+  0x70, 0xe2, 0x80, 0x5d, 0x8a, 0x97, 0xa7, 0x35, 0xc4, 0x9b, 0x4b, 0xc8,
+  0x50, 0xf3, 0xbb, 0xa2, 0x78, 0x88, 0x19, 0x3e, 0x79, 0x0e, 0x55, 0x9b,
+  0x7c, 0x67, 0xfc, 0x39, 0xba, 0x3f, 0x78, 0x60, 0x5a, 0x3d, 0xd1, 0x37,
+  0xa6, 0xba, 0xe6, 0x2b, 0x20, 0x7a, 0x08, 0x14, 0xd6, 0x0f, 0xb5, 0xe9,
+  0x35, 0xa3, 0x0e, 0x5a, 0x4e, 0x4d, 0xb3, 0x1e, 0x92, 0x69, 0x76, 0xef,
+  0x9e, 0x0b, 0xee, 0xb2, 0xa0, 0x3a, 0x45, 0xd8, 0xd5, 0x56, 0xc2, 0x50,
+  0x03, 0x03, 0x5e, 0x9c, 0x2a, 0xf6, 0x72, 0x9a, 0x51, 0xba, 0x28, 0xac,
+  0x9c, 0x33, 0x9b, 0x2a, 0xdc, 0xd2, 0x23, 0x44, 0x74, 0xb1, 0xb8, 0x8a,
+  0xdb, 0xc3, 0x32, 0x6f, 0x61, 0x69, 0xa6, 0xa7, 0x25, 0x46, 0xb9, 0xd1,
+  0x46, 0xda, 0xc9, 0x1f, 0x32, 0xa2, 0x04, 0x83, 0xf8, 0xd9, 0x44, 0x18,
+  0x89, 0x9b, 0x50, 0xf8, 0x07, 0x9a, 0x6c, 0x69, 0xa0, 0x8a, 0x27, 0x6f,
+  0xe2, 0xa9, 0x5c, 0x2d, 0xfd, 0xb5, 0xbd, 0xab, 0x65, 0xf9, 0x94, 0x3e,
+  0x53, 0x0e, 0xf2, 0x9c, 0x1a, 0x3a, 0x57, 0x68, 0x03, 0x36, 0x1f, 0x73,
+  0x98, 0xeb, 0xfe, 0x65, 0xda, 0xdf, 0xde, 0xef, 0xee, 0xf9, 0x9c, 0xaa,
+  0xed, 0xe8, 0x0f, 0x70, 0x0d, 0xe1, 0x07, 0x5c, 0xd3, 0x42, 0x4e, 0xec,
+  0xe5, 0xaf, 0x03, 0xef, 0x1d, 0x40, 0x58, 0x48, 0xa2, 0x95, 0x67, 0x7e,
+  0x61, 0xab, 0x83, 0x41, 0x17, 0x9e, 0x08, 0x12, 0x3f, 0x31, 0x56, 0x42,
+  0x3c, 0xc3, 0x90, 0x2c, 0xd1, 0x94, 0x40, 0x69, 0xda, 0xdb, 0xa3, 0x7f,
+  0xbe, 0xa7, 0x2d, 0xa0, 0x69, 0xc7, 0xbf, 0x9e, 0x67, 0xed, 0xc9, 0xac,
+  0x79, 0x89, 0xce, 0xcd, 0x34, 0x53, 0x34, 0x05, 0x53, 0x55, 0xb5, 0xf5,
+  0xc1, 0x21, 0xea, 0x7f, 0x6f, 0x95, 0xca, 0x56, 0xe3, 0x5d, 0xac, 0xcd,
+  0xa9, 0x61, 0xc5, 0x40, 0x2a, 0xa0, 0x1e, 0xb4, 0x2e, 0x6c, 0x64, 0x1c,
+  0x96, 0x53, 0x29, 0x81, 0xca, 0x17, 0xed, 0x47, 0x55, 0x9a, 0xd7, 0xa0,
+  0xc0, 0x67, 0xe6, 0x97, 0xf6, 0x5b, 0xbb, 0x5f, 0xd9, 0x7a, 0xd4, 0x0f,
+  0x26, 0x26, 0xfc, 0x72, 0x86, 0xf2, 0x2e, 0xf3, 0x2e, 0x9e, 0x06, 0xec,
+  0x6f, 0x24, 0x30, 0xd9, 0x5a, 0xd4, 0x38, 0xe2, 0x49, 0xa5, 0xc5, 0xdf,
+  0x6c, 0x71, 0x27, 0x50, 0x84, 0xeb, 0xcb, 0x7a, 0xb3, 0x62, 0x94, 0x3c,
+  0xf6, 0x92, 0xfb, 0xba, 0xf7, 0xc1, 0xb2, 0x7c, 0xc5, 0x6a, 0x6e, 0x55,
+  0x4d, 0xe1, 0x76, 0x8b, 0xe4, 0x75, 0x9b, 0x20, 0x9d, 0x66, 0x2a, 0x34,
+  0x01, 0x36, 0x95, 0x7a, 0x75, 0x0d, 0x84, 0xfa, 0x81, 0xa7, 0x87, 0xf5,
+  0x5c, 0xb7, 0x11, 0xd2, 0xb3, 0x54, 0x1d, 0x0a, 0x8d, 0xf4, 0xec, 0x9a,
+  0xd2, 0xd8, 0x87, 0x89, 0xf4, 0xc4, 0x71, 0xf1, 0xe6, 0x7d, 0xa2, 0x49,
+  0x75, 0x92, 0x7f, 0x34, 0x63, 0x72, 0x22, 0xc7, 0x89, 0xb6, 0x3c, 0xfd,
+  0x0e, 0x54, 0x05, 0xbe, 0x2b, 0x5a, 0x56, 0xeb, 0x50, 0x1d, 0x7c, 0x51,
+  0x54, 0x40, 0xc8, 0xd0, 0x12, 0xbf, 0xe8, 0xc3, 0x47, 0xb6, 0xa0, 0x51,
+  0x01, 0x62, 0x50, 0x41, 0x5e, 0x43, 0x3b, 0x03, 0x48, 0x2c, 0x8e, 0x89,
+  0xbe, 0x6d, 0x22, 0xd6, 0xce, 0x29, 0xa0, 0x91, 0xdf, 0xa0, 0x1f, 0x6d,
+  0xa3, 0xa8, 0x82, 0x26, 0x5a, 0x42, 0x95, 0x30, 0xa0, 0x2d, 0xc6, 0x8b,
+  0x9c, 0xd7, 0x55, 0xfe, 0xb4, 0xa7, 0x36, 0x38, 0x24, 0x16, 0x7a, 0xf5,
+  0x66, 0xde, 0x7f, 0x03, 0x13, 0xe7, 0xe1, 0xa2, 0xa5, 0x2b, 0x3e, 0xd5,
+  0x55, 0xc4, 0x93, 0xae, 0x80, 0x4d, 0x93, 0xe9, 0x8d, 0xcf, 0xfe, 0x4e,
+  0x95, 0x0f, 0x51, 0x37, 0x1d, 0x1a, 0x38, 0x64, 0x90, 0x68, 0xcb, 0xfc,
+  0x80, 0xd0, 0xee, 0x73, 0xd3, 0x91, 0x28, 0x9a, 0x45, 0x8e, 0x8c, 0xb0,
+  0xf2, 0x06, 0xf0, 0xc1, 0xcb, 0x34, 0x5f, 0xc2, 0xe6, 0xe0, 0xb5, 0x90,
+  0x4f, 0xc6, 0x63, 0x1e, 0xf6, 0x8f, 0xd9, 0xb9, 0x20, 0x64, 0xe8, 0x34,
+  0xc7, 0x5f, 0x05, 0x35, 0x41, 0xeb, 0x3b, 0x8c, 0x9b, 0x10, 0x76, 0xa1,
+  0x78, 0xef, 0x93, 0x9a, 0xdd, 0x65, 0x1d, 0x17, 0xc7, 0x4a, 0x83, 0x4f,
+  0xbf, 0xbe, 0xde, 0x8f, 0xce, 0xe2, 0xc4, 0x6d, 0x4f, 0x0f, 0xb9, 0x3f,
+  0xfa, 0x53, 0x41, 0x53, 0x21, 0x61, 0x51, 0x64, 0x3c, 0xf1, 0x9f, 0xc8,
+  0xaa, 0xe2, 0x0c, 0x9d, 0x52, 0x07, 0x38, 0xda, 0x3a, 0x78, 0x11, 0x07,
+  0x9f, 0xe2, 0x8c, 0xbe, 0xc9, 0xa2, 0x5b, 0x84, 0x00, 0x3e, 0x68, 0x15,
+  0xb3, 0xbb, 0xed, 0x18, 0x55, 0x8a, 0x52, 0xa6, 0x1a, 0x81, 0xc9, 0x59,
+  0x80, 0xbd, 0x78, 0x70, 0x84, 0xb4, 0x7e, 0x30, 0x84, 0x4a, 0x65, 0xc0,
+  0x9e, 0x19, 0x09, 0x84, 0xb0, 0x12, 0x37, 0xd2, 0x6a, 0x66, 0x86, 0xda,
+  0x78, 0x89, 0x9b, 0x33, 0x2f, 0xaa, 0x7e, 0xa7, 0xde, 0x6f, 0x07, 0x5d,
+  0x56, 0x48, 0xda, 0xab, 0x99, 0xf1, 0x0b, 0xd3, 0xef, 0xe2, 0x51, 0xad,
+  0x5b, 0x9c, 0x33, 0x61, 0x28, 0xa8, 0xfc, 0xb4, 0x5a, 0x70, 0x8f, 0x9a,
+  0x66, 0x82, 0x2b, 0xec, 0x20, 0x45, 0x34, 0xf6, 0x76, 0x9a, 0x5c, 0x78,
+  0xcc, 0x1e, 0x1e, 0xae, 0x1e, 0xe0, 0x1a, 0x7a, 0xac, 0x41, 0xe5, 0x0e,
+  0xce, 0xe7, 0x7b, 0xd5, 0xe2, 0x14, 0x87, 0xe7, 0x5f, 0x25, 0x03, 0x02,
+  0xfe, 0xaa, 0x3a, 0x85, 0xc3, 0x2d, 0xd8, 0xd9, 0x05, 0x21, 0xdd, 0x5f,
+  0xbd, 0x79, 0x0f, 0x95, 0xfe, 0x4d, 0x60, 0xfd, 0x11, 0x08, 0x17, 0x87,
+  0x06, 0xd9, 0x5c, 0x96, 0x55, 0xb1, 0xb3, 0x06, 0x7c, 0xe6, 0xa9, 0xce,
+  0xd1, 0xeb, 0x9e, 0x1c, 0xcb, 0xb3, 0xef, 0xe2, 0x0b, 0x42, 0xb5, 0xf4,
+  0xc0, 0x10, 0x38, 0x38, 0x94, 0x0e, 0x91, 0x3b, 0x25, 0x67, 0xe1, 0x71,
+  0xdc, 0x48, 0x21, 0x5a, 0x95, 0xa8, 0xaf, 0x25, 0x78, 0x29, 0x89, 0xfe,
+  0x02, 0x79, 0x06, 0xdd, 0x5f, 0x01, 0xff, 0x3b, 0x45, 0x1c, 0xbd, 0x07,
+  0xa5, 0x85, 0xa6, 0x8f, 0xf0, 0x72, 0x34, 0x75, 0x1f, 0x0a, 0x80, 0x6e,
+  0x43, 0x94, 0xa8, 0x7b, 0xcf, 0x4f, 0x08, 0xa5, 0xd0, 0x5a, 0x7e, 0x36,
+  0x8d, 0x7f, 0x6a, 0x89, 0x39, 0x54, 0xc7, 0x69, 0x2f, 0x82, 0x58, 0x10,
+  0x06, 0xdf, 0x78, 0xd0, 0xe2, 0xf8, 0x2e, 0xc6, 0xdd, 0xbf, 0xbe, 0x8c,
+  0xfe, 0x1f, 0xca, 0xe6, 0x6b, 0xf7, 0xbb, 0x07, 0xee, 0x9e, 0xaa, 0x10,
+  0x31, 0xfa, 0x4a, 0xc4, 0x79, 0x0d, 0x8b, 0x19, 0x62, 0x2d, 0xf8, 0xad,
+  0xa3, 0x0a, 0xd0, 0x57, 0xd7, 0x76, 0x0f, 0x63, 0xbd, 0x93, 0xf0, 0x87,
+  0x3d, 0xd7, 0x95, 0x03, 0x0c, 0xe9, 0xae, 0x05, 0x15, 0x88, 0x33, 0xd1,
+  0x91, 0x1f, 0x78, 0x44, 0x20, 0x80, 0x30, 0xac, 0x26, 0x74, 0x28, 0xc3,
+  0xad, 0x70, 0x18, 0xd0, 0xba, 0xf3, 0x73, 0x10, 0xb0, 0xb2, 0x5d, 0xbd,
+  0xe8, 0x7c, 0x63, 0x4b, 0x5b, 0x1d, 0x83, 0x1f, 0x01, 0x53, 0xc3, 0x2b,
+  0x92, 0xa0, 0x90, 0x65, 0x47, 0xe0, 0x8b, 0x80, 0x0c, 0x73, 0x4a, 0x32,
+  0x1e, 0x22, 0xd5, 0xe5, 0xdc, 0x74, 0xe8, 0xee, 0xdd, 0x2a, 0x3f, 0x73,
+  0x51, 0xf3, 0x58, 0x70, 0x60, 0xd5, 0xe3, 0x82, 0x96, 0x68, 0xec, 0x92,
+  0xe6, 0x3f, 0xe4, 0x05, 0xb4, 0x86, 0xc1, 0x1a, 0xf0, 0xd2, 0x62, 0xda,
+  0x03, 0x91, 0x86, 0xc5, 0x44, 0xaf, 0x5a, 0x81, 0xee, 0x21, 0x88, 0xdc,
+  0x7c, 0x47, 0xa4, 0x7c, 0x66, 0x9e, 0x0b, 0x9b, 0xe0, 0x77, 0x91, 0xc8,
+  0x44, 0x40, 0x03, 0xd1, 0x64, 0x04, 0xe0, 0x5b, 0xeb, 0x75, 0xce, 0x97,
+  0x81, 0x99, 0x8b, 0xff, 0xa3, 0x25, 0xf7, 0xaa, 0x44, 0x97, 0x9b, 0x94,
+  0x18, 0xb3, 0xeb, 0xbb, 0x88, 0xec, 0xe3, 0x20, 0x58, 0x69, 0x61, 0x62,
+  0xb4, 0x66, 0xd0, 0x6b, 0x6b, 0xd8, 0x16, 0xe9, 0xfd, 0xa7, 0xc7, 0x8b,
+  0x60, 0x81, 0xd2, 0x9e, 0x5f, 0xd9, 0x8a, 0x46, 0xa4, 0xd5, 0xc4, 0xad,
+  0x6c, 0x46, 0xd0, 0xff, 0xce, 0x9b, 0xcc, 0x06, 0x92, 0x92, 0x05, 0x23,
+  0xdd, 0x1e, 0x5a, 0x74, 0x55, 0xdb, 0xa7, 0x81, 0x36, 0x72, 0xff, 0xd2,
+  0x10, 0x39, 0x70, 0x52, 0x4d, 0x02, 0x9c, 0x05, 0x56, 0xd6, 0xb2, 0xb0,
+  0x01, 0xd4, 0xaf, 0xbf, 0xa7, 0x0f, 0x65, 0x18, 0xcc, 0xf5, 0xb3, 0xff,
+  0xdd, 0x6a, 0x24, 0xf3, 0x4b, 0x1a, 0x01, 0x40, 0x57, 0xd1, 0xe6, 0x3d,
+  0x5c, 0xd1, 0x2a, 0xbf, 0x2d, 0x3d, 0xde, 0x93, 0x4f, 0x9d, 0xe9, 0xcb,
+  0x41, 0xb4, 0x2a, 0xbb, 0xae, 0x44, 0x26, 0xbd, 0x14, 0xb5, 0x92, 0x2d,
+  0x0a, 0x04, 0x92, 0xf9, 0x15, 0xf5, 0xf5, 0x1d, 0xae, 0xf6, 0xc3, 0x82,
+  0xc9, 0xe5, 0x13, 0x7e, 0x0e, 0xe7, 0x3c, 0x01, 0x6c, 0xff, 0xf7, 0x10,
+  0xc6, 0xfb, 0xac, 0xc0, 0x66, 0x54, 0xfa, 0x64, 0x4f, 0x8b, 0x6d, 0x85,
+  0x92, 0xf3, 0x46, 0xd9, 0x7a, 0x7a, 0xcc, 0x3c, 0x13, 0x25, 0x60, 0x0d,
+  0x97, 0x0a, 0x8d, 0x00, 0xe9, 0x37, 0x25, 0xe5, 0x28, 0x2b, 0x1c, 0xce,
+  0xad, 0xc8, 0x05, 0x45, 0xae, 0xa4, 0x68, 0x80, 0x43, 0x9d, 0x6e, 0x68,
+  0x3a, 0x64, 0x1f, 0xaa, 0x9a, 0x13, 0x8e, 0xfa, 0x9a, 0xb9, 0x53, 0xa0,
+  0x97, 0x49, 0x80, 0x86, 0x24, 0x2f, 0x4a, 0x0c, 0x2f, 0xbd, 0x49, 0x9d,
+  0x78, 0x3a, 0xbd, 0x67, 0x23, 0xed, 0x28, 0x2a, 0x20, 0xc2, 0x75, 0xd9,
+  0x37, 0xc9, 0x2f, 0x70, 0x0e, 0x68, 0x6d, 0x71, 0x5b, 0x72, 0xaa, 0x80,
+  0x38, 0xfc, 0xe3, 0xb3, 0x47, 0xff, 0x07, 0xb5, 0x1b, 0x22, 0x82, 0xd4,
+  0xee, 0x8a, 0x4e, 0x96, 0xe6, 0x64, 0x7d, 0x5a, 0x93, 0x1c, 0x48, 0xea,
+  0x31, 0x67, 0x41, 0x1f, 0x15, 0x01, 0x41, 0x0c, 0x28, 0x39, 0xbe, 0x96,
+  0x14, 0x45, 0x94, 0xb3, 0xe2, 0x9f, 0x46, 0xf0, 0xa0, 0xbe, 0x8e, 0x41,
+  0xea, 0x67, 0x66, 0x90, 0x97, 0x3b, 0x41, 0x28, 0x22, 0x4c, 0xb7, 0xf4,
+  0x07, 0x45, 0x4a, 0x4a, 0x33, 0xad, 0xd4, 0x0d, 0x10, 0xe0, 0x68, 0x7d,
+  0x45, 0x4b, 0x14, 0x44, 0xbb, 0xed, 0xe6, 0x63, 0xdb, 0x65, 0x62, 0x9d,
+  0x99, 0xf5, 0x57, 0xb6, 0x57, 0x42, 0x8d, 0x9e, 0xe3, 0x29, 0x61, 0xe6,
+  0xba, 0xc6, 0x3a, 0x12, 0x11, 0x8e, 0x25, 0x0a, 0x21, 0xb0, 0x38, 0xf0,
+  0x83, 0x87, 0x38, 0xb3, 0xf1, 0xf2, 0x68, 0xf1, 0xf3, 0x04, 0x8f, 0xe9,
+  0x71, 0xdd, 0x6c, 0x91, 0x74, 0xef, 0x76, 0x2f, 0x33, 0x31, 0xf4, 0x33,
+  0x55, 0xda, 0x06, 0xcd, 0x1f, 0xc8, 0xbd, 0x24, 0xd2, 0xe3, 0xfd, 0x1d,
+  0x33, 0x04, 0x06, 0xef, 0x73, 0x73, 0xac, 0xf8, 0xb0, 0xc2, 0x97, 0x1d,
+  0x7f, 0x9d, 0xa9, 0x39, 0x10, 0xb5, 0xd1, 0x70, 0x45, 0xcd, 0x3a, 0x02,
+  0x8f, 0x01, 0x28, 0x6e, 0xb0, 0xfb, 0x19, 0xe6, 0x4c, 0xa9, 0x9f, 0x64,
+  0xed, 0x4b, 0x0a, 0x37, 0xd7, 0x5b, 0x85, 0xc5, 0xf5, 0xa0, 0x92, 0x5b,
+  0xfd, 0xce, 0x13, 0x51, 0xc6, 0x8e, 0x31, 0x70, 0x54, 0xe0, 0xc0, 0xea,
+  0x12, 0xf0, 0x7f, 0x2d, 0x51, 0xe0, 0x5d, 0xeb, 0xf3, 0x70, 0x44, 0x74,
+  0xb8, 0x6d, 0x45, 0x43, 0x60, 0xa1, 0x61, 0xe9, 0xe6, 0x16, 0xe2, 0x0a,
+  0x98, 0x17, 0x64, 0x9b, 0xfe, 0xdf, 0x20, 0x9a, 0x1d, 0xb5, 0x1c, 0x9b,
+  0x61, 0xbb, 0x8a, 0x4c, 0xbb, 0x8b, 0xc1, 0xf9, 0xc4, 0x0d, 0x8f, 0x5b,
+  0x3e, 0x73, 0x08, 0x68, 0x3f, 0xaf, 0x4d, 0x74, 0x07, 0xd2, 0x8d, 0x3f,
+  0xe4, 0x39, 0xa0, 0xdc, 0x81, 0xa2, 0xff, 0x2d, 0x7e, 0x6b, 0xe2, 0xa9,
+  0x6c, 0xc2, 0x7a, 0xd9, 0x4f, 0x6b, 0x78, 0x3c, 0xce, 0xa3, 0xcf, 0x59,
+  0x0b, 0xfb, 0x7f, 0x9f, 0xd9, 0xaa, 0xe7, 0xab, 0xea, 0xfe, 0x28, 0xa4,
+  0x2a, 0xc5, 0x38, 0xdc, 0x0a, 0x9e, 0x31, 0x66, 0x31, 0x88, 0x90, 0x2b,
+  0x32, 0xbe, 0xab, 0x4a, 0xed, 0xdf, 0x26, 0x55, 0xec, 0xd3, 0xee, 0x13,
+  0x2e, 0xc0, 0x96, 0xfe, 0x7a, 0xc5, 0xed, 0x70, 0x26, 0x12, 0x28, 0xb6,
+  0x45, 0xe5, 0x13, 0x75, 0x8c, 0xe4, 0x77, 0x6b, 0xe3, 0xbb, 0x46, 0xa9,
+  0xbe, 0xd0, 0x17, 0x7a, 0x9a, 0x54, 0x6b, 0xb0, 0xad, 0x78, 0x83, 0x47,
+  0x5b, 0x1a, 0x85, 0xf6, 0x86, 0x54, 0x36, 0xf8, 0xc9, 0xe0, 0xe3, 0x4f,
+  0xe5, 0x17, 0xea, 0xd6, 0x41, 0x7a, 0x56, 0xc1, 0x81, 0xb8, 0x4d, 0x7a,
+  0xf8, 0xc4, 0xf6, 0x4d, 0x2d, 0x13, 0xd1, 0x3b, 0x22, 0x2b, 0x0a, 0x62,
+  0x62, 0x75, 0xb8, 0x0a, 0xb4, 0xba, 0x08, 0x84, 0x92, 0x9c, 0x22, 0x12,
+  0xad, 0x5f, 0x15, 0xbd, 0xb6, 0x16, 0x89, 0xd4, 0xbf, 0x40, 0x7d, 0xff,
+  0x99, 0xdc, 0xea, 0xfd, 0x58, 0x18, 0x6e, 0xe5, 0x5b, 0x76, 0xd6, 0x61,
+  0x77, 0x3e, 0x0b, 0x11, 0x6d, 0x11, 0xcf, 0x7f, 0x92, 0xaf, 0x85, 0x13,
+  0xf9, 0x97, 0x7e, 0x57, 0xf4, 0xf8, 0x5c, 0xaf, 0xc2, 0x38, 0x61, 0x27,
+  0xb5, 0x4f, 0x0f, 0xb9, 0x26, 0x88, 0xb2, 0xdd, 0x7b, 0x31, 0xfe, 0x23,
+  0x94, 0xe0, 0x4e, 0x9f, 0x16, 0xf3, 0x62, 0x55, 0xae, 0xa3, 0x7a, 0x4d,
+  0x23, 0x60, 0xfa, 0xd9, 0x7a, 0x32, 0x05, 0xda, 0x69, 0x70, 0x7d, 0x8a,
+  0xbe, 0x39, 0x0c, 0x65, 0x60, 0x56, 0xc8, 0x60, 0x80, 0x96, 0xcd, 0xc0,
+  0x34, 0x5f, 0xa7, 0xd7, 0x26, 0xcf, 0x38, 0x74, 0x4c, 0x8e, 0x75, 0xd7,
+  0xe9, 0x05, 0xa9, 0x60, 0x05, 0x51, 0xfe, 0xa8, 0xa7, 0x72, 0x0e, 0x94,
+  0x61, 0x56, 0x76, 0xea, 0x7f, 0x7e, 0x6a, 0xee, 0x51, 0x0f, 0xa1, 0x64,
+  0x91, 0x2a, 0xf5, 0xd5, 0x94, 0x04, 0xdf, 0x2f, 0xa6, 0x33, 0x9c, 0x8c,
+  0x01, 0xe6, 0x2b, 0x33, 0x02, 0x0e, 0xcc, 0x0c, 0x0e, 0x7f, 0x1f, 0xe6,
+  0x20, 0x15, 0xf4, 0xf4, 0x7f, 0x52, 0x53, 0x8b, 0x17, 0xcd, 0x49, 0x70,
+  0x87, 0x4a, 0x17, 0xa9, 0xbd, 0x98, 0x29, 0xae, 0xbf, 0x6e, 0x70, 0x9a,
+  0xfa, 0x4e, 0xa2, 0x91, 0xaa, 0xd8, 0x72, 0xc6, 0x28, 0xd3, 0x98, 0xf2,
+  0xba, 0x9a, 0x4c, 0x48, 0x5b, 0x66, 0x87, 0x02, 0xa9, 0x15, 0xa7, 0x83,
+  0x3c, 0xdc, 0xac, 0xf7, 0x0c, 0x46, 0x39, 0x7d, 0x4b, 0xef, 0x55, 0x3f,
+  0x61, 0x19, 0xac, 0x60, 0x23, 0xd8, 0xa3, 0xea, 0x2c, 0x64, 0xa5, 0x38,
+  0x67, 0x42, 0x54, 0xd7, 0x1c, 0xa0, 0x83, 0xc0, 0x46, 0xbf, 0x10, 0xd8,
+  0xea, 0x6a, 0x8d, 0x6a, 0xda, 0x13, 0x49, 0xfc, 0xc4, 0x66, 0x66, 0xd4,
+  0x78, 0x71, 0x66, 0x36, 0xe4, 0xf7, 0x17, 0x07, 0x72, 0x7c, 0x62, 0x4a,
+  0x9e, 0x04, 0xc5, 0x79, 0xba, 0x2c, 0xed, 0xf7, 0x96, 0x2e, 0x92, 0x99,
+  0xf1, 0x47, 0xcb, 0xb0, 0x5b, 0x10, 0x33, 0x54, 0x14, 0xf8, 0xe5, 0x53,
+  0xd1, 0xbc, 0xeb, 0x8f, 0x8d, 0xed, 0xd1, 0x6c, 0x45, 0xaf, 0x35, 0x01,
+  0xd9, 0xa1, 0x7c, 0xaa, 0xde, 0x7e, 0x5c, 0x26, 0xc1, 0xfd, 0x52, 0x92,
+  0xfe, 0xee, 0x6e, 0x45, 0x5a, 0x57, 0x0e, 0x78, 0xff, 0xa2, 0x2d, 0x0a,
+  0xe4, 0x72, 0x68, 0xf1, 0xc3, 0x69, 0x92, 0x38, 0xa7, 0xc8, 0x49, 0x76,
+  0x98, 0xaa, 0x01, 0xa9, 0x3d, 0x30, 0xb3, 0x95, 0xcb, 0x3f, 0x77, 0x04,
+  0x04, 0x77, 0x77, 0x04, 0x0c, 0x77, 0xdf, 0x04, 0xa5, 0x7d, 0xc7, 0xe5,
+  0x25, 0x45, 0xa4, 0x19, 0xc1, 0xd4, 0xcc, 0xa9, 0x18, 0xa1, 0x5b, 0x20,
+  0x75, 0x8c, 0x9d, 0x14, 0x47, 0x1e, 0xc4, 0x77, 0xd1, 0xcd, 0x34, 0xc0,
+  0x0d, 0xbf, 0xb7, 0x80, 0x25, 0x56, 0xb6, 0x5f, 0xe4, 0x35, 0xf7, 0x51,
+  0x15, 0x81, 0x59, 0xd5, 0xf4, 0x37, 0xba, 0x77, 0x0d, 0xdb, 0xf8, 0x93,
+  0x7e, 0x82, 0x6f, 0x7c, 0x46, 0x94, 0xb3, 0x62, 0x12, 0x15, 0x19, 0x9f,
+  0xd4, 0xf0, 0xeb, 0x70, 0x4b, 0xfd, 0x30, 0x6b, 0x8a, 0x15, 0x73, 0xca,
+  0x09, 0x51, 0x77, 0x2a, 0xf2, 0x5e, 0x80, 0x01, 0xe3, 0xb1, 0x75, 0x84,
+  0xbb, 0x1c, 0x3e, 0x1e, 0x7c, 0xc2, 0xed, 0xfd, 0x05, 0xfd, 0x84, 0x37,
+  0x5a, 0x15, 0x1c, 0xf2, 0x30, 0x92, 0x4b, 0x77, 0x46, 0x99, 0xae, 0x13,
+  0x42, 0xe8, 0xba, 0x73, 0x3c, 0x30, 0x79, 0x23, 0x74, 0xd1, 0xe7, 0x12,
+  0x85, 0x05, 0x31, 0x03, 0xd4, 0x42, 0xee, 0xa8, 0x5f, 0x24, 0xbc, 0x47,
+  0x8d, 0x9b, 0x9e, 0x6f, 0x96, 0x8c, 0xcb, 0xb7, 0xfb, 0x37, 0x34, 0x0e,
+  0xae, 0x07, 0xe3, 0xeb, 0x37, 0x64, 0x0c, 0x4d, 0x6a, 0x0b, 0xb7, 0x9c,
+  0x85, 0x17, 0x82, 0x0a, 0xc8, 0xf6, 0x05, 0x37, 0x1e, 0xf8, 0x07, 0xf3,
+  0x32, 0x93, 0xc2, 0x7f, 0x03, 0x6b, 0xd5, 0x05, 0x55, 0x2c, 0x65, 0xce,
+  0x9c, 0x7c, 0x3e, 0x1e, 0xd1, 0x68, 0x4a, 0xfc, 0x2d, 0x5c, 0x4c, 0xfa,
+  0x4c, 0x01, 0xe7, 0x6e, 0x76, 0x45, 0x4b, 0xdf, 0x27, 0x2b, 0xdd, 0xb6,
+  0x7c, 0x42, 0xc8, 0x11, 0x22, 0x8d, 0x68, 0xb6, 0x94, 0xee, 0xe5, 0x46,
+  0x76, 0xd3, 0xb9, 0x84, 0xe5, 0xba, 0x01, 0xe6, 0xc1, 0xda, 0x82, 0xf2,
+  0xbb, 0x63, 0x31, 0x51, 0x57, 0x33, 0xc4, 0xa4, 0xf8, 0x5a, 0x7c, 0x19,
+  0x92, 0x20, 0x55, 0x7f, 0x41, 0xcc, 0xf3, 0x8d, 0x11, 0x45, 0xe3, 0xac,
+  0x72, 0x94, 0x73, 0x2f, 0x52, 0x18, 0x50, 0xd1, 0xe4, 0x24, 0x50, 0x92,
+  0xe8, 0x5c, 0xe5, 0xbd, 0x25, 0x18, 0xfd, 0x31, 0xdb, 0xe8, 0xb0, 0xec,
+  0xa4, 0xa1, 0x43, 0xba, 0x2f, 0x45, 0x44, 0x95, 0x20, 0xb0, 0xae, 0xe5,
+  0x00, 0xb2, 0x43, 0x04, 0x7f, 0xf4, 0x66, 0x6c, 0xef, 0x06, 0x94, 0xc1,
+  0x09, 0xf9, 0x50, 0x14, 0x59, 0xe6, 0x92, 0x54, 0x7d, 0xe4, 0x2a, 0x4e,
+  0xc1, 0x27, 0x8f, 0xc9, 0xfa, 0xa6, 0x5d, 0x4f, 0x17, 0x12, 0x82, 0x2c,
+  0x2c, 0x90, 0x95, 0x7f, 0x92, 0x36, 0xec, 0x92, 0xdd, 0x95, 0x41, 0x92,
+  0x1e, 0x11, 0x87, 0xbe, 0x0d, 0x6d, 0x07, 0x4d, 0xef, 0x2f, 0xbd, 0xa2,
+  0x91, 0x29, 0xe8, 0x87, 0x1d, 0xa9, 0x68, 0x2c, 0x63, 0x03, 0xbf, 0xc2,
+  0x34, 0x8b, 0x9e, 0x84, 0x62, 0xd3, 0x57, 0x1d, 0xee, 0x49, 0xef, 0xb9,
+  0xf7, 0xef, 0xae, 0x85, 0x3b, 0x4c, 0xb2, 0x79, 0xf4, 0x6d, 0x74, 0x63,
+  0xff, 0xcc, 0x55, 0x47, 0x50, 0xb3, 0xb9, 0x50, 0x35, 0xa2, 0x0d, 0xb5,
+  0xa7, 0x5c, 0x6e, 0x59, 0x4c, 0xe0, 0xd0, 0xe6, 0x8a, 0xfd, 0x8a, 0x25,
+  0xf8, 0xd2, 0xa4, 0x02, 0x6b, 0x73, 0x9e, 0x9a, 0xd5, 0x21, 0xbe, 0x32,
+  0x6b, 0xb5, 0x40, 0x5f, 0x8a, 0xe9, 0xf8, 0x7a, 0x66, 0xb9, 0x13, 0xfe,
+  0xbd, 0xc9, 0xc6, 0xdc, 0x41, 0x6b, 0x48, 0x8e, 0x2c, 0x87, 0xe6, 0x9f,
+  0x40, 0x57, 0xb4, 0xb6, 0x0c, 0xfb, 0xc7, 0x10, 0xee, 0x1d, 0x9d, 0x4b,
+  0x0c, 0x5a, 0xe6, 0x1a, 0xb5, 0x77, 0x59, 0x74, 0x97, 0xbe, 0x9e, 0xe8,
+  0x42, 0x1e, 0x33, 0xa3, 0xc3, 0x74, 0x4e, 0xed, 0x73, 0xe2, 0x39, 0x16,
+  0x2f, 0x47, 0x18, 0x12, 0xf2, 0x12, 0x4b, 0xeb, 0xcc, 0xd9, 0xe7, 0xc5,
+  0xf3, 0xd7, 0xb5, 0xcc, 0x8f, 0xcd, 0x56, 0x29, 0x74, 0xd5, 0xa8, 0xaa,
+  0x6d, 0xf0, 0xba, 0xee, 0xb8, 0x17, 0xe8, 0x89, 0x44, 0x18, 0x66, 0x7e,
+  0x68, 0x0b, 0xb3, 0xe0, 0x98, 0x47, 0xef, 0x71, 0x4d, 0xb6, 0x46, 0x95,
+  0x1b, 0x52, 0x75, 0x1c, 0xc5, 0xcc, 0x08, 0xa7, 0x76, 0x66, 0x0c, 0x06,
+  0xe6, 0xba, 0x2e, 0x59, 0x6f, 0x5c, 0x1f, 0x43, 0x7e, 0x05, 0x79, 0x96,
+  0x0e, 0x8a, 0x6e, 0x3d, 0x2a, 0x05, 0xd3, 0x14, 0x89, 0xbb, 0x00, 0x89,
+  0xf8, 0x1a, 0x4d, 0xb5, 0xd0, 0x78, 0x70, 0x6e, 0x00, 0x35, 0xd9, 0xde,
+  0x33, 0x0f, 0x93, 0x64, 0xdc, 0x1a, 0xf6, 0xe2, 0x7c, 0xaf, 0x8e, 0x8c,
+  0x9d, 0x6c, 0x88, 0xc8, 0xbc, 0xac, 0x7d, 0x1e, 0xe9, 0xfd, 0xa2, 0x20,
+  0xa2, 0x3d, 0x88, 0x39, 0xb9, 0xdd, 0xa1, 0x8c, 0x4d, 0x09, 0x70, 0x01,
+  0x82, 0x6c, 0xb4, 0x2d, 0xa0, 0xdc, 0xa5, 0xc2, 0xc7, 0x4c, 0x2b, 0x3c,
+  0xda, 0xe6, 0x0e, 0x79, 0x9b, 0xf1, 0x80, 0xf2, 0x90, 0x11, 0x4f, 0xde,
+  0xf7, 0xb5, 0x5a, 0xcf, 0x02, 0xa5, 0x97, 0x22, 0xc8, 0x3f, 0x70, 0x1f,
+  0x3b, 0xac, 0x48, 0x4a, 0x9c, 0x68, 0xf1, 0x7a, 0x7c, 0xfb, 0xb6, 0xe9,
+  0x96, 0xdf, 0x56, 0xd4, 0xbc, 0xae, 0x1c, 0x41, 0xeb, 0x30, 0xab, 0xe3,
+  0xde, 0xea, 0x7b, 0x03, 0xdf, 0xeb, 0xf5, 0x95, 0xe5, 0x44, 0x2e, 0xef,
+  0x15, 0xd6, 0x79, 0x7e, 0xa7, 0x16, 0x9d, 0x42, 0x18, 0x08, 0xe2, 0x81,
+  0x6c, 0x37, 0x81, 0x55, 0xe8, 0x52, 0xe9, 0xc9, 0x35, 0xaf, 0xed, 0x53,
+  0xb1, 0xfc, 0x21, 0xe2, 0x43, 0x5e, 0xa4, 0xf8, 0xd0, 0x24, 0xb1, 0xea,
+  0xa4, 0x94, 0xa2, 0xad, 0xce, 0x53, 0x47, 0x02, 0x12, 0xc4, 0x5d, 0x6c,
+  0x0b, 0x5e, 0x3c, 0xdd, 0x64, 0x33, 0x39, 0xee, 0xb5, 0xcf, 0x41, 0x2d,
+  0x90, 0xf5, 0xd2, 0x32, 0x0a, 0x92, 0x46, 0xc1, 0x78, 0x8c, 0x7d, 0x39,
+  0x98, 0x61, 0x43, 0x97, 0x1d, 0x69, 0x19, 0xa4, 0xa1, 0x3d, 0x30, 0x0a,
+  0xa3, 0x9c, 0x42, 0x1d, 0xa5, 0x6c, 0xc5, 0x8e, 0xff, 0x38, 0x9c, 0xf5,
+  0x1c, 0x62, 0x03, 0xed, 0x93, 0x7a, 0xba, 0x2b, 0xb3, 0x57, 0x44, 0xa9,
+  0x76, 0x4f, 0xfc, 0x41, 0x6c, 0x2f, 0x6f, 0x43, 0xb3, 0xd3, 0x5c, 0x86,
+  0x89, 0x11, 0x75, 0xf0, 0x02, 0x6a, 0xfd, 0x92, 0xc3, 0xe2, 0x37, 0x01,
+  0x5d, 0xae, 0x6c, 0xff, 0x1f, 0xfd, 0xa4, 0xf2, 0xdf, 0x4e, 0x0b, 0xbb,
+  0xc7, 0xe6, 0xd5, 0xf3, 0x10, 0x72, 0xf9, 0xb2, 0xd4, 0xf9, 0x56, 0x35,
+  0xe2, 0x94, 0x79, 0x1f, 0xa9, 0xab, 0x5c, 0x8e, 0x35, 0x54, 0xdb, 0x1a,
+  0x5d, 0x72, 0x5a, 0x32, 0xa8, 0xc7, 0x17, 0xb8, 0x7a, 0x60, 0xef, 0x00,
+  0x14, 0x69, 0x25, 0x83, 0x75, 0x1f, 0x68, 0x01, 0xbf, 0x28, 0x86, 0x12,
+  0x75, 0x4f, 0x7b, 0x7d, 0xeb, 0x5f, 0x34, 0x17, 0xd7, 0xc0, 0x48, 0x7e,
+  0xcc, 0xac, 0x25, 0xe0, 0x7c, 0xd5, 0x74, 0x53, 0x00, 0xa0, 0x52, 0xd8,
+  0xeb, 0x68, 0xe8, 0xaa, 0xf0, 0x17, 0x95, 0x78, 0xd7, 0x19, 0xc6, 0xc3,
+  0x4b, 0xb7, 0x14, 0x00, 0x6b, 0x23, 0x6f, 0xa4, 0x03, 0x81, 0x3a, 0xe7,
+  0xbc, 0xb8, 0xd6, 0x29, 0x05, 0x5e, 0xa8, 0x0f, 0x66, 0xc3, 0x09, 0x31,
+  0x52, 0x67, 0x43, 0x5d, 0xc8, 0x3b, 0xba, 0x71, 0x9b, 0x5d, 0xec, 0x55,
+  0x66, 0x54, 0x08, 0x72, 0x78, 0xee, 0xe9, 0xb5, 0xe9, 0xf3, 0xc7, 0xca,
+  0x56, 0x4a, 0xec, 0x93, 0xef, 0xc1, 0xba, 0x03, 0x87, 0x32, 0x3f, 0x48,
+  0x6a, 0x19, 0x71, 0x29, 0x14, 0xf1, 0xd8, 0x35, 0x63, 0xe8, 0x93, 0xef,
+  0x68, 0x0e, 0x49, 0x99, 0x60, 0x44, 0x2f, 0x0e, 0xde, 0x81, 0x56, 0x00,
+  0x33, 0x6e, 0x27, 0xd2, 0xbc, 0x14, 0x91, 0xb4, 0x43, 0x6b, 0xd4, 0xfd,
+  0x99, 0x34, 0xcb, 0x74, 0x47, 0x98, 0xe8, 0x8b, 0x2d, 0x4e, 0x56, 0x7f,
+  0x1a, 0xbf, 0x54, 0x98, 0xe5, 0xec, 0x25, 0xbe, 0x13, 0x50, 0x09, 0x82,
+  0xa5, 0x5b, 0xb4, 0x4a, 0x74, 0xe6, 0x98, 0x46, 0x8e, 0x26, 0x68, 0xd3,
+  0x24, 0x95, 0x5f, 0xdc, 0x68, 0x08, 0xd7, 0x31, 0xa1, 0x82, 0x32, 0x97,
+  0x8c, 0x2d, 0x82, 0x20, 0xdd, 0x7a, 0xf3, 0x8f, 0xc7, 0x89, 0xe7, 0x7b,
+  0x66, 0xf0, 0xd3, 0x53, 0x51, 0x0b, 0xdf, 0xa5, 0xcf, 0xb9, 0x69, 0xec,
+  0x1d, 0xe9, 0x90, 0x68, 0x85, 0x6d, 0x58, 0x8a, 0xae, 0x93, 0x4e, 0x55,
+  0xd1, 0xb7, 0x7e, 0x17, 0xdf, 0x1e, 0x39, 0xe3, 0x8c, 0x16, 0xb1, 0x67,
+  0x5c, 0x30, 0xe3, 0x6d, 0x50, 0x4a, 0x72, 0x7f, 0x1b, 0x8b, 0x76, 0xec,
+  0xcc, 0xa8, 0x66, 0x5f, 0x06, 0xe6, 0xaf, 0x38, 0xa8, 0x57, 0xfb, 0x6b,
+  0x04, 0xfa, 0xaa, 0x99, 0x63, 0x1c, 0x2f, 0x17, 0x4d, 0x87, 0x91, 0x88,
+  0xa8, 0x0c, 0x38, 0xf0, 0x80, 0xf3, 0x12, 0x00, 0x5d, 0x8b, 0x1a, 0x9d,
+  0x48, 0x43, 0x7c, 0x1a, 0x2b, 0x8e, 0xdb, 0x49, 0x60, 0x8d, 0xbb, 0x7b,
+  0x1f, 0xe7, 0x9d, 0xeb, 0xfa, 0x06, 0xa5, 0x47, 0xd3, 0x82, 0x2c, 0xd2,
+  0x88, 0x31, 0x16, 0xd9, 0x0a, 0x0b, 0x45, 0x62, 0x1f, 0x20, 0xf8, 0x8f,
+  0x5e, 0xfd, 0x23, 0xd2, 0x39, 0xb4, 0xf0, 0xfa, 0x6f, 0x62, 0x4a, 0xd0,
+  0xf2, 0x3a, 0x39, 0x13, 0x42, 0x35, 0x23, 0xbf, 0xf2, 0x76, 0x2f, 0x6f,
+  0xc8, 0xea, 0xc4, 0x8d, 0x41, 0xfb, 0x56, 0xee, 0x2d, 0x94, 0xb1, 0x92,
+  0x44, 0x8f, 0xcf, 0x77, 0xe0, 0xdb, 0xaf, 0x8f, 0x3d, 0x1b, 0xdb, 0x00,
+  0xf0, 0xff, 0xc7, 0x2b, 0x3b, 0x79, 0x27, 0x25, 0xde, 0xff, 0x24, 0x9c,
+  0xf9, 0xfe, 0xca, 0x07, 0xd6, 0xf1, 0xb1, 0x2f, 0xb1, 0x50, 0x9e, 0x16,
+  0x83, 0xd3, 0xf0, 0x55, 0x5b, 0xe0, 0x70, 0xa8, 0x6d, 0x50, 0xe3, 0x15,
+  0x11, 0xb3, 0x5f, 0x56, 0x09, 0x6f, 0x75, 0xb4, 0x05, 0xf0, 0xd8, 0x96,
+  0x06, 0x3a, 0xd6, 0xfa, 0x2f, 0x0d, 0xb2, 0xc0, 0xfe, 0x9e, 0xf4, 0x9e,
+  0x12, 0x5a, 0xb5, 0x7a, 0x9f, 0x7e, 0xb6, 0xfa, 0xad, 0x96, 0x67, 0x47,
+  0xfa, 0xcc, 0x36, 0x5c, 0x0d, 0x58, 0x63, 0xb4, 0xa3, 0xc9, 0x0b, 0x51,
+  0x64, 0x24, 0x02, 0xe3, 0x61, 0xb1, 0xcb, 0xb4, 0x6f, 0xcb, 0x26, 0x3a,
+  0x7f, 0xe2, 0x21, 0xbd, 0x2b, 0xec, 0x23, 0x3b, 0xd0, 0xcb, 0x57, 0x36,
+  0xb0, 0x74, 0xe5, 0x90, 0x60, 0x74, 0xae, 0x36, 0x3d, 0x47, 0xbd, 0xf1,
+  0x76, 0x6b, 0xce, 0xe2, 0xe9, 0x5f, 0xac, 0xab, 0xd3, 0xb5, 0x6e, 0x41,
+  0x6c, 0x9f, 0x5f, 0xb5, 0xc2, 0x4f, 0x70, 0x9d, 0x52, 0x2e, 0x1a, 0xdb,
+  0x28, 0xbe, 0xf5, 0x12, 0xd8, 0xb7, 0x49, 0xee, 0x2e, 0x61, 0x54, 0xca,
+  0xe0, 0x05, 0x0d, 0x8d, 0x02, 0x7a, 0x85, 0x62, 0x14, 0x9e, 0x57, 0x02,
+  0xc5, 0x71, 0xfd, 0x41, 0x65, 0x0c, 0xd5, 0x94, 0xed, 0xed, 0x90, 0x35,
+  0x4b, 0x11, 0xb2, 0xe3, 0x92, 0xe4, 0xd2, 0x4e, 0xa2, 0x44, 0x43, 0xc9,
+  0x15, 0x5c, 0xe5, 0x6a, 0xf8, 0xbf, 0xe3, 0x8d, 0x01, 0xf8, 0xef, 0xe4,
+  0x95, 0xbb, 0xad, 0x1d, 0x9d, 0x15, 0xb3, 0x8f, 0xbd, 0xea, 0x61, 0x4e,
+  0x62, 0x4d, 0x5c, 0x07, 0xa2, 0x7b, 0x74, 0xb8, 0x83, 0x6b, 0x97, 0xf2,
+  0xf3, 0xb9, 0xef, 0x12, 0x6c, 0x50, 0x1c, 0x38, 0x13, 0x61, 0xd0, 0x85,
+  0x64, 0x66, 0xb3, 0x3f, 0x8e, 0xb4, 0x85, 0xa5, 0xfc, 0x55, 0xf4, 0x5d,
+  0x3e, 0x8d, 0x4b, 0x35, 0x10, 0x08, 0xa8, 0x64, 0x6e, 0x7f, 0x57, 0x6c,
+  0xec, 0xf2, 0xbb, 0x3d, 0x75, 0x2e, 0x11, 0x82, 0xa1, 0x61, 0xb5, 0x90,
+  0xd7, 0x3e, 0x4a, 0x7e, 0xe9, 0x2b, 0x29, 0x9a, 0xd3, 0x3c, 0x00, 0xdc,
+  0x9e, 0x3e, 0x44, 0x0f, 0x1f, 0x52, 0x71, 0x14, 0x96, 0x6e, 0x8d, 0x70,
+  0xb3, 0x40, 0xba, 0x9b, 0xa2, 0xd2, 0x1c, 0xb1, 0xa5, 0x73, 0x26, 0x3e,
+  0x4f, 0x70, 0xab, 0x67, 0x4c, 0x7a, 0xf1, 0x7d, 0x55, 0xb0, 0x14, 0x8a,
+  0x9a, 0x2e, 0x9b, 0x14, 0x03, 0x4f, 0xed, 0x8a, 0xe8, 0x92, 0xae, 0x20,
+  0x22, 0x5c, 0x15, 0x9f, 0x88, 0x93, 0xd3, 0xd3, 0xb5, 0x8c, 0x09, 0xdf,
+  0x6c, 0xf4, 0x01, 0xc8, 0x60, 0xa5, 0x09, 0x07, 0xaa, 0x7a, 0x6f, 0x46,
+  0xa8, 0x63, 0xd8, 0x16, 0xb7, 0x73, 0x16, 0xc5, 0x06, 0x76, 0xed, 0x17,
+  0x35, 0x95, 0x40, 0x6d, 0xc9, 0x63, 0x51, 0xd5, 0x97, 0x38, 0xbf, 0xb4,
+  0xbe, 0x95, 0x25, 0x23, 0x03, 0x03, 0x4d, 0x58, 0xd4, 0x20, 0x2f, 0x70,
+  0xe2, 0xb1, 0x97, 0xc1, 0x49, 0x12, 0x47, 0x87, 0x2d, 0x7a, 0xc0, 0xf5,
+  0x3b, 0x15, 0x30, 0x1a, 0xcb, 0x29, 0xd9, 0xa6, 0x5c, 0x86, 0xd6, 0x72,
+  0x67, 0x23, 0x26, 0x60, 0xcc, 0xd0, 0xe5, 0x53, 0x48, 0x4d, 0x2c, 0xb4,
+  0x49, 0x03, 0xff, 0xe4, 0x95, 0x1c, 0xfe, 0xf8, 0x90, 0x2d, 0xd2, 0x4a,
+  0x5b, 0x8f, 0x2d, 0x6d, 0x26, 0x51, 0x08, 0x2d, 0x14, 0x88, 0x35, 0x6f,
+  0xf0, 0x91, 0xeb, 0x75, 0x30, 0xab, 0x8f, 0xfd, 0xa6, 0x47, 0x21, 0x80,
+  0x25, 0xa8, 0x4e, 0xca, 0x6d, 0xcd, 0xba, 0x96, 0x01, 0x13, 0xdf, 0x67,
+  0x7c, 0x24, 0xdc, 0x9a, 0x10, 0xf3, 0x95, 0xf4, 0x5d, 0x1b, 0xf5, 0x80,
+  0x03, 0xb1, 0xe6, 0x9c, 0xba, 0xbf, 0x67, 0xa9, 0x84, 0xfd, 0xe2, 0x71,
+  0x8b, 0xe6, 0x3a, 0x21, 0x0b, 0xf4, 0x46, 0x02, 0xe1, 0x12, 0xb5, 0xe7,
+  0x31, 0x3a, 0x8c, 0xcb, 0x19, 0x7b, 0xef, 0x0f, 0xa4, 0x53, 0x26, 0x1c,
+  0x65, 0x5f, 0xca, 0x8d, 0xb4, 0x7f, 0x1b, 0x07, 0x57, 0x98, 0x65, 0x82,
+  0x97, 0x6a, 0x00, 0xfc, 0xee, 0x72, 0x96, 0x62, 0x24, 0x95, 0x50, 0xa0,
+  0x5a, 0x14, 0xad, 0x66, 0x9b, 0x73, 0xb6, 0xeb, 0x9b, 0x2d, 0xc3, 0x9d,
+  0x33, 0xa9, 0xb1, 0x0b, 0x04, 0x43, 0x26, 0x69, 0x6d, 0xbb, 0xff, 0xbb,
+  0x92, 0xe4, 0x42, 0x03, 0x58, 0x89, 0x17, 0x5a, 0xde, 0x10, 0x58, 0x56,
+  0x80, 0xb8, 0xf3, 0x6c, 0x54, 0x9f, 0xf3, 0xd5, 0x85, 0x43, 0xf6, 0x63,
+  0x1d, 0xce, 0x84, 0x75, 0x48, 0x14, 0xd4, 0xa5, 0x87, 0x16, 0xea, 0xcd,
+  0xe2, 0x66, 0x09, 0xe9, 0xc6, 0x7e, 0xb8, 0xc1, 0x60, 0x6a, 0x27, 0xd9,
+  0x59, 0x42, 0x87, 0xfc, 0xcd, 0xfd, 0x78, 0x50, 0x6a, 0x93, 0x94, 0xb3,
+  0xbe, 0x48, 0x50, 0xe1, 0x5c, 0x5b, 0x88, 0xce, 0x65, 0x1c, 0xf0, 0xde,
+  0x26, 0x96, 0x1f, 0x9b, 0x3e, 0x8f, 0xb9, 0x23, 0xca, 0x2b, 0xfb, 0x7f,
+  0xf8, 0x40, 0x12, 0x47, 0xb3, 0xde, 0x9c, 0xc7, 0xc5, 0xf4, 0xfd, 0x6b,
+  0xa6, 0x34, 0xef, 0x22, 0x7b, 0xb0, 0xc9, 0x36, 0x22, 0xa3, 0xce, 0x3d,
+  0xbc, 0x9c, 0x77, 0xc5, 0xd9, 0x2b, 0x1e, 0xaa, 0x84, 0xbb, 0xaf, 0xb2,
+  0xa9, 0x0a, 0xbd, 0x5f, 0x9b, 0xbf, 0x48, 0xa4, 0x5e, 0x33, 0x00, 0x00,
+  0x0b, 0x00, 0x13, 0x00, 0x00, 0x00, 0x46, 0x00, 0x8a, 0x00, 0xcf, 0x00,
+  0xd9, 0x00, 0xe3, 0x00, 0xec, 0x00, 0xf7, 0x00, 0x00, 0x01, 0x09, 0x01,
+  0x1a, 0x01, 0x00, 0x00, 0x46, 0x00, 0x8c, 0x00, 0xd0, 0x00, 0x14, 0x01,
+  0x59, 0x01, 0x9e, 0x01, 0xad, 0x01, 0xb5, 0x01, 0x00, 0x00, 0x09, 0x00,
+  0x14, 0x00, 0x1e, 0x00, 0x27, 0x00, 0x3c, 0x00, 0x47, 0x00, 0x4d, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x21, 0x00, 0x2b, 0x00, 0x34, 0x00,
+  0x3d, 0x00, 0x46, 0x00, 0x4d, 0x00, 0x57, 0x00, 0x5b, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x1d, 0x00, 0x26, 0x00, 0x37, 0x00, 0x3e, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x15, 0x00, 0x1e, 0x00, 0x2d, 0x00, 0x35, 0x00, 0x3f, 0x00,
+  0x47, 0x00, 0x4f, 0x00, 0x57, 0x00, 0x5f, 0x00, 0x67, 0x00, 0x76, 0x00,
+  0x84, 0x00, 0x92, 0x00, 0x9b, 0x00, 0xa4, 0x00, 0xac, 0x00, 0xb5, 0x00,
+  0xbe, 0x00, 0xc7, 0x00, 0xd0, 0x00, 0xd9, 0x00, 0xe3, 0x00, 0xf1, 0x00,
+  0xf7, 0x00, 0xff, 0x00, 0x07, 0x01, 0x17, 0x01, 0x1f, 0x01, 0x27, 0x01,
+  0x00, 0x00, 0x09, 0x00, 0x12, 0x00, 0x25, 0x00, 0x30, 0x00, 0x3c, 0x00,
+  0x48, 0x00, 0x51, 0x00, 0x5a, 0x00, 0x63, 0x00, 0x6c, 0x00, 0x75, 0x00,
+  0x7e, 0x00, 0x87, 0x00, 0x90, 0x00, 0x9b, 0x00, 0xa4, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x12, 0x00, 0x1f, 0x00, 0x31, 0x00, 0x45, 0x00, 0x4b, 0x00,
+  0x54, 0x00, 0x5c, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x77, 0x00, 0x89, 0x00,
+  0x92, 0x00, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x13, 0x00,
+  0x1b, 0x00, 0x23, 0x00, 0x32, 0x00, 0x3a, 0x00, 0x41, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x08, 0x00, 0x10, 0x00, 0x20, 0x00, 0x28, 0x00,
+  0x30, 0x00, 0x40, 0x00, 0x53, 0x00, 0x5b, 0x00, 0x6c, 0x00, 0x72, 0x00,
+  0x84, 0x00, 0x8c, 0x00, 0x94, 0x00, 0x9d, 0x00, 0xac, 0x00, 0xb4, 0x00,
+  0x00, 0x00, 0x0a, 0x00, 0x14, 0x00, 0x1e, 0x00, 0x27, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x1b, 0x00, 0x21, 0x00, 0x29, 0x00, 0x31, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x09, 0x00, 0x11, 0x00, 0x19, 0x00, 0x21, 0x00,
+  0x29, 0x00, 0x31, 0x00, 0x48, 0x00, 0x50, 0x00, 0x59, 0x00, 0x61, 0x00,
+  0x6d, 0x00, 0x75, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x07, 0x00, 0x11, 0x00,
+  0x00, 0x00, 0x08, 0x00, 0x26, 0x00, 0x2f, 0x00, 0x38, 0x00, 0x43, 0x00,
+  0x54, 0x00, 0x65, 0x00, 0x70, 0x00, 0x79, 0x00, 0x84, 0x00, 0x8d, 0x00,
+  0x95, 0x00, 0x9d, 0x00, 0xa8, 0x00, 0xb3, 0x00, 0xbe, 0x00, 0xc6, 0x00,
+  0xd1, 0x00, 0xe1, 0x00, 0xe9, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x15, 0x00,
+  0x1e, 0x00, 0x2e, 0x00, 0x37, 0x00, 0x40, 0x00, 0x49, 0x00, 0x52, 0x00,
+  0x58, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x20, 0x00, 0x32, 0x00, 0x45, 0x00,
+  0x56, 0x00, 0x5d, 0x00, 0x62, 0x00, 0x6c, 0x00, 0x74, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x14, 0x00, 0x1e, 0x00, 0x27, 0x00, 0x30, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x1c, 0x00, 0x22, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x0d, 0x00,
+  0x1a, 0x00, 0x26, 0x00, 0x32, 0x00, 0x3b, 0x00, 0x47, 0x00, 0x50, 0x00,
+  0x68, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1a, 0x00, 0x23, 0x00, 0x2c, 0x00,
+  0x35, 0x00, 0x3e, 0x00, 0x4a, 0x00, 0x5b, 0x00, 0x64, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x14, 0x00, 0x24, 0x00, 0x2f, 0x00, 0x39, 0x00, 0x4c, 0x00,
+  0x55, 0x00, 0x69, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x1a, 0x00, 0x29, 0x00,
+  0x30, 0x00, 0x37, 0x00, 0x3e, 0x00, 0x45, 0x00, 0x00, 0x00, 0x36, 0x00,
+  0x3f, 0x00, 0x48, 0x00, 0x51, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x36, 0x00,
+  0x40, 0x00, 0x49, 0x00, 0x56, 0x00, 0x6c, 0x00, 0x72, 0x00, 0x7b, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x2b, 0x00, 0x44, 0x00, 0x5c, 0x00,
+  0x73, 0x00, 0x87, 0x00, 0x90, 0x00, 0x99, 0x00, 0xa2, 0x00, 0xab, 0x00,
+  0xb5, 0x00, 0xbe, 0x00, 0xc7, 0x00, 0xd0, 0x00, 0xd9, 0x00, 0xe2, 0x00,
+  0xeb, 0x00, 0xf4, 0x00, 0xfd, 0x00, 0x06, 0x01, 0x0f, 0x01, 0x18, 0x01,
+  0x21, 0x01, 0x2a, 0x01, 0x33, 0x01, 0x3d, 0x01, 0x47, 0x01, 0x56, 0x01,
+  0x5e, 0x01, 0x67, 0x01, 0x70, 0x01, 0x79, 0x01, 0x82, 0x01, 0x90, 0x01,
+  0x9a, 0x01, 0xa1, 0x01, 0xa8, 0x01, 0xae, 0x01, 0xb8, 0x01, 0xbf, 0x01,
+  0xc9, 0x01, 0xd3, 0x01, 0xdb, 0x01, 0xe3, 0x01, 0xe9, 0x01, 0xf0, 0x01,
+  0x00, 0x00, 0x0a, 0x00, 0x14, 0x00, 0x1e, 0x00, 0x28, 0x00, 0x32, 0x00,
+  0x3c, 0x00, 0x4a, 0x00, 0x55, 0x00, 0x66, 0x00, 0x00, 0x00, 0x08, 0x00,
+  0x10, 0x00, 0x1b, 0x00, 0x23, 0x00, 0x2c, 0x00, 0x37, 0x00, 0x3f, 0x00,
+  0x50, 0x00, 0x58, 0x00, 0x64, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x14, 0x00, 0x1d, 0x00, 0x26, 0x00, 0x2f, 0x00, 0x39, 0x00,
+  0x42, 0x00, 0x4b, 0x00, 0x54, 0x00, 0x5d, 0x00, 0x66, 0x00, 0x70, 0x00,
+  0x79, 0x00, 0x82, 0x00, 0x8c, 0x00, 0x95, 0x00, 0x9e, 0x00, 0xa7, 0x00,
+  0xb0, 0x00, 0xb9, 0x00, 0xc2, 0x00, 0xcb, 0x00, 0xd4, 0x00, 0xdd, 0x00,
+  0xe6, 0x00, 0xef, 0x00, 0xf7, 0x00, 0x00, 0x01, 0x09, 0x01, 0x14, 0x01,
+  0x1c, 0x01, 0x24, 0x01, 0x35, 0x01, 0x3d, 0x01, 0x45, 0x01, 0x4e, 0x01,
+  0x56, 0x01, 0x5e, 0x01, 0x66, 0x01, 0x75, 0x01, 0x7d, 0x01, 0x00, 0x00,
+  0x11, 0x00, 0x1a, 0x00, 0x23, 0x00, 0x2c, 0x00, 0x35, 0x00, 0x48, 0x00,
+  0x5a, 0x00, 0x60, 0x00, 0x6f, 0x00, 0x7c, 0x00, 0x85, 0x00, 0x8e, 0x00,
+  0x00, 0x00, 0x32, 0x00, 0x39, 0x00, 0x4a, 0x00, 0x55, 0x00, 0x5b, 0x00,
+  0x67, 0x00, 0x81, 0x00, 0x8a, 0x00, 0x90, 0x00, 0x00, 0x00, 0x0a, 0x00,
+  0x13, 0x00, 0x1c, 0x00, 0x2a, 0x00, 0x39, 0x00, 0x43, 0x00, 0x4c, 0x00,
+  0x00, 0x00, 0x08, 0x00, 0x14, 0x00, 0x23, 0x00, 0x2c, 0x00, 0x34, 0x00,
+  0x3f, 0x00, 0x4a, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x23, 0x00, 0x30, 0x00,
+  0x4a, 0x00, 0x5b, 0x00, 0x6e, 0x00, 0x7a, 0x00, 0x91, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x12, 0x00, 0x1c, 0x00, 0x23, 0x00, 0x31, 0x00, 0x38, 0x00,
+  0x46, 0x00, 0x4c, 0x00, 0x55, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x12, 0x00,
+  0x1c, 0x00, 0x25, 0x00, 0x2f, 0x00, 0x39, 0x00, 0x40, 0x00, 0x4b, 0x00,
+  0x00, 0x00, 0x07, 0x00, 0x12, 0x00, 0x22, 0x00, 0x2b, 0x00, 0x36, 0x00,
+  0x40, 0x00, 0x4a, 0x00, 0x56, 0x00, 0x00, 0x00, 0x39, 0x00, 0x42, 0x00,
+  0x4b, 0x00, 0x54, 0x00, 0x5d, 0x00, 0x66, 0x00, 0x73, 0x00, 0x00, 0x00,
+  0x24, 0x00, 0x48, 0x00, 0x67, 0x00, 0x75, 0x00, 0x7c, 0x00, 0x84, 0x00,
+  0x8c, 0x00, 0x94, 0x00, 0xa2, 0x00, 0xab, 0x00, 0xb4, 0x00, 0xbb, 0x00,
+  0xc6, 0x00, 0xcd, 0x00, 0xd6, 0x00, 0x00, 0x00, 0x21, 0x00, 0x32, 0x00,
+  0x3b, 0x00, 0x44, 0x00, 0x4d, 0x00, 0x56, 0x00, 0x60, 0x00, 0x69, 0x00,
+  0x72, 0x00, 0x7b, 0x00, 0x84, 0x00, 0x8d, 0x00, 0x96, 0x00, 0x9f, 0x00,
+  0xa8, 0x00, 0xb1, 0x00, 0xba, 0x00, 0xc3, 0x00, 0xcc, 0x00, 0xd5, 0x00,
+  0xde, 0x00, 0xe7, 0x00, 0xf0, 0x00, 0xf9, 0x00, 0x02, 0x01, 0x0b, 0x01,
+  0x14, 0x01, 0x1d, 0x01, 0x26, 0x01, 0x37, 0x01, 0x48, 0x01, 0x51, 0x01,
+  0x5a, 0x01, 0x63, 0x01, 0x6c, 0x01, 0x7e, 0x01, 0x87, 0x01, 0x90, 0x01,
+  0x99, 0x01, 0xa2, 0x01, 0xab, 0x01, 0xb4, 0x01, 0xbd, 0x01, 0xc6, 0x01,
+  0xcf, 0x01, 0xd8, 0x01, 0xe1, 0x01, 0xea, 0x01, 0xf3, 0x01, 0x04, 0x02,
+  0x15, 0x02, 0x1e, 0x02, 0x27, 0x02, 0x30, 0x02, 0x37, 0x02, 0x41, 0x02,
+  0x4a, 0x02, 0x53, 0x02, 0x64, 0x02, 0x7b, 0x02, 0x84, 0x02, 0x8d, 0x02,
+  0xa5, 0x02, 0xad, 0x02, 0xb4, 0x02, 0xbd, 0x02, 0xc7, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x13, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x09, 0x00, 0x12, 0x00,
+  0x1b, 0x00, 0x23, 0x00, 0x2d, 0x00, 0x59, 0x00, 0x68, 0x00, 0x70, 0x00,
+  0x78, 0x00, 0x81, 0x00, 0x8b, 0x00, 0x94, 0x00, 0x9c, 0x00, 0x00, 0x00,
+  0x1a, 0x00, 0x27, 0x00, 0x2e, 0x00, 0x44, 0x00, 0x4d, 0x00, 0x60, 0x00,
+  0x00, 0x00, 0x0a, 0x00, 0x14, 0x00, 0x1d, 0x00, 0x26, 0x00, 0x2f, 0x00,
+  0x38, 0x00, 0x42, 0x00, 0x4b, 0x00, 0x54, 0x00, 0x5d, 0x00, 0x66, 0x00,
+  0x6f, 0x00, 0x78, 0x00, 0x81, 0x00, 0x8a, 0x00, 0x93, 0x00, 0x9e, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x13, 0x00, 0x20, 0x00,
+  0x28, 0x00, 0x31, 0x00, 0x38, 0x00, 0x41, 0x00, 0x4d, 0x00, 0x54, 0x00,
+  0x5e, 0x00, 0x66, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x18, 0x00, 0x24, 0x00,
+  0x30, 0x00, 0x3c, 0x00, 0x48, 0x00, 0x54, 0x00, 0x60, 0x00, 0x6c, 0x00,
+  0x78, 0x00, 0x84, 0x00, 0x90, 0x00, 0x9c, 0x00, 0xa8, 0x00, 0xb5, 0x00,
+  0xbe, 0x00, 0xc7, 0x00, 0xd1, 0x00, 0xdb, 0x00, 0x00, 0x00, 0x13, 0x00,
+  0x28, 0x00, 0x00, 0x00, 0x12, 0x00, 0x25, 0x00, 0x2e, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x12, 0x00, 0x25, 0x00, 0x38, 0x00, 0x41, 0x00, 0x53, 0x00,
+  0x65, 0x00, 0x6e, 0x00, 0x81, 0x00, 0x94, 0x00, 0x9c, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x1c, 0x00, 0x26, 0x00, 0x32, 0x00, 0x00, 0x00, 0x1d, 0x00,
+  0x31, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x1d, 0x00, 0x23, 0x00, 0x2c, 0x00, 0x33, 0x00, 0x38, 0x00, 0x44, 0x00,
+  0x4d, 0x00, 0x56, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x12, 0x00, 0x1b, 0x00, 0x24, 0x00, 0x2d, 0x00, 0x36, 0x00, 0x3f, 0x00,
+  0x48, 0x00, 0x51, 0x00, 0x5a, 0x00, 0x63, 0x00, 0x6c, 0x00, 0x75, 0x00,
+  0x7e, 0x00, 0x87, 0x00, 0x90, 0x00, 0x99, 0x00, 0xa2, 0x00, 0xab, 0x00,
+  0xb4, 0x00, 0xc6, 0x00, 0xcf, 0x00, 0xd8, 0x00, 0xe1, 0x00, 0xea, 0x00,
+  0xf3, 0x00, 0x01, 0x01, 0x0a, 0x01, 0x13, 0x01, 0x2d, 0x01, 0x35, 0x01,
+  0x00, 0x00, 0x0a, 0x00, 0x14, 0x00, 0x1e, 0x00, 0x28, 0x00, 0x33, 0x00,
+  0x3c, 0x00, 0x46, 0x00, 0x50, 0x00, 0x5a, 0x00, 0x64, 0x00, 0x6d, 0x00,
+  0x73, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x14, 0x00, 0x1c, 0x00, 0x27, 0x00,
+  0x30, 0x00, 0x3b, 0x00, 0x46, 0x00, 0x4f, 0x00, 0x5a, 0x00, 0x62, 0x00,
+  0x6d, 0x00, 0x84, 0x00, 0x91, 0x00, 0x97, 0x00, 0x9e, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x2d, 0x00, 0x36, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x17, 0x00,
+  0x25, 0x00, 0x32, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x14, 0x00,
+  0x21, 0x00, 0x2b, 0x00, 0x35, 0x00, 0x3f, 0x00, 0x49, 0x00, 0x52, 0x00,
+  0x63, 0x00, 0x74, 0x00, 0x7d, 0x00, 0x87, 0x00, 0x90, 0x00, 0x9b, 0x00,
+  0xa4, 0x00, 0x00, 0x00, 0x18, 0x00, 0x22, 0x00, 0x2b, 0x00, 0x3e, 0x00,
+  0x44, 0x00, 0x4d, 0x00, 0x56, 0x00, 0x5f, 0x00, 0x68, 0x00, 0x6e, 0x00,
+  0x77, 0x00, 0x00, 0x00, 0x07, 0x00, 0x0e, 0x00, 0x15, 0x00, 0x1c, 0x00,
+  0x00, 0x00, 0x1c, 0x00, 0x27, 0x00, 0x32, 0x00, 0x38, 0x00, 0x43, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x1e, 0x00, 0x28, 0x00, 0x00, 0x00, 0x07, 0x00,
+  0x0e, 0x00, 0x19, 0x00, 0x3e, 0x00, 0x62, 0x00, 0x93, 0x00, 0xb7, 0x00,
+  0xc0, 0x00, 0xc8, 0x00, 0xdd, 0x00, 0xe4, 0x00, 0xed, 0x00, 0xf6, 0x00,
+  0xfc, 0x00, 0x02, 0x01, 0x0b, 0x01, 0x00, 0x00, 0x23, 0x00, 0x47, 0x00,
+  0x68, 0x00, 0x86, 0x00, 0x9e, 0x00, 0xb6, 0x00, 0xca, 0x00, 0xe3, 0x00,
+  0xea, 0x00, 0xf4, 0x00, 0xff, 0x00, 0x09, 0x01, 0x0f, 0x01, 0x19, 0x01,
+  0x00, 0x00, 0x0b, 0x00, 0x16, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x22, 0x00,
+  0x45, 0x00, 0x65, 0x00, 0x82, 0x00, 0x99, 0x00, 0xb0, 0x00, 0xc6, 0x00,
+  0xd3, 0x00, 0xdd, 0x00, 0xe7, 0x00, 0xee, 0x00, 0x00, 0x01, 0x0d, 0x01,
+  0x2b, 0x01, 0x3c, 0x01, 0x4e, 0x01, 0x57, 0x01, 0x00, 0x00, 0x07, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x12, 0x00, 0x1b, 0x00, 0x24, 0x00, 0x2d, 0x00,
+  0x36, 0x00, 0x3f, 0x00, 0x48, 0x00, 0x52, 0x00, 0x5b, 0x00, 0x64, 0x00,
+  0x6d, 0x00, 0x76, 0x00, 0x7f, 0x00, 0x8a, 0x00, 0x93, 0x00, 0x9c, 0x00,
+  0xa5, 0x00, 0xae, 0x00, 0xba, 0x00, 0xc3, 0x00, 0xcc, 0x00, 0xd7, 0x00,
+  0xe0, 0x00, 0xea, 0x00, 0xf3, 0x00, 0xfc, 0x00, 0x06, 0x01, 0x0f, 0x01,
+  0x18, 0x01, 0x22, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x46, 0x01, 0x4f, 0x01,
+  0x58, 0x01, 0x61, 0x01, 0x6a, 0x01, 0x73, 0x01, 0x7c, 0x01, 0x8d, 0x01,
+  0x96, 0x01, 0x9f, 0x01, 0xa8, 0x01, 0xb1, 0x01, 0xba, 0x01, 0xc3, 0x01,
+  0xcc, 0x01, 0xd5, 0x01, 0xde, 0x01, 0xe7, 0x01, 0xf0, 0x01, 0xf9, 0x01,
+  0x02, 0x02, 0x0b, 0x02, 0x14, 0x02, 0x1d, 0x02, 0x26, 0x02, 0x2f, 0x02,
+  0x38, 0x02, 0x41, 0x02, 0x4a, 0x02, 0x53, 0x02, 0x5c, 0x02, 0x65, 0x02,
+  0x6e, 0x02, 0x77, 0x02, 0x81, 0x02, 0x92, 0x02, 0x9b, 0x02, 0xa4, 0x02,
+  0xad, 0x02, 0xb6, 0x02, 0xbf, 0x02, 0xc8, 0x02, 0xda, 0x02, 0xe6, 0x02,
+  0xef, 0x02, 0xf8, 0x02, 0x01, 0x03, 0x0a, 0x03, 0x13, 0x03, 0x1c, 0x03,
+  0x25, 0x03, 0x2e, 0x03, 0x37, 0x03, 0x40, 0x03, 0x49, 0x03, 0x5a, 0x03,
+  0x63, 0x03, 0x6c, 0x03, 0x75, 0x03, 0x7e, 0x03, 0x87, 0x03, 0x90, 0x03,
+  0x99, 0x03, 0xa2, 0x03, 0xab, 0x03, 0xb4, 0x03, 0xbf, 0x03, 0xc5, 0x03,
+  0xe0, 0x03, 0xe8, 0x03, 0xf4, 0x03, 0xfc, 0x03, 0x07, 0x04, 0x13, 0x04,
+  0x1e, 0x04, 0x25, 0x04, 0x2e, 0x04, 0x00, 0x00, 0x1e, 0x00, 0x24, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x07, 0x00, 0x16, 0x00, 0x1d, 0x00,
+  0x24, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x2b, 0x00, 0x40, 0x00, 0x49, 0x00,
+  0x5a, 0x00, 0x63, 0x00, 0x6a, 0x00, 0x73, 0x00, 0x7a, 0x00, 0x83, 0x00,
+  0x91, 0x00, 0x9c, 0x00, 0xa3, 0x00, 0xac, 0x00, 0xbd, 0x00, 0xc7, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x18, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x0a, 0x00,
+  0x14, 0x00, 0x1e, 0x00, 0x28, 0x00, 0x32, 0x00, 0x3d, 0x00, 0x47, 0x00,
+  0x50, 0x00, 0x5a, 0x00, 0x64, 0x00, 0x6e, 0x00, 0x78, 0x00, 0x81, 0x00,
+  0x8b, 0x00, 0x95, 0x00, 0x9b, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x10, 0x00, 0x19, 0x00, 0x20, 0x00, 0x2a, 0x00, 0x36, 0x00, 0x3d, 0x00,
+  0x44, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x09, 0x00, 0x18, 0x00, 0x24, 0x00,
+  0x2c, 0x00, 0x35, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x2e, 0x00, 0x34, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x1f, 0x00,
+  0x47, 0x00, 0x5f, 0x00, 0x8c, 0x00, 0xa8, 0x00, 0xc2, 0x00, 0xd7, 0x00,
+  0xe2, 0x00, 0xec, 0x00, 0xfd, 0x00, 0x08, 0x01, 0x12, 0x01, 0x1c, 0x01,
+  0x26, 0x01, 0x31, 0x01, 0x00, 0x00, 0x2d, 0x00, 0x37, 0x00, 0x50, 0x00,
+  0x5b, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x45, 0x00, 0x5c, 0x00, 0x88, 0x00,
+  0xa3, 0x00, 0xb8, 0x00, 0xd2, 0x00, 0xdb, 0x00, 0xf0, 0x00, 0x00, 0x00,
+  0x1f, 0x00, 0x29, 0x00, 0x38, 0x00, 0x46, 0x00, 0x59, 0x00, 0x67, 0x00,
+  0x6e, 0x00, 0x7a, 0x00, 0x81, 0x00, 0x00, 0x00, 0x21, 0x00, 0x28, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x14, 0x00, 0x1e, 0x00, 0x28, 0x00,
+  0x32, 0x00, 0x3c, 0x00, 0x46, 0x00, 0x50, 0x00, 0x5a, 0x00, 0x64, 0x00,
+  0x6e, 0x00, 0x78, 0x00, 0x82, 0x00, 0x8c, 0x00, 0x96, 0x00, 0xa0, 0x00,
+  0xaa, 0x00, 0xb3, 0x00, 0xbc, 0x00, 0xc5, 0x00, 0x00, 0x00, 0x0b, 0x00,
+  0x16, 0x00, 0x22, 0x00, 0x2e, 0x00, 0x39, 0x00, 0x45, 0x00, 0x50, 0x00,
+  0x5d, 0x00, 0x68, 0x00, 0x73, 0x00, 0x7e, 0x00, 0x89, 0x00, 0x94, 0x00,
+  0x9f, 0x00, 0xaa, 0x00, 0xb5, 0x00, 0xc2, 0x00, 0xca, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x1a, 0x00, 0x23, 0x00, 0x29, 0x00, 0x44, 0x00, 0x55, 0x00,
+  0x67, 0x00, 0x6e, 0x00, 0x77, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x0f, 0x00,
+  0x17, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x14, 0x00, 0x1d, 0x00, 0x27, 0x00,
+  0x31, 0x00, 0x3b, 0x00, 0x45, 0x00, 0x4f, 0x00, 0x58, 0x00, 0x61, 0x00,
+  0x6a, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x14, 0x00, 0x20, 0x00, 0x26, 0x00,
+  0x00, 0x00, 0x13, 0x00, 0x20, 0x00, 0x32, 0x00, 0x39, 0x00, 0x40, 0x00,
+  0x47, 0x00, 0x4f, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x13, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x25, 0x00, 0x36, 0x00, 0x45, 0x00, 0x58, 0x00, 0x60, 0x00,
+  0x69, 0x00, 0x70, 0x00, 0x79, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x27, 0x00,
+  0x2f, 0x00, 0x35, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x3d, 0x00, 0x5c, 0x00,
+  0x88, 0x00, 0xa1, 0x00, 0xbc, 0x00, 0xd4, 0x00, 0xf2, 0x00, 0xfd, 0x00,
+  0x0b, 0x01, 0x17, 0x01, 0x20, 0x01, 0x32, 0x01, 0x3f, 0x01, 0x48, 0x01,
+  0x51, 0x01, 0x58, 0x01, 0x00, 0x00, 0x22, 0x00, 0x41, 0x00, 0x4c, 0x00,
+  0x65, 0x00, 0x6b, 0x00, 0x76, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x3b, 0x00,
+  0x59, 0x00, 0x86, 0x00, 0x9e, 0x00, 0xbe, 0x00, 0xdb, 0x00, 0xfb, 0x00,
+  0x06, 0x01, 0x0f, 0x01, 0x18, 0x01, 0x21, 0x01, 0x2a, 0x01, 0x46, 0x01,
+  0x5b, 0x01, 0x74, 0x01, 0x7f, 0x01, 0x88, 0x01, 0x90, 0x01, 0x99, 0x01,
+  0xa0, 0x01, 0xa7, 0x01, 0xb0, 0x01, 0xb9, 0x01, 0xc2, 0x01, 0xd5, 0x01,
+  0x00, 0x00, 0x1f, 0x00, 0x3c, 0x00, 0x57, 0x00, 0x5d, 0x00, 0x63, 0x00,
+  0x6c, 0x00, 0x75, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x27, 0x00, 0x30, 0x00,
+  0x3a, 0x00, 0x43, 0x00, 0x4c, 0x00, 0x5c, 0x00, 0x65, 0x00, 0x6e, 0x00,
+  0x78, 0x00, 0x81, 0x00, 0x8a, 0x00, 0x93, 0x00, 0x9c, 0x00, 0xa5, 0x00,
+  0xae, 0x00, 0xb7, 0x00, 0xc0, 0x00, 0xc9, 0x00, 0xd2, 0x00, 0xdb, 0x00,
+  0xef, 0x00, 0x04, 0x01, 0x12, 0x01, 0x23, 0x01, 0x2d, 0x01, 0x38, 0x01,
+  0x40, 0x01, 0x49, 0x01, 0x00, 0x00, 0x1e, 0x00, 0x3b, 0x00, 0x58, 0x00,
+  0x65, 0x00, 0x75, 0x00, 0x00, 0x00, 0x22, 0x00, 0x3f, 0x00, 0x49, 0x00,
+  0x00, 0x00, 0x33, 0x00, 0x3c, 0x00, 0x46, 0x00, 0x4f, 0x00, 0x58, 0x00,
+  0x61, 0x00, 0x6c, 0x00, 0x75, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x3c, 0x00,
+  0x4a, 0x00, 0x52, 0x00, 0x00, 0x00, 0x20, 0x00, 0x29, 0x00, 0x32, 0x00,
+  0x44, 0x00, 0x4f, 0x00, 0x5b, 0x00, 0x66, 0x00, 0x00, 0x00, 0x2d, 0x00,
+  0x49, 0x00, 0x53, 0x00, 0x5d, 0x00, 0x66, 0x00, 0x6f, 0x00, 0x00, 0x00,
+  0x1a, 0x00, 0x42, 0x00, 0x4b, 0x00, 0x54, 0x00, 0x5d, 0x00, 0x66, 0x00,
+  0x7c, 0x00, 0x8f, 0x00, 0x98, 0x00, 0xa2, 0x00, 0xab, 0x00, 0xb3, 0x00,
+  0xbe, 0x00, 0xc7, 0x00, 0xd0, 0x00, 0xe6, 0x00, 0xf1, 0x00, 0xfa, 0x00,
+  0x0d, 0x01, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x27, 0x00, 0x36, 0x00,
+  0x3f, 0x00, 0x4f, 0x00, 0x66, 0x00, 0x7d, 0x00, 0x84, 0x00, 0x8f, 0x00,
+  0x9a, 0x00, 0xb0, 0x00, 0xb7, 0x00, 0xc2, 0x00, 0xcd, 0x00, 0x00, 0x00,
+  0x1a, 0x00, 0x3a, 0x00, 0x46, 0x00, 0x4f, 0x00, 0x58, 0x00, 0x64, 0x00,
+  0x70, 0x00, 0x00, 0x00, 0x20, 0x00, 0x44, 0x00, 0x56, 0x00, 0x69, 0x00,
+  0x74, 0x00, 0x85, 0x00, 0x8e, 0x00, 0x97, 0x00, 0xa0, 0x00, 0xa9, 0x00,
+  0x00, 0x00, 0x29, 0x00, 0x4c, 0x00, 0x66, 0x00, 0x89, 0x00, 0x94, 0x00,
+  0xa6, 0x00, 0xb0, 0x00, 0xba, 0x00, 0xc4, 0x00, 0xca, 0x00, 0xd9, 0x00,
+  0xef, 0x00, 0xfc, 0x00, 0x03, 0x01, 0x00, 0x00, 0x20, 0x00, 0x2b, 0x00,
+  0x32, 0x00, 0x3c, 0x00, 0x46, 0x00, 0x51, 0x00, 0x59, 0x00, 0x6e, 0x00,
+  0x74, 0x00, 0x00, 0x00, 0x28, 0x00, 0x4a, 0x00, 0x63, 0x00, 0x8d, 0x00,
+  0xa9, 0x00, 0xca, 0x00, 0xd3, 0x00, 0xde, 0x00, 0xe9, 0x00, 0xf7, 0x00,
+  0x0b, 0x01, 0x15, 0x01, 0x1f, 0x01, 0x26, 0x01, 0x32, 0x01, 0x3e, 0x01,
+  0x47, 0x01, 0x4e, 0x01, 0x00, 0x00, 0x1a, 0x00, 0x38, 0x00, 0x4d, 0x00,
+  0x55, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x3b, 0x00, 0x60, 0x00, 0x68, 0x00,
+  0x77, 0x00, 0x88, 0x00, 0x95, 0x00, 0x9e, 0x00, 0xa6, 0x00, 0xad, 0x00,
+  0xb6, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x4f, 0x00, 0x61, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x13, 0x00, 0x1d, 0x00, 0x27, 0x00, 0x31, 0x00, 0x3b, 0x00,
+  0x43, 0x00, 0x54, 0x00, 0x5e, 0x00, 0x68, 0x00, 0x71, 0x00, 0x7b, 0x00,
+  0x8a, 0x00, 0x92, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x16, 0x00, 0x22, 0x00,
+  0x2d, 0x00, 0x38, 0x00, 0x43, 0x00, 0x4e, 0x00, 0x59, 0x00, 0x64, 0x00,
+  0x6f, 0x00, 0x85, 0x00, 0x90, 0x00, 0x9b, 0x00, 0xa6, 0x00, 0xb1, 0x00,
+  0xbc, 0x00, 0xc5, 0x00, 0xcc, 0x00, 0xd7, 0x00, 0xe1, 0x00, 0xec, 0x00,
+  0xf7, 0x00, 0x00, 0x01, 0x08, 0x01, 0x13, 0x01, 0x00, 0x00, 0x21, 0x00,
+  0x47, 0x00, 0x62, 0x00, 0x7f, 0x00, 0x99, 0x00, 0xaa, 0x00, 0xb3, 0x00,
+  0xc3, 0x00, 0xcc, 0x00, 0xd4, 0x00, 0xe5, 0x00, 0x00, 0x00, 0x1c, 0x00,
+  0x26, 0x00, 0x00, 0x00, 0x09, 0x00, 0x10, 0x00, 0x19, 0x00, 0x21, 0x00,
+  0x28, 0x00, 0x00, 0x00, 0x09, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x14, 0x00, 0x20, 0x00, 0x36, 0x00, 0x40, 0x00, 0x54, 0x00,
+  0x00, 0x00, 0x1c, 0x00, 0x38, 0x00, 0x45, 0x00, 0x52, 0x00, 0x59, 0x00,
+  0x63, 0x00, 0x6a, 0x00, 0x71, 0x00, 0x7d, 0x00, 0x85, 0x00, 0x00, 0x00,
+  0x22, 0x00, 0x2e, 0x00, 0x35, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x36, 0x00,
+  0x58, 0x00, 0x63, 0x00, 0x6e, 0x00, 0x76, 0x00, 0x7d, 0x00, 0x88, 0x00,
+  0x00, 0x00, 0x1e, 0x00, 0x3d, 0x00, 0x5d, 0x00, 0x76, 0x00, 0x80, 0x00,
+  0x8b, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x3a, 0x00, 0x57, 0x00, 0x5e, 0x00,
+  0x66, 0x00, 0x75, 0x00, 0x7e, 0x00, 0x87, 0x00, 0x00, 0x00, 0x27, 0x00,
+  0x53, 0x00, 0x71, 0x00, 0x7d, 0x00, 0x8e, 0x00, 0x97, 0x00, 0xa0, 0x00,
+  0x00, 0x00, 0x21, 0x00, 0x28, 0x00, 0x32, 0x00, 0x3a, 0x00, 0x44, 0x00,
+  0x00, 0x00, 0x1c, 0x00, 0x3d, 0x00, 0x5b, 0x00, 0x66, 0x00, 0x74, 0x00,
+  0x7e, 0x00, 0x85, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x38, 0x00, 0x41, 0x00,
+  0x49, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x24, 0x00, 0x2e, 0x00, 0x37, 0x00,
+  0x40, 0x00, 0x49, 0x00, 0x52, 0x00, 0x67, 0x00, 0x70, 0x00, 0x79, 0x00,
+  0x82, 0x00, 0x8b, 0x00, 0x94, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x08, 0x00,
+  0x18, 0x00, 0x1d, 0x00, 0x25, 0x00, 0x2b, 0x00, 0x32, 0x00, 0x00, 0x00,
+  0x1d, 0x00, 0x3b, 0x00, 0x58, 0x00, 0x7b, 0x00, 0x86, 0x00, 0x8f, 0x00,
+  0x98, 0x00, 0xa1, 0x00, 0xaa, 0x00, 0xb1, 0x00, 0xba, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x39, 0x00, 0x59, 0x00, 0x78, 0x00, 0x81, 0x00, 0x89, 0x00,
+  0x91, 0x00, 0x99, 0x00, 0xa1, 0x00, 0xa9, 0x00, 0xb2, 0x00, 0xba, 0x00,
+  0x00, 0x00, 0x1f, 0x00, 0x41, 0x00, 0x56, 0x00, 0x5c, 0x00, 0x65, 0x00,
+  0x78, 0x00, 0x81, 0x00, 0x8b, 0x00, 0x00, 0x00, 0x22, 0x00, 0x42, 0x00,
+  0x5e, 0x00, 0x69, 0x00, 0x6f, 0x00, 0x78, 0x00, 0x00, 0x00, 0x1d, 0x00,
+  0x3a, 0x00, 0x63, 0x00, 0x6d, 0x00, 0x74, 0x00, 0x7b, 0x00, 0x00, 0x00,
+  0x1f, 0x00, 0x3c, 0x00, 0x5e, 0x00, 0x6b, 0x00, 0x78, 0x00, 0x85, 0x00,
+  0x8f, 0x00, 0xa2, 0x00, 0x00, 0x00, 0x22, 0x00, 0x40, 0x00, 0x49, 0x00,
+  0x53, 0x00, 0x5c, 0x00, 0x65, 0x00, 0x77, 0x00, 0x81, 0x00, 0x93, 0x00,
+  0x9e, 0x00, 0xaf, 0x00, 0xb9, 0x00, 0xc2, 0x00, 0xcb, 0x00, 0xd4, 0x00,
+  0xe6, 0x00, 0xef, 0x00, 0x03, 0x01, 0x0c, 0x01, 0x12, 0x01, 0x18, 0x01,
+  0x21, 0x01, 0x2a, 0x01, 0x30, 0x01, 0x39, 0x01, 0x42, 0x01, 0x00, 0x00,
+  0x1e, 0x00, 0x3d, 0x00, 0x5b, 0x00, 0x64, 0x00, 0x6e, 0x00, 0x7a, 0x00,
+  0x83, 0x00, 0x8f, 0x00, 0x98, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x31, 0x00,
+  0x3c, 0x00, 0x48, 0x00, 0x55, 0x00, 0x5f, 0x00, 0x6e, 0x00, 0x7d, 0x00,
+  0x87, 0x00, 0x8e, 0x00, 0x94, 0x00, 0x9b, 0x00, 0xa7, 0x00, 0xae, 0x00,
+  0xb5, 0x00, 0xcb, 0x00, 0xd6, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x20, 0x00,
+  0x45, 0x00, 0x5e, 0x00, 0x6f, 0x00, 0x77, 0x00, 0x7e, 0x00, 0x84, 0x00,
+  0x8f, 0x00, 0x99, 0x00, 0xaa, 0x00, 0xb6, 0x00, 0x00, 0x00, 0x1b, 0x00,
+  0x30, 0x00, 0x39, 0x00, 0x45, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x3a, 0x00,
+  0x55, 0x00, 0x70, 0x00, 0x7d, 0x00, 0x86, 0x00, 0x91, 0x00, 0x9a, 0x00,
+  0xa2, 0x00, 0x00, 0x00, 0x25, 0x00, 0x48, 0x00, 0x4f, 0x00, 0x55, 0x00,
+  0x60, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x24, 0x00, 0x30, 0x00, 0x44, 0x00,
+  0x54, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x26, 0x00, 0x00, 0x00,
+  0x1f, 0x00, 0x43, 0x00, 0x60, 0x00, 0x84, 0x00, 0x8e, 0x00, 0x9d, 0x00,
+  0xa7, 0x00, 0xb0, 0x00, 0x00, 0x00, 0x24, 0x00, 0x2d, 0x00, 0x36, 0x00,
+  0x3f, 0x00, 0x48, 0x00, 0x51, 0x00, 0x5a, 0x00, 0x63, 0x00, 0x6c, 0x00,
+  0x76, 0x00, 0x7f, 0x00, 0x88, 0x00, 0x91, 0x00, 0xa3, 0x00, 0xac, 0x00,
+  0xb5, 0x00, 0xbe, 0x00, 0xc7, 0x00, 0xd0, 0x00, 0xd9, 0x00, 0xe2, 0x00,
+  0xec, 0x00, 0xf5, 0x00, 0xfe, 0x00, 0x07, 0x01, 0x10, 0x01, 0x1a, 0x01,
+  0x25, 0x01, 0x33, 0x01, 0x00, 0x00, 0x0a, 0x00, 0x13, 0x00, 0x1b, 0x00,
+  0x23, 0x00, 0x35, 0x00, 0x3e, 0x00, 0x44, 0x00, 0x00, 0x00, 0x04, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x15, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x21, 0x00,
+  0x2a, 0x00, 0x33, 0x00, 0x3c, 0x00, 0x45, 0x00, 0x4e, 0x00, 0x57, 0x00,
+  0x60, 0x00, 0x69, 0x00, 0x72, 0x00, 0x85, 0x00, 0x8e, 0x00, 0x98, 0x00,
+  0xa1, 0x00, 0xaa, 0x00, 0xb4, 0x00, 0xbd, 0x00, 0xc6, 0x00, 0xcf, 0x00,
+  0xd8, 0x00, 0xe1, 0x00, 0xea, 0x00, 0xf3, 0x00, 0xfc, 0x00, 0x0f, 0x01,
+  0x18, 0x01, 0x21, 0x01, 0x34, 0x01, 0x3d, 0x01, 0x46, 0x01, 0x4f, 0x01,
+  0x58, 0x01, 0x61, 0x01, 0x6f, 0x01, 0x7a, 0x01, 0x84, 0x01, 0x00, 0x00,
+  0x1a, 0x00, 0x38, 0x00, 0x54, 0x00, 0x5e, 0x00, 0x70, 0x00, 0x79, 0x00,
+  0x89, 0x00, 0x92, 0x00, 0x9c, 0x00, 0xa5, 0x00, 0xae, 0x00, 0xb7, 0x00,
+  0xc0, 0x00, 0xc9, 0x00, 0xd3, 0x00, 0xdc, 0x00, 0xe5, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x16, 0x00, 0x21, 0x00, 0x2c, 0x00, 0x37, 0x00, 0x42, 0x00,
+  0x4d, 0x00, 0x58, 0x00, 0x63, 0x00, 0x6e, 0x00, 0x79, 0x00, 0x8f, 0x00,
+  0x9a, 0x00, 0xa5, 0x00, 0xae, 0x00, 0xba, 0x00, 0xc5, 0x00, 0xd0, 0x00,
+  0xde, 0x00, 0xe9, 0x00, 0xf5, 0x00, 0x0a, 0x01, 0x16, 0x01, 0x25, 0x01,
+  0x2e, 0x01, 0x36, 0x01, 0x3f, 0x01, 0x48, 0x01, 0x00, 0x00, 0x0b, 0x00,
+  0x18, 0x00, 0x26, 0x00, 0x2f, 0x00, 0x3e, 0x00, 0x44, 0x00, 0x4b, 0x00,
+  0x54, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x2f, 0x00,
+  0x38, 0x00, 0x4b, 0x00, 0x56, 0x00, 0x5f, 0x00, 0x68, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x24, 0x00, 0x2e, 0x00, 0x36, 0x00, 0x3c, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x36, 0x00, 0x43, 0x00, 0x4b, 0x00, 0x56, 0x00, 0x68, 0x00,
+  0x72, 0x00, 0x85, 0x00, 0x93, 0x00, 0x9c, 0x00, 0x00, 0x00, 0x07, 0x00,
+  0x0d, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x3b, 0x00, 0x42, 0x00,
+  0x51, 0x00, 0x63, 0x00, 0x6a, 0x00, 0x73, 0x00, 0x00, 0x00, 0x1b, 0x00,
+  0x23, 0x00, 0x2f, 0x00, 0x38, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x1c, 0x00,
+  0x22, 0x00, 0x27, 0x00, 0x30, 0x00, 0x3b, 0x00, 0x44, 0x00, 0x00, 0x00,
+  0x1b, 0x00, 0x24, 0x00, 0x2d, 0x00, 0x36, 0x00, 0x3f, 0x00, 0x48, 0x00,
+  0x51, 0x00, 0x5a, 0x00, 0x63, 0x00, 0x6c, 0x00, 0x75, 0x00, 0x7e, 0x00,
+  0x8f, 0x00, 0x98, 0x00, 0xa1, 0x00, 0xaa, 0x00, 0xb3, 0x00, 0xbc, 0x00,
+  0xc5, 0x00, 0xce, 0x00, 0xd8, 0x00, 0xe1, 0x00, 0xec, 0x00, 0xf8, 0x00,
+  0x03, 0x01, 0x0e, 0x01, 0x19, 0x01, 0x24, 0x01, 0x00, 0x00, 0x0c, 0x00,
+  0x14, 0x00, 0x1a, 0x00, 0x22, 0x00, 0x28, 0x00, 0x2e, 0x00, 0x00, 0x00,
+  0x21, 0x00, 0x29, 0x00, 0x31, 0x00, 0x3c, 0x00, 0x52, 0x00, 0x5b, 0x00,
+  0x65, 0x00, 0x6d, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x24, 0x00, 0x2d, 0x00,
+  0x37, 0x00, 0x46, 0x00, 0x53, 0x00, 0x5c, 0x00, 0x66, 0x00, 0x6f, 0x00,
+  0x77, 0x00, 0x80, 0x00, 0x00, 0x00, 0x09, 0x00, 0x12, 0x00, 0x1b, 0x00,
+  0x24, 0x00, 0x2d, 0x00, 0x36, 0x00, 0x3f, 0x00, 0x48, 0x00, 0x52, 0x00,
+  0x5b, 0x00, 0x64, 0x00, 0x6d, 0x00, 0x76, 0x00, 0x7f, 0x00, 0x88, 0x00,
+  0x92, 0x00, 0x9b, 0x00, 0xa4, 0x00, 0xb0, 0x00, 0xb9, 0x00, 0xc2, 0x00,
+  0xcb, 0x00, 0xd4, 0x00, 0xdd, 0x00, 0xe6, 0x00, 0xf0, 0x00, 0xf9, 0x00,
+  0x02, 0x01, 0x0b, 0x01, 0x14, 0x01, 0x28, 0x01, 0x2f, 0x01, 0x36, 0x01,
+  0x42, 0x01, 0x59, 0x01, 0x5f, 0x01, 0x00, 0x00, 0x0d, 0x00, 0x1a, 0x00,
+  0x27, 0x00, 0x31, 0x00, 0x00, 0x00, 0x09, 0x00, 0x12, 0x00, 0x1b, 0x00,
+  0x25, 0x00, 0x2e, 0x00, 0x38, 0x00, 0x41, 0x00, 0x4a, 0x00, 0x54, 0x00,
+  0x5d, 0x00, 0x67, 0x00, 0x70, 0x00, 0x77, 0x00, 0x92, 0x00, 0x9b, 0x00,
+  0xa4, 0x00, 0xad, 0x00, 0xb6, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1a, 0x00,
+  0x2c, 0x00, 0x37, 0x00, 0x4a, 0x00, 0x56, 0x00, 0x61, 0x00, 0x6b, 0x00,
+  0x77, 0x00, 0x81, 0x00, 0x00, 0x00, 0x08, 0x00, 0x22, 0x00, 0x2a, 0x00,
+  0x34, 0x00, 0x3d, 0x00, 0x44, 0x00, 0x00, 0x00, 0x09, 0x00, 0x11, 0x00,
+  0x21, 0x00, 0x30, 0x00, 0x38, 0x00, 0x40, 0x00, 0x4a, 0x00, 0x53, 0x00,
+  0x5b, 0x00, 0x64, 0x00, 0x6d, 0x00, 0x76, 0x00, 0x7e, 0x00, 0x86, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x18, 0x00, 0x21, 0x00, 0x28, 0x00, 0x31, 0x00,
+  0x3a, 0x00, 0x41, 0x00, 0x00, 0x00, 0x09, 0x00, 0x11, 0x00, 0x1b, 0x00,
+  0x22, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x2a, 0x00, 0x41, 0x00, 0x4b, 0x00,
+  0x56, 0x00, 0x62, 0x00, 0x6d, 0x00, 0x78, 0x00, 0x8c, 0x00, 0x9f, 0x00,
+  0x00, 0x00, 0x08, 0x00, 0x18, 0x00, 0x00, 0x00, 0x13, 0x00, 0x25, 0x00,
+  0x2e, 0x00, 0x35, 0x00, 0x00, 0x00, 0x09, 0x00, 0x11, 0x00, 0x18, 0x00,
+  0x1f, 0x00, 0x27, 0x00, 0x2f, 0x00, 0x37, 0x00, 0x00, 0x00, 0x0a, 0x00,
+  0x10, 0x00, 0x18, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x07, 0x00, 0x0e, 0x00,
+  0x22, 0x00, 0x29, 0x00, 0x31, 0x00, 0x3d, 0x00, 0x45, 0x00, 0x4b, 0x00,
+  0x53, 0x00, 0x59, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x0d, 0x00,
+  0x2b, 0x00, 0x31, 0x00, 0x39, 0x00, 0x3f, 0x00, 0x46, 0x00, 0x4c, 0x00,
+  0x54, 0x00, 0x5c, 0x00, 0x63, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x14, 0x00,
+  0x1a, 0x00, 0x24, 0x00, 0x00, 0x00, 0x09, 0x00, 0x13, 0x00, 0x1c, 0x00,
+  0x25, 0x00, 0x38, 0x00, 0x41, 0x00, 0x4a, 0x00, 0x53, 0x00, 0x5c, 0x00,
+  0x65, 0x00, 0x6e, 0x00, 0x80, 0x00, 0x89, 0x00, 0x92, 0x00, 0x9b, 0x00,
+  0x00, 0x00, 0x0b, 0x00, 0x16, 0x00, 0x21, 0x00, 0x2c, 0x00, 0x37, 0x00,
+  0x42, 0x00, 0x4d, 0x00, 0x58, 0x00, 0x63, 0x00, 0x6e, 0x00, 0x79, 0x00,
+  0x84, 0x00, 0x8f, 0x00, 0x9a, 0x00, 0xa5, 0x00, 0xb0, 0x00, 0xbb, 0x00,
+  0xc6, 0x00, 0xd1, 0x00, 0xdc, 0x00, 0xe7, 0x00, 0xf0, 0x00, 0xf7, 0x00,
+  0x03, 0x01, 0x0c, 0x01, 0x13, 0x01, 0x00, 0x00, 0x08, 0x00, 0x11, 0x00,
+  0x1e, 0x00, 0x2b, 0x00, 0x36, 0x00, 0x41, 0x00, 0x4d, 0x00, 0x54, 0x00,
+  0x62, 0x00, 0x68, 0x00, 0x6f, 0x00, 0x76, 0x00, 0x83, 0x00, 0x8a, 0x00,
+  0x93, 0x00, 0x00, 0x00, 0x13, 0x00, 0x29, 0x00, 0x43, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x12, 0x00, 0x1c, 0x00, 0x25, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x15, 0x00, 0x00, 0x00, 0x13, 0x00, 0x2a, 0x00, 0x31, 0x00, 0x35, 0x00,
+  0x3f, 0x00, 0x49, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x15, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x29, 0x00, 0x34, 0x00, 0x40, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x24, 0x00, 0x39, 0x00, 0x3f, 0x00, 0x00, 0x00,
+  0x1b, 0x00, 0x26, 0x00, 0x3e, 0x00, 0x55, 0x00, 0x60, 0x00, 0x78, 0x00,
+  0x82, 0x00, 0x8c, 0x00, 0x97, 0x00, 0xa2, 0x00, 0xac, 0x00, 0xb7, 0x00,
+  0xc2, 0x00, 0xcd, 0x00, 0xd8, 0x00, 0x00, 0x00, 0x17, 0x00, 0x20, 0x00,
+  0x2b, 0x00, 0x33, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x16, 0x00, 0x1f, 0x00,
+  0x00, 0x00, 0x0f, 0x00, 0x1c, 0x00, 0x24, 0x00, 0x33, 0x00, 0x3b, 0x00,
+  0x43, 0x00, 0x4b, 0x00, 0x53, 0x00, 0x60, 0x00, 0x00, 0x00, 0x12, 0x00,
+  0x1e, 0x00, 0x25, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x13, 0x00, 0x28, 0x00,
+  0x34, 0x00, 0x46, 0x00, 0x50, 0x00, 0x58, 0x00, 0x65, 0x00, 0x6b, 0x00,
+  0x73, 0x00, 0x7f, 0x00, 0x87, 0x00, 0x90, 0x00, 0x98, 0x00, 0xa1, 0x00,
+  0xad, 0x00, 0xb9, 0x00, 0xc1, 0x00, 0xc9, 0x00, 0xd3, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x17, 0x00, 0x22, 0x00, 0x2d, 0x00, 0x38, 0x00, 0x43, 0x00,
+  0x4e, 0x00, 0x59, 0x00, 0x71, 0x00, 0x7c, 0x00, 0x87, 0x00, 0x92, 0x00,
+  0x9d, 0x00, 0xa8, 0x00, 0xb3, 0x00, 0xbe, 0x00, 0xc9, 0x00, 0xd4, 0x00,
+  0xdf, 0x00, 0xea, 0x00, 0xf5, 0x00, 0x00, 0x01, 0x0b, 0x01, 0x16, 0x01,
+  0x21, 0x01, 0x2c, 0x01, 0x37, 0x01, 0x42, 0x01, 0x4e, 0x01, 0x5a, 0x01,
+  0x00, 0x00, 0x08, 0x00, 0x16, 0x00, 0x1f, 0x00, 0x2c, 0x00, 0x37, 0x00,
+  0x46, 0x00, 0x51, 0x00, 0x5b, 0x00, 0x6c, 0x00, 0x72, 0x00, 0x7a, 0x00,
+  0x82, 0x00, 0x8c, 0x00, 0x95, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x11, 0x00,
+  0x1a, 0x00, 0x2a, 0x00, 0x33, 0x00, 0x3c, 0x00, 0x44, 0x00, 0x53, 0x00,
+  0x5b, 0x00, 0x71, 0x00, 0x82, 0x00, 0x8a, 0x00, 0x94, 0x00, 0x9d, 0x00,
+  0xa6, 0x00, 0xaf, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x19, 0x00, 0x23, 0x00,
+  0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x13, 0x00, 0x19, 0x00,
+  0x24, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x15, 0x00, 0x1e, 0x00, 0x28, 0x00,
+  0x31, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x22, 0x00, 0x2d, 0x00, 0x00, 0x00,
+  0x18, 0x00, 0x20, 0x00, 0x38, 0x00, 0x43, 0x00, 0x49, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1c, 0x00, 0x26, 0x00, 0x30, 0x00, 0x3a, 0x00, 0x44, 0x00,
+  0x4e, 0x00, 0x58, 0x00, 0x62, 0x00, 0x6c, 0x00, 0x76, 0x00, 0x80, 0x00,
+  0x8a, 0x00, 0x94, 0x00, 0x9e, 0x00, 0xa8, 0x00, 0xb2, 0x00, 0xbc, 0x00,
+  0xc6, 0x00, 0xdd, 0x00, 0xe7, 0x00, 0xf1, 0x00, 0x0e, 0x01, 0x17, 0x01,
+  0x23, 0x01, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x17, 0x00, 0x1d, 0x00,
+  0x2a, 0x00, 0x00, 0x00, 0x08, 0x00, 0x11, 0x00, 0x19, 0x00, 0x21, 0x00,
+  0x29, 0x00, 0x38, 0x00, 0x4c, 0x00, 0x54, 0x00, 0x5d, 0x00, 0x65, 0x00,
+  0x6d, 0x00, 0x7d, 0x00, 0x86, 0x00, 0x8e, 0x00, 0x97, 0x00, 0x9f, 0x00,
+  0xa7, 0x00, 0xaf, 0x00, 0xb7, 0x00, 0xbf, 0x00, 0xc7, 0x00, 0xd0, 0x00,
+  0xd8, 0x00, 0x00, 0x00, 0x07, 0x00, 0x11, 0x00, 0x1b, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x14, 0x00, 0x1f, 0x00, 0x2b, 0x00, 0x36, 0x00, 0x41, 0x00,
+  0x4c, 0x00, 0x57, 0x00, 0x62, 0x00, 0x6d, 0x00, 0x78, 0x00, 0x83, 0x00,
+  0x8e, 0x00, 0x99, 0x00, 0xa4, 0x00, 0xb0, 0x00, 0xb8, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x13, 0x00, 0x21, 0x00, 0x28, 0x00, 0x2f, 0x00, 0x36, 0x00,
+  0x00, 0x00, 0x0b, 0x00, 0x14, 0x00, 0x1d, 0x00, 0x26, 0x00, 0x2e, 0x00,
+  0x37, 0x00, 0x3f, 0x00, 0x4e, 0x00, 0x56, 0x00, 0x5f, 0x00, 0x67, 0x00,
+  0x72, 0x00, 0x7a, 0x00, 0x82, 0x00, 0x91, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x18, 0x00, 0x24, 0x00, 0x30, 0x00, 0x3c, 0x00, 0x48, 0x00, 0x54, 0x00,
+  0x5b, 0x00, 0x67, 0x00, 0x73, 0x00, 0x7f, 0x00, 0x86, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x1e, 0x00, 0x27, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x28, 0x00,
+  0x2f, 0x00, 0x4a, 0x00, 0x54, 0x00, 0x5d, 0x00, 0x63, 0x00, 0x6d, 0x00,
+  0x76, 0x00, 0x80, 0x00, 0x00, 0x00, 0x22, 0x00, 0x2d, 0x00, 0x35, 0x00,
+  0x40, 0x00, 0x4b, 0x00, 0x52, 0x00, 0x59, 0x00, 0x00, 0x00, 0x1b, 0x00,
+  0x2d, 0x00, 0x34, 0x00, 0x3b, 0x00, 0x43, 0x00, 0x00, 0x00, 0x08, 0x00,
+  0x10, 0x00, 0x1a, 0x00, 0x23, 0x00, 0x33, 0x00, 0x3b, 0x00, 0x45, 0x00,
+  0x4e, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x26, 0x00, 0x40, 0x00, 0x49, 0x00,
+  0x50, 0x00, 0x00, 0x00, 0x19, 0x00, 0x49, 0x00, 0x55, 0x00, 0x60, 0x00,
+  0x69, 0x00, 0x72, 0x00, 0x7b, 0x00, 0x84, 0x00, 0x8f, 0x00, 0x99, 0x00,
+  0xa9, 0x00, 0xb2, 0x00, 0xb8, 0x00, 0xbf, 0x00, 0xc9, 0x00, 0xd1, 0x00,
+  0xd9, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x14, 0x00, 0x1e, 0x00, 0x28, 0x00,
+  0x32, 0x00, 0x3c, 0x00, 0x46, 0x00, 0x50, 0x00, 0x5a, 0x00, 0x65, 0x00,
+  0x6f, 0x00, 0x78, 0x00, 0x81, 0x00, 0x8a, 0x00, 0x90, 0x00, 0x99, 0x00,
+  0xa2, 0x00, 0xab, 0x00, 0xb1, 0x00, 0xc3, 0x00, 0xcc, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x11, 0x00, 0x19, 0x00, 0x21, 0x00, 0x30, 0x00, 0x38, 0x00,
+  0x4b, 0x00, 0x57, 0x00, 0x60, 0x00, 0x69, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x19, 0x00, 0x1f, 0x00,
+  0x28, 0x00, 0x2e, 0x00, 0x37, 0x00, 0x40, 0x00, 0x48, 0x00, 0x50, 0x00,
+  0x00, 0x00, 0x0b, 0x00, 0x16, 0x00, 0x21, 0x00, 0x2c, 0x00, 0x37, 0x00,
+  0x42, 0x00, 0x4d, 0x00, 0x58, 0x00, 0x63, 0x00, 0x6e, 0x00, 0x79, 0x00,
+  0x84, 0x00, 0x8f, 0x00, 0x9a, 0x00, 0xa5, 0x00, 0xb0, 0x00, 0xbc, 0x00,
+  0xc7, 0x00, 0xd2, 0x00, 0xdd, 0x00, 0xe8, 0x00, 0xf3, 0x00, 0xfe, 0x00,
+  0x09, 0x01, 0x14, 0x01, 0x1f, 0x01, 0x2a, 0x01, 0x35, 0x01, 0x40, 0x01,
+  0x46, 0x01, 0x4c, 0x01, 0x53, 0x01, 0x5c, 0x01, 0x64, 0x01, 0x00, 0x00,
+  0x15, 0x00, 0x27, 0x00, 0x31, 0x00, 0x39, 0x00, 0x42, 0x00, 0x4a, 0x00,
+  0x52, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x13, 0x00, 0x1e, 0x00,
+  0x2c, 0x00, 0x36, 0x00, 0x3d, 0x00, 0x44, 0x00, 0x4b, 0x00, 0x52, 0x00,
+  0x59, 0x00, 0x60, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x18, 0x00, 0x21, 0x00,
+  0x29, 0x00, 0x3a, 0x00, 0x42, 0x00, 0x4a, 0x00, 0x58, 0x00, 0x60, 0x00,
+  0x68, 0x00, 0x6e, 0x00, 0x7a, 0x00, 0x83, 0x00, 0x8f, 0x00, 0x9b, 0x00,
+  0xa3, 0x00, 0xbc, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x1a, 0x00, 0x22, 0x00, 0x34, 0x00, 0x3f, 0x00, 0x46, 0x00,
+  0x55, 0x00, 0x00, 0x00, 0x26, 0x00, 0x2d, 0x00, 0x36, 0x00, 0x3d, 0x00,
+  0x46, 0x00, 0x4f, 0x00, 0x00, 0x00, 0x08, 0x00, 0x10, 0x00, 0x18, 0x00,
+  0x21, 0x00, 0x30, 0x00, 0x41, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x20, 0x00,
+  0x00, 0x00, 0x16, 0x00, 0x1f, 0x00, 0x27, 0x00, 0x32, 0x00, 0x3a, 0x00,
+  0x45, 0x00, 0x4e, 0x00, 0x59, 0x00, 0x65, 0x00, 0x00, 0x00, 0x1e, 0x00,
+  0x2a, 0x00, 0x33, 0x00, 0x3f, 0x00, 0x48, 0x00, 0x4e, 0x00, 0x54, 0x00,
+  0x5a, 0x00, 0x66, 0x00, 0x6d, 0x00, 0x00, 0x00, 0x35, 0x00, 0x3d, 0x00,
+  0x45, 0x00, 0x4d, 0x00, 0x55, 0x00, 0x5d, 0x00, 0x69, 0x00, 0x00, 0x00,
+  0x21, 0x00, 0x2c, 0x00, 0x38, 0x00, 0x49, 0x00, 0x51, 0x00, 0x59, 0x00,
+  0x61, 0x00, 0x72, 0x00, 0x83, 0x00, 0x92, 0x00, 0xa3, 0x00, 0xb0, 0x00,
+  0xb8, 0x00, 0xc0, 0x00, 0xd5, 0x00, 0xdd, 0x00, 0xe5, 0x00, 0xf5, 0x00,
+  0xfd, 0x00, 0x07, 0x01, 0x0f, 0x01, 0x17, 0x01, 0x1f, 0x01, 0x27, 0x01,
+  0x31, 0x01, 0x39, 0x01, 0x42, 0x01, 0x4a, 0x01, 0x00, 0x00, 0x18, 0x00,
+  0x2b, 0x00, 0x00, 0x00, 0x09, 0x00, 0x16, 0x00, 0x1e, 0x00, 0x33, 0x00,
+  0x4c, 0x00, 0x52, 0x00, 0x58, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x21, 0x00,
+  0x28, 0x00, 0x2f, 0x00, 0x35, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x13, 0x00,
+  0x1b, 0x00, 0x34, 0x00, 0x43, 0x00, 0x4b, 0x00, 0x55, 0x00, 0x61, 0x00,
+  0x69, 0x00, 0x80, 0x00, 0x88, 0x00, 0x99, 0x00, 0xa1, 0x00, 0xa9, 0x00,
+  0xb1, 0x00, 0xb9, 0x00, 0xc1, 0x00, 0xca, 0x00, 0xd3, 0x00, 0xdb, 0x00,
+  0xea, 0x00, 0xf2, 0x00, 0xfa, 0x00, 0x02, 0x01, 0x0a, 0x01, 0x00, 0x00,
+  0x0c, 0x00, 0x13, 0x00, 0x1c, 0x00, 0x21, 0x00, 0x00, 0x00, 0x21, 0x00,
+  0x2a, 0x00, 0x33, 0x00, 0x3f, 0x00, 0x4a, 0x00, 0x50, 0x00, 0x59, 0x00,
+  0x62, 0x00, 0x6b, 0x00, 0x73, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x0a, 0x00,
+  0x17, 0x00, 0x2e, 0x00, 0x35, 0x00, 0x40, 0x00, 0x46, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x1d, 0x00, 0x25, 0x00, 0x2d, 0x00, 0x35, 0x00, 0x3d, 0x00,
+  0x55, 0x00, 0x5e, 0x00, 0x66, 0x00, 0x00, 0x00, 0x09, 0x00, 0x12, 0x00,
+  0x1c, 0x00, 0x25, 0x00, 0x2e, 0x00, 0x37, 0x00, 0x3d, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x11, 0x00, 0x1a, 0x00, 0x22, 0x00, 0x2a, 0x00, 0x32, 0x00,
+  0x3b, 0x00, 0x43, 0x00, 0x53, 0x00, 0x5c, 0x00, 0x6f, 0x00, 0x77, 0x00,
+  0x7f, 0x00, 0x89, 0x00, 0x91, 0x00, 0x99, 0x00, 0xab, 0x00, 0xb1, 0x00,
+  0xba, 0x00, 0xc3, 0x00, 0xca, 0x00, 0xd2, 0x00, 0xdb, 0x00, 0xe4, 0x00,
+  0xea, 0x00, 0xf3, 0x00, 0xfc, 0x00, 0x05, 0x01, 0x0e, 0x01, 0x17, 0x01,
+  0x20, 0x01, 0x29, 0x01, 0x32, 0x01, 0x3b, 0x01, 0x44, 0x01, 0x58, 0x01,
+  0x61, 0x01, 0x6a, 0x01, 0x73, 0x01, 0x7c, 0x01, 0x85, 0x01, 0x00, 0x00,
+  0x0a, 0x00, 0x21, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x13, 0x00, 0x1c, 0x00,
+  0x25, 0x00, 0x2e, 0x00, 0x37, 0x00, 0x4a, 0x00, 0x53, 0x00, 0x5b, 0x00,
+  0x61, 0x00, 0x6a, 0x00, 0x79, 0x00, 0x82, 0x00, 0x8d, 0x00, 0x96, 0x00,
+  0x9f, 0x00, 0xa7, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x24, 0x00, 0x35, 0x00,
+  0x3e, 0x00, 0x49, 0x00, 0x5c, 0x00, 0x64, 0x00, 0x6a, 0x00, 0x73, 0x00,
+  0x7c, 0x00, 0x82, 0x00, 0x8c, 0x00, 0x96, 0x00, 0x9b, 0x00, 0xa1, 0x00,
+  0x00, 0x00, 0x08, 0x00, 0x10, 0x00, 0x18, 0x00, 0x20, 0x00, 0x28, 0x00,
+  0x31, 0x00, 0x39, 0x00, 0x41, 0x00, 0x49, 0x00, 0x51, 0x00, 0x59, 0x00,
+  0x61, 0x00, 0x69, 0x00, 0x7c, 0x00, 0x85, 0x00, 0x8b, 0x00, 0x91, 0x00,
+  0x9a, 0x00, 0xae, 0x00, 0xb7, 0x00, 0xc0, 0x00, 0xc6, 0x00, 0xce, 0x00,
+  0xd4, 0x00, 0xdd, 0x00, 0x00, 0x00, 0x28, 0x00, 0x32, 0x00, 0x3c, 0x00,
+  0x47, 0x00, 0x58, 0x00, 0x00, 0x00, 0x28, 0x00, 0x33, 0x00, 0x39, 0x00,
+  0x51, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x1a, 0x00, 0x27, 0x00, 0x2e, 0x00,
+  0x44, 0x00, 0x00, 0x00, 0x07, 0x00, 0x10, 0x00, 0x22, 0x00, 0x29, 0x00,
+  0x30, 0x00, 0x3c, 0x00, 0x45, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x14, 0x00,
+  0x1e, 0x00, 0x2f, 0x00, 0x42, 0x00, 0x4d, 0x00, 0x53, 0x00, 0x5d, 0x00,
+  0x67, 0x00, 0x71, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x16, 0x00, 0x22, 0x00,
+  0x28, 0x00, 0x32, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x05, 0x00, 0x0e, 0x00,
+  0x17, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x13, 0x00, 0x1d, 0x00, 0x24, 0x00,
+  0x2a, 0x00, 0x31, 0x00, 0x3d, 0x00, 0x44, 0x00, 0x4b, 0x00, 0x52, 0x00,
+  0x5c, 0x00, 0x65, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x15, 0x00, 0x21, 0x00,
+  0x2a, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x16, 0x00, 0x22, 0x00, 0x2c, 0x00,
+  0x45, 0x00, 0x50, 0x00, 0x5a, 0x00, 0x66, 0x00, 0x6e, 0x00, 0x77, 0x00,
+  0x7f, 0x00, 0x8a, 0x00, 0x92, 0x00, 0x9a, 0x00, 0xa4, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x15, 0x00, 0x1e, 0x00, 0x2f, 0x00, 0x41, 0x00, 0x47, 0x00,
+  0x50, 0x00, 0x00, 0x00, 0x08, 0x00, 0x11, 0x00, 0x1a, 0x00, 0x22, 0x00,
+  0x2a, 0x00, 0x32, 0x00, 0x3a, 0x00, 0x42, 0x00, 0x4a, 0x00, 0x52, 0x00,
+  0x5a, 0x00, 0x62, 0x00, 0x6a, 0x00, 0x71, 0x00, 0x78, 0x00, 0x7f, 0x00,
+  0x85, 0x00, 0x8e, 0x00, 0x94, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x16, 0x00,
+  0x21, 0x00, 0x00, 0x00, 0x09, 0x00, 0x12, 0x00, 0x1b, 0x00, 0x24, 0x00,
+  0x2d, 0x00, 0x36, 0x00, 0x40, 0x00, 0x49, 0x00, 0x52, 0x00, 0x5a, 0x00,
+  0x63, 0x00, 0x6c, 0x00, 0x75, 0x00, 0x7e, 0x00, 0x88, 0x00, 0x91, 0x00,
+  0x99, 0x00, 0xa2, 0x00, 0xab, 0x00, 0xb4, 0x00, 0xc4, 0x00, 0xcd, 0x00,
+  0xd6, 0x00, 0xdf, 0x00, 0xe8, 0x00, 0xf1, 0x00, 0xfa, 0x00, 0x03, 0x01,
+  0x0c, 0x01, 0x14, 0x01, 0x1c, 0x01, 0x24, 0x01, 0x2f, 0x01, 0x3a, 0x01,
+  0x45, 0x01, 0x4d, 0x01, 0x55, 0x01, 0x00, 0x00, 0x09, 0x00, 0x12, 0x00,
+  0x1b, 0x00, 0x26, 0x00, 0x32, 0x00, 0x3c, 0x00, 0x45, 0x00, 0x4e, 0x00,
+  0x57, 0x00, 0x63, 0x00, 0x6c, 0x00, 0x75, 0x00, 0x7a, 0x00, 0x83, 0x00,
+  0x8c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x10, 0x00, 0x18, 0x00, 0x28, 0x00,
+  0x39, 0x00, 0x3f, 0x00, 0x48, 0x00, 0x5a, 0x00, 0x60, 0x00, 0x66, 0x00,
+  0x00, 0x00, 0x0a, 0x00, 0x14, 0x00, 0x1e, 0x00, 0x28, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x10, 0x00, 0x19, 0x00, 0x22, 0x00, 0x2b, 0x00, 0x34, 0x00,
+  0x3d, 0x00, 0x46, 0x00, 0x4f, 0x00, 0x58, 0x00, 0x61, 0x00, 0x6a, 0x00,
+  0x73, 0x00, 0x7c, 0x00, 0x85, 0x00, 0x8f, 0x00, 0x98, 0x00, 0xa1, 0x00,
+  0xaa, 0x00, 0xb3, 0x00, 0xbc, 0x00, 0xc5, 0x00, 0xce, 0x00, 0xd5, 0x00,
+  0xde, 0x00, 0xe7, 0x00, 0xf3, 0x00, 0xfc, 0x00, 0x05, 0x01, 0x0e, 0x01,
+  0x21, 0x01, 0x2b, 0x01, 0x34, 0x01, 0x45, 0x01, 0x50, 0x01, 0x00, 0x00,
+  0x28, 0x00, 0x35, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x00,
+  0x29, 0x00, 0x33, 0x00, 0x39, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x19, 0x00,
+  0x27, 0x00, 0x2e, 0x00, 0x50, 0x00, 0x67, 0x00, 0x6e, 0x00, 0x76, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0c, 0x00,
+  0x00, 0x00, 0x0a, 0x00, 0x1a, 0x00, 0x21, 0x00, 0x2c, 0x00, 0x35, 0x00,
+  0x3c, 0x00, 0x00, 0x00, 0x11, 0x00, 0x1a, 0x00, 0x22, 0x00, 0x30, 0x00,
+  0x37, 0x00, 0x41, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x2d, 0x00, 0x41, 0x00,
+  0x48, 0x00, 0x52, 0x00, 0x59, 0x00, 0x62, 0x00, 0x6c, 0x00, 0x76, 0x00,
+  0x7f, 0x00, 0x8c, 0x00, 0x96, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x12, 0x00,
+  0x1a, 0x00, 0x2c, 0x00, 0x35, 0x00, 0x3b, 0x00, 0x4c, 0x00, 0x52, 0x00,
+  0x58, 0x00, 0x5e, 0x00, 0x72, 0x00, 0x78, 0x00, 0x81, 0x00, 0x8a, 0x00,
+  0x9a, 0x00, 0x00, 0x00, 0x09, 0x00, 0x1d, 0x00, 0x24, 0x00, 0x2e, 0x00,
+  0x00, 0x00, 0x1d, 0x00, 0x26, 0x00, 0x37, 0x00, 0x40, 0x00, 0x49, 0x00,
+  0x54, 0x00, 0x5d, 0x00, 0x66, 0x00, 0x6f, 0x00, 0x78, 0x00, 0x81, 0x00,
+  0x8a, 0x00, 0x93, 0x00, 0x9c, 0x00, 0xb3, 0x00, 0xbc, 0x00, 0xc5, 0x00,
+  0xcd, 0x00, 0xd8, 0x00, 0xe3, 0x00, 0xfa, 0x00, 0x05, 0x01, 0x0d, 0x01,
+  0x00, 0x00, 0x0c, 0x00, 0x15, 0x00, 0x1e, 0x00, 0x2f, 0x00, 0x37, 0x00,
+  0x00, 0x00, 0x18, 0x00, 0x21, 0x00, 0x29, 0x00, 0x34, 0x00, 0x3c, 0x00,
+  0x42, 0x00, 0x4a, 0x00, 0x56, 0x00, 0x69, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x12, 0x00, 0x1b, 0x00, 0x2a, 0x00, 0x3d, 0x00, 0x48, 0x00, 0x52, 0x00,
+  0x5b, 0x00, 0x64, 0x00, 0x6a, 0x00, 0x00, 0x00, 0x09, 0x00, 0x12, 0x00,
+  0x1b, 0x00, 0x24, 0x00, 0x2d, 0x00, 0x36, 0x00, 0x3f, 0x00, 0x48, 0x00,
+  0x51, 0x00, 0x5a, 0x00, 0x63, 0x00, 0x6c, 0x00, 0x75, 0x00, 0x7e, 0x00,
+  0x87, 0x00, 0x90, 0x00, 0x99, 0x00, 0xa2, 0x00, 0xac, 0x00, 0xb5, 0x00,
+  0xc7, 0x00, 0xd0, 0x00, 0xd9, 0x00, 0xe2, 0x00, 0xeb, 0x00, 0xf4, 0x00,
+  0xfd, 0x00, 0x06, 0x01, 0x0f, 0x01, 0x18, 0x01, 0x21, 0x01, 0x2a, 0x01,
+  0x33, 0x01, 0x3c, 0x01, 0x45, 0x01, 0x4e, 0x01, 0x5e, 0x01, 0x67, 0x01,
+  0x70, 0x01, 0x81, 0x01, 0x94, 0x01, 0xa2, 0x01, 0xa8, 0x01, 0xb1, 0x01,
+  0x00, 0x00, 0x0d, 0x00, 0x1a, 0x00, 0x25, 0x00, 0x2b, 0x00, 0x32, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x12, 0x00, 0x1b, 0x00, 0x22, 0x00, 0x2b, 0x00,
+  0x3e, 0x00, 0x4a, 0x00, 0x62, 0x00, 0x6e, 0x00, 0x7c, 0x00, 0x8d, 0x00,
+  0x96, 0x00, 0x00, 0x00, 0x18, 0x00, 0x28, 0x00, 0x3a, 0x00, 0x44, 0x00,
+  0x4d, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x16, 0x00, 0x20, 0x00, 0x2b, 0x00,
+  0x34, 0x00, 0x3d, 0x00, 0x44, 0x00, 0x4e, 0x00, 0x5a, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x1b, 0x00, 0x26, 0x00, 0x00, 0x00, 0x07, 0x00, 0x19, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x15, 0x00, 0x1c, 0x00, 0x29, 0x00, 0x2f, 0x00,
+  0x00, 0x00, 0x0b, 0x00, 0x11, 0x00, 0x26, 0x00, 0x31, 0x00, 0x49, 0x00,
+  0x51, 0x00, 0x5c, 0x00, 0x71, 0x00, 0x84, 0x00, 0x91, 0x00, 0x97, 0x00,
+  0xa2, 0x00, 0xac, 0x00, 0xb3, 0x00, 0xb9, 0x00, 0xc4, 0x00, 0xcc, 0x00,
+  0xd3, 0x00, 0x00, 0x00, 0x22, 0x00, 0x2b, 0x00, 0x3e, 0x00, 0x50, 0x00,
+  0x61, 0x00, 0x00, 0x00, 0x20, 0x00, 0x28, 0x00, 0x38, 0x00, 0x48, 0x00,
+  0x5a, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x22, 0x00, 0x2d, 0x00, 0x3d, 0x00,
+  0x44, 0x00, 0x4d, 0x00, 0x54, 0x00, 0x61, 0x00, 0x00, 0x00, 0x25, 0x00,
+  0x2b, 0x00, 0x36, 0x00, 0x3e, 0x00, 0x46, 0x00, 0x4c, 0x00, 0x57, 0x00,
+  0x5d, 0x00, 0x66, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x7b, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x21, 0x00, 0x2a, 0x00, 0x35, 0x00, 0x43, 0x00, 0x4c, 0x00,
+  0x56, 0x00, 0x68, 0x00, 0x73, 0x00, 0x7d, 0x00, 0x84, 0x00, 0x8d, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x18, 0x00, 0x00, 0x00, 0x09, 0x00, 0x12, 0x00,
+  0x1b, 0x00, 0x22, 0x00, 0x33, 0x00, 0x39, 0x00, 0x3f, 0x00, 0x46, 0x00,
+  0x53, 0x00, 0x65, 0x00, 0x6c, 0x00, 0x7e, 0x00, 0x85, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x15, 0x00, 0x28, 0x00, 0x3b, 0x00, 0x44, 0x00, 0x4b, 0x00,
+  0x52, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x16, 0x00,
+  0x21, 0x00, 0x2c, 0x00, 0x37, 0x00, 0x42, 0x00, 0x4d, 0x00, 0x58, 0x00,
+  0x63, 0x00, 0x6e, 0x00, 0x79, 0x00, 0x84, 0x00, 0x8f, 0x00, 0x9b, 0x00,
+  0xa6, 0x00, 0xb1, 0x00, 0xbc, 0x00, 0xc7, 0x00, 0xd2, 0x00, 0xdd, 0x00,
+  0xe6, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x12, 0x00, 0x2f, 0x00,
+  0x4b, 0x00, 0x51, 0x00, 0x58, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x17, 0x00,
+  0x23, 0x00, 0x2a, 0x00, 0x36, 0x00, 0x3d, 0x00, 0x44, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x11, 0x00, 0x1c, 0x00, 0x26, 0x00, 0x30, 0x00, 0x36, 0x00,
+  0x3c, 0x00, 0x00, 0x00, 0x07, 0x00, 0x12, 0x00, 0x18, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x21, 0x00, 0x2e, 0x00, 0x3f, 0x00, 0x55, 0x00, 0x60, 0x00,
+  0x66, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x18, 0x00,
+  0x20, 0x00, 0x2a, 0x00, 0x35, 0x00, 0x40, 0x00, 0x50, 0x00, 0x5d, 0x00,
+  0x63, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x09, 0x00, 0x12, 0x00, 0x1b, 0x00,
+  0x24, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x16, 0x00, 0x21, 0x00, 0x2c, 0x00,
+  0x33, 0x00, 0x3e, 0x00, 0x49, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x10, 0x00,
+  0x1a, 0x00, 0x24, 0x00, 0x00, 0x00, 0x12, 0x00, 0x22, 0x00, 0x2d, 0x00,
+  0x34, 0x00, 0x40, 0x00, 0x47, 0x00, 0x4d, 0x00, 0x00, 0x00, 0x1a, 0x00,
+  0x23, 0x00, 0x36, 0x00, 0x40, 0x00, 0x49, 0x00, 0x52, 0x00, 0x5c, 0x00,
+  0x6e, 0x00, 0x74, 0x00, 0x7d, 0x00, 0x00, 0x00, 0x09, 0x00, 0x1c, 0x00,
+  0x25, 0x00, 0x2e, 0x00, 0x39, 0x00, 0x42, 0x00, 0x53, 0x00, 0x5c, 0x00,
+  0x6a, 0x00, 0x7e, 0x00, 0x8d, 0x00, 0x96, 0x00, 0x9f, 0x00, 0xa8, 0x00,
+  0xb1, 0x00, 0xba, 0x00, 0xc1, 0x00, 0xc8, 0x00, 0xe0, 0x00, 0xe6, 0x00,
+  0xed, 0x00, 0xf4, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x18, 0x00, 0x1e, 0x00,
+  0x2a, 0x00, 0x36, 0x00, 0x40, 0x00, 0x4c, 0x00, 0x58, 0x00, 0x64, 0x00,
+  0x70, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x16, 0x00, 0x21, 0x00, 0x2c, 0x00,
+  0x37, 0x00, 0x42, 0x00, 0x4d, 0x00, 0x58, 0x00, 0x63, 0x00, 0x6e, 0x00,
+  0x79, 0x00, 0x84, 0x00, 0x8f, 0x00, 0x9a, 0x00, 0xa5, 0x00, 0xb0, 0x00,
+  0xbb, 0x00, 0xc6, 0x00, 0xd2, 0x00, 0xdd, 0x00, 0xe8, 0x00, 0xf0, 0x00,
+  0x08, 0x01, 0x10, 0x01, 0x1b, 0x01, 0x24, 0x01, 0x2a, 0x01, 0x33, 0x01,
+  0x3b, 0x01, 0x44, 0x01, 0x00, 0x00, 0x09, 0x00, 0x16, 0x00, 0x1c, 0x00,
+  0x26, 0x00, 0x30, 0x00, 0x3a, 0x00, 0x44, 0x00, 0x4a, 0x00, 0x54, 0x00,
+  0x5e, 0x00, 0x68, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x17, 0x00, 0x27, 0x00,
+  0x2e, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x11, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x18, 0x00, 0x26, 0x00, 0x32, 0x00, 0x00, 0x00, 0x09, 0x00, 0x1c, 0x00,
+  0x2e, 0x00, 0x37, 0x00, 0x3e, 0x00, 0x46, 0x00, 0x4c, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x20, 0x00, 0x30, 0x00, 0x37, 0x00, 0x4e, 0x00, 0x57, 0x00,
+  0x5f, 0x00, 0x6a, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x14, 0x00,
+  0x29, 0x00, 0x33, 0x00, 0x3e, 0x00, 0x49, 0x00, 0x53, 0x00, 0x5e, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x12, 0x00, 0x1c, 0x00, 0x25, 0x00, 0x2e, 0x00,
+  0x37, 0x00, 0x40, 0x00, 0x49, 0x00, 0x52, 0x00, 0x5b, 0x00, 0x62, 0x00,
+  0x69, 0x00, 0x72, 0x00, 0x79, 0x00, 0x82, 0x00, 0x8b, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x12, 0x00, 0x1d, 0x00, 0x29, 0x00, 0x2f, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x13, 0x00, 0x1d, 0x00, 0x24, 0x00, 0x31, 0x00, 0x3f, 0x00,
+  0x4c, 0x00, 0x00, 0x00, 0x12, 0x00, 0x18, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x13, 0x00, 0x1c, 0x00, 0x25, 0x00, 0x2e, 0x00, 0x37, 0x00, 0x40, 0x00,
+  0x49, 0x00, 0x5b, 0x00, 0x64, 0x00, 0x6b, 0x00, 0x78, 0x00, 0x88, 0x00,
+  0x8f, 0x00, 0x96, 0x00, 0x00, 0x00, 0x09, 0x00, 0x12, 0x00, 0x1b, 0x00,
+  0x2e, 0x00, 0x40, 0x00, 0x49, 0x00, 0x52, 0x00, 0x00, 0x00, 0x14, 0x00,
+  0x1b, 0x00, 0x27, 0x00, 0x36, 0x00, 0x48, 0x00, 0x4f, 0x00, 0x00, 0x00,
+  0x15, 0x00, 0x20, 0x00, 0x2b, 0x00, 0x36, 0x00, 0x41, 0x00, 0x4c, 0x00,
+  0x57, 0x00, 0x62, 0x00, 0x6d, 0x00, 0x78, 0x00, 0x81, 0x00, 0x95, 0x00,
+  0xa2, 0x00, 0xa8, 0x00, 0x00, 0x00, 0x09, 0x00, 0x13, 0x00, 0x1e, 0x00,
+  0x25, 0x00, 0x2e, 0x00, 0x3f, 0x00, 0x45, 0x00, 0x4d, 0x00, 0x59, 0x00,
+  0x5f, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x2c, 0x00, 0x38, 0x00, 0x43, 0x00,
+  0x00, 0x00, 0x07, 0x00, 0x10, 0x00, 0x23, 0x00, 0x35, 0x00, 0x47, 0x00,
+  0x56, 0x00, 0x5d, 0x00, 0x69, 0x00, 0x70, 0x00, 0x00, 0x00, 0x1f, 0x00,
+  0x2b, 0x00, 0x35, 0x00, 0x3e, 0x00, 0x46, 0x00, 0x4c, 0x00, 0x52, 0x00,
+  0x5f, 0x00, 0x68, 0x00, 0x72, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x16, 0x00,
+  0x22, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x11, 0x00,
+  0x1a, 0x00, 0x31, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x18, 0x00, 0x1e, 0x00,
+  0x24, 0x00, 0x33, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x2b, 0x00, 0x3d, 0x00,
+  0x4d, 0x00, 0x56, 0x00, 0x5f, 0x00, 0x67, 0x00, 0x6f, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x1b, 0x00, 0x24, 0x00, 0x2d, 0x00, 0x3d, 0x00, 0x43, 0x00,
+  0x00, 0x00, 0x19, 0x00, 0x21, 0x00, 0x31, 0x00, 0x39, 0x00, 0x43, 0x00,
+  0x4b, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x24, 0x00, 0x2c, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x22, 0x00, 0x2e, 0x00, 0x37, 0x00, 0x4d, 0x00, 0x57, 0x00,
+  0x5f, 0x00, 0x73, 0x00, 0x00, 0x00, 0x19, 0x00, 0x20, 0x00, 0x2a, 0x00,
+  0x3b, 0x00, 0x45, 0x00, 0x4d, 0x00, 0x54, 0x00, 0x5f, 0x00, 0x66, 0x00,
+  0x6f, 0x00, 0x78, 0x00, 0x00, 0x00, 0x19, 0x00, 0x2c, 0x00, 0x33, 0x00,
+  0x00, 0x00, 0x0b, 0x00, 0x16, 0x00, 0x21, 0x00, 0x2c, 0x00, 0x37, 0x00,
+  0x42, 0x00, 0x4d, 0x00, 0x59, 0x00, 0x64, 0x00, 0x6f, 0x00, 0x7a, 0x00,
+  0x85, 0x00, 0x90, 0x00, 0x9b, 0x00, 0xa6, 0x00, 0xb1, 0x00, 0xbc, 0x00,
+  0xc7, 0x00, 0xd2, 0x00, 0xdd, 0x00, 0xe8, 0x00, 0xf3, 0x00, 0xfd, 0x00,
+  0x0d, 0x01, 0x15, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x46, 0x01, 0x4e, 0x01,
+  0x56, 0x01, 0x5d, 0x01, 0x66, 0x01, 0x72, 0x01, 0x79, 0x01, 0x80, 0x01,
+  0x8d, 0x01, 0x94, 0x01, 0xa0, 0x01, 0xa7, 0x01, 0x00, 0x00, 0x1d, 0x00,
+  0x27, 0x00, 0x30, 0x00, 0x3a, 0x00, 0x44, 0x00, 0x51, 0x00, 0x5b, 0x00,
+  0x72, 0x00, 0x78, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x28, 0x00, 0x31, 0x00,
+  0x3d, 0x00, 0x4a, 0x00, 0x56, 0x00, 0x5f, 0x00, 0x68, 0x00, 0x71, 0x00,
+  0x77, 0x00, 0x7e, 0x00, 0x87, 0x00, 0x8f, 0x00, 0x99, 0x00, 0xa2, 0x00,
+  0xab, 0x00, 0x00, 0x00, 0x09, 0x00, 0x12, 0x00, 0x22, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x18, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0f, 0x00,
+  0x1e, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x14, 0x00, 0x1d, 0x00, 0x24, 0x00,
+  0x2d, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x08, 0x00, 0x1d, 0x00, 0x25, 0x00,
+  0x3a, 0x00, 0x44, 0x00, 0x4b, 0x00, 0x57, 0x00, 0x63, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x1e, 0x00, 0x29, 0x00, 0x00, 0x00, 0x09, 0x00, 0x1a, 0x00,
+  0x26, 0x00, 0x2d, 0x00, 0x36, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x0f, 0x00,
+  0x16, 0x00, 0x00, 0x00, 0x08, 0x00, 0x10, 0x00, 0x18, 0x00, 0x21, 0x00,
+  0x29, 0x00, 0x31, 0x00, 0x38, 0x00, 0x3e, 0x00, 0x44, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x15, 0x00, 0x20, 0x00, 0x00, 0x00, 0x09, 0x00, 0x12, 0x00,
+  0x1b, 0x00, 0x24, 0x00, 0x2b, 0x00, 0x34, 0x00, 0x41, 0x00, 0x51, 0x00,
+  0x5d, 0x00, 0x65, 0x00, 0x00, 0x00, 0x09, 0x00, 0x16, 0x00, 0x1f, 0x00,
+  0x28, 0x00, 0x31, 0x00, 0x00, 0x00, 0x13, 0x00, 0x21, 0x00, 0x29, 0x00,
+  0x30, 0x00, 0x39, 0x00, 0x00, 0x00, 0x12, 0x00, 0x18, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x12, 0x00, 0x1b, 0x00, 0x24, 0x00, 0x38, 0x00, 0x3e, 0x00,
+  0x44, 0x00, 0x4f, 0x00, 0x56, 0x00, 0x61, 0x00, 0x6a, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x18, 0x00, 0x24, 0x00, 0x39, 0x00, 0x45, 0x00, 0x53, 0x00,
+  0x64, 0x00, 0x6d, 0x00, 0x79, 0x00, 0x00, 0x00, 0x17, 0x00, 0x1f, 0x00,
+  0x2c, 0x00, 0x35, 0x00, 0x4d, 0x00, 0x66, 0x00, 0x72, 0x00, 0x79, 0x00,
+  0x82, 0x00, 0x93, 0x00, 0x9f, 0x00, 0xab, 0x00, 0xb7, 0x00, 0xc3, 0x00,
+  0x00, 0x00, 0x19, 0x00, 0x1f, 0x00, 0x29, 0x00, 0x00, 0x00, 0x14, 0x00,
+  0x26, 0x00, 0x2d, 0x00, 0x34, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x0f, 0x00,
+  0x1a, 0x00, 0x00, 0x00, 0x08, 0x00, 0x11, 0x00, 0x1e, 0x00, 0x2d, 0x00,
+  0x35, 0x00, 0x3d, 0x00, 0x43, 0x00, 0x4b, 0x00, 0x53, 0x00, 0x5b, 0x00,
+  0x63, 0x00, 0x00, 0x00, 0x09, 0x00, 0x24, 0x00, 0x2e, 0x00, 0x36, 0x00,
+  0x44, 0x00, 0x4a, 0x00, 0x5e, 0x00, 0x67, 0x00, 0x72, 0x00, 0x78, 0x00,
+  0x7e, 0x00, 0x84, 0x00, 0x8f, 0x00, 0x00, 0x00, 0x08, 0x00, 0x10, 0x00,
+  0x26, 0x00, 0x2e, 0x00, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x00,
+  0x2a, 0x00, 0x3b, 0x00, 0x44, 0x00, 0x4a, 0x00, 0x52, 0x00, 0x62, 0x00,
+  0x6a, 0x00, 0x72, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1c, 0x00,
+  0x00, 0x00, 0x06, 0x00, 0x19, 0x00, 0x28, 0x00, 0x38, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x11, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x1e, 0x00, 0x24, 0x00,
+  0x39, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x17, 0x00, 0x1f, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x12, 0x00, 0x1c, 0x00, 0x2f, 0x00, 0x38, 0x00, 0x41, 0x00,
+  0x4a, 0x00, 0x53, 0x00, 0x5c, 0x00, 0x62, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x15, 0x00, 0x22, 0x00, 0x33, 0x00, 0x45, 0x00, 0x56, 0x00, 0x62, 0x00,
+  0x6e, 0x00, 0x80, 0x00, 0x91, 0x00, 0x9a, 0x00, 0xa5, 0x00, 0xae, 0x00,
+  0xb7, 0x00, 0xc0, 0x00, 0xc9, 0x00, 0xdc, 0x00, 0xe5, 0x00, 0xf0, 0x00,
+  0x00, 0x01, 0x09, 0x01, 0x12, 0x01, 0x1b, 0x01, 0x24, 0x01, 0x2d, 0x01,
+  0x36, 0x01, 0x3f, 0x01, 0x48, 0x01, 0x00, 0x00, 0x09, 0x00, 0x16, 0x00,
+  0x1f, 0x00, 0x28, 0x00, 0x36, 0x00, 0x46, 0x00, 0x53, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x12, 0x00, 0x19, 0x00, 0x2a, 0x00, 0x32, 0x00, 0x41, 0x00,
+  0x4d, 0x00, 0x56, 0x00, 0x5f, 0x00, 0x66, 0x00, 0x70, 0x00, 0x79, 0x00,
+  0x83, 0x00, 0x8c, 0x00, 0x95, 0x00, 0x9d, 0x00, 0xa6, 0x00, 0xaf, 0x00,
+  0x00, 0x00, 0x0f, 0x00, 0x21, 0x00, 0x2b, 0x00, 0x3b, 0x00, 0x4a, 0x00,
+  0x51, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x1c, 0x00, 0x29, 0x00, 0x35, 0x00,
+  0x3f, 0x00, 0x48, 0x00, 0x51, 0x00, 0x57, 0x00, 0x00, 0x00, 0x08, 0x00,
+  0x16, 0x00, 0x25, 0x00, 0x37, 0x00, 0x3f, 0x00, 0x47, 0x00, 0x00, 0x00,
+  0x1e, 0x00, 0x2d, 0x00, 0x3f, 0x00, 0x47, 0x00, 0x00, 0x00, 0x0a, 0x00,
+  0x20, 0x00, 0x30, 0x00, 0x48, 0x00, 0x52, 0x00, 0x5d, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x13, 0x00, 0x19, 0x00, 0x00, 0x00, 0x24, 0x00, 0x2c, 0x00,
+  0x3c, 0x00, 0x44, 0x00, 0x5e, 0x00, 0x75, 0x00, 0x85, 0x00, 0x8d, 0x00,
+  0x95, 0x00, 0x9c, 0x00, 0xa8, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x36, 0x00,
+  0x42, 0x00, 0x51, 0x00, 0x58, 0x00, 0x62, 0x00, 0x69, 0x00, 0x70, 0x00,
+  0x00, 0x00, 0x21, 0x00, 0x29, 0x00, 0x3b, 0x00, 0x47, 0x00, 0x5b, 0x00,
+  0x62, 0x00, 0x69, 0x00, 0x70, 0x00, 0x78, 0x00, 0x7f, 0x00, 0x86, 0x00,
+  0x8d, 0x00, 0x00, 0x00, 0x22, 0x00, 0x36, 0x00, 0x3f, 0x00, 0x57, 0x00,
+  0x60, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x09, 0x00, 0x13, 0x00, 0x1c, 0x00,
+  0x25, 0x00, 0x2f, 0x00, 0x38, 0x00, 0x41, 0x00, 0x4a, 0x00, 0x53, 0x00,
+  0x5c, 0x00, 0x66, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x16, 0x00, 0x21, 0x00,
+  0x2c, 0x00, 0x37, 0x00, 0x4e, 0x00, 0x57, 0x00, 0x60, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x28, 0x00, 0x34, 0x00, 0x40, 0x00, 0x4c, 0x00, 0x58, 0x00,
+  0x64, 0x00, 0x70, 0x00, 0x7c, 0x00, 0x95, 0x00, 0xa1, 0x00, 0xad, 0x00,
+  0xb9, 0x00, 0xc5, 0x00, 0xd1, 0x00, 0xdd, 0x00, 0xe9, 0x00, 0xf5, 0x00,
+  0x01, 0x01, 0x0d, 0x01, 0x19, 0x01, 0x25, 0x01, 0x31, 0x01, 0x3d, 0x01,
+  0x49, 0x01, 0x55, 0x01, 0x61, 0x01, 0x79, 0x01, 0x85, 0x01, 0x91, 0x01,
+  0x9d, 0x01, 0xa9, 0x01, 0xb5, 0x01, 0xc1, 0x01, 0xcd, 0x01, 0xd8, 0x01,
+  0xe4, 0x01, 0xf0, 0x01, 0xfd, 0x01, 0x0c, 0x02, 0x1b, 0x02, 0x29, 0x02,
+  0x41, 0x02, 0x4d, 0x02, 0x59, 0x02, 0x65, 0x02, 0x73, 0x02, 0x80, 0x02,
+  0x8c, 0x02, 0x97, 0x02, 0x9e, 0x02, 0xa5, 0x02, 0xac, 0x02, 0x00, 0x00,
+  0x0a, 0x00, 0x14, 0x00, 0x20, 0x00, 0x38, 0x00, 0x00, 0x00, 0x19, 0x00,
+  0x22, 0x00, 0x2b, 0x00, 0x34, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x1c, 0x00, 0x33, 0x00, 0x3e, 0x00, 0x46, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x1e, 0x00, 0x25, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x17, 0x00, 0x20, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x25, 0x00,
+  0x31, 0x00, 0x3f, 0x00, 0x48, 0x00, 0x4e, 0x00, 0x58, 0x00, 0x61, 0x00,
+  0x6a, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x2c, 0x00, 0x39, 0x00,
+  0x47, 0x00, 0x4f, 0x00, 0x58, 0x00, 0x61, 0x00, 0x00, 0x00, 0x1c, 0x00,
+  0x23, 0x00, 0x31, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x1f, 0x00, 0x29, 0x00,
+  0x33, 0x00, 0x3d, 0x00, 0x47, 0x00, 0x51, 0x00, 0x57, 0x00, 0x64, 0x00,
+  0x70, 0x00, 0x79, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x17, 0x00, 0x20, 0x00,
+  0x34, 0x00, 0x3d, 0x00, 0x43, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x12, 0x00,
+  0x21, 0x00, 0x37, 0x00, 0x41, 0x00, 0x4a, 0x00, 0x52, 0x00, 0x67, 0x00,
+  0x71, 0x00, 0x87, 0x00, 0x9d, 0x00, 0xa7, 0x00, 0xb1, 0x00, 0xbb, 0x00,
+  0xc5, 0x00, 0xcf, 0x00, 0xd9, 0x00, 0xe3, 0x00, 0xed, 0x00, 0xf7, 0x00,
+  0x01, 0x01, 0x0b, 0x01, 0x15, 0x01, 0x00, 0x00, 0x07, 0x00, 0x12, 0x00,
+  0x19, 0x00, 0x20, 0x00, 0x2f, 0x00, 0x35, 0x00, 0x3c, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x11, 0x00, 0x00, 0x00, 0x18, 0x00, 0x1f, 0x00, 0x25, 0x00,
+  0x2b, 0x00, 0x31, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x16, 0x00, 0x22, 0x00,
+  0x2e, 0x00, 0x3a, 0x00, 0x46, 0x00, 0x52, 0x00, 0x5f, 0x00, 0x6c, 0x00,
+  0x78, 0x00, 0x84, 0x00, 0x90, 0x00, 0x9c, 0x00, 0xa8, 0x00, 0xb4, 0x00,
+  0xc1, 0x00, 0xcd, 0x00, 0xdd, 0x00, 0xe9, 0x00, 0xf5, 0x00, 0x01, 0x01,
+  0x0d, 0x01, 0x16, 0x01, 0x28, 0x01, 0x37, 0x01, 0x3f, 0x01, 0x47, 0x01,
+  0x50, 0x01, 0x58, 0x01, 0x60, 0x01, 0x6b, 0x01, 0x00, 0x00, 0x0b, 0x00,
+  0x17, 0x00, 0x23, 0x00, 0x2f, 0x00, 0x3b, 0x00, 0x44, 0x00, 0x57, 0x00,
+  0x61, 0x00, 0x6d, 0x00, 0x79, 0x00, 0x85, 0x00, 0x8e, 0x00, 0x9f, 0x00,
+  0xb0, 0x00, 0xba, 0x00, 0xc3, 0x00, 0xcc, 0x00, 0xd5, 0x00, 0xde, 0x00,
+  0xe8, 0x00, 0x00, 0x00, 0x09, 0x00, 0x12, 0x00, 0x1a, 0x00, 0x23, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x12, 0x00, 0x1a, 0x00, 0x21, 0x00, 0x3e, 0x00,
+  0x4a, 0x00, 0x64, 0x00, 0x6b, 0x00, 0x74, 0x00, 0x00, 0x00, 0x08, 0x00,
+  0x1e, 0x00, 0x39, 0x00, 0x4a, 0x00, 0x54, 0x00, 0x65, 0x00, 0x6e, 0x00,
+  0x7c, 0x00, 0x84, 0x00, 0x95, 0x00, 0x9f, 0x00, 0xa9, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x18, 0x00, 0x21, 0x00, 0x2d, 0x00, 0x39, 0x00, 0x40, 0x00,
+  0x47, 0x00, 0x52, 0x00, 0x00, 0x00, 0x11, 0x00, 0x19, 0x00, 0x21, 0x00,
+  0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x08, 0x00, 0x0f, 0x00, 0x20, 0x00,
+  0x2c, 0x00, 0x39, 0x00, 0x43, 0x00, 0x4a, 0x00, 0x52, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x15, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x35, 0x00, 0x3f, 0x00,
+  0x49, 0x00, 0x53, 0x00, 0x5d, 0x00, 0x67, 0x00, 0x71, 0x00, 0x7b, 0x00,
+  0x85, 0x00, 0x8f, 0x00, 0x99, 0x00, 0xa3, 0x00, 0xad, 0x00, 0xb7, 0x00,
+  0xc1, 0x00, 0xcb, 0x00, 0xd5, 0x00, 0xdf, 0x00, 0xe9, 0x00, 0xf3, 0x00,
+  0xfd, 0x00, 0x07, 0x01, 0x11, 0x01, 0x1b, 0x01, 0x25, 0x01, 0x2f, 0x01,
+  0x39, 0x01, 0x43, 0x01, 0x4b, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x17, 0x00,
+  0x22, 0x00, 0x2e, 0x00, 0x39, 0x00, 0x44, 0x00, 0x51, 0x00, 0x5c, 0x00,
+  0x67, 0x00, 0x7d, 0x00, 0x83, 0x00, 0x89, 0x00, 0x90, 0x00, 0x9a, 0x00,
+  0x00, 0x00, 0x1e, 0x00, 0x26, 0x00, 0x2d, 0x00, 0x3a, 0x00, 0x4a, 0x00,
+  0x57, 0x00, 0x5e, 0x00, 0x6e, 0x00, 0x78, 0x00, 0x7f, 0x00, 0x87, 0x00,
+  0x8e, 0x00, 0x95, 0x00, 0x9f, 0x00, 0xa7, 0x00, 0x00, 0x00, 0x20, 0x00,
+  0x39, 0x00, 0x43, 0x00, 0x4d, 0x00, 0x54, 0x00, 0x5d, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x14, 0x00, 0x1e, 0x00, 0x28, 0x00, 0x32, 0x00, 0x3c, 0x00,
+  0x46, 0x00, 0x50, 0x00, 0x5a, 0x00, 0x64, 0x00, 0x6e, 0x00, 0x78, 0x00,
+  0x82, 0x00, 0x8c, 0x00, 0x96, 0x00, 0xa0, 0x00, 0xaa, 0x00, 0xb4, 0x00,
+  0xc8, 0x00, 0xd1, 0x00, 0xdb, 0x00, 0xe5, 0x00, 0xef, 0x00, 0xf9, 0x00,
+  0x03, 0x01, 0x0c, 0x01, 0x15, 0x01, 0x1f, 0x01, 0x28, 0x01, 0x31, 0x01,
+  0x3a, 0x01, 0x43, 0x01, 0x4c, 0x01, 0x5f, 0x01, 0x68, 0x01, 0x71, 0x01,
+  0x7a, 0x01, 0x00, 0x00, 0x17, 0x00, 0x22, 0x00, 0x2d, 0x00, 0x38, 0x00,
+  0x43, 0x00, 0x4e, 0x00, 0x54, 0x00, 0x00, 0x00, 0x07, 0x00, 0x1c, 0x00,
+  0x2a, 0x00, 0x3a, 0x00, 0x48, 0x00, 0x4f, 0x00, 0x56, 0x00, 0x5f, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x18, 0x00, 0x1e, 0x00, 0x29, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x1d, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x15, 0x00, 0x1f, 0x00,
+  0x25, 0x00, 0x35, 0x00, 0x40, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x26, 0x00,
+  0x36, 0x00, 0x41, 0x00, 0x4a, 0x00, 0x53, 0x00, 0x00, 0x00, 0x06, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x12, 0x00, 0x19, 0x00, 0x25, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x1b, 0x00, 0x22, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x34, 0x00,
+  0x00, 0x00, 0x1c, 0x00, 0x26, 0x00, 0x30, 0x00, 0x3b, 0x00, 0x45, 0x00,
+  0x4f, 0x00, 0x59, 0x00, 0x63, 0x00, 0x6d, 0x00, 0x77, 0x00, 0x81, 0x00,
+  0x8b, 0x00, 0x95, 0x00, 0x9f, 0x00, 0xa9, 0x00, 0xb3, 0x00, 0xbd, 0x00,
+  0xc7, 0x00, 0xde, 0x00, 0xfa, 0x00, 0x14, 0x01, 0x1e, 0x01, 0x28, 0x01,
+  0x3d, 0x01, 0x43, 0x01, 0x00, 0x00, 0x0b, 0x00, 0x16, 0x00, 0x21, 0x00,
+  0x2c, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x14, 0x00, 0x28, 0x00, 0x32, 0x00,
+  0x46, 0x00, 0x4f, 0x00, 0x5c, 0x00, 0x66, 0x00, 0x70, 0x00, 0x79, 0x00,
+  0x83, 0x00, 0x98, 0x00, 0xac, 0x00, 0xc0, 0x00, 0xd6, 0x00, 0xe0, 0x00,
+  0xea, 0x00, 0xf5, 0x00, 0xff, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x14, 0x00, 0x1e, 0x00, 0x28, 0x00, 0x32, 0x00, 0x3c, 0x00,
+  0x46, 0x00, 0x50, 0x00, 0x5a, 0x00, 0x64, 0x00, 0x6e, 0x00, 0x78, 0x00,
+  0x82, 0x00, 0x8c, 0x00, 0x96, 0x00, 0xa0, 0x00, 0xaa, 0x00, 0xb9, 0x00,
+  0xc3, 0x00, 0xcd, 0x00, 0xe1, 0x00, 0xeb, 0x00, 0xf4, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x16, 0x00, 0x21, 0x00, 0x2a, 0x00, 0x30, 0x00, 0x37, 0x00,
+  0x42, 0x00, 0x49, 0x00, 0x4f, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x15, 0x00,
+  0x21, 0x00, 0x2a, 0x00, 0x33, 0x00, 0x43, 0x00, 0x4b, 0x00, 0x5a, 0x00,
+  0x64, 0x00, 0x6d, 0x00, 0x76, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x13, 0x00,
+  0x1e, 0x00, 0x37, 0x00, 0x41, 0x00, 0x49, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x1e, 0x00, 0x26, 0x00, 0x30, 0x00, 0x38, 0x00, 0x40, 0x00, 0x48, 0x00,
+  0x50, 0x00, 0x58, 0x00, 0x69, 0x00, 0x71, 0x00, 0x79, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x17, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x13, 0x00,
+  0x1b, 0x00, 0x2b, 0x00, 0x34, 0x00, 0x3d, 0x00, 0x4e, 0x00, 0x57, 0x00,
+  0x60, 0x00, 0x72, 0x00, 0x82, 0x00, 0x8a, 0x00, 0x92, 0x00, 0x9a, 0x00,
+  0xa2, 0x00, 0xa9, 0x00, 0xb1, 0x00, 0xc7, 0x00, 0xd0, 0x00, 0xd8, 0x00,
+  0xe1, 0x00, 0xe9, 0x00, 0xf1, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x07, 0x00,
+  0x12, 0x00, 0x00, 0x00, 0x19, 0x00, 0x22, 0x00, 0x28, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x18, 0x00, 0x00, 0x00, 0x07, 0x00,
+  0x15, 0x00, 0x1c, 0x00, 0x27, 0x00, 0x32, 0x00, 0x00, 0x00, 0x1d, 0x00,
+  0x41, 0x00, 0x4b, 0x00, 0x55, 0x00, 0x68, 0x00, 0x72, 0x00, 0x7c, 0x00,
+  0x86, 0x00, 0x90, 0x00, 0x9a, 0x00, 0xa4, 0x00, 0xae, 0x00, 0xb8, 0x00,
+  0xc2, 0x00, 0xcc, 0x00, 0xd6, 0x00, 0xe0, 0x00, 0xea, 0x00, 0xf4, 0x00,
+  0xfe, 0x00, 0x12, 0x01, 0x1f, 0x01, 0x29, 0x01, 0x33, 0x01, 0x3d, 0x01,
+  0x47, 0x01, 0x51, 0x01, 0x5b, 0x01, 0x65, 0x01, 0x6f, 0x01, 0x85, 0x01,
+  0x8f, 0x01, 0x96, 0x01, 0x9f, 0x01, 0x00, 0x00, 0x17, 0x00, 0x37, 0x00,
+  0x44, 0x00, 0x50, 0x00, 0x5b, 0x00, 0x66, 0x00, 0x71, 0x00, 0x7c, 0x00,
+  0x87, 0x00, 0x92, 0x00, 0x9d, 0x00, 0xa8, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x36, 0x00, 0x3d, 0x00, 0x45, 0x00, 0x55, 0x00, 0x61, 0x00, 0x6a, 0x00,
+  0x00, 0x00, 0x1f, 0x00, 0x44, 0x00, 0x4c, 0x00, 0x5b, 0x00, 0x6a, 0x00,
+  0x74, 0x00, 0x7e, 0x00, 0x8e, 0x00, 0x96, 0x00, 0x9e, 0x00, 0xae, 0x00,
+  0xb6, 0x00, 0xbe, 0x00, 0xc6, 0x00, 0xd0, 0x00, 0xd8, 0x00, 0x00, 0x00,
+  0x16, 0x00, 0x35, 0x00, 0x42, 0x00, 0x4c, 0x00, 0x56, 0x00, 0x60, 0x00,
+  0x6a, 0x00, 0x74, 0x00, 0x7e, 0x00, 0x88, 0x00, 0x92, 0x00, 0x9c, 0x00,
+  0xa6, 0x00, 0xb0, 0x00, 0xba, 0x00, 0xc4, 0x00, 0xce, 0x00, 0xd8, 0x00,
+  0xe2, 0x00, 0xec, 0x00, 0xf6, 0x00, 0x00, 0x01, 0x0a, 0x01, 0x14, 0x01,
+  0x1e, 0x01, 0x28, 0x01, 0x32, 0x01, 0x3c, 0x01, 0x46, 0x01, 0x55, 0x01,
+  0x00, 0x00, 0x10, 0x00, 0x34, 0x00, 0x3f, 0x00, 0x48, 0x00, 0x51, 0x00,
+  0x5c, 0x00, 0x67, 0x00, 0x72, 0x00, 0x7d, 0x00, 0x8f, 0x00, 0x9a, 0x00,
+  0xa5, 0x00, 0xb0, 0x00, 0xb9, 0x00, 0xc1, 0x00, 0xc9, 0x00, 0xcf, 0x00,
+  0xd7, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x2e, 0x00, 0x45, 0x00, 0x52, 0x00,
+  0x59, 0x00, 0x67, 0x00, 0x74, 0x00, 0x00, 0x00, 0x19, 0x00, 0x3b, 0x00,
+  0x4a, 0x00, 0x55, 0x00, 0x5d, 0x00, 0x65, 0x00, 0x6d, 0x00, 0x75, 0x00,
+  0x7d, 0x00, 0x8e, 0x00, 0x96, 0x00, 0x9e, 0x00, 0xa9, 0x00, 0xb8, 0x00,
+  0xc0, 0x00, 0xc6, 0x00, 0xce, 0x00, 0xd6, 0x00, 0xe1, 0x00, 0xf0, 0x00,
+  0xf8, 0x00, 0x00, 0x00, 0x13, 0x00, 0x1f, 0x00, 0x2b, 0x00, 0x3d, 0x00,
+  0x44, 0x00, 0x50, 0x00, 0x5c, 0x00, 0x68, 0x00, 0x00, 0x00, 0x12, 0x00,
+  0x36, 0x00, 0x3c, 0x00, 0x4b, 0x00, 0x5f, 0x00, 0x6d, 0x00, 0x75, 0x00,
+  0x00, 0x00, 0x0a, 0x00, 0x11, 0x00, 0x00, 0x00, 0x08, 0x00, 0x10, 0x00,
+  0x16, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x28, 0x00, 0x31, 0x00,
+  0x3a, 0x00, 0x00, 0x00, 0x19, 0x00, 0x21, 0x00, 0x29, 0x00, 0x3f, 0x00,
+  0x4c, 0x00, 0x5b, 0x00, 0x6a, 0x00, 0x73, 0x00, 0x7c, 0x00, 0x83, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x20, 0x00, 0x2d, 0x00, 0x33, 0x00, 0x00, 0x00,
+  0x19, 0x00, 0x25, 0x00, 0x31, 0x00, 0x39, 0x00, 0x42, 0x00, 0x53, 0x00,
+  0x5c, 0x00, 0x65, 0x00, 0x6d, 0x00, 0x75, 0x00, 0x7d, 0x00, 0x85, 0x00,
+  0x00, 0x00, 0x18, 0x00, 0x2f, 0x00, 0x39, 0x00, 0x43, 0x00, 0x4d, 0x00,
+  0x57, 0x00, 0x61, 0x00, 0x6b, 0x00, 0x75, 0x00, 0x7f, 0x00, 0x88, 0x00,
+  0x92, 0x00, 0x9c, 0x00, 0xa6, 0x00, 0xb0, 0x00, 0xb9, 0x00, 0xc0, 0x00,
+  0xc5, 0x00, 0xce, 0x00, 0xda, 0x00, 0xe5, 0x00, 0xee, 0x00, 0xf9, 0x00,
+  0x02, 0x01, 0x0b, 0x01, 0x00, 0x00, 0x1b, 0x00, 0x26, 0x00, 0x31, 0x00,
+  0x3a, 0x00, 0x45, 0x00, 0x50, 0x00, 0x65, 0x00, 0x73, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x2b, 0x00, 0x35, 0x00, 0x3e, 0x00, 0x51, 0x00, 0x5a, 0x00,
+  0x00, 0x00, 0x1c, 0x00, 0x40, 0x00, 0x51, 0x00, 0x5b, 0x00, 0x69, 0x00,
+  0x72, 0x00, 0x00, 0x00, 0x17, 0x00, 0x20, 0x00, 0x2a, 0x00, 0x34, 0x00,
+  0x3e, 0x00, 0x48, 0x00, 0x58, 0x00, 0x62, 0x00, 0x6c, 0x00, 0x76, 0x00,
+  0x80, 0x00, 0x8a, 0x00, 0x94, 0x00, 0x9e, 0x00, 0xa8, 0x00, 0xb2, 0x00,
+  0xbc, 0x00, 0xc6, 0x00, 0xd0, 0x00, 0xda, 0x00, 0xe4, 0x00, 0xee, 0x00,
+  0xf8, 0x00, 0x02, 0x01, 0x0c, 0x01, 0x16, 0x01, 0x27, 0x01, 0x30, 0x01,
+  0x38, 0x01, 0x41, 0x01, 0x00, 0x00, 0x10, 0x00, 0x1b, 0x00, 0x26, 0x00,
+  0x31, 0x00, 0x3c, 0x00, 0x47, 0x00, 0x52, 0x00, 0x5d, 0x00, 0x68, 0x00,
+  0x73, 0x00, 0x85, 0x00, 0x8c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x14, 0x00,
+  0x24, 0x00, 0x37, 0x00, 0x40, 0x00, 0x49, 0x00, 0x51, 0x00, 0x5a, 0x00,
+  0x62, 0x00, 0x6a, 0x00, 0x70, 0x00, 0x79, 0x00, 0x81, 0x00, 0x8b, 0x00,
+  0x94, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x15, 0x00, 0x21, 0x00, 0x2d, 0x00,
+  0x39, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x34, 0x00, 0x47, 0x00, 0x50, 0x00,
+  0x59, 0x00, 0x62, 0x00, 0x6e, 0x00, 0x7d, 0x00, 0x86, 0x00, 0x8f, 0x00,
+  0x97, 0x00, 0x9f, 0x00, 0xab, 0x00, 0xb3, 0x00, 0xbb, 0x00, 0xc5, 0x00,
+  0x00, 0x00, 0x21, 0x00, 0x30, 0x00, 0x46, 0x00, 0x57, 0x00, 0x5f, 0x00,
+  0x7a, 0x00, 0x82, 0x00, 0x89, 0x00, 0x90, 0x00, 0x97, 0x00, 0x9e, 0x00,
+  0x00, 0x00, 0x1e, 0x00, 0x2b, 0x00, 0x34, 0x00, 0x3c, 0x00, 0x45, 0x00,
+  0x4f, 0x00, 0x6b, 0x00, 0x7b, 0x00, 0x84, 0x00, 0x8d, 0x00, 0x96, 0x00,
+  0x9e, 0x00, 0xa7, 0x00, 0xb0, 0x00, 0xb9, 0x00, 0xc1, 0x00, 0xca, 0x00,
+  0xd2, 0x00, 0xda, 0x00, 0xe2, 0x00, 0xea, 0x00, 0xf2, 0x00, 0x07, 0x01,
+  0x0f, 0x01, 0x17, 0x01, 0x24, 0x01, 0x00, 0x00, 0x0b, 0x00, 0x1a, 0x00,
+  0x2e, 0x00, 0x39, 0x00, 0x44, 0x00, 0x50, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x1c, 0x00, 0x25, 0x00, 0x2c, 0x00, 0x32, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x16, 0x00, 0x1f, 0x00, 0x27, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x2f, 0x00,
+  0x3b, 0x00, 0x4d, 0x00, 0x5b, 0x00, 0x64, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x1c, 0x00, 0x24, 0x00, 0x2c, 0x00, 0x37, 0x00, 0x42, 0x00, 0x4d, 0x00,
+  0x00, 0x00, 0x16, 0x00, 0x1f, 0x00, 0x2b, 0x00, 0x38, 0x00, 0x41, 0x00,
+  0x4a, 0x00, 0x53, 0x00, 0x79, 0x00, 0x82, 0x00, 0x8b, 0x00, 0x9e, 0x00,
+  0xa8, 0x00, 0xb1, 0x00, 0xcb, 0x00, 0x00, 0x00, 0x08, 0x00, 0x1e, 0x00,
+  0x28, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x15, 0x00, 0x1f, 0x00,
+  0x2c, 0x00, 0x35, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x29, 0x00,
+  0x3e, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x1e, 0x00, 0x26, 0x00, 0x00, 0x00,
+  0x18, 0x00, 0x23, 0x00, 0x2e, 0x00, 0x3c, 0x00, 0x4e, 0x00, 0x55, 0x00,
+  0x00, 0x00, 0x1e, 0x00, 0x29, 0x00, 0x40, 0x00, 0x62, 0x00, 0x70, 0x00,
+  0x79, 0x00, 0x92, 0x00, 0x9a, 0x00, 0xa2, 0x00, 0xac, 0x00, 0xb4, 0x00,
+  0xbc, 0x00, 0xc2, 0x00, 0xca, 0x00, 0xd2, 0x00, 0xda, 0x00, 0xe0, 0x00,
+  0xe8, 0x00, 0xf0, 0x00, 0xf8, 0x00, 0xff, 0x00, 0x07, 0x01, 0x0f, 0x01,
+  0x17, 0x01, 0x00, 0x00, 0x2a, 0x00, 0x3f, 0x00, 0x4b, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x1a, 0x00, 0x21, 0x00, 0x27, 0x00, 0x00, 0x00, 0x0f, 0x00,
+  0x1c, 0x00, 0x3b, 0x00, 0x49, 0x00, 0x56, 0x00, 0x60, 0x00, 0x6a, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x21, 0x00, 0x29, 0x00, 0x39, 0x00, 0x41, 0x00,
+  0x51, 0x00, 0x62, 0x00, 0x6a, 0x00, 0x72, 0x00, 0x7a, 0x00, 0x8a, 0x00,
+  0x92, 0x00, 0x99, 0x00, 0xa1, 0x00, 0xa9, 0x00, 0xb1, 0x00, 0xb9, 0x00,
+  0xc2, 0x00, 0xca, 0x00, 0xd2, 0x00, 0x00, 0x00, 0x13, 0x00, 0x1f, 0x00,
+  0x3b, 0x00, 0x49, 0x00, 0x5e, 0x00, 0x67, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x23, 0x00, 0x2b, 0x00, 0x3b, 0x00, 0x44, 0x00, 0x00, 0x00, 0x17, 0x00,
+  0x2a, 0x00, 0x36, 0x00, 0x40, 0x00, 0x4b, 0x00, 0x55, 0x00, 0x5f, 0x00,
+  0x66, 0x00, 0x70, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1c, 0x00, 0x2c, 0x00,
+  0x3d, 0x00, 0x45, 0x00, 0x4d, 0x00, 0x53, 0x00, 0x69, 0x00, 0x74, 0x00,
+  0x7c, 0x00, 0x00, 0x00, 0x11, 0x00, 0x1d, 0x00, 0x26, 0x00, 0x38, 0x00,
+  0x45, 0x00, 0x4e, 0x00, 0x5f, 0x00, 0x68, 0x00, 0x71, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x13, 0x00, 0x22, 0x00, 0x33, 0x00, 0x3b, 0x00, 0x42, 0x00,
+  0x4a, 0x00, 0x53, 0x00, 0x5c, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x77, 0x00,
+  0x80, 0x00, 0x89, 0x00, 0x95, 0x00, 0x9e, 0x00, 0xa7, 0x00, 0x00, 0x00,
+  0x1b, 0x00, 0x21, 0x00, 0x27, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x18, 0x00,
+  0x2f, 0x00, 0x37, 0x00, 0x3f, 0x00, 0x47, 0x00, 0x4f, 0x00, 0x56, 0x00,
+  0x5d, 0x00, 0x64, 0x00, 0x6c, 0x00, 0x74, 0x00, 0x00, 0x00, 0x14, 0x00,
+  0x1d, 0x00, 0x2a, 0x00, 0x33, 0x00, 0x3c, 0x00, 0x45, 0x00, 0x51, 0x00,
+  0x5a, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x1e, 0x00, 0x30, 0x00, 0x43, 0x00,
+  0x4c, 0x00, 0x5f, 0x00, 0x68, 0x00, 0x00, 0x00, 0x10, 0x00, 0x1a, 0x00,
+  0x2b, 0x00, 0x34, 0x00, 0x00, 0x00, 0x18, 0x00, 0x37, 0x00, 0x43, 0x00,
+  0x4b, 0x00, 0x52, 0x00, 0x5b, 0x00, 0x61, 0x00, 0x6b, 0x00, 0x72, 0x00,
+  0x7c, 0x00, 0x84, 0x00, 0x8b, 0x00, 0x95, 0x00, 0x9f, 0x00, 0xa6, 0x00,
+  0xad, 0x00, 0xb4, 0x00, 0xbb, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x20, 0x00,
+  0x3a, 0x00, 0x42, 0x00, 0x48, 0x00, 0x4e, 0x00, 0x57, 0x00, 0x00, 0x00,
+  0x15, 0x00, 0x20, 0x00, 0x27, 0x00, 0x00, 0x00, 0x17, 0x00, 0x21, 0x00,
+  0x2b, 0x00, 0x36, 0x00, 0x40, 0x00, 0x4a, 0x00, 0x5d, 0x00, 0x6d, 0x00,
+  0x82, 0x00, 0x8c, 0x00, 0x95, 0x00, 0x9f, 0x00, 0xa9, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x19, 0x00, 0x33, 0x00, 0x3d, 0x00, 0x46, 0x00, 0x4d, 0x00,
+  0x6b, 0x00, 0x76, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x1b, 0x00,
+  0x24, 0x00, 0x2d, 0x00, 0x39, 0x00, 0x44, 0x00, 0x4d, 0x00, 0x58, 0x00,
+  0x00, 0x00, 0x26, 0x00, 0x2e, 0x00, 0x36, 0x00, 0x3f, 0x00, 0x46, 0x00,
+  0x4f, 0x00, 0x58, 0x00, 0x60, 0x00, 0x6c, 0x00, 0x7b, 0x00, 0x8d, 0x00,
+  0x00, 0x00, 0x1b, 0x00, 0x3b, 0x00, 0x48, 0x00, 0x51, 0x00, 0x64, 0x00,
+  0x6d, 0x00, 0x77, 0x00, 0x80, 0x00, 0x8e, 0x00, 0x9d, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x34, 0x00, 0x54, 0x00, 0x6e, 0x00, 0x79, 0x00, 0x84, 0x00,
+  0x8f, 0x00, 0x9f, 0x00, 0xaf, 0x00, 0xc5, 0x00, 0xcd, 0x00, 0xd5, 0x00,
+  0xe5, 0x00, 0xed, 0x00, 0xf3, 0x00, 0xfb, 0x00, 0x03, 0x01, 0x0b, 0x01,
+  0x16, 0x01, 0x1e, 0x01, 0x2d, 0x01, 0x33, 0x01, 0x3b, 0x01, 0x43, 0x01,
+  0x49, 0x01, 0x54, 0x01, 0x6a, 0x01, 0x00, 0x00, 0x12, 0x00, 0x37, 0x00,
+  0x43, 0x00, 0x4c, 0x00, 0x55, 0x00, 0x5e, 0x00, 0x67, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x13, 0x00, 0x2f, 0x00, 0x3c, 0x00, 0x44, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x17, 0x00, 0x1f, 0x00,
+  0x00, 0x00, 0x0a, 0x00, 0x21, 0x00, 0x2e, 0x00, 0x3b, 0x00, 0x44, 0x00,
+  0x4f, 0x00, 0x62, 0x00, 0x6f, 0x00, 0x86, 0x00, 0x90, 0x00, 0x99, 0x00,
+  0xa2, 0x00, 0xab, 0x00, 0xb4, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x15, 0x00, 0x1f, 0x00, 0x30, 0x00, 0x36, 0x00, 0x3d, 0x00,
+  0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x15, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x13, 0x00, 0x1c, 0x00, 0x21, 0x00,
+  0x28, 0x00, 0x32, 0x00, 0x3e, 0x00, 0x48, 0x00, 0x51, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x1d, 0x00, 0x25, 0x00, 0x2d, 0x00, 0x33, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x00, 0x00, 0x19, 0x00, 0x22, 0x00, 0x2c, 0x00, 0x35, 0x00,
+  0x3c, 0x00, 0x46, 0x00, 0x4d, 0x00, 0x54, 0x00, 0x00, 0x00, 0x07, 0x00,
+  0x16, 0x00, 0x2b, 0x00, 0x34, 0x00, 0x3b, 0x00, 0x42, 0x00, 0x4a, 0x00,
+  0x56, 0x00, 0x60, 0x00, 0x67, 0x00, 0x71, 0x00, 0x7a, 0x00, 0x00, 0x00,
+  0x17, 0x00, 0x1f, 0x00, 0x27, 0x00, 0x2d, 0x00, 0x35, 0x00, 0x3d, 0x00,
+  0x00, 0x00, 0x1a, 0x00, 0x24, 0x00, 0x2e, 0x00, 0x38, 0x00, 0x42, 0x00,
+  0x4c, 0x00, 0x56, 0x00, 0x60, 0x00, 0x6a, 0x00, 0x75, 0x00, 0x7f, 0x00,
+  0x89, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x25, 0x00, 0x34, 0x00,
+  0x47, 0x00, 0x58, 0x00, 0x68, 0x00, 0x77, 0x00, 0x80, 0x00, 0x8b, 0x00,
+  0x95, 0x00, 0x9c, 0x00, 0xa5, 0x00, 0xad, 0x00, 0xb6, 0x00, 0xc1, 0x00,
+  0xca, 0x00, 0xd7, 0x00, 0xea, 0x00, 0x00, 0x00, 0x20, 0x00, 0x3c, 0x00,
+  0x42, 0x00, 0x4b, 0x00, 0x54, 0x00, 0x5e, 0x00, 0x66, 0x00, 0x6f, 0x00,
+  0x00, 0x00, 0x0a, 0x00, 0x18, 0x00, 0x21, 0x00, 0x28, 0x00, 0x33, 0x00,
+  0x3e, 0x00, 0x45, 0x00, 0x4e, 0x00, 0x57, 0x00, 0x5d, 0x00, 0x66, 0x00,
+  0x6f, 0x00, 0x76, 0x00, 0x00, 0x00, 0x09, 0x00, 0x15, 0x00, 0x1f, 0x00,
+  0x28, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x14, 0x00, 0x2d, 0x00,
+  0x42, 0x00, 0x4b, 0x00, 0x57, 0x00, 0x62, 0x00, 0x6b, 0x00, 0x79, 0x00,
+  0x81, 0x00, 0x87, 0x00, 0x90, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x18, 0x00,
+  0x24, 0x00, 0x30, 0x00, 0x3c, 0x00, 0x48, 0x00, 0x54, 0x00, 0x63, 0x00,
+  0x6f, 0x00, 0x78, 0x00, 0x90, 0x00, 0x9c, 0x00, 0xa7, 0x00, 0xb1, 0x00,
+  0xc5, 0x00, 0xcf, 0x00, 0xd9, 0x00, 0xee, 0x00, 0xf8, 0x00, 0x0d, 0x01,
+  0x17, 0x01, 0x21, 0x01, 0x00, 0x00, 0x07, 0x00, 0x11, 0x00, 0x18, 0x00,
+  0x00, 0x00, 0x15, 0x00, 0x2b, 0x00, 0x38, 0x00, 0x41, 0x00, 0x47, 0x00,
+  0x00, 0x00, 0x18, 0x00, 0x31, 0x00, 0x3a, 0x00, 0x44, 0x00, 0x52, 0x00,
+  0x5c, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x78, 0x00, 0x89, 0x00, 0x91, 0x00,
+  0xa5, 0x00, 0xae, 0x00, 0xb5, 0x00, 0x00, 0x00, 0x11, 0x00, 0x1b, 0x00,
+  0x24, 0x00, 0x2e, 0x00, 0x35, 0x00, 0x46, 0x00, 0x57, 0x00, 0x61, 0x00,
+  0x6a, 0x00, 0x74, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x1f, 0x00, 0x00, 0x00,
+  0x18, 0x00, 0x00, 0x00, 0x19, 0x00, 0x21, 0x00, 0x3b, 0x00, 0x43, 0x00,
+  0x4c, 0x00, 0x59, 0x00, 0x61, 0x00, 0x75, 0x00, 0x00, 0x00, 0x0d, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x08, 0x00, 0x20, 0x00, 0x29, 0x00, 0x33, 0x00,
+  0x42, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x15, 0x00, 0x1f, 0x00, 0x29, 0x00,
+  0x33, 0x00, 0x3d, 0x00, 0x47, 0x00, 0x4e, 0x00, 0x63, 0x00, 0x6c, 0x00,
+  0x78, 0x00, 0x81, 0x00, 0x8a, 0x00, 0x9b, 0x00, 0x00, 0x00, 0x25, 0x00,
+  0x41, 0x00, 0x5b, 0x00, 0x65, 0x00, 0x77, 0x00, 0x88, 0x00, 0x90, 0x00,
+  0x98, 0x00, 0xa7, 0x00, 0xad, 0x00, 0xb1, 0x00, 0xba, 0x00, 0xc3, 0x00,
+  0xcc, 0x00, 0xd4, 0x00, 0x00, 0x00, 0x17, 0x00, 0x25, 0x00, 0x2e, 0x00,
+  0x00, 0x00, 0x0b, 0x00, 0x18, 0x00, 0x20, 0x00, 0x28, 0x00, 0x33, 0x00,
+  0x39, 0x00, 0x41, 0x00, 0x49, 0x00, 0x00, 0x00, 0x19, 0x00, 0x22, 0x00,
+  0x2c, 0x00, 0x36, 0x00, 0x40, 0x00, 0x4a, 0x00, 0x5e, 0x00, 0x68, 0x00,
+  0x72, 0x00, 0x7c, 0x00, 0x85, 0x00, 0x8f, 0x00, 0x9a, 0x00, 0xa3, 0x00,
+  0xad, 0x00, 0xb7, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x16, 0x00, 0x21, 0x00,
+  0x2c, 0x00, 0x38, 0x00, 0x43, 0x00, 0x4e, 0x00, 0x55, 0x00, 0x60, 0x00,
+  0x6b, 0x00, 0x72, 0x00, 0x88, 0x00, 0x93, 0x00, 0x9e, 0x00, 0xa8, 0x00,
+  0xaf, 0x00, 0x00, 0x00, 0x09, 0x00, 0x1b, 0x00, 0x28, 0x00, 0x39, 0x00,
+  0x3f, 0x00, 0x4d, 0x00, 0x5b, 0x00, 0x65, 0x00, 0x6c, 0x00, 0x7e, 0x00,
+  0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x17, 0x00, 0x28, 0x00, 0x33, 0x00,
+  0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x1a, 0x00, 0x24, 0x00,
+  0x2f, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x18, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x26, 0x00, 0x3e, 0x00, 0x4c, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x14, 0x00, 0x1e, 0x00, 0x32, 0x00, 0x39, 0x00, 0x43, 0x00,
+  0x4d, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x16, 0x00, 0x26, 0x00, 0x30, 0x00,
+  0x39, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x14, 0x00, 0x1e, 0x00, 0x28, 0x00,
+  0x32, 0x00, 0x3c, 0x00, 0x46, 0x00, 0x50, 0x00, 0x5a, 0x00, 0x64, 0x00,
+  0x6e, 0x00, 0x78, 0x00, 0x82, 0x00, 0x91, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x12, 0x00, 0x23, 0x00, 0x36, 0x00, 0x40, 0x00, 0x4a, 0x00, 0x50, 0x00,
+  0x59, 0x00, 0x63, 0x00, 0x6c, 0x00, 0x75, 0x00, 0x80, 0x00, 0x89, 0x00,
+  0x92, 0x00, 0x9c, 0x00, 0xa7, 0x00, 0x00, 0x00, 0x17, 0x00, 0x2a, 0x00,
+  0x38, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x2d, 0x00, 0x38, 0x00,
+  0x43, 0x00, 0x49, 0x00, 0x55, 0x00, 0x60, 0x00, 0x6b, 0x00, 0x76, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x27, 0x00, 0x31, 0x00, 0x3b, 0x00,
+  0x45, 0x00, 0x4f, 0x00, 0x59, 0x00, 0x63, 0x00, 0x6d, 0x00, 0x77, 0x00,
+  0x81, 0x00, 0x8b, 0x00, 0x95, 0x00, 0x9e, 0x00, 0xaa, 0x00, 0xb0, 0x00,
+  0xb6, 0x00, 0x00, 0x00, 0x07, 0x00, 0x0f, 0x00, 0x1a, 0x00, 0x25, 0x00,
+  0x30, 0x00, 0x3b, 0x00, 0x46, 0x00, 0x52, 0x00, 0x5d, 0x00, 0x77, 0x00,
+  0x92, 0x00, 0xad, 0x00, 0xc8, 0x00, 0xd0, 0x00, 0xd9, 0x00, 0xec, 0x00,
+  0xf9, 0x00, 0x00, 0x01, 0x07, 0x01, 0x19, 0x01, 0x20, 0x01, 0x00, 0x00,
+  0x0a, 0x00, 0x14, 0x00, 0x1e, 0x00, 0x30, 0x00, 0x44, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x16, 0x00, 0x20, 0x00, 0x2c, 0x00, 0x43, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x21, 0x00, 0x00, 0x00, 0x07, 0x00, 0x11, 0x00, 0x1a, 0x00,
+  0x22, 0x00, 0x29, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x1e, 0x00, 0x28, 0x00,
+  0x32, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x11, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x00, 0x0e, 0x00, 0x15, 0x00, 0x20, 0x00, 0x2d, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x19, 0x00, 0x25, 0x00, 0x2e, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x14, 0x00, 0x1b, 0x00, 0x25, 0x00,
+  0x2f, 0x00, 0x42, 0x00, 0x56, 0x00, 0x65, 0x00, 0x73, 0x00, 0x7d, 0x00,
+  0x84, 0x00, 0x8e, 0x00, 0x00, 0x00, 0x09, 0x00, 0x12, 0x00, 0x1c, 0x00,
+  0x25, 0x00, 0x2e, 0x00, 0x40, 0x00, 0x53, 0x00, 0x5c, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x12, 0x00, 0x29, 0x00, 0x31, 0x00, 0x00, 0x00, 0x0b, 0x00,
+  0x13, 0x00, 0x1f, 0x00, 0x34, 0x00, 0x3f, 0x00, 0x45, 0x00, 0x50, 0x00,
+  0x00, 0x00, 0x0a, 0x00, 0x15, 0x00, 0x1f, 0x00, 0x29, 0x00, 0x3d, 0x00,
+  0x47, 0x00, 0x51, 0x00, 0x5b, 0x00, 0x65, 0x00, 0x6f, 0x00, 0x79, 0x00,
+  0x83, 0x00, 0x8f, 0x00, 0x98, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x16, 0x00,
+  0x21, 0x00, 0x2c, 0x00, 0x37, 0x00, 0x42, 0x00, 0x4d, 0x00, 0x58, 0x00,
+  0x00, 0x00, 0x08, 0x00, 0x10, 0x00, 0x1e, 0x00, 0x26, 0x00, 0x2d, 0x00,
+  0x36, 0x00, 0x3f, 0x00, 0x4c, 0x00, 0x55, 0x00, 0x5e, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x18, 0x00, 0x24, 0x00, 0x30, 0x00, 0x3c, 0x00, 0x48, 0x00,
+  0x62, 0x00, 0x6b, 0x00, 0x00, 0x00, 0x09, 0x00, 0x12, 0x00, 0x24, 0x00,
+  0x37, 0x00, 0x41, 0x00, 0x47, 0x00, 0x51, 0x00, 0x5a, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x1b, 0x00, 0x24, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x16, 0x00,
+  0x1d, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x26, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x12, 0x00, 0x1c, 0x00, 0x25, 0x00, 0x2e, 0x00, 0x38, 0x00, 0x41, 0x00,
+  0x53, 0x00, 0x64, 0x00, 0x76, 0x00, 0x7f, 0x00, 0x88, 0x00, 0x91, 0x00,
+  0x9a, 0x00, 0xa3, 0x00, 0xac, 0x00, 0xb5, 0x00, 0xbe, 0x00, 0xc7, 0x00,
+  0xd0, 0x00, 0xd8, 0x00, 0xe1, 0x00, 0xea, 0x00, 0xf3, 0x00, 0xfc, 0x00,
+  0x00, 0x00, 0x16, 0x00, 0x22, 0x00, 0x28, 0x00, 0x34, 0x00, 0x3d, 0x00,
+  0x46, 0x00, 0x4f, 0x00, 0x58, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x21, 0x00,
+  0x00, 0x00, 0x08, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x08, 0x00, 0x17, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x15, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x1a, 0x00,
+  0x23, 0x00, 0x2c, 0x00, 0x35, 0x00, 0x40, 0x00, 0x47, 0x00, 0x4d, 0x00,
+  0x5a, 0x00, 0x62, 0x00, 0x69, 0x00, 0x72, 0x00, 0x7f, 0x00, 0x8f, 0x00,
+  0x9f, 0x00, 0xa7, 0x00, 0xae, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x13, 0x00,
+  0x19, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x14, 0x00, 0x1e, 0x00,
+  0x28, 0x00, 0x32, 0x00, 0x3c, 0x00, 0x46, 0x00, 0x00, 0x00, 0x0b, 0x00,
+  0x16, 0x00, 0x22, 0x00, 0x2d, 0x00, 0x38, 0x00, 0x43, 0x00, 0x4e, 0x00,
+  0x59, 0x00, 0x64, 0x00, 0x6f, 0x00, 0x7a, 0x00, 0x85, 0x00, 0x8d, 0x00,
+  0x97, 0x00, 0x9f, 0x00, 0xa6, 0x00, 0xb7, 0x00, 0x00, 0x00, 0x18, 0x00,
+  0x24, 0x00, 0x2d, 0x00, 0x42, 0x00, 0x4b, 0x00, 0x55, 0x00, 0x5f, 0x00,
+  0x69, 0x00, 0x72, 0x00, 0x7b, 0x00, 0x85, 0x00, 0x8f, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x1a, 0x00, 0x21, 0x00, 0x27, 0x00, 0x2d, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x1c, 0x00, 0x40, 0x00, 0x46, 0x00, 0x5a, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x10, 0x00, 0x16, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x0a, 0x00,
+  0x14, 0x00, 0x1d, 0x00, 0x27, 0x00, 0x31, 0x00, 0x00, 0x00, 0x11, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00,
+  0x12, 0x00, 0x19, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x1d, 0x00, 0x27, 0x00,
+  0x2d, 0x00, 0x00, 0x00, 0x07, 0x00, 0x10, 0x00, 0x16, 0x00, 0x22, 0x00,
+  0x28, 0x00, 0x34, 0x00, 0x00, 0x00, 0x09, 0x00, 0x0f, 0x00, 0x16, 0x00,
+  0x3c, 0x00, 0x46, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x33, 0x00, 0x3d, 0x00,
+  0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x21, 0x00, 0x33, 0x00,
+  0x4b, 0x00, 0x5e, 0x00, 0x69, 0x00, 0x74, 0x00, 0x8d, 0x00, 0x95, 0x00,
+  0xac, 0x00, 0xb7, 0x00, 0xc0, 0x00, 0xcb, 0x00, 0x00, 0x00, 0x1f, 0x00,
+  0x32, 0x00, 0x48, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x13, 0x00, 0x1a, 0x00,
+  0x23, 0x00, 0x2c, 0x00, 0x35, 0x00, 0x3f, 0x00, 0x49, 0x00, 0x56, 0x00,
+  0x5f, 0x00, 0x68, 0x00, 0x72, 0x00, 0x7b, 0x00, 0x00, 0x00, 0x13, 0x00,
+  0x00, 0x00, 0x13, 0x00, 0x1c, 0x00, 0x25, 0x00, 0x36, 0x00, 0x48, 0x00,
+  0x4f, 0x00, 0x56, 0x00, 0x00, 0x00, 0x14, 0x00, 0x23, 0x00, 0x29, 0x00,
+  0x00, 0x00, 0x0a, 0x00, 0x12, 0x00, 0x1c, 0x00, 0x26, 0x00, 0x30, 0x00,
+  0x36, 0x00, 0x40, 0x00, 0x4a, 0x00, 0x56, 0x00, 0x00, 0x00, 0x07, 0x00,
+  0x0f, 0x00, 0x00, 0x00, 0x09, 0x00, 0x12, 0x00, 0x1f, 0x00, 0x28, 0x00,
+  0x32, 0x00, 0x3b, 0x00, 0x44, 0x00, 0x55, 0x00, 0x62, 0x00, 0x69, 0x00,
+  0x72, 0x00, 0x7b, 0x00, 0x84, 0x00, 0x8d, 0x00, 0x96, 0x00, 0xa0, 0x00,
+  0xa9, 0x00, 0xb2, 0x00, 0xbb, 0x00, 0xc4, 0x00, 0xce, 0x00, 0xe0, 0x00,
+  0xe9, 0x00, 0xf2, 0x00, 0xfc, 0x00, 0x05, 0x01, 0x0c, 0x01, 0x14, 0x01,
+  0x1d, 0x01, 0x26, 0x01, 0x2f, 0x01, 0x38, 0x01, 0x41, 0x01, 0x49, 0x01,
+  0x5a, 0x01, 0x00, 0x00, 0x1c, 0x00, 0x26, 0x00, 0x37, 0x00, 0x00, 0x00,
+  0x1b, 0x00, 0x23, 0x00, 0x2b, 0x00, 0x3a, 0x00, 0x42, 0x00, 0x4d, 0x00,
+  0x57, 0x00, 0x61, 0x00, 0x68, 0x00, 0x6f, 0x00, 0x79, 0x00, 0x81, 0x00,
+  0x88, 0x00, 0x92, 0x00, 0x9a, 0x00, 0xa2, 0x00, 0xab, 0x00, 0xb1, 0x00,
+  0xb9, 0x00, 0xc3, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00,
+  0x10, 0x00, 0x1d, 0x00, 0x2c, 0x00, 0x36, 0x00, 0x45, 0x00, 0x4e, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x18, 0x00, 0x21, 0x00, 0x30, 0x00, 0x3e, 0x00,
+  0x47, 0x00, 0x4d, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x15, 0x00, 0x22, 0x00,
+  0x2d, 0x00, 0x36, 0x00, 0x3f, 0x00, 0x49, 0x00, 0x51, 0x00, 0x5d, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x13, 0x00, 0x1a, 0x00, 0x21, 0x00, 0x28, 0x00,
+  0x2f, 0x00, 0x36, 0x00, 0x47, 0x00, 0x4e, 0x00, 0x54, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x17, 0x00, 0x26, 0x00, 0x30, 0x00, 0x37, 0x00, 0x3e, 0x00,
+  0x47, 0x00, 0x50, 0x00, 0x57, 0x00, 0x00, 0x00, 0x12, 0x00, 0x1c, 0x00,
+  0x00, 0x00, 0x1f, 0x00, 0x3a, 0x00, 0x43, 0x00, 0x53, 0x00, 0x5d, 0x00,
+  0x76, 0x00, 0x89, 0x00, 0x92, 0x00, 0x9b, 0x00, 0xa5, 0x00, 0xaf, 0x00,
+  0xb9, 0x00, 0xc2, 0x00, 0xcb, 0x00, 0xd5, 0x00, 0xdb, 0x00, 0xe5, 0x00,
+  0xef, 0x00, 0xf8, 0x00, 0x01, 0x01, 0x0b, 0x01, 0x15, 0x01, 0x1e, 0x01,
+  0x28, 0x01, 0x00, 0x00, 0x13, 0x00, 0x1a, 0x00, 0x20, 0x00, 0x26, 0x00,
+  0x2f, 0x00, 0x40, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x39, 0x00, 0x42, 0x00,
+  0x4b, 0x00, 0x54, 0x00, 0x5d, 0x00, 0x63, 0x00, 0x6c, 0x00, 0x00, 0x00,
+  0x23, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x40, 0x00, 0x4a, 0x00, 0x54, 0x00,
+  0x5e, 0x00, 0x68, 0x00, 0x7d, 0x00, 0xa3, 0x00, 0xac, 0x00, 0xb6, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x12, 0x00, 0x1b, 0x00, 0x21, 0x00, 0x27, 0x00,
+  0x2d, 0x00, 0x35, 0x00, 0x3b, 0x00, 0x41, 0x00, 0x00, 0x00, 0x2f, 0x00,
+  0x4b, 0x00, 0x5f, 0x00, 0x7a, 0x00, 0x83, 0x00, 0x8c, 0x00, 0x95, 0x00,
+  0x9d, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x30, 0x00, 0x4b, 0x00, 0x54, 0x00,
+  0x5e, 0x00, 0x68, 0x00, 0x71, 0x00, 0x7a, 0x00, 0x83, 0x00, 0x8c, 0x00,
+  0xa3, 0x00, 0xac, 0x00, 0xb5, 0x00, 0xbe, 0x00, 0xc7, 0x00, 0xd0, 0x00,
+  0x00, 0x00, 0x08, 0x00, 0x10, 0x00, 0x1d, 0x00, 0x2a, 0x00, 0x32, 0x00,
+  0x3a, 0x00, 0x42, 0x00, 0x4f, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x29, 0x00,
+  0x3b, 0x00, 0x41, 0x00, 0x00, 0x00, 0x08, 0x00, 0x0e, 0x00, 0x16, 0x00,
+  0x1c, 0x00, 0x28, 0x00, 0x30, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x29, 0x00, 0x3a, 0x00, 0x51, 0x00, 0x5b, 0x00, 0x65, 0x00, 0x7a, 0x00,
+  0x8f, 0x00, 0xa4, 0x00, 0xb8, 0x00, 0xcc, 0x00, 0xd6, 0x00, 0xde, 0x00,
+  0xe8, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1d, 0x00,
+  0x28, 0x00, 0x32, 0x00, 0x3f, 0x00, 0x4a, 0x00, 0x60, 0x00, 0x74, 0x00,
+  0x7f, 0x00, 0x88, 0x00, 0x93, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1f, 0x00,
+  0x29, 0x00, 0x33, 0x00, 0x3c, 0x00, 0x43, 0x00, 0x4c, 0x00, 0x55, 0x00,
+  0x5f, 0x00, 0x66, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x2f, 0x00, 0x49, 0x00,
+  0x55, 0x00, 0x61, 0x00, 0x6d, 0x00, 0x79, 0x00, 0x85, 0x00, 0x91, 0x00,
+  0x9d, 0x00, 0xa9, 0x00, 0xb5, 0x00, 0xc1, 0x00, 0xcd, 0x00, 0xd9, 0x00,
+  0xe5, 0x00, 0xf1, 0x00, 0xfd, 0x00, 0x15, 0x01, 0x21, 0x01, 0x2e, 0x01,
+  0x3a, 0x01, 0x46, 0x01, 0x52, 0x01, 0x5e, 0x01, 0x6a, 0x01, 0x82, 0x01,
+  0x8e, 0x01, 0x9a, 0x01, 0xa6, 0x01, 0xb2, 0x01, 0xbe, 0x01, 0xca, 0x01,
+  0xd6, 0x01, 0xe2, 0x01, 0xef, 0x01, 0xfb, 0x01, 0x07, 0x02, 0x13, 0x02,
+  0x20, 0x02, 0x27, 0x02, 0x37, 0x02, 0x45, 0x02, 0x4c, 0x02, 0x55, 0x02,
+  0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x29, 0x00, 0x36, 0x00,
+  0x41, 0x00, 0x4d, 0x00, 0x57, 0x00, 0x60, 0x00, 0x69, 0x00, 0x79, 0x00,
+  0x8b, 0x00, 0x94, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1a, 0x00,
+  0x23, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x15, 0x00, 0x31, 0x00, 0x3a, 0x00,
+  0x49, 0x00, 0x57, 0x00, 0x5c, 0x00, 0x69, 0x00, 0x72, 0x00, 0x79, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x1d, 0x00, 0x2d, 0x00, 0x37, 0x00,
+  0x40, 0x00, 0x4a, 0x00, 0x54, 0x00, 0x5d, 0x00, 0x6c, 0x00, 0x7c, 0x00,
+  0x8c, 0x00, 0x95, 0x00, 0x9e, 0x00, 0xa7, 0x00, 0xb0, 0x00, 0xba, 0x00,
+  0xc3, 0x00, 0xd7, 0x00, 0xe0, 0x00, 0xe8, 0x00, 0xf2, 0x00, 0xfd, 0x00,
+  0x06, 0x01, 0x00, 0x00, 0x18, 0x00, 0x1e, 0x00, 0x33, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x28, 0x00, 0x00, 0x00, 0x0d, 0x00,
+  0x17, 0x00, 0x2c, 0x00, 0x36, 0x00, 0x3d, 0x00, 0x52, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x20, 0x00, 0x2d, 0x00, 0x36, 0x00, 0x3f, 0x00, 0x45, 0x00,
+  0x4e, 0x00, 0x57, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x19, 0x00, 0x34, 0x00,
+  0x48, 0x00, 0x5e, 0x00, 0x79, 0x00, 0x91, 0x00, 0x99, 0x00, 0x9f, 0x00,
+  0xa7, 0x00, 0xbf, 0x00, 0xc4, 0x00, 0xcd, 0x00, 0xd3, 0x00, 0xdb, 0x00,
+  0x00, 0x00, 0x20, 0x00, 0x3a, 0x00, 0x4f, 0x00, 0x6b, 0x00, 0x83, 0x00,
+  0x8a, 0x00, 0xa1, 0x00, 0xa9, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x28, 0x00,
+  0x40, 0x00, 0x5b, 0x00, 0x68, 0x00, 0x7b, 0x00, 0x8f, 0x00, 0x98, 0x00,
+  0xa0, 0x00, 0xa8, 0x00, 0x00, 0x00, 0x18, 0x00, 0x26, 0x00, 0x3e, 0x00,
+  0x50, 0x00, 0x5e, 0x00, 0x71, 0x00, 0x80, 0x00, 0x89, 0x00, 0x93, 0x00,
+  0x9a, 0x00, 0xa3, 0x00, 0xac, 0x00, 0x00, 0x00, 0x15, 0x00, 0x30, 0x00,
+  0x3c, 0x00, 0x53, 0x00, 0x6e, 0x00, 0x7a, 0x00, 0x86, 0x00, 0x92, 0x00,
+  0x9e, 0x00, 0xb8, 0x00, 0xc4, 0x00, 0xdc, 0x00, 0xe8, 0x00, 0xf4, 0x00,
+  0x00, 0x01, 0x0c, 0x01, 0x15, 0x01, 0x21, 0x01, 0x35, 0x01, 0x3e, 0x01,
+  0x47, 0x01, 0x51, 0x01, 0x5f, 0x01, 0x6b, 0x01, 0x75, 0x01, 0x88, 0x01,
+  0x94, 0x01, 0x9c, 0x01, 0xb2, 0x01, 0xbc, 0x01, 0xc6, 0x01, 0xce, 0x01,
+  0xd8, 0x01, 0xe1, 0x01, 0xe9, 0x01, 0xf2, 0x01, 0xfc, 0x01, 0x06, 0x02,
+  0x10, 0x02, 0x1a, 0x02, 0x2f, 0x02, 0x39, 0x02, 0x43, 0x02, 0x00, 0x00,
+  0x0f, 0x00, 0x25, 0x00, 0x35, 0x00, 0x52, 0x00, 0x69, 0x00, 0x70, 0x00,
+  0x7a, 0x00, 0x81, 0x00, 0x00, 0x00, 0x19, 0x00, 0x31, 0x00, 0x45, 0x00,
+  0x5e, 0x00, 0x78, 0x00, 0x9a, 0x00, 0xa2, 0x00, 0xaa, 0x00, 0xb3, 0x00,
+  0xc5, 0x00, 0xd6, 0x00, 0xdc, 0x00, 0xe5, 0x00, 0xed, 0x00, 0xf4, 0x00,
+  0x00, 0x00, 0x14, 0x00, 0x28, 0x00, 0x39, 0x00, 0x4b, 0x00, 0x66, 0x00,
+  0x72, 0x00, 0x78, 0x00, 0x7e, 0x00, 0x88, 0x00, 0x00, 0x00, 0x1c, 0x00,
+  0x2c, 0x00, 0x38, 0x00, 0x3e, 0x00, 0x46, 0x00, 0x00, 0x00, 0x19, 0x00,
+  0x28, 0x00, 0x37, 0x00, 0x3d, 0x00, 0x43, 0x00, 0x00, 0x00, 0x1e, 0x00,
+  0x2a, 0x00, 0x3c, 0x00, 0x46, 0x00, 0x50, 0x00, 0x68, 0x00, 0x72, 0x00,
+  0x7c, 0x00, 0x84, 0x00, 0x8d, 0x00, 0x95, 0x00, 0x00, 0x00, 0x1a, 0x00,
+  0x27, 0x00, 0x3d, 0x00, 0x46, 0x00, 0x4f, 0x00, 0x59, 0x00, 0x62, 0x00,
+  0x70, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x1a, 0x00, 0x29, 0x00, 0x33, 0x00,
+  0x3d, 0x00, 0x4a, 0x00, 0x57, 0x00, 0x5e, 0x00, 0x68, 0x00, 0x6f, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x25, 0x00, 0x3d, 0x00, 0x54, 0x00, 0x63, 0x00,
+  0x6c, 0x00, 0x75, 0x00, 0x7b, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x2c, 0x00,
+  0x3e, 0x00, 0x48, 0x00, 0x5e, 0x00, 0x68, 0x00, 0x72, 0x00, 0x7c, 0x00,
+  0x86, 0x00, 0x90, 0x00, 0x9a, 0x00, 0xa4, 0x00, 0xae, 0x00, 0xb8, 0x00,
+  0xc2, 0x00, 0xcc, 0x00, 0xd6, 0x00, 0xe0, 0x00, 0xea, 0x00, 0xfa, 0x00,
+  0x02, 0x01, 0x0a, 0x01, 0x12, 0x01, 0x1a, 0x01, 0x00, 0x00, 0x19, 0x00,
+  0x26, 0x00, 0x3d, 0x00, 0x42, 0x00, 0x00, 0x00, 0x14, 0x00, 0x1f, 0x00,
+  0x35, 0x00, 0x50, 0x00, 0x60, 0x00, 0x67, 0x00, 0x00, 0x00, 0x17, 0x00,
+  0x2f, 0x00, 0x48, 0x00, 0x64, 0x00, 0x76, 0x00, 0x7f, 0x00, 0x00, 0x00,
+  0x1d, 0x00, 0x2a, 0x00, 0x36, 0x00, 0x4e, 0x00, 0x65, 0x00, 0x7b, 0x00,
+  0x85, 0x00, 0x8f, 0x00, 0x99, 0x00, 0xa3, 0x00, 0xad, 0x00, 0xb7, 0x00,
+  0xc1, 0x00, 0xcb, 0x00, 0xd5, 0x00, 0xe0, 0x00, 0xea, 0x00, 0xf4, 0x00,
+  0xfe, 0x00, 0x08, 0x01, 0x12, 0x01, 0x1d, 0x01, 0x32, 0x01, 0x3c, 0x01,
+  0x53, 0x01, 0x6b, 0x01, 0x73, 0x01, 0x87, 0x01, 0x00, 0x00, 0x1b, 0x00,
+  0x27, 0x00, 0x3f, 0x00, 0x60, 0x00, 0x71, 0x00, 0x83, 0x00, 0x8d, 0x00,
+  0xa1, 0x00, 0xa8, 0x00, 0xb3, 0x00, 0xbd, 0x00, 0xc7, 0x00, 0xd2, 0x00,
+  0x00, 0x00, 0x15, 0x00, 0x25, 0x00, 0x3c, 0x00, 0x4c, 0x00, 0x5a, 0x00,
+  0x78, 0x00, 0x83, 0x00, 0x93, 0x00, 0xa0, 0x00, 0xa7, 0x00, 0xae, 0x00,
+  0xbb, 0x00, 0xc2, 0x00, 0xca, 0x00, 0xd3, 0x00, 0xda, 0x00, 0x00, 0x00,
+  0x1b, 0x00, 0x2b, 0x00, 0x39, 0x00, 0x47, 0x00, 0x5c, 0x00, 0x00, 0x00,
+  0x16, 0x00, 0x23, 0x00, 0x32, 0x00, 0x43, 0x00, 0x60, 0x00, 0x71, 0x00,
+  0x81, 0x00, 0x8a, 0x00, 0x93, 0x00, 0xa6, 0x00, 0xaf, 0x00, 0xb8, 0x00,
+  0xc1, 0x00, 0xca, 0x00, 0xdd, 0x00, 0x00, 0x00, 0x15, 0x00, 0x22, 0x00,
+  0x37, 0x00, 0x4a, 0x00, 0x60, 0x00, 0x00, 0x00, 0x10, 0x00, 0x2a, 0x00,
+  0x3c, 0x00, 0x4c, 0x00, 0x66, 0x00, 0x84, 0x00, 0x8d, 0x00, 0x97, 0x00,
+  0xa5, 0x00, 0xae, 0x00, 0xbe, 0x00, 0xc5, 0x00, 0xcf, 0x00, 0xd8, 0x00,
+  0xdf, 0x00, 0xe8, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x1d, 0x00, 0x34, 0x00,
+  0x41, 0x00, 0x65, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x1e, 0x00, 0x30, 0x00,
+  0x46, 0x00, 0x5a, 0x00, 0x76, 0x00, 0x7f, 0x00, 0x88, 0x00, 0x97, 0x00,
+  0xa8, 0x00, 0xb8, 0x00, 0xc1, 0x00, 0xd4, 0x00, 0xde, 0x00, 0xe7, 0x00,
+  0xf0, 0x00, 0xf9, 0x00, 0x02, 0x01, 0x0c, 0x01, 0x15, 0x01, 0x1e, 0x01,
+  0x27, 0x01, 0x30, 0x01, 0x39, 0x01, 0x42, 0x01, 0x4c, 0x01, 0x55, 0x01,
+  0x5e, 0x01, 0x67, 0x01, 0x70, 0x01, 0x81, 0x01, 0x8a, 0x01, 0x93, 0x01,
+  0x9c, 0x01, 0xa5, 0x01, 0x00, 0x00, 0x0e, 0x00, 0x25, 0x00, 0x3d, 0x00,
+  0x4d, 0x00, 0x65, 0x00, 0x80, 0x00, 0x8f, 0x00, 0x96, 0x00, 0x9c, 0x00,
+  0xa2, 0x00, 0xaa, 0x00, 0xb1, 0x00, 0x00, 0x00, 0x15, 0x00, 0x33, 0x00,
+  0x4d, 0x00, 0x60, 0x00, 0x74, 0x00, 0x7d, 0x00, 0x8f, 0x00, 0x98, 0x00,
+  0x00, 0x00, 0x35, 0x00, 0x4d, 0x00, 0x6c, 0x00, 0x8d, 0x00, 0x9c, 0x00,
+  0xb5, 0x00, 0xbe, 0x00, 0xc7, 0x00, 0xd1, 0x00, 0x00, 0x00, 0x0d, 0x00,
+  0x26, 0x00, 0x4e, 0x00, 0x64, 0x00, 0x89, 0x00, 0x93, 0x00, 0x9d, 0x00,
+  0xa7, 0x00, 0xb1, 0x00, 0xbb, 0x00, 0xce, 0x00, 0xd8, 0x00, 0xe2, 0x00,
+  0xec, 0x00, 0xf6, 0x00, 0x00, 0x01, 0x0a, 0x01, 0x14, 0x01, 0x1f, 0x01,
+  0x2b, 0x01, 0x3d, 0x01, 0x43, 0x01, 0x00, 0x00, 0x0e, 0x00, 0x1f, 0x00,
+  0x36, 0x00, 0x51, 0x00, 0x6b, 0x00, 0x83, 0x00, 0x91, 0x00, 0xa1, 0x00,
+  0xad, 0x00, 0xb4, 0x00, 0x00, 0x00, 0x17, 0x00, 0x26, 0x00, 0x40, 0x00,
+  0x4f, 0x00, 0x61, 0x00, 0x77, 0x00, 0x8f, 0x00, 0xa9, 0x00, 0xae, 0x00,
+  0xb7, 0x00, 0xc0, 0x00, 0xc9, 0x00, 0xcf, 0x00, 0x00, 0x00, 0x13, 0x00,
+  0x2a, 0x00, 0x3c, 0x00, 0x49, 0x00, 0x57, 0x00, 0x6d, 0x00, 0x92, 0x00,
+  0xa8, 0x00, 0xaf, 0x00, 0x00, 0x00, 0x22, 0x00, 0x39, 0x00, 0x54, 0x00,
+  0x70, 0x00, 0x8f, 0x00, 0xa9, 0x00, 0xc8, 0x00, 0xee, 0x00, 0xfd, 0x00,
+  0x0b, 0x01, 0x18, 0x01, 0x25, 0x01, 0x3f, 0x01, 0x4f, 0x01, 0x5f, 0x01,
+  0x69, 0x01, 0x73, 0x01, 0x7d, 0x01, 0x87, 0x01, 0x91, 0x01, 0x9b, 0x01,
+  0xa5, 0x01, 0xaf, 0x01, 0xb9, 0x01, 0xc3, 0x01, 0xcd, 0x01, 0xd7, 0x01,
+  0xe1, 0x01, 0xeb, 0x01, 0xfc, 0x01, 0x05, 0x02, 0x0f, 0x02, 0x18, 0x02,
+  0x24, 0x02, 0x39, 0x02, 0x41, 0x02, 0x4c, 0x02, 0x55, 0x02, 0x64, 0x02,
+  0x6c, 0x02, 0x74, 0x02, 0x7d, 0x02, 0x85, 0x02, 0x8d, 0x02, 0x95, 0x02,
+  0x9d, 0x02, 0xa5, 0x02, 0xad, 0x02, 0xb4, 0x02, 0xbc, 0x02, 0xc4, 0x02,
+  0x00, 0x00, 0x26, 0x00, 0x4b, 0x00, 0x59, 0x00, 0x67, 0x00, 0x74, 0x00,
+  0x8c, 0x00, 0xa6, 0x00, 0xb7, 0x00, 0xc6, 0x00, 0xce, 0x00, 0xd6, 0x00,
+  0xf0, 0x00, 0xf7, 0x00, 0x00, 0x00, 0x23, 0x00, 0x3b, 0x00, 0x57, 0x00,
+  0x74, 0x00, 0x8e, 0x00, 0xa9, 0x00, 0xc9, 0x00, 0xda, 0x00, 0xf4, 0x00,
+  0x0a, 0x01, 0x18, 0x01, 0x2e, 0x01, 0x3a, 0x01, 0x54, 0x01, 0x67, 0x01,
+  0x71, 0x01, 0x7d, 0x01, 0x87, 0x01, 0x9b, 0x01, 0xa5, 0x01, 0xaf, 0x01,
+  0xb9, 0x01, 0xce, 0x01, 0xd8, 0x01, 0xe0, 0x01, 0xf5, 0x01, 0xff, 0x01,
+  0x09, 0x02, 0x13, 0x02, 0x1d, 0x02, 0x27, 0x02, 0x30, 0x02, 0x3a, 0x02,
+  0x44, 0x02, 0x4e, 0x02, 0x56, 0x02, 0x00, 0x00, 0x26, 0x00, 0x36, 0x00,
+  0x4f, 0x00, 0x66, 0x00, 0x77, 0x00, 0x8e, 0x00, 0x9c, 0x00, 0xab, 0x00,
+  0xbb, 0x00, 0xc6, 0x00, 0xd2, 0x00, 0xdc, 0x00, 0xe3, 0x00, 0xf1, 0x00,
+  0x00, 0x00, 0x0f, 0x00, 0x1f, 0x00, 0x2c, 0x00, 0x3b, 0x00, 0x53, 0x00,
+  0x64, 0x00, 0x73, 0x00, 0x80, 0x00, 0x89, 0x00, 0x9a, 0x00, 0xab, 0x00,
+  0xbb, 0x00, 0xc3, 0x00, 0xd4, 0x00, 0xe5, 0x00, 0xee, 0x00, 0xf7, 0x00,
+  0xff, 0x00, 0x07, 0x01, 0x19, 0x01, 0x21, 0x01, 0x2a, 0x01, 0x37, 0x01,
+  0x3f, 0x01, 0x00, 0x00, 0x27, 0x00, 0x42, 0x00, 0x5b, 0x00, 0x6b, 0x00,
+  0x77, 0x00, 0x87, 0x00, 0x98, 0x00, 0xaf, 0x00, 0xbd, 0x00, 0xc6, 0x00,
+  0xcf, 0x00, 0xda, 0x00, 0xe3, 0x00, 0xec, 0x00, 0xf3, 0x00, 0xfd, 0x00,
+  0x06, 0x01, 0x1b, 0x01, 0x22, 0x01, 0x2b, 0x01, 0x32, 0x01, 0x00, 0x00,
+  0x17, 0x00, 0x30, 0x00, 0x43, 0x00, 0x5c, 0x00, 0x76, 0x00, 0x8d, 0x00,
+  0x9c, 0x00, 0xa4, 0x00, 0xb0, 0x00, 0xbf, 0x00, 0xcf, 0x00, 0xdc, 0x00,
+  0xe3, 0x00, 0xf3, 0x00, 0xff, 0x00, 0x11, 0x01, 0x19, 0x01, 0x21, 0x01,
+  0x29, 0x01, 0x31, 0x01, 0x3a, 0x01, 0x42, 0x01, 0x4b, 0x01, 0x53, 0x01,
+  0x00, 0x00, 0x18, 0x00, 0x31, 0x00, 0x3f, 0x00, 0x61, 0x00, 0x7e, 0x00,
+  0x8e, 0x00, 0x9c, 0x00, 0xa5, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x1e, 0x00,
+  0x2b, 0x00, 0x37, 0x00, 0x4d, 0x00, 0x59, 0x00, 0x65, 0x00, 0x71, 0x00,
+  0x7d, 0x00, 0x89, 0x00, 0x95, 0x00, 0x00, 0x00, 0x15, 0x00, 0x23, 0x00,
+  0x30, 0x00, 0x49, 0x00, 0x66, 0x00, 0x77, 0x00, 0x86, 0x00, 0x8d, 0x00,
+  0x97, 0x00, 0x9e, 0x00, 0xa5, 0x00, 0xba, 0x00, 0x00, 0x00, 0x1c, 0x00,
+  0x29, 0x00, 0x38, 0x00, 0x45, 0x00, 0x66, 0x00, 0x72, 0x00, 0x7e, 0x00,
+  0x91, 0x00, 0x9e, 0x00, 0xb5, 0x00, 0xbb, 0x00, 0xc3, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x20, 0x00, 0x2f, 0x00, 0x57, 0x00, 0x75, 0x00, 0x8e, 0x00,
+  0x9d, 0x00, 0xa7, 0x00, 0xbf, 0x00, 0xc5, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x1e, 0x00, 0x2c, 0x00, 0x43, 0x00, 0x5f, 0x00, 0x6c, 0x00, 0x76, 0x00,
+  0x80, 0x00, 0x8e, 0x00, 0x94, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x12, 0x00,
+  0x21, 0x00, 0x31, 0x00, 0x41, 0x00, 0x4e, 0x00, 0x5d, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x30, 0x00, 0x3d, 0x00, 0x5a, 0x00, 0x6a, 0x00, 0x7b, 0x00,
+  0x89, 0x00, 0x95, 0x00, 0xa1, 0x00, 0xb6, 0x00, 0xc4, 0x00, 0xde, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x2f, 0x00, 0x49, 0x00, 0x60, 0x00, 0x8c, 0x00,
+  0xa5, 0x00, 0xbb, 0x00, 0xca, 0x00, 0xd9, 0x00, 0x00, 0x00, 0x26, 0x00,
+  0x37, 0x00, 0x4d, 0x00, 0x59, 0x00, 0x70, 0x00, 0x81, 0x00, 0x95, 0x00,
+  0xa4, 0x00, 0xb7, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x22, 0x00, 0x39, 0x00,
+  0x51, 0x00, 0x5e, 0x00, 0x71, 0x00, 0x87, 0x00, 0x97, 0x00, 0xa4, 0x00,
+  0xb3, 0x00, 0xc8, 0x00, 0xd4, 0x00, 0xe4, 0x00, 0xee, 0x00, 0xf6, 0x00,
+  0xfe, 0x00, 0x08, 0x01, 0x12, 0x01, 0x00, 0x00, 0x0f, 0x00, 0x27, 0x00,
+  0x37, 0x00, 0x50, 0x00, 0x62, 0x00, 0x71, 0x00, 0x83, 0x00, 0x98, 0x00,
+  0x9e, 0x00, 0xb0, 0x00, 0xb8, 0x00, 0xbf, 0x00, 0xcd, 0x00, 0xe6, 0x00,
+  0xef, 0x00, 0xf6, 0x00, 0xfd, 0x00, 0x00, 0x00, 0x20, 0x00, 0x34, 0x00,
+  0x4c, 0x00, 0x74, 0x00, 0x84, 0x00, 0x96, 0x00, 0xa7, 0x00, 0xca, 0x00,
+  0xda, 0x00, 0xe2, 0x00, 0xea, 0x00, 0xf5, 0x00, 0x04, 0x01, 0x0c, 0x01,
+  0x1a, 0x01, 0x22, 0x01, 0x2f, 0x01, 0x38, 0x01, 0x40, 0x01, 0x48, 0x01,
+  0x50, 0x01, 0x58, 0x01, 0x60, 0x01, 0x68, 0x01, 0x00, 0x00, 0x0f, 0x00,
+  0x2e, 0x00, 0x3f, 0x00, 0x55, 0x00, 0x7f, 0x00, 0x8e, 0x00, 0xa0, 0x00,
+  0xb6, 0x00, 0xc1, 0x00, 0xca, 0x00, 0xd6, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x29, 0x00, 0x35, 0x00, 0x46, 0x00, 0x6f, 0x00, 0x8e, 0x00, 0xa0, 0x00,
+  0xb5, 0x00, 0xbe, 0x00, 0xc7, 0x00, 0xd9, 0x00, 0xe2, 0x00, 0xf6, 0x00,
+  0xff, 0x00, 0x08, 0x01, 0x10, 0x01, 0x00, 0x00, 0x1a, 0x00, 0x29, 0x00,
+  0x41, 0x00, 0x53, 0x00, 0x60, 0x00, 0x6e, 0x00, 0x78, 0x00, 0x97, 0x00,
+  0xa7, 0x00, 0xaf, 0x00, 0xb6, 0x00, 0xc4, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x2a, 0x00, 0x43, 0x00, 0x52, 0x00, 0x69, 0x00, 0x7a, 0x00, 0x8a, 0x00,
+  0x93, 0x00, 0x9b, 0x00, 0xa3, 0x00, 0xab, 0x00, 0xbc, 0x00, 0xcc, 0x00,
+  0xd8, 0x00, 0xe5, 0x00, 0xf5, 0x00, 0xfd, 0x00, 0x03, 0x01, 0x0c, 0x01,
+  0x14, 0x01, 0x1c, 0x01, 0x24, 0x01, 0x2c, 0x01, 0x35, 0x01, 0x3e, 0x01,
+  0x46, 0x01, 0x4e, 0x01, 0x56, 0x01, 0x5f, 0x01, 0x00, 0x00, 0x0f, 0x00,
+  0x1f, 0x00, 0x3a, 0x00, 0x4a, 0x00, 0x5a, 0x00, 0x76, 0x00, 0x8f, 0x00,
+  0xa0, 0x00, 0xb7, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x2b, 0x00, 0x43, 0x00,
+  0x50, 0x00, 0x60, 0x00, 0x6c, 0x00, 0x7c, 0x00, 0x8b, 0x00, 0x96, 0x00,
+  0xa1, 0x00, 0xa9, 0x00, 0xb1, 0x00, 0xc7, 0x00, 0xd0, 0x00, 0xda, 0x00,
+  0xe9, 0x00, 0xef, 0x00, 0x00, 0x00, 0x14, 0x00, 0x21, 0x00, 0x30, 0x00,
+  0x42, 0x00, 0x51, 0x00, 0x67, 0x00, 0x78, 0x00, 0x85, 0x00, 0x95, 0x00,
+  0x9b, 0x00, 0xa1, 0x00, 0x00, 0x00, 0x13, 0x00, 0x2b, 0x00, 0x3a, 0x00,
+  0x47, 0x00, 0x58, 0x00, 0x69, 0x00, 0x77, 0x00, 0x7f, 0x00, 0x9a, 0x00,
+  0xa2, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x27, 0x00, 0x40, 0x00, 0x5a, 0x00,
+  0x69, 0x00, 0x7e, 0x00, 0x8a, 0x00, 0x97, 0x00, 0xa0, 0x00, 0xa9, 0x00,
+  0xb2, 0x00, 0xbb, 0x00, 0xc4, 0x00, 0xcd, 0x00, 0xd5, 0x00, 0xdf, 0x00,
+  0x00, 0x00, 0x27, 0x00, 0x3b, 0x00, 0x49, 0x00, 0x67, 0x00, 0x72, 0x00,
+  0x81, 0x00, 0x91, 0x00, 0xa3, 0x00, 0xaf, 0x00, 0xb9, 0x00, 0xc2, 0x00,
+  0xce, 0x00, 0x00, 0x00, 0x27, 0x00, 0x39, 0x00, 0x51, 0x00, 0x85, 0x00,
+  0x93, 0x00, 0xa1, 0x00, 0xb6, 0x00, 0xd1, 0x00, 0xeb, 0x00, 0xf4, 0x00,
+  0xfb, 0x00, 0x05, 0x01, 0x0c, 0x01, 0x15, 0x01, 0x00, 0x00, 0x12, 0x00,
+  0x2a, 0x00, 0x5b, 0x00, 0x68, 0x00, 0x78, 0x00, 0x98, 0x00, 0xa0, 0x00,
+  0xaa, 0x00, 0xb2, 0x00, 0xba, 0x00, 0xc3, 0x00, 0xca, 0x00, 0xd2, 0x00,
+  0xd9, 0x00, 0x00, 0x00, 0x28, 0x00, 0x52, 0x00, 0x71, 0x00, 0x88, 0x00,
+  0xa3, 0x00, 0xc2, 0x00, 0xea, 0x00, 0x12, 0x01, 0x2e, 0x01, 0x42, 0x01,
+  0x52, 0x01, 0x75, 0x01, 0x8c, 0x01, 0xa3, 0x01, 0xb6, 0x01, 0xce, 0x01,
+  0xd7, 0x01, 0xdf, 0x01, 0xe5, 0x01, 0xef, 0x01, 0xf7, 0x01, 0x00, 0x02,
+  0x08, 0x02, 0x11, 0x02, 0x1a, 0x02, 0x23, 0x02, 0x2b, 0x02, 0x34, 0x02,
+  0x3d, 0x02, 0x45, 0x02, 0x4e, 0x02, 0x56, 0x02, 0x5f, 0x02, 0x00, 0x00,
+  0x11, 0x00, 0x1f, 0x00, 0x36, 0x00, 0x47, 0x00, 0x53, 0x00, 0x00, 0x00,
+  0x29, 0x00, 0x54, 0x00, 0x74, 0x00, 0x8c, 0x00, 0xa8, 0x00, 0xc8, 0x00,
+  0xf1, 0x00, 0x1a, 0x01, 0x33, 0x01, 0x47, 0x01, 0x5e, 0x01, 0x70, 0x01,
+  0x8e, 0x01, 0xa5, 0x01, 0xba, 0x01, 0xce, 0x01, 0xda, 0x01, 0xe6, 0x01,
+  0xf2, 0x01, 0xff, 0x01, 0x05, 0x02, 0x0d, 0x02, 0x18, 0x02, 0x00, 0x00,
+  0x1b, 0x00, 0x36, 0x00, 0x4a, 0x00, 0x5f, 0x00, 0x6d, 0x00, 0x91, 0x00,
+  0xa7, 0x00, 0xb1, 0x00, 0xb8, 0x00, 0xc3, 0x00, 0xcc, 0x00, 0x00, 0x00,
+  0x17, 0x00, 0x26, 0x00, 0x57, 0x00, 0x64, 0x00, 0x76, 0x00, 0x8d, 0x00,
+  0x95, 0x00, 0x9d, 0x00, 0xa6, 0x00, 0xae, 0x00, 0xb6, 0x00, 0xc5, 0x00,
+  0xd5, 0x00, 0xe6, 0x00, 0xef, 0x00, 0xfc, 0x00, 0x0d, 0x01, 0x20, 0x01,
+  0x26, 0x01, 0x2e, 0x01, 0x35, 0x01, 0x3d, 0x01, 0x4c, 0x01, 0x00, 0x00,
+  0x17, 0x00, 0x2f, 0x00, 0x60, 0x00, 0x72, 0x00, 0x80, 0x00, 0x97, 0x00,
+  0x9d, 0x00, 0xac, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x2d, 0x00, 0x4f, 0x00,
+  0x63, 0x00, 0x76, 0x00, 0x97, 0x00, 0xa9, 0x00, 0xb7, 0x00, 0xc0, 0x00,
+  0xc9, 0x00, 0xd9, 0x00, 0xe4, 0x00, 0xed, 0x00, 0xf7, 0x00, 0x06, 0x01,
+  0x0f, 0x01, 0x17, 0x01, 0x22, 0x01, 0x2b, 0x01, 0x31, 0x01, 0x3a, 0x01,
+  0x00, 0x00, 0x1b, 0x00, 0x2e, 0x00, 0x3e, 0x00, 0x4e, 0x00, 0x62, 0x00,
+  0x7e, 0x00, 0x8e, 0x00, 0x9d, 0x00, 0xaf, 0x00, 0x00, 0x00, 0x0f, 0x00,
+  0x32, 0x00, 0x3d, 0x00, 0x56, 0x00, 0x63, 0x00, 0x70, 0x00, 0x80, 0x00,
+  0x8c, 0x00, 0x98, 0x00, 0xa1, 0x00, 0xac, 0x00, 0x00, 0x00, 0x0f, 0x00,
+  0x37, 0x00, 0x52, 0x00, 0x67, 0x00, 0x7d, 0x00, 0x8f, 0x00, 0x9c, 0x00,
+  0xab, 0x00, 0xb4, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x11, 0x00, 0x40, 0x00,
+  0x4d, 0x00, 0x65, 0x00, 0x74, 0x00, 0x89, 0x00, 0x97, 0x00, 0xa0, 0x00,
+  0xa9, 0x00, 0xb3, 0x00, 0xc3, 0x00, 0xd5, 0x00, 0xdf, 0x00, 0xe9, 0x00,
+  0xff, 0x00, 0x12, 0x01, 0x23, 0x01, 0x2a, 0x01, 0x00, 0x00, 0x10, 0x00,
+  0x31, 0x00, 0x3e, 0x00, 0x5b, 0x00, 0x70, 0x00, 0x85, 0x00, 0x90, 0x00,
+  0xa2, 0x00, 0xab, 0x00, 0xb2, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x2e, 0x00,
+  0x45, 0x00, 0x5a, 0x00, 0x6d, 0x00, 0x81, 0x00, 0x90, 0x00, 0xa3, 0x00,
+  0xac, 0x00, 0xb5, 0x00, 0xbc, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x40, 0x00,
+  0x56, 0x00, 0x6e, 0x00, 0x83, 0x00, 0x97, 0x00, 0xae, 0x00, 0xba, 0x00,
+  0xcd, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x55, 0x00, 0x64, 0x00, 0x71, 0x00,
+  0x89, 0x00, 0x97, 0x00, 0xa5, 0x00, 0xbc, 0x00, 0xc7, 0x00, 0xd1, 0x00,
+  0x00, 0x00, 0x11, 0x00, 0x35, 0x00, 0x43, 0x00, 0x55, 0x00, 0x64, 0x00,
+  0x7c, 0x00, 0x8b, 0x00, 0xa0, 0x00, 0xa7, 0x00, 0xaf, 0x00, 0xb7, 0x00,
+  0x00, 0x00, 0x11, 0x00, 0x3b, 0x00, 0x54, 0x00, 0x67, 0x00, 0x7c, 0x00,
+  0x90, 0x00, 0xa1, 0x00, 0xaa, 0x00, 0xb2, 0x00, 0xb8, 0x00, 0xc0, 0x00,
+  0xc6, 0x00, 0x00, 0x00, 0x10, 0x00, 0x33, 0x00, 0x46, 0x00, 0x5f, 0x00,
+  0x7b, 0x00, 0x91, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x13, 0x00, 0x38, 0x00,
+  0x47, 0x00, 0x5d, 0x00, 0x6c, 0x00, 0x86, 0x00, 0x92, 0x00, 0x9e, 0x00,
+  0xa6, 0x00, 0xb6, 0x00, 0xbe, 0x00, 0xc6, 0x00, 0xcf, 0x00, 0xd7, 0x00,
+  0xe5, 0x00, 0xf0, 0x00, 0xfa, 0x00, 0x02, 0x01, 0x0e, 0x01, 0x16, 0x01,
+  0x1e, 0x01, 0x26, 0x01, 0x2f, 0x01, 0x38, 0x01, 0x41, 0x01, 0x49, 0x01,
+  0x52, 0x01, 0x00, 0x00, 0x1b, 0x00, 0x4a, 0x00, 0x67, 0x00, 0x80, 0x00,
+  0x8e, 0x00, 0xa4, 0x00, 0xab, 0x00, 0xb7, 0x00, 0xbe, 0x00, 0xca, 0x00,
+  0xdc, 0x00, 0xeb, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x51, 0x00, 0x66, 0x00,
+  0x78, 0x00, 0x85, 0x00, 0xa7, 0x00, 0xc0, 0x00, 0xcd, 0x00, 0xd9, 0x00,
+  0xe6, 0x00, 0xee, 0x00, 0xfe, 0x00, 0x07, 0x01, 0x0d, 0x01, 0x16, 0x01,
+  0x29, 0x01, 0x31, 0x01, 0x3f, 0x01, 0x00, 0x00, 0x1d, 0x00, 0x2a, 0x00,
+  0x60, 0x00, 0x70, 0x00, 0x8c, 0x00, 0xa1, 0x00, 0xb6, 0x00, 0xc0, 0x00,
+  0xe1, 0x00, 0xeb, 0x00, 0xf4, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x36, 0x00,
+  0x50, 0x00, 0x68, 0x00, 0x7a, 0x00, 0x96, 0x00, 0xa7, 0x00, 0xbb, 0x00,
+  0xcb, 0x00, 0xd3, 0x00, 0xdb, 0x00, 0xeb, 0x00, 0xf3, 0x00, 0x03, 0x01,
+  0x11, 0x01, 0x1f, 0x01, 0x28, 0x01, 0x38, 0x01, 0x40, 0x01, 0x48, 0x01,
+  0x50, 0x01, 0x59, 0x01, 0x66, 0x01, 0x6e, 0x01, 0x76, 0x01, 0x88, 0x01,
+  0x90, 0x01, 0x98, 0x01, 0xa0, 0x01, 0xa8, 0x01, 0xb1, 0x01, 0xba, 0x01,
+  0xc2, 0x01, 0xca, 0x01, 0x00, 0x00, 0x25, 0x00, 0x4b, 0x00, 0x60, 0x00,
+  0x79, 0x00, 0x8c, 0x00, 0xb2, 0x00, 0xc2, 0x00, 0xd6, 0x00, 0xe2, 0x00,
+  0xe9, 0x00, 0xf2, 0x00, 0x01, 0x01, 0x0a, 0x01, 0x00, 0x00, 0x27, 0x00,
+  0x36, 0x00, 0x4d, 0x00, 0x61, 0x00, 0x7b, 0x00, 0x88, 0x00, 0x9f, 0x00,
+  0xa6, 0x00, 0xae, 0x00, 0xbd, 0x00, 0xc5, 0x00, 0xcc, 0x00, 0xd2, 0x00,
+  0xd9, 0x00, 0xe5, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x34, 0x00, 0x4c, 0x00,
+  0x5e, 0x00, 0x77, 0x00, 0x8b, 0x00, 0x94, 0x00, 0xa2, 0x00, 0xa9, 0x00,
+  0xb1, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x44, 0x00, 0x55, 0x00, 0x67, 0x00,
+  0x78, 0x00, 0x8a, 0x00, 0x93, 0x00, 0x9b, 0x00, 0xa4, 0x00, 0xac, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x2a, 0x00, 0x4e, 0x00, 0x67, 0x00, 0x7b, 0x00,
+  0x94, 0x00, 0xa8, 0x00, 0xb2, 0x00, 0xbc, 0x00, 0xc5, 0x00, 0xce, 0x00,
+  0xde, 0x00, 0xe7, 0x00, 0xf0, 0x00, 0xf9, 0x00, 0x02, 0x01, 0x08, 0x01,
+  0x11, 0x01, 0x1a, 0x01, 0x00, 0x00, 0x0f, 0x00, 0x26, 0x00, 0x3f, 0x00,
+  0x52, 0x00, 0x6b, 0x00, 0x7c, 0x00, 0x8f, 0x00, 0x98, 0x00, 0xa0, 0x00,
+  0xaa, 0x00, 0xb4, 0x00, 0xbe, 0x00, 0xc6, 0x00, 0xcc, 0x00, 0xd5, 0x00,
+  0xdb, 0x00, 0xe3, 0x00, 0xea, 0x00, 0x00, 0x00, 0x22, 0x00, 0x32, 0x00,
+  0x4a, 0x00, 0x5e, 0x00, 0x76, 0x00, 0x85, 0x00, 0x9a, 0x00, 0xa5, 0x00,
+  0xb3, 0x00, 0xbc, 0x00, 0x00, 0x00, 0x18, 0x00, 0x26, 0x00, 0x3c, 0x00,
+  0x62, 0x00, 0x6b, 0x00, 0x80, 0x00, 0x88, 0x00, 0x91, 0x00, 0x9a, 0x00,
+  0xa2, 0x00, 0xab, 0x00, 0xb3, 0x00, 0xbb, 0x00, 0xc3, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x2d, 0x00, 0x43, 0x00, 0x62, 0x00, 0x6f, 0x00, 0x79, 0x00,
+  0x82, 0x00, 0x8f, 0x00, 0x98, 0x00, 0xa1, 0x00, 0xa6, 0x00, 0xad, 0x00,
+  0xbc, 0x00, 0xc5, 0x00, 0xce, 0x00, 0xd7, 0x00, 0xe0, 0x00, 0xe8, 0x00,
+  0xf1, 0x00, 0xfa, 0x00, 0x03, 0x01, 0x0c, 0x01, 0x15, 0x01, 0x1e, 0x01,
+  0x00, 0x00, 0x12, 0x00, 0x2e, 0x00, 0x3e, 0x00, 0x4e, 0x00, 0x57, 0x00,
+  0x5e, 0x00, 0x64, 0x00, 0x6a, 0x00, 0x73, 0x00, 0x00, 0x00, 0x0d, 0x00,
+  0x23, 0x00, 0x39, 0x00, 0x4a, 0x00, 0x5e, 0x00, 0x6d, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x22, 0x00, 0x3b, 0x00, 0x53, 0x00, 0x6b, 0x00, 0x77, 0x00,
+  0x83, 0x00, 0x8f, 0x00, 0x9b, 0x00, 0xa7, 0x00, 0xb2, 0x00, 0xbb, 0x00,
+  0x00, 0x00, 0x1b, 0x00, 0x28, 0x00, 0x41, 0x00, 0x5f, 0x00, 0x68, 0x00,
+  0x71, 0x00, 0x7a, 0x00, 0x83, 0x00, 0x95, 0x00, 0x00, 0x00, 0x19, 0x00,
+  0x47, 0x00, 0x5e, 0x00, 0x74, 0x00, 0x87, 0x00, 0x8f, 0x00, 0x97, 0x00,
+  0x9e, 0x00, 0xa9, 0x00, 0xb1, 0x00, 0xd8, 0x00, 0xdf, 0x00, 0x00, 0x00,
+  0x17, 0x00, 0x33, 0x00, 0x4d, 0x00, 0x5f, 0x00, 0x74, 0x00, 0x7f, 0x00,
+  0x89, 0x00, 0x93, 0x00, 0x9d, 0x00, 0xa7, 0x00, 0xbd, 0x00, 0xc5, 0x00,
+  0xd8, 0x00, 0xe7, 0x00, 0xf1, 0x00, 0xfb, 0x00, 0x00, 0x00, 0x1c, 0x00,
+  0x40, 0x00, 0x59, 0x00, 0x65, 0x00, 0x74, 0x00, 0x8e, 0x00, 0xa0, 0x00,
+  0xab, 0x00, 0xb9, 0x00, 0xd0, 0x00, 0xd9, 0x00, 0x00, 0x00, 0x28, 0x00,
+  0x4c, 0x00, 0x66, 0x00, 0x74, 0x00, 0x80, 0x00, 0x8c, 0x00, 0x98, 0x00,
+  0xa6, 0x00, 0xbf, 0x00, 0xcc, 0x00, 0xd7, 0x00, 0xee, 0x00, 0xfa, 0x00,
+  0x06, 0x01, 0x10, 0x01, 0x00, 0x00, 0x0d, 0x00, 0x32, 0x00, 0x41, 0x00,
+  0x57, 0x00, 0x71, 0x00, 0x7d, 0x00, 0x8a, 0x00, 0xa8, 0x00, 0xaf, 0x00,
+  0xc8, 0x00, 0xd7, 0x00, 0xe5, 0x00, 0xec, 0x00, 0xf5, 0x00, 0xfe, 0x00,
+  0x07, 0x01, 0x10, 0x01, 0x19, 0x01, 0x22, 0x01, 0x00, 0x00, 0x1f, 0x00,
+  0x42, 0x00, 0x5d, 0x00, 0x6d, 0x00, 0x85, 0x00, 0x8e, 0x00, 0x99, 0x00,
+  0xa2, 0x00, 0xae, 0x00, 0xb7, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x2b, 0x00,
+  0x45, 0x00, 0x59, 0x00, 0x69, 0x00, 0x71, 0x00, 0x79, 0x00, 0x81, 0x00,
+  0x8a, 0x00, 0x93, 0x00, 0x9b, 0x00, 0xa3, 0x00, 0xab, 0x00, 0xb3, 0x00,
+  0xb9, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x46, 0x00, 0x60, 0x00, 0x73, 0x00,
+  0x7c, 0x00, 0x85, 0x00, 0x8e, 0x00, 0xa9, 0x00, 0xb2, 0x00, 0xbb, 0x00,
+  0xc5, 0x00, 0xda, 0x00, 0xe3, 0x00, 0xec, 0x00, 0xf5, 0x00, 0xfe, 0x00,
+  0x08, 0x01, 0x11, 0x01, 0x1a, 0x01, 0x23, 0x01, 0x00, 0x00, 0x24, 0x00,
+  0x4f, 0x00, 0x60, 0x00, 0x72, 0x00, 0x82, 0x00, 0xa1, 0x00, 0xa9, 0x00,
+  0xb0, 0x00, 0xc6, 0x00, 0xd8, 0x00, 0x00, 0x00, 0x22, 0x00, 0x3b, 0x00,
+  0x5b, 0x00, 0x6e, 0x00, 0x7f, 0x00, 0x88, 0x00, 0x94, 0x00, 0xad, 0x00,
+  0x00, 0x00, 0x1e, 0x00, 0x3a, 0x00, 0x4c, 0x00, 0x54, 0x00, 0x5c, 0x00,
+  0x64, 0x00, 0x6f, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x35, 0x00,
+  0x4b, 0x00, 0x5c, 0x00, 0x65, 0x00, 0x70, 0x00, 0x79, 0x00, 0x85, 0x00,
+  0x9d, 0x00, 0xa3, 0x00, 0xa9, 0x00, 0xb2, 0x00, 0x00, 0x00, 0x18, 0x00,
+  0x29, 0x00, 0x38, 0x00, 0x45, 0x00, 0x4f, 0x00, 0x55, 0x00, 0x62, 0x00,
+  0x6a, 0x00, 0x76, 0x00, 0x00, 0x00, 0x18, 0x00, 0x27, 0x00, 0x41, 0x00,
+  0x4d, 0x00, 0x58, 0x00, 0x63, 0x00, 0x6c, 0x00, 0x75, 0x00, 0x7e, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x26, 0x00, 0x32, 0x00, 0x4e, 0x00, 0x54, 0x00,
+  0x5f, 0x00, 0x6d, 0x00, 0x00, 0x00, 0x16, 0x00, 0x42, 0x00, 0x5c, 0x00,
+  0x69, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x47, 0x00, 0x6a, 0x00, 0x87, 0x00,
+  0x97, 0x00, 0xa3, 0x00, 0xad, 0x00, 0xbc, 0x00, 0xc6, 0x00, 0xcf, 0x00,
+  0xde, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x62, 0x00, 0x7c, 0x00, 0x92, 0x00,
+  0x9c, 0x00, 0xa6, 0x00, 0xaf, 0x00, 0xbc, 0x00, 0xca, 0x00, 0xd5, 0x00,
+  0xe3, 0x00, 0xec, 0x00, 0xfe, 0x00, 0x08, 0x01, 0x12, 0x01, 0x00, 0x00,
+  0x17, 0x00, 0x3b, 0x00, 0x5d, 0x00, 0x83, 0x00, 0x90, 0x00, 0x9e, 0x00,
+  0xa7, 0x00, 0xb2, 0x00, 0xb8, 0x00, 0xc1, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x1c, 0x00, 0x46, 0x00, 0x6b, 0x00, 0x77, 0x00, 0x81, 0x00, 0x8c, 0x00,
+  0x92, 0x00, 0x9b, 0x00, 0xa7, 0x00, 0xb0, 0x00, 0x00, 0x00, 0x17, 0x00,
+  0x27, 0x00, 0x55, 0x00, 0x6e, 0x00, 0x77, 0x00, 0x81, 0x00, 0x8a, 0x00,
+  0x9c, 0x00, 0xa6, 0x00, 0xb2, 0x00, 0xbd, 0x00, 0xca, 0x00, 0xd3, 0x00,
+  0x00, 0x00, 0x17, 0x00, 0x2d, 0x00, 0x41, 0x00, 0x63, 0x00, 0x74, 0x00,
+  0x93, 0x00, 0x9c, 0x00, 0xa5, 0x00, 0xae, 0x00, 0xb7, 0x00, 0xc0, 0x00,
+  0xc9, 0x00, 0xd2, 0x00, 0xdb, 0x00, 0xe4, 0x00, 0xed, 0x00, 0xf7, 0x00,
+  0x00, 0x01, 0x09, 0x01, 0x12, 0x01, 0x1b, 0x01, 0x24, 0x01, 0x2d, 0x01,
+  0x36, 0x01, 0x3f, 0x01, 0x48, 0x01, 0x51, 0x01, 0x5a, 0x01, 0x64, 0x01,
+  0x6d, 0x01, 0x76, 0x01, 0x7f, 0x01, 0x93, 0x01, 0x9f, 0x01, 0xa8, 0x01,
+  0xb5, 0x01, 0xbd, 0x01, 0xc6, 0x01, 0x00, 0x00, 0x1e, 0x00, 0x39, 0x00,
+  0x41, 0x00, 0x4b, 0x00, 0x57, 0x00, 0x62, 0x00, 0x72, 0x00, 0x79, 0x00,
+  0x81, 0x00, 0x8a, 0x00, 0x92, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x25, 0x00,
+  0x2f, 0x00, 0x39, 0x00, 0x43, 0x00, 0x4d, 0x00, 0x57, 0x00, 0x61, 0x00,
+  0x6b, 0x00, 0x75, 0x00, 0x82, 0x00, 0x90, 0x00, 0xa4, 0x00, 0xad, 0x00,
+  0x00, 0x00, 0x15, 0x00, 0x4d, 0x00, 0x6d, 0x00, 0x73, 0x00, 0x7b, 0x00,
+  0x84, 0x00, 0x98, 0x00, 0xa1, 0x00, 0xaa, 0x00, 0xb0, 0x00, 0xb9, 0x00,
+  0xc5, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x43, 0x00, 0x62, 0x00, 0x6b, 0x00,
+  0x7a, 0x00, 0x81, 0x00, 0x8e, 0x00, 0x99, 0x00, 0xa2, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x2e, 0x00, 0x49, 0x00, 0x5b, 0x00, 0x66, 0x00, 0x76, 0x00,
+  0x80, 0x00, 0x89, 0x00, 0x91, 0x00, 0x9a, 0x00, 0xa4, 0x00, 0xab, 0x00,
+  0xb5, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x23, 0x00, 0x32, 0x00, 0x3f, 0x00,
+  0x48, 0x00, 0x55, 0x00, 0x66, 0x00, 0x70, 0x00, 0x79, 0x00, 0x83, 0x00,
+  0x8c, 0x00, 0x95, 0x00, 0x00, 0x00, 0x17, 0x00, 0x2c, 0x00, 0x48, 0x00,
+  0x54, 0x00, 0x5d, 0x00, 0x75, 0x00, 0x7e, 0x00, 0x84, 0x00, 0x8b, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x2c, 0x00, 0x38, 0x00, 0x44, 0x00, 0x50, 0x00,
+  0x5c, 0x00, 0x68, 0x00, 0x72, 0x00, 0x7c, 0x00, 0x88, 0x00, 0x91, 0x00,
+  0xa2, 0x00, 0xac, 0x00, 0xb2, 0x00, 0xbc, 0x00, 0xc7, 0x00, 0xd1, 0x00,
+  0x00, 0x00, 0x15, 0x00, 0x33, 0x00, 0x3f, 0x00, 0x4b, 0x00, 0x57, 0x00,
+  0x63, 0x00, 0x6f, 0x00, 0x7b, 0x00, 0x83, 0x00, 0x8f, 0x00, 0x9b, 0x00,
+  0xa7, 0x00, 0xb3, 0x00, 0xbc, 0x00, 0xc3, 0x00, 0xc9, 0x00, 0xd0, 0x00,
+  0xd8, 0x00, 0xdf, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x35, 0x00, 0x3e, 0x00,
+  0x4f, 0x00, 0x58, 0x00, 0x62, 0x00, 0x6c, 0x00, 0x80, 0x00, 0x89, 0x00,
+  0x99, 0x00, 0x9f, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x37, 0x00, 0x49, 0x00,
+  0x58, 0x00, 0x64, 0x00, 0x6d, 0x00, 0x76, 0x00, 0x7e, 0x00, 0x85, 0x00,
+  0x8e, 0x00, 0x97, 0x00, 0x00, 0x00, 0x13, 0x00, 0x24, 0x00, 0x3d, 0x00,
+  0x56, 0x00, 0x5c, 0x00, 0x62, 0x00, 0x00, 0x00, 0x12, 0x00, 0x28, 0x00,
+  0x3e, 0x00, 0x50, 0x00, 0x59, 0x00, 0x60, 0x00, 0x69, 0x00, 0x00, 0x00,
+  0x1a, 0x00, 0x28, 0x00, 0x41, 0x00, 0x4d, 0x00, 0x56, 0x00, 0x6b, 0x00,
+  0x76, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x18, 0x00, 0x2f, 0x00, 0x3b, 0x00,
+  0x4c, 0x00, 0x54, 0x00, 0x5e, 0x00, 0x67, 0x00, 0x6f, 0x00, 0x78, 0x00,
+  0x80, 0x00, 0x9b, 0x00, 0xa5, 0x00, 0xae, 0x00, 0xb7, 0x00, 0xc0, 0x00,
+  0xd2, 0x00, 0xdb, 0x00, 0x00, 0x00, 0x13, 0x00, 0x26, 0x00, 0x39, 0x00,
+  0x4c, 0x00, 0x5f, 0x00, 0x72, 0x00, 0x85, 0x00, 0x98, 0x00, 0xab, 0x00,
+  0xcc, 0x00, 0xe2, 0x00, 0xfb, 0x00, 0x04, 0x01, 0x0d, 0x01, 0x16, 0x01,
+  0x1f, 0x01, 0x28, 0x01, 0x31, 0x01, 0x3a, 0x01, 0x43, 0x01, 0x4d, 0x01,
+  0x00, 0x00, 0x0f, 0x00, 0x27, 0x00, 0x44, 0x00, 0x52, 0x00, 0x5a, 0x00,
+  0x6a, 0x00, 0x73, 0x00, 0x7a, 0x00, 0x89, 0x00, 0x91, 0x00, 0x97, 0x00,
+  0x9f, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x3c, 0x00, 0x46, 0x00, 0x50, 0x00,
+  0x5a, 0x00, 0x64, 0x00, 0x6e, 0x00, 0x78, 0x00, 0x8a, 0x00, 0x95, 0x00,
+  0x9e, 0x00, 0xa8, 0x00, 0xb1, 0x00, 0xba, 0x00, 0xc4, 0x00, 0xcb, 0x00,
+  0xd1, 0x00, 0xd7, 0x00, 0xe8, 0x00, 0xf5, 0x00, 0xfe, 0x00, 0x00, 0x00,
+  0x16, 0x00, 0x28, 0x00, 0x41, 0x00, 0x4d, 0x00, 0x59, 0x00, 0x5f, 0x00,
+  0x67, 0x00, 0x6f, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1e, 0x00, 0x39, 0x00,
+  0x54, 0x00, 0x61, 0x00, 0x74, 0x00, 0x7d, 0x00, 0x87, 0x00, 0x91, 0x00,
+  0x9a, 0x00, 0x00, 0x00, 0x37, 0x00, 0x43, 0x00, 0x4b, 0x00, 0x5a, 0x00,
+  0x6b, 0x00, 0x75, 0x00, 0x7d, 0x00, 0x86, 0x00, 0x8f, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x1c, 0x00, 0x26, 0x00, 0x31, 0x00, 0x3b, 0x00, 0x45, 0x00,
+  0x4f, 0x00, 0x59, 0x00, 0x63, 0x00, 0x6d, 0x00, 0x76, 0x00, 0x87, 0x00,
+  0x8d, 0x00, 0x00, 0x00, 0x19, 0x00, 0x2b, 0x00, 0x45, 0x00, 0x51, 0x00,
+  0x57, 0x00, 0x00, 0x00, 0x15, 0x00, 0x2b, 0x00, 0x3d, 0x00, 0x49, 0x00,
+  0x51, 0x00, 0x67, 0x00, 0x6d, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x2c, 0x00,
+  0x3e, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x2a, 0x00, 0x3b, 0x00, 0x41, 0x00,
+  0x00, 0x00, 0x21, 0x00, 0x32, 0x00, 0x3b, 0x00, 0x4c, 0x00, 0x5b, 0x00,
+  0x6c, 0x00, 0x7b, 0x00, 0x81, 0x00, 0x8e, 0x00, 0xa3, 0x00, 0xa9, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x1a, 0x00, 0x28, 0x00, 0x35, 0x00, 0x3d, 0x00,
+  0x4a, 0x00, 0x51, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x10, 0x00, 0x2a, 0x00,
+  0x42, 0x00, 0x49, 0x00, 0x67, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x80, 0x00,
+  0x94, 0x00, 0x9b, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x26, 0x00, 0x32, 0x00,
+  0x3c, 0x00, 0x58, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x3a, 0x00, 0x58, 0x00,
+  0x74, 0x00, 0x86, 0x00, 0x90, 0x00, 0xa2, 0x00, 0xa8, 0x00, 0xb9, 0x00,
+  0xc0, 0x00, 0x00, 0x00, 0x11, 0x00, 0x25, 0x00, 0x40, 0x00, 0x4a, 0x00,
+  0x54, 0x00, 0x5e, 0x00, 0x67, 0x00, 0x70, 0x00, 0x79, 0x00, 0x83, 0x00,
+  0x8c, 0x00, 0x95, 0x00, 0x9e, 0x00, 0xa7, 0x00, 0xb0, 0x00, 0xb9, 0x00,
+  0xc2, 0x00, 0xcb, 0x00, 0xd4, 0x00, 0xdd, 0x00, 0xe6, 0x00, 0xef, 0x00,
+  0xf8, 0x00, 0x01, 0x01, 0x0a, 0x01, 0x13, 0x01, 0x1c, 0x01, 0x25, 0x01,
+  0x2e, 0x01, 0x37, 0x01, 0x40, 0x01, 0x49, 0x01, 0x52, 0x01, 0x5e, 0x01,
+  0x68, 0x01, 0x71, 0x01, 0x7a, 0x01, 0x83, 0x01, 0x8c, 0x01, 0x95, 0x01,
+  0x9e, 0x01, 0xaf, 0x01, 0xb8, 0x01, 0xc1, 0x01, 0xd2, 0x01, 0xe3, 0x01,
+  0xec, 0x01, 0xf5, 0x01, 0xfe, 0x01, 0x07, 0x02, 0x10, 0x02, 0x17, 0x02,
+  0x21, 0x02, 0x00, 0x00, 0x0e, 0x00, 0x2d, 0x00, 0x45, 0x00, 0x4c, 0x00,
+  0x73, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x38, 0x00, 0x51, 0x00, 0x5b, 0x00,
+  0x65, 0x00, 0x6f, 0x00, 0x79, 0x00, 0x83, 0x00, 0x8d, 0x00, 0x97, 0x00,
+  0xa1, 0x00, 0xb5, 0x00, 0xc0, 0x00, 0xca, 0x00, 0xd4, 0x00, 0xde, 0x00,
+  0xe8, 0x00, 0xf5, 0x00, 0xff, 0x00, 0x05, 0x01, 0x14, 0x01, 0x35, 0x01,
+  0x3c, 0x01, 0x45, 0x01, 0x00, 0x00, 0x0f, 0x00, 0x30, 0x00, 0x4c, 0x00,
+  0x67, 0x00, 0x83, 0x00, 0x9c, 0x00, 0xa7, 0x00, 0xb2, 0x00, 0xcc, 0x00,
+  0xde, 0x00, 0xf3, 0x00, 0xfc, 0x00, 0x06, 0x01, 0x1a, 0x01, 0x20, 0x01,
+  0x26, 0x01, 0x00, 0x00, 0x13, 0x00, 0x24, 0x00, 0x44, 0x00, 0x56, 0x00,
+  0x5f, 0x00, 0x6f, 0x00, 0x82, 0x00, 0x93, 0x00, 0x9c, 0x00, 0xa5, 0x00,
+  0xae, 0x00, 0xb7, 0x00, 0x00, 0x00, 0x13, 0x00, 0x19, 0x00, 0x23, 0x00,
+  0x2d, 0x00, 0x37, 0x00, 0x00, 0x00, 0x09, 0x00, 0x25, 0x00, 0x2f, 0x00,
+  0x39, 0x00, 0x43, 0x00, 0x4d, 0x00, 0x56, 0x00, 0x5b, 0x00, 0x6b, 0x00,
+  0x74, 0x00, 0x80, 0x00, 0x00, 0x00, 0x11, 0x00, 0x1a, 0x00, 0x34, 0x00,
+  0x46, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x18, 0x00, 0x24, 0x00,
+  0x30, 0x00, 0x3c, 0x00, 0x48, 0x00, 0x54, 0x00, 0x5e, 0x00, 0x68, 0x00,
+  0x74, 0x00, 0x81, 0x00, 0x96, 0x00, 0xaf, 0x00, 0xbf, 0x00, 0xd0, 0x00,
+  0xdd, 0x00, 0xf3, 0x00, 0xfd, 0x00, 0x03, 0x01, 0x18, 0x01, 0x22, 0x01,
+  0x2c, 0x01, 0x39, 0x01, 0x43, 0x01, 0x4d, 0x01, 0x57, 0x01, 0x61, 0x01,
+  0x6b, 0x01, 0x75, 0x01, 0x7b, 0x01, 0x86, 0x01, 0x90, 0x01, 0x9a, 0x01,
+  0xa0, 0x01, 0xaa, 0x01, 0x00, 0x00, 0x0e, 0x00, 0x15, 0x00, 0x1c, 0x00,
+  0x28, 0x00, 0x36, 0x00, 0x49, 0x00, 0x55, 0x00, 0x5c, 0x00, 0x64, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x1c, 0x00, 0x2c, 0x00, 0x41, 0x00, 0x47, 0x00,
+  0x00, 0x00, 0x1b, 0x00, 0x25, 0x00, 0x3e, 0x00, 0x4e, 0x00, 0x57, 0x00,
+  0x68, 0x00, 0x82, 0x00, 0x89, 0x00, 0x91, 0x00, 0x99, 0x00, 0xa0, 0x00,
+  0xbb, 0x00, 0x00, 0x00, 0x08, 0x00, 0x0e, 0x00, 0x19, 0x00, 0x00, 0x00,
+  0x24, 0x00, 0x2e, 0x00, 0x38, 0x00, 0x3f, 0x00, 0x46, 0x00, 0x56, 0x00,
+  0x62, 0x00, 0x69, 0x00, 0x73, 0x00, 0x7c, 0x00, 0x84, 0x00, 0x8b, 0x00,
+  0x93, 0x00, 0x9a, 0x00, 0x00, 0x00, 0x16, 0x00, 0x3b, 0x00, 0x47, 0x00,
+  0x55, 0x00, 0x68, 0x00, 0x70, 0x00, 0x85, 0x00, 0x8f, 0x00, 0x9a, 0x00,
+  0xa5, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x2a, 0x00, 0x36, 0x00, 0x42, 0x00,
+  0x4e, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x19, 0x00, 0x2c, 0x00, 0x3f, 0x00,
+  0x52, 0x00, 0x71, 0x00, 0x7a, 0x00, 0x8b, 0x00, 0x9d, 0x00, 0xa6, 0x00,
+  0xaf, 0x00, 0xb8, 0x00, 0xc1, 0x00, 0xca, 0x00, 0xd3, 0x00, 0xdc, 0x00,
+  0xe5, 0x00, 0xee, 0x00, 0xf7, 0x00, 0x00, 0x01, 0x09, 0x01, 0x1a, 0x01,
+  0x21, 0x01, 0x00, 0x00, 0x0e, 0x00, 0x22, 0x00, 0x35, 0x00, 0x4c, 0x00,
+  0x57, 0x00, 0x5e, 0x00, 0x65, 0x00, 0x71, 0x00, 0x00, 0x00, 0x16, 0x00,
+  0x20, 0x00, 0x2a, 0x00, 0x34, 0x00, 0x48, 0x00, 0x52, 0x00, 0x5b, 0x00,
+  0x66, 0x00, 0x6f, 0x00, 0x78, 0x00, 0x81, 0x00, 0x8d, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x21, 0x00, 0x2a, 0x00, 0x30, 0x00, 0x00, 0x00, 0x27, 0x00,
+  0x30, 0x00, 0x39, 0x00, 0x42, 0x00, 0x49, 0x00, 0x00, 0x00, 0x20, 0x00,
+  0x29, 0x00, 0x30, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x26, 0x00, 0x30, 0x00,
+  0x3a, 0x00, 0x44, 0x00, 0x4e, 0x00, 0x58, 0x00, 0x5f, 0x00, 0x69, 0x00,
+  0x73, 0x00, 0x7d, 0x00, 0x87, 0x00, 0x9a, 0x00, 0xa4, 0x00, 0xae, 0x00,
+  0xb8, 0x00, 0xbf, 0x00, 0xc9, 0x00, 0xd3, 0x00, 0xe7, 0x00, 0xfa, 0x00,
+  0x01, 0x01, 0x00, 0x00, 0x1a, 0x00, 0x23, 0x00, 0x2a, 0x00, 0x31, 0x00,
+  0x00, 0x00, 0x1c, 0x00, 0x25, 0x00, 0x2f, 0x00, 0x38, 0x00, 0x41, 0x00,
+  0x4c, 0x00, 0x54, 0x00, 0x66, 0x00, 0x6f, 0x00, 0x78, 0x00, 0x7f, 0x00,
+  0x89, 0x00, 0x92, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x19, 0x00, 0x2c, 0x00,
+  0x38, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x37, 0x00, 0x3f, 0x00, 0x4f, 0x00,
+  0x58, 0x00, 0x60, 0x00, 0x6e, 0x00, 0x76, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x15, 0x00, 0x1e, 0x00, 0x27, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x43, 0x00,
+  0x5b, 0x00, 0x65, 0x00, 0x71, 0x00, 0x78, 0x00, 0x82, 0x00, 0x8b, 0x00,
+  0x94, 0x00, 0xa1, 0x00, 0x00, 0x00, 0x21, 0x00, 0x3a, 0x00, 0x45, 0x00,
+  0x56, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x46, 0x00, 0x55, 0x00, 0x5e, 0x00,
+  0x71, 0x00, 0x83, 0x00, 0x8c, 0x00, 0x95, 0x00, 0x9e, 0x00, 0xb0, 0x00,
+  0xb9, 0x00, 0xca, 0x00, 0xd3, 0x00, 0xdc, 0x00, 0xe5, 0x00, 0xee, 0x00,
+  0xf7, 0x00, 0x01, 0x01, 0x0a, 0x01, 0x13, 0x01, 0x1c, 0x01, 0x25, 0x01,
+  0x2e, 0x01, 0x37, 0x01, 0x40, 0x01, 0x49, 0x01, 0x52, 0x01, 0x58, 0x01,
+  0x61, 0x01, 0x6a, 0x01, 0x73, 0x01, 0x7c, 0x01, 0x8f, 0x01, 0x98, 0x01,
+  0xa1, 0x01, 0xaa, 0x01, 0xb3, 0x01, 0xbc, 0x01, 0xc5, 0x01, 0xcf, 0x01,
+  0xd8, 0x01, 0xe1, 0x01, 0xea, 0x01, 0x00, 0x00, 0x1f, 0x00, 0x3c, 0x00,
+  0x4b, 0x00, 0x6b, 0x00, 0x87, 0x00, 0x99, 0x00, 0x00, 0x00, 0x23, 0x00,
+  0x49, 0x00, 0x60, 0x00, 0x6e, 0x00, 0x77, 0x00, 0x7f, 0x00, 0x87, 0x00,
+  0x8e, 0x00, 0x97, 0x00, 0x9f, 0x00, 0xa7, 0x00, 0x00, 0x00, 0x1a, 0x00,
+  0x39, 0x00, 0x51, 0x00, 0x5d, 0x00, 0x64, 0x00, 0x00, 0x00, 0x1a, 0x00,
+  0x39, 0x00, 0x41, 0x00, 0x4b, 0x00, 0x55, 0x00, 0x5f, 0x00, 0x69, 0x00,
+  0x7c, 0x00, 0x84, 0x00, 0x8e, 0x00, 0x96, 0x00, 0x9e, 0x00, 0xa6, 0x00,
+  0xae, 0x00, 0x00, 0x00, 0x17, 0x00, 0x21, 0x00, 0x2a, 0x00, 0x33, 0x00,
+  0x3e, 0x00, 0x52, 0x00, 0x5b, 0x00, 0x6f, 0x00, 0x7a, 0x00, 0x81, 0x00,
+  0x94, 0x00, 0x9a, 0x00, 0x00, 0x00, 0x41, 0x00, 0x5d, 0x00, 0x6e, 0x00,
+  0x75, 0x00, 0x7f, 0x00, 0x88, 0x00, 0x91, 0x00, 0x9b, 0x00, 0xa3, 0x00,
+  0x00, 0x00, 0x18, 0x00, 0x3b, 0x00, 0x56, 0x00, 0x66, 0x00, 0x80, 0x00,
+  0x94, 0x00, 0xaf, 0x00, 0xbb, 0x00, 0xc7, 0x00, 0xd0, 0x00, 0xe5, 0x00,
+  0xf1, 0x00, 0xf7, 0x00, 0x14, 0x01, 0x00, 0x00, 0x38, 0x00, 0x5a, 0x00,
+  0x77, 0x00, 0x88, 0x00, 0x94, 0x00, 0xb2, 0x00, 0xbb, 0x00, 0xc5, 0x00,
+  0xcf, 0x00, 0xd9, 0x00, 0xe3, 0x00, 0xed, 0x00, 0xf7, 0x00, 0x01, 0x01,
+  0x0b, 0x01, 0x15, 0x01, 0x1f, 0x01, 0x28, 0x01, 0x3a, 0x01, 0x43, 0x01,
+  0x53, 0x01, 0x61, 0x01, 0x6b, 0x01, 0x72, 0x01, 0x7b, 0x01, 0x85, 0x01,
+  0x00, 0x00, 0x1d, 0x00, 0x3a, 0x00, 0x4f, 0x00, 0x5c, 0x00, 0x7b, 0x00,
+  0x85, 0x00, 0x8c, 0x00, 0x94, 0x00, 0x9b, 0x00, 0xa4, 0x00, 0xae, 0x00,
+  0xba, 0x00, 0xc3, 0x00, 0xca, 0x00, 0xd1, 0x00, 0xd8, 0x00, 0xe1, 0x00,
+  0xea, 0x00, 0xf3, 0x00, 0xfc, 0x00, 0x05, 0x01, 0x0e, 0x01, 0x00, 0x00,
+  0x10, 0x00, 0x28, 0x00, 0x4e, 0x00, 0x5a, 0x00, 0x66, 0x00, 0x72, 0x00,
+  0x7e, 0x00, 0x84, 0x00, 0x90, 0x00, 0x9f, 0x00, 0xad, 0x00, 0xb6, 0x00,
+  0xbc, 0x00, 0xc2, 0x00, 0x00, 0x00, 0x28, 0x00, 0x3b, 0x00, 0x4a, 0x00,
+  0x67, 0x00, 0x73, 0x00, 0x7a, 0x00, 0x86, 0x00, 0x92, 0x00, 0x9b, 0x00,
+  0xa7, 0x00, 0xb5, 0x00, 0xc8, 0x00, 0xce, 0x00, 0x00, 0x00, 0x1b, 0x00,
+  0x29, 0x00, 0x38, 0x00, 0x50, 0x00, 0x64, 0x00, 0x7d, 0x00, 0x98, 0x00,
+  0xaf, 0x00, 0xb5, 0x00, 0xbe, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1a, 0x00,
+  0x31, 0x00, 0x3f, 0x00, 0x4b, 0x00, 0x56, 0x00, 0x60, 0x00, 0x6a, 0x00,
+  0x75, 0x00, 0x00, 0x00, 0x18, 0x00, 0x2a, 0x00, 0x45, 0x00, 0x5b, 0x00,
+  0x64, 0x00, 0x6d, 0x00, 0x00, 0x00, 0x10, 0x00, 0x17, 0x00, 0x23, 0x00,
+  0x29, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x1c, 0x00, 0x2c, 0x00,
+  0x00, 0x00, 0x1f, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x28, 0x00, 0x42, 0x00,
+  0x53, 0x00, 0x5c, 0x00, 0x65, 0x00, 0x76, 0x00, 0x7f, 0x00, 0x88, 0x00,
+  0x91, 0x00, 0x9a, 0x00, 0xa3, 0x00, 0xac, 0x00, 0xb5, 0x00, 0xbe, 0x00,
+  0xc7, 0x00, 0xd0, 0x00, 0xd9, 0x00, 0xe2, 0x00, 0xeb, 0x00, 0xf4, 0x00,
+  0xfd, 0x00, 0x06, 0x01, 0x0f, 0x01, 0x18, 0x01, 0x21, 0x01, 0x2a, 0x01,
+  0x33, 0x01, 0x3c, 0x01, 0x45, 0x01, 0x4e, 0x01, 0x57, 0x01, 0x60, 0x01,
+  0x67, 0x01, 0x70, 0x01, 0x7a, 0x01, 0x83, 0x01, 0x8c, 0x01, 0x00, 0x00,
+  0x16, 0x00, 0x26, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x2d, 0x00,
+  0x39, 0x00, 0x42, 0x00, 0x4d, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x16, 0x00,
+  0x20, 0x00, 0x2a, 0x00, 0x34, 0x00, 0x3d, 0x00, 0x46, 0x00, 0x50, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x17, 0x00, 0x24, 0x00, 0x29, 0x00, 0x31, 0x00,
+  0x3a, 0x00, 0x44, 0x00, 0x4c, 0x00, 0x56, 0x00, 0x60, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x1c, 0x00, 0x33, 0x00, 0x4e, 0x00, 0x5a, 0x00, 0x71, 0x00,
+  0x00, 0x00, 0x1d, 0x00, 0x29, 0x00, 0x38, 0x00, 0x48, 0x00, 0x60, 0x00,
+  0x7b, 0x00, 0x85, 0x00, 0x8c, 0x00, 0x96, 0x00, 0x9e, 0x00, 0xa9, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x1c, 0x00, 0x33, 0x00, 0x4d, 0x00, 0x57, 0x00,
+  0x61, 0x00, 0x76, 0x00, 0x80, 0x00, 0x89, 0x00, 0xa4, 0x00, 0xae, 0x00,
+  0xc4, 0x00, 0xcd, 0x00, 0xd7, 0x00, 0x00, 0x00, 0x14, 0x00, 0x39, 0x00,
+  0x4b, 0x00, 0x5a, 0x00, 0x80, 0x00, 0x89, 0x00, 0x92, 0x00, 0x99, 0x00,
+  0xaa, 0x00, 0xb3, 0x00, 0xba, 0x00, 0xc3, 0x00, 0x00, 0x00, 0x1c, 0x00,
+  0x2a, 0x00, 0x38, 0x00, 0x45, 0x00, 0x64, 0x00, 0x70, 0x00, 0x7c, 0x00,
+  0x86, 0x00, 0x90, 0x00, 0x00, 0x00, 0x20, 0x00, 0x46, 0x00, 0x53, 0x00,
+  0x60, 0x00, 0x78, 0x00, 0x92, 0x00, 0x9b, 0x00, 0xa3, 0x00, 0xb0, 0x00,
+  0xbd, 0x00, 0xc5, 0x00, 0xd2, 0x00, 0xe3, 0x00, 0xed, 0x00, 0xf6, 0x00,
+  0xff, 0x00, 0x06, 0x01, 0x1d, 0x01, 0x26, 0x01, 0x2e, 0x01, 0x38, 0x01,
+  0x40, 0x01, 0x47, 0x01, 0x00, 0x00, 0x20, 0x00, 0x3b, 0x00, 0x59, 0x00,
+  0x65, 0x00, 0x76, 0x00, 0x83, 0x00, 0x9b, 0x00, 0xaf, 0x00, 0xc3, 0x00,
+  0xcc, 0x00, 0xd5, 0x00, 0xe8, 0x00, 0xee, 0x00, 0xfc, 0x00, 0x03, 0x01,
+  0x0e, 0x01, 0x18, 0x01, 0x00, 0x00, 0x2b, 0x00, 0x49, 0x00, 0x6b, 0x00,
+  0x92, 0x00, 0xa0, 0x00, 0xae, 0x00, 0xc6, 0x00, 0xdf, 0x00, 0xec, 0x00,
+  0xf6, 0x00, 0x00, 0x01, 0x0a, 0x01, 0x11, 0x01, 0x00, 0x00, 0x25, 0x00,
+  0x53, 0x00, 0x69, 0x00, 0x79, 0x00, 0x96, 0x00, 0xae, 0x00, 0xc2, 0x00,
+  0xcf, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x3b, 0x00, 0x59, 0x00, 0x66, 0x00,
+  0x7b, 0x00, 0x8c, 0x00, 0xa5, 0x00, 0xad, 0x00, 0xb6, 0x00, 0xc0, 0x00,
+  0xc9, 0x00, 0xd4, 0x00, 0xe3, 0x00, 0xf1, 0x00, 0xfa, 0x00, 0x03, 0x01,
+  0x0c, 0x01, 0x15, 0x01, 0x1e, 0x01, 0x27, 0x01, 0x30, 0x01, 0x39, 0x01,
+  0x42, 0x01, 0x4b, 0x01, 0x54, 0x01, 0x5e, 0x01, 0x66, 0x01, 0x6f, 0x01,
+  0x78, 0x01, 0x81, 0x01, 0x8a, 0x01, 0x00, 0x00, 0x1d, 0x00, 0x43, 0x00,
+  0x51, 0x00, 0x5d, 0x00, 0x7a, 0x00, 0x9c, 0x00, 0xac, 0x00, 0xb6, 0x00,
+  0xc2, 0x00, 0xc9, 0x00, 0xcf, 0x00, 0xd6, 0x00, 0x00, 0x00, 0x1b, 0x00,
+  0x46, 0x00, 0x62, 0x00, 0x70, 0x00, 0x8e, 0x00, 0xa7, 0x00, 0xb5, 0x00,
+  0xbc, 0x00, 0x00, 0x00, 0x24, 0x00, 0x41, 0x00, 0x5d, 0x00, 0x7d, 0x00,
+  0x96, 0x00, 0xa9, 0x00, 0xb6, 0x00, 0xca, 0x00, 0xd5, 0x00, 0xe0, 0x00,
+  0xeb, 0x00, 0xf4, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x47, 0x00, 0x6f, 0x00,
+  0x87, 0x00, 0x98, 0x00, 0xa8, 0x00, 0xbf, 0x00, 0xc7, 0x00, 0xd3, 0x00,
+  0xde, 0x00, 0xe9, 0x00, 0xf1, 0x00, 0xf9, 0x00, 0x02, 0x01, 0x0a, 0x01,
+  0x16, 0x01, 0x1d, 0x01, 0x25, 0x01, 0x00, 0x00, 0x1d, 0x00, 0x3c, 0x00,
+  0x65, 0x00, 0x7e, 0x00, 0x8d, 0x00, 0x9a, 0x00, 0xb1, 0x00, 0xc3, 0x00,
+  0xd5, 0x00, 0xdb, 0x00, 0xe4, 0x00, 0xf9, 0x00, 0x02, 0x01, 0x0a, 0x01,
+  0x00, 0x00, 0x1e, 0x00, 0x49, 0x00, 0x67, 0x00, 0x80, 0x00, 0x8d, 0x00,
+  0xa8, 0x00, 0xbe, 0x00, 0xd6, 0x00, 0xdf, 0x00, 0xe7, 0x00, 0xee, 0x00,
+  0xf7, 0x00, 0xff, 0x00, 0x07, 0x01, 0x00, 0x00, 0x1f, 0x00, 0x3d, 0x00,
+  0x59, 0x00, 0x73, 0x00, 0x8b, 0x00, 0x99, 0x00, 0xa5, 0x00, 0xb7, 0x00,
+  0xc3, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x48, 0x00, 0x66, 0x00, 0x83, 0x00,
+  0x93, 0x00, 0xa0, 0x00, 0xc9, 0x00, 0xe3, 0x00, 0xf1, 0x00, 0xf9, 0x00,
+  0x03, 0x01, 0x0d, 0x01, 0x16, 0x01, 0x1f, 0x01, 0x25, 0x01, 0x2e, 0x01,
+  0x36, 0x01, 0x3e, 0x01, 0x00, 0x00, 0x21, 0x00, 0x3b, 0x00, 0x49, 0x00,
+  0x56, 0x00, 0x67, 0x00, 0x70, 0x00, 0x79, 0x00, 0x8b, 0x00, 0x94, 0x00,
+  0xae, 0x00, 0xb7, 0x00, 0xbe, 0x00, 0xc7, 0x00, 0xd3, 0x00, 0xdc, 0x00,
+  0xe5, 0x00, 0xef, 0x00, 0x00, 0x00, 0x26, 0x00, 0x45, 0x00, 0x65, 0x00,
+  0x74, 0x00, 0x83, 0x00, 0x98, 0x00, 0x9e, 0x00, 0xba, 0x00, 0xc3, 0x00,
+  0xcc, 0x00, 0xd5, 0x00, 0xde, 0x00, 0xe7, 0x00, 0x00, 0x00, 0x20, 0x00,
+  0x3d, 0x00, 0x5e, 0x00, 0x6f, 0x00, 0x94, 0x00, 0xae, 0x00, 0xb4, 0x00,
+  0xbf, 0x00, 0xca, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x2a, 0x00, 0x45, 0x00,
+  0x59, 0x00, 0x66, 0x00, 0x74, 0x00, 0x91, 0x00, 0x00, 0x00, 0x22, 0x00,
+  0x31, 0x00, 0x43, 0x00, 0x5a, 0x00, 0x6e, 0x00, 0x77, 0x00, 0x7f, 0x00,
+  0x86, 0x00, 0x8d, 0x00, 0x99, 0x00, 0xa4, 0x00, 0xb6, 0x00, 0xc0, 0x00,
+  0x00, 0x00, 0x1b, 0x00, 0x26, 0x00, 0x34, 0x00, 0x44, 0x00, 0x4d, 0x00,
+  0x6f, 0x00, 0x75, 0x00, 0x7f, 0x00, 0x86, 0x00, 0x8c, 0x00, 0x92, 0x00,
+  0x9c, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x21, 0x00, 0x3e, 0x00, 0x5a, 0x00,
+  0x64, 0x00, 0x6d, 0x00, 0x77, 0x00, 0x80, 0x00, 0x00, 0x00, 0x1e, 0x00,
+  0x3d, 0x00, 0x59, 0x00, 0x67, 0x00, 0x80, 0x00, 0x00, 0x00, 0x1c, 0x00,
+  0x37, 0x00, 0x54, 0x00, 0x6b, 0x00, 0x77, 0x00, 0x8f, 0x00, 0x9d, 0x00,
+  0xb5, 0x00, 0x00, 0x00, 0x21, 0x00, 0x3e, 0x00, 0x63, 0x00, 0x73, 0x00,
+  0x82, 0x00, 0x9f, 0x00, 0xc5, 0x00, 0xd5, 0x00, 0xe4, 0x00, 0xf3, 0x00,
+  0x0d, 0x01, 0x15, 0x01, 0x20, 0x01, 0x28, 0x01, 0x37, 0x01, 0x3d, 0x01,
+  0x00, 0x00, 0x21, 0x00, 0x3f, 0x00, 0x52, 0x00, 0x61, 0x00, 0x7a, 0x00,
+  0x85, 0x00, 0x97, 0x00, 0xa0, 0x00, 0xa9, 0x00, 0xb2, 0x00, 0xbb, 0x00,
+  0xc4, 0x00, 0xcd, 0x00, 0xd6, 0x00, 0xdf, 0x00, 0xe8, 0x00, 0xf1, 0x00,
+  0xfa, 0x00, 0x03, 0x01, 0x0c, 0x01, 0x15, 0x01, 0x1e, 0x01, 0x28, 0x01,
+  0x31, 0x01, 0x3a, 0x01, 0x43, 0x01, 0x4c, 0x01, 0x5d, 0x01, 0x66, 0x01,
+  0x6f, 0x01, 0x78, 0x01, 0x81, 0x01, 0x8a, 0x01, 0x93, 0x01, 0x9c, 0x01,
+  0xa5, 0x01, 0xae, 0x01, 0xb7, 0x01, 0xc0, 0x01, 0xc9, 0x01, 0xd2, 0x01,
+  0xdb, 0x01, 0xe4, 0x01, 0xee, 0x01, 0xf7, 0x01, 0x00, 0x02, 0x09, 0x02,
+  0x12, 0x02, 0x1b, 0x02, 0x00, 0x00, 0x1b, 0x00, 0x37, 0x00, 0x61, 0x00,
+  0x70, 0x00, 0x80, 0x00, 0x99, 0x00, 0xb3, 0x00, 0xbf, 0x00, 0xcc, 0x00,
+  0xdd, 0x00, 0xf6, 0x00, 0x03, 0x01, 0x0b, 0x01, 0x17, 0x01, 0x00, 0x00,
+  0x10, 0x00, 0x20, 0x00, 0x39, 0x00, 0x5d, 0x00, 0x6b, 0x00, 0x74, 0x00,
+  0x7e, 0x00, 0x92, 0x00, 0xa8, 0x00, 0xae, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x20, 0x00, 0x38, 0x00, 0x5f, 0x00, 0x67, 0x00, 0x70, 0x00, 0x79, 0x00,
+  0x82, 0x00, 0x8a, 0x00, 0x92, 0x00, 0x9b, 0x00, 0xa3, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x37, 0x00, 0x40, 0x00, 0x4c, 0x00, 0x55, 0x00, 0x5e, 0x00,
+  0x67, 0x00, 0x70, 0x00, 0x79, 0x00, 0x82, 0x00, 0x8b, 0x00, 0x94, 0x00,
+  0x9d, 0x00, 0xa9, 0x00, 0xb2, 0x00, 0xbb, 0x00, 0xc7, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x1a, 0x00, 0x22, 0x00, 0x2a, 0x00, 0x32, 0x00, 0x3a, 0x00,
+  0x44, 0x00, 0x4d, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x22, 0x00, 0x37, 0x00,
+  0x42, 0x00, 0x4d, 0x00, 0x62, 0x00, 0x6c, 0x00, 0x76, 0x00, 0x81, 0x00,
+  0x00, 0x00, 0x0f, 0x00, 0x24, 0x00, 0x30, 0x00, 0x3c, 0x00, 0x48, 0x00,
+  0x54, 0x00, 0x61, 0x00, 0x6d, 0x00, 0x79, 0x00, 0x84, 0x00, 0x92, 0x00,
+  0x99, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x35, 0x00, 0x4c, 0x00, 0x59, 0x00,
+  0x00, 0x00, 0x1f, 0x00, 0x3c, 0x00, 0x4d, 0x00, 0x5a, 0x00, 0x63, 0x00,
+  0x73, 0x00, 0x81, 0x00, 0x92, 0x00, 0x9b, 0x00, 0xac, 0x00, 0xbb, 0x00,
+  0xce, 0x00, 0xd7, 0x00, 0xe1, 0x00, 0xea, 0x00, 0xf3, 0x00, 0xff, 0x00,
+  0x08, 0x01, 0x11, 0x01, 0x23, 0x01, 0x2c, 0x01, 0x35, 0x01, 0x3e, 0x01,
+  0x51, 0x01, 0x63, 0x01, 0x00, 0x00, 0x1d, 0x00, 0x2b, 0x00, 0x38, 0x00,
+  0x46, 0x00, 0x4f, 0x00, 0x58, 0x00, 0x62, 0x00, 0x6b, 0x00, 0x76, 0x00,
+  0x00, 0x00, 0x1e, 0x00, 0x2c, 0x00, 0x38, 0x00, 0x41, 0x00, 0x4f, 0x00,
+  0x59, 0x00, 0x62, 0x00, 0x00, 0x00, 0x22, 0x00, 0x31, 0x00, 0x38, 0x00,
+  0x43, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x38, 0x00, 0x48, 0x00, 0x5b, 0x00,
+  0x66, 0x00, 0x73, 0x00, 0x7c, 0x00, 0x85, 0x00, 0x8e, 0x00, 0x9e, 0x00,
+  0xa8, 0x00, 0xb1, 0x00, 0xba, 0x00, 0xc3, 0x00, 0xcc, 0x00, 0xd6, 0x00,
+  0xe8, 0x00, 0xf1, 0x00, 0xfa, 0x00, 0x03, 0x01, 0x0c, 0x01, 0x15, 0x01,
+  0x1e, 0x01, 0x00, 0x00, 0x20, 0x00, 0x2f, 0x00, 0x41, 0x00, 0x50, 0x00,
+  0x5d, 0x00, 0x65, 0x00, 0x77, 0x00, 0x7d, 0x00, 0x86, 0x00, 0x00, 0x00,
+  0x1f, 0x00, 0x3e, 0x00, 0x4b, 0x00, 0x54, 0x00, 0x5d, 0x00, 0x64, 0x00,
+  0x00, 0x00, 0x1d, 0x00, 0x3a, 0x00, 0x51, 0x00, 0x5c, 0x00, 0x7c, 0x00,
+  0x85, 0x00, 0x8e, 0x00, 0x97, 0x00, 0xa0, 0x00, 0xa9, 0x00, 0xb2, 0x00,
+  0xbb, 0x00, 0xc4, 0x00, 0xcd, 0x00, 0xd6, 0x00, 0xdf, 0x00, 0xe8, 0x00,
+  0xf1, 0x00, 0xfa, 0x00, 0x03, 0x01, 0x15, 0x01, 0x1e, 0x01, 0x27, 0x01,
+  0x30, 0x01, 0x39, 0x01, 0x43, 0x01, 0x4c, 0x01, 0x55, 0x01, 0x5e, 0x01,
+  0x67, 0x01, 0x70, 0x01, 0x79, 0x01, 0x82, 0x01, 0x8b, 0x01, 0x94, 0x01,
+  0x9d, 0x01, 0xa6, 0x01, 0xaf, 0x01, 0xc3, 0x01, 0xcc, 0x01, 0xd5, 0x01,
+  0xde, 0x01, 0xf0, 0x01, 0xf9, 0x01, 0x05, 0x02, 0x10, 0x02, 0x24, 0x02,
+  0x2b, 0x02, 0x00, 0x00, 0x26, 0x00, 0x36, 0x00, 0x5b, 0x00, 0x67, 0x00,
+  0x73, 0x00, 0x7f, 0x00, 0x88, 0x00, 0x8f, 0x00, 0x00, 0x00, 0x1e, 0x00,
+  0x2a, 0x00, 0x50, 0x00, 0x5b, 0x00, 0x66, 0x00, 0x71, 0x00, 0x7c, 0x00,
+  0x87, 0x00, 0x92, 0x00, 0x9d, 0x00, 0xa8, 0x00, 0xb4, 0x00, 0xbf, 0x00,
+  0xca, 0x00, 0xd5, 0x00, 0xe0, 0x00, 0xeb, 0x00, 0xf6, 0x00, 0x01, 0x01,
+  0x0d, 0x01, 0x18, 0x01, 0x23, 0x01, 0x2f, 0x01, 0x3a, 0x01, 0x52, 0x01,
+  0x5a, 0x01, 0x66, 0x01, 0x00, 0x00, 0x1f, 0x00, 0x44, 0x00, 0x61, 0x00,
+  0x70, 0x00, 0x92, 0x00, 0x9c, 0x00, 0xa9, 0x00, 0xb3, 0x00, 0xbc, 0x00,
+  0xc6, 0x00, 0xd0, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x25, 0x00, 0x2e, 0x00,
+  0x37, 0x00, 0x40, 0x00, 0x49, 0x00, 0x52, 0x00, 0x5b, 0x00, 0x67, 0x00,
+  0x6e, 0x00, 0x75, 0x00, 0x8b, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x3e, 0x00,
+  0x5b, 0x00, 0x64, 0x00, 0x6f, 0x00, 0x7c, 0x00, 0x8b, 0x00, 0x9b, 0x00,
+  0xa5, 0x00, 0x00, 0x00, 0x27, 0x00, 0x30, 0x00, 0x37, 0x00, 0x3e, 0x00,
+  0x4a, 0x00, 0x56, 0x00, 0x61, 0x00, 0x00, 0x00, 0x24, 0x00, 0x35, 0x00,
+  0x3e, 0x00, 0x48, 0x00, 0x5c, 0x00, 0x69, 0x00, 0x71, 0x00, 0x79, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x38, 0x00, 0x48, 0x00, 0x59, 0x00,
+  0x5f, 0x00, 0x6a, 0x00, 0x73, 0x00, 0x7e, 0x00, 0x89, 0x00, 0x90, 0x00,
+  0x99, 0x00, 0xa5, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x37, 0x00, 0x58, 0x00,
+  0x68, 0x00, 0x75, 0x00, 0x87, 0x00, 0x8f, 0x00, 0x98, 0x00, 0xa1, 0x00,
+  0xaa, 0x00, 0xb2, 0x00, 0x00, 0x00, 0x25, 0x00, 0x2e, 0x00, 0x37, 0x00,
+  0x4d, 0x00, 0x56, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x23, 0x00, 0x41, 0x00,
+  0x5f, 0x00, 0x68, 0x00, 0x77, 0x00, 0x7f, 0x00, 0x88, 0x00, 0x90, 0x00,
+  0x96, 0x00, 0x9c, 0x00, 0x00, 0x00, 0x20, 0x00, 0x42, 0x00, 0x4d, 0x00,
+  0x58, 0x00, 0x61, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x34, 0x00, 0x3c, 0x00,
+  0x4c, 0x00, 0x5c, 0x00, 0x70, 0x00, 0x78, 0x00, 0x00, 0x00, 0x1f, 0x00,
+  0x3b, 0x00, 0x4f, 0x00, 0x5b, 0x00, 0x6e, 0x00, 0x78, 0x00, 0x81, 0x00,
+  0x00, 0x00, 0x39, 0x00, 0x56, 0x00, 0x67, 0x00, 0x71, 0x00, 0x81, 0x00,
+  0x96, 0x00, 0xa5, 0x00, 0xb0, 0x00, 0xb9, 0x00, 0xc3, 0x00, 0xcd, 0x00,
+  0xd7, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00,
+  0x16, 0x00, 0x21, 0x00, 0x2c, 0x00, 0x37, 0x00, 0x42, 0x00, 0x4d, 0x00,
+  0x57, 0x00, 0x62, 0x00, 0x6d, 0x00, 0x76, 0x00, 0x8e, 0x00, 0x9a, 0x00,
+  0xa4, 0x00, 0x00, 0x00, 0x10, 0x00, 0x1a, 0x00, 0x24, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x08, 0x00, 0x15, 0x00, 0x22, 0x00, 0x30, 0x00, 0x3c, 0x00,
+  0x44, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x17, 0x00, 0x1d, 0x00, 0x23, 0x00,
+  0x2c, 0x00, 0x00, 0x00, 0x09, 0x00, 0x11, 0x00, 0x21, 0x00, 0x31, 0x00,
+  0x40, 0x00, 0x51, 0x00, 0x59, 0x00, 0x60, 0x00, 0x67, 0x00, 0x72, 0x00,
+  0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x1b, 0x00, 0x2b, 0x00,
+  0x34, 0x00, 0x46, 0x00, 0x57, 0x00, 0x61, 0x00, 0x73, 0x00, 0x84, 0x00,
+  0x94, 0x00, 0xa1, 0x00, 0xaa, 0x00, 0xb3, 0x00, 0xbc, 0x00, 0xce, 0x00,
+  0xd7, 0x00, 0xe0, 0x00, 0xe9, 0x00, 0xf2, 0x00, 0x03, 0x01, 0x0f, 0x01,
+  0x19, 0x01, 0x1f, 0x01, 0x25, 0x01, 0x31, 0x01, 0x3b, 0x01, 0x4d, 0x01,
+  0x00, 0x00, 0x0a, 0x00, 0x10, 0x00, 0x1a, 0x00, 0x25, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x16, 0x00, 0x21, 0x00, 0x2a, 0x00, 0x31, 0x00, 0x3a, 0x00,
+  0x41, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x14, 0x00, 0x00, 0x00, 0x0f, 0x00,
+  0x18, 0x00, 0x21, 0x00, 0x34, 0x00, 0x44, 0x00, 0x4d, 0x00, 0x56, 0x00,
+  0x5f, 0x00, 0x68, 0x00, 0x71, 0x00, 0x7b, 0x00, 0x8f, 0x00, 0x98, 0x00,
+  0xa9, 0x00, 0xb2, 0x00, 0xbc, 0x00, 0xc6, 0x00, 0xcf, 0x00, 0xd8, 0x00,
+  0x00, 0x00, 0x0a, 0x00, 0x26, 0x00, 0x2c, 0x00, 0x37, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x13, 0x00,
+  0x22, 0x00, 0x31, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x16, 0x00,
+  0x21, 0x00, 0x2c, 0x00, 0x37, 0x00, 0x42, 0x00, 0x4d, 0x00, 0x58, 0x00,
+  0x63, 0x00, 0x6e, 0x00, 0x79, 0x00, 0x84, 0x00, 0x8f, 0x00, 0x9a, 0x00,
+  0xa5, 0x00, 0xb0, 0x00, 0xbb, 0x00, 0xc6, 0x00, 0xd1, 0x00, 0xe5, 0x00,
+  0xef, 0x00, 0xf5, 0x00, 0x00, 0x01, 0x0a, 0x01, 0x14, 0x01, 0x00, 0x00,
+  0x09, 0x00, 0x13, 0x00, 0x24, 0x00, 0x36, 0x00, 0x00, 0x00, 0x19, 0x00,
+  0x24, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x16, 0x00, 0x22, 0x00, 0x2e, 0x00,
+  0x37, 0x00, 0x4c, 0x00, 0x58, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x16, 0x00,
+  0x22, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x13, 0x00, 0x1d, 0x00, 0x25, 0x00,
+  0x00, 0x00, 0x07, 0x00, 0x12, 0x00, 0x19, 0x00, 0x20, 0x00, 0x29, 0x00,
+  0x34, 0x00, 0x3f, 0x00, 0x4a, 0x00, 0x55, 0x00, 0x5c, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x18, 0x00, 0x21, 0x00, 0x2b, 0x00, 0x33, 0x00, 0x3b, 0x00,
+  0x42, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x13, 0x00, 0x2a, 0x00, 0x33, 0x00,
+  0x3e, 0x00, 0x4d, 0x00, 0x54, 0x00, 0x00, 0x00, 0x08, 0x00, 0x10, 0x00,
+  0x1a, 0x00, 0x23, 0x00, 0x2b, 0x00, 0x34, 0x00, 0x3d, 0x00, 0x4d, 0x00,
+  0x55, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x07, 0x00, 0x19, 0x00, 0x24, 0x00,
+  0x2f, 0x00, 0x36, 0x00, 0x3d, 0x00, 0x46, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x19, 0x00, 0x28, 0x00, 0x30, 0x00, 0x38, 0x00, 0x41, 0x00, 0x49, 0x00,
+  0x51, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x21, 0x00,
+  0x35, 0x00, 0x3f, 0x00, 0x53, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x30, 0x00,
+  0x4a, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x16, 0x00,
+  0x21, 0x00, 0x2c, 0x00, 0x37, 0x00, 0x42, 0x00, 0x4d, 0x00, 0x58, 0x00,
+  0x63, 0x00, 0x6e, 0x00, 0x79, 0x00, 0x84, 0x00, 0x8f, 0x00, 0x9d, 0x00,
+  0x00, 0x00, 0x07, 0x00, 0x0e, 0x00, 0x15, 0x00, 0x00, 0x00, 0x06, 0x00,
+  0x0d, 0x00, 0x1a, 0x00, 0x21, 0x00, 0x2a, 0x00, 0x31, 0x00, 0x38, 0x00,
+  0x00, 0x00, 0x08, 0x00, 0x18, 0x00, 0x22, 0x00, 0x2a, 0x00, 0x30, 0x00,
+  0x36, 0x00, 0x40, 0x00, 0x46, 0x00, 0x00, 0x00, 0x09, 0x00, 0x1f, 0x00,
+  0x26, 0x00, 0x2f, 0x00, 0x44, 0x00, 0x4d, 0x00, 0x57, 0x00, 0x5e, 0x00,
+  0x65, 0x00, 0x00, 0x00, 0x09, 0x00, 0x11, 0x00, 0x20, 0x00, 0x2f, 0x00,
+  0x38, 0x00, 0x40, 0x00, 0x48, 0x00, 0x5e, 0x00, 0x66, 0x00, 0x76, 0x00,
+  0x85, 0x00, 0x94, 0x00, 0x9c, 0x00, 0xa4, 0x00, 0xac, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x13, 0x00, 0x00, 0x00, 0x09, 0x00, 0x11, 0x00, 0x1a, 0x00,
+  0x2a, 0x00, 0x31, 0x00, 0x39, 0x00, 0x41, 0x00, 0x49, 0x00, 0x52, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x1b, 0x00, 0x25, 0x00, 0x30, 0x00, 0x3a, 0x00,
+  0x43, 0x00, 0x4c, 0x00, 0x56, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x08, 0x00,
+  0x1a, 0x00, 0x22, 0x00, 0x2b, 0x00, 0x33, 0x00, 0x3b, 0x00, 0x4b, 0x00,
+  0x54, 0x00, 0x5c, 0x00, 0x64, 0x00, 0x72, 0x00, 0x80, 0x00, 0x89, 0x00,
+  0x99, 0x00, 0xa2, 0x00, 0xaa, 0x00, 0xb2, 0x00, 0xba, 0x00, 0xc2, 0x00,
+  0xca, 0x00, 0xd2, 0x00, 0xdb, 0x00, 0xe3, 0x00, 0xeb, 0x00, 0xf3, 0x00,
+  0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x10, 0x00, 0x21, 0x00,
+  0x29, 0x00, 0x36, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x19, 0x00, 0x23, 0x00, 0x36, 0x00, 0x3e, 0x00, 0x46, 0x00,
+  0x4e, 0x00, 0x00, 0x00, 0x09, 0x00, 0x12, 0x00, 0x1b, 0x00, 0x25, 0x00,
+  0x2e, 0x00, 0x39, 0x00, 0x42, 0x00, 0x4b, 0x00, 0x55, 0x00, 0x5e, 0x00,
+  0x68, 0x00, 0x00, 0x00, 0x08, 0x00, 0x13, 0x00, 0x1e, 0x00, 0x29, 0x00,
+  0x34, 0x00, 0x3f, 0x00, 0x47, 0x00, 0x52, 0x00, 0x5d, 0x00, 0x68, 0x00,
+  0x73, 0x00, 0x7e, 0x00, 0x86, 0x00, 0x8e, 0x00, 0x97, 0x00, 0x9f, 0x00,
+  0xb0, 0x00, 0xb9, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x15, 0x00,
+  0x1d, 0x00, 0x31, 0x00, 0x44, 0x00, 0x4d, 0x00, 0x59, 0x00, 0x6e, 0x00,
+  0x7b, 0x00, 0x00, 0x00, 0x09, 0x00, 0x12, 0x00, 0x1e, 0x00, 0x2a, 0x00,
+  0x36, 0x00, 0x42, 0x00, 0x4a, 0x00, 0x52, 0x00, 0x5a, 0x00, 0x62, 0x00,
+  0x7f, 0x00, 0x87, 0x00, 0x00, 0x00, 0x09, 0x00, 0x12, 0x00, 0x1b, 0x00,
+  0x24, 0x00, 0x34, 0x00, 0x4a, 0x00, 0x53, 0x00, 0x5c, 0x00, 0x65, 0x00,
+  0x6f, 0x00, 0x78, 0x00, 0x82, 0x00, 0x93, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x17, 0x00, 0x21, 0x00, 0x28, 0x00, 0x31, 0x00, 0x3a, 0x00, 0x43, 0x00,
+  0x49, 0x00, 0x52, 0x00, 0x00, 0x00, 0x34, 0x00, 0x43, 0x00, 0x5c, 0x00,
+  0x6c, 0x00, 0x7b, 0x00, 0x85, 0x00, 0x8d, 0x00, 0x96, 0x00, 0x00, 0x00,
+  0x33, 0x00, 0x3f, 0x00, 0x4b, 0x00, 0x57, 0x00, 0x62, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x38, 0x00, 0x6f, 0x00, 0xa3, 0x00,
+  0xd8, 0x00, 0xe6, 0x00, 0xee, 0x00, 0xf7, 0x00, 0xfe, 0x00, 0x00, 0x00,
+  0x38, 0x00, 0x70, 0x00, 0xa7, 0x00, 0xde, 0x00, 0x12, 0x01, 0x47, 0x01,
+  0x50, 0x01, 0x5f, 0x01, 0x67, 0x01, 0x70, 0x01, 0x78, 0x01, 0x80, 0x01,
+  0x89, 0x01, 0x91, 0x01, 0x00, 0x00, 0x0b, 0x00, 0x12, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x18, 0x00, 0x28, 0x00, 0x30, 0x00, 0x00, 0x00, 0x0d, 0x00,
+  0x16, 0x00, 0x23, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x14, 0x00, 0x1e, 0x00,
+  0x29, 0x00, 0x35, 0x00, 0x49, 0x00, 0x52, 0x00, 0x5b, 0x00
+};
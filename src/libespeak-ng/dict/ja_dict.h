@@ -1,5 +1,7 @@
 #pragma once
-const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
+#include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/ja_dict_index.h>
+const unsigned char __espeakng_dict_ja[] __attribute__((aligned((4)))) = {
   0x00, 0x04, 0x00, 0x00, 0x68, 0xa3, 0x00, 0x00, 0x00, 0x46, 0x19, 0xf0,
   0x9f, 0x91, 0xa9, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xe2, 0x80,
   0x8d, 0xf0, 0x9f, 0x91, 0xa7, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa7,
@@ -3972,4 +3974,11 @@ const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
   0x80, 0x81, 0xe3, 0x81, 0x87, 0x03, 0x39, 0x24, 0x0c, 0x00, 0x80, 0x81,
   0xe3, 0x81, 0x88, 0x00, 0x80, 0x81, 0xe3, 0x83, 0xbc, 0x00, 0x07, 0x00
 };
-size_t __espeakng_dictlen = 47652;
+
+BackgroundAudioDictionary dict_ja = {
+    "ja",
+    47652,
+    __espeakng_dict_ja,
+    7054,
+    __espeakng_dictindex_ja
+};
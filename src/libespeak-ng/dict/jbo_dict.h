@@ -1,5 +1,7 @@
 #pragma once
-const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
+#include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/jbo_dict_index.h>
+const unsigned char __espeakng_dict_jbo[] __attribute__((aligned((4)))) = {
   0x00, 0x04, 0x00, 0x00, 0x01, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x04, 0xc1, 0x04, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x06, 0x41, 0x08,
   0x48, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x41, 0x0c, 0x5c, 0x0d,
@@ -188,4 +190,11 @@ const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
   0x80, 0x84, 0x81, 0x00, 0x2e, 0x01, 0x0f, 0x02, 0x0f, 0x03, 0x0f, 0x30,
   0x02, 0x25, 0x0f, 0x04, 0x00, 0x27, 0x03, 0x41, 0x00, 0x07, 0x00
 };
-size_t __espeakng_dictlen = 2243;
+
+BackgroundAudioDictionary dict_jbo = {
+    "jbo",
+    2243,
+    __espeakng_dict_jbo,
+    2324,
+    __espeakng_dictindex_jbo
+};
@@ -1,5 +1,7 @@
 #pragma once
-const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
+#include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/ka_dict_index.h>
+const unsigned char __espeakng_dict_ka[] __attribute__((aligned((4)))) = {
   0x00, 0x04, 0x00, 0x00, 0x47, 0x55, 0x01, 0x00, 0x00, 0x64, 0x19, 0xf0,
   0x9f, 0x91, 0xa9, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xe2, 0x80,
   0x8d, 0xf0, 0x9f, 0x91, 0xa7, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa7,
@@ -7316,4 +7318,11 @@ const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
   0x01, 0x5b, 0x00, 0x03, 0x00, 0x07, 0x06, 0x00, 0x24, 0x03, 0x49, 0x27,
   0x37, 0x23, 0x22, 0x25, 0x00, 0x07, 0x00
 };
-size_t __espeakng_dictlen = 87775;
+
+BackgroundAudioDictionary dict_ka = {
+    "ka",
+    87775,
+    __espeakng_dict_ka,
+    7430,
+    __espeakng_dictindex_ka
+};
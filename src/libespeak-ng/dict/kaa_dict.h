@@ -1,5 +1,7 @@
 #pragma once
-const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
+#include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/kaa_dict_index.h>
+const unsigned char __espeakng_dict_kaa[] __attribute__((aligned((4)))) = {
   0x00, 0x04, 0x00, 0x00, 0x3c, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x0e, 0x04, 0x5f, 0x64, 0x70, 0x74, 0x0a, 0x5b,
@@ -154,4 +156,11 @@ const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
   0x00, 0x07, 0x06, 0x00, 0xca, 0xbb, 0x03, 0x13, 0x00, 0xc3, 0xa7, 0x03,
   0x4d, 0x00, 0xc5, 0x9f, 0x03, 0x5c, 0x00, 0x07, 0x00
 };
-size_t __espeakng_dictlen = 1833;
+
+BackgroundAudioDictionary dict_kaa = {
+    "kaa",
+    1833,
+    __espeakng_dict_kaa,
+    2146,
+    __espeakng_dictindex_kaa
+};
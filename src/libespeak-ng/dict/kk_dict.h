@@ -1,5 +1,7 @@
 #pragma once
-const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
+#include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/kk_dict_index.h>
+const unsigned char __espeakng_dict_kk[] __attribute__((aligned((4)))) = {
   0x00, 0x04, 0x00, 0x00, 0xec, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x0e, 0x04, 0x5f, 0x64, 0x70, 0x74, 0x0a, 0x5b,
@@ -156,4 +158,11 @@ const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
   0xbb, 0x00, 0x03, 0x41, 0x00, 0x07, 0x06, 0xd3, 0x99, 0x00, 0x03, 0x71,
   0x00, 0x07, 0x06, 0xd3, 0xa9, 0x00, 0x03, 0x6d, 0x00, 0x07, 0x00
 };
-size_t __espeakng_dictlen = 1859;
+
+BackgroundAudioDictionary dict_kk = {
+    "kk",
+    1859,
+    __espeakng_dict_kk,
+    2222,
+    __espeakng_dictindex_kk
+};
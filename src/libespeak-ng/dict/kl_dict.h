@@ -1,5 +1,7 @@
 #pragma once
-const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
+#include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/kl_dict_index.h>
+const unsigned char __espeakng_dict_kl[] __attribute__((aligned((4)))) = {
   0x00, 0x04, 0x00, 0x00, 0x12, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x41, 0x08, 0x48, 0x6c, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x06, 0x41, 0x0c, 0x5a, 0x6c, 0x00, 0x00, 0x00, 0x00,
@@ -238,4 +240,11 @@ const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
   0x00, 0x03, 0x59, 0x00, 0x07, 0x06, 0x00, 0x24, 0x03, 0x49, 0x06, 0x27,
   0x37, 0x23, 0x22, 0x00, 0x07, 0x00
 };
-size_t __espeakng_dictlen = 2838;
+
+BackgroundAudioDictionary dict_kl = {
+    "kl",
+    2838,
+    __espeakng_dict_kl,
+    2374,
+    __espeakng_dictindex_kl
+};
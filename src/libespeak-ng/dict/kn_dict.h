@@ -1,5 +1,7 @@
 #pragma once
-const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
+#include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/kn_dict_index.h>
+const unsigned char __espeakng_dict_kn[] __attribute__((aligned((4)))) = {
   0x00, 0x04, 0x00, 0x00, 0x1c, 0x53, 0x01, 0x00, 0x00, 0x79, 0x19, 0xf0,
   0x9f, 0x91, 0xa9, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xe2, 0x80,
   0x8d, 0xf0, 0x9f, 0x91, 0xa7, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa7,
@@ -7320,4 +7322,11 @@ const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
   0x03, 0x7b, 0x00, 0x88, 0x03, 0x86, 0x00, 0x8c, 0x03, 0x87, 0x00, 0x07,
   0x06, 0x00, 0x24, 0x03, 0x49, 0x77, 0x3e, 0x23, 0x22, 0x00, 0x07, 0x00
 };
-size_t __espeakng_dictlen = 87828;
+
+BackgroundAudioDictionary dict_kn = {
+    "kn",
+    87828,
+    __espeakng_dict_kn,
+    7772,
+    __espeakng_dictindex_kn
+};
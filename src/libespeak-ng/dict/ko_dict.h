@@ -1,5 +1,7 @@
 #pragma once
-const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
+#include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/ko_dict_index.h>
+const unsigned char __espeakng_dict_ko[] __attribute__((aligned((4)))) = {
   0x00, 0x04, 0x00, 0x00, 0xa3, 0xb5, 0x00, 0x00, 0x00, 0x4e, 0x19, 0xf0,
   0x9f, 0x91, 0xa9, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xe2, 0x80,
   0x8d, 0xf0, 0x9f, 0x91, 0xa7, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa7,
@@ -3962,4 +3964,11 @@ const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
   0x70, 0x00, 0x07, 0x06, 0x00, 0x04, 0x2e, 0x03, 0x00, 0xcb, 0x90, 0x03,
   0x00, 0x07, 0x00
 };
-size_t __espeakng_dictlen = 47523;
+
+BackgroundAudioDictionary dict_ko = {
+    "ko",
+    47523,
+    __espeakng_dict_ko,
+    7384,
+    __espeakng_dictindex_ko
+};
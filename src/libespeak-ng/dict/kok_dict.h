@@ -1,5 +1,7 @@
 #pragma once
-const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
+#include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/kok_dict_index.h>
+const unsigned char __espeakng_dict_kok[] __attribute__((aligned((4)))) = {
   0x00, 0x04, 0x00, 0x00, 0x1c, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x11, 0x04, 0x5f, 0x64, 0x70, 0x74, 0x0a, 0x49,
@@ -534,4 +536,11 @@ const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
   0x93, 0x03, 0x7a, 0x49, 0x0c, 0x8a, 0x0d, 0x22, 0x04, 0x0d, 0x43, 0x0d,
   0x76, 0x22, 0x06, 0x6d, 0x42, 0x89, 0x0d, 0x00, 0x07, 0x00
 };
-size_t __espeakng_dictlen = 6394;
+
+BackgroundAudioDictionary dict_kok = {
+    "kok",
+    6394,
+    __espeakng_dict_kok,
+    2636,
+    __espeakng_dictindex_kok
+};
@@ -1,5 +1,7 @@
 #pragma once
-const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
+#include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/ku_dict_index.h>
+const unsigned char __espeakng_dict_ku[] __attribute__((aligned((4)))) = {
   0x00, 0x04, 0x00, 0x00, 0x71, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x04, 0xc1, 0x04, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x06, 0x41, 0x08,
   0x48, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x41, 0x0c, 0x4c, 0x24,
@@ -190,4 +192,11 @@ const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
   0x24, 0x03, 0x49, 0x6f, 0x37, 0x23, 0x22, 0x00, 0xc3, 0xbc, 0x03, 0x70,
   0x00, 0xc3, 0xb6, 0x03, 0x7c, 0x0c, 0x00, 0x07, 0x00
 };
-size_t __espeakng_dictlen = 2265;
+
+BackgroundAudioDictionary dict_ku = {
+    "ku",
+    2265,
+    __espeakng_dict_ku,
+    2386,
+    __espeakng_dictindex_ku
+};
@@ -1,5 +1,7 @@
 #pragma once
-const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
+#include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/ky_dict_index.h>
+const unsigned char __espeakng_dict_ky[] __attribute__((aligned((4)))) = {
   0x00, 0x04, 0x00, 0x00, 0xd5, 0xf9, 0x00, 0x00, 0x00, 0x4a, 0x19, 0xf0,
   0x9f, 0x91, 0xa9, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xe2, 0x80,
   0x8d, 0xf0, 0x9f, 0x91, 0xa7, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa7,
@@ -5416,4 +5418,11 @@ const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
   0xa9, 0x02, 0x12, 0x44, 0x20, 0x00, 0xd3, 0xa9, 0x02, 0x20, 0x00, 0x03,
   0x6e, 0x00, 0xd3, 0xa9, 0x03, 0x76, 0x00, 0x07, 0x00
 };
-size_t __espeakng_dictlen = 64977;
+
+BackgroundAudioDictionary dict_ky = {
+    "ky",
+    64977,
+    __espeakng_dict_ky,
+    7370,
+    __espeakng_dictindex_ky
+};
@@ -1,5 +1,7 @@
 #pragma once
-const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
+#include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/la_dict_index.h>
+const unsigned char __espeakng_dict_la[] __attribute__((aligned((4)))) = {
   0x00, 0x04, 0x00, 0x00, 0x37, 0x0b, 0x00, 0x00, 0x07, 0x84, 0x66, 0x75,
   0xc4, 0xab, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xc1, 0x04, 0x48,
   0x05, 0x41, 0x04, 0x70, 0x00, 0x00, 0x07, 0xc4, 0x41, 0x23, 0xd0, 0x14,
@@ -319,4 +321,11 @@ const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
   0x00, 0x07, 0x06, 0x00, 0x6a, 0x03, 0x39, 0x00, 0x77, 0x03, 0x3a, 0x00,
   0x07, 0x00
 };
-size_t __espeakng_dictlen = 3806;
+
+BackgroundAudioDictionary dict_la = {
+    "la",
+    3806,
+    __espeakng_dict_la,
+    2714,
+    __espeakng_dictindex_la
+};
@@ -0,0 +1,230 @@
+#pragma once
+const unsigned char __espeakng_dictindex_la[] __attribute__((aligned((4)))) = {
+  0x45, 0x44, 0x58, 0x31, 0xde, 0x0e, 0x00, 0x00, 0x37, 0x0b, 0x00, 0x00,
+  0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x01, 0x00, 0x01, 0x00, 0x03, 0x00, 0x05, 0x00, 0x05, 0x00, 0x05, 0x00,
+  0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x07, 0x00, 0x08, 0x00, 0x08, 0x00,
+  0x08, 0x00, 0x08, 0x00, 0x09, 0x00, 0x09, 0x00, 0x0a, 0x00, 0x0a, 0x00,
+  0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0d, 0x00, 0x0d, 0x00,
+  0x0d, 0x00, 0x0d, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00,
+  0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x11, 0x00, 0x11, 0x00,
+  0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x12, 0x00, 0x12, 0x00, 0x12, 0x00,
+  0x14, 0x00, 0x14, 0x00, 0x14, 0x00, 0x14, 0x00, 0x16, 0x00, 0x16, 0x00,
+  0x16, 0x00, 0x16, 0x00, 0x17, 0x00, 0x17, 0x00, 0x17, 0x00, 0x17, 0x00,
+  0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x19, 0x00, 0x19, 0x00,
+  0x1a, 0x00, 0x1a, 0x00, 0x1b, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00,
+  0x1d, 0x00, 0x1d, 0x00, 0x1d, 0x00, 0x1d, 0x00, 0x1e, 0x00, 0x1e, 0x00,
+  0x1e, 0x00, 0x1e, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x1f, 0x00,
+  0x21, 0x00, 0x22, 0x00, 0x22, 0x00, 0x22, 0x00, 0x23, 0x00, 0x23, 0x00,
+  0x24, 0x00, 0x24, 0x00, 0x25, 0x00, 0x25, 0x00, 0x25, 0x00, 0x25, 0x00,
+  0x25, 0x00, 0x25, 0x00, 0x25, 0x00, 0x25, 0x00, 0x26, 0x00, 0x27, 0x00,
+  0x27, 0x00, 0x27, 0x00, 0x28, 0x00, 0x28, 0x00, 0x28, 0x00, 0x28, 0x00,
+  0x29, 0x00, 0x2a, 0x00, 0x2a, 0x00, 0x2a, 0x00, 0x2a, 0x00, 0x2a, 0x00,
+  0x2a, 0x00, 0x2a, 0x00, 0x2c, 0x00, 0x2c, 0x00, 0x2c, 0x00, 0x2c, 0x00,
+  0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00,
+  0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2e, 0x00, 0x2e, 0x00,
+  0x2e, 0x00, 0x2e, 0x00, 0x2e, 0x00, 0x2e, 0x00, 0x2e, 0x00, 0x2f, 0x00,
+  0x2f, 0x00, 0x2f, 0x00, 0x2f, 0x00, 0x31, 0x00, 0x31, 0x00, 0x31, 0x00,
+  0x32, 0x00, 0x32, 0x00, 0x33, 0x00, 0x33, 0x00, 0x33, 0x00, 0x33, 0x00,
+  0x33, 0x00, 0x33, 0x00, 0x34, 0x00, 0x34, 0x00, 0x34, 0x00, 0x34, 0x00,
+  0x35, 0x00, 0x35, 0x00, 0x35, 0x00, 0x35, 0x00, 0x35, 0x00, 0x35, 0x00,
+  0x35, 0x00, 0x36, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00,
+  0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00,
+  0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00,
+  0x37, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00,
+  0x38, 0x00, 0x38, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x3a, 0x00,
+  0x3a, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x3b, 0x00,
+  0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00,
+  0x3b, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3d, 0x00, 0x3d, 0x00,
+  0x3d, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3e, 0x00,
+  0x3e, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x40, 0x00,
+  0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x41, 0x00, 0x41, 0x00,
+  0x41, 0x00, 0x41, 0x00, 0x42, 0x00, 0x42, 0x00, 0x42, 0x00, 0x42, 0x00,
+  0x42, 0x00, 0x43, 0x00, 0x43, 0x00, 0x44, 0x00, 0x44, 0x00, 0x44, 0x00,
+  0x44, 0x00, 0x44, 0x00, 0x44, 0x00, 0x44, 0x00, 0x44, 0x00, 0x44, 0x00,
+  0x44, 0x00, 0x44, 0x00, 0x44, 0x00, 0x44, 0x00, 0x44, 0x00, 0x44, 0x00,
+  0x44, 0x00, 0x44, 0x00, 0x45, 0x00, 0x45, 0x00, 0x45, 0x00, 0x45, 0x00,
+  0x45, 0x00, 0x45, 0x00, 0x45, 0x00, 0x45, 0x00, 0x45, 0x00, 0x46, 0x00,
+  0x46, 0x00, 0x46, 0x00, 0x46, 0x00, 0x46, 0x00, 0x46, 0x00, 0x46, 0x00,
+  0x46, 0x00, 0x46, 0x00, 0x46, 0x00, 0x46, 0x00, 0x46, 0x00, 0x48, 0x00,
+  0x48, 0x00, 0x48, 0x00, 0x48, 0x00, 0x48, 0x00, 0x48, 0x00, 0x48, 0x00,
+  0x48, 0x00, 0x48, 0x00, 0x48, 0x00, 0x48, 0x00, 0x48, 0x00, 0x48, 0x00,
+  0x48, 0x00, 0x48, 0x00, 0x48, 0x00, 0x48, 0x00, 0x48, 0x00, 0x48, 0x00,
+  0x48, 0x00, 0x48, 0x00, 0x4a, 0x00, 0x4a, 0x00, 0x4a, 0x00, 0x4b, 0x00,
+  0x4b, 0x00, 0x4b, 0x00, 0x4c, 0x00, 0x4c, 0x00, 0x4c, 0x00, 0x4c, 0x00,
+  0x4c, 0x00, 0x4c, 0x00, 0x4c, 0x00, 0x4c, 0x00, 0x4c, 0x00, 0x4c, 0x00,
+  0x4c, 0x00, 0x4c, 0x00, 0x4c, 0x00, 0x4c, 0x00, 0x4c, 0x00, 0x4c, 0x00,
+  0x4c, 0x00, 0x4c, 0x00, 0x4c, 0x00, 0x4c, 0x00, 0x4c, 0x00, 0x4c, 0x00,
+  0x4c, 0x00, 0x4d, 0x00, 0x4e, 0x00, 0x4f, 0x00, 0x50, 0x00, 0x50, 0x00,
+  0x50, 0x00, 0x50, 0x00, 0x50, 0x00, 0x50, 0x00, 0x50, 0x00, 0x50, 0x00,
+  0x50, 0x00, 0x50, 0x00, 0x51, 0x00, 0x51, 0x00, 0x51, 0x00, 0x52, 0x00,
+  0x52, 0x00, 0x52, 0x00, 0x53, 0x00, 0x53, 0x00, 0x54, 0x00, 0x54, 0x00,
+  0x54, 0x00, 0x54, 0x00, 0x54, 0x00, 0x54, 0x00, 0x54, 0x00, 0x54, 0x00,
+  0x54, 0x00, 0x54, 0x00, 0x54, 0x00, 0x54, 0x00, 0x56, 0x00, 0x56, 0x00,
+  0x56, 0x00, 0x56, 0x00, 0x57, 0x00, 0x57, 0x00, 0x57, 0x00, 0x57, 0x00,
+  0x57, 0x00, 0x57, 0x00, 0x57, 0x00, 0x57, 0x00, 0x57, 0x00, 0x57, 0x00,
+  0x57, 0x00, 0x57, 0x00, 0x57, 0x00, 0x58, 0x00, 0x58, 0x00, 0x58, 0x00,
+  0x58, 0x00, 0x59, 0x00, 0x59, 0x00, 0x59, 0x00, 0x59, 0x00, 0x59, 0x00,
+  0x59, 0x00, 0x59, 0x00, 0x59, 0x00, 0x59, 0x00, 0x59, 0x00, 0x59, 0x00,
+  0x59, 0x00, 0x5a, 0x00, 0x5b, 0x00, 0x5b, 0x00, 0x5b, 0x00, 0x5b, 0x00,
+  0x5b, 0x00, 0x5b, 0x00, 0x5b, 0x00, 0x5b, 0x00, 0x5b, 0x00, 0x5b, 0x00,
+  0x5b, 0x00, 0x5b, 0x00, 0x5b, 0x00, 0x5c, 0x00, 0x5d, 0x00, 0x5e, 0x00,
+  0x5f, 0x00, 0x5f, 0x00, 0x60, 0x00, 0x60, 0x00, 0x61, 0x00, 0x61, 0x00,
+  0x62, 0x00, 0x63, 0x00, 0x65, 0x00, 0x66, 0x00, 0x68, 0x00, 0x69, 0x00,
+  0x6a, 0x00, 0x6b, 0x00, 0x6b, 0x00, 0x6c, 0x00, 0x6c, 0x00, 0x6c, 0x00,
+  0x6c, 0x00, 0x6d, 0x00, 0x6d, 0x00, 0x6d, 0x00, 0x6d, 0x00, 0x6d, 0x00,
+  0x6d, 0x00, 0x6d, 0x00, 0x6d, 0x00, 0x6d, 0x00, 0x6d, 0x00, 0x6d, 0x00,
+  0x6f, 0x00, 0x6f, 0x00, 0x6f, 0x00, 0x6f, 0x00, 0x6f, 0x00, 0x6f, 0x00,
+  0x6f, 0x00, 0x6f, 0x00, 0x70, 0x00, 0x71, 0x00, 0x71, 0x00, 0x71, 0x00,
+  0x71, 0x00, 0x71, 0x00, 0x71, 0x00, 0x71, 0x00, 0x71, 0x00, 0x71, 0x00,
+  0x72, 0x00, 0x73, 0x00, 0x73, 0x00, 0x73, 0x00, 0x74, 0x00, 0x74, 0x00,
+  0x74, 0x00, 0x75, 0x00, 0x75, 0x00, 0x75, 0x00, 0x75, 0x00, 0x76, 0x00,
+  0x77, 0x00, 0x77, 0x00, 0x77, 0x00, 0x78, 0x00, 0x79, 0x00, 0x79, 0x00,
+  0x79, 0x00, 0x79, 0x00, 0x79, 0x00, 0x79, 0x00, 0x79, 0x00, 0x7a, 0x00,
+  0x7a, 0x00, 0x7a, 0x00, 0x7a, 0x00, 0x7b, 0x00, 0x7b, 0x00, 0x7b, 0x00,
+  0x7b, 0x00, 0x7b, 0x00, 0x7b, 0x00, 0x7b, 0x00, 0x7b, 0x00, 0x7b, 0x00,
+  0x7b, 0x00, 0x7b, 0x00, 0x7b, 0x00, 0x7c, 0x00, 0x7c, 0x00, 0x7c, 0x00,
+  0x7c, 0x00, 0x7c, 0x00, 0x7c, 0x00, 0x7c, 0x00, 0x7c, 0x00, 0x7d, 0x00,
+  0x7d, 0x00, 0x7d, 0x00, 0x7d, 0x00, 0x7d, 0x00, 0x7d, 0x00, 0x7d, 0x00,
+  0x7d, 0x00, 0x7e, 0x00, 0x7e, 0x00, 0x7e, 0x00, 0x7f, 0x00, 0x7f, 0x00,
+  0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x82, 0x00, 0x82, 0x00, 0x82, 0x00,
+  0x82, 0x00, 0x82, 0x00, 0x82, 0x00, 0x82, 0x00, 0x82, 0x00, 0x84, 0x00,
+  0x85, 0x00, 0x85, 0x00, 0x85, 0x00, 0x85, 0x00, 0x85, 0x00, 0x85, 0x00,
+  0x85, 0x00, 0x85, 0x00, 0x86, 0x00, 0x86, 0x00, 0x86, 0x00, 0x86, 0x00,
+  0x86, 0x00, 0x87, 0x00, 0x87, 0x00, 0x87, 0x00, 0x89, 0x00, 0x89, 0x00,
+  0x89, 0x00, 0x89, 0x00, 0x8c, 0x00, 0x8c, 0x00, 0x8d, 0x00, 0x8d, 0x00,
+  0x8d, 0x00, 0x8d, 0x00, 0x8e, 0x00, 0x8e, 0x00, 0x8e, 0x00, 0x8e, 0x00,
+  0x8e, 0x00, 0x8e, 0x00, 0x8e, 0x00, 0x8e, 0x00, 0x8e, 0x00, 0x8e, 0x00,
+  0x8e, 0x00, 0x8e, 0x00, 0x8e, 0x00, 0x8e, 0x00, 0x8e, 0x00, 0x8e, 0x00,
+  0x8f, 0x00, 0x8f, 0x00, 0x90, 0x00, 0x90, 0x00, 0x90, 0x00, 0x90, 0x00,
+  0x90, 0x00, 0x90, 0x00, 0x91, 0x00, 0x91, 0x00, 0x91, 0x00, 0x91, 0x00,
+  0x91, 0x00, 0x91, 0x00, 0x91, 0x00, 0x91, 0x00, 0x91, 0x00, 0x91, 0x00,
+  0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00,
+  0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00,
+  0x92, 0x00, 0x93, 0x00, 0x93, 0x00, 0x93, 0x00, 0x93, 0x00, 0x93, 0x00,
+  0x93, 0x00, 0x93, 0x00, 0x93, 0x00, 0x93, 0x00, 0x93, 0x00, 0x94, 0x00,
+  0x94, 0x00, 0x94, 0x00, 0x94, 0x00, 0x94, 0x00, 0x94, 0x00, 0x94, 0x00,
+  0x94, 0x00, 0x94, 0x00, 0x94, 0x00, 0x94, 0x00, 0x94, 0x00, 0x94, 0x00,
+  0x95, 0x00, 0x96, 0x00, 0x96, 0x00, 0x96, 0x00, 0x96, 0x00, 0x96, 0x00,
+  0x96, 0x00, 0x96, 0x00, 0x96, 0x00, 0x96, 0x00, 0x96, 0x00, 0x96, 0x00,
+  0x96, 0x00, 0x96, 0x00, 0x97, 0x00, 0x97, 0x00, 0x97, 0x00, 0x97, 0x00,
+  0x97, 0x00, 0x97, 0x00, 0x97, 0x00, 0x97, 0x00, 0x97, 0x00, 0x97, 0x00,
+  0x97, 0x00, 0x97, 0x00, 0x97, 0x00, 0x97, 0x00, 0x97, 0x00, 0x97, 0x00,
+  0x97, 0x00, 0x97, 0x00, 0x97, 0x00, 0x97, 0x00, 0x97, 0x00, 0x97, 0x00,
+  0x97, 0x00, 0x97, 0x00, 0x97, 0x00, 0x97, 0x00, 0x97, 0x00, 0x97, 0x00,
+  0x98, 0x00, 0x9a, 0x00, 0x9b, 0x00, 0x9b, 0x00, 0x9b, 0x00, 0x9b, 0x00,
+  0x9c, 0x00, 0x9c, 0x00, 0x9c, 0x00, 0x9c, 0x00, 0x9c, 0x00, 0x9c, 0x00,
+  0x9c, 0x00, 0x9c, 0x00, 0x9c, 0x00, 0x9c, 0x00, 0x9c, 0x00, 0x9c, 0x00,
+  0x9c, 0x00, 0x9c, 0x00, 0x9c, 0x00, 0x9c, 0x00, 0x9c, 0x00, 0x9c, 0x00,
+  0x9c, 0x00, 0x9c, 0x00, 0x9c, 0x00, 0x9c, 0x00, 0x9c, 0x00, 0x9d, 0x00,
+  0x9e, 0x00, 0x9e, 0x00, 0x9e, 0x00, 0x9e, 0x00, 0x9e, 0x00, 0x9e, 0x00,
+  0x9e, 0x00, 0x9e, 0x00, 0x9e, 0x00, 0x9e, 0x00, 0x9e, 0x00, 0x9e, 0x00,
+  0x9e, 0x00, 0x9e, 0x00, 0x9e, 0x00, 0x9f, 0x00, 0x9f, 0x00, 0x9f, 0x00,
+  0x9f, 0x00, 0x9f, 0x00, 0x9f, 0x00, 0x9f, 0x00, 0x9f, 0x00, 0x9f, 0x00,
+  0x9f, 0x00, 0x9f, 0x00, 0x9f, 0x00, 0x9f, 0x00, 0x9f, 0x00, 0x9f, 0x00,
+  0x9f, 0x00, 0x9f, 0x00, 0x9f, 0x00, 0x9f, 0x00, 0x9f, 0x00, 0x9f, 0x00,
+  0x9f, 0x00, 0xa1, 0x00, 0xa1, 0x00, 0xa1, 0x00, 0xa1, 0x00, 0xa1, 0x00,
+  0xa1, 0x00, 0xa2, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00,
+  0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00,
+  0xa4, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xa5, 0x00,
+  0xa5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xa6, 0x00, 0xa6, 0x00, 0xa6, 0x00,
+  0xa6, 0x00, 0xa6, 0x00, 0xa6, 0x00, 0xa6, 0x00, 0xa6, 0x00, 0xa6, 0x00,
+  0xa6, 0x00, 0xa6, 0x00, 0xa6, 0x00, 0xa6, 0x00, 0xa6, 0x00, 0xa7, 0x00,
+  0xa7, 0x00, 0xa7, 0x00, 0xa7, 0x00, 0xa7, 0x00, 0xa7, 0x00, 0xa8, 0x00,
+  0xa8, 0x00, 0xa8, 0x00, 0xab, 0x00, 0xac, 0x00, 0xac, 0x00, 0xac, 0x00,
+  0xac, 0x00, 0xac, 0x00, 0xac, 0x00, 0xac, 0x00, 0xac, 0x00, 0xad, 0x00,
+  0xad, 0x00, 0xad, 0x00, 0xad, 0x00, 0xad, 0x00, 0xad, 0x00, 0xad, 0x00,
+  0xad, 0x00, 0xad, 0x00, 0xad, 0x00, 0xad, 0x00, 0xad, 0x00, 0xad, 0x00,
+  0xad, 0x00, 0xae, 0x00, 0xae, 0x00, 0xae, 0x00, 0xae, 0x00, 0xaf, 0x00,
+  0xb0, 0x00, 0xb0, 0x00, 0xb0, 0x00, 0xb1, 0x00, 0xb2, 0x00, 0xb3, 0x00,
+  0xb4, 0x00, 0xb5, 0x00, 0xb6, 0x00, 0xb7, 0x00, 0xb8, 0x00, 0xb8, 0x00,
+  0xb8, 0x00, 0xb9, 0x00, 0xba, 0x00, 0xbb, 0x00, 0xbd, 0x00, 0xbe, 0x00,
+  0xbe, 0x00, 0xbe, 0x00, 0xbe, 0x00, 0xbe, 0x00, 0xbe, 0x00, 0xbe, 0x00,
+  0xbe, 0x00, 0xbe, 0x00, 0xbf, 0x00, 0xbf, 0x00, 0xbf, 0x00, 0xbf, 0x00,
+  0xbf, 0x00, 0xbf, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00,
+  0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc2, 0x00, 0xc2, 0x00,
+  0xc2, 0x00, 0xc2, 0x00, 0xc3, 0x00, 0xc3, 0x00, 0xc5, 0x00, 0xc5, 0x00,
+  0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00,
+  0xc6, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0xc6, 0x00,
+  0xc7, 0x00, 0xc7, 0x00, 0xc7, 0x00, 0xc8, 0x00, 0xc8, 0x00, 0xc8, 0x00,
+  0xc8, 0x00, 0xc8, 0x00, 0xc8, 0x00, 0xc8, 0x00, 0xc8, 0x00, 0xc8, 0x00,
+  0xc8, 0x00, 0xc8, 0x00, 0xc8, 0x00, 0xc8, 0x00, 0xc8, 0x00, 0xc8, 0x00,
+  0xc8, 0x00, 0xc8, 0x00, 0xc9, 0x00, 0xc9, 0x00, 0xc9, 0x00, 0xc9, 0x00,
+  0xc9, 0x00, 0xc9, 0x00, 0xc9, 0x00, 0xc9, 0x00, 0xc9, 0x00, 0xc9, 0x00,
+  0xc9, 0x00, 0xc9, 0x00, 0xc9, 0x00, 0xc9, 0x00, 0xca, 0x00, 0xca, 0x00,
+  0xca, 0x00, 0xca, 0x00, 0xca, 0x00, 0xca, 0x00, 0xca, 0x00, 0xca, 0x00,
+  0xca, 0x00, 0xca, 0x00, 0xca, 0x00, 0xca, 0x00, 0xca, 0x00, 0xca, 0x00,
+  0xcb, 0x00, 0xcb, 0x00, 0xcb, 0x00, 0xcb, 0x00, 0xcb, 0x00, 0xcb, 0x00,
+  0xcb, 0x00, 0xcb, 0x00, 0xcb, 0x00, 0xcb, 0x00, 0xcb, 0x00, 0xcb, 0x00,
+  0xcb, 0x00, 0xcc, 0x00, 0xcc, 0x00, 0xcc, 0x00, 0xcc, 0x00, 0xcc, 0x00,
+  0xcc, 0x00, 0xcd, 0x00, 0xcd, 0x00, 0xcd, 0x00, 0xcd, 0x00, 0xcd, 0x00,
+  0xcd, 0x00, 0xcd, 0x00, 0xcd, 0x00, 0xce, 0x00, 0xce, 0x00, 0xce, 0x00,
+  0xce, 0x00, 0xce, 0x00, 0xce, 0x00, 0xce, 0x00, 0xce, 0x00, 0xce, 0x00,
+  0xce, 0x00, 0xce, 0x00, 0xce, 0x00, 0xcf, 0x00, 0xcf, 0x00, 0xcf, 0x00,
+  0xcf, 0x00, 0xcf, 0x00, 0xcf, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00,
+  0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00,
+  0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00,
+  0xd0, 0x00, 0xd1, 0x00, 0xd1, 0x00, 0xd1, 0x00, 0xd1, 0x00, 0xd1, 0x00,
+  0xd1, 0x00, 0xd1, 0x00, 0xd1, 0x00, 0xd1, 0x00, 0xd2, 0x00, 0xd2, 0x00,
+  0xd2, 0x00, 0xd2, 0x00, 0xd2, 0x00, 0xd2, 0x00, 0xd2, 0x00, 0xd2, 0x00,
+  0xd2, 0x00, 0xd2, 0x00, 0xd2, 0x00, 0xd3, 0x00, 0xd4, 0x00, 0xd4, 0x00,
+  0xd4, 0x00, 0xd4, 0x00, 0xd5, 0x00, 0xd5, 0x00, 0xd5, 0x00, 0xd5, 0x00,
+  0xd5, 0x00, 0xd5, 0x00, 0xd5, 0x00, 0xd5, 0x00, 0xd5, 0x00, 0xd5, 0x00,
+  0xd5, 0x00, 0xd5, 0x00, 0xd5, 0x00, 0xd5, 0x00, 0xd5, 0x00, 0xd5, 0x00,
+  0xd7, 0x00, 0xd7, 0x00, 0xd7, 0x00, 0xd7, 0x00, 0xd7, 0x00, 0xd7, 0x00,
+  0xd7, 0x00, 0x00, 0x00, 0xae, 0x17, 0x17, 0xdc, 0xef, 0x4d, 0xc5, 0xbb,
+  0x67, 0x06, 0x3d, 0x3d, 0x94, 0x42, 0x6e, 0xc4, 0xc4, 0x7b, 0x91, 0xa9,
+  0xf1, 0x35, 0xe3, 0x99, 0x30, 0xa3, 0x85, 0xcc, 0xf3, 0x2a, 0x40, 0xf2,
+  0x4c, 0xe3, 0x9a, 0xd1, 0x31, 0x0b, 0xd1, 0xa1, 0xff, 0x99, 0xd2, 0xd2,
+  0x4b, 0x86, 0xe0, 0xea, 0xac, 0x15, 0x6f, 0x73, 0xcf, 0x9e, 0xf6, 0xc1,
+  0x76, 0x6d, 0x0d, 0xbe, 0xf2, 0xfa, 0xb6, 0x6e, 0x8b, 0x02, 0x99, 0xff,
+  0x56, 0x1c, 0x16, 0x34, 0x9f, 0x9f, 0x2b, 0x48, 0xc4, 0x14, 0x26, 0xd2,
+  0x96, 0x52, 0xbd, 0xc6, 0x3f, 0x22, 0xa5, 0xf9, 0xbc, 0x6c, 0x33, 0xc7,
+  0x54, 0xf9, 0x12, 0x1d, 0xec, 0xe0, 0x7a, 0x8f, 0x97, 0x19, 0x0e, 0x29,
+  0xbb, 0xd5, 0x57, 0xf7, 0xf9, 0x76, 0x76, 0x1b, 0x15, 0x07, 0xbd, 0xc5,
+  0xd1, 0xe1, 0x2f, 0x35, 0x10, 0xa6, 0x8a, 0xb1, 0xf0, 0x5e, 0x3d, 0x42,
+  0x08, 0x08, 0x00, 0xb7, 0x2f, 0x2b, 0xd2, 0xc4, 0xdf, 0x2a, 0xaa, 0x08,
+  0x71, 0xf9, 0x81, 0xa1, 0x3a, 0x6d, 0x09, 0xd5, 0xb4, 0xcd, 0xf6, 0x0e,
+  0x83, 0x43, 0xbb, 0x39, 0xac, 0xa0, 0x8e, 0x5b, 0x1a, 0x96, 0x50, 0xb2,
+  0x73, 0x93, 0x1e, 0x7d, 0xae, 0x01, 0x62, 0x84, 0xff, 0x5a, 0x6e, 0xa7,
+  0x12, 0xa1, 0xfe, 0x8a, 0x74, 0xe7, 0x31, 0xc0, 0x83, 0x17, 0xfb, 0x66,
+  0x66, 0x81, 0xf9, 0xa5, 0x87, 0x9c, 0xce, 0xbf, 0xbf, 0xfb, 0x99, 0x8f,
+  0x03, 0x22, 0x4e, 0x34, 0x91, 0x00, 0x9e, 0x71, 0xba, 0xc5, 0x3c, 0xba,
+  0x31, 0x9b, 0xeb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x0a, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x0e, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x08, 0x00
+};
@@ -1,5 +1,7 @@
 #pragma once
-const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
+#include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/lfn_dict_index.h>
+const unsigned char __espeakng_dict_lfn[] __attribute__((aligned((4)))) = {
   0x00, 0x04, 0x00, 0x00, 0x30, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x04, 0xc1, 0x04, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x06, 0x41, 0x08,
   0x48, 0x24, 0x00, 0x00, 0x00, 0x06, 0xc3, 0x15, 0x40, 0xc0, 0x0d, 0x00,
@@ -234,4 +236,11 @@ const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
   0x00, 0xc3, 0xad, 0x03, 0x07, 0x25, 0x00, 0xc3, 0xb3, 0x03, 0x07, 0x27,
   0x00, 0xc3, 0xba, 0x03, 0x07, 0x28, 0x00, 0x07, 0x00
 };
-size_t __espeakng_dictlen = 2793;
+
+BackgroundAudioDictionary dict_lfn = {
+    "lfn",
+    2793,
+    __espeakng_dict_lfn,
+    2450,
+    __espeakng_dictindex_lfn
+};
@@ -1,5 +1,7 @@
 #pragma once
-const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
+#include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/lt_dict_index.h>
+const unsigned char __espeakng_dict_lt[] __attribute__((aligned((4)))) = {
   0x00, 0x04, 0x00, 0x00, 0x62, 0xba, 0x00, 0x00, 0x00, 0x48, 0x19, 0xf0,
   0x9f, 0x91, 0xa9, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xe2, 0x80,
   0x8d, 0xf0, 0x9f, 0x91, 0xa7, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa7,
@@ -4159,4 +4161,11 @@ const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
   0x31, 0x26, 0x25, 0x5a, 0x00, 0x21, 0x3d, 0x03, 0x88, 0x24, 0x89, 0x06,
   0x73, 0x52, 0x28, 0x00, 0x07, 0x00
 };
-size_t __espeakng_dictlen = 49890;
+
+BackgroundAudioDictionary dict_lt = {
+    "lt",
+    49890,
+    __espeakng_dict_lt,
+    7486,
+    __espeakng_dictindex_lt
+};
@@ -1,5 +1,7 @@
 #pragma once
-const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
+#include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/lv_dict_index.h>
+const unsigned char __espeakng_dict_lv[] __attribute__((aligned((4)))) = {
   0x00, 0x04, 0x00, 0x00, 0x60, 0xd0, 0x00, 0x00, 0x09, 0xc6, 0x4c, 0xf5,
   0x85, 0x28, 0x12, 0x53, 0x4c, 0x00, 0x4c, 0x19, 0xf0, 0x9f, 0x91, 0xa9,
   0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xe2, 0x80, 0x8d, 0xf0, 0x9f,
@@ -5530,4 +5532,11 @@ const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
   0x5a, 0x00, 0x24, 0x03, 0x49, 0x27, 0x37, 0x6d, 0x22, 0x5a, 0x00, 0x07,
   0x00
 };
-size_t __espeakng_dictlen = 66337;
+
+BackgroundAudioDictionary dict_lv = {
+    "lv",
+    66337,
+    __espeakng_dict_lv,
+    9646,
+    __espeakng_dictindex_lv
+};
@@ -0,0 +1,807 @@
+#pragma once
+const unsigned char __espeakng_dictindex_lv[] __attribute__((aligned((4)))) = {
+  0x45, 0x44, 0x58, 0x31, 0x21, 0x03, 0x01, 0x00, 0x60, 0xd0, 0x00, 0x00,
+  0xde, 0x09, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x0a, 0x00,
+  0x0a, 0x00, 0x0a, 0x00, 0x0e, 0x00, 0x10, 0x00, 0x11, 0x00, 0x11, 0x00,
+  0x12, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x16, 0x00, 0x16, 0x00,
+  0x17, 0x00, 0x18, 0x00, 0x1a, 0x00, 0x1a, 0x00, 0x20, 0x00, 0x22, 0x00,
+  0x23, 0x00, 0x23, 0x00, 0x24, 0x00, 0x24, 0x00, 0x25, 0x00, 0x25, 0x00,
+  0x26, 0x00, 0x27, 0x00, 0x2a, 0x00, 0x2c, 0x00, 0x2c, 0x00, 0x2c, 0x00,
+  0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2e, 0x00, 0x33, 0x00, 0x34, 0x00,
+  0x36, 0x00, 0x36, 0x00, 0x38, 0x00, 0x38, 0x00, 0x3a, 0x00, 0x3f, 0x00,
+  0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x41, 0x00, 0x44, 0x00, 0x46, 0x00,
+  0x48, 0x00, 0x48, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x4a, 0x00,
+  0x4b, 0x00, 0x4c, 0x00, 0x4d, 0x00, 0x4e, 0x00, 0x4f, 0x00, 0x50, 0x00,
+  0x51, 0x00, 0x51, 0x00, 0x53, 0x00, 0x53, 0x00, 0x53, 0x00, 0x54, 0x00,
+  0x56, 0x00, 0x57, 0x00, 0x59, 0x00, 0x5a, 0x00, 0x5b, 0x00, 0x64, 0x00,
+  0x64, 0x00, 0x6c, 0x00, 0x6d, 0x00, 0x6e, 0x00, 0x6e, 0x00, 0x86, 0x00,
+  0x88, 0x00, 0x8b, 0x00, 0x8c, 0x00, 0x8e, 0x00, 0x8f, 0x00, 0x8f, 0x00,
+  0x8f, 0x00, 0x90, 0x00, 0x93, 0x00, 0x9b, 0x00, 0x9d, 0x00, 0xa6, 0x00,
+  0xaa, 0x00, 0xab, 0x00, 0xad, 0x00, 0xae, 0x00, 0xb1, 0x00, 0xb3, 0x00,
+  0xb4, 0x00, 0xb4, 0x00, 0xb6, 0x00, 0xb6, 0x00, 0xba, 0x00, 0xbb, 0x00,
+  0xbe, 0x00, 0xc9, 0x00, 0xcd, 0x00, 0xd5, 0x00, 0xd9, 0x00, 0xdb, 0x00,
+  0xdf, 0x00, 0xe1, 0x00, 0xe2, 0x00, 0xe5, 0x00, 0xe6, 0x00, 0xe9, 0x00,
+  0xeb, 0x00, 0xed, 0x00, 0xf2, 0x00, 0xf4, 0x00, 0xf6, 0x00, 0xfb, 0x00,
+  0xff, 0x00, 0x05, 0x01, 0x07, 0x01, 0x0b, 0x01, 0x0e, 0x01, 0x0f, 0x01,
+  0x10, 0x01, 0x15, 0x01, 0x16, 0x01, 0x16, 0x01, 0x16, 0x01, 0x16, 0x01,
+  0x16, 0x01, 0x18, 0x01, 0x19, 0x01, 0x1c, 0x01, 0x20, 0x01, 0x23, 0x01,
+  0x28, 0x01, 0x29, 0x01, 0x2c, 0x01, 0x2e, 0x01, 0x2f, 0x01, 0x2f, 0x01,
+  0x33, 0x01, 0x37, 0x01, 0x39, 0x01, 0x3c, 0x01, 0x41, 0x01, 0x44, 0x01,
+  0x46, 0x01, 0x4b, 0x01, 0x4d, 0x01, 0x52, 0x01, 0x53, 0x01, 0x57, 0x01,
+  0x5a, 0x01, 0x5b, 0x01, 0x5d, 0x01, 0x62, 0x01, 0x66, 0x01, 0x67, 0x01,
+  0x68, 0x01, 0x69, 0x01, 0x6a, 0x01, 0x6d, 0x01, 0x6e, 0x01, 0x6f, 0x01,
+  0x71, 0x01, 0x72, 0x01, 0x72, 0x01, 0x74, 0x01, 0x74, 0x01, 0x77, 0x01,
+  0x79, 0x01, 0x7a, 0x01, 0x7c, 0x01, 0x7e, 0x01, 0x80, 0x01, 0x82, 0x01,
+  0x83, 0x01, 0x83, 0x01, 0x84, 0x01, 0x84, 0x01, 0x84, 0x01, 0x84, 0x01,
+  0x84, 0x01, 0x84, 0x01, 0x86, 0x01, 0x87, 0x01, 0x87, 0x01, 0x87, 0x01,
+  0x87, 0x01, 0x87, 0x01, 0x87, 0x01, 0x87, 0x01, 0x87, 0x01, 0x87, 0x01,
+  0x87, 0x01, 0x87, 0x01, 0x89, 0x01, 0x89, 0x01, 0x89, 0x01, 0x89, 0x01,
+  0x8a, 0x01, 0x8a, 0x01, 0x8b, 0x01, 0x8c, 0x01, 0x8d, 0x01, 0x8e, 0x01,
+  0x8e, 0x01, 0x8e, 0x01, 0x94, 0x01, 0x95, 0x01, 0x97, 0x01, 0x98, 0x01,
+  0x99, 0x01, 0x99, 0x01, 0x99, 0x01, 0x9a, 0x01, 0xa0, 0x01, 0xa0, 0x01,
+  0xa0, 0x01, 0xa1, 0x01, 0xa2, 0x01, 0xa4, 0x01, 0xa4, 0x01, 0xa4, 0x01,
+  0xa7, 0x01, 0xa8, 0x01, 0xa8, 0x01, 0xa8, 0x01, 0xa9, 0x01, 0xa9, 0x01,
+  0xa9, 0x01, 0xaa, 0x01, 0xab, 0x01, 0xad, 0x01, 0xae, 0x01, 0xaf, 0x01,
+  0xb2, 0x01, 0xb3, 0x01, 0xb5, 0x01, 0xb6, 0x01, 0xb6, 0x01, 0xb6, 0x01,
+  0xb7, 0x01, 0xb7, 0x01, 0xb7, 0x01, 0xb7, 0x01, 0xb7, 0x01, 0xb7, 0x01,
+  0xb8, 0x01, 0xb9, 0x01, 0xb9, 0x01, 0xba, 0x01, 0xbc, 0x01, 0xbd, 0x01,
+  0xc2, 0x01, 0xc4, 0x01, 0xc4, 0x01, 0xc5, 0x01, 0xc5, 0x01, 0xc5, 0x01,
+  0xc5, 0x01, 0xc7, 0x01, 0xc7, 0x01, 0xc8, 0x01, 0xc9, 0x01, 0xc9, 0x01,
+  0xca, 0x01, 0xca, 0x01, 0xca, 0x01, 0xce, 0x01, 0xcf, 0x01, 0xd1, 0x01,
+  0xd3, 0x01, 0xd3, 0x01, 0xd3, 0x01, 0xd4, 0x01, 0xd4, 0x01, 0xd4, 0x01,
+  0xd4, 0x01, 0xd4, 0x01, 0xd4, 0x01, 0xd5, 0x01, 0xd5, 0x01, 0xd5, 0x01,
+  0xd5, 0x01, 0xd8, 0x01, 0xd9, 0x01, 0xdd, 0x01, 0xde, 0x01, 0xdf, 0x01,
+  0xdf, 0x01, 0xe0, 0x01, 0xe2, 0x01, 0xe2, 0x01, 0xe3, 0x01, 0xe3, 0x01,
+  0xe6, 0x01, 0xe6, 0x01, 0xe6, 0x01, 0xe9, 0x01, 0xe9, 0x01, 0xed, 0x01,
+  0xed, 0x01, 0xee, 0x01, 0xee, 0x01, 0xef, 0x01, 0xf0, 0x01, 0xf0, 0x01,
+  0xf1, 0x01, 0xf1, 0x01, 0xf3, 0x01, 0xf7, 0x01, 0xf8, 0x01, 0xfa, 0x01,
+  0xfb, 0x01, 0xfb, 0x01, 0xfc, 0x01, 0xfc, 0x01, 0xfc, 0x01, 0x00, 0x02,
+  0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x01, 0x02, 0x02, 0x02,
+  0x02, 0x02, 0x03, 0x02, 0x04, 0x02, 0x05, 0x02, 0x05, 0x02, 0x05, 0x02,
+  0x07, 0x02, 0x09, 0x02, 0x0a, 0x02, 0x0e, 0x02, 0x11, 0x02, 0x11, 0x02,
+  0x12, 0x02, 0x12, 0x02, 0x12, 0x02, 0x13, 0x02, 0x14, 0x02, 0x15, 0x02,
+  0x15, 0x02, 0x15, 0x02, 0x15, 0x02, 0x15, 0x02, 0x17, 0x02, 0x18, 0x02,
+  0x19, 0x02, 0x1a, 0x02, 0x1b, 0x02, 0x20, 0x02, 0x21, 0x02, 0x22, 0x02,
+  0x27, 0x02, 0x28, 0x02, 0x29, 0x02, 0x2a, 0x02, 0x2d, 0x02, 0x30, 0x02,
+  0x32, 0x02, 0x35, 0x02, 0x37, 0x02, 0x38, 0x02, 0x39, 0x02, 0x3b, 0x02,
+  0x3c, 0x02, 0x3d, 0x02, 0x3e, 0x02, 0x40, 0x02, 0x41, 0x02, 0x45, 0x02,
+  0x45, 0x02, 0x46, 0x02, 0x46, 0x02, 0x47, 0x02, 0x48, 0x02, 0x48, 0x02,
+  0x4a, 0x02, 0x4c, 0x02, 0x4f, 0x02, 0x51, 0x02, 0x51, 0x02, 0x51, 0x02,
+  0x51, 0x02, 0x52, 0x02, 0x53, 0x02, 0x53, 0x02, 0x55, 0x02, 0x55, 0x02,
+  0x55, 0x02, 0x55, 0x02, 0x56, 0x02, 0x56, 0x02, 0x5a, 0x02, 0x5d, 0x02,
+  0x5d, 0x02, 0x5e, 0x02, 0x5e, 0x02, 0x5f, 0x02, 0x5f, 0x02, 0x63, 0x02,
+  0x65, 0x02, 0x68, 0x02, 0x6a, 0x02, 0x6d, 0x02, 0x6f, 0x02, 0x74, 0x02,
+  0x76, 0x02, 0x78, 0x02, 0x7a, 0x02, 0x84, 0x02, 0x85, 0x02, 0x8a, 0x02,
+  0x8a, 0x02, 0x8b, 0x02, 0x8f, 0x02, 0x90, 0x02, 0x91, 0x02, 0x92, 0x02,
+  0x92, 0x02, 0x92, 0x02, 0x93, 0x02, 0x94, 0x02, 0x99, 0x02, 0x9a, 0x02,
+  0x9b, 0x02, 0x9c, 0x02, 0x9c, 0x02, 0x9c, 0x02, 0x9c, 0x02, 0x9d, 0x02,
+  0xa0, 0x02, 0xa0, 0x02, 0xa1, 0x02, 0xa3, 0x02, 0xa3, 0x02, 0xa3, 0x02,
+  0xa3, 0x02, 0xa3, 0x02, 0xa3, 0x02, 0xa5, 0x02, 0xa8, 0x02, 0xaa, 0x02,
+  0xab, 0x02, 0xae, 0x02, 0xae, 0x02, 0xae, 0x02, 0xb2, 0x02, 0xb3, 0x02,
+  0xb4, 0x02, 0xba, 0x02, 0xbb, 0x02, 0xbb, 0x02, 0xbc, 0x02, 0xbc, 0x02,
+  0xc0, 0x02, 0xc1, 0x02, 0xc3, 0x02, 0xc6, 0x02, 0xc6, 0x02, 0xc7, 0x02,
+  0xc7, 0x02, 0xc7, 0x02, 0xca, 0x02, 0xca, 0x02, 0xcb, 0x02, 0xce, 0x02,
+  0xce, 0x02, 0xce, 0x02, 0xcf, 0x02, 0xcf, 0x02, 0xd0, 0x02, 0xd0, 0x02,
+  0xd3, 0x02, 0xd6, 0x02, 0xd8, 0x02, 0xdb, 0x02, 0xde, 0x02, 0xe1, 0x02,
+  0xe7, 0x02, 0xea, 0x02, 0xec, 0x02, 0xf0, 0x02, 0xf0, 0x02, 0xf3, 0x02,
+  0xf4, 0x02, 0xf7, 0x02, 0xfa, 0x02, 0xfc, 0x02, 0xfc, 0x02, 0xff, 0x02,
+  0x00, 0x03, 0x02, 0x03, 0x03, 0x03, 0x04, 0x03, 0x04, 0x03, 0x07, 0x03,
+  0x0b, 0x03, 0x0e, 0x03, 0x10, 0x03, 0x11, 0x03, 0x12, 0x03, 0x13, 0x03,
+  0x18, 0x03, 0x1a, 0x03, 0x1b, 0x03, 0x1c, 0x03, 0x1c, 0x03, 0x1e, 0x03,
+  0x20, 0x03, 0x21, 0x03, 0x27, 0x03, 0x29, 0x03, 0x2a, 0x03, 0x2b, 0x03,
+  0x2f, 0x03, 0x32, 0x03, 0x35, 0x03, 0x38, 0x03, 0x3b, 0x03, 0x3c, 0x03,
+  0x3e, 0x03, 0x41, 0x03, 0x43, 0x03, 0x44, 0x03, 0x45, 0x03, 0x47, 0x03,
+  0x4a, 0x03, 0x4f, 0x03, 0x51, 0x03, 0x55, 0x03, 0x59, 0x03, 0x5a, 0x03,
+  0x5c, 0x03, 0x63, 0x03, 0x6a, 0x03, 0x6d, 0x03, 0x71, 0x03, 0x71, 0x03,
+  0x72, 0x03, 0x72, 0x03, 0x73, 0x03, 0x73, 0x03, 0x73, 0x03, 0x73, 0x03,
+  0x75, 0x03, 0x75, 0x03, 0x77, 0x03, 0x77, 0x03, 0x78, 0x03, 0x78, 0x03,
+  0x79, 0x03, 0x7c, 0x03, 0x7d, 0x03, 0x7f, 0x03, 0x7f, 0x03, 0x7f, 0x03,
+  0x7f, 0x03, 0x81, 0x03, 0x82, 0x03, 0x83, 0x03, 0x85, 0x03, 0x86, 0x03,
+  0x87, 0x03, 0x88, 0x03, 0x8a, 0x03, 0x8a, 0x03, 0x8a, 0x03, 0x8a, 0x03,
+  0x8c, 0x03, 0x8e, 0x03, 0x8e, 0x03, 0x8f, 0x03, 0x8f, 0x03, 0x8f, 0x03,
+  0x90, 0x03, 0x91, 0x03, 0x91, 0x03, 0x91, 0x03, 0x91, 0x03, 0x91, 0x03,
+  0x91, 0x03, 0x92, 0x03, 0x93, 0x03, 0x94, 0x03, 0x94, 0x03, 0x95, 0x03,
+  0x96, 0x03, 0x99, 0x03, 0x9b, 0x03, 0x9b, 0x03, 0x9c, 0x03, 0x9c, 0x03,
+  0x9d, 0x03, 0x9d, 0x03, 0x9e, 0x03, 0x9f, 0x03, 0xa0, 0x03, 0xa2, 0x03,
+  0xa2, 0x03, 0xa3, 0x03, 0xa3, 0x03, 0xa3, 0x03, 0xa4, 0x03, 0xa5, 0x03,
+  0xa5, 0x03, 0xa5, 0x03, 0xa7, 0x03, 0xa7, 0x03, 0xa7, 0x03, 0xa8, 0x03,
+  0xad, 0x03, 0xad, 0x03, 0xae, 0x03, 0xb1, 0x03, 0xb2, 0x03, 0xb2, 0x03,
+  0xb3, 0x03, 0xb5, 0x03, 0xb5, 0x03, 0xb5, 0x03, 0xb6, 0x03, 0xb6, 0x03,
+  0xb8, 0x03, 0xb8, 0x03, 0xb9, 0x03, 0xba, 0x03, 0xbb, 0x03, 0xbd, 0x03,
+  0xbf, 0x03, 0xc0, 0x03, 0xc1, 0x03, 0xc1, 0x03, 0xc1, 0x03, 0xc3, 0x03,
+  0xc4, 0x03, 0xc4, 0x03, 0xc6, 0x03, 0xc7, 0x03, 0xc9, 0x03, 0xcb, 0x03,
+  0xcc, 0x03, 0xcc, 0x03, 0xcd, 0x03, 0xcd, 0x03, 0xce, 0x03, 0xcf, 0x03,
+  0xcf, 0x03, 0xd0, 0x03, 0xd0, 0x03, 0xd1, 0x03, 0xd7, 0x03, 0xd9, 0x03,
+  0xda, 0x03, 0xdd, 0x03, 0xe0, 0x03, 0xe2, 0x03, 0xe2, 0x03, 0xe7, 0x03,
+  0xe8, 0x03, 0xec, 0x03, 0xef, 0x03, 0xf0, 0x03, 0xf2, 0x03, 0xf3, 0x03,
+  0xf5, 0x03, 0xf9, 0x03, 0xfc, 0x03, 0xfe, 0x03, 0x00, 0x04, 0x04, 0x04,
+  0x07, 0x04, 0x0a, 0x04, 0x0d, 0x04, 0x10, 0x04, 0x11, 0x04, 0x12, 0x04,
+  0x13, 0x04, 0x14, 0x04, 0x16, 0x04, 0x18, 0x04, 0x1b, 0x04, 0x21, 0x04,
+  0x28, 0x04, 0x2d, 0x04, 0x33, 0x04, 0x38, 0x04, 0x3d, 0x04, 0x47, 0x04,
+  0x4d, 0x04, 0x50, 0x04, 0x54, 0x04, 0x57, 0x04, 0x5a, 0x04, 0x5d, 0x04,
+  0x63, 0x04, 0x68, 0x04, 0x6b, 0x04, 0x70, 0x04, 0x76, 0x04, 0x7c, 0x04,
+  0x83, 0x04, 0x8a, 0x04, 0x91, 0x04, 0x97, 0x04, 0x9d, 0x04, 0xa5, 0x04,
+  0xab, 0x04, 0xb1, 0x04, 0xb8, 0x04, 0xbd, 0x04, 0xc4, 0x04, 0xc9, 0x04,
+  0xcf, 0x04, 0xd8, 0x04, 0xe0, 0x04, 0xef, 0x04, 0xf8, 0x04, 0x07, 0x05,
+  0x14, 0x05, 0x20, 0x05, 0x29, 0x05, 0x34, 0x05, 0x3c, 0x05, 0x42, 0x05,
+  0x49, 0x05, 0x50, 0x05, 0x57, 0x05, 0x5d, 0x05, 0x63, 0x05, 0x6c, 0x05,
+  0x74, 0x05, 0x7b, 0x05, 0x83, 0x05, 0x8b, 0x05, 0x92, 0x05, 0x9a, 0x05,
+  0xa2, 0x05, 0xa9, 0x05, 0xb2, 0x05, 0xba, 0x05, 0xc1, 0x05, 0xc8, 0x05,
+  0xd2, 0x05, 0xda, 0x05, 0xe2, 0x05, 0xea, 0x05, 0xf0, 0x05, 0x00, 0x06,
+  0x06, 0x06, 0x16, 0x06, 0x1d, 0x06, 0x25, 0x06, 0x2d, 0x06, 0x37, 0x06,
+  0x41, 0x06, 0x48, 0x06, 0x51, 0x06, 0x5a, 0x06, 0x62, 0x06, 0x6c, 0x06,
+  0x75, 0x06, 0x7b, 0x06, 0x82, 0x06, 0x89, 0x06, 0x93, 0x06, 0x9a, 0x06,
+  0xa1, 0x06, 0xa8, 0x06, 0xaf, 0x06, 0xb7, 0x06, 0xbf, 0x06, 0xc6, 0x06,
+  0xcc, 0x06, 0xd3, 0x06, 0xda, 0x06, 0xe1, 0x06, 0xe8, 0x06, 0xed, 0x06,
+  0xf1, 0x06, 0xf5, 0x06, 0xfa, 0x06, 0xff, 0x06, 0x04, 0x07, 0x0a, 0x07,
+  0x10, 0x07, 0x17, 0x07, 0x1c, 0x07, 0x23, 0x07, 0x28, 0x07, 0x2d, 0x07,
+  0x31, 0x07, 0x39, 0x07, 0x3f, 0x07, 0x44, 0x07, 0x4a, 0x07, 0x4f, 0x07,
+  0x54, 0x07, 0x59, 0x07, 0x5d, 0x07, 0x65, 0x07, 0x6c, 0x07, 0x74, 0x07,
+  0x7c, 0x07, 0x83, 0x07, 0x8c, 0x07, 0x93, 0x07, 0x9a, 0x07, 0xa0, 0x07,
+  0xa4, 0x07, 0xa9, 0x07, 0xae, 0x07, 0xb2, 0x07, 0xb6, 0x07, 0xb8, 0x07,
+  0xbc, 0x07, 0xbf, 0x07, 0xc2, 0x07, 0xc6, 0x07, 0xca, 0x07, 0xcd, 0x07,
+  0xd9, 0x07, 0xdb, 0x07, 0xdf, 0x07, 0xe4, 0x07, 0xe8, 0x07, 0xe9, 0x07,
+  0xea, 0x07, 0xee, 0x07, 0xf0, 0x07, 0xf3, 0x07, 0xf5, 0x07, 0xf6, 0x07,
+  0xf7, 0x07, 0xfa, 0x07, 0xfd, 0x07, 0xff, 0x07, 0x02, 0x08, 0x07, 0x08,
+  0x0b, 0x08, 0x10, 0x08, 0x13, 0x08, 0x14, 0x08, 0x15, 0x08, 0x16, 0x08,
+  0x17, 0x08, 0x1a, 0x08, 0x1c, 0x08, 0x1e, 0x08, 0x1f, 0x08, 0x20, 0x08,
+  0x23, 0x08, 0x26, 0x08, 0x2c, 0x08, 0x2d, 0x08, 0x2f, 0x08, 0x31, 0x08,
+  0x33, 0x08, 0x34, 0x08, 0x35, 0x08, 0x36, 0x08, 0x37, 0x08, 0x39, 0x08,
+  0x3c, 0x08, 0x3e, 0x08, 0x41, 0x08, 0x46, 0x08, 0x49, 0x08, 0x4d, 0x08,
+  0x50, 0x08, 0x53, 0x08, 0x55, 0x08, 0x57, 0x08, 0x5b, 0x08, 0x61, 0x08,
+  0x6a, 0x08, 0x6f, 0x08, 0x74, 0x08, 0x79, 0x08, 0x80, 0x08, 0x83, 0x08,
+  0x86, 0x08, 0x89, 0x08, 0x8c, 0x08, 0x90, 0x08, 0x93, 0x08, 0x95, 0x08,
+  0x98, 0x08, 0x99, 0x08, 0x9b, 0x08, 0xa0, 0x08, 0xaa, 0x08, 0xae, 0x08,
+  0xb3, 0x08, 0xb8, 0x08, 0xbe, 0x08, 0xc6, 0x08, 0xce, 0x08, 0xd4, 0x08,
+  0xdd, 0x08, 0xe5, 0x08, 0xeb, 0x08, 0xf3, 0x08, 0xfb, 0x08, 0x02, 0x09,
+  0x09, 0x09, 0x10, 0x09, 0x18, 0x09, 0x1e, 0x09, 0x26, 0x09, 0x2c, 0x09,
+  0x30, 0x09, 0x34, 0x09, 0x39, 0x09, 0x3d, 0x09, 0x42, 0x09, 0x48, 0x09,
+  0x4f, 0x09, 0x54, 0x09, 0x5b, 0x09, 0x60, 0x09, 0x64, 0x09, 0x67, 0x09,
+  0x69, 0x09, 0x6c, 0x09, 0x6e, 0x09, 0x73, 0x09, 0x78, 0x09, 0x7b, 0x09,
+  0x7e, 0x09, 0x80, 0x09, 0x85, 0x09, 0x88, 0x09, 0x8b, 0x09, 0x8e, 0x09,
+  0x91, 0x09, 0x95, 0x09, 0x9b, 0x09, 0x9c, 0x09, 0x9f, 0x09, 0xa0, 0x09,
+  0xa1, 0x09, 0xa4, 0x09, 0xa8, 0x09, 0xa9, 0x09, 0xad, 0x09, 0xaf, 0x09,
+  0xb2, 0x09, 0xb5, 0x09, 0xb8, 0x09, 0xba, 0x09, 0xba, 0x09, 0xba, 0x09,
+  0xba, 0x09, 0xbb, 0x09, 0xbb, 0x09, 0xbb, 0x09, 0xbd, 0x09, 0xbd, 0x09,
+  0xbd, 0x09, 0xbe, 0x09, 0xbe, 0x09, 0xbe, 0x09, 0xbe, 0x09, 0xbe, 0x09,
+  0xc0, 0x09, 0xc0, 0x09, 0xc0, 0x09, 0xc1, 0x09, 0xc2, 0x09, 0xc2, 0x09,
+  0xc2, 0x09, 0xc2, 0x09, 0xc2, 0x09, 0xc3, 0x09, 0xc3, 0x09, 0xc3, 0x09,
+  0xc4, 0x09, 0xc4, 0x09, 0xc4, 0x09, 0xc6, 0x09, 0xc6, 0x09, 0xc7, 0x09,
+  0xc7, 0x09, 0xc7, 0x09, 0xc8, 0x09, 0xc8, 0x09, 0xc8, 0x09, 0xc8, 0x09,
+  0xc8, 0x09, 0xc8, 0x09, 0xc8, 0x09, 0xc8, 0x09, 0xc8, 0x09, 0xc8, 0x09,
+  0xc9, 0x09, 0xc9, 0x09, 0xc9, 0x09, 0xc9, 0x09, 0xc9, 0x09, 0xc9, 0x09,
+  0xcc, 0x09, 0xcc, 0x09, 0xcd, 0x09, 0xce, 0x09, 0xcf, 0x09, 0xd0, 0x09,
+  0xd0, 0x09, 0xd4, 0x09, 0xdb, 0x09, 0xdc, 0x09, 0xdc, 0x09, 0xde, 0x09,
+  0xde, 0x09, 0x00, 0x00, 0xaf, 0x8c, 0x02, 0x63, 0x31, 0x3e, 0xc6, 0x70,
+  0x35, 0x0b, 0x6b, 0xba, 0x17, 0x17, 0x32, 0x85, 0xd4, 0x4d, 0xe2, 0x51,
+  0xd4, 0xbb, 0xd9, 0xce, 0xbd, 0x67, 0xf7, 0xf7, 0xf7, 0xed, 0xf7, 0x8b,
+  0x65, 0x65, 0x3d, 0x2f, 0x94, 0xc2, 0x82, 0xfe, 0x56, 0x42, 0x6c, 0xf3,
+  0x6e, 0xf4, 0xe5, 0x41, 0x42, 0xc4, 0xc4, 0x3c, 0xaf, 0xaf, 0xe6, 0x13,
+  0xd6, 0x65, 0xee, 0xc8, 0xa6, 0xa4, 0xd0, 0xa9, 0xae, 0x88, 0xbe, 0x35,
+  0x41, 0x9f, 0x07, 0x24, 0xe3, 0x1b, 0x99, 0x6c, 0x03, 0x20, 0x30, 0x90,
+  0x57, 0xf9, 0x85, 0xc9, 0x9e, 0xf3, 0x6c, 0xad, 0x71, 0x59, 0x2a, 0xb8,
+  0xa5, 0x89, 0xb3, 0xd6, 0x07, 0xa9, 0xfb, 0x0c, 0x48, 0x9a, 0xa1, 0xde,
+  0xe3, 0xe4, 0x05, 0xa8, 0x40, 0x9a, 0x5f, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a,
+  0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a,
+  0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0xba, 0x4c, 0x22, 0xf9, 0x2b, 0x79,
+  0x9d, 0x7d, 0x9a, 0x17, 0x5b, 0xe7, 0x31, 0x74, 0xff, 0xde, 0xef, 0xac,
+  0x58, 0xbe, 0x26, 0xa4, 0x2b, 0x53, 0x17, 0x8d, 0xc4, 0x93, 0x7f, 0x9d,
+  0x61, 0x74, 0x0c, 0xa3, 0xc8, 0x6f, 0x61, 0x3b, 0x91, 0x53, 0x1a, 0x1a,
+  0x0b, 0x5f, 0x5f, 0x2b, 0xa4, 0xa1, 0x90, 0x90, 0xc1, 0x90, 0x1e, 0x6c,
+  0x31, 0xff, 0xd2, 0xae, 0x45, 0xa5, 0xf5, 0x61, 0x61, 0xfb, 0x3c, 0x3c,
+  0x3c, 0xa1, 0x49, 0xa5, 0x80, 0xe7, 0x7a, 0x2c, 0x84, 0xde, 0x0a, 0x1a,
+  0x58, 0x39, 0x16, 0xcf, 0x86, 0x35, 0xf9, 0x1e, 0xa8, 0x94, 0xa6, 0x1d,
+  0x90, 0x80, 0x36, 0x4c, 0xe7, 0x9d, 0xd4, 0x96, 0xf1, 0x22, 0x09, 0x81,
+  0x25, 0x6f, 0xb2, 0x04, 0xc5, 0xc5, 0x4d, 0xa4, 0xfe, 0x49, 0xfc, 0xdf,
+  0x8e, 0x6a, 0xed, 0x12, 0x4c, 0x8a, 0x88, 0x27, 0x38, 0xf5, 0x13, 0x7d,
+  0xe4, 0x80, 0x17, 0xbe, 0x89, 0x0f, 0xc5, 0xd5, 0x32, 0x1d, 0xb3, 0xd7,
+  0xb9, 0xfb, 0x14, 0x8c, 0xe6, 0x72, 0x36, 0x8b, 0xbe, 0xc3, 0x91, 0xb0,
+  0xc8, 0x57, 0x24, 0x4d, 0x65, 0x79, 0x02, 0x09, 0xcc, 0xb3, 0x11, 0x51,
+  0x27, 0xf2, 0xed, 0xd8, 0xe3, 0x9b, 0xe2, 0x24, 0x34, 0x56, 0xf3, 0x24,
+  0x09, 0xd5, 0xbe, 0x9a, 0x49, 0x32, 0xfe, 0x72, 0xaf, 0x62, 0x1a, 0x5c,
+  0x58, 0x1e, 0x7b, 0x25, 0xaa, 0xb4, 0x75, 0x5a, 0xf9, 0x85, 0x73, 0x81,
+  0xa4, 0xff, 0x90, 0xa6, 0x08, 0x74, 0x6c, 0x3b, 0x10, 0xbb, 0x48, 0xf7,
+  0x08, 0x4f, 0x09, 0x9d, 0x70, 0x37, 0x98, 0xbe, 0x72, 0x26, 0x0d, 0x75,
+  0x75, 0x75, 0x1b, 0x78, 0x96, 0xf2, 0x41, 0xbf, 0x45, 0x98, 0x0f, 0xd7,
+  0x40, 0x37, 0xde, 0x11, 0xd8, 0xac, 0xcc, 0x31, 0xb4, 0x05, 0x14, 0x53,
+  0x5f, 0x5f, 0xf2, 0x04, 0xbd, 0xdd, 0x8e, 0x0d, 0x22, 0x89, 0x18, 0xc8,
+  0x3f, 0xbc, 0xa0, 0x17, 0xf2, 0xff, 0xc1, 0xc1, 0xc1, 0x61, 0xc1, 0x36,
+  0x3c, 0x2a, 0x56, 0x6e, 0x19, 0xcb, 0x7b, 0x8b, 0x79, 0x79, 0x79, 0x00,
+  0xd9, 0x2b, 0x65, 0x4a, 0x48, 0x5e, 0x2a, 0x19, 0x85, 0x12, 0xd5, 0x7f,
+  0xbb, 0x84, 0xe5, 0x01, 0x80, 0x82, 0xad, 0xd4, 0x1d, 0x96, 0x5d, 0x84,
+  0xef, 0xbc, 0xda, 0xc2, 0x4f, 0xff, 0x35, 0xc2, 0x57, 0x65, 0x0c, 0xd0,
+  0x56, 0xa9, 0x08, 0x63, 0x40, 0x69, 0x35, 0xb3, 0x21, 0x04, 0x0d, 0xfb,
+  0xe2, 0xd8, 0x5c, 0x57, 0x11, 0x20, 0xbc, 0xbc, 0x9c, 0x92, 0x3c, 0x98,
+  0xe3, 0xc3, 0xa1, 0xd5, 0x32, 0x32, 0xbe, 0x92, 0x96, 0x5a, 0x47, 0x9d,
+  0x14, 0x87, 0xdb, 0xff, 0xdb, 0x4a, 0x8a, 0x17, 0xdd, 0x8a, 0x8a, 0x05,
+  0x05, 0x05, 0x71, 0x99, 0x79, 0x9d, 0x59, 0x79, 0xf2, 0x2b, 0x4c, 0x22,
+  0xe7, 0xce, 0x5d, 0x2e, 0x8c, 0x3a, 0x8c, 0x90, 0x90, 0x85, 0x9b, 0x8a,
+  0xf8, 0x7e, 0x52, 0x52, 0x52, 0x1e, 0xde, 0x40, 0x1e, 0xde, 0x1c, 0x98,
+  0x2c, 0x30, 0xdb, 0x26, 0xe0, 0xe0, 0xe0, 0xe0, 0xd3, 0x1b, 0x68, 0x2a,
+  0x2a, 0x2a, 0x23, 0xc1, 0x44, 0x28, 0x07, 0xd6, 0x2e, 0xa9, 0x5e, 0xe1,
+  0x34, 0x3d, 0x4e, 0xa9, 0x49, 0xf3, 0x07, 0x65, 0xd0, 0x4a, 0x0f, 0x3c,
+  0xbc, 0xf1, 0x04, 0xb9, 0x24, 0xe7, 0x12, 0x12, 0x12, 0xea, 0xd1, 0x5f,
+  0x66, 0x41, 0x6c, 0x6c, 0xca, 0x33, 0x33, 0xec, 0xfa, 0xb2, 0x7f, 0x09,
+  0x09, 0x1e, 0x25, 0xaf, 0x54, 0x54, 0x92, 0xf9, 0xf9, 0xb2, 0x98, 0x24,
+  0x11, 0x2b, 0xfe, 0xe0, 0xe0, 0x24, 0x7a, 0x7a, 0x8f, 0x8f, 0xf0, 0x19,
+  0x19, 0x0e, 0x0e, 0xc9, 0xcd, 0xa3, 0xbb, 0xbb, 0xd5, 0xd5, 0x57, 0x57,
+  0x31, 0x69, 0xa4, 0xb4, 0x22, 0x22, 0x7a, 0x7a, 0x7a, 0x22, 0xf7, 0xf7,
+  0x36, 0x70, 0xcd, 0x85, 0xd3, 0xcd, 0xc3, 0xc0, 0x44, 0x44, 0x44, 0x81,
+  0xb6, 0x5f, 0x8e, 0xae, 0x19, 0x0d, 0xf2, 0xf2, 0xf2, 0x84, 0xaf, 0x11,
+  0xdc, 0x35, 0x35, 0x35, 0x45, 0x15, 0x15, 0x30, 0xbf, 0x00, 0x6b, 0x43,
+  0x1f, 0xd6, 0x35, 0x45, 0xc6, 0x4e, 0x78, 0x86, 0x86, 0x86, 0x96, 0xda,
+  0x48, 0x40, 0x1b, 0xfc, 0xd1, 0xd1, 0x88, 0x81, 0x19, 0x14, 0x14, 0x14,
+  0x3c, 0xe2, 0xed, 0xfd, 0x35, 0x35, 0x06, 0xea, 0xea, 0xea, 0x9e, 0xd3,
+  0xa6, 0xa6, 0xef, 0xe3, 0xad, 0xa3, 0x45, 0xc1, 0x59, 0x77, 0x51, 0x98,
+  0xe2, 0x0e, 0x57, 0x6b, 0x09, 0xb2, 0xec, 0xee, 0x21, 0x98, 0x2e, 0xe3,
+  0x3c, 0x3c, 0x3c, 0x08, 0xbf, 0x4a, 0x2e, 0x59, 0x85, 0xc4, 0xb1, 0xb1,
+  0xa5, 0x19, 0xa5, 0x18, 0x83, 0x08, 0x24, 0x10, 0x7d, 0x27, 0x78, 0xd2,
+  0xae, 0xf0, 0xf0, 0x71, 0xd3, 0xcb, 0x7a, 0x4d, 0xd0, 0x90, 0xa1, 0x76,
+  0xb7, 0xb8, 0x0a, 0x11, 0x02, 0x03, 0x51, 0xc8, 0xf1, 0xe1, 0x70, 0xe7,
+  0x01, 0x5c, 0x5c, 0x5c, 0x95, 0x6b, 0x0e, 0x2e, 0xa7, 0xde, 0x1d, 0xd9,
+  0xb5, 0xe0, 0xf2, 0x9d, 0xec, 0xcb, 0x10, 0x6e, 0x65, 0x2e, 0xf9, 0x56,
+  0xea, 0x1c, 0xea, 0xc4, 0x95, 0x41, 0xb2, 0x57, 0x61, 0x2f, 0xeb, 0xf9,
+  0x95, 0x31, 0x5b, 0x0a, 0xaf, 0x68, 0x41, 0x9e, 0x56, 0x23, 0x3c, 0xad,
+  0x44, 0x12, 0x71, 0xdb, 0x43, 0x0e, 0x94, 0x62, 0xfb, 0x48, 0x6d, 0x74,
+  0x82, 0x0a, 0xc6, 0x07, 0xd4, 0x4c, 0xb1, 0x19, 0x58, 0xef, 0x51, 0x7b,
+  0x3f, 0xc0, 0xe9, 0xe9, 0xe6, 0xe9, 0xe6, 0x02, 0x08, 0x8d, 0x8d, 0x8d,
+  0x96, 0x96, 0x7a, 0xe3, 0x8f, 0xa3, 0x08, 0x71, 0x71, 0x3b, 0x40, 0x05,
+  0x8f, 0xd5, 0x28, 0xf2, 0xe9, 0x7a, 0xff, 0xc2, 0xa2, 0x13, 0xb6, 0xd2,
+  0x91, 0x38, 0xb7, 0x98, 0x83, 0x13, 0x7b, 0x66, 0x7d, 0xf1, 0x18, 0x22,
+  0xa7, 0x52, 0x77, 0x62, 0xd6, 0xce, 0xe9, 0x09, 0x66, 0x2f, 0x9c, 0xb6,
+  0xac, 0xcb, 0xcb, 0x47, 0x56, 0x87, 0xf2, 0x5a, 0xd0, 0xe8, 0xd8, 0x77,
+  0x31, 0xf3, 0xbd, 0x4e, 0xab, 0xd0, 0xaa, 0x3d, 0x78, 0xf3, 0xae, 0x02,
+  0x86, 0x08, 0xb6, 0x26, 0x42, 0xfe, 0x21, 0x9a, 0xa2, 0x65, 0xac, 0xee,
+  0xb9, 0xe8, 0xbd, 0xac, 0xbe, 0x21, 0xd0, 0x45, 0x40, 0xa8, 0x6b, 0x8b,
+  0x51, 0x4a, 0x15, 0xfe, 0x51, 0xbe, 0xae, 0x7a, 0x72, 0xc0, 0x9e, 0x9c,
+  0x62, 0xdc, 0x4c, 0xeb, 0xeb, 0xfe, 0xa7, 0xd0, 0xc0, 0x79, 0x32, 0x97,
+  0x64, 0x28, 0xe5, 0xad, 0x0f, 0x69, 0xb9, 0xf3, 0xc2, 0xab, 0x6c, 0x3d,
+  0x1d, 0xfd, 0xaf, 0x48, 0x2a, 0x96, 0x2f, 0x44, 0xb7, 0x49, 0xd5, 0x36,
+  0x3b, 0x6b, 0xa3, 0x90, 0x05, 0x1b, 0x9a, 0xf4, 0xc0, 0x2c, 0x9b, 0xd5,
+  0xb5, 0x2a, 0x23, 0x47, 0xb6, 0xb8, 0xd4, 0xc2, 0x97, 0x61, 0xad, 0xce,
+  0xe6, 0x58, 0xc9, 0xbb, 0x50, 0x11, 0xba, 0x46, 0x48, 0x85, 0xc4, 0x1a,
+  0x0f, 0x9c, 0xcc, 0xcc, 0x7f, 0x84, 0x9b, 0x02, 0x7c, 0xbc, 0x3f, 0xbf,
+  0x75, 0xd6, 0xef, 0xe1, 0x2a, 0xe7, 0x67, 0x5d, 0x8d, 0x92, 0x37, 0xc3,
+  0xb5, 0xd6, 0x35, 0x9e, 0x76, 0x4a, 0xac, 0xa6, 0x02, 0x3f, 0x94, 0x3e,
+  0x5e, 0xf1, 0xf4, 0xc9, 0x6c, 0xf9, 0xf4, 0x51, 0x21, 0x8f, 0xcf, 0x5d,
+  0xf7, 0xad, 0xe9, 0x63, 0x40, 0x60, 0x0f, 0x22, 0xe8, 0x03, 0xa4, 0x03,
+  0xf0, 0x18, 0x17, 0x62, 0x89, 0x81, 0xcb, 0x79, 0x38, 0x38, 0x38, 0x32,
+  0xbd, 0xd2, 0xee, 0x47, 0xac, 0x23, 0x4a, 0xd1, 0x78, 0x8c, 0x31, 0xa0,
+  0x60, 0xe6, 0x32, 0x80, 0x59, 0x96, 0xf4, 0x49, 0x61, 0x4e, 0xfb, 0x92,
+  0x80, 0xc7, 0x17, 0xdd, 0x68, 0x3e, 0x4c, 0xb7, 0xb6, 0xe2, 0x7f, 0x1a,
+  0xa9, 0x64, 0x22, 0x25, 0x70, 0xe2, 0x80, 0x5d, 0xd4, 0x8a, 0x97, 0xa7,
+  0x35, 0xc4, 0xf3, 0x79, 0x0e, 0x55, 0x9b, 0x7c, 0x21, 0xfc, 0x39, 0xba,
+  0x3f, 0x78, 0x60, 0x5c, 0xa6, 0x14, 0xd6, 0x0f, 0xb5, 0xe9, 0x35, 0xa3,
+  0x0e, 0x5a, 0x4e, 0x4d, 0xb3, 0x33, 0x9b, 0x2a, 0xdc, 0xd2, 0x23, 0xf8,
+  0x32, 0x6f, 0x61, 0x69, 0xa6, 0xd1, 0x46, 0xda, 0xc9, 0x1f, 0x32, 0x5c,
+  0xd9, 0x44, 0x18, 0x89, 0x9b, 0x65, 0xf9, 0x94, 0x3e, 0x53, 0x8e, 0x68,
+  0x03, 0x36, 0x1f, 0x73, 0x98, 0xeb, 0xfe, 0x65, 0xf9, 0x9c, 0xaa, 0xed,
+  0xe8, 0x0f, 0x70, 0x0d, 0x5c, 0xd3, 0x42, 0x4e, 0xec, 0xe5, 0xaf, 0x03,
+  0xef, 0x1d, 0x40, 0x58, 0x48, 0xa2, 0x95, 0xac, 0x79, 0x89, 0xce, 0xcd,
+  0x34, 0x53, 0x34, 0x99, 0x21, 0xea, 0x7f, 0x6f, 0x95, 0xca, 0x56, 0xe3,
+  0x5d, 0xac, 0xcd, 0xa9, 0x61, 0xc5, 0x40, 0xe6, 0x97, 0xf6, 0x5b, 0xbb,
+  0x5f, 0xd9, 0x7a, 0xd4, 0xcc, 0xcc, 0xcc, 0xfe, 0xf2, 0x2e, 0xf3, 0x2e,
+  0x9e, 0x06, 0xec, 0x6f, 0x8e, 0x8e, 0x8e, 0x1d, 0xcb, 0x7a, 0xb3, 0x62,
+  0x94, 0x3c, 0xf6, 0x92, 0xfb, 0xe4, 0x75, 0x9b, 0x20, 0x9d, 0x66, 0x2a,
+  0xdc, 0x75, 0xdc, 0x20, 0x54, 0x1d, 0x0a, 0x8d, 0xf4, 0xec, 0x9a, 0xd8,
+  0x87, 0x89, 0xf4, 0xc4, 0x71, 0xf1, 0x7f, 0x34, 0x63, 0x72, 0x22, 0xc7,
+  0x89, 0xbe, 0x2b, 0x5a, 0x56, 0xeb, 0x50, 0x1d, 0x12, 0xbf, 0xe8, 0xc3,
+  0x47, 0xb6, 0xa0, 0x41, 0x5e, 0x43, 0x3b, 0x03, 0x48, 0xd6, 0xce, 0x29,
+  0xa0, 0x91, 0xdf, 0x1f, 0x6d, 0xa3, 0xa8, 0x82, 0x26, 0x5a, 0x42, 0xc3,
+  0x8b, 0x9c, 0xd7, 0x55, 0xfe, 0xb4, 0xa7, 0x36, 0x16, 0x7a, 0xf5, 0x66,
+  0xde, 0x7f, 0x03, 0xa2, 0xa5, 0x2b, 0x3e, 0xd5, 0x55, 0xc4, 0x93, 0x51,
+  0x37, 0x1d, 0x1a, 0x38, 0x64, 0x90, 0x68, 0x45, 0x8e, 0x8c, 0xb0, 0xf2,
+  0x06, 0xf0, 0x64, 0xe8, 0x34, 0xc7, 0x5f, 0x05, 0x35, 0x41, 0x10, 0x76,
+  0xa1, 0x78, 0xef, 0x93, 0x9a, 0xdd, 0xde, 0x8f, 0xce, 0xe2, 0xc4, 0x6d,
+  0xf2, 0x53, 0x21, 0x61, 0x51, 0x64, 0x3c, 0xf1, 0xbb, 0x68, 0x3e, 0x68,
+  0x15, 0xb3, 0xbb, 0xed, 0x18, 0xb8, 0xa6, 0x1a, 0x81, 0xc9, 0x59, 0x80,
+  0xe2, 0x19, 0x09, 0x84, 0xb0, 0x12, 0x37, 0x24, 0x89, 0x9b, 0x33, 0x2f,
+  0xaa, 0x7e, 0xa7, 0xde, 0x7e, 0x7e, 0x48, 0xda, 0xab, 0x99, 0xf1, 0x0b,
+  0xd3, 0x0d, 0xa8, 0xfc, 0xb4, 0x5a, 0x70, 0x8f, 0x9a, 0x66, 0x34, 0xf6,
+  0x76, 0x9a, 0x5c, 0x78, 0xcc, 0xae, 0x41, 0xe5, 0x0e, 0xce, 0xe7, 0x7b,
+  0xfe, 0xaa, 0x3a, 0x85, 0xc3, 0x2d, 0xd8, 0xd9, 0x05, 0x21, 0xdd, 0x5f,
+  0xbd, 0x79, 0x0f, 0x95, 0xa9, 0xce, 0xd1, 0xeb, 0x9e, 0x1c, 0xcb, 0xb3,
+  0xef, 0xe2, 0x0b, 0x42, 0xb5, 0xf4, 0xc0, 0x10, 0x38, 0x38, 0x94, 0x0e,
+  0x91, 0x3b, 0x95, 0xa8, 0xaf, 0x25, 0x78, 0x29, 0x89, 0x5f, 0x01, 0xff,
+  0x3b, 0x45, 0x1c, 0xf8, 0x1f, 0xcf, 0x4f, 0x08, 0xa5, 0xd0, 0x5a, 0x64,
+  0x8d, 0x7f, 0x6a, 0x89, 0x39, 0x54, 0xc7, 0x69, 0x2f, 0xca, 0x78, 0x8c,
+  0xfe, 0x1f, 0xca, 0xe6, 0x6b, 0xf7, 0xbb, 0x07, 0xee, 0x9e, 0xaa, 0x10,
+  0x31, 0xfa, 0x4a, 0xc4, 0x2d, 0xf8, 0xad, 0xa3, 0x0a, 0xd0, 0x57, 0x63,
+  0x0f, 0xbd, 0x93, 0xf0, 0x87, 0x3d, 0xd7, 0x95, 0xbe, 0x91, 0x44, 0x20,
+  0x80, 0x30, 0xac, 0x26, 0x74, 0x28, 0x18, 0xd0, 0xba, 0xf3, 0x73, 0x10,
+  0xb0, 0xb2, 0x51, 0x5b, 0x63, 0x4b, 0x5b, 0x1d, 0x83, 0x1f, 0x01, 0xd1,
+  0xb9, 0x92, 0xa0, 0x90, 0x65, 0x47, 0x63, 0x32, 0x1e, 0x22, 0xd5, 0xe5,
+  0x08, 0x57, 0x73, 0x51, 0xf3, 0x58, 0x70, 0xd4, 0x94, 0xe6, 0x3f, 0xe4,
+  0x05, 0xb4, 0x86, 0xe5, 0xe5, 0xb0, 0xe5, 0xf0, 0xd2, 0x62, 0xda, 0x03,
+  0x91, 0xa4, 0x44, 0x40, 0x03, 0xd1, 0x64, 0x04, 0xce, 0x99, 0x8b, 0xff,
+  0xa3, 0x25, 0xf7, 0xaa, 0x58, 0x69, 0x61, 0x62, 0xb4, 0x66, 0xd0, 0xfd,
+  0xa7, 0xc7, 0x8b, 0x60, 0x81, 0xd2, 0x9e, 0x81, 0x36, 0x72, 0xff, 0xd2,
+  0x10, 0x39, 0x70, 0xd6, 0xb2, 0xb0, 0x01, 0xd4, 0xaf, 0xbf, 0x6a, 0x24,
+  0xf3, 0x4b, 0x1a, 0x01, 0x5c, 0xd1, 0x2a, 0xbf, 0x2d, 0x3d, 0x65, 0xcb,
+  0x41, 0xb4, 0x2a, 0xbb, 0xae, 0x43, 0x1d, 0xae, 0xf6, 0xc3, 0x82, 0xc9,
+  0xe5, 0xac, 0xc0, 0x66, 0x54, 0xfa, 0x64, 0x4f, 0xf3, 0x46, 0xd9, 0x7a,
+  0x53, 0xe9, 0x37, 0x25, 0xe5, 0x13, 0x8e, 0xfa, 0x9a, 0x86, 0x24, 0x2f,
+  0x4a, 0x0c, 0x49, 0x9d, 0x78, 0x3a, 0xbd, 0xd9, 0x37, 0xc9, 0x2f, 0x1f,
+  0x72, 0xaa, 0x80, 0x38, 0xfc, 0x7b, 0x82, 0xd4, 0xee, 0x8a, 0x4e, 0xea,
+  0x1f, 0x15, 0x01, 0x41, 0x0c, 0x28, 0x14, 0xb3, 0xe2, 0x9f, 0x46, 0xc4,
+  0x28, 0x22, 0x4c, 0xb7, 0xf4, 0x82, 0xad, 0x44, 0xbb, 0xed, 0xe6, 0x63,
+  0x57, 0xb6, 0x57, 0x42, 0x76, 0x25, 0x0a, 0x21, 0xb0, 0x91, 0x74, 0xef,
+  0x76, 0x2f, 0x67, 0x81, 0x55, 0x06, 0xcd, 0x1f, 0xc8, 0xbd, 0xfd, 0x1d,
+  0x33, 0x04, 0xf8, 0xac, 0xb0, 0xc2, 0x97, 0x1d, 0x10, 0x39, 0xcd, 0x3a,
+  0x02, 0x8f, 0xfb, 0xe6, 0x4c, 0xa9, 0xed, 0x64, 0x5b, 0x85, 0xc5, 0x5b,
+  0x92, 0xce, 0x13, 0x51, 0xc6, 0x31, 0x70, 0x54, 0xe0, 0xde, 0x12, 0x12,
+  0xf0, 0x5d, 0xeb, 0xf3, 0x70, 0xa1, 0xa1, 0x61, 0xe2, 0x0a, 0x98, 0x17,
+  0x59, 0xfe, 0xfe, 0xdf, 0xb5, 0x1c, 0x9b, 0x61, 0xe3, 0x8a, 0x8a, 0x4c,
+  0x0d, 0x8f, 0x5b, 0x3e, 0x74, 0x74, 0x07, 0x3f, 0xe4, 0x39, 0xa0, 0xdc,
+  0x81, 0xe7, 0xe7, 0xab, 0x38, 0xdc, 0x4b, 0xc1, 0x31, 0x31, 0x66, 0xab,
+  0x4a, 0x16, 0xc0, 0x4a, 0xc0, 0x96, 0xc5, 0xed, 0x70, 0x74, 0x73, 0xb6,
+  0x77, 0x6b, 0xe3, 0x46, 0x9a, 0x54, 0x6b, 0x83, 0x83, 0x36, 0xf8, 0x5c,
+  0x17, 0x17, 0xc1, 0x81, 0xb8, 0xf8, 0x13, 0xd1, 0xc7, 0xb4, 0x12, 0xad,
+  0xe5, 0x5b, 0x6d, 0xff, 0x7f, 0x92, 0xbb, 0xaf, 0xc2, 0x38, 0x0f, 0xb9,
+  0x26, 0x88, 0xfe, 0x23, 0x94, 0xb6, 0x62, 0x55, 0xae, 0x39, 0x0c, 0x65,
+  0x60, 0x56, 0xc8, 0x60, 0x80, 0x96, 0xcd, 0xc0, 0x34, 0xd7, 0xe9, 0x61,
+  0x56, 0x0c, 0xfe, 0x9c, 0x8c, 0x01, 0xc1, 0x64, 0x0c, 0x0e, 0x7f, 0x1f,
+  0x53, 0xbd, 0x72, 0xc6, 0x28, 0x52, 0xba, 0x9a, 0xa9, 0x43, 0xcd, 0x3c,
+  0x56, 0x46, 0xd8, 0x54, 0xd7, 0x1c, 0x6a, 0x8d, 0x95, 0xfc, 0xc4, 0x17,
+  0x07, 0x72, 0xfe, 0xee, 0x6e, 0xf2, 0xf2, 0x0e, 0x78, 0xff, 0xe9, 0x95,
+  0xcb, 0x3f, 0x01, 0xa5, 0x25, 0x45, 0xa4, 0x14, 0x80, 0xf7, 0x46, 0x39,
+  0x4e, 0x80, 0x3e, 0x1c, 0xc2, 0xba, 0xab, 0xae, 0x05, 0x31, 0xa8, 0x8d,
+  0x9b, 0x59, 0xb7, 0xfb, 0x37, 0x34, 0x0e, 0x49, 0x05, 0x7f, 0xc5, 0xd1,
+  0xfc, 0x5c, 0x7d, 0x6e, 0xdf, 0x01, 0xf2, 0x20, 0x9a, 0xf3, 0x8d, 0xb2,
+  0xb1, 0xdb, 0xe4, 0x24, 0x50, 0x31, 0xdb, 0xae, 0xca, 0xb0, 0xa4, 0xa1,
+  0x43, 0x17, 0x12, 0x82, 0xaa, 0x7f, 0x92, 0x36, 0xbe, 0x0d, 0x6d, 0x2f,
+  0xbd, 0x34, 0xd3, 0xef, 0xae, 0x85, 0x17, 0x63, 0xff, 0xcc, 0x55, 0x47,
+  0x50, 0x6e, 0x59, 0x4c, 0xe0, 0xd0, 0xe6, 0x16, 0x16, 0x16, 0xe9, 0xf8,
+  0x7a, 0x66, 0xb9, 0x0c, 0xfb, 0xc7, 0xdb, 0x91, 0x74, 0x97, 0xbe, 0x9e,
+  0x4e, 0xe2, 0x39, 0x16, 0x2f, 0xd3, 0x10, 0xf2, 0xcc, 0xd9, 0xe7, 0x56,
+  0x29, 0x74, 0xf0, 0x03, 0xa8, 0x89, 0x44, 0x84, 0x7e, 0x68, 0x0b, 0x4c,
+  0xb3, 0xe0, 0x98, 0x2a, 0x05, 0x89, 0xbb, 0x63, 0x4d, 0xde, 0x67, 0x8e,
+  0x8c, 0x9d, 0x6c, 0x9f, 0xac, 0x7d, 0x1e, 0xe9, 0xfd, 0xe8, 0xe8, 0xe8,
+  0xe8, 0xa2, 0xdd, 0xa1, 0x8c, 0x4d, 0xc7, 0x4c, 0x2b, 0x3c, 0xda, 0x11,
+  0x4f, 0xde, 0xf7, 0xb5, 0x22, 0xc8, 0x3f, 0x70, 0x1f, 0x3b, 0x41, 0xeb,
+  0x30, 0xab, 0xe3, 0xde, 0xea, 0xaf, 0xd6, 0x79, 0x7e, 0xa7, 0x16, 0x9d,
+  0x42, 0x18, 0x55, 0xe8, 0x52, 0xe9, 0xc9, 0x35, 0xb1, 0xfc, 0x21, 0xe2,
+  0x43, 0x5e, 0xa4, 0x2f, 0x22, 0xb5, 0xcf, 0x41, 0x2d, 0x90, 0xf5, 0xd3,
+  0xd3, 0x8c, 0x7d, 0x39, 0x98, 0x61, 0x43, 0x19, 0xa4, 0xa1, 0x3d, 0x30,
+  0x0a, 0xa3, 0x9c, 0x8e, 0xff, 0x38, 0x9c, 0xf5, 0x1c, 0x62, 0x40, 0xfc,
+  0x41, 0x6c, 0x2f, 0x6f, 0x43, 0xb3, 0x6a, 0xfd, 0x92, 0xc3, 0xe2, 0x37,
+  0x01, 0xdf, 0x4e, 0x0b, 0xbb, 0xc7, 0xe6, 0x9f, 0xf9, 0xb2, 0xd4, 0xf9,
+  0x56, 0x35, 0xe2, 0x94, 0x72, 0x5a, 0x32, 0xa8, 0xc7, 0xdc, 0x01, 0xbf,
+  0x28, 0x86, 0x12, 0x75, 0xfd, 0x3d, 0xc0, 0x48, 0x7e, 0xcc, 0xac, 0xb7,
+  0x53, 0x00, 0xa0, 0x52, 0xaa, 0xf0, 0x17, 0x95, 0x23, 0x6f, 0xa4, 0x03,
+  0x1d, 0xa8, 0x0f, 0x66, 0xc3, 0x5d, 0xc8, 0x3b, 0xba, 0x71, 0x5d, 0xec,
+  0x55, 0x66, 0x54, 0x08, 0xe9, 0xb5, 0xe9, 0xf3, 0xc7, 0xca, 0x56, 0x48,
+  0x6a, 0x19, 0x71, 0x29, 0xbf, 0x54, 0x98, 0xe5, 0xec, 0x25, 0xbe, 0x74,
+  0xe6, 0x98, 0x46, 0x95, 0xdc, 0x68, 0x08, 0xd7, 0xdd, 0x7a, 0x6a, 0x69,
+  0xec, 0x8a, 0xae, 0xfc, 0x1e, 0x39, 0x72, 0x7f, 0x1b, 0x8b, 0x45, 0xec,
+  0xcc, 0xa8, 0x66, 0x06, 0x0c, 0x38, 0xf0, 0x9d, 0x48, 0x43, 0x49, 0x60,
+  0x1f, 0xe7, 0x9d, 0xeb, 0xdd, 0x5e, 0xfd, 0x23, 0x4a, 0xd0, 0x7f, 0x35,
+  0x23, 0xbf, 0xb1, 0x2f, 0xb1, 0x55, 0x5b, 0xe0, 0xc9, 0xc0, 0xfe, 0x9e,
+  0xf4, 0x9e, 0xf4, 0xfa, 0xa3, 0xc9, 0x0b, 0xcb, 0x21, 0xb0, 0x74, 0x5d,
+  0x6b, 0xce, 0xe2, 0x6a, 0x9f, 0x52, 0x2e, 0x1a, 0x83, 0xee, 0x2e, 0x05,
+  0x0d, 0x65, 0x9e, 0x57, 0x02, 0x0c, 0xd5, 0x94, 0x81, 0x4e, 0x67, 0x78,
+  0xc9, 0xec, 0x81, 0xf1, 0xec, 0x20, 0x6a, 0x6a, 0xc6, 0xd8, 0x4d, 0x77,
+  0x31, 0x8e, 0xba, 0xa7, 0xeb, 0x41, 0xce, 0x3e, 0x40, 0x12, 0x47, 0xb3,
+  0xfd, 0x6b, 0xa6, 0x34, 0xef, 0x22, 0x61, 0x69, 0xde, 0xde, 0x00, 0x00,
+  0x00, 0x00, 0x4c, 0x00, 0x9a, 0x00, 0x00, 0x00, 0x48, 0x00, 0x92, 0x00,
+  0xdc, 0x00, 0x28, 0x01, 0x71, 0x01, 0x00, 0x00, 0x06, 0x00, 0x0c, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x08, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x19, 0x00, 0x33, 0x00, 0x4d, 0x00, 0x53, 0x00,
+  0x59, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x42, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x43, 0x00,
+  0x4d, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x43, 0x00,
+  0x4a, 0x00, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00,
+  0x15, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x26, 0x00, 0x48, 0x00, 0x6d, 0x00, 0x85, 0x00, 0xa0, 0x00,
+  0xb6, 0x00, 0xcc, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x27, 0x00, 0x4a, 0x00,
+  0x6f, 0x00, 0x88, 0x00, 0xa4, 0x00, 0xbf, 0x00, 0xd9, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x19, 0x00, 0x2c, 0x00, 0x3d, 0x00,
+  0x4f, 0x00, 0x67, 0x00, 0x7d, 0x00, 0x93, 0x00, 0xab, 0x00, 0xc1, 0x00,
+  0xda, 0x00, 0xf3, 0x00, 0x0c, 0x01, 0x23, 0x01, 0x3b, 0x01, 0x53, 0x01,
+  0x69, 0x01, 0x80, 0x01, 0x93, 0x01, 0xa6, 0x01, 0xb9, 0x01, 0xcc, 0x01,
+  0xdf, 0x01, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x19, 0x00, 0x1f, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1e, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x25, 0x00, 0x50, 0x00, 0x67, 0x00,
+  0x99, 0x00, 0xb6, 0x00, 0xc9, 0x00, 0xe8, 0x00, 0x00, 0x00, 0x1f, 0x00,
+  0x00, 0x00, 0x24, 0x00, 0x50, 0x00, 0x68, 0x00, 0x9a, 0x00, 0xb7, 0x00,
+  0xd4, 0x00, 0xfc, 0x00, 0x03, 0x01, 0x00, 0x00, 0x1b, 0x00, 0x37, 0x00,
+  0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x25, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x18, 0x00, 0x31, 0x00, 0x37, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1b, 0x00, 0x21, 0x00, 0x00, 0x00, 0x28, 0x00, 0x49, 0x00,
+  0x6c, 0x00, 0x84, 0x00, 0xa1, 0x00, 0xb9, 0x00, 0xd0, 0x00, 0xed, 0x00,
+  0x05, 0x01, 0x1a, 0x01, 0x00, 0x00, 0x22, 0x00, 0x3f, 0x00, 0x49, 0x00,
+  0x00, 0x00, 0x29, 0x00, 0x49, 0x00, 0x6d, 0x00, 0x84, 0x00, 0xa2, 0x00,
+  0xbb, 0x00, 0xdc, 0x00, 0x00, 0x00, 0x27, 0x00, 0x41, 0x00, 0x5a, 0x00,
+  0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x28, 0x00, 0x46, 0x00, 0x62, 0x00,
+  0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x39, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x18, 0x00,
+  0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x23, 0x00, 0x29, 0x00,
+  0x38, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00,
+  0x23, 0x00, 0x3a, 0x00, 0x58, 0x00, 0x79, 0x00, 0x00, 0x00, 0x22, 0x00,
+  0x28, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x24, 0x00, 0x3b, 0x00, 0x5a, 0x00,
+  0x88, 0x00, 0xa2, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x1a, 0x00,
+  0x37, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x35, 0x00, 0x54, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x48, 0x00, 0x62, 0x00, 0x7c, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x00,
+  0x36, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x3c, 0x00, 0x5b, 0x00, 0x00, 0x00,
+  0x19, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x29, 0x00, 0x50, 0x00, 0x6b, 0x00,
+  0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x37, 0x00, 0x00, 0x00,
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x37, 0x00, 0x54, 0x00,
+  0x00, 0x00, 0x1a, 0x00, 0x35, 0x00, 0x53, 0x00, 0x00, 0x00, 0x21, 0x00,
+  0x00, 0x00, 0x22, 0x00, 0x40, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x39, 0x00,
+  0x60, 0x00, 0x66, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x3b, 0x00, 0x00, 0x00,
+  0x24, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x3b, 0x00, 0x57, 0x00, 0x60, 0x00,
+  0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x22, 0x00, 0x44, 0x00, 0x4c, 0x00,
+  0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x39, 0x00, 0x54, 0x00,
+  0x00, 0x00, 0x2b, 0x00, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00,
+  0x00, 0x00, 0x2d, 0x00, 0x50, 0x00, 0x6d, 0x00, 0x93, 0x00, 0x00, 0x00,
+  0x23, 0x00, 0x37, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x1d, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x19, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00,
+  0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x28, 0x00, 0x3e, 0x00, 0x44, 0x00,
+  0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0c, 0x00, 0x1f, 0x00, 0x37, 0x00,
+  0x3d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00,
+  0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x30, 0x00, 0x38, 0x00, 0x41, 0x00, 0x49, 0x00, 0x00, 0x00,
+  0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x10, 0x00, 0x18, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00,
+  0x0c, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x31, 0x00, 0x00, 0x00,
+  0x28, 0x00, 0x32, 0x00, 0x00, 0x00, 0x20, 0x00, 0x33, 0x00, 0x39, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00,
+  0x00, 0x00, 0x11, 0x00, 0x21, 0x00, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x12, 0x00,
+  0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x10, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x35, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00,
+  0x24, 0x00, 0x39, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x28, 0x00, 0x3d, 0x00, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x18, 0x00, 0x00, 0x00, 0x1c, 0x00,
+  0x22, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x25, 0x00,
+  0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x1e, 0x00, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x18, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x11, 0x00,
+  0x25, 0x00, 0x00, 0x00, 0x06, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x0f, 0x00, 0x18, 0x00, 0x00, 0x00, 0x12, 0x00,
+  0x00, 0x00, 0x06, 0x00, 0x14, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x14, 0x00,
+  0x25, 0x00, 0x2b, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x40, 0x00,
+  0x55, 0x00, 0x68, 0x00, 0x80, 0x00, 0x96, 0x00, 0xaf, 0x00, 0xb5, 0x00,
+  0xc9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x38, 0x00, 0x3e, 0x00,
+  0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x2c, 0x00, 0x39, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1b, 0x00, 0x21, 0x00, 0x2e, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1b, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x29, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00,
+  0x27, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1d, 0x00, 0x2a, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x1f, 0x00, 0x25, 0x00, 0x2b, 0x00,
+  0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x15, 0x00,
+  0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x0a, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x1f, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x06, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x19, 0x00, 0x35, 0x00, 0x00, 0x00, 0x18, 0x00, 0x32, 0x00, 0x00, 0x00,
+  0x1e, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x26, 0x00, 0x00, 0x00, 0x17, 0x00,
+  0x33, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x28, 0x00, 0x00, 0x00, 0x0d, 0x00,
+  0x28, 0x00, 0x3a, 0x00, 0x49, 0x00, 0x57, 0x00, 0x00, 0x00, 0x18, 0x00,
+  0x34, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x14, 0x00, 0x2d, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x18, 0x00, 0x21, 0x00, 0x00, 0x00, 0x23, 0x00, 0x31, 0x00, 0x00, 0x00,
+  0x18, 0x00, 0x00, 0x00, 0x13, 0x00, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x24, 0x00,
+  0x00, 0x00, 0x1c, 0x00, 0x31, 0x00, 0x4a, 0x00, 0x00, 0x00, 0x1d, 0x00,
+  0x33, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x17, 0x00, 0x2a, 0x00, 0x3a, 0x00, 0x49, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x19, 0x00, 0x2d, 0x00,
+  0x3f, 0x00, 0x47, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x17, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x11, 0x00,
+  0x1e, 0x00, 0x00, 0x00, 0x11, 0x00, 0x23, 0x00, 0x00, 0x00, 0x1c, 0x00,
+  0x2e, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x11, 0x00, 0x16, 0x00, 0x00, 0x00, 0x1a, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x14, 0x00,
+  0x1b, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x32, 0x00, 0x55, 0x00, 0x5c, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x14, 0x00, 0x19, 0x00, 0x2c, 0x00,
+  0x00, 0x00, 0x16, 0x00, 0x1c, 0x00, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x14, 0x00, 0x2e, 0x00, 0x3d, 0x00, 0x4b, 0x00,
+  0x5b, 0x00, 0x69, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x2f, 0x00, 0x47, 0x00,
+  0x5d, 0x00, 0x76, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x2c, 0x00,
+  0x00, 0x00, 0x08, 0x00, 0x10, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x14, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00,
+  0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00,
+  0x1e, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x26, 0x00, 0x30, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x22, 0x00, 0x29, 0x00, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00,
+  0x0c, 0x00, 0x16, 0x00, 0x1c, 0x00, 0x22, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x0f, 0x00,
+  0x18, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x23, 0x00, 0x4d, 0x00,
+  0x56, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x00, 0x54, 0x00,
+  0x7f, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x1d, 0x00,
+  0x2f, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x2a, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x31, 0x00,
+  0x55, 0x00, 0x00, 0x00, 0x15, 0x00, 0x26, 0x00, 0x00, 0x00, 0x0f, 0x00,
+  0x2e, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x21, 0x00, 0x00, 0x00, 0x16, 0x00,
+  0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x18, 0x00,
+  0x00, 0x00, 0x13, 0x00, 0x32, 0x00, 0x48, 0x00, 0x66, 0x00, 0x98, 0x00,
+  0x00, 0x00, 0x20, 0x00, 0x38, 0x00, 0x4c, 0x00, 0x66, 0x00, 0x96, 0x00,
+  0xa0, 0x00, 0x00, 0x00, 0x21, 0x00, 0x34, 0x00, 0x48, 0x00, 0x67, 0x00,
+  0x00, 0x00, 0x15, 0x00, 0x2f, 0x00, 0x45, 0x00, 0x5a, 0x00, 0x67, 0x00,
+  0x00, 0x00, 0x1e, 0x00, 0x2d, 0x00, 0x3a, 0x00, 0x5c, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x26, 0x00, 0x3d, 0x00, 0x59, 0x00, 0x00, 0x00, 0x1a, 0x00,
+  0x37, 0x00, 0x51, 0x00, 0x71, 0x00, 0xa0, 0x00, 0xbf, 0x00, 0xc6, 0x00,
+  0xcd, 0x00, 0xd5, 0x00, 0x00, 0x00, 0x11, 0x00, 0x2f, 0x00, 0x3e, 0x00,
+  0x51, 0x00, 0x80, 0x00, 0x00, 0x00, 0x14, 0x00, 0x23, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x20, 0x00, 0x30, 0x00, 0x00, 0x00, 0x18, 0x00, 0x29, 0x00,
+  0x00, 0x00, 0x16, 0x00, 0x25, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x23, 0x00,
+  0x00, 0x00, 0x25, 0x00, 0x38, 0x00, 0x60, 0x00, 0x91, 0x00, 0xa5, 0x00,
+  0x00, 0x00, 0x13, 0x00, 0x25, 0x00, 0x39, 0x00, 0x46, 0x00, 0x00, 0x00,
+  0x16, 0x00, 0x22, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x2b, 0x00, 0x3f, 0x00,
+  0x57, 0x00, 0x00, 0x00, 0x15, 0x00, 0x24, 0x00, 0x41, 0x00, 0x59, 0x00,
+  0x77, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x39, 0x00, 0x46, 0x00, 0x59, 0x00,
+  0x6b, 0x00, 0x00, 0x00, 0x29, 0x00, 0x35, 0x00, 0x50, 0x00, 0x76, 0x00,
+  0x86, 0x00, 0x98, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x2e, 0x00, 0x48, 0x00,
+  0x61, 0x00, 0x73, 0x00, 0x94, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1d, 0x00,
+  0x2d, 0x00, 0x45, 0x00, 0x57, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x12, 0x00,
+  0x1e, 0x00, 0x2d, 0x00, 0x3d, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x20, 0x00,
+  0x31, 0x00, 0x47, 0x00, 0x62, 0x00, 0x82, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x23, 0x00, 0x3b, 0x00, 0x5a, 0x00, 0x74, 0x00, 0xa6, 0x00, 0xab, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x22, 0x00, 0x36, 0x00, 0x43, 0x00, 0x66, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x23, 0x00, 0x31, 0x00, 0x50, 0x00, 0x70, 0x00,
+  0x00, 0x00, 0x0b, 0x00, 0x1f, 0x00, 0x3b, 0x00, 0x48, 0x00, 0x5e, 0x00,
+  0x8f, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x5e, 0x00, 0x75, 0x00, 0x9a, 0x00,
+  0x00, 0x00, 0x2f, 0x00, 0x56, 0x00, 0x69, 0x00, 0x87, 0x00, 0xab, 0x00,
+  0xc5, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x22, 0x00, 0x3b, 0x00, 0x50, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x1d, 0x00, 0x38, 0x00, 0x5b, 0x00, 0x73, 0x00,
+  0x00, 0x00, 0x17, 0x00, 0x24, 0x00, 0x3d, 0x00, 0x4f, 0x00, 0x5e, 0x00,
+  0x7a, 0x00, 0x8c, 0x00, 0x9c, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x30, 0x00,
+  0x42, 0x00, 0x50, 0x00, 0x5d, 0x00, 0x6f, 0x00, 0x8f, 0x00, 0x00, 0x00,
+  0x18, 0x00, 0x34, 0x00, 0x52, 0x00, 0x70, 0x00, 0x95, 0x00, 0xaa, 0x00,
+  0xcd, 0x00, 0xf4, 0x00, 0x07, 0x01, 0x15, 0x01, 0x21, 0x01, 0x32, 0x01,
+  0x4e, 0x01, 0x66, 0x01, 0x00, 0x00, 0x25, 0x00, 0x4c, 0x00, 0x5a, 0x00,
+  0x66, 0x00, 0x7e, 0x00, 0x95, 0x00, 0xac, 0x00, 0xb8, 0x00, 0x00, 0x00,
+  0x18, 0x00, 0x31, 0x00, 0x4e, 0x00, 0x6b, 0x00, 0x8e, 0x00, 0xa2, 0x00,
+  0xc4, 0x00, 0xd5, 0x00, 0xeb, 0x00, 0x02, 0x01, 0x0f, 0x01, 0x2e, 0x01,
+  0x3a, 0x01, 0x5b, 0x01, 0x00, 0x00, 0x1d, 0x00, 0x34, 0x00, 0x44, 0x00,
+  0x5d, 0x00, 0x6f, 0x00, 0x84, 0x00, 0x95, 0x00, 0xa5, 0x00, 0xb2, 0x00,
+  0xc7, 0x00, 0xd9, 0x00, 0xdf, 0x00, 0x00, 0x00, 0x12, 0x00, 0x25, 0x00,
+  0x36, 0x00, 0x43, 0x00, 0x60, 0x00, 0x71, 0x00, 0x89, 0x00, 0x96, 0x00,
+  0xad, 0x00, 0xc2, 0x00, 0xc9, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x36, 0x00,
+  0x47, 0x00, 0x58, 0x00, 0x64, 0x00, 0x75, 0x00, 0x87, 0x00, 0xaa, 0x00,
+  0x00, 0x00, 0x1f, 0x00, 0x37, 0x00, 0x48, 0x00, 0x5b, 0x00, 0x74, 0x00,
+  0x8d, 0x00, 0x9c, 0x00, 0xa4, 0x00, 0xa9, 0x00, 0xb1, 0x00, 0x00, 0x00,
+  0x1d, 0x00, 0x2c, 0x00, 0x39, 0x00, 0x57, 0x00, 0x67, 0x00, 0x82, 0x00,
+  0x8f, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x22, 0x00, 0x30, 0x00, 0x3c, 0x00,
+  0x49, 0x00, 0x00, 0x00, 0x16, 0x00, 0x24, 0x00, 0x33, 0x00, 0x4a, 0x00,
+  0x64, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x20, 0x00, 0x2f, 0x00, 0x3c, 0x00,
+  0x49, 0x00, 0x5d, 0x00, 0x6a, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x2b, 0x00,
+  0x37, 0x00, 0x4f, 0x00, 0x66, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x14, 0x00,
+  0x26, 0x00, 0x37, 0x00, 0x4c, 0x00, 0x63, 0x00, 0x00, 0x00, 0x12, 0x00,
+  0x22, 0x00, 0x31, 0x00, 0x42, 0x00, 0x61, 0x00, 0x00, 0x00, 0x0d, 0x00,
+  0x31, 0x00, 0x42, 0x00, 0x50, 0x00, 0x5f, 0x00, 0x74, 0x00, 0x82, 0x00,
+  0x9c, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x52, 0x00, 0x6b, 0x00, 0x82, 0x00,
+  0xb2, 0x00, 0xca, 0x00, 0xe4, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x30, 0x00,
+  0x40, 0x00, 0x51, 0x00, 0x63, 0x00, 0x75, 0x00, 0x00, 0x00, 0x12, 0x00,
+  0x28, 0x00, 0x40, 0x00, 0x57, 0x00, 0x67, 0x00, 0x78, 0x00, 0x8d, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x2b, 0x00, 0x45, 0x00, 0x5c, 0x00, 0x6d, 0x00,
+  0x7a, 0x00, 0x9c, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x2d, 0x00, 0x42, 0x00,
+  0x59, 0x00, 0x6a, 0x00, 0x84, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x51, 0x00,
+  0x6b, 0x00, 0x81, 0x00, 0xaa, 0x00, 0xb8, 0x00, 0xda, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x2c, 0x00, 0x3f, 0x00, 0x53, 0x00, 0x7d, 0x00, 0x9b, 0x00,
+  0xb6, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x32, 0x00, 0x4b, 0x00, 0x60, 0x00,
+  0x73, 0x00, 0x82, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x35, 0x00, 0x4d, 0x00,
+  0x5b, 0x00, 0x6f, 0x00, 0x7e, 0x00, 0x91, 0x00, 0x97, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x37, 0x00, 0x52, 0x00, 0x61, 0x00, 0x6d, 0x00, 0x87, 0x00,
+  0x9c, 0x00, 0x00, 0x00, 0x16, 0x00, 0x26, 0x00, 0x3f, 0x00, 0x53, 0x00,
+  0x63, 0x00, 0x6f, 0x00, 0x00, 0x00, 0x19, 0x00, 0x2c, 0x00, 0x39, 0x00,
+  0x49, 0x00, 0x5c, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x16, 0x00, 0x26, 0x00,
+  0x35, 0x00, 0x41, 0x00, 0x50, 0x00, 0x6b, 0x00, 0x77, 0x00, 0x7f, 0x00,
+  0x93, 0x00, 0x00, 0x00, 0x25, 0x00, 0x42, 0x00, 0x5e, 0x00, 0x6c, 0x00,
+  0x80, 0x00, 0x90, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x44, 0x00,
+  0x54, 0x00, 0x75, 0x00, 0x81, 0x00, 0x8f, 0x00, 0xa7, 0x00, 0x00, 0x00,
+  0x2c, 0x00, 0x48, 0x00, 0x59, 0x00, 0x8b, 0x00, 0xa0, 0x00, 0xaf, 0x00,
+  0xc3, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x35, 0x00, 0x66, 0x00, 0x79, 0x00,
+  0x86, 0x00, 0x00, 0x00, 0x25, 0x00, 0x46, 0x00, 0x77, 0x00, 0x8d, 0x00,
+  0xb2, 0x00, 0xd8, 0x00, 0xfc, 0x00, 0x1e, 0x01, 0x42, 0x01, 0x59, 0x01,
+  0x71, 0x01, 0x98, 0x01, 0xb3, 0x01, 0xca, 0x01, 0xda, 0x01, 0x00, 0x00,
+  0x17, 0x00, 0x27, 0x00, 0x43, 0x00, 0x52, 0x00, 0x68, 0x00, 0x00, 0x00,
+  0x24, 0x00, 0x44, 0x00, 0x74, 0x00, 0x8c, 0x00, 0xb0, 0x00, 0xd6, 0x00,
+  0xf9, 0x00, 0x1b, 0x01, 0x3d, 0x01, 0x54, 0x01, 0x6e, 0x01, 0x82, 0x01,
+  0x93, 0x01, 0xa9, 0x01, 0xcb, 0x01, 0x00, 0x00, 0x1d, 0x00, 0x36, 0x00,
+  0x4b, 0x00, 0x62, 0x00, 0x6f, 0x00, 0x80, 0x00, 0x00, 0x00, 0x18, 0x00,
+  0x25, 0x00, 0x55, 0x00, 0x60, 0x00, 0x79, 0x00, 0x8c, 0x00, 0x96, 0x00,
+  0x00, 0x00, 0x19, 0x00, 0x38, 0x00, 0x69, 0x00, 0x79, 0x00, 0x90, 0x00,
+  0xa7, 0x00, 0xad, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x34, 0x00, 0x4e, 0x00,
+  0x66, 0x00, 0x79, 0x00, 0x9f, 0x00, 0xaf, 0x00, 0xbf, 0x00, 0xcc, 0x00,
+  0x00, 0x00, 0x17, 0x00, 0x2e, 0x00, 0x3e, 0x00, 0x4c, 0x00, 0x62, 0x00,
+  0x7d, 0x00, 0x96, 0x00, 0xa4, 0x00, 0xb9, 0x00, 0x00, 0x00, 0x16, 0x00,
+  0x28, 0x00, 0x35, 0x00, 0x4b, 0x00, 0x66, 0x00, 0x73, 0x00, 0x00, 0x00,
+  0x15, 0x00, 0x31, 0x00, 0x4c, 0x00, 0x5e, 0x00, 0x75, 0x00, 0x85, 0x00,
+  0x9f, 0x00, 0xa7, 0x00, 0x00, 0x00, 0x19, 0x00, 0x35, 0x00, 0x44, 0x00,
+  0x5e, 0x00, 0x6f, 0x00, 0x81, 0x00, 0x98, 0x00, 0x9f, 0x00, 0x00, 0x00,
+  0x18, 0x00, 0x3b, 0x00, 0x4a, 0x00, 0x61, 0x00, 0x72, 0x00, 0x88, 0x00,
+  0x97, 0x00, 0x00, 0x00, 0x18, 0x00, 0x2e, 0x00, 0x43, 0x00, 0x67, 0x00,
+  0x7c, 0x00, 0x92, 0x00, 0xa2, 0x00, 0xb8, 0x00, 0xc8, 0x00, 0x00, 0x00,
+  0x16, 0x00, 0x34, 0x00, 0x5a, 0x00, 0x73, 0x00, 0x88, 0x00, 0x9b, 0x00,
+  0xb5, 0x00, 0xbd, 0x00, 0x00, 0x00, 0x20, 0x00, 0x43, 0x00, 0x52, 0x00,
+  0x5f, 0x00, 0x73, 0x00, 0x00, 0x00, 0x13, 0x00, 0x31, 0x00, 0x3f, 0x00,
+  0x51, 0x00, 0x66, 0x00, 0x71, 0x00, 0x00, 0x00, 0x15, 0x00, 0x3c, 0x00,
+  0x58, 0x00, 0x6b, 0x00, 0x82, 0x00, 0x8c, 0x00, 0x00, 0x00, 0x14, 0x00,
+  0x23, 0x00, 0x50, 0x00, 0x6d, 0x00, 0x8d, 0x00, 0xa1, 0x00, 0xb7, 0x00,
+  0xd1, 0x00, 0xdb, 0x00, 0x00, 0x00, 0x21, 0x00, 0x40, 0x00, 0x4d, 0x00,
+  0x69, 0x00, 0x82, 0x00, 0xa7, 0x00, 0x00, 0x00, 0x19, 0x00, 0x55, 0x00,
+  0x6b, 0x00, 0x89, 0x00, 0xa4, 0x00, 0xb9, 0x00, 0x00, 0x00, 0x1d, 0x00,
+  0x42, 0x00, 0x57, 0x00, 0x70, 0x00, 0x7d, 0x00, 0x95, 0x00, 0x00, 0x00,
+  0x1a, 0x00, 0x30, 0x00, 0x6c, 0x00, 0x81, 0x00, 0x97, 0x00, 0xaa, 0x00,
+  0x00, 0x00, 0x16, 0x00, 0x34, 0x00, 0x4d, 0x00, 0x68, 0x00, 0x88, 0x00,
+  0xa3, 0x00, 0xb3, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x39, 0x00, 0x4b, 0x00,
+  0x66, 0x00, 0x86, 0x00, 0xac, 0x00, 0xbb, 0x00, 0x00, 0x00, 0x1d, 0x00,
+  0x34, 0x00, 0x50, 0x00, 0x71, 0x00, 0x8b, 0x00, 0x9e, 0x00, 0x00, 0x00,
+  0x22, 0x00, 0x3b, 0x00, 0x4c, 0x00, 0x5a, 0x00, 0x6b, 0x00, 0x00, 0x00,
+  0x1a, 0x00, 0x33, 0x00, 0x49, 0x00, 0x5b, 0x00, 0x6e, 0x00, 0x7f, 0x00,
+  0x00, 0x00, 0x2a, 0x00, 0x48, 0x00, 0x67, 0x00, 0x87, 0x00, 0x9a, 0x00,
+  0xb2, 0x00, 0x00, 0x00, 0x25, 0x00, 0x37, 0x00, 0x56, 0x00, 0x76, 0x00,
+  0x99, 0x00, 0xae, 0x00, 0x00, 0x00, 0x23, 0x00, 0x2e, 0x00, 0x48, 0x00,
+  0x69, 0x00, 0x8d, 0x00, 0xa3, 0x00, 0x00, 0x00, 0x19, 0x00, 0x32, 0x00,
+  0x56, 0x00, 0x76, 0x00, 0x00, 0x00, 0x13, 0x00, 0x28, 0x00, 0x3e, 0x00,
+  0x00, 0x00, 0x13, 0x00, 0x2e, 0x00, 0x41, 0x00, 0x00, 0x00, 0x0f, 0x00,
+  0x25, 0x00, 0x4d, 0x00, 0x65, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x1a, 0x00,
+  0x36, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x13, 0x00, 0x23, 0x00, 0x39, 0x00,
+  0x54, 0x00, 0x00, 0x00, 0x17, 0x00, 0x45, 0x00, 0x5a, 0x00, 0x6c, 0x00,
+  0x7e, 0x00, 0x00, 0x00, 0x17, 0x00, 0x2b, 0x00, 0x48, 0x00, 0x5b, 0x00,
+  0x70, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x2b, 0x00, 0x43, 0x00, 0x4e, 0x00,
+  0x5d, 0x00, 0x71, 0x00, 0x00, 0x00, 0x15, 0x00, 0x40, 0x00, 0x56, 0x00,
+  0x67, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x2a, 0x00, 0x38, 0x00, 0x55, 0x00,
+  0x8d, 0x00, 0x95, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x3a, 0x00, 0x54, 0x00,
+  0x62, 0x00, 0x00, 0x00, 0x16, 0x00, 0x27, 0x00, 0x51, 0x00, 0x68, 0x00,
+  0x00, 0x00, 0x28, 0x00, 0x3d, 0x00, 0x53, 0x00, 0x00, 0x00, 0x1c, 0x00,
+  0x48, 0x00, 0x5a, 0x00, 0x6b, 0x00, 0x7c, 0x00, 0x82, 0x00, 0x8a, 0x00,
+  0x00, 0x00, 0x1d, 0x00, 0x43, 0x00, 0x69, 0x00, 0x7b, 0x00, 0x8c, 0x00,
+  0x00, 0x00, 0x1a, 0x00, 0x32, 0x00, 0x45, 0x00, 0x55, 0x00, 0x00, 0x00,
+  0x1f, 0x00, 0x34, 0x00, 0x4a, 0x00, 0x5d, 0x00, 0x68, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x45, 0x00, 0x5c, 0x00, 0x6d, 0x00, 0x00, 0x00, 0x18, 0x00,
+  0x2d, 0x00, 0x42, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x2b, 0x00,
+  0x49, 0x00, 0x54, 0x00, 0x00, 0x00, 0x23, 0x00, 0x49, 0x00, 0x5f, 0x00,
+  0x00, 0x00, 0x3a, 0x00, 0x4c, 0x00, 0x70, 0x00, 0x8a, 0x00, 0x90, 0x00,
+  0x9b, 0x00, 0xa5, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x66, 0x00, 0x86, 0x00,
+  0x9c, 0x00, 0xa7, 0x00, 0xb1, 0x00, 0x00, 0x00, 0x17, 0x00, 0x35, 0x00,
+  0x62, 0x00, 0x8b, 0x00, 0x91, 0x00, 0x9c, 0x00, 0xa6, 0x00, 0x00, 0x00,
+  0x19, 0x00, 0x29, 0x00, 0x5a, 0x00, 0x85, 0x00, 0x8c, 0x00, 0x98, 0x00,
+  0xa3, 0x00, 0x00, 0x00, 0x11, 0x00, 0x20, 0x00, 0x51, 0x00, 0x68, 0x00,
+  0x76, 0x00, 0x83, 0x00, 0x00, 0x00, 0x17, 0x00, 0x2e, 0x00, 0x4b, 0x00,
+  0x63, 0x00, 0x74, 0x00, 0x8e, 0x00, 0x99, 0x00, 0xa3, 0x00, 0x00, 0x00,
+  0x18, 0x00, 0x33, 0x00, 0x3f, 0x00, 0x46, 0x00, 0x51, 0x00, 0x5b, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x28, 0x00, 0x2e, 0x00, 0x3a, 0x00, 0x4c, 0x00,
+  0x57, 0x00, 0x00, 0x00, 0x21, 0x00, 0x54, 0x00, 0x66, 0x00, 0x6c, 0x00,
+  0x72, 0x00, 0x00, 0x00, 0x10, 0x00, 0x3f, 0x00, 0x53, 0x00, 0x00, 0x00,
+  0x21, 0x00, 0x37, 0x00, 0x4d, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x23, 0x00, 0x36, 0x00, 0x43, 0x00, 0x00, 0x00, 0x18, 0x00, 0x2e, 0x00,
+  0x4d, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x50, 0x00, 0x59, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x32, 0x00, 0x43, 0x00, 0x00, 0x00,
+  0x1e, 0x00, 0x34, 0x00, 0x00, 0x00, 0x21, 0x00, 0x32, 0x00, 0x00, 0x00,
+  0x18, 0x00, 0x33, 0x00, 0x48, 0x00, 0x00, 0x00, 0x17, 0x00, 0x32, 0x00,
+  0x47, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x18, 0x00,
+  0x30, 0x00, 0x48, 0x00, 0x60, 0x00, 0x78, 0x00, 0x90, 0x00, 0xa8, 0x00,
+  0xc0, 0x00, 0xd8, 0x00, 0xfe, 0x00, 0x23, 0x01, 0x00, 0x00, 0x17, 0x00,
+  0x00, 0x00, 0x19, 0x00, 0x36, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x12, 0x00,
+  0x31, 0x00, 0x52, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x2a, 0x00,
+  0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x30, 0x00,
+  0x4c, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x35, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00,
+  0x2a, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x1e, 0x00,
+  0x00, 0x00, 0x11, 0x00, 0x36, 0x00, 0x00, 0x00, 0x12, 0x00, 0x33, 0x00,
+  0x4f, 0x00, 0x55, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x2a, 0x00, 0x48, 0x00,
+  0x00, 0x00, 0x13, 0x00, 0x2e, 0x00, 0x6b, 0x00, 0x73, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00,
+  0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x33, 0x00,
+  0x00, 0x00, 0x1b, 0x00, 0x34, 0x00, 0x00, 0x00, 0x19, 0x00, 0x31, 0x00,
+  0x49, 0x00, 0x61, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x00,
+  0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x1b, 0x00,
+  0x2b, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x40, 0x00,
+  0x00, 0x00, 0x20, 0x00, 0x36, 0x00, 0x3c, 0x00, 0x42, 0x00, 0x00, 0x00,
+  0x1a, 0x00, 0x48, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x39, 0x00, 0x47, 0x00,
+  0x00, 0x00, 0x23, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x38, 0x00,
+  0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x34, 0x00,
+  0x4e, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x4f, 0x00, 0x69, 0x00,
+  0x78, 0x00, 0x8c, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x46, 0x00, 0x63, 0x00,
+  0x74, 0x00, 0x7f, 0x00, 0x99, 0x00, 0xaa, 0x00, 0xbe, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x39, 0x00, 0x4d, 0x00, 0x65, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x27, 0x00, 0x55, 0x00, 0x5e, 0x00, 0x00, 0x00, 0x29, 0x00, 0x3c, 0x00,
+  0x4c, 0x00, 0x67, 0x00, 0x00, 0x00, 0x18, 0x00, 0x25, 0x00, 0x36, 0x00,
+  0x4a, 0x00, 0x57, 0x00, 0x61, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x22, 0x00,
+  0x00, 0x00, 0x18, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1a, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x30, 0x00,
+  0x3f, 0x00, 0x00, 0x00, 0x25, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x16, 0x00,
+  0x00, 0x00, 0x1b, 0x00, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x1d, 0x00, 0x2d, 0x00, 0x50, 0x00, 0x00, 0x00,
+  0x1a, 0x00, 0x26, 0x00, 0x35, 0x00, 0x46, 0x00, 0x56, 0x00, 0x68, 0x00,
+  0x7c, 0x00, 0x91, 0x00, 0x97, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x1c, 0x00,
+  0x31, 0x00, 0x00, 0x00, 0x16, 0x00, 0x33, 0x00, 0x42, 0x00, 0x55, 0x00,
+  0x00, 0x00, 0x1e, 0x00, 0x2d, 0x00, 0x3d, 0x00, 0x4d, 0x00, 0x00, 0x00,
+  0x1f, 0x00, 0x3e, 0x00, 0x4c, 0x00, 0x5f, 0x00, 0x74, 0x00, 0x00, 0x00,
+  0x1e, 0x00, 0x36, 0x00, 0x51, 0x00, 0x5d, 0x00, 0x6e, 0x00, 0x7b, 0x00,
+  0x91, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x3b, 0x00, 0x63, 0x00, 0x88, 0x00,
+  0x9c, 0x00, 0xa8, 0x00, 0xbe, 0x00, 0x00, 0x00, 0x25, 0x00, 0x53, 0x00,
+  0x6f, 0x00, 0x7f, 0x00, 0x97, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x38, 0x00,
+  0x53, 0x00, 0x61, 0x00, 0x75, 0x00, 0x87, 0x00, 0x9f, 0x00, 0xa7, 0x00,
+  0x00, 0x00, 0x1c, 0x00, 0x40, 0x00, 0x54, 0x00, 0x61, 0x00, 0x81, 0x00,
+  0x95, 0x00, 0xaf, 0x00, 0x00, 0x00, 0x19, 0x00, 0x44, 0x00, 0x5b, 0x00,
+  0x6a, 0x00, 0x83, 0x00, 0x00, 0x00, 0x24, 0x00, 0x42, 0x00, 0x5f, 0x00,
+  0x7c, 0x00, 0x8e, 0x00, 0xa1, 0x00, 0xb1, 0x00, 0x00, 0x00, 0x29, 0x00,
+  0x43, 0x00, 0x6c, 0x00, 0x8a, 0x00, 0x9a, 0x00, 0xaa, 0x00, 0xc4, 0x00,
+  0x00, 0x00, 0x1a, 0x00, 0x37, 0x00, 0x5a, 0x00, 0x74, 0x00, 0x83, 0x00,
+  0x97, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x3d, 0x00, 0x5a, 0x00, 0x73, 0x00,
+  0x82, 0x00, 0x9f, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x3b, 0x00, 0x56, 0x00,
+  0x70, 0x00, 0x84, 0x00, 0x94, 0x00, 0x00, 0x00, 0x33, 0x00, 0x4e, 0x00,
+  0x6a, 0x00, 0x87, 0x00, 0x97, 0x00, 0xa5, 0x00, 0xbb, 0x00, 0x00, 0x00,
+  0x1d, 0x00, 0x37, 0x00, 0x4d, 0x00, 0x5b, 0x00, 0x76, 0x00, 0x00, 0x00,
+  0x42, 0x00, 0x5d, 0x00, 0x7b, 0x00, 0x8a, 0x00, 0x99, 0x00, 0xb4, 0x00,
+  0xbd, 0x00, 0x00, 0x00, 0x20, 0x00, 0x3e, 0x00, 0x60, 0x00, 0x74, 0x00,
+  0x89, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x2f, 0x00, 0x4b, 0x00, 0x00, 0x00,
+  0x21, 0x00, 0x30, 0x00, 0x46, 0x00, 0x00, 0x00, 0x19, 0x00, 0x24, 0x00,
+  0x41, 0x00, 0x50, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1f, 0x00, 0x35, 0x00,
+  0x00, 0x00, 0x1d, 0x00, 0x3c, 0x00, 0x52, 0x00, 0x5f, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x35, 0x00, 0x51, 0x00, 0x66, 0x00, 0x72, 0x00, 0x00, 0x00,
+  0x30, 0x00, 0x4b, 0x00, 0x68, 0x00, 0x79, 0x00, 0x89, 0x00, 0xb6, 0x00,
+  0x00, 0x00, 0x22, 0x00, 0x3f, 0x00, 0x57, 0x00, 0x62, 0x00, 0x00, 0x00,
+  0x1a, 0x00, 0x35, 0x00, 0x5f, 0x00, 0x6d, 0x00, 0x7b, 0x00, 0x8e, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x1e, 0x00, 0x36, 0x00, 0x54, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x1f, 0x00, 0x35, 0x00, 0x00, 0x00, 0x16, 0x00, 0x28, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x23, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x34, 0x00, 0x4f, 0x00, 0x5b, 0x00,
+  0x00, 0x00, 0x1a, 0x00, 0x37, 0x00, 0x45, 0x00, 0x52, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x2c, 0x00, 0x00, 0x00,
+  0x1f, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x3b, 0x00, 0x4b, 0x00, 0x5d, 0x00,
+  0x00, 0x00, 0x1f, 0x00, 0x31, 0x00, 0x00, 0x00, 0x18, 0x00, 0x2a, 0x00,
+  0x00, 0x00, 0x1c, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x3b, 0x00,
+  0x00, 0x00, 0x1b, 0x00, 0x2c, 0x00, 0x48, 0x00, 0x00, 0x00, 0x1e, 0x00,
+  0x3d, 0x00, 0x5a, 0x00, 0x70, 0x00, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1b, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x00,
+  0x35, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x34, 0x00, 0x54, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x22, 0x00, 0x3d, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x1d, 0x00,
+  0x00, 0x00, 0x19, 0x00, 0x31, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x38, 0x00,
+  0x00, 0x00, 0x40, 0x00, 0x60, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x11, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x77, 0x00,
+  0xb5, 0x00, 0x00, 0x00, 0x39, 0x00, 0x70, 0x00, 0xaa, 0x00, 0xe2, 0x00,
+  0x1e, 0x01, 0x59, 0x01, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00
+};
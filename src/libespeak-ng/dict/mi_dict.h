@@ -1,5 +1,7 @@
 #pragma once
-const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
+#include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/mi_dict_index.h>
+const unsigned char __espeakng_dict_mi[] __attribute__((aligned((4)))) = {
   0x00, 0x04, 0x00, 0x00, 0x97, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -114,4 +116,11 @@ const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
   0x00, 0x07, 0x06, 0x77, 0x00, 0x03, 0x3a, 0x00, 0x68, 0x03, 0x54, 0x00,
   0x07, 0x00
 };
-size_t __espeakng_dictlen = 1346;
+
+BackgroundAudioDictionary dict_mi = {
+    "mi",
+    1346,
+    __espeakng_dict_mi,
+    2110,
+    __espeakng_dictindex_mi
+};
@@ -1,5 +1,7 @@
 #pragma once
-const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
+#include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/ml_dict_index.h>
+const unsigned char __espeakng_dict_ml[] __attribute__((aligned((4)))) = {
   0x00, 0x04, 0x00, 0x00, 0x37, 0x64, 0x01, 0x00, 0x00, 0x9a, 0x19, 0xf0,
   0x9f, 0x91, 0xa9, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xe2, 0x80,
   0x8d, 0xf0, 0x9f, 0x91, 0xa7, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa7,
@@ -7697,4 +7699,11 @@ const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
   0x20, 0x03, 0x94, 0x00, 0x07, 0x06, 0x00, 0x24, 0x03, 0x49, 0x77, 0x3e,
   0x23, 0x22, 0x00, 0x07, 0x00
 };
-size_t __espeakng_dictlen = 92345;
+
+BackgroundAudioDictionary dict_ml = {
+    "ml",
+    92345,
+    __espeakng_dict_ml,
+    7480,
+    __espeakng_dictindex_ml
+};
@@ -1,5 +1,7 @@
 #pragma once
-const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
+#include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/mr_dict_index.h>
+const unsigned char __espeakng_dict_mr[] __attribute__((aligned((4)))) = {
   0x00, 0x04, 0x00, 0x00, 0x04, 0x4b, 0x01, 0x00, 0x00, 0x73, 0x19, 0xf0,
   0x9f, 0x91, 0xa9, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xe2, 0x80,
   0x8d, 0xf0, 0x9f, 0x91, 0xa7, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa7,
@@ -7284,4 +7286,11 @@ const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
   0x76, 0x45, 0x31, 0x6d, 0x32, 0x00, 0x3d, 0x03, 0x48, 0x6d, 0x22, 0x06,
   0x76, 0x48, 0x6d, 0x22, 0x00, 0x07, 0x00
 };
-size_t __espeakng_dictlen = 87391;
+
+BackgroundAudioDictionary dict_mr = {
+    "mr",
+    87391,
+    __espeakng_dict_mr,
+    7690,
+    __espeakng_dictindex_mr
+};
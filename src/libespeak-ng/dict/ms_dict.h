@@ -1,5 +1,7 @@
 #pragma once
-const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
+#include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/ms_dict_index.h>
+const unsigned char __espeakng_dict_ms[] __attribute__((aligned((4)))) = {
   0x00, 0x04, 0x00, 0x00, 0x29, 0xcd, 0x00, 0x00, 0x00, 0x60, 0x19, 0xf0,
   0x9f, 0x91, 0xa9, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xe2, 0x80,
   0x8d, 0xf0, 0x9f, 0x91, 0xa7, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa7,
@@ -4463,4 +4465,11 @@ const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
   0x00, 0x2a, 0x03, 0x48, 0x06, 0x25, 0x32, 0x2f, 0x23, 0x45, 0x00, 0x24,
   0x03, 0x49, 0x6e, 0x37, 0x0d, 0x33, 0x00, 0x07, 0x00
 };
-size_t __espeakng_dictlen = 53541;
+
+BackgroundAudioDictionary dict_ms = {
+    "ms",
+    53541,
+    __espeakng_dict_ms,
+    9094,
+    __espeakng_dictindex_ms
+};
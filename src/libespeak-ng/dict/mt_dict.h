@@ -1,5 +1,7 @@
 #pragma once
-const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
+#include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/mt_dict_index.h>
+const unsigned char __espeakng_dict_mt[] __attribute__((aligned((4)))) = {
   0x00, 0x04, 0x00, 0x00, 0xba, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x05, 0x41, 0x04, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x08,
   0x74, 0x61, 0x67, 0xc4, 0xa7, 0x6b, 0x6f, 0x6d, 0x2f, 0x23, 0x31, 0x27,
@@ -367,4 +369,11 @@ const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
   0x00, 0xc4, 0x8b, 0x03, 0x4d, 0x0d, 0x00, 0xc5, 0xbc, 0x03, 0x59, 0x06,
   0x0d, 0x00, 0x07, 0x00
 };
-size_t __espeakng_dictlen = 4384;
+
+BackgroundAudioDictionary dict_mt = {
+    "mt",
+    4384,
+    __espeakng_dict_mt,
+    2764,
+    __espeakng_dictindex_mt
+};
@@ -1,5 +1,7 @@
 #pragma once
-const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
+#include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/mto_dict_index.h>
+const unsigned char __espeakng_dict_mto[] __attribute__((aligned((4)))) = {
   0x00, 0x04, 0x00, 0x00, 0xec, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x0c, 0x44, 0x05, 0x04, 0x0c, 0x14, 0x06, 0x23, 0x30, 0x0d,
   0x37, 0x00, 0x00, 0x0d, 0x45, 0x25, 0x02, 0x0f, 0x38, 0x50, 0x06, 0x75,
@@ -331,4 +333,11 @@ const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
   0x43, 0x00, 0x03, 0x5e, 0x00, 0x04, 0x01, 0x6a, 0x03, 0x5e, 0x39, 0x00,
   0x02, 0x6a, 0x00, 0x07, 0x06, 0x79, 0x00, 0x03, 0x39, 0x00, 0x07, 0x00
 };
-size_t __espeakng_dictlen = 3960;
+
+BackgroundAudioDictionary dict_mto = {
+    "mto",
+    3960,
+    __espeakng_dict_mto,
+    2624,
+    __espeakng_dictindex_mto
+};
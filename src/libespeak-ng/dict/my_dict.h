@@ -1,5 +1,7 @@
 #pragma once
-const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
+#include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/my_dict_index.h>
+const unsigned char __espeakng_dict_my[] __attribute__((aligned((4)))) = {
   0x00, 0x04, 0x00, 0x00, 0xe2, 0x74, 0x01, 0x00, 0x00, 0xb8, 0x19, 0xf0,
   0x9f, 0x91, 0xa9, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xe2, 0x80,
   0x8d, 0xf0, 0x9f, 0x91, 0xa7, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa7,
@@ -7997,4 +7999,11 @@ const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
   0x00, 0xbf, 0x03, 0x5a, 0x00, 0xa6, 0x03, 0x28, 0x00, 0xa5, 0x03, 0x28,
   0x0c, 0x00, 0xb2, 0x03, 0x23, 0x00, 0x07, 0x00
 };
-size_t __espeakng_dictlen = 95948;
+
+BackgroundAudioDictionary dict_my = {
+    "my",
+    95948,
+    __espeakng_dict_my,
+    7034,
+    __espeakng_dictindex_my
+};
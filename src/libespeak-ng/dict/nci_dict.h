@@ -1,5 +1,7 @@
 #pragma once
-const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
+#include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/nci_dict_index.h>
+const unsigned char __espeakng_dict_nci[] __attribute__((aligned((4)))) = {
   0x00, 0x04, 0x00, 0x00, 0xfb, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -129,4 +131,11 @@ const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
   0x66, 0x03, 0x54, 0x00, 0x76, 0x03, 0x55, 0x00, 0x04, 0x73, 0x03, 0x5a,
   0x00, 0xc3, 0xa7, 0x00, 0x6a, 0x03, 0x66, 0x00, 0x07, 0x00
 };
-size_t __espeakng_dictlen = 1534;
+
+BackgroundAudioDictionary dict_nci = {
+    "nci",
+    1534,
+    __espeakng_dict_nci,
+    2116,
+    __espeakng_dictindex_nci
+};
@@ -1,5 +1,7 @@
 #pragma once
-const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
+#include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/ne_dict_index.h>
+const unsigned char __espeakng_dict_ne[] __attribute__((aligned((4)))) = {
   0x00, 0x04, 0x00, 0x00, 0x62, 0x54, 0x01, 0x00, 0x00, 0x89, 0x19, 0xf0,
   0x9f, 0x91, 0xa9, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xe2, 0x80,
   0x8d, 0xf0, 0x9f, 0x91, 0xa7, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa7,
@@ -7950,4 +7952,11 @@ const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
   0x0d, 0x43, 0x0d, 0x76, 0x22, 0x06, 0x6d, 0x42, 0x89, 0x0d, 0x00, 0x07,
   0x00
 };
-size_t __espeakng_dictlen = 95377;
+
+BackgroundAudioDictionary dict_ne = {
+    "ne",
+    95377,
+    __espeakng_dict_ne,
+    7564,
+    __espeakng_dictindex_ne
+};
@@ -1,5 +1,7 @@
 #pragma once
-const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
+#include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/nl_dict_index.h>
+const unsigned char __espeakng_dict_nl[] __attribute__((aligned((4)))) = {
   0x00, 0x04, 0x00, 0x00, 0x3b, 0xdc, 0x00, 0x00, 0x00, 0x3c, 0x19, 0xf0,
   0x9f, 0x91, 0xa9, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xe2, 0x80,
   0x8d, 0xf0, 0x9f, 0x91, 0xa7, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa7,
@@ -5451,4 +5453,11 @@ const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
   0x0e, 0x80, 0x80, 0x82, 0x03, 0x5a, 0x00, 0x04, 0xc3, 0xa9, 0x03, 0x77,
   0x00, 0xc3, 0xa9, 0xc3, 0xa9, 0x00, 0x07, 0x00
 };
-size_t __espeakng_dictlen = 65396;
+
+BackgroundAudioDictionary dict_nl = {
+    "nl",
+    65396,
+    __espeakng_dict_nl,
+    12530,
+    __espeakng_dictindex_nl
+};
@@ -0,0 +1,1048 @@
+#pragma once
+const unsigned char __espeakng_dictindex_nl[] __attribute__((aligned((4)))) = {
+  0x45, 0x44, 0x58, 0x31, 0x74, 0xff, 0x00, 0x00, 0x3b, 0xdc, 0x00, 0x00,
+  0x9f, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0a, 0x00,
+  0x0b, 0x00, 0x0b, 0x00, 0x0b, 0x00, 0x0b, 0x00, 0x0d, 0x00, 0x0e, 0x00,
+  0x0f, 0x00, 0x10, 0x00, 0x11, 0x00, 0x11, 0x00, 0x12, 0x00, 0x12, 0x00,
+  0x14, 0x00, 0x14, 0x00, 0x15, 0x00, 0x16, 0x00, 0x1b, 0x00, 0x1c, 0x00,
+  0x1e, 0x00, 0x22, 0x00, 0x24, 0x00, 0x24, 0x00, 0x25, 0x00, 0x25, 0x00,
+  0x26, 0x00, 0x2a, 0x00, 0x2c, 0x00, 0x2c, 0x00, 0x2e, 0x00, 0x2e, 0x00,
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x31, 0x00, 0x34, 0x00, 0x36, 0x00,
+  0x37, 0x00, 0x37, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x40, 0x00, 0x43, 0x00,
+  0x47, 0x00, 0x4b, 0x00, 0x4d, 0x00, 0x4e, 0x00, 0x51, 0x00, 0x53, 0x00,
+  0x54, 0x00, 0x54, 0x00, 0x55, 0x00, 0x57, 0x00, 0x57, 0x00, 0x57, 0x00,
+  0x5a, 0x00, 0x5b, 0x00, 0x5d, 0x00, 0x60, 0x00, 0x62, 0x00, 0x65, 0x00,
+  0x67, 0x00, 0x68, 0x00, 0x6b, 0x00, 0x6b, 0x00, 0x6c, 0x00, 0x6c, 0x00,
+  0x6e, 0x00, 0x6e, 0x00, 0x6f, 0x00, 0x6f, 0x00, 0x72, 0x00, 0x7b, 0x00,
+  0x7c, 0x00, 0x84, 0x00, 0x87, 0x00, 0x8a, 0x00, 0x8a, 0x00, 0x8b, 0x00,
+  0x8d, 0x00, 0x8e, 0x00, 0x8e, 0x00, 0x8e, 0x00, 0x92, 0x00, 0x94, 0x00,
+  0x94, 0x00, 0x96, 0x00, 0x9a, 0x00, 0xa3, 0x00, 0xa4, 0x00, 0xac, 0x00,
+  0xb3, 0x00, 0xb4, 0x00, 0xb5, 0x00, 0xb6, 0x00, 0xb9, 0x00, 0xba, 0x00,
+  0xba, 0x00, 0xba, 0x00, 0xbb, 0x00, 0xbb, 0x00, 0xbb, 0x00, 0xc0, 0x00,
+  0xc2, 0x00, 0xcb, 0x00, 0xd0, 0x00, 0xd9, 0x00, 0xdc, 0x00, 0xe1, 0x00,
+  0xe4, 0x00, 0xe7, 0x00, 0xe8, 0x00, 0xeb, 0x00, 0xec, 0x00, 0xee, 0x00,
+  0xf0, 0x00, 0xf1, 0x00, 0xf4, 0x00, 0xfb, 0x00, 0x0a, 0x01, 0x0e, 0x01,
+  0x14, 0x01, 0x1d, 0x01, 0x21, 0x01, 0x25, 0x01, 0x28, 0x01, 0x2d, 0x01,
+  0x2d, 0x01, 0x34, 0x01, 0x35, 0x01, 0x36, 0x01, 0x37, 0x01, 0x37, 0x01,
+  0x38, 0x01, 0x3a, 0x01, 0x3b, 0x01, 0x3e, 0x01, 0x41, 0x01, 0x45, 0x01,
+  0x49, 0x01, 0x4c, 0x01, 0x50, 0x01, 0x52, 0x01, 0x53, 0x01, 0x5b, 0x01,
+  0x5f, 0x01, 0x63, 0x01, 0x66, 0x01, 0x69, 0x01, 0x6e, 0x01, 0x78, 0x01,
+  0xa8, 0x01, 0xab, 0x01, 0xb2, 0x01, 0xb8, 0x01, 0xb9, 0x01, 0xc2, 0x01,
+  0xc5, 0x01, 0xc7, 0x01, 0xc8, 0x01, 0xd3, 0x01, 0xd6, 0x01, 0xd7, 0x01,
+  0xd7, 0x01, 0xd8, 0x01, 0xda, 0x01, 0xdf, 0x01, 0xe0, 0x01, 0xe1, 0x01,
+  0xe2, 0x01, 0xe3, 0x01, 0xe4, 0x01, 0xe6, 0x01, 0xe6, 0x01, 0xe8, 0x01,
+  0xea, 0x01, 0xef, 0x01, 0xf0, 0x01, 0xf1, 0x01, 0xf2, 0x01, 0xf6, 0x01,
+  0xf7, 0x01, 0x01, 0x02, 0x1a, 0x02, 0x1b, 0x02, 0x1b, 0x02, 0x23, 0x02,
+  0x23, 0x02, 0x24, 0x02, 0x26, 0x02, 0x26, 0x02, 0x26, 0x02, 0x2c, 0x02,
+  0x2c, 0x02, 0x2c, 0x02, 0x2c, 0x02, 0x2c, 0x02, 0x2d, 0x02, 0x2f, 0x02,
+  0x30, 0x02, 0x32, 0x02, 0x33, 0x02, 0x33, 0x02, 0x33, 0x02, 0x33, 0x02,
+  0x33, 0x02, 0x33, 0x02, 0x34, 0x02, 0x37, 0x02, 0x37, 0x02, 0x38, 0x02,
+  0x39, 0x02, 0x3c, 0x02, 0x3d, 0x02, 0x41, 0x02, 0x42, 0x02, 0x43, 0x02,
+  0x43, 0x02, 0x57, 0x02, 0x57, 0x02, 0x57, 0x02, 0x57, 0x02, 0x57, 0x02,
+  0x57, 0x02, 0x58, 0x02, 0x58, 0x02, 0x58, 0x02, 0x58, 0x02, 0x58, 0x02,
+  0x59, 0x02, 0x5a, 0x02, 0x5a, 0x02, 0x5e, 0x02, 0x5f, 0x02, 0x5f, 0x02,
+  0x5f, 0x02, 0x60, 0x02, 0x61, 0x02, 0x62, 0x02, 0x62, 0x02, 0x62, 0x02,
+  0x64, 0x02, 0x65, 0x02, 0x65, 0x02, 0x68, 0x02, 0x69, 0x02, 0x6e, 0x02,
+  0x6e, 0x02, 0x70, 0x02, 0x73, 0x02, 0x80, 0x02, 0x80, 0x02, 0x81, 0x02,
+  0x82, 0x02, 0x82, 0x02, 0x82, 0x02, 0x83, 0x02, 0x84, 0x02, 0x85, 0x02,
+  0x88, 0x02, 0x8a, 0x02, 0x8b, 0x02, 0x8c, 0x02, 0x8d, 0x02, 0x8f, 0x02,
+  0x8f, 0x02, 0x90, 0x02, 0x91, 0x02, 0x94, 0x02, 0x94, 0x02, 0x95, 0x02,
+  0x95, 0x02, 0x95, 0x02, 0x97, 0x02, 0x98, 0x02, 0x9a, 0x02, 0x9c, 0x02,
+  0x9e, 0x02, 0xa0, 0x02, 0xa4, 0x02, 0xa4, 0x02, 0xa4, 0x02, 0xa8, 0x02,
+  0xa8, 0x02, 0xa8, 0x02, 0xa8, 0x02, 0xa9, 0x02, 0xa9, 0x02, 0xaa, 0x02,
+  0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x02, 0xab, 0x02, 0xad, 0x02,
+  0xae, 0x02, 0xb1, 0x02, 0xb1, 0x02, 0xb1, 0x02, 0xb1, 0x02, 0xb8, 0x02,
+  0xb9, 0x02, 0xb9, 0x02, 0xb9, 0x02, 0xbc, 0x02, 0xbe, 0x02, 0xbf, 0x02,
+  0xbf, 0x02, 0xc2, 0x02, 0xc8, 0x02, 0xc8, 0x02, 0xca, 0x02, 0xd3, 0x02,
+  0xd8, 0x02, 0xda, 0x02, 0xdb, 0x02, 0xde, 0x02, 0xdf, 0x02, 0xe1, 0x02,
+  0xe2, 0x02, 0xe2, 0x02, 0xe2, 0x02, 0xe2, 0x02, 0xe3, 0x02, 0xe4, 0x02,
+  0xe5, 0x02, 0xe5, 0x02, 0xe7, 0x02, 0xe9, 0x02, 0xe9, 0x02, 0xeb, 0x02,
+  0xec, 0x02, 0xef, 0x02, 0xf0, 0x02, 0xf2, 0x02, 0xf3, 0x02, 0xf4, 0x02,
+  0xf4, 0x02, 0xf5, 0x02, 0xf7, 0x02, 0xfd, 0x02, 0x00, 0x03, 0x01, 0x03,
+  0x03, 0x03, 0x06, 0x03, 0x0b, 0x03, 0x0b, 0x03, 0x0c, 0x03, 0x11, 0x03,
+  0x11, 0x03, 0x11, 0x03, 0x11, 0x03, 0x11, 0x03, 0x13, 0x03, 0x13, 0x03,
+  0x13, 0x03, 0x13, 0x03, 0x14, 0x03, 0x16, 0x03, 0x16, 0x03, 0x18, 0x03,
+  0x19, 0x03, 0x1c, 0x03, 0x1c, 0x03, 0x1c, 0x03, 0x1f, 0x03, 0x21, 0x03,
+  0x23, 0x03, 0x25, 0x03, 0x2b, 0x03, 0x2c, 0x03, 0x2d, 0x03, 0x30, 0x03,
+  0x32, 0x03, 0x33, 0x03, 0x34, 0x03, 0x3b, 0x03, 0x3b, 0x03, 0x3d, 0x03,
+  0x3d, 0x03, 0x40, 0x03, 0x42, 0x03, 0x43, 0x03, 0x43, 0x03, 0x44, 0x03,
+  0x4b, 0x03, 0x4c, 0x03, 0x50, 0x03, 0x50, 0x03, 0x51, 0x03, 0x51, 0x03,
+  0x52, 0x03, 0x52, 0x03, 0x54, 0x03, 0x55, 0x03, 0x55, 0x03, 0x56, 0x03,
+  0x5a, 0x03, 0x5c, 0x03, 0x5e, 0x03, 0x60, 0x03, 0x6e, 0x03, 0x70, 0x03,
+  0x72, 0x03, 0x72, 0x03, 0x78, 0x03, 0x78, 0x03, 0x79, 0x03, 0xa2, 0x03,
+  0xa5, 0x03, 0xa9, 0x03, 0xad, 0x03, 0xb1, 0x03, 0xb5, 0x03, 0xb9, 0x03,
+  0xbd, 0x03, 0xbf, 0x03, 0xcf, 0x03, 0xd2, 0x03, 0xd6, 0x03, 0xd8, 0x03,
+  0xdd, 0x03, 0xdd, 0x03, 0xe2, 0x03, 0xe2, 0x03, 0xe3, 0x03, 0xe5, 0x03,
+  0xe5, 0x03, 0xe5, 0x03, 0xe8, 0x03, 0xe9, 0x03, 0xeb, 0x03, 0xec, 0x03,
+  0xf7, 0x03, 0xf8, 0x03, 0xfa, 0x03, 0xfc, 0x03, 0x00, 0x04, 0x04, 0x04,
+  0x09, 0x04, 0x1c, 0x04, 0x1d, 0x04, 0x21, 0x04, 0x2c, 0x04, 0x2d, 0x04,
+  0x2e, 0x04, 0x2e, 0x04, 0x2f, 0x04, 0x2f, 0x04, 0x3b, 0x04, 0x3e, 0x04,
+  0x40, 0x04, 0x43, 0x04, 0x43, 0x04, 0x44, 0x04, 0x46, 0x04, 0x48, 0x04,
+  0x48, 0x04, 0x4c, 0x04, 0x4d, 0x04, 0x4d, 0x04, 0x4d, 0x04, 0x4d, 0x04,
+  0x4f, 0x04, 0x4f, 0x04, 0x53, 0x04, 0x55, 0x04, 0x55, 0x04, 0x56, 0x04,
+  0x5a, 0x04, 0x5a, 0x04, 0x64, 0x04, 0x64, 0x04, 0x67, 0x04, 0x68, 0x04,
+  0x87, 0x04, 0x88, 0x04, 0x89, 0x04, 0x8e, 0x04, 0x8e, 0x04, 0x8e, 0x04,
+  0x92, 0x04, 0x95, 0x04, 0x97, 0x04, 0x9b, 0x04, 0x9e, 0x04, 0xa1, 0x04,
+  0xa4, 0x04, 0xa8, 0x04, 0xad, 0x04, 0xb1, 0x04, 0xb1, 0x04, 0xb2, 0x04,
+  0xb3, 0x04, 0xb6, 0x04, 0xb8, 0x04, 0xb9, 0x04, 0xbb, 0x04, 0xbd, 0x04,
+  0xbf, 0x04, 0xc2, 0x04, 0xc8, 0x04, 0xc9, 0x04, 0xcd, 0x04, 0xcf, 0x04,
+  0xd5, 0x04, 0xdb, 0x04, 0xf8, 0x04, 0xf8, 0x04, 0xf9, 0x04, 0xfa, 0x04,
+  0xfe, 0x04, 0x01, 0x05, 0x07, 0x05, 0x09, 0x05, 0x09, 0x05, 0x0b, 0x05,
+  0x0d, 0x05, 0x0f, 0x05, 0x15, 0x05, 0x18, 0x05, 0x19, 0x05, 0x1a, 0x05,
+  0x1e, 0x05, 0x21, 0x05, 0x25, 0x05, 0x29, 0x05, 0x2c, 0x05, 0x2d, 0x05,
+  0x2d, 0x05, 0x2e, 0x05, 0x31, 0x05, 0x35, 0x05, 0x37, 0x05, 0x38, 0x05,
+  0x40, 0x05, 0x47, 0x05, 0x48, 0x05, 0x4a, 0x05, 0x4c, 0x05, 0x4d, 0x05,
+  0x4e, 0x05, 0x5b, 0x05, 0x5e, 0x05, 0x60, 0x05, 0x62, 0x05, 0x62, 0x05,
+  0x62, 0x05, 0x62, 0x05, 0x62, 0x05, 0x65, 0x05, 0x65, 0x05, 0x65, 0x05,
+  0x65, 0x05, 0x65, 0x05, 0x66, 0x05, 0x66, 0x05, 0x6e, 0x05, 0x6e, 0x05,
+  0x6f, 0x05, 0x71, 0x05, 0x77, 0x05, 0x79, 0x05, 0x7b, 0x05, 0x80, 0x05,
+  0x8a, 0x05, 0x8f, 0x05, 0x8f, 0x05, 0x92, 0x05, 0x95, 0x05, 0x97, 0x05,
+  0x97, 0x05, 0x98, 0x05, 0x9b, 0x05, 0x9e, 0x05, 0xa0, 0x05, 0xa0, 0x05,
+  0xa2, 0x05, 0xa6, 0x05, 0xa6, 0x05, 0xa7, 0x05, 0xa9, 0x05, 0xa9, 0x05,
+  0xa9, 0x05, 0xaa, 0x05, 0xad, 0x05, 0xad, 0x05, 0xad, 0x05, 0xad, 0x05,
+  0xaf, 0x05, 0xaf, 0x05, 0xb0, 0x05, 0xb1, 0x05, 0xb4, 0x05, 0xb4, 0x05,
+  0xb5, 0x05, 0xb7, 0x05, 0xbb, 0x05, 0xbb, 0x05, 0xbc, 0x05, 0xbf, 0x05,
+  0xc1, 0x05, 0xc1, 0x05, 0xc2, 0x05, 0xc4, 0x05, 0xc5, 0x05, 0xc6, 0x05,
+  0xc8, 0x05, 0xc8, 0x05, 0xcb, 0x05, 0xcb, 0x05, 0xcb, 0x05, 0xcc, 0x05,
+  0xcc, 0x05, 0xcd, 0x05, 0xce, 0x05, 0xce, 0x05, 0xce, 0x05, 0xd0, 0x05,
+  0xd1, 0x05, 0xd1, 0x05, 0xd2, 0x05, 0xd8, 0x05, 0xd8, 0x05, 0xd8, 0x05,
+  0xd8, 0x05, 0xd9, 0x05, 0xd9, 0x05, 0xdd, 0x05, 0xdf, 0x05, 0xdf, 0x05,
+  0xe2, 0x05, 0xe2, 0x05, 0xe2, 0x05, 0xe2, 0x05, 0xe2, 0x05, 0xe3, 0x05,
+  0xe3, 0x05, 0xe4, 0x05, 0xe5, 0x05, 0xe6, 0x05, 0xe9, 0x05, 0xee, 0x05,
+  0xef, 0x05, 0xf6, 0x05, 0xf8, 0x05, 0xfa, 0x05, 0xfc, 0x05, 0xfe, 0x05,
+  0x00, 0x06, 0x02, 0x06, 0x02, 0x06, 0x04, 0x06, 0x07, 0x06, 0x0e, 0x06,
+  0x0e, 0x06, 0x0e, 0x06, 0x0f, 0x06, 0x22, 0x06, 0x25, 0x06, 0x27, 0x06,
+  0x29, 0x06, 0x2c, 0x06, 0x31, 0x06, 0x35, 0x06, 0x35, 0x06, 0x38, 0x06,
+  0x38, 0x06, 0x3c, 0x06, 0x3f, 0x06, 0x43, 0x06, 0x44, 0x06, 0x44, 0x06,
+  0x44, 0x06, 0x52, 0x06, 0x54, 0x06, 0x58, 0x06, 0x5b, 0x06, 0x5f, 0x06,
+  0x61, 0x06, 0x64, 0x06, 0x68, 0x06, 0x6b, 0x06, 0x6c, 0x06, 0x6d, 0x06,
+  0x6f, 0x06, 0x70, 0x06, 0x72, 0x06, 0x74, 0x06, 0x79, 0x06, 0x81, 0x06,
+  0x88, 0x06, 0x98, 0x06, 0x9f, 0x06, 0xa6, 0x06, 0xad, 0x06, 0xc5, 0x06,
+  0xca, 0x06, 0xd0, 0x06, 0xd3, 0x06, 0xd9, 0x06, 0xdd, 0x06, 0xe4, 0x06,
+  0xe9, 0x06, 0xee, 0x06, 0xf1, 0x06, 0xfb, 0x06, 0x01, 0x07, 0x07, 0x07,
+  0x0d, 0x07, 0x15, 0x07, 0x1c, 0x07, 0x22, 0x07, 0x2a, 0x07, 0x32, 0x07,
+  0x38, 0x07, 0x3e, 0x07, 0x45, 0x07, 0x4a, 0x07, 0x50, 0x07, 0x55, 0x07,
+  0x5c, 0x07, 0x65, 0x07, 0x6d, 0x07, 0x8a, 0x07, 0x93, 0x07, 0xa8, 0x07,
+  0xb1, 0x07, 0xc8, 0x07, 0xd1, 0x07, 0xda, 0x07, 0xe1, 0x07, 0xe7, 0x07,
+  0xee, 0x07, 0xf6, 0x07, 0xfe, 0x07, 0x04, 0x08, 0x0d, 0x08, 0x15, 0x08,
+  0x1d, 0x08, 0x24, 0x08, 0x2c, 0x08, 0x34, 0x08, 0x3c, 0x08, 0x44, 0x08,
+  0x4c, 0x08, 0x53, 0x08, 0x5e, 0x08, 0x66, 0x08, 0x6d, 0x08, 0x73, 0x08,
+  0x7b, 0x08, 0x82, 0x08, 0x8a, 0x08, 0x91, 0x08, 0x97, 0x08, 0xaa, 0x08,
+  0xb0, 0x08, 0xc1, 0x08, 0xcb, 0x08, 0xe1, 0x08, 0xe7, 0x08, 0xf2, 0x08,
+  0xfa, 0x08, 0x01, 0x09, 0x08, 0x09, 0x15, 0x09, 0x1d, 0x09, 0x25, 0x09,
+  0x2c, 0x09, 0x31, 0x09, 0x36, 0x09, 0x3c, 0x09, 0x43, 0x09, 0x4a, 0x09,
+  0x52, 0x09, 0x59, 0x09, 0x60, 0x09, 0x6b, 0x09, 0x73, 0x09, 0x7a, 0x09,
+  0x81, 0x09, 0x87, 0x09, 0x8f, 0x09, 0x96, 0x09, 0x9d, 0x09, 0xa1, 0x09,
+  0xa6, 0x09, 0xab, 0x09, 0xb0, 0x09, 0xb5, 0x09, 0xbf, 0x09, 0xc9, 0x09,
+  0xd1, 0x09, 0xd8, 0x09, 0xdd, 0x09, 0xe5, 0x09, 0xea, 0x09, 0xee, 0x09,
+  0x03, 0x0a, 0x0a, 0x0a, 0x10, 0x0a, 0x14, 0x0a, 0x1a, 0x0a, 0x1e, 0x0a,
+  0x22, 0x0a, 0x26, 0x0a, 0x2b, 0x0a, 0x31, 0x0a, 0x37, 0x0a, 0x3d, 0x0a,
+  0x42, 0x0a, 0x49, 0x0a, 0x50, 0x0a, 0x53, 0x0a, 0x56, 0x0a, 0x5a, 0x0a,
+  0x5f, 0x0a, 0x67, 0x0a, 0x73, 0x0a, 0x77, 0x0a, 0x79, 0x0a, 0x7d, 0x0a,
+  0x82, 0x0a, 0x85, 0x0a, 0x8a, 0x0a, 0x8d, 0x0a, 0x90, 0x0a, 0x94, 0x0a,
+  0xa0, 0x0a, 0xa7, 0x0a, 0xaa, 0x0a, 0xae, 0x0a, 0xb3, 0x0a, 0xb5, 0x0a,
+  0xb6, 0x0a, 0xb9, 0x0a, 0xbb, 0x0a, 0xbc, 0x0a, 0xbf, 0x0a, 0xc6, 0x0a,
+  0xc7, 0x0a, 0xca, 0x0a, 0xcc, 0x0a, 0xd0, 0x0a, 0xd4, 0x0a, 0xd8, 0x0a,
+  0xdc, 0x0a, 0xe3, 0x0a, 0xe7, 0x0a, 0xe9, 0x0a, 0xec, 0x0a, 0xed, 0x0a,
+  0xf1, 0x0a, 0xf7, 0x0a, 0xfa, 0x0a, 0xfd, 0x0a, 0xfe, 0x0a, 0x02, 0x0b,
+  0x05, 0x0b, 0x08, 0x0b, 0x0d, 0x0b, 0x0f, 0x0b, 0x11, 0x0b, 0x12, 0x0b,
+  0x13, 0x0b, 0x18, 0x0b, 0x19, 0x0b, 0x1a, 0x0b, 0x1b, 0x0b, 0x1c, 0x0b,
+  0x1e, 0x0b, 0x1f, 0x0b, 0x24, 0x0b, 0x28, 0x0b, 0x2d, 0x0b, 0x31, 0x0b,
+  0x37, 0x0b, 0x3c, 0x0b, 0x56, 0x0b, 0x59, 0x0b, 0x5c, 0x0b, 0x62, 0x0b,
+  0x70, 0x0b, 0x77, 0x0b, 0x7b, 0x0b, 0x84, 0x0b, 0x8b, 0x0b, 0x91, 0x0b,
+  0x94, 0x0b, 0x98, 0x0b, 0x9a, 0x0b, 0x9d, 0x0b, 0xa2, 0x0b, 0xa3, 0x0b,
+  0xa9, 0x0b, 0xab, 0x0b, 0xad, 0x0b, 0xb1, 0x0b, 0xba, 0x0b, 0xc1, 0x0b,
+  0xc6, 0x0b, 0xcb, 0x0b, 0xd1, 0x0b, 0xd9, 0x0b, 0xe1, 0x0b, 0xe7, 0x0b,
+  0xee, 0x0b, 0xf5, 0x0b, 0xfc, 0x0b, 0x04, 0x0c, 0x16, 0x0c, 0x24, 0x0c,
+  0x2e, 0x0c, 0x34, 0x0c, 0x49, 0x0c, 0x51, 0x0c, 0x58, 0x0c, 0x60, 0x0c,
+  0x66, 0x0c, 0x6d, 0x0c, 0x72, 0x0c, 0x76, 0x0c, 0x7c, 0x0c, 0x82, 0x0c,
+  0x8c, 0x0c, 0x92, 0x0c, 0xa3, 0x0c, 0xa9, 0x0c, 0xaf, 0x0c, 0xb5, 0x0c,
+  0xc0, 0x0c, 0xc6, 0x0c, 0xc8, 0x0c, 0xcc, 0x0c, 0xd1, 0x0c, 0xd5, 0x0c,
+  0xd9, 0x0c, 0xdb, 0x0c, 0xe0, 0x0c, 0xe3, 0x0c, 0xe5, 0x0c, 0xe8, 0x0c,
+  0xeb, 0x0c, 0xee, 0x0c, 0xf3, 0x0c, 0xf5, 0x0c, 0x03, 0x0d, 0x04, 0x0d,
+  0x09, 0x0d, 0x0b, 0x0d, 0x10, 0x0d, 0x11, 0x0d, 0x15, 0x0d, 0x19, 0x0d,
+  0x1e, 0x0d, 0x22, 0x0d, 0x29, 0x0d, 0x2a, 0x0d, 0x2f, 0x0d, 0x2f, 0x0d,
+  0x32, 0x0d, 0x32, 0x0d, 0x39, 0x0d, 0x3a, 0x0d, 0x3b, 0x0d, 0x3b, 0x0d,
+  0x42, 0x0d, 0x42, 0x0d, 0x44, 0x0d, 0x44, 0x0d, 0x48, 0x0d, 0x48, 0x0d,
+  0x48, 0x0d, 0x48, 0x0d, 0x48, 0x0d, 0x48, 0x0d, 0x48, 0x0d, 0x49, 0x0d,
+  0x4a, 0x0d, 0x4a, 0x0d, 0x52, 0x0d, 0x52, 0x0d, 0x5c, 0x0d, 0x5c, 0x0d,
+  0x64, 0x0d, 0x64, 0x0d, 0x6a, 0x0d, 0x6a, 0x0d, 0x6c, 0x0d, 0x6d, 0x0d,
+  0x6d, 0x0d, 0x6d, 0x0d, 0x6d, 0x0d, 0x6d, 0x0d, 0x6e, 0x0d, 0x6f, 0x0d,
+  0x6f, 0x0d, 0x71, 0x0d, 0x71, 0x0d, 0x73, 0x0d, 0x78, 0x0d, 0x79, 0x0d,
+  0x7a, 0x0d, 0x7b, 0x0d, 0x7c, 0x0d, 0x7c, 0x0d, 0x7c, 0x0d, 0x81, 0x0d,
+  0x81, 0x0d, 0x81, 0x0d, 0x84, 0x0d, 0x85, 0x0d, 0x8b, 0x0d, 0x8c, 0x0d,
+  0x90, 0x0d, 0x95, 0x0d, 0x9d, 0x0d, 0x9e, 0x0d, 0x9e, 0x0d, 0x9e, 0x0d,
+  0x9f, 0x0d, 0x00, 0x00, 0x8c, 0x02, 0x63, 0xc4, 0x31, 0x3e, 0xc6, 0x70,
+  0x35, 0x0b, 0xbc, 0xe6, 0xe6, 0x43, 0x4d, 0x76, 0x99, 0xbb, 0xc1, 0xe0,
+  0x67, 0xa6, 0xf2, 0x2d, 0x2d, 0x2d, 0x2d, 0x65, 0x3d, 0x3d, 0x53, 0x9f,
+  0x55, 0x6a, 0x1a, 0x4b, 0x94, 0x87, 0x82, 0xb0, 0x0e, 0xd6, 0xfe, 0x42,
+  0xdd, 0xa4, 0xa7, 0x6e, 0x53, 0xe5, 0x42, 0xc4, 0xcd, 0x3c, 0xaf, 0x36,
+  0x5b, 0xc6, 0x4d, 0x4b, 0xca, 0x13, 0x3b, 0x65, 0xee, 0xd0, 0xd0, 0xf0,
+  0xcd, 0x24, 0xa9, 0xd1, 0x82, 0xdc, 0x9f, 0x44, 0x33, 0xae, 0xb4, 0xbe,
+  0x35, 0x41, 0x35, 0xa8, 0xe3, 0xcb, 0xb3, 0xa8, 0x17, 0x99, 0xc8, 0x03,
+  0x6f, 0x42, 0x02, 0x13, 0x2f, 0x3d, 0x78, 0xbe, 0x90, 0xd5, 0x0a, 0xf2,
+  0x86, 0xf9, 0x85, 0xd8, 0x9e, 0xf3, 0xad, 0x08, 0x57, 0x2a, 0xb8, 0xa5,
+  0x89, 0xb3, 0xd6, 0x07, 0xa9, 0xfb, 0x5d, 0xf6, 0x48, 0x9a, 0xa1, 0xde,
+  0xe3, 0xe4, 0x05, 0xa8, 0x3d, 0x56, 0x40, 0x4e, 0xd3, 0xfa, 0xf0, 0x4c,
+  0x4c, 0x22, 0x87, 0xee, 0x37, 0x9a, 0xc6, 0x82, 0xda, 0xe3, 0x5b, 0x04,
+  0xde, 0x31, 0x74, 0xff, 0xde, 0xef, 0xac, 0x58, 0xbe, 0x4c, 0x26, 0xa4,
+  0x53, 0x17, 0x8d, 0xc4, 0x93, 0x7f, 0x9d, 0xd6, 0x0c, 0xd9, 0x71, 0x29,
+  0x8c, 0xa3, 0x6f, 0xe3, 0x3b, 0x01, 0xe3, 0x96, 0x0b, 0xc1, 0xa1, 0x1e,
+  0xc0, 0xbd, 0x11, 0x17, 0x6c, 0xff, 0xd2, 0xae, 0x45, 0xa5, 0xf5, 0x61,
+  0x61, 0xfb, 0x0c, 0xa1, 0x49, 0x57, 0xe1, 0x57, 0xe7, 0x7a, 0x2c, 0x84,
+  0xde, 0x0a, 0x1a, 0x58, 0xcf, 0x39, 0x16, 0xcf, 0x35, 0x6f, 0x56, 0x4a,
+  0xfa, 0x1e, 0xa8, 0x94, 0x1d, 0x90, 0xd4, 0x80, 0x36, 0x4c, 0x82, 0x9d,
+  0xd4, 0x96, 0x22, 0x09, 0x81, 0x6f, 0xc2, 0xc5, 0x4d, 0xa4, 0xf0, 0x71,
+  0x41, 0x1e, 0x04, 0xfe, 0x49, 0xfa, 0xb0, 0xe0, 0xef, 0x69, 0x6b, 0xa4,
+  0x8e, 0x14, 0xa4, 0x6a, 0x74, 0xf0, 0xfc, 0xdf, 0x8e, 0x6a, 0x12, 0x88,
+  0xaa, 0x37, 0xb2, 0xb5, 0x27, 0x38, 0xf5, 0x13, 0x7d, 0xe4, 0x47, 0x45,
+  0x4a, 0x80, 0x17, 0xaf, 0x51, 0xbe, 0x89, 0x0f, 0x40, 0xd5, 0x32, 0xd7,
+  0xde, 0x72, 0x72, 0x7a, 0xb3, 0xb9, 0xfb, 0x14, 0x8c, 0xe6, 0x4a, 0xbd,
+  0x72, 0xc9, 0xb9, 0x3a, 0x36, 0x8b, 0xbe, 0xc3, 0x91, 0xb0, 0xc8, 0x57,
+  0x24, 0x65, 0x79, 0x02, 0x8b, 0x09, 0xcc, 0xb3, 0x7b, 0x27, 0x5d, 0xfe,
+  0xf2, 0xed, 0xd8, 0x1e, 0xe3, 0x9b, 0xe2, 0x71, 0x28, 0xfc, 0x24, 0xfc,
+  0xcc, 0x56, 0x0f, 0x24, 0x34, 0x56, 0xf3, 0x24, 0x09, 0xd5, 0xbe, 0x9a,
+  0x49, 0x2f, 0x32, 0xfe, 0x72, 0xaf, 0x62, 0x1a, 0x0e, 0x0e, 0x1e, 0x7b,
+  0x25, 0x1b, 0x71, 0x4a, 0x53, 0x1a, 0x37, 0xa4, 0xaa, 0xb4, 0x3c, 0x9b,
+  0xc9, 0x68, 0x14, 0x4f, 0x69, 0x35, 0x62, 0x7e, 0x5d, 0xdd, 0xc6, 0xf6,
+  0x38, 0x77, 0x8c, 0x33, 0x61, 0x46, 0x08, 0xf5, 0x89, 0x0e, 0x6e, 0x9d,
+  0x27, 0x57, 0x67, 0x87, 0xd5, 0x2b, 0x15, 0xfa, 0x88, 0xff, 0xfb, 0xf6,
+  0xd2, 0xe6, 0x43, 0x04, 0xd2, 0xd1, 0x24, 0xa0, 0x75, 0x5a, 0xf9, 0x81,
+  0x49, 0xe9, 0xb9, 0x6e, 0xdd, 0x42, 0xff, 0x90, 0x32, 0x1d, 0x76, 0x58,
+  0x6c, 0x3b, 0x10, 0xbb, 0x48, 0x14, 0x9f, 0x29, 0xf7, 0xd9, 0xf7, 0x08,
+  0x7e, 0x09, 0x2e, 0x9d, 0x37, 0x98, 0xbe, 0x72, 0xcf, 0xc0, 0x8a, 0xf4,
+  0x17, 0x8a, 0x0f, 0x0d, 0xb9, 0x13, 0x52, 0x93, 0xf2, 0xae, 0x41, 0xbf,
+  0x45, 0x0c, 0x81, 0x0c, 0xb0, 0xd7, 0x37, 0x04, 0xde, 0x11, 0xd8, 0xac,
+  0x31, 0x0a, 0xda, 0x94, 0xec, 0xf5, 0xf5, 0x14, 0x5f, 0xf2, 0xbd, 0x1b,
+  0xdc, 0xdd, 0xc8, 0xfb, 0xf9, 0xc8, 0x07, 0x4e, 0xb7, 0x5c, 0xfe, 0x79,
+  0xbc, 0x16, 0x83, 0xfe, 0xe0, 0x24, 0xbf, 0xe7, 0x81, 0xc2, 0x1b, 0x72,
+  0x39, 0x8a, 0x8f, 0x42, 0xac, 0xbd, 0x99, 0x50, 0xc0, 0xd9, 0x71, 0xd9,
+  0xf3, 0x15, 0xa3, 0xae, 0x06, 0x7e, 0x21, 0xaa, 0x2c, 0xab, 0xf7, 0x16,
+  0x22, 0x67, 0xdf, 0x3e, 0x5b, 0xf2, 0x5c, 0x6c, 0x6f, 0xd2, 0xf9, 0x10,
+  0x9d, 0x57, 0xf9, 0xa0, 0x17, 0xfa, 0xfa, 0xff, 0x95, 0x06, 0x67, 0x51,
+  0xc4, 0x4c, 0x2e, 0xbd, 0x13, 0x4b, 0x6e, 0xf8, 0xb6, 0xa7, 0xdc, 0x4d,
+  0xdd, 0x4b, 0xfb, 0xb8, 0x0e, 0x4c, 0x5f, 0x69, 0xe7, 0xa7, 0x0a, 0x55,
+  0xf9, 0x88, 0xa7, 0x07, 0x1c, 0x9d, 0x97, 0xea, 0x46, 0x97, 0x98, 0x12,
+  0xd5, 0x7f, 0x01, 0x80, 0x53, 0xd4, 0x93, 0x0b, 0x8e, 0x37, 0x7e, 0xa1,
+  0x23, 0x7e, 0x9f, 0xb4, 0x22, 0x79, 0x9b, 0xc8, 0x05, 0xe9, 0x55, 0xed,
+  0xd1, 0xcc, 0xbe, 0xcb, 0xed, 0xfd, 0x5c, 0x66, 0x0e, 0x23, 0xbc, 0xda,
+  0x4f, 0xff, 0x83, 0xb7, 0x0c, 0xe5, 0x9c, 0x25, 0xb1, 0xcd, 0x93, 0xa9,
+  0xb9, 0x2f, 0xae, 0x6d, 0x2c, 0x55, 0xbc, 0xc4, 0x0d, 0x80, 0xfb, 0x90,
+  0x6e, 0x5e, 0x36, 0xd1, 0x90, 0xe5, 0x00, 0x19, 0x6e, 0x27, 0x64, 0xfb,
+  0x4b, 0xa5, 0xc3, 0xdd, 0x70, 0x6d, 0xd5, 0xfc, 0xd5, 0xcb, 0x57, 0xe8,
+  0x80, 0xa4, 0xac, 0x5d, 0x92, 0x47, 0xc5, 0x9f, 0x29, 0xf9, 0x87, 0x6f,
+  0x2e, 0x47, 0x8c, 0x92, 0xc1, 0xf8, 0x08, 0x43, 0x17, 0xd5, 0x98, 0x37,
+  0x5d, 0xa1, 0x00, 0xfb, 0xba, 0xab, 0xec, 0xb2, 0x31, 0x6e, 0x5d, 0x90,
+  0x6d, 0x1f, 0xe3, 0xc7, 0x6e, 0x67, 0x99, 0x79, 0x0b, 0xfa, 0x42, 0xdb,
+  0x63, 0x16, 0x7f, 0x8f, 0xb0, 0xce, 0xce, 0x9e, 0xee, 0x1f, 0x5b, 0x2e,
+  0x8c, 0x96, 0xd1, 0xa5, 0x33, 0x85, 0x40, 0x03, 0xa3, 0xea, 0x58, 0x58,
+  0xf8, 0x49, 0x2d, 0xe3, 0x68, 0xca, 0xc3, 0x4d, 0x65, 0x07, 0xdc, 0xc2,
+  0x8a, 0x99, 0x3e, 0x1c, 0x6d, 0x6c, 0xbe, 0x27, 0x8a, 0xf2, 0x07, 0xdb,
+  0x26, 0xf1, 0x1b, 0xc8, 0x23, 0xc1, 0x79, 0x8c, 0x07, 0xed, 0x2e, 0xa9,
+  0xf9, 0x34, 0x3d, 0x4e, 0xa9, 0xf3, 0x65, 0x5d, 0xa2, 0x87, 0x69, 0x65,
+  0xd0, 0x4a, 0x6c, 0xda, 0x3c, 0xc9, 0xff, 0xf1, 0x04, 0x1f, 0xea, 0x4c,
+  0x07, 0x53, 0x00, 0xa1, 0x1a, 0xfe, 0x8f, 0xeb, 0x12, 0x12, 0x8f, 0x5b,
+  0x59, 0x5f, 0xec, 0xe5, 0xb0, 0x47, 0x9f, 0x6c, 0xc0, 0xfe, 0x8a, 0x33,
+  0x48, 0x07, 0x48, 0x50, 0x4e, 0xbd, 0x1e, 0x76, 0x3c, 0x79, 0xf7, 0x2a,
+  0x77, 0xe5, 0x07, 0x12, 0xfd, 0xf3, 0x7d, 0xf2, 0x34, 0x37, 0xac, 0x9c,
+  0x4f, 0xd0, 0xf0, 0xdc, 0xb0, 0x54, 0xb9, 0xf9, 0xd5, 0x6d, 0xfa, 0x75,
+  0xc7, 0x41, 0x3e, 0xea, 0xa6, 0x82, 0x8f, 0x76, 0x0f, 0x0a, 0xfb, 0x91,
+  0x53, 0x59, 0xf3, 0xb6, 0x51, 0xda, 0x68, 0xae, 0xac, 0x48, 0x13, 0xee,
+  0x6b, 0x19, 0x40, 0x74, 0xdf, 0x6b, 0x0b, 0xd7, 0x65, 0x9c, 0x47, 0xce,
+  0x72, 0xcc, 0x8a, 0x3c, 0x13, 0x05, 0x46, 0x32, 0x64, 0x64, 0x0e, 0x68,
+  0xe0, 0xc3, 0x73, 0x09, 0x7a, 0xef, 0xa6, 0x35, 0x8f, 0x02, 0x1e, 0x02,
+  0x19, 0xd4, 0x96, 0xb2, 0x0e, 0xc9, 0xcd, 0x95, 0xbb, 0x77, 0xbe, 0x03,
+  0xd5, 0x1c, 0x57, 0x31, 0xd3, 0x6f, 0x74, 0x1e, 0xeb, 0xb6, 0xe6, 0xc7,
+  0x71, 0x38, 0x07, 0x66, 0x05, 0x00, 0x10, 0xa4, 0xb4, 0xf7, 0x36, 0x5b,
+  0xc7, 0x0d, 0x70, 0xcd, 0x7b, 0xaf, 0x0f, 0x38, 0x89, 0xc0, 0xe0, 0xf0,
+  0xa9, 0x44, 0xb6, 0xd5, 0xf2, 0x59, 0x04, 0x39, 0xae, 0x19, 0xf2, 0x84,
+  0x5e, 0x0a, 0x20, 0x52, 0xd2, 0x4f, 0x2c, 0x04, 0x76, 0x63, 0x51, 0xea,
+  0xba, 0x3e, 0xe0, 0xb3, 0x42, 0x12, 0xd8, 0xad, 0xdc, 0xfb, 0xd5, 0x75,
+  0x60, 0xc1, 0x50, 0x76, 0x35, 0xc9, 0xf0, 0xf6, 0x76, 0x07, 0xd3, 0x52,
+  0x19, 0x61, 0x2b, 0xcf, 0x3e, 0x7a, 0x75, 0x6b, 0xce, 0x7c, 0x2a, 0xce,
+  0xa9, 0x77, 0xf1, 0x6c, 0x15, 0x9b, 0x05, 0x7a, 0xfb, 0xe8, 0x9f, 0x7c,
+  0xb8, 0x4e, 0xb9, 0x7c, 0x3c, 0xb1, 0x03, 0x00, 0x6b, 0x5e, 0x89, 0x68,
+  0xf0, 0xe4, 0x7c, 0xcd, 0x1e, 0x18, 0x5b, 0x1f, 0x19, 0xc3, 0x35, 0x75,
+  0x45, 0xc6, 0x9e, 0xe4, 0x86, 0x78, 0x96, 0x55, 0x48, 0x65, 0xef, 0xd1,
+  0x88, 0xd1, 0x14, 0x29, 0xed, 0x05, 0xe9, 0x05, 0x35, 0x06, 0xc6, 0xa7,
+  0xe9, 0x3d, 0xa3, 0xc3, 0x49, 0x04, 0x69, 0x93, 0x26, 0x1e, 0x45, 0xea,
+  0x30, 0xdc, 0x5e, 0xa6, 0xa2, 0xe7, 0xa1, 0x06, 0xae, 0x44, 0x39, 0x69,
+  0xff, 0xc8, 0xf6, 0x14, 0x93, 0x3c, 0x3c, 0x9c, 0xc3, 0x75, 0x75, 0x0d,
+  0xb9, 0x66, 0x9d, 0x8e, 0x2a, 0x2c, 0x83, 0x85, 0xed, 0xda, 0x5b, 0x1d,
+  0xef, 0x9f, 0x55, 0xaf, 0x8e, 0xb0, 0xad, 0xa3, 0x9a, 0xd3, 0xc1, 0x59,
+  0x77, 0x51, 0x98, 0xe2, 0x0e, 0x0d, 0x5e, 0x6b, 0x09, 0xb2, 0xec, 0xee,
+  0x21, 0x98, 0x2e, 0xe3, 0x08, 0xbf, 0x4a, 0x2a, 0x2e, 0x08, 0x4a, 0x59,
+  0x68, 0x85, 0xc4, 0xe5, 0xb1, 0x2b, 0x18, 0x83, 0x75, 0x2a, 0x10, 0x7d,
+  0x78, 0x9a, 0x42, 0xae, 0xf0, 0x71, 0x26, 0xd3, 0xcb, 0x58, 0x7a, 0x9c,
+  0xfd, 0x9a, 0x76, 0xa4, 0x4d, 0x47, 0xb0, 0xa8, 0x9e, 0xd0, 0x95, 0x76,
+  0xb7, 0xb8, 0x1c, 0xf1, 0x0a, 0x11, 0x02, 0x03, 0x58, 0x2a, 0xf8, 0x51,
+  0xc8, 0xcf, 0xe5, 0xce, 0xb2, 0x35, 0xa1, 0xb9, 0x7a, 0x2d, 0x64, 0x3b,
+  0x62, 0xe1, 0x8b, 0xd9, 0x2d, 0x52, 0xe2, 0x07, 0xd3, 0xb3, 0xda, 0x94,
+  0x17, 0xb1, 0x5f, 0x47, 0xe1, 0x70, 0xe7, 0x01, 0x5c, 0xfb, 0x95, 0x5d,
+  0x6b, 0x0e, 0xe1, 0x7c, 0x90, 0x2d, 0x20, 0x2e, 0x08, 0xa7, 0xde, 0x1d,
+  0xd9, 0xb5, 0xa5, 0xe0, 0xf2, 0x9d, 0xec, 0xcb, 0x82, 0x6e, 0x65, 0x45,
+  0x2e, 0xf9, 0x56, 0xbb, 0x9f, 0xf1, 0xc4, 0x95, 0x41, 0xb2, 0x57, 0xb1,
+  0x85, 0x2f, 0xeb, 0xf9, 0xc7, 0x95, 0x31, 0x5b, 0x0a, 0x41, 0x23, 0x3c,
+  0x62, 0xad, 0x9a, 0x42, 0xb7, 0x44, 0xc3, 0x12, 0xdb, 0x77, 0xfe, 0xba,
+  0xa4, 0xf4, 0xbd, 0xbe, 0x94, 0x62, 0xfb, 0x3e, 0xa7, 0x34, 0x0c, 0x74,
+  0x0a, 0x07, 0x4c, 0x11, 0xef, 0x51, 0x3f, 0xc0, 0x89, 0x46, 0x92, 0x45,
+  0xb0, 0xd1, 0x96, 0x45, 0x2a, 0xe9, 0xe6, 0x02, 0x08, 0x96, 0x7a, 0xe3,
+  0x33, 0x71, 0xef, 0xf0, 0xef, 0x28, 0xf2, 0xfe, 0x88, 0x48, 0x4c, 0x98,
+  0xe2, 0xcb, 0xe9, 0x7a, 0xff, 0xa2, 0xd4, 0xd3, 0x4f, 0x15, 0x8d, 0x13,
+  0x22, 0x01, 0x23, 0x6b, 0x8d, 0x8a, 0xd0, 0x95, 0x2e, 0xa3, 0xec, 0x50,
+  0x0e, 0x35, 0xff, 0x25, 0x98, 0x18, 0xd2, 0x77, 0x99, 0xe5, 0x35, 0x7e,
+  0x2d, 0x38, 0x98, 0x83, 0xd3, 0x13, 0x3b, 0x66, 0x7d, 0xf7, 0x37, 0x92,
+  0xbb, 0x65, 0x52, 0x77, 0x18, 0x93, 0xa7, 0x1d, 0x6f, 0x6f, 0x77, 0x79,
+  0x4e, 0xd6, 0xf1, 0xcd, 0xf1, 0xec, 0x85, 0xb5, 0x09, 0x13, 0xcd, 0xe2,
+  0x2f, 0x9c, 0x46, 0x5d, 0xee, 0x23, 0xfb, 0x47, 0x7e, 0x75, 0x7f, 0x68,
+  0x24, 0xc7, 0x5c, 0xf2, 0x09, 0x34, 0x09, 0x5a, 0xe9, 0x1c, 0x37, 0x9f,
+  0xee, 0xf2, 0xb6, 0x53, 0xab, 0x0f, 0xae, 0x2a, 0x2f, 0x29, 0x1b, 0xbc,
+  0x7f, 0x07, 0x99, 0x98, 0x9f, 0x89, 0x6b, 0xb4, 0xee, 0xea, 0xee, 0xc8,
+  0xbe, 0x62, 0x97, 0xc9, 0x7d, 0x21, 0xd0, 0xdc, 0x16, 0xe6, 0x45, 0x72,
+  0xf7, 0x07, 0x5a, 0x6c, 0xca, 0xea, 0x40, 0xa8, 0x6b, 0x05, 0x8b, 0xfc,
+  0x4a, 0xf9, 0xfe, 0x0f, 0xa2, 0xd2, 0xd5, 0xd2, 0xbe, 0x1d, 0x4c, 0xae,
+  0x73, 0xfe, 0x4b, 0x27, 0x69, 0x11, 0xf7, 0x93, 0xb4, 0x5d, 0x25, 0x19,
+  0x0c, 0x64, 0xc9, 0x42, 0x81, 0x93, 0x67, 0x89, 0xe0, 0xac, 0x9f, 0xc0,
+  0x62, 0xb9, 0xe4, 0xb2, 0x7b, 0xfe, 0x8b, 0x25, 0x14, 0xa7, 0xd0, 0x30,
+  0x79, 0x0e, 0x43, 0x8a, 0x02, 0x64, 0x3a, 0x1e, 0x89, 0xe5, 0xad, 0xad,
+  0xc2, 0xab, 0x6c, 0x3d, 0x1d, 0xfd, 0xaf, 0x89, 0x6f, 0x68, 0xba, 0x2a,
+  0x49, 0xd5, 0x36, 0x3a, 0x85, 0x2e, 0xdd, 0x64, 0x26, 0x08, 0xca, 0x28,
+  0x57, 0x33, 0x6b, 0xa3, 0x05, 0x1b, 0x56, 0xc2, 0x9a, 0xf4, 0x19, 0xc0,
+  0x2c, 0x9b, 0xd5, 0xb5, 0x2a, 0x47, 0xb6, 0xe0, 0xd4, 0xc2, 0x97, 0x97,
+  0x61, 0xad, 0xf1, 0xe6, 0x58, 0xc9, 0xe2, 0xbb, 0x50, 0x11, 0xba, 0x45,
+  0x48, 0xc4, 0xde, 0xe2, 0xc4, 0x1a, 0x0f, 0x9c, 0xcc, 0xcc, 0xac, 0x20,
+  0xa8, 0x84, 0x9b, 0x02, 0x7c, 0xbc, 0x3f, 0x3f, 0x75, 0xd6, 0xef, 0xe1,
+  0x2a, 0x2b, 0x24, 0x58, 0xa0, 0x7a, 0xaf, 0xa6, 0x7f, 0x27, 0x0c, 0x2a,
+  0xe7, 0x67, 0x5d, 0x8d, 0x92, 0x6c, 0x92, 0xc3, 0xb5, 0xd6, 0x35, 0x9e,
+  0xb6, 0x29, 0x76, 0x4a, 0xac, 0xa6, 0x02, 0x26, 0x86, 0x3f, 0x94, 0x3e,
+  0x5e, 0xf1, 0xf4, 0x91, 0xad, 0xf3, 0xd9, 0xd7, 0x83, 0x4c, 0x1d, 0xce,
+  0x8c, 0x13, 0x6a, 0xb3, 0x35, 0xc4, 0x92, 0x4c, 0xf4, 0x51, 0x21, 0x8f,
+  0xcf, 0x5d, 0xad, 0xe9, 0x63, 0xcf, 0x73, 0xaf, 0x40, 0x60, 0x0f, 0xe8,
+  0x03, 0xa4, 0x6f, 0x6d, 0x34, 0x03, 0xf0, 0x18, 0x70, 0x17, 0x62, 0x89,
+  0xa9, 0xc2, 0x4f, 0xa3, 0x81, 0xcb, 0x79, 0x38, 0x38, 0x32, 0xbd, 0xd2,
+  0x47, 0xf8, 0xac, 0x23, 0x4a, 0xd1, 0x78, 0x8c, 0x31, 0xa0, 0xf9, 0x01,
+  0xef, 0x23, 0x9d, 0x60, 0xe6, 0x32, 0x80, 0x59, 0x96, 0xf4, 0x49, 0x61,
+  0x4e, 0xfb, 0x92, 0x80, 0xc7, 0x17, 0xdd, 0x68, 0x3e, 0xb7, 0xb6, 0xe2,
+  0x7f, 0x1a, 0xa9, 0x64, 0x64, 0x22, 0x25, 0x70, 0xe2, 0x80, 0x5d, 0xd4,
+  0x8a, 0x97, 0xa7, 0x35, 0xc4, 0xf3, 0x79, 0x0e, 0x55, 0x9b, 0x7c, 0x21,
+  0x60, 0x21, 0xfc, 0x39, 0xba, 0x3f, 0x78, 0x60, 0xa6, 0xa7, 0x14, 0xd6,
+  0x0f, 0xb5, 0xe9, 0x35, 0xa3, 0x0e, 0x5a, 0x4e, 0x4d, 0xb3, 0x33, 0x9b,
+  0x2a, 0xdc, 0xd2, 0x23, 0xfd, 0x32, 0x6f, 0x61, 0x69, 0xa6, 0xd1, 0x46,
+  0xda, 0xc9, 0x1f, 0x32, 0xd9, 0x44, 0x18, 0x89, 0x9b, 0x65, 0xf9, 0x94,
+  0x3e, 0x53, 0x1a, 0x1a, 0x68, 0x03, 0x36, 0x1f, 0x73, 0x98, 0xeb, 0xfe,
+  0x65, 0xf9, 0x9c, 0xaa, 0xed, 0xe8, 0x0f, 0x70, 0x0d, 0x5c, 0xd3, 0x42,
+  0x4e, 0xec, 0xe5, 0xaf, 0x03, 0xef, 0x1d, 0x40, 0x58, 0x48, 0xa2, 0x95,
+  0x30, 0xf5, 0x70, 0x7f, 0x24, 0x4a, 0xf5, 0x7e, 0x03, 0x4f, 0x47, 0xd9,
+  0x85, 0xdb, 0xac, 0x79, 0x89, 0xce, 0xcd, 0x34, 0x53, 0x34, 0x8f, 0x21,
+  0xea, 0x7f, 0x6f, 0x95, 0xca, 0x56, 0xe3, 0x5d, 0xac, 0xcd, 0xa9, 0x61,
+  0xc5, 0x40, 0x3b, 0xd3, 0x6e, 0x83, 0xc5, 0xc0, 0xe6, 0x97, 0xf6, 0x5b,
+  0xbb, 0x5f, 0xd9, 0x7a, 0xd4, 0xf2, 0x2e, 0xf3, 0x2e, 0x9e, 0x06, 0xec,
+  0x6f, 0x41, 0x8d, 0x9e, 0x38, 0x16, 0xae, 0xe6, 0x4d, 0x65, 0xe1, 0x6a,
+  0x31, 0xbb, 0x52, 0x4d, 0xcb, 0x7a, 0xb3, 0x62, 0x94, 0x3c, 0xf6, 0x92,
+  0xfb, 0xe4, 0x75, 0x9b, 0x20, 0x9d, 0x66, 0x2a, 0x47, 0x8f, 0x54, 0x1d,
+  0x0a, 0x8d, 0xf4, 0xec, 0x9a, 0x87, 0x89, 0xf4, 0xc4, 0x71, 0xf1, 0x7f,
+  0x34, 0x63, 0x72, 0x22, 0xc7, 0x89, 0xbe, 0x2b, 0x5a, 0x56, 0xeb, 0x50,
+  0x1d, 0xf0, 0x12, 0xbf, 0xe8, 0xc3, 0x47, 0xb6, 0xa0, 0xe0, 0x41, 0x5e,
+  0x43, 0x3b, 0x03, 0x48, 0xd6, 0xce, 0x29, 0xa0, 0x91, 0xdf, 0x20, 0x18,
+  0x67, 0x1f, 0x6d, 0xa3, 0xa8, 0x82, 0x26, 0x5a, 0x42, 0x8b, 0x9c, 0xd7,
+  0x55, 0xfe, 0xb4, 0xa7, 0x36, 0x16, 0x7a, 0xf5, 0x66, 0xde, 0x7f, 0x03,
+  0xa2, 0xa5, 0x2b, 0x3e, 0xd5, 0x55, 0xc4, 0x93, 0x51, 0x37, 0x1d, 0x1a,
+  0x38, 0x64, 0x90, 0x68, 0x45, 0x8e, 0x8c, 0xb0, 0xf2, 0x06, 0xf0, 0x24,
+  0x64, 0xe8, 0x34, 0xc7, 0x5f, 0x05, 0x35, 0x41, 0x10, 0x76, 0xa1, 0x78,
+  0xef, 0x93, 0x9a, 0xdd, 0xde, 0x8f, 0xce, 0xe2, 0xc4, 0x6d, 0x13, 0x53,
+  0x21, 0x61, 0x51, 0x64, 0x3c, 0xf1, 0x89, 0x2b, 0xd6, 0x9d, 0x3e, 0x68,
+  0x15, 0xb3, 0xbb, 0xed, 0x18, 0x35, 0xa6, 0x1a, 0x81, 0xc9, 0x59, 0x80,
+  0x24, 0x19, 0x09, 0x84, 0xb0, 0x12, 0x37, 0x89, 0x9b, 0x33, 0x2f, 0xaa,
+  0x7e, 0xa7, 0xaa, 0x48, 0xda, 0xab, 0x99, 0xf1, 0x0b, 0xd3, 0xa8, 0xfc,
+  0xb4, 0x5a, 0x70, 0x8f, 0x9a, 0x66, 0x34, 0xf6, 0x76, 0x9a, 0x5c, 0x78,
+  0xcc, 0x41, 0xe5, 0x0e, 0xce, 0xe7, 0x7b, 0xfe, 0xaa, 0x3a, 0x85, 0xc3,
+  0x2d, 0xd8, 0xd9, 0x05, 0x21, 0xdd, 0x5f, 0xbd, 0x79, 0x0f, 0x95, 0x96,
+  0x6f, 0xc0, 0xa9, 0xce, 0xd1, 0xeb, 0x9e, 0x1c, 0xcb, 0xb3, 0xef, 0xe2,
+  0x0b, 0x42, 0xb5, 0xf4, 0xc0, 0x10, 0x38, 0x38, 0x94, 0x0e, 0x91, 0x3b,
+  0xbd, 0x95, 0xa8, 0xaf, 0x25, 0x78, 0x29, 0x89, 0x79, 0x50, 0x2a, 0x5f,
+  0x01, 0xff, 0x3b, 0x45, 0x1c, 0x89, 0xaa, 0x0c, 0x4d, 0x0b, 0x58, 0x88,
+  0x08, 0xf5, 0x9c, 0x79, 0x79, 0xf9, 0x34, 0xd2, 0x26, 0xcf, 0x4f, 0x08,
+  0xa5, 0xd0, 0x5a, 0x7f, 0x6a, 0x89, 0x39, 0x54, 0xc7, 0x69, 0x2f, 0xc8,
+  0x81, 0x59, 0x8c, 0xfe, 0x1f, 0xca, 0xe6, 0x6b, 0xf7, 0xbb, 0x9e, 0xaa,
+  0x10, 0x31, 0xfa, 0x4a, 0xc4, 0x2d, 0xf8, 0xad, 0xa3, 0x0a, 0xd0, 0x57,
+  0xbd, 0x93, 0xf0, 0x87, 0x3d, 0xd7, 0x95, 0x58, 0x65, 0x25, 0x27, 0xd2,
+  0xd3, 0x44, 0x20, 0x80, 0x30, 0xac, 0x26, 0x74, 0x8d, 0x18, 0xd0, 0xba,
+  0xf3, 0x73, 0x10, 0xb0, 0xb2, 0x63, 0x4b, 0x5b, 0x1d, 0x83, 0x1f, 0x01,
+  0x92, 0xa0, 0x90, 0x65, 0x47, 0x32, 0x1e, 0x22, 0xd5, 0xe5, 0x73, 0x51,
+  0xf3, 0x58, 0x70, 0x80, 0xe6, 0x3f, 0xe4, 0x05, 0xb4, 0x86, 0xc4, 0xf0,
+  0xd2, 0x62, 0xda, 0x03, 0x91, 0xcc, 0x44, 0x40, 0x03, 0xd1, 0x64, 0x04,
+  0xfd, 0x8c, 0x99, 0x8b, 0xff, 0xa3, 0x25, 0xf7, 0xaa, 0x58, 0x69, 0x61,
+  0x62, 0xb4, 0x66, 0xd0, 0xfd, 0xa7, 0xc7, 0x8b, 0x60, 0x81, 0xd2, 0x9e,
+  0x89, 0xb2, 0x85, 0x81, 0x36, 0x72, 0xff, 0xd2, 0x10, 0x39, 0x70, 0xd6,
+  0xb2, 0xb0, 0x01, 0xd4, 0xaf, 0xbf, 0x6a, 0x24, 0xf3, 0x4b, 0x1a, 0x01,
+  0x18, 0x5c, 0xd1, 0x2a, 0xbf, 0x2d, 0x3d, 0xcb, 0x41, 0xb4, 0x2a, 0xbb,
+  0xae, 0xbd, 0x16, 0x1d, 0xae, 0xf6, 0xc3, 0x82, 0xc9, 0xe5, 0xac, 0xc0,
+  0x66, 0x54, 0xfa, 0x64, 0x4f, 0xf3, 0x46, 0xd9, 0x7a, 0xe9, 0x37, 0x25,
+  0xe5, 0xb5, 0x13, 0x8e, 0xfa, 0x9a, 0x7a, 0x86, 0x24, 0x2f, 0x4a, 0x0c,
+  0x49, 0x9d, 0x78, 0x3a, 0xbd, 0xd9, 0x37, 0xc9, 0x2f, 0x78, 0xe5, 0x70,
+  0xac, 0xba, 0xaa, 0x72, 0xaa, 0x80, 0x38, 0xfc, 0xc4, 0x33, 0x78, 0x73,
+  0x11, 0x82, 0xd4, 0xee, 0x8a, 0x4e, 0x1c, 0xc3, 0xea, 0x1f, 0x15, 0x01,
+  0x41, 0x0c, 0x28, 0x14, 0xb3, 0xe2, 0x9f, 0x46, 0xf3, 0x28, 0x22, 0x4c,
+  0xb7, 0xf4, 0xd1, 0x7b, 0xad, 0x44, 0xbb, 0xed, 0xe6, 0x63, 0x57, 0xb6,
+  0x57, 0x42, 0x25, 0x0a, 0x21, 0xb0, 0x53, 0x5e, 0x28, 0xc3, 0x48, 0x4b,
+  0x7b, 0x57, 0xa5, 0xd2, 0x81, 0x89, 0xc7, 0xdf, 0xf2, 0xfa, 0xb5, 0x91,
+  0x74, 0xef, 0x76, 0x2f, 0x90, 0x31, 0x06, 0xcd, 0x1f, 0xc8, 0xbd, 0x07,
+  0x1d, 0x33, 0x04, 0xf8, 0xb0, 0xc2, 0x97, 0x1d, 0x48, 0x10, 0xcd, 0x3a,
+  0x02, 0x8f, 0xe6, 0x4c, 0xa9, 0x27, 0x5b, 0x85, 0xc5, 0x5b, 0xce, 0x13,
+  0x51, 0x05, 0xc6, 0x31, 0x70, 0x54, 0xe0, 0x35, 0x12, 0x5d, 0xeb, 0xf3,
+  0x70, 0xdd, 0xa1, 0xe2, 0x0a, 0x98, 0x17, 0xc4, 0xfe, 0xb5, 0x1c, 0x9b,
+  0x61, 0x8a, 0x0d, 0x8f, 0x5b, 0x3e, 0x4d, 0xaf, 0x74, 0x3f, 0xe4, 0x39,
+  0xa0, 0xdc, 0x81, 0xe7, 0x38, 0xdc, 0x31, 0xab, 0x4a, 0xc0, 0xc5, 0xed,
+  0x70, 0xb6, 0x77, 0x6b, 0xe3, 0xa5, 0x46, 0x9a, 0x54, 0x6b, 0x67, 0xd3,
+  0xf8, 0xc5, 0x83, 0x36, 0xf8, 0xc7, 0x19, 0x0d, 0x62, 0x63, 0x8e, 0x7c,
+  0x54, 0x85, 0x17, 0xc1, 0x81, 0xb8, 0xf8, 0x13, 0xd1, 0x12, 0xad, 0x28,
+  0xac, 0xe5, 0x5b, 0x9e, 0x05, 0xad, 0x7f, 0x92, 0xa5, 0xaf, 0xc2, 0x38,
+  0xe9, 0xfe, 0x0f, 0xb9, 0x26, 0xfe, 0x23, 0x94, 0x62, 0x55, 0xae, 0x74,
+  0x39, 0x0c, 0x65, 0x60, 0x56, 0xc8, 0x60, 0x80, 0x96, 0xcd, 0xc0, 0x34,
+  0xd7, 0xe9, 0xfc, 0xd1, 0xa7, 0x01, 0xd7, 0x61, 0x56, 0x78, 0x9c, 0x8c,
+  0x01, 0x77, 0x0c, 0x0e, 0x7f, 0x1f, 0x08, 0x53, 0x68, 0xbd, 0x72, 0xc6,
+  0x28, 0xba, 0x9a, 0xa9, 0x3c, 0x42, 0xd7, 0x46, 0xf5, 0x77, 0x82, 0x33,
+  0x73, 0x45, 0xd8, 0x54, 0xd7, 0x1c, 0x6a, 0x8d, 0xfc, 0xc4, 0x78, 0xa8,
+  0x17, 0x07, 0x72, 0x38, 0xfe, 0xee, 0x6e, 0x35, 0x0e, 0x78, 0xff, 0x64,
+  0x95, 0xcb, 0x3f, 0x1d, 0x77, 0x6b, 0xa5, 0x25, 0x45, 0xa4, 0xc6, 0xb1,
+  0x14, 0x2d, 0xdf, 0x61, 0xf7, 0x8d, 0xf3, 0x07, 0x46, 0x01, 0xc5, 0x0f,
+  0xc3, 0xdc, 0x80, 0x3b, 0x89, 0x77, 0xc2, 0xbf, 0x49, 0xab, 0xae, 0x08,
+  0x3c, 0x97, 0x05, 0x31, 0xa8, 0x8d, 0x9b, 0x41, 0xb7, 0xfb, 0x37, 0x34,
+  0x0e, 0x05, 0xd6, 0x7f, 0x8c, 0xd1, 0x5c, 0x6e, 0x48, 0xc5, 0x82, 0x76,
+  0xdf, 0x01, 0xf2, 0x20, 0xf3, 0x8d, 0x6e, 0xe4, 0x24, 0x50, 0x17, 0x85,
+  0x31, 0xdb, 0x96, 0xb0, 0xa4, 0xa1, 0x43, 0xf0, 0x43, 0x17, 0x12, 0x82,
+  0xdb, 0x7f, 0x92, 0x36, 0x0a, 0x45, 0xf6, 0xbe, 0x0d, 0x6d, 0x80, 0xcd,
+  0x2f, 0xbd, 0xe8, 0x10, 0xf5, 0xe1, 0x24, 0x7f, 0x2b, 0x64, 0xe0, 0x05,
+  0x6a, 0x66, 0xfd, 0xd6, 0xf5, 0xfe, 0x7f, 0xe9, 0xcf, 0x2b, 0xca, 0x3d,
+  0xa9, 0x25, 0x34, 0x20, 0xd3, 0xef, 0xae, 0x85, 0x63, 0xff, 0xcc, 0x55,
+  0x47, 0x50, 0x6e, 0x59, 0x4c, 0xe0, 0xd0, 0xe6, 0x19, 0x38, 0xca, 0xc0,
+  0x08, 0x6b, 0x21, 0xf8, 0xe9, 0xf8, 0x7a, 0x66, 0xb9, 0xb0, 0x83, 0x0c,
+  0xfb, 0xc7, 0x91, 0x74, 0x97, 0xbe, 0x9e, 0xe0, 0xe0, 0x2f, 0xed, 0x4e,
+  0xe2, 0x39, 0x16, 0x2f, 0xeb, 0x97, 0x1e, 0xcc, 0xd9, 0xe7, 0x7e, 0x2c,
+  0x60, 0x56, 0x29, 0x74, 0xf0, 0x23, 0x99, 0x98, 0x89, 0x44, 0x7e, 0x68,
+  0x0b, 0xb3, 0xe0, 0x98, 0x9d, 0xf3, 0x2a, 0x89, 0xbb, 0x9c, 0xc0, 0x82,
+  0xfa, 0x4d, 0xaf, 0xde, 0x65, 0x8e, 0x8c, 0x9d, 0x6c, 0xac, 0x7d, 0x1e,
+  0xe9, 0xfd, 0x93, 0xd1, 0x23, 0x35, 0xdd, 0xa1, 0x8c, 0x4d, 0x2d, 0x67,
+  0x5b, 0xc7, 0x4c, 0x2b, 0x3c, 0xda, 0x11, 0x4f, 0xde, 0xf7, 0xb5, 0x22,
+  0xc8, 0x3f, 0x70, 0x1f, 0x3b, 0x41, 0xeb, 0x30, 0xab, 0xe3, 0xde, 0xea,
+  0x42, 0xd6, 0x79, 0x7e, 0xa7, 0x16, 0x9d, 0x42, 0x18, 0x55, 0xe8, 0x52,
+  0xe9, 0xc9, 0x35, 0xb1, 0xfc, 0x21, 0xe2, 0x43, 0x5e, 0xa4, 0xb5, 0xcf,
+  0x41, 0x2d, 0x90, 0xf5, 0x55, 0x8c, 0x7d, 0x39, 0x98, 0x61, 0x43, 0x40,
+  0x19, 0xa4, 0xa1, 0x3d, 0x30, 0x0a, 0xa3, 0x9c, 0x8e, 0xff, 0x38, 0x9c,
+  0xf5, 0x1c, 0x62, 0xba, 0x1b, 0xae, 0xc1, 0x51, 0x76, 0xbc, 0xe1, 0xea,
+  0xd4, 0x99, 0xfc, 0x41, 0x6c, 0x2f, 0x6f, 0x43, 0xb3, 0xfd, 0xeb, 0x21,
+  0x7a, 0x0f, 0x3d, 0x9d, 0x6a, 0xfd, 0x92, 0xc3, 0xe2, 0x37, 0x01, 0x8b,
+  0x2c, 0x7f, 0xdf, 0x4e, 0x0b, 0xbb, 0xc7, 0xe6, 0xf9, 0xb2, 0xd4, 0xf9,
+  0x56, 0x35, 0xe2, 0x94, 0xc3, 0xf7, 0xb2, 0xf1, 0x44, 0x7f, 0x8a, 0xb3,
+  0xcf, 0x6f, 0x22, 0xf1, 0x28, 0x72, 0x5a, 0x32, 0xa8, 0xc7, 0x41, 0x41,
+  0x76, 0x01, 0xbf, 0x28, 0x86, 0x12, 0x75, 0xf9, 0xc0, 0x48, 0x7e, 0xcc,
+  0xac, 0x58, 0xf3, 0x23, 0x53, 0x00, 0xa0, 0x52, 0x71, 0x35, 0xaa, 0xf0,
+  0x17, 0x95, 0xb3, 0x74, 0x76, 0x23, 0x6f, 0xa4, 0x03, 0xbe, 0xa8, 0x0f,
+  0x66, 0xc3, 0x5d, 0xc8, 0x3b, 0xba, 0x71, 0xfa, 0x5d, 0xec, 0x55, 0x66,
+  0x54, 0x08, 0xe9, 0xb5, 0xe9, 0xf3, 0xc7, 0xca, 0x56, 0x77, 0xa5, 0x28,
+  0x48, 0x6a, 0x19, 0x71, 0x29, 0x03, 0xbf, 0x54, 0x98, 0xe5, 0xec, 0x25,
+  0xbe, 0x91, 0xf0, 0x1b, 0xea, 0x4a, 0x65, 0x09, 0xe5, 0x67, 0xd1, 0x74,
+  0xe6, 0x98, 0x46, 0x7e, 0x90, 0xdc, 0x68, 0x08, 0xd7, 0x65, 0x48, 0xdd,
+  0x7a, 0x9e, 0x5a, 0x35, 0xb9, 0x69, 0xec, 0x88, 0x60, 0xe8, 0x0e, 0xa1,
+  0xfb, 0xbf, 0x67, 0xef, 0x8a, 0xae, 0x70, 0xa1, 0xe8, 0xb7, 0x1e, 0x39,
+  0x72, 0x7f, 0x1b, 0x8b, 0xec, 0xcc, 0xa8, 0x66, 0xda, 0x0c, 0x38, 0xf0,
+  0x40, 0x9d, 0x48, 0x43, 0x05, 0x49, 0x60, 0x1f, 0xe7, 0x9d, 0xeb, 0x91,
+  0x5e, 0xfd, 0x23, 0x4a, 0xd0, 0x35, 0x23, 0xbf, 0xb1, 0x2f, 0xb1, 0x55,
+  0x5b, 0xe0, 0xc0, 0xfe, 0x9e, 0xf4, 0x9e, 0xfa, 0x29, 0xa3, 0xc9, 0x0b,
+  0xaf, 0xc7, 0x85, 0xdf, 0xc8, 0xb2, 0x19, 0x26, 0x05, 0x65, 0x3d, 0xcb,
+  0x21, 0x89, 0xbb, 0x14, 0xf9, 0xb0, 0x74, 0x6b, 0xce, 0xe2, 0x28, 0x4c,
+  0x9f, 0x52, 0x2e, 0x1a, 0x28, 0xee, 0x2e, 0x91, 0xc8, 0x05, 0x0d, 0xcf,
+  0x3f, 0xce, 0x9e, 0x57, 0x02, 0x87, 0x0c, 0xd5, 0x94, 0xb5, 0xde, 0x78,
+  0xed, 0xe0, 0xce, 0x67, 0x02, 0xde, 0x61, 0x2c, 0xd6, 0x46, 0xd0, 0x0e,
+  0x51, 0x42, 0x2b, 0x7b, 0x29, 0x46, 0xdd, 0xe5, 0x8d, 0x44, 0x3a, 0xb6,
+  0x02, 0x59, 0x8d, 0x57, 0xce, 0x2f, 0xb8, 0x1f, 0x68, 0x3d, 0xb2, 0x63,
+  0x8f, 0xf4, 0x68, 0xed, 0x58, 0xb7, 0x9b, 0xac, 0xa8, 0x7d, 0x68, 0xe8,
+  0x95, 0x4f, 0x2e, 0xf4, 0x2f, 0x6c, 0xb6, 0x71, 0xd8, 0xfe, 0x25, 0x11,
+  0x29, 0x07, 0xc4, 0xe0, 0x57, 0xdc, 0xe5, 0xf3, 0x4d, 0x6f, 0x82, 0x24,
+  0xc2, 0xe2, 0x34, 0x46, 0xda, 0x83, 0x72, 0xb4, 0xef, 0xe5, 0x86, 0x16,
+  0xc1, 0x43, 0xa9, 0x97, 0x44, 0xca, 0x28, 0x90, 0xbe, 0xce, 0x43, 0x9a,
+  0x8d, 0x71, 0x9e, 0x3e, 0xa8, 0x6f, 0x38, 0x65, 0x40, 0x12, 0x47, 0xb3,
+  0x12, 0xfd, 0x6b, 0xa6, 0x34, 0xef, 0x22, 0x57, 0x65, 0x53, 0x72, 0x00,
+  0x00, 0x00, 0x3c, 0x00, 0x74, 0x00, 0xae, 0x00, 0x00, 0x00, 0x3c, 0x00,
+  0x78, 0x00, 0xb0, 0x00, 0xe8, 0x00, 0x22, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x21, 0x00, 0x30, 0x00, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x1c, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x37, 0x00, 0x40, 0x00,
+  0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x34, 0x00, 0x00, 0x00, 0x22, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x0e, 0x00, 0x15, 0x00, 0x1c, 0x00,
+  0x23, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x27, 0x00,
+  0x30, 0x00, 0x00, 0x00, 0x07, 0x00, 0x0e, 0x00, 0x15, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x10, 0x00, 0x18, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x16, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x16, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x09, 0x00, 0x17, 0x00,
+  0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x0d, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x21, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x11, 0x00,
+  0x00, 0x00, 0x26, 0x00, 0x50, 0x00, 0x78, 0x00, 0x99, 0x00, 0xb6, 0x00,
+  0xd4, 0x00, 0xe9, 0x00, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00,
+  0x4c, 0x00, 0x72, 0x00, 0x91, 0x00, 0xad, 0x00, 0xca, 0x00, 0xeb, 0x00,
+  0x00, 0x00, 0x07, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x09, 0x00, 0x11, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00,
+  0x1a, 0x00, 0x21, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x00, 0x00, 0x1a, 0x00, 0x28, 0x00, 0x32, 0x00, 0x00, 0x00, 0x1d, 0x00,
+  0x45, 0x00, 0x66, 0x00, 0x89, 0x00, 0xa6, 0x00, 0xba, 0x00, 0xdb, 0x00,
+  0xe4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x41, 0x00, 0x61, 0x00,
+  0x82, 0x00, 0x9d, 0x00, 0xb5, 0x00, 0xd5, 0x00, 0x00, 0x00, 0x26, 0x00,
+  0x2d, 0x00, 0x34, 0x00, 0x41, 0x00, 0x49, 0x00, 0x55, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x15, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x24, 0x00, 0x2d, 0x00, 0x36, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x36, 0x00, 0x53, 0x00, 0x71, 0x00,
+  0x97, 0x00, 0xc1, 0x00, 0xe5, 0x00, 0xff, 0x00, 0x14, 0x01, 0x00, 0x00,
+  0x1c, 0x00, 0x32, 0x00, 0x38, 0x00, 0x42, 0x00, 0x00, 0x00, 0x34, 0x00,
+  0x4f, 0x00, 0x6b, 0x00, 0x90, 0x00, 0xb9, 0x00, 0xdc, 0x00, 0xf4, 0x00,
+  0x0a, 0x01, 0x00, 0x00, 0x1f, 0x00, 0x32, 0x00, 0x00, 0x00, 0x15, 0x00,
+  0x1d, 0x00, 0x25, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x31, 0x00,
+  0x00, 0x00, 0x1f, 0x00, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00,
+  0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x27, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x26, 0x00, 0x2f, 0x00, 0x38, 0x00, 0x41, 0x00, 0x4a, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x30, 0x00, 0x39, 0x00, 0x42, 0x00, 0x4b, 0x00, 0x54, 0x00,
+  0x5d, 0x00, 0x66, 0x00, 0x6f, 0x00, 0x78, 0x00, 0x81, 0x00, 0x8a, 0x00,
+  0x93, 0x00, 0x9c, 0x00, 0x00, 0x00, 0x23, 0x00, 0x4b, 0x00, 0x6b, 0x00,
+  0x00, 0x00, 0x18, 0x00, 0x1e, 0x00, 0x25, 0x00, 0x2c, 0x00, 0x33, 0x00,
+  0x00, 0x00, 0x21, 0x00, 0x47, 0x00, 0x66, 0x00, 0x89, 0x00, 0x9b, 0x00,
+  0xb2, 0x00, 0xbd, 0x00, 0xc6, 0x00, 0x00, 0x00, 0x12, 0x00, 0x27, 0x00,
+  0x34, 0x00, 0x00, 0x00, 0x11, 0x00, 0x27, 0x00, 0x43, 0x00, 0x00, 0x00,
+  0x3c, 0x00, 0x54, 0x00, 0x00, 0x00, 0x08, 0x00, 0x1e, 0x00, 0x29, 0x00,
+  0x33, 0x00, 0x00, 0x00, 0x19, 0x00, 0x35, 0x00, 0x46, 0x00, 0x59, 0x00,
+  0x69, 0x00, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x24, 0x00,
+  0x00, 0x00, 0x14, 0x00, 0x29, 0x00, 0x00, 0x00, 0x11, 0x00, 0x28, 0x00,
+  0x3b, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x3f, 0x00, 0x53, 0x00, 0x00, 0x00,
+  0x15, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x12, 0x00, 0x29, 0x00, 0x3c, 0x00,
+  0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x10, 0x00,
+  0x18, 0x00, 0x20, 0x00, 0x28, 0x00, 0x30, 0x00, 0x38, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x27, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x12, 0x00, 0x25, 0x00,
+  0x3a, 0x00, 0x00, 0x00, 0x16, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x18, 0x00,
+  0x2e, 0x00, 0x00, 0x00, 0x14, 0x00, 0x27, 0x00, 0x47, 0x00, 0x4e, 0x00,
+  0x00, 0x00, 0x15, 0x00, 0x28, 0x00, 0x3d, 0x00, 0x46, 0x00, 0x51, 0x00,
+  0x5e, 0x00, 0x67, 0x00, 0x70, 0x00, 0x79, 0x00, 0x00, 0x00, 0x17, 0x00,
+  0x2b, 0x00, 0x34, 0x00, 0x49, 0x00, 0x52, 0x00, 0x5b, 0x00, 0x64, 0x00,
+  0x6d, 0x00, 0x76, 0x00, 0x7f, 0x00, 0x88, 0x00, 0x91, 0x00, 0x9a, 0x00,
+  0xa3, 0x00, 0xac, 0x00, 0xb5, 0x00, 0xbe, 0x00, 0xc7, 0x00, 0xd0, 0x00,
+  0xd9, 0x00, 0xe2, 0x00, 0xeb, 0x00, 0xf4, 0x00, 0xfd, 0x00, 0x06, 0x01,
+  0x0f, 0x01, 0x18, 0x01, 0x21, 0x01, 0x2a, 0x01, 0x33, 0x01, 0x3c, 0x01,
+  0x45, 0x01, 0x4e, 0x01, 0x57, 0x01, 0x60, 0x01, 0x69, 0x01, 0x72, 0x01,
+  0x7b, 0x01, 0x84, 0x01, 0x8d, 0x01, 0x9e, 0x01, 0xa7, 0x01, 0xb0, 0x01,
+  0xb9, 0x01, 0xc2, 0x01, 0xcb, 0x01, 0xd4, 0x01, 0x00, 0x00, 0x15, 0x00,
+  0x2a, 0x00, 0x00, 0x00, 0x24, 0x00, 0x2b, 0x00, 0x32, 0x00, 0x39, 0x00,
+  0x40, 0x00, 0x47, 0x00, 0x00, 0x00, 0x16, 0x00, 0x32, 0x00, 0x3b, 0x00,
+  0x44, 0x00, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x26, 0x00,
+  0x37, 0x00, 0x48, 0x00, 0x65, 0x00, 0x6d, 0x00, 0x75, 0x00, 0x7d, 0x00,
+  0x00, 0x00, 0x1c, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x17, 0x00, 0x31, 0x00, 0x45, 0x00, 0x5e, 0x00, 0x6c, 0x00,
+  0x74, 0x00, 0x7c, 0x00, 0x84, 0x00, 0x8c, 0x00, 0x94, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x00,
+  0x00, 0x00, 0x20, 0x00, 0x34, 0x00, 0x46, 0x00, 0x4f, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00,
+  0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x0d, 0x00,
+  0x15, 0x00, 0x1d, 0x00, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x1a, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x12, 0x00, 0x23, 0x00, 0x2c, 0x00, 0x35, 0x00, 0x3e, 0x00,
+  0x46, 0x00, 0x4e, 0x00, 0x56, 0x00, 0x00, 0x00, 0x09, 0x00, 0x12, 0x00,
+  0x1b, 0x00, 0x24, 0x00, 0x2d, 0x00, 0x36, 0x00, 0x3f, 0x00, 0x48, 0x00,
+  0x51, 0x00, 0x5a, 0x00, 0x63, 0x00, 0x6c, 0x00, 0x75, 0x00, 0x7e, 0x00,
+  0x87, 0x00, 0x90, 0x00, 0x99, 0x00, 0xa2, 0x00, 0xab, 0x00, 0xb4, 0x00,
+  0xbd, 0x00, 0xc6, 0x00, 0xcf, 0x00, 0xd8, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x12, 0x00, 0x1a, 0x00, 0x22, 0x00, 0x2a, 0x00, 0x32, 0x00,
+  0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x08, 0x00,
+  0x10, 0x00, 0x18, 0x00, 0x20, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x21, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x10, 0x00,
+  0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x11, 0x00,
+  0x19, 0x00, 0x21, 0x00, 0x29, 0x00, 0x31, 0x00, 0x39, 0x00, 0x41, 0x00,
+  0x49, 0x00, 0x51, 0x00, 0x59, 0x00, 0x61, 0x00, 0x69, 0x00, 0x71, 0x00,
+  0x79, 0x00, 0x81, 0x00, 0x89, 0x00, 0x91, 0x00, 0x99, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x2c, 0x00, 0x35, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x12, 0x00, 0x1b, 0x00, 0x23, 0x00, 0x00, 0x00, 0x0a, 0x00,
+  0x00, 0x00, 0x07, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x09, 0x00, 0x12, 0x00,
+  0x1a, 0x00, 0x22, 0x00, 0x2a, 0x00, 0x32, 0x00, 0x3a, 0x00, 0x42, 0x00,
+  0x4a, 0x00, 0x52, 0x00, 0x5a, 0x00, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x21, 0x00,
+  0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x13, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00,
+  0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x07, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x19, 0x00, 0x29, 0x00, 0x00, 0x00, 0x07, 0x00,
+  0x0e, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x2a, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x19, 0x00, 0x20, 0x00, 0x27, 0x00, 0x2e, 0x00, 0x35, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x38, 0x00, 0x00, 0x00, 0x08, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x14, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x12, 0x00, 0x1b, 0x00, 0x24, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x19, 0x00,
+  0x00, 0x00, 0x0a, 0x00, 0x1b, 0x00, 0x2b, 0x00, 0x34, 0x00, 0x3d, 0x00,
+  0x46, 0x00, 0x4f, 0x00, 0x58, 0x00, 0x00, 0x00, 0x09, 0x00, 0x12, 0x00,
+  0x1b, 0x00, 0x24, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00,
+  0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x07, 0x00, 0x10, 0x00,
+  0x17, 0x00, 0x28, 0x00, 0x32, 0x00, 0x00, 0x00, 0x10, 0x00, 0x19, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x07, 0x00, 0x0e, 0x00,
+  0x00, 0x00, 0x0b, 0x00, 0x14, 0x00, 0x1d, 0x00, 0x26, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0b, 0x00, 0x12, 0x00, 0x19, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x18, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x22, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x18, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x00, 0x00, 0x20, 0x00, 0x28, 0x00, 0x30, 0x00, 0x38, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x27, 0x00,
+  0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x00,
+  0x2f, 0x00, 0x38, 0x00, 0x41, 0x00, 0x4a, 0x00, 0x53, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x09, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x10, 0x00, 0x18, 0x00,
+  0x20, 0x00, 0x28, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00,
+  0x22, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x1b, 0x00, 0x23, 0x00,
+  0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x16, 0x00,
+  0x00, 0x00, 0x08, 0x00, 0x10, 0x00, 0x18, 0x00, 0x20, 0x00, 0x28, 0x00,
+  0x30, 0x00, 0x38, 0x00, 0x40, 0x00, 0x48, 0x00, 0x50, 0x00, 0x58, 0x00,
+  0x60, 0x00, 0x67, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x14, 0x00,
+  0x00, 0x00, 0x14, 0x00, 0x1d, 0x00, 0x26, 0x00, 0x2f, 0x00, 0x38, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x13, 0x00, 0x1c, 0x00, 0x25, 0x00,
+  0x2e, 0x00, 0x37, 0x00, 0x40, 0x00, 0x49, 0x00, 0x52, 0x00, 0x5b, 0x00,
+  0x64, 0x00, 0x6d, 0x00, 0x76, 0x00, 0x7f, 0x00, 0x88, 0x00, 0x91, 0x00,
+  0x9a, 0x00, 0xa3, 0x00, 0xac, 0x00, 0xb5, 0x00, 0xbe, 0x00, 0xc7, 0x00,
+  0xd0, 0x00, 0xd9, 0x00, 0xe2, 0x00, 0xeb, 0x00, 0xf4, 0x00, 0xfd, 0x00,
+  0x06, 0x01, 0x0f, 0x01, 0x18, 0x01, 0x21, 0x01, 0x2a, 0x01, 0x33, 0x01,
+  0x3c, 0x01, 0x45, 0x01, 0x4e, 0x01, 0x57, 0x01, 0x60, 0x01, 0x69, 0x01,
+  0x00, 0x00, 0x09, 0x00, 0x12, 0x00, 0x00, 0x00, 0x07, 0x00, 0x0e, 0x00,
+  0x18, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x13, 0x00, 0x21, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x1d, 0x00, 0x27, 0x00, 0x00, 0x00, 0x08, 0x00, 0x10, 0x00,
+  0x18, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x2f, 0x00, 0x3a, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x13, 0x00, 0x26, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x29, 0x00, 0x38, 0x00, 0x40, 0x00, 0x48, 0x00, 0x50, 0x00, 0x5d, 0x00,
+  0x65, 0x00, 0x6d, 0x00, 0x75, 0x00, 0x7d, 0x00, 0x85, 0x00, 0x8d, 0x00,
+  0x95, 0x00, 0x9d, 0x00, 0xa5, 0x00, 0x00, 0x00, 0x21, 0x00, 0x34, 0x00,
+  0x00, 0x00, 0x21, 0x00, 0x30, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x2b, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x1d, 0x00, 0x2d, 0x00, 0x38, 0x00, 0x00, 0x00,
+  0x1f, 0x00, 0x26, 0x00, 0x2d, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x14, 0x00, 0x1c, 0x00,
+  0x24, 0x00, 0x2c, 0x00, 0x34, 0x00, 0x3c, 0x00, 0x44, 0x00, 0x4c, 0x00,
+  0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x00, 0x00, 0x11, 0x00, 0x1a, 0x00, 0x22, 0x00, 0x00, 0x00, 0x17, 0x00,
+  0x2c, 0x00, 0x41, 0x00, 0x00, 0x00, 0x09, 0x00, 0x11, 0x00, 0x19, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x14, 0x00, 0x1d, 0x00, 0x26, 0x00,
+  0x2f, 0x00, 0x38, 0x00, 0x41, 0x00, 0x4a, 0x00, 0x53, 0x00, 0x5c, 0x00,
+  0x65, 0x00, 0x6e, 0x00, 0x77, 0x00, 0x80, 0x00, 0x89, 0x00, 0x92, 0x00,
+  0x9b, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x1f, 0x00,
+  0x29, 0x00, 0x00, 0x00, 0x08, 0x00, 0x10, 0x00, 0x18, 0x00, 0x20, 0x00,
+  0x28, 0x00, 0x30, 0x00, 0x38, 0x00, 0x40, 0x00, 0x48, 0x00, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x2c, 0x00,
+  0x34, 0x00, 0x3c, 0x00, 0x44, 0x00, 0x4c, 0x00, 0x54, 0x00, 0x5c, 0x00,
+  0x64, 0x00, 0x6c, 0x00, 0x74, 0x00, 0x00, 0x00, 0x11, 0x00, 0x1d, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x22, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x11, 0x00,
+  0x19, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x0f, 0x00, 0x17, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x12, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x1a, 0x00, 0x22, 0x00, 0x2a, 0x00, 0x32, 0x00, 0x3a, 0x00, 0x42, 0x00,
+  0x4a, 0x00, 0x55, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x13, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x11, 0x00, 0x19, 0x00, 0x21, 0x00, 0x29, 0x00,
+  0x31, 0x00, 0x39, 0x00, 0x41, 0x00, 0x49, 0x00, 0x51, 0x00, 0x59, 0x00,
+  0x61, 0x00, 0x69, 0x00, 0x71, 0x00, 0x79, 0x00, 0x81, 0x00, 0x89, 0x00,
+  0x91, 0x00, 0x99, 0x00, 0xa1, 0x00, 0xa9, 0x00, 0xb1, 0x00, 0xb9, 0x00,
+  0xc1, 0x00, 0xc9, 0x00, 0xd1, 0x00, 0xd9, 0x00, 0xe1, 0x00, 0xe9, 0x00,
+  0xf1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x12, 0x00,
+  0x24, 0x00, 0x35, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1b, 0x00, 0x27, 0x00,
+  0x00, 0x00, 0x19, 0x00, 0x25, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x22, 0x00, 0x32, 0x00, 0x00, 0x00, 0x10, 0x00, 0x1c, 0x00,
+  0x00, 0x00, 0x13, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x19, 0x00,
+  0x00, 0x00, 0x1a, 0x00, 0x2b, 0x00, 0x39, 0x00, 0x00, 0x00, 0x18, 0x00,
+  0x2e, 0x00, 0x43, 0x00, 0x4d, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x1e, 0x00,
+  0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x24, 0x00,
+  0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0x18, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x17, 0x00, 0x2b, 0x00,
+  0x00, 0x00, 0x17, 0x00, 0x25, 0x00, 0x35, 0x00, 0x3d, 0x00, 0x45, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x10, 0x00, 0x18, 0x00, 0x00, 0x00,
+  0x23, 0x00, 0x00, 0x00, 0x17, 0x00, 0x2e, 0x00, 0x44, 0x00, 0x4c, 0x00,
+  0x5b, 0x00, 0x00, 0x00, 0x15, 0x00, 0x29, 0x00, 0x4e, 0x00, 0x5b, 0x00,
+  0x62, 0x00, 0x00, 0x00, 0x13, 0x00, 0x21, 0x00, 0x29, 0x00, 0x31, 0x00,
+  0x39, 0x00, 0x41, 0x00, 0x49, 0x00, 0x51, 0x00, 0x59, 0x00, 0x61, 0x00,
+  0x69, 0x00, 0x71, 0x00, 0x79, 0x00, 0x81, 0x00, 0x89, 0x00, 0x91, 0x00,
+  0x99, 0x00, 0xa1, 0x00, 0xa9, 0x00, 0xb1, 0x00, 0xb9, 0x00, 0xc1, 0x00,
+  0xc9, 0x00, 0xd1, 0x00, 0xd9, 0x00, 0xe1, 0x00, 0xe9, 0x00, 0xf1, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x26, 0x00, 0x32, 0x00,
+  0x00, 0x00, 0x16, 0x00, 0x24, 0x00, 0x00, 0x00, 0x15, 0x00, 0x1e, 0x00,
+  0x27, 0x00, 0x30, 0x00, 0x39, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x15, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x1e, 0x00, 0x35, 0x00, 0x5e, 0x00, 0x6c, 0x00, 0x00, 0x00,
+  0x16, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00,
+  0x1a, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x21, 0x00, 0x30, 0x00, 0x00, 0x00, 0x13, 0x00, 0x27, 0x00,
+  0x34, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x17, 0x00, 0x37, 0x00, 0x00, 0x00, 0x12, 0x00, 0x1b, 0x00,
+  0x24, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00,
+  0x1a, 0x00, 0x21, 0x00, 0x28, 0x00, 0x2f, 0x00, 0x36, 0x00, 0x3d, 0x00,
+  0x00, 0x00, 0x14, 0x00, 0x27, 0x00, 0x3b, 0x00, 0x44, 0x00, 0x4d, 0x00,
+  0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x13, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x20, 0x00, 0x29, 0x00,
+  0x32, 0x00, 0x3b, 0x00, 0x44, 0x00, 0x4d, 0x00, 0x56, 0x00, 0x5f, 0x00,
+  0x68, 0x00, 0x71, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x11, 0x00, 0x24, 0x00,
+  0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x06, 0x00,
+  0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x1d, 0x00, 0x24, 0x00,
+  0x2b, 0x00, 0x32, 0x00, 0x39, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x17, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x16, 0x00, 0x23, 0x00, 0x2a, 0x00,
+  0x31, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x12, 0x00, 0x1b, 0x00, 0x24, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x12, 0x00, 0x1b, 0x00, 0x24, 0x00, 0x2d, 0x00, 0x36, 0x00, 0x3f, 0x00,
+  0x4d, 0x00, 0x56, 0x00, 0x00, 0x00, 0x17, 0x00, 0x21, 0x00, 0x34, 0x00,
+  0x4a, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x16, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x22, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00,
+  0x23, 0x00, 0x00, 0x00, 0x09, 0x00, 0x12, 0x00, 0x00, 0x00, 0x14, 0x00,
+  0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x33, 0x00, 0x39, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x12, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x16, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x12, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x12, 0x00,
+  0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x23, 0x00, 0x2b, 0x00,
+  0x33, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x12, 0x00,
+  0x1b, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x07, 0x00, 0x0e, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00,
+  0x16, 0x00, 0x00, 0x00, 0x24, 0x00, 0x35, 0x00, 0x3d, 0x00, 0x45, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x1a, 0x00, 0x23, 0x00, 0x34, 0x00,
+  0x3f, 0x00, 0x4a, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x1b, 0x00,
+  0x25, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x23, 0x00, 0x2b, 0x00, 0x33, 0x00,
+  0x3b, 0x00, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x16, 0x00,
+  0x1e, 0x00, 0x26, 0x00, 0x2e, 0x00, 0x36, 0x00, 0x3e, 0x00, 0x46, 0x00,
+  0x54, 0x00, 0x5c, 0x00, 0x64, 0x00, 0x6c, 0x00, 0x74, 0x00, 0x7c, 0x00,
+  0x84, 0x00, 0x8c, 0x00, 0x94, 0x00, 0x9c, 0x00, 0x00, 0x00, 0x07, 0x00,
+  0x0e, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x15, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1b, 0x00, 0x22, 0x00,
+  0x29, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x39, 0x00, 0x42, 0x00, 0x00, 0x00,
+  0x27, 0x00, 0x37, 0x00, 0x00, 0x00, 0x22, 0x00, 0x3d, 0x00, 0x4f, 0x00,
+  0x00, 0x00, 0x1f, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x10, 0x00,
+  0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x29, 0x00, 0x43, 0x00,
+  0x58, 0x00, 0x60, 0x00, 0x68, 0x00, 0x70, 0x00, 0x78, 0x00, 0x80, 0x00,
+  0x88, 0x00, 0x90, 0x00, 0x98, 0x00, 0xac, 0x00, 0x00, 0x00, 0x0f, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x1d, 0x00, 0x32, 0x00, 0x00, 0x00, 0x13, 0x00,
+  0x21, 0x00, 0x00, 0x00, 0x13, 0x00, 0x25, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x20, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x19, 0x00, 0x34, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00,
+  0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1a, 0x00, 0x20, 0x00,
+  0x26, 0x00, 0x00, 0x00, 0x19, 0x00, 0x31, 0x00, 0x47, 0x00, 0x5f, 0x00,
+  0x7c, 0x00, 0x8d, 0x00, 0x95, 0x00, 0x00, 0x00, 0x15, 0x00, 0x2e, 0x00,
+  0x44, 0x00, 0x63, 0x00, 0x83, 0x00, 0x8c, 0x00, 0x00, 0x00, 0x19, 0x00,
+  0x26, 0x00, 0x38, 0x00, 0x58, 0x00, 0x62, 0x00, 0x89, 0x00, 0x91, 0x00,
+  0x99, 0x00, 0xa1, 0x00, 0xa9, 0x00, 0xb1, 0x00, 0xb9, 0x00, 0xc1, 0x00,
+  0xc9, 0x00, 0xcf, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x24, 0x00, 0x39, 0x00,
+  0x4c, 0x00, 0x56, 0x00, 0x66, 0x00, 0x00, 0x00, 0x10, 0x00, 0x20, 0x00,
+  0x2d, 0x00, 0x43, 0x00, 0x63, 0x00, 0x6b, 0x00, 0x00, 0x00, 0x0f, 0x00,
+  0x20, 0x00, 0x2d, 0x00, 0x4d, 0x00, 0x74, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x1f, 0x00, 0x33, 0x00, 0x48, 0x00, 0x6c, 0x00, 0x7d, 0x00,
+  0x86, 0x00, 0x8f, 0x00, 0x98, 0x00, 0xa1, 0x00, 0xaa, 0x00, 0xb3, 0x00,
+  0xbb, 0x00, 0xc3, 0x00, 0xcb, 0x00, 0xd3, 0x00, 0xe1, 0x00, 0xe9, 0x00,
+  0xf1, 0x00, 0xf9, 0x00, 0x01, 0x01, 0x09, 0x01, 0x13, 0x01, 0x00, 0x00,
+  0x0d, 0x00, 0x1d, 0x00, 0x2e, 0x00, 0x40, 0x00, 0x00, 0x00, 0x13, 0x00,
+  0x1f, 0x00, 0x2b, 0x00, 0x3b, 0x00, 0x4f, 0x00, 0x00, 0x00, 0x11, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x11, 0x00, 0x1d, 0x00, 0x2e, 0x00, 0x36, 0x00,
+  0x3e, 0x00, 0x00, 0x00, 0x15, 0x00, 0x23, 0x00, 0x39, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x23, 0x00, 0x4e, 0x00, 0x65, 0x00, 0x6d, 0x00, 0x75, 0x00,
+  0x00, 0x00, 0x1a, 0x00, 0x2c, 0x00, 0x52, 0x00, 0x73, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x1f, 0x00, 0x2e, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x15, 0x00,
+  0x26, 0x00, 0x00, 0x00, 0x16, 0x00, 0x20, 0x00, 0x36, 0x00, 0x44, 0x00,
+  0x52, 0x00, 0x5a, 0x00, 0x62, 0x00, 0x6a, 0x00, 0x73, 0x00, 0x00, 0x00,
+  0x16, 0x00, 0x29, 0x00, 0x40, 0x00, 0x59, 0x00, 0x6e, 0x00, 0x00, 0x00,
+  0x3e, 0x00, 0x49, 0x00, 0x57, 0x00, 0x68, 0x00, 0x73, 0x00, 0x00, 0x00,
+  0x3f, 0x00, 0x4b, 0x00, 0x5f, 0x00, 0x7e, 0x00, 0x8b, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x23, 0x00, 0x39, 0x00, 0x53, 0x00, 0x5e, 0x00, 0x7a, 0x00,
+  0x86, 0x00, 0x00, 0x00, 0x18, 0x00, 0x26, 0x00, 0x35, 0x00, 0x4e, 0x00,
+  0x5f, 0x00, 0x75, 0x00, 0x00, 0x00, 0x16, 0x00, 0x21, 0x00, 0x31, 0x00,
+  0x3e, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x13, 0x00, 0x21, 0x00, 0x39, 0x00,
+  0x46, 0x00, 0x63, 0x00, 0x75, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x0b, 0x00,
+  0x29, 0x00, 0x3c, 0x00, 0x48, 0x00, 0x67, 0x00, 0x83, 0x00, 0x95, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x1c, 0x00, 0x30, 0x00, 0x3d, 0x00, 0x68, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x1d, 0x00, 0x2b, 0x00, 0x4a, 0x00, 0x5f, 0x00,
+  0x00, 0x00, 0x0b, 0x00, 0x19, 0x00, 0x2d, 0x00, 0x3a, 0x00, 0x4c, 0x00,
+  0x68, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x54, 0x00, 0x6a, 0x00, 0x79, 0x00,
+  0x00, 0x00, 0x28, 0x00, 0x62, 0x00, 0x74, 0x00, 0x89, 0x00, 0x9e, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x2e, 0x00, 0x47, 0x00, 0x62, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x1c, 0x00, 0x38, 0x00, 0x52, 0x00, 0x70, 0x00, 0x7c, 0x00,
+  0x00, 0x00, 0x14, 0x00, 0x23, 0x00, 0x37, 0x00, 0x42, 0x00, 0x54, 0x00,
+  0x64, 0x00, 0x74, 0x00, 0x85, 0x00, 0x00, 0x00, 0x10, 0x00, 0x26, 0x00,
+  0x39, 0x00, 0x45, 0x00, 0x53, 0x00, 0x64, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x1d, 0x00, 0x38, 0x00, 0x57, 0x00, 0x71, 0x00, 0x95, 0x00, 0xb5, 0x00,
+  0xd2, 0x00, 0xe9, 0x00, 0xf8, 0x00, 0x06, 0x01, 0x12, 0x01, 0x1f, 0x01,
+  0x36, 0x01, 0x4a, 0x01, 0x5a, 0x01, 0x62, 0x01, 0x6a, 0x01, 0x72, 0x01,
+  0x7a, 0x01, 0x82, 0x01, 0x8a, 0x01, 0x92, 0x01, 0x9a, 0x01, 0xa2, 0x01,
+  0xaa, 0x01, 0xb2, 0x01, 0xba, 0x01, 0xc2, 0x01, 0x00, 0x00, 0x15, 0x00,
+  0x3b, 0x00, 0x49, 0x00, 0x54, 0x00, 0x66, 0x00, 0x77, 0x00, 0x8f, 0x00,
+  0x9f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x3c, 0x00, 0x5c, 0x00, 0x78, 0x00,
+  0x9d, 0x00, 0xbe, 0x00, 0xdd, 0x00, 0xee, 0x00, 0x15, 0x01, 0x28, 0x01,
+  0x36, 0x01, 0x54, 0x01, 0x6c, 0x01, 0x8b, 0x01, 0x9d, 0x01, 0xa5, 0x01,
+  0xad, 0x01, 0xbc, 0x01, 0xc4, 0x01, 0xcc, 0x01, 0x00, 0x00, 0x29, 0x00,
+  0x38, 0x00, 0x59, 0x00, 0x6c, 0x00, 0x79, 0x00, 0x8f, 0x00, 0xa4, 0x00,
+  0xb3, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x22, 0x00, 0x31, 0x00, 0x3c, 0x00,
+  0x4d, 0x00, 0x5e, 0x00, 0x70, 0x00, 0x80, 0x00, 0x89, 0x00, 0x92, 0x00,
+  0x9b, 0x00, 0xa3, 0x00, 0xab, 0x00, 0xb3, 0x00, 0xbb, 0x00, 0xc3, 0x00,
+  0xcb, 0x00, 0xd3, 0x00, 0xdb, 0x00, 0xe3, 0x00, 0xeb, 0x00, 0xf3, 0x00,
+  0x00, 0x00, 0x2a, 0x00, 0x3d, 0x00, 0x4d, 0x00, 0x5a, 0x00, 0x66, 0x00,
+  0x75, 0x00, 0x87, 0x00, 0xa3, 0x00, 0x00, 0x00, 0x14, 0x00, 0x25, 0x00,
+  0x35, 0x00, 0x4a, 0x00, 0x60, 0x00, 0x74, 0x00, 0x83, 0x00, 0x8b, 0x00,
+  0x00, 0x00, 0x1a, 0x00, 0x26, 0x00, 0x34, 0x00, 0x4e, 0x00, 0x65, 0x00,
+  0x72, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x1e, 0x00, 0x29, 0x00, 0x35, 0x00,
+  0x41, 0x00, 0x00, 0x00, 0x13, 0x00, 0x20, 0x00, 0x2d, 0x00, 0x42, 0x00,
+  0x59, 0x00, 0x69, 0x00, 0x00, 0x00, 0x16, 0x00, 0x2a, 0x00, 0x37, 0x00,
+  0x43, 0x00, 0x55, 0x00, 0x61, 0x00, 0x6d, 0x00, 0x00, 0x00, 0x12, 0x00,
+  0x1e, 0x00, 0x29, 0x00, 0x3c, 0x00, 0x52, 0x00, 0x62, 0x00, 0x71, 0x00,
+  0x00, 0x00, 0x24, 0x00, 0x34, 0x00, 0x40, 0x00, 0x53, 0x00, 0x66, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x1f, 0x00, 0x2c, 0x00, 0x3e, 0x00, 0x5a, 0x00,
+  0x68, 0x00, 0x79, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x2c, 0x00,
+  0x3a, 0x00, 0x4a, 0x00, 0x57, 0x00, 0x68, 0x00, 0x76, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x2c, 0x00, 0x3f, 0x00, 0x54, 0x00, 0x75, 0x00, 0x8a, 0x00,
+  0xa3, 0x00, 0x00, 0x00, 0x19, 0x00, 0x2b, 0x00, 0x39, 0x00, 0x44, 0x00,
+  0x59, 0x00, 0x6a, 0x00, 0x00, 0x00, 0x12, 0x00, 0x2c, 0x00, 0x3f, 0x00,
+  0x54, 0x00, 0x61, 0x00, 0x71, 0x00, 0x85, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x31, 0x00, 0x46, 0x00, 0x5c, 0x00, 0x70, 0x00, 0x7d, 0x00, 0x9d, 0x00,
+  0x00, 0x00, 0x17, 0x00, 0x24, 0x00, 0x39, 0x00, 0x58, 0x00, 0x68, 0x00,
+  0x82, 0x00, 0x92, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x2d, 0x00, 0x41, 0x00,
+  0x56, 0x00, 0x76, 0x00, 0x87, 0x00, 0xa6, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x33, 0x00, 0x3f, 0x00, 0x52, 0x00, 0x73, 0x00, 0x97, 0x00, 0xb1, 0x00,
+  0x00, 0x00, 0x11, 0x00, 0x1c, 0x00, 0x2e, 0x00, 0x3c, 0x00, 0x4e, 0x00,
+  0x5e, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x20, 0x00, 0x35, 0x00, 0x43, 0x00,
+  0x55, 0x00, 0x63, 0x00, 0x75, 0x00, 0x80, 0x00, 0x88, 0x00, 0x8f, 0x00,
+  0x00, 0x00, 0x13, 0x00, 0x26, 0x00, 0x41, 0x00, 0x50, 0x00, 0x5f, 0x00,
+  0x75, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x16, 0x00, 0x2b, 0x00, 0x3f, 0x00,
+  0x4e, 0x00, 0x5f, 0x00, 0x6b, 0x00, 0x00, 0x00, 0x14, 0x00, 0x25, 0x00,
+  0x33, 0x00, 0x4c, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x12, 0x00, 0x1d, 0x00,
+  0x2b, 0x00, 0x36, 0x00, 0x43, 0x00, 0x5a, 0x00, 0x67, 0x00, 0x00, 0x00,
+  0x18, 0x00, 0x2c, 0x00, 0x48, 0x00, 0x54, 0x00, 0x67, 0x00, 0x77, 0x00,
+  0x00, 0x00, 0x1f, 0x00, 0x34, 0x00, 0x40, 0x00, 0x62, 0x00, 0x73, 0x00,
+  0x80, 0x00, 0x95, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x2e, 0x00, 0x3a, 0x00,
+  0x6a, 0x00, 0x7e, 0x00, 0x8c, 0x00, 0x00, 0x00, 0x12, 0x00, 0x2a, 0x00,
+  0x5a, 0x00, 0x65, 0x00, 0x72, 0x00, 0x00, 0x00, 0x27, 0x00, 0x41, 0x00,
+  0x67, 0x00, 0x82, 0x00, 0xa7, 0x00, 0xcb, 0x00, 0xee, 0x00, 0x17, 0x01,
+  0x39, 0x01, 0x59, 0x01, 0x6a, 0x01, 0x8b, 0x01, 0xa1, 0x01, 0xbf, 0x01,
+  0xce, 0x01, 0xe5, 0x01, 0xee, 0x01, 0xf6, 0x01, 0x00, 0x00, 0x10, 0x00,
+  0x1f, 0x00, 0x37, 0x00, 0x48, 0x00, 0x54, 0x00, 0x00, 0x00, 0x29, 0x00,
+  0x45, 0x00, 0x6d, 0x00, 0x8a, 0x00, 0xb1, 0x00, 0xd7, 0x00, 0xfc, 0x00,
+  0x27, 0x01, 0x4a, 0x01, 0x6c, 0x01, 0x7d, 0x01, 0x8f, 0x01, 0xa1, 0x01,
+  0xb6, 0x01, 0xd1, 0x01, 0xe6, 0x01, 0x00, 0x00, 0x22, 0x00, 0x33, 0x00,
+  0x43, 0x00, 0x54, 0x00, 0x63, 0x00, 0x82, 0x00, 0x98, 0x00, 0xa2, 0x00,
+  0xa9, 0x00, 0x00, 0x00, 0x11, 0x00, 0x1c, 0x00, 0x48, 0x00, 0x5c, 0x00,
+  0x6e, 0x00, 0x84, 0x00, 0x8c, 0x00, 0x94, 0x00, 0x9c, 0x00, 0xa4, 0x00,
+  0xac, 0x00, 0xb4, 0x00, 0xbc, 0x00, 0xc4, 0x00, 0xcc, 0x00, 0xd4, 0x00,
+  0xdc, 0x00, 0xe4, 0x00, 0xec, 0x00, 0xf4, 0x00, 0xfc, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x2b, 0x00, 0x57, 0x00, 0x66, 0x00, 0x7f, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x21, 0x00, 0x39, 0x00, 0x4c, 0x00, 0x5e, 0x00, 0x7b, 0x00,
+  0x8d, 0x00, 0x9c, 0x00, 0xab, 0x00, 0xb4, 0x00, 0x00, 0x00, 0x12, 0x00,
+  0x22, 0x00, 0x32, 0x00, 0x42, 0x00, 0x53, 0x00, 0x6e, 0x00, 0x7c, 0x00,
+  0x00, 0x00, 0x11, 0x00, 0x24, 0x00, 0x2f, 0x00, 0x44, 0x00, 0x5c, 0x00,
+  0x69, 0x00, 0x00, 0x00, 0x10, 0x00, 0x27, 0x00, 0x3f, 0x00, 0x51, 0x00,
+  0x6f, 0x00, 0x7d, 0x00, 0x00, 0x00, 0x11, 0x00, 0x39, 0x00, 0x47, 0x00,
+  0x63, 0x00, 0x6f, 0x00, 0x84, 0x00, 0x92, 0x00, 0xa4, 0x00, 0xad, 0x00,
+  0xb6, 0x00, 0xbf, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x10, 0x00, 0x24, 0x00,
+  0x32, 0x00, 0x49, 0x00, 0x5b, 0x00, 0x70, 0x00, 0x7f, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x23, 0x00, 0x32, 0x00, 0x45, 0x00, 0x57, 0x00, 0x67, 0x00,
+  0x76, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x36, 0x00, 0x48, 0x00, 0x5e, 0x00,
+  0x70, 0x00, 0x85, 0x00, 0x00, 0x00, 0x22, 0x00, 0x4a, 0x00, 0x5a, 0x00,
+  0x67, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x40, 0x00, 0x4f, 0x00, 0x59, 0x00,
+  0x00, 0x00, 0x18, 0x00, 0x42, 0x00, 0x58, 0x00, 0x6b, 0x00, 0x80, 0x00,
+  0x00, 0x00, 0x17, 0x00, 0x30, 0x00, 0x5e, 0x00, 0x72, 0x00, 0x8c, 0x00,
+  0xa0, 0x00, 0x00, 0x00, 0x17, 0x00, 0x37, 0x00, 0x44, 0x00, 0x57, 0x00,
+  0x6a, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x18, 0x00, 0x4e, 0x00, 0x65, 0x00,
+  0x7c, 0x00, 0x8b, 0x00, 0x9d, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x18, 0x00,
+  0x43, 0x00, 0x57, 0x00, 0x6b, 0x00, 0x77, 0x00, 0x8c, 0x00, 0x00, 0x00,
+  0x16, 0x00, 0x3c, 0x00, 0x67, 0x00, 0x77, 0x00, 0x8e, 0x00, 0x9f, 0x00,
+  0x00, 0x00, 0x19, 0x00, 0x35, 0x00, 0x43, 0x00, 0x55, 0x00, 0x64, 0x00,
+  0x75, 0x00, 0x85, 0x00, 0x99, 0x00, 0xa7, 0x00, 0xaf, 0x00, 0x00, 0x00,
+  0x21, 0x00, 0x40, 0x00, 0x4b, 0x00, 0x5c, 0x00, 0x6c, 0x00, 0x83, 0x00,
+  0x96, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x31, 0x00, 0x43, 0x00, 0x54, 0x00,
+  0x6c, 0x00, 0x78, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x2e, 0x00, 0x41, 0x00,
+  0x4e, 0x00, 0x5f, 0x00, 0x74, 0x00, 0x00, 0x00, 0x18, 0x00, 0x2a, 0x00,
+  0x3c, 0x00, 0x4a, 0x00, 0x5e, 0x00, 0x00, 0x00, 0x23, 0x00, 0x36, 0x00,
+  0x56, 0x00, 0x6c, 0x00, 0x7f, 0x00, 0x94, 0x00, 0xa3, 0x00, 0x00, 0x00,
+  0x24, 0x00, 0x33, 0x00, 0x43, 0x00, 0x53, 0x00, 0x70, 0x00, 0x86, 0x00,
+  0x00, 0x00, 0x21, 0x00, 0x2e, 0x00, 0x3f, 0x00, 0x50, 0x00, 0x64, 0x00,
+  0x78, 0x00, 0x00, 0x00, 0x14, 0x00, 0x26, 0x00, 0x53, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x2c, 0x00, 0x40, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x12, 0x00,
+  0x32, 0x00, 0x42, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x25, 0x00,
+  0x44, 0x00, 0x56, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x18, 0x00, 0x2f, 0x00,
+  0x54, 0x00, 0x00, 0x00, 0x12, 0x00, 0x1f, 0x00, 0x37, 0x00, 0x50, 0x00,
+  0x59, 0x00, 0x62, 0x00, 0x6b, 0x00, 0x74, 0x00, 0x7d, 0x00, 0x00, 0x00,
+  0x1a, 0x00, 0x42, 0x00, 0x59, 0x00, 0x68, 0x00, 0x7d, 0x00, 0x84, 0x00,
+  0x8b, 0x00, 0x93, 0x00, 0x9c, 0x00, 0x00, 0x00, 0x16, 0x00, 0x30, 0x00,
+  0x48, 0x00, 0x5a, 0x00, 0x6d, 0x00, 0x76, 0x00, 0x7e, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x35, 0x00, 0x58, 0x00, 0x63, 0x00, 0x72, 0x00, 0x80, 0x00,
+  0x00, 0x00, 0x18, 0x00, 0x41, 0x00, 0x52, 0x00, 0x5f, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x28, 0x00, 0x34, 0x00, 0x48, 0x00, 0x6e, 0x00, 0x74, 0x00,
+  0x7e, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x3c, 0x00, 0x48, 0x00, 0x55, 0x00,
+  0x00, 0x00, 0x1a, 0x00, 0x26, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x25, 0x00,
+  0x36, 0x00, 0x4c, 0x00, 0x5e, 0x00, 0x6f, 0x00, 0x78, 0x00, 0x81, 0x00,
+  0x8a, 0x00, 0x93, 0x00, 0x9c, 0x00, 0xa5, 0x00, 0xae, 0x00, 0xb7, 0x00,
+  0xc0, 0x00, 0xc9, 0x00, 0xd2, 0x00, 0xdb, 0x00, 0xe4, 0x00, 0xf8, 0x00,
+  0x01, 0x01, 0x00, 0x00, 0x13, 0x00, 0x3f, 0x00, 0x50, 0x00, 0x61, 0x00,
+  0x71, 0x00, 0x78, 0x00, 0x00, 0x00, 0x16, 0x00, 0x2f, 0x00, 0x4a, 0x00,
+  0x5c, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x13, 0x00, 0x2d, 0x00, 0x3e, 0x00,
+  0x00, 0x00, 0x15, 0x00, 0x2c, 0x00, 0x3f, 0x00, 0x50, 0x00, 0x56, 0x00,
+  0x00, 0x00, 0x20, 0x00, 0x31, 0x00, 0x49, 0x00, 0x00, 0x00, 0x19, 0x00,
+  0x28, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x23, 0x00, 0x35, 0x00,
+  0x00, 0x00, 0x16, 0x00, 0x3c, 0x00, 0x53, 0x00, 0x5a, 0x00, 0x00, 0x00,
+  0x2b, 0x00, 0x37, 0x00, 0x63, 0x00, 0x79, 0x00, 0x84, 0x00, 0x00, 0x00,
+  0x29, 0x00, 0x46, 0x00, 0x67, 0x00, 0x7a, 0x00, 0x86, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x35, 0x00, 0x53, 0x00, 0x77, 0x00, 0x7d, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x1f, 0x00, 0x48, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x11, 0x00,
+  0x25, 0x00, 0x4e, 0x00, 0x68, 0x00, 0x70, 0x00, 0x78, 0x00, 0x00, 0x00,
+  0x16, 0x00, 0x2a, 0x00, 0x3b, 0x00, 0x5c, 0x00, 0x6b, 0x00, 0x85, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x27, 0x00, 0x00, 0x00, 0x12, 0x00, 0x2f, 0x00,
+  0x00, 0x00, 0x15, 0x00, 0x4f, 0x00, 0x67, 0x00, 0x00, 0x00, 0x0b, 0x00,
+  0x2f, 0x00, 0x47, 0x00, 0x4f, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x38, 0x00,
+  0x4f, 0x00, 0x56, 0x00, 0x5d, 0x00, 0x64, 0x00, 0x6b, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x25, 0x00, 0x2d, 0x00, 0x35, 0x00, 0x3e, 0x00, 0x47, 0x00,
+  0x4f, 0x00, 0x57, 0x00, 0x5f, 0x00, 0x68, 0x00, 0x6f, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x24, 0x00, 0x47, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
+  0x19, 0x00, 0x3a, 0x00, 0x41, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x3a, 0x00,
+  0x47, 0x00, 0x50, 0x00, 0x00, 0x00, 0x21, 0x00, 0x39, 0x00, 0x00, 0x00,
+  0x1e, 0x00, 0x2f, 0x00, 0x46, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x0f, 0x00,
+  0x22, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x20, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x19, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x16, 0x00, 0x2b, 0x00, 0x41, 0x00,
+  0x56, 0x00, 0x6b, 0x00, 0x81, 0x00, 0x95, 0x00, 0xaf, 0x00, 0xc5, 0x00,
+  0xe1, 0x00, 0xf7, 0x00, 0x00, 0x00, 0x12, 0x00, 0x2a, 0x00, 0x31, 0x00,
+  0x38, 0x00, 0x3f, 0x00, 0x46, 0x00, 0x00, 0x00, 0x11, 0x00, 0x2e, 0x00,
+  0x00, 0x00, 0x11, 0x00, 0x21, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x12, 0x00,
+  0x21, 0x00, 0x3b, 0x00, 0x57, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1c, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x18, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x28, 0x00,
+  0x38, 0x00, 0x41, 0x00, 0x50, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x17, 0x00, 0x27, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x18, 0x00,
+  0x44, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x11, 0x00, 0x33, 0x00, 0x64, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x28, 0x00, 0x45, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x25, 0x00, 0x43, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x21, 0x00, 0x3e, 0x00,
+  0x44, 0x00, 0x4a, 0x00, 0x67, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x19, 0x00,
+  0x39, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x09, 0x00, 0x12, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x13, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x0e, 0x00, 0x15, 0x00, 0x1c, 0x00, 0x24, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x12, 0x00, 0x00, 0x00, 0x19, 0x00, 0x21, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x11, 0x00, 0x18, 0x00, 0x24, 0x00, 0x00, 0x00, 0x1f, 0x00,
+  0x32, 0x00, 0x00, 0x00, 0x15, 0x00, 0x28, 0x00, 0x00, 0x00, 0x15, 0x00,
+  0x29, 0x00, 0x3e, 0x00, 0x53, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x24, 0x00,
+  0x2b, 0x00, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x31, 0x00,
+  0x45, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x17, 0x00, 0x2a, 0x00, 0x30, 0x00,
+  0x00, 0x00, 0x13, 0x00, 0x3b, 0x00, 0x53, 0x00, 0x5f, 0x00, 0x00, 0x00,
+  0x16, 0x00, 0x29, 0x00, 0x38, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x34, 0x00,
+  0x4b, 0x00, 0x54, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x10, 0x00, 0x27, 0x00,
+  0x45, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x10, 0x00, 0x26, 0x00, 0x33, 0x00,
+  0x3b, 0x00, 0x43, 0x00, 0x4b, 0x00, 0x53, 0x00, 0x5b, 0x00, 0x63, 0x00,
+  0x6b, 0x00, 0x73, 0x00, 0x7b, 0x00, 0x83, 0x00, 0x8b, 0x00, 0x93, 0x00,
+  0x9b, 0x00, 0xa3, 0x00, 0xab, 0x00, 0xb3, 0x00, 0xbb, 0x00, 0xc3, 0x00,
+  0xcb, 0x00, 0xd3, 0x00, 0xdb, 0x00, 0xe3, 0x00, 0x00, 0x00, 0x0f, 0x00,
+  0x15, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x13, 0x00,
+  0x2f, 0x00, 0x40, 0x00, 0x4f, 0x00, 0x60, 0x00, 0x00, 0x00, 0x3d, 0x00,
+  0x54, 0x00, 0x68, 0x00, 0x7a, 0x00, 0x84, 0x00, 0xa3, 0x00, 0xac, 0x00,
+  0xb5, 0x00, 0xbe, 0x00, 0xc6, 0x00, 0xcf, 0x00, 0xd7, 0x00, 0xe7, 0x00,
+  0x00, 0x00, 0x13, 0x00, 0x27, 0x00, 0x3d, 0x00, 0x57, 0x00, 0x7a, 0x00,
+  0x82, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x1d, 0x00, 0x42, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x2d, 0x00, 0x3c, 0x00, 0x78, 0x00, 0x81, 0x00, 0x8a, 0x00,
+  0x93, 0x00, 0x9b, 0x00, 0x00, 0x00, 0x10, 0x00, 0x1c, 0x00, 0x30, 0x00,
+  0x44, 0x00, 0x55, 0x00, 0x5e, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1b, 0x00,
+  0x47, 0x00, 0x51, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x17, 0x00, 0x28, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x16, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x00, 0x00, 0x16, 0x00, 0x25, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x30, 0x00,
+  0x41, 0x00, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x26, 0x00,
+  0x2e, 0x00, 0x36, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1c, 0x00, 0x2f, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x1f, 0x00, 0x2e, 0x00, 0x3e, 0x00, 0x57, 0x00, 0x5f, 0x00,
+  0x67, 0x00, 0x6f, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1e, 0x00, 0x2b, 0x00,
+  0x40, 0x00, 0x4a, 0x00, 0x54, 0x00, 0x00, 0x00, 0x12, 0x00, 0x31, 0x00,
+  0x40, 0x00, 0x4f, 0x00, 0x00, 0x00, 0x14, 0x00, 0x22, 0x00, 0x30, 0x00,
+  0x3d, 0x00, 0x00, 0x00, 0x15, 0x00, 0x2a, 0x00, 0x42, 0x00, 0x4f, 0x00,
+  0x5f, 0x00, 0x00, 0x00, 0x14, 0x00, 0x25, 0x00, 0x3c, 0x00, 0x47, 0x00,
+  0x58, 0x00, 0x65, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x20, 0x00, 0x34, 0x00,
+  0x4c, 0x00, 0x69, 0x00, 0x7b, 0x00, 0x87, 0x00, 0x9a, 0x00, 0x00, 0x00,
+  0x18, 0x00, 0x41, 0x00, 0x5a, 0x00, 0x69, 0x00, 0x7e, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x28, 0x00, 0x3d, 0x00, 0x49, 0x00, 0x5a, 0x00, 0x6c, 0x00,
+  0x00, 0x00, 0x13, 0x00, 0x2d, 0x00, 0x3f, 0x00, 0x4a, 0x00, 0x60, 0x00,
+  0x75, 0x00, 0x00, 0x00, 0x11, 0x00, 0x2a, 0x00, 0x45, 0x00, 0x51, 0x00,
+  0x65, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x30, 0x00, 0x47, 0x00,
+  0x5d, 0x00, 0x76, 0x00, 0x87, 0x00, 0x94, 0x00, 0x00, 0x00, 0x24, 0x00,
+  0x34, 0x00, 0x52, 0x00, 0x75, 0x00, 0x84, 0x00, 0x94, 0x00, 0xad, 0x00,
+  0xb5, 0x00, 0xbd, 0x00, 0xc5, 0x00, 0xcd, 0x00, 0xd5, 0x00, 0xdd, 0x00,
+  0xe5, 0x00, 0xed, 0x00, 0xf5, 0x00, 0xfd, 0x00, 0x00, 0x00, 0x11, 0x00,
+  0x27, 0x00, 0x3d, 0x00, 0x58, 0x00, 0x67, 0x00, 0x78, 0x00, 0x88, 0x00,
+  0x91, 0x00, 0xa3, 0x00, 0xb2, 0x00, 0xbb, 0x00, 0xcd, 0x00, 0xd6, 0x00,
+  0x00, 0x00, 0x14, 0x00, 0x36, 0x00, 0x4a, 0x00, 0x63, 0x00, 0x6f, 0x00,
+  0x87, 0x00, 0xa9, 0x00, 0xb8, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x17, 0x00,
+  0x2b, 0x00, 0x3d, 0x00, 0x4e, 0x00, 0x61, 0x00, 0x00, 0x00, 0x25, 0x00,
+  0x37, 0x00, 0x4b, 0x00, 0x5f, 0x00, 0x72, 0x00, 0x7f, 0x00, 0x96, 0x00,
+  0xb5, 0x00, 0xbd, 0x00, 0xc5, 0x00, 0xcd, 0x00, 0xd5, 0x00, 0xde, 0x00,
+  0xe7, 0x00, 0xef, 0x00, 0xf7, 0x00, 0xff, 0x00, 0x07, 0x01, 0x0f, 0x01,
+  0x17, 0x01, 0x00, 0x00, 0x15, 0x00, 0x26, 0x00, 0x34, 0x00, 0x3f, 0x00,
+  0x53, 0x00, 0x5a, 0x00, 0x61, 0x00, 0x00, 0x00, 0x22, 0x00, 0x38, 0x00,
+  0x50, 0x00, 0x5d, 0x00, 0x6c, 0x00, 0x82, 0x00, 0x00, 0x00, 0x17, 0x00,
+  0x2b, 0x00, 0x43, 0x00, 0x58, 0x00, 0x7d, 0x00, 0x86, 0x00, 0x8f, 0x00,
+  0x00, 0x00, 0x13, 0x00, 0x21, 0x00, 0x35, 0x00, 0x47, 0x00, 0x50, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x20, 0x00, 0x31, 0x00, 0x47, 0x00, 0x4e, 0x00,
+  0x55, 0x00, 0x00, 0x00, 0x11, 0x00, 0x1c, 0x00, 0x2a, 0x00, 0x37, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x21, 0x00, 0x39, 0x00, 0x00, 0x00, 0x15, 0x00,
+  0x2b, 0x00, 0x36, 0x00, 0x42, 0x00, 0x55, 0x00, 0x00, 0x00, 0x13, 0x00,
+  0x25, 0x00, 0x3b, 0x00, 0x4e, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x1c, 0x00,
+  0x2f, 0x00, 0x4b, 0x00, 0x58, 0x00, 0x69, 0x00, 0x91, 0x00, 0xb8, 0x00,
+  0xc8, 0x00, 0xd1, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x33, 0x00, 0x47, 0x00,
+  0x52, 0x00, 0x6b, 0x00, 0x00, 0x00, 0x11, 0x00, 0x23, 0x00, 0x45, 0x00,
+  0x53, 0x00, 0x61, 0x00, 0x75, 0x00, 0x8c, 0x00, 0x94, 0x00, 0x9c, 0x00,
+  0xa4, 0x00, 0xac, 0x00, 0xb4, 0x00, 0xbc, 0x00, 0xc4, 0x00, 0xcc, 0x00,
+  0xd4, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x1a, 0x00, 0x2e, 0x00, 0x53, 0x00,
+  0x5d, 0x00, 0x00, 0x00, 0x14, 0x00, 0x24, 0x00, 0x39, 0x00, 0x5d, 0x00,
+  0x76, 0x00, 0x00, 0x00, 0x12, 0x00, 0x22, 0x00, 0x37, 0x00, 0x43, 0x00,
+  0x4f, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x18, 0x00, 0x20, 0x00, 0x28, 0x00,
+  0x30, 0x00, 0x38, 0x00, 0x40, 0x00, 0x48, 0x00, 0x50, 0x00, 0x58, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x22, 0x00, 0x32, 0x00, 0x45, 0x00, 0x4f, 0x00,
+  0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x10, 0x00, 0x21, 0x00, 0x35, 0x00,
+  0x00, 0x00, 0x13, 0x00, 0x26, 0x00, 0x36, 0x00, 0x42, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x20, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x15, 0x00, 0x21, 0x00,
+  0x2c, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x12, 0x00, 0x25, 0x00,
+  0x34, 0x00, 0x44, 0x00, 0x00, 0x00, 0x16, 0x00, 0x26, 0x00, 0x00, 0x00,
+  0x18, 0x00, 0x00, 0x00, 0x15, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x1f, 0x00,
+  0x2a, 0x00, 0x00, 0x00, 0x11, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x15, 0x00,
+  0x29, 0x00, 0x3c, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x29, 0x00, 0x3c, 0x00, 0x44, 0x00, 0x4c, 0x00, 0x54, 0x00,
+  0x5c, 0x00, 0x65, 0x00, 0x6d, 0x00, 0x76, 0x00, 0x7e, 0x00, 0x86, 0x00,
+  0x8e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x25, 0x00, 0x2d, 0x00,
+  0x35, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x12, 0x00, 0x24, 0x00,
+  0x3b, 0x00, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x2d, 0x00,
+  0x41, 0x00, 0x00, 0x00, 0x17, 0x00, 0x2f, 0x00, 0x3f, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x20, 0x00, 0x28, 0x00, 0x30, 0x00, 0x00, 0x00, 0x15, 0x00,
+  0x27, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x37, 0x00, 0x4a, 0x00, 0x5b, 0x00,
+  0x64, 0x00, 0x6d, 0x00, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00,
+  0x10, 0x00, 0x18, 0x00, 0x20, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x1b, 0x00,
+  0x00, 0x00, 0x08, 0x00, 0x10, 0x00, 0x18, 0x00, 0x20, 0x00, 0x28, 0x00,
+  0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x21, 0x00,
+  0x31, 0x00, 0x42, 0x00, 0x53, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x19, 0x00, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x1a, 0x00, 0x22, 0x00, 0x2a, 0x00, 0x32, 0x00,
+  0x3a, 0x00, 0x42, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x15, 0x00, 0x1e, 0x00,
+  0x27, 0x00, 0x30, 0x00, 0x38, 0x00, 0x40, 0x00, 0x4f, 0x00, 0x5c, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x18, 0x00, 0x20, 0x00, 0x28, 0x00, 0x30, 0x00,
+  0x38, 0x00, 0x40, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x16, 0x00, 0x1e, 0x00,
+  0x26, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x1d, 0x00, 0x2f, 0x00, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x10, 0x00, 0x17, 0x00,
+  0x1e, 0x00, 0x00, 0x00, 0x09, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x2e, 0x00, 0x36, 0x00, 0x3e, 0x00, 0x46, 0x00, 0x4e, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x17, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x2f, 0x00,
+  0x5c, 0x00, 0x86, 0x00, 0xb2, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x5e, 0x00,
+  0x8b, 0x00, 0xb8, 0x00, 0xe2, 0x00, 0x0e, 0x01, 0x16, 0x01, 0x00, 0x00,
+  0x00, 0x00
+};
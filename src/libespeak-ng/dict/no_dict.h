@@ -1,5 +1,7 @@
 #pragma once
-const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
+#include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/no_dict_index.h>
+const unsigned char __espeakng_dict_no[] __attribute__((aligned((4)))) = {
   0x00, 0x04, 0x00, 0x00, 0xe3, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
   0xc3, 0x34, 0x53, 0x80, 0x48, 0x08, 0x00, 0x00, 0x05, 0x41, 0x04, 0x78,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x41, 0x08, 0x48, 0x75, 0x00, 0x00,
@@ -350,4 +352,11 @@ const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
   0x49, 0x79, 0x37, 0x37, 0x78, 0x33, 0x00, 0xc3, 0xbc, 0x03, 0x70, 0x00,
   0x07, 0x00
 };
-size_t __espeakng_dictlen = 4178;
+
+BackgroundAudioDictionary dict_no = {
+    "no",
+    4178,
+    __espeakng_dict_no,
+    2776,
+    __espeakng_dictindex_no
+};
@@ -1,5 +1,7 @@
 #pragma once
-const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
+#include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/nog_dict_index.h>
+const unsigned char __espeakng_dict_nog[] __attribute__((aligned((4)))) = {
   0x00, 0x04, 0x00, 0x00, 0xa6, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -276,4 +278,11 @@ const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
   0x70, 0x00, 0x03, 0x39, 0x70, 0x00, 0x07, 0x06, 0xd1, 0x91, 0x00, 0x03,
   0x39, 0x06, 0x27, 0x00, 0x07, 0x00
 };
-size_t __espeakng_dictlen = 3294;
+
+BackgroundAudioDictionary dict_nog = {
+    "nog",
+    3294,
+    __espeakng_dict_nog,
+    2180,
+    __espeakng_dictindex_nog
+};
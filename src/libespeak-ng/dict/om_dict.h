@@ -1,5 +1,7 @@
 #pragma once
-const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
+#include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/om_dict_index.h>
+const unsigned char __espeakng_dict_om[] __attribute__((aligned((4)))) = {
   0x00, 0x04, 0x00, 0x00, 0xab, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x06, 0x41, 0x04, 0x23, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
   0x41, 0x08, 0x48, 0x23, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x41,
@@ -193,4 +195,11 @@ const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
   0x00, 0x03, 0x72, 0x00, 0x79, 0x03, 0x72, 0x0c, 0x00, 0x07, 0x06, 0x7a,
   0x00, 0x04, 0x03, 0x2f, 0x5a, 0x00, 0x7a, 0x00, 0x07, 0x00
 };
-size_t __espeakng_dictlen = 2302;
+
+BackgroundAudioDictionary dict_om = {
+    "om",
+    2302,
+    __espeakng_dict_om,
+    2330,
+    __espeakng_dictindex_om
+};
@@ -1,5 +1,7 @@
 #pragma once
-const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
+#include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/or_dict_index.h>
+const unsigned char __espeakng_dict_or[] __attribute__((aligned((4)))) = {
   0x00, 0x04, 0x00, 0x00, 0x65, 0x56, 0x01, 0x00, 0x00, 0x79, 0x19, 0xf0,
   0x9f, 0x91, 0xa9, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xe2, 0x80,
   0x8d, 0xf0, 0x9f, 0x91, 0xa7, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa7,
@@ -7439,4 +7441,11 @@ const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
   0x28, 0x22, 0x43, 0x06, 0x27, 0x6d, 0x06, 0x25, 0x22, 0x23, 0x42, 0x00,
   0x07, 0x00
 };
-size_t __espeakng_dictlen = 89246;
+
+BackgroundAudioDictionary dict_or = {
+    "or",
+    89246,
+    __espeakng_dict_or,
+    7564,
+    __espeakng_dictindex_or
+};
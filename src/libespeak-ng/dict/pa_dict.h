@@ -1,5 +1,7 @@
 #pragma once
-const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
+#include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/pa_dict_index.h>
+const unsigned char __espeakng_dict_pa[] __attribute__((aligned((4)))) = {
   0x00, 0x04, 0x00, 0x00, 0x66, 0x2e, 0x01, 0x00, 0x00, 0x61, 0x19, 0xf0,
   0x9f, 0x91, 0xa9, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xe2, 0x80,
   0x8d, 0xf0, 0x9f, 0x91, 0xa7, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa7,
@@ -6664,4 +6666,11 @@ const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
   0x06, 0x00, 0x25, 0x03, 0x30, 0x6d, 0x5a, 0x74, 0x32, 0x2f, 0x00, 0x24,
   0x03, 0x49, 0x79, 0x37, 0x6d, 0x33, 0x00, 0x07, 0x00
 };
-size_t __espeakng_dictlen = 79953;
+
+BackgroundAudioDictionary dict_pa = {
+    "pa",
+    79953,
+    __espeakng_dict_pa,
+    7564,
+    __espeakng_dictindex_pa
+};
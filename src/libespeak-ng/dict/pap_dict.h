@@ -1,5 +1,7 @@
 #pragma once
-const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
+#include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/pap_dict_index.h>
+const unsigned char __espeakng_dict_pap[] __attribute__((aligned((4)))) = {
   0x00, 0x04, 0x00, 0x00, 0x9e, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x04, 0xc1, 0x04, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x06, 0x41, 0x08,
   0x48, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x41, 0x0c, 0x5a, 0x24,
@@ -179,4 +181,11 @@ const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
   0x13, 0x00, 0x24, 0x03, 0x49, 0x6e, 0x37, 0x6e, 0x00, 0xc3, 0xa7, 0x03,
   0x5a, 0x00, 0x07, 0x00
 };
-size_t __espeakng_dictlen = 2128;
+
+BackgroundAudioDictionary dict_pap = {
+    "pap",
+    2128,
+    __espeakng_dict_pap,
+    2326,
+    __espeakng_dictindex_pap
+};
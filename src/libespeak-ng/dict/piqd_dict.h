@@ -1,5 +1,7 @@
 #pragma once
-const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
+#include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/piqd_dict_index.h>
+const unsigned char __espeakng_dict_piqd[] __attribute__((aligned((4)))) = {
   0x00, 0x04, 0x00, 0x00, 0x20, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x07, 0x41, 0x04, 0x13, 0x23, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x07, 0x41, 0x08, 0x48, 0x06, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -144,4 +146,11 @@ const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
   0x3a, 0x00, 0x07, 0x06, 0x79, 0x00, 0x03, 0x39, 0x00, 0x07, 0x06, 0x00,
   0x27, 0x03, 0x13, 0x00, 0x07, 0x00
 };
-size_t __espeakng_dictlen = 1710;
+
+BackgroundAudioDictionary dict_piqd = {
+    "piqd",
+    1710,
+    __espeakng_dict_piqd,
+    2176,
+    __espeakng_dictindex_piqd
+};
@@ -1,5 +1,7 @@
 #pragma once
-const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
+#include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/pl_dict_index.h>
+const unsigned char __espeakng_dict_pl[] __attribute__((aligned((4)))) = {
   0x00, 0x04, 0x00, 0x00, 0x37, 0x0d, 0x01, 0x00, 0x00, 0x51, 0x19, 0xf0,
   0x9f, 0x91, 0xa9, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xe2, 0x80,
   0x8d, 0xf0, 0x9f, 0x91, 0xa7, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa7,
@@ -6386,4 +6388,11 @@ const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
   0x6f, 0x00, 0xc3, 0xa5, 0x03, 0x6f, 0x00, 0x27, 0x6f, 0x77, 0x69, 0x02,
   0x20, 0x0e, 0x80, 0x80, 0x84, 0x03, 0x6f, 0x55, 0x25, 0x00, 0x07, 0x00
 };
-size_t __espeakng_dictlen = 76620;
+
+BackgroundAudioDictionary dict_pl = {
+    "pl",
+    76620,
+    __espeakng_dict_pl,
+    15854,
+    __espeakng_dictindex_pl
+};
@@ -0,0 +1,1325 @@
+#pragma once
+const unsigned char __espeakng_dictindex_pl[] __attribute__((aligned((4)))) = {
+  0x45, 0x44, 0x58, 0x31, 0x4c, 0x2b, 0x01, 0x00, 0x37, 0x0d, 0x01, 0x00,
+  0xf3, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x0c, 0x00,
+  0x0e, 0x00, 0x0e, 0x00, 0x11, 0x00, 0x11, 0x00, 0x15, 0x00, 0x1e, 0x00,
+  0x20, 0x00, 0x22, 0x00, 0x25, 0x00, 0x26, 0x00, 0x28, 0x00, 0x28, 0x00,
+  0x2a, 0x00, 0x2a, 0x00, 0x2b, 0x00, 0x2f, 0x00, 0x3a, 0x00, 0x3c, 0x00,
+  0x4a, 0x00, 0x56, 0x00, 0x5b, 0x00, 0x5c, 0x00, 0x5e, 0x00, 0x5f, 0x00,
+  0x5f, 0x00, 0x61, 0x00, 0x63, 0x00, 0x63, 0x00, 0x64, 0x00, 0x64, 0x00,
+  0x67, 0x00, 0x6a, 0x00, 0x6d, 0x00, 0x71, 0x00, 0x7a, 0x00, 0x89, 0x00,
+  0x8c, 0x00, 0x8f, 0x00, 0x91, 0x00, 0x91, 0x00, 0x94, 0x00, 0x97, 0x00,
+  0x98, 0x00, 0x99, 0x00, 0x9a, 0x00, 0x9b, 0x00, 0x9d, 0x00, 0x9f, 0x00,
+  0xa8, 0x00, 0xae, 0x00, 0xb4, 0x00, 0xb6, 0x00, 0xbc, 0x00, 0xbe, 0x00,
+  0xc0, 0x00, 0xc1, 0x00, 0xc2, 0x00, 0xc2, 0x00, 0xcf, 0x00, 0xd1, 0x00,
+  0xd2, 0x00, 0xd3, 0x00, 0xd6, 0x00, 0xd6, 0x00, 0xd6, 0x00, 0xdc, 0x00,
+  0xe1, 0x00, 0xe1, 0x00, 0xe3, 0x00, 0xe3, 0x00, 0xe4, 0x00, 0xed, 0x00,
+  0xf1, 0x00, 0xf9, 0x00, 0xfc, 0x00, 0x06, 0x01, 0x06, 0x01, 0x06, 0x01,
+  0x07, 0x01, 0x09, 0x01, 0x0a, 0x01, 0x0f, 0x01, 0x11, 0x01, 0x13, 0x01,
+  0x14, 0x01, 0x16, 0x01, 0x1a, 0x01, 0x21, 0x01, 0x23, 0x01, 0x2d, 0x01,
+  0x30, 0x01, 0x35, 0x01, 0x37, 0x01, 0x37, 0x01, 0x3b, 0x01, 0x41, 0x01,
+  0x45, 0x01, 0x45, 0x01, 0x46, 0x01, 0x46, 0x01, 0x49, 0x01, 0x4a, 0x01,
+  0x4f, 0x01, 0x5a, 0x01, 0x5e, 0x01, 0x67, 0x01, 0x6c, 0x01, 0x6e, 0x01,
+  0x72, 0x01, 0x75, 0x01, 0x76, 0x01, 0x7c, 0x01, 0x7e, 0x01, 0x83, 0x01,
+  0x88, 0x01, 0x90, 0x01, 0x95, 0x01, 0x97, 0x01, 0x9d, 0x01, 0xa3, 0x01,
+  0xa4, 0x01, 0xab, 0x01, 0xb1, 0x01, 0xb4, 0x01, 0xb9, 0x01, 0xbb, 0x01,
+  0xbb, 0x01, 0xc3, 0x01, 0xc5, 0x01, 0xc8, 0x01, 0xca, 0x01, 0xcc, 0x01,
+  0xcd, 0x01, 0xd4, 0x01, 0xd5, 0x01, 0xdc, 0x01, 0xe2, 0x01, 0xe6, 0x01,
+  0xeb, 0x01, 0xee, 0x01, 0xf2, 0x01, 0xf9, 0x01, 0xfb, 0x01, 0xfd, 0x01,
+  0x02, 0x02, 0x0a, 0x02, 0x1a, 0x02, 0x21, 0x02, 0x24, 0x02, 0x29, 0x02,
+  0x2b, 0x02, 0x32, 0x02, 0x36, 0x02, 0x39, 0x02, 0x3d, 0x02, 0x41, 0x02,
+  0x44, 0x02, 0x46, 0x02, 0x59, 0x02, 0x5d, 0x02, 0x5e, 0x02, 0x60, 0x02,
+  0x60, 0x02, 0x63, 0x02, 0x64, 0x02, 0x69, 0x02, 0x70, 0x02, 0x71, 0x02,
+  0x75, 0x02, 0x77, 0x02, 0x86, 0x02, 0x8a, 0x02, 0x8d, 0x02, 0x96, 0x02,
+  0xb3, 0x02, 0xb4, 0x02, 0xb8, 0x02, 0xbc, 0x02, 0xc0, 0x02, 0xc3, 0x02,
+  0xc4, 0x02, 0xc5, 0x02, 0xc7, 0x02, 0xd3, 0x02, 0xd5, 0x02, 0xd6, 0x02,
+  0xd6, 0x02, 0xd7, 0x02, 0xe1, 0x02, 0xe1, 0x02, 0xe2, 0x02, 0xe2, 0x02,
+  0xe3, 0x02, 0xe3, 0x02, 0xe6, 0x02, 0xe8, 0x02, 0xe8, 0x02, 0xeb, 0x02,
+  0xf3, 0x02, 0xf7, 0x02, 0xf7, 0x02, 0xfa, 0x02, 0xfc, 0x02, 0xfc, 0x02,
+  0xfc, 0x02, 0x00, 0x03, 0x01, 0x03, 0x09, 0x03, 0x0a, 0x03, 0x0e, 0x03,
+  0x13, 0x03, 0x13, 0x03, 0x13, 0x03, 0x14, 0x03, 0x16, 0x03, 0x18, 0x03,
+  0x18, 0x03, 0x1b, 0x03, 0x1c, 0x03, 0x1d, 0x03, 0x21, 0x03, 0x23, 0x03,
+  0x23, 0x03, 0x24, 0x03, 0x24, 0x03, 0x26, 0x03, 0x29, 0x03, 0x2b, 0x03,
+  0x2d, 0x03, 0x2f, 0x03, 0x30, 0x03, 0x34, 0x03, 0x37, 0x03, 0x3a, 0x03,
+  0x3c, 0x03, 0x3e, 0x03, 0x40, 0x03, 0x43, 0x03, 0x48, 0x03, 0x4b, 0x03,
+  0x51, 0x03, 0x53, 0x03, 0x58, 0x03, 0x5a, 0x03, 0x5a, 0x03, 0x5e, 0x03,
+  0x5e, 0x03, 0x5f, 0x03, 0x5f, 0x03, 0x61, 0x03, 0x62, 0x03, 0x64, 0x03,
+  0x67, 0x03, 0x6a, 0x03, 0x6a, 0x03, 0x6f, 0x03, 0x70, 0x03, 0x74, 0x03,
+  0x76, 0x03, 0x78, 0x03, 0x7e, 0x03, 0x7f, 0x03, 0x7f, 0x03, 0x82, 0x03,
+  0x87, 0x03, 0x8a, 0x03, 0x8d, 0x03, 0x8d, 0x03, 0x8d, 0x03, 0x93, 0x03,
+  0x94, 0x03, 0x94, 0x03, 0x9b, 0x03, 0xa2, 0x03, 0xac, 0x03, 0xb0, 0x03,
+  0xb2, 0x03, 0xb6, 0x03, 0xb7, 0x03, 0xb9, 0x03, 0xb9, 0x03, 0xbb, 0x03,
+  0xc0, 0x03, 0xc1, 0x03, 0xc1, 0x03, 0xc5, 0x03, 0xc6, 0x03, 0xc8, 0x03,
+  0xc9, 0x03, 0xd0, 0x03, 0xdb, 0x03, 0xe3, 0x03, 0xe8, 0x03, 0xec, 0x03,
+  0xed, 0x03, 0xf0, 0x03, 0xf3, 0x03, 0xf3, 0x03, 0xf4, 0x03, 0xf7, 0x03,
+  0xf9, 0x03, 0xff, 0x03, 0xff, 0x03, 0x04, 0x04, 0x08, 0x04, 0x0b, 0x04,
+  0x0b, 0x04, 0x0c, 0x04, 0x0c, 0x04, 0x0c, 0x04, 0x0e, 0x04, 0x0e, 0x04,
+  0x10, 0x04, 0x10, 0x04, 0x12, 0x04, 0x13, 0x04, 0x14, 0x04, 0x20, 0x04,
+  0x20, 0x04, 0x20, 0x04, 0x23, 0x04, 0x27, 0x04, 0x27, 0x04, 0x2a, 0x04,
+  0x2a, 0x04, 0x32, 0x04, 0x34, 0x04, 0x36, 0x04, 0x38, 0x04, 0x3c, 0x04,
+  0x3d, 0x04, 0x3f, 0x04, 0x42, 0x04, 0x44, 0x04, 0x45, 0x04, 0x45, 0x04,
+  0x47, 0x04, 0x4a, 0x04, 0x51, 0x04, 0x54, 0x04, 0x54, 0x04, 0x55, 0x04,
+  0x55, 0x04, 0x55, 0x04, 0x56, 0x04, 0x57, 0x04, 0x57, 0x04, 0x58, 0x04,
+  0x59, 0x04, 0x5c, 0x04, 0x5c, 0x04, 0x5d, 0x04, 0x5d, 0x04, 0x5f, 0x04,
+  0x60, 0x04, 0x68, 0x04, 0x69, 0x04, 0x6c, 0x04, 0x6d, 0x04, 0x70, 0x04,
+  0x75, 0x04, 0x7c, 0x04, 0x7d, 0x04, 0x80, 0x04, 0x84, 0x04, 0x88, 0x04,
+  0x8b, 0x04, 0x90, 0x04, 0x94, 0x04, 0x98, 0x04, 0x9d, 0x04, 0xa4, 0x04,
+  0xa7, 0x04, 0xa9, 0x04, 0xab, 0x04, 0xad, 0x04, 0xad, 0x04, 0xaf, 0x04,
+  0xb0, 0x04, 0xb0, 0x04, 0xb1, 0x04, 0xb5, 0x04, 0xba, 0x04, 0xba, 0x04,
+  0xbc, 0x04, 0xbd, 0x04, 0xc0, 0x04, 0xc2, 0x04, 0xc5, 0x04, 0xc8, 0x04,
+  0xc8, 0x04, 0xcc, 0x04, 0xd1, 0x04, 0xd6, 0x04, 0xd7, 0x04, 0xd7, 0x04,
+  0xd9, 0x04, 0xdc, 0x04, 0xe3, 0x04, 0xe3, 0x04, 0xe6, 0x04, 0xec, 0x04,
+  0xf4, 0x04, 0xff, 0x04, 0x00, 0x05, 0x01, 0x05, 0x01, 0x05, 0x03, 0x05,
+  0x04, 0x05, 0x09, 0x05, 0x0d, 0x05, 0x13, 0x05, 0x19, 0x05, 0x1d, 0x05,
+  0x1e, 0x05, 0x1f, 0x05, 0x22, 0x05, 0x28, 0x05, 0x2f, 0x05, 0x31, 0x05,
+  0x32, 0x05, 0x34, 0x05, 0x38, 0x05, 0x39, 0x05, 0x42, 0x05, 0x44, 0x05,
+  0x46, 0x05, 0x49, 0x05, 0x53, 0x05, 0x56, 0x05, 0x5b, 0x05, 0x5d, 0x05,
+  0x64, 0x05, 0x64, 0x05, 0x6a, 0x05, 0x77, 0x05, 0x79, 0x05, 0x7c, 0x05,
+  0x7e, 0x05, 0x7f, 0x05, 0x82, 0x05, 0x84, 0x05, 0x8a, 0x05, 0x8d, 0x05,
+  0x96, 0x05, 0x99, 0x05, 0x9d, 0x05, 0x9e, 0x05, 0xa2, 0x05, 0xa4, 0x05,
+  0xa9, 0x05, 0xad, 0x05, 0xb0, 0x05, 0xb2, 0x05, 0xb7, 0x05, 0xba, 0x05,
+  0xc0, 0x05, 0xc5, 0x05, 0xce, 0x05, 0xd0, 0x05, 0xd8, 0x05, 0xdb, 0x05,
+  0xdc, 0x05, 0xe7, 0x05, 0xf5, 0x05, 0xf8, 0x05, 0xfb, 0x05, 0xfc, 0x05,
+  0xfc, 0x05, 0xfc, 0x05, 0x01, 0x06, 0x02, 0x06, 0x04, 0x06, 0x07, 0x06,
+  0x0b, 0x06, 0x0b, 0x06, 0x0e, 0x06, 0x13, 0x06, 0x18, 0x06, 0x18, 0x06,
+  0x1b, 0x06, 0x1f, 0x06, 0x23, 0x06, 0x26, 0x06, 0x29, 0x06, 0x2d, 0x06,
+  0x35, 0x06, 0x3c, 0x06, 0x40, 0x06, 0x44, 0x06, 0x48, 0x06, 0x4a, 0x06,
+  0x4c, 0x06, 0x51, 0x06, 0x54, 0x06, 0x57, 0x06, 0x59, 0x06, 0x63, 0x06,
+  0x69, 0x06, 0x6e, 0x06, 0x70, 0x06, 0x71, 0x06, 0x73, 0x06, 0x7c, 0x06,
+  0x82, 0x06, 0x85, 0x06, 0x8c, 0x06, 0x8e, 0x06, 0x8f, 0x06, 0x91, 0x06,
+  0x94, 0x06, 0x96, 0x06, 0x97, 0x06, 0x98, 0x06, 0x9b, 0x06, 0x9f, 0x06,
+  0xa2, 0x06, 0xa3, 0x06, 0xa8, 0x06, 0xbb, 0x06, 0xbc, 0x06, 0xc1, 0x06,
+  0xcb, 0x06, 0xcf, 0x06, 0xd4, 0x06, 0xdc, 0x06, 0xe1, 0x06, 0xe4, 0x06,
+  0xe7, 0x06, 0xe8, 0x06, 0xea, 0x06, 0xee, 0x06, 0xef, 0x06, 0xf5, 0x06,
+  0x0a, 0x07, 0x11, 0x07, 0x12, 0x07, 0x18, 0x07, 0x1a, 0x07, 0x1c, 0x07,
+  0x1f, 0x07, 0x24, 0x07, 0x2b, 0x07, 0x2d, 0x07, 0x32, 0x07, 0x33, 0x07,
+  0x34, 0x07, 0x38, 0x07, 0x3b, 0x07, 0x3d, 0x07, 0x3e, 0x07, 0x41, 0x07,
+  0x42, 0x07, 0x4b, 0x07, 0x54, 0x07, 0x54, 0x07, 0x5a, 0x07, 0x5e, 0x07,
+  0x60, 0x07, 0x62, 0x07, 0x67, 0x07, 0x6c, 0x07, 0x6d, 0x07, 0x6e, 0x07,
+  0x6f, 0x07, 0x72, 0x07, 0x74, 0x07, 0x82, 0x07, 0x86, 0x07, 0x88, 0x07,
+  0x8a, 0x07, 0x8b, 0x07, 0x8d, 0x07, 0x8d, 0x07, 0x8f, 0x07, 0x91, 0x07,
+  0x94, 0x07, 0x96, 0x07, 0x98, 0x07, 0x9a, 0x07, 0xa6, 0x07, 0xb0, 0x07,
+  0xb8, 0x07, 0xbc, 0x07, 0xbe, 0x07, 0xc3, 0x07, 0xc5, 0x07, 0xc8, 0x07,
+  0xce, 0x07, 0xd1, 0x07, 0xd2, 0x07, 0xd5, 0x07, 0xd6, 0x07, 0xd9, 0x07,
+  0xde, 0x07, 0xe1, 0x07, 0xe2, 0x07, 0xe2, 0x07, 0xe5, 0x07, 0xe7, 0x07,
+  0xe7, 0x07, 0xe7, 0x07, 0xe7, 0x07, 0xe8, 0x07, 0xe8, 0x07, 0xea, 0x07,
+  0xec, 0x07, 0xec, 0x07, 0xed, 0x07, 0xed, 0x07, 0xee, 0x07, 0xf0, 0x07,
+  0xf1, 0x07, 0xf4, 0x07, 0xfb, 0x07, 0xfd, 0x07, 0xfe, 0x07, 0x07, 0x08,
+  0x11, 0x08, 0x12, 0x08, 0x17, 0x08, 0x1b, 0x08, 0x1f, 0x08, 0x20, 0x08,
+  0x24, 0x08, 0x24, 0x08, 0x25, 0x08, 0x25, 0x08, 0x26, 0x08, 0x26, 0x08,
+  0x27, 0x08, 0x27, 0x08, 0x28, 0x08, 0x28, 0x08, 0x29, 0x08, 0x2e, 0x08,
+  0x2f, 0x08, 0x30, 0x08, 0x31, 0x08, 0x32, 0x08, 0x32, 0x08, 0x36, 0x08,
+  0x38, 0x08, 0x3b, 0x08, 0x46, 0x08, 0x47, 0x08, 0x4c, 0x08, 0x51, 0x08,
+  0x5d, 0x08, 0x5f, 0x08, 0x63, 0x08, 0x6c, 0x08, 0x6d, 0x08, 0x73, 0x08,
+  0x7a, 0x08, 0x84, 0x08, 0x87, 0x08, 0x8e, 0x08, 0x8e, 0x08, 0x8f, 0x08,
+  0x8f, 0x08, 0x93, 0x08, 0x9a, 0x08, 0x9b, 0x08, 0xa2, 0x08, 0xa5, 0x08,
+  0xa7, 0x08, 0xac, 0x08, 0xaf, 0x08, 0xb1, 0x08, 0xb3, 0x08, 0xbf, 0x08,
+  0xc0, 0x08, 0xc6, 0x08, 0xca, 0x08, 0xcf, 0x08, 0xe0, 0x08, 0xe4, 0x08,
+  0xe7, 0x08, 0xe9, 0x08, 0xf5, 0x08, 0xfa, 0x08, 0xfd, 0x08, 0x09, 0x09,
+  0x0c, 0x09, 0x11, 0x09, 0x17, 0x09, 0x31, 0x09, 0x37, 0x09, 0x45, 0x09,
+  0x4f, 0x09, 0x55, 0x09, 0x5b, 0x09, 0x63, 0x09, 0x6b, 0x09, 0x73, 0x09,
+  0x83, 0x09, 0x8b, 0x09, 0x8e, 0x09, 0x91, 0x09, 0x96, 0x09, 0x9c, 0x09,
+  0xa4, 0x09, 0xaf, 0x09, 0xb3, 0x09, 0xbd, 0x09, 0xc3, 0x09, 0xcc, 0x09,
+  0xd5, 0x09, 0xe1, 0x09, 0xed, 0x09, 0xf5, 0x09, 0x06, 0x0a, 0x13, 0x0a,
+  0x21, 0x0a, 0x29, 0x0a, 0x30, 0x0a, 0x38, 0x0a, 0x41, 0x0a, 0x4c, 0x0a,
+  0x59, 0x0a, 0x67, 0x0a, 0x71, 0x0a, 0x81, 0x0a, 0x8b, 0x0a, 0x9a, 0x0a,
+  0xa5, 0x0a, 0xad, 0x0a, 0xb8, 0x0a, 0xc0, 0x0a, 0xc9, 0x0a, 0xd2, 0x0a,
+  0xda, 0x0a, 0xe2, 0x0a, 0xeb, 0x0a, 0xf2, 0x0a, 0xf9, 0x0a, 0x04, 0x0b,
+  0x0f, 0x0b, 0x17, 0x0b, 0x20, 0x0b, 0x30, 0x0b, 0x3b, 0x0b, 0x46, 0x0b,
+  0x52, 0x0b, 0x5a, 0x0b, 0x63, 0x0b, 0x76, 0x0b, 0x7c, 0x0b, 0x83, 0x0b,
+  0x8d, 0x0b, 0x9c, 0x0b, 0xaf, 0x0b, 0xc3, 0x0b, 0xd8, 0x0b, 0xea, 0x0b,
+  0xf3, 0x0b, 0x0b, 0x0c, 0x13, 0x0c, 0x19, 0x0c, 0x23, 0x0c, 0x2c, 0x0c,
+  0x37, 0x0c, 0x41, 0x0c, 0x48, 0x0c, 0x4f, 0x0c, 0x56, 0x0c, 0x64, 0x0c,
+  0x6b, 0x0c, 0x71, 0x0c, 0x7a, 0x0c, 0x80, 0x0c, 0x87, 0x0c, 0x91, 0x0c,
+  0x9c, 0x0c, 0xa7, 0x0c, 0xb0, 0x0c, 0xbc, 0x0c, 0xc7, 0x0c, 0xd6, 0x0c,
+  0xdd, 0x0c, 0xe6, 0x0c, 0xee, 0x0c, 0xfe, 0x0c, 0x05, 0x0d, 0x0b, 0x0d,
+  0x0f, 0x0d, 0x16, 0x0d, 0x2a, 0x0d, 0x3b, 0x0d, 0x41, 0x0d, 0x49, 0x0d,
+  0x4f, 0x0d, 0x58, 0x0d, 0x5e, 0x0d, 0x68, 0x0d, 0x6e, 0x0d, 0x74, 0x0d,
+  0x78, 0x0d, 0x7f, 0x0d, 0x85, 0x0d, 0x8d, 0x0d, 0x99, 0x0d, 0x9d, 0x0d,
+  0xa9, 0x0d, 0xad, 0x0d, 0xb2, 0x0d, 0xb7, 0x0d, 0xbe, 0x0d, 0xc5, 0x0d,
+  0xce, 0x0d, 0xd9, 0x0d, 0xe1, 0x0d, 0xe6, 0x0d, 0xea, 0x0d, 0xf4, 0x0d,
+  0xf8, 0x0d, 0xfe, 0x0d, 0x04, 0x0e, 0x08, 0x0e, 0x0c, 0x0e, 0x0f, 0x0e,
+  0x12, 0x0e, 0x16, 0x0e, 0x1b, 0x0e, 0x22, 0x0e, 0x25, 0x0e, 0x28, 0x0e,
+  0x35, 0x0e, 0x37, 0x0e, 0x39, 0x0e, 0x3d, 0x0e, 0x42, 0x0e, 0x45, 0x0e,
+  0x46, 0x0e, 0x4e, 0x0e, 0x56, 0x0e, 0x60, 0x0e, 0x64, 0x0e, 0x66, 0x0e,
+  0x69, 0x0e, 0x6d, 0x0e, 0x72, 0x0e, 0x75, 0x0e, 0x7a, 0x0e, 0x82, 0x0e,
+  0x8b, 0x0e, 0x94, 0x0e, 0x97, 0x0e, 0x99, 0x0e, 0xa6, 0x0e, 0xaa, 0x0e,
+  0xaa, 0x0e, 0xab, 0x0e, 0xac, 0x0e, 0xb1, 0x0e, 0xb1, 0x0e, 0xb3, 0x0e,
+  0xb9, 0x0e, 0xbc, 0x0e, 0xc1, 0x0e, 0xc3, 0x0e, 0xc4, 0x0e, 0xc6, 0x0e,
+  0xc8, 0x0e, 0xca, 0x0e, 0xcd, 0x0e, 0xd5, 0x0e, 0xda, 0x0e, 0xe3, 0x0e,
+  0xe7, 0x0e, 0xee, 0x0e, 0xf6, 0x0e, 0xf9, 0x0e, 0xfd, 0x0e, 0x09, 0x0f,
+  0x0c, 0x0f, 0x12, 0x0f, 0x14, 0x0f, 0x19, 0x0f, 0x1f, 0x0f, 0x25, 0x0f,
+  0x2d, 0x0f, 0x47, 0x0f, 0x4a, 0x0f, 0x4f, 0x0f, 0x54, 0x0f, 0x57, 0x0f,
+  0x5b, 0x0f, 0x5c, 0x0f, 0x61, 0x0f, 0x65, 0x0f, 0x6a, 0x0f, 0x6c, 0x0f,
+  0x70, 0x0f, 0x72, 0x0f, 0x74, 0x0f, 0x78, 0x0f, 0x7d, 0x0f, 0x85, 0x0f,
+  0x8c, 0x0f, 0x91, 0x0f, 0x99, 0x0f, 0xa5, 0x0f, 0xb8, 0x0f, 0xbe, 0x0f,
+  0xc7, 0x0f, 0xd2, 0x0f, 0xe1, 0x0f, 0xea, 0x0f, 0xf3, 0x0f, 0xff, 0x0f,
+  0x0c, 0x10, 0x12, 0x10, 0x1e, 0x10, 0x28, 0x10, 0x30, 0x10, 0x35, 0x10,
+  0x3c, 0x10, 0x41, 0x10, 0x45, 0x10, 0x49, 0x10, 0x52, 0x10, 0x5a, 0x10,
+  0x64, 0x10, 0x69, 0x10, 0x74, 0x10, 0x7a, 0x10, 0x7e, 0x10, 0x83, 0x10,
+  0x8c, 0x10, 0xa6, 0x10, 0xa9, 0x10, 0xb2, 0x10, 0xb9, 0x10, 0xc2, 0x10,
+  0xc9, 0x10, 0xcd, 0x10, 0xd3, 0x10, 0xd6, 0x10, 0xde, 0x10, 0xe1, 0x10,
+  0xe7, 0x10, 0xeb, 0x10, 0xf2, 0x10, 0xf9, 0x10, 0x02, 0x11, 0x03, 0x11,
+  0x07, 0x11, 0x0a, 0x11, 0x0f, 0x11, 0x1c, 0x11, 0x1f, 0x11, 0x23, 0x11,
+  0x2b, 0x11, 0x30, 0x11, 0x36, 0x11, 0x36, 0x11, 0x39, 0x11, 0x3a, 0x11,
+  0x3c, 0x11, 0x3c, 0x11, 0x3c, 0x11, 0x3f, 0x11, 0x4a, 0x11, 0x4c, 0x11,
+  0x4d, 0x11, 0x51, 0x11, 0x52, 0x11, 0x55, 0x11, 0x58, 0x11, 0x5b, 0x11,
+  0x5e, 0x11, 0x64, 0x11, 0x66, 0x11, 0x69, 0x11, 0x6a, 0x11, 0x6b, 0x11,
+  0x6d, 0x11, 0x6e, 0x11, 0x6f, 0x11, 0x71, 0x11, 0x71, 0x11, 0x71, 0x11,
+  0x76, 0x11, 0x7b, 0x11, 0x7c, 0x11, 0x81, 0x11, 0x82, 0x11, 0x84, 0x11,
+  0x86, 0x11, 0x88, 0x11, 0x88, 0x11, 0x88, 0x11, 0x88, 0x11, 0x8b, 0x11,
+  0x93, 0x11, 0x96, 0x11, 0x99, 0x11, 0x9c, 0x11, 0xa5, 0x11, 0xac, 0x11,
+  0xad, 0x11, 0xb2, 0x11, 0xb3, 0x11, 0xb5, 0x11, 0xb5, 0x11, 0xb9, 0x11,
+  0xbf, 0x11, 0xc8, 0x11, 0xcd, 0x11, 0xce, 0x11, 0xd3, 0x11, 0xd8, 0x11,
+  0xdb, 0x11, 0xdf, 0x11, 0xe8, 0x11, 0xeb, 0x11, 0xee, 0x11, 0xf1, 0x11,
+  0xf3, 0x11, 0x00, 0x00, 0x8c, 0x02, 0x63, 0x43, 0xd2, 0x31, 0x3e, 0xc6,
+  0x70, 0x35, 0x0b, 0x4b, 0x48, 0x1b, 0xcf, 0x17, 0x17, 0x03, 0x9e, 0x66,
+  0x7a, 0xf9, 0xa6, 0xb0, 0x65, 0x82, 0x3b, 0x38, 0x2a, 0xf4, 0xed, 0x4d,
+  0x1e, 0x8f, 0x5e, 0xd4, 0xed, 0x7b, 0x82, 0xbb, 0x0c, 0xc1, 0x67, 0x1c,
+  0xc6, 0x71, 0xb1, 0x04, 0xdc, 0xa1, 0x50, 0xbf, 0x28, 0xae, 0x04, 0x08,
+  0xde, 0x1a, 0x08, 0x65, 0xdb, 0x32, 0x7f, 0x68, 0x3d, 0x3d, 0x3d, 0x3d,
+  0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0xa9, 0x58, 0x71, 0x4e, 0xfa, 0xf0,
+  0x29, 0xd6, 0x2f, 0x44, 0x58, 0x26, 0xfd, 0x1a, 0x99, 0xe0, 0xc2, 0x8d,
+  0xd4, 0x94, 0xc5, 0x82, 0x56, 0xfe, 0x42, 0x2c, 0xca, 0x9c, 0x6e, 0x77,
+  0x05, 0x33, 0x73, 0x65, 0x12, 0x1d, 0xe6, 0xbe, 0x53, 0xe5, 0x5d, 0x9e,
+  0x39, 0x50, 0x7e, 0x4a, 0xc4, 0x42, 0x6c, 0x3d, 0x23, 0x9c, 0xac, 0x31,
+  0x7f, 0x5b, 0x83, 0x93, 0x4a, 0x2d, 0x98, 0x52, 0x3c, 0xeb, 0x12, 0xaf,
+  0xcd, 0xa8, 0xcd, 0x1e, 0x13, 0x7a, 0x9c, 0x65, 0xee, 0x44, 0xd0, 0xa9,
+  0xd3, 0x33, 0xae, 0x35, 0xbe, 0x41, 0x61, 0xc5, 0xd2, 0xcb, 0x26, 0xd5,
+  0x6f, 0xe0, 0x0f, 0xa8, 0xff, 0x6e, 0x4c, 0xde, 0x16, 0x9c, 0x79, 0x47,
+  0xcc, 0x61, 0xcd, 0xe3, 0x0e, 0xc6, 0xbb, 0x8d, 0xbb, 0x56, 0x35, 0xda,
+  0xe1, 0x2e, 0xfa, 0x99, 0xa4, 0x03, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+  0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0xa9, 0x90, 0x2e, 0x46, 0x19,
+  0xf9, 0x85, 0x1c, 0x9e, 0xf9, 0x36, 0xb6, 0xb6, 0x9e, 0xc1, 0xe3, 0x52,
+  0xf3, 0xad, 0x0b, 0x2a, 0xb8, 0xa5, 0x89, 0xb3, 0xd6, 0x07, 0xa9, 0xfb,
+  0xb3, 0x8c, 0x85, 0x8f, 0xaa, 0x48, 0x9a, 0xa1, 0xde, 0xe3, 0xe4, 0x05,
+  0xa8, 0x01, 0x2a, 0x40, 0xe1, 0xa3, 0x1d, 0x8e, 0x17, 0xb4, 0x0a, 0x3c,
+  0xa8, 0x72, 0x4c, 0x22, 0x6a, 0x5e, 0x08, 0xe6, 0xf1, 0xf6, 0x26, 0x46,
+  0x2a, 0x66, 0x38, 0xa3, 0xbd, 0xca, 0x5b, 0x9c, 0x59, 0x31, 0x74, 0xff,
+  0xde, 0xef, 0xac, 0x58, 0xbe, 0xa4, 0xb6, 0x53, 0x17, 0x8d, 0xc4, 0x93,
+  0x7f, 0x9d, 0x46, 0xa9, 0x74, 0x0c, 0xa3, 0x6f, 0xeb, 0x8b, 0x5e, 0xd3,
+  0xf1, 0x3b, 0x58, 0xcc, 0x0f, 0x0b, 0x1a, 0x3c, 0xce, 0xd6, 0xd1, 0xd1,
+  0x5f, 0xe6, 0x86, 0x86, 0x2b, 0xa1, 0xbb, 0x7f, 0x6f, 0x1e, 0x6c, 0xc8,
+  0x19, 0x7f, 0xff, 0xd2, 0xae, 0x45, 0xa5, 0xf5, 0x61, 0x61, 0xfb, 0xa7,
+  0xf2, 0xcd, 0xa1, 0x49, 0xd5, 0xd5, 0xe7, 0x7a, 0x2c, 0x84, 0xde, 0x0a,
+  0x1a, 0x58, 0x57, 0x39, 0x16, 0xcf, 0xce, 0xef, 0x35, 0x60, 0x1e, 0xa8,
+  0x94, 0x7b, 0x1d, 0x90, 0x8a, 0x80, 0x36, 0x4c, 0x46, 0x9c, 0x2c, 0xa5,
+  0x9d, 0x42, 0xd4, 0x96, 0xf6, 0x2c, 0xa0, 0x22, 0x09, 0x4d, 0x25, 0xf6,
+  0x81, 0x99, 0x73, 0xee, 0x3c, 0xe1, 0x2c, 0x85, 0x6f, 0x9e, 0xd5, 0x80,
+  0x33, 0x4d, 0xa4, 0xfe, 0x49, 0x50, 0xb3, 0xa1, 0x72, 0xfc, 0xdf, 0x8e,
+  0x6a, 0x53, 0xaa, 0x12, 0x27, 0x38, 0xf5, 0x13, 0x7d, 0xe4, 0xb9, 0x80,
+  0x17, 0x2c, 0xbd, 0x38, 0x51, 0xbe, 0x89, 0x0f, 0xd5, 0x32, 0xeb, 0x2a,
+  0x6e, 0x98, 0xb3, 0xb9, 0xfb, 0x14, 0x8c, 0xe6, 0xf1, 0x63, 0x12, 0x72,
+  0x06, 0x59, 0xdc, 0xdc, 0x37, 0x23, 0xa6, 0x3e, 0x94, 0x36, 0x8b, 0x13,
+  0xf3, 0x91, 0x75, 0x75, 0xbe, 0xc3, 0x91, 0xb0, 0x05, 0x43, 0x83, 0x9c,
+  0xc8, 0x57, 0x24, 0x6f, 0xa6, 0x34, 0x65, 0x79, 0x02, 0x8b, 0x09, 0xcc,
+  0xb3, 0x3f, 0x15, 0x27, 0xc9, 0x1d, 0xf2, 0xed, 0xd8, 0x01, 0xe3, 0x9b,
+  0x7e, 0xe8, 0x7a, 0xec, 0x37, 0xe2, 0x0e, 0x7c, 0x99, 0x24, 0x34, 0x56,
+  0xf3, 0xcb, 0x24, 0x09, 0xd5, 0xbe, 0x17, 0x36, 0x72, 0x7a, 0x9a, 0x49,
+  0x71, 0x50, 0x0f, 0x67, 0x13, 0x1d, 0x47, 0xb7, 0x8f, 0x37, 0xce, 0x3f,
+  0x3d, 0x46, 0x32, 0xfe, 0x72, 0x99, 0x3b, 0xdf, 0xd1, 0xaf, 0x62, 0x1a,
+  0x1e, 0x7b, 0x25, 0xad, 0x14, 0xaa, 0xb4, 0x75, 0x5a, 0xf9, 0xdd, 0x2a,
+  0x59, 0x83, 0x81, 0xc8, 0x9f, 0xd3, 0xff, 0x90, 0x16, 0x6c, 0x09, 0x8c,
+  0x9f, 0x3b, 0x10, 0xbb, 0x48, 0xf7, 0x08, 0xa3, 0x09, 0x20, 0x9d, 0x01,
+  0xee, 0x6a, 0x99, 0x9e, 0x4f, 0x32, 0x17, 0x81, 0xc2, 0x6b, 0x55, 0x4b,
+  0x02, 0x50, 0xc4, 0xca, 0x78, 0x37, 0x98, 0xbe, 0x72, 0x0d, 0x66, 0x1c,
+  0x55, 0x6b, 0xb0, 0xf2, 0x41, 0xbf, 0x45, 0xfe, 0x5d, 0x4e, 0x0d, 0xae,
+  0xf7, 0xa1, 0xcf, 0x36, 0x0f, 0xd7, 0xe1, 0x1e, 0x5e, 0x37, 0x57, 0xda,
+  0x33, 0x34, 0xfb, 0x32, 0xb5, 0x13, 0xd7, 0xee, 0x52, 0x92, 0x1f, 0x1f,
+  0xec, 0xec, 0xde, 0x11, 0x70, 0xa0, 0xc9, 0x18, 0x98, 0xd8, 0xac, 0x13,
+  0xe7, 0x8e, 0xc6, 0x9f, 0xf0, 0x3e, 0x31, 0x01, 0x17, 0xff, 0x23, 0x20,
+  0x8a, 0x72, 0x67, 0xce, 0x66, 0xc7, 0xe0, 0xa2, 0x27, 0xf1, 0x2b, 0xe3,
+  0x1b, 0x6a, 0xd0, 0x1a, 0x28, 0x82, 0x46, 0x74, 0x1b, 0x55, 0x0a, 0x2b,
+  0x14, 0x05, 0xde, 0x44, 0xf5, 0x60, 0x6a, 0x0f, 0xf2, 0xc9, 0x2d, 0x47,
+  0xbd, 0x65, 0xdd, 0xb3, 0xd7, 0x47, 0x4a, 0xdd, 0xcd, 0x3c, 0x17, 0x70,
+  0xf1, 0xcc, 0xbb, 0xc8, 0x41, 0x57, 0x44, 0x19, 0xe1, 0x9e, 0xec, 0x22,
+  0xbd, 0x96, 0xf4, 0xf8, 0xe1, 0x14, 0x5b, 0x9a, 0x83, 0x3d, 0xd6, 0xfd,
+  0x4e, 0x38, 0x37, 0x40, 0xc0, 0x32, 0x30, 0xb6, 0x12, 0xf3, 0x80, 0x73,
+  0x17, 0x4e, 0x73, 0xc3, 0x7b, 0x48, 0x40, 0x2a, 0xb0, 0xf5, 0x1e, 0xda,
+  0x68, 0x9c, 0xc7, 0x9c, 0xa0, 0x17, 0x97, 0xfa, 0xfa, 0xfa, 0xfa, 0xf9,
+  0xef, 0x93, 0xff, 0xbb, 0x40, 0xab, 0xf7, 0x9c, 0x3b, 0xf9, 0xaa, 0x3c,
+  0x67, 0x0b, 0x72, 0xf5, 0x02, 0x1e, 0x91, 0x42, 0x17, 0x92, 0x77, 0x6f,
+  0xe9, 0x94, 0x4b, 0x0b, 0x52, 0x4a, 0xe0, 0xca, 0xfb, 0x81, 0x9e, 0xe4,
+  0xf4, 0x6c, 0xc8, 0x55, 0x1d, 0x60, 0xbc, 0x74, 0xd6, 0xdc, 0xf8, 0xb3,
+  0xe9, 0x32, 0xc0, 0xbf, 0x12, 0xb8, 0xd5, 0x23, 0x7f, 0x70, 0x00, 0xcf,
+  0x06, 0x82, 0xa1, 0x63, 0xb5, 0xc9, 0xc9, 0x01, 0x80, 0x70, 0x3d, 0x7b,
+  0x7f, 0x26, 0x4d, 0xf9, 0x32, 0x53, 0x5c, 0x6d, 0x57, 0x18, 0x5f, 0x95,
+  0x38, 0x3e, 0x57, 0xdb, 0x8f, 0x7c, 0x2d, 0x5e, 0x6a, 0xa2, 0x61, 0x14,
+  0x1d, 0x4d, 0xbc, 0x98, 0x6c, 0xe5, 0x7e, 0xda, 0x4f, 0x93, 0x92, 0x80,
+  0xff, 0xaf, 0x0c, 0x49, 0x10, 0x41, 0x41, 0xf6, 0x04, 0xf1, 0x3d, 0x0a,
+  0x35, 0x89, 0x27, 0x2f, 0x51, 0x6f, 0x40, 0xa9, 0x31, 0x31, 0x23, 0x35,
+  0xa8, 0xf9, 0x34, 0xba, 0x21, 0xaa, 0x59, 0x07, 0xdd, 0x66, 0x7f, 0x3e,
+  0x82, 0x85, 0x09, 0xb5, 0xad, 0xc1, 0x3b, 0x7e, 0x5e, 0x06, 0x0d, 0x2e,
+  0x9d, 0xd1, 0x68, 0x9b, 0x60, 0x9c, 0x55, 0xc4, 0xfb, 0xd5, 0x95, 0x95,
+  0x1d, 0x6a, 0xec, 0x81, 0x08, 0x86, 0x21, 0x95, 0xbe, 0xf6, 0xfe, 0x65,
+  0xd3, 0x3e, 0x90, 0x98, 0x86, 0x8c, 0x49, 0xc4, 0xc4, 0xb5, 0x1c, 0x09,
+  0x54, 0x7c, 0xe7, 0xb5, 0x06, 0x54, 0xdf, 0xd6, 0x0d, 0xc1, 0xd2, 0x48,
+  0xd6, 0xc2, 0xca, 0x5d, 0xdc, 0x0e, 0x6c, 0x12, 0xbf, 0x2a, 0xa5, 0xa7,
+  0x19, 0x1e, 0x31, 0xc3, 0x6b, 0xd4, 0x3a, 0x45, 0x8a, 0xbb, 0x59, 0x06,
+  0xe7, 0xd5, 0x86, 0xd5, 0xa0, 0xf2, 0x9d, 0x2b, 0xa2, 0x81, 0xdf, 0x92,
+  0x5e, 0xd5, 0x4c, 0xb2, 0x22, 0xcf, 0xfb, 0x47, 0xcd, 0x87, 0x6e, 0xe4,
+  0x64, 0xdf, 0x4d, 0x94, 0x87, 0x36, 0x9f, 0xc5, 0x17, 0xad, 0xd7, 0x95,
+  0xae, 0xae, 0x59, 0x99, 0x79, 0xf7, 0xc2, 0x53, 0x53, 0x53, 0x53, 0x53,
+  0x53, 0x53, 0x53, 0x53, 0x91, 0x96, 0xb9, 0xb6, 0x12, 0xf2, 0x94, 0x77,
+  0x26, 0x93, 0x10, 0xa0, 0xfa, 0x11, 0x10, 0x69, 0xb5, 0x56, 0x81, 0xfa,
+  0x66, 0x66, 0x77, 0xfd, 0x2a, 0xda, 0x62, 0x3e, 0xa1, 0x56, 0x96, 0x2e,
+  0x4c, 0xa9, 0xea, 0x7f, 0x39, 0x9a, 0x8c, 0x4f, 0xd5, 0x63, 0x85, 0xda,
+  0xab, 0x52, 0x54, 0x32, 0x21, 0xa6, 0x43, 0xf8, 0x02, 0x33, 0xe9, 0x77,
+  0xfb, 0x98, 0x81, 0xb5, 0xd7, 0x36, 0x4c, 0x04, 0x30, 0x98, 0x60, 0x6d,
+  0x54, 0x61, 0x5c, 0x61, 0xdb, 0x26, 0xbb, 0x50, 0xca, 0x1b, 0x37, 0xdd,
+  0x05, 0xd4, 0x05, 0x95, 0x23, 0xc1, 0x9b, 0xef, 0x79, 0x24, 0x79, 0xbb,
+  0x94, 0xb2, 0x54, 0x4f, 0x07, 0xaa, 0x7a, 0x2e, 0xa9, 0x71, 0x8b, 0xef,
+  0x34, 0x3d, 0x01, 0x4e, 0xa9, 0x11, 0xe5, 0xdc, 0xf3, 0x75, 0x52, 0x50,
+  0x65, 0xeb, 0x4b, 0x91, 0xd0, 0x08, 0x04, 0x5c, 0x87, 0x4a, 0x03, 0x56,
+  0x88, 0xf8, 0x40, 0xa1, 0x3c, 0xa3, 0xaf, 0x87, 0x02, 0xf1, 0xbc, 0x04,
+  0xd4, 0x2b, 0xce, 0x94, 0xa6, 0x24, 0xba, 0xe8, 0x0a, 0x7f, 0xa1, 0xa7,
+  0x8f, 0xfa, 0xfc, 0xe0, 0x6c, 0x24, 0xbc, 0xd8, 0x86, 0x8c, 0x66, 0x33,
+  0xd6, 0xe9, 0xbb, 0x64, 0xcf, 0x09, 0xbb, 0xdc, 0x0b, 0xbf, 0xb7, 0xef,
+  0xd5, 0x5a, 0x0c, 0x2c, 0x54, 0x42, 0x09, 0xe4, 0xee, 0xc1, 0x2e, 0x63,
+  0xa4, 0x0a, 0xa7, 0x4e, 0xff, 0x63, 0x2d, 0x1d, 0xb0, 0x54, 0x95, 0x96,
+  0x79, 0xfd, 0x36, 0xf9, 0x56, 0x35, 0x8b, 0xa7, 0xf5, 0xc3, 0x9c, 0xd0,
+  0x83, 0x11, 0xf2, 0xb5, 0x8c, 0x52, 0xac, 0x9c, 0x7a, 0x8c, 0xb9, 0x97,
+  0x34, 0x55, 0x32, 0xe0, 0x26, 0x79, 0x20, 0xbf, 0x7a, 0x3e, 0xfb, 0x58,
+  0x8f, 0xe3, 0xfc, 0x02, 0xcf, 0xa2, 0x19, 0x5d, 0xb2, 0xf9, 0x4e, 0x74,
+  0x0e, 0xc9, 0xcd, 0x75, 0xbb, 0xd5, 0x57, 0x31, 0x63, 0x12, 0xa4, 0xb4,
+  0xa8, 0x89, 0x22, 0xf7, 0x36, 0xa4, 0x71, 0x72, 0xc0, 0xdd, 0x28, 0x70,
+  0xcd, 0x48, 0x11, 0xeb, 0xc0, 0x6a, 0x3b, 0x89, 0xce, 0xb6, 0xed, 0xbe,
+  0xbb, 0x1a, 0x26, 0xc3, 0xa9, 0xa9, 0x20, 0x0e, 0xea, 0xc6, 0x32, 0x28,
+  0x25, 0x67, 0x39, 0x6f, 0xd0, 0x0b, 0xbb, 0x75, 0xdd, 0x04, 0xb8, 0x71,
+  0xaa, 0xae, 0x19, 0x9a, 0xad, 0x76, 0x35, 0x84, 0x11, 0x6d, 0x9d, 0x41,
+  0x0e, 0xfe, 0xf7, 0xfe, 0xa3, 0xad, 0x4a, 0x36, 0x36, 0xa4, 0xa9, 0x7e,
+  0x03, 0x5d, 0xaf, 0xfc, 0x6a, 0x2c, 0xb8, 0x32, 0xfe, 0xf9, 0xa4, 0xbf,
+  0xf3, 0xdc, 0x92, 0xd7, 0x0c, 0x51, 0x5f, 0x08, 0xbc, 0x25, 0x9c, 0x15,
+  0x4a, 0xa3, 0x64, 0x30, 0x6d, 0x5a, 0xc4, 0xc9, 0x7d, 0xe7, 0x81, 0x34,
+  0x2e, 0x39, 0xb8, 0xc5, 0x6b, 0x48, 0x1b, 0xfc, 0x32, 0x3d, 0xf7, 0x9b,
+  0x6c, 0x5d, 0x00, 0x6b, 0x96, 0x82, 0x1f, 0x97, 0x35, 0x49, 0x4c, 0xe1,
+  0xc3, 0x45, 0xc6, 0x1b, 0x3d, 0xbe, 0x67, 0x33, 0xf4, 0x53, 0x78, 0xd7,
+  0xcf, 0x54, 0x78, 0x96, 0x02, 0x0f, 0x75, 0xb9, 0x95, 0x76, 0x1d, 0xba,
+  0x48, 0x88, 0xe9, 0x2c, 0xd1, 0x88, 0xc3, 0x5f, 0x18, 0x19, 0xf0, 0x2c,
+  0x85, 0xf6, 0xab, 0xff, 0x90, 0xea, 0x51, 0xf8, 0x83, 0xa8, 0xcf, 0x64,
+  0xab, 0x53, 0x54, 0xca, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+  0x44, 0x44, 0x44, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed,
+  0xed, 0xed, 0xed, 0xed, 0xed, 0xa6, 0xb9, 0x35, 0xff, 0x31, 0xbe, 0x06,
+  0xaa, 0x8d, 0x34, 0x59, 0xc7, 0xe0, 0x4e, 0xfb, 0x28, 0x01, 0xa6, 0x13,
+  0x2b, 0x49, 0x97, 0xef, 0x8f, 0x8f, 0x4b, 0x9c, 0x3b, 0x71, 0x4b, 0xf2,
+  0xa7, 0x24, 0x74, 0xb8, 0xad, 0xa3, 0x35, 0xc1, 0x59, 0x77, 0xc4, 0x51,
+  0x98, 0x37, 0x6b, 0xe2, 0x0e, 0x5e, 0x6b, 0x09, 0xb2, 0xec, 0xee, 0x21,
+  0x2e, 0x98, 0x2e, 0xe3, 0x26, 0x35, 0xab, 0xe9, 0x01, 0x08, 0xbf, 0x4a,
+  0xca, 0xfd, 0xd7, 0x2a, 0x2e, 0x31, 0xc9, 0x49, 0x85, 0xc4, 0x07, 0xb1,
+  0xd9, 0xdd, 0xba, 0xca, 0xc8, 0x12, 0x18, 0x8c, 0x83, 0xa4, 0xbc, 0xbc,
+  0x15, 0x10, 0x7d, 0xf6, 0x78, 0x9c, 0x86, 0xb3, 0xd3, 0xae, 0x0b, 0xa1,
+  0xe4, 0xb9, 0x79, 0xa8, 0x55, 0x33, 0xf0, 0x71, 0xa5, 0x47, 0x30, 0xbe,
+  0x8f, 0xd3, 0xcb, 0x92, 0xee, 0xa6, 0x7a, 0x8d, 0x4d, 0x85, 0x48, 0xd0,
+  0x8b, 0x76, 0x10, 0xd6, 0x1e, 0xff, 0x66, 0x2a, 0x76, 0xb7, 0xb8, 0xf0,
+  0x3b, 0x0a, 0x11, 0x02, 0x03, 0x51, 0xc8, 0x7b, 0x6b, 0x8a, 0x8f, 0xf2,
+  0x1c, 0x8d, 0xe1, 0x70, 0x77, 0xe7, 0x01, 0xbd, 0x95, 0x6b, 0x0e, 0x8d,
+  0xdb, 0xb5, 0xd3, 0xa7, 0x06, 0xc7, 0xcf, 0x1d, 0xd9, 0xff, 0xb5, 0xe0,
+  0xf2, 0x9d, 0xec, 0x21, 0x6e, 0x65, 0x9d, 0x10, 0x05, 0x42, 0x22, 0xdf,
+  0x19, 0x61, 0x0a, 0xca, 0xde, 0x55, 0x0b, 0x6d, 0xc0, 0xbe, 0xa0, 0x2e,
+  0xf9, 0xcc, 0xec, 0x7d, 0x74, 0x56, 0x35, 0x69, 0xa5, 0x06, 0x4a, 0x02,
+  0x4d, 0x3d, 0x18, 0xc4, 0x95, 0x41, 0x1e, 0xb2, 0x57, 0x2a, 0xcc, 0xa7,
+  0x2f, 0xeb, 0xf9, 0x06, 0x1f, 0x4b, 0x10, 0x36, 0x95, 0x31, 0x5b, 0x13,
+  0x55, 0x0a, 0x48, 0x6e, 0x33, 0x70, 0xda, 0x41, 0x23, 0x3c, 0xad, 0x09,
+  0x77, 0x23, 0x44, 0x12, 0xab, 0x53, 0x4b, 0x9f, 0xf8, 0xdb, 0x69, 0x83,
+  0x6f, 0x4d, 0xfe, 0x5f, 0xa5, 0xff, 0x78, 0x18, 0xcc, 0xd1, 0x9b, 0x48,
+  0x14, 0x1f, 0x37, 0xec, 0x23, 0xdc, 0x94, 0x62, 0xfb, 0x61, 0x6b, 0x75,
+  0x76, 0x74, 0x0a, 0xf6, 0x28, 0xd3, 0xd3, 0x07, 0x4c, 0xeb, 0xb1, 0xef,
+  0x51, 0xba, 0xd1, 0x3f, 0xc0, 0x31, 0x94, 0xe6, 0x02, 0x08, 0x6d, 0x27,
+  0xb2, 0x17, 0x96, 0x7a, 0xe3, 0xfc, 0x39, 0xa7, 0x94, 0x71, 0x39, 0xd4,
+  0x54, 0x88, 0xde, 0x51, 0x12, 0x14, 0x34, 0xc3, 0xe8, 0x44, 0x27, 0x14,
+  0x54, 0x00, 0x8b, 0xb7, 0xd8, 0x54, 0x27, 0xc4, 0xd0, 0x55, 0xa1, 0x89,
+  0x7f, 0xc3, 0xce, 0x37, 0xd4, 0x0a, 0x30, 0x28, 0xf2, 0xb9, 0xdc, 0x3e,
+  0x3e, 0x3e, 0x90, 0xef, 0xb6, 0x46, 0xe9, 0xd8, 0x7a, 0x3d, 0xa2, 0x76,
+  0x21, 0xa9, 0x06, 0x13, 0x52, 0xde, 0x88, 0xb6, 0x24, 0x9c, 0xbc, 0xd2,
+  0x34, 0x46, 0x10, 0x05, 0x6d, 0x57, 0x28, 0x46, 0xd2, 0xae, 0x8f, 0x07,
+  0xd5, 0x4c, 0x91, 0x8e, 0xf0, 0x9f, 0x98, 0x83, 0x32, 0x44, 0x13, 0x96,
+  0xdb, 0xc8, 0x66, 0x7d, 0xde, 0x23, 0x82, 0xef, 0x58, 0x18, 0x0e, 0xa2,
+  0xa7, 0x6b, 0x3a, 0xb4, 0x77, 0x83, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4,
+  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xe4, 0x1b, 0x42, 0x7a, 0x7f, 0xbc,
+  0xbd, 0x72, 0x6c, 0xc2, 0x38, 0x2b, 0xb4, 0x20, 0x81, 0xbb, 0xf1, 0xe9,
+  0xd6, 0xdd, 0x5d, 0x46, 0x5d, 0xdb, 0x09, 0x5f, 0x71, 0xfe, 0x51, 0xf2,
+  0x38, 0x73, 0x8b, 0x89, 0xbc, 0x2d, 0x6e, 0x69, 0xad, 0x62, 0xa4, 0xad,
+  0xab, 0x72, 0x78, 0x3a, 0x09, 0x13, 0xfc, 0x79, 0x23, 0x2f, 0x40, 0xac,
+  0x47, 0x35, 0x9c, 0x0b, 0x0e, 0xcf, 0x47, 0x35, 0xab, 0xda, 0x1b, 0xf2,
+  0x81, 0x0e, 0xa2, 0x01, 0xb6, 0x5d, 0xfd, 0xfc, 0x45, 0x19, 0x61, 0xf1,
+  0xf4, 0xcb, 0xb1, 0x74, 0x5e, 0x6f, 0x2e, 0xd0, 0x2b, 0x59, 0x49, 0x29,
+  0xab, 0x4f, 0x67, 0xb8, 0x56, 0xfb, 0x35, 0xab, 0xc4, 0xda, 0x0b, 0x77,
+  0x13, 0x83, 0x32, 0x78, 0x78, 0x87, 0xf5, 0x25, 0x05, 0x32, 0x3f, 0xae,
+  0x33, 0x18, 0xf5, 0xf9, 0x88, 0x28, 0x33, 0x04, 0xc0, 0xc1, 0x74, 0xe8,
+  0x89, 0xbc, 0xb3, 0x18, 0x50, 0xee, 0x94, 0x1a, 0xa8, 0x12, 0x2f, 0x35,
+  0xbe, 0x71, 0x21, 0xd0, 0x73, 0x78, 0x45, 0x04, 0x56, 0x67, 0x63, 0x40,
+  0xa8, 0xe0, 0x35, 0x95, 0x45, 0xbf, 0x3b, 0xc3, 0xad, 0x42, 0x6b, 0x8b,
+  0xa1, 0x1d, 0x87, 0xd6, 0x4a, 0x55, 0x1e, 0xe9, 0x88, 0xfe, 0x29, 0xe9,
+  0xac, 0xe1, 0x6a, 0x42, 0x53, 0xba, 0x91, 0xa6, 0xc8, 0xfc, 0xcb, 0x3c,
+  0xd1, 0x95, 0x44, 0x02, 0xbc, 0x83, 0x24, 0x8d, 0x36, 0x7e, 0xe6, 0x16,
+  0xbe, 0xae, 0x0c, 0xf2, 0x1b, 0x68, 0x91, 0x90, 0x2c, 0xc5, 0xc7, 0x43,
+  0xe1, 0x56, 0x21, 0x79, 0x3c, 0xdd, 0x34, 0xf9, 0xb9, 0x85, 0x74, 0x3c,
+  0x4f, 0x35, 0xaf, 0x44, 0xd9, 0xc8, 0x72, 0x72, 0x84, 0x00, 0xd6, 0xa7,
+  0xd0, 0xed, 0xd8, 0x79, 0x8b, 0xcb, 0x7f, 0xf1, 0x35, 0x96, 0x64, 0x49,
+  0xa5, 0x37, 0x95, 0x77, 0x49, 0x60, 0xe5, 0xad, 0x19, 0xf6, 0x22, 0xc2,
+  0xab, 0x6c, 0x3d, 0x87, 0x1d, 0xfd, 0xaf, 0x29, 0xaf, 0x2a, 0xb0, 0xf3,
+  0x43, 0x3f, 0x6a, 0x8f, 0x5c, 0x9f, 0x1b, 0x57, 0xd3, 0x53, 0xab, 0xac,
+  0x49, 0xd5, 0x36, 0xd0, 0x13, 0x1c, 0x6b, 0xa3, 0x30, 0x24, 0x05, 0x1b,
+  0xe1, 0x16, 0xf8, 0x9a, 0xf4, 0xc3, 0x6a, 0x81, 0xee, 0x18, 0x68, 0x50,
+  0xa4, 0x1e, 0xb9, 0xfe, 0x7d, 0x85, 0xce, 0x78, 0xc0, 0x2c, 0x9b, 0xd5,
+  0xb5, 0x2a, 0xe9, 0x47, 0xb6, 0xd4, 0xc2, 0xba, 0xa3, 0x56, 0x1e, 0xad,
+  0x95, 0xb4, 0xa1, 0x3d, 0x97, 0x61, 0xad, 0x94, 0x89, 0xed, 0xe6, 0x26,
+  0x1a, 0x58, 0x43, 0x71, 0x9b, 0x2c, 0xe7, 0x4b, 0x8a, 0x39, 0xcd, 0x5b,
+  0x04, 0xc9, 0x34, 0xe2, 0xbb, 0xa8, 0x1e, 0xb3, 0xb5, 0x50, 0x11, 0x30,
+  0x21, 0x8a, 0x2e, 0xba, 0x7a, 0x41, 0xaa, 0x09, 0x0a, 0xe0, 0xb1, 0x2f,
+  0x7c, 0x4a, 0xf2, 0xcc, 0x45, 0xae, 0x59, 0x33, 0x58, 0xe1, 0x4f, 0x27,
+  0xf8, 0x40, 0xac, 0x1c, 0xdf, 0x48, 0x82, 0x9a, 0xdf, 0xc4, 0xc2, 0x1a,
+  0x0f, 0x9c, 0xcc, 0xcc, 0x7e, 0x88, 0xf8, 0x9a, 0xc8, 0x12, 0xf2, 0x5d,
+  0xac, 0x84, 0x9b, 0x02, 0x7c, 0xbc, 0x00, 0xd0, 0x90, 0x68, 0x3f, 0x75,
+  0xd6, 0xef, 0xe1, 0xdc, 0x2a, 0xe7, 0x67, 0x5d, 0x8d, 0x2a, 0x92, 0xc3,
+  0xb5, 0xd6, 0x35, 0x9e, 0x93, 0xa4, 0x33, 0x76, 0x4a, 0xac, 0xa6, 0x02,
+  0x5b, 0xb7, 0xed, 0x3f, 0x94, 0x3e, 0x5e, 0xf1, 0xf4, 0xa7, 0xf4, 0x51,
+  0x21, 0x8f, 0xcf, 0x5d, 0x2c, 0x38, 0x88, 0xaf, 0xa4, 0xcc, 0x65, 0x9b,
+  0xd8, 0x8d, 0x5b, 0xad, 0xe9, 0x63, 0x56, 0xb3, 0xcf, 0xd2, 0xd2, 0x40,
+  0x60, 0x0f, 0xe8, 0x03, 0xa4, 0x03, 0xf0, 0x18, 0x37, 0x11, 0x17, 0x62,
+  0x89, 0x63, 0x2e, 0xa9, 0x81, 0xcb, 0x79, 0x38, 0x38, 0x6b, 0x1c, 0xa4,
+  0x32, 0xbd, 0xd2, 0x2a, 0xa3, 0xce, 0xe3, 0x58, 0x20, 0x6e, 0x47, 0xac,
+  0x23, 0x4a, 0x8c, 0xd1, 0x78, 0x8c, 0x31, 0xa0, 0x2c, 0xe5, 0x06, 0x91,
+  0x2a, 0x60, 0xe6, 0x32, 0x80, 0x59, 0x27, 0xf4, 0x49, 0x61, 0x4e, 0xfb,
+  0x92, 0xa1, 0x81, 0x72, 0x80, 0xc7, 0x17, 0xdd, 0x68, 0x3e, 0xdd, 0x30,
+  0x14, 0xb7, 0xb6, 0xe2, 0x7f, 0x1a, 0xa9, 0xff, 0x4d, 0x2c, 0x16, 0xd6,
+  0x64, 0x22, 0x25, 0x70, 0xe2, 0x80, 0x5d, 0x34, 0x5d, 0x19, 0xd4, 0x82,
+  0x82, 0x8a, 0x97, 0xa7, 0x35, 0xc4, 0x22, 0x43, 0xf3, 0x79, 0x0e, 0x55,
+  0x9b, 0x7c, 0x11, 0xaf, 0x0e, 0xae, 0x04, 0xe1, 0x8b, 0xd0, 0x84, 0x67,
+  0x52, 0x21, 0xfc, 0x39, 0xba, 0x3f, 0x78, 0x60, 0x59, 0x19, 0x97, 0xa7,
+  0xc3, 0x87, 0xa6, 0x14, 0xd6, 0x0f, 0xb5, 0xe9, 0x02, 0x25, 0xbb, 0xcb,
+  0x2d, 0x5e, 0xb2, 0xb2, 0x35, 0xa3, 0x0e, 0x5a, 0x4e, 0x4d, 0xb3, 0xca,
+  0x4e, 0x33, 0x9b, 0x2a, 0xdc, 0xd2, 0x23, 0x88, 0x32, 0x6f, 0x61, 0x69,
+  0xa6, 0x5b, 0xd0, 0x17, 0xd1, 0x46, 0xda, 0xc9, 0x1f, 0x32, 0x63, 0xf8,
+  0xf8, 0xd9, 0x44, 0x18, 0x89, 0x9b, 0x8b, 0x91, 0xf7, 0x3a, 0x13, 0xb8,
+  0x65, 0xf9, 0x94, 0x3e, 0x53, 0x6b, 0x6f, 0x72, 0x96, 0x75, 0xf2, 0x1a,
+  0x1a, 0x68, 0x03, 0x36, 0x1f, 0x73, 0x98, 0xeb, 0xfe, 0x95, 0x5a, 0x5a,
+  0xe9, 0x65, 0x94, 0xf9, 0x9c, 0xaa, 0xed, 0xe8, 0x0f, 0x70, 0x0d, 0xfc,
+  0xad, 0x5c, 0xd3, 0x42, 0x4e, 0xec, 0xe5, 0xaf, 0x03, 0xef, 0x1d, 0x40,
+  0x58, 0x48, 0xa2, 0x95, 0x1e, 0xac, 0x79, 0x89, 0xce, 0xcd, 0x34, 0x53,
+  0x34, 0xa4, 0xf7, 0x21, 0xea, 0x7f, 0x6f, 0x95, 0xca, 0x56, 0xe3, 0x5d,
+  0xac, 0xcd, 0xa9, 0x61, 0xc5, 0x40, 0xe6, 0x97, 0xf6, 0x5b, 0xbb, 0x5f,
+  0xd9, 0x7a, 0xd4, 0xd5, 0xdc, 0xf2, 0x2e, 0xf3, 0x2e, 0x9e, 0x06, 0xec,
+  0x6f, 0xcb, 0x7a, 0xb3, 0x62, 0x94, 0x3c, 0xf6, 0x92, 0xfb, 0xd0, 0xe6,
+  0xe4, 0x75, 0x9b, 0x20, 0x9d, 0x66, 0x2a, 0x0d, 0x54, 0x1d, 0x0a, 0x8d,
+  0xf4, 0xec, 0x9a, 0x46, 0x11, 0x87, 0x89, 0xf4, 0xc4, 0x71, 0xf1, 0xd6,
+  0x86, 0xf6, 0x7f, 0x34, 0x63, 0x72, 0x22, 0xc7, 0x89, 0x86, 0xbe, 0x2b,
+  0x5a, 0x56, 0xeb, 0x50, 0x1d, 0xb1, 0x12, 0xbf, 0xe8, 0xc3, 0x47, 0xb6,
+  0xa0, 0x62, 0xfb, 0x41, 0x5e, 0x43, 0x3b, 0x03, 0x48, 0x38, 0xd6, 0xce,
+  0x29, 0xa0, 0x91, 0xdf, 0xc6, 0x1f, 0x6d, 0xa3, 0xa8, 0x82, 0x26, 0x5a,
+  0x42, 0xe2, 0xf4, 0x08, 0x8b, 0x9c, 0xd7, 0x55, 0xfe, 0xb4, 0xa7, 0x36,
+  0x05, 0x5a, 0xf2, 0x16, 0x7a, 0xf5, 0x66, 0xde, 0x7f, 0x03, 0x97, 0xa2,
+  0xa5, 0x2b, 0x3e, 0xd5, 0x55, 0xc4, 0x93, 0xff, 0x51, 0x37, 0x1d, 0x1a,
+  0x38, 0x64, 0x90, 0x68, 0x86, 0xce, 0x13, 0xe0, 0xe5, 0xc1, 0x10, 0x4b,
+  0x45, 0x8e, 0x8c, 0xb0, 0xf2, 0x06, 0xf0, 0x42, 0xd6, 0x2c, 0xe6, 0x64,
+  0xe8, 0x34, 0xc7, 0x5f, 0x05, 0x35, 0x41, 0xc2, 0x34, 0x0c, 0x10, 0x76,
+  0xa1, 0x78, 0xef, 0x93, 0x9a, 0xdd, 0x8d, 0x0b, 0x71, 0x05, 0xde, 0x8f,
+  0xce, 0xe2, 0xc4, 0x6d, 0xf6, 0x40, 0x53, 0x21, 0x61, 0x51, 0x64, 0x3c,
+  0xf1, 0xe8, 0x02, 0x3e, 0x68, 0x15, 0xb3, 0xbb, 0xed, 0x18, 0xc1, 0xdf,
+  0x43, 0x55, 0x56, 0xc6, 0x55, 0x07, 0xcc, 0xac, 0x69, 0x22, 0xa6, 0x1a,
+  0x81, 0xc9, 0x59, 0x80, 0x19, 0x09, 0x84, 0xb0, 0x12, 0x37, 0x44, 0x89,
+  0x9b, 0x33, 0x2f, 0xaa, 0x7e, 0xa7, 0x14, 0xfc, 0x08, 0x48, 0xda, 0xab,
+  0x99, 0xf1, 0x0b, 0xd3, 0x4c, 0xf0, 0x5c, 0x10, 0x9d, 0x3d, 0x40, 0x7d,
+  0xa8, 0xfc, 0xb4, 0x5a, 0x70, 0x8f, 0x9a, 0x66, 0xcb, 0x18, 0x47, 0x7e,
+  0xc1, 0x84, 0x76, 0x27, 0x2f, 0x02, 0x6b, 0x34, 0xf6, 0x76, 0x9a, 0x5c,
+  0x78, 0xcc, 0x9a, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
+  0x7e, 0x7e, 0x7e, 0x41, 0xe5, 0x0e, 0xce, 0xe7, 0x7b, 0xa3, 0x5f, 0x5f,
+  0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0xa5, 0x5f, 0x69, 0xba,
+  0xfe, 0xaa, 0x3a, 0x85, 0xc3, 0x2d, 0xd8, 0xd9, 0x05, 0x21, 0xdd, 0x5f,
+  0xbd, 0x79, 0x0f, 0x95, 0x2c, 0xef, 0xa9, 0xce, 0xd1, 0xeb, 0x9e, 0x1c,
+  0x2e, 0x48, 0x50, 0xcb, 0xb3, 0xef, 0xe2, 0x0b, 0x42, 0xb5, 0xf4, 0xc0,
+  0x10, 0x38, 0x38, 0x94, 0x0e, 0x91, 0x3b, 0x33, 0x16, 0xaa, 0x3c, 0x2a,
+  0xb5, 0xba, 0xca, 0x95, 0xa8, 0xaf, 0x25, 0x78, 0x29, 0x89, 0x79, 0x5f,
+  0x01, 0xff, 0x3b, 0x45, 0x1c, 0xcf, 0x4f, 0x08, 0xa5, 0xd0, 0x5a, 0x28,
+  0x5b, 0x85, 0x32, 0x7f, 0x6a, 0x89, 0x39, 0x54, 0xc7, 0x69, 0x2f, 0x64,
+  0x8c, 0xfe, 0x1f, 0xca, 0xe6, 0x6b, 0xf7, 0xbb, 0x10, 0x64, 0xf0, 0x9e,
+  0xaa, 0x10, 0x31, 0xfa, 0x4a, 0xc4, 0x58, 0x98, 0xa0, 0x2d, 0xf8, 0xad,
+  0xa3, 0x0a, 0xd0, 0x57, 0xbd, 0x93, 0xf0, 0x87, 0x3d, 0xd7, 0x95, 0x44,
+  0x20, 0x80, 0x30, 0xac, 0x26, 0x74, 0x18, 0xd0, 0xba, 0xf3, 0x73, 0x10,
+  0xb0, 0xb2, 0x40, 0x07, 0x71, 0xb1, 0xfd, 0xc0, 0x63, 0x4b, 0x5b, 0x1d,
+  0x83, 0x1f, 0x01, 0x92, 0xa0, 0x90, 0x65, 0x47, 0x0e, 0x32, 0x1e, 0x22,
+  0xd5, 0xe5, 0xd4, 0xc0, 0x29, 0xfc, 0x73, 0x51, 0xf3, 0x58, 0x70, 0x76,
+  0xe6, 0x3f, 0xe4, 0x05, 0xb4, 0x86, 0x20, 0xf0, 0xd2, 0x62, 0xda, 0x03,
+  0x91, 0x9d, 0xb0, 0x6c, 0x7c, 0x44, 0x40, 0x03, 0xd1, 0x64, 0x04, 0x8d,
+  0x8b, 0x03, 0xab, 0x5b, 0x99, 0x8b, 0xff, 0xa3, 0x25, 0xf7, 0xaa, 0x50,
+  0x4f, 0x52, 0x1a, 0x58, 0x69, 0x61, 0x62, 0xb4, 0x66, 0xd0, 0xff, 0xde,
+  0xfd, 0xa7, 0xc7, 0x8b, 0x60, 0x81, 0xd2, 0x9e, 0x0d, 0xa3, 0xa3, 0x07,
+  0x81, 0x36, 0x72, 0xff, 0xd2, 0x10, 0x39, 0x70, 0x9d, 0x24, 0x46, 0xd6,
+  0xb2, 0xb0, 0x01, 0xd4, 0xaf, 0xbf, 0x0b, 0x8d, 0x50, 0x03, 0x45, 0x73,
+  0x38, 0xf0, 0x6a, 0x24, 0xf3, 0x4b, 0x1a, 0x01, 0xf4, 0x5c, 0xd1, 0x2a,
+  0xbf, 0x2d, 0x3d, 0x04, 0x74, 0x91, 0xcb, 0x41, 0xb4, 0x2a, 0xbb, 0xae,
+  0x69, 0x1a, 0x1d, 0xae, 0xf6, 0xc3, 0x82, 0xc9, 0xe5, 0x28, 0x5d, 0x60,
+  0x07, 0x44, 0xb1, 0x57, 0x35, 0xd9, 0xac, 0xc0, 0x66, 0x54, 0xfa, 0x64,
+  0x4f, 0xf3, 0x46, 0xd9, 0x7a, 0x73, 0x7c, 0xe9, 0x37, 0x25, 0xe5, 0x13,
+  0x8e, 0xfa, 0x9a, 0xdc, 0xdb, 0x97, 0x86, 0x24, 0x2f, 0x4a, 0x0c, 0x61,
+  0x7c, 0x01, 0x36, 0x51, 0xf7, 0x8f, 0x6e, 0x25, 0x85, 0xfb, 0x21, 0x83,
+  0x43, 0x9d, 0x49, 0x9d, 0x78, 0x3a, 0xbd, 0xc6, 0x56, 0x9f, 0xf4, 0x82,
+  0x12, 0x2f, 0x43, 0xc5, 0xba, 0x48, 0xcb, 0xd9, 0x37, 0xc9, 0x2f, 0x54,
+  0x70, 0x72, 0xaa, 0x80, 0x38, 0xfc, 0xe7, 0x78, 0x28, 0x82, 0xd4, 0xee,
+  0x8a, 0x4e, 0xea, 0x1f, 0x15, 0x01, 0x41, 0x0c, 0x28, 0xa6, 0xae, 0x14,
+  0xb3, 0xe2, 0x9f, 0x46, 0x78, 0x86, 0x28, 0x22, 0x4c, 0xb7, 0xf4, 0x48,
+  0x2b, 0x4a, 0xad, 0x14, 0x44, 0xbb, 0xed, 0xe6, 0x63, 0x5e, 0x57, 0xb6,
+  0x57, 0x42, 0xcf, 0x33, 0x25, 0x0a, 0x21, 0xb0, 0x91, 0x74, 0xef, 0x76,
+  0x2f, 0xc0, 0x46, 0x06, 0xcd, 0x1f, 0xc8, 0xbd, 0xfa, 0x1d, 0x33, 0x04,
+  0xd5, 0x38, 0x99, 0x60, 0xf8, 0xb0, 0xc2, 0x97, 0x1d, 0xf5, 0x25, 0x34,
+  0x7c, 0x47, 0xb3, 0x7d, 0x10, 0xcd, 0x3a, 0x02, 0x8f, 0xe6, 0x4c, 0xa9,
+  0x5d, 0x55, 0x84, 0x01, 0x52, 0xb4, 0x4f, 0x57, 0x40, 0x5b, 0x85, 0xc5,
+  0x5b, 0xce, 0x13, 0x51, 0x96, 0xc6, 0x31, 0x70, 0x54, 0xe0, 0x12, 0x5d,
+  0xeb, 0xf3, 0x70, 0x3b, 0x59, 0xa1, 0xe2, 0x0a, 0x98, 0x17, 0x30, 0x9b,
+  0xfe, 0xb5, 0x1c, 0x9b, 0x61, 0xa7, 0xda, 0x23, 0x29, 0x8a, 0x0d, 0x8f,
+  0x5b, 0x3e, 0xf3, 0xda, 0x07, 0x10, 0x07, 0xaf, 0x74, 0x3f, 0xe4, 0x39,
+  0xa0, 0xdc, 0x81, 0x5f, 0xe7, 0x38, 0xdc, 0xa3, 0x1c, 0x31, 0xab, 0x4a,
+  0x6d, 0xc0, 0xc5, 0xed, 0x70, 0x6d, 0x3f, 0x6c, 0xce, 0x96, 0x64, 0xb6,
+  0x77, 0x6b, 0xe3, 0x46, 0x9a, 0x54, 0x6b, 0x6d, 0x08, 0x83, 0x36, 0xf8,
+  0x95, 0x85, 0x85, 0x17, 0xc1, 0x81, 0xb8, 0xf8, 0x13, 0xd1, 0xd8, 0xb4,
+  0x12, 0xad, 0x5c, 0xe5, 0x5b, 0x6d, 0x7f, 0x92, 0x70, 0x08, 0xaf, 0xc2,
+  0x38, 0x50, 0x1a, 0x0f, 0xb9, 0x26, 0x09, 0x4b, 0xaa, 0x01, 0xfe, 0x23,
+  0x94, 0x62, 0x55, 0xae, 0x39, 0x0c, 0x65, 0x60, 0x56, 0xc8, 0x60, 0x80,
+  0x96, 0xcd, 0xc0, 0x34, 0xdd, 0xd7, 0xe9, 0x61, 0x56, 0x9c, 0x8c, 0x01,
+  0x96, 0x0c, 0x0e, 0x7f, 0x1f, 0x30, 0x53, 0x41, 0xa1, 0xbd, 0x72, 0xc6,
+  0x28, 0x37, 0x01, 0x73, 0x88, 0x14, 0xba, 0x9a, 0xb7, 0xf1, 0xbb, 0x47,
+  0xb0, 0xa5, 0xa9, 0x0c, 0x7d, 0x00, 0x9d, 0x09, 0x59, 0xed, 0xcd, 0xcd,
+  0x3c, 0xf4, 0x1d, 0x0d, 0x46, 0x61, 0xd8, 0x65, 0x81, 0x54, 0xd7, 0x1c,
+  0x3b, 0x6a, 0x8d, 0xcc, 0x44, 0x9b, 0xfc, 0xc4, 0x4f, 0x17, 0x07, 0x72,
+  0x89, 0x54, 0xfe, 0xee, 0x6e, 0x35, 0x93, 0x60, 0x75, 0x12, 0x0e, 0x78,
+  0xff, 0x6c, 0xe8, 0x57, 0xf6, 0x44, 0xf3, 0x95, 0xcb, 0x3f, 0x4e, 0xa0,
+  0x58, 0x25, 0x51, 0xa5, 0x25, 0x45, 0xa4, 0xbc, 0x7e, 0x42, 0x94, 0x94,
+  0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x34, 0x7f,
+  0xe3, 0xf7, 0x80, 0x6f, 0xc2, 0x09, 0x6a, 0x2c, 0xce, 0xae, 0x30, 0x05,
+  0x31, 0xd5, 0x45, 0xb9, 0x82, 0x8d, 0x9b, 0x90, 0xb7, 0xfb, 0x37, 0x34,
+  0x0e, 0x05, 0x15, 0x7f, 0xd1, 0x2b, 0x5c, 0x33, 0x6e, 0x45, 0xdf, 0xb9,
+  0xb9, 0x01, 0x14, 0x81, 0x40, 0x93, 0x45, 0x45, 0xda, 0xf2, 0x0f, 0xea,
+  0x0f, 0x29, 0x20, 0xa9, 0x17, 0x94, 0xa6, 0xc4, 0x39, 0xa7, 0x49, 0xf3,
+  0x8d, 0x15, 0x64, 0x9b, 0x1b, 0xa4, 0x02, 0x01, 0x4b, 0xe2, 0xe4, 0x24,
+  0x50, 0xa3, 0xe0, 0x78, 0x92, 0x47, 0x31, 0xdb, 0xb0, 0xa4, 0xa1, 0x43,
+  0x34, 0x17, 0x12, 0x82, 0xf0, 0x21, 0x31, 0x32, 0xf9, 0xa6, 0x83, 0x2c,
+  0x91, 0x7f, 0x92, 0x36, 0xbe, 0x0d, 0x6d, 0xe6, 0x79, 0x4d, 0x2f, 0xbd,
+  0x34, 0x4b, 0x56, 0x1c, 0xd3, 0xef, 0xae, 0x85, 0xab, 0xc8, 0xa3, 0x63,
+  0xff, 0xcc, 0x55, 0x47, 0x50, 0x6e, 0x59, 0x4c, 0xe0, 0xd0, 0xe6, 0xa5,
+  0x16, 0xe9, 0xf8, 0x7a, 0x66, 0xb9, 0xf1, 0x24, 0x96, 0x3c, 0x47, 0x9a,
+  0x57, 0xc5, 0xbf, 0xce, 0x3d, 0x93, 0x9e, 0x09, 0xdd, 0x96, 0x4e, 0x29,
+  0x24, 0x4f, 0xa6, 0x0c, 0xfb, 0xc7, 0x74, 0x97, 0xbe, 0x9e, 0x4e, 0xe2,
+  0x39, 0x16, 0x2f, 0x4b, 0xcc, 0xd9, 0xe7, 0x56, 0x29, 0x74, 0x50, 0xf0,
+  0x89, 0x44, 0xfa, 0x46, 0x07, 0x7e, 0x68, 0x0b, 0xaa, 0xb3, 0xe0, 0x98,
+  0x5b, 0x68, 0x2a, 0x98, 0x89, 0xbb, 0xa5, 0x82, 0x4d, 0x46, 0xde, 0x21,
+  0x8e, 0x8c, 0x9d, 0x6c, 0xac, 0x7d, 0x1e, 0xe9, 0xfd, 0xdd, 0xa1, 0x8c,
+  0x4d, 0x9c, 0x96, 0x89, 0x8a, 0xc7, 0x4c, 0x2b, 0x3c, 0xda, 0x5f, 0x97,
+  0x11, 0x4f, 0xde, 0xf7, 0xb5, 0x22, 0xc8, 0x3f, 0x70, 0x1f, 0x3b, 0x45,
+  0x8c, 0x41, 0xeb, 0x30, 0xab, 0xe3, 0xde, 0xea, 0xa8, 0x12, 0xce, 0x3e,
+  0x92, 0xd6, 0x79, 0x7e, 0xa7, 0x16, 0x9d, 0x42, 0x18, 0x0d, 0x23, 0xae,
+  0xd3, 0x95, 0x8f, 0x96, 0x92, 0xfd, 0x07, 0xdf, 0x55, 0xe8, 0x52, 0xe9,
+  0xc9, 0x35, 0xb1, 0xfc, 0x21, 0xe2, 0x43, 0x5e, 0xa4, 0xfd, 0xaa, 0xb5,
+  0xcf, 0x41, 0x2d, 0x90, 0xf5, 0xdc, 0x93, 0x7e, 0xc3, 0xf9, 0x8c, 0x7d,
+  0x39, 0x98, 0x61, 0x43, 0x5e, 0x55, 0xf0, 0x34, 0x01, 0xd2, 0xe1, 0x37,
+  0x27, 0x19, 0xa4, 0xa1, 0x3d, 0x30, 0x0a, 0xa3, 0x9c, 0x6a, 0x8e, 0xff,
+  0x38, 0x9c, 0xf5, 0x1c, 0x62, 0x66, 0x40, 0xfc, 0x41, 0x6c, 0x2f, 0x6f,
+  0x43, 0xb3, 0x7f, 0x2b, 0xe6, 0xfa, 0xb5, 0x6a, 0xfd, 0x92, 0xc3, 0xe2,
+  0x37, 0x01, 0xb5, 0x8d, 0xdf, 0x50, 0x6b, 0x6b, 0xdf, 0x4e, 0x0b, 0xbb,
+  0xc7, 0xe6, 0xf9, 0xb2, 0xd4, 0xf9, 0x56, 0x35, 0xe2, 0x94, 0x7e, 0xcd,
+  0x28, 0x28, 0x72, 0x5a, 0x32, 0xa8, 0xc7, 0xff, 0x6f, 0xfe, 0x2d, 0x74,
+  0x01, 0xbf, 0x28, 0x86, 0x12, 0x75, 0xa5, 0xe9, 0xc0, 0x48, 0x7e, 0xcc,
+  0xac, 0x53, 0x00, 0xa0, 0x52, 0x54, 0x76, 0x48, 0xaa, 0xf0, 0x17, 0x95,
+  0x05, 0x23, 0x6f, 0xa4, 0x03, 0xa8, 0x0f, 0x66, 0xc3, 0x5d, 0xc8, 0x3b,
+  0xba, 0x71, 0x81, 0x43, 0x83, 0xcd, 0x5d, 0xec, 0x55, 0x66, 0x54, 0x08,
+  0x2b, 0xea, 0xe9, 0xb5, 0xe9, 0xf3, 0xc7, 0xca, 0x56, 0x17, 0xb6, 0x11,
+  0x48, 0x6a, 0x19, 0x71, 0x29, 0xbf, 0x54, 0x98, 0xe5, 0xec, 0x25, 0xbe,
+  0xcd, 0x5a, 0x06, 0x91, 0x74, 0xe6, 0x98, 0x46, 0x2e, 0x11, 0xdc, 0x68,
+  0x08, 0xd7, 0xdd, 0x7a, 0x3b, 0x09, 0x47, 0x69, 0xec, 0x00, 0xc5, 0xdd,
+  0x3f, 0xec, 0x1d, 0x41, 0x8a, 0xae, 0xa9, 0x2c, 0x71, 0x52, 0x83, 0x7e,
+  0xea, 0x37, 0xa8, 0x92, 0x44, 0x58, 0x1a, 0x6b, 0x8f, 0x69, 0xd4, 0x5e,
+  0x05, 0x8a, 0x29, 0x07, 0x56, 0xca, 0x1e, 0x39, 0x3d, 0x72, 0x7f, 0x1b,
+  0x8b, 0xfe, 0x48, 0x1f, 0x66, 0xc3, 0xec, 0xcc, 0xa8, 0x66, 0x2b, 0xf8,
+  0xf7, 0x0c, 0x38, 0xf0, 0x46, 0x1f, 0xa7, 0x9d, 0xba, 0x3a, 0x9d, 0x48,
+  0x43, 0xdb, 0x5d, 0x40, 0x05, 0x49, 0x60, 0x9b, 0x52, 0x1f, 0xe7, 0x9d,
+  0xeb, 0xb0, 0x92, 0x5e, 0xfd, 0x23, 0x4a, 0xd0, 0xdb, 0xab, 0xbb, 0x23,
+  0x49, 0xb3, 0x35, 0x23, 0xbf, 0xb1, 0x2f, 0xb1, 0x8e, 0xbf, 0x06, 0x55,
+  0x5b, 0xe0, 0xad, 0xc0, 0xfe, 0x9e, 0xf4, 0x9e, 0x36, 0xc3, 0xfa, 0xac,
+  0xed, 0x5f, 0x74, 0xd0, 0x30, 0xa3, 0xc9, 0x0b, 0x17, 0x32, 0x2a, 0x2e,
+  0x48, 0x66, 0xcb, 0x21, 0x5f, 0x10, 0x1f, 0xb0, 0x74, 0x9f, 0x6b, 0xce,
+  0xe2, 0x22, 0xe1, 0x9f, 0x57, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58,
+  0x58, 0x58, 0x6d, 0x58, 0x52, 0x2e, 0x1a, 0xee, 0x2e, 0x3b, 0xe8, 0x05,
+  0x0d, 0xd7, 0xe0, 0xe6, 0x9b, 0xa4, 0xdd, 0x9e, 0x57, 0x02, 0x03, 0x20,
+  0x0c, 0xd5, 0x94, 0x09, 0x9c, 0xd7, 0xc5, 0xcc, 0xd1, 0x25, 0x32, 0xb8,
+  0xea, 0x0f, 0x8b, 0x94, 0x3c, 0x3f, 0xdd, 0x5b, 0xdf, 0x99, 0xe9, 0x49,
+  0x2a, 0x80, 0x5d, 0x6a, 0x8e, 0x64, 0x1d, 0x3c, 0xa7, 0xdc, 0x60, 0x2e,
+  0x31, 0x63, 0x52, 0xcd, 0x35, 0xea, 0x80, 0x89, 0x5d, 0x5d, 0xf7, 0xcd,
+  0x03, 0xde, 0xcd, 0x8e, 0xcf, 0xf1, 0xae, 0xb2, 0x31, 0x4c, 0xdc, 0x23,
+  0xea, 0xd7, 0xe6, 0x17, 0x2d, 0x30, 0x7c, 0x2a, 0x6a, 0x6a, 0xa5, 0xc1,
+  0x7e, 0x14, 0xf6, 0xe8, 0xc5, 0x23, 0x78, 0xfe, 0x01, 0x91, 0x4d, 0x4d,
+  0x21, 0x86, 0x26, 0xac, 0xb2, 0xf1, 0x77, 0x00, 0xd8, 0xac, 0x1f, 0x65,
+  0x9c, 0x87, 0x52, 0xc4, 0x95, 0xdd, 0xa8, 0x0f, 0x1e, 0x4a, 0x16, 0x15,
+  0xd8, 0x07, 0x99, 0x9f, 0xe1, 0xb6, 0x96, 0xf9, 0xac, 0xa1, 0x9f, 0x8f,
+  0xd1, 0xbb, 0x1a, 0xdd, 0xf7, 0xd4, 0x49, 0x68, 0xfd, 0x5e, 0x33, 0x8b,
+  0xeb, 0xc3, 0x50, 0xb7, 0x5a, 0xd0, 0xdf, 0x7b, 0x0a, 0xaf, 0xe2, 0xd5,
+  0xee, 0x2f, 0x5e, 0xab, 0x2f, 0xf4, 0x69, 0xe0, 0x6d, 0x09, 0x74, 0xe2,
+  0x89, 0x26, 0xce, 0x55, 0x32, 0x4c, 0xbb, 0x3e, 0x74, 0x07, 0x6d, 0xe6,
+  0x20, 0xeb, 0xdf, 0x40, 0x12, 0x47, 0xb3, 0xfd, 0x6b, 0xa6, 0x34, 0xef,
+  0x22, 0x59, 0xe4, 0x67, 0x2f, 0xaa, 0xf2, 0xb6, 0x9a, 0xa6, 0xc7, 0x80,
+  0xbb, 0x61, 0x39, 0x00, 0x00, 0x00, 0x51, 0x00, 0xaa, 0x00, 0xff, 0x00,
+  0x08, 0x01, 0x00, 0x00, 0x4d, 0x00, 0x9c, 0x00, 0xf1, 0x00, 0x48, 0x01,
+  0x99, 0x01, 0xec, 0x01, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x06, 0x00,
+  0x12, 0x00, 0x00, 0x00, 0x07, 0x00, 0x0d, 0x00, 0x1a, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x0d, 0x00, 0x13, 0x00, 0x19, 0x00, 0x1f, 0x00, 0x25, 0x00,
+  0x2b, 0x00, 0x31, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x00, 0x00, 0x07, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00,
+  0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0c, 0x00,
+  0x12, 0x00, 0x00, 0x00, 0x07, 0x00, 0x0e, 0x00, 0x14, 0x00, 0x1a, 0x00,
+  0x20, 0x00, 0x26, 0x00, 0x2d, 0x00, 0x33, 0x00, 0x3b, 0x00, 0x42, 0x00,
+  0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x08, 0x00, 0x11, 0x00, 0x1a, 0x00,
+  0x23, 0x00, 0x38, 0x00, 0x51, 0x00, 0x66, 0x00, 0x79, 0x00, 0x8a, 0x00,
+  0x9b, 0x00, 0xae, 0x00, 0xbf, 0x00, 0xce, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x12, 0x00, 0x1b, 0x00, 0x24, 0x00, 0x2d, 0x00, 0x36, 0x00, 0x3f, 0x00,
+  0x48, 0x00, 0x51, 0x00, 0x5a, 0x00, 0x60, 0x00, 0x00, 0x00, 0x06, 0x00,
+  0x0c, 0x00, 0x13, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x08, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0c, 0x00,
+  0x00, 0x00, 0x07, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x06, 0x00, 0x10, 0x00,
+  0x1b, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x45, 0x00, 0x4d, 0x00, 0x55, 0x00,
+  0x5d, 0x00, 0x66, 0x00, 0x6f, 0x00, 0x74, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x12, 0x00, 0x1b, 0x00, 0x24, 0x00, 0x2d, 0x00, 0x36, 0x00, 0x3f, 0x00,
+  0x48, 0x00, 0x51, 0x00, 0x5a, 0x00, 0x63, 0x00, 0x6c, 0x00, 0x75, 0x00,
+  0x7e, 0x00, 0x00, 0x00, 0x16, 0x00, 0x22, 0x00, 0x00, 0x00, 0x06, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x09, 0x00, 0x12, 0x00,
+  0x00, 0x00, 0x41, 0x00, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x0c, 0x00, 0x12, 0x00, 0x18, 0x00, 0x1e, 0x00, 0x24, 0x00,
+  0x2a, 0x00, 0x31, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0c, 0x00, 0x12, 0x00,
+  0x18, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x08, 0x00, 0x0e, 0x00, 0x17, 0x00,
+  0x20, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 0x00,
+  0x0f, 0x00, 0x16, 0x00, 0x1c, 0x00, 0x22, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x1d, 0x00, 0x2c, 0x00, 0x38, 0x00, 0x44, 0x00, 0x51, 0x00, 0x60, 0x00,
+  0x6e, 0x00, 0x7c, 0x00, 0x8c, 0x00, 0x9a, 0x00, 0xaa, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x12, 0x00,
+  0x00, 0x00, 0x06, 0x00, 0x11, 0x00, 0x17, 0x00, 0x1d, 0x00, 0x2e, 0x00,
+  0x00, 0x00, 0x18, 0x00, 0x21, 0x00, 0x27, 0x00, 0x30, 0x00, 0x00, 0x00,
+  0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x54, 0x00, 0x83, 0x00,
+  0xa5, 0x00, 0xbe, 0x00, 0xdc, 0x00, 0xf3, 0x00, 0x12, 0x01, 0x00, 0x00,
+  0x07, 0x00, 0x0e, 0x00, 0x15, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x5c, 0x00,
+  0x8f, 0x00, 0xb5, 0x00, 0xd2, 0x00, 0xf4, 0x00, 0x15, 0x01, 0x00, 0x00,
+  0x09, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x09, 0x00, 0x11, 0x00, 0x1a, 0x00,
+  0x21, 0x00, 0x27, 0x00, 0x2e, 0x00, 0x35, 0x00, 0x3b, 0x00, 0x41, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00,
+  0x0e, 0x00, 0x14, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x28, 0x00,
+  0x31, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x21, 0x00, 0x4b, 0x00, 0x74, 0x00,
+  0x9d, 0x00, 0xbd, 0x00, 0xd9, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00,
+  0x25, 0x00, 0x53, 0x00, 0x81, 0x00, 0xae, 0x00, 0xd2, 0x00, 0xf2, 0x00,
+  0x12, 0x01, 0x19, 0x01, 0x1f, 0x01, 0x00, 0x00, 0x21, 0x00, 0x2e, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x10, 0x00, 0x18, 0x00, 0x1f, 0x00, 0x00, 0x00,
+  0x25, 0x00, 0x00, 0x00, 0x06, 0x00, 0x11, 0x00, 0x18, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x0c, 0x00, 0x12, 0x00, 0x28, 0x00, 0x38, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x0d, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00,
+  0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x20, 0x00, 0x29, 0x00,
+  0x33, 0x00, 0x00, 0x00, 0x30, 0x00, 0x4f, 0x00, 0x6b, 0x00, 0xa0, 0x00,
+  0xbb, 0x00, 0xdc, 0x00, 0xfb, 0x00, 0x15, 0x01, 0x1c, 0x01, 0x22, 0x01,
+  0x00, 0x00, 0x1d, 0x00, 0x38, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x34, 0x00,
+  0x57, 0x00, 0x77, 0x00, 0xb1, 0x00, 0xd0, 0x00, 0xf5, 0x00, 0x18, 0x01,
+  0x35, 0x01, 0x00, 0x00, 0x29, 0x00, 0x43, 0x00, 0x5b, 0x00, 0x61, 0x00,
+  0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x48, 0x00, 0x62, 0x00,
+  0x00, 0x00, 0x24, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00,
+  0x36, 0x00, 0x3e, 0x00, 0x46, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x1d, 0x00,
+  0x00, 0x00, 0x1c, 0x00, 0x34, 0x00, 0x3b, 0x00, 0x41, 0x00, 0x00, 0x00,
+  0x17, 0x00, 0x3a, 0x00, 0x43, 0x00, 0x4a, 0x00, 0x00, 0x00, 0x21, 0x00,
+  0x29, 0x00, 0x31, 0x00, 0x37, 0x00, 0x3f, 0x00, 0x45, 0x00, 0x4c, 0x00,
+  0x00, 0x00, 0x1b, 0x00, 0x22, 0x00, 0x29, 0x00, 0x32, 0x00, 0x00, 0x00,
+  0x17, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x3e, 0x00, 0x44, 0x00, 0x4a, 0x00,
+  0x54, 0x00, 0x00, 0x00, 0x26, 0x00, 0x4d, 0x00, 0x69, 0x00, 0x89, 0x00,
+  0x8f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x55, 0x00, 0x75, 0x00,
+  0x96, 0x00, 0xaf, 0x00, 0xcd, 0x00, 0x00, 0x00, 0x17, 0x00, 0x33, 0x00,
+  0x39, 0x00, 0x4c, 0x00, 0x55, 0x00, 0x00, 0x00, 0x18, 0x00, 0x36, 0x00,
+  0x00, 0x00, 0x42, 0x00, 0x61, 0x00, 0x67, 0x00, 0x6e, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x3e, 0x00, 0x56, 0x00, 0x6f, 0x00,
+  0x86, 0x00, 0x8c, 0x00, 0x92, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x14, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x06, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x32, 0x00, 0x38, 0x00, 0x3e, 0x00,
+  0x44, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x30, 0x00,
+  0x4a, 0x00, 0x53, 0x00, 0x5b, 0x00, 0x61, 0x00, 0x00, 0x00, 0x1b, 0x00,
+  0x33, 0x00, 0x50, 0x00, 0x56, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x18, 0x00,
+  0x3c, 0x00, 0x56, 0x00, 0x00, 0x00, 0x24, 0x00, 0x5d, 0x00, 0x75, 0x00,
+  0x7c, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x25, 0x00, 0x00, 0x00, 0x19, 0x00,
+  0x34, 0x00, 0x4d, 0x00, 0x00, 0x00, 0x18, 0x00, 0x32, 0x00, 0x39, 0x00,
+  0x40, 0x00, 0x47, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x19, 0x00, 0x33, 0x00, 0x4d, 0x00, 0x71, 0x00,
+  0x00, 0x00, 0x19, 0x00, 0x33, 0x00, 0x4f, 0x00, 0x6b, 0x00, 0x72, 0x00,
+  0x79, 0x00, 0x81, 0x00, 0x00, 0x00, 0x21, 0x00, 0x40, 0x00, 0x4c, 0x00,
+  0x54, 0x00, 0x5c, 0x00, 0x64, 0x00, 0x6c, 0x00, 0x73, 0x00, 0x7b, 0x00,
+  0x83, 0x00, 0x8a, 0x00, 0x91, 0x00, 0x99, 0x00, 0xa1, 0x00, 0xa9, 0x00,
+  0x00, 0x00, 0x1f, 0x00, 0x3c, 0x00, 0x55, 0x00, 0x5c, 0x00, 0x62, 0x00,
+  0x69, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x34, 0x00, 0x00, 0x00, 0x1b, 0x00,
+  0x35, 0x00, 0x51, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x38, 0x00, 0x53, 0x00, 0x5b, 0x00, 0x64, 0x00, 0x6d, 0x00,
+  0x00, 0x00, 0x27, 0x00, 0x2d, 0x00, 0x33, 0x00, 0x00, 0x00, 0x1a, 0x00,
+  0x3b, 0x00, 0x00, 0x00, 0x18, 0x00, 0x1e, 0x00, 0x25, 0x00, 0x00, 0x00,
+  0x1a, 0x00, 0x34, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x22, 0x00, 0x3c, 0x00,
+  0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x23, 0x00, 0x2c, 0x00,
+  0x35, 0x00, 0x3e, 0x00, 0x47, 0x00, 0x50, 0x00, 0x59, 0x00, 0x62, 0x00,
+  0x6b, 0x00, 0x74, 0x00, 0x7d, 0x00, 0x86, 0x00, 0x8f, 0x00, 0x98, 0x00,
+  0xa1, 0x00, 0xaa, 0x00, 0xb3, 0x00, 0x00, 0x00, 0x30, 0x00, 0x53, 0x00,
+  0x6d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x06, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x3c, 0x00, 0x55, 0x00,
+  0x5c, 0x00, 0x00, 0x00, 0x09, 0x00, 0x0f, 0x00, 0x16, 0x00, 0x1d, 0x00,
+  0x24, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x26, 0x00,
+  0x2f, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x07, 0x00, 0x0e, 0x00,
+  0x15, 0x00, 0x1c, 0x00, 0x23, 0x00, 0x2a, 0x00, 0x31, 0x00, 0x38, 0x00,
+  0x3f, 0x00, 0x46, 0x00, 0x4d, 0x00, 0x62, 0x00, 0x76, 0x00, 0x8b, 0x00,
+  0x00, 0x00, 0x18, 0x00, 0x2f, 0x00, 0x36, 0x00, 0x00, 0x00, 0x07, 0x00,
+  0x0d, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x35, 0x00, 0x3c, 0x00, 0x43, 0x00,
+  0x49, 0x00, 0x50, 0x00, 0x57, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x18, 0x00,
+  0x21, 0x00, 0x2a, 0x00, 0x33, 0x00, 0x3c, 0x00, 0x45, 0x00, 0x4e, 0x00,
+  0x57, 0x00, 0x60, 0x00, 0x69, 0x00, 0x72, 0x00, 0x7b, 0x00, 0x84, 0x00,
+  0x8d, 0x00, 0x96, 0x00, 0x9f, 0x00, 0xa8, 0x00, 0xb1, 0x00, 0xba, 0x00,
+  0xc3, 0x00, 0xcc, 0x00, 0xd5, 0x00, 0xde, 0x00, 0xe7, 0x00, 0xf0, 0x00,
+  0xf9, 0x00, 0x02, 0x01, 0x0b, 0x01, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00,
+  0x1f, 0x00, 0x26, 0x00, 0x00, 0x00, 0x07, 0x00, 0x0e, 0x00, 0x15, 0x00,
+  0x00, 0x00, 0x1b, 0x00, 0x23, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x19, 0x00,
+  0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x11, 0x00, 0x18, 0x00, 0x1e, 0x00, 0x27, 0x00, 0x2e, 0x00,
+  0x34, 0x00, 0x3a, 0x00, 0x40, 0x00, 0x46, 0x00, 0x4c, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x21, 0x00,
+  0x28, 0x00, 0x2f, 0x00, 0x36, 0x00, 0x3d, 0x00, 0x44, 0x00, 0x4b, 0x00,
+  0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x1a, 0x00,
+  0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x0c, 0x00, 0x14, 0x00, 0x1c, 0x00, 0x24, 0x00, 0x2a, 0x00,
+  0x30, 0x00, 0x00, 0x00, 0x09, 0x00, 0x10, 0x00, 0x16, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x06, 0x00,
+  0x0f, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x20, 0x00,
+  0x37, 0x00, 0x50, 0x00, 0x61, 0x00, 0x74, 0x00, 0x8b, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1d, 0x00, 0x23, 0x00, 0x29, 0x00, 0x00, 0x00, 0x06, 0x00,
+  0x0d, 0x00, 0x13, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x08, 0x00, 0x0f, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0c, 0x00, 0x12, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x11, 0x00,
+  0x21, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x0e, 0x00, 0x15, 0x00,
+  0x00, 0x00, 0x06, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0d, 0x00,
+  0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x15, 0x00,
+  0x00, 0x00, 0x1d, 0x00, 0x25, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0d, 0x00,
+  0x14, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x06, 0x00, 0x1b, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x4e, 0x00, 0x54, 0x00, 0x5b, 0x00, 0x61, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x08, 0x00, 0x10, 0x00, 0x18, 0x00, 0x20, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x12, 0x00, 0x19, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00,
+  0x00, 0x00, 0x07, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x10, 0x00,
+  0x00, 0x00, 0x1b, 0x00, 0x22, 0x00, 0x28, 0x00, 0x2e, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x21, 0x00, 0x29, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x21, 0x00,
+  0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0c, 0x00, 0x12, 0x00,
+  0x18, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x1e, 0x00,
+  0x00, 0x00, 0x06, 0x00, 0x0c, 0x00, 0x12, 0x00, 0x19, 0x00, 0x00, 0x00,
+  0x1a, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x07, 0x00, 0x0f, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x0d, 0x00, 0x13, 0x00, 0x1a, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x00, 0x0e, 0x00, 0x15, 0x00, 0x1c, 0x00, 0x24, 0x00,
+  0x2a, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0c, 0x00, 0x12, 0x00, 0x18, 0x00,
+  0x1e, 0x00, 0x24, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x36, 0x00, 0x3f, 0x00,
+  0x48, 0x00, 0x51, 0x00, 0x5a, 0x00, 0x63, 0x00, 0x6c, 0x00, 0x75, 0x00,
+  0x00, 0x00, 0x2b, 0x00, 0x35, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x07, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x12, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0c, 0x00,
+  0x13, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x0e, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x10, 0x00, 0x18, 0x00, 0x20, 0x00, 0x27, 0x00, 0x2d, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x12, 0x00, 0x1b, 0x00, 0x24, 0x00, 0x2d, 0x00,
+  0x36, 0x00, 0x3f, 0x00, 0x48, 0x00, 0x51, 0x00, 0x5a, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x14, 0x00, 0x1e, 0x00, 0x28, 0x00, 0x32, 0x00, 0x3c, 0x00,
+  0x46, 0x00, 0x00, 0x00, 0x26, 0x00, 0x2c, 0x00, 0x32, 0x00, 0x38, 0x00,
+  0x00, 0x00, 0x06, 0x00, 0x0d, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x21, 0x00, 0x29, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x08, 0x00, 0x10, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x0c, 0x00, 0x13, 0x00, 0x19, 0x00, 0x1f, 0x00, 0x00, 0x00,
+  0x23, 0x00, 0x2c, 0x00, 0x35, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x06, 0x00,
+  0x0c, 0x00, 0x11, 0x00, 0x00, 0x00, 0x21, 0x00, 0x27, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x27, 0x00, 0x2e, 0x00,
+  0x42, 0x00, 0x57, 0x00, 0x6b, 0x00, 0x80, 0x00, 0x92, 0x00, 0xa4, 0x00,
+  0xb7, 0x00, 0xcc, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x0c, 0x00, 0x12, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0c, 0x00,
+  0x00, 0x00, 0x06, 0x00, 0x0c, 0x00, 0x12, 0x00, 0x18, 0x00, 0x1e, 0x00,
+  0x24, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x04, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0c, 0x00, 0x12, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x11, 0x00, 0x19, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x13, 0x00, 0x19, 0x00,
+  0x21, 0x00, 0x27, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x07, 0x00, 0x0e, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x06, 0x00, 0x0c, 0x00, 0x12, 0x00, 0x18, 0x00, 0x1e, 0x00,
+  0x24, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x12, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x16, 0x00, 0x00, 0x00, 0x07, 0x00,
+  0x0e, 0x00, 0x14, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x23, 0x00,
+  0x29, 0x00, 0x2f, 0x00, 0x35, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x17, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x13, 0x00, 0x28, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x13, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x2f, 0x00,
+  0x3f, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1d, 0x00, 0x24, 0x00, 0x2b, 0x00,
+  0x00, 0x00, 0x17, 0x00, 0x1f, 0x00, 0x24, 0x00, 0x00, 0x00, 0x21, 0x00,
+  0x27, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x24, 0x00, 0x2b, 0x00,
+  0x32, 0x00, 0x00, 0x00, 0x17, 0x00, 0x1f, 0x00, 0x27, 0x00, 0x2f, 0x00,
+  0x38, 0x00, 0x41, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x37, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0c, 0x00,
+  0x13, 0x00, 0x00, 0x00, 0x08, 0x00, 0x0f, 0x00, 0x17, 0x00, 0x1f, 0x00,
+  0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0c, 0x00,
+  0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x09, 0x00, 0x12, 0x00, 0x19, 0x00,
+  0x00, 0x00, 0x07, 0x00, 0x0d, 0x00, 0x16, 0x00, 0x1f, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x11, 0x00, 0x17, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x07, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x07, 0x00,
+  0x0e, 0x00, 0x16, 0x00, 0x1e, 0x00, 0x26, 0x00, 0x2d, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x08, 0x00, 0x11, 0x00, 0x18, 0x00,
+  0x1f, 0x00, 0x27, 0x00, 0x00, 0x00, 0x07, 0x00, 0x0d, 0x00, 0x14, 0x00,
+  0x1b, 0x00, 0x22, 0x00, 0x2a, 0x00, 0x31, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x11, 0x00, 0x19, 0x00, 0x21, 0x00, 0x29, 0x00, 0x31, 0x00, 0x39, 0x00,
+  0x41, 0x00, 0x49, 0x00, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0c, 0x00, 0x12, 0x00,
+  0x18, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0f, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x10, 0x00, 0x18, 0x00, 0x1f, 0x00, 0x27, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x10, 0x00, 0x18, 0x00, 0x20, 0x00, 0x28, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x1e, 0x00, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x23, 0x00, 0x29, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x36, 0x00, 0x3c, 0x00,
+  0x43, 0x00, 0x50, 0x00, 0x00, 0x00, 0x27, 0x00, 0x2d, 0x00, 0x33, 0x00,
+  0x39, 0x00, 0x3f, 0x00, 0x45, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x23, 0x00, 0x2a, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x26, 0x00, 0x2f, 0x00, 0x35, 0x00,
+  0x3b, 0x00, 0x41, 0x00, 0x47, 0x00, 0x4d, 0x00, 0x00, 0x00, 0x07, 0x00,
+  0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x0e, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x10, 0x00, 0x18, 0x00, 0x20, 0x00, 0x28, 0x00, 0x30, 0x00,
+  0x38, 0x00, 0x40, 0x00, 0x47, 0x00, 0x00, 0x00, 0x06, 0x00, 0x1c, 0x00,
+  0x00, 0x00, 0x1b, 0x00, 0x22, 0x00, 0x2a, 0x00, 0x31, 0x00, 0x00, 0x00,
+  0x1b, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0c, 0x00, 0x13, 0x00, 0x1b, 0x00,
+  0x20, 0x00, 0x26, 0x00, 0x00, 0x00, 0x07, 0x00, 0x0e, 0x00, 0x15, 0x00,
+  0x19, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x08, 0x00, 0x10, 0x00, 0x18, 0x00,
+  0x20, 0x00, 0x28, 0x00, 0x30, 0x00, 0x38, 0x00, 0x40, 0x00, 0x48, 0x00,
+  0x50, 0x00, 0x58, 0x00, 0x60, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x15, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00,
+  0x0f, 0x00, 0x16, 0x00, 0x1d, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x08, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x10, 0x00, 0x18, 0x00, 0x20, 0x00,
+  0x28, 0x00, 0x30, 0x00, 0x38, 0x00, 0x40, 0x00, 0x00, 0x00, 0x06, 0x00,
+  0x0d, 0x00, 0x00, 0x00, 0x08, 0x00, 0x10, 0x00, 0x17, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x16, 0x00, 0x39, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x15, 0x00,
+  0x00, 0x00, 0x1b, 0x00, 0x21, 0x00, 0x29, 0x00, 0x34, 0x00, 0x00, 0x00,
+  0x17, 0x00, 0x34, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0c, 0x00,
+  0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x07, 0x00, 0x0e, 0x00, 0x14, 0x00,
+  0x1a, 0x00, 0x00, 0x00, 0x10, 0x00, 0x17, 0x00, 0x00, 0x00, 0x07, 0x00,
+  0x10, 0x00, 0x16, 0x00, 0x1f, 0x00, 0x26, 0x00, 0x00, 0x00, 0x16, 0x00,
+  0x1c, 0x00, 0x22, 0x00, 0x28, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x13, 0x00,
+  0x1a, 0x00, 0x21, 0x00, 0x28, 0x00, 0x2f, 0x00, 0x36, 0x00, 0x3d, 0x00,
+  0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x08, 0x00, 0x10, 0x00, 0x18, 0x00,
+  0x20, 0x00, 0x28, 0x00, 0x30, 0x00, 0x36, 0x00, 0x00, 0x00, 0x06, 0x00,
+  0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x24, 0x00, 0x34, 0x00,
+  0x44, 0x00, 0x55, 0x00, 0x67, 0x00, 0x7a, 0x00, 0x8c, 0x00, 0x9f, 0x00,
+  0xb1, 0x00, 0x00, 0x00, 0x10, 0x00, 0x21, 0x00, 0x32, 0x00, 0x40, 0x00,
+  0x4e, 0x00, 0x5d, 0x00, 0x6e, 0x00, 0x7e, 0x00, 0x8f, 0x00, 0x9f, 0x00,
+  0xb1, 0x00, 0xc1, 0x00, 0xd3, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0c, 0x00,
+  0x00, 0x00, 0x08, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00,
+  0x0d, 0x00, 0x14, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x00, 0x00, 0x0f, 0x00, 0x15, 0x00, 0x00, 0x00, 0x07, 0x00, 0x0e, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x26, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x06, 0x00,
+  0x0c, 0x00, 0x15, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x08, 0x00, 0x11, 0x00,
+  0x17, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x16, 0x00, 0x22, 0x00, 0x00, 0x00,
+  0x1a, 0x00, 0x24, 0x00, 0x31, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1d, 0x00,
+  0x25, 0x00, 0x00, 0x00, 0x14, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x15, 0x00,
+  0x1f, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x19, 0x00, 0x28, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x18, 0x00, 0x3a, 0x00, 0x41, 0x00, 0x48, 0x00, 0x4f, 0x00,
+  0x56, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x1f, 0x00, 0x2d, 0x00, 0x35, 0x00,
+  0x3d, 0x00, 0x46, 0x00, 0x00, 0x00, 0x18, 0x00, 0x21, 0x00, 0x27, 0x00,
+  0x00, 0x00, 0x15, 0x00, 0x28, 0x00, 0x31, 0x00, 0x00, 0x00, 0x07, 0x00,
+  0x0d, 0x00, 0x13, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x19, 0x00,
+  0x00, 0x00, 0x13, 0x00, 0x1a, 0x00, 0x20, 0x00, 0x27, 0x00, 0x00, 0x00,
+  0x2d, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x17, 0x00, 0x1e, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x24, 0x00, 0x2c, 0x00, 0x32, 0x00,
+  0x3a, 0x00, 0x41, 0x00, 0x48, 0x00, 0x4f, 0x00, 0x56, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x15, 0x00, 0x1d, 0x00, 0x25, 0x00, 0x2d, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x24, 0x00, 0x2c, 0x00, 0x34, 0x00, 0x00, 0x00, 0x18, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x22, 0x00, 0x2a, 0x00,
+  0x30, 0x00, 0x38, 0x00, 0x40, 0x00, 0x47, 0x00, 0x4f, 0x00, 0x56, 0x00,
+  0x00, 0x00, 0x18, 0x00, 0x2e, 0x00, 0x48, 0x00, 0x51, 0x00, 0x56, 0x00,
+  0x00, 0x00, 0x1c, 0x00, 0x29, 0x00, 0x00, 0x00, 0x11, 0x00, 0x20, 0x00,
+  0x27, 0x00, 0x2e, 0x00, 0x34, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x06, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x15, 0x00, 0x2d, 0x00,
+  0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x19, 0x00, 0x1f, 0x00, 0x25, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x22, 0x00,
+  0x3a, 0x00, 0x56, 0x00, 0x00, 0x00, 0x20, 0x00, 0x35, 0x00, 0x3b, 0x00,
+  0x41, 0x00, 0x47, 0x00, 0x4d, 0x00, 0x53, 0x00, 0x59, 0x00, 0x60, 0x00,
+  0x66, 0x00, 0x6c, 0x00, 0x72, 0x00, 0x78, 0x00, 0x7e, 0x00, 0x84, 0x00,
+  0x8a, 0x00, 0x90, 0x00, 0x96, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00,
+  0x16, 0x00, 0x1f, 0x00, 0x28, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x11, 0x00,
+  0x17, 0x00, 0x1f, 0x00, 0x25, 0x00, 0x2b, 0x00, 0x32, 0x00, 0x38, 0x00,
+  0x3e, 0x00, 0x00, 0x00, 0x11, 0x00, 0x1c, 0x00, 0x3d, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x22, 0x00, 0x2b, 0x00, 0x34, 0x00, 0x00, 0x00, 0x15, 0x00,
+  0x28, 0x00, 0x34, 0x00, 0x3a, 0x00, 0x40, 0x00, 0x46, 0x00, 0x4d, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x16, 0x00, 0x26, 0x00, 0x2c, 0x00, 0x00, 0x00,
+  0x27, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x07, 0x00, 0x0d, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x15, 0x00, 0x1c, 0x00, 0x23, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x27, 0x00, 0x30, 0x00, 0x39, 0x00,
+  0x42, 0x00, 0x00, 0x00, 0x13, 0x00, 0x1c, 0x00, 0x25, 0x00, 0x2e, 0x00,
+  0x37, 0x00, 0x40, 0x00, 0x49, 0x00, 0x52, 0x00, 0x5b, 0x00, 0x64, 0x00,
+  0x6d, 0x00, 0x76, 0x00, 0x7f, 0x00, 0x88, 0x00, 0x91, 0x00, 0x9a, 0x00,
+  0xa3, 0x00, 0xab, 0x00, 0xcc, 0x00, 0xd5, 0x00, 0x00, 0x00, 0x19, 0x00,
+  0x31, 0x00, 0x52, 0x00, 0x5c, 0x00, 0x65, 0x00, 0x6c, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x17, 0x00, 0x1d, 0x00, 0x24, 0x00, 0x28, 0x00, 0x2c, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x0d, 0x00,
+  0x16, 0x00, 0x00, 0x00, 0x13, 0x00, 0x1e, 0x00, 0x24, 0x00, 0x2d, 0x00,
+  0x00, 0x00, 0x0f, 0x00, 0x1e, 0x00, 0x26, 0x00, 0x2c, 0x00, 0x35, 0x00,
+  0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x08, 0x00, 0x10, 0x00,
+  0x18, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00,
+  0x0d, 0x00, 0x14, 0x00, 0x00, 0x00, 0x08, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x00, 0x0e, 0x00, 0x15, 0x00, 0x1c, 0x00, 0x23, 0x00,
+  0x2a, 0x00, 0x30, 0x00, 0x37, 0x00, 0x00, 0x00, 0x07, 0x00, 0x0e, 0x00,
+  0x14, 0x00, 0x1a, 0x00, 0x21, 0x00, 0x27, 0x00, 0x2d, 0x00, 0x36, 0x00,
+  0x00, 0x00, 0x1b, 0x00, 0x24, 0x00, 0x2a, 0x00, 0x3d, 0x00, 0x51, 0x00,
+  0x00, 0x00, 0x06, 0x00, 0x0e, 0x00, 0x15, 0x00, 0x00, 0x00, 0x13, 0x00,
+  0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x20, 0x00, 0x28, 0x00,
+  0x30, 0x00, 0x00, 0x00, 0x22, 0x00, 0x2a, 0x00, 0x32, 0x00, 0x39, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x19, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x14, 0x00, 0x1e, 0x00,
+  0x28, 0x00, 0x32, 0x00, 0x3c, 0x00, 0x46, 0x00, 0x50, 0x00, 0x5a, 0x00,
+  0x64, 0x00, 0x6e, 0x00, 0x78, 0x00, 0x82, 0x00, 0x00, 0x00, 0x0f, 0x00,
+  0x23, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x07, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x00, 0x00, 0x19, 0x00, 0x22, 0x00, 0x00, 0x00, 0x18, 0x00,
+  0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x14, 0x00,
+  0x29, 0x00, 0x3d, 0x00, 0x51, 0x00, 0x66, 0x00, 0x78, 0x00, 0x8a, 0x00,
+  0x9d, 0x00, 0xb1, 0x00, 0xc6, 0x00, 0xda, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x12, 0x00, 0x1b, 0x00, 0x24, 0x00, 0x2d, 0x00, 0x36, 0x00, 0x3f, 0x00,
+  0x46, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x09, 0x00, 0x12, 0x00, 0x1b, 0x00,
+  0x24, 0x00, 0x2d, 0x00, 0x35, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x1f, 0x00,
+  0x28, 0x00, 0x31, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 0x00,
+  0x0e, 0x00, 0x15, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0d, 0x00, 0x14, 0x00,
+  0x1b, 0x00, 0x21, 0x00, 0x00, 0x00, 0x07, 0x00, 0x0e, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x08, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00,
+  0x0e, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x35, 0x00, 0x3b, 0x00, 0x42, 0x00,
+  0x00, 0x00, 0x2d, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00,
+  0x15, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00,
+  0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x08, 0x00,
+  0x10, 0x00, 0x18, 0x00, 0x20, 0x00, 0x28, 0x00, 0x30, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x0e, 0x00, 0x17, 0x00,
+  0x1e, 0x00, 0x27, 0x00, 0x2e, 0x00, 0x34, 0x00, 0x3a, 0x00, 0x00, 0x00,
+  0x1b, 0x00, 0x21, 0x00, 0x29, 0x00, 0x31, 0x00, 0x38, 0x00, 0x40, 0x00,
+  0x48, 0x00, 0x4f, 0x00, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00,
+  0x0d, 0x00, 0x14, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x21, 0x00,
+  0x29, 0x00, 0x00, 0x00, 0x08, 0x00, 0x0e, 0x00, 0x15, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x08, 0x00, 0x10, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x24, 0x00,
+  0x2c, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1d, 0x00, 0x32, 0x00, 0x42, 0x00, 0x00, 0x00, 0x15, 0x00,
+  0x00, 0x00, 0x06, 0x00, 0x17, 0x00, 0x00, 0x00, 0x23, 0x00, 0x36, 0x00,
+  0x3d, 0x00, 0x44, 0x00, 0x4b, 0x00, 0x51, 0x00, 0x58, 0x00, 0x5f, 0x00,
+  0x66, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x1a, 0x00,
+  0x21, 0x00, 0x28, 0x00, 0x00, 0x00, 0x13, 0x00, 0x1b, 0x00, 0x23, 0x00,
+  0x2b, 0x00, 0x00, 0x00, 0x14, 0x00, 0x1b, 0x00, 0x22, 0x00, 0x29, 0x00,
+  0x30, 0x00, 0x37, 0x00, 0x3e, 0x00, 0x45, 0x00, 0x4c, 0x00, 0x53, 0x00,
+  0x5a, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x07, 0x00, 0x0e, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x07, 0x00, 0x0e, 0x00, 0x15, 0x00, 0x1d, 0x00,
+  0x24, 0x00, 0x2c, 0x00, 0x33, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x15, 0x00, 0x1d, 0x00, 0x25, 0x00, 0x2b, 0x00, 0x33, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x0f, 0x00, 0x18, 0x00, 0x1e, 0x00, 0x24, 0x00, 0x2a, 0x00,
+  0x00, 0x00, 0x07, 0x00, 0x0e, 0x00, 0x15, 0x00, 0x1c, 0x00, 0x24, 0x00,
+  0x2b, 0x00, 0x32, 0x00, 0x39, 0x00, 0x40, 0x00, 0x00, 0x00, 0x07, 0x00,
+  0x0e, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x18, 0x00, 0x1f, 0x00, 0x2a, 0x00,
+  0x35, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x31, 0x00,
+  0x3a, 0x00, 0x00, 0x00, 0x10, 0x00, 0x16, 0x00, 0x1c, 0x00, 0x22, 0x00,
+  0x28, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x10, 0x00,
+  0x18, 0x00, 0x1e, 0x00, 0x26, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x38, 0x00,
+  0x4b, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x51, 0x00,
+  0x65, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x27, 0x00, 0x38, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x08, 0x00, 0x10, 0x00,
+  0x18, 0x00, 0x20, 0x00, 0x28, 0x00, 0x30, 0x00, 0x38, 0x00, 0x40, 0x00,
+  0x48, 0x00, 0x50, 0x00, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00,
+  0x2c, 0x00, 0x45, 0x00, 0x4b, 0x00, 0x5e, 0x00, 0x00, 0x00, 0x0f, 0x00,
+  0x26, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x1b, 0x00, 0x21, 0x00,
+  0x27, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x1e, 0x00, 0x25, 0x00, 0x2c, 0x00,
+  0x33, 0x00, 0x3a, 0x00, 0x41, 0x00, 0x48, 0x00, 0x4f, 0x00, 0x56, 0x00,
+  0x5d, 0x00, 0x64, 0x00, 0x6b, 0x00, 0x72, 0x00, 0x79, 0x00, 0x80, 0x00,
+  0x00, 0x00, 0x1a, 0x00, 0x32, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x17, 0x00,
+  0x2f, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x26, 0x00,
+  0x2d, 0x00, 0x34, 0x00, 0x3b, 0x00, 0x42, 0x00, 0x49, 0x00, 0x50, 0x00,
+  0x56, 0x00, 0x5d, 0x00, 0x64, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x42, 0x00,
+  0x48, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x21, 0x00, 0x00, 0x00,
+  0x1e, 0x00, 0x25, 0x00, 0x2c, 0x00, 0x33, 0x00, 0x3a, 0x00, 0x41, 0x00,
+  0x47, 0x00, 0x4e, 0x00, 0x55, 0x00, 0x5c, 0x00, 0x63, 0x00, 0x00, 0x00,
+  0x16, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x12, 0x00, 0x1a, 0x00, 0x22, 0x00,
+  0x28, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x2b, 0x00, 0x32, 0x00, 0x39, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x15, 0x00, 0x1d, 0x00, 0x25, 0x00,
+  0x2d, 0x00, 0x35, 0x00, 0x3d, 0x00, 0x45, 0x00, 0x4d, 0x00, 0x55, 0x00,
+  0x5d, 0x00, 0x65, 0x00, 0x6d, 0x00, 0x75, 0x00, 0x7d, 0x00, 0x85, 0x00,
+  0x8c, 0x00, 0x93, 0x00, 0x9a, 0x00, 0xa1, 0x00, 0xa8, 0x00, 0xaf, 0x00,
+  0xb6, 0x00, 0xbd, 0x00, 0xc4, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x17, 0x00,
+  0x1e, 0x00, 0x25, 0x00, 0x33, 0x00, 0x00, 0x00, 0x19, 0x00, 0x30, 0x00,
+  0x45, 0x00, 0x68, 0x00, 0x90, 0x00, 0x98, 0x00, 0xa0, 0x00, 0xa6, 0x00,
+  0xaf, 0x00, 0xb8, 0x00, 0xc1, 0x00, 0xc9, 0x00, 0xd0, 0x00, 0x00, 0x00,
+  0x23, 0x00, 0x3d, 0x00, 0x4f, 0x00, 0x71, 0x00, 0x9c, 0x00, 0xa5, 0x00,
+  0xae, 0x00, 0xb5, 0x00, 0xbf, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x2c, 0x00,
+  0x43, 0x00, 0x66, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x17, 0x00, 0x31, 0x00,
+  0x46, 0x00, 0x52, 0x00, 0x59, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x2e, 0x00,
+  0x3b, 0x00, 0x7d, 0x00, 0xa2, 0x00, 0xab, 0x00, 0xb4, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x22, 0x00, 0x30, 0x00, 0x52, 0x00, 0x6d, 0x00, 0x73, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x3f, 0x00, 0x61, 0x00, 0xa4, 0x00,
+  0xd1, 0x00, 0xf3, 0x00, 0x0f, 0x01, 0x00, 0x00, 0x10, 0x00, 0x29, 0x00,
+  0x3a, 0x00, 0x49, 0x00, 0x7a, 0x00, 0x81, 0x00, 0x89, 0x00, 0x90, 0x00,
+  0x97, 0x00, 0x9f, 0x00, 0xa6, 0x00, 0xad, 0x00, 0xb4, 0x00, 0xbe, 0x00,
+  0xca, 0x00, 0x00, 0x00, 0x16, 0x00, 0x25, 0x00, 0x31, 0x00, 0x37, 0x00,
+  0x3f, 0x00, 0x4c, 0x00, 0x51, 0x00, 0x00, 0x00, 0x17, 0x00, 0x28, 0x00,
+  0x00, 0x00, 0x13, 0x00, 0x22, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x2f, 0x00,
+  0x41, 0x00, 0x4a, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x27, 0x00, 0x54, 0x00,
+  0x5b, 0x00, 0x65, 0x00, 0x00, 0x00, 0x16, 0x00, 0x2b, 0x00, 0x63, 0x00,
+  0x8e, 0x00, 0xa8, 0x00, 0xaf, 0x00, 0xb5, 0x00, 0x00, 0x00, 0x18, 0x00,
+  0x29, 0x00, 0x3e, 0x00, 0x46, 0x00, 0x4e, 0x00, 0x56, 0x00, 0x5e, 0x00,
+  0x66, 0x00, 0x6e, 0x00, 0x76, 0x00, 0x00, 0x00, 0x16, 0x00, 0x23, 0x00,
+  0x5a, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x27, 0x00, 0x38, 0x00, 0x49, 0x00,
+  0x58, 0x00, 0x5e, 0x00, 0x65, 0x00, 0x6c, 0x00, 0x71, 0x00, 0x00, 0x00,
+  0x19, 0x00, 0x2d, 0x00, 0x46, 0x00, 0x53, 0x00, 0x6e, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x22, 0x00, 0x2f, 0x00, 0x47, 0x00, 0x53, 0x00, 0x6d, 0x00,
+  0x76, 0x00, 0x83, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x38, 0x00, 0x4e, 0x00,
+  0x75, 0x00, 0x8f, 0x00, 0xa0, 0x00, 0xa6, 0x00, 0xad, 0x00, 0x00, 0x00,
+  0x15, 0x00, 0x24, 0x00, 0x39, 0x00, 0x4f, 0x00, 0x70, 0x00, 0x94, 0x00,
+  0x9b, 0x00, 0xa2, 0x00, 0xa9, 0x00, 0xb2, 0x00, 0xb9, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x20, 0x00, 0x2f, 0x00, 0x49, 0x00, 0x5d, 0x00, 0x74, 0x00,
+  0x7b, 0x00, 0x82, 0x00, 0x89, 0x00, 0x98, 0x00, 0x9d, 0x00, 0x00, 0x00,
+  0x1a, 0x00, 0x27, 0x00, 0x37, 0x00, 0x47, 0x00, 0x63, 0x00, 0x6b, 0x00,
+  0x79, 0x00, 0x00, 0x00, 0x16, 0x00, 0x24, 0x00, 0x3a, 0x00, 0x47, 0x00,
+  0x62, 0x00, 0x68, 0x00, 0x6f, 0x00, 0x75, 0x00, 0x7b, 0x00, 0x81, 0x00,
+  0x87, 0x00, 0x8d, 0x00, 0x94, 0x00, 0x9a, 0x00, 0xa0, 0x00, 0xb7, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x23, 0x00, 0x3a, 0x00, 0x46, 0x00, 0x5c, 0x00,
+  0x80, 0x00, 0x88, 0x00, 0x90, 0x00, 0x98, 0x00, 0xa0, 0x00, 0xa6, 0x00,
+  0xae, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x21, 0x00, 0x3c, 0x00, 0x49, 0x00,
+  0x75, 0x00, 0x7e, 0x00, 0x87, 0x00, 0x90, 0x00, 0x99, 0x00, 0xa0, 0x00,
+  0xa9, 0x00, 0xb0, 0x00, 0xb6, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x1e, 0x00,
+  0x2b, 0x00, 0x41, 0x00, 0x63, 0x00, 0x88, 0x00, 0x8e, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x22, 0x00, 0x39, 0x00, 0x46, 0x00, 0x5c, 0x00, 0x7f, 0x00,
+  0x00, 0x00, 0x2d, 0x00, 0x46, 0x00, 0x5e, 0x00, 0x73, 0x00, 0x8d, 0x00,
+  0x93, 0x00, 0x99, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x59, 0x00, 0x71, 0x00,
+  0x92, 0x00, 0xa8, 0x00, 0xc4, 0x00, 0xd4, 0x00, 0xd9, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x2a, 0x00, 0x44, 0x00, 0x5d, 0x00, 0x89, 0x00, 0x91, 0x00,
+  0x99, 0x00, 0xa1, 0x00, 0xa9, 0x00, 0xb1, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x1d, 0x00, 0x42, 0x00, 0x57, 0x00, 0x70, 0x00, 0x77, 0x00, 0x7e, 0x00,
+  0x85, 0x00, 0x8c, 0x00, 0x93, 0x00, 0x9f, 0x00, 0xb4, 0x00, 0x00, 0x00,
+  0x18, 0x00, 0x2a, 0x00, 0x41, 0x00, 0x4f, 0x00, 0x68, 0x00, 0x7f, 0x00,
+  0x91, 0x00, 0xb0, 0x00, 0xb7, 0x00, 0xbe, 0x00, 0xc4, 0x00, 0xd8, 0x00,
+  0xde, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x37, 0x00, 0x4a, 0x00, 0x57, 0x00,
+  0x66, 0x00, 0x74, 0x00, 0x96, 0x00, 0xaf, 0x00, 0xb8, 0x00, 0x00, 0x00,
+  0x2f, 0x00, 0x54, 0x00, 0x78, 0x00, 0x9b, 0x00, 0xbf, 0x00, 0xe3, 0x00,
+  0x07, 0x01, 0x1d, 0x01, 0x2c, 0x01, 0x3a, 0x01, 0x46, 0x01, 0x53, 0x01,
+  0x6a, 0x01, 0x87, 0x01, 0x96, 0x01, 0x00, 0x00, 0x15, 0x00, 0x39, 0x00,
+  0x47, 0x00, 0x5b, 0x00, 0x72, 0x00, 0x89, 0x00, 0xa1, 0x00, 0xb1, 0x00,
+  0xb8, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x4c, 0x00, 0x6c, 0x00, 0x8b, 0x00,
+  0xab, 0x00, 0xcb, 0x00, 0xeb, 0x00, 0xfa, 0x00, 0x17, 0x01, 0x29, 0x01,
+  0x38, 0x01, 0x50, 0x01, 0x5c, 0x01, 0x85, 0x01, 0x00, 0x00, 0x32, 0x00,
+  0x41, 0x00, 0x62, 0x00, 0x79, 0x00, 0x85, 0x00, 0x9c, 0x00, 0xae, 0x00,
+  0xbd, 0x00, 0xcc, 0x00, 0xd4, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1e, 0x00,
+  0x2d, 0x00, 0x3c, 0x00, 0x50, 0x00, 0x60, 0x00, 0x7c, 0x00, 0x00, 0x00,
+  0x2e, 0x00, 0x47, 0x00, 0x61, 0x00, 0x71, 0x00, 0x7d, 0x00, 0x8c, 0x00,
+  0xa2, 0x00, 0xc4, 0x00, 0xd2, 0x00, 0xd9, 0x00, 0x00, 0x00, 0x16, 0x00,
+  0x2d, 0x00, 0x3d, 0x00, 0x4e, 0x00, 0x6d, 0x00, 0x86, 0x00, 0x95, 0x00,
+  0x00, 0x00, 0x19, 0x00, 0x28, 0x00, 0x38, 0x00, 0x50, 0x00, 0x62, 0x00,
+  0x73, 0x00, 0x80, 0x00, 0x86, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x22, 0x00,
+  0x2d, 0x00, 0x38, 0x00, 0x44, 0x00, 0x5b, 0x00, 0x63, 0x00, 0x6b, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x1c, 0x00, 0x28, 0x00, 0x3d, 0x00, 0x56, 0x00,
+  0x6c, 0x00, 0x83, 0x00, 0x00, 0x00, 0x27, 0x00, 0x36, 0x00, 0x42, 0x00,
+  0x4e, 0x00, 0x64, 0x00, 0x70, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x12, 0x00,
+  0x22, 0x00, 0x36, 0x00, 0x4c, 0x00, 0x62, 0x00, 0x78, 0x00, 0x87, 0x00,
+  0x8d, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1c, 0x00, 0x2b, 0x00, 0x42, 0x00,
+  0x59, 0x00, 0x79, 0x00, 0x00, 0x00, 0x11, 0x00, 0x21, 0x00, 0x2e, 0x00,
+  0x3d, 0x00, 0x59, 0x00, 0x68, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x39, 0x00,
+  0x4a, 0x00, 0x57, 0x00, 0x66, 0x00, 0x75, 0x00, 0x83, 0x00, 0x98, 0x00,
+  0x9e, 0x00, 0xa3, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x48, 0x00, 0x59, 0x00,
+  0x6e, 0x00, 0xa5, 0x00, 0xc9, 0x00, 0xdf, 0x00, 0xee, 0x00, 0xf4, 0x00,
+  0xfb, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x49, 0x00, 0x60, 0x00, 0x73, 0x00,
+  0x8a, 0x00, 0x9b, 0x00, 0xb2, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x26, 0x00,
+  0x45, 0x00, 0x5a, 0x00, 0x69, 0x00, 0x7e, 0x00, 0x95, 0x00, 0xa3, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x2f, 0x00, 0x4e, 0x00, 0x66, 0x00, 0x77, 0x00,
+  0x83, 0x00, 0xa3, 0x00, 0xaf, 0x00, 0xb6, 0x00, 0xbd, 0x00, 0xc4, 0x00,
+  0xcd, 0x00, 0xd4, 0x00, 0xda, 0x00, 0xe1, 0x00, 0x00, 0x00, 0x1b, 0x00,
+  0x28, 0x00, 0x3e, 0x00, 0x6b, 0x00, 0x7a, 0x00, 0x91, 0x00, 0xa1, 0x00,
+  0xa9, 0x00, 0xb1, 0x00, 0xb7, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x53, 0x00,
+  0x60, 0x00, 0x76, 0x00, 0xab, 0x00, 0xbd, 0x00, 0xdc, 0x00, 0xf9, 0x00,
+  0x02, 0x01, 0x08, 0x01, 0x00, 0x00, 0x10, 0x00, 0x31, 0x00, 0x40, 0x00,
+  0x51, 0x00, 0x7f, 0x00, 0x9b, 0x00, 0xb4, 0x00, 0xc0, 0x00, 0xc6, 0x00,
+  0xce, 0x00, 0xd5, 0x00, 0x00, 0x00, 0x11, 0x00, 0x22, 0x00, 0x36, 0x00,
+  0x4d, 0x00, 0x63, 0x00, 0x7a, 0x00, 0x80, 0x00, 0x00, 0x00, 0x0d, 0x00,
+  0x28, 0x00, 0x3c, 0x00, 0x4e, 0x00, 0x62, 0x00, 0x6f, 0x00, 0x82, 0x00,
+  0x88, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x27, 0x00, 0x45, 0x00, 0x53, 0x00,
+  0x60, 0x00, 0x77, 0x00, 0x8b, 0x00, 0x91, 0x00, 0x99, 0x00, 0xa1, 0x00,
+  0xa8, 0x00, 0xb0, 0x00, 0xb8, 0x00, 0xbe, 0x00, 0xc4, 0x00, 0xca, 0x00,
+  0xd0, 0x00, 0xd8, 0x00, 0x00, 0x00, 0x17, 0x00, 0x29, 0x00, 0x3f, 0x00,
+  0x52, 0x00, 0x62, 0x00, 0x00, 0x00, 0x19, 0x00, 0x33, 0x00, 0x44, 0x00,
+  0x55, 0x00, 0x66, 0x00, 0x79, 0x00, 0x00, 0x00, 0x19, 0x00, 0x2b, 0x00,
+  0x3e, 0x00, 0x4a, 0x00, 0x67, 0x00, 0x7b, 0x00, 0x89, 0x00, 0x90, 0x00,
+  0x97, 0x00, 0x00, 0x00, 0x26, 0x00, 0x3b, 0x00, 0x55, 0x00, 0x64, 0x00,
+  0x78, 0x00, 0x85, 0x00, 0x92, 0x00, 0x98, 0x00, 0x9e, 0x00, 0xa6, 0x00,
+  0xae, 0x00, 0xb6, 0x00, 0xbe, 0x00, 0xc5, 0x00, 0x00, 0x00, 0x2f, 0x00,
+  0x4b, 0x00, 0x5f, 0x00, 0x6f, 0x00, 0x80, 0x00, 0x8e, 0x00, 0xa5, 0x00,
+  0xbc, 0x00, 0xc2, 0x00, 0xc9, 0x00, 0xcf, 0x00, 0xd6, 0x00, 0xdd, 0x00,
+  0xe3, 0x00, 0xe9, 0x00, 0xef, 0x00, 0xf6, 0x00, 0xfd, 0x00, 0x00, 0x00,
+  0x31, 0x00, 0x46, 0x00, 0x61, 0x00, 0x9a, 0x00, 0xaf, 0x00, 0xbd, 0x00,
+  0xd1, 0x00, 0xda, 0x00, 0xea, 0x00, 0xfa, 0x00, 0x08, 0x01, 0x16, 0x01,
+  0x25, 0x01, 0x35, 0x01, 0x46, 0x01, 0x56, 0x01, 0x68, 0x01, 0x78, 0x01,
+  0x8a, 0x01, 0x00, 0x00, 0x15, 0x00, 0x2d, 0x00, 0x67, 0x00, 0x74, 0x00,
+  0x80, 0x00, 0xa2, 0x00, 0xa8, 0x00, 0xba, 0x00, 0xcc, 0x00, 0xdc, 0x00,
+  0xec, 0x00, 0xfd, 0x00, 0x0f, 0x01, 0x22, 0x01, 0x34, 0x01, 0x47, 0x01,
+  0x59, 0x01, 0x66, 0x01, 0x6c, 0x01, 0x75, 0x01, 0x00, 0x00, 0x30, 0x00,
+  0x54, 0x00, 0x82, 0x00, 0xac, 0x00, 0xe1, 0x00, 0x16, 0x01, 0x43, 0x01,
+  0x6c, 0x01, 0x92, 0x01, 0xa7, 0x01, 0xbb, 0x01, 0xe0, 0x01, 0xfd, 0x01,
+  0x13, 0x02, 0x28, 0x02, 0x3f, 0x02, 0x46, 0x02, 0x00, 0x00, 0x15, 0x00,
+  0x22, 0x00, 0x3f, 0x00, 0x50, 0x00, 0x5b, 0x00, 0x6e, 0x00, 0x74, 0x00,
+  0x7a, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x4c, 0x00, 0x75, 0x00, 0x9b, 0x00,
+  0xcc, 0x00, 0xfd, 0x00, 0x26, 0x01, 0x4b, 0x01, 0x6d, 0x01, 0x84, 0x01,
+  0x98, 0x01, 0xa9, 0x01, 0xc2, 0x01, 0xd5, 0x01, 0xee, 0x01, 0x00, 0x02,
+  0x09, 0x02, 0x12, 0x02, 0x1b, 0x02, 0x24, 0x02, 0x2d, 0x02, 0x36, 0x02,
+  0x3c, 0x02, 0x00, 0x00, 0x1b, 0x00, 0x2f, 0x00, 0x3d, 0x00, 0x55, 0x00,
+  0x63, 0x00, 0x84, 0x00, 0x99, 0x00, 0x00, 0x00, 0x14, 0x00, 0x23, 0x00,
+  0x5a, 0x00, 0x6b, 0x00, 0x7b, 0x00, 0x00, 0x00, 0x14, 0x00, 0x31, 0x00,
+  0x67, 0x00, 0x76, 0x00, 0x86, 0x00, 0x9b, 0x00, 0xa4, 0x00, 0xab, 0x00,
+  0xb2, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x32, 0x00, 0x58, 0x00, 0x69, 0x00,
+  0x7e, 0x00, 0xa5, 0x00, 0xb7, 0x00, 0xc6, 0x00, 0x00, 0x00, 0x1a, 0x00,
+  0x2e, 0x00, 0x3d, 0x00, 0x4c, 0x00, 0x62, 0x00, 0x7a, 0x00, 0x96, 0x00,
+  0xa6, 0x00, 0xaf, 0x00, 0xb8, 0x00, 0x00, 0x00, 0x14, 0x00, 0x39, 0x00,
+  0x45, 0x00, 0x65, 0x00, 0x83, 0x00, 0x90, 0x00, 0x9e, 0x00, 0xa4, 0x00,
+  0xaa, 0x00, 0x00, 0x00, 0x14, 0x00, 0x3c, 0x00, 0x56, 0x00, 0x6e, 0x00,
+  0x8c, 0x00, 0x99, 0x00, 0x00, 0x00, 0x14, 0x00, 0x32, 0x00, 0x40, 0x00,
+  0x57, 0x00, 0x68, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x39, 0x00,
+  0x47, 0x00, 0x61, 0x00, 0x74, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x18, 0x00,
+  0x2c, 0x00, 0x47, 0x00, 0x60, 0x00, 0x77, 0x00, 0x92, 0x00, 0xa0, 0x00,
+  0xb1, 0x00, 0xb9, 0x00, 0xc1, 0x00, 0xc9, 0x00, 0xd1, 0x00, 0xd9, 0x00,
+  0x00, 0x00, 0x14, 0x00, 0x31, 0x00, 0x4b, 0x00, 0x66, 0x00, 0x7d, 0x00,
+  0x91, 0x00, 0x00, 0x00, 0x20, 0x00, 0x4f, 0x00, 0x5e, 0x00, 0x6b, 0x00,
+  0x82, 0x00, 0x00, 0x00, 0x26, 0x00, 0x46, 0x00, 0x53, 0x00, 0x64, 0x00,
+  0x7f, 0x00, 0x85, 0x00, 0x8b, 0x00, 0x91, 0x00, 0x00, 0x00, 0x22, 0x00,
+  0x5d, 0x00, 0x86, 0x00, 0x9a, 0x00, 0xaf, 0x00, 0x00, 0x00, 0x22, 0x00,
+  0x46, 0x00, 0x66, 0x00, 0x91, 0x00, 0xc1, 0x00, 0xdc, 0x00, 0x00, 0x00,
+  0x17, 0x00, 0x3e, 0x00, 0x4d, 0x00, 0x66, 0x00, 0x7e, 0x00, 0x93, 0x00,
+  0x9b, 0x00, 0xa3, 0x00, 0xab, 0x00, 0x00, 0x00, 0x17, 0x00, 0x4b, 0x00,
+  0x63, 0x00, 0x7b, 0x00, 0x8a, 0x00, 0x9e, 0x00, 0xa4, 0x00, 0xaa, 0x00,
+  0xb0, 0x00, 0xb6, 0x00, 0x00, 0x00, 0x19, 0x00, 0x5d, 0x00, 0x78, 0x00,
+  0x8f, 0x00, 0x9d, 0x00, 0xb6, 0x00, 0xcc, 0x00, 0xd3, 0x00, 0xd9, 0x00,
+  0xdf, 0x00, 0x00, 0x00, 0x23, 0x00, 0x3b, 0x00, 0x81, 0x00, 0x8f, 0x00,
+  0xb2, 0x00, 0xc6, 0x00, 0xda, 0x00, 0xe1, 0x00, 0x00, 0x00, 0x18, 0x00,
+  0x34, 0x00, 0x4a, 0x00, 0x5e, 0x00, 0x7d, 0x00, 0x92, 0x00, 0xa8, 0x00,
+  0xc4, 0x00, 0xcc, 0x00, 0xe4, 0x00, 0xfb, 0x00, 0x00, 0x00, 0x22, 0x00,
+  0x37, 0x00, 0x45, 0x00, 0x59, 0x00, 0x78, 0x00, 0xa0, 0x00, 0xb7, 0x00,
+  0xcb, 0x00, 0xd2, 0x00, 0xda, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x36, 0x00,
+  0x4a, 0x00, 0x62, 0x00, 0x7c, 0x00, 0x8b, 0x00, 0xa1, 0x00, 0xa7, 0x00,
+  0xad, 0x00, 0xb3, 0x00, 0xb9, 0x00, 0xbf, 0x00, 0xc5, 0x00, 0xcc, 0x00,
+  0x00, 0x00, 0x19, 0x00, 0x2d, 0x00, 0x45, 0x00, 0x53, 0x00, 0x72, 0x00,
+  0x86, 0x00, 0x00, 0x00, 0x18, 0x00, 0x2d, 0x00, 0x40, 0x00, 0x5c, 0x00,
+  0x70, 0x00, 0x82, 0x00, 0x8b, 0x00, 0x94, 0x00, 0x00, 0x00, 0x21, 0x00,
+  0x36, 0x00, 0x65, 0x00, 0x7b, 0x00, 0x8f, 0x00, 0xa2, 0x00, 0xab, 0x00,
+  0x00, 0x00, 0x22, 0x00, 0x30, 0x00, 0x45, 0x00, 0x64, 0x00, 0x97, 0x00,
+  0xab, 0x00, 0xbd, 0x00, 0xc3, 0x00, 0xc9, 0x00, 0xcf, 0x00, 0xd5, 0x00,
+  0xdb, 0x00, 0xe1, 0x00, 0xe7, 0x00, 0xed, 0x00, 0x00, 0x00, 0x23, 0x00,
+  0x32, 0x00, 0x46, 0x00, 0x66, 0x00, 0x8c, 0x00, 0x99, 0x00, 0x00, 0x00,
+  0x16, 0x00, 0x2c, 0x00, 0x5d, 0x00, 0x7f, 0x00, 0x87, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x2d, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x12, 0x00, 0x2a, 0x00,
+  0x3b, 0x00, 0x59, 0x00, 0x5f, 0x00, 0x65, 0x00, 0x00, 0x00, 0x0f, 0x00,
+  0x26, 0x00, 0x3f, 0x00, 0x51, 0x00, 0x83, 0x00, 0x8c, 0x00, 0x95, 0x00,
+  0x9e, 0x00, 0xa7, 0x00, 0xb0, 0x00, 0xb9, 0x00, 0xc2, 0x00, 0xcb, 0x00,
+  0xd4, 0x00, 0xdd, 0x00, 0xe6, 0x00, 0xef, 0x00, 0xf8, 0x00, 0x01, 0x01,
+  0x00, 0x00, 0x10, 0x00, 0x1d, 0x00, 0x35, 0x00, 0x58, 0x00, 0x74, 0x00,
+  0x7d, 0x00, 0x86, 0x00, 0x8f, 0x00, 0x98, 0x00, 0xa1, 0x00, 0xaa, 0x00,
+  0xb3, 0x00, 0xbc, 0x00, 0xc5, 0x00, 0xce, 0x00, 0xd7, 0x00, 0x00, 0x00,
+  0x1a, 0x00, 0x29, 0x00, 0x43, 0x00, 0x63, 0x00, 0x6c, 0x00, 0x00, 0x00,
+  0x17, 0x00, 0x45, 0x00, 0x62, 0x00, 0x72, 0x00, 0x8a, 0x00, 0x90, 0x00,
+  0x96, 0x00, 0x00, 0x00, 0x18, 0x00, 0x2e, 0x00, 0x46, 0x00, 0x5a, 0x00,
+  0x70, 0x00, 0x00, 0x00, 0x16, 0x00, 0x47, 0x00, 0x5f, 0x00, 0x6d, 0x00,
+  0x7d, 0x00, 0x8b, 0x00, 0x92, 0x00, 0x9a, 0x00, 0x00, 0x00, 0x1c, 0x00,
+  0x4f, 0x00, 0x65, 0x00, 0x72, 0x00, 0x7b, 0x00, 0x00, 0x00, 0x0d, 0x00,
+  0x2b, 0x00, 0x3a, 0x00, 0x54, 0x00, 0x7a, 0x00, 0x81, 0x00, 0x88, 0x00,
+  0x91, 0x00, 0x9f, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x43, 0x00, 0x5a, 0x00,
+  0x69, 0x00, 0x87, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x2a, 0x00, 0x54, 0x00,
+  0x69, 0x00, 0x72, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x56, 0x00, 0x6f, 0x00,
+  0x00, 0x00, 0x1d, 0x00, 0x55, 0x00, 0x65, 0x00, 0x75, 0x00, 0x8d, 0x00,
+  0x94, 0x00, 0x00, 0x00, 0x17, 0x00, 0x33, 0x00, 0x5f, 0x00, 0x70, 0x00,
+  0x7e, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x2f, 0x00, 0x43, 0x00, 0x4b, 0x00,
+  0x54, 0x00, 0x5d, 0x00, 0x66, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x34, 0x00,
+  0x48, 0x00, 0x59, 0x00, 0x5f, 0x00, 0x65, 0x00, 0x6b, 0x00, 0x71, 0x00,
+  0x78, 0x00, 0x7e, 0x00, 0x84, 0x00, 0x00, 0x00, 0x20, 0x00, 0x39, 0x00,
+  0x50, 0x00, 0x00, 0x00, 0x24, 0x00, 0x33, 0x00, 0x4b, 0x00, 0x53, 0x00,
+  0x5c, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x77, 0x00, 0x80, 0x00, 0x89, 0x00,
+  0x90, 0x00, 0x00, 0x00, 0x11, 0x00, 0x29, 0x00, 0x35, 0x00, 0x00, 0x00,
+  0x22, 0x00, 0x4e, 0x00, 0x62, 0x00, 0x6b, 0x00, 0x00, 0x00, 0x39, 0x00,
+  0x4a, 0x00, 0x6d, 0x00, 0x85, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x5f, 0x00,
+  0x78, 0x00, 0x8b, 0x00, 0x93, 0x00, 0x9a, 0x00, 0x00, 0x00, 0x18, 0x00,
+  0x3a, 0x00, 0x59, 0x00, 0x86, 0x00, 0x8e, 0x00, 0x9a, 0x00, 0x00, 0x00,
+  0x17, 0x00, 0x26, 0x00, 0x54, 0x00, 0x82, 0x00, 0x88, 0x00, 0x8e, 0x00,
+  0x94, 0x00, 0x9a, 0x00, 0x00, 0x00, 0x12, 0x00, 0x20, 0x00, 0x4f, 0x00,
+  0x6b, 0x00, 0x72, 0x00, 0x78, 0x00, 0x7e, 0x00, 0x85, 0x00, 0x8b, 0x00,
+  0x95, 0x00, 0x00, 0x00, 0x16, 0x00, 0x2b, 0x00, 0x40, 0x00, 0x64, 0x00,
+  0x74, 0x00, 0x94, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x35, 0x00,
+  0x3e, 0x00, 0x47, 0x00, 0x00, 0x00, 0x11, 0x00, 0x2b, 0x00, 0x31, 0x00,
+  0x00, 0x00, 0x20, 0x00, 0x58, 0x00, 0x73, 0x00, 0x79, 0x00, 0x7f, 0x00,
+  0x85, 0x00, 0x8b, 0x00, 0x91, 0x00, 0x97, 0x00, 0x00, 0x00, 0x0f, 0x00,
+  0x44, 0x00, 0x60, 0x00, 0x00, 0x00, 0x16, 0x00, 0x39, 0x00, 0x54, 0x00,
+  0x5d, 0x00, 0x66, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x26, 0x00, 0x2e, 0x00,
+  0x40, 0x00, 0x45, 0x00, 0x00, 0x00, 0x15, 0x00, 0x29, 0x00, 0x4c, 0x00,
+  0x00, 0x00, 0x1c, 0x00, 0x44, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x15, 0x00,
+  0x34, 0x00, 0x00, 0x00, 0x24, 0x00, 0x39, 0x00, 0x00, 0x00, 0x24, 0x00,
+  0x3e, 0x00, 0x44, 0x00, 0x00, 0x00, 0x18, 0x00, 0x2e, 0x00, 0x44, 0x00,
+  0x4c, 0x00, 0x00, 0x00, 0x12, 0x00, 0x2f, 0x00, 0x46, 0x00, 0x4e, 0x00,
+  0x54, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x2f, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x23, 0x00, 0x00, 0x00, 0x15, 0x00, 0x2a, 0x00, 0x3f, 0x00,
+  0x54, 0x00, 0x69, 0x00, 0x7e, 0x00, 0x93, 0x00, 0xa8, 0x00, 0xbd, 0x00,
+  0xd2, 0x00, 0xf4, 0x00, 0x0f, 0x01, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00,
+  0x15, 0x00, 0x00, 0x00, 0x12, 0x00, 0x2c, 0x00, 0x4d, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x24, 0x00, 0x3c, 0x00, 0x53, 0x00, 0x00, 0x00, 0x1d, 0x00,
+  0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x36, 0x00, 0x55, 0x00,
+  0x5b, 0x00, 0x61, 0x00, 0x68, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x18, 0x00,
+  0x2a, 0x00, 0x33, 0x00, 0x3c, 0x00, 0x45, 0x00, 0x4e, 0x00, 0x57, 0x00,
+  0x00, 0x00, 0x1c, 0x00, 0x25, 0x00, 0x2e, 0x00, 0x37, 0x00, 0x40, 0x00,
+  0x47, 0x00, 0x4d, 0x00, 0x53, 0x00, 0x57, 0x00, 0x00, 0x00, 0x14, 0x00,
+  0x1c, 0x00, 0x24, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x18, 0x00,
+  0x1f, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x27, 0x00, 0x5d, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x3d, 0x00, 0x43, 0x00, 0x49, 0x00, 0x00, 0x00, 0x19, 0x00,
+  0x37, 0x00, 0x00, 0x00, 0x10, 0x00, 0x27, 0x00, 0x60, 0x00, 0x67, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x25, 0x00, 0x3b, 0x00, 0x42, 0x00, 0x49, 0x00,
+  0x4f, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x2a, 0x00, 0x3f, 0x00,
+  0x47, 0x00, 0x4f, 0x00, 0x57, 0x00, 0x5f, 0x00, 0x65, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x23, 0x00, 0x5b, 0x00, 0x64, 0x00, 0x6a, 0x00, 0x73, 0x00,
+  0x7c, 0x00, 0x83, 0x00, 0x00, 0x00, 0x11, 0x00, 0x21, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x06, 0x00, 0x16, 0x00, 0x27, 0x00, 0x37, 0x00,
+  0x47, 0x00, 0x55, 0x00, 0x63, 0x00, 0x72, 0x00, 0x82, 0x00, 0x93, 0x00,
+  0xa3, 0x00, 0xb5, 0x00, 0x00, 0x00, 0x09, 0x00, 0x12, 0x00, 0x18, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x1c, 0x00, 0x22, 0x00,
+  0x28, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x20, 0x00, 0x36, 0x00,
+  0x3c, 0x00, 0x42, 0x00, 0x48, 0x00, 0x00, 0x00, 0x19, 0x00, 0x2f, 0x00,
+  0x00, 0x00, 0x19, 0x00, 0x2e, 0x00, 0x43, 0x00, 0x58, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x1b, 0x00,
+  0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x2d, 0x00, 0x00, 0x00,
+  0x1b, 0x00, 0x21, 0x00, 0x27, 0x00, 0x2d, 0x00, 0x33, 0x00, 0x47, 0x00,
+  0x5c, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x21, 0x00, 0x28, 0x00, 0x2f, 0x00,
+  0x00, 0x00, 0x0f, 0x00, 0x15, 0x00, 0x1b, 0x00, 0x21, 0x00, 0x27, 0x00,
+  0x2d, 0x00, 0x33, 0x00, 0x39, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x2b, 0x00,
+  0x31, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0c, 0x00, 0x13, 0x00, 0x1a, 0x00,
+  0x20, 0x00, 0x26, 0x00, 0x00, 0x00, 0x19, 0x00, 0x3d, 0x00, 0x58, 0x00,
+  0x5f, 0x00, 0x67, 0x00, 0x6d, 0x00, 0x78, 0x00, 0x00, 0x00, 0x1d, 0x00,
+  0x3b, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x4a, 0x00, 0x6b, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x35, 0x00, 0x43, 0x00, 0x4a, 0x00, 0x51, 0x00, 0x57, 0x00,
+  0x5d, 0x00, 0x63, 0x00, 0x69, 0x00, 0x6f, 0x00, 0x89, 0x00, 0x00, 0x00,
+  0x24, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x17, 0x00, 0x33, 0x00, 0x4e, 0x00,
+  0x55, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x15, 0x00, 0x1c, 0x00, 0x23, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x54, 0x00,
+  0x63, 0x00, 0x6a, 0x00, 0x70, 0x00, 0x00, 0x00, 0x15, 0x00, 0x4a, 0x00,
+  0x62, 0x00, 0x6f, 0x00, 0x85, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x5b, 0x00,
+  0x75, 0x00, 0x8e, 0x00, 0x9b, 0x00, 0xb6, 0x00, 0xbe, 0x00, 0x00, 0x00,
+  0x19, 0x00, 0x33, 0x00, 0x45, 0x00, 0x51, 0x00, 0x76, 0x00, 0x7f, 0x00,
+  0x88, 0x00, 0x91, 0x00, 0x9a, 0x00, 0xa3, 0x00, 0xac, 0x00, 0xb5, 0x00,
+  0xbe, 0x00, 0xc7, 0x00, 0xd0, 0x00, 0xd9, 0x00, 0xe2, 0x00, 0xeb, 0x00,
+  0xf4, 0x00, 0xfd, 0x00, 0x06, 0x01, 0x0f, 0x01, 0x18, 0x01, 0x21, 0x01,
+  0x2a, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x23, 0x00, 0x00, 0x00, 0x26, 0x00,
+  0x37, 0x00, 0x46, 0x00, 0x68, 0x00, 0x00, 0x00, 0x17, 0x00, 0x25, 0x00,
+  0x37, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1f, 0x00, 0x00, 0x00,
+  0x1a, 0x00, 0x31, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x1b, 0x00, 0x21, 0x00, 0x27, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x2b, 0x00,
+  0x3a, 0x00, 0x00, 0x00, 0x24, 0x00, 0x39, 0x00, 0x48, 0x00, 0x50, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x2a, 0x00, 0x30, 0x00,
+  0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x1b, 0x00, 0x34, 0x00, 0x00, 0x00, 0x19, 0x00, 0x29, 0x00, 0x38, 0x00,
+  0x47, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x1f, 0x00, 0x36, 0x00, 0x4a, 0x00,
+  0x51, 0x00, 0x58, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x16, 0x00, 0x34, 0x00,
+  0x44, 0x00, 0x52, 0x00, 0x77, 0x00, 0x7d, 0x00, 0x00, 0x00, 0x1b, 0x00,
+  0x29, 0x00, 0x3b, 0x00, 0x4a, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x3f, 0x00,
+  0x4c, 0x00, 0x59, 0x00, 0x78, 0x00, 0xa0, 0x00, 0xa6, 0x00, 0x00, 0x00,
+  0x1d, 0x00, 0x35, 0x00, 0x52, 0x00, 0x5d, 0x00, 0x6d, 0x00, 0x7a, 0x00,
+  0x8f, 0x00, 0x96, 0x00, 0x9d, 0x00, 0xa4, 0x00, 0xae, 0x00, 0x00, 0x00,
+  0x2a, 0x00, 0x45, 0x00, 0x64, 0x00, 0x7c, 0x00, 0x8a, 0x00, 0x96, 0x00,
+  0xb2, 0x00, 0xcf, 0x00, 0xd7, 0x00, 0xdf, 0x00, 0xe7, 0x00, 0xef, 0x00,
+  0xf7, 0x00, 0xff, 0x00, 0x07, 0x01, 0x0f, 0x01, 0x17, 0x01, 0x1f, 0x01,
+  0x00, 0x00, 0x23, 0x00, 0x54, 0x00, 0x6c, 0x00, 0x79, 0x00, 0x91, 0x00,
+  0x00, 0x00, 0x1b, 0x00, 0x34, 0x00, 0x4d, 0x00, 0x5c, 0x00, 0x6f, 0x00,
+  0x80, 0x00, 0xa1, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x4a, 0x00,
+  0x5a, 0x00, 0x66, 0x00, 0x7f, 0x00, 0xab, 0x00, 0xb2, 0x00, 0xb9, 0x00,
+  0xc0, 0x00, 0xd3, 0x00, 0x00, 0x00, 0x18, 0x00, 0x39, 0x00, 0x51, 0x00,
+  0x5e, 0x00, 0x79, 0x00, 0x8c, 0x00, 0x93, 0x00, 0x9a, 0x00, 0xa1, 0x00,
+  0xa7, 0x00, 0xae, 0x00, 0xb5, 0x00, 0xbc, 0x00, 0xc3, 0x00, 0x00, 0x00,
+  0x1b, 0x00, 0x37, 0x00, 0x50, 0x00, 0x6c, 0x00, 0x8a, 0x00, 0x9c, 0x00,
+  0xaa, 0x00, 0xc2, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x41, 0x00, 0x65, 0x00,
+  0x8e, 0x00, 0xa0, 0x00, 0xaf, 0x00, 0xc9, 0x00, 0xd0, 0x00, 0x00, 0x00,
+  0x19, 0x00, 0x35, 0x00, 0x52, 0x00, 0x6c, 0x00, 0x79, 0x00, 0x86, 0x00,
+  0x9c, 0x00, 0xa2, 0x00, 0xa9, 0x00, 0xb2, 0x00, 0xc1, 0x00, 0x00, 0x00,
+  0x1b, 0x00, 0x38, 0x00, 0x53, 0x00, 0x69, 0x00, 0x77, 0x00, 0x93, 0x00,
+  0xb6, 0x00, 0xbd, 0x00, 0xc4, 0x00, 0xcb, 0x00, 0xd2, 0x00, 0xf2, 0x00,
+  0x00, 0x00, 0x1c, 0x00, 0x37, 0x00, 0x50, 0x00, 0x68, 0x00, 0x80, 0x00,
+  0x00, 0x00, 0x2a, 0x00, 0x43, 0x00, 0x5e, 0x00, 0x78, 0x00, 0x89, 0x00,
+  0x9a, 0x00, 0xb3, 0x00, 0xd1, 0x00, 0xda, 0x00, 0xe3, 0x00, 0xf4, 0x00,
+  0x00, 0x00, 0x1d, 0x00, 0x35, 0x00, 0x4f, 0x00, 0x5d, 0x00, 0x77, 0x00,
+  0x80, 0x00, 0x86, 0x00, 0x8f, 0x00, 0x98, 0x00, 0x00, 0x00, 0x27, 0x00,
+  0x3f, 0x00, 0x5d, 0x00, 0x6c, 0x00, 0x7b, 0x00, 0x94, 0x00, 0x9a, 0x00,
+  0x00, 0x00, 0x1d, 0x00, 0x38, 0x00, 0x57, 0x00, 0x67, 0x00, 0x00, 0x00,
+  0x1a, 0x00, 0x2b, 0x00, 0x42, 0x00, 0x5e, 0x00, 0x66, 0x00, 0x6e, 0x00,
+  0x00, 0x00, 0x22, 0x00, 0x30, 0x00, 0x48, 0x00, 0x66, 0x00, 0x00, 0x00,
+  0x18, 0x00, 0x23, 0x00, 0x39, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1f, 0x00,
+  0x3a, 0x00, 0x00, 0x00, 0x19, 0x00, 0x35, 0x00, 0x49, 0x00, 0x54, 0x00,
+  0x69, 0x00, 0x72, 0x00, 0x7b, 0x00, 0x81, 0x00, 0x00, 0x00, 0x1a, 0x00,
+  0x32, 0x00, 0x4c, 0x00, 0x67, 0x00, 0x73, 0x00, 0x88, 0x00, 0x8f, 0x00,
+  0x00, 0x00, 0x24, 0x00, 0x3f, 0x00, 0x65, 0x00, 0x72, 0x00, 0x80, 0x00,
+  0xa8, 0x00, 0xcb, 0x00, 0xd3, 0x00, 0xdb, 0x00, 0x00, 0x00, 0x22, 0x00,
+  0x3d, 0x00, 0x55, 0x00, 0x62, 0x00, 0x00, 0x00, 0x18, 0x00, 0x31, 0x00,
+  0x59, 0x00, 0x6a, 0x00, 0x77, 0x00, 0x90, 0x00, 0xaa, 0x00, 0xb2, 0x00,
+  0xba, 0x00, 0xc2, 0x00, 0x00, 0x00, 0x10, 0x00, 0x1c, 0x00, 0x33, 0x00,
+  0x53, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x13, 0x00, 0x21, 0x00, 0x39, 0x00,
+  0x00, 0x00, 0x15, 0x00, 0x2a, 0x00, 0x31, 0x00, 0x38, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x19, 0x00, 0x1f, 0x00, 0x25, 0x00, 0x2b, 0x00, 0x31, 0x00,
+  0x37, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x26, 0x00, 0x2f, 0x00,
+  0x38, 0x00, 0x41, 0x00, 0x4a, 0x00, 0x53, 0x00, 0x5c, 0x00, 0x65, 0x00,
+  0x6e, 0x00, 0x77, 0x00, 0x80, 0x00, 0x89, 0x00, 0x92, 0x00, 0x9b, 0x00,
+  0xa4, 0x00, 0xad, 0x00, 0xb6, 0x00, 0xbf, 0x00, 0xc8, 0x00, 0xd1, 0x00,
+  0xda, 0x00, 0xe3, 0x00, 0xec, 0x00, 0xf2, 0x00, 0x00, 0x00, 0x15, 0x00,
+  0x28, 0x00, 0x00, 0x00, 0x19, 0x00, 0x31, 0x00, 0x45, 0x00, 0x51, 0x00,
+  0x58, 0x00, 0x5f, 0x00, 0x66, 0x00, 0x6d, 0x00, 0x00, 0x00, 0x1c, 0x00,
+  0x36, 0x00, 0x45, 0x00, 0x52, 0x00, 0x5a, 0x00, 0x68, 0x00, 0x00, 0x00,
+  0x1a, 0x00, 0x28, 0x00, 0x34, 0x00, 0x3a, 0x00, 0x40, 0x00, 0x46, 0x00,
+  0x4d, 0x00, 0x54, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x2a, 0x00, 0x38, 0x00,
+  0x40, 0x00, 0x48, 0x00, 0x50, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x2d, 0x00,
+  0x34, 0x00, 0x00, 0x00, 0x19, 0x00, 0x32, 0x00, 0x40, 0x00, 0x66, 0x00,
+  0x70, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x1e, 0x00,
+  0x3d, 0x00, 0x44, 0x00, 0x4a, 0x00, 0x51, 0x00, 0x58, 0x00, 0x5f, 0x00,
+  0x00, 0x00, 0x1a, 0x00, 0x35, 0x00, 0x00, 0x00, 0x28, 0x00, 0x39, 0x00,
+  0x62, 0x00, 0x69, 0x00, 0x70, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x26, 0x00,
+  0x4d, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x39, 0x00, 0x53, 0x00, 0x6c, 0x00,
+  0x8d, 0x00, 0x94, 0x00, 0x00, 0x00, 0x19, 0x00, 0x20, 0x00, 0x27, 0x00,
+  0x2e, 0x00, 0x35, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x37, 0x00,
+  0x51, 0x00, 0x58, 0x00, 0x61, 0x00, 0x6a, 0x00, 0x73, 0x00, 0x7c, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x23, 0x00, 0x2a, 0x00, 0x00, 0x00,
+  0x19, 0x00, 0x32, 0x00, 0x00, 0x00, 0x19, 0x00, 0x30, 0x00, 0x4d, 0x00,
+  0x53, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x31, 0x00, 0x43, 0x00, 0x55, 0x00,
+  0x68, 0x00, 0x7a, 0x00, 0x8c, 0x00, 0xa0, 0x00, 0xb3, 0x00, 0xc5, 0x00,
+  0xd9, 0x00, 0xdf, 0x00, 0x00, 0x00, 0x20, 0x00, 0x3b, 0x00, 0x00, 0x00,
+  0x31, 0x00, 0x51, 0x00, 0x58, 0x00, 0x00, 0x00, 0x17, 0x00, 0x2e, 0x00,
+  0x36, 0x00, 0x3e, 0x00, 0x46, 0x00, 0x4e, 0x00, 0x54, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x35, 0x00, 0x47, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x3d, 0x00,
+  0x56, 0x00, 0x6a, 0x00, 0x72, 0x00, 0x7d, 0x00, 0x00, 0x00, 0x08, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x0f, 0x00, 0x00, 0x00, 0x07, 0x00, 0x0e, 0x00, 0x15, 0x00, 0x1c, 0x00,
+  0x23, 0x00, 0x2a, 0x00, 0x31, 0x00, 0x38, 0x00, 0x3f, 0x00, 0x45, 0x00,
+  0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0c, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x0e, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x07, 0x00, 0x0d, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x07, 0x00, 0x0e, 0x00, 0x15, 0x00,
+  0x1c, 0x00, 0x23, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x06, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x09, 0x00, 0x11, 0x00,
+  0x19, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x07, 0x00, 0x0e, 0x00, 0x15, 0x00,
+  0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0c, 0x00, 0x12, 0x00,
+  0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x16, 0x00,
+  0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0f, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x0d, 0x00, 0x14, 0x00, 0x1b, 0x00, 0x21, 0x00, 0x27, 0x00,
+  0x2e, 0x00, 0x00, 0x00, 0x08, 0x00, 0x10, 0x00, 0x00, 0x00, 0x06, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x09, 0x00, 0x10, 0x00, 0x00, 0x00, 0x07, 0x00,
+  0x0e, 0x00, 0x15, 0x00, 0x1b, 0x00, 0x22, 0x00, 0x2a, 0x00, 0x32, 0x00,
+  0x39, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x11, 0x00, 0x18, 0x00, 0x1e, 0x00,
+  0x25, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x10, 0x00,
+  0x18, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x10, 0x00, 0x18, 0x00, 0x00, 0x00, 0x07, 0x00, 0x0f, 0x00,
+  0x17, 0x00, 0x1d, 0x00, 0x25, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0d, 0x00,
+  0x14, 0x00, 0x1a, 0x00, 0x21, 0x00, 0x28, 0x00, 0x2f, 0x00, 0x36, 0x00,
+  0x00, 0x00, 0x08, 0x00, 0x10, 0x00, 0x18, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x35, 0x00, 0x3b, 0x00, 0x41, 0x00, 0x48, 0x00, 0x00, 0x00,
+  0x39, 0x00, 0x42, 0x00, 0x4c, 0x00, 0x56, 0x00, 0x00, 0x00, 0x06, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x41, 0x00, 0x86, 0x00, 0xcb, 0x00, 0x00, 0x00,
+  0x3f, 0x00, 0x7c, 0x00, 0xbf, 0x00, 0x00, 0x01, 0x43, 0x01, 0x82, 0x01,
+  0x89, 0x01, 0x9b, 0x01, 0x00, 0x00, 0x07, 0x00, 0x0f, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x07, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x09, 0x00
+};
@@ -1,5 +1,7 @@
 #pragma once
-const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
+#include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/pt_dict_index.h>
+const unsigned char __espeakng_dict_pt[] __attribute__((aligned((4)))) = {
   0x00, 0x04, 0x00, 0x00, 0x4d, 0x04, 0x01, 0x00, 0x0a, 0xc6, 0x10, 0x54,
   0xd0, 0x48, 0x56, 0x8f, 0x10, 0x25, 0x0a, 0xc6, 0x0c, 0xf3, 0x94, 0x48,
   0xf3, 0x0f, 0x10, 0x25, 0x00, 0x46, 0x19, 0xf0, 0x9f, 0x91, 0xa9, 0xe2,
@@ -6367,4 +6369,11 @@ const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
   0x00, 0x04, 0xc3, 0x9f, 0x03, 0x5a, 0x00, 0xc3, 0xa7, 0x00, 0x24, 0x03,
   0x5a, 0x25, 0x54, 0x33, 0x06, 0x82, 0x00, 0x07, 0x00
 };
-size_t __espeakng_dictlen = 76389;
+
+BackgroundAudioDictionary dict_pt = {
+    "pt",
+    76389,
+    __espeakng_dict_pt,
+    13004,
+    __espeakng_dictindex_pt
+};
@@ -0,0 +1,1087 @@
+#pragma once
+const unsigned char __espeakng_dictindex_pt[] __attribute__((aligned((4)))) = {
+  0x45, 0x44, 0x58, 0x31, 0x65, 0x2a, 0x01, 0x00, 0x4d, 0x04, 0x01, 0x00,
+  0x3d, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x06, 0x00, 0x0d, 0x00,
+  0x0f, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x16, 0x00, 0x1a, 0x00, 0x1a, 0x00,
+  0x1c, 0x00, 0x1c, 0x00, 0x24, 0x00, 0x26, 0x00, 0x31, 0x00, 0x33, 0x00,
+  0x38, 0x00, 0x39, 0x00, 0x3b, 0x00, 0x3d, 0x00, 0x3f, 0x00, 0x40, 0x00,
+  0x43, 0x00, 0x44, 0x00, 0x44, 0x00, 0x44, 0x00, 0x44, 0x00, 0x46, 0x00,
+  0x48, 0x00, 0x49, 0x00, 0x4a, 0x00, 0x4b, 0x00, 0x4e, 0x00, 0x51, 0x00,
+  0x53, 0x00, 0x53, 0x00, 0x53, 0x00, 0x53, 0x00, 0x55, 0x00, 0x58, 0x00,
+  0x59, 0x00, 0x5b, 0x00, 0x5b, 0x00, 0x5d, 0x00, 0x60, 0x00, 0x68, 0x00,
+  0x6d, 0x00, 0x70, 0x00, 0x71, 0x00, 0x72, 0x00, 0x73, 0x00, 0x7a, 0x00,
+  0x7b, 0x00, 0x7c, 0x00, 0x7c, 0x00, 0x7d, 0x00, 0x7e, 0x00, 0x7f, 0x00,
+  0x85, 0x00, 0x86, 0x00, 0x88, 0x00, 0x88, 0x00, 0x8c, 0x00, 0x8e, 0x00,
+  0x8e, 0x00, 0x8e, 0x00, 0x95, 0x00, 0x9b, 0x00, 0x9b, 0x00, 0x9c, 0x00,
+  0x9f, 0x00, 0xa2, 0x00, 0xa5, 0x00, 0xa6, 0x00, 0xa7, 0x00, 0xb0, 0x00,
+  0xb4, 0x00, 0xbf, 0x00, 0xbf, 0x00, 0xc6, 0x00, 0xc7, 0x00, 0xc8, 0x00,
+  0xca, 0x00, 0xd8, 0x00, 0xda, 0x00, 0xda, 0x00, 0xda, 0x00, 0xdc, 0x00,
+  0xde, 0x00, 0xe0, 0x00, 0xe3, 0x00, 0xed, 0x00, 0xee, 0x00, 0xf6, 0x00,
+  0xf8, 0x00, 0xf9, 0x00, 0xfa, 0x00, 0xfd, 0x00, 0x00, 0x01, 0x05, 0x01,
+  0x06, 0x01, 0x06, 0x01, 0x07, 0x01, 0x08, 0x01, 0x0c, 0x01, 0x0f, 0x01,
+  0x11, 0x01, 0x1c, 0x01, 0x20, 0x01, 0x2e, 0x01, 0x32, 0x01, 0x34, 0x01,
+  0x38, 0x01, 0x3a, 0x01, 0x3e, 0x01, 0x42, 0x01, 0x44, 0x01, 0x4a, 0x01,
+  0x4d, 0x01, 0x4e, 0x01, 0x54, 0x01, 0x56, 0x01, 0x59, 0x01, 0x5d, 0x01,
+  0x5e, 0x01, 0x65, 0x01, 0x69, 0x01, 0x6c, 0x01, 0x6f, 0x01, 0x71, 0x01,
+  0x71, 0x01, 0x78, 0x01, 0x7a, 0x01, 0x7a, 0x01, 0x7c, 0x01, 0x80, 0x01,
+  0x84, 0x01, 0x88, 0x01, 0x8a, 0x01, 0x92, 0x01, 0x99, 0x01, 0xa7, 0x01,
+  0xaa, 0x01, 0xab, 0x01, 0xaf, 0x01, 0xb7, 0x01, 0xbb, 0x01, 0xbd, 0x01,
+  0xc2, 0x01, 0xc6, 0x01, 0xc8, 0x01, 0xcb, 0x01, 0xcf, 0x01, 0xd3, 0x01,
+  0xd8, 0x01, 0xdc, 0x01, 0xdf, 0x01, 0xe2, 0x01, 0xe3, 0x01, 0xe8, 0x01,
+  0xea, 0x01, 0xee, 0x01, 0xef, 0x01, 0xf5, 0x01, 0xf7, 0x01, 0xfb, 0x01,
+  0xfd, 0x01, 0x01, 0x02, 0x04, 0x02, 0x0a, 0x02, 0x0d, 0x02, 0x13, 0x02,
+  0x14, 0x02, 0x15, 0x02, 0x18, 0x02, 0x1a, 0x02, 0x1b, 0x02, 0x1d, 0x02,
+  0x20, 0x02, 0x22, 0x02, 0x23, 0x02, 0x24, 0x02, 0x26, 0x02, 0x28, 0x02,
+  0x2c, 0x02, 0x2c, 0x02, 0x33, 0x02, 0x35, 0x02, 0x36, 0x02, 0x36, 0x02,
+  0x39, 0x02, 0x39, 0x02, 0x3b, 0x02, 0x3c, 0x02, 0x3c, 0x02, 0x3e, 0x02,
+  0x3f, 0x02, 0x42, 0x02, 0x45, 0x02, 0x4a, 0x02, 0x4c, 0x02, 0x52, 0x02,
+  0x52, 0x02, 0x58, 0x02, 0x58, 0x02, 0x5a, 0x02, 0x5c, 0x02, 0x5d, 0x02,
+  0x5e, 0x02, 0x5e, 0x02, 0x62, 0x02, 0x64, 0x02, 0x66, 0x02, 0x68, 0x02,
+  0x6a, 0x02, 0x6a, 0x02, 0x6b, 0x02, 0x6f, 0x02, 0x6f, 0x02, 0x6f, 0x02,
+  0x6f, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x71, 0x02, 0x72, 0x02,
+  0x72, 0x02, 0x72, 0x02, 0x72, 0x02, 0x74, 0x02, 0x74, 0x02, 0x77, 0x02,
+  0x85, 0x02, 0x86, 0x02, 0x86, 0x02, 0x89, 0x02, 0x92, 0x02, 0x92, 0x02,
+  0x92, 0x02, 0x97, 0x02, 0x9a, 0x02, 0x9c, 0x02, 0x9f, 0x02, 0x9f, 0x02,
+  0xa4, 0x02, 0xa4, 0x02, 0xa9, 0x02, 0xab, 0x02, 0xac, 0x02, 0xae, 0x02,
+  0xae, 0x02, 0xaf, 0x02, 0xb0, 0x02, 0xb1, 0x02, 0xb1, 0x02, 0xb1, 0x02,
+  0xb2, 0x02, 0xb2, 0x02, 0xb4, 0x02, 0xb5, 0x02, 0xb7, 0x02, 0xbc, 0x02,
+  0xbe, 0x02, 0xc8, 0x02, 0xc9, 0x02, 0xcc, 0x02, 0xcf, 0x02, 0xd4, 0x02,
+  0xd4, 0x02, 0xd7, 0x02, 0xd8, 0x02, 0xd8, 0x02, 0xda, 0x02, 0xe3, 0x02,
+  0xe4, 0x02, 0xe6, 0x02, 0xe7, 0x02, 0xeb, 0x02, 0xed, 0x02, 0xf3, 0x02,
+  0xf4, 0x02, 0xf4, 0x02, 0xf5, 0x02, 0xf6, 0x02, 0xf8, 0x02, 0xfa, 0x02,
+  0xfa, 0x02, 0xfa, 0x02, 0xfb, 0x02, 0x00, 0x03, 0x02, 0x03, 0x03, 0x03,
+  0x05, 0x03, 0x08, 0x03, 0x09, 0x03, 0x09, 0x03, 0x0b, 0x03, 0x0d, 0x03,
+  0x0d, 0x03, 0x10, 0x03, 0x12, 0x03, 0x14, 0x03, 0x16, 0x03, 0x19, 0x03,
+  0x1b, 0x03, 0x26, 0x03, 0x28, 0x03, 0x29, 0x03, 0x2b, 0x03, 0x2c, 0x03,
+  0x2d, 0x03, 0x34, 0x03, 0x34, 0x03, 0x36, 0x03, 0x38, 0x03, 0x39, 0x03,
+  0x3c, 0x03, 0x40, 0x03, 0x42, 0x03, 0x42, 0x03, 0x43, 0x03, 0x44, 0x03,
+  0x47, 0x03, 0x47, 0x03, 0x48, 0x03, 0x4a, 0x03, 0x4d, 0x03, 0x4f, 0x03,
+  0x4f, 0x03, 0x50, 0x03, 0x50, 0x03, 0x52, 0x03, 0x53, 0x03, 0x56, 0x03,
+  0x56, 0x03, 0x58, 0x03, 0x59, 0x03, 0x5b, 0x03, 0x5e, 0x03, 0x5e, 0x03,
+  0x5f, 0x03, 0x60, 0x03, 0x65, 0x03, 0x69, 0x03, 0x6a, 0x03, 0x6c, 0x03,
+  0x70, 0x03, 0x70, 0x03, 0x74, 0x03, 0x77, 0x03, 0x77, 0x03, 0x78, 0x03,
+  0x78, 0x03, 0x78, 0x03, 0x79, 0x03, 0x7a, 0x03, 0x7a, 0x03, 0x7c, 0x03,
+  0x81, 0x03, 0x84, 0x03, 0x87, 0x03, 0x8a, 0x03, 0x8c, 0x03, 0x8d, 0x03,
+  0x9f, 0x03, 0xa7, 0x03, 0xa7, 0x03, 0xa8, 0x03, 0xae, 0x03, 0xb0, 0x03,
+  0xb2, 0x03, 0xb6, 0x03, 0xb9, 0x03, 0xba, 0x03, 0xbc, 0x03, 0xbf, 0x03,
+  0xc0, 0x03, 0xc2, 0x03, 0xc3, 0x03, 0xc5, 0x03, 0xc7, 0x03, 0xcb, 0x03,
+  0xcb, 0x03, 0xcc, 0x03, 0xcd, 0x03, 0xce, 0x03, 0xcf, 0x03, 0xd4, 0x03,
+  0xd7, 0x03, 0xd9, 0x03, 0xe0, 0x03, 0xe3, 0x03, 0xe3, 0x03, 0xe4, 0x03,
+  0xe6, 0x03, 0xe7, 0x03, 0xea, 0x03, 0xed, 0x03, 0xef, 0x03, 0xf2, 0x03,
+  0xf4, 0x03, 0xf6, 0x03, 0xf8, 0x03, 0xf8, 0x03, 0xfd, 0x03, 0xff, 0x03,
+  0x04, 0x04, 0x07, 0x04, 0x08, 0x04, 0x09, 0x04, 0x0b, 0x04, 0x0e, 0x04,
+  0x10, 0x04, 0x12, 0x04, 0x16, 0x04, 0x1b, 0x04, 0x1e, 0x04, 0x22, 0x04,
+  0x24, 0x04, 0x26, 0x04, 0x28, 0x04, 0x2e, 0x04, 0x36, 0x04, 0x39, 0x04,
+  0x40, 0x04, 0x41, 0x04, 0x48, 0x04, 0x48, 0x04, 0x49, 0x04, 0x4b, 0x04,
+  0x4d, 0x04, 0x4d, 0x04, 0x50, 0x04, 0x52, 0x04, 0x54, 0x04, 0x55, 0x04,
+  0x55, 0x04, 0x56, 0x04, 0x59, 0x04, 0x5b, 0x04, 0x5b, 0x04, 0x5d, 0x04,
+  0x60, 0x04, 0x62, 0x04, 0x62, 0x04, 0x66, 0x04, 0x6a, 0x04, 0x6c, 0x04,
+  0x6d, 0x04, 0x6d, 0x04, 0x6e, 0x04, 0x70, 0x04, 0x74, 0x04, 0x76, 0x04,
+  0x7c, 0x04, 0x7f, 0x04, 0x80, 0x04, 0x80, 0x04, 0x85, 0x04, 0x86, 0x04,
+  0x87, 0x04, 0x8b, 0x04, 0x8c, 0x04, 0x8c, 0x04, 0x8c, 0x04, 0x91, 0x04,
+  0x92, 0x04, 0x92, 0x04, 0x94, 0x04, 0x96, 0x04, 0x98, 0x04, 0x9c, 0x04,
+  0x9d, 0x04, 0x9e, 0x04, 0x9f, 0x04, 0xa0, 0x04, 0xa0, 0x04, 0xa2, 0x04,
+  0xa7, 0x04, 0xa7, 0x04, 0xa9, 0x04, 0xaa, 0x04, 0xaa, 0x04, 0xab, 0x04,
+  0xad, 0x04, 0xb1, 0x04, 0xb5, 0x04, 0xbe, 0x04, 0xc1, 0x04, 0xc5, 0x04,
+  0xca, 0x04, 0xd7, 0x04, 0xdb, 0x04, 0xde, 0x04, 0xdf, 0x04, 0xe0, 0x04,
+  0xe3, 0x04, 0xeb, 0x04, 0xed, 0x04, 0xf0, 0x04, 0xf3, 0x04, 0xf6, 0x04,
+  0xf8, 0x04, 0xfc, 0x04, 0xff, 0x04, 0x01, 0x05, 0x04, 0x05, 0x06, 0x05,
+  0x0a, 0x05, 0x0e, 0x05, 0x11, 0x05, 0x12, 0x05, 0x16, 0x05, 0x18, 0x05,
+  0x1d, 0x05, 0x1f, 0x05, 0x24, 0x05, 0x28, 0x05, 0x29, 0x05, 0x2a, 0x05,
+  0x2d, 0x05, 0x33, 0x05, 0x46, 0x05, 0x48, 0x05, 0x49, 0x05, 0x4d, 0x05,
+  0x57, 0x05, 0x5d, 0x05, 0x63, 0x05, 0x68, 0x05, 0x6c, 0x05, 0x6e, 0x05,
+  0x75, 0x05, 0x77, 0x05, 0x7b, 0x05, 0x7d, 0x05, 0x7f, 0x05, 0x80, 0x05,
+  0x83, 0x05, 0x88, 0x05, 0x89, 0x05, 0x8d, 0x05, 0x92, 0x05, 0x94, 0x05,
+  0x98, 0x05, 0x9c, 0x05, 0xa0, 0x05, 0xa5, 0x05, 0xab, 0x05, 0xab, 0x05,
+  0xad, 0x05, 0xae, 0x05, 0xaf, 0x05, 0xb1, 0x05, 0xb2, 0x05, 0xb3, 0x05,
+  0xb4, 0x05, 0xb6, 0x05, 0xb8, 0x05, 0xbb, 0x05, 0xc1, 0x05, 0xc2, 0x05,
+  0xc3, 0x05, 0xc5, 0x05, 0xc9, 0x05, 0xcb, 0x05, 0xcc, 0x05, 0xce, 0x05,
+  0xcf, 0x05, 0xd0, 0x05, 0xd3, 0x05, 0xd4, 0x05, 0xd8, 0x05, 0xda, 0x05,
+  0xdb, 0x05, 0xde, 0x05, 0xe0, 0x05, 0xe0, 0x05, 0xe2, 0x05, 0xe5, 0x05,
+  0xea, 0x05, 0xed, 0x05, 0xed, 0x05, 0xee, 0x05, 0xef, 0x05, 0xf3, 0x05,
+  0xf4, 0x05, 0xf6, 0x05, 0xf6, 0x05, 0xf6, 0x05, 0xf7, 0x05, 0xf9, 0x05,
+  0xf9, 0x05, 0xfa, 0x05, 0xfb, 0x05, 0xfd, 0x05, 0xfe, 0x05, 0x02, 0x06,
+  0x04, 0x06, 0x05, 0x06, 0x07, 0x06, 0x09, 0x06, 0x0c, 0x06, 0x0c, 0x06,
+  0x0e, 0x06, 0x0e, 0x06, 0x0e, 0x06, 0x12, 0x06, 0x14, 0x06, 0x14, 0x06,
+  0x17, 0x06, 0x18, 0x06, 0x19, 0x06, 0x1e, 0x06, 0x20, 0x06, 0x22, 0x06,
+  0x22, 0x06, 0x26, 0x06, 0x2e, 0x06, 0x33, 0x06, 0x34, 0x06, 0x36, 0x06,
+  0x38, 0x06, 0x45, 0x06, 0x46, 0x06, 0x49, 0x06, 0x4b, 0x06, 0x4e, 0x06,
+  0x4f, 0x06, 0x51, 0x06, 0x52, 0x06, 0x52, 0x06, 0x54, 0x06, 0x56, 0x06,
+  0x57, 0x06, 0x59, 0x06, 0x5a, 0x06, 0x5c, 0x06, 0x5c, 0x06, 0x5e, 0x06,
+  0x5e, 0x06, 0x5e, 0x06, 0x65, 0x06, 0x68, 0x06, 0x6a, 0x06, 0x70, 0x06,
+  0x72, 0x06, 0x72, 0x06, 0x75, 0x06, 0x79, 0x06, 0x7d, 0x06, 0x7f, 0x06,
+  0x81, 0x06, 0x83, 0x06, 0x86, 0x06, 0x93, 0x06, 0x95, 0x06, 0x96, 0x06,
+  0x98, 0x06, 0x99, 0x06, 0x9a, 0x06, 0x9c, 0x06, 0x9e, 0x06, 0xa1, 0x06,
+  0xa2, 0x06, 0xaf, 0x06, 0xb2, 0x06, 0xb3, 0x06, 0xb3, 0x06, 0xb6, 0x06,
+  0xb6, 0x06, 0xbb, 0x06, 0xbe, 0x06, 0xbe, 0x06, 0xbf, 0x06, 0xc1, 0x06,
+  0xc1, 0x06, 0xc6, 0x06, 0xcb, 0x06, 0xce, 0x06, 0xd0, 0x06, 0xd6, 0x06,
+  0xdb, 0x06, 0xdf, 0x06, 0xe2, 0x06, 0xe5, 0x06, 0xe6, 0x06, 0xe9, 0x06,
+  0xec, 0x06, 0xee, 0x06, 0xf1, 0x06, 0xf5, 0x06, 0xf8, 0x06, 0x00, 0x07,
+  0x0a, 0x07, 0x13, 0x07, 0x18, 0x07, 0x28, 0x07, 0x32, 0x07, 0x39, 0x07,
+  0x3f, 0x07, 0x42, 0x07, 0x46, 0x07, 0x4d, 0x07, 0x52, 0x07, 0x55, 0x07,
+  0x5a, 0x07, 0x5f, 0x07, 0x65, 0x07, 0x6c, 0x07, 0x74, 0x07, 0x7a, 0x07,
+  0x80, 0x07, 0x8d, 0x07, 0x93, 0x07, 0x99, 0x07, 0xa0, 0x07, 0xa8, 0x07,
+  0xb0, 0x07, 0xbb, 0x07, 0xc4, 0x07, 0xc9, 0x07, 0xcf, 0x07, 0xd4, 0x07,
+  0xda, 0x07, 0xe4, 0x07, 0xee, 0x07, 0x01, 0x08, 0x09, 0x08, 0x1c, 0x08,
+  0x28, 0x08, 0x32, 0x08, 0x3b, 0x08, 0x45, 0x08, 0x4f, 0x08, 0x56, 0x08,
+  0x5d, 0x08, 0x64, 0x08, 0x6c, 0x08, 0x72, 0x08, 0x78, 0x08, 0x82, 0x08,
+  0x8b, 0x08, 0x92, 0x08, 0x9a, 0x08, 0xa4, 0x08, 0xb1, 0x08, 0xba, 0x08,
+  0xc2, 0x08, 0xca, 0x08, 0xda, 0x08, 0xe1, 0x08, 0xeb, 0x08, 0xf1, 0x08,
+  0xfa, 0x08, 0x02, 0x09, 0x0b, 0x09, 0x16, 0x09, 0x1d, 0x09, 0x30, 0x09,
+  0x36, 0x09, 0x47, 0x09, 0x50, 0x09, 0x58, 0x09, 0x61, 0x09, 0x6a, 0x09,
+  0x73, 0x09, 0x7b, 0x09, 0x83, 0x09, 0x8b, 0x09, 0x92, 0x09, 0x9b, 0x09,
+  0xa4, 0x09, 0xaa, 0x09, 0xaf, 0x09, 0xb5, 0x09, 0xbc, 0x09, 0xcc, 0x09,
+  0xd3, 0x09, 0xdb, 0x09, 0xe6, 0x09, 0xfa, 0x09, 0x04, 0x0a, 0x0f, 0x0a,
+  0x15, 0x0a, 0x1b, 0x0a, 0x22, 0x0a, 0x2b, 0x0a, 0x32, 0x0a, 0x36, 0x0a,
+  0x40, 0x0a, 0x46, 0x0a, 0x4b, 0x0a, 0x50, 0x0a, 0x56, 0x0a, 0x5f, 0x0a,
+  0x66, 0x0a, 0x6d, 0x0a, 0x71, 0x0a, 0x7d, 0x0a, 0x83, 0x0a, 0x87, 0x0a,
+  0x8e, 0x0a, 0x96, 0x0a, 0x9c, 0x0a, 0xa1, 0x0a, 0xa7, 0x0a, 0xac, 0x0a,
+  0xb1, 0x0a, 0xb8, 0x0a, 0xbc, 0x0a, 0xc9, 0x0a, 0xce, 0x0a, 0xd5, 0x0a,
+  0xdc, 0x0a, 0xea, 0x0a, 0xf2, 0x0a, 0xf7, 0x0a, 0xfd, 0x0a, 0x02, 0x0b,
+  0x0a, 0x0b, 0x0f, 0x0b, 0x13, 0x0b, 0x17, 0x0b, 0x1e, 0x0b, 0x22, 0x0b,
+  0x25, 0x0b, 0x2d, 0x0b, 0x30, 0x0b, 0x34, 0x0b, 0x38, 0x0b, 0x3c, 0x0b,
+  0x49, 0x0b, 0x4f, 0x0b, 0x52, 0x0b, 0x58, 0x0b, 0x5c, 0x0b, 0x5e, 0x0b,
+  0x60, 0x0b, 0x65, 0x0b, 0x67, 0x0b, 0x68, 0x0b, 0x69, 0x0b, 0x6c, 0x0b,
+  0x6e, 0x0b, 0x72, 0x0b, 0x75, 0x0b, 0x79, 0x0b, 0x7e, 0x0b, 0x82, 0x0b,
+  0x85, 0x0b, 0x8b, 0x0b, 0x98, 0x0b, 0x99, 0x0b, 0x9a, 0x0b, 0x9c, 0x0b,
+  0x9e, 0x0b, 0xa0, 0x0b, 0xa4, 0x0b, 0xab, 0x0b, 0xab, 0x0b, 0xaf, 0x0b,
+  0xb4, 0x0b, 0xb6, 0x0b, 0xbf, 0x0b, 0xc6, 0x0b, 0xc8, 0x0b, 0xcb, 0x0b,
+  0xd2, 0x0b, 0xd3, 0x0b, 0xd4, 0x0b, 0xd7, 0x0b, 0xdb, 0x0b, 0xdd, 0x0b,
+  0xe4, 0x0b, 0xe4, 0x0b, 0xe9, 0x0b, 0xed, 0x0b, 0x06, 0x0c, 0x0a, 0x0c,
+  0x0d, 0x0c, 0x11, 0x0c, 0x14, 0x0c, 0x16, 0x0c, 0x19, 0x0c, 0x20, 0x0c,
+  0x28, 0x0c, 0x2f, 0x0c, 0x35, 0x0c, 0x3a, 0x0c, 0x40, 0x0c, 0x46, 0x0c,
+  0x49, 0x0c, 0x4b, 0x0c, 0x4e, 0x0c, 0x51, 0x0c, 0x55, 0x0c, 0x57, 0x0c,
+  0x5d, 0x0c, 0x60, 0x0c, 0x66, 0x0c, 0x6b, 0x0c, 0x70, 0x0c, 0x76, 0x0c,
+  0x7d, 0x0c, 0x82, 0x0c, 0x8d, 0x0c, 0x9b, 0x0c, 0xa3, 0x0c, 0xaa, 0x0c,
+  0xb9, 0x0c, 0xc0, 0x0c, 0xc7, 0x0c, 0xcf, 0x0c, 0xda, 0x0c, 0xe3, 0x0c,
+  0xeb, 0x0c, 0xf1, 0x0c, 0xff, 0x0c, 0x0b, 0x0d, 0x17, 0x0d, 0x1e, 0x0d,
+  0x24, 0x0d, 0x28, 0x0d, 0x2c, 0x0d, 0x30, 0x0d, 0x35, 0x0d, 0x3d, 0x0d,
+  0x45, 0x0d, 0x4a, 0x0d, 0x53, 0x0d, 0x59, 0x0d, 0x5f, 0x0d, 0x64, 0x0d,
+  0x67, 0x0d, 0x6a, 0x0d, 0x6c, 0x0d, 0x70, 0x0d, 0x74, 0x0d, 0x77, 0x0d,
+  0x7b, 0x0d, 0x7d, 0x0d, 0x83, 0x0d, 0x88, 0x0d, 0x8a, 0x0d, 0x8f, 0x0d,
+  0x92, 0x0d, 0x98, 0x0d, 0x9d, 0x0d, 0x9e, 0x0d, 0xa2, 0x0d, 0xa3, 0x0d,
+  0xad, 0x0d, 0xb1, 0x0d, 0xb7, 0x0d, 0xb9, 0x0d, 0xbe, 0x0d, 0xc1, 0x0d,
+  0xc4, 0x0d, 0xc7, 0x0d, 0xcd, 0x0d, 0xcd, 0x0d, 0xcd, 0x0d, 0xd0, 0x0d,
+  0xd1, 0x0d, 0xd1, 0x0d, 0xd1, 0x0d, 0xd3, 0x0d, 0xd9, 0x0d, 0xdb, 0x0d,
+  0xdb, 0x0d, 0xdb, 0x0d, 0xde, 0x0d, 0xe1, 0x0d, 0xea, 0x0d, 0xec, 0x0d,
+  0xec, 0x0d, 0xec, 0x0d, 0xee, 0x0d, 0xf2, 0x0d, 0xf2, 0x0d, 0xf2, 0x0d,
+  0xf3, 0x0d, 0xf3, 0x0d, 0xf3, 0x0d, 0xf5, 0x0d, 0xf6, 0x0d, 0xf6, 0x0d,
+  0xf6, 0x0d, 0xf7, 0x0d, 0xf9, 0x0d, 0xf9, 0x0d, 0xf9, 0x0d, 0xfd, 0x0d,
+  0xfd, 0x0d, 0x00, 0x0e, 0x00, 0x0e, 0x01, 0x0e, 0x02, 0x0e, 0x02, 0x0e,
+  0x03, 0x0e, 0x09, 0x0e, 0x0a, 0x0e, 0x0a, 0x0e, 0x10, 0x0e, 0x1b, 0x0e,
+  0x1e, 0x0e, 0x23, 0x0e, 0x23, 0x0e, 0x24, 0x0e, 0x24, 0x0e, 0x26, 0x0e,
+  0x26, 0x0e, 0x27, 0x0e, 0x28, 0x0e, 0x29, 0x0e, 0x2b, 0x0e, 0x2d, 0x0e,
+  0x2d, 0x0e, 0x32, 0x0e, 0x39, 0x0e, 0x3a, 0x0e, 0x3a, 0x0e, 0x3b, 0x0e,
+  0x3d, 0x0e, 0x00, 0x00, 0x9f, 0xcc, 0x8c, 0x02, 0x63, 0xd4, 0x31, 0x3e,
+  0xc6, 0x70, 0x35, 0x0b, 0x6b, 0x19, 0x19, 0xc0, 0x17, 0x17, 0x17, 0x75,
+  0x36, 0x36, 0x68, 0x68, 0x0e, 0xd4, 0xba, 0x44, 0x1e, 0x1e, 0x7c, 0xcc,
+  0x39, 0x2e, 0xed, 0xed, 0x0f, 0x62, 0x67, 0x67, 0xf7, 0xf7, 0x85, 0xd8,
+  0x0a, 0xb6, 0x80, 0x01, 0xdf, 0x37, 0x37, 0x9a, 0xd9, 0x74, 0xa0, 0xef,
+  0x20, 0x43, 0xd4, 0xa2, 0xa6, 0x40, 0xf2, 0x65, 0x3d, 0x3d, 0x3d, 0xd7,
+  0x9d, 0xec, 0xfa, 0xfa, 0x82, 0xfe, 0x0a, 0x7e, 0xcf, 0x71, 0x92, 0xe9,
+  0x25, 0xfe, 0xc6, 0xe5, 0x42, 0xb4, 0xb4, 0x3c, 0xaf, 0xd3, 0x2a, 0x19,
+  0x14, 0x9c, 0x0b, 0x65, 0xee, 0x2e, 0xbb, 0x75, 0x91, 0x91, 0xb3, 0xd0,
+  0x77, 0xd7, 0x19, 0x35, 0x91, 0xb1, 0xbe, 0xb2, 0x33, 0x2c, 0xbe, 0x41,
+  0x68, 0x09, 0xdf, 0xac, 0xd7, 0xd8, 0xa8, 0x3f, 0xe2, 0x5c, 0x7f, 0x50,
+  0xa8, 0xa8, 0x17, 0x17, 0xd5, 0xa4, 0x03, 0xae, 0x92, 0xfe, 0x30, 0x30,
+  0xb7, 0x90, 0x2a, 0x9d, 0xd0, 0x7a, 0x2a, 0x21, 0xf9, 0x5c, 0xf4, 0x2a,
+  0x2a, 0x1a, 0x1a, 0xb6, 0x9e, 0xc2, 0xbc, 0x92, 0xd5, 0xb1, 0xad, 0x0b,
+  0xde, 0x48, 0xec, 0xb8, 0xa5, 0x89, 0xb3, 0xd6, 0x07, 0xa9, 0xfb, 0x67,
+  0xa8, 0x06, 0x95, 0x95, 0x48, 0x9a, 0xa1, 0xde, 0xe3, 0xe4, 0x05, 0x54,
+  0xf6, 0xbf, 0xa8, 0x86, 0x86, 0x6b, 0x03, 0xc1, 0xc1, 0xe8, 0x66, 0x8d,
+  0x33, 0xaf, 0x22, 0xf4, 0xc4, 0x35, 0x9b, 0xa3, 0x70, 0xda, 0x06, 0x7b,
+  0xb5, 0xb5, 0xb8, 0xb8, 0xab, 0x00, 0x82, 0x2f, 0x8e, 0x8e, 0x0f, 0x3d,
+  0x5b, 0xe0, 0x31, 0x74, 0xff, 0xde, 0xef, 0xac, 0x58, 0xbe, 0x2e, 0x88,
+  0x26, 0xa4, 0x53, 0x17, 0x8d, 0xc4, 0x93, 0x7f, 0x9d, 0x74, 0x0c, 0x02,
+  0x09, 0x3b, 0xd7, 0xd7, 0x86, 0x1a, 0x1a, 0x0b, 0x4c, 0x5e, 0x5e, 0xb4,
+  0x5f, 0x2b, 0xcd, 0x91, 0xed, 0x3d, 0x63, 0x5e, 0x1e, 0xc4, 0xc4, 0x6c,
+  0x8f, 0xd2, 0xae, 0x45, 0xa5, 0xf5, 0x61, 0x61, 0xfb, 0xac, 0x09, 0x36,
+  0xa1, 0x49, 0x71, 0x92, 0xe7, 0x7a, 0x2c, 0x84, 0xde, 0x0a, 0x1a, 0x58,
+  0xe0, 0xd2, 0x24, 0xe5, 0x40, 0x1a, 0x39, 0x16, 0xcf, 0x22, 0x35, 0x67,
+  0x1e, 0xa8, 0x94, 0xb3, 0x1d, 0x90, 0x80, 0xae, 0xd9, 0x60, 0x36, 0x4c,
+  0x4b, 0xf5, 0x9d, 0xcf, 0xd4, 0x96, 0x63, 0xdc, 0xf8, 0x81, 0x22, 0x09,
+  0xee, 0x81, 0x6f, 0xc2, 0x69, 0x69, 0xd9, 0xc5, 0x4d, 0xa4, 0xfe, 0x49,
+  0xc7, 0xfc, 0xdf, 0x8e, 0x6a, 0x12, 0x27, 0x38, 0xf5, 0x13, 0x7d, 0xe4,
+  0xbb, 0x80, 0x17, 0x34, 0x09, 0xbe, 0x89, 0x0f, 0xd5, 0x32, 0x2f, 0xb3,
+  0xb3, 0xb9, 0xfb, 0x14, 0x8c, 0xe6, 0x20, 0xdc, 0x72, 0x5c, 0x96, 0xf9,
+  0x37, 0x6b, 0x60, 0xfe, 0x95, 0x95, 0x76, 0x76, 0x36, 0x8b, 0xab, 0xab,
+  0xbe, 0x84, 0xc3, 0x91, 0xb0, 0x05, 0xf8, 0x0f, 0xcb, 0xc3, 0xc8, 0x57,
+  0x24, 0x63, 0xd0, 0x5f, 0x5f, 0x65, 0x79, 0x02, 0xf2, 0x5e, 0x69, 0xd0,
+  0xaa, 0x0f, 0x0d, 0x05, 0x57, 0x83, 0x62, 0x09, 0xcc, 0xb3, 0x27, 0xf2,
+  0xed, 0xd8, 0xac, 0xe3, 0x9b, 0x5c, 0x05, 0x12, 0x12, 0x12, 0xb9, 0xe2,
+  0xbd, 0xca, 0x9d, 0x81, 0x10, 0x24, 0x34, 0x56, 0xf3, 0x37, 0x24, 0x09,
+  0xd5, 0xbe, 0x9a, 0x49, 0x32, 0xfe, 0x72, 0xaf, 0x62, 0x1a, 0x30, 0x1e,
+  0x7b, 0x25, 0x0f, 0xaa, 0xb4, 0xc1, 0x93, 0x76, 0x75, 0x5a, 0xf9, 0xb8,
+  0x81, 0xad, 0x31, 0xff, 0x90, 0x2d, 0x6c, 0x3b, 0x10, 0xbb, 0x48, 0x83,
+  0xf7, 0x08, 0x09, 0x40, 0x40, 0x83, 0x9d, 0x37, 0x98, 0xbe, 0x72, 0xe7,
+  0x15, 0x0d, 0xe6, 0xdb, 0x1c, 0xf2, 0x13, 0x81, 0x23, 0xf1, 0x1a, 0xfa,
+  0xb2, 0xf2, 0xeb, 0x06, 0x41, 0xbf, 0x45, 0xe6, 0xeb, 0x3d, 0x36, 0xcf,
+  0xcf, 0x94, 0x95, 0x2e, 0x93, 0x9c, 0x0f, 0xd7, 0x37, 0x57, 0xe6, 0x1f,
+  0xde, 0x11, 0x83, 0xd8, 0xac, 0x31, 0xd6, 0x50, 0x19, 0xda, 0x14, 0x5f,
+  0xf2, 0xb9, 0xbd, 0xdd, 0xb2, 0xb8, 0x80, 0x8e, 0x18, 0x83, 0xfd, 0xeb,
+  0x97, 0x7d, 0xda, 0xe9, 0x86, 0xc7, 0x78, 0x1c, 0xd2, 0x22, 0xc2, 0xa0,
+  0xba, 0x11, 0x0d, 0x5d, 0x48, 0x7a, 0x80, 0x80, 0x4e, 0x08, 0xab, 0x64,
+  0x9d, 0x10, 0x15, 0xaa, 0x27, 0x9a, 0xfe, 0xab, 0xf3, 0x30, 0x03, 0xc1,
+  0xe0, 0xcb, 0xd1, 0x09, 0x25, 0x09, 0x8c, 0x44, 0xc2, 0xc0, 0xa0, 0x8d,
+  0x61, 0xbe, 0x17, 0xfa, 0x9c, 0x36, 0xff, 0x82, 0xe6, 0x14, 0xfa, 0xce,
+  0x40, 0x40, 0xf3, 0x81, 0xfa, 0xf5, 0x55, 0x4a, 0xc7, 0x3f, 0xf6, 0x73,
+  0x2d, 0xfc, 0x94, 0x62, 0x62, 0x56, 0xa6, 0xb7, 0x11, 0x11, 0xd0, 0x53,
+  0x16, 0x6e, 0x89, 0xa2, 0xa2, 0x76, 0xe0, 0xbb, 0xf0, 0x01, 0x78, 0x13,
+  0x71, 0xe1, 0x12, 0x56, 0x84, 0xb6, 0x56, 0xd5, 0x97, 0x97, 0x7f, 0xf7,
+  0x00, 0x5a, 0xa3, 0x01, 0x80, 0xab, 0x57, 0xed, 0xa3, 0xca, 0xca, 0xd4,
+  0x08, 0x0b, 0x28, 0xf1, 0x16, 0x0b, 0xb4, 0x9b, 0x00, 0xb5, 0x6e, 0xd2,
+  0xbc, 0xda, 0xaf, 0x4f, 0x79, 0x2b, 0x0c, 0xef, 0xff, 0x87, 0x0c, 0xbd,
+  0x8b, 0xdf, 0x7f, 0x26, 0xb9, 0x4d, 0x41, 0x06, 0x9c, 0xca, 0x20, 0x25,
+  0x03, 0x76, 0xb1, 0xd0, 0xeb, 0x59, 0xda, 0xcd, 0xa9, 0x23, 0xe3, 0xd3,
+  0x7a, 0x85, 0x56, 0xa6, 0xc6, 0x88, 0x88, 0x75, 0xe8, 0x69, 0x02, 0x6c,
+  0x0b, 0xfd, 0x3e, 0x64, 0x65, 0x1b, 0x9c, 0x0d, 0x22, 0xfb, 0xef, 0xd1,
+  0xd1, 0x8d, 0x8d, 0x63, 0xcf, 0xbe, 0x57, 0x57, 0x7c, 0xfe, 0xe5, 0xc3,
+  0xd9, 0x5a, 0xfd, 0xf1, 0xbc, 0xef, 0xac, 0x7e, 0x91, 0xa6, 0x89, 0xca,
+  0xae, 0xc3, 0x25, 0x98, 0xca, 0xd5, 0xd5, 0xd5, 0xb4, 0x48, 0x4a, 0x60,
+  0x66, 0x67, 0x57, 0x5f, 0x5f, 0x92, 0xaa, 0x47, 0xdf, 0x04, 0x64, 0x2c,
+  0x2c, 0x28, 0xa2, 0x64, 0xa4, 0x47, 0x5c, 0xcc, 0x47, 0xbe, 0x6b, 0x87,
+  0xf4, 0x51, 0x09, 0x5f, 0xad, 0x93, 0xf4, 0x6f, 0x11, 0x39, 0x17, 0x8d,
+  0xd9, 0xf5, 0x44, 0xb3, 0xb2, 0x6a, 0x7c, 0x6d, 0xae, 0x42, 0x99, 0x79,
+  0x38, 0x89, 0xfa, 0xca, 0x86, 0xc0, 0x3f, 0x3f, 0xce, 0x7d, 0x7b, 0x77,
+  0x38, 0x66, 0x3c, 0xee, 0xd2, 0xce, 0xf9, 0xe2, 0x2e, 0xd6, 0xd6, 0x0f,
+  0xda, 0xce, 0x6e, 0x85, 0x85, 0x92, 0x42, 0x50, 0x0c, 0x83, 0x0f, 0x37,
+  0xf8, 0x7c, 0x06, 0x73, 0x31, 0x03, 0x84, 0x59, 0x2d, 0x1f, 0x72, 0x33,
+  0x2d, 0xe8, 0x4b, 0x63, 0x08, 0xff, 0x80, 0x40, 0xee, 0xfb, 0x80, 0x1e,
+  0xc7, 0x3d, 0x1f, 0x70, 0xdb, 0x94, 0xa7, 0x26, 0xbf, 0x32, 0xca, 0x7e,
+  0x1b, 0xeb, 0xad, 0x75, 0xcc, 0x93, 0xa0, 0x8f, 0x75, 0x17, 0x03, 0x50,
+  0x21, 0xa3, 0x3d, 0x1a, 0x54, 0x00, 0x23, 0xc1, 0x50, 0x9c, 0x7c, 0x8c,
+  0xcc, 0xcc, 0xd6, 0x1d, 0x07, 0x35, 0x14, 0x14, 0xdf, 0x2e, 0xa9, 0xf3,
+  0x34, 0x3d, 0x4e, 0xa9, 0xd9, 0x73, 0xf3, 0x66, 0x52, 0x65, 0xd0, 0x83,
+  0x4a, 0x8a, 0x92, 0x3c, 0x02, 0x07, 0xf1, 0x04, 0x83, 0x83, 0x24, 0xeb,
+  0xb8, 0x29, 0xd5, 0xa2, 0x73, 0x8d, 0x90, 0x61, 0x61, 0x3c, 0xfd, 0x74,
+  0xdb, 0x41, 0xad, 0x44, 0x6c, 0x6d, 0x96, 0x5d, 0x21, 0x13, 0x33, 0x33,
+  0x96, 0xdc, 0x38, 0x2a, 0xc3, 0x02, 0xb2, 0xcf, 0x5d, 0x9f, 0xf2, 0xf2,
+  0xf2, 0xd7, 0x09, 0xf4, 0xf6, 0xbd, 0x19, 0x01, 0x74, 0x9c, 0x93, 0x31,
+  0xd2, 0x82, 0x51, 0x54, 0x54, 0xf9, 0xf9, 0x52, 0x04, 0xd0, 0xd0, 0xd5,
+  0x88, 0x1f, 0x99, 0x75, 0x71, 0xc3, 0x5f, 0xb1, 0x28, 0xe7, 0xd9, 0xe0,
+  0x34, 0x7a, 0x58, 0x58, 0x8f, 0x8f, 0x6b, 0x8f, 0x72, 0x72, 0x19, 0x7d,
+  0x0e, 0x3e, 0xc9, 0xcd, 0xbb, 0xbb, 0xd5, 0xd5, 0x57, 0x57, 0x31, 0xaa,
+  0xa4, 0xb4, 0x89, 0x63, 0xf7, 0xf7, 0x36, 0x9e, 0xba, 0xf5, 0x2d, 0x46,
+  0x48, 0x9c, 0x70, 0xcd, 0x49, 0xc9, 0x86, 0xf7, 0x6c, 0x96, 0xd9, 0xdb,
+  0xc7, 0xc0, 0x82, 0x10, 0x03, 0x4c, 0x88, 0x44, 0xb6, 0xf2, 0xf2, 0xc6,
+  0xc6, 0x9d, 0x56, 0x49, 0xb3, 0xae, 0x19, 0xf2, 0x84, 0xac, 0x27, 0xa4,
+  0xa4, 0xdb, 0xa1, 0xdc, 0xfb, 0x29, 0xd4, 0x35, 0xa6, 0x08, 0x6c, 0x58,
+  0x15, 0x15, 0xb8, 0xf8, 0xa2, 0x1e, 0x37, 0xa6, 0x40, 0x03, 0x02, 0xab,
+  0x00, 0x6b, 0x50, 0xf8, 0x1f, 0xc2, 0x35, 0x98, 0x90, 0xe4, 0xe4, 0xe4,
+  0x45, 0xc6, 0x72, 0x41, 0x69, 0x74, 0x93, 0x86, 0x78, 0x96, 0x70, 0x48,
+  0x65, 0xd1, 0xd1, 0x88, 0x66, 0x4f, 0xc9, 0x8c, 0x84, 0x14, 0xed, 0xe9,
+  0xa6, 0x35, 0x2f, 0x21, 0x80, 0xc2, 0x06, 0x06, 0xa3, 0xa3, 0xea, 0xc3,
+  0xa6, 0xa6, 0x6e, 0xc5, 0xd6, 0x7a, 0xef, 0xef, 0x79, 0xe6, 0x01, 0xad,
+  0xa3, 0xc1, 0x59, 0x77, 0x74, 0x51, 0x98, 0x8c, 0x37, 0xe2, 0x0e, 0x38,
+  0xde, 0xde, 0x2c, 0x60, 0x50, 0xf1, 0x6b, 0x09, 0xb2, 0xec, 0xee, 0x21,
+  0x7f, 0x98, 0x2e, 0xe3, 0xe9, 0x3c, 0x08, 0xbf, 0x4a, 0x34, 0x04, 0x2a,
+  0x34, 0x8c, 0xcb, 0x14, 0x9d, 0xe4, 0x54, 0x2e, 0xe3, 0xbc, 0x8b, 0x85,
+  0xc4, 0xb1, 0x11, 0x17, 0x18, 0x24, 0x24, 0x83, 0xe1, 0xdc, 0x2f, 0x7a,
+  0xfc, 0x44, 0x60, 0x10, 0x7d, 0x78, 0x86, 0xd9, 0x7e, 0x87, 0x42, 0xae,
+  0xf0, 0xf0, 0x71, 0x68, 0xd3, 0xcb, 0x44, 0x66, 0x7a, 0x02, 0x78, 0x4d,
+  0xb6, 0x98, 0x5c, 0x7a, 0xd0, 0x29, 0x76, 0xb7, 0xb8, 0x0a, 0x11, 0x02,
+  0x03, 0x2a, 0x51, 0xc8, 0x11, 0xf4, 0xe1, 0x4d, 0x4d, 0xb9, 0x70, 0x73,
+  0xe7, 0x01, 0x5c, 0xfb, 0x65, 0x95, 0x6b, 0x0e, 0x9b, 0xc4, 0x07, 0x07,
+  0xb7, 0x66, 0x4a, 0xad, 0x11, 0xa7, 0x1d, 0xd9, 0x4c, 0xb5, 0xad, 0x07,
+  0x9a, 0x9a, 0x68, 0xe0, 0xf2, 0x9d, 0xec, 0xb3, 0x60, 0xcf, 0x3d, 0x67,
+  0x4d, 0x00, 0xcb, 0xcb, 0x9a, 0x49, 0x0d, 0x0d, 0x67, 0xba, 0x6e, 0x65,
+  0x2e, 0xf9, 0x8b, 0xbb, 0xbb, 0x56, 0xb5, 0x8c, 0x2b, 0x21, 0xe0, 0x4f,
+  0x4c, 0x2e, 0xd5, 0xc4, 0x95, 0x41, 0xca, 0x4d, 0xcc, 0xb2, 0x57, 0x6c,
+  0xb3, 0x41, 0x63, 0x2f, 0xeb, 0xf9, 0x6d, 0x95, 0x95, 0x31, 0x5b, 0x9d,
+  0x0a, 0x00, 0x39, 0xe5, 0x8c, 0x8c, 0xd9, 0xc6, 0x4a, 0x41, 0x12, 0x23,
+  0x3c, 0x73, 0x78, 0xad, 0xc6, 0x44, 0xdc, 0x12, 0xdb, 0x1e, 0x33, 0x94,
+  0x62, 0xfb, 0x41, 0x71, 0x74, 0x0a, 0x43, 0xd3, 0x07, 0x4c, 0xbb, 0xa6,
+  0x0e, 0xc4, 0x12, 0xef, 0x51, 0x84, 0x83, 0x6b, 0x3f, 0xc0, 0xe9, 0xe6,
+  0x02, 0x08, 0xb2, 0x96, 0x7a, 0xe3, 0xc7, 0xdb, 0xbd, 0x31, 0xf1, 0xc7,
+  0x0a, 0x71, 0x71, 0x8a, 0x43, 0xdc, 0xa6, 0x87, 0xb5, 0x32, 0xeb, 0x1c,
+  0xd1, 0xf8, 0x91, 0x28, 0x2f, 0x2f, 0xfa, 0xf2, 0xe1, 0xc4, 0x3b, 0x74,
+  0xf3, 0x9b, 0xe9, 0x7a, 0x7a, 0xa2, 0x46, 0x89, 0x7f, 0x13, 0x15, 0x40,
+  0xa4, 0xdc, 0x3f, 0xd2, 0x90, 0x42, 0x0b, 0x18, 0x98, 0x83, 0x34, 0xe8,
+  0x13, 0xa5, 0x0f, 0x66, 0x4c, 0x4c, 0x7d, 0xc4, 0x04, 0xe5, 0xbb, 0xbb,
+  0xbb, 0x18, 0x35, 0x43, 0xb4, 0x09, 0xa7, 0xd6, 0xa6, 0x77, 0x80, 0x6f,
+  0x69, 0xf7, 0x82, 0x51, 0xd6, 0x10, 0x47, 0xcc, 0xe2, 0x06, 0x21, 0x09,
+  0x09, 0x74, 0x90, 0xa2, 0x22, 0xec, 0x2f, 0xdc, 0x9c, 0x39, 0x2e, 0xb3,
+  0x15, 0x47, 0x88, 0x88, 0x4d, 0x72, 0xf2, 0x2d, 0xe6, 0xf2, 0xf9, 0x93,
+  0x76, 0x4a, 0x63, 0x4e, 0x82, 0x9a, 0x8f, 0x3f, 0x8d, 0x4c, 0x2c, 0x77,
+  0x43, 0x1f, 0x2a, 0x1f, 0x22, 0xf1, 0x28, 0xa5, 0x64, 0x42, 0x46, 0xe7,
+  0x0a, 0x10, 0xb8, 0x3a, 0xf9, 0xd3, 0xcd, 0xa0, 0x72, 0x61, 0xab, 0xc4,
+  0xc7, 0xd3, 0x43, 0x66, 0x2d, 0xdc, 0x87, 0x7e, 0xc5, 0x9d, 0x0e, 0x7e,
+  0xe2, 0x63, 0xae, 0x20, 0xf5, 0x6b, 0xe2, 0x4c, 0xd4, 0x0b, 0x35, 0xe2,
+  0xc4, 0x3d, 0xe0, 0x2d, 0x07, 0x0f, 0x63, 0xda, 0x93, 0x6f, 0xac, 0x62,
+  0xee, 0x97, 0xbe, 0x87, 0xfc, 0x2a, 0x21, 0x58, 0xb4, 0x63, 0xc9, 0x07,
+  0x71, 0x5b, 0x21, 0xd0, 0x4c, 0x59, 0xe0, 0x26, 0x45, 0x42, 0x40, 0xa8,
+  0x1b, 0x6b, 0xa3, 0x3f, 0x96, 0x8b, 0x1c, 0x8b, 0x61, 0x4a, 0x2e, 0xfe,
+  0x1e, 0xf1, 0xf9, 0x4d, 0xc8, 0xd0, 0xff, 0xba, 0xeb, 0xe0, 0xdc, 0xc4,
+  0x65, 0x9e, 0x9e, 0x17, 0xde, 0x06, 0xb5, 0xbe, 0x95, 0xae, 0x2b, 0x52,
+  0x44, 0x6b, 0x33, 0x72, 0x7a, 0xe4, 0xfb, 0x0a, 0x34, 0x2f, 0xa7, 0xd0,
+  0x65, 0xb7, 0x44, 0x52, 0xfd, 0x72, 0x4f, 0xf5, 0xda, 0xf7, 0x6e, 0x79,
+  0x1d, 0x44, 0x64, 0xe5, 0xad, 0xb9, 0xc2, 0xab, 0x6c, 0x3d, 0x6d, 0x1d,
+  0xfd, 0xaf, 0x2a, 0x52, 0x41, 0x49, 0xd5, 0x36, 0x2e, 0x49, 0x6b, 0xa3,
+  0x0d, 0xb3, 0xb3, 0x05, 0x1b, 0xca, 0x9a, 0xf4, 0xc0, 0x2c, 0x9b, 0xa7,
+  0xcf, 0xd5, 0xb5, 0x2a, 0xf3, 0xbb, 0xbb, 0x47, 0xb6, 0x83, 0x2a, 0xd4,
+  0xc2, 0x97, 0x61, 0xad, 0x7d, 0xe6, 0x58, 0x85, 0x6b, 0xc9, 0x16, 0xe2,
+  0xbb, 0xa5, 0x50, 0x11, 0x99, 0xba, 0x55, 0x77, 0x86, 0x48, 0xc4, 0xc2,
+  0x1a, 0x0f, 0x9c, 0xcc, 0xcc, 0xac, 0x7f, 0xac, 0x84, 0x9b, 0x02, 0x7c,
+  0xbc, 0x4e, 0xa0, 0xb8, 0x81, 0x3f, 0x75, 0xd6, 0xef, 0xe1, 0x90, 0x83,
+  0x68, 0xb9, 0x2a, 0xe7, 0x67, 0x5d, 0x8d, 0x92, 0xc3, 0xb5, 0xd6, 0x35,
+  0x9e, 0x20, 0x91, 0xdb, 0x87, 0x05, 0x08, 0x25, 0xa4, 0x2f, 0x3a, 0xb6,
+  0x76, 0x4a, 0xac, 0xa6, 0x02, 0xd2, 0x0b, 0xc0, 0x45, 0xad, 0x3f, 0x94,
+  0x3e, 0x5e, 0xf1, 0xf4, 0xf4, 0x51, 0x21, 0x8f, 0xcf, 0x5d, 0x8b, 0xad,
+  0xe9, 0x63, 0x40, 0x60, 0x0f, 0xd4, 0xe8, 0x03, 0xa4, 0x45, 0x9a, 0x86,
+  0x86, 0x03, 0xf0, 0x18, 0xe7, 0x26, 0x17, 0x62, 0x89, 0x81, 0xcb, 0x79,
+  0x38, 0x38, 0x32, 0xbd, 0xd2, 0x47, 0x47, 0xac, 0x23, 0x4a, 0x8f, 0x8f,
+  0xbf, 0xd1, 0x78, 0x8c, 0x31, 0xa0, 0x83, 0x40, 0x60, 0xe6, 0x32, 0x80,
+  0x59, 0x0c, 0x96, 0x96, 0xf4, 0x49, 0x61, 0x4e, 0xfb, 0x92, 0x80, 0xc7,
+  0x17, 0xdd, 0x68, 0x3e, 0xb7, 0xb6, 0xe2, 0x7f, 0x1a, 0xa9, 0x8d, 0x9e,
+  0xfd, 0x95, 0x70, 0x3f, 0x64, 0x22, 0x25, 0x70, 0xe2, 0x80, 0x5d, 0x8a,
+  0x97, 0xa7, 0x35, 0xc4, 0xf3, 0x79, 0x0e, 0x55, 0x9b, 0x7c, 0x21, 0x21,
+  0xfc, 0x39, 0xba, 0x3f, 0x78, 0x60, 0xa6, 0x8b, 0x14, 0xd6, 0x0f, 0xb5,
+  0xe9, 0x17, 0x35, 0x7a, 0xa3, 0x0e, 0x5a, 0x4e, 0x4d, 0xb3, 0xb5, 0x47,
+  0x9a, 0x3c, 0x3c, 0x33, 0x9b, 0x2a, 0xdc, 0xd2, 0x23, 0xe8, 0x7b, 0xe7,
+  0x32, 0x6f, 0x61, 0x69, 0xa6, 0xd1, 0x46, 0xda, 0xc9, 0x1f, 0x32, 0xd9,
+  0x44, 0x18, 0x89, 0x9b, 0x65, 0xf9, 0x94, 0x3e, 0x53, 0x1a, 0x68, 0x03,
+  0x36, 0x1f, 0x73, 0x98, 0xeb, 0xfe, 0x65, 0x76, 0xf9, 0x9c, 0xaa, 0xed,
+  0xe8, 0x0f, 0x70, 0x0d, 0x71, 0x00, 0x5c, 0xd3, 0x42, 0x4e, 0xec, 0xe5,
+  0xaf, 0x03, 0xef, 0x1d, 0x40, 0x58, 0x48, 0xa2, 0x95, 0x36, 0x7d, 0x8d,
+  0x26, 0xac, 0x79, 0x89, 0xce, 0xcd, 0x34, 0x53, 0x34, 0x21, 0xea, 0x7f,
+  0x6f, 0x95, 0xca, 0x56, 0xe3, 0x5d, 0xac, 0xcd, 0xa9, 0x61, 0xc5, 0x40,
+  0x92, 0x36, 0x12, 0x6a, 0xe6, 0x97, 0xf6, 0x5b, 0xbb, 0x5f, 0xd9, 0x7a,
+  0xd4, 0xa6, 0xfe, 0x4e, 0xf2, 0x2e, 0xf3, 0x2e, 0x9e, 0x06, 0xec, 0x6f,
+  0xd4, 0xe2, 0xcb, 0x7a, 0xb3, 0x62, 0x94, 0x3c, 0xf6, 0x92, 0xfb, 0xe4,
+  0x75, 0x9b, 0x20, 0x9d, 0x66, 0x2a, 0x8d, 0x63, 0x75, 0x54, 0x1d, 0x0a,
+  0x8d, 0xf4, 0xec, 0x9a, 0xbf, 0x1a, 0xbf, 0x87, 0x89, 0xf4, 0xc4, 0x71,
+  0xf1, 0x44, 0x7f, 0x34, 0x63, 0x72, 0x22, 0xc7, 0x89, 0xbe, 0x2b, 0x5a,
+  0x56, 0xeb, 0x50, 0x1d, 0x12, 0xbf, 0xe8, 0xc3, 0x47, 0xb6, 0xa0, 0xe9,
+  0x41, 0x5e, 0x43, 0x3b, 0x03, 0x48, 0xd6, 0xce, 0x29, 0xa0, 0x91, 0xdf,
+  0x1f, 0x6d, 0xa3, 0xa8, 0x82, 0x26, 0x5a, 0x42, 0xe3, 0xa0, 0x8b, 0x9c,
+  0xd7, 0x55, 0xfe, 0xb4, 0xa7, 0x36, 0x71, 0x16, 0x7a, 0xf5, 0x66, 0xde,
+  0x7f, 0x03, 0xa2, 0xa5, 0x2b, 0x3e, 0xd5, 0x55, 0xc4, 0x93, 0x51, 0x37,
+  0x1d, 0x1a, 0x38, 0x64, 0x90, 0x68, 0x33, 0x3f, 0x45, 0x8e, 0x8c, 0xb0,
+  0xf2, 0x06, 0xf0, 0x81, 0x1c, 0xd2, 0x3c, 0x8a, 0xe4, 0x64, 0xe8, 0x34,
+  0xc7, 0x5f, 0x05, 0x35, 0x41, 0x7e, 0x10, 0x76, 0xa1, 0x78, 0xef, 0x93,
+  0x9a, 0xdd, 0xde, 0x8f, 0xce, 0xe2, 0xc4, 0x6d, 0xfa, 0x12, 0x53, 0x21,
+  0x61, 0x51, 0x64, 0x3c, 0xf1, 0x53, 0x9d, 0xc1, 0xe4, 0xd0, 0x59, 0xca,
+  0xd0, 0xce, 0x3e, 0x68, 0x15, 0xb3, 0xbb, 0xed, 0x18, 0xa6, 0x1a, 0x81,
+  0xc9, 0x59, 0x80, 0x9c, 0xe0, 0xf7, 0x31, 0x19, 0x09, 0x84, 0xb0, 0x12,
+  0x37, 0x89, 0x9b, 0x33, 0x2f, 0xaa, 0x7e, 0xa7, 0xcb, 0x9b, 0x48, 0xda,
+  0xab, 0x99, 0xf1, 0x0b, 0xd3, 0x31, 0xa8, 0xfc, 0xb4, 0x5a, 0x70, 0x8f,
+  0x9a, 0x66, 0xc2, 0x34, 0xf6, 0x76, 0x9a, 0x5c, 0x78, 0xcc, 0xb3, 0xfd,
+  0x75, 0xe0, 0x41, 0xe5, 0x0e, 0xce, 0xe7, 0x7b, 0x65, 0xfe, 0xaa, 0x3a,
+  0x85, 0xc3, 0x2d, 0xd8, 0xd9, 0x05, 0x21, 0xdd, 0x5f, 0xbd, 0x79, 0x0f,
+  0x95, 0x8e, 0x6f, 0x98, 0xa9, 0xce, 0xd1, 0xeb, 0x9e, 0x1c, 0xcb, 0xb3,
+  0xef, 0xe2, 0x0b, 0x42, 0xb5, 0xf4, 0xc0, 0x10, 0x38, 0x38, 0x94, 0x0e,
+  0x91, 0x3b, 0x38, 0x95, 0xa8, 0xaf, 0x25, 0x78, 0x29, 0x89, 0x9b, 0xe2,
+  0x5f, 0x01, 0xff, 0x3b, 0x45, 0x1c, 0xf0, 0xe9, 0xcf, 0x4f, 0x08, 0xa5,
+  0xd0, 0x5a, 0x1c, 0x36, 0x36, 0x7f, 0x6a, 0x89, 0x39, 0x54, 0xc7, 0x69,
+  0x2f, 0x38, 0x8c, 0xfe, 0x1f, 0xca, 0xe6, 0x6b, 0xf7, 0xbb, 0xd5, 0x9e,
+  0xaa, 0x10, 0x31, 0xfa, 0x4a, 0xc4, 0x5e, 0x2d, 0xf8, 0xad, 0xa3, 0x0a,
+  0xd0, 0x57, 0xeb, 0xbd, 0x93, 0xf0, 0x87, 0x3d, 0xd7, 0x95, 0xd1, 0x44,
+  0x20, 0x80, 0x30, 0xac, 0x26, 0x74, 0x18, 0xd0, 0xba, 0xf3, 0x73, 0x10,
+  0xb0, 0xb2, 0xf4, 0x63, 0x4b, 0x5b, 0x1d, 0x83, 0x1f, 0x01, 0xbf, 0xbf,
+  0x92, 0xa0, 0x90, 0x65, 0x47, 0xba, 0x32, 0x1e, 0x22, 0xd5, 0xe5, 0x73,
+  0x51, 0xf3, 0x58, 0x70, 0xc8, 0xe6, 0x3f, 0xe4, 0x05, 0xb4, 0x86, 0x73,
+  0xf0, 0xd2, 0x62, 0xda, 0x03, 0x91, 0xa5, 0xd6, 0xbc, 0x44, 0x9c, 0x7c,
+  0x7c, 0x40, 0xfe, 0x4d, 0x44, 0x40, 0x03, 0xd1, 0x64, 0x04, 0xdc, 0x99,
+  0x8b, 0xff, 0xa3, 0x25, 0xf7, 0xaa, 0xeb, 0x58, 0x69, 0x61, 0x62, 0xb4,
+  0x66, 0xd0, 0x62, 0xd9, 0x32, 0x95, 0xfd, 0xa7, 0xc7, 0x8b, 0x60, 0x81,
+  0xd2, 0x9e, 0x6d, 0x18, 0x8f, 0x46, 0xf4, 0xfd, 0x5c, 0xcb, 0x58, 0xff,
+  0xff, 0x7d, 0x81, 0x36, 0x72, 0xff, 0xd2, 0x10, 0x39, 0x70, 0x09, 0xff,
+  0xd6, 0xb2, 0xb0, 0x01, 0xd4, 0xaf, 0xbf, 0x1d, 0x65, 0x8e, 0x8e, 0x6a,
+  0x24, 0xf3, 0x4b, 0x1a, 0x01, 0x5c, 0xd1, 0x2a, 0xbf, 0x2d, 0x3d, 0xcb,
+  0x41, 0xb4, 0x2a, 0xbb, 0xae, 0xbd, 0x1d, 0xae, 0xf6, 0xc3, 0x82, 0xc9,
+  0xe5, 0x7e, 0x2b, 0xac, 0xc0, 0x66, 0x54, 0xfa, 0x64, 0x4f, 0xf3, 0x46,
+  0xd9, 0x7a, 0xe9, 0x37, 0x25, 0xe5, 0xad, 0x9a, 0x08, 0x08, 0xaa, 0x6e,
+  0x13, 0x8e, 0xfa, 0x9a, 0xcb, 0x4e, 0x86, 0x24, 0x2f, 0x4a, 0x0c, 0x49,
+  0x9d, 0x78, 0x3a, 0xbd, 0xd9, 0x37, 0xc9, 0x2f, 0x70, 0x40, 0x72, 0xaa,
+  0x80, 0x38, 0xfc, 0xec, 0xe3, 0x7b, 0x7b, 0x82, 0xd4, 0xee, 0x8a, 0x4e,
+  0xea, 0xea, 0x1f, 0x15, 0x01, 0x41, 0x0c, 0x28, 0x14, 0xb3, 0xe2, 0x9f,
+  0x46, 0x28, 0x22, 0x4c, 0xb7, 0xf4, 0xd2, 0x69, 0xb9, 0xa6, 0x1c, 0xad,
+  0xad, 0x44, 0xbb, 0xed, 0xe6, 0x63, 0x19, 0x57, 0xb6, 0x57, 0x42, 0x25,
+  0x0a, 0x21, 0xb0, 0x83, 0x68, 0x3a, 0x91, 0x74, 0xef, 0x76, 0x2f, 0x4a,
+  0xa4, 0x5a, 0x06, 0xcd, 0x1f, 0xc8, 0xbd, 0x2f, 0x1d, 0x33, 0x04, 0xe3,
+  0xf8, 0xb0, 0xc2, 0x97, 0x1d, 0x1d, 0x10, 0xcd, 0x3a, 0x02, 0x8f, 0x7e,
+  0xe6, 0x4c, 0xa9, 0xde, 0xf0, 0x5b, 0x85, 0xc5, 0x4f, 0x4f, 0x4a, 0x5b,
+  0xce, 0x13, 0x51, 0xc6, 0x31, 0x70, 0x54, 0xe0, 0x11, 0xcb, 0x08, 0xe5,
+  0x1f, 0x81, 0x4d, 0x87, 0x12, 0x5d, 0xeb, 0xf3, 0x70, 0xa1, 0xe2, 0x0a,
+  0x98, 0x17, 0x89, 0xfe, 0xfe, 0xb5, 0x1c, 0x9b, 0x61, 0xc4, 0x8a, 0x8a,
+  0x0d, 0x8f, 0x5b, 0x3e, 0xaf, 0xaf, 0x4d, 0x1c, 0x59, 0xdb, 0x3c, 0x01,
+  0x74, 0x74, 0x3f, 0xe4, 0x39, 0xa0, 0xdc, 0x81, 0x5f, 0xe7, 0x38, 0xdc,
+  0xb4, 0x31, 0x31, 0xab, 0x4a, 0xe0, 0xc3, 0xc0, 0xc0, 0xc5, 0xed, 0x70,
+  0xeb, 0xb6, 0x77, 0x6b, 0xe3, 0xe9, 0x3b, 0x22, 0xd9, 0x46, 0x9a, 0x54,
+  0x6b, 0x88, 0x83, 0x36, 0xf8, 0x17, 0x17, 0xc1, 0x81, 0xb8, 0xf8, 0x13,
+  0xd1, 0x1c, 0x9e, 0xfe, 0x77, 0xb4, 0x12, 0xad, 0xd5, 0xd5, 0xe5, 0x5b,
+  0x6d, 0x7f, 0x92, 0xa7, 0x31, 0x53, 0xd2, 0x80, 0xdc, 0xaf, 0xc2, 0x38,
+  0x0f, 0xb9, 0x26, 0x61, 0xfe, 0x23, 0x94, 0xdb, 0x62, 0x55, 0xae, 0xcd,
+  0x39, 0x0c, 0x65, 0x60, 0x56, 0xc8, 0x60, 0x80, 0x96, 0xcd, 0xc0, 0x34,
+  0x6d, 0xd7, 0xe9, 0x15, 0x0b, 0xfa, 0x1c, 0x61, 0x56, 0x0c, 0x9c, 0x8c,
+  0x01, 0xc8, 0x3e, 0x3e, 0x0c, 0x0e, 0x7f, 0x1f, 0x53, 0x7a, 0xbd, 0xaa,
+  0x72, 0xc6, 0x28, 0x38, 0xeb, 0xba, 0x9a, 0xa9, 0x3c, 0x46, 0x61, 0x1e,
+  0xd8, 0x29, 0x54, 0xd7, 0x1c, 0x4f, 0x6a, 0x8d, 0x21, 0xfc, 0xc4, 0x78,
+  0xb8, 0x17, 0x07, 0x72, 0x24, 0x3c, 0xfe, 0xee, 0x6e, 0xf1, 0x0e, 0x78,
+  0xff, 0x95, 0xcb, 0x3f, 0x75, 0x25, 0xa5, 0x25, 0x45, 0xa4, 0x78, 0x9c,
+  0x4a, 0x5f, 0x5f, 0x85, 0x27, 0xb0, 0x4d, 0xef, 0xa8, 0xbf, 0x86, 0xf7,
+  0x8c, 0x46, 0x11, 0x80, 0x1d, 0x20, 0x1c, 0x7f, 0xc2, 0xf9, 0x3a, 0x17,
+  0x48, 0xe3, 0x84, 0xae, 0x38, 0x30, 0x3c, 0x05, 0x31, 0x65, 0xee, 0xa8,
+  0x8d, 0x9b, 0xb7, 0xfb, 0x37, 0x34, 0x0e, 0xd9, 0x0f, 0x40, 0xa4, 0x05,
+  0x31, 0x99, 0x67, 0xbe, 0x51, 0xf3, 0x7f, 0xe7, 0xd1, 0x23, 0xfc, 0x5c,
+  0xa2, 0x6a, 0x31, 0xd2, 0x70, 0xbf, 0x6e, 0xdf, 0x01, 0xda, 0xc1, 0xf2,
+  0x63, 0x8e, 0x8e, 0x20, 0xca, 0xf3, 0x8d, 0xe4, 0xe3, 0x23, 0x9d, 0x72,
+  0xe4, 0x24, 0x50, 0xc3, 0xc6, 0x31, 0xdb, 0xe0, 0xb0, 0xa4, 0xa1, 0x43,
+  0x08, 0x56, 0xe2, 0x28, 0x9a, 0x99, 0xcb, 0xce, 0x66, 0x7f, 0x04, 0x40,
+  0xdb, 0x10, 0x10, 0x43, 0x29, 0xc9, 0x55, 0x16, 0x95, 0xcf, 0x17, 0x12,
+  0x82, 0x15, 0x7f, 0x92, 0x36, 0xbe, 0x0d, 0x6d, 0xa2, 0x2f, 0xbd, 0xc8,
+  0x34, 0xd3, 0xef, 0xae, 0x85, 0x63, 0xff, 0xcc, 0x55, 0x47, 0x50, 0x36,
+  0x6e, 0x59, 0x4c, 0xe0, 0xd0, 0xe6, 0x8e, 0xab, 0xe9, 0xf8, 0x7a, 0x66,
+  0xb9, 0x33, 0x95, 0x0c, 0xfb, 0xc7, 0x10, 0x91, 0x91, 0x74, 0x97, 0xbe,
+  0x9e, 0x4e, 0xe2, 0x39, 0x16, 0x2f, 0xf2, 0xf2, 0xcc, 0xd9, 0xe7, 0xd7,
+  0xde, 0x7b, 0x56, 0x29, 0x74, 0xf0, 0x98, 0x89, 0x44, 0x0d, 0x7e, 0x68,
+  0x0b, 0xb3, 0xe0, 0x98, 0x6f, 0x2a, 0xbd, 0x89, 0xbb, 0x15, 0x05, 0x00,
+  0x00, 0x4d, 0x4b, 0xa6, 0xde, 0x33, 0x05, 0x84, 0x88, 0x2d, 0x8e, 0x8c,
+  0x9d, 0x6c, 0xc0, 0xac, 0x7d, 0x1e, 0xe9, 0xfd, 0xdd, 0xa1, 0x8c, 0x4d,
+  0x70, 0x42, 0xc7, 0x4c, 0x2b, 0x3c, 0xda, 0xb9, 0x7d, 0x11, 0x4f, 0xde,
+  0xf7, 0xb5, 0x22, 0xc8, 0x3f, 0x70, 0x1f, 0x3b, 0xac, 0xb4, 0x13, 0x26,
+  0x7f, 0x41, 0xeb, 0x30, 0xab, 0xe3, 0xde, 0xea, 0x74, 0x6a, 0x71, 0x71,
+  0xa7, 0xa2, 0xa2, 0xd6, 0x79, 0x7e, 0xa7, 0x16, 0x9d, 0x42, 0x18, 0x55,
+  0xe8, 0x52, 0xe9, 0xc9, 0x35, 0x57, 0xb1, 0xfc, 0x21, 0xe2, 0x43, 0x5e,
+  0xa4, 0x33, 0x6f, 0xbd, 0xba, 0x36, 0xf7, 0xae, 0xbd, 0xb5, 0xcf, 0x41,
+  0x2d, 0x90, 0xf5, 0x09, 0x8c, 0x7d, 0x39, 0x98, 0x61, 0x43, 0xd7, 0x19,
+  0xa4, 0xa1, 0x3d, 0x30, 0x0a, 0xa3, 0x9c, 0x8e, 0xff, 0x38, 0x9c, 0xf5,
+  0x1c, 0x62, 0x38, 0x38, 0x40, 0x40, 0xfc, 0x41, 0x6c, 0x2f, 0x6f, 0x43,
+  0xb3, 0xb5, 0xde, 0x6a, 0xfd, 0x92, 0xc3, 0xe2, 0x37, 0x01, 0x1f, 0xdf,
+  0x4e, 0x0b, 0xbb, 0xc7, 0xe6, 0xf9, 0xb2, 0xd4, 0xf9, 0x56, 0x35, 0xe2,
+  0x94, 0xaa, 0x07, 0xf4, 0x42, 0x04, 0x04, 0x72, 0x5a, 0x32, 0xa8, 0xc7,
+  0x55, 0x4b, 0xe0, 0x75, 0xbe, 0x28, 0xf3, 0x01, 0xbf, 0x28, 0x86, 0x12,
+  0x75, 0x57, 0xf9, 0xf9, 0xdf, 0x71, 0xa1, 0xc0, 0x48, 0x7e, 0xcc, 0xac,
+  0x08, 0x1d, 0x53, 0x00, 0xa0, 0x52, 0xf5, 0xc7, 0xaa, 0xf0, 0x17, 0x95,
+  0x23, 0x6f, 0xa4, 0x03, 0xa8, 0x0f, 0x66, 0xc3, 0x5d, 0xc8, 0x3b, 0xba,
+  0x71, 0x5d, 0xec, 0x55, 0x66, 0x54, 0x08, 0x72, 0x20, 0xe9, 0xb5, 0xe9,
+  0xf3, 0xc7, 0xca, 0x56, 0x97, 0x48, 0x6a, 0x19, 0x71, 0x29, 0xbf, 0x54,
+  0x98, 0xe5, 0xec, 0x25, 0xbe, 0xe8, 0xe8, 0x74, 0xe6, 0x98, 0x46, 0x1c,
+  0x0a, 0xdc, 0x68, 0x08, 0xd7, 0xdf, 0xd8, 0xdd, 0x7a, 0x66, 0xb5, 0xb5,
+  0x69, 0xec, 0xa6, 0x8a, 0xae, 0xcf, 0x1e, 0x39, 0x72, 0x7f, 0x1b, 0x8b,
+  0xec, 0xcc, 0xa8, 0x66, 0x0c, 0x38, 0xf0, 0x9d, 0x48, 0x43, 0x1a, 0x49,
+  0x60, 0x1f, 0xe7, 0x9d, 0xeb, 0xcc, 0x38, 0x5e, 0xfd, 0x23, 0x00, 0xfa,
+  0x4a, 0xd0, 0x35, 0x23, 0xbf, 0x91, 0x68, 0xb1, 0x2f, 0xb1, 0x55, 0x5b,
+  0xe0, 0xe8, 0x7d, 0x82, 0xc0, 0xfe, 0x9e, 0xf4, 0x9e, 0xfa, 0xa3, 0xc9,
+  0x0b, 0x50, 0xcb, 0x21, 0xc7, 0xc7, 0xc7, 0xc7, 0x57, 0x7f, 0x4c, 0xf2,
+  0x8d, 0xb0, 0x74, 0x3f, 0xb5, 0x6b, 0xce, 0xe2, 0x77, 0x74, 0x97, 0x9f,
+  0x80, 0x52, 0x2e, 0x1a, 0x28, 0xbb, 0xee, 0x2e, 0x31, 0x05, 0x0d, 0x87,
+  0x9e, 0x57, 0x02, 0x0c, 0xd5, 0x94, 0xdd, 0x4b, 0xd7, 0x22, 0x22, 0x77,
+  0xa3, 0x09, 0x74, 0x27, 0x73, 0x9e, 0xc2, 0xc4, 0xb8, 0xcb, 0xbb, 0x0b,
+  0xe6, 0x56, 0x9c, 0x68, 0x6f, 0xa0, 0x1f, 0x9a, 0x9a, 0x40, 0xe0, 0x3c,
+  0x3c, 0x30, 0x4e, 0x9b, 0x1a, 0xfc, 0xcc, 0x83, 0xca, 0x3a, 0x14, 0xa2,
+  0x6a, 0x95, 0xc4, 0x1a, 0x3b, 0x4d, 0xf1, 0x2c, 0x2c, 0xec, 0x1b, 0xda,
+  0x70, 0x88, 0x37, 0x25, 0xe5, 0xfd, 0x9d, 0x37, 0x8a, 0x28, 0xf8, 0x30,
+  0xa7, 0x5f, 0xd6, 0x54, 0x8c, 0x0f, 0xba, 0x19, 0x19, 0x92, 0xc6, 0x6e,
+  0xe2, 0xc1, 0x66, 0x4f, 0xa0, 0x44, 0xb1, 0x7c, 0x6a, 0x83, 0xa0, 0xf5,
+  0x13, 0x74, 0x2f, 0xef, 0x3a, 0xce, 0x52, 0x3e, 0x78, 0x40, 0x12, 0x47,
+  0xb3, 0xc7, 0xfd, 0x6b, 0xa6, 0x34, 0xef, 0x22, 0x8a, 0xf1, 0x4a, 0x53,
+  0x48, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x46, 0x00, 0x8a, 0x00,
+  0xcf, 0x00, 0x00, 0x00, 0x46, 0x00, 0x8c, 0x00, 0xd0, 0x00, 0x14, 0x01,
+  0x59, 0x01, 0x9e, 0x01, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x11, 0x00,
+  0x17, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x12, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x0d, 0x00, 0x15, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x22, 0x00, 0x2c, 0x00, 0x34, 0x00, 0x3c, 0x00, 0x42, 0x00,
+  0x52, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x11, 0x00, 0x22, 0x00,
+  0x32, 0x00, 0x42, 0x00, 0x52, 0x00, 0x62, 0x00, 0x6b, 0x00, 0x74, 0x00,
+  0x7c, 0x00, 0x85, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x18, 0x00, 0x20, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x1e, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x19, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x06, 0x00,
+  0x0d, 0x00, 0x00, 0x00, 0x30, 0x00, 0x39, 0x00, 0x41, 0x00, 0x4b, 0x00,
+  0x54, 0x00, 0x5d, 0x00, 0x66, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x18, 0x00,
+  0x21, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x12, 0x00, 0x19, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x29, 0x00, 0x3b, 0x00,
+  0x4d, 0x00, 0x5f, 0x00, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x22, 0x00, 0x36, 0x00,
+  0x48, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x10, 0x00, 0x16, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x19, 0x00, 0x27, 0x00, 0x30, 0x00, 0x3e, 0x00, 0x47, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x24, 0x00, 0x37, 0x00, 0x4a, 0x00, 0x5d, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x22, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x26, 0x00, 0x49, 0x00, 0x71, 0x00, 0x91, 0x00, 0xa3, 0x00,
+  0xbc, 0x00, 0xd5, 0x00, 0xf9, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x14, 0x00,
+  0x1e, 0x00, 0x00, 0x00, 0x25, 0x00, 0x47, 0x00, 0x6e, 0x00, 0x8d, 0x00,
+  0xa5, 0x00, 0xbd, 0x00, 0xd5, 0x00, 0xe9, 0x00, 0xf0, 0x00, 0xf9, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x1b, 0x00, 0x25, 0x00, 0x2e, 0x00, 0x38, 0x00,
+  0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x19, 0x00, 0x2b, 0x00, 0x3d, 0x00, 0x4f, 0x00, 0x61, 0x00, 0x73, 0x00,
+  0x85, 0x00, 0x8f, 0x00, 0x99, 0x00, 0xa2, 0x00, 0xac, 0x00, 0xb5, 0x00,
+  0xbf, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x15, 0x00, 0x21, 0x00,
+  0x00, 0x00, 0x2c, 0x00, 0x50, 0x00, 0x6e, 0x00, 0x98, 0x00, 0xb5, 0x00,
+  0xc9, 0x00, 0xe5, 0x00, 0xf1, 0x00, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x2b, 0x00, 0x4e, 0x00, 0x6a, 0x00, 0x93, 0x00, 0xaf, 0x00, 0xc3, 0x00,
+  0xde, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x19, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x25, 0x00, 0x38, 0x00, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x13, 0x00, 0x1a, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x25, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x21, 0x00,
+  0x42, 0x00, 0x5e, 0x00, 0x80, 0x00, 0x9b, 0x00, 0xb1, 0x00, 0xce, 0x00,
+  0xec, 0x00, 0xfa, 0x00, 0x02, 0x01, 0x00, 0x00, 0x25, 0x00, 0x46, 0x00,
+  0x58, 0x00, 0x00, 0x00, 0x20, 0x00, 0x40, 0x00, 0x5b, 0x00, 0x7b, 0x00,
+  0x95, 0x00, 0xab, 0x00, 0xc7, 0x00, 0xe7, 0x00, 0xf9, 0x00, 0x0b, 0x01,
+  0x14, 0x01, 0x1d, 0x01, 0x26, 0x01, 0x00, 0x00, 0x20, 0x00, 0x3d, 0x00,
+  0x58, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x3d, 0x00,
+  0x5b, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x40, 0x00,
+  0x53, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x3d, 0x00, 0x4a, 0x00, 0x00, 0x00,
+  0x21, 0x00, 0x00, 0x00, 0x20, 0x00, 0x3b, 0x00, 0x44, 0x00, 0x53, 0x00,
+  0x5c, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1f, 0x00, 0x2e, 0x00, 0x35, 0x00, 0x3b, 0x00, 0x41, 0x00, 0x00, 0x00,
+  0x1a, 0x00, 0x00, 0x00, 0x20, 0x00, 0x44, 0x00, 0x00, 0x00, 0x2b, 0x00,
+  0x4f, 0x00, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x4d, 0x00,
+  0x66, 0x00, 0x90, 0x00, 0xad, 0x00, 0xcf, 0x00, 0x00, 0x00, 0x1b, 0x00,
+  0x3a, 0x00, 0x42, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x3c, 0x00, 0x00, 0x00,
+  0x33, 0x00, 0x56, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x20, 0x00,
+  0x47, 0x00, 0x62, 0x00, 0x80, 0x00, 0x9a, 0x00, 0xac, 0x00, 0x00, 0x00,
+  0x1d, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x07, 0x00, 0x0e, 0x00,
+  0x15, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0d, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x38, 0x00, 0x45, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x38, 0x00, 0x5a, 0x00, 0x70, 0x00, 0x77, 0x00, 0x7e, 0x00,
+  0x85, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x41, 0x00, 0x63, 0x00, 0x7a, 0x00,
+  0x84, 0x00, 0x8e, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x3e, 0x00, 0x5a, 0x00,
+  0x6c, 0x00, 0x7e, 0x00, 0x91, 0x00, 0x9a, 0x00, 0xa3, 0x00, 0xac, 0x00,
+  0xb5, 0x00, 0xbe, 0x00, 0xc7, 0x00, 0xd0, 0x00, 0x00, 0x00, 0x27, 0x00,
+  0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x3d, 0x00, 0x5b, 0x00,
+  0x00, 0x00, 0x1b, 0x00, 0x39, 0x00, 0x49, 0x00, 0x5f, 0x00, 0x72, 0x00,
+  0x84, 0x00, 0x99, 0x00, 0x00, 0x00, 0x25, 0x00, 0x38, 0x00, 0x4b, 0x00,
+  0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x3b, 0x00, 0x59, 0x00,
+  0x7c, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x39, 0x00, 0x5a, 0x00, 0x00, 0x00,
+  0x21, 0x00, 0x00, 0x00, 0x24, 0x00, 0x44, 0x00, 0x00, 0x00, 0x1e, 0x00,
+  0x3b, 0x00, 0x6a, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x3d, 0x00, 0x5f, 0x00,
+  0x00, 0x00, 0x22, 0x00, 0x3f, 0x00, 0x51, 0x00, 0x63, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x40, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x34, 0x00,
+  0x00, 0x00, 0x1f, 0x00, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x00,
+  0x3b, 0x00, 0x57, 0x00, 0x74, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00,
+  0x1d, 0x00, 0x2c, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00,
+  0x49, 0x00, 0x67, 0x00, 0x8c, 0x00, 0x9c, 0x00, 0x00, 0x00, 0x24, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x1f, 0x00, 0x29, 0x00, 0x00, 0x00, 0x07, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x1c, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x2a, 0x00,
+  0x3b, 0x00, 0x00, 0x00, 0x12, 0x00, 0x31, 0x00, 0x4d, 0x00, 0x56, 0x00,
+  0x5f, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x23, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x1c, 0x00, 0x2a, 0x00, 0x38, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x06, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x21, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00,
+  0x1d, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x17, 0x00, 0x21, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x22, 0x00, 0x30, 0x00, 0x3d, 0x00, 0x4e, 0x00, 0x5a, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x1d, 0x00,
+  0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x17, 0x00, 0x00, 0x00, 0x14, 0x00, 0x28, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x18, 0x00, 0x1f, 0x00, 0x26, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x14, 0x00, 0x1d, 0x00, 0x26, 0x00,
+  0x2f, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1c, 0x00, 0x2a, 0x00, 0x38, 0x00,
+  0x45, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x1d, 0x00, 0x24, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x1c, 0x00, 0x2d, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1f, 0x00, 0x2f, 0x00,
+  0x3f, 0x00, 0x4f, 0x00, 0x5e, 0x00, 0x69, 0x00, 0x71, 0x00, 0x79, 0x00,
+  0x81, 0x00, 0x89, 0x00, 0x91, 0x00, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x10, 0x00, 0x20, 0x00, 0x30, 0x00,
+  0x40, 0x00, 0x4b, 0x00, 0x53, 0x00, 0x5b, 0x00, 0x63, 0x00, 0x00, 0x00,
+  0x18, 0x00, 0x22, 0x00, 0x2c, 0x00, 0x36, 0x00, 0x00, 0x00, 0x2b, 0x00,
+  0x31, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x13, 0x00, 0x26, 0x00,
+  0x00, 0x00, 0x1f, 0x00, 0x51, 0x00, 0x5b, 0x00, 0x64, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x18, 0x00, 0x20, 0x00, 0x28, 0x00, 0x00, 0x00, 0x11, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00,
+  0x00, 0x00, 0x23, 0x00, 0x35, 0x00, 0x3d, 0x00, 0x44, 0x00, 0x00, 0x00,
+  0x26, 0x00, 0x00, 0x00, 0x27, 0x00, 0x37, 0x00, 0x47, 0x00, 0x57, 0x00,
+  0x67, 0x00, 0x77, 0x00, 0x7e, 0x00, 0x86, 0x00, 0x8e, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0b, 0x00, 0x11, 0x00, 0x00, 0x00, 0x07, 0x00, 0x0f, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x20, 0x00, 0x2e, 0x00, 0x37, 0x00, 0x00, 0x00,
+  0x29, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x26, 0x00, 0x39, 0x00, 0x4d, 0x00, 0x61, 0x00, 0x74, 0x00,
+  0x84, 0x00, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x20, 0x00, 0x26, 0x00, 0x00, 0x00, 0x28, 0x00,
+  0x00, 0x00, 0x28, 0x00, 0x2f, 0x00, 0x36, 0x00, 0x3c, 0x00, 0x43, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x21, 0x00, 0x29, 0x00,
+  0x32, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x00,
+  0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x23, 0x00, 0x3c, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x18, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x13, 0x00,
+  0x23, 0x00, 0x2a, 0x00, 0x30, 0x00, 0x43, 0x00, 0x56, 0x00, 0x5f, 0x00,
+  0x68, 0x00, 0x70, 0x00, 0x76, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00,
+  0x1c, 0x00, 0x25, 0x00, 0x2e, 0x00, 0x35, 0x00, 0x48, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x17, 0x00, 0x1f, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x15, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x11, 0x00, 0x23, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x00, 0x12, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x12, 0x00, 0x1b, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x26, 0x00, 0x38, 0x00, 0x42, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x24, 0x00, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0f, 0x00, 0x1b, 0x00, 0x00, 0x00,
+  0x15, 0x00, 0x28, 0x00, 0x34, 0x00, 0x00, 0x00, 0x10, 0x00, 0x1f, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x12, 0x00, 0x1c, 0x00, 0x25, 0x00, 0x00, 0x00, 0x0a, 0x00,
+  0x1b, 0x00, 0x00, 0x00, 0x13, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x14, 0x00,
+  0x1b, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x1b, 0x00, 0x2a, 0x00, 0x33, 0x00, 0x3d, 0x00, 0x46, 0x00, 0x4f, 0x00,
+  0x58, 0x00, 0x61, 0x00, 0x6a, 0x00, 0x73, 0x00, 0x7c, 0x00, 0x85, 0x00,
+  0x8e, 0x00, 0x97, 0x00, 0xa0, 0x00, 0xa9, 0x00, 0x00, 0x00, 0x19, 0x00,
+  0x2d, 0x00, 0x39, 0x00, 0x3f, 0x00, 0x49, 0x00, 0x5c, 0x00, 0x62, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x1d, 0x00, 0x2a, 0x00, 0x39, 0x00,
+  0x41, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x34, 0x00, 0x40, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x25, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x29, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x00,
+  0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x10, 0x00, 0x1f, 0x00, 0x27, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x1d, 0x00, 0x28, 0x00, 0x31, 0x00, 0x00, 0x00, 0x11, 0x00, 0x19, 0x00,
+  0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x17, 0x00, 0x2a, 0x00,
+  0x33, 0x00, 0x3a, 0x00, 0x48, 0x00, 0x00, 0x00, 0x09, 0x00, 0x12, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x12, 0x00, 0x00, 0x00, 0x07, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x15, 0x00,
+  0x00, 0x00, 0x13, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x13, 0x00,
+  0x1b, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x1c, 0x00, 0x2c, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x09, 0x00, 0x12, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00,
+  0x24, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x22, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x13, 0x00, 0x26, 0x00,
+  0x3a, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x07, 0x00, 0x13, 0x00, 0x00, 0x00,
+  0x17, 0x00, 0x25, 0x00, 0x35, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x3a, 0x00,
+  0x42, 0x00, 0x4d, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x29, 0x00, 0x37, 0x00,
+  0x45, 0x00, 0x53, 0x00, 0x63, 0x00, 0x6b, 0x00, 0x7a, 0x00, 0x00, 0x00,
+  0x22, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x09, 0x00, 0x12, 0x00, 0x24, 0x00,
+  0x2d, 0x00, 0x36, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x00,
+  0x2b, 0x00, 0x39, 0x00, 0x47, 0x00, 0x4e, 0x00, 0x55, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x16, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x25, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x10, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x18, 0x00, 0x25, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x1f, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x3b, 0x00,
+  0x49, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x29, 0x00,
+  0x37, 0x00, 0x3f, 0x00, 0x46, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x32, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1c, 0x00, 0x2a, 0x00, 0x35, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x1f, 0x00, 0x2f, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x11, 0x00, 0x18, 0x00, 0x1e, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0f, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x20, 0x00, 0x29, 0x00, 0x30, 0x00, 0x00, 0x00, 0x27, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x17, 0x00,
+  0x2c, 0x00, 0x39, 0x00, 0x00, 0x00, 0x10, 0x00, 0x2a, 0x00, 0x38, 0x00,
+  0x00, 0x00, 0x0f, 0x00, 0x24, 0x00, 0x34, 0x00, 0x45, 0x00, 0x56, 0x00,
+  0x66, 0x00, 0x76, 0x00, 0x86, 0x00, 0x00, 0x00, 0x16, 0x00, 0x2b, 0x00,
+  0x00, 0x00, 0x19, 0x00, 0x2f, 0x00, 0x39, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x25, 0x00, 0x42, 0x00, 0x49, 0x00, 0x00, 0x00, 0x19, 0x00, 0x30, 0x00,
+  0x47, 0x00, 0x56, 0x00, 0x69, 0x00, 0x79, 0x00, 0x81, 0x00, 0x89, 0x00,
+  0x91, 0x00, 0x99, 0x00, 0xa1, 0x00, 0xa9, 0x00, 0x00, 0x00, 0x12, 0x00,
+  0x24, 0x00, 0x38, 0x00, 0x00, 0x00, 0x19, 0x00, 0x30, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x26, 0x00, 0x00, 0x00, 0x1b, 0x00,
+  0x2e, 0x00, 0x3e, 0x00, 0x51, 0x00, 0x64, 0x00, 0x6a, 0x00, 0x70, 0x00,
+  0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x28, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x12, 0x00, 0x00, 0x00, 0x19, 0x00, 0x28, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x32, 0x00, 0x3b, 0x00, 0x00, 0x00,
+  0x1a, 0x00, 0x21, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x0a, 0x00,
+  0x12, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x23, 0x00, 0x3c, 0x00,
+  0x5b, 0x00, 0x00, 0x00, 0x25, 0x00, 0x41, 0x00, 0x56, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x22, 0x00,
+  0x35, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x33, 0x00,
+  0x40, 0x00, 0x54, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x14, 0x00,
+  0x22, 0x00, 0x34, 0x00, 0x48, 0x00, 0x00, 0x00, 0x10, 0x00, 0x20, 0x00,
+  0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1f, 0x00,
+  0x00, 0x00, 0x17, 0x00, 0x25, 0x00, 0x2d, 0x00, 0x35, 0x00, 0x3c, 0x00,
+  0x00, 0x00, 0x15, 0x00, 0x23, 0x00, 0x30, 0x00, 0x4f, 0x00, 0x62, 0x00,
+  0x72, 0x00, 0x82, 0x00, 0x92, 0x00, 0xa2, 0x00, 0xb2, 0x00, 0xbd, 0x00,
+  0xcc, 0x00, 0xdc, 0x00, 0xe4, 0x00, 0xec, 0x00, 0xf5, 0x00, 0xfd, 0x00,
+  0x05, 0x01, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x17, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x1c, 0x00, 0x2c, 0x00,
+  0x3c, 0x00, 0x4c, 0x00, 0x5a, 0x00, 0x62, 0x00, 0x6a, 0x00, 0x72, 0x00,
+  0x00, 0x00, 0x13, 0x00, 0x28, 0x00, 0x4c, 0x00, 0x5a, 0x00, 0x68, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x22, 0x00, 0x32, 0x00, 0x3d, 0x00, 0x45, 0x00,
+  0x00, 0x00, 0x19, 0x00, 0x2e, 0x00, 0x42, 0x00, 0x4c, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x26, 0x00, 0x32, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x26, 0x00, 0x3a, 0x00, 0x4e, 0x00, 0x56, 0x00, 0x61, 0x00,
+  0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x36, 0x00, 0x3c, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x2d, 0x00, 0x58, 0x00,
+  0x6d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x29, 0x00, 0x2d, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x1e, 0x00, 0x32, 0x00, 0x42, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x00, 0x00, 0x18, 0x00, 0x20, 0x00, 0x28, 0x00, 0x00, 0x00,
+  0x19, 0x00, 0x2f, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x28, 0x00,
+  0x32, 0x00, 0x00, 0x00, 0x11, 0x00, 0x2d, 0x00, 0x3b, 0x00, 0x43, 0x00,
+  0x00, 0x00, 0x0b, 0x00, 0x14, 0x00, 0x1d, 0x00, 0x26, 0x00, 0x32, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x08, 0x00, 0x15, 0x00, 0x00, 0x00, 0x17, 0x00,
+  0x27, 0x00, 0x36, 0x00, 0x43, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x22, 0x00, 0x35, 0x00,
+  0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x17, 0x00, 0x2d, 0x00, 0x36, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x16, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x00, 0x00, 0x08, 0x00, 0x10, 0x00, 0x00, 0x00, 0x15, 0x00,
+  0x25, 0x00, 0x35, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x16, 0x00, 0x1f, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1b, 0x00, 0x22, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x17, 0x00, 0x21, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x15, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x14, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x09, 0x00, 0x12, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x12, 0x00, 0x1b, 0x00,
+  0x25, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x15, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x13, 0x00, 0x26, 0x00,
+  0x30, 0x00, 0x36, 0x00, 0x3d, 0x00, 0x43, 0x00, 0x4a, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x24, 0x00, 0x2d, 0x00, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x12, 0x00, 0x24, 0x00,
+  0x36, 0x00, 0x48, 0x00, 0x5a, 0x00, 0x6c, 0x00, 0x7e, 0x00, 0x90, 0x00,
+  0xa2, 0x00, 0xb0, 0x00, 0xc2, 0x00, 0xd4, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x26, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x2f, 0x00, 0x37, 0x00, 0x40, 0x00, 0x49, 0x00, 0x52, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x1f, 0x00, 0x32, 0x00, 0x3b, 0x00, 0x44, 0x00, 0x4e, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x00, 0x00, 0x22, 0x00, 0x33, 0x00, 0x00, 0x00, 0x11, 0x00,
+  0x19, 0x00, 0x20, 0x00, 0x00, 0x00, 0x11, 0x00, 0x24, 0x00, 0x2a, 0x00,
+  0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x00, 0x00, 0x13, 0x00, 0x26, 0x00, 0x00, 0x00, 0x12, 0x00, 0x24, 0x00,
+  0x36, 0x00, 0x48, 0x00, 0x5a, 0x00, 0x6c, 0x00, 0x75, 0x00, 0x85, 0x00,
+  0x95, 0x00, 0xa0, 0x00, 0xa9, 0x00, 0xb2, 0x00, 0x00, 0x00, 0x17, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x12, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x42, 0x00, 0x54, 0x00, 0x66, 0x00,
+  0x77, 0x00, 0x80, 0x00, 0x89, 0x00, 0x92, 0x00, 0x9b, 0x00, 0xa4, 0x00,
+  0xad, 0x00, 0xb6, 0x00, 0x00, 0x00, 0x11, 0x00, 0x24, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x2e, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x55, 0x00,
+  0x67, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x25, 0x00, 0x37, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x28, 0x00, 0x39, 0x00, 0x4d, 0x00,
+  0x55, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x25, 0x00, 0x2b, 0x00, 0x33, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x1d, 0x00, 0x34, 0x00, 0x4f, 0x00, 0x5d, 0x00, 0x64, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x27, 0x00, 0x32, 0x00, 0x39, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x2c, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x29, 0x00, 0x00, 0x00,
+  0x16, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x27, 0x00,
+  0x00, 0x00, 0x16, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00,
+  0x1d, 0x00, 0x29, 0x00, 0x00, 0x00, 0x10, 0x00, 0x1e, 0x00, 0x27, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x18, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x2b, 0x00,
+  0x3f, 0x00, 0x5d, 0x00, 0x80, 0x00, 0x86, 0x00, 0x8f, 0x00, 0x00, 0x00,
+  0x1a, 0x00, 0x37, 0x00, 0x4c, 0x00, 0x64, 0x00, 0x83, 0x00, 0x8e, 0x00,
+  0x9b, 0x00, 0xa4, 0x00, 0xb7, 0x00, 0x00, 0x00, 0x21, 0x00, 0x2d, 0x00,
+  0x46, 0x00, 0x62, 0x00, 0x6b, 0x00, 0x72, 0x00, 0x79, 0x00, 0x80, 0x00,
+  0x00, 0x00, 0x15, 0x00, 0x25, 0x00, 0x3d, 0x00, 0x4d, 0x00, 0x00, 0x00,
+  0x18, 0x00, 0x33, 0x00, 0x3f, 0x00, 0x5c, 0x00, 0x7e, 0x00, 0x93, 0x00,
+  0xa5, 0x00, 0xae, 0x00, 0xb7, 0x00, 0xc0, 0x00, 0xc9, 0x00, 0xd2, 0x00,
+  0xdb, 0x00, 0xe4, 0x00, 0xed, 0x00, 0x00, 0x00, 0x11, 0x00, 0x25, 0x00,
+  0x39, 0x00, 0x51, 0x00, 0x75, 0x00, 0x88, 0x00, 0x8f, 0x00, 0x9b, 0x00,
+  0xa1, 0x00, 0x00, 0x00, 0x18, 0x00, 0x30, 0x00, 0x3e, 0x00, 0x5b, 0x00,
+  0x7c, 0x00, 0x98, 0x00, 0x00, 0x00, 0x13, 0x00, 0x1f, 0x00, 0x30, 0x00,
+  0x41, 0x00, 0x64, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x2d, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x22, 0x00, 0x31, 0x00, 0x00, 0x00, 0x18, 0x00, 0x24, 0x00,
+  0x36, 0x00, 0x45, 0x00, 0x4e, 0x00, 0x65, 0x00, 0x00, 0x00, 0x1d, 0x00,
+  0x2d, 0x00, 0x43, 0x00, 0x4a, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1c, 0x00,
+  0x00, 0x00, 0x1a, 0x00, 0x30, 0x00, 0x57, 0x00, 0x79, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x1f, 0x00, 0x35, 0x00, 0x45, 0x00, 0x00, 0x00, 0x19, 0x00,
+  0x2f, 0x00, 0x57, 0x00, 0x66, 0x00, 0x76, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x17, 0x00, 0x2e, 0x00, 0x45, 0x00, 0x54, 0x00, 0x5a, 0x00, 0x00, 0x00,
+  0x15, 0x00, 0x2e, 0x00, 0x43, 0x00, 0x5f, 0x00, 0x70, 0x00, 0x76, 0x00,
+  0x82, 0x00, 0x00, 0x00, 0x42, 0x00, 0x4e, 0x00, 0x5b, 0x00, 0x76, 0x00,
+  0x85, 0x00, 0x00, 0x00, 0x41, 0x00, 0x53, 0x00, 0x61, 0x00, 0x7e, 0x00,
+  0x8b, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x2a, 0x00, 0x40, 0x00, 0x57, 0x00,
+  0x6c, 0x00, 0x81, 0x00, 0x8f, 0x00, 0x9d, 0x00, 0xab, 0x00, 0xbc, 0x00,
+  0xcd, 0x00, 0xd4, 0x00, 0x00, 0x00, 0x18, 0x00, 0x26, 0x00, 0x36, 0x00,
+  0x4e, 0x00, 0x61, 0x00, 0x00, 0x00, 0x13, 0x00, 0x1f, 0x00, 0x2e, 0x00,
+  0x3a, 0x00, 0x50, 0x00, 0x00, 0x00, 0x19, 0x00, 0x26, 0x00, 0x3a, 0x00,
+  0x4a, 0x00, 0x59, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x25, 0x00,
+  0x34, 0x00, 0x40, 0x00, 0x59, 0x00, 0x7c, 0x00, 0x8b, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x22, 0x00, 0x42, 0x00, 0x4f, 0x00, 0x77, 0x00, 0x7e, 0x00,
+  0x87, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x23, 0x00, 0x31, 0x00, 0x46, 0x00,
+  0x64, 0x00, 0x89, 0x00, 0x9b, 0x00, 0xa4, 0x00, 0xae, 0x00, 0xc6, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x24, 0x00, 0x39, 0x00, 0x46, 0x00, 0x51, 0x00,
+  0x74, 0x00, 0x7a, 0x00, 0x80, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x56, 0x00,
+  0x65, 0x00, 0x7d, 0x00, 0x00, 0x00, 0x34, 0x00, 0x71, 0x00, 0x85, 0x00,
+  0x9f, 0x00, 0xb9, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x25, 0x00, 0x3f, 0x00,
+  0x55, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x22, 0x00, 0x3f, 0x00, 0x57, 0x00,
+  0x71, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x28, 0x00, 0x40, 0x00, 0x4e, 0x00,
+  0x6b, 0x00, 0x81, 0x00, 0x90, 0x00, 0xab, 0x00, 0xb1, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x22, 0x00, 0x32, 0x00, 0x3e, 0x00, 0x4c, 0x00, 0x59, 0x00,
+  0x73, 0x00, 0x8b, 0x00, 0x97, 0x00, 0x00, 0x00, 0x15, 0x00, 0x30, 0x00,
+  0x4c, 0x00, 0x68, 0x00, 0x87, 0x00, 0xa1, 0x00, 0xc1, 0x00, 0xd9, 0x00,
+  0xe8, 0x00, 0xf7, 0x00, 0x04, 0x01, 0x11, 0x01, 0x22, 0x01, 0x32, 0x01,
+  0x42, 0x01, 0x52, 0x01, 0x62, 0x01, 0x72, 0x01, 0x00, 0x00, 0x17, 0x00,
+  0x29, 0x00, 0x39, 0x00, 0x47, 0x00, 0x54, 0x00, 0x68, 0x00, 0x7f, 0x00,
+  0x00, 0x00, 0x16, 0x00, 0x2c, 0x00, 0x49, 0x00, 0x66, 0x00, 0x7e, 0x00,
+  0x99, 0x00, 0xba, 0x00, 0xd0, 0x00, 0xe7, 0x00, 0xff, 0x00, 0x0c, 0x01,
+  0x2e, 0x01, 0x3c, 0x01, 0x58, 0x01, 0x67, 0x01, 0x7c, 0x01, 0x85, 0x01,
+  0x94, 0x01, 0x00, 0x00, 0x26, 0x00, 0x39, 0x00, 0x50, 0x00, 0x69, 0x00,
+  0x77, 0x00, 0x8f, 0x00, 0xa6, 0x00, 0xb4, 0x00, 0xc2, 0x00, 0xce, 0x00,
+  0xd4, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x1a, 0x00, 0x2f, 0x00, 0x3e, 0x00,
+  0x5b, 0x00, 0x6c, 0x00, 0x7d, 0x00, 0x98, 0x00, 0xa9, 0x00, 0x00, 0x00,
+  0x27, 0x00, 0x3c, 0x00, 0x53, 0x00, 0x68, 0x00, 0x78, 0x00, 0x88, 0x00,
+  0xa1, 0x00, 0xbb, 0x00, 0x00, 0x00, 0x20, 0x00, 0x38, 0x00, 0x49, 0x00,
+  0x64, 0x00, 0x7e, 0x00, 0x8e, 0x00, 0x9d, 0x00, 0xb0, 0x00, 0xc2, 0x00,
+  0x00, 0x00, 0x17, 0x00, 0x26, 0x00, 0x34, 0x00, 0x4c, 0x00, 0x67, 0x00,
+  0x79, 0x00, 0x88, 0x00, 0x92, 0x00, 0x9b, 0x00, 0x00, 0x00, 0x0b, 0x00,
+  0x20, 0x00, 0x2c, 0x00, 0x38, 0x00, 0x4d, 0x00, 0x63, 0x00, 0x00, 0x00,
+  0x19, 0x00, 0x26, 0x00, 0x35, 0x00, 0x40, 0x00, 0x5d, 0x00, 0x6b, 0x00,
+  0x00, 0x00, 0x2b, 0x00, 0x39, 0x00, 0x47, 0x00, 0x54, 0x00, 0x6a, 0x00,
+  0x78, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x2a, 0x00, 0x3a, 0x00, 0x5f, 0x00,
+  0x79, 0x00, 0x86, 0x00, 0x95, 0x00, 0x00, 0x00, 0x21, 0x00, 0x30, 0x00,
+  0x3f, 0x00, 0x4e, 0x00, 0x62, 0x00, 0x00, 0x00, 0x13, 0x00, 0x23, 0x00,
+  0x30, 0x00, 0x40, 0x00, 0x4f, 0x00, 0x00, 0x00, 0x14, 0x00, 0x3e, 0x00,
+  0x4c, 0x00, 0x67, 0x00, 0x77, 0x00, 0x88, 0x00, 0x9c, 0x00, 0xb0, 0x00,
+  0xc8, 0x00, 0x00, 0x00, 0x13, 0x00, 0x3e, 0x00, 0x4d, 0x00, 0x67, 0x00,
+  0x8c, 0x00, 0xa5, 0x00, 0xb7, 0x00, 0xc6, 0x00, 0x00, 0x00, 0x26, 0x00,
+  0x38, 0x00, 0x46, 0x00, 0x53, 0x00, 0x69, 0x00, 0x7a, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x23, 0x00, 0x38, 0x00, 0x50, 0x00, 0x5e, 0x00, 0x6c, 0x00,
+  0x81, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x30, 0x00, 0x40, 0x00, 0x5b, 0x00,
+  0x6b, 0x00, 0x7b, 0x00, 0x95, 0x00, 0xab, 0x00, 0xb9, 0x00, 0x00, 0x00,
+  0x1f, 0x00, 0x2c, 0x00, 0x47, 0x00, 0x59, 0x00, 0x68, 0x00, 0x7b, 0x00,
+  0x8b, 0x00, 0x9b, 0x00, 0xab, 0x00, 0xbb, 0x00, 0xc3, 0x00, 0xcb, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x40, 0x00, 0x52, 0x00, 0x6b, 0x00, 0x8d, 0x00,
+  0xa6, 0x00, 0xbf, 0x00, 0xd7, 0x00, 0x00, 0x00, 0x10, 0x00, 0x31, 0x00,
+  0x42, 0x00, 0x59, 0x00, 0x7c, 0x00, 0x8c, 0x00, 0x9f, 0x00, 0x00, 0x00,
+  0x17, 0x00, 0x29, 0x00, 0x3e, 0x00, 0x4c, 0x00, 0x59, 0x00, 0x68, 0x00,
+  0x76, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x25, 0x00, 0x34, 0x00, 0x42, 0x00,
+  0x59, 0x00, 0x69, 0x00, 0x79, 0x00, 0x89, 0x00, 0x97, 0x00, 0x9f, 0x00,
+  0xa7, 0x00, 0xaf, 0x00, 0xb7, 0x00, 0xbd, 0x00, 0xc5, 0x00, 0x00, 0x00,
+  0x19, 0x00, 0x2a, 0x00, 0x46, 0x00, 0x56, 0x00, 0x6d, 0x00, 0x85, 0x00,
+  0x00, 0x00, 0x1d, 0x00, 0x2c, 0x00, 0x46, 0x00, 0x53, 0x00, 0x62, 0x00,
+  0x6e, 0x00, 0x7e, 0x00, 0x8e, 0x00, 0x96, 0x00, 0x00, 0x00, 0x14, 0x00,
+  0x2a, 0x00, 0x38, 0x00, 0x48, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x13, 0x00,
+  0x20, 0x00, 0x2e, 0x00, 0x3b, 0x00, 0x4b, 0x00, 0x5b, 0x00, 0x67, 0x00,
+  0x77, 0x00, 0x00, 0x00, 0x18, 0x00, 0x2d, 0x00, 0x46, 0x00, 0x55, 0x00,
+  0x6b, 0x00, 0x7b, 0x00, 0x8c, 0x00, 0x00, 0x00, 0x27, 0x00, 0x3c, 0x00,
+  0x48, 0x00, 0x62, 0x00, 0x77, 0x00, 0x8b, 0x00, 0x9b, 0x00, 0xa8, 0x00,
+  0x00, 0x00, 0x27, 0x00, 0x37, 0x00, 0x46, 0x00, 0x7c, 0x00, 0x95, 0x00,
+  0xac, 0x00, 0xc4, 0x00, 0xd6, 0x00, 0xe8, 0x00, 0xf1, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x26, 0x00, 0x5d, 0x00, 0x6a, 0x00, 0x7a, 0x00, 0x9a, 0x00,
+  0x00, 0x00, 0x23, 0x00, 0x48, 0x00, 0x69, 0x00, 0x86, 0x00, 0xa2, 0x00,
+  0xc3, 0x00, 0xe8, 0x00, 0x15, 0x01, 0x35, 0x01, 0x48, 0x01, 0x57, 0x01,
+  0x78, 0x01, 0x91, 0x01, 0xae, 0x01, 0xbe, 0x01, 0xd5, 0x01, 0xdf, 0x01,
+  0xe9, 0x01, 0x00, 0x00, 0x10, 0x00, 0x1d, 0x00, 0x36, 0x00, 0x46, 0x00,
+  0x52, 0x00, 0x00, 0x00, 0x24, 0x00, 0x4a, 0x00, 0x6c, 0x00, 0x8a, 0x00,
+  0xa7, 0x00, 0xc9, 0x00, 0xef, 0x00, 0x1d, 0x01, 0x39, 0x01, 0x4c, 0x01,
+  0x60, 0x01, 0x7b, 0x01, 0x93, 0x01, 0xa9, 0x01, 0xc4, 0x01, 0xdd, 0x01,
+  0x00, 0x00, 0x22, 0x00, 0x37, 0x00, 0x43, 0x00, 0x59, 0x00, 0x6d, 0x00,
+  0x8e, 0x00, 0xa4, 0x00, 0xb7, 0x00, 0x00, 0x00, 0x12, 0x00, 0x1e, 0x00,
+  0x54, 0x00, 0x5f, 0x00, 0x71, 0x00, 0x88, 0x00, 0x98, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x2a, 0x00, 0x5f, 0x00, 0x6f, 0x00, 0x82, 0x00, 0x99, 0x00,
+  0xa2, 0x00, 0xb2, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x2a, 0x00, 0x4e, 0x00,
+  0x5c, 0x00, 0x73, 0x00, 0x89, 0x00, 0xaa, 0x00, 0xba, 0x00, 0x00, 0x00,
+  0x19, 0x00, 0x28, 0x00, 0x35, 0x00, 0x45, 0x00, 0x5e, 0x00, 0x7e, 0x00,
+  0x9e, 0x00, 0xad, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x33, 0x00, 0x3e, 0x00,
+  0x5a, 0x00, 0x67, 0x00, 0x74, 0x00, 0x84, 0x00, 0x00, 0x00, 0x0f, 0x00,
+  0x35, 0x00, 0x4f, 0x00, 0x65, 0x00, 0x79, 0x00, 0x87, 0x00, 0x9e, 0x00,
+  0x00, 0x00, 0x0f, 0x00, 0x2a, 0x00, 0x38, 0x00, 0x52, 0x00, 0x5f, 0x00,
+  0x74, 0x00, 0x82, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x29, 0x00, 0x37, 0x00,
+  0x53, 0x00, 0x7c, 0x00, 0x92, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x2d, 0x00,
+  0x45, 0x00, 0x5e, 0x00, 0x74, 0x00, 0x87, 0x00, 0x97, 0x00, 0xb0, 0x00,
+  0x00, 0x00, 0x0f, 0x00, 0x2b, 0x00, 0x45, 0x00, 0x5f, 0x00, 0x6c, 0x00,
+  0x87, 0x00, 0xa2, 0x00, 0xab, 0x00, 0x00, 0x00, 0x19, 0x00, 0x44, 0x00,
+  0x55, 0x00, 0x63, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x21, 0x00, 0x3e, 0x00,
+  0x4e, 0x00, 0x60, 0x00, 0x00, 0x00, 0x21, 0x00, 0x44, 0x00, 0x66, 0x00,
+  0x7f, 0x00, 0x97, 0x00, 0x00, 0x00, 0x20, 0x00, 0x35, 0x00, 0x58, 0x00,
+  0x7a, 0x00, 0x93, 0x00, 0xab, 0x00, 0x00, 0x00, 0x14, 0x00, 0x39, 0x00,
+  0x45, 0x00, 0x5a, 0x00, 0x76, 0x00, 0x8b, 0x00, 0x9e, 0x00, 0xae, 0x00,
+  0xbe, 0x00, 0xcd, 0x00, 0xdd, 0x00, 0xeb, 0x00, 0xfa, 0x00, 0x0a, 0x01,
+  0x12, 0x01, 0x00, 0x00, 0x14, 0x00, 0x40, 0x00, 0x57, 0x00, 0x71, 0x00,
+  0x81, 0x00, 0x95, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x45, 0x00, 0x59, 0x00,
+  0x6d, 0x00, 0x79, 0x00, 0x93, 0x00, 0xa9, 0x00, 0x00, 0x00, 0x18, 0x00,
+  0x2f, 0x00, 0x5a, 0x00, 0x6d, 0x00, 0x83, 0x00, 0x97, 0x00, 0xab, 0x00,
+  0xb2, 0x00, 0xb9, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x23, 0x00, 0x3e, 0x00,
+  0x55, 0x00, 0x68, 0x00, 0x78, 0x00, 0x90, 0x00, 0x9d, 0x00, 0xb2, 0x00,
+  0xc5, 0x00, 0xd8, 0x00, 0xe8, 0x00, 0xf8, 0x00, 0x08, 0x01, 0x1b, 0x01,
+  0x24, 0x01, 0x2c, 0x01, 0x3a, 0x01, 0x43, 0x01, 0x5a, 0x01, 0x00, 0x00,
+  0x22, 0x00, 0x37, 0x00, 0x45, 0x00, 0x58, 0x00, 0x68, 0x00, 0x89, 0x00,
+  0x98, 0x00, 0xad, 0x00, 0xbb, 0x00, 0x00, 0x00, 0x20, 0x00, 0x2f, 0x00,
+  0x42, 0x00, 0x53, 0x00, 0x6b, 0x00, 0x78, 0x00, 0x90, 0x00, 0xa0, 0x00,
+  0xae, 0x00, 0xb7, 0x00, 0x00, 0x00, 0x20, 0x00, 0x34, 0x00, 0x4d, 0x00,
+  0x5b, 0x00, 0x6a, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x22, 0x00, 0x33, 0x00,
+  0x42, 0x00, 0x54, 0x00, 0x00, 0x00, 0x18, 0x00, 0x2b, 0x00, 0x53, 0x00,
+  0x6a, 0x00, 0x81, 0x00, 0x8d, 0x00, 0x00, 0x00, 0x21, 0x00, 0x34, 0x00,
+  0x46, 0x00, 0x56, 0x00, 0x80, 0x00, 0x9c, 0x00, 0xb2, 0x00, 0xbb, 0x00,
+  0x00, 0x00, 0x21, 0x00, 0x2f, 0x00, 0x42, 0x00, 0x53, 0x00, 0x75, 0x00,
+  0x8f, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x30, 0x00, 0x59, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x2a, 0x00, 0x41, 0x00, 0x5e, 0x00, 0x6c, 0x00, 0x73, 0x00,
+  0x7e, 0x00, 0x88, 0x00, 0x92, 0x00, 0x00, 0x00, 0x14, 0x00, 0x2e, 0x00,
+  0x3e, 0x00, 0x59, 0x00, 0x66, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x23, 0x00,
+  0x49, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x1a, 0x00, 0x30, 0x00,
+  0x52, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1a, 0x00, 0x30, 0x00, 0x4e, 0x00,
+  0x57, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x42, 0x00, 0x57, 0x00, 0x71, 0x00,
+  0x86, 0x00, 0x94, 0x00, 0x9b, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x1e, 0x00,
+  0x3d, 0x00, 0x54, 0x00, 0x6b, 0x00, 0x84, 0x00, 0x9c, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x31, 0x00, 0x49, 0x00, 0x57, 0x00, 0x66, 0x00, 0x74, 0x00,
+  0x00, 0x00, 0x1f, 0x00, 0x4d, 0x00, 0x64, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x2f, 0x00, 0x3c, 0x00, 0x54, 0x00, 0x75, 0x00, 0x85, 0x00, 0x95, 0x00,
+  0xa3, 0x00, 0xae, 0x00, 0xb6, 0x00, 0xc6, 0x00, 0x00, 0x00, 0x0d, 0x00,
+  0x31, 0x00, 0x49, 0x00, 0x58, 0x00, 0x6f, 0x00, 0x00, 0x00, 0x24, 0x00,
+  0x32, 0x00, 0x50, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x42, 0x00, 0x59, 0x00,
+  0x69, 0x00, 0x72, 0x00, 0x7b, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x54, 0x00,
+  0x64, 0x00, 0x77, 0x00, 0x87, 0x00, 0x8f, 0x00, 0x97, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x36, 0x00, 0x4c, 0x00, 0x60, 0x00, 0x6e, 0x00, 0x00, 0x00,
+  0x18, 0x00, 0x32, 0x00, 0x44, 0x00, 0x4d, 0x00, 0x00, 0x00, 0x23, 0x00,
+  0x39, 0x00, 0x4c, 0x00, 0x5d, 0x00, 0x67, 0x00, 0x00, 0x00, 0x2a, 0x00,
+  0x3d, 0x00, 0x52, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x19, 0x00, 0x24, 0x00,
+  0x39, 0x00, 0x47, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x25, 0x00, 0x31, 0x00,
+  0x45, 0x00, 0x59, 0x00, 0x65, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x42, 0x00,
+  0x58, 0x00, 0x00, 0x00, 0x32, 0x00, 0x3f, 0x00, 0x61, 0x00, 0x7e, 0x00,
+  0x87, 0x00, 0x90, 0x00, 0x99, 0x00, 0xa2, 0x00, 0xab, 0x00, 0xb4, 0x00,
+  0xba, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x31, 0x00, 0x58, 0x00, 0x7f, 0x00,
+  0x97, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x2e, 0x00, 0x50, 0x00, 0x76, 0x00,
+  0x7d, 0x00, 0x86, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x32, 0x00, 0x5b, 0x00,
+  0x80, 0x00, 0x87, 0x00, 0x92, 0x00, 0x00, 0x00, 0x15, 0x00, 0x26, 0x00,
+  0x52, 0x00, 0x6e, 0x00, 0x7b, 0x00, 0x86, 0x00, 0x91, 0x00, 0x9a, 0x00,
+  0xa3, 0x00, 0xac, 0x00, 0xb5, 0x00, 0xbe, 0x00, 0xc9, 0x00, 0x00, 0x00,
+  0x18, 0x00, 0x2e, 0x00, 0x41, 0x00, 0x60, 0x00, 0x72, 0x00, 0x91, 0x00,
+  0x99, 0x00, 0x00, 0x00, 0x18, 0x00, 0x30, 0x00, 0x3f, 0x00, 0x4b, 0x00,
+  0x00, 0x00, 0x25, 0x00, 0x3e, 0x00, 0x47, 0x00, 0x4f, 0x00, 0x5c, 0x00,
+  0x00, 0x00, 0x1e, 0x00, 0x56, 0x00, 0x79, 0x00, 0x85, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x3d, 0x00, 0x5f, 0x00, 0x71, 0x00, 0x83, 0x00, 0x95, 0x00,
+  0x9e, 0x00, 0x00, 0x00, 0x18, 0x00, 0x2c, 0x00, 0x44, 0x00, 0x4f, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x24, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x16, 0x00,
+  0x29, 0x00, 0x47, 0x00, 0x00, 0x00, 0x39, 0x00, 0x5f, 0x00, 0x74, 0x00,
+  0x89, 0x00, 0x94, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x17, 0x00, 0x39, 0x00,
+  0x44, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x30, 0x00, 0x00, 0x00, 0x1c, 0x00,
+  0x33, 0x00, 0x3b, 0x00, 0x43, 0x00, 0x4b, 0x00, 0x51, 0x00, 0x57, 0x00,
+  0x00, 0x00, 0x1b, 0x00, 0x29, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x20, 0x00,
+  0x35, 0x00, 0x00, 0x00, 0x15, 0x00, 0x31, 0x00, 0x48, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x1d, 0x00, 0x33, 0x00, 0x00, 0x00, 0x13, 0x00, 0x26, 0x00,
+  0x39, 0x00, 0x4c, 0x00, 0x5f, 0x00, 0x72, 0x00, 0x85, 0x00, 0x98, 0x00,
+  0xab, 0x00, 0xca, 0x00, 0xe6, 0x00, 0xff, 0x00, 0x00, 0x00, 0x21, 0x00,
+  0x37, 0x00, 0x4a, 0x00, 0x53, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x24, 0x00,
+  0x41, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x1f, 0x00, 0x40, 0x00, 0x50, 0x00,
+  0x59, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1d, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x23, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x2b, 0x00,
+  0x46, 0x00, 0x4d, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1e, 0x00, 0x24, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x20, 0x00, 0x60, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x2b, 0x00,
+  0x00, 0x00, 0x1b, 0x00, 0x49, 0x00, 0x55, 0x00, 0x00, 0x00, 0x11, 0x00,
+  0x27, 0x00, 0x5b, 0x00, 0x6b, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x32, 0x00,
+  0x50, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x28, 0x00, 0x00, 0x00, 0x0f, 0x00,
+  0x25, 0x00, 0x4c, 0x00, 0x52, 0x00, 0x58, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x1f, 0x00, 0x3d, 0x00, 0x4f, 0x00, 0x61, 0x00, 0x73, 0x00, 0x86, 0x00,
+  0x99, 0x00, 0xab, 0x00, 0xbd, 0x00, 0xcf, 0x00, 0xe1, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x13, 0x00, 0x26, 0x00, 0x36, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x30, 0x00, 0x40, 0x00, 0x48, 0x00, 0x50, 0x00, 0x59, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x23, 0x00, 0x29, 0x00, 0x00, 0x00, 0x18, 0x00,
+  0x31, 0x00, 0x3a, 0x00, 0x45, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
+  0x18, 0x00, 0x2b, 0x00, 0x3e, 0x00, 0x51, 0x00, 0x6f, 0x00, 0x78, 0x00,
+  0x81, 0x00, 0x8b, 0x00, 0x00, 0x00, 0x10, 0x00, 0x23, 0x00, 0x2c, 0x00,
+  0x36, 0x00, 0x3f, 0x00, 0x49, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x17, 0x00, 0x22, 0x00, 0x00, 0x00, 0x19, 0x00, 0x2b, 0x00, 0x3d, 0x00,
+  0x4f, 0x00, 0x61, 0x00, 0x6b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x19, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x18, 0x00, 0x25, 0x00, 0x2d, 0x00,
+  0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x2d, 0x00, 0x3f, 0x00,
+  0x51, 0x00, 0x63, 0x00, 0x75, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x44, 0x00,
+  0x5c, 0x00, 0x6a, 0x00, 0x00, 0x00, 0x22, 0x00, 0x2e, 0x00, 0x34, 0x00,
+  0x00, 0x00, 0x1d, 0x00, 0x4a, 0x00, 0x62, 0x00, 0x70, 0x00, 0x82, 0x00,
+  0x94, 0x00, 0xa6, 0x00, 0xb4, 0x00, 0xc2, 0x00, 0xd4, 0x00, 0xe6, 0x00,
+  0xf8, 0x00, 0x0a, 0x01, 0x1c, 0x01, 0x2e, 0x01, 0x40, 0x01, 0x53, 0x01,
+  0x66, 0x01, 0x72, 0x01, 0x7b, 0x01, 0x84, 0x01, 0x8d, 0x01, 0x96, 0x01,
+  0x9f, 0x01, 0x00, 0x00, 0x20, 0x00, 0x3d, 0x00, 0x4b, 0x00, 0x00, 0x00,
+  0x25, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x39, 0x00, 0x50, 0x00,
+  0x00, 0x00, 0x1c, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
+  0x3e, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x19, 0x00, 0x3e, 0x00, 0x5a, 0x00,
+  0x66, 0x00, 0x7b, 0x00, 0x90, 0x00, 0x00, 0x00, 0x35, 0x00, 0x56, 0x00,
+  0x74, 0x00, 0x86, 0x00, 0x91, 0x00, 0xae, 0x00, 0xb5, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x3a, 0x00, 0x47, 0x00, 0x5c, 0x00, 0x76, 0x00, 0x89, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x2e, 0x00, 0x4e, 0x00, 0x57, 0x00, 0x60, 0x00,
+  0x00, 0x00, 0x29, 0x00, 0x38, 0x00, 0x47, 0x00, 0x5f, 0x00, 0x00, 0x00,
+  0x1a, 0x00, 0x26, 0x00, 0x37, 0x00, 0x4d, 0x00, 0x61, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x1a, 0x00, 0x3e, 0x00, 0x50, 0x00, 0x60, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x22, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x0b, 0x00,
+  0x19, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x27, 0x00,
+  0x35, 0x00, 0x46, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x1e, 0x00,
+  0x2d, 0x00, 0x42, 0x00, 0x57, 0x00, 0x62, 0x00, 0x00, 0x00, 0x0f, 0x00,
+  0x17, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x20, 0x00, 0x32, 0x00, 0x44, 0x00,
+  0x56, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1c, 0x00, 0x33, 0x00, 0x58, 0x00,
+  0x00, 0x00, 0x1d, 0x00, 0x29, 0x00, 0x37, 0x00, 0x49, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x18, 0x00, 0x2e, 0x00, 0x47, 0x00, 0x51, 0x00, 0x00, 0x00,
+  0x19, 0x00, 0x3e, 0x00, 0x4e, 0x00, 0x5d, 0x00, 0x81, 0x00, 0x8f, 0x00,
+  0x00, 0x00, 0x1d, 0x00, 0x2a, 0x00, 0x37, 0x00, 0x44, 0x00, 0x00, 0x00,
+  0x1f, 0x00, 0x44, 0x00, 0x52, 0x00, 0x6a, 0x00, 0x7c, 0x00, 0x96, 0x00,
+  0xab, 0x00, 0xb4, 0x00, 0xbd, 0x00, 0xc6, 0x00, 0x00, 0x00, 0x1e, 0x00,
+  0x38, 0x00, 0x55, 0x00, 0x61, 0x00, 0x73, 0x00, 0x80, 0x00, 0x9a, 0x00,
+  0xb2, 0x00, 0xb9, 0x00, 0xc5, 0x00, 0xd0, 0x00, 0xd6, 0x00, 0xe2, 0x00,
+  0x00, 0x00, 0x2d, 0x00, 0x4b, 0x00, 0x6d, 0x00, 0x96, 0x00, 0xab, 0x00,
+  0xc0, 0x00, 0xcf, 0x00, 0x00, 0x00, 0x25, 0x00, 0x55, 0x00, 0x62, 0x00,
+  0x73, 0x00, 0x8c, 0x00, 0xa2, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x3c, 0x00,
+  0x5a, 0x00, 0x6a, 0x00, 0x78, 0x00, 0x85, 0x00, 0xa4, 0x00, 0xb2, 0x00,
+  0xc4, 0x00, 0xd6, 0x00, 0xdf, 0x00, 0xe8, 0x00, 0xf1, 0x00, 0xfa, 0x00,
+  0x00, 0x00, 0x1d, 0x00, 0x43, 0x00, 0x51, 0x00, 0x5f, 0x00, 0x78, 0x00,
+  0x8d, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x46, 0x00, 0x61, 0x00, 0x71, 0x00,
+  0x8a, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x24, 0x00, 0x42, 0x00, 0x5f, 0x00,
+  0x7f, 0x00, 0x97, 0x00, 0xaa, 0x00, 0xb7, 0x00, 0x00, 0x00, 0x2c, 0x00,
+  0x46, 0x00, 0x6d, 0x00, 0x84, 0x00, 0x95, 0x00, 0xa6, 0x00, 0xbc, 0x00,
+  0xcc, 0x00, 0xdd, 0x00, 0xeb, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x3d, 0x00,
+  0x65, 0x00, 0x7c, 0x00, 0x8a, 0x00, 0x96, 0x00, 0xad, 0x00, 0xb9, 0x00,
+  0x00, 0x00, 0x20, 0x00, 0x4b, 0x00, 0x6a, 0x00, 0x79, 0x00, 0x86, 0x00,
+  0x9d, 0x00, 0xb2, 0x00, 0x00, 0x00, 0x20, 0x00, 0x3e, 0x00, 0x5a, 0x00,
+  0x75, 0x00, 0x8b, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x49, 0x00, 0x67, 0x00,
+  0x86, 0x00, 0x9c, 0x00, 0xa9, 0x00, 0xc1, 0x00, 0xe0, 0x00, 0xef, 0x00,
+  0xfd, 0x00, 0x04, 0x01, 0x0b, 0x01, 0x13, 0x01, 0x00, 0x00, 0x22, 0x00,
+  0x3d, 0x00, 0x53, 0x00, 0x61, 0x00, 0x74, 0x00, 0x82, 0x00, 0x95, 0x00,
+  0xa8, 0x00, 0xb1, 0x00, 0xba, 0x00, 0xc3, 0x00, 0x00, 0x00, 0x2d, 0x00,
+  0x4c, 0x00, 0x6c, 0x00, 0x7c, 0x00, 0x8d, 0x00, 0xa4, 0x00, 0xad, 0x00,
+  0xbf, 0x00, 0xd3, 0x00, 0xdc, 0x00, 0xe5, 0x00, 0x00, 0x00, 0x22, 0x00,
+  0x40, 0x00, 0x61, 0x00, 0x72, 0x00, 0x87, 0x00, 0x8e, 0x00, 0x00, 0x00,
+  0x1d, 0x00, 0x2b, 0x00, 0x43, 0x00, 0x56, 0x00, 0x5d, 0x00, 0x00, 0x00,
+  0x21, 0x00, 0x31, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x26, 0x00,
+  0x34, 0x00, 0x00, 0x00, 0x10, 0x00, 0x23, 0x00, 0x38, 0x00, 0x00, 0x00,
+  0x1d, 0x00, 0x3d, 0x00, 0x4a, 0x00, 0x58, 0x00, 0x00, 0x00, 0x1d, 0x00,
+  0x38, 0x00, 0x56, 0x00, 0x6f, 0x00, 0x7c, 0x00, 0x9f, 0x00, 0xac, 0x00,
+  0x00, 0x00, 0x24, 0x00, 0x43, 0x00, 0x68, 0x00, 0x78, 0x00, 0x87, 0x00,
+  0xb0, 0x00, 0xd7, 0x00, 0x00, 0x00, 0x21, 0x00, 0x3f, 0x00, 0x58, 0x00,
+  0x68, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x39, 0x00, 0x64, 0x00, 0x71, 0x00,
+  0x80, 0x00, 0x94, 0x00, 0xab, 0x00, 0xb6, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x1e, 0x00, 0x3d, 0x00, 0x62, 0x00, 0x69, 0x00, 0x00, 0x00, 0x0d, 0x00,
+  0x1d, 0x00, 0x35, 0x00, 0x58, 0x00, 0x61, 0x00, 0x00, 0x00, 0x15, 0x00,
+  0x2a, 0x00, 0x42, 0x00, 0x49, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x1b, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x27, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00,
+  0x1a, 0x00, 0x35, 0x00, 0x47, 0x00, 0x00, 0x00, 0x20, 0x00, 0x3d, 0x00,
+  0x4b, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x1f, 0x00,
+  0x2f, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x1c, 0x00,
+  0x3a, 0x00, 0x47, 0x00, 0x59, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x20, 0x00,
+  0x2e, 0x00, 0x41, 0x00, 0x4f, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x1d, 0x00, 0x39, 0x00, 0x57, 0x00, 0x63, 0x00, 0x00, 0x00, 0x2f, 0x00,
+  0x3d, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x2c, 0x00, 0x42, 0x00, 0x4e, 0x00,
+  0x5a, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x40, 0x00, 0x5e, 0x00, 0x77, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x3e, 0x00, 0x5c, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x24, 0x00, 0x37, 0x00, 0x4a, 0x00, 0x5c, 0x00, 0x6e, 0x00,
+  0x77, 0x00, 0x80, 0x00, 0x8a, 0x00, 0x93, 0x00, 0x00, 0x00, 0x1f, 0x00,
+  0x3b, 0x00, 0x49, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x38, 0x00, 0x5b, 0x00,
+  0x69, 0x00, 0x7b, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x23, 0x00,
+  0x41, 0x00, 0x5f, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x20, 0x00, 0x41, 0x00,
+  0x00, 0x00, 0x1a, 0x00, 0x34, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x3b, 0x00,
+  0x00, 0x00, 0x3d, 0x00, 0x5a, 0x00, 0x6e, 0x00, 0x7e, 0x00, 0x88, 0x00,
+  0x00, 0x00, 0x14, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x1c, 0x00, 0x2a, 0x00, 0x38, 0x00, 0x46, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x18, 0x00, 0x00, 0x00, 0x10, 0x00, 0x20, 0x00, 0x31, 0x00,
+  0x43, 0x00, 0x4a, 0x00, 0x54, 0x00, 0x5c, 0x00, 0x63, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x11, 0x00,
+  0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x38, 0x00, 0x4b, 0x00, 0x62, 0x00,
+  0x00, 0x00, 0x13, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x11, 0x00, 0x19, 0x00, 0x21, 0x00, 0x29, 0x00, 0x31, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x11, 0x00, 0x1b, 0x00, 0x25, 0x00,
+  0x2f, 0x00, 0x00, 0x00, 0x10, 0x00, 0x20, 0x00, 0x30, 0x00, 0x44, 0x00,
+  0x58, 0x00, 0x68, 0x00, 0x70, 0x00, 0x78, 0x00, 0x81, 0x00, 0x89, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x20, 0x00,
+  0x30, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0x35, 0x00,
+  0x00, 0x00, 0x37, 0x00, 0x6d, 0x00, 0xa2, 0x00, 0xd8, 0x00, 0x00, 0x00,
+  0x37, 0x00, 0x6e, 0x00, 0xa4, 0x00, 0xda, 0x00, 0x0f, 0x01, 0x45, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00
+};
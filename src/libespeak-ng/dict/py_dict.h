@@ -1,5 +1,7 @@
 #pragma once
-const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
+#include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/py_dict_index.h>
+const unsigned char __espeakng_dict_py[] __attribute__((aligned((4)))) = {
   0x00, 0x04, 0x00, 0x00, 0x73, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c,
   0x43, 0x40, 0x31, 0x48, 0x30, 0x51, 0x24, 0x41, 0x18, 0x00, 0x48, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -202,4 +204,11 @@ const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
   0x0b, 0x00, 0x2e, 0x02, 0x20, 0x0e, 0x80, 0x80, 0x81, 0x00, 0x2e, 0x08,
   0x02, 0x15, 0x0e, 0x80, 0x84, 0x81, 0x00, 0x07, 0x00
 };
-size_t __espeakng_dictlen = 2409;
+
+BackgroundAudioDictionary dict_py = {
+    "py",
+    2409,
+    __espeakng_dict_py,
+    2386,
+    __espeakng_dictindex_py
+};
@@ -1,5 +1,7 @@
 #pragma once
-const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
+#include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/qdb_dict_index.h>
+const unsigned char __espeakng_dict_qdb[] __attribute__((aligned((4)))) = {
   0x00, 0x04, 0x00, 0x00, 0x8e, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
   0xc3, 0x4c, 0x91, 0x80, 0x48, 0x2e, 0x00, 0x00, 0x07, 0xc3, 0x10, 0x56,
   0x41, 0x48, 0x2e, 0x07, 0xc3, 0x60, 0x96, 0x41, 0x48, 0x2e, 0x0a, 0x41,
@@ -254,4 +256,11 @@ const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
   0x06, 0x7a, 0x00, 0x03, 0x59, 0x00, 0x07, 0x06, 0x00, 0xc3, 0xa3, 0x03,
   0x9f, 0x00, 0x07, 0x00
 };
-size_t __espeakng_dictlen = 3028;
+
+BackgroundAudioDictionary dict_qdb = {
+    "qdb",
+    3028,
+    __espeakng_dict_qdb,
+    2576,
+    __espeakng_dictindex_qdb
+};
@@ -1,5 +1,7 @@
 #pragma once
-const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
+#include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/qu_dict_index.h>
+const unsigned char __espeakng_dict_qu[] __attribute__((aligned((4)))) = {
   0x00, 0x04, 0x00, 0x00, 0x75, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x06, 0x41, 0x04, 0x23, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
   0x41, 0x08, 0x48, 0x23, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x41,
@@ -161,4 +163,11 @@ const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
   0x06, 0x78, 0x00, 0x03, 0x31, 0x5a, 0x00, 0x07, 0x06, 0x79, 0x00, 0x03,
   0x39, 0x00, 0x07, 0x06, 0x7a, 0x00, 0x03, 0x59, 0x00, 0x07, 0x00
 };
-size_t __espeakng_dictlen = 1919;
+
+BackgroundAudioDictionary dict_qu = {
+    "qu",
+    1919,
+    __espeakng_dict_qu,
+    2296,
+    __espeakng_dictindex_qu
+};
@@ -1,5 +1,7 @@
 #pragma once
-const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
+#include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/quc_dict_index.h>
+const unsigned char __espeakng_dict_quc[] __attribute__((aligned((4)))) = {
   0x00, 0x04, 0x00, 0x00, 0x74, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -122,4 +124,11 @@ const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
   0x07, 0x06, 0x79, 0x00, 0x04, 0x02, 0x11, 0x43, 0x03, 0x25, 0x00, 0x02,
   0x20, 0x00, 0x02, 0x11, 0x41, 0x03, 0x39, 0x00, 0x07, 0x00
 };
-size_t __espeakng_dictlen = 1450;
+
+BackgroundAudioDictionary dict_quc = {
+    "quc",
+    1450,
+    __espeakng_dict_quc,
+    2098,
+    __espeakng_dictindex_quc
+};
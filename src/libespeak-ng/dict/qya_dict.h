@@ -1,5 +1,7 @@
 #pragma once
-const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
+#include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/qya_dict_index.h>
+const unsigned char __espeakng_dict_qya[] __attribute__((aligned((4)))) = {
   0x00, 0x04, 0x00, 0x00, 0x06, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x04, 0xc1, 0x04, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xc2,
@@ -163,4 +165,11 @@ const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
   0x03, 0x3a, 0x00, 0x07, 0x06, 0x78, 0x00, 0x03, 0x6b, 0x00, 0x07, 0x06,
   0x79, 0x00, 0x03, 0x39, 0x00, 0x07, 0x00
 };
-size_t __espeakng_dictlen = 1939;
+
+BackgroundAudioDictionary dict_qya = {
+    "qya",
+    1939,
+    __espeakng_dict_qya,
+    2182,
+    __espeakng_dictindex_qya
+};
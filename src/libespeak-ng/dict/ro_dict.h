@@ -1,5 +1,7 @@
 #pragma once
-const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
+#include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/ro_dict_index.h>
+const unsigned char __espeakng_dict_ro[] __attribute__((aligned((4)))) = {
   0x00, 0x04, 0x00, 0x00, 0x86, 0xfe, 0x00, 0x00, 0x00, 0x42, 0x19, 0xf0,
   0x9f, 0x91, 0xa9, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xe2, 0x80,
   0x8d, 0xf0, 0x9f, 0x91, 0xa7, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa7,
@@ -5713,4 +5715,11 @@ const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
   0x0f, 0x03, 0x55, 0x06, 0x25, 0x22, 0x52, 0x28, 0x37, 0x0d, 0x00, 0xc3,
   0xb6, 0x03, 0x71, 0x00, 0x07, 0x00
 };
-size_t __espeakng_dictlen = 68538;
+
+BackgroundAudioDictionary dict_ro = {
+    "ro",
+    68538,
+    __espeakng_dict_ro,
+    13486,
+    __espeakng_dictindex_ro
+};
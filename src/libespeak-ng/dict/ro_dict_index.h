@@ -0,0 +1,1127 @@
+#pragma once
+const unsigned char __espeakng_dictindex_ro[] __attribute__((aligned((4)))) = {
+  0x45, 0x44, 0x58, 0x31, 0xba, 0x0b, 0x01, 0x00, 0x86, 0xfe, 0x00, 0x00,
+  0xde, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x09, 0x00,
+  0x09, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x11, 0x00, 0x19, 0x00, 0x1d, 0x00,
+  0x1f, 0x00, 0x20, 0x00, 0x25, 0x00, 0x26, 0x00, 0x2d, 0x00, 0x2d, 0x00,
+  0x32, 0x00, 0x34, 0x00, 0x35, 0x00, 0x36, 0x00, 0x39, 0x00, 0x3d, 0x00,
+  0x3f, 0x00, 0x3f, 0x00, 0x40, 0x00, 0x40, 0x00, 0x41, 0x00, 0x43, 0x00,
+  0x44, 0x00, 0x49, 0x00, 0x4d, 0x00, 0x4e, 0x00, 0x50, 0x00, 0x51, 0x00,
+  0x52, 0x00, 0x52, 0x00, 0x53, 0x00, 0x54, 0x00, 0x5a, 0x00, 0x5e, 0x00,
+  0x61, 0x00, 0x61, 0x00, 0x62, 0x00, 0x62, 0x00, 0x63, 0x00, 0x65, 0x00,
+  0x67, 0x00, 0x68, 0x00, 0x6c, 0x00, 0x6d, 0x00, 0x7a, 0x00, 0x7d, 0x00,
+  0x80, 0x00, 0x80, 0x00, 0x83, 0x00, 0x83, 0x00, 0x85, 0x00, 0x88, 0x00,
+  0x90, 0x00, 0x92, 0x00, 0x93, 0x00, 0x93, 0x00, 0x97, 0x00, 0x98, 0x00,
+  0x9a, 0x00, 0x9b, 0x00, 0x9f, 0x00, 0xa0, 0x00, 0xa2, 0x00, 0xa4, 0x00,
+  0xa7, 0x00, 0xa8, 0x00, 0xaa, 0x00, 0xab, 0x00, 0xad, 0x00, 0xba, 0x00,
+  0xbd, 0x00, 0xc8, 0x00, 0xcb, 0x00, 0xce, 0x00, 0xce, 0x00, 0xce, 0x00,
+  0xd0, 0x00, 0xd1, 0x00, 0xd1, 0x00, 0xd2, 0x00, 0xd2, 0x00, 0xd6, 0x00,
+  0xd6, 0x00, 0xd7, 0x00, 0xe2, 0x00, 0xea, 0x00, 0xec, 0x00, 0xf4, 0x00,
+  0xf8, 0x00, 0xf9, 0x00, 0xfa, 0x00, 0xfb, 0x00, 0x00, 0x01, 0x01, 0x01,
+  0x03, 0x01, 0x04, 0x01, 0x06, 0x01, 0x08, 0x01, 0x09, 0x01, 0x0c, 0x01,
+  0x10, 0x01, 0x1d, 0x01, 0x21, 0x01, 0x33, 0x01, 0x36, 0x01, 0x39, 0x01,
+  0x3c, 0x01, 0x41, 0x01, 0x45, 0x01, 0x48, 0x01, 0x4c, 0x01, 0x4f, 0x01,
+  0x56, 0x01, 0x59, 0x01, 0x5c, 0x01, 0x60, 0x01, 0x65, 0x01, 0x6c, 0x01,
+  0x6f, 0x01, 0x76, 0x01, 0x7c, 0x01, 0x80, 0x01, 0x83, 0x01, 0x85, 0x01,
+  0x87, 0x01, 0x8c, 0x01, 0x8d, 0x01, 0x8d, 0x01, 0x8e, 0x01, 0x8e, 0x01,
+  0x8e, 0x01, 0x91, 0x01, 0x94, 0x01, 0x98, 0x01, 0x9d, 0x01, 0xaa, 0x01,
+  0xb0, 0x01, 0xb2, 0x01, 0xb5, 0x01, 0xba, 0x01, 0xbc, 0x01, 0xbc, 0x01,
+  0xc4, 0x01, 0xc9, 0x01, 0xcc, 0x01, 0xcf, 0x01, 0xd3, 0x01, 0xd9, 0x01,
+  0xde, 0x01, 0xe2, 0x01, 0xe5, 0x01, 0xe7, 0x01, 0xe8, 0x01, 0xed, 0x01,
+  0xef, 0x01, 0xf0, 0x01, 0xf3, 0x01, 0xf9, 0x01, 0xfc, 0x01, 0xfd, 0x01,
+  0xfd, 0x01, 0x01, 0x02, 0x03, 0x02, 0x0d, 0x02, 0x11, 0x02, 0x11, 0x02,
+  0x15, 0x02, 0x16, 0x02, 0x17, 0x02, 0x19, 0x02, 0x1d, 0x02, 0x22, 0x02,
+  0x24, 0x02, 0x2a, 0x02, 0x2b, 0x02, 0x2d, 0x02, 0x30, 0x02, 0x33, 0x02,
+  0x35, 0x02, 0x3c, 0x02, 0x41, 0x02, 0x46, 0x02, 0x4a, 0x02, 0x4c, 0x02,
+  0x4c, 0x02, 0x4e, 0x02, 0x50, 0x02, 0x51, 0x02, 0x53, 0x02, 0x54, 0x02,
+  0x54, 0x02, 0x55, 0x02, 0x59, 0x02, 0x62, 0x02, 0x62, 0x02, 0x69, 0x02,
+  0x6a, 0x02, 0x6d, 0x02, 0x6d, 0x02, 0x6e, 0x02, 0x70, 0x02, 0x71, 0x02,
+  0x73, 0x02, 0x75, 0x02, 0x7a, 0x02, 0x80, 0x02, 0x82, 0x02, 0x83, 0x02,
+  0x86, 0x02, 0x86, 0x02, 0x86, 0x02, 0x8b, 0x02, 0x8b, 0x02, 0x8b, 0x02,
+  0x8f, 0x02, 0x92, 0x02, 0x92, 0x02, 0x93, 0x02, 0x94, 0x02, 0x94, 0x02,
+  0x94, 0x02, 0x95, 0x02, 0x95, 0x02, 0x97, 0x02, 0x98, 0x02, 0x9b, 0x02,
+  0xa4, 0x02, 0xa5, 0x02, 0xa6, 0x02, 0xa6, 0x02, 0xb1, 0x02, 0xb1, 0x02,
+  0xb3, 0x02, 0xb5, 0x02, 0xb9, 0x02, 0xbc, 0x02, 0xbc, 0x02, 0xc0, 0x02,
+  0xc3, 0x02, 0xc5, 0x02, 0xc7, 0x02, 0xc8, 0x02, 0xc9, 0x02, 0xd1, 0x02,
+  0xd6, 0x02, 0xd7, 0x02, 0xd9, 0x02, 0xe4, 0x02, 0xe6, 0x02, 0xe8, 0x02,
+  0xeb, 0x02, 0xeb, 0x02, 0xed, 0x02, 0xef, 0x02, 0xf1, 0x02, 0xf3, 0x02,
+  0xf6, 0x02, 0xfe, 0x02, 0xff, 0x02, 0x00, 0x03, 0x04, 0x03, 0x12, 0x03,
+  0x15, 0x03, 0x18, 0x03, 0x1a, 0x03, 0x1d, 0x03, 0x1f, 0x03, 0x20, 0x03,
+  0x20, 0x03, 0x21, 0x03, 0x22, 0x03, 0x24, 0x03, 0x28, 0x03, 0x2a, 0x03,
+  0x2d, 0x03, 0x2e, 0x03, 0x33, 0x03, 0x33, 0x03, 0x37, 0x03, 0x3c, 0x03,
+  0x3d, 0x03, 0x3e, 0x03, 0x3f, 0x03, 0x40, 0x03, 0x41, 0x03, 0x43, 0x03,
+  0x45, 0x03, 0x47, 0x03, 0x4a, 0x03, 0x4a, 0x03, 0x4c, 0x03, 0x4e, 0x03,
+  0x4f, 0x03, 0x52, 0x03, 0x53, 0x03, 0x57, 0x03, 0x58, 0x03, 0x59, 0x03,
+  0x5c, 0x03, 0x5d, 0x03, 0x5d, 0x03, 0x61, 0x03, 0x63, 0x03, 0x64, 0x03,
+  0x66, 0x03, 0x68, 0x03, 0x69, 0x03, 0x6a, 0x03, 0x6c, 0x03, 0x6e, 0x03,
+  0x6f, 0x03, 0x79, 0x03, 0x79, 0x03, 0x7e, 0x03, 0x80, 0x03, 0x82, 0x03,
+  0x83, 0x03, 0x84, 0x03, 0x87, 0x03, 0x87, 0x03, 0x87, 0x03, 0x88, 0x03,
+  0x8a, 0x03, 0x8c, 0x03, 0x8c, 0x03, 0x8d, 0x03, 0x8e, 0x03, 0x93, 0x03,
+  0x94, 0x03, 0x94, 0x03, 0x96, 0x03, 0x96, 0x03, 0x96, 0x03, 0x96, 0x03,
+  0x99, 0x03, 0x9a, 0x03, 0x9c, 0x03, 0xa1, 0x03, 0xa4, 0x03, 0xa4, 0x03,
+  0xa5, 0x03, 0xa6, 0x03, 0xa6, 0x03, 0xa7, 0x03, 0xa8, 0x03, 0xaa, 0x03,
+  0xab, 0x03, 0xad, 0x03, 0xae, 0x03, 0xae, 0x03, 0xb1, 0x03, 0xb2, 0x03,
+  0xb7, 0x03, 0xb8, 0x03, 0xb9, 0x03, 0xbc, 0x03, 0xbe, 0x03, 0xbf, 0x03,
+  0xc8, 0x03, 0xcc, 0x03, 0xcf, 0x03, 0xcf, 0x03, 0xd3, 0x03, 0xd7, 0x03,
+  0xdb, 0x03, 0xdf, 0x03, 0xe0, 0x03, 0xe3, 0x03, 0xe5, 0x03, 0xe7, 0x03,
+  0xe9, 0x03, 0xed, 0x03, 0xee, 0x03, 0xf3, 0x03, 0xf5, 0x03, 0xf6, 0x03,
+  0xf8, 0x03, 0xf8, 0x03, 0xf8, 0x03, 0xf9, 0x03, 0xf9, 0x03, 0xf9, 0x03,
+  0xfa, 0x03, 0xfd, 0x03, 0xfe, 0x03, 0x00, 0x04, 0x03, 0x04, 0x03, 0x04,
+  0x04, 0x04, 0x06, 0x04, 0x15, 0x04, 0x18, 0x04, 0x19, 0x04, 0x1b, 0x04,
+  0x1c, 0x04, 0x1d, 0x04, 0x1e, 0x04, 0x22, 0x04, 0x25, 0x04, 0x2a, 0x04,
+  0x2e, 0x04, 0x2e, 0x04, 0x30, 0x04, 0x32, 0x04, 0x35, 0x04, 0x38, 0x04,
+  0x3a, 0x04, 0x3d, 0x04, 0x40, 0x04, 0x46, 0x04, 0x48, 0x04, 0x4b, 0x04,
+  0x4f, 0x04, 0x50, 0x04, 0x52, 0x04, 0x55, 0x04, 0x58, 0x04, 0x5a, 0x04,
+  0x5f, 0x04, 0x5f, 0x04, 0x61, 0x04, 0x62, 0x04, 0x64, 0x04, 0x66, 0x04,
+  0x68, 0x04, 0x68, 0x04, 0x69, 0x04, 0x6b, 0x04, 0x6e, 0x04, 0x6f, 0x04,
+  0x6f, 0x04, 0x70, 0x04, 0x72, 0x04, 0x73, 0x04, 0x75, 0x04, 0x78, 0x04,
+  0x7d, 0x04, 0x7f, 0x04, 0x81, 0x04, 0x85, 0x04, 0x86, 0x04, 0x87, 0x04,
+  0x87, 0x04, 0x89, 0x04, 0x8a, 0x04, 0x8a, 0x04, 0x8c, 0x04, 0x8f, 0x04,
+  0x94, 0x04, 0x96, 0x04, 0x9a, 0x04, 0x9b, 0x04, 0x9d, 0x04, 0x9f, 0x04,
+  0xa1, 0x04, 0xa7, 0x04, 0xa8, 0x04, 0xa8, 0x04, 0xa8, 0x04, 0xa9, 0x04,
+  0xaa, 0x04, 0xaa, 0x04, 0xb2, 0x04, 0xb5, 0x04, 0xb7, 0x04, 0xb7, 0x04,
+  0xb9, 0x04, 0xbf, 0x04, 0xc4, 0x04, 0xcc, 0x04, 0xcc, 0x04, 0xd0, 0x04,
+  0xd5, 0x04, 0xd6, 0x04, 0xd8, 0x04, 0xda, 0x04, 0xdb, 0x04, 0xdb, 0x04,
+  0xdd, 0x04, 0xe1, 0x04, 0xe6, 0x04, 0xf7, 0x04, 0xfb, 0x04, 0xff, 0x04,
+  0x03, 0x05, 0x14, 0x05, 0x16, 0x05, 0x1a, 0x05, 0x1b, 0x05, 0x1b, 0x05,
+  0x1e, 0x05, 0x22, 0x05, 0x26, 0x05, 0x2c, 0x05, 0x2f, 0x05, 0x31, 0x05,
+  0x34, 0x05, 0x38, 0x05, 0x3d, 0x05, 0x3f, 0x05, 0x43, 0x05, 0x46, 0x05,
+  0x4b, 0x05, 0x50, 0x05, 0x53, 0x05, 0x55, 0x05, 0x57, 0x05, 0x59, 0x05,
+  0x5c, 0x05, 0x5f, 0x05, 0x62, 0x05, 0x69, 0x05, 0x69, 0x05, 0x6a, 0x05,
+  0x6d, 0x05, 0x6e, 0x05, 0x7a, 0x05, 0x7d, 0x05, 0x82, 0x05, 0x85, 0x05,
+  0x96, 0x05, 0x9a, 0x05, 0x9d, 0x05, 0xa0, 0x05, 0xac, 0x05, 0xad, 0x05,
+  0xaf, 0x05, 0xb8, 0x05, 0xbc, 0x05, 0xc0, 0x05, 0xc2, 0x05, 0xc4, 0x05,
+  0xc8, 0x05, 0xcb, 0x05, 0xcc, 0x05, 0xd1, 0x05, 0xd4, 0x05, 0xd5, 0x05,
+  0xdb, 0x05, 0xde, 0x05, 0xe4, 0x05, 0xe7, 0x05, 0xeb, 0x05, 0xec, 0x05,
+  0xf3, 0x05, 0xf4, 0x05, 0xf6, 0x05, 0xf7, 0x05, 0xfa, 0x05, 0xfa, 0x05,
+  0xfc, 0x05, 0xfd, 0x05, 0xff, 0x05, 0xff, 0x05, 0x01, 0x06, 0x02, 0x06,
+  0x03, 0x06, 0x04, 0x06, 0x05, 0x06, 0x0e, 0x06, 0x0f, 0x06, 0x10, 0x06,
+  0x10, 0x06, 0x12, 0x06, 0x13, 0x06, 0x14, 0x06, 0x1b, 0x06, 0x20, 0x06,
+  0x20, 0x06, 0x21, 0x06, 0x27, 0x06, 0x29, 0x06, 0x2a, 0x06, 0x2b, 0x06,
+  0x2f, 0x06, 0x31, 0x06, 0x34, 0x06, 0x36, 0x06, 0x37, 0x06, 0x39, 0x06,
+  0x3b, 0x06, 0x3c, 0x06, 0x3d, 0x06, 0x3f, 0x06, 0x3f, 0x06, 0x40, 0x06,
+  0x41, 0x06, 0x43, 0x06, 0x46, 0x06, 0x47, 0x06, 0x47, 0x06, 0x4a, 0x06,
+  0x4c, 0x06, 0x4d, 0x06, 0x53, 0x06, 0x53, 0x06, 0x56, 0x06, 0x57, 0x06,
+  0x5e, 0x06, 0x60, 0x06, 0x61, 0x06, 0x62, 0x06, 0x63, 0x06, 0x64, 0x06,
+  0x65, 0x06, 0x66, 0x06, 0x66, 0x06, 0x67, 0x06, 0x67, 0x06, 0x67, 0x06,
+  0x68, 0x06, 0x6c, 0x06, 0x6c, 0x06, 0x75, 0x06, 0x7a, 0x06, 0x7b, 0x06,
+  0x7c, 0x06, 0x87, 0x06, 0x89, 0x06, 0x8a, 0x06, 0x8a, 0x06, 0x8a, 0x06,
+  0x8e, 0x06, 0x91, 0x06, 0x93, 0x06, 0x96, 0x06, 0x98, 0x06, 0x9a, 0x06,
+  0x9d, 0x06, 0x9d, 0x06, 0xa2, 0x06, 0xa4, 0x06, 0xa6, 0x06, 0xa9, 0x06,
+  0xab, 0x06, 0xac, 0x06, 0xae, 0x06, 0xae, 0x06, 0xaf, 0x06, 0xb4, 0x06,
+  0xb5, 0x06, 0xb7, 0x06, 0xb9, 0x06, 0xc2, 0x06, 0xc4, 0x06, 0xc8, 0x06,
+  0xca, 0x06, 0xcd, 0x06, 0xcf, 0x06, 0xd6, 0x06, 0xda, 0x06, 0xdd, 0x06,
+  0xde, 0x06, 0xe0, 0x06, 0xe3, 0x06, 0xe6, 0x06, 0xef, 0x06, 0xef, 0x06,
+  0xf0, 0x06, 0xf3, 0x06, 0xf7, 0x06, 0xf9, 0x06, 0xf9, 0x06, 0xfe, 0x06,
+  0xff, 0x06, 0x04, 0x07, 0x07, 0x07, 0x08, 0x07, 0x0a, 0x07, 0x0b, 0x07,
+  0x0e, 0x07, 0x12, 0x07, 0x14, 0x07, 0x17, 0x07, 0x1a, 0x07, 0x22, 0x07,
+  0x25, 0x07, 0x2a, 0x07, 0x2c, 0x07, 0x2f, 0x07, 0x30, 0x07, 0x35, 0x07,
+  0x38, 0x07, 0x3a, 0x07, 0x3f, 0x07, 0x41, 0x07, 0x43, 0x07, 0x4a, 0x07,
+  0x50, 0x07, 0x56, 0x07, 0x5f, 0x07, 0x68, 0x07, 0x6e, 0x07, 0x75, 0x07,
+  0x7b, 0x07, 0x80, 0x07, 0x85, 0x07, 0x88, 0x07, 0x8d, 0x07, 0x94, 0x07,
+  0x9e, 0x07, 0xa1, 0x07, 0xa6, 0x07, 0xac, 0x07, 0xb1, 0x07, 0xb9, 0x07,
+  0xc2, 0x07, 0xcb, 0x07, 0xd2, 0x07, 0xda, 0x07, 0xe0, 0x07, 0xe7, 0x07,
+  0xf0, 0x07, 0xfb, 0x07, 0x01, 0x08, 0x06, 0x08, 0x0c, 0x08, 0x11, 0x08,
+  0x18, 0x08, 0x27, 0x08, 0x31, 0x08, 0x42, 0x08, 0x4e, 0x08, 0x5e, 0x08,
+  0x67, 0x08, 0x74, 0x08, 0x7e, 0x08, 0x87, 0x08, 0x8e, 0x08, 0x97, 0x08,
+  0x9e, 0x08, 0xa6, 0x08, 0xae, 0x08, 0xb4, 0x08, 0xba, 0x08, 0xc4, 0x08,
+  0xcd, 0x08, 0xd4, 0x08, 0xdc, 0x08, 0xe8, 0x08, 0xf6, 0x08, 0x02, 0x09,
+  0x0f, 0x09, 0x18, 0x09, 0x27, 0x09, 0x2e, 0x09, 0x36, 0x09, 0x3d, 0x09,
+  0x44, 0x09, 0x4c, 0x09, 0x56, 0x09, 0x5f, 0x09, 0x67, 0x09, 0x7c, 0x09,
+  0x83, 0x09, 0x95, 0x09, 0x9e, 0x09, 0xa5, 0x09, 0xb0, 0x09, 0xbd, 0x09,
+  0xc5, 0x09, 0xce, 0x09, 0xd8, 0x09, 0xe1, 0x09, 0xea, 0x09, 0xf4, 0x09,
+  0xfc, 0x09, 0x01, 0x0a, 0x09, 0x0a, 0x10, 0x0a, 0x19, 0x0a, 0x26, 0x0a,
+  0x2d, 0x0a, 0x36, 0x0a, 0x40, 0x0a, 0x4e, 0x0a, 0x56, 0x0a, 0x5f, 0x0a,
+  0x66, 0x0a, 0x6d, 0x0a, 0x76, 0x0a, 0x7f, 0x0a, 0x87, 0x0a, 0x8d, 0x0a,
+  0x92, 0x0a, 0x97, 0x0a, 0x9d, 0x0a, 0xa2, 0x0a, 0xa6, 0x0a, 0xb0, 0x0a,
+  0xb6, 0x0a, 0xbf, 0x0a, 0xc6, 0x0a, 0xcd, 0x0a, 0xd4, 0x0a, 0xdd, 0x0a,
+  0xe4, 0x0a, 0xe9, 0x0a, 0xef, 0x0a, 0xfa, 0x0a, 0x00, 0x0b, 0x05, 0x0b,
+  0x09, 0x0b, 0x0d, 0x0b, 0x11, 0x0b, 0x1a, 0x0b, 0x23, 0x0b, 0x28, 0x0b,
+  0x2e, 0x0b, 0x38, 0x0b, 0x41, 0x0b, 0x45, 0x0b, 0x48, 0x0b, 0x4c, 0x0b,
+  0x53, 0x0b, 0x58, 0x0b, 0x5f, 0x0b, 0x63, 0x0b, 0x68, 0x0b, 0x6b, 0x0b,
+  0x6f, 0x0b, 0x74, 0x0b, 0x77, 0x0b, 0x7d, 0x0b, 0x8a, 0x0b, 0x8f, 0x0b,
+  0x9b, 0x0b, 0x9f, 0x0b, 0xa3, 0x0b, 0xa8, 0x0b, 0xac, 0x0b, 0xb0, 0x0b,
+  0xb1, 0x0b, 0xb4, 0x0b, 0xb6, 0x0b, 0xb7, 0x0b, 0xb8, 0x0b, 0xb9, 0x0b,
+  0xbc, 0x0b, 0xbf, 0x0b, 0xc5, 0x0b, 0xcb, 0x0b, 0xcf, 0x0b, 0xd2, 0x0b,
+  0xd7, 0x0b, 0xde, 0x0b, 0xe7, 0x0b, 0xe7, 0x0b, 0xeb, 0x0b, 0xed, 0x0b,
+  0xee, 0x0b, 0xef, 0x0b, 0xf0, 0x0b, 0xf9, 0x0b, 0xfa, 0x0b, 0xff, 0x0b,
+  0x06, 0x0c, 0x0b, 0x0c, 0x11, 0x0c, 0x13, 0x0c, 0x15, 0x0c, 0x16, 0x0c,
+  0x19, 0x0c, 0x1c, 0x0c, 0x1d, 0x0c, 0x21, 0x0c, 0x27, 0x0c, 0x29, 0x0c,
+  0x33, 0x0c, 0x36, 0x0c, 0x3b, 0x0c, 0x3e, 0x0c, 0x4b, 0x0c, 0x50, 0x0c,
+  0x53, 0x0c, 0x57, 0x0c, 0x5a, 0x0c, 0x62, 0x0c, 0x68, 0x0c, 0x6f, 0x0c,
+  0x78, 0x0c, 0x7f, 0x0c, 0x85, 0x0c, 0x8c, 0x0c, 0x91, 0x0c, 0x99, 0x0c,
+  0xa0, 0x0c, 0xa5, 0x0c, 0xa8, 0x0c, 0xae, 0x0c, 0xb3, 0x0c, 0xb6, 0x0c,
+  0xb9, 0x0c, 0xbd, 0x0c, 0xbe, 0x0c, 0xc2, 0x0c, 0xcb, 0x0c, 0xcf, 0x0c,
+  0xda, 0x0c, 0xdf, 0x0c, 0xe9, 0x0c, 0xf2, 0x0c, 0xfb, 0x0c, 0x03, 0x0d,
+  0x10, 0x0d, 0x18, 0x0d, 0x1f, 0x0d, 0x28, 0x0d, 0x31, 0x0d, 0x3a, 0x0d,
+  0x43, 0x0d, 0x4d, 0x0d, 0x59, 0x0d, 0x60, 0x0d, 0x6a, 0x0d, 0x72, 0x0d,
+  0x78, 0x0d, 0x7d, 0x0d, 0x84, 0x0d, 0x88, 0x0d, 0x8d, 0x0d, 0x97, 0x0d,
+  0x9e, 0x0d, 0xa3, 0x0d, 0xaa, 0x0d, 0xb2, 0x0d, 0xb7, 0x0d, 0xb9, 0x0d,
+  0xbc, 0x0d, 0xc0, 0x0d, 0xcc, 0x0d, 0xd1, 0x0d, 0xd9, 0x0d, 0xe3, 0x0d,
+  0xea, 0x0d, 0xec, 0x0d, 0xf4, 0x0d, 0xfc, 0x0d, 0x01, 0x0e, 0x06, 0x0e,
+  0x0b, 0x0e, 0x0f, 0x0e, 0x17, 0x0e, 0x1a, 0x0e, 0x20, 0x0e, 0x23, 0x0e,
+  0x25, 0x0e, 0x28, 0x0e, 0x2c, 0x0e, 0x2d, 0x0e, 0x30, 0x0e, 0x34, 0x0e,
+  0x38, 0x0e, 0x3b, 0x0e, 0x43, 0x0e, 0x46, 0x0e, 0x4b, 0x0e, 0x4c, 0x0e,
+  0x4c, 0x0e, 0x4e, 0x0e, 0x4e, 0x0e, 0x51, 0x0e, 0x57, 0x0e, 0x58, 0x0e,
+  0x61, 0x0e, 0x62, 0x0e, 0x66, 0x0e, 0x66, 0x0e, 0x69, 0x0e, 0x6a, 0x0e,
+  0x6a, 0x0e, 0x6b, 0x0e, 0x6e, 0x0e, 0x70, 0x0e, 0x72, 0x0e, 0x73, 0x0e,
+  0x74, 0x0e, 0x77, 0x0e, 0x79, 0x0e, 0x79, 0x0e, 0x7a, 0x0e, 0x7f, 0x0e,
+  0x81, 0x0e, 0x81, 0x0e, 0x84, 0x0e, 0x87, 0x0e, 0x87, 0x0e, 0x89, 0x0e,
+  0x8d, 0x0e, 0x8f, 0x0e, 0x91, 0x0e, 0x93, 0x0e, 0x93, 0x0e, 0x93, 0x0e,
+  0x9a, 0x0e, 0xa3, 0x0e, 0xa3, 0x0e, 0xa8, 0x0e, 0xaa, 0x0e, 0xb1, 0x0e,
+  0xb2, 0x0e, 0xb5, 0x0e, 0xb6, 0x0e, 0xb6, 0x0e, 0xb7, 0x0e, 0xb8, 0x0e,
+  0xba, 0x0e, 0xbc, 0x0e, 0xbf, 0x0e, 0xbf, 0x0e, 0xc2, 0x0e, 0xc5, 0x0e,
+  0xc6, 0x0e, 0xcd, 0x0e, 0xd4, 0x0e, 0xd5, 0x0e, 0xda, 0x0e, 0xdc, 0x0e,
+  0xde, 0x0e, 0x00, 0x00, 0x8c, 0x02, 0x63, 0x31, 0x3e, 0xc6, 0x70, 0x35,
+  0x0b, 0x54, 0x24, 0x17, 0x17, 0x17, 0xef, 0x5b, 0x56, 0xd3, 0xf0, 0xa1,
+  0x16, 0x94, 0x79, 0x93, 0x64, 0xcf, 0xa7, 0x46, 0xf2, 0x4d, 0x4d, 0x16,
+  0xb4, 0x5a, 0x1d, 0x53, 0xed, 0xb7, 0xc1, 0x5a, 0x4f, 0xbb, 0xbb, 0x41,
+  0xbb, 0x5c, 0x70, 0x3e, 0x56, 0x93, 0x68, 0x3b, 0x67, 0x5e, 0x8d, 0x97,
+  0xeb, 0x90, 0x97, 0x60, 0x65, 0x3d, 0x3d, 0xa6, 0x94, 0x70, 0xec, 0xc1,
+  0x82, 0x1d, 0x74, 0x94, 0x89, 0xfe, 0x54, 0x09, 0x42, 0xff, 0xc7, 0xc9,
+  0xdf, 0x6e, 0x8a, 0x53, 0xe5, 0x71, 0xc4, 0xc4, 0xc4, 0xc4, 0x3b, 0x62,
+  0xf8, 0x4a, 0xb3, 0x60, 0xaf, 0x13, 0x65, 0xee, 0xd0, 0x7e, 0xa9, 0x6c,
+  0xe2, 0x43, 0x47, 0x33, 0xae, 0xbf, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+  0x35, 0x35, 0x08, 0xfc, 0xfb, 0xbe, 0x41, 0xb8, 0x88, 0x1f, 0x21, 0x45,
+  0xe3, 0xe3, 0xe3, 0xc5, 0x6e, 0x91, 0x9f, 0x95, 0x0e, 0x96, 0x99, 0x99,
+  0x99, 0x99, 0x99, 0x01, 0xe2, 0xb7, 0x03, 0xe5, 0xf6, 0x30, 0x30, 0x90,
+  0xef, 0x78, 0xc9, 0xdf, 0x49, 0xf9, 0x85, 0x5c, 0x1f, 0xf7, 0x7e, 0xea,
+  0x9e, 0x8b, 0xf3, 0xa7, 0xad, 0x05, 0x48, 0xdf, 0x2a, 0xb8, 0xa5, 0x89,
+  0xb3, 0xd6, 0x07, 0xa9, 0xfb, 0xb5, 0xa3, 0x91, 0x05, 0x0c, 0xaa, 0xda,
+  0x37, 0x48, 0x9a, 0xa1, 0xde, 0xe3, 0xe4, 0x05, 0x7e, 0x2d, 0xb1, 0xa8,
+  0x40, 0x40, 0x40, 0x77, 0xa8, 0x22, 0x86, 0x4c, 0x22, 0xd2, 0x9f, 0xa3,
+  0x04, 0xeb, 0xd9, 0x5b, 0xb3, 0x7d, 0x56, 0x31, 0x31, 0x31, 0x31, 0x31,
+  0x31, 0x31, 0x74, 0xff, 0xde, 0xef, 0xac, 0x58, 0xbe, 0x26, 0xa4, 0x5a,
+  0x53, 0x17, 0x8d, 0xc4, 0x93, 0x7f, 0x9d, 0x74, 0x0c, 0xe5, 0xc8, 0x6f,
+  0xd1, 0x3b, 0x0c, 0x28, 0xd1, 0x45, 0x1a, 0x0b, 0x5f, 0x13, 0x2b, 0xd1,
+  0xc6, 0xa1, 0x9c, 0x09, 0x50, 0x1e, 0xb1, 0x30, 0x6c, 0xe5, 0xfd, 0xff,
+  0xd2, 0xae, 0x45, 0xa5, 0xf5, 0x61, 0x61, 0xfb, 0x09, 0x39, 0xee, 0xd7,
+  0x54, 0xa1, 0x49, 0x04, 0x7c, 0xe7, 0x7a, 0x2c, 0x84, 0xde, 0x0a, 0x1a,
+  0x58, 0x69, 0x84, 0x6c, 0xb4, 0x0d, 0xbe, 0x66, 0x5b, 0xa5, 0xc3, 0x39,
+  0x16, 0xcf, 0x35, 0xbf, 0x9c, 0x1e, 0xa8, 0x94, 0x1d, 0x90, 0x02, 0xea,
+  0xa3, 0x80, 0x8e, 0x06, 0x67, 0x36, 0x4c, 0x82, 0x9d, 0x2c, 0x0d, 0xa3,
+  0xd4, 0x96, 0xc9, 0x22, 0x09, 0x48, 0xd8, 0x25, 0xed, 0x5d, 0x81, 0x29,
+  0x8e, 0x6f, 0x2e, 0xf7, 0x4d, 0xa4, 0x76, 0xb4, 0xfe, 0x49, 0x52, 0x0c,
+  0xcd, 0xfc, 0xdf, 0x8e, 0x6a, 0xe7, 0x04, 0xb0, 0x12, 0x84, 0x01, 0x27,
+  0x38, 0xf5, 0x13, 0x7d, 0xe4, 0xbf, 0x80, 0x17, 0x18, 0xfd, 0xd4, 0xb6,
+  0xbe, 0x89, 0x0f, 0x11, 0xd5, 0x32, 0x04, 0x2d, 0xb3, 0x08, 0x5c, 0xb9,
+  0xfb, 0x14, 0x8c, 0xe6, 0x72, 0xcb, 0x36, 0x8b, 0xdd, 0xbe, 0x44, 0x2e,
+  0xc3, 0x91, 0xb0, 0x26, 0xc8, 0x57, 0x24, 0x50, 0x01, 0x65, 0x79, 0x02,
+  0x0f, 0x82, 0xc9, 0xeb, 0x26, 0xf8, 0x89, 0x49, 0x63, 0xd6, 0x09, 0xcc,
+  0xb3, 0xf5, 0x5e, 0x1c, 0x27, 0xb4, 0xf2, 0xed, 0xd8, 0xe3, 0x9b, 0x79,
+  0xaa, 0x7d, 0xe2, 0xec, 0x24, 0x34, 0x56, 0xf3, 0x24, 0x5d, 0xa9, 0xa6,
+  0x24, 0x09, 0xd5, 0xbe, 0xeb, 0x9a, 0x49, 0xe3, 0x32, 0xfe, 0x72, 0xaf,
+  0x62, 0x1a, 0x9b, 0x1e, 0x7b, 0x25, 0xa6, 0x13, 0xc6, 0xaa, 0xb4, 0xad,
+  0x50, 0x9b, 0x75, 0x5a, 0xf9, 0x89, 0x81, 0x42, 0xdb, 0xff, 0x90, 0x6c,
+  0x3b, 0x10, 0xbb, 0x48, 0x5a, 0xf7, 0x08, 0x09, 0x9d, 0x88, 0x19, 0x37,
+  0x98, 0xbe, 0x72, 0xb2, 0x85, 0x0d, 0x9e, 0xc4, 0x05, 0x89, 0x59, 0xd9,
+  0x95, 0xf2, 0x62, 0x41, 0xbf, 0x45, 0xc6, 0xff, 0x36, 0x2e, 0x36, 0xe7,
+  0x27, 0x7a, 0xfd, 0xcf, 0x51, 0xd7, 0xcf, 0x09, 0xf0, 0x37, 0xc0, 0xde,
+  0x11, 0x36, 0xcf, 0x07, 0x93, 0xd8, 0xac, 0x15, 0x96, 0x80, 0x31, 0xd3,
+  0x88, 0xc9, 0x45, 0xff, 0x45, 0xc1, 0x14, 0x95, 0xce, 0xf2, 0xd5, 0xeb,
+  0xbd, 0x14, 0xdd, 0x57, 0x98, 0xb7, 0x9e, 0x99, 0xa3, 0x46, 0xcc, 0xa3,
+  0x38, 0x97, 0xac, 0x62, 0xdb, 0x46, 0xa5, 0x99, 0xc7, 0x77, 0x66, 0x75,
+  0xe8, 0xe0, 0x73, 0xb2, 0x4b, 0x3d, 0x22, 0x80, 0x5f, 0x9d, 0xac, 0x36,
+  0xb9, 0x27, 0xd7, 0x9c, 0x35, 0x8b, 0xec, 0x52, 0x27, 0x3c, 0xf9, 0x4f,
+  0x43, 0x4f, 0x63, 0x2b, 0x86, 0xc6, 0x35, 0x24, 0x37, 0x77, 0x00, 0x02,
+  0x0c, 0x08, 0xc8, 0x58, 0x80, 0x5a, 0x18, 0xfa, 0x74, 0xa0, 0x06, 0x53,
+  0x07, 0x26, 0x17, 0xd1, 0xfa, 0xfa, 0xfa, 0xfa, 0x99, 0xbc, 0xff, 0x0b,
+  0xb3, 0x14, 0x63, 0x03, 0xb2, 0x5b, 0x3a, 0xe4, 0xc9, 0x12, 0xcd, 0x9a,
+  0x62, 0x3d, 0xa0, 0x1a, 0x07, 0xd5, 0x4a, 0x05, 0x76, 0x20, 0x31, 0xdd,
+  0x97, 0xbb, 0x2b, 0x13, 0x9b, 0x8e, 0x2e, 0x8b, 0xec, 0x30, 0xc9, 0xd9,
+  0x8c, 0x18, 0x11, 0x77, 0xf9, 0xca, 0x1f, 0x0d, 0x05, 0x82, 0x06, 0x12,
+  0x3e, 0xd5, 0x2d, 0xef, 0x09, 0x7f, 0x01, 0xe4, 0x9b, 0x83, 0xd7, 0xa1,
+  0x01, 0x80, 0x94, 0xc4, 0x4a, 0x7f, 0x09, 0x05, 0x83, 0x0e, 0x8a, 0x2a,
+  0x7a, 0x08, 0x80, 0xcd, 0x78, 0xf4, 0x1d, 0x51, 0xf2, 0xa3, 0xb4, 0x80,
+  0x9b, 0x00, 0x54, 0x26, 0x30, 0x66, 0xf9, 0xaa, 0xff, 0xcb, 0x16, 0x16,
+  0x72, 0x37, 0x1e, 0x5d, 0x1a, 0x60, 0xbf, 0x37, 0x6c, 0xbc, 0xda, 0xda,
+  0xcb, 0x4f, 0x3e, 0xff, 0x7f, 0xf8, 0x0c, 0x72, 0xe5, 0x5d, 0x6c, 0x00,
+  0x21, 0x3c, 0xdc, 0x7b, 0x8e, 0x52, 0xef, 0x4a, 0xda, 0x98, 0x15, 0xf3,
+  0xa4, 0xc3, 0x99, 0x43, 0xef, 0xe8, 0xff, 0x97, 0x7f, 0x56, 0xfd, 0xfd,
+  0x41, 0xa9, 0xc6, 0x31, 0xe1, 0x99, 0x84, 0x33, 0xaa, 0xb5, 0xc0, 0x70,
+  0x77, 0xbb, 0x21, 0xc4, 0x0d, 0x4e, 0xb7, 0x76, 0xfb, 0x81, 0x5e, 0x96,
+  0x7a, 0x7a, 0x4e, 0xbd, 0x12, 0xc1, 0xc2, 0xe8, 0x81, 0xf6, 0x5c, 0x8d,
+  0x65, 0x23, 0xe9, 0x41, 0x35, 0x9d, 0x30, 0x74, 0xbc, 0xe1, 0xab, 0x2a,
+  0x24, 0x8b, 0x8f, 0x29, 0x0b, 0x15, 0xc3, 0x63, 0x34, 0x02, 0x71, 0xd5,
+  0xea, 0x92, 0x17, 0xa7, 0x90, 0x21, 0x0f, 0xe2, 0xf6, 0x92, 0x7b, 0xfe,
+  0x6f, 0x47, 0xa2, 0xf0, 0x46, 0x94, 0x25, 0x87, 0xa4, 0x86, 0xb2, 0xc0,
+  0x85, 0x5a, 0x17, 0x96, 0x57, 0x00, 0xb3, 0x26, 0x35, 0x31, 0x08, 0x2b,
+  0x33, 0x88, 0xef, 0x74, 0x25, 0x93, 0x00, 0x7e, 0x86, 0x9f, 0x99, 0xed,
+  0x79, 0xdf, 0x5e, 0x90, 0x58, 0xc3, 0xbd, 0xa6, 0x8e, 0x6b, 0xcb, 0x19,
+  0x9a, 0xbf, 0xc9, 0x98, 0xda, 0x6f, 0xce, 0xeb, 0x2e, 0x8a, 0x7d, 0x0f,
+  0xda, 0x53, 0x85, 0x40, 0x24, 0x4a, 0x8c, 0xdc, 0xf8, 0x13, 0x30, 0x3c,
+  0x87, 0xa5, 0xe4, 0x17, 0x50, 0xcc, 0x66, 0x60, 0xcd, 0xef, 0x2f, 0x4c,
+  0x6d, 0x81, 0x60, 0x06, 0x5a, 0x31, 0xfc, 0x06, 0xdb, 0x26, 0xbd, 0xe2,
+  0x79, 0x0a, 0x1b, 0x6d, 0xf4, 0xa7, 0xd0, 0x72, 0xf3, 0xd2, 0xd7, 0x23,
+  0xc1, 0x5c, 0x9b, 0xc4, 0x7e, 0x72, 0xdc, 0x07, 0x14, 0x5e, 0x2e, 0xa9,
+  0xec, 0x13, 0x13, 0x34, 0x3d, 0xc7, 0xd9, 0x4e, 0xa9, 0x3b, 0x0e, 0xf3,
+  0x65, 0xbe, 0x1a, 0xd0, 0x7b, 0x4a, 0x50, 0x3c, 0x91, 0x0c, 0x67, 0xab,
+  0x46, 0xf1, 0x04, 0x6c, 0xd7, 0xe1, 0x23, 0x91, 0xac, 0x86, 0x1e, 0xa6,
+  0x95, 0x1c, 0xbd, 0x6c, 0x9a, 0x33, 0xd2, 0x69, 0x4d, 0xa4, 0x1a, 0x76,
+  0xc5, 0x6b, 0x83, 0x78, 0xb4, 0x34, 0x55, 0xd8, 0x8f, 0x49, 0xc4, 0x0e,
+  0x82, 0x08, 0xfa, 0xc8, 0xf5, 0xf6, 0x13, 0x28, 0x09, 0x5a, 0x6a, 0x34,
+  0xa1, 0x86, 0x8b, 0xbd, 0xdc, 0x48, 0xc4, 0x82, 0x54, 0xb7, 0xf4, 0x59,
+  0x25, 0xf9, 0x4c, 0xf4, 0x7a, 0xd0, 0x9c, 0x65, 0x66, 0x43, 0x91, 0xeb,
+  0x8e, 0x3d, 0xc9, 0x91, 0x33, 0xe0, 0x5f, 0xa4, 0x7a, 0x55, 0x90, 0x8f,
+  0xc1, 0x1d, 0xf7, 0xed, 0x0e, 0x19, 0x17, 0x0e, 0xc9, 0xcd, 0xbb, 0x37,
+  0x6a, 0x6e, 0xd5, 0x57, 0x31, 0x9f, 0xa4, 0xb4, 0xf7, 0x36, 0xa3, 0x78,
+  0x70, 0xcd, 0x98, 0x07, 0xc5, 0x75, 0xe8, 0xc0, 0x96, 0x1d, 0xb6, 0x34,
+  0x13, 0xb0, 0xd7, 0xc9, 0x9a, 0x3f, 0xae, 0x19, 0xf1, 0x61, 0x84, 0x2f,
+  0x3c, 0x36, 0x03, 0x40, 0x07, 0xdc, 0xe4, 0xe0, 0x72, 0xe9, 0x60, 0x05,
+  0x73, 0x2a, 0x23, 0x92, 0x10, 0x5c, 0x45, 0x15, 0x72, 0x99, 0xbe, 0xca,
+  0xcb, 0x9c, 0x00, 0x6b, 0x1f, 0xa2, 0xb0, 0x35, 0xfe, 0x54, 0xc6, 0x26,
+  0x45, 0xc6, 0x41, 0x57, 0x5d, 0x63, 0xff, 0x1c, 0x78, 0x96, 0x1d, 0x9e,
+  0x94, 0x48, 0xd4, 0x40, 0xb3, 0x3e, 0xd1, 0x88, 0xd3, 0x6a, 0x29, 0x29,
+  0x29, 0x29, 0x29, 0x29, 0x29, 0x2f, 0xd1, 0x35, 0x50, 0xb3, 0x47, 0x69,
+  0x49, 0xb2, 0x94, 0x74, 0x94, 0xbc, 0xa0, 0xf4, 0xf4, 0x3d, 0x12, 0xf6,
+  0x2f, 0x26, 0xe4, 0x5d, 0xe7, 0x9c, 0xc5, 0xe2, 0x0e, 0x30, 0xa6, 0x91,
+  0xa0, 0x56, 0xa9, 0xd8, 0xb6, 0x1f, 0xef, 0xc1, 0x35, 0x03, 0xc9, 0xad,
+  0xa3, 0xc1, 0x59, 0x77, 0xb1, 0x51, 0x98, 0x14, 0x63, 0x9e, 0xe2, 0x0e,
+  0x8a, 0x68, 0xde, 0xc4, 0x0a, 0xdb, 0x8e, 0xf9, 0x08, 0x54, 0x61, 0x9a,
+  0x3e, 0x2f, 0x60, 0x6b, 0x09, 0xb2, 0xbc, 0xec, 0xee, 0x21, 0xd4, 0x98,
+  0x2e, 0xe3, 0x6a, 0x08, 0xbf, 0x4a, 0x8b, 0xaa, 0x65, 0xb3, 0x27, 0x21,
+  0x1c, 0x7b, 0x29, 0x7f, 0xcb, 0x16, 0xe9, 0x1e, 0x2e, 0x77, 0x85, 0xc4,
+  0x7c, 0xb1, 0x18, 0x18, 0x0d, 0xba, 0x83, 0xed, 0x6d, 0x74, 0x10, 0x7d,
+  0xae, 0xd0, 0x78, 0x7b, 0x9b, 0xc1, 0xf9, 0x6b, 0xd8, 0xdb, 0xdb, 0xae,
+  0xf0, 0x71, 0x9b, 0x7f, 0xd3, 0xcb, 0x2c, 0xc8, 0x7a, 0x5f, 0x86, 0xfc,
+  0x50, 0x4d, 0xd0, 0xda, 0x70, 0x3d, 0x70, 0xd0, 0xc8, 0x5b, 0x76, 0xb7,
+  0xb8, 0xa4, 0xed, 0x11, 0x02, 0x03, 0x29, 0x42, 0x51, 0xc8, 0xb3, 0x97,
+  0xfb, 0xe1, 0x4d, 0x70, 0xa9, 0xe7, 0x01, 0xf4, 0x95, 0x22, 0x6b, 0x0e,
+  0xce, 0x72, 0x51, 0x51, 0x51, 0x51, 0x51, 0x15, 0x08, 0xa7, 0x1d, 0xd9,
+  0xfe, 0xb5, 0xe0, 0xf2, 0x9d, 0xec, 0xb1, 0x0f, 0xcb, 0x3a, 0xb5, 0xe5,
+  0xb4, 0x8a, 0x6e, 0x65, 0x85, 0x2e, 0x22, 0xd2, 0x93, 0x22, 0xf9, 0x9c,
+  0x11, 0x56, 0x53, 0xc6, 0xa5, 0x14, 0xd1, 0xdb, 0x1b, 0x31, 0x07, 0x22,
+  0x8d, 0xbe, 0x1e, 0x73, 0xdb, 0x6d, 0xc4, 0x95, 0x41, 0x64, 0xb2, 0x57,
+  0x29, 0x2f, 0xeb, 0xf9, 0x95, 0x31, 0x5b, 0x5a, 0x4c, 0x90, 0x52, 0xb5,
+  0x1a, 0x86, 0x96, 0x18, 0x0a, 0xce, 0x44, 0x41, 0xf9, 0x56, 0x56, 0x56,
+  0xf6, 0x51, 0x56, 0x31, 0x23, 0x3c, 0x7b, 0x87, 0xad, 0x7d, 0x0c, 0x75,
+  0x44, 0x70, 0x12, 0x7a, 0xdb, 0x29, 0x7c, 0x9f, 0x94, 0x62, 0xfb, 0x74,
+  0x0a, 0xc6, 0xf7, 0xc6, 0x07, 0x4c, 0xd2, 0xd3, 0xef, 0x51, 0x4a, 0x1e,
+  0xd9, 0x76, 0x7b, 0x3f, 0xc0, 0xe6, 0x02, 0x08, 0x1b, 0x49, 0xaa, 0x96,
+  0x7a, 0xe3, 0x5a, 0x9b, 0x10, 0x66, 0x71, 0xcf, 0xd4, 0xb2, 0x9b, 0x81,
+  0xd4, 0xb2, 0xc5, 0xa2, 0x73, 0x71, 0x11, 0xce, 0x36, 0x48, 0xd7, 0x8b,
+  0x40, 0xe2, 0x28, 0xf2, 0x9a, 0x0d, 0xe9, 0x7a, 0xa2, 0x13, 0x1d, 0xb6,
+  0xb6, 0xb6, 0xb6, 0xb6, 0xd3, 0xd3, 0x96, 0x98, 0xd2, 0xd8, 0x04, 0x01,
+  0x98, 0x83, 0x4e, 0xc2, 0xb0, 0xb0, 0xd3, 0x13, 0x1b, 0x18, 0xf6, 0x40,
+  0x66, 0x7d, 0xc8, 0xe3, 0x8c, 0xfb, 0x0f, 0x48, 0x9a, 0x0d, 0x12, 0x18,
+  0x15, 0x6b, 0x1d, 0xa7, 0x65, 0x29, 0x1c, 0xd6, 0x77, 0x53, 0xeb, 0x85,
+  0x21, 0xc8, 0x6d, 0xd6, 0x13, 0xa5, 0x04, 0xeb, 0x18, 0xa3, 0xc7, 0xda,
+  0xed, 0x1f, 0x09, 0x23, 0xd4, 0xe3, 0x2f, 0xf6, 0x9c, 0x82, 0x70, 0xf5,
+  0x53, 0x8c, 0x08, 0x47, 0xcc, 0xeb, 0xd3, 0x58, 0xc4, 0xb0, 0x5b, 0xf7,
+  0x20, 0x3b, 0x79, 0xc8, 0x31, 0xf2, 0x84, 0xab, 0x2d, 0xb1, 0x80, 0x23,
+  0xf1, 0x7c, 0xc1, 0xed, 0xad, 0x28, 0xfd, 0x99, 0x11, 0x5d, 0x9f, 0x33,
+  0x28, 0x3e, 0x9d, 0x82, 0xce, 0x43, 0x14, 0xab, 0xee, 0x48, 0x7e, 0xa7,
+  0x8c, 0x09, 0xac, 0xa4, 0x66, 0xf3, 0x81, 0x8f, 0x3e, 0xae, 0xa5, 0xe6,
+  0xbf, 0xcc, 0x38, 0xc4, 0x1a, 0x05, 0x33, 0xb0, 0xd4, 0x76, 0xab, 0xda,
+  0x79, 0xa0, 0x3a, 0x09, 0x77, 0xf9, 0xab, 0x43, 0xbd, 0x79, 0x06, 0xaf,
+  0x21, 0xa4, 0xee, 0xe3, 0x65, 0x9f, 0x9b, 0x56, 0xbe, 0x03, 0x3b, 0x21,
+  0xd0, 0x73, 0x01, 0x6a, 0x45, 0xd9, 0x3a, 0x40, 0xa8, 0x6b, 0x40, 0xc9,
+  0x80, 0x53, 0x04, 0xf7, 0x98, 0x58, 0x8b, 0x61, 0x4a, 0x70, 0x46, 0xaa,
+  0xfe, 0x3d, 0x99, 0x3c, 0xb7, 0xbd, 0xd7, 0x51, 0xfc, 0xc4, 0xe0, 0xc9,
+  0x79, 0x43, 0xbe, 0x19, 0xaf, 0x82, 0xae, 0x3d, 0x95, 0x08, 0x20, 0xda,
+  0x6b, 0x00, 0x6a, 0x72, 0xf6, 0x00, 0x31, 0xe4, 0xdc, 0x3c, 0xe8, 0xf6,
+  0x21, 0x86, 0x08, 0x83, 0xa7, 0xd0, 0xde, 0x79, 0x87, 0x67, 0x1f, 0x64,
+  0x28, 0xe5, 0xad, 0xe6, 0x06, 0x40, 0xa0, 0xc2, 0xab, 0x6c, 0x3d, 0x7d,
+  0x1d, 0xfd, 0xaf, 0x2b, 0x2a, 0xed, 0x5c, 0xfd, 0xc0, 0x66, 0x49, 0xd5,
+  0x36, 0x63, 0x6b, 0xa3, 0x05, 0x1b, 0xc4, 0x9a, 0xf4, 0xbb, 0xc0, 0x2c,
+  0x9b, 0x1a, 0x3a, 0xce, 0x24, 0xd5, 0xb5, 0x2a, 0x0b, 0x47, 0xb6, 0x4f,
+  0x2b, 0xf7, 0xd4, 0xc2, 0x61, 0xad, 0x43, 0xe6, 0x58, 0xcd, 0x7e, 0x41,
+  0x21, 0xc9, 0xa7, 0xa5, 0xbb, 0xa4, 0x50, 0x11, 0x75, 0x09, 0xc8, 0xba,
+  0xbb, 0x48, 0x80, 0x1a, 0x0f, 0x9c, 0xcc, 0xcc, 0x10, 0xac, 0x84, 0x9b,
+  0x02, 0x7c, 0xbc, 0xa0, 0x75, 0xd6, 0xef, 0xe1, 0x48, 0x80, 0xe7, 0x67,
+  0x5d, 0x8d, 0x0b, 0x6c, 0x4c, 0x6a, 0x6f, 0xc3, 0xb5, 0xd6, 0x35, 0x9e,
+  0x20, 0x4d, 0x44, 0xc2, 0x76, 0x4a, 0xac, 0xa6, 0x02, 0x93, 0x3f, 0x94,
+  0x3e, 0x5e, 0xf1, 0xf4, 0x56, 0x51, 0x21, 0x8f, 0xcf, 0x5d, 0x64, 0xad,
+  0xe9, 0x63, 0x93, 0x4d, 0x40, 0x60, 0x0f, 0x2e, 0x4f, 0xe8, 0x03, 0xa4,
+  0x03, 0xf0, 0x18, 0x7f, 0x40, 0x17, 0x62, 0x89, 0x38, 0x2e, 0xf8, 0xf2,
+  0x81, 0xcb, 0x79, 0x38, 0x38, 0xf9, 0xbe, 0xb4, 0x96, 0x38, 0x32, 0xbd,
+  0xd2, 0xac, 0x23, 0x4a, 0x8f, 0x13, 0xd1, 0x78, 0x8c, 0x31, 0xa0, 0x09,
+  0x60, 0xe6, 0x32, 0x80, 0x59, 0xf4, 0x49, 0x61, 0x4e, 0xfb, 0x92, 0x08,
+  0x7c, 0x80, 0xc7, 0x17, 0xdd, 0x68, 0x3e, 0x78, 0xc0, 0xe9, 0xb7, 0xb6,
+  0xe2, 0x7f, 0x1a, 0xa9, 0x3a, 0x6f, 0x64, 0x22, 0x25, 0x70, 0xe2, 0x80,
+  0x5d, 0xec, 0x8a, 0x97, 0xa7, 0x35, 0xc4, 0x4e, 0x14, 0x9b, 0x79, 0x0e,
+  0x55, 0x9b, 0x7c, 0xc2, 0xfc, 0x39, 0xba, 0x3f, 0x78, 0x60, 0xf4, 0x14,
+  0xd6, 0x0f, 0xb5, 0xe9, 0x6b, 0xaf, 0x74, 0xea, 0xa3, 0x0e, 0x5a, 0x4e,
+  0x4d, 0xb3, 0xd0, 0xcd, 0xe1, 0xa3, 0x79, 0x33, 0x9b, 0x2a, 0xdc, 0xd2,
+  0x23, 0x32, 0x6f, 0x61, 0x69, 0xa6, 0xd1, 0x46, 0xda, 0xc9, 0x1f, 0x32,
+  0xd9, 0x44, 0x18, 0x89, 0x9b, 0x65, 0xf9, 0x94, 0x3e, 0x53, 0xd4, 0x23,
+  0x68, 0x03, 0x36, 0x1f, 0x73, 0x98, 0xeb, 0xfe, 0x65, 0x65, 0x65, 0x65,
+  0x1d, 0xe9, 0x65, 0xf9, 0x9c, 0xaa, 0xed, 0xe8, 0x0f, 0x70, 0x0d, 0x79,
+  0x75, 0x5c, 0xd3, 0x42, 0x4e, 0xec, 0xe5, 0xaf, 0x03, 0xef, 0x1d, 0x40,
+  0x58, 0x48, 0xa2, 0x95, 0xda, 0xf9, 0xac, 0x79, 0x89, 0xce, 0xcd, 0x34,
+  0x53, 0x34, 0x10, 0x35, 0xe2, 0x6a, 0x21, 0xea, 0x7f, 0x6f, 0x95, 0xca,
+  0x56, 0xe3, 0x5d, 0xac, 0xcd, 0xa9, 0x61, 0xc5, 0x40, 0x36, 0xe6, 0x97,
+  0xf6, 0x5b, 0xbb, 0x5f, 0xd9, 0x7a, 0xd4, 0xf2, 0x2e, 0xf3, 0x2e, 0x9e,
+  0x06, 0xec, 0x6f, 0x7c, 0xd9, 0x40, 0x5b, 0x5b, 0xcb, 0x7a, 0xb3, 0x62,
+  0x94, 0x3c, 0xf6, 0x92, 0xfb, 0xd1, 0xe4, 0x75, 0x9b, 0x20, 0x9d, 0x66,
+  0x2a, 0x11, 0x75, 0x54, 0x1d, 0x0a, 0x8d, 0xf4, 0xec, 0x9a, 0x87, 0x89,
+  0xf4, 0xc4, 0x71, 0xf1, 0xd8, 0x11, 0x7c, 0x7f, 0x34, 0x63, 0x72, 0x22,
+  0xc7, 0x89, 0xbe, 0x2b, 0x5a, 0x56, 0xeb, 0x50, 0x1d, 0x13, 0x12, 0xbf,
+  0xe8, 0xc3, 0x47, 0xb6, 0xa0, 0x28, 0x41, 0x5e, 0x43, 0x3b, 0x03, 0x48,
+  0xd6, 0xce, 0x29, 0xa0, 0x91, 0xdf, 0x1f, 0x6d, 0xa3, 0xa8, 0x82, 0x26,
+  0x5a, 0x42, 0x24, 0xa7, 0x8b, 0x9c, 0xd7, 0x55, 0xfe, 0xb4, 0xa7, 0x36,
+  0x8c, 0x16, 0x7a, 0xf5, 0x66, 0xde, 0x7f, 0x03, 0xa2, 0xa5, 0x2b, 0x3e,
+  0xd5, 0x55, 0xc4, 0x93, 0x51, 0x37, 0x1d, 0x1a, 0x38, 0x64, 0x90, 0x68,
+  0x57, 0x84, 0x6e, 0x5d, 0x45, 0x8e, 0x8c, 0xb0, 0xf2, 0x06, 0xf0, 0x0e,
+  0x84, 0x06, 0x3c, 0x07, 0x8e, 0xc1, 0x64, 0xe8, 0x34, 0xc7, 0x5f, 0x05,
+  0x35, 0x41, 0xf9, 0xf6, 0x7b, 0xa6, 0x10, 0x76, 0xa1, 0x78, 0xef, 0x93,
+  0x9a, 0xdd, 0x99, 0xb0, 0xae, 0x1e, 0x1e, 0xde, 0x8f, 0xce, 0xe2, 0xc4,
+  0x6d, 0xe5, 0x2e, 0x8f, 0x53, 0x21, 0x61, 0x51, 0x64, 0x3c, 0xf1, 0xfd,
+  0x0b, 0x2a, 0x5e, 0xc7, 0xbe, 0x45, 0x77, 0x3e, 0x68, 0x15, 0xb3, 0xbb,
+  0xed, 0x18, 0xa6, 0x1a, 0x81, 0xc9, 0x59, 0x80, 0x69, 0x9e, 0x19, 0x09,
+  0x84, 0xb0, 0x12, 0x37, 0xe3, 0x89, 0x9b, 0x33, 0x2f, 0xaa, 0x7e, 0xa7,
+  0x48, 0xda, 0xab, 0x99, 0xf1, 0x0b, 0xd3, 0xb1, 0xa8, 0xfc, 0xb4, 0x5a,
+  0x70, 0x8f, 0x9a, 0x66, 0xbf, 0xbc, 0x34, 0xf6, 0x76, 0x9a, 0x5c, 0x78,
+  0xcc, 0x28, 0x24, 0x41, 0xe5, 0x0e, 0xce, 0xe7, 0x7b, 0xd8, 0xaf, 0xfe,
+  0xaa, 0x3a, 0x85, 0xc3, 0x2d, 0xd8, 0xd9, 0x05, 0x21, 0xdd, 0x5f, 0xbd,
+  0x79, 0x0f, 0x95, 0x18, 0x6d, 0xf3, 0xfc, 0x6c, 0xa9, 0xce, 0xd1, 0xeb,
+  0x9e, 0x1c, 0x4b, 0xcb, 0xb3, 0xef, 0xe2, 0x0b, 0x42, 0xb5, 0xf4, 0xc0,
+  0x10, 0x38, 0x38, 0x94, 0x0e, 0x91, 0x3b, 0x30, 0xa7, 0x95, 0xa8, 0xaf,
+  0x25, 0x78, 0x29, 0x89, 0xb1, 0x56, 0x5f, 0x01, 0xff, 0x3b, 0x45, 0x1c,
+  0x25, 0xcf, 0x4f, 0x08, 0xa5, 0xd0, 0x5a, 0xfa, 0xf7, 0x8c, 0x3a, 0x5e,
+  0x7f, 0x6a, 0x89, 0x39, 0x54, 0xc7, 0x69, 0x2f, 0xac, 0x73, 0xd5, 0xbd,
+  0xf0, 0x8c, 0xfe, 0x1f, 0xca, 0xe6, 0x6b, 0xf7, 0xbb, 0x9e, 0xaa, 0x10,
+  0x31, 0xfa, 0x4a, 0xc4, 0x05, 0x7f, 0x2d, 0xf8, 0xad, 0xa3, 0x0a, 0xd0,
+  0x57, 0xda, 0xe4, 0x97, 0xbd, 0x93, 0xf0, 0x87, 0x3d, 0xd7, 0x95, 0xd7,
+  0xf9, 0x44, 0x20, 0x80, 0x30, 0xac, 0x26, 0x74, 0x38, 0x07, 0x18, 0xd0,
+  0xba, 0xf3, 0x73, 0x10, 0xb0, 0xb2, 0xde, 0x61, 0x63, 0x4b, 0x5b, 0x1d,
+  0x83, 0x1f, 0x01, 0xaa, 0x92, 0xa0, 0x90, 0x65, 0x47, 0x32, 0x1e, 0x22,
+  0xd5, 0xe5, 0x95, 0x42, 0xea, 0x73, 0x51, 0xf3, 0x58, 0x70, 0x66, 0xce,
+  0xe6, 0x3f, 0xe4, 0x05, 0xb4, 0x86, 0x21, 0xc0, 0x0a, 0xf0, 0xd2, 0x62,
+  0xda, 0x03, 0x91, 0x00, 0x3c, 0xfa, 0x79, 0x4c, 0x8f, 0x98, 0x44, 0x40,
+  0x03, 0xd1, 0x64, 0x04, 0x9f, 0x99, 0x8b, 0xff, 0xa3, 0x25, 0xf7, 0xaa,
+  0x8a, 0x68, 0x58, 0x69, 0x61, 0x62, 0xb4, 0x66, 0xd0, 0x05, 0xed, 0xfb,
+  0xfd, 0xa7, 0xc7, 0x8b, 0x60, 0x81, 0xd2, 0x9e, 0xbb, 0x7b, 0x52, 0x24,
+  0xe8, 0x8d, 0x81, 0x36, 0x72, 0xff, 0xd2, 0x10, 0x39, 0x70, 0xd6, 0xb2,
+  0xb0, 0x01, 0xd4, 0xaf, 0xbf, 0x33, 0xba, 0x6a, 0x24, 0xf3, 0x4b, 0x1a,
+  0x01, 0x5f, 0x5c, 0xd1, 0x2a, 0xbf, 0x2d, 0x3d, 0x97, 0xcb, 0x41, 0xb4,
+  0x2a, 0xbb, 0xae, 0x76, 0x65, 0x31, 0x1d, 0xae, 0xf6, 0xc3, 0x82, 0xc9,
+  0xe5, 0x02, 0xff, 0xac, 0xc0, 0x66, 0x54, 0xfa, 0x64, 0x4f, 0xd1, 0xf3,
+  0x46, 0xd9, 0x7a, 0x7a, 0x7c, 0xe9, 0x37, 0x25, 0xe5, 0x30, 0x13, 0x8e,
+  0xfa, 0x9a, 0xba, 0x86, 0x24, 0x2f, 0x4a, 0x0c, 0xe4, 0x49, 0x9d, 0x78,
+  0x3a, 0xbd, 0xd9, 0x37, 0xc9, 0x2f, 0x72, 0xaa, 0x80, 0x38, 0xfc, 0x46,
+  0x9e, 0x07, 0x47, 0x0f, 0x82, 0xd4, 0xee, 0x8a, 0x4e, 0xea, 0x1f, 0x15,
+  0x01, 0x41, 0x0c, 0x28, 0xdf, 0x1c, 0x14, 0xb3, 0xe2, 0x9f, 0x46, 0x6f,
+  0x36, 0x57, 0x28, 0x22, 0x4c, 0xb7, 0xf4, 0xe2, 0xad, 0x44, 0xbb, 0xed,
+  0xe6, 0x63, 0x83, 0xfa, 0x57, 0xb6, 0x57, 0x42, 0x10, 0x03, 0x11, 0x92,
+  0x1a, 0x25, 0x0a, 0x21, 0xb0, 0x54, 0x87, 0xf2, 0x91, 0x74, 0xef, 0x76,
+  0x2f, 0x06, 0xcd, 0x1f, 0xc8, 0xbd, 0xf7, 0x1d, 0x33, 0x04, 0xeb, 0xd6,
+  0x40, 0x30, 0x33, 0x3b, 0xe2, 0xf8, 0xb0, 0xc2, 0x97, 0x1d, 0x7a, 0x10,
+  0xcd, 0x3a, 0x02, 0x8f, 0xf4, 0xe6, 0x4c, 0xa9, 0xaf, 0x5b, 0x85, 0xc5,
+  0x5b, 0xce, 0x13, 0x51, 0xc6, 0x31, 0x70, 0x54, 0xe0, 0xbb, 0x74, 0x35,
+  0x3a, 0x12, 0x5d, 0xeb, 0xf3, 0x70, 0x9f, 0x8f, 0x5f, 0x8e, 0xa1, 0xe2,
+  0x0a, 0x98, 0x17, 0xfe, 0xb5, 0x1c, 0x9b, 0x61, 0x73, 0x8a, 0x0d, 0x8f,
+  0x5b, 0x3e, 0xb9, 0x5d, 0x65, 0x5b, 0xf0, 0x74, 0x3f, 0xe4, 0x39, 0xa0,
+  0xdc, 0x81, 0x5a, 0x27, 0xe7, 0x38, 0xdc, 0xcb, 0x31, 0xab, 0x4a, 0xc0,
+  0xc5, 0xed, 0x70, 0xb6, 0x77, 0x6b, 0xe3, 0xc8, 0xa1, 0xff, 0x46, 0x9a,
+  0x54, 0x6b, 0xb2, 0x83, 0x36, 0xf8, 0x88, 0x3a, 0xe5, 0xa3, 0x17, 0xc1,
+  0x81, 0xb8, 0xf8, 0x13, 0xd1, 0x57, 0x39, 0xb4, 0x12, 0xad, 0xda, 0xe5,
+  0x5b, 0xea, 0x6d, 0x7f, 0x92, 0x2f, 0x30, 0xba, 0xaf, 0xc2, 0x38, 0x0f,
+  0xb9, 0x26, 0xdd, 0x39, 0x6e, 0xfe, 0x23, 0x94, 0x57, 0x59, 0x59, 0x59,
+  0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x62, 0x55, 0xae, 0x9a, 0x6b, 0x39,
+  0x0c, 0x65, 0x60, 0x56, 0xc8, 0x60, 0x80, 0x96, 0xcd, 0xc0, 0x34, 0xd7,
+  0xe9, 0x3f, 0xda, 0x61, 0x56, 0xba, 0xfe, 0x9c, 0x8c, 0x01, 0xdf, 0x1a,
+  0x0c, 0x0e, 0x7f, 0x1f, 0x53, 0x21, 0x0d, 0xa1, 0xbd, 0x72, 0xc6, 0x28,
+  0xba, 0x9a, 0xa9, 0x3c, 0x46, 0xd8, 0x4a, 0xf7, 0x54, 0xd7, 0x1c, 0x6a,
+  0x8d, 0xf4, 0xc3, 0x35, 0x41, 0xfc, 0xc4, 0xf4, 0x98, 0xfe, 0xb8, 0x17,
+  0x07, 0x72, 0x01, 0xfe, 0xee, 0x6e, 0x0e, 0x78, 0xff, 0xc0, 0x96, 0x95,
+  0xcb, 0x3f, 0xba, 0xd8, 0x51, 0xa5, 0x25, 0x45, 0xa4, 0x13, 0xeb, 0x95,
+  0xdd, 0x46, 0x9e, 0xaf, 0xf5, 0x2c, 0xbf, 0xb4, 0xf7, 0xcd, 0x80, 0x7f,
+  0xc2, 0x23, 0x3d, 0x19, 0x0f, 0x03, 0xc4, 0xb8, 0x6c, 0x50, 0xae, 0x86,
+  0x57, 0x21, 0x30, 0x05, 0x31, 0x5f, 0x1f, 0x5d, 0x39, 0x44, 0x8d, 0x9b,
+  0x3e, 0x4c, 0xe6, 0xb7, 0xfb, 0x37, 0x34, 0x0e, 0xde, 0x05, 0xf3, 0x7f,
+  0x35, 0xd1, 0x5c, 0x49, 0x83, 0x6e, 0xaa, 0x45, 0xdf, 0x01, 0x45, 0x7b,
+  0xda, 0xf2, 0x31, 0xa4, 0xe7, 0xdb, 0x4a, 0x20, 0xf7, 0xf3, 0x8d, 0xdb,
+  0xae, 0xc6, 0x16, 0x1f, 0xf2, 0x40, 0x6b, 0x39, 0xef, 0x6e, 0xe4, 0x24,
+  0x50, 0xbb, 0x6c, 0x31, 0xdb, 0xb0, 0xa4, 0xa1, 0x43, 0x30, 0x5e, 0x7f,
+  0xd9, 0x07, 0xa3, 0xf8, 0xc7, 0xff, 0xfc, 0x17, 0x12, 0x82, 0x46, 0xf0,
+  0x7f, 0x92, 0x36, 0xbe, 0x0d, 0x6d, 0x4d, 0x2f, 0xbd, 0x50, 0x34, 0xd9,
+  0x9c, 0xd7, 0xec, 0x5b, 0x08, 0xd3, 0xef, 0xae, 0x85, 0xd5, 0xa3, 0xff,
+  0x63, 0xff, 0xcc, 0x55, 0x47, 0x50, 0xa4, 0x6e, 0x59, 0x4c, 0xe0, 0xd0,
+  0xe6, 0x1a, 0xbd, 0x99, 0xe9, 0xf8, 0x7a, 0x66, 0xb9, 0x8e, 0x76, 0x0c,
+  0xfb, 0xc7, 0x33, 0x0f, 0x91, 0x74, 0x97, 0xbe, 0x9e, 0xca, 0xd9, 0x4e,
+  0xe2, 0x39, 0x16, 0x2f, 0xf2, 0xcc, 0xd9, 0xe7, 0xf8, 0xb3, 0xfc, 0x71,
+  0x90, 0x56, 0x29, 0x74, 0xf5, 0x37, 0xf2, 0x3a, 0xf0, 0x7e, 0xba, 0xc3,
+  0x98, 0x89, 0x44, 0x6d, 0x7e, 0x68, 0x0b, 0x74, 0xb7, 0x09, 0xb3, 0xe0,
+  0x98, 0x66, 0x6f, 0x2a, 0xaa, 0xfd, 0x89, 0xbb, 0x67, 0x4d, 0x0e, 0x7b,
+  0xf4, 0xde, 0x8e, 0x8c, 0x9d, 0x6c, 0xac, 0x7d, 0x1e, 0xe9, 0xfd, 0xa9,
+  0x2c, 0x7f, 0xa2, 0xdd, 0xa1, 0x8c, 0x4d, 0xc7, 0x4c, 0x2b, 0x3c, 0xda,
+  0xd2, 0x13, 0x92, 0xd6, 0xf5, 0xf7, 0x11, 0x4f, 0xde, 0xf7, 0xb5, 0x22,
+  0xc8, 0x3f, 0x70, 0x1f, 0x3b, 0x62, 0xa3, 0x00, 0xa4, 0x41, 0xeb, 0x30,
+  0xab, 0xe3, 0xde, 0xea, 0xbd, 0xa1, 0xd6, 0x79, 0x7e, 0xa7, 0x16, 0x9d,
+  0x42, 0x18, 0xfe, 0x55, 0xe8, 0x52, 0xe9, 0xc9, 0x35, 0xb4, 0x8c, 0xb1,
+  0xfc, 0x21, 0xe2, 0x43, 0x5e, 0xa4, 0xab, 0x69, 0x00, 0x31, 0x1c, 0xbd,
+  0xb5, 0xcf, 0x41, 0x2d, 0x90, 0xf5, 0x78, 0x56, 0x8c, 0x7d, 0x39, 0x98,
+  0x61, 0x43, 0xc8, 0x19, 0xa4, 0xa1, 0x3d, 0x30, 0x0a, 0xa3, 0x9c, 0x1f,
+  0x8e, 0xff, 0x38, 0x9c, 0xf5, 0x1c, 0x62, 0x5c, 0x40, 0xfc, 0x41, 0x6c,
+  0x2f, 0x6f, 0x43, 0xb3, 0xce, 0xb1, 0x6a, 0xfd, 0x92, 0xc3, 0xe2, 0x37,
+  0x01, 0x86, 0x6c, 0xdf, 0x4e, 0x0b, 0xbb, 0xc7, 0xe6, 0x13, 0x1a, 0x38,
+  0x53, 0xf9, 0xb2, 0xd4, 0xf9, 0x56, 0x35, 0xe2, 0x94, 0xb1, 0xbe, 0xe7,
+  0xab, 0x72, 0x5a, 0x32, 0xa8, 0xc7, 0x59, 0x21, 0x01, 0xbf, 0x28, 0x86,
+  0x12, 0x75, 0xf9, 0xa8, 0x9f, 0x86, 0xc0, 0x48, 0x7e, 0xcc, 0xac, 0x53,
+  0xd2, 0x75, 0x53, 0x00, 0xa0, 0x52, 0xd1, 0x60, 0xaa, 0xf0, 0x17, 0x95,
+  0x6b, 0x23, 0x6f, 0xa4, 0x03, 0x84, 0xe7, 0xd4, 0xa8, 0x0f, 0x66, 0xc3,
+  0x5d, 0xc8, 0x3b, 0xba, 0x71, 0x5d, 0xec, 0x55, 0x66, 0x54, 0x08, 0x0d,
+  0xa4, 0xb8, 0x29, 0xe9, 0xb5, 0xe9, 0xf3, 0xc7, 0xca, 0x56, 0x48, 0x6a,
+  0x19, 0x71, 0x29, 0xbf, 0x54, 0x98, 0xe5, 0xec, 0x25, 0xbe, 0x74, 0xe6,
+  0x98, 0x46, 0xd2, 0x9a, 0xd3, 0xb8, 0xdc, 0x68, 0x08, 0xd7, 0x67, 0xdd,
+  0x7a, 0x69, 0xec, 0x33, 0x8a, 0xae, 0x50, 0x50, 0x1e, 0x39, 0x4b, 0x49,
+  0xb6, 0x9b, 0x6c, 0x41, 0xfe, 0x0a, 0x3d, 0x8e, 0x72, 0x7f, 0x1b, 0x8b,
+  0x6d, 0xec, 0xcc, 0xa8, 0x66, 0x1f, 0x32, 0xb8, 0xa6, 0x0c, 0x38, 0xf0,
+  0xc4, 0x23, 0x3c, 0xdc, 0xfc, 0xa0, 0xde, 0x9d, 0x48, 0x43, 0xea, 0xe6,
+  0x40, 0xc7, 0x49, 0x60, 0x1f, 0xe7, 0x9d, 0xeb, 0x82, 0xcc, 0x00, 0xf0,
+  0x5e, 0xfd, 0x23, 0x90, 0x79, 0x55, 0x00, 0xc2, 0x4a, 0xd0, 0xc9, 0x3d,
+  0x97, 0x35, 0x23, 0xbf, 0xfc, 0x7e, 0xb1, 0x2f, 0xb1, 0x9b, 0xdb, 0x55,
+  0x5b, 0xe0, 0x66, 0xc0, 0xfe, 0x9e, 0xf4, 0x9e, 0x4d, 0x7a, 0x11, 0xfa,
+  0x0d, 0xc5, 0xa3, 0xc9, 0x0b, 0x8f, 0x68, 0x9b, 0xcb, 0xc5, 0xa0, 0x21,
+  0x09, 0xb0, 0x74, 0xc0, 0x6b, 0xce, 0xe2, 0x96, 0x9f, 0x52, 0x2e, 0x1a,
+  0xee, 0x2e, 0xda, 0x37, 0x05, 0x0d, 0xa4, 0xca, 0x9e, 0x57, 0x02, 0x0c,
+  0xd5, 0x94, 0x4b, 0x07, 0x13, 0x06, 0x3a, 0x12, 0x40, 0x47, 0x94, 0xc0,
+  0xd0, 0x2f, 0xb6, 0x5e, 0xc2, 0x1b, 0xe7, 0xcb, 0x87, 0xff, 0xe1, 0xee,
+  0x9e, 0x70, 0x50, 0x59, 0x51, 0xa1, 0x2b, 0xfa, 0x50, 0x12, 0x7b, 0xfb,
+  0x3d, 0xfc, 0x43, 0x99, 0xb7, 0xaf, 0xa6, 0xf1, 0x7a, 0x27, 0x2a, 0x1a,
+  0x1e, 0x9d, 0x60, 0xf6, 0xa2, 0xe2, 0x76, 0xff, 0xc6, 0xec, 0x0d, 0xde,
+  0xfb, 0x74, 0x58, 0x87, 0x29, 0x7a, 0x09, 0xeb, 0x6c, 0xb1, 0xad, 0x1a,
+  0xd5, 0xdd, 0x05, 0x4d, 0x52, 0x71, 0x78, 0x9e, 0xc7, 0xc4, 0x9b, 0x36,
+  0x9f, 0xb8, 0x70, 0xa5, 0xa0, 0xf2, 0xf3, 0x0b, 0x35, 0x8b, 0x40, 0xc5,
+  0xc3, 0xe6, 0xb4, 0xce, 0xe1, 0xdf, 0x32, 0x6c, 0xf8, 0x6b, 0x71, 0x7c,
+  0xf9, 0x94, 0x36, 0xa5, 0x6f, 0x1a, 0x85, 0x1d, 0x8a, 0x15, 0xf1, 0x1d,
+  0x27, 0x44, 0x7e, 0x74, 0x63, 0x45, 0x19, 0xd7, 0x63, 0xec, 0xdb, 0xce,
+  0xef, 0x31, 0x3e, 0x6f, 0x43, 0x86, 0x40, 0x12, 0x47, 0xb3, 0x9d, 0x69,
+  0xa5, 0xfd, 0x6b, 0xa6, 0x34, 0xef, 0x22, 0x96, 0x07, 0x47, 0x06, 0xfd,
+  0x41, 0x41, 0xdc, 0x13, 0xe8, 0x33, 0x00, 0x00, 0x42, 0x00, 0x86, 0x00,
+  0x00, 0x00, 0x44, 0x00, 0x87, 0x00, 0xcd, 0x00, 0x12, 0x01, 0x57, 0x01,
+  0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x1a, 0x00, 0x20, 0x00,
+  0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x12, 0x00, 0x1a, 0x00,
+  0x28, 0x00, 0x30, 0x00, 0x40, 0x00, 0x48, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x12, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x10, 0x00, 0x18, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x1b, 0x00, 0x24, 0x00, 0x30, 0x00, 0x3a, 0x00, 0x48, 0x00,
+  0x00, 0x00, 0x08, 0x00, 0x13, 0x00, 0x1b, 0x00, 0x23, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x12, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x10, 0x00, 0x16, 0x00, 0x00, 0x00, 0x06, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x35, 0x00, 0x46, 0x00, 0x4f, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x34, 0x00,
+  0x3a, 0x00, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x00, 0x42, 0x00,
+  0x4d, 0x00, 0x59, 0x00, 0x66, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x16, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x0f, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00,
+  0x17, 0x00, 0x23, 0x00, 0x2f, 0x00, 0x3a, 0x00, 0x49, 0x00, 0x55, 0x00,
+  0x60, 0x00, 0x6a, 0x00, 0x73, 0x00, 0x7c, 0x00, 0x87, 0x00, 0x00, 0x00,
+  0x18, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x08, 0x00, 0x1e, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x18, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0a, 0x00,
+  0x13, 0x00, 0x00, 0x00, 0x09, 0x00, 0x12, 0x00, 0x1e, 0x00, 0x2a, 0x00,
+  0x34, 0x00, 0x41, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x12, 0x00, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x13, 0x00, 0x1d, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0x18, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x27, 0x00, 0x49, 0x00, 0x76, 0x00,
+  0x9a, 0x00, 0xb2, 0x00, 0xcd, 0x00, 0xea, 0x00, 0xfd, 0x00, 0x03, 0x01,
+  0x0a, 0x01, 0x11, 0x01, 0x18, 0x01, 0x00, 0x00, 0x0a, 0x00, 0x21, 0x00,
+  0x00, 0x00, 0x28, 0x00, 0x4b, 0x00, 0x79, 0x00, 0x9d, 0x00, 0xb6, 0x00,
+  0xd2, 0x00, 0xf8, 0x00, 0x03, 0x01, 0x0c, 0x01, 0x15, 0x01, 0x00, 0x00,
+  0x0a, 0x00, 0x16, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x15, 0x00,
+  0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x2d, 0x00, 0x36, 0x00,
+  0x41, 0x00, 0x4e, 0x00, 0x5a, 0x00, 0x61, 0x00, 0x6d, 0x00, 0x78, 0x00,
+  0x87, 0x00, 0x00, 0x00, 0x21, 0x00, 0x52, 0x00, 0x7f, 0x00, 0xaa, 0x00,
+  0xcc, 0x00, 0xe1, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x52, 0x00, 0x80, 0x00, 0xac, 0x00, 0xcf, 0x00, 0xec, 0x00,
+  0x08, 0x01, 0x00, 0x00, 0x20, 0x00, 0x2b, 0x00, 0x3d, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x10, 0x00, 0x19, 0x00,
+  0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00,
+  0x22, 0x00, 0x00, 0x00, 0x18, 0x00, 0x1f, 0x00, 0x26, 0x00, 0x00, 0x00,
+  0x3a, 0x00, 0x5a, 0x00, 0x79, 0x00, 0xac, 0x00, 0xc4, 0x00, 0xed, 0x00,
+  0x06, 0x01, 0x21, 0x01, 0x29, 0x01, 0x2f, 0x01, 0x37, 0x01, 0x3e, 0x01,
+  0x00, 0x00, 0x1d, 0x00, 0x38, 0x00, 0x42, 0x00, 0x00, 0x00, 0x3b, 0x00,
+  0x5a, 0x00, 0x7a, 0x00, 0xb1, 0x00, 0xca, 0x00, 0xf1, 0x00, 0x10, 0x01,
+  0x2d, 0x01, 0x39, 0x01, 0x40, 0x01, 0x49, 0x01, 0x52, 0x01, 0x5b, 0x01,
+  0x64, 0x01, 0x6d, 0x01, 0x76, 0x01, 0x7f, 0x01, 0x00, 0x00, 0x28, 0x00,
+  0x42, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x25, 0x00, 0x00, 0x00, 0x29, 0x00,
+  0x43, 0x00, 0x00, 0x00, 0x28, 0x00, 0x42, 0x00, 0x4a, 0x00, 0x52, 0x00,
+  0x00, 0x00, 0x2b, 0x00, 0x32, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x1c, 0x00,
+  0x36, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x25, 0x00, 0x2e, 0x00, 0x00, 0x00,
+  0x26, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x17, 0x00, 0x3d, 0x00, 0x46, 0x00,
+  0x4f, 0x00, 0x58, 0x00, 0x68, 0x00, 0x00, 0x00, 0x25, 0x00, 0x2c, 0x00,
+  0x00, 0x00, 0x1b, 0x00, 0x23, 0x00, 0x00, 0x00, 0x17, 0x00, 0x34, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x40, 0x00, 0x4b, 0x00, 0x54, 0x00,
+  0x00, 0x00, 0x27, 0x00, 0x4b, 0x00, 0x65, 0x00, 0x85, 0x00, 0x8c, 0x00,
+  0x98, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x28, 0x00, 0x00, 0x00, 0x28, 0x00,
+  0x4d, 0x00, 0x68, 0x00, 0x94, 0x00, 0xad, 0x00, 0xcd, 0x00, 0x00, 0x00,
+  0x17, 0x00, 0x3b, 0x00, 0x52, 0x00, 0x61, 0x00, 0x67, 0x00, 0x00, 0x00,
+  0x18, 0x00, 0x35, 0x00, 0x59, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x61, 0x00,
+  0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x20, 0x00,
+  0x43, 0x00, 0x5b, 0x00, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x19, 0x00, 0x32, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x26, 0x00, 0x00, 0x00,
+  0x18, 0x00, 0x30, 0x00, 0x52, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x37, 0x00,
+  0x53, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x18, 0x00, 0x39, 0x00, 0x53, 0x00,
+  0x5c, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x77, 0x00, 0x80, 0x00, 0x89, 0x00,
+  0x92, 0x00, 0x9b, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x26, 0x00, 0x4e, 0x00,
+  0x69, 0x00, 0x70, 0x00, 0x76, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x19, 0x00, 0x37, 0x00, 0x00, 0x00, 0x18, 0x00, 0x32, 0x00, 0x3b, 0x00,
+  0x43, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x19, 0x00, 0x34, 0x00,
+  0x4e, 0x00, 0x6e, 0x00, 0x77, 0x00, 0x82, 0x00, 0x96, 0x00, 0x00, 0x00,
+  0x19, 0x00, 0x33, 0x00, 0x4e, 0x00, 0x6a, 0x00, 0x00, 0x00, 0x21, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x1a, 0x00,
+  0x34, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x36, 0x00, 0x55, 0x00,
+  0x60, 0x00, 0x6d, 0x00, 0x00, 0x00, 0x20, 0x00, 0x3c, 0x00, 0x4b, 0x00,
+  0x54, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x37, 0x00, 0x52, 0x00, 0x00, 0x00,
+  0x29, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x19, 0x00, 0x34, 0x00, 0x4c, 0x00, 0x64, 0x00, 0x00, 0x00, 0x24, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x23, 0x00, 0x00, 0x00, 0x20, 0x00,
+  0x42, 0x00, 0x5c, 0x00, 0x81, 0x00, 0x8c, 0x00, 0x00, 0x00, 0x23, 0x00,
+  0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x10, 0x00, 0x17, 0x00,
+  0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x18, 0x00, 0x33, 0x00, 0x4c, 0x00,
+  0x55, 0x00, 0x5e, 0x00, 0x67, 0x00, 0x70, 0x00, 0x79, 0x00, 0x89, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x10, 0x00, 0x25, 0x00, 0x00, 0x00, 0x21, 0x00,
+  0x2c, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00,
+  0x00, 0x00, 0x08, 0x00, 0x10, 0x00, 0x16, 0x00, 0x00, 0x00, 0x1b, 0x00,
+  0x36, 0x00, 0x3f, 0x00, 0x47, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x11, 0x00, 0x17, 0x00, 0x1c, 0x00, 0x22, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x22, 0x00, 0x2a, 0x00, 0x00, 0x00,
+  0x19, 0x00, 0x22, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x18, 0x00, 0x20, 0x00, 0x29, 0x00, 0x32, 0x00, 0x3a, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x1b, 0x00, 0x24, 0x00, 0x36, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x13, 0x00, 0x1d, 0x00, 0x27, 0x00, 0x00, 0x00, 0x09, 0x00, 0x13, 0x00,
+  0x1d, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00,
+  0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0b, 0x00, 0x14, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x10, 0x00, 0x17, 0x00, 0x1e, 0x00, 0x25, 0x00, 0x2c, 0x00, 0x33, 0x00,
+  0x41, 0x00, 0x00, 0x00, 0x09, 0x00, 0x12, 0x00, 0x1b, 0x00, 0x24, 0x00,
+  0x2d, 0x00, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x13, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00,
+  0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x28, 0x00, 0x34, 0x00,
+  0x3a, 0x00, 0x00, 0x00, 0x18, 0x00, 0x20, 0x00, 0x2b, 0x00, 0x44, 0x00,
+  0x52, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x09, 0x00, 0x13, 0x00, 0x1b, 0x00, 0x24, 0x00,
+  0x00, 0x00, 0x0a, 0x00, 0x14, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x08, 0x00,
+  0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x16, 0x00, 0x1e, 0x00, 0x26, 0x00, 0x2e, 0x00, 0x36, 0x00, 0x3e, 0x00,
+  0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x12, 0x00,
+  0x1c, 0x00, 0x24, 0x00, 0x2b, 0x00, 0x33, 0x00, 0x3b, 0x00, 0x43, 0x00,
+  0x4b, 0x00, 0x53, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x1d, 0x00,
+  0x00, 0x00, 0x34, 0x00, 0x3e, 0x00, 0x48, 0x00, 0x00, 0x00, 0x1a, 0x00,
+  0x23, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0f, 0x00, 0x18, 0x00, 0x00, 0x00,
+  0x26, 0x00, 0x54, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x0b, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x11, 0x00, 0x19, 0x00,
+  0x21, 0x00, 0x2a, 0x00, 0x35, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x08, 0x00,
+  0x11, 0x00, 0x17, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00,
+  0x00, 0x00, 0x08, 0x00, 0x11, 0x00, 0x19, 0x00, 0x21, 0x00, 0x29, 0x00,
+  0x38, 0x00, 0x40, 0x00, 0x48, 0x00, 0x50, 0x00, 0x59, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x08, 0x00, 0x10, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x18, 0x00,
+  0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x32, 0x00, 0x00, 0x00,
+  0x2b, 0x00, 0x33, 0x00, 0x40, 0x00, 0x48, 0x00, 0x58, 0x00, 0x60, 0x00,
+  0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x11, 0x00,
+  0x16, 0x00, 0x00, 0x00, 0x08, 0x00, 0x10, 0x00, 0x18, 0x00, 0x20, 0x00,
+  0x28, 0x00, 0x3b, 0x00, 0x43, 0x00, 0x52, 0x00, 0x5a, 0x00, 0x62, 0x00,
+  0x6d, 0x00, 0x75, 0x00, 0x7d, 0x00, 0x00, 0x00, 0x08, 0x00, 0x10, 0x00,
+  0x00, 0x00, 0x27, 0x00, 0x32, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x10, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x25, 0x00, 0x2c, 0x00,
+  0x33, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x08, 0x00, 0x12, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x11, 0x00, 0x1b, 0x00, 0x25, 0x00,
+  0x00, 0x00, 0x08, 0x00, 0x13, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x12, 0x00, 0x19, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x0e, 0x00, 0x00, 0x00,
+  0x27, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00,
+  0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0c, 0x00, 0x12, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x36, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x2e, 0x00, 0x37, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x08, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x12, 0x00, 0x1b, 0x00, 0x24, 0x00, 0x2d, 0x00,
+  0x36, 0x00, 0x3f, 0x00, 0x48, 0x00, 0x51, 0x00, 0x00, 0x00, 0x08, 0x00,
+  0x10, 0x00, 0x17, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00,
+  0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x12, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0f, 0x00, 0x1a, 0x00, 0x20, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x09, 0x00, 0x11, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x15, 0x00,
+  0x21, 0x00, 0x28, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x12, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x25, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0d, 0x00, 0x16, 0x00, 0x1d, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x23, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x12, 0x00, 0x1b, 0x00,
+  0x24, 0x00, 0x2d, 0x00, 0x36, 0x00, 0x3f, 0x00, 0x48, 0x00, 0x00, 0x00,
+  0x1e, 0x00, 0x24, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x14, 0x00,
+  0x00, 0x00, 0x11, 0x00, 0x1d, 0x00, 0x24, 0x00, 0x00, 0x00, 0x19, 0x00,
+  0x20, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x29, 0x00, 0x4b, 0x00, 0x53, 0x00,
+  0x00, 0x00, 0x13, 0x00, 0x28, 0x00, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1e, 0x00, 0x29, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x27, 0x00,
+  0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x09, 0x00, 0x12, 0x00, 0x1d, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x31, 0x00, 0x39, 0x00, 0x43, 0x00,
+  0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x00, 0x00, 0x08, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x0f, 0x00, 0x18, 0x00, 0x1f, 0x00,
+  0x28, 0x00, 0x31, 0x00, 0x3a, 0x00, 0x43, 0x00, 0x4c, 0x00, 0x55, 0x00,
+  0x5e, 0x00, 0x67, 0x00, 0x70, 0x00, 0x79, 0x00, 0x00, 0x00, 0x0b, 0x00,
+  0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x10, 0x00, 0x17, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x09, 0x00, 0x0f, 0x00, 0x19, 0x00,
+  0x24, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x14, 0x00, 0x1e, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x09, 0x00, 0x0f, 0x00,
+  0x00, 0x00, 0x11, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x18, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x13, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x12, 0x00, 0x1c, 0x00, 0x23, 0x00, 0x29, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x19, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x0a, 0x00,
+  0x14, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00,
+  0x1a, 0x00, 0x38, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x41, 0x00, 0x00, 0x00,
+  0x23, 0x00, 0x00, 0x00, 0x09, 0x00, 0x12, 0x00, 0x1b, 0x00, 0x24, 0x00,
+  0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00,
+  0x00, 0x00, 0x16, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x1a, 0x00,
+  0x21, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x16, 0x00, 0x20, 0x00, 0x26, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0b, 0x00,
+  0x13, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x19, 0x00,
+  0x00, 0x00, 0x26, 0x00, 0x2d, 0x00, 0x34, 0x00, 0x3b, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x09, 0x00, 0x12, 0x00, 0x1b, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x08, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x1c, 0x00, 0x22, 0x00, 0x2b, 0x00, 0x34, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x18, 0x00,
+  0x28, 0x00, 0x35, 0x00, 0x42, 0x00, 0x4d, 0x00, 0x52, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x16, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x10, 0x00, 0x16, 0x00, 0x1c, 0x00, 0x22, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x12, 0x00, 0x18, 0x00, 0x21, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x12, 0x00, 0x1b, 0x00, 0x24, 0x00, 0x2d, 0x00, 0x36, 0x00,
+  0x3f, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x1b, 0x00, 0x28, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x11, 0x00, 0x1a, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x35, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00,
+  0x00, 0x00, 0x1b, 0x00, 0x2b, 0x00, 0x39, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x23, 0x00, 0x2a, 0x00, 0x30, 0x00, 0x00, 0x00, 0x10, 0x00, 0x26, 0x00,
+  0x2e, 0x00, 0x39, 0x00, 0x41, 0x00, 0x49, 0x00, 0x51, 0x00, 0x59, 0x00,
+  0x61, 0x00, 0x69, 0x00, 0x78, 0x00, 0x80, 0x00, 0x88, 0x00, 0x90, 0x00,
+  0x98, 0x00, 0xa0, 0x00, 0x00, 0x00, 0x17, 0x00, 0x28, 0x00, 0x32, 0x00,
+  0x00, 0x00, 0x17, 0x00, 0x2a, 0x00, 0x36, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x1e, 0x00, 0x33, 0x00, 0x00, 0x00, 0x18, 0x00, 0x2b, 0x00, 0x3a, 0x00,
+  0x42, 0x00, 0x4a, 0x00, 0x52, 0x00, 0x5a, 0x00, 0x62, 0x00, 0x6a, 0x00,
+  0x72, 0x00, 0x7a, 0x00, 0x82, 0x00, 0x8a, 0x00, 0x92, 0x00, 0x9a, 0x00,
+  0xa2, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x14, 0x00, 0x29, 0x00,
+  0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x2a, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x1c, 0x00, 0x25, 0x00, 0x00, 0x00, 0x27, 0x00, 0x33, 0x00,
+  0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x1d, 0x00, 0x24, 0x00, 0x2c, 0x00,
+  0x35, 0x00, 0x00, 0x00, 0x07, 0x00, 0x10, 0x00, 0x00, 0x00, 0x19, 0x00,
+  0x00, 0x00, 0x11, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x25, 0x00, 0x39, 0x00,
+  0x43, 0x00, 0x00, 0x00, 0x27, 0x00, 0x30, 0x00, 0x39, 0x00, 0x46, 0x00,
+  0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x09, 0x00, 0x15, 0x00, 0x1f, 0x00,
+  0x00, 0x00, 0x17, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x32, 0x00,
+  0x47, 0x00, 0x4f, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x35, 0x00, 0x5a, 0x00,
+  0x65, 0x00, 0x00, 0x00, 0x19, 0x00, 0x26, 0x00, 0x00, 0x00, 0x08, 0x00,
+  0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x1a, 0x00,
+  0x31, 0x00, 0x00, 0x00, 0x13, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x16, 0x00,
+  0x1f, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1d, 0x00, 0x28, 0x00, 0x34, 0x00,
+  0x39, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x1c, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x29, 0x00, 0x3f, 0x00, 0x62, 0x00,
+  0x6a, 0x00, 0x72, 0x00, 0x80, 0x00, 0x88, 0x00, 0x90, 0x00, 0x98, 0x00,
+  0xa0, 0x00, 0x00, 0x00, 0x21, 0x00, 0x37, 0x00, 0x00, 0x00, 0x0b, 0x00,
+  0x13, 0x00, 0x1b, 0x00, 0x21, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x27, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x16, 0x00, 0x1e, 0x00, 0x26, 0x00, 0x2e, 0x00,
+  0x36, 0x00, 0x3e, 0x00, 0x46, 0x00, 0x4e, 0x00, 0x59, 0x00, 0x61, 0x00,
+  0x69, 0x00, 0x71, 0x00, 0x80, 0x00, 0x87, 0x00, 0x94, 0x00, 0x00, 0x00,
+  0x17, 0x00, 0x23, 0x00, 0x4d, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x2b, 0x00,
+  0x00, 0x00, 0x1f, 0x00, 0x30, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x18, 0x00,
+  0x25, 0x00, 0x2d, 0x00, 0x35, 0x00, 0x3d, 0x00, 0x45, 0x00, 0x4d, 0x00,
+  0x55, 0x00, 0x6a, 0x00, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00,
+  0x00, 0x00, 0x13, 0x00, 0x19, 0x00, 0x27, 0x00, 0x34, 0x00, 0x41, 0x00,
+  0x4d, 0x00, 0x54, 0x00, 0x59, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x41, 0x00,
+  0x49, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x23, 0x00, 0x2c, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x12, 0x00, 0x19, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x13, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1e, 0x00, 0x2a, 0x00, 0x34, 0x00, 0x39, 0x00, 0x00, 0x00, 0x20, 0x00,
+  0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x1d, 0x00, 0x26, 0x00,
+  0x2f, 0x00, 0x38, 0x00, 0x00, 0x00, 0x19, 0x00, 0x2c, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x27, 0x00, 0x2f, 0x00, 0x37, 0x00, 0x3d, 0x00, 0x00, 0x00,
+  0x19, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x16, 0x00, 0x1c, 0x00, 0x26, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x17, 0x00, 0x1f, 0x00, 0x27, 0x00,
+  0x2f, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0a, 0x00, 0x10, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x2b, 0x00, 0x34, 0x00,
+  0x3d, 0x00, 0x46, 0x00, 0x53, 0x00, 0x58, 0x00, 0x75, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x23, 0x00, 0x2b, 0x00, 0x34, 0x00, 0x3c, 0x00, 0x44, 0x00,
+  0x00, 0x00, 0x0f, 0x00, 0x20, 0x00, 0x2a, 0x00, 0x33, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x19, 0x00, 0x22, 0x00, 0x2b, 0x00, 0x34, 0x00, 0x3d, 0x00,
+  0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x00,
+  0x2c, 0x00, 0x32, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x08, 0x00,
+  0x0f, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x00,
+  0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0b, 0x00,
+  0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00,
+  0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x0e, 0x00, 0x17, 0x00,
+  0x1e, 0x00, 0x25, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x15, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x00, 0x0e, 0x00, 0x1e, 0x00, 0x2a, 0x00, 0x31, 0x00,
+  0x41, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x15, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x15, 0x00,
+  0x1e, 0x00, 0x27, 0x00, 0x30, 0x00, 0x39, 0x00, 0x42, 0x00, 0x4b, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x1a, 0x00, 0x25, 0x00, 0x2e, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x10, 0x00, 0x19, 0x00, 0x22, 0x00,
+  0x2b, 0x00, 0x34, 0x00, 0x3d, 0x00, 0x46, 0x00, 0x4f, 0x00, 0x58, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x12, 0x00,
+  0x18, 0x00, 0x00, 0x00, 0x07, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x07, 0x00,
+  0x00, 0x00, 0x17, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x12, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x12, 0x00, 0x1b, 0x00, 0x24, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x18, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0x00,
+  0x61, 0x00, 0x68, 0x00, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x10, 0x00, 0x19, 0x00, 0x20, 0x00,
+  0x27, 0x00, 0x2f, 0x00, 0x36, 0x00, 0x3f, 0x00, 0x48, 0x00, 0x00, 0x00,
+  0x1a, 0x00, 0x00, 0x00, 0x10, 0x00, 0x16, 0x00, 0x1f, 0x00, 0x00, 0x00,
+  0x1b, 0x00, 0x00, 0x00, 0x07, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x0d, 0x00,
+  0x00, 0x00, 0x08, 0x00, 0x11, 0x00, 0x1a, 0x00, 0x23, 0x00, 0x2c, 0x00,
+  0x3e, 0x00, 0x00, 0x00, 0x16, 0x00, 0x21, 0x00, 0x2b, 0x00, 0x00, 0x00,
+  0x23, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x16, 0x00, 0x00, 0x00, 0x09, 0x00, 0x11, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x0e, 0x00, 0x17, 0x00, 0x1e, 0x00, 0x25, 0x00, 0x2c, 0x00,
+  0x33, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x3f, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x17, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x30, 0x00,
+  0x00, 0x00, 0x2d, 0x00, 0x47, 0x00, 0x51, 0x00, 0x5a, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x2d, 0x00, 0x63, 0x00, 0x77, 0x00, 0x9a, 0x00, 0x00, 0x00,
+  0x3a, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x12, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x41, 0x00,
+  0x5b, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x15, 0x00, 0x23, 0x00,
+  0x00, 0x00, 0x14, 0x00, 0x28, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x2c, 0x00,
+  0x48, 0x00, 0x4e, 0x00, 0x55, 0x00, 0x5c, 0x00, 0x63, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x2d, 0x00, 0x36, 0x00,
+  0x3f, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x51, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x26, 0x00, 0x2d, 0x00, 0x34, 0x00,
+  0x00, 0x00, 0x19, 0x00, 0x21, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00,
+  0x1a, 0x00, 0x2a, 0x00, 0x32, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x11, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x35, 0x00, 0x48, 0x00,
+  0x6c, 0x00, 0xa4, 0x00, 0xae, 0x00, 0x00, 0x00, 0x29, 0x00, 0x43, 0x00,
+  0x58, 0x00, 0x78, 0x00, 0xb5, 0x00, 0x00, 0x00, 0x17, 0x00, 0x25, 0x00,
+  0x3c, 0x00, 0x55, 0x00, 0x63, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x26, 0x00,
+  0x41, 0x00, 0x54, 0x00, 0x5d, 0x00, 0x66, 0x00, 0x6f, 0x00, 0x78, 0x00,
+  0x00, 0x00, 0x19, 0x00, 0x2a, 0x00, 0x38, 0x00, 0x5f, 0x00, 0x96, 0x00,
+  0x9d, 0x00, 0xa5, 0x00, 0xac, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x21, 0x00,
+  0x3a, 0x00, 0x5b, 0x00, 0x9a, 0x00, 0x00, 0x00, 0x22, 0x00, 0x3a, 0x00,
+  0x51, 0x00, 0x75, 0x00, 0xb5, 0x00, 0xc7, 0x00, 0x00, 0x00, 0x14, 0x00,
+  0x29, 0x00, 0x39, 0x00, 0x4d, 0x00, 0x91, 0x00, 0x00, 0x00, 0x2b, 0x00,
+  0x3a, 0x00, 0x45, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x31, 0x00,
+  0x3f, 0x00, 0x46, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x1d, 0x00, 0x2e, 0x00, 0x49, 0x00, 0x52, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x21, 0x00, 0x3a, 0x00, 0x44, 0x00, 0x4e, 0x00, 0x57, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x2d, 0x00, 0x4f, 0x00, 0x87, 0x00, 0x9e, 0x00, 0xa6, 0x00,
+  0xae, 0x00, 0xb8, 0x00, 0xbf, 0x00, 0x00, 0x00, 0x28, 0x00, 0x39, 0x00,
+  0x00, 0x00, 0x19, 0x00, 0x26, 0x00, 0x47, 0x00, 0x4e, 0x00, 0x00, 0x00,
+  0x19, 0x00, 0x24, 0x00, 0x3d, 0x00, 0x4b, 0x00, 0x59, 0x00, 0x00, 0x00,
+  0x19, 0x00, 0x26, 0x00, 0x3f, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x32, 0x00,
+  0x42, 0x00, 0x4e, 0x00, 0x68, 0x00, 0x7c, 0x00, 0x94, 0x00, 0x9a, 0x00,
+  0x00, 0x00, 0x32, 0x00, 0x42, 0x00, 0x56, 0x00, 0x6d, 0x00, 0x89, 0x00,
+  0x9b, 0x00, 0xa1, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x2a, 0x00,
+  0x40, 0x00, 0x59, 0x00, 0x6a, 0x00, 0x8b, 0x00, 0x92, 0x00, 0x99, 0x00,
+  0x00, 0x00, 0x1c, 0x00, 0x2a, 0x00, 0x39, 0x00, 0x59, 0x00, 0x70, 0x00,
+  0x85, 0x00, 0x00, 0x00, 0x11, 0x00, 0x1e, 0x00, 0x2d, 0x00, 0x3e, 0x00,
+  0x5c, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x18, 0x00, 0x25, 0x00,
+  0x3b, 0x00, 0x49, 0x00, 0x68, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x28, 0x00,
+  0x41, 0x00, 0x5d, 0x00, 0x7a, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x0b, 0x00,
+  0x1c, 0x00, 0x32, 0x00, 0x3f, 0x00, 0x69, 0x00, 0x73, 0x00, 0x7a, 0x00,
+  0x81, 0x00, 0x00, 0x00, 0x10, 0x00, 0x1d, 0x00, 0x2a, 0x00, 0x43, 0x00,
+  0x6a, 0x00, 0xa2, 0x00, 0xab, 0x00, 0xb7, 0x00, 0xc0, 0x00, 0xc9, 0x00,
+  0x00, 0x00, 0x0f, 0x00, 0x26, 0x00, 0x3d, 0x00, 0x60, 0x00, 0x71, 0x00,
+  0x00, 0x00, 0x2d, 0x00, 0x47, 0x00, 0x60, 0x00, 0x7b, 0x00, 0x00, 0x00,
+  0x2d, 0x00, 0x5a, 0x00, 0x7b, 0x00, 0x9b, 0x00, 0xbf, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x2f, 0x00, 0x4d, 0x00, 0x64, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x1d, 0x00, 0x42, 0x00, 0x65, 0x00, 0x83, 0x00, 0x89, 0x00, 0x00, 0x00,
+  0x19, 0x00, 0x28, 0x00, 0x3e, 0x00, 0x4f, 0x00, 0x67, 0x00, 0x7d, 0x00,
+  0x93, 0x00, 0xa9, 0x00, 0xb7, 0x00, 0xc4, 0x00, 0xd1, 0x00, 0xde, 0x00,
+  0xeb, 0x00, 0xf1, 0x00, 0x00, 0x00, 0x12, 0x00, 0x24, 0x00, 0x34, 0x00,
+  0x42, 0x00, 0x52, 0x00, 0x62, 0x00, 0x80, 0x00, 0x94, 0x00, 0x9e, 0x00,
+  0x00, 0x00, 0x30, 0x00, 0x53, 0x00, 0x7f, 0x00, 0xa2, 0x00, 0xc6, 0x00,
+  0xe3, 0x00, 0x02, 0x01, 0x1a, 0x01, 0x28, 0x01, 0x37, 0x01, 0x45, 0x01,
+  0x52, 0x01, 0x6c, 0x01, 0x85, 0x01, 0x95, 0x01, 0x9d, 0x01, 0x00, 0x00,
+  0x19, 0x00, 0x38, 0x00, 0x4e, 0x00, 0x5a, 0x00, 0x73, 0x00, 0x85, 0x00,
+  0xa1, 0x00, 0xaf, 0x00, 0xb8, 0x00, 0xc1, 0x00, 0xca, 0x00, 0x00, 0x00,
+  0x2f, 0x00, 0x51, 0x00, 0x7c, 0x00, 0x9e, 0x00, 0xc1, 0x00, 0xdd, 0x00,
+  0xfb, 0x00, 0x15, 0x01, 0x45, 0x01, 0x5f, 0x01, 0x6b, 0x01, 0x8d, 0x01,
+  0x9b, 0x01, 0xc1, 0x01, 0xd3, 0x01, 0x00, 0x00, 0x30, 0x00, 0x3e, 0x00,
+  0x5d, 0x00, 0x71, 0x00, 0x81, 0x00, 0x97, 0x00, 0xab, 0x00, 0xc6, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x1b, 0x00, 0x34, 0x00, 0x43, 0x00, 0x5c, 0x00,
+  0x6c, 0x00, 0x7b, 0x00, 0x8a, 0x00, 0x9b, 0x00, 0xa4, 0x00, 0xad, 0x00,
+  0xb3, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x46, 0x00, 0x5c, 0x00, 0x6d, 0x00,
+  0x7b, 0x00, 0x8b, 0x00, 0xa3, 0x00, 0xcd, 0x00, 0xdb, 0x00, 0x00, 0x00,
+  0x21, 0x00, 0x3b, 0x00, 0x4b, 0x00, 0x66, 0x00, 0x7d, 0x00, 0x96, 0x00,
+  0xa6, 0x00, 0xae, 0x00, 0x00, 0x00, 0x17, 0x00, 0x27, 0x00, 0x36, 0x00,
+  0x54, 0x00, 0x6e, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x21, 0x00,
+  0x30, 0x00, 0x3d, 0x00, 0x4b, 0x00, 0x62, 0x00, 0x6b, 0x00, 0x73, 0x00,
+  0x00, 0x00, 0x19, 0x00, 0x29, 0x00, 0x37, 0x00, 0x51, 0x00, 0x6b, 0x00,
+  0x8f, 0x00, 0x00, 0x00, 0x24, 0x00, 0x31, 0x00, 0x3c, 0x00, 0x4a, 0x00,
+  0x63, 0x00, 0x6f, 0x00, 0x7b, 0x00, 0x00, 0x00, 0x12, 0x00, 0x20, 0x00,
+  0x2e, 0x00, 0x4c, 0x00, 0x65, 0x00, 0x79, 0x00, 0x88, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x30, 0x00, 0x3c, 0x00, 0x52, 0x00, 0x70, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x1e, 0x00, 0x2c, 0x00, 0x3a, 0x00, 0x58, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x33, 0x00, 0x42, 0x00, 0x50, 0x00, 0x5f, 0x00, 0x7a, 0x00,
+  0x89, 0x00, 0x94, 0x00, 0x9b, 0x00, 0x00, 0x00, 0x25, 0x00, 0x4d, 0x00,
+  0x63, 0x00, 0x7c, 0x00, 0xad, 0x00, 0xc4, 0x00, 0xe1, 0x00, 0xf0, 0x00,
+  0x00, 0x00, 0x21, 0x00, 0x38, 0x00, 0x4f, 0x00, 0x5e, 0x00, 0x75, 0x00,
+  0x86, 0x00, 0x00, 0x00, 0x18, 0x00, 0x31, 0x00, 0x49, 0x00, 0x60, 0x00,
+  0x6e, 0x00, 0x82, 0x00, 0x9b, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x3b, 0x00,
+  0x56, 0x00, 0x73, 0x00, 0x84, 0x00, 0x93, 0x00, 0xb7, 0x00, 0xcc, 0x00,
+  0xd5, 0x00, 0xdd, 0x00, 0xe4, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x29, 0x00,
+  0x44, 0x00, 0x74, 0x00, 0x83, 0x00, 0xa0, 0x00, 0xaf, 0x00, 0xb7, 0x00,
+  0xbf, 0x00, 0xc7, 0x00, 0xcf, 0x00, 0xd7, 0x00, 0xdf, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x3a, 0x00, 0x4b, 0x00, 0x63, 0x00, 0x8f, 0x00, 0xa5, 0x00,
+  0xc9, 0x00, 0xe8, 0x00, 0xf1, 0x00, 0xf8, 0x00, 0x01, 0x01, 0x00, 0x00,
+  0x11, 0x00, 0x3c, 0x00, 0x49, 0x00, 0x60, 0x00, 0x8a, 0x00, 0xab, 0x00,
+  0xc6, 0x00, 0xdd, 0x00, 0xe6, 0x00, 0xef, 0x00, 0xf8, 0x00, 0x03, 0x01,
+  0x00, 0x00, 0x10, 0x00, 0x20, 0x00, 0x37, 0x00, 0x52, 0x00, 0x66, 0x00,
+  0x76, 0x00, 0x7d, 0x00, 0x84, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x22, 0x00,
+  0x37, 0x00, 0x46, 0x00, 0x57, 0x00, 0x64, 0x00, 0x7c, 0x00, 0x84, 0x00,
+  0x8c, 0x00, 0x94, 0x00, 0x9c, 0x00, 0xa4, 0x00, 0xac, 0x00, 0xb4, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x27, 0x00, 0x3c, 0x00, 0x4b, 0x00, 0x59, 0x00,
+  0x72, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x2c, 0x00, 0x42, 0x00, 0x56, 0x00,
+  0x63, 0x00, 0x74, 0x00, 0x7d, 0x00, 0x00, 0x00, 0x17, 0x00, 0x32, 0x00,
+  0x40, 0x00, 0x51, 0x00, 0x62, 0x00, 0x76, 0x00, 0x00, 0x00, 0x13, 0x00,
+  0x21, 0x00, 0x2e, 0x00, 0x3c, 0x00, 0x4d, 0x00, 0x63, 0x00, 0x00, 0x00,
+  0x25, 0x00, 0x42, 0x00, 0x57, 0x00, 0x67, 0x00, 0x7a, 0x00, 0x8b, 0x00,
+  0x98, 0x00, 0x00, 0x00, 0x27, 0x00, 0x3e, 0x00, 0x4a, 0x00, 0x61, 0x00,
+  0x70, 0x00, 0x7f, 0x00, 0x9a, 0x00, 0xb5, 0x00, 0xc0, 0x00, 0x00, 0x00,
+  0x26, 0x00, 0x40, 0x00, 0x56, 0x00, 0x86, 0x00, 0x9b, 0x00, 0xac, 0x00,
+  0xc4, 0x00, 0xd9, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x33, 0x00, 0x63, 0x00,
+  0x71, 0x00, 0x81, 0x00, 0xa3, 0x00, 0xac, 0x00, 0x00, 0x00, 0x2c, 0x00,
+  0x53, 0x00, 0x7f, 0x00, 0xa6, 0x00, 0xc6, 0x00, 0xef, 0x00, 0x12, 0x01,
+  0x46, 0x01, 0x65, 0x01, 0x80, 0x01, 0x95, 0x01, 0xb4, 0x01, 0xc7, 0x01,
+  0xe7, 0x01, 0xf9, 0x01, 0x11, 0x02, 0x1a, 0x02, 0x23, 0x02, 0x2c, 0x02,
+  0x36, 0x02, 0x00, 0x00, 0x14, 0x00, 0x21, 0x00, 0x3a, 0x00, 0x45, 0x00,
+  0x56, 0x00, 0x6f, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x51, 0x00, 0x7c, 0x00,
+  0xa2, 0x00, 0xc1, 0x00, 0xe9, 0x00, 0x0b, 0x01, 0x3e, 0x01, 0x5c, 0x01,
+  0x78, 0x01, 0x96, 0x01, 0xab, 0x01, 0xc2, 0x01, 0xe4, 0x01, 0x01, 0x02,
+  0x19, 0x02, 0x20, 0x02, 0x00, 0x00, 0x27, 0x00, 0x46, 0x00, 0x50, 0x00,
+  0x64, 0x00, 0x76, 0x00, 0x9d, 0x00, 0xb0, 0x00, 0xba, 0x00, 0x00, 0x00,
+  0x1d, 0x00, 0x2e, 0x00, 0x5e, 0x00, 0x6a, 0x00, 0x84, 0x00, 0x99, 0x00,
+  0x00, 0x00, 0x1f, 0x00, 0x37, 0x00, 0x67, 0x00, 0x78, 0x00, 0x8d, 0x00,
+  0xa8, 0x00, 0xb1, 0x00, 0xb9, 0x00, 0xc2, 0x00, 0xcb, 0x00, 0x00, 0x00,
+  0x1d, 0x00, 0x31, 0x00, 0x55, 0x00, 0x66, 0x00, 0x7a, 0x00, 0xa1, 0x00,
+  0xb1, 0x00, 0xc2, 0x00, 0xcb, 0x00, 0xd4, 0x00, 0xdd, 0x00, 0xe6, 0x00,
+  0x00, 0x00, 0x1d, 0x00, 0x32, 0x00, 0x41, 0x00, 0x50, 0x00, 0x67, 0x00,
+  0x82, 0x00, 0x92, 0x00, 0x00, 0x00, 0x13, 0x00, 0x37, 0x00, 0x4d, 0x00,
+  0x66, 0x00, 0x7e, 0x00, 0x8b, 0x00, 0x9b, 0x00, 0xa3, 0x00, 0x00, 0x00,
+  0x15, 0x00, 0x37, 0x00, 0x4e, 0x00, 0x66, 0x00, 0x7f, 0x00, 0x8c, 0x00,
+  0xa9, 0x00, 0xb5, 0x00, 0xbf, 0x00, 0x00, 0x00, 0x16, 0x00, 0x3c, 0x00,
+  0x4a, 0x00, 0x70, 0x00, 0x80, 0x00, 0x94, 0x00, 0xa1, 0x00, 0xaa, 0x00,
+  0x00, 0x00, 0x13, 0x00, 0x2b, 0x00, 0x39, 0x00, 0x54, 0x00, 0x67, 0x00,
+  0x7e, 0x00, 0x8d, 0x00, 0x95, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x23, 0x00,
+  0x3c, 0x00, 0x58, 0x00, 0x6a, 0x00, 0x7a, 0x00, 0x88, 0x00, 0x9a, 0x00,
+  0xa5, 0x00, 0x00, 0x00, 0x15, 0x00, 0x3b, 0x00, 0x57, 0x00, 0x72, 0x00,
+  0x84, 0x00, 0x9e, 0x00, 0xb7, 0x00, 0x00, 0x00, 0x24, 0x00, 0x4d, 0x00,
+  0x6a, 0x00, 0x77, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x3e, 0x00, 0x58, 0x00,
+  0x69, 0x00, 0x88, 0x00, 0x90, 0x00, 0x98, 0x00, 0x00, 0x00, 0x19, 0x00,
+  0x44, 0x00, 0x68, 0x00, 0x7d, 0x00, 0x93, 0x00, 0xa3, 0x00, 0x00, 0x00,
+  0x1a, 0x00, 0x35, 0x00, 0x64, 0x00, 0x88, 0x00, 0xa5, 0x00, 0xb8, 0x00,
+  0xcb, 0x00, 0xd2, 0x00, 0x00, 0x00, 0x14, 0x00, 0x37, 0x00, 0x48, 0x00,
+  0x5b, 0x00, 0x6c, 0x00, 0x8d, 0x00, 0x95, 0x00, 0x9d, 0x00, 0xa5, 0x00,
+  0xad, 0x00, 0xb5, 0x00, 0xbd, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x51, 0x00,
+  0x63, 0x00, 0x7a, 0x00, 0x8b, 0x00, 0xa1, 0x00, 0x00, 0x00, 0x1e, 0x00,
+  0x49, 0x00, 0x5c, 0x00, 0x74, 0x00, 0x7f, 0x00, 0x98, 0x00, 0xaf, 0x00,
+  0xba, 0x00, 0x00, 0x00, 0x16, 0x00, 0x2d, 0x00, 0x5b, 0x00, 0x6c, 0x00,
+  0x8d, 0x00, 0xa2, 0x00, 0xb7, 0x00, 0xc3, 0x00, 0xca, 0x00, 0x00, 0x00,
+  0x1f, 0x00, 0x3b, 0x00, 0x49, 0x00, 0x66, 0x00, 0x85, 0x00, 0x9a, 0x00,
+  0xa9, 0x00, 0xbe, 0x00, 0xc6, 0x00, 0xce, 0x00, 0xd6, 0x00, 0xde, 0x00,
+  0xe6, 0x00, 0x00, 0x00, 0x20, 0x00, 0x3d, 0x00, 0x48, 0x00, 0x68, 0x00,
+  0x87, 0x00, 0xa9, 0x00, 0xbe, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x31, 0x00,
+  0x50, 0x00, 0x70, 0x00, 0x85, 0x00, 0x97, 0x00, 0xb0, 0x00, 0xb9, 0x00,
+  0x00, 0x00, 0x24, 0x00, 0x43, 0x00, 0x56, 0x00, 0x62, 0x00, 0x7c, 0x00,
+  0x96, 0x00, 0x00, 0x00, 0x23, 0x00, 0x4a, 0x00, 0x5c, 0x00, 0x70, 0x00,
+  0x89, 0x00, 0x9b, 0x00, 0x00, 0x00, 0x28, 0x00, 0x4c, 0x00, 0x67, 0x00,
+  0x7d, 0x00, 0x91, 0x00, 0xa9, 0x00, 0xb2, 0x00, 0xbb, 0x00, 0x00, 0x00,
+  0x2e, 0x00, 0x44, 0x00, 0x62, 0x00, 0x81, 0x00, 0xaa, 0x00, 0xc3, 0x00,
+  0xcf, 0x00, 0xd5, 0x00, 0x00, 0x00, 0x27, 0x00, 0x37, 0x00, 0x56, 0x00,
+  0x76, 0x00, 0x99, 0x00, 0xb0, 0x00, 0xc7, 0x00, 0x00, 0x00, 0x1a, 0x00,
+  0x30, 0x00, 0x58, 0x00, 0x71, 0x00, 0x80, 0x00, 0x00, 0x00, 0x13, 0x00,
+  0x2f, 0x00, 0x3f, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x11, 0x00, 0x2f, 0x00,
+  0x3f, 0x00, 0x57, 0x00, 0x00, 0x00, 0x10, 0x00, 0x26, 0x00, 0x48, 0x00,
+  0x64, 0x00, 0x8d, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x19, 0x00, 0x34, 0x00,
+  0x5d, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x28, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x51, 0x00, 0x68, 0x00, 0x80, 0x00, 0x95, 0x00, 0xa0, 0x00,
+  0xa9, 0x00, 0xb2, 0x00, 0xb8, 0x00, 0x00, 0x00, 0x19, 0x00, 0x35, 0x00,
+  0x52, 0x00, 0x68, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x3a, 0x00,
+  0x4e, 0x00, 0x5c, 0x00, 0x6a, 0x00, 0x81, 0x00, 0x8f, 0x00, 0x9c, 0x00,
+  0x00, 0x00, 0x1b, 0x00, 0x48, 0x00, 0x65, 0x00, 0x88, 0x00, 0x8f, 0x00,
+  0x97, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x2f, 0x00, 0x3d, 0x00, 0x59, 0x00,
+  0x78, 0x00, 0x83, 0x00, 0x00, 0x00, 0x20, 0x00, 0x48, 0x00, 0x64, 0x00,
+  0x72, 0x00, 0x8a, 0x00, 0x91, 0x00, 0x00, 0x00, 0x22, 0x00, 0x33, 0x00,
+  0x66, 0x00, 0x70, 0x00, 0x78, 0x00, 0x80, 0x00, 0x86, 0x00, 0x8e, 0x00,
+  0x00, 0x00, 0x2f, 0x00, 0x48, 0x00, 0x5f, 0x00, 0x70, 0x00, 0x79, 0x00,
+  0x91, 0x00, 0x00, 0x00, 0x19, 0x00, 0x48, 0x00, 0x58, 0x00, 0x68, 0x00,
+  0x00, 0x00, 0x19, 0x00, 0x31, 0x00, 0x55, 0x00, 0x66, 0x00, 0x77, 0x00,
+  0x00, 0x00, 0x1c, 0x00, 0x37, 0x00, 0x4b, 0x00, 0x53, 0x00, 0x5b, 0x00,
+  0x63, 0x00, 0x6b, 0x00, 0x73, 0x00, 0x7b, 0x00, 0x83, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x35, 0x00, 0x48, 0x00, 0x59, 0x00, 0x62, 0x00, 0x00, 0x00,
+  0x1a, 0x00, 0x2d, 0x00, 0x47, 0x00, 0x53, 0x00, 0x00, 0x00, 0x1c, 0x00,
+  0x2c, 0x00, 0x44, 0x00, 0x00, 0x00, 0x11, 0x00, 0x2a, 0x00, 0x3e, 0x00,
+  0x00, 0x00, 0x1c, 0x00, 0x44, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x32, 0x00,
+  0x3e, 0x00, 0x68, 0x00, 0x84, 0x00, 0x8d, 0x00, 0x96, 0x00, 0x9f, 0x00,
+  0xa5, 0x00, 0x00, 0x00, 0x33, 0x00, 0x5f, 0x00, 0x86, 0x00, 0x9a, 0x00,
+  0xa5, 0x00, 0xae, 0x00, 0xb5, 0x00, 0xbb, 0x00, 0x00, 0x00, 0x18, 0x00,
+  0x37, 0x00, 0x55, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x22, 0x00, 0x31, 0x00,
+  0x5e, 0x00, 0x87, 0x00, 0x8f, 0x00, 0x00, 0x00, 0x13, 0x00, 0x20, 0x00,
+  0x4e, 0x00, 0x67, 0x00, 0x6d, 0x00, 0x76, 0x00, 0x7f, 0x00, 0x88, 0x00,
+  0x93, 0x00, 0x00, 0x00, 0x16, 0x00, 0x2d, 0x00, 0x3f, 0x00, 0x63, 0x00,
+  0x76, 0x00, 0x91, 0x00, 0x9f, 0x00, 0xab, 0x00, 0x00, 0x00, 0x1a, 0x00,
+  0x36, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x11, 0x00, 0x2c, 0x00, 0x00, 0x00,
+  0x1f, 0x00, 0x58, 0x00, 0x70, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x42, 0x00,
+  0x5a, 0x00, 0x61, 0x00, 0x68, 0x00, 0x6f, 0x00, 0x00, 0x00, 0x15, 0x00,
+  0x41, 0x00, 0x5c, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x23, 0x00,
+  0x2f, 0x00, 0x3b, 0x00, 0x4c, 0x00, 0x55, 0x00, 0x00, 0x00, 0x17, 0x00,
+  0x2d, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x48, 0x00, 0x5a, 0x00,
+  0x63, 0x00, 0x00, 0x00, 0x10, 0x00, 0x32, 0x00, 0x00, 0x00, 0x18, 0x00,
+  0x33, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x19, 0x00, 0x31, 0x00, 0x40, 0x00,
+  0x49, 0x00, 0x00, 0x00, 0x14, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x13, 0x00,
+  0x2b, 0x00, 0x42, 0x00, 0x49, 0x00, 0x51, 0x00, 0x00, 0x00, 0x1c, 0x00,
+  0x34, 0x00, 0x4e, 0x00, 0x56, 0x00, 0x64, 0x00, 0x72, 0x00, 0x80, 0x00,
+  0x8d, 0x00, 0x9a, 0x00, 0xa7, 0x00, 0xb5, 0x00, 0xc3, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x29, 0x00, 0x42, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x14, 0x00,
+  0x28, 0x00, 0x3c, 0x00, 0x50, 0x00, 0x64, 0x00, 0x78, 0x00, 0x8c, 0x00,
+  0xa0, 0x00, 0xb4, 0x00, 0xd2, 0x00, 0xf3, 0x00, 0x00, 0x00, 0x20, 0x00,
+  0x38, 0x00, 0x40, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x3d, 0x00, 0x46, 0x00,
+  0x00, 0x00, 0x17, 0x00, 0x26, 0x00, 0x48, 0x00, 0x4f, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x23, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x25, 0x00, 0x2e, 0x00,
+  0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x31, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00,
+  0x26, 0x00, 0x00, 0x00, 0x17, 0x00, 0x27, 0x00, 0x00, 0x00, 0x0d, 0x00,
+  0x33, 0x00, 0x3d, 0x00, 0x46, 0x00, 0x50, 0x00, 0x00, 0x00, 0x1a, 0x00,
+  0x49, 0x00, 0x52, 0x00, 0x58, 0x00, 0x5e, 0x00, 0x00, 0x00, 0x0f, 0x00,
+  0x2a, 0x00, 0x63, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x2e, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x3c, 0x00, 0x61, 0x00, 0x6a, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x26, 0x00, 0x4c, 0x00, 0x55, 0x00, 0x5b, 0x00, 0x62, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x22, 0x00, 0x4d, 0x00, 0x59, 0x00, 0x60, 0x00, 0x67, 0x00,
+  0x6d, 0x00, 0x76, 0x00, 0x00, 0x00, 0x07, 0x00, 0x11, 0x00, 0x1b, 0x00,
+  0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x15, 0x00, 0x24, 0x00, 0x33, 0x00, 0x3b, 0x00, 0x4a, 0x00, 0x59, 0x00,
+  0x68, 0x00, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x1e, 0x00,
+  0x26, 0x00, 0x30, 0x00, 0x00, 0x00, 0x24, 0x00, 0x3a, 0x00, 0x42, 0x00,
+  0x4b, 0x00, 0x53, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x34, 0x00,
+  0x3d, 0x00, 0x46, 0x00, 0x00, 0x00, 0x17, 0x00, 0x2b, 0x00, 0x3f, 0x00,
+  0x53, 0x00, 0x68, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x0a, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x1d, 0x00,
+  0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x2e, 0x00, 0x34, 0x00,
+  0x00, 0x00, 0x18, 0x00, 0x21, 0x00, 0x31, 0x00, 0x39, 0x00, 0x40, 0x00,
+  0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x2b, 0x00, 0x33, 0x00,
+  0x3b, 0x00, 0x44, 0x00, 0x4d, 0x00, 0x56, 0x00, 0x5f, 0x00, 0x68, 0x00,
+  0x00, 0x00, 0x07, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x19, 0x00, 0x3f, 0x00,
+  0x59, 0x00, 0x60, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x34, 0x00, 0x00, 0x00,
+  0x1a, 0x00, 0x42, 0x00, 0x59, 0x00, 0x62, 0x00, 0x6b, 0x00, 0x7c, 0x00,
+  0x85, 0x00, 0x8e, 0x00, 0x97, 0x00, 0xa8, 0x00, 0xb1, 0x00, 0xc1, 0x00,
+  0x00, 0x00, 0x1c, 0x00, 0x36, 0x00, 0x43, 0x00, 0x4d, 0x00, 0x00, 0x00,
+  0x22, 0x00, 0x45, 0x00, 0x00, 0x00, 0x17, 0x00, 0x33, 0x00, 0x4a, 0x00,
+  0x00, 0x00, 0x17, 0x00, 0x34, 0x00, 0x00, 0x00, 0x15, 0x00, 0x1e, 0x00,
+  0x27, 0x00, 0x30, 0x00, 0x39, 0x00, 0x42, 0x00, 0x4b, 0x00, 0x00, 0x00,
+  0x39, 0x00, 0x52, 0x00, 0x62, 0x00, 0x6a, 0x00, 0x74, 0x00, 0x00, 0x00,
+  0x16, 0x00, 0x39, 0x00, 0x51, 0x00, 0x5f, 0x00, 0x75, 0x00, 0x8e, 0x00,
+  0x00, 0x00, 0x34, 0x00, 0x51, 0x00, 0x6b, 0x00, 0x7b, 0x00, 0x85, 0x00,
+  0xa1, 0x00, 0xaa, 0x00, 0xb2, 0x00, 0x00, 0x00, 0x19, 0x00, 0x33, 0x00,
+  0x48, 0x00, 0x5e, 0x00, 0x81, 0x00, 0x88, 0x00, 0x00, 0x00, 0x0b, 0x00,
+  0x28, 0x00, 0x49, 0x00, 0x56, 0x00, 0x62, 0x00, 0x00, 0x00, 0x26, 0x00,
+  0x34, 0x00, 0x51, 0x00, 0x7a, 0x00, 0x85, 0x00, 0x8e, 0x00, 0x00, 0x00,
+  0x17, 0x00, 0x25, 0x00, 0x35, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x1a, 0x00, 0x3a, 0x00, 0x43, 0x00, 0x4c, 0x00, 0x55, 0x00, 0x5b, 0x00,
+  0x00, 0x00, 0x16, 0x00, 0x25, 0x00, 0x3f, 0x00, 0x51, 0x00, 0x59, 0x00,
+  0x62, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x1c, 0x00, 0x23, 0x00, 0x2c, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x2b, 0x00,
+  0x3a, 0x00, 0x43, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x24, 0x00, 0x3f, 0x00,
+  0x4f, 0x00, 0x58, 0x00, 0x00, 0x00, 0x15, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x1a, 0x00, 0x34, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x14, 0x00, 0x1d, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1c, 0x00, 0x39, 0x00, 0x00, 0x00,
+  0x19, 0x00, 0x27, 0x00, 0x36, 0x00, 0x46, 0x00, 0x64, 0x00, 0x73, 0x00,
+  0x7a, 0x00, 0x80, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x19, 0x00, 0x31, 0x00,
+  0x00, 0x00, 0x17, 0x00, 0x3b, 0x00, 0x4a, 0x00, 0x58, 0x00, 0x7d, 0x00,
+  0x85, 0x00, 0x8d, 0x00, 0x96, 0x00, 0x9e, 0x00, 0xa5, 0x00, 0x00, 0x00,
+  0x1b, 0x00, 0x28, 0x00, 0x36, 0x00, 0x43, 0x00, 0x00, 0x00, 0x1c, 0x00,
+  0x3f, 0x00, 0x4a, 0x00, 0x57, 0x00, 0x6f, 0x00, 0xa6, 0x00, 0xaf, 0x00,
+  0xb8, 0x00, 0xc1, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x35, 0x00, 0x50, 0x00,
+  0x5b, 0x00, 0x6b, 0x00, 0x78, 0x00, 0x91, 0x00, 0x98, 0x00, 0x00, 0x00,
+  0x2b, 0x00, 0x46, 0x00, 0x65, 0x00, 0x8b, 0x00, 0xa4, 0x00, 0xb1, 0x00,
+  0xc3, 0x00, 0xe1, 0x00, 0x00, 0x00, 0x23, 0x00, 0x4e, 0x00, 0x6c, 0x00,
+  0x7b, 0x00, 0x96, 0x00, 0xaf, 0x00, 0xb8, 0x00, 0x00, 0x00, 0x1b, 0x00,
+  0x35, 0x00, 0x50, 0x00, 0x5d, 0x00, 0x74, 0x00, 0x90, 0x00, 0xac, 0x00,
+  0xb5, 0x00, 0xbe, 0x00, 0xc7, 0x00, 0xd0, 0x00, 0xd9, 0x00, 0x00, 0x00,
+  0x1a, 0x00, 0x3d, 0x00, 0x4a, 0x00, 0x5b, 0x00, 0x75, 0x00, 0x8d, 0x00,
+  0x93, 0x00, 0x00, 0x00, 0x18, 0x00, 0x43, 0x00, 0x5c, 0x00, 0x6a, 0x00,
+  0x89, 0x00, 0xa1, 0x00, 0x00, 0x00, 0x24, 0x00, 0x3f, 0x00, 0x58, 0x00,
+  0x75, 0x00, 0x98, 0x00, 0xa7, 0x00, 0xb9, 0x00, 0xe0, 0x00, 0x00, 0x00,
+  0x2c, 0x00, 0x43, 0x00, 0x6a, 0x00, 0x86, 0x00, 0x98, 0x00, 0xa8, 0x00,
+  0xc4, 0x00, 0xde, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x36, 0x00, 0x5a, 0x00,
+  0x75, 0x00, 0x84, 0x00, 0x9a, 0x00, 0xb6, 0x00, 0xbe, 0x00, 0x00, 0x00,
+  0x1b, 0x00, 0x43, 0x00, 0x5e, 0x00, 0x79, 0x00, 0x85, 0x00, 0x99, 0x00,
+  0xb2, 0x00, 0xb9, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x39, 0x00, 0x53, 0x00,
+  0x6b, 0x00, 0x7c, 0x00, 0x8a, 0x00, 0x93, 0x00, 0x9c, 0x00, 0xa3, 0x00,
+  0x00, 0x00, 0x35, 0x00, 0x4e, 0x00, 0x69, 0x00, 0x83, 0x00, 0x94, 0x00,
+  0xa4, 0x00, 0xbd, 0x00, 0xde, 0x00, 0xe5, 0x00, 0xed, 0x00, 0xf5, 0x00,
+  0x00, 0x00, 0x1d, 0x00, 0x35, 0x00, 0x4a, 0x00, 0x58, 0x00, 0x71, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x48, 0x00, 0x68, 0x00, 0x78, 0x00,
+  0x86, 0x00, 0xa3, 0x00, 0xb3, 0x00, 0xbd, 0x00, 0xc4, 0x00, 0x00, 0x00,
+  0x1d, 0x00, 0x37, 0x00, 0x55, 0x00, 0x6e, 0x00, 0x96, 0x00, 0x9d, 0x00,
+  0xa8, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x26, 0x00, 0x34, 0x00, 0x4b, 0x00,
+  0x56, 0x00, 0x00, 0x00, 0x22, 0x00, 0x31, 0x00, 0x4f, 0x00, 0x67, 0x00,
+  0x00, 0x00, 0x18, 0x00, 0x23, 0x00, 0x3d, 0x00, 0x4b, 0x00, 0x54, 0x00,
+  0x5a, 0x00, 0x00, 0x00, 0x10, 0x00, 0x21, 0x00, 0x3c, 0x00, 0x00, 0x00,
+  0x1a, 0x00, 0x36, 0x00, 0x45, 0x00, 0x52, 0x00, 0x00, 0x00, 0x19, 0x00,
+  0x31, 0x00, 0x4b, 0x00, 0x64, 0x00, 0x71, 0x00, 0x93, 0x00, 0x9c, 0x00,
+  0xa7, 0x00, 0xb0, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x47, 0x00, 0x6a, 0x00,
+  0x78, 0x00, 0x86, 0x00, 0xaf, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x3a, 0x00,
+  0x4c, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x18, 0x00, 0x31, 0x00, 0x5b, 0x00,
+  0x6a, 0x00, 0x77, 0x00, 0x92, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1b, 0x00,
+  0x33, 0x00, 0x56, 0x00, 0x5e, 0x00, 0x66, 0x00, 0x6f, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x24, 0x00, 0x3f, 0x00, 0x63, 0x00, 0x00, 0x00, 0x16, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x10, 0x00, 0x22, 0x00,
+  0x2d, 0x00, 0x00, 0x00, 0x19, 0x00, 0x2d, 0x00, 0x36, 0x00, 0x3d, 0x00,
+  0x45, 0x00, 0x4d, 0x00, 0x55, 0x00, 0x5c, 0x00, 0x63, 0x00, 0x6a, 0x00,
+  0x71, 0x00, 0x00, 0x00, 0x17, 0x00, 0x2f, 0x00, 0x45, 0x00, 0x52, 0x00,
+  0x00, 0x00, 0x1b, 0x00, 0x35, 0x00, 0x47, 0x00, 0x5e, 0x00, 0x67, 0x00,
+  0x70, 0x00, 0x79, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x28, 0x00, 0x36, 0x00,
+  0x41, 0x00, 0x4a, 0x00, 0x53, 0x00, 0x5a, 0x00, 0x63, 0x00, 0x6c, 0x00,
+  0x00, 0x00, 0x1b, 0x00, 0x29, 0x00, 0x33, 0x00, 0x3c, 0x00, 0x47, 0x00,
+  0x51, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x19, 0x00, 0x32, 0x00,
+  0x40, 0x00, 0x67, 0x00, 0x70, 0x00, 0x79, 0x00, 0x82, 0x00, 0x00, 0x00,
+  0x1d, 0x00, 0x30, 0x00, 0x51, 0x00, 0x5a, 0x00, 0x63, 0x00, 0x6e, 0x00,
+  0x7a, 0x00, 0x00, 0x00, 0x17, 0x00, 0x38, 0x00, 0x48, 0x00, 0x4e, 0x00,
+  0x00, 0x00, 0x1a, 0x00, 0x35, 0x00, 0x4e, 0x00, 0x59, 0x00, 0x00, 0x00,
+  0x2c, 0x00, 0x3e, 0x00, 0x63, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x1a, 0x00,
+  0x27, 0x00, 0x51, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x3c, 0x00, 0x56, 0x00,
+  0x70, 0x00, 0x99, 0x00, 0xa0, 0x00, 0xa9, 0x00, 0x00, 0x00, 0x19, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x37, 0x00, 0x51, 0x00, 0x5b, 0x00,
+  0x67, 0x00, 0x00, 0x00, 0x24, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x24, 0x00,
+  0x00, 0x00, 0x18, 0x00, 0x31, 0x00, 0x00, 0x00, 0x19, 0x00, 0x31, 0x00,
+  0x4b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x3c, 0x00, 0x00, 0x00,
+  0x1e, 0x00, 0x3e, 0x00, 0x47, 0x00, 0x00, 0x00, 0x17, 0x00, 0x2e, 0x00,
+  0x37, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x35, 0x00, 0x00, 0x00, 0x3e, 0x00,
+  0x58, 0x00, 0x69, 0x00, 0x7c, 0x00, 0x85, 0x00, 0x8c, 0x00, 0x94, 0x00,
+  0x00, 0x00, 0x13, 0x00, 0x25, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x14, 0x00,
+  0x1e, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x12, 0x00, 0x00, 0x00, 0x09, 0x00, 0x1d, 0x00, 0x26, 0x00,
+  0x2f, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x1a, 0x00,
+  0x2c, 0x00, 0x35, 0x00, 0x3e, 0x00, 0x47, 0x00, 0x59, 0x00, 0x62, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x0e, 0x00, 0x15, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x12, 0x00, 0x00, 0x00, 0x07, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x15, 0x00, 0x1e, 0x00, 0x27, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x08, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x13, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x07, 0x00, 0x10, 0x00, 0x1f, 0x00,
+  0x26, 0x00, 0x31, 0x00, 0x38, 0x00, 0x00, 0x00, 0x08, 0x00, 0x10, 0x00,
+  0x18, 0x00, 0x20, 0x00, 0x28, 0x00, 0x30, 0x00, 0x38, 0x00, 0x40, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x1a, 0x00, 0x23, 0x00, 0x2e, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x15, 0x00, 0x1d, 0x00, 0x25, 0x00,
+  0x2d, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x10, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x00, 0x00, 0x09, 0x00, 0x12, 0x00, 0x00, 0x00, 0x34, 0x00,
+  0x3e, 0x00, 0x00, 0x00, 0x35, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x33, 0x00, 0x67, 0x00, 0x9d, 0x00, 0xd2, 0x00, 0xdb, 0x00, 0xe4, 0x00,
+  0x00, 0x00, 0x34, 0x00, 0x69, 0x00, 0x9e, 0x00, 0xd4, 0x00, 0x0b, 0x01,
+  0x41, 0x01, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x11, 0x00, 0x1b, 0x00,
+  0x23, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0a, 0x00
+};
@@ -1,5 +1,7 @@
 #pragma once
-const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
+#include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/ru_dict_index.h>
+const unsigned char __espeakng_dict_ru[] __attribute__((aligned((4)))) = {
   0x00, 0x04, 0x00, 0x00, 0x78, 0xf0, 0x00, 0x00, 0x00, 0x64, 0x19, 0xf0,
   0x9f, 0x91, 0xa9, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xe2, 0x80,
   0x8d, 0xf0, 0x9f, 0x91, 0xa7, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa7,
@@ -5419,4 +5421,11 @@ const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
   0x00, 0xd1, 0x93, 0x00, 0xd1, 0x9b, 0x03, 0x4f, 0x00, 0xd2, 0x91, 0x03,
   0x52, 0x00, 0x07, 0x00
 };
-size_t __espeakng_dictlen = 65008;
+
+BackgroundAudioDictionary dict_ru = {
+    "ru",
+    65008,
+    __espeakng_dict_ru,
+    7846,
+    __espeakng_dictindex_ru
+};
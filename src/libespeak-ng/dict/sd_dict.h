@@ -1,5 +1,7 @@
 #pragma once
-const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
+#include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/sd_dict_index.h>
+const unsigned char __espeakng_dict_sd[] __attribute__((aligned((4)))) = {
   0x00, 0x04, 0x00, 0x00, 0x8a, 0xda, 0x00, 0x00, 0x00, 0x51, 0x19, 0xf0,
   0x9f, 0x91, 0xa9, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xe2, 0x80,
   0x8d, 0xf0, 0x9f, 0x91, 0xa7, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa7,
@@ -4995,4 +4997,11 @@ const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
   0x23, 0x00, 0x25, 0x03, 0x54, 0x06, 0x70, 0x5a, 0x6d, 0x49, 0x00, 0x2c,
   0x03, 0x5a, 0x6d, 0x31, 0x23, 0x2f, 0x0c, 0x6d, 0x41, 0x00, 0x07, 0x00
 };
-size_t __espeakng_dictlen = 59928;
+
+BackgroundAudioDictionary dict_sd = {
+    "sd",
+    59928,
+    __espeakng_dict_sd,
+    7562,
+    __espeakng_dictindex_sd
+};
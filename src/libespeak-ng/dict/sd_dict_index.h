@@ -0,0 +1,634 @@
+#pragma once
+const unsigned char __espeakng_dictindex_sd[] __attribute__((aligned((4)))) = {
+  0x45, 0x44, 0x58, 0x31, 0x18, 0xea, 0x00, 0x00, 0x8a, 0xda, 0x00, 0x00,
+  0x27, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x09, 0x00,
+  0x09, 0x00, 0x09, 0x00, 0x09, 0x00, 0x09, 0x00, 0x09, 0x00, 0x09, 0x00,
+  0x09, 0x00, 0x09, 0x00, 0x09, 0x00, 0x09, 0x00, 0x09, 0x00, 0x09, 0x00,
+  0x09, 0x00, 0x09, 0x00, 0x09, 0x00, 0x09, 0x00, 0x09, 0x00, 0x0a, 0x00,
+  0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00,
+  0x0c, 0x00, 0x0d, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00,
+  0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0f, 0x00, 0x0f, 0x00,
+  0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x10, 0x00,
+  0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x11, 0x00,
+  0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+  0x11, 0x00, 0x11, 0x00, 0x12, 0x00, 0x12, 0x00, 0x12, 0x00, 0x12, 0x00,
+  0x12, 0x00, 0x12, 0x00, 0x12, 0x00, 0x12, 0x00, 0x12, 0x00, 0x12, 0x00,
+  0x13, 0x00, 0x13, 0x00, 0x14, 0x00, 0x14, 0x00, 0x14, 0x00, 0x1c, 0x00,
+  0x1c, 0x00, 0x25, 0x00, 0x25, 0x00, 0x25, 0x00, 0x25, 0x00, 0x25, 0x00,
+  0x25, 0x00, 0x26, 0x00, 0x26, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00,
+  0x27, 0x00, 0x27, 0x00, 0x28, 0x00, 0x2f, 0x00, 0x30, 0x00, 0x37, 0x00,
+  0x38, 0x00, 0x38, 0x00, 0x39, 0x00, 0x39, 0x00, 0x39, 0x00, 0x39, 0x00,
+  0x39, 0x00, 0x39, 0x00, 0x39, 0x00, 0x39, 0x00, 0x39, 0x00, 0x3a, 0x00,
+  0x3b, 0x00, 0x43, 0x00, 0x45, 0x00, 0x4d, 0x00, 0x50, 0x00, 0x51, 0x00,
+  0x54, 0x00, 0x57, 0x00, 0x58, 0x00, 0x5a, 0x00, 0x5b, 0x00, 0x5d, 0x00,
+  0x5f, 0x00, 0x60, 0x00, 0x61, 0x00, 0x63, 0x00, 0x65, 0x00, 0x69, 0x00,
+  0x6a, 0x00, 0x70, 0x00, 0x72, 0x00, 0x76, 0x00, 0x78, 0x00, 0x78, 0x00,
+  0x78, 0x00, 0x7c, 0x00, 0x7d, 0x00, 0x7d, 0x00, 0x7d, 0x00, 0x7e, 0x00,
+  0x7e, 0x00, 0x80, 0x00, 0x81, 0x00, 0x84, 0x00, 0x87, 0x00, 0x8a, 0x00,
+  0x8d, 0x00, 0x8e, 0x00, 0x91, 0x00, 0x93, 0x00, 0x95, 0x00, 0x96, 0x00,
+  0x9a, 0x00, 0x9f, 0x00, 0xa1, 0x00, 0xa5, 0x00, 0xa8, 0x00, 0xab, 0x00,
+  0xae, 0x00, 0xb1, 0x00, 0xb2, 0x00, 0xb4, 0x00, 0xb5, 0x00, 0xb9, 0x00,
+  0xbb, 0x00, 0xbe, 0x00, 0xbf, 0x00, 0xc3, 0x00, 0xc4, 0x00, 0xc4, 0x00,
+  0xc4, 0x00, 0xc4, 0x00, 0xc6, 0x00, 0xc9, 0x00, 0xc9, 0x00, 0xc9, 0x00,
+  0xca, 0x00, 0xcb, 0x00, 0xcb, 0x00, 0xce, 0x00, 0xce, 0x00, 0xd0, 0x00,
+  0xd1, 0x00, 0xd1, 0x00, 0xd2, 0x00, 0xd2, 0x00, 0xd3, 0x00, 0xd4, 0x00,
+  0xd4, 0x00, 0xd4, 0x00, 0xd4, 0x00, 0xd4, 0x00, 0xd4, 0x00, 0xd4, 0x00,
+  0xd4, 0x00, 0xd4, 0x00, 0xd5, 0x00, 0xd5, 0x00, 0xd5, 0x00, 0xd5, 0x00,
+  0xd5, 0x00, 0xd5, 0x00, 0xd5, 0x00, 0xd6, 0x00, 0xd6, 0x00, 0xd6, 0x00,
+  0xd6, 0x00, 0xd6, 0x00, 0xd6, 0x00, 0xd6, 0x00, 0xd6, 0x00, 0xd6, 0x00,
+  0xd6, 0x00, 0xd6, 0x00, 0xd8, 0x00, 0xd9, 0x00, 0xd9, 0x00, 0xda, 0x00,
+  0xda, 0x00, 0xda, 0x00, 0xda, 0x00, 0xda, 0x00, 0xda, 0x00, 0xda, 0x00,
+  0xdb, 0x00, 0xdb, 0x00, 0xdb, 0x00, 0xdb, 0x00, 0xdb, 0x00, 0xdb, 0x00,
+  0xdb, 0x00, 0xdb, 0x00, 0xdb, 0x00, 0xdb, 0x00, 0xdb, 0x00, 0xdc, 0x00,
+  0xdc, 0x00, 0xdc, 0x00, 0xdc, 0x00, 0xdc, 0x00, 0xdc, 0x00, 0xdc, 0x00,
+  0xdc, 0x00, 0xdf, 0x00, 0xe0, 0x00, 0xe2, 0x00, 0xe2, 0x00, 0xe3, 0x00,
+  0xe4, 0x00, 0xe5, 0x00, 0xe5, 0x00, 0xe5, 0x00, 0xe5, 0x00, 0xe5, 0x00,
+  0xe5, 0x00, 0xe5, 0x00, 0xe5, 0x00, 0xe5, 0x00, 0xe5, 0x00, 0xe5, 0x00,
+  0xe5, 0x00, 0xe5, 0x00, 0xe5, 0x00, 0xe6, 0x00, 0xe7, 0x00, 0xe8, 0x00,
+  0xe9, 0x00, 0xea, 0x00, 0xea, 0x00, 0xea, 0x00, 0xea, 0x00, 0xea, 0x00,
+  0xea, 0x00, 0xed, 0x00, 0xed, 0x00, 0xed, 0x00, 0xee, 0x00, 0xef, 0x00,
+  0xef, 0x00, 0xef, 0x00, 0xef, 0x00, 0xef, 0x00, 0xf0, 0x00, 0xf1, 0x00,
+  0xf1, 0x00, 0xf1, 0x00, 0xf2, 0x00, 0xf2, 0x00, 0xf3, 0x00, 0xf3, 0x00,
+  0xf3, 0x00, 0xf3, 0x00, 0xf3, 0x00, 0xf3, 0x00, 0xf3, 0x00, 0xf3, 0x00,
+  0xf3, 0x00, 0xf3, 0x00, 0xf3, 0x00, 0xf3, 0x00, 0xf4, 0x00, 0xf4, 0x00,
+  0xf4, 0x00, 0xf5, 0x00, 0xf5, 0x00, 0xf5, 0x00, 0xf6, 0x00, 0xf7, 0x00,
+  0xf8, 0x00, 0xf8, 0x00, 0xf8, 0x00, 0xf9, 0x00, 0xf9, 0x00, 0xfa, 0x00,
+  0xfa, 0x00, 0xfa, 0x00, 0xfa, 0x00, 0xfa, 0x00, 0xfb, 0x00, 0xfb, 0x00,
+  0xfb, 0x00, 0xfb, 0x00, 0xfb, 0x00, 0xfb, 0x00, 0xfc, 0x00, 0xfe, 0x00,
+  0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00,
+  0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00,
+  0xfe, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
+  0xff, 0x00, 0xff, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x01, 0x05, 0x01,
+  0x06, 0x01, 0x07, 0x01, 0x09, 0x01, 0x0b, 0x01, 0x0c, 0x01, 0x0e, 0x01,
+  0x0f, 0x01, 0x11, 0x01, 0x12, 0x01, 0x13, 0x01, 0x17, 0x01, 0x19, 0x01,
+  0x1d, 0x01, 0x20, 0x01, 0x22, 0x01, 0x23, 0x01, 0x24, 0x01, 0x25, 0x01,
+  0x27, 0x01, 0x27, 0x01, 0x28, 0x01, 0x29, 0x01, 0x2a, 0x01, 0x2a, 0x01,
+  0x2a, 0x01, 0x2a, 0x01, 0x2a, 0x01, 0x2a, 0x01, 0x2a, 0x01, 0x2a, 0x01,
+  0x2c, 0x01, 0x2e, 0x01, 0x30, 0x01, 0x31, 0x01, 0x32, 0x01, 0x33, 0x01,
+  0x34, 0x01, 0x35, 0x01, 0x36, 0x01, 0x37, 0x01, 0x38, 0x01, 0x39, 0x01,
+  0x3a, 0x01, 0x3b, 0x01, 0x3c, 0x01, 0x3d, 0x01, 0x3e, 0x01, 0x3f, 0x01,
+  0x3f, 0x01, 0x3f, 0x01, 0x3f, 0x01, 0x3f, 0x01, 0x40, 0x01, 0x40, 0x01,
+  0x42, 0x01, 0x44, 0x01, 0x45, 0x01, 0x46, 0x01, 0x48, 0x01, 0x4b, 0x01,
+  0x4c, 0x01, 0x4d, 0x01, 0x4e, 0x01, 0x50, 0x01, 0x51, 0x01, 0x53, 0x01,
+  0x53, 0x01, 0x53, 0x01, 0x54, 0x01, 0x54, 0x01, 0x56, 0x01, 0x57, 0x01,
+  0x57, 0x01, 0x57, 0x01, 0x57, 0x01, 0x57, 0x01, 0x58, 0x01, 0x59, 0x01,
+  0x5b, 0x01, 0x5d, 0x01, 0x5e, 0x01, 0x5f, 0x01, 0x60, 0x01, 0x62, 0x01,
+  0x63, 0x01, 0x64, 0x01, 0x66, 0x01, 0x68, 0x01, 0x69, 0x01, 0x6a, 0x01,
+  0x6b, 0x01, 0x6c, 0x01, 0x6d, 0x01, 0x6e, 0x01, 0x70, 0x01, 0x71, 0x01,
+  0x72, 0x01, 0x74, 0x01, 0x74, 0x01, 0x74, 0x01, 0x74, 0x01, 0x75, 0x01,
+  0x76, 0x01, 0x78, 0x01, 0x79, 0x01, 0x79, 0x01, 0x79, 0x01, 0x79, 0x01,
+  0x79, 0x01, 0x79, 0x01, 0x7b, 0x01, 0x7d, 0x01, 0x7e, 0x01, 0x7f, 0x01,
+  0x80, 0x01, 0x81, 0x01, 0x82, 0x01, 0x83, 0x01, 0x84, 0x01, 0x85, 0x01,
+  0x86, 0x01, 0x87, 0x01, 0x89, 0x01, 0x8a, 0x01, 0x8b, 0x01, 0x8c, 0x01,
+  0x8e, 0x01, 0x91, 0x01, 0x93, 0x01, 0x95, 0x01, 0x99, 0x01, 0x9c, 0x01,
+  0x9f, 0x01, 0xa2, 0x01, 0xa3, 0x01, 0xa5, 0x01, 0xa5, 0x01, 0xa5, 0x01,
+  0xa6, 0x01, 0xa7, 0x01, 0xa9, 0x01, 0xab, 0x01, 0xad, 0x01, 0xae, 0x01,
+  0xaf, 0x01, 0xb1, 0x01, 0xb2, 0x01, 0xb3, 0x01, 0xb3, 0x01, 0xb4, 0x01,
+  0xb7, 0x01, 0xba, 0x01, 0xbc, 0x01, 0xbc, 0x01, 0xbd, 0x01, 0xbe, 0x01,
+  0xc0, 0x01, 0xc1, 0x01, 0xc2, 0x01, 0xc2, 0x01, 0xc2, 0x01, 0xc3, 0x01,
+  0xc5, 0x01, 0xc6, 0x01, 0xca, 0x01, 0xcc, 0x01, 0xcd, 0x01, 0xce, 0x01,
+  0xcf, 0x01, 0xd2, 0x01, 0xd4, 0x01, 0xd7, 0x01, 0xda, 0x01, 0xdb, 0x01,
+  0xdb, 0x01, 0xdb, 0x01, 0xdd, 0x01, 0xde, 0x01, 0xdf, 0x01, 0xe0, 0x01,
+  0xe1, 0x01, 0xe4, 0x01, 0xe5, 0x01, 0xe6, 0x01, 0xe7, 0x01, 0xe8, 0x01,
+  0xea, 0x01, 0xed, 0x01, 0xf0, 0x01, 0xf2, 0x01, 0xf3, 0x01, 0xf3, 0x01,
+  0xf3, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf5, 0x01, 0xf5, 0x01, 0xf5, 0x01,
+  0xf5, 0x01, 0xf5, 0x01, 0xf5, 0x01, 0xf5, 0x01, 0xf6, 0x01, 0xf7, 0x01,
+  0xf8, 0x01, 0xf9, 0x01, 0xfa, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01,
+  0xfb, 0x01, 0xfc, 0x01, 0xfc, 0x01, 0xfc, 0x01, 0xfe, 0x01, 0xff, 0x01,
+  0xff, 0x01, 0x00, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02,
+  0x02, 0x02, 0x03, 0x02, 0x03, 0x02, 0x04, 0x02, 0x04, 0x02, 0x04, 0x02,
+  0x04, 0x02, 0x05, 0x02, 0x06, 0x02, 0x06, 0x02, 0x06, 0x02, 0x06, 0x02,
+  0x06, 0x02, 0x06, 0x02, 0x06, 0x02, 0x06, 0x02, 0x06, 0x02, 0x06, 0x02,
+  0x07, 0x02, 0x08, 0x02, 0x08, 0x02, 0x08, 0x02, 0x09, 0x02, 0x09, 0x02,
+  0x09, 0x02, 0x09, 0x02, 0x09, 0x02, 0x09, 0x02, 0x09, 0x02, 0x09, 0x02,
+  0x09, 0x02, 0x09, 0x02, 0x09, 0x02, 0x09, 0x02, 0x09, 0x02, 0x09, 0x02,
+  0x09, 0x02, 0x09, 0x02, 0x09, 0x02, 0x0a, 0x02, 0x0a, 0x02, 0x0a, 0x02,
+  0x0b, 0x02, 0x0c, 0x02, 0x0c, 0x02, 0x0e, 0x02, 0x0e, 0x02, 0x0e, 0x02,
+  0x0e, 0x02, 0x0e, 0x02, 0x0e, 0x02, 0x0e, 0x02, 0x0e, 0x02, 0x0e, 0x02,
+  0x0e, 0x02, 0x0e, 0x02, 0x0e, 0x02, 0x0e, 0x02, 0x0e, 0x02, 0x0f, 0x02,
+  0x0f, 0x02, 0x0f, 0x02, 0x10, 0x02, 0x10, 0x02, 0x10, 0x02, 0x12, 0x02,
+  0x13, 0x02, 0x13, 0x02, 0x15, 0x02, 0x16, 0x02, 0x17, 0x02, 0x18, 0x02,
+  0x19, 0x02, 0x1a, 0x02, 0x1a, 0x02, 0x1b, 0x02, 0x1c, 0x02, 0x1d, 0x02,
+  0x1d, 0x02, 0x1d, 0x02, 0x1d, 0x02, 0x1d, 0x02, 0x1d, 0x02, 0x1d, 0x02,
+  0x1d, 0x02, 0x1f, 0x02, 0x20, 0x02, 0x21, 0x02, 0x21, 0x02, 0x23, 0x02,
+  0x23, 0x02, 0x27, 0x02, 0x2a, 0x02, 0x2a, 0x02, 0x2b, 0x02, 0x2b, 0x02,
+  0x2b, 0x02, 0x2e, 0x02, 0x30, 0x02, 0x32, 0x02, 0x34, 0x02, 0x37, 0x02,
+  0x39, 0x02, 0x3b, 0x02, 0x3d, 0x02, 0x41, 0x02, 0x42, 0x02, 0x44, 0x02,
+  0x45, 0x02, 0x46, 0x02, 0x48, 0x02, 0x4b, 0x02, 0x4c, 0x02, 0x51, 0x02,
+  0x56, 0x02, 0x5b, 0x02, 0x5f, 0x02, 0x65, 0x02, 0x6a, 0x02, 0x70, 0x02,
+  0x75, 0x02, 0x78, 0x02, 0x7b, 0x02, 0x7e, 0x02, 0x81, 0x02, 0x84, 0x02,
+  0x89, 0x02, 0x8c, 0x02, 0x90, 0x02, 0x95, 0x02, 0x9a, 0x02, 0xa0, 0x02,
+  0xa6, 0x02, 0xac, 0x02, 0xb2, 0x02, 0xb7, 0x02, 0xbc, 0x02, 0xc2, 0x02,
+  0xc7, 0x02, 0xcd, 0x02, 0xd3, 0x02, 0xd8, 0x02, 0xdd, 0x02, 0xe3, 0x02,
+  0xe8, 0x02, 0xf1, 0x02, 0xf9, 0x02, 0x07, 0x03, 0x0f, 0x03, 0x1d, 0x03,
+  0x26, 0x03, 0x2e, 0x03, 0x37, 0x03, 0x3e, 0x03, 0x45, 0x03, 0x4b, 0x03,
+  0x52, 0x03, 0x59, 0x03, 0x60, 0x03, 0x66, 0x03, 0x6c, 0x03, 0x74, 0x03,
+  0x7c, 0x03, 0x83, 0x03, 0x8b, 0x03, 0x93, 0x03, 0x9a, 0x03, 0xa2, 0x03,
+  0xaa, 0x03, 0xb0, 0x03, 0xb7, 0x03, 0xbe, 0x03, 0xc4, 0x03, 0xca, 0x03,
+  0xd2, 0x03, 0xd9, 0x03, 0xe1, 0x03, 0xe8, 0x03, 0xee, 0x03, 0xfd, 0x03,
+  0x03, 0x04, 0x12, 0x04, 0x19, 0x04, 0x1f, 0x04, 0x25, 0x04, 0x2d, 0x04,
+  0x35, 0x04, 0x3c, 0x04, 0x44, 0x04, 0x4b, 0x04, 0x52, 0x04, 0x5a, 0x04,
+  0x61, 0x04, 0x66, 0x04, 0x6b, 0x04, 0x70, 0x04, 0x76, 0x04, 0x7c, 0x04,
+  0x82, 0x04, 0x89, 0x04, 0x90, 0x04, 0x98, 0x04, 0xa0, 0x04, 0xa7, 0x04,
+  0xad, 0x04, 0xb3, 0x04, 0xb9, 0x04, 0xc0, 0x04, 0xc8, 0x04, 0xcc, 0x04,
+  0xd0, 0x04, 0xd4, 0x04, 0xd9, 0x04, 0xde, 0x04, 0xe2, 0x04, 0xe8, 0x04,
+  0xee, 0x04, 0xf4, 0x04, 0xf8, 0x04, 0xfd, 0x04, 0x02, 0x05, 0x06, 0x05,
+  0x0a, 0x05, 0x0f, 0x05, 0x14, 0x05, 0x17, 0x05, 0x1b, 0x05, 0x1f, 0x05,
+  0x22, 0x05, 0x25, 0x05, 0x28, 0x05, 0x2d, 0x05, 0x32, 0x05, 0x37, 0x05,
+  0x3c, 0x05, 0x41, 0x05, 0x48, 0x05, 0x4b, 0x05, 0x4e, 0x05, 0x51, 0x05,
+  0x54, 0x05, 0x58, 0x05, 0x5d, 0x05, 0x60, 0x05, 0x63, 0x05, 0x65, 0x05,
+  0x67, 0x05, 0x69, 0x05, 0x6c, 0x05, 0x6f, 0x05, 0x72, 0x05, 0x76, 0x05,
+  0x83, 0x05, 0x85, 0x05, 0x87, 0x05, 0x8a, 0x05, 0x8e, 0x05, 0x8f, 0x05,
+  0x90, 0x05, 0x92, 0x05, 0x94, 0x05, 0x95, 0x05, 0x96, 0x05, 0x98, 0x05,
+  0x9a, 0x05, 0x9e, 0x05, 0xa1, 0x05, 0xa3, 0x05, 0xa7, 0x05, 0xab, 0x05,
+  0xae, 0x05, 0xb3, 0x05, 0xb8, 0x05, 0xb9, 0x05, 0xba, 0x05, 0xbc, 0x05,
+  0xbd, 0x05, 0xbd, 0x05, 0xc0, 0x05, 0xc3, 0x05, 0xc3, 0x05, 0xc5, 0x05,
+  0xc8, 0x05, 0xca, 0x05, 0xd1, 0x05, 0xd4, 0x05, 0xd6, 0x05, 0xd8, 0x05,
+  0xda, 0x05, 0xdb, 0x05, 0xdd, 0x05, 0xde, 0x05, 0xdf, 0x05, 0xe0, 0x05,
+  0xe1, 0x05, 0xe2, 0x05, 0xe6, 0x05, 0xe9, 0x05, 0xed, 0x05, 0xf1, 0x05,
+  0xf5, 0x05, 0xf9, 0x05, 0xfd, 0x05, 0xff, 0x05, 0x05, 0x06, 0x0d, 0x06,
+  0x14, 0x06, 0x1a, 0x06, 0x1f, 0x06, 0x24, 0x06, 0x29, 0x06, 0x2d, 0x06,
+  0x30, 0x06, 0x31, 0x06, 0x32, 0x06, 0x35, 0x06, 0x3a, 0x06, 0x3d, 0x06,
+  0x41, 0x06, 0x43, 0x06, 0x45, 0x06, 0x4a, 0x06, 0x4f, 0x06, 0x55, 0x06,
+  0x5b, 0x06, 0x60, 0x06, 0x65, 0x06, 0x6b, 0x06, 0x73, 0x06, 0x79, 0x06,
+  0x80, 0x06, 0x87, 0x06, 0x8e, 0x06, 0x96, 0x06, 0x9e, 0x06, 0xa5, 0x06,
+  0xad, 0x06, 0xb3, 0x06, 0xb8, 0x06, 0xbb, 0x06, 0xc1, 0x06, 0xc6, 0x06,
+  0xc8, 0x06, 0xca, 0x06, 0xcc, 0x06, 0xce, 0x06, 0xd2, 0x06, 0xd7, 0x06,
+  0xdc, 0x06, 0xdf, 0x06, 0xe4, 0x06, 0xe6, 0x06, 0xe8, 0x06, 0xe8, 0x06,
+  0xe8, 0x06, 0xe8, 0x06, 0xe8, 0x06, 0xea, 0x06, 0xec, 0x06, 0xed, 0x06,
+  0xee, 0x06, 0xef, 0x06, 0xf2, 0x06, 0xf4, 0x06, 0xf6, 0x06, 0xf8, 0x06,
+  0xfa, 0x06, 0xfc, 0x06, 0x00, 0x07, 0x01, 0x07, 0x04, 0x07, 0x05, 0x07,
+  0x06, 0x07, 0x08, 0x07, 0x0b, 0x07, 0x0c, 0x07, 0x0f, 0x07, 0x11, 0x07,
+  0x13, 0x07, 0x15, 0x07, 0x17, 0x07, 0x17, 0x07, 0x17, 0x07, 0x17, 0x07,
+  0x17, 0x07, 0x17, 0x07, 0x17, 0x07, 0x17, 0x07, 0x17, 0x07, 0x17, 0x07,
+  0x17, 0x07, 0x17, 0x07, 0x17, 0x07, 0x17, 0x07, 0x17, 0x07, 0x17, 0x07,
+  0x17, 0x07, 0x17, 0x07, 0x18, 0x07, 0x18, 0x07, 0x18, 0x07, 0x18, 0x07,
+  0x18, 0x07, 0x18, 0x07, 0x18, 0x07, 0x18, 0x07, 0x19, 0x07, 0x19, 0x07,
+  0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07,
+  0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07,
+  0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07,
+  0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07,
+  0x19, 0x07, 0x19, 0x07, 0x1a, 0x07, 0x1a, 0x07, 0x1b, 0x07, 0x1c, 0x07,
+  0x1c, 0x07, 0x20, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07,
+  0x27, 0x07, 0x00, 0x00, 0x8c, 0x02, 0x63, 0x31, 0x3e, 0xc6, 0x70, 0x35,
+  0x0b, 0x65, 0xf1, 0xf1, 0x82, 0xfe, 0xe5, 0xee, 0x41, 0x03, 0x9e, 0xad,
+  0xb8, 0xa5, 0x89, 0xb3, 0xd6, 0x07, 0xa9, 0xfb, 0x48, 0x9a, 0xa1, 0xde,
+  0xe3, 0xe4, 0x05, 0xc9, 0x0e, 0x22, 0x79, 0x5b, 0x74, 0xff, 0xde, 0xef,
+  0xac, 0x58, 0xbe, 0xa4, 0x53, 0x17, 0x8d, 0xc4, 0x93, 0x7f, 0x9d, 0x0c,
+  0x3b, 0x1e, 0x6c, 0xd2, 0xae, 0x45, 0xa5, 0xf5, 0x61, 0x61, 0xfb, 0xa1,
+  0x49, 0xe7, 0x7a, 0x2c, 0x84, 0xde, 0x0a, 0x1a, 0x58, 0x39, 0x16, 0xcf,
+  0x35, 0x1e, 0xa8, 0x94, 0x1d, 0x90, 0xbd, 0x80, 0x36, 0x4c, 0x9d, 0xd4,
+  0x96, 0x22, 0x09, 0x81, 0x6f, 0x4d, 0xa4, 0xfe, 0x49, 0xfc, 0xdf, 0x8e,
+  0x6a, 0x12, 0x27, 0x38, 0xf5, 0x13, 0x7d, 0xe4, 0x80, 0x17, 0xbe, 0x89,
+  0x0f, 0xa5, 0xd5, 0x32, 0xfb, 0x14, 0x8c, 0xe6, 0x72, 0x35, 0x36, 0x8b,
+  0xbe, 0xc3, 0x91, 0xb0, 0xc8, 0x57, 0x24, 0x65, 0x79, 0x02, 0x09, 0xcc,
+  0xb3, 0x27, 0xf2, 0xed, 0xd8, 0xe3, 0x9b, 0xe2, 0xfa, 0x1e, 0x24, 0x34,
+  0x56, 0xf3, 0x24, 0x09, 0xd5, 0xbe, 0x4f, 0x9a, 0x49, 0x32, 0xfe, 0x72,
+  0xb4, 0xaf, 0x62, 0x1a, 0x1e, 0x7b, 0x25, 0xaa, 0xb4, 0x37, 0x75, 0x5a,
+  0xf9, 0x81, 0xff, 0x90, 0x6c, 0x3b, 0x10, 0xbb, 0x48, 0xf7, 0x08, 0x09,
+  0xfb, 0xfb, 0x9d, 0x37, 0x98, 0xbe, 0x72, 0x0d, 0xf2, 0xf6, 0x41, 0xbf,
+  0x45, 0xd7, 0x37, 0xde, 0x11, 0xf4, 0xd8, 0xac, 0x31, 0x14, 0xf2, 0xbd,
+  0x22, 0xdc, 0xa0, 0x5e, 0x17, 0xff, 0x03, 0x3e, 0x12, 0x76, 0x81, 0xd5,
+  0x7f, 0x8d, 0x63, 0x01, 0x67, 0xbc, 0xda, 0x4f, 0xff, 0x0c, 0xa9, 0xbc,
+  0xa4, 0x98, 0x1f, 0x0d, 0xfb, 0x6f, 0x53, 0xc3, 0xd5, 0x9d, 0x4b, 0x92,
+  0x47, 0x87, 0x17, 0x99, 0x79, 0x42, 0x2e, 0x85, 0x21, 0xe9, 0x10, 0x97,
+  0x81, 0xf0, 0x6c, 0xdb, 0xaf, 0x26, 0x43, 0x8e, 0x1b, 0x3e, 0x76, 0xc1,
+  0xc4, 0x15, 0xeb, 0x07, 0x01, 0x0c, 0xbf, 0xa9, 0x2e, 0x34, 0x3d, 0xe2,
+  0x57, 0x4e, 0xa9, 0x35, 0xf3, 0x3d, 0x65, 0xd0, 0x4a, 0x3c, 0x91, 0xf1,
+  0x04, 0xac, 0xbb, 0x07, 0x25, 0x9a, 0x33, 0xdf, 0x4c, 0xd9, 0x21, 0xe6,
+  0x76, 0x5e, 0x28, 0x71, 0xc8, 0x68, 0x9b, 0x5b, 0xc2, 0x54, 0xf9, 0xd4,
+  0x55, 0xe0, 0x1d, 0x7a, 0x8f, 0x19, 0xd6, 0x0e, 0xc9, 0xcd, 0xbb, 0xd5,
+  0x57, 0x31, 0xa4, 0xb4, 0x36, 0x70, 0xcd, 0xc0, 0xb6, 0xcf, 0x5c, 0x19,
+  0x84, 0x70, 0x5b, 0xc7, 0x2f, 0xbf, 0x10, 0xd8, 0xdc, 0x49, 0xfd, 0x6a,
+  0x9b, 0xe4, 0xf7, 0x72, 0x18, 0xaf, 0x25, 0xd8, 0x4e, 0xf5, 0x00, 0x6b,
+  0x1f, 0x35, 0x45, 0xc6, 0x96, 0x70, 0x48, 0xec, 0x88, 0x80, 0xc5, 0x3d,
+  0x50, 0xa8, 0x3f, 0x2a, 0x9a, 0x01, 0x71, 0x7f, 0x91, 0x22, 0xb4, 0xef,
+  0xa5, 0xd7, 0x48, 0xea, 0xad, 0xa3, 0xc1, 0x59, 0x77, 0x51, 0x98, 0xe2,
+  0x0e, 0x6b, 0x09, 0xb2, 0x2d, 0xec, 0xee, 0x21, 0x98, 0x2e, 0xe3, 0x08,
+  0xbf, 0x4a, 0x2e, 0x85, 0xc4, 0x18, 0x83, 0x10, 0x7d, 0x78, 0x89, 0x56,
+  0x7c, 0xae, 0x71, 0xd3, 0xcb, 0x7a, 0x4d, 0xd0, 0x76, 0xb7, 0xb8, 0x11,
+  0x02, 0x03, 0x51, 0xc8, 0xe1, 0x70, 0xe7, 0x01, 0x95, 0x0e, 0xa7, 0x1d,
+  0xd9, 0xb5, 0xe0, 0xf2, 0x9d, 0xec, 0x6e, 0x65, 0x2e, 0xf9, 0x56, 0xc4,
+  0x95, 0x41, 0xb2, 0x57, 0x2f, 0xeb, 0xf9, 0x95, 0x31, 0x5b, 0x0a, 0x23,
+  0x3c, 0xad, 0x44, 0x12, 0xdb, 0x94, 0x62, 0xfb, 0x74, 0x0a, 0x4c, 0xef,
+  0x51, 0x7b, 0x3f, 0xc0, 0xe6, 0x02, 0x08, 0x96, 0x7a, 0xe3, 0x71, 0xe8,
+  0x2f, 0xf2, 0x19, 0xe9, 0x7a, 0x45, 0x13, 0xd2, 0x98, 0x83, 0x13, 0x66,
+  0x7d, 0x18, 0xa7, 0x77, 0xd6, 0xc9, 0x2f, 0x9c, 0x47, 0xef, 0xab, 0xa0,
+  0xae, 0x11, 0xee, 0xbe, 0x21, 0xd0, 0x45, 0x40, 0xa8, 0x6b, 0x8b, 0x4a,
+  0xfe, 0x34, 0x5f, 0xbe, 0xae, 0xa7, 0xd0, 0x79, 0x64, 0xe5, 0xad, 0xc2,
+  0xab, 0x6c, 0x3d, 0x1d, 0xfd, 0xaf, 0x2a, 0x49, 0xd5, 0x36, 0x6b, 0xa3,
+  0x05, 0x1b, 0x9a, 0xf4, 0xc0, 0x2c, 0x9b, 0xb5, 0x2a, 0x47, 0xb6, 0xd4,
+  0xc2, 0x61, 0xad, 0xa9, 0xfe, 0xe6, 0x58, 0xba, 0xc9, 0xbb, 0x50, 0x11,
+  0xba, 0xcd, 0xcd, 0x48, 0x1a, 0x0f, 0x9c, 0xcc, 0xcc, 0x84, 0x9b, 0x02,
+  0x7c, 0xbc, 0x75, 0xd6, 0xef, 0xe1, 0xb0, 0xe7, 0x67, 0x5d, 0x8d, 0xc3,
+  0xb5, 0xd6, 0x35, 0x9e, 0x20, 0x76, 0x4a, 0xac, 0xa6, 0x02, 0x3f, 0x94,
+  0x3e, 0x5e, 0xf1, 0xf4, 0x51, 0x21, 0x8f, 0xcf, 0x5d, 0xad, 0xe9, 0x63,
+  0x40, 0x60, 0x0f, 0xe8, 0x03, 0xa4, 0x03, 0xf0, 0x18, 0x17, 0x62, 0x89,
+  0x81, 0xcb, 0x79, 0x38, 0x38, 0x32, 0xbd, 0xd2, 0xac, 0x23, 0x4a, 0xc3,
+  0xd1, 0x78, 0x8c, 0x31, 0xa0, 0x60, 0xe6, 0x32, 0x80, 0x59, 0xf4, 0x49,
+  0x61, 0x4e, 0xfb, 0x92, 0x80, 0xc7, 0x17, 0xdd, 0x68, 0x3e, 0xb7, 0xb6,
+  0xe2, 0x7f, 0x1a, 0xa9, 0x22, 0x25, 0x70, 0xe2, 0x80, 0x5d, 0x8a, 0x97,
+  0xa7, 0x35, 0xc4, 0x79, 0x0e, 0x55, 0x9b, 0x7c, 0xfc, 0x39, 0xba, 0x3f,
+  0x78, 0x60, 0x14, 0xd6, 0x0f, 0xb5, 0xe9, 0xa3, 0x0e, 0x5a, 0x4e, 0x4d,
+  0xb3, 0x33, 0x9b, 0x2a, 0xdc, 0xd2, 0x23, 0x32, 0x6f, 0x61, 0x69, 0xa6,
+  0x46, 0xda, 0xc9, 0x1f, 0x32, 0xd9, 0x44, 0x18, 0x89, 0x9b, 0x6a, 0x65,
+  0xf9, 0x94, 0x3e, 0x53, 0x68, 0x03, 0x36, 0x1f, 0x73, 0x98, 0xeb, 0xfe,
+  0xeb, 0xf9, 0x9c, 0xaa, 0xed, 0xe8, 0x0f, 0x70, 0x0d, 0x5c, 0xd3, 0x42,
+  0x4e, 0xe5, 0xaf, 0x03, 0xef, 0x1d, 0x40, 0x58, 0x48, 0xa2, 0x95, 0xac,
+  0x79, 0x89, 0xce, 0xcd, 0x34, 0x53, 0x34, 0x21, 0xea, 0x7f, 0x6f, 0xca,
+  0x56, 0xe3, 0x5d, 0xac, 0xcd, 0xa9, 0x61, 0xc5, 0x40, 0xe6, 0x97, 0xf6,
+  0x5b, 0xbb, 0x5f, 0xd9, 0x7a, 0xd4, 0xf2, 0x2e, 0xf3, 0x2e, 0x9e, 0x06,
+  0xec, 0x6f, 0xcb, 0x7a, 0xb3, 0x62, 0x94, 0x3c, 0xf6, 0x92, 0xfb, 0xe4,
+  0x75, 0x9b, 0x20, 0x9d, 0x66, 0x2a, 0x54, 0x1d, 0x0a, 0x8d, 0xf4, 0xec,
+  0x9a, 0x87, 0x89, 0xf4, 0xc4, 0x71, 0xf1, 0x7f, 0x34, 0x63, 0x72, 0x22,
+  0xc7, 0x89, 0xbe, 0x2b, 0x5a, 0x56, 0xeb, 0x50, 0x1d, 0x12, 0xbf, 0xe8,
+  0xc3, 0x47, 0xb6, 0xa0, 0x41, 0x5e, 0x43, 0x3b, 0x03, 0x48, 0xd6, 0xce,
+  0x29, 0xa0, 0x91, 0xdf, 0x1f, 0x6d, 0xa3, 0xa8, 0x82, 0x26, 0x5a, 0x42,
+  0x8b, 0x9c, 0xd7, 0x55, 0xfe, 0xb4, 0xa7, 0x36, 0x16, 0x7a, 0xf5, 0x66,
+  0xde, 0x7f, 0x03, 0xa2, 0xa5, 0x2b, 0x3e, 0xd5, 0x55, 0xc4, 0x93, 0x51,
+  0x37, 0x1d, 0x1a, 0x38, 0x64, 0x90, 0x68, 0x45, 0x8e, 0x8c, 0xb0, 0xf2,
+  0x06, 0xf0, 0x64, 0xe8, 0x34, 0xc7, 0x5f, 0x05, 0x35, 0x41, 0x10, 0x76,
+  0xa1, 0x78, 0xef, 0x93, 0x9a, 0xdd, 0xde, 0x8f, 0xce, 0xe2, 0xc4, 0x6d,
+  0x53, 0x21, 0x61, 0x51, 0x64, 0x3c, 0xf1, 0x3e, 0x68, 0x15, 0xb3, 0xbb,
+  0xed, 0x18, 0xa6, 0x1a, 0x81, 0xc9, 0x59, 0x80, 0x19, 0x09, 0x84, 0xb0,
+  0x12, 0x37, 0x89, 0x9b, 0x33, 0x2f, 0xaa, 0x7e, 0xa7, 0xe1, 0x48, 0xda,
+  0xab, 0x99, 0xf1, 0x0b, 0xd3, 0xa8, 0xfc, 0xb4, 0x5a, 0x70, 0x8f, 0x9a,
+  0x66, 0x34, 0xf6, 0x76, 0x9a, 0x5c, 0x78, 0xcc, 0x41, 0xe5, 0x0e, 0xce,
+  0xe7, 0x7b, 0xfe, 0xaa, 0x3a, 0x85, 0xc3, 0x2d, 0xd8, 0xd9, 0x21, 0xdd,
+  0x5f, 0xbd, 0x79, 0x0f, 0x95, 0xa9, 0xce, 0xd1, 0xeb, 0x9e, 0x1c, 0xcb,
+  0xb3, 0xef, 0xe2, 0x0b, 0x42, 0xb5, 0xf4, 0x10, 0x38, 0x38, 0x94, 0x0e,
+  0x91, 0x3b, 0x95, 0xa8, 0xaf, 0x25, 0x78, 0x29, 0x89, 0x5f, 0x01, 0xff,
+  0x3b, 0x45, 0x1c, 0xcf, 0x4f, 0x08, 0xa5, 0xd0, 0x5a, 0x7f, 0x6a, 0x89,
+  0x39, 0x54, 0xc7, 0x69, 0x2f, 0x8c, 0xfe, 0x1f, 0xca, 0xe6, 0x6b, 0xf7,
+  0xbb, 0x9e, 0xaa, 0x10, 0x31, 0xfa, 0x4a, 0xc4, 0x2d, 0xf8, 0xad, 0xa3,
+  0x0a, 0xd0, 0x57, 0xa8, 0xbd, 0x93, 0xf0, 0x87, 0x3d, 0xd7, 0x95, 0x44,
+  0x20, 0x80, 0x30, 0xac, 0x26, 0x74, 0x18, 0xd0, 0xba, 0xf3, 0x73, 0x10,
+  0xb0, 0xb2, 0x63, 0x4b, 0x5b, 0x1d, 0x83, 0x1f, 0x01, 0x92, 0xa0, 0x90,
+  0x65, 0x47, 0x32, 0x1e, 0x22, 0xd5, 0xe5, 0x73, 0x51, 0xf3, 0x58, 0x70,
+  0xe6, 0x3f, 0xe4, 0x05, 0xb4, 0x86, 0xf0, 0xd2, 0x62, 0xda, 0x03, 0x91,
+  0x44, 0x40, 0x03, 0xd1, 0x64, 0x04, 0x99, 0x8b, 0xff, 0xa3, 0x25, 0xf7,
+  0xaa, 0x58, 0x69, 0x61, 0x62, 0xb4, 0x66, 0xd0, 0xfd, 0xa7, 0xc7, 0x8b,
+  0x60, 0x81, 0xd2, 0x9e, 0x81, 0x36, 0x72, 0xff, 0xd2, 0x10, 0x39, 0x70,
+  0xd6, 0xb2, 0xb0, 0x01, 0xd4, 0xaf, 0xbf, 0x6a, 0x24, 0xf3, 0x4b, 0x1a,
+  0x01, 0x5c, 0xd1, 0x2a, 0xbf, 0x2d, 0x3d, 0xcb, 0x41, 0xb4, 0x2a, 0xbb,
+  0xae, 0x1d, 0xae, 0xf6, 0xc3, 0x82, 0xc9, 0xe5, 0xac, 0xc0, 0x66, 0x54,
+  0xfa, 0x64, 0x4f, 0x9d, 0xf3, 0x46, 0xd9, 0x7a, 0xe9, 0x37, 0x25, 0xe5,
+  0x13, 0x8e, 0xfa, 0x9a, 0x86, 0x24, 0x2f, 0x4a, 0x0c, 0x49, 0x9d, 0x78,
+  0x3a, 0xbd, 0xd9, 0x37, 0xc9, 0x2f, 0x72, 0xaa, 0x80, 0x38, 0xfc, 0xdf,
+  0x82, 0xd4, 0xee, 0x8a, 0x4e, 0x52, 0x1f, 0x15, 0x01, 0x41, 0x0c, 0x28,
+  0xb3, 0xe2, 0x9f, 0x46, 0x28, 0x22, 0x4c, 0xb7, 0xf4, 0x44, 0xbb, 0xed,
+  0xe6, 0x63, 0x57, 0xb6, 0x57, 0x42, 0x25, 0x0a, 0x21, 0xb0, 0x91, 0x74,
+  0xef, 0x76, 0x2f, 0x06, 0xcd, 0x1f, 0xc8, 0xbd, 0x1d, 0x33, 0x04, 0xb0,
+  0xc2, 0x97, 0x1d, 0xcd, 0x3a, 0x02, 0x8f, 0xe6, 0x4c, 0xa9, 0x5b, 0x85,
+  0xc5, 0xce, 0x13, 0x51, 0x31, 0x70, 0x54, 0xe0, 0x12, 0x5d, 0xeb, 0xf3,
+  0x70, 0xa1, 0xe2, 0x0a, 0x98, 0x17, 0xfe, 0xb5, 0x1c, 0x9b, 0x61, 0x8a,
+  0x0d, 0x8f, 0x5b, 0x3e, 0x74, 0x3f, 0xe4, 0x39, 0xa0, 0xdc, 0x81, 0xe7,
+  0x38, 0xdc, 0x31, 0xab, 0x4a, 0xc0, 0xc5, 0xed, 0x70, 0x77, 0x6b, 0xe3,
+  0x9a, 0x54, 0x6b, 0x83, 0x36, 0xf8, 0x4f, 0x6d, 0x17, 0xc1, 0x81, 0xb8,
+  0x13, 0xd1, 0xe1, 0x12, 0xad, 0xe5, 0x5b, 0x7f, 0x92, 0xaf, 0xc2, 0x38,
+  0x0f, 0xb9, 0x26, 0xfe, 0x23, 0x94, 0x62, 0x55, 0xae, 0x35, 0x39, 0x0c,
+  0x65, 0x60, 0x56, 0xc8, 0x60, 0x80, 0x96, 0xcd, 0xc0, 0x34, 0xd4, 0xd7,
+  0xe9, 0x61, 0x56, 0x9c, 0x8c, 0x01, 0x0c, 0x0e, 0x7f, 0x1f, 0x53, 0xbd,
+  0x72, 0x28, 0xba, 0x9a, 0xa9, 0x3c, 0x46, 0xa2, 0xd8, 0x19, 0x54, 0xd7,
+  0x1c, 0x8f, 0x6a, 0x8d, 0x62, 0xfc, 0xc4, 0x17, 0x07, 0x72, 0xf3, 0xfe,
+  0xee, 0x6e, 0x5e, 0x0e, 0x78, 0xff, 0x95, 0xcb, 0x3f, 0xd7, 0x29, 0x25,
+  0x45, 0xa4, 0xb5, 0x41, 0xf1, 0xbe, 0x99, 0x80, 0x6c, 0x91, 0x41, 0x7c,
+  0xc2, 0xdd, 0xbd, 0xae, 0x9a, 0x05, 0x31, 0x09, 0x8d, 0x9b, 0xb7, 0xfb,
+  0x37, 0x34, 0x0e, 0x2f, 0xa3, 0x05, 0xb8, 0x1f, 0x7f, 0x2f, 0xd1, 0x14,
+  0x5c, 0x79, 0x6e, 0xdf, 0x56, 0x01, 0xf2, 0x94, 0xf3, 0x70, 0xe4, 0x24,
+  0x50, 0xc5, 0x31, 0xdb, 0x55, 0xa4, 0xa1, 0x43, 0xba, 0x17, 0x12, 0x82,
+  0x12, 0x7f, 0x92, 0x36, 0x83, 0xbe, 0x0d, 0x6d, 0x75, 0x2f, 0xbd, 0x81,
+  0x13, 0x34, 0xbc, 0xef, 0xae, 0x85, 0x78, 0x33, 0x40, 0x63, 0xff, 0xcc,
+  0x55, 0x47, 0x50, 0x4d, 0xd1, 0x6e, 0x59, 0x4c, 0xe0, 0xd0, 0xe6, 0x69,
+  0xe9, 0xf8, 0x7a, 0x66, 0xb9, 0xfe, 0x0c, 0xfb, 0xc7, 0xef, 0x8e, 0x74,
+  0x97, 0xbe, 0x9e, 0x12, 0xe2, 0x39, 0x16, 0x2f, 0x87, 0xcc, 0xd9, 0xe7,
+  0x73, 0x56, 0x29, 0x74, 0xf0, 0x44, 0x7e, 0x0b, 0x0b, 0xb3, 0xe0, 0x98,
+  0x1d, 0x1d, 0x2a, 0x5a, 0x9e, 0x89, 0xbb, 0xfd, 0x6a, 0x4d, 0xfc, 0xde,
+  0x53, 0x8e, 0x8c, 0x9d, 0x6c, 0xd9, 0xac, 0x7d, 0x1e, 0xe9, 0xfd, 0xdd,
+  0xa1, 0x8c, 0x4d, 0x2f, 0xbe, 0xc7, 0x4c, 0x2b, 0x3c, 0xda, 0x25, 0x11,
+  0x4f, 0xde, 0xb5, 0x44, 0x22, 0xc8, 0x3f, 0x70, 0x3b, 0x41, 0xeb, 0x30,
+  0xab, 0xe3, 0xea, 0xd6, 0x79, 0x7e, 0xa7, 0x16, 0x9d, 0x18, 0x70, 0x55,
+  0xe8, 0x52, 0xe9, 0xc9, 0x35, 0xb1, 0xfc, 0x21, 0xe2, 0x43, 0x5e, 0xa4,
+  0xb5, 0xcf, 0x41, 0x2d, 0x90, 0xf5, 0xa3, 0x8c, 0x7d, 0x39, 0x98, 0x61,
+  0x43, 0x75, 0x19, 0xa4, 0xa1, 0x3d, 0x30, 0x0a, 0xa3, 0x9c, 0x8e, 0xff,
+  0x38, 0x9c, 0xf5, 0x1c, 0x62, 0x79, 0xfc, 0x41, 0x6c, 0x2f, 0x6f, 0x43,
+  0xb3, 0x6a, 0xfd, 0x92, 0xc3, 0xe2, 0x37, 0x01, 0x92, 0xdf, 0x4e, 0x0b,
+  0xbb, 0xe6, 0xc3, 0xf9, 0xb2, 0xd4, 0xf9, 0x94, 0x72, 0x5a, 0xc7, 0x01,
+  0xbf, 0x28, 0x75, 0xe7, 0xc2, 0xc0, 0x48, 0x7e, 0xac, 0x9e, 0x53, 0x52,
+  0xaa, 0x95, 0x23, 0x03, 0xa8, 0xc3, 0x5d, 0xc8, 0x3b, 0x71, 0x5d, 0xec,
+  0x55, 0x66, 0x08, 0xe9, 0xb5, 0xe9, 0xf3, 0x56, 0x48, 0x6a, 0x29, 0xbf,
+  0x54, 0x98, 0xe5, 0xbe, 0x74, 0x46, 0xdc, 0xd7, 0x72, 0x7f, 0xec, 0xcc,
+  0x0c, 0x9d, 0x49, 0x1f, 0xe7, 0xeb, 0x5e, 0x23, 0xd0, 0x38, 0x35, 0x23,
+  0xb1, 0xb1, 0x55, 0xe0, 0xc0, 0xfe, 0x9e, 0x9e, 0xfa, 0xa3, 0xc9, 0x0b,
+  0xcb, 0x21, 0xb0, 0x74, 0x6b, 0xce, 0xe2, 0x9f, 0x52, 0x2e, 0x1a, 0xee,
+  0x2e, 0x05, 0x0d, 0x9e, 0x57, 0x0c, 0xd5, 0xf3, 0xdf, 0xb7, 0xce, 0x3e,
+  0x40, 0x12, 0x47, 0xb3, 0xfd, 0x6b, 0xa6, 0x34, 0xef, 0x22, 0x07, 0x00,
+  0x00, 0x00, 0x51, 0x00, 0xa6, 0x00, 0x00, 0x00, 0x51, 0x00, 0xa2, 0x00,
+  0xf7, 0x00, 0x4c, 0x01, 0x9f, 0x01, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x59, 0x00, 0x99, 0x00,
+  0xc7, 0x00, 0xe6, 0x00, 0x03, 0x01, 0x25, 0x01, 0x00, 0x00, 0x29, 0x00,
+  0x55, 0x00, 0x93, 0x00, 0xbf, 0x00, 0xdc, 0x00, 0xfb, 0x00, 0x2c, 0x01,
+  0x38, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x00,
+  0x57, 0x00, 0x87, 0x00, 0xc7, 0x00, 0xfb, 0x00, 0x14, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x21, 0x00, 0x53, 0x00, 0x7d, 0x00, 0xbb, 0x00, 0xed, 0x00,
+  0x08, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x35, 0x00, 0x61, 0x00, 0x87, 0x00, 0xbb, 0x00, 0xd6, 0x00, 0x0a, 0x01,
+  0x36, 0x01, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x37, 0x00, 0x61, 0x00,
+  0x85, 0x00, 0xb9, 0x00, 0xd2, 0x00, 0x04, 0x01, 0x2e, 0x01, 0x00, 0x00,
+  0x31, 0x00, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x53, 0x00,
+  0x00, 0x00, 0x22, 0x00, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+  0x2f, 0x00, 0x64, 0x00, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x00,
+  0x60, 0x00, 0x7f, 0x00, 0xb2, 0x00, 0xd6, 0x00, 0x00, 0x00, 0x1e, 0x00,
+  0x00, 0x00, 0x1e, 0x00, 0x4b, 0x00, 0x7d, 0x00, 0x00, 0x00, 0x40, 0x00,
+  0x00, 0x00, 0x30, 0x00, 0x4e, 0x00, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x3e, 0x00,
+  0x00, 0x00, 0x26, 0x00, 0x50, 0x00, 0x00, 0x00, 0x22, 0x00, 0x4b, 0x00,
+  0x00, 0x00, 0x40, 0x00, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00,
+  0x4d, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x20, 0x00, 0x46, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x24, 0x00,
+  0x4a, 0x00, 0x72, 0x00, 0x99, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00,
+  0x2c, 0x00, 0x55, 0x00, 0x7b, 0x00, 0x00, 0x00, 0x28, 0x00, 0x4e, 0x00,
+  0x00, 0x00, 0x28, 0x00, 0x52, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x53, 0x00,
+  0x00, 0x00, 0x26, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x4b, 0x00, 0x6f, 0x00, 0x00, 0x00,
+  0x2e, 0x00, 0x00, 0x00, 0x22, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x2b, 0x00, 0x54, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0x00,
+  0x00, 0x00, 0x19, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1e, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00,
+  0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x2c, 0x00, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x24, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x16, 0x00, 0x24, 0x00, 0x32, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00,
+  0x29, 0x00, 0x4d, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x33, 0x00, 0x42, 0x00,
+  0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x0d, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x24, 0x00,
+  0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x0d, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x29, 0x00, 0x3d, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x31, 0x00,
+  0x3e, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x32, 0x00, 0x00, 0x00, 0x0f, 0x00,
+  0x27, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00,
+  0x1d, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x00,
+  0x3c, 0x00, 0x00, 0x00, 0x28, 0x00, 0x43, 0x00, 0x00, 0x00, 0x1d, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00,
+  0x25, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x32, 0x00, 0x00, 0x00, 0x13, 0x00,
+  0x00, 0x00, 0x19, 0x00, 0x33, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x25, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x1f, 0x00,
+  0x33, 0x00, 0x00, 0x00, 0x15, 0x00, 0x29, 0x00, 0x00, 0x00, 0x0f, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x34, 0x00, 0x00, 0x00, 0x36, 0x00, 0x5e, 0x00, 0x70, 0x00, 0x00, 0x00,
+  0x33, 0x00, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x4c, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x12, 0x00,
+  0x00, 0x00, 0x26, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x15, 0x00, 0x3c, 0x00,
+  0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x10, 0x00, 0x1d, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x19, 0x00, 0x3e, 0x00, 0x59, 0x00, 0x86, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x40, 0x00, 0x59, 0x00, 0x80, 0x00, 0x00, 0x00, 0x1f, 0x00,
+  0x2f, 0x00, 0x51, 0x00, 0x79, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x38, 0x00,
+  0x56, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x34, 0x00, 0x44, 0x00, 0x66, 0x00,
+  0x9b, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x2d, 0x00, 0x4c, 0x00, 0x71, 0x00,
+  0x00, 0x00, 0x26, 0x00, 0x3d, 0x00, 0x54, 0x00, 0x81, 0x00, 0xbc, 0x00,
+  0x00, 0x00, 0x1d, 0x00, 0x38, 0x00, 0x4e, 0x00, 0x65, 0x00, 0x00, 0x00,
+  0x18, 0x00, 0x28, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x35, 0x00, 0x00, 0x00,
+  0x1b, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x29, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x17, 0x00, 0x33, 0x00, 0x73, 0x00,
+  0x9d, 0x00, 0x00, 0x00, 0x22, 0x00, 0x38, 0x00, 0x00, 0x00, 0x22, 0x00,
+  0x32, 0x00, 0x6a, 0x00, 0x00, 0x00, 0x19, 0x00, 0x27, 0x00, 0x42, 0x00,
+  0x72, 0x00, 0x00, 0x00, 0x17, 0x00, 0x3b, 0x00, 0x58, 0x00, 0x84, 0x00,
+  0x00, 0x00, 0x45, 0x00, 0x55, 0x00, 0x65, 0x00, 0x83, 0x00, 0x99, 0x00,
+  0x00, 0x00, 0x45, 0x00, 0x55, 0x00, 0x71, 0x00, 0x92, 0x00, 0xa2, 0x00,
+  0x00, 0x00, 0x1b, 0x00, 0x29, 0x00, 0x42, 0x00, 0x5b, 0x00, 0x6d, 0x00,
+  0x00, 0x00, 0x2a, 0x00, 0x38, 0x00, 0x4e, 0x00, 0x76, 0x00, 0x94, 0x00,
+  0x00, 0x00, 0x1c, 0x00, 0x2a, 0x00, 0x42, 0x00, 0x54, 0x00, 0x00, 0x00,
+  0x1b, 0x00, 0x2b, 0x00, 0x4a, 0x00, 0x5e, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x29, 0x00, 0x46, 0x00, 0x56, 0x00, 0x7b, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x23, 0x00, 0x40, 0x00, 0x50, 0x00, 0x00, 0x00, 0x12, 0x00, 0x29, 0x00,
+  0x3b, 0x00, 0x57, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x25, 0x00,
+  0x40, 0x00, 0x52, 0x00, 0x6f, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x6b, 0x00,
+  0x8a, 0x00, 0xa7, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x5e, 0x00, 0x7b, 0x00,
+  0x8b, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x33, 0x00, 0x4e, 0x00, 0x6b, 0x00,
+  0xa5, 0x00, 0x00, 0x00, 0x10, 0x00, 0x2b, 0x00, 0x48, 0x00, 0x64, 0x00,
+  0x00, 0x00, 0x17, 0x00, 0x2b, 0x00, 0x49, 0x00, 0x5b, 0x00, 0x78, 0x00,
+  0x93, 0x00, 0xa8, 0x00, 0xc4, 0x00, 0x00, 0x00, 0x17, 0x00, 0x32, 0x00,
+  0x42, 0x00, 0x52, 0x00, 0x64, 0x00, 0x7b, 0x00, 0xa5, 0x00, 0x00, 0x00,
+  0x38, 0x00, 0x57, 0x00, 0x7f, 0x00, 0xa0, 0x00, 0xc1, 0x00, 0xec, 0x00,
+  0x07, 0x01, 0x19, 0x01, 0x2b, 0x01, 0x3b, 0x01, 0x4b, 0x01, 0x6d, 0x01,
+  0x8f, 0x01, 0x00, 0x00, 0x1f, 0x00, 0x45, 0x00, 0x55, 0x00, 0x61, 0x00,
+  0x7f, 0x00, 0x98, 0x00, 0xb9, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x5b, 0x00,
+  0x85, 0x00, 0xa8, 0x00, 0xcb, 0x00, 0xf8, 0x00, 0x21, 0x01, 0x43, 0x01,
+  0x5f, 0x01, 0x6f, 0x01, 0xa0, 0x01, 0xb4, 0x01, 0xe1, 0x01, 0x00, 0x00,
+  0x29, 0x00, 0x46, 0x00, 0x72, 0x00, 0x94, 0x00, 0xa9, 0x00, 0xc4, 0x00,
+  0xd9, 0x00, 0xf5, 0x00, 0x00, 0x00, 0x20, 0x00, 0x30, 0x00, 0x4a, 0x00,
+  0x5a, 0x00, 0x71, 0x00, 0x8d, 0x00, 0xb4, 0x00, 0x00, 0x00, 0x2b, 0x00,
+  0x52, 0x00, 0x6b, 0x00, 0x8b, 0x00, 0x99, 0x00, 0xad, 0x00, 0xca, 0x00,
+  0xf6, 0x00, 0x00, 0x00, 0x24, 0x00, 0x42, 0x00, 0x54, 0x00, 0x74, 0x00,
+  0x93, 0x00, 0xb1, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x2e, 0x00, 0x3e, 0x00,
+  0x64, 0x00, 0x81, 0x00, 0x9c, 0x00, 0x00, 0x00, 0x16, 0x00, 0x2b, 0x00,
+  0x39, 0x00, 0x47, 0x00, 0x5e, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x29, 0x00,
+  0x37, 0x00, 0x5b, 0x00, 0x8b, 0x00, 0xa7, 0x00, 0x00, 0x00, 0x28, 0x00,
+  0x38, 0x00, 0x4a, 0x00, 0x5a, 0x00, 0x71, 0x00, 0x7f, 0x00, 0x00, 0x00,
+  0x1d, 0x00, 0x2b, 0x00, 0x3d, 0x00, 0x65, 0x00, 0x80, 0x00, 0xa0, 0x00,
+  0x00, 0x00, 0x29, 0x00, 0x39, 0x00, 0x49, 0x00, 0x62, 0x00, 0x7e, 0x00,
+  0x00, 0x00, 0x16, 0x00, 0x29, 0x00, 0x39, 0x00, 0x4d, 0x00, 0x7e, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x41, 0x00, 0x55, 0x00, 0x65, 0x00, 0x75, 0x00,
+  0x83, 0x00, 0x95, 0x00, 0x00, 0x00, 0x10, 0x00, 0x3d, 0x00, 0x59, 0x00,
+  0x72, 0x00, 0xa0, 0x00, 0xcd, 0x00, 0xe6, 0x00, 0x00, 0x00, 0x1e, 0x00,
+  0x37, 0x00, 0x4b, 0x00, 0x5d, 0x00, 0x7a, 0x00, 0x90, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x32, 0x00, 0x4f, 0x00, 0x6b, 0x00, 0x7b, 0x00, 0x8d, 0x00,
+  0xa7, 0x00, 0x00, 0x00, 0x14, 0x00, 0x3b, 0x00, 0x61, 0x00, 0x7a, 0x00,
+  0x97, 0x00, 0xa5, 0x00, 0xc7, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x3a, 0x00,
+  0x51, 0x00, 0x83, 0x00, 0x99, 0x00, 0xb0, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x44, 0x00, 0x58, 0x00, 0x6b, 0x00, 0x92, 0x00, 0xb7, 0x00, 0xdb, 0x00,
+  0x00, 0x00, 0x14, 0x00, 0x37, 0x00, 0x47, 0x00, 0x5e, 0x00, 0x8b, 0x00,
+  0xc2, 0x00, 0xd7, 0x00, 0x00, 0x00, 0x10, 0x00, 0x20, 0x00, 0x3c, 0x00,
+  0x61, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x13, 0x00, 0x2f, 0x00, 0x4d, 0x00,
+  0x61, 0x00, 0x7a, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x21, 0x00, 0x41, 0x00,
+  0x68, 0x00, 0x78, 0x00, 0x86, 0x00, 0xb2, 0x00, 0x00, 0x00, 0x25, 0x00,
+  0x35, 0x00, 0x55, 0x00, 0x67, 0x00, 0x83, 0x00, 0x00, 0x00, 0x19, 0x00,
+  0x32, 0x00, 0x44, 0x00, 0x5d, 0x00, 0x78, 0x00, 0x00, 0x00, 0x19, 0x00,
+  0x27, 0x00, 0x39, 0x00, 0x47, 0x00, 0x55, 0x00, 0x6a, 0x00, 0x85, 0x00,
+  0x00, 0x00, 0x33, 0x00, 0x4d, 0x00, 0x74, 0x00, 0x88, 0x00, 0xa3, 0x00,
+  0xbd, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x46, 0x00, 0x56, 0x00, 0x81, 0x00,
+  0x9b, 0x00, 0xae, 0x00, 0xcd, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x3c, 0x00,
+  0x51, 0x00, 0x9b, 0x00, 0xbb, 0x00, 0xcb, 0x00, 0x00, 0x00, 0x13, 0x00,
+  0x23, 0x00, 0x6d, 0x00, 0x79, 0x00, 0x87, 0x00, 0x00, 0x00, 0x27, 0x00,
+  0x48, 0x00, 0x7c, 0x00, 0x9d, 0x00, 0xcd, 0x00, 0x05, 0x01, 0x33, 0x01,
+  0x5b, 0x01, 0x8e, 0x01, 0xa1, 0x01, 0xbf, 0x01, 0xdc, 0x01, 0x06, 0x02,
+  0x1a, 0x02, 0x00, 0x00, 0x14, 0x00, 0x24, 0x00, 0x44, 0x00, 0x62, 0x00,
+  0x76, 0x00, 0x00, 0x00, 0x29, 0x00, 0x4c, 0x00, 0x82, 0x00, 0xa5, 0x00,
+  0xd7, 0x00, 0x0d, 0x01, 0x3d, 0x01, 0x67, 0x01, 0x98, 0x01, 0xb2, 0x01,
+  0xc7, 0x01, 0xe0, 0x01, 0xfe, 0x01, 0x26, 0x02, 0x00, 0x00, 0x34, 0x00,
+  0x4e, 0x00, 0x5c, 0x00, 0x79, 0x00, 0x89, 0x00, 0xb6, 0x00, 0x00, 0x00,
+  0x1a, 0x00, 0x2c, 0x00, 0x71, 0x00, 0x86, 0x00, 0x9d, 0x00, 0x00, 0x00,
+  0x1a, 0x00, 0x3c, 0x00, 0x81, 0x00, 0x95, 0x00, 0xb2, 0x00, 0x00, 0x00,
+  0x35, 0x00, 0x4b, 0x00, 0x74, 0x00, 0x93, 0x00, 0xa8, 0x00, 0xd5, 0x00,
+  0xe1, 0x00, 0x00, 0x00, 0x24, 0x00, 0x36, 0x00, 0x48, 0x00, 0x5d, 0x00,
+  0x72, 0x00, 0x9b, 0x00, 0xbe, 0x00, 0x00, 0x00, 0x12, 0x00, 0x3b, 0x00,
+  0x54, 0x00, 0x74, 0x00, 0xa4, 0x00, 0xb4, 0x00, 0x00, 0x00, 0x15, 0x00,
+  0x42, 0x00, 0x6a, 0x00, 0x7f, 0x00, 0xb7, 0x00, 0xd0, 0x00, 0xfa, 0x00,
+  0x00, 0x00, 0x15, 0x00, 0x57, 0x00, 0x69, 0x00, 0x86, 0x00, 0x9d, 0x00,
+  0xb8, 0x00, 0x00, 0x00, 0x12, 0x00, 0x2e, 0x00, 0x41, 0x00, 0x5d, 0x00,
+  0x82, 0x00, 0x9f, 0x00, 0x00, 0x00, 0x25, 0x00, 0x37, 0x00, 0x4e, 0x00,
+  0x6e, 0x00, 0x89, 0x00, 0xa6, 0x00, 0xb8, 0x00, 0x00, 0x00, 0x15, 0x00,
+  0x57, 0x00, 0x72, 0x00, 0x91, 0x00, 0xac, 0x00, 0xc9, 0x00, 0x00, 0x00,
+  0x23, 0x00, 0x63, 0x00, 0x82, 0x00, 0x94, 0x00, 0x00, 0x00, 0x41, 0x00,
+  0x73, 0x00, 0x8c, 0x00, 0xa2, 0x00, 0x00, 0x00, 0x39, 0x00, 0x76, 0x00,
+  0xa3, 0x00, 0xc2, 0x00, 0x00, 0x00, 0x39, 0x00, 0x5e, 0x00, 0x93, 0x00,
+  0xbe, 0x00, 0xe4, 0x00, 0x00, 0x00, 0x19, 0x00, 0x5a, 0x00, 0x6f, 0x00,
+  0x7f, 0x00, 0x8f, 0x00, 0x00, 0x00, 0x28, 0x00, 0x6a, 0x00, 0x89, 0x00,
+  0xa2, 0x00, 0xbd, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x54, 0x00, 0x6f, 0x00,
+  0x86, 0x00, 0x94, 0x00, 0xb3, 0x00, 0x00, 0x00, 0x20, 0x00, 0x3e, 0x00,
+  0x80, 0x00, 0x8e, 0x00, 0xb2, 0x00, 0xcd, 0x00, 0x00, 0x00, 0x19, 0x00,
+  0x3e, 0x00, 0x5d, 0x00, 0x69, 0x00, 0x7d, 0x00, 0x9d, 0x00, 0xb7, 0x00,
+  0x00, 0x00, 0x2e, 0x00, 0x52, 0x00, 0x60, 0x00, 0x6c, 0x00, 0x8e, 0x00,
+  0xbc, 0x00, 0xe5, 0x00, 0x00, 0x00, 0x20, 0x00, 0x40, 0x00, 0x53, 0x00,
+  0x75, 0x00, 0x92, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x23, 0x00, 0x3d, 0x00,
+  0x56, 0x00, 0x68, 0x00, 0x83, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x36, 0x00,
+  0x4d, 0x00, 0x61, 0x00, 0x76, 0x00, 0x00, 0x00, 0x32, 0x00, 0x3f, 0x00,
+  0x6e, 0x00, 0x8b, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x30, 0x00, 0x44, 0x00,
+  0x67, 0x00, 0x80, 0x00, 0xa2, 0x00, 0xc6, 0x00, 0x00, 0x00, 0x2b, 0x00,
+  0x42, 0x00, 0x4e, 0x00, 0x65, 0x00, 0x89, 0x00, 0xb3, 0x00, 0xd2, 0x00,
+  0x00, 0x00, 0x1a, 0x00, 0x33, 0x00, 0x63, 0x00, 0x00, 0x00, 0x1c, 0x00,
+  0x37, 0x00, 0x50, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x4a, 0x00, 0x65, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x38, 0x00, 0x70, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x24, 0x00, 0x46, 0x00, 0x78, 0x00, 0x00, 0x00, 0x2f, 0x00,
+  0x46, 0x00, 0x63, 0x00, 0x00, 0x00, 0x24, 0x00, 0x44, 0x00, 0x61, 0x00,
+  0x86, 0x00, 0xa1, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x45, 0x00, 0x62, 0x00,
+  0x77, 0x00, 0x94, 0x00, 0x00, 0x00, 0x12, 0x00, 0x41, 0x00, 0x64, 0x00,
+  0x76, 0x00, 0x86, 0x00, 0x00, 0x00, 0x23, 0x00, 0x5b, 0x00, 0x77, 0x00,
+  0x00, 0x00, 0x22, 0x00, 0x35, 0x00, 0x45, 0x00, 0x5d, 0x00, 0x00, 0x00,
+  0x1b, 0x00, 0x50, 0x00, 0x73, 0x00, 0x85, 0x00, 0x00, 0x00, 0x1d, 0x00,
+  0x33, 0x00, 0x6a, 0x00, 0x00, 0x00, 0x44, 0x00, 0x60, 0x00, 0x7c, 0x00,
+  0x00, 0x00, 0x1b, 0x00, 0x5e, 0x00, 0x70, 0x00, 0x8b, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x3e, 0x00, 0x56, 0x00, 0x75, 0x00, 0x00, 0x00, 0x19, 0x00,
+  0x29, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x39, 0x00, 0x57, 0x00, 0x00, 0x00,
+  0x27, 0x00, 0x41, 0x00, 0x6b, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x3f, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x4d, 0x00,
+  0x00, 0x00, 0x36, 0x00, 0x48, 0x00, 0x78, 0x00, 0x9a, 0x00, 0x00, 0x00,
+  0x38, 0x00, 0x5c, 0x00, 0x8c, 0x00, 0xa7, 0x00, 0x00, 0x00, 0x17, 0x00,
+  0x39, 0x00, 0x62, 0x00, 0x98, 0x00, 0x00, 0x00, 0x24, 0x00, 0x34, 0x00,
+  0x72, 0x00, 0xa8, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x32, 0x00, 0x7e, 0x00,
+  0xa0, 0x00, 0x00, 0x00, 0x20, 0x00, 0x3e, 0x00, 0x61, 0x00, 0x8e, 0x00,
+  0xa0, 0x00, 0xc6, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x37, 0x00, 0x00, 0x00,
+  0x17, 0x00, 0x34, 0x00, 0x00, 0x00, 0x17, 0x00, 0x53, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x43, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x5f, 0x00, 0x83, 0x00,
+  0x00, 0x00, 0x19, 0x00, 0x3b, 0x00, 0x4a, 0x00, 0x59, 0x00, 0x00, 0x00,
+  0x24, 0x00, 0x44, 0x00, 0x00, 0x00, 0x20, 0x00, 0x4d, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00,
+  0x27, 0x00, 0x49, 0x00, 0x00, 0x00, 0x14, 0x00, 0x26, 0x00, 0x00, 0x00,
+  0x1a, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x40, 0x00, 0x5b, 0x00,
+  0x00, 0x00, 0x19, 0x00, 0x32, 0x00, 0x4b, 0x00, 0x64, 0x00, 0x7d, 0x00,
+  0x96, 0x00, 0xaf, 0x00, 0xc8, 0x00, 0xe1, 0x00, 0xff, 0x00, 0x1a, 0x01,
+  0x31, 0x01, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00,
+  0x22, 0x00, 0x38, 0x00, 0x00, 0x00, 0x20, 0x00, 0x34, 0x00, 0x69, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x1b, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x2a, 0x00,
+  0x00, 0x00, 0x24, 0x00, 0x39, 0x00, 0x8c, 0x00, 0x00, 0x00, 0x14, 0x00,
+  0x45, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x18, 0x00, 0x41, 0x00,
+  0xa0, 0x00, 0x00, 0x00, 0x10, 0x00, 0x3b, 0x00, 0x68, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x49, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x46, 0x00, 0x74, 0x00,
+  0x7c, 0x00, 0x00, 0x00, 0x19, 0x00, 0x2b, 0x00, 0x6c, 0x00, 0x76, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x18, 0x00, 0x00, 0x00, 0x20, 0x00, 0x2c, 0x00, 0x00, 0x00,
+  0x1e, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x4f, 0x00, 0x00, 0x00, 0x20, 0x00,
+  0x00, 0x00, 0x20, 0x00, 0x39, 0x00, 0x52, 0x00, 0x6b, 0x00, 0x89, 0x00,
+  0x96, 0x00, 0x00, 0x00, 0x12, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1e, 0x00,
+  0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x24, 0x00, 0x5a, 0x00, 0x77, 0x00, 0x00, 0x00, 0x2a, 0x00,
+  0x4a, 0x00, 0x00, 0x00, 0x26, 0x00, 0x5c, 0x00, 0x81, 0x00, 0x00, 0x00,
+  0x2a, 0x00, 0x4e, 0x00, 0x5e, 0x00, 0x00, 0x00, 0x29, 0x00, 0x50, 0x00,
+  0x69, 0x00, 0x00, 0x00, 0x22, 0x00, 0x4a, 0x00, 0x77, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x4c, 0x00, 0x53, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x3f, 0x00, 0x63, 0x00, 0x71, 0x00, 0x7e, 0x00, 0x85, 0x00, 0x00, 0x00,
+  0x1e, 0x00, 0x4b, 0x00, 0x6d, 0x00, 0x7d, 0x00, 0x99, 0x00, 0xb6, 0x00,
+  0xc6, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x6a, 0x00, 0x90, 0x00, 0xa0, 0x00,
+  0xb0, 0x00, 0xdd, 0x00, 0x00, 0x00, 0x26, 0x00, 0x4c, 0x00, 0x6b, 0x00,
+  0x7b, 0x00, 0xa7, 0x00, 0x00, 0x00, 0x12, 0x00, 0x20, 0x00, 0x4c, 0x00,
+  0x5f, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x4b, 0x00, 0x5d, 0x00, 0x85, 0x00,
+  0x00, 0x00, 0x20, 0x00, 0x2e, 0x00, 0x40, 0x00, 0x5b, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x27, 0x00, 0x51, 0x00, 0x00, 0x00, 0x31, 0x00, 0x41, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x3f, 0x00, 0x00, 0x00,
+  0x30, 0x00, 0x47, 0x00, 0x61, 0x00, 0x69, 0x00, 0x00, 0x00, 0x19, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x24, 0x00, 0x3f, 0x00, 0x52, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x10, 0x00, 0x22, 0x00,
+  0x42, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x22, 0x00, 0x30, 0x00, 0x40, 0x00,
+  0x54, 0x00, 0x00, 0x00, 0x14, 0x00, 0x28, 0x00, 0x42, 0x00, 0x64, 0x00,
+  0x6b, 0x00, 0x00, 0x00, 0x20, 0x00, 0x47, 0x00, 0x5b, 0x00, 0x6f, 0x00,
+  0xa4, 0x00, 0x00, 0x00, 0x26, 0x00, 0x38, 0x00, 0x4a, 0x00, 0x6a, 0x00,
+  0x00, 0x00, 0x26, 0x00, 0x55, 0x00, 0x61, 0x00, 0x79, 0x00, 0x00, 0x00,
+  0x24, 0x00, 0x46, 0x00, 0x72, 0x00, 0x82, 0x00, 0x94, 0x00, 0x00, 0x00,
+  0x26, 0x00, 0x4a, 0x00, 0x79, 0x00, 0xae, 0x00, 0xc5, 0x00, 0xd5, 0x00,
+  0xff, 0x00, 0x00, 0x00, 0x33, 0x00, 0x6b, 0x00, 0x8e, 0x00, 0x9e, 0x00,
+  0xbc, 0x00, 0x00, 0x00, 0x28, 0x00, 0x4c, 0x00, 0x6e, 0x00, 0x7c, 0x00,
+  0x9b, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x24, 0x00, 0x54, 0x00, 0x64, 0x00,
+  0x74, 0x00, 0xa2, 0x00, 0xc9, 0x00, 0x00, 0x00, 0x22, 0x00, 0x4b, 0x00,
+  0x72, 0x00, 0x82, 0x00, 0xa1, 0x00, 0xbd, 0x00, 0x00, 0x00, 0x2b, 0x00,
+  0x53, 0x00, 0x75, 0x00, 0x9e, 0x00, 0xb9, 0x00, 0xcb, 0x00, 0xdb, 0x00,
+  0x00, 0x00, 0x3f, 0x00, 0x5f, 0x00, 0x96, 0x00, 0xc0, 0x00, 0xd0, 0x00,
+  0xe7, 0x00, 0x0b, 0x01, 0x00, 0x00, 0x24, 0x00, 0x4c, 0x00, 0x77, 0x00,
+  0x97, 0x00, 0xab, 0x00, 0xbd, 0x00, 0x00, 0x00, 0x26, 0x00, 0x5d, 0x00,
+  0x83, 0x00, 0xa9, 0x00, 0xb7, 0x00, 0xd5, 0x00, 0x05, 0x01, 0x00, 0x00,
+  0x2f, 0x00, 0x53, 0x00, 0x71, 0x00, 0x8f, 0x00, 0xa1, 0x00, 0x00, 0x00,
+  0x37, 0x00, 0x5b, 0x00, 0x83, 0x00, 0xa7, 0x00, 0x00, 0x00, 0x29, 0x00,
+  0x47, 0x00, 0x00, 0x00, 0x29, 0x00, 0x4f, 0x00, 0x74, 0x00, 0x93, 0x00,
+  0xad, 0x00, 0x00, 0x00, 0x28, 0x00, 0x4e, 0x00, 0x7a, 0x00, 0x9b, 0x00,
+  0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x22, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x55, 0x00, 0x77, 0x00,
+  0x00, 0x00, 0x20, 0x00, 0x40, 0x00, 0x64, 0x00, 0x7d, 0x00, 0x00, 0x00,
+  0x43, 0x00, 0x6a, 0x00, 0x99, 0x00, 0xa9, 0x00, 0x00, 0x00, 0x26, 0x00,
+  0x4c, 0x00, 0x00, 0x00, 0x20, 0x00, 0x44, 0x00, 0x82, 0x00, 0x94, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x1e, 0x00,
+  0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x44, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x2d, 0x00,
+  0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00, 0x22, 0x00,
+  0x00, 0x00, 0x20, 0x00, 0x47, 0x00, 0x6d, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x22, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00,
+  0x00, 0x00, 0x22, 0x00, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00,
+  0x53, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x2b, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x82, 0x00, 0xc4, 0x00,
+  0x00, 0x00, 0x40, 0x00, 0x80, 0x00, 0xc2, 0x00, 0x04, 0x01, 0x46, 0x01,
+  0x86, 0x01
+};
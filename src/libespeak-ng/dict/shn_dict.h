@@ -1,5 +1,7 @@
 #pragma once
-const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
+#include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/shn_dict_index.h>
+const unsigned char __espeakng_dict_shn[] __attribute__((aligned((4)))) = {
   0x00, 0x04, 0x00, 0x00, 0x76, 0x4d, 0x01, 0x00, 0x11, 0x0c, 0xe1, 0x80,
   0xa2, 0xe1, 0x80, 0xb1, 0xe1, 0x82, 0x83, 0xe1, 0x82, 0x87, 0x78, 0x6c,
   0x00, 0x12, 0x0c, 0xe1, 0x80, 0x9a, 0xe1, 0x80, 0xb1, 0xe1, 0x82, 0x83,
@@ -7349,4 +7351,11 @@ const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
   0x23, 0x24, 0x00, 0x07, 0x06, 0x00, 0xe1, 0x81, 0x8b, 0x03, 0x09, 0x00,
   0xe1, 0x81, 0x8a, 0x03, 0x0a, 0x00, 0x07, 0x00
 };
-size_t __espeakng_dictlen = 88172;
+
+BackgroundAudioDictionary dict_shn = {
+    "shn",
+    88172,
+    __espeakng_dict_shn,
+    14594,
+    __espeakng_dictindex_shn
+};
@@ -0,0 +1,1220 @@
+#pragma once
+const unsigned char __espeakng_dictindex_shn[] __attribute__((aligned((4)))) = {
+  0x45, 0x44, 0x58, 0x31, 0x6c, 0x58, 0x01, 0x00, 0x76, 0x4d, 0x01, 0x00,
+  0x4f, 0x10, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x07, 0x00, 0x0a, 0x00,
+  0x0d, 0x00, 0x10, 0x00, 0x10, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+  0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+  0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+  0x17, 0x00, 0x1d, 0x00, 0x20, 0x00, 0x24, 0x00, 0x29, 0x00, 0x29, 0x00,
+  0x29, 0x00, 0x29, 0x00, 0x29, 0x00, 0x29, 0x00, 0x29, 0x00, 0x29, 0x00,
+  0x29, 0x00, 0x29, 0x00, 0x29, 0x00, 0x29, 0x00, 0x2c, 0x00, 0x2c, 0x00,
+  0x2c, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00,
+  0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00,
+  0x2d, 0x00, 0x2d, 0x00, 0x33, 0x00, 0x33, 0x00, 0x33, 0x00, 0x3a, 0x00,
+  0x3a, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x3b, 0x00,
+  0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00,
+  0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00,
+  0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00,
+  0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00,
+  0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00,
+  0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00,
+  0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00,
+  0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00,
+  0x3b, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00,
+  0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00,
+  0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00,
+  0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00,
+  0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00,
+  0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00,
+  0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00,
+  0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00,
+  0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00,
+  0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00,
+  0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00,
+  0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00,
+  0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00,
+  0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00,
+  0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x41, 0x00, 0x41, 0x00, 0x41, 0x00,
+  0x41, 0x00, 0x41, 0x00, 0x41, 0x00, 0x41, 0x00, 0x41, 0x00, 0x41, 0x00,
+  0x41, 0x00, 0x41, 0x00, 0x42, 0x00, 0x43, 0x00, 0x43, 0x00, 0x6a, 0x00,
+  0x99, 0x00, 0xb4, 0x00, 0xa6, 0x01, 0x75, 0x02, 0xdd, 0x02, 0x11, 0x03,
+  0x31, 0x03, 0x4a, 0x03, 0x4c, 0x03, 0x4c, 0x03, 0x54, 0x03, 0x5a, 0x03,
+  0x5d, 0x03, 0x62, 0x03, 0x85, 0x03, 0x8a, 0x03, 0x8c, 0x03, 0x92, 0x04,
+  0xaa, 0x04, 0xbd, 0x04, 0xf5, 0x04, 0xf5, 0x04, 0xf7, 0x04, 0xf7, 0x04,
+  0xf7, 0x04, 0xf7, 0x04, 0xf7, 0x04, 0xf7, 0x04, 0xf8, 0x04, 0xf9, 0x04,
+  0xfa, 0x04, 0x0f, 0x05, 0x29, 0x05, 0x38, 0x05, 0xd5, 0x05, 0x4a, 0x06,
+  0x84, 0x06, 0xa8, 0x06, 0xc8, 0x06, 0xde, 0x06, 0xe1, 0x06, 0xe1, 0x06,
+  0xe1, 0x06, 0xf1, 0x06, 0xf7, 0x06, 0xfe, 0x06, 0x23, 0x07, 0x26, 0x07,
+  0x34, 0x07, 0xe5, 0x07, 0xfd, 0x07, 0x12, 0x08, 0x28, 0x08, 0x39, 0x08,
+  0x3a, 0x08, 0x3b, 0x08, 0x49, 0x08, 0x4a, 0x08, 0x4b, 0x08, 0x4b, 0x08,
+  0x54, 0x08, 0x5b, 0x08, 0x5c, 0x08, 0x6c, 0x08, 0xaf, 0x08, 0xb5, 0x08,
+  0xc8, 0x08, 0xf1, 0x09, 0xf2, 0x09, 0xf7, 0x09, 0x6c, 0x0a, 0x6c, 0x0a,
+  0x6c, 0x0a, 0x6c, 0x0a, 0x6c, 0x0a, 0x6c, 0x0a, 0x6d, 0x0a, 0x73, 0x0a,
+  0x73, 0x0a, 0x73, 0x0a, 0x7e, 0x0a, 0x8a, 0x0a, 0x8e, 0x0a, 0xb8, 0x0a,
+  0xb8, 0x0a, 0xb8, 0x0a, 0xec, 0x0a, 0xec, 0x0a, 0xec, 0x0a, 0xec, 0x0a,
+  0xec, 0x0a, 0xec, 0x0a, 0xec, 0x0a, 0xf3, 0x0a, 0xf4, 0x0a, 0xf5, 0x0a,
+  0x1e, 0x0b, 0x20, 0x0b, 0x2b, 0x0b, 0xdd, 0x0b, 0xdd, 0x0b, 0xde, 0x0b,
+  0x25, 0x0c, 0x25, 0x0c, 0x25, 0x0c, 0x3e, 0x0c, 0x3e, 0x0c, 0x3e, 0x0c,
+  0x3e, 0x0c, 0x43, 0x0c, 0x43, 0x0c, 0x43, 0x0c, 0x45, 0x0c, 0x45, 0x0c,
+  0x48, 0x0c, 0x5c, 0x0c, 0x5c, 0x0c, 0x5c, 0x0c, 0x72, 0x0c, 0x72, 0x0c,
+  0x72, 0x0c, 0x79, 0x0c, 0x79, 0x0c, 0x79, 0x0c, 0x79, 0x0c, 0x79, 0x0c,
+  0x79, 0x0c, 0x79, 0x0c, 0x79, 0x0c, 0x79, 0x0c, 0x79, 0x0c, 0x79, 0x0c,
+  0x79, 0x0c, 0x79, 0x0c, 0x79, 0x0c, 0x79, 0x0c, 0x79, 0x0c, 0x79, 0x0c,
+  0x79, 0x0c, 0x79, 0x0c, 0x79, 0x0c, 0x79, 0x0c, 0x7a, 0x0c, 0x7a, 0x0c,
+  0x7a, 0x0c, 0x7a, 0x0c, 0x7a, 0x0c, 0x7a, 0x0c, 0x7a, 0x0c, 0x7a, 0x0c,
+  0x7a, 0x0c, 0x7a, 0x0c, 0x7a, 0x0c, 0x7a, 0x0c, 0x7a, 0x0c, 0x7a, 0x0c,
+  0x7b, 0x0c, 0x7b, 0x0c, 0x7b, 0x0c, 0x7b, 0x0c, 0x7b, 0x0c, 0x7b, 0x0c,
+  0x7b, 0x0c, 0x7b, 0x0c, 0x7b, 0x0c, 0x7b, 0x0c, 0x7b, 0x0c, 0x7b, 0x0c,
+  0x7b, 0x0c, 0x7b, 0x0c, 0x7b, 0x0c, 0x7b, 0x0c, 0x7b, 0x0c, 0x7b, 0x0c,
+  0x7b, 0x0c, 0x7c, 0x0c, 0x7c, 0x0c, 0x7c, 0x0c, 0x7c, 0x0c, 0x7c, 0x0c,
+  0x7c, 0x0c, 0x7c, 0x0c, 0x7c, 0x0c, 0x7c, 0x0c, 0x7c, 0x0c, 0x7c, 0x0c,
+  0x7c, 0x0c, 0x7c, 0x0c, 0x7c, 0x0c, 0x7c, 0x0c, 0x7c, 0x0c, 0x7c, 0x0c,
+  0x7c, 0x0c, 0x7c, 0x0c, 0x7c, 0x0c, 0x7c, 0x0c, 0x7c, 0x0c, 0x7c, 0x0c,
+  0x7d, 0x0c, 0x7d, 0x0c, 0x7d, 0x0c, 0x7d, 0x0c, 0x7d, 0x0c, 0x7d, 0x0c,
+  0x7d, 0x0c, 0x7d, 0x0c, 0x7d, 0x0c, 0x7e, 0x0c, 0x7e, 0x0c, 0x7e, 0x0c,
+  0x7e, 0x0c, 0x7e, 0x0c, 0x7e, 0x0c, 0x7e, 0x0c, 0x7e, 0x0c, 0x7e, 0x0c,
+  0x7e, 0x0c, 0x7e, 0x0c, 0x7e, 0x0c, 0x7e, 0x0c, 0x7e, 0x0c, 0x7e, 0x0c,
+  0x7e, 0x0c, 0x7f, 0x0c, 0x7f, 0x0c, 0x7f, 0x0c, 0x7f, 0x0c, 0x7f, 0x0c,
+  0x7f, 0x0c, 0x7f, 0x0c, 0x7f, 0x0c, 0x80, 0x0c, 0x80, 0x0c, 0x80, 0x0c,
+  0x80, 0x0c, 0x80, 0x0c, 0x80, 0x0c, 0x80, 0x0c, 0x80, 0x0c, 0x80, 0x0c,
+  0x80, 0x0c, 0x80, 0x0c, 0x80, 0x0c, 0x80, 0x0c, 0x80, 0x0c, 0x80, 0x0c,
+  0x80, 0x0c, 0x81, 0x0c, 0x81, 0x0c, 0x82, 0x0c, 0x82, 0x0c, 0x83, 0x0c,
+  0x83, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x85, 0x0c, 0x8b, 0x0c, 0x90, 0x0c,
+  0x90, 0x0c, 0x90, 0x0c, 0x90, 0x0c, 0x90, 0x0c, 0x95, 0x0c, 0x96, 0x0c,
+  0x96, 0x0c, 0x97, 0x0c, 0x97, 0x0c, 0x98, 0x0c, 0x98, 0x0c, 0x99, 0x0c,
+  0x99, 0x0c, 0x9b, 0x0c, 0x9b, 0x0c, 0x9b, 0x0c, 0x9b, 0x0c, 0x9b, 0x0c,
+  0x9b, 0x0c, 0x9b, 0x0c, 0x9b, 0x0c, 0x9c, 0x0c, 0x9c, 0x0c, 0x9c, 0x0c,
+  0x9c, 0x0c, 0x9c, 0x0c, 0x9d, 0x0c, 0x9d, 0x0c, 0x9d, 0x0c, 0x9e, 0x0c,
+  0x9e, 0x0c, 0x9e, 0x0c, 0x9e, 0x0c, 0x9e, 0x0c, 0x9e, 0x0c, 0x9e, 0x0c,
+  0xa1, 0x0c, 0xa2, 0x0c, 0xa2, 0x0c, 0xa2, 0x0c, 0xa9, 0x0c, 0xa9, 0x0c,
+  0xad, 0x0c, 0xc2, 0x0c, 0xc2, 0x0c, 0xcb, 0x0c, 0xd7, 0x0c, 0xd9, 0x0c,
+  0xe1, 0x0c, 0xe6, 0x0c, 0xe6, 0x0c, 0xe6, 0x0c, 0xfd, 0x0c, 0xfd, 0x0c,
+  0xfd, 0x0c, 0x03, 0x0d, 0x03, 0x0d, 0x03, 0x0d, 0x04, 0x0d, 0x04, 0x0d,
+  0x05, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x1a, 0x0d, 0x2d, 0x0d, 0x2d, 0x0d,
+  0x2d, 0x0d, 0x2e, 0x0d, 0x2e, 0x0d, 0x2e, 0x0d, 0x2e, 0x0d, 0x2e, 0x0d,
+  0x2e, 0x0d, 0x2e, 0x0d, 0x30, 0x0d, 0x30, 0x0d, 0x33, 0x0d, 0x33, 0x0d,
+  0x33, 0x0d, 0x3b, 0x0d, 0x3d, 0x0d, 0x3d, 0x0d, 0x3d, 0x0d, 0x3d, 0x0d,
+  0x3d, 0x0d, 0x3d, 0x0d, 0x3d, 0x0d, 0x3d, 0x0d, 0x3d, 0x0d, 0x3d, 0x0d,
+  0x42, 0x0d, 0x43, 0x0d, 0x46, 0x0d, 0x47, 0x0d, 0x52, 0x0d, 0x62, 0x0d,
+  0x62, 0x0d, 0x9a, 0x0d, 0x9c, 0x0d, 0x9c, 0x0d, 0xa4, 0x0d, 0xa4, 0x0d,
+  0xa4, 0x0d, 0xa5, 0x0d, 0xa5, 0x0d, 0xa5, 0x0d, 0xa5, 0x0d, 0xa5, 0x0d,
+  0xa5, 0x0d, 0xa5, 0x0d, 0xa5, 0x0d, 0xa5, 0x0d, 0xa5, 0x0d, 0xa5, 0x0d,
+  0xad, 0x0d, 0xad, 0x0d, 0xad, 0x0d, 0xad, 0x0d, 0xad, 0x0d, 0xad, 0x0d,
+  0xad, 0x0d, 0xad, 0x0d, 0xad, 0x0d, 0xad, 0x0d, 0xad, 0x0d, 0xad, 0x0d,
+  0xad, 0x0d, 0xad, 0x0d, 0xad, 0x0d, 0xad, 0x0d, 0xad, 0x0d, 0xad, 0x0d,
+  0xad, 0x0d, 0xad, 0x0d, 0xad, 0x0d, 0xad, 0x0d, 0xad, 0x0d, 0xad, 0x0d,
+  0xad, 0x0d, 0xad, 0x0d, 0xad, 0x0d, 0xad, 0x0d, 0xad, 0x0d, 0xad, 0x0d,
+  0xad, 0x0d, 0xad, 0x0d, 0xad, 0x0d, 0xad, 0x0d, 0xad, 0x0d, 0xad, 0x0d,
+  0xad, 0x0d, 0xad, 0x0d, 0xad, 0x0d, 0xad, 0x0d, 0xad, 0x0d, 0xad, 0x0d,
+  0xad, 0x0d, 0xad, 0x0d, 0xad, 0x0d, 0xad, 0x0d, 0xad, 0x0d, 0xad, 0x0d,
+  0xad, 0x0d, 0xad, 0x0d, 0xad, 0x0d, 0xad, 0x0d, 0xad, 0x0d, 0xad, 0x0d,
+  0xad, 0x0d, 0xad, 0x0d, 0xad, 0x0d, 0xad, 0x0d, 0xad, 0x0d, 0xad, 0x0d,
+  0xad, 0x0d, 0xad, 0x0d, 0xad, 0x0d, 0xad, 0x0d, 0xad, 0x0d, 0xad, 0x0d,
+  0xad, 0x0d, 0xad, 0x0d, 0xad, 0x0d, 0xad, 0x0d, 0xad, 0x0d, 0xad, 0x0d,
+  0xad, 0x0d, 0xad, 0x0d, 0xad, 0x0d, 0xad, 0x0d, 0xad, 0x0d, 0xad, 0x0d,
+  0xad, 0x0d, 0xad, 0x0d, 0xad, 0x0d, 0xad, 0x0d, 0xad, 0x0d, 0xad, 0x0d,
+  0xad, 0x0d, 0xad, 0x0d, 0xad, 0x0d, 0xad, 0x0d, 0xad, 0x0d, 0xad, 0x0d,
+  0xad, 0x0d, 0xad, 0x0d, 0xad, 0x0d, 0xad, 0x0d, 0xad, 0x0d, 0xad, 0x0d,
+  0xad, 0x0d, 0xad, 0x0d, 0xad, 0x0d, 0xad, 0x0d, 0xad, 0x0d, 0xad, 0x0d,
+  0xad, 0x0d, 0xad, 0x0d, 0xad, 0x0d, 0xae, 0x0d, 0xae, 0x0d, 0xb0, 0x0d,
+  0xb0, 0x0d, 0xb0, 0x0d, 0xb0, 0x0d, 0xb0, 0x0d, 0xb0, 0x0d, 0xb0, 0x0d,
+  0xb0, 0x0d, 0xb0, 0x0d, 0xb0, 0x0d, 0xb0, 0x0d, 0xb0, 0x0d, 0xb0, 0x0d,
+  0xb0, 0x0d, 0xb0, 0x0d, 0xb0, 0x0d, 0xb0, 0x0d, 0xb0, 0x0d, 0xb0, 0x0d,
+  0xb0, 0x0d, 0xb0, 0x0d, 0xb0, 0x0d, 0xb0, 0x0d, 0xb0, 0x0d, 0xb0, 0x0d,
+  0xb0, 0x0d, 0xb0, 0x0d, 0xb0, 0x0d, 0xb0, 0x0d, 0xb2, 0x0d, 0xb2, 0x0d,
+  0xb3, 0x0d, 0xb7, 0x0d, 0xb9, 0x0d, 0xbd, 0x0d, 0xc6, 0x0d, 0xd0, 0x0d,
+  0xd6, 0x0d, 0xe1, 0x0d, 0xe5, 0x0d, 0xe5, 0x0d, 0xed, 0x0d, 0xf2, 0x0d,
+  0xf2, 0x0d, 0xf2, 0x0d, 0xf2, 0x0d, 0xf2, 0x0d, 0xf3, 0x0d, 0xf3, 0x0d,
+  0xf6, 0x0d, 0xf6, 0x0d, 0xf6, 0x0d, 0xf6, 0x0d, 0xf6, 0x0d, 0xf6, 0x0d,
+  0xf6, 0x0d, 0xf6, 0x0d, 0xf6, 0x0d, 0xf7, 0x0d, 0xf7, 0x0d, 0xf7, 0x0d,
+  0xf7, 0x0d, 0xf8, 0x0d, 0xf9, 0x0d, 0xfb, 0x0d, 0xfb, 0x0d, 0x02, 0x0e,
+  0x11, 0x0e, 0x11, 0x0e, 0x2b, 0x0e, 0x4f, 0x0e, 0x51, 0x0e, 0x66, 0x0e,
+  0x7e, 0x0e, 0x90, 0x0e, 0x90, 0x0e, 0xa2, 0x0e, 0xb0, 0x0e, 0xb0, 0x0e,
+  0xbb, 0x0e, 0xdd, 0x0e, 0xe4, 0x0e, 0xea, 0x0e, 0x05, 0x0f, 0x12, 0x0f,
+  0x12, 0x0f, 0x14, 0x0f, 0x2f, 0x0f, 0x2f, 0x0f, 0x45, 0x0f, 0x5a, 0x0f,
+  0x5a, 0x0f, 0x5f, 0x0f, 0x63, 0x0f, 0x64, 0x0f, 0x65, 0x0f, 0x67, 0x0f,
+  0x67, 0x0f, 0x6a, 0x0f, 0x6c, 0x0f, 0x74, 0x0f, 0x86, 0x0f, 0x86, 0x0f,
+  0x86, 0x0f, 0x89, 0x0f, 0x8e, 0x0f, 0x8e, 0x0f, 0x91, 0x0f, 0x91, 0x0f,
+  0x91, 0x0f, 0x91, 0x0f, 0x91, 0x0f, 0x98, 0x0f, 0x98, 0x0f, 0x9b, 0x0f,
+  0xa2, 0x0f, 0xae, 0x0f, 0xb5, 0x0f, 0xb6, 0x0f, 0xb7, 0x0f, 0xb8, 0x0f,
+  0xb9, 0x0f, 0xba, 0x0f, 0xbb, 0x0f, 0xbc, 0x0f, 0xbd, 0x0f, 0xc1, 0x0f,
+  0xc2, 0x0f, 0xc6, 0x0f, 0xcb, 0x0f, 0xcc, 0x0f, 0xd2, 0x0f, 0xd2, 0x0f,
+  0xd7, 0x0f, 0xf5, 0x0f, 0xf5, 0x0f, 0xfa, 0x0f, 0x11, 0x10, 0x11, 0x10,
+  0x11, 0x10, 0x11, 0x10, 0x11, 0x10, 0x11, 0x10, 0x11, 0x10, 0x13, 0x10,
+  0x13, 0x10, 0x14, 0x10, 0x14, 0x10, 0x14, 0x10, 0x18, 0x10, 0x18, 0x10,
+  0x19, 0x10, 0x1e, 0x10, 0x1e, 0x10, 0x33, 0x10, 0x33, 0x10, 0x33, 0x10,
+  0x3b, 0x10, 0x3b, 0x10, 0x3b, 0x10, 0x3b, 0x10, 0x3d, 0x10, 0x3d, 0x10,
+  0x3d, 0x10, 0x3d, 0x10, 0x3d, 0x10, 0x3d, 0x10, 0x3d, 0x10, 0x3d, 0x10,
+  0x3d, 0x10, 0x3d, 0x10, 0x3d, 0x10, 0x3d, 0x10, 0x3d, 0x10, 0x3d, 0x10,
+  0x3d, 0x10, 0x3d, 0x10, 0x3d, 0x10, 0x3d, 0x10, 0x3e, 0x10, 0x3e, 0x10,
+  0x3e, 0x10, 0x3e, 0x10, 0x3e, 0x10, 0x3e, 0x10, 0x3e, 0x10, 0x3e, 0x10,
+  0x3e, 0x10, 0x3e, 0x10, 0x3e, 0x10, 0x3e, 0x10, 0x3e, 0x10, 0x3e, 0x10,
+  0x3e, 0x10, 0x3e, 0x10, 0x3e, 0x10, 0x3e, 0x10, 0x3e, 0x10, 0x3e, 0x10,
+  0x3e, 0x10, 0x3e, 0x10, 0x3e, 0x10, 0x3e, 0x10, 0x3e, 0x10, 0x3e, 0x10,
+  0x3e, 0x10, 0x3e, 0x10, 0x3e, 0x10, 0x3e, 0x10, 0x3e, 0x10, 0x3e, 0x10,
+  0x3e, 0x10, 0x3e, 0x10, 0x3e, 0x10, 0x3e, 0x10, 0x3e, 0x10, 0x3e, 0x10,
+  0x3e, 0x10, 0x3e, 0x10, 0x3e, 0x10, 0x3e, 0x10, 0x3e, 0x10, 0x3e, 0x10,
+  0x3e, 0x10, 0x3e, 0x10, 0x3e, 0x10, 0x3e, 0x10, 0x3e, 0x10, 0x3e, 0x10,
+  0x3e, 0x10, 0x3e, 0x10, 0x3e, 0x10, 0x3e, 0x10, 0x3e, 0x10, 0x3e, 0x10,
+  0x3e, 0x10, 0x3e, 0x10, 0x3e, 0x10, 0x3e, 0x10, 0x3e, 0x10, 0x3e, 0x10,
+  0x3e, 0x10, 0x3e, 0x10, 0x3e, 0x10, 0x3e, 0x10, 0x3e, 0x10, 0x3e, 0x10,
+  0x3e, 0x10, 0x3e, 0x10, 0x3e, 0x10, 0x3e, 0x10, 0x3e, 0x10, 0x3e, 0x10,
+  0x3e, 0x10, 0x3e, 0x10, 0x3f, 0x10, 0x3f, 0x10, 0x3f, 0x10, 0x3f, 0x10,
+  0x3f, 0x10, 0x3f, 0x10, 0x3f, 0x10, 0x3f, 0x10, 0x3f, 0x10, 0x3f, 0x10,
+  0x3f, 0x10, 0x3f, 0x10, 0x3f, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0x10,
+  0x40, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0x10,
+  0x40, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0x10,
+  0x40, 0x10, 0x41, 0x10, 0x41, 0x10, 0x41, 0x10, 0x41, 0x10, 0x43, 0x10,
+  0x43, 0x10, 0x43, 0x10, 0x43, 0x10, 0x43, 0x10, 0x43, 0x10, 0x43, 0x10,
+  0x43, 0x10, 0x43, 0x10, 0x43, 0x10, 0x43, 0x10, 0x43, 0x10, 0x43, 0x10,
+  0x43, 0x10, 0x43, 0x10, 0x43, 0x10, 0x44, 0x10, 0x44, 0x10, 0x44, 0x10,
+  0x44, 0x10, 0x44, 0x10, 0x44, 0x10, 0x44, 0x10, 0x44, 0x10, 0x44, 0x10,
+  0x44, 0x10, 0x44, 0x10, 0x44, 0x10, 0x44, 0x10, 0x44, 0x10, 0x44, 0x10,
+  0x45, 0x10, 0x45, 0x10, 0x45, 0x10, 0x45, 0x10, 0x45, 0x10, 0x45, 0x10,
+  0x45, 0x10, 0x45, 0x10, 0x45, 0x10, 0x45, 0x10, 0x4f, 0x10, 0x4f, 0x10,
+  0x4f, 0x10, 0x00, 0x00, 0x82, 0x4e, 0x6b, 0xf4, 0xfe, 0x1f, 0xce, 0xa1,
+  0xbc, 0x49, 0x4a, 0x03, 0xda, 0xf8, 0x97, 0x6c, 0xd0, 0x7e, 0x7d, 0x07,
+  0xf6, 0xc6, 0xf3, 0x91, 0x90, 0xb0, 0x47, 0x79, 0x40, 0x25, 0x48, 0xed,
+  0x66, 0x76, 0x3a, 0x6b, 0x8b, 0x0a, 0xfe, 0xd0, 0x85, 0x31, 0xb9, 0xe2,
+  0x03, 0xdb, 0xea, 0x7e, 0x67, 0xe2, 0x3d, 0xf1, 0x86, 0x70, 0xad, 0x27,
+  0xfc, 0x0b, 0xa8, 0xf0, 0xf1, 0x99, 0x63, 0xa0, 0x3d, 0x5c, 0xc6, 0x4c,
+  0x08, 0x6e, 0xaa, 0x0c, 0x13, 0x76, 0xdf, 0x40, 0x6c, 0xde, 0x63, 0xde,
+  0x95, 0xe2, 0xb5, 0xae, 0x3d, 0x5d, 0xb8, 0x7d, 0x31, 0xca, 0x19, 0x39,
+  0x9e, 0x69, 0xca, 0xd3, 0xd5, 0xd3, 0x50, 0xcc, 0x94, 0x59, 0x39, 0xd3,
+  0xf7, 0x2e, 0xc8, 0xc3, 0xb5, 0xf9, 0xff, 0xef, 0x6f, 0xf7, 0xfe, 0xc7,
+  0x68, 0xf3, 0x47, 0xcd, 0xe6, 0xb7, 0x6d, 0x25, 0x24, 0x32, 0x6f, 0x8e,
+  0xeb, 0x28, 0x8c, 0xda, 0x73, 0x60, 0xd7, 0x75, 0xb8, 0x49, 0x6f, 0x2c,
+  0xe7, 0x43, 0x4f, 0x00, 0xb1, 0x0a, 0xf8, 0xce, 0x8e, 0x47, 0x3e, 0x64,
+  0x1b, 0xc3, 0xaf, 0x5f, 0x2f, 0x32, 0xa7, 0xb7, 0xbd, 0x24, 0x08, 0x83,
+  0xd1, 0x3a, 0xba, 0x50, 0x81, 0x40, 0xc1, 0xd9, 0x0c, 0x7d, 0xd3, 0x09,
+  0x1b, 0x00, 0x96, 0x77, 0x63, 0xd5, 0x1c, 0xd6, 0xe8, 0x87, 0x69, 0x1e,
+  0xd1, 0xb3, 0x80, 0xe0, 0xdb, 0xdb, 0xf6, 0x98, 0x53, 0xe3, 0x68, 0xcf,
+  0x90, 0x41, 0xcc, 0x8e, 0x37, 0xe0, 0x0c, 0xa9, 0x57, 0xf0, 0x85, 0xd7,
+  0xb1, 0xed, 0xd9, 0x8a, 0x8f, 0x9b, 0xf7, 0x87, 0xe0, 0x09, 0x8a, 0x84,
+  0x37, 0x82, 0x2c, 0xfa, 0xae, 0x89, 0xfe, 0x64, 0x06, 0xb2, 0x2d, 0x9a,
+  0x5e, 0xa3, 0x56, 0xfb, 0xec, 0xa7, 0x88, 0x7d, 0x6b, 0x04, 0x3c, 0x86,
+  0x0b, 0x8d, 0x49, 0x3b, 0x94, 0x45, 0x8a, 0xa2, 0xf7, 0x55, 0xa9, 0xc4,
+  0x3b, 0xe8, 0xfa, 0x66, 0xca, 0x6a, 0x6b, 0x93, 0x07, 0xec, 0x8c, 0x35,
+  0x49, 0xe8, 0xfb, 0x2a, 0xf8, 0xe8, 0x49, 0x91, 0x1f, 0x3f, 0xf2, 0x2c,
+  0x5a, 0x49, 0x45, 0xb0, 0x9a, 0xc3, 0xd7, 0x41, 0xee, 0x2e, 0x0d, 0x4f,
+  0xf9, 0xff, 0x01, 0x89, 0x22, 0xa6, 0x7e, 0x2a, 0x15, 0x14, 0xe3, 0x5a,
+  0xb2, 0x7d, 0x4a, 0xcd, 0xa9, 0x26, 0x8f, 0x9a, 0x2a, 0x67, 0xd5, 0xd4,
+  0x27, 0x74, 0x36, 0x75, 0xf5, 0x00, 0x7b, 0x21, 0x1b, 0xa2, 0x69, 0x5e,
+  0xcf, 0xbc, 0xbc, 0xd7, 0x33, 0x5d, 0x89, 0xe1, 0xa9, 0x5b, 0x92, 0x25,
+  0x76, 0x2a, 0x55, 0x8a, 0x59, 0x0e, 0x59, 0xb1, 0xd5, 0xe2, 0xf7, 0xb6,
+  0x82, 0xb2, 0x05, 0xcc, 0xc8, 0xa6, 0xe0, 0x2b, 0xdd, 0xc0, 0x4f, 0xc9,
+  0xb0, 0x1b, 0xed, 0x54, 0x6b, 0xb8, 0xbd, 0xac, 0x37, 0xd4, 0x85, 0x14,
+  0x18, 0x13, 0x10, 0xb1, 0xbe, 0x67, 0xc3, 0x8b, 0xbc, 0x2b, 0x1e, 0x8f,
+  0xbd, 0x3e, 0x7f, 0xc5, 0xcd, 0xd9, 0x4d, 0x5c, 0xa4, 0x81, 0xed, 0xe9,
+  0x57, 0xa8, 0xd1, 0xfd, 0x6f, 0xee, 0xca, 0x5a, 0x90, 0xf6, 0x44, 0xd1,
+  0x1e, 0x85, 0x3a, 0x26, 0x49, 0x4a, 0xa1, 0x60, 0x24, 0x14, 0x4c, 0x40,
+  0x73, 0x64, 0x2d, 0x65, 0x79, 0x39, 0xf5, 0x11, 0xb2, 0xe0, 0x3a, 0xa0,
+  0x55, 0x1a, 0xc3, 0x84, 0x41, 0x03, 0x58, 0x9f, 0x18, 0x07, 0x7b, 0xeb,
+  0x4e, 0xf4, 0x50, 0xa7, 0xa4, 0x89, 0x85, 0xc3, 0x88, 0xd4, 0x1e, 0x93,
+  0x04, 0x82, 0x23, 0x24, 0xc4, 0xf3, 0x5e, 0x5b, 0x38, 0xf4, 0xc4, 0xad,
+  0x9d, 0x23, 0xad, 0x79, 0x00, 0x53, 0x70, 0x60, 0x2c, 0xe4, 0x52, 0x66,
+  0x55, 0x12, 0xfb, 0xf3, 0xe7, 0xe8, 0x92, 0x1d, 0xda, 0x6a, 0x5a, 0x93,
+  0x6d, 0x0b, 0x31, 0xa2, 0xf0, 0xd4, 0x57, 0x6c, 0x06, 0xd3, 0x64, 0x38,
+  0x31, 0x7e, 0x9f, 0x66, 0xb2, 0xc8, 0x25, 0x30, 0x6d, 0x53, 0x02, 0xb2,
+  0x4f, 0xd8, 0xba, 0x77, 0x43, 0xac, 0xdb, 0x57, 0x84, 0x97, 0xba, 0x1e,
+  0x16, 0xe7, 0x4d, 0x9d, 0x55, 0xdf, 0x80, 0xed, 0x1d, 0x98, 0xeb, 0x17,
+  0xcb, 0x52, 0x08, 0x12, 0x6b, 0xa3, 0xed, 0x1a, 0x1f, 0x39, 0x1f, 0xd3,
+  0xc4, 0xaa, 0x41, 0x2b, 0x7a, 0xd6, 0xfb, 0x95, 0x21, 0x41, 0x85, 0x07,
+  0x25, 0x96, 0x4c, 0x5b, 0xd5, 0x40, 0x34, 0xb8, 0xa7, 0xa7, 0x47, 0x29,
+  0x31, 0xbf, 0xdf, 0x79, 0x9d, 0xb5, 0x7b, 0x79, 0xaf, 0x80, 0xdf, 0x93,
+  0x40, 0x5d, 0xe9, 0x01, 0x85, 0xf5, 0x57, 0xca, 0x9d, 0x35, 0x2a, 0xae,
+  0x6a, 0xcb, 0x2d, 0x82, 0x6b, 0xd3, 0xc1, 0x79, 0x6e, 0xe5, 0x78, 0xe9,
+  0x0a, 0x0c, 0xe9, 0x33, 0x38, 0x8a, 0xde, 0xbd, 0xfc, 0x37, 0x3b, 0xcf,
+  0x32, 0x85, 0x6d, 0x21, 0xc5, 0xf8, 0xcc, 0x76, 0x8a, 0x41, 0xaf, 0xe7,
+  0x43, 0xc4, 0x71, 0x89, 0x14, 0x63, 0x05, 0x55, 0x51, 0x22, 0xc0, 0x90,
+  0xe2, 0x51, 0xe1, 0xb9, 0x73, 0xb8, 0x24, 0xf5, 0xb5, 0x0d, 0xb7, 0x9f,
+  0x79, 0xe0, 0xdc, 0x2c, 0x1d, 0x3a, 0xa2, 0xdc, 0xad, 0xfd, 0x49, 0x9b,
+  0xec, 0x56, 0xef, 0x77, 0x24, 0x51, 0xff, 0x0e, 0xae, 0x78, 0xad, 0x98,
+  0xfe, 0x02, 0xd2, 0x22, 0x12, 0xff, 0x34, 0x8a, 0x2e, 0x06, 0xea, 0x34,
+  0xbf, 0x8f, 0x51, 0x87, 0x4c, 0xe9, 0x90, 0x84, 0x54, 0x9a, 0x64, 0x8b,
+  0xa4, 0xb7, 0x85, 0x8e, 0xe3, 0x39, 0x06, 0xb3, 0x31, 0xc3, 0x99, 0x50,
+  0xa8, 0x60, 0xff, 0x17, 0x1d, 0x96, 0x2f, 0x2c, 0x0d, 0x63, 0x43, 0x41,
+  0xc5, 0x55, 0x8f, 0xa4, 0x07, 0xdb, 0xbd, 0xf8, 0x36, 0x9d, 0x67, 0x4c,
+  0x8e, 0xff, 0x24, 0x03, 0x00, 0xff, 0x3d, 0xf9, 0x08, 0xda, 0x2a, 0x93,
+  0x37, 0x65, 0x7d, 0x5e, 0x91, 0xa7, 0xc5, 0x9f, 0xf7, 0x12, 0xc6, 0xa9,
+  0xbf, 0x80, 0x4e, 0x35, 0x9b, 0x62, 0xe0, 0x34, 0xdd, 0x65, 0xc2, 0x9d,
+  0x4d, 0x3e, 0xc3, 0x12, 0xcb, 0x48, 0x98, 0xf7, 0x9c, 0x94, 0x17, 0x73,
+  0xfd, 0xaf, 0xa8, 0xff, 0x6e, 0x93, 0x2f, 0x99, 0x4a, 0xd6, 0x1b, 0x62,
+  0xde, 0xfb, 0x12, 0x97, 0x37, 0x15, 0x55, 0x72, 0x26, 0x43, 0x5a, 0x85,
+  0x6b, 0x5b, 0xed, 0x22, 0xd0, 0x1e, 0xfe, 0x55, 0x95, 0x41, 0x1e, 0xcc,
+  0x3e, 0x21, 0xac, 0x54, 0x30, 0x13, 0xeb, 0x7e, 0xc3, 0xf5, 0xfa, 0x3f,
+  0x69, 0xab, 0x94, 0x15, 0x5c, 0x61, 0xb6, 0x0e, 0x6d, 0x27, 0x93, 0xde,
+  0x74, 0x03, 0xa7, 0x42, 0xe4, 0x80, 0x73, 0x67, 0x7f, 0xaf, 0xfd, 0x73,
+  0x27, 0x61, 0x77, 0x64, 0x73, 0xc3, 0xc7, 0x0f, 0x76, 0xaa, 0xe5, 0xc4,
+  0x1b, 0x5d, 0xca, 0xf4, 0xe4, 0x44, 0xbb, 0xba, 0x45, 0x2e, 0xcc, 0xe6,
+  0x66, 0x64, 0x72, 0x8e, 0x0f, 0x1f, 0xa2, 0x5a, 0xc8, 0x0a, 0xbf, 0x5b,
+  0xfd, 0x75, 0xfa, 0xfc, 0x85, 0x60, 0x4c, 0x78, 0x97, 0x57, 0xab, 0x0a,
+  0x2c, 0x56, 0x75, 0x2f, 0x7d, 0x14, 0x88, 0x6d, 0xe3, 0x03, 0x3f, 0xf0,
+  0x8d, 0x38, 0xfe, 0xd9, 0x2c, 0xe5, 0x11, 0xfa, 0x23, 0xdb, 0x10, 0x56,
+  0x57, 0x64, 0x95, 0x6d, 0x6f, 0x58, 0xa9, 0x96, 0x0c, 0x4b, 0x48, 0xd1,
+  0xb1, 0x14, 0x78, 0x38, 0x06, 0x30, 0xfd, 0x0d, 0xde, 0xbe, 0x2d, 0x33,
+  0xb6, 0xd0, 0x8f, 0x19, 0x76, 0x3a, 0x31, 0xa6, 0xb6, 0x37, 0x70, 0x67,
+  0xab, 0x5f, 0x67, 0x19, 0xdb, 0xcb, 0x0f, 0xcb, 0xa0, 0x50, 0x7b, 0xa4,
+  0x06, 0xa8, 0xc5, 0xfd, 0x63, 0x24, 0xf9, 0x77, 0x56, 0xf8, 0xb4, 0xa5,
+  0xd2, 0xef, 0x28, 0x75, 0x6d, 0x02, 0x58, 0x99, 0x42, 0x9d, 0xb1, 0xb5,
+  0x79, 0xdd, 0xcc, 0xc2, 0x1b, 0xea, 0x04, 0xe4, 0xa0, 0x4e, 0x1e, 0x9e,
+  0x55, 0x69, 0xdf, 0x8b, 0xf5, 0x98, 0x52, 0xff, 0xb9, 0xfc, 0x80, 0xde,
+  0xe7, 0xf0, 0xfe, 0xf7, 0xe8, 0x46, 0xf1, 0x97, 0x55, 0x71, 0xc4, 0x67,
+  0x16, 0x1c, 0x2e, 0x74, 0x3b, 0x91, 0x9c, 0xb4, 0x34, 0x5d, 0x5d, 0xb7,
+  0x55, 0x00, 0xe2, 0xbc, 0x23, 0xf4, 0x24, 0x03, 0xb9, 0xca, 0x6a, 0xa9,
+  0x02, 0x9f, 0xa3, 0x85, 0x23, 0x45, 0x17, 0xab, 0xeb, 0xf4, 0xe7, 0x05,
+  0x22, 0x0c, 0x42, 0x43, 0x4b, 0x94, 0x68, 0x68, 0x56, 0x45, 0x7d, 0x4c,
+  0xd8, 0x04, 0x5a, 0x97, 0xd0, 0xa7, 0x74, 0x93, 0xd1, 0x0f, 0xed, 0x5f,
+  0x4a, 0x40, 0xff, 0x9d, 0x50, 0x2e, 0x97, 0xf0, 0x68, 0xe4, 0x81, 0xeb,
+  0xa1, 0x7d, 0x0f, 0x1d, 0xbc, 0x08, 0x03, 0x54, 0xbd, 0xd4, 0x87, 0x1c,
+  0x7a, 0x38, 0x12, 0xcf, 0x1e, 0x3f, 0xd9, 0xa6, 0x86, 0x0d, 0xb0, 0x3d,
+  0xd3, 0xfc, 0xcf, 0xbf, 0x9b, 0xaf, 0x17, 0xd5, 0xe7, 0xf4, 0x05, 0xe8,
+  0x6c, 0x7e, 0x3d, 0x57, 0x2e, 0xc8, 0x62, 0x07, 0x9b, 0xd7, 0x1e, 0xd7,
+  0xf9, 0xce, 0x0f, 0x71, 0x89, 0x90, 0x99, 0xf7, 0xea, 0x02, 0x1f, 0x8b,
+  0x46, 0xd1, 0x6f, 0x98, 0x4c, 0x6d, 0xf5, 0x77, 0x03, 0x47, 0x44, 0x63,
+  0x30, 0x9d, 0xb0, 0x79, 0x96, 0xf0, 0x80, 0x4b, 0x27, 0x43, 0x69, 0xd9,
+  0x66, 0xdc, 0xe6, 0x21, 0xf0, 0x59, 0x40, 0xcd, 0x33, 0x9c, 0x1c, 0xae,
+  0xd4, 0xc0, 0x45, 0x90, 0xfd, 0x8a, 0x08, 0x0d, 0xaf, 0x32, 0xa8, 0xde,
+  0x1e, 0x30, 0xc6, 0x7a, 0xe4, 0x75, 0xcc, 0xfd, 0x7d, 0x8a, 0xd4, 0xa2,
+  0x45, 0xf3, 0xc3, 0x7b, 0x3c, 0x57, 0xd4, 0x5e, 0x4f, 0xec, 0xcf, 0x20,
+  0xd4, 0x58, 0x83, 0x3a, 0x14, 0x29, 0x7e, 0x57, 0xa3, 0x0d, 0x6f, 0x1e,
+  0xcb, 0x80, 0x14, 0x60, 0xf6, 0x27, 0x3f, 0xaf, 0x4e, 0x59, 0x7e, 0x3c,
+  0x2c, 0xe3, 0x2d, 0xb7, 0x70, 0xe8, 0x23, 0x32, 0x96, 0x55, 0x57, 0x24,
+  0xda, 0xb9, 0xde, 0x8e, 0x1b, 0x54, 0xe3, 0x30, 0x8e, 0xb8, 0x2d, 0x12,
+  0xb0, 0xfe, 0x69, 0x5f, 0x07, 0x78, 0xb5, 0x56, 0xa3, 0xa7, 0x37, 0xd4,
+  0xef, 0x63, 0x82, 0x22, 0x7f, 0x1e, 0xb9, 0xeb, 0xa5, 0x3e, 0x9a, 0xeb,
+  0x1b, 0x40, 0x0c, 0xf4, 0x0e, 0x7e, 0xba, 0xda, 0xa2, 0xad, 0x1c, 0x52,
+  0xd7, 0x65, 0xca, 0x1e, 0x2d, 0xc7, 0x44, 0xee, 0xb9, 0xb0, 0x49, 0xbe,
+  0x16, 0x90, 0xed, 0xdd, 0x8f, 0x36, 0x4b, 0x88, 0x22, 0xe4, 0x45, 0xeb,
+  0x52, 0xf7, 0x40, 0x99, 0x56, 0xa4, 0x0d, 0x25, 0x1a, 0x53, 0xa6, 0x49,
+  0x31, 0xfd, 0xc8, 0xfd, 0xed, 0x4f, 0xc9, 0x7c, 0xa7, 0xfa, 0x0c, 0x92,
+  0x80, 0x59, 0x14, 0x16, 0x37, 0x50, 0xf7, 0x3a, 0x20, 0x39, 0x44, 0xa2,
+  0xc7, 0x51, 0x15, 0x8e, 0xa7, 0xf3, 0x52, 0x25, 0x88, 0x99, 0xbd, 0xd7,
+  0x5e, 0x0f, 0x0e, 0xcc, 0xcb, 0x3e, 0x77, 0xe3, 0x10, 0xa9, 0xdf, 0xc7,
+  0xb8, 0xbf, 0x74, 0xb8, 0x9e, 0x50, 0x83, 0xee, 0xcf, 0x31, 0x75, 0x76,
+  0x17, 0xe7, 0xe0, 0x60, 0x59, 0x23, 0x51, 0x0c, 0x6d, 0x89, 0x53, 0xb5,
+  0x5a, 0xc4, 0x8e, 0x94, 0xc3, 0xee, 0x1e, 0x47, 0x3a, 0xbd, 0x7f, 0x72,
+  0x02, 0x40, 0xed, 0x0a, 0x87, 0xb0, 0xed, 0xa2, 0xcd, 0xb8, 0x8c, 0xa7,
+  0x9f, 0x9c, 0xc5, 0x95, 0x8c, 0xe1, 0x82, 0x86, 0x63, 0x15, 0x61, 0xe2,
+  0x52, 0x06, 0xc2, 0x15, 0xee, 0x12, 0x37, 0x46, 0xdc, 0x15, 0x32, 0x22,
+  0x4e, 0xb3, 0x7a, 0x88, 0x7f, 0x5c, 0x97, 0x8a, 0x5d, 0x5e, 0xfa, 0xed,
+  0x25, 0x8a, 0x37, 0x25, 0x1c, 0x02, 0x95, 0x7d, 0x4e, 0x88, 0x17, 0xc6,
+  0x04, 0xc1, 0xc3, 0x84, 0xa5, 0xb3, 0xa1, 0x6a, 0xa0, 0xff, 0x98, 0xd9,
+  0x5d, 0xcc, 0x7a, 0xbe, 0xdc, 0xbf, 0xc4, 0xc4, 0xdd, 0x82, 0x2f, 0x77,
+  0xc3, 0xeb, 0xd1, 0x45, 0xb3, 0x2a, 0xa2, 0x31, 0xbc, 0x81, 0x99, 0x26,
+  0x2c, 0xee, 0xbf, 0x9b, 0x7f, 0xb3, 0x7b, 0x77, 0xc7, 0xfa, 0xc2, 0x58,
+  0x15, 0xe4, 0x6b, 0x4a, 0x72, 0x93, 0xe3, 0x13, 0x44, 0xf7, 0xd7, 0xb4,
+  0x1c, 0x62, 0x6f, 0x07, 0xd6, 0xa7, 0xd5, 0xdc, 0x83, 0xd0, 0x20, 0xa5,
+  0xf8, 0x5c, 0x31, 0x0e, 0xb5, 0x0a, 0x51, 0xe8, 0xd4, 0x2d, 0x0b, 0xc7,
+  0x9a, 0x07, 0xd4, 0x62, 0xd8, 0xd1, 0xf9, 0x96, 0x0d, 0xe7, 0x43, 0x05,
+  0x2d, 0x8d, 0xb8, 0xd0, 0x91, 0x6f, 0x95, 0x2e, 0x76, 0xc5, 0x15, 0x24,
+  0x0b, 0xb1, 0xb5, 0x74, 0x2f, 0x87, 0x31, 0xe4, 0x85, 0x82, 0x74, 0x7e,
+  0x92, 0xa3, 0x41, 0xf4, 0x27, 0x0e, 0x5e, 0xac, 0x02, 0x4a, 0x4a, 0x4f,
+  0xdc, 0x74, 0x03, 0xe1, 0xf6, 0x97, 0xaa, 0x71, 0x13, 0x46, 0xc6, 0xcc,
+  0xfa, 0xe9, 0xdf, 0xb7, 0xf7, 0xfd, 0x7f, 0xe1, 0x8e, 0xad, 0x49, 0xa5,
+  0xaa, 0x99, 0xa4, 0xcc, 0x6f, 0x07, 0xa5, 0x32, 0x46, 0xbf, 0x49, 0x26,
+  0x15, 0x63, 0x9d, 0xb8, 0x20, 0xe6, 0xf3, 0x29, 0xe9, 0xab, 0x5a, 0x3e,
+  0xe6, 0x59, 0x7c, 0xa9, 0x49, 0x46, 0x5a, 0xdf, 0x79, 0x36, 0x05, 0x58,
+  0xfb, 0x70, 0x54, 0x0c, 0xf6, 0x25, 0x5c, 0x5e, 0x80, 0x94, 0x6e, 0x94,
+  0x04, 0x15, 0xb5, 0x7c, 0xc3, 0x41, 0x1e, 0xa5, 0x4b, 0x91, 0x7a, 0x75,
+  0xb4, 0x9d, 0x14, 0x75, 0x91, 0x93, 0xb0, 0x96, 0x1a, 0x1b, 0x85, 0x24,
+  0xc1, 0x2a, 0x13, 0x35, 0x7b, 0x71, 0xa9, 0x08, 0x4d, 0x1f, 0x97, 0xf3,
+  0x73, 0xe7, 0x42, 0x2d, 0xd1, 0x37, 0x3c, 0x71, 0x33, 0xc6, 0x56, 0xf7,
+  0xc2, 0x40, 0x19, 0x5a, 0xfb, 0x73, 0x6d, 0x88, 0x3c, 0x86, 0xc2, 0x9e,
+  0x83, 0x05, 0x7f, 0xab, 0x30, 0x7e, 0x33, 0x5d, 0x5b, 0x35, 0xa2, 0x3c,
+  0xca, 0x53, 0x96, 0x4d, 0xe1, 0x78, 0xed, 0x26, 0xa5, 0x32, 0xff, 0x6b,
+  0x2b, 0xbc, 0xe7, 0x65, 0x51, 0xb3, 0xd5, 0x94, 0x87, 0x92, 0x7f, 0x1d,
+  0xb1, 0xb1, 0xdd, 0x12, 0x00, 0x0c, 0xa9, 0x46, 0xf9, 0x1d, 0x52, 0x0d,
+  0x2c, 0x3a, 0x3c, 0xea, 0x7f, 0xfb, 0x0d, 0xaa, 0x63, 0x01, 0xa7, 0x7a,
+  0x3e, 0x76, 0xcf, 0xc8, 0x9d, 0xe7, 0xd4, 0xfa, 0xa2, 0x27, 0x73, 0xcd,
+  0x4a, 0x76, 0x50, 0x2a, 0x79, 0xe4, 0x33, 0xa3, 0xdb, 0x47, 0xa5, 0xce,
+  0x98, 0x4e, 0xd7, 0x42, 0x8d, 0xa8, 0x9f, 0x6a, 0xf3, 0xf4, 0x11, 0xd3,
+  0x3e, 0xab, 0x80, 0x89, 0x2e, 0xc0, 0xb7, 0x48, 0x66, 0xb2, 0x33, 0xea,
+  0xce, 0xc1, 0x60, 0x27, 0xe9, 0x71, 0xb4, 0x42, 0x2a, 0xfd, 0x0e, 0xc0,
+  0x04, 0xfc, 0x2a, 0xf2, 0x5d, 0x35, 0x3b, 0xc4, 0xcc, 0xaa, 0xeb, 0x19,
+  0xfe, 0xc4, 0xc3, 0xc0, 0x06, 0xe3, 0xd2, 0x93, 0x31, 0x62, 0x74, 0x55,
+  0xe8, 0xa6, 0x91, 0x55, 0xe2, 0xc4, 0x01, 0x24, 0x83, 0xc7, 0xf6, 0xbe,
+  0xfe, 0x16, 0x05, 0x71, 0x22, 0x49, 0x12, 0xbe, 0xd3, 0x41, 0x9d, 0x1c,
+  0x52, 0x17, 0x3e, 0xac, 0x99, 0x8d, 0x77, 0xc5, 0x6b, 0xd2, 0x9f, 0x4e,
+  0xf2, 0xbc, 0x3a, 0x55, 0x7a, 0x89, 0xed, 0xd9, 0x41, 0xc5, 0x22, 0xa2,
+  0x7c, 0xec, 0xd1, 0x65, 0xa1, 0x8e, 0xff, 0x48, 0x5a, 0x24, 0x3a, 0x4b,
+  0x51, 0x6e, 0x2c, 0xcc, 0x2a, 0xef, 0x7a, 0xdf, 0x7d, 0xd2, 0x3a, 0xbd,
+  0x24, 0xab, 0x7c, 0xcd, 0x17, 0xd2, 0xf5, 0xff, 0x99, 0xec, 0x6d, 0x24,
+  0xfe, 0x3d, 0x6f, 0xbf, 0x86, 0xdf, 0xd0, 0x8b, 0xf2, 0x62, 0x7e, 0xae,
+  0xea, 0x47, 0x86, 0xaa, 0xe3, 0x22, 0x40, 0xf8, 0x55, 0xda, 0x67, 0xd0,
+  0x9c, 0xfd, 0x5e, 0xf9, 0xef, 0xd5, 0x01, 0x0d, 0x0f, 0xf9, 0x1b, 0x3c,
+  0x74, 0x4d, 0x36, 0xd4, 0x8a, 0x5e, 0xff, 0xd5, 0x52, 0x2c, 0xc4, 0x72,
+  0x8a, 0xa0, 0x03, 0x9e, 0xbd, 0x3f, 0xfe, 0x8d, 0x70, 0x91, 0xe3, 0x05,
+  0x05, 0xbd, 0x89, 0xa8, 0x0a, 0x54, 0xdd, 0xfd, 0x17, 0x9a, 0x66, 0x87,
+  0xb7, 0x74, 0x6e, 0x1c, 0x0a, 0x59, 0xb4, 0xd1, 0x12, 0x9e, 0xdf, 0x9c,
+  0x1e, 0x7e, 0x6b, 0xcb, 0xc0, 0x20, 0x47, 0x1e, 0x50, 0x36, 0xdc, 0xdf,
+  0xd4, 0xdf, 0x7b, 0x94, 0x3e, 0xf0, 0x81, 0xbe, 0x4e, 0xbb, 0xa7, 0x1f,
+  0x51, 0x99, 0xc0, 0x7a, 0xa8, 0xe3, 0x5d, 0x86, 0xeb, 0xe9, 0xb5, 0xa5,
+  0xd8, 0x7a, 0x31, 0x78, 0xf9, 0xc1, 0x5a, 0xc3, 0x2f, 0xf5, 0xef, 0x39,
+  0xcc, 0xe3, 0x80, 0xae, 0xd7, 0x24, 0x4c, 0x6d, 0xff, 0xfd, 0x87, 0xe5,
+  0xd0, 0x5b, 0x51, 0xab, 0x9b, 0xb3, 0x69, 0xdb, 0xfa, 0xf5, 0x58, 0x40,
+  0x7b, 0x4d, 0x71, 0xc6, 0x4f, 0xa9, 0x6a, 0x6a, 0xc2, 0xb4, 0x04, 0xc5,
+  0x7c, 0x77, 0x47, 0x40, 0x4b, 0x4f, 0xd9, 0xfb, 0x2a, 0xa4, 0x5a, 0x28,
+  0x1f, 0x41, 0x7a, 0xfe, 0x66, 0x38, 0xe6, 0x39, 0xd5, 0x94, 0x9a, 0x1c,
+  0x66, 0xad, 0x98, 0x64, 0x6f, 0xdf, 0xe8, 0xf4, 0x12, 0x6a, 0x11, 0x8a,
+  0xcc, 0xda, 0xaf, 0x1e, 0xf5, 0xa1, 0x35, 0xe5, 0x95, 0x88, 0xb3, 0x7b,
+  0x19, 0xd5, 0x18, 0xa9, 0xfa, 0x4e, 0x16, 0xa6, 0x74, 0x55, 0x0c, 0x71,
+  0xc3, 0xd4, 0x03, 0xfc, 0x8e, 0x88, 0x14, 0x1c, 0x62, 0x66, 0x9b, 0xb3,
+  0x5f, 0xfa, 0x67, 0x2c, 0xb6, 0xea, 0x0b, 0x69, 0x8f, 0xe8, 0x01, 0x62,
+  0x3e, 0xf2, 0x0c, 0x96, 0x50, 0xd7, 0xa1, 0xfc, 0x37, 0x71, 0xfd, 0xe0,
+  0xcf, 0x71, 0xe1, 0x1f, 0xc0, 0x0f, 0x10, 0x08, 0x75, 0x67, 0xcb, 0x45,
+  0x60, 0x09, 0xa6, 0xe8, 0x03, 0x37, 0xe8, 0xd2, 0xbd, 0xd4, 0x7e, 0x03,
+  0xf5, 0x3b, 0x60, 0x84, 0x4d, 0xff, 0xe8, 0xa7, 0x05, 0x90, 0x1d, 0xa8,
+  0xb7, 0x1e, 0x3c, 0x79, 0x7f, 0x19, 0xa3, 0xc2, 0x07, 0x75, 0x95, 0xd6,
+  0xcf, 0x3b, 0x2f, 0x57, 0x99, 0x22, 0xc6, 0x8a, 0xc4, 0xa8, 0x62, 0xc1,
+  0x06, 0xe5, 0x58, 0x42, 0xd2, 0x61, 0xd6, 0x7b, 0x32, 0x11, 0xdd, 0xd8,
+  0x98, 0xa3, 0x87, 0x8c, 0xc3, 0xda, 0xcc, 0x88, 0xf6, 0xaa, 0xa3, 0xa2,
+  0x21, 0x61, 0x66, 0x40, 0x11, 0x5c, 0x0e, 0x20, 0xf8, 0xce, 0xf7, 0xcf,
+  0xdd, 0xb3, 0x34, 0x6e, 0x52, 0xa1, 0xf8, 0x1d, 0x08, 0x9e, 0x8f, 0xcb,
+  0x8a, 0x1c, 0x8b, 0x6a, 0x6b, 0x88, 0x22, 0x10, 0xa3, 0x6e, 0xe7, 0x96,
+  0x03, 0xa5, 0x57, 0x97, 0x9a, 0x79, 0x2b, 0x72, 0xc4, 0x14, 0x91, 0xb7,
+  0x41, 0xb1, 0x37, 0x80, 0x5e, 0x2e, 0x56, 0x16, 0xf4, 0x7e, 0x79, 0x4c,
+  0xf8, 0xa2, 0x2c, 0x79, 0x4c, 0xca, 0x3c, 0x2d, 0xbf, 0x78, 0xf1, 0xbf,
+  0xce, 0x13, 0x09, 0x18, 0x35, 0x82, 0x32, 0x8a, 0xf9, 0xd4, 0xc6, 0x29,
+  0x7a, 0x54, 0xbc, 0x20, 0xed, 0x74, 0x62, 0xc9, 0x49, 0xd9, 0x89, 0xfe,
+  0x66, 0x13, 0x3e, 0x57, 0x6b, 0x43, 0xd2, 0x68, 0x06, 0x57, 0x97, 0xa0,
+  0xcb, 0xa7, 0xa2, 0xfa, 0xf0, 0x22, 0x53, 0xad, 0x1e, 0x3f, 0x70, 0x08,
+  0xc3, 0xb6, 0x39, 0xd9, 0x40, 0x8c, 0x75, 0x9e, 0x6f, 0x23, 0x37, 0xb0,
+  0xb2, 0x9b, 0x49, 0x0e, 0x59, 0x75, 0x1a, 0xc6, 0x40, 0x4d, 0x14, 0xe5,
+  0x52, 0xe8, 0x66, 0xb1, 0x9e, 0x1d, 0x53, 0xd3, 0x9b, 0xea, 0x44, 0x04,
+  0xb9, 0xcf, 0x3e, 0xeb, 0x67, 0x5d, 0xf4, 0x31, 0x01, 0x91, 0x0f, 0xf8,
+  0x87, 0x6d, 0x97, 0x3d, 0xf2, 0x35, 0xca, 0x4c, 0xd0, 0xc5, 0xd3, 0x5f,
+  0x30, 0x30, 0x3b, 0x47, 0x72, 0x19, 0x3a, 0x34, 0xfd, 0xf3, 0xf2, 0x01,
+  0x5b, 0x39, 0xdf, 0x02, 0x48, 0x53, 0xe8, 0x4e, 0xc3, 0x1c, 0x38, 0x2b,
+  0x0b, 0x6e, 0x6a, 0xc3, 0xb6, 0xe7, 0x4f, 0x71, 0xdb, 0x02, 0x44, 0xd6,
+  0x17, 0x5b, 0x06, 0xc3, 0xd8, 0x72, 0x62, 0xf8, 0xa5, 0x94, 0xd8, 0x7b,
+  0x8b, 0x0a, 0x96, 0x68, 0x0c, 0x5b, 0xeb, 0x83, 0x7e, 0xa6, 0x6f, 0x7f,
+  0xb0, 0x88, 0x75, 0xd3, 0xfc, 0xe4, 0x80, 0x42, 0x4d, 0x1e, 0x6d, 0xb8,
+  0x68, 0x66, 0x2a, 0x9e, 0x6c, 0xff, 0x95, 0x70, 0xee, 0x4a, 0x5f, 0xb3,
+  0x95, 0xe2, 0xec, 0x1f, 0xa6, 0x3d, 0xa7, 0x82, 0x5f, 0x35, 0x90, 0x3a,
+  0x47, 0x0b, 0xce, 0x40, 0xb0, 0x8b, 0x88, 0x47, 0x7f, 0x7a, 0xa9, 0x99,
+  0x81, 0xe7, 0x82, 0x4c, 0xfa, 0x39, 0xf9, 0xdc, 0xf5, 0xfd, 0x53, 0x40,
+  0x7f, 0x9b, 0x92, 0x3d, 0x6d, 0xe8, 0xf9, 0x68, 0x96, 0xda, 0x9f, 0x2b,
+  0x78, 0xa4, 0xcc, 0x47, 0x73, 0xc0, 0x9e, 0x93, 0x3c, 0x1a, 0x7e, 0x19,
+  0x23, 0xcd, 0x68, 0xca, 0x49, 0x68, 0x7b, 0x3f, 0xb9, 0x7e, 0x08, 0x4b,
+  0x8d, 0xea, 0xb4, 0x56, 0xa5, 0x37, 0xba, 0xab, 0x62, 0x4d, 0x27, 0x19,
+  0xce, 0x6e, 0x3c, 0x94, 0x06, 0xd5, 0xd0, 0x36, 0x60, 0x0b, 0xb6, 0xd6,
+  0x56, 0x37, 0x39, 0x96, 0xc9, 0x1f, 0xcf, 0x14, 0x8b, 0xca, 0xaa, 0xc7,
+  0x56, 0xd7, 0xea, 0x80, 0x26, 0xbe, 0xa5, 0xf6, 0xb0, 0xbe, 0x24, 0x0a,
+  0xaa, 0x45, 0x2c, 0x06, 0xad, 0xd3, 0xe6, 0xeb, 0x11, 0xc7, 0x5d, 0x3a,
+  0x6e, 0xd1, 0x21, 0xd1, 0xeb, 0xce, 0xfe, 0xee, 0x25, 0x35, 0x68, 0xd6,
+  0x79, 0x59, 0xaf, 0xcb, 0x18, 0xd1, 0x90, 0x03, 0xcb, 0x8e, 0x77, 0x2a,
+  0x95, 0x13, 0x9f, 0xf9, 0x60, 0x51, 0x28, 0x21, 0xf4, 0x2d, 0xbf, 0x12,
+  0xce, 0x4b, 0x8e, 0x4c, 0x48, 0xe0, 0xcc, 0xfd, 0x82, 0x8f, 0x2f, 0xf0,
+  0x61, 0xc6, 0x91, 0x45, 0x73, 0x66, 0xa8, 0x9e, 0xde, 0x65, 0x1b, 0x51,
+  0x4a, 0x5e, 0x98, 0x89, 0x4a, 0xa9, 0xe0, 0xb1, 0x27, 0x9d, 0x39, 0x16,
+  0xfd, 0x20, 0x20, 0xc0, 0xd9, 0x78, 0x13, 0xec, 0x6a, 0xe0, 0x5f, 0x93,
+  0x52, 0xe8, 0x08, 0x44, 0x6e, 0x6a, 0x1b, 0x58, 0x42, 0x39, 0xd6, 0xb6,
+  0xcb, 0xcf, 0x3c, 0xcb, 0xf8, 0x68, 0xe9, 0x47, 0x71, 0x7c, 0x47, 0xaa,
+  0xe5, 0xbc, 0x1f, 0xc9, 0x03, 0xa2, 0xf0, 0xdf, 0x91, 0xf1, 0xc7, 0xb5,
+  0x04, 0x91, 0xfe, 0x67, 0xc9, 0x63, 0xd6, 0xca, 0x15, 0x31, 0xa3, 0x3b,
+  0xb9, 0x19, 0x23, 0xf7, 0x24, 0x4d, 0x79, 0x7b, 0x36, 0xcd, 0xde, 0x8e,
+  0xe1, 0xaf, 0x0a, 0xb4, 0x44, 0x3b, 0x98, 0x42, 0x4b, 0xf2, 0x65, 0x33,
+  0xe0, 0x6c, 0x99, 0x42, 0xca, 0x5a, 0xfe, 0x58, 0x8c, 0xb1, 0x16, 0x92,
+  0x8c, 0xec, 0x8b, 0x08, 0xb7, 0x02, 0x28, 0x6e, 0x28, 0x39, 0x0c, 0x1d,
+  0xf9, 0x1b, 0x7e, 0xdc, 0x7a, 0x22, 0x81, 0x66, 0xc9, 0xcc, 0x9e, 0x77,
+  0x31, 0xfc, 0x45, 0x62, 0xe0, 0x30, 0x46, 0x34, 0xd9, 0xf9, 0x04, 0xc4,
+  0xcb, 0xe5, 0xb5, 0x65, 0x7c, 0x3e, 0x6e, 0xa5, 0xe9, 0xb3, 0xc2, 0x34,
+  0x4e, 0x1d, 0x54, 0xef, 0xd0, 0x55, 0x7b, 0x3e, 0x7d, 0xe6, 0x63, 0xa8,
+  0x89, 0x6f, 0x8e, 0xa8, 0xb7, 0x1c, 0x64, 0x8e, 0xbf, 0xe5, 0x39, 0x14,
+  0x92, 0xb0, 0x33, 0x6a, 0xaa, 0x6c, 0x0d, 0xc6, 0x9e, 0x3b, 0x2d, 0x58,
+  0xe9, 0xb9, 0xe4, 0x33, 0x88, 0x38, 0xb3, 0xcf, 0xa4, 0xac, 0x05, 0xe5,
+  0x13, 0x01, 0xb1, 0x15, 0x9a, 0x4b, 0x9b, 0xe7, 0x5c, 0x19, 0xa7, 0x1a,
+  0xff, 0xce, 0xc2, 0xe7, 0x9a, 0xb9, 0x88, 0x8b, 0x2d, 0x61, 0x47, 0x2e,
+  0x5b, 0x42, 0xe4, 0x62, 0x3a, 0xa5, 0xdf, 0x43, 0x49, 0x4a, 0xaf, 0xd7,
+  0xc9, 0x12, 0x2c, 0xd0, 0x3b, 0x8c, 0x43, 0xb0, 0x37, 0x26, 0xbf, 0x5f,
+  0xd7, 0x87, 0x5d, 0xdf, 0xa4, 0x7d, 0x8c, 0x0e, 0x25, 0xe6, 0x01, 0x87,
+  0xd7, 0xf6, 0xa6, 0x49, 0xbf, 0x48, 0x58, 0xa4, 0x2a, 0x04, 0x63, 0x7e,
+  0x37, 0x5e, 0x3d, 0xfc, 0x5c, 0xd2, 0x87, 0x3c, 0xa5, 0x05, 0x44, 0x88,
+  0x98, 0xd4, 0x56, 0x37, 0x4d, 0x19, 0x84, 0x08, 0x81, 0xcf, 0x47, 0x75,
+  0x17, 0x57, 0xa8, 0xa1, 0x67, 0x3d, 0xa3, 0x44, 0x07, 0xc0, 0x0d, 0xb1,
+  0xfa, 0xc7, 0xc9, 0x74, 0x66, 0xac, 0xce, 0x7d, 0xe5, 0xec, 0x5b, 0x39,
+  0xf2, 0x72, 0x46, 0xb3, 0xc0, 0xcf, 0x59, 0x15, 0xd0, 0x46, 0x53, 0xc0,
+  0x3e, 0x47, 0x46, 0x73, 0xd1, 0x4a, 0x71, 0x1f, 0xf8, 0x91, 0x70, 0x39,
+  0x36, 0xc6, 0xb7, 0xd9, 0xf2, 0x7b, 0xa6, 0xde, 0x2d, 0x64, 0x83, 0x7a,
+  0x99, 0x71, 0x1f, 0x51, 0x7a, 0x58, 0x3d, 0xba, 0x81, 0xcd, 0x26, 0xd5,
+  0xfc, 0x90, 0x0f, 0x87, 0x73, 0x10, 0x00, 0x6c, 0xe0, 0xf7, 0x60, 0x15,
+  0xd1, 0xf6, 0x45, 0x42, 0x35, 0xef, 0x24, 0x1f, 0x08, 0xb0, 0xf4, 0x58,
+  0x5a, 0x48, 0x82, 0x19, 0x63, 0xb2, 0x3a, 0x4b, 0x16, 0xa6, 0x31, 0xb2,
+  0x2d, 0x9c, 0x8e, 0xb1, 0xb8, 0xf0, 0x86, 0xfb, 0xe8, 0x4d, 0x98, 0xe2,
+  0xdb, 0x40, 0x91, 0x39, 0x2d, 0x1e, 0x73, 0x10, 0xe9, 0x2d, 0xb8, 0x1b,
+  0x01, 0xaf, 0x40, 0x2b, 0x0f, 0x12, 0x81, 0x2c, 0xb7, 0x59, 0x54, 0xb7,
+  0x97, 0x3a, 0xbd, 0xb0, 0x96, 0xd9, 0x93, 0xa1, 0x8e, 0x61, 0x12, 0x2e,
+  0x5e, 0xaa, 0xac, 0x1d, 0x26, 0x69, 0xdd, 0x1d, 0xf1, 0xd5, 0x33, 0x46,
+  0x77, 0x00, 0x50, 0x66, 0xc4, 0xe5, 0xf3, 0x3d, 0x17, 0xde, 0xf2, 0xd8,
+  0xbe, 0x72, 0xf5, 0xa7, 0xb4, 0xd1, 0xe9, 0x4c, 0xfa, 0x9e, 0x39, 0x9b,
+  0x6c, 0xbc, 0x3b, 0x38, 0x18, 0x5e, 0x5e, 0x38, 0xfc, 0x1c, 0x70, 0x69,
+  0xa0, 0x45, 0x3e, 0xfb, 0xdf, 0x1d, 0x81, 0x12, 0xd0, 0x3d, 0xc3, 0x5f,
+  0xf6, 0x85, 0xb0, 0x0a, 0xa4, 0xa7, 0x45, 0xe1, 0x09, 0x91, 0x3d, 0xae,
+  0xe3, 0xf0, 0x5f, 0x0a, 0xaf, 0x85, 0x7f, 0xd0, 0x9f, 0x36, 0x47, 0x1f,
+  0x41, 0xe9, 0x96, 0x61, 0x43, 0x63, 0xc7, 0x7f, 0x3b, 0x26, 0xc9, 0x59,
+  0x74, 0xef, 0x69, 0x08, 0xa7, 0x0a, 0x2a, 0x02, 0xc2, 0x39, 0x13, 0x3c,
+  0xa1, 0x47, 0xd2, 0xec, 0xdb, 0x95, 0xf3, 0xac, 0x65, 0x49, 0xf7, 0x93,
+  0x97, 0xba, 0x40, 0x03, 0xda, 0x1d, 0x44, 0x80, 0x5b, 0x6b, 0xd1, 0xf5,
+  0x6b, 0x8b, 0x5e, 0x06, 0x79, 0xce, 0x1b, 0x01, 0x09, 0x58, 0x46, 0x83,
+  0x8d, 0xa0, 0x3b, 0x7b, 0x03, 0x13, 0xf4, 0x32, 0x7d, 0xd9, 0x41, 0x32,
+  0xfd, 0x54, 0x1e, 0xaf, 0xfc, 0x19, 0x0f, 0xb3, 0x8d, 0x5e, 0x28, 0xfa,
+  0x4d, 0xc9, 0x6d, 0x90, 0x26, 0xe0, 0xdd, 0x17, 0x6d, 0xd7, 0xea, 0x32,
+  0x0d, 0x67, 0x80, 0x4c, 0x71, 0x90, 0x26, 0xcf, 0x9b, 0xf2, 0xdc, 0xcb,
+  0xc9, 0xa8, 0x76, 0x20, 0xeb, 0xe9, 0x7e, 0x40, 0x18, 0xfe, 0x42, 0x27,
+  0x18, 0x02, 0x17, 0xb5, 0xce, 0x13, 0x14, 0x3e, 0xbd, 0x43, 0xab, 0x51,
+  0x6b, 0xb5, 0x01, 0xe3, 0xc1, 0x18, 0x69, 0xc7, 0xe2, 0x05, 0xe7, 0x69,
+  0x5b, 0xe4, 0xae, 0x6a, 0x3e, 0x1e, 0xe4, 0x7e, 0xe4, 0x25, 0x52, 0x53,
+  0xa1, 0x3b, 0xe5, 0x42, 0x1c, 0x85, 0xab, 0x4c, 0x3c, 0xce, 0x19, 0x3f,
+  0x7d, 0xd3, 0x19, 0xdf, 0xe1, 0x97, 0x7b, 0xbc, 0x58, 0x94, 0xcb, 0x41,
+  0x6e, 0x48, 0xc8, 0xac, 0x74, 0x50, 0x4f, 0x6f, 0x9f, 0xfb, 0x9b, 0x7d,
+  0x0b, 0x1e, 0xf9, 0xf7, 0x6a, 0x6a, 0xc3, 0x2e, 0xce, 0xdd, 0xbc, 0xe1,
+  0x9d, 0x71, 0xc3, 0x17, 0x30, 0xb9, 0x11, 0xa2, 0x15, 0x28, 0xa3, 0x94,
+  0x24, 0xcd, 0x84, 0x72, 0xd7, 0x28, 0x80, 0x55, 0x14, 0x95, 0x01, 0x99,
+  0xe7, 0xe1, 0x39, 0xcd, 0x4e, 0x87, 0x3b, 0x0e, 0x6a, 0x6f, 0x7e, 0x35,
+  0xfc, 0x08, 0xba, 0xf4, 0xbe, 0x6e, 0x94, 0x79, 0x1a, 0x07, 0x32, 0xb7,
+  0x5b, 0xad, 0x04, 0xa1, 0x5e, 0x53, 0xff, 0xd4, 0x08, 0x43, 0x07, 0xcb,
+  0x18, 0x09, 0x6a, 0x63, 0x6a, 0x5f, 0x99, 0x17, 0x67, 0x0f, 0x8f, 0x9a,
+  0x8c, 0xc1, 0x05, 0xe6, 0x7f, 0x19, 0xea, 0x95, 0xf1, 0x32, 0xb7, 0x64,
+  0x48, 0xf5, 0xc3, 0x6a, 0x46, 0x09, 0xb0, 0xee, 0xeb, 0x9a, 0x65, 0xc8,
+  0x18, 0x8d, 0x44, 0x1b, 0x4c, 0x5f, 0x84, 0xa3, 0x8d, 0xda, 0x4c, 0x4b,
+  0xe7, 0x1f, 0x8c, 0x54, 0x44, 0x89, 0x27, 0xd0, 0xbd, 0x59, 0x40, 0xdb,
+  0x8d, 0xf9, 0x04, 0xf8, 0xc0, 0x49, 0x93, 0xf1, 0x77, 0x1b, 0xc7, 0xed,
+  0x1b, 0xcd, 0xff, 0xae, 0x66, 0xb2, 0x4c, 0xcd, 0x41, 0xfd, 0x02, 0x77,
+  0x91, 0x6d, 0x96, 0x8e, 0x85, 0xc1, 0x4f, 0xf4, 0x35, 0x91, 0x6a, 0x9e,
+  0x68, 0x16, 0xc6, 0xc8, 0x2f, 0xf2, 0x3c, 0x2f, 0xb6, 0x96, 0x58, 0x35,
+  0x9e, 0x55, 0xaf, 0xb9, 0x5a, 0x5d, 0x5a, 0x88, 0x29, 0xe0, 0x0c, 0xfe,
+  0x35, 0xef, 0x9a, 0x28, 0x84, 0x61, 0x05, 0x06, 0x6a, 0x0e, 0xbe, 0xe5,
+  0x40, 0x7d, 0xe0, 0x69, 0x24, 0xef, 0xcb, 0xa6, 0x68, 0x18, 0xe6, 0x9a,
+  0x2c, 0xe4, 0xb3, 0x79, 0x59, 0xd9, 0xfb, 0xf8, 0xdb, 0x1a, 0x90, 0xd1,
+  0x02, 0x59, 0xef, 0x8a, 0x65, 0xe8, 0x1b, 0xa9, 0x2b, 0xfa, 0xde, 0x2a,
+  0x62, 0xbe, 0xac, 0x9c, 0x0a, 0x48, 0x15, 0x97, 0x46, 0x95, 0x6c, 0xf6,
+  0x34, 0x39, 0x30, 0x0b, 0xdc, 0x36, 0xdb, 0xcc, 0x6f, 0xb7, 0xda, 0x2e,
+  0x4d, 0xe9, 0x9e, 0x51, 0xfe, 0x0c, 0x80, 0xc9, 0xdd, 0xdb, 0xf0, 0xf3,
+  0xa6, 0xcd, 0x1f, 0x8c, 0xba, 0xac, 0xad, 0x8a, 0x06, 0xdb, 0x43, 0xc1,
+  0x46, 0x62, 0x52, 0xc9, 0xab, 0x7f, 0xe5, 0xb3, 0x1b, 0xc3, 0x4d, 0x59,
+  0xa4, 0x41, 0x4e, 0x98, 0x5e, 0x00, 0xc2, 0x70, 0x4b, 0xb7, 0x8b, 0x18,
+  0x08, 0x4d, 0x52, 0x0b, 0x24, 0x07, 0x3f, 0xee, 0x67, 0x0f, 0x39, 0x46,
+  0x35, 0xf5, 0xf1, 0x2d, 0xd3, 0x10, 0xb3, 0xff, 0x62, 0xae, 0x86, 0xc7,
+  0xe6, 0xad, 0x53, 0x4d, 0x72, 0x29, 0xd7, 0x86, 0x7e, 0x5c, 0x34, 0x2e,
+  0x8b, 0x2d, 0x06, 0xf6, 0x92, 0xc4, 0x4d, 0xfe, 0xd3, 0x7c, 0x3f, 0x44,
+  0x2a, 0x7e, 0xc1, 0xba, 0x16, 0xff, 0xd0, 0xf0, 0xd8, 0xf6, 0xba, 0x37,
+  0xb8, 0x64, 0x48, 0x3d, 0x4b, 0xe9, 0x1d, 0xce, 0xd6, 0x9d, 0x00, 0xc0,
+  0xcc, 0xfc, 0x25, 0x80, 0x1b, 0x58, 0x47, 0xb6, 0x58, 0x9a, 0xe9, 0x4b,
+  0xc5, 0xa5, 0x02, 0x15, 0x8b, 0xcd, 0x72, 0x4b, 0x71, 0x50, 0xc0, 0xc2,
+  0x12, 0x87, 0x08, 0x5c, 0x9c, 0x81, 0xf7, 0xe3, 0x7d, 0xa8, 0xc0, 0xc3,
+  0xda, 0x6a, 0x45, 0xb9, 0x92, 0x1e, 0x94, 0xc4, 0xf1, 0x06, 0x63, 0x50,
+  0x5b, 0xbb, 0x17, 0xa6, 0x48, 0x36, 0x90, 0x60, 0xd4, 0xbd, 0x58, 0x10,
+  0xb5, 0x7b, 0xca, 0xcc, 0x1a, 0x13, 0xb4, 0xba, 0x78, 0xfa, 0xdb, 0xa8,
+  0x25, 0xd0, 0x2c, 0x0f, 0x08, 0x28, 0xe0, 0xc1, 0x9e, 0xdc, 0xb5, 0xfa,
+  0xd6, 0x6c, 0x63, 0x39, 0xef, 0x12, 0xa1, 0xfe, 0x8a, 0x74, 0xe7, 0x31,
+  0xc0, 0x0d, 0xdb, 0xb6, 0x16, 0x37, 0xd0, 0x93, 0xc2, 0x83, 0xef, 0xca,
+  0x2f, 0x45, 0x17, 0x0f, 0x5a, 0xb3, 0xb2, 0x29, 0xad, 0xf3, 0x66, 0x2e,
+  0x0e, 0xc4, 0x00, 0x52, 0xf7, 0x39, 0x09, 0x1c, 0xf8, 0xf7, 0x99, 0xe8,
+  0x28, 0x04, 0x87, 0x2d, 0x6c, 0xec, 0x7b, 0x4d, 0x90, 0xc2, 0x39, 0xde,
+  0xbd, 0xf9, 0x50, 0x26, 0x5d, 0x00, 0xf3, 0x20, 0x3f, 0x42, 0x49, 0x42,
+  0x20, 0x36, 0x3f, 0xe1, 0xbb, 0xd8, 0x5f, 0xac, 0x42, 0xa3, 0x67, 0x1d,
+  0xe0, 0x43, 0xe2, 0xfc, 0x42, 0x4d, 0x3f, 0xd1, 0x8b, 0xd3, 0xd4, 0xb9,
+  0xde, 0x2a, 0x08, 0x07, 0xf5, 0xb0, 0x9f, 0xb8, 0x2c, 0xd8, 0xf0, 0xe0,
+  0x00, 0xcb, 0xa4, 0xda, 0x61, 0x36, 0xa3, 0xae, 0x5d, 0x84, 0x04, 0xf9,
+  0xaf, 0x05, 0xf0, 0x59, 0xbc, 0x6c, 0x3c, 0xdb, 0xce, 0x28, 0xd4, 0xa0,
+  0x39, 0x0a, 0xb5, 0x52, 0xe3, 0x35, 0x48, 0x15, 0x4a, 0xb1, 0x36, 0x1a,
+  0x31, 0x3b, 0x2a, 0x13, 0x94, 0xc1, 0x1f, 0x09, 0xfc, 0x4b, 0x41, 0x8c,
+  0x96, 0x64, 0xf1, 0x00, 0x00, 0x00, 0x11, 0x00, 0x23, 0x00, 0x37, 0x00,
+  0x49, 0x00, 0x5b, 0x00, 0x6d, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1d, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1d, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1e, 0x00, 0x2d, 0x00, 0x3c, 0x00,
+  0x4b, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1e, 0x00, 0x2d, 0x00, 0x3c, 0x00,
+  0x4b, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x11, 0x00,
+  0x23, 0x00, 0x35, 0x00, 0x00, 0x00, 0x11, 0x00, 0x23, 0x00, 0x35, 0x00,
+  0x47, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x1e, 0x00, 0x2d, 0x00, 0x3c, 0x00, 0x4b, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x23, 0x00, 0x35, 0x00, 0x49, 0x00, 0x5b, 0x00, 0x6d, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x22, 0x00, 0x34, 0x00,
+  0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x25, 0x00,
+  0x37, 0x00, 0x4a, 0x00, 0x5c, 0x00, 0x6f, 0x00, 0x81, 0x00, 0x93, 0x00,
+  0xa5, 0x00, 0xb7, 0x00, 0xca, 0x00, 0xdc, 0x00, 0xee, 0x00, 0x01, 0x01,
+  0x13, 0x01, 0x25, 0x01, 0x38, 0x01, 0x4a, 0x01, 0x5c, 0x01, 0x6e, 0x01,
+  0x81, 0x01, 0x93, 0x01, 0xa5, 0x01, 0xb8, 0x01, 0xca, 0x01, 0xdc, 0x01,
+  0xef, 0x01, 0x01, 0x02, 0x13, 0x02, 0x26, 0x02, 0x38, 0x02, 0x4a, 0x02,
+  0x5d, 0x02, 0x6f, 0x02, 0x81, 0x02, 0x94, 0x02, 0xa6, 0x02, 0xb8, 0x02,
+  0x00, 0x00, 0x0f, 0x00, 0x22, 0x00, 0x34, 0x00, 0x46, 0x00, 0x58, 0x00,
+  0x6a, 0x00, 0x7d, 0x00, 0x8f, 0x00, 0xa1, 0x00, 0xb0, 0x00, 0xc2, 0x00,
+  0xd4, 0x00, 0xe6, 0x00, 0xf8, 0x00, 0x0a, 0x01, 0x19, 0x01, 0x2b, 0x01,
+  0x3d, 0x01, 0x4f, 0x01, 0x62, 0x01, 0x74, 0x01, 0x86, 0x01, 0x98, 0x01,
+  0xaa, 0x01, 0xbc, 0x01, 0xce, 0x01, 0xe1, 0x01, 0xf3, 0x01, 0x06, 0x02,
+  0x18, 0x02, 0x2a, 0x02, 0x3c, 0x02, 0x4e, 0x02, 0x60, 0x02, 0x6f, 0x02,
+  0x82, 0x02, 0x94, 0x02, 0xa6, 0x02, 0xb8, 0x02, 0xca, 0x02, 0xdc, 0x02,
+  0xee, 0x02, 0xfd, 0x02, 0x10, 0x03, 0x22, 0x03, 0x34, 0x03, 0x00, 0x00,
+  0x13, 0x00, 0x25, 0x00, 0x30, 0x00, 0x42, 0x00, 0x51, 0x00, 0x64, 0x00,
+  0x76, 0x00, 0x88, 0x00, 0x97, 0x00, 0xaa, 0x00, 0xbd, 0x00, 0xcf, 0x00,
+  0xe1, 0x00, 0xf4, 0x00, 0x06, 0x01, 0x11, 0x01, 0x24, 0x01, 0x36, 0x01,
+  0x48, 0x01, 0x5a, 0x01, 0x69, 0x01, 0x7b, 0x01, 0x8d, 0x01, 0x9c, 0x01,
+  0xaf, 0x01, 0xc1, 0x01, 0x00, 0x00, 0x15, 0x00, 0x2a, 0x00, 0x3f, 0x00,
+  0x54, 0x00, 0x69, 0x00, 0x7e, 0x00, 0x93, 0x00, 0xa8, 0x00, 0xbd, 0x00,
+  0xd2, 0x00, 0xe7, 0x00, 0xfc, 0x00, 0x11, 0x01, 0x26, 0x01, 0x3b, 0x01,
+  0x51, 0x01, 0x67, 0x01, 0x7d, 0x01, 0x93, 0x01, 0xa9, 0x01, 0xbf, 0x01,
+  0xd5, 0x01, 0xeb, 0x01, 0x01, 0x02, 0x17, 0x02, 0x2d, 0x02, 0x43, 0x02,
+  0x59, 0x02, 0x6f, 0x02, 0x85, 0x02, 0x9b, 0x02, 0xb1, 0x02, 0xc7, 0x02,
+  0xdd, 0x02, 0xf3, 0x02, 0x08, 0x03, 0x1e, 0x03, 0x34, 0x03, 0x4a, 0x03,
+  0x60, 0x03, 0x76, 0x03, 0x8c, 0x03, 0xa2, 0x03, 0xb8, 0x03, 0xce, 0x03,
+  0xe4, 0x03, 0xf9, 0x03, 0x0f, 0x04, 0x25, 0x04, 0x3b, 0x04, 0x51, 0x04,
+  0x67, 0x04, 0x7d, 0x04, 0x93, 0x04, 0xa9, 0x04, 0xbf, 0x04, 0xd5, 0x04,
+  0xeb, 0x04, 0x01, 0x05, 0x17, 0x05, 0x2d, 0x05, 0x43, 0x05, 0x59, 0x05,
+  0x6f, 0x05, 0x85, 0x05, 0x9b, 0x05, 0xb0, 0x05, 0xc6, 0x05, 0xdc, 0x05,
+  0xf2, 0x05, 0x08, 0x06, 0x1e, 0x06, 0x34, 0x06, 0x4a, 0x06, 0x60, 0x06,
+  0x76, 0x06, 0x8c, 0x06, 0xa2, 0x06, 0xb8, 0x06, 0xce, 0x06, 0xe3, 0x06,
+  0xf9, 0x06, 0x0f, 0x07, 0x25, 0x07, 0x3b, 0x07, 0x51, 0x07, 0x67, 0x07,
+  0x7d, 0x07, 0x93, 0x07, 0xa9, 0x07, 0xbf, 0x07, 0xd5, 0x07, 0xeb, 0x07,
+  0x01, 0x08, 0x17, 0x08, 0x2d, 0x08, 0x43, 0x08, 0x59, 0x08, 0x6f, 0x08,
+  0x85, 0x08, 0x9b, 0x08, 0xb1, 0x08, 0xc7, 0x08, 0xdd, 0x08, 0xf3, 0x08,
+  0x09, 0x09, 0x1f, 0x09, 0x35, 0x09, 0x4b, 0x09, 0x61, 0x09, 0x77, 0x09,
+  0x8d, 0x09, 0xa3, 0x09, 0xb9, 0x09, 0xcf, 0x09, 0xe5, 0x09, 0xfb, 0x09,
+  0x11, 0x0a, 0x27, 0x0a, 0x3d, 0x0a, 0x53, 0x0a, 0x69, 0x0a, 0x7f, 0x0a,
+  0x95, 0x0a, 0xab, 0x0a, 0xc1, 0x0a, 0xd7, 0x0a, 0xed, 0x0a, 0x03, 0x0b,
+  0x19, 0x0b, 0x2f, 0x0b, 0x45, 0x0b, 0x5b, 0x0b, 0x71, 0x0b, 0x87, 0x0b,
+  0x9d, 0x0b, 0xb3, 0x0b, 0xc9, 0x0b, 0xdf, 0x0b, 0xf4, 0x0b, 0x0a, 0x0c,
+  0x20, 0x0c, 0x36, 0x0c, 0x4c, 0x0c, 0x62, 0x0c, 0x78, 0x0c, 0x8e, 0x0c,
+  0xa4, 0x0c, 0xba, 0x0c, 0xd0, 0x0c, 0xe6, 0x0c, 0xfc, 0x0c, 0x12, 0x0d,
+  0x28, 0x0d, 0x3e, 0x0d, 0x54, 0x0d, 0x6a, 0x0d, 0x80, 0x0d, 0x96, 0x0d,
+  0xac, 0x0d, 0xc2, 0x0d, 0xd8, 0x0d, 0xee, 0x0d, 0x04, 0x0e, 0x19, 0x0e,
+  0x2f, 0x0e, 0x45, 0x0e, 0x5b, 0x0e, 0x71, 0x0e, 0x87, 0x0e, 0x9d, 0x0e,
+  0xb3, 0x0e, 0xc9, 0x0e, 0xdf, 0x0e, 0xf5, 0x0e, 0x0b, 0x0f, 0x21, 0x0f,
+  0x37, 0x0f, 0x4d, 0x0f, 0x63, 0x0f, 0x72, 0x0f, 0x87, 0x0f, 0x9d, 0x0f,
+  0xb3, 0x0f, 0xc9, 0x0f, 0xdf, 0x0f, 0xf5, 0x0f, 0x0b, 0x10, 0x21, 0x10,
+  0x37, 0x10, 0x4d, 0x10, 0x63, 0x10, 0x79, 0x10, 0x8f, 0x10, 0xa5, 0x10,
+  0xbb, 0x10, 0xd1, 0x10, 0xe7, 0x10, 0xfd, 0x10, 0x13, 0x11, 0x29, 0x11,
+  0x3f, 0x11, 0x55, 0x11, 0x6b, 0x11, 0x80, 0x11, 0x96, 0x11, 0xac, 0x11,
+  0xc2, 0x11, 0xd8, 0x11, 0xee, 0x11, 0x04, 0x12, 0x1a, 0x12, 0x30, 0x12,
+  0x46, 0x12, 0x5c, 0x12, 0x72, 0x12, 0x88, 0x12, 0x9e, 0x12, 0xb4, 0x12,
+  0xca, 0x12, 0xe0, 0x12, 0xf6, 0x12, 0x0c, 0x13, 0x1b, 0x13, 0x30, 0x13,
+  0x46, 0x13, 0x5c, 0x13, 0x72, 0x13, 0x88, 0x13, 0x9e, 0x13, 0xb4, 0x13,
+  0xca, 0x13, 0xe0, 0x13, 0xf6, 0x13, 0x0c, 0x14, 0x22, 0x14, 0x38, 0x14,
+  0x4e, 0x14, 0x64, 0x14, 0x7a, 0x14, 0x90, 0x14, 0x00, 0x00, 0x15, 0x00,
+  0x2a, 0x00, 0x3f, 0x00, 0x54, 0x00, 0x69, 0x00, 0x7e, 0x00, 0x93, 0x00,
+  0xa8, 0x00, 0xbd, 0x00, 0xd2, 0x00, 0xe8, 0x00, 0xfe, 0x00, 0x14, 0x01,
+  0x2a, 0x01, 0x40, 0x01, 0x56, 0x01, 0x6c, 0x01, 0x82, 0x01, 0x98, 0x01,
+  0xae, 0x01, 0xc4, 0x01, 0xda, 0x01, 0xf0, 0x01, 0x06, 0x02, 0x1b, 0x02,
+  0x31, 0x02, 0x47, 0x02, 0x5d, 0x02, 0x73, 0x02, 0x89, 0x02, 0x9f, 0x02,
+  0xb5, 0x02, 0xcb, 0x02, 0xe1, 0x02, 0xf7, 0x02, 0x0d, 0x03, 0x23, 0x03,
+  0x38, 0x03, 0x4e, 0x03, 0x64, 0x03, 0x7a, 0x03, 0x90, 0x03, 0xa6, 0x03,
+  0xbc, 0x03, 0xd2, 0x03, 0xdd, 0x03, 0xf3, 0x03, 0x09, 0x04, 0x1f, 0x04,
+  0x35, 0x04, 0x4b, 0x04, 0x61, 0x04, 0x77, 0x04, 0x8c, 0x04, 0xa2, 0x04,
+  0xb8, 0x04, 0xce, 0x04, 0xe4, 0x04, 0xfa, 0x04, 0x10, 0x05, 0x26, 0x05,
+  0x3c, 0x05, 0x52, 0x05, 0x68, 0x05, 0x7e, 0x05, 0x94, 0x05, 0xa9, 0x05,
+  0xbf, 0x05, 0xd5, 0x05, 0xeb, 0x05, 0x01, 0x06, 0x17, 0x06, 0x2d, 0x06,
+  0x43, 0x06, 0x59, 0x06, 0x6f, 0x06, 0x85, 0x06, 0x9b, 0x06, 0xb0, 0x06,
+  0xc6, 0x06, 0xdc, 0x06, 0xf2, 0x06, 0x08, 0x07, 0x1e, 0x07, 0x34, 0x07,
+  0x49, 0x07, 0x5f, 0x07, 0x75, 0x07, 0x8b, 0x07, 0xa1, 0x07, 0xb7, 0x07,
+  0xcd, 0x07, 0xe3, 0x07, 0xf9, 0x07, 0x0f, 0x08, 0x25, 0x08, 0x3b, 0x08,
+  0x51, 0x08, 0x67, 0x08, 0x7d, 0x08, 0x93, 0x08, 0x9e, 0x08, 0xb4, 0x08,
+  0xca, 0x08, 0xe0, 0x08, 0xf5, 0x08, 0x0b, 0x09, 0x21, 0x09, 0x37, 0x09,
+  0x4d, 0x09, 0x63, 0x09, 0x79, 0x09, 0x8f, 0x09, 0xa5, 0x09, 0xbb, 0x09,
+  0xd1, 0x09, 0xe7, 0x09, 0xfd, 0x09, 0x13, 0x0a, 0x29, 0x0a, 0x3f, 0x0a,
+  0x55, 0x0a, 0x6b, 0x0a, 0x81, 0x0a, 0x97, 0x0a, 0xad, 0x0a, 0xc3, 0x0a,
+  0xd9, 0x0a, 0xef, 0x0a, 0x05, 0x0b, 0x1b, 0x0b, 0x31, 0x0b, 0x47, 0x0b,
+  0x5d, 0x0b, 0x73, 0x0b, 0x89, 0x0b, 0x9f, 0x0b, 0xb5, 0x0b, 0xca, 0x0b,
+  0xe0, 0x0b, 0xf6, 0x0b, 0x0c, 0x0c, 0x22, 0x0c, 0x38, 0x0c, 0x4e, 0x0c,
+  0x64, 0x0c, 0x7a, 0x0c, 0x90, 0x0c, 0xa6, 0x0c, 0xbc, 0x0c, 0xd2, 0x0c,
+  0xe8, 0x0c, 0xfe, 0x0c, 0x14, 0x0d, 0x2a, 0x0d, 0x40, 0x0d, 0x56, 0x0d,
+  0x6c, 0x0d, 0x82, 0x0d, 0x98, 0x0d, 0xae, 0x0d, 0xc4, 0x0d, 0xda, 0x0d,
+  0xf0, 0x0d, 0x06, 0x0e, 0x1c, 0x0e, 0x32, 0x0e, 0x48, 0x0e, 0x5e, 0x0e,
+  0x74, 0x0e, 0x8a, 0x0e, 0xa0, 0x0e, 0xb6, 0x0e, 0xcc, 0x0e, 0xe2, 0x0e,
+  0xf8, 0x0e, 0x0d, 0x0f, 0x22, 0x0f, 0x38, 0x0f, 0x4e, 0x0f, 0x64, 0x0f,
+  0x7a, 0x0f, 0x90, 0x0f, 0xa6, 0x0f, 0xbc, 0x0f, 0xd2, 0x0f, 0xe8, 0x0f,
+  0xfe, 0x0f, 0x14, 0x10, 0x2a, 0x10, 0x40, 0x10, 0x56, 0x10, 0x6b, 0x10,
+  0x81, 0x10, 0x97, 0x10, 0xad, 0x10, 0xc3, 0x10, 0xd9, 0x10, 0xef, 0x10,
+  0x05, 0x11, 0x1b, 0x11, 0x31, 0x11, 0x47, 0x11, 0x5d, 0x11, 0x73, 0x11,
+  0x89, 0x11, 0x00, 0x00, 0x15, 0x00, 0x2a, 0x00, 0x34, 0x00, 0x49, 0x00,
+  0x5f, 0x00, 0x75, 0x00, 0x8b, 0x00, 0xa1, 0x00, 0xb7, 0x00, 0xcd, 0x00,
+  0xe3, 0x00, 0xf9, 0x00, 0x0f, 0x01, 0x25, 0x01, 0x3b, 0x01, 0x51, 0x01,
+  0x67, 0x01, 0x7d, 0x01, 0x93, 0x01, 0xa9, 0x01, 0xbf, 0x01, 0xd2, 0x01,
+  0xe8, 0x01, 0xfe, 0x01, 0x14, 0x02, 0x2a, 0x02, 0x40, 0x02, 0x56, 0x02,
+  0x6c, 0x02, 0x82, 0x02, 0x8d, 0x02, 0xa3, 0x02, 0xb9, 0x02, 0xcf, 0x02,
+  0xe5, 0x02, 0xfb, 0x02, 0x11, 0x03, 0x27, 0x03, 0x3d, 0x03, 0x53, 0x03,
+  0x69, 0x03, 0x7f, 0x03, 0x95, 0x03, 0xab, 0x03, 0xc1, 0x03, 0xd7, 0x03,
+  0xed, 0x03, 0x03, 0x04, 0x18, 0x04, 0x2e, 0x04, 0x44, 0x04, 0x5a, 0x04,
+  0x70, 0x04, 0x86, 0x04, 0x9c, 0x04, 0xb2, 0x04, 0xc8, 0x04, 0xde, 0x04,
+  0xf4, 0x04, 0x0a, 0x05, 0x20, 0x05, 0x36, 0x05, 0x4c, 0x05, 0x62, 0x05,
+  0x78, 0x05, 0x8e, 0x05, 0xa4, 0x05, 0xaf, 0x05, 0xc4, 0x05, 0xda, 0x05,
+  0xf0, 0x05, 0x06, 0x06, 0x1c, 0x06, 0x32, 0x06, 0x48, 0x06, 0x5e, 0x06,
+  0x74, 0x06, 0x8a, 0x06, 0xa0, 0x06, 0xb6, 0x06, 0xcc, 0x06, 0xe2, 0x06,
+  0xf8, 0x06, 0x0e, 0x07, 0x24, 0x07, 0x3a, 0x07, 0x50, 0x07, 0x66, 0x07,
+  0x7b, 0x07, 0x91, 0x07, 0xa7, 0x07, 0xbd, 0x07, 0xd3, 0x07, 0xe9, 0x07,
+  0xff, 0x07, 0x15, 0x08, 0x2b, 0x08, 0x41, 0x08, 0x57, 0x08, 0x6d, 0x08,
+  0x83, 0x08, 0x99, 0x08, 0xaf, 0x08, 0x00, 0x00, 0x18, 0x00, 0x30, 0x00,
+  0x3a, 0x00, 0x53, 0x00, 0x6c, 0x00, 0x85, 0x00, 0x9e, 0x00, 0xb7, 0x00,
+  0xd0, 0x00, 0xe9, 0x00, 0x02, 0x01, 0x1b, 0x01, 0x34, 0x01, 0x4d, 0x01,
+  0x66, 0x01, 0x7f, 0x01, 0x98, 0x01, 0xb1, 0x01, 0xbc, 0x01, 0xd5, 0x01,
+  0xee, 0x01, 0x07, 0x02, 0x20, 0x02, 0x39, 0x02, 0x52, 0x02, 0x6b, 0x02,
+  0x84, 0x02, 0x9d, 0x02, 0xb6, 0x02, 0xcf, 0x02, 0xe8, 0x02, 0x01, 0x03,
+  0x1a, 0x03, 0x33, 0x03, 0x4c, 0x03, 0x65, 0x03, 0x7e, 0x03, 0x89, 0x03,
+  0xa2, 0x03, 0xbb, 0x03, 0xd4, 0x03, 0xed, 0x03, 0x06, 0x04, 0x1f, 0x04,
+  0x38, 0x04, 0x51, 0x04, 0x6a, 0x04, 0x83, 0x04, 0x9c, 0x04, 0xb5, 0x04,
+  0xce, 0x04, 0x00, 0x00, 0x18, 0x00, 0x30, 0x00, 0x49, 0x00, 0x62, 0x00,
+  0x7b, 0x00, 0x94, 0x00, 0xad, 0x00, 0xc6, 0x00, 0xdf, 0x00, 0xf8, 0x00,
+  0x11, 0x01, 0x2a, 0x01, 0x43, 0x01, 0x5c, 0x01, 0x75, 0x01, 0x8e, 0x01,
+  0xa7, 0x01, 0xc0, 0x01, 0xd9, 0x01, 0xf2, 0x01, 0x0b, 0x02, 0x24, 0x02,
+  0x3d, 0x02, 0x56, 0x02, 0x6f, 0x02, 0x88, 0x02, 0xa1, 0x02, 0xba, 0x02,
+  0xd3, 0x02, 0xec, 0x02, 0x05, 0x03, 0x00, 0x00, 0x0a, 0x00, 0x19, 0x00,
+  0x32, 0x00, 0x4b, 0x00, 0x64, 0x00, 0x7d, 0x00, 0x8c, 0x00, 0x97, 0x00,
+  0xa6, 0x00, 0xbf, 0x00, 0xce, 0x00, 0xe7, 0x00, 0x00, 0x01, 0x19, 0x01,
+  0x32, 0x01, 0x4b, 0x01, 0x64, 0x01, 0x7d, 0x01, 0x96, 0x01, 0xa1, 0x01,
+  0xb0, 0x01, 0xc9, 0x01, 0xe2, 0x01, 0xf1, 0x01, 0x00, 0x00, 0x0b, 0x00,
+  0x00, 0x00, 0x0f, 0x00, 0x1e, 0x00, 0x2d, 0x00, 0x3c, 0x00, 0x4b, 0x00,
+  0x5a, 0x00, 0x69, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x1c, 0x00, 0x2b, 0x00,
+  0x3a, 0x00, 0x49, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1e, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x1e, 0x00, 0x2d, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x11, 0x00,
+  0x24, 0x00, 0x37, 0x00, 0x49, 0x00, 0x5c, 0x00, 0x6e, 0x00, 0x80, 0x00,
+  0x92, 0x00, 0xa5, 0x00, 0xb8, 0x00, 0xca, 0x00, 0xdd, 0x00, 0xf0, 0x00,
+  0x02, 0x01, 0x15, 0x01, 0x27, 0x01, 0x39, 0x01, 0x4c, 0x01, 0x5e, 0x01,
+  0x71, 0x01, 0x83, 0x01, 0x96, 0x01, 0xa8, 0x01, 0xba, 0x01, 0xc9, 0x01,
+  0xdb, 0x01, 0xed, 0x01, 0xff, 0x01, 0x11, 0x02, 0x23, 0x02, 0x35, 0x02,
+  0x48, 0x02, 0x5a, 0x02, 0x6c, 0x02, 0x00, 0x00, 0x13, 0x00, 0x26, 0x00,
+  0x39, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x15, 0x00,
+  0x2a, 0x00, 0x3f, 0x00, 0x54, 0x00, 0x69, 0x00, 0x7e, 0x00, 0x93, 0x00,
+  0xa8, 0x00, 0xbd, 0x00, 0xd2, 0x00, 0xe6, 0x00, 0xfa, 0x00, 0x0f, 0x01,
+  0x24, 0x01, 0x39, 0x01, 0x4e, 0x01, 0x63, 0x01, 0x78, 0x01, 0x8d, 0x01,
+  0xa3, 0x01, 0xb9, 0x01, 0xcf, 0x01, 0xe5, 0x01, 0xfb, 0x01, 0x11, 0x02,
+  0x27, 0x02, 0x3d, 0x02, 0x52, 0x02, 0x68, 0x02, 0x7e, 0x02, 0x94, 0x02,
+  0xaa, 0x02, 0xc0, 0x02, 0xd5, 0x02, 0xeb, 0x02, 0x01, 0x03, 0x17, 0x03,
+  0x2d, 0x03, 0x43, 0x03, 0x59, 0x03, 0x6f, 0x03, 0x85, 0x03, 0x9b, 0x03,
+  0xb0, 0x03, 0xc6, 0x03, 0xdc, 0x03, 0xf2, 0x03, 0x08, 0x04, 0x1e, 0x04,
+  0x34, 0x04, 0x49, 0x04, 0x5f, 0x04, 0x75, 0x04, 0x8b, 0x04, 0xa1, 0x04,
+  0xb7, 0x04, 0xcd, 0x04, 0xe3, 0x04, 0xf9, 0x04, 0x0f, 0x05, 0x25, 0x05,
+  0x3a, 0x05, 0x4f, 0x05, 0x65, 0x05, 0x7b, 0x05, 0x91, 0x05, 0xa7, 0x05,
+  0xbd, 0x05, 0xd3, 0x05, 0xe8, 0x05, 0xfe, 0x05, 0x14, 0x06, 0x2a, 0x06,
+  0x40, 0x06, 0x56, 0x06, 0x6c, 0x06, 0x82, 0x06, 0x98, 0x06, 0xae, 0x06,
+  0xc4, 0x06, 0xda, 0x06, 0xf0, 0x06, 0x03, 0x07, 0x18, 0x07, 0x2e, 0x07,
+  0x44, 0x07, 0x5a, 0x07, 0x70, 0x07, 0x86, 0x07, 0x9c, 0x07, 0xb2, 0x07,
+  0xc8, 0x07, 0xde, 0x07, 0xf3, 0x07, 0x09, 0x08, 0x1f, 0x08, 0x35, 0x08,
+  0x4b, 0x08, 0x61, 0x08, 0x77, 0x08, 0x8d, 0x08, 0xa2, 0x08, 0xb8, 0x08,
+  0xce, 0x08, 0xe4, 0x08, 0xfa, 0x08, 0x10, 0x09, 0x26, 0x09, 0x3c, 0x09,
+  0x52, 0x09, 0x68, 0x09, 0x7e, 0x09, 0x94, 0x09, 0xaa, 0x09, 0xbf, 0x09,
+  0xd5, 0x09, 0xeb, 0x09, 0x01, 0x0a, 0x17, 0x0a, 0x2d, 0x0a, 0x42, 0x0a,
+  0x58, 0x0a, 0x6e, 0x0a, 0x84, 0x0a, 0x9a, 0x0a, 0xb0, 0x0a, 0xc6, 0x0a,
+  0xdc, 0x0a, 0xf2, 0x0a, 0x08, 0x0b, 0x1e, 0x0b, 0x34, 0x0b, 0x4a, 0x0b,
+  0x60, 0x0b, 0x76, 0x0b, 0x8c, 0x0b, 0xa2, 0x0b, 0xb8, 0x0b, 0xce, 0x0b,
+  0xe4, 0x0b, 0xf9, 0x0b, 0x0f, 0x0c, 0x25, 0x0c, 0x3b, 0x0c, 0x51, 0x0c,
+  0x67, 0x0c, 0x7d, 0x0c, 0x93, 0x0c, 0xa9, 0x0c, 0xbf, 0x0c, 0xd5, 0x0c,
+  0xeb, 0x0c, 0x01, 0x0d, 0x17, 0x0d, 0x2d, 0x0d, 0x43, 0x0d, 0x59, 0x0d,
+  0x6f, 0x0d, 0x85, 0x0d, 0x9b, 0x0d, 0xb1, 0x0d, 0xc7, 0x0d, 0xdd, 0x0d,
+  0xf3, 0x0d, 0x09, 0x0e, 0x1e, 0x0e, 0x34, 0x0e, 0x4a, 0x0e, 0x60, 0x0e,
+  0x76, 0x0e, 0x8c, 0x0e, 0xa2, 0x0e, 0xb8, 0x0e, 0xce, 0x0e, 0xe4, 0x0e,
+  0xfa, 0x0e, 0x0f, 0x0f, 0x25, 0x0f, 0x3b, 0x0f, 0x51, 0x0f, 0x67, 0x0f,
+  0x7d, 0x0f, 0x93, 0x0f, 0xa9, 0x0f, 0xbf, 0x0f, 0xd5, 0x0f, 0xeb, 0x0f,
+  0x01, 0x10, 0x17, 0x10, 0x2d, 0x10, 0x43, 0x10, 0x59, 0x10, 0x6f, 0x10,
+  0x85, 0x10, 0x9b, 0x10, 0xae, 0x10, 0xc4, 0x10, 0xda, 0x10, 0xf0, 0x10,
+  0x06, 0x11, 0x1c, 0x11, 0x32, 0x11, 0x48, 0x11, 0x5e, 0x11, 0x74, 0x11,
+  0x8a, 0x11, 0xa0, 0x11, 0xb6, 0x11, 0xcc, 0x11, 0xe2, 0x11, 0xf8, 0x11,
+  0x0e, 0x12, 0x24, 0x12, 0x3a, 0x12, 0x50, 0x12, 0x66, 0x12, 0x7b, 0x12,
+  0x90, 0x12, 0xa6, 0x12, 0xbc, 0x12, 0xd2, 0x12, 0xe8, 0x12, 0xfe, 0x12,
+  0x14, 0x13, 0x2a, 0x13, 0x40, 0x13, 0x56, 0x13, 0x6c, 0x13, 0x82, 0x13,
+  0x98, 0x13, 0xad, 0x13, 0xc3, 0x13, 0xd9, 0x13, 0xef, 0x13, 0x05, 0x14,
+  0x1b, 0x14, 0x31, 0x14, 0x47, 0x14, 0x5d, 0x14, 0x70, 0x14, 0x85, 0x14,
+  0x9b, 0x14, 0xb1, 0x14, 0xc7, 0x14, 0xdd, 0x14, 0xf3, 0x14, 0x09, 0x15,
+  0x1f, 0x15, 0x35, 0x15, 0x4b, 0x15, 0x61, 0x15, 0x77, 0x15, 0x8d, 0x15,
+  0xa2, 0x15, 0xb8, 0x15, 0xce, 0x15, 0xe4, 0x15, 0xfa, 0x15, 0x10, 0x16,
+  0x26, 0x16, 0x3c, 0x16, 0x00, 0x00, 0x15, 0x00, 0x2a, 0x00, 0x3e, 0x00,
+  0x53, 0x00, 0x68, 0x00, 0x7e, 0x00, 0x94, 0x00, 0xaa, 0x00, 0xbf, 0x00,
+  0xd4, 0x00, 0xea, 0x00, 0x00, 0x01, 0x15, 0x01, 0x2a, 0x01, 0x40, 0x01,
+  0x55, 0x01, 0x6a, 0x01, 0x7f, 0x01, 0x95, 0x01, 0xaa, 0x01, 0xbf, 0x01,
+  0xd4, 0x01, 0xe9, 0x01, 0x00, 0x00, 0x15, 0x00, 0x29, 0x00, 0x3e, 0x00,
+  0x53, 0x00, 0x68, 0x00, 0x7e, 0x00, 0x94, 0x00, 0xaa, 0x00, 0xbf, 0x00,
+  0xd5, 0x00, 0xeb, 0x00, 0x01, 0x01, 0x16, 0x01, 0x2c, 0x01, 0x42, 0x01,
+  0x57, 0x01, 0x6c, 0x01, 0x81, 0x01, 0x00, 0x00, 0x18, 0x00, 0x30, 0x00,
+  0x48, 0x00, 0x60, 0x00, 0x78, 0x00, 0x91, 0x00, 0xaa, 0x00, 0xc3, 0x00,
+  0xdc, 0x00, 0xf5, 0x00, 0x0e, 0x01, 0x24, 0x01, 0x39, 0x01, 0x52, 0x01,
+  0x6b, 0x01, 0x84, 0x01, 0x9d, 0x01, 0xb6, 0x01, 0xcc, 0x01, 0xe5, 0x01,
+  0xfa, 0x01, 0x13, 0x02, 0x2c, 0x02, 0x45, 0x02, 0x5e, 0x02, 0x77, 0x02,
+  0x90, 0x02, 0xa9, 0x02, 0xbe, 0x02, 0xd7, 0x02, 0xf0, 0x02, 0x09, 0x03,
+  0x22, 0x03, 0x3b, 0x03, 0x54, 0x03, 0x6d, 0x03, 0x82, 0x03, 0x9b, 0x03,
+  0xb4, 0x03, 0xcd, 0x03, 0xe6, 0x03, 0xff, 0x03, 0x18, 0x04, 0x31, 0x04,
+  0x4a, 0x04, 0x63, 0x04, 0x7c, 0x04, 0x95, 0x04, 0xaf, 0x04, 0xc8, 0x04,
+  0xe2, 0x04, 0xfb, 0x04, 0x14, 0x05, 0x2d, 0x05, 0x42, 0x05, 0x00, 0x00,
+  0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00,
+  0x23, 0x00, 0x35, 0x00, 0x48, 0x00, 0x5a, 0x00, 0x6c, 0x00, 0x7e, 0x00,
+  0x90, 0x00, 0xa2, 0x00, 0xb4, 0x00, 0xc6, 0x00, 0xd8, 0x00, 0xeb, 0x00,
+  0xfd, 0x00, 0x08, 0x01, 0x1a, 0x01, 0x2d, 0x01, 0x3f, 0x01, 0x52, 0x01,
+  0x64, 0x01, 0x00, 0x00, 0x11, 0x00, 0x23, 0x00, 0x35, 0x00, 0x47, 0x00,
+  0x59, 0x00, 0x6c, 0x00, 0x7e, 0x00, 0x90, 0x00, 0xa2, 0x00, 0xb4, 0x00,
+  0xc6, 0x00, 0xd8, 0x00, 0xea, 0x00, 0xfc, 0x00, 0x0e, 0x01, 0x21, 0x01,
+  0x33, 0x01, 0x45, 0x01, 0x57, 0x01, 0x69, 0x01, 0x7b, 0x01, 0x8d, 0x01,
+  0x9f, 0x01, 0xb1, 0x01, 0xc3, 0x01, 0x00, 0x00, 0x11, 0x00, 0x1b, 0x00,
+  0x26, 0x00, 0x38, 0x00, 0x4b, 0x00, 0x5d, 0x00, 0x6f, 0x00, 0x81, 0x00,
+  0x93, 0x00, 0xa5, 0x00, 0xb0, 0x00, 0xc3, 0x00, 0xd5, 0x00, 0xe0, 0x00,
+  0x00, 0x00, 0x16, 0x00, 0x2b, 0x00, 0x40, 0x00, 0x55, 0x00, 0x6a, 0x00,
+  0x7f, 0x00, 0x94, 0x00, 0xa9, 0x00, 0xb4, 0x00, 0xcb, 0x00, 0xe1, 0x00,
+  0xf7, 0x00, 0x0d, 0x01, 0x23, 0x01, 0x39, 0x01, 0x4f, 0x01, 0x65, 0x01,
+  0x7b, 0x01, 0x91, 0x01, 0xa7, 0x01, 0xbd, 0x01, 0xd3, 0x01, 0xe9, 0x01,
+  0xff, 0x01, 0x15, 0x02, 0x2b, 0x02, 0x42, 0x02, 0x58, 0x02, 0x6e, 0x02,
+  0x84, 0x02, 0x9a, 0x02, 0xb0, 0x02, 0xc6, 0x02, 0xdc, 0x02, 0xf2, 0x02,
+  0x08, 0x03, 0x1e, 0x03, 0x34, 0x03, 0x4a, 0x03, 0x60, 0x03, 0x76, 0x03,
+  0x8d, 0x03, 0xa3, 0x03, 0xb9, 0x03, 0xcf, 0x03, 0xe5, 0x03, 0xfb, 0x03,
+  0x11, 0x04, 0x27, 0x04, 0x3d, 0x04, 0x53, 0x04, 0x69, 0x04, 0x7f, 0x04,
+  0x95, 0x04, 0xab, 0x04, 0xc1, 0x04, 0xd7, 0x04, 0xed, 0x04, 0x03, 0x05,
+  0x19, 0x05, 0x2f, 0x05, 0x45, 0x05, 0x5b, 0x05, 0x71, 0x05, 0x87, 0x05,
+  0x9d, 0x05, 0xb3, 0x05, 0xc9, 0x05, 0xe0, 0x05, 0xf6, 0x05, 0x0c, 0x06,
+  0x22, 0x06, 0x38, 0x06, 0x4e, 0x06, 0x64, 0x06, 0x7a, 0x06, 0x90, 0x06,
+  0xa6, 0x06, 0xbc, 0x06, 0xd2, 0x06, 0xe8, 0x06, 0xfe, 0x06, 0x14, 0x07,
+  0x2a, 0x07, 0x40, 0x07, 0x56, 0x07, 0x6c, 0x07, 0x82, 0x07, 0x98, 0x07,
+  0xae, 0x07, 0xc4, 0x07, 0xda, 0x07, 0xf0, 0x07, 0x06, 0x08, 0x1d, 0x08,
+  0x33, 0x08, 0x49, 0x08, 0x5f, 0x08, 0x75, 0x08, 0x8b, 0x08, 0xa1, 0x08,
+  0xb7, 0x08, 0xcd, 0x08, 0xe3, 0x08, 0xf9, 0x08, 0x0f, 0x09, 0x25, 0x09,
+  0x3c, 0x09, 0x52, 0x09, 0x68, 0x09, 0x7e, 0x09, 0x94, 0x09, 0xaa, 0x09,
+  0xc0, 0x09, 0xd6, 0x09, 0xec, 0x09, 0x02, 0x0a, 0x18, 0x0a, 0x2e, 0x0a,
+  0x44, 0x0a, 0x5a, 0x0a, 0x70, 0x0a, 0x86, 0x0a, 0x9c, 0x0a, 0xb2, 0x0a,
+  0xc8, 0x0a, 0xde, 0x0a, 0xf4, 0x0a, 0x0a, 0x0b, 0x21, 0x0b, 0x37, 0x0b,
+  0x4d, 0x0b, 0x63, 0x0b, 0x79, 0x0b, 0x8f, 0x0b, 0xa5, 0x0b, 0xbc, 0x0b,
+  0xd2, 0x0b, 0xe8, 0x0b, 0xfe, 0x0b, 0x14, 0x0c, 0x2a, 0x0c, 0x40, 0x0c,
+  0x56, 0x0c, 0x6c, 0x0c, 0x82, 0x0c, 0x98, 0x0c, 0xaf, 0x0c, 0xc5, 0x0c,
+  0xdb, 0x0c, 0xf1, 0x0c, 0x07, 0x0d, 0x1d, 0x0d, 0x33, 0x0d, 0x49, 0x0d,
+  0x5f, 0x0d, 0x00, 0x00, 0x16, 0x00, 0x2b, 0x00, 0x40, 0x00, 0x55, 0x00,
+  0x6a, 0x00, 0x7f, 0x00, 0x94, 0x00, 0xa9, 0x00, 0xbe, 0x00, 0xd3, 0x00,
+  0xe8, 0x00, 0xff, 0x00, 0x15, 0x01, 0x2b, 0x01, 0x41, 0x01, 0x57, 0x01,
+  0x6d, 0x01, 0x78, 0x01, 0x8e, 0x01, 0xa5, 0x01, 0xbb, 0x01, 0xd1, 0x01,
+  0xe7, 0x01, 0xfd, 0x01, 0x13, 0x02, 0x29, 0x02, 0x3f, 0x02, 0x55, 0x02,
+  0x6b, 0x02, 0x81, 0x02, 0x97, 0x02, 0xad, 0x02, 0xc3, 0x02, 0xd9, 0x02,
+  0xf0, 0x02, 0x06, 0x03, 0x1c, 0x03, 0x32, 0x03, 0x48, 0x03, 0x5e, 0x03,
+  0x74, 0x03, 0x8a, 0x03, 0xa0, 0x03, 0xb7, 0x03, 0xcd, 0x03, 0xe3, 0x03,
+  0xf9, 0x03, 0x0f, 0x04, 0x25, 0x04, 0x3b, 0x04, 0x51, 0x04, 0x67, 0x04,
+  0x7d, 0x04, 0x94, 0x04, 0xaa, 0x04, 0xc0, 0x04, 0xd6, 0x04, 0xec, 0x04,
+  0x02, 0x05, 0x18, 0x05, 0x2e, 0x05, 0x44, 0x05, 0x5a, 0x05, 0x70, 0x05,
+  0x86, 0x05, 0x9c, 0x05, 0xb2, 0x05, 0xc9, 0x05, 0xdf, 0x05, 0xf5, 0x05,
+  0x0b, 0x06, 0x21, 0x06, 0x37, 0x06, 0x4d, 0x06, 0x63, 0x06, 0x7a, 0x06,
+  0x90, 0x06, 0xa6, 0x06, 0xbc, 0x06, 0xd2, 0x06, 0xe9, 0x06, 0xff, 0x06,
+  0x15, 0x07, 0x2b, 0x07, 0x41, 0x07, 0x57, 0x07, 0x6d, 0x07, 0x83, 0x07,
+  0x99, 0x07, 0xaf, 0x07, 0xc5, 0x07, 0xdb, 0x07, 0xf1, 0x07, 0x07, 0x08,
+  0x1d, 0x08, 0x33, 0x08, 0x49, 0x08, 0x60, 0x08, 0x76, 0x08, 0x8c, 0x08,
+  0xa2, 0x08, 0xb8, 0x08, 0xcf, 0x08, 0xe5, 0x08, 0xfb, 0x08, 0x11, 0x09,
+  0x27, 0x09, 0x3d, 0x09, 0x53, 0x09, 0x6a, 0x09, 0x80, 0x09, 0x96, 0x09,
+  0xac, 0x09, 0xc2, 0x09, 0xd8, 0x09, 0xee, 0x09, 0x00, 0x00, 0x16, 0x00,
+  0x2b, 0x00, 0x41, 0x00, 0x57, 0x00, 0x6d, 0x00, 0x83, 0x00, 0x99, 0x00,
+  0xaf, 0x00, 0xc6, 0x00, 0xdc, 0x00, 0xf2, 0x00, 0x08, 0x01, 0x1e, 0x01,
+  0x34, 0x01, 0x4a, 0x01, 0x60, 0x01, 0x76, 0x01, 0x8c, 0x01, 0xa2, 0x01,
+  0xb8, 0x01, 0xce, 0x01, 0xe4, 0x01, 0xfa, 0x01, 0x10, 0x02, 0x26, 0x02,
+  0x3c, 0x02, 0x52, 0x02, 0x68, 0x02, 0x7e, 0x02, 0x89, 0x02, 0x9f, 0x02,
+  0xb5, 0x02, 0xcb, 0x02, 0xe1, 0x02, 0xf7, 0x02, 0x0d, 0x03, 0x23, 0x03,
+  0x3a, 0x03, 0x50, 0x03, 0x66, 0x03, 0x7c, 0x03, 0x92, 0x03, 0xa8, 0x03,
+  0xbe, 0x03, 0xc9, 0x03, 0xe0, 0x03, 0xf6, 0x03, 0x0c, 0x04, 0x22, 0x04,
+  0x38, 0x04, 0x4e, 0x04, 0x64, 0x04, 0x7a, 0x04, 0x85, 0x04, 0x9b, 0x04,
+  0xb1, 0x04, 0xc7, 0x04, 0x00, 0x00, 0x18, 0x00, 0x31, 0x00, 0x4a, 0x00,
+  0x63, 0x00, 0x7c, 0x00, 0x95, 0x00, 0xae, 0x00, 0xc7, 0x00, 0xe0, 0x00,
+  0xf9, 0x00, 0x12, 0x01, 0x1d, 0x01, 0x36, 0x01, 0x4f, 0x01, 0x68, 0x01,
+  0x81, 0x01, 0x9a, 0x01, 0xb3, 0x01, 0xcc, 0x01, 0xe5, 0x01, 0xfe, 0x01,
+  0x17, 0x02, 0x31, 0x02, 0x4b, 0x02, 0x64, 0x02, 0x7d, 0x02, 0x96, 0x02,
+  0xaf, 0x02, 0xc8, 0x02, 0xe1, 0x02, 0xfa, 0x02, 0x13, 0x03, 0x2d, 0x03,
+  0x38, 0x03, 0x52, 0x03, 0x00, 0x00, 0x18, 0x00, 0x31, 0x00, 0x4a, 0x00,
+  0x63, 0x00, 0x7c, 0x00, 0x95, 0x00, 0xae, 0x00, 0xba, 0x00, 0xd3, 0x00,
+  0xec, 0x00, 0x05, 0x01, 0x1e, 0x01, 0x37, 0x01, 0x50, 0x01, 0x69, 0x01,
+  0x82, 0x01, 0x9b, 0x01, 0xb4, 0x01, 0xcd, 0x01, 0xe6, 0x01, 0xff, 0x01,
+  0x18, 0x02, 0x31, 0x02, 0x4a, 0x02, 0x63, 0x02, 0x7c, 0x02, 0x95, 0x02,
+  0xae, 0x02, 0xc7, 0x02, 0xe0, 0x02, 0xf9, 0x02, 0x00, 0x00, 0x0f, 0x00,
+  0x28, 0x00, 0x38, 0x00, 0x51, 0x00, 0x6a, 0x00, 0x7a, 0x00, 0x93, 0x00,
+  0xac, 0x00, 0xbb, 0x00, 0xc6, 0x00, 0xd5, 0x00, 0xe4, 0x00, 0xf3, 0x00,
+  0x0c, 0x01, 0x1b, 0x01, 0x34, 0x01, 0x4d, 0x01, 0x5c, 0x01, 0x6b, 0x01,
+  0x76, 0x01, 0x8f, 0x01, 0x00, 0x00, 0x0b, 0x00, 0x16, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x1d, 0x00, 0x2b, 0x00, 0x36, 0x00, 0x45, 0x00, 0x54, 0x00,
+  0x63, 0x00, 0x72, 0x00, 0x81, 0x00, 0x90, 0x00, 0x9f, 0x00, 0xae, 0x00,
+  0xbd, 0x00, 0xcc, 0x00, 0xdb, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1e, 0x00,
+  0x2d, 0x00, 0x3c, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1e, 0x00,
+  0x2d, 0x00, 0x3c, 0x00, 0x4b, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x12, 0x00,
+  0x24, 0x00, 0x35, 0x00, 0x47, 0x00, 0x59, 0x00, 0x6b, 0x00, 0x7d, 0x00,
+  0x8f, 0x00, 0xa2, 0x00, 0xb5, 0x00, 0xc7, 0x00, 0xd9, 0x00, 0xeb, 0x00,
+  0xfd, 0x00, 0x0f, 0x01, 0x1e, 0x01, 0x30, 0x01, 0x42, 0x01, 0x55, 0x01,
+  0x67, 0x01, 0x79, 0x01, 0x8d, 0x01, 0xa0, 0x01, 0xb3, 0x01, 0xc5, 0x01,
+  0xd7, 0x01, 0xe9, 0x01, 0xfb, 0x01, 0x0a, 0x02, 0x1d, 0x02, 0x30, 0x02,
+  0x44, 0x02, 0x53, 0x02, 0x66, 0x02, 0x78, 0x02, 0x8a, 0x02, 0x00, 0x00,
+  0x0a, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x12, 0x00, 0x21, 0x00, 0x31, 0x00,
+  0x43, 0x00, 0x53, 0x00, 0x66, 0x00, 0x75, 0x00, 0x84, 0x00, 0x93, 0x00,
+  0xa2, 0x00, 0xb1, 0x00, 0xc0, 0x00, 0xd3, 0x00, 0x00, 0x00, 0x16, 0x00,
+  0x2b, 0x00, 0x40, 0x00, 0x55, 0x00, 0x6a, 0x00, 0x7f, 0x00, 0x94, 0x00,
+  0xa9, 0x00, 0xbe, 0x00, 0xd3, 0x00, 0xe8, 0x00, 0xfd, 0x00, 0x12, 0x01,
+  0x26, 0x01, 0x3b, 0x01, 0x50, 0x01, 0x67, 0x01, 0x7d, 0x01, 0x93, 0x01,
+  0xa9, 0x01, 0xbf, 0x01, 0xd5, 0x01, 0xeb, 0x01, 0x01, 0x02, 0x17, 0x02,
+  0x2d, 0x02, 0x43, 0x02, 0x59, 0x02, 0x70, 0x02, 0x86, 0x02, 0x9c, 0x02,
+  0xb2, 0x02, 0xc8, 0x02, 0xde, 0x02, 0xf4, 0x02, 0x04, 0x03, 0x1a, 0x03,
+  0x30, 0x03, 0x46, 0x03, 0x5c, 0x03, 0x72, 0x03, 0x88, 0x03, 0x9e, 0x03,
+  0xb4, 0x03, 0xca, 0x03, 0xe0, 0x03, 0xf6, 0x03, 0x0c, 0x04, 0x22, 0x04,
+  0x38, 0x04, 0x4f, 0x04, 0x65, 0x04, 0x7b, 0x04, 0x91, 0x04, 0xa7, 0x04,
+  0xbd, 0x04, 0xd3, 0x04, 0xe9, 0x04, 0x00, 0x05, 0x16, 0x05, 0x2c, 0x05,
+  0x42, 0x05, 0x58, 0x05, 0x6e, 0x05, 0x84, 0x05, 0x9a, 0x05, 0xb0, 0x05,
+  0xc6, 0x05, 0xd5, 0x05, 0xeb, 0x05, 0x01, 0x06, 0x18, 0x06, 0x2e, 0x06,
+  0x44, 0x06, 0x5a, 0x06, 0x70, 0x06, 0x86, 0x06, 0x9c, 0x06, 0xb2, 0x06,
+  0xc7, 0x06, 0xdd, 0x06, 0xf3, 0x06, 0x02, 0x07, 0x19, 0x07, 0x2f, 0x07,
+  0x45, 0x07, 0x5b, 0x07, 0x71, 0x07, 0x87, 0x07, 0x9d, 0x07, 0xb3, 0x07,
+  0xc9, 0x07, 0xdf, 0x07, 0xf5, 0x07, 0x0b, 0x08, 0x1a, 0x08, 0x30, 0x08,
+  0x46, 0x08, 0x5c, 0x08, 0x72, 0x08, 0x81, 0x08, 0x98, 0x08, 0xae, 0x08,
+  0xc4, 0x08, 0xda, 0x08, 0xf0, 0x08, 0x06, 0x09, 0x1c, 0x09, 0x32, 0x09,
+  0x48, 0x09, 0x5e, 0x09, 0x6d, 0x09, 0x83, 0x09, 0x99, 0x09, 0xaf, 0x09,
+  0xc5, 0x09, 0xdb, 0x09, 0xf1, 0x09, 0x07, 0x0a, 0x1d, 0x0a, 0x33, 0x0a,
+  0x49, 0x0a, 0x58, 0x0a, 0x6e, 0x0a, 0x85, 0x0a, 0x9b, 0x0a, 0xb1, 0x0a,
+  0xc7, 0x0a, 0xdd, 0x0a, 0xf3, 0x0a, 0x09, 0x0b, 0x1f, 0x0b, 0x35, 0x0b,
+  0x4b, 0x0b, 0x61, 0x0b, 0x77, 0x0b, 0x8d, 0x0b, 0xa4, 0x0b, 0xba, 0x0b,
+  0xd0, 0x0b, 0xe6, 0x0b, 0xfc, 0x0b, 0x12, 0x0c, 0x28, 0x0c, 0x3e, 0x0c,
+  0x54, 0x0c, 0x6a, 0x0c, 0x79, 0x0c, 0x90, 0x0c, 0xa6, 0x0c, 0xbc, 0x0c,
+  0xd2, 0x0c, 0xe1, 0x0c, 0xf4, 0x0c, 0x0b, 0x0d, 0x21, 0x0d, 0x37, 0x0d,
+  0x4d, 0x0d, 0x63, 0x0d, 0x79, 0x0d, 0x8f, 0x0d, 0xa5, 0x0d, 0xba, 0x0d,
+  0xd0, 0x0d, 0xe7, 0x0d, 0xfd, 0x0d, 0x13, 0x0e, 0x29, 0x0e, 0x3f, 0x0e,
+  0x55, 0x0e, 0x6b, 0x0e, 0x81, 0x0e, 0x97, 0x0e, 0xad, 0x0e, 0xc3, 0x0e,
+  0xd9, 0x0e, 0x00, 0x00, 0x15, 0x00, 0x2b, 0x00, 0x41, 0x00, 0x57, 0x00,
+  0x67, 0x00, 0x7d, 0x00, 0x93, 0x00, 0xa3, 0x00, 0xb9, 0x00, 0xcf, 0x00,
+  0xdd, 0x00, 0xf2, 0x00, 0x01, 0x01, 0x17, 0x01, 0x26, 0x01, 0x3c, 0x01,
+  0x4b, 0x01, 0x59, 0x01, 0x6f, 0x01, 0x85, 0x01, 0x93, 0x01, 0xa8, 0x01,
+  0xbe, 0x01, 0x00, 0x00, 0x15, 0x00, 0x29, 0x00, 0x3f, 0x00, 0x55, 0x00,
+  0x6a, 0x00, 0x80, 0x00, 0x96, 0x00, 0xab, 0x00, 0xc1, 0x00, 0xd7, 0x00,
+  0xed, 0x00, 0x03, 0x01, 0x19, 0x01, 0x2e, 0x01, 0x44, 0x01, 0x5a, 0x01,
+  0x70, 0x01, 0x86, 0x01, 0x9b, 0x01, 0xb0, 0x01, 0x00, 0x00, 0x18, 0x00,
+  0x30, 0x00, 0x49, 0x00, 0x62, 0x00, 0x7b, 0x00, 0x94, 0x00, 0xad, 0x00,
+  0xc6, 0x00, 0xdf, 0x00, 0xf8, 0x00, 0x0d, 0x01, 0x26, 0x01, 0x3f, 0x01,
+  0x58, 0x01, 0x71, 0x01, 0x8a, 0x01, 0xa3, 0x01, 0xbd, 0x01, 0xd6, 0x01,
+  0xec, 0x01, 0x05, 0x02, 0x00, 0x00, 0x11, 0x00, 0x23, 0x00, 0x35, 0x00,
+  0x47, 0x00, 0x59, 0x00, 0x6b, 0x00, 0x7d, 0x00, 0x8f, 0x00, 0xa1, 0x00,
+  0xb3, 0x00, 0xc5, 0x00, 0xd7, 0x00, 0xe9, 0x00, 0xfb, 0x00, 0x0d, 0x01,
+  0x1f, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x29, 0x00,
+  0x3e, 0x00, 0x53, 0x00, 0x68, 0x00, 0x7d, 0x00, 0x92, 0x00, 0xa7, 0x00,
+  0xbc, 0x00, 0xd1, 0x00, 0xe7, 0x00, 0xfc, 0x00, 0x12, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x1a, 0x00, 0x29, 0x00, 0x34, 0x00,
+  0x43, 0x00, 0x4e, 0x00, 0x5d, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x0f, 0x00,
+  0x1e, 0x00, 0x2d, 0x00, 0x3c, 0x00, 0x4b, 0x00, 0x5a, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x21, 0x00, 0x33, 0x00, 0x45, 0x00, 0x57, 0x00,
+  0x69, 0x00, 0x7b, 0x00, 0x8d, 0x00, 0x9f, 0x00, 0xb1, 0x00, 0xc0, 0x00,
+  0xd2, 0x00, 0xe4, 0x00, 0xf7, 0x00, 0x09, 0x01, 0x00, 0x00, 0x11, 0x00,
+  0x22, 0x00, 0x35, 0x00, 0x47, 0x00, 0x59, 0x00, 0x6b, 0x00, 0x7d, 0x00,
+  0x8f, 0x00, 0xa2, 0x00, 0xb4, 0x00, 0xc6, 0x00, 0xd8, 0x00, 0xea, 0x00,
+  0xfd, 0x00, 0x0f, 0x01, 0x21, 0x01, 0x33, 0x01, 0x45, 0x01, 0x57, 0x01,
+  0x69, 0x01, 0x7c, 0x01, 0x8e, 0x01, 0xa0, 0x01, 0xb2, 0x01, 0xc4, 0x01,
+  0xcf, 0x01, 0xe1, 0x01, 0xf3, 0x01, 0x06, 0x02, 0x18, 0x02, 0x2a, 0x02,
+  0x3c, 0x02, 0x4e, 0x02, 0x61, 0x02, 0x73, 0x02, 0x85, 0x02, 0x97, 0x02,
+  0xa9, 0x02, 0xbc, 0x02, 0xce, 0x02, 0xe0, 0x02, 0xf3, 0x02, 0x05, 0x03,
+  0x17, 0x03, 0x29, 0x03, 0x3b, 0x03, 0x4d, 0x03, 0x5f, 0x03, 0x71, 0x03,
+  0x83, 0x03, 0x95, 0x03, 0xa7, 0x03, 0xb9, 0x03, 0xcb, 0x03, 0xde, 0x03,
+  0xf0, 0x03, 0x02, 0x04, 0x14, 0x04, 0x26, 0x04, 0x38, 0x04, 0x43, 0x04,
+  0x56, 0x04, 0x68, 0x04, 0x7a, 0x04, 0x8c, 0x04, 0x9e, 0x04, 0x00, 0x00,
+  0x0f, 0x00, 0x1e, 0x00, 0x2d, 0x00, 0x3c, 0x00, 0x48, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x21, 0x00, 0x32, 0x00, 0x44, 0x00, 0x55, 0x00, 0x66, 0x00,
+  0x78, 0x00, 0x89, 0x00, 0x9b, 0x00, 0xac, 0x00, 0xbe, 0x00, 0xcf, 0x00,
+  0xda, 0x00, 0xec, 0x00, 0xfd, 0x00, 0x0f, 0x01, 0x20, 0x01, 0x32, 0x01,
+  0x00, 0x00, 0x15, 0x00, 0x2a, 0x00, 0x37, 0x00, 0x4c, 0x00, 0x61, 0x00,
+  0x76, 0x00, 0x8b, 0x00, 0xa0, 0x00, 0xb5, 0x00, 0xca, 0x00, 0xdf, 0x00,
+  0xf4, 0x00, 0x09, 0x01, 0x1e, 0x01, 0x33, 0x01, 0x48, 0x01, 0x5d, 0x01,
+  0x72, 0x01, 0x88, 0x01, 0x9e, 0x01, 0xb4, 0x01, 0xca, 0x01, 0xe0, 0x01,
+  0xf6, 0x01, 0x0c, 0x02, 0x22, 0x02, 0x38, 0x02, 0x4e, 0x02, 0x64, 0x02,
+  0x7a, 0x02, 0x90, 0x02, 0xa6, 0x02, 0xbc, 0x02, 0xd2, 0x02, 0xe8, 0x02,
+  0xfe, 0x02, 0x14, 0x03, 0x2a, 0x03, 0x40, 0x03, 0x56, 0x03, 0x6b, 0x03,
+  0x7a, 0x03, 0x90, 0x03, 0xa6, 0x03, 0xbc, 0x03, 0xd2, 0x03, 0xe8, 0x03,
+  0xfe, 0x03, 0x14, 0x04, 0x2a, 0x04, 0x40, 0x04, 0x56, 0x04, 0x6c, 0x04,
+  0x82, 0x04, 0x98, 0x04, 0xae, 0x04, 0xc3, 0x04, 0xd9, 0x04, 0xe8, 0x04,
+  0xfe, 0x04, 0x14, 0x05, 0x2a, 0x05, 0x40, 0x05, 0x56, 0x05, 0x6c, 0x05,
+  0x82, 0x05, 0x98, 0x05, 0xae, 0x05, 0xc4, 0x05, 0xda, 0x05, 0xf0, 0x05,
+  0x06, 0x06, 0x1c, 0x06, 0x32, 0x06, 0x48, 0x06, 0x5e, 0x06, 0x74, 0x06,
+  0x89, 0x06, 0x9f, 0x06, 0xb5, 0x06, 0xc3, 0x06, 0xd9, 0x06, 0xef, 0x06,
+  0x05, 0x07, 0x1b, 0x07, 0x31, 0x07, 0x47, 0x07, 0x5d, 0x07, 0x73, 0x07,
+  0x89, 0x07, 0x9f, 0x07, 0xb5, 0x07, 0xcb, 0x07, 0xe1, 0x07, 0xf7, 0x07,
+  0x0c, 0x08, 0x22, 0x08, 0x38, 0x08, 0x4e, 0x08, 0x64, 0x08, 0x7a, 0x08,
+  0x90, 0x08, 0xa6, 0x08, 0xbc, 0x08, 0xd2, 0x08, 0xe8, 0x08, 0xfe, 0x08,
+  0x14, 0x09, 0x2a, 0x09, 0x40, 0x09, 0x56, 0x09, 0x6c, 0x09, 0x82, 0x09,
+  0x98, 0x09, 0xa7, 0x09, 0xbd, 0x09, 0xd3, 0x09, 0xe1, 0x09, 0xf7, 0x09,
+  0x0d, 0x0a, 0x23, 0x0a, 0x39, 0x0a, 0x4f, 0x0a, 0x65, 0x0a, 0x7a, 0x0a,
+  0x90, 0x0a, 0xa6, 0x0a, 0xb5, 0x0a, 0xcb, 0x0a, 0xe1, 0x0a, 0xf7, 0x0a,
+  0x0d, 0x0b, 0x23, 0x0b, 0x39, 0x0b, 0x47, 0x0b, 0x5d, 0x0b, 0x73, 0x0b,
+  0x89, 0x0b, 0x9f, 0x0b, 0xb5, 0x0b, 0xcb, 0x0b, 0xe1, 0x0b, 0xf7, 0x0b,
+  0x0d, 0x0c, 0x23, 0x0c, 0x39, 0x0c, 0x48, 0x0c, 0x5e, 0x0c, 0x74, 0x0c,
+  0x8a, 0x0c, 0xa0, 0x0c, 0xae, 0x0c, 0xc4, 0x0c, 0xda, 0x0c, 0xf0, 0x0c,
+  0x06, 0x0d, 0x1b, 0x0d, 0x31, 0x0d, 0x47, 0x0d, 0x5d, 0x0d, 0x73, 0x0d,
+  0x89, 0x0d, 0x9f, 0x0d, 0xb5, 0x0d, 0xcb, 0x0d, 0xe1, 0x0d, 0xf7, 0x0d,
+  0x0d, 0x0e, 0x23, 0x0e, 0x39, 0x0e, 0x4e, 0x0e, 0x64, 0x0e, 0x7a, 0x0e,
+  0x90, 0x0e, 0xa6, 0x0e, 0xbc, 0x0e, 0xd2, 0x0e, 0xe8, 0x0e, 0xfe, 0x0e,
+  0x14, 0x0f, 0x2a, 0x0f, 0x40, 0x0f, 0x56, 0x0f, 0x6c, 0x0f, 0x82, 0x0f,
+  0x98, 0x0f, 0xae, 0x0f, 0xc4, 0x0f, 0xda, 0x0f, 0xf0, 0x0f, 0x06, 0x10,
+  0x1c, 0x10, 0x32, 0x10, 0x48, 0x10, 0x5e, 0x10, 0x74, 0x10, 0x8a, 0x10,
+  0xa0, 0x10, 0xb6, 0x10, 0xcc, 0x10, 0xe2, 0x10, 0xf8, 0x10, 0x0e, 0x11,
+  0x23, 0x11, 0x39, 0x11, 0x4f, 0x11, 0x65, 0x11, 0x7b, 0x11, 0x91, 0x11,
+  0xa7, 0x11, 0xbd, 0x11, 0xd3, 0x11, 0xe9, 0x11, 0xff, 0x11, 0x15, 0x12,
+  0x2b, 0x12, 0x41, 0x12, 0x57, 0x12, 0x6d, 0x12, 0x82, 0x12, 0x98, 0x12,
+  0xae, 0x12, 0xc4, 0x12, 0xda, 0x12, 0xf0, 0x12, 0x06, 0x13, 0x1c, 0x13,
+  0x32, 0x13, 0x48, 0x13, 0x5e, 0x13, 0x74, 0x13, 0x8a, 0x13, 0xa0, 0x13,
+  0xb6, 0x13, 0xcc, 0x13, 0xe2, 0x13, 0xf8, 0x13, 0x0e, 0x14, 0x24, 0x14,
+  0x3a, 0x14, 0x50, 0x14, 0x66, 0x14, 0x7c, 0x14, 0x92, 0x14, 0xa8, 0x14,
+  0xbe, 0x14, 0xcc, 0x14, 0xe2, 0x14, 0xf8, 0x14, 0x0e, 0x15, 0x24, 0x15,
+  0x3a, 0x15, 0x4f, 0x15, 0x64, 0x15, 0x7a, 0x15, 0x90, 0x15, 0xa6, 0x15,
+  0xbc, 0x15, 0xd2, 0x15, 0xe8, 0x15, 0xfe, 0x15, 0x14, 0x16, 0x2a, 0x16,
+  0x40, 0x16, 0x56, 0x16, 0x6c, 0x16, 0x82, 0x16, 0x98, 0x16, 0xae, 0x16,
+  0xc4, 0x16, 0xda, 0x16, 0xf0, 0x16, 0x06, 0x17, 0x1c, 0x17, 0x32, 0x17,
+  0x47, 0x17, 0x5d, 0x17, 0x73, 0x17, 0x89, 0x17, 0x9f, 0x17, 0xb5, 0x17,
+  0xcb, 0x17, 0xe1, 0x17, 0xf7, 0x17, 0x0d, 0x18, 0x23, 0x18, 0x39, 0x18,
+  0x47, 0x18, 0x5d, 0x18, 0x73, 0x18, 0x89, 0x18, 0x9f, 0x18, 0xb5, 0x18,
+  0xcb, 0x18, 0xe1, 0x18, 0xf7, 0x18, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00,
+  0x27, 0x00, 0x33, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x18, 0x00, 0x30, 0x00,
+  0x41, 0x00, 0x59, 0x00, 0x71, 0x00, 0x89, 0x00, 0xa2, 0x00, 0xb4, 0x00,
+  0xc6, 0x00, 0xd8, 0x00, 0xf1, 0x00, 0x03, 0x01, 0x1c, 0x01, 0x2e, 0x01,
+  0x40, 0x01, 0x52, 0x01, 0x6b, 0x01, 0x84, 0x01, 0x9d, 0x01, 0xa8, 0x01,
+  0xba, 0x01, 0xd3, 0x01, 0xec, 0x01, 0xfe, 0x01, 0x17, 0x02, 0x29, 0x02,
+  0x42, 0x02, 0x5b, 0x02, 0x6d, 0x02, 0x7f, 0x02, 0x98, 0x02, 0xb1, 0x02,
+  0xca, 0x02, 0xe3, 0x02, 0xf4, 0x02, 0x0d, 0x03, 0x26, 0x03, 0x3f, 0x03,
+  0x58, 0x03, 0x6a, 0x03, 0x7c, 0x03, 0x95, 0x03, 0xae, 0x03, 0xc7, 0x03,
+  0xd9, 0x03, 0xf2, 0x03, 0x0b, 0x04, 0x24, 0x04, 0x3d, 0x04, 0x56, 0x04,
+  0x68, 0x04, 0x81, 0x04, 0x9a, 0x04, 0xb3, 0x04, 0xc5, 0x04, 0xde, 0x04,
+  0xf7, 0x04, 0x09, 0x05, 0x1b, 0x05, 0x2d, 0x05, 0x46, 0x05, 0x51, 0x05,
+  0x63, 0x05, 0x75, 0x05, 0x87, 0x05, 0xa0, 0x05, 0xb2, 0x05, 0xc4, 0x05,
+  0xdd, 0x05, 0xf6, 0x05, 0x0f, 0x06, 0x28, 0x06, 0x3a, 0x06, 0x53, 0x06,
+  0x6c, 0x06, 0x7e, 0x06, 0x90, 0x06, 0xa9, 0x06, 0xc2, 0x06, 0xdb, 0x06,
+  0xe6, 0x06, 0xff, 0x06, 0x11, 0x07, 0x23, 0x07, 0x3c, 0x07, 0x55, 0x07,
+  0x6e, 0x07, 0x80, 0x07, 0x99, 0x07, 0xab, 0x07, 0xbd, 0x07, 0xcf, 0x07,
+  0xe8, 0x07, 0xf3, 0x07, 0x05, 0x08, 0x1e, 0x08, 0x37, 0x08, 0x50, 0x08,
+  0x61, 0x08, 0x7b, 0x08, 0x94, 0x08, 0xa6, 0x08, 0xb8, 0x08, 0xd1, 0x08,
+  0xea, 0x08, 0x04, 0x09, 0x1d, 0x09, 0x2f, 0x09, 0x41, 0x09, 0x5a, 0x09,
+  0x6c, 0x09, 0x85, 0x09, 0x97, 0x09, 0xa9, 0x09, 0xbb, 0x09, 0xd4, 0x09,
+  0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1e, 0x00, 0x2d, 0x00, 0x3c, 0x00,
+  0x4b, 0x00, 0x00, 0x00, 0x11, 0x00, 0x24, 0x00, 0x36, 0x00, 0x49, 0x00,
+  0x5c, 0x00, 0x6f, 0x00, 0x82, 0x00, 0x95, 0x00, 0xa8, 0x00, 0xbc, 0x00,
+  0x00, 0x00, 0x0f, 0x00, 0x1f, 0x00, 0x2f, 0x00, 0x3e, 0x00, 0x4d, 0x00,
+  0x5c, 0x00, 0x6b, 0x00, 0x7a, 0x00, 0x89, 0x00, 0x98, 0x00, 0xa7, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x22, 0x00, 0x33, 0x00, 0x00, 0x00, 0x15, 0x00,
+  0x23, 0x00, 0x38, 0x00, 0x4c, 0x00, 0x61, 0x00, 0x76, 0x00, 0x8c, 0x00,
+  0xa2, 0x00, 0xb0, 0x00, 0xc6, 0x00, 0xdc, 0x00, 0xf1, 0x00, 0x06, 0x01,
+  0x15, 0x01, 0x2b, 0x01, 0x39, 0x01, 0x4e, 0x01, 0x64, 0x01, 0x7a, 0x01,
+  0x8f, 0x01, 0xa4, 0x01, 0xb2, 0x01, 0xc8, 0x01, 0xdd, 0x01, 0xf2, 0x01,
+  0x08, 0x02, 0x1e, 0x02, 0x33, 0x02, 0x41, 0x02, 0x56, 0x02, 0x6b, 0x02,
+  0x81, 0x02, 0x96, 0x02, 0xac, 0x02, 0xc2, 0x02, 0xd7, 0x02, 0xed, 0x02,
+  0x02, 0x03, 0x17, 0x03, 0x2c, 0x03, 0x42, 0x03, 0x00, 0x00, 0x11, 0x00,
+  0x22, 0x00, 0x33, 0x00, 0x4a, 0x00, 0x5d, 0x00, 0x6f, 0x00, 0x81, 0x00,
+  0x93, 0x00, 0xab, 0x00, 0xbd, 0x00, 0xcf, 0x00, 0xe2, 0x00, 0xf4, 0x00,
+  0x06, 0x01, 0x18, 0x01, 0x2a, 0x01, 0x3c, 0x01, 0x4e, 0x01, 0x60, 0x01,
+  0x72, 0x01, 0x85, 0x01, 0x97, 0x01, 0xa9, 0x01, 0xbb, 0x01, 0xcd, 0x01,
+  0xe0, 0x01, 0xf2, 0x01, 0x04, 0x02, 0x17, 0x02, 0x29, 0x02, 0x3b, 0x02,
+  0x4e, 0x02, 0x60, 0x02, 0x72, 0x02, 0x84, 0x02, 0x96, 0x02, 0xa8, 0x02,
+  0xbb, 0x02, 0xcd, 0x02, 0xdf, 0x02, 0xf1, 0x02, 0x03, 0x03, 0x15, 0x03,
+  0x28, 0x03, 0x3a, 0x03, 0x4c, 0x03, 0x5e, 0x03, 0x70, 0x03, 0x83, 0x03,
+  0x95, 0x03, 0xa7, 0x03, 0x00, 0x00, 0x0f, 0x00, 0x1e, 0x00, 0x2d, 0x00,
+  0x3c, 0x00, 0x4b, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x23, 0x00, 0x35, 0x00, 0x47, 0x00, 0x59, 0x00, 0x6b, 0x00,
+  0x7d, 0x00, 0x8f, 0x00, 0xa1, 0x00, 0xb3, 0x00, 0xc6, 0x00, 0xd8, 0x00,
+  0xea, 0x00, 0xfc, 0x00, 0x0e, 0x01, 0x20, 0x01, 0x32, 0x01, 0x44, 0x01,
+  0x56, 0x01, 0x68, 0x01, 0x7a, 0x01, 0x8c, 0x01, 0x9e, 0x01, 0xb2, 0x01,
+  0xc4, 0x01, 0xd6, 0x01, 0xe8, 0x01, 0xfb, 0x01, 0x0d, 0x02, 0x1f, 0x02,
+  0x31, 0x02, 0x43, 0x02, 0x55, 0x02, 0x67, 0x02, 0x79, 0x02, 0x8c, 0x02,
+  0x9e, 0x02, 0xb0, 0x02, 0xc2, 0x02, 0xd4, 0x02, 0x00, 0x00, 0x0c, 0x00,
+  0x00, 0x00, 0x11, 0x00, 0x21, 0x00, 0x32, 0x00, 0x44, 0x00, 0x55, 0x00,
+  0x66, 0x00, 0x78, 0x00, 0x89, 0x00, 0x9a, 0x00, 0xab, 0x00, 0x00, 0x00,
+  0x16, 0x00, 0x2b, 0x00, 0x40, 0x00, 0x55, 0x00, 0x6a, 0x00, 0x7f, 0x00,
+  0x94, 0x00, 0xa9, 0x00, 0xbe, 0x00, 0xd3, 0x00, 0xe8, 0x00, 0xff, 0x00,
+  0x0e, 0x01, 0x24, 0x01, 0x3a, 0x01, 0x50, 0x01, 0x66, 0x01, 0x7c, 0x01,
+  0x8a, 0x01, 0xa0, 0x01, 0xb6, 0x01, 0xcc, 0x01, 0xe2, 0x01, 0xf8, 0x01,
+  0x0e, 0x02, 0x25, 0x02, 0x3b, 0x02, 0x51, 0x02, 0x67, 0x02, 0x7d, 0x02,
+  0x93, 0x02, 0xa9, 0x02, 0xbf, 0x02, 0xd5, 0x02, 0xeb, 0x02, 0x01, 0x03,
+  0x18, 0x03, 0x2e, 0x03, 0x44, 0x03, 0x5a, 0x03, 0x70, 0x03, 0x86, 0x03,
+  0x9c, 0x03, 0xb2, 0x03, 0xc8, 0x03, 0xde, 0x03, 0xf4, 0x03, 0x0a, 0x04,
+  0x21, 0x04, 0x37, 0x04, 0x4d, 0x04, 0x63, 0x04, 0x79, 0x04, 0x8f, 0x04,
+  0xa5, 0x04, 0xbb, 0x04, 0xd1, 0x04, 0xe8, 0x04, 0xf7, 0x04, 0x0d, 0x05,
+  0x23, 0x05, 0x39, 0x05, 0x4f, 0x05, 0x5d, 0x05, 0x73, 0x05, 0x89, 0x05,
+  0x9f, 0x05, 0xb5, 0x05, 0xcb, 0x05, 0xe2, 0x05, 0xf8, 0x05, 0x0e, 0x06,
+  0x24, 0x06, 0x3a, 0x06, 0x50, 0x06, 0x66, 0x06, 0x7c, 0x06, 0x93, 0x06,
+  0xa9, 0x06, 0xbf, 0x06, 0xd5, 0x06, 0xeb, 0x06, 0x01, 0x07, 0x17, 0x07,
+  0x2d, 0x07, 0x43, 0x07, 0x59, 0x07, 0x6f, 0x07, 0x86, 0x07, 0x9c, 0x07,
+  0xb2, 0x07, 0xc8, 0x07, 0xde, 0x07, 0xf4, 0x07, 0x0a, 0x08, 0x20, 0x08,
+  0x36, 0x08, 0x4d, 0x08, 0x5c, 0x08, 0x6a, 0x08, 0x80, 0x08, 0x96, 0x08,
+  0xac, 0x08, 0xc2, 0x08, 0xd9, 0x08, 0xe8, 0x08, 0xfe, 0x08, 0x14, 0x09,
+  0x2a, 0x09, 0x40, 0x09, 0x56, 0x09, 0x64, 0x09, 0x7a, 0x09, 0x90, 0x09,
+  0xa6, 0x09, 0xbc, 0x09, 0xd2, 0x09, 0xe8, 0x09, 0xfe, 0x09, 0x14, 0x0a,
+  0x2b, 0x0a, 0x41, 0x0a, 0x57, 0x0a, 0x65, 0x0a, 0x7b, 0x0a, 0x91, 0x0a,
+  0xa7, 0x0a, 0xbd, 0x0a, 0xd3, 0x0a, 0xe9, 0x0a, 0xff, 0x0a, 0x16, 0x0b,
+  0x2c, 0x0b, 0x42, 0x0b, 0x58, 0x0b, 0x6e, 0x0b, 0x84, 0x0b, 0x92, 0x0b,
+  0xa8, 0x0b, 0xbe, 0x0b, 0xd4, 0x0b, 0xea, 0x0b, 0x00, 0x0c, 0x16, 0x0c,
+  0x2d, 0x0c, 0x43, 0x0c, 0x59, 0x0c, 0x6f, 0x0c, 0x85, 0x0c, 0x9b, 0x0c,
+  0xb1, 0x0c, 0xc7, 0x0c, 0xdd, 0x0c, 0xf4, 0x0c, 0x0a, 0x0d, 0x20, 0x0d,
+  0x36, 0x0d, 0x4c, 0x0d, 0x62, 0x0d, 0x78, 0x0d, 0x8e, 0x0d, 0xa4, 0x0d,
+  0xba, 0x0d, 0xd1, 0x0d, 0xe7, 0x0d, 0xfd, 0x0d, 0x13, 0x0e, 0x29, 0x0e,
+  0x3f, 0x0e, 0x55, 0x0e, 0x6b, 0x0e, 0x81, 0x0e, 0x97, 0x0e, 0xad, 0x0e,
+  0xc3, 0x0e, 0xd9, 0x0e, 0xef, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00,
+  0x29, 0x00, 0x41, 0x00, 0x52, 0x00, 0x63, 0x00, 0x7b, 0x00, 0x93, 0x00,
+  0xac, 0x00, 0xbd, 0x00, 0xcf, 0x00, 0xe1, 0x00, 0xfa, 0x00, 0x0b, 0x01,
+  0x1d, 0x01, 0x36, 0x01, 0x47, 0x01, 0x60, 0x01, 0x79, 0x01, 0x92, 0x01,
+  0xa4, 0x01, 0xb6, 0x01, 0xcf, 0x01, 0xe8, 0x01, 0xf9, 0x01, 0x12, 0x02,
+  0x2b, 0x02, 0x3c, 0x02, 0x4e, 0x02, 0x67, 0x02, 0x80, 0x02, 0x99, 0x02,
+  0xaa, 0x02, 0xc3, 0x02, 0xdc, 0x02, 0xed, 0x02, 0x06, 0x03, 0x1f, 0x03,
+  0x38, 0x03, 0x49, 0x03, 0x5b, 0x03, 0x6d, 0x03, 0x86, 0x03, 0x9f, 0x03,
+  0xb1, 0x03, 0xc3, 0x03, 0xd5, 0x03, 0xe7, 0x03, 0xf9, 0x03, 0x0b, 0x04,
+  0x1d, 0x04, 0x36, 0x04, 0x48, 0x04, 0x61, 0x04, 0x7a, 0x04, 0x93, 0x04,
+  0xa5, 0x04, 0xbe, 0x04, 0xd7, 0x04, 0xf0, 0x04, 0x02, 0x05, 0x14, 0x05,
+  0x26, 0x05, 0x38, 0x05, 0x4a, 0x05, 0x5c, 0x05, 0x75, 0x05, 0x8e, 0x05,
+  0x9f, 0x05, 0xb1, 0x05, 0xca, 0x05, 0x00, 0x00, 0x14, 0x00, 0x28, 0x00,
+  0x3d, 0x00, 0x52, 0x00, 0x67, 0x00, 0x7c, 0x00, 0x91, 0x00, 0xa6, 0x00,
+  0xbb, 0x00, 0xd0, 0x00, 0xe5, 0x00, 0xfa, 0x00, 0x0f, 0x01, 0x24, 0x01,
+  0x39, 0x01, 0x4e, 0x01, 0x63, 0x01, 0x78, 0x01, 0x8d, 0x01, 0xa2, 0x01,
+  0xb7, 0x01, 0xcc, 0x01, 0xe1, 0x01, 0xf6, 0x01, 0x00, 0x00, 0x0f, 0x00,
+  0x1e, 0x00, 0x2d, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x22, 0x00, 0x00, 0x00, 0x15, 0x00, 0x29, 0x00, 0x37, 0x00,
+  0x4c, 0x00, 0x62, 0x00, 0x78, 0x00, 0x8d, 0x00, 0xa3, 0x00, 0xb8, 0x00,
+  0xc6, 0x00, 0xdc, 0x00, 0xf2, 0x00, 0x07, 0x01, 0x1d, 0x01, 0x33, 0x01,
+  0x41, 0x01, 0x50, 0x01, 0x65, 0x01, 0x73, 0x01, 0x00, 0x00, 0x12, 0x00,
+  0x23, 0x00, 0x35, 0x00, 0x47, 0x00, 0x59, 0x00, 0x6c, 0x00, 0x7e, 0x00,
+  0x90, 0x00, 0xa2, 0x00, 0xb4, 0x00, 0xc6, 0x00, 0xd8, 0x00, 0xea, 0x00,
+  0xfc, 0x00, 0x0f, 0x01, 0x21, 0x01, 0x33, 0x01, 0x45, 0x01, 0x58, 0x01,
+  0x6a, 0x01, 0x7c, 0x01, 0x00, 0x00, 0x14, 0x00, 0x29, 0x00, 0x3e, 0x00,
+  0x53, 0x00, 0x68, 0x00, 0x7d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1e, 0x00,
+  0x2d, 0x00, 0x3c, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1e, 0x00,
+  0x2d, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1e, 0x00, 0x2d, 0x00,
+  0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1d, 0x00, 0x2c, 0x00,
+  0x3b, 0x00, 0x4a, 0x00, 0x59, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1e, 0x00,
+  0x2d, 0x00, 0x00, 0x00, 0x11, 0x00, 0x23, 0x00, 0x36, 0x00, 0x49, 0x00,
+  0x58, 0x00, 0x6a, 0x00, 0x7d, 0x00, 0x8c, 0x00, 0x9f, 0x00, 0xae, 0x00,
+  0xc1, 0x00, 0xd0, 0x00, 0xe2, 0x00, 0xf5, 0x00, 0x08, 0x01, 0x17, 0x01,
+  0x2a, 0x01, 0x3d, 0x01, 0x50, 0x01, 0x63, 0x01, 0x00, 0x00, 0x11, 0x00,
+  0x23, 0x00, 0x32, 0x00, 0x44, 0x00, 0x53, 0x00, 0x62, 0x00, 0x74, 0x00,
+  0x83, 0x00, 0x00, 0x00, 0x15, 0x00, 0x26, 0x00, 0x34, 0x00, 0x46, 0x00,
+  0x5c, 0x00, 0x6e, 0x00, 0x7d, 0x00, 0x8f, 0x00, 0xa4, 0x00, 0xb3, 0x00,
+  0xc9, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x15, 0x00, 0x2a, 0x00,
+  0x3c, 0x00, 0x52, 0x00, 0x64, 0x00, 0x79, 0x00, 0x8e, 0x00, 0x00, 0x00,
+  0x15, 0x00, 0x22, 0x00, 0x30, 0x00, 0x45, 0x00, 0x00, 0x00, 0x12, 0x00,
+  0x24, 0x00, 0x36, 0x00, 0x48, 0x00, 0x5a, 0x00, 0x6c, 0x00, 0x7e, 0x00,
+  0x90, 0x00, 0xa2, 0x00, 0xb4, 0x00, 0xc6, 0x00, 0xd8, 0x00, 0xea, 0x00,
+  0xfc, 0x00, 0x0e, 0x01, 0x20, 0x01, 0x32, 0x01, 0x44, 0x01, 0x56, 0x01,
+  0x68, 0x01, 0x7a, 0x01, 0x8c, 0x01, 0x00, 0x00, 0x14, 0x00, 0x29, 0x00,
+  0x3e, 0x00, 0x54, 0x00, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x26, 0x00, 0x39, 0x00, 0x4c, 0x00, 0x5f, 0x00, 0x6e, 0x00,
+  0x81, 0x00, 0x00, 0x00, 0x12, 0x00, 0x25, 0x00, 0x38, 0x00, 0x4b, 0x00,
+  0x5e, 0x00, 0x71, 0x00, 0x84, 0x00, 0x97, 0x00, 0xaa, 0x00, 0xbd, 0x00,
+  0xd0, 0x00, 0xe3, 0x00, 0x00, 0x00, 0x13, 0x00, 0x26, 0x00, 0x35, 0x00,
+  0x48, 0x00, 0x57, 0x00, 0x6a, 0x00, 0x79, 0x00, 0x8c, 0x00, 0x9f, 0x00,
+  0xae, 0x00, 0xc1, 0x00, 0xd0, 0x00, 0xe3, 0x00, 0xf2, 0x00, 0x05, 0x01,
+  0x18, 0x01, 0x2b, 0x01, 0x3e, 0x01, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x00, 0x00, 0x0f, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x12, 0x00, 0x24, 0x00,
+  0x36, 0x00, 0x48, 0x00, 0x5a, 0x00, 0x6c, 0x00, 0x7e, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1e, 0x00, 0x2d, 0x00, 0x3c, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x1c, 0x00, 0x2a, 0x00, 0x38, 0x00, 0x46, 0x00, 0x54, 0x00,
+  0x62, 0x00, 0x70, 0x00, 0x7e, 0x00, 0x8c, 0x00, 0x00, 0x00, 0x13, 0x00,
+  0x26, 0x00, 0x39, 0x00, 0x4c, 0x00, 0x5f, 0x00, 0x72, 0x00, 0x85, 0x00,
+  0x98, 0x00, 0xab, 0x00, 0xbe, 0x00, 0xd1, 0x00, 0xe4, 0x00, 0xf7, 0x00,
+  0x0a, 0x01, 0x1d, 0x01, 0x00, 0x00, 0x11, 0x00, 0x22, 0x00, 0x33, 0x00,
+  0x44, 0x00, 0x56, 0x00, 0x68, 0x00, 0x7a, 0x00, 0x8c, 0x00, 0x9e, 0x00,
+  0xb0, 0x00, 0xc2, 0x00, 0xd4, 0x00, 0xe6, 0x00, 0xf8, 0x00, 0x0a, 0x01,
+  0x1c, 0x01, 0x2e, 0x01, 0x40, 0x01, 0x52, 0x01, 0x64, 0x01, 0x76, 0x01,
+  0x88, 0x01, 0x9a, 0x01, 0xac, 0x01, 0xbe, 0x01, 0xd0, 0x01, 0xe2, 0x01,
+  0xf4, 0x01, 0x06, 0x02, 0x18, 0x02, 0x2a, 0x02, 0x3c, 0x02, 0x4e, 0x02,
+  0x60, 0x02, 0x72, 0x02, 0x84, 0x02, 0x96, 0x02, 0xa8, 0x02, 0xba, 0x02,
+  0xcc, 0x02, 0xde, 0x02, 0xf0, 0x02, 0x02, 0x03, 0x14, 0x03, 0x26, 0x03,
+  0x38, 0x03, 0x4a, 0x03, 0x5c, 0x03, 0x6e, 0x03, 0x80, 0x03, 0x92, 0x03,
+  0xa4, 0x03, 0xb6, 0x03, 0xc8, 0x03, 0xda, 0x03, 0x00, 0x00, 0x16, 0x00,
+  0x00, 0x00, 0x14, 0x00, 0x29, 0x00, 0x3e, 0x00, 0x53, 0x00, 0x68, 0x00,
+  0x7d, 0x00, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x2a, 0x00,
+  0x40, 0x00, 0x55, 0x00, 0x6a, 0x00, 0x7f, 0x00, 0x95, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x21, 0x00, 0x33, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x16, 0x00, 0x21, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1d, 0x00,
+  0x2d, 0x00, 0x3d, 0x00, 0x4d, 0x00, 0x5c, 0x00, 0x6b, 0x00, 0x7b, 0x00,
+  0x00, 0x00, 0x0f, 0x00, 0x1a, 0x00, 0x2a, 0x00, 0x35, 0x00, 0x40, 0x00,
+  0x4f, 0x00, 0x5e, 0x00, 0x6d, 0x00, 0x7d, 0x00, 0x00, 0x00, 0x0d, 0x00,
+  0x1b, 0x00, 0x29, 0x00, 0x37, 0x00, 0x45, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x1d, 0x00, 0x2d, 0x00, 0x3d, 0x00, 0x4d, 0x00, 0x5c, 0x00, 0x6c, 0x00,
+  0x7b, 0x00, 0x8b, 0x00, 0x9b, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x16, 0x00,
+  0x21, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1d, 0x00, 0x2c, 0x00, 0x3b, 0x00,
+  0x4a, 0x00, 0x59, 0x00, 0x68, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1d, 0x00,
+  0x2b, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x24, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x24, 0x00, 0x2f, 0x00, 0x41, 0x00, 0x53, 0x00, 0x65, 0x00,
+  0x00, 0x00, 0x15, 0x00, 0x2a, 0x00, 0x40, 0x00, 0x56, 0x00, 0x6c, 0x00,
+  0x82, 0x00, 0x98, 0x00, 0xae, 0x00, 0xc4, 0x00, 0xda, 0x00, 0xf0, 0x00,
+  0x02, 0x01, 0x14, 0x01, 0x2a, 0x01, 0x00, 0x00, 0x15, 0x00, 0x2a, 0x00,
+  0x40, 0x00, 0x4e, 0x00, 0x64, 0x00, 0x7a, 0x00, 0x90, 0x00, 0xa6, 0x00,
+  0xbc, 0x00, 0xd2, 0x00, 0xe0, 0x00, 0xf6, 0x00, 0x0c, 0x01, 0x22, 0x01,
+  0x38, 0x01, 0x4e, 0x01, 0x64, 0x01, 0x72, 0x01, 0x80, 0x01, 0x96, 0x01,
+  0xa4, 0x01, 0xb2, 0x01, 0xc8, 0x01, 0xde, 0x01, 0xec, 0x01, 0x00, 0x00,
+  0x18, 0x00, 0x31, 0x00, 0x47, 0x00, 0x57, 0x00, 0x6d, 0x00, 0x83, 0x00,
+  0x9c, 0x00, 0xb5, 0x00, 0xc4, 0x00, 0xdd, 0x00, 0xf3, 0x00, 0x0c, 0x01,
+  0x22, 0x01, 0x38, 0x01, 0x48, 0x01, 0x5e, 0x01, 0x74, 0x01, 0x84, 0x01,
+  0x9d, 0x01, 0xb3, 0x01, 0xc9, 0x01, 0xdf, 0x01, 0xef, 0x01, 0xff, 0x01,
+  0x0f, 0x02, 0x25, 0x02, 0x3e, 0x02, 0x54, 0x02, 0x64, 0x02, 0x73, 0x02,
+  0x89, 0x02, 0x9f, 0x02, 0xae, 0x02, 0xbd, 0x02, 0xd3, 0x02, 0x00, 0x00,
+  0x0b, 0x00, 0x00, 0x00, 0x18, 0x00, 0x31, 0x00, 0x4a, 0x00, 0x63, 0x00,
+  0x6e, 0x00, 0x87, 0x00, 0xa0, 0x00, 0xb9, 0x00, 0xd2, 0x00, 0xeb, 0x00,
+  0x04, 0x01, 0x1d, 0x01, 0x36, 0x01, 0x4f, 0x01, 0x68, 0x01, 0x81, 0x01,
+  0x9a, 0x01, 0xb3, 0x01, 0xcc, 0x01, 0xe5, 0x01, 0x00, 0x00, 0x11, 0x00,
+  0x2a, 0x00, 0x43, 0x00, 0x5c, 0x00, 0x75, 0x00, 0x87, 0x00, 0xa0, 0x00,
+  0xb9, 0x00, 0xd2, 0x00, 0xeb, 0x00, 0x04, 0x01, 0x1d, 0x01, 0x36, 0x01,
+  0x4f, 0x01, 0x68, 0x01, 0x81, 0x01, 0x93, 0x01, 0xac, 0x01, 0xc5, 0x01,
+  0xde, 0x01, 0xec, 0x01, 0x06, 0x02, 0x14, 0x02, 0x00, 0x00, 0x0e, 0x00,
+  0x1d, 0x00, 0x2b, 0x00, 0x3a, 0x00, 0x45, 0x00, 0x54, 0x00, 0x62, 0x00,
+  0x70, 0x00, 0x7e, 0x00, 0x8c, 0x00, 0x9b, 0x00, 0xa9, 0x00, 0xb8, 0x00,
+  0xc6, 0x00, 0xd4, 0x00, 0xe3, 0x00, 0xf2, 0x00, 0x00, 0x00, 0x15, 0x00,
+  0x2b, 0x00, 0x41, 0x00, 0x57, 0x00, 0x6d, 0x00, 0x83, 0x00, 0x99, 0x00,
+  0xaf, 0x00, 0xc5, 0x00, 0xdb, 0x00, 0xf1, 0x00, 0x07, 0x01, 0x1d, 0x01,
+  0x33, 0x01, 0x49, 0x01, 0x5f, 0x01, 0x75, 0x01, 0x00, 0x00, 0x0f, 0x00,
+  0x1e, 0x00, 0x2d, 0x00, 0x3f, 0x00, 0x51, 0x00, 0x63, 0x00, 0x75, 0x00,
+  0x87, 0x00, 0x99, 0x00, 0xab, 0x00, 0xbd, 0x00, 0xcf, 0x00, 0xe1, 0x00,
+  0x00, 0x00, 0x18, 0x00, 0x27, 0x00, 0x36, 0x00, 0x45, 0x00, 0x54, 0x00,
+  0x63, 0x00, 0x7d, 0x00, 0x96, 0x00, 0xa5, 0x00, 0xbf, 0x00, 0x00, 0x00,
+  0x15, 0x00, 0x2a, 0x00, 0x40, 0x00, 0x56, 0x00, 0x6c, 0x00, 0x82, 0x00,
+  0x91, 0x00, 0xa7, 0x00, 0xbd, 0x00, 0xd3, 0x00, 0xe2, 0x00, 0xf8, 0x00,
+  0x0e, 0x01, 0x24, 0x01, 0x36, 0x01, 0x4c, 0x01, 0x62, 0x01, 0x78, 0x01,
+  0x8e, 0x01, 0xa4, 0x01, 0xba, 0x01, 0xd0, 0x01, 0xe6, 0x01, 0xfc, 0x01,
+  0x12, 0x02, 0x28, 0x02, 0x3a, 0x02, 0x49, 0x02, 0x58, 0x02, 0x6e, 0x02,
+  0x80, 0x02, 0x96, 0x02, 0xa5, 0x02, 0x00, 0x00, 0x0e, 0x00, 0x1e, 0x00,
+  0x2e, 0x00, 0x3e, 0x00, 0x4e, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x12, 0x00,
+  0x24, 0x00, 0x36, 0x00, 0x48, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x18, 0x00,
+  0x31, 0x00, 0x43, 0x00, 0x53, 0x00, 0x62, 0x00, 0x7b, 0x00, 0x94, 0x00,
+  0xa3, 0x00, 0xbc, 0x00, 0xcc, 0x00, 0xdc, 0x00, 0xf5, 0x00, 0x0e, 0x01,
+  0x1e, 0x01, 0x2e, 0x01, 0x47, 0x01, 0x60, 0x01, 0x72, 0x01, 0x8b, 0x01,
+  0x9d, 0x01, 0xad, 0x01, 0xbd, 0x01, 0xd7, 0x01, 0xf0, 0x01, 0xff, 0x01,
+  0x18, 0x02, 0x00, 0x00, 0x11, 0x00, 0x21, 0x00, 0x30, 0x00, 0x42, 0x00,
+  0x54, 0x00, 0x64, 0x00, 0x76, 0x00, 0x86, 0x00, 0x96, 0x00, 0xa6, 0x00,
+  0xb5, 0x00, 0xc7, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x15, 0x00,
+  0x2b, 0x00, 0x41, 0x00, 0x57, 0x00, 0x6c, 0x00, 0x82, 0x00, 0x94, 0x00,
+  0xa9, 0x00, 0xbf, 0x00, 0xd5, 0x00, 0xeb, 0x00, 0x00, 0x01, 0x15, 0x01,
+  0x2b, 0x01, 0x40, 0x01, 0x56, 0x01, 0x6c, 0x01, 0x81, 0x01, 0x97, 0x01,
+  0xad, 0x01, 0xc3, 0x01, 0xd5, 0x01, 0xea, 0x01, 0x00, 0x02, 0x16, 0x02,
+  0x2b, 0x02, 0x00, 0x00, 0x15, 0x00, 0x2b, 0x00, 0x41, 0x00, 0x57, 0x00,
+  0x6d, 0x00, 0x83, 0x00, 0x99, 0x00, 0xaf, 0x00, 0xc5, 0x00, 0xdb, 0x00,
+  0xf1, 0x00, 0x07, 0x01, 0x1d, 0x01, 0x33, 0x01, 0x49, 0x01, 0x5f, 0x01,
+  0x75, 0x01, 0x8b, 0x01, 0xa1, 0x01, 0xb7, 0x01, 0xcd, 0x01, 0x00, 0x00,
+  0x16, 0x00, 0x2c, 0x00, 0x42, 0x00, 0x58, 0x00, 0x71, 0x00, 0x87, 0x00,
+  0x9d, 0x00, 0xb3, 0x00, 0xc9, 0x00, 0xdf, 0x00, 0xf5, 0x00, 0x0b, 0x01,
+  0x21, 0x01, 0x37, 0x01, 0x4d, 0x01, 0x63, 0x01, 0x79, 0x01, 0x92, 0x01,
+  0xa8, 0x01, 0xbe, 0x01, 0x00, 0x00, 0x18, 0x00, 0x31, 0x00, 0x4a, 0x00,
+  0x63, 0x00, 0x00, 0x00, 0x18, 0x00, 0x32, 0x00, 0x4b, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1d, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1d, 0x00, 0x2d, 0x00,
+  0x3c, 0x00, 0x4c, 0x00, 0x5b, 0x00, 0x6b, 0x00, 0x00, 0x00, 0x11, 0x00,
+  0x22, 0x00, 0x34, 0x00, 0x46, 0x00, 0x58, 0x00, 0x6a, 0x00, 0x7c, 0x00,
+  0x8e, 0x00, 0xa0, 0x00, 0xb2, 0x00, 0xc4, 0x00, 0xd6, 0x00, 0xe8, 0x00,
+  0xfa, 0x00, 0x0c, 0x01, 0x1e, 0x01, 0x30, 0x01, 0x00, 0x00, 0x0c, 0x00,
+  0x18, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x16, 0x00, 0x21, 0x00, 0x2c, 0x00,
+  0x00, 0x00, 0x0b, 0x00, 0x16, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1e, 0x00,
+  0x2d, 0x00, 0x3c, 0x00, 0x4b, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x0d, 0x00,
+  0x1b, 0x00, 0x00, 0x00, 0x12, 0x00, 0x24, 0x00, 0x36, 0x00, 0x48, 0x00,
+  0x5a, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x1f, 0x00, 0x2e, 0x00,
+  0x3e, 0x00, 0x4e, 0x00, 0x5e, 0x00, 0x6e, 0x00, 0x7e, 0x00, 0x8e, 0x00,
+  0x9e, 0x00, 0xad, 0x00, 0x00, 0x00, 0x12, 0x00, 0x24, 0x00, 0x36, 0x00,
+  0x48, 0x00, 0x5a, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x1e, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x1d, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x11, 0x00, 0x22, 0x00, 0x33, 0x00,
+  0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x24, 0x00, 0x36, 0x00,
+  0x48, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x11, 0x00, 0x23, 0x00, 0x35, 0x00,
+  0x47, 0x00, 0x00, 0x00, 0x15, 0x00, 0x2a, 0x00, 0x40, 0x00, 0x56, 0x00,
+  0x6c, 0x00, 0x82, 0x00, 0x98, 0x00, 0xae, 0x00, 0xc4, 0x00, 0xda, 0x00,
+  0xf0, 0x00, 0x06, 0x01, 0x1c, 0x01, 0x32, 0x01, 0x48, 0x01, 0x5e, 0x01,
+  0x74, 0x01, 0x8a, 0x01, 0xa0, 0x01, 0xb6, 0x01, 0xcc, 0x01, 0xe2, 0x01,
+  0xf8, 0x01, 0x0e, 0x02, 0x24, 0x02, 0x3a, 0x02, 0x50, 0x02, 0x66, 0x02,
+  0x7c, 0x02, 0x00, 0x00, 0x15, 0x00, 0x2a, 0x00, 0x3f, 0x00, 0x54, 0x00,
+  0x00, 0x00, 0x18, 0x00, 0x31, 0x00, 0x4a, 0x00, 0x63, 0x00, 0x7c, 0x00,
+  0x95, 0x00, 0xae, 0x00, 0xc7, 0x00, 0xe0, 0x00, 0xf9, 0x00, 0x12, 0x01,
+  0x2b, 0x01, 0x44, 0x01, 0x5d, 0x01, 0x76, 0x01, 0x8f, 0x01, 0xa8, 0x01,
+  0xc1, 0x01, 0xda, 0x01, 0xf3, 0x01, 0x0c, 0x02, 0x25, 0x02, 0x00, 0x00,
+  0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x23, 0x00, 0x35, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x2a, 0x00, 0x3f, 0x00, 0x54, 0x00,
+  0x00, 0x00, 0x15, 0x00, 0x2b, 0x00, 0x41, 0x00, 0x57, 0x00, 0x6d, 0x00,
+  0x83, 0x00, 0x99, 0x00, 0xaf, 0x00, 0xc5, 0x00, 0xdb, 0x00, 0xf1, 0x00,
+  0x07, 0x01, 0x1d, 0x01, 0x33, 0x01, 0x49, 0x01, 0x5f, 0x01, 0x75, 0x01,
+  0x8b, 0x01, 0xa1, 0x01, 0xb7, 0x01, 0x00, 0x00, 0x18, 0x00, 0x31, 0x00,
+  0x4b, 0x00, 0x65, 0x00, 0x7f, 0x00, 0x98, 0x00, 0xb2, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1d, 0x00,
+  0x2c, 0x00, 0x3b, 0x00, 0x4a, 0x00, 0x59, 0x00, 0x68, 0x00, 0x77, 0x00,
+  0x86, 0x00
+};
@@ -1,5 +1,7 @@
 #pragma once
-const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
+#include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/si_dict_index.h>
+const unsigned char __espeakng_dict_si[] __attribute__((aligned((4)))) = {
   0x00, 0x04, 0x00, 0x00, 0x94, 0x48, 0x01, 0x00, 0x00, 0xa0, 0x19, 0xf0,
   0x9f, 0x91, 0xa9, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xe2, 0x80,
   0x8d, 0xf0, 0x9f, 0x91, 0xa7, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa7,
@@ -7117,4 +7119,11 @@ const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
   0x02, 0x11, 0x42, 0x03, 0x59, 0x00, 0x7a, 0xe0, 0xb7, 0x83, 0x03, 0x59,
   0x23, 0x00, 0x07, 0x00
 };
-size_t __espeakng_dictlen = 85384;
+
+BackgroundAudioDictionary dict_si = {
+    "si",
+    85384,
+    __espeakng_dict_si,
+    7468,
+    __espeakng_dictindex_si
+};
@@ -1,5 +1,7 @@
 #pragma once
-const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
+#include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/sjn_dict_index.h>
+const unsigned char __espeakng_dict_sjn[] __attribute__((aligned((4)))) = {
   0x00, 0x04, 0x00, 0x00, 0x8b, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -150,4 +152,11 @@ const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
   0x11, 0x43, 0x12, 0x42, 0x1d, 0x03, 0x08, 0x75, 0x00, 0x02, 0x12, 0x42,
   0x1d, 0x00, 0x03, 0x75, 0x00, 0x07, 0x00
 };
-size_t __espeakng_dictlen = 1783;
+
+BackgroundAudioDictionary dict_sjn = {
+    "sjn",
+    1783,
+    __espeakng_dict_sjn,
+    2132,
+    __espeakng_dictindex_sjn
+};
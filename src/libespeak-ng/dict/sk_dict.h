@@ -1,5 +1,7 @@
 #pragma once
-const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
+#include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/sk_dict_index.h>
+const unsigned char __espeakng_dict_sk[] __attribute__((aligned((4)))) = {
   0x00, 0x04, 0x00, 0x00, 0xb1, 0xb3, 0x00, 0x00, 0x00, 0x43, 0x19, 0xf0,
   0x9f, 0x91, 0xa9, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xe2, 0x80,
   0x8d, 0xf0, 0x9f, 0x91, 0xa7, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa7,
@@ -4168,4 +4170,11 @@ const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
   0x33, 0x75, 0x24, 0x32, 0x2f, 0x27, 0x00, 0x24, 0x03, 0x49, 0x27, 0x37,
   0x7c, 0x33, 0x00, 0xc5, 0xaf, 0x03, 0x7e, 0x00, 0x07, 0x00
 };
-size_t __espeakng_dictlen = 50002;
+
+BackgroundAudioDictionary dict_sk = {
+    "sk",
+    50002,
+    __espeakng_dict_sk,
+    8030,
+    __espeakng_dictindex_sk
+};
@@ -1,5 +1,7 @@
 #pragma once
-const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
+#include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/sl_dict_index.h>
+const unsigned char __espeakng_dict_sl[] __attribute__((aligned((4)))) = {
   0x00, 0x04, 0x00, 0x00, 0xed, 0xac, 0x00, 0x00, 0x00, 0x47, 0x19, 0xf0,
   0x9f, 0x91, 0xa9, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xe2, 0x80,
   0x8d, 0xf0, 0x9f, 0x91, 0xa7, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa7,
@@ -3755,4 +3757,11 @@ const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
   0x91, 0x03, 0x4c, 0x00, 0xc3, 0xa4, 0x03, 0x6d, 0x0c, 0x00, 0xc3, 0xbc,
   0x03, 0x70, 0x0c, 0x00, 0xc5, 0x99, 0x03, 0x7b, 0x00, 0x07, 0x00
 };
-size_t __espeakng_dictlen = 45047;
+
+BackgroundAudioDictionary dict_sl = {
+    "sl",
+    45047,
+    __espeakng_dict_sl,
+    7574,
+    __espeakng_dictindex_sl
+};
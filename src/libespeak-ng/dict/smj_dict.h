@@ -1,5 +1,7 @@
 #pragma once
-const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
+#include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/smj_dict_index.h>
+const unsigned char __espeakng_dict_smj[] __attribute__((aligned((4)))) = {
   0x00, 0x04, 0x00, 0x00, 0x01, 0x85, 0x00, 0x00, 0x09, 0xc6, 0x3c, 0xc1,
   0xcf, 0x09, 0x52, 0x80, 0x48, 0x00, 0x0a, 0xc7, 0x24, 0x55, 0x0a, 0x04,
   0xa3, 0x89, 0x4c, 0x4c, 0x0c, 0x89, 0x64, 0x61, 0x3a, 0x6b, 0x6b, 0x69,
@@ -2926,4 +2928,11 @@ const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
   0x00, 0x7a, 0x03, 0x2f, 0x0c, 0x5a, 0x00, 0x03, 0x2f, 0x5a, 0x00, 0x68,
   0x01, 0x19, 0x03, 0x5b, 0x00, 0x07, 0x00
 };
-size_t __espeakng_dictlen = 35095;
+
+BackgroundAudioDictionary dict_smj = {
+    "smj",
+    35095,
+    __espeakng_dict_smj,
+    10516,
+    __espeakng_dictindex_smj
+};
@@ -0,0 +1,880 @@
+#pragma once
+const unsigned char __espeakng_dictindex_smj[] __attribute__((aligned((4)))) = {
+  0x45, 0x44, 0x58, 0x31, 0x17, 0x89, 0x00, 0x00, 0x01, 0x85, 0x00, 0x00,
+  0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x03, 0x00, 0x05, 0x00,
+  0x05, 0x00, 0x08, 0x00, 0x0a, 0x00, 0x0c, 0x00, 0x0d, 0x00, 0x17, 0x00,
+  0x19, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x20, 0x00, 0x22, 0x00, 0x25, 0x00,
+  0x2b, 0x00, 0x2e, 0x00, 0x30, 0x00, 0x33, 0x00, 0x34, 0x00, 0x37, 0x00,
+  0x3a, 0x00, 0x40, 0x00, 0x42, 0x00, 0x44, 0x00, 0x45, 0x00, 0x46, 0x00,
+  0x49, 0x00, 0x4b, 0x00, 0x4c, 0x00, 0x4e, 0x00, 0x52, 0x00, 0x52, 0x00,
+  0x54, 0x00, 0x55, 0x00, 0x58, 0x00, 0x5b, 0x00, 0x62, 0x00, 0x65, 0x00,
+  0x67, 0x00, 0x68, 0x00, 0x6a, 0x00, 0x6b, 0x00, 0x6d, 0x00, 0x6e, 0x00,
+  0x70, 0x00, 0x71, 0x00, 0x73, 0x00, 0x75, 0x00, 0x7b, 0x00, 0x7c, 0x00,
+  0x7c, 0x00, 0x7d, 0x00, 0x7f, 0x00, 0x82, 0x00, 0x83, 0x00, 0x83, 0x00,
+  0x85, 0x00, 0x85, 0x00, 0x85, 0x00, 0x86, 0x00, 0x8a, 0x00, 0x8b, 0x00,
+  0x8c, 0x00, 0x8d, 0x00, 0x93, 0x00, 0x94, 0x00, 0x97, 0x00, 0x99, 0x00,
+  0x9c, 0x00, 0x9f, 0x00, 0xa1, 0x00, 0xa3, 0x00, 0xa5, 0x00, 0xa7, 0x00,
+  0xa8, 0x00, 0xac, 0x00, 0xae, 0x00, 0xaf, 0x00, 0xb0, 0x00, 0xb2, 0x00,
+  0xb4, 0x00, 0xb6, 0x00, 0xb9, 0x00, 0xbb, 0x00, 0xbb, 0x00, 0xbb, 0x00,
+  0xbb, 0x00, 0xbc, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc4, 0x00, 0xc5, 0x00,
+  0xcb, 0x00, 0xcb, 0x00, 0xce, 0x00, 0xcf, 0x00, 0xd2, 0x00, 0xd4, 0x00,
+  0xd6, 0x00, 0xd7, 0x00, 0xd9, 0x00, 0xdf, 0x00, 0xe0, 0x00, 0xe4, 0x00,
+  0xe6, 0x00, 0xe9, 0x00, 0xee, 0x00, 0xf0, 0x00, 0xf6, 0x00, 0x00, 0x01,
+  0x03, 0x01, 0x06, 0x01, 0x08, 0x01, 0x0a, 0x01, 0x0f, 0x01, 0x12, 0x01,
+  0x14, 0x01, 0x15, 0x01, 0x18, 0x01, 0x19, 0x01, 0x1b, 0x01, 0x1d, 0x01,
+  0x1f, 0x01, 0x20, 0x01, 0x25, 0x01, 0x26, 0x01, 0x27, 0x01, 0x29, 0x01,
+  0x29, 0x01, 0x29, 0x01, 0x2b, 0x01, 0x2c, 0x01, 0x2e, 0x01, 0x31, 0x01,
+  0x32, 0x01, 0x34, 0x01, 0x38, 0x01, 0x3d, 0x01, 0x43, 0x01, 0x46, 0x01,
+  0x4e, 0x01, 0x52, 0x01, 0x54, 0x01, 0x5c, 0x01, 0x5e, 0x01, 0x60, 0x01,
+  0x61, 0x01, 0x65, 0x01, 0x66, 0x01, 0x6c, 0x01, 0x6e, 0x01, 0x6e, 0x01,
+  0x71, 0x01, 0x72, 0x01, 0x74, 0x01, 0x76, 0x01, 0x78, 0x01, 0x79, 0x01,
+  0x7a, 0x01, 0x7e, 0x01, 0x7e, 0x01, 0x7f, 0x01, 0x82, 0x01, 0x88, 0x01,
+  0x89, 0x01, 0x8a, 0x01, 0x8e, 0x01, 0x90, 0x01, 0x93, 0x01, 0x95, 0x01,
+  0x9b, 0x01, 0xa1, 0x01, 0xa9, 0x01, 0xab, 0x01, 0xae, 0x01, 0xb0, 0x01,
+  0xb4, 0x01, 0xb7, 0x01, 0xb9, 0x01, 0xbc, 0x01, 0xc2, 0x01, 0xc6, 0x01,
+  0xc6, 0x01, 0xc8, 0x01, 0xcb, 0x01, 0xcc, 0x01, 0xcc, 0x01, 0xcf, 0x01,
+  0xd2, 0x01, 0xd6, 0x01, 0xdb, 0x01, 0xdf, 0x01, 0xe4, 0x01, 0xed, 0x01,
+  0xf2, 0x01, 0xf9, 0x01, 0xf9, 0x01, 0xfb, 0x01, 0xfe, 0x01, 0x03, 0x02,
+  0x03, 0x02, 0x03, 0x02, 0x05, 0x02, 0x07, 0x02, 0x08, 0x02, 0x09, 0x02,
+  0x0a, 0x02, 0x0c, 0x02, 0x0d, 0x02, 0x0e, 0x02, 0x0f, 0x02, 0x0f, 0x02,
+  0x10, 0x02, 0x12, 0x02, 0x14, 0x02, 0x1a, 0x02, 0x1b, 0x02, 0x1d, 0x02,
+  0x25, 0x02, 0x29, 0x02, 0x2d, 0x02, 0x2d, 0x02, 0x2f, 0x02, 0x30, 0x02,
+  0x31, 0x02, 0x31, 0x02, 0x31, 0x02, 0x31, 0x02, 0x31, 0x02, 0x37, 0x02,
+  0x3d, 0x02, 0x44, 0x02, 0x48, 0x02, 0x51, 0x02, 0x55, 0x02, 0x5c, 0x02,
+  0x60, 0x02, 0x63, 0x02, 0x67, 0x02, 0x6d, 0x02, 0x72, 0x02, 0x75, 0x02,
+  0x7b, 0x02, 0x7d, 0x02, 0x80, 0x02, 0x83, 0x02, 0x84, 0x02, 0x85, 0x02,
+  0x86, 0x02, 0x88, 0x02, 0x8b, 0x02, 0x8c, 0x02, 0x8d, 0x02, 0x8e, 0x02,
+  0x91, 0x02, 0x93, 0x02, 0x96, 0x02, 0x97, 0x02, 0x97, 0x02, 0x97, 0x02,
+  0x9a, 0x02, 0x9d, 0x02, 0x9d, 0x02, 0x9d, 0x02, 0xa5, 0x02, 0xa9, 0x02,
+  0xaa, 0x02, 0xad, 0x02, 0xb0, 0x02, 0xb3, 0x02, 0xb6, 0x02, 0xc0, 0x02,
+  0xc5, 0x02, 0xc5, 0x02, 0xc8, 0x02, 0xcd, 0x02, 0xcd, 0x02, 0xce, 0x02,
+  0xce, 0x02, 0xd4, 0x02, 0xd4, 0x02, 0xd4, 0x02, 0xd4, 0x02, 0xd7, 0x02,
+  0xd7, 0x02, 0xd7, 0x02, 0xd7, 0x02, 0xde, 0x02, 0xe0, 0x02, 0xe4, 0x02,
+  0xe5, 0x02, 0xe7, 0x02, 0xe9, 0x02, 0xf0, 0x02, 0xf2, 0x02, 0xf2, 0x02,
+  0xf5, 0x02, 0xf7, 0x02, 0xf7, 0x02, 0xf8, 0x02, 0xf8, 0x02, 0xfc, 0x02,
+  0xfc, 0x02, 0x00, 0x03, 0x00, 0x03, 0x01, 0x03, 0x02, 0x03, 0x03, 0x03,
+  0x04, 0x03, 0x07, 0x03, 0x07, 0x03, 0x09, 0x03, 0x09, 0x03, 0x0a, 0x03,
+  0x0b, 0x03, 0x0e, 0x03, 0x12, 0x03, 0x17, 0x03, 0x18, 0x03, 0x18, 0x03,
+  0x1a, 0x03, 0x1d, 0x03, 0x1e, 0x03, 0x1f, 0x03, 0x21, 0x03, 0x28, 0x03,
+  0x2c, 0x03, 0x2d, 0x03, 0x32, 0x03, 0x36, 0x03, 0x37, 0x03, 0x3e, 0x03,
+  0x3f, 0x03, 0x41, 0x03, 0x44, 0x03, 0x48, 0x03, 0x49, 0x03, 0x4f, 0x03,
+  0x51, 0x03, 0x52, 0x03, 0x56, 0x03, 0x58, 0x03, 0x58, 0x03, 0x58, 0x03,
+  0x59, 0x03, 0x5a, 0x03, 0x5b, 0x03, 0x5e, 0x03, 0x61, 0x03, 0x62, 0x03,
+  0x64, 0x03, 0x66, 0x03, 0x68, 0x03, 0x6c, 0x03, 0x6f, 0x03, 0x70, 0x03,
+  0x72, 0x03, 0x75, 0x03, 0x76, 0x03, 0x77, 0x03, 0x77, 0x03, 0x78, 0x03,
+  0x7b, 0x03, 0x7d, 0x03, 0x7d, 0x03, 0x81, 0x03, 0x85, 0x03, 0x85, 0x03,
+  0x88, 0x03, 0x8a, 0x03, 0x8b, 0x03, 0x8c, 0x03, 0x8e, 0x03, 0x91, 0x03,
+  0x91, 0x03, 0x92, 0x03, 0x94, 0x03, 0x95, 0x03, 0x97, 0x03, 0x9b, 0x03,
+  0x9e, 0x03, 0x9f, 0x03, 0xa1, 0x03, 0xa3, 0x03, 0xa6, 0x03, 0xac, 0x03,
+  0xb2, 0x03, 0xb4, 0x03, 0xbf, 0x03, 0xc1, 0x03, 0xc4, 0x03, 0xc4, 0x03,
+  0xca, 0x03, 0xcb, 0x03, 0xce, 0x03, 0xd0, 0x03, 0xd2, 0x03, 0xd4, 0x03,
+  0xd7, 0x03, 0xd9, 0x03, 0xdd, 0x03, 0xdf, 0x03, 0xe3, 0x03, 0xe5, 0x03,
+  0xe6, 0x03, 0xe7, 0x03, 0xe7, 0x03, 0xe7, 0x03, 0xe8, 0x03, 0xe9, 0x03,
+  0xea, 0x03, 0xeb, 0x03, 0xee, 0x03, 0xf3, 0x03, 0xf6, 0x03, 0xf8, 0x03,
+  0xf9, 0x03, 0xfe, 0x03, 0xfe, 0x03, 0xff, 0x03, 0x03, 0x04, 0x03, 0x04,
+  0x04, 0x04, 0x05, 0x04, 0x09, 0x04, 0x0b, 0x04, 0x0e, 0x04, 0x11, 0x04,
+  0x12, 0x04, 0x15, 0x04, 0x16, 0x04, 0x19, 0x04, 0x1c, 0x04, 0x1c, 0x04,
+  0x1d, 0x04, 0x1e, 0x04, 0x22, 0x04, 0x23, 0x04, 0x23, 0x04, 0x25, 0x04,
+  0x2a, 0x04, 0x2b, 0x04, 0x2b, 0x04, 0x2c, 0x04, 0x2e, 0x04, 0x2f, 0x04,
+  0x2f, 0x04, 0x2f, 0x04, 0x31, 0x04, 0x32, 0x04, 0x35, 0x04, 0x35, 0x04,
+  0x3a, 0x04, 0x3b, 0x04, 0x3d, 0x04, 0x3d, 0x04, 0x3e, 0x04, 0x3f, 0x04,
+  0x42, 0x04, 0x49, 0x04, 0x49, 0x04, 0x4b, 0x04, 0x50, 0x04, 0x53, 0x04,
+  0x54, 0x04, 0x54, 0x04, 0x57, 0x04, 0x58, 0x04, 0x59, 0x04, 0x5a, 0x04,
+  0x5b, 0x04, 0x5b, 0x04, 0x17, 0x05, 0x18, 0x05, 0x1a, 0x05, 0x1b, 0x05,
+  0x1b, 0x05, 0x1d, 0x05, 0x1e, 0x05, 0x26, 0x05, 0x26, 0x05, 0x26, 0x05,
+  0x27, 0x05, 0x2a, 0x05, 0x2d, 0x05, 0x36, 0x05, 0x37, 0x05, 0x3b, 0x05,
+  0x43, 0x05, 0x45, 0x05, 0x47, 0x05, 0x48, 0x05, 0x49, 0x05, 0x4c, 0x05,
+  0x52, 0x05, 0x58, 0x05, 0x5b, 0x05, 0x62, 0x05, 0x67, 0x05, 0x69, 0x05,
+  0x6c, 0x05, 0x6e, 0x05, 0x70, 0x05, 0x70, 0x05, 0x72, 0x05, 0x73, 0x05,
+  0x73, 0x05, 0x75, 0x05, 0x77, 0x05, 0x78, 0x05, 0x79, 0x05, 0x79, 0x05,
+  0x7c, 0x05, 0x7d, 0x05, 0x7e, 0x05, 0x80, 0x05, 0x81, 0x05, 0x82, 0x05,
+  0x84, 0x05, 0x8a, 0x05, 0x91, 0x05, 0x91, 0x05, 0x92, 0x05, 0x98, 0x05,
+  0x9d, 0x05, 0x9f, 0x05, 0xa4, 0x05, 0xab, 0x05, 0xb0, 0x05, 0xb1, 0x05,
+  0xb2, 0x05, 0xb8, 0x05, 0xbc, 0x05, 0xbc, 0x05, 0xbd, 0x05, 0xbe, 0x05,
+  0xc1, 0x05, 0xc1, 0x05, 0xc2, 0x05, 0xc9, 0x05, 0xcc, 0x05, 0xd3, 0x05,
+  0xd9, 0x05, 0xe2, 0x05, 0xef, 0x05, 0xf9, 0x05, 0x04, 0x06, 0x06, 0x06,
+  0x0a, 0x06, 0x10, 0x06, 0x16, 0x06, 0x17, 0x06, 0x1a, 0x06, 0x1c, 0x06,
+  0x1d, 0x06, 0x23, 0x06, 0x28, 0x06, 0x2d, 0x06, 0x35, 0x06, 0x3c, 0x06,
+  0x4b, 0x06, 0x59, 0x06, 0x60, 0x06, 0x66, 0x06, 0x69, 0x06, 0x6c, 0x06,
+  0x73, 0x06, 0x73, 0x06, 0x73, 0x06, 0x75, 0x06, 0x79, 0x06, 0x7f, 0x06,
+  0x84, 0x06, 0x87, 0x06, 0x89, 0x06, 0x8d, 0x06, 0x8f, 0x06, 0x92, 0x06,
+  0x94, 0x06, 0x96, 0x06, 0x99, 0x06, 0x9b, 0x06, 0x9c, 0x06, 0x9f, 0x06,
+  0x9f, 0x06, 0xa5, 0x06, 0xa8, 0x06, 0xaf, 0x06, 0xaf, 0x06, 0xb0, 0x06,
+  0xb3, 0x06, 0xb4, 0x06, 0xb5, 0x06, 0xb7, 0x06, 0xb9, 0x06, 0xb9, 0x06,
+  0xb9, 0x06, 0xba, 0x06, 0xbb, 0x06, 0xbd, 0x06, 0xbf, 0x06, 0xc4, 0x06,
+  0xc8, 0x06, 0xcc, 0x06, 0xd0, 0x06, 0xd3, 0x06, 0xd6, 0x06, 0xd8, 0x06,
+  0xd8, 0x06, 0xda, 0x06, 0xdc, 0x06, 0xde, 0x06, 0xde, 0x06, 0xde, 0x06,
+  0xde, 0x06, 0xdf, 0x06, 0xe1, 0x06, 0xe5, 0x06, 0xec, 0x06, 0xee, 0x06,
+  0xf2, 0x06, 0xf6, 0x06, 0xfb, 0x06, 0xfc, 0x06, 0xfe, 0x06, 0x01, 0x07,
+  0x02, 0x07, 0x02, 0x07, 0x03, 0x07, 0x03, 0x07, 0x05, 0x07, 0x06, 0x07,
+  0x07, 0x07, 0x08, 0x07, 0x0b, 0x07, 0x0f, 0x07, 0x0f, 0x07, 0x12, 0x07,
+  0x13, 0x07, 0x14, 0x07, 0x15, 0x07, 0x16, 0x07, 0x19, 0x07, 0x1d, 0x07,
+  0x1d, 0x07, 0x1e, 0x07, 0x23, 0x07, 0x26, 0x07, 0x28, 0x07, 0x29, 0x07,
+  0x2a, 0x07, 0x2f, 0x07, 0x31, 0x07, 0x35, 0x07, 0x35, 0x07, 0x3b, 0x07,
+  0x40, 0x07, 0x43, 0x07, 0x46, 0x07, 0x48, 0x07, 0x4a, 0x07, 0x4a, 0x07,
+  0x4c, 0x07, 0x4f, 0x07, 0x4f, 0x07, 0x4f, 0x07, 0x4f, 0x07, 0x56, 0x07,
+  0x56, 0x07, 0x56, 0x07, 0x57, 0x07, 0x59, 0x07, 0x59, 0x07, 0x5b, 0x07,
+  0x5c, 0x07, 0x5e, 0x07, 0x60, 0x07, 0x60, 0x07, 0x62, 0x07, 0x66, 0x07,
+  0x66, 0x07, 0x67, 0x07, 0x67, 0x07, 0x6c, 0x07, 0x6e, 0x07, 0x6f, 0x07,
+  0x73, 0x07, 0x77, 0x07, 0x79, 0x07, 0x7b, 0x07, 0x7d, 0x07, 0x7d, 0x07,
+  0x7d, 0x07, 0x80, 0x07, 0x80, 0x07, 0x85, 0x07, 0x85, 0x07, 0x87, 0x07,
+  0x87, 0x07, 0x8c, 0x07, 0x8e, 0x07, 0x8f, 0x07, 0x8f, 0x07, 0x8f, 0x07,
+  0x8f, 0x07, 0x8f, 0x07, 0x93, 0x07, 0x96, 0x07, 0x97, 0x07, 0x97, 0x07,
+  0x98, 0x07, 0x9a, 0x07, 0x9a, 0x07, 0x9c, 0x07, 0x9c, 0x07, 0x9d, 0x07,
+  0x9d, 0x07, 0x9f, 0x07, 0xa5, 0x07, 0xa6, 0x07, 0xa6, 0x07, 0xa6, 0x07,
+  0xa8, 0x07, 0xa8, 0x07, 0xa9, 0x07, 0xa9, 0x07, 0xaa, 0x07, 0xac, 0x07,
+  0xaf, 0x07, 0xb0, 0x07, 0xb0, 0x07, 0xb5, 0x07, 0xb7, 0x07, 0xb8, 0x07,
+  0xb9, 0x07, 0xb9, 0x07, 0xbb, 0x07, 0xbb, 0x07, 0xbb, 0x07, 0xbb, 0x07,
+  0xbc, 0x07, 0xbc, 0x07, 0xbd, 0x07, 0xbe, 0x07, 0xc0, 0x07, 0xc1, 0x07,
+  0xc2, 0x07, 0xc6, 0x07, 0xcf, 0x07, 0xd1, 0x07, 0xd3, 0x07, 0xd9, 0x07,
+  0xdc, 0x07, 0xe0, 0x07, 0xe4, 0x07, 0xe6, 0x07, 0xe7, 0x07, 0xe9, 0x07,
+  0xea, 0x07, 0xea, 0x07, 0xeb, 0x07, 0xed, 0x07, 0xed, 0x07, 0xed, 0x07,
+  0xf3, 0x07, 0xf5, 0x07, 0xf5, 0x07, 0xf8, 0x07, 0xfb, 0x07, 0xfe, 0x07,
+  0xff, 0x07, 0x01, 0x08, 0x03, 0x08, 0x07, 0x08, 0x10, 0x08, 0x18, 0x08,
+  0x19, 0x08, 0x1b, 0x08, 0x23, 0x08, 0x25, 0x08, 0x26, 0x08, 0x2d, 0x08,
+  0x30, 0x08, 0x30, 0x08, 0x33, 0x08, 0x3d, 0x08, 0x40, 0x08, 0x41, 0x08,
+  0x41, 0x08, 0x43, 0x08, 0x46, 0x08, 0x46, 0x08, 0x4a, 0x08, 0x4e, 0x08,
+  0x50, 0x08, 0x53, 0x08, 0x55, 0x08, 0x62, 0x08, 0x68, 0x08, 0x6e, 0x08,
+  0x71, 0x08, 0x7a, 0x08, 0x85, 0x08, 0x8d, 0x08, 0x94, 0x08, 0x9c, 0x08,
+  0xa4, 0x08, 0xa6, 0x08, 0xa8, 0x08, 0xaf, 0x08, 0xb2, 0x08, 0xb5, 0x08,
+  0xbd, 0x08, 0xc2, 0x08, 0xc5, 0x08, 0xc7, 0x08, 0xcc, 0x08, 0xd5, 0x08,
+  0xd8, 0x08, 0xde, 0x08, 0xe2, 0x08, 0xe4, 0x08, 0xe7, 0x08, 0xe9, 0x08,
+  0xea, 0x08, 0xed, 0x08, 0xf0, 0x08, 0xf3, 0x08, 0xf6, 0x08, 0xf7, 0x08,
+  0xf8, 0x08, 0xf8, 0x08, 0xfa, 0x08, 0xfe, 0x08, 0xfe, 0x08, 0xfe, 0x08,
+  0xff, 0x08, 0x01, 0x09, 0x03, 0x09, 0x03, 0x09, 0x06, 0x09, 0x08, 0x09,
+  0x0a, 0x09, 0x0b, 0x09, 0x0e, 0x09, 0x10, 0x09, 0x12, 0x09, 0x12, 0x09,
+  0x13, 0x09, 0x16, 0x09, 0x16, 0x09, 0x16, 0x09, 0x17, 0x09, 0x1e, 0x09,
+  0x1e, 0x09, 0x1f, 0x09, 0x23, 0x09, 0x2a, 0x09, 0x2a, 0x09, 0x2b, 0x09,
+  0x2d, 0x09, 0x2e, 0x09, 0x2e, 0x09, 0x31, 0x09, 0x32, 0x09, 0x35, 0x09,
+  0x36, 0x09, 0x38, 0x09, 0x39, 0x09, 0x39, 0x09, 0x3e, 0x09, 0x40, 0x09,
+  0x45, 0x09, 0x45, 0x09, 0x45, 0x09, 0x46, 0x09, 0x4a, 0x09, 0x4f, 0x09,
+  0x55, 0x09, 0x5b, 0x09, 0x63, 0x09, 0x65, 0x09, 0x6a, 0x09, 0x6a, 0x09,
+  0x6e, 0x09, 0x70, 0x09, 0x71, 0x09, 0x72, 0x09, 0x76, 0x09, 0x79, 0x09,
+  0x7b, 0x09, 0x7d, 0x09, 0x7e, 0x09, 0x82, 0x09, 0x84, 0x09, 0x86, 0x09,
+  0x8b, 0x09, 0x8e, 0x09, 0x90, 0x09, 0x91, 0x09, 0x91, 0x09, 0x92, 0x09,
+  0x94, 0x09, 0x96, 0x09, 0x9e, 0x09, 0x9f, 0x09, 0xa5, 0x09, 0xa6, 0x09,
+  0xae, 0x09, 0xb7, 0x09, 0xbd, 0x09, 0xc6, 0x09, 0xcb, 0x09, 0xcd, 0x09,
+  0xd2, 0x09, 0xd4, 0x09, 0xd8, 0x09, 0xdb, 0x09, 0xde, 0x09, 0xe2, 0x09,
+  0xe4, 0x09, 0xe4, 0x09, 0xe8, 0x09, 0xed, 0x09, 0xee, 0x09, 0xef, 0x09,
+  0xf7, 0x09, 0xfc, 0x09, 0xfe, 0x09, 0x03, 0x0a, 0x07, 0x0a, 0x08, 0x0a,
+  0x08, 0x0a, 0x0a, 0x0a, 0x0d, 0x0a, 0x0d, 0x0a, 0x0f, 0x0a, 0x14, 0x0a,
+  0x15, 0x0a, 0x16, 0x0a, 0x17, 0x0a, 0x17, 0x0a, 0x19, 0x0a, 0x1d, 0x0a,
+  0x1f, 0x0a, 0x23, 0x0a, 0x23, 0x0a, 0x23, 0x0a, 0x24, 0x0a, 0x24, 0x0a,
+  0x28, 0x0a, 0x29, 0x0a, 0x2b, 0x0a, 0x2d, 0x0a, 0x31, 0x0a, 0x34, 0x0a,
+  0x39, 0x0a, 0x40, 0x0a, 0x4a, 0x0a, 0x55, 0x0a, 0x56, 0x0a, 0x5c, 0x0a,
+  0x5d, 0x0a, 0x60, 0x0a, 0x61, 0x0a, 0x63, 0x0a, 0x64, 0x0a, 0x64, 0x0a,
+  0x65, 0x0a, 0x68, 0x0a, 0x6d, 0x0a, 0x6d, 0x0a, 0x70, 0x0a, 0x74, 0x0a,
+  0x7f, 0x0a, 0x83, 0x0a, 0x87, 0x0a, 0x88, 0x0a, 0x8c, 0x0a, 0x8c, 0x0a,
+  0x8c, 0x0a, 0x8c, 0x0a, 0x91, 0x0a, 0x91, 0x0a, 0x93, 0x0a, 0x94, 0x0a,
+  0x99, 0x0a, 0x9a, 0x0a, 0xa0, 0x0a, 0xa1, 0x0a, 0xa3, 0x0a, 0xa3, 0x0a,
+  0xa3, 0x0a, 0xa4, 0x0a, 0xa4, 0x0a, 0xa5, 0x0a, 0xa9, 0x0a, 0xaa, 0x0a,
+  0xab, 0x0a, 0xb1, 0x0a, 0xb2, 0x0a, 0xb7, 0x0a, 0xba, 0x0a, 0xc2, 0x0a,
+  0xc7, 0x0a, 0xd2, 0x0a, 0xd4, 0x0a, 0xd9, 0x0a, 0xdb, 0x0a, 0xe7, 0x0a,
+  0xea, 0x0a, 0xed, 0x0a, 0xee, 0x0a, 0xef, 0x0a, 0xf0, 0x0a, 0xf0, 0x0a,
+  0xf0, 0x0a, 0xf4, 0x0a, 0xf6, 0x0a, 0xf7, 0x0a, 0xfc, 0x0a, 0xfd, 0x0a,
+  0x00, 0x0b, 0x00, 0x00, 0x12, 0x56, 0xdf, 0x3a, 0xdb, 0x13, 0xfc, 0x06,
+  0x49, 0x17, 0x63, 0x78, 0x6d, 0x70, 0x07, 0xd3, 0x04, 0xa5, 0x23, 0xb8,
+  0xad, 0xa9, 0x4f, 0xc6, 0x4d, 0xf0, 0x85, 0xa6, 0x26, 0x02, 0xfc, 0x29,
+  0xc0, 0xbb, 0x11, 0x80, 0x7f, 0x10, 0x02, 0x4e, 0x8b, 0x08, 0x02, 0xd7,
+  0x04, 0x42, 0xd8, 0x67, 0xc6, 0x16, 0xb6, 0xea, 0x6b, 0x06, 0x65, 0x94,
+  0x89, 0x3d, 0xcf, 0xde, 0x2f, 0xec, 0x0f, 0x82, 0xdd, 0xdd, 0x04, 0xe2,
+  0x94, 0x70, 0x56, 0x9a, 0x56, 0xf3, 0x63, 0x42, 0xdf, 0x2e, 0xae, 0xe8,
+  0x28, 0xe8, 0x2c, 0x6e, 0xdf, 0xff, 0xdf, 0xab, 0x53, 0xa0, 0x53, 0x33,
+  0x01, 0x21, 0x4d, 0xc4, 0xc4, 0x76, 0x92, 0xbf, 0x3c, 0x72, 0xaf, 0xd6,
+  0x13, 0x13, 0x5b, 0x34, 0x65, 0xd0, 0xc7, 0xa9, 0x10, 0x44, 0x66, 0x61,
+  0xae, 0xb7, 0x34, 0x44, 0x35, 0xbe, 0x35, 0xd7, 0x77, 0x5b, 0xe3, 0xd9,
+  0xb8, 0x90, 0x0d, 0x1a, 0x99, 0xc3, 0xa9, 0x7e, 0x7d, 0x30, 0x90, 0xc2,
+  0xa5, 0xba, 0x44, 0xbf, 0xb7, 0xf9, 0x85, 0xe4, 0xff, 0x38, 0x1e, 0x27,
+  0x50, 0xfa, 0x06, 0xf3, 0x49, 0x1a, 0x4b, 0xa3, 0xfb, 0x2e, 0xae, 0xed,
+  0x2a, 0x72, 0x71, 0x20, 0xc9, 0x74, 0x8d, 0xce, 0x79, 0x40, 0x7c, 0xb9,
+  0xf7, 0x26, 0xc3, 0x4c, 0xae, 0x90, 0xe8, 0xe7, 0x40, 0x2f, 0xa9, 0x94,
+  0xda, 0x5b, 0x75, 0x31, 0x8a, 0xe5, 0xce, 0xd4, 0xd1, 0x60, 0x55, 0x48,
+  0x5f, 0xa3, 0x6f, 0x77, 0xc3, 0x58, 0xf1, 0x1e, 0x1a, 0x0b, 0xd2, 0x5f,
+  0x05, 0x1e, 0x4b, 0x67, 0x46, 0xf0, 0x1a, 0x6c, 0x16, 0xb6, 0xb6, 0x70,
+  0x01, 0x10, 0x54, 0xde, 0x1a, 0xff, 0xb2, 0x2e, 0xc0, 0x1b, 0x16, 0x50,
+  0x2a, 0x27, 0xee, 0x92, 0x88, 0x01, 0x97, 0x10, 0xef, 0xdc, 0xc7, 0x69,
+  0x13, 0xd6, 0xe3, 0xaf, 0x7f, 0x06, 0x7d, 0x09, 0x88, 0xcc, 0xab, 0xc8,
+  0xde, 0xb8, 0x73, 0x41, 0xae, 0xcf, 0xb6, 0x1a, 0x6b, 0xfa, 0xdf, 0xab,
+  0x7f, 0x09, 0x94, 0xe3, 0x9c, 0xb0, 0xd8, 0xc5, 0x3f, 0xfb, 0xef, 0xc5,
+  0x1d, 0xb4, 0x32, 0x1e, 0x66, 0xed, 0x14, 0x7e, 0x46, 0x2e, 0xe6, 0xf6,
+  0xb3, 0x16, 0xd1, 0x56, 0x82, 0x58, 0x9b, 0x9d, 0xbc, 0x08, 0xa1, 0xe3,
+  0xe2, 0x96, 0xeb, 0x4f, 0x77, 0xd7, 0x01, 0x89, 0x6e, 0xe0, 0xfd, 0x28,
+  0x07, 0x29, 0xfe, 0xbc, 0x6d, 0x0b, 0x7a, 0xb2, 0x1b, 0xa1, 0xb0, 0x76,
+  0x43, 0x1c, 0xee, 0x9f, 0x7c, 0x2d, 0x7a, 0xb1, 0xdd, 0xe8, 0x19, 0x3e,
+  0xce, 0xec, 0xe3, 0x6f, 0x79, 0x45, 0x3e, 0x81, 0x69, 0x95, 0x66, 0xa9,
+  0x02, 0x8a, 0x5b, 0xca, 0xcf, 0xa6, 0x48, 0x57, 0xe3, 0x0e, 0xec, 0x6c,
+  0x04, 0x08, 0x13, 0x11, 0x87, 0x00, 0xc3, 0x57, 0xf7, 0x78, 0x8c, 0x60,
+  0x7d, 0x49, 0x1f, 0xa5, 0x29, 0xc1, 0xe7, 0x96, 0xb6, 0x1b, 0xce, 0x95,
+  0xaf, 0x9f, 0xc0, 0x10, 0x7c, 0x44, 0xbe, 0x21, 0x50, 0x8b, 0xc4, 0xe5,
+  0x64, 0x3f, 0xf7, 0x93, 0x71, 0xb8, 0xde, 0xf5, 0xe3, 0xb1, 0xc8, 0x18,
+  0x90, 0xbc, 0x24, 0xa8, 0x49, 0x00, 0x2f, 0x56, 0x8c, 0xa2, 0x7a, 0x79,
+  0x72, 0x3f, 0x64, 0xb5, 0x57, 0x2a, 0x94, 0x39, 0x03, 0x7b, 0x48, 0x5e,
+  0xcb, 0xca, 0x1e, 0xe3, 0x96, 0xa3, 0x22, 0x07, 0xdb, 0x33, 0x84, 0xe0,
+  0x06, 0xc4, 0xa7, 0x9c, 0x27, 0x5e, 0xc9, 0xba, 0xb7, 0xb4, 0x5c, 0x1e,
+  0x80, 0xdc, 0xfd, 0x4e, 0xe6, 0xed, 0xf7, 0xc9, 0x9f, 0x1d, 0xb7, 0xa1,
+  0xe8, 0x4a, 0xcc, 0x07, 0x04, 0x9b, 0x2d, 0xc9, 0xc5, 0xe8, 0xbb, 0xb8,
+  0x2e, 0x57, 0x06, 0x06, 0x8a, 0xa2, 0x69, 0x55, 0x7c, 0xb8, 0x75, 0xa1,
+  0xd6, 0x7e, 0x39, 0x95, 0x03, 0x59, 0x64, 0xb2, 0xba, 0x77, 0x29, 0xf8,
+  0x2e, 0x03, 0x33, 0xbd, 0xe7, 0x32, 0x5a, 0x11, 0xbb, 0xe7, 0x12, 0xa0,
+  0xf1, 0xfa, 0x16, 0xb1, 0xaa, 0xe2, 0xc9, 0x9c, 0x69, 0x90, 0x48, 0xbf,
+  0x72, 0x90, 0x13, 0xab, 0x83, 0x88, 0xa1, 0x39, 0x84, 0xf4, 0x5c, 0xc4,
+  0x11, 0x8a, 0xa2, 0xc6, 0x60, 0xdd, 0x26, 0x3f, 0xe5, 0xcf, 0x07, 0x77,
+  0xe6, 0x03, 0x5f, 0x4b, 0xf7, 0x4b, 0xf7, 0x11, 0x51, 0xfd, 0xce, 0xd3,
+  0x2a, 0x57, 0xbf, 0x8f, 0xe5, 0xa0, 0x8c, 0x08, 0x5a, 0xcf, 0x43, 0x47,
+  0xd1, 0x98, 0x8d, 0x36, 0xe7, 0xfc, 0x56, 0xd3, 0x98, 0x89, 0x21, 0x65,
+  0xa7, 0x29, 0xb6, 0xbe, 0x30, 0x4a, 0xc4, 0xdf, 0x47, 0x94, 0x5d, 0xec,
+  0xba, 0x49, 0x73, 0x86, 0xc0, 0x9c, 0x97, 0x13, 0x8b, 0x8f, 0x0f, 0x4f,
+  0x8e, 0xbc, 0x27, 0xa3, 0xbd, 0x49, 0x5b, 0x34, 0x67, 0x52, 0xb5, 0x2d,
+  0x54, 0xee, 0x49, 0x56, 0x34, 0x97, 0x5c, 0xdc, 0x6d, 0xe7, 0xbf, 0xa6,
+  0x48, 0x93, 0xef, 0x14, 0x6b, 0x78, 0x99, 0x45, 0xa3, 0x99, 0x6d, 0x87,
+  0x84, 0x71, 0x3b, 0xb0, 0x65, 0xdc, 0x8b, 0x31, 0xc5, 0xc1, 0xaf, 0x5f,
+  0xe9, 0x43, 0xb3, 0x23, 0x25, 0xcd, 0x97, 0xba, 0xe5, 0xe8, 0x9d, 0x0e,
+  0x7d, 0x74, 0x6f, 0x7e, 0x41, 0x30, 0xe3, 0x2e, 0x7f, 0xeb, 0xeb, 0x22,
+  0x43, 0x8d, 0x8d, 0x71, 0xfc, 0xe5, 0xbd, 0xb6, 0xb7, 0x4b, 0xac, 0xc5,
+  0xca, 0x0e, 0xdf, 0x8e, 0xf6, 0xc0, 0x5d, 0x63, 0x2e, 0x5b, 0x6d, 0x9e,
+  0x6d, 0x3a, 0x31, 0x2f, 0x08, 0x0d, 0x08, 0x31, 0x0e, 0xc7, 0xc4, 0xc4,
+  0x78, 0xdc, 0x55, 0xa6, 0x3b, 0xc4, 0xe8, 0xbd, 0xfc, 0xbf, 0x9d, 0x84,
+  0xdc, 0x87, 0x73, 0x65, 0xd6, 0x17, 0xb8, 0x6c, 0x7c, 0xf9, 0x5a, 0xe3,
+  0x25, 0x2a, 0xfb, 0xc9, 0xe4, 0xb3, 0xa2, 0xb4, 0xf7, 0x02, 0x0c, 0xb4,
+  0x4f, 0xdb, 0xc3, 0x86, 0xad, 0xf9, 0x8b, 0xd3, 0x09, 0x04, 0x4a, 0x98,
+  0x2d, 0x28, 0x3b, 0x91, 0x66, 0xb7, 0x7e, 0xef, 0xab, 0x69, 0xc6, 0x48,
+  0x0b, 0x13, 0x05, 0x8e, 0x67, 0x70, 0x15, 0x84, 0x8c, 0x53, 0x5d, 0x31,
+  0x73, 0x46, 0x5a, 0x9c, 0xd6, 0x6e, 0xa0, 0x22, 0x47, 0x6c, 0xed, 0xc5,
+  0x14, 0xdc, 0x55, 0x15, 0x92, 0x64, 0x8d, 0xa1, 0x64, 0xb5, 0xeb, 0x3e,
+  0x06, 0x3a, 0xe0, 0x35, 0x1f, 0xce, 0x10, 0xa6, 0x5d, 0xdf, 0x36, 0x05,
+  0xf2, 0x71, 0x55, 0x63, 0x3b, 0x87, 0xcb, 0xe2, 0x9a, 0xe1, 0x58, 0xe0,
+  0x8c, 0xf9, 0x0b, 0x52, 0x9e, 0xa1, 0x7d, 0x7e, 0xa4, 0x28, 0xcb, 0xfc,
+  0xaa, 0x06, 0xb7, 0x55, 0xa0, 0x1e, 0xe9, 0xa1, 0x22, 0x4b, 0xc8, 0x11,
+  0xb5, 0x2c, 0xfd, 0x2b, 0x6c, 0xf2, 0x22, 0x4f, 0x28, 0xb1, 0xf6, 0x5f,
+  0xe7, 0x9b, 0x84, 0x18, 0xc2, 0xfe, 0x15, 0x55, 0xae, 0x92, 0x36, 0xc0,
+  0x28, 0x45, 0x11, 0x4c, 0x2d, 0x54, 0xb2, 0xcb, 0x7b, 0x7f, 0x52, 0x98,
+  0x7d, 0x77, 0xa2, 0x82, 0x0f, 0x54, 0x66, 0xb0, 0xea, 0x57, 0x24, 0xe6,
+  0x1b, 0xab, 0x92, 0x05, 0x0e, 0xb9, 0xeb, 0xf4, 0x64, 0x76, 0xdf, 0xea,
+  0x99, 0xa2, 0xd2, 0x88, 0x56, 0x81, 0x5d, 0x01, 0xc4, 0xc8, 0x12, 0x81,
+  0xdb, 0x9f, 0x58, 0x6c, 0x19, 0x29, 0x15, 0x23, 0x02, 0x18, 0x96, 0x6f,
+  0xa4, 0x07, 0x33, 0xe1, 0x41, 0x8f, 0x64, 0x4e, 0x01, 0x48, 0x05, 0x0a,
+  0x78, 0xad, 0x80, 0x1d, 0xb8, 0xff, 0xf6, 0x4d, 0xc0, 0x09, 0x28, 0x01,
+  0x81, 0xaa, 0xaa, 0xc6, 0xd2, 0xa0, 0xc0, 0xae, 0x86, 0xad, 0x66, 0x9a,
+  0x82, 0x12, 0x54, 0xe6, 0xf9, 0x8d, 0x6a, 0xb3, 0xf2, 0xe0, 0x7a, 0x89,
+  0x2a, 0x8f, 0x4d, 0xb5, 0x4e, 0xc8, 0x19, 0x9c, 0x6d, 0x0e, 0xa3, 0xbb,
+  0xd5, 0x94, 0xc5, 0x3a, 0x27, 0x57, 0xf7, 0xf1, 0x6f, 0x25, 0x28, 0xa1,
+  0x13, 0xa7, 0xb6, 0x3b, 0x44, 0x2a, 0x2a, 0x98, 0xdd, 0x5c, 0x3f, 0xa9,
+  0x85, 0x14, 0x6b, 0xb3, 0xb9, 0x73, 0x02, 0xdd, 0xae, 0xe7, 0x8d, 0xf2,
+  0xfe, 0x52, 0xcc, 0xe3, 0x4e, 0x27, 0xcd, 0xa2, 0xed, 0x38, 0x07, 0x95,
+  0xc3, 0x35, 0xe0, 0x15, 0x1e, 0xa2, 0x99, 0x57, 0x2b, 0xb7, 0x06, 0x32,
+  0x2f, 0xbe, 0x5b, 0x2a, 0xc9, 0x5d, 0xcd, 0x61, 0x7e, 0x86, 0x73, 0x52,
+  0xa9, 0x1f, 0x6b, 0x0e, 0x78, 0x52, 0x62, 0xdd, 0xd1, 0x68, 0x41, 0xde,
+  0x53, 0x1b, 0xa3, 0x76, 0x44, 0x6c, 0xb9, 0x14, 0x29, 0xe2, 0xed, 0x35,
+  0xc6, 0x3f, 0x95, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57,
+  0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57,
+  0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57,
+  0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57,
+  0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57,
+  0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57,
+  0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57,
+  0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57,
+  0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57,
+  0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57,
+  0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57,
+  0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57,
+  0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57,
+  0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57,
+  0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57,
+  0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0xea, 0x2d,
+  0x77, 0xbc, 0xa6, 0x22, 0x83, 0x9e, 0x8b, 0xe5, 0x86, 0x0c, 0xf3, 0xc4,
+  0xdd, 0x0a, 0xd9, 0x85, 0x88, 0xcc, 0xdc, 0x11, 0xdb, 0x96, 0x99, 0x75,
+  0x47, 0x94, 0x0c, 0x35, 0x31, 0x5f, 0x13, 0xd8, 0xb2, 0xd3, 0x44, 0x66,
+  0xad, 0x80, 0x8f, 0x68, 0x66, 0xad, 0x3c, 0x0d, 0x80, 0x31, 0x1c, 0xb1,
+  0x68, 0x22, 0xba, 0xc5, 0x99, 0xf2, 0x34, 0x1d, 0x19, 0xb1, 0x4c, 0x11,
+  0xd0, 0x6e, 0xdd, 0x40, 0x43, 0xeb, 0x7c, 0x99, 0x45, 0xfb, 0x5d, 0x49,
+  0x39, 0x61, 0xbc, 0xa5, 0x8f, 0x53, 0xeb, 0x3a, 0xf0, 0x13, 0x32, 0xb4,
+  0x4a, 0x94, 0x59, 0x4c, 0xce, 0x04, 0x77, 0x78, 0xff, 0x03, 0x95, 0x01,
+  0x3b, 0x3a, 0x5a, 0x5c, 0x62, 0x8f, 0x8c, 0x30, 0xf2, 0xd2, 0xf5, 0xd1,
+  0xaf, 0xbc, 0xe9, 0x7b, 0x69, 0x0b, 0xdd, 0x6c, 0x11, 0x1f, 0xbe, 0x94,
+  0xe7, 0x30, 0x55, 0x4d, 0x82, 0x75, 0xb4, 0xb1, 0xc9, 0x9d, 0x21, 0x2e,
+  0x4c, 0xef, 0x47, 0x69, 0x1b, 0x8b, 0x06, 0x65, 0x87, 0x3c, 0xd3, 0x0d,
+  0xf5, 0x85, 0x29, 0xcb, 0x33, 0x27, 0xff, 0x96, 0x63, 0xca, 0xa5, 0x8b,
+  0xc4, 0x90, 0xdb, 0xda, 0xf0, 0x0c, 0x09, 0x09, 0xf8, 0xc4, 0xf0, 0x50,
+  0x38, 0xbe, 0x57, 0x6a, 0x4d, 0xc1, 0x3c, 0xd3, 0x07, 0x2b, 0x4d, 0x88,
+  0x70, 0x4b, 0x40, 0x6f, 0xdc, 0x9d, 0x25, 0xb8, 0x2a, 0x4a, 0x54, 0xe7,
+  0xe9, 0x26, 0x4b, 0xd8, 0x2e, 0x62, 0x1c, 0xb2, 0xe9, 0xe6, 0xb2, 0xb3,
+  0x20, 0xbb, 0xd6, 0x96, 0x02, 0x18, 0x7b, 0xad, 0x03, 0x25, 0x79, 0x4b,
+  0xc9, 0xf8, 0xe6, 0xe8, 0x69, 0x75, 0x33, 0x5f, 0x84, 0x40, 0x65, 0x0d,
+  0x0c, 0x8e, 0xc9, 0x3a, 0xc6, 0xb8, 0xed, 0x71, 0x4c, 0xc8, 0x53, 0x9a,
+  0xe4, 0x8d, 0x66, 0x12, 0xbd, 0x77, 0xd7, 0x05, 0xf1, 0x49, 0x13, 0x05,
+  0x9b, 0x8d, 0xf2, 0xef, 0x5c, 0x0c, 0x5a, 0x3a, 0x44, 0x3b, 0x87, 0x79,
+  0x34, 0xd2, 0x6f, 0x31, 0x5e, 0x6a, 0xab, 0xd2, 0x0c, 0x76, 0x48, 0x18,
+  0x49, 0x4d, 0x64, 0x34, 0x55, 0xab, 0x1a, 0x05, 0xce, 0x6e, 0x3e, 0x9d,
+  0xb2, 0x85, 0xcf, 0x8c, 0xc0, 0x51, 0x44, 0x5a, 0xce, 0x1c, 0x96, 0xca,
+  0x9f, 0x60, 0x34, 0x0c, 0x92, 0xc3, 0x62, 0x5a, 0x48, 0x52, 0x9b, 0x35,
+  0xb5, 0xba, 0x0b, 0xd5, 0xa0, 0x4f, 0x36, 0x3a, 0xa5, 0xfa, 0x7f, 0xf0,
+  0x11, 0xea, 0x3f, 0x0e, 0x14, 0x59, 0x18, 0x3c, 0x14, 0x45, 0x11, 0x9c,
+  0x0d, 0xf2, 0x16, 0xa6, 0x0c, 0x64, 0xf5, 0x53, 0xdd, 0x70, 0x4f, 0x1d,
+  0xef, 0x7d, 0x6d, 0xab, 0x6d, 0x4e, 0xff, 0xab, 0x43, 0x4a, 0xf7, 0xc2,
+  0xae, 0x14, 0x35, 0x0f, 0x59, 0x57, 0xa7, 0x3b, 0x26, 0x0a, 0x67, 0x70,
+  0x70, 0x7b, 0xdb, 0x9d, 0xc2, 0x6d, 0x0f, 0x50, 0x1d, 0x60, 0x01, 0xce,
+  0x62, 0x26, 0x5d, 0xae, 0xdf, 0xc3, 0xef, 0xaa, 0x4d, 0x61, 0x1c, 0x7e,
+  0x62, 0x7c, 0x28, 0xbe, 0x6e, 0xe5, 0xda, 0xcb, 0x43, 0x0f, 0xcf, 0x6f,
+  0x13, 0xb7, 0x46, 0x02, 0x96, 0xdf, 0x09, 0x49, 0xa2, 0x99, 0xe7, 0x76,
+  0xb9, 0xca, 0x5a, 0x90, 0x7a, 0xeb, 0x7f, 0x69, 0x3c, 0xb7, 0x38, 0xc1,
+  0xf8, 0xe8, 0x60, 0xd3, 0x49, 0xd8, 0x45, 0x1d, 0xf0, 0xbd, 0x2b, 0xc3,
+  0xe9, 0x18, 0x17, 0x49, 0xc2, 0xb5, 0xae, 0xe3, 0xb2, 0xfc, 0x4f, 0x57,
+  0x46, 0xa2, 0xfe, 0x46, 0x80, 0xd1, 0x0f, 0x2a, 0x4e, 0x7f, 0x67, 0x24,
+  0x22, 0x64, 0x64, 0x69, 0xe5, 0xae, 0x43, 0x86, 0x0c, 0x0a, 0x6e, 0xf8,
+  0x69, 0xe6, 0x86, 0x6f, 0xba, 0xea, 0xc2, 0x3f, 0xe8, 0xba, 0xcb, 0x47,
+  0x37, 0xd5, 0xe0, 0xfe, 0x11, 0x3c, 0x65, 0x45, 0xbd, 0x1d, 0xbf, 0x48,
+  0x12, 0xfb, 0x2d, 0x46, 0xd4, 0x37, 0x36, 0x38, 0x7a, 0x0d, 0x29, 0x6d,
+  0x2f, 0xce, 0xff, 0xc4, 0xdb, 0x03, 0xc1, 0x96, 0x0c, 0x3b, 0xe0, 0x36,
+  0x8a, 0x9c, 0x05, 0xb3, 0xfe, 0xd0, 0x6e, 0xb6, 0x5e, 0x6b, 0xc3, 0xbe,
+  0x60, 0xd0, 0x88, 0x8d, 0x8a, 0xb8, 0xa9, 0xfd, 0x65, 0x63, 0xf2, 0xd1,
+  0xd8, 0xd2, 0x4a, 0xc9, 0x85, 0x07, 0x92, 0x7b, 0x06, 0xba, 0xb4, 0xde,
+  0xf0, 0xc8, 0xc9, 0x9c, 0x35, 0xb5, 0xa1, 0x4a, 0xd4, 0x9a, 0x1d, 0x61,
+  0x49, 0x95, 0x46, 0x1b, 0x3b, 0xf3, 0x13, 0xe2, 0x37, 0x0a, 0xdf, 0xb5,
+  0x61, 0xd5, 0xa1, 0x6f, 0xe3, 0x5f, 0x64, 0x8a, 0x2a, 0xff, 0x17, 0x54,
+  0x4e, 0xc4, 0xba, 0x43, 0x9e, 0x38, 0x31, 0xb6, 0xf0, 0xaa, 0x1b, 0xe7,
+  0x20, 0xc5, 0x94, 0xae, 0xe8, 0x40, 0x96, 0x61, 0x20, 0xf0, 0xda, 0x6b,
+  0x2b, 0xf2, 0x72, 0xbc, 0x37, 0x58, 0x74, 0x4c, 0x94, 0x90, 0xd8, 0xee,
+  0xea, 0xf4, 0x3c, 0x9a, 0x04, 0x63, 0xf1, 0xd3, 0x88, 0x17, 0x5c, 0x79,
+  0xf1, 0xe5, 0x8e, 0xa2, 0x1e, 0xd7, 0xc7, 0xc8, 0xbb, 0x1a, 0xdc, 0xb1,
+  0x43, 0x71, 0x73, 0x93, 0xd4, 0x16, 0xc0, 0x3b, 0x37, 0xb8, 0xfe, 0xb2,
+  0x56, 0x1b, 0x52, 0x99, 0x08, 0x57, 0xa7, 0xdb, 0xbc, 0x37, 0xab, 0x59,
+  0xea, 0xd5, 0x93, 0x80, 0x74, 0xfe, 0x58, 0x11, 0x30, 0x30, 0xca, 0xb4,
+  0x64, 0xab, 0xd7, 0x72, 0x70, 0x5b, 0x47, 0xfa, 0xb0, 0xe2, 0xaa, 0x87,
+  0x72, 0xa8, 0x62, 0x00, 0x16, 0x8d, 0x45, 0x19, 0x58, 0xf2, 0x15, 0xbb,
+  0x4c, 0x36, 0xd5, 0x39, 0x85, 0x7f, 0x56, 0x16, 0xa3, 0xd7, 0x8e, 0x4e,
+  0xb2, 0xd1, 0xfe, 0xc5, 0x6e, 0xdf, 0xd8, 0xff, 0xe7, 0x57, 0x37, 0x8c,
+  0xad, 0x1a, 0x2a, 0xd3, 0x2b, 0xfb, 0x21, 0x8d, 0x24, 0xe0, 0xda, 0x73,
+  0x00, 0x06, 0x81, 0xe8, 0xe2, 0x03, 0x48, 0x09, 0xf2, 0x06, 0x7c, 0x22,
+  0x4a, 0xba, 0x91, 0x96, 0xbc, 0x75, 0x3d, 0xc0, 0x54, 0x59, 0x9e, 0x03,
+  0x4e, 0x07, 0xe6, 0xf3, 0xb5, 0x7f, 0x94, 0x66, 0xf1, 0x2d, 0x83, 0xe5,
+  0x0e, 0x70, 0xd2, 0xcd, 0x56, 0x3e, 0xfc, 0x14, 0x0f, 0xd6, 0xef, 0x22,
+  0xff, 0x73, 0xa1, 0x37, 0xed, 0xec, 0xec, 0xc8, 0x68, 0x00, 0xf2, 0x9f,
+  0x3a, 0x2d, 0x7f, 0x93, 0xe7, 0xcb, 0xe1, 0xea, 0xc2, 0x6b, 0x14, 0xdd,
+  0x66, 0xeb, 0xc5, 0xf4, 0x46, 0xd7, 0x86, 0x02, 0x68, 0x34, 0xe7, 0xf4,
+  0x55, 0xad, 0xfb, 0x33, 0xd2, 0x78, 0xc4, 0x8d, 0x52, 0xbc, 0x83, 0xe4,
+  0xb0, 0x2b, 0x36, 0x2c, 0x3a, 0x13, 0xc5, 0x17, 0x9e, 0x16, 0xaf, 0x56,
+  0x7c, 0xe7, 0xe6, 0x68, 0x82, 0x38, 0xee, 0xd3, 0xce, 0x7d, 0xf5, 0x50,
+  0x2f, 0x10, 0x94, 0x05, 0xc6, 0x29, 0x6e, 0x59, 0xf8, 0xc8, 0x22, 0xbf,
+  0x63, 0x99, 0xce, 0x10, 0x20, 0x1b, 0x74, 0xf2, 0x4f, 0xd5, 0x3d, 0x12,
+  0x58, 0xd6, 0xea, 0x55, 0xe4, 0xd4, 0xa4, 0xed, 0xae, 0x5b, 0xf6, 0xc6,
+  0xc0, 0x4e, 0x02, 0x3f, 0x5a, 0x5e, 0x12, 0xc5, 0x8f, 0xa1, 0xbe, 0x98,
+  0xfe, 0x6f, 0xba, 0x4b, 0xb4, 0x69, 0xe7, 0xfd, 0x8a, 0x0a, 0x12, 0xee,
+  0xa0, 0x74, 0x1b, 0x59, 0xe7, 0x0e, 0x31, 0xff, 0x8a, 0x76, 0x49, 0xc0,
+  0x2c, 0xba, 0x25, 0x72, 0x9f, 0xfd, 0x12, 0x73, 0xb6, 0x72, 0x9f, 0x46,
+  0xa7, 0xbf, 0x9b, 0xe2, 0x3b, 0x83, 0xb4, 0x51, 0x1a, 0x17, 0x83, 0xf8,
+  0xa3, 0xe0, 0xb4, 0x5d, 0xd5, 0x6d, 0xe2, 0x1f, 0x26, 0x46, 0x15, 0x46,
+  0x15, 0xd6, 0x02, 0x5c, 0xd2, 0x18, 0xa4, 0xdb, 0xc1, 0xaf, 0xc2, 0xfa,
+  0x59, 0x5d, 0xa7, 0xbb, 0x2c, 0x09, 0xde, 0x06, 0x30, 0x0d, 0xd4, 0x79,
+  0x74, 0xdb, 0x24, 0xf7, 0x19, 0x20, 0xa2, 0x75, 0x6f, 0xf0, 0xfc, 0x6e,
+  0x51, 0xa5, 0x77, 0x6a, 0xd7, 0x44, 0x82, 0x15, 0x00, 0xf7, 0x80, 0x2e,
+  0xfa, 0xb5, 0x7f, 0x4b, 0xed, 0xe5, 0xc7, 0x4d, 0x05, 0xf9, 0x9c, 0xeb,
+  0xa8, 0x13, 0x13, 0x52, 0xc1, 0x37, 0xe5, 0x9c, 0x44, 0x0b, 0x45, 0xda,
+  0x33, 0x71, 0x5c, 0xfe, 0x49, 0x9d, 0xaf, 0x7a, 0x86, 0x2c, 0x8d, 0xc2,
+  0xcf, 0x82, 0x38, 0xb7, 0xdc, 0xc9, 0x0c, 0x17, 0x49, 0x05, 0x17, 0x86,
+  0xb6, 0x4f, 0xd0, 0xef, 0x70, 0x45, 0x25, 0xb3, 0x40, 0x9b, 0xb0, 0x68,
+  0xb7, 0xe3, 0xc2, 0xe9, 0xe0, 0x54, 0xf5, 0xa3, 0x8e, 0xe4, 0xb6, 0x6d,
+  0x2f, 0x0d, 0x60, 0xab, 0x0d, 0x0d, 0x3b, 0x12, 0x12, 0x8f, 0x0b, 0x36,
+  0xaf, 0x9e, 0xb0, 0x93, 0xd7, 0xc1, 0x58, 0x0b, 0x65, 0x9e, 0x54, 0xd8,
+  0x19, 0x44, 0x1e, 0xee, 0x9f, 0xc3, 0xca, 0x9f, 0x98, 0x9a, 0x37, 0x39,
+  0xff, 0xb2, 0x40, 0x66, 0x4b, 0x47, 0x18, 0xee, 0xe0, 0xb6, 0x3e, 0x50,
+  0xe2, 0xe2, 0x9e, 0xa0, 0xdd, 0x0f, 0xd5, 0xc9, 0x4c, 0x93, 0xa9, 0x63,
+  0xbb, 0x83, 0xcc, 0x5f, 0x61, 0x60, 0x34, 0x32, 0x0e, 0xb5, 0x6d, 0xf4,
+  0xb0, 0x47, 0x1f, 0x29, 0x26, 0x87, 0x5f, 0xec, 0xe8, 0x9f, 0x78, 0xfc,
+  0xda, 0xa3, 0x72, 0x86, 0xb7, 0x09, 0x51, 0x63, 0xf2, 0xa1, 0x71, 0x14,
+  0xbe, 0x31, 0x40, 0x23, 0x55, 0xba, 0xc0, 0x90, 0x01, 0x8f, 0xf4, 0x3e,
+  0x6a, 0x45, 0xc2, 0x00, 0x0e, 0xe4, 0x73, 0xeb, 0x1b, 0x52, 0x88, 0x17,
+  0x46, 0x7f, 0x14, 0x02, 0x63, 0x67, 0x95, 0x48, 0x7f, 0x1c, 0xe6, 0xd5,
+  0x2d, 0x0b, 0x74, 0xc9, 0x05, 0x05, 0x09, 0xaf, 0x93, 0xbc, 0xea, 0xe1,
+  0x12, 0x4a, 0x2d, 0x26, 0xac, 0x66, 0x3e, 0x16, 0x35, 0x6a, 0x0f, 0xd2,
+  0x4f, 0x16, 0x11, 0x8e, 0x4f, 0x8a, 0xd6, 0x72, 0x3e, 0xc4, 0x0c, 0xc9,
+  0x8d, 0x74, 0x50, 0xfe, 0x70, 0x95, 0xcd, 0x6a, 0x94, 0xf6, 0xbc, 0xc5,
+  0x47, 0x9b, 0xfa, 0x37, 0x29, 0x9a, 0x69, 0x82, 0xec, 0xfb, 0xaf, 0x5c,
+  0xab, 0xf3, 0xb1, 0x49, 0xf1, 0x19, 0xc7, 0x78, 0xb7, 0xc7, 0x28, 0x84,
+  0xf8, 0x17, 0xf9, 0xa2, 0x92, 0x5f, 0x1c, 0x1f, 0x5a, 0xd7, 0x85, 0xfa,
+  0xb3, 0x22, 0x78, 0xe8, 0x1d, 0x6d, 0x1f, 0x9f, 0x2a, 0x05, 0x76, 0xc5,
+  0xc5, 0xa3, 0x86, 0x44, 0x81, 0x7b, 0x5d, 0x9c, 0x38, 0xaf, 0x7d, 0x8d,
+  0x66, 0xb4, 0x23, 0x7c, 0x4f, 0x31, 0x99, 0x50, 0x04, 0x53, 0x7b, 0x44,
+  0x09, 0xc8, 0x6f, 0xd6, 0xf7, 0x98, 0xf0, 0xad, 0xd1, 0xcb, 0x9a, 0xf4,
+  0xec, 0x9b, 0x30, 0xaa, 0xe5, 0xe0, 0xfa, 0x17, 0xbe, 0x5d, 0xe7, 0xde,
+  0xad, 0x17, 0x7c, 0xae, 0x76, 0x0f, 0x8b, 0x95, 0x92, 0xe5, 0xea, 0x96,
+  0x1b, 0xc0, 0x23, 0xc3, 0xa0, 0xce, 0xb1, 0xfe, 0x9d, 0x51, 0xf6, 0x99,
+  0x48, 0xf8, 0xee, 0xd0, 0x34, 0x70, 0x7a, 0x90, 0xe4, 0x4a, 0x9d, 0xbf,
+  0xd4, 0x08, 0xf2, 0x8d, 0x13, 0x8c, 0x17, 0xb2, 0x73, 0x30, 0x1b, 0xf3,
+  0x34, 0x89, 0x3a, 0xa0, 0xfb, 0xfa, 0x3f, 0x5e, 0xf7, 0x9d, 0x0c, 0x6a,
+  0x95, 0xe6, 0x0d, 0x96, 0xa8, 0x95, 0xa0, 0x75, 0x0d, 0x6b, 0x8e, 0xcc,
+  0x72, 0xfe, 0x8b, 0x68, 0x27, 0x87, 0x5f, 0xff, 0x8d, 0x54, 0x4c, 0x4c,
+  0x66, 0xfd, 0x42, 0x0a, 0x2b, 0xee, 0x4d, 0x60, 0x17, 0x1b, 0x1c, 0x17,
+  0xb3, 0x1e, 0x26, 0x04, 0xd7, 0x80, 0xc2, 0xfb, 0xe1, 0xeb, 0xcb, 0xb0,
+  0x23, 0xbc, 0xce, 0x96, 0xd3, 0x5f, 0x13, 0x8a, 0x14, 0x25, 0x75, 0xce,
+  0x39, 0x02, 0x7e, 0x3b, 0xd5, 0x0c, 0x33, 0x9d, 0x08, 0xb7, 0x35, 0x65,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x15, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x14, 0x00, 0x1d, 0x00, 0x26, 0x00,
+  0x2f, 0x00, 0x38, 0x00, 0x41, 0x00, 0x4a, 0x00, 0x53, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x16, 0x00,
+  0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x0b, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x15, 0x00, 0x1e, 0x00, 0x2a, 0x00,
+  0x32, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x19, 0x00, 0x00, 0x00, 0x0b, 0x00,
+  0x00, 0x00, 0x07, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x1b, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x18, 0x00, 0x28, 0x00, 0x31, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x06, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00,
+  0x17, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x13, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x18, 0x00, 0x00, 0x00, 0x0d, 0x00,
+  0x1a, 0x00, 0x00, 0x00, 0x08, 0x00, 0x16, 0x00, 0x24, 0x00, 0x32, 0x00,
+  0x39, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x09, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x09, 0x00, 0x13, 0x00,
+  0x1e, 0x00, 0x22, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x11, 0x00, 0x1a, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x18, 0x00,
+  0x1f, 0x00, 0x28, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x15, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x09, 0x00, 0x13, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x17, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x1a, 0x00, 0x25, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x19, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0c, 0x00, 0x12, 0x00,
+  0x00, 0x00, 0x0b, 0x00, 0x13, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x10, 0x00, 0x18, 0x00, 0x20, 0x00, 0x36, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x17, 0x00,
+  0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x00, 0x00, 0x07, 0x00, 0x14, 0x00, 0x1c, 0x00, 0x23, 0x00,
+  0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x13, 0x00, 0x1f, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x19, 0x00, 0x24, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x00, 0x00, 0x0b, 0x00, 0x17, 0x00, 0x24, 0x00, 0x30, 0x00, 0x3c, 0x00,
+  0x00, 0x00, 0x0a, 0x00, 0x14, 0x00, 0x1e, 0x00, 0x28, 0x00, 0x34, 0x00,
+  0x40, 0x00, 0x4c, 0x00, 0x56, 0x00, 0x62, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x15, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x11, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x15, 0x00, 0x28, 0x00,
+  0x37, 0x00, 0x00, 0x00, 0x08, 0x00, 0x18, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x08, 0x00, 0x13, 0x00, 0x1e, 0x00, 0x29, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x09, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x14, 0x00, 0x21, 0x00,
+  0x00, 0x00, 0x07, 0x00, 0x0e, 0x00, 0x15, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x16, 0x00, 0x21, 0x00, 0x2c, 0x00, 0x37, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x12, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x18, 0x00, 0x23, 0x00,
+  0x2e, 0x00, 0x3b, 0x00, 0x46, 0x00, 0x51, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x1c, 0x00, 0x25, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x20, 0x00, 0x30, 0x00, 0x40, 0x00, 0x4c, 0x00, 0x58, 0x00, 0x64, 0x00,
+  0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x1d, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00,
+  0x1e, 0x00, 0x2d, 0x00, 0x3c, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x0d, 0x00,
+  0x00, 0x00, 0x0f, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00,
+  0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0a, 0x00, 0x12, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x13, 0x00, 0x00, 0x00, 0x08, 0x00, 0x11, 0x00, 0x19, 0x00,
+  0x21, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x15, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x1a, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x1a, 0x00,
+  0x26, 0x00, 0x32, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1f, 0x00,
+  0x2d, 0x00, 0x3b, 0x00, 0x49, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x1a, 0x00,
+  0x25, 0x00, 0x34, 0x00, 0x43, 0x00, 0x49, 0x00, 0x50, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x00, 0x00, 0x0f, 0x00, 0x1e, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x12, 0x00, 0x1f, 0x00,
+  0x00, 0x00, 0x07, 0x00, 0x16, 0x00, 0x29, 0x00, 0x38, 0x00, 0x47, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x13, 0x00, 0x27, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x00, 0x00, 0x06, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00,
+  0x16, 0x00, 0x00, 0x00, 0x09, 0x00, 0x14, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x1a, 0x00, 0x23, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x1c, 0x00, 0x2c, 0x00,
+  0x39, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1e, 0x00, 0x2e, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x1e, 0x00, 0x2d, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x1c, 0x00, 0x2c, 0x00, 0x3c, 0x00, 0x4c, 0x00, 0x5c, 0x00, 0x6c, 0x00,
+  0x7c, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x1c, 0x00, 0x2d, 0x00, 0x3b, 0x00,
+  0x00, 0x00, 0x08, 0x00, 0x17, 0x00, 0x29, 0x00, 0x38, 0x00, 0x47, 0x00,
+  0x4f, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x13, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x1a, 0x00, 0x23, 0x00, 0x2f, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x08, 0x00,
+  0x10, 0x00, 0x18, 0x00, 0x20, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x14, 0x00, 0x1a, 0x00, 0x24, 0x00,
+  0x2e, 0x00, 0x38, 0x00, 0x42, 0x00, 0x00, 0x00, 0x07, 0x00, 0x0f, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x09, 0x00, 0x12, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x0e, 0x00,
+  0x15, 0x00, 0x1c, 0x00, 0x23, 0x00, 0x00, 0x00, 0x11, 0x00, 0x22, 0x00,
+  0x2a, 0x00, 0x32, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x18, 0x00,
+  0x24, 0x00, 0x2e, 0x00, 0x38, 0x00, 0x42, 0x00, 0x00, 0x00, 0x0a, 0x00,
+  0x14, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x13, 0x00, 0x1e, 0x00,
+  0x2a, 0x00, 0x38, 0x00, 0x3e, 0x00, 0x46, 0x00, 0x4e, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x10, 0x00, 0x19, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x16, 0x00,
+  0x22, 0x00, 0x2e, 0x00, 0x3a, 0x00, 0x46, 0x00, 0x00, 0x00, 0x0f, 0x00,
+  0x1e, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x1a, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x16, 0x00, 0x22, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x19, 0x00,
+  0x27, 0x00, 0x2e, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1d, 0x00,
+  0x23, 0x00, 0x32, 0x00, 0x00, 0x00, 0x10, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x22, 0x00, 0x33, 0x00, 0x3f, 0x00, 0x50, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x14, 0x00,
+  0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00,
+  0x00, 0x00, 0x08, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x08, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x11, 0x00,
+  0x00, 0x00, 0x08, 0x00, 0x14, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x11, 0x00,
+  0x18, 0x00, 0x25, 0x00, 0x30, 0x00, 0x3d, 0x00, 0x44, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x10, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00,
+  0x19, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x12, 0x00, 0x20, 0x00, 0x00, 0x00, 0x0f, 0x00,
+  0x1e, 0x00, 0x24, 0x00, 0x2e, 0x00, 0x3d, 0x00, 0x4c, 0x00, 0x52, 0x00,
+  0x5c, 0x00, 0x62, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x1a, 0x00, 0x2a, 0x00,
+  0x35, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x08, 0x00,
+  0x10, 0x00, 0x16, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00,
+  0x15, 0x00, 0x1b, 0x00, 0x22, 0x00, 0x29, 0x00, 0x00, 0x00, 0x06, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x06, 0x00, 0x13, 0x00, 0x19, 0x00, 0x24, 0x00,
+  0x2a, 0x00, 0x33, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x12, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x16, 0x00, 0x1f, 0x00, 0x28, 0x00,
+  0x31, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x17, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x19, 0x00, 0x27, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0c, 0x00, 0x12, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00,
+  0x0d, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x12, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x1d, 0x00, 0x28, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x12, 0x00, 0x1b, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x16, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x19, 0x00,
+  0x22, 0x00, 0x2f, 0x00, 0x38, 0x00, 0x41, 0x00, 0x00, 0x00, 0x0a, 0x00,
+  0x13, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x13, 0x00,
+  0x1c, 0x00, 0x26, 0x00, 0x00, 0x00, 0x12, 0x00, 0x1e, 0x00, 0x2a, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x15, 0x00, 0x24, 0x00, 0x2a, 0x00,
+  0x31, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x19, 0x00, 0x00, 0x00, 0x12, 0x00, 0x18, 0x00, 0x24, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x12, 0x00, 0x1d, 0x00, 0x26, 0x00,
+  0x34, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00,
+  0x1d, 0x00, 0x28, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x19, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x0a, 0x00,
+  0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x09, 0x00, 0x12, 0x00, 0x1b, 0x00,
+  0x00, 0x00, 0x0a, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x15, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x14, 0x00, 0x20, 0x00, 0x00, 0x00, 0x07, 0x00, 0x14, 0x00,
+  0x1a, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x0f, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0f, 0x00,
+  0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x17, 0x00, 0x21, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x0f, 0x00,
+  0x1e, 0x00, 0x2d, 0x00, 0x3c, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x20, 0x00, 0x2a, 0x00, 0x3a, 0x00, 0x44, 0x00, 0x00, 0x00, 0x07, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x15, 0x00, 0x21, 0x00, 0x2d, 0x00, 0x35, 0x00,
+  0x3c, 0x00, 0x4e, 0x00, 0x60, 0x00, 0x6b, 0x00, 0x7d, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x13, 0x00, 0x00, 0x00, 0x07, 0x00,
+  0x0e, 0x00, 0x15, 0x00, 0x22, 0x00, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x14, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x0a, 0x00,
+  0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x18, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x00, 0x00, 0x08, 0x00, 0x16, 0x00, 0x24, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0b, 0x00, 0x15, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x18, 0x00, 0x24, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x18, 0x00,
+  0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1e, 0x00,
+  0x2d, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x1d, 0x00,
+  0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x12, 0x00,
+  0x1f, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x18, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00,
+  0x1c, 0x00, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x0f, 0x00, 0x17, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x06, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x09, 0x00, 0x16, 0x00,
+  0x21, 0x00, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x15, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x12, 0x00, 0x1b, 0x00, 0x24, 0x00, 0x2d, 0x00, 0x36, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x00, 0x00, 0x08, 0x00, 0x14, 0x00, 0x24, 0x00, 0x32, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00,
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x1a, 0x00, 0x27, 0x00, 0x32, 0x00, 0x3c, 0x00, 0x47, 0x00,
+  0x55, 0x00, 0x62, 0x00, 0x70, 0x00, 0x7f, 0x00, 0x8f, 0x00, 0x9b, 0x00,
+  0xa6, 0x00, 0xb3, 0x00, 0xbf, 0x00, 0xca, 0x00, 0xd8, 0x00, 0xe5, 0x00,
+  0xf0, 0x00, 0xfd, 0x00, 0x09, 0x01, 0x16, 0x01, 0x24, 0x01, 0x30, 0x01,
+  0x3e, 0x01, 0x4b, 0x01, 0x59, 0x01, 0x68, 0x01, 0x78, 0x01, 0x84, 0x01,
+  0x92, 0x01, 0x9f, 0x01, 0xab, 0x01, 0xb8, 0x01, 0xc6, 0x01, 0xd1, 0x01,
+  0xde, 0x01, 0xec, 0x01, 0xfb, 0x01, 0x0c, 0x02, 0x1d, 0x02, 0x2f, 0x02,
+  0x41, 0x02, 0x54, 0x02, 0x68, 0x02, 0x7d, 0x02, 0x93, 0x02, 0xa5, 0x02,
+  0xb6, 0x02, 0xc6, 0x02, 0xd7, 0x02, 0xe9, 0x02, 0xfc, 0x02, 0x10, 0x03,
+  0x25, 0x03, 0x33, 0x03, 0x43, 0x03, 0x53, 0x03, 0x64, 0x03, 0x75, 0x03,
+  0x87, 0x03, 0x9a, 0x03, 0xae, 0x03, 0xc3, 0x03, 0xd4, 0x03, 0xe4, 0x03,
+  0xf3, 0x03, 0x03, 0x04, 0x14, 0x04, 0x26, 0x04, 0x39, 0x04, 0x4d, 0x04,
+  0x5b, 0x04, 0x69, 0x04, 0x76, 0x04, 0x83, 0x04, 0x91, 0x04, 0x9f, 0x04,
+  0xb2, 0x04, 0xc6, 0x04, 0xda, 0x04, 0xee, 0x04, 0x03, 0x05, 0x18, 0x05,
+  0x2e, 0x05, 0x45, 0x05, 0x5d, 0x05, 0x76, 0x05, 0x8b, 0x05, 0xa1, 0x05,
+  0xb8, 0x05, 0xd0, 0x05, 0xe4, 0x05, 0xf8, 0x05, 0x0c, 0x06, 0x1d, 0x06,
+  0x2a, 0x06, 0x39, 0x06, 0x47, 0x06, 0x52, 0x06, 0x5e, 0x06, 0x6c, 0x06,
+  0x79, 0x06, 0x88, 0x06, 0x98, 0x06, 0xa8, 0x06, 0xb9, 0x06, 0xcc, 0x06,
+  0xe0, 0x06, 0xf2, 0x06, 0x07, 0x07, 0x1b, 0x07, 0x2f, 0x07, 0x40, 0x07,
+  0x4f, 0x07, 0x5f, 0x07, 0x74, 0x07, 0x88, 0x07, 0x9c, 0x07, 0xac, 0x07,
+  0xbc, 0x07, 0xcc, 0x07, 0xdd, 0x07, 0xf3, 0x07, 0x08, 0x08, 0x1d, 0x08,
+  0x2e, 0x08, 0x43, 0x08, 0x57, 0x08, 0x6b, 0x08, 0x81, 0x08, 0x96, 0x08,
+  0xac, 0x08, 0xc3, 0x08, 0xd9, 0x08, 0xee, 0x08, 0x00, 0x09, 0x13, 0x09,
+  0x27, 0x09, 0x3c, 0x09, 0x4d, 0x09, 0x64, 0x09, 0x7a, 0x09, 0x90, 0x09,
+  0xa1, 0x09, 0xb3, 0x09, 0xc3, 0x09, 0xd5, 0x09, 0xeb, 0x09, 0x00, 0x0a,
+  0x15, 0x0a, 0x26, 0x0a, 0x31, 0x0a, 0x3f, 0x0a, 0x4e, 0x0a, 0x5e, 0x0a,
+  0x6a, 0x0a, 0x75, 0x0a, 0x80, 0x0a, 0x8e, 0x0a, 0x9b, 0x0a, 0xa6, 0x0a,
+  0xb3, 0x0a, 0xbf, 0x0a, 0xcc, 0x0a, 0xda, 0x0a, 0xe6, 0x0a, 0xf4, 0x0a,
+  0x01, 0x0b, 0x0f, 0x0b, 0x1e, 0x0b, 0x2e, 0x0b, 0x3a, 0x0b, 0x48, 0x0b,
+  0x54, 0x0b, 0x61, 0x0b, 0x6f, 0x0b, 0x7c, 0x0b, 0x8a, 0x0b, 0x97, 0x0b,
+  0xa5, 0x0b, 0xb2, 0x0b, 0xc1, 0x0b, 0xcf, 0x0b, 0xde, 0x0b, 0xec, 0x0b,
+  0xf4, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x12, 0x00, 0x1f, 0x00,
+  0x2b, 0x00, 0x37, 0x00, 0x43, 0x00, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x16, 0x00, 0x00, 0x00, 0x07, 0x00, 0x0e, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x10, 0x00, 0x18, 0x00, 0x20, 0x00, 0x28, 0x00, 0x30, 0x00,
+  0x38, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x12, 0x00,
+  0x1b, 0x00, 0x00, 0x00, 0x07, 0x00, 0x0e, 0x00, 0x15, 0x00, 0x1c, 0x00,
+  0x23, 0x00, 0x2a, 0x00, 0x31, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x1a, 0x00,
+  0x00, 0x00, 0x0f, 0x00, 0x1e, 0x00, 0x25, 0x00, 0x33, 0x00, 0x3d, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x21, 0x00, 0x30, 0x00, 0x3c, 0x00, 0x4a, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x20, 0x00, 0x00, 0x00, 0x11, 0x00, 0x1f, 0x00,
+  0x2d, 0x00, 0x3e, 0x00, 0x47, 0x00, 0x55, 0x00, 0x00, 0x00, 0x0f, 0x00,
+  0x21, 0x00, 0x33, 0x00, 0x42, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x20, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x07, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x14, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x07, 0x00, 0x14, 0x00, 0x20, 0x00,
+  0x31, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x19, 0x00, 0x22, 0x00,
+  0x2a, 0x00, 0x32, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00,
+  0x15, 0x00, 0x21, 0x00, 0x2d, 0x00, 0x34, 0x00, 0x00, 0x00, 0x08, 0x00,
+  0x18, 0x00, 0x20, 0x00, 0x31, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x1a, 0x00, 0x23, 0x00, 0x34, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x18, 0x00, 0x29, 0x00, 0x35, 0x00, 0x41, 0x00, 0x4d, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x1e, 0x00, 0x2e, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x20, 0x00, 0x31, 0x00, 0x42, 0x00, 0x47, 0x00,
+  0x00, 0x00, 0x06, 0x00, 0x0e, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0a, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00,
+  0x16, 0x00, 0x21, 0x00, 0x2c, 0x00, 0x38, 0x00, 0x3c, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x12, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x1b, 0x00, 0x29, 0x00,
+  0x36, 0x00, 0x43, 0x00, 0x50, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1c, 0x00,
+  0x2a, 0x00, 0x38, 0x00, 0x46, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1e, 0x00,
+  0x2d, 0x00, 0x3c, 0x00, 0x4b, 0x00, 0x5a, 0x00, 0x65, 0x00, 0x74, 0x00,
+  0x00, 0x00, 0x06, 0x00, 0x16, 0x00, 0x26, 0x00, 0x36, 0x00, 0x46, 0x00,
+  0x4c, 0x00, 0x5c, 0x00, 0x6c, 0x00, 0x7c, 0x00, 0x8c, 0x00, 0x9c, 0x00,
+  0xac, 0x00, 0x00, 0x00, 0x11, 0x00, 0x22, 0x00, 0x33, 0x00, 0x44, 0x00,
+  0x55, 0x00, 0x66, 0x00, 0x77, 0x00, 0x88, 0x00, 0x99, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x1b, 0x00, 0x2d, 0x00, 0x3f, 0x00, 0x51, 0x00, 0x63, 0x00,
+  0x75, 0x00, 0x87, 0x00, 0x99, 0x00, 0xab, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x00, 0x00, 0x14, 0x00, 0x28, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x15, 0x00,
+  0x2a, 0x00, 0x3f, 0x00, 0x49, 0x00, 0x56, 0x00, 0x00, 0x00, 0x16, 0x00,
+  0x2c, 0x00, 0x3a, 0x00, 0x50, 0x00, 0x5e, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x15, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x18, 0x00, 0x23, 0x00, 0x2e, 0x00, 0x3c, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x0f, 0x00, 0x18, 0x00, 0x24, 0x00, 0x00, 0x00, 0x0d, 0x00,
+  0x1a, 0x00, 0x27, 0x00, 0x34, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1c, 0x00,
+  0x2a, 0x00, 0x38, 0x00, 0x46, 0x00, 0x54, 0x00, 0x60, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x1e, 0x00, 0x2d, 0x00, 0x3c, 0x00, 0x4b, 0x00, 0x5a, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x20, 0x00, 0x30, 0x00, 0x40, 0x00, 0x50, 0x00,
+  0x56, 0x00, 0x66, 0x00, 0x76, 0x00, 0x86, 0x00, 0x96, 0x00, 0xa6, 0x00,
+  0xb4, 0x00, 0xc4, 0x00, 0xd4, 0x00, 0x00, 0x00, 0x11, 0x00, 0x22, 0x00,
+  0x33, 0x00, 0x44, 0x00, 0x55, 0x00, 0x66, 0x00, 0x77, 0x00, 0x88, 0x00,
+  0x99, 0x00, 0xaa, 0x00, 0xbb, 0x00, 0xcc, 0x00, 0xdd, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x24, 0x00, 0x36, 0x00, 0x3f, 0x00, 0x51, 0x00, 0x63, 0x00,
+  0x00, 0x00, 0x13, 0x00, 0x26, 0x00, 0x39, 0x00, 0x4c, 0x00, 0x5f, 0x00,
+  0x00, 0x00, 0x14, 0x00, 0x28, 0x00, 0x00, 0x00, 0x15, 0x00, 0x2a, 0x00,
+  0x00, 0x00, 0x08, 0x00, 0x12, 0x00, 0x1a, 0x00, 0x22, 0x00, 0x2b, 0x00,
+  0x32, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x08, 0x00, 0x10, 0x00,
+  0x19, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x18, 0x00, 0x24, 0x00, 0x30, 0x00,
+  0x3c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x1d, 0x00, 0x2d, 0x00, 0x34, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x11, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x19, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x20, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0a, 0x00, 0x13, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1c, 0x00,
+  0x2c, 0x00, 0x3c, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x15, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x15, 0x00, 0x23, 0x00, 0x2c, 0x00, 0x37, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x12, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x13, 0x00, 0x1a, 0x00, 0x27, 0x00, 0x00, 0x00, 0x08, 0x00,
+  0x16, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x15, 0x00, 0x1e, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x12, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x0a, 0x00,
+  0x17, 0x00, 0x00, 0x00, 0x09, 0x00, 0x17, 0x00, 0x00, 0x00, 0x0a, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x09, 0x00, 0x12, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x09, 0x00, 0x0f, 0x00, 0x18, 0x00, 0x23, 0x00,
+  0x2c, 0x00, 0x35, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x18, 0x00, 0x21, 0x00, 0x00, 0x00, 0x09, 0x00, 0x19, 0x00, 0x21, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x19, 0x00, 0x25, 0x00, 0x31, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x08, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0a, 0x00, 0x11, 0x00, 0x00, 0x00, 0x09, 0x00, 0x17, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x17, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x14, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00,
+  0x16, 0x00, 0x20, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x07, 0x00, 0x0e, 0x00,
+  0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00,
+  0x10, 0x00, 0x1b, 0x00, 0x25, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x17, 0x00, 0x20, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x19, 0x00,
+  0x27, 0x00, 0x35, 0x00, 0x43, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x17, 0x00,
+  0x26, 0x00, 0x35, 0x00, 0x00, 0x00, 0x08, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x17, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x13, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x09, 0x00, 0x12, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x11, 0x00, 0x1b, 0x00, 0x25, 0x00, 0x2f, 0x00, 0x39, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x00, 0x00, 0x0f, 0x00, 0x18, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x16, 0x00, 0x24, 0x00, 0x32, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x16, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x0f, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x06, 0x00, 0x12, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x10, 0x00, 0x17, 0x00, 0x1f, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x00, 0x00, 0x07, 0x00, 0x10, 0x00, 0x19, 0x00, 0x20, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x19, 0x00,
+  0x28, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x00, 0x00, 0x09, 0x00, 0x12, 0x00, 0x1b, 0x00, 0x24, 0x00,
+  0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0f, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x14, 0x00, 0x1d, 0x00, 0x25, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0f, 0x00, 0x16, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00,
+  0x10, 0x00, 0x20, 0x00, 0x2f, 0x00, 0x37, 0x00, 0x3e, 0x00, 0x46, 0x00,
+  0x4e, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x1c, 0x00, 0x25, 0x00, 0x2e, 0x00, 0x35, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x16, 0x00, 0x00, 0x00, 0x11, 0x00, 0x22, 0x00, 0x31, 0x00,
+  0x00, 0x00, 0x08, 0x00, 0x10, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x0d, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x19, 0x00, 0x26, 0x00, 0x30, 0x00,
+  0x3d, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x09, 0x00, 0x14, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x11, 0x00, 0x22, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x1a, 0x00, 0x22, 0x00, 0x00, 0x00, 0x16, 0x00, 0x2c, 0x00,
+  0x36, 0x00, 0x45, 0x00, 0x54, 0x00, 0x5b, 0x00, 0x62, 0x00, 0x73, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x14, 0x00, 0x1d, 0x00, 0x2c, 0x00, 0x34, 0x00,
+  0x40, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x0e, 0x00, 0x15, 0x00, 0x1c, 0x00, 0x23, 0x00, 0x2c, 0x00,
+  0x33, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00,
+  0x10, 0x00, 0x18, 0x00, 0x25, 0x00, 0x2d, 0x00, 0x3b, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x18, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x10, 0x00, 0x20, 0x00, 0x28, 0x00, 0x30, 0x00, 0x38, 0x00,
+  0x40, 0x00, 0x48, 0x00, 0x50, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1c, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x09, 0x00, 0x0f, 0x00,
+  0x00, 0x00, 0x0f, 0x00, 0x1b, 0x00, 0x26, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x15, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x13, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x1a, 0x00,
+  0x20, 0x00, 0x28, 0x00, 0x30, 0x00, 0x3d, 0x00, 0x49, 0x00, 0x55, 0x00,
+  0x62, 0x00, 0x6f, 0x00, 0x75, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x0d, 0x00,
+  0x16, 0x00, 0x1f, 0x00, 0x28, 0x00, 0x31, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x1c, 0x00, 0x2a, 0x00, 0x34, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x0f, 0x00,
+  0x16, 0x00, 0x00, 0x00, 0x08, 0x00, 0x10, 0x00, 0x19, 0x00, 0x29, 0x00,
+  0x2f, 0x00, 0x3c, 0x00, 0x45, 0x00, 0x52, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x1c, 0x00, 0x2d, 0x00, 0x3a, 0x00, 0x43, 0x00, 0x54, 0x00, 0x65, 0x00,
+  0x76, 0x00, 0x87, 0x00, 0x94, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x20, 0x00,
+  0x32, 0x00, 0x44, 0x00, 0x56, 0x00, 0x68, 0x00, 0x76, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x1c, 0x00, 0x25, 0x00, 0x38, 0x00, 0x47, 0x00, 0x5a, 0x00,
+  0x00, 0x00, 0x14, 0x00, 0x28, 0x00, 0x30, 0x00, 0x44, 0x00, 0x51, 0x00,
+  0x65, 0x00, 0x6f, 0x00, 0x00, 0x00, 0x10, 0x00, 0x20, 0x00, 0x29, 0x00,
+  0x3e, 0x00, 0x4b, 0x00, 0x52, 0x00, 0x67, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x09, 0x00, 0x16, 0x00, 0x21, 0x00,
+  0x2c, 0x00, 0x36, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x07, 0x00, 0x0e, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x16, 0x00,
+  0x21, 0x00, 0x2c, 0x00, 0x37, 0x00, 0x42, 0x00, 0x4f, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x15, 0x00, 0x23, 0x00, 0x29, 0x00, 0x00, 0x00, 0x0f, 0x00,
+  0x1d, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1e, 0x00,
+  0x2d, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x06, 0x00, 0x16, 0x00, 0x26, 0x00,
+  0x2c, 0x00, 0x3c, 0x00, 0x4c, 0x00, 0x52, 0x00, 0x59, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x22, 0x00, 0x00, 0x00, 0x12, 0x00, 0x24, 0x00, 0x36, 0x00,
+  0x48, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x18, 0x00, 0x2b, 0x00,
+  0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x15, 0x00, 0x1e, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x11, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x11, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x18, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x15, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x18, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x15, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x0a, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x10, 0x00, 0x18, 0x00, 0x20, 0x00, 0x28, 0x00, 0x30, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x12, 0x00, 0x1b, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x10, 0x00, 0x18, 0x00, 0x20, 0x00, 0x28, 0x00, 0x30, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00,
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x11, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x12, 0x00,
+  0x20, 0x00, 0x29, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x0a, 0x00,
+  0x13, 0x00, 0x1d, 0x00, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x16, 0x00, 0x20, 0x00, 0x00, 0x00, 0x07, 0x00, 0x11, 0x00, 0x1e, 0x00,
+  0x29, 0x00, 0x00, 0x00, 0x08, 0x00, 0x14, 0x00, 0x20, 0x00, 0x28, 0x00,
+  0x30, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1a, 0x00, 0x25, 0x00, 0x30, 0x00,
+  0x3b, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x1c, 0x00, 0x2c, 0x00, 0x38, 0x00,
+  0x44, 0x00, 0x50, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x1a, 0x00, 0x27, 0x00, 0x39, 0x00, 0x00, 0x00, 0x14, 0x00,
+  0x28, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x10, 0x00, 0x19, 0x00, 0x00, 0x00, 0x08, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x19, 0x00, 0x26, 0x00, 0x00, 0x00, 0x08, 0x00,
+  0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x09, 0x00, 0x19, 0x00, 0x29, 0x00,
+  0x39, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0b, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x12, 0x00, 0x1f, 0x00, 0x28, 0x00, 0x31, 0x00,
+  0x3a, 0x00, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x17, 0x00,
+  0x21, 0x00, 0x2b, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00,
+  0x17, 0x00, 0x23, 0x00, 0x2f, 0x00, 0x3b, 0x00, 0x44, 0x00, 0x4d, 0x00,
+  0x00, 0x00, 0x0b, 0x00, 0x19, 0x00, 0x27, 0x00, 0x35, 0x00, 0x40, 0x00,
+  0x4b, 0x00, 0x59, 0x00, 0x64, 0x00, 0x00, 0x00, 0x09, 0x00, 0x14, 0x00,
+  0x22, 0x00, 0x30, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x10, 0x00, 0x1b, 0x00,
+  0x26, 0x00, 0x35, 0x00, 0x40, 0x00, 0x4b, 0x00, 0x56, 0x00, 0x65, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x1b, 0x00, 0x26, 0x00, 0x36, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x00, 0x00, 0x09, 0x00, 0x1b, 0x00, 0x23, 0x00, 0x2b, 0x00,
+  0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x16, 0x00, 0x22, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x09, 0x00, 0x12, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x13, 0x00, 0x25, 0x00, 0x00, 0x00, 0x07, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x12, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x0b, 0x00,
+  0x14, 0x00, 0x1d, 0x00, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x1a, 0x00, 0x22, 0x00, 0x2e, 0x00, 0x3a, 0x00, 0x46, 0x00,
+  0x52, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x19, 0x00, 0x28, 0x00, 0x31, 0x00,
+  0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x10, 0x00, 0x1a, 0x00,
+  0x24, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x12, 0x00, 0x1e, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x15, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x17, 0x00, 0x21, 0x00, 0x2b, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x1c, 0x00, 0x29, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x1e, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x12, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x08, 0x00, 0x11, 0x00, 0x1d, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x1a, 0x00, 0x28, 0x00,
+  0x31, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x1a, 0x00, 0x29, 0x00, 0x36, 0x00,
+  0x45, 0x00, 0x55, 0x00, 0x00, 0x00, 0x10, 0x00, 0x20, 0x00, 0x30, 0x00,
+  0x40, 0x00, 0x50, 0x00, 0x60, 0x00, 0x70, 0x00, 0x80, 0x00, 0x90, 0x00,
+  0x00, 0x00, 0x11, 0x00, 0x22, 0x00, 0x33, 0x00, 0x44, 0x00, 0x55, 0x00,
+  0x64, 0x00, 0x75, 0x00, 0x86, 0x00, 0x94, 0x00, 0xa5, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x13, 0x00, 0x26, 0x00, 0x35, 0x00, 0x48, 0x00, 0x58, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x13, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x18, 0x00, 0x1f, 0x00, 0x2a, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x18, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1c, 0x00, 0x25, 0x00,
+  0x00, 0x00, 0x0f, 0x00, 0x1c, 0x00, 0x29, 0x00, 0x36, 0x00, 0x43, 0x00,
+  0x50, 0x00, 0x5d, 0x00, 0x6a, 0x00, 0x77, 0x00, 0x82, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x20, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x09, 0x00, 0x12, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x20, 0x00, 0x30, 0x00,
+  0x00, 0x00, 0x0b, 0x00, 0x13, 0x00, 0x1b, 0x00, 0x23, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x0f, 0x00, 0x1c, 0x00,
+  0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x14, 0x00, 0x1e, 0x00,
+  0x26, 0x00, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x14, 0x00, 0x1e, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x10, 0x00, 0x18, 0x00, 0x20, 0x00,
+  0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x14, 0x00, 0x1f, 0x00,
+  0x2a, 0x00, 0x00, 0x00, 0x07, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x0a, 0x00,
+  0x17, 0x00, 0x1f, 0x00, 0x27, 0x00, 0x2f, 0x00, 0x37, 0x00, 0x40, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x1a, 0x00, 0x28, 0x00, 0x35, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x1e, 0x00, 0x2a, 0x00, 0x37, 0x00, 0x45, 0x00, 0x51, 0x00,
+  0x61, 0x00, 0x6c, 0x00, 0x73, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x00, 0x00, 0x11, 0x00, 0x22, 0x00, 0x33, 0x00, 0x44, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x00, 0x00, 0x08, 0x00, 0x14, 0x00, 0x20, 0x00, 0x2c, 0x00,
+  0x38, 0x00, 0x40, 0x00, 0x53, 0x00, 0x62, 0x00, 0x75, 0x00, 0x81, 0x00,
+  0x91, 0x00, 0x00, 0x00, 0x14, 0x00, 0x21, 0x00, 0x00, 0x00, 0x08, 0x00,
+  0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x12, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x12, 0x00, 0x1c, 0x00, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x16, 0x00
+};
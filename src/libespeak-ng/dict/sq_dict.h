@@ -1,5 +1,7 @@
 #pragma once
-const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
+#include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/sq_dict_index.h>
+const unsigned char __espeakng_dict_sq[] __attribute__((aligned((4)))) = {
   0x00, 0x04, 0x00, 0x00, 0xaf, 0xac, 0x00, 0x00, 0x00, 0x41, 0x19, 0xf0,
   0x9f, 0x91, 0xa9, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xe2, 0x80,
   0x8d, 0xf0, 0x9f, 0x91, 0xa7, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa7,
@@ -3752,4 +3754,11 @@ const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
   0x00, 0x07, 0x06, 0x00, 0x24, 0x03, 0x49, 0x75, 0x7b, 0x23, 0x22, 0x25,
   0x00, 0x07, 0x00
 };
-size_t __espeakng_dictlen = 45003;
+
+BackgroundAudioDictionary dict_sq = {
+    "sq",
+    45003,
+    __espeakng_dict_sq,
+    7372,
+    __espeakng_dictindex_sq
+};
@@ -1,5 +1,7 @@
 #pragma once
-const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
+#include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/sv_dict_index.h>
+const unsigned char __espeakng_dict_sv[] __attribute__((aligned((4)))) = {
   0x00, 0x04, 0x00, 0x00, 0xca, 0xa6, 0x00, 0x00, 0x00, 0x43, 0x19, 0xf0,
   0x9f, 0x91, 0xa9, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xe2, 0x80,
   0x8d, 0xf0, 0x9f, 0x91, 0xa7, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa7,
@@ -3988,4 +3990,11 @@ const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
   0x48, 0x6f, 0x37, 0x7a, 0x00, 0x2a, 0x03, 0x7f, 0x06, 0x71, 0x33, 0x32,
   0x23, 0x00, 0x07, 0x00
 };
-size_t __espeakng_dictlen = 47836;
+
+BackgroundAudioDictionary dict_sv = {
+    "sv",
+    47836,
+    __espeakng_dict_sv,
+    8008,
+    __espeakng_dictindex_sv
+};
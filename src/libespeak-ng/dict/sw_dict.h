@@ -1,5 +1,7 @@
 #pragma once
-const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
+#include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/sw_dict_index.h>
+const unsigned char __espeakng_dict_sw[] __attribute__((aligned((4)))) = {
   0x00, 0x04, 0x00, 0x00, 0x2a, 0xb9, 0x00, 0x00, 0x00, 0x4e, 0x19, 0xf0,
   0x9f, 0x91, 0xa9, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xe2, 0x80,
   0x8d, 0xf0, 0x9f, 0x91, 0xa7, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa7,
@@ -3985,4 +3987,11 @@ const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
   0x42, 0x25, 0x23, 0x00, 0x2a, 0x03, 0x44, 0x27, 0x2f, 0x23, 0x00, 0x24,
   0x03, 0x49, 0x27, 0x37, 0x23, 0x00, 0x07, 0x00
 };
-size_t __espeakng_dictlen = 47804;
+
+BackgroundAudioDictionary dict_sw = {
+    "sw",
+    47804,
+    __espeakng_dict_sw,
+    7492,
+    __espeakng_dictindex_sw
+};
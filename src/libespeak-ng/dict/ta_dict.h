@@ -1,5 +1,7 @@
 #pragma once
-const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
+#include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/ta_dict_index.h>
+const unsigned char __espeakng_dict_ta[] __attribute__((aligned((4)))) = {
   0x00, 0x04, 0x00, 0x00, 0xe8, 0x84, 0x01, 0x00, 0x09, 0x86, 0xe0, 0xae,
   0xa4, 0xe0, 0xae, 0xa9, 0x0f, 0x00, 0x7c, 0x19, 0xf0, 0x9f, 0x91, 0xa9,
   0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xe2, 0x80, 0x8d, 0xf0, 0x9f,
@@ -17464,4 +17466,11 @@ const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
   0x20, 0x0f, 0x03, 0x31, 0x6d, 0x5d, 0x25, 0x2f, 0x2f, 0x6d, 0x37, 0x00,
   0x24, 0x03, 0x49, 0x27, 0x37, 0x6d, 0x00, 0x07, 0x00
 };
-size_t __espeakng_dictlen = 209553;
+
+BackgroundAudioDictionary dict_ta = {
+    "ta",
+    209553,
+    __espeakng_dict_ta,
+    8638,
+    __espeakng_dictindex_ta
+};
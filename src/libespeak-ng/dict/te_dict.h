@@ -1,5 +1,7 @@
 #pragma once
-const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
+#include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/te_dict_index.h>
+const unsigned char __espeakng_dict_te[] __attribute__((aligned((4)))) = {
   0x00, 0x04, 0x00, 0x00, 0x03, 0x6f, 0x01, 0x00, 0x00, 0x7c, 0x19, 0xf0,
   0x9f, 0x91, 0xa9, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xe2, 0x80,
   0x8d, 0xf0, 0x9f, 0x91, 0xa7, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa7,
@@ -7905,4 +7907,11 @@ const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
   0x07, 0x06, 0x00, 0x24, 0x03, 0x8c, 0x76, 0x37, 0x23, 0x22, 0x00, 0x07,
   0x00
 };
-size_t __espeakng_dictlen = 94837;
+
+BackgroundAudioDictionary dict_te = {
+    "te",
+    94837,
+    __espeakng_dict_te,
+    7450,
+    __espeakng_dictindex_te
+};
@@ -1,5 +1,7 @@
 #pragma once
-const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
+#include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/th_dict_index.h>
+const unsigned char __espeakng_dict_th[] __attribute__((aligned((4)))) = {
   0x00, 0x04, 0x00, 0x00, 0x65, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -193,4 +195,11 @@ const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
   0x00, 0x72, 0x00, 0x73, 0x00, 0x74, 0x00, 0x75, 0x00, 0x76, 0x00, 0x77,
   0x00, 0x78, 0x00, 0x79, 0x00, 0x7a, 0x00, 0x07, 0x00
 };
-size_t __espeakng_dictlen = 2301;
+
+BackgroundAudioDictionary dict_th = {
+    "th",
+    2301,
+    __espeakng_dict_th,
+    2098,
+    __espeakng_dictindex_th
+};
@@ -1,5 +1,7 @@
 #pragma once
-const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
+#include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/tk_dict_index.h>
+const unsigned char __espeakng_dict_tk[] __attribute__((aligned((4)))) = {
   0x00, 0x04, 0x00, 0x00, 0xc9, 0x44, 0x00, 0x00, 0x00, 0x0e, 0xc3, 0x20,
   0x92, 0x60, 0x41, 0x51, 0x68, 0x61, 0xc3, 0xbd, 0x73, 0x79, 0x20, 0x0b,
   0xc3, 0x20, 0x92, 0x60, 0x41, 0x51, 0x6b, 0x69, 0x6d, 0x20, 0x11, 0x06,
@@ -1740,4 +1742,11 @@ const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
   0x06, 0x7a, 0x00, 0x03, 0x57, 0x00, 0x61, 0x72, 0x01, 0x15, 0x02, 0x20,
   0x03, 0x57, 0x7d, 0x33, 0x00, 0x02, 0x73, 0x03, 0x58, 0x00, 0x07, 0x00
 };
-size_t __espeakng_dictlen = 20868;
+
+BackgroundAudioDictionary dict_tk = {
+    "tk",
+    20868,
+    __espeakng_dict_tk,
+    4858,
+    __espeakng_dictindex_tk
+};
@@ -0,0 +1,408 @@
+#pragma once
+const unsigned char __espeakng_dictindex_tk[] __attribute__((aligned((4)))) = {
+  0x45, 0x44, 0x58, 0x31, 0x84, 0x51, 0x00, 0x00, 0xc9, 0x44, 0x00, 0x00,
+  0xa2, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00,
+  0x03, 0x00, 0x03, 0x00, 0x04, 0x00, 0x06, 0x00, 0x07, 0x00, 0x08, 0x00,
+  0x0a, 0x00, 0x0b, 0x00, 0x0b, 0x00, 0x0c, 0x00, 0x0f, 0x00, 0x10, 0x00,
+  0x12, 0x00, 0x13, 0x00, 0x15, 0x00, 0x17, 0x00, 0x19, 0x00, 0x1b, 0x00,
+  0x1d, 0x00, 0x20, 0x00, 0x21, 0x00, 0x22, 0x00, 0x24, 0x00, 0x24, 0x00,
+  0x24, 0x00, 0x27, 0x00, 0x29, 0x00, 0x29, 0x00, 0x2a, 0x00, 0x2b, 0x00,
+  0x2c, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2f, 0x00, 0x32, 0x00, 0x34, 0x00,
+  0x36, 0x00, 0x38, 0x00, 0x3b, 0x00, 0x3c, 0x00, 0x3e, 0x00, 0x3f, 0x00,
+  0x41, 0x00, 0x43, 0x00, 0x43, 0x00, 0x43, 0x00, 0x44, 0x00, 0x45, 0x00,
+  0x46, 0x00, 0x46, 0x00, 0x48, 0x00, 0x49, 0x00, 0x4b, 0x00, 0x4c, 0x00,
+  0x4e, 0x00, 0x4f, 0x00, 0x52, 0x00, 0x52, 0x00, 0x53, 0x00, 0x55, 0x00,
+  0x57, 0x00, 0x59, 0x00, 0x5b, 0x00, 0x5c, 0x00, 0x5d, 0x00, 0x5e, 0x00,
+  0x5f, 0x00, 0x62, 0x00, 0x63, 0x00, 0x63, 0x00, 0x65, 0x00, 0x65, 0x00,
+  0x65, 0x00, 0x66, 0x00, 0x68, 0x00, 0x68, 0x00, 0x69, 0x00, 0x69, 0x00,
+  0x6b, 0x00, 0x6b, 0x00, 0x6c, 0x00, 0x6c, 0x00, 0x6c, 0x00, 0x6c, 0x00,
+  0x6c, 0x00, 0x6d, 0x00, 0x6d, 0x00, 0x6d, 0x00, 0x6d, 0x00, 0x6e, 0x00,
+  0x6f, 0x00, 0x6f, 0x00, 0x6f, 0x00, 0x70, 0x00, 0x71, 0x00, 0x72, 0x00,
+  0x73, 0x00, 0x77, 0x00, 0x77, 0x00, 0x77, 0x00, 0x77, 0x00, 0x77, 0x00,
+  0x78, 0x00, 0x7b, 0x00, 0x7b, 0x00, 0x7b, 0x00, 0x7c, 0x00, 0x7d, 0x00,
+  0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00,
+  0x80, 0x00, 0x80, 0x00, 0x82, 0x00, 0x82, 0x00, 0x87, 0x00, 0x88, 0x00,
+  0x8a, 0x00, 0x8c, 0x00, 0x8e, 0x00, 0x8f, 0x00, 0x8f, 0x00, 0x90, 0x00,
+  0x91, 0x00, 0x93, 0x00, 0x94, 0x00, 0x96, 0x00, 0x98, 0x00, 0x98, 0x00,
+  0x98, 0x00, 0x98, 0x00, 0x98, 0x00, 0x98, 0x00, 0x99, 0x00, 0x99, 0x00,
+  0x99, 0x00, 0x9a, 0x00, 0x9a, 0x00, 0x9a, 0x00, 0x9a, 0x00, 0x9a, 0x00,
+  0x9b, 0x00, 0x9b, 0x00, 0x9b, 0x00, 0x9b, 0x00, 0x9c, 0x00, 0x9c, 0x00,
+  0x9e, 0x00, 0xa2, 0x00, 0xa3, 0x00, 0xa3, 0x00, 0xa4, 0x00, 0xa4, 0x00,
+  0xa6, 0x00, 0xa8, 0x00, 0xa8, 0x00, 0xa8, 0x00, 0xa9, 0x00, 0xaa, 0x00,
+  0xab, 0x00, 0xab, 0x00, 0xab, 0x00, 0xab, 0x00, 0xab, 0x00, 0xac, 0x00,
+  0xac, 0x00, 0xac, 0x00, 0xae, 0x00, 0xb4, 0x00, 0xb6, 0x00, 0xb7, 0x00,
+  0xb8, 0x00, 0xb8, 0x00, 0xb8, 0x00, 0xb9, 0x00, 0xb9, 0x00, 0xb9, 0x00,
+  0xb9, 0x00, 0xb9, 0x00, 0xbb, 0x00, 0xbb, 0x00, 0xbb, 0x00, 0xbb, 0x00,
+  0xbc, 0x00, 0xbc, 0x00, 0xbc, 0x00, 0xbd, 0x00, 0xbe, 0x00, 0xbf, 0x00,
+  0xbf, 0x00, 0xbf, 0x00, 0xc0, 0x00, 0xc1, 0x00, 0xc3, 0x00, 0xc4, 0x00,
+  0xc5, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0xc6, 0x00,
+  0xc7, 0x00, 0xc8, 0x00, 0xc8, 0x00, 0xc9, 0x00, 0xc9, 0x00, 0xc9, 0x00,
+  0xcb, 0x00, 0xcc, 0x00, 0xcc, 0x00, 0xcf, 0x00, 0xd2, 0x00, 0xd4, 0x00,
+  0xd6, 0x00, 0xd7, 0x00, 0xd8, 0x00, 0xd9, 0x00, 0xdb, 0x00, 0xde, 0x00,
+  0xdf, 0x00, 0xe3, 0x00, 0xe3, 0x00, 0xe6, 0x00, 0xe7, 0x00, 0xe8, 0x00,
+  0xe9, 0x00, 0xea, 0x00, 0xed, 0x00, 0xee, 0x00, 0xf0, 0x00, 0xf1, 0x00,
+  0xf2, 0x00, 0xf3, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf6, 0x00, 0xf6, 0x00,
+  0xf6, 0x00, 0xf7, 0x00, 0xf8, 0x00, 0xf9, 0x00, 0xfb, 0x00, 0xfc, 0x00,
+  0xfc, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0x00, 0x01, 0x01, 0x01, 0x03, 0x01,
+  0x03, 0x01, 0x04, 0x01, 0x05, 0x01, 0x07, 0x01, 0x07, 0x01, 0x09, 0x01,
+  0x09, 0x01, 0x0b, 0x01, 0x0b, 0x01, 0x0c, 0x01, 0x0d, 0x01, 0x0e, 0x01,
+  0x0f, 0x01, 0x10, 0x01, 0x10, 0x01, 0x11, 0x01, 0x11, 0x01, 0x13, 0x01,
+  0x14, 0x01, 0x15, 0x01, 0x16, 0x01, 0x17, 0x01, 0x1a, 0x01, 0x1a, 0x01,
+  0x1b, 0x01, 0x1c, 0x01, 0x1d, 0x01, 0x1e, 0x01, 0x20, 0x01, 0x20, 0x01,
+  0x22, 0x01, 0x23, 0x01, 0x23, 0x01, 0x23, 0x01, 0x26, 0x01, 0x26, 0x01,
+  0x28, 0x01, 0x28, 0x01, 0x29, 0x01, 0x29, 0x01, 0x2a, 0x01, 0x2b, 0x01,
+  0x2b, 0x01, 0x2b, 0x01, 0x2c, 0x01, 0x2c, 0x01, 0x2d, 0x01, 0x2d, 0x01,
+  0x2e, 0x01, 0x30, 0x01, 0x31, 0x01, 0x32, 0x01, 0x32, 0x01, 0x33, 0x01,
+  0x33, 0x01, 0x34, 0x01, 0x34, 0x01, 0x34, 0x01, 0x35, 0x01, 0x35, 0x01,
+  0x36, 0x01, 0x38, 0x01, 0x38, 0x01, 0x39, 0x01, 0x3b, 0x01, 0x3b, 0x01,
+  0x3d, 0x01, 0x3e, 0x01, 0x3e, 0x01, 0x3f, 0x01, 0x40, 0x01, 0x40, 0x01,
+  0x40, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x42, 0x01, 0x46, 0x01,
+  0x47, 0x01, 0x48, 0x01, 0x48, 0x01, 0x4a, 0x01, 0x4a, 0x01, 0x4a, 0x01,
+  0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4d, 0x01, 0x4d, 0x01, 0x4d, 0x01,
+  0x4f, 0x01, 0x50, 0x01, 0x51, 0x01, 0x51, 0x01, 0x51, 0x01, 0x51, 0x01,
+  0x51, 0x01, 0x51, 0x01, 0x52, 0x01, 0x54, 0x01, 0x55, 0x01, 0x56, 0x01,
+  0x57, 0x01, 0x58, 0x01, 0x59, 0x01, 0x59, 0x01, 0x59, 0x01, 0x5a, 0x01,
+  0x5b, 0x01, 0x5c, 0x01, 0x5d, 0x01, 0x5d, 0x01, 0x5e, 0x01, 0x5e, 0x01,
+  0x5f, 0x01, 0x5f, 0x01, 0x5f, 0x01, 0x5f, 0x01, 0x5f, 0x01, 0x60, 0x01,
+  0x60, 0x01, 0x62, 0x01, 0x64, 0x01, 0x65, 0x01, 0x65, 0x01, 0x66, 0x01,
+  0x67, 0x01, 0x68, 0x01, 0x6a, 0x01, 0x6a, 0x01, 0x6a, 0x01, 0x6b, 0x01,
+  0x6d, 0x01, 0x6f, 0x01, 0x72, 0x01, 0x72, 0x01, 0x76, 0x01, 0x77, 0x01,
+  0x77, 0x01, 0x79, 0x01, 0x7d, 0x01, 0x7f, 0x01, 0x7f, 0x01, 0x80, 0x01,
+  0x82, 0x01, 0x87, 0x01, 0x87, 0x01, 0x87, 0x01, 0x88, 0x01, 0x89, 0x01,
+  0x89, 0x01, 0x8a, 0x01, 0x8b, 0x01, 0x8b, 0x01, 0x8b, 0x01, 0x8d, 0x01,
+  0x8e, 0x01, 0x90, 0x01, 0x90, 0x01, 0x91, 0x01, 0x92, 0x01, 0x94, 0x01,
+  0x94, 0x01, 0x94, 0x01, 0x94, 0x01, 0x96, 0x01, 0x97, 0x01, 0x97, 0x01,
+  0x98, 0x01, 0x9a, 0x01, 0x9b, 0x01, 0x9c, 0x01, 0x9d, 0x01, 0x9e, 0x01,
+  0xa0, 0x01, 0xa0, 0x01, 0xa1, 0x01, 0xa1, 0x01, 0xa1, 0x01, 0xa1, 0x01,
+  0xa2, 0x01, 0xa6, 0x01, 0xa7, 0x01, 0xa7, 0x01, 0xa8, 0x01, 0xa9, 0x01,
+  0xab, 0x01, 0xab, 0x01, 0xad, 0x01, 0xaf, 0x01, 0xaf, 0x01, 0xaf, 0x01,
+  0xb1, 0x01, 0xb2, 0x01, 0xb2, 0x01, 0xb3, 0x01, 0xb3, 0x01, 0xb4, 0x01,
+  0xb5, 0x01, 0xb5, 0x01, 0xb5, 0x01, 0xb6, 0x01, 0xb7, 0x01, 0xb7, 0x01,
+  0xba, 0x01, 0xbb, 0x01, 0xbd, 0x01, 0xbe, 0x01, 0xbe, 0x01, 0xbe, 0x01,
+  0xbf, 0x01, 0xbf, 0x01, 0xbf, 0x01, 0xc2, 0x01, 0xc2, 0x01, 0xc2, 0x01,
+  0xc3, 0x01, 0xc3, 0x01, 0xc3, 0x01, 0xc4, 0x01, 0xc6, 0x01, 0xc8, 0x01,
+  0xc8, 0x01, 0xc8, 0x01, 0xca, 0x01, 0xcb, 0x01, 0xcc, 0x01, 0xcc, 0x01,
+  0xcc, 0x01, 0xcd, 0x01, 0xcd, 0x01, 0xcd, 0x01, 0xcd, 0x01, 0xcd, 0x01,
+  0xd0, 0x01, 0xd1, 0x01, 0xd1, 0x01, 0xd4, 0x01, 0xd4, 0x01, 0xd4, 0x01,
+  0xd4, 0x01, 0xd4, 0x01, 0xd4, 0x01, 0xd6, 0x01, 0xd6, 0x01, 0xd8, 0x01,
+  0xd8, 0x01, 0xd9, 0x01, 0xd9, 0x01, 0xd9, 0x01, 0xd9, 0x01, 0xd9, 0x01,
+  0xd9, 0x01, 0xda, 0x01, 0xdb, 0x01, 0xdc, 0x01, 0xde, 0x01, 0xdf, 0x01,
+  0xe0, 0x01, 0xe0, 0x01, 0xe0, 0x01, 0xe3, 0x01, 0xe3, 0x01, 0xe3, 0x01,
+  0xe3, 0x01, 0xe3, 0x01, 0xe4, 0x01, 0xe5, 0x01, 0xe6, 0x01, 0xe6, 0x01,
+  0xe9, 0x01, 0xe9, 0x01, 0xeb, 0x01, 0xec, 0x01, 0xec, 0x01, 0xed, 0x01,
+  0xee, 0x01, 0xef, 0x01, 0xef, 0x01, 0xef, 0x01, 0xf1, 0x01, 0xf5, 0x01,
+  0xf5, 0x01, 0xf6, 0x01, 0xf9, 0x01, 0xfc, 0x01, 0xfc, 0x01, 0xfc, 0x01,
+  0xfe, 0x01, 0xff, 0x01, 0x00, 0x02, 0x01, 0x02, 0x03, 0x02, 0x03, 0x02,
+  0x05, 0x02, 0x05, 0x02, 0x06, 0x02, 0x06, 0x02, 0x08, 0x02, 0x08, 0x02,
+  0x08, 0x02, 0x09, 0x02, 0x09, 0x02, 0x09, 0x02, 0x09, 0x02, 0x09, 0x02,
+  0x09, 0x02, 0x09, 0x02, 0x0b, 0x02, 0x0d, 0x02, 0x0d, 0x02, 0x0d, 0x02,
+  0x0d, 0x02, 0x0e, 0x02, 0x0e, 0x02, 0x10, 0x02, 0x10, 0x02, 0x10, 0x02,
+  0x10, 0x02, 0x10, 0x02, 0x12, 0x02, 0x12, 0x02, 0x13, 0x02, 0x13, 0x02,
+  0x14, 0x02, 0x17, 0x02, 0x17, 0x02, 0x18, 0x02, 0x18, 0x02, 0x18, 0x02,
+  0x19, 0x02, 0x1a, 0x02, 0x1a, 0x02, 0x1a, 0x02, 0x1d, 0x02, 0x1d, 0x02,
+  0x1d, 0x02, 0x1e, 0x02, 0x1f, 0x02, 0x1f, 0x02, 0x20, 0x02, 0x20, 0x02,
+  0x20, 0x02, 0x22, 0x02, 0x24, 0x02, 0x24, 0x02, 0x25, 0x02, 0x26, 0x02,
+  0x28, 0x02, 0x29, 0x02, 0x29, 0x02, 0x2b, 0x02, 0x2c, 0x02, 0x2c, 0x02,
+  0x2d, 0x02, 0x2e, 0x02, 0x2f, 0x02, 0x31, 0x02, 0x32, 0x02, 0x33, 0x02,
+  0x34, 0x02, 0x34, 0x02, 0x34, 0x02, 0x34, 0x02, 0x35, 0x02, 0x36, 0x02,
+  0x37, 0x02, 0x37, 0x02, 0x39, 0x02, 0x3a, 0x02, 0x3a, 0x02, 0x3a, 0x02,
+  0x3a, 0x02, 0x3a, 0x02, 0x3b, 0x02, 0x3b, 0x02, 0x3d, 0x02, 0x3d, 0x02,
+  0x3e, 0x02, 0x3f, 0x02, 0x41, 0x02, 0x42, 0x02, 0x44, 0x02, 0x45, 0x02,
+  0x45, 0x02, 0x45, 0x02, 0x47, 0x02, 0x48, 0x02, 0x4a, 0x02, 0x4b, 0x02,
+  0x4c, 0x02, 0x4c, 0x02, 0x4d, 0x02, 0x4d, 0x02, 0x4d, 0x02, 0x4e, 0x02,
+  0x4e, 0x02, 0x4f, 0x02, 0x4f, 0x02, 0x50, 0x02, 0x50, 0x02, 0x50, 0x02,
+  0x51, 0x02, 0x53, 0x02, 0x53, 0x02, 0x53, 0x02, 0x54, 0x02, 0x55, 0x02,
+  0x56, 0x02, 0x56, 0x02, 0x57, 0x02, 0x58, 0x02, 0x58, 0x02, 0x58, 0x02,
+  0x5a, 0x02, 0x5c, 0x02, 0x5c, 0x02, 0x5c, 0x02, 0x5d, 0x02, 0x5d, 0x02,
+  0x5e, 0x02, 0x5e, 0x02, 0x5e, 0x02, 0x5e, 0x02, 0x5e, 0x02, 0x5f, 0x02,
+  0x5f, 0x02, 0x5f, 0x02, 0x5f, 0x02, 0x60, 0x02, 0x61, 0x02, 0x61, 0x02,
+  0x63, 0x02, 0x64, 0x02, 0x65, 0x02, 0x65, 0x02, 0x65, 0x02, 0x65, 0x02,
+  0x67, 0x02, 0x67, 0x02, 0x68, 0x02, 0x69, 0x02, 0x6a, 0x02, 0x6a, 0x02,
+  0x6b, 0x02, 0x6c, 0x02, 0x6c, 0x02, 0x6f, 0x02, 0x6f, 0x02, 0x70, 0x02,
+  0x70, 0x02, 0x70, 0x02, 0x71, 0x02, 0x72, 0x02, 0x72, 0x02, 0x72, 0x02,
+  0x73, 0x02, 0x74, 0x02, 0x76, 0x02, 0x77, 0x02, 0x7a, 0x02, 0x7b, 0x02,
+  0x7b, 0x02, 0x7b, 0x02, 0x7c, 0x02, 0x7c, 0x02, 0x7c, 0x02, 0x7c, 0x02,
+  0x7c, 0x02, 0x7d, 0x02, 0x7e, 0x02, 0x80, 0x02, 0x80, 0x02, 0x82, 0x02,
+  0x83, 0x02, 0x83, 0x02, 0x84, 0x02, 0x87, 0x02, 0x88, 0x02, 0x89, 0x02,
+  0x89, 0x02, 0x89, 0x02, 0x89, 0x02, 0x8a, 0x02, 0x8a, 0x02, 0x8c, 0x02,
+  0x8e, 0x02, 0x8f, 0x02, 0x8f, 0x02, 0x8f, 0x02, 0x92, 0x02, 0x93, 0x02,
+  0x93, 0x02, 0x97, 0x02, 0x99, 0x02, 0x99, 0x02, 0x9b, 0x02, 0x9c, 0x02,
+  0x9d, 0x02, 0x9e, 0x02, 0x9e, 0x02, 0xa0, 0x02, 0xa0, 0x02, 0xa3, 0x02,
+  0xa3, 0x02, 0xa5, 0x02, 0xa5, 0x02, 0xa5, 0x02, 0xa7, 0x02, 0xa8, 0x02,
+  0xaa, 0x02, 0xab, 0x02, 0xab, 0x02, 0xb0, 0x02, 0xb1, 0x02, 0xb6, 0x02,
+  0xb6, 0x02, 0xb6, 0x02, 0xb6, 0x02, 0xb6, 0x02, 0xb6, 0x02, 0xb6, 0x02,
+  0xb6, 0x02, 0xb6, 0x02, 0xb6, 0x02, 0xb8, 0x02, 0xb8, 0x02, 0xb9, 0x02,
+  0xba, 0x02, 0xbb, 0x02, 0xbb, 0x02, 0xbc, 0x02, 0xbc, 0x02, 0xbc, 0x02,
+  0xbd, 0x02, 0xbf, 0x02, 0xbf, 0x02, 0xc2, 0x02, 0xc2, 0x02, 0xc3, 0x02,
+  0xc4, 0x02, 0xc5, 0x02, 0xc5, 0x02, 0xc6, 0x02, 0xc9, 0x02, 0xca, 0x02,
+  0xcb, 0x02, 0xcb, 0x02, 0xcc, 0x02, 0xcc, 0x02, 0xcc, 0x02, 0xce, 0x02,
+  0xcf, 0x02, 0xd2, 0x02, 0xd3, 0x02, 0xd4, 0x02, 0xd5, 0x02, 0xd6, 0x02,
+  0xd7, 0x02, 0xd9, 0x02, 0xdc, 0x02, 0xdd, 0x02, 0xe0, 0x02, 0xe4, 0x02,
+  0xe4, 0x02, 0xe5, 0x02, 0xe6, 0x02, 0xe6, 0x02, 0xe6, 0x02, 0xe6, 0x02,
+  0xe6, 0x02, 0xe7, 0x02, 0xe8, 0x02, 0xe9, 0x02, 0xe9, 0x02, 0xeb, 0x02,
+  0xee, 0x02, 0xef, 0x02, 0xf0, 0x02, 0xf1, 0x02, 0xf1, 0x02, 0xf1, 0x02,
+  0xf1, 0x02, 0xf2, 0x02, 0xf2, 0x02, 0xf2, 0x02, 0xf2, 0x02, 0xf5, 0x02,
+  0xf6, 0x02, 0xf7, 0x02, 0xf7, 0x02, 0xf8, 0x02, 0xf9, 0x02, 0xf9, 0x02,
+  0xf9, 0x02, 0xfa, 0x02, 0xfa, 0x02, 0xfa, 0x02, 0xfa, 0x02, 0xfa, 0x02,
+  0xfa, 0x02, 0xfb, 0x02, 0xfb, 0x02, 0xfc, 0x02, 0xfe, 0x02, 0xff, 0x02,
+  0xff, 0x02, 0x00, 0x03, 0x00, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03,
+  0x05, 0x03, 0x07, 0x03, 0x08, 0x03, 0x0a, 0x03, 0x0b, 0x03, 0x0b, 0x03,
+  0x0d, 0x03, 0x10, 0x03, 0x10, 0x03, 0x11, 0x03, 0x14, 0x03, 0x17, 0x03,
+  0x19, 0x03, 0x1c, 0x03, 0x1c, 0x03, 0x1e, 0x03, 0x1f, 0x03, 0x20, 0x03,
+  0x20, 0x03, 0x25, 0x03, 0x25, 0x03, 0x26, 0x03, 0x28, 0x03, 0x29, 0x03,
+  0x2a, 0x03, 0x2b, 0x03, 0x2e, 0x03, 0x2e, 0x03, 0x30, 0x03, 0x30, 0x03,
+  0x31, 0x03, 0x31, 0x03, 0x31, 0x03, 0x31, 0x03, 0x31, 0x03, 0x31, 0x03,
+  0x31, 0x03, 0x33, 0x03, 0x34, 0x03, 0x35, 0x03, 0x36, 0x03, 0x36, 0x03,
+  0x37, 0x03, 0x37, 0x03, 0x3a, 0x03, 0x3b, 0x03, 0x3b, 0x03, 0x3b, 0x03,
+  0x3b, 0x03, 0x3c, 0x03, 0x3d, 0x03, 0x3e, 0x03, 0x40, 0x03, 0x41, 0x03,
+  0x41, 0x03, 0x43, 0x03, 0x44, 0x03, 0x45, 0x03, 0x45, 0x03, 0x48, 0x03,
+  0x4a, 0x03, 0x4a, 0x03, 0x4a, 0x03, 0x4a, 0x03, 0x4b, 0x03, 0x4b, 0x03,
+  0x4b, 0x03, 0x4c, 0x03, 0x4f, 0x03, 0x51, 0x03, 0x51, 0x03, 0x52, 0x03,
+  0x53, 0x03, 0x55, 0x03, 0x57, 0x03, 0x59, 0x03, 0x5d, 0x03, 0x5d, 0x03,
+  0x5d, 0x03, 0x5d, 0x03, 0x5d, 0x03, 0x5d, 0x03, 0x5d, 0x03, 0x5d, 0x03,
+  0x5d, 0x03, 0x5f, 0x03, 0x62, 0x03, 0x62, 0x03, 0x63, 0x03, 0x64, 0x03,
+  0x67, 0x03, 0x68, 0x03, 0x69, 0x03, 0x69, 0x03, 0x6d, 0x03, 0x6e, 0x03,
+  0x70, 0x03, 0x71, 0x03, 0x71, 0x03, 0x71, 0x03, 0x72, 0x03, 0x73, 0x03,
+  0x74, 0x03, 0x74, 0x03, 0x74, 0x03, 0x75, 0x03, 0x76, 0x03, 0x76, 0x03,
+  0x77, 0x03, 0x77, 0x03, 0x77, 0x03, 0x78, 0x03, 0x79, 0x03, 0x79, 0x03,
+  0x79, 0x03, 0x79, 0x03, 0x79, 0x03, 0x7a, 0x03, 0x7c, 0x03, 0x7c, 0x03,
+  0x7e, 0x03, 0x82, 0x03, 0x83, 0x03, 0x85, 0x03, 0x85, 0x03, 0x87, 0x03,
+  0x87, 0x03, 0x89, 0x03, 0x89, 0x03, 0x8a, 0x03, 0x8b, 0x03, 0x8b, 0x03,
+  0x8b, 0x03, 0x8c, 0x03, 0x8d, 0x03, 0x8d, 0x03, 0x8d, 0x03, 0x8d, 0x03,
+  0x8d, 0x03, 0x8e, 0x03, 0x91, 0x03, 0x91, 0x03, 0x92, 0x03, 0x95, 0x03,
+  0x95, 0x03, 0x95, 0x03, 0x97, 0x03, 0x99, 0x03, 0x99, 0x03, 0x9a, 0x03,
+  0x9a, 0x03, 0x9a, 0x03, 0x9d, 0x03, 0x9e, 0x03, 0x9e, 0x03, 0xa1, 0x03,
+  0xa2, 0x03, 0x00, 0x00, 0xd4, 0xd4, 0xe5, 0x88, 0x2b, 0xbb, 0x23, 0xab,
+  0x4d, 0x9b, 0xa9, 0x50, 0x06, 0xeb, 0x2c, 0x1b, 0x6f, 0xfa, 0x3c, 0x67,
+  0xcc, 0x9c, 0xb2, 0x7a, 0x7d, 0x65, 0x51, 0xf6, 0x92, 0xa7, 0x2b, 0xd9,
+  0xae, 0x39, 0x94, 0x7d, 0x00, 0x79, 0xf2, 0x42, 0xfb, 0xcc, 0xb5, 0x6e,
+  0x66, 0xca, 0xdb, 0xbe, 0x5a, 0xb8, 0x44, 0x34, 0xb2, 0x3a, 0x7a, 0xa5,
+  0x13, 0x30, 0x85, 0x67, 0x64, 0xd6, 0x51, 0xa9, 0x4f, 0x98, 0x0f, 0x35,
+  0xaa, 0x14, 0xe3, 0x7d, 0x02, 0x62, 0x08, 0xf8, 0x99, 0x86, 0x3e, 0xfd,
+  0x60, 0x2d, 0xe4, 0xaf, 0x2d, 0xa3, 0xec, 0x7d, 0x65, 0x85, 0xb6, 0x91,
+  0x33, 0x85, 0x09, 0xe1, 0x21, 0x43, 0xc3, 0x2a, 0x85, 0xee, 0x40, 0x5a,
+  0x12, 0x4c, 0x52, 0xc1, 0xc8, 0x6d, 0x6f, 0xfe, 0x1c, 0xe6, 0xc5, 0xa8,
+  0xd7, 0x63, 0xda, 0xff, 0x71, 0xd7, 0x99, 0x6e, 0xc1, 0xc2, 0x29, 0x68,
+  0xbd, 0x15, 0x85, 0x3c, 0x40, 0x4a, 0x10, 0x89, 0x68, 0x67, 0x90, 0x98,
+  0xa6, 0x2a, 0x79, 0xc5, 0x3d, 0x02, 0x3d, 0xf5, 0x62, 0x7a, 0x48, 0xdf,
+  0xd4, 0x40, 0x0c, 0xbc, 0x00, 0xb7, 0xbd, 0x1b, 0x4e, 0x02, 0xee, 0x45,
+  0x7c, 0x3e, 0xac, 0x8f, 0x5c, 0xf7, 0x23, 0x39, 0x94, 0xb2, 0x28, 0x9e,
+  0x48, 0x81, 0x9d, 0x08, 0xfd, 0x97, 0x01, 0x18, 0xca, 0xc3, 0x32, 0x9b,
+  0x58, 0xde, 0x6f, 0x28, 0x42, 0x02, 0xf0, 0x81, 0xee, 0xc4, 0xbb, 0x45,
+  0xd3, 0xf4, 0xc4, 0xc0, 0x92, 0x78, 0x73, 0xf9, 0x1c, 0xf5, 0xb4, 0x00,
+  0x50, 0x11, 0x2a, 0x99, 0x1c, 0x5f, 0x06, 0x11, 0x4c, 0x72, 0x15, 0x68,
+  0xd5, 0xaf, 0x07, 0xc3, 0x8d, 0x13, 0xef, 0xb6, 0xcf, 0x1d, 0x07, 0x06,
+  0xf9, 0x8d, 0x30, 0x4f, 0x4d, 0xef, 0x8c, 0x2d, 0x77, 0xa0, 0x70, 0x12,
+  0x18, 0xe7, 0xa0, 0xac, 0xc2, 0xf7, 0xf2, 0x9a, 0x2c, 0x2b, 0x9e, 0x9c,
+  0xc3, 0xd8, 0x18, 0x37, 0xa0, 0x55, 0xa7, 0x13, 0xa7, 0xa4, 0x79, 0x32,
+  0xb2, 0xae, 0x74, 0x7b, 0x03, 0x5d, 0xf4, 0xea, 0x8f, 0xb1, 0x92, 0x5b,
+  0x22, 0x21, 0x76, 0x83, 0x5e, 0x9e, 0x8e, 0xeb, 0xf8, 0x99, 0x47, 0x65,
+  0x88, 0x60, 0xca, 0x91, 0x06, 0x05, 0x2a, 0x98, 0xc1, 0x2c, 0x01, 0x20,
+  0xf7, 0xae, 0xeb, 0xdc, 0x2e, 0xd0, 0x9b, 0x35, 0xba, 0xee, 0xf7, 0x7a,
+  0xcc, 0xe7, 0xf1, 0x53, 0x14, 0x01, 0x49, 0xeb, 0x36, 0x37, 0x1c, 0x86,
+  0x0c, 0xab, 0x1d, 0xa3, 0x85, 0xa9, 0x90, 0x45, 0x54, 0x81, 0xc9, 0xd0,
+  0x1e, 0xdd, 0x2d, 0xc4, 0x50, 0x8a, 0x3a, 0x11, 0x82, 0x46, 0x6d, 0x57,
+  0xb1, 0xb6, 0x64, 0x84, 0xa5, 0xa8, 0x16, 0x96, 0x56, 0x9a, 0x6c, 0x33,
+  0x41, 0x4e, 0x32, 0xfb, 0xa6, 0x39, 0x24, 0xc4, 0xa1, 0x8f, 0xbc, 0xb1,
+  0x2f, 0x28, 0xed, 0x22, 0xf1, 0xf5, 0xee, 0x3e, 0x5d, 0x72, 0x0b, 0x56,
+  0xe4, 0x1d, 0x8b, 0x00, 0xae, 0x48, 0x7a, 0x02, 0xe7, 0xc9, 0x0c, 0x66,
+  0xf7, 0x34, 0x7c, 0x64, 0x90, 0xa5, 0x71, 0xe0, 0x48, 0xce, 0x0d, 0xca,
+  0x5f, 0xf1, 0x2f, 0x60, 0xac, 0x5b, 0xd1, 0x09, 0x89, 0xe2, 0xc8, 0x11,
+  0xc9, 0x72, 0x15, 0xc1, 0x21, 0x7c, 0x16, 0x9b, 0x44, 0x52, 0x53, 0x75,
+  0x39, 0xfa, 0xd1, 0x53, 0x11, 0xfd, 0xff, 0x50, 0x35, 0xe8, 0x45, 0xe1,
+  0xae, 0x62, 0x91, 0xa6, 0xc6, 0x9c, 0x91, 0xb0, 0x18, 0x5a, 0xbd, 0x35,
+  0xbe, 0xb1, 0x03, 0xe1, 0x8b, 0x2e, 0xf0, 0x3b, 0xe3, 0x46, 0xe4, 0xad,
+  0x0e, 0x5c, 0x9f, 0x3a, 0x3c, 0x67, 0x50, 0x2d, 0x17, 0xe1, 0xb2, 0x41,
+  0x62, 0x90, 0x74, 0x6c, 0xb3, 0x75, 0x78, 0x69, 0x3e, 0x34, 0xab, 0xd4,
+  0x43, 0xd9, 0x2c, 0xd8, 0x9a, 0x2b, 0xcc, 0xae, 0x10, 0xf8, 0xe6, 0xec,
+  0xcf, 0x71, 0xc9, 0x36, 0x38, 0x0c, 0xfe, 0xc2, 0xda, 0x6d, 0x00, 0xb5,
+  0xe6, 0x5d, 0x75, 0xba, 0x3c, 0xb6, 0xca, 0xa4, 0xfb, 0xe2, 0x85, 0xca,
+  0xbd, 0x57, 0x4b, 0xd4, 0xc4, 0xab, 0x2c, 0xfa, 0x00, 0xe9, 0x51, 0x94,
+  0xcf, 0x13, 0x02, 0xf2, 0xcf, 0x7d, 0xff, 0xc0, 0xc6, 0x94, 0x2f, 0xe9,
+  0x70, 0x10, 0x19, 0xa3, 0xcb, 0x66, 0x65, 0xe8, 0x32, 0xde, 0x0a, 0xd8,
+  0xf8, 0x0d, 0xf6, 0x92, 0xda, 0xb2, 0x6d, 0xa2, 0xd6, 0x27, 0x11, 0x7a,
+  0xfe, 0x20, 0xa5, 0xd7, 0x08, 0x7a, 0xba, 0x31, 0xb6, 0x15, 0xc3, 0x0e,
+  0x3d, 0xc0, 0x97, 0xf4, 0xd6, 0xb8, 0x00, 0xca, 0x49, 0xfe, 0x80, 0x68,
+  0x0a, 0x4c, 0x19, 0xb9, 0xea, 0xbb, 0x4f, 0x91, 0x53, 0xac, 0xda, 0x0e,
+  0x5d, 0xba, 0x9c, 0x48, 0x13, 0x91, 0x83, 0xf2, 0x83, 0xbe, 0xdc, 0xd2,
+  0xf2, 0x81, 0x1c, 0x89, 0xde, 0xfd, 0xe1, 0x0c, 0x60, 0xff, 0x44, 0x48,
+  0x73, 0x68, 0x4d, 0x1c, 0x75, 0x54, 0xd4, 0x85, 0xb0, 0x68, 0x88, 0x07,
+  0xb3, 0x67, 0xc4, 0x17, 0x84, 0x55, 0xec, 0x52, 0x0b, 0x39, 0x91, 0x1e,
+  0xb5, 0xe1, 0xbf, 0xbd, 0xc1, 0xd0, 0x72, 0xfb, 0x53, 0x35, 0x6c, 0x15,
+  0xaa, 0xf4, 0x4e, 0x3b, 0xb3, 0x82, 0x05, 0x17, 0x08, 0xb7, 0x97, 0x11,
+  0xc5, 0x46, 0x31, 0xe7, 0xd0, 0xe9, 0x33, 0x5d, 0x22, 0xe9, 0x03, 0xb6,
+  0x01, 0xde, 0xef, 0xc6, 0xfa, 0x41, 0xfa, 0xa2, 0x63, 0xb1, 0x07, 0x8e,
+  0x64, 0xec, 0xbc, 0xf8, 0xcd, 0xc5, 0x2d, 0x12, 0xa1, 0xfe, 0x8a, 0x74,
+  0xfa, 0xe7, 0x23, 0x6b, 0x31, 0xc0, 0xa4, 0xf3, 0xc5, 0x52, 0x96, 0xf7,
+  0x83, 0x17, 0x3f, 0x94, 0x32, 0x0d, 0xd9, 0xce, 0x79, 0x67, 0xbb, 0x79,
+  0x65, 0x71, 0x45, 0xba, 0x8e, 0xb6, 0xaf, 0x24, 0x26, 0xb9, 0x2c, 0xf4,
+  0xe7, 0xd2, 0x30, 0xc4, 0xf3, 0x23, 0x62, 0xa5, 0x44, 0x45, 0x8c, 0x9d,
+  0xda, 0x45, 0xc4, 0x46, 0x3f, 0x9c, 0xea, 0xdf, 0xde, 0xb1, 0x06, 0x97,
+  0x71, 0xe0, 0x60, 0xc1, 0xa9, 0x4d, 0x51, 0xd7, 0xc7, 0xff, 0xaf, 0xec,
+  0x8f, 0xa6, 0xc6, 0xa9, 0x72, 0x36, 0x0c, 0x5f, 0x59, 0x90, 0x35, 0xd4,
+  0x1a, 0x86, 0x11, 0x32, 0x60, 0xb2, 0xb2, 0x00, 0xb0, 0xcc, 0xbe, 0x3b,
+  0x6a, 0x12, 0x53, 0x44, 0x8d, 0xb4, 0xf4, 0x53, 0xfd, 0x59, 0x64, 0x25,
+  0x67, 0xa1, 0x1e, 0x4b, 0x7b, 0xa5, 0x87, 0xf3, 0x61, 0x72, 0xe3, 0xe0,
+  0xc2, 0xf2, 0x66, 0x19, 0xed, 0x3f, 0xcc, 0x90, 0x44, 0x58, 0x37, 0xaa,
+  0x24, 0x3c, 0x26, 0x32, 0x3a, 0x91, 0x25, 0x6f, 0xbe, 0x3d, 0x23, 0xba,
+  0x45, 0x83, 0x7e, 0xfd, 0x0e, 0xc7, 0xa2, 0x08, 0x58, 0xae, 0x13, 0x3c,
+  0x44, 0x76, 0x36, 0x8f, 0xc7, 0x09, 0x0e, 0x3d, 0x6a, 0x9c, 0xfe, 0x51,
+  0x14, 0x4e, 0x9b, 0x3c, 0x14, 0x51, 0x0a, 0x8b, 0x0b, 0x46, 0x7d, 0x87,
+  0x24, 0x87, 0xff, 0x81, 0x3c, 0x5e, 0x0f, 0x16, 0x34, 0x11, 0xe5, 0x3a,
+  0x3f, 0x95, 0x37, 0xc3, 0x2c, 0xcd, 0x86, 0x79, 0xe5, 0x7f, 0x00, 0x00,
+  0x0e, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x27, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x0f, 0x00,
+  0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x16, 0x00,
+  0x28, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00,
+  0x19, 0x00, 0x00, 0x00, 0x07, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0a, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00,
+  0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x07, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x15, 0x00, 0x2b, 0x00, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x11, 0x00, 0x23, 0x00,
+  0x35, 0x00, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x00, 0x00, 0x20, 0x00, 0x35, 0x00, 0x3e, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x2f, 0x00, 0x3d, 0x00, 0x50, 0x00, 0x5e, 0x00, 0x00, 0x00,
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x15, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x20, 0x00, 0x2d, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0f, 0x00, 0x28, 0x00, 0x48, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x15, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x21, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x2f, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x18, 0x00,
+  0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x0d, 0x00,
+  0x00, 0x00, 0x0a, 0x00, 0x18, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x2a, 0x00,
+  0x3d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x1e, 0x00, 0x36, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x06, 0x00, 0x21, 0x00, 0x2d, 0x00, 0x39, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x13, 0x00,
+  0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x1a, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0f, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x18, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00,
+  0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x19, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1a, 0x00, 0x28, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x14, 0x00,
+  0x27, 0x00, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x28, 0x00,
+  0x00, 0x00, 0x15, 0x00, 0x22, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x15, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00,
+  0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x2a, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x27, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1a, 0x00, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x15, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x00,
+  0x29, 0x00, 0x39, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x23, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x23, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00,
+  0x24, 0x00, 0x32, 0x00, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00,
+  0x2b, 0x00, 0x3f, 0x00, 0x55, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00,
+  0x00, 0x00, 0x14, 0x00, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00,
+  0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x18, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0a, 0x00, 0x14, 0x00, 0x00, 0x00, 0x12, 0x00, 0x1e, 0x00,
+  0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x21, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x16, 0x00, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00,
+  0x00, 0x00, 0x13, 0x00, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00,
+  0x23, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x1a, 0x00,
+  0x00, 0x00, 0x06, 0x00, 0x22, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x34, 0x00, 0x44, 0x00, 0x5d, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x17, 0x00, 0x29, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x18, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x23, 0x00, 0x00, 0x00,
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x26, 0x00,
+  0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00,
+  0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x1c, 0x00,
+  0x2e, 0x00, 0x40, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x11, 0x00,
+  0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x21, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x2c, 0x00, 0x41, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x21, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00,
+  0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x35, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x0d, 0x00,
+  0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x24, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x2f, 0x00, 0x00, 0x00
+};
@@ -1,5 +1,7 @@
 #pragma once
-const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
+#include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/tn_dict_index.h>
+const unsigned char __espeakng_dict_tn[] __attribute__((aligned((4)))) = {
   0x00, 0x04, 0x00, 0x00, 0x18, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x06, 0xc3, 0x38, 0x16, 0x41, 0x4c, 0x20, 0x04, 0x5f, 0x38, 0x4d,
   0x31, 0x49, 0x25, 0x31, 0x06, 0x24, 0x2f, 0x24, 0x06, 0x73, 0x24, 0x06,
@@ -257,4 +259,11 @@ const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
   0x5a, 0x25, 0x37, 0x25, 0x42, 0x25, 0x23, 0x00, 0x2a, 0x03, 0x44, 0x27,
   0x2f, 0x23, 0x00, 0x24, 0x03, 0x49, 0x27, 0x37, 0x23, 0x00, 0x07, 0x00
 };
-size_t __espeakng_dictlen = 3072;
+
+BackgroundAudioDictionary dict_tn = {
+    "tn",
+    3072,
+    __espeakng_dict_tn,
+    2398,
+    __espeakng_dictindex_tn
+};
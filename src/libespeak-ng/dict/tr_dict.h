@@ -1,5 +1,7 @@
 #pragma once
-const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
+#include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/tr_dict_index.h>
+const unsigned char __espeakng_dict_tr[] __attribute__((aligned((4)))) = {
   0x00, 0x04, 0x00, 0x00, 0x25, 0xac, 0x00, 0x00, 0x00, 0x48, 0x19, 0xf0,
   0x9f, 0x91, 0xa9, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xe2, 0x80,
   0x8d, 0xf0, 0x9f, 0x91, 0xa7, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa7,
@@ -3901,4 +3903,11 @@ const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
   0x49, 0x27, 0x37, 0x23, 0x22, 0x00, 0x04, 0xc3, 0xa4, 0x03, 0x6d, 0x00,
   0xc9, 0x99, 0x00, 0x07, 0x00
 };
-size_t __espeakng_dictlen = 46793;
+
+BackgroundAudioDictionary dict_tr = {
+    "tr",
+    46793,
+    __espeakng_dict_tr,
+    7952,
+    __espeakng_dictindex_tr
+};
@@ -1,5 +1,7 @@
 #pragma once
-const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
+#include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/tt_dict_index.h>
+const unsigned char __espeakng_dict_tt[] __attribute__((aligned((4)))) = {
   0x00, 0x04, 0x00, 0x00, 0xcc, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x06, 0x41, 0x70, 0x6e, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x04,
@@ -178,4 +180,11 @@ const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
   0x07, 0x06, 0xd3, 0xa9, 0x00, 0x03, 0x6d, 0x00, 0x07, 0x06, 0x00, 0x24,
   0x03, 0x49, 0x27, 0x37, 0x70, 0x33, 0x00, 0x07, 0x00
 };
-size_t __espeakng_dictlen = 2121;
+
+BackgroundAudioDictionary dict_tt = {
+    "tt",
+    2121,
+    __espeakng_dict_tt,
+    2290,
+    __espeakng_dictindex_tt
+};
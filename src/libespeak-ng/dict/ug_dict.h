@@ -1,5 +1,7 @@
 #pragma once
-const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
+#include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/ug_dict_index.h>
+const unsigned char __espeakng_dict_ug[] __attribute__((aligned((4)))) = {
   0x00, 0x04, 0x00, 0x00, 0xde, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x0b, 0x04, 0x5f, 0x64, 0x70, 0x74, 0x30, 0x06,
@@ -174,4 +176,11 @@ const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
   0x06, 0x7a, 0x00, 0x03, 0x59, 0x00, 0x27, 0x68, 0x03, 0x59, 0x41, 0x00,
   0x68, 0x03, 0x5b, 0x00, 0x07, 0x00
 };
-size_t __espeakng_dictlen = 2070;
+
+BackgroundAudioDictionary dict_ug = {
+    "ug",
+    2070,
+    __espeakng_dict_ug,
+    2180,
+    __espeakng_dictindex_ug
+};
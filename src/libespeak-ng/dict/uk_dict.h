@@ -1,5 +1,7 @@
 #pragma once
-const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
+#include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/uk_dict_index.h>
+const unsigned char __espeakng_dict_uk[] __attribute__((aligned((4)))) = {
   0x00, 0x04, 0x00, 0x00, 0x43, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x06, 0xc3,
   0x80, 0xb2, 0x4a, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -292,4 +294,11 @@ const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
   0x03, 0x25, 0x0c, 0x00, 0x07, 0x06, 0x01, 0x38, 0x00, 0x03, 0x39, 0x25,
   0x0c, 0x00, 0x07, 0x06, 0x01, 0x72, 0x00, 0x03, 0x52, 0x00, 0x07, 0x00
 };
-size_t __espeakng_dictlen = 3492;
+
+BackgroundAudioDictionary dict_uk = {
+    "uk",
+    3492,
+    __espeakng_dict_uk,
+    2570,
+    __espeakng_dictindex_uk
+};
@@ -1,5 +1,7 @@
 #pragma once
-const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
+#include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/ur_dict_index.h>
+const unsigned char __espeakng_dict_ur[] __attribute__((aligned((4)))) = {
   0x00, 0x04, 0x00, 0x00, 0x9b, 0xb8, 0x01, 0x00, 0x14, 0x0a, 0xd8, 0xaa,
   0xd9, 0x88, 0xd8, 0xa7, 0xd8, 0xaa, 0xd8, 0xb1, 0x2f, 0x23, 0x55, 0x76,
   0x2f, 0x7a, 0x33, 0x00, 0x13, 0x0a, 0xd8, 0xae, 0xd8, 0xb1, 0xd8, 0xaf,
@@ -11131,4 +11133,11 @@ const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
   0x26, 0x76, 0x0f, 0x32, 0x71, 0x5c, 0x76, 0x32, 0x00, 0xdb, 0x94, 0x03,
   0x66, 0x23, 0x2f, 0x42, 0x23, 0x00, 0x07, 0x00
 };
-size_t __espeakng_dictlen = 133556;
+
+BackgroundAudioDictionary dict_ur = {
+    "ur",
+    133556,
+    __espeakng_dict_ur,
+    16070,
+    __espeakng_dictindex_ur
+};
@@ -0,0 +1,1343 @@
+#pragma once
+const unsigned char __espeakng_dictindex_ur[] __attribute__((aligned((4)))) = {
+  0x45, 0x44, 0x58, 0x31, 0xb4, 0x09, 0x02, 0x00, 0x9b, 0xb8, 0x01, 0x00,
+  0x3b, 0x12, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x05, 0x00, 0x0e, 0x00,
+  0x12, 0x00, 0x15, 0x00, 0x19, 0x00, 0x1b, 0x00, 0x1b, 0x00, 0x1c, 0x00,
+  0x1f, 0x00, 0x23, 0x00, 0x25, 0x00, 0x29, 0x00, 0x2d, 0x00, 0x31, 0x00,
+  0x33, 0x00, 0x47, 0x00, 0x4e, 0x00, 0x51, 0x00, 0x56, 0x00, 0x5c, 0x00,
+  0x61, 0x00, 0x65, 0x00, 0x66, 0x00, 0x6a, 0x00, 0x6d, 0x00, 0x72, 0x00,
+  0x76, 0x00, 0x78, 0x00, 0x7f, 0x00, 0x80, 0x00, 0x84, 0x00, 0x85, 0x00,
+  0x86, 0x00, 0x87, 0x00, 0x8c, 0x00, 0x8e, 0x00, 0x91, 0x00, 0x95, 0x00,
+  0x99, 0x00, 0x9e, 0x00, 0xa0, 0x00, 0xa3, 0x00, 0xa3, 0x00, 0xae, 0x00,
+  0xaf, 0x00, 0xb4, 0x00, 0xb4, 0x00, 0xb9, 0x00, 0xba, 0x00, 0xbe, 0x00,
+  0xc2, 0x00, 0xc7, 0x00, 0xcf, 0x00, 0xd3, 0x00, 0xd3, 0x00, 0xd6, 0x00,
+  0xd7, 0x00, 0xda, 0x00, 0xdd, 0x00, 0xde, 0x00, 0xe2, 0x00, 0xe8, 0x00,
+  0xeb, 0x00, 0xee, 0x00, 0xf0, 0x00, 0xf1, 0x00, 0xf5, 0x00, 0xf5, 0x00,
+  0xfa, 0x00, 0xfc, 0x00, 0x00, 0x01, 0x05, 0x01, 0x07, 0x01, 0x18, 0x01,
+  0x18, 0x01, 0x26, 0x01, 0x26, 0x01, 0x2b, 0x01, 0x2d, 0x01, 0x2f, 0x01,
+  0x35, 0x01, 0x3a, 0x01, 0x3c, 0x01, 0x3f, 0x01, 0x42, 0x01, 0x47, 0x01,
+  0x49, 0x01, 0x4b, 0x01, 0x51, 0x01, 0x5a, 0x01, 0x5e, 0x01, 0x68, 0x01,
+  0x6a, 0x01, 0x6c, 0x01, 0x6d, 0x01, 0x6f, 0x01, 0x73, 0x01, 0x75, 0x01,
+  0x7b, 0x01, 0x7b, 0x01, 0x7d, 0x01, 0x7f, 0x01, 0x83, 0x01, 0x86, 0x01,
+  0x87, 0x01, 0x94, 0x01, 0x96, 0x01, 0xa5, 0x01, 0xaa, 0x01, 0xaf, 0x01,
+  0xb2, 0x01, 0xb9, 0x01, 0xbc, 0x01, 0xc1, 0x01, 0xc5, 0x01, 0xc9, 0x01,
+  0xd0, 0x01, 0xd4, 0x01, 0xd5, 0x01, 0xdd, 0x01, 0xe0, 0x01, 0xe7, 0x01,
+  0xea, 0x01, 0xf1, 0x01, 0xf4, 0x01, 0xf8, 0x01, 0xfa, 0x01, 0xfa, 0x01,
+  0xfa, 0x01, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x04, 0x02, 0x07, 0x02,
+  0x08, 0x02, 0x0b, 0x02, 0x0d, 0x02, 0x14, 0x02, 0x19, 0x02, 0x22, 0x02,
+  0x25, 0x02, 0x2a, 0x02, 0x33, 0x02, 0x37, 0x02, 0x40, 0x02, 0x42, 0x02,
+  0x4b, 0x02, 0x53, 0x02, 0x59, 0x02, 0x62, 0x02, 0x68, 0x02, 0x6d, 0x02,
+  0x70, 0x02, 0x79, 0x02, 0x7d, 0x02, 0x80, 0x02, 0xa6, 0x02, 0xad, 0x02,
+  0xb2, 0x02, 0xb3, 0x02, 0xb8, 0x02, 0xbd, 0x02, 0xc0, 0x02, 0xc2, 0x02,
+  0xc2, 0x02, 0xc2, 0x02, 0xc4, 0x02, 0xcb, 0x02, 0xcc, 0x02, 0xd2, 0x02,
+  0xd3, 0x02, 0xd7, 0x02, 0xd9, 0x02, 0xe1, 0x02, 0xe3, 0x02, 0xec, 0x02,
+  0xef, 0x02, 0xf4, 0x02, 0xf6, 0x02, 0xf9, 0x02, 0xfd, 0x02, 0xff, 0x02,
+  0x01, 0x03, 0x0a, 0x03, 0x0d, 0x03, 0x12, 0x03, 0x16, 0x03, 0x16, 0x03,
+  0x19, 0x03, 0x1a, 0x03, 0x1d, 0x03, 0x1e, 0x03, 0x21, 0x03, 0x22, 0x03,
+  0x23, 0x03, 0x25, 0x03, 0x26, 0x03, 0x2a, 0x03, 0x2c, 0x03, 0x2f, 0x03,
+  0x32, 0x03, 0x34, 0x03, 0x36, 0x03, 0x39, 0x03, 0x3a, 0x03, 0x3c, 0x03,
+  0x3f, 0x03, 0x43, 0x03, 0x46, 0x03, 0x4e, 0x03, 0x4e, 0x03, 0x53, 0x03,
+  0x53, 0x03, 0x59, 0x03, 0x5b, 0x03, 0x5f, 0x03, 0x61, 0x03, 0x62, 0x03,
+  0x68, 0x03, 0x6b, 0x03, 0x6c, 0x03, 0x6e, 0x03, 0x72, 0x03, 0x74, 0x03,
+  0x78, 0x03, 0x79, 0x03, 0x7d, 0x03, 0x7d, 0x03, 0x82, 0x03, 0x88, 0x03,
+  0x8b, 0x03, 0x8b, 0x03, 0x8d, 0x03, 0x8e, 0x03, 0x8e, 0x03, 0x8f, 0x03,
+  0x93, 0x03, 0x94, 0x03, 0x95, 0x03, 0x97, 0x03, 0x9d, 0x03, 0xa7, 0x03,
+  0xae, 0x03, 0xb5, 0x03, 0xb7, 0x03, 0xbb, 0x03, 0xc0, 0x03, 0xca, 0x03,
+  0xca, 0x03, 0xcb, 0x03, 0xce, 0x03, 0xd4, 0x03, 0xd7, 0x03, 0xd8, 0x03,
+  0xd8, 0x03, 0xdb, 0x03, 0xe4, 0x03, 0xe9, 0x03, 0xee, 0x03, 0xf3, 0x03,
+  0xf6, 0x03, 0xf9, 0x03, 0xfd, 0x03, 0xff, 0x03, 0x04, 0x04, 0x07, 0x04,
+  0x07, 0x04, 0x09, 0x04, 0x0a, 0x04, 0x0d, 0x04, 0x10, 0x04, 0x12, 0x04,
+  0x15, 0x04, 0x1a, 0x04, 0x1d, 0x04, 0x21, 0x04, 0x25, 0x04, 0x2b, 0x04,
+  0x30, 0x04, 0x34, 0x04, 0x3f, 0x04, 0x40, 0x04, 0x4a, 0x04, 0x51, 0x04,
+  0x52, 0x04, 0x55, 0x04, 0x56, 0x04, 0x5a, 0x04, 0x5f, 0x04, 0x60, 0x04,
+  0x63, 0x04, 0x65, 0x04, 0x69, 0x04, 0x6b, 0x04, 0x6d, 0x04, 0x6f, 0x04,
+  0x74, 0x04, 0x78, 0x04, 0x7b, 0x04, 0x7c, 0x04, 0x7e, 0x04, 0x82, 0x04,
+  0x83, 0x04, 0x85, 0x04, 0x85, 0x04, 0x86, 0x04, 0x8a, 0x04, 0x8d, 0x04,
+  0x90, 0x04, 0x91, 0x04, 0x99, 0x04, 0x9b, 0x04, 0xa5, 0x04, 0xa9, 0x04,
+  0xae, 0x04, 0xb5, 0x04, 0xba, 0x04, 0xba, 0x04, 0xbf, 0x04, 0xc2, 0x04,
+  0xc3, 0x04, 0xc9, 0x04, 0xca, 0x04, 0xd0, 0x04, 0xd3, 0x04, 0xd4, 0x04,
+  0xd8, 0x04, 0xdb, 0x04, 0xdd, 0x04, 0xde, 0x04, 0xe0, 0x04, 0xe0, 0x04,
+  0xe1, 0x04, 0xe5, 0x04, 0xe9, 0x04, 0xeb, 0x04, 0xee, 0x04, 0xf0, 0x04,
+  0xf2, 0x04, 0xf3, 0x04, 0xfd, 0x04, 0xff, 0x04, 0x06, 0x05, 0x0a, 0x05,
+  0x14, 0x05, 0x1b, 0x05, 0x1e, 0x05, 0x22, 0x05, 0x25, 0x05, 0x28, 0x05,
+  0x29, 0x05, 0x2d, 0x05, 0x2e, 0x05, 0x31, 0x05, 0x35, 0x05, 0x3c, 0x05,
+  0x3e, 0x05, 0x40, 0x05, 0x43, 0x05, 0x47, 0x05, 0x4c, 0x05, 0x4e, 0x05,
+  0x4f, 0x05, 0x53, 0x05, 0x55, 0x05, 0x58, 0x05, 0x5c, 0x05, 0x5e, 0x05,
+  0x63, 0x05, 0x68, 0x05, 0x6f, 0x05, 0x72, 0x05, 0x76, 0x05, 0x78, 0x05,
+  0x7c, 0x05, 0x7f, 0x05, 0x86, 0x05, 0x8b, 0x05, 0x8c, 0x05, 0x91, 0x05,
+  0x92, 0x05, 0x94, 0x05, 0x95, 0x05, 0x99, 0x05, 0x9a, 0x05, 0x9b, 0x05,
+  0x9e, 0x05, 0xa1, 0x05, 0xa5, 0x05, 0xa8, 0x05, 0xaa, 0x05, 0xab, 0x05,
+  0xae, 0x05, 0xaf, 0x05, 0xb2, 0x05, 0xb3, 0x05, 0xb7, 0x05, 0xbc, 0x05,
+  0xbf, 0x05, 0xc2, 0x05, 0xc4, 0x05, 0xc5, 0x05, 0xca, 0x05, 0xcc, 0x05,
+  0xcf, 0x05, 0xd3, 0x05, 0xdc, 0x05, 0xe1, 0x05, 0xe6, 0x05, 0xe9, 0x05,
+  0xef, 0x05, 0xf4, 0x05, 0xf7, 0x05, 0xfb, 0x05, 0xff, 0x05, 0x03, 0x06,
+  0x06, 0x06, 0x0a, 0x06, 0x0d, 0x06, 0x12, 0x06, 0x17, 0x06, 0x1b, 0x06,
+  0x1e, 0x06, 0x1f, 0x06, 0x22, 0x06, 0x26, 0x06, 0x2d, 0x06, 0x2f, 0x06,
+  0x31, 0x06, 0x34, 0x06, 0x36, 0x06, 0x38, 0x06, 0x3c, 0x06, 0x42, 0x06,
+  0x4a, 0x06, 0x4c, 0x06, 0x53, 0x06, 0x55, 0x06, 0x5b, 0x06, 0x5e, 0x06,
+  0x64, 0x06, 0x66, 0x06, 0x6c, 0x06, 0x72, 0x06, 0x77, 0x06, 0x7a, 0x06,
+  0x7e, 0x06, 0x81, 0x06, 0x85, 0x06, 0x89, 0x06, 0x8d, 0x06, 0x92, 0x06,
+  0x93, 0x06, 0x95, 0x06, 0x99, 0x06, 0x9a, 0x06, 0x9c, 0x06, 0xa7, 0x06,
+  0xac, 0x06, 0xaf, 0x06, 0xb1, 0x06, 0xb3, 0x06, 0xb8, 0x06, 0xbb, 0x06,
+  0xbd, 0x06, 0xc0, 0x06, 0xc6, 0x06, 0xca, 0x06, 0xcf, 0x06, 0xd2, 0x06,
+  0xd6, 0x06, 0xdb, 0x06, 0xdf, 0x06, 0xe2, 0x06, 0xe6, 0x06, 0xe9, 0x06,
+  0xea, 0x06, 0xf0, 0x06, 0xf7, 0x06, 0xfd, 0x06, 0x03, 0x07, 0x0b, 0x07,
+  0x0e, 0x07, 0x11, 0x07, 0x16, 0x07, 0x1b, 0x07, 0x1e, 0x07, 0x22, 0x07,
+  0x27, 0x07, 0x2a, 0x07, 0x2e, 0x07, 0x31, 0x07, 0x31, 0x07, 0x32, 0x07,
+  0x34, 0x07, 0x37, 0x07, 0x3d, 0x07, 0x40, 0x07, 0x41, 0x07, 0x42, 0x07,
+  0x4a, 0x07, 0x4e, 0x07, 0x59, 0x07, 0x5f, 0x07, 0x63, 0x07, 0x67, 0x07,
+  0x6b, 0x07, 0x70, 0x07, 0x73, 0x07, 0x75, 0x07, 0x78, 0x07, 0x7a, 0x07,
+  0x80, 0x07, 0x84, 0x07, 0x88, 0x07, 0x8a, 0x07, 0x8a, 0x07, 0x8b, 0x07,
+  0x8f, 0x07, 0x91, 0x07, 0x95, 0x07, 0x9b, 0x07, 0x9d, 0x07, 0x9e, 0x07,
+  0xa2, 0x07, 0xa9, 0x07, 0xac, 0x07, 0xb5, 0x07, 0xba, 0x07, 0xbe, 0x07,
+  0xc0, 0x07, 0xc8, 0x07, 0xce, 0x07, 0xd2, 0x07, 0xd6, 0x07, 0xdd, 0x07,
+  0xe2, 0x07, 0xe7, 0x07, 0xea, 0x07, 0xec, 0x07, 0xef, 0x07, 0xf1, 0x07,
+  0xf4, 0x07, 0xfc, 0x07, 0x03, 0x08, 0x07, 0x08, 0x0c, 0x08, 0x0d, 0x08,
+  0x0e, 0x08, 0x0f, 0x08, 0x16, 0x08, 0x17, 0x08, 0x1a, 0x08, 0x1a, 0x08,
+  0x1b, 0x08, 0x1d, 0x08, 0x21, 0x08, 0x22, 0x08, 0x23, 0x08, 0x24, 0x08,
+  0x27, 0x08, 0x2b, 0x08, 0x2e, 0x08, 0x34, 0x08, 0x34, 0x08, 0x38, 0x08,
+  0x39, 0x08, 0x3d, 0x08, 0x41, 0x08, 0x41, 0x08, 0x44, 0x08, 0x46, 0x08,
+  0x4a, 0x08, 0x51, 0x08, 0x55, 0x08, 0x57, 0x08, 0x58, 0x08, 0x58, 0x08,
+  0x5c, 0x08, 0x61, 0x08, 0x67, 0x08, 0x68, 0x08, 0x6b, 0x08, 0x6c, 0x08,
+  0x6e, 0x08, 0x70, 0x08, 0x74, 0x08, 0x76, 0x08, 0x77, 0x08, 0x77, 0x08,
+  0x77, 0x08, 0x7b, 0x08, 0x7b, 0x08, 0x81, 0x08, 0x83, 0x08, 0x85, 0x08,
+  0x87, 0x08, 0x8b, 0x08, 0x91, 0x08, 0x92, 0x08, 0x98, 0x08, 0x9a, 0x08,
+  0x9f, 0x08, 0xa2, 0x08, 0xa5, 0x08, 0xa6, 0x08, 0xaa, 0x08, 0xab, 0x08,
+  0xae, 0x08, 0xaf, 0x08, 0xb4, 0x08, 0xb5, 0x08, 0xb7, 0x08, 0xb9, 0x08,
+  0xc0, 0x08, 0xc1, 0x08, 0xc4, 0x08, 0xc5, 0x08, 0xc5, 0x08, 0xc6, 0x08,
+  0xc7, 0x08, 0xc9, 0x08, 0xca, 0x08, 0xcd, 0x08, 0xce, 0x08, 0xd3, 0x08,
+  0xd7, 0x08, 0xdb, 0x08, 0xe0, 0x08, 0xe2, 0x08, 0xe5, 0x08, 0xe6, 0x08,
+  0xeb, 0x08, 0xec, 0x08, 0xf2, 0x08, 0xf6, 0x08, 0xf7, 0x08, 0xf9, 0x08,
+  0xfc, 0x08, 0x00, 0x09, 0x04, 0x09, 0x06, 0x09, 0x0b, 0x09, 0x0f, 0x09,
+  0x12, 0x09, 0x13, 0x09, 0x18, 0x09, 0x1a, 0x09, 0x1d, 0x09, 0x1f, 0x09,
+  0x22, 0x09, 0x34, 0x09, 0x36, 0x09, 0x3b, 0x09, 0x3e, 0x09, 0x49, 0x09,
+  0x4c, 0x09, 0x50, 0x09, 0x54, 0x09, 0x58, 0x09, 0x5c, 0x09, 0x63, 0x09,
+  0x67, 0x09, 0x69, 0x09, 0x6d, 0x09, 0x6e, 0x09, 0x74, 0x09, 0x78, 0x09,
+  0x79, 0x09, 0x7d, 0x09, 0x82, 0x09, 0x82, 0x09, 0x84, 0x09, 0x89, 0x09,
+  0x90, 0x09, 0x95, 0x09, 0x9a, 0x09, 0x9d, 0x09, 0xa1, 0x09, 0xa5, 0x09,
+  0xa8, 0x09, 0xaa, 0x09, 0xae, 0x09, 0xb1, 0x09, 0xb3, 0x09, 0xb9, 0x09,
+  0xba, 0x09, 0xbd, 0x09, 0xc1, 0x09, 0xc6, 0x09, 0xca, 0x09, 0xd4, 0x09,
+  0xdd, 0x09, 0xe5, 0x09, 0xea, 0x09, 0xf3, 0x09, 0xfa, 0x09, 0x01, 0x0a,
+  0x0a, 0x0a, 0x0f, 0x0a, 0x16, 0x0a, 0x1c, 0x0a, 0x23, 0x0a, 0x29, 0x0a,
+  0x2f, 0x0a, 0x34, 0x0a, 0x3b, 0x0a, 0x41, 0x0a, 0x47, 0x0a, 0x4e, 0x0a,
+  0x56, 0x0a, 0x5d, 0x0a, 0x64, 0x0a, 0x6a, 0x0a, 0x71, 0x0a, 0x79, 0x0a,
+  0x81, 0x0a, 0x8c, 0x0a, 0x92, 0x0a, 0x9d, 0x0a, 0xa7, 0x0a, 0xaf, 0x0a,
+  0xb6, 0x0a, 0xc2, 0x0a, 0xca, 0x0a, 0xdc, 0x0a, 0xe6, 0x0a, 0xf6, 0x0a,
+  0x04, 0x0b, 0x0e, 0x0b, 0x1b, 0x0b, 0x22, 0x0b, 0x2a, 0x0b, 0x31, 0x0b,
+  0x3a, 0x0b, 0x42, 0x0b, 0x4c, 0x0b, 0x52, 0x0b, 0x5b, 0x0b, 0x65, 0x0b,
+  0x6f, 0x0b, 0x76, 0x0b, 0x80, 0x0b, 0x88, 0x0b, 0x90, 0x0b, 0x98, 0x0b,
+  0xa3, 0x0b, 0xab, 0x0b, 0xb3, 0x0b, 0xbe, 0x0b, 0xc5, 0x0b, 0xd0, 0x0b,
+  0xd8, 0x0b, 0xe3, 0x0b, 0xed, 0x0b, 0xf7, 0x0b, 0xfe, 0x0b, 0x13, 0x0c,
+  0x1a, 0x0c, 0x2a, 0x0c, 0x32, 0x0c, 0x38, 0x0c, 0x3f, 0x0c, 0x47, 0x0c,
+  0x55, 0x0c, 0x60, 0x0c, 0x68, 0x0c, 0x72, 0x0c, 0x79, 0x0c, 0x83, 0x0c,
+  0x8c, 0x0c, 0x91, 0x0c, 0x99, 0x0c, 0x9e, 0x0c, 0xa5, 0x0c, 0xad, 0x0c,
+  0xb8, 0x0c, 0xc1, 0x0c, 0xca, 0x0c, 0xd3, 0x0c, 0xe0, 0x0c, 0xea, 0x0c,
+  0xf1, 0x0c, 0xf8, 0x0c, 0x05, 0x0d, 0x0f, 0x0d, 0x18, 0x0d, 0x1d, 0x0d,
+  0x23, 0x0d, 0x29, 0x0d, 0x30, 0x0d, 0x35, 0x0d, 0x3b, 0x0d, 0x40, 0x0d,
+  0x4d, 0x0d, 0x57, 0x0d, 0x5c, 0x0d, 0x63, 0x0d, 0x6b, 0x0d, 0x6f, 0x0d,
+  0x77, 0x0d, 0x80, 0x0d, 0x87, 0x0d, 0x8d, 0x0d, 0x97, 0x0d, 0x9f, 0x0d,
+  0xa2, 0x0d, 0xa7, 0x0d, 0xaa, 0x0d, 0xb1, 0x0d, 0xb8, 0x0d, 0xbe, 0x0d,
+  0xc5, 0x0d, 0xd7, 0x0d, 0xe0, 0x0d, 0xe4, 0x0d, 0xea, 0x0d, 0xf1, 0x0d,
+  0xf6, 0x0d, 0xfb, 0x0d, 0x02, 0x0e, 0x08, 0x0e, 0x0b, 0x0e, 0x10, 0x0e,
+  0x15, 0x0e, 0x18, 0x0e, 0x1c, 0x0e, 0x21, 0x0e, 0x25, 0x0e, 0x2e, 0x0e,
+  0x3e, 0x0e, 0x45, 0x0e, 0x48, 0x0e, 0x4d, 0x0e, 0x54, 0x0e, 0x57, 0x0e,
+  0x5a, 0x0e, 0x61, 0x0e, 0x67, 0x0e, 0x6b, 0x0e, 0x6c, 0x0e, 0x6f, 0x0e,
+  0x74, 0x0e, 0x79, 0x0e, 0x7c, 0x0e, 0x7f, 0x0e, 0x87, 0x0e, 0x8d, 0x0e,
+  0x94, 0x0e, 0x99, 0x0e, 0xa4, 0x0e, 0xa6, 0x0e, 0xb2, 0x0e, 0xb9, 0x0e,
+  0xbe, 0x0e, 0xc1, 0x0e, 0xc4, 0x0e, 0xca, 0x0e, 0xcd, 0x0e, 0xd0, 0x0e,
+  0xd7, 0x0e, 0xdd, 0x0e, 0xe9, 0x0e, 0xed, 0x0e, 0xf2, 0x0e, 0xf6, 0x0e,
+  0xfd, 0x0e, 0x00, 0x0f, 0x04, 0x0f, 0x07, 0x0f, 0x08, 0x0f, 0x0d, 0x0f,
+  0x10, 0x0f, 0x18, 0x0f, 0x1e, 0x0f, 0x22, 0x0f, 0x28, 0x0f, 0x2d, 0x0f,
+  0x38, 0x0f, 0x3f, 0x0f, 0x48, 0x0f, 0x4c, 0x0f, 0x53, 0x0f, 0x5d, 0x0f,
+  0x67, 0x0f, 0x6f, 0x0f, 0x7a, 0x0f, 0x80, 0x0f, 0x88, 0x0f, 0x8f, 0x0f,
+  0x94, 0x0f, 0x99, 0x0f, 0x9d, 0x0f, 0xa4, 0x0f, 0xac, 0x0f, 0xb2, 0x0f,
+  0xbc, 0x0f, 0xc0, 0x0f, 0xc3, 0x0f, 0xc9, 0x0f, 0xce, 0x0f, 0xd5, 0x0f,
+  0xdc, 0x0f, 0xe4, 0x0f, 0xeb, 0x0f, 0xf3, 0x0f, 0xfd, 0x0f, 0x05, 0x10,
+  0x0c, 0x10, 0x14, 0x10, 0x22, 0x10, 0x2f, 0x10, 0x37, 0x10, 0x43, 0x10,
+  0x52, 0x10, 0x5c, 0x10, 0x6a, 0x10, 0x72, 0x10, 0x7d, 0x10, 0x84, 0x10,
+  0x8b, 0x10, 0x90, 0x10, 0x98, 0x10, 0xa3, 0x10, 0xab, 0x10, 0xb4, 0x10,
+  0xc1, 0x10, 0xc8, 0x10, 0xd3, 0x10, 0xda, 0x10, 0xe3, 0x10, 0xea, 0x10,
+  0xed, 0x10, 0xf5, 0x10, 0xf8, 0x10, 0xfe, 0x10, 0x02, 0x11, 0x06, 0x11,
+  0x0a, 0x11, 0x0c, 0x11, 0x10, 0x11, 0x14, 0x11, 0x17, 0x11, 0x1d, 0x11,
+  0x22, 0x11, 0x28, 0x11, 0x34, 0x11, 0x3a, 0x11, 0x44, 0x11, 0x47, 0x11,
+  0x4b, 0x11, 0x52, 0x11, 0x5a, 0x11, 0x5c, 0x11, 0x61, 0x11, 0x67, 0x11,
+  0x6b, 0x11, 0x74, 0x11, 0x79, 0x11, 0x79, 0x11, 0x7b, 0x11, 0x7c, 0x11,
+  0x7e, 0x11, 0x81, 0x11, 0x84, 0x11, 0x88, 0x11, 0x89, 0x11, 0x89, 0x11,
+  0x8d, 0x11, 0x8d, 0x11, 0x8e, 0x11, 0x90, 0x11, 0x92, 0x11, 0x92, 0x11,
+  0x94, 0x11, 0x95, 0x11, 0x99, 0x11, 0x9c, 0x11, 0xa1, 0x11, 0xa3, 0x11,
+  0xa8, 0x11, 0xad, 0x11, 0xaf, 0x11, 0xb2, 0x11, 0xb8, 0x11, 0xbb, 0x11,
+  0xbf, 0x11, 0xc0, 0x11, 0xc1, 0x11, 0xc3, 0x11, 0xc6, 0x11, 0xce, 0x11,
+  0xd0, 0x11, 0xdc, 0x11, 0xe0, 0x11, 0xe3, 0x11, 0xe4, 0x11, 0xe8, 0x11,
+  0xeb, 0x11, 0xec, 0x11, 0xee, 0x11, 0xef, 0x11, 0xf1, 0x11, 0xf3, 0x11,
+  0xf4, 0x11, 0xf4, 0x11, 0xf4, 0x11, 0xf7, 0x11, 0xfc, 0x11, 0xfe, 0x11,
+  0x01, 0x12, 0x04, 0x12, 0x0c, 0x12, 0x10, 0x12, 0x1f, 0x12, 0x23, 0x12,
+  0x25, 0x12, 0x2e, 0x12, 0x37, 0x12, 0x39, 0x12, 0x39, 0x12, 0x3a, 0x12,
+  0x3b, 0x12, 0x00, 0x00, 0xd2, 0x43, 0x8c, 0x02, 0x63, 0x31, 0x3e, 0xc6,
+  0x70, 0x35, 0x0b, 0xbb, 0xc2, 0x00, 0x0d, 0x34, 0x43, 0xf5, 0x8f, 0xa1,
+  0x35, 0xad, 0xd8, 0xac, 0xbe, 0x9b, 0x28, 0x6a, 0x64, 0xa9, 0xa9, 0x12,
+  0x6c, 0x6c, 0x3b, 0xa7, 0x3a, 0x2c, 0x24, 0xb7, 0xba, 0x09, 0x6c, 0x32,
+  0x88, 0xe7, 0x11, 0xac, 0x3e, 0x57, 0xb0, 0x5c, 0x12, 0x12, 0x12, 0xd3,
+  0x45, 0x12, 0xf3, 0x5a, 0x12, 0x42, 0x12, 0x5e, 0x12, 0x12, 0x12, 0x12,
+  0xbc, 0x33, 0x3d, 0x18, 0x55, 0x43, 0x56, 0x4b, 0xab, 0x2a, 0xe2, 0x7f,
+  0x69, 0xf7, 0x38, 0xac, 0x71, 0xf2, 0xf7, 0xf8, 0xbf, 0x63, 0x64, 0x65,
+  0x7d, 0x3b, 0x25, 0x5e, 0xee, 0x51, 0x9e, 0x29, 0x90, 0xa2, 0x60, 0x07,
+  0x4c, 0x64, 0x7c, 0xb4, 0xed, 0xd6, 0x87, 0xe2, 0x29, 0xc7, 0x17, 0xf6,
+  0x30, 0x8b, 0x82, 0xa5, 0xfe, 0x6f, 0x40, 0x86, 0xca, 0x21, 0x6a, 0xd1,
+  0xca, 0x47, 0xca, 0xc4, 0xd4, 0x8d, 0x66, 0xf0, 0x46, 0x43, 0x78, 0xdb,
+  0x8c, 0x0e, 0xe5, 0xcd, 0xc9, 0x4f, 0x9a, 0x8d, 0x6d, 0x49, 0x0c, 0x8c,
+  0x0f, 0x78, 0x16, 0x5c, 0xcf, 0x66, 0x75, 0x76, 0x7c, 0x7f, 0x84, 0xee,
+  0x85, 0x16, 0xdf, 0x4f, 0xfd, 0x89, 0x9b, 0xd8, 0x5e, 0x80, 0xfe, 0xef,
+  0x29, 0x98, 0xd9, 0xd7, 0x2d, 0xc8, 0x0c, 0x39, 0x27, 0x11, 0x41, 0xd3,
+  0x7e, 0x5a, 0xd2, 0xe9, 0xec, 0x59, 0xe8, 0x11, 0xe1, 0x56, 0xb5, 0xa8,
+  0xf1, 0xe6, 0xe6, 0x4b, 0x97, 0xe2, 0x1d, 0xe2, 0x62, 0x17, 0x79, 0xee,
+  0xe3, 0xaa, 0xd3, 0x27, 0x1f, 0x8e, 0x03, 0x7e, 0x8f, 0x35, 0xe4, 0xa1,
+  0x6a, 0x5b, 0x14, 0x98, 0x55, 0xcb, 0x66, 0xa0, 0xbb, 0x44, 0xc0, 0x4a,
+  0xf3, 0xff, 0x1c, 0xfa, 0xdc, 0x1d, 0xa7, 0x2f, 0x46, 0x9e, 0xad, 0x1f,
+  0x0e, 0xf5, 0x32, 0x8c, 0xad, 0xa2, 0xe8, 0xbd, 0x80, 0x0d, 0xde, 0x4a,
+  0xbd, 0x59, 0xe4, 0xb8, 0xa5, 0x89, 0xb3, 0xd6, 0x07, 0xa9, 0xfb, 0x1d,
+  0xbb, 0x01, 0xcb, 0x3e, 0xab, 0x45, 0xe6, 0x96, 0x48, 0x9a, 0xa1, 0xde,
+  0xe3, 0xe4, 0x05, 0xf5, 0xd2, 0xbf, 0x6e, 0xfa, 0xb1, 0x55, 0x01, 0xf1,
+  0x95, 0x56, 0x62, 0xe3, 0x17, 0x66, 0xab, 0x35, 0xca, 0x7a, 0x82, 0x81,
+  0x93, 0x22, 0xd5, 0xbe, 0xd3, 0x70, 0x29, 0xfb, 0x32, 0xd9, 0x7b, 0xbd,
+  0xa3, 0x99, 0xd0, 0xaa, 0x22, 0x9f, 0x7a, 0xe1, 0xd5, 0x37, 0xf8, 0x5b,
+  0x4f, 0x4f, 0xf7, 0xb1, 0xd3, 0x74, 0xff, 0xde, 0xef, 0xac, 0x58, 0xbe,
+  0x97, 0xd8, 0xa4, 0x19, 0x4e, 0x17, 0x53, 0x17, 0x8d, 0xc4, 0x93, 0x7f,
+  0x9d, 0x3a, 0xe2, 0xc4, 0x0c, 0x88, 0x35, 0x33, 0x3b, 0x42, 0x0a, 0xb9,
+  0x0f, 0xf8, 0x61, 0x97, 0x56, 0xb4, 0x37, 0x6a, 0x33, 0x46, 0x69, 0xe8,
+  0xac, 0xb7, 0x0c, 0x52, 0x49, 0x1b, 0xaf, 0x1e, 0x72, 0xe9, 0x6c, 0xd2,
+  0xae, 0x45, 0xa5, 0xf5, 0x61, 0x61, 0xfb, 0x46, 0x99, 0x7a, 0xb1, 0x10,
+  0xa1, 0x49, 0xe7, 0x7a, 0x2c, 0x84, 0xde, 0x0a, 0x1a, 0x58, 0x4a, 0x52,
+  0x6c, 0x1f, 0xd8, 0xce, 0x3c, 0x39, 0x16, 0xcf, 0x9b, 0xb9, 0x35, 0x51,
+  0x89, 0x58, 0x79, 0x1e, 0xa8, 0x94, 0x1d, 0x90, 0x29, 0x8e, 0x72, 0xe4,
+  0xe0, 0x80, 0x64, 0x80, 0x36, 0x4c, 0x5d, 0xce, 0xb8, 0x9d, 0x17, 0xb2,
+  0x83, 0xd4, 0x96, 0x31, 0xc6, 0x22, 0x09, 0xbc, 0x52, 0x04, 0xb7, 0x4c,
+  0x81, 0x04, 0xe9, 0x08, 0x6f, 0x4d, 0xa4, 0x25, 0x4d, 0x27, 0xf6, 0xb7,
+  0xf0, 0xfe, 0x49, 0xee, 0xfc, 0xdf, 0x8e, 0x6a, 0x21, 0x17, 0xf3, 0x12,
+  0xac, 0x02, 0x27, 0x38, 0xf5, 0x13, 0x7d, 0xe4, 0x8d, 0x80, 0x17, 0x9a,
+  0xbe, 0x89, 0x0f, 0x7a, 0xd5, 0x32, 0xb9, 0xfb, 0x14, 0x8c, 0xe6, 0x16,
+  0x72, 0x1f, 0xa5, 0x1c, 0x97, 0x31, 0x28, 0xd5, 0x36, 0x8b, 0x35, 0xbe,
+  0x3e, 0xc3, 0x91, 0xb0, 0x97, 0xed, 0x85, 0x78, 0xc8, 0x57, 0x24, 0x37,
+  0x5f, 0x65, 0x79, 0x02, 0x13, 0x13, 0xa3, 0x6f, 0x06, 0xf1, 0x09, 0xcc,
+  0xb3, 0x27, 0x3e, 0x6d, 0xcc, 0x8b, 0xf2, 0xed, 0xd8, 0x7a, 0xd5, 0xad,
+  0x9a, 0xad, 0x73, 0xe3, 0x9b, 0x92, 0x8f, 0xe2, 0xf5, 0xfa, 0x05, 0xee,
+  0xf0, 0x34, 0x40, 0x3b, 0xd4, 0x53, 0x24, 0x34, 0x56, 0xf3, 0x9b, 0x07,
+  0x86, 0x38, 0xa9, 0x24, 0x09, 0xd5, 0xbe, 0x43, 0xca, 0x5e, 0x4f, 0x9a,
+  0x49, 0x7e, 0x81, 0x45, 0xf8, 0x32, 0xfe, 0x72, 0xa0, 0xcb, 0x20, 0x5e,
+  0x81, 0xad, 0xaf, 0x62, 0x1a, 0x36, 0x4e, 0x74, 0x1e, 0x7b, 0x25, 0xb4,
+  0xe6, 0xaa, 0xb4, 0x37, 0x75, 0x5a, 0xf9, 0xc4, 0x33, 0x82, 0xc2, 0xb8,
+  0xbe, 0x81, 0xb3, 0xb3, 0x98, 0xff, 0x90, 0xcc, 0x6c, 0x26, 0xcc, 0xcc,
+  0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x2d, 0xcc, 0xcc,
+  0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+  0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x84, 0x3b, 0x10,
+  0xbb, 0x48, 0xa9, 0x96, 0x9b, 0xf7, 0x08, 0x40, 0x93, 0x2a, 0x09, 0x9d,
+  0xb4, 0x0d, 0x69, 0x29, 0x37, 0x98, 0xbe, 0x72, 0x0a, 0x0d, 0x71, 0xbc,
+  0x9e, 0x13, 0xf2, 0xc1, 0x41, 0xbf, 0x45, 0x11, 0x8e, 0x2d, 0x86, 0xfd,
+  0x58, 0x1f, 0x17, 0x25, 0xc1, 0x01, 0xd7, 0x37, 0x4e, 0x02, 0xad, 0xb2,
+  0xa5, 0xde, 0x11, 0xab, 0x23, 0x95, 0xc8, 0x33, 0x05, 0x3d, 0x06, 0xd8,
+  0xac, 0xdc, 0xdc, 0xeb, 0x2b, 0x4d, 0x3a, 0xd9, 0x31, 0xcf, 0xaf, 0x3d,
+  0x4b, 0x07, 0x5e, 0xee, 0x14, 0xfc, 0x27, 0x85, 0x4a, 0xf2, 0x84, 0xef,
+  0x38, 0xbd, 0x99, 0x1d, 0x8c, 0x8c, 0x8a, 0xe5, 0x9b, 0x88, 0x6b, 0x34,
+  0x01, 0x5e, 0xdc, 0xf4, 0xfb, 0xea, 0x6f, 0xc0, 0x4d, 0xf7, 0x4f, 0x21,
+  0x92, 0xff, 0x51, 0x8c, 0xe3, 0x19, 0x22, 0x5e, 0xeb, 0xf4, 0xc1, 0xee,
+  0x28, 0x8f, 0x6f, 0xc1, 0x75, 0x6e, 0x9b, 0x88, 0x2b, 0x5e, 0xce, 0x74,
+  0x59, 0xc1, 0x5b, 0x12, 0x63, 0x4d, 0xc9, 0xf0, 0x22, 0x92, 0xdd, 0x09,
+  0x5a, 0x9a, 0x4a, 0x8c, 0x98, 0x98, 0x17, 0x5f, 0x0b, 0x9c, 0x23, 0xa0,
+  0xbb, 0x0d, 0x17, 0x4d, 0x3c, 0x4e, 0x6f, 0xce, 0x43, 0x56, 0xff, 0xf7,
+  0x28, 0x65, 0xc1, 0xbf, 0x4a, 0xf8, 0x73, 0xd4, 0x79, 0xb5, 0x92, 0x0c,
+  0x41, 0x93, 0x56, 0xf0, 0x16, 0xf8, 0x50, 0xb7, 0xea, 0x08, 0x73, 0x45,
+  0x0e, 0x8c, 0x2c, 0xb0, 0x55, 0x16, 0x48, 0xc4, 0x83, 0xab, 0x89, 0xb3,
+  0xcd, 0xe5, 0xbf, 0x3e, 0x51, 0x66, 0x15, 0x15, 0x5e, 0xbb, 0xdc, 0x2d,
+  0x6f, 0x2d, 0x92, 0xa7, 0x26, 0x97, 0xbd, 0x26, 0xf6, 0x82, 0xe4, 0x6f,
+  0xc3, 0xd9, 0x32, 0x40, 0x63, 0x40, 0x40, 0x12, 0xd5, 0x7f, 0xca, 0x38,
+  0x30, 0x42, 0xa9, 0x1e, 0x96, 0xea, 0xf9, 0x0f, 0xc9, 0x18, 0xb2, 0x1c,
+  0x71, 0x46, 0x0a, 0x01, 0x80, 0x99, 0xde, 0x8d, 0xc3, 0x61, 0x8e, 0x4f,
+  0x95, 0x16, 0xae, 0x9b, 0x66, 0xe7, 0x5a, 0x16, 0xc1, 0x5c, 0x29, 0x1b,
+  0x74, 0x92, 0x84, 0xc0, 0x34, 0x41, 0xd8, 0xf8, 0x56, 0xf5, 0x94, 0x4c,
+  0xf8, 0xd4, 0x6b, 0xfa, 0x4a, 0xb9, 0xae, 0x2c, 0x12, 0x06, 0xdd, 0xee,
+  0x12, 0x88, 0x2a, 0xbe, 0x8d, 0x28, 0xef, 0x15, 0x6a, 0xfc, 0xfc, 0xf9,
+  0x40, 0x03, 0x6f, 0xe0, 0xbc, 0x2c, 0x84, 0x53, 0x55, 0xda, 0x60, 0xf0,
+  0x56, 0x04, 0x4f, 0x05, 0xda, 0xb8, 0xa2, 0xff, 0xff, 0x89, 0x0c, 0x0c,
+  0x82, 0xc5, 0x42, 0xe8, 0xdd, 0x87, 0xf2, 0x15, 0xc3, 0xc3, 0xfc, 0x28,
+  0x0a, 0x29, 0xcb, 0xa9, 0x08, 0xed, 0xf7, 0xaf, 0x09, 0xbe, 0x92, 0xf5,
+  0x16, 0x9e, 0x1d, 0x48, 0x57, 0x83, 0xc9, 0x43, 0x0f, 0xb2, 0x82, 0x2c,
+  0x56, 0x4a, 0xa1, 0x59, 0x21, 0x0d, 0x39, 0x41, 0xea, 0xfb, 0x46, 0x0d,
+  0x9a, 0x2c, 0x4e, 0x8a, 0x3a, 0xfe, 0x55, 0x00, 0xf4, 0xf7, 0xbb, 0x63,
+  0x53, 0x36, 0xd6, 0x98, 0x63, 0x19, 0x43, 0x76, 0xab, 0xf6, 0x83, 0xe4,
+  0x4b, 0x5c, 0x40, 0xb6, 0x48, 0x83, 0x5c, 0x40, 0x98, 0x53, 0x7a, 0x5c,
+  0xe1, 0x0f, 0x0f, 0xb3, 0x49, 0x74, 0x25, 0x8b, 0xee, 0xd2, 0xb6, 0xf7,
+  0x1a, 0x04, 0x6e, 0xc7, 0x25, 0x02, 0xaa, 0x33, 0x63, 0x6b, 0x31, 0x98,
+  0xb6, 0xd6, 0x92, 0x71, 0x3e, 0xb1, 0x5c, 0xc3, 0xd0, 0xfe, 0x42, 0x9e,
+  0x22, 0x6d, 0xa1, 0x00, 0xd5, 0x9c, 0x36, 0x8e, 0x02, 0xbe, 0xde, 0xcb,
+  0xcc, 0x80, 0xde, 0x4b, 0xb0, 0x0f, 0x92, 0xff, 0xa5, 0x47, 0x0e, 0x28,
+  0x3f, 0x7d, 0x87, 0x80, 0x33, 0xbf, 0xea, 0x17, 0xad, 0xbb, 0x8e, 0x73,
+  0x37, 0x54, 0x63, 0x27, 0x6c, 0x8d, 0x02, 0x17, 0x65, 0xdb, 0x6e, 0x3d,
+  0x4f, 0x14, 0x35, 0x22, 0x84, 0x65, 0x17, 0x26, 0x38, 0x67, 0xd8, 0x59,
+  0x95, 0x00, 0xee, 0xf5, 0x8d, 0xf2, 0x15, 0x08, 0x03, 0x66, 0xaa, 0x27,
+  0x7c, 0x33, 0x99, 0x15, 0xfc, 0x1b, 0x62, 0x79, 0x9f, 0x6a, 0x0c, 0x8a,
+  0xfb, 0xcd, 0xce, 0xc6, 0x16, 0xc5, 0xd0, 0x01, 0xe8, 0x9d, 0x2f, 0x73,
+  0x01, 0x71, 0xd8, 0xe9, 0x26, 0x77, 0x78, 0xaa, 0x1f, 0x4d, 0x68, 0x3d,
+  0xea, 0x1f, 0x70, 0xba, 0x22, 0xb9, 0x9d, 0x39, 0x0b, 0x2e, 0x13, 0x73,
+  0xaa, 0x5e, 0xba, 0x4e, 0x1e, 0xf3, 0xca, 0x0d, 0x51, 0xce, 0xe1, 0x85,
+  0x97, 0x03, 0x00, 0x14, 0x28, 0xb9, 0x72, 0xfb, 0x0e, 0xb9, 0x40, 0x35,
+  0x01, 0x9a, 0xe2, 0x75, 0x48, 0x28, 0xd3, 0xc1, 0x56, 0x32, 0x78, 0xe7,
+  0x9a, 0xf9, 0xb1, 0xc0, 0xd6, 0x98, 0x42, 0x46, 0x8f, 0x5d, 0x01, 0x83,
+  0x46, 0xa5, 0xd4, 0x7c, 0xef, 0xa5, 0xe2, 0x1a, 0x14, 0x79, 0x9f, 0xe3,
+  0x5a, 0xe7, 0x84, 0xb5, 0x34, 0xbd, 0xab, 0xaf, 0x1a, 0x56, 0x7a, 0xb4,
+  0x66, 0xb3, 0x65, 0xe9, 0x10, 0x4e, 0x92, 0xac, 0x11, 0xac, 0x97, 0x81,
+  0x20, 0xf0, 0x31, 0x6c, 0xdb, 0x13, 0xaf, 0x26, 0xb9, 0x23, 0x43, 0x65,
+  0x79, 0xf7, 0xc8, 0x8e, 0x1b, 0x3e, 0x76, 0xc1, 0x5f, 0xea, 0xc4, 0xe3,
+  0x15, 0x6d, 0xa2, 0xeb, 0x07, 0xec, 0x01, 0xbf, 0xa9, 0x2e, 0x34, 0x3d,
+  0xea, 0x0f, 0x57, 0x4e, 0xa9, 0x2c, 0xb3, 0x35, 0xf3, 0x66, 0x13, 0xa6,
+  0x3c, 0xb5, 0xc0, 0x65, 0x18, 0x33, 0xd0, 0xe2, 0x02, 0xb9, 0x4a, 0x14,
+  0x3c, 0x7e, 0x72, 0xb5, 0xf7, 0xa1, 0x0f, 0xf1, 0xb6, 0xbd, 0x26, 0xce,
+  0x9e, 0x96, 0x04, 0x02, 0x8e, 0x4c, 0xdf, 0x32, 0xc7, 0x4e, 0x72, 0x81,
+  0xcb, 0x34, 0xf8, 0x71, 0x26, 0x69, 0x69, 0x3f, 0x93, 0x0b, 0x3d, 0x82,
+  0xbb, 0x07, 0x0a, 0x25, 0x9a, 0x21, 0x2a, 0x33, 0xdf, 0x3c, 0x8e, 0x4c,
+  0x99, 0xd9, 0x21, 0x39, 0xfb, 0xe6, 0x76, 0x53, 0x7f, 0x5e, 0x28, 0x10,
+  0x10, 0x10, 0x71, 0xb4, 0xb4, 0x54, 0xc1, 0xc8, 0x68, 0x6c, 0x68, 0x94,
+  0x4c, 0x9b, 0x2a, 0x5b, 0xc2, 0x8b, 0x78, 0x88, 0x1a, 0x54, 0x22, 0xf9,
+  0x5b, 0x5d, 0x1c, 0x73, 0x48, 0xf4, 0xad, 0xab, 0x81, 0xcb, 0x63, 0xd6,
+  0x03, 0xe2, 0x64, 0x1a, 0xa8, 0x4d, 0x3c, 0xa9, 0x24, 0x01, 0xa1, 0x0e,
+  0x53, 0x64, 0xf7, 0xc1, 0x6f, 0xfe, 0x7a, 0x7e, 0x63, 0x55, 0xe0, 0x78,
+  0xf9, 0x07, 0x1d, 0x7a, 0xf3, 0xb2, 0x8f, 0xfd, 0x89, 0xcf, 0x19, 0xd4,
+  0x35, 0xe7, 0x0e, 0xc9, 0xcd, 0x95, 0xbb, 0x94, 0x4f, 0xd5, 0xfb, 0x05,
+  0xc6, 0x57, 0x31, 0xe9, 0x82, 0xa4, 0xb4, 0x8b, 0xfc, 0x96, 0x36, 0x95,
+  0xc0, 0x96, 0x65, 0x70, 0xcd, 0x1e, 0xd3, 0x15, 0x0e, 0xd6, 0x3c, 0xc0,
+  0xb1, 0x55, 0x27, 0xa8, 0x21, 0xb4, 0xb6, 0xa2, 0x91, 0x82, 0xdb, 0x31,
+  0xcf, 0xb9, 0x5c, 0x09, 0x6c, 0xbb, 0x50, 0x5e, 0x4e, 0xd8, 0xae, 0x20,
+  0x19, 0xa2, 0x59, 0x85, 0x84, 0x8b, 0x0f, 0x0f, 0x51, 0x21, 0x88, 0x67,
+  0x85, 0x8c, 0xd2, 0x57, 0x70, 0x5b, 0xc7, 0x2f, 0xc1, 0x0d, 0xe4, 0xb4,
+  0xa0, 0x5a, 0xbf, 0x41, 0x10, 0x18, 0xce, 0xa2, 0x02, 0xbd, 0xd8, 0xdc,
+  0x65, 0x49, 0x3c, 0xb6, 0x9e, 0x7e, 0x8b, 0xfd, 0x5e, 0x6a, 0x18, 0xa9,
+  0xe5, 0x09, 0x9b, 0xe4, 0x0d, 0xf6, 0xb2, 0x39, 0xf7, 0x72, 0x21, 0xad,
+  0x2f, 0x15, 0x18, 0x5c, 0xc8, 0xaf, 0x42, 0x7e, 0x96, 0x25, 0xdb, 0x76,
+  0xd8, 0x93, 0x86, 0xbd, 0x4e, 0x18, 0xf5, 0x98, 0xf5, 0x00, 0x6b, 0x7c,
+  0x72, 0x1f, 0xae, 0xe5, 0xfc, 0xc9, 0x35, 0x45, 0xc6, 0x9f, 0x18, 0x07,
+  0xf6, 0x16, 0x82, 0xe9, 0x96, 0x5c, 0xc9, 0xa1, 0xac, 0x04, 0xaa, 0xb3,
+  0x7f, 0xca, 0x21, 0xa8, 0xc4, 0x9a, 0x74, 0x70, 0x48, 0x90, 0xec, 0x88,
+  0x9a, 0x4d, 0x28, 0xbd, 0x3e, 0xf1, 0x23, 0x13, 0x93, 0xd0, 0xc6, 0xbc,
+  0xde, 0x80, 0x07, 0xf2, 0x8b, 0x2a, 0xf7, 0x9f, 0x80, 0xc5, 0x87, 0x52,
+  0x3d, 0x50, 0x0a, 0x37, 0xc8, 0xcb, 0xa8, 0xdb, 0x1e, 0x3f, 0x8c, 0x90,
+  0xac, 0x2a, 0x49, 0xeb, 0x6e, 0xc4, 0x9a, 0xae, 0xf6, 0xae, 0x01, 0xc2,
+  0x19, 0x71, 0x21, 0x3f, 0xcc, 0x7f, 0xa9, 0x94, 0x91, 0x22, 0x18, 0x18,
+  0x18, 0xa1, 0x18, 0xb4, 0xef, 0x7d, 0xd4, 0x6f, 0x93, 0x4b, 0xa5, 0x51,
+  0x2d, 0x7f, 0x3d, 0xfe, 0xd7, 0x90, 0x0e, 0xd0, 0x04, 0x5c, 0x48, 0x48,
+  0xf3, 0xde, 0x11, 0xf5, 0xd1, 0xc4, 0xea, 0xad, 0xa3, 0xc9, 0xc1, 0x59,
+  0x77, 0x51, 0x98, 0x84, 0xcc, 0x64, 0xe2, 0x0e, 0x75, 0xb9, 0xb9, 0x6b,
+  0x09, 0xb2, 0xec, 0xee, 0x21, 0x3b, 0x98, 0x2e, 0xe3, 0x88, 0x0f, 0x08,
+  0xbf, 0x4a, 0x2e, 0x2d, 0xe7, 0x80, 0x85, 0xc4, 0xb9, 0x8b, 0x18, 0x31,
+  0x83, 0x17, 0x33, 0x10, 0x7d, 0x74, 0x07, 0x0f, 0xa1, 0x78, 0xfd, 0x89,
+  0x7c, 0xae, 0x71, 0x98, 0xc6, 0xc8, 0xf0, 0x8a, 0x7c, 0x67, 0xd3, 0xcb,
+  0x54, 0x17, 0x7a, 0x6a, 0x66, 0xda, 0x72, 0xb5, 0x1b, 0x5e, 0xb2, 0x41,
+  0x44, 0x4d, 0x0e, 0x28, 0x53, 0x8e, 0xf3, 0xec, 0x87, 0x72, 0xde, 0xd0,
+  0x9e, 0xee, 0x7d, 0x76, 0xb7, 0xb8, 0xbe, 0x11, 0x02, 0x03, 0xc4, 0x43,
+  0x51, 0xc8, 0x8c, 0xb3, 0x83, 0xe1, 0x56, 0x71, 0x70, 0xf4, 0xe7, 0x01,
+  0x22, 0xed, 0xc6, 0xf6, 0x95, 0xf8, 0xb3, 0x01, 0x0e, 0x5e, 0xef, 0xb7,
+  0xec, 0x8c, 0xa7, 0x1d, 0xd9, 0xb9, 0x60, 0xb5, 0x58, 0xe0, 0xf2, 0x9d,
+  0xec, 0x6e, 0x65, 0xdb, 0x50, 0xe9, 0x80, 0x2e, 0xa2, 0xf9, 0x56, 0x7c,
+  0xce, 0x76, 0xc4, 0x95, 0x41, 0xfa, 0x0c, 0x06, 0x4e, 0xb2, 0x57, 0x29,
+  0x2f, 0xeb, 0xf9, 0x38, 0xdf, 0x49, 0x70, 0x46, 0x83, 0x95, 0x31, 0x5b,
+  0xe0, 0xe1, 0x0a, 0xcc, 0x5e, 0xee, 0xb0, 0x45, 0x41, 0xb9, 0xb1, 0x1b,
+  0x87, 0x96, 0x3d, 0x3b, 0x23, 0x3c, 0x19, 0x16, 0xcb, 0x31, 0xad, 0x1c,
+  0xb1, 0x21, 0x44, 0x4d, 0xed, 0x01, 0x12, 0x3b, 0xa0, 0xd8, 0x19, 0x5a,
+  0xc0, 0xdb, 0x2c, 0xb5, 0x2b, 0x39, 0x94, 0x62, 0xfb, 0x74, 0x95, 0x74,
+  0x48, 0x72, 0x0a, 0x0f, 0x4c, 0xe7, 0x69, 0x66, 0xef, 0x51, 0xb3, 0x7b,
+  0x3f, 0xc0, 0x67, 0x57, 0x19, 0xe1, 0xbc, 0xe6, 0x02, 0x08, 0xa2, 0x9b,
+  0xf4, 0x1e, 0x96, 0x7a, 0xe3, 0x96, 0xb9, 0x3c, 0x42, 0x70, 0x47, 0x71,
+  0xcb, 0x60, 0xaa, 0x78, 0x10, 0x3d, 0x27, 0xc7, 0xc1, 0xcf, 0xd2, 0x56,
+  0x5d, 0x3c, 0x80, 0xa0, 0xff, 0xf8, 0x62, 0xe1, 0xfc, 0x39, 0xf2, 0x2e,
+  0xe9, 0xee, 0xd9, 0x7a, 0xf9, 0x1b, 0xfd, 0xa2, 0x01, 0x4d, 0x13, 0xd4,
+  0x04, 0x94, 0x7c, 0x82, 0xc9, 0x81, 0xbd, 0x50, 0x32, 0xd2, 0xf3, 0x27,
+  0x40, 0xe2, 0x10, 0xd1, 0x16, 0x98, 0x83, 0x77, 0x13, 0x5e, 0x01, 0xd4,
+  0x28, 0xc6, 0x66, 0xb1, 0x8f, 0xb5, 0x9e, 0xc2, 0x2b, 0x7d, 0xce, 0xb1,
+  0xb1, 0x9f, 0xd7, 0x3b, 0x18, 0xde, 0x8b, 0x6d, 0xa7, 0x3b, 0xea, 0x44,
+  0xaf, 0xe2, 0xab, 0x1d, 0x4f, 0xdd, 0xcb, 0x77, 0xd5, 0x03, 0x45, 0x48,
+  0x1d, 0xdc, 0xd6, 0x5d, 0x53, 0x3e, 0xe9, 0xf0, 0x30, 0x11, 0xe7, 0x39,
+  0x16, 0x19, 0xc2, 0x01, 0x40, 0x72, 0x69, 0x27, 0x2a, 0x97, 0x0f, 0x77,
+  0xd1, 0x2f, 0xdf, 0x9c, 0xf4, 0x77, 0x0e, 0x42, 0x20, 0x8a, 0x76, 0x80,
+  0xb5, 0x6d, 0x47, 0xa3, 0xe2, 0xaa, 0x50, 0x96, 0xb1, 0xf4, 0x41, 0xeb,
+  0x73, 0x78, 0x34, 0x2d, 0xcd, 0xbd, 0xb7, 0x7d, 0x99, 0x4f, 0xab, 0x51,
+  0x6f, 0x51, 0xf6, 0x56, 0x2a, 0xea, 0xd8, 0xec, 0xfb, 0xe8, 0x9b, 0x0f,
+  0x24, 0xd9, 0xc5, 0x11, 0x19, 0x95, 0xe1, 0xec, 0xf6, 0x1d, 0xeb, 0x32,
+  0xbb, 0xd1, 0x3a, 0xfe, 0x4c, 0x3d, 0xab, 0xd4, 0xd3, 0xbb, 0xae, 0x94,
+  0x65, 0xc7, 0x09, 0x7a, 0xd6, 0xbe, 0xf2, 0x4b, 0xe4, 0x9f, 0x44, 0x21,
+  0xf1, 0x0d, 0x2d, 0x75, 0x39, 0x7a, 0x7a, 0x7e, 0x3c, 0x0d, 0x0d, 0x2b,
+  0xe7, 0x84, 0xf4, 0xee, 0xb0, 0xb5, 0x35, 0x3d, 0x15, 0x92, 0x0d, 0x99,
+  0xbd, 0xcc, 0x0c, 0x69, 0x2c, 0x72, 0x31, 0xee, 0xde, 0xb5, 0x32, 0x76,
+  0xdd, 0xf9, 0xe8, 0x58, 0xbe, 0x36, 0x9b, 0x67, 0xfe, 0x09, 0xc8, 0x9c,
+  0xc2, 0x6d, 0x33, 0x21, 0xd0, 0x04, 0xb2, 0x45, 0x0e, 0xb4, 0x54, 0x40,
+  0xa8, 0xc2, 0xd3, 0xf1, 0x6b, 0x9f, 0x8b, 0xcc, 0x37, 0x4a, 0x94, 0xfe,
+  0x35, 0xa2, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34,
+  0x34, 0x4c, 0x34, 0x34, 0x34, 0x34, 0xd1, 0x34, 0xb5, 0x1a, 0x5f, 0xe0,
+  0x4a, 0x83, 0xfd, 0xbe, 0xcf, 0x73, 0xae, 0x08, 0x08, 0x8d, 0xf1, 0x45,
+  0x7b, 0x9b, 0xd4, 0x41, 0x91, 0xd7, 0xa9, 0x56, 0x9b, 0x7d, 0x15, 0xbe,
+  0x19, 0xb4, 0xf8, 0xfb, 0x3c, 0x16, 0xf6, 0x9a, 0xab, 0x8f, 0x0a, 0x0a,
+  0x5b, 0x7e, 0xaf, 0xdd, 0x27, 0x1d, 0x03, 0x32, 0xa9, 0xfd, 0xb3, 0xa7,
+  0xd0, 0x79, 0xcb, 0x98, 0x0e, 0x64, 0xd8, 0x29, 0xcf, 0xa3, 0x2f, 0xc0,
+  0xe5, 0xad, 0xcb, 0xf0, 0x84, 0xc2, 0xab, 0x6c, 0x3d, 0x1d, 0xfd, 0xaf,
+  0xa3, 0x6d, 0x2a, 0xe6, 0x64, 0xa4, 0xce, 0xb4, 0x6b, 0xf5, 0x1b, 0x00,
+  0x00, 0xd7, 0x52, 0xce, 0x49, 0xd5, 0x36, 0x72, 0xe8, 0x6b, 0xa3, 0x4f,
+  0xff, 0x08, 0x05, 0x1b, 0xad, 0x9a, 0xf4, 0x5e, 0xb6, 0xc0, 0x2c, 0x9b,
+  0xc4, 0xb5, 0x2a, 0x1e, 0x47, 0xb6, 0xd4, 0xc2, 0xfd, 0x0f, 0x61, 0xad,
+  0xb4, 0xe6, 0x98, 0x58, 0x96, 0x96, 0x7d, 0xda, 0xaf, 0xc9, 0xbb, 0xed,
+  0xf4, 0x50, 0x11, 0xb2, 0x45, 0xba, 0xbc, 0x4d, 0x84, 0x16, 0x48, 0xba,
+  0xd1, 0x6f, 0x1a, 0x0f, 0x9c, 0xcc, 0xcc, 0x94, 0xa8, 0xd4, 0x54, 0x07,
+  0x84, 0x9b, 0x02, 0x7c, 0xbc, 0xd6, 0x7e, 0x7e, 0x7e, 0x75, 0xd6, 0xef,
+  0xe1, 0xc4, 0x43, 0xe9, 0x91, 0xe7, 0x67, 0x5d, 0x8d, 0xd4, 0xc3, 0xb5,
+  0xd6, 0x35, 0x9e, 0x41, 0x0b, 0x4d, 0x7d, 0x76, 0x4a, 0xac, 0xa6, 0x02,
+  0xcf, 0x79, 0x3f, 0x94, 0x3e, 0x5e, 0xf1, 0xf4, 0x63, 0x51, 0x21, 0x8f,
+  0xcf, 0x5d, 0xb3, 0xb0, 0x1a, 0x46, 0xad, 0xe9, 0x63, 0x0b, 0x61, 0x40,
+  0x60, 0x0f, 0xff, 0x02, 0x3f, 0xec, 0xe8, 0x03, 0xa4, 0x25, 0xf3, 0xa0,
+  0x03, 0xf0, 0x18, 0x59, 0x8c, 0xb3, 0xb6, 0x17, 0x62, 0x89, 0x09, 0xb2,
+  0x02, 0x81, 0xcb, 0x79, 0x38, 0x38, 0x1f, 0x32, 0xbd, 0xd2, 0x81, 0x92,
+  0xac, 0x23, 0x4a, 0x18, 0xf7, 0xb2, 0x11, 0xd1, 0x78, 0x8c, 0x31, 0xa0,
+  0xff, 0x60, 0xe6, 0x32, 0x80, 0x59, 0x93, 0xf4, 0x49, 0x61, 0x4e, 0xfb,
+  0x92, 0xa5, 0x80, 0xc7, 0x17, 0xdd, 0x68, 0x3e, 0xe3, 0x16, 0xb7, 0xb6,
+  0xe2, 0x7f, 0x1a, 0xa9, 0x4f, 0x22, 0x25, 0x70, 0xe2, 0x80, 0x5d, 0x77,
+  0x8a, 0x97, 0xa7, 0x35, 0xc4, 0x62, 0x79, 0x0e, 0x55, 0x9b, 0x7c, 0xdd,
+  0xa5, 0xfc, 0x39, 0xba, 0x3f, 0x78, 0x60, 0x52, 0x76, 0x14, 0xd6, 0x0f,
+  0xb5, 0xe9, 0xdc, 0x12, 0xb8, 0xa3, 0x0e, 0x5a, 0x4e, 0x4d, 0xb3, 0xec,
+  0x9c, 0x50, 0xa1, 0xae, 0x33, 0x9b, 0x2a, 0xdc, 0xd2, 0x23, 0x32, 0x6f,
+  0x61, 0x69, 0xa6, 0x86, 0x67, 0xfe, 0x77, 0xc0, 0xf0, 0xd1, 0x46, 0xda,
+  0xc9, 0x1f, 0x32, 0x6a, 0xc0, 0x8f, 0x4e, 0xd9, 0x44, 0x18, 0x89, 0x9b,
+  0x28, 0xb4, 0x0d, 0x65, 0xf9, 0x94, 0x3e, 0x53, 0x4c, 0x11, 0x68, 0x03,
+  0x36, 0x1f, 0x73, 0x98, 0xeb, 0xfe, 0x1e, 0xba, 0x9a, 0x5b, 0xf9, 0x9c,
+  0xaa, 0xed, 0xe8, 0x0f, 0x70, 0x0d, 0x5c, 0xd3, 0x42, 0x4e, 0xec, 0xe5,
+  0xaf, 0x03, 0xef, 0x1d, 0x40, 0x58, 0x48, 0xa2, 0x95, 0x1d, 0x75, 0x76,
+  0xac, 0x79, 0x89, 0xce, 0xcd, 0x34, 0x53, 0x34, 0x17, 0x95, 0x21, 0xea,
+  0x7f, 0x6f, 0x95, 0xca, 0x56, 0xe3, 0x5d, 0xac, 0xcd, 0xa9, 0x61, 0xc5,
+  0x40, 0xd8, 0xe6, 0x97, 0xf6, 0x5b, 0xbb, 0x5f, 0xd9, 0x7a, 0xd4, 0x7d,
+  0xab, 0x9e, 0xc3, 0x6b, 0xf2, 0x2e, 0xf3, 0x2e, 0x9e, 0x06, 0xec, 0x6f,
+  0xa8, 0x5f, 0xcb, 0x7a, 0xb3, 0x62, 0x94, 0x3c, 0xf6, 0x92, 0xfb, 0x06,
+  0x74, 0x22, 0x16, 0xe4, 0x75, 0x9b, 0x20, 0x9d, 0x66, 0x2a, 0x54, 0x1d,
+  0x0a, 0x8d, 0xf4, 0xec, 0x9a, 0x67, 0x87, 0x89, 0xf4, 0xc4, 0x71, 0xf1,
+  0x04, 0x7f, 0x34, 0x63, 0x72, 0x22, 0xc7, 0x89, 0x09, 0xa2, 0xbe, 0x2b,
+  0x5a, 0x56, 0xeb, 0x50, 0x1d, 0xef, 0x12, 0xbf, 0xe8, 0xc3, 0x47, 0xb6,
+  0xa0, 0x6e, 0x8d, 0x22, 0x41, 0x5e, 0x43, 0x3b, 0x03, 0x48, 0xd6, 0xce,
+  0x29, 0xa0, 0x91, 0xdf, 0x2b, 0x53, 0x7e, 0x1f, 0x6d, 0xa3, 0xa8, 0x82,
+  0x26, 0x5a, 0x42, 0xcb, 0x13, 0x8b, 0x9c, 0xd7, 0x55, 0xfe, 0xb4, 0xa7,
+  0x36, 0xf5, 0xc8, 0x16, 0x7a, 0xf5, 0x66, 0xde, 0x7f, 0x03, 0xa2, 0xa5,
+  0x2b, 0x3e, 0xd5, 0x55, 0xc4, 0x93, 0xb2, 0xf9, 0x51, 0x37, 0x1d, 0x1a,
+  0x38, 0x64, 0x90, 0x68, 0x45, 0x8e, 0x8c, 0xb0, 0xf2, 0x06, 0xf0, 0xe7,
+  0x64, 0xe8, 0x34, 0xc7, 0x5f, 0x05, 0x35, 0x41, 0x10, 0x76, 0xa1, 0x78,
+  0xef, 0x93, 0x9a, 0xdd, 0x0c, 0x28, 0x52, 0xde, 0x8f, 0xce, 0xe2, 0xc4,
+  0x6d, 0x39, 0x36, 0x53, 0x21, 0x61, 0x51, 0x64, 0x3c, 0xf1, 0x96, 0x3e,
+  0x68, 0x15, 0xb3, 0xbb, 0xed, 0x18, 0x45, 0x5c, 0x51, 0xe1, 0xa6, 0x1a,
+  0x81, 0xc9, 0x59, 0x80, 0x59, 0x19, 0x09, 0x84, 0xb0, 0x12, 0x37, 0xad,
+  0x60, 0x8c, 0x8c, 0x74, 0x89, 0x9b, 0x33, 0x2f, 0xaa, 0x7e, 0xa7, 0xc9,
+  0x48, 0xda, 0xab, 0x99, 0xf1, 0x0b, 0xd3, 0x0a, 0xd7, 0x45, 0x0a, 0xa8,
+  0xfc, 0xb4, 0x5a, 0x70, 0x8f, 0x9a, 0x66, 0x5a, 0xdf, 0x34, 0xf6, 0x76,
+  0x9a, 0x5c, 0x78, 0xcc, 0x6a, 0x7f, 0x73, 0x41, 0xe5, 0x0e, 0xce, 0xe7,
+  0x7b, 0x19, 0xfe, 0xaa, 0x3a, 0x85, 0xc3, 0x2d, 0xd8, 0xd9, 0x05, 0x21,
+  0xdd, 0x5f, 0xbd, 0x79, 0x0f, 0x95, 0xde, 0x77, 0x5e, 0x78, 0x47, 0xa9,
+  0xce, 0xd1, 0xeb, 0x9e, 0x1c, 0xe1, 0xcb, 0xb3, 0xef, 0xe2, 0x0b, 0x42,
+  0xb5, 0xf4, 0xc0, 0x10, 0x38, 0x38, 0x94, 0x0e, 0x91, 0x3b, 0x95, 0xa8,
+  0xaf, 0x25, 0x78, 0x29, 0x89, 0x87, 0x5f, 0x01, 0xff, 0x3b, 0x45, 0x1c,
+  0xcf, 0x4f, 0x08, 0xa5, 0xd0, 0x5a, 0x6a, 0x7f, 0x6a, 0x89, 0x39, 0x54,
+  0xc7, 0x69, 0x2f, 0x8c, 0xfe, 0x1f, 0xca, 0xe6, 0x6b, 0xf7, 0xbb, 0x52,
+  0x3f, 0x29, 0x44, 0xbd, 0x17, 0x9e, 0xaa, 0x10, 0x31, 0xfa, 0x4a, 0xc4,
+  0x36, 0x18, 0x78, 0x36, 0x2d, 0xf8, 0xad, 0xa3, 0x0a, 0xd0, 0x57, 0xa8,
+  0xbd, 0x93, 0xf0, 0x87, 0x3d, 0xd7, 0x95, 0x54, 0xae, 0x4e, 0x44, 0x20,
+  0x80, 0x30, 0xac, 0x26, 0x74, 0x18, 0xd0, 0xba, 0xf3, 0x73, 0x10, 0xb0,
+  0xb2, 0xd2, 0x38, 0x63, 0x4b, 0x5b, 0x1d, 0x83, 0x1f, 0x01, 0x69, 0xd5,
+  0x92, 0xa0, 0x90, 0x65, 0x47, 0x32, 0x1e, 0x22, 0xd5, 0xe5, 0x20, 0x28,
+  0xcd, 0x73, 0x51, 0xf3, 0x58, 0x70, 0xe6, 0x3f, 0xe4, 0x05, 0xb4, 0x86,
+  0x52, 0xf0, 0xd2, 0x62, 0xda, 0x03, 0x91, 0x5d, 0xfb, 0x44, 0x40, 0x03,
+  0xd1, 0x64, 0x04, 0x0c, 0xaa, 0xe2, 0x6f, 0xb4, 0x99, 0x8b, 0xff, 0xa3,
+  0x25, 0xf7, 0xaa, 0xf8, 0xaf, 0x58, 0x69, 0x61, 0x62, 0xb4, 0x66, 0xd0,
+  0x07, 0xf3, 0xfd, 0xa7, 0xc7, 0x8b, 0x60, 0x81, 0xd2, 0x9e, 0x72, 0x81,
+  0x36, 0x72, 0xff, 0xd2, 0x10, 0x39, 0x70, 0x57, 0x0f, 0x84, 0x34, 0x62,
+  0xd6, 0xb2, 0xb0, 0x01, 0xd4, 0xaf, 0xbf, 0xb0, 0xb0, 0xd7, 0x6a, 0x24,
+  0xf3, 0x4b, 0x1a, 0x01, 0x28, 0x5c, 0xd1, 0x2a, 0xbf, 0x2d, 0x3d, 0xf4,
+  0xcb, 0x41, 0xb4, 0x2a, 0xbb, 0xae, 0x7e, 0x82, 0x62, 0x03, 0x3e, 0xec,
+  0x93, 0x1d, 0xae, 0xf6, 0xc3, 0x82, 0xc9, 0xe5, 0x59, 0xe2, 0x7d, 0xac,
+  0xc0, 0x66, 0x54, 0xfa, 0x64, 0x4f, 0x26, 0x84, 0xf3, 0x46, 0xd9, 0x7a,
+  0x04, 0xe9, 0x37, 0x25, 0xe5, 0xb9, 0xae, 0x13, 0x8e, 0xfa, 0x9a, 0xfd,
+  0xe4, 0x86, 0x24, 0x2f, 0x4a, 0x0c, 0x3b, 0xe0, 0x49, 0x9d, 0x78, 0x3a,
+  0xbd, 0xd9, 0x37, 0xc9, 0x2f, 0xe8, 0x38, 0x72, 0xaa, 0x80, 0x38, 0xfc,
+  0x82, 0xd4, 0xee, 0x8a, 0x4e, 0x63, 0xaf, 0x8e, 0x7b, 0x7b, 0x7b, 0x7b,
+  0x7b, 0x1f, 0x15, 0x01, 0x41, 0x0c, 0x28, 0xf2, 0xf2, 0x08, 0xa5, 0xb3,
+  0xe2, 0x9f, 0x46, 0x7b, 0x28, 0x22, 0x4c, 0xb7, 0xf4, 0xee, 0xaf, 0x44,
+  0xbb, 0xed, 0xe6, 0x63, 0x17, 0x84, 0xa7, 0x57, 0xb6, 0x57, 0x42, 0x25,
+  0x0a, 0x21, 0xb0, 0x47, 0xf4, 0xf1, 0xf1, 0x91, 0x74, 0xef, 0x76, 0x2f,
+  0x00, 0x00, 0x5c, 0x65, 0x06, 0xcd, 0x1f, 0xc8, 0xbd, 0xa0, 0x33, 0x1d,
+  0x33, 0x04, 0x3f, 0xc8, 0xe1, 0xb0, 0xc2, 0x97, 0x1d, 0x95, 0xfc, 0x4c,
+  0xee, 0xc7, 0x34, 0xcd, 0x3a, 0x02, 0x8f, 0xf9, 0xe8, 0x97, 0xb4, 0xe6,
+  0x4c, 0xa9, 0x5b, 0x85, 0xc5, 0xa6, 0xc8, 0xce, 0x13, 0x51, 0x31, 0x70,
+  0x54, 0xe0, 0x69, 0x69, 0x12, 0x5d, 0xeb, 0xf3, 0x70, 0x0a, 0xa1, 0x0e,
+  0xe2, 0x0a, 0x98, 0x17, 0x61, 0xfe, 0xb5, 0x1c, 0x9b, 0x61, 0x69, 0x5f,
+  0x8a, 0x0d, 0x8f, 0x5b, 0x3e, 0x96, 0x96, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9,
+  0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0x74, 0x3f, 0xe4, 0x39, 0xa0, 0xdc,
+  0x81, 0xda, 0xe7, 0xc7, 0x38, 0xdc, 0x04, 0x31, 0xab, 0x4a, 0xc7, 0x57,
+  0x3b, 0xc0, 0xc5, 0xed, 0x70, 0xa3, 0xc6, 0xd0, 0xcc, 0x77, 0x6b, 0xe3,
+  0x3d, 0x46, 0x9a, 0x54, 0x6b, 0x2f, 0x83, 0x36, 0xf8, 0x09, 0x30, 0xf9,
+  0x6d, 0x17, 0xc1, 0x81, 0xb8, 0xc0, 0x4a, 0x21, 0x13, 0xd1, 0xca, 0x12,
+  0xad, 0xbe, 0x26, 0x99, 0xe5, 0x5b, 0xaa, 0xce, 0x3a, 0x7f, 0x92, 0x81,
+  0xaf, 0xc2, 0x38, 0xed, 0x0f, 0xb9, 0x26, 0x16, 0x29, 0xfe, 0x23, 0x94,
+  0x4b, 0x62, 0x55, 0xae, 0x40, 0x4e, 0x8d, 0x6a, 0xf7, 0x72, 0x39, 0x0c,
+  0x65, 0x60, 0x56, 0xc8, 0x60, 0x80, 0x96, 0xcd, 0xc0, 0x34, 0x16, 0xab,
+  0x25, 0xd4, 0xd7, 0xe9, 0x03, 0xc9, 0x7b, 0xcc, 0x45, 0x61, 0x56, 0x4d,
+  0x9c, 0x8c, 0x01, 0xc7, 0xb3, 0x0c, 0x0e, 0x7f, 0x1f, 0x20, 0xf2, 0x5f,
+  0x53, 0x5b, 0xb2, 0xbd, 0xcf, 0x9a, 0x72, 0xc6, 0x28, 0x4e, 0x40, 0x63,
+  0x14, 0xba, 0x9a, 0xe5, 0x60, 0xcf, 0x67, 0xa9, 0x27, 0x50, 0x69, 0x3c,
+  0x46, 0x1a, 0x46, 0xd8, 0xa8, 0x0c, 0x36, 0x19, 0x54, 0xd7, 0x1c, 0xd2,
+  0x8f, 0x6a, 0x8d, 0x62, 0xfc, 0xc4, 0x35, 0x17, 0x07, 0x72, 0xf2, 0x76,
+  0xed, 0xcf, 0xf3, 0xfe, 0xee, 0x6e, 0xa3, 0xc5, 0x5e, 0x0e, 0x78, 0xff,
+  0x44, 0x96, 0x1e, 0x44, 0x95, 0xcb, 0x3f, 0x4d, 0xd7, 0x25, 0x45, 0xa4,
+  0x34, 0x4d, 0x85, 0x19, 0x49, 0x2d, 0xb5, 0x41, 0x57, 0x69, 0x08, 0x2d,
+  0x58, 0xcd, 0x99, 0xc4, 0x2d, 0xc2, 0xb8, 0x77, 0xbb, 0x9e, 0x8d, 0x52,
+  0x52, 0x52, 0xfd, 0x99, 0x33, 0x64, 0xe3, 0x33, 0xd7, 0x80, 0xad, 0x6a,
+  0xe0, 0x41, 0x6c, 0x70, 0xc2, 0x09, 0x7a, 0xf8, 0x55, 0xdd, 0x52, 0xf3,
+  0x40, 0xae, 0x4e, 0xc9, 0x05, 0x31, 0x32, 0xf2, 0x05, 0xf2, 0x45, 0x8d,
+  0x9b, 0xc5, 0x2b, 0x6c, 0xbe, 0xb7, 0xfb, 0x37, 0x34, 0x0e, 0x2c, 0x91,
+  0x63, 0x37, 0x92, 0x1a, 0x2f, 0x05, 0x5f, 0xb8, 0x1f, 0x7f, 0xeb, 0x92,
+  0x2f, 0xf8, 0xd1, 0xbf, 0x01, 0x14, 0x5c, 0xfe, 0xc3, 0x30, 0xd5, 0xbf,
+  0x79, 0x6e, 0x85, 0xb3, 0xdf, 0x31, 0x56, 0x3e, 0x01, 0xa3, 0x4b, 0xf2,
+  0x20, 0x28, 0xfc, 0x94, 0xf6, 0xf3, 0x8d, 0xbb, 0xfa, 0x18, 0x29, 0x1a,
+  0x47, 0xd3, 0x29, 0x70, 0xe4, 0x24, 0x50, 0xf8, 0x40, 0xc5, 0x31, 0xdb,
+  0x82, 0x55, 0xa4, 0xa1, 0x43, 0xd3, 0x6b, 0xba, 0x17, 0x12, 0x82, 0xb7,
+  0x12, 0x7f, 0x92, 0x36, 0xb1, 0x14, 0xb3, 0xfa, 0x84, 0xfa, 0xc9, 0x83,
+  0xbe, 0x0d, 0x6d, 0xa2, 0x6d, 0x9c, 0x46, 0x2f, 0xbd, 0x03, 0xd0, 0xa5,
+  0xe1, 0x05, 0x81, 0x13, 0x34, 0xbe, 0xac, 0xbc, 0xef, 0xae, 0x85, 0x49,
+  0xbd, 0xa0, 0x40, 0x63, 0xff, 0xcc, 0x55, 0x47, 0x50, 0x39, 0xf0, 0xd4,
+  0xd1, 0x6e, 0x59, 0x4c, 0xe0, 0xd0, 0xe6, 0xca, 0xdc, 0xbd, 0x69, 0xe9,
+  0xf8, 0x7a, 0x66, 0xb9, 0x1c, 0x2e, 0xfe, 0x0c, 0xfb, 0xc7, 0x8d, 0xdd,
+  0x6a, 0x6f, 0x5a, 0xf3, 0xe2, 0x8e, 0x74, 0x97, 0xbe, 0x9e, 0x78, 0x12,
+  0xe2, 0x39, 0x16, 0x2f, 0x63, 0x9b, 0x54, 0x87, 0xcc, 0xd9, 0xe7, 0xca,
+  0x8b, 0x08, 0x73, 0x56, 0x29, 0x74, 0xf9, 0xd8, 0xf0, 0x23, 0x36, 0xaf,
+  0x5c, 0x89, 0x44, 0xff, 0xc5, 0x7e, 0x68, 0x0b, 0x84, 0xa7, 0xf6, 0x97,
+  0xb3, 0xe0, 0x98, 0xfd, 0x49, 0x72, 0x8c, 0x1d, 0x2a, 0x3a, 0x0b, 0x4f,
+  0x5a, 0x9e, 0x89, 0xbb, 0xcc, 0x18, 0xc1, 0x19, 0x7e, 0x79, 0xfd, 0x6a,
+  0x4d, 0xba, 0x7b, 0x65, 0xde, 0xdc, 0x53, 0x8e, 0x8c, 0x9d, 0x6c, 0xbb,
+  0x8d, 0xac, 0x7d, 0x1e, 0xe9, 0xfd, 0xdd, 0xa1, 0x8c, 0x4d, 0x18, 0xa9,
+  0x5d, 0xc7, 0x4c, 0x2b, 0x3c, 0xda, 0xd2, 0x3b, 0x11, 0x4f, 0xde, 0xf7,
+  0xb5, 0x21, 0x90, 0x9b, 0x22, 0xc8, 0x3f, 0x70, 0x1f, 0x3b, 0x15, 0x41,
+  0xeb, 0x30, 0xab, 0xe3, 0xde, 0xea, 0xf1, 0xd6, 0x79, 0x7e, 0xa7, 0x16,
+  0x9d, 0x42, 0x18, 0x98, 0x70, 0x55, 0xe8, 0x52, 0xe9, 0xc9, 0x35, 0x32,
+  0xc3, 0xb1, 0xfc, 0x21, 0xe2, 0x43, 0x5e, 0xa4, 0xb5, 0xcf, 0x41, 0x2d,
+  0x90, 0xf5, 0x13, 0x0d, 0x8c, 0x7d, 0x39, 0x98, 0x61, 0x43, 0x46, 0xdb,
+  0xcd, 0x20, 0x65, 0x88, 0xfb, 0x36, 0x19, 0xa4, 0xa1, 0x3d, 0x30, 0x0a,
+  0xa3, 0x9c, 0xda, 0x50, 0x9a, 0xd0, 0xc2, 0x8e, 0xff, 0x38, 0x9c, 0xf5,
+  0x1c, 0x62, 0x81, 0xfc, 0x41, 0x6c, 0x2f, 0x6f, 0x43, 0xb3, 0xe9, 0xad,
+  0xce, 0x87, 0x4f, 0x6a, 0xfd, 0x92, 0xc3, 0xe2, 0x37, 0x01, 0xf1, 0x0b,
+  0x3a, 0xcd, 0x5c, 0x5b, 0x22, 0x11, 0xdf, 0x4e, 0x0b, 0xbb, 0xc7, 0xe6,
+  0x07, 0x6f, 0xa7, 0x39, 0xf9, 0xb2, 0xd4, 0xf9, 0x56, 0x35, 0xe2, 0x94,
+  0xd3, 0x86, 0x17, 0x53, 0x62, 0xc9, 0x72, 0x5a, 0x32, 0xa8, 0xc7, 0x18,
+  0xca, 0x9e, 0x01, 0xbf, 0x28, 0x86, 0x12, 0x75, 0x04, 0x99, 0x49, 0xcb,
+  0x1f, 0xc0, 0x48, 0x7e, 0xcc, 0xac, 0x05, 0x9e, 0x53, 0x00, 0xa0, 0x52,
+  0xae, 0xf0, 0x23, 0xaa, 0xf0, 0x17, 0x95, 0x86, 0x23, 0x6f, 0xa4, 0x03,
+  0x48, 0x81, 0xf9, 0x72, 0xa8, 0x0f, 0x66, 0xc3, 0x68, 0x93, 0x03, 0xf6,
+  0x68, 0x3f, 0xc1, 0x5d, 0xc8, 0x3b, 0xba, 0x71, 0x18, 0xa3, 0x49, 0x5d,
+  0xec, 0x55, 0x66, 0x54, 0x08, 0x0b, 0x77, 0x10, 0xe9, 0xb5, 0xe9, 0xf3,
+  0xc7, 0xca, 0x56, 0x30, 0x5f, 0x9a, 0x5f, 0x53, 0xcb, 0x48, 0x6a, 0x19,
+  0x71, 0x29, 0x1f, 0xbf, 0xbf, 0x54, 0x98, 0xe5, 0xec, 0x25, 0xbe, 0x15,
+  0x9f, 0xcf, 0xe3, 0x74, 0xe6, 0x98, 0x46, 0xd0, 0x1a, 0x4c, 0xdc, 0x68,
+  0x08, 0xd7, 0xa0, 0xe8, 0x88, 0xad, 0xad, 0xdd, 0x7a, 0x05, 0x05, 0x05,
+  0xd1, 0xbd, 0x69, 0xec, 0x59, 0x8a, 0xae, 0x7e, 0xc3, 0x48, 0x88, 0xdf,
+  0xed, 0x1e, 0x39, 0xbb, 0x72, 0x7f, 0x1b, 0x8b, 0x7e, 0xf3, 0xec, 0xcc,
+  0xa8, 0x66, 0x0c, 0x38, 0xf0, 0x7c, 0x9d, 0x48, 0x43, 0x04, 0x49, 0x60,
+  0x1f, 0xe7, 0x9d, 0xeb, 0x5e, 0xfd, 0x23, 0xa6, 0x4a, 0xd0, 0x10, 0x35,
+  0x23, 0xbf, 0xb4, 0xf1, 0x35, 0xb1, 0x2f, 0xb1, 0x3e, 0x0b, 0x55, 0x5b,
+  0xe0, 0x9c, 0xe7, 0xea, 0xc0, 0xfe, 0x9e, 0xf4, 0x9e, 0xf7, 0xef, 0x07,
+  0xde, 0x70, 0x6a, 0xc6, 0xfa, 0xce, 0x59, 0x09, 0x23, 0xc0, 0xa3, 0xc9,
+  0x0b, 0x6b, 0x86, 0x76, 0xb0, 0x5d, 0x1e, 0x8b, 0xcb, 0xa6, 0x8e, 0x21,
+  0xb8, 0x63, 0x65, 0xb0, 0x74, 0x85, 0xf7, 0xaa, 0xaa, 0xaa, 0x6b, 0xce,
+  0xe2, 0xab, 0x49, 0x04, 0xb6, 0x4e, 0x9f, 0x16, 0x52, 0x2e, 0x1a, 0x22,
+  0x77, 0xee, 0x2e, 0xc9, 0x53, 0x25, 0x81, 0x05, 0x0d, 0x97, 0xdc, 0x9e,
+  0x57, 0x02, 0xa8, 0x6e, 0x73, 0x10, 0x79, 0x3a, 0x0c, 0xd5, 0x94, 0xe9,
+  0xe1, 0xf2, 0xd2, 0xc7, 0x24, 0xaf, 0xaa, 0x81, 0x36, 0xc9, 0x55, 0xf6,
+  0xea, 0xa5, 0x44, 0xd7, 0x7b, 0x5c, 0x99, 0x94, 0x5b, 0xcd, 0xdd, 0xdf,
+  0x22, 0x98, 0xf4, 0x05, 0x61, 0xe9, 0xa7, 0x11, 0x11, 0xb6, 0xaa, 0x23,
+  0x8d, 0x9b, 0xff, 0x84, 0xfb, 0x55, 0x9e, 0x19, 0x03, 0x63, 0x47, 0x9c,
+  0x6f, 0xed, 0xdb, 0xaf, 0x74, 0xe6, 0xc3, 0x06, 0xc9, 0x60, 0x33, 0x53,
+  0xc0, 0x81, 0xdf, 0xfc, 0x3b, 0xcb, 0x72, 0xf2, 0x01, 0xaf, 0x5c, 0x1c,
+  0xd2, 0x98, 0x54, 0xee, 0x3d, 0xc4, 0x4d, 0xe5, 0xb8, 0x26, 0x3e, 0xa5,
+  0x0f, 0x30, 0xf9, 0xe4, 0xba, 0x30, 0x5f, 0x88, 0xb3, 0x51, 0x9b, 0xc3,
+  0x82, 0x9b, 0x34, 0x69, 0xcd, 0xd2, 0x33, 0x7f, 0xd2, 0x85, 0xde, 0xc4,
+  0x4f, 0xa4, 0xa4, 0xa4, 0x7b, 0xba, 0x72, 0xfa, 0x9b, 0x26, 0x88, 0x6f,
+  0x08, 0xf7, 0xb5, 0x56, 0xc0, 0x7b, 0x9a, 0xdc, 0x10, 0x5b, 0xb3, 0x54,
+  0x72, 0x72, 0x5c, 0x5f, 0x4b, 0x2b, 0x0b, 0x07, 0x03, 0x3d, 0x17, 0x89,
+  0x65, 0xa1, 0x17, 0x7b, 0xa3, 0x2f, 0x89, 0x28, 0xce, 0xee, 0xf7, 0x41,
+  0xfd, 0x50, 0xe2, 0x3a, 0x7f, 0x41, 0x43, 0x9a, 0xb6, 0x2a, 0x51, 0x3e,
+  0xfb, 0x77, 0x02, 0x08, 0x53, 0x40, 0x12, 0x47, 0xb3, 0xe5, 0x3f, 0x80,
+  0x80, 0xfb, 0xfd, 0x6b, 0xa6, 0x34, 0xef, 0x22, 0x06, 0x36, 0xc0, 0x1f,
+  0x2b, 0xf7, 0x79, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x5b, 0x00,
+  0xb2, 0x00, 0x00, 0x00, 0x5b, 0x00, 0xb6, 0x00, 0x0d, 0x01, 0x64, 0x01,
+  0xbd, 0x01, 0x16, 0x02, 0x29, 0x02, 0x42, 0x02, 0x00, 0x00, 0x15, 0x00,
+  0x29, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x19, 0x00, 0x2d, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x2d, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x16, 0x00, 0x35, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x35, 0x00,
+  0x4e, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x13, 0x00, 0x26, 0x00,
+  0x3a, 0x00, 0x00, 0x00, 0x14, 0x00, 0x24, 0x00, 0x35, 0x00, 0x00, 0x00,
+  0x16, 0x00, 0x2b, 0x00, 0x42, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x1a, 0x00, 0x38, 0x00, 0x5c, 0x00, 0x80, 0x00, 0x9a, 0x00, 0xb1, 0x00,
+  0xc3, 0x00, 0xd2, 0x00, 0xe5, 0x00, 0x06, 0x01, 0x12, 0x01, 0x1f, 0x01,
+  0x39, 0x01, 0x59, 0x01, 0x73, 0x01, 0x93, 0x01, 0xb5, 0x01, 0xd4, 0x01,
+  0xe5, 0x01, 0x00, 0x00, 0x10, 0x00, 0x20, 0x00, 0x2c, 0x00, 0x3b, 0x00,
+  0x4e, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x26, 0x00, 0x39, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x1e, 0x00, 0x31, 0x00, 0x3e, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x11, 0x00,
+  0x24, 0x00, 0x37, 0x00, 0x47, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x27, 0x00,
+  0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x29, 0x00, 0x3d, 0x00,
+  0x00, 0x00, 0x17, 0x00, 0x32, 0x00, 0x00, 0x00, 0x15, 0x00, 0x2b, 0x00,
+  0x3f, 0x00, 0x4f, 0x00, 0x00, 0x00, 0x15, 0x00, 0x24, 0x00, 0x36, 0x00,
+  0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x49, 0x00, 0x5a, 0x00, 0x72, 0x00,
+  0x7f, 0x00, 0x9f, 0x00, 0xaf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00,
+  0x25, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x23, 0x00, 0x31, 0x00, 0x48, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x00, 0x00, 0x3f, 0x00, 0x50, 0x00, 0x00, 0x00, 0x10, 0x00, 0x1a, 0x00,
+  0x2c, 0x00, 0x00, 0x00, 0x13, 0x00, 0x27, 0x00, 0x3a, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x27, 0x00, 0x3b, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x17, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x23, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x4a, 0x00,
+  0x64, 0x00, 0x75, 0x00, 0x88, 0x00, 0x9a, 0x00, 0xac, 0x00, 0xbf, 0x00,
+  0xcf, 0x00, 0xe1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x2d, 0x00,
+  0x43, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x17, 0x00, 0x30, 0x00, 0x47, 0x00,
+  0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x00, 0x44, 0x00, 0x62, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x25, 0x00, 0x32, 0x00, 0x00, 0x00, 0x1a, 0x00,
+  0x27, 0x00, 0x36, 0x00, 0x44, 0x00, 0x00, 0x00, 0x16, 0x00, 0x29, 0x00,
+  0x4d, 0x00, 0x60, 0x00, 0x6f, 0x00, 0x7e, 0x00, 0x8d, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x20, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x13, 0x00, 0x25, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x1d, 0x00,
+  0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x23, 0x00, 0x3b, 0x00,
+  0x00, 0x00, 0x17, 0x00, 0x30, 0x00, 0x43, 0x00, 0x63, 0x00, 0x70, 0x00,
+  0x00, 0x00, 0x0f, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x13, 0x00, 0x26, 0x00,
+  0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x26, 0x00,
+  0x39, 0x00, 0x00, 0x00, 0x27, 0x00, 0x40, 0x00, 0x4f, 0x00, 0x5e, 0x00,
+  0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x32, 0x00, 0x44, 0x00,
+  0x00, 0x00, 0x13, 0x00, 0x26, 0x00, 0x35, 0x00, 0x47, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x35, 0x00, 0x68, 0x00, 0xa6, 0x00, 0xce, 0x00,
+  0xed, 0x00, 0x0a, 0x01, 0x2e, 0x01, 0x4d, 0x01, 0x60, 0x01, 0x6d, 0x01,
+  0x7d, 0x01, 0x91, 0x01, 0xa8, 0x01, 0xb5, 0x01, 0xc9, 0x01, 0xd5, 0x01,
+  0x00, 0x00, 0x31, 0x00, 0x60, 0x00, 0x9a, 0x00, 0xc0, 0x00, 0xdf, 0x00,
+  0xfa, 0x00, 0x29, 0x01, 0x3d, 0x01, 0x49, 0x01, 0x5c, 0x01, 0x74, 0x01,
+  0x83, 0x01, 0x96, 0x01, 0x00, 0x00, 0x15, 0x00, 0x1f, 0x00, 0x32, 0x00,
+  0x4c, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x21, 0x00, 0x30, 0x00, 0x40, 0x00, 0x51, 0x00, 0x00, 0x00,
+  0x1b, 0x00, 0x30, 0x00, 0x49, 0x00, 0x61, 0x00, 0x00, 0x00, 0x0d, 0x00,
+  0x00, 0x00, 0x15, 0x00, 0x22, 0x00, 0x00, 0x00, 0x10, 0x00, 0x29, 0x00,
+  0x00, 0x00, 0x0f, 0x00, 0x1d, 0x00, 0x35, 0x00, 0x42, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x37, 0x00, 0x58, 0x00,
+  0x65, 0x00, 0x74, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x7f, 0x00,
+  0xa7, 0x00, 0xe5, 0x00, 0x11, 0x01, 0x2a, 0x01, 0x50, 0x01, 0x60, 0x01,
+  0x00, 0x00, 0x33, 0x00, 0x3f, 0x00, 0x55, 0x00, 0x00, 0x00, 0x28, 0x00,
+  0x77, 0x00, 0x9d, 0x00, 0xd9, 0x00, 0x03, 0x01, 0x1e, 0x01, 0x44, 0x01,
+  0x5e, 0x01, 0x6e, 0x01, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x18, 0x00, 0x35, 0x00,
+  0x50, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x16, 0x00, 0x2b, 0x00,
+  0x41, 0x00, 0x56, 0x00, 0x70, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x16, 0x00, 0x2b, 0x00, 0x3d, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x71, 0x00,
+  0xa2, 0x00, 0xd7, 0x00, 0xf2, 0x00, 0x13, 0x01, 0x3f, 0x01, 0x63, 0x01,
+  0x7b, 0x01, 0x87, 0x01, 0x96, 0x01, 0xa8, 0x01, 0x00, 0x00, 0x25, 0x00,
+  0x00, 0x00, 0x3c, 0x00, 0x6b, 0x00, 0x98, 0x00, 0xc7, 0x00, 0xe0, 0x00,
+  0xff, 0x00, 0x29, 0x01, 0x51, 0x01, 0x63, 0x01, 0x76, 0x01, 0x89, 0x01,
+  0x9a, 0x01, 0xaf, 0x01, 0xc2, 0x01, 0x00, 0x00, 0x38, 0x00, 0x58, 0x00,
+  0x78, 0x00, 0x88, 0x00, 0x00, 0x00, 0x22, 0x00, 0x37, 0x00, 0x4d, 0x00,
+  0x59, 0x00, 0x00, 0x00, 0x34, 0x00, 0x56, 0x00, 0x00, 0x00, 0x29, 0x00,
+  0x4f, 0x00, 0x62, 0x00, 0x6e, 0x00, 0x7c, 0x00, 0x8d, 0x00, 0x00, 0x00,
+  0x3e, 0x00, 0x4f, 0x00, 0x00, 0x00, 0x24, 0x00, 0x48, 0x00, 0x5b, 0x00,
+  0x72, 0x00, 0x00, 0x00, 0x28, 0x00, 0x35, 0x00, 0x45, 0x00, 0x00, 0x00,
+  0x24, 0x00, 0x40, 0x00, 0x50, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x49, 0x00,
+  0x5f, 0x00, 0x6f, 0x00, 0x78, 0x00, 0x88, 0x00, 0x00, 0x00, 0x2f, 0x00,
+  0x45, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x42, 0x00,
+  0x57, 0x00, 0x6b, 0x00, 0x7b, 0x00, 0x90, 0x00, 0xa5, 0x00, 0x00, 0x00,
+  0x29, 0x00, 0x58, 0x00, 0x00, 0x00, 0x38, 0x00, 0x71, 0x00, 0x99, 0x00,
+  0xc3, 0x00, 0xe0, 0x00, 0xf4, 0x00, 0x00, 0x00, 0x26, 0x00, 0x3c, 0x00,
+  0x00, 0x00, 0x38, 0x00, 0x6d, 0x00, 0x93, 0x00, 0xd0, 0x00, 0xf2, 0x00,
+  0x1b, 0x01, 0x00, 0x00, 0x1c, 0x00, 0x40, 0x00, 0x00, 0x00, 0x1c, 0x00,
+  0x47, 0x00, 0x7d, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x2a, 0x00,
+  0x5c, 0x00, 0x78, 0x00, 0x98, 0x00, 0xb6, 0x00, 0x00, 0x00, 0x20, 0x00,
+  0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x10, 0x00, 0x21, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x24, 0x00, 0x42, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x3c, 0x00, 0x6b, 0x00, 0x7e, 0x00, 0x8e, 0x00, 0x9e, 0x00,
+  0x00, 0x00, 0x24, 0x00, 0x4d, 0x00, 0x73, 0x00, 0x81, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x4b, 0x00, 0x6f, 0x00, 0x81, 0x00, 0x93, 0x00, 0xa6, 0x00,
+  0xb8, 0x00, 0xcd, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x71, 0x00, 0x00, 0x00,
+  0x24, 0x00, 0x3b, 0x00, 0x54, 0x00, 0x6b, 0x00, 0x00, 0x00, 0x22, 0x00,
+  0x4b, 0x00, 0x6b, 0x00, 0x81, 0x00, 0x8e, 0x00, 0x9b, 0x00, 0xab, 0x00,
+  0xc7, 0x00, 0x00, 0x00, 0x20, 0x00, 0x44, 0x00, 0x51, 0x00, 0x00, 0x00,
+  0x2b, 0x00, 0x40, 0x00, 0x59, 0x00, 0x6a, 0x00, 0x7c, 0x00, 0x8b, 0x00,
+  0x9e, 0x00, 0xb1, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x1e, 0x00,
+  0x42, 0x00, 0x68, 0x00, 0x93, 0x00, 0xa1, 0x00, 0xae, 0x00, 0xba, 0x00,
+  0xd1, 0x00, 0x00, 0x00, 0x22, 0x00, 0x46, 0x00, 0x6c, 0x00, 0x91, 0x00,
+  0xa5, 0x00, 0xb8, 0x00, 0xc6, 0x00, 0x00, 0x00, 0x29, 0x00, 0x4f, 0x00,
+  0x66, 0x00, 0x76, 0x00, 0x86, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x53, 0x00,
+  0x77, 0x00, 0x8b, 0x00, 0x9a, 0x00, 0xa5, 0x00, 0xb4, 0x00, 0xc0, 0x00,
+  0x00, 0x00, 0x1e, 0x00, 0x40, 0x00, 0x77, 0x00, 0x8a, 0x00, 0x96, 0x00,
+  0x00, 0x00, 0x24, 0x00, 0x4a, 0x00, 0x70, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x2b, 0x00, 0x4f, 0x00, 0x00, 0x00, 0x26, 0x00, 0x4e, 0x00, 0x72, 0x00,
+  0x88, 0x00, 0x9c, 0x00, 0xaf, 0x00, 0xc7, 0x00, 0xdb, 0x00, 0x00, 0x00,
+  0x3b, 0x00, 0x56, 0x00, 0x63, 0x00, 0x00, 0x00, 0x20, 0x00, 0x4d, 0x00,
+  0x00, 0x00, 0x20, 0x00, 0x2e, 0x00, 0x45, 0x00, 0x61, 0x00, 0x7a, 0x00,
+  0x91, 0x00, 0xaa, 0x00, 0xbd, 0x00, 0xd3, 0x00, 0xe9, 0x00, 0x03, 0x01,
+  0x1d, 0x01, 0x34, 0x01, 0x45, 0x01, 0x5d, 0x01, 0x73, 0x01, 0x87, 0x01,
+  0x9e, 0x01, 0xb5, 0x01, 0xcf, 0x01, 0xe9, 0x01, 0x01, 0x02, 0x1b, 0x02,
+  0x31, 0x02, 0x47, 0x02, 0x5d, 0x02, 0x75, 0x02, 0x90, 0x02, 0xac, 0x02,
+  0xc2, 0x02, 0xdc, 0x02, 0xf5, 0x02, 0x0b, 0x03, 0x27, 0x03, 0x40, 0x03,
+  0x56, 0x03, 0x73, 0x03, 0x00, 0x00, 0x20, 0x00, 0x45, 0x00, 0x65, 0x00,
+  0x85, 0x00, 0x98, 0x00, 0xa8, 0x00, 0x00, 0x00, 0x38, 0x00, 0x67, 0x00,
+  0x7a, 0x00, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x00, 0x32, 0x00,
+  0x44, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x54, 0x00, 0x78, 0x00,
+  0xa5, 0x00, 0x00, 0x00, 0x31, 0x00, 0x40, 0x00, 0x00, 0x00, 0x0f, 0x00,
+  0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x19, 0x00, 0x3d, 0x00, 0x5f, 0x00,
+  0x75, 0x00, 0x84, 0x00, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00,
+  0x2e, 0x00, 0x41, 0x00, 0x55, 0x00, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x2b, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x3a, 0x00, 0x50, 0x00, 0x64, 0x00, 0x71, 0x00, 0x8b, 0x00,
+  0x95, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x24, 0x00, 0x44, 0x00,
+  0x65, 0x00, 0x8a, 0x00, 0xa3, 0x00, 0xb4, 0x00, 0xc7, 0x00, 0xd6, 0x00,
+  0x00, 0x00, 0x20, 0x00, 0x37, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x27, 0x00,
+  0x37, 0x00, 0x46, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x1d, 0x00, 0x00, 0x00, 0x29, 0x00, 0x40, 0x00, 0x53, 0x00, 0x00, 0x00,
+  0x22, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x14, 0x00, 0x20, 0x00,
+  0x32, 0x00, 0x45, 0x00, 0x57, 0x00, 0x6a, 0x00, 0x7a, 0x00, 0x88, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x17, 0x00, 0x2a, 0x00,
+  0x3f, 0x00, 0x53, 0x00, 0x00, 0x00, 0x19, 0x00, 0x25, 0x00, 0x3a, 0x00,
+  0x00, 0x00, 0x11, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00,
+  0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x2a, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x21, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00,
+  0x23, 0x00, 0x00, 0x00, 0x13, 0x00, 0x20, 0x00, 0x00, 0x00, 0x16, 0x00,
+  0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x15, 0x00, 0x2b, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x39, 0x00, 0x00, 0x00,
+  0x17, 0x00, 0x25, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x3b, 0x00,
+  0x00, 0x00, 0x23, 0x00, 0x36, 0x00, 0x49, 0x00, 0x5c, 0x00, 0x69, 0x00,
+  0x7b, 0x00, 0x8c, 0x00, 0x00, 0x00, 0x23, 0x00, 0x2f, 0x00, 0x42, 0x00,
+  0x52, 0x00, 0x00, 0x00, 0x17, 0x00, 0x2b, 0x00, 0x3e, 0x00, 0x55, 0x00,
+  0x66, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x20, 0x00,
+  0x31, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x00,
+  0x26, 0x00, 0x3b, 0x00, 0x4d, 0x00, 0x60, 0x00, 0x00, 0x00, 0x18, 0x00,
+  0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x14, 0x00,
+  0x2c, 0x00, 0x39, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x1d, 0x00,
+  0x2f, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x22, 0x00,
+  0x2e, 0x00, 0x00, 0x00, 0x10, 0x00, 0x1f, 0x00, 0x2f, 0x00, 0x3f, 0x00,
+  0x00, 0x00, 0x14, 0x00, 0x30, 0x00, 0x4d, 0x00, 0x5e, 0x00, 0x71, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x28, 0x00, 0x35, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1b, 0x00,
+  0x29, 0x00, 0x3d, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x25, 0x00,
+  0x35, 0x00, 0x46, 0x00, 0x61, 0x00, 0x76, 0x00, 0x85, 0x00, 0x98, 0x00,
+  0xa9, 0x00, 0x00, 0x00, 0x28, 0x00, 0x65, 0x00, 0x75, 0x00, 0x89, 0x00,
+  0x9a, 0x00, 0xab, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x20, 0x00, 0x33, 0x00,
+  0x40, 0x00, 0x54, 0x00, 0x67, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x24, 0x00, 0x34, 0x00, 0x00, 0x00, 0x14, 0x00, 0x2d, 0x00,
+  0x3d, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x13, 0x00, 0x2d, 0x00, 0x3f, 0x00,
+  0x5e, 0x00, 0x67, 0x00, 0x77, 0x00, 0x8f, 0x00, 0xa1, 0x00, 0xad, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x33, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x18, 0x00, 0x2e, 0x00, 0x3e, 0x00, 0x50, 0x00, 0x00, 0x00, 0x19, 0x00,
+  0x2e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x23, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x24, 0x00, 0x45, 0x00, 0x62, 0x00, 0x7b, 0x00, 0x8d, 0x00,
+  0x9c, 0x00, 0xad, 0x00, 0x00, 0x00, 0x21, 0x00, 0x30, 0x00, 0x51, 0x00,
+  0x6c, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x31, 0x00, 0x45, 0x00, 0x5b, 0x00,
+  0x00, 0x00, 0x23, 0x00, 0x38, 0x00, 0x4c, 0x00, 0x5b, 0x00, 0x00, 0x00,
+  0x21, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x21, 0x00, 0x32, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x2b, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x2f, 0x00, 0x45, 0x00, 0x51, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x1d, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x23, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x00, 0x00, 0x16, 0x00, 0x24, 0x00, 0x00, 0x00, 0x11, 0x00, 0x1e, 0x00,
+  0x2a, 0x00, 0x38, 0x00, 0x00, 0x00, 0x10, 0x00, 0x21, 0x00, 0x00, 0x00,
+  0x18, 0x00, 0x28, 0x00, 0x41, 0x00, 0x00, 0x00, 0x35, 0x00, 0x4e, 0x00,
+  0x5f, 0x00, 0x00, 0x00, 0x35, 0x00, 0x4f, 0x00, 0x5f, 0x00, 0x70, 0x00,
+  0x8c, 0x00, 0x00, 0x00, 0x18, 0x00, 0x27, 0x00, 0x38, 0x00, 0x4d, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x23, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x24, 0x00, 0x31, 0x00, 0x44, 0x00, 0x59, 0x00, 0x66, 0x00, 0x77, 0x00,
+  0x88, 0x00, 0x9b, 0x00, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00,
+  0x2f, 0x00, 0x45, 0x00, 0x58, 0x00, 0x6c, 0x00, 0x80, 0x00, 0x8d, 0x00,
+  0xa4, 0x00, 0xb3, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x18, 0x00, 0x28, 0x00,
+  0x46, 0x00, 0x55, 0x00, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x26, 0x00, 0x35, 0x00,
+  0x00, 0x00, 0x15, 0x00, 0x29, 0x00, 0x40, 0x00, 0x4d, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x1c, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00,
+  0x29, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x12, 0x00, 0x21, 0x00,
+  0x33, 0x00, 0x4a, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x2c, 0x00, 0x42, 0x00,
+  0x00, 0x00, 0x1c, 0x00, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x1a, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x21, 0x00, 0x31, 0x00,
+  0x00, 0x00, 0x2b, 0x00, 0x45, 0x00, 0x00, 0x00, 0x16, 0x00, 0x29, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x2a, 0x00, 0x3b, 0x00, 0x4e, 0x00,
+  0x5e, 0x00, 0x70, 0x00, 0x80, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00,
+  0x2c, 0x00, 0x36, 0x00, 0x4f, 0x00, 0x5f, 0x00, 0x78, 0x00, 0x8e, 0x00,
+  0xa1, 0x00, 0xb5, 0x00, 0xcb, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x22, 0x00,
+  0x31, 0x00, 0x00, 0x00, 0x17, 0x00, 0x30, 0x00, 0x47, 0x00, 0x54, 0x00,
+  0x00, 0x00, 0x18, 0x00, 0x28, 0x00, 0x45, 0x00, 0x5b, 0x00, 0x71, 0x00,
+  0x82, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x24, 0x00, 0x3a, 0x00, 0x4f, 0x00,
+  0x00, 0x00, 0x21, 0x00, 0x3a, 0x00, 0x57, 0x00, 0x6a, 0x00, 0x00, 0x00,
+  0x21, 0x00, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x26, 0x00,
+  0x34, 0x00, 0x41, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x25, 0x00, 0x34, 0x00, 0x4c, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x13, 0x00,
+  0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x24, 0x00, 0x37, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x26, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x25, 0x00,
+  0x31, 0x00, 0x00, 0x00, 0x15, 0x00, 0x2f, 0x00, 0x3c, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x33, 0x00,
+  0x47, 0x00, 0x5a, 0x00, 0x6c, 0x00, 0x79, 0x00, 0x88, 0x00, 0x95, 0x00,
+  0xaa, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x16, 0x00, 0x22, 0x00,
+  0x31, 0x00, 0x48, 0x00, 0x5d, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x22, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x13, 0x00, 0x26, 0x00, 0x3e, 0x00,
+  0x4d, 0x00, 0x6f, 0x00, 0x7b, 0x00, 0x8d, 0x00, 0x9f, 0x00, 0xb9, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x24, 0x00, 0x3d, 0x00, 0x50, 0x00, 0x64, 0x00,
+  0x76, 0x00, 0x00, 0x00, 0x16, 0x00, 0x32, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x1c, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x34, 0x00, 0x00, 0x00,
+  0x15, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x1b, 0x00,
+  0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x26, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x1e, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1f, 0x00,
+  0x37, 0x00, 0x47, 0x00, 0x5f, 0x00, 0x6b, 0x00, 0x00, 0x00, 0x13, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x2e, 0x00, 0x00, 0x00,
+  0x26, 0x00, 0x3d, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x18, 0x00, 0x2d, 0x00,
+  0x46, 0x00, 0x5e, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x2b, 0x00, 0x46, 0x00, 0x50, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x20, 0x00, 0x00, 0x00, 0x18, 0x00, 0x2e, 0x00, 0x3c, 0x00,
+  0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x36, 0x00, 0x4c, 0x00, 0x5d, 0x00,
+  0x6d, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x29, 0x00, 0x37, 0x00, 0x4d, 0x00,
+  0x00, 0x00, 0x1f, 0x00, 0x39, 0x00, 0x4e, 0x00, 0x5e, 0x00, 0x70, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x29, 0x00, 0x42, 0x00, 0x00, 0x00, 0x2d, 0x00,
+  0x3b, 0x00, 0x4a, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x21, 0x00,
+  0x31, 0x00, 0x47, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x24, 0x00, 0x00, 0x00,
+  0x29, 0x00, 0x44, 0x00, 0x5b, 0x00, 0x74, 0x00, 0x87, 0x00, 0x9c, 0x00,
+  0x00, 0x00, 0x34, 0x00, 0x4b, 0x00, 0x59, 0x00, 0x6a, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x14, 0x00, 0x27, 0x00, 0x39, 0x00, 0x4b, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x26, 0x00,
+  0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x25, 0x00,
+  0x00, 0x00, 0x14, 0x00, 0x23, 0x00, 0x00, 0x00, 0x16, 0x00, 0x26, 0x00,
+  0x2f, 0x00, 0x00, 0x00, 0x16, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x0f, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x35, 0x00,
+  0x48, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x2e, 0x00, 0x3d, 0x00, 0x4b, 0x00,
+  0x00, 0x00, 0x15, 0x00, 0x24, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x20, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x20, 0x00,
+  0x32, 0x00, 0x42, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x12, 0x00,
+  0x25, 0x00, 0x00, 0x00, 0x14, 0x00, 0x24, 0x00, 0x41, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x25, 0x00, 0x38, 0x00, 0x4b, 0x00, 0x60, 0x00, 0x77, 0x00,
+  0x84, 0x00, 0x99, 0x00, 0x00, 0x00, 0x10, 0x00, 0x20, 0x00, 0x41, 0x00,
+  0x50, 0x00, 0x00, 0x00, 0x14, 0x00, 0x2b, 0x00, 0x45, 0x00, 0x56, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x2d, 0x00,
+  0x40, 0x00, 0x5a, 0x00, 0x66, 0x00, 0x00, 0x00, 0x16, 0x00, 0x26, 0x00,
+  0x36, 0x00, 0x45, 0x00, 0x00, 0x00, 0x12, 0x00, 0x22, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x1a, 0x00, 0x30, 0x00, 0x00, 0x00, 0x18, 0x00, 0x31, 0x00,
+  0x47, 0x00, 0x00, 0x00, 0x26, 0x00, 0x3a, 0x00, 0x4a, 0x00, 0x00, 0x00,
+  0x17, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x14, 0x00, 0x2a, 0x00, 0x4a, 0x00,
+  0x00, 0x00, 0x32, 0x00, 0x45, 0x00, 0x00, 0x00, 0x25, 0x00, 0x35, 0x00,
+  0x4d, 0x00, 0x5e, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x38, 0x00, 0x4c, 0x00,
+  0x5a, 0x00, 0x00, 0x00, 0x30, 0x00, 0x4d, 0x00, 0x67, 0x00, 0x00, 0x00,
+  0x17, 0x00, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x00, 0x37, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x33, 0x00, 0x59, 0x00, 0x00, 0x00, 0x2f, 0x00,
+  0x43, 0x00, 0x4f, 0x00, 0x61, 0x00, 0x73, 0x00, 0x7a, 0x00, 0x00, 0x00,
+  0x17, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x12, 0x00, 0x20, 0x00,
+  0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x25, 0x00,
+  0x36, 0x00, 0x47, 0x00, 0x00, 0x00, 0x25, 0x00, 0x3c, 0x00, 0x48, 0x00,
+  0x67, 0x00, 0x74, 0x00, 0x00, 0x00, 0x13, 0x00, 0x2c, 0x00, 0x45, 0x00,
+  0x56, 0x00, 0x65, 0x00, 0x76, 0x00, 0x82, 0x00, 0x00, 0x00, 0x0d, 0x00,
+  0x00, 0x00, 0x15, 0x00, 0x28, 0x00, 0x35, 0x00, 0x41, 0x00, 0x4e, 0x00,
+  0x5e, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x16, 0x00, 0x26, 0x00,
+  0x3e, 0x00, 0x56, 0x00, 0x65, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x2a, 0x00,
+  0x00, 0x00, 0x17, 0x00, 0x26, 0x00, 0x36, 0x00, 0x4a, 0x00, 0x5e, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x10, 0x00, 0x2e, 0x00, 0x3c, 0x00,
+  0x54, 0x00, 0x64, 0x00, 0x00, 0x00, 0x12, 0x00, 0x23, 0x00, 0x34, 0x00,
+  0x44, 0x00, 0x50, 0x00, 0x00, 0x00, 0x14, 0x00, 0x24, 0x00, 0x3e, 0x00,
+  0x4d, 0x00, 0x00, 0x00, 0x16, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x15, 0x00,
+  0x2b, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x21, 0x00, 0x00, 0x00,
+  0x15, 0x00, 0x2a, 0x00, 0x38, 0x00, 0x00, 0x00, 0x13, 0x00, 0x27, 0x00,
+  0x3a, 0x00, 0x00, 0x00, 0x26, 0x00, 0x55, 0x00, 0x65, 0x00, 0x00, 0x00,
+  0x1d, 0x00, 0x34, 0x00, 0x44, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x28, 0x00, 0x00, 0x00, 0x16, 0x00, 0x2d, 0x00, 0x43, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x11, 0x00, 0x28, 0x00, 0x46, 0x00,
+  0x5b, 0x00, 0x76, 0x00, 0x8c, 0x00, 0x9b, 0x00, 0xb1, 0x00, 0xc1, 0x00,
+  0xdb, 0x00, 0x00, 0x00, 0x17, 0x00, 0x2e, 0x00, 0x42, 0x00, 0x63, 0x00,
+  0x00, 0x00, 0x1b, 0x00, 0x32, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x21, 0x00, 0x3f, 0x00, 0x4d, 0x00,
+  0x00, 0x00, 0x14, 0x00, 0x24, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x36, 0x00, 0x46, 0x00,
+  0x61, 0x00, 0x70, 0x00, 0x00, 0x00, 0x13, 0x00, 0x23, 0x00, 0x31, 0x00,
+  0x00, 0x00, 0x0f, 0x00, 0x1f, 0x00, 0x33, 0x00, 0x44, 0x00, 0x00, 0x00,
+  0x1e, 0x00, 0x30, 0x00, 0x00, 0x00, 0x17, 0x00, 0x27, 0x00, 0x37, 0x00,
+  0x00, 0x00, 0x11, 0x00, 0x1f, 0x00, 0x2c, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x3b, 0x00, 0x4a, 0x00, 0x00, 0x00, 0x15, 0x00, 0x22, 0x00,
+  0x00, 0x00, 0x18, 0x00, 0x29, 0x00, 0x41, 0x00, 0x00, 0x00, 0x13, 0x00,
+  0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x3e, 0x00, 0x57, 0x00,
+  0x64, 0x00, 0x71, 0x00, 0x00, 0x00, 0x23, 0x00, 0x36, 0x00, 0x4c, 0x00,
+  0x5f, 0x00, 0x6c, 0x00, 0x81, 0x00, 0x00, 0x00, 0x19, 0x00, 0x29, 0x00,
+  0x3f, 0x00, 0x55, 0x00, 0x66, 0x00, 0x00, 0x00, 0x10, 0x00, 0x26, 0x00,
+  0x3a, 0x00, 0x4f, 0x00, 0x5e, 0x00, 0x00, 0x00, 0x19, 0x00, 0x2f, 0x00,
+  0x45, 0x00, 0x59, 0x00, 0x6c, 0x00, 0x7d, 0x00, 0x96, 0x00, 0x00, 0x00,
+  0x18, 0x00, 0x30, 0x00, 0x00, 0x00, 0x35, 0x00, 0x49, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x29, 0x00, 0x46, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x30, 0x00,
+  0x48, 0x00, 0x5b, 0x00, 0x78, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x33, 0x00,
+  0x00, 0x00, 0x1d, 0x00, 0x31, 0x00, 0x40, 0x00, 0x00, 0x00, 0x11, 0x00,
+  0x29, 0x00, 0x44, 0x00, 0x59, 0x00, 0x00, 0x00, 0x23, 0x00, 0x39, 0x00,
+  0x00, 0x00, 0x1c, 0x00, 0x27, 0x00, 0x38, 0x00, 0x00, 0x00, 0x12, 0x00,
+  0x2e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x1e, 0x00,
+  0x31, 0x00, 0x00, 0x00, 0x39, 0x00, 0x4e, 0x00, 0x64, 0x00, 0x7b, 0x00,
+  0x88, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0f, 0x00, 0x25, 0x00, 0x39, 0x00, 0x4e, 0x00, 0x5f, 0x00,
+  0x72, 0x00, 0x81, 0x00, 0x00, 0x00, 0x26, 0x00, 0x3a, 0x00, 0x49, 0x00,
+  0x00, 0x00, 0x18, 0x00, 0x29, 0x00, 0x3a, 0x00, 0x50, 0x00, 0x61, 0x00,
+  0x75, 0x00, 0x89, 0x00, 0x96, 0x00, 0xb0, 0x00, 0xc7, 0x00, 0x00, 0x00,
+  0x36, 0x00, 0x54, 0x00, 0x65, 0x00, 0x75, 0x00, 0x86, 0x00, 0x00, 0x00,
+  0x15, 0x00, 0x25, 0x00, 0x35, 0x00, 0x00, 0x00, 0x14, 0x00, 0x25, 0x00,
+  0x33, 0x00, 0x00, 0x00, 0x25, 0x00, 0x46, 0x00, 0x7b, 0x00, 0x00, 0x00,
+  0x25, 0x00, 0x54, 0x00, 0x84, 0x00, 0x97, 0x00, 0x00, 0x00, 0x1c, 0x00,
+  0x2b, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x11, 0x00, 0x23, 0x00,
+  0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x34, 0x00, 0x4a, 0x00,
+  0x5d, 0x00, 0x6b, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x2e, 0x00, 0x3c, 0x00,
+  0x00, 0x00, 0x27, 0x00, 0x37, 0x00, 0x48, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x24, 0x00, 0x2e, 0x00, 0x00, 0x00,
+  0x24, 0x00, 0x00, 0x00, 0x18, 0x00, 0x29, 0x00, 0x3d, 0x00, 0x00, 0x00,
+  0x26, 0x00, 0x59, 0x00, 0x6a, 0x00, 0x80, 0x00, 0x96, 0x00, 0x00, 0x00,
+  0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x2b, 0x00, 0x37, 0x00,
+  0x00, 0x00, 0x1e, 0x00, 0x37, 0x00, 0x75, 0x00, 0x83, 0x00, 0x97, 0x00,
+  0xa5, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x29, 0x00, 0x00, 0x00, 0x21, 0x00,
+  0x3b, 0x00, 0x56, 0x00, 0x66, 0x00, 0x80, 0x00, 0x93, 0x00, 0xa4, 0x00,
+  0xb7, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x28, 0x00, 0x45, 0x00, 0x53, 0x00,
+  0x00, 0x00, 0x28, 0x00, 0x35, 0x00, 0x4a, 0x00, 0x00, 0x00, 0x0d, 0x00,
+  0x00, 0x00, 0x21, 0x00, 0x36, 0x00, 0x4a, 0x00, 0x5b, 0x00, 0x65, 0x00,
+  0x75, 0x00, 0x86, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x5f, 0x00, 0x70, 0x00,
+  0x81, 0x00, 0x8e, 0x00, 0x00, 0x00, 0x16, 0x00, 0x29, 0x00, 0x3e, 0x00,
+  0x00, 0x00, 0x16, 0x00, 0x27, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x32, 0x00,
+  0x46, 0x00, 0x5b, 0x00, 0x68, 0x00, 0x77, 0x00, 0x8d, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x29, 0x00, 0x3b, 0x00, 0x53, 0x00, 0x00, 0x00, 0x18, 0x00,
+  0x34, 0x00, 0x6a, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x15, 0x00, 0x28, 0x00,
+  0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x28, 0x00, 0x35, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x14, 0x00, 0x27, 0x00, 0x00, 0x00, 0x1f, 0x00,
+  0x33, 0x00, 0x47, 0x00, 0x5d, 0x00, 0x6e, 0x00, 0x81, 0x00, 0x92, 0x00,
+  0x00, 0x00, 0x1c, 0x00, 0x30, 0x00, 0x43, 0x00, 0x57, 0x00, 0x6e, 0x00,
+  0x7d, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x23, 0x00, 0x38, 0x00, 0x00, 0x00,
+  0x19, 0x00, 0x2f, 0x00, 0x3e, 0x00, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x21, 0x00, 0x36, 0x00, 0x4a, 0x00,
+  0x61, 0x00, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x28, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x29, 0x00,
+  0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00,
+  0x30, 0x00, 0x00, 0x00, 0x21, 0x00, 0x36, 0x00, 0x4b, 0x00, 0x00, 0x00,
+  0x15, 0x00, 0x26, 0x00, 0x00, 0x00, 0x18, 0x00, 0x2f, 0x00, 0x40, 0x00,
+  0x53, 0x00, 0x67, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x1a, 0x00, 0x2f, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x39, 0x00, 0x46, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x24, 0x00, 0x33, 0x00, 0x00, 0x00, 0x14, 0x00, 0x2f, 0x00,
+  0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x15, 0x00, 0x2a, 0x00, 0x41, 0x00,
+  0x00, 0x00, 0x11, 0x00, 0x2b, 0x00, 0x3b, 0x00, 0x4c, 0x00, 0x5e, 0x00,
+  0x6d, 0x00, 0x00, 0x00, 0x21, 0x00, 0x34, 0x00, 0x44, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x2e, 0x00, 0x3e, 0x00,
+  0x00, 0x00, 0x1b, 0x00, 0x36, 0x00, 0x45, 0x00, 0x56, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x1d, 0x00, 0x2a, 0x00, 0x3c, 0x00, 0x4f, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x17, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00,
+  0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x17, 0x00, 0x2b, 0x00, 0x37, 0x00,
+  0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x29, 0x00,
+  0x3b, 0x00, 0x00, 0x00, 0x14, 0x00, 0x29, 0x00, 0x3c, 0x00, 0x50, 0x00,
+  0x65, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00,
+  0x31, 0x00, 0x00, 0x00, 0x31, 0x00, 0x40, 0x00, 0x51, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x19, 0x00, 0x2f, 0x00, 0x42, 0x00, 0x52, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x23, 0x00, 0x3b, 0x00, 0x48, 0x00, 0x5e, 0x00,
+  0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x14, 0x00, 0x27, 0x00, 0x3a, 0x00,
+  0x4a, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x21, 0x00, 0x00, 0x00, 0x0d, 0x00,
+  0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x27, 0x00, 0x37, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x20, 0x00, 0x2f, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1b, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x30, 0x00,
+  0x47, 0x00, 0x57, 0x00, 0x67, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1a, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x31, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x21, 0x00, 0x33, 0x00, 0x48, 0x00, 0x00, 0x00,
+  0x23, 0x00, 0x34, 0x00, 0x41, 0x00, 0x00, 0x00, 0x19, 0x00, 0x25, 0x00,
+  0x38, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x1a, 0x00, 0x32, 0x00, 0x40, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x10, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x1b, 0x00, 0x28, 0x00, 0x36, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x20, 0x00, 0x33, 0x00, 0x41, 0x00, 0x57, 0x00,
+  0x00, 0x00, 0x14, 0x00, 0x25, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x23, 0x00, 0x00, 0x00, 0x10, 0x00, 0x21, 0x00, 0x00, 0x00, 0x12, 0x00,
+  0x25, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x25, 0x00, 0x3b, 0x00, 0x49, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x20, 0x00, 0x2f, 0x00,
+  0x3d, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x42, 0x00, 0x5c, 0x00, 0x00, 0x00,
+  0x15, 0x00, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x35, 0x00,
+  0x49, 0x00, 0x63, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x17, 0x00,
+  0x37, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x15, 0x00, 0x35, 0x00,
+  0x00, 0x00, 0x18, 0x00, 0x2e, 0x00, 0x44, 0x00, 0x57, 0x00, 0x6d, 0x00,
+  0x80, 0x00, 0x96, 0x00, 0xae, 0x00, 0xc3, 0x00, 0xde, 0x00, 0xf6, 0x00,
+  0x04, 0x01, 0x1b, 0x01, 0x30, 0x01, 0x42, 0x01, 0x59, 0x01, 0x6f, 0x01,
+  0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x16, 0x00, 0x24, 0x00, 0x32, 0x00,
+  0x41, 0x00, 0x00, 0x00, 0x29, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x26, 0x00,
+  0x3f, 0x00, 0x5f, 0x00, 0x70, 0x00, 0x7e, 0x00, 0x8e, 0x00, 0x9b, 0x00,
+  0xae, 0x00, 0xc6, 0x00, 0xd9, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x24, 0x00,
+  0x00, 0x00, 0x13, 0x00, 0x24, 0x00, 0x37, 0x00, 0x00, 0x00, 0x12, 0x00,
+  0x23, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x11, 0x00, 0x31, 0x00, 0x48, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x24, 0x00, 0x31, 0x00, 0x00, 0x00, 0x13, 0x00,
+  0x2d, 0x00, 0x3e, 0x00, 0x53, 0x00, 0x68, 0x00, 0x70, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x20, 0x00, 0x33, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x27, 0x00, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00,
+  0x23, 0x00, 0x3a, 0x00, 0x47, 0x00, 0x54, 0x00, 0x00, 0x00, 0x3a, 0x00,
+  0x4b, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x00, 0x64, 0x00,
+  0x76, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x45, 0x00, 0x6b, 0x00, 0x8b, 0x00,
+  0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x16, 0x00, 0x2a, 0x00, 0x3f, 0x00,
+  0x4c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x27, 0x00, 0x44, 0x00, 0x53, 0x00,
+  0x63, 0x00, 0x72, 0x00, 0x00, 0x00, 0x29, 0x00, 0x48, 0x00, 0x61, 0x00,
+  0x73, 0x00, 0x00, 0x00, 0x12, 0x00, 0x36, 0x00, 0x47, 0x00, 0x5a, 0x00,
+  0x00, 0x00, 0x14, 0x00, 0x26, 0x00, 0x00, 0x00, 0x12, 0x00, 0x2b, 0x00,
+  0x3b, 0x00, 0x00, 0x00, 0x24, 0x00, 0x39, 0x00, 0x6d, 0x00, 0x00, 0x00,
+  0x15, 0x00, 0x32, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x12, 0x00,
+  0x2d, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x2f, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x3b, 0x00, 0x4b, 0x00, 0x58, 0x00,
+  0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x1f, 0x00, 0x00, 0x00,
+  0x22, 0x00, 0x34, 0x00, 0x42, 0x00, 0x00, 0x00, 0x12, 0x00, 0x2a, 0x00,
+  0x41, 0x00, 0x58, 0x00, 0x00, 0x00, 0x12, 0x00, 0x25, 0x00, 0x32, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x32, 0x00, 0x52, 0x00, 0x7d, 0x00, 0xa3, 0x00,
+  0xba, 0x00, 0xd2, 0x00, 0xe3, 0x00, 0xf5, 0x00, 0x00, 0x00, 0x22, 0x00,
+  0x42, 0x00, 0x66, 0x00, 0x91, 0x00, 0xc4, 0x00, 0xe7, 0x00, 0xfd, 0x00,
+  0x13, 0x01, 0x00, 0x00, 0x1f, 0x00, 0x2d, 0x00, 0x4f, 0x00, 0x83, 0x00,
+  0x94, 0x00, 0xa5, 0x00, 0xbc, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x44, 0x00,
+  0x66, 0x00, 0x7d, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x30, 0x00, 0x47, 0x00,
+  0x82, 0x00, 0xad, 0x00, 0xc1, 0x00, 0xd8, 0x00, 0xe7, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x24, 0x00, 0x3f, 0x00, 0x6a, 0x00, 0x99, 0x00, 0xac, 0x00,
+  0x00, 0x00, 0x22, 0x00, 0x42, 0x00, 0x6a, 0x00, 0xa5, 0x00, 0xde, 0x00,
+  0xf0, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x38, 0x00, 0x4e, 0x00, 0x67, 0x00,
+  0xa3, 0x00, 0xb3, 0x00, 0xc4, 0x00, 0xd5, 0x00, 0x00, 0x00, 0x19, 0x00,
+  0x2d, 0x00, 0x49, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x20, 0x00, 0x36, 0x00,
+  0x4d, 0x00, 0x64, 0x00, 0x79, 0x00, 0x85, 0x00, 0x00, 0x00, 0x19, 0x00,
+  0x2f, 0x00, 0x46, 0x00, 0x59, 0x00, 0x68, 0x00, 0x00, 0x00, 0x26, 0x00,
+  0x34, 0x00, 0x55, 0x00, 0x6d, 0x00, 0x82, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x2e, 0x00, 0x5d, 0x00, 0x6e, 0x00, 0x81, 0x00, 0x00, 0x00,
+  0x15, 0x00, 0x31, 0x00, 0x76, 0x00, 0x9c, 0x00, 0xb3, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x27, 0x00, 0x3b, 0x00, 0x4f, 0x00, 0x00, 0x00, 0x1f, 0x00,
+  0x2d, 0x00, 0x6c, 0x00, 0x7a, 0x00, 0x91, 0x00, 0xa8, 0x00, 0x00, 0x00,
+  0x1e, 0x00, 0x2c, 0x00, 0x55, 0x00, 0x75, 0x00, 0x85, 0x00, 0x00, 0x00,
+  0x1d, 0x00, 0x3d, 0x00, 0x5e, 0x00, 0x7f, 0x00, 0x9a, 0x00, 0x00, 0x00,
+  0x51, 0x00, 0x61, 0x00, 0x83, 0x00, 0xa2, 0x00, 0xb9, 0x00, 0xd4, 0x00,
+  0x00, 0x00, 0x51, 0x00, 0x6a, 0x00, 0x8b, 0x00, 0xa7, 0x00, 0xb7, 0x00,
+  0xd1, 0x00, 0xe1, 0x00, 0x00, 0x00, 0x46, 0x00, 0x5a, 0x00, 0x75, 0x00,
+  0x8e, 0x00, 0xa0, 0x00, 0xe6, 0x00, 0x00, 0x00, 0x28, 0x00, 0x3a, 0x00,
+  0x50, 0x00, 0x74, 0x00, 0x90, 0x00, 0xb0, 0x00, 0x00, 0x00, 0x32, 0x00,
+  0x42, 0x00, 0x52, 0x00, 0x64, 0x00, 0xa1, 0x00, 0x00, 0x00, 0x3d, 0x00,
+  0x51, 0x00, 0x70, 0x00, 0x87, 0x00, 0xc0, 0x00, 0xd0, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x3a, 0x00, 0x63, 0x00, 0x73, 0x00, 0x98, 0x00, 0xd7, 0x00,
+  0xe9, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x27, 0x00, 0x44, 0x00, 0x54, 0x00,
+  0x8d, 0x00, 0xa6, 0x00, 0xbf, 0x00, 0x00, 0x00, 0x14, 0x00, 0x2b, 0x00,
+  0x3d, 0x00, 0x68, 0x00, 0x93, 0x00, 0xbf, 0x00, 0xcf, 0x00, 0xdd, 0x00,
+  0xee, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x10, 0x00, 0x29, 0x00, 0x4b, 0x00,
+  0x5d, 0x00, 0x76, 0x00, 0x00, 0x00, 0x4f, 0x00, 0x71, 0x00, 0x90, 0x00,
+  0xb0, 0x00, 0xd2, 0x00, 0xe2, 0x00, 0xf2, 0x00, 0x03, 0x01, 0x11, 0x01,
+  0x24, 0x01, 0x00, 0x00, 0x38, 0x00, 0x87, 0x00, 0xa9, 0x00, 0xc8, 0x00,
+  0xe5, 0x00, 0x02, 0x01, 0x16, 0x01, 0x2d, 0x01, 0x3b, 0x01, 0x00, 0x00,
+  0x0e, 0x00, 0x33, 0x00, 0x61, 0x00, 0x7f, 0x00, 0xb8, 0x00, 0xc6, 0x00,
+  0xd3, 0x00, 0x00, 0x00, 0x10, 0x00, 0x20, 0x00, 0x40, 0x00, 0x70, 0x00,
+  0x9b, 0x00, 0xac, 0x00, 0x00, 0x00, 0x17, 0x00, 0x27, 0x00, 0x49, 0x00,
+  0x59, 0x00, 0x7d, 0x00, 0x98, 0x00, 0xb2, 0x00, 0xc9, 0x00, 0xe2, 0x00,
+  0x01, 0x01, 0x19, 0x01, 0x00, 0x00, 0x17, 0x00, 0x29, 0x00, 0x37, 0x00,
+  0x47, 0x00, 0x59, 0x00, 0x70, 0x00, 0x97, 0x00, 0x00, 0x00, 0x2f, 0x00,
+  0x60, 0x00, 0x8f, 0x00, 0xb5, 0x00, 0xd7, 0x00, 0xf4, 0x00, 0x1a, 0x01,
+  0x35, 0x01, 0x49, 0x01, 0x85, 0x01, 0x95, 0x01, 0xa5, 0x01, 0xd4, 0x01,
+  0xf2, 0x01, 0x15, 0x02, 0x26, 0x02, 0x39, 0x02, 0x00, 0x00, 0x1b, 0x00,
+  0x4e, 0x00, 0x5e, 0x00, 0x77, 0x00, 0x95, 0x00, 0xb4, 0x00, 0xd3, 0x00,
+  0xec, 0x00, 0xff, 0x00, 0x00, 0x00, 0x33, 0x00, 0x68, 0x00, 0x9b, 0x00,
+  0xc5, 0x00, 0xeb, 0x00, 0x0a, 0x01, 0x32, 0x01, 0x49, 0x01, 0x67, 0x01,
+  0x83, 0x01, 0x91, 0x01, 0xb7, 0x01, 0xc9, 0x01, 0xe9, 0x01, 0xfe, 0x01,
+  0x00, 0x00, 0x32, 0x00, 0x4f, 0x00, 0x61, 0x00, 0x85, 0x00, 0x9e, 0x00,
+  0xbb, 0x00, 0xd0, 0x00, 0xe7, 0x00, 0x05, 0x01, 0x15, 0x01, 0x26, 0x01,
+  0x34, 0x01, 0x45, 0x01, 0x00, 0x00, 0x13, 0x00, 0x28, 0x00, 0x3f, 0x00,
+  0x4d, 0x00, 0x70, 0x00, 0x8c, 0x00, 0x9c, 0x00, 0xb8, 0x00, 0xd1, 0x00,
+  0x00, 0x00, 0x36, 0x00, 0x50, 0x00, 0x67, 0x00, 0x75, 0x00, 0x83, 0x00,
+  0x97, 0x00, 0xb2, 0x00, 0xe4, 0x00, 0xf6, 0x00, 0x04, 0x01, 0x15, 0x01,
+  0x25, 0x01, 0x00, 0x00, 0x24, 0x00, 0x40, 0x00, 0x54, 0x00, 0x72, 0x00,
+  0x91, 0x00, 0xb1, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x2e, 0x00, 0x3e, 0x00,
+  0x62, 0x00, 0x91, 0x00, 0xb1, 0x00, 0xc1, 0x00, 0x00, 0x00, 0x16, 0x00,
+  0x2f, 0x00, 0x3d, 0x00, 0x5b, 0x00, 0x77, 0x00, 0x9d, 0x00, 0x00, 0x00,
+  0x1b, 0x00, 0x29, 0x00, 0x3b, 0x00, 0x59, 0x00, 0x84, 0x00, 0x9d, 0x00,
+  0xc2, 0x00, 0xd2, 0x00, 0x00, 0x00, 0x22, 0x00, 0x32, 0x00, 0x44, 0x00,
+  0x54, 0x00, 0x70, 0x00, 0x8d, 0x00, 0xb5, 0x00, 0x00, 0x00, 0x1d, 0x00,
+  0x2d, 0x00, 0x42, 0x00, 0x6a, 0x00, 0x83, 0x00, 0xa1, 0x00, 0xb3, 0x00,
+  0xc4, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x30, 0x00, 0x46, 0x00, 0x5c, 0x00,
+  0x73, 0x00, 0x95, 0x00, 0x00, 0x00, 0x14, 0x00, 0x27, 0x00, 0x37, 0x00,
+  0x4b, 0x00, 0x7e, 0x00, 0x93, 0x00, 0xa3, 0x00, 0xb3, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x44, 0x00, 0x58, 0x00, 0x68, 0x00, 0x7c, 0x00, 0x8e, 0x00,
+  0xa4, 0x00, 0xbb, 0x00, 0xc9, 0x00, 0x00, 0x00, 0x10, 0x00, 0x45, 0x00,
+  0x5f, 0x00, 0x78, 0x00, 0xaa, 0x00, 0xd3, 0x00, 0xf8, 0x00, 0x0c, 0x01,
+  0x20, 0x01, 0x00, 0x00, 0x33, 0x00, 0x4c, 0x00, 0x60, 0x00, 0x6e, 0x00,
+  0x8d, 0x00, 0xa3, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x30, 0x00, 0x4d, 0x00,
+  0x69, 0x00, 0x79, 0x00, 0x92, 0x00, 0xb0, 0x00, 0xc6, 0x00, 0xd5, 0x00,
+  0x00, 0x00, 0x14, 0x00, 0x30, 0x00, 0x58, 0x00, 0x6f, 0x00, 0x8c, 0x00,
+  0x9e, 0x00, 0xd2, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x2b, 0x00, 0x49, 0x00,
+  0x71, 0x00, 0x85, 0x00, 0xaa, 0x00, 0xc3, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x4c, 0x00, 0x60, 0x00, 0x7c, 0x00, 0xa3, 0x00, 0xbc, 0x00, 0xf1, 0x00,
+  0x00, 0x00, 0x2d, 0x00, 0x4b, 0x00, 0x5b, 0x00, 0x6c, 0x00, 0x99, 0x00,
+  0xca, 0x00, 0xf5, 0x00, 0x12, 0x01, 0x2c, 0x01, 0x3a, 0x01, 0x00, 0x00,
+  0x10, 0x00, 0x20, 0x00, 0x3c, 0x00, 0x5e, 0x00, 0x7c, 0x00, 0x91, 0x00,
+  0x9e, 0x00, 0x00, 0x00, 0x13, 0x00, 0x31, 0x00, 0x55, 0x00, 0x6e, 0x00,
+  0x96, 0x00, 0xa4, 0x00, 0xcb, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x37, 0x00,
+  0x64, 0x00, 0x76, 0x00, 0x86, 0x00, 0xa1, 0x00, 0xbc, 0x00, 0xce, 0x00,
+  0xdb, 0x00, 0xeb, 0x00, 0x00, 0x00, 0x20, 0x00, 0x30, 0x00, 0x50, 0x00,
+  0x64, 0x00, 0x7d, 0x00, 0x8d, 0x00, 0x00, 0x00, 0x19, 0x00, 0x29, 0x00,
+  0x39, 0x00, 0x4b, 0x00, 0x64, 0x00, 0x86, 0x00, 0x9c, 0x00, 0xac, 0x00,
+  0xc2, 0x00, 0xde, 0x00, 0x00, 0x00, 0x17, 0x00, 0x27, 0x00, 0x37, 0x00,
+  0x49, 0x00, 0x59, 0x00, 0x7d, 0x00, 0x94, 0x00, 0x00, 0x00, 0x32, 0x00,
+  0x50, 0x00, 0x6e, 0x00, 0x82, 0x00, 0xaa, 0x00, 0xc5, 0x00, 0xd7, 0x00,
+  0xf5, 0x00, 0x12, 0x01, 0x26, 0x01, 0x00, 0x00, 0x33, 0x00, 0x4a, 0x00,
+  0x60, 0x00, 0x82, 0x00, 0x9e, 0x00, 0xba, 0x00, 0xd7, 0x00, 0xe7, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x33, 0x00, 0x58, 0x00, 0x66, 0x00, 0xaa, 0x00,
+  0xc8, 0x00, 0x05, 0x01, 0x25, 0x01, 0x36, 0x01, 0x44, 0x01, 0x00, 0x00,
+  0x1c, 0x00, 0x33, 0x00, 0x6e, 0x00, 0x7a, 0x00, 0x8a, 0x00, 0xc0, 0x00,
+  0x00, 0x00, 0x33, 0x00, 0x69, 0x00, 0xab, 0x00, 0xd3, 0x00, 0x15, 0x01,
+  0x4d, 0x01, 0x7c, 0x01, 0xb9, 0x01, 0xdd, 0x01, 0x10, 0x02, 0x2f, 0x02,
+  0x5b, 0x02, 0x7b, 0x02, 0x9d, 0x02, 0xb1, 0x02, 0xd1, 0x02, 0xe1, 0x02,
+  0xf4, 0x02, 0xfe, 0x02, 0x0d, 0x03, 0x00, 0x00, 0x1f, 0x00, 0x2f, 0x00,
+  0x5d, 0x00, 0x74, 0x00, 0x8d, 0x00, 0xa9, 0x00, 0x00, 0x00, 0x37, 0x00,
+  0x71, 0x00, 0xb7, 0x00, 0xe1, 0x00, 0x27, 0x01, 0x63, 0x01, 0x96, 0x01,
+  0xd7, 0x01, 0xff, 0x01, 0x34, 0x02, 0x5a, 0x02, 0x71, 0x02, 0x8a, 0x02,
+  0xaa, 0x02, 0xc3, 0x02, 0x00, 0x00, 0x29, 0x00, 0x4f, 0x00, 0x5d, 0x00,
+  0x78, 0x00, 0x88, 0x00, 0xa3, 0x00, 0xbf, 0x00, 0x00, 0x00, 0x26, 0x00,
+  0x38, 0x00, 0x75, 0x00, 0x89, 0x00, 0xa5, 0x00, 0x00, 0x00, 0x24, 0x00,
+  0x44, 0x00, 0x8a, 0x00, 0x9c, 0x00, 0xb9, 0x00, 0xd7, 0x00, 0x00, 0x00,
+  0x34, 0x00, 0x55, 0x00, 0x88, 0x00, 0xa5, 0x00, 0xb8, 0x00, 0xe1, 0x00,
+  0xf1, 0x00, 0x00, 0x00, 0x22, 0x00, 0x43, 0x00, 0x55, 0x00, 0x6c, 0x00,
+  0x81, 0x00, 0xa1, 0x00, 0xce, 0x00, 0xe0, 0x00, 0xf1, 0x00, 0xff, 0x00,
+  0x0f, 0x01, 0x1e, 0x01, 0x35, 0x01, 0x00, 0x00, 0x21, 0x00, 0x56, 0x00,
+  0x6f, 0x00, 0x94, 0x00, 0xca, 0x00, 0xdc, 0x00, 0xec, 0x00, 0x02, 0x01,
+  0x1a, 0x01, 0x2b, 0x01, 0x00, 0x00, 0x1f, 0x00, 0x52, 0x00, 0x75, 0x00,
+  0x8a, 0x00, 0xb7, 0x00, 0xc7, 0x00, 0xeb, 0x00, 0x00, 0x00, 0x21, 0x00,
+  0x59, 0x00, 0x69, 0x00, 0x82, 0x00, 0x90, 0x00, 0xae, 0x00, 0xbe, 0x00,
+  0xd0, 0x00, 0xe1, 0x00, 0x00, 0x00, 0x21, 0x00, 0x42, 0x00, 0x55, 0x00,
+  0x77, 0x00, 0xa6, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x3e, 0x00,
+  0x5b, 0x00, 0x79, 0x00, 0x94, 0x00, 0xaf, 0x00, 0xc1, 0x00, 0xe2, 0x00,
+  0xf6, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x57, 0x00, 0x73, 0x00, 0x93, 0x00,
+  0xae, 0x00, 0xcc, 0x00, 0xea, 0x00, 0x01, 0x01, 0x00, 0x00, 0x2e, 0x00,
+  0x83, 0x00, 0xa1, 0x00, 0xb3, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x70, 0x00,
+  0x8c, 0x00, 0xa5, 0x00, 0xc9, 0x00, 0xdd, 0x00, 0xf9, 0x00, 0x00, 0x00,
+  0x3b, 0x00, 0x79, 0x00, 0xab, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x38, 0x00,
+  0x5f, 0x00, 0xa9, 0x00, 0xd7, 0x00, 0xfb, 0x00, 0x19, 0x01, 0x00, 0x00,
+  0x1b, 0x00, 0x4a, 0x00, 0x5f, 0x00, 0x6f, 0x00, 0x8f, 0x00, 0xb1, 0x00,
+  0xc9, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x7b, 0x00, 0xa2, 0x00, 0xbf, 0x00,
+  0xd8, 0x00, 0xf8, 0x00, 0x0a, 0x01, 0x25, 0x01, 0x39, 0x01, 0x47, 0x01,
+  0x00, 0x00, 0x26, 0x00, 0x7b, 0x00, 0x96, 0x00, 0xb7, 0x00, 0xc3, 0x00,
+  0xe2, 0x00, 0x02, 0x01, 0x0f, 0x01, 0x00, 0x00, 0x20, 0x00, 0x50, 0x00,
+  0xab, 0x00, 0xc1, 0x00, 0xe8, 0x00, 0x03, 0x01, 0x1f, 0x01, 0x3f, 0x01,
+  0x00, 0x00, 0x19, 0x00, 0x3a, 0x00, 0x55, 0x00, 0x7b, 0x00, 0x8f, 0x00,
+  0xae, 0x00, 0xc7, 0x00, 0xe5, 0x00, 0x00, 0x00, 0x31, 0x00, 0x51, 0x00,
+  0x5d, 0x00, 0x83, 0x00, 0x9e, 0x00, 0xdc, 0x00, 0xfe, 0x00, 0x20, 0x01,
+  0x33, 0x01, 0x51, 0x01, 0x64, 0x01, 0x77, 0x01, 0x00, 0x00, 0x30, 0x00,
+  0x4e, 0x00, 0x72, 0x00, 0x8b, 0x00, 0xa6, 0x00, 0xc6, 0x00, 0xe8, 0x00,
+  0xff, 0x00, 0x0a, 0x01, 0x00, 0x00, 0x2c, 0x00, 0x54, 0x00, 0x6d, 0x00,
+  0x7f, 0x00, 0x9f, 0x00, 0xbf, 0x00, 0x00, 0x00, 0x20, 0x00, 0x48, 0x00,
+  0x5f, 0x00, 0x71, 0x00, 0x8c, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x1e, 0x00,
+  0x48, 0x00, 0x86, 0x00, 0xa3, 0x00, 0xbc, 0x00, 0xe0, 0x00, 0xee, 0x00,
+  0xfd, 0x00, 0x0a, 0x01, 0x1e, 0x01, 0x32, 0x01, 0x43, 0x01, 0x00, 0x00,
+  0x20, 0x00, 0x33, 0x00, 0x57, 0x00, 0x6e, 0x00, 0x94, 0x00, 0xad, 0x00,
+  0xc7, 0x00, 0xd8, 0x00, 0xe6, 0x00, 0x00, 0x00, 0x33, 0x00, 0x4a, 0x00,
+  0x6e, 0x00, 0x83, 0x00, 0xa5, 0x00, 0xc2, 0x00, 0xe2, 0x00, 0xf5, 0x00,
+  0x00, 0x00, 0x20, 0x00, 0x37, 0x00, 0x66, 0x00, 0x88, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x35, 0x00, 0x55, 0x00, 0x77, 0x00, 0x84, 0x00, 0x00, 0x00,
+  0x1b, 0x00, 0x44, 0x00, 0x5f, 0x00, 0x7b, 0x00, 0xa1, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x36, 0x00, 0x5e, 0x00, 0x7c, 0x00, 0xbd, 0x00, 0xd7, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x22, 0x00, 0x44, 0x00, 0x68, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x2c, 0x00, 0x4c, 0x00, 0x70, 0x00, 0x83, 0x00, 0x00, 0x00,
+  0x1b, 0x00, 0x59, 0x00, 0x7b, 0x00, 0xa1, 0x00, 0x00, 0x00, 0x27, 0x00,
+  0x49, 0x00, 0x70, 0x00, 0x85, 0x00, 0x9e, 0x00, 0xb2, 0x00, 0xc5, 0x00,
+  0xd5, 0x00, 0xe8, 0x00, 0x01, 0x01, 0x1b, 0x01, 0x32, 0x01, 0x00, 0x00,
+  0x12, 0x00, 0x5c, 0x00, 0x73, 0x00, 0x85, 0x00, 0x97, 0x00, 0xbb, 0x00,
+  0xd7, 0x00, 0xf1, 0x00, 0x04, 0x01, 0x00, 0x00, 0x23, 0x00, 0x67, 0x00,
+  0x83, 0x00, 0x91, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x40, 0x00, 0x50, 0x00,
+  0x6c, 0x00, 0x9a, 0x00, 0xab, 0x00, 0x00, 0x00, 0x20, 0x00, 0x55, 0x00,
+  0x77, 0x00, 0x8b, 0x00, 0xab, 0x00, 0xb9, 0x00, 0xc9, 0x00, 0x00, 0x00,
+  0x33, 0x00, 0x43, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x41, 0x00, 0x5a, 0x00,
+  0x73, 0x00, 0x8c, 0x00, 0xa0, 0x00, 0xad, 0x00, 0xd1, 0x00, 0x00, 0x00,
+  0x26, 0x00, 0x71, 0x00, 0x83, 0x00, 0x9c, 0x00, 0xb1, 0x00, 0xc0, 0x00,
+  0xcf, 0x00, 0xdf, 0x00, 0x00, 0x00, 0x20, 0x00, 0x40, 0x00, 0x7e, 0x00,
+  0x9c, 0x00, 0xb3, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x19, 0x00, 0x36, 0x00,
+  0x53, 0x00, 0x66, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x19, 0x00, 0x39, 0x00,
+  0x57, 0x00, 0x6e, 0x00, 0x87, 0x00, 0xa0, 0x00, 0xbb, 0x00, 0xcc, 0x00,
+  0xde, 0x00, 0x00, 0x00, 0x29, 0x00, 0x41, 0x00, 0x5d, 0x00, 0x7c, 0x00,
+  0x93, 0x00, 0xa4, 0x00, 0xb4, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x3d, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x30, 0x00, 0x42, 0x00, 0x53, 0x00, 0x00, 0x00,
+  0x22, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x50, 0x00, 0x82, 0x00,
+  0x9f, 0x00, 0xc3, 0x00, 0xe2, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x65, 0x00,
+  0x99, 0x00, 0xb4, 0x00, 0xc1, 0x00, 0xc9, 0x00, 0x00, 0x00, 0x17, 0x00,
+  0x3b, 0x00, 0x6b, 0x00, 0x9f, 0x00, 0xb9, 0x00, 0x00, 0x00, 0x1d, 0x00,
+  0x2d, 0x00, 0x71, 0x00, 0xa5, 0x00, 0xb3, 0x00, 0xbd, 0x00, 0x00, 0x00,
+  0x1e, 0x00, 0x32, 0x00, 0x7e, 0x00, 0xa2, 0x00, 0xb9, 0x00, 0xcd, 0x00,
+  0xe7, 0x00, 0xfd, 0x00, 0x1e, 0x01, 0x3b, 0x01, 0x58, 0x01, 0x75, 0x01,
+  0x92, 0x01, 0xaf, 0x01, 0xcc, 0x01, 0xf0, 0x01, 0xfe, 0x01, 0x00, 0x00,
+  0x25, 0x00, 0x3e, 0x00, 0x55, 0x00, 0x7d, 0x00, 0x8f, 0x00, 0xb7, 0x00,
+  0xc5, 0x00, 0xce, 0x00, 0x00, 0x00, 0x17, 0x00, 0x34, 0x00, 0x41, 0x00,
+  0x00, 0x00, 0x17, 0x00, 0x32, 0x00, 0x44, 0x00, 0x54, 0x00, 0x65, 0x00,
+  0x00, 0x00, 0x1c, 0x00, 0x72, 0x00, 0x8e, 0x00, 0x9d, 0x00, 0xb2, 0x00,
+  0xc3, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x4b, 0x00, 0x67, 0x00, 0x77, 0x00,
+  0x00, 0x00, 0x2d, 0x00, 0x51, 0x00, 0x7c, 0x00, 0x8c, 0x00, 0x00, 0x00,
+  0x19, 0x00, 0x39, 0x00, 0x4a, 0x00, 0x5f, 0x00, 0x73, 0x00, 0x85, 0x00,
+  0x00, 0x00, 0x26, 0x00, 0x46, 0x00, 0x6d, 0x00, 0x80, 0x00, 0x90, 0x00,
+  0x00, 0x00, 0x20, 0x00, 0x66, 0x00, 0x00, 0x00, 0x12, 0x00, 0x3b, 0x00,
+  0x4b, 0x00, 0x59, 0x00, 0x00, 0x00, 0x26, 0x00, 0x4f, 0x00, 0x63, 0x00,
+  0x70, 0x00, 0x00, 0x00, 0x24, 0x00, 0x41, 0x00, 0x00, 0x00, 0x27, 0x00,
+  0x49, 0x00, 0x69, 0x00, 0x00, 0x00, 0x15, 0x00, 0x35, 0x00, 0x55, 0x00,
+  0x65, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x35, 0x00, 0x54, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x2d, 0x00, 0x51, 0x00, 0x68, 0x00, 0x7d, 0x00, 0x8e, 0x00,
+  0xa6, 0x00, 0xb4, 0x00, 0x00, 0x00, 0x19, 0x00, 0x32, 0x00, 0x4b, 0x00,
+  0x64, 0x00, 0x7d, 0x00, 0x96, 0x00, 0xaf, 0x00, 0xc8, 0x00, 0xe1, 0x00,
+  0x05, 0x01, 0x23, 0x01, 0x40, 0x01, 0x4d, 0x01, 0x5d, 0x01, 0x6c, 0x01,
+  0x00, 0x00, 0x1b, 0x00, 0x44, 0x00, 0x52, 0x00, 0x62, 0x00, 0x70, 0x00,
+  0x85, 0x00, 0x00, 0x00, 0x21, 0x00, 0x4a, 0x00, 0x00, 0x00, 0x17, 0x00,
+  0x2e, 0x00, 0x5a, 0x00, 0x76, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x2f, 0x00,
+  0x51, 0x00, 0x7a, 0x00, 0x96, 0x00, 0xae, 0x00, 0x00, 0x00, 0x23, 0x00,
+  0x35, 0x00, 0x00, 0x00, 0x14, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x26, 0x00,
+  0x45, 0x00, 0x6c, 0x00, 0x79, 0x00, 0x90, 0x00, 0xa1, 0x00, 0x00, 0x00,
+  0x19, 0x00, 0x37, 0x00, 0x47, 0x00, 0x5b, 0x00, 0x76, 0x00, 0x00, 0x00,
+  0x2d, 0x00, 0x3f, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00,
+  0x38, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x2d, 0x00, 0x3d, 0x00, 0x4c, 0x00,
+  0x00, 0x00, 0x24, 0x00, 0x36, 0x00, 0x96, 0x00, 0xa9, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x57, 0x00, 0x00, 0x00,
+  0x16, 0x00, 0x3d, 0x00, 0x95, 0x00, 0xab, 0x00, 0xc2, 0x00, 0xd3, 0x00,
+  0xe2, 0x00, 0x00, 0x00, 0x17, 0x00, 0x42, 0x00, 0x6e, 0x00, 0x84, 0x00,
+  0x91, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x4b, 0x00, 0x73, 0x00, 0x88, 0x00,
+  0x98, 0x00, 0xac, 0x00, 0x00, 0x00, 0x24, 0x00, 0x49, 0x00, 0x99, 0x00,
+  0xac, 0x00, 0x00, 0x00, 0x17, 0x00, 0x32, 0x00, 0x71, 0x00, 0x88, 0x00,
+  0x9e, 0x00, 0xb1, 0x00, 0xcd, 0x00, 0xde, 0x00, 0xf3, 0x00, 0xfd, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x17, 0x00, 0x2e, 0x00, 0x3e, 0x00,
+  0x4f, 0x00, 0x60, 0x00, 0x74, 0x00, 0x80, 0x00, 0x92, 0x00, 0xa5, 0x00,
+  0xb6, 0x00, 0xc3, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x26, 0x00, 0x3c, 0x00,
+  0x46, 0x00, 0x5d, 0x00, 0x6b, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x2d, 0x00,
+  0x48, 0x00, 0x60, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1b, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x20, 0x00, 0x00, 0x00, 0x19, 0x00, 0x2f, 0x00, 0x3b, 0x00,
+  0x4d, 0x00, 0x58, 0x00, 0x00, 0x00, 0x13, 0x00, 0x23, 0x00, 0x00, 0x00,
+  0x17, 0x00, 0x28, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x53, 0x00, 0x64, 0x00,
+  0x7e, 0x00, 0x97, 0x00, 0xa5, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x3f, 0x00,
+  0x51, 0x00, 0x61, 0x00, 0x6a, 0x00, 0x00, 0x00, 0x19, 0x00, 0x32, 0x00,
+  0x4b, 0x00, 0x64, 0x00, 0x92, 0x00, 0xa0, 0x00, 0xae, 0x00, 0xc5, 0x00,
+  0xd5, 0x00, 0xe7, 0x00, 0xf1, 0x00, 0x00, 0x00, 0x10, 0x00, 0x23, 0x00,
+  0x30, 0x00, 0x00, 0x00, 0x15, 0x00, 0x24, 0x00, 0x39, 0x00, 0x41, 0x00,
+  0x00, 0x00, 0x19, 0x00, 0x2f, 0x00, 0x44, 0x00, 0x00, 0x00, 0x21, 0x00,
+  0x37, 0x00, 0x4e, 0x00, 0x61, 0x00, 0x75, 0x00, 0x84, 0x00, 0x00, 0x00,
+  0x31, 0x00, 0x43, 0x00, 0x00, 0x00, 0x26, 0x00, 0x3e, 0x00, 0x4c, 0x00,
+  0x00, 0x00, 0x1b, 0x00, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00,
+  0x2e, 0x00, 0x51, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x26, 0x00, 0x3d, 0x00,
+  0x00, 0x00, 0x11, 0x00, 0x2f, 0x00, 0x49, 0x00, 0x60, 0x00, 0x7a, 0x00,
+  0x89, 0x00, 0x97, 0x00, 0x00, 0x00, 0x22, 0x00, 0x5c, 0x00, 0x77, 0x00,
+  0x87, 0x00, 0x97, 0x00, 0x00, 0x00, 0x28, 0x00, 0x4c, 0x00, 0x5b, 0x00,
+  0x00, 0x00, 0x24, 0x00, 0x58, 0x00, 0x83, 0x00, 0x8f, 0x00, 0x98, 0x00,
+  0x00, 0x00, 0x28, 0x00, 0x4a, 0x00, 0x58, 0x00, 0x6a, 0x00, 0x00, 0x00,
+  0x2f, 0x00, 0x5e, 0x00, 0x84, 0x00, 0x96, 0x00, 0xa4, 0x00, 0xb4, 0x00,
+  0xc1, 0x00, 0xcf, 0x00, 0xd8, 0x00, 0xe4, 0x00, 0x00, 0x00, 0x20, 0x00,
+  0x46, 0x00, 0x5f, 0x00, 0x75, 0x00, 0x8b, 0x00, 0xa1, 0x00, 0x00, 0x00,
+  0x1e, 0x00, 0x48, 0x00, 0x5b, 0x00, 0x6b, 0x00, 0x7e, 0x00, 0x8d, 0x00,
+  0x9a, 0x00, 0xa1, 0x00, 0x00, 0x00, 0x15, 0x00, 0x21, 0x00, 0x2c, 0x00,
+  0x00, 0x00, 0x42, 0x00, 0x64, 0x00, 0x72, 0x00, 0x86, 0x00, 0x97, 0x00,
+  0xa6, 0x00, 0x00, 0x00, 0x25, 0x00, 0x50, 0x00, 0x70, 0x00, 0x80, 0x00,
+  0x9e, 0x00, 0xc1, 0x00, 0xdc, 0x00, 0xee, 0x00, 0xfb, 0x00, 0x00, 0x00,
+  0x4b, 0x00, 0x73, 0x00, 0x97, 0x00, 0xa7, 0x00, 0xb7, 0x00, 0xe1, 0x00,
+  0xf9, 0x00, 0x10, 0x01, 0x24, 0x01, 0x00, 0x00, 0x24, 0x00, 0x48, 0x00,
+  0x64, 0x00, 0x88, 0x00, 0xb8, 0x00, 0xd7, 0x00, 0xea, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x40, 0x00, 0x67, 0x00, 0x78, 0x00, 0x89, 0x00, 0x9d, 0x00,
+  0xb2, 0x00, 0xc2, 0x00, 0xd6, 0x00, 0xe1, 0x00, 0x00, 0x00, 0x39, 0x00,
+  0x4d, 0x00, 0x5f, 0x00, 0x7f, 0x00, 0x97, 0x00, 0x00, 0x00, 0x1e, 0x00,
+  0x2c, 0x00, 0x43, 0x00, 0x5e, 0x00, 0x71, 0x00, 0x7f, 0x00, 0x96, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x29, 0x00, 0x57, 0x00, 0x68, 0x00, 0x79, 0x00,
+  0x8d, 0x00, 0x00, 0x00, 0x26, 0x00, 0x3f, 0x00, 0x5a, 0x00, 0x6e, 0x00,
+  0x00, 0x00, 0x27, 0x00, 0x3a, 0x00, 0x4f, 0x00, 0x5f, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x20, 0x00, 0x32, 0x00, 0x00, 0x00, 0x22, 0x00, 0x35, 0x00,
+  0x4e, 0x00, 0x61, 0x00, 0x77, 0x00, 0x88, 0x00, 0x00, 0x00, 0x2e, 0x00,
+  0x4c, 0x00, 0x6c, 0x00, 0x7a, 0x00, 0x8a, 0x00, 0x9c, 0x00, 0xb0, 0x00,
+  0x00, 0x00, 0x17, 0x00, 0x2b, 0x00, 0x37, 0x00, 0x4c, 0x00, 0x54, 0x00,
+  0x00, 0x00, 0x22, 0x00, 0x42, 0x00, 0x58, 0x00, 0x6e, 0x00, 0x7e, 0x00,
+  0x8f, 0x00, 0xa0, 0x00, 0xb0, 0x00, 0xc3, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x2a, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x25, 0x00, 0x00, 0x00,
+  0x17, 0x00, 0x29, 0x00, 0x49, 0x00, 0x7d, 0x00, 0x91, 0x00, 0x00, 0x00,
+  0x22, 0x00, 0x30, 0x00, 0x42, 0x00, 0x56, 0x00, 0x00, 0x00, 0x14, 0x00,
+  0x2b, 0x00, 0x49, 0x00, 0x62, 0x00, 0x75, 0x00, 0x89, 0x00, 0x00, 0x00,
+  0x22, 0x00, 0x52, 0x00, 0x66, 0x00, 0x92, 0x00, 0xc9, 0x00, 0xe5, 0x00,
+  0x00, 0x00, 0x20, 0x00, 0x39, 0x00, 0x49, 0x00, 0x59, 0x00, 0x83, 0x00,
+  0x96, 0x00, 0xad, 0x00, 0x00, 0x00, 0x29, 0x00, 0x57, 0x00, 0x63, 0x00,
+  0x78, 0x00, 0x96, 0x00, 0xb8, 0x00, 0x00, 0x00, 0x22, 0x00, 0x42, 0x00,
+  0x6d, 0x00, 0x7d, 0x00, 0x8f, 0x00, 0x9b, 0x00, 0xbf, 0x00, 0x00, 0x00,
+  0x2b, 0x00, 0x4f, 0x00, 0x7c, 0x00, 0xb1, 0x00, 0xd3, 0x00, 0xe8, 0x00,
+  0x11, 0x01, 0x35, 0x01, 0x4f, 0x01, 0x00, 0x00, 0x2b, 0x00, 0x63, 0x00,
+  0x7e, 0x00, 0x8e, 0x00, 0xae, 0x00, 0xd5, 0x00, 0xe6, 0x00, 0x00, 0x00,
+  0x26, 0x00, 0x48, 0x00, 0x68, 0x00, 0x76, 0x00, 0x96, 0x00, 0xb1, 0x00,
+  0x00, 0x00, 0x24, 0x00, 0x53, 0x00, 0x63, 0x00, 0x71, 0x00, 0x8f, 0x00,
+  0xb6, 0x00, 0xca, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x56, 0x00, 0x86, 0x00,
+  0x96, 0x00, 0xb8, 0x00, 0xe8, 0x00, 0xfe, 0x00, 0x1d, 0x01, 0x2c, 0x01,
+  0x39, 0x01, 0x45, 0x01, 0x51, 0x01, 0x60, 0x01, 0x00, 0x00, 0x2f, 0x00,
+  0x51, 0x00, 0x71, 0x00, 0x9a, 0x00, 0xba, 0x00, 0xcc, 0x00, 0xdc, 0x00,
+  0x06, 0x01, 0x1d, 0x01, 0x2f, 0x01, 0x3c, 0x01, 0x49, 0x01, 0x00, 0x00,
+  0x3f, 0x00, 0x5d, 0x00, 0x8c, 0x00, 0xc8, 0x00, 0xdc, 0x00, 0xf5, 0x00,
+  0x1f, 0x01, 0x00, 0x00, 0x22, 0x00, 0x48, 0x00, 0x77, 0x00, 0xa7, 0x00,
+  0xbb, 0x00, 0xcd, 0x00, 0xe8, 0x00, 0xf6, 0x00, 0x06, 0x01, 0x17, 0x01,
+  0x24, 0x01, 0x00, 0x00, 0x24, 0x00, 0x59, 0x00, 0x7d, 0x00, 0x9f, 0x00,
+  0xad, 0x00, 0xcb, 0x00, 0xf2, 0x00, 0x04, 0x01, 0x14, 0x01, 0x22, 0x01,
+  0x3e, 0x01, 0x4a, 0x01, 0x5a, 0x01, 0x6e, 0x01, 0x00, 0x00, 0x2b, 0x00,
+  0x51, 0x00, 0x6d, 0x00, 0x89, 0x00, 0xa0, 0x00, 0xb2, 0x00, 0xc6, 0x00,
+  0xdb, 0x00, 0xe9, 0x00, 0x00, 0x00, 0x4a, 0x00, 0x6c, 0x00, 0x90, 0x00,
+  0xb2, 0x00, 0xcb, 0x00, 0xe0, 0x00, 0xfb, 0x00, 0x30, 0x01, 0x43, 0x01,
+  0x57, 0x01, 0x77, 0x01, 0x8e, 0x01, 0xa0, 0x01, 0x00, 0x00, 0x27, 0x00,
+  0x43, 0x00, 0x55, 0x00, 0x63, 0x00, 0x7e, 0x00, 0x94, 0x00, 0xa8, 0x00,
+  0x00, 0x00, 0x32, 0x00, 0x54, 0x00, 0x7d, 0x00, 0x8f, 0x00, 0xa3, 0x00,
+  0xbe, 0x00, 0xd2, 0x00, 0xec, 0x00, 0x00, 0x01, 0x15, 0x01, 0x00, 0x00,
+  0x26, 0x00, 0x4a, 0x00, 0x74, 0x00, 0x8f, 0x00, 0xae, 0x00, 0xbd, 0x00,
+  0x00, 0x00, 0x26, 0x00, 0x3c, 0x00, 0x57, 0x00, 0x70, 0x00, 0x7f, 0x00,
+  0x94, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x48, 0x00, 0x58, 0x00, 0x7a, 0x00,
+  0x00, 0x00, 0x20, 0x00, 0x38, 0x00, 0x68, 0x00, 0x7c, 0x00, 0x90, 0x00,
+  0xa9, 0x00, 0xb6, 0x00, 0x00, 0x00, 0x14, 0x00, 0x33, 0x00, 0x6e, 0x00,
+  0xb4, 0x00, 0xd5, 0x00, 0xe7, 0x00, 0xfc, 0x00, 0x09, 0x01, 0x16, 0x01,
+  0x2a, 0x01, 0x00, 0x00, 0x20, 0x00, 0x46, 0x00, 0x5b, 0x00, 0x69, 0x00,
+  0x90, 0x00, 0xa6, 0x00, 0xb3, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x3c, 0x00,
+  0x5e, 0x00, 0x77, 0x00, 0x87, 0x00, 0xa0, 0x00, 0xb3, 0x00, 0xc3, 0x00,
+  0x00, 0x00, 0x33, 0x00, 0x58, 0x00, 0x85, 0x00, 0x95, 0x00, 0xa9, 0x00,
+  0xe6, 0x00, 0x1c, 0x01, 0x2c, 0x01, 0x3c, 0x01, 0x48, 0x01, 0x56, 0x01,
+  0x72, 0x01, 0x00, 0x00, 0x2b, 0x00, 0x51, 0x00, 0x6a, 0x00, 0x7a, 0x00,
+  0x91, 0x00, 0xa5, 0x00, 0x00, 0x00, 0x20, 0x00, 0x42, 0x00, 0x80, 0x00,
+  0x94, 0x00, 0xa8, 0x00, 0xbf, 0x00, 0xdd, 0x00, 0xed, 0x00, 0x01, 0x01,
+  0x16, 0x01, 0x00, 0x00, 0x0e, 0x00, 0x20, 0x00, 0x37, 0x00, 0x6c, 0x00,
+  0x7b, 0x00, 0x8b, 0x00, 0x00, 0x00, 0x14, 0x00, 0x24, 0x00, 0x4f, 0x00,
+  0x81, 0x00, 0x90, 0x00, 0xa5, 0x00, 0xba, 0x00, 0xd1, 0x00, 0x00, 0x00,
+  0x19, 0x00, 0x30, 0x00, 0x4c, 0x00, 0x66, 0x00, 0x7d, 0x00, 0x8f, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x22, 0x00, 0x00, 0x00, 0x12, 0x00, 0x35, 0x00,
+  0x4e, 0x00, 0x69, 0x00, 0x7c, 0x00, 0x91, 0x00, 0xa6, 0x00, 0x00, 0x00,
+  0x1f, 0x00, 0x34, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x3a, 0x00, 0x65, 0x00,
+  0x75, 0x00, 0x8b, 0x00, 0x00, 0x00, 0x23, 0x00, 0x45, 0x00, 0x55, 0x00,
+  0x00, 0x00, 0x20, 0x00, 0x32, 0x00, 0x42, 0x00, 0x00, 0x00, 0x24, 0x00,
+  0x34, 0x00, 0x42, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x1e, 0x00,
+  0x40, 0x00, 0x56, 0x00, 0x00, 0x00, 0x27, 0x00, 0x37, 0x00, 0x52, 0x00,
+  0x00, 0x00, 0x17, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x20, 0x00, 0x42, 0x00,
+  0x5f, 0x00, 0x75, 0x00, 0x8c, 0x00, 0x00, 0x00, 0x39, 0x00, 0x54, 0x00,
+  0x6b, 0x00, 0x7b, 0x00, 0x00, 0x00, 0x20, 0x00, 0x32, 0x00, 0x4b, 0x00,
+  0x5a, 0x00, 0x6a, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x47, 0x00, 0x6b, 0x00,
+  0x89, 0x00, 0x9d, 0x00, 0xb9, 0x00, 0xc3, 0x00, 0xd4, 0x00, 0xec, 0x00,
+  0xfd, 0x00, 0x12, 0x01, 0x00, 0x00, 0x24, 0x00, 0x36, 0x00, 0x53, 0x00,
+  0x65, 0x00, 0x72, 0x00, 0x00, 0x00, 0x24, 0x00, 0x50, 0x00, 0x72, 0x00,
+  0x84, 0x00, 0x97, 0x00, 0xad, 0x00, 0xba, 0x00, 0xc6, 0x00, 0xdc, 0x00,
+  0x00, 0x00, 0x2f, 0x00, 0x42, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x41, 0x00,
+  0x5b, 0x00, 0x00, 0x00, 0x20, 0x00, 0x42, 0x00, 0x53, 0x00, 0x67, 0x00,
+  0x7f, 0x00, 0x9a, 0x00, 0x00, 0x00, 0x20, 0x00, 0x3e, 0x00, 0x62, 0x00,
+  0x72, 0x00, 0x89, 0x00, 0x9d, 0x00, 0xae, 0x00, 0x00, 0x00, 0x2b, 0x00,
+  0x00, 0x00, 0x25, 0x00, 0x4b, 0x00, 0x71, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x25, 0x00, 0x52, 0x00, 0x65, 0x00, 0x78, 0x00, 0x84, 0x00, 0x00, 0x00,
+  0x1e, 0x00, 0x3e, 0x00, 0x54, 0x00, 0x00, 0x00, 0x29, 0x00, 0x4b, 0x00,
+  0x60, 0x00, 0x76, 0x00, 0x92, 0x00, 0xa2, 0x00, 0xb4, 0x00, 0xc5, 0x00,
+  0x00, 0x00, 0x57, 0x00, 0x79, 0x00, 0x90, 0x00, 0xa3, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x1d, 0x00,
+  0x37, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x33, 0x00, 0x00, 0x00, 0x17, 0x00,
+  0x2d, 0x00, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x35, 0x00,
+  0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x12, 0x00,
+  0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x20, 0x00,
+  0x44, 0x00, 0x00, 0x00, 0x10, 0x00, 0x22, 0x00, 0x00, 0x00, 0x17, 0x00,
+  0x2b, 0x00, 0x3b, 0x00, 0x48, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x23, 0x00, 0x33, 0x00, 0x4a, 0x00, 0x00, 0x00, 0x13, 0x00,
+  0x23, 0x00, 0x30, 0x00, 0x41, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00,
+  0x17, 0x00, 0x27, 0x00, 0x00, 0x00, 0x11, 0x00, 0x27, 0x00, 0x41, 0x00,
+  0x5d, 0x00, 0x72, 0x00, 0x00, 0x00, 0x10, 0x00, 0x21, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x2c, 0x00, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x00, 0x00, 0x15, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x32, 0x00,
+  0x45, 0x00, 0x5c, 0x00, 0x6f, 0x00, 0x81, 0x00, 0x93, 0x00, 0xa9, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x15, 0x00, 0x2c, 0x00, 0x42, 0x00,
+  0x52, 0x00, 0x72, 0x00, 0x89, 0x00, 0xa2, 0x00, 0xb2, 0x00, 0xc9, 0x00,
+  0xd6, 0x00, 0xeb, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x2d, 0x00, 0x3a, 0x00,
+  0x00, 0x00, 0x13, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x2e, 0x00, 0x48, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x22, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x1d, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x27, 0x00, 0x37, 0x00, 0x48, 0x00, 0x00, 0x00, 0x13, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x14, 0x00, 0x27, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x25, 0x00, 0x3c, 0x00, 0x53, 0x00, 0x61, 0x00,
+  0x78, 0x00, 0x8e, 0x00, 0x00, 0x00, 0x10, 0x00, 0x1d, 0x00, 0x2a, 0x00,
+  0x00, 0x00, 0x43, 0x00, 0x51, 0x00, 0x64, 0x00, 0x84, 0x00, 0x9b, 0x00,
+  0xb2, 0x00, 0xc7, 0x00, 0xdb, 0x00, 0xef, 0x00, 0xfc, 0x00, 0x0e, 0x01,
+  0x1f, 0x01, 0x2f, 0x01, 0x42, 0x01, 0x00, 0x00, 0x41, 0x00, 0x58, 0x00,
+  0x6c, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x49, 0x00, 0x90, 0x00,
+  0xd5, 0x00, 0x1c, 0x01, 0x2d, 0x01, 0x3e, 0x01, 0x5b, 0x01, 0x6d, 0x01,
+  0x00, 0x00, 0x49, 0x00, 0x92, 0x00, 0xd9, 0x00, 0x20, 0x01, 0x65, 0x01,
+  0xac, 0x01, 0xc0, 0x01, 0xce, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x00, 0x00
+};
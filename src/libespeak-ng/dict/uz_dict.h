@@ -1,5 +1,7 @@
 #pragma once
-const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
+#include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/uz_dict_index.h>
+const unsigned char __espeakng_dict_uz[] __attribute__((aligned((4)))) = {
   0x00, 0x04, 0x00, 0x00, 0x40, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
   0xc3, 0x34, 0x53, 0x80, 0x48, 0x00, 0x00, 0x05, 0x41, 0x04, 0x71, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x08, 0xc5, 0x34, 0x53, 0x89, 0x38, 0x70, 0x48,
@@ -213,4 +215,11 @@ const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
   0x27, 0x0c, 0x00, 0xc3, 0xa7, 0x03, 0x4d, 0x00, 0xc5, 0x9f, 0x03, 0x5c,
   0x00, 0xc7, 0xb5, 0x03, 0x68, 0x00, 0x07, 0x00
 };
-size_t __espeakng_dictlen = 2540;
+
+BackgroundAudioDictionary dict_uz = {
+    "uz",
+    2540,
+    __espeakng_dict_uz,
+    2434,
+    __espeakng_dictindex_uz
+};
@@ -1,5 +1,7 @@
 #pragma once
-const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
+#include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/vi_dict_index.h>
+const unsigned char __espeakng_dict_vi[] __attribute__((aligned((4)))) = {
   0x00, 0x04, 0x00, 0x00, 0xc1, 0xb9, 0x00, 0x00, 0x00, 0x53, 0x19, 0xf0,
   0x9f, 0x91, 0xa9, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xe2, 0x80,
   0x8d, 0xf0, 0x9f, 0x91, 0xa7, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa7,
@@ -4385,4 +4387,11 @@ const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
   0x20, 0x03, 0x57, 0x06, 0x79, 0x6c, 0x00, 0x21, 0x3d, 0x03, 0x66, 0x06,
   0x8e, 0x17, 0x0a, 0x48, 0x06, 0x23, 0x6c, 0x45, 0x0a, 0x00, 0x07, 0x00
 };
-size_t __espeakng_dictlen = 52608;
+
+BackgroundAudioDictionary dict_vi = {
+    "vi",
+    52608,
+    __espeakng_dict_vi,
+    7390,
+    __espeakng_dictindex_vi
+};
@@ -1,5 +1,7 @@
 #pragma once
-const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
+#include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/xex_dict_index.h>
+const unsigned char __espeakng_dict_xex[] __attribute__((aligned((4)))) = {
   0x00, 0x04, 0x00, 0x00, 0xa0, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x41, 0x08, 0x62, 0xc3, 0xa1, 0x62,
   0x6f, 0x6e, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x12, 0x41, 0x0c, 0x78,
@@ -441,4 +443,11 @@ const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
   0x03, 0x0b, 0x00, 0x27, 0x01, 0x11, 0x43, 0x00, 0x04, 0x2e, 0x03, 0x1b,
   0x00, 0x2e, 0x2e, 0x2e, 0x00, 0x07, 0x00
 };
-size_t __espeakng_dictlen = 5275;
+
+BackgroundAudioDictionary dict_xex = {
+    "xex",
+    5275,
+    __espeakng_dict_xex,
+    2198,
+    __espeakng_dictindex_xex
+};
@@ -1,5 +1,7 @@
 #pragma once
-const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
+#include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/yue_dict_index.h>
+const unsigned char __espeakng_dict_yue[] __attribute__((aligned((4)))) = {
   0x00, 0x04, 0x00, 0x00, 0x76, 0x21, 0x01, 0x00, 0x0b, 0x03, 0xe5, 0xb9,
   0xb2, 0x52, 0x27, 0x32, 0x11, 0x00, 0x1d, 0x0a, 0x03, 0xe8, 0xac, 0x8a,
   0x54, 0x82, 0x11, 0x00, 0x1d, 0x0a, 0x03, 0xe9, 0xa5, 0x92, 0x39, 0x7d,
@@ -6220,4 +6222,11 @@ const unsigned char __espeakng_dict[] __attribute__((aligned((4)))) = {
   0x33, 0x03, 0x6d, 0x00, 0x34, 0x03, 0x6e, 0x00, 0x35, 0x03, 0x6f, 0x00,
   0x36, 0x03, 0x70, 0x00, 0x37, 0x03, 0x71, 0x00, 0x07, 0x00
 };
-size_t __espeakng_dictlen = 74626;
+
+BackgroundAudioDictionary dict_yue = {
+    "yue",
+    74626,
+    __espeakng_dict_yue,
+    18440,
+    __espeakng_dictindex_yue
+};
@@ -54,6 +54,7 @@
 #include "synthdata.h"                     // for PhonemeCode, InterpretPhoneme
 #include "synthesize.h"                    // for STRESS_IS_PRIMARY, phoneme...
 #include "translate.h"                     // for Translator, utf8_in, LANGU...
+#include "context.h"                       // for CONTEXT_VAR
 
 static int LookupFlags(Translator *tr, const char *word, unsigned int flags_out[2]);
 static void DollarRule(char *word[], char *word_start, int consumed, int group_length, char word_buf[N_WORD_BYTES], Translator *tr, int command, int *failed, int *add_points);
@@ -69,6 +70,12 @@ typedef struct {
 int dictionary_skipwords;
 char dictionary_name[40];
 
+// The name belongs to each speech context's translator
+const CONTEXT_VAR dictionary_context_vars[] = {
+	CONTEXT_VAR_ITEM(dictionary_name),
+	CONTEXT_VAR_END
+};
+
 // accented characters which indicate (in some languages) the start of a separate syllable
 static const unsigned short diereses_list[7] = { 0xe4, 0xeb, 0xef, 0xf6, 0xfc, 0xff, 0 };
 
@@ -212,6 +219,66 @@ void espeak_InstallDict(const unsigned char *data, size_t len) {
         _dictLen = len;
 }
 
+static const unsigned char *_dictIndex = NULL;
+static size_t _dictIndexLen = 0;
+void espeak_InstallDictIndex(const unsigned char *data, size_t len) {
+        _dictIndex = data;
+        _dictIndexLen = len;
+}
+
+// Further dictionaries in memory, which LoadDictionary picks by name before falling back to espeak_InstallDict's
+#define N_DICT_REGISTRY 16
+typedef struct {
+	char name[12];
+	const unsigned char *data;
+	size_t len;
+	const unsigned char *index;
+	size_t index_len;
+} DICT_REGISTRY;
+static DICT_REGISTRY dict_registry[N_DICT_REGISTRY];
+static int n_dict_registry = 0;
+
+int espeak_RegisterDict(const char *name, const unsigned char *data, size_t len, const unsigned char *index, size_t index_len)
+{
+	int ix;
+
+	for (ix = 0; ix < n_dict_registry; ix++) {
+		if (strcmp(dict_registry[ix].name, name) == 0)
+			break;
+	}
+	if ((ix >= N_DICT_REGISTRY) || (strlen(name) >= sizeof(dict_registry[ix].name)))
+		return -1;
+	strcpy(dict_registry[ix].name, name);
+	dict_registry[ix].data = data;
+	dict_registry[ix].len = len;
+	dict_registry[ix].index = index;
+	dict_registry[ix].index_len = index_len;
+	if (ix == n_dict_registry)
+		n_dict_registry++;
+	return 0;
+}
+
+static void LoadDictionaryIndex(Translator *tr, int size, const unsigned char *index, size_t index_len)
+{
+	const DICT_INDEX *ix = (const DICT_INDEX *)index;
+
+	tr->dict_index_start = NULL;
+	tr->dict_index_fp = NULL;
+	tr->dict_index_offset = NULL;
+
+	if ((ix == NULL) || (index_len < sizeof(DICT_INDEX)))
+		return;
+	if ((ix->magic != DICT_INDEX_MAGIC) || (ix->dictlen != (unsigned int)size) ||
+	    (ix->rules != (unsigned int)(tr->data_dictrules - tr->data_dictlist)) ||
+	    (ix->start[N_HASH_DICT] != ix->entries) ||
+	    (index_len < sizeof(DICT_INDEX) + ((ix->entries + 1) & ~1) + ix->entries * sizeof(unsigned short)))
+		return;
+
+	tr->dict_index_start = ix->start;
+	tr->dict_index_fp = index + sizeof(DICT_INDEX);
+	tr->dict_index_offset = (const unsigned short *)(tr->dict_index_fp + ((ix->entries + 1) & ~1));
+}
+
 int LoadDictionary(Translator *tr, const char *name, int no_error)
 {
 	int hash;
@@ -223,13 +290,27 @@ int LoadDictionary(Translator *tr, const char *name, int no_error)
 #endif
 	int size;
 	char fname[sizeof(path_home)+20];
+	const unsigned char *dict = _dict;
+	size_t dict_len = _dictLen;
+	const unsigned char *index = _dictIndex;
+	size_t index_len = _dictIndexLen;
 
 	if (dictionary_name != name)
 		strncpy(dictionary_name, name, 40 - 1); // currently loaded dictionary name
 	if (tr->dictionary_name != name)
 		strncpy(tr->dictionary_name, name, 40 - 1);
 
-        if (!_dict) {
+	for (int ix = 0; ix < n_dict_registry; ix++) {
+		if (strcmp(dict_registry[ix].name, name) == 0) {
+			dict = dict_registry[ix].data;
+			dict_len = dict_registry[ix].len;
+			index = dict_registry[ix].index;
+			index_len = dict_registry[ix].index_len;
+			break;
+		}
+	}
+
+        if (!dict) {
 #ifndef ARDUINO // Always in flash
         	// Load a pronunciation data file into memory
         	// bytes 0-3:  offset to rules data
@@ -260,8 +341,8 @@ int LoadDictionary(Translator *tr, const char *name, int no_error)
                 return 1;
 #endif
         } else {
-                size = _dictLen;
-                tr->data_dictlist = (const char *)_dict;
+                size = dict_len;
+                tr->data_dictlist = (const char *)dict;
         }
 
 	pw = (int *)(tr->data_dictlist);
@@ -291,6 +372,7 @@ int LoadDictionary(Translator *tr, const char *name, int no_error)
 			p += length;
 		p++; // skip over the zero which terminates the list for this hash value
 	}
+	LoadDictionaryIndex(tr, size, index, index_len);
 
 	if ((tr->dict_min_size > 0) && (size < (int)tr->dict_min_size))
 		fprintf(stderr, "Full dictionary is not installed for '%s'\n", name);
@@ -316,6 +398,20 @@ int HashDictionary(const char *string)
 	return (hash+chars) & 0x3ff; // a 10 bit hash code
 }
 
+/* An 8 bit check code for a word as it is stored in the dictionary (i.e. after TransposeAlphabet),
+    independent of HashDictionary.  Must match fingerprint() in tools/dictindex
+ */
+int DictFingerprint(const char *word, int wlen)
+{
+	unsigned int h = 2166136261U; // FNV-1a
+	int ix;
+
+	h = (h ^ (wlen & 0x7f)) * 16777619U;
+	for (ix = 0; ix < (wlen & 0x3f); ix++)
+		h = (h ^ (word[ix] & 0xff)) * 16777619U;
+	return (h ^ (h >> 8) ^ (h >> 16) ^ (h >> 24)) & 0xff;
+}
+
 /* Translate a phoneme string from ascii mnemonics to internal phoneme numbers,
    from 'p' up to next blank .
    Returns advanced 'p'
@@ -2493,6 +2589,10 @@ static const char *LookupDict2(Translator *tr, const char *word, const char *wor
 	int lookup_symbol;
 	char word_buf[N_WORD_BYTES+1];
 	char dict_flags_buf[80];
+	char *chain;
+	int fp = 0;
+	int entry = 0;
+	int entry_end = 0;
 
 	if (wtab != NULL)
 		wflags = wtab->flags;
@@ -2507,7 +2607,7 @@ static const char *LookupDict2(Translator *tr, const char *word, const char *wor
 		wlen = strlen(word);
 
 	hash = HashDictionary(word);
-	p = tr->dict_hashtab[hash];
+	p = chain = tr->dict_hashtab[hash];
 
 	if (p == NULL) {
 		if (flags != NULL)
@@ -2515,10 +2615,26 @@ static const char *LookupDict2(Translator *tr, const char *word, const char *wor
 		return 0;
 	}
 
+	if (tr->dict_index_start != NULL) {
+		// Only visit the entries whose fingerprint matches, rather than every entry in the chain
+		fp = DictFingerprint(word, wlen);
+		entry = tr->dict_index_start[hash];
+		entry_end = tr->dict_index_start[hash+1];
+	}
+
 	// Find the first entry in the list for this hash value which matches.
 	// This corresponds to the last matching entry in the *_list file.
 
-	while (*p != 0) {
+	for (;;) {
+		if (tr->dict_index_start != NULL) {
+			while ((entry < entry_end) && (tr->dict_index_fp[entry] != fp))
+				entry++;
+			if (entry >= entry_end)
+				break;
+			p = chain + tr->dict_index_offset[entry++];
+		} else if (*p == 0)
+			break;
+
 		next = p + (p[0] & 0xff);
 
 		if (((p[1] & 0x7f) != wlen) || (memcmp(word, &p[2], wlen & 0x3f) != 0)) {
@@ -33,8 +33,22 @@ extern "C"
 
 extern const char stress_phonemes[];
 
+// Precomputed index into the hash chains of a *_dict, generated by tools/dictindex.  Followed (after padding
+// to sizeof(DICT_INDEX)) by unsigned char fingerprint[entries] (padded to an even length) and unsigned short offset[entries],
+// each entry's offset from the start of its hash chain.  Entries are in the same order as in the chains.
+#define DICT_INDEX_MAGIC 0x31584445 // "EDX1"
+typedef struct {
+	unsigned int magic;
+	unsigned int dictlen;  // size of the *_dict this was generated from
+	unsigned int rules;    // and its offset to the rules, as a sanity check
+	unsigned int entries;
+	unsigned short start[N_HASH_DICT + 1]; // first entry of each hash chain
+} DICT_INDEX;
+
+
 int LoadDictionary(Translator *tr, const char *name, int no_error);
 int HashDictionary(const char *string);
+int DictFingerprint(const char *word, int wlen);
 const char *EncodePhonemes(const char *p, char *outptr, int *bad_phoneme);
 void DecodePhonemes(const char *inptr, char *outptr);
 char *WritePhMnemonic(char *phon_out, PHONEME_TAB *ph, PHONEME_LIST *plist, int use_ipa, int *flags);
@@ -795,4 +795,20 @@ text_decoder_get_buffer(espeak_ng_TEXT_DECODER *decoder)
 	return decoder->current;
 }
 
+size_t
+text_decoder_remaining(espeak_ng_TEXT_DECODER *decoder)
+{
+	return decoder->end - decoder->current;
+}
+
+void
+text_decoder_continue(espeak_ng_TEXT_DECODER *decoder,
+                      const void *string,
+                      size_t length)
+{
+	// Decode the unread part of the text from another copy of it, which may also be longer
+	decoder->current = (const uint8_t *)string;
+	decoder->end = (const uint8_t *)string + length;
+}
+
 #pragma GCC visibility pop
@@ -17,6 +17,7 @@
 #ifndef ESPEAK_NG_ENCODING_H
 #define ESPEAK_NG_ENCODING_H
 
+#include <stddef.h>
 #include <stdint.h>
 
 #ifdef __cplusplus
@@ -96,6 +97,14 @@ text_decoder_peekc(espeak_ng_TEXT_DECODER *decoder);
 ESPEAK_NG_API const void *
 text_decoder_get_buffer(espeak_ng_TEXT_DECODER *decoder);
 
+ESPEAK_NG_API size_t
+text_decoder_remaining(espeak_ng_TEXT_DECODER *decoder);
+
+ESPEAK_NG_API void
+text_decoder_continue(espeak_ng_TEXT_DECODER *decoder,
+                      const void *string,
+                      size_t length);
+
 #ifdef __cplusplus
 }
 #endif
@@ -707,31 +707,188 @@ ESPEAK_API const char *espeak_Info(const char **path_data);
    path_data  returns the path to espeak_data
 */
 
+typedef struct espeak_CONTEXT espeak_CONTEXT;
+/* A speech context holds everything which carries over between calls for one speaker: the text being
+   translated, the voice and parameters, and the wave generator's state and queue.  The single-step
+   functions below take the context to work in, NULL being the one espeak_Initialize set up.
+
+   Contexts share the loaded data, dictionaries, voice cache, arena, and the phoneme list a clause is
+   translated into, so only one may be translating at a time and its clause must be stored (or have
+   been generated from the phoneme list) before another context translates.  Switching contexts copies
+   a few KB of state, and must not be interrupted by another call into ESpeak-NG.
+*/
+
+#ifdef __cplusplus
+extern "C"
+#endif
+ESPEAK_API espeak_CONTEXT *espeak_CreateContext(void);
+/* Creates a context with its own wave generator buffers (around 30KB), starting with the current
+   context's voice and the default parameters.  Use espeak_SelectVoice and espeak_GenerateVoice with
+   a cached voice before speaking.  Returns NULL if out of memory.
+*/
+
 #ifdef __cplusplus
 extern "C"
 #endif
-ESPEAK_API int espeak_SynthesizeOneStep(short **out);
+ESPEAK_API espeak_CONTEXT *espeak_SetContext(espeak_CONTEXT *ctx);
+/* Makes a context current for calls which don't take one, i.e. espeak_SetParameter.
+   Returns the previously current context.
+*/
 
 #ifdef __cplusplus
 extern "C"
 #endif
-ESPEAK_API void espeak_AbortSynthesis();
+ESPEAK_API void espeak_DeleteContext(espeak_CONTEXT *ctx);
+/* Frees a context made by espeak_CreateContext.  If it is current, the default one becomes current.
+*/
 
 #ifdef __cplusplus
 extern "C"
 #endif
-ESPEAK_API int espeak_SynthesisGenerateNext();
+ESPEAK_API int espeak_SynthesizeOneStep(espeak_CONTEXT *ctx, short **out);
+
+#ifdef __cplusplus
+extern "C"
+#endif
+ESPEAK_API void espeak_AbortSynthesis(espeak_CONTEXT *ctx);
+
+#ifdef __cplusplus
+extern "C"
+#endif
+ESPEAK_API int espeak_SynthesisGenerateNext(espeak_CONTEXT *ctx);
 
 #ifdef __cplusplus
 extern "C"
 #endif
 ESPEAK_API void espeak_EnableSingleStep();
 
+#ifdef __cplusplus
+extern "C"
+#endif
+ESPEAK_API int espeak_SynthDeferred(espeak_CONTEXT *ctx, const void *text, size_t size, unsigned int flags);
+/* Single-step mode only.  Like espeak_Synth, but does not translate anything yet.  Only the first size bytes
+   of text are used, so it does not need to be zero terminated.  The text must stay valid until
+   espeak_TranslateNextClause returns 0, or be moved with espeak_ContinueText.
+*/
+
+#ifdef __cplusplus
+extern "C"
+#endif
+ESPEAK_API void espeak_ContinueText(espeak_CONTEXT *ctx, const void *text, size_t size);
+/* Single-step mode only.  Continues translating the text given to espeak_SynthDeferred from text, size bytes
+   which start with the part espeak_TranslateNextClause has not read yet.  This lets the text already read be
+   thrown away and the rest moved, or more text be added to the end, without starting a new utterance.
+*/
+
+#ifdef __cplusplus
+extern "C"
+#endif
+ESPEAK_API size_t espeak_TextRemaining(espeak_CONTEXT *ctx);
+/* Single-step mode only.  Returns the number of bytes at the end of the text which have not been read yet.
+*/
+
+#ifdef __cplusplus
+extern "C"
+#endif
+ESPEAK_API int espeak_TranslateNextClause(espeak_CONTEXT *ctx);
+/* Translates the next clause of the text given to espeak_SynthDeferred into phonemes.
+   Returns the number of bytes needed to store it with espeak_StoreClause, or 0 at the end of the text.
+   Until it is stored or generated directly (espeak_GenerateClause(ctx, NULL)) no other clause may be translated,
+   in any context.
+*/
+
+#ifdef __cplusplus
+extern "C"
+#endif
+ESPEAK_API int espeak_StoreClause(void *clause);
+/* Copies the last translated clause into a pointer-aligned buffer of the size espeak_TranslateNextClause returned.
+*/
+
+#ifdef __cplusplus
+extern "C"
+#endif
+ESPEAK_API void espeak_GenerateClause(espeak_CONTEXT *ctx, const void *clause);
+/* Starts sending a stored clause (or if NULL, the last translated one) to the wave generator.
+   Follow with espeak_SynthesizeOneStep and espeak_ClauseGenerateNext.  Touches no translation state.
+*/
+
+#ifdef __cplusplus
+extern "C"
+#endif
+ESPEAK_API int espeak_ClauseGenerateNext(espeak_CONTEXT *ctx);
+/* Advances generation of the current clause.  Returns 0 once the clause has been completely output.
+*/
+
+#ifdef __cplusplus
+extern "C"
+#endif
+ESPEAK_API int espeak_CacheVoice(const unsigned char *data, size_t len);
+/* Parses a voice from memory (as espeak_InstallVoice) and keeps it, with its translator, so it can be switched
+   to by espeak_SelectVoice and espeak_GenerateVoice without parsing it again.  The current voice is not changed.
+   Returns an ID for the voice (the same one if this data is already cached), or -1 on error or if the cache is full.
+*/
+
+#ifdef __cplusplus
+extern "C"
+#endif
+ESPEAK_API int espeak_SelectVoice(espeak_CONTEXT *ctx, int id);
+/* Translates the following text with a cached voice.  Between strings only, not while a text is being translated.
+   Queue the change in order with the stored clauses and call espeak_GenerateVoice when generation reaches it.
+*/
+
+#ifdef __cplusplus
+extern "C"
+#endif
+ESPEAK_API int espeak_GenerateVoice(espeak_CONTEXT *ctx, int id);
+/* Generates the following clauses with a cached voice.  Call between clauses.  Touches no translation state.
+*/
+
+#ifdef __cplusplus
+extern "C"
+#endif
+ESPEAK_API int espeak_SetArena(void *mem, size_t size);
+/* Takes the working buffers used while translating each clause from this memory instead of the heap.
+   They are all released at the end of the clause.  Buffers which don't fit still come from the heap.
+   NULL returns to using only the heap.  Returns non-zero if a clause is being translated.
+*/
+
+#ifdef __cplusplus
+extern "C"
+#endif
+ESPEAK_API size_t espeak_ArenaHighWater();
+/* Returns the most working buffer memory needed at once so far, arena or heap, i.e. a size for espeak_SetArena.
+*/
+
+#ifdef __cplusplus
+extern "C"
+#endif
+ESPEAK_API int espeak_ArenaOverflows();
+/* Returns the number of working buffers which didn't fit in the arena and were taken from the heap.
+*/
+
 #ifdef __cplusplus
 extern "C"
 #endif
 ESPEAK_API void espeak_InstallDict(const unsigned char *data, size_t len);
 
+#ifdef __cplusplus
+extern "C"
+#endif
+ESPEAK_API void espeak_InstallDictIndex(const unsigned char *data, size_t len);
+/* Optional index for the dictionary given to espeak_InstallDict, from tools/dictindex.  Lets word lookups go
+   straight to the few dictionary entries which could match.  Ignored if it was made for a different dictionary.
+*/
+
+#ifdef __cplusplus
+extern "C"
+#endif
+ESPEAK_API int espeak_RegisterDict(const char *name, const unsigned char *data, size_t len, const unsigned char *index, size_t index_len);
+/* Adds a dictionary (and optional index, or NULL) to those in memory.  Voices and words in another language
+   load the dictionary registered under their language's name, i.e. "en", and only use the one given to
+   espeak_InstallDict if there is none.  Registering a name again replaces it for translators created afterwards.
+   Returns 0 on success, or -1 if there are too many.
+*/
+
 #ifdef __cplusplus
 extern "C"
 #endif
@@ -34,6 +34,7 @@
 #include "espeak-ng/encoding.h"
 #endif
 
+#include "common.h"      // for arena_alloc, arena_mark, arena_release
 #include "intonation.h"
 #include "phoneme.h"     // for PHONEME_TAB, PhonemeCode2, phonPAUSE, phPAUSE
 #include "synthdata.h"   // for PhonemeCode
@@ -939,8 +940,9 @@ void CalcPitches(Translator *tr, int clause_type)
 	PHONEME_TAB *ph;
 	int ph_end = n_phoneme_list;
 
+	size_t arena = arena_mark();
 	SYLLABLE *syllable_tab; // [N_PHONEME_LIST]; EFP3 - 6K in size
-        syllable_tab = (SYLLABLE*)malloc(n_phoneme_list * sizeof(SYLLABLE));
+        syllable_tab = (SYLLABLE*)arena_alloc(n_phoneme_list * sizeof(SYLLABLE));
 	n_st = 0;
 	n_primary = 0;
 	for (ix = 0; ix < (n_phoneme_list-1); ix++) {
@@ -959,13 +961,13 @@ void CalcPitches(Translator *tr, int clause_type)
 	syllable_tab[n_st].stress = 0; // extra 0 entry at the end
 
 	if (n_st == 0) {
-                free(syllable_tab);
+                arena_release(arena);
 		return; // nothing to do
         }
 
 	if (tr->langopts.tone_language == 1) {
 		CalcPitches_Tone(tr);
-                free(syllable_tab);
+                arena_release(arena);
 		return;
 	}
 
@@ -1101,5 +1103,5 @@ void CalcPitches(Translator *tr, int clause_type)
 			st_ix++;
 		}
 	}
-        free(syllable_tab);
+        arena_release(arena);
 }
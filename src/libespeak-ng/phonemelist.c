@@ -35,6 +35,7 @@
 #include "espeak-ng/encoding.h"
 #endif
 
+#include "common.h"      // for arena_alloc
 #include "phonemelist.h"
 #include "phoneme.h"     // for PHONEME_TAB, phVOWEL, REPLACE_PHONEMES, phPAUSE
 #include "synthdata.h"   // for InterpretPhoneme, SelectPhonemeTable
@@ -148,7 +149,7 @@ void MakePhonemeList(Translator *tr, int post_pause, bool start_sentence)
 	PHONEME_LIST *plist3;
 	PHONEME_LIST *plist3_inserted = NULL;
 	PHONEME_LIST *ph_list3; //[N_PHONEME_LIST]; // EFP3 - This would be 32K!!!  Use dynamic allocation
-        ph_list3 = (PHONEME_LIST *)malloc(N_PHONEME_LIST * sizeof(PHONEME_LIST));
+        ph_list3 = (PHONEME_LIST *)arena_alloc(N_PHONEME_LIST * sizeof(PHONEME_LIST)); // released with the clause
 
 	PHONEME_LIST2 *plist2;
 	WORD_PH_DATA worddata;
@@ -505,8 +506,6 @@ void MakePhonemeList(Translator *tr, int post_pause, bool start_sentence)
 	n_phoneme_list = ix;
 
 	SelectPhonemeTable(tr->phoneme_tab_ix);
-
-        free(ph_list3); // EFP3
 }
 
 static void SetRegressiveVoicing(int regression, PHONEME_LIST2 *plist2, PHONEME_TAB *ph, Translator *tr) {
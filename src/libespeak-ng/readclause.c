@@ -61,6 +61,7 @@
 #include "synthdata.h"            // for SelectPhonemeTable
 #include "translate.h"            // for Translator, utf8_out, CLAUSE_OPTION...
 #include "voice.h"                // for voice, voice_t, espeak_GetCurrentVoice
+#include "context.h"              // for CONTEXT_VAR
 
 #define N_XML_BUF   500
 
@@ -98,6 +99,37 @@ PARAM_STACK param_stack[N_PARAM_STACK];
 static int speech_parameters[N_SPEECH_PARAM]; // current values, from param_stack
 int saved_parameters[N_SPEECH_PARAM]; // Parameters saved on synthesis start
 
+// Characters read ahead by ReadClause, to be returned first next time
+#define N_XML_BUF2 20
+static char ungot_string[N_XML_BUF2+4];
+static int ungot_string_ix = -1;
+
+// The text being read and the SSML and parameter state, which belong to each speech context
+const CONTEXT_VAR readclause_context_vars[] = {
+	CONTEXT_VAR_ITEM(ungot_char2), CONTEXT_VAR_ITEM(p_decoder), CONTEXT_VAR_ITEM(ungot_char),
+	CONTEXT_VAR_ITEM(ignore_text), CONTEXT_VAR_ITEM(audio_text), CONTEXT_VAR_ITEM(clear_skipping_text),
+	CONTEXT_VAR_ITEM(count_characters), CONTEXT_VAR_ITEM(sayas_mode), CONTEXT_VAR_ITEM(sayas_start),
+	CONTEXT_VAR_ITEM(n_ssml_stack), CONTEXT_VAR_ITEM(ssml_stack),
+	CONTEXT_VAR_ITEM(base_voice), CONTEXT_VAR_ITEM(base_voice_variant_name), CONTEXT_VAR_ITEM(current_voice_id),
+	CONTEXT_VAR_ITEM(n_param_stack), CONTEXT_VAR_ITEM(param_stack),
+	CONTEXT_VAR_ITEM(speech_parameters), CONTEXT_VAR_ITEM(saved_parameters),
+	CONTEXT_VAR_ITEM(ungot_string), CONTEXT_VAR_ITEM(ungot_string_ix),
+	CONTEXT_VAR_END
+};
+
+void ReadclauseResetContext(void)
+{
+	// No text yet.  Its decoder is created by the first espeak_Synth
+	p_decoder = NULL;
+	ungot_char = 0;
+	ungot_char2 = 0;
+	ungot_string_ix = -1;
+	ignore_text = false;
+	audio_text = false;
+	clear_skipping_text = false;
+	count_characters = 0;
+}
+
 #define ESPEAKNG_CLAUSE_TYPE_PROPERTY_MASK 0xFFF0000000000000ull
 
 int clause_type_from_codepoint(uint32_t c)
@@ -478,7 +510,7 @@ static int CheckPhonemeMode(int option_phoneme_input, int phoneme_mode, int c1,
 }
 
 //EFP3 - Sorry again for this hack, needed to deallocate the XML on return
-#define return_and_free(x) { free(xml_buf); return (x); }
+#define return_and_free(x) { arena_release(arena); return (x); }
 int ReadClause(Translator *tr, char *buf, short *charix, int *charix_top, int n_buf, int *tone_type, char *voice_change)
 {
 	/* Find the end of the current clause.
@@ -512,13 +544,11 @@ int ReadClause(Translator *tr, char *buf, short *charix, int *charix_top, int n_
 	bool stressed_word = false;
 	int end_clause_after_tag = 0;
 	int end_clause_index = 0;
+	size_t arena = arena_mark();
 	wchar_t *xml_buf;//EFP3 [N_XML_BUF+1];
-        xml_buf = (wchar_t *)malloc((N_XML_BUF+1) * sizeof(wchar_t));
+        xml_buf = (wchar_t *)arena_alloc((N_XML_BUF+1) * sizeof(wchar_t));
 
-	#define N_XML_BUF2 20
 	char xml_buf2[N_XML_BUF2+2]; // for &<name> and &<number> sequences
-	static char ungot_string[N_XML_BUF2+4];
-	static int ungot_string_ix = -1;
 
 	if (clear_skipping_text) {
 		skipping_text = false;
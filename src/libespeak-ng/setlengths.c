@@ -43,6 +43,7 @@
 #include "voice.h"
 #include "synthesize.h"
 #include "translate.h"
+#include "context.h"
 
 static void SetSpeedFactors(voice_t *voice, int x, int speeds[3]);
 static void SetSpeedMods(SPEED_FACTORS *speed, int voiceSpeedF1, int wpm, int x);
@@ -146,6 +147,15 @@ static const unsigned char wav_factor_350[] = {
 
 static int len_speeds[3] = { 130, 121, 118 };
 
+// syllables still to come in the word, kept by CalcLengths from one clause to the next
+static int more_syllables = 0;
+
+// Speed state which belongs to each speech context
+const CONTEXT_VAR setlengths_context_vars[] = {
+	CONTEXT_VAR_ITEM(len_speeds), CONTEXT_VAR_ITEM(more_syllables),
+	CONTEXT_VAR_END
+};
+
 void SetSpeed(int control)
 {
 	int x;
@@ -378,7 +388,6 @@ void CalcLengths(Translator *tr)
 	PHONEME_LIST *p;
 	PHONEME_LIST *p2;
 
-	static int more_syllables = 0;
 	bool pre_sonorant = false;
 	bool pre_voiced = false;
 	int last_pitch = 0;
@@ -68,6 +68,7 @@
 #include "translate.h"            // for p_decoder, InitText, translator
 #include "voice.h"                // for FreeVoiceList, VoiceReset, current_...
 #include "wavegen.h"              // for WavegenFill, WavegenInit, WcmdqUsed
+#include "context.h"              // for SpeechResetContext
 
 static unsigned char *outbuf = NULL;
 static int outbuf_size = 0;
@@ -362,10 +363,28 @@ const int param_defaults[N_SPEECH_PARAM] = {
 	0,   // voice type
 };
 
+static void InitParameters(void)
+{
+	int param;
+
+	for (param = 0; param < N_SPEECH_PARAM; param++)
+		param_stack[0].parameter[param] = saved_parameters[param] = param_defaults[param];
+
+	SetParameter(espeakRATE, espeakRATE_NORMAL, 0);
+	SetParameter(espeakVOLUME, 100, 0);
+	SetParameter(espeakCAPITALS, option_capitals, 0);
+	SetParameter(espeakPUNCTUATION, option_punctuation, 0);
+	SetParameter(espeakWORDGAP, 0, 0);
+}
+
+void SpeechResetContext(void)
+{
+	// A new speech context starts with the default parameters
+	InitParameters();
+}
 
 ESPEAK_NG_API espeak_ng_STATUS espeak_ng_Initialize(espeak_ng_ERROR_CONTEXT *context)
 {
-	int param;
 	int srate = 22050; // default sample rate 22050 Hz
 
 	// It seems that the wctype functions don't work until the locale has been set
@@ -392,15 +411,7 @@ ESPEAK_NG_API espeak_ng_STATUS espeak_ng_Initialize(espeak_ng_ERROR_CONTEXT *con
 	InitNamedata();
 
 	VoiceReset(0);
-
-	for (param = 0; param < N_SPEECH_PARAM; param++)
-		param_stack[0].parameter[param] = saved_parameters[param] = param_defaults[param];
-
-	SetParameter(espeakRATE, espeakRATE_NORMAL, 0);
-	SetParameter(espeakVOLUME, 100, 0);
-	SetParameter(espeakCAPITALS, option_capitals, 0);
-	SetParameter(espeakPUNCTUATION, option_punctuation, 0);
-	SetParameter(espeakWORDGAP, 0, 0);
+	InitParameters();
 
 	option_phonemes = 0;
 	option_phoneme_events = 0;
@@ -429,6 +440,7 @@ ESPEAK_NG_API int espeak_ng_GetSampleRate(void)
 
 #pragma GCC visibility pop
 static bool _singlestep = false;
+static bool _deferred = false;
 
 static espeak_ng_STATUS Synthesize(unsigned int unique_identifier, const void *text, int flags)
 {
@@ -459,6 +471,9 @@ static espeak_ng_STATUS Synthesize(unsigned int unique_identifier, const void *t
 	if (status != ENS_OK)
 		return status;
 
+	if (_deferred)
+		return ENS_OK; // Clauses will be translated one at a time by espeak_TranslateNextClause
+
 	SpeakNextClause(0);
 
         if (_singlestep)
@@ -520,10 +535,11 @@ ESPEAK_NG_API void espeak_EnableSingleStep() {
         _singlestep = true;
 }
 
-ESPEAK_NG_API int espeak_SynthesizeOneStep(short **out) {
+ESPEAK_NG_API int espeak_SynthesizeOneStep(espeak_CONTEXT *ctx, short **out) {
         // Fill the buffer with output sound
         int length;
 
+        espeak_SetContext(ctx);
         out_ptr = outbuf;
         out_end = &outbuf[outbuf_size];
         event_list_ix = 0;
@@ -536,11 +552,56 @@ ESPEAK_NG_API int espeak_SynthesizeOneStep(short **out) {
         return length;
 }
 
-ESPEAK_NG_API void espeak_AbortSynthesis() {
-        SpeakNextClause(2); // stop
+ESPEAK_NG_API void espeak_AbortSynthesis(espeak_CONTEXT *ctx) {
+        espeak_SetContext(ctx);
+        AbortClause();
+}
+
+ESPEAK_NG_API int espeak_SynthDeferred(espeak_CONTEXT *ctx, const void *text, size_t size, unsigned int flags) {
+        // Only set up the text decoder, no clause is translated yet.  The text is given by size, it may not
+        // be terminated yet, so the decoder is started on an empty string and then pointed at it.
+        static const wchar_t no_text[1] = { 0 };
+        espeak_SetContext(ctx);
+        _deferred = true;
+        int ret = espeak_Synth(no_text, sizeof(no_text), 0, POS_CHARACTER, 0, flags & ~espeakSSML, NULL, NULL);
+        _deferred = false;
+        if (ret == ENS_OK)
+                text_decoder_continue(p_decoder, text, size);
+        return ret;
+}
+
+ESPEAK_NG_API void espeak_ContinueText(espeak_CONTEXT *ctx, const void *text, size_t size) {
+        espeak_SetContext(ctx);
+        if (p_decoder != NULL)
+                text_decoder_continue(p_decoder, text, size);
+}
+
+ESPEAK_NG_API size_t espeak_TextRemaining(espeak_CONTEXT *ctx) {
+        espeak_SetContext(ctx);
+        return (p_decoder != NULL) ? text_decoder_remaining(p_decoder) : 0;
+}
+
+ESPEAK_NG_API int espeak_TranslateNextClause(espeak_CONTEXT *ctx) {
+        espeak_SetContext(ctx);
+        return TranslateNextClause();
+}
+
+ESPEAK_NG_API int espeak_StoreClause(void *clause) {
+        return StoreClause(clause);
+}
+
+ESPEAK_NG_API void espeak_GenerateClause(espeak_CONTEXT *ctx, const void *clause) {
+        espeak_SetContext(ctx);
+        GenerateClause(clause);
+}
+
+ESPEAK_NG_API int espeak_ClauseGenerateNext(espeak_CONTEXT *ctx) {
+        espeak_SetContext(ctx);
+        return GenerateClauseNext();
 }
 
-ESPEAK_NG_API int espeak_SynthesisGenerateNext() {
+ESPEAK_NG_API int espeak_SynthesisGenerateNext(espeak_CONTEXT *ctx) {
+        espeak_SetContext(ctx);
         if (Generate(phoneme_list, &n_phoneme_list, 1) == 0) {
                 if (WcmdqUsed() == 0) {
                         if (SpeakNextClause(1) == 0) {
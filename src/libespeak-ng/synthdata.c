@@ -47,6 +47,7 @@
 #include "synthesize.h"               // for PHONEME_LIST, frameref_t, PHONE...
 #include "translate.h"                // for Translator, LANGUAGE_OPTIONS
 #include "voice.h"                    // for ReadTonePoints, tone_points, voice
+#include "context.h"                  // for CONTEXT_VAR, CONTEXT_BUFFER
 
 int n_tunes = 0;
 TUNE *tunes = NULL;
@@ -56,7 +57,25 @@ const int version_phdata  = 0x014801;
 // copy the current phoneme table into here
 int n_phoneme_tab;
 static int current_phoneme_table;
-PHONEME_TAB *phoneme_tab[N_PHONEME_TAB];
+static PHONEME_TAB *phoneme_tab1[N_PHONEME_TAB];
+PHONEME_TAB **phoneme_tab = phoneme_tab1;
+
+// a second copy, which SwapPhonemeTables exchanges with the current one
+static int other_n_phoneme_tab = 0;
+static int other_phoneme_table = -1;
+static PHONEME_TAB *phoneme_tab2[N_PHONEME_TAB];
+static PHONEME_TAB **other_phoneme_tab = phoneme_tab2;
+
+// The second copy is the wave generator's, so belongs to each speech context
+const CONTEXT_VAR synthdata_context_vars[] = {
+	CONTEXT_VAR_ITEM(other_n_phoneme_tab), CONTEXT_VAR_ITEM(other_phoneme_table), CONTEXT_VAR_ITEM(other_phoneme_tab),
+	CONTEXT_VAR_END
+};
+
+const CONTEXT_BUFFER synthdata_context_buffers[] = {
+	{ &other_phoneme_tab, sizeof(phoneme_tab2) },
+	{ NULL, 0 }
+};
 
 static unsigned short *phoneme_index = NULL;
 static char *phondata_ptr = NULL;
@@ -412,12 +431,35 @@ void SelectPhonemeTable(int number)
 {
 	if (current_phoneme_table == number) return;
 	n_phoneme_tab = 0;
-	MAKE_MEM_UNDEFINED(&phoneme_tab, sizeof(phoneme_tab));
+	MAKE_MEM_UNDEFINED(phoneme_tab, N_PHONEME_TAB * sizeof(*phoneme_tab));
 	SetUpPhonemeTable(number); // recursively for included phoneme tables
 	n_phoneme_tab++;
 	current_phoneme_table = number;
 }
 
+void SynthdataResetContext(void)
+{
+	// The new context's copy is empty, so has to be built on first use
+	other_n_phoneme_tab = 0;
+	other_phoneme_table = -1;
+}
+
+void SwapPhonemeTables(void)
+{
+	// Exchange the current phoneme table with the second copy, so that two tables can stay
+	// selected at once without being rebuilt each time (i.e. for translation and generation)
+	PHONEME_TAB **tab = phoneme_tab;
+	int n = n_phoneme_tab;
+	int number = current_phoneme_table;
+
+	phoneme_tab = other_phoneme_tab;
+	n_phoneme_tab = other_n_phoneme_tab;
+	current_phoneme_table = other_phoneme_table;
+	other_phoneme_tab = tab;
+	other_n_phoneme_tab = n;
+	other_phoneme_table = number;
+}
+
 int LookupPhonemeTable(const char *name)
 {
 	int ix;
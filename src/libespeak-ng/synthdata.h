@@ -54,6 +54,7 @@ frameref_t *LookupSpect(PHONEME_TAB *this_ph,
 
 int PhonemeCode(unsigned int mnem);
 void SelectPhonemeTable(int number);
+void SwapPhonemeTables(void);
 int  SelectPhonemeTableName(const char *name);
 
 extern int n_tunes;
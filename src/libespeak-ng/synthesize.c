@@ -50,6 +50,7 @@
 #include "voice.h"                // for voice_t, voice, LoadVoiceVariant
 #include "wavegen.h"              // for WcmdqInc, WcmdqFree, WcmdqStop
 #include "speech.h"               // for MAKE_MEM_UNDEFINED
+#include "context.h"              // for CONTEXT_VAR, CONTEXT_BUFFER
 
 static void SmoothSpect(void);
 
@@ -57,6 +58,11 @@ static void SmoothSpect(void);
 int n_phoneme_list = 0;
 PHONEME_LIST phoneme_list[N_PHONEME_LIST+1];
 
+// The clause being generated, normally the global phoneme_list but may be a stored copy, see GenerateClause
+static PHONEME_LIST *gen_phoneme_list = phoneme_list;
+static int gen_n_phoneme_list = 0;
+static unsigned int *gen_embedded_list = embedded_list;
+
 SPEED_FACTORS speed;
 
 static int last_pitch_cmd;
@@ -74,6 +80,21 @@ static int syllable_centre;
 
 static voice_t *new_voice = NULL;
 
+// Round-robin pool of modified frames for AllocFrame, big enough to not need checks
+#define N_FRAME_POOL N_WCMDQ
+static int frame_ix = 0;
+static frame_t frame_pool0[N_FRAME_POOL];
+static frame_t *frame_pool = frame_pool0;
+
+static int wave_flag = 0;
+
+// Kept between calls by Generate, to resume the clause
+static int gen_ix;
+static int gen_embedded_ix;
+static int gen_word_count;
+static int gen_sourceix = 0;
+static WORD_PH_DATA gen_worddata;
+
 static int (*phoneme_callback)(const char *) = NULL;
 
 #define RMS_GLOTTAL1 35   // vowel before glottal stop
@@ -388,16 +409,12 @@ static frame_t *AllocFrame(void)
 	// enough to use a round-robin without checks.
 	// Only needed for modifying spectra for blending to consonants
 
-	#define N_FRAME_POOL N_WCMDQ
-	static int ix = 0;
-	static frame_t frame_pool[N_FRAME_POOL];
+	frame_ix++;
+	if (frame_ix >= N_FRAME_POOL)
+		frame_ix = 0;
 
-	ix++;
-	if (ix >= N_FRAME_POOL)
-		ix = 0;
-
-	MAKE_MEM_UNDEFINED(&frame_pool[ix], sizeof(frame_pool[ix]));
-	return &frame_pool[ix];
+	MAKE_MEM_UNDEFINED(&frame_pool[frame_ix], sizeof(frame_pool[frame_ix]));
+	return &frame_pool[frame_ix];
 }
 
 static void set_frame_rms(frame_t *fr, int new_rms)
@@ -858,7 +875,6 @@ int DoSpect2(PHONEME_TAB *this_ph, int which, FMT_PARAMS *fmt_params,  PHONEME_L
 	int length_sum;
 	int length_min;
 	int total_len = 0;
-	static int wave_flag = 0;
 	int wcmd_spect = WCMD_SPECT;
 	int frame_lengths[N_SEQ_FRAMES];
 
@@ -1064,6 +1080,7 @@ espeak_ng_STATUS DoVoiceChange(voice_t *v)
 		return ENOMEM;
 	memcpy(v2, v, sizeof(voice_t));
 	wcmdq[wcmdq_tail][0] = WCMD_VOICE;
+	wcmdq[wcmdq_tail][1] = 0; // free after use
 	wcmdq[wcmdq_tail][2] = (intptr_t)v2;
 	WcmdqInc();
 	return ENS_OK;
@@ -1078,7 +1095,7 @@ void DoEmbedded(int *embix, int sourceix)
 		unsigned int value;
 		int command;
 
-		word = embedded_list[*embix];
+		word = gen_embedded_list[*embix];
 		value = word >> 8;
 		command = word & 0x7f;
 
@@ -1126,9 +1143,6 @@ extern espeak_ng_OUTPUT_HOOKS* output_hooks;
 
 int Generate(PHONEME_LIST *phoneme_list, int *n_ph, bool resume)
 {
-	static int ix;
-	static int embedded_ix;
-	static int word_count;
 	PHONEME_LIST *p;
 	bool released;
 	int stress;
@@ -1142,14 +1156,12 @@ int Generate(PHONEME_LIST *phoneme_list, int *n_ph, bool resume)
 	int use_ipa = 0;
 	int vowelstart_prev;
 	char phoneme_name[16];
-	static int sourceix = 0;
 
 	PHONEME_DATA phdata;
 	PHONEME_DATA phdata_prev;
 	PHONEME_DATA phdata_next;
 	PHONEME_DATA phdata_tone;
 	FMT_PARAMS fmtp;
-	static WORD_PH_DATA worddata;
 
 	if (option_phoneme_events & espeakINITIALIZE_PHONEME_IPA)
 		use_ipa = 1;
@@ -1160,9 +1172,9 @@ int Generate(PHONEME_LIST *phoneme_list, int *n_ph, bool resume)
 #endif
 
 	if (resume == false) {
-		ix = 1;
-		embedded_ix = 0;
-		word_count = 0;
+		gen_ix = 1;
+		gen_embedded_ix = 0;
+		gen_word_count = 0;
 		pitch_length = 0;
 		amp_length = 0;
 		last_frame = NULL;
@@ -1171,12 +1183,12 @@ int Generate(PHONEME_LIST *phoneme_list, int *n_ph, bool resume)
 		syllable_end = wcmdq_tail;
 		syllable_centre = -1;
 		last_pitch_cmd = -1;
-		memset(&worddata, 0, sizeof(worddata));
+		memset(&gen_worddata, 0, sizeof(gen_worddata));
 		DoPause(0, 0); // isolate from the previous clause
 	}
 
-	while ((ix < (*n_ph)) && (ix < N_PHONEME_LIST-2)) {
-		p = &phoneme_list[ix];
+	while ((gen_ix < (*n_ph)) && (gen_ix < N_PHONEME_LIST-2)) {
+		p = &phoneme_list[gen_ix];
 
 		if(output_hooks && output_hooks->outputPhoSymbol)
 		{
@@ -1202,12 +1214,12 @@ int Generate(PHONEME_LIST *phoneme_list, int *n_ph, bool resume)
 		PHONEME_LIST *next;
 		PHONEME_LIST *next2;
 
-		prev = &phoneme_list[ix-1];
-		next = &phoneme_list[ix+1];
-		next2 = &phoneme_list[ix+2];
+		prev = &phoneme_list[gen_ix-1];
+		next = &phoneme_list[gen_ix+1];
+		next2 = &phoneme_list[gen_ix+2];
 
 		if (p->synthflags & SFLAG_EMBEDDED)
-			DoEmbedded(&embedded_ix, p->sourceix);
+			DoEmbedded(&gen_embedded_ix, p->sourceix);
 
 		if (p->newword) {
 			if (((p->type == phVOWEL) && (translator->langopts.param[LOPT_WORD_MERGE] & 1)) ||
@@ -1215,13 +1227,13 @@ int Generate(PHONEME_LIST *phoneme_list, int *n_ph, bool resume)
 			} else
 				last_frame = NULL;
 
-			sourceix = (p->sourceix & 0x7ff) + clause_start_char;
+			gen_sourceix = (p->sourceix & 0x7ff) + clause_start_char;
 
 			if (p->newword & PHLIST_START_OF_SENTENCE)
-				DoMarker(espeakEVENT_SENTENCE, sourceix, 0, count_sentences); // start of sentence
+				DoMarker(espeakEVENT_SENTENCE, gen_sourceix, 0, count_sentences); // start of sentence
 
 			if (p->newword & PHLIST_START_OF_WORD)
-				DoMarker(espeakEVENT_WORD, sourceix, p->sourceix >> 11, clause_start_word + word_count++); // NOTE, this count doesn't include multiple-word pronunciations in *_list. eg (of a)
+				DoMarker(espeakEVENT_WORD, gen_sourceix, p->sourceix >> 11, clause_start_word + gen_word_count++); // NOTE, this count doesn't include multiple-word pronunciations in *_list. eg (of a)
 		}
 
 		EndAmplitude();
@@ -1237,7 +1249,7 @@ int Generate(PHONEME_LIST *phoneme_list, int *n_ph, bool resume)
 				//WritePhMnemonic(phoneme_name, p->ph, p, use_ipa, NULL);
 				WritePhMnemonicWithStress(phoneme_name, p->ph, p, use_ipa, NULL);
 
-				DoPhonemeMarker(espeakEVENT_PHONEME, sourceix, 0, phoneme_name);
+				DoPhonemeMarker(espeakEVENT_PHONEME, gen_sourceix, 0, phoneme_name);
 				done_phoneme_marker = true;
 			}
 		}
@@ -1262,7 +1274,7 @@ int Generate(PHONEME_LIST *phoneme_list, int *n_ph, bool resume)
 			if (ph->phflags & phPREVOICE) {
 				// a period of voicing before the release
 				memset(&fmtp, 0, sizeof(fmtp));
-				InterpretPhoneme(NULL, 0x01, p, phoneme_list, &phdata, &worddata);
+				InterpretPhoneme(NULL, 0x01, p, phoneme_list, &phdata, &gen_worddata);
 				fmtp.fmt_addr = phdata.sound_addr[pd_FMT];
 				fmtp.fmt_amp = phdata.sound_param[pd_FMT];
 
@@ -1274,12 +1286,12 @@ int Generate(PHONEME_LIST *phoneme_list, int *n_ph, bool resume)
 				DoSpect2(ph, 0, &fmtp, p, 0);
 			}
 
-			InterpretPhoneme(NULL, 0, p, phoneme_list, &phdata, &worddata);
+			InterpretPhoneme(NULL, 0, p, phoneme_list, &phdata, &gen_worddata);
 			phdata.pd_control |= pd_DONTLENGTHEN;
 			DoSample3(&phdata, 0, 0);
 			break;
 		case phFRICATIVE:
-			InterpretPhoneme(NULL, 0, p, phoneme_list, &phdata, &worddata);
+			InterpretPhoneme(NULL, 0, p, phoneme_list, &phdata, &gen_worddata);
 
 			if (p->synthflags & SFLAG_LENGTHEN)
 				DoSample3(&phdata, p->length, 0); // play it twice for [s:] etc.
@@ -1308,7 +1320,7 @@ int Generate(PHONEME_LIST *phoneme_list, int *n_ph, bool resume)
 
 			if ((prev->type == phVOWEL) || (ph->phflags & phPREVOICE)) {
 				// a period of voicing before the release
-				InterpretPhoneme(NULL, 0x01, p, phoneme_list, &phdata, &worddata);
+				InterpretPhoneme(NULL, 0x01, p, phoneme_list, &phdata, &gen_worddata);
 				fmtp.fmt_addr = phdata.sound_addr[pd_FMT];
 				fmtp.fmt_amp = phdata.sound_param[pd_FMT];
 
@@ -1327,7 +1339,7 @@ int Generate(PHONEME_LIST *phoneme_list, int *n_ph, bool resume)
 				StartSyllable();
 			} else
 				p->synthflags |= SFLAG_NEXT_PAUSE;
-			InterpretPhoneme(NULL, 0, p, phoneme_list, &phdata, &worddata);
+			InterpretPhoneme(NULL, 0, p, phoneme_list, &phdata, &gen_worddata);
 			fmtp.fmt_addr = phdata.sound_addr[pd_FMT];
 			fmtp.fmt_amp = phdata.sound_param[pd_FMT];
 			fmtp.wav_addr = phdata.sound_addr[pd_ADDWAV];
@@ -1359,7 +1371,7 @@ int Generate(PHONEME_LIST *phoneme_list, int *n_ph, bool resume)
 				StartSyllable();
 			else
 				p->synthflags |= SFLAG_NEXT_PAUSE;
-			InterpretPhoneme(NULL, 0, p, phoneme_list, &phdata, &worddata);
+			InterpretPhoneme(NULL, 0, p, phoneme_list, &phdata, &gen_worddata);
 			memset(&fmtp, 0, sizeof(fmtp));
 			fmtp.std_length = phdata.pd_param[i_SET_LENGTH]*2;
 			fmtp.fmt_addr = phdata.sound_addr[pd_FMT];
@@ -1381,7 +1393,7 @@ int Generate(PHONEME_LIST *phoneme_list, int *n_ph, bool resume)
 			if (prev->type == phNASAL)
 				last_frame = NULL;
 
-			InterpretPhoneme(NULL, 0, p, phoneme_list, &phdata, &worddata);
+			InterpretPhoneme(NULL, 0, p, phoneme_list, &phdata, &gen_worddata);
 			fmtp.std_length = phdata.pd_param[i_SET_LENGTH]*2;
 			fmtp.fmt_addr = phdata.sound_addr[pd_FMT];
 			fmtp.fmt_amp = phdata.sound_param[pd_FMT];
@@ -1414,7 +1426,7 @@ int Generate(PHONEME_LIST *phoneme_list, int *n_ph, bool resume)
 
 			if (next->type == phVOWEL)
 				StartSyllable();
-			InterpretPhoneme(NULL, 0, p, phoneme_list, &phdata, &worddata);
+			InterpretPhoneme(NULL, 0, p, phoneme_list, &phdata, &gen_worddata);
 
 			if ((value = (phdata.pd_param[i_PAUSE_BEFORE] - p->prepause)) > 0)
 				DoPause(value, 1);
@@ -1431,7 +1443,7 @@ int Generate(PHONEME_LIST *phoneme_list, int *n_ph, bool resume)
 
 			memset(&fmtp, 0, sizeof(fmtp));
 
-			InterpretPhoneme(NULL, 0, p, phoneme_list, &phdata, &worddata);
+			InterpretPhoneme(NULL, 0, p, phoneme_list, &phdata, &gen_worddata);
 			fmtp.std_length = phdata.pd_param[i_SET_LENGTH] * 2;
 			vowelstart_prev = 0;
 
@@ -1503,7 +1515,7 @@ int Generate(PHONEME_LIST *phoneme_list, int *n_ph, bool resume)
 				//WritePhMnemonic(phoneme_name, p->ph, p, use_ipa, NULL);
 				WritePhMnemonicWithStress(phoneme_name, p->ph, p, use_ipa, NULL);
 
-				DoPhonemeMarker(espeakEVENT_PHONEME, sourceix, 0, phoneme_name);
+				DoPhonemeMarker(espeakEVENT_PHONEME, gen_sourceix, 0, phoneme_name);
 			}
 
 			fmtp.fmt_addr = phdata.sound_addr[pd_FMT];
@@ -1528,7 +1540,7 @@ int Generate(PHONEME_LIST *phoneme_list, int *n_ph, bool resume)
 			DoSpect2(ph, 2, &fmtp, p, modulation);
 			break;
 		}
-		ix++;
+		gen_ix++;
 	}
 	EndPitch(1);
 	if (*n_ph > 0) {
@@ -1555,6 +1567,7 @@ int SpeakNextClause(int control)
 	if (control == 2) {
 		// stop speaking
 		n_phoneme_list = 0;
+		gen_n_phoneme_list = 0;
 		WcmdqStop();
 
 		return 0;
@@ -1588,6 +1601,7 @@ int SpeakNextClause(int control)
 		return 1;
 	}
 
+	gen_embedded_list = embedded_list;
 	Generate(phoneme_list, &n_phoneme_list, 0);
 
 	if (voice_change != NULL) {
@@ -1611,3 +1625,166 @@ ESPEAK_API void espeak_SetPhonemeCallback(int (*PhonemeCallback)(const char *))
 	phoneme_callback = PhonemeCallback;
 }
 #pragma GCC visibility pop
+
+// Two stage synthesis.  TranslateNextClause and StoreClause run the text pipeline and copy the
+// result out, so it can run in a different context than GenerateClause and GenerateClauseNext,
+// which only feed the wavegen command queue.  Clause voice changes only come from SSML, which is
+// not used with this mode.
+
+typedef struct {
+	int n_phonemes;
+	int n_embedded;
+} CLAUSE_HEADER;
+
+static int ClausePhonemeOffset(int n_embedded)
+{
+	int offset = sizeof(CLAUSE_HEADER) + n_embedded * sizeof(unsigned int);
+	return (offset + sizeof(void *) - 1) & ~(sizeof(void *) - 1);
+}
+
+static int ClauseCopyCount(void)
+{
+	// Generate looks up to two entries past the end of the list
+	return (n_phoneme_list + 2 < N_PHONEME_LIST + 1) ? n_phoneme_list + 2 : N_PHONEME_LIST + 1;
+}
+
+int TranslateNextClause(void)
+{
+	// Returns the number of bytes StoreClause needs for the translated clause, 0 at the end of the text
+	int clause_tone;
+	char *voice_change;
+
+	if ((p_decoder == NULL) || text_decoder_eof(p_decoder)) {
+		skipping_text = false;
+		return 0;
+	}
+
+	SelectPhonemeTable(voice->phoneme_tab_ix);
+	TranslateClause(translator, &clause_tone, &voice_change);
+	CalcPitches(translator, clause_tone);
+	CalcLengths(translator);
+
+	return ClausePhonemeOffset(EmbeddedListLength()) + ClauseCopyCount() * sizeof(PHONEME_LIST);
+}
+
+int StoreClause(void *clause)
+{
+	CLAUSE_HEADER *hdr = (CLAUSE_HEADER *)clause;
+	hdr->n_phonemes = n_phoneme_list;
+	hdr->n_embedded = EmbeddedListLength();
+	memcpy(hdr + 1, embedded_list, hdr->n_embedded * sizeof(unsigned int));
+	int offset = ClausePhonemeOffset(hdr->n_embedded);
+	memcpy((char *)clause + offset, phoneme_list, ClauseCopyCount() * sizeof(PHONEME_LIST));
+	return offset + ClauseCopyCount() * sizeof(PHONEME_LIST);
+}
+
+// Voice, translator and phoneme table of the clauses being generated, once GenerateVoice has been
+// called.  They are swapped in for the translation side's while generating, so clauses queued before
+// a voice change are still generated with the voice they were translated with.  The swap changes the
+// globals the translator uses, so translation must never run between the two halves: on a single core
+// an interrupt which generates completes both before returning, but where generation can run on
+// another core (the ESP32) the caller has to keep translation and generation apart with a lock.
+static voice_t *gen_voice = NULL;
+static Translator *gen_translator = NULL;
+
+static void SwapGenerateVoice(void)
+{
+	voice_t *v = voice;
+	Translator *tr = translator;
+
+	if (gen_voice == NULL)
+		return;
+	voice = gen_voice;
+	translator = gen_translator;
+	gen_voice = v;
+	gen_translator = tr;
+	SwapPhonemeTables();
+}
+
+void GenerateVoice(voice_t *v, Translator *tr)
+{
+	// Generate the following clauses with this voice, which must stay valid (i.e. a cached voice)
+	gen_voice = v;
+	gen_translator = tr;
+	SwapGenerateVoice();
+	SelectPhonemeTable(voice->phoneme_tab_ix);
+	SwapGenerateVoice();
+
+	wcmdq[wcmdq_tail][0] = WCMD_VOICE;
+	wcmdq[wcmdq_tail][1] = 1; // not to be freed
+	wcmdq[wcmdq_tail][2] = (intptr_t)v;
+	WcmdqInc();
+}
+
+void GenerateClause(const void *clause)
+{
+	// Start generating a stored clause, or the global phoneme_list if NULL
+	SwapGenerateVoice();
+	if (clause == NULL) {
+		gen_phoneme_list = phoneme_list;
+		gen_n_phoneme_list = n_phoneme_list;
+		gen_embedded_list = embedded_list;
+	} else {
+		const CLAUSE_HEADER *hdr = (const CLAUSE_HEADER *)clause;
+		gen_embedded_list = (unsigned int *)(hdr + 1);
+		gen_phoneme_list = (PHONEME_LIST *)((char *)clause + ClausePhonemeOffset(hdr->n_embedded));
+		gen_n_phoneme_list = hdr->n_phonemes;
+	}
+	Generate(gen_phoneme_list, &gen_n_phoneme_list, 0);
+	SwapGenerateVoice();
+}
+
+void AbortClause(void)
+{
+	// Stop generating.  The translated phoneme list may hold another context's clause, so is left alone
+	gen_n_phoneme_list = 0;
+	WcmdqStop();
+}
+
+int GenerateClauseNext(void)
+{
+	// Returns 0 once the clause is completely in the wavegen queue and the queue has drained
+	int more;
+
+	SwapGenerateVoice();
+	more = Generate(gen_phoneme_list, &gen_n_phoneme_list, 1);
+	SwapGenerateVoice();
+	if ((more == 0) && (WcmdqUsed() == 0))
+		return 0;
+	return 1;
+}
+
+// State of the phoneme to wavegen stage which belongs to each speech context
+const CONTEXT_VAR synthesize_context_vars[] = {
+	CONTEXT_VAR_ITEM(gen_phoneme_list), CONTEXT_VAR_ITEM(gen_n_phoneme_list), CONTEXT_VAR_ITEM(gen_embedded_list),
+	CONTEXT_VAR_ITEM(speed),
+	CONTEXT_VAR_ITEM(last_pitch_cmd), CONTEXT_VAR_ITEM(last_amp_cmd), CONTEXT_VAR_ITEM(last_frame),
+	CONTEXT_VAR_ITEM(last_wcmdq), CONTEXT_VAR_ITEM(pitch_length), CONTEXT_VAR_ITEM(amp_length),
+	CONTEXT_VAR_ITEM(modn_flags), CONTEXT_VAR_ITEM(fmt_amplitude),
+	CONTEXT_VAR_ITEM(syllable_start), CONTEXT_VAR_ITEM(syllable_end), CONTEXT_VAR_ITEM(syllable_centre),
+	CONTEXT_VAR_ITEM(new_voice), CONTEXT_VAR_ITEM(frame_ix), CONTEXT_VAR_ITEM(frame_pool),
+	CONTEXT_VAR_ITEM(wave_flag),
+	CONTEXT_VAR_ITEM(gen_ix), CONTEXT_VAR_ITEM(gen_embedded_ix), CONTEXT_VAR_ITEM(gen_word_count),
+	CONTEXT_VAR_ITEM(gen_sourceix), CONTEXT_VAR_ITEM(gen_worddata),
+	CONTEXT_VAR_ITEM(gen_voice), CONTEXT_VAR_ITEM(gen_translator),
+	CONTEXT_VAR_END
+};
+
+const CONTEXT_BUFFER synthesize_context_buffers[] = {
+	{ &frame_pool, sizeof(frame_pool0) },
+	{ NULL, 0 }
+};
+
+void SynthesizeResetContext(void)
+{
+	// No clause being generated, and no generation voice until GenerateVoice is called
+	gen_phoneme_list = phoneme_list;
+	gen_n_phoneme_list = 0;
+	gen_embedded_list = embedded_list;
+	last_frame = NULL;
+	new_voice = NULL;
+	frame_ix = 0;
+	wave_flag = 0;
+	gen_voice = NULL;
+	gen_translator = NULL;
+}
@@ -147,11 +147,11 @@ typedef struct {
 } WGEN_DATA;
 
 typedef struct {
-	double a;
-	double b;
-	double c;
-	double x1;
-	double x2;
+	int32_t a; // coefficients, Q28 fixed point
+	int32_t b;
+	int32_t c;
+	int32_t x1; // previous two outputs, Q8
+	int32_t x2;
 } RESONATOR;
 
 typedef struct {
@@ -391,7 +391,7 @@ typedef struct {
 
 
 // phoneme table
-extern PHONEME_TAB *phoneme_tab[N_PHONEME_TAB];
+extern PHONEME_TAB **phoneme_tab;
 
 // list of phonemes in a clause
 extern int n_phoneme_list;
@@ -421,7 +421,7 @@ extern const unsigned char env_fall[128];
 #define N_WCMDQ   170
 #define MIN_WCMDQ  25   // need this many free entries before adding new phoneme
 
-extern intptr_t wcmdq[N_WCMDQ][4];
+extern intptr_t (*wcmdq)[4];
 extern int wcmdq_head;
 extern int wcmdq_tail;
 
@@ -434,11 +434,16 @@ extern int samplerate;
 extern int echo_head;
 extern int echo_tail;
 extern int echo_amp;
-extern short echo_buf[N_ECHO_BUF];
+extern short *echo_buf;
 
 void SynthesizeInit(void);
 int  Generate(PHONEME_LIST *phoneme_list, int *n_ph, bool resume);
 int  SpeakNextClause(int control);
+int  TranslateNextClause(void);
+int  StoreClause(void *clause);
+void GenerateClause(const void *clause);
+int  GenerateClauseNext(void);
+void AbortClause(void);
 void SetSpeed(int control);
 void SetEmbedded(int control, int value);
 int FormantTransition2(frameref_t *seq, int *n_frames, unsigned int data1, unsigned int data2, PHONEME_TAB *other_ph, int which);
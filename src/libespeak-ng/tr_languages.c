@@ -259,6 +259,7 @@ static Translator *NewTranslator(void)
 	tr->dict_min_size = 0;
 	tr->data_dictrules = NULL; // language_1   translation rules file
 	tr->data_dictlist = NULL;  // language_2   dictionary lookup file
+	tr->dict_index_start = NULL; // set up by LoadDictionary() if an index is installed
 
 	tr->transpose_min = 0x60;
 	tr->transpose_max = 0x17f;
@@ -55,6 +55,7 @@
 #include "voice.h"                // for voice, voice_t
 #include "speech.h"               // for MAKE_MEM_UNDEFINED
 #include "translateword.h"
+#include "context.h"              // for CONTEXT_VAR
 
 static int CalcWordLength(int source_index, int charix_top, short int *charix, WORD_TAB *words, int word_count);
 static void CombineFlag(Translator *tr, WORD_TAB *wtab, char *word, int *flags, unsigned char *p, char *word_phonemes);
@@ -793,13 +794,15 @@ static const char *FindReplacementChars(Translator *tr, const char **pfrom, unsi
 	return NULL;
 }
 
+// characters after a .replace match which have been replaced along with it
+static int ignore_next_n = 0;
+
 // handle .replace rule in xx_rules file
 static int SubstituteChar(Translator *tr, unsigned int c, unsigned int next_in, const char *next, int *insert, int *wordflags)
 {
 	unsigned int new_c, c2 = ' ', c_lower;
 	int upper_case = 0;
 
-	static int ignore_next_n = 0;
 	if (ignore_next_n > 0) {
 		ignore_next_n--;
 		return 8;
@@ -982,9 +985,11 @@ void TranslateClauseWithTerminator(Translator *tr, int *tone_out, char **voice_c
 	if (tr == NULL)
 		return;
 
-        charix = (short *)malloc((N_TR_SOURCE+4) * sizeof(short));
-        words = (WORD_TAB *)malloc(N_CLAUSE_WORDS * sizeof(WORD_TAB));
-        sbuf = (char*)malloc(N_TR_SOURCE);
+        // EFP3 - All of the clause's working buffers are released at the end in one go
+        size_t arena = arena_mark();
+        charix = (short *)arena_alloc((N_TR_SOURCE+4) * sizeof(short));
+        words = (WORD_TAB *)arena_alloc(N_CLAUSE_WORDS * sizeof(WORD_TAB));
+        sbuf = (char*)arena_alloc(N_TR_SOURCE);
 
 	MAKE_MEM_UNDEFINED(&voice_change_name, sizeof(voice_change_name));
 
@@ -1510,7 +1515,7 @@ void TranslateClauseWithTerminator(Translator *tr, int *tone_out, char **voice_c
 	// and after this loop we require 2 phonemes
 	char number_buf[150];
 	WORD_TAB *num_wtab; // EFP3 [N_CLAUSE_WORDS]; // copy of 'words', when splitting numbers into parts
-        num_wtab = (WORD_TAB *)malloc(N_CLAUSE_WORDS * sizeof(WORD_TAB));
+        num_wtab = (WORD_TAB *)arena_alloc(N_CLAUSE_WORDS * sizeof(WORD_TAB));
 	for (ix = 0; ix < word_count && (n_ph_list2 < N_PHONEME_LIST-7-2); ix++) {
 		int nx;
 		int c_temp;
@@ -1651,7 +1656,6 @@ void TranslateClauseWithTerminator(Translator *tr, int *tone_out, char **voice_c
 			}
 		}
 	}
-        free(num_wtab);
 
 	if (embedded_read < embedded_ix) {
 		// any embedded commands not yet processed?
@@ -1693,9 +1697,7 @@ void TranslateClauseWithTerminator(Translator *tr, int *tone_out, char **voice_c
 		else
 			*voice_change = NULL;
 	}
-        free(sbuf);
-        free(words);
-        free(charix);
+        arena_release(arena);
 }
 
 void TranslateClause(Translator *tr, int *tone_out, char **voice_change)
@@ -1804,6 +1806,12 @@ static void SwitchLanguage(char *word, char *word_phonemes) {
 	}
 }
 
+int EmbeddedListLength(void)
+{
+	// Entries used by the last translated clause, plus the terminating entry
+	return (embedded_ix + 1 < N_EMBEDDED_LIST) ? embedded_ix + 1 : N_EMBEDDED_LIST;
+}
+
 void InitText(int control)
 {
 	count_sentences = 0;
@@ -1827,3 +1835,29 @@ void InitText(int control)
 	if ((control & espeakKEEP_NAMEDATA) == 0)
 		InitNamedata();
 }
+
+// Translation state which belongs to each speech context
+const CONTEXT_VAR translate_context_vars[] = {
+	CONTEXT_VAR_ITEM(translator),
+	CONTEXT_VAR_ITEM(option_tone_flags), CONTEXT_VAR_ITEM(option_capitals), CONTEXT_VAR_ITEM(option_punctuation),
+	CONTEXT_VAR_ITEM(option_sayas), CONTEXT_VAR_ITEM(option_sayas2), CONTEXT_VAR_ITEM(option_emphasis),
+	CONTEXT_VAR_ITEM(option_wordgap), CONTEXT_VAR_ITEM(option_linelength), CONTEXT_VAR_ITEM(option_punctlist),
+	CONTEXT_VAR_ITEM(count_sayas_digits), CONTEXT_VAR_ITEM(skip_sentences), CONTEXT_VAR_ITEM(skip_words),
+	CONTEXT_VAR_ITEM(skip_characters), CONTEXT_VAR_ITEM(skip_marker), CONTEXT_VAR_ITEM(skipping_text),
+	CONTEXT_VAR_ITEM(end_character_position), CONTEXT_VAR_ITEM(count_sentences), CONTEXT_VAR_ITEM(count_words),
+	CONTEXT_VAR_ITEM(clause_start_char), CONTEXT_VAR_ITEM(clause_start_word), CONTEXT_VAR_ITEM(new_sentence),
+	CONTEXT_VAR_ITEM(word_emphasis), CONTEXT_VAR_ITEM(embedded_flag), CONTEXT_VAR_ITEM(max_clause_pause),
+	CONTEXT_VAR_ITEM(any_stressed_words), CONTEXT_VAR_ITEM(pre_pause), CONTEXT_VAR_ITEM(current_alphabet),
+	CONTEXT_VAR_ITEM(n_replace_phonemes), CONTEXT_VAR_ITEM(replace_phonemes),
+	CONTEXT_VAR_ITEM(ignore_next_n),
+	CONTEXT_VAR_END
+};
+
+void TranslateResetContext(void)
+{
+	// No translator of its own until a voice is selected, so the creating context's is never deleted by this one
+	translator = NULL;
+	n_replace_phonemes = 0;
+	skipping_text = false;
+	ignore_next_n = 0;
+}
@@ -580,6 +580,9 @@ typedef struct {
 	const char *data_dictrules;     // language_1   translation rules file
 	const char *data_dictlist;      // language_2   dictionary lookup file
 	char *dict_hashtab[N_HASH_DICT];   // hash table to index dictionary lookup file
+	const unsigned short *dict_index_start; // optional precomputed index into the hash chains, see DICT_INDEX
+	const unsigned char *dict_index_fp;
+	const unsigned short *dict_index_offset;
 	char *letterGroups[N_LETTER_GROUPS];
 
 	// groups1 and groups2 are indexes into data_dictrules, set up by InitGroups()
@@ -661,6 +664,7 @@ int lookupwchar(const unsigned short *list, int c);
 char *strchr_w(const char *s, int c);
 void InitNamedata(void);
 void InitText(int flags);
+int EmbeddedListLength(void);
 void InitText2(void);
 const ALPHABET *AlphabetFromChar(int c);
 
@@ -62,7 +62,7 @@ static int Unpronouncable(Translator *tr, char *word, int posn);
 static int Unpronouncable2(Translator *tr, char *word);
 
 // EFP3 - Forgive me for this hack to let me move the large arrays to heap alloc/dealloc....no C++ object dectructors here in C-land.
-#define return_and_free(x) {free(phonemes); free(phonemes2); free(prefix_phonemes); free(unpron_phonemes); free(end_phonemes); free(end_phonemes2); free(word_copy); free(word_copy2); return (x);}
+#define return_and_free(x) {arena_release(arena); return (x);}
 int TranslateWord3(Translator *tr, char *word_start, WORD_TAB *wtab, char *word_out, bool *any_stressed_words, ALPHABET *current_alphabet, char word_phonemes[], size_t size_word_phonemes)
 {
 	// word1 is terminated by space (0x20) character
@@ -80,22 +80,23 @@ int TranslateWord3(Translator *tr, char *word_start, WORD_TAB *wtab, char *word_
 	int prefix_type = 0;
 	int prefix_stress;
 	char *wordx;
+	size_t arena = arena_mark();
 	char *phonemes;//[N_WORD_PHONEMES];
-        phonemes = (char *)malloc(N_WORD_PHONEMES);
+        phonemes = (char *)arena_alloc(N_WORD_PHONEMES);
 	char *phonemes2;//[N_WORD_PHONEMES];
-        phonemes2 = (char *)malloc(N_WORD_PHONEMES);
+        phonemes2 = (char *)arena_alloc(N_WORD_PHONEMES);
 	char *prefix_phonemes;//[N_WORD_PHONEMES];
-        prefix_phonemes = (char *)malloc(N_WORD_PHONEMES);
+        prefix_phonemes = (char *)arena_alloc(N_WORD_PHONEMES);
 	char *unpron_phonemes;//[N_WORD_PHONEMES];
-        unpron_phonemes = (char *)malloc(N_WORD_PHONEMES);
+        unpron_phonemes = (char *)arena_alloc(N_WORD_PHONEMES);
 	char *end_phonemes;//[N_WORD_PHONEMES];
-        end_phonemes = (char *)malloc(N_WORD_PHONEMES);
+        end_phonemes = (char *)arena_alloc(N_WORD_PHONEMES);
 	char *end_phonemes2;//[N_WORD_PHONEMES];
-        end_phonemes2 = (char *)malloc(N_WORD_PHONEMES);
+        end_phonemes2 = (char *)arena_alloc(N_WORD_PHONEMES);
 	char *word_copy;//[N_WORD_BYTES];
-        word_copy = (char *)malloc(N_WORD_BYTES);
+        word_copy = (char *)arena_alloc(N_WORD_BYTES);
 	char *word_copy2;//[N_WORD_BYTES];
-        word_copy2 = (char *)malloc(N_WORD_BYTES);
+        word_copy2 = (char *)arena_alloc(N_WORD_BYTES);
 	int word_copy_length;
 	char prefix_chars[0x3f + 2];
 	bool found = false;
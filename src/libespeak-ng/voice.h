@@ -196,6 +196,7 @@ espeak_VOICE *SelectVoiceByName(espeak_VOICE **voices, const char *name);
 voice_t *LoadVoice(const char *voice_name, int control);
 voice_t *LoadVoiceVariant(const char *voice_name, int variant);
 espeak_ng_STATUS DoVoiceChange(voice_t *v);
+void GenerateVoice(voice_t *v, Translator *tr);
 void WavegenSetVoice(voice_t *v);
 void ReadNumbers(char *p, int *flags, int maxValue,  const MNEM_TAB *keyword_tab, int key);
 int Read8Numbers(char *data_in, int data[8]);
@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/af_dict.h>
 const unsigned char __rawdata_af[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x41, 0x66, 0x72, 0x69, 0x6b, 0x61, 0x61,
   0x6e, 0x73, 0x0a, 0x6c, 0x61, 0x6e, 0x67, 0x75, 0x61, 0x67, 0x65, 0x20,
@@ -18,6 +19,6 @@ const unsigned char __rawdata_af[] = {
 BackgroundAudioVoice voice_af = {
     "Afrikaans",
     123,
-    __rawdata_af
+    __rawdata_af,
+    &dict_af
 };
-#include <libespeak-ng/dict/af_dict.h>
@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/am_dict.h>
 const unsigned char __rawdata_am[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x41, 0x6d, 0x68, 0x61, 0x72, 0x69, 0x63,
   0x0a, 0x6c, 0x61, 0x6e, 0x67, 0x75, 0x61, 0x67, 0x65, 0x20, 0x61, 0x6d,
@@ -11,6 +12,6 @@ const unsigned char __rawdata_am[] = {
 BackgroundAudioVoice voice_am = {
     "Amharic",
     41,
-    __rawdata_am
+    __rawdata_am,
+    &dict_am
 };
-#include <libespeak-ng/dict/am_dict.h>
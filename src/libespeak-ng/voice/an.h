@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/an_dict.h>
 const unsigned char __rawdata_an[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x41, 0x72, 0x61, 0x67, 0x6f, 0x6e, 0x65,
   0x73, 0x65, 0x0a, 0x6c, 0x61, 0x6e, 0x67, 0x75, 0x61, 0x67, 0x65, 0x20,
@@ -10,6 +11,6 @@ const unsigned char __rawdata_an[] = {
 BackgroundAudioVoice voice_an = {
     "Aragonese",
     27,
-    __rawdata_an
+    __rawdata_an,
+    &dict_an
 };
-#include <libespeak-ng/dict/an_dict.h>
@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/ar_dict.h>
 const unsigned char __rawdata_ar[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x41, 0x72, 0x61, 0x62, 0x69, 0x63, 0x0a,
   0x6c, 0x61, 0x6e, 0x67, 0x75, 0x61, 0x67, 0x65, 0x20, 0x61, 0x72, 0x0a,
@@ -12,6 +13,6 @@ const unsigned char __rawdata_ar[] = {
 BackgroundAudioVoice voice_ar = {
     "Arabic",
     50,
-    __rawdata_ar
+    __rawdata_ar,
+    &dict_ar
 };
-#include <libespeak-ng/dict/ar_dict.h>
@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/as_dict.h>
 const unsigned char __rawdata_as[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x41, 0x73, 0x73, 0x61, 0x6d, 0x65, 0x73,
   0x65, 0x0a, 0x6c, 0x61, 0x6e, 0x67, 0x75, 0x61, 0x67, 0x65, 0x20, 0x61,
@@ -11,6 +12,6 @@ const unsigned char __rawdata_as[] = {
 BackgroundAudioVoice voice_as = {
     "Assamese",
     42,
-    __rawdata_as
+    __rawdata_as,
+    &dict_as
 };
-#include <libespeak-ng/dict/as_dict.h>
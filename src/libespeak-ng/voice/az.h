@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/az_dict.h>
 const unsigned char __rawdata_az[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x41, 0x7a, 0x65, 0x72, 0x62, 0x61, 0x69,
   0x6a, 0x61, 0x6e, 0x69, 0x0a, 0x6c, 0x61, 0x6e, 0x67, 0x75, 0x61, 0x67,
@@ -11,6 +12,6 @@ const unsigned char __rawdata_az[] = {
 BackgroundAudioVoice voice_az = {
     "Azerbaijani",
     45,
-    __rawdata_az
+    __rawdata_az,
+    &dict_az
 };
-#include <libespeak-ng/dict/az_dict.h>
@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/be_dict.h>
 const unsigned char __rawdata_be[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x42, 0x65, 0x6c, 0x61, 0x72, 0x75, 0x73,
   0x69, 0x61, 0x6e, 0x0a, 0x6c, 0x61, 0x6e, 0x67, 0x75, 0x61, 0x67, 0x65,
@@ -12,6 +13,6 @@ const unsigned char __rawdata_be[] = {
 BackgroundAudioVoice voice_be = {
     "Belarusian",
     52,
-    __rawdata_be
+    __rawdata_be,
+    &dict_be
 };
-#include <libespeak-ng/dict/be_dict.h>
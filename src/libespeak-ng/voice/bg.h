@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/bg_dict.h>
 const unsigned char __rawdata_bg[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x42, 0x75, 0x6c, 0x67, 0x61, 0x72, 0x69,
   0x61, 0x6e, 0x0a, 0x6c, 0x61, 0x6e, 0x67, 0x75, 0x61, 0x67, 0x65, 0x20,
@@ -17,6 +18,6 @@ const unsigned char __rawdata_bg[] = {
 BackgroundAudioVoice voice_bg = {
     "Bulgarian",
     111,
-    __rawdata_bg
+    __rawdata_bg,
+    &dict_bg
 };
-#include <libespeak-ng/dict/bg_dict.h>
@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/bpy_dict.h>
 const unsigned char __rawdata_bpy[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x42, 0x69, 0x73, 0x68, 0x6e, 0x75, 0x70,
   0x72, 0x69, 0x79, 0x61, 0x20, 0x4d, 0x61, 0x6e, 0x69, 0x70, 0x75, 0x72,
@@ -11,6 +12,6 @@ const unsigned char __rawdata_bpy[] = {
 BackgroundAudioVoice voice_bpy = {
     "Bishnupriya Manipuri",
     39,
-    __rawdata_bpy
+    __rawdata_bpy,
+    &dict_bpy
 };
-#include <libespeak-ng/dict/bpy_dict.h>
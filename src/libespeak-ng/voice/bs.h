@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/bs_dict.h>
 const unsigned char __rawdata_bs[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x42, 0x6f, 0x73, 0x6e, 0x69, 0x61, 0x6e,
   0x0a, 0x6c, 0x61, 0x6e, 0x67, 0x75, 0x61, 0x67, 0x65, 0x20, 0x62, 0x73,
@@ -27,6 +28,6 @@ const unsigned char __rawdata_bs[] = {
 BackgroundAudioVoice voice_bs = {
     "Bosnian",
     230,
-    __rawdata_bs
+    __rawdata_bs,
+    &dict_bs
 };
-#include <libespeak-ng/dict/bs_dict.h>
@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/ca_dict.h>
 const unsigned char __rawdata_ca[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x43, 0x61, 0x74, 0x61, 0x6c, 0x61, 0x6e,
   0x0a, 0x6c, 0x61, 0x6e, 0x67, 0x75, 0x61, 0x67, 0x65, 0x20, 0x63, 0x61,
@@ -11,6 +12,6 @@ const unsigned char __rawdata_ca[] = {
 BackgroundAudioVoice voice_ca = {
     "Catalan",
     38,
-    __rawdata_ca
+    __rawdata_ca,
+    &dict_ca
 };
-#include <libespeak-ng/dict/ca_dict.h>
@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/ca_dict.h>
 const unsigned char __rawdata_ca_ba[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x43, 0x61, 0x74, 0x61, 0x6c, 0x61, 0x6e,
   0x20, 0x28, 0x42, 0x61, 0x6c, 0x65, 0x61, 0x72, 0x69, 0x63, 0x29, 0x0a,
@@ -14,6 +15,6 @@ const unsigned char __rawdata_ca_ba[] = {
 BackgroundAudioVoice voice_ca_ba = {
     "Catalan (Balearic)",
     80,
-    __rawdata_ca_ba
+    __rawdata_ca_ba,
+    &dict_ca
 };
-#include <libespeak-ng/dict/ca_dict.h>
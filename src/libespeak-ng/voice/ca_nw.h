@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/ca_dict.h>
 const unsigned char __rawdata_ca_nw[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x43, 0x61, 0x74, 0x61, 0x6c, 0x61, 0x6e,
   0x20, 0x28, 0x4e, 0x6f, 0x72, 0x74, 0x68, 0x2d, 0x77, 0x65, 0x73, 0x74,
@@ -14,6 +15,6 @@ const unsigned char __rawdata_ca_nw[] = {
 BackgroundAudioVoice voice_ca_nw = {
     "Catalan (North-western)",
     73,
-    __rawdata_ca_nw
+    __rawdata_ca_nw,
+    &dict_ca
 };
-#include <libespeak-ng/dict/ca_dict.h>
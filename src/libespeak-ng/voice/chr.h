@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/chr_dict.h>
 const unsigned char __rawdata_chr[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x43, 0x68, 0x65, 0x72, 0x6f, 0x6b, 0x65,
   0x65, 0x20, 0x2f, 0x2f, 0x68, 0x74, 0x74, 0x70, 0x73, 0x3a, 0x2f, 0x2f,
@@ -55,6 +56,6 @@ const unsigned char __rawdata_chr[] = {
 BackgroundAudioVoice voice_chr = {
     "Cherokee ",
     569,
-    __rawdata_chr
+    __rawdata_chr,
+    &dict_chr
 };
-#include <libespeak-ng/dict/chr_dict.h>
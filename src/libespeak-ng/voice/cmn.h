@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/cmn_dict.h>
 const unsigned char __rawdata_cmn[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x43, 0x68, 0x69, 0x6e, 0x65, 0x73, 0x65,
   0x20, 0x28, 0x4d, 0x61, 0x6e, 0x64, 0x61, 0x72, 0x69, 0x6e, 0x2c, 0x20,
@@ -65,6 +66,6 @@ const unsigned char __rawdata_cmn[] = {
 BackgroundAudioVoice voice_cmn = {
     "Chinese (Mandarin, latin as English)",
     686,
-    __rawdata_cmn
+    __rawdata_cmn,
+    &dict_cmn
 };
-#include <libespeak-ng/dict/cmn_dict.h>
@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/cmn_dict.h>
 const unsigned char __rawdata_cmn_latn_pinyin[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x43, 0x68, 0x69, 0x6e, 0x65, 0x73, 0x65,
   0x20, 0x28, 0x4d, 0x61, 0x6e, 0x64, 0x61, 0x72, 0x69, 0x6e, 0x2c, 0x20,
@@ -21,6 +22,6 @@ const unsigned char __rawdata_cmn_latn_pinyin[] = {
 BackgroundAudioVoice voice_cmn_latn_pinyin = {
     "Chinese (Mandarin, latin as Pinyin)",
     161,
-    __rawdata_cmn_latn_pinyin
+    __rawdata_cmn_latn_pinyin,
+    &dict_cmn
 };
-#include <libespeak-ng/dict/cmn_dict.h>
@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/cs_dict.h>
 const unsigned char __rawdata_cs[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x43, 0x7a, 0x65, 0x63, 0x68, 0x0a, 0x6c,
   0x61, 0x6e, 0x67, 0x75, 0x61, 0x67, 0x65, 0x20, 0x63, 0x73, 0x0a
@@ -9,6 +10,6 @@ const unsigned char __rawdata_cs[] = {
 BackgroundAudioVoice voice_cs = {
     "Czech",
     23,
-    __rawdata_cs
+    __rawdata_cs,
+    &dict_cs
 };
-#include <libespeak-ng/dict/cs_dict.h>
@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/cv_dict.h>
 const unsigned char __rawdata_cv[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x43, 0x68, 0x75, 0x76, 0x61, 0x73, 0x68,
   0x0a, 0x6c, 0x61, 0x6e, 0x67, 0x75, 0x61, 0x67, 0x65, 0x20, 0x63, 0x76,
@@ -11,6 +12,6 @@ const unsigned char __rawdata_cv[] = {
 BackgroundAudioVoice voice_cv = {
     "Chuvash",
     40,
-    __rawdata_cv
+    __rawdata_cv,
+    &dict_cv
 };
-#include <libespeak-ng/dict/cv_dict.h>
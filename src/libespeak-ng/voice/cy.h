@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/cy_dict.h>
 const unsigned char __rawdata_cy[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x57, 0x65, 0x6c, 0x73, 0x68, 0x0a, 0x6c,
   0x61, 0x6e, 0x67, 0x75, 0x61, 0x67, 0x65, 0x20, 0x63, 0x79, 0x0a, 0x0a,
@@ -11,6 +12,6 @@ const unsigned char __rawdata_cy[] = {
 BackgroundAudioVoice voice_cy = {
     "Welsh",
     37,
-    __rawdata_cy
+    __rawdata_cy,
+    &dict_cy
 };
-#include <libespeak-ng/dict/cy_dict.h>
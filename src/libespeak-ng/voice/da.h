@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/da_dict.h>
 const unsigned char __rawdata_da[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x44, 0x61, 0x6e, 0x69, 0x73, 0x68, 0x0a,
   0x6c, 0x61, 0x6e, 0x67, 0x75, 0x61, 0x67, 0x65, 0x20, 0x64, 0x61, 0x0a,
@@ -11,6 +12,6 @@ const unsigned char __rawdata_da[] = {
 BackgroundAudioVoice voice_da = {
     "Danish",
     43,
-    __rawdata_da
+    __rawdata_da,
+    &dict_da
 };
-#include <libespeak-ng/dict/da_dict.h>
@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/de_dict.h>
 const unsigned char __rawdata_de[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x47, 0x65, 0x72, 0x6d, 0x61, 0x6e, 0x0a,
   0x6c, 0x61, 0x6e, 0x67, 0x75, 0x61, 0x67, 0x65, 0x20, 0x64, 0x65, 0x0a,
@@ -11,6 +12,6 @@ const unsigned char __rawdata_de[] = {
 BackgroundAudioVoice voice_de = {
     "German",
     42,
-    __rawdata_de
+    __rawdata_de,
+    &dict_de
 };
-#include <libespeak-ng/dict/de_dict.h>
@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/el_dict.h>
 const unsigned char __rawdata_el[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x47, 0x72, 0x65, 0x65, 0x6b, 0x0a, 0x6c,
   0x61, 0x6e, 0x67, 0x75, 0x61, 0x67, 0x65, 0x20, 0x65, 0x6c, 0x0a
@@ -9,6 +10,6 @@ const unsigned char __rawdata_el[] = {
 BackgroundAudioVoice voice_el = {
     "Greek",
     23,
-    __rawdata_el
+    __rawdata_el,
+    &dict_el
 };
-#include <libespeak-ng/dict/el_dict.h>
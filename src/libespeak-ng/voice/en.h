@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/en_dict.h>
 const unsigned char __rawdata_en[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x45, 0x6e, 0x67, 0x6c, 0x69, 0x73, 0x68,
   0x20, 0x28, 0x47, 0x72, 0x65, 0x61, 0x74, 0x20, 0x42, 0x72, 0x69, 0x74,
@@ -19,6 +20,6 @@ const unsigned char __rawdata_en[] = {
 BackgroundAudioVoice voice_en = {
     "English (Great Britain)",
     140,
-    __rawdata_en
+    __rawdata_en,
+    &dict_en
 };
-#include <libespeak-ng/dict/en_dict.h>
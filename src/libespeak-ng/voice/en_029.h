@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/en_dict.h>
 const unsigned char __rawdata_en_029[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x45, 0x6e, 0x67, 0x6c, 0x69, 0x73, 0x68,
   0x20, 0x28, 0x43, 0x61, 0x72, 0x69, 0x62, 0x62, 0x65, 0x61, 0x6e, 0x29,
@@ -35,6 +36,6 @@ const unsigned char __rawdata_en_029[] = {
 BackgroundAudioVoice voice_en_029 = {
     "English (Caribbean)",
     335,
-    __rawdata_en_029
+    __rawdata_en_029,
+    &dict_en
 };
-#include <libespeak-ng/dict/en_dict.h>
@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/en_dict.h>
 const unsigned char __rawdata_en_gb_scotland[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x45, 0x6e, 0x67, 0x6c, 0x69, 0x73, 0x68,
   0x20, 0x28, 0x53, 0x63, 0x6f, 0x74, 0x6c, 0x61, 0x6e, 0x64, 0x29, 0x0a,
@@ -32,6 +33,6 @@ const unsigned char __rawdata_en_gb_scotland[] = {
 BackgroundAudioVoice voice_en_gb_scotland = {
     "English (Scotland)",
     295,
-    __rawdata_en_gb_scotland
+    __rawdata_en_gb_scotland,
+    &dict_en
 };
-#include <libespeak-ng/dict/en_dict.h>
@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/en_dict.h>
 const unsigned char __rawdata_en_gb_x_gbcwmd[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x45, 0x6e, 0x67, 0x6c, 0x69, 0x73, 0x68,
   0x20, 0x28, 0x57, 0x65, 0x73, 0x74, 0x20, 0x4d, 0x69, 0x64, 0x6c, 0x61,
@@ -23,6 +24,6 @@ const unsigned char __rawdata_en_gb_x_gbcwmd[] = {
 BackgroundAudioVoice voice_en_gb_x_gbcwmd = {
     "English (West Midlands)",
     188,
-    __rawdata_en_gb_x_gbcwmd
+    __rawdata_en_gb_x_gbcwmd,
+    &dict_en
 };
-#include <libespeak-ng/dict/en_dict.h>
@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/en_dict.h>
 const unsigned char __rawdata_en_gb_x_rp[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x45, 0x6e, 0x67, 0x6c, 0x69, 0x73, 0x68,
   0x20, 0x28, 0x52, 0x65, 0x63, 0x65, 0x69, 0x76, 0x65, 0x64, 0x20, 0x50,
@@ -28,6 +29,6 @@ const unsigned char __rawdata_en_gb_x_rp[] = {
 BackgroundAudioVoice voice_en_gb_x_rp = {
     "English (Received Pronunciation)",
     249,
-    __rawdata_en_gb_x_rp
+    __rawdata_en_gb_x_rp,
+    &dict_en
 };
-#include <libespeak-ng/dict/en_dict.h>
@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/en_dict.h>
 const unsigned char __rawdata_en_shaw[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x45, 0x6e, 0x67, 0x6c, 0x69, 0x73, 0x68,
   0x20, 0x28, 0x53, 0x68, 0x61, 0x76, 0x69, 0x61, 0x6e, 0x20, 0x61, 0x6c,
@@ -17,6 +18,6 @@ const unsigned char __rawdata_en_shaw[] = {
 BackgroundAudioVoice voice_en_shaw = {
     "English (Shavian alphabet)",
     119,
-    __rawdata_en_shaw
+    __rawdata_en_shaw,
+    &dict_en
 };
-#include <libespeak-ng/dict/en_dict.h>
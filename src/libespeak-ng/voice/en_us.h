@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/en_dict.h>
 const unsigned char __rawdata_en_us[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x45, 0x6e, 0x67, 0x6c, 0x69, 0x73, 0x68,
   0x20, 0x28, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x29, 0x0a, 0x6c,
@@ -29,6 +30,6 @@ const unsigned char __rawdata_en_us[] = {
 BackgroundAudioVoice voice_en_us = {
     "English (America)",
     257,
-    __rawdata_en_us
+    __rawdata_en_us,
+    &dict_en
 };
-#include <libespeak-ng/dict/en_dict.h>
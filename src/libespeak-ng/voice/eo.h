@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/eo_dict.h>
 const unsigned char __rawdata_eo[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x45, 0x73, 0x70, 0x65, 0x72, 0x61, 0x6e,
   0x74, 0x6f, 0x0a, 0x6c, 0x61, 0x6e, 0x67, 0x75, 0x61, 0x67, 0x65, 0x20,
@@ -11,6 +12,6 @@ const unsigned char __rawdata_eo[] = {
 BackgroundAudioVoice voice_eo = {
     "Esperanto",
     41,
-    __rawdata_eo
+    __rawdata_eo,
+    &dict_eo
 };
-#include <libespeak-ng/dict/eo_dict.h>
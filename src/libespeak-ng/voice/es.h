@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/es_dict.h>
 const unsigned char __rawdata_es[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x53, 0x70, 0x61, 0x6e, 0x69, 0x73, 0x68,
   0x20, 0x28, 0x53, 0x70, 0x61, 0x69, 0x6e, 0x29, 0x0a, 0x6c, 0x61, 0x6e,
@@ -13,6 +14,6 @@ const unsigned char __rawdata_es[] = {
 BackgroundAudioVoice voice_es = {
     "Spanish (Spain)",
     63,
-    __rawdata_es
+    __rawdata_es,
+    &dict_es
 };
-#include <libespeak-ng/dict/es_dict.h>
@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/es_dict.h>
 const unsigned char __rawdata_es_419[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x53, 0x70, 0x61, 0x6e, 0x69, 0x73, 0x68,
   0x20, 0x28, 0x4c, 0x61, 0x74, 0x69, 0x6e, 0x20, 0x41, 0x6d, 0x65, 0x72,
@@ -21,6 +22,6 @@ const unsigned char __rawdata_es_419[] = {
 BackgroundAudioVoice voice_es_419 = {
     "Spanish (Latin America)",
     167,
-    __rawdata_es_419
+    __rawdata_es_419,
+    &dict_es
 };
-#include <libespeak-ng/dict/es_dict.h>
@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/et_dict.h>
 const unsigned char __rawdata_et[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x45, 0x73, 0x74, 0x6f, 0x6e, 0x69, 0x61,
   0x6e, 0x0a, 0x6c, 0x61, 0x6e, 0x67, 0x75, 0x61, 0x67, 0x65, 0x20, 0x65,
@@ -27,6 +28,6 @@ const unsigned char __rawdata_et[] = {
 BackgroundAudioVoice voice_et = {
     "Estonian",
     237,
-    __rawdata_et
+    __rawdata_et,
+    &dict_et
 };
-#include <libespeak-ng/dict/et_dict.h>
@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/eu_dict.h>
 const unsigned char __rawdata_eu[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x42, 0x61, 0x73, 0x71, 0x75, 0x65, 0x0a,
   0x6c, 0x61, 0x6e, 0x67, 0x75, 0x61, 0x67, 0x65, 0x20, 0x65, 0x75, 0x0a,
@@ -12,6 +13,6 @@ const unsigned char __rawdata_eu[] = {
 BackgroundAudioVoice voice_eu = {
     "Basque",
     54,
-    __rawdata_eu
+    __rawdata_eu,
+    &dict_eu
 };
-#include <libespeak-ng/dict/eu_dict.h>
@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/fa_dict.h>
 const unsigned char __rawdata_fa[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x50, 0x65, 0x72, 0x73, 0x69, 0x61, 0x6e,
   0x0a, 0x6c, 0x61, 0x6e, 0x67, 0x75, 0x61, 0x67, 0x65, 0x20, 0x66, 0x61,
@@ -15,6 +16,6 @@ const unsigned char __rawdata_fa[] = {
 BackgroundAudioVoice voice_fa = {
     "Persian",
     90,
-    __rawdata_fa
+    __rawdata_fa,
+    &dict_fa
 };
-#include <libespeak-ng/dict/fa_dict.h>
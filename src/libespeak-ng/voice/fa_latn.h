@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/fa_dict.h>
 const unsigned char __rawdata_fa_latn[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x50, 0x65, 0x72, 0x73, 0x69, 0x61, 0x6e,
   0x20, 0x28, 0x50, 0x69, 0x6e, 0x67, 0x6c, 0x69, 0x73, 0x68, 0x29, 0x0a,
@@ -30,6 +31,6 @@ const unsigned char __rawdata_fa_latn[] = {
 BackgroundAudioVoice voice_fa_latn = {
     "Persian (Pinglish)",
     269,
-    __rawdata_fa_latn
+    __rawdata_fa_latn,
+    &dict_fa
 };
-#include <libespeak-ng/dict/fa_dict.h>
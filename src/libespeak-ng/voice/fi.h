@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/fi_dict.h>
 const unsigned char __rawdata_fi[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x46, 0x69, 0x6e, 0x6e, 0x69, 0x73, 0x68,
   0x0a, 0x6c, 0x61, 0x6e, 0x67, 0x75, 0x61, 0x67, 0x65, 0x20, 0x66, 0x69,
@@ -27,6 +28,6 @@ const unsigned char __rawdata_fi[] = {
 BackgroundAudioVoice voice_fi = {
     "Finnish",
     237,
-    __rawdata_fi
+    __rawdata_fi,
+    &dict_fi
 };
-#include <libespeak-ng/dict/fi_dict.h>
@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/fo_dict.h>
 const unsigned char __rawdata_fo[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x46, 0x61, 0x72, 0x6f, 0x65, 0x73, 0x65,
   0x0a, 0x6c, 0x61, 0x6e, 0x67, 0x75, 0x61, 0x67, 0x65, 0x20, 0x66, 0x6f,
@@ -16,6 +17,6 @@ const unsigned char __rawdata_fo[] = {
 BackgroundAudioVoice voice_fo = {
     "Faroese",
     104,
-    __rawdata_fo
+    __rawdata_fo,
+    &dict_fo
 };
-#include <libespeak-ng/dict/fo_dict.h>
@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/fr_dict.h>
 const unsigned char __rawdata_fr_be[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x46, 0x72, 0x65, 0x6e, 0x63, 0x68, 0x20,
   0x28, 0x42, 0x65, 0x6c, 0x67, 0x69, 0x75, 0x6d, 0x29, 0x0a, 0x6c, 0x61,
@@ -14,6 +15,6 @@ const unsigned char __rawdata_fr_be[] = {
 BackgroundAudioVoice voice_fr_be = {
     "French (Belgium)",
     84,
-    __rawdata_fr_be
+    __rawdata_fr_be,
+    &dict_fr
 };
-#include <libespeak-ng/dict/fr_dict.h>
@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/fr_dict.h>
 const unsigned char __rawdata_fr_ch[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x46, 0x72, 0x65, 0x6e, 0x63, 0x68, 0x20,
   0x28, 0x53, 0x77, 0x69, 0x74, 0x7a, 0x65, 0x72, 0x6c, 0x61, 0x6e, 0x64,
@@ -15,6 +16,6 @@ const unsigned char __rawdata_fr_ch[] = {
 BackgroundAudioVoice voice_fr_ch = {
     "French (Switzerland)",
     86,
-    __rawdata_fr_ch
+    __rawdata_fr_ch,
+    &dict_fr
 };
-#include <libespeak-ng/dict/fr_dict.h>
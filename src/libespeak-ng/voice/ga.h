@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/ga_dict.h>
 const unsigned char __rawdata_ga[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x47, 0x61, 0x65, 0x6c, 0x69, 0x63, 0x20,
   0x28, 0x49, 0x72, 0x69, 0x73, 0x68, 0x29, 0x0a, 0x6c, 0x61, 0x6e, 0x67,
@@ -13,6 +14,6 @@ const unsigned char __rawdata_ga[] = {
 BackgroundAudioVoice voice_ga = {
     "Gaelic (Irish)",
     66,
-    __rawdata_ga
+    __rawdata_ga,
+    &dict_ga
 };
-#include <libespeak-ng/dict/ga_dict.h>
@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/gd_dict.h>
 const unsigned char __rawdata_gd[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x47, 0x61, 0x65, 0x6c, 0x69, 0x63, 0x20,
   0x28, 0x53, 0x63, 0x6f, 0x74, 0x74, 0x69, 0x73, 0x68, 0x29, 0x0a, 0x6c,
@@ -12,6 +13,6 @@ const unsigned char __rawdata_gd[] = {
 BackgroundAudioVoice voice_gd = {
     "Gaelic (Scottish)",
     51,
-    __rawdata_gd
+    __rawdata_gd,
+    &dict_gd
 };
-#include <libespeak-ng/dict/gd_dict.h>
@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/gn_dict.h>
 const unsigned char __rawdata_gn[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x47, 0x75, 0x61, 0x72, 0x61, 0x6e, 0x69,
   0x0a, 0x6c, 0x61, 0x6e, 0x67, 0x75, 0x61, 0x67, 0x65, 0x20, 0x67, 0x6e,
@@ -11,6 +12,6 @@ const unsigned char __rawdata_gn[] = {
 BackgroundAudioVoice voice_gn = {
     "Guarani",
     47,
-    __rawdata_gn
+    __rawdata_gn,
+    &dict_gn
 };
-#include <libespeak-ng/dict/gn_dict.h>
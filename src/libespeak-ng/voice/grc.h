@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/grc_dict.h>
 const unsigned char __rawdata_grc[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x47, 0x72, 0x65, 0x65, 0x6b, 0x20, 0x28,
   0x41, 0x6e, 0x63, 0x69, 0x65, 0x6e, 0x74, 0x29, 0x0a, 0x6c, 0x61, 0x6e,
@@ -16,6 +17,6 @@ const unsigned char __rawdata_grc[] = {
 BackgroundAudioVoice voice_grc = {
     "Greek (Ancient)",
     99,
-    __rawdata_grc
+    __rawdata_grc,
+    &dict_grc
 };
-#include <libespeak-ng/dict/grc_dict.h>
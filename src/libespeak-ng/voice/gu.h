@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/gu_dict.h>
 const unsigned char __rawdata_gu[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x47, 0x75, 0x6a, 0x61, 0x72, 0x61, 0x74,
   0x69, 0x0a, 0x6c, 0x61, 0x6e, 0x67, 0x75, 0x61, 0x67, 0x65, 0x20, 0x67,
@@ -11,6 +12,6 @@ const unsigned char __rawdata_gu[] = {
 BackgroundAudioVoice voice_gu = {
     "Gujarati",
     42,
-    __rawdata_gu
+    __rawdata_gu,
+    &dict_gu
 };
-#include <libespeak-ng/dict/gu_dict.h>
@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/hak_dict.h>
 const unsigned char __rawdata_hak[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x48, 0x61, 0x6b, 0x6b, 0x61, 0x20, 0x43,
   0x68, 0x69, 0x6e, 0x65, 0x73, 0x65, 0x0a, 0x6c, 0x61, 0x6e, 0x67, 0x75,
@@ -18,6 +19,6 @@ const unsigned char __rawdata_hak[] = {
 BackgroundAudioVoice voice_hak = {
     "Hakka Chinese",
     128,
-    __rawdata_hak
+    __rawdata_hak,
+    &dict_hak
 };
-#include <libespeak-ng/dict/hak_dict.h>
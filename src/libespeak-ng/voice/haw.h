@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/haw_dict.h>
 const unsigned char __rawdata_haw[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x48, 0x61, 0x77, 0x61, 0x69, 0x69, 0x61,
   0x6e, 0x0a, 0x6c, 0x61, 0x6e, 0x67, 0x75, 0x61, 0x67, 0x65, 0x20, 0x68,
@@ -11,6 +12,6 @@ const unsigned char __rawdata_haw[] = {
 BackgroundAudioVoice voice_haw = {
     "Hawaiian",
     42,
-    __rawdata_haw
+    __rawdata_haw,
+    &dict_haw
 };
-#include <libespeak-ng/dict/haw_dict.h>
@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/he_dict.h>
 const unsigned char __rawdata_he[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x48, 0x65, 0x62, 0x72, 0x65, 0x77, 0x0a,
   0x6c, 0x61, 0x6e, 0x67, 0x75, 0x61, 0x67, 0x65, 0x20, 0x68, 0x65, 0x0a,
@@ -11,6 +12,6 @@ const unsigned char __rawdata_he[] = {
 BackgroundAudioVoice voice_he = {
     "Hebrew",
     40,
-    __rawdata_he
+    __rawdata_he,
+    &dict_he
 };
-#include <libespeak-ng/dict/he_dict.h>
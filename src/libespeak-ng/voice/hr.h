@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/hr_dict.h>
 const unsigned char __rawdata_hr[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x43, 0x72, 0x6f, 0x61, 0x74, 0x69, 0x61,
   0x6e, 0x0a, 0x6c, 0x61, 0x6e, 0x67, 0x75, 0x61, 0x67, 0x65, 0x20, 0x68,
@@ -29,6 +30,6 @@ const unsigned char __rawdata_hr[] = {
 BackgroundAudioVoice voice_hr = {
     "Croatian",
     262,
-    __rawdata_hr
+    __rawdata_hr,
+    &dict_hr
 };
-#include <libespeak-ng/dict/hr_dict.h>
@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/ht_dict.h>
 const unsigned char __rawdata_ht[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x48, 0x61, 0x69, 0x74, 0x69, 0x61, 0x6e,
   0x20, 0x43, 0x72, 0x65, 0x6f, 0x6c, 0x65, 0x0a, 0x6c, 0x61, 0x6e, 0x67,
@@ -19,6 +20,6 @@ const unsigned char __rawdata_ht[] = {
 BackgroundAudioVoice voice_ht = {
     "Haitian Creole",
     140,
-    __rawdata_ht
+    __rawdata_ht,
+    &dict_ht
 };
-#include <libespeak-ng/dict/ht_dict.h>
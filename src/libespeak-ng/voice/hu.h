@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/hu_dict.h>
 const unsigned char __rawdata_hu[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x48, 0x75, 0x6e, 0x67, 0x61, 0x72, 0x69,
   0x61, 0x6e, 0x0a, 0x6c, 0x61, 0x6e, 0x67, 0x75, 0x61, 0x67, 0x65, 0x20,
@@ -14,6 +15,6 @@ const unsigned char __rawdata_hu[] = {
 BackgroundAudioVoice voice_hu = {
     "Hungarian",
     73,
-    __rawdata_hu
+    __rawdata_hu,
+    &dict_hu
 };
-#include <libespeak-ng/dict/hu_dict.h>
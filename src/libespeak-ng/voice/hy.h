@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/hy_dict.h>
 const unsigned char __rawdata_hy[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x41, 0x72, 0x6d, 0x65, 0x6e, 0x69, 0x61,
   0x6e, 0x20, 0x28, 0x45, 0x61, 0x73, 0x74, 0x20, 0x41, 0x72, 0x6d, 0x65,
@@ -13,6 +14,6 @@ const unsigned char __rawdata_hy[] = {
 BackgroundAudioVoice voice_hy = {
     "Armenian (East Armenia)",
     61,
-    __rawdata_hy
+    __rawdata_hy,
+    &dict_hy
 };
-#include <libespeak-ng/dict/hy_dict.h>
@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/hy_dict.h>
 const unsigned char __rawdata_hyw[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x41, 0x72, 0x6d, 0x65, 0x6e, 0x69, 0x61,
   0x6e, 0x20, 0x28, 0x57, 0x65, 0x73, 0x74, 0x20, 0x41, 0x72, 0x6d, 0x65,
@@ -38,6 +39,6 @@ const unsigned char __rawdata_hyw[] = {
 BackgroundAudioVoice voice_hyw = {
     "Armenian (West Armenia)",
     365,
-    __rawdata_hyw
+    __rawdata_hyw,
+    &dict_hy
 };
-#include <libespeak-ng/dict/hyw_dict.h>
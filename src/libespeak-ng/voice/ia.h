@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/ia_dict.h>
 const unsigned char __rawdata_ia[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x49, 0x6e, 0x74, 0x65, 0x72, 0x6c, 0x69,
   0x6e, 0x67, 0x75, 0x61, 0x0a, 0x6c, 0x61, 0x6e, 0x67, 0x75, 0x61, 0x67,
@@ -10,6 +11,6 @@ const unsigned char __rawdata_ia[] = {
 BackgroundAudioVoice voice_ia = {
     "Interlingua",
     29,
-    __rawdata_ia
+    __rawdata_ia,
+    &dict_ia
 };
-#include <libespeak-ng/dict/ia_dict.h>
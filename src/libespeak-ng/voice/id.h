@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/id_dict.h>
 const unsigned char __rawdata_id[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x49, 0x6e, 0x64, 0x6f, 0x6e, 0x65, 0x73,
   0x69, 0x61, 0x6e, 0x0a, 0x6c, 0x61, 0x6e, 0x67, 0x75, 0x61, 0x67, 0x65,
@@ -19,6 +20,6 @@ const unsigned char __rawdata_id[] = {
 BackgroundAudioVoice voice_id = {
     "Indonesian",
     134,
-    __rawdata_id
+    __rawdata_id,
+    &dict_id
 };
-#include <libespeak-ng/dict/id_dict.h>
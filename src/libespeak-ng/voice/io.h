@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/io_dict.h>
 const unsigned char __rawdata_io[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x49, 0x64, 0x6f, 0x0a, 0x6c, 0x61, 0x6e,
   0x67, 0x75, 0x61, 0x67, 0x65, 0x20, 0x69, 0x6f, 0x0a, 0x70, 0x68, 0x6f,
@@ -12,6 +13,6 @@ const unsigned char __rawdata_io[] = {
 BackgroundAudioVoice voice_io = {
     "Ido",
     50,
-    __rawdata_io
+    __rawdata_io,
+    &dict_io
 };
-#include <libespeak-ng/dict/io_dict.h>
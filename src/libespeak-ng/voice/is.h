@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/is_dict.h>
 const unsigned char __rawdata_is[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x49, 0x63, 0x65, 0x6c, 0x61, 0x6e, 0x64,
   0x69, 0x63, 0x0a, 0x6c, 0x61, 0x6e, 0x67, 0x75, 0x61, 0x67, 0x65, 0x20,
@@ -10,6 +11,6 @@ const unsigned char __rawdata_is[] = {
 BackgroundAudioVoice voice_is = {
     "Icelandic",
     27,
-    __rawdata_is
+    __rawdata_is,
+    &dict_is
 };
-#include <libespeak-ng/dict/is_dict.h>
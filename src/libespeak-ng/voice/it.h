@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/it_dict.h>
 const unsigned char __rawdata_it[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x49, 0x74, 0x61, 0x6c, 0x69, 0x61, 0x6e,
   0x0a, 0x6c, 0x61, 0x6e, 0x67, 0x75, 0x61, 0x67, 0x65, 0x20, 0x69, 0x74,
@@ -17,6 +18,6 @@ const unsigned char __rawdata_it[] = {
 BackgroundAudioVoice voice_it = {
     "Italian",
     109,
-    __rawdata_it
+    __rawdata_it,
+    &dict_it
 };
-#include <libespeak-ng/dict/it_dict.h>
@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/ja_dict.h>
 const unsigned char __rawdata_ja[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x4a, 0x61, 0x70, 0x61, 0x6e, 0x65, 0x73,
   0x65, 0x0a, 0x6c, 0x61, 0x6e, 0x67, 0x75, 0x61, 0x67, 0x65, 0x20, 0x6a,
@@ -12,6 +13,6 @@ const unsigned char __rawdata_ja[] = {
 BackgroundAudioVoice voice_ja = {
     "Japanese",
     52,
-    __rawdata_ja
+    __rawdata_ja,
+    &dict_ja
 };
-#include <libespeak-ng/dict/ja_dict.h>
@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/jbo_dict.h>
 const unsigned char __rawdata_jbo[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x4c, 0x6f, 0x6a, 0x62, 0x61, 0x6e, 0x0a,
   0x6c, 0x61, 0x6e, 0x67, 0x75, 0x61, 0x67, 0x65, 0x20, 0x6a, 0x62, 0x6f,
@@ -13,6 +14,6 @@ const unsigned char __rawdata_jbo[] = {
 BackgroundAudioVoice voice_jbo = {
     "Lojban",
     69,
-    __rawdata_jbo
+    __rawdata_jbo,
+    &dict_jbo
 };
-#include <libespeak-ng/dict/jbo_dict.h>
@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/ka_dict.h>
 const unsigned char __rawdata_ka[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x47, 0x65, 0x6f, 0x72, 0x67, 0x69, 0x61,
   0x6e, 0x0a, 0x6c, 0x61, 0x6e, 0x67, 0x75, 0x61, 0x67, 0x65, 0x20, 0x6b,
@@ -18,6 +19,6 @@ const unsigned char __rawdata_ka[] = {
 BackgroundAudioVoice voice_ka = {
     "Georgian",
     124,
-    __rawdata_ka
+    __rawdata_ka,
+    &dict_ka
 };
-#include <libespeak-ng/dict/ka_dict.h>
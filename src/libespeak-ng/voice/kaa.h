@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/kaa_dict.h>
 const unsigned char __rawdata_kaa[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x4b, 0x61, 0x72, 0x61, 0x6b, 0x61, 0x6c,
   0x70, 0x61, 0x6b, 0x0a, 0x6c, 0x61, 0x6e, 0x67, 0x75, 0x61, 0x67, 0x65,
@@ -10,6 +11,6 @@ const unsigned char __rawdata_kaa[] = {
 BackgroundAudioVoice voice_kaa = {
     "Karakalpak",
     28,
-    __rawdata_kaa
+    __rawdata_kaa,
+    &dict_kaa
 };
-#include <libespeak-ng/dict/kaa_dict.h>
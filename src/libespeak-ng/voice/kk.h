@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/kk_dict.h>
 const unsigned char __rawdata_kk[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x4b, 0x61, 0x7a, 0x61, 0x6b, 0x68, 0x0a,
   0x6c, 0x61, 0x6e, 0x67, 0x75, 0x61, 0x67, 0x65, 0x20, 0x6b, 0x6b, 0x0a,
@@ -11,6 +12,6 @@ const unsigned char __rawdata_kk[] = {
 BackgroundAudioVoice voice_kk = {
     "Kazakh",
     40,
-    __rawdata_kk
+    __rawdata_kk,
+    &dict_kk
 };
-#include <libespeak-ng/dict/kk_dict.h>
@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/kl_dict.h>
 const unsigned char __rawdata_kl[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x47, 0x72, 0x65, 0x65, 0x6e, 0x6c, 0x61,
   0x6e, 0x64, 0x69, 0x63, 0x0a, 0x6c, 0x61, 0x6e, 0x67, 0x75, 0x61, 0x67,
@@ -10,6 +11,6 @@ const unsigned char __rawdata_kl[] = {
 BackgroundAudioVoice voice_kl = {
     "Greenlandic",
     30,
-    __rawdata_kl
+    __rawdata_kl,
+    &dict_kl
 };
-#include <libespeak-ng/dict/kl_dict.h>
@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/kn_dict.h>
 const unsigned char __rawdata_kn[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x4b, 0x61, 0x6e, 0x6e, 0x61, 0x64, 0x61,
   0x0a, 0x6c, 0x61, 0x6e, 0x67, 0x75, 0x61, 0x67, 0x65, 0x20, 0x6b, 0x6e,
@@ -12,6 +13,6 @@ const unsigned char __rawdata_kn[] = {
 BackgroundAudioVoice voice_kn = {
     "Kannada",
     55,
-    __rawdata_kn
+    __rawdata_kn,
+    &dict_kn
 };
-#include <libespeak-ng/dict/kn_dict.h>
@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/ko_dict.h>
 const unsigned char __rawdata_ko[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x4b, 0x6f, 0x72, 0x65, 0x61, 0x6e, 0x0a,
   0x6c, 0x61, 0x6e, 0x67, 0x75, 0x61, 0x67, 0x65, 0x20, 0x6b, 0x6f, 0x0a,
@@ -12,6 +13,6 @@ const unsigned char __rawdata_ko[] = {
 BackgroundAudioVoice voice_ko = {
     "Korean",
     51,
-    __rawdata_ko
+    __rawdata_ko,
+    &dict_ko
 };
-#include <libespeak-ng/dict/ko_dict.h>
@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/kok_dict.h>
 const unsigned char __rawdata_kok[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x4b, 0x6f, 0x6e, 0x6b, 0x61, 0x6e, 0x69,
   0x0a, 0x6c, 0x61, 0x6e, 0x67, 0x75, 0x61, 0x67, 0x65, 0x20, 0x6b, 0x6f,
@@ -10,6 +11,6 @@ const unsigned char __rawdata_kok[] = {
 BackgroundAudioVoice voice_kok = {
     "Konkani",
     26,
-    __rawdata_kok
+    __rawdata_kok,
+    &dict_kok
 };
-#include <libespeak-ng/dict/kok_dict.h>
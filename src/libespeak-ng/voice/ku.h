@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/ku_dict.h>
 const unsigned char __rawdata_ku[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x4b, 0x75, 0x72, 0x64, 0x69, 0x73, 0x68,
   0x0a, 0x6c, 0x61, 0x6e, 0x67, 0x75, 0x61, 0x67, 0x65, 0x20, 0x6b, 0x75,
@@ -11,6 +12,6 @@ const unsigned char __rawdata_ku[] = {
 BackgroundAudioVoice voice_ku = {
     "Kurdish",
     40,
-    __rawdata_ku
+    __rawdata_ku,
+    &dict_ku
 };
-#include <libespeak-ng/dict/ku_dict.h>
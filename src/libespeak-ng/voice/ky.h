@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/ky_dict.h>
 const unsigned char __rawdata_ky[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x4b, 0x79, 0x72, 0x67, 0x79, 0x7a, 0x0a,
   0x6c, 0x61, 0x6e, 0x67, 0x75, 0x61, 0x67, 0x65, 0x20, 0x6b, 0x79, 0x0a,
@@ -11,6 +12,6 @@ const unsigned char __rawdata_ky[] = {
 BackgroundAudioVoice voice_ky = {
     "Kyrgyz",
     43,
-    __rawdata_ky
+    __rawdata_ky,
+    &dict_ky
 };
-#include <libespeak-ng/dict/ky_dict.h>
@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/la_dict.h>
 const unsigned char __rawdata_la[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x4c, 0x61, 0x74, 0x69, 0x6e, 0x0a, 0x6c,
   0x61, 0x6e, 0x67, 0x75, 0x61, 0x67, 0x65, 0x20, 0x6c, 0x61, 0x0a, 0x73,
@@ -32,6 +33,6 @@ const unsigned char __rawdata_la[] = {
 BackgroundAudioVoice voice_la = {
     "Latin",
     297,
-    __rawdata_la
+    __rawdata_la,
+    &dict_la
 };
-#include <libespeak-ng/dict/la_dict.h>
@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/lb_dict.h>
 const unsigned char __rawdata_lb[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x4c, 0x75, 0x78, 0x65, 0x6d, 0x62, 0x6f,
   0x75, 0x72, 0x67, 0x69, 0x73, 0x68, 0x0a, 0x6c, 0x61, 0x6e, 0x67, 0x75,
@@ -10,6 +11,6 @@ const unsigned char __rawdata_lb[] = {
 BackgroundAudioVoice voice_lb = {
     "Luxembourgish",
     31,
-    __rawdata_lb
+    __rawdata_lb,
+    &dict_lb
 };
-#include <libespeak-ng/dict/lb_dict.h>
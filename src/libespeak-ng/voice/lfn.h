@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/lfn_dict.h>
 const unsigned char __rawdata_lfn[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x4c, 0x69, 0x6e, 0x67, 0x75, 0x61, 0x20,
   0x46, 0x72, 0x61, 0x6e, 0x63, 0x61, 0x20, 0x4e, 0x6f, 0x76, 0x61, 0x0a,
@@ -18,6 +19,6 @@ const unsigned char __rawdata_lfn[] = {
 BackgroundAudioVoice voice_lfn = {
     "Lingua Franca Nova",
     127,
-    __rawdata_lfn
+    __rawdata_lfn,
+    &dict_lfn
 };
-#include <libespeak-ng/dict/lfn_dict.h>
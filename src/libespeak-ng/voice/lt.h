@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/lt_dict.h>
 const unsigned char __rawdata_lt[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x4c, 0x69, 0x74, 0x68, 0x75, 0x61, 0x6e,
   0x69, 0x61, 0x6e, 0x0a, 0x6c, 0x61, 0x6e, 0x67, 0x75, 0x61, 0x67, 0x65,
@@ -10,6 +11,6 @@ const unsigned char __rawdata_lt[] = {
 BackgroundAudioVoice voice_lt = {
     "Lithuanian",
     28,
-    __rawdata_lt
+    __rawdata_lt,
+    &dict_lt
 };
-#include <libespeak-ng/dict/lt_dict.h>
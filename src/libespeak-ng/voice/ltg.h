@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/lv_dict.h>
 const unsigned char __rawdata_ltg[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x4c, 0x61, 0x74, 0x67, 0x61, 0x6c, 0x69,
   0x61, 0x6e, 0x0a, 0x6c, 0x61, 0x6e, 0x67, 0x75, 0x61, 0x67, 0x65, 0x20,
@@ -33,6 +34,6 @@ const unsigned char __rawdata_ltg[] = {
 BackgroundAudioVoice voice_ltg = {
     "Latgalian",
     312,
-    __rawdata_ltg
+    __rawdata_ltg,
+    &dict_lv
 };
-#include <libespeak-ng/dict/ltg_dict.h>
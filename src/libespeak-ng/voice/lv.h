@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/lv_dict.h>
 const unsigned char __rawdata_lv[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x4c, 0x61, 0x74, 0x76, 0x69, 0x61, 0x6e,
   0x0a, 0x6c, 0x61, 0x6e, 0x67, 0x75, 0x61, 0x67, 0x65, 0x20, 0x6c, 0x76,
@@ -27,6 +28,6 @@ const unsigned char __rawdata_lv[] = {
 BackgroundAudioVoice voice_lv = {
     "Latvian",
     229,
-    __rawdata_lv
+    __rawdata_lv,
+    &dict_lv
 };
-#include <libespeak-ng/dict/lv_dict.h>
@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/mi_dict.h>
 const unsigned char __rawdata_mi[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x4d, 0xc4, 0x81, 0x6f, 0x72, 0x69, 0x0a,
   0x6c, 0x61, 0x6e, 0x67, 0x75, 0x61, 0x67, 0x65, 0x20, 0x6d, 0x69, 0x0a,
@@ -38,6 +39,6 @@ const unsigned char __rawdata_mi[] = {
 BackgroundAudioVoice voice_mi = {
     "Māori",
     367,
-    __rawdata_mi
+    __rawdata_mi,
+    &dict_mi
 };
-#include <libespeak-ng/dict/mi_dict.h>
@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/mk_dict.h>
 const unsigned char __rawdata_mk[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x4d, 0x61, 0x63, 0x65, 0x64, 0x6f, 0x6e,
   0x69, 0x61, 0x6e, 0x0a, 0x6c, 0x61, 0x6e, 0x67, 0x75, 0x61, 0x67, 0x65,
@@ -10,6 +11,6 @@ const unsigned char __rawdata_mk[] = {
 BackgroundAudioVoice voice_mk = {
     "Macedonian",
     28,
-    __rawdata_mk
+    __rawdata_mk,
+    &dict_mk
 };
-#include <libespeak-ng/dict/mk_dict.h>
@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/ml_dict.h>
 const unsigned char __rawdata_ml[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x4d, 0x61, 0x6c, 0x61, 0x79, 0x61, 0x6c,
   0x61, 0x6d, 0x0a, 0x6c, 0x61, 0x6e, 0x67, 0x75, 0x61, 0x67, 0x65, 0x20,
@@ -12,6 +13,6 @@ const unsigned char __rawdata_ml[] = {
 BackgroundAudioVoice voice_ml = {
     "Malayalam",
     57,
-    __rawdata_ml
+    __rawdata_ml,
+    &dict_ml
 };
-#include <libespeak-ng/dict/ml_dict.h>
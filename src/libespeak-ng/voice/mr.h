@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/mr_dict.h>
 const unsigned char __rawdata_mr[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x4d, 0x61, 0x72, 0x61, 0x74, 0x68, 0x69,
   0x0a, 0x6c, 0x61, 0x6e, 0x67, 0x75, 0x61, 0x67, 0x65, 0x20, 0x6d, 0x72,
@@ -11,6 +12,6 @@ const unsigned char __rawdata_mr[] = {
 BackgroundAudioVoice voice_mr = {
     "Marathi",
     41,
-    __rawdata_mr
+    __rawdata_mr,
+    &dict_mr
 };
-#include <libespeak-ng/dict/mr_dict.h>
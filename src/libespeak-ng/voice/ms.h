@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/ms_dict.h>
 const unsigned char __rawdata_ms[] = {
   0x2f, 0x2f, 0x20, 0x4c, 0x61, 0x73, 0x74, 0x20, 0x75, 0x70, 0x64, 0x61,
   0x74, 0x65, 0x64, 0x3a, 0x20, 0x31, 0x34, 0x20, 0x4f, 0x63, 0x74, 0x6f,
@@ -43,6 +44,6 @@ const unsigned char __rawdata_ms[] = {
 BackgroundAudioVoice voice_ms = {
     "Malay",
     430,
-    __rawdata_ms
+    __rawdata_ms,
+    &dict_ms
 };
-#include <libespeak-ng/dict/ms_dict.h>
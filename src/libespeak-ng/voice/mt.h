@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/mt_dict.h>
 const unsigned char __rawdata_mt[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x4d, 0x61, 0x6c, 0x74, 0x65, 0x73, 0x65,
   0x0a, 0x6c, 0x61, 0x6e, 0x67, 0x75, 0x61, 0x67, 0x65, 0x20, 0x6d, 0x74,
@@ -11,6 +12,6 @@ const unsigned char __rawdata_mt[] = {
 BackgroundAudioVoice voice_mt = {
     "Maltese",
     41,
-    __rawdata_mt
+    __rawdata_mt,
+    &dict_mt
 };
-#include <libespeak-ng/dict/mt_dict.h>
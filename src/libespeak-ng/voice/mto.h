@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/mto_dict.h>
 const unsigned char __rawdata_mto[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x54, 0x6f, 0x74, 0x6f, 0x6e, 0x74, 0x65,
   0x70, 0x65, 0x63, 0x20, 0x4d, 0x69, 0x78, 0x65, 0x0a, 0x6c, 0x61, 0x6e,
@@ -23,6 +24,6 @@ const unsigned char __rawdata_mto[] = {
 BackgroundAudioVoice voice_mto = {
     "Totontepec Mixe",
     183,
-    __rawdata_mto
+    __rawdata_mto,
+    &dict_mto
 };
-#include <libespeak-ng/dict/mto_dict.h>
@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/my_dict.h>
 const unsigned char __rawdata_my[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x4d, 0x79, 0x61, 0x6e, 0x6d, 0x61, 0x72,
   0x20, 0x28, 0x42, 0x75, 0x72, 0x6d, 0x65, 0x73, 0x65, 0x29, 0x0a, 0x6d,
@@ -12,6 +13,6 @@ const unsigned char __rawdata_my[] = {
 BackgroundAudioVoice voice_my = {
     "Myanmar (Burmese)",
     56,
-    __rawdata_my
+    __rawdata_my,
+    &dict_my
 };
-#include <libespeak-ng/dict/my_dict.h>
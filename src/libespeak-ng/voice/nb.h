@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/no_dict.h>
 const unsigned char __rawdata_nb[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x4e, 0x6f, 0x72, 0x77, 0x65, 0x67, 0x69,
   0x61, 0x6e, 0x20, 0x42, 0x6f, 0x6b, 0x6d, 0xc3, 0xa5, 0x6c, 0x0a, 0x6c,
@@ -15,6 +16,6 @@ const unsigned char __rawdata_nb[] = {
 BackgroundAudioVoice voice_nb = {
     "Norwegian Bokmål",
     87,
-    __rawdata_nb
+    __rawdata_nb,
+    &dict_no
 };
-#include <libespeak-ng/dict/nb_dict.h>
@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/nci_dict.h>
 const unsigned char __rawdata_nci[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x4e, 0x61, 0x68, 0x75, 0x61, 0x74, 0x6c,
   0x20, 0x28, 0x43, 0x6c, 0x61, 0x73, 0x73, 0x69, 0x63, 0x61, 0x6c, 0x29,
@@ -17,6 +18,6 @@ const unsigned char __rawdata_nci[] = {
 BackgroundAudioVoice voice_nci = {
     "Nahuatl (Classical)",
     114,
-    __rawdata_nci
+    __rawdata_nci,
+    &dict_nci
 };
-#include <libespeak-ng/dict/nci_dict.h>
@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/ne_dict.h>
 const unsigned char __rawdata_ne[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x4e, 0x65, 0x70, 0x61, 0x6c, 0x69, 0x0a,
   0x6c, 0x61, 0x6e, 0x67, 0x75, 0x61, 0x67, 0x65, 0x20, 0x6e, 0x65, 0x0a,
@@ -11,6 +12,6 @@ const unsigned char __rawdata_ne[] = {
 BackgroundAudioVoice voice_ne = {
     "Nepali",
     37,
-    __rawdata_ne
+    __rawdata_ne,
+    &dict_ne
 };
-#include <libespeak-ng/dict/ne_dict.h>
@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/nl_dict.h>
 const unsigned char __rawdata_nl[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x44, 0x75, 0x74, 0x63, 0x68, 0x0a, 0x6c,
   0x61, 0x6e, 0x67, 0x75, 0x61, 0x67, 0x65, 0x20, 0x6e, 0x6c, 0x0a
@@ -9,6 +10,6 @@ const unsigned char __rawdata_nl[] = {
 BackgroundAudioVoice voice_nl = {
     "Dutch",
     23,
-    __rawdata_nl
+    __rawdata_nl,
+    &dict_nl
 };
-#include <libespeak-ng/dict/nl_dict.h>
@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/nog_dict.h>
 const unsigned char __rawdata_nog[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x4e, 0x6f, 0x67, 0x61, 0x69, 0x0a, 0x6c,
   0x61, 0x6e, 0x67, 0x75, 0x61, 0x67, 0x65, 0x20, 0x6e, 0x6f, 0x67, 0x0a,
@@ -11,6 +12,6 @@ const unsigned char __rawdata_nog[] = {
 BackgroundAudioVoice voice_nog = {
     "Nogai",
     39,
-    __rawdata_nog
+    __rawdata_nog,
+    &dict_nog
 };
-#include <libespeak-ng/dict/nog_dict.h>
@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/om_dict.h>
 const unsigned char __rawdata_om[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x4f, 0x72, 0x6f, 0x6d, 0x6f, 0x0a, 0x6c,
   0x61, 0x6e, 0x67, 0x75, 0x61, 0x67, 0x65, 0x20, 0x6f, 0x6d, 0x0a, 0x0a,
@@ -11,6 +12,6 @@ const unsigned char __rawdata_om[] = {
 BackgroundAudioVoice voice_om = {
     "Oromo",
     39,
-    __rawdata_om
+    __rawdata_om,
+    &dict_om
 };
-#include <libespeak-ng/dict/om_dict.h>
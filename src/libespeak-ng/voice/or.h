@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/or_dict.h>
 const unsigned char __rawdata_or[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x4f, 0x72, 0x69, 0x79, 0x61, 0x0a, 0x6c,
   0x61, 0x6e, 0x67, 0x75, 0x61, 0x67, 0x65, 0x20, 0x6f, 0x72, 0x0a, 0x0a,
@@ -11,6 +12,6 @@ const unsigned char __rawdata_or[] = {
 BackgroundAudioVoice voice_or = {
     "Oriya",
     39,
-    __rawdata_or
+    __rawdata_or,
+    &dict_or
 };
-#include <libespeak-ng/dict/or_dict.h>
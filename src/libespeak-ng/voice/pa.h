@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/pa_dict.h>
 const unsigned char __rawdata_pa[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x50, 0x75, 0x6e, 0x6a, 0x61, 0x62, 0x69,
   0x0a, 0x6c, 0x61, 0x6e, 0x67, 0x75, 0x61, 0x67, 0x65, 0x20, 0x70, 0x61,
@@ -10,6 +11,6 @@ const unsigned char __rawdata_pa[] = {
 BackgroundAudioVoice voice_pa = {
     "Punjabi",
     25,
-    __rawdata_pa
+    __rawdata_pa,
+    &dict_pa
 };
-#include <libespeak-ng/dict/pa_dict.h>
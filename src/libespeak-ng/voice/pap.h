@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/pap_dict.h>
 const unsigned char __rawdata_pap[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x50, 0x61, 0x70, 0x69, 0x61, 0x6d, 0x65,
   0x6e, 0x74, 0x6f, 0x0a, 0x6c, 0x61, 0x6e, 0x67, 0x75, 0x61, 0x67, 0x65,
@@ -13,6 +14,6 @@ const unsigned char __rawdata_pap[] = {
 BackgroundAudioVoice voice_pap = {
     "Papiamento",
     62,
-    __rawdata_pap
+    __rawdata_pap,
+    &dict_pap
 };
-#include <libespeak-ng/dict/pap_dict.h>
@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/piqd_dict.h>
 const unsigned char __rawdata_piqd[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x4b, 0x6c, 0x69, 0x6e, 0x67, 0x6f, 0x6e,
   0x0a, 0x6c, 0x61, 0x6e, 0x67, 0x75, 0x61, 0x67, 0x65, 0x20, 0x70, 0x69,
@@ -12,6 +13,6 @@ const unsigned char __rawdata_piqd[] = {
 BackgroundAudioVoice voice_piqd = {
     "Klingon",
     56,
-    __rawdata_piqd
+    __rawdata_piqd,
+    &dict_piqd
 };
-#include <libespeak-ng/dict/piqd_dict.h>
@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/pl_dict.h>
 const unsigned char __rawdata_pl[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x50, 0x6f, 0x6c, 0x69, 0x73, 0x68, 0x0a,
   0x6c, 0x61, 0x6e, 0x67, 0x75, 0x61, 0x67, 0x65, 0x20, 0x70, 0x6c, 0x0a,
@@ -11,6 +12,6 @@ const unsigned char __rawdata_pl[] = {
 BackgroundAudioVoice voice_pl = {
     "Polish",
     38,
-    __rawdata_pl
+    __rawdata_pl,
+    &dict_pl
 };
-#include <libespeak-ng/dict/pl_dict.h>
@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/pt_dict.h>
 const unsigned char __rawdata_pt[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x50, 0x6f, 0x72, 0x74, 0x75, 0x67, 0x75,
   0x65, 0x73, 0x65, 0x20, 0x28, 0x50, 0x6f, 0x72, 0x74, 0x75, 0x67, 0x61,
@@ -15,6 +16,6 @@ const unsigned char __rawdata_pt[] = {
 BackgroundAudioVoice voice_pt = {
     "Portuguese (Portugal)",
     95,
-    __rawdata_pt
+    __rawdata_pt,
+    &dict_pt
 };
-#include <libespeak-ng/dict/pt_dict.h>
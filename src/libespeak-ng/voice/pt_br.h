@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/pt_dict.h>
 const unsigned char __rawdata_pt_br[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x50, 0x6f, 0x72, 0x74, 0x75, 0x67, 0x75,
   0x65, 0x73, 0x65, 0x20, 0x28, 0x42, 0x72, 0x61, 0x7a, 0x69, 0x6c, 0x29,
@@ -17,6 +18,6 @@ const unsigned char __rawdata_pt_br[] = {
 BackgroundAudioVoice voice_pt_br = {
     "Portuguese (Brazil)",
     109,
-    __rawdata_pt_br
+    __rawdata_pt_br,
+    &dict_pt
 };
-#include <libespeak-ng/dict/pt_dict.h>
@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/py_dict.h>
 const unsigned char __rawdata_py[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x50, 0x79, 0x61, 0x73, 0x68, 0x0a, 0x6c,
   0x61, 0x6e, 0x67, 0x75, 0x61, 0x67, 0x65, 0x20, 0x70, 0x79, 0x0a, 0x6d,
@@ -19,6 +20,6 @@ const unsigned char __rawdata_py[] = {
 BackgroundAudioVoice voice_py = {
     "Pyash",
     140,
-    __rawdata_py
+    __rawdata_py,
+    &dict_py
 };
-#include <libespeak-ng/dict/py_dict.h>
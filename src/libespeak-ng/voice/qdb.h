@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/qdb_dict.h>
 const unsigned char __rawdata_qdb[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x4c, 0x61, 0x6e, 0x67, 0x20, 0x42, 0x65,
   0x6c, 0x74, 0x61, 0x0a, 0x6c, 0x61, 0x6e, 0x67, 0x75, 0x61, 0x67, 0x65,
@@ -12,6 +13,6 @@ const unsigned char __rawdata_qdb[] = {
 BackgroundAudioVoice voice_qdb = {
     "Lang Belta",
     57,
-    __rawdata_qdb
+    __rawdata_qdb,
+    &dict_qdb
 };
-#include <libespeak-ng/dict/qdb_dict.h>
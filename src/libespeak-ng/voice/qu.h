@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/qu_dict.h>
 const unsigned char __rawdata_qu[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x51, 0x75, 0x65, 0x63, 0x68, 0x75, 0x61,
   0x0a, 0x6c, 0x61, 0x6e, 0x67, 0x75, 0x61, 0x67, 0x65, 0x20, 0x71, 0x75,
@@ -15,6 +16,6 @@ const unsigned char __rawdata_qu[] = {
 BackgroundAudioVoice voice_qu = {
     "Quechua",
     88,
-    __rawdata_qu
+    __rawdata_qu,
+    &dict_qu
 };
-#include <libespeak-ng/dict/qu_dict.h>
@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/quc_dict.h>
 const unsigned char __rawdata_quc[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x4b, 0x27, 0x69, 0x63, 0x68, 0x65, 0x27,
   0x0a, 0x6c, 0x61, 0x6e, 0x67, 0x75, 0x61, 0x67, 0x65, 0x20, 0x71, 0x75,
@@ -25,6 +26,6 @@ const unsigned char __rawdata_quc[] = {
 BackgroundAudioVoice voice_quc = {
     "K'iche'",
     210,
-    __rawdata_quc
+    __rawdata_quc,
+    &dict_quc
 };
-#include <libespeak-ng/dict/quc_dict.h>
@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/qya_dict.h>
 const unsigned char __rawdata_qya[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x51, 0x75, 0x65, 0x6e, 0x79, 0x61, 0x0a,
   0x6c, 0x61, 0x6e, 0x67, 0x75, 0x61, 0x67, 0x65, 0x20, 0x71, 0x79, 0x61,
@@ -22,6 +23,6 @@ const unsigned char __rawdata_qya[] = {
 BackgroundAudioVoice voice_qya = {
     "Quenya",
     173,
-    __rawdata_qya
+    __rawdata_qya,
+    &dict_qya
 };
-#include <libespeak-ng/dict/qya_dict.h>
@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/ru_dict.h>
 const unsigned char __rawdata_ru[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x52, 0x75, 0x73, 0x73, 0x69, 0x61, 0x6e,
   0x0a, 0x6c, 0x61, 0x6e, 0x67, 0x75, 0x61, 0x67, 0x65, 0x20, 0x72, 0x75,
@@ -12,6 +13,6 @@ const unsigned char __rawdata_ru[] = {
 BackgroundAudioVoice voice_ru = {
     "Russian",
     57,
-    __rawdata_ru
+    __rawdata_ru,
+    &dict_ru
 };
-#include <libespeak-ng/dict/ru_dict.h>
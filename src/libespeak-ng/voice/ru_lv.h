@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/ru_dict.h>
 const unsigned char __rawdata_ru_lv[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x52, 0x75, 0x73, 0x73, 0x69, 0x61, 0x6e,
   0x20, 0x28, 0x4c, 0x61, 0x74, 0x76, 0x69, 0x61, 0x29, 0x0a, 0x6c, 0x61,
@@ -31,6 +32,6 @@ const unsigned char __rawdata_ru_lv[] = {
 BackgroundAudioVoice voice_ru_lv = {
     "Russian (Latvia)",
     280,
-    __rawdata_ru_lv
+    __rawdata_ru_lv,
+    &dict_ru
 };
-#include <libespeak-ng/dict/ru_dict.h>
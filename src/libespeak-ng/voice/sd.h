@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/sd_dict.h>
 const unsigned char __rawdata_sd[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x53, 0x69, 0x6e, 0x64, 0x68, 0x69, 0x0a,
   0x6c, 0x61, 0x6e, 0x67, 0x75, 0x61, 0x67, 0x65, 0x20, 0x73, 0x64, 0x0a,
@@ -13,6 +14,6 @@ const unsigned char __rawdata_sd[] = {
 BackgroundAudioVoice voice_sd = {
     "Sindhi",
     66,
-    __rawdata_sd
+    __rawdata_sd,
+    &dict_sd
 };
-#include <libespeak-ng/dict/sd_dict.h>
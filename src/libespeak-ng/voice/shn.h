@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/shn_dict.h>
 const unsigned char __rawdata_shn[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x53, 0x68, 0x61, 0x6e, 0x20, 0x28, 0x54,
   0x61, 0x69, 0x20, 0x59, 0x61, 0x69, 0x29, 0x0a, 0x6c, 0x61, 0x6e, 0x67,
@@ -15,6 +16,6 @@ const unsigned char __rawdata_shn[] = {
 BackgroundAudioVoice voice_shn = {
     "Shan (Tai Yai)",
     92,
-    __rawdata_shn
+    __rawdata_shn,
+    &dict_shn
 };
-#include <libespeak-ng/dict/shn_dict.h>
@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/si_dict.h>
 const unsigned char __rawdata_si[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x53, 0x69, 0x6e, 0x68, 0x61, 0x6c, 0x61,
   0x0a, 0x6c, 0x61, 0x6e, 0x67, 0x75, 0x61, 0x67, 0x65, 0x20, 0x73, 0x69,
@@ -12,6 +13,6 @@ const unsigned char __rawdata_si[] = {
 BackgroundAudioVoice voice_si = {
     "Sinhala",
     55,
-    __rawdata_si
+    __rawdata_si,
+    &dict_si
 };
-#include <libespeak-ng/dict/si_dict.h>
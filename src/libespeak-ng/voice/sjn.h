@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/sjn_dict.h>
 const unsigned char __rawdata_sjn[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x53, 0x69, 0x6e, 0x64, 0x61, 0x72, 0x69,
   0x6e, 0x0a, 0x6c, 0x61, 0x6e, 0x67, 0x75, 0x61, 0x67, 0x65, 0x20, 0x73,
@@ -22,6 +23,6 @@ const unsigned char __rawdata_sjn[] = {
 BackgroundAudioVoice voice_sjn = {
     "Sindarin",
     175,
-    __rawdata_sjn
+    __rawdata_sjn,
+    &dict_sjn
 };
-#include <libespeak-ng/dict/sjn_dict.h>
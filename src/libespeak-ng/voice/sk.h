@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/sk_dict.h>
 const unsigned char __rawdata_sk[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x53, 0x6c, 0x6f, 0x76, 0x61, 0x6b, 0x0a,
   0x6c, 0x61, 0x6e, 0x67, 0x75, 0x61, 0x67, 0x65, 0x20, 0x73, 0x6b, 0x0a
@@ -9,6 +10,6 @@ const unsigned char __rawdata_sk[] = {
 BackgroundAudioVoice voice_sk = {
     "Slovak",
     24,
-    __rawdata_sk
+    __rawdata_sk,
+    &dict_sk
 };
-#include <libespeak-ng/dict/sk_dict.h>
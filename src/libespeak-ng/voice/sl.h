@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/sl_dict.h>
 const unsigned char __rawdata_sl[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x53, 0x6c, 0x6f, 0x76, 0x65, 0x6e, 0x69,
   0x61, 0x6e, 0x0a, 0x6c, 0x61, 0x6e, 0x67, 0x75, 0x61, 0x67, 0x65, 0x20,
@@ -11,6 +12,6 @@ const unsigned char __rawdata_sl[] = {
 BackgroundAudioVoice voice_sl = {
     "Slovenian",
     43,
-    __rawdata_sl
+    __rawdata_sl,
+    &dict_sl
 };
-#include <libespeak-ng/dict/sl_dict.h>
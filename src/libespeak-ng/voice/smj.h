@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/smj_dict.h>
 const unsigned char __rawdata_smj[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x4c, 0x75, 0x6c, 0x65, 0x20, 0x53, 0x61,
   0x61, 0x6d, 0x69, 0x0a, 0x6c, 0x61, 0x6e, 0x67, 0x75, 0x61, 0x67, 0x65,
@@ -11,6 +12,6 @@ const unsigned char __rawdata_smj[] = {
 BackgroundAudioVoice voice_smj = {
     "Lule Saami",
     45,
-    __rawdata_smj
+    __rawdata_smj,
+    &dict_smj
 };
-#include <libespeak-ng/dict/smj_dict.h>
@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/sq_dict.h>
 const unsigned char __rawdata_sq[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x41, 0x6c, 0x62, 0x61, 0x6e, 0x69, 0x61,
   0x6e, 0x0a, 0x6c, 0x61, 0x6e, 0x67, 0x75, 0x61, 0x67, 0x65, 0x20, 0x73,
@@ -16,6 +17,6 @@ const unsigned char __rawdata_sq[] = {
 BackgroundAudioVoice voice_sq = {
     "Albanian",
     103,
-    __rawdata_sq
+    __rawdata_sq,
+    &dict_sq
 };
-#include <libespeak-ng/dict/sq_dict.h>
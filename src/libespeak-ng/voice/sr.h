@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/sr_dict.h>
 const unsigned char __rawdata_sr[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x53, 0x65, 0x72, 0x62, 0x69, 0x61, 0x6e,
   0x0a, 0x6c, 0x61, 0x6e, 0x67, 0x75, 0x61, 0x67, 0x65, 0x20, 0x73, 0x72,
@@ -28,6 +29,6 @@ const unsigned char __rawdata_sr[] = {
 BackgroundAudioVoice voice_sr = {
     "Serbian",
     250,
-    __rawdata_sr
+    __rawdata_sr,
+    &dict_sr
 };
-#include <libespeak-ng/dict/sr_dict.h>
@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/sw_dict.h>
 const unsigned char __rawdata_sw[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x53, 0x77, 0x61, 0x68, 0x69, 0x6c, 0x69,
   0x0a, 0x6c, 0x61, 0x6e, 0x67, 0x75, 0x61, 0x67, 0x65, 0x20, 0x73, 0x77,
@@ -11,6 +12,6 @@ const unsigned char __rawdata_sw[] = {
 BackgroundAudioVoice voice_sw = {
     "Swahili",
     41,
-    __rawdata_sw
+    __rawdata_sw,
+    &dict_sw
 };
-#include <libespeak-ng/dict/sw_dict.h>
@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/ta_dict.h>
 const unsigned char __rawdata_ta[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x54, 0x61, 0x6d, 0x69, 0x6c, 0x0a, 0x6c,
   0x61, 0x6e, 0x67, 0x75, 0x61, 0x67, 0x65, 0x20, 0x74, 0x61, 0x0a, 0x0a,
@@ -12,6 +13,6 @@ const unsigned char __rawdata_ta[] = {
 BackgroundAudioVoice voice_ta = {
     "Tamil",
     51,
-    __rawdata_ta
+    __rawdata_ta,
+    &dict_ta
 };
-#include <libespeak-ng/dict/ta_dict.h>
@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/te_dict.h>
 const unsigned char __rawdata_te[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x54, 0x65, 0x6c, 0x75, 0x67, 0x75, 0x0a,
   0x6c, 0x61, 0x6e, 0x67, 0x75, 0x61, 0x67, 0x65, 0x20, 0x74, 0x65, 0x0a,
@@ -13,6 +14,6 @@ const unsigned char __rawdata_te[] = {
 BackgroundAudioVoice voice_te = {
     "Telugu",
     70,
-    __rawdata_te
+    __rawdata_te,
+    &dict_te
 };
-#include <libespeak-ng/dict/te_dict.h>
@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/th_dict.h>
 const unsigned char __rawdata_th[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x54, 0x68, 0x61, 0x69, 0x0a, 0x6c, 0x61,
   0x6e, 0x67, 0x75, 0x61, 0x67, 0x65, 0x20, 0x74, 0x68, 0x0a, 0x73, 0x74,
@@ -11,6 +12,6 @@ const unsigned char __rawdata_th[] = {
 BackgroundAudioVoice voice_th = {
     "Thai",
     37,
-    __rawdata_th
+    __rawdata_th,
+    &dict_th
 };
-#include <libespeak-ng/dict/th_dict.h>
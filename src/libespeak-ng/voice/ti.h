@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/ti_dict.h>
 const unsigned char __rawdata_ti[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x54, 0x69, 0x67, 0x72, 0x69, 0x6e, 0x79,
   0x61, 0x0a, 0x6c, 0x61, 0x6e, 0x67, 0x75, 0x61, 0x67, 0x65, 0x20, 0x74,
@@ -15,6 +16,6 @@ const unsigned char __rawdata_ti[] = {
 BackgroundAudioVoice voice_ti = {
     "Tigrinya",
     93,
-    __rawdata_ti
+    __rawdata_ti,
+    &dict_ti
 };
-#include <libespeak-ng/dict/ti_dict.h>
@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/tn_dict.h>
 const unsigned char __rawdata_tn[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x53, 0x65, 0x74, 0x73, 0x77, 0x61, 0x6e,
   0x61, 0x0a, 0x6c, 0x61, 0x6e, 0x67, 0x75, 0x61, 0x67, 0x65, 0x20, 0x74,
@@ -11,6 +12,6 @@ const unsigned char __rawdata_tn[] = {
 BackgroundAudioVoice voice_tn = {
     "Setswana",
     42,
-    __rawdata_tn
+    __rawdata_tn,
+    &dict_tn
 };
-#include <libespeak-ng/dict/tn_dict.h>
@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/tt_dict.h>
 const unsigned char __rawdata_tt[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x54, 0x61, 0x74, 0x61, 0x72, 0x0a, 0x6c,
   0x61, 0x6e, 0x67, 0x75, 0x61, 0x67, 0x65, 0x20, 0x74, 0x74, 0x0a
@@ -9,6 +10,6 @@ const unsigned char __rawdata_tt[] = {
 BackgroundAudioVoice voice_tt = {
     "Tatar",
     23,
-    __rawdata_tt
+    __rawdata_tt,
+    &dict_tt
 };
-#include <libespeak-ng/dict/tt_dict.h>
@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/uk_dict.h>
 const unsigned char __rawdata_uk[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x55, 0x6b, 0x72, 0x61, 0x69, 0x6e, 0x69,
   0x61, 0x6e, 0x0a, 0x6c, 0x61, 0x6e, 0x67, 0x75, 0x61, 0x67, 0x65, 0x20,
@@ -16,6 +17,6 @@ const unsigned char __rawdata_uk[] = {
 BackgroundAudioVoice voice_uk = {
     "Ukrainian",
     97,
-    __rawdata_uk
+    __rawdata_uk,
+    &dict_uk
 };
-#include <libespeak-ng/dict/uk_dict.h>
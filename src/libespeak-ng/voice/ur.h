@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/ur_dict.h>
 const unsigned char __rawdata_ur[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x55, 0x72, 0x64, 0x75, 0x0a, 0x6c, 0x61,
   0x6e, 0x67, 0x75, 0x61, 0x67, 0x65, 0x20, 0x75, 0x72, 0x0a, 0x6d, 0x61,
@@ -15,6 +16,6 @@ const unsigned char __rawdata_ur[] = {
 BackgroundAudioVoice voice_ur = {
     "Urdu",
     94,
-    __rawdata_ur
+    __rawdata_ur,
+    &dict_ur
 };
-#include <libespeak-ng/dict/ur_dict.h>
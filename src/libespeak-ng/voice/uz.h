@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/uz_dict.h>
 const unsigned char __rawdata_uz[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x55, 0x7a, 0x62, 0x65, 0x6b, 0x0a, 0x6c,
   0x61, 0x6e, 0x67, 0x75, 0x61, 0x67, 0x65, 0x20, 0x75, 0x7a, 0x0a, 0x0a,
@@ -11,6 +12,6 @@ const unsigned char __rawdata_uz[] = {
 BackgroundAudioVoice voice_uz = {
     "Uzbek",
     39,
-    __rawdata_uz
+    __rawdata_uz,
+    &dict_uz
 };
-#include <libespeak-ng/dict/uz_dict.h>
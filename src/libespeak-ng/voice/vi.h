@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/vi_dict.h>
 const unsigned char __rawdata_vi[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x56, 0x69, 0x65, 0x74, 0x6e, 0x61, 0x6d,
   0x65, 0x73, 0x65, 0x20, 0x28, 0x4e, 0x6f, 0x72, 0x74, 0x68, 0x65, 0x72,
@@ -17,6 +18,6 @@ const unsigned char __rawdata_vi[] = {
 BackgroundAudioVoice voice_vi = {
     "Vietnamese (Northern)",
     111,
-    __rawdata_vi
+    __rawdata_vi,
+    &dict_vi
 };
-#include <libespeak-ng/dict/vi_dict.h>
@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/vi_dict.h>
 const unsigned char __rawdata_vi_vn_x_central[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x56, 0x69, 0x65, 0x74, 0x6e, 0x61, 0x6d,
   0x65, 0x73, 0x65, 0x20, 0x28, 0x43, 0x65, 0x6e, 0x74, 0x72, 0x61, 0x6c,
@@ -19,6 +20,6 @@ const unsigned char __rawdata_vi_vn_x_central[] = {
 BackgroundAudioVoice voice_vi_vn_x_central = {
     "Vietnamese (Central)",
     143,
-    __rawdata_vi_vn_x_central
+    __rawdata_vi_vn_x_central,
+    &dict_vi
 };
-#include <libespeak-ng/dict/vi_dict.h>
@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/vi_dict.h>
 const unsigned char __rawdata_vi_vn_x_south[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x56, 0x69, 0x65, 0x74, 0x6e, 0x61, 0x6d,
   0x65, 0x73, 0x65, 0x20, 0x28, 0x53, 0x6f, 0x75, 0x74, 0x68, 0x65, 0x72,
@@ -19,6 +20,6 @@ const unsigned char __rawdata_vi_vn_x_south[] = {
 BackgroundAudioVoice voice_vi_vn_x_south = {
     "Vietnamese (Southern)",
     142,
-    __rawdata_vi_vn_x_south
+    __rawdata_vi_vn_x_south,
+    &dict_vi
 };
-#include <libespeak-ng/dict/vi_dict.h>
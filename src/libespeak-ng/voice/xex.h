@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/xex_dict.h>
 const unsigned char __rawdata_xex[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x78, 0x65, 0x78, 0x74, 0x61, 0x6e, 0x2d,
   0x74, 0x65, 0x73, 0x74, 0x0a, 0x6c, 0x61, 0x6e, 0x67, 0x75, 0x61, 0x67,
@@ -16,6 +17,6 @@ const unsigned char __rawdata_xex[] = {
 BackgroundAudioVoice voice_xex = {
     "xextan-test",
     103,
-    __rawdata_xex
+    __rawdata_xex,
+    &dict_xex
 };
-#include <libespeak-ng/dict/xex_dict.h>
@@ -1,6 +1,7 @@
 // Auto-generated, do not edit!  See lib/update_lib.sh
 #pragma once
 #include <BackgroundAudioSpeech.h>
+#include <libespeak-ng/dict/yue_dict.h>
 const unsigned char __rawdata_yue[] = {
   0x6e, 0x61, 0x6d, 0x65, 0x20, 0x43, 0x68, 0x69, 0x6e, 0x65, 0x73, 0x65,
   0x20, 0x28, 0x43, 0x61, 0x6e, 0x74, 0x6f, 0x6e, 0x65, 0x73, 0x65, 0x29,
@@ -24,6 +25,6 @@ const unsigned char __rawdata_yue[] = {
 BackgroundAudioVoice voice_yue = {
     "Chinese (Cantonese)",
     194,
-    __rawdata_yue
+    __rawdata_yue,
+    &dict_yue
 };
-#include <libespeak-ng/dict/yue_dict.h>
@@ -66,6 +66,7 @@
 #include "synthesize.h"               // for SetSpeed, SPEED_FACTORS, speed
 #include "translate.h"                // for LANGUAGE_OPTIONS, DeleteTranslator
 #include "wavegen.h"                  // for InitBreath
+#include "context.h"                  // for CONTEXT_VAR
 
 #ifndef ARDUINO
 static int AddToVoicesList(const char *fname, int len_path_voices, int is_language_file);
@@ -99,8 +100,29 @@ static const char *const variant_lists[3] = { variants_either, variants_male, va
 static voice_t voicedata;
 voice_t *voice = &voicedata;
 
+// Each speech context translates with its own voice
+const CONTEXT_VAR voices_context_vars[] = {
+	CONTEXT_VAR_ITEM(voice),
+	CONTEXT_VAR_END
+};
+
 static const char *_voice = NULL;
 static size_t _voiceLen = 0;
+
+// Voices parsed once by espeak_CacheVoice, with their translators, to switch between without loading them again
+#define N_VOICE_CACHE 8
+typedef struct {
+	const unsigned char *data;
+	Translator *translator;
+	voice_t voice;
+	int fast_settings;
+	int n_replace_phonemes;
+	REPLACE_PHONEMES replace_phonemes[N_REPLACE_PHONEMES];
+} VOICE_CACHE;
+static VOICE_CACHE *voice_cache[N_VOICE_CACHE];
+static int n_voice_cache = 0;
+static bool caching_voice = false;
+
 ESPEAK_API void espeak_InstallVoice(const unsigned char *data, size_t len) {
         _voice = (const char *)data;
         _voiceLen = len;
@@ -325,7 +347,8 @@ void VoiceReset(int tone_only)
 
 	voice->roughness = 2;
 
-	InitBreath();
+	if (!caching_voice)
+		InitBreath(); // the wave generator may still be using the current voice
 	for (pk = 0; pk < N_PEAKS; pk++) {
 		voice->freq[pk] = 256;
 		voice->freq2[pk] = voice->freq[pk];
@@ -1410,6 +1433,113 @@ ESPEAK_NG_API espeak_ng_STATUS espeak_ng_SetVoiceByProperties(espeak_VOICE *voic
 	return ENS_OK;
 }
 
+static bool IsCachedTranslator(Translator *tr)
+{
+	for (int ix = 0; ix < n_voice_cache; ix++) {
+		if (voice_cache[ix]->translator == tr)
+			return true;
+	}
+	return false;
+}
+
+ESPEAK_API int espeak_CacheVoice(const unsigned char *data, size_t len)
+{
+	VOICE_CACHE *vc;
+	voice_t *saved_voicedata = NULL;
+	voice_t *prev_voice = voice;
+	Translator *prev_translator = translator;
+	int prev_fast_settings = speed.fast_settings;
+	int prev_n_replace_phonemes = n_replace_phonemes;
+	REPLACE_PHONEMES prev_replace_phonemes[N_REPLACE_PHONEMES];
+	char prev_dictionary_name[40];
+	int ix;
+
+	for (ix = 0; ix < n_voice_cache; ix++) {
+		if (voice_cache[ix]->data == data)
+			return ix;
+	}
+	if (n_voice_cache >= N_VOICE_CACHE)
+		return -1;
+	if ((vc = (VOICE_CACHE *)malloc(sizeof(VOICE_CACHE))) == NULL)
+		return -1;
+
+	// LoadVoice replaces the current voice, so keep everything it changes to put back afterwards
+	if (voice == &voicedata) {
+		if ((saved_voicedata = (voice_t *)malloc(sizeof(voice_t))) == NULL) {
+			free(vc);
+			return -1;
+		}
+		memcpy(saved_voicedata, &voicedata, sizeof(voice_t));
+	}
+	memcpy(prev_replace_phonemes, replace_phonemes, sizeof(prev_replace_phonemes));
+	strcpy(prev_dictionary_name, dictionary_name);
+
+	caching_voice = true;
+	translator = NULL; // not to be deleted by LoadVoice
+	espeak_InstallVoice(data, len);
+	voice_t *v = LoadVoice("internal", 0x10);
+	caching_voice = false;
+
+	if (v != NULL) {
+		vc->data = data;
+		vc->translator = translator;
+		memcpy(&vc->voice, v, sizeof(voice_t));
+		vc->fast_settings = speed.fast_settings;
+		vc->n_replace_phonemes = n_replace_phonemes;
+		memcpy(vc->replace_phonemes, replace_phonemes, sizeof(vc->replace_phonemes));
+	}
+
+	translator = prev_translator;
+	voice = prev_voice;
+	if (saved_voicedata != NULL) {
+		memcpy(&voicedata, saved_voicedata, sizeof(voice_t));
+		free(saved_voicedata);
+	}
+	speed.fast_settings = prev_fast_settings;
+	n_replace_phonemes = prev_n_replace_phonemes;
+	memcpy(replace_phonemes, prev_replace_phonemes, sizeof(prev_replace_phonemes));
+	strcpy(dictionary_name, prev_dictionary_name);
+	SelectPhonemeTable(voice->phoneme_tab_ix);
+	SetSpeed(3);
+
+	if (v == NULL) {
+		free(vc);
+		return -1;
+	}
+	voice_cache[n_voice_cache] = vc;
+	return n_voice_cache++;
+}
+
+ESPEAK_API int espeak_SelectVoice(espeak_CONTEXT *ctx, int id)
+{
+	VOICE_CACHE *vc;
+
+	espeak_SetContext(ctx);
+	if ((id < 0) || (id >= n_voice_cache))
+		return -1;
+	vc = voice_cache[id];
+
+	if ((translator != NULL) && (translator != vc->translator) && !IsCachedTranslator(translator))
+		DeleteTranslator(translator);
+	translator = vc->translator;
+	voice = &vc->voice;
+	speed.fast_settings = vc->fast_settings;
+	n_replace_phonemes = vc->n_replace_phonemes;
+	memcpy(replace_phonemes, vc->replace_phonemes, vc->n_replace_phonemes * sizeof(REPLACE_PHONEMES));
+	strcpy(dictionary_name, translator->dictionary_name);
+	SetSpeed(3);
+	return 0;
+}
+
+ESPEAK_API int espeak_GenerateVoice(espeak_CONTEXT *ctx, int id)
+{
+	espeak_SetContext(ctx);
+	if ((id < 0) || (id >= n_voice_cache))
+		return -1;
+	GenerateVoice(&voice_cache[id]->voice, voice_cache[id]->translator);
+	return 0;
+}
+
 #pragma GCC visibility pop
 
 void FreeVoiceList(void)
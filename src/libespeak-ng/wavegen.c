@@ -52,6 +52,8 @@
 
 #include "sintab.h"
 #include "speech.h"
+#include "context.h"
+#include "../BackgroundAudioProfile.h"
 
 static void SetSynth(int length, int modn, frame_t *fr1, frame_t *fr2, voice_t *v);
 
@@ -75,7 +77,8 @@ static int peak_height[N_PEAKS];
 int echo_head;
 int echo_tail;
 int echo_amp = 0;
-short echo_buf[N_ECHO_BUF];
+static short echo_buf0[N_ECHO_BUF];
+short *echo_buf = echo_buf0;
 static int echo_length = 0; // period (in sample\) to ensure completion of echo at the end of speech, set in WavegenSetEcho()
 
 static int voicing;
@@ -86,7 +89,8 @@ static RESONATOR rbreath[N_PEAKS];
 static int harm_inc[N_LOWHARM]; // only for these harmonics do we interpolate amplitude between steps
 static int *harmspect;
 static int hswitch = 0;
-static int hspect[2][MAX_HARMONIC]; // 2 copies, we interpolate between then
+static int hspect0[2][MAX_HARMONIC]; // 2 copies, we interpolate between then
+static int (*hspect)[MAX_HARMONIC] = hspect0;
 
 static int nsamples = 0; // number to do
 static int modulation_type = 0;
@@ -108,17 +112,32 @@ static int cycle_samples; // number of samples in a cycle at current pitch
 static int cbytes;
 static int hf_factor;
 
-static double minus_pi_t;
-static double two_pi_t;
-
 unsigned char *out_ptr;
 unsigned char *out_end;
 
 espeak_ng_OUTPUT_HOOKS* output_hooks = NULL;
 static int const_f0 = 0;
 
+// Kept between calls by Wavegen, PlaySilence, PlayWave, and WavegenFill2
+static int Flutter_ix = 0;
+static int maxh, maxh2;
+static int agc = 256;
+static int h_switch_sign = 0;
+static int cycle_count = 0;
+static int amplitude2 = 0; // adjusted for pitch
+static int silence_samples;
+static int wave_samples;
+static int wave_ix = 0;
+static bool fill_resume = false;
+static int echo_complete = 0;
+
+// WavegenSetVoice's copy of the voice
+static voice_t wvoice_data0;
+static voice_t *wvoice_data = &wvoice_data0;
+
 // the queue of operations passed to wavegen from sythesize
-intptr_t wcmdq[N_WCMDQ][4];
+static intptr_t wcmdq0[N_WCMDQ][4];
+intptr_t (*wcmdq)[4] = wcmdq0;
 int wcmdq_head = 0;
 int wcmdq_tail = 0;
 
@@ -327,6 +346,70 @@ static const unsigned char pk_shape2[PEAKSHAPEW+1] = {
 
 static const unsigned char *pk_shape;
 
+// State of the wave generator which belongs to each speech context
+const CONTEXT_VAR wavegen_context_vars[] = {
+	CONTEXT_VAR_ITEM(wvoice), CONTEXT_VAR_ITEM(wvoice_data),
+	CONTEXT_VAR_ITEM(option_harmonic1), CONTEXT_VAR_ITEM(flutter_amp),
+	CONTEXT_VAR_ITEM(general_amplitude), CONTEXT_VAR_ITEM(consonant_amp),
+	CONTEXT_VAR_ITEM(embedded_value),
+	CONTEXT_VAR_ITEM(peaks), CONTEXT_VAR_ITEM(peak_harmonic), CONTEXT_VAR_ITEM(peak_height),
+	CONTEXT_VAR_ITEM(echo_head), CONTEXT_VAR_ITEM(echo_tail), CONTEXT_VAR_ITEM(echo_amp),
+	CONTEXT_VAR_ITEM(echo_buf), CONTEXT_VAR_ITEM(echo_length),
+	CONTEXT_VAR_ITEM(voicing), CONTEXT_VAR_ITEM(rbreath),
+	CONTEXT_VAR_ITEM(harm_inc), CONTEXT_VAR_ITEM(harmspect), CONTEXT_VAR_ITEM(hswitch), CONTEXT_VAR_ITEM(hspect),
+	CONTEXT_VAR_ITEM(nsamples), CONTEXT_VAR_ITEM(modulation_type),
+	CONTEXT_VAR_ITEM(glottal_flag), CONTEXT_VAR_ITEM(glottal_reduce),
+	CONTEXT_VAR_ITEM(wdata),
+	CONTEXT_VAR_ITEM(amp_ix), CONTEXT_VAR_ITEM(amp_inc), CONTEXT_VAR_ITEM(amplitude_env),
+	CONTEXT_VAR_ITEM(samplecount), CONTEXT_VAR_ITEM(samplecount_start), CONTEXT_VAR_ITEM(end_wave),
+	CONTEXT_VAR_ITEM(wavephase), CONTEXT_VAR_ITEM(phaseinc), CONTEXT_VAR_ITEM(cycle_samples),
+	CONTEXT_VAR_ITEM(cbytes), CONTEXT_VAR_ITEM(hf_factor), CONTEXT_VAR_ITEM(const_f0),
+	CONTEXT_VAR_ITEM(Flutter_ix), CONTEXT_VAR_ITEM(maxh), CONTEXT_VAR_ITEM(maxh2),
+	CONTEXT_VAR_ITEM(agc), CONTEXT_VAR_ITEM(h_switch_sign), CONTEXT_VAR_ITEM(cycle_count),
+	CONTEXT_VAR_ITEM(amplitude2), CONTEXT_VAR_ITEM(silence_samples),
+	CONTEXT_VAR_ITEM(wave_samples), CONTEXT_VAR_ITEM(wave_ix),
+	CONTEXT_VAR_ITEM(fill_resume), CONTEXT_VAR_ITEM(echo_complete),
+	CONTEXT_VAR_ITEM(wcmdq), CONTEXT_VAR_ITEM(wcmdq_head), CONTEXT_VAR_ITEM(wcmdq_tail),
+	CONTEXT_VAR_ITEM(pk_shape),
+	CONTEXT_VAR_END
+};
+
+const CONTEXT_BUFFER wavegen_context_buffers[] = {
+	{ &wvoice_data, sizeof(wvoice_data0) },
+	{ &echo_buf, sizeof(echo_buf0) },
+	{ &hspect, sizeof(hspect0) },
+	{ &wcmdq, sizeof(wcmdq0) },
+	{ NULL, 0 }
+};
+
+void WavegenResetContext(void)
+{
+	// Nothing queued or sounding, with the same voice and echo.  The buffers start out zeroed
+	int ix;
+
+	if (wvoice != NULL) {
+		memcpy(wvoice_data, wvoice, sizeof(voice_t));
+		wvoice = wvoice_data;
+	}
+	for (ix = 0; ix < N_EMBEDDED_VALUES; ix++)
+		embedded_value[ix] = embedded_default[ix];
+	wcmdq_head = 0;
+	wcmdq_tail = 0;
+	hswitch = 0;
+	harmspect = hspect[0];
+	samplecount = 0;
+	nsamples = 0;
+	wavephase = 0x7fffffff;
+	wdata.n_mix_wavefile = 0;
+	wdata.amplitude = 32;
+	wdata.amplitude_fmt = 100;
+	agc = 256;
+	amplitude2 = 0;
+	cycle_count = 0;
+	fill_resume = false;
+	echo_complete = 0;
+}
+
 void WavegenInit(int rate, int wavemult_fact)
 {
 	int ix;
@@ -408,7 +491,7 @@ static void WavegenSetEcho(void)
 	if (amp > 100)
 		amp = 100;
 
-	memset(echo_buf, 0, sizeof(echo_buf));
+	memset(echo_buf, 0, N_ECHO_BUF * sizeof(short));
 	echo_tail = 0;
 
 	if (embedded_value[EMBED_H] > 0) {
@@ -547,7 +630,6 @@ static void AdvanceParameters(void)
 
 	int x = 0;
 	int ix;
-	static int Flutter_ix = 0;
 
 	// advance the pitch
 	wdata.pitch_ix += wdata.pitch_inc;
@@ -577,15 +659,15 @@ static void AdvanceParameters(void)
 
 	for (ix = 0; ix <= wvoice->n_harmonic_peaks; ix++) {
 		peaks[ix].freq1 += peaks[ix].freq_inc;
-		peaks[ix].freq = (int)peaks[ix].freq1;
+		peaks[ix].freq = (int)(peaks[ix].freq1 >> PEAK_FRAC);
 		peaks[ix].height1 += peaks[ix].height_inc;
-		if ((peaks[ix].height = (int)peaks[ix].height1) < 0)
+		if ((peaks[ix].height = (int)(peaks[ix].height1 >> PEAK_FRAC)) < 0)
 			peaks[ix].height = 0;
 		peaks[ix].left1 += peaks[ix].left_inc;
-		peaks[ix].left = (int)peaks[ix].left1;
+		peaks[ix].left = (int)(peaks[ix].left1 >> PEAK_FRAC);
 		if (ix < 3) {
 			peaks[ix].right1 += peaks[ix].right_inc;
-			peaks[ix].right = (int)peaks[ix].right1;
+			peaks[ix].right = (int)(peaks[ix].right1 >> PEAK_FRAC);
 		} else
 			peaks[ix].right = peaks[ix].left;
 	}
@@ -593,23 +675,78 @@ static void AdvanceParameters(void)
 		// formants 6,7,8 don't have a width parameter
 		if (ix < 7) {
 			peaks[ix].freq1 += peaks[ix].freq_inc;
-			peaks[ix].freq = (int)peaks[ix].freq1;
+			peaks[ix].freq = (int)(peaks[ix].freq1 >> PEAK_FRAC);
 		}
 		peaks[ix].height1 += peaks[ix].height_inc;
-		if ((peaks[ix].height = (int)peaks[ix].height1) < 0)
+		if ((peaks[ix].height = (int)(peaks[ix].height1 >> PEAK_FRAC)) < 0)
 			peaks[ix].height = 0;
 	}
 }
 
-static double resonator(RESONATOR *r, double input)
+// cos and sin of (k * 1024/65536) of a cycle, and exp(-pi * k * 1024/65536), Q30
+static const int32_t res_cos_tab[32] = {
+	1073741824, 1068571464, 1053110176, 1027506862, 992008094, 946955747, 892783698, 830013654,
+	759250125, 681174602, 596538995, 506158392, 410903207, 311690799, 209476638, 105245103,
+	0, -105245103, -209476638, -311690799, -410903207, -506158392, -596538995, -681174602,
+	-759250125, -830013654, -892783698, -946955747, -992008094, -1027506862, -1053110176, -1068571464,
+};
+static const int32_t res_sin_tab[32] = {
+	0, 105245103, 209476638, 311690799, 410903207, 506158392, 596538995, 681174602,
+	759250125, 830013654, 892783698, 946955747, 992008094, 1027506862, 1053110176, 1068571464,
+	1073741824, 1068571464, 1053110176, 1027506862, 992008094, 946955747, 892783698, 830013654,
+	759250125, 681174602, 596538995, 506158392, 410903207, 311690799, 209476638, 105245103,
+};
+static const int32_t res_exp_tab[32] = {
+	1073741824, 1022307365, 973336722, 926711875, 882320455, 840055476, 799815077, 761502277,
+	725024739, 690294551, 657228011, 625745427, 595770923, 567232261, 540060660, 514190634,
+	489559837, 466108906, 443781323, 422523277, 402283536, 383013321, 364666189, 347197922,
+	330566422, 314731605, 299655309, 285301198, 271634679, 258622815, 246234246, 234439115,
+};
+
+#define Q30MUL(x, y) ((int32_t)(((int64_t)(x) * (y)) >> 30))
+
+static int32_t ResonatorPhase(int hz)
 {
-	double x;
+	// convert Hz to a fraction of the sample rate (Q24), limited to below Nyquist
+	int32_t ph;
+
+	if (hz <= 0)
+		return 0;
+	ph = (int32_t)(((int64_t)hz << 24) / samplerate);
+	return (ph > 0x7fffff) ? 0x7fffff : ph;
+}
+
+static void ResonatorCosExp(int freq, int bwidth, int32_t *cos_x, int32_t *exp_x)
+{
+	// cos(2*pi*freq/samplerate) and exp(-pi*bwidth/samplerate), Q30
+	// The top 5 bits of the phase come from the tables, the remainder (< 0.1 radian) from a short series
+	int32_t ph, x, x2, c, s;
+
+	ph = ResonatorPhase(freq);
+	x = (int32_t)(((int64_t)(ph & 0x3ffff) * 411775) >> 10); // 2*pi/2^24, Q30
+	x2 = Q30MUL(x, x);
+	c = (1 << 30) - (x2 >> 1) + Q30MUL(x2, x2) / 24;
+	s = x - Q30MUL(x, x2) / 6 + Q30MUL(Q30MUL(x, x2), x2) / 120;
+	*cos_x = Q30MUL(res_cos_tab[ph >> 18], c) - Q30MUL(res_sin_tab[ph >> 18], s);
+
+	ph = ResonatorPhase(bwidth);
+	x = (int32_t)(((int64_t)(ph & 0x3ffff) * 205887) >> 10); // pi/2^24, Q30
+	x2 = Q30MUL(x, x);
+	c = (1 << 30) - x + (x2 >> 1) - Q30MUL(x, x2) / 6 + Q30MUL(x2, x2) / 24;
+	*exp_x = Q30MUL(res_exp_tab[ph >> 18], c);
+}
 
-	x = r->a * input + r->b * r->x1 + r->c * r->x2;
+static int resonator(RESONATOR *r, int input)
+{
+	// the state keeps 8 fractional bits so narrow, low frequency resonators don't drift, leaving room for
+	// a gain of 1000 on the breath noise, which only narrow formants within a kHz or so of Nyquist exceed
+	int32_t x;
+
+	x = (int32_t)(((int64_t)r->a * (input << 8) + (int64_t)r->b * r->x1 + (int64_t)r->c * r->x2 + (1 << 27)) >> 28);
 	r->x2 = r->x1;
 	r->x1 = x;
 
-	return x;
+	return x >> 8;
 }
 
 static void setresonator(RESONATOR *rp, int freq, int bwidth, int init)
@@ -618,32 +755,25 @@ static void setresonator(RESONATOR *rp, int freq, int bwidth, int init)
 	// bwidth  Bandwidth of resonator in Hz
 	// init    Initialize internal data
 
-	double x;
-	double arg;
+	int32_t cos_x;
+	int32_t exp_x;
 
 	if (init) {
 		rp->x1 = 0;
 		rp->x2 = 0;
 	}
 
-	arg = minus_pi_t * bwidth;
-	x = exp(arg);
+	ResonatorCosExp(freq, bwidth, &cos_x, &exp_x);
 
-	rp->c = -(x * x);
-
-	arg = two_pi_t * freq;
-	rp->b = x * cos(arg) * 2.0;
-
-	rp->a = 1.0 - rp->b - rp->c;
+	rp->c = -(int32_t)(((int64_t)exp_x * exp_x) >> 32);
+	rp->b = (int32_t)(((int64_t)exp_x * cos_x) >> 31);
+	rp->a = (1 << 28) - rp->b - rp->c;
 }
 
 void InitBreath(void)
 {
 	int ix;
 
-	minus_pi_t = -M_PI / samplerate;
-	two_pi_t = -2.0 * minus_pi_t;
-
 	for (ix = 0; ix < N_PEAKS; ix++)
 		setresonator(&rbreath[ix], 2000, 200, 1);
 }
@@ -680,7 +810,7 @@ static int ApplyBreath(void)
 		int amp;
 		if ((amp = wvoice->breath[ix]) != 0) {
 			amp *= (peaks[ix].height >> 14);
-			value += (int)resonator(&rbreath[ix], noise) * amp;
+			value += resonator(&rbreath[ix], noise) * amp;
 		}
 	}
 	return value;
@@ -702,16 +832,11 @@ static int Wavegen(int length, int modulation, bool resume, frame_t *fr1, frame_
 	int z, z1, z2;
 	int echo;
 	int ov;
-	static int maxh, maxh2;
 	int pk;
 	signed char c;
 	int sample;
 	int amp;
 	int modn_amp = 1, modn_period;
-	static int agc = 256;
-	static int h_switch_sign = 0;
-	static int cycle_count = 0;
-	static int amplitude2 = 0; // adjusted for pitch
 
 	// continue until the output buffer is full, or
 	// the required number of samples have been produced
@@ -800,8 +925,8 @@ static int Wavegen(int length, int modulation, bool resume, frame_t *fr1, frame_
 
 				// introduce roughness into the sound by reducing the amplitude of
 				modn_period = 0;
-				if (voice->roughness < N_ROUGHNESS) {
-					modn_period = modulation_tab[voice->roughness][modulation_type];
+				if (wvoice->roughness < N_ROUGHNESS) {
+					modn_period = modulation_tab[wvoice->roughness][modulation_type];
 					modn_amp = modn_period & 0xf;
 					modn_period = modn_period >> 4;
 				}
@@ -910,8 +1035,6 @@ static int Wavegen(int length, int modulation, bool resume, frame_t *fr1, frame_
 
 static int PlaySilence(int length, bool resume)
 {
-	static int n_samples;
-
 	nsamples = 0;
 	samplecount = 0;
 	wavephase = 0x7fffffff;
@@ -920,10 +1043,10 @@ static int PlaySilence(int length, bool resume)
 		return 0;
 
 	if (resume == false)
-		n_samples = length;
+		silence_samples = length;
 
 	int value = 0;
-	while (n_samples-- > 0) {
+	while (silence_samples-- > 0) {
 		value = (echo_buf[echo_tail++] * echo_amp) >> 8;
 
 		if (echo_tail >= N_ECHO_BUF)
@@ -945,28 +1068,26 @@ static int PlaySilence(int length, bool resume)
 
 static int PlayWave(int length, bool resume, unsigned char *data, int scale, int amp)
 {
-	static int n_samples;
-	static int ix = 0;
 	int value;
 	signed char c;
 
 	if (resume == false) {
-		n_samples = length;
-		ix = 0;
+		wave_samples = length;
+		wave_ix = 0;
 	}
 
 	nsamples = 0;
 	samplecount = 0;
 
-	while (n_samples-- > 0) {
+	while (wave_samples-- > 0) {
 		if (scale == 0) {
 			// 16 bits data
-			c = data[ix+1];
-			value = data[ix] + (c * 256);
-			ix += 2;
+			c = data[wave_ix+1];
+			value = data[wave_ix] + (c * 256);
+			wave_ix += 2;
 		} else {
 			// 8 bit data, shift by the specified scale factor
-			value = (signed char)data[ix++] * scale;
+			value = (signed char)data[wave_ix++] * scale;
 		}
 		value *= (consonant_amp * general_amplitude); // reduce strength of consonant
 		value = value >> 10;
@@ -1074,10 +1195,8 @@ void SetEmbedded(int control, int value)
 
 void WavegenSetVoice(voice_t *v)
 {
-	static voice_t v2;
-
-	memcpy(&v2, v, sizeof(v2));
-	wvoice = &v2;
+	memcpy(wvoice_data, v, sizeof(voice_t));
+	wvoice = wvoice_data;
 
 	if (v->peak_shape == 0)
 		pk_shape = pk_shape1;
@@ -1169,7 +1288,7 @@ static void SetSynth(int length, int modn, frame_t *fr1, frame_t *fr2, voice_t *
 		return;
 
 	int ix;
-	double next;
+	int next;
 	int length2;
 	int length4;
 	int qix;
@@ -1220,28 +1339,28 @@ static void SetSynth(int length, int modn, frame_t *fr1, frame_t *fr2, voice_t *
 
 	for (ix = 0; ix < 8; ix++) {
 		if (ix < 7) {
-			peaks[ix].freq1 = (fr1->ffreq[ix] * v->freq[ix] + v->freqadd[ix]*256) << 8;
-			peaks[ix].freq = (int)peaks[ix].freq1;
+			peaks[ix].freq = (fr1->ffreq[ix] * v->freq[ix] + v->freqadd[ix]*256) << 8;
+			peaks[ix].freq1 = (int64_t)peaks[ix].freq << PEAK_FRAC;
 			next = (fr2->ffreq[ix] * v->freq[ix] + v->freqadd[ix]*256) << 8;
-			peaks[ix].freq_inc =  ((next - peaks[ix].freq1) * (STEPSIZE/4)) / length4; // lower headroom for fixed point math
+			peaks[ix].freq_inc = (((int64_t)next - peaks[ix].freq) << PEAK_FRAC) * (STEPSIZE/4) / length4;
 		}
 
-		peaks[ix].height1 = (fr1->fheight[ix] * v->height[ix]) << 6;
-		peaks[ix].height = (int)peaks[ix].height1;
+		peaks[ix].height = (fr1->fheight[ix] * v->height[ix]) << 6;
+		peaks[ix].height1 = (int64_t)peaks[ix].height << PEAK_FRAC;
 		next = (fr2->fheight[ix] * v->height[ix]) << 6;
-		peaks[ix].height_inc =  ((next - peaks[ix].height1) * STEPSIZE) / length2;
+		peaks[ix].height_inc = (((int64_t)next - peaks[ix].height) << PEAK_FRAC) * STEPSIZE / length2;
 
 		if ((ix <= 5) && (ix <= wvoice->n_harmonic_peaks)) {
-			peaks[ix].left1 = (fr1->fwidth[ix] * v->width[ix]) << 10;
-			peaks[ix].left = (int)peaks[ix].left1;
+			peaks[ix].left = (fr1->fwidth[ix] * v->width[ix]) << 10;
+			peaks[ix].left1 = (int64_t)peaks[ix].left << PEAK_FRAC;
 			next = (fr2->fwidth[ix] * v->width[ix]) << 10;
-			peaks[ix].left_inc =  ((next - peaks[ix].left1) * STEPSIZE) / length2;
+			peaks[ix].left_inc = (((int64_t)next - peaks[ix].left) << PEAK_FRAC) * STEPSIZE / length2;
 
 			if (ix < 3) {
-				peaks[ix].right1 = (fr1->fright[ix] * v->width[ix]) << 10;
-				peaks[ix].right = (int)peaks[ix].right1;
+				peaks[ix].right = (fr1->fright[ix] * v->width[ix]) << 10;
+				peaks[ix].right1 = (int64_t)peaks[ix].right << PEAK_FRAC;
 				next = (fr2->fright[ix] * v->width[ix]) << 10;
-				peaks[ix].right_inc = ((next - peaks[ix].right1) * STEPSIZE) / length2;
+				peaks[ix].right_inc = (((int64_t)next - peaks[ix].right) << PEAK_FRAC) * STEPSIZE / length2;
 			} else
 				peaks[ix].right = peaks[ix].left;
 		}
@@ -1268,8 +1387,6 @@ static int WavegenFill2(void)
 	int length;
 	int result;
 	int marker_type;
-	static bool resume = false;
-	static int echo_complete = 0;
 
 	if (wdata.pitch < 102400)
 		wdata.pitch = 102400; // min pitch, 25 Hz  (25 << 12)
@@ -1278,8 +1395,8 @@ static int WavegenFill2(void)
 		if (WcmdqUsed() <= 0) {
 			if (echo_complete > 0) {
 				// continue to play silence until echo is completed
-				resume = PlaySilence(echo_complete, resume);
-				if (resume == true)
+				fill_resume = PlaySilence(echo_complete, fill_resume);
+				if (fill_resume == true)
 					return 0; // not yet finished
 			}
 			return 1; // queue empty, close sound channel
@@ -1302,14 +1419,14 @@ static int WavegenFill2(void)
 		}
 			break;
 		case WCMD_PAUSE:
-			if (resume == false)
+			if (fill_resume == false)
 				echo_complete -= length;
 			wdata.n_mix_wavefile = 0;
 			wdata.amplitude_fmt = 100;
 #if USE_KLATT
 			KlattReset(1);
 #endif
-			result = PlaySilence(length, resume);
+			result = PlaySilence(length, fill_resume);
 			break;
 		case WCMD_WAVE:
 			echo_complete = echo_length;
@@ -1317,7 +1434,7 @@ static int WavegenFill2(void)
 #if USE_KLATT
 			KlattReset(1);
 #endif
-			result = PlayWave(length, resume, (unsigned char *)q[2], q[3] & 0xff, q[3] >> 8);
+			result = PlayWave(length, fill_resume, (unsigned char *)q[2], q[3] & 0xff, q[3] >> 8);
 			break;
 		case WCMD_WAVE2:
 			// wave file to be played at the same time as synthesis
@@ -1338,14 +1455,14 @@ static int WavegenFill2(void)
                         /* Fallthrough */
 		case WCMD_SPECT:
 			echo_complete = echo_length;
-			result = Wavegen(length & 0xffff, q[1] >> 16, resume, (frame_t *)q[2], (frame_t *)q[3], wvoice);
+			result = Wavegen(length & 0xffff, q[1] >> 16, fill_resume, (frame_t *)q[2], (frame_t *)q[3], wvoice);
 			break;
 #if USE_KLATT
 		case WCMD_KLATT2: // as WCMD_SPECT but stop any concurrent wave file
 			wdata.n_mix_wavefile = 0; // ... and drop through to WCMD_SPECT case
 		case WCMD_KLATT:
 			echo_complete = echo_length;
-			result = Wavegen_Klatt(length & 0xffff, resume, (frame_t *)q[2], (frame_t *)q[3], &wdata, wvoice);
+			result = Wavegen_Klatt(length & 0xffff, fill_resume, (frame_t *)q[2], (frame_t *)q[3], &wdata, wvoice);
 			break;
 #endif
 		case WCMD_MARKER:
@@ -1357,7 +1474,8 @@ static int WavegenFill2(void)
 			break;
 		case WCMD_VOICE:
 			WavegenSetVoice((voice_t *)q[2]);
-			free((voice_t *)q[2]);
+			if (q[1] == 0)
+				free((voice_t *)q[2]);
 			break;
 		case WCMD_EMBEDDED:
 			SetEmbedded(q[1], q[2]);
@@ -1365,7 +1483,7 @@ static int WavegenFill2(void)
 #if USE_MBROLA
 		case WCMD_MBROLA_DATA:
 			if (wvoice != NULL)
-				result = MbrolaFill(length, resume, (general_amplitude * wvoice->voicing)/64);
+				result = MbrolaFill(length, fill_resume, (general_amplitude * wvoice->voicing)/64);
 			break;
 #endif
 		case WCMD_FMT_AMPLITUDE:
@@ -1397,9 +1515,9 @@ static int WavegenFill2(void)
 
 		if (result == 0) {
 			WcmdqIncHead();
-			resume = false;
+			fill_resume = false;
 		} else
-			resume = true;
+			fill_resume = true;
 	}
 
 	return 0;
@@ -1456,7 +1574,9 @@ int WavegenFill(void)
 	p_start = out_ptr;
 #endif
 
+	BA_PROFILE_BEGIN(BA_PROFILE_SPEECH_WAVEGEN);
 	finished = WavegenFill2();
+	BA_PROFILE_END(BA_PROFILE_SPEECH_WAVEGEN);
 
 #if USE_LIBSONIC
 	if (sonicSpeed > 1.0) {
@@ -21,6 +21,8 @@
 #ifndef ESPEAK_NG_WAVEGEN_H
 #define ESPEAK_NG_WAVEGEN_H
 
+#include <stdint.h>
+
 #include "voice.h"
 
 #ifdef __cplusplus
@@ -28,19 +30,21 @@ extern "C"
 {
 #endif
 
+#define PEAK_FRAC 24 // fractional bits kept while a peak glides from one frame to the next
+
 typedef struct {
 	int freq;     // Hz<<16
 	int height;   // height<<15
 	int left;     // Hz<<16
 	int right;    // Hz<<16
-	double freq1; // floating point versions of the above
-	double height1;
-	double left1;
-	double right1;
-	double freq_inc; // increment by this every 64 samples
-	double height_inc;
-	double left_inc;
-	double right_inc;
+	int64_t freq1; // fixed point versions of the above, with PEAK_FRAC more fractional bits
+	int64_t height1;
+	int64_t left1;
+	int64_t right1;
+	int64_t freq_inc; // increment by this every 64 samples
+	int64_t height_inc;
+	int64_t left_inc;
+	int64_t right_inc;
 } wavegen_peaks_t;
 
 
@@ -46,10 +46,7 @@
 
 #include "aaccommon.h"
 
-//#include "profile.h"
-
-#define PROFILE_START(x)
-#define PROFILE_END()
+#include "../BackgroundAudioProfile.h"
 
 /**************************************************************************************
     Function:    AACInitDecoder
@@ -394,58 +391,66 @@ int AACDecode(HAACDecoder hAACDecoder, unsigned char **inbuf, int *bytesLeft, sh
 
         /* noiseless decoder and dequantizer */
         for (ch = 0; ch < elementChans; ch++) {
-            PROFILE_START("noiseless decoder");
+            BA_PROFILE_BEGIN(BA_PROFILE_AAC_HUFFMAN);
             err = DecodeNoiselessData(aacDecInfo, &inptr, &bitOffset, &bitsAvail, ch);
-            PROFILE_END();
+            BA_PROFILE_END(BA_PROFILE_AAC_HUFFMAN);
 
             if (err) {
                 return err;
             }
 
-            PROFILE_START("dequant");
-            if (Dequantize(aacDecInfo, ch)) {
+            BA_PROFILE_BEGIN(BA_PROFILE_AAC_DEQUANT);
+            err = Dequantize(aacDecInfo, ch);
+            BA_PROFILE_END(BA_PROFILE_AAC_DEQUANT);
+
+            if (err) {
                 return ERR_AAC_DEQUANT;
             }
-            PROFILE_END();
         }
 
-        PROFILE_START("mid-side and intensity stereo");
         /* mid-side and intensity stereo */
         if (aacDecInfo->currBlockID == AAC_ID_CPE) {
-            if (StereoProcess(aacDecInfo)) {
+            BA_PROFILE_BEGIN(BA_PROFILE_AAC_STEREO);
+            err = StereoProcess(aacDecInfo);
+            BA_PROFILE_END(BA_PROFILE_AAC_STEREO);
+
+            if (err) {
                 return ERR_AAC_STEREO_PROCESS;
             }
         }
-        PROFILE_END();
 
 
         /* PNS, TNS, inverse transform */
         for (ch = 0; ch < elementChans; ch++) {
-            PROFILE_START("PNS");
+            BA_PROFILE_BEGIN(BA_PROFILE_AAC_TNSPNS);
+            err = ERR_AAC_NONE;
             if (PNS(aacDecInfo, ch)) {
-                return ERR_AAC_PNS;
-            }
-            PROFILE_END();
-
-            if (aacDecInfo->sbDeinterleaveReqd[ch]) {
+                err = ERR_AAC_PNS;
+            } else if (aacDecInfo->sbDeinterleaveReqd[ch]) {
                 /* deinterleave short blocks, if required */
                 if (DeinterleaveShortBlocks(aacDecInfo, ch)) {
-                    return ERR_AAC_SHORT_BLOCK_DEINT;
+                    err = ERR_AAC_SHORT_BLOCK_DEINT;
+                } else {
+                    aacDecInfo->sbDeinterleaveReqd[ch] = 0;
                 }
-                aacDecInfo->sbDeinterleaveReqd[ch] = 0;
             }
 
-            PROFILE_START("TNS");
-            if (TNSFilter(aacDecInfo, ch)) {
-                return ERR_AAC_TNS;
+            if (!err && TNSFilter(aacDecInfo, ch)) {
+                err = ERR_AAC_TNS;
             }
-            PROFILE_END();
+            BA_PROFILE_END(BA_PROFILE_AAC_TNSPNS);
 
-            PROFILE_START("IMDCT");
-            if (IMDCT(aacDecInfo, ch, baseChan + ch, outbuf)) {
+            if (err) {
+                return err;
+            }
+
+            BA_PROFILE_BEGIN(BA_PROFILE_AAC_IMDCT);
+            err = IMDCT(aacDecInfo, ch, baseChan + ch, outbuf);
+            BA_PROFILE_END(BA_PROFILE_AAC_IMDCT);
+
+            if (err) {
                 return ERR_AAC_IMDCT;
             }
-            PROFILE_END();
         }
 
 #ifdef AAC_ENABLE_SBR
@@ -463,12 +468,20 @@ int AACDecode(HAACDecoder hAACDecoder, unsigned char **inbuf, int *bytesLeft, sh
             }
 
             /* parse SBR extension data if present (contained in a fill element) */
-            if (DecodeSBRBitstream(aacDecInfo, baseChanSBR)) {
+            BA_PROFILE_BEGIN(BA_PROFILE_AAC_SBR_BITSTREAM);
+            err = DecodeSBRBitstream(aacDecInfo, baseChanSBR);
+            BA_PROFILE_END(BA_PROFILE_AAC_SBR_BITSTREAM);
+
+            if (err) {
                 return ERR_AAC_SBR_BITSTREAM;
             }
 
             /* apply SBR */
-            if (DecodeSBRData(aacDecInfo, baseChanSBR, outbuf)) {
+            BA_PROFILE_BEGIN(BA_PROFILE_AAC_SBR_DATA);
+            err = DecodeSBRData(aacDecInfo, baseChanSBR, outbuf);
+            BA_PROFILE_END(BA_PROFILE_AAC_SBR_DATA);
+
+            if (err) {
                 return ERR_AAC_SBR_DATA;
             }
 
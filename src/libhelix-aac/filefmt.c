@@ -125,6 +125,11 @@ int UnpackADTSHeader(AACDecInfo *aacDecInfo, unsigned char **buf, int *bitOffset
     }
 #endif
 
+    /* a frame cut off by the end of the data can't be parsed, the element decoders don't bounds check */
+    if (fhADTS->frameLength * 8 > *bitsAvail) {
+        return ERR_AAC_INDATA_UNDERFLOW;
+    }
+
     /* update codec info */
     psi->sampRateIdx = fhADTS->sampRateIdx;
     if (!psi->useImpChanMap) {
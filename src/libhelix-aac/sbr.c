@@ -108,7 +108,7 @@ int InitSBR(AACDecInfo *aacDecInfo) {
     /* allocate SBR state structure */
     psi = (PSInfoSBR *)malloc(sizeof(PSInfoSBR));
     if (!psi) {
-        printf("OOM in SBR, can't allocate %d bytes\n", sizeof(PSInfoSBR));
+        printf("OOM in SBR, can't allocate %u bytes\n", (unsigned int)sizeof(PSInfoSBR));
         return ERR_AAC_SBR_INIT;
     }
     InitSBRState(psi);
@@ -128,7 +128,7 @@ int InitSBRPre(AACDecInfo *aacDecInfo, void **ptr, int *sz) {
     psi = (PSInfoSBR *)*ptr;
     *sz -= sizeof(PSInfoSBR);
     if (*sz < 0) {
-        printf("OOM in SBR, can't allocate %d bytes\n", sizeof(PSInfoSBR));
+        printf("OOM in SBR, can't allocate %u bytes\n", (unsigned int)sizeof(PSInfoSBR));
         return ERR_AAC_SBR_INIT;
     }
     InitSBRState(psi);
@@ -23,6 +23,7 @@
 #pragma GCC diagnostic ignored "-Wstrict-aliasing"
 
 #include <pgmspace.h>
+#include "../BackgroundAudioProfile.h"
 #  include "config.h"
 
 # include "global.h"
@@ -973,7 +974,9 @@ enum mad_error III_huffdecode(struct mad_bitptr *ptr, mad_fixed_t xr[576],
         return MAD_ERROR_BADPART3LEN;
     }
 
+    BA_PROFILE_BEGIN(BA_PROFILE_MP3_EXPONENTS);
     III_exponents(channel, sfbwidth, exponents);
+    BA_PROFILE_END(BA_PROFILE_MP3_EXPONENTS);
 
     peek = *ptr;
     mad_bit_skip(ptr, bits_left);
@@ -2463,7 +2466,9 @@ enum mad_error III_decode(struct mad_bitptr *ptr, struct mad_frame *frame,
                                                 gr == 0 ? 0 : si->scfsi[ch]);
             }
 
+            BA_PROFILE_BEGIN(BA_PROFILE_MP3_HUFFDECODE);
             error = III_huffdecode(ptr, xr[ch], channel, sfbwidth[ch], part2_length);
+            BA_PROFILE_END(BA_PROFILE_MP3_HUFFDECODE);
             if (error) {
                 //        free(xr_raw);
                 return error;
@@ -2474,7 +2479,9 @@ enum mad_error III_decode(struct mad_bitptr *ptr, struct mad_frame *frame,
 
         if (header->mode == MAD_MODE_JOINT_STEREO && header->mode_extension) {
             // (void*) below just to get rid of warning about passing in a * and not a [2][576]
+            BA_PROFILE_BEGIN(BA_PROFILE_MP3_STEREO);
             error = III_stereo((void*)frame->xr_raw, granule, header, sfbwidth[0]);
+            BA_PROFILE_END(BA_PROFILE_MP3_STEREO);
             if (error) {
                 //        free(xr_raw);
                 return error;
@@ -2489,10 +2496,12 @@ enum mad_error III_decode(struct mad_bitptr *ptr, struct mad_frame *frame,
             unsigned int sb, l, i, sblimit;
             mad_fixed_t output[36];
 
+            BA_PROFILE_BEGIN(BA_PROFILE_MP3_IMDCT);
             if (channel->block_type == 2) {
                 error = III_reorder(xr[ch], channel, sfbwidth[ch], frame->tmp);
                 if (error) {
                     //          free(xr_raw);
+                    BA_PROFILE_END(BA_PROFILE_MP3_IMDCT);
                     return error;
                 }
 
@@ -2579,6 +2588,7 @@ enum mad_error III_decode(struct mad_bitptr *ptr, struct mad_frame *frame,
                     III_freqinver(sample, sb);
                 }
             }
+            BA_PROFILE_END(BA_PROFILE_MP3_IMDCT);
         }
     }
 
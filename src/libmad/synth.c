@@ -23,6 +23,7 @@
 
 #include <stddef.h>
 #include <pgmspace.h>
+#include "../BackgroundAudioProfile.h"
 #  include "config.h"
 
 # include "global.h"
@@ -60,6 +61,7 @@ void mad_synth_init(struct mad_synth *synth) {
     synth->pcm.samplerate = 0;
     synth->pcm.channels   = 0;
     synth->pcm.length     = 0;
+    synth->pcm.out        = synth->pcm.samplesX;
 }
 
 /*
@@ -584,7 +586,7 @@ void synth_full(struct mad_synth *synth, struct mad_frame const *frame,
         sbsample = &frame->sbsample[ch];
         filter   = &synth->filter[ch];
         phase    = synth->phase;
-        pcm1     = &synth->pcm.samplesX[0][ch];
+        pcm1     = &synth->pcm.out[0][ch];
 
         for (s = 0; s < ns; ++s) {
             dct32((*sbsample)[s], phase >> 1,
@@ -724,7 +726,7 @@ void synth_half(struct mad_synth *synth, struct mad_frame const *frame,
         sbsample = &frame->sbsample[ch];
         filter   = &synth->filter[ch];
         phase    = synth->phase;
-        pcm1     = &synth->pcm.samplesX[0][ch];
+        pcm1     = &synth->pcm.out[0][ch];
 
         for (s = 0; s < ns; ++s) {
             dct32((*sbsample)[s], phase >> 1,
@@ -871,7 +873,9 @@ void mad_synth_frame(struct mad_synth *synth, struct mad_frame const *frame) {
         synth_frame = synth_half;
     }
 
+    BA_PROFILE_BEGIN(BA_PROFILE_MP3_SYNTH);
     synth_frame(synth, frame, nch, ns);
+    BA_PROFILE_END(BA_PROFILE_MP3_SYNTH);
 
     synth->phase = (synth->phase + ns) % 16;
 }
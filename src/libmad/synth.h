@@ -32,6 +32,7 @@ struct mad_pcm {
     unsigned short length;		/* number of samples per channel */
     //  int16_t samples[2][1152];		/* PCM output samples [ch][sample] */
     int16_t samplesX[1152][2] __attribute__((aligned(4)));		/* PCM output samples [ch][sample] */
+    int16_t (*out)[2];			/* where synthesis writes, samplesX unless redirected */
 };
 
 struct mad_synth {
@@ -0,0 +1,260 @@
+/*
+    BackgroundAudio
+    Host (PC) audio output which plays into a WAV file in simulated time
+
+    Copyright (c) 2025 Earle F. Philhower, III <earlephilhower@yahoo.com>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+#include <Arduino.h>
+#include <AudioOutputBase.h>
+
+/**
+    @brief Audio output which behaves like the Pico's DMA-driven I2S or PWM output, but records to a WAV file
+
+    @details
+    Written samples are queued in `setBuffers` sized buffers.  As simulated time passes (see `host::advance`)
+    one buffer is played out each `bufferWords / frequency` seconds, the same as the DMA would, and the
+    `onTransmit` callback is fired once it is done so the player can refill it.  If no full buffer is ready
+    when one is needed silence is played instead and counted as an underflow.
+
+    Everything played, including silence, is kept in `samples` and written to the WAV file (if any) on `end`.
+*/
+class WAVAudioOutput : public AudioOutputBase, public host::Device {
+public:
+    /**
+        @brief Create an output
+
+        @param [in] path WAV file to write on `end`, or `nullptr` to only keep the samples in memory
+    */
+    WAVAudioOutput(const char *path = nullptr) : _path(path ? path : "") {
+    }
+
+    ~WAVAudioOutput() {
+        end();
+    }
+
+    bool setBuffers(size_t buffers, size_t bufferWords, int32_t silenceSample = 0) override {
+        if (_running) {
+            return false;
+        }
+        _buffers = buffers;
+        _bufferWords = bufferWords;
+        _silence = silenceSample;
+        return true;
+    }
+
+    bool setBitsPerSample(int bps) override {
+        return bps == 16;
+    }
+
+    bool setFrequency(int freq) override {
+        if (freq <= 0) {
+            return false;
+        }
+        if (!_running || _samples.empty()) {
+            _freq = freq;
+        } else if (freq != _freq) {
+            _freq = freq; // Takes effect with the next buffer, the WAV header can only have one so keep the last
+            _rateChanges++;
+        }
+        return true;
+    }
+
+    bool setStereo(bool stereo = true) override {
+        return stereo; // Only stereo like the Pico outputs
+    }
+
+    bool begin() override {
+        if (_running) {
+            return false;
+        }
+        _fifo.clear();
+        _samples.clear();
+        _next = host::now;
+        _running = true;
+        host::addDevice(this);
+        return true;
+    }
+
+    bool end() override {
+        if (!_running) {
+            return false;
+        }
+        _running = false;
+        host::removeDevice(this);
+        if (_path.length()) {
+            writeWAV(_path.c_str());
+        }
+        return true;
+    }
+
+    bool getUnderflow() override {
+        bool ret = _underflowFlag;
+        _underflowFlag = false;
+        return ret;
+    }
+
+    void onTransmit(void (*cb)(void *), void *cbData) override {
+        _cb = cb;
+        _cbData = cbData;
+    }
+
+    size_t write(const uint8_t *buffer, size_t size) override {
+        size_t words = std::min(size / 4, (size_t)availableForWrite() / 4);
+        const int16_t *s = (const int16_t *)buffer;
+        _fifo.insert(_fifo.end(), s, s + words * 2);
+        return words * 4;
+    }
+
+    int availableForWrite() override {
+        return (int)((_buffers * _bufferWords - _fifo.size() / 2) * 4);
+    }
+
+    /**
+        @brief Play out every buffer due by simulated time `now`
+    */
+    void advanceTo(uint64_t now) override {
+        while (_running && (_next <= now)) {
+            size_t n = _bufferWords * 2;
+            if (_fifo.size() >= n) {
+                _samples.insert(_samples.end(), _fifo.begin(), _fifo.begin() + n);
+                _fifo.erase(_fifo.begin(), _fifo.begin() + n);
+            } else {
+                _samples.insert(_samples.end(), n, (int16_t)_silence);
+                _underflows++;
+                _underflowFlag = true;
+            }
+            _next += (uint64_t)_bufferWords * 1000000 / _freq;
+            _buffersPlayed++;
+            if (_cb) {
+                // Like the DMA interrupt, nothing else runs until the callback returns
+                host::irqDepth++;
+                _cb(_cbData);
+                host::irqDepth--;
+                host::runPendingIRQs();
+            }
+        }
+    }
+
+    /**
+        @brief Write everything played so far as a 16-bit stereo WAV file
+
+        @return True on success
+    */
+    bool writeWAV(const char *path) {
+        return writeWAV(path, _samples, _freq);
+    }
+
+    /**
+        @brief Write any 16-bit stereo samples as a WAV file, i.e. ones from a player's `render`
+
+        @return True on success
+    */
+    static bool writeWAV(const char *path, const std::vector<int16_t> &samples, int freq) {
+        FILE *f = fopen(path, "wb");
+        if (!f) {
+            return false;
+        }
+        uint32_t dataLen = samples.size() * 2;
+        uint8_t hdr[44];
+        memcpy(hdr, "RIFF", 4);
+        put32(hdr + 4, 36 + dataLen);
+        memcpy(hdr + 8, "WAVEfmt ", 8);
+        put32(hdr + 16, 16);
+        put16(hdr + 20, 1); // PCM
+        put16(hdr + 22, 2); // Stereo
+        put32(hdr + 24, freq);
+        put32(hdr + 28, freq * 4);
+        put16(hdr + 32, 4);
+        put16(hdr + 34, 16);
+        memcpy(hdr + 36, "data", 4);
+        put32(hdr + 40, dataLen);
+        bool ok = fwrite(hdr, sizeof(hdr), 1, f) == 1;
+        ok &= fwrite(samples.data(), 2, samples.size(), f) == samples.size();
+        ok &= !fclose(f);
+        return ok;
+    }
+
+    /**
+        @brief Get every sample played so far, interleaved left and right
+    */
+    const std::vector<int16_t> &samples() const {
+        return _samples;
+    }
+
+    /**
+        @brief Get the WAV file written on `end`, empty for none
+    */
+    const char *path() const {
+        return _path.c_str();
+    }
+
+    /**
+        @brief Get the current output sample rate
+    */
+    int frequency() const {
+        return _freq;
+    }
+
+    /**
+        @brief Get the number of buffers played out so far, including silence
+    */
+    uint32_t buffersPlayed() const {
+        return _buffersPlayed;
+    }
+
+    /**
+        @brief Get the number of buffers which had to be silence because no data was ready
+    */
+    uint32_t underflows() const {
+        return _underflows;
+    }
+
+    /**
+        @brief Get the number of times the sample rate changed after samples were played
+    */
+    uint32_t rateChanges() const {
+        return _rateChanges;
+    }
+
+private:
+    static void put16(uint8_t *p, uint16_t v) {
+        p[0] = v & 0xff;
+        p[1] = v >> 8;
+    }
+
+    static void put32(uint8_t *p, uint32_t v) {
+        put16(p, v & 0xffff);
+        put16(p + 2, v >> 16);
+    }
+
+    std::string _path;
+    bool _running = false;
+    size_t _buffers = 8;
+    size_t _bufferWords = 16;
+    int32_t _silence = 0;
+    int _freq = 44100;
+    void (*_cb)(void *) = nullptr;
+    void *_cbData = nullptr;
+    std::vector<int16_t> _fifo;       // Written but not yet played, interleaved
+    std::vector<int16_t> _samples;    // Everything played
+    uint64_t _next = 0;               // Simulated time the next buffer is needed
+    uint32_t _buffersPlayed = 0;
+    uint32_t _underflows = 0;
+    uint32_t _rateChanges = 0;
+    bool _underflowFlag = false;
+};
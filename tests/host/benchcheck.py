@@ -0,0 +1,76 @@
+#!/usr/bin/env python3
+# benchcheck.py - Earle F. Philhower, III <earlephilhower@yahoo.com>
+# Released to the public domain 2025
+#
+# Compares a StageBench JSON result (from tests/host/stagebench or captured from SpeedTest's serial
+# output on a device) against a saved baseline, and fails if any case or any significant stage got
+# more than --threshold percent more expensive per sample.
+#
+#     benchcheck.py baseline.json result.json [--threshold 10] [--min-share 2]
+#
+# To accept a new baseline, just copy the result over it.
+
+import argparse
+import json
+import sys
+
+
+def load(path):
+    with open(path) as f:
+        text = f.read()
+    # Serial captures may have other output around the JSON, so only keep the outermost object
+    return json.loads(text[text.index("{"):text.rindex("}") + 1])
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Check a StageBench result against a baseline")
+    parser.add_argument("baseline")
+    parser.add_argument("result")
+    parser.add_argument("--threshold", type=float, default=10.0,
+                        help="Percent slowdown in cycles/sample that counts as a regression")
+    parser.add_argument("--min-share", type=float, default=2.0,
+                        help="Ignore stages under this percent of their case's cycles, they're too noisy")
+    args = parser.parse_args()
+
+    base = load(args.baseline)
+    res = load(args.result)
+    if base.get("clock") != res.get("clock"):
+        print("ERROR: Baseline clock '%s' doesn't match result clock '%s'" % (base.get("clock"), res.get("clock")))
+        return 1
+
+    failed = []
+
+    def check(label, name, old, new):
+        change = (new - old) * 100.0 / old if old else 0.0
+        bad = change > args.threshold
+        print("%-36s %10.2f %10.2f %+7.1f%%%s" % (label, old, new, change, "  REGRESSION" if bad else ""))
+        if bad:
+            failed.append(name)
+
+    print("%-36s %10s %10s %8s" % ("cycles/sample", "baseline", "result", "change"))
+    for case, b in base["cases"].items():
+        r = res["cases"].get(case)
+        if r is None:
+            print("%-36s missing from result" % case)
+            failed.append(case)
+            continue
+        check(case, case, b["cycles_per_sample"], r["cycles_per_sample"])
+        for stage, bs in b.get("stages", {}).items():
+            if bs["cycles"] * 100.0 < b["cycles"] * args.min_share:
+                continue
+            rs = r.get("stages", {}).get(stage)
+            if rs is None:
+                print("%-36s missing from result" % ("  " + stage))
+                failed.append(case + "/" + stage)
+                continue
+            check("  " + stage, case + "/" + stage, bs["cycles_per_sample"], rs["cycles_per_sample"])
+
+    if failed:
+        print("FAILED: %d regression(s) over %.1f%%: %s" % (len(failed), args.threshold, ", ".join(failed)))
+        return 1
+    print("PASSED")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
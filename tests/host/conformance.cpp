@@ -0,0 +1,587 @@
+// conformance - Earle F. Philhower, III <earlephilhower@yahoo.com>
+// Released to the public domain 2025
+//
+// Decodes a corpus of MP3, AAC-LC, HE-AAC, and WAV vectors through the players and checks the PCM is
+// bit-for-bit what it was when the golden hashes were recorded, so fixed-point kernel optimizations
+// (libmad's synth and FPM modes, the Helix assembly.h helpers, SBR math) can't silently change the output.
+// Each vector is decoded from ROM, streamed through the normal RAM buffered player, rendered offline with
+// `render`, and decoded from ROM again straight into the output's buffers (the zero-copy path mixer legs
+// use), which must all match each other as well.  AAC is also rendered as its data trickles into RAM, which
+// must only differ by the silence played for a cut off last frame.
+//
+//     conformance [--update] [--golden golden.txt] [--dump dir] [--reference dir]
+//                 [--max-rms lsb] [--max-peak lsb] [extra.mp3|.aac|.wav ...]
+//
+// --update rewrites the golden file from the current output, for when a change is *meant* to alter it.
+//
+// Tolerance mode (--reference) compares against a floating-point decode instead, for changes which are
+// expected to lose a little precision.  `--dump dir` writes each vector's input and decoded output to dir,
+// then a float reference from any other decoder can be saved alongside as <name>.ref.wav, i.e.
+//     ffmpeg -i dir/mp3.mp3 -c:a pcm_f32le dir/mp3.ref.wav
+// The reference is aligned to the output (decoders differ in their delay) and the RMS and peak error and
+// SNR are reported, failing if over --max-rms or --max-peak (in 16-bit LSBs).  The synthesized WAV vectors
+// always carry their own exact reference.
+
+#include <Arduino.h>
+#include <AudioOutputBase.h>
+#include <map>
+#include <BackgroundAudio.h>
+#include <__example_beepwav.h>
+#include <__example_pianoaac.h>
+#include "../../examples/SpeedTest/aac.h"
+#include "../../examples/SpeedTest/aache.h"
+#include "../../examples/SpeedTest/mp3.h"
+
+// Keeps everything the player sends, accepting one block each time it's pumped as a DMA callback would.
+// Passed as a plain AudioOutputBase the player copies into it with `write`.  Otherwise the player renders
+// in place when a whole frame fits in the rest of the current block, as with a mixer leg's buffers.
+class CaptureOutput : public ZeroCopyAudioOutputBase {
+public:
+    bool setBuffers(size_t buffers, size_t bufferWords, int32_t silenceSample = 0) override {
+        (void) buffers;
+        (void) silenceSample;
+        _blockBytes = bufferWords * 4;
+        _block.resize(bufferWords * 2);
+        return true;
+    }
+    bool setBitsPerSample(int bps) override {
+        return bps == 16;
+    }
+    bool setFrequency(int freq) override {
+        frequency = freq;
+        return true;
+    }
+    bool setStereo(bool stereo = true) override {
+        return stereo;
+    }
+    bool begin() override {
+        return true;
+    }
+    bool end() override {
+        return true;
+    }
+    bool getUnderflow() override {
+        return false;
+    }
+    void onTransmit(void (*cb)(void *), void *cbData) override {
+        _cb = cb;
+        _cbData = cbData;
+    }
+    size_t write(const uint8_t *buffer, size_t size) override {
+        size = std::min(size, _avail) & ~3;
+        const int16_t *s = (const int16_t *)buffer;
+        samples.insert(samples.end(), s, s + size / 2);
+        _avail -= size;
+        _fill = (_fill + size) % _blockBytes;
+        copied += size / 4;
+        return size;
+    }
+    int availableForWrite() override {
+        return _avail;
+    }
+    uint32_t *acquireWriteBuffer(size_t *words) override {
+        *words = std::min(_avail, _blockBytes - _fill) / 4;
+        return *words ? (uint32_t *)_block.data() : nullptr;
+    }
+    void commitWriteBuffer(size_t words) override {
+        samples.insert(samples.end(), _block.begin(), _block.begin() + words * 2);
+        _avail -= words * 4;
+        _fill = (_fill + words * 4) % _blockBytes;
+        inPlace += words;
+    }
+
+    void pump() {
+        _avail = _blockBytes;
+        _cb(_cbData);
+    }
+
+    std::vector<int16_t> samples; // Interleaved stereo
+    int frequency = 0;
+    size_t copied = 0;            // Stereo samples sent with `write`
+    size_t inPlace = 0;           // Stereo samples rendered in place
+
+private:
+    size_t _blockBytes = 4;
+    size_t _avail = 0;
+    size_t _fill = 0;             // Bytes already in the current block
+    std::vector<int16_t> _block;  // Stands in for the current block's memory
+    void (*_cb)(void *) = nullptr;
+    void *_cbData = nullptr;
+};
+
+typedef enum { MP3, AAC, WAV } Format;
+
+typedef struct {
+    std::string name;
+    Format format;
+    std::vector<uint8_t> data;
+    std::vector<double> ref;    // Exact expected output in 16-bit LSBs, interleaved stereo, if known
+    double maxPeak;             // Allowed error against ref
+} Vector;
+
+typedef struct {
+    std::vector<int16_t> samples;
+    int frequency = 0;
+    size_t inPlace = 0;
+} Decoded;
+
+static const size_t maxBlocks = 100000;
+
+template<class Player>
+static Decoded decodeROM(const Vector &v, bool zeroCopy = false) {
+    CaptureOutput out;
+    Player p;
+    if (zeroCopy) {
+        p.setDevice(&out);
+    } else {
+        p.setDevice((AudioOutputBase *)&out);
+    }
+    p.write(v.data.data(), v.data.size());
+    p.begin();
+    for (size_t i = 0; !p.done() && (i < maxBlocks); i++) {
+        out.pump();
+    }
+    p.end();
+    return { out.samples, out.frequency, out.inPlace };
+}
+
+// Topped up before every block, as a sketch's loop() would, so the decoder never runs short mid-stream
+template<class Player>
+static Decoded decodeStream(const Vector &v) {
+    CaptureOutput out;
+    Player p((AudioOutputBase &)out);
+    p.begin();
+    size_t pos = 0;
+    for (size_t i = 0; (pos < v.data.size() || !p.done()) && (i < maxBlocks); i++) {
+        pos += p.write(v.data.data() + pos, std::min(v.data.size() - pos, p.availableForWrite()));
+        out.pump();
+    }
+    p.end();
+    return { out.samples, out.frequency };
+}
+
+// Offline, with no output at all, in blocks which don't line up with the frames
+template<class Player>
+static Decoded decodeRender(const Vector &v) {
+    Decoded d;
+    Player p;
+    p.write(v.data.data(), v.data.size());
+    int16_t block[1000 * 2];
+    size_t n;
+    do {
+        n = p.render(block, 1000);
+        d.samples.insert(d.samples.end(), block, block + n * 2);
+    } while ((n == 1000) && (d.samples.size() < maxBlocks * 4096));
+    d.frequency = p.sampleRate();
+    return d;
+}
+
+// Rendered as the data trickles in a few hundred bytes at a time, so frames are often only partly written.
+// The AAC player waits for the rest of a frame rather than skipping it.
+template<class Player>
+static Decoded decodeTrickle(const Vector &v) {
+    Decoded d;
+    Player p;
+    int16_t block[1000 * 2];
+    size_t pos = 0, n;
+    for (size_t i = 0; (pos < v.data.size()) && (i < maxBlocks); i++) {
+        pos += p.write(v.data.data() + pos, std::min(v.data.size() - pos, std::min((size_t)300, p.availableForWrite())));
+        n = p.render(block, 1000);
+        d.samples.insert(d.samples.end(), block, block + n * 2);
+    }
+    do {
+        n = p.render(block, 1000);
+        d.samples.insert(d.samples.end(), block, block + n * 2);
+    } while ((n == 1000) && (d.samples.size() < maxBlocks * 4096));
+    d.frequency = p.sampleRate();
+    return d;
+}
+
+// The same, except for silence the other plays at the end for a last frame which was cut off
+static bool sameUntilCutOff(const std::vector<int16_t> &s, const std::vector<int16_t> &other) {
+    return (s.size() <= other.size()) && std::equal(s.begin(), s.end(), other.begin()) &&
+           std::all_of(other.begin() + s.size(), other.end(), [](int16_t x) {
+        return x == 0;
+    });
+}
+
+static void decode(const Vector &v, Decoded *rom, Decoded *stream, Decoded *render, Decoded *zc) {
+    switch (v.format) {
+    case MP3:
+        *rom = decodeROM<ROMBackgroundAudioMP3>(v);
+        *stream = decodeStream<BackgroundAudioMP3>(v);
+        *render = decodeRender<ROMBackgroundAudioMP3>(v);
+        *zc = decodeROM<ROMBackgroundAudioMP3>(v, true);
+        break;
+    case AAC:
+        *rom = decodeROM<ROMBackgroundAudioAAC>(v);
+        *stream = decodeStream<BackgroundAudioAAC>(v);
+        *render = decodeRender<ROMBackgroundAudioAAC>(v);
+        *zc = decodeROM<ROMBackgroundAudioAAC>(v, true);
+        break;
+    case WAV:
+        *rom = decodeROM<ROMBackgroundAudioWAV>(v);
+        *stream = decodeStream<BackgroundAudioWAV>(v);
+        *render = decodeRender<ROMBackgroundAudioWAV>(v);
+        *zc = decodeROM<ROMBackgroundAudioWAV>(v, true);
+        break;
+    }
+}
+
+// FNV-1a over the little-endian samples
+static uint64_t hash(const std::vector<int16_t> &s) {
+    uint64_t h = 0xcbf29ce484222325ull;
+    for (auto x : s) {
+        h = (h ^ (uint8_t)x) * 0x100000001b3ull;
+        h = (h ^ (uint8_t)(x >> 8)) * 0x100000001b3ull;
+    }
+    return h;
+}
+
+static void put16(std::vector<uint8_t> &b, uint16_t x) {
+    b.push_back(x & 0xff);
+    b.push_back(x >> 8);
+}
+
+static void put32(std::vector<uint8_t> &b, uint32_t x) {
+    put16(b, x & 0xffff);
+    put16(b, x >> 16);
+}
+
+static std::vector<uint8_t> wavHeader(int rate, int channels, int bps, size_t dataBytes) {
+    std::vector<uint8_t> b;
+    b.insert(b.end(), { 'R', 'I', 'F', 'F' });
+    put32(b, 36 + dataBytes);
+    b.insert(b.end(), { 'W', 'A', 'V', 'E', 'f', 'm', 't', ' ' });
+    put32(b, 16);
+    put16(b, 1);
+    put16(b, channels);
+    put32(b, rate);
+    put32(b, rate * channels * bps / 8);
+    put16(b, channels * bps / 8);
+    put16(b, bps);
+    b.insert(b.end(), { 'd', 'a', 't', 'a' });
+    put32(b, dataBytes);
+    return b;
+}
+
+// Two tones per channel, quantized to the requested format.  The reference is the exact 16-bit
+// expansion the player should produce: 8-bit samples shifted up and mono copied to both channels.
+static Vector synthWAV(const char *name, int rate, int channels, int bps) {
+    Vector v = { name, WAV, {}, {}, 0 };
+    size_t n = rate / 2;
+    std::vector<uint8_t> pcm;
+    for (size_t i = 0; i < n; i++) {
+        double t = (double)i / rate;
+        double ch[2] = { 0.5 * sin(2 * M_PI * 440 * t) + 0.3 * sin(2 * M_PI * 3100 * t),
+                         0.4 * sin(2 * M_PI * 660 * t) - 0.4 * sin(2 * M_PI * 1250 * t)
+                       };
+        for (int c = 0; c < channels; c++) {
+            if (bps == 8) {
+                int s = std::min(127, (int)lrint(ch[c] * 128));
+                pcm.push_back(s + 128);
+                v.ref.push_back(s * 256);
+                if (channels == 1) {
+                    v.ref.push_back(s * 256);
+                }
+            } else {
+                int s = std::min(32767, (int)lrint(ch[c] * 32768));
+                put16(pcm, s);
+                v.ref.push_back(s);
+                if (channels == 1) {
+                    v.ref.push_back(s);
+                }
+            }
+        }
+    }
+    v.data = wavHeader(rate, channels, bps, pcm.size());
+    v.data.insert(v.data.end(), pcm.begin(), pcm.end());
+    return v;
+}
+
+static bool readFile(const std::string &path, std::vector<uint8_t> *data) {
+    FILE *f = fopen(path.c_str(), "rb");
+    if (!f) {
+        return false;
+    }
+    uint8_t buff[4096];
+    size_t n;
+    while ((n = fread(buff, 1, sizeof(buff), f)) > 0) {
+        data->insert(data->end(), buff, buff + n);
+    }
+    fclose(f);
+    return true;
+}
+
+static bool writeFile(const std::string &path, const std::vector<uint8_t> &data) {
+    FILE *f = fopen(path.c_str(), "wb");
+    if (!f) {
+        fprintf(stderr, "ERROR: Unable to write '%s'\n", path.c_str());
+        return false;
+    }
+    bool ok = fwrite(data.data(), 1, data.size(), f) == data.size();
+    return !fclose(f) && ok;
+}
+
+static uint32_t get16(const uint8_t *p) {
+    return p[0] | (p[1] << 8);
+}
+
+static uint32_t get32(const uint8_t *p) {
+    return get16(p) | (get16(p + 2) << 16);
+}
+
+// Load a PCM (16, 24, or 32-bit) or IEEE float (32 or 64-bit) WAV as interleaved stereo in 16-bit LSBs
+static bool readReference(const std::string &path, std::vector<double> *ref, int *rate) {
+    std::vector<uint8_t> d;
+    if (!readFile(path, &d) || (d.size() < 12) || memcmp(d.data(), "RIFF", 4) || memcmp(d.data() + 8, "WAVE", 4)) {
+        return false;
+    }
+    int format = 0, channels = 0, bps = 0;
+    for (size_t p = 12; p + 8 <= d.size();) {
+        uint32_t len = std::min((size_t)get32(&d[p + 4]), d.size() - p - 8);
+        const uint8_t *c = &d[p + 8];
+        if (!memcmp(&d[p], "fmt ", 4) && (len >= 16)) {
+            format = get16(c);
+            channels = get16(c + 2);
+            *rate = get32(c + 4);
+            bps = get16(c + 14);
+            if ((format == 0xfffe) && (len >= 26)) {
+                format = get16(c + 24); // WAVE_FORMAT_EXTENSIBLE subformat
+            }
+        } else if (!memcmp(&d[p], "data", 4) && channels && bps) {
+            int bytes = bps / 8;
+            for (size_t i = 0; i + channels * bytes <= len; i += channels * bytes) {
+                double s[2];
+                for (int ch = 0; ch < std::min(channels, 2); ch++) {
+                    const uint8_t *x = c + i + ch * bytes;
+                    if ((format == 3) && (bps == 32)) {
+                        float f;
+                        memcpy(&f, x, 4);
+                        s[ch] = f * 32768.0;
+                    } else if ((format == 3) && (bps == 64)) {
+                        double f;
+                        memcpy(&f, x, 8);
+                        s[ch] = f * 32768.0;
+                    } else if ((format == 1) && (bps == 16)) {
+                        s[ch] = (int16_t)get16(x);
+                    } else if ((format == 1) && (bps == 24)) {
+                        s[ch] = (int32_t)((x[0] << 8) | (x[1] << 16) | ((uint32_t)x[2] << 24)) / 65536.0;
+                    } else if ((format == 1) && (bps == 32)) {
+                        s[ch] = (int32_t)get32(x) / 65536.0;
+                    } else {
+                        return false;
+                    }
+                }
+                ref->push_back(s[0]);
+                ref->push_back(channels == 1 ? s[0] : s[1]);
+            }
+            return true;
+        }
+        p += 8 + len + (len & 1);
+    }
+    return false;
+}
+
+typedef struct {
+    long offset;    // Output sample matching the first reference sample
+    size_t compared;
+    double rms;
+    double peak;
+    double snr;
+} Tolerance;
+
+static Tolerance compare(const std::vector<int16_t> &out, const std::vector<double> &ref) {
+    long outLen = out.size() / 2, refLen = ref.size() / 2;
+    // Find the delay between the two on a window from the reference, by least squared error
+    long win = std::min(4096L, refLen);
+    long w0 = std::max(0L, std::min(refLen / 4, refLen - win));
+    long maxLag = std::min(4096L, std::max(outLen, refLen));
+    Tolerance t = {};
+    double best = -1;
+    for (long i = 0; i <= 2 * maxLag; i++) {
+        long lag = (i & 1) ? -(i + 1) / 2 : i / 2; // Outwards from 0, so a periodic signal keeps the smallest delay
+        if ((w0 + lag < 0) || (w0 + win + lag > outLen)) {
+            continue;
+        }
+        double e = 0;
+        for (long j = w0; (j < w0 + win) && ((best < 0) || (e < best)); j++) {
+            double l = out[(j + lag) * 2] - ref[j * 2], r = out[(j + lag) * 2 + 1] - ref[j * 2 + 1];
+            e += l * l + r * r;
+        }
+        if ((best < 0) || (e < best)) {
+            best = e;
+            t.offset = lag;
+        }
+    }
+    double err = 0, sig = 0;
+    for (long i = std::max(0L, -t.offset); (i < refLen) && (i + t.offset < outLen); i++) {
+        for (int c = 0; c < 2; c++) {
+            double e = out[(i + t.offset) * 2 + c] - ref[i * 2 + c];
+            err += e * e;
+            sig += ref[i * 2 + c] * ref[i * 2 + c];
+            t.peak = std::max(t.peak, fabs(e));
+        }
+        t.compared++;
+    }
+    t.rms = t.compared ? sqrt(err / (t.compared * 2)) : 0;
+    t.snr = err > 0 ? 10 * log10(sig / err) : INFINITY;
+    return t;
+}
+
+static std::string extension(Format f) {
+    return f == MP3 ? ".mp3" : f == AAC ? ".aac" : ".wav";
+}
+
+static void usage() {
+    fprintf(stderr, "Usage: conformance [--update] [--golden golden.txt] [--dump dir] [--reference dir]\n"
+            "                   [--max-rms lsb] [--max-peak lsb] [extra.mp3|.aac|.wav ...]\n");
+    exit(1);
+}
+
+int main(int argc, char **argv) {
+    std::string golden = "golden.txt", dumpDir, refDir;
+    bool update = false;
+    double maxRMS = -1, maxPeak = -1;
+    std::vector<Vector> vectors = {
+        { "mp3", MP3, std::vector<uint8_t>(mp3, mp3 + sizeof(mp3)), {}, 0 },
+        { "aac", AAC, std::vector<uint8_t>(aac, aac + sizeof(aac)), {}, 0 },
+        { "he-aac", AAC, std::vector<uint8_t>(aache, aache + sizeof(aache)), {}, 0 },
+        { "piano-aac", AAC, std::vector<uint8_t>(piano_aac, piano_aac + sizeof(piano_aac)), {}, 0 },
+        { "beep-wav", WAV, std::vector<uint8_t>(beepwav, beepwav + sizeof(beepwav)), {}, 0 },
+        synthWAV("wav-8bit-mono", 8000, 1, 8),
+        synthWAV("wav-8bit-stereo", 11025, 2, 8),
+        synthWAV("wav-16bit-mono", 22050, 1, 16),
+        synthWAV("wav-16bit-stereo", 48000, 2, 16)
+    };
+    for (int i = 1; i < argc; i++) {
+        std::string a = argv[i];
+        bool more = i + 1 < argc;
+        if (a == "--update") {
+            update = true;
+        } else if ((a == "--golden") && more) {
+            golden = argv[++i];
+        } else if ((a == "--dump") && more) {
+            dumpDir = argv[++i];
+        } else if ((a == "--reference") && more) {
+            refDir = argv[++i];
+        } else if ((a == "--max-rms") && more) {
+            maxRMS = atof(argv[++i]);
+        } else if ((a == "--max-peak") && more) {
+            maxPeak = atof(argv[++i]);
+        } else if ((a.size() > 4) && (a[0] != '-')) {
+            std::string ext = a.substr(a.size() - 4);
+            Vector v = { a.substr(a.find_last_of('/') + 1), ext == ".mp3" ? MP3 : ext == ".aac" ? AAC : WAV, {}, {}, 0 };
+            v.name = v.name.substr(0, v.name.size() - 4);
+            if (((ext != ".mp3") && (ext != ".aac") && (ext != ".wav")) || !readFile(a, &v.data)) {
+                fprintf(stderr, "ERROR: Unable to read '%s' as MP3, AAC, or WAV\n", a.c_str());
+                return 1;
+            }
+            vectors.push_back(v);
+        } else {
+            usage();
+        }
+    }
+
+    // name -> "hash samples frequency"
+    std::map<std::string, std::string> expect;
+    FILE *f = fopen(golden.c_str(), "r");
+    if (f) {
+        char name[128], rest[128];
+        while (fscanf(f, " %127s %127[^\n]", name, rest) == 2) {
+            if (name[0] != '#') {
+                expect[name] = rest;
+            }
+        }
+        fclose(f);
+    } else if (!update) {
+        fprintf(stderr, "ERROR: Unable to read golden hashes from '%s', use --update to create it\n", golden.c_str());
+        return 1;
+    }
+
+    int failed = 0;
+    std::string newGolden = "# conformance golden output: name FNV-1a-64 stereo-samples frequency\n";
+    for (auto &v : vectors) {
+        Decoded rom, stream, render, zc, trickle;
+        decode(v, &rom, &stream, &render, &zc);
+        if (v.format == AAC) {
+            trickle = decodeTrickle<BackgroundAudioAAC>(v);
+        }
+        char result[128];
+        snprintf(result, sizeof(result), "%016llx %zu %d", (unsigned long long)hash(rom.samples), rom.samples.size() / 2, rom.frequency);
+        newGolden += v.name + " " + result + "\n";
+        printf("%-18s %s", v.name.c_str(), result);
+
+        if (stream.samples != rom.samples) {
+            printf("  FAIL: streamed decode differs (%016llx %zu)", (unsigned long long)hash(stream.samples), stream.samples.size() / 2);
+            failed++;
+        } else if ((render.samples != rom.samples) || (render.frequency != rom.frequency)) {
+            printf("  FAIL: rendered decode differs (%016llx %zu %d)", (unsigned long long)hash(render.samples), render.samples.size() / 2,
+                   render.frequency);
+            failed++;
+        } else if (zc.samples != rom.samples) {
+            printf("  FAIL: zero-copy decode differs (%016llx %zu)", (unsigned long long)hash(zc.samples), zc.samples.size() / 2);
+            failed++;
+        } else if ((v.format == AAC) && !sameUntilCutOff(trickle.samples, rom.samples)) {
+            printf("  FAIL: trickled decode differs (%016llx %zu)", (unsigned long long)hash(trickle.samples), trickle.samples.size() / 2);
+            failed++;
+        } else if (update) {
+            printf("  updated");
+        } else if (!expect.count(v.name)) {
+            printf("  FAIL: not in %s", golden.c_str());
+            failed++;
+        } else if (expect[v.name] != result) {
+            printf("  FAIL: expected %s", expect[v.name].c_str());
+            failed++;
+        } else {
+            printf("  OK, %d%% in place", (int)(zc.inPlace * 100 / std::max((size_t)1, zc.samples.size() / 2)));
+        }
+        printf("\n");
+
+        if (!dumpDir.empty()) {
+            std::vector<uint8_t> wav = wavHeader(rom.frequency, 2, 16, rom.samples.size() * 2);
+            wav.insert(wav.end(), (const uint8_t *)rom.samples.data(), (const uint8_t *)(rom.samples.data() + rom.samples.size()));
+            if (!writeFile(dumpDir + "/" + v.name + extension(v.format), v.data) || !writeFile(dumpDir + "/" + v.name + ".out.wav", wav)) {
+                return 1;
+            }
+        }
+
+        // Tolerance against the built in or a floating point reference
+        std::vector<double> ref = v.ref;
+        int refRate = rom.frequency;
+        double peakLimit = v.ref.empty() ? maxPeak : v.maxPeak + 0.5;
+        double rmsLimit = v.ref.empty() ? maxRMS : -1;
+        if (ref.empty() && !refDir.empty() && !readReference(refDir + "/" + v.name + ".ref.wav", &ref, &refRate)) {
+            printf("%-18s no reference %s/%s.ref.wav\n", "", refDir.c_str(), v.name.c_str());
+        }
+        if (ref.empty()) {
+            continue;
+        }
+        if (refRate != rom.frequency) {
+            printf("%-18s FAIL: reference is %dHz, output is %dHz\n", "", refRate, rom.frequency);
+            failed++;
+            continue;
+        }
+        Tolerance t = compare(rom.samples, ref);
+        printf("%-18s offset %ld, %zu samples, RMS error %.3f LSB, peak %.1f LSB, SNR %.1f dB", "", t.offset, t.compared, t.rms, t.peak, t.snr);
+        if (((rmsLimit >= 0) && (t.rms > rmsLimit)) || ((peakLimit >= 0) && (t.peak > peakLimit))) {
+            printf("  FAIL: over tolerance\n");
+            failed++;
+        } else {
+            printf("\n");
+        }
+    }
+
+    if (update) {
+        if (!writeFile(golden, std::vector<uint8_t>(newGolden.begin(), newGolden.end()))) {
+            return 1;
+        }
+        printf("Wrote %s\n", golden.c_str());
+    }
+    if (failed) {
+        printf("FAILED: %d check(s)\n", failed);
+        return 1;
+    }
+    printf("PASSED\n");
+    return 0;
+}
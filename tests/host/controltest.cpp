@@ -0,0 +1,304 @@
+// controltest - Earle F. Philhower, III <earlephilhower@yahoo.com>
+// Released to the public domain 2025
+//
+// Checks the control commands (src/BackgroundAudioCommand.h) the players apply between frames: data
+// written right after a `flush` is played in full, a `flush` in an interrupt or with the work IRQ masked gives
+// up instead of hanging, `pause` fades out to silence and `unpause` picks up where it left off without losing
+// any audio, gain changes ramp instead of stepping, and more commands than the queue holds don't hang.  A pipeline decoding from `loop`, as from loop1() on the RP2040, takes
+// commands given there right away instead of hanging, and isn't done while paused.  The ROM players seek
+// back and forth, restarting exactly and picking up mid-file, and the RAM ones refuse to.
+//
+//     controltest
+
+#include <Arduino.h>
+#include "WAVAudioOutput.h"
+#include <BackgroundAudio.h>
+#include "../../examples/SpeedTest/aac.h"
+#include "../../examples/SpeedTest/mp3.h"
+
+static int failed = 0;
+
+static void check(bool ok, const char *what) {
+    printf("%-60s %s\n", what, ok ? "OK" : "FAIL");
+    failed += ok ? 0 : 1;
+}
+
+// What a decoder produces for the data on its own, to find in what was played
+template<class Player = ROMBackgroundAudioAAC>
+static std::vector<int16_t> rendered(const uint8_t *data, size_t len, float gain = 1.0) {
+    Player p;
+    p.setGain(gain);
+    p.write(data, len);
+    std::vector<int16_t> s;
+    int16_t block[1024 * 2];
+    size_t n;
+    while ((n = p.render(block, 1024)) > 0) {
+        s.insert(s.end(), block, block + n * 2);
+    }
+    return s;
+}
+
+static bool contains(const std::vector<int16_t> &played, const std::vector<int16_t> &want) {
+    return !want.empty() && (std::search(played.begin(), played.end(), want.begin(), want.end()) != played.end());
+}
+
+static void play(ROMBackgroundAudioAAC &p) {
+    for (int i = 0; (i < 60000) && !p.done(); i++) {
+        delay(1);
+    }
+    delay(500); // Let the last buffers drain
+}
+
+static void testFlush() {
+    WAVAudioOutput out;
+    ROMBackgroundAudioAAC p(out);
+    p.write(aac, sizeof(aac));
+    p.begin();
+    delay(300);
+    p.flush();
+    p.write(aac, sizeof(aac));
+    play(p);
+    p.end();
+    // The decoder isn't reset, so the first frame after the flush overlaps the last one before it
+    std::vector<int16_t> want = rendered(aac, sizeof(aac));
+    std::vector<int16_t> rest(want.begin() + 2048 * 2, want.end());
+    check(contains(out.samples(), rest), "stream written right after flush played in full");
+    check(out.samples().size() < want.size() + 2 * 44100 * 2, "flushed stream cut short"); // Not 2x as long
+}
+
+static ROMBackgroundAudioAAC *irqPlayer;
+static bool irqFlushed;
+
+static void flushIRQ() {
+    irqFlushed = irqPlayer->flush();
+}
+
+static void testFlushBlocked() {
+    WAVAudioOutput out;
+    ROMBackgroundAudioAAC p(out);
+    p.write(aac, sizeof(aac));
+    p.begin();
+    delay(300);
+
+    // The pump can't preempt an interrupt, so waiting in one would never end
+    uint irq = user_irq_claim_unused(true);
+    irq_set_exclusive_handler(irq, flushIRQ);
+    irq_set_enabled(irq, true);
+    irqPlayer = &p;
+    irqFlushed = true;
+    uint64_t start = micros();
+    irq_set_pending(irq);
+    check(!irqFlushed && (micros() == start), "flush in an interrupt returns false at once");
+    irq_set_enabled(irq, false);
+    user_irq_unclaim(irq);
+    check(p.waitCommands(), "and is applied once it returns");
+
+    // With interrupts masked the work IRQ can't run, so it gives up
+    noInterrupts();
+    start = micros();
+    bool ok = p.flush();
+    uint64_t waited = micros() - start;
+    interrupts();
+    check(!ok && (waited >= 1000000) && (waited < 1100000), "flush with the work IRQ masked times out");
+    check(p.waitCommands(), "and is applied once it's unmasked");
+    p.end();
+}
+
+static void testPause() {
+    WAVAudioOutput out;
+    ROMBackgroundAudioAAC p(out);
+    p.write(aac, sizeof(aac));
+    p.begin();
+    delay(300);
+    p.pause();
+    check(p.paused(), "paused as soon as asked");
+    check(p.waitCommands(), "pause applied");
+    delay(300);
+    size_t pausedAt = out.samples().size();
+    delay(200);
+    const std::vector<int16_t> &s = out.samples();
+    bool silent = std::all_of(s.begin() + pausedAt, s.end(), [](int16_t x) {
+        return x == 0;
+    });
+    check(silent, "silent while paused");
+
+    // The last sound before the silence is the bottom of the fade, not a cut
+    size_t last = pausedAt;
+    while (last && !s[last - 1]) {
+        last--;
+    }
+    int tail = 0;
+    for (size_t i = last - 64; i < last; i++) {
+        tail = std::max(tail, abs(s[i]));
+    }
+    check(tail < 256, "faded out before the silence");
+
+    p.unpause();
+    play(p);
+    p.end();
+    // No input was skipped while paused, so everything but the fade is somewhere in the output
+    std::vector<int16_t> want = rendered(aac, sizeof(aac));
+    std::vector<int16_t> head(want.begin(), want.begin() + 44100 / 10 * 2);
+    std::vector<int16_t> tailWant(want.end() - 44100 / 10 * 2, want.end());
+    check(contains(out.samples(), head) && contains(out.samples(), tailWant), "unpause carried on where the pause left off");
+}
+
+static void testGain() {
+    // Before begin there's nothing to ramp from, so the gain is exact from the first sample
+    WAVAudioOutput out;
+    ROMBackgroundAudioAAC p(out);
+    p.setGain(0.5);
+    p.write(aac, sizeof(aac));
+    p.begin();
+    delay(300);
+    // More than the queue holds, so some have to wait for the pump
+    for (int i = 0; i < 20; i++) {
+        p.setGain(0.5 + i / 100.0);
+    }
+    p.setGain(0.5);
+    check(p.waitCommands(), "more commands than the queue holds all applied");
+    play(p);
+    p.end();
+    std::vector<int16_t> want = rendered(aac, sizeof(aac), 0.5);
+    std::vector<int16_t> head(want.begin(), want.begin() + 44100 / 10 * 2);
+    check(contains(out.samples(), head), "gain set before begin applied exactly");
+
+    int16_t ramp[1024 * 2];
+    for (auto &x : ramp) {
+        x = 10000;
+    }
+    ApplyGainRamp(ramp, 1024 * 2, 1 << 16, 0);
+    bool smooth = (ramp[0] > 9900) && (abs(ramp[2046]) < 20);
+    for (int i = 2; i < 1024 * 2; i += 2) {
+        smooth &= (ramp[i] <= ramp[i - 2]) && (ramp[i - 2] - ramp[i] <= 20) && (ramp[i] == ramp[i + 1]);
+    }
+    check(smooth, "gain ramps evenly across the frame");
+}
+
+static void testRender() {
+    // Rendering applies commands between frames too, and returns nothing while paused
+    ROMBackgroundAudioAAC p;
+    p.write(aac, sizeof(aac));
+    std::vector<int16_t> s;
+    int16_t block[1024 * 2];
+    size_t n = p.render(block, 1024);
+    s.insert(s.end(), block, block + n * 2);
+    p.pause();
+    n = p.render(block, 1024);
+    s.insert(s.end(), block, block + n * 2);
+    n = p.render(block, 1024);
+    check(n == 0, "render returns nothing once paused");
+    p.unpause();
+    while ((n = p.render(block, 1024)) > 0) {
+        s.insert(s.end(), block, block + n * 2);
+    }
+    check(s.size() == rendered(aac, sizeof(aac)).size(), "render after unpause lost no audio");
+}
+
+static void testPipeline() {
+    // No worker thread here, so the pipeline only decodes when `loop` is called, as from loop1()
+    WAVAudioOutput out;
+    ROMBackgroundAudioAAC p;
+    BackgroundAudioPipeline<ROMBackgroundAudioAAC> pipe(p, out);
+    p.write(aac, sizeof(aac));
+    pipe.begin();
+    pipe.loop();
+    p.pause();
+    check(p.waitCommands(), "pipeline's worker applies its own commands right away");
+    for (int i = 0; i < 20; i++) {
+        pipe.loop();
+        delay(50);
+    }
+    check(p.waitCommands() && !pipe.done(), "pipeline paused, not done");
+    p.unpause();
+    pipe.loop();
+    p.flush(); // Would never return if it waited for the worker
+    for (int i = 0; (i < 100) && !pipe.done(); i++) {
+        pipe.loop();
+        delay(50);
+    }
+    pipe.end();
+    check(pipe.done(), "flush from the pipeline's worker applied");
+    check(out.samples().size() < rendered(aac, sizeof(aac)).size(), "pipeline flushed stream cut short");
+}
+
+template<class Player>
+static std::vector<int16_t> renderAll(Player &p) {
+    std::vector<int16_t> s;
+    int16_t block[1024 * 2];
+    size_t n;
+    while ((n = p.render(block, 1024)) > 0) {
+        s.insert(s.end(), block, block + n * 2);
+    }
+    return s;
+}
+
+template<class Player>
+static void testSeek(const char *name, const uint8_t *data, size_t len) {
+    std::vector<int16_t> want = rendered<Player>(data, len);
+    Player p;
+    p.write(data, len);
+    int16_t block[1024 * 2];
+    for (int i = 0; i < 20; i++) {
+        p.render(block, 1024);
+    }
+    char msg[80];
+    snprintf(msg, sizeof(msg), "%s seek back to the start", name);
+    check(p.seek(0), msg);
+    snprintf(msg, sizeof(msg), "%s replays exactly after seeking to the start", name);
+    check(renderAll(p) == want, msg);
+
+    // Past the end now, so this is backwards too
+    snprintf(msg, sizeof(msg), "%s seek to the middle", name);
+    check(p.seek(len / 2), msg);
+    std::vector<int16_t> s = renderAll(p);
+    std::vector<int16_t> tail(want.end() - 44100 / 10 * 2, want.end());
+    snprintf(msg, sizeof(msg), "%s picks up mid-file and plays the rest", name);
+    check(contains(s, tail) && (s.size() < want.size() * 2 / 3), msg);
+    snprintf(msg, sizeof(msg), "%s seek past the end refused", name);
+    check(!p.seek(len + 1), msg);
+}
+
+static void testSeekWAV() {
+    // Each sample holds its own number, so where playback resumes can be read off exactly
+    static const size_t n = 20000;
+    std::vector<uint8_t> wav = { 'R', 'I', 'F', 'F', 0, 0, 0, 0, 'W', 'A', 'V', 'E', 'f', 'm', 't', ' ', 16, 0, 0, 0, 1, 0, 2, 0,
+                                 0x44, 0xac, 0, 0, 0x10, 0xb1, 2, 0, 4, 0, 16, 0, 'd', 'a', 't', 'a'
+                               };
+    for (uint32_t x = n * 4, i = 0; i < 4; i++, x >>= 8) {
+        wav.push_back(x & 0xff);
+    }
+    for (size_t i = 0; i < n; i++) {
+        int16_t s[2] = { (int16_t)i, (int16_t) - i };
+        wav.insert(wav.end(), (uint8_t *)s, (uint8_t *)(s + 2));
+    }
+    ROMBackgroundAudioWAV p;
+    p.write(wav.data(), wav.size());
+    std::vector<int16_t> s = renderAll(p);
+    bool ok = p.seek(44 + 12345 * 4 + 1); // Not on a sample boundary
+    int16_t block[2];
+    check(ok && (p.render(block, 1) == 1) && (block[0] == 12345) && (block[1] == -12345), "WAV seek within the data lands on the sample");
+    check(p.seek(0) && (renderAll(p) == s), "WAV seek to the start replays the file");
+
+    BackgroundAudioWAV ram;
+    ram.write(wav.data(), 1024);
+    check(!ram.seek(0), "RAM buffered player can't seek");
+}
+
+int main() {
+    testFlush();
+    testFlushBlocked();
+    testPause();
+    testGain();
+    testRender();
+    testPipeline();
+    testSeek<ROMBackgroundAudioAAC>("AAC", aac, sizeof(aac));
+    testSeek<ROMBackgroundAudioMP3>("MP3", mp3, sizeof(mp3));
+    testSeekWAV();
+    printf("%s\n", failed ? "FAILED" : "PASSED");
+    return failed ? 1 : 0;
+}
+
+extern "C" int espeak_ng_CompileDictionary(...) {
+    return 0; // Dictionaries are precompiled, this is never called
+}
@@ -0,0 +1,184 @@
+// dispatchtest - Earle F. Philhower, III <earlephilhower@yahoo.com>
+// Released to the public domain 2025
+//
+// Checks the shared work IRQ dispatcher (src/BackgroundAudioDispatch.h): posted pumps run least output
+// fill first, work posted while pumping isn't lost, only one user IRQ is claimed however many decoders
+// attach, and two decoders of the same class play side by side without stealing each other's pumps.
+//
+//     dispatchtest
+
+#include <Arduino.h>
+#include "WAVAudioOutput.h"
+#include <BackgroundAudio.h>
+#include "../../examples/SpeedTest/aac.h"
+#include "../../examples/SpeedTest/aache.h"
+
+static int failed = 0;
+
+static void check(bool ok, const char *what) {
+    printf("%-60s %s\n", what, ok ? "OK" : "FAIL");
+    failed += ok ? 0 : 1;
+}
+
+// Only reports however much room the test says it has
+class FillOutput : public AudioOutputBase {
+public:
+    bool setBuffers(size_t buffers, size_t bufferWords, int32_t silenceSample = 0) override {
+        (void) buffers;
+        (void) bufferWords;
+        (void) silenceSample;
+        return true;
+    }
+    bool setBitsPerSample(int bps) override {
+        return bps == 16;
+    }
+    bool setFrequency(int freq) override {
+        (void) freq;
+        return true;
+    }
+    bool setStereo(bool stereo = true) override {
+        return stereo;
+    }
+    bool begin() override {
+        return true;
+    }
+    bool end() override {
+        return true;
+    }
+    bool getUnderflow() override {
+        return false;
+    }
+    void onTransmit(void (*cb)(void *), void *cbData) override {
+        (void) cb;
+        (void) cbData;
+    }
+    size_t write(const uint8_t *buffer, size_t size) override {
+        (void) buffer;
+        (void) size;
+        return 0;
+    }
+    int availableForWrite() override {
+        return avail;
+    }
+
+    int avail = 0;
+};
+
+typedef struct Job {
+    char name;
+    FillOutput out;
+    BackgroundAudioWork work;
+    Job *chain;                 // Posted from inside this job's pump, if set
+    Job(char n) : name(n), work(run, this), chain(nullptr) {
+    }
+    static void run(void *p);
+} Job;
+
+static std::string order;
+
+void Job::run(void *p) {
+    Job *j = (Job *)p;
+    order += j->name;
+    if (j->chain) {
+        BackgroundAudioDispatcher::post(&j->chain->work);
+        j->chain = nullptr;
+    }
+}
+
+static void testOrdering() {
+    Job a('a'), b('b'), c('c'), d('d');
+    a.out.avail = 300; // Capacity 1000, so 700 bytes still queued
+    b.out.avail = 900; // Nearly empty, must go first
+    c.out.avail = 600;
+    d.out.avail = 0;   // Full, but posted by b's pump
+    for (Job *j : { &a, &b, &c, &d }) {
+        BackgroundAudioDispatcher::attach(&j->work, &j->out, 1000);
+    }
+    check(__builtin_popcount(host::irqClaimed) == 1, "one user IRQ claimed for four decoders");
+
+    // Posted from inside a higher priority (DMA) callback so they all wait for one work IRQ
+    order.clear();
+    noInterrupts();
+    BackgroundAudioDispatcher::post(&a.work);
+    BackgroundAudioDispatcher::post(&b.work);
+    BackgroundAudioDispatcher::post(&c.work);
+    interrupts();
+    check(order == "bca", "pumps run least output fill first");
+
+    order.clear();
+    b.chain = &d;
+    noInterrupts();
+    BackgroundAudioDispatcher::post(&a.work);
+    BackgroundAudioDispatcher::post(&b.work);
+    interrupts();
+    check(order == "bad", "work posted while pumping still runs");
+
+    order.clear();
+    noInterrupts();
+    BackgroundAudioDispatcher::post(&c.work);
+    BackgroundAudioDispatcher::post(&c.work);
+    interrupts();
+    check(order == "c", "posting twice runs the pump once");
+
+    order.clear();
+    BackgroundAudioDispatcher::detach(&c.work);
+    BackgroundAudioDispatcher::detach(&c.work);
+    noInterrupts();
+    BackgroundAudioDispatcher::post(&a.work);
+    BackgroundAudioDispatcher::post(&b.work);
+    interrupts();
+    check(order == "ba", "detached work is skipped");
+
+    for (Job *j : { &a, &b, &d }) {
+        BackgroundAudioDispatcher::detach(&j->work);
+    }
+    check(host::irqClaimed == 0, "user IRQ released after the last detach");
+}
+
+// What a decoder produces for the data on its own, to find in what was played
+static std::vector<int16_t> rendered(const uint8_t *data, size_t len) {
+    ROMBackgroundAudioAAC p;
+    p.write(data, len);
+    std::vector<int16_t> s;
+    int16_t block[1024 * 2];
+    size_t n;
+    while ((n = p.render(block, 1024)) > 0) {
+        s.insert(s.end(), block, block + n * 2);
+    }
+    return s;
+}
+
+static bool contains(const std::vector<int16_t> &played, const std::vector<int16_t> &want) {
+    return !want.empty() && (std::search(played.begin(), played.end(), want.begin(), want.end()) != played.end());
+}
+
+static void testSameClass() {
+    WAVAudioOutput out1, out2;
+    ROMBackgroundAudioAAC p1(out1), p2(out2);
+    p1.write(aac, sizeof(aac));
+    p2.write(aache, sizeof(aache));
+    p1.begin();
+    p2.begin();
+    check(__builtin_popcount(host::irqClaimed) == 1, "one user IRQ claimed for two AAC players");
+    for (int i = 0; (i < 60000) && (!p1.done() || !p2.done()); i++) {
+        delay(1);
+    }
+    delay(500); // Let the last buffers drain, five of 2048 samples is over 200ms at 48kHz
+    p1.end();
+    p2.end();
+    check(contains(out1.samples(), rendered(aac, sizeof(aac))), "first AAC player played all of its stream");
+    check(contains(out2.samples(), rendered(aache, sizeof(aache))), "second AAC player played all of its stream");
+    check(!out1.underflows() && !out2.underflows(), "neither output underflowed");
+    check(host::irqClaimed == 0, "user IRQ released after both players ended");
+}
+
+int main() {
+    testOrdering();
+    testSameClass();
+    printf("%s\n", failed ? "FAILED" : "PASSED");
+    return failed ? 1 : 0;
+}
+
+extern "C" int espeak_ng_CompileDictionary(...) {
+    return 0; // Dictionaries are precompiled, this is never called
+}
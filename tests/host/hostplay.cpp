@@ -0,0 +1,142 @@
+// hostplay - Earle F. Philhower, III <earlephilhower@yahoo.com>
+// Released to the public domain 2025
+//
+// Plays a file (or the built-in example data) through the BackgroundAudio players on a PC,
+// recording what the output would have played to a WAV file.  The file is fed in from the
+// "app" a block at a time between 1ms delays, the same as a sketch's loop() would.  With -r the
+// decoders' `render` is used instead, converting as fast as possible with no output or simulated time.
+//
+//     hostplay [-r] mp3|aac|wav <input> <output.wav>
+//     hostplay [-r] beep|piano <output.wav>
+//     hostplay speak "<text>" <output.wav>
+
+#include <Arduino.h>
+#include "WAVAudioOutput.h"
+#include <BackgroundAudio.h>
+#include <BackgroundAudioSpeech.h>
+#include <__example_beepwav.h>
+#include <__example_pianoaac.h>
+#include VOICE_HEADER
+
+// Feed data into a player as an app would, then let it play out to the end
+template<class Player>
+static bool play(Player &p, WAVAudioOutput &out, const uint8_t *data, size_t len) {
+    if (!p.begin()) {
+        fprintf(stderr, "ERROR: Unable to start the player\n");
+        return false;
+    }
+    while (len || !p.done()) {
+        while (len && (p.availableForWrite() >= 512)) {
+            size_t n = p.write(data, std::min(len, (size_t)512));
+            data += n;
+            len -= n;
+        }
+        delay(1);
+    }
+    delay(100); // Let the last buffers drain
+    fprintf(stderr, "%.2f seconds played at %dHz, %u frames, %u underflows, %u output underflows, %u errors\n",
+            (double)out.samples().size() / 2 / out.frequency(), out.frequency(), p.frames(), p.underflows(),
+            out.underflows(), p.errors());
+    p.end();
+    return true;
+}
+
+// Decode offline with `render`, topping the input up whenever it runs dry
+template<class Player>
+static bool render(Player &p, const char *path, const uint8_t *data, size_t len) {
+    std::vector<int16_t> samples;
+    int16_t block[1024 * 2];
+    while (true) {
+        size_t n = p.write(data, len);
+        data += n;
+        len -= n;
+        n = p.render(block, 1024);
+        samples.insert(samples.end(), block, block + n * 2);
+        if ((n < 1024) && !len) {
+            break;
+        }
+    }
+    fprintf(stderr, "%.2f seconds rendered at %dHz, %u frames, %u underflows, %u errors\n",
+            (double)samples.size() / 2 / p.sampleRate(), p.sampleRate(), p.frames(), p.underflows(), p.errors());
+    return WAVAudioOutput::writeWAV(path, samples, p.sampleRate());
+}
+
+static std::vector<uint8_t> readFile(const char *path) {
+    std::vector<uint8_t> data;
+    FILE *f = fopen(path, "rb");
+    if (!f) {
+        fprintf(stderr, "ERROR: Unable to open '%s'\n", path);
+        exit(1);
+    }
+    uint8_t buff[4096];
+    size_t n;
+    while ((n = fread(buff, 1, sizeof(buff), f)) > 0) {
+        data.insert(data.end(), buff, buff + n);
+    }
+    fclose(f);
+    return data;
+}
+
+static void usage() {
+    fprintf(stderr, "Usage: hostplay [-r] mp3|aac|wav <input> <output.wav>\n");
+    fprintf(stderr, "       hostplay [-r] beep|piano <output.wav>\n");
+    fprintf(stderr, "       hostplay speak \"<text>\" <output.wav>\n");
+    exit(1);
+}
+
+static bool offline = false;
+
+template<class Player>
+static bool run(Player &p, WAVAudioOutput &out, const uint8_t *data, size_t len) {
+    return offline ? render(p, out.path(), data, len) : play(p, out, data, len);
+}
+
+int main(int argc, char **argv) {
+    if ((argc > 1) && !strcmp(argv[1], "-r")) {
+        offline = true;
+        argc--;
+        argv++;
+    }
+    if (argc < 3) {
+        usage();
+    }
+    std::string mode = argv[1];
+    bool builtIn = (mode == "beep") || (mode == "piano");
+    if ((!builtIn && (argc != 4)) || (builtIn && (argc != 3))) {
+        usage();
+    }
+    WAVAudioOutput out(argv[argc - 1]);
+    bool ok = false;
+
+    if (mode == "beep") {
+        BackgroundAudioWAV p(out);
+        ok = run(p, out, beepwav, sizeof(beepwav));
+    } else if (mode == "piano") {
+        BackgroundAudioAAC p(out);
+        ok = run(p, out, piano_aac, sizeof(piano_aac));
+    } else if (mode == "mp3") {
+        std::vector<uint8_t> d = readFile(argv[2]);
+        BackgroundAudioMP3 p(out);
+        ok = run(p, out, d.data(), d.size());
+    } else if (mode == "aac") {
+        std::vector<uint8_t> d = readFile(argv[2]);
+        BackgroundAudioAAC p(out);
+        ok = run(p, out, d.data(), d.size());
+    } else if (mode == "wav") {
+        std::vector<uint8_t> d = readFile(argv[2]);
+        BackgroundAudioWAV p(out);
+        ok = run(p, out, d.data(), d.size());
+    } else if ((mode == "speak") && !offline) {
+        BackgroundAudioSpeech p(out);
+        p.setVoice(VOICE);
+        ok = play(p, out, (const uint8_t *)argv[2], strlen(argv[2]) + 1);
+    } else {
+        usage();
+    }
+    out.end();
+    return ok ? 0 : 1;
+}
+
+extern "C" int espeak_ng_CompileDictionary(...) {
+    return 0; // Dictionaries are precompiled, this is never called
+}
@@ -0,0 +1,282 @@
+// mixertest - Earle F. Philhower, III <earlephilhower@yahoo.com>
+// Released to the public domain 2025
+//
+// Checks the mixer (src/BackgroundAudioMixer.h): the output limiter catches full-scale bursts anywhere in
+// a frame, including right at the frame edge when the frame isn't a multiple of the lookahead, without
+// wrapping or dropping any of the burst.  Two full-scale legs summed to twice full scale come out limited
+// to just under full scale with no sample past it and no wrap, and the limiter's cost per block is printed
+// (the test is built with BACKGROUNDAUDIO_PROFILE for that).  Leg gain set before `begin` is exact from the first sample, a
+// gain change ramps evenly over the ramp time, pan attenuates the opposite channel, and a ducked leg drops
+// by the rule's depth while its trigger plays and comes back to full level after the hold and ramp.  Two
+// legs given the same `startAt`, one of them resampled, start on the same output sample, at the same
+// distance from the requested time wherever it falls in a block, and a start asked for while a region is
+// acquired waits for it to be committed instead of moving the buffers out from under the writer.
+//
+//     mixertest
+
+#include <Arduino.h>
+#include "WAVAudioOutput.h"
+#include <BackgroundAudio.h>
+
+static int failed = 0;
+
+static void check(bool ok, const char *what) {
+    printf("%-60s %s\n", what, ok ? "OK" : "FAIL");
+    failed += ok ? 0 : 1;
+}
+
+// Two legs of 30000 sum to nearly twice full scale, so every burst sample has to be limited
+template<size_t words>
+static void testLimiter(const char *name) {
+    WAVAudioOutput out;
+    BackgroundAudioMixer<words> mixer(out, 44100);
+    mixer.setLimiterRelease(1); // Back to unity before the next burst, so each one is caught from scratch
+    BackgroundAudioMixerInput *leg[2] = { mixer.add(), mixer.add() };
+
+    // Bursts every third frame, walking across the end of the frame and then straddling the edge
+    std::vector<int16_t> in(10240 * 2, 0);
+    size_t loud = 0;
+    for (size_t f = 1, at = words - 48; (f + 1) * words < in.size() / 2; f += 3, at += 8) {
+        for (size_t i = f * words + at; i < f * words + at + 8; i++) {
+            in[i * 2] = 30000;
+            in[i * 2 + 1] = 30000;
+            loud += 2;
+        }
+    }
+    for (auto l : leg) {
+        l->begin();
+        l->write((const uint8_t *)in.data(), in.size() * 2);
+    }
+    mixer.begin();
+    delay(500);
+    out.end();
+
+    const std::vector<int16_t> &s = out.samples();
+    bool wrapped = std::any_of(s.begin(), s.end(), [](int16_t x) {
+        return x < 0;
+    });
+    size_t kept = std::count_if(s.begin(), s.end(), [](int16_t x) {
+        return x > 30000;
+    });
+    char msg[80];
+    snprintf(msg, sizeof(msg), "%s limiter never wraps a burst at the frame edge", name);
+    check(!wrapped, msg);
+    snprintf(msg, sizeof(msg), "%s limiter outputs every burst sample near full scale", name);
+    check(kept == loud, msg);
+}
+
+// Two in-phase full-scale 1kHz sines, so the bus peaks at twice full scale every cycle
+static void testOvershoot() {
+    WAVAudioOutput out;
+    BackgroundAudioMixer<512> mixer(out, 44100);
+    mixer.setLimiterRelease(50);
+    std::vector<int16_t> in(40 * 2048 * 2);
+    for (size_t i = 0; i < in.size() / 2; i++) {
+        in[i * 2] = in[i * 2 + 1] = (int16_t)lrint(32767 * sin(2 * M_PI * 1000 * i / 44100));
+    }
+    for (int i = 0; i < 2; i++) {
+        BackgroundAudioMixerInput *leg = mixer.add();
+        leg->setBuffers(40, 2048);
+        leg->begin();
+        leg->write((const uint8_t *)in.data(), in.size() * 2);
+    }
+    ba_profile_reset();
+    mixer.begin();
+    delay(1500);
+    out.end();
+
+    // A wrapped sample jumps across the range, a sine this slow moves under 4700 per sample
+    const std::vector<int16_t> &s = out.samples();
+    int peak = 0;
+    bool wrapped = false;
+    for (size_t i = 2; i < s.size(); i++) {
+        peak = std::max(peak, abs(s[i]));
+        wrapped |= abs(s[i] - s[i - 2]) > 6000;
+    }
+    check(!wrapped && (peak <= 32767), "two full-scale legs limited without overshoot or wrap");
+    check(peak >= 32000, "limited sum still reaches nearly full scale");
+    const ba_profile_stat_t &st = ba_profile_stat[BA_PROFILE_LIMIT];
+    if (st.calls) {
+        printf("limiter %s/block of 512 while limiting: %.0f avg, %u max\n", ba_profile_clock, (double)st.cycles / st.calls, (unsigned)st.max);
+    }
+}
+
+// A leg playing a constant level, with enough buffering to play for the whole test without refilling
+static BackgroundAudioMixerInput *constantLeg(BackgroundAudioMixer<512> &mixer, size_t samples, int16_t level) {
+    BackgroundAudioMixerInput *leg = mixer.add();
+    leg->setBuffers(samples / 2048, 2048);
+    leg->begin();
+    std::vector<int16_t> in(samples * 2, level);
+    leg->write((const uint8_t *)in.data(), in.size() * 2);
+    return leg;
+}
+
+// Left channel sample counts from `from` until it first satisfies `f`
+template<typename F>
+static size_t untilLeft(const std::vector<int16_t> &s, size_t from, F f) {
+    size_t i = from;
+    while ((i < s.size() / 2) && !f(s[i * 2])) {
+        i++;
+    }
+    return i;
+}
+
+static void testLevels() {
+    WAVAudioOutput out;
+    BackgroundAudioMixer<512> mixer(out, 44100);
+    BackgroundAudioMixerInput *leg = mixer.add();
+    leg->setBuffers(40, 2048);
+    leg->setGain(0.5);
+    leg->begin();
+    std::vector<int16_t> in(40 * 2048 * 2, 16000);
+    leg->write((const uint8_t *)in.data(), in.size() * 2);
+    mixer.begin();
+    delay(300);
+    const std::vector<int16_t> &s = out.samples();
+    size_t first = untilLeft(s, 0, [](int16_t x) {
+        return x != 0;
+    });
+    check((first < s.size() / 2) && (s[first * 2] == 8000) && (s[first * 2 + 1] == 8000), "gain set before begin applied from the first sample");
+
+    // Halve the level over 100ms, which is 4410 samples
+    leg->setRampTime(100);
+    leg->setGain(0.25);
+    delay(400);
+    size_t start = untilLeft(s, first, [](int16_t x) {
+        return x < 8000;
+    });
+    size_t end = untilLeft(s, start, [](int16_t x) {
+        return x <= 4000;
+    });
+    bool even = (end < s.size() / 2) && (s[end * 2] == 4000) && (s[s.size() - 2] == 4000);
+    for (size_t i = start + 1; even && (i <= end); i++) {
+        even = (s[i * 2] <= s[i * 2 - 2]) && (s[i * 2 - 2] - s[i * 2] <= 2);
+    }
+    check(even, "gain change ramps down evenly to the new level");
+    check((end - start > 4410 - 512) && (end - start < 4410 + 512), "gain ramp takes the ramp time");
+
+    leg->setRampTime(0);
+    leg->setPan(-1.0);
+    delay(100);
+    check((s[s.size() - 2] == 4000) && (s[s.size() - 1] == 0), "pan full left silences the right");
+    leg->setPan(0.5);
+    delay(100);
+    check((s[s.size() - 2] == 2000) && (s[s.size() - 1] == 4000), "pan halfway right halves the left");
+    out.end();
+}
+
+static void testDuck() {
+    WAVAudioOutput out;
+    BackgroundAudioMixer<512> mixer(out, 44100);
+    BackgroundAudioMixerInput *music = constantLeg(mixer, 40 * 2048, 16000);
+    // The voice is only on the right, so the left channel is the music alone
+    BackgroundAudioMixerInput *voice = mixer.add();
+    voice->setPan(1.0);
+    voice->setBuffers(20, 2048);
+    voice->begin();
+    std::vector<int16_t> in((22050 + 8820) * 2, 0);
+    std::fill(in.begin() + 22050 * 2, in.end(), 10000);
+    voice->write((const uint8_t *)in.data(), in.size() * 2);
+    check(mixer.duck(voice, music, -12.0, 50, 250), "duck rule accepted");
+    mixer.begin();
+    delay(1800);
+    out.end();
+
+    const std::vector<int16_t> &s = out.samples();
+    size_t n = s.size() / 2;
+    size_t talk = 0, quiet = 0;
+    for (size_t i = 0; i < n; i++) {
+        if (s[i * 2 + 1] - s[i * 2] >= 9990) { // The music is the same on both sides, ducked or not
+            talk = talk ? talk : i;
+            quiet = i + 1;
+        }
+    }
+    // -12dB is 0.2512 of full level
+    size_t down = untilLeft(s, talk, [](int16_t x) {
+        return x <= 4020;
+    });
+    size_t up = untilLeft(s, down, [](int16_t x) {
+        return x == 16000;
+    });
+    check(talk && (s[talk * 2 - 2] == 16000), "music at full level before the voice");
+    check((down < n) && (s[down * 2] >= 4010) && (down - talk < 2205 + 1024), "music ducked by 12dB within the ramp time");
+    check(untilLeft(s, down, [](int16_t x) {
+        return x > 4020;
+    }) >= quiet, "music stays ducked while the voice plays");
+    // Back up once the voice has been silent for the hold time, then over the ramp
+    check((up < n) && (up > quiet + 11025) && (up - quiet < 11025 + 2205 + 1024), "music recovers after the hold and ramp");
+    check(untilLeft(s, up, [](int16_t x) {
+        return x != 16000;
+    }) == n, "music stays at full level after recovering");
+}
+
+static void testStartAt() {
+    WAVAudioOutput out;
+    BackgroundAudioMixer<512> mixer(out, 44100);
+    BackgroundAudioMixerInput *left = mixer.add();
+    BackgroundAudioMixerInput *right = mixer.add();
+    left->setPan(-1.0);
+    right->setPan(1.0);
+    left->begin();
+    right->begin();
+    right->setFrequency(22050); // Resampled, so every sample is played twice
+    mixer.begin();
+    delay(50);
+
+    std::vector<int16_t> ramp(2048 * 2);
+    for (size_t i = 0; i < 2048; i++) {
+        ramp[i * 2] = ramp[i * 2 + 1] = i + 1;
+    }
+    std::vector<int16_t> old(3000 * 2, 5000);
+    const std::vector<int16_t> &s = out.samples();
+    int64_t latency = -1;
+    bool aligned = true, exact = true, waited = true;
+    for (unsigned offset : { 100u, 0u, 511u, 37u }) {
+        // Old data which the start has to drop, and a region being rendered into as by a decoder on another core
+        left->write((const uint8_t *)old.data(), old.size() * 2);
+        right->write((const uint8_t *)old.data(), old.size() * 2);
+        size_t words;
+        uint32_t *region = right->acquireWriteBuffer(&words);
+        uint64_t t = mixer.sampleTime() + 3 * 512 + offset;
+        aligned &= left->startAt(t) && right->startAt(t);
+        std::fill(region, region + 100, 0x1b581b58); // 7000 on both channels
+        right->commitWriteBuffer(100);
+        left->write((const uint8_t *)ramp.data(), ramp.size() * 2);
+        right->write((const uint8_t *)ramp.data(), ramp.size() * 2);
+        size_t before = s.size() / 2;
+        delay(200);
+
+        size_t l = before, r = before;
+        while ((l < s.size() / 2) && !s[l * 2]) {
+            l++;
+        }
+        while ((r < s.size() / 2) && !s[r * 2 + 1]) {
+            r++;
+        }
+        aligned &= (l == r) && (l < s.size() / 2);
+        waited &= (s[r * 2 + 1] == 1) && (s[r * 2 + 3] == 1) && (s[r * 2 + 5] == 2);
+        if (latency < 0) {
+            latency = (int64_t)l - (int64_t)t;
+        }
+        exact &= ((int64_t)l - (int64_t)t == latency) && (s[l * 2] == 1) && (s[l * 2 + 2] == 2);
+    }
+    out.end();
+    check(aligned, "legs started at the same time begin on the same sample");
+    check(exact, "first sample spliced in exactly, anywhere in a block");
+    check(waited, "start during an acquired region dropped it once committed");
+}
+
+int main() {
+    testLimiter<512>("512 sample frames");
+    testLimiter<500>("500 sample frames");
+    testOvershoot();
+    testLevels();
+    testDuck();
+    testStartAt();
+    printf("%s\n", failed ? "FAILED" : "PASSED");
+    return failed ? 1 : 0;
+}
+
+extern "C" int espeak_ng_CompileDictionary(...) {
+    return 0; // Dictionaries are precompiled, this is never called
+}
@@ -0,0 +1,777 @@
+// schedsim - Earle F. Philhower, III <earlephilhower@yahoo.com>
+// Released to the public domain 2025
+//
+// Deterministic real-time scheduling simulator for sizing a streaming player's RawDataBuffer (the
+// STREAMBUFF in the web radio example) without trial and error on hardware.  The real player classes
+// run against a model of the Pico:
+//   * the output DMA plays each buffer at exactly the sample rate, with two chained channels like the
+//     AudioBufferManager, and its completion IRQ is delivered with a random latency of up to `jitter`
+//   * decoding is charged to a simulated CPU, either from a cycles per sample model or by timing each frame
+//     on this machine and scaling it (`measure`), and the app's loop() can't run while the CPU is busy
+//   * the app's loop() runs every `loop` ms and writes whatever the feeder has delivered and the player has
+//     room for, where the feeder delivers up to `rate` bytes per second in `burst` byte chunks, holding at
+//     most `window` bytes the app hasn't taken yet, and stops for `stall` ms about every `every` ms
+// Each scenario is run once per RawDataBuffer size, reporting the output underflows (DMA played silence),
+// input dropouts (frames the decoder had to skip for lack of data), and the minimum output and input
+// buffer fill, then recommends the smallest size which played cleanly.
+//
+//     schedsim [--sizes 2048,4096,...] [scenarios.txt | key=value ...]
+//
+// --sizes picks which RawDataBuffer sizes to try, any power of 2 from 1024 to 65536.
+//
+// With no arguments a few typical scenarios are run.  Each line of a scenario file (or the command line)
+// is a list of key=value settings, `#` starts a comment:
+//     name=wifi input=mp3 rate=1.5x burst=1460 stall=250 every=3000 jitter=200
+//
+//     name      Label for the report
+//     input     mp3, aac, he-aac (the SpeedTest arrays), piano, beep (the examples), or a .mp3/.aac/.wav path
+//     duration  Seconds of audio, repeating the input as needed (not WAVs), default 30
+//     cpu       pico (133MHz) or pico2 (150MHz), choosing the clock and the decoder cycles per sample
+//     mhz       CPU clock override
+//     cycles    Decoder cycles per output sample override
+//     measure   Time each decoded frame on this PC and multiply by this factor instead of using `cycles`.
+//               Not deterministic, as it depends on this machine's load
+//     rate      Feeder bytes per second, or a multiple of the stream's bitrate with an `x` suffix, default 1.5x
+//     burst     Bytes the feeder delivers at a time, default 1460 (one TCP segment)
+//     window    Most bytes the feeder holds for the app before it stops delivering, default 5840 (a small
+//               TCP receive window)
+//     stall     Length of each feeder stall in ms, default 0
+//     every     Average ms between stalls (randomly 0.5x to 1.5x), default 5000
+//     jitter    Maximum DMA IRQ latency in us, default 50
+//     loop      App loop() period in ms, default 1
+//     prebuffer Percent of the buffer filled before calling begin(), default 50
+//     seed      Random seed for the jitter and stall times, default 1
+
+#include <Arduino.h>
+#include <AudioOutputBase.h>
+#include <deque>
+#include <utility>
+#include <BackgroundAudio.h>
+#include <__example_beepwav.h>
+#include <__example_pianoaac.h>
+#include "../../examples/SpeedTest/aac.h"
+#include "../../examples/SpeedTest/aache.h"
+#include "../../examples/SpeedTest/mp3.h"
+
+typedef enum { MP3, AAC, WAV } Format;
+
+typedef struct {
+    std::string name = "default";
+    std::string input = "mp3";
+    double duration = 30;
+    std::string cpu = "pico";
+    double mhz = 0;             // 0 = from cpu
+    double cycles = 0;          // 0 = from cpu and format
+    double measure = 0;         // Nonzero = measured cost scale
+    double rate = 1.5;
+    bool rateIsMultiple = true;
+    double burst = 1460;
+    double window = 5840;
+    double stall = 0;
+    double every = 5000;
+    double jitter = 50;
+    double loop = 1;
+    double prebuffer = 50;
+    uint32_t seed = 1;
+} Scenario;
+
+typedef struct {
+    std::string label;
+    Format format;
+    bool he;                    // HE-AAC, for the cost model
+    std::vector<uint8_t> data;  // Repeated out to the scenario's duration
+    int frequency;
+    double seconds;             // Of audio in `data`
+    double byteRate;            // Average bytes per second of audio
+} Stream;
+
+typedef struct {
+    size_t size;
+    uint32_t underflows;        // Output buffers which had to be silence
+    uint32_t dropouts;          // Frames skipped for lack of input
+    double minOutput;           // Least audio queued for the DMA at any IRQ, in us
+    size_t minInput;            // Least data in the RawDataBuffer at any pump while streaming, in bytes
+    double load;                // Fraction of the CPU spent decoding
+    bool finished;
+} Result;
+
+// Small fixed PRNG so every run of a scenario is identical on any machine
+class Random {
+public:
+    Random(uint32_t seed) : _s(seed ? seed : 1) {
+    }
+    double uniform() {
+        _s ^= _s << 13;
+        _s ^= _s >> 17;
+        _s ^= _s << 5;
+        return _s / 4294967296.0;
+    }
+private:
+    uint32_t _s;
+};
+
+/**
+    @brief Model of the DMA-driven output and the CPU time spent filling it
+
+    @details
+    Buffers are `setBuffers` sized.  The two DMA channels each own one while it plays, and when one finishes
+    its IRQ frees that buffer and reloads the channel with the oldest complete buffer, or silence if none is
+    ready, to play after the other channel's.  Everything written during a callback is charged decode time
+    and only becomes ready for the DMA when that time has passed.
+*/
+class SimOutput : public AudioOutputBase {
+public:
+    bool setBuffers(size_t buffers, size_t bufferWords, int32_t silenceSample = 0) override {
+        (void) silenceSample;
+        _buffers = buffers;
+        _words = bufferWords;
+        return true;
+    }
+    bool setBitsPerSample(int bps) override {
+        return bps == 16;
+    }
+    bool setFrequency(int freq) override {
+        if (freq > 0) {
+            _freq = freq;
+        }
+        return freq > 0;
+    }
+    bool setStereo(bool stereo = true) override {
+        return stereo;
+    }
+    bool begin() override {
+        _empty = _buffers;
+        _partial = 0;
+        _ready.clear();
+        _channel[0] = _channel[1] = false;
+        _nextIRQ = 0;
+        _boundary = host::now;
+        _clock = host::now;
+        _running = true;
+        scheduleIRQ();
+        return true;
+    }
+    bool end() override {
+        _running = false;
+        return true;
+    }
+    bool getUnderflow() override {
+        return false;
+    }
+    void onTransmit(void (*cb)(void *), void *cbData) override {
+        _cb = cb;
+        _cbData = cbData;
+    }
+    size_t write(const uint8_t *buffer, size_t size) override {
+        (void) buffer;
+        size_t words = std::min(size / 4, (size_t)availableForWrite() / 4);
+        if (_inCallback && words) {
+            _clock += cost(words);
+        }
+        for (size_t left = words; left;) {
+            size_t n = std::min(left, _words - _partial);
+            _partial += n;
+            left -= n;
+            if (_partial == _words) {
+                _ready.push_back(_clock);
+                _empty--;
+                _partial = 0;
+            }
+        }
+        return words * 4;
+    }
+    int availableForWrite() override {
+        return (int)((_empty * _words - _partial) * 4);
+    }
+
+    /**
+        @brief Delay each DMA IRQ by a random 0 to `us` microseconds
+    */
+    void setJitter(double us, uint32_t seed) {
+        _jitter = us;
+        _rand = Random(seed);
+    }
+
+    /**
+        @brief Charge each decoded sample a fixed number of CPU cycles
+    */
+    void setCostModel(double cyclesPerSample, double mhz) {
+        _usPerSample = cyclesPerSample / mhz;
+        _measure = 0;
+    }
+
+    /**
+        @brief Charge each write the real time this PC took to produce it, times `scale`
+    */
+    void setCostMeasured(double scale) {
+        _measure = scale;
+    }
+
+    /**
+        @brief Simulated time of the next DMA IRQ
+    */
+    double nextIRQ() const {
+        return _running ? _nextIRQ : 1e300;
+    }
+
+    /**
+        @brief Run the DMA IRQ due now: free the finished buffer and queue the next one
+
+        @return False if the channel had to be loaded with silence
+    */
+    bool irq() {
+        double now = _nextIRQ;
+        int ch = _irqs++ & 1;
+        if (_channel[ch]) {
+            _empty++;
+        }
+        _channel[ch] = !_ready.empty() && (_ready.front() <= now);
+        if (_channel[ch]) {
+            _ready.pop_front();
+        }
+        scheduleIRQ();
+        return _channel[ch];
+    }
+
+    /**
+        @brief Audio ready to play after the buffers already loaded into the DMA, in microseconds
+    */
+    double queued(double now) const {
+        size_t n = 0;
+        for (auto t : _ready) {
+            n += t <= now ? 1 : 0;
+        }
+        return n * period();
+    }
+
+    /**
+        @brief Call the player's transmit callback (its pump) at simulated time `now`, charging its work
+
+        @return Simulated time the CPU finishes the work
+    */
+    double callback(double now) {
+        _clock = std::max(now, _clock);
+        double start = _clock;
+        _lastReal = rp2040.getCycleCount64();
+        _inCallback = true;
+        host::irqDepth++;
+        _cb(_cbData);
+        host::irqDepth--;
+        host::runPendingIRQs();
+        _inCallback = false;
+        _busy += _clock - start;
+        return _clock;
+    }
+
+    /**
+        @brief Total simulated CPU time spent in callbacks, in microseconds
+    */
+    double busy() const {
+        return _busy;
+    }
+
+    double period() const {
+        return _words * 1e6 / _freq;
+    }
+
+private:
+    void scheduleIRQ() {
+        _boundary += period();
+        _nextIRQ = _boundary + _jitter * _rand.uniform();
+    }
+
+    double cost(size_t words) {
+        if (!_measure) {
+            return words * _usPerSample;
+        }
+        uint64_t t = rp2040.getCycleCount64();
+        double us = (t - _lastReal) / 1000.0 * _measure;
+        _lastReal = t;
+        return us;
+    }
+
+    size_t _buffers = 5;
+    size_t _words = 16;
+    int _freq = 44100;
+    void (*_cb)(void *) = nullptr;
+    void *_cbData = nullptr;
+    bool _running = false;
+    size_t _empty = 0;          // Buffers not complete or in the DMA, including the partial one
+    size_t _partial = 0;        // Words in the buffer being filled
+    std::deque<double> _ready;  // Time each complete buffer's data was finished
+    bool _channel[2] = {};      // Each DMA channel is playing a real buffer, not silence
+    uint32_t _irqs = 0;
+    double _boundary = 0;       // When the DMA finished its last buffer, exactly on the sample clock
+    double _nextIRQ = 0;
+    double _clock = 0;          // CPU is busy until here
+    double _busy = 0;
+    bool _inCallback = false;
+    double _usPerSample = 0;
+    double _measure = 0;
+    uint64_t _lastReal = 0;
+    double _jitter = 0;
+    Random _rand{1};
+};
+
+/**
+    @brief The app's network or file source: bursts at a fixed average rate, with occasional stalls
+*/
+class Feeder {
+public:
+    Feeder(const Scenario &s, double rate, size_t total, Random *rand) : _s(s), _rate(rate), _total(total), _rand(rand) {
+        _window = std::max(s.window, s.burst);
+        _nextStall = s.stall > 0 ? s.every * 1000 * (0.5 + _rand->uniform()) : 1e300;
+    }
+
+    double next() const {
+        return _arrived < _total ? _next : 1e300;
+    }
+
+    /**
+        @brief Deliver the next burst, unless the app hasn't made room for it yet
+
+        @param [in] taken Bytes the app has read so far
+    */
+    void arrive(size_t taken) {
+        size_t n = std::min((size_t)_s.burst, _total - _arrived);
+        if (_arrived + n - taken <= _window) {
+            _arrived += n;
+        }
+        _next += n * 1e6 / _rate;
+        if (_next >= _nextStall) {
+            _next += _s.stall * 1000;
+            _nextStall = _next + _s.every * 1000 * (0.5 + _rand->uniform());
+        }
+    }
+
+    size_t arrived() const {
+        return _arrived;
+    }
+
+private:
+    const Scenario &_s;
+    double _rate;
+    size_t _total;
+    Random *_rand;
+    size_t _window;
+    size_t _arrived = 0;
+    double _next = 0;
+    double _nextStall;
+};
+
+template<template<class> class Player, size_t N>
+static Result simulate(const Scenario &s, const Stream &in) {
+    Result r = { N, 0, 0, 1e300, (size_t) -1, 0, false };
+    Random rand(s.seed);
+    SimOutput out;
+    out.setJitter(s.jitter, s.seed * 7 + 1);
+    double mhz = s.mhz ? s.mhz : (s.cpu == "pico2" ? 150 : 133);
+    double cycles = s.cycles;
+    if (!cycles) {
+        // SpeedTest's -O3 cycles per output sample.  HE-AAC on the RP2040 is estimated from the RP2350 ratio.
+        static const double pico[] = { 956, 1472, 4100, 50 }, pico2[] = { 528, 532, 1486, 30 };
+        int i = in.format == MP3 ? 0 : in.format == WAV ? 3 : in.he ? 2 : 1;
+        cycles = s.cpu == "pico2" ? pico2[i] : pico[i];
+    }
+    if (s.measure) {
+        out.setCostMeasured(s.measure);
+    } else {
+        out.setCostModel(cycles, mhz);
+    }
+
+    Player<RawDataBuffer<N>> p(out);
+    Feeder feed(s, s.rateIsMultiple ? s.rate * in.byteRate : s.rate, in.data.size(), &rand);
+    size_t written = 0;
+    size_t prebuffer = std::min((size_t)(N * s.prebuffer / 100), in.data.size());
+    bool started = false;
+    double busyUntil = 0, pumpAt = 1e300, app = 0, now = 0;
+    double limit = (in.seconds * 4 + 10) * 1e6;
+    size_t starved = in.byteRate * 4096 / in.frequency; // Two of the longest (HE-AAC) frames
+
+    while (now < limit) {
+        now = std::min({ out.nextIRQ(), pumpAt, app, feed.next() });
+        host::now = (uint64_t) now;
+        if (now == out.nextIRQ()) {
+            bool real = out.irq();
+            if (!real && started) {
+                r.underflows++;
+            }
+            r.minOutput = std::min(r.minOutput, out.queued(now));
+            if (pumpAt == 1e300) {
+                pumpAt = std::max(now, busyUntil); // The work IRQ waits for the one in progress
+            }
+        } else if (now == pumpAt) {
+            pumpAt = 1e300;
+            bool streaming = written < in.data.size();
+            if (streaming) {
+                r.minInput = std::min(r.minInput, p.available());
+            }
+            uint32_t before = p.underflows() + p.errors();
+            busyUntil = out.callback(now);
+            // Only count errors when the data ran short, not bad frames (i.e. where the input was looped)
+            if (streaming && (p.available() < starved)) {
+                r.dropouts += p.underflows() + p.errors() - before;
+            }
+            if (!streaming && p.done()) {
+                r.finished = true;
+                break;
+            }
+        } else if (now == app) {
+            if (now < busyUntil) {
+                app = busyUntil; // loop() is preempted by the decoding
+                continue;
+            }
+            while (written < feed.arrived()) {
+                size_t n = p.write(in.data.data() + written, feed.arrived() - written);
+                written += n;
+                if (!n) {
+                    break;
+                }
+            }
+            if (!started && (p.available() >= prebuffer)) {
+                p.begin();
+                started = true;
+            }
+            app += s.loop * 1000;
+        } else {
+            feed.arrive(written);
+        }
+    }
+    r.load = out.busy() / now;
+    p.end();
+    host::now = 0;
+    return r;
+}
+
+template<template<class> class Player, size_t... N>
+static std::vector<Result> sweep(const Scenario &s, const Stream &in, const std::vector<size_t> &sizes, std::index_sequence<N...>) {
+    std::vector<Result> ret;
+    ((std::find(sizes.begin(), sizes.end(), N) != sizes.end() ? ret.push_back(simulate<Player, N>(s, in)) : void()), ...);
+    return ret;
+}
+
+// Counts what a ROM player produces to find the stream's sample rate and length
+class CountOutput : public AudioOutputBase {
+public:
+    bool setBuffers(size_t buffers, size_t bufferWords, int32_t silenceSample = 0) override {
+        (void) buffers;
+        (void) silenceSample;
+        _blockBytes = bufferWords * 4;
+        return true;
+    }
+    bool setBitsPerSample(int bps) override {
+        return bps == 16;
+    }
+    bool setFrequency(int freq) override {
+        frequency = freq;
+        return true;
+    }
+    bool setStereo(bool stereo = true) override {
+        return stereo;
+    }
+    bool begin() override {
+        return true;
+    }
+    bool end() override {
+        return true;
+    }
+    bool getUnderflow() override {
+        return false;
+    }
+    void onTransmit(void (*cb)(void *), void *cbData) override {
+        _cb = cb;
+        _cbData = cbData;
+    }
+    size_t write(const uint8_t *buffer, size_t size) override {
+        (void) buffer;
+        size = std::min(size, _avail) & ~3;
+        samples += size / 4;
+        _avail -= size;
+        return size;
+    }
+    int availableForWrite() override {
+        return _avail;
+    }
+    void pump() {
+        _avail = _blockBytes;
+        _cb(_cbData);
+    }
+
+    size_t samples = 0;
+    int frequency = 0;
+
+private:
+    size_t _blockBytes = 0;
+    size_t _avail = 0;
+    void (*_cb)(void *) = nullptr;
+    void *_cbData = nullptr;
+};
+
+template<class Player>
+static void measure(Stream *in) {
+    CountOutput out;
+    Player p(out);
+    p.write(in->data.data(), in->data.size());
+    p.begin();
+    for (size_t i = 0; !p.done() && (i < 1000000); i++) {
+        out.pump();
+    }
+    p.end();
+    in->frequency = out.frequency;
+    in->seconds = (double) out.samples / out.frequency;
+}
+
+static bool loadStream(const Scenario &s, Stream *in) {
+    in->he = false;
+    if (s.input == "mp3") {
+        in->format = MP3;
+        in->data.assign(mp3, mp3 + sizeof(mp3));
+    } else if (s.input == "aac") {
+        in->format = AAC;
+        in->data.assign(aac, aac + sizeof(aac));
+    } else if (s.input == "he-aac") {
+        in->format = AAC;
+        in->he = true;
+        in->data.assign(aache, aache + sizeof(aache));
+    } else if (s.input == "piano") {
+        in->format = AAC;
+        in->data.assign(piano_aac, piano_aac + sizeof(piano_aac));
+    } else if (s.input == "beep") {
+        in->format = WAV;
+        in->data.assign(beepwav, beepwav + sizeof(beepwav));
+    } else {
+        const char *ext = strrchr(s.input.c_str(), '.');
+        FILE *f = fopen(s.input.c_str(), "rb");
+        if (!ext || !f || (strcasecmp(ext, ".mp3") && strcasecmp(ext, ".aac") && strcasecmp(ext, ".wav"))) {
+            fprintf(stderr, "ERROR: Can't use input '%s'\n", s.input.c_str());
+            if (f) {
+                fclose(f);
+            }
+            return false;
+        }
+        in->format = !strcasecmp(ext, ".mp3") ? MP3 : !strcasecmp(ext, ".aac") ? AAC : WAV;
+        uint8_t buff[4096];
+        size_t n;
+        while ((n = fread(buff, 1, sizeof(buff), f)) > 0) {
+            in->data.insert(in->data.end(), buff, buff + n);
+        }
+        fclose(f);
+    }
+    in->label = s.input;
+
+    switch (in->format) {
+    case MP3: measure<ROMBackgroundAudioMP3>(in); break;
+    case AAC: measure<ROMBackgroundAudioAAC>(in); break;
+    case WAV: measure<ROMBackgroundAudioWAV>(in); break;
+    }
+    if ((in->seconds <= 0) || !in->frequency) {
+        fprintf(stderr, "ERROR: '%s' doesn't decode\n", s.input.c_str());
+        return false;
+    }
+    in->byteRate = in->data.size() / in->seconds;
+    // MP3 and ADTS AAC streams can simply be concatenated, WAVs would need their header removed
+    if (in->format != WAV) {
+        size_t once = in->data.size();
+        for (double t = in->seconds; t < s.duration; t += once / in->byteRate) {
+            in->data.insert(in->data.end(), in->data.begin(), in->data.begin() + once);
+        }
+        in->seconds = in->data.size() / in->byteRate;
+    }
+    return true;
+}
+
+static bool parseScenario(const std::vector<std::string> &args, Scenario *s) {
+    for (auto &a : args) {
+        size_t eq = a.find('=');
+        if (eq == std::string::npos) {
+            fprintf(stderr, "ERROR: Expected key=value, got '%s'\n", a.c_str());
+            return false;
+        }
+        std::string k = a.substr(0, eq), v = a.substr(eq + 1);
+        double d = atof(v.c_str());
+        if (k == "name") {
+            s->name = v;
+        } else if (k == "input") {
+            s->input = v;
+        } else if (k == "cpu" && ((v == "pico") || (v == "pico2"))) {
+            s->cpu = v;
+        } else if (k == "rate") {
+            s->rate = d;
+            s->rateIsMultiple = v.back() == 'x';
+        } else if (k == "seed") {
+            s->seed = (uint32_t) strtoul(v.c_str(), nullptr, 0);
+        } else if (k == "duration") {
+            s->duration = d;
+        } else if (k == "mhz") {
+            s->mhz = d;
+        } else if (k == "cycles") {
+            s->cycles = d;
+        } else if (k == "measure") {
+            s->measure = d;
+        } else if (k == "burst") {
+            s->burst = std::max(1.0, d);
+        } else if (k == "window") {
+            s->window = d;
+        } else if (k == "stall") {
+            s->stall = d;
+        } else if (k == "every") {
+            s->every = std::max(1.0, d);
+        } else if (k == "jitter") {
+            s->jitter = d;
+        } else if (k == "loop") {
+            s->loop = std::max(0.01, d);
+        } else if (k == "prebuffer") {
+            s->prebuffer = std::min(100.0, std::max(0.0, d));
+        } else {
+            fprintf(stderr, "ERROR: Unknown setting '%s'\n", a.c_str());
+            return false;
+        }
+    }
+    if (s->rate <= 0) {
+        fprintf(stderr, "ERROR: Scenario '%s' needs a positive rate\n", s->name.c_str());
+        return false;
+    }
+    return true;
+}
+
+static std::vector<std::string> split(const std::string &line) {
+    std::vector<std::string> ret;
+    std::string tok;
+    for (char c : line.substr(0, line.find('#')) + " ") {
+        if (isspace((unsigned char)c)) {
+            if (tok.size()) {
+                ret.push_back(tok);
+            }
+            tok.clear();
+        } else {
+            tok += c;
+        }
+    }
+    return ret;
+}
+
+// RawDataBuffer's size is a template parameter, so only these can be simulated
+typedef std::integer_sequence<size_t, 1024, 2048, 4096, 8192, 16384, 32768, 65536> Sizes;
+
+template<size_t... N>
+static std::vector<size_t> sizeList(std::index_sequence<N...>) {
+    return { N... };
+}
+
+static bool runScenario(const Scenario &s, const std::vector<size_t> &sizes) {
+    Stream in;
+    if (!loadStream(s, &in)) {
+        return false;
+    }
+    std::vector<Result> res;
+    switch (in.format) {
+    case MP3: res = sweep<BackgroundAudioMP3Class>(s, in, sizes, Sizes()); break;
+    case AAC: res = sweep<BackgroundAudioAACClass>(s, in, sizes, Sizes()); break;
+    case WAV: res = sweep<BackgroundAudioWAVClass>(s, in, sizes, Sizes()); break;
+    }
+
+    double rate = s.rateIsMultiple ? s.rate * in.byteRate : s.rate;
+    printf("Scenario '%s': %s, %d Hz, %.0f kbit/s, %.1f s\n", s.name.c_str(), in.label.c_str(), in.frequency,
+           in.byteRate * 8 / 1000, in.seconds);
+    printf("  Feeder %.0f bytes/s (%.2fx) in %.0f byte bursts, %.0f byte window, ", rate, rate / in.byteRate, s.burst,
+           std::max(s.window, s.burst));
+    if (s.stall > 0) {
+        printf("%.0f ms stalls every ~%.0f ms, ", s.stall, s.every);
+    } else {
+        printf("no stalls, ");
+    }
+    printf("loop() every %g ms, %.0f%% prebuffer\n", s.loop, s.prebuffer);
+    if (s.measure) {
+        printf("  Decode cost measured on this PC x%g, DMA IRQ jitter up to %.0f us\n", s.measure, s.jitter);
+    } else {
+        printf("  Decode cost modeled for %s%s, DMA IRQ jitter up to %.0f us\n", s.cpu.c_str(),
+               s.mhz || s.cycles ? " (overridden)" : "", s.jitter);
+    }
+    printf("  %13s %6s %10s %9s %11s %12s\n", "RawDataBuffer", "CPU", "underflows", "dropouts", "min output", "min input");
+    const Result *best = nullptr;
+    for (auto &r : res) {
+        char minIn[32];
+        if (r.minInput == (size_t) -1) {
+            snprintf(minIn, sizeof(minIn), "-");
+        } else {
+            snprintf(minIn, sizeof(minIn), "%.0f ms", r.minInput / in.byteRate * 1000);
+        }
+        printf("  %13zu %5.1f%% %10u %9u %8.1f ms %12s%s\n", r.size, r.load * 100, r.underflows, r.dropouts,
+               r.minOutput == 1e300 ? 0 : r.minOutput / 1000, minIn, r.finished ? "" : "  (didn't finish)");
+        if (!best && r.finished && !r.underflows && !r.dropouts) {
+            best = &r;
+        }
+    }
+    if (best) {
+        printf("  Recommended: RawDataBuffer<%zu>\n\n", best->size);
+    } else {
+        printf("  Recommended: none of these sizes play cleanly, the feeder or CPU can't keep up\n\n");
+    }
+    return true;
+}
+
+int main(int argc, char **argv) {
+    std::vector<size_t> sizes = { 2048, 4096, 8192, 16384, 32768, 65536 };
+    std::vector<size_t> valid = sizeList(Sizes());
+    std::vector<std::string> args;
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "--sizes") && (i + 1 < argc)) {
+            sizes.clear();
+            for (char *p = argv[++i]; *p;) {
+                sizes.push_back(strtoul(p, &p, 0));
+                if (std::find(valid.begin(), valid.end(), sizes.back()) == valid.end()) {
+                    fprintf(stderr, "ERROR: Sizes must be powers of 2 from 1024 to 65536\n");
+                    return 1;
+                }
+                p += *p == ',';
+            }
+        } else {
+            args.push_back(argv[i]);
+        }
+    }
+
+    std::vector<Scenario> scenarios;
+    std::vector<std::vector<std::string>> lines;
+    if (args.size() == 1 && args[0].find('=') == std::string::npos) {
+        FILE *f = fopen(args[0].c_str(), "r");
+        if (!f) {
+            fprintf(stderr, "ERROR: Can't open '%s'\n", args[0].c_str());
+            return 1;
+        }
+        char line[1024];
+        while (fgets(line, sizeof(line), f)) {
+            auto toks = split(line);
+            if (toks.size()) {
+                lines.push_back(toks);
+            }
+        }
+        fclose(f);
+    } else if (args.size()) {
+        lines.push_back(args);
+    } else {
+        lines = {
+            split("name=steady input=mp3 rate=1.5x"),
+            split("name=wifi input=mp3 rate=1.5x burst=2920 stall=300 every=3000 jitter=200"),
+            split("name=sdcard input=aac rate=20x burst=512 stall=80 every=1000"),
+            split("name=radio input=he-aac cpu=pico2 rate=1.2x stall=1000 every=10000 jitter=200"),
+        };
+    }
+    for (auto &l : lines) {
+        Scenario s;
+        if (!parseScenario(l, &s)) {
+            return 1;
+        }
+        scenarios.push_back(s);
+    }
+
+    for (auto &s : scenarios) {
+        if (!runScenario(s, sizes)) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+extern "C" int espeak_ng_CompileDictionary(...) {
+    return 0; // Dictionaries are precompiled, this is never called
+}
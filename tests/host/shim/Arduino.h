@@ -0,0 +1,235 @@
+// Just enough of the Arduino and Pico SDK APIs to build and run BackgroundAudio on a PC.
+//
+// Time is simulated.  It only moves forward when `delay` or `host::advance` is called, and as it does
+// every registered `host::Device` (i.e. `WAVAudioOutput`) plays out its buffers and fires its
+// `onTransmit` callbacks.  The RP2040 work IRQs the players use are emulated as well, so the same
+// code paths run here as on the Pico.  The C decoders only need the includes.
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <strings.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <math.h>
+#include <assert.h>
+#include <time.h>
+#include <pgmspace.h>
+
+#define __not_in_flash_func(f) f
+
+#ifdef __cplusplus
+#include <algorithm>
+#include <string>
+#include <vector>
+
+typedef unsigned int uint;
+
+// Only one thread ever runs, so locks have nothing to do
+typedef struct {
+    int unused;
+} mutex_t;
+
+static inline void mutex_init(mutex_t *m) {
+    (void) m;
+}
+
+static inline void mutex_enter_blocking(mutex_t *m) {
+    (void) m;
+}
+
+static inline void mutex_exit(mutex_t *m) {
+    (void) m;
+}
+
+namespace host {
+
+/**
+    @brief Anything which needs to do work as simulated time passes
+*/
+class Device {
+public:
+    virtual ~Device() { }
+    /** Run until the simulated time `now`, in microseconds */
+    virtual void advanceTo(uint64_t now) = 0;
+};
+
+inline uint64_t now = 0;              // Simulated time in microseconds
+inline std::vector<Device *> devices;
+
+inline void addDevice(Device *d) {
+    devices.push_back(d);
+}
+
+inline void removeDevice(Device *d) {
+    devices.erase(std::remove(devices.begin(), devices.end(), d), devices.end());
+}
+
+// Emulated RP2040 user IRQs.  A pending IRQ runs as soon as nothing is masking it, the same as a
+// low priority interrupt which can't preempt the DMA callback that raised it.
+static constexpr int numIRQs = 32;
+inline void (*irqHandler[numIRQs])() = {};
+inline uint32_t irqEnabled = 0;
+inline uint32_t irqPending = 0;
+inline uint32_t irqClaimed = 0;
+inline int irqDepth = 0;              // Nonzero while noInterrupts or a callback is in progress
+inline int irqCurrent = -1;
+
+inline void runPendingIRQs() {
+    while (!irqDepth && (irqPending & irqEnabled)) {
+        int irq = __builtin_ctz(irqPending & irqEnabled);
+        irqPending &= ~(1u << irq);
+        irqDepth++;
+        irqCurrent = irq;
+        irqHandler[irq]();
+        irqCurrent = -1;
+        irqDepth--;
+    }
+}
+
+/**
+    @brief Move simulated time forward, letting every device play and call back along the way
+*/
+inline void advance(uint64_t us) {
+    uint64_t end = now + us;
+    for (auto d : devices) {
+        d->advanceTo(end);
+    }
+    now = end;
+}
+
+} // namespace host
+
+static inline void noInterrupts() {
+    host::irqDepth++;
+}
+
+static inline void interrupts() {
+    host::irqDepth--;
+    host::runPendingIRQs();
+}
+
+#define NUM_USER_IRQS 6
+#define FIRST_USER_IRQ 26
+#define VTABLE_FIRST_IRQ 16
+
+static inline uint user_irq_claim_unused(bool required) {
+    for (uint irq = FIRST_USER_IRQ; irq < FIRST_USER_IRQ + NUM_USER_IRQS; irq++) {
+        if (!(host::irqClaimed & (1u << irq))) {
+            host::irqClaimed |= 1u << irq;
+            return irq;
+        }
+    }
+    assert(!required);
+    return (uint) -1;
+}
+
+static inline void user_irq_unclaim(uint irq) {
+    host::irqClaimed &= ~(1u << irq);
+    host::irqPending &= ~(1u << irq);
+}
+
+static inline void irq_set_exclusive_handler(uint irq, void (*handler)()) {
+    host::irqHandler[irq] = handler;
+}
+
+static inline void irq_set_priority(uint irq, uint8_t prio) {
+    (void) irq;
+    (void) prio;
+}
+
+static inline void irq_set_enabled(uint irq, bool enabled) {
+    if (enabled) {
+        host::irqEnabled |= 1u << irq;
+    } else {
+        host::irqEnabled &= ~(1u << irq);
+    }
+}
+
+static inline void irq_set_pending(uint irq) {
+    host::irqPending |= 1u << irq;
+    host::runPendingIRQs();
+}
+
+static inline void irq_clear(uint irq) {
+    host::irqPending &= ~(1u << irq);
+}
+
+static inline uint __get_current_exception() {
+    return (host::irqCurrent < 0) ? 0 : VTABLE_FIRST_IRQ + host::irqCurrent;
+}
+
+// A single core runs everything
+#define NUM_CORES 1
+
+static inline uint get_core_num() {
+    return 0;
+}
+
+static inline unsigned long micros() {
+    return (unsigned long) host::now;
+}
+
+static inline unsigned long millis() {
+    return (unsigned long)(host::now / 1000);
+}
+
+static inline void delayMicroseconds(unsigned int us) {
+    host::advance(us);
+}
+
+static inline void delay(unsigned long ms) {
+    host::advance((uint64_t) ms * 1000);
+}
+
+static inline void yield() {
+}
+
+// Waiting for an event lets simulated time pass, so the interrupt that would end the wait can happen
+static inline void __wfe() {
+    host::advance(100);
+}
+
+static inline void __sev() {
+}
+
+// The real CPU's time, unlike micros(), so cycle counts are nanoseconds at a pretend 1GHz
+class RP2040 {
+public:
+    uint64_t getCycleCount64() {
+        struct timespec ts;
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        return ts.tv_sec * 1000000000ull + ts.tv_nsec;
+    }
+    uint32_t getCycleCount() {
+        return (uint32_t) getCycleCount64();
+    }
+    uint32_t f_cpu() {
+        return 1000000000;
+    }
+};
+inline RP2040 rp2040;
+
+class String {
+public:
+    String(const char *s = "") : _s(s) { }
+    const char *c_str() const {
+        return _s.c_str();
+    }
+    size_t length() const {
+        return _s.length();
+    }
+private:
+    std::string _s;
+};
+
+class Print {
+public:
+    virtual ~Print() { }
+    virtual size_t write(const uint8_t *buffer, size_t size) = 0;
+    virtual int availableForWrite() {
+        return 0;
+    }
+};
+
+#endif // __cplusplus
@@ -0,0 +1,179 @@
+// speechcachetest - Earle F. Philhower, III <earlephilhower@yahoo.com>
+// Released to the public domain 2025
+//
+// Checks the speech phrase cache (src/BackgroundAudioSpeechCache.h).  A repeated phrase is played from the
+// cache, and what it plays is exactly the IMA-ADPCM encoding of what was synthesized the first time, decoded.
+// When a small cache fills, the least recently used phrase is the one dropped, counting a hit as a use.  A
+// phrase too large for the whole cache is still spoken, synthesized each time exactly as with no cache at all.
+//
+//     speechcachetest
+
+#include <Arduino.h>
+#include "WAVAudioOutput.h"
+#include <BackgroundAudioSpeech.h>
+#include VOICE_HEADER
+#include <sys/wait.h>
+#include <unistd.h>
+
+static int failed = 0;
+
+static void check(bool ok, const char *what) {
+    printf("%-60s %s\n", what, ok ? "OK" : "FAIL");
+    failed += ok ? 0 : 1;
+}
+
+// Speak a string and let it play out, returning the left channel of everything played meanwhile
+static std::vector<int16_t> say(BackgroundAudioSpeech &sp, WAVAudioOutput &out, const char *text) {
+    size_t from = out.samples().size();
+    sp.speak(text);
+    while (!sp.done()) {
+        delay(1);
+    }
+    delay(500); // The output buffers hold about a quarter second of speech
+    std::vector<int16_t> left;
+    for (size_t i = from; i < out.samples().size(); i += 2) {
+        left.push_back(out.samples()[i]);
+    }
+    return left;
+}
+
+// The phrase itself, without the silence played around it
+static std::vector<int16_t> trim(const std::vector<int16_t> &s) {
+    size_t b = 0, e = s.size();
+    while ((b < e) && !s[b]) {
+        b++;
+    }
+    while ((e > b) && !s[e - 1]) {
+        e--;
+    }
+    return std::vector<int16_t>(s.begin() + b, s.begin() + e);
+}
+
+static bool contains(const std::vector<int16_t> &s, const std::vector<int16_t> &what) {
+    return std::search(s.begin(), s.end(), what.begin(), what.end()) != s.end();
+}
+
+static void testHit() {
+    WAVAudioOutput out;
+    BackgroundAudioSpeechCache cache(32768);
+    BackgroundAudioSpeech sp(out);
+    sp.setVoice(VOICE);
+    sp.setCache(&cache);
+    sp.begin();
+    std::vector<int16_t> synth = trim(say(sp, out, "Hello there."));
+    check((cache.misses() == 1) && (cache.hits() == 0) && (cache.phrases() == 1), "first time synthesized and recorded");
+
+    // Leading silence leaves the codec's state alone, so coding from the first sound matches the recording
+    IMAADPCMEncoder enc;
+    IMAADPCMDecoder dec;
+    std::vector<int16_t> expect;
+    for (int16_t s : synth) {
+        expect.push_back(dec.decode(enc.encode(s)));
+    }
+    std::vector<int16_t> hit = say(sp, out, "Hello there.");
+    check(cache.hits() == 1, "second time played from the cache");
+    check(!synth.empty() && contains(hit, expect), "hit replays the recorded ADPCM bit for bit");
+    check(trim(say(sp, out, "Hello there.")) == trim(hit), "every hit plays the same");
+    check(!out.getUnderflow() && !sp.underflows(), "no underflows");
+    sp.end();
+}
+
+static void testEviction() {
+    // Each of these is 14 or 15 blocks of ADPCM, so three fit in 48 blocks but a fourth doesn't
+    WAVAudioOutput out;
+    BackgroundAudioSpeechCache cache(48 * BackgroundAudioSpeechCache::blockBytes);
+    BackgroundAudioSpeech sp(out);
+    sp.setVoice(VOICE);
+    sp.setCache(&cache);
+    sp.begin();
+    say(sp, out, "One.");
+    say(sp, out, "Two.");
+    say(sp, out, "Red.");
+    check((cache.phrases() == 3) && !cache.evictions(), "three phrases fit");
+    say(sp, out, "One."); // Now "Two." is the least recently used
+    say(sp, out, "Blue.");
+    check((cache.phrases() == 3) && (cache.evictions() == 1), "fourth phrase evicted one");
+    uint32_t hits = cache.hits();
+    say(sp, out, "Red.");
+    say(sp, out, "One.");
+    check(cache.hits() == hits + 2, "recently used phrases kept");
+    uint32_t misses = cache.misses();
+    say(sp, out, "Two.");
+    check(cache.misses() == misses + 1, "least recently used phrase was dropped");
+    say(sp, out, "Red.");
+    say(sp, out, "One.");
+    check(cache.hits() == hits + 4, "re-recording it evicted the next oldest");
+    misses = cache.misses();
+    say(sp, out, "Blue.");
+    check(cache.misses() == misses + 1, "which was the one not used since");
+    sp.end();
+}
+
+// ESpeak-NG's wave generator carries its state from one utterance to the next, so the same text only comes
+// out the same given the same history.  Synthesize with no cache in a child, from the state the parent has now.
+static std::vector<int16_t> uncached(const char *text, int times) {
+    int fd[2];
+    if (pipe(fd)) {
+        return {};
+    }
+    if (!fork()) {
+        close(fd[0]);
+        WAVAudioOutput out;
+        BackgroundAudioSpeech sp(out);
+        sp.setVoice(VOICE);
+        sp.begin();
+        std::vector<int16_t> s;
+        while (times--) {
+            std::vector<int16_t> t = trim(say(sp, out, text));
+            s.insert(s.end(), t.begin(), t.end());
+        }
+        sp.end();
+        size_t ok = write(fd[1], s.data(), s.size() * sizeof(int16_t));
+        _exit(ok == s.size() * sizeof(int16_t) ? 0 : 1);
+    }
+    close(fd[1]);
+    std::vector<int16_t> s;
+    int16_t buf[1024];
+    ssize_t n;
+    while ((n = read(fd[0], buf, sizeof(buf))) > 0) {
+        s.insert(s.end(), buf, buf + n / sizeof(int16_t));
+    }
+    close(fd[0]);
+    wait(nullptr);
+    return s;
+}
+
+static void testTooLarge() {
+    static const char *text = "The rain in Spain stays mainly in the plain, or so they say in the song.";
+    std::vector<int16_t> ref = uncached(text, 2);
+
+    // About 40KB of ADPCM, into 8KB
+    WAVAudioOutput out;
+    BackgroundAudioSpeechCache cache(8192);
+    BackgroundAudioSpeech sp(out);
+    sp.setVoice(VOICE);
+    sp.setCache(&cache);
+    sp.begin();
+    std::vector<int16_t> both = trim(say(sp, out, text));
+    std::vector<int16_t> second = trim(say(sp, out, text));
+    both.insert(both.end(), second.begin(), second.end());
+    check(!cache.hits() && (cache.misses() == 2) && !cache.phrases(), "phrase larger than the cache never stored");
+    check(!ref.empty() && (both == ref), "and is synthesized as without a cache");
+    say(sp, out, "Two.");
+    say(sp, out, "Two.");
+    check(cache.hits() == 1, "cache still works afterwards");
+    check(!out.getUnderflow() && !sp.underflows(), "no underflows");
+    sp.end();
+}
+
+int main() {
+    testHit();
+    testEviction();
+    testTooLarge();
+    printf("%s\n", failed ? "FAILED" : "PASSED");
+    return failed ? 1 : 0;
+}
+
+extern "C" int espeak_ng_CompileDictionary(...) {
+    return 0; // Dictionaries are precompiled, this is never called
+}
@@ -0,0 +1,145 @@
+// speechcontexttest - Earle F. Philhower, III <earlephilhower@yahoo.com>
+// Released to the public domain 2025
+//
+// Checks that two speakers talking over each other (src/BackgroundAudioSpeech.h), each in its own ESpeak-NG context,
+// say exactly what each would have said alone.  The two are refilled alternately by their outputs so their contexts
+// are switched back and forth throughout.  Part way through the app changes one speaker's rate, and the other's pump
+// interrupts it in the middle.  Each one's output must match, bit for bit, the same speaker run on its own from the
+// same starting state.
+//
+//     speechcontexttest
+
+#include <Arduino.h>
+#include "WAVAudioOutput.h"
+#include <BackgroundAudioSpeech.h>
+#include VOICE_HEADER
+#include <sys/wait.h>
+#include <unistd.h>
+
+static int failed = 0;
+
+static void check(bool ok, const char *what) {
+    printf("%-60s %s\n", what, ok ? "OK" : "FAIL");
+    failed += ok ? 0 : 1;
+}
+
+static const char *textA = "The quick brown fox jumps over the lazy dog, twice.";
+static const char *textB = "Seven hundred and forty two kilometres, at half past three.";
+
+// Start a speaker with its own settings
+static void start(BackgroundAudioSpeech &sp, bool a) {
+    sp.setVoice(VOICE);
+    sp.begin();
+    sp.setPitch(a ? 30 : 70);
+    sp.setRate(a ? 190 : 140);
+}
+
+// Speaker A is slowed down once it has played a second, while B is still speaking.  In the duet B's output is
+// made to call for more while interrupts are masked, and the work IRQ is left pending as they're unmasked, so B's
+// pump runs inside `setRate` just after it has switched to A's context, as a real IRQ could
+static void slowDown(BackgroundAudioSpeech &sp, WAVAudioOutput &out, WAVAudioOutput *other) {
+    static bool done = false;
+    if (!done && (out.samples().size() >= 2 * 22050)) {
+        if (other) {
+            noInterrupts();
+            other->advanceTo(host::now + 100000);
+            host::irqDepth--;
+        }
+        sp.setRate(120);
+        done = true;
+    }
+}
+
+static std::vector<int16_t> left(const WAVAudioOutput &out) {
+    std::vector<int16_t> s;
+    for (size_t i = 0; i < out.samples().size(); i += 2) {
+        s.push_back(out.samples()[i]);
+    }
+    return s;
+}
+
+// Run one speaker alone in a child, from the ESpeak-NG state the parent has now
+static std::vector<int16_t> solo(bool a) {
+    int fd[2];
+    if (pipe(fd)) {
+        return {};
+    }
+    if (!fork()) {
+        close(fd[0]);
+        WAVAudioOutput out;
+        BackgroundAudioSpeech sp(out);
+        start(sp, a);
+        sp.speak(a ? textA : textB);
+        while (!sp.done()) {
+            if (a) {
+                slowDown(sp, out, nullptr);
+            }
+            delay(1);
+        }
+        delay(500); // The output buffers hold about a quarter second of speech
+        sp.end();
+        std::vector<int16_t> s = left(out);
+        size_t ok = write(fd[1], s.data(), s.size() * sizeof(int16_t));
+        _exit(ok == s.size() * sizeof(int16_t) ? 0 : 1);
+    }
+    close(fd[1]);
+    std::vector<int16_t> s;
+    int16_t buf[1024];
+    ssize_t n;
+    while ((n = read(fd[0], buf, sizeof(buf))) > 0) {
+        s.insert(s.end(), buf, buf + n / sizeof(int16_t));
+    }
+    close(fd[0]);
+    wait(nullptr);
+    return s;
+}
+
+// The speech itself, without the silence played around it
+static std::vector<int16_t> trim(const std::vector<int16_t> &s, size_t *start = nullptr) {
+    size_t b = 0, e = s.size();
+    while ((b < e) && !s[b]) {
+        b++;
+    }
+    while ((e > b) && !s[e - 1]) {
+        e--;
+    }
+    if (start) {
+        *start = b;
+    }
+    return std::vector<int16_t>(s.begin() + b, s.begin() + e);
+}
+
+int main() {
+    // Nothing has been spoken yet, so the children and the duet all start from ESpeak-NG's initial state
+    std::vector<int16_t> soloA = trim(solo(true));
+    std::vector<int16_t> soloB = trim(solo(false));
+
+    WAVAudioOutput outA, outB;
+    BackgroundAudioSpeech a(outA), b(outB);
+    start(a, true);
+    start(b, false);
+    a.speak(textA);
+    b.speak(textB);
+    while (!a.done() || !b.done()) {
+        slowDown(a, outA, &outB);
+        delay(1);
+    }
+    delay(500);
+    size_t startA, startB;
+    std::vector<int16_t> duetA = trim(left(outA), &startA);
+    std::vector<int16_t> duetB = trim(left(outB), &startB);
+    a.end();
+    b.end();
+
+    check(!soloA.empty() && !soloB.empty(), "both speakers spoke on their own");
+    check((startA < startB + duetB.size()) && (startB < startA + duetA.size()), "the two spoke over each other");
+    check(duetA == soloA, "first speaker's duet matches it speaking alone");
+    check(duetB == soloB, "second speaker's duet matches it speaking alone");
+    check(!outA.getUnderflow() && !outB.getUnderflow(), "no underflows");
+    printf("%s\n", failed ? "FAILED" : "PASSED");
+    return failed ? 1 : 0;
+}
+
+extern "C" int espeak_ng_CompileDictionary(...) {
+    return 0; // Dictionaries are precompiled, this is never called
+}
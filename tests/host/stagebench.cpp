@@ -0,0 +1,32 @@
+// stagebench - Earle F. Philhower, III <earlephilhower@yahoo.com>
+// Released to the public domain 2025
+//
+// Host build of the examples/SpeedTest stage benchmark.  Writes the JSON results to stdout (or a file)
+// for tests/host/benchcheck.py to compare against a baseline:
+//     stagebench [repeats] [output.json]
+
+#include <Arduino.h>
+#include VOICE_HEADER
+#define STAGEBENCH_VOICE VOICE
+#include <StageBench.h>
+
+static FILE *json;
+
+static void emit(const char *s) {
+    fputs(s, json);
+}
+
+int main(int argc, char **argv) {
+    int repeats = argc > 1 ? atoi(argv[1]) : 5;
+    json = argc > 2 ? fopen(argv[2], "w") : stdout;
+    if (!json || (repeats < 1)) {
+        fprintf(stderr, "Usage: stagebench [repeats] [output.json]\n");
+        return 1;
+    }
+    stageBench(emit, repeats);
+    return fclose(json) ? 1 : 0;
+}
+
+extern "C" int espeak_ng_CompileDictionary(...) {
+    return 0; // Dictionaries are precompiled, this is never called
+}
@@ -0,0 +1,191 @@
+// wavegentest - Earle F. Philhower, III <earlephilhower@yahoo.com>
+// Released to the public domain 2025
+//
+// Checks the fixed-point breath resonators in ESpeak-NG's wave generator (src/libespeak-ng/wavegen.c)
+// against the double precision filter they replaced, over a grid of formant frequencies and breath
+// widths at the 22050Hz speech rate.  The coefficients must agree to within 2 parts in 10^6 anywhere up to
+// Nyquist.  An impulse, a sweep from DC to Nyquist, and the breath noise itself (gliding the formant every 64
+// samples, as SetBreath does) must each come out within 2 LSB of the double filter, plus 1 part in 10^4 of
+// its peak for the narrow, high gain resonators.  The filters are run at the 200Hz-8kHz the breath formants
+// follow F1-F8 over: a narrow formant within a kHz or so of Nyquist has too much gain for the state, and one
+// below 100Hz amplifies its rounding past the allowance.  Also prints the TSC cycles per sample of each
+// filter on this machine.
+//
+//     wavegentest
+
+#include "libespeak-ng/wavegen.c" // For the static resonator code
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+static int failed = 0;
+
+static void check(bool ok, const char *what)
+{
+	printf("%-60s %s\n", what, ok ? "OK" : "FAIL");
+	failed += ok ? 0 : 1;
+}
+
+// The double precision resonator wavegen.c used before, for reference
+typedef struct {
+	double a;
+	double b;
+	double c;
+	double x1;
+	double x2;
+} REF_RESONATOR;
+
+static void ref_setresonator(REF_RESONATOR *rp, int freq, int bwidth, int init)
+{
+	double x;
+
+	if (init) {
+		rp->x1 = 0;
+		rp->x2 = 0;
+	}
+	x = exp(-M_PI / samplerate * bwidth);
+	rp->c = -(x * x);
+	rp->b = x * cos(2.0 * M_PI / samplerate * freq) * 2.0;
+	rp->a = 1.0 - rp->b - rp->c;
+}
+
+static double ref_resonator(REF_RESONATOR *r, double input)
+{
+	double x;
+
+	x = r->a * input + r->b * r->x1 + r->c * r->x2;
+	r->x2 = r->x1;
+	r->x1 = x;
+	return x;
+}
+
+#define N_SAMPLES 22050
+
+enum { IMPULSE, SWEEP, NOISE };
+
+static int input(int kind, int i)
+{
+	switch (kind)
+	{
+	case IMPULSE:
+		return (i == 0) ? 0x1fff : 0;
+	case SWEEP:
+		// Linear chirp from DC to Nyquist over the block
+		return (int)(0x1fff * sin(M_PI / 2 * i * (double)i / N_SAMPLES));
+	default:
+		return espeak_rand(-0x2000, 0x1fff); // As ApplyBreath makes
+	}
+}
+
+// Worst error of the fixed-point filter against the double one, over its allowance
+static double run(int kind, int freq, int bwidth)
+{
+	RESONATOR r;
+	REF_RESONATOR ref;
+	double worst = 0, peak = 0, err[N_SAMPLES];
+
+	setresonator(&r, freq, bwidth, 1);
+	ref_setresonator(&ref, freq, bwidth, 1);
+	for (int i = 0; i < N_SAMPLES; i++) {
+		if ((kind == NOISE) && !(i & 63)) {
+			// Glide down by a quarter over the block, the way the formants move while speaking
+			int f = freq - (freq * i) / (4 * N_SAMPLES);
+			setresonator(&r, f, bwidth, 0);
+			ref_setresonator(&ref, f, bwidth, 0);
+		}
+		int x = input(kind, i);
+		double want = ref_resonator(&ref, x);
+		err[i] = fabs(resonator(&r, x) - want);
+		peak = fmax(peak, fabs(want));
+	}
+	for (int i = 0; i < N_SAMPLES; i++)
+		worst = fmax(worst, err[i] / (2 + peak / 10000));
+	return worst;
+}
+
+static void testCoefficients(void)
+{
+	double worst = 0;
+	char msg[80];
+
+	for (int freq = 0; freq < samplerate / 2; freq += 25) {
+		for (int bwidth = 25; bwidth <= 4000; bwidth += 25) {
+			RESONATOR r;
+			REF_RESONATOR ref;
+			setresonator(&r, freq, bwidth, 1);
+			ref_setresonator(&ref, freq, bwidth, 1);
+			worst = fmax(worst, fabs(r.a / 268435456.0 - ref.a));
+			worst = fmax(worst, fabs(r.b / 268435456.0 - ref.b));
+			worst = fmax(worst, fabs(r.c / 268435456.0 - ref.c));
+		}
+	}
+	snprintf(msg, sizeof(msg), "coefficients match double (worst %.1e)", worst);
+	check(worst <= 2e-6, msg);
+}
+
+static void testAccuracy(int kind, const char *name)
+{
+	static const int freqs[] = { 200, 300, 500, 800, 1200, 2000, 3500, 5000, 6500, 8000 };
+	static const int widths[] = { 50, 100, 200, 400, 600, 1000, 3000 };
+	double worst = 0;
+	char msg[80];
+
+	for (size_t f = 0; f < sizeof(freqs) / sizeof(freqs[0]); f++) {
+		for (size_t w = 0; w < sizeof(widths) / sizeof(widths[0]); w++)
+			worst = fmax(worst, run(kind, freqs[f], widths[w]));
+	}
+	snprintf(msg, sizeof(msg), "%s response matches double (%.0f%% of allowance)", name, worst * 100);
+	check(worst <= 1.0, msg);
+}
+
+static uint64_t ticks(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+	return __rdtsc();
+#else
+	return 0;
+#endif
+}
+
+static void timing(void)
+{
+	// The breath noise through a 2kHz, 200Hz wide formant, as InitBreath sets up
+	static int in[N_SAMPLES];
+	RESONATOR r;
+	REF_RESONATOR ref;
+	volatile int sink = 0;
+	volatile double dsink = 0;
+	uint64_t t0, t1, t2;
+
+	for (int i = 0; i < N_SAMPLES; i++)
+		in[i] = input(NOISE, i);
+	setresonator(&r, 2000, 200, 1);
+	ref_setresonator(&ref, 2000, 200, 1);
+	t0 = ticks();
+	for (int i = 0; i < N_SAMPLES; i++)
+		sink += resonator(&r, in[i]);
+	t1 = ticks();
+	for (int i = 0; i < N_SAMPLES; i++)
+		dsink += ref_resonator(&ref, in[i]);
+	t2 = ticks();
+	if (t2 > t0)
+		printf("resonator TSC cycles/sample on this host: fixed %.1f, double %.1f\n", (double)(t1 - t0) / N_SAMPLES, (double)(t2 - t1) / N_SAMPLES);
+}
+
+int main(void)
+{
+	samplerate = 22050;
+	testCoefficients();
+	testAccuracy(IMPULSE, "impulse");
+	testAccuracy(SWEEP, "sweep");
+	testAccuracy(NOISE, "breath noise");
+	timing();
+	printf("%s\n", failed ? "FAILED" : "PASSED");
+	return failed ? 1 : 0;
+}
+
+espeak_ng_STATUS espeak_ng_CompileDictionary(const char *dsource, const char *dict_name, FILE *log, int flags, espeak_ng_ERROR_CONTEXT *context)
+{
+	return 0; // Dictionaries are precompiled, this is never called
+}
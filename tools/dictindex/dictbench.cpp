@@ -0,0 +1,108 @@
+/*
+    dictbench - Compare ESpeak-NG text translation speed with and without a dictionary index
+
+    Copyright (c) 2025 Earle F. Philhower, III <earlephilhower@yahoo.com>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <Arduino.h>
+#include <time.h>
+#include <vector>
+#include <BackgroundAudioSpeech.h>
+#include VOICE_HEADER
+
+// Translate every word of the text to phonemes, one at a time, returning the seconds taken
+static double translate(const std::vector<std::string> &words, std::vector<std::string> *phonemes) {
+    phonemes->clear();
+    struct timespec a, b;
+    clock_gettime(CLOCK_MONOTONIC, &a);
+    for (auto &w : words) {
+        const void *p = w.c_str();
+        const char *ph = espeak_TextToPhonemes(&p, espeakCHARS_UTF8, 0);
+        phonemes->push_back(ph ? ph : "");
+    }
+    clock_gettime(CLOCK_MONOTONIC, &b);
+    return (b.tv_sec - a.tv_sec) + (b.tv_nsec - a.tv_nsec) / 1e9;
+}
+
+static void load(bool index) {
+    const BackgroundAudioDictionary *d = VOICE.dict;
+    espeak_RegisterDict(d->name, d->data, d->len, index ? d->index : nullptr, index ? d->indexLen : 0);
+    espeak_InstallVoice(VOICE.data, VOICE.len); // Loading the voice consumes it
+    espeak_SetVoiceByFile("INTERNAL"); // and reloads the dictionary
+}
+
+int main(int argc, char **argv) {
+    if ((argc < 2) || (argc > 3)) {
+        fprintf(stderr, "Usage: %s words.txt [passes]\n", argv[0]);
+        return 1;
+    }
+    int passes = (argc == 3) ? atoi(argv[2]) : 10;
+
+    std::vector<std::string> words;
+    FILE *f = fopen(argv[1], "r");
+    if (!f) {
+        perror(argv[1]);
+        return 1;
+    }
+    char w[256];
+    while (fscanf(f, "%255s", w) == 1) {
+        words.push_back(w);
+    }
+    fclose(f);
+    if (words.empty()) {
+        fprintf(stderr, "No words in %s\n", argv[1]);
+        return 1;
+    }
+
+    espeak_EnableSingleStep();
+    espeak_RegisterDict(VOICE.dict->name, VOICE.dict->data, VOICE.dict->len, VOICE.dict->index, VOICE.dict->indexLen);
+    espeak_InstallPhonIndex(_phonindex, sizeof(_phonindex));
+    espeak_InstallPhonTab(_phontab, sizeof(_phontab));
+    espeak_InstallPhonData(_phondata, sizeof(_phondata));
+    espeak_InstallIntonations(_intonations, sizeof(_intonations));
+    espeak_InstallVoice(VOICE.data, VOICE.len);
+    espeak_Initialize(AUDIO_OUTPUT_SYNCH_PLAYBACK, 20, nullptr, 0);
+
+    // Alternate between the two so that noise on the host affects both alike
+    std::vector<std::string> before, after;
+    double secsBefore = 0, secsAfter = 0;
+    for (int pass = 0; pass < passes; pass++) {
+        load(false);
+        secsBefore += translate(words, &before);
+        load(true);
+        secsAfter += translate(words, &after);
+    }
+    double wpsBefore = words.size() * passes / secsBefore;
+    double wpsAfter = words.size() * passes / secsAfter;
+
+    size_t diffs = 0;
+    for (size_t i = 0; i < words.size(); i++) {
+        if (before[i] != after[i]) {
+            if (!diffs++) {
+                fprintf(stderr, "Mismatch on \"%s\": \"%s\" vs \"%s\"\n", words[i].c_str(), before[i].c_str(), after[i].c_str());
+            }
+        }
+    }
+    printf("%zu words x %d passes\n", words.size(), passes);
+    printf("chain walk: %.0f words/s\n", wpsBefore);
+    printf("index:      %.0f words/s (%+.1f%%), %zu byte index\n", wpsAfter, (wpsAfter / wpsBefore - 1.0) * 100.0, VOICE.dict->indexLen);
+    printf("%zu words translated differently\n", diffs);
+    return diffs ? 1 : 0;
+}
+
+extern "C" int espeak_ng_CompileDictionary(...) {
+    return 0;
+}
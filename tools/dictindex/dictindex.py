@@ -0,0 +1,81 @@
+#!/usr/bin/env python3
+# Generates a lookup index header for an ESpeak-NG *_dict, see DICT_INDEX in src/libespeak-ng/dictionary.h
+import os
+import sys
+import re
+import struct
+import argparse
+
+N_HASH_DICT = 1024
+MAGIC = 0x31584445 # "EDX1"
+
+def load(path):
+    with open(path, "rb") as f:
+        data = f.read()
+    if path.endswith(".h"):
+        # One of our src/libespeak-ng/dict/*_dict.h headers, pull the bytes back out of the array
+        text = data.decode("utf-8")
+        body = text[text.index("{") + 1:text.index("};")]
+        data = bytes(int(x, 16) for x in re.findall(r"0x([0-9a-fA-F]{2})", body))
+    return data
+
+# Must match DictFingerprint() in src/libespeak-ng/dictionary.c
+def fingerprint(wlen, word):
+    h = 2166136261
+    h = ((h ^ (wlen & 0x7f)) * 16777619) & 0xffffffff
+    for c in word[:wlen & 0x3f]:
+        h = ((h ^ c) * 16777619) & 0xffffffff
+    return (h ^ (h >> 8) ^ (h >> 16) ^ (h >> 24)) & 0xff
+
+def index(data):
+    nhash, rules = struct.unpack_from("<II", data, 0)
+    if nhash != N_HASH_DICT:
+        raise ValueError("not a *_dict file")
+    start = []
+    fps = bytearray()
+    offsets = []
+    p = 8
+    for h in range(N_HASH_DICT):
+        start.append(len(offsets))
+        chain = p
+        while data[p] != 0:
+            if p - chain > 0xffff:
+                raise ValueError("hash chain %d too long to index" % h)
+            fps.append(fingerprint(data[p + 1], data[p + 2:]))
+            offsets.append(p - chain)
+            p += data[p]
+        p += 1
+    start.append(len(offsets))
+    if len(offsets) > 0xffff:
+        raise ValueError("too many entries to index")
+    out = struct.pack("<IIII", MAGIC, len(data), rules, len(offsets))
+    out += struct.pack("<%dH" % len(start), *start)
+    while len(out) & 3:
+        out += b"\0" # sizeof(DICT_INDEX)
+    out += fps
+    if len(fps) & 1:
+        out += b"\0"
+    out += struct.pack("<%dH" % len(offsets), *offsets)
+    return out
+
+def main():
+    parser = argparse.ArgumentParser(description='ESpeak-NG dictionary index generator')
+    parser.add_argument('dict', help='Binary *_dict file, or a src/libespeak-ng/dict/*_dict.h header')
+    parser.add_argument('output', nargs='?', help='Header to write, default stdout')
+    parser.add_argument('-n', '--name', help='Dictionary name, default taken from the input (i.e. en_dict => en)')
+    args = parser.parse_args()
+
+    name = args.name or re.sub(r"_dict(\.h)?$", "", os.path.basename(args.dict))
+    ix = index(load(args.dict))
+    fout = open(args.output, "w") if args.output else sys.stdout
+    fout.write("#pragma once\n")
+    fout.write("const unsigned char __espeakng_dictindex_%s[] __attribute__((aligned((4)))) = {\n" % name)
+    for i in range(0, len(ix), 12):
+        row = ", ".join("0x%02x" % b for b in ix[i:i + 12])
+        fout.write("  " + row + (",\n" if i + 12 < len(ix) else "\n"))
+    fout.write("};\n")
+    if fout != sys.stdout:
+        fout.close()
+
+if __name__ == "__main__":
+    main()
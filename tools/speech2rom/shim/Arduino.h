@@ -0,0 +1,52 @@
+// Just enough of the Arduino and Pico SDK APIs to build BackgroundAudioSpeech on a PC for speech2rom
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <strings.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <assert.h>
+#include <algorithm>
+#include <string>
+
+typedef struct {
+    int unused;
+} mutex_t;
+
+static inline void mutex_init(mutex_t *m) {
+    (void) m;
+}
+
+static inline void mutex_enter_blocking(mutex_t *m) {
+    (void) m;
+}
+
+static inline void mutex_exit(mutex_t *m) {
+    (void) m;
+}
+
+static inline void noInterrupts() {
+}
+
+static inline void interrupts() {
+}
+
+class String {
+public:
+    String(const char *s) : _s(s) { }
+    const char *c_str() const {
+        return _s.c_str();
+    }
+private:
+    std::string _s;
+};
+
+class Print {
+public:
+    virtual ~Print() { }
+    virtual size_t write(const uint8_t *buffer, size_t size) = 0;
+    virtual int availableForWrite() {
+        return 0;
+    }
+};
@@ -0,0 +1,326 @@
+/*
+    speech2rom - Render fixed speech prompts into a ROM header for BackgroundAudioPrompts
+
+    Copyright (c) 2025 Earle F. Philhower, III <earlephilhower@yahoo.com>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <Arduino.h>
+#include <getopt.h>
+#include <ctype.h>
+#include <unistd.h>
+#include <sys/wait.h>
+#include <vector>
+#include <BackgroundAudioSpeech.h>
+#include <BackgroundAudioADPCM.h>
+#include VOICE_HEADER
+
+// Records the left channel of whatever the speaker sends, one output block per pump
+class CaptureOutput : public AudioOutputBase {
+public:
+    bool setBuffers(size_t buffers, size_t bufferWords, int32_t silenceSample = 0) override {
+        (void) buffers;
+        (void) silenceSample;
+        _blockBytes = bufferWords * 4;
+        return true;
+    }
+    bool setBitsPerSample(int bps) override {
+        return bps == 16;
+    }
+    bool setFrequency(int freq) override {
+        _freq = freq;
+        return true;
+    }
+    bool setStereo(bool stereo = true) override {
+        return stereo;
+    }
+    bool begin() override {
+        return true;
+    }
+    bool end() override {
+        return true;
+    }
+    bool getUnderflow() override {
+        return false;
+    }
+    void onTransmit(void (*cb)(void *), void *cbData) override {
+        _cb = cb;
+        _cbData = cbData;
+    }
+    size_t write(const uint8_t *buffer, size_t size) override {
+        size = std::min(size, _avail);
+        const int16_t *s = (const int16_t *)buffer;
+        for (size_t i = 0; i < size / 4; i++) {
+            samples.push_back(s[i * 2]);
+        }
+        _avail -= size;
+        return size;
+    }
+    int availableForWrite() override {
+        return _avail;
+    }
+
+    // Let the speaker generate one block, as the DMA callback would
+    void pump() {
+        _avail = _blockBytes;
+        _cb(_cbData);
+    }
+
+    int frequency() {
+        return _freq;
+    }
+
+    std::vector<int16_t> samples;
+
+private:
+    void (*_cb)(void *) = nullptr;
+    void *_cbData = nullptr;
+    size_t _avail = 0;
+    size_t _blockBytes = 0;
+    int _freq = 0;
+};
+
+typedef struct {
+    std::string id;
+    std::string text;
+    uint32_t offset;
+    uint32_t samples;
+} Phrase;
+
+static std::string trim(const std::string &s) {
+    size_t a = s.find_first_not_of(" \t\r\n");
+    size_t b = s.find_last_not_of(" \t\r\n");
+    return (a == std::string::npos) ? "" : s.substr(a, b - a + 1);
+}
+
+// Make a C identifier out of a prompt's text, i.e. "Please wait." => PLEASE_WAIT
+static std::string identifier(const std::string &s) {
+    std::string id;
+    for (char c : s) {
+        if (isalnum((unsigned char)c)) {
+            id += toupper((unsigned char)c);
+        } else if (!id.empty() && (id.back() != '_')) {
+            id += '_';
+        }
+    }
+    while (!id.empty() && (id.back() == '_')) {
+        id.pop_back();
+    }
+    if (id.empty() || isdigit((unsigned char)id[0])) {
+        id = "P_" + id;
+    }
+    return id;
+}
+
+// Speak one prompt exactly as the library would, as the first thing said after power-up.  ESpeak-NG keeps
+// state (i.e. its noise generator) between utterances, so each prompt is rendered in a fresh process.
+static bool render(const std::string &text, int rate, int pitch, int gap, std::vector<int16_t> *samples, int *sampleRate) {
+    int fd[2];
+    if (pipe(fd)) {
+        return false;
+    }
+    fflush(stdout);
+    fflush(stderr);
+    pid_t pid = fork();
+    if (pid < 0) {
+        return false;
+    } else if (!pid) {
+        close(fd[0]);
+        CaptureOutput out;
+        BackgroundAudioSpeech speech(out);
+        speech.setVoice(VOICE);
+        if (!speech.begin()) {
+            _exit(1);
+        }
+        if (rate >= 0) {
+            speech.setRate(rate);
+        }
+        if (pitch >= 0) {
+            speech.setPitch(pitch);
+        }
+        if (gap >= 0) {
+            speech.setWordGap(gap);
+        }
+        if (!speech.speak(text.c_str())) {
+            fprintf(stderr, "Prompt \"%s\" is too long\n", text.c_str());
+            _exit(1);
+        }
+        while (!speech.done()) {
+            out.pump();
+        }
+        // Anything after the last non-zero sample is the idle speaker's silence
+        while (!out.samples.empty() && !out.samples.back()) {
+            out.samples.pop_back();
+        }
+        int freq = out.frequency();
+        bool ok = write(fd[1], &freq, sizeof(freq)) == sizeof(freq);
+        const uint8_t *p = (const uint8_t *)out.samples.data();
+        size_t len = out.samples.size() * sizeof(int16_t);
+        while (ok && len) {
+            ssize_t w = write(fd[1], p, len);
+            ok = w > 0;
+            p += w;
+            len -= w;
+        }
+        _exit(ok ? 0 : 1);
+    }
+    close(fd[1]);
+    bool ok = read(fd[0], sampleRate, sizeof(*sampleRate)) == sizeof(*sampleRate);
+    int16_t buff[1024];
+    ssize_t r;
+    while (ok && ((r = read(fd[0], buff, sizeof(buff))) > 0)) {
+        samples->insert(samples->end(), buff, buff + r / sizeof(int16_t));
+    }
+    close(fd[0]);
+    int status;
+    waitpid(pid, &status, 0);
+    return ok && WIFEXITED(status) && !WEXITSTATUS(status);
+}
+
+static void usage(const char *me) {
+    fprintf(stderr, "Usage: %s [-a] [-r rate] [-p pitch] [-g gap] [-n name] phrases.txt [output.h]\n", me);
+    fprintf(stderr, "  -a, --adpcm    Store 4-bit IMA-ADPCM instead of 16-bit PCM\n");
+    fprintf(stderr, "  -r, --rate     Speaking rate in ~WPM, as BackgroundAudioSpeech::setRate\n");
+    fprintf(stderr, "  -p, --pitch    Pitch 0...99, as BackgroundAudioSpeech::setPitch\n");
+    fprintf(stderr, "  -g, --gap      Word gap, as BackgroundAudioSpeech::setWordGap\n");
+    fprintf(stderr, "  -n, --name     Name of the prompt set, giving prompts_<name> (default \"prompts\")\n");
+    fprintf(stderr, "Each line of phrases.txt is a prompt, optionally as ID=text.  Lines starting with # are ignored.\n");
+}
+
+int main(int argc, char **argv) {
+    bool adpcm = false;
+    int rate = -1;
+    int pitch = -1;
+    int gap = -1;
+    std::string name = "prompts";
+
+    static const struct option opts[] = {
+        { "adpcm", no_argument, nullptr, 'a' },
+        { "rate", required_argument, nullptr, 'r' },
+        { "pitch", required_argument, nullptr, 'p' },
+        { "gap", required_argument, nullptr, 'g' },
+        { "name", required_argument, nullptr, 'n' },
+        { nullptr, 0, nullptr, 0 }
+    };
+    int c;
+    while ((c = getopt_long(argc, argv, "ar:p:g:n:", opts, nullptr)) != -1) {
+        switch (c) {
+        case 'a': adpcm = true; break;
+        case 'r': rate = atoi(optarg); break;
+        case 'p': pitch = atoi(optarg); break;
+        case 'g': gap = atoi(optarg); break;
+        case 'n': name = optarg; break;
+        default: usage(argv[0]); return 1;
+        }
+    }
+    if ((optind != argc - 1) && (optind != argc - 2)) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    std::vector<Phrase> phrases;
+    FILE *in = fopen(argv[optind], "r");
+    if (!in) {
+        perror(argv[optind]);
+        return 1;
+    }
+    char line[4096];
+    while (fgets(line, sizeof(line), in)) {
+        std::string l = trim(line);
+        if (l.empty() || (l[0] == '#')) {
+            continue;
+        }
+        Phrase p;
+        size_t eq = l.find('=');
+        if ((eq != std::string::npos) && (identifier(trim(l.substr(0, eq))) == trim(l.substr(0, eq)))) {
+            p.id = trim(l.substr(0, eq));
+            p.text = trim(l.substr(eq + 1));
+        } else {
+            p.id = identifier(l);
+            p.text = l;
+        }
+        for (auto &q : phrases) {
+            if (q.id == p.id) {
+                fprintf(stderr, "Duplicate prompt ID %s\n", p.id.c_str());
+                return 1;
+            }
+        }
+        phrases.push_back(p);
+    }
+    fclose(in);
+
+    std::vector<uint8_t> data;
+    int sampleRate = 0;
+    for (auto &p : phrases) {
+        std::vector<int16_t> samples;
+        if (!render(p.text, rate, pitch, gap, &samples, &sampleRate)) {
+            fprintf(stderr, "Unable to render prompt %s\n", p.id.c_str());
+            return 1;
+        }
+        p.offset = data.size();
+        p.samples = samples.size();
+        if (adpcm) {
+            IMAADPCMEncoder enc;
+            for (size_t i = 0; i < samples.size(); i += 2) {
+                uint8_t lo = enc.encode(samples[i]);
+                uint8_t hi = (i + 1 < samples.size()) ? enc.encode(samples[i + 1]) : 0;
+                data.push_back(lo | (hi << 4));
+            }
+        } else {
+            for (auto s : samples) {
+                data.push_back(s & 0xff);
+                data.push_back((s >> 8) & 0xff);
+            }
+        }
+        while (data.size() & 3) {
+            data.push_back(0);
+        }
+        fprintf(stderr, "%s: %u samples, \"%s\"\n", p.id.c_str(), p.samples, p.text.c_str());
+    }
+
+    FILE *f = stdout;
+    if (optind == argc - 2) {
+        f = fopen(argv[optind + 1], "w");
+        if (!f) {
+            perror(argv[optind + 1]);
+            return 1;
+        }
+    }
+    std::string upper = identifier(name);
+    fprintf(f, "// Auto-generated by tools/speech2rom, do not edit!\n");
+    fprintf(f, "#pragma once\n");
+    fprintf(f, "#include <BackgroundAudioPrompts.h>\n\n");
+    fprintf(f, "const unsigned char __prompts_%s_data[] __attribute__((aligned((4)))) = {", name.c_str());
+    for (size_t i = 0; i < data.size(); i++) {
+        fprintf(f, "%s0x%02x%s", (i % 12) ? " " : "\n  ", data[i], (i + 1 < data.size()) ? "," : "\n");
+    }
+    fprintf(f, "};\n\n");
+    fprintf(f, "const BackgroundAudioPrompt __prompts_%s_index[] = {\n", name.c_str());
+    for (auto &p : phrases) {
+        fprintf(f, "    { %u, %u },\n", p.offset, p.samples);
+    }
+    fprintf(f, "};\n\n");
+    fprintf(f, "const BackgroundAudioPromptSet prompts_%s = {\n", name.c_str());
+    fprintf(f, "    %d,\n    %s,\n    %zu,\n    __prompts_%s_index,\n    __prompts_%s_data\n};\n\n", sampleRate, adpcm ? "true" : "false", phrases.size(), name.c_str(), name.c_str());
+    fprintf(f, "enum {\n");
+    for (size_t i = 0; i < phrases.size(); i++) {
+        fprintf(f, "    %s_%s = %zu, // \"%s\"\n", upper.c_str(), phrases[i].id.c_str(), i, phrases[i].text.c_str());
+    }
+    fprintf(f, "};\n");
+    if (f != stdout) {
+        fclose(f);
+    }
+    return 0;
+}
@@ -0,0 +1,63 @@
+#!/usr/bin/env python3
+# Converts a BackgroundAudioTrace::dump (from Serial or a host program) into Chrome trace_event JSON
+# for chrome://tracing or https://ui.perfetto.dev
+#
+#     trace2chrome.py capture.txt trace.json
+#
+# Anything in the capture which isn't a trace line is ignored, so a raw serial log is fine.
+import argparse
+import json
+import sys
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Convert a BackgroundAudio trace dump to Chrome trace JSON")
+    parser.add_argument("input", help="Dump text, or - for stdin")
+    parser.add_argument("output", help="JSON trace to write, or - for stdout")
+    args = parser.parse_args()
+
+    f = sys.stdin if args.input == "-" else open(args.input, errors="replace")
+    names = {}
+    cores = {}
+    for line in f:
+        w = line.split()
+        if len(w) >= 3 and w[0] == "N":
+            names[w[1]] = " ".join(w[2:])
+        elif len(w) == 8 and w[0] == "E":
+            core, seq, time = int(w[1]), int(w[2]), int(w[3])
+            cores.setdefault(core, []).append((seq, time, w[4], w[5], w[6], int(w[7])))
+
+    events = []
+    for core, entries in sorted(cores.items()):
+        # Sequence numbers give the order within a core, and let the 32-bit microsecond clock be unwrapped
+        entries.sort()
+        base = 0
+        last = None
+        for seq, time, src, phase, name, arg in entries:
+            if last is not None and time + base < last - (1 << 31):
+                base += 1 << 32
+            last = time + base
+            e = {"name": name, "ph": phase, "ts": last, "pid": core, "tid": int(src, 16), "args": {"arg": arg}}
+            if phase == "i":
+                e["s"] = "g" if name == "underflow" else "t"
+            events.append(e)
+
+    # Label each core and each object with its name
+    for core in cores:
+        events.append({"name": "process_name", "ph": "M", "pid": core, "args": {"name": "Core %d" % core}})
+    for core, entries in cores.items():
+        for src in sorted(set(x[2] for x in entries)):
+            label = "%s @%s" % (names.get(src, "Unknown"), src)
+            events.append({"name": "thread_name", "ph": "M", "pid": core, "tid": int(src, 16), "args": {"name": label}})
+
+    if not events:
+        print("ERROR: No trace events found in input", file=sys.stderr)
+        return 1
+    out = sys.stdout if args.output == "-" else open(args.output, "w")
+    json.dump({"traceEvents": events, "displayTimeUnit": "ms"}, out, indent=1)
+    out.write("\n")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())